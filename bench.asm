@@ -0,0 +1,3871 @@
+
+_bench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <perop>:
+}
+
+// ns per operation, for n operations that took us microseconds.
+static uint
+perop(uint us, uint n)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	53                   	push   %ebx
+       4:	89 d3                	mov    %edx,%ebx
+  return us/n*1000 + us%n*1000/n;
+       6:	ba 00 00 00 00       	mov    $0x0,%edx
+       b:	f7 f3                	div    %ebx
+       d:	69 c8 e8 03 00 00    	imul   $0x3e8,%eax,%ecx
+      13:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+      19:	ba 00 00 00 00       	mov    $0x0,%edx
+      1e:	f7 f3                	div    %ebx
+      20:	01 c8                	add    %ecx,%eax
+}
+      22:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      25:	c9                   	leave
+      26:	c3                   	ret
+
+00000027 <rate>:
+
+// KB per second, for n bytes moved in us microseconds.
+static uint
+rate(uint n, uint us)
+{
+      27:	55                   	push   %ebp
+      28:	89 e5                	mov    %esp,%ebp
+      2a:	53                   	push   %ebx
+  if(us < 1000)
+      2b:	81 fa e7 03 00 00    	cmp    $0x3e7,%edx
+      31:	77 05                	ja     38 <rate+0x11>
+    us = 1000;
+      33:	ba e8 03 00 00       	mov    $0x3e8,%edx
+  return n/1024*1000 / (us/1000);
+      38:	c1 e8 0a             	shr    $0xa,%eax
+      3b:	69 c8 e8 03 00 00    	imul   $0x3e8,%eax,%ecx
+      41:	bb d3 4d 62 10       	mov    $0x10624dd3,%ebx
+      46:	89 d0                	mov    %edx,%eax
+      48:	f7 e3                	mul    %ebx
+      4a:	89 d3                	mov    %edx,%ebx
+      4c:	c1 eb 06             	shr    $0x6,%ebx
+      4f:	89 c8                	mov    %ecx,%eax
+      51:	ba 00 00 00 00       	mov    $0x0,%edx
+      56:	f7 f3                	div    %ebx
+}
+      58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      5b:	c9                   	leave
+      5c:	c3                   	ret
+
+0000005d <rnd>:
+static uint seed = 1;
+
+static uint
+rnd(void)
+{
+  seed = seed * 1103515245 + 12345;
+      5d:	69 05 40 28 00 00 6d 	imul   $0x41c64e6d,0x2840,%eax
+      64:	4e c6 41 
+      67:	05 39 30 00 00       	add    $0x3039,%eax
+      6c:	a3 40 28 00 00       	mov    %eax,0x2840
+  return seed >> 8;
+      71:	c1 e8 08             	shr    $0x8,%eax
+}
+      74:	c3                   	ret
+
+00000075 <fail>:
+{
+      75:	55                   	push   %ebp
+      76:	89 e5                	mov    %esp,%ebp
+      78:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "bench: %s failed\n", what);
+      7b:	50                   	push   %eax
+      7c:	68 a0 1c 00 00       	push   $0x1ca0
+      81:	6a 02                	push   $0x2
+      83:	e8 ee 15 00 00       	call   1676 <printf>
+  exit();
+      88:	e8 b0 10 00 00       	call   113d <exit>
+
+0000008d <result>:
+{
+      8d:	55                   	push   %ebp
+      8e:	89 e5                	mov    %esp,%ebp
+      90:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "%s %d %s\n", name, value, unit);
+      93:	51                   	push   %ecx
+      94:	52                   	push   %edx
+      95:	50                   	push   %eax
+      96:	68 b2 1c 00 00       	push   $0x1cb2
+      9b:	6a 01                	push   $0x1
+      9d:	e8 d4 15 00 00       	call   1676 <printf>
+}
+      a2:	83 c4 20             	add    $0x20,%esp
+      a5:	c9                   	leave
+      a6:	c3                   	ret
+
+000000a7 <usec>:
+{
+      a7:	55                   	push   %ebp
+      a8:	89 e5                	mov    %esp,%ebp
+      aa:	83 ec 20             	sub    $0x20,%esp
+  vclock_gettime(CLOCK_MONOTONIC, &ts);
+      ad:	8d 45 f0             	lea    -0x10(%ebp),%eax
+      b0:	50                   	push   %eax
+      b1:	6a 01                	push   $0x1
+      b3:	e8 5e 0d 00 00       	call   e16 <vclock_gettime>
+  return ts.tv_sec*1000000 + ts.tv_nsec/1000;
+      b8:	69 4d f0 40 42 0f 00 	imul   $0xf4240,-0x10(%ebp),%ecx
+      bf:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+      c4:	89 d0                	mov    %edx,%eax
+      c6:	f7 65 f4             	mull   -0xc(%ebp)
+      c9:	c1 ea 06             	shr    $0x6,%edx
+      cc:	8d 04 11             	lea    (%ecx,%edx,1),%eax
+}
+      cf:	c9                   	leave
+      d0:	c3                   	ret
+
+000000d1 <lookup>:
+}
+
+// stat() of a file 1 and NDEPTH directories down.
+static void
+lookup(void)
+{
+      d1:	55                   	push   %ebp
+      d2:	89 e5                	mov    %esp,%ebp
+      d4:	56                   	push   %esi
+      d5:	53                   	push   %ebx
+      d6:	83 ec 40             	sub    $0x40,%esp
+  char path[3*NDEPTH + 8];
+  struct stat st;
+  uint t, i, n = 2000;
+  int d, fd;
+
+  for(d = 0; d < NDEPTH; d++){
+      d9:	be 00 00 00 00       	mov    $0x0,%esi
+      de:	eb 08                	jmp    e8 <lookup+0x17>
+    path[3*d] = 'l';
+    path[3*d+1] = '0' + d;
+    path[3*d+2] = 0;
+    if(mkdir(path) < 0)
+      fail("mkdir");
+    path[3*d+2] = '/';
+      e0:	c6 44 1d d8 2f       	movb   $0x2f,-0x28(%ebp,%ebx,1)
+  for(d = 0; d < NDEPTH; d++){
+      e5:	83 c6 01             	add    $0x1,%esi
+      e8:	83 fe 07             	cmp    $0x7,%esi
+      eb:	7f 34                	jg     121 <lookup+0x50>
+    path[3*d] = 'l';
+      ed:	8d 04 76             	lea    (%esi,%esi,2),%eax
+      f0:	c6 44 05 d8 6c       	movb   $0x6c,-0x28(%ebp,%eax,1)
+    path[3*d+1] = '0' + d;
+      f5:	8d 56 30             	lea    0x30(%esi),%edx
+      f8:	88 54 05 d9          	mov    %dl,-0x27(%ebp,%eax,1)
+    path[3*d+2] = 0;
+      fc:	8d 58 02             	lea    0x2(%eax),%ebx
+      ff:	c6 44 1d d8 00       	movb   $0x0,-0x28(%ebp,%ebx,1)
+    if(mkdir(path) < 0)
+     104:	83 ec 0c             	sub    $0xc,%esp
+     107:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     10a:	50                   	push   %eax
+     10b:	e8 c9 11 00 00       	call   12d9 <mkdir>
+     110:	83 c4 10             	add    $0x10,%esp
+     113:	85 c0                	test   %eax,%eax
+     115:	79 c9                	jns    e0 <lookup+0xf>
+      fail("mkdir");
+     117:	b8 bc 1c 00 00       	mov    $0x1cbc,%eax
+     11c:	e8 54 ff ff ff       	call   75 <fail>
+  }
+  strcpy(path + 3*NDEPTH, "f");
+     121:	83 ec 08             	sub    $0x8,%esp
+     124:	68 06 1d 00 00       	push   $0x1d06
+     129:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     12c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     12f:	50                   	push   %eax
+     130:	e8 d0 09 00 00       	call   b05 <strcpy>
+  if((fd = open(path, O_CREATE|O_RDWR)) < 0)
+     135:	83 c4 08             	add    $0x8,%esp
+     138:	68 02 02 00 00       	push   $0x202
+     13d:	53                   	push   %ebx
+     13e:	e8 4b 11 00 00       	call   128e <open>
+     143:	83 c4 10             	add    $0x10,%esp
+     146:	85 c0                	test   %eax,%eax
+     148:	78 1a                	js     164 <lookup+0x93>
+    fail("create");
+  close(fd);
+     14a:	83 ec 0c             	sub    $0xc,%esp
+     14d:	50                   	push   %eax
+     14e:	e8 19 10 00 00       	call   116c <close>
+
+  t = usec();
+     153:	e8 4f ff ff ff       	call   a7 <usec>
+     158:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < n; i++)
+     15a:	83 c4 10             	add    $0x10,%esp
+     15d:	bb 00 00 00 00       	mov    $0x0,%ebx
+     162:	eb 0d                	jmp    171 <lookup+0xa0>
+    fail("create");
+     164:	b8 c2 1c 00 00       	mov    $0x1cc2,%eax
+     169:	e8 07 ff ff ff       	call   75 <fail>
+  for(i = 0; i < n; i++)
+     16e:	83 c3 01             	add    $0x1,%ebx
+     171:	81 fb cf 07 00 00    	cmp    $0x7cf,%ebx
+     177:	77 22                	ja     19b <lookup+0xca>
+    if(stat("l0", &st) < 0)
+     179:	83 ec 08             	sub    $0x8,%esp
+     17c:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+     17f:	50                   	push   %eax
+     180:	68 c9 1c 00 00       	push   $0x1cc9
+     185:	e8 01 10 00 00       	call   118b <stat>
+     18a:	83 c4 10             	add    $0x10,%esp
+     18d:	85 c0                	test   %eax,%eax
+     18f:	79 dd                	jns    16e <lookup+0x9d>
+      fail("stat");
+     191:	b8 cc 1c 00 00       	mov    $0x1ccc,%eax
+     196:	e8 da fe ff ff       	call   75 <fail>
+  result("lookup_depth1", perop(usec() - t, n), "ns");
+     19b:	e8 07 ff ff ff       	call   a7 <usec>
+     1a0:	29 f0                	sub    %esi,%eax
+     1a2:	ba d0 07 00 00       	mov    $0x7d0,%edx
+     1a7:	e8 54 fe ff ff       	call   0 <perop>
+     1ac:	89 c2                	mov    %eax,%edx
+     1ae:	b9 d1 1c 00 00       	mov    $0x1cd1,%ecx
+     1b3:	b8 d4 1c 00 00       	mov    $0x1cd4,%eax
+     1b8:	e8 d0 fe ff ff       	call   8d <result>
+  t = usec();
+     1bd:	e8 e5 fe ff ff       	call   a7 <usec>
+     1c2:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < n; i++)
+     1c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+     1c9:	eb 03                	jmp    1ce <lookup+0xfd>
+     1cb:	83 c3 01             	add    $0x1,%ebx
+     1ce:	81 fb cf 07 00 00    	cmp    $0x7cf,%ebx
+     1d4:	77 21                	ja     1f7 <lookup+0x126>
+    if(stat(path, &st) < 0)
+     1d6:	83 ec 08             	sub    $0x8,%esp
+     1d9:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+     1dc:	50                   	push   %eax
+     1dd:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     1e0:	50                   	push   %eax
+     1e1:	e8 a5 0f 00 00       	call   118b <stat>
+     1e6:	83 c4 10             	add    $0x10,%esp
+     1e9:	85 c0                	test   %eax,%eax
+     1eb:	79 de                	jns    1cb <lookup+0xfa>
+      fail("stat");
+     1ed:	b8 cc 1c 00 00       	mov    $0x1ccc,%eax
+     1f2:	e8 7e fe ff ff       	call   75 <fail>
+  result("lookup_depth9", perop(usec() - t, n), "ns");
+     1f7:	e8 ab fe ff ff       	call   a7 <usec>
+     1fc:	29 f0                	sub    %esi,%eax
+     1fe:	ba d0 07 00 00       	mov    $0x7d0,%edx
+     203:	e8 f8 fd ff ff       	call   0 <perop>
+     208:	89 c2                	mov    %eax,%edx
+     20a:	b9 d1 1c 00 00       	mov    $0x1cd1,%ecx
+     20f:	b8 e2 1c 00 00       	mov    $0x1ce2,%eax
+     214:	e8 74 fe ff ff       	call   8d <result>
+
+  unlink(path);
+     219:	83 ec 0c             	sub    $0xc,%esp
+     21c:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     21f:	50                   	push   %eax
+     220:	e8 87 10 00 00       	call   12ac <unlink>
+  for(d = NDEPTH-1; d >= 0; d--){
+     225:	83 c4 10             	add    $0x10,%esp
+     228:	bb 07 00 00 00       	mov    $0x7,%ebx
+     22d:	eb 1b                	jmp    24a <lookup+0x179>
+    path[3*d+2] = 0;
+     22f:	8d 44 5b 02          	lea    0x2(%ebx,%ebx,2),%eax
+     233:	c6 44 05 d8 00       	movb   $0x0,-0x28(%ebp,%eax,1)
+    unlink(path);
+     238:	83 ec 0c             	sub    $0xc,%esp
+     23b:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     23e:	50                   	push   %eax
+     23f:	e8 68 10 00 00       	call   12ac <unlink>
+  for(d = NDEPTH-1; d >= 0; d--){
+     244:	83 eb 01             	sub    $0x1,%ebx
+     247:	83 c4 10             	add    $0x10,%esp
+     24a:	85 db                	test   %ebx,%ebx
+     24c:	79 e1                	jns    22f <lookup+0x15e>
+  }
+}
+     24e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     251:	5b                   	pop    %ebx
+     252:	5e                   	pop    %esi
+     253:	5d                   	pop    %ebp
+     254:	c3                   	ret
+
+00000255 <createunlink>:
+{
+     255:	55                   	push   %ebp
+     256:	89 e5                	mov    %esp,%ebp
+     258:	57                   	push   %edi
+     259:	56                   	push   %esi
+     25a:	53                   	push   %ebx
+     25b:	83 ec 1c             	sub    $0x1c,%esp
+  name[0] = 'b';
+     25e:	c6 45 e0 62          	movb   $0x62,-0x20(%ebp)
+  name[1] = 'c';
+     262:	c6 45 e1 63          	movb   $0x63,-0x1f(%ebp)
+  name[4] = 0;
+     266:	c6 45 e4 00          	movb   $0x0,-0x1c(%ebp)
+  t = usec();
+     26a:	e8 38 fe ff ff       	call   a7 <usec>
+     26f:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < n; i++){
+     271:	bb 00 00 00 00       	mov    $0x0,%ebx
+     276:	81 fb c7 00 00 00    	cmp    $0xc7,%ebx
+     27c:	77 7b                	ja     2f9 <createunlink+0xa4>
+    name[2] = 'a' + i/26%26;
+     27e:	bf 4f ec c4 4e       	mov    $0x4ec4ec4f,%edi
+     283:	89 d8                	mov    %ebx,%eax
+     285:	f7 e7                	mul    %edi
+     287:	89 d1                	mov    %edx,%ecx
+     289:	c1 e9 03             	shr    $0x3,%ecx
+     28c:	89 c8                	mov    %ecx,%eax
+     28e:	f7 e7                	mul    %edi
+     290:	c1 ea 03             	shr    $0x3,%edx
+     293:	6b c2 1a             	imul   $0x1a,%edx,%eax
+     296:	89 ca                	mov    %ecx,%edx
+     298:	29 c2                	sub    %eax,%edx
+     29a:	83 c2 61             	add    $0x61,%edx
+     29d:	88 55 e2             	mov    %dl,-0x1e(%ebp)
+    name[3] = 'a' + i%26;
+     2a0:	6b c9 1a             	imul   $0x1a,%ecx,%ecx
+     2a3:	89 d8                	mov    %ebx,%eax
+     2a5:	29 c8                	sub    %ecx,%eax
+     2a7:	83 c0 61             	add    $0x61,%eax
+     2aa:	88 45 e3             	mov    %al,-0x1d(%ebp)
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0)
+     2ad:	83 ec 08             	sub    $0x8,%esp
+     2b0:	68 02 02 00 00       	push   $0x202
+     2b5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     2b8:	50                   	push   %eax
+     2b9:	e8 d0 0f 00 00       	call   128e <open>
+     2be:	83 c4 10             	add    $0x10,%esp
+     2c1:	85 c0                	test   %eax,%eax
+     2c3:	78 20                	js     2e5 <createunlink+0x90>
+    close(fd);
+     2c5:	83 ec 0c             	sub    $0xc,%esp
+     2c8:	50                   	push   %eax
+     2c9:	e8 9e 0e 00 00       	call   116c <close>
+    if(unlink(name) < 0)
+     2ce:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     2d1:	89 04 24             	mov    %eax,(%esp)
+     2d4:	e8 d3 0f 00 00       	call   12ac <unlink>
+     2d9:	83 c4 10             	add    $0x10,%esp
+     2dc:	85 c0                	test   %eax,%eax
+     2de:	78 0f                	js     2ef <createunlink+0x9a>
+  for(i = 0; i < n; i++){
+     2e0:	83 c3 01             	add    $0x1,%ebx
+     2e3:	eb 91                	jmp    276 <createunlink+0x21>
+      fail("create");
+     2e5:	b8 c2 1c 00 00       	mov    $0x1cc2,%eax
+     2ea:	e8 86 fd ff ff       	call   75 <fail>
+      fail("unlink");
+     2ef:	b8 fa 1c 00 00       	mov    $0x1cfa,%eax
+     2f4:	e8 7c fd ff ff       	call   75 <fail>
+  result("create_unlink", perop(usec() - t, n) / 1000, "us");
+     2f9:	e8 a9 fd ff ff       	call   a7 <usec>
+     2fe:	29 f0                	sub    %esi,%eax
+     300:	ba c8 00 00 00       	mov    $0xc8,%edx
+     305:	e8 f6 fc ff ff       	call   0 <perop>
+     30a:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+     30f:	f7 e2                	mul    %edx
+     311:	c1 ea 06             	shr    $0x6,%edx
+     314:	b9 f0 1c 00 00       	mov    $0x1cf0,%ecx
+     319:	b8 f3 1c 00 00       	mov    $0x1cf3,%eax
+     31e:	e8 6a fd ff ff       	call   8d <result>
+}
+     323:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     326:	5b                   	pop    %ebx
+     327:	5e                   	pop    %esi
+     328:	5f                   	pop    %edi
+     329:	5d                   	pop    %ebp
+     32a:	c3                   	ret
+
+0000032b <benchfile>:
+{
+     32b:	55                   	push   %ebp
+     32c:	89 e5                	mov    %esp,%ebp
+     32e:	56                   	push   %esi
+     32f:	53                   	push   %ebx
+  if((fd = open("benchf", O_CREATE|O_RDWR)) < 0)
+     330:	83 ec 08             	sub    $0x8,%esp
+     333:	68 02 02 00 00       	push   $0x202
+     338:	68 01 1d 00 00       	push   $0x1d01
+     33d:	e8 4c 0f 00 00       	call   128e <open>
+     342:	83 c4 10             	add    $0x10,%esp
+     345:	85 c0                	test   %eax,%eax
+     347:	78 34                	js     37d <benchfile+0x52>
+     349:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < FILESZ; i += sizeof(buf))
+     34b:	bb 00 00 00 00       	mov    $0x0,%ebx
+     350:	81 fb ff ff 0f 00    	cmp    $0xfffff,%ebx
+     356:	7f 39                	jg     391 <benchfile+0x66>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf))
+     358:	83 ec 04             	sub    $0x4,%esp
+     35b:	68 00 20 00 00       	push   $0x2000
+     360:	68 80 28 00 00       	push   $0x2880
+     365:	56                   	push   %esi
+     366:	e8 05 0f 00 00       	call   1270 <write>
+     36b:	83 c4 10             	add    $0x10,%esp
+     36e:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     373:	75 12                	jne    387 <benchfile+0x5c>
+  for(i = 0; i < FILESZ; i += sizeof(buf))
+     375:	81 c3 00 20 00 00    	add    $0x2000,%ebx
+     37b:	eb d3                	jmp    350 <benchfile+0x25>
+    fail("create");
+     37d:	b8 c2 1c 00 00       	mov    $0x1cc2,%eax
+     382:	e8 ee fc ff ff       	call   75 <fail>
+      fail("write");
+     387:	b8 7f 1d 00 00       	mov    $0x1d7f,%eax
+     38c:	e8 e4 fc ff ff       	call   75 <fail>
+}
+     391:	89 f0                	mov    %esi,%eax
+     393:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     396:	5b                   	pop    %ebx
+     397:	5e                   	pop    %esi
+     398:	5d                   	pop    %ebp
+     399:	c3                   	ret
+
+0000039a <filerand>:
+{
+     39a:	55                   	push   %ebp
+     39b:	89 e5                	mov    %esp,%ebp
+     39d:	57                   	push   %edi
+     39e:	56                   	push   %esi
+     39f:	53                   	push   %ebx
+     3a0:	83 ec 0c             	sub    $0xc,%esp
+  fd = benchfile();
+     3a3:	e8 83 ff ff ff       	call   32b <benchfile>
+     3a8:	89 c6                	mov    %eax,%esi
+  fsync(fd);
+     3aa:	83 ec 0c             	sub    $0xc,%esp
+     3ad:	50                   	push   %eax
+     3ae:	e8 d9 10 00 00       	call   148c <fsync>
+  t = usec();
+     3b3:	e8 ef fc ff ff       	call   a7 <usec>
+     3b8:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < n; i++)
+     3ba:	83 c4 10             	add    $0x10,%esp
+     3bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+     3c2:	81 fb ff 07 00 00    	cmp    $0x7ff,%ebx
+     3c8:	77 37                	ja     401 <filerand+0x67>
+    if(pwrite(fd, buf, BLK, rnd() % n * BLK) != BLK)
+     3ca:	e8 8e fc ff ff       	call   5d <rnd>
+     3cf:	25 ff 07 00 00       	and    $0x7ff,%eax
+     3d4:	c1 e0 09             	shl    $0x9,%eax
+     3d7:	50                   	push   %eax
+     3d8:	68 00 02 00 00       	push   $0x200
+     3dd:	68 80 28 00 00       	push   $0x2880
+     3e2:	56                   	push   %esi
+     3e3:	e8 c2 10 00 00       	call   14aa <pwrite>
+     3e8:	83 c4 10             	add    $0x10,%esp
+     3eb:	3d 00 02 00 00       	cmp    $0x200,%eax
+     3f0:	75 05                	jne    3f7 <filerand+0x5d>
+  for(i = 0; i < n; i++)
+     3f2:	83 c3 01             	add    $0x1,%ebx
+     3f5:	eb cb                	jmp    3c2 <filerand+0x28>
+      fail("pwrite");
+     3f7:	b8 08 1d 00 00       	mov    $0x1d08,%eax
+     3fc:	e8 74 fc ff ff       	call   75 <fail>
+  fsync(fd);
+     401:	83 ec 0c             	sub    $0xc,%esp
+     404:	56                   	push   %esi
+     405:	e8 82 10 00 00       	call   148c <fsync>
+  result("file_rand_write", rate(n*BLK, usec() - t), "KB/s");
+     40a:	e8 98 fc ff ff       	call   a7 <usec>
+     40f:	29 f8                	sub    %edi,%eax
+     411:	89 c2                	mov    %eax,%edx
+     413:	b8 00 00 10 00       	mov    $0x100000,%eax
+     418:	e8 0a fc ff ff       	call   27 <rate>
+     41d:	89 c2                	mov    %eax,%edx
+     41f:	b9 0f 1d 00 00       	mov    $0x1d0f,%ecx
+     424:	b8 14 1d 00 00       	mov    $0x1d14,%eax
+     429:	e8 5f fc ff ff       	call   8d <result>
+  t = usec();
+     42e:	e8 74 fc ff ff       	call   a7 <usec>
+     433:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < n; i++)
+     435:	83 c4 10             	add    $0x10,%esp
+     438:	bb 00 00 00 00       	mov    $0x0,%ebx
+     43d:	eb 03                	jmp    442 <filerand+0xa8>
+     43f:	83 c3 01             	add    $0x1,%ebx
+     442:	81 fb ff 07 00 00    	cmp    $0x7ff,%ebx
+     448:	77 32                	ja     47c <filerand+0xe2>
+    if(pread(fd, buf, BLK, rnd() % n * BLK) != BLK)
+     44a:	e8 0e fc ff ff       	call   5d <rnd>
+     44f:	25 ff 07 00 00       	and    $0x7ff,%eax
+     454:	c1 e0 09             	shl    $0x9,%eax
+     457:	50                   	push   %eax
+     458:	68 00 02 00 00       	push   $0x200
+     45d:	68 80 28 00 00       	push   $0x2880
+     462:	56                   	push   %esi
+     463:	e8 33 10 00 00       	call   149b <pread>
+     468:	83 c4 10             	add    $0x10,%esp
+     46b:	3d 00 02 00 00       	cmp    $0x200,%eax
+     470:	74 cd                	je     43f <filerand+0xa5>
+      fail("pread");
+     472:	b8 24 1d 00 00       	mov    $0x1d24,%eax
+     477:	e8 f9 fb ff ff       	call   75 <fail>
+  result("file_rand_read", rate(n*BLK, usec() - t), "KB/s");
+     47c:	e8 26 fc ff ff       	call   a7 <usec>
+     481:	29 f8                	sub    %edi,%eax
+     483:	89 c2                	mov    %eax,%edx
+     485:	b8 00 00 10 00       	mov    $0x100000,%eax
+     48a:	e8 98 fb ff ff       	call   27 <rate>
+     48f:	89 c2                	mov    %eax,%edx
+     491:	b9 0f 1d 00 00       	mov    $0x1d0f,%ecx
+     496:	b8 2a 1d 00 00       	mov    $0x1d2a,%eax
+     49b:	e8 ed fb ff ff       	call   8d <result>
+  close(fd);
+     4a0:	83 ec 0c             	sub    $0xc,%esp
+     4a3:	56                   	push   %esi
+     4a4:	e8 c3 0c 00 00       	call   116c <close>
+  unlink("benchf");
+     4a9:	c7 04 24 01 1d 00 00 	movl   $0x1d01,(%esp)
+     4b0:	e8 f7 0d 00 00       	call   12ac <unlink>
+}
+     4b5:	83 c4 10             	add    $0x10,%esp
+     4b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4bb:	5b                   	pop    %ebx
+     4bc:	5e                   	pop    %esi
+     4bd:	5f                   	pop    %edi
+     4be:	5d                   	pop    %ebp
+     4bf:	c3                   	ret
+
+000004c0 <fileseq>:
+{
+     4c0:	55                   	push   %ebp
+     4c1:	89 e5                	mov    %esp,%ebp
+     4c3:	57                   	push   %edi
+     4c4:	56                   	push   %esi
+     4c5:	53                   	push   %ebx
+     4c6:	83 ec 0c             	sub    $0xc,%esp
+  t = usec();
+     4c9:	e8 d9 fb ff ff       	call   a7 <usec>
+     4ce:	89 c3                	mov    %eax,%ebx
+  fd = benchfile();
+     4d0:	e8 56 fe ff ff       	call   32b <benchfile>
+     4d5:	89 c6                	mov    %eax,%esi
+  fsync(fd);
+     4d7:	83 ec 0c             	sub    $0xc,%esp
+     4da:	50                   	push   %eax
+     4db:	e8 ac 0f 00 00       	call   148c <fsync>
+  result("file_seq_write", rate(FILESZ, usec() - t), "KB/s");
+     4e0:	e8 c2 fb ff ff       	call   a7 <usec>
+     4e5:	29 d8                	sub    %ebx,%eax
+     4e7:	89 c2                	mov    %eax,%edx
+     4e9:	b8 00 00 10 00       	mov    $0x100000,%eax
+     4ee:	e8 34 fb ff ff       	call   27 <rate>
+     4f3:	89 c2                	mov    %eax,%edx
+     4f5:	b9 0f 1d 00 00       	mov    $0x1d0f,%ecx
+     4fa:	b8 39 1d 00 00       	mov    $0x1d39,%eax
+     4ff:	e8 89 fb ff ff       	call   8d <result>
+  t = usec();
+     504:	e8 9e fb ff ff       	call   a7 <usec>
+     509:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < FILESZ; i += sizeof(buf))
+     50b:	83 c4 10             	add    $0x10,%esp
+     50e:	bb 00 00 00 00       	mov    $0x0,%ebx
+     513:	81 fb ff ff 0f 00    	cmp    $0xfffff,%ebx
+     519:	7f 2d                	jg     548 <fileseq+0x88>
+    if(pread(fd, buf, sizeof(buf), i) != sizeof(buf))
+     51b:	53                   	push   %ebx
+     51c:	68 00 20 00 00       	push   $0x2000
+     521:	68 80 28 00 00       	push   $0x2880
+     526:	56                   	push   %esi
+     527:	e8 6f 0f 00 00       	call   149b <pread>
+     52c:	83 c4 10             	add    $0x10,%esp
+     52f:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     534:	75 08                	jne    53e <fileseq+0x7e>
+  for(i = 0; i < FILESZ; i += sizeof(buf))
+     536:	81 c3 00 20 00 00    	add    $0x2000,%ebx
+     53c:	eb d5                	jmp    513 <fileseq+0x53>
+      fail("pread");
+     53e:	b8 24 1d 00 00       	mov    $0x1d24,%eax
+     543:	e8 2d fb ff ff       	call   75 <fail>
+  result("file_seq_read", rate(FILESZ, usec() - t), "KB/s");
+     548:	e8 5a fb ff ff       	call   a7 <usec>
+     54d:	29 f8                	sub    %edi,%eax
+     54f:	89 c2                	mov    %eax,%edx
+     551:	b8 00 00 10 00       	mov    $0x100000,%eax
+     556:	e8 cc fa ff ff       	call   27 <rate>
+     55b:	89 c2                	mov    %eax,%edx
+     55d:	b9 0f 1d 00 00       	mov    $0x1d0f,%ecx
+     562:	b8 48 1d 00 00       	mov    $0x1d48,%eax
+     567:	e8 21 fb ff ff       	call   8d <result>
+  close(fd);
+     56c:	83 ec 0c             	sub    $0xc,%esp
+     56f:	56                   	push   %esi
+     570:	e8 f7 0b 00 00       	call   116c <close>
+  unlink("benchf");
+     575:	c7 04 24 01 1d 00 00 	movl   $0x1d01,(%esp)
+     57c:	e8 2b 0d 00 00       	call   12ac <unlink>
+}
+     581:	83 c4 10             	add    $0x10,%esp
+     584:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     587:	5b                   	pop    %ebx
+     588:	5e                   	pop    %esi
+     589:	5f                   	pop    %edi
+     58a:	5d                   	pop    %ebp
+     58b:	c3                   	ret
+
+0000058c <breadhit>:
+{
+     58c:	55                   	push   %ebp
+     58d:	89 e5                	mov    %esp,%ebp
+     58f:	57                   	push   %edi
+     590:	56                   	push   %esi
+     591:	53                   	push   %ebx
+     592:	83 ec 0c             	sub    $0xc,%esp
+  fd = benchfile();
+     595:	e8 91 fd ff ff       	call   32b <benchfile>
+     59a:	89 c6                	mov    %eax,%esi
+  pread(fd, buf, BLK, 0);
+     59c:	6a 00                	push   $0x0
+     59e:	68 00 02 00 00       	push   $0x200
+     5a3:	68 80 28 00 00       	push   $0x2880
+     5a8:	50                   	push   %eax
+     5a9:	e8 ed 0e 00 00       	call   149b <pread>
+  t = usec();
+     5ae:	e8 f4 fa ff ff       	call   a7 <usec>
+     5b3:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < n; i++)
+     5b5:	83 c4 10             	add    $0x10,%esp
+     5b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+     5bd:	81 fb 87 13 00 00    	cmp    $0x1387,%ebx
+     5c3:	77 2b                	ja     5f0 <breadhit+0x64>
+    if(pread(fd, buf, BLK, 0) != BLK)
+     5c5:	6a 00                	push   $0x0
+     5c7:	68 00 02 00 00       	push   $0x200
+     5cc:	68 80 28 00 00       	push   $0x2880
+     5d1:	56                   	push   %esi
+     5d2:	e8 c4 0e 00 00       	call   149b <pread>
+     5d7:	83 c4 10             	add    $0x10,%esp
+     5da:	3d 00 02 00 00       	cmp    $0x200,%eax
+     5df:	75 05                	jne    5e6 <breadhit+0x5a>
+  for(i = 0; i < n; i++)
+     5e1:	83 c3 01             	add    $0x1,%ebx
+     5e4:	eb d7                	jmp    5bd <breadhit+0x31>
+      fail("pread");
+     5e6:	b8 24 1d 00 00       	mov    $0x1d24,%eax
+     5eb:	e8 85 fa ff ff       	call   75 <fail>
+  result("bread_hit", perop(usec() - t, n), "ns");
+     5f0:	e8 b2 fa ff ff       	call   a7 <usec>
+     5f5:	29 f8                	sub    %edi,%eax
+     5f7:	ba 88 13 00 00       	mov    $0x1388,%edx
+     5fc:	e8 ff f9 ff ff       	call   0 <perop>
+     601:	89 c2                	mov    %eax,%edx
+     603:	b9 d1 1c 00 00       	mov    $0x1cd1,%ecx
+     608:	b8 56 1d 00 00       	mov    $0x1d56,%eax
+     60d:	e8 7b fa ff ff       	call   8d <result>
+  close(fd);
+     612:	83 ec 0c             	sub    $0xc,%esp
+     615:	56                   	push   %esi
+     616:	e8 51 0b 00 00       	call   116c <close>
+  unlink("benchf");
+     61b:	c7 04 24 01 1d 00 00 	movl   $0x1d01,(%esp)
+     622:	e8 85 0c 00 00       	call   12ac <unlink>
+}
+     627:	83 c4 10             	add    $0x10,%esp
+     62a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     62d:	5b                   	pop    %ebx
+     62e:	5e                   	pop    %esi
+     62f:	5f                   	pop    %edi
+     630:	5d                   	pop    %ebp
+     631:	c3                   	ret
+
+00000632 <pingpong>:
+{
+     632:	55                   	push   %ebp
+     633:	89 e5                	mov    %esp,%ebp
+     635:	56                   	push   %esi
+     636:	53                   	push   %ebx
+     637:	83 ec 2c             	sub    $0x2c,%esp
+  if(pipe(p) < 0 || pipe(q) < 0)
+     63a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     63d:	50                   	push   %eax
+     63e:	e8 0f 0c 00 00       	call   1252 <pipe>
+     643:	83 c4 10             	add    $0x10,%esp
+     646:	85 c0                	test   %eax,%eax
+     648:	78 60                	js     6aa <pingpong+0x78>
+     64a:	83 ec 0c             	sub    $0xc,%esp
+     64d:	8d 45 e8             	lea    -0x18(%ebp),%eax
+     650:	50                   	push   %eax
+     651:	e8 fc 0b 00 00       	call   1252 <pipe>
+     656:	83 c4 10             	add    $0x10,%esp
+     659:	85 c0                	test   %eax,%eax
+     65b:	78 4d                	js     6aa <pingpong+0x78>
+  if(fork() == 0){
+     65d:	e8 c7 0a 00 00       	call   1129 <fork>
+     662:	85 c0                	test   %eax,%eax
+     664:	75 5d                	jne    6c3 <pingpong+0x91>
+    for(i = 0; i < n; i++)
+     666:	bb 00 00 00 00       	mov    $0x0,%ebx
+     66b:	81 fb cf 07 00 00    	cmp    $0x7cf,%ebx
+     671:	77 4b                	ja     6be <pingpong+0x8c>
+      if(read(p[0], &c, 1) != 1 || write(q[1], &c, 1) != 1)
+     673:	83 ec 04             	sub    $0x4,%esp
+     676:	6a 01                	push   $0x1
+     678:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     67b:	50                   	push   %eax
+     67c:	ff 75 f0             	push   -0x10(%ebp)
+     67f:	e8 dd 0b 00 00       	call   1261 <read>
+     684:	83 c4 10             	add    $0x10,%esp
+     687:	83 f8 01             	cmp    $0x1,%eax
+     68a:	75 28                	jne    6b4 <pingpong+0x82>
+     68c:	83 ec 04             	sub    $0x4,%esp
+     68f:	6a 01                	push   $0x1
+     691:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     694:	50                   	push   %eax
+     695:	ff 75 ec             	push   -0x14(%ebp)
+     698:	e8 d3 0b 00 00       	call   1270 <write>
+     69d:	83 c4 10             	add    $0x10,%esp
+     6a0:	83 f8 01             	cmp    $0x1,%eax
+     6a3:	75 0f                	jne    6b4 <pingpong+0x82>
+    for(i = 0; i < n; i++)
+     6a5:	83 c3 01             	add    $0x1,%ebx
+     6a8:	eb c1                	jmp    66b <pingpong+0x39>
+    fail("pipe");
+     6aa:	b8 60 1d 00 00       	mov    $0x1d60,%eax
+     6af:	e8 c1 f9 ff ff       	call   75 <fail>
+        fail("pong");
+     6b4:	b8 75 1d 00 00       	mov    $0x1d75,%eax
+     6b9:	e8 b7 f9 ff ff       	call   75 <fail>
+    exit();
+     6be:	e8 7a 0a 00 00       	call   113d <exit>
+  t = usec();
+     6c3:	e8 df f9 ff ff       	call   a7 <usec>
+     6c8:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < n; i++)
+     6ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+     6cf:	81 fb cf 07 00 00    	cmp    $0x7cf,%ebx
+     6d5:	77 42                	ja     719 <pingpong+0xe7>
+    if(write(p[1], "x", 1) != 1 || read(q[0], &c, 1) != 1)
+     6d7:	83 ec 04             	sub    $0x4,%esp
+     6da:	6a 01                	push   $0x1
+     6dc:	68 65 1d 00 00       	push   $0x1d65
+     6e1:	ff 75 f4             	push   -0xc(%ebp)
+     6e4:	e8 87 0b 00 00       	call   1270 <write>
+     6e9:	83 c4 10             	add    $0x10,%esp
+     6ec:	83 f8 01             	cmp    $0x1,%eax
+     6ef:	75 1e                	jne    70f <pingpong+0xdd>
+     6f1:	83 ec 04             	sub    $0x4,%esp
+     6f4:	6a 01                	push   $0x1
+     6f6:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     6f9:	50                   	push   %eax
+     6fa:	ff 75 e8             	push   -0x18(%ebp)
+     6fd:	e8 5f 0b 00 00       	call   1261 <read>
+     702:	83 c4 10             	add    $0x10,%esp
+     705:	83 f8 01             	cmp    $0x1,%eax
+     708:	75 05                	jne    70f <pingpong+0xdd>
+  for(i = 0; i < n; i++)
+     70a:	83 c3 01             	add    $0x1,%ebx
+     70d:	eb c0                	jmp    6cf <pingpong+0x9d>
+      fail("ping");
+     70f:	b8 67 1d 00 00       	mov    $0x1d67,%eax
+     714:	e8 5c f9 ff ff       	call   75 <fail>
+  t = usec() - t;
+     719:	e8 89 f9 ff ff       	call   a7 <usec>
+     71e:	29 f0                	sub    %esi,%eax
+     720:	89 c3                	mov    %eax,%ebx
+  wait();
+     722:	e8 1c 0b 00 00       	call   1243 <wait>
+  close(p[0]);
+     727:	83 ec 0c             	sub    $0xc,%esp
+     72a:	ff 75 f0             	push   -0x10(%ebp)
+     72d:	e8 3a 0a 00 00       	call   116c <close>
+  close(p[1]);
+     732:	83 c4 04             	add    $0x4,%esp
+     735:	ff 75 f4             	push   -0xc(%ebp)
+     738:	e8 2f 0a 00 00       	call   116c <close>
+  close(q[0]);
+     73d:	83 c4 04             	add    $0x4,%esp
+     740:	ff 75 e8             	push   -0x18(%ebp)
+     743:	e8 24 0a 00 00       	call   116c <close>
+  close(q[1]);
+     748:	83 c4 04             	add    $0x4,%esp
+     74b:	ff 75 ec             	push   -0x14(%ebp)
+     74e:	e8 19 0a 00 00       	call   116c <close>
+  result("pipe_pingpong", perop(t, n), "ns");
+     753:	ba d0 07 00 00       	mov    $0x7d0,%edx
+     758:	89 d8                	mov    %ebx,%eax
+     75a:	e8 a1 f8 ff ff       	call   0 <perop>
+     75f:	89 c2                	mov    %eax,%edx
+     761:	b9 d1 1c 00 00       	mov    $0x1cd1,%ecx
+     766:	b8 6c 1d 00 00       	mov    $0x1d6c,%eax
+     76b:	e8 1d f9 ff ff       	call   8d <result>
+}
+     770:	83 c4 10             	add    $0x10,%esp
+     773:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     776:	5b                   	pop    %ebx
+     777:	5e                   	pop    %esi
+     778:	5d                   	pop    %ebp
+     779:	c3                   	ret
+
+0000077a <pipebw>:
+{
+     77a:	55                   	push   %ebp
+     77b:	89 e5                	mov    %esp,%ebp
+     77d:	57                   	push   %edi
+     77e:	56                   	push   %esi
+     77f:	53                   	push   %ebx
+     780:	83 ec 28             	sub    $0x28,%esp
+  if(pipe(fds) < 0)
+     783:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     786:	50                   	push   %eax
+     787:	e8 c6 0a 00 00       	call   1252 <pipe>
+     78c:	83 c4 10             	add    $0x10,%esp
+     78f:	85 c0                	test   %eax,%eax
+     791:	78 52                	js     7e5 <pipebw+0x6b>
+  t = usec();
+     793:	e8 0f f9 ff ff       	call   a7 <usec>
+     798:	89 c6                	mov    %eax,%esi
+  if(fork() == 0){
+     79a:	e8 8a 09 00 00       	call   1129 <fork>
+     79f:	85 c0                	test   %eax,%eax
+     7a1:	75 5b                	jne    7fe <pipebw+0x84>
+    close(fds[0]);
+     7a3:	83 ec 0c             	sub    $0xc,%esp
+     7a6:	ff 75 e0             	push   -0x20(%ebp)
+     7a9:	e8 be 09 00 00       	call   116c <close>
+    for(tot = 0; tot < n; tot += sizeof(buf))
+     7ae:	83 c4 10             	add    $0x10,%esp
+     7b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+     7b6:	81 fb ff ff 3f 00    	cmp    $0x3fffff,%ebx
+     7bc:	77 3b                	ja     7f9 <pipebw+0x7f>
+      if(write(fds[1], buf, sizeof(buf)) != sizeof(buf))
+     7be:	83 ec 04             	sub    $0x4,%esp
+     7c1:	68 00 20 00 00       	push   $0x2000
+     7c6:	68 80 28 00 00       	push   $0x2880
+     7cb:	ff 75 e4             	push   -0x1c(%ebp)
+     7ce:	e8 9d 0a 00 00       	call   1270 <write>
+     7d3:	83 c4 10             	add    $0x10,%esp
+     7d6:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     7db:	75 12                	jne    7ef <pipebw+0x75>
+    for(tot = 0; tot < n; tot += sizeof(buf))
+     7dd:	81 c3 00 20 00 00    	add    $0x2000,%ebx
+     7e3:	eb d1                	jmp    7b6 <pipebw+0x3c>
+    fail("pipe");
+     7e5:	b8 60 1d 00 00       	mov    $0x1d60,%eax
+     7ea:	e8 86 f8 ff ff       	call   75 <fail>
+        fail("pipe write");
+     7ef:	b8 7a 1d 00 00       	mov    $0x1d7a,%eax
+     7f4:	e8 7c f8 ff ff       	call   75 <fail>
+    exit();
+     7f9:	e8 3f 09 00 00       	call   113d <exit>
+  close(fds[1]);
+     7fe:	83 ec 0c             	sub    $0xc,%esp
+     801:	ff 75 e4             	push   -0x1c(%ebp)
+     804:	e8 63 09 00 00       	call   116c <close>
+  for(tot = 0; (m = read(fds[0], buf, sizeof(buf))) > 0; tot += m)
+     809:	83 c4 10             	add    $0x10,%esp
+     80c:	bb 00 00 00 00       	mov    $0x0,%ebx
+     811:	eb 02                	jmp    815 <pipebw+0x9b>
+     813:	01 c3                	add    %eax,%ebx
+     815:	83 ec 04             	sub    $0x4,%esp
+     818:	68 00 20 00 00       	push   $0x2000
+     81d:	68 80 28 00 00       	push   $0x2880
+     822:	ff 75 e0             	push   -0x20(%ebp)
+     825:	e8 37 0a 00 00       	call   1261 <read>
+     82a:	83 c4 10             	add    $0x10,%esp
+     82d:	85 c0                	test   %eax,%eax
+     82f:	7f e2                	jg     813 <pipebw+0x99>
+  wait();
+     831:	e8 0d 0a 00 00       	call   1243 <wait>
+  t = usec() - t;
+     836:	e8 6c f8 ff ff       	call   a7 <usec>
+     83b:	29 f0                	sub    %esi,%eax
+     83d:	89 c7                	mov    %eax,%edi
+  close(fds[0]);
+     83f:	83 ec 0c             	sub    $0xc,%esp
+     842:	ff 75 e0             	push   -0x20(%ebp)
+     845:	e8 22 09 00 00       	call   116c <close>
+  if(tot != n)
+     84a:	83 c4 10             	add    $0x10,%esp
+     84d:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+     853:	75 25                	jne    87a <pipebw+0x100>
+  result("pipe_bw", rate(n, t), "KB/s");
+     855:	89 fa                	mov    %edi,%edx
+     857:	b8 00 00 40 00       	mov    $0x400000,%eax
+     85c:	e8 c6 f7 ff ff       	call   27 <rate>
+     861:	89 c2                	mov    %eax,%edx
+     863:	b9 0f 1d 00 00       	mov    $0x1d0f,%ecx
+     868:	b8 8f 1d 00 00       	mov    $0x1d8f,%eax
+     86d:	e8 1b f8 ff ff       	call   8d <result>
+}
+     872:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     875:	5b                   	pop    %ebx
+     876:	5e                   	pop    %esi
+     877:	5f                   	pop    %edi
+     878:	5d                   	pop    %ebp
+     879:	c3                   	ret
+    fail("pipe read");
+     87a:	b8 85 1d 00 00       	mov    $0x1d85,%eax
+     87f:	e8 f1 f7 ff ff       	call   75 <fail>
+
+00000884 <forkwait>:
+{
+     884:	55                   	push   %ebp
+     885:	89 e5                	mov    %esp,%ebp
+     887:	56                   	push   %esi
+     888:	53                   	push   %ebx
+  t = usec();
+     889:	e8 19 f8 ff ff       	call   a7 <usec>
+     88e:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < n; i++){
+     890:	bb 00 00 00 00       	mov    $0x0,%ebx
+     895:	81 fb c7 00 00 00    	cmp    $0xc7,%ebx
+     89b:	77 24                	ja     8c1 <forkwait+0x3d>
+    if((pid = fork()) < 0)
+     89d:	e8 87 08 00 00       	call   1129 <fork>
+     8a2:	85 c0                	test   %eax,%eax
+     8a4:	78 0c                	js     8b2 <forkwait+0x2e>
+    if(pid == 0)
+     8a6:	74 14                	je     8bc <forkwait+0x38>
+    wait();
+     8a8:	e8 96 09 00 00       	call   1243 <wait>
+  for(i = 0; i < n; i++){
+     8ad:	83 c3 01             	add    $0x1,%ebx
+     8b0:	eb e3                	jmp    895 <forkwait+0x11>
+      fail("fork");
+     8b2:	b8 97 1d 00 00       	mov    $0x1d97,%eax
+     8b7:	e8 b9 f7 ff ff       	call   75 <fail>
+      exit();
+     8bc:	e8 7c 08 00 00       	call   113d <exit>
+  result("fork_exit_wait", perop(usec() - t, n) / 1000, "us");
+     8c1:	e8 e1 f7 ff ff       	call   a7 <usec>
+     8c6:	29 f0                	sub    %esi,%eax
+     8c8:	ba c8 00 00 00       	mov    $0xc8,%edx
+     8cd:	e8 2e f7 ff ff       	call   0 <perop>
+     8d2:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+     8d7:	f7 e2                	mul    %edx
+     8d9:	c1 ea 06             	shr    $0x6,%edx
+     8dc:	b9 f0 1c 00 00       	mov    $0x1cf0,%ecx
+     8e1:	b8 9c 1d 00 00       	mov    $0x1d9c,%eax
+     8e6:	e8 a2 f7 ff ff       	call   8d <result>
+}
+     8eb:	5b                   	pop    %ebx
+     8ec:	5e                   	pop    %esi
+     8ed:	5d                   	pop    %ebp
+     8ee:	c3                   	ret
+
+000008ef <sbrkfault>:
+{
+     8ef:	55                   	push   %ebp
+     8f0:	89 e5                	mov    %esp,%ebp
+     8f2:	56                   	push   %esi
+     8f3:	53                   	push   %ebx
+  if((a = sbrk(n*4096)) == (char*)-1)
+     8f4:	83 ec 0c             	sub    $0xc,%esp
+     8f7:	68 00 00 20 00       	push   $0x200000
+     8fc:	e8 14 0a 00 00       	call   1315 <sbrk>
+     901:	83 c4 10             	add    $0x10,%esp
+     904:	83 f8 ff             	cmp    $0xffffffff,%eax
+     907:	74 10                	je     919 <sbrkfault+0x2a>
+     909:	89 c3                	mov    %eax,%ebx
+  t = usec();
+     90b:	e8 97 f7 ff ff       	call   a7 <usec>
+     910:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < n; i++)
+     912:	b8 00 00 00 00       	mov    $0x0,%eax
+     917:	eb 16                	jmp    92f <sbrkfault+0x40>
+    fail("sbrk");
+     919:	b8 ab 1d 00 00       	mov    $0x1dab,%eax
+     91e:	e8 52 f7 ff ff       	call   75 <fail>
+    a[i*4096] = 1;
+     923:	89 c2                	mov    %eax,%edx
+     925:	c1 e2 0c             	shl    $0xc,%edx
+     928:	c6 04 13 01          	movb   $0x1,(%ebx,%edx,1)
+  for(i = 0; i < n; i++)
+     92c:	83 c0 01             	add    $0x1,%eax
+     92f:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+     934:	76 ed                	jbe    923 <sbrkfault+0x34>
+  result("sbrk_fault", perop(usec() - t, n), "ns/page");
+     936:	e8 6c f7 ff ff       	call   a7 <usec>
+     93b:	29 f0                	sub    %esi,%eax
+     93d:	ba 00 02 00 00       	mov    $0x200,%edx
+     942:	e8 b9 f6 ff ff       	call   0 <perop>
+     947:	89 c2                	mov    %eax,%edx
+     949:	b9 b0 1d 00 00       	mov    $0x1db0,%ecx
+     94e:	b8 b8 1d 00 00       	mov    $0x1db8,%eax
+     953:	e8 35 f7 ff ff       	call   8d <result>
+  sbrk(-n*4096);
+     958:	83 ec 0c             	sub    $0xc,%esp
+     95b:	68 00 00 e0 ff       	push   $0xffe00000
+     960:	e8 b0 09 00 00       	call   1315 <sbrk>
+}
+     965:	83 c4 10             	add    $0x10,%esp
+     968:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     96b:	5b                   	pop    %ebx
+     96c:	5e                   	pop    %esi
+     96d:	5d                   	pop    %ebp
+     96e:	c3                   	ret
+
+0000096f <forkexec>:
+{
+     96f:	55                   	push   %ebp
+     970:	89 e5                	mov    %esp,%ebp
+     972:	56                   	push   %esi
+     973:	53                   	push   %ebx
+     974:	83 ec 10             	sub    $0x10,%esp
+  char *argv[] = { self, "-exit", 0 };
+     977:	a1 60 28 00 00       	mov    0x2860,%eax
+     97c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     97f:	c7 45 f0 c3 1d 00 00 	movl   $0x1dc3,-0x10(%ebp)
+     986:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  t = usec();
+     98d:	e8 15 f7 ff ff       	call   a7 <usec>
+     992:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < n; i++){
+     994:	bb 00 00 00 00       	mov    $0x0,%ebx
+     999:	83 fb 31             	cmp    $0x31,%ebx
+     99c:	77 3b                	ja     9d9 <forkexec+0x6a>
+    if((pid = fork()) < 0)
+     99e:	e8 86 07 00 00       	call   1129 <fork>
+     9a3:	85 c0                	test   %eax,%eax
+     9a5:	78 0c                	js     9b3 <forkexec+0x44>
+    if(pid == 0){
+     9a7:	74 14                	je     9bd <forkexec+0x4e>
+    wait();
+     9a9:	e8 95 08 00 00       	call   1243 <wait>
+  for(i = 0; i < n; i++){
+     9ae:	83 c3 01             	add    $0x1,%ebx
+     9b1:	eb e6                	jmp    999 <forkexec+0x2a>
+      fail("fork");
+     9b3:	b8 97 1d 00 00       	mov    $0x1d97,%eax
+     9b8:	e8 b8 f6 ff ff       	call   75 <fail>
+      exec(self, argv);
+     9bd:	83 ec 08             	sub    $0x8,%esp
+     9c0:	8d 45 ec             	lea    -0x14(%ebp),%eax
+     9c3:	50                   	push   %eax
+     9c4:	ff 35 60 28 00 00    	push   0x2860
+     9ca:	e8 80 07 00 00       	call   114f <exec>
+      fail("exec");
+     9cf:	b8 ce 1d 00 00       	mov    $0x1dce,%eax
+     9d4:	e8 9c f6 ff ff       	call   75 <fail>
+  result("fork_exec", perop(usec() - t, n) / 1000, "us");
+     9d9:	e8 c9 f6 ff ff       	call   a7 <usec>
+     9de:	29 f0                	sub    %esi,%eax
+     9e0:	ba 32 00 00 00       	mov    $0x32,%edx
+     9e5:	e8 16 f6 ff ff       	call   0 <perop>
+     9ea:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+     9ef:	f7 e2                	mul    %edx
+     9f1:	c1 ea 06             	shr    $0x6,%edx
+     9f4:	b9 f0 1c 00 00       	mov    $0x1cf0,%ecx
+     9f9:	b8 c9 1d 00 00       	mov    $0x1dc9,%eax
+     9fe:	e8 8a f6 ff ff       	call   8d <result>
+}
+     a03:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     a06:	5b                   	pop    %ebx
+     a07:	5e                   	pop    %esi
+     a08:	5d                   	pop    %ebp
+     a09:	c3                   	ret
+
+00000a0a <nullsys>:
+{
+     a0a:	55                   	push   %ebp
+     a0b:	89 e5                	mov    %esp,%ebp
+     a0d:	56                   	push   %esi
+     a0e:	53                   	push   %ebx
+  t = usec();
+     a0f:	e8 93 f6 ff ff       	call   a7 <usec>
+     a14:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < n; i++)
+     a16:	bb 00 00 00 00       	mov    $0x0,%ebx
+     a1b:	eb 08                	jmp    a25 <nullsys+0x1b>
+    getpid();
+     a1d:	e8 e4 08 00 00       	call   1306 <getpid>
+  for(i = 0; i < n; i++)
+     a22:	83 c3 01             	add    $0x1,%ebx
+     a25:	81 fb 1f 4e 00 00    	cmp    $0x4e1f,%ebx
+     a2b:	76 f0                	jbe    a1d <nullsys+0x13>
+  result("null_syscall", perop(usec() - t, n), "ns");
+     a2d:	e8 75 f6 ff ff       	call   a7 <usec>
+     a32:	29 f0                	sub    %esi,%eax
+     a34:	ba 20 4e 00 00       	mov    $0x4e20,%edx
+     a39:	e8 c2 f5 ff ff       	call   0 <perop>
+     a3e:	89 c2                	mov    %eax,%edx
+     a40:	b9 d1 1c 00 00       	mov    $0x1cd1,%ecx
+     a45:	b8 d3 1d 00 00       	mov    $0x1dd3,%eax
+     a4a:	e8 3e f6 ff ff       	call   8d <result>
+}
+     a4f:	5b                   	pop    %ebx
+     a50:	5e                   	pop    %esi
+     a51:	5d                   	pop    %ebp
+     a52:	c3                   	ret
+
+00000a53 <main>:
+  { "lookup",   lookup },
+};
+
+int
+main(int argc, char *argv[])
+{
+     a53:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     a57:	83 e4 f0             	and    $0xfffffff0,%esp
+     a5a:	ff 71 fc             	push   -0x4(%ecx)
+     a5d:	55                   	push   %ebp
+     a5e:	89 e5                	mov    %esp,%ebp
+     a60:	57                   	push   %edi
+     a61:	56                   	push   %esi
+     a62:	53                   	push   %ebx
+     a63:	51                   	push   %ecx
+     a64:	83 ec 18             	sub    $0x18,%esp
+     a67:	8b 39                	mov    (%ecx),%edi
+     a69:	8b 41 04             	mov    0x4(%ecx),%eax
+     a6c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  int i, j;
+
+  if(argc > 1 && strcmp(argv[1], "-exit") == 0)
+     a6f:	83 ff 01             	cmp    $0x1,%edi
+     a72:	7e 17                	jle    a8b <main+0x38>
+     a74:	83 ec 08             	sub    $0x8,%esp
+     a77:	68 c3 1d 00 00       	push   $0x1dc3
+     a7c:	ff 70 04             	push   0x4(%eax)
+     a7f:	e8 a7 00 00 00       	call   b2b <strcmp>
+     a84:	83 c4 10             	add    $0x10,%esp
+     a87:	85 c0                	test   %eax,%eax
+     a89:	74 28                	je     ab3 <main+0x60>
+    exit();
+  self = argv[0];
+     a8b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     a8e:	8b 00                	mov    (%eax),%eax
+     a90:	a3 60 28 00 00       	mov    %eax,0x2860
+  memset(buf, 'b', sizeof(buf));
+     a95:	83 ec 04             	sub    $0x4,%esp
+     a98:	68 00 20 00 00       	push   $0x2000
+     a9d:	6a 62                	push   $0x62
+     a9f:	68 80 28 00 00       	push   $0x2880
+     aa4:	e8 ed 00 00 00       	call   b96 <memset>
+  for(i = 0; i < sizeof(benches)/sizeof(benches[0]); i++){
+     aa9:	83 c4 10             	add    $0x10,%esp
+     aac:	be 00 00 00 00       	mov    $0x0,%esi
+     ab1:	eb 1e                	jmp    ad1 <main+0x7e>
+    exit();
+     ab3:	e8 85 06 00 00       	call   113d <exit>
+    for(j = 1; j < argc && strcmp(argv[j], benches[i].name) != 0; j++)
+      ;
+    if(argc == 1 || j < argc)
+     ab8:	83 ff 01             	cmp    $0x1,%edi
+     abb:	0f 94 c0             	sete   %al
+     abe:	39 fb                	cmp    %edi,%ebx
+     ac0:	0f 9c c2             	setl   %dl
+     ac3:	08 d0                	or     %dl,%al
+     ac5:	74 07                	je     ace <main+0x7b>
+      benches[i].fn();
+     ac7:	ff 14 f5 04 1e 00 00 	call   *0x1e04(,%esi,8)
+  for(i = 0; i < sizeof(benches)/sizeof(benches[0]); i++){
+     ace:	83 c6 01             	add    $0x1,%esi
+     ad1:	83 fe 0a             	cmp    $0xa,%esi
+     ad4:	77 2a                	ja     b00 <main+0xad>
+    for(j = 1; j < argc && strcmp(argv[j], benches[i].name) != 0; j++)
+     ad6:	bb 01 00 00 00       	mov    $0x1,%ebx
+     adb:	39 fb                	cmp    %edi,%ebx
+     add:	7d d9                	jge    ab8 <main+0x65>
+     adf:	83 ec 08             	sub    $0x8,%esp
+     ae2:	ff 34 f5 00 1e 00 00 	push   0x1e00(,%esi,8)
+     ae9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     aec:	ff 34 98             	push   (%eax,%ebx,4)
+     aef:	e8 37 00 00 00       	call   b2b <strcmp>
+     af4:	83 c4 10             	add    $0x10,%esp
+     af7:	85 c0                	test   %eax,%eax
+     af9:	74 bd                	je     ab8 <main+0x65>
+     afb:	83 c3 01             	add    $0x1,%ebx
+     afe:	eb db                	jmp    adb <main+0x88>
+  }
+  exit();
+     b00:	e8 38 06 00 00       	call   113d <exit>
+
+00000b05 <strcpy>:
+#include "memlayout.h"
+#include "clock.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     b05:	55                   	push   %ebp
+     b06:	89 e5                	mov    %esp,%ebp
+     b08:	56                   	push   %esi
+     b09:	53                   	push   %ebx
+     b0a:	8b 75 08             	mov    0x8(%ebp),%esi
+     b0d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     b10:	89 f0                	mov    %esi,%eax
+     b12:	89 d1                	mov    %edx,%ecx
+     b14:	83 c2 01             	add    $0x1,%edx
+     b17:	89 c3                	mov    %eax,%ebx
+     b19:	83 c0 01             	add    $0x1,%eax
+     b1c:	0f b6 09             	movzbl (%ecx),%ecx
+     b1f:	88 0b                	mov    %cl,(%ebx)
+     b21:	84 c9                	test   %cl,%cl
+     b23:	75 ed                	jne    b12 <strcpy+0xd>
+    ;
+  return os;
+}
+     b25:	89 f0                	mov    %esi,%eax
+     b27:	5b                   	pop    %ebx
+     b28:	5e                   	pop    %esi
+     b29:	5d                   	pop    %ebp
+     b2a:	c3                   	ret
+
+00000b2b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     b2b:	55                   	push   %ebp
+     b2c:	89 e5                	mov    %esp,%ebp
+     b2e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     b31:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+     b34:	eb 06                	jmp    b3c <strcmp+0x11>
+    p++, q++;
+     b36:	83 c1 01             	add    $0x1,%ecx
+     b39:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+     b3c:	0f b6 01             	movzbl (%ecx),%eax
+     b3f:	84 c0                	test   %al,%al
+     b41:	74 04                	je     b47 <strcmp+0x1c>
+     b43:	3a 02                	cmp    (%edx),%al
+     b45:	74 ef                	je     b36 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+     b47:	0f b6 c0             	movzbl %al,%eax
+     b4a:	0f b6 12             	movzbl (%edx),%edx
+     b4d:	29 d0                	sub    %edx,%eax
+}
+     b4f:	5d                   	pop    %ebp
+     b50:	c3                   	ret
+
+00000b51 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     b51:	55                   	push   %ebp
+     b52:	89 e5                	mov    %esp,%ebp
+     b54:	53                   	push   %ebx
+     b55:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  const char *p;
+  uint w;
+
+  for(p = s; (uint)p & 3; p++)
+     b58:	89 c8                	mov    %ecx,%eax
+     b5a:	eb 03                	jmp    b5f <strlen+0xe>
+     b5c:	83 c0 01             	add    $0x1,%eax
+     b5f:	a8 03                	test   $0x3,%al
+     b61:	74 09                	je     b6c <strlen+0x1b>
+    if(*p == 0)
+     b63:	80 38 00             	cmpb   $0x0,(%eax)
+     b66:	75 f4                	jne    b5c <strlen+0xb>
+      return p - s;
+     b68:	29 c8                	sub    %ecx,%eax
+     b6a:	eb 25                	jmp    b91 <strlen+0x40>
+  // Then a word at a time, which never crosses into the next page:
+  // a word with a zero byte in it has one of these bits set.
+  for(;; p += 4){
+    w = *(uint*)p;
+     b6c:	8b 10                	mov    (%eax),%edx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     b6e:	8d 9a ff fe fe fe    	lea    -0x1010101(%edx),%ebx
+     b74:	f7 d2                	not    %edx
+     b76:	21 da                	and    %ebx,%edx
+     b78:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+     b7e:	75 05                	jne    b85 <strlen+0x34>
+  for(;; p += 4){
+     b80:	83 c0 04             	add    $0x4,%eax
+    w = *(uint*)p;
+     b83:	eb e7                	jmp    b6c <strlen+0x1b>
+      break;
+  }
+  while(*p)
+     b85:	80 38 00             	cmpb   $0x0,(%eax)
+     b88:	74 05                	je     b8f <strlen+0x3e>
+    p++;
+     b8a:	83 c0 01             	add    $0x1,%eax
+     b8d:	eb f6                	jmp    b85 <strlen+0x34>
+  return p - s;
+     b8f:	29 c8                	sub    %ecx,%eax
+}
+     b91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b94:	c9                   	leave
+     b95:	c3                   	ret
+
+00000b96 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     b96:	55                   	push   %ebp
+     b97:	89 e5                	mov    %esp,%ebp
+     b99:	57                   	push   %edi
+     b9a:	56                   	push   %esi
+     b9b:	53                   	push   %ebx
+     b9c:	8b 55 10             	mov    0x10(%ebp),%edx
+  uint h;
+  char *d;
+
+  d = dst;
+  c &= 0xFF;
+     b9f:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  if(n >= 16){
+     ba3:	83 fa 0f             	cmp    $0xf,%edx
+     ba6:	76 52                	jbe    bfa <memset+0x64>
+    h = -(uint)d & 3;
+     ba8:	8b 45 08             	mov    0x8(%ebp),%eax
+     bab:	f7 d8                	neg    %eax
+     bad:	83 e0 03             	and    $0x3,%eax
+     bb0:	89 c6                	mov    %eax,%esi
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     bb2:	8b 7d 08             	mov    0x8(%ebp),%edi
+     bb5:	89 c1                	mov    %eax,%ecx
+     bb7:	89 d8                	mov    %ebx,%eax
+     bb9:	fc                   	cld
+     bba:	f3 aa                	rep stos %al,%es:(%edi)
+    stosb(d, c, h);
+    stosl(d + h, (c<<24)|(c<<16)|(c<<8)|c, (n - h)/4);
+     bbc:	29 f2                	sub    %esi,%edx
+     bbe:	89 d1                	mov    %edx,%ecx
+     bc0:	c1 e9 02             	shr    $0x2,%ecx
+     bc3:	c1 e0 18             	shl    $0x18,%eax
+     bc6:	89 df                	mov    %ebx,%edi
+     bc8:	c1 e7 10             	shl    $0x10,%edi
+     bcb:	09 f8                	or     %edi,%eax
+     bcd:	89 df                	mov    %ebx,%edi
+     bcf:	c1 e7 08             	shl    $0x8,%edi
+     bd2:	09 f8                	or     %edi,%eax
+     bd4:	09 d8                	or     %ebx,%eax
+     bd6:	89 f7                	mov    %esi,%edi
+     bd8:	03 7d 08             	add    0x8(%ebp),%edi
+}
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosl" :
+     bdb:	fc                   	cld
+     bdc:	f3 ab                	rep stos %eax,%es:(%edi)
+    d += h + (n - h)/4*4;
+     bde:	89 d7                	mov    %edx,%edi
+     be0:	83 e7 fc             	and    $0xfffffffc,%edi
+     be3:	09 f7                	or     %esi,%edi
+     be5:	03 7d 08             	add    0x8(%ebp),%edi
+    n = (n - h)%4;
+     be8:	83 e2 03             	and    $0x3,%edx
+  asm volatile("cld; rep stosb" :
+     beb:	89 d1                	mov    %edx,%ecx
+     bed:	89 d8                	mov    %ebx,%eax
+     bef:	fc                   	cld
+     bf0:	f3 aa                	rep stos %al,%es:(%edi)
+  }
+  stosb(d, c, n);
+  return dst;
+}
+     bf2:	8b 45 08             	mov    0x8(%ebp),%eax
+     bf5:	5b                   	pop    %ebx
+     bf6:	5e                   	pop    %esi
+     bf7:	5f                   	pop    %edi
+     bf8:	5d                   	pop    %ebp
+     bf9:	c3                   	ret
+  d = dst;
+     bfa:	8b 7d 08             	mov    0x8(%ebp),%edi
+     bfd:	eb ec                	jmp    beb <memset+0x55>
+
+00000bff <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     bff:	55                   	push   %ebp
+     c00:	89 e5                	mov    %esp,%ebp
+     c02:	8b 45 08             	mov    0x8(%ebp),%eax
+     c05:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     c09:	eb 03                	jmp    c0e <strchr+0xf>
+     c0b:	83 c0 01             	add    $0x1,%eax
+     c0e:	0f b6 10             	movzbl (%eax),%edx
+     c11:	84 d2                	test   %dl,%dl
+     c13:	74 06                	je     c1b <strchr+0x1c>
+    if(*s == c)
+     c15:	38 ca                	cmp    %cl,%dl
+     c17:	75 f2                	jne    c0b <strchr+0xc>
+     c19:	eb 05                	jmp    c20 <strchr+0x21>
+      return (char*)s;
+  return 0;
+     c1b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     c20:	5d                   	pop    %ebp
+     c21:	c3                   	ret
+
+00000c22 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     c22:	55                   	push   %ebp
+     c23:	89 e5                	mov    %esp,%ebp
+     c25:	56                   	push   %esi
+     c26:	53                   	push   %ebx
+     c27:	8b 55 08             	mov    0x8(%ebp),%edx
+     c2a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     c2d:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  // A word at a time while they agree.
+  if((((uint)s1 | (uint)s2) & 3) == 0)
+     c30:	89 d3                	mov    %edx,%ebx
+     c32:	09 cb                	or     %ecx,%ebx
+     c34:	f6 c3 03             	test   $0x3,%bl
+     c37:	74 24                	je     c5d <memcmp+0x3b>
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+      s1 += 4, s2 += 4;
+  while(n-- > 0){
+     c39:	8d 70 ff             	lea    -0x1(%eax),%esi
+     c3c:	85 c0                	test   %eax,%eax
+     c3e:	74 32                	je     c72 <memcmp+0x50>
+    if(*s1 != *s2)
+     c40:	0f b6 02             	movzbl (%edx),%eax
+     c43:	0f b6 19             	movzbl (%ecx),%ebx
+     c46:	38 d8                	cmp    %bl,%al
+     c48:	75 20                	jne    c6a <memcmp+0x48>
+      return *s1 - *s2;
+    s1++, s2++;
+     c4a:	83 c2 01             	add    $0x1,%edx
+     c4d:	83 c1 01             	add    $0x1,%ecx
+  while(n-- > 0){
+     c50:	89 f0                	mov    %esi,%eax
+     c52:	eb e5                	jmp    c39 <memcmp+0x17>
+      s1 += 4, s2 += 4;
+     c54:	83 c2 04             	add    $0x4,%edx
+     c57:	83 c1 04             	add    $0x4,%ecx
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+     c5a:	83 e8 04             	sub    $0x4,%eax
+     c5d:	83 f8 03             	cmp    $0x3,%eax
+     c60:	76 d7                	jbe    c39 <memcmp+0x17>
+     c62:	8b 31                	mov    (%ecx),%esi
+     c64:	39 32                	cmp    %esi,(%edx)
+     c66:	74 ec                	je     c54 <memcmp+0x32>
+     c68:	eb cf                	jmp    c39 <memcmp+0x17>
+      return *s1 - *s2;
+     c6a:	0f b6 c0             	movzbl %al,%eax
+     c6d:	0f b6 db             	movzbl %bl,%ebx
+     c70:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     c72:	5b                   	pop    %ebx
+     c73:	5e                   	pop    %esi
+     c74:	5d                   	pop    %ebp
+     c75:	c3                   	ret
+
+00000c76 <memchr>:
+// The first c in the n bytes at v, or 0.  Once aligned, a word at
+// a time, with the word's bytes that equal c turned into zeroes
+// and those looked for.
+void*
+memchr(const void *v, int c, uint n)
+{
+     c76:	55                   	push   %ebp
+     c77:	89 e5                	mov    %esp,%ebp
+     c79:	57                   	push   %edi
+     c7a:	56                   	push   %esi
+     c7b:	53                   	push   %ebx
+     c7c:	8b 45 08             	mov    0x8(%ebp),%eax
+     c7f:	8b 55 10             	mov    0x10(%ebp),%edx
+  const uchar *s;
+  uint w, rep;
+
+  s = v;
+  c = (uchar)c;
+     c82:	0f b6 75 0c          	movzbl 0xc(%ebp),%esi
+  for(; n > 0 && ((uint)s & 3); n--, s++)
+     c86:	eb 06                	jmp    c8e <memchr+0x18>
+     c88:	83 ea 01             	sub    $0x1,%edx
+     c8b:	83 c0 01             	add    $0x1,%eax
+     c8e:	85 d2                	test   %edx,%edx
+     c90:	74 0d                	je     c9f <memchr+0x29>
+     c92:	a8 03                	test   $0x3,%al
+     c94:	74 09                	je     c9f <memchr+0x29>
+    if(*s == c)
+     c96:	0f b6 08             	movzbl (%eax),%ecx
+     c99:	39 f1                	cmp    %esi,%ecx
+     c9b:	75 eb                	jne    c88 <memchr+0x12>
+     c9d:	eb 41                	jmp    ce0 <memchr+0x6a>
+      return (void*)s;
+  rep = c * 0x01010101;
+     c9f:	69 fe 01 01 01 01    	imul   $0x1010101,%esi,%edi
+  for(; n >= 4; n -= 4, s += 4){
+     ca5:	eb 06                	jmp    cad <memchr+0x37>
+     ca7:	83 ea 04             	sub    $0x4,%edx
+     caa:	83 c0 04             	add    $0x4,%eax
+     cad:	83 fa 03             	cmp    $0x3,%edx
+     cb0:	76 16                	jbe    cc8 <memchr+0x52>
+    w = *(uint*)s ^ rep;
+     cb2:	89 f9                	mov    %edi,%ecx
+     cb4:	33 08                	xor    (%eax),%ecx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     cb6:	8d 99 ff fe fe fe    	lea    -0x1010101(%ecx),%ebx
+     cbc:	f7 d1                	not    %ecx
+     cbe:	21 cb                	and    %ecx,%ebx
+     cc0:	f7 c3 80 80 80 80    	test   $0x80808080,%ebx
+     cc6:	74 df                	je     ca7 <memchr+0x31>
+      break;
+  }
+  for(; n > 0; n--, s++)
+     cc8:	85 d2                	test   %edx,%edx
+     cca:	74 0f                	je     cdb <memchr+0x65>
+    if(*s == c)
+     ccc:	0f b6 08             	movzbl (%eax),%ecx
+     ccf:	39 f1                	cmp    %esi,%ecx
+     cd1:	74 0d                	je     ce0 <memchr+0x6a>
+  for(; n > 0; n--, s++)
+     cd3:	83 ea 01             	sub    $0x1,%edx
+     cd6:	83 c0 01             	add    $0x1,%eax
+     cd9:	eb ed                	jmp    cc8 <memchr+0x52>
+      return (void*)s;
+  return 0;
+     cdb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     ce0:	5b                   	pop    %ebx
+     ce1:	5e                   	pop    %esi
+     ce2:	5f                   	pop    %edi
+     ce3:	5d                   	pop    %ebp
+     ce4:	c3                   	ret
+
+00000ce5 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     ce5:	55                   	push   %ebp
+     ce6:	89 e5                	mov    %esp,%ebp
+     ce8:	57                   	push   %edi
+     ce9:	56                   	push   %esi
+     cea:	53                   	push   %ebx
+     ceb:	83 ec 1c             	sub    $0x1c,%esp
+     cee:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     cf1:	bb 00 00 00 00       	mov    $0x0,%ebx
+     cf6:	89 de                	mov    %ebx,%esi
+     cf8:	83 c3 01             	add    $0x1,%ebx
+     cfb:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     cfe:	7d 2e                	jge    d2e <gets+0x49>
+    cc = read(0, &c, 1);
+     d00:	83 ec 04             	sub    $0x4,%esp
+     d03:	6a 01                	push   $0x1
+     d05:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     d08:	50                   	push   %eax
+     d09:	6a 00                	push   $0x0
+     d0b:	e8 51 05 00 00       	call   1261 <read>
+    if(cc < 1)
+     d10:	83 c4 10             	add    $0x10,%esp
+     d13:	85 c0                	test   %eax,%eax
+     d15:	7e 17                	jle    d2e <gets+0x49>
+      break;
+    buf[i++] = c;
+     d17:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     d1b:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+     d1e:	3c 0a                	cmp    $0xa,%al
+     d20:	0f 94 c2             	sete   %dl
+     d23:	3c 0d                	cmp    $0xd,%al
+     d25:	0f 94 c0             	sete   %al
+     d28:	08 c2                	or     %al,%dl
+     d2a:	74 ca                	je     cf6 <gets+0x11>
+    buf[i++] = c;
+     d2c:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+     d2e:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+     d32:	89 f8                	mov    %edi,%eax
+     d34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d37:	5b                   	pop    %ebx
+     d38:	5e                   	pop    %esi
+     d39:	5f                   	pop    %edi
+     d3a:	5d                   	pop    %ebp
+     d3b:	c3                   	ret
+
+00000d3c <atoi>:
+  return r;
+}
+
+int
+atoi(const char *s)
+{
+     d3c:	55                   	push   %ebp
+     d3d:	89 e5                	mov    %esp,%ebp
+     d3f:	53                   	push   %ebx
+     d40:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+     d43:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+     d48:	eb 10                	jmp    d5a <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+     d4a:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+     d4d:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+     d50:	83 c1 01             	add    $0x1,%ecx
+     d53:	0f be c0             	movsbl %al,%eax
+     d56:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+     d5a:	0f b6 01             	movzbl (%ecx),%eax
+     d5d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     d60:	80 fb 09             	cmp    $0x9,%bl
+     d63:	76 e5                	jbe    d4a <atoi+0xe>
+  return n;
+}
+     d65:	89 d0                	mov    %edx,%eax
+     d67:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d6a:	c9                   	leave
+     d6b:	c3                   	ret
+
+00000d6c <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     d6c:	55                   	push   %ebp
+     d6d:	89 e5                	mov    %esp,%ebp
+     d6f:	57                   	push   %edi
+     d70:	56                   	push   %esi
+     d71:	53                   	push   %ebx
+     d72:	83 ec 08             	sub    $0x8,%esp
+     d75:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     d78:	8b 55 0c             	mov    0xc(%ebp),%edx
+     d7b:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *src;
+  int h;
+
+  dst = vdst;
+  src = vsrc;
+  if(n <= 0)
+     d7e:	85 c0                	test   %eax,%eax
+     d80:	0f 8e 82 00 00 00    	jle    e08 <memmove+0x9c>
+    return vdst;
+  if(src < dst && src + n > dst){
+     d86:	39 da                	cmp    %ebx,%edx
+     d88:	73 07                	jae    d91 <memmove+0x25>
+     d8a:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+     d8d:	39 cb                	cmp    %ecx,%ebx
+     d8f:	72 5e                	jb     def <memmove+0x83>
+    movsbback(dst + n - 1, src + n - 1, n);
+    return vdst;
+  }
+  if(n >= 16 && (((uint)dst ^ (uint)src) & 3) == 0){
+     d91:	83 f8 0f             	cmp    $0xf,%eax
+     d94:	7e 69                	jle    dff <memmove+0x93>
+     d96:	89 d9                	mov    %ebx,%ecx
+     d98:	31 d1                	xor    %edx,%ecx
+     d9a:	f6 c1 03             	test   $0x3,%cl
+     d9d:	75 73                	jne    e12 <memmove+0xa6>
+    h = -(uint)dst & 3;
+     d9f:	89 d9                	mov    %ebx,%ecx
+     da1:	f7 d9                	neg    %ecx
+     da3:	83 e1 03             	and    $0x3,%ecx
+}
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsb" :
+     da6:	89 df                	mov    %ebx,%edi
+     da8:	89 d6                	mov    %edx,%esi
+     daa:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+     dad:	fc                   	cld
+     dae:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    movsb(dst, src, h);
+    dst += h, src += h, n -= h;
+     db0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+     db3:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+     db6:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+     db9:	29 f0                	sub    %esi,%eax
+    movsl(dst, src, n/4);
+     dbb:	8d 50 03             	lea    0x3(%eax),%edx
+     dbe:	0f 49 d0             	cmovns %eax,%edx
+     dc1:	c1 fa 02             	sar    $0x2,%edx
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+     dc4:	89 7d f0             	mov    %edi,-0x10(%ebp)
+     dc7:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     dca:	89 ce                	mov    %ecx,%esi
+     dcc:	89 d1                	mov    %edx,%ecx
+     dce:	fc                   	cld
+     dcf:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    dst += n/4*4, src += n/4*4, n %= 4;
+     dd1:	c1 e2 02             	shl    $0x2,%edx
+     dd4:	8b 7d f0             	mov    -0x10(%ebp),%edi
+     dd7:	01 d7                	add    %edx,%edi
+     dd9:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     ddc:	01 ca                	add    %ecx,%edx
+     dde:	89 c6                	mov    %eax,%esi
+     de0:	c1 fe 1f             	sar    $0x1f,%esi
+     de3:	c1 ee 1e             	shr    $0x1e,%esi
+     de6:	01 f0                	add    %esi,%eax
+     de8:	83 e0 03             	and    $0x3,%eax
+     deb:	29 f0                	sub    %esi,%eax
+     ded:	eb 12                	jmp    e01 <memmove+0x95>
+    movsbback(dst + n - 1, src + n - 1, n);
+     def:	8d 78 ff             	lea    -0x1(%eax),%edi
+     df2:	8d 34 3a             	lea    (%edx,%edi,1),%esi
+     df5:	01 df                	add    %ebx,%edi
+// Copy cnt bytes down from the last ones, at dst and src, to the
+// first: for overlapping moves up.
+static inline void
+movsbback(void *dst, const void *src, int cnt)
+{
+  asm volatile("std; rep movsb; cld" :
+     df7:	89 c1                	mov    %eax,%ecx
+     df9:	fd                   	std
+     dfa:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     dfc:	fc                   	cld
+    return vdst;
+     dfd:	eb 09                	jmp    e08 <memmove+0x9c>
+  dst = vdst;
+     dff:	89 df                	mov    %ebx,%edi
+  asm volatile("cld; rep movsb" :
+     e01:	89 d6                	mov    %edx,%esi
+     e03:	89 c1                	mov    %eax,%ecx
+     e05:	fc                   	cld
+     e06:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  }
+  movsb(dst, src, n);
+  return vdst;
+}
+     e08:	89 d8                	mov    %ebx,%eax
+     e0a:	83 c4 08             	add    $0x8,%esp
+     e0d:	5b                   	pop    %ebx
+     e0e:	5e                   	pop    %esi
+     e0f:	5f                   	pop    %edi
+     e10:	5d                   	pop    %ebp
+     e11:	c3                   	ret
+  dst = vdst;
+     e12:	89 df                	mov    %ebx,%edi
+     e14:	eb eb                	jmp    e01 <memmove+0x95>
+
+00000e16 <vclock_gettime>:
+
+// clock_gettime() without a system call: read the clock page
+// that the kernel maps at CLOCKPAGE (see clock.h).
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+     e16:	55                   	push   %ebp
+     e17:	89 e5                	mov    %esp,%ebp
+     e19:	57                   	push   %edi
+     e1a:	56                   	push   %esi
+     e1b:	53                   	push   %ebx
+     e1c:	83 ec 14             	sub    $0x14,%esp
+  struct clockpage *cp = (struct clockpage*)CLOCKPAGE;
+  uint seq, rem, d;
+  uint64 tsc, ns, now;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+     e1f:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     e23:	0f 87 a3 00 00 00    	ja     ecc <vclock_gettime+0xb6>
+    return -1;
+  do {
+    seq = cp->seq;
+     e29:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+    __sync_synchronize();
+     e2e:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    tsc = cp->tsc;
+     e33:	8b 15 10 f0 ff 7f    	mov    0x7ffff010,%edx
+     e39:	8b 1d 14 f0 ff 7f    	mov    0x7ffff014,%ebx
+    ns = cp->ns;
+     e3f:	8b 35 18 f0 ff 7f    	mov    0x7ffff018,%esi
+     e45:	8b 3d 1c f0 ff 7f    	mov    0x7ffff01c,%edi
+    __sync_synchronize();
+     e4b:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != cp->seq);
+     e50:	89 c1                	mov    %eax,%ecx
+     e52:	83 e1 01             	and    $0x1,%ecx
+     e55:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     e58:	75 cf                	jne    e29 <vclock_gettime+0x13>
+     e5a:	8b 0d 00 f0 ff 7f    	mov    0x7ffff000,%ecx
+     e60:	39 c1                	cmp    %eax,%ecx
+     e62:	75 c5                	jne    e29 <vclock_gettime+0x13>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+     e64:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     e67:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     e6a:	0f 31                	rdtsc
+     e6c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     e6f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     e72:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  now = rdtsc();
+  // Less than a tick has passed since the update, so the delta
+  // fits in 32 bits.
+  d = now > tsc ? now - tsc : 0;
+     e75:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     e78:	19 d3                	sbb    %edx,%ebx
+     e7a:	73 07                	jae    e83 <vclock_gettime+0x6d>
+     e7c:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+     e7f:	29 d8                	sub    %ebx,%eax
+     e81:	89 c1                	mov    %eax,%ecx
+  ns += ((uint64)d * cp->mult) >> cp->shift;
+     e83:	89 c8                	mov    %ecx,%eax
+     e85:	f7 25 04 f0 ff 7f    	mull   0x7ffff004
+     e8b:	0f b6 0d 08 f0 ff 7f 	movzbl 0x7ffff008,%ecx
+     e92:	0f ad d0             	shrd   %cl,%edx,%eax
+     e95:	d3 ea                	shr    %cl,%edx
+     e97:	f6 c1 20             	test   $0x20,%cl
+     e9a:	74 04                	je     ea0 <vclock_gettime+0x8a>
+     e9c:	89 d0                	mov    %edx,%eax
+     e9e:	31 d2                	xor    %edx,%edx
+     ea0:	01 f0                	add    %esi,%eax
+     ea2:	11 fa                	adc    %edi,%edx
+static inline uint
+divl(uint64 n, uint d, uint *r)
+{
+  uint q;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (*r) :
+     ea4:	bb 00 ca 9a 3b       	mov    $0x3b9aca00,%ebx
+     ea9:	f7 f3                	div    %ebx
+  ts->tv_sec = divl(ns, 1000000000, &rem);
+     eab:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     eae:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = rem;
+     eb0:	89 57 04             	mov    %edx,0x4(%edi)
+  if(clk == CLOCK_REALTIME)
+     eb3:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     eb7:	75 1a                	jne    ed3 <vclock_gettime+0xbd>
+    ts->tv_sec += cp->boottime;
+     eb9:	03 05 0c f0 ff 7f    	add    0x7ffff00c,%eax
+     ebf:	89 07                	mov    %eax,(%edi)
+  return 0;
+     ec1:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     ec4:	83 c4 14             	add    $0x14,%esp
+     ec7:	5b                   	pop    %ebx
+     ec8:	5e                   	pop    %esi
+     ec9:	5f                   	pop    %edi
+     eca:	5d                   	pop    %ebp
+     ecb:	c3                   	ret
+    return -1;
+     ecc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     ed1:	eb f1                	jmp    ec4 <vclock_gettime+0xae>
+  return 0;
+     ed3:	b8 00 00 00 00       	mov    $0x0,%eax
+     ed8:	eb ea                	jmp    ec4 <vclock_gettime+0xae>
+
+00000eda <flush>:
+
+// Write out fd's buffer, or with fd < 0 every buffer.
+// Returns -1 if a write fails.
+int
+flush(int fd)
+{
+     eda:	55                   	push   %ebp
+     edb:	89 e5                	mov    %esp,%ebp
+     edd:	56                   	push   %esi
+     ede:	53                   	push   %ebx
+     edf:	8b 45 08             	mov    0x8(%ebp),%eax
+  int r, n;
+
+  if(fd < 0){
+     ee2:	85 c0                	test   %eax,%eax
+     ee4:	78 5d                	js     f43 <flush+0x69>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+      if(flush(fd) < 0)
+        r = -1;
+    return r;
+  }
+  if(fd >= NOBUF || (n = obuf[fd].n) == 0)
+     ee6:	83 f8 0f             	cmp    $0xf,%eax
+     ee9:	7f 64                	jg     f4f <flush+0x75>
+     eeb:	69 d0 08 02 00 00    	imul   $0x208,%eax,%edx
+     ef1:	8b b2 84 48 00 00    	mov    0x4884(%edx),%esi
+     ef7:	85 f6                	test   %esi,%esi
+     ef9:	74 59                	je     f54 <flush+0x7a>
+    return 0;
+  obuf[fd].n = 0;
+     efb:	c7 82 84 48 00 00 00 	movl   $0x0,0x4884(%edx)
+     f02:	00 00 00 
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     f05:	81 c2 88 48 00 00    	add    $0x4888,%edx
+     f0b:	83 ec 04             	sub    $0x4,%esp
+     f0e:	56                   	push   %esi
+     f0f:	52                   	push   %edx
+     f10:	50                   	push   %eax
+     f11:	e8 5a 03 00 00       	call   1270 <write>
+     f16:	83 c4 10             	add    $0x10,%esp
+     f19:	39 f0                	cmp    %esi,%eax
+     f1b:	75 40                	jne    f5d <flush+0x83>
+     f1d:	be 00 00 00 00       	mov    $0x0,%esi
+     f22:	eb 30                	jmp    f54 <flush+0x7a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     f24:	83 c3 01             	add    $0x1,%ebx
+     f27:	83 fb 0f             	cmp    $0xf,%ebx
+     f2a:	7f 28                	jg     f54 <flush+0x7a>
+      if(flush(fd) < 0)
+     f2c:	83 ec 0c             	sub    $0xc,%esp
+     f2f:	53                   	push   %ebx
+     f30:	e8 a5 ff ff ff       	call   eda <flush>
+     f35:	83 c4 10             	add    $0x10,%esp
+     f38:	85 c0                	test   %eax,%eax
+     f3a:	79 e8                	jns    f24 <flush+0x4a>
+        r = -1;
+     f3c:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     f41:	eb e1                	jmp    f24 <flush+0x4a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     f43:	be 00 00 00 00       	mov    $0x0,%esi
+     f48:	bb 00 00 00 00       	mov    $0x0,%ebx
+     f4d:	eb d8                	jmp    f27 <flush+0x4d>
+    return 0;
+     f4f:	be 00 00 00 00       	mov    $0x0,%esi
+}
+     f54:	89 f0                	mov    %esi,%eax
+     f56:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f59:	5b                   	pop    %ebx
+     f5a:	5e                   	pop    %esi
+     f5b:	5d                   	pop    %ebp
+     f5c:	c3                   	ret
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     f5d:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     f62:	eb f0                	jmp    f54 <flush+0x7a>
+
+00000f64 <bufreset>:
+
+static void
+bufreset(int fd)
+{
+  if(fd >= 0 && fd < NOBUF){
+     f64:	83 f8 0f             	cmp    $0xf,%eax
+     f67:	76 01                	jbe    f6a <bufreset+0x6>
+     f69:	c3                   	ret
+{
+     f6a:	55                   	push   %ebp
+     f6b:	89 e5                	mov    %esp,%ebp
+     f6d:	53                   	push   %ebx
+     f6e:	83 ec 10             	sub    $0x10,%esp
+     f71:	89 c3                	mov    %eax,%ebx
+    flush(fd);
+     f73:	50                   	push   %eax
+     f74:	e8 61 ff ff ff       	call   eda <flush>
+    obuf[fd].mode = BUNKNOWN;
+     f79:	69 db 08 02 00 00    	imul   $0x208,%ebx,%ebx
+     f7f:	c7 83 80 48 00 00 00 	movl   $0x0,0x4880(%ebx)
+     f86:	00 00 00 
+     f89:	83 c4 10             	add    $0x10,%esp
+  }
+}
+     f8c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f8f:	c9                   	leave
+     f90:	c3                   	ret
+
+00000f91 <bufwrite>:
+
+// Write n bytes from p to fd, through its buffer.
+// Returns n, or -1 if a write fails.
+int
+bufwrite(int fd, const void *p, int n)
+{
+     f91:	55                   	push   %ebp
+     f92:	89 e5                	mov    %esp,%ebp
+     f94:	57                   	push   %edi
+     f95:	56                   	push   %esi
+     f96:	53                   	push   %ebx
+     f97:	83 ec 3c             	sub    $0x3c,%esp
+     f9a:	8b 75 08             	mov    0x8(%ebp),%esi
+     f9d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct stat st;
+  const char *s;
+  int i;
+
+  if(fd < 0 || fd >= NOBUF)
+     fa0:	83 fe 0f             	cmp    $0xf,%esi
+     fa3:	0f 87 a2 00 00 00    	ja     104b <bufwrite+0xba>
+    return write(fd, p, n);
+  if(obuf[fd].mode == BUNKNOWN){
+     fa9:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     faf:	83 b8 80 48 00 00 00 	cmpl   $0x0,0x4880(%eax)
+     fb6:	75 19                	jne    fd1 <bufwrite+0x40>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     fb8:	83 fe 02             	cmp    $0x2,%esi
+     fbb:	0f 85 9c 00 00 00    	jne    105d <bufwrite+0xcc>
+      obuf[fd].mode = BNONE;
+     fc1:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     fc7:	c7 80 80 48 00 00 01 	movl   $0x1,0x4880(%eax)
+     fce:	00 00 00 
+    else
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+  }
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     fd1:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     fd7:	89 da                	mov    %ebx,%edx
+     fd9:	03 90 84 48 00 00    	add    0x4884(%eax),%edx
+     fdf:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+     fe5:	0f 8f ae 00 00 00    	jg     1099 <bufwrite+0x108>
+    return -1;
+  if(n >= OBUFSZ)
+     feb:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+     ff1:	0f 8f bd 00 00 00    	jg     10b4 <bufwrite+0x123>
+    return write(fd, p, n);
+  memmove(obuf[fd].buf + obuf[fd].n, p, n);
+     ff7:	69 d6 08 02 00 00    	imul   $0x208,%esi,%edx
+     ffd:	8d ba 80 48 00 00    	lea    0x4880(%edx),%edi
+    1003:	8b 82 84 48 00 00    	mov    0x4884(%edx),%eax
+    1009:	83 ec 04             	sub    $0x4,%esp
+    100c:	53                   	push   %ebx
+    100d:	ff 75 0c             	push   0xc(%ebp)
+    1010:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+    1013:	8d 84 10 88 48 00 00 	lea    0x4888(%eax,%edx,1),%eax
+    101a:	50                   	push   %eax
+    101b:	e8 4c fd ff ff       	call   d6c <memmove>
+  obuf[fd].n += n;
+    1020:	01 5f 04             	add    %ebx,0x4(%edi)
+  if(obuf[fd].mode == BNONE)
+    1023:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+    1026:	8b 82 80 48 00 00    	mov    0x4880(%edx),%eax
+    102c:	83 c4 10             	add    $0x10,%esp
+    102f:	83 f8 01             	cmp    $0x1,%eax
+    1032:	0f 84 91 00 00 00    	je     10c9 <bufwrite+0x138>
+    return flush(fd) < 0 ? -1 : n;
+  if(obuf[fd].mode == BLINE)
+    1038:	83 f8 02             	cmp    $0x2,%eax
+    103b:	0f 84 ca 00 00 00    	je     110b <bufwrite+0x17a>
+    for(s = p, i = 0; i < n; i++)
+      if(s[i] == '\n')
+        return flush(fd) < 0 ? -1 : n;
+  return n;
+    1041:	89 d8                	mov    %ebx,%eax
+}
+    1043:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1046:	5b                   	pop    %ebx
+    1047:	5e                   	pop    %esi
+    1048:	5f                   	pop    %edi
+    1049:	5d                   	pop    %ebp
+    104a:	c3                   	ret
+    return write(fd, p, n);
+    104b:	83 ec 04             	sub    $0x4,%esp
+    104e:	53                   	push   %ebx
+    104f:	ff 75 0c             	push   0xc(%ebp)
+    1052:	56                   	push   %esi
+    1053:	e8 18 02 00 00       	call   1270 <write>
+    1058:	83 c4 10             	add    $0x10,%esp
+    105b:	eb e6                	jmp    1043 <bufwrite+0xb2>
+    if(fd == 2 || fstat(fd, &st) < 0)
+    105d:	83 ec 08             	sub    $0x8,%esp
+    1060:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+    1063:	50                   	push   %eax
+    1064:	56                   	push   %esi
+    1065:	e8 51 02 00 00       	call   12bb <fstat>
+    106a:	83 c4 10             	add    $0x10,%esp
+    106d:	85 c0                	test   %eax,%eax
+    106f:	0f 88 4c ff ff ff    	js     fc1 <bufwrite+0x30>
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+    1075:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+    107a:	74 16                	je     1092 <bufwrite+0x101>
+    107c:	ba 03 00 00 00       	mov    $0x3,%edx
+    1081:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+    1087:	89 90 80 48 00 00    	mov    %edx,0x4880(%eax)
+    108d:	e9 3f ff ff ff       	jmp    fd1 <bufwrite+0x40>
+    1092:	ba 02 00 00 00       	mov    $0x2,%edx
+    1097:	eb e8                	jmp    1081 <bufwrite+0xf0>
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+    1099:	83 ec 0c             	sub    $0xc,%esp
+    109c:	56                   	push   %esi
+    109d:	e8 38 fe ff ff       	call   eda <flush>
+    10a2:	83 c4 10             	add    $0x10,%esp
+    10a5:	85 c0                	test   %eax,%eax
+    10a7:	0f 89 3e ff ff ff    	jns    feb <bufwrite+0x5a>
+    return -1;
+    10ad:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    10b2:	eb 8f                	jmp    1043 <bufwrite+0xb2>
+    return write(fd, p, n);
+    10b4:	83 ec 04             	sub    $0x4,%esp
+    10b7:	53                   	push   %ebx
+    10b8:	ff 75 0c             	push   0xc(%ebp)
+    10bb:	56                   	push   %esi
+    10bc:	e8 af 01 00 00       	call   1270 <write>
+    10c1:	83 c4 10             	add    $0x10,%esp
+    10c4:	e9 7a ff ff ff       	jmp    1043 <bufwrite+0xb2>
+    return flush(fd) < 0 ? -1 : n;
+    10c9:	83 ec 0c             	sub    $0xc,%esp
+    10cc:	56                   	push   %esi
+    10cd:	e8 08 fe ff ff       	call   eda <flush>
+    10d2:	83 c4 10             	add    $0x10,%esp
+    10d5:	85 c0                	test   %eax,%eax
+    10d7:	78 07                	js     10e0 <bufwrite+0x14f>
+    10d9:	89 d8                	mov    %ebx,%eax
+    10db:	e9 63 ff ff ff       	jmp    1043 <bufwrite+0xb2>
+    10e0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    10e5:	e9 59 ff ff ff       	jmp    1043 <bufwrite+0xb2>
+        return flush(fd) < 0 ? -1 : n;
+    10ea:	83 ec 0c             	sub    $0xc,%esp
+    10ed:	56                   	push   %esi
+    10ee:	e8 e7 fd ff ff       	call   eda <flush>
+    10f3:	83 c4 10             	add    $0x10,%esp
+    10f6:	85 c0                	test   %eax,%eax
+    10f8:	78 07                	js     1101 <bufwrite+0x170>
+    10fa:	89 d8                	mov    %ebx,%eax
+    10fc:	e9 42 ff ff ff       	jmp    1043 <bufwrite+0xb2>
+    1101:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1106:	e9 38 ff ff ff       	jmp    1043 <bufwrite+0xb2>
+    for(s = p, i = 0; i < n; i++)
+    110b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1110:	39 d8                	cmp    %ebx,%eax
+    1112:	7d 0e                	jge    1122 <bufwrite+0x191>
+      if(s[i] == '\n')
+    1114:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    1117:	80 3c 01 0a          	cmpb   $0xa,(%ecx,%eax,1)
+    111b:	74 cd                	je     10ea <bufwrite+0x159>
+    for(s = p, i = 0; i < n; i++)
+    111d:	83 c0 01             	add    $0x1,%eax
+    1120:	eb ee                	jmp    1110 <bufwrite+0x17f>
+  return n;
+    1122:	89 d8                	mov    %ebx,%eax
+    1124:	e9 1a ff ff ff       	jmp    1043 <bufwrite+0xb2>
+
+00001129 <fork>:
+
+int
+fork(void)
+{
+    1129:	55                   	push   %ebp
+    112a:	89 e5                	mov    %esp,%ebp
+    112c:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+    112f:	6a ff                	push   $0xffffffff
+    1131:	e8 a4 fd ff ff       	call   eda <flush>
+  return _fork();
+    1136:	e8 bd 00 00 00       	call   11f8 <_fork>
+}
+    113b:	c9                   	leave
+    113c:	c3                   	ret
+
+0000113d <exit>:
+
+int
+exit(void)
+{
+    113d:	55                   	push   %ebp
+    113e:	89 e5                	mov    %esp,%ebp
+    1140:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+    1143:	6a ff                	push   $0xffffffff
+    1145:	e8 90 fd ff ff       	call   eda <flush>
+  _exit();
+    114a:	e8 b8 00 00 00       	call   1207 <_exit>
+
+0000114f <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+    114f:	55                   	push   %ebp
+    1150:	89 e5                	mov    %esp,%ebp
+    1152:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+    1155:	6a ff                	push   $0xffffffff
+    1157:	e8 7e fd ff ff       	call   eda <flush>
+  return _exec(path, argv);
+    115c:	83 c4 08             	add    $0x8,%esp
+    115f:	ff 75 0c             	push   0xc(%ebp)
+    1162:	ff 75 08             	push   0x8(%ebp)
+    1165:	e8 bb 00 00 00       	call   1225 <_exec>
+}
+    116a:	c9                   	leave
+    116b:	c3                   	ret
+
+0000116c <close>:
+
+int
+close(int fd)
+{
+    116c:	55                   	push   %ebp
+    116d:	89 e5                	mov    %esp,%ebp
+    116f:	53                   	push   %ebx
+    1170:	83 ec 04             	sub    $0x4,%esp
+    1173:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bufreset(fd);
+    1176:	89 d8                	mov    %ebx,%eax
+    1178:	e8 e7 fd ff ff       	call   f64 <bufreset>
+  return _close(fd);
+    117d:	83 ec 0c             	sub    $0xc,%esp
+    1180:	53                   	push   %ebx
+    1181:	e8 90 00 00 00       	call   1216 <_close>
+}
+    1186:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1189:	c9                   	leave
+    118a:	c3                   	ret
+
+0000118b <stat>:
+{
+    118b:	55                   	push   %ebp
+    118c:	89 e5                	mov    %esp,%ebp
+    118e:	56                   	push   %esi
+    118f:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+    1190:	83 ec 08             	sub    $0x8,%esp
+    1193:	6a 00                	push   $0x0
+    1195:	ff 75 08             	push   0x8(%ebp)
+    1198:	e8 f1 00 00 00       	call   128e <open>
+  if(fd < 0)
+    119d:	83 c4 10             	add    $0x10,%esp
+    11a0:	85 c0                	test   %eax,%eax
+    11a2:	78 24                	js     11c8 <stat+0x3d>
+    11a4:	89 c3                	mov    %eax,%ebx
+  r = fstat(fd, st);
+    11a6:	83 ec 08             	sub    $0x8,%esp
+    11a9:	ff 75 0c             	push   0xc(%ebp)
+    11ac:	50                   	push   %eax
+    11ad:	e8 09 01 00 00       	call   12bb <fstat>
+    11b2:	89 c6                	mov    %eax,%esi
+  close(fd);
+    11b4:	89 1c 24             	mov    %ebx,(%esp)
+    11b7:	e8 b0 ff ff ff       	call   116c <close>
+  return r;
+    11bc:	83 c4 10             	add    $0x10,%esp
+}
+    11bf:	89 f0                	mov    %esi,%eax
+    11c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    11c4:	5b                   	pop    %ebx
+    11c5:	5e                   	pop    %esi
+    11c6:	5d                   	pop    %ebp
+    11c7:	c3                   	ret
+    return -1;
+    11c8:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    11cd:	eb f0                	jmp    11bf <stat+0x34>
+
+000011cf <dup2>:
+
+int
+dup2(int oldfd, int newfd)
+{
+    11cf:	55                   	push   %ebp
+    11d0:	89 e5                	mov    %esp,%ebp
+    11d2:	56                   	push   %esi
+    11d3:	53                   	push   %ebx
+    11d4:	8b 75 08             	mov    0x8(%ebp),%esi
+    11d7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(oldfd != newfd)
+    11da:	39 de                	cmp    %ebx,%esi
+    11dc:	75 11                	jne    11ef <dup2+0x20>
+    bufreset(newfd);
+  return _dup2(oldfd, newfd);
+    11de:	83 ec 08             	sub    $0x8,%esp
+    11e1:	53                   	push   %ebx
+    11e2:	56                   	push   %esi
+    11e3:	e8 4c 00 00 00       	call   1234 <_dup2>
+}
+    11e8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    11eb:	5b                   	pop    %ebx
+    11ec:	5e                   	pop    %esi
+    11ed:	5d                   	pop    %ebp
+    11ee:	c3                   	ret
+    bufreset(newfd);
+    11ef:	89 d8                	mov    %ebx,%eax
+    11f1:	e8 6e fd ff ff       	call   f64 <bufreset>
+    11f6:	eb e6                	jmp    11de <dup2+0xf>
+
+000011f8 <_fork>:
+  1: ret
+
+#define SYSCALL(name) STUB(name, SYS_ ## name)
+
+# ulib.c wraps these, to flush printf()'s buffers first.
+STUB(_fork, SYS_fork)
+    11f8:	b8 01 00 00 00       	mov    $0x1,%eax
+    11fd:	89 e1                	mov    %esp,%ecx
+    11ff:	ba 06 12 00 00       	mov    $0x1206,%edx
+    1204:	0f 34                	sysenter
+    1206:	c3                   	ret
+
+00001207 <_exit>:
+STUB(_exit, SYS_exit)
+    1207:	b8 02 00 00 00       	mov    $0x2,%eax
+    120c:	89 e1                	mov    %esp,%ecx
+    120e:	ba 15 12 00 00       	mov    $0x1215,%edx
+    1213:	0f 34                	sysenter
+    1215:	c3                   	ret
+
+00001216 <_close>:
+STUB(_close, SYS_close)
+    1216:	b8 15 00 00 00       	mov    $0x15,%eax
+    121b:	89 e1                	mov    %esp,%ecx
+    121d:	ba 24 12 00 00       	mov    $0x1224,%edx
+    1222:	0f 34                	sysenter
+    1224:	c3                   	ret
+
+00001225 <_exec>:
+STUB(_exec, SYS_exec)
+    1225:	b8 07 00 00 00       	mov    $0x7,%eax
+    122a:	89 e1                	mov    %esp,%ecx
+    122c:	ba 33 12 00 00       	mov    $0x1233,%edx
+    1231:	0f 34                	sysenter
+    1233:	c3                   	ret
+
+00001234 <_dup2>:
+STUB(_dup2, SYS_dup2)
+    1234:	b8 17 00 00 00       	mov    $0x17,%eax
+    1239:	89 e1                	mov    %esp,%ecx
+    123b:	ba 42 12 00 00       	mov    $0x1242,%edx
+    1240:	0f 34                	sysenter
+    1242:	c3                   	ret
+
+00001243 <wait>:
+
+SYSCALL(wait)
+    1243:	b8 03 00 00 00       	mov    $0x3,%eax
+    1248:	89 e1                	mov    %esp,%ecx
+    124a:	ba 51 12 00 00       	mov    $0x1251,%edx
+    124f:	0f 34                	sysenter
+    1251:	c3                   	ret
+
+00001252 <pipe>:
+SYSCALL(pipe)
+    1252:	b8 04 00 00 00       	mov    $0x4,%eax
+    1257:	89 e1                	mov    %esp,%ecx
+    1259:	ba 60 12 00 00       	mov    $0x1260,%edx
+    125e:	0f 34                	sysenter
+    1260:	c3                   	ret
+
+00001261 <read>:
+SYSCALL(read)
+    1261:	b8 05 00 00 00       	mov    $0x5,%eax
+    1266:	89 e1                	mov    %esp,%ecx
+    1268:	ba 6f 12 00 00       	mov    $0x126f,%edx
+    126d:	0f 34                	sysenter
+    126f:	c3                   	ret
+
+00001270 <write>:
+SYSCALL(write)
+    1270:	b8 10 00 00 00       	mov    $0x10,%eax
+    1275:	89 e1                	mov    %esp,%ecx
+    1277:	ba 7e 12 00 00       	mov    $0x127e,%edx
+    127c:	0f 34                	sysenter
+    127e:	c3                   	ret
+
+0000127f <kill>:
+SYSCALL(kill)
+    127f:	b8 06 00 00 00       	mov    $0x6,%eax
+    1284:	89 e1                	mov    %esp,%ecx
+    1286:	ba 8d 12 00 00       	mov    $0x128d,%edx
+    128b:	0f 34                	sysenter
+    128d:	c3                   	ret
+
+0000128e <open>:
+SYSCALL(open)
+    128e:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1293:	89 e1                	mov    %esp,%ecx
+    1295:	ba 9c 12 00 00       	mov    $0x129c,%edx
+    129a:	0f 34                	sysenter
+    129c:	c3                   	ret
+
+0000129d <mknod>:
+SYSCALL(mknod)
+    129d:	b8 11 00 00 00       	mov    $0x11,%eax
+    12a2:	89 e1                	mov    %esp,%ecx
+    12a4:	ba ab 12 00 00       	mov    $0x12ab,%edx
+    12a9:	0f 34                	sysenter
+    12ab:	c3                   	ret
+
+000012ac <unlink>:
+SYSCALL(unlink)
+    12ac:	b8 12 00 00 00       	mov    $0x12,%eax
+    12b1:	89 e1                	mov    %esp,%ecx
+    12b3:	ba ba 12 00 00       	mov    $0x12ba,%edx
+    12b8:	0f 34                	sysenter
+    12ba:	c3                   	ret
+
+000012bb <fstat>:
+SYSCALL(fstat)
+    12bb:	b8 08 00 00 00       	mov    $0x8,%eax
+    12c0:	89 e1                	mov    %esp,%ecx
+    12c2:	ba c9 12 00 00       	mov    $0x12c9,%edx
+    12c7:	0f 34                	sysenter
+    12c9:	c3                   	ret
+
+000012ca <link>:
+SYSCALL(link)
+    12ca:	b8 13 00 00 00       	mov    $0x13,%eax
+    12cf:	89 e1                	mov    %esp,%ecx
+    12d1:	ba d8 12 00 00       	mov    $0x12d8,%edx
+    12d6:	0f 34                	sysenter
+    12d8:	c3                   	ret
+
+000012d9 <mkdir>:
+SYSCALL(mkdir)
+    12d9:	b8 14 00 00 00       	mov    $0x14,%eax
+    12de:	89 e1                	mov    %esp,%ecx
+    12e0:	ba e7 12 00 00       	mov    $0x12e7,%edx
+    12e5:	0f 34                	sysenter
+    12e7:	c3                   	ret
+
+000012e8 <chdir>:
+SYSCALL(chdir)
+    12e8:	b8 09 00 00 00       	mov    $0x9,%eax
+    12ed:	89 e1                	mov    %esp,%ecx
+    12ef:	ba f6 12 00 00       	mov    $0x12f6,%edx
+    12f4:	0f 34                	sysenter
+    12f6:	c3                   	ret
+
+000012f7 <dup>:
+SYSCALL(dup)
+    12f7:	b8 0a 00 00 00       	mov    $0xa,%eax
+    12fc:	89 e1                	mov    %esp,%ecx
+    12fe:	ba 05 13 00 00       	mov    $0x1305,%edx
+    1303:	0f 34                	sysenter
+    1305:	c3                   	ret
+
+00001306 <getpid>:
+SYSCALL(getpid)
+    1306:	b8 0b 00 00 00       	mov    $0xb,%eax
+    130b:	89 e1                	mov    %esp,%ecx
+    130d:	ba 14 13 00 00       	mov    $0x1314,%edx
+    1312:	0f 34                	sysenter
+    1314:	c3                   	ret
+
+00001315 <sbrk>:
+SYSCALL(sbrk)
+    1315:	b8 0c 00 00 00       	mov    $0xc,%eax
+    131a:	89 e1                	mov    %esp,%ecx
+    131c:	ba 23 13 00 00       	mov    $0x1323,%edx
+    1321:	0f 34                	sysenter
+    1323:	c3                   	ret
+
+00001324 <sleep>:
+SYSCALL(sleep)
+    1324:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1329:	89 e1                	mov    %esp,%ecx
+    132b:	ba 32 13 00 00       	mov    $0x1332,%edx
+    1330:	0f 34                	sysenter
+    1332:	c3                   	ret
+
+00001333 <uptime>:
+SYSCALL(uptime)
+    1333:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1338:	89 e1                	mov    %esp,%ecx
+    133a:	ba 41 13 00 00       	mov    $0x1341,%edx
+    133f:	0f 34                	sysenter
+    1341:	c3                   	ret
+
+00001342 <date>:
+SYSCALL(date)
+    1342:	b8 16 00 00 00       	mov    $0x16,%eax
+    1347:	89 e1                	mov    %esp,%ecx
+    1349:	ba 50 13 00 00       	mov    $0x1350,%edx
+    134e:	0f 34                	sysenter
+    1350:	c3                   	ret
+
+00001351 <faultaround>:
+SYSCALL(faultaround)
+    1351:	b8 18 00 00 00       	mov    $0x18,%eax
+    1356:	89 e1                	mov    %esp,%ecx
+    1358:	ba 5f 13 00 00       	mov    $0x135f,%edx
+    135d:	0f 34                	sysenter
+    135f:	c3                   	ret
+
+00001360 <faultstat>:
+SYSCALL(faultstat)
+    1360:	b8 19 00 00 00       	mov    $0x19,%eax
+    1365:	89 e1                	mov    %esp,%ecx
+    1367:	ba 6e 13 00 00       	mov    $0x136e,%edx
+    136c:	0f 34                	sysenter
+    136e:	c3                   	ret
+
+0000136f <mmap>:
+SYSCALL(mmap)
+    136f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1374:	89 e1                	mov    %esp,%ecx
+    1376:	ba 7d 13 00 00       	mov    $0x137d,%edx
+    137b:	0f 34                	sysenter
+    137d:	c3                   	ret
+
+0000137e <munmap>:
+SYSCALL(munmap)
+    137e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1383:	89 e1                	mov    %esp,%ecx
+    1385:	ba 8c 13 00 00       	mov    $0x138c,%edx
+    138a:	0f 34                	sysenter
+    138c:	c3                   	ret
+
+0000138d <largepages>:
+SYSCALL(largepages)
+    138d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1392:	89 e1                	mov    %esp,%ecx
+    1394:	ba 9b 13 00 00       	mov    $0x139b,%edx
+    1399:	0f 34                	sysenter
+    139b:	c3                   	ret
+
+0000139c <spawn>:
+SYSCALL(spawn)
+    139c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    13a1:	89 e1                	mov    %esp,%ecx
+    13a3:	ba aa 13 00 00       	mov    $0x13aa,%edx
+    13a8:	0f 34                	sysenter
+    13aa:	c3                   	ret
+
+000013ab <setpriority>:
+SYSCALL(setpriority)
+    13ab:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    13b0:	89 e1                	mov    %esp,%ecx
+    13b2:	ba b9 13 00 00       	mov    $0x13b9,%edx
+    13b7:	0f 34                	sysenter
+    13b9:	c3                   	ret
+
+000013ba <getpriority>:
+SYSCALL(getpriority)
+    13ba:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    13bf:	89 e1                	mov    %esp,%ecx
+    13c1:	ba c8 13 00 00       	mov    $0x13c8,%edx
+    13c6:	0f 34                	sysenter
+    13c8:	c3                   	ret
+
+000013c9 <getprocinfo>:
+SYSCALL(getprocinfo)
+    13c9:	b8 20 00 00 00       	mov    $0x20,%eax
+    13ce:	89 e1                	mov    %esp,%ecx
+    13d0:	ba d7 13 00 00       	mov    $0x13d7,%edx
+    13d5:	0f 34                	sysenter
+    13d7:	c3                   	ret
+
+000013d8 <getcpuinfo>:
+SYSCALL(getcpuinfo)
+    13d8:	b8 21 00 00 00       	mov    $0x21,%eax
+    13dd:	89 e1                	mov    %esp,%ecx
+    13df:	ba e6 13 00 00       	mov    $0x13e6,%edx
+    13e4:	0f 34                	sysenter
+    13e6:	c3                   	ret
+
+000013e7 <clone>:
+SYSCALL(clone)
+    13e7:	b8 22 00 00 00       	mov    $0x22,%eax
+    13ec:	89 e1                	mov    %esp,%ecx
+    13ee:	ba f5 13 00 00       	mov    $0x13f5,%edx
+    13f3:	0f 34                	sysenter
+    13f5:	c3                   	ret
+
+000013f6 <join>:
+SYSCALL(join)
+    13f6:	b8 23 00 00 00       	mov    $0x23,%eax
+    13fb:	89 e1                	mov    %esp,%ecx
+    13fd:	ba 04 14 00 00       	mov    $0x1404,%edx
+    1402:	0f 34                	sysenter
+    1404:	c3                   	ret
+
+00001405 <futex_wait>:
+SYSCALL(futex_wait)
+    1405:	b8 24 00 00 00       	mov    $0x24,%eax
+    140a:	89 e1                	mov    %esp,%ecx
+    140c:	ba 13 14 00 00       	mov    $0x1413,%edx
+    1411:	0f 34                	sysenter
+    1413:	c3                   	ret
+
+00001414 <futex_wake>:
+SYSCALL(futex_wake)
+    1414:	b8 25 00 00 00       	mov    $0x25,%eax
+    1419:	89 e1                	mov    %esp,%ecx
+    141b:	ba 22 14 00 00       	mov    $0x1422,%edx
+    1420:	0f 34                	sysenter
+    1422:	c3                   	ret
+
+00001423 <setaffinity>:
+SYSCALL(setaffinity)
+    1423:	b8 26 00 00 00       	mov    $0x26,%eax
+    1428:	89 e1                	mov    %esp,%ecx
+    142a:	ba 31 14 00 00       	mov    $0x1431,%edx
+    142f:	0f 34                	sysenter
+    1431:	c3                   	ret
+
+00001432 <getaffinity>:
+SYSCALL(getaffinity)
+    1432:	b8 27 00 00 00       	mov    $0x27,%eax
+    1437:	89 e1                	mov    %esp,%ecx
+    1439:	ba 40 14 00 00       	mov    $0x1440,%edx
+    143e:	0f 34                	sysenter
+    1440:	c3                   	ret
+
+00001441 <clock_gettime>:
+SYSCALL(clock_gettime)
+    1441:	b8 28 00 00 00       	mov    $0x28,%eax
+    1446:	89 e1                	mov    %esp,%ecx
+    1448:	ba 4f 14 00 00       	mov    $0x144f,%edx
+    144d:	0f 34                	sysenter
+    144f:	c3                   	ret
+
+00001450 <msleep>:
+SYSCALL(msleep)
+    1450:	b8 29 00 00 00       	mov    $0x29,%eax
+    1455:	89 e1                	mov    %esp,%ecx
+    1457:	ba 5e 14 00 00       	mov    $0x145e,%edx
+    145c:	0f 34                	sysenter
+    145e:	c3                   	ret
+
+0000145f <lockstat>:
+SYSCALL(lockstat)
+    145f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1464:	89 e1                	mov    %esp,%ecx
+    1466:	ba 6d 14 00 00       	mov    $0x146d,%edx
+    146b:	0f 34                	sysenter
+    146d:	c3                   	ret
+
+0000146e <bstat>:
+SYSCALL(bstat)
+    146e:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    1473:	89 e1                	mov    %esp,%ecx
+    1475:	ba 7c 14 00 00       	mov    $0x147c,%edx
+    147a:	0f 34                	sysenter
+    147c:	c3                   	ret
+
+0000147d <iostat>:
+SYSCALL(iostat)
+    147d:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    1482:	89 e1                	mov    %esp,%ecx
+    1484:	ba 8b 14 00 00       	mov    $0x148b,%edx
+    1489:	0f 34                	sysenter
+    148b:	c3                   	ret
+
+0000148c <fsync>:
+SYSCALL(fsync)
+    148c:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    1491:	89 e1                	mov    %esp,%ecx
+    1493:	ba 9a 14 00 00       	mov    $0x149a,%edx
+    1498:	0f 34                	sysenter
+    149a:	c3                   	ret
+
+0000149b <pread>:
+SYSCALL(pread)
+    149b:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    14a0:	89 e1                	mov    %esp,%ecx
+    14a2:	ba a9 14 00 00       	mov    $0x14a9,%edx
+    14a7:	0f 34                	sysenter
+    14a9:	c3                   	ret
+
+000014aa <pwrite>:
+SYSCALL(pwrite)
+    14aa:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    14af:	89 e1                	mov    %esp,%ecx
+    14b1:	ba b8 14 00 00       	mov    $0x14b8,%edx
+    14b6:	0f 34                	sysenter
+    14b8:	c3                   	ret
+
+000014b9 <readv>:
+SYSCALL(readv)
+    14b9:	b8 30 00 00 00       	mov    $0x30,%eax
+    14be:	89 e1                	mov    %esp,%ecx
+    14c0:	ba c7 14 00 00       	mov    $0x14c7,%edx
+    14c5:	0f 34                	sysenter
+    14c7:	c3                   	ret
+
+000014c8 <writev>:
+SYSCALL(writev)
+    14c8:	b8 31 00 00 00       	mov    $0x31,%eax
+    14cd:	89 e1                	mov    %esp,%ecx
+    14cf:	ba d6 14 00 00       	mov    $0x14d6,%edx
+    14d4:	0f 34                	sysenter
+    14d6:	c3                   	ret
+
+000014d7 <sendfile>:
+SYSCALL(sendfile)
+    14d7:	b8 32 00 00 00       	mov    $0x32,%eax
+    14dc:	89 e1                	mov    %esp,%ecx
+    14de:	ba e5 14 00 00       	mov    $0x14e5,%edx
+    14e3:	0f 34                	sysenter
+    14e5:	c3                   	ret
+
+000014e6 <fcntl>:
+SYSCALL(fcntl)
+    14e6:	b8 33 00 00 00       	mov    $0x33,%eax
+    14eb:	89 e1                	mov    %esp,%ecx
+    14ed:	ba f4 14 00 00       	mov    $0x14f4,%edx
+    14f2:	0f 34                	sysenter
+    14f4:	c3                   	ret
+
+000014f5 <mount>:
+SYSCALL(mount)
+    14f5:	b8 34 00 00 00       	mov    $0x34,%eax
+    14fa:	89 e1                	mov    %esp,%ecx
+    14fc:	ba 03 15 00 00       	mov    $0x1503,%edx
+    1501:	0f 34                	sysenter
+    1503:	c3                   	ret
+
+00001504 <getdents>:
+SYSCALL(getdents)
+    1504:	b8 35 00 00 00       	mov    $0x35,%eax
+    1509:	89 e1                	mov    %esp,%ecx
+    150b:	ba 12 15 00 00       	mov    $0x1512,%edx
+    1510:	0f 34                	sysenter
+    1512:	c3                   	ret
+
+00001513 <fstatat>:
+SYSCALL(fstatat)
+    1513:	b8 36 00 00 00       	mov    $0x36,%eax
+    1518:	89 e1                	mov    %esp,%ecx
+    151a:	ba 21 15 00 00       	mov    $0x1521,%edx
+    151f:	0f 34                	sysenter
+    1521:	c3                   	ret
+
+00001522 <sysstat>:
+SYSCALL(sysstat)
+    1522:	b8 37 00 00 00       	mov    $0x37,%eax
+    1527:	89 e1                	mov    %esp,%ecx
+    1529:	ba 30 15 00 00       	mov    $0x1530,%edx
+    152e:	0f 34                	sysenter
+    1530:	c3                   	ret
+
+00001531 <ringenter>:
+SYSCALL(ringenter)
+    1531:	b8 38 00 00 00       	mov    $0x38,%eax
+    1536:	89 e1                	mov    %esp,%ecx
+    1538:	ba 3f 15 00 00       	mov    $0x153f,%edx
+    153d:	0f 34                	sysenter
+    153f:	c3                   	ret
+
+00001540 <trace>:
+SYSCALL(trace)
+    1540:	b8 39 00 00 00       	mov    $0x39,%eax
+    1545:	89 e1                	mov    %esp,%ecx
+    1547:	ba 4e 15 00 00       	mov    $0x154e,%edx
+    154c:	0f 34                	sysenter
+    154e:	c3                   	ret
+
+0000154f <memstat>:
+SYSCALL(memstat)
+    154f:	b8 3a 00 00 00       	mov    $0x3a,%eax
+    1554:	89 e1                	mov    %esp,%ecx
+    1556:	ba 5d 15 00 00       	mov    $0x155d,%edx
+    155b:	0f 34                	sysenter
+    155d:	c3                   	ret
+
+0000155e <shmget>:
+SYSCALL(shmget)
+    155e:	b8 3b 00 00 00       	mov    $0x3b,%eax
+    1563:	89 e1                	mov    %esp,%ecx
+    1565:	ba 6c 15 00 00       	mov    $0x156c,%edx
+    156a:	0f 34                	sysenter
+    156c:	c3                   	ret
+
+0000156d <shmat>:
+SYSCALL(shmat)
+    156d:	b8 3c 00 00 00       	mov    $0x3c,%eax
+    1572:	89 e1                	mov    %esp,%ecx
+    1574:	ba 7b 15 00 00       	mov    $0x157b,%edx
+    1579:	0f 34                	sysenter
+    157b:	c3                   	ret
+
+0000157c <shmdt>:
+SYSCALL(shmdt)
+    157c:	b8 3d 00 00 00       	mov    $0x3d,%eax
+    1581:	89 e1                	mov    %esp,%ecx
+    1583:	ba 8a 15 00 00       	mov    $0x158a,%edx
+    1588:	0f 34                	sysenter
+    158a:	c3                   	ret
+
+0000158b <irqstat>:
+SYSCALL(irqstat)
+    158b:	b8 3e 00 00 00       	mov    $0x3e,%eax
+    1590:	89 e1                	mov    %esp,%ecx
+    1592:	ba 99 15 00 00       	mov    $0x1599,%edx
+    1597:	0f 34                	sysenter
+    1599:	c3                   	ret
+
+0000159a <irqroute>:
+SYSCALL(irqroute)
+    159a:	b8 3f 00 00 00       	mov    $0x3f,%eax
+    159f:	89 e1                	mov    %esp,%ecx
+    15a1:	ba a8 15 00 00       	mov    $0x15a8,%edx
+    15a6:	0f 34                	sysenter
+    15a8:	c3                   	ret
+
+000015a9 <putc>:
+  char buf[64];
+};
+
+static void
+putc(struct out *o, char c)
+{
+    15a9:	55                   	push   %ebp
+    15aa:	89 e5                	mov    %esp,%ebp
+    15ac:	56                   	push   %esi
+    15ad:	53                   	push   %ebx
+    15ae:	89 c3                	mov    %eax,%ebx
+    15b0:	89 d6                	mov    %edx,%esi
+  if(o->n == sizeof(o->buf)){
+    15b2:	8b 40 04             	mov    0x4(%eax),%eax
+    15b5:	83 f8 40             	cmp    $0x40,%eax
+    15b8:	74 16                	je     15d0 <putc+0x27>
+    bufwrite(o->fd, o->buf, o->n);
+    o->n = 0;
+  }
+  o->buf[o->n++] = c;
+    15ba:	8b 43 04             	mov    0x4(%ebx),%eax
+    15bd:	8d 50 01             	lea    0x1(%eax),%edx
+    15c0:	89 53 04             	mov    %edx,0x4(%ebx)
+    15c3:	89 f1                	mov    %esi,%ecx
+    15c5:	88 4c 03 08          	mov    %cl,0x8(%ebx,%eax,1)
+}
+    15c9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    15cc:	5b                   	pop    %ebx
+    15cd:	5e                   	pop    %esi
+    15ce:	5d                   	pop    %ebp
+    15cf:	c3                   	ret
+    bufwrite(o->fd, o->buf, o->n);
+    15d0:	8d 53 08             	lea    0x8(%ebx),%edx
+    15d3:	83 ec 04             	sub    $0x4,%esp
+    15d6:	50                   	push   %eax
+    15d7:	52                   	push   %edx
+    15d8:	ff 33                	push   (%ebx)
+    15da:	e8 b2 f9 ff ff       	call   f91 <bufwrite>
+    o->n = 0;
+    15df:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    15e6:	83 c4 10             	add    $0x10,%esp
+    15e9:	eb cf                	jmp    15ba <putc+0x11>
+
+000015eb <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+    15eb:	55                   	push   %ebp
+    15ec:	89 e5                	mov    %esp,%ebp
+    15ee:	57                   	push   %edi
+    15ef:	56                   	push   %esi
+    15f0:	53                   	push   %ebx
+    15f1:	83 ec 2c             	sub    $0x2c,%esp
+    15f4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    15f7:	89 d0                	mov    %edx,%eax
+    15f9:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    15fb:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    15ff:	0f 95 c1             	setne  %cl
+    1602:	c1 ea 1f             	shr    $0x1f,%edx
+    1605:	84 d1                	test   %dl,%cl
+    1607:	74 44                	je     164d <printint+0x62>
+    neg = 1;
+    x = -xx;
+    1609:	f7 d8                	neg    %eax
+    160b:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+    160d:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1614:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+    1619:	89 c8                	mov    %ecx,%eax
+    161b:	ba 00 00 00 00       	mov    $0x0,%edx
+    1620:	f7 f6                	div    %esi
+    1622:	89 df                	mov    %ebx,%edi
+    1624:	83 c3 01             	add    $0x1,%ebx
+    1627:	0f b6 92 b8 1e 00 00 	movzbl 0x1eb8(%edx),%edx
+    162e:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+    1632:	89 ca                	mov    %ecx,%edx
+    1634:	89 c1                	mov    %eax,%ecx
+    1636:	39 f2                	cmp    %esi,%edx
+    1638:	73 df                	jae    1619 <printint+0x2e>
+  if(neg)
+    163a:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+    163e:	74 31                	je     1671 <printint+0x86>
+    buf[i++] = '-';
+    1640:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+    1645:	8d 5f 02             	lea    0x2(%edi),%ebx
+    1648:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    164b:	eb 17                	jmp    1664 <printint+0x79>
+    x = xx;
+    164d:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+    164f:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+    1656:	eb bc                	jmp    1614 <printint+0x29>
+
+  while(--i >= 0)
+    putc(o, buf[i]);
+    1658:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+    165d:	89 f0                	mov    %esi,%eax
+    165f:	e8 45 ff ff ff       	call   15a9 <putc>
+  while(--i >= 0)
+    1664:	83 eb 01             	sub    $0x1,%ebx
+    1667:	79 ef                	jns    1658 <printint+0x6d>
+}
+    1669:	83 c4 2c             	add    $0x2c,%esp
+    166c:	5b                   	pop    %ebx
+    166d:	5e                   	pop    %esi
+    166e:	5f                   	pop    %edi
+    166f:	5d                   	pop    %ebp
+    1670:	c3                   	ret
+    1671:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    1674:	eb ee                	jmp    1664 <printint+0x79>
+
+00001676 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1676:	55                   	push   %ebp
+    1677:	89 e5                	mov    %esp,%ebp
+    1679:	57                   	push   %edi
+    167a:	56                   	push   %esi
+    167b:	53                   	push   %ebx
+    167c:	83 ec 6c             	sub    $0x6c,%esp
+  int c, i, state;
+  uint *ap;
+  struct out out, *o;
+
+  o = &out;
+  o->fd = fd;
+    167f:	8b 45 08             	mov    0x8(%ebp),%eax
+    1682:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  o->n = 0;
+    1685:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+    168c:	8d 45 10             	lea    0x10(%ebp),%eax
+    168f:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  state = 0;
+    1692:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+    1697:	bb 00 00 00 00       	mov    $0x0,%ebx
+    169c:	eb 14                	jmp    16b2 <printf+0x3c>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(o, c);
+    169e:	89 fa                	mov    %edi,%edx
+    16a0:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    16a3:	e8 01 ff ff ff       	call   15a9 <putc>
+    16a8:	eb 05                	jmp    16af <printf+0x39>
+      }
+    } else if(state == '%'){
+    16aa:	83 fe 25             	cmp    $0x25,%esi
+    16ad:	74 25                	je     16d4 <printf+0x5e>
+  for(i = 0; fmt[i]; i++){
+    16af:	83 c3 01             	add    $0x1,%ebx
+    16b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+    16b5:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+    16b9:	84 c0                	test   %al,%al
+    16bb:	0f 84 20 01 00 00    	je     17e1 <printf+0x16b>
+    c = fmt[i] & 0xff;
+    16c1:	0f be f8             	movsbl %al,%edi
+    16c4:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    16c7:	85 f6                	test   %esi,%esi
+    16c9:	75 df                	jne    16aa <printf+0x34>
+      if(c == '%'){
+    16cb:	83 f8 25             	cmp    $0x25,%eax
+    16ce:	75 ce                	jne    169e <printf+0x28>
+        state = '%';
+    16d0:	89 c6                	mov    %eax,%esi
+    16d2:	eb db                	jmp    16af <printf+0x39>
+      if(c == 'd'){
+    16d4:	83 f8 25             	cmp    $0x25,%eax
+    16d7:	0f 84 cf 00 00 00    	je     17ac <printf+0x136>
+    16dd:	0f 8c dd 00 00 00    	jl     17c0 <printf+0x14a>
+    16e3:	83 f8 78             	cmp    $0x78,%eax
+    16e6:	0f 8f d4 00 00 00    	jg     17c0 <printf+0x14a>
+    16ec:	83 f8 63             	cmp    $0x63,%eax
+    16ef:	0f 8c cb 00 00 00    	jl     17c0 <printf+0x14a>
+    16f5:	83 e8 63             	sub    $0x63,%eax
+    16f8:	83 f8 15             	cmp    $0x15,%eax
+    16fb:	0f 87 bf 00 00 00    	ja     17c0 <printf+0x14a>
+    1701:	ff 24 85 60 1e 00 00 	jmp    *0x1e60(,%eax,4)
+        printint(o, *ap, 10, 1);
+    1708:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+    170b:	8b 17                	mov    (%edi),%edx
+    170d:	83 ec 0c             	sub    $0xc,%esp
+    1710:	6a 01                	push   $0x1
+    1712:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    1717:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    171a:	e8 cc fe ff ff       	call   15eb <printint>
+        ap++;
+    171f:	83 c7 04             	add    $0x4,%edi
+    1722:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+    1725:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(o, '%');
+        putc(o, c);
+      }
+      state = 0;
+    1728:	be 00 00 00 00       	mov    $0x0,%esi
+    172d:	eb 80                	jmp    16af <printf+0x39>
+        printint(o, *ap, 16, 0);
+    172f:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+    1732:	8b 17                	mov    (%edi),%edx
+    1734:	83 ec 0c             	sub    $0xc,%esp
+    1737:	6a 00                	push   $0x0
+    1739:	b9 10 00 00 00       	mov    $0x10,%ecx
+    173e:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    1741:	e8 a5 fe ff ff       	call   15eb <printint>
+        ap++;
+    1746:	83 c7 04             	add    $0x4,%edi
+    1749:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+    174c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    174f:	be 00 00 00 00       	mov    $0x0,%esi
+    1754:	e9 56 ff ff ff       	jmp    16af <printf+0x39>
+        s = (char*)*ap;
+    1759:	8b 45 94             	mov    -0x6c(%ebp),%eax
+    175c:	8b 30                	mov    (%eax),%esi
+        ap++;
+    175e:	83 c0 04             	add    $0x4,%eax
+    1761:	89 45 94             	mov    %eax,-0x6c(%ebp)
+        if(s == 0)
+    1764:	85 f6                	test   %esi,%esi
+    1766:	75 15                	jne    177d <printf+0x107>
+          s = "(null)";
+    1768:	be 58 1e 00 00       	mov    $0x1e58,%esi
+    176d:	eb 0e                	jmp    177d <printf+0x107>
+          putc(o, *s);
+    176f:	0f be d2             	movsbl %dl,%edx
+    1772:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    1775:	e8 2f fe ff ff       	call   15a9 <putc>
+          s++;
+    177a:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+    177d:	0f b6 16             	movzbl (%esi),%edx
+    1780:	84 d2                	test   %dl,%dl
+    1782:	75 eb                	jne    176f <printf+0xf9>
+      state = 0;
+    1784:	be 00 00 00 00       	mov    $0x0,%esi
+    1789:	e9 21 ff ff ff       	jmp    16af <printf+0x39>
+        putc(o, *ap);
+    178e:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+    1791:	0f be 17             	movsbl (%edi),%edx
+    1794:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    1797:	e8 0d fe ff ff       	call   15a9 <putc>
+        ap++;
+    179c:	83 c7 04             	add    $0x4,%edi
+    179f:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+      state = 0;
+    17a2:	be 00 00 00 00       	mov    $0x0,%esi
+    17a7:	e9 03 ff ff ff       	jmp    16af <printf+0x39>
+        putc(o, c);
+    17ac:	89 fa                	mov    %edi,%edx
+    17ae:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    17b1:	e8 f3 fd ff ff       	call   15a9 <putc>
+      state = 0;
+    17b6:	be 00 00 00 00       	mov    $0x0,%esi
+    17bb:	e9 ef fe ff ff       	jmp    16af <printf+0x39>
+        putc(o, '%');
+    17c0:	ba 25 00 00 00       	mov    $0x25,%edx
+    17c5:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    17c8:	e8 dc fd ff ff       	call   15a9 <putc>
+        putc(o, c);
+    17cd:	89 fa                	mov    %edi,%edx
+    17cf:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    17d2:	e8 d2 fd ff ff       	call   15a9 <putc>
+      state = 0;
+    17d7:	be 00 00 00 00       	mov    $0x0,%esi
+    17dc:	e9 ce fe ff ff       	jmp    16af <printf+0x39>
+    }
+  }
+  if(o->n > 0)
+    17e1:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    17e4:	85 c0                	test   %eax,%eax
+    17e6:	7f 08                	jg     17f0 <printf+0x17a>
+    bufwrite(fd, o->buf, o->n);
+}
+    17e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    17eb:	5b                   	pop    %ebx
+    17ec:	5e                   	pop    %esi
+    17ed:	5f                   	pop    %edi
+    17ee:	5d                   	pop    %ebp
+    17ef:	c3                   	ret
+    bufwrite(fd, o->buf, o->n);
+    17f0:	83 ec 04             	sub    $0x4,%esp
+    17f3:	50                   	push   %eax
+    17f4:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    17f7:	50                   	push   %eax
+    17f8:	ff 75 08             	push   0x8(%ebp)
+    17fb:	e8 91 f7 ff ff       	call   f91 <bufwrite>
+    1800:	83 c4 10             	add    $0x10,%esp
+}
+    1803:	eb e3                	jmp    17e8 <printf+0x172>
+
+00001805 <largefree>:
+  return &b->h;
+}
+
+static void
+largefree(Fblock *b)
+{
+    1805:	55                   	push   %ebp
+    1806:	89 e5                	mov    %esp,%ebp
+    1808:	57                   	push   %edi
+    1809:	56                   	push   %esi
+    180a:	53                   	push   %ebx
+    180b:	83 ec 0c             	sub    $0xc,%esp
+    180e:	89 c1                	mov    %eax,%ecx
+  Fblock **pp, *p, *prev;
+
+  prev = 0;
+    1810:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+    1815:	ba 0c 69 00 00       	mov    $0x690c,%edx
+    181a:	eb 05                	jmp    1821 <largefree+0x1c>
+    181c:	8d 50 08             	lea    0x8(%eax),%edx
+    prev = p;
+    181f:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+    1821:	8b 02                	mov    (%edx),%eax
+    1823:	85 c0                	test   %eax,%eax
+    1825:	74 04                	je     182b <largefree+0x26>
+    1827:	39 c8                	cmp    %ecx,%eax
+    1829:	72 f1                	jb     181c <largefree+0x17>
+  b->next = p;
+    182b:	89 41 08             	mov    %eax,0x8(%ecx)
+  if(p && (char*)b + b->h.size == (char*)p){
+    182e:	85 c0                	test   %eax,%eax
+    1830:	74 09                	je     183b <largefree+0x36>
+    1832:	8b 31                	mov    (%ecx),%esi
+    1834:	8d 3c 31             	lea    (%ecx,%esi,1),%edi
+    1837:	39 c7                	cmp    %eax,%edi
+    1839:	74 21                	je     185c <largefree+0x57>
+    b->h.size += p->h.size;
+    b->next = p->next;
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+    183b:	85 db                	test   %ebx,%ebx
+    183d:	74 09                	je     1848 <largefree+0x43>
+    183f:	8b 03                	mov    (%ebx),%eax
+    1841:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+    1844:	39 ce                	cmp    %ecx,%esi
+    1846:	74 20                	je     1868 <largefree+0x63>
+    prev->h.size += b->h.size;
+    prev->next = b->next;
+  } else
+    *pp = b;
+    1848:	89 0a                	mov    %ecx,(%edx)
+
+  // Give the top of the heap back.  With threads sharing the
+  // address space sbrk() cannot shrink it; keep the block then.
+  for(pp = &large; (*pp)->next; pp = &(*pp)->next)
+    184a:	be 0c 69 00 00       	mov    $0x690c,%esi
+    184f:	8b 1e                	mov    (%esi),%ebx
+    1851:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+    1855:	74 1d                	je     1874 <largefree+0x6f>
+    1857:	8d 73 08             	lea    0x8(%ebx),%esi
+    185a:	eb f3                	jmp    184f <largefree+0x4a>
+    b->h.size += p->h.size;
+    185c:	03 30                	add    (%eax),%esi
+    185e:	89 31                	mov    %esi,(%ecx)
+    b->next = p->next;
+    1860:	8b 40 08             	mov    0x8(%eax),%eax
+    1863:	89 41 08             	mov    %eax,0x8(%ecx)
+    1866:	eb d3                	jmp    183b <largefree+0x36>
+    prev->h.size += b->h.size;
+    1868:	03 01                	add    (%ecx),%eax
+    186a:	89 03                	mov    %eax,(%ebx)
+    prev->next = b->next;
+    186c:	8b 41 08             	mov    0x8(%ecx),%eax
+    186f:	89 43 08             	mov    %eax,0x8(%ebx)
+    1872:	eb d6                	jmp    184a <largefree+0x45>
+    ;
+  b = *pp;
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+    1874:	89 df                	mov    %ebx,%edi
+    1876:	03 3b                	add    (%ebx),%edi
+    1878:	83 ec 0c             	sub    $0xc,%esp
+    187b:	6a 00                	push   $0x0
+    187d:	e8 93 fa ff ff       	call   1315 <sbrk>
+    1882:	83 c4 10             	add    $0x10,%esp
+    1885:	39 c7                	cmp    %eax,%edi
+    1887:	74 08                	je     1891 <largefree+0x8c>
+    *pp = 0;
+}
+    1889:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    188c:	5b                   	pop    %ebx
+    188d:	5e                   	pop    %esi
+    188e:	5f                   	pop    %edi
+    188f:	5d                   	pop    %ebp
+    1890:	c3                   	ret
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+    1891:	8b 03                	mov    (%ebx),%eax
+    1893:	f7 d8                	neg    %eax
+    1895:	83 ec 0c             	sub    $0xc,%esp
+    1898:	50                   	push   %eax
+    1899:	e8 77 fa ff ff       	call   1315 <sbrk>
+    189e:	83 c4 10             	add    $0x10,%esp
+    18a1:	83 f8 ff             	cmp    $0xffffffff,%eax
+    18a4:	74 e3                	je     1889 <largefree+0x84>
+    *pp = 0;
+    18a6:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+    18ac:	eb db                	jmp    1889 <largefree+0x84>
+
+000018ae <more>:
+{
+    18ae:	55                   	push   %ebp
+    18af:	89 e5                	mov    %esp,%ebp
+    18b1:	56                   	push   %esi
+    18b2:	53                   	push   %ebx
+    18b3:	89 c6                	mov    %eax,%esi
+  pad = -(uint)sbrk(0) & 7;
+    18b5:	83 ec 0c             	sub    $0xc,%esp
+    18b8:	6a 00                	push   $0x0
+    18ba:	e8 56 fa ff ff       	call   1315 <sbrk>
+    18bf:	f7 d8                	neg    %eax
+    18c1:	89 c3                	mov    %eax,%ebx
+    18c3:	83 e3 07             	and    $0x7,%ebx
+  if((p = sbrk(n + pad)) == (char*)-1)
+    18c6:	01 de                	add    %ebx,%esi
+    18c8:	89 34 24             	mov    %esi,(%esp)
+    18cb:	e8 45 fa ff ff       	call   1315 <sbrk>
+    18d0:	83 c4 10             	add    $0x10,%esp
+    18d3:	83 f8 ff             	cmp    $0xffffffff,%eax
+    18d6:	74 09                	je     18e1 <more+0x33>
+  return p + pad;
+    18d8:	01 d8                	add    %ebx,%eax
+}
+    18da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    18dd:	5b                   	pop    %ebx
+    18de:	5e                   	pop    %esi
+    18df:	5d                   	pop    %ebp
+    18e0:	c3                   	ret
+    return 0;
+    18e1:	b8 00 00 00 00       	mov    $0x0,%eax
+    18e6:	eb f2                	jmp    18da <more+0x2c>
+
+000018e8 <slaballoc>:
+{
+    18e8:	55                   	push   %ebp
+    18e9:	89 e5                	mov    %esp,%ebp
+    18eb:	56                   	push   %esi
+    18ec:	53                   	push   %ebx
+    18ed:	89 c6                	mov    %eax,%esi
+  n = 1 << (MINSHIFT + c);
+    18ef:	8d 48 04             	lea    0x4(%eax),%ecx
+    18f2:	bb 01 00 00 00       	mov    $0x1,%ebx
+    18f7:	d3 e3                	shl    %cl,%ebx
+  if(slab + n > slabend){
+    18f9:	89 d8                	mov    %ebx,%eax
+    18fb:	03 05 08 69 00 00    	add    0x6908,%eax
+    1901:	39 05 04 69 00 00    	cmp    %eax,0x6904
+    1907:	72 17                	jb     1920 <slaballoc+0x38>
+  h = (Header*)slab;
+    1909:	a1 08 69 00 00       	mov    0x6908,%eax
+  slab += n;
+    190e:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+    1911:	89 15 08 69 00 00    	mov    %edx,0x6908
+  h->size = n;
+    1917:	89 18                	mov    %ebx,(%eax)
+  h->class = c;
+    1919:	89 70 04             	mov    %esi,0x4(%eax)
+}
+    191c:	5b                   	pop    %ebx
+    191d:	5e                   	pop    %esi
+    191e:	5d                   	pop    %ebp
+    191f:	c3                   	ret
+    if((p = more(SLABSZ)) == 0)
+    1920:	b8 00 40 00 00       	mov    $0x4000,%eax
+    1925:	e8 84 ff ff ff       	call   18ae <more>
+    192a:	85 c0                	test   %eax,%eax
+    192c:	74 ee                	je     191c <slaballoc+0x34>
+    if(p != slabend)
+    192e:	39 05 04 69 00 00    	cmp    %eax,0x6904
+    1934:	74 05                	je     193b <slaballoc+0x53>
+      slab = p;
+    1936:	a3 08 69 00 00       	mov    %eax,0x6908
+    slabend = p + SLABSZ;
+    193b:	05 00 40 00 00       	add    $0x4000,%eax
+    1940:	a3 04 69 00 00       	mov    %eax,0x6904
+    1945:	eb c2                	jmp    1909 <slaballoc+0x21>
+
+00001947 <largealloc>:
+{
+    1947:	55                   	push   %ebp
+    1948:	89 e5                	mov    %esp,%ebp
+    194a:	56                   	push   %esi
+    194b:	53                   	push   %ebx
+    194c:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+    194e:	b9 0c 69 00 00       	mov    $0x690c,%ecx
+    1953:	8b 01                	mov    (%ecx),%eax
+    1955:	85 c0                	test   %eax,%eax
+    1957:	74 36                	je     198f <largealloc+0x48>
+    if(b->h.size < n)
+    1959:	8b 10                	mov    (%eax),%edx
+    195b:	39 da                	cmp    %ebx,%edx
+    195d:	72 24                	jb     1983 <largealloc+0x3c>
+    if(b->h.size - n > SMALLMAX){
+    195f:	29 da                	sub    %ebx,%edx
+    1961:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+    1967:	76 1f                	jbe    1988 <largealloc+0x41>
+      rest = (Fblock*)((char*)b + n);
+    1969:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+      rest->h.size = b->h.size - n;
+    196c:	89 16                	mov    %edx,(%esi)
+      rest->h.class = LARGE;
+    196e:	c7 46 04 09 00 00 00 	movl   $0x9,0x4(%esi)
+      rest->next = b->next;
+    1975:	8b 50 08             	mov    0x8(%eax),%edx
+    1978:	89 56 08             	mov    %edx,0x8(%esi)
+      *pp = rest;
+    197b:	89 31                	mov    %esi,(%ecx)
+      b->h.size = n;
+    197d:	89 18                	mov    %ebx,(%eax)
+}
+    197f:	5b                   	pop    %ebx
+    1980:	5e                   	pop    %esi
+    1981:	5d                   	pop    %ebp
+    1982:	c3                   	ret
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+    1983:	8d 48 08             	lea    0x8(%eax),%ecx
+    1986:	eb cb                	jmp    1953 <largealloc+0xc>
+      *pp = b->next;
+    1988:	8b 50 08             	mov    0x8(%eax),%edx
+    198b:	89 11                	mov    %edx,(%ecx)
+    return &b->h;
+    198d:	eb f0                	jmp    197f <largealloc+0x38>
+  if((b = more(n)) == 0)
+    198f:	89 d8                	mov    %ebx,%eax
+    1991:	e8 18 ff ff ff       	call   18ae <more>
+    1996:	85 c0                	test   %eax,%eax
+    1998:	74 e5                	je     197f <largealloc+0x38>
+  b->h.size = n;
+    199a:	89 18                	mov    %ebx,(%eax)
+  b->h.class = LARGE;
+    199c:	c7 40 04 09 00 00 00 	movl   $0x9,0x4(%eax)
+  return &b->h;
+    19a3:	eb da                	jmp    197f <largealloc+0x38>
+
+000019a5 <free>:
+
+void
+free(void *ap)
+{
+    19a5:	55                   	push   %ebp
+    19a6:	89 e5                	mov    %esp,%ebp
+    19a8:	56                   	push   %esi
+    19a9:	53                   	push   %ebx
+    19aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+
+  if(ap == 0)
+    19ad:	85 db                	test   %ebx,%ebx
+    19af:	74 3b                	je     19ec <free+0x47>
+    return;
+  h = (Header*)ap - 1;
+    19b1:	8d 73 f8             	lea    -0x8(%ebx),%esi
+  lock_acquire(&lock);
+    19b4:	83 ec 0c             	sub    $0xc,%esp
+    19b7:	68 00 69 00 00       	push   $0x6900
+    19bc:	e8 9c 01 00 00       	call   1b5d <lock_acquire>
+  if(h->class == LARGE)
+    19c1:	8b 43 fc             	mov    -0x4(%ebx),%eax
+    19c4:	83 c4 10             	add    $0x10,%esp
+    19c7:	83 f8 09             	cmp    $0x9,%eax
+    19ca:	74 27                	je     19f3 <free+0x4e>
+    largefree((Fblock*)h);
+  else {
+    ((Fblock*)h)->next = freelist[h->class];
+    19cc:	8b 14 85 20 69 00 00 	mov    0x6920(,%eax,4),%edx
+    19d3:	89 13                	mov    %edx,(%ebx)
+    freelist[h->class] = (Fblock*)h;
+    19d5:	89 34 85 20 69 00 00 	mov    %esi,0x6920(,%eax,4)
+  }
+  lock_release(&lock);
+    19dc:	83 ec 0c             	sub    $0xc,%esp
+    19df:	68 00 69 00 00       	push   $0x6900
+    19e4:	e8 88 01 00 00       	call   1b71 <lock_release>
+    19e9:	83 c4 10             	add    $0x10,%esp
+}
+    19ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    19ef:	5b                   	pop    %ebx
+    19f0:	5e                   	pop    %esi
+    19f1:	5d                   	pop    %ebp
+    19f2:	c3                   	ret
+    largefree((Fblock*)h);
+    19f3:	89 f0                	mov    %esi,%eax
+    19f5:	e8 0b fe ff ff       	call   1805 <largefree>
+    19fa:	eb e0                	jmp    19dc <free+0x37>
+
+000019fc <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    19fc:	55                   	push   %ebp
+    19fd:	89 e5                	mov    %esp,%ebp
+    19ff:	53                   	push   %ebx
+    1a00:	83 ec 04             	sub    $0x4,%esp
+    1a03:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+  uint n;
+  int c;
+
+  if(nbytes > 0x7fffffff - sizeof(Header) - 7)
+    1a06:	81 fb f0 ff ff 7f    	cmp    $0x7ffffff0,%ebx
+    1a0c:	0f 87 8b 00 00 00    	ja     1a9d <malloc+0xa1>
+    return 0;
+  n = (nbytes + sizeof(Header) + 7) & ~7;
+    1a12:	83 c3 0f             	add    $0xf,%ebx
+    1a15:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(n < sizeof(Fblock))
+    1a18:	83 fb 0b             	cmp    $0xb,%ebx
+    1a1b:	77 05                	ja     1a22 <malloc+0x26>
+    n = sizeof(Fblock);
+    1a1d:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  lock_acquire(&lock);
+    1a22:	83 ec 0c             	sub    $0xc,%esp
+    1a25:	68 00 69 00 00       	push   $0x6900
+    1a2a:	e8 2e 01 00 00       	call   1b5d <lock_acquire>
+  if(n <= SMALLMAX){
+    1a2f:	83 c4 10             	add    $0x10,%esp
+    1a32:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+    1a38:	77 58                	ja     1a92 <malloc+0x96>
+    for(c = 0; (1 << (MINSHIFT + c)) < n; c++)
+    1a3a:	ba 00 00 00 00       	mov    $0x0,%edx
+    1a3f:	eb 03                	jmp    1a44 <malloc+0x48>
+    1a41:	83 c2 01             	add    $0x1,%edx
+    1a44:	8d 4a 04             	lea    0x4(%edx),%ecx
+    1a47:	b8 01 00 00 00       	mov    $0x1,%eax
+    1a4c:	d3 e0                	shl    %cl,%eax
+    1a4e:	39 d8                	cmp    %ebx,%eax
+    1a50:	72 ef                	jb     1a41 <malloc+0x45>
+      ;
+    if(freelist[c]){
+    1a52:	8b 04 95 20 69 00 00 	mov    0x6920(,%edx,4),%eax
+    1a59:	85 c0                	test   %eax,%eax
+    1a5b:	74 2a                	je     1a87 <malloc+0x8b>
+      h = &freelist[c]->h;
+    1a5d:	89 c3                	mov    %eax,%ebx
+      freelist[c] = freelist[c]->next;
+    1a5f:	8b 40 08             	mov    0x8(%eax),%eax
+    1a62:	89 04 95 20 69 00 00 	mov    %eax,0x6920(,%edx,4)
+    } else
+      h = slaballoc(c);
+  } else
+    h = largealloc(n);
+  lock_release(&lock);
+    1a69:	83 ec 0c             	sub    $0xc,%esp
+    1a6c:	68 00 69 00 00       	push   $0x6900
+    1a71:	e8 fb 00 00 00       	call   1b71 <lock_release>
+  return h ? (void*)(h + 1) : 0;
+    1a76:	83 c4 10             	add    $0x10,%esp
+    1a79:	85 db                	test   %ebx,%ebx
+    1a7b:	74 03                	je     1a80 <malloc+0x84>
+    1a7d:	83 c3 08             	add    $0x8,%ebx
+}
+    1a80:	89 d8                	mov    %ebx,%eax
+    1a82:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1a85:	c9                   	leave
+    1a86:	c3                   	ret
+      h = slaballoc(c);
+    1a87:	89 d0                	mov    %edx,%eax
+    1a89:	e8 5a fe ff ff       	call   18e8 <slaballoc>
+    1a8e:	89 c3                	mov    %eax,%ebx
+    1a90:	eb d7                	jmp    1a69 <malloc+0x6d>
+    h = largealloc(n);
+    1a92:	89 d8                	mov    %ebx,%eax
+    1a94:	e8 ae fe ff ff       	call   1947 <largealloc>
+    1a99:	89 c3                	mov    %eax,%ebx
+    1a9b:	eb cc                	jmp    1a69 <malloc+0x6d>
+    return 0;
+    1a9d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1aa2:	eb dc                	jmp    1a80 <malloc+0x84>
+
+00001aa4 <tstart>:
+  void *arg;
+};
+
+static void
+tstart(void *a)
+{
+    1aa4:	55                   	push   %ebp
+    1aa5:	89 e5                	mov    %esp,%ebp
+    1aa7:	83 ec 14             	sub    $0x14,%esp
+    1aaa:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+    1aad:	ff 70 04             	push   0x4(%eax)
+    1ab0:	ff 10                	call   *(%eax)
+  exit();
+    1ab2:	e8 86 f6 ff ff       	call   113d <exit>
+
+00001ab7 <thread_create>:
+}
+
+// Run fn(arg) in a new thread.  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1ab7:	55                   	push   %ebp
+    1ab8:	89 e5                	mov    %esp,%ebp
+    1aba:	56                   	push   %esi
+    1abb:	53                   	push   %ebx
+  struct tstart *t;
+  char *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    1abc:	83 ec 0c             	sub    $0xc,%esp
+    1abf:	68 00 10 00 00       	push   $0x1000
+    1ac4:	e8 33 ff ff ff       	call   19fc <malloc>
+    1ac9:	83 c4 10             	add    $0x10,%esp
+    1acc:	85 c0                	test   %eax,%eax
+    1ace:	74 42                	je     1b12 <thread_create+0x5b>
+    1ad0:	89 c3                	mov    %eax,%ebx
+    return -1;
+  t = (struct tstart*)stack;
+  t->fn = fn;
+    1ad2:	8b 45 08             	mov    0x8(%ebp),%eax
+    1ad5:	89 03                	mov    %eax,(%ebx)
+  t->arg = arg;
+    1ad7:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1ada:	89 43 04             	mov    %eax,0x4(%ebx)
+  if((pid = clone(tstart, stack + TSTACK, t)) < 0)
+    1add:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    1ae3:	83 ec 04             	sub    $0x4,%esp
+    1ae6:	53                   	push   %ebx
+    1ae7:	50                   	push   %eax
+    1ae8:	68 a4 1a 00 00       	push   $0x1aa4
+    1aed:	e8 f5 f8 ff ff       	call   13e7 <clone>
+    1af2:	89 c6                	mov    %eax,%esi
+    1af4:	83 c4 10             	add    $0x10,%esp
+    1af7:	85 c0                	test   %eax,%eax
+    1af9:	78 09                	js     1b04 <thread_create+0x4d>
+    free(stack);
+  return pid;
+}
+    1afb:	89 f0                	mov    %esi,%eax
+    1afd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1b00:	5b                   	pop    %ebx
+    1b01:	5e                   	pop    %esi
+    1b02:	5d                   	pop    %ebp
+    1b03:	c3                   	ret
+    free(stack);
+    1b04:	83 ec 0c             	sub    $0xc,%esp
+    1b07:	53                   	push   %ebx
+    1b08:	e8 98 fe ff ff       	call   19a5 <free>
+    1b0d:	83 c4 10             	add    $0x10,%esp
+    1b10:	eb e9                	jmp    1afb <thread_create+0x44>
+    return -1;
+    1b12:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1b17:	eb e2                	jmp    1afb <thread_create+0x44>
+
+00001b19 <thread_join>:
+
+// Wait for one of this process's threads to exit and free its
+// stack.  Returns its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+    1b19:	55                   	push   %ebp
+    1b1a:	89 e5                	mov    %esp,%ebp
+    1b1c:	53                   	push   %ebx
+    1b1d:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    1b20:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1b23:	50                   	push   %eax
+    1b24:	e8 cd f8 ff ff       	call   13f6 <join>
+    1b29:	89 c3                	mov    %eax,%ebx
+    1b2b:	83 c4 10             	add    $0x10,%esp
+    1b2e:	85 c0                	test   %eax,%eax
+    1b30:	79 07                	jns    1b39 <thread_join+0x20>
+    free((char*)stack - TSTACK);
+  return pid;
+}
+    1b32:	89 d8                	mov    %ebx,%eax
+    1b34:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1b37:	c9                   	leave
+    1b38:	c3                   	ret
+    free((char*)stack - TSTACK);
+    1b39:	83 ec 0c             	sub    $0xc,%esp
+    1b3c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1b3f:	2d 00 10 00 00       	sub    $0x1000,%eax
+    1b44:	50                   	push   %eax
+    1b45:	e8 5b fe ff ff       	call   19a5 <free>
+    1b4a:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    1b4d:	eb e3                	jmp    1b32 <thread_join+0x19>
+
+00001b4f <lock_init>:
+
+void
+lock_init(lock_t *lk)
+{
+    1b4f:	55                   	push   %ebp
+    1b50:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    1b52:	8b 45 08             	mov    0x8(%ebp),%eax
+    1b55:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1b5b:	5d                   	pop    %ebp
+    1b5c:	c3                   	ret
+
+00001b5d <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+    1b5d:	55                   	push   %ebp
+    1b5e:	89 e5                	mov    %esp,%ebp
+    1b60:	8b 55 08             	mov    0x8(%ebp),%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    1b63:	b8 01 00 00 00       	mov    $0x1,%eax
+    1b68:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    1b6b:	85 c0                	test   %eax,%eax
+    1b6d:	75 f4                	jne    1b63 <lock_acquire+0x6>
+    ;
+}
+    1b6f:	5d                   	pop    %ebp
+    1b70:	c3                   	ret
+
+00001b71 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+    1b71:	55                   	push   %ebp
+    1b72:	89 e5                	mov    %esp,%ebp
+    1b74:	8b 55 08             	mov    0x8(%ebp),%edx
+    1b77:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b7c:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    1b7f:	5d                   	pop    %ebp
+    1b80:	c3                   	ret
+
+00001b81 <mutex_init>:
+// Are Tricky": state is 0 when free, 1 when held, 2 when held and
+// others may be waiting.  Unlocking an uncontended mutex costs no
+// system call.
+void
+mutex_init(mutex_t *m)
+{
+    1b81:	55                   	push   %ebp
+    1b82:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    1b84:	8b 45 08             	mov    0x8(%ebp),%eax
+    1b87:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1b8d:	5d                   	pop    %ebp
+    1b8e:	c3                   	ret
+
+00001b8f <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+    1b8f:	55                   	push   %ebp
+    1b90:	89 e5                	mov    %esp,%ebp
+    1b92:	53                   	push   %ebx
+    1b93:	83 ec 04             	sub    $0x4,%esp
+    1b96:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    1b99:	b8 00 00 00 00       	mov    $0x0,%eax
+    1b9e:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1ba3:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    1ba7:	85 c0                	test   %eax,%eax
+    1ba9:	74 29                	je     1bd4 <mutex_lock+0x45>
+    return;
+  if(c != 2)
+    1bab:	83 f8 02             	cmp    $0x2,%eax
+    1bae:	74 20                	je     1bd0 <mutex_lock+0x41>
+    1bb0:	b8 02 00 00 00       	mov    $0x2,%eax
+    1bb5:	f0 87 03             	lock xchg %eax,(%ebx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    1bb8:	eb 16                	jmp    1bd0 <mutex_lock+0x41>
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    1bba:	83 ec 08             	sub    $0x8,%esp
+    1bbd:	6a 02                	push   $0x2
+    1bbf:	53                   	push   %ebx
+    1bc0:	e8 40 f8 ff ff       	call   1405 <futex_wait>
+  asm volatile("lock; xchgl %0, %1" :
+    1bc5:	b8 02 00 00 00       	mov    $0x2,%eax
+    1bca:	f0 87 03             	lock xchg %eax,(%ebx)
+    1bcd:	83 c4 10             	add    $0x10,%esp
+  while(c != 0){
+    1bd0:	85 c0                	test   %eax,%eax
+    1bd2:	75 e6                	jne    1bba <mutex_lock+0x2b>
+    c = xchg(&m->state, 2);
+  }
+}
+    1bd4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1bd7:	c9                   	leave
+    1bd8:	c3                   	ret
+
+00001bd9 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+    1bd9:	55                   	push   %ebp
+    1bda:	89 e5                	mov    %esp,%ebp
+    1bdc:	83 ec 08             	sub    $0x8,%esp
+    1bdf:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    1be2:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    1be7:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    1beb:	83 fa 01             	cmp    $0x1,%edx
+    1bee:	75 02                	jne    1bf2 <mutex_unlock+0x19>
+    m->state = 0;
+    futex_wake(&m->state, 1);
+  }
+}
+    1bf0:	c9                   	leave
+    1bf1:	c3                   	ret
+    m->state = 0;
+    1bf2:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+    1bf8:	83 ec 08             	sub    $0x8,%esp
+    1bfb:	6a 01                	push   $0x1
+    1bfd:	50                   	push   %eax
+    1bfe:	e8 11 f8 ff ff       	call   1414 <futex_wake>
+    1c03:	83 c4 10             	add    $0x10,%esp
+}
+    1c06:	eb e8                	jmp    1bf0 <mutex_unlock+0x17>
+
+00001c08 <cond_init>:
+// Condition variable: waiters sleep on a sequence number that
+// every signal bumps, so a signal between the unlock and the
+// futex_wait() in cond_wait() is not lost.
+void
+cond_init(cond_t *c)
+{
+    1c08:	55                   	push   %ebp
+    1c09:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    1c0b:	8b 45 08             	mov    0x8(%ebp),%eax
+    1c0e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1c14:	5d                   	pop    %ebp
+    1c15:	c3                   	ret
+
+00001c16 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+    1c16:	55                   	push   %ebp
+    1c17:	89 e5                	mov    %esp,%ebp
+    1c19:	57                   	push   %edi
+    1c1a:	56                   	push   %esi
+    1c1b:	53                   	push   %ebx
+    1c1c:	83 ec 18             	sub    $0x18,%esp
+    1c1f:	8b 75 08             	mov    0x8(%ebp),%esi
+    1c22:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    1c25:	8b 3e                	mov    (%esi),%edi
+  mutex_unlock(m);
+    1c27:	53                   	push   %ebx
+    1c28:	e8 ac ff ff ff       	call   1bd9 <mutex_unlock>
+  futex_wait(&c->seq, seq);
+    1c2d:	83 c4 08             	add    $0x8,%esp
+    1c30:	57                   	push   %edi
+    1c31:	56                   	push   %esi
+    1c32:	e8 ce f7 ff ff       	call   1405 <futex_wait>
+  // Others may be waiting for m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+    1c37:	83 c4 10             	add    $0x10,%esp
+    1c3a:	eb 0e                	jmp    1c4a <cond_wait+0x34>
+    futex_wait(&m->state, 2);
+    1c3c:	83 ec 08             	sub    $0x8,%esp
+    1c3f:	6a 02                	push   $0x2
+    1c41:	53                   	push   %ebx
+    1c42:	e8 be f7 ff ff       	call   1405 <futex_wait>
+    1c47:	83 c4 10             	add    $0x10,%esp
+    1c4a:	b8 02 00 00 00       	mov    $0x2,%eax
+    1c4f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    1c52:	85 c0                	test   %eax,%eax
+    1c54:	75 e6                	jne    1c3c <cond_wait+0x26>
+}
+    1c56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1c59:	5b                   	pop    %ebx
+    1c5a:	5e                   	pop    %esi
+    1c5b:	5f                   	pop    %edi
+    1c5c:	5d                   	pop    %ebp
+    1c5d:	c3                   	ret
+
+00001c5e <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+    1c5e:	55                   	push   %ebp
+    1c5f:	89 e5                	mov    %esp,%ebp
+    1c61:	83 ec 10             	sub    $0x10,%esp
+    1c64:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    1c67:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+    1c6b:	6a 01                	push   $0x1
+    1c6d:	50                   	push   %eax
+    1c6e:	e8 a1 f7 ff ff       	call   1414 <futex_wake>
+}
+    1c73:	83 c4 10             	add    $0x10,%esp
+    1c76:	c9                   	leave
+    1c77:	c3                   	ret
+
+00001c78 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+    1c78:	55                   	push   %ebp
+    1c79:	89 e5                	mov    %esp,%ebp
+    1c7b:	83 ec 10             	sub    $0x10,%esp
+    1c7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    1c81:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, NPROC);
+    1c85:	6a 40                	push   $0x40
+    1c87:	50                   	push   %eax
+    1c88:	e8 87 f7 ff ff       	call   1414 <futex_wake>
+}
+    1c8d:	83 c4 10             	add    $0x10,%esp
+    1c90:	c9                   	leave
+    1c91:	c3                   	ret
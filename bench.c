@@ -0,0 +1,360 @@
+// bench: time the basic operations of the kernel, lmbench style.
+// "bench" runs every benchmark, "bench name..." only those named.
+// Each result is one line, "name value unit", for scripts to
+// compare release to release.  Times come from the clock page
+// (vclock_gettime()), so reading the clock costs no system call.
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "clock.h"
+
+#define FILESZ  (1024*1024)    // Bytes of the file benchmarks' file
+#define BLK     512
+#define NDEPTH  8              // Directories of the deepest lookup
+
+static char buf[8192];
+static char *self;             // argv[0], for fork_exec
+
+// Microseconds since boot.  Wraps after 71 minutes, which the
+// differences taken here survive.
+static uint
+usec(void)
+{
+  struct timespec ts;
+
+  vclock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec*1000000 + ts.tv_nsec/1000;
+}
+
+static void
+result(char *name, uint value, char *unit)
+{
+  printf(1, "%s %d %s\n", name, value, unit);
+}
+
+// ns per operation, for n operations that took us microseconds.
+static uint
+perop(uint us, uint n)
+{
+  return us/n*1000 + us%n*1000/n;
+}
+
+// KB per second, for n bytes moved in us microseconds.
+static uint
+rate(uint n, uint us)
+{
+  if(us < 1000)
+    us = 1000;
+  return n/1024*1000 / (us/1000);
+}
+
+static void
+fail(char *what)
+{
+  printf(2, "bench: %s failed\n", what);
+  exit();
+}
+
+static void
+nullsys(void)
+{
+  uint t, i, n = 20000;
+
+  t = usec();
+  for(i = 0; i < n; i++)
+    getpid();
+  result("null_syscall", perop(usec() - t, n), "ns");
+}
+
+static void
+forkwait(void)
+{
+  uint t, i, n = 200;
+  int pid;
+
+  t = usec();
+  for(i = 0; i < n; i++){
+    if((pid = fork()) < 0)
+      fail("fork");
+    if(pid == 0)
+      exit();
+    wait();
+  }
+  result("fork_exit_wait", perop(usec() - t, n) / 1000, "us");
+}
+
+static void
+forkexec(void)
+{
+  char *argv[] = { self, "-exit", 0 };
+  uint t, i, n = 50;
+  int pid;
+
+  t = usec();
+  for(i = 0; i < n; i++){
+    if((pid = fork()) < 0)
+      fail("fork");
+    if(pid == 0){
+      exec(self, argv);
+      fail("exec");
+    }
+    wait();
+  }
+  result("fork_exec", perop(usec() - t, n) / 1000, "us");
+}
+
+// Lazy heap: the first touch of each page faults it in.
+static void
+sbrkfault(void)
+{
+  uint t, i, n = 512;
+  char *a;
+
+  if((a = sbrk(n*4096)) == (char*)-1)
+    fail("sbrk");
+  t = usec();
+  for(i = 0; i < n; i++)
+    a[i*4096] = 1;
+  result("sbrk_fault", perop(usec() - t, n), "ns/page");
+  sbrk(-n*4096);
+}
+
+static void
+pipebw(void)
+{
+  uint t, tot, n = 4*1024*1024;
+  int fds[2], m;
+
+  if(pipe(fds) < 0)
+    fail("pipe");
+  t = usec();
+  if(fork() == 0){
+    close(fds[0]);
+    for(tot = 0; tot < n; tot += sizeof(buf))
+      if(write(fds[1], buf, sizeof(buf)) != sizeof(buf))
+        fail("pipe write");
+    exit();
+  }
+  close(fds[1]);
+  for(tot = 0; (m = read(fds[0], buf, sizeof(buf))) > 0; tot += m)
+    ;
+  wait();
+  t = usec() - t;
+  close(fds[0]);
+  if(tot != n)
+    fail("pipe read");
+  result("pipe_bw", rate(n, t), "KB/s");
+}
+
+// One byte there and back again over two pipes.
+static void
+pingpong(void)
+{
+  uint t, i, n = 2000;
+  int p[2], q[2];
+  char c;
+
+  if(pipe(p) < 0 || pipe(q) < 0)
+    fail("pipe");
+  if(fork() == 0){
+    for(i = 0; i < n; i++)
+      if(read(p[0], &c, 1) != 1 || write(q[1], &c, 1) != 1)
+        fail("pong");
+    exit();
+  }
+  t = usec();
+  for(i = 0; i < n; i++)
+    if(write(p[1], "x", 1) != 1 || read(q[0], &c, 1) != 1)
+      fail("ping");
+  t = usec() - t;
+  wait();
+  close(p[0]);
+  close(p[1]);
+  close(q[0]);
+  close(q[1]);
+  result("pipe_pingpong", perop(t, n), "ns");
+}
+
+// The block benchmarks' file, FILESZ bytes of it, open for
+// reading and writing.
+static int
+benchfile(void)
+{
+  int fd, i;
+
+  if((fd = open("benchf", O_CREATE|O_RDWR)) < 0)
+    fail("create");
+  for(i = 0; i < FILESZ; i += sizeof(buf))
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf))
+      fail("write");
+  return fd;
+}
+
+// Simple LCG for the random block numbers.
+static uint seed = 1;
+
+static uint
+rnd(void)
+{
+  seed = seed * 1103515245 + 12345;
+  return seed >> 8;
+}
+
+// A block that is cached, read over and over.
+static void
+breadhit(void)
+{
+  uint t, i, n = 5000;
+  int fd;
+
+  fd = benchfile();
+  pread(fd, buf, BLK, 0);
+  t = usec();
+  for(i = 0; i < n; i++)
+    if(pread(fd, buf, BLK, 0) != BLK)
+      fail("pread");
+  result("bread_hit", perop(usec() - t, n), "ns");
+  close(fd);
+  unlink("benchf");
+}
+
+static void
+fileseq(void)
+{
+  uint t;
+  int fd, i;
+
+  t = usec();
+  fd = benchfile();
+  fsync(fd);
+  result("file_seq_write", rate(FILESZ, usec() - t), "KB/s");
+  t = usec();
+  for(i = 0; i < FILESZ; i += sizeof(buf))
+    if(pread(fd, buf, sizeof(buf), i) != sizeof(buf))
+      fail("pread");
+  result("file_seq_read", rate(FILESZ, usec() - t), "KB/s");
+  close(fd);
+  unlink("benchf");
+}
+
+static void
+filerand(void)
+{
+  uint t, i, n = FILESZ/BLK;
+  int fd;
+
+  fd = benchfile();
+  fsync(fd);
+  t = usec();
+  for(i = 0; i < n; i++)
+    if(pwrite(fd, buf, BLK, rnd() % n * BLK) != BLK)
+      fail("pwrite");
+  fsync(fd);
+  result("file_rand_write", rate(n*BLK, usec() - t), "KB/s");
+  t = usec();
+  for(i = 0; i < n; i++)
+    if(pread(fd, buf, BLK, rnd() % n * BLK) != BLK)
+      fail("pread");
+  result("file_rand_read", rate(n*BLK, usec() - t), "KB/s");
+  close(fd);
+  unlink("benchf");
+}
+
+static void
+createunlink(void)
+{
+  uint t, i, n = 200;
+  char name[8];
+  int fd;
+
+  name[0] = 'b';
+  name[1] = 'c';
+  name[4] = 0;
+  t = usec();
+  for(i = 0; i < n; i++){
+    name[2] = 'a' + i/26%26;
+    name[3] = 'a' + i%26;
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0)
+      fail("create");
+    close(fd);
+    if(unlink(name) < 0)
+      fail("unlink");
+  }
+  result("create_unlink", perop(usec() - t, n) / 1000, "us");
+}
+
+// stat() of a file 1 and NDEPTH directories down.
+static void
+lookup(void)
+{
+  char path[3*NDEPTH + 8];
+  struct stat st;
+  uint t, i, n = 2000;
+  int d, fd;
+
+  for(d = 0; d < NDEPTH; d++){
+    path[3*d] = 'l';
+    path[3*d+1] = '0' + d;
+    path[3*d+2] = 0;
+    if(mkdir(path) < 0)
+      fail("mkdir");
+    path[3*d+2] = '/';
+  }
+  strcpy(path + 3*NDEPTH, "f");
+  if((fd = open(path, O_CREATE|O_RDWR)) < 0)
+    fail("create");
+  close(fd);
+
+  t = usec();
+  for(i = 0; i < n; i++)
+    if(stat("l0", &st) < 0)
+      fail("stat");
+  result("lookup_depth1", perop(usec() - t, n), "ns");
+  t = usec();
+  for(i = 0; i < n; i++)
+    if(stat(path, &st) < 0)
+      fail("stat");
+  result("lookup_depth9", perop(usec() - t, n), "ns");
+
+  unlink(path);
+  for(d = NDEPTH-1; d >= 0; d--){
+    path[3*d+2] = 0;
+    unlink(path);
+  }
+}
+
+static struct {
+  char *name;
+  void (*fn)(void);
+} benches[] = {
+  { "null",     nullsys },
+  { "fork",     forkwait },
+  { "exec",     forkexec },
+  { "sbrk",     sbrkfault },
+  { "pipe",     pipebw },
+  { "pingpong", pingpong },
+  { "bread",    breadhit },
+  { "seq",      fileseq },
+  { "rand",     filerand },
+  { "create",   createunlink },
+  { "lookup",   lookup },
+};
+
+int
+main(int argc, char *argv[])
+{
+  int i, j;
+
+  if(argc > 1 && strcmp(argv[1], "-exit") == 0)
+    exit();
+  self = argv[0];
+  memset(buf, 'b', sizeof(buf));
+  for(i = 0; i < sizeof(benches)/sizeof(benches[0]); i++){
+    for(j = 1; j < argc && strcmp(argv[j], benches[i].name) != 0; j++)
+      ;
+    if(argc == 1 || j < argc)
+      benches[i].fn();
+  }
+  exit();
+}
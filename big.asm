@@ -0,0 +1,2859 @@
+
+_big:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "user.h"
+#include "fcntl.h"
+
+int 
+main()
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	81 ec 10 02 00 00    	sub    $0x210,%esp
+  char buf[512];
+  int fd, i, sectors;
+
+  fd = open("big.file", O_CREATE | O_WRONLY);
+      17:	68 01 02 00 00       	push   $0x201
+      1c:	68 dc 12 00 00       	push   $0x12dc
+      21:	e8 b2 08 00 00       	call   8d8 <open>
+  if(fd < 0){
+      26:	83 c4 10             	add    $0x10,%esp
+      29:	85 c0                	test   %eax,%eax
+      2b:	78 5a                	js     87 <main+0x87>
+      2d:	89 c6                	mov    %eax,%esi
+    printf(2, "big: cannot open big.file for writing\n");
+    exit();
+  }
+
+  sectors = 0;
+      2f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  while(1){
+    *(int*)buf = sectors;
+      34:	89 9d e8 fd ff ff    	mov    %ebx,-0x218(%ebp)
+    int cc = write(fd, buf, sizeof(buf));
+      3a:	83 ec 04             	sub    $0x4,%esp
+      3d:	68 00 02 00 00       	push   $0x200
+      42:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+      48:	50                   	push   %eax
+      49:	56                   	push   %esi
+      4a:	e8 6b 08 00 00       	call   8ba <write>
+    if(cc <= 0)
+      4f:	83 c4 10             	add    $0x10,%esp
+      52:	85 c0                	test   %eax,%eax
+      54:	7e 45                	jle    9b <main+0x9b>
+      break;
+    sectors++;
+      56:	83 c3 01             	add    $0x1,%ebx
+	if (sectors % 100 == 0)
+      59:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+      5e:	89 d8                	mov    %ebx,%eax
+      60:	f7 ea                	imul   %edx
+      62:	c1 fa 05             	sar    $0x5,%edx
+      65:	89 d8                	mov    %ebx,%eax
+      67:	c1 f8 1f             	sar    $0x1f,%eax
+      6a:	29 c2                	sub    %eax,%edx
+      6c:	6b d2 64             	imul   $0x64,%edx,%edx
+      6f:	39 d3                	cmp    %edx,%ebx
+      71:	75 c1                	jne    34 <main+0x34>
+		printf(2, ".");
+      73:	83 ec 08             	sub    $0x8,%esp
+      76:	68 e5 12 00 00       	push   $0x12e5
+      7b:	6a 02                	push   $0x2
+      7d:	e8 3e 0c 00 00       	call   cc0 <printf>
+      82:	83 c4 10             	add    $0x10,%esp
+      85:	eb ad                	jmp    34 <main+0x34>
+    printf(2, "big: cannot open big.file for writing\n");
+      87:	83 ec 08             	sub    $0x8,%esp
+      8a:	68 24 13 00 00       	push   $0x1324
+      8f:	6a 02                	push   $0x2
+      91:	e8 2a 0c 00 00       	call   cc0 <printf>
+    exit();
+      96:	e8 ec 06 00 00       	call   787 <exit>
+  }
+
+  printf(1, "\nwrote %d sectors\n", sectors);
+      9b:	83 ec 04             	sub    $0x4,%esp
+      9e:	53                   	push   %ebx
+      9f:	68 e7 12 00 00       	push   $0x12e7
+      a4:	6a 01                	push   $0x1
+      a6:	e8 15 0c 00 00       	call   cc0 <printf>
+
+  close(fd);
+      ab:	89 34 24             	mov    %esi,(%esp)
+      ae:	e8 03 07 00 00       	call   7b6 <close>
+  fd = open("big.file", O_RDONLY);
+      b3:	83 c4 08             	add    $0x8,%esp
+      b6:	6a 00                	push   $0x0
+      b8:	68 dc 12 00 00       	push   $0x12dc
+      bd:	e8 16 08 00 00       	call   8d8 <open>
+      c2:	89 c7                	mov    %eax,%edi
+  if(fd < 0){
+      c4:	83 c4 10             	add    $0x10,%esp
+      c7:	85 c0                	test   %eax,%eax
+      c9:	78 07                	js     d2 <main+0xd2>
+    printf(2, "big: cannot re-open big.file for reading\n");
+    exit();
+  }
+  for(i = 0; i < sectors; i++){
+      cb:	be 00 00 00 00       	mov    $0x0,%esi
+      d0:	eb 2c                	jmp    fe <main+0xfe>
+    printf(2, "big: cannot re-open big.file for reading\n");
+      d2:	83 ec 08             	sub    $0x8,%esp
+      d5:	68 4c 13 00 00       	push   $0x134c
+      da:	6a 02                	push   $0x2
+      dc:	e8 df 0b 00 00       	call   cc0 <printf>
+    exit();
+      e1:	e8 a1 06 00 00       	call   787 <exit>
+    int cc = read(fd, buf, sizeof(buf));
+    if(cc <= 0){
+      printf(2, "big: read error at sector %d\n", i);
+      e6:	83 ec 04             	sub    $0x4,%esp
+      e9:	56                   	push   %esi
+      ea:	68 fa 12 00 00       	push   $0x12fa
+      ef:	6a 02                	push   $0x2
+      f1:	e8 ca 0b 00 00       	call   cc0 <printf>
+      exit();
+      f6:	e8 8c 06 00 00       	call   787 <exit>
+  for(i = 0; i < sectors; i++){
+      fb:	83 c6 01             	add    $0x1,%esi
+      fe:	39 de                	cmp    %ebx,%esi
+     100:	7d 39                	jge    13b <main+0x13b>
+    int cc = read(fd, buf, sizeof(buf));
+     102:	83 ec 04             	sub    $0x4,%esp
+     105:	68 00 02 00 00       	push   $0x200
+     10a:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     110:	50                   	push   %eax
+     111:	57                   	push   %edi
+     112:	e8 94 07 00 00       	call   8ab <read>
+    if(cc <= 0){
+     117:	83 c4 10             	add    $0x10,%esp
+     11a:	85 c0                	test   %eax,%eax
+     11c:	7e c8                	jle    e6 <main+0xe6>
+    }
+    if(*(int*)buf != i){
+     11e:	8b 85 e8 fd ff ff    	mov    -0x218(%ebp),%eax
+     124:	39 f0                	cmp    %esi,%eax
+     126:	74 d3                	je     fb <main+0xfb>
+      printf(2, "big: read the wrong data (%d) for sector %d\n",
+     128:	56                   	push   %esi
+     129:	50                   	push   %eax
+     12a:	68 78 13 00 00       	push   $0x1378
+     12f:	6a 02                	push   $0x2
+     131:	e8 8a 0b 00 00       	call   cc0 <printf>
+             *(int*)buf, i);
+      exit();
+     136:	e8 4c 06 00 00       	call   787 <exit>
+    }
+  }
+
+  printf(1, "done; ok\n"); 
+     13b:	83 ec 08             	sub    $0x8,%esp
+     13e:	68 18 13 00 00       	push   $0x1318
+     143:	6a 01                	push   $0x1
+     145:	e8 76 0b 00 00       	call   cc0 <printf>
+
+  exit();
+     14a:	e8 38 06 00 00       	call   787 <exit>
+
+0000014f <strcpy>:
+#include "memlayout.h"
+#include "clock.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     14f:	55                   	push   %ebp
+     150:	89 e5                	mov    %esp,%ebp
+     152:	56                   	push   %esi
+     153:	53                   	push   %ebx
+     154:	8b 75 08             	mov    0x8(%ebp),%esi
+     157:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     15a:	89 f0                	mov    %esi,%eax
+     15c:	89 d1                	mov    %edx,%ecx
+     15e:	83 c2 01             	add    $0x1,%edx
+     161:	89 c3                	mov    %eax,%ebx
+     163:	83 c0 01             	add    $0x1,%eax
+     166:	0f b6 09             	movzbl (%ecx),%ecx
+     169:	88 0b                	mov    %cl,(%ebx)
+     16b:	84 c9                	test   %cl,%cl
+     16d:	75 ed                	jne    15c <strcpy+0xd>
+    ;
+  return os;
+}
+     16f:	89 f0                	mov    %esi,%eax
+     171:	5b                   	pop    %ebx
+     172:	5e                   	pop    %esi
+     173:	5d                   	pop    %ebp
+     174:	c3                   	ret
+
+00000175 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     175:	55                   	push   %ebp
+     176:	89 e5                	mov    %esp,%ebp
+     178:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     17b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+     17e:	eb 06                	jmp    186 <strcmp+0x11>
+    p++, q++;
+     180:	83 c1 01             	add    $0x1,%ecx
+     183:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+     186:	0f b6 01             	movzbl (%ecx),%eax
+     189:	84 c0                	test   %al,%al
+     18b:	74 04                	je     191 <strcmp+0x1c>
+     18d:	3a 02                	cmp    (%edx),%al
+     18f:	74 ef                	je     180 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+     191:	0f b6 c0             	movzbl %al,%eax
+     194:	0f b6 12             	movzbl (%edx),%edx
+     197:	29 d0                	sub    %edx,%eax
+}
+     199:	5d                   	pop    %ebp
+     19a:	c3                   	ret
+
+0000019b <strlen>:
+
+uint
+strlen(const char *s)
+{
+     19b:	55                   	push   %ebp
+     19c:	89 e5                	mov    %esp,%ebp
+     19e:	53                   	push   %ebx
+     19f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  const char *p;
+  uint w;
+
+  for(p = s; (uint)p & 3; p++)
+     1a2:	89 c8                	mov    %ecx,%eax
+     1a4:	eb 03                	jmp    1a9 <strlen+0xe>
+     1a6:	83 c0 01             	add    $0x1,%eax
+     1a9:	a8 03                	test   $0x3,%al
+     1ab:	74 09                	je     1b6 <strlen+0x1b>
+    if(*p == 0)
+     1ad:	80 38 00             	cmpb   $0x0,(%eax)
+     1b0:	75 f4                	jne    1a6 <strlen+0xb>
+      return p - s;
+     1b2:	29 c8                	sub    %ecx,%eax
+     1b4:	eb 25                	jmp    1db <strlen+0x40>
+  // Then a word at a time, which never crosses into the next page:
+  // a word with a zero byte in it has one of these bits set.
+  for(;; p += 4){
+    w = *(uint*)p;
+     1b6:	8b 10                	mov    (%eax),%edx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     1b8:	8d 9a ff fe fe fe    	lea    -0x1010101(%edx),%ebx
+     1be:	f7 d2                	not    %edx
+     1c0:	21 da                	and    %ebx,%edx
+     1c2:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+     1c8:	75 05                	jne    1cf <strlen+0x34>
+  for(;; p += 4){
+     1ca:	83 c0 04             	add    $0x4,%eax
+    w = *(uint*)p;
+     1cd:	eb e7                	jmp    1b6 <strlen+0x1b>
+      break;
+  }
+  while(*p)
+     1cf:	80 38 00             	cmpb   $0x0,(%eax)
+     1d2:	74 05                	je     1d9 <strlen+0x3e>
+    p++;
+     1d4:	83 c0 01             	add    $0x1,%eax
+     1d7:	eb f6                	jmp    1cf <strlen+0x34>
+  return p - s;
+     1d9:	29 c8                	sub    %ecx,%eax
+}
+     1db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     1de:	c9                   	leave
+     1df:	c3                   	ret
+
+000001e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     1e0:	55                   	push   %ebp
+     1e1:	89 e5                	mov    %esp,%ebp
+     1e3:	57                   	push   %edi
+     1e4:	56                   	push   %esi
+     1e5:	53                   	push   %ebx
+     1e6:	8b 55 10             	mov    0x10(%ebp),%edx
+  uint h;
+  char *d;
+
+  d = dst;
+  c &= 0xFF;
+     1e9:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  if(n >= 16){
+     1ed:	83 fa 0f             	cmp    $0xf,%edx
+     1f0:	76 52                	jbe    244 <memset+0x64>
+    h = -(uint)d & 3;
+     1f2:	8b 45 08             	mov    0x8(%ebp),%eax
+     1f5:	f7 d8                	neg    %eax
+     1f7:	83 e0 03             	and    $0x3,%eax
+     1fa:	89 c6                	mov    %eax,%esi
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     1fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+     1ff:	89 c1                	mov    %eax,%ecx
+     201:	89 d8                	mov    %ebx,%eax
+     203:	fc                   	cld
+     204:	f3 aa                	rep stos %al,%es:(%edi)
+    stosb(d, c, h);
+    stosl(d + h, (c<<24)|(c<<16)|(c<<8)|c, (n - h)/4);
+     206:	29 f2                	sub    %esi,%edx
+     208:	89 d1                	mov    %edx,%ecx
+     20a:	c1 e9 02             	shr    $0x2,%ecx
+     20d:	c1 e0 18             	shl    $0x18,%eax
+     210:	89 df                	mov    %ebx,%edi
+     212:	c1 e7 10             	shl    $0x10,%edi
+     215:	09 f8                	or     %edi,%eax
+     217:	89 df                	mov    %ebx,%edi
+     219:	c1 e7 08             	shl    $0x8,%edi
+     21c:	09 f8                	or     %edi,%eax
+     21e:	09 d8                	or     %ebx,%eax
+     220:	89 f7                	mov    %esi,%edi
+     222:	03 7d 08             	add    0x8(%ebp),%edi
+}
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosl" :
+     225:	fc                   	cld
+     226:	f3 ab                	rep stos %eax,%es:(%edi)
+    d += h + (n - h)/4*4;
+     228:	89 d7                	mov    %edx,%edi
+     22a:	83 e7 fc             	and    $0xfffffffc,%edi
+     22d:	09 f7                	or     %esi,%edi
+     22f:	03 7d 08             	add    0x8(%ebp),%edi
+    n = (n - h)%4;
+     232:	83 e2 03             	and    $0x3,%edx
+  asm volatile("cld; rep stosb" :
+     235:	89 d1                	mov    %edx,%ecx
+     237:	89 d8                	mov    %ebx,%eax
+     239:	fc                   	cld
+     23a:	f3 aa                	rep stos %al,%es:(%edi)
+  }
+  stosb(d, c, n);
+  return dst;
+}
+     23c:	8b 45 08             	mov    0x8(%ebp),%eax
+     23f:	5b                   	pop    %ebx
+     240:	5e                   	pop    %esi
+     241:	5f                   	pop    %edi
+     242:	5d                   	pop    %ebp
+     243:	c3                   	ret
+  d = dst;
+     244:	8b 7d 08             	mov    0x8(%ebp),%edi
+     247:	eb ec                	jmp    235 <memset+0x55>
+
+00000249 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     249:	55                   	push   %ebp
+     24a:	89 e5                	mov    %esp,%ebp
+     24c:	8b 45 08             	mov    0x8(%ebp),%eax
+     24f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     253:	eb 03                	jmp    258 <strchr+0xf>
+     255:	83 c0 01             	add    $0x1,%eax
+     258:	0f b6 10             	movzbl (%eax),%edx
+     25b:	84 d2                	test   %dl,%dl
+     25d:	74 06                	je     265 <strchr+0x1c>
+    if(*s == c)
+     25f:	38 ca                	cmp    %cl,%dl
+     261:	75 f2                	jne    255 <strchr+0xc>
+     263:	eb 05                	jmp    26a <strchr+0x21>
+      return (char*)s;
+  return 0;
+     265:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     26a:	5d                   	pop    %ebp
+     26b:	c3                   	ret
+
+0000026c <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     26c:	55                   	push   %ebp
+     26d:	89 e5                	mov    %esp,%ebp
+     26f:	56                   	push   %esi
+     270:	53                   	push   %ebx
+     271:	8b 55 08             	mov    0x8(%ebp),%edx
+     274:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     277:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  // A word at a time while they agree.
+  if((((uint)s1 | (uint)s2) & 3) == 0)
+     27a:	89 d3                	mov    %edx,%ebx
+     27c:	09 cb                	or     %ecx,%ebx
+     27e:	f6 c3 03             	test   $0x3,%bl
+     281:	74 24                	je     2a7 <memcmp+0x3b>
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+      s1 += 4, s2 += 4;
+  while(n-- > 0){
+     283:	8d 70 ff             	lea    -0x1(%eax),%esi
+     286:	85 c0                	test   %eax,%eax
+     288:	74 32                	je     2bc <memcmp+0x50>
+    if(*s1 != *s2)
+     28a:	0f b6 02             	movzbl (%edx),%eax
+     28d:	0f b6 19             	movzbl (%ecx),%ebx
+     290:	38 d8                	cmp    %bl,%al
+     292:	75 20                	jne    2b4 <memcmp+0x48>
+      return *s1 - *s2;
+    s1++, s2++;
+     294:	83 c2 01             	add    $0x1,%edx
+     297:	83 c1 01             	add    $0x1,%ecx
+  while(n-- > 0){
+     29a:	89 f0                	mov    %esi,%eax
+     29c:	eb e5                	jmp    283 <memcmp+0x17>
+      s1 += 4, s2 += 4;
+     29e:	83 c2 04             	add    $0x4,%edx
+     2a1:	83 c1 04             	add    $0x4,%ecx
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+     2a4:	83 e8 04             	sub    $0x4,%eax
+     2a7:	83 f8 03             	cmp    $0x3,%eax
+     2aa:	76 d7                	jbe    283 <memcmp+0x17>
+     2ac:	8b 31                	mov    (%ecx),%esi
+     2ae:	39 32                	cmp    %esi,(%edx)
+     2b0:	74 ec                	je     29e <memcmp+0x32>
+     2b2:	eb cf                	jmp    283 <memcmp+0x17>
+      return *s1 - *s2;
+     2b4:	0f b6 c0             	movzbl %al,%eax
+     2b7:	0f b6 db             	movzbl %bl,%ebx
+     2ba:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     2bc:	5b                   	pop    %ebx
+     2bd:	5e                   	pop    %esi
+     2be:	5d                   	pop    %ebp
+     2bf:	c3                   	ret
+
+000002c0 <memchr>:
+// The first c in the n bytes at v, or 0.  Once aligned, a word at
+// a time, with the word's bytes that equal c turned into zeroes
+// and those looked for.
+void*
+memchr(const void *v, int c, uint n)
+{
+     2c0:	55                   	push   %ebp
+     2c1:	89 e5                	mov    %esp,%ebp
+     2c3:	57                   	push   %edi
+     2c4:	56                   	push   %esi
+     2c5:	53                   	push   %ebx
+     2c6:	8b 45 08             	mov    0x8(%ebp),%eax
+     2c9:	8b 55 10             	mov    0x10(%ebp),%edx
+  const uchar *s;
+  uint w, rep;
+
+  s = v;
+  c = (uchar)c;
+     2cc:	0f b6 75 0c          	movzbl 0xc(%ebp),%esi
+  for(; n > 0 && ((uint)s & 3); n--, s++)
+     2d0:	eb 06                	jmp    2d8 <memchr+0x18>
+     2d2:	83 ea 01             	sub    $0x1,%edx
+     2d5:	83 c0 01             	add    $0x1,%eax
+     2d8:	85 d2                	test   %edx,%edx
+     2da:	74 0d                	je     2e9 <memchr+0x29>
+     2dc:	a8 03                	test   $0x3,%al
+     2de:	74 09                	je     2e9 <memchr+0x29>
+    if(*s == c)
+     2e0:	0f b6 08             	movzbl (%eax),%ecx
+     2e3:	39 f1                	cmp    %esi,%ecx
+     2e5:	75 eb                	jne    2d2 <memchr+0x12>
+     2e7:	eb 41                	jmp    32a <memchr+0x6a>
+      return (void*)s;
+  rep = c * 0x01010101;
+     2e9:	69 fe 01 01 01 01    	imul   $0x1010101,%esi,%edi
+  for(; n >= 4; n -= 4, s += 4){
+     2ef:	eb 06                	jmp    2f7 <memchr+0x37>
+     2f1:	83 ea 04             	sub    $0x4,%edx
+     2f4:	83 c0 04             	add    $0x4,%eax
+     2f7:	83 fa 03             	cmp    $0x3,%edx
+     2fa:	76 16                	jbe    312 <memchr+0x52>
+    w = *(uint*)s ^ rep;
+     2fc:	89 f9                	mov    %edi,%ecx
+     2fe:	33 08                	xor    (%eax),%ecx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     300:	8d 99 ff fe fe fe    	lea    -0x1010101(%ecx),%ebx
+     306:	f7 d1                	not    %ecx
+     308:	21 cb                	and    %ecx,%ebx
+     30a:	f7 c3 80 80 80 80    	test   $0x80808080,%ebx
+     310:	74 df                	je     2f1 <memchr+0x31>
+      break;
+  }
+  for(; n > 0; n--, s++)
+     312:	85 d2                	test   %edx,%edx
+     314:	74 0f                	je     325 <memchr+0x65>
+    if(*s == c)
+     316:	0f b6 08             	movzbl (%eax),%ecx
+     319:	39 f1                	cmp    %esi,%ecx
+     31b:	74 0d                	je     32a <memchr+0x6a>
+  for(; n > 0; n--, s++)
+     31d:	83 ea 01             	sub    $0x1,%edx
+     320:	83 c0 01             	add    $0x1,%eax
+     323:	eb ed                	jmp    312 <memchr+0x52>
+      return (void*)s;
+  return 0;
+     325:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     32a:	5b                   	pop    %ebx
+     32b:	5e                   	pop    %esi
+     32c:	5f                   	pop    %edi
+     32d:	5d                   	pop    %ebp
+     32e:	c3                   	ret
+
+0000032f <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     32f:	55                   	push   %ebp
+     330:	89 e5                	mov    %esp,%ebp
+     332:	57                   	push   %edi
+     333:	56                   	push   %esi
+     334:	53                   	push   %ebx
+     335:	83 ec 1c             	sub    $0x1c,%esp
+     338:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     33b:	bb 00 00 00 00       	mov    $0x0,%ebx
+     340:	89 de                	mov    %ebx,%esi
+     342:	83 c3 01             	add    $0x1,%ebx
+     345:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     348:	7d 2e                	jge    378 <gets+0x49>
+    cc = read(0, &c, 1);
+     34a:	83 ec 04             	sub    $0x4,%esp
+     34d:	6a 01                	push   $0x1
+     34f:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     352:	50                   	push   %eax
+     353:	6a 00                	push   $0x0
+     355:	e8 51 05 00 00       	call   8ab <read>
+    if(cc < 1)
+     35a:	83 c4 10             	add    $0x10,%esp
+     35d:	85 c0                	test   %eax,%eax
+     35f:	7e 17                	jle    378 <gets+0x49>
+      break;
+    buf[i++] = c;
+     361:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     365:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+     368:	3c 0a                	cmp    $0xa,%al
+     36a:	0f 94 c2             	sete   %dl
+     36d:	3c 0d                	cmp    $0xd,%al
+     36f:	0f 94 c0             	sete   %al
+     372:	08 c2                	or     %al,%dl
+     374:	74 ca                	je     340 <gets+0x11>
+    buf[i++] = c;
+     376:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+     378:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+     37c:	89 f8                	mov    %edi,%eax
+     37e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     381:	5b                   	pop    %ebx
+     382:	5e                   	pop    %esi
+     383:	5f                   	pop    %edi
+     384:	5d                   	pop    %ebp
+     385:	c3                   	ret
+
+00000386 <atoi>:
+  return r;
+}
+
+int
+atoi(const char *s)
+{
+     386:	55                   	push   %ebp
+     387:	89 e5                	mov    %esp,%ebp
+     389:	53                   	push   %ebx
+     38a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+     38d:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+     392:	eb 10                	jmp    3a4 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+     394:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+     397:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+     39a:	83 c1 01             	add    $0x1,%ecx
+     39d:	0f be c0             	movsbl %al,%eax
+     3a0:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+     3a4:	0f b6 01             	movzbl (%ecx),%eax
+     3a7:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     3aa:	80 fb 09             	cmp    $0x9,%bl
+     3ad:	76 e5                	jbe    394 <atoi+0xe>
+  return n;
+}
+     3af:	89 d0                	mov    %edx,%eax
+     3b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3b4:	c9                   	leave
+     3b5:	c3                   	ret
+
+000003b6 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     3b6:	55                   	push   %ebp
+     3b7:	89 e5                	mov    %esp,%ebp
+     3b9:	57                   	push   %edi
+     3ba:	56                   	push   %esi
+     3bb:	53                   	push   %ebx
+     3bc:	83 ec 08             	sub    $0x8,%esp
+     3bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     3c2:	8b 55 0c             	mov    0xc(%ebp),%edx
+     3c5:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *src;
+  int h;
+
+  dst = vdst;
+  src = vsrc;
+  if(n <= 0)
+     3c8:	85 c0                	test   %eax,%eax
+     3ca:	0f 8e 82 00 00 00    	jle    452 <memmove+0x9c>
+    return vdst;
+  if(src < dst && src + n > dst){
+     3d0:	39 da                	cmp    %ebx,%edx
+     3d2:	73 07                	jae    3db <memmove+0x25>
+     3d4:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+     3d7:	39 cb                	cmp    %ecx,%ebx
+     3d9:	72 5e                	jb     439 <memmove+0x83>
+    movsbback(dst + n - 1, src + n - 1, n);
+    return vdst;
+  }
+  if(n >= 16 && (((uint)dst ^ (uint)src) & 3) == 0){
+     3db:	83 f8 0f             	cmp    $0xf,%eax
+     3de:	7e 69                	jle    449 <memmove+0x93>
+     3e0:	89 d9                	mov    %ebx,%ecx
+     3e2:	31 d1                	xor    %edx,%ecx
+     3e4:	f6 c1 03             	test   $0x3,%cl
+     3e7:	75 73                	jne    45c <memmove+0xa6>
+    h = -(uint)dst & 3;
+     3e9:	89 d9                	mov    %ebx,%ecx
+     3eb:	f7 d9                	neg    %ecx
+     3ed:	83 e1 03             	and    $0x3,%ecx
+}
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsb" :
+     3f0:	89 df                	mov    %ebx,%edi
+     3f2:	89 d6                	mov    %edx,%esi
+     3f4:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+     3f7:	fc                   	cld
+     3f8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    movsb(dst, src, h);
+    dst += h, src += h, n -= h;
+     3fa:	8b 75 f0             	mov    -0x10(%ebp),%esi
+     3fd:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+     400:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+     403:	29 f0                	sub    %esi,%eax
+    movsl(dst, src, n/4);
+     405:	8d 50 03             	lea    0x3(%eax),%edx
+     408:	0f 49 d0             	cmovns %eax,%edx
+     40b:	c1 fa 02             	sar    $0x2,%edx
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+     40e:	89 7d f0             	mov    %edi,-0x10(%ebp)
+     411:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     414:	89 ce                	mov    %ecx,%esi
+     416:	89 d1                	mov    %edx,%ecx
+     418:	fc                   	cld
+     419:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    dst += n/4*4, src += n/4*4, n %= 4;
+     41b:	c1 e2 02             	shl    $0x2,%edx
+     41e:	8b 7d f0             	mov    -0x10(%ebp),%edi
+     421:	01 d7                	add    %edx,%edi
+     423:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     426:	01 ca                	add    %ecx,%edx
+     428:	89 c6                	mov    %eax,%esi
+     42a:	c1 fe 1f             	sar    $0x1f,%esi
+     42d:	c1 ee 1e             	shr    $0x1e,%esi
+     430:	01 f0                	add    %esi,%eax
+     432:	83 e0 03             	and    $0x3,%eax
+     435:	29 f0                	sub    %esi,%eax
+     437:	eb 12                	jmp    44b <memmove+0x95>
+    movsbback(dst + n - 1, src + n - 1, n);
+     439:	8d 78 ff             	lea    -0x1(%eax),%edi
+     43c:	8d 34 3a             	lea    (%edx,%edi,1),%esi
+     43f:	01 df                	add    %ebx,%edi
+// Copy cnt bytes down from the last ones, at dst and src, to the
+// first: for overlapping moves up.
+static inline void
+movsbback(void *dst, const void *src, int cnt)
+{
+  asm volatile("std; rep movsb; cld" :
+     441:	89 c1                	mov    %eax,%ecx
+     443:	fd                   	std
+     444:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     446:	fc                   	cld
+    return vdst;
+     447:	eb 09                	jmp    452 <memmove+0x9c>
+  dst = vdst;
+     449:	89 df                	mov    %ebx,%edi
+  asm volatile("cld; rep movsb" :
+     44b:	89 d6                	mov    %edx,%esi
+     44d:	89 c1                	mov    %eax,%ecx
+     44f:	fc                   	cld
+     450:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  }
+  movsb(dst, src, n);
+  return vdst;
+}
+     452:	89 d8                	mov    %ebx,%eax
+     454:	83 c4 08             	add    $0x8,%esp
+     457:	5b                   	pop    %ebx
+     458:	5e                   	pop    %esi
+     459:	5f                   	pop    %edi
+     45a:	5d                   	pop    %ebp
+     45b:	c3                   	ret
+  dst = vdst;
+     45c:	89 df                	mov    %ebx,%edi
+     45e:	eb eb                	jmp    44b <memmove+0x95>
+
+00000460 <vclock_gettime>:
+
+// clock_gettime() without a system call: read the clock page
+// that the kernel maps at CLOCKPAGE (see clock.h).
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+     460:	55                   	push   %ebp
+     461:	89 e5                	mov    %esp,%ebp
+     463:	57                   	push   %edi
+     464:	56                   	push   %esi
+     465:	53                   	push   %ebx
+     466:	83 ec 14             	sub    $0x14,%esp
+  struct clockpage *cp = (struct clockpage*)CLOCKPAGE;
+  uint seq, rem, d;
+  uint64 tsc, ns, now;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+     469:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     46d:	0f 87 a3 00 00 00    	ja     516 <vclock_gettime+0xb6>
+    return -1;
+  do {
+    seq = cp->seq;
+     473:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+    __sync_synchronize();
+     478:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    tsc = cp->tsc;
+     47d:	8b 15 10 f0 ff 7f    	mov    0x7ffff010,%edx
+     483:	8b 1d 14 f0 ff 7f    	mov    0x7ffff014,%ebx
+    ns = cp->ns;
+     489:	8b 35 18 f0 ff 7f    	mov    0x7ffff018,%esi
+     48f:	8b 3d 1c f0 ff 7f    	mov    0x7ffff01c,%edi
+    __sync_synchronize();
+     495:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != cp->seq);
+     49a:	89 c1                	mov    %eax,%ecx
+     49c:	83 e1 01             	and    $0x1,%ecx
+     49f:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     4a2:	75 cf                	jne    473 <vclock_gettime+0x13>
+     4a4:	8b 0d 00 f0 ff 7f    	mov    0x7ffff000,%ecx
+     4aa:	39 c1                	cmp    %eax,%ecx
+     4ac:	75 c5                	jne    473 <vclock_gettime+0x13>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+     4ae:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     4b1:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     4b4:	0f 31                	rdtsc
+     4b6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     4b9:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     4bc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  now = rdtsc();
+  // Less than a tick has passed since the update, so the delta
+  // fits in 32 bits.
+  d = now > tsc ? now - tsc : 0;
+     4bf:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     4c2:	19 d3                	sbb    %edx,%ebx
+     4c4:	73 07                	jae    4cd <vclock_gettime+0x6d>
+     4c6:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+     4c9:	29 d8                	sub    %ebx,%eax
+     4cb:	89 c1                	mov    %eax,%ecx
+  ns += ((uint64)d * cp->mult) >> cp->shift;
+     4cd:	89 c8                	mov    %ecx,%eax
+     4cf:	f7 25 04 f0 ff 7f    	mull   0x7ffff004
+     4d5:	0f b6 0d 08 f0 ff 7f 	movzbl 0x7ffff008,%ecx
+     4dc:	0f ad d0             	shrd   %cl,%edx,%eax
+     4df:	d3 ea                	shr    %cl,%edx
+     4e1:	f6 c1 20             	test   $0x20,%cl
+     4e4:	74 04                	je     4ea <vclock_gettime+0x8a>
+     4e6:	89 d0                	mov    %edx,%eax
+     4e8:	31 d2                	xor    %edx,%edx
+     4ea:	01 f0                	add    %esi,%eax
+     4ec:	11 fa                	adc    %edi,%edx
+static inline uint
+divl(uint64 n, uint d, uint *r)
+{
+  uint q;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (*r) :
+     4ee:	bb 00 ca 9a 3b       	mov    $0x3b9aca00,%ebx
+     4f3:	f7 f3                	div    %ebx
+  ts->tv_sec = divl(ns, 1000000000, &rem);
+     4f5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     4f8:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = rem;
+     4fa:	89 57 04             	mov    %edx,0x4(%edi)
+  if(clk == CLOCK_REALTIME)
+     4fd:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     501:	75 1a                	jne    51d <vclock_gettime+0xbd>
+    ts->tv_sec += cp->boottime;
+     503:	03 05 0c f0 ff 7f    	add    0x7ffff00c,%eax
+     509:	89 07                	mov    %eax,(%edi)
+  return 0;
+     50b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     50e:	83 c4 14             	add    $0x14,%esp
+     511:	5b                   	pop    %ebx
+     512:	5e                   	pop    %esi
+     513:	5f                   	pop    %edi
+     514:	5d                   	pop    %ebp
+     515:	c3                   	ret
+    return -1;
+     516:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     51b:	eb f1                	jmp    50e <vclock_gettime+0xae>
+  return 0;
+     51d:	b8 00 00 00 00       	mov    $0x0,%eax
+     522:	eb ea                	jmp    50e <vclock_gettime+0xae>
+
+00000524 <flush>:
+
+// Write out fd's buffer, or with fd < 0 every buffer.
+// Returns -1 if a write fails.
+int
+flush(int fd)
+{
+     524:	55                   	push   %ebp
+     525:	89 e5                	mov    %esp,%ebp
+     527:	56                   	push   %esi
+     528:	53                   	push   %ebx
+     529:	8b 45 08             	mov    0x8(%ebp),%eax
+  int r, n;
+
+  if(fd < 0){
+     52c:	85 c0                	test   %eax,%eax
+     52e:	78 5d                	js     58d <flush+0x69>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+      if(flush(fd) < 0)
+        r = -1;
+    return r;
+  }
+  if(fd >= NOBUF || (n = obuf[fd].n) == 0)
+     530:	83 f8 0f             	cmp    $0xf,%eax
+     533:	7f 64                	jg     599 <flush+0x75>
+     535:	69 d0 08 02 00 00    	imul   $0x208,%eax,%edx
+     53b:	8b b2 e4 1a 00 00    	mov    0x1ae4(%edx),%esi
+     541:	85 f6                	test   %esi,%esi
+     543:	74 59                	je     59e <flush+0x7a>
+    return 0;
+  obuf[fd].n = 0;
+     545:	c7 82 e4 1a 00 00 00 	movl   $0x0,0x1ae4(%edx)
+     54c:	00 00 00 
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     54f:	81 c2 e8 1a 00 00    	add    $0x1ae8,%edx
+     555:	83 ec 04             	sub    $0x4,%esp
+     558:	56                   	push   %esi
+     559:	52                   	push   %edx
+     55a:	50                   	push   %eax
+     55b:	e8 5a 03 00 00       	call   8ba <write>
+     560:	83 c4 10             	add    $0x10,%esp
+     563:	39 f0                	cmp    %esi,%eax
+     565:	75 40                	jne    5a7 <flush+0x83>
+     567:	be 00 00 00 00       	mov    $0x0,%esi
+     56c:	eb 30                	jmp    59e <flush+0x7a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     56e:	83 c3 01             	add    $0x1,%ebx
+     571:	83 fb 0f             	cmp    $0xf,%ebx
+     574:	7f 28                	jg     59e <flush+0x7a>
+      if(flush(fd) < 0)
+     576:	83 ec 0c             	sub    $0xc,%esp
+     579:	53                   	push   %ebx
+     57a:	e8 a5 ff ff ff       	call   524 <flush>
+     57f:	83 c4 10             	add    $0x10,%esp
+     582:	85 c0                	test   %eax,%eax
+     584:	79 e8                	jns    56e <flush+0x4a>
+        r = -1;
+     586:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     58b:	eb e1                	jmp    56e <flush+0x4a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     58d:	be 00 00 00 00       	mov    $0x0,%esi
+     592:	bb 00 00 00 00       	mov    $0x0,%ebx
+     597:	eb d8                	jmp    571 <flush+0x4d>
+    return 0;
+     599:	be 00 00 00 00       	mov    $0x0,%esi
+}
+     59e:	89 f0                	mov    %esi,%eax
+     5a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     5a3:	5b                   	pop    %ebx
+     5a4:	5e                   	pop    %esi
+     5a5:	5d                   	pop    %ebp
+     5a6:	c3                   	ret
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     5a7:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     5ac:	eb f0                	jmp    59e <flush+0x7a>
+
+000005ae <bufreset>:
+
+static void
+bufreset(int fd)
+{
+  if(fd >= 0 && fd < NOBUF){
+     5ae:	83 f8 0f             	cmp    $0xf,%eax
+     5b1:	76 01                	jbe    5b4 <bufreset+0x6>
+     5b3:	c3                   	ret
+{
+     5b4:	55                   	push   %ebp
+     5b5:	89 e5                	mov    %esp,%ebp
+     5b7:	53                   	push   %ebx
+     5b8:	83 ec 10             	sub    $0x10,%esp
+     5bb:	89 c3                	mov    %eax,%ebx
+    flush(fd);
+     5bd:	50                   	push   %eax
+     5be:	e8 61 ff ff ff       	call   524 <flush>
+    obuf[fd].mode = BUNKNOWN;
+     5c3:	69 db 08 02 00 00    	imul   $0x208,%ebx,%ebx
+     5c9:	c7 83 e0 1a 00 00 00 	movl   $0x0,0x1ae0(%ebx)
+     5d0:	00 00 00 
+     5d3:	83 c4 10             	add    $0x10,%esp
+  }
+}
+     5d6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5d9:	c9                   	leave
+     5da:	c3                   	ret
+
+000005db <bufwrite>:
+
+// Write n bytes from p to fd, through its buffer.
+// Returns n, or -1 if a write fails.
+int
+bufwrite(int fd, const void *p, int n)
+{
+     5db:	55                   	push   %ebp
+     5dc:	89 e5                	mov    %esp,%ebp
+     5de:	57                   	push   %edi
+     5df:	56                   	push   %esi
+     5e0:	53                   	push   %ebx
+     5e1:	83 ec 3c             	sub    $0x3c,%esp
+     5e4:	8b 75 08             	mov    0x8(%ebp),%esi
+     5e7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct stat st;
+  const char *s;
+  int i;
+
+  if(fd < 0 || fd >= NOBUF)
+     5ea:	83 fe 0f             	cmp    $0xf,%esi
+     5ed:	0f 87 a2 00 00 00    	ja     695 <bufwrite+0xba>
+    return write(fd, p, n);
+  if(obuf[fd].mode == BUNKNOWN){
+     5f3:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     5f9:	83 b8 e0 1a 00 00 00 	cmpl   $0x0,0x1ae0(%eax)
+     600:	75 19                	jne    61b <bufwrite+0x40>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     602:	83 fe 02             	cmp    $0x2,%esi
+     605:	0f 85 9c 00 00 00    	jne    6a7 <bufwrite+0xcc>
+      obuf[fd].mode = BNONE;
+     60b:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     611:	c7 80 e0 1a 00 00 01 	movl   $0x1,0x1ae0(%eax)
+     618:	00 00 00 
+    else
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+  }
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     61b:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     621:	89 da                	mov    %ebx,%edx
+     623:	03 90 e4 1a 00 00    	add    0x1ae4(%eax),%edx
+     629:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+     62f:	0f 8f ae 00 00 00    	jg     6e3 <bufwrite+0x108>
+    return -1;
+  if(n >= OBUFSZ)
+     635:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+     63b:	0f 8f bd 00 00 00    	jg     6fe <bufwrite+0x123>
+    return write(fd, p, n);
+  memmove(obuf[fd].buf + obuf[fd].n, p, n);
+     641:	69 d6 08 02 00 00    	imul   $0x208,%esi,%edx
+     647:	8d ba e0 1a 00 00    	lea    0x1ae0(%edx),%edi
+     64d:	8b 82 e4 1a 00 00    	mov    0x1ae4(%edx),%eax
+     653:	83 ec 04             	sub    $0x4,%esp
+     656:	53                   	push   %ebx
+     657:	ff 75 0c             	push   0xc(%ebp)
+     65a:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     65d:	8d 84 10 e8 1a 00 00 	lea    0x1ae8(%eax,%edx,1),%eax
+     664:	50                   	push   %eax
+     665:	e8 4c fd ff ff       	call   3b6 <memmove>
+  obuf[fd].n += n;
+     66a:	01 5f 04             	add    %ebx,0x4(%edi)
+  if(obuf[fd].mode == BNONE)
+     66d:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     670:	8b 82 e0 1a 00 00    	mov    0x1ae0(%edx),%eax
+     676:	83 c4 10             	add    $0x10,%esp
+     679:	83 f8 01             	cmp    $0x1,%eax
+     67c:	0f 84 91 00 00 00    	je     713 <bufwrite+0x138>
+    return flush(fd) < 0 ? -1 : n;
+  if(obuf[fd].mode == BLINE)
+     682:	83 f8 02             	cmp    $0x2,%eax
+     685:	0f 84 ca 00 00 00    	je     755 <bufwrite+0x17a>
+    for(s = p, i = 0; i < n; i++)
+      if(s[i] == '\n')
+        return flush(fd) < 0 ? -1 : n;
+  return n;
+     68b:	89 d8                	mov    %ebx,%eax
+}
+     68d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     690:	5b                   	pop    %ebx
+     691:	5e                   	pop    %esi
+     692:	5f                   	pop    %edi
+     693:	5d                   	pop    %ebp
+     694:	c3                   	ret
+    return write(fd, p, n);
+     695:	83 ec 04             	sub    $0x4,%esp
+     698:	53                   	push   %ebx
+     699:	ff 75 0c             	push   0xc(%ebp)
+     69c:	56                   	push   %esi
+     69d:	e8 18 02 00 00       	call   8ba <write>
+     6a2:	83 c4 10             	add    $0x10,%esp
+     6a5:	eb e6                	jmp    68d <bufwrite+0xb2>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     6a7:	83 ec 08             	sub    $0x8,%esp
+     6aa:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     6ad:	50                   	push   %eax
+     6ae:	56                   	push   %esi
+     6af:	e8 51 02 00 00       	call   905 <fstat>
+     6b4:	83 c4 10             	add    $0x10,%esp
+     6b7:	85 c0                	test   %eax,%eax
+     6b9:	0f 88 4c ff ff ff    	js     60b <bufwrite+0x30>
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+     6bf:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     6c4:	74 16                	je     6dc <bufwrite+0x101>
+     6c6:	ba 03 00 00 00       	mov    $0x3,%edx
+     6cb:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     6d1:	89 90 e0 1a 00 00    	mov    %edx,0x1ae0(%eax)
+     6d7:	e9 3f ff ff ff       	jmp    61b <bufwrite+0x40>
+     6dc:	ba 02 00 00 00       	mov    $0x2,%edx
+     6e1:	eb e8                	jmp    6cb <bufwrite+0xf0>
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     6e3:	83 ec 0c             	sub    $0xc,%esp
+     6e6:	56                   	push   %esi
+     6e7:	e8 38 fe ff ff       	call   524 <flush>
+     6ec:	83 c4 10             	add    $0x10,%esp
+     6ef:	85 c0                	test   %eax,%eax
+     6f1:	0f 89 3e ff ff ff    	jns    635 <bufwrite+0x5a>
+    return -1;
+     6f7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     6fc:	eb 8f                	jmp    68d <bufwrite+0xb2>
+    return write(fd, p, n);
+     6fe:	83 ec 04             	sub    $0x4,%esp
+     701:	53                   	push   %ebx
+     702:	ff 75 0c             	push   0xc(%ebp)
+     705:	56                   	push   %esi
+     706:	e8 af 01 00 00       	call   8ba <write>
+     70b:	83 c4 10             	add    $0x10,%esp
+     70e:	e9 7a ff ff ff       	jmp    68d <bufwrite+0xb2>
+    return flush(fd) < 0 ? -1 : n;
+     713:	83 ec 0c             	sub    $0xc,%esp
+     716:	56                   	push   %esi
+     717:	e8 08 fe ff ff       	call   524 <flush>
+     71c:	83 c4 10             	add    $0x10,%esp
+     71f:	85 c0                	test   %eax,%eax
+     721:	78 07                	js     72a <bufwrite+0x14f>
+     723:	89 d8                	mov    %ebx,%eax
+     725:	e9 63 ff ff ff       	jmp    68d <bufwrite+0xb2>
+     72a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     72f:	e9 59 ff ff ff       	jmp    68d <bufwrite+0xb2>
+        return flush(fd) < 0 ? -1 : n;
+     734:	83 ec 0c             	sub    $0xc,%esp
+     737:	56                   	push   %esi
+     738:	e8 e7 fd ff ff       	call   524 <flush>
+     73d:	83 c4 10             	add    $0x10,%esp
+     740:	85 c0                	test   %eax,%eax
+     742:	78 07                	js     74b <bufwrite+0x170>
+     744:	89 d8                	mov    %ebx,%eax
+     746:	e9 42 ff ff ff       	jmp    68d <bufwrite+0xb2>
+     74b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     750:	e9 38 ff ff ff       	jmp    68d <bufwrite+0xb2>
+    for(s = p, i = 0; i < n; i++)
+     755:	b8 00 00 00 00       	mov    $0x0,%eax
+     75a:	39 d8                	cmp    %ebx,%eax
+     75c:	7d 0e                	jge    76c <bufwrite+0x191>
+      if(s[i] == '\n')
+     75e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     761:	80 3c 01 0a          	cmpb   $0xa,(%ecx,%eax,1)
+     765:	74 cd                	je     734 <bufwrite+0x159>
+    for(s = p, i = 0; i < n; i++)
+     767:	83 c0 01             	add    $0x1,%eax
+     76a:	eb ee                	jmp    75a <bufwrite+0x17f>
+  return n;
+     76c:	89 d8                	mov    %ebx,%eax
+     76e:	e9 1a ff ff ff       	jmp    68d <bufwrite+0xb2>
+
+00000773 <fork>:
+
+int
+fork(void)
+{
+     773:	55                   	push   %ebp
+     774:	89 e5                	mov    %esp,%ebp
+     776:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     779:	6a ff                	push   $0xffffffff
+     77b:	e8 a4 fd ff ff       	call   524 <flush>
+  return _fork();
+     780:	e8 bd 00 00 00       	call   842 <_fork>
+}
+     785:	c9                   	leave
+     786:	c3                   	ret
+
+00000787 <exit>:
+
+int
+exit(void)
+{
+     787:	55                   	push   %ebp
+     788:	89 e5                	mov    %esp,%ebp
+     78a:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     78d:	6a ff                	push   $0xffffffff
+     78f:	e8 90 fd ff ff       	call   524 <flush>
+  _exit();
+     794:	e8 b8 00 00 00       	call   851 <_exit>
+
+00000799 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     799:	55                   	push   %ebp
+     79a:	89 e5                	mov    %esp,%ebp
+     79c:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     79f:	6a ff                	push   $0xffffffff
+     7a1:	e8 7e fd ff ff       	call   524 <flush>
+  return _exec(path, argv);
+     7a6:	83 c4 08             	add    $0x8,%esp
+     7a9:	ff 75 0c             	push   0xc(%ebp)
+     7ac:	ff 75 08             	push   0x8(%ebp)
+     7af:	e8 bb 00 00 00       	call   86f <_exec>
+}
+     7b4:	c9                   	leave
+     7b5:	c3                   	ret
+
+000007b6 <close>:
+
+int
+close(int fd)
+{
+     7b6:	55                   	push   %ebp
+     7b7:	89 e5                	mov    %esp,%ebp
+     7b9:	53                   	push   %ebx
+     7ba:	83 ec 04             	sub    $0x4,%esp
+     7bd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bufreset(fd);
+     7c0:	89 d8                	mov    %ebx,%eax
+     7c2:	e8 e7 fd ff ff       	call   5ae <bufreset>
+  return _close(fd);
+     7c7:	83 ec 0c             	sub    $0xc,%esp
+     7ca:	53                   	push   %ebx
+     7cb:	e8 90 00 00 00       	call   860 <_close>
+}
+     7d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7d3:	c9                   	leave
+     7d4:	c3                   	ret
+
+000007d5 <stat>:
+{
+     7d5:	55                   	push   %ebp
+     7d6:	89 e5                	mov    %esp,%ebp
+     7d8:	56                   	push   %esi
+     7d9:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     7da:	83 ec 08             	sub    $0x8,%esp
+     7dd:	6a 00                	push   $0x0
+     7df:	ff 75 08             	push   0x8(%ebp)
+     7e2:	e8 f1 00 00 00       	call   8d8 <open>
+  if(fd < 0)
+     7e7:	83 c4 10             	add    $0x10,%esp
+     7ea:	85 c0                	test   %eax,%eax
+     7ec:	78 24                	js     812 <stat+0x3d>
+     7ee:	89 c3                	mov    %eax,%ebx
+  r = fstat(fd, st);
+     7f0:	83 ec 08             	sub    $0x8,%esp
+     7f3:	ff 75 0c             	push   0xc(%ebp)
+     7f6:	50                   	push   %eax
+     7f7:	e8 09 01 00 00       	call   905 <fstat>
+     7fc:	89 c6                	mov    %eax,%esi
+  close(fd);
+     7fe:	89 1c 24             	mov    %ebx,(%esp)
+     801:	e8 b0 ff ff ff       	call   7b6 <close>
+  return r;
+     806:	83 c4 10             	add    $0x10,%esp
+}
+     809:	89 f0                	mov    %esi,%eax
+     80b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     80e:	5b                   	pop    %ebx
+     80f:	5e                   	pop    %esi
+     810:	5d                   	pop    %ebp
+     811:	c3                   	ret
+    return -1;
+     812:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     817:	eb f0                	jmp    809 <stat+0x34>
+
+00000819 <dup2>:
+
+int
+dup2(int oldfd, int newfd)
+{
+     819:	55                   	push   %ebp
+     81a:	89 e5                	mov    %esp,%ebp
+     81c:	56                   	push   %esi
+     81d:	53                   	push   %ebx
+     81e:	8b 75 08             	mov    0x8(%ebp),%esi
+     821:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(oldfd != newfd)
+     824:	39 de                	cmp    %ebx,%esi
+     826:	75 11                	jne    839 <dup2+0x20>
+    bufreset(newfd);
+  return _dup2(oldfd, newfd);
+     828:	83 ec 08             	sub    $0x8,%esp
+     82b:	53                   	push   %ebx
+     82c:	56                   	push   %esi
+     82d:	e8 4c 00 00 00       	call   87e <_dup2>
+}
+     832:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     835:	5b                   	pop    %ebx
+     836:	5e                   	pop    %esi
+     837:	5d                   	pop    %ebp
+     838:	c3                   	ret
+    bufreset(newfd);
+     839:	89 d8                	mov    %ebx,%eax
+     83b:	e8 6e fd ff ff       	call   5ae <bufreset>
+     840:	eb e6                	jmp    828 <dup2+0xf>
+
+00000842 <_fork>:
+  1: ret
+
+#define SYSCALL(name) STUB(name, SYS_ ## name)
+
+# ulib.c wraps these, to flush printf()'s buffers first.
+STUB(_fork, SYS_fork)
+     842:	b8 01 00 00 00       	mov    $0x1,%eax
+     847:	89 e1                	mov    %esp,%ecx
+     849:	ba 50 08 00 00       	mov    $0x850,%edx
+     84e:	0f 34                	sysenter
+     850:	c3                   	ret
+
+00000851 <_exit>:
+STUB(_exit, SYS_exit)
+     851:	b8 02 00 00 00       	mov    $0x2,%eax
+     856:	89 e1                	mov    %esp,%ecx
+     858:	ba 5f 08 00 00       	mov    $0x85f,%edx
+     85d:	0f 34                	sysenter
+     85f:	c3                   	ret
+
+00000860 <_close>:
+STUB(_close, SYS_close)
+     860:	b8 15 00 00 00       	mov    $0x15,%eax
+     865:	89 e1                	mov    %esp,%ecx
+     867:	ba 6e 08 00 00       	mov    $0x86e,%edx
+     86c:	0f 34                	sysenter
+     86e:	c3                   	ret
+
+0000086f <_exec>:
+STUB(_exec, SYS_exec)
+     86f:	b8 07 00 00 00       	mov    $0x7,%eax
+     874:	89 e1                	mov    %esp,%ecx
+     876:	ba 7d 08 00 00       	mov    $0x87d,%edx
+     87b:	0f 34                	sysenter
+     87d:	c3                   	ret
+
+0000087e <_dup2>:
+STUB(_dup2, SYS_dup2)
+     87e:	b8 17 00 00 00       	mov    $0x17,%eax
+     883:	89 e1                	mov    %esp,%ecx
+     885:	ba 8c 08 00 00       	mov    $0x88c,%edx
+     88a:	0f 34                	sysenter
+     88c:	c3                   	ret
+
+0000088d <wait>:
+
+SYSCALL(wait)
+     88d:	b8 03 00 00 00       	mov    $0x3,%eax
+     892:	89 e1                	mov    %esp,%ecx
+     894:	ba 9b 08 00 00       	mov    $0x89b,%edx
+     899:	0f 34                	sysenter
+     89b:	c3                   	ret
+
+0000089c <pipe>:
+SYSCALL(pipe)
+     89c:	b8 04 00 00 00       	mov    $0x4,%eax
+     8a1:	89 e1                	mov    %esp,%ecx
+     8a3:	ba aa 08 00 00       	mov    $0x8aa,%edx
+     8a8:	0f 34                	sysenter
+     8aa:	c3                   	ret
+
+000008ab <read>:
+SYSCALL(read)
+     8ab:	b8 05 00 00 00       	mov    $0x5,%eax
+     8b0:	89 e1                	mov    %esp,%ecx
+     8b2:	ba b9 08 00 00       	mov    $0x8b9,%edx
+     8b7:	0f 34                	sysenter
+     8b9:	c3                   	ret
+
+000008ba <write>:
+SYSCALL(write)
+     8ba:	b8 10 00 00 00       	mov    $0x10,%eax
+     8bf:	89 e1                	mov    %esp,%ecx
+     8c1:	ba c8 08 00 00       	mov    $0x8c8,%edx
+     8c6:	0f 34                	sysenter
+     8c8:	c3                   	ret
+
+000008c9 <kill>:
+SYSCALL(kill)
+     8c9:	b8 06 00 00 00       	mov    $0x6,%eax
+     8ce:	89 e1                	mov    %esp,%ecx
+     8d0:	ba d7 08 00 00       	mov    $0x8d7,%edx
+     8d5:	0f 34                	sysenter
+     8d7:	c3                   	ret
+
+000008d8 <open>:
+SYSCALL(open)
+     8d8:	b8 0f 00 00 00       	mov    $0xf,%eax
+     8dd:	89 e1                	mov    %esp,%ecx
+     8df:	ba e6 08 00 00       	mov    $0x8e6,%edx
+     8e4:	0f 34                	sysenter
+     8e6:	c3                   	ret
+
+000008e7 <mknod>:
+SYSCALL(mknod)
+     8e7:	b8 11 00 00 00       	mov    $0x11,%eax
+     8ec:	89 e1                	mov    %esp,%ecx
+     8ee:	ba f5 08 00 00       	mov    $0x8f5,%edx
+     8f3:	0f 34                	sysenter
+     8f5:	c3                   	ret
+
+000008f6 <unlink>:
+SYSCALL(unlink)
+     8f6:	b8 12 00 00 00       	mov    $0x12,%eax
+     8fb:	89 e1                	mov    %esp,%ecx
+     8fd:	ba 04 09 00 00       	mov    $0x904,%edx
+     902:	0f 34                	sysenter
+     904:	c3                   	ret
+
+00000905 <fstat>:
+SYSCALL(fstat)
+     905:	b8 08 00 00 00       	mov    $0x8,%eax
+     90a:	89 e1                	mov    %esp,%ecx
+     90c:	ba 13 09 00 00       	mov    $0x913,%edx
+     911:	0f 34                	sysenter
+     913:	c3                   	ret
+
+00000914 <link>:
+SYSCALL(link)
+     914:	b8 13 00 00 00       	mov    $0x13,%eax
+     919:	89 e1                	mov    %esp,%ecx
+     91b:	ba 22 09 00 00       	mov    $0x922,%edx
+     920:	0f 34                	sysenter
+     922:	c3                   	ret
+
+00000923 <mkdir>:
+SYSCALL(mkdir)
+     923:	b8 14 00 00 00       	mov    $0x14,%eax
+     928:	89 e1                	mov    %esp,%ecx
+     92a:	ba 31 09 00 00       	mov    $0x931,%edx
+     92f:	0f 34                	sysenter
+     931:	c3                   	ret
+
+00000932 <chdir>:
+SYSCALL(chdir)
+     932:	b8 09 00 00 00       	mov    $0x9,%eax
+     937:	89 e1                	mov    %esp,%ecx
+     939:	ba 40 09 00 00       	mov    $0x940,%edx
+     93e:	0f 34                	sysenter
+     940:	c3                   	ret
+
+00000941 <dup>:
+SYSCALL(dup)
+     941:	b8 0a 00 00 00       	mov    $0xa,%eax
+     946:	89 e1                	mov    %esp,%ecx
+     948:	ba 4f 09 00 00       	mov    $0x94f,%edx
+     94d:	0f 34                	sysenter
+     94f:	c3                   	ret
+
+00000950 <getpid>:
+SYSCALL(getpid)
+     950:	b8 0b 00 00 00       	mov    $0xb,%eax
+     955:	89 e1                	mov    %esp,%ecx
+     957:	ba 5e 09 00 00       	mov    $0x95e,%edx
+     95c:	0f 34                	sysenter
+     95e:	c3                   	ret
+
+0000095f <sbrk>:
+SYSCALL(sbrk)
+     95f:	b8 0c 00 00 00       	mov    $0xc,%eax
+     964:	89 e1                	mov    %esp,%ecx
+     966:	ba 6d 09 00 00       	mov    $0x96d,%edx
+     96b:	0f 34                	sysenter
+     96d:	c3                   	ret
+
+0000096e <sleep>:
+SYSCALL(sleep)
+     96e:	b8 0d 00 00 00       	mov    $0xd,%eax
+     973:	89 e1                	mov    %esp,%ecx
+     975:	ba 7c 09 00 00       	mov    $0x97c,%edx
+     97a:	0f 34                	sysenter
+     97c:	c3                   	ret
+
+0000097d <uptime>:
+SYSCALL(uptime)
+     97d:	b8 0e 00 00 00       	mov    $0xe,%eax
+     982:	89 e1                	mov    %esp,%ecx
+     984:	ba 8b 09 00 00       	mov    $0x98b,%edx
+     989:	0f 34                	sysenter
+     98b:	c3                   	ret
+
+0000098c <date>:
+SYSCALL(date)
+     98c:	b8 16 00 00 00       	mov    $0x16,%eax
+     991:	89 e1                	mov    %esp,%ecx
+     993:	ba 9a 09 00 00       	mov    $0x99a,%edx
+     998:	0f 34                	sysenter
+     99a:	c3                   	ret
+
+0000099b <faultaround>:
+SYSCALL(faultaround)
+     99b:	b8 18 00 00 00       	mov    $0x18,%eax
+     9a0:	89 e1                	mov    %esp,%ecx
+     9a2:	ba a9 09 00 00       	mov    $0x9a9,%edx
+     9a7:	0f 34                	sysenter
+     9a9:	c3                   	ret
+
+000009aa <faultstat>:
+SYSCALL(faultstat)
+     9aa:	b8 19 00 00 00       	mov    $0x19,%eax
+     9af:	89 e1                	mov    %esp,%ecx
+     9b1:	ba b8 09 00 00       	mov    $0x9b8,%edx
+     9b6:	0f 34                	sysenter
+     9b8:	c3                   	ret
+
+000009b9 <mmap>:
+SYSCALL(mmap)
+     9b9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     9be:	89 e1                	mov    %esp,%ecx
+     9c0:	ba c7 09 00 00       	mov    $0x9c7,%edx
+     9c5:	0f 34                	sysenter
+     9c7:	c3                   	ret
+
+000009c8 <munmap>:
+SYSCALL(munmap)
+     9c8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     9cd:	89 e1                	mov    %esp,%ecx
+     9cf:	ba d6 09 00 00       	mov    $0x9d6,%edx
+     9d4:	0f 34                	sysenter
+     9d6:	c3                   	ret
+
+000009d7 <largepages>:
+SYSCALL(largepages)
+     9d7:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     9dc:	89 e1                	mov    %esp,%ecx
+     9de:	ba e5 09 00 00       	mov    $0x9e5,%edx
+     9e3:	0f 34                	sysenter
+     9e5:	c3                   	ret
+
+000009e6 <spawn>:
+SYSCALL(spawn)
+     9e6:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     9eb:	89 e1                	mov    %esp,%ecx
+     9ed:	ba f4 09 00 00       	mov    $0x9f4,%edx
+     9f2:	0f 34                	sysenter
+     9f4:	c3                   	ret
+
+000009f5 <setpriority>:
+SYSCALL(setpriority)
+     9f5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     9fa:	89 e1                	mov    %esp,%ecx
+     9fc:	ba 03 0a 00 00       	mov    $0xa03,%edx
+     a01:	0f 34                	sysenter
+     a03:	c3                   	ret
+
+00000a04 <getpriority>:
+SYSCALL(getpriority)
+     a04:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     a09:	89 e1                	mov    %esp,%ecx
+     a0b:	ba 12 0a 00 00       	mov    $0xa12,%edx
+     a10:	0f 34                	sysenter
+     a12:	c3                   	ret
+
+00000a13 <getprocinfo>:
+SYSCALL(getprocinfo)
+     a13:	b8 20 00 00 00       	mov    $0x20,%eax
+     a18:	89 e1                	mov    %esp,%ecx
+     a1a:	ba 21 0a 00 00       	mov    $0xa21,%edx
+     a1f:	0f 34                	sysenter
+     a21:	c3                   	ret
+
+00000a22 <getcpuinfo>:
+SYSCALL(getcpuinfo)
+     a22:	b8 21 00 00 00       	mov    $0x21,%eax
+     a27:	89 e1                	mov    %esp,%ecx
+     a29:	ba 30 0a 00 00       	mov    $0xa30,%edx
+     a2e:	0f 34                	sysenter
+     a30:	c3                   	ret
+
+00000a31 <clone>:
+SYSCALL(clone)
+     a31:	b8 22 00 00 00       	mov    $0x22,%eax
+     a36:	89 e1                	mov    %esp,%ecx
+     a38:	ba 3f 0a 00 00       	mov    $0xa3f,%edx
+     a3d:	0f 34                	sysenter
+     a3f:	c3                   	ret
+
+00000a40 <join>:
+SYSCALL(join)
+     a40:	b8 23 00 00 00       	mov    $0x23,%eax
+     a45:	89 e1                	mov    %esp,%ecx
+     a47:	ba 4e 0a 00 00       	mov    $0xa4e,%edx
+     a4c:	0f 34                	sysenter
+     a4e:	c3                   	ret
+
+00000a4f <futex_wait>:
+SYSCALL(futex_wait)
+     a4f:	b8 24 00 00 00       	mov    $0x24,%eax
+     a54:	89 e1                	mov    %esp,%ecx
+     a56:	ba 5d 0a 00 00       	mov    $0xa5d,%edx
+     a5b:	0f 34                	sysenter
+     a5d:	c3                   	ret
+
+00000a5e <futex_wake>:
+SYSCALL(futex_wake)
+     a5e:	b8 25 00 00 00       	mov    $0x25,%eax
+     a63:	89 e1                	mov    %esp,%ecx
+     a65:	ba 6c 0a 00 00       	mov    $0xa6c,%edx
+     a6a:	0f 34                	sysenter
+     a6c:	c3                   	ret
+
+00000a6d <setaffinity>:
+SYSCALL(setaffinity)
+     a6d:	b8 26 00 00 00       	mov    $0x26,%eax
+     a72:	89 e1                	mov    %esp,%ecx
+     a74:	ba 7b 0a 00 00       	mov    $0xa7b,%edx
+     a79:	0f 34                	sysenter
+     a7b:	c3                   	ret
+
+00000a7c <getaffinity>:
+SYSCALL(getaffinity)
+     a7c:	b8 27 00 00 00       	mov    $0x27,%eax
+     a81:	89 e1                	mov    %esp,%ecx
+     a83:	ba 8a 0a 00 00       	mov    $0xa8a,%edx
+     a88:	0f 34                	sysenter
+     a8a:	c3                   	ret
+
+00000a8b <clock_gettime>:
+SYSCALL(clock_gettime)
+     a8b:	b8 28 00 00 00       	mov    $0x28,%eax
+     a90:	89 e1                	mov    %esp,%ecx
+     a92:	ba 99 0a 00 00       	mov    $0xa99,%edx
+     a97:	0f 34                	sysenter
+     a99:	c3                   	ret
+
+00000a9a <msleep>:
+SYSCALL(msleep)
+     a9a:	b8 29 00 00 00       	mov    $0x29,%eax
+     a9f:	89 e1                	mov    %esp,%ecx
+     aa1:	ba a8 0a 00 00       	mov    $0xaa8,%edx
+     aa6:	0f 34                	sysenter
+     aa8:	c3                   	ret
+
+00000aa9 <lockstat>:
+SYSCALL(lockstat)
+     aa9:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     aae:	89 e1                	mov    %esp,%ecx
+     ab0:	ba b7 0a 00 00       	mov    $0xab7,%edx
+     ab5:	0f 34                	sysenter
+     ab7:	c3                   	ret
+
+00000ab8 <bstat>:
+SYSCALL(bstat)
+     ab8:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     abd:	89 e1                	mov    %esp,%ecx
+     abf:	ba c6 0a 00 00       	mov    $0xac6,%edx
+     ac4:	0f 34                	sysenter
+     ac6:	c3                   	ret
+
+00000ac7 <iostat>:
+SYSCALL(iostat)
+     ac7:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     acc:	89 e1                	mov    %esp,%ecx
+     ace:	ba d5 0a 00 00       	mov    $0xad5,%edx
+     ad3:	0f 34                	sysenter
+     ad5:	c3                   	ret
+
+00000ad6 <fsync>:
+SYSCALL(fsync)
+     ad6:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     adb:	89 e1                	mov    %esp,%ecx
+     add:	ba e4 0a 00 00       	mov    $0xae4,%edx
+     ae2:	0f 34                	sysenter
+     ae4:	c3                   	ret
+
+00000ae5 <pread>:
+SYSCALL(pread)
+     ae5:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     aea:	89 e1                	mov    %esp,%ecx
+     aec:	ba f3 0a 00 00       	mov    $0xaf3,%edx
+     af1:	0f 34                	sysenter
+     af3:	c3                   	ret
+
+00000af4 <pwrite>:
+SYSCALL(pwrite)
+     af4:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     af9:	89 e1                	mov    %esp,%ecx
+     afb:	ba 02 0b 00 00       	mov    $0xb02,%edx
+     b00:	0f 34                	sysenter
+     b02:	c3                   	ret
+
+00000b03 <readv>:
+SYSCALL(readv)
+     b03:	b8 30 00 00 00       	mov    $0x30,%eax
+     b08:	89 e1                	mov    %esp,%ecx
+     b0a:	ba 11 0b 00 00       	mov    $0xb11,%edx
+     b0f:	0f 34                	sysenter
+     b11:	c3                   	ret
+
+00000b12 <writev>:
+SYSCALL(writev)
+     b12:	b8 31 00 00 00       	mov    $0x31,%eax
+     b17:	89 e1                	mov    %esp,%ecx
+     b19:	ba 20 0b 00 00       	mov    $0xb20,%edx
+     b1e:	0f 34                	sysenter
+     b20:	c3                   	ret
+
+00000b21 <sendfile>:
+SYSCALL(sendfile)
+     b21:	b8 32 00 00 00       	mov    $0x32,%eax
+     b26:	89 e1                	mov    %esp,%ecx
+     b28:	ba 2f 0b 00 00       	mov    $0xb2f,%edx
+     b2d:	0f 34                	sysenter
+     b2f:	c3                   	ret
+
+00000b30 <fcntl>:
+SYSCALL(fcntl)
+     b30:	b8 33 00 00 00       	mov    $0x33,%eax
+     b35:	89 e1                	mov    %esp,%ecx
+     b37:	ba 3e 0b 00 00       	mov    $0xb3e,%edx
+     b3c:	0f 34                	sysenter
+     b3e:	c3                   	ret
+
+00000b3f <mount>:
+SYSCALL(mount)
+     b3f:	b8 34 00 00 00       	mov    $0x34,%eax
+     b44:	89 e1                	mov    %esp,%ecx
+     b46:	ba 4d 0b 00 00       	mov    $0xb4d,%edx
+     b4b:	0f 34                	sysenter
+     b4d:	c3                   	ret
+
+00000b4e <getdents>:
+SYSCALL(getdents)
+     b4e:	b8 35 00 00 00       	mov    $0x35,%eax
+     b53:	89 e1                	mov    %esp,%ecx
+     b55:	ba 5c 0b 00 00       	mov    $0xb5c,%edx
+     b5a:	0f 34                	sysenter
+     b5c:	c3                   	ret
+
+00000b5d <fstatat>:
+SYSCALL(fstatat)
+     b5d:	b8 36 00 00 00       	mov    $0x36,%eax
+     b62:	89 e1                	mov    %esp,%ecx
+     b64:	ba 6b 0b 00 00       	mov    $0xb6b,%edx
+     b69:	0f 34                	sysenter
+     b6b:	c3                   	ret
+
+00000b6c <sysstat>:
+SYSCALL(sysstat)
+     b6c:	b8 37 00 00 00       	mov    $0x37,%eax
+     b71:	89 e1                	mov    %esp,%ecx
+     b73:	ba 7a 0b 00 00       	mov    $0xb7a,%edx
+     b78:	0f 34                	sysenter
+     b7a:	c3                   	ret
+
+00000b7b <ringenter>:
+SYSCALL(ringenter)
+     b7b:	b8 38 00 00 00       	mov    $0x38,%eax
+     b80:	89 e1                	mov    %esp,%ecx
+     b82:	ba 89 0b 00 00       	mov    $0xb89,%edx
+     b87:	0f 34                	sysenter
+     b89:	c3                   	ret
+
+00000b8a <trace>:
+SYSCALL(trace)
+     b8a:	b8 39 00 00 00       	mov    $0x39,%eax
+     b8f:	89 e1                	mov    %esp,%ecx
+     b91:	ba 98 0b 00 00       	mov    $0xb98,%edx
+     b96:	0f 34                	sysenter
+     b98:	c3                   	ret
+
+00000b99 <memstat>:
+SYSCALL(memstat)
+     b99:	b8 3a 00 00 00       	mov    $0x3a,%eax
+     b9e:	89 e1                	mov    %esp,%ecx
+     ba0:	ba a7 0b 00 00       	mov    $0xba7,%edx
+     ba5:	0f 34                	sysenter
+     ba7:	c3                   	ret
+
+00000ba8 <shmget>:
+SYSCALL(shmget)
+     ba8:	b8 3b 00 00 00       	mov    $0x3b,%eax
+     bad:	89 e1                	mov    %esp,%ecx
+     baf:	ba b6 0b 00 00       	mov    $0xbb6,%edx
+     bb4:	0f 34                	sysenter
+     bb6:	c3                   	ret
+
+00000bb7 <shmat>:
+SYSCALL(shmat)
+     bb7:	b8 3c 00 00 00       	mov    $0x3c,%eax
+     bbc:	89 e1                	mov    %esp,%ecx
+     bbe:	ba c5 0b 00 00       	mov    $0xbc5,%edx
+     bc3:	0f 34                	sysenter
+     bc5:	c3                   	ret
+
+00000bc6 <shmdt>:
+SYSCALL(shmdt)
+     bc6:	b8 3d 00 00 00       	mov    $0x3d,%eax
+     bcb:	89 e1                	mov    %esp,%ecx
+     bcd:	ba d4 0b 00 00       	mov    $0xbd4,%edx
+     bd2:	0f 34                	sysenter
+     bd4:	c3                   	ret
+
+00000bd5 <irqstat>:
+SYSCALL(irqstat)
+     bd5:	b8 3e 00 00 00       	mov    $0x3e,%eax
+     bda:	89 e1                	mov    %esp,%ecx
+     bdc:	ba e3 0b 00 00       	mov    $0xbe3,%edx
+     be1:	0f 34                	sysenter
+     be3:	c3                   	ret
+
+00000be4 <irqroute>:
+SYSCALL(irqroute)
+     be4:	b8 3f 00 00 00       	mov    $0x3f,%eax
+     be9:	89 e1                	mov    %esp,%ecx
+     beb:	ba f2 0b 00 00       	mov    $0xbf2,%edx
+     bf0:	0f 34                	sysenter
+     bf2:	c3                   	ret
+
+00000bf3 <putc>:
+  char buf[64];
+};
+
+static void
+putc(struct out *o, char c)
+{
+     bf3:	55                   	push   %ebp
+     bf4:	89 e5                	mov    %esp,%ebp
+     bf6:	56                   	push   %esi
+     bf7:	53                   	push   %ebx
+     bf8:	89 c3                	mov    %eax,%ebx
+     bfa:	89 d6                	mov    %edx,%esi
+  if(o->n == sizeof(o->buf)){
+     bfc:	8b 40 04             	mov    0x4(%eax),%eax
+     bff:	83 f8 40             	cmp    $0x40,%eax
+     c02:	74 16                	je     c1a <putc+0x27>
+    bufwrite(o->fd, o->buf, o->n);
+    o->n = 0;
+  }
+  o->buf[o->n++] = c;
+     c04:	8b 43 04             	mov    0x4(%ebx),%eax
+     c07:	8d 50 01             	lea    0x1(%eax),%edx
+     c0a:	89 53 04             	mov    %edx,0x4(%ebx)
+     c0d:	89 f1                	mov    %esi,%ecx
+     c0f:	88 4c 03 08          	mov    %cl,0x8(%ebx,%eax,1)
+}
+     c13:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     c16:	5b                   	pop    %ebx
+     c17:	5e                   	pop    %esi
+     c18:	5d                   	pop    %ebp
+     c19:	c3                   	ret
+    bufwrite(o->fd, o->buf, o->n);
+     c1a:	8d 53 08             	lea    0x8(%ebx),%edx
+     c1d:	83 ec 04             	sub    $0x4,%esp
+     c20:	50                   	push   %eax
+     c21:	52                   	push   %edx
+     c22:	ff 33                	push   (%ebx)
+     c24:	e8 b2 f9 ff ff       	call   5db <bufwrite>
+    o->n = 0;
+     c29:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     c30:	83 c4 10             	add    $0x10,%esp
+     c33:	eb cf                	jmp    c04 <putc+0x11>
+
+00000c35 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     c35:	55                   	push   %ebp
+     c36:	89 e5                	mov    %esp,%ebp
+     c38:	57                   	push   %edi
+     c39:	56                   	push   %esi
+     c3a:	53                   	push   %ebx
+     c3b:	83 ec 2c             	sub    $0x2c,%esp
+     c3e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     c41:	89 d0                	mov    %edx,%eax
+     c43:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+     c45:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     c49:	0f 95 c1             	setne  %cl
+     c4c:	c1 ea 1f             	shr    $0x1f,%edx
+     c4f:	84 d1                	test   %dl,%cl
+     c51:	74 44                	je     c97 <printint+0x62>
+    neg = 1;
+    x = -xx;
+     c53:	f7 d8                	neg    %eax
+     c55:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+     c57:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     c5e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+     c63:	89 c8                	mov    %ecx,%eax
+     c65:	ba 00 00 00 00       	mov    $0x0,%edx
+     c6a:	f7 f6                	div    %esi
+     c6c:	89 df                	mov    %ebx,%edi
+     c6e:	83 c3 01             	add    $0x1,%ebx
+     c71:	0f b6 92 04 14 00 00 	movzbl 0x1404(%edx),%edx
+     c78:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+     c7c:	89 ca                	mov    %ecx,%edx
+     c7e:	89 c1                	mov    %eax,%ecx
+     c80:	39 f2                	cmp    %esi,%edx
+     c82:	73 df                	jae    c63 <printint+0x2e>
+  if(neg)
+     c84:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     c88:	74 31                	je     cbb <printint+0x86>
+    buf[i++] = '-';
+     c8a:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+     c8f:	8d 5f 02             	lea    0x2(%edi),%ebx
+     c92:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     c95:	eb 17                	jmp    cae <printint+0x79>
+    x = xx;
+     c97:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+     c99:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     ca0:	eb bc                	jmp    c5e <printint+0x29>
+
+  while(--i >= 0)
+    putc(o, buf[i]);
+     ca2:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+     ca7:	89 f0                	mov    %esi,%eax
+     ca9:	e8 45 ff ff ff       	call   bf3 <putc>
+  while(--i >= 0)
+     cae:	83 eb 01             	sub    $0x1,%ebx
+     cb1:	79 ef                	jns    ca2 <printint+0x6d>
+}
+     cb3:	83 c4 2c             	add    $0x2c,%esp
+     cb6:	5b                   	pop    %ebx
+     cb7:	5e                   	pop    %esi
+     cb8:	5f                   	pop    %edi
+     cb9:	5d                   	pop    %ebp
+     cba:	c3                   	ret
+     cbb:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     cbe:	eb ee                	jmp    cae <printint+0x79>
+
+00000cc0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     cc0:	55                   	push   %ebp
+     cc1:	89 e5                	mov    %esp,%ebp
+     cc3:	57                   	push   %edi
+     cc4:	56                   	push   %esi
+     cc5:	53                   	push   %ebx
+     cc6:	83 ec 6c             	sub    $0x6c,%esp
+  int c, i, state;
+  uint *ap;
+  struct out out, *o;
+
+  o = &out;
+  o->fd = fd;
+     cc9:	8b 45 08             	mov    0x8(%ebp),%eax
+     ccc:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  o->n = 0;
+     ccf:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+     cd6:	8d 45 10             	lea    0x10(%ebp),%eax
+     cd9:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  state = 0;
+     cdc:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+     ce1:	bb 00 00 00 00       	mov    $0x0,%ebx
+     ce6:	eb 14                	jmp    cfc <printf+0x3c>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(o, c);
+     ce8:	89 fa                	mov    %edi,%edx
+     cea:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     ced:	e8 01 ff ff ff       	call   bf3 <putc>
+     cf2:	eb 05                	jmp    cf9 <printf+0x39>
+      }
+    } else if(state == '%'){
+     cf4:	83 fe 25             	cmp    $0x25,%esi
+     cf7:	74 25                	je     d1e <printf+0x5e>
+  for(i = 0; fmt[i]; i++){
+     cf9:	83 c3 01             	add    $0x1,%ebx
+     cfc:	8b 45 0c             	mov    0xc(%ebp),%eax
+     cff:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+     d03:	84 c0                	test   %al,%al
+     d05:	0f 84 20 01 00 00    	je     e2b <printf+0x16b>
+    c = fmt[i] & 0xff;
+     d0b:	0f be f8             	movsbl %al,%edi
+     d0e:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     d11:	85 f6                	test   %esi,%esi
+     d13:	75 df                	jne    cf4 <printf+0x34>
+      if(c == '%'){
+     d15:	83 f8 25             	cmp    $0x25,%eax
+     d18:	75 ce                	jne    ce8 <printf+0x28>
+        state = '%';
+     d1a:	89 c6                	mov    %eax,%esi
+     d1c:	eb db                	jmp    cf9 <printf+0x39>
+      if(c == 'd'){
+     d1e:	83 f8 25             	cmp    $0x25,%eax
+     d21:	0f 84 cf 00 00 00    	je     df6 <printf+0x136>
+     d27:	0f 8c dd 00 00 00    	jl     e0a <printf+0x14a>
+     d2d:	83 f8 78             	cmp    $0x78,%eax
+     d30:	0f 8f d4 00 00 00    	jg     e0a <printf+0x14a>
+     d36:	83 f8 63             	cmp    $0x63,%eax
+     d39:	0f 8c cb 00 00 00    	jl     e0a <printf+0x14a>
+     d3f:	83 e8 63             	sub    $0x63,%eax
+     d42:	83 f8 15             	cmp    $0x15,%eax
+     d45:	0f 87 bf 00 00 00    	ja     e0a <printf+0x14a>
+     d4b:	ff 24 85 ac 13 00 00 	jmp    *0x13ac(,%eax,4)
+        printint(o, *ap, 10, 1);
+     d52:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     d55:	8b 17                	mov    (%edi),%edx
+     d57:	83 ec 0c             	sub    $0xc,%esp
+     d5a:	6a 01                	push   $0x1
+     d5c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     d61:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d64:	e8 cc fe ff ff       	call   c35 <printint>
+        ap++;
+     d69:	83 c7 04             	add    $0x4,%edi
+     d6c:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     d6f:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(o, '%');
+        putc(o, c);
+      }
+      state = 0;
+     d72:	be 00 00 00 00       	mov    $0x0,%esi
+     d77:	eb 80                	jmp    cf9 <printf+0x39>
+        printint(o, *ap, 16, 0);
+     d79:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     d7c:	8b 17                	mov    (%edi),%edx
+     d7e:	83 ec 0c             	sub    $0xc,%esp
+     d81:	6a 00                	push   $0x0
+     d83:	b9 10 00 00 00       	mov    $0x10,%ecx
+     d88:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d8b:	e8 a5 fe ff ff       	call   c35 <printint>
+        ap++;
+     d90:	83 c7 04             	add    $0x4,%edi
+     d93:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     d96:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d99:	be 00 00 00 00       	mov    $0x0,%esi
+     d9e:	e9 56 ff ff ff       	jmp    cf9 <printf+0x39>
+        s = (char*)*ap;
+     da3:	8b 45 94             	mov    -0x6c(%ebp),%eax
+     da6:	8b 30                	mov    (%eax),%esi
+        ap++;
+     da8:	83 c0 04             	add    $0x4,%eax
+     dab:	89 45 94             	mov    %eax,-0x6c(%ebp)
+        if(s == 0)
+     dae:	85 f6                	test   %esi,%esi
+     db0:	75 15                	jne    dc7 <printf+0x107>
+          s = "(null)";
+     db2:	be a5 13 00 00       	mov    $0x13a5,%esi
+     db7:	eb 0e                	jmp    dc7 <printf+0x107>
+          putc(o, *s);
+     db9:	0f be d2             	movsbl %dl,%edx
+     dbc:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     dbf:	e8 2f fe ff ff       	call   bf3 <putc>
+          s++;
+     dc4:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+     dc7:	0f b6 16             	movzbl (%esi),%edx
+     dca:	84 d2                	test   %dl,%dl
+     dcc:	75 eb                	jne    db9 <printf+0xf9>
+      state = 0;
+     dce:	be 00 00 00 00       	mov    $0x0,%esi
+     dd3:	e9 21 ff ff ff       	jmp    cf9 <printf+0x39>
+        putc(o, *ap);
+     dd8:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     ddb:	0f be 17             	movsbl (%edi),%edx
+     dde:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     de1:	e8 0d fe ff ff       	call   bf3 <putc>
+        ap++;
+     de6:	83 c7 04             	add    $0x4,%edi
+     de9:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+      state = 0;
+     dec:	be 00 00 00 00       	mov    $0x0,%esi
+     df1:	e9 03 ff ff ff       	jmp    cf9 <printf+0x39>
+        putc(o, c);
+     df6:	89 fa                	mov    %edi,%edx
+     df8:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     dfb:	e8 f3 fd ff ff       	call   bf3 <putc>
+      state = 0;
+     e00:	be 00 00 00 00       	mov    $0x0,%esi
+     e05:	e9 ef fe ff ff       	jmp    cf9 <printf+0x39>
+        putc(o, '%');
+     e0a:	ba 25 00 00 00       	mov    $0x25,%edx
+     e0f:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     e12:	e8 dc fd ff ff       	call   bf3 <putc>
+        putc(o, c);
+     e17:	89 fa                	mov    %edi,%edx
+     e19:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     e1c:	e8 d2 fd ff ff       	call   bf3 <putc>
+      state = 0;
+     e21:	be 00 00 00 00       	mov    $0x0,%esi
+     e26:	e9 ce fe ff ff       	jmp    cf9 <printf+0x39>
+    }
+  }
+  if(o->n > 0)
+     e2b:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     e2e:	85 c0                	test   %eax,%eax
+     e30:	7f 08                	jg     e3a <printf+0x17a>
+    bufwrite(fd, o->buf, o->n);
+}
+     e32:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e35:	5b                   	pop    %ebx
+     e36:	5e                   	pop    %esi
+     e37:	5f                   	pop    %edi
+     e38:	5d                   	pop    %ebp
+     e39:	c3                   	ret
+    bufwrite(fd, o->buf, o->n);
+     e3a:	83 ec 04             	sub    $0x4,%esp
+     e3d:	50                   	push   %eax
+     e3e:	8d 45 a8             	lea    -0x58(%ebp),%eax
+     e41:	50                   	push   %eax
+     e42:	ff 75 08             	push   0x8(%ebp)
+     e45:	e8 91 f7 ff ff       	call   5db <bufwrite>
+     e4a:	83 c4 10             	add    $0x10,%esp
+}
+     e4d:	eb e3                	jmp    e32 <printf+0x172>
+
+00000e4f <largefree>:
+  return &b->h;
+}
+
+static void
+largefree(Fblock *b)
+{
+     e4f:	55                   	push   %ebp
+     e50:	89 e5                	mov    %esp,%ebp
+     e52:	57                   	push   %edi
+     e53:	56                   	push   %esi
+     e54:	53                   	push   %ebx
+     e55:	83 ec 0c             	sub    $0xc,%esp
+     e58:	89 c1                	mov    %eax,%ecx
+  Fblock **pp, *p, *prev;
+
+  prev = 0;
+     e5a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     e5f:	ba 6c 3b 00 00       	mov    $0x3b6c,%edx
+     e64:	eb 05                	jmp    e6b <largefree+0x1c>
+     e66:	8d 50 08             	lea    0x8(%eax),%edx
+    prev = p;
+     e69:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     e6b:	8b 02                	mov    (%edx),%eax
+     e6d:	85 c0                	test   %eax,%eax
+     e6f:	74 04                	je     e75 <largefree+0x26>
+     e71:	39 c8                	cmp    %ecx,%eax
+     e73:	72 f1                	jb     e66 <largefree+0x17>
+  b->next = p;
+     e75:	89 41 08             	mov    %eax,0x8(%ecx)
+  if(p && (char*)b + b->h.size == (char*)p){
+     e78:	85 c0                	test   %eax,%eax
+     e7a:	74 09                	je     e85 <largefree+0x36>
+     e7c:	8b 31                	mov    (%ecx),%esi
+     e7e:	8d 3c 31             	lea    (%ecx,%esi,1),%edi
+     e81:	39 c7                	cmp    %eax,%edi
+     e83:	74 21                	je     ea6 <largefree+0x57>
+    b->h.size += p->h.size;
+    b->next = p->next;
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+     e85:	85 db                	test   %ebx,%ebx
+     e87:	74 09                	je     e92 <largefree+0x43>
+     e89:	8b 03                	mov    (%ebx),%eax
+     e8b:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+     e8e:	39 ce                	cmp    %ecx,%esi
+     e90:	74 20                	je     eb2 <largefree+0x63>
+    prev->h.size += b->h.size;
+    prev->next = b->next;
+  } else
+    *pp = b;
+     e92:	89 0a                	mov    %ecx,(%edx)
+
+  // Give the top of the heap back.  With threads sharing the
+  // address space sbrk() cannot shrink it; keep the block then.
+  for(pp = &large; (*pp)->next; pp = &(*pp)->next)
+     e94:	be 6c 3b 00 00       	mov    $0x3b6c,%esi
+     e99:	8b 1e                	mov    (%esi),%ebx
+     e9b:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+     e9f:	74 1d                	je     ebe <largefree+0x6f>
+     ea1:	8d 73 08             	lea    0x8(%ebx),%esi
+     ea4:	eb f3                	jmp    e99 <largefree+0x4a>
+    b->h.size += p->h.size;
+     ea6:	03 30                	add    (%eax),%esi
+     ea8:	89 31                	mov    %esi,(%ecx)
+    b->next = p->next;
+     eaa:	8b 40 08             	mov    0x8(%eax),%eax
+     ead:	89 41 08             	mov    %eax,0x8(%ecx)
+     eb0:	eb d3                	jmp    e85 <largefree+0x36>
+    prev->h.size += b->h.size;
+     eb2:	03 01                	add    (%ecx),%eax
+     eb4:	89 03                	mov    %eax,(%ebx)
+    prev->next = b->next;
+     eb6:	8b 41 08             	mov    0x8(%ecx),%eax
+     eb9:	89 43 08             	mov    %eax,0x8(%ebx)
+     ebc:	eb d6                	jmp    e94 <largefree+0x45>
+    ;
+  b = *pp;
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     ebe:	89 df                	mov    %ebx,%edi
+     ec0:	03 3b                	add    (%ebx),%edi
+     ec2:	83 ec 0c             	sub    $0xc,%esp
+     ec5:	6a 00                	push   $0x0
+     ec7:	e8 93 fa ff ff       	call   95f <sbrk>
+     ecc:	83 c4 10             	add    $0x10,%esp
+     ecf:	39 c7                	cmp    %eax,%edi
+     ed1:	74 08                	je     edb <largefree+0x8c>
+    *pp = 0;
+}
+     ed3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ed6:	5b                   	pop    %ebx
+     ed7:	5e                   	pop    %esi
+     ed8:	5f                   	pop    %edi
+     ed9:	5d                   	pop    %ebp
+     eda:	c3                   	ret
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     edb:	8b 03                	mov    (%ebx),%eax
+     edd:	f7 d8                	neg    %eax
+     edf:	83 ec 0c             	sub    $0xc,%esp
+     ee2:	50                   	push   %eax
+     ee3:	e8 77 fa ff ff       	call   95f <sbrk>
+     ee8:	83 c4 10             	add    $0x10,%esp
+     eeb:	83 f8 ff             	cmp    $0xffffffff,%eax
+     eee:	74 e3                	je     ed3 <largefree+0x84>
+    *pp = 0;
+     ef0:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+     ef6:	eb db                	jmp    ed3 <largefree+0x84>
+
+00000ef8 <more>:
+{
+     ef8:	55                   	push   %ebp
+     ef9:	89 e5                	mov    %esp,%ebp
+     efb:	56                   	push   %esi
+     efc:	53                   	push   %ebx
+     efd:	89 c6                	mov    %eax,%esi
+  pad = -(uint)sbrk(0) & 7;
+     eff:	83 ec 0c             	sub    $0xc,%esp
+     f02:	6a 00                	push   $0x0
+     f04:	e8 56 fa ff ff       	call   95f <sbrk>
+     f09:	f7 d8                	neg    %eax
+     f0b:	89 c3                	mov    %eax,%ebx
+     f0d:	83 e3 07             	and    $0x7,%ebx
+  if((p = sbrk(n + pad)) == (char*)-1)
+     f10:	01 de                	add    %ebx,%esi
+     f12:	89 34 24             	mov    %esi,(%esp)
+     f15:	e8 45 fa ff ff       	call   95f <sbrk>
+     f1a:	83 c4 10             	add    $0x10,%esp
+     f1d:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f20:	74 09                	je     f2b <more+0x33>
+  return p + pad;
+     f22:	01 d8                	add    %ebx,%eax
+}
+     f24:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f27:	5b                   	pop    %ebx
+     f28:	5e                   	pop    %esi
+     f29:	5d                   	pop    %ebp
+     f2a:	c3                   	ret
+    return 0;
+     f2b:	b8 00 00 00 00       	mov    $0x0,%eax
+     f30:	eb f2                	jmp    f24 <more+0x2c>
+
+00000f32 <slaballoc>:
+{
+     f32:	55                   	push   %ebp
+     f33:	89 e5                	mov    %esp,%ebp
+     f35:	56                   	push   %esi
+     f36:	53                   	push   %ebx
+     f37:	89 c6                	mov    %eax,%esi
+  n = 1 << (MINSHIFT + c);
+     f39:	8d 48 04             	lea    0x4(%eax),%ecx
+     f3c:	bb 01 00 00 00       	mov    $0x1,%ebx
+     f41:	d3 e3                	shl    %cl,%ebx
+  if(slab + n > slabend){
+     f43:	89 d8                	mov    %ebx,%eax
+     f45:	03 05 68 3b 00 00    	add    0x3b68,%eax
+     f4b:	39 05 64 3b 00 00    	cmp    %eax,0x3b64
+     f51:	72 17                	jb     f6a <slaballoc+0x38>
+  h = (Header*)slab;
+     f53:	a1 68 3b 00 00       	mov    0x3b68,%eax
+  slab += n;
+     f58:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+     f5b:	89 15 68 3b 00 00    	mov    %edx,0x3b68
+  h->size = n;
+     f61:	89 18                	mov    %ebx,(%eax)
+  h->class = c;
+     f63:	89 70 04             	mov    %esi,0x4(%eax)
+}
+     f66:	5b                   	pop    %ebx
+     f67:	5e                   	pop    %esi
+     f68:	5d                   	pop    %ebp
+     f69:	c3                   	ret
+    if((p = more(SLABSZ)) == 0)
+     f6a:	b8 00 40 00 00       	mov    $0x4000,%eax
+     f6f:	e8 84 ff ff ff       	call   ef8 <more>
+     f74:	85 c0                	test   %eax,%eax
+     f76:	74 ee                	je     f66 <slaballoc+0x34>
+    if(p != slabend)
+     f78:	39 05 64 3b 00 00    	cmp    %eax,0x3b64
+     f7e:	74 05                	je     f85 <slaballoc+0x53>
+      slab = p;
+     f80:	a3 68 3b 00 00       	mov    %eax,0x3b68
+    slabend = p + SLABSZ;
+     f85:	05 00 40 00 00       	add    $0x4000,%eax
+     f8a:	a3 64 3b 00 00       	mov    %eax,0x3b64
+     f8f:	eb c2                	jmp    f53 <slaballoc+0x21>
+
+00000f91 <largealloc>:
+{
+     f91:	55                   	push   %ebp
+     f92:	89 e5                	mov    %esp,%ebp
+     f94:	56                   	push   %esi
+     f95:	53                   	push   %ebx
+     f96:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     f98:	b9 6c 3b 00 00       	mov    $0x3b6c,%ecx
+     f9d:	8b 01                	mov    (%ecx),%eax
+     f9f:	85 c0                	test   %eax,%eax
+     fa1:	74 36                	je     fd9 <largealloc+0x48>
+    if(b->h.size < n)
+     fa3:	8b 10                	mov    (%eax),%edx
+     fa5:	39 da                	cmp    %ebx,%edx
+     fa7:	72 24                	jb     fcd <largealloc+0x3c>
+    if(b->h.size - n > SMALLMAX){
+     fa9:	29 da                	sub    %ebx,%edx
+     fab:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+     fb1:	76 1f                	jbe    fd2 <largealloc+0x41>
+      rest = (Fblock*)((char*)b + n);
+     fb3:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+      rest->h.size = b->h.size - n;
+     fb6:	89 16                	mov    %edx,(%esi)
+      rest->h.class = LARGE;
+     fb8:	c7 46 04 09 00 00 00 	movl   $0x9,0x4(%esi)
+      rest->next = b->next;
+     fbf:	8b 50 08             	mov    0x8(%eax),%edx
+     fc2:	89 56 08             	mov    %edx,0x8(%esi)
+      *pp = rest;
+     fc5:	89 31                	mov    %esi,(%ecx)
+      b->h.size = n;
+     fc7:	89 18                	mov    %ebx,(%eax)
+}
+     fc9:	5b                   	pop    %ebx
+     fca:	5e                   	pop    %esi
+     fcb:	5d                   	pop    %ebp
+     fcc:	c3                   	ret
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     fcd:	8d 48 08             	lea    0x8(%eax),%ecx
+     fd0:	eb cb                	jmp    f9d <largealloc+0xc>
+      *pp = b->next;
+     fd2:	8b 50 08             	mov    0x8(%eax),%edx
+     fd5:	89 11                	mov    %edx,(%ecx)
+    return &b->h;
+     fd7:	eb f0                	jmp    fc9 <largealloc+0x38>
+  if((b = more(n)) == 0)
+     fd9:	89 d8                	mov    %ebx,%eax
+     fdb:	e8 18 ff ff ff       	call   ef8 <more>
+     fe0:	85 c0                	test   %eax,%eax
+     fe2:	74 e5                	je     fc9 <largealloc+0x38>
+  b->h.size = n;
+     fe4:	89 18                	mov    %ebx,(%eax)
+  b->h.class = LARGE;
+     fe6:	c7 40 04 09 00 00 00 	movl   $0x9,0x4(%eax)
+  return &b->h;
+     fed:	eb da                	jmp    fc9 <largealloc+0x38>
+
+00000fef <free>:
+
+void
+free(void *ap)
+{
+     fef:	55                   	push   %ebp
+     ff0:	89 e5                	mov    %esp,%ebp
+     ff2:	56                   	push   %esi
+     ff3:	53                   	push   %ebx
+     ff4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+
+  if(ap == 0)
+     ff7:	85 db                	test   %ebx,%ebx
+     ff9:	74 3b                	je     1036 <free+0x47>
+    return;
+  h = (Header*)ap - 1;
+     ffb:	8d 73 f8             	lea    -0x8(%ebx),%esi
+  lock_acquire(&lock);
+     ffe:	83 ec 0c             	sub    $0xc,%esp
+    1001:	68 60 3b 00 00       	push   $0x3b60
+    1006:	e8 9c 01 00 00       	call   11a7 <lock_acquire>
+  if(h->class == LARGE)
+    100b:	8b 43 fc             	mov    -0x4(%ebx),%eax
+    100e:	83 c4 10             	add    $0x10,%esp
+    1011:	83 f8 09             	cmp    $0x9,%eax
+    1014:	74 27                	je     103d <free+0x4e>
+    largefree((Fblock*)h);
+  else {
+    ((Fblock*)h)->next = freelist[h->class];
+    1016:	8b 14 85 80 3b 00 00 	mov    0x3b80(,%eax,4),%edx
+    101d:	89 13                	mov    %edx,(%ebx)
+    freelist[h->class] = (Fblock*)h;
+    101f:	89 34 85 80 3b 00 00 	mov    %esi,0x3b80(,%eax,4)
+  }
+  lock_release(&lock);
+    1026:	83 ec 0c             	sub    $0xc,%esp
+    1029:	68 60 3b 00 00       	push   $0x3b60
+    102e:	e8 88 01 00 00       	call   11bb <lock_release>
+    1033:	83 c4 10             	add    $0x10,%esp
+}
+    1036:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1039:	5b                   	pop    %ebx
+    103a:	5e                   	pop    %esi
+    103b:	5d                   	pop    %ebp
+    103c:	c3                   	ret
+    largefree((Fblock*)h);
+    103d:	89 f0                	mov    %esi,%eax
+    103f:	e8 0b fe ff ff       	call   e4f <largefree>
+    1044:	eb e0                	jmp    1026 <free+0x37>
+
+00001046 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1046:	55                   	push   %ebp
+    1047:	89 e5                	mov    %esp,%ebp
+    1049:	53                   	push   %ebx
+    104a:	83 ec 04             	sub    $0x4,%esp
+    104d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+  uint n;
+  int c;
+
+  if(nbytes > 0x7fffffff - sizeof(Header) - 7)
+    1050:	81 fb f0 ff ff 7f    	cmp    $0x7ffffff0,%ebx
+    1056:	0f 87 8b 00 00 00    	ja     10e7 <malloc+0xa1>
+    return 0;
+  n = (nbytes + sizeof(Header) + 7) & ~7;
+    105c:	83 c3 0f             	add    $0xf,%ebx
+    105f:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(n < sizeof(Fblock))
+    1062:	83 fb 0b             	cmp    $0xb,%ebx
+    1065:	77 05                	ja     106c <malloc+0x26>
+    n = sizeof(Fblock);
+    1067:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  lock_acquire(&lock);
+    106c:	83 ec 0c             	sub    $0xc,%esp
+    106f:	68 60 3b 00 00       	push   $0x3b60
+    1074:	e8 2e 01 00 00       	call   11a7 <lock_acquire>
+  if(n <= SMALLMAX){
+    1079:	83 c4 10             	add    $0x10,%esp
+    107c:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+    1082:	77 58                	ja     10dc <malloc+0x96>
+    for(c = 0; (1 << (MINSHIFT + c)) < n; c++)
+    1084:	ba 00 00 00 00       	mov    $0x0,%edx
+    1089:	eb 03                	jmp    108e <malloc+0x48>
+    108b:	83 c2 01             	add    $0x1,%edx
+    108e:	8d 4a 04             	lea    0x4(%edx),%ecx
+    1091:	b8 01 00 00 00       	mov    $0x1,%eax
+    1096:	d3 e0                	shl    %cl,%eax
+    1098:	39 d8                	cmp    %ebx,%eax
+    109a:	72 ef                	jb     108b <malloc+0x45>
+      ;
+    if(freelist[c]){
+    109c:	8b 04 95 80 3b 00 00 	mov    0x3b80(,%edx,4),%eax
+    10a3:	85 c0                	test   %eax,%eax
+    10a5:	74 2a                	je     10d1 <malloc+0x8b>
+      h = &freelist[c]->h;
+    10a7:	89 c3                	mov    %eax,%ebx
+      freelist[c] = freelist[c]->next;
+    10a9:	8b 40 08             	mov    0x8(%eax),%eax
+    10ac:	89 04 95 80 3b 00 00 	mov    %eax,0x3b80(,%edx,4)
+    } else
+      h = slaballoc(c);
+  } else
+    h = largealloc(n);
+  lock_release(&lock);
+    10b3:	83 ec 0c             	sub    $0xc,%esp
+    10b6:	68 60 3b 00 00       	push   $0x3b60
+    10bb:	e8 fb 00 00 00       	call   11bb <lock_release>
+  return h ? (void*)(h + 1) : 0;
+    10c0:	83 c4 10             	add    $0x10,%esp
+    10c3:	85 db                	test   %ebx,%ebx
+    10c5:	74 03                	je     10ca <malloc+0x84>
+    10c7:	83 c3 08             	add    $0x8,%ebx
+}
+    10ca:	89 d8                	mov    %ebx,%eax
+    10cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10cf:	c9                   	leave
+    10d0:	c3                   	ret
+      h = slaballoc(c);
+    10d1:	89 d0                	mov    %edx,%eax
+    10d3:	e8 5a fe ff ff       	call   f32 <slaballoc>
+    10d8:	89 c3                	mov    %eax,%ebx
+    10da:	eb d7                	jmp    10b3 <malloc+0x6d>
+    h = largealloc(n);
+    10dc:	89 d8                	mov    %ebx,%eax
+    10de:	e8 ae fe ff ff       	call   f91 <largealloc>
+    10e3:	89 c3                	mov    %eax,%ebx
+    10e5:	eb cc                	jmp    10b3 <malloc+0x6d>
+    return 0;
+    10e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+    10ec:	eb dc                	jmp    10ca <malloc+0x84>
+
+000010ee <tstart>:
+  void *arg;
+};
+
+static void
+tstart(void *a)
+{
+    10ee:	55                   	push   %ebp
+    10ef:	89 e5                	mov    %esp,%ebp
+    10f1:	83 ec 14             	sub    $0x14,%esp
+    10f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+    10f7:	ff 70 04             	push   0x4(%eax)
+    10fa:	ff 10                	call   *(%eax)
+  exit();
+    10fc:	e8 86 f6 ff ff       	call   787 <exit>
+
+00001101 <thread_create>:
+}
+
+// Run fn(arg) in a new thread.  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1101:	55                   	push   %ebp
+    1102:	89 e5                	mov    %esp,%ebp
+    1104:	56                   	push   %esi
+    1105:	53                   	push   %ebx
+  struct tstart *t;
+  char *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    1106:	83 ec 0c             	sub    $0xc,%esp
+    1109:	68 00 10 00 00       	push   $0x1000
+    110e:	e8 33 ff ff ff       	call   1046 <malloc>
+    1113:	83 c4 10             	add    $0x10,%esp
+    1116:	85 c0                	test   %eax,%eax
+    1118:	74 42                	je     115c <thread_create+0x5b>
+    111a:	89 c3                	mov    %eax,%ebx
+    return -1;
+  t = (struct tstart*)stack;
+  t->fn = fn;
+    111c:	8b 45 08             	mov    0x8(%ebp),%eax
+    111f:	89 03                	mov    %eax,(%ebx)
+  t->arg = arg;
+    1121:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1124:	89 43 04             	mov    %eax,0x4(%ebx)
+  if((pid = clone(tstart, stack + TSTACK, t)) < 0)
+    1127:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    112d:	83 ec 04             	sub    $0x4,%esp
+    1130:	53                   	push   %ebx
+    1131:	50                   	push   %eax
+    1132:	68 ee 10 00 00       	push   $0x10ee
+    1137:	e8 f5 f8 ff ff       	call   a31 <clone>
+    113c:	89 c6                	mov    %eax,%esi
+    113e:	83 c4 10             	add    $0x10,%esp
+    1141:	85 c0                	test   %eax,%eax
+    1143:	78 09                	js     114e <thread_create+0x4d>
+    free(stack);
+  return pid;
+}
+    1145:	89 f0                	mov    %esi,%eax
+    1147:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    114a:	5b                   	pop    %ebx
+    114b:	5e                   	pop    %esi
+    114c:	5d                   	pop    %ebp
+    114d:	c3                   	ret
+    free(stack);
+    114e:	83 ec 0c             	sub    $0xc,%esp
+    1151:	53                   	push   %ebx
+    1152:	e8 98 fe ff ff       	call   fef <free>
+    1157:	83 c4 10             	add    $0x10,%esp
+    115a:	eb e9                	jmp    1145 <thread_create+0x44>
+    return -1;
+    115c:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1161:	eb e2                	jmp    1145 <thread_create+0x44>
+
+00001163 <thread_join>:
+
+// Wait for one of this process's threads to exit and free its
+// stack.  Returns its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+    1163:	55                   	push   %ebp
+    1164:	89 e5                	mov    %esp,%ebp
+    1166:	53                   	push   %ebx
+    1167:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    116a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    116d:	50                   	push   %eax
+    116e:	e8 cd f8 ff ff       	call   a40 <join>
+    1173:	89 c3                	mov    %eax,%ebx
+    1175:	83 c4 10             	add    $0x10,%esp
+    1178:	85 c0                	test   %eax,%eax
+    117a:	79 07                	jns    1183 <thread_join+0x20>
+    free((char*)stack - TSTACK);
+  return pid;
+}
+    117c:	89 d8                	mov    %ebx,%eax
+    117e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1181:	c9                   	leave
+    1182:	c3                   	ret
+    free((char*)stack - TSTACK);
+    1183:	83 ec 0c             	sub    $0xc,%esp
+    1186:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1189:	2d 00 10 00 00       	sub    $0x1000,%eax
+    118e:	50                   	push   %eax
+    118f:	e8 5b fe ff ff       	call   fef <free>
+    1194:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    1197:	eb e3                	jmp    117c <thread_join+0x19>
+
+00001199 <lock_init>:
+
+void
+lock_init(lock_t *lk)
+{
+    1199:	55                   	push   %ebp
+    119a:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    119c:	8b 45 08             	mov    0x8(%ebp),%eax
+    119f:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    11a5:	5d                   	pop    %ebp
+    11a6:	c3                   	ret
+
+000011a7 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+    11a7:	55                   	push   %ebp
+    11a8:	89 e5                	mov    %esp,%ebp
+    11aa:	8b 55 08             	mov    0x8(%ebp),%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    11ad:	b8 01 00 00 00       	mov    $0x1,%eax
+    11b2:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    11b5:	85 c0                	test   %eax,%eax
+    11b7:	75 f4                	jne    11ad <lock_acquire+0x6>
+    ;
+}
+    11b9:	5d                   	pop    %ebp
+    11ba:	c3                   	ret
+
+000011bb <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+    11bb:	55                   	push   %ebp
+    11bc:	89 e5                	mov    %esp,%ebp
+    11be:	8b 55 08             	mov    0x8(%ebp),%edx
+    11c1:	b8 00 00 00 00       	mov    $0x0,%eax
+    11c6:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    11c9:	5d                   	pop    %ebp
+    11ca:	c3                   	ret
+
+000011cb <mutex_init>:
+// Are Tricky": state is 0 when free, 1 when held, 2 when held and
+// others may be waiting.  Unlocking an uncontended mutex costs no
+// system call.
+void
+mutex_init(mutex_t *m)
+{
+    11cb:	55                   	push   %ebp
+    11cc:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    11ce:	8b 45 08             	mov    0x8(%ebp),%eax
+    11d1:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    11d7:	5d                   	pop    %ebp
+    11d8:	c3                   	ret
+
+000011d9 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+    11d9:	55                   	push   %ebp
+    11da:	89 e5                	mov    %esp,%ebp
+    11dc:	53                   	push   %ebx
+    11dd:	83 ec 04             	sub    $0x4,%esp
+    11e0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    11e3:	b8 00 00 00 00       	mov    $0x0,%eax
+    11e8:	b9 01 00 00 00       	mov    $0x1,%ecx
+    11ed:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    11f1:	85 c0                	test   %eax,%eax
+    11f3:	74 29                	je     121e <mutex_lock+0x45>
+    return;
+  if(c != 2)
+    11f5:	83 f8 02             	cmp    $0x2,%eax
+    11f8:	74 20                	je     121a <mutex_lock+0x41>
+    11fa:	b8 02 00 00 00       	mov    $0x2,%eax
+    11ff:	f0 87 03             	lock xchg %eax,(%ebx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    1202:	eb 16                	jmp    121a <mutex_lock+0x41>
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    1204:	83 ec 08             	sub    $0x8,%esp
+    1207:	6a 02                	push   $0x2
+    1209:	53                   	push   %ebx
+    120a:	e8 40 f8 ff ff       	call   a4f <futex_wait>
+  asm volatile("lock; xchgl %0, %1" :
+    120f:	b8 02 00 00 00       	mov    $0x2,%eax
+    1214:	f0 87 03             	lock xchg %eax,(%ebx)
+    1217:	83 c4 10             	add    $0x10,%esp
+  while(c != 0){
+    121a:	85 c0                	test   %eax,%eax
+    121c:	75 e6                	jne    1204 <mutex_lock+0x2b>
+    c = xchg(&m->state, 2);
+  }
+}
+    121e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1221:	c9                   	leave
+    1222:	c3                   	ret
+
+00001223 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+    1223:	55                   	push   %ebp
+    1224:	89 e5                	mov    %esp,%ebp
+    1226:	83 ec 08             	sub    $0x8,%esp
+    1229:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    122c:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    1231:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    1235:	83 fa 01             	cmp    $0x1,%edx
+    1238:	75 02                	jne    123c <mutex_unlock+0x19>
+    m->state = 0;
+    futex_wake(&m->state, 1);
+  }
+}
+    123a:	c9                   	leave
+    123b:	c3                   	ret
+    m->state = 0;
+    123c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+    1242:	83 ec 08             	sub    $0x8,%esp
+    1245:	6a 01                	push   $0x1
+    1247:	50                   	push   %eax
+    1248:	e8 11 f8 ff ff       	call   a5e <futex_wake>
+    124d:	83 c4 10             	add    $0x10,%esp
+}
+    1250:	eb e8                	jmp    123a <mutex_unlock+0x17>
+
+00001252 <cond_init>:
+// Condition variable: waiters sleep on a sequence number that
+// every signal bumps, so a signal between the unlock and the
+// futex_wait() in cond_wait() is not lost.
+void
+cond_init(cond_t *c)
+{
+    1252:	55                   	push   %ebp
+    1253:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    1255:	8b 45 08             	mov    0x8(%ebp),%eax
+    1258:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    125e:	5d                   	pop    %ebp
+    125f:	c3                   	ret
+
+00001260 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+    1260:	55                   	push   %ebp
+    1261:	89 e5                	mov    %esp,%ebp
+    1263:	57                   	push   %edi
+    1264:	56                   	push   %esi
+    1265:	53                   	push   %ebx
+    1266:	83 ec 18             	sub    $0x18,%esp
+    1269:	8b 75 08             	mov    0x8(%ebp),%esi
+    126c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    126f:	8b 3e                	mov    (%esi),%edi
+  mutex_unlock(m);
+    1271:	53                   	push   %ebx
+    1272:	e8 ac ff ff ff       	call   1223 <mutex_unlock>
+  futex_wait(&c->seq, seq);
+    1277:	83 c4 08             	add    $0x8,%esp
+    127a:	57                   	push   %edi
+    127b:	56                   	push   %esi
+    127c:	e8 ce f7 ff ff       	call   a4f <futex_wait>
+  // Others may be waiting for m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+    1281:	83 c4 10             	add    $0x10,%esp
+    1284:	eb 0e                	jmp    1294 <cond_wait+0x34>
+    futex_wait(&m->state, 2);
+    1286:	83 ec 08             	sub    $0x8,%esp
+    1289:	6a 02                	push   $0x2
+    128b:	53                   	push   %ebx
+    128c:	e8 be f7 ff ff       	call   a4f <futex_wait>
+    1291:	83 c4 10             	add    $0x10,%esp
+    1294:	b8 02 00 00 00       	mov    $0x2,%eax
+    1299:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    129c:	85 c0                	test   %eax,%eax
+    129e:	75 e6                	jne    1286 <cond_wait+0x26>
+}
+    12a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    12a3:	5b                   	pop    %ebx
+    12a4:	5e                   	pop    %esi
+    12a5:	5f                   	pop    %edi
+    12a6:	5d                   	pop    %ebp
+    12a7:	c3                   	ret
+
+000012a8 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+    12a8:	55                   	push   %ebp
+    12a9:	89 e5                	mov    %esp,%ebp
+    12ab:	83 ec 10             	sub    $0x10,%esp
+    12ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    12b1:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+    12b5:	6a 01                	push   $0x1
+    12b7:	50                   	push   %eax
+    12b8:	e8 a1 f7 ff ff       	call   a5e <futex_wake>
+}
+    12bd:	83 c4 10             	add    $0x10,%esp
+    12c0:	c9                   	leave
+    12c1:	c3                   	ret
+
+000012c2 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+    12c2:	55                   	push   %ebp
+    12c3:	89 e5                	mov    %esp,%ebp
+    12c5:	83 ec 10             	sub    $0x10,%esp
+    12c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    12cb:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, NPROC);
+    12cf:	6a 40                	push   $0x40
+    12d1:	50                   	push   %eax
+    12d2:	e8 87 f7 ff ff       	call   a5e <futex_wake>
+}
+    12d7:	83 c4 10             	add    $0x10,%esp
+    12da:	c9                   	leave
+    12db:	c3                   	ret
@@ -1,95 +1,345 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
+// The buffer cache is a hash table of buf structures holding
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
 //
 // Interface:
 // * To get a buffer for a particular disk block, call bread.
-// * After changing buffer data, call bwrite to write it to disk.
+// * After changing buffer data, call bwrite to write it to disk,
+//     or bwritev to write several with one disk request.
 // * When done with the buffer, call brelse.
 // * Do not use the buffer after calling brelse.
 // * Only one process at a time can use a buffer,
 //     so do not keep them longer than necessary.
+// * To have a block read in the background, call bprefetch.
 //
-// The implementation uses two state flags internally:
+// The implementation uses these state flags internally:
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+// * B_QUEUED: the buffer is on the disk queue.
+// * B_ASYNC: it is there for a read-ahead, which holds a
+//     reference but not the lock, until ideintr() drops it.
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "bstat.h"
 
+#define NBUCKET 31
+
+// Besides the NBUF buffers set aside at boot, the cache grows by a
+// page of buffers at a time on misses, for as long as more than
+// BKEEPFREE pages of memory stay free.  When kalloc() runs out of
+// memory, bshrink() gives such pages back.
+#define BKEEPFREE 1024
+
+struct bpage {
+  struct bpage *next;
+  struct buf buf[(PGSIZE - sizeof(void*)) / sizeof(struct buf)];
+};
+
+#define BPERPAGE NELEM(((struct bpage*)0)->buf)
+
+// Buffers are found through a hash table of (dev, blockno), with
+// a lock per bucket, so lookups of different blocks do not contend.
+// The unused, clean buffers, the ones that may be recycled, are
+// also on an LRU list of their own; a buffer goes on it when its
+// last reference is dropped and comes off when it is used again.
+// bcache.lock only serializes misses, so that two of them cannot
+// bring in the same block.  Lock order: bcache.lock, a bucket,
+// bcache.freelock.
 struct {
   struct spinlock lock;
   struct buf buf[NBUF];
+  struct bpage *pages;         // Pages of buffers added since
+  uint nbuf;
+  uint misses;
+  uint grows;                  // Pages added
+  uint shrinks;                // Pages given back
 
-  // Linked list of all buffers, through prev/next.
+  struct {
+    struct spinlock lock;
+    struct buf *head;          // Through hnext
+    uint hits;
+  } bucket[NBUCKET];
+
+  // LRU list of recyclable buffers, through prev/next.
   // head.next is most recently used.
+  struct spinlock freelock;
   struct buf head;
+  uint nfree;
 } bcache;
 
+static int
+bhash(uint dev, uint blockno)
+{
+  return (dev*7 + blockno) % NBUCKET;
+}
+
+// Put b on the free list, as the most recently used buffer or, if
+// it holds nothing worth keeping, the least; or take it off.
+// Caller holds b's bucket, if it is in one.
+static void
+freeput(struct buf *b, int mru)
+{
+  struct buf *h;
+
+  acquire(&bcache.freelock);
+  h = mru ? &bcache.head : bcache.head.prev;
+  b->next = h->next;
+  b->prev = h;
+  h->next->prev = b;
+  h->next = b;
+  bcache.nfree++;
+  release(&bcache.freelock);
+}
+
+static void
+freedel(struct buf *b)
+{
+  acquire(&bcache.freelock);
+  b->next->prev = b->prev;
+  b->prev->next = b->next;
+  b->prev = b->next = 0;
+  bcache.nfree--;
+  release(&bcache.freelock);
+}
+
+// Take b out of its bucket.  Caller holds the bucket.
+static void
+bunhash(struct buf *b)
+{
+  struct buf **pp;
+
+  for(pp = &bcache.bucket[bhash(b->dev, b->blockno)].head; *pp; pp = &(*pp)->hnext)
+    if(*pp == b){
+      *pp = b->hnext;
+      break;
+    }
+}
+
 void
 binit(void)
 {
   struct buf *b;
+  int i;
 
   initlock(&bcache.lock, "bcache");
+  initlock(&bcache.freelock, "bcache.free");
+  for(i = 0; i < NBUCKET; i++)
+    initlock(&bcache.bucket[i].lock, "bcache.bucket");
 
 //PAGEBREAK!
-  // Create linked list of buffers
+  // All buffers start out free, in no bucket.
   bcache.head.prev = &bcache.head;
   bcache.head.next = &bcache.head;
   for(b = bcache.buf; b < bcache.buf+NBUF; b++){
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
     initsleeplock(&b->lock, "buffer");
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+    freeput(b, 1);
   }
+  bcache.nbuf = NBUF;
 }
 
-// Look through buffer cache for block on device dev.
-// If not found, allocate a buffer.
-// In either case, return locked buffer.
-static struct buf*
-bget(uint dev, uint blockno)
+// Add a page of empty buffers to the cache.  Caller holds
+// bcache.lock.  Returns -1 if there is no memory for it.
+static int
+bgrow(void)
+{
+  struct bpage *pg;
+  struct buf *b;
+
+  if((pg = (struct bpage*)kalloc()) == 0)
+    return -1;
+  memset(pg, 0, sizeof(*pg));
+  for(b = pg->buf; b < pg->buf + BPERPAGE; b++){
+    initsleeplock(&b->lock, "buffer");
+    freeput(b, 0);
+  }
+  pg->next = bcache.pages;
+  bcache.pages = pg;
+  bcache.nbuf += BPERPAGE;
+  bcache.grows++;
+  return 0;
+}
+
+// Give back to kalloc() a page of buffers, all of them free.
+// Returns the number of pages freed, 0 or 1.
+int
+bshrink(void)
 {
+  struct bpage *pg, **pp;
   struct buf *b;
+  int i, h, n;
 
+  if(holding(&bcache.lock))
+    return 0;   // kalloc() from bgrow()
   acquire(&bcache.lock);
+  for(pp = &bcache.pages; (pg = *pp) != 0; pp = &pg->next){
+    for(i = 0; i < BPERPAGE; i++)
+      if(pg->buf[i].refcnt || pg->buf[i].prev == 0)
+        break;
+    if(i < BPERPAGE)
+      continue;
+    // Looks idle; make sure under the bucket locks, claiming each
+    // buffer as we go.
+    for(n = 0; n < BPERPAGE; n++){
+      b = &pg->buf[n];
+      h = bhash(b->dev, b->blockno);
+      acquire(&bcache.bucket[h].lock);
+      if(b->refcnt || (b->flags & B_DIRTY) || b->prev == 0){
+        release(&bcache.bucket[h].lock);
+        break;
+      }
+      freedel(b);
+      bunhash(b);
+      b->refcnt = 1;
+      release(&bcache.bucket[h].lock);
+    }
+    if(n < BPERPAGE){
+      // In use after all: the claimed ones go back, emptied.
+      while(--n >= 0){
+        pg->buf[n].refcnt = 0;
+        pg->buf[n].flags = 0;
+        freeput(&pg->buf[n], 0);
+      }
+      continue;
+    }
+    *pp = pg->next;
+    for(b = pg->buf; b < pg->buf + BPERPAGE; b++)
+      freesleeplock(&b->lock);
+    bcache.nbuf -= BPERPAGE;
+    bcache.shrinks++;
+    release(&bcache.lock);
+    kfree((char*)pg);
+    return 1;
+  }
+  release(&bcache.lock);
+  return 0;
+}
 
-  // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
+// The buffer cached for block blockno on dev, with a reference
+// taken, or 0.  Caller holds its bucket.
+static struct buf*
+bfind(int h, uint dev, uint blockno)
+{
+  struct buf *b;
+
+  for(b = bcache.bucket[h].head; b; b = b->hnext)
     if(b->dev == dev && b->blockno == blockno){
-      b->refcnt++;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
+      if(b->refcnt++ == 0 && b->prev)
+        freedel(b);
       return b;
     }
+  return 0;
+}
+
+// Take the least recently used free buffer out of its bucket, if
+// it is in one.  Returns it with a reference, or 0 if there are
+// none.  Caller holds bcache.lock, so buffers only change
+// buckets here.
+static struct buf*
+bvictim(void)
+{
+  struct buf *b;
+  int h;
+
+  for(;;){
+    acquire(&bcache.freelock);
+    b = bcache.head.prev;
+    release(&bcache.freelock);
+    if(b == &bcache.head)
+      return 0;
+    h = bhash(b->dev, b->blockno);
+    acquire(&bcache.bucket[h].lock);
+    // A hit or a log write may have got there first.
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0 && b->prev){
+      freedel(b);
+      bunhash(b);
+      b->refcnt = 1;
+      release(&bcache.bucket[h].lock);
+      return b;
+    }
+    release(&bcache.bucket[h].lock);
   }
+}
+
+// Look through buffer cache for block on device dev.
+// If not found, allocate a buffer.
+// In either case, return the buffer with a reference but unlocked,
+// or 0 if every buffer is in use.
+static struct buf*
+bget1(uint dev, uint blockno)
+{
+  struct buf *b;
+  int h;
 
-  // Not cached; recycle an unused buffer.
+  h = bhash(dev, blockno);
+  acquire(&bcache.bucket[h].lock);
+  if((b = bfind(h, dev, blockno)) != 0)
+    bcache.bucket[h].hits++;
+  release(&bcache.bucket[h].lock);
+  if(b)
+    return b;
+
+  // Not cached; recycle an unused buffer, unless another miss has
+  // brought the block in meanwhile.
   // Even if refcnt==0, B_DIRTY indicates a buffer is in use
-  // because log.c has modified it but not yet committed it.
-  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
-      b->dev = dev;
-      b->blockno = blockno;
-      b->flags = 0;
-      b->refcnt = 1;
+  // because log.c has modified it but not yet committed it;
+  // such buffers are kept off the free list.
+  acquire(&bcache.lock);
+  acquire(&bcache.bucket[h].lock);
+  b = bfind(h, dev, blockno);
+  release(&bcache.bucket[h].lock);
+  if(b == 0){
+    // Grow while memory is plentiful, else recycle.
+    bcache.misses++;
+    if(kfreepages() > BKEEPFREE)
+      bgrow();
+    if((b = bvictim()) == 0 && (bgrow() < 0 || (b = bvictim()) == 0)){
       release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
+      return 0;
     }
+    b->dev = dev;
+    b->blockno = blockno;
+    b->flags = 0;
+    acquire(&bcache.bucket[h].lock);
+    b->hnext = bcache.bucket[h].head;
+    bcache.bucket[h].head = b;
+    release(&bcache.bucket[h].lock);
   }
-  panic("bget: no buffers");
+  release(&bcache.lock);
+  return b;
+}
+
+// The same, locked, which may mean waiting for its user.
+static struct buf*
+bget(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  if((b = bget1(dev, blockno)) == 0)
+    panic("bget: no buffers");
+  acquiresleep(&b->lock);
+  return b;
+}
+
+// Start reading block blockno into the cache, if it is not there
+// already, and return without waiting for the disk.
+void
+bprefetch(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  if((b = bget1(dev, blockno)) != 0)
+    idereadahead(b);
 }
 
 // Return a locked buf with the contents of the indicated block.
@@ -105,6 +355,20 @@ bread(uint dev, uint blockno)
   return b;
 }
 
+// Return a locked buf for a block whose contents the caller is
+// about to overwrite whole, without reading it from disk first.
+struct buf*
+bclaim(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  b = bget(dev, blockno);
+  if(b->flags & B_QUEUED)
+    iderw(b);  // wait for the read-ahead
+  b->flags |= B_VALID;
+  return b;
+}
+
 // Write b's contents to disk.  Must be locked.
 void
 bwrite(struct buf *b)
@@ -115,30 +379,87 @@ bwrite(struct buf *b)
   iderw(b);
 }
 
+// Write n locked buffers, as one clustered request where the
+// blocks are contiguous.
+void
+bwritev(struct buf **bs, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++){
+    if(!holdingsleep(&bs[i]->lock))
+      panic("bwritev");
+    bs[i]->flags |= B_DIRTY;
+  }
+  iderwv(bs, n);
+}
+
 // Release a locked buffer.
-// Move to the head of the MRU list.
+// Once unused and clean, it goes to the head of the free list.
 void
 brelse(struct buf *b)
 {
+
   if(!holdingsleep(&b->lock))
     panic("brelse");
 
   releasesleep(&b->lock);
+  bunref(b);
+}
 
-  acquire(&bcache.lock);
+static void
+bput(struct buf *b, int mru)
+{
+  int h;
+
+  h = bhash(b->dev, b->blockno);
+  acquire(&bcache.bucket[h].lock);
   b->refcnt--;
-  if (b->refcnt == 0) {
+  if (b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
     // no one is waiting for it.
-    b->next->prev = b->prev;
-    b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+    freeput(b, mru);
   }
-  
+  release(&bcache.bucket[h].lock);
+}
+
+// Release a locked buffer whose contents are kept elsewhere, in
+// the page cache: once unused and clean, it goes to the tail of the
+// free list, to be recycled first.
+void
+bdrop(struct buf *b)
+{
+  if(!holdingsleep(&b->lock))
+    panic("bdrop");
+
+  releasesleep(&b->lock);
+  bput(b, 0);
+}
+
+// Drop a reference to b taken without its lock: a read-ahead's.
+void
+bunref(struct buf *b)
+{
+  bput(b, 1);
+}
+
+// Size and hit rate of the cache, for bstat().
+void
+getbstat(struct bstat *st)
+{
+  int i;
+
+  acquire(&bcache.lock);
+  st->nbuf = bcache.nbuf;
+  st->nfree = bcache.nfree;
+  st->misses = bcache.misses;
+  st->grows = bcache.grows;
+  st->shrinks = bcache.shrinks;
   release(&bcache.lock);
+  st->hits = 0;
+  for(i = 0; i < NBUCKET; i++)
+    st->hits += bcache.bucket[i].hits;
 }
+
 //PAGEBREAK!
 // Blank page.
 
@@ -0,0 +1,395 @@
+
+bootblock.o:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00007c00 <start>:
+# with %cs=0 %ip=7c00.
+
+.code16                       # Assemble for 16-bit mode
+.globl start
+start:
+  cli                         # BIOS enabled interrupts; disable
+    7c00:	fa                   	cli
+
+  # Zero data segment registers DS, ES, and SS.
+  xorw    %ax,%ax             # Set %ax to zero
+    7c01:	31 c0                	xor    %eax,%eax
+  movw    %ax,%ds             # -> Data Segment
+    7c03:	8e d8                	mov    %eax,%ds
+  movw    %ax,%es             # -> Extra Segment
+    7c05:	8e c0                	mov    %eax,%es
+  movw    %ax,%ss             # -> Stack Segment
+    7c07:	8e d0                	mov    %eax,%ss
+
+00007c09 <seta20.1>:
+
+  # Physical address line A20 is tied to zero so that the first PCs 
+  # with 2 MB would run software that assumed 1 MB.  Undo that.
+seta20.1:
+  inb     $0x64,%al               # Wait for not busy
+    7c09:	e4 64                	in     $0x64,%al
+  testb   $0x2,%al
+    7c0b:	a8 02                	test   $0x2,%al
+  jnz     seta20.1
+    7c0d:	75 fa                	jne    7c09 <seta20.1>
+
+  movb    $0xd1,%al               # 0xd1 -> port 0x64
+    7c0f:	b0 d1                	mov    $0xd1,%al
+  outb    %al,$0x64
+    7c11:	e6 64                	out    %al,$0x64
+
+00007c13 <seta20.2>:
+
+seta20.2:
+  inb     $0x64,%al               # Wait for not busy
+    7c13:	e4 64                	in     $0x64,%al
+  testb   $0x2,%al
+    7c15:	a8 02                	test   $0x2,%al
+  jnz     seta20.2
+    7c17:	75 fa                	jne    7c13 <seta20.2>
+
+  movb    $0xdf,%al               # 0xdf -> port 0x60
+    7c19:	b0 df                	mov    $0xdf,%al
+  outb    %al,$0x60
+    7c1b:	e6 60                	out    %al,$0x60
+
+  # Switch from real to protected mode.  Use a bootstrap GDT that makes
+  # virtual addresses map directly to physical addresses so that the
+  # effective memory map doesn't change during the transition.
+  lgdt    gdtdesc
+    7c1d:	0f 01 16             	lgdtl  (%esi)
+    7c20:	78 7c                	js     7c9e <readsect+0x12>
+  movl    %cr0, %eax
+    7c22:	0f 20 c0             	mov    %cr0,%eax
+  orl     $CR0_PE, %eax
+    7c25:	66 83 c8 01          	or     $0x1,%ax
+  movl    %eax, %cr0
+    7c29:	0f 22 c0             	mov    %eax,%cr0
+
+//PAGEBREAK!
+  # Complete the transition to 32-bit protected mode by using a long jmp
+  # to reload %cs and %eip.  The segment descriptors are set up with no
+  # translation, so that the mapping is still the identity mapping.
+  ljmp    $(SEG_KCODE<<3), $start32
+    7c2c:	ea                   	.byte 0xea
+    7c2d:	31 7c 08 00          	xor    %edi,0x0(%eax,%ecx,1)
+
+00007c31 <start32>:
+
+.code32  # Tell assembler to generate 32-bit code now.
+start32:
+  # Set up the protected-mode data segment registers
+  movw    $(SEG_KDATA<<3), %ax    # Our data segment selector
+    7c31:	66 b8 10 00          	mov    $0x10,%ax
+  movw    %ax, %ds                # -> DS: Data Segment
+    7c35:	8e d8                	mov    %eax,%ds
+  movw    %ax, %es                # -> ES: Extra Segment
+    7c37:	8e c0                	mov    %eax,%es
+  movw    %ax, %ss                # -> SS: Stack Segment
+    7c39:	8e d0                	mov    %eax,%ss
+  movw    $0, %ax                 # Zero segments not ready for use
+    7c3b:	66 b8 00 00          	mov    $0x0,%ax
+  movw    %ax, %fs                # -> FS
+    7c3f:	8e e0                	mov    %eax,%fs
+  movw    %ax, %gs                # -> GS
+    7c41:	8e e8                	mov    %eax,%gs
+
+  # Set up the stack pointer and call into C.
+  movl    $start, %esp
+    7c43:	bc 00 7c 00 00       	mov    $0x7c00,%esp
+  call    bootmain
+    7c48:	e8 1e 01 00 00       	call   7d6b <bootmain>
+
+  # If bootmain returns (it shouldn't), trigger a Bochs
+  # breakpoint if running under Bochs, then loop.
+  movw    $0x8a00, %ax            # 0x8a00 -> port 0x8a00
+    7c4d:	66 b8 00 8a          	mov    $0x8a00,%ax
+  movw    %ax, %dx
+    7c51:	66 89 c2             	mov    %ax,%dx
+  outw    %ax, %dx
+    7c54:	66 ef                	out    %ax,(%dx)
+  movw    $0x8ae0, %ax            # 0x8ae0 -> port 0x8a00
+    7c56:	66 b8 e0 8a          	mov    $0x8ae0,%ax
+  outw    %ax, %dx
+    7c5a:	66 ef                	out    %ax,(%dx)
+
+00007c5c <spin>:
+spin:
+  jmp     spin
+    7c5c:	eb fe                	jmp    7c5c <spin>
+    7c5e:	66 90                	xchg   %ax,%ax
+
+00007c60 <gdt>:
+	...
+    7c68:	ff                   	(bad)
+    7c69:	ff 00                	incl   (%eax)
+    7c6b:	00 00                	add    %al,(%eax)
+    7c6d:	9a cf 00 ff ff 00 00 	lcall  $0x0,$0xffff00cf
+    7c74:	00                   	.byte 0x0
+    7c75:	92                   	xchg   %eax,%edx
+    7c76:	cf                   	iret
+	...
+
+00007c78 <gdtdesc>:
+    7c78:	17                   	pop    %ss
+    7c79:	00 60 7c             	add    %ah,0x7c(%eax)
+	...
+
+00007c7e <waitdisk>:
+static inline uchar
+inb(ushort port)
+{
+  uchar data;
+
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+    7c7e:	ba f7 01 00 00       	mov    $0x1f7,%edx
+    7c83:	ec                   	in     (%dx),%al
+
+void
+waitdisk(void)
+{
+  // Wait for disk ready.
+  while((inb(0x1F7) & 0xC0) != 0x40)
+    7c84:	83 e0 c0             	and    $0xffffffc0,%eax
+    7c87:	3c 40                	cmp    $0x40,%al
+    7c89:	75 f8                	jne    7c83 <waitdisk+0x5>
+    ;
+}
+    7c8b:	c3                   	ret
+
+00007c8c <readsect>:
+
+// Read n sectors (1 to MAXSECT) at offset into dst with a single
+// command; the disk has each sector ready in turn.
+void
+readsect(uchar *dst, uint offset, uint n)
+{
+    7c8c:	55                   	push   %ebp
+    7c8d:	89 e5                	mov    %esp,%ebp
+    7c8f:	57                   	push   %edi
+    7c90:	56                   	push   %esi
+    7c91:	53                   	push   %ebx
+    7c92:	83 ec 0c             	sub    $0xc,%esp
+    7c95:	8b 5d 10             	mov    0x10(%ebp),%ebx
+    7c98:	8b 75 08             	mov    0x8(%ebp),%esi
+    7c9b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  // Issue command.
+  waitdisk();
+    7c9e:	e8 db ff ff ff       	call   7c7e <waitdisk>
+}
+
+static inline void
+outb(ushort port, uchar data)
+{
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+    7ca3:	ba f2 01 00 00       	mov    $0x1f2,%edx
+    7ca8:	89 d8                	mov    %ebx,%eax
+    7caa:	ee                   	out    %al,(%dx)
+    7cab:	ba f3 01 00 00       	mov    $0x1f3,%edx
+    7cb0:	89 c8                	mov    %ecx,%eax
+    7cb2:	ee                   	out    %al,(%dx)
+  outb(0x1F2, n);   // count, 0 meaning 256
+  outb(0x1F3, offset);
+  outb(0x1F4, offset >> 8);
+    7cb3:	89 c8                	mov    %ecx,%eax
+    7cb5:	ba f4 01 00 00       	mov    $0x1f4,%edx
+    7cba:	c1 e8 08             	shr    $0x8,%eax
+    7cbd:	ee                   	out    %al,(%dx)
+  outb(0x1F5, offset >> 16);
+    7cbe:	89 c8                	mov    %ecx,%eax
+    7cc0:	ba f5 01 00 00       	mov    $0x1f5,%edx
+    7cc5:	c1 e8 10             	shr    $0x10,%eax
+    7cc8:	ee                   	out    %al,(%dx)
+  outb(0x1F6, (offset >> 24) | 0xE0);
+    7cc9:	89 c8                	mov    %ecx,%eax
+    7ccb:	ba f6 01 00 00       	mov    $0x1f6,%edx
+    7cd0:	c1 e8 18             	shr    $0x18,%eax
+    7cd3:	83 c8 e0             	or     $0xffffffe0,%eax
+    7cd6:	ee                   	out    %al,(%dx)
+    7cd7:	b0 20                	mov    $0x20,%al
+    7cd9:	ba f7 01 00 00       	mov    $0x1f7,%edx
+    7cde:	ee                   	out    %al,(%dx)
+  outb(0x1F7, 0x20);  // cmd 0x20 - read sectors
+
+  // Read data.
+  for(; n > 0; n--, dst += SECTSIZE){
+    7cdf:	85 db                	test   %ebx,%ebx
+    7ce1:	74 1d                	je     7d00 <readsect+0x74>
+    waitdisk();
+    7ce3:	e8 96 ff ff ff       	call   7c7e <waitdisk>
+  asm volatile("cld; rep insl" :
+    7ce8:	89 f7                	mov    %esi,%edi
+    7cea:	b9 80 00 00 00       	mov    $0x80,%ecx
+    7cef:	ba f0 01 00 00       	mov    $0x1f0,%edx
+    7cf4:	fc                   	cld
+    7cf5:	f3 6d                	rep insl (%dx),%es:(%edi)
+  for(; n > 0; n--, dst += SECTSIZE){
+    7cf7:	4b                   	dec    %ebx
+    7cf8:	81 c6 00 02 00 00    	add    $0x200,%esi
+    7cfe:	eb df                	jmp    7cdf <readsect+0x53>
+    insl(0x1F0, dst, SECTSIZE/4);
+  }
+}
+    7d00:	83 c4 0c             	add    $0xc,%esp
+    7d03:	5b                   	pop    %ebx
+    7d04:	5e                   	pop    %esi
+    7d05:	5f                   	pop    %edi
+    7d06:	5d                   	pop    %ebp
+    7d07:	c3                   	ret
+
+00007d08 <readseg>:
+
+// Read 'count' bytes at 'offset' from kernel into physical address 'pa'.
+// Might copy more than asked.
+void
+readseg(uchar* pa, uint count, uint offset)
+{
+    7d08:	55                   	push   %ebp
+    7d09:	89 e5                	mov    %esp,%ebp
+    7d0b:	57                   	push   %edi
+    7d0c:	56                   	push   %esi
+    7d0d:	53                   	push   %ebx
+    7d0e:	83 ec 1c             	sub    $0x1c,%esp
+    7d11:	8b 75 10             	mov    0x10(%ebp),%esi
+    7d14:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uchar* epa;
+  uint n;
+
+  epa = pa + count;
+    7d17:	8b 55 0c             	mov    0xc(%ebp),%edx
+
+  // Round down to sector boundary.
+  pa -= offset % SECTSIZE;
+    7d1a:	89 f0                	mov    %esi,%eax
+
+  // Translate from bytes to sectors; kernel starts at sector 1.
+  offset = (offset / SECTSIZE) + 1;
+    7d1c:	c1 ee 09             	shr    $0x9,%esi
+  pa -= offset % SECTSIZE;
+    7d1f:	25 ff 01 00 00       	and    $0x1ff,%eax
+  epa = pa + count;
+    7d24:	01 da                	add    %ebx,%edx
+  offset = (offset / SECTSIZE) + 1;
+    7d26:	46                   	inc    %esi
+  pa -= offset % SECTSIZE;
+    7d27:	29 c3                	sub    %eax,%ebx
+
+  // Read up to MAXSECT sectors per command.  We may write more
+  // to memory than asked, but it doesn't matter -- we load in
+  // increasing order.
+  for(; pa < epa; pa += n*SECTSIZE, offset += n){
+    7d29:	39 d3                	cmp    %edx,%ebx
+    7d2b:	73 36                	jae    7d63 <readseg+0x5b>
+    n = ((uint)epa - (uint)pa + SECTSIZE - 1) / SECTSIZE;
+    7d2d:	8d 82 ff 01 00 00    	lea    0x1ff(%edx),%eax
+    if(n > MAXSECT)
+      n = MAXSECT;
+    7d33:	bf 00 01 00 00       	mov    $0x100,%edi
+    n = ((uint)epa - (uint)pa + SECTSIZE - 1) / SECTSIZE;
+    7d38:	29 d8                	sub    %ebx,%eax
+    if(n > MAXSECT)
+    7d3a:	3d ff 01 02 00       	cmp    $0x201ff,%eax
+    7d3f:	77 05                	ja     7d46 <readseg+0x3e>
+    n = ((uint)epa - (uint)pa + SECTSIZE - 1) / SECTSIZE;
+    7d41:	c1 e8 09             	shr    $0x9,%eax
+    7d44:	89 c7                	mov    %eax,%edi
+    7d46:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    readsect(pa, offset, n);
+    7d49:	50                   	push   %eax
+    7d4a:	57                   	push   %edi
+    7d4b:	56                   	push   %esi
+  for(; pa < epa; pa += n*SECTSIZE, offset += n){
+    7d4c:	01 fe                	add    %edi,%esi
+    readsect(pa, offset, n);
+    7d4e:	53                   	push   %ebx
+    7d4f:	e8 38 ff ff ff       	call   7c8c <readsect>
+  for(; pa < epa; pa += n*SECTSIZE, offset += n){
+    7d54:	89 f8                	mov    %edi,%eax
+    7d56:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    7d59:	83 c4 10             	add    $0x10,%esp
+    7d5c:	c1 e0 09             	shl    $0x9,%eax
+    7d5f:	01 c3                	add    %eax,%ebx
+    7d61:	eb c6                	jmp    7d29 <readseg+0x21>
+  }
+}
+    7d63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    7d66:	5b                   	pop    %ebx
+    7d67:	5e                   	pop    %esi
+    7d68:	5f                   	pop    %edi
+    7d69:	5d                   	pop    %ebp
+    7d6a:	c3                   	ret
+
+00007d6b <bootmain>:
+{
+    7d6b:	55                   	push   %ebp
+    7d6c:	89 e5                	mov    %esp,%ebp
+    7d6e:	57                   	push   %edi
+    7d6f:	56                   	push   %esi
+    7d70:	53                   	push   %ebx
+    7d71:	83 ec 10             	sub    $0x10,%esp
+  readseg((uchar*)elf, 4096, 0);
+    7d74:	6a 00                	push   $0x0
+    7d76:	68 00 10 00 00       	push   $0x1000
+    7d7b:	68 00 00 01 00       	push   $0x10000
+    7d80:	e8 83 ff ff ff       	call   7d08 <readseg>
+  if(elf->magic != ELF_MAGIC)
+    7d85:	83 c4 10             	add    $0x10,%esp
+    7d88:	81 3d 00 00 01 00 7f 	cmpl   $0x464c457f,0x10000
+    7d8f:	45 4c 46 
+    7d92:	75 54                	jne    7de8 <bootmain+0x7d>
+  ph = (struct proghdr*)((uchar*)elf + elf->phoff);
+    7d94:	a1 1c 00 01 00       	mov    0x1001c,%eax
+    7d99:	8d 98 00 00 01 00    	lea    0x10000(%eax),%ebx
+  eph = ph + elf->phnum;
+    7d9f:	0f b7 05 2c 00 01 00 	movzwl 0x1002c,%eax
+    7da6:	c1 e0 05             	shl    $0x5,%eax
+    7da9:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+  for(; ph < eph; ph++){
+    7dac:	39 f3                	cmp    %esi,%ebx
+    7dae:	73 2b                	jae    7ddb <bootmain+0x70>
+    pa = (uchar*)ph->paddr;
+    7db0:	8b 7b 0c             	mov    0xc(%ebx),%edi
+    readseg(pa, ph->filesz, ph->off);
+    7db3:	50                   	push   %eax
+    7db4:	ff 73 04             	push   0x4(%ebx)
+    7db7:	ff 73 10             	push   0x10(%ebx)
+    7dba:	57                   	push   %edi
+    7dbb:	e8 48 ff ff ff       	call   7d08 <readseg>
+    if(ph->memsz > ph->filesz)
+    7dc0:	8b 4b 14             	mov    0x14(%ebx),%ecx
+    7dc3:	8b 43 10             	mov    0x10(%ebx),%eax
+    7dc6:	83 c4 10             	add    $0x10,%esp
+    7dc9:	39 c8                	cmp    %ecx,%eax
+    7dcb:	73 09                	jae    7dd6 <bootmain+0x6b>
+      stosb(pa + ph->filesz, 0, ph->memsz - ph->filesz);
+    7dcd:	01 c7                	add    %eax,%edi
+    7dcf:	29 c1                	sub    %eax,%ecx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    7dd1:	31 c0                	xor    %eax,%eax
+    7dd3:	fc                   	cld
+    7dd4:	f3 aa                	rep stos %al,%es:(%edi)
+  for(; ph < eph; ph++){
+    7dd6:	83 c3 20             	add    $0x20,%ebx
+    7dd9:	eb d1                	jmp    7dac <bootmain+0x41>
+}
+    7ddb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    7dde:	5b                   	pop    %ebx
+    7ddf:	5e                   	pop    %esi
+    7de0:	5f                   	pop    %edi
+    7de1:	5d                   	pop    %ebp
+  entry();
+    7de2:	ff 25 18 00 01 00    	jmp    *0x10018
+}
+    7de8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    7deb:	5b                   	pop    %ebx
+    7dec:	5e                   	pop    %esi
+    7ded:	5f                   	pop    %edi
+    7dee:	5d                   	pop    %ebp
+    7def:	c3                   	ret
@@ -11,6 +11,7 @@
 #include "memlayout.h"
 
 #define SECTSIZE  512
+#define MAXSECT   256  // Sectors per read command (a count of 0)
 
 void readseg(uchar*, uint, uint);
 
@@ -55,13 +56,14 @@ waitdisk(void)
     ;
 }
 
-// Read a single sector at offset into dst.
+// Read n sectors (1 to MAXSECT) at offset into dst with a single
+// command; the disk has each sector ready in turn.
 void
-readsect(void *dst, uint offset)
+readsect(uchar *dst, uint offset, uint n)
 {
   // Issue command.
   waitdisk();
-  outb(0x1F2, 1);   // count = 1
+  outb(0x1F2, n);   // count, 0 meaning 256
   outb(0x1F3, offset);
   outb(0x1F4, offset >> 8);
   outb(0x1F5, offset >> 16);
@@ -69,8 +71,10 @@ readsect(void *dst, uint offset)
   outb(0x1F7, 0x20);  // cmd 0x20 - read sectors
 
   // Read data.
-  waitdisk();
-  insl(0x1F0, dst, SECTSIZE/4);
+  for(; n > 0; n--, dst += SECTSIZE){
+    waitdisk();
+    insl(0x1F0, dst, SECTSIZE/4);
+  }
 }
 
 // Read 'count' bytes at 'offset' from kernel into physical address 'pa'.
@@ -79,6 +83,7 @@ void
 readseg(uchar* pa, uint count, uint offset)
 {
   uchar* epa;
+  uint n;
 
   epa = pa + count;
 
@@ -88,9 +93,13 @@ readseg(uchar* pa, uint count, uint offset)
   // Translate from bytes to sectors; kernel starts at sector 1.
   offset = (offset / SECTSIZE) + 1;
 
-  // If this is too slow, we could read lots of sectors at a time.
-  // We'd write more to memory than asked, but it doesn't matter --
-  // we load in increasing order.
-  for(; pa < epa; pa += SECTSIZE, offset++)
-    readsect(pa, offset);
+  // Read up to MAXSECT sectors per command.  We may write more
+  // to memory than asked, but it doesn't matter -- we load in
+  // increasing order.
+  for(; pa < epa; pa += n*SECTSIZE, offset += n){
+    n = ((uint)epa - (uint)pa + SECTSIZE - 1) / SECTSIZE;
+    if(n > MAXSECT)
+      n = MAXSECT;
+    readsect(pa, offset, n);
+  }
 }
@@ -0,0 +1,10 @@
+// Buffer cache statistics, as returned by bstat().
+
+struct bstat {
+  uint nbuf;                   // Buffers in the cache
+  uint nfree;                  // Of those, unused and clean
+  uint hits;                   // Lookups that found the block cached
+  uint misses;                 // ... and that had to read it in
+  uint grows;                  // Pages of buffers added
+  uint shrinks;                // ... and given back under memory pressure
+};
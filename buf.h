@@ -4,11 +4,15 @@ struct buf {
   uint blockno;
   struct sleeplock lock;
   uint refcnt;
-  struct buf *prev; // LRU cache list
+  struct buf *prev; // LRU list of free buffers, 0 if not on it
   struct buf *next;
+  struct buf *hnext; // hash bucket (bio.c)
   struct buf *qnext; // disk queue
+  uint64 qtime; // when queued, in ns (ide.c)
   uchar data[BSIZE];
 };
 #define B_VALID 0x2  // buffer has been read from disk
 #define B_DIRTY 0x4  // buffer needs to be written to disk
+#define B_QUEUED 0x8 // on the disk queue (ide.c)
+#define B_ASYNC 0x10 // queued by read-ahead, which holds a reference
 
@@ -0,0 +1,2815 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <cat>:
+#include "stat.h"
+#include "user.h"
+
+void
+cat(int fd)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	53                   	push   %ebx
+       4:	83 ec 04             	sub    $0x4,%esp
+       7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int n;
+
+  // The kernel moves the data, without a copy through cat.
+  while((n = sendfile(1, fd, 4096)) > 0)
+       a:	83 ec 04             	sub    $0x4,%esp
+       d:	68 00 10 00 00       	push   $0x1000
+      12:	53                   	push   %ebx
+      13:	6a 01                	push   $0x1
+      15:	e8 82 0a 00 00       	call   a9c <sendfile>
+      1a:	83 c4 10             	add    $0x10,%esp
+      1d:	85 c0                	test   %eax,%eax
+      1f:	7f e9                	jg     a <cat+0xa>
+    ;
+  if(n < 0){
+      21:	78 05                	js     28 <cat+0x28>
+    printf(1, "cat: read or write error\n");
+    exit();
+  }
+}
+      23:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      26:	c9                   	leave
+      27:	c3                   	ret
+    printf(1, "cat: read or write error\n");
+      28:	83 ec 08             	sub    $0x8,%esp
+      2b:	68 58 12 00 00       	push   $0x1258
+      30:	6a 01                	push   $0x1
+      32:	e8 04 0c 00 00       	call   c3b <printf>
+    exit();
+      37:	e8 c6 06 00 00       	call   702 <exit>
+
+0000003c <main>:
+
+int
+main(int argc, char *argv[])
+{
+      3c:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+      40:	83 e4 f0             	and    $0xfffffff0,%esp
+      43:	ff 71 fc             	push   -0x4(%ecx)
+      46:	55                   	push   %ebp
+      47:	89 e5                	mov    %esp,%ebp
+      49:	57                   	push   %edi
+      4a:	56                   	push   %esi
+      4b:	53                   	push   %ebx
+      4c:	51                   	push   %ecx
+      4d:	83 ec 18             	sub    $0x18,%esp
+      50:	8b 01                	mov    (%ecx),%eax
+      52:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      55:	8b 51 04             	mov    0x4(%ecx),%edx
+      58:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  int fd, i;
+
+  if(argc <= 1){
+      5b:	83 f8 01             	cmp    $0x1,%eax
+      5e:	7e 07                	jle    67 <main+0x2b>
+    cat(0);
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+      60:	be 01 00 00 00       	mov    $0x1,%esi
+      65:	eb 26                	jmp    8d <main+0x51>
+    cat(0);
+      67:	83 ec 0c             	sub    $0xc,%esp
+      6a:	6a 00                	push   $0x0
+      6c:	e8 8f ff ff ff       	call   0 <cat>
+    exit();
+      71:	e8 8c 06 00 00       	call   702 <exit>
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat(fd);
+      76:	83 ec 0c             	sub    $0xc,%esp
+      79:	50                   	push   %eax
+      7a:	e8 81 ff ff ff       	call   0 <cat>
+    close(fd);
+      7f:	89 1c 24             	mov    %ebx,(%esp)
+      82:	e8 aa 06 00 00       	call   731 <close>
+  for(i = 1; i < argc; i++){
+      87:	83 c6 01             	add    $0x1,%esi
+      8a:	83 c4 10             	add    $0x10,%esp
+      8d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      90:	39 c6                	cmp    %eax,%esi
+      92:	7d 31                	jge    c5 <main+0x89>
+    if((fd = open(argv[i], 0)) < 0){
+      94:	8b 45 e0             	mov    -0x20(%ebp),%eax
+      97:	8d 3c b0             	lea    (%eax,%esi,4),%edi
+      9a:	83 ec 08             	sub    $0x8,%esp
+      9d:	6a 00                	push   $0x0
+      9f:	ff 37                	push   (%edi)
+      a1:	e8 ad 07 00 00       	call   853 <open>
+      a6:	89 c3                	mov    %eax,%ebx
+      a8:	83 c4 10             	add    $0x10,%esp
+      ab:	85 c0                	test   %eax,%eax
+      ad:	79 c7                	jns    76 <main+0x3a>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      af:	83 ec 04             	sub    $0x4,%esp
+      b2:	ff 37                	push   (%edi)
+      b4:	68 72 12 00 00       	push   $0x1272
+      b9:	6a 01                	push   $0x1
+      bb:	e8 7b 0b 00 00       	call   c3b <printf>
+      exit();
+      c0:	e8 3d 06 00 00       	call   702 <exit>
+  }
+  exit();
+      c5:	e8 38 06 00 00       	call   702 <exit>
+
+000000ca <strcpy>:
+#include "memlayout.h"
+#include "clock.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+      ca:	55                   	push   %ebp
+      cb:	89 e5                	mov    %esp,%ebp
+      cd:	56                   	push   %esi
+      ce:	53                   	push   %ebx
+      cf:	8b 75 08             	mov    0x8(%ebp),%esi
+      d2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+      d5:	89 f0                	mov    %esi,%eax
+      d7:	89 d1                	mov    %edx,%ecx
+      d9:	83 c2 01             	add    $0x1,%edx
+      dc:	89 c3                	mov    %eax,%ebx
+      de:	83 c0 01             	add    $0x1,%eax
+      e1:	0f b6 09             	movzbl (%ecx),%ecx
+      e4:	88 0b                	mov    %cl,(%ebx)
+      e6:	84 c9                	test   %cl,%cl
+      e8:	75 ed                	jne    d7 <strcpy+0xd>
+    ;
+  return os;
+}
+      ea:	89 f0                	mov    %esi,%eax
+      ec:	5b                   	pop    %ebx
+      ed:	5e                   	pop    %esi
+      ee:	5d                   	pop    %ebp
+      ef:	c3                   	ret
+
+000000f0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+      f0:	55                   	push   %ebp
+      f1:	89 e5                	mov    %esp,%ebp
+      f3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      f6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+      f9:	eb 06                	jmp    101 <strcmp+0x11>
+    p++, q++;
+      fb:	83 c1 01             	add    $0x1,%ecx
+      fe:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+     101:	0f b6 01             	movzbl (%ecx),%eax
+     104:	84 c0                	test   %al,%al
+     106:	74 04                	je     10c <strcmp+0x1c>
+     108:	3a 02                	cmp    (%edx),%al
+     10a:	74 ef                	je     fb <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+     10c:	0f b6 c0             	movzbl %al,%eax
+     10f:	0f b6 12             	movzbl (%edx),%edx
+     112:	29 d0                	sub    %edx,%eax
+}
+     114:	5d                   	pop    %ebp
+     115:	c3                   	ret
+
+00000116 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     116:	55                   	push   %ebp
+     117:	89 e5                	mov    %esp,%ebp
+     119:	53                   	push   %ebx
+     11a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  const char *p;
+  uint w;
+
+  for(p = s; (uint)p & 3; p++)
+     11d:	89 c8                	mov    %ecx,%eax
+     11f:	eb 03                	jmp    124 <strlen+0xe>
+     121:	83 c0 01             	add    $0x1,%eax
+     124:	a8 03                	test   $0x3,%al
+     126:	74 09                	je     131 <strlen+0x1b>
+    if(*p == 0)
+     128:	80 38 00             	cmpb   $0x0,(%eax)
+     12b:	75 f4                	jne    121 <strlen+0xb>
+      return p - s;
+     12d:	29 c8                	sub    %ecx,%eax
+     12f:	eb 25                	jmp    156 <strlen+0x40>
+  // Then a word at a time, which never crosses into the next page:
+  // a word with a zero byte in it has one of these bits set.
+  for(;; p += 4){
+    w = *(uint*)p;
+     131:	8b 10                	mov    (%eax),%edx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     133:	8d 9a ff fe fe fe    	lea    -0x1010101(%edx),%ebx
+     139:	f7 d2                	not    %edx
+     13b:	21 da                	and    %ebx,%edx
+     13d:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+     143:	75 05                	jne    14a <strlen+0x34>
+  for(;; p += 4){
+     145:	83 c0 04             	add    $0x4,%eax
+    w = *(uint*)p;
+     148:	eb e7                	jmp    131 <strlen+0x1b>
+      break;
+  }
+  while(*p)
+     14a:	80 38 00             	cmpb   $0x0,(%eax)
+     14d:	74 05                	je     154 <strlen+0x3e>
+    p++;
+     14f:	83 c0 01             	add    $0x1,%eax
+     152:	eb f6                	jmp    14a <strlen+0x34>
+  return p - s;
+     154:	29 c8                	sub    %ecx,%eax
+}
+     156:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     159:	c9                   	leave
+     15a:	c3                   	ret
+
+0000015b <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     15b:	55                   	push   %ebp
+     15c:	89 e5                	mov    %esp,%ebp
+     15e:	57                   	push   %edi
+     15f:	56                   	push   %esi
+     160:	53                   	push   %ebx
+     161:	8b 55 10             	mov    0x10(%ebp),%edx
+  uint h;
+  char *d;
+
+  d = dst;
+  c &= 0xFF;
+     164:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  if(n >= 16){
+     168:	83 fa 0f             	cmp    $0xf,%edx
+     16b:	76 52                	jbe    1bf <memset+0x64>
+    h = -(uint)d & 3;
+     16d:	8b 45 08             	mov    0x8(%ebp),%eax
+     170:	f7 d8                	neg    %eax
+     172:	83 e0 03             	and    $0x3,%eax
+     175:	89 c6                	mov    %eax,%esi
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     177:	8b 7d 08             	mov    0x8(%ebp),%edi
+     17a:	89 c1                	mov    %eax,%ecx
+     17c:	89 d8                	mov    %ebx,%eax
+     17e:	fc                   	cld
+     17f:	f3 aa                	rep stos %al,%es:(%edi)
+    stosb(d, c, h);
+    stosl(d + h, (c<<24)|(c<<16)|(c<<8)|c, (n - h)/4);
+     181:	29 f2                	sub    %esi,%edx
+     183:	89 d1                	mov    %edx,%ecx
+     185:	c1 e9 02             	shr    $0x2,%ecx
+     188:	c1 e0 18             	shl    $0x18,%eax
+     18b:	89 df                	mov    %ebx,%edi
+     18d:	c1 e7 10             	shl    $0x10,%edi
+     190:	09 f8                	or     %edi,%eax
+     192:	89 df                	mov    %ebx,%edi
+     194:	c1 e7 08             	shl    $0x8,%edi
+     197:	09 f8                	or     %edi,%eax
+     199:	09 d8                	or     %ebx,%eax
+     19b:	89 f7                	mov    %esi,%edi
+     19d:	03 7d 08             	add    0x8(%ebp),%edi
+}
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosl" :
+     1a0:	fc                   	cld
+     1a1:	f3 ab                	rep stos %eax,%es:(%edi)
+    d += h + (n - h)/4*4;
+     1a3:	89 d7                	mov    %edx,%edi
+     1a5:	83 e7 fc             	and    $0xfffffffc,%edi
+     1a8:	09 f7                	or     %esi,%edi
+     1aa:	03 7d 08             	add    0x8(%ebp),%edi
+    n = (n - h)%4;
+     1ad:	83 e2 03             	and    $0x3,%edx
+  asm volatile("cld; rep stosb" :
+     1b0:	89 d1                	mov    %edx,%ecx
+     1b2:	89 d8                	mov    %ebx,%eax
+     1b4:	fc                   	cld
+     1b5:	f3 aa                	rep stos %al,%es:(%edi)
+  }
+  stosb(d, c, n);
+  return dst;
+}
+     1b7:	8b 45 08             	mov    0x8(%ebp),%eax
+     1ba:	5b                   	pop    %ebx
+     1bb:	5e                   	pop    %esi
+     1bc:	5f                   	pop    %edi
+     1bd:	5d                   	pop    %ebp
+     1be:	c3                   	ret
+  d = dst;
+     1bf:	8b 7d 08             	mov    0x8(%ebp),%edi
+     1c2:	eb ec                	jmp    1b0 <memset+0x55>
+
+000001c4 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     1c4:	55                   	push   %ebp
+     1c5:	89 e5                	mov    %esp,%ebp
+     1c7:	8b 45 08             	mov    0x8(%ebp),%eax
+     1ca:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     1ce:	eb 03                	jmp    1d3 <strchr+0xf>
+     1d0:	83 c0 01             	add    $0x1,%eax
+     1d3:	0f b6 10             	movzbl (%eax),%edx
+     1d6:	84 d2                	test   %dl,%dl
+     1d8:	74 06                	je     1e0 <strchr+0x1c>
+    if(*s == c)
+     1da:	38 ca                	cmp    %cl,%dl
+     1dc:	75 f2                	jne    1d0 <strchr+0xc>
+     1de:	eb 05                	jmp    1e5 <strchr+0x21>
+      return (char*)s;
+  return 0;
+     1e0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     1e5:	5d                   	pop    %ebp
+     1e6:	c3                   	ret
+
+000001e7 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     1e7:	55                   	push   %ebp
+     1e8:	89 e5                	mov    %esp,%ebp
+     1ea:	56                   	push   %esi
+     1eb:	53                   	push   %ebx
+     1ec:	8b 55 08             	mov    0x8(%ebp),%edx
+     1ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     1f2:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  // A word at a time while they agree.
+  if((((uint)s1 | (uint)s2) & 3) == 0)
+     1f5:	89 d3                	mov    %edx,%ebx
+     1f7:	09 cb                	or     %ecx,%ebx
+     1f9:	f6 c3 03             	test   $0x3,%bl
+     1fc:	74 24                	je     222 <memcmp+0x3b>
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+      s1 += 4, s2 += 4;
+  while(n-- > 0){
+     1fe:	8d 70 ff             	lea    -0x1(%eax),%esi
+     201:	85 c0                	test   %eax,%eax
+     203:	74 32                	je     237 <memcmp+0x50>
+    if(*s1 != *s2)
+     205:	0f b6 02             	movzbl (%edx),%eax
+     208:	0f b6 19             	movzbl (%ecx),%ebx
+     20b:	38 d8                	cmp    %bl,%al
+     20d:	75 20                	jne    22f <memcmp+0x48>
+      return *s1 - *s2;
+    s1++, s2++;
+     20f:	83 c2 01             	add    $0x1,%edx
+     212:	83 c1 01             	add    $0x1,%ecx
+  while(n-- > 0){
+     215:	89 f0                	mov    %esi,%eax
+     217:	eb e5                	jmp    1fe <memcmp+0x17>
+      s1 += 4, s2 += 4;
+     219:	83 c2 04             	add    $0x4,%edx
+     21c:	83 c1 04             	add    $0x4,%ecx
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+     21f:	83 e8 04             	sub    $0x4,%eax
+     222:	83 f8 03             	cmp    $0x3,%eax
+     225:	76 d7                	jbe    1fe <memcmp+0x17>
+     227:	8b 31                	mov    (%ecx),%esi
+     229:	39 32                	cmp    %esi,(%edx)
+     22b:	74 ec                	je     219 <memcmp+0x32>
+     22d:	eb cf                	jmp    1fe <memcmp+0x17>
+      return *s1 - *s2;
+     22f:	0f b6 c0             	movzbl %al,%eax
+     232:	0f b6 db             	movzbl %bl,%ebx
+     235:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     237:	5b                   	pop    %ebx
+     238:	5e                   	pop    %esi
+     239:	5d                   	pop    %ebp
+     23a:	c3                   	ret
+
+0000023b <memchr>:
+// The first c in the n bytes at v, or 0.  Once aligned, a word at
+// a time, with the word's bytes that equal c turned into zeroes
+// and those looked for.
+void*
+memchr(const void *v, int c, uint n)
+{
+     23b:	55                   	push   %ebp
+     23c:	89 e5                	mov    %esp,%ebp
+     23e:	57                   	push   %edi
+     23f:	56                   	push   %esi
+     240:	53                   	push   %ebx
+     241:	8b 45 08             	mov    0x8(%ebp),%eax
+     244:	8b 55 10             	mov    0x10(%ebp),%edx
+  const uchar *s;
+  uint w, rep;
+
+  s = v;
+  c = (uchar)c;
+     247:	0f b6 75 0c          	movzbl 0xc(%ebp),%esi
+  for(; n > 0 && ((uint)s & 3); n--, s++)
+     24b:	eb 06                	jmp    253 <memchr+0x18>
+     24d:	83 ea 01             	sub    $0x1,%edx
+     250:	83 c0 01             	add    $0x1,%eax
+     253:	85 d2                	test   %edx,%edx
+     255:	74 0d                	je     264 <memchr+0x29>
+     257:	a8 03                	test   $0x3,%al
+     259:	74 09                	je     264 <memchr+0x29>
+    if(*s == c)
+     25b:	0f b6 08             	movzbl (%eax),%ecx
+     25e:	39 f1                	cmp    %esi,%ecx
+     260:	75 eb                	jne    24d <memchr+0x12>
+     262:	eb 41                	jmp    2a5 <memchr+0x6a>
+      return (void*)s;
+  rep = c * 0x01010101;
+     264:	69 fe 01 01 01 01    	imul   $0x1010101,%esi,%edi
+  for(; n >= 4; n -= 4, s += 4){
+     26a:	eb 06                	jmp    272 <memchr+0x37>
+     26c:	83 ea 04             	sub    $0x4,%edx
+     26f:	83 c0 04             	add    $0x4,%eax
+     272:	83 fa 03             	cmp    $0x3,%edx
+     275:	76 16                	jbe    28d <memchr+0x52>
+    w = *(uint*)s ^ rep;
+     277:	89 f9                	mov    %edi,%ecx
+     279:	33 08                	xor    (%eax),%ecx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     27b:	8d 99 ff fe fe fe    	lea    -0x1010101(%ecx),%ebx
+     281:	f7 d1                	not    %ecx
+     283:	21 cb                	and    %ecx,%ebx
+     285:	f7 c3 80 80 80 80    	test   $0x80808080,%ebx
+     28b:	74 df                	je     26c <memchr+0x31>
+      break;
+  }
+  for(; n > 0; n--, s++)
+     28d:	85 d2                	test   %edx,%edx
+     28f:	74 0f                	je     2a0 <memchr+0x65>
+    if(*s == c)
+     291:	0f b6 08             	movzbl (%eax),%ecx
+     294:	39 f1                	cmp    %esi,%ecx
+     296:	74 0d                	je     2a5 <memchr+0x6a>
+  for(; n > 0; n--, s++)
+     298:	83 ea 01             	sub    $0x1,%edx
+     29b:	83 c0 01             	add    $0x1,%eax
+     29e:	eb ed                	jmp    28d <memchr+0x52>
+      return (void*)s;
+  return 0;
+     2a0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     2a5:	5b                   	pop    %ebx
+     2a6:	5e                   	pop    %esi
+     2a7:	5f                   	pop    %edi
+     2a8:	5d                   	pop    %ebp
+     2a9:	c3                   	ret
+
+000002aa <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     2aa:	55                   	push   %ebp
+     2ab:	89 e5                	mov    %esp,%ebp
+     2ad:	57                   	push   %edi
+     2ae:	56                   	push   %esi
+     2af:	53                   	push   %ebx
+     2b0:	83 ec 1c             	sub    $0x1c,%esp
+     2b3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     2b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+     2bb:	89 de                	mov    %ebx,%esi
+     2bd:	83 c3 01             	add    $0x1,%ebx
+     2c0:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     2c3:	7d 2e                	jge    2f3 <gets+0x49>
+    cc = read(0, &c, 1);
+     2c5:	83 ec 04             	sub    $0x4,%esp
+     2c8:	6a 01                	push   $0x1
+     2ca:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     2cd:	50                   	push   %eax
+     2ce:	6a 00                	push   $0x0
+     2d0:	e8 51 05 00 00       	call   826 <read>
+    if(cc < 1)
+     2d5:	83 c4 10             	add    $0x10,%esp
+     2d8:	85 c0                	test   %eax,%eax
+     2da:	7e 17                	jle    2f3 <gets+0x49>
+      break;
+    buf[i++] = c;
+     2dc:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     2e0:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+     2e3:	3c 0a                	cmp    $0xa,%al
+     2e5:	0f 94 c2             	sete   %dl
+     2e8:	3c 0d                	cmp    $0xd,%al
+     2ea:	0f 94 c0             	sete   %al
+     2ed:	08 c2                	or     %al,%dl
+     2ef:	74 ca                	je     2bb <gets+0x11>
+    buf[i++] = c;
+     2f1:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+     2f3:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+     2f7:	89 f8                	mov    %edi,%eax
+     2f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     2fc:	5b                   	pop    %ebx
+     2fd:	5e                   	pop    %esi
+     2fe:	5f                   	pop    %edi
+     2ff:	5d                   	pop    %ebp
+     300:	c3                   	ret
+
+00000301 <atoi>:
+  return r;
+}
+
+int
+atoi(const char *s)
+{
+     301:	55                   	push   %ebp
+     302:	89 e5                	mov    %esp,%ebp
+     304:	53                   	push   %ebx
+     305:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+     308:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+     30d:	eb 10                	jmp    31f <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+     30f:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+     312:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+     315:	83 c1 01             	add    $0x1,%ecx
+     318:	0f be c0             	movsbl %al,%eax
+     31b:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+     31f:	0f b6 01             	movzbl (%ecx),%eax
+     322:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     325:	80 fb 09             	cmp    $0x9,%bl
+     328:	76 e5                	jbe    30f <atoi+0xe>
+  return n;
+}
+     32a:	89 d0                	mov    %edx,%eax
+     32c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     32f:	c9                   	leave
+     330:	c3                   	ret
+
+00000331 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     331:	55                   	push   %ebp
+     332:	89 e5                	mov    %esp,%ebp
+     334:	57                   	push   %edi
+     335:	56                   	push   %esi
+     336:	53                   	push   %ebx
+     337:	83 ec 08             	sub    $0x8,%esp
+     33a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     33d:	8b 55 0c             	mov    0xc(%ebp),%edx
+     340:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *src;
+  int h;
+
+  dst = vdst;
+  src = vsrc;
+  if(n <= 0)
+     343:	85 c0                	test   %eax,%eax
+     345:	0f 8e 82 00 00 00    	jle    3cd <memmove+0x9c>
+    return vdst;
+  if(src < dst && src + n > dst){
+     34b:	39 da                	cmp    %ebx,%edx
+     34d:	73 07                	jae    356 <memmove+0x25>
+     34f:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+     352:	39 cb                	cmp    %ecx,%ebx
+     354:	72 5e                	jb     3b4 <memmove+0x83>
+    movsbback(dst + n - 1, src + n - 1, n);
+    return vdst;
+  }
+  if(n >= 16 && (((uint)dst ^ (uint)src) & 3) == 0){
+     356:	83 f8 0f             	cmp    $0xf,%eax
+     359:	7e 69                	jle    3c4 <memmove+0x93>
+     35b:	89 d9                	mov    %ebx,%ecx
+     35d:	31 d1                	xor    %edx,%ecx
+     35f:	f6 c1 03             	test   $0x3,%cl
+     362:	75 73                	jne    3d7 <memmove+0xa6>
+    h = -(uint)dst & 3;
+     364:	89 d9                	mov    %ebx,%ecx
+     366:	f7 d9                	neg    %ecx
+     368:	83 e1 03             	and    $0x3,%ecx
+}
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsb" :
+     36b:	89 df                	mov    %ebx,%edi
+     36d:	89 d6                	mov    %edx,%esi
+     36f:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+     372:	fc                   	cld
+     373:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    movsb(dst, src, h);
+    dst += h, src += h, n -= h;
+     375:	8b 75 f0             	mov    -0x10(%ebp),%esi
+     378:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+     37b:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+     37e:	29 f0                	sub    %esi,%eax
+    movsl(dst, src, n/4);
+     380:	8d 50 03             	lea    0x3(%eax),%edx
+     383:	0f 49 d0             	cmovns %eax,%edx
+     386:	c1 fa 02             	sar    $0x2,%edx
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+     389:	89 7d f0             	mov    %edi,-0x10(%ebp)
+     38c:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     38f:	89 ce                	mov    %ecx,%esi
+     391:	89 d1                	mov    %edx,%ecx
+     393:	fc                   	cld
+     394:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    dst += n/4*4, src += n/4*4, n %= 4;
+     396:	c1 e2 02             	shl    $0x2,%edx
+     399:	8b 7d f0             	mov    -0x10(%ebp),%edi
+     39c:	01 d7                	add    %edx,%edi
+     39e:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     3a1:	01 ca                	add    %ecx,%edx
+     3a3:	89 c6                	mov    %eax,%esi
+     3a5:	c1 fe 1f             	sar    $0x1f,%esi
+     3a8:	c1 ee 1e             	shr    $0x1e,%esi
+     3ab:	01 f0                	add    %esi,%eax
+     3ad:	83 e0 03             	and    $0x3,%eax
+     3b0:	29 f0                	sub    %esi,%eax
+     3b2:	eb 12                	jmp    3c6 <memmove+0x95>
+    movsbback(dst + n - 1, src + n - 1, n);
+     3b4:	8d 78 ff             	lea    -0x1(%eax),%edi
+     3b7:	8d 34 3a             	lea    (%edx,%edi,1),%esi
+     3ba:	01 df                	add    %ebx,%edi
+// Copy cnt bytes down from the last ones, at dst and src, to the
+// first: for overlapping moves up.
+static inline void
+movsbback(void *dst, const void *src, int cnt)
+{
+  asm volatile("std; rep movsb; cld" :
+     3bc:	89 c1                	mov    %eax,%ecx
+     3be:	fd                   	std
+     3bf:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     3c1:	fc                   	cld
+    return vdst;
+     3c2:	eb 09                	jmp    3cd <memmove+0x9c>
+  dst = vdst;
+     3c4:	89 df                	mov    %ebx,%edi
+  asm volatile("cld; rep movsb" :
+     3c6:	89 d6                	mov    %edx,%esi
+     3c8:	89 c1                	mov    %eax,%ecx
+     3ca:	fc                   	cld
+     3cb:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  }
+  movsb(dst, src, n);
+  return vdst;
+}
+     3cd:	89 d8                	mov    %ebx,%eax
+     3cf:	83 c4 08             	add    $0x8,%esp
+     3d2:	5b                   	pop    %ebx
+     3d3:	5e                   	pop    %esi
+     3d4:	5f                   	pop    %edi
+     3d5:	5d                   	pop    %ebp
+     3d6:	c3                   	ret
+  dst = vdst;
+     3d7:	89 df                	mov    %ebx,%edi
+     3d9:	eb eb                	jmp    3c6 <memmove+0x95>
+
+000003db <vclock_gettime>:
+
+// clock_gettime() without a system call: read the clock page
+// that the kernel maps at CLOCKPAGE (see clock.h).
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+     3db:	55                   	push   %ebp
+     3dc:	89 e5                	mov    %esp,%ebp
+     3de:	57                   	push   %edi
+     3df:	56                   	push   %esi
+     3e0:	53                   	push   %ebx
+     3e1:	83 ec 14             	sub    $0x14,%esp
+  struct clockpage *cp = (struct clockpage*)CLOCKPAGE;
+  uint seq, rem, d;
+  uint64 tsc, ns, now;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+     3e4:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     3e8:	0f 87 a3 00 00 00    	ja     491 <vclock_gettime+0xb6>
+    return -1;
+  do {
+    seq = cp->seq;
+     3ee:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+    __sync_synchronize();
+     3f3:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    tsc = cp->tsc;
+     3f8:	8b 15 10 f0 ff 7f    	mov    0x7ffff010,%edx
+     3fe:	8b 1d 14 f0 ff 7f    	mov    0x7ffff014,%ebx
+    ns = cp->ns;
+     404:	8b 35 18 f0 ff 7f    	mov    0x7ffff018,%esi
+     40a:	8b 3d 1c f0 ff 7f    	mov    0x7ffff01c,%edi
+    __sync_synchronize();
+     410:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != cp->seq);
+     415:	89 c1                	mov    %eax,%ecx
+     417:	83 e1 01             	and    $0x1,%ecx
+     41a:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     41d:	75 cf                	jne    3ee <vclock_gettime+0x13>
+     41f:	8b 0d 00 f0 ff 7f    	mov    0x7ffff000,%ecx
+     425:	39 c1                	cmp    %eax,%ecx
+     427:	75 c5                	jne    3ee <vclock_gettime+0x13>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+     429:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     42c:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     42f:	0f 31                	rdtsc
+     431:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     434:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     437:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  now = rdtsc();
+  // Less than a tick has passed since the update, so the delta
+  // fits in 32 bits.
+  d = now > tsc ? now - tsc : 0;
+     43a:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     43d:	19 d3                	sbb    %edx,%ebx
+     43f:	73 07                	jae    448 <vclock_gettime+0x6d>
+     441:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+     444:	29 d8                	sub    %ebx,%eax
+     446:	89 c1                	mov    %eax,%ecx
+  ns += ((uint64)d * cp->mult) >> cp->shift;
+     448:	89 c8                	mov    %ecx,%eax
+     44a:	f7 25 04 f0 ff 7f    	mull   0x7ffff004
+     450:	0f b6 0d 08 f0 ff 7f 	movzbl 0x7ffff008,%ecx
+     457:	0f ad d0             	shrd   %cl,%edx,%eax
+     45a:	d3 ea                	shr    %cl,%edx
+     45c:	f6 c1 20             	test   $0x20,%cl
+     45f:	74 04                	je     465 <vclock_gettime+0x8a>
+     461:	89 d0                	mov    %edx,%eax
+     463:	31 d2                	xor    %edx,%edx
+     465:	01 f0                	add    %esi,%eax
+     467:	11 fa                	adc    %edi,%edx
+static inline uint
+divl(uint64 n, uint d, uint *r)
+{
+  uint q;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (*r) :
+     469:	bb 00 ca 9a 3b       	mov    $0x3b9aca00,%ebx
+     46e:	f7 f3                	div    %ebx
+  ts->tv_sec = divl(ns, 1000000000, &rem);
+     470:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     473:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = rem;
+     475:	89 57 04             	mov    %edx,0x4(%edi)
+  if(clk == CLOCK_REALTIME)
+     478:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     47c:	75 1a                	jne    498 <vclock_gettime+0xbd>
+    ts->tv_sec += cp->boottime;
+     47e:	03 05 0c f0 ff 7f    	add    0x7ffff00c,%eax
+     484:	89 07                	mov    %eax,(%edi)
+  return 0;
+     486:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     489:	83 c4 14             	add    $0x14,%esp
+     48c:	5b                   	pop    %ebx
+     48d:	5e                   	pop    %esi
+     48e:	5f                   	pop    %edi
+     48f:	5d                   	pop    %ebp
+     490:	c3                   	ret
+    return -1;
+     491:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     496:	eb f1                	jmp    489 <vclock_gettime+0xae>
+  return 0;
+     498:	b8 00 00 00 00       	mov    $0x0,%eax
+     49d:	eb ea                	jmp    489 <vclock_gettime+0xae>
+
+0000049f <flush>:
+
+// Write out fd's buffer, or with fd < 0 every buffer.
+// Returns -1 if a write fails.
+int
+flush(int fd)
+{
+     49f:	55                   	push   %ebp
+     4a0:	89 e5                	mov    %esp,%ebp
+     4a2:	56                   	push   %esi
+     4a3:	53                   	push   %ebx
+     4a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  int r, n;
+
+  if(fd < 0){
+     4a7:	85 c0                	test   %eax,%eax
+     4a9:	78 5d                	js     508 <flush+0x69>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+      if(flush(fd) < 0)
+        r = -1;
+    return r;
+  }
+  if(fd >= NOBUF || (n = obuf[fd].n) == 0)
+     4ab:	83 f8 0f             	cmp    $0xf,%eax
+     4ae:	7f 64                	jg     514 <flush+0x75>
+     4b0:	69 d0 08 02 00 00    	imul   $0x208,%eax,%edx
+     4b6:	8b b2 e4 19 00 00    	mov    0x19e4(%edx),%esi
+     4bc:	85 f6                	test   %esi,%esi
+     4be:	74 59                	je     519 <flush+0x7a>
+    return 0;
+  obuf[fd].n = 0;
+     4c0:	c7 82 e4 19 00 00 00 	movl   $0x0,0x19e4(%edx)
+     4c7:	00 00 00 
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     4ca:	81 c2 e8 19 00 00    	add    $0x19e8,%edx
+     4d0:	83 ec 04             	sub    $0x4,%esp
+     4d3:	56                   	push   %esi
+     4d4:	52                   	push   %edx
+     4d5:	50                   	push   %eax
+     4d6:	e8 5a 03 00 00       	call   835 <write>
+     4db:	83 c4 10             	add    $0x10,%esp
+     4de:	39 f0                	cmp    %esi,%eax
+     4e0:	75 40                	jne    522 <flush+0x83>
+     4e2:	be 00 00 00 00       	mov    $0x0,%esi
+     4e7:	eb 30                	jmp    519 <flush+0x7a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     4e9:	83 c3 01             	add    $0x1,%ebx
+     4ec:	83 fb 0f             	cmp    $0xf,%ebx
+     4ef:	7f 28                	jg     519 <flush+0x7a>
+      if(flush(fd) < 0)
+     4f1:	83 ec 0c             	sub    $0xc,%esp
+     4f4:	53                   	push   %ebx
+     4f5:	e8 a5 ff ff ff       	call   49f <flush>
+     4fa:	83 c4 10             	add    $0x10,%esp
+     4fd:	85 c0                	test   %eax,%eax
+     4ff:	79 e8                	jns    4e9 <flush+0x4a>
+        r = -1;
+     501:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     506:	eb e1                	jmp    4e9 <flush+0x4a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     508:	be 00 00 00 00       	mov    $0x0,%esi
+     50d:	bb 00 00 00 00       	mov    $0x0,%ebx
+     512:	eb d8                	jmp    4ec <flush+0x4d>
+    return 0;
+     514:	be 00 00 00 00       	mov    $0x0,%esi
+}
+     519:	89 f0                	mov    %esi,%eax
+     51b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     51e:	5b                   	pop    %ebx
+     51f:	5e                   	pop    %esi
+     520:	5d                   	pop    %ebp
+     521:	c3                   	ret
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     522:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     527:	eb f0                	jmp    519 <flush+0x7a>
+
+00000529 <bufreset>:
+
+static void
+bufreset(int fd)
+{
+  if(fd >= 0 && fd < NOBUF){
+     529:	83 f8 0f             	cmp    $0xf,%eax
+     52c:	76 01                	jbe    52f <bufreset+0x6>
+     52e:	c3                   	ret
+{
+     52f:	55                   	push   %ebp
+     530:	89 e5                	mov    %esp,%ebp
+     532:	53                   	push   %ebx
+     533:	83 ec 10             	sub    $0x10,%esp
+     536:	89 c3                	mov    %eax,%ebx
+    flush(fd);
+     538:	50                   	push   %eax
+     539:	e8 61 ff ff ff       	call   49f <flush>
+    obuf[fd].mode = BUNKNOWN;
+     53e:	69 db 08 02 00 00    	imul   $0x208,%ebx,%ebx
+     544:	c7 83 e0 19 00 00 00 	movl   $0x0,0x19e0(%ebx)
+     54b:	00 00 00 
+     54e:	83 c4 10             	add    $0x10,%esp
+  }
+}
+     551:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     554:	c9                   	leave
+     555:	c3                   	ret
+
+00000556 <bufwrite>:
+
+// Write n bytes from p to fd, through its buffer.
+// Returns n, or -1 if a write fails.
+int
+bufwrite(int fd, const void *p, int n)
+{
+     556:	55                   	push   %ebp
+     557:	89 e5                	mov    %esp,%ebp
+     559:	57                   	push   %edi
+     55a:	56                   	push   %esi
+     55b:	53                   	push   %ebx
+     55c:	83 ec 3c             	sub    $0x3c,%esp
+     55f:	8b 75 08             	mov    0x8(%ebp),%esi
+     562:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct stat st;
+  const char *s;
+  int i;
+
+  if(fd < 0 || fd >= NOBUF)
+     565:	83 fe 0f             	cmp    $0xf,%esi
+     568:	0f 87 a2 00 00 00    	ja     610 <bufwrite+0xba>
+    return write(fd, p, n);
+  if(obuf[fd].mode == BUNKNOWN){
+     56e:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     574:	83 b8 e0 19 00 00 00 	cmpl   $0x0,0x19e0(%eax)
+     57b:	75 19                	jne    596 <bufwrite+0x40>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     57d:	83 fe 02             	cmp    $0x2,%esi
+     580:	0f 85 9c 00 00 00    	jne    622 <bufwrite+0xcc>
+      obuf[fd].mode = BNONE;
+     586:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     58c:	c7 80 e0 19 00 00 01 	movl   $0x1,0x19e0(%eax)
+     593:	00 00 00 
+    else
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+  }
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     596:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     59c:	89 da                	mov    %ebx,%edx
+     59e:	03 90 e4 19 00 00    	add    0x19e4(%eax),%edx
+     5a4:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+     5aa:	0f 8f ae 00 00 00    	jg     65e <bufwrite+0x108>
+    return -1;
+  if(n >= OBUFSZ)
+     5b0:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+     5b6:	0f 8f bd 00 00 00    	jg     679 <bufwrite+0x123>
+    return write(fd, p, n);
+  memmove(obuf[fd].buf + obuf[fd].n, p, n);
+     5bc:	69 d6 08 02 00 00    	imul   $0x208,%esi,%edx
+     5c2:	8d ba e0 19 00 00    	lea    0x19e0(%edx),%edi
+     5c8:	8b 82 e4 19 00 00    	mov    0x19e4(%edx),%eax
+     5ce:	83 ec 04             	sub    $0x4,%esp
+     5d1:	53                   	push   %ebx
+     5d2:	ff 75 0c             	push   0xc(%ebp)
+     5d5:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     5d8:	8d 84 10 e8 19 00 00 	lea    0x19e8(%eax,%edx,1),%eax
+     5df:	50                   	push   %eax
+     5e0:	e8 4c fd ff ff       	call   331 <memmove>
+  obuf[fd].n += n;
+     5e5:	01 5f 04             	add    %ebx,0x4(%edi)
+  if(obuf[fd].mode == BNONE)
+     5e8:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     5eb:	8b 82 e0 19 00 00    	mov    0x19e0(%edx),%eax
+     5f1:	83 c4 10             	add    $0x10,%esp
+     5f4:	83 f8 01             	cmp    $0x1,%eax
+     5f7:	0f 84 91 00 00 00    	je     68e <bufwrite+0x138>
+    return flush(fd) < 0 ? -1 : n;
+  if(obuf[fd].mode == BLINE)
+     5fd:	83 f8 02             	cmp    $0x2,%eax
+     600:	0f 84 ca 00 00 00    	je     6d0 <bufwrite+0x17a>
+    for(s = p, i = 0; i < n; i++)
+      if(s[i] == '\n')
+        return flush(fd) < 0 ? -1 : n;
+  return n;
+     606:	89 d8                	mov    %ebx,%eax
+}
+     608:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     60b:	5b                   	pop    %ebx
+     60c:	5e                   	pop    %esi
+     60d:	5f                   	pop    %edi
+     60e:	5d                   	pop    %ebp
+     60f:	c3                   	ret
+    return write(fd, p, n);
+     610:	83 ec 04             	sub    $0x4,%esp
+     613:	53                   	push   %ebx
+     614:	ff 75 0c             	push   0xc(%ebp)
+     617:	56                   	push   %esi
+     618:	e8 18 02 00 00       	call   835 <write>
+     61d:	83 c4 10             	add    $0x10,%esp
+     620:	eb e6                	jmp    608 <bufwrite+0xb2>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     622:	83 ec 08             	sub    $0x8,%esp
+     625:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     628:	50                   	push   %eax
+     629:	56                   	push   %esi
+     62a:	e8 51 02 00 00       	call   880 <fstat>
+     62f:	83 c4 10             	add    $0x10,%esp
+     632:	85 c0                	test   %eax,%eax
+     634:	0f 88 4c ff ff ff    	js     586 <bufwrite+0x30>
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+     63a:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     63f:	74 16                	je     657 <bufwrite+0x101>
+     641:	ba 03 00 00 00       	mov    $0x3,%edx
+     646:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     64c:	89 90 e0 19 00 00    	mov    %edx,0x19e0(%eax)
+     652:	e9 3f ff ff ff       	jmp    596 <bufwrite+0x40>
+     657:	ba 02 00 00 00       	mov    $0x2,%edx
+     65c:	eb e8                	jmp    646 <bufwrite+0xf0>
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     65e:	83 ec 0c             	sub    $0xc,%esp
+     661:	56                   	push   %esi
+     662:	e8 38 fe ff ff       	call   49f <flush>
+     667:	83 c4 10             	add    $0x10,%esp
+     66a:	85 c0                	test   %eax,%eax
+     66c:	0f 89 3e ff ff ff    	jns    5b0 <bufwrite+0x5a>
+    return -1;
+     672:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     677:	eb 8f                	jmp    608 <bufwrite+0xb2>
+    return write(fd, p, n);
+     679:	83 ec 04             	sub    $0x4,%esp
+     67c:	53                   	push   %ebx
+     67d:	ff 75 0c             	push   0xc(%ebp)
+     680:	56                   	push   %esi
+     681:	e8 af 01 00 00       	call   835 <write>
+     686:	83 c4 10             	add    $0x10,%esp
+     689:	e9 7a ff ff ff       	jmp    608 <bufwrite+0xb2>
+    return flush(fd) < 0 ? -1 : n;
+     68e:	83 ec 0c             	sub    $0xc,%esp
+     691:	56                   	push   %esi
+     692:	e8 08 fe ff ff       	call   49f <flush>
+     697:	83 c4 10             	add    $0x10,%esp
+     69a:	85 c0                	test   %eax,%eax
+     69c:	78 07                	js     6a5 <bufwrite+0x14f>
+     69e:	89 d8                	mov    %ebx,%eax
+     6a0:	e9 63 ff ff ff       	jmp    608 <bufwrite+0xb2>
+     6a5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     6aa:	e9 59 ff ff ff       	jmp    608 <bufwrite+0xb2>
+        return flush(fd) < 0 ? -1 : n;
+     6af:	83 ec 0c             	sub    $0xc,%esp
+     6b2:	56                   	push   %esi
+     6b3:	e8 e7 fd ff ff       	call   49f <flush>
+     6b8:	83 c4 10             	add    $0x10,%esp
+     6bb:	85 c0                	test   %eax,%eax
+     6bd:	78 07                	js     6c6 <bufwrite+0x170>
+     6bf:	89 d8                	mov    %ebx,%eax
+     6c1:	e9 42 ff ff ff       	jmp    608 <bufwrite+0xb2>
+     6c6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     6cb:	e9 38 ff ff ff       	jmp    608 <bufwrite+0xb2>
+    for(s = p, i = 0; i < n; i++)
+     6d0:	b8 00 00 00 00       	mov    $0x0,%eax
+     6d5:	39 d8                	cmp    %ebx,%eax
+     6d7:	7d 0e                	jge    6e7 <bufwrite+0x191>
+      if(s[i] == '\n')
+     6d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     6dc:	80 3c 01 0a          	cmpb   $0xa,(%ecx,%eax,1)
+     6e0:	74 cd                	je     6af <bufwrite+0x159>
+    for(s = p, i = 0; i < n; i++)
+     6e2:	83 c0 01             	add    $0x1,%eax
+     6e5:	eb ee                	jmp    6d5 <bufwrite+0x17f>
+  return n;
+     6e7:	89 d8                	mov    %ebx,%eax
+     6e9:	e9 1a ff ff ff       	jmp    608 <bufwrite+0xb2>
+
+000006ee <fork>:
+
+int
+fork(void)
+{
+     6ee:	55                   	push   %ebp
+     6ef:	89 e5                	mov    %esp,%ebp
+     6f1:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     6f4:	6a ff                	push   $0xffffffff
+     6f6:	e8 a4 fd ff ff       	call   49f <flush>
+  return _fork();
+     6fb:	e8 bd 00 00 00       	call   7bd <_fork>
+}
+     700:	c9                   	leave
+     701:	c3                   	ret
+
+00000702 <exit>:
+
+int
+exit(void)
+{
+     702:	55                   	push   %ebp
+     703:	89 e5                	mov    %esp,%ebp
+     705:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     708:	6a ff                	push   $0xffffffff
+     70a:	e8 90 fd ff ff       	call   49f <flush>
+  _exit();
+     70f:	e8 b8 00 00 00       	call   7cc <_exit>
+
+00000714 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     714:	55                   	push   %ebp
+     715:	89 e5                	mov    %esp,%ebp
+     717:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     71a:	6a ff                	push   $0xffffffff
+     71c:	e8 7e fd ff ff       	call   49f <flush>
+  return _exec(path, argv);
+     721:	83 c4 08             	add    $0x8,%esp
+     724:	ff 75 0c             	push   0xc(%ebp)
+     727:	ff 75 08             	push   0x8(%ebp)
+     72a:	e8 bb 00 00 00       	call   7ea <_exec>
+}
+     72f:	c9                   	leave
+     730:	c3                   	ret
+
+00000731 <close>:
+
+int
+close(int fd)
+{
+     731:	55                   	push   %ebp
+     732:	89 e5                	mov    %esp,%ebp
+     734:	53                   	push   %ebx
+     735:	83 ec 04             	sub    $0x4,%esp
+     738:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bufreset(fd);
+     73b:	89 d8                	mov    %ebx,%eax
+     73d:	e8 e7 fd ff ff       	call   529 <bufreset>
+  return _close(fd);
+     742:	83 ec 0c             	sub    $0xc,%esp
+     745:	53                   	push   %ebx
+     746:	e8 90 00 00 00       	call   7db <_close>
+}
+     74b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     74e:	c9                   	leave
+     74f:	c3                   	ret
+
+00000750 <stat>:
+{
+     750:	55                   	push   %ebp
+     751:	89 e5                	mov    %esp,%ebp
+     753:	56                   	push   %esi
+     754:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     755:	83 ec 08             	sub    $0x8,%esp
+     758:	6a 00                	push   $0x0
+     75a:	ff 75 08             	push   0x8(%ebp)
+     75d:	e8 f1 00 00 00       	call   853 <open>
+  if(fd < 0)
+     762:	83 c4 10             	add    $0x10,%esp
+     765:	85 c0                	test   %eax,%eax
+     767:	78 24                	js     78d <stat+0x3d>
+     769:	89 c3                	mov    %eax,%ebx
+  r = fstat(fd, st);
+     76b:	83 ec 08             	sub    $0x8,%esp
+     76e:	ff 75 0c             	push   0xc(%ebp)
+     771:	50                   	push   %eax
+     772:	e8 09 01 00 00       	call   880 <fstat>
+     777:	89 c6                	mov    %eax,%esi
+  close(fd);
+     779:	89 1c 24             	mov    %ebx,(%esp)
+     77c:	e8 b0 ff ff ff       	call   731 <close>
+  return r;
+     781:	83 c4 10             	add    $0x10,%esp
+}
+     784:	89 f0                	mov    %esi,%eax
+     786:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     789:	5b                   	pop    %ebx
+     78a:	5e                   	pop    %esi
+     78b:	5d                   	pop    %ebp
+     78c:	c3                   	ret
+    return -1;
+     78d:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     792:	eb f0                	jmp    784 <stat+0x34>
+
+00000794 <dup2>:
+
+int
+dup2(int oldfd, int newfd)
+{
+     794:	55                   	push   %ebp
+     795:	89 e5                	mov    %esp,%ebp
+     797:	56                   	push   %esi
+     798:	53                   	push   %ebx
+     799:	8b 75 08             	mov    0x8(%ebp),%esi
+     79c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(oldfd != newfd)
+     79f:	39 de                	cmp    %ebx,%esi
+     7a1:	75 11                	jne    7b4 <dup2+0x20>
+    bufreset(newfd);
+  return _dup2(oldfd, newfd);
+     7a3:	83 ec 08             	sub    $0x8,%esp
+     7a6:	53                   	push   %ebx
+     7a7:	56                   	push   %esi
+     7a8:	e8 4c 00 00 00       	call   7f9 <_dup2>
+}
+     7ad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     7b0:	5b                   	pop    %ebx
+     7b1:	5e                   	pop    %esi
+     7b2:	5d                   	pop    %ebp
+     7b3:	c3                   	ret
+    bufreset(newfd);
+     7b4:	89 d8                	mov    %ebx,%eax
+     7b6:	e8 6e fd ff ff       	call   529 <bufreset>
+     7bb:	eb e6                	jmp    7a3 <dup2+0xf>
+
+000007bd <_fork>:
+  1: ret
+
+#define SYSCALL(name) STUB(name, SYS_ ## name)
+
+# ulib.c wraps these, to flush printf()'s buffers first.
+STUB(_fork, SYS_fork)
+     7bd:	b8 01 00 00 00       	mov    $0x1,%eax
+     7c2:	89 e1                	mov    %esp,%ecx
+     7c4:	ba cb 07 00 00       	mov    $0x7cb,%edx
+     7c9:	0f 34                	sysenter
+     7cb:	c3                   	ret
+
+000007cc <_exit>:
+STUB(_exit, SYS_exit)
+     7cc:	b8 02 00 00 00       	mov    $0x2,%eax
+     7d1:	89 e1                	mov    %esp,%ecx
+     7d3:	ba da 07 00 00       	mov    $0x7da,%edx
+     7d8:	0f 34                	sysenter
+     7da:	c3                   	ret
+
+000007db <_close>:
+STUB(_close, SYS_close)
+     7db:	b8 15 00 00 00       	mov    $0x15,%eax
+     7e0:	89 e1                	mov    %esp,%ecx
+     7e2:	ba e9 07 00 00       	mov    $0x7e9,%edx
+     7e7:	0f 34                	sysenter
+     7e9:	c3                   	ret
+
+000007ea <_exec>:
+STUB(_exec, SYS_exec)
+     7ea:	b8 07 00 00 00       	mov    $0x7,%eax
+     7ef:	89 e1                	mov    %esp,%ecx
+     7f1:	ba f8 07 00 00       	mov    $0x7f8,%edx
+     7f6:	0f 34                	sysenter
+     7f8:	c3                   	ret
+
+000007f9 <_dup2>:
+STUB(_dup2, SYS_dup2)
+     7f9:	b8 17 00 00 00       	mov    $0x17,%eax
+     7fe:	89 e1                	mov    %esp,%ecx
+     800:	ba 07 08 00 00       	mov    $0x807,%edx
+     805:	0f 34                	sysenter
+     807:	c3                   	ret
+
+00000808 <wait>:
+
+SYSCALL(wait)
+     808:	b8 03 00 00 00       	mov    $0x3,%eax
+     80d:	89 e1                	mov    %esp,%ecx
+     80f:	ba 16 08 00 00       	mov    $0x816,%edx
+     814:	0f 34                	sysenter
+     816:	c3                   	ret
+
+00000817 <pipe>:
+SYSCALL(pipe)
+     817:	b8 04 00 00 00       	mov    $0x4,%eax
+     81c:	89 e1                	mov    %esp,%ecx
+     81e:	ba 25 08 00 00       	mov    $0x825,%edx
+     823:	0f 34                	sysenter
+     825:	c3                   	ret
+
+00000826 <read>:
+SYSCALL(read)
+     826:	b8 05 00 00 00       	mov    $0x5,%eax
+     82b:	89 e1                	mov    %esp,%ecx
+     82d:	ba 34 08 00 00       	mov    $0x834,%edx
+     832:	0f 34                	sysenter
+     834:	c3                   	ret
+
+00000835 <write>:
+SYSCALL(write)
+     835:	b8 10 00 00 00       	mov    $0x10,%eax
+     83a:	89 e1                	mov    %esp,%ecx
+     83c:	ba 43 08 00 00       	mov    $0x843,%edx
+     841:	0f 34                	sysenter
+     843:	c3                   	ret
+
+00000844 <kill>:
+SYSCALL(kill)
+     844:	b8 06 00 00 00       	mov    $0x6,%eax
+     849:	89 e1                	mov    %esp,%ecx
+     84b:	ba 52 08 00 00       	mov    $0x852,%edx
+     850:	0f 34                	sysenter
+     852:	c3                   	ret
+
+00000853 <open>:
+SYSCALL(open)
+     853:	b8 0f 00 00 00       	mov    $0xf,%eax
+     858:	89 e1                	mov    %esp,%ecx
+     85a:	ba 61 08 00 00       	mov    $0x861,%edx
+     85f:	0f 34                	sysenter
+     861:	c3                   	ret
+
+00000862 <mknod>:
+SYSCALL(mknod)
+     862:	b8 11 00 00 00       	mov    $0x11,%eax
+     867:	89 e1                	mov    %esp,%ecx
+     869:	ba 70 08 00 00       	mov    $0x870,%edx
+     86e:	0f 34                	sysenter
+     870:	c3                   	ret
+
+00000871 <unlink>:
+SYSCALL(unlink)
+     871:	b8 12 00 00 00       	mov    $0x12,%eax
+     876:	89 e1                	mov    %esp,%ecx
+     878:	ba 7f 08 00 00       	mov    $0x87f,%edx
+     87d:	0f 34                	sysenter
+     87f:	c3                   	ret
+
+00000880 <fstat>:
+SYSCALL(fstat)
+     880:	b8 08 00 00 00       	mov    $0x8,%eax
+     885:	89 e1                	mov    %esp,%ecx
+     887:	ba 8e 08 00 00       	mov    $0x88e,%edx
+     88c:	0f 34                	sysenter
+     88e:	c3                   	ret
+
+0000088f <link>:
+SYSCALL(link)
+     88f:	b8 13 00 00 00       	mov    $0x13,%eax
+     894:	89 e1                	mov    %esp,%ecx
+     896:	ba 9d 08 00 00       	mov    $0x89d,%edx
+     89b:	0f 34                	sysenter
+     89d:	c3                   	ret
+
+0000089e <mkdir>:
+SYSCALL(mkdir)
+     89e:	b8 14 00 00 00       	mov    $0x14,%eax
+     8a3:	89 e1                	mov    %esp,%ecx
+     8a5:	ba ac 08 00 00       	mov    $0x8ac,%edx
+     8aa:	0f 34                	sysenter
+     8ac:	c3                   	ret
+
+000008ad <chdir>:
+SYSCALL(chdir)
+     8ad:	b8 09 00 00 00       	mov    $0x9,%eax
+     8b2:	89 e1                	mov    %esp,%ecx
+     8b4:	ba bb 08 00 00       	mov    $0x8bb,%edx
+     8b9:	0f 34                	sysenter
+     8bb:	c3                   	ret
+
+000008bc <dup>:
+SYSCALL(dup)
+     8bc:	b8 0a 00 00 00       	mov    $0xa,%eax
+     8c1:	89 e1                	mov    %esp,%ecx
+     8c3:	ba ca 08 00 00       	mov    $0x8ca,%edx
+     8c8:	0f 34                	sysenter
+     8ca:	c3                   	ret
+
+000008cb <getpid>:
+SYSCALL(getpid)
+     8cb:	b8 0b 00 00 00       	mov    $0xb,%eax
+     8d0:	89 e1                	mov    %esp,%ecx
+     8d2:	ba d9 08 00 00       	mov    $0x8d9,%edx
+     8d7:	0f 34                	sysenter
+     8d9:	c3                   	ret
+
+000008da <sbrk>:
+SYSCALL(sbrk)
+     8da:	b8 0c 00 00 00       	mov    $0xc,%eax
+     8df:	89 e1                	mov    %esp,%ecx
+     8e1:	ba e8 08 00 00       	mov    $0x8e8,%edx
+     8e6:	0f 34                	sysenter
+     8e8:	c3                   	ret
+
+000008e9 <sleep>:
+SYSCALL(sleep)
+     8e9:	b8 0d 00 00 00       	mov    $0xd,%eax
+     8ee:	89 e1                	mov    %esp,%ecx
+     8f0:	ba f7 08 00 00       	mov    $0x8f7,%edx
+     8f5:	0f 34                	sysenter
+     8f7:	c3                   	ret
+
+000008f8 <uptime>:
+SYSCALL(uptime)
+     8f8:	b8 0e 00 00 00       	mov    $0xe,%eax
+     8fd:	89 e1                	mov    %esp,%ecx
+     8ff:	ba 06 09 00 00       	mov    $0x906,%edx
+     904:	0f 34                	sysenter
+     906:	c3                   	ret
+
+00000907 <date>:
+SYSCALL(date)
+     907:	b8 16 00 00 00       	mov    $0x16,%eax
+     90c:	89 e1                	mov    %esp,%ecx
+     90e:	ba 15 09 00 00       	mov    $0x915,%edx
+     913:	0f 34                	sysenter
+     915:	c3                   	ret
+
+00000916 <faultaround>:
+SYSCALL(faultaround)
+     916:	b8 18 00 00 00       	mov    $0x18,%eax
+     91b:	89 e1                	mov    %esp,%ecx
+     91d:	ba 24 09 00 00       	mov    $0x924,%edx
+     922:	0f 34                	sysenter
+     924:	c3                   	ret
+
+00000925 <faultstat>:
+SYSCALL(faultstat)
+     925:	b8 19 00 00 00       	mov    $0x19,%eax
+     92a:	89 e1                	mov    %esp,%ecx
+     92c:	ba 33 09 00 00       	mov    $0x933,%edx
+     931:	0f 34                	sysenter
+     933:	c3                   	ret
+
+00000934 <mmap>:
+SYSCALL(mmap)
+     934:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     939:	89 e1                	mov    %esp,%ecx
+     93b:	ba 42 09 00 00       	mov    $0x942,%edx
+     940:	0f 34                	sysenter
+     942:	c3                   	ret
+
+00000943 <munmap>:
+SYSCALL(munmap)
+     943:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     948:	89 e1                	mov    %esp,%ecx
+     94a:	ba 51 09 00 00       	mov    $0x951,%edx
+     94f:	0f 34                	sysenter
+     951:	c3                   	ret
+
+00000952 <largepages>:
+SYSCALL(largepages)
+     952:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     957:	89 e1                	mov    %esp,%ecx
+     959:	ba 60 09 00 00       	mov    $0x960,%edx
+     95e:	0f 34                	sysenter
+     960:	c3                   	ret
+
+00000961 <spawn>:
+SYSCALL(spawn)
+     961:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     966:	89 e1                	mov    %esp,%ecx
+     968:	ba 6f 09 00 00       	mov    $0x96f,%edx
+     96d:	0f 34                	sysenter
+     96f:	c3                   	ret
+
+00000970 <setpriority>:
+SYSCALL(setpriority)
+     970:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     975:	89 e1                	mov    %esp,%ecx
+     977:	ba 7e 09 00 00       	mov    $0x97e,%edx
+     97c:	0f 34                	sysenter
+     97e:	c3                   	ret
+
+0000097f <getpriority>:
+SYSCALL(getpriority)
+     97f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     984:	89 e1                	mov    %esp,%ecx
+     986:	ba 8d 09 00 00       	mov    $0x98d,%edx
+     98b:	0f 34                	sysenter
+     98d:	c3                   	ret
+
+0000098e <getprocinfo>:
+SYSCALL(getprocinfo)
+     98e:	b8 20 00 00 00       	mov    $0x20,%eax
+     993:	89 e1                	mov    %esp,%ecx
+     995:	ba 9c 09 00 00       	mov    $0x99c,%edx
+     99a:	0f 34                	sysenter
+     99c:	c3                   	ret
+
+0000099d <getcpuinfo>:
+SYSCALL(getcpuinfo)
+     99d:	b8 21 00 00 00       	mov    $0x21,%eax
+     9a2:	89 e1                	mov    %esp,%ecx
+     9a4:	ba ab 09 00 00       	mov    $0x9ab,%edx
+     9a9:	0f 34                	sysenter
+     9ab:	c3                   	ret
+
+000009ac <clone>:
+SYSCALL(clone)
+     9ac:	b8 22 00 00 00       	mov    $0x22,%eax
+     9b1:	89 e1                	mov    %esp,%ecx
+     9b3:	ba ba 09 00 00       	mov    $0x9ba,%edx
+     9b8:	0f 34                	sysenter
+     9ba:	c3                   	ret
+
+000009bb <join>:
+SYSCALL(join)
+     9bb:	b8 23 00 00 00       	mov    $0x23,%eax
+     9c0:	89 e1                	mov    %esp,%ecx
+     9c2:	ba c9 09 00 00       	mov    $0x9c9,%edx
+     9c7:	0f 34                	sysenter
+     9c9:	c3                   	ret
+
+000009ca <futex_wait>:
+SYSCALL(futex_wait)
+     9ca:	b8 24 00 00 00       	mov    $0x24,%eax
+     9cf:	89 e1                	mov    %esp,%ecx
+     9d1:	ba d8 09 00 00       	mov    $0x9d8,%edx
+     9d6:	0f 34                	sysenter
+     9d8:	c3                   	ret
+
+000009d9 <futex_wake>:
+SYSCALL(futex_wake)
+     9d9:	b8 25 00 00 00       	mov    $0x25,%eax
+     9de:	89 e1                	mov    %esp,%ecx
+     9e0:	ba e7 09 00 00       	mov    $0x9e7,%edx
+     9e5:	0f 34                	sysenter
+     9e7:	c3                   	ret
+
+000009e8 <setaffinity>:
+SYSCALL(setaffinity)
+     9e8:	b8 26 00 00 00       	mov    $0x26,%eax
+     9ed:	89 e1                	mov    %esp,%ecx
+     9ef:	ba f6 09 00 00       	mov    $0x9f6,%edx
+     9f4:	0f 34                	sysenter
+     9f6:	c3                   	ret
+
+000009f7 <getaffinity>:
+SYSCALL(getaffinity)
+     9f7:	b8 27 00 00 00       	mov    $0x27,%eax
+     9fc:	89 e1                	mov    %esp,%ecx
+     9fe:	ba 05 0a 00 00       	mov    $0xa05,%edx
+     a03:	0f 34                	sysenter
+     a05:	c3                   	ret
+
+00000a06 <clock_gettime>:
+SYSCALL(clock_gettime)
+     a06:	b8 28 00 00 00       	mov    $0x28,%eax
+     a0b:	89 e1                	mov    %esp,%ecx
+     a0d:	ba 14 0a 00 00       	mov    $0xa14,%edx
+     a12:	0f 34                	sysenter
+     a14:	c3                   	ret
+
+00000a15 <msleep>:
+SYSCALL(msleep)
+     a15:	b8 29 00 00 00       	mov    $0x29,%eax
+     a1a:	89 e1                	mov    %esp,%ecx
+     a1c:	ba 23 0a 00 00       	mov    $0xa23,%edx
+     a21:	0f 34                	sysenter
+     a23:	c3                   	ret
+
+00000a24 <lockstat>:
+SYSCALL(lockstat)
+     a24:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     a29:	89 e1                	mov    %esp,%ecx
+     a2b:	ba 32 0a 00 00       	mov    $0xa32,%edx
+     a30:	0f 34                	sysenter
+     a32:	c3                   	ret
+
+00000a33 <bstat>:
+SYSCALL(bstat)
+     a33:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     a38:	89 e1                	mov    %esp,%ecx
+     a3a:	ba 41 0a 00 00       	mov    $0xa41,%edx
+     a3f:	0f 34                	sysenter
+     a41:	c3                   	ret
+
+00000a42 <iostat>:
+SYSCALL(iostat)
+     a42:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     a47:	89 e1                	mov    %esp,%ecx
+     a49:	ba 50 0a 00 00       	mov    $0xa50,%edx
+     a4e:	0f 34                	sysenter
+     a50:	c3                   	ret
+
+00000a51 <fsync>:
+SYSCALL(fsync)
+     a51:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     a56:	89 e1                	mov    %esp,%ecx
+     a58:	ba 5f 0a 00 00       	mov    $0xa5f,%edx
+     a5d:	0f 34                	sysenter
+     a5f:	c3                   	ret
+
+00000a60 <pread>:
+SYSCALL(pread)
+     a60:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     a65:	89 e1                	mov    %esp,%ecx
+     a67:	ba 6e 0a 00 00       	mov    $0xa6e,%edx
+     a6c:	0f 34                	sysenter
+     a6e:	c3                   	ret
+
+00000a6f <pwrite>:
+SYSCALL(pwrite)
+     a6f:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     a74:	89 e1                	mov    %esp,%ecx
+     a76:	ba 7d 0a 00 00       	mov    $0xa7d,%edx
+     a7b:	0f 34                	sysenter
+     a7d:	c3                   	ret
+
+00000a7e <readv>:
+SYSCALL(readv)
+     a7e:	b8 30 00 00 00       	mov    $0x30,%eax
+     a83:	89 e1                	mov    %esp,%ecx
+     a85:	ba 8c 0a 00 00       	mov    $0xa8c,%edx
+     a8a:	0f 34                	sysenter
+     a8c:	c3                   	ret
+
+00000a8d <writev>:
+SYSCALL(writev)
+     a8d:	b8 31 00 00 00       	mov    $0x31,%eax
+     a92:	89 e1                	mov    %esp,%ecx
+     a94:	ba 9b 0a 00 00       	mov    $0xa9b,%edx
+     a99:	0f 34                	sysenter
+     a9b:	c3                   	ret
+
+00000a9c <sendfile>:
+SYSCALL(sendfile)
+     a9c:	b8 32 00 00 00       	mov    $0x32,%eax
+     aa1:	89 e1                	mov    %esp,%ecx
+     aa3:	ba aa 0a 00 00       	mov    $0xaaa,%edx
+     aa8:	0f 34                	sysenter
+     aaa:	c3                   	ret
+
+00000aab <fcntl>:
+SYSCALL(fcntl)
+     aab:	b8 33 00 00 00       	mov    $0x33,%eax
+     ab0:	89 e1                	mov    %esp,%ecx
+     ab2:	ba b9 0a 00 00       	mov    $0xab9,%edx
+     ab7:	0f 34                	sysenter
+     ab9:	c3                   	ret
+
+00000aba <mount>:
+SYSCALL(mount)
+     aba:	b8 34 00 00 00       	mov    $0x34,%eax
+     abf:	89 e1                	mov    %esp,%ecx
+     ac1:	ba c8 0a 00 00       	mov    $0xac8,%edx
+     ac6:	0f 34                	sysenter
+     ac8:	c3                   	ret
+
+00000ac9 <getdents>:
+SYSCALL(getdents)
+     ac9:	b8 35 00 00 00       	mov    $0x35,%eax
+     ace:	89 e1                	mov    %esp,%ecx
+     ad0:	ba d7 0a 00 00       	mov    $0xad7,%edx
+     ad5:	0f 34                	sysenter
+     ad7:	c3                   	ret
+
+00000ad8 <fstatat>:
+SYSCALL(fstatat)
+     ad8:	b8 36 00 00 00       	mov    $0x36,%eax
+     add:	89 e1                	mov    %esp,%ecx
+     adf:	ba e6 0a 00 00       	mov    $0xae6,%edx
+     ae4:	0f 34                	sysenter
+     ae6:	c3                   	ret
+
+00000ae7 <sysstat>:
+SYSCALL(sysstat)
+     ae7:	b8 37 00 00 00       	mov    $0x37,%eax
+     aec:	89 e1                	mov    %esp,%ecx
+     aee:	ba f5 0a 00 00       	mov    $0xaf5,%edx
+     af3:	0f 34                	sysenter
+     af5:	c3                   	ret
+
+00000af6 <ringenter>:
+SYSCALL(ringenter)
+     af6:	b8 38 00 00 00       	mov    $0x38,%eax
+     afb:	89 e1                	mov    %esp,%ecx
+     afd:	ba 04 0b 00 00       	mov    $0xb04,%edx
+     b02:	0f 34                	sysenter
+     b04:	c3                   	ret
+
+00000b05 <trace>:
+SYSCALL(trace)
+     b05:	b8 39 00 00 00       	mov    $0x39,%eax
+     b0a:	89 e1                	mov    %esp,%ecx
+     b0c:	ba 13 0b 00 00       	mov    $0xb13,%edx
+     b11:	0f 34                	sysenter
+     b13:	c3                   	ret
+
+00000b14 <memstat>:
+SYSCALL(memstat)
+     b14:	b8 3a 00 00 00       	mov    $0x3a,%eax
+     b19:	89 e1                	mov    %esp,%ecx
+     b1b:	ba 22 0b 00 00       	mov    $0xb22,%edx
+     b20:	0f 34                	sysenter
+     b22:	c3                   	ret
+
+00000b23 <shmget>:
+SYSCALL(shmget)
+     b23:	b8 3b 00 00 00       	mov    $0x3b,%eax
+     b28:	89 e1                	mov    %esp,%ecx
+     b2a:	ba 31 0b 00 00       	mov    $0xb31,%edx
+     b2f:	0f 34                	sysenter
+     b31:	c3                   	ret
+
+00000b32 <shmat>:
+SYSCALL(shmat)
+     b32:	b8 3c 00 00 00       	mov    $0x3c,%eax
+     b37:	89 e1                	mov    %esp,%ecx
+     b39:	ba 40 0b 00 00       	mov    $0xb40,%edx
+     b3e:	0f 34                	sysenter
+     b40:	c3                   	ret
+
+00000b41 <shmdt>:
+SYSCALL(shmdt)
+     b41:	b8 3d 00 00 00       	mov    $0x3d,%eax
+     b46:	89 e1                	mov    %esp,%ecx
+     b48:	ba 4f 0b 00 00       	mov    $0xb4f,%edx
+     b4d:	0f 34                	sysenter
+     b4f:	c3                   	ret
+
+00000b50 <irqstat>:
+SYSCALL(irqstat)
+     b50:	b8 3e 00 00 00       	mov    $0x3e,%eax
+     b55:	89 e1                	mov    %esp,%ecx
+     b57:	ba 5e 0b 00 00       	mov    $0xb5e,%edx
+     b5c:	0f 34                	sysenter
+     b5e:	c3                   	ret
+
+00000b5f <irqroute>:
+SYSCALL(irqroute)
+     b5f:	b8 3f 00 00 00       	mov    $0x3f,%eax
+     b64:	89 e1                	mov    %esp,%ecx
+     b66:	ba 6d 0b 00 00       	mov    $0xb6d,%edx
+     b6b:	0f 34                	sysenter
+     b6d:	c3                   	ret
+
+00000b6e <putc>:
+  char buf[64];
+};
+
+static void
+putc(struct out *o, char c)
+{
+     b6e:	55                   	push   %ebp
+     b6f:	89 e5                	mov    %esp,%ebp
+     b71:	56                   	push   %esi
+     b72:	53                   	push   %ebx
+     b73:	89 c3                	mov    %eax,%ebx
+     b75:	89 d6                	mov    %edx,%esi
+  if(o->n == sizeof(o->buf)){
+     b77:	8b 40 04             	mov    0x4(%eax),%eax
+     b7a:	83 f8 40             	cmp    $0x40,%eax
+     b7d:	74 16                	je     b95 <putc+0x27>
+    bufwrite(o->fd, o->buf, o->n);
+    o->n = 0;
+  }
+  o->buf[o->n++] = c;
+     b7f:	8b 43 04             	mov    0x4(%ebx),%eax
+     b82:	8d 50 01             	lea    0x1(%eax),%edx
+     b85:	89 53 04             	mov    %edx,0x4(%ebx)
+     b88:	89 f1                	mov    %esi,%ecx
+     b8a:	88 4c 03 08          	mov    %cl,0x8(%ebx,%eax,1)
+}
+     b8e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b91:	5b                   	pop    %ebx
+     b92:	5e                   	pop    %esi
+     b93:	5d                   	pop    %ebp
+     b94:	c3                   	ret
+    bufwrite(o->fd, o->buf, o->n);
+     b95:	8d 53 08             	lea    0x8(%ebx),%edx
+     b98:	83 ec 04             	sub    $0x4,%esp
+     b9b:	50                   	push   %eax
+     b9c:	52                   	push   %edx
+     b9d:	ff 33                	push   (%ebx)
+     b9f:	e8 b2 f9 ff ff       	call   556 <bufwrite>
+    o->n = 0;
+     ba4:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     bab:	83 c4 10             	add    $0x10,%esp
+     bae:	eb cf                	jmp    b7f <putc+0x11>
+
+00000bb0 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     bb0:	55                   	push   %ebp
+     bb1:	89 e5                	mov    %esp,%ebp
+     bb3:	57                   	push   %edi
+     bb4:	56                   	push   %esi
+     bb5:	53                   	push   %ebx
+     bb6:	83 ec 2c             	sub    $0x2c,%esp
+     bb9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     bbc:	89 d0                	mov    %edx,%eax
+     bbe:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+     bc0:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     bc4:	0f 95 c1             	setne  %cl
+     bc7:	c1 ea 1f             	shr    $0x1f,%edx
+     bca:	84 d1                	test   %dl,%cl
+     bcc:	74 44                	je     c12 <printint+0x62>
+    neg = 1;
+    x = -xx;
+     bce:	f7 d8                	neg    %eax
+     bd0:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+     bd2:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     bd9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+     bde:	89 c8                	mov    %ecx,%eax
+     be0:	ba 00 00 00 00       	mov    $0x0,%edx
+     be5:	f7 f6                	div    %esi
+     be7:	89 df                	mov    %ebx,%edi
+     be9:	83 c3 01             	add    $0x1,%ebx
+     bec:	0f b6 92 e8 12 00 00 	movzbl 0x12e8(%edx),%edx
+     bf3:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+     bf7:	89 ca                	mov    %ecx,%edx
+     bf9:	89 c1                	mov    %eax,%ecx
+     bfb:	39 f2                	cmp    %esi,%edx
+     bfd:	73 df                	jae    bde <printint+0x2e>
+  if(neg)
+     bff:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     c03:	74 31                	je     c36 <printint+0x86>
+    buf[i++] = '-';
+     c05:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+     c0a:	8d 5f 02             	lea    0x2(%edi),%ebx
+     c0d:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     c10:	eb 17                	jmp    c29 <printint+0x79>
+    x = xx;
+     c12:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+     c14:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     c1b:	eb bc                	jmp    bd9 <printint+0x29>
+
+  while(--i >= 0)
+    putc(o, buf[i]);
+     c1d:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+     c22:	89 f0                	mov    %esi,%eax
+     c24:	e8 45 ff ff ff       	call   b6e <putc>
+  while(--i >= 0)
+     c29:	83 eb 01             	sub    $0x1,%ebx
+     c2c:	79 ef                	jns    c1d <printint+0x6d>
+}
+     c2e:	83 c4 2c             	add    $0x2c,%esp
+     c31:	5b                   	pop    %ebx
+     c32:	5e                   	pop    %esi
+     c33:	5f                   	pop    %edi
+     c34:	5d                   	pop    %ebp
+     c35:	c3                   	ret
+     c36:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     c39:	eb ee                	jmp    c29 <printint+0x79>
+
+00000c3b <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     c3b:	55                   	push   %ebp
+     c3c:	89 e5                	mov    %esp,%ebp
+     c3e:	57                   	push   %edi
+     c3f:	56                   	push   %esi
+     c40:	53                   	push   %ebx
+     c41:	83 ec 6c             	sub    $0x6c,%esp
+  int c, i, state;
+  uint *ap;
+  struct out out, *o;
+
+  o = &out;
+  o->fd = fd;
+     c44:	8b 45 08             	mov    0x8(%ebp),%eax
+     c47:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  o->n = 0;
+     c4a:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+     c51:	8d 45 10             	lea    0x10(%ebp),%eax
+     c54:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  state = 0;
+     c57:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+     c5c:	bb 00 00 00 00       	mov    $0x0,%ebx
+     c61:	eb 14                	jmp    c77 <printf+0x3c>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(o, c);
+     c63:	89 fa                	mov    %edi,%edx
+     c65:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     c68:	e8 01 ff ff ff       	call   b6e <putc>
+     c6d:	eb 05                	jmp    c74 <printf+0x39>
+      }
+    } else if(state == '%'){
+     c6f:	83 fe 25             	cmp    $0x25,%esi
+     c72:	74 25                	je     c99 <printf+0x5e>
+  for(i = 0; fmt[i]; i++){
+     c74:	83 c3 01             	add    $0x1,%ebx
+     c77:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c7a:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+     c7e:	84 c0                	test   %al,%al
+     c80:	0f 84 20 01 00 00    	je     da6 <printf+0x16b>
+    c = fmt[i] & 0xff;
+     c86:	0f be f8             	movsbl %al,%edi
+     c89:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     c8c:	85 f6                	test   %esi,%esi
+     c8e:	75 df                	jne    c6f <printf+0x34>
+      if(c == '%'){
+     c90:	83 f8 25             	cmp    $0x25,%eax
+     c93:	75 ce                	jne    c63 <printf+0x28>
+        state = '%';
+     c95:	89 c6                	mov    %eax,%esi
+     c97:	eb db                	jmp    c74 <printf+0x39>
+      if(c == 'd'){
+     c99:	83 f8 25             	cmp    $0x25,%eax
+     c9c:	0f 84 cf 00 00 00    	je     d71 <printf+0x136>
+     ca2:	0f 8c dd 00 00 00    	jl     d85 <printf+0x14a>
+     ca8:	83 f8 78             	cmp    $0x78,%eax
+     cab:	0f 8f d4 00 00 00    	jg     d85 <printf+0x14a>
+     cb1:	83 f8 63             	cmp    $0x63,%eax
+     cb4:	0f 8c cb 00 00 00    	jl     d85 <printf+0x14a>
+     cba:	83 e8 63             	sub    $0x63,%eax
+     cbd:	83 f8 15             	cmp    $0x15,%eax
+     cc0:	0f 87 bf 00 00 00    	ja     d85 <printf+0x14a>
+     cc6:	ff 24 85 90 12 00 00 	jmp    *0x1290(,%eax,4)
+        printint(o, *ap, 10, 1);
+     ccd:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     cd0:	8b 17                	mov    (%edi),%edx
+     cd2:	83 ec 0c             	sub    $0xc,%esp
+     cd5:	6a 01                	push   $0x1
+     cd7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     cdc:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     cdf:	e8 cc fe ff ff       	call   bb0 <printint>
+        ap++;
+     ce4:	83 c7 04             	add    $0x4,%edi
+     ce7:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     cea:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(o, '%');
+        putc(o, c);
+      }
+      state = 0;
+     ced:	be 00 00 00 00       	mov    $0x0,%esi
+     cf2:	eb 80                	jmp    c74 <printf+0x39>
+        printint(o, *ap, 16, 0);
+     cf4:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     cf7:	8b 17                	mov    (%edi),%edx
+     cf9:	83 ec 0c             	sub    $0xc,%esp
+     cfc:	6a 00                	push   $0x0
+     cfe:	b9 10 00 00 00       	mov    $0x10,%ecx
+     d03:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d06:	e8 a5 fe ff ff       	call   bb0 <printint>
+        ap++;
+     d0b:	83 c7 04             	add    $0x4,%edi
+     d0e:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     d11:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d14:	be 00 00 00 00       	mov    $0x0,%esi
+     d19:	e9 56 ff ff ff       	jmp    c74 <printf+0x39>
+        s = (char*)*ap;
+     d1e:	8b 45 94             	mov    -0x6c(%ebp),%eax
+     d21:	8b 30                	mov    (%eax),%esi
+        ap++;
+     d23:	83 c0 04             	add    $0x4,%eax
+     d26:	89 45 94             	mov    %eax,-0x6c(%ebp)
+        if(s == 0)
+     d29:	85 f6                	test   %esi,%esi
+     d2b:	75 15                	jne    d42 <printf+0x107>
+          s = "(null)";
+     d2d:	be 87 12 00 00       	mov    $0x1287,%esi
+     d32:	eb 0e                	jmp    d42 <printf+0x107>
+          putc(o, *s);
+     d34:	0f be d2             	movsbl %dl,%edx
+     d37:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d3a:	e8 2f fe ff ff       	call   b6e <putc>
+          s++;
+     d3f:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+     d42:	0f b6 16             	movzbl (%esi),%edx
+     d45:	84 d2                	test   %dl,%dl
+     d47:	75 eb                	jne    d34 <printf+0xf9>
+      state = 0;
+     d49:	be 00 00 00 00       	mov    $0x0,%esi
+     d4e:	e9 21 ff ff ff       	jmp    c74 <printf+0x39>
+        putc(o, *ap);
+     d53:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     d56:	0f be 17             	movsbl (%edi),%edx
+     d59:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d5c:	e8 0d fe ff ff       	call   b6e <putc>
+        ap++;
+     d61:	83 c7 04             	add    $0x4,%edi
+     d64:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+      state = 0;
+     d67:	be 00 00 00 00       	mov    $0x0,%esi
+     d6c:	e9 03 ff ff ff       	jmp    c74 <printf+0x39>
+        putc(o, c);
+     d71:	89 fa                	mov    %edi,%edx
+     d73:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d76:	e8 f3 fd ff ff       	call   b6e <putc>
+      state = 0;
+     d7b:	be 00 00 00 00       	mov    $0x0,%esi
+     d80:	e9 ef fe ff ff       	jmp    c74 <printf+0x39>
+        putc(o, '%');
+     d85:	ba 25 00 00 00       	mov    $0x25,%edx
+     d8a:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d8d:	e8 dc fd ff ff       	call   b6e <putc>
+        putc(o, c);
+     d92:	89 fa                	mov    %edi,%edx
+     d94:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d97:	e8 d2 fd ff ff       	call   b6e <putc>
+      state = 0;
+     d9c:	be 00 00 00 00       	mov    $0x0,%esi
+     da1:	e9 ce fe ff ff       	jmp    c74 <printf+0x39>
+    }
+  }
+  if(o->n > 0)
+     da6:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     da9:	85 c0                	test   %eax,%eax
+     dab:	7f 08                	jg     db5 <printf+0x17a>
+    bufwrite(fd, o->buf, o->n);
+}
+     dad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     db0:	5b                   	pop    %ebx
+     db1:	5e                   	pop    %esi
+     db2:	5f                   	pop    %edi
+     db3:	5d                   	pop    %ebp
+     db4:	c3                   	ret
+    bufwrite(fd, o->buf, o->n);
+     db5:	83 ec 04             	sub    $0x4,%esp
+     db8:	50                   	push   %eax
+     db9:	8d 45 a8             	lea    -0x58(%ebp),%eax
+     dbc:	50                   	push   %eax
+     dbd:	ff 75 08             	push   0x8(%ebp)
+     dc0:	e8 91 f7 ff ff       	call   556 <bufwrite>
+     dc5:	83 c4 10             	add    $0x10,%esp
+}
+     dc8:	eb e3                	jmp    dad <printf+0x172>
+
+00000dca <largefree>:
+  return &b->h;
+}
+
+static void
+largefree(Fblock *b)
+{
+     dca:	55                   	push   %ebp
+     dcb:	89 e5                	mov    %esp,%ebp
+     dcd:	57                   	push   %edi
+     dce:	56                   	push   %esi
+     dcf:	53                   	push   %ebx
+     dd0:	83 ec 0c             	sub    $0xc,%esp
+     dd3:	89 c1                	mov    %eax,%ecx
+  Fblock **pp, *p, *prev;
+
+  prev = 0;
+     dd5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     dda:	ba 6c 3a 00 00       	mov    $0x3a6c,%edx
+     ddf:	eb 05                	jmp    de6 <largefree+0x1c>
+     de1:	8d 50 08             	lea    0x8(%eax),%edx
+    prev = p;
+     de4:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     de6:	8b 02                	mov    (%edx),%eax
+     de8:	85 c0                	test   %eax,%eax
+     dea:	74 04                	je     df0 <largefree+0x26>
+     dec:	39 c8                	cmp    %ecx,%eax
+     dee:	72 f1                	jb     de1 <largefree+0x17>
+  b->next = p;
+     df0:	89 41 08             	mov    %eax,0x8(%ecx)
+  if(p && (char*)b + b->h.size == (char*)p){
+     df3:	85 c0                	test   %eax,%eax
+     df5:	74 09                	je     e00 <largefree+0x36>
+     df7:	8b 31                	mov    (%ecx),%esi
+     df9:	8d 3c 31             	lea    (%ecx,%esi,1),%edi
+     dfc:	39 c7                	cmp    %eax,%edi
+     dfe:	74 21                	je     e21 <largefree+0x57>
+    b->h.size += p->h.size;
+    b->next = p->next;
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+     e00:	85 db                	test   %ebx,%ebx
+     e02:	74 09                	je     e0d <largefree+0x43>
+     e04:	8b 03                	mov    (%ebx),%eax
+     e06:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+     e09:	39 ce                	cmp    %ecx,%esi
+     e0b:	74 20                	je     e2d <largefree+0x63>
+    prev->h.size += b->h.size;
+    prev->next = b->next;
+  } else
+    *pp = b;
+     e0d:	89 0a                	mov    %ecx,(%edx)
+
+  // Give the top of the heap back.  With threads sharing the
+  // address space sbrk() cannot shrink it; keep the block then.
+  for(pp = &large; (*pp)->next; pp = &(*pp)->next)
+     e0f:	be 6c 3a 00 00       	mov    $0x3a6c,%esi
+     e14:	8b 1e                	mov    (%esi),%ebx
+     e16:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+     e1a:	74 1d                	je     e39 <largefree+0x6f>
+     e1c:	8d 73 08             	lea    0x8(%ebx),%esi
+     e1f:	eb f3                	jmp    e14 <largefree+0x4a>
+    b->h.size += p->h.size;
+     e21:	03 30                	add    (%eax),%esi
+     e23:	89 31                	mov    %esi,(%ecx)
+    b->next = p->next;
+     e25:	8b 40 08             	mov    0x8(%eax),%eax
+     e28:	89 41 08             	mov    %eax,0x8(%ecx)
+     e2b:	eb d3                	jmp    e00 <largefree+0x36>
+    prev->h.size += b->h.size;
+     e2d:	03 01                	add    (%ecx),%eax
+     e2f:	89 03                	mov    %eax,(%ebx)
+    prev->next = b->next;
+     e31:	8b 41 08             	mov    0x8(%ecx),%eax
+     e34:	89 43 08             	mov    %eax,0x8(%ebx)
+     e37:	eb d6                	jmp    e0f <largefree+0x45>
+    ;
+  b = *pp;
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     e39:	89 df                	mov    %ebx,%edi
+     e3b:	03 3b                	add    (%ebx),%edi
+     e3d:	83 ec 0c             	sub    $0xc,%esp
+     e40:	6a 00                	push   $0x0
+     e42:	e8 93 fa ff ff       	call   8da <sbrk>
+     e47:	83 c4 10             	add    $0x10,%esp
+     e4a:	39 c7                	cmp    %eax,%edi
+     e4c:	74 08                	je     e56 <largefree+0x8c>
+    *pp = 0;
+}
+     e4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e51:	5b                   	pop    %ebx
+     e52:	5e                   	pop    %esi
+     e53:	5f                   	pop    %edi
+     e54:	5d                   	pop    %ebp
+     e55:	c3                   	ret
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     e56:	8b 03                	mov    (%ebx),%eax
+     e58:	f7 d8                	neg    %eax
+     e5a:	83 ec 0c             	sub    $0xc,%esp
+     e5d:	50                   	push   %eax
+     e5e:	e8 77 fa ff ff       	call   8da <sbrk>
+     e63:	83 c4 10             	add    $0x10,%esp
+     e66:	83 f8 ff             	cmp    $0xffffffff,%eax
+     e69:	74 e3                	je     e4e <largefree+0x84>
+    *pp = 0;
+     e6b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+     e71:	eb db                	jmp    e4e <largefree+0x84>
+
+00000e73 <more>:
+{
+     e73:	55                   	push   %ebp
+     e74:	89 e5                	mov    %esp,%ebp
+     e76:	56                   	push   %esi
+     e77:	53                   	push   %ebx
+     e78:	89 c6                	mov    %eax,%esi
+  pad = -(uint)sbrk(0) & 7;
+     e7a:	83 ec 0c             	sub    $0xc,%esp
+     e7d:	6a 00                	push   $0x0
+     e7f:	e8 56 fa ff ff       	call   8da <sbrk>
+     e84:	f7 d8                	neg    %eax
+     e86:	89 c3                	mov    %eax,%ebx
+     e88:	83 e3 07             	and    $0x7,%ebx
+  if((p = sbrk(n + pad)) == (char*)-1)
+     e8b:	01 de                	add    %ebx,%esi
+     e8d:	89 34 24             	mov    %esi,(%esp)
+     e90:	e8 45 fa ff ff       	call   8da <sbrk>
+     e95:	83 c4 10             	add    $0x10,%esp
+     e98:	83 f8 ff             	cmp    $0xffffffff,%eax
+     e9b:	74 09                	je     ea6 <more+0x33>
+  return p + pad;
+     e9d:	01 d8                	add    %ebx,%eax
+}
+     e9f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ea2:	5b                   	pop    %ebx
+     ea3:	5e                   	pop    %esi
+     ea4:	5d                   	pop    %ebp
+     ea5:	c3                   	ret
+    return 0;
+     ea6:	b8 00 00 00 00       	mov    $0x0,%eax
+     eab:	eb f2                	jmp    e9f <more+0x2c>
+
+00000ead <slaballoc>:
+{
+     ead:	55                   	push   %ebp
+     eae:	89 e5                	mov    %esp,%ebp
+     eb0:	56                   	push   %esi
+     eb1:	53                   	push   %ebx
+     eb2:	89 c6                	mov    %eax,%esi
+  n = 1 << (MINSHIFT + c);
+     eb4:	8d 48 04             	lea    0x4(%eax),%ecx
+     eb7:	bb 01 00 00 00       	mov    $0x1,%ebx
+     ebc:	d3 e3                	shl    %cl,%ebx
+  if(slab + n > slabend){
+     ebe:	89 d8                	mov    %ebx,%eax
+     ec0:	03 05 68 3a 00 00    	add    0x3a68,%eax
+     ec6:	39 05 64 3a 00 00    	cmp    %eax,0x3a64
+     ecc:	72 17                	jb     ee5 <slaballoc+0x38>
+  h = (Header*)slab;
+     ece:	a1 68 3a 00 00       	mov    0x3a68,%eax
+  slab += n;
+     ed3:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+     ed6:	89 15 68 3a 00 00    	mov    %edx,0x3a68
+  h->size = n;
+     edc:	89 18                	mov    %ebx,(%eax)
+  h->class = c;
+     ede:	89 70 04             	mov    %esi,0x4(%eax)
+}
+     ee1:	5b                   	pop    %ebx
+     ee2:	5e                   	pop    %esi
+     ee3:	5d                   	pop    %ebp
+     ee4:	c3                   	ret
+    if((p = more(SLABSZ)) == 0)
+     ee5:	b8 00 40 00 00       	mov    $0x4000,%eax
+     eea:	e8 84 ff ff ff       	call   e73 <more>
+     eef:	85 c0                	test   %eax,%eax
+     ef1:	74 ee                	je     ee1 <slaballoc+0x34>
+    if(p != slabend)
+     ef3:	39 05 64 3a 00 00    	cmp    %eax,0x3a64
+     ef9:	74 05                	je     f00 <slaballoc+0x53>
+      slab = p;
+     efb:	a3 68 3a 00 00       	mov    %eax,0x3a68
+    slabend = p + SLABSZ;
+     f00:	05 00 40 00 00       	add    $0x4000,%eax
+     f05:	a3 64 3a 00 00       	mov    %eax,0x3a64
+     f0a:	eb c2                	jmp    ece <slaballoc+0x21>
+
+00000f0c <largealloc>:
+{
+     f0c:	55                   	push   %ebp
+     f0d:	89 e5                	mov    %esp,%ebp
+     f0f:	56                   	push   %esi
+     f10:	53                   	push   %ebx
+     f11:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     f13:	b9 6c 3a 00 00       	mov    $0x3a6c,%ecx
+     f18:	8b 01                	mov    (%ecx),%eax
+     f1a:	85 c0                	test   %eax,%eax
+     f1c:	74 36                	je     f54 <largealloc+0x48>
+    if(b->h.size < n)
+     f1e:	8b 10                	mov    (%eax),%edx
+     f20:	39 da                	cmp    %ebx,%edx
+     f22:	72 24                	jb     f48 <largealloc+0x3c>
+    if(b->h.size - n > SMALLMAX){
+     f24:	29 da                	sub    %ebx,%edx
+     f26:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+     f2c:	76 1f                	jbe    f4d <largealloc+0x41>
+      rest = (Fblock*)((char*)b + n);
+     f2e:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+      rest->h.size = b->h.size - n;
+     f31:	89 16                	mov    %edx,(%esi)
+      rest->h.class = LARGE;
+     f33:	c7 46 04 09 00 00 00 	movl   $0x9,0x4(%esi)
+      rest->next = b->next;
+     f3a:	8b 50 08             	mov    0x8(%eax),%edx
+     f3d:	89 56 08             	mov    %edx,0x8(%esi)
+      *pp = rest;
+     f40:	89 31                	mov    %esi,(%ecx)
+      b->h.size = n;
+     f42:	89 18                	mov    %ebx,(%eax)
+}
+     f44:	5b                   	pop    %ebx
+     f45:	5e                   	pop    %esi
+     f46:	5d                   	pop    %ebp
+     f47:	c3                   	ret
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     f48:	8d 48 08             	lea    0x8(%eax),%ecx
+     f4b:	eb cb                	jmp    f18 <largealloc+0xc>
+      *pp = b->next;
+     f4d:	8b 50 08             	mov    0x8(%eax),%edx
+     f50:	89 11                	mov    %edx,(%ecx)
+    return &b->h;
+     f52:	eb f0                	jmp    f44 <largealloc+0x38>
+  if((b = more(n)) == 0)
+     f54:	89 d8                	mov    %ebx,%eax
+     f56:	e8 18 ff ff ff       	call   e73 <more>
+     f5b:	85 c0                	test   %eax,%eax
+     f5d:	74 e5                	je     f44 <largealloc+0x38>
+  b->h.size = n;
+     f5f:	89 18                	mov    %ebx,(%eax)
+  b->h.class = LARGE;
+     f61:	c7 40 04 09 00 00 00 	movl   $0x9,0x4(%eax)
+  return &b->h;
+     f68:	eb da                	jmp    f44 <largealloc+0x38>
+
+00000f6a <free>:
+
+void
+free(void *ap)
+{
+     f6a:	55                   	push   %ebp
+     f6b:	89 e5                	mov    %esp,%ebp
+     f6d:	56                   	push   %esi
+     f6e:	53                   	push   %ebx
+     f6f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+
+  if(ap == 0)
+     f72:	85 db                	test   %ebx,%ebx
+     f74:	74 3b                	je     fb1 <free+0x47>
+    return;
+  h = (Header*)ap - 1;
+     f76:	8d 73 f8             	lea    -0x8(%ebx),%esi
+  lock_acquire(&lock);
+     f79:	83 ec 0c             	sub    $0xc,%esp
+     f7c:	68 60 3a 00 00       	push   $0x3a60
+     f81:	e8 9c 01 00 00       	call   1122 <lock_acquire>
+  if(h->class == LARGE)
+     f86:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     f89:	83 c4 10             	add    $0x10,%esp
+     f8c:	83 f8 09             	cmp    $0x9,%eax
+     f8f:	74 27                	je     fb8 <free+0x4e>
+    largefree((Fblock*)h);
+  else {
+    ((Fblock*)h)->next = freelist[h->class];
+     f91:	8b 14 85 80 3a 00 00 	mov    0x3a80(,%eax,4),%edx
+     f98:	89 13                	mov    %edx,(%ebx)
+    freelist[h->class] = (Fblock*)h;
+     f9a:	89 34 85 80 3a 00 00 	mov    %esi,0x3a80(,%eax,4)
+  }
+  lock_release(&lock);
+     fa1:	83 ec 0c             	sub    $0xc,%esp
+     fa4:	68 60 3a 00 00       	push   $0x3a60
+     fa9:	e8 88 01 00 00       	call   1136 <lock_release>
+     fae:	83 c4 10             	add    $0x10,%esp
+}
+     fb1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     fb4:	5b                   	pop    %ebx
+     fb5:	5e                   	pop    %esi
+     fb6:	5d                   	pop    %ebp
+     fb7:	c3                   	ret
+    largefree((Fblock*)h);
+     fb8:	89 f0                	mov    %esi,%eax
+     fba:	e8 0b fe ff ff       	call   dca <largefree>
+     fbf:	eb e0                	jmp    fa1 <free+0x37>
+
+00000fc1 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     fc1:	55                   	push   %ebp
+     fc2:	89 e5                	mov    %esp,%ebp
+     fc4:	53                   	push   %ebx
+     fc5:	83 ec 04             	sub    $0x4,%esp
+     fc8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+  uint n;
+  int c;
+
+  if(nbytes > 0x7fffffff - sizeof(Header) - 7)
+     fcb:	81 fb f0 ff ff 7f    	cmp    $0x7ffffff0,%ebx
+     fd1:	0f 87 8b 00 00 00    	ja     1062 <malloc+0xa1>
+    return 0;
+  n = (nbytes + sizeof(Header) + 7) & ~7;
+     fd7:	83 c3 0f             	add    $0xf,%ebx
+     fda:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(n < sizeof(Fblock))
+     fdd:	83 fb 0b             	cmp    $0xb,%ebx
+     fe0:	77 05                	ja     fe7 <malloc+0x26>
+    n = sizeof(Fblock);
+     fe2:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  lock_acquire(&lock);
+     fe7:	83 ec 0c             	sub    $0xc,%esp
+     fea:	68 60 3a 00 00       	push   $0x3a60
+     fef:	e8 2e 01 00 00       	call   1122 <lock_acquire>
+  if(n <= SMALLMAX){
+     ff4:	83 c4 10             	add    $0x10,%esp
+     ff7:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+     ffd:	77 58                	ja     1057 <malloc+0x96>
+    for(c = 0; (1 << (MINSHIFT + c)) < n; c++)
+     fff:	ba 00 00 00 00       	mov    $0x0,%edx
+    1004:	eb 03                	jmp    1009 <malloc+0x48>
+    1006:	83 c2 01             	add    $0x1,%edx
+    1009:	8d 4a 04             	lea    0x4(%edx),%ecx
+    100c:	b8 01 00 00 00       	mov    $0x1,%eax
+    1011:	d3 e0                	shl    %cl,%eax
+    1013:	39 d8                	cmp    %ebx,%eax
+    1015:	72 ef                	jb     1006 <malloc+0x45>
+      ;
+    if(freelist[c]){
+    1017:	8b 04 95 80 3a 00 00 	mov    0x3a80(,%edx,4),%eax
+    101e:	85 c0                	test   %eax,%eax
+    1020:	74 2a                	je     104c <malloc+0x8b>
+      h = &freelist[c]->h;
+    1022:	89 c3                	mov    %eax,%ebx
+      freelist[c] = freelist[c]->next;
+    1024:	8b 40 08             	mov    0x8(%eax),%eax
+    1027:	89 04 95 80 3a 00 00 	mov    %eax,0x3a80(,%edx,4)
+    } else
+      h = slaballoc(c);
+  } else
+    h = largealloc(n);
+  lock_release(&lock);
+    102e:	83 ec 0c             	sub    $0xc,%esp
+    1031:	68 60 3a 00 00       	push   $0x3a60
+    1036:	e8 fb 00 00 00       	call   1136 <lock_release>
+  return h ? (void*)(h + 1) : 0;
+    103b:	83 c4 10             	add    $0x10,%esp
+    103e:	85 db                	test   %ebx,%ebx
+    1040:	74 03                	je     1045 <malloc+0x84>
+    1042:	83 c3 08             	add    $0x8,%ebx
+}
+    1045:	89 d8                	mov    %ebx,%eax
+    1047:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    104a:	c9                   	leave
+    104b:	c3                   	ret
+      h = slaballoc(c);
+    104c:	89 d0                	mov    %edx,%eax
+    104e:	e8 5a fe ff ff       	call   ead <slaballoc>
+    1053:	89 c3                	mov    %eax,%ebx
+    1055:	eb d7                	jmp    102e <malloc+0x6d>
+    h = largealloc(n);
+    1057:	89 d8                	mov    %ebx,%eax
+    1059:	e8 ae fe ff ff       	call   f0c <largealloc>
+    105e:	89 c3                	mov    %eax,%ebx
+    1060:	eb cc                	jmp    102e <malloc+0x6d>
+    return 0;
+    1062:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1067:	eb dc                	jmp    1045 <malloc+0x84>
+
+00001069 <tstart>:
+  void *arg;
+};
+
+static void
+tstart(void *a)
+{
+    1069:	55                   	push   %ebp
+    106a:	89 e5                	mov    %esp,%ebp
+    106c:	83 ec 14             	sub    $0x14,%esp
+    106f:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+    1072:	ff 70 04             	push   0x4(%eax)
+    1075:	ff 10                	call   *(%eax)
+  exit();
+    1077:	e8 86 f6 ff ff       	call   702 <exit>
+
+0000107c <thread_create>:
+}
+
+// Run fn(arg) in a new thread.  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    107c:	55                   	push   %ebp
+    107d:	89 e5                	mov    %esp,%ebp
+    107f:	56                   	push   %esi
+    1080:	53                   	push   %ebx
+  struct tstart *t;
+  char *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    1081:	83 ec 0c             	sub    $0xc,%esp
+    1084:	68 00 10 00 00       	push   $0x1000
+    1089:	e8 33 ff ff ff       	call   fc1 <malloc>
+    108e:	83 c4 10             	add    $0x10,%esp
+    1091:	85 c0                	test   %eax,%eax
+    1093:	74 42                	je     10d7 <thread_create+0x5b>
+    1095:	89 c3                	mov    %eax,%ebx
+    return -1;
+  t = (struct tstart*)stack;
+  t->fn = fn;
+    1097:	8b 45 08             	mov    0x8(%ebp),%eax
+    109a:	89 03                	mov    %eax,(%ebx)
+  t->arg = arg;
+    109c:	8b 45 0c             	mov    0xc(%ebp),%eax
+    109f:	89 43 04             	mov    %eax,0x4(%ebx)
+  if((pid = clone(tstart, stack + TSTACK, t)) < 0)
+    10a2:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    10a8:	83 ec 04             	sub    $0x4,%esp
+    10ab:	53                   	push   %ebx
+    10ac:	50                   	push   %eax
+    10ad:	68 69 10 00 00       	push   $0x1069
+    10b2:	e8 f5 f8 ff ff       	call   9ac <clone>
+    10b7:	89 c6                	mov    %eax,%esi
+    10b9:	83 c4 10             	add    $0x10,%esp
+    10bc:	85 c0                	test   %eax,%eax
+    10be:	78 09                	js     10c9 <thread_create+0x4d>
+    free(stack);
+  return pid;
+}
+    10c0:	89 f0                	mov    %esi,%eax
+    10c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    10c5:	5b                   	pop    %ebx
+    10c6:	5e                   	pop    %esi
+    10c7:	5d                   	pop    %ebp
+    10c8:	c3                   	ret
+    free(stack);
+    10c9:	83 ec 0c             	sub    $0xc,%esp
+    10cc:	53                   	push   %ebx
+    10cd:	e8 98 fe ff ff       	call   f6a <free>
+    10d2:	83 c4 10             	add    $0x10,%esp
+    10d5:	eb e9                	jmp    10c0 <thread_create+0x44>
+    return -1;
+    10d7:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    10dc:	eb e2                	jmp    10c0 <thread_create+0x44>
+
+000010de <thread_join>:
+
+// Wait for one of this process's threads to exit and free its
+// stack.  Returns its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+    10de:	55                   	push   %ebp
+    10df:	89 e5                	mov    %esp,%ebp
+    10e1:	53                   	push   %ebx
+    10e2:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    10e5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    10e8:	50                   	push   %eax
+    10e9:	e8 cd f8 ff ff       	call   9bb <join>
+    10ee:	89 c3                	mov    %eax,%ebx
+    10f0:	83 c4 10             	add    $0x10,%esp
+    10f3:	85 c0                	test   %eax,%eax
+    10f5:	79 07                	jns    10fe <thread_join+0x20>
+    free((char*)stack - TSTACK);
+  return pid;
+}
+    10f7:	89 d8                	mov    %ebx,%eax
+    10f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10fc:	c9                   	leave
+    10fd:	c3                   	ret
+    free((char*)stack - TSTACK);
+    10fe:	83 ec 0c             	sub    $0xc,%esp
+    1101:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1104:	2d 00 10 00 00       	sub    $0x1000,%eax
+    1109:	50                   	push   %eax
+    110a:	e8 5b fe ff ff       	call   f6a <free>
+    110f:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    1112:	eb e3                	jmp    10f7 <thread_join+0x19>
+
+00001114 <lock_init>:
+
+void
+lock_init(lock_t *lk)
+{
+    1114:	55                   	push   %ebp
+    1115:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    1117:	8b 45 08             	mov    0x8(%ebp),%eax
+    111a:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1120:	5d                   	pop    %ebp
+    1121:	c3                   	ret
+
+00001122 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+    1122:	55                   	push   %ebp
+    1123:	89 e5                	mov    %esp,%ebp
+    1125:	8b 55 08             	mov    0x8(%ebp),%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    1128:	b8 01 00 00 00       	mov    $0x1,%eax
+    112d:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    1130:	85 c0                	test   %eax,%eax
+    1132:	75 f4                	jne    1128 <lock_acquire+0x6>
+    ;
+}
+    1134:	5d                   	pop    %ebp
+    1135:	c3                   	ret
+
+00001136 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+    1136:	55                   	push   %ebp
+    1137:	89 e5                	mov    %esp,%ebp
+    1139:	8b 55 08             	mov    0x8(%ebp),%edx
+    113c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1141:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    1144:	5d                   	pop    %ebp
+    1145:	c3                   	ret
+
+00001146 <mutex_init>:
+// Are Tricky": state is 0 when free, 1 when held, 2 when held and
+// others may be waiting.  Unlocking an uncontended mutex costs no
+// system call.
+void
+mutex_init(mutex_t *m)
+{
+    1146:	55                   	push   %ebp
+    1147:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    1149:	8b 45 08             	mov    0x8(%ebp),%eax
+    114c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1152:	5d                   	pop    %ebp
+    1153:	c3                   	ret
+
+00001154 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+    1154:	55                   	push   %ebp
+    1155:	89 e5                	mov    %esp,%ebp
+    1157:	53                   	push   %ebx
+    1158:	83 ec 04             	sub    $0x4,%esp
+    115b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    115e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1163:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1168:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    116c:	85 c0                	test   %eax,%eax
+    116e:	74 29                	je     1199 <mutex_lock+0x45>
+    return;
+  if(c != 2)
+    1170:	83 f8 02             	cmp    $0x2,%eax
+    1173:	74 20                	je     1195 <mutex_lock+0x41>
+    1175:	b8 02 00 00 00       	mov    $0x2,%eax
+    117a:	f0 87 03             	lock xchg %eax,(%ebx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    117d:	eb 16                	jmp    1195 <mutex_lock+0x41>
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    117f:	83 ec 08             	sub    $0x8,%esp
+    1182:	6a 02                	push   $0x2
+    1184:	53                   	push   %ebx
+    1185:	e8 40 f8 ff ff       	call   9ca <futex_wait>
+  asm volatile("lock; xchgl %0, %1" :
+    118a:	b8 02 00 00 00       	mov    $0x2,%eax
+    118f:	f0 87 03             	lock xchg %eax,(%ebx)
+    1192:	83 c4 10             	add    $0x10,%esp
+  while(c != 0){
+    1195:	85 c0                	test   %eax,%eax
+    1197:	75 e6                	jne    117f <mutex_lock+0x2b>
+    c = xchg(&m->state, 2);
+  }
+}
+    1199:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    119c:	c9                   	leave
+    119d:	c3                   	ret
+
+0000119e <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+    119e:	55                   	push   %ebp
+    119f:	89 e5                	mov    %esp,%ebp
+    11a1:	83 ec 08             	sub    $0x8,%esp
+    11a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    11a7:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    11ac:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    11b0:	83 fa 01             	cmp    $0x1,%edx
+    11b3:	75 02                	jne    11b7 <mutex_unlock+0x19>
+    m->state = 0;
+    futex_wake(&m->state, 1);
+  }
+}
+    11b5:	c9                   	leave
+    11b6:	c3                   	ret
+    m->state = 0;
+    11b7:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+    11bd:	83 ec 08             	sub    $0x8,%esp
+    11c0:	6a 01                	push   $0x1
+    11c2:	50                   	push   %eax
+    11c3:	e8 11 f8 ff ff       	call   9d9 <futex_wake>
+    11c8:	83 c4 10             	add    $0x10,%esp
+}
+    11cb:	eb e8                	jmp    11b5 <mutex_unlock+0x17>
+
+000011cd <cond_init>:
+// Condition variable: waiters sleep on a sequence number that
+// every signal bumps, so a signal between the unlock and the
+// futex_wait() in cond_wait() is not lost.
+void
+cond_init(cond_t *c)
+{
+    11cd:	55                   	push   %ebp
+    11ce:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    11d0:	8b 45 08             	mov    0x8(%ebp),%eax
+    11d3:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    11d9:	5d                   	pop    %ebp
+    11da:	c3                   	ret
+
+000011db <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+    11db:	55                   	push   %ebp
+    11dc:	89 e5                	mov    %esp,%ebp
+    11de:	57                   	push   %edi
+    11df:	56                   	push   %esi
+    11e0:	53                   	push   %ebx
+    11e1:	83 ec 18             	sub    $0x18,%esp
+    11e4:	8b 75 08             	mov    0x8(%ebp),%esi
+    11e7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    11ea:	8b 3e                	mov    (%esi),%edi
+  mutex_unlock(m);
+    11ec:	53                   	push   %ebx
+    11ed:	e8 ac ff ff ff       	call   119e <mutex_unlock>
+  futex_wait(&c->seq, seq);
+    11f2:	83 c4 08             	add    $0x8,%esp
+    11f5:	57                   	push   %edi
+    11f6:	56                   	push   %esi
+    11f7:	e8 ce f7 ff ff       	call   9ca <futex_wait>
+  // Others may be waiting for m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+    11fc:	83 c4 10             	add    $0x10,%esp
+    11ff:	eb 0e                	jmp    120f <cond_wait+0x34>
+    futex_wait(&m->state, 2);
+    1201:	83 ec 08             	sub    $0x8,%esp
+    1204:	6a 02                	push   $0x2
+    1206:	53                   	push   %ebx
+    1207:	e8 be f7 ff ff       	call   9ca <futex_wait>
+    120c:	83 c4 10             	add    $0x10,%esp
+    120f:	b8 02 00 00 00       	mov    $0x2,%eax
+    1214:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    1217:	85 c0                	test   %eax,%eax
+    1219:	75 e6                	jne    1201 <cond_wait+0x26>
+}
+    121b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    121e:	5b                   	pop    %ebx
+    121f:	5e                   	pop    %esi
+    1220:	5f                   	pop    %edi
+    1221:	5d                   	pop    %ebp
+    1222:	c3                   	ret
+
+00001223 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+    1223:	55                   	push   %ebp
+    1224:	89 e5                	mov    %esp,%ebp
+    1226:	83 ec 10             	sub    $0x10,%esp
+    1229:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    122c:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+    1230:	6a 01                	push   $0x1
+    1232:	50                   	push   %eax
+    1233:	e8 a1 f7 ff ff       	call   9d9 <futex_wake>
+}
+    1238:	83 c4 10             	add    $0x10,%esp
+    123b:	c9                   	leave
+    123c:	c3                   	ret
+
+0000123d <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+    123d:	55                   	push   %ebp
+    123e:	89 e5                	mov    %esp,%ebp
+    1240:	83 ec 10             	sub    $0x10,%esp
+    1243:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    1246:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, NPROC);
+    124a:	6a 40                	push   $0x40
+    124c:	50                   	push   %eax
+    124d:	e8 87 f7 ff ff       	call   9d9 <futex_wake>
+}
+    1252:	83 c4 10             	add    $0x10,%esp
+    1255:	c9                   	leave
+    1256:	c3                   	ret
@@ -2,21 +2,16 @@
 #include "stat.h"
 #include "user.h"
 
-char buf[512];
-
 void
 cat(int fd)
 {
   int n;
 
-  while((n = read(fd, buf, sizeof(buf))) > 0) {
-    if (write(1, buf, n) != n) {
-      printf(1, "cat: write error\n");
-      exit();
-    }
-  }
+  // The kernel moves the data, without a copy through cat.
+  while((n = sendfile(1, fd, 4096)) > 0)
+    ;
   if(n < 0){
-    printf(1, "cat: read error\n");
+    printf(1, "cat: read or write error\n");
     exit();
   }
 }
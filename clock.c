@@ -0,0 +1,202 @@
+// Time keeping.  The TSC, calibrated at boot against the PIT,
+// counts ns since boot; the CMOS clock is read only once, at boot,
+// for the wall-clock time.  CPU 0 brings the clock page (clock.h)
+// up to date on every tick, and every process has it mapped
+// read-only at CLOCKPAGE to read the time without a system call.
+// The TSCs of all CPUs are assumed to be in step, as they are on
+// machines with an invariant TSC (and in QEMU).
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "date.h"
+#include "clock.h"
+
+#define PITHZ     1193182      // PIT input clock
+#define PITLATCH  11932        // PIT periods to calibrate over, ~10ms
+
+struct clockpage *clockpg;
+
+// Count TSC cycles while PIT channel 2 counts down PITLATCH
+// periods: in mode 0 its output, bit 5 of port 0x61, goes high
+// at the end.
+static uint
+pitcycles(void)
+{
+  uint64 t0;
+
+  outb(0x61, (inb(0x61) & ~0x02) | 0x01);  // gate on, speaker off
+  outb(0x43, 0xB0);                        // channel 2, lo/hi byte, mode 0
+  outb(0x42, PITLATCH & 0xFF);
+  outb(0x42, PITLATCH >> 8);
+  t0 = rdtsc();
+  while((inb(0x61) & 0x20) == 0)
+    ;
+  return rdtsc() - t0;
+}
+
+// Days from 1970-01-01 to y-m-d, and back (the civil calendar
+// algorithms of H. Hinnant, for dates after 1970).
+static uint
+daysfromcivil(uint y, uint m, uint d)
+{
+  uint era, yoe, doy, doe;
+
+  y -= m <= 2;
+  era = y / 400;
+  yoe = y - era*400;
+  doy = (153*(m > 2 ? m-3 : m+9) + 2)/5 + d-1;
+  doe = yoe*365 + yoe/4 - yoe/100 + doy;
+  return era*146097 + doe - 719468;
+}
+
+static void
+civilfromdays(uint z, struct rtcdate *r)
+{
+  uint era, doe, yoe, doy, mp;
+
+  z += 719468;
+  era = z / 146097;
+  doe = z - era*146097;
+  yoe = (doe - doe/1460 + doe/36524 - doe/146096) / 365;
+  doy = doe - (365*yoe + yoe/4 - yoe/100);
+  mp = (5*doy + 2)/153;
+  r->day = doy - (153*mp + 2)/5 + 1;
+  r->month = mp < 10 ? mp+3 : mp-9;
+  r->year = yoe + era*400 + (r->month <= 2);
+}
+
+// Calibrate the TSC and the lapic timer, read the wall-clock
+// time and set up the clock page.  Called by CPU 0 before other
+// page tables exist, since setupkvm() maps the page into each of
+// them.
+void
+clockinit(void)
+{
+  struct rtcdate r;
+  uint cycles, ns, shift, rem, count;
+
+  if((clockpg = (struct clockpage*)kzalloc()) == 0)
+    panic("clockinit");
+  // Time the lapic timer over the same window, counting down
+  // once from the top (interrupts are still off).
+  lapictimer(0xFFFFFFFF, 0);
+  count = lapiccount();
+  if((cycles = pitcycles()) == 0)
+    panic("clockinit: no tsc");
+  count -= lapiccount();
+  ns = divl((uint64)PITLATCH * 1000000000, PITHZ, &rem);
+  lapiccalibrate(divl((uint64)count * TICKNS, ns, &rem));
+  // Largest scale that keeps mult below 2^32.
+  for(shift = 0; shift < 32; shift++)
+    if(((uint64)ns << (shift+1)) >= ((uint64)cycles << 32))
+      break;
+  clockpg->mult = divl((uint64)ns << shift, cycles, &rem);
+  clockpg->shift = shift;
+  clockpg->tsckhz = divl((uint64)cycles * PITHZ, PITLATCH * 1000, &rem);
+
+  cmostime(&r);
+  clockpg->boottime = daysfromcivil(r.year, r.month, r.day)*86400 +
+                      r.hour*3600 + r.minute*60 + r.second;
+  clockpg->tsc = rdtsc();
+  clockpg->ns = 0;
+  cprintf("clock: tsc %d kHz\n", clockpg->tsckhz);
+}
+
+// ns in d TSC cycles.  The multiplication is done 2^31 cycles at
+// a time so that it cannot overflow.
+static uint64
+cyclestons(uint64 d)
+{
+  uint64 ns;
+
+  ns = 0;
+  for(; d >= 0x80000000; d -= 0x80000000)
+    ns += ((uint64)0x80000000 * clockpg->mult) >> clockpg->shift;
+  return ns + (((uint64)(uint)d * clockpg->mult) >> clockpg->shift);
+}
+
+// Called by CPU 0 on every timer tick.
+void
+clocktick(uint ticks)
+{
+  uint64 now;
+
+  now = rdtsc();
+  clockpg->seq++;
+  __sync_synchronize();
+  clockpg->ns += cyclestons(now - clockpg->tsc);
+  clockpg->tsc = now;
+  clockpg->ticks = ticks;
+  __sync_synchronize();
+  clockpg->seq++;
+}
+
+// Nanoseconds since boot.
+uint64
+nanotime(void)
+{
+  uint seq;
+  uint64 tsc, ns, now;
+
+  if(clockpg == 0)
+    return 0;
+  do {
+    seq = clockpg->seq;
+    __sync_synchronize();
+    tsc = clockpg->tsc;
+    ns = clockpg->ns;
+    __sync_synchronize();
+  } while((seq & 1) || seq != clockpg->seq);
+  now = rdtsc();
+  return now > tsc ? ns + cyclestons(now - tsc) : ns;
+}
+
+// Read clock clk (CLOCK_*) into *ts.  Returns -1 for an unknown
+// clock.
+int
+clockgettime(int clk, struct timespec *ts)
+{
+  uint rem;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+    return -1;
+  ts->tv_sec = divl(nanotime(), 1000000000, &rem);
+  ts->tv_nsec = rem;
+  if(clk == CLOCK_REALTIME)
+    ts->tv_sec += clockpg->boottime;
+  return 0;
+}
+
+// The date and time now (UTC), without reading the CMOS again.
+void
+clockdate(struct rtcdate *r)
+{
+  struct timespec ts;
+  uint s;
+
+  clockgettime(CLOCK_REALTIME, &ts);
+  civilfromdays(ts.tv_sec / 86400, r);
+  s = ts.tv_sec % 86400;
+  r->hour = s / 3600;
+  r->minute = s / 60 % 60;
+  r->second = s % 60;
+}
+
+// Spin for us microseconds.  Before clockinit() the TSC rate is
+// unknown and this returns at once.
+void
+microdelay(int us)
+{
+  uint64 end;
+  uint rem;
+
+  if(clockpg == 0 || us <= 0)
+    return;
+  end = rdtsc() + divl((uint64)us * clockpg->tsckhz, 1000, &rem);
+  while(rdtsc() < end)
+    ;
+}
@@ -0,0 +1,26 @@
+// Clocks for clock_gettime().
+#define CLOCK_REALTIME  0      // Seconds since 1970-01-01 00:00 UTC
+#define CLOCK_MONOTONIC 1      // Time since boot
+
+struct timespec {
+  uint tv_sec;
+  uint tv_nsec;
+};
+
+// The clock page, mapped read-only at CLOCKPAGE (memlayout.h) in
+// every process and updated by the kernel on every tick.  The
+// time now, in ns since boot, is
+//   ns + (((rdtsc() - tsc) * mult) >> shift)
+// read under the sequence count: seq is odd while the kernel is
+// updating the page, and changes with every update.  ulib.c's
+// vclock_gettime() does this without a system call.
+struct clockpage {
+  volatile uint seq;
+  uint mult;                   // ns per TSC cycle, scaled by 2^shift
+  uint shift;
+  uint boottime;               // CLOCK_REALTIME seconds at boot
+  uint64 tsc;                  // TSC at the last update
+  uint64 ns;                   // ns since boot at tsc
+  uint tsckhz;                 // TSC frequency
+  uint ticks;                  // Timer ticks at the last update
+};
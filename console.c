@@ -1,6 +1,9 @@
 // Console input and output.
 // Input is from the keyboard or serial port.
 // Output is written to the screen and serial port.
+// Output to the serial port is queued in a ring and sent as the
+// UART takes it, from its transmitter-empty interrupt, so writers
+// need not wait for it.
 
 #include "types.h"
 #include "defs.h"
@@ -16,6 +19,7 @@
 #include "x86.h"
 
 static void consputc(int);
+static void consflush(void);
 
 static int panicked = 0;
 
@@ -99,6 +103,7 @@ cprintf(char *fmt, ...)
     }
   }
 
+  consflush();
   if(locking)
     release(&cons.lock);
 }
@@ -124,20 +129,71 @@ panic(char *s)
 }
 
 //PAGEBREAK: 50
+#define OUTPUT_BUF 4096
+static struct {
+  char buf[OUTPUT_BUF];
+  uint r;  // Next to send
+  uint w;  // Next free
+} output;
+
+// Send what the UART will take of the output ring.
+// Caller holds cons.lock.
+static void
+outputstart(void)
+{
+  int n;
+
+  for(n = uartroom(); n > 0 && output.r != output.w; n--)
+    uartsend(output.buf[output.r++ % OUTPUT_BUF]);
+}
+
+// Queue c for the serial port; the writer starts sending with
+// consflush() once it has queued all it has.  With the ring full,
+// or without cons.locking (at boot, in panic()), bytes go out the
+// old way, waiting on the transmitter.
+static void
+outputc(int c)
+{
+  if(!cons.locking){
+    while(output.r != output.w)
+      uartputc(output.buf[output.r++ % OUTPUT_BUF]);
+    uartputc(c);
+    return;
+  }
+  if(output.w - output.r == OUTPUT_BUF)
+    uartputc(output.buf[output.r++ % OUTPUT_BUF]);
+  output.buf[output.w++ % OUTPUT_BUF] = c;
+}
+
+// Called by uartintr() when the transmitter may have room.
+void
+consoletx(void)
+{
+  acquire(&cons.lock);
+  outputstart();
+  release(&cons.lock);
+}
+
 #define BACKSPACE 0x100
 #define CRTPORT 0x3d4
 static ushort *crt = (ushort*)P2V(0xb8000);  // CGA memory
+static int cgapos = -1;  // Cursor position: col + 80*row
 
+// Put c on the screen at cgapos.  The hardware cursor is moved
+// once a whole write is on it, by cgacursor(), rather than by
+// four port writes for every character.
 static void
 cgaputc(int c)
 {
   int pos;
 
-  // Cursor position: col + 80*row.
-  outb(CRTPORT, 14);
-  pos = inb(CRTPORT+1) << 8;
-  outb(CRTPORT, 15);
-  pos |= inb(CRTPORT+1);
+  if(cgapos < 0){
+    outb(CRTPORT, 14);
+    cgapos = inb(CRTPORT+1) << 8;
+    outb(CRTPORT, 15);
+    cgapos |= inb(CRTPORT+1);
+  }
+  pos = cgapos;
 
   if(c == '\n')
     pos += 80 - pos%80;
@@ -155,11 +211,28 @@ cgaputc(int c)
     memset(crt+pos, 0, sizeof(crt[0])*(24*80 - pos));
   }
 
+  crt[pos] = ' ' | 0x0700;
+  cgapos = pos;
+}
+
+static void
+cgacursor(void)
+{
+  if(cgapos < 0)
+    return;
   outb(CRTPORT, 14);
-  outb(CRTPORT+1, pos>>8);
+  outb(CRTPORT+1, cgapos>>8);
   outb(CRTPORT, 15);
-  outb(CRTPORT+1, pos);
-  crt[pos] = ' ' | 0x0700;
+  outb(CRTPORT+1, cgapos);
+}
+
+// Bring the screen's cursor and the UART up to what has been
+// written.  Caller holds cons.lock.
+static void
+consflush(void)
+{
+  cgacursor();
+  outputstart();
 }
 
 void
@@ -172,9 +245,9 @@ consputc(int c)
   }
 
   if(c == BACKSPACE){
-    uartputc('\b'); uartputc(' '); uartputc('\b');
+    outputc('\b'); outputc(' '); outputc('\b');
   } else
-    uartputc(c);
+    outputc(c);
   cgaputc(c);
 }
 
@@ -226,6 +299,7 @@ consoleintr(int (*getc)(void))
       break;
     }
   }
+  consflush();
   release(&cons.lock);
   if(doprocdump) {
     procdump();  // now call procdump() wo. cons.lock held
@@ -279,6 +353,7 @@ consolewrite(struct inode *ip, char *buf, int n)
   acquire(&cons.lock);
   for(i = 0; i < n; i++)
     consputc(buf[i] & 0xff);
+  consflush();
   release(&cons.lock);
   ilock(ip);
 
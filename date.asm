@@ -0,0 +1,2739 @@
+
+_date:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+# include "types.h"
+# include "user.h"
+# include "date.h"
+int main (int argc, char *argv [])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 30             	sub    $0x30,%esp
+  struct rtcdate r;
+
+  if (date(&r)){
+      11:	8d 45 e0             	lea    -0x20(%ebp),%eax
+      14:	50                   	push   %eax
+      15:	e8 78 08 00 00       	call   892 <date>
+      1a:	83 c4 10             	add    $0x10,%esp
+      1d:	85 c0                	test   %eax,%eax
+      1f:	74 14                	je     35 <main+0x35>
+     printf(2, "date failed\n");
+      21:	83 ec 08             	sub    $0x8,%esp
+      24:	68 e4 11 00 00       	push   $0x11e4
+      29:	6a 02                	push   $0x2
+      2b:	e8 96 0b 00 00       	call   bc6 <printf>
+     exit();
+      30:	e8 58 06 00 00       	call   68d <exit>
+  }
+  // Pon aquí tu código para imprimir la fecha en el formato que desees
+  printf(1,"%d %d %d\n", r.day,r.month,r.year);
+      35:	83 ec 0c             	sub    $0xc,%esp
+      38:	ff 75 f4             	push   -0xc(%ebp)
+      3b:	ff 75 f0             	push   -0x10(%ebp)
+      3e:	ff 75 ec             	push   -0x14(%ebp)
+      41:	68 f1 11 00 00       	push   $0x11f1
+      46:	6a 01                	push   $0x1
+      48:	e8 79 0b 00 00       	call   bc6 <printf>
+  exit();
+      4d:	83 c4 20             	add    $0x20,%esp
+      50:	e8 38 06 00 00       	call   68d <exit>
+
+00000055 <strcpy>:
+#include "memlayout.h"
+#include "clock.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+      55:	55                   	push   %ebp
+      56:	89 e5                	mov    %esp,%ebp
+      58:	56                   	push   %esi
+      59:	53                   	push   %ebx
+      5a:	8b 75 08             	mov    0x8(%ebp),%esi
+      5d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+      60:	89 f0                	mov    %esi,%eax
+      62:	89 d1                	mov    %edx,%ecx
+      64:	83 c2 01             	add    $0x1,%edx
+      67:	89 c3                	mov    %eax,%ebx
+      69:	83 c0 01             	add    $0x1,%eax
+      6c:	0f b6 09             	movzbl (%ecx),%ecx
+      6f:	88 0b                	mov    %cl,(%ebx)
+      71:	84 c9                	test   %cl,%cl
+      73:	75 ed                	jne    62 <strcpy+0xd>
+    ;
+  return os;
+}
+      75:	89 f0                	mov    %esi,%eax
+      77:	5b                   	pop    %ebx
+      78:	5e                   	pop    %esi
+      79:	5d                   	pop    %ebp
+      7a:	c3                   	ret
+
+0000007b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+      7b:	55                   	push   %ebp
+      7c:	89 e5                	mov    %esp,%ebp
+      7e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      81:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+      84:	eb 06                	jmp    8c <strcmp+0x11>
+    p++, q++;
+      86:	83 c1 01             	add    $0x1,%ecx
+      89:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+      8c:	0f b6 01             	movzbl (%ecx),%eax
+      8f:	84 c0                	test   %al,%al
+      91:	74 04                	je     97 <strcmp+0x1c>
+      93:	3a 02                	cmp    (%edx),%al
+      95:	74 ef                	je     86 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+      97:	0f b6 c0             	movzbl %al,%eax
+      9a:	0f b6 12             	movzbl (%edx),%edx
+      9d:	29 d0                	sub    %edx,%eax
+}
+      9f:	5d                   	pop    %ebp
+      a0:	c3                   	ret
+
+000000a1 <strlen>:
+
+uint
+strlen(const char *s)
+{
+      a1:	55                   	push   %ebp
+      a2:	89 e5                	mov    %esp,%ebp
+      a4:	53                   	push   %ebx
+      a5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  const char *p;
+  uint w;
+
+  for(p = s; (uint)p & 3; p++)
+      a8:	89 c8                	mov    %ecx,%eax
+      aa:	eb 03                	jmp    af <strlen+0xe>
+      ac:	83 c0 01             	add    $0x1,%eax
+      af:	a8 03                	test   $0x3,%al
+      b1:	74 09                	je     bc <strlen+0x1b>
+    if(*p == 0)
+      b3:	80 38 00             	cmpb   $0x0,(%eax)
+      b6:	75 f4                	jne    ac <strlen+0xb>
+      return p - s;
+      b8:	29 c8                	sub    %ecx,%eax
+      ba:	eb 25                	jmp    e1 <strlen+0x40>
+  // Then a word at a time, which never crosses into the next page:
+  // a word with a zero byte in it has one of these bits set.
+  for(;; p += 4){
+    w = *(uint*)p;
+      bc:	8b 10                	mov    (%eax),%edx
+    if((w - 0x01010101) & ~w & 0x80808080)
+      be:	8d 9a ff fe fe fe    	lea    -0x1010101(%edx),%ebx
+      c4:	f7 d2                	not    %edx
+      c6:	21 da                	and    %ebx,%edx
+      c8:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+      ce:	75 05                	jne    d5 <strlen+0x34>
+  for(;; p += 4){
+      d0:	83 c0 04             	add    $0x4,%eax
+    w = *(uint*)p;
+      d3:	eb e7                	jmp    bc <strlen+0x1b>
+      break;
+  }
+  while(*p)
+      d5:	80 38 00             	cmpb   $0x0,(%eax)
+      d8:	74 05                	je     df <strlen+0x3e>
+    p++;
+      da:	83 c0 01             	add    $0x1,%eax
+      dd:	eb f6                	jmp    d5 <strlen+0x34>
+  return p - s;
+      df:	29 c8                	sub    %ecx,%eax
+}
+      e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      e4:	c9                   	leave
+      e5:	c3                   	ret
+
+000000e6 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+      e6:	55                   	push   %ebp
+      e7:	89 e5                	mov    %esp,%ebp
+      e9:	57                   	push   %edi
+      ea:	56                   	push   %esi
+      eb:	53                   	push   %ebx
+      ec:	8b 55 10             	mov    0x10(%ebp),%edx
+  uint h;
+  char *d;
+
+  d = dst;
+  c &= 0xFF;
+      ef:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  if(n >= 16){
+      f3:	83 fa 0f             	cmp    $0xf,%edx
+      f6:	76 52                	jbe    14a <memset+0x64>
+    h = -(uint)d & 3;
+      f8:	8b 45 08             	mov    0x8(%ebp),%eax
+      fb:	f7 d8                	neg    %eax
+      fd:	83 e0 03             	and    $0x3,%eax
+     100:	89 c6                	mov    %eax,%esi
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     102:	8b 7d 08             	mov    0x8(%ebp),%edi
+     105:	89 c1                	mov    %eax,%ecx
+     107:	89 d8                	mov    %ebx,%eax
+     109:	fc                   	cld
+     10a:	f3 aa                	rep stos %al,%es:(%edi)
+    stosb(d, c, h);
+    stosl(d + h, (c<<24)|(c<<16)|(c<<8)|c, (n - h)/4);
+     10c:	29 f2                	sub    %esi,%edx
+     10e:	89 d1                	mov    %edx,%ecx
+     110:	c1 e9 02             	shr    $0x2,%ecx
+     113:	c1 e0 18             	shl    $0x18,%eax
+     116:	89 df                	mov    %ebx,%edi
+     118:	c1 e7 10             	shl    $0x10,%edi
+     11b:	09 f8                	or     %edi,%eax
+     11d:	89 df                	mov    %ebx,%edi
+     11f:	c1 e7 08             	shl    $0x8,%edi
+     122:	09 f8                	or     %edi,%eax
+     124:	09 d8                	or     %ebx,%eax
+     126:	89 f7                	mov    %esi,%edi
+     128:	03 7d 08             	add    0x8(%ebp),%edi
+}
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosl" :
+     12b:	fc                   	cld
+     12c:	f3 ab                	rep stos %eax,%es:(%edi)
+    d += h + (n - h)/4*4;
+     12e:	89 d7                	mov    %edx,%edi
+     130:	83 e7 fc             	and    $0xfffffffc,%edi
+     133:	09 f7                	or     %esi,%edi
+     135:	03 7d 08             	add    0x8(%ebp),%edi
+    n = (n - h)%4;
+     138:	83 e2 03             	and    $0x3,%edx
+  asm volatile("cld; rep stosb" :
+     13b:	89 d1                	mov    %edx,%ecx
+     13d:	89 d8                	mov    %ebx,%eax
+     13f:	fc                   	cld
+     140:	f3 aa                	rep stos %al,%es:(%edi)
+  }
+  stosb(d, c, n);
+  return dst;
+}
+     142:	8b 45 08             	mov    0x8(%ebp),%eax
+     145:	5b                   	pop    %ebx
+     146:	5e                   	pop    %esi
+     147:	5f                   	pop    %edi
+     148:	5d                   	pop    %ebp
+     149:	c3                   	ret
+  d = dst;
+     14a:	8b 7d 08             	mov    0x8(%ebp),%edi
+     14d:	eb ec                	jmp    13b <memset+0x55>
+
+0000014f <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     14f:	55                   	push   %ebp
+     150:	89 e5                	mov    %esp,%ebp
+     152:	8b 45 08             	mov    0x8(%ebp),%eax
+     155:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     159:	eb 03                	jmp    15e <strchr+0xf>
+     15b:	83 c0 01             	add    $0x1,%eax
+     15e:	0f b6 10             	movzbl (%eax),%edx
+     161:	84 d2                	test   %dl,%dl
+     163:	74 06                	je     16b <strchr+0x1c>
+    if(*s == c)
+     165:	38 ca                	cmp    %cl,%dl
+     167:	75 f2                	jne    15b <strchr+0xc>
+     169:	eb 05                	jmp    170 <strchr+0x21>
+      return (char*)s;
+  return 0;
+     16b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     170:	5d                   	pop    %ebp
+     171:	c3                   	ret
+
+00000172 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     172:	55                   	push   %ebp
+     173:	89 e5                	mov    %esp,%ebp
+     175:	56                   	push   %esi
+     176:	53                   	push   %ebx
+     177:	8b 55 08             	mov    0x8(%ebp),%edx
+     17a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     17d:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  // A word at a time while they agree.
+  if((((uint)s1 | (uint)s2) & 3) == 0)
+     180:	89 d3                	mov    %edx,%ebx
+     182:	09 cb                	or     %ecx,%ebx
+     184:	f6 c3 03             	test   $0x3,%bl
+     187:	74 24                	je     1ad <memcmp+0x3b>
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+      s1 += 4, s2 += 4;
+  while(n-- > 0){
+     189:	8d 70 ff             	lea    -0x1(%eax),%esi
+     18c:	85 c0                	test   %eax,%eax
+     18e:	74 32                	je     1c2 <memcmp+0x50>
+    if(*s1 != *s2)
+     190:	0f b6 02             	movzbl (%edx),%eax
+     193:	0f b6 19             	movzbl (%ecx),%ebx
+     196:	38 d8                	cmp    %bl,%al
+     198:	75 20                	jne    1ba <memcmp+0x48>
+      return *s1 - *s2;
+    s1++, s2++;
+     19a:	83 c2 01             	add    $0x1,%edx
+     19d:	83 c1 01             	add    $0x1,%ecx
+  while(n-- > 0){
+     1a0:	89 f0                	mov    %esi,%eax
+     1a2:	eb e5                	jmp    189 <memcmp+0x17>
+      s1 += 4, s2 += 4;
+     1a4:	83 c2 04             	add    $0x4,%edx
+     1a7:	83 c1 04             	add    $0x4,%ecx
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+     1aa:	83 e8 04             	sub    $0x4,%eax
+     1ad:	83 f8 03             	cmp    $0x3,%eax
+     1b0:	76 d7                	jbe    189 <memcmp+0x17>
+     1b2:	8b 31                	mov    (%ecx),%esi
+     1b4:	39 32                	cmp    %esi,(%edx)
+     1b6:	74 ec                	je     1a4 <memcmp+0x32>
+     1b8:	eb cf                	jmp    189 <memcmp+0x17>
+      return *s1 - *s2;
+     1ba:	0f b6 c0             	movzbl %al,%eax
+     1bd:	0f b6 db             	movzbl %bl,%ebx
+     1c0:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     1c2:	5b                   	pop    %ebx
+     1c3:	5e                   	pop    %esi
+     1c4:	5d                   	pop    %ebp
+     1c5:	c3                   	ret
+
+000001c6 <memchr>:
+// The first c in the n bytes at v, or 0.  Once aligned, a word at
+// a time, with the word's bytes that equal c turned into zeroes
+// and those looked for.
+void*
+memchr(const void *v, int c, uint n)
+{
+     1c6:	55                   	push   %ebp
+     1c7:	89 e5                	mov    %esp,%ebp
+     1c9:	57                   	push   %edi
+     1ca:	56                   	push   %esi
+     1cb:	53                   	push   %ebx
+     1cc:	8b 45 08             	mov    0x8(%ebp),%eax
+     1cf:	8b 55 10             	mov    0x10(%ebp),%edx
+  const uchar *s;
+  uint w, rep;
+
+  s = v;
+  c = (uchar)c;
+     1d2:	0f b6 75 0c          	movzbl 0xc(%ebp),%esi
+  for(; n > 0 && ((uint)s & 3); n--, s++)
+     1d6:	eb 06                	jmp    1de <memchr+0x18>
+     1d8:	83 ea 01             	sub    $0x1,%edx
+     1db:	83 c0 01             	add    $0x1,%eax
+     1de:	85 d2                	test   %edx,%edx
+     1e0:	74 0d                	je     1ef <memchr+0x29>
+     1e2:	a8 03                	test   $0x3,%al
+     1e4:	74 09                	je     1ef <memchr+0x29>
+    if(*s == c)
+     1e6:	0f b6 08             	movzbl (%eax),%ecx
+     1e9:	39 f1                	cmp    %esi,%ecx
+     1eb:	75 eb                	jne    1d8 <memchr+0x12>
+     1ed:	eb 41                	jmp    230 <memchr+0x6a>
+      return (void*)s;
+  rep = c * 0x01010101;
+     1ef:	69 fe 01 01 01 01    	imul   $0x1010101,%esi,%edi
+  for(; n >= 4; n -= 4, s += 4){
+     1f5:	eb 06                	jmp    1fd <memchr+0x37>
+     1f7:	83 ea 04             	sub    $0x4,%edx
+     1fa:	83 c0 04             	add    $0x4,%eax
+     1fd:	83 fa 03             	cmp    $0x3,%edx
+     200:	76 16                	jbe    218 <memchr+0x52>
+    w = *(uint*)s ^ rep;
+     202:	89 f9                	mov    %edi,%ecx
+     204:	33 08                	xor    (%eax),%ecx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     206:	8d 99 ff fe fe fe    	lea    -0x1010101(%ecx),%ebx
+     20c:	f7 d1                	not    %ecx
+     20e:	21 cb                	and    %ecx,%ebx
+     210:	f7 c3 80 80 80 80    	test   $0x80808080,%ebx
+     216:	74 df                	je     1f7 <memchr+0x31>
+      break;
+  }
+  for(; n > 0; n--, s++)
+     218:	85 d2                	test   %edx,%edx
+     21a:	74 0f                	je     22b <memchr+0x65>
+    if(*s == c)
+     21c:	0f b6 08             	movzbl (%eax),%ecx
+     21f:	39 f1                	cmp    %esi,%ecx
+     221:	74 0d                	je     230 <memchr+0x6a>
+  for(; n > 0; n--, s++)
+     223:	83 ea 01             	sub    $0x1,%edx
+     226:	83 c0 01             	add    $0x1,%eax
+     229:	eb ed                	jmp    218 <memchr+0x52>
+      return (void*)s;
+  return 0;
+     22b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     230:	5b                   	pop    %ebx
+     231:	5e                   	pop    %esi
+     232:	5f                   	pop    %edi
+     233:	5d                   	pop    %ebp
+     234:	c3                   	ret
+
+00000235 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     235:	55                   	push   %ebp
+     236:	89 e5                	mov    %esp,%ebp
+     238:	57                   	push   %edi
+     239:	56                   	push   %esi
+     23a:	53                   	push   %ebx
+     23b:	83 ec 1c             	sub    $0x1c,%esp
+     23e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     241:	bb 00 00 00 00       	mov    $0x0,%ebx
+     246:	89 de                	mov    %ebx,%esi
+     248:	83 c3 01             	add    $0x1,%ebx
+     24b:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     24e:	7d 2e                	jge    27e <gets+0x49>
+    cc = read(0, &c, 1);
+     250:	83 ec 04             	sub    $0x4,%esp
+     253:	6a 01                	push   $0x1
+     255:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     258:	50                   	push   %eax
+     259:	6a 00                	push   $0x0
+     25b:	e8 51 05 00 00       	call   7b1 <read>
+    if(cc < 1)
+     260:	83 c4 10             	add    $0x10,%esp
+     263:	85 c0                	test   %eax,%eax
+     265:	7e 17                	jle    27e <gets+0x49>
+      break;
+    buf[i++] = c;
+     267:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     26b:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+     26e:	3c 0a                	cmp    $0xa,%al
+     270:	0f 94 c2             	sete   %dl
+     273:	3c 0d                	cmp    $0xd,%al
+     275:	0f 94 c0             	sete   %al
+     278:	08 c2                	or     %al,%dl
+     27a:	74 ca                	je     246 <gets+0x11>
+    buf[i++] = c;
+     27c:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+     27e:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+     282:	89 f8                	mov    %edi,%eax
+     284:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     287:	5b                   	pop    %ebx
+     288:	5e                   	pop    %esi
+     289:	5f                   	pop    %edi
+     28a:	5d                   	pop    %ebp
+     28b:	c3                   	ret
+
+0000028c <atoi>:
+  return r;
+}
+
+int
+atoi(const char *s)
+{
+     28c:	55                   	push   %ebp
+     28d:	89 e5                	mov    %esp,%ebp
+     28f:	53                   	push   %ebx
+     290:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+     293:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+     298:	eb 10                	jmp    2aa <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+     29a:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+     29d:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+     2a0:	83 c1 01             	add    $0x1,%ecx
+     2a3:	0f be c0             	movsbl %al,%eax
+     2a6:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+     2aa:	0f b6 01             	movzbl (%ecx),%eax
+     2ad:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     2b0:	80 fb 09             	cmp    $0x9,%bl
+     2b3:	76 e5                	jbe    29a <atoi+0xe>
+  return n;
+}
+     2b5:	89 d0                	mov    %edx,%eax
+     2b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2ba:	c9                   	leave
+     2bb:	c3                   	ret
+
+000002bc <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     2bc:	55                   	push   %ebp
+     2bd:	89 e5                	mov    %esp,%ebp
+     2bf:	57                   	push   %edi
+     2c0:	56                   	push   %esi
+     2c1:	53                   	push   %ebx
+     2c2:	83 ec 08             	sub    $0x8,%esp
+     2c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     2c8:	8b 55 0c             	mov    0xc(%ebp),%edx
+     2cb:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *src;
+  int h;
+
+  dst = vdst;
+  src = vsrc;
+  if(n <= 0)
+     2ce:	85 c0                	test   %eax,%eax
+     2d0:	0f 8e 82 00 00 00    	jle    358 <memmove+0x9c>
+    return vdst;
+  if(src < dst && src + n > dst){
+     2d6:	39 da                	cmp    %ebx,%edx
+     2d8:	73 07                	jae    2e1 <memmove+0x25>
+     2da:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+     2dd:	39 cb                	cmp    %ecx,%ebx
+     2df:	72 5e                	jb     33f <memmove+0x83>
+    movsbback(dst + n - 1, src + n - 1, n);
+    return vdst;
+  }
+  if(n >= 16 && (((uint)dst ^ (uint)src) & 3) == 0){
+     2e1:	83 f8 0f             	cmp    $0xf,%eax
+     2e4:	7e 69                	jle    34f <memmove+0x93>
+     2e6:	89 d9                	mov    %ebx,%ecx
+     2e8:	31 d1                	xor    %edx,%ecx
+     2ea:	f6 c1 03             	test   $0x3,%cl
+     2ed:	75 73                	jne    362 <memmove+0xa6>
+    h = -(uint)dst & 3;
+     2ef:	89 d9                	mov    %ebx,%ecx
+     2f1:	f7 d9                	neg    %ecx
+     2f3:	83 e1 03             	and    $0x3,%ecx
+}
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsb" :
+     2f6:	89 df                	mov    %ebx,%edi
+     2f8:	89 d6                	mov    %edx,%esi
+     2fa:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+     2fd:	fc                   	cld
+     2fe:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    movsb(dst, src, h);
+    dst += h, src += h, n -= h;
+     300:	8b 75 f0             	mov    -0x10(%ebp),%esi
+     303:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+     306:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+     309:	29 f0                	sub    %esi,%eax
+    movsl(dst, src, n/4);
+     30b:	8d 50 03             	lea    0x3(%eax),%edx
+     30e:	0f 49 d0             	cmovns %eax,%edx
+     311:	c1 fa 02             	sar    $0x2,%edx
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+     314:	89 7d f0             	mov    %edi,-0x10(%ebp)
+     317:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     31a:	89 ce                	mov    %ecx,%esi
+     31c:	89 d1                	mov    %edx,%ecx
+     31e:	fc                   	cld
+     31f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    dst += n/4*4, src += n/4*4, n %= 4;
+     321:	c1 e2 02             	shl    $0x2,%edx
+     324:	8b 7d f0             	mov    -0x10(%ebp),%edi
+     327:	01 d7                	add    %edx,%edi
+     329:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     32c:	01 ca                	add    %ecx,%edx
+     32e:	89 c6                	mov    %eax,%esi
+     330:	c1 fe 1f             	sar    $0x1f,%esi
+     333:	c1 ee 1e             	shr    $0x1e,%esi
+     336:	01 f0                	add    %esi,%eax
+     338:	83 e0 03             	and    $0x3,%eax
+     33b:	29 f0                	sub    %esi,%eax
+     33d:	eb 12                	jmp    351 <memmove+0x95>
+    movsbback(dst + n - 1, src + n - 1, n);
+     33f:	8d 78 ff             	lea    -0x1(%eax),%edi
+     342:	8d 34 3a             	lea    (%edx,%edi,1),%esi
+     345:	01 df                	add    %ebx,%edi
+// Copy cnt bytes down from the last ones, at dst and src, to the
+// first: for overlapping moves up.
+static inline void
+movsbback(void *dst, const void *src, int cnt)
+{
+  asm volatile("std; rep movsb; cld" :
+     347:	89 c1                	mov    %eax,%ecx
+     349:	fd                   	std
+     34a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     34c:	fc                   	cld
+    return vdst;
+     34d:	eb 09                	jmp    358 <memmove+0x9c>
+  dst = vdst;
+     34f:	89 df                	mov    %ebx,%edi
+  asm volatile("cld; rep movsb" :
+     351:	89 d6                	mov    %edx,%esi
+     353:	89 c1                	mov    %eax,%ecx
+     355:	fc                   	cld
+     356:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  }
+  movsb(dst, src, n);
+  return vdst;
+}
+     358:	89 d8                	mov    %ebx,%eax
+     35a:	83 c4 08             	add    $0x8,%esp
+     35d:	5b                   	pop    %ebx
+     35e:	5e                   	pop    %esi
+     35f:	5f                   	pop    %edi
+     360:	5d                   	pop    %ebp
+     361:	c3                   	ret
+  dst = vdst;
+     362:	89 df                	mov    %ebx,%edi
+     364:	eb eb                	jmp    351 <memmove+0x95>
+
+00000366 <vclock_gettime>:
+
+// clock_gettime() without a system call: read the clock page
+// that the kernel maps at CLOCKPAGE (see clock.h).
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+     366:	55                   	push   %ebp
+     367:	89 e5                	mov    %esp,%ebp
+     369:	57                   	push   %edi
+     36a:	56                   	push   %esi
+     36b:	53                   	push   %ebx
+     36c:	83 ec 14             	sub    $0x14,%esp
+  struct clockpage *cp = (struct clockpage*)CLOCKPAGE;
+  uint seq, rem, d;
+  uint64 tsc, ns, now;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+     36f:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     373:	0f 87 a3 00 00 00    	ja     41c <vclock_gettime+0xb6>
+    return -1;
+  do {
+    seq = cp->seq;
+     379:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+    __sync_synchronize();
+     37e:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    tsc = cp->tsc;
+     383:	8b 15 10 f0 ff 7f    	mov    0x7ffff010,%edx
+     389:	8b 1d 14 f0 ff 7f    	mov    0x7ffff014,%ebx
+    ns = cp->ns;
+     38f:	8b 35 18 f0 ff 7f    	mov    0x7ffff018,%esi
+     395:	8b 3d 1c f0 ff 7f    	mov    0x7ffff01c,%edi
+    __sync_synchronize();
+     39b:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != cp->seq);
+     3a0:	89 c1                	mov    %eax,%ecx
+     3a2:	83 e1 01             	and    $0x1,%ecx
+     3a5:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     3a8:	75 cf                	jne    379 <vclock_gettime+0x13>
+     3aa:	8b 0d 00 f0 ff 7f    	mov    0x7ffff000,%ecx
+     3b0:	39 c1                	cmp    %eax,%ecx
+     3b2:	75 c5                	jne    379 <vclock_gettime+0x13>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+     3b4:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     3b7:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     3ba:	0f 31                	rdtsc
+     3bc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     3bf:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     3c2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  now = rdtsc();
+  // Less than a tick has passed since the update, so the delta
+  // fits in 32 bits.
+  d = now > tsc ? now - tsc : 0;
+     3c5:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     3c8:	19 d3                	sbb    %edx,%ebx
+     3ca:	73 07                	jae    3d3 <vclock_gettime+0x6d>
+     3cc:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+     3cf:	29 d8                	sub    %ebx,%eax
+     3d1:	89 c1                	mov    %eax,%ecx
+  ns += ((uint64)d * cp->mult) >> cp->shift;
+     3d3:	89 c8                	mov    %ecx,%eax
+     3d5:	f7 25 04 f0 ff 7f    	mull   0x7ffff004
+     3db:	0f b6 0d 08 f0 ff 7f 	movzbl 0x7ffff008,%ecx
+     3e2:	0f ad d0             	shrd   %cl,%edx,%eax
+     3e5:	d3 ea                	shr    %cl,%edx
+     3e7:	f6 c1 20             	test   $0x20,%cl
+     3ea:	74 04                	je     3f0 <vclock_gettime+0x8a>
+     3ec:	89 d0                	mov    %edx,%eax
+     3ee:	31 d2                	xor    %edx,%edx
+     3f0:	01 f0                	add    %esi,%eax
+     3f2:	11 fa                	adc    %edi,%edx
+static inline uint
+divl(uint64 n, uint d, uint *r)
+{
+  uint q;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (*r) :
+     3f4:	bb 00 ca 9a 3b       	mov    $0x3b9aca00,%ebx
+     3f9:	f7 f3                	div    %ebx
+  ts->tv_sec = divl(ns, 1000000000, &rem);
+     3fb:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     3fe:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = rem;
+     400:	89 57 04             	mov    %edx,0x4(%edi)
+  if(clk == CLOCK_REALTIME)
+     403:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     407:	75 1a                	jne    423 <vclock_gettime+0xbd>
+    ts->tv_sec += cp->boottime;
+     409:	03 05 0c f0 ff 7f    	add    0x7ffff00c,%eax
+     40f:	89 07                	mov    %eax,(%edi)
+  return 0;
+     411:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     414:	83 c4 14             	add    $0x14,%esp
+     417:	5b                   	pop    %ebx
+     418:	5e                   	pop    %esi
+     419:	5f                   	pop    %edi
+     41a:	5d                   	pop    %ebp
+     41b:	c3                   	ret
+    return -1;
+     41c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     421:	eb f1                	jmp    414 <vclock_gettime+0xae>
+  return 0;
+     423:	b8 00 00 00 00       	mov    $0x0,%eax
+     428:	eb ea                	jmp    414 <vclock_gettime+0xae>
+
+0000042a <flush>:
+
+// Write out fd's buffer, or with fd < 0 every buffer.
+// Returns -1 if a write fails.
+int
+flush(int fd)
+{
+     42a:	55                   	push   %ebp
+     42b:	89 e5                	mov    %esp,%ebp
+     42d:	56                   	push   %esi
+     42e:	53                   	push   %ebx
+     42f:	8b 45 08             	mov    0x8(%ebp),%eax
+  int r, n;
+
+  if(fd < 0){
+     432:	85 c0                	test   %eax,%eax
+     434:	78 5d                	js     493 <flush+0x69>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+      if(flush(fd) < 0)
+        r = -1;
+    return r;
+  }
+  if(fd >= NOBUF || (n = obuf[fd].n) == 0)
+     436:	83 f8 0f             	cmp    $0xf,%eax
+     439:	7f 64                	jg     49f <flush+0x75>
+     43b:	69 d0 08 02 00 00    	imul   $0x208,%eax,%edx
+     441:	8b b2 24 19 00 00    	mov    0x1924(%edx),%esi
+     447:	85 f6                	test   %esi,%esi
+     449:	74 59                	je     4a4 <flush+0x7a>
+    return 0;
+  obuf[fd].n = 0;
+     44b:	c7 82 24 19 00 00 00 	movl   $0x0,0x1924(%edx)
+     452:	00 00 00 
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     455:	81 c2 28 19 00 00    	add    $0x1928,%edx
+     45b:	83 ec 04             	sub    $0x4,%esp
+     45e:	56                   	push   %esi
+     45f:	52                   	push   %edx
+     460:	50                   	push   %eax
+     461:	e8 5a 03 00 00       	call   7c0 <write>
+     466:	83 c4 10             	add    $0x10,%esp
+     469:	39 f0                	cmp    %esi,%eax
+     46b:	75 40                	jne    4ad <flush+0x83>
+     46d:	be 00 00 00 00       	mov    $0x0,%esi
+     472:	eb 30                	jmp    4a4 <flush+0x7a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     474:	83 c3 01             	add    $0x1,%ebx
+     477:	83 fb 0f             	cmp    $0xf,%ebx
+     47a:	7f 28                	jg     4a4 <flush+0x7a>
+      if(flush(fd) < 0)
+     47c:	83 ec 0c             	sub    $0xc,%esp
+     47f:	53                   	push   %ebx
+     480:	e8 a5 ff ff ff       	call   42a <flush>
+     485:	83 c4 10             	add    $0x10,%esp
+     488:	85 c0                	test   %eax,%eax
+     48a:	79 e8                	jns    474 <flush+0x4a>
+        r = -1;
+     48c:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     491:	eb e1                	jmp    474 <flush+0x4a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     493:	be 00 00 00 00       	mov    $0x0,%esi
+     498:	bb 00 00 00 00       	mov    $0x0,%ebx
+     49d:	eb d8                	jmp    477 <flush+0x4d>
+    return 0;
+     49f:	be 00 00 00 00       	mov    $0x0,%esi
+}
+     4a4:	89 f0                	mov    %esi,%eax
+     4a6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     4a9:	5b                   	pop    %ebx
+     4aa:	5e                   	pop    %esi
+     4ab:	5d                   	pop    %ebp
+     4ac:	c3                   	ret
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     4ad:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     4b2:	eb f0                	jmp    4a4 <flush+0x7a>
+
+000004b4 <bufreset>:
+
+static void
+bufreset(int fd)
+{
+  if(fd >= 0 && fd < NOBUF){
+     4b4:	83 f8 0f             	cmp    $0xf,%eax
+     4b7:	76 01                	jbe    4ba <bufreset+0x6>
+     4b9:	c3                   	ret
+{
+     4ba:	55                   	push   %ebp
+     4bb:	89 e5                	mov    %esp,%ebp
+     4bd:	53                   	push   %ebx
+     4be:	83 ec 10             	sub    $0x10,%esp
+     4c1:	89 c3                	mov    %eax,%ebx
+    flush(fd);
+     4c3:	50                   	push   %eax
+     4c4:	e8 61 ff ff ff       	call   42a <flush>
+    obuf[fd].mode = BUNKNOWN;
+     4c9:	69 db 08 02 00 00    	imul   $0x208,%ebx,%ebx
+     4cf:	c7 83 20 19 00 00 00 	movl   $0x0,0x1920(%ebx)
+     4d6:	00 00 00 
+     4d9:	83 c4 10             	add    $0x10,%esp
+  }
+}
+     4dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4df:	c9                   	leave
+     4e0:	c3                   	ret
+
+000004e1 <bufwrite>:
+
+// Write n bytes from p to fd, through its buffer.
+// Returns n, or -1 if a write fails.
+int
+bufwrite(int fd, const void *p, int n)
+{
+     4e1:	55                   	push   %ebp
+     4e2:	89 e5                	mov    %esp,%ebp
+     4e4:	57                   	push   %edi
+     4e5:	56                   	push   %esi
+     4e6:	53                   	push   %ebx
+     4e7:	83 ec 3c             	sub    $0x3c,%esp
+     4ea:	8b 75 08             	mov    0x8(%ebp),%esi
+     4ed:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct stat st;
+  const char *s;
+  int i;
+
+  if(fd < 0 || fd >= NOBUF)
+     4f0:	83 fe 0f             	cmp    $0xf,%esi
+     4f3:	0f 87 a2 00 00 00    	ja     59b <bufwrite+0xba>
+    return write(fd, p, n);
+  if(obuf[fd].mode == BUNKNOWN){
+     4f9:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     4ff:	83 b8 20 19 00 00 00 	cmpl   $0x0,0x1920(%eax)
+     506:	75 19                	jne    521 <bufwrite+0x40>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     508:	83 fe 02             	cmp    $0x2,%esi
+     50b:	0f 85 9c 00 00 00    	jne    5ad <bufwrite+0xcc>
+      obuf[fd].mode = BNONE;
+     511:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     517:	c7 80 20 19 00 00 01 	movl   $0x1,0x1920(%eax)
+     51e:	00 00 00 
+    else
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+  }
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     521:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     527:	89 da                	mov    %ebx,%edx
+     529:	03 90 24 19 00 00    	add    0x1924(%eax),%edx
+     52f:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+     535:	0f 8f ae 00 00 00    	jg     5e9 <bufwrite+0x108>
+    return -1;
+  if(n >= OBUFSZ)
+     53b:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+     541:	0f 8f bd 00 00 00    	jg     604 <bufwrite+0x123>
+    return write(fd, p, n);
+  memmove(obuf[fd].buf + obuf[fd].n, p, n);
+     547:	69 d6 08 02 00 00    	imul   $0x208,%esi,%edx
+     54d:	8d ba 20 19 00 00    	lea    0x1920(%edx),%edi
+     553:	8b 82 24 19 00 00    	mov    0x1924(%edx),%eax
+     559:	83 ec 04             	sub    $0x4,%esp
+     55c:	53                   	push   %ebx
+     55d:	ff 75 0c             	push   0xc(%ebp)
+     560:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     563:	8d 84 10 28 19 00 00 	lea    0x1928(%eax,%edx,1),%eax
+     56a:	50                   	push   %eax
+     56b:	e8 4c fd ff ff       	call   2bc <memmove>
+  obuf[fd].n += n;
+     570:	01 5f 04             	add    %ebx,0x4(%edi)
+  if(obuf[fd].mode == BNONE)
+     573:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     576:	8b 82 20 19 00 00    	mov    0x1920(%edx),%eax
+     57c:	83 c4 10             	add    $0x10,%esp
+     57f:	83 f8 01             	cmp    $0x1,%eax
+     582:	0f 84 91 00 00 00    	je     619 <bufwrite+0x138>
+    return flush(fd) < 0 ? -1 : n;
+  if(obuf[fd].mode == BLINE)
+     588:	83 f8 02             	cmp    $0x2,%eax
+     58b:	0f 84 ca 00 00 00    	je     65b <bufwrite+0x17a>
+    for(s = p, i = 0; i < n; i++)
+      if(s[i] == '\n')
+        return flush(fd) < 0 ? -1 : n;
+  return n;
+     591:	89 d8                	mov    %ebx,%eax
+}
+     593:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     596:	5b                   	pop    %ebx
+     597:	5e                   	pop    %esi
+     598:	5f                   	pop    %edi
+     599:	5d                   	pop    %ebp
+     59a:	c3                   	ret
+    return write(fd, p, n);
+     59b:	83 ec 04             	sub    $0x4,%esp
+     59e:	53                   	push   %ebx
+     59f:	ff 75 0c             	push   0xc(%ebp)
+     5a2:	56                   	push   %esi
+     5a3:	e8 18 02 00 00       	call   7c0 <write>
+     5a8:	83 c4 10             	add    $0x10,%esp
+     5ab:	eb e6                	jmp    593 <bufwrite+0xb2>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     5ad:	83 ec 08             	sub    $0x8,%esp
+     5b0:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     5b3:	50                   	push   %eax
+     5b4:	56                   	push   %esi
+     5b5:	e8 51 02 00 00       	call   80b <fstat>
+     5ba:	83 c4 10             	add    $0x10,%esp
+     5bd:	85 c0                	test   %eax,%eax
+     5bf:	0f 88 4c ff ff ff    	js     511 <bufwrite+0x30>
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+     5c5:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     5ca:	74 16                	je     5e2 <bufwrite+0x101>
+     5cc:	ba 03 00 00 00       	mov    $0x3,%edx
+     5d1:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     5d7:	89 90 20 19 00 00    	mov    %edx,0x1920(%eax)
+     5dd:	e9 3f ff ff ff       	jmp    521 <bufwrite+0x40>
+     5e2:	ba 02 00 00 00       	mov    $0x2,%edx
+     5e7:	eb e8                	jmp    5d1 <bufwrite+0xf0>
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     5e9:	83 ec 0c             	sub    $0xc,%esp
+     5ec:	56                   	push   %esi
+     5ed:	e8 38 fe ff ff       	call   42a <flush>
+     5f2:	83 c4 10             	add    $0x10,%esp
+     5f5:	85 c0                	test   %eax,%eax
+     5f7:	0f 89 3e ff ff ff    	jns    53b <bufwrite+0x5a>
+    return -1;
+     5fd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     602:	eb 8f                	jmp    593 <bufwrite+0xb2>
+    return write(fd, p, n);
+     604:	83 ec 04             	sub    $0x4,%esp
+     607:	53                   	push   %ebx
+     608:	ff 75 0c             	push   0xc(%ebp)
+     60b:	56                   	push   %esi
+     60c:	e8 af 01 00 00       	call   7c0 <write>
+     611:	83 c4 10             	add    $0x10,%esp
+     614:	e9 7a ff ff ff       	jmp    593 <bufwrite+0xb2>
+    return flush(fd) < 0 ? -1 : n;
+     619:	83 ec 0c             	sub    $0xc,%esp
+     61c:	56                   	push   %esi
+     61d:	e8 08 fe ff ff       	call   42a <flush>
+     622:	83 c4 10             	add    $0x10,%esp
+     625:	85 c0                	test   %eax,%eax
+     627:	78 07                	js     630 <bufwrite+0x14f>
+     629:	89 d8                	mov    %ebx,%eax
+     62b:	e9 63 ff ff ff       	jmp    593 <bufwrite+0xb2>
+     630:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     635:	e9 59 ff ff ff       	jmp    593 <bufwrite+0xb2>
+        return flush(fd) < 0 ? -1 : n;
+     63a:	83 ec 0c             	sub    $0xc,%esp
+     63d:	56                   	push   %esi
+     63e:	e8 e7 fd ff ff       	call   42a <flush>
+     643:	83 c4 10             	add    $0x10,%esp
+     646:	85 c0                	test   %eax,%eax
+     648:	78 07                	js     651 <bufwrite+0x170>
+     64a:	89 d8                	mov    %ebx,%eax
+     64c:	e9 42 ff ff ff       	jmp    593 <bufwrite+0xb2>
+     651:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     656:	e9 38 ff ff ff       	jmp    593 <bufwrite+0xb2>
+    for(s = p, i = 0; i < n; i++)
+     65b:	b8 00 00 00 00       	mov    $0x0,%eax
+     660:	39 d8                	cmp    %ebx,%eax
+     662:	7d 0e                	jge    672 <bufwrite+0x191>
+      if(s[i] == '\n')
+     664:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     667:	80 3c 01 0a          	cmpb   $0xa,(%ecx,%eax,1)
+     66b:	74 cd                	je     63a <bufwrite+0x159>
+    for(s = p, i = 0; i < n; i++)
+     66d:	83 c0 01             	add    $0x1,%eax
+     670:	eb ee                	jmp    660 <bufwrite+0x17f>
+  return n;
+     672:	89 d8                	mov    %ebx,%eax
+     674:	e9 1a ff ff ff       	jmp    593 <bufwrite+0xb2>
+
+00000679 <fork>:
+
+int
+fork(void)
+{
+     679:	55                   	push   %ebp
+     67a:	89 e5                	mov    %esp,%ebp
+     67c:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     67f:	6a ff                	push   $0xffffffff
+     681:	e8 a4 fd ff ff       	call   42a <flush>
+  return _fork();
+     686:	e8 bd 00 00 00       	call   748 <_fork>
+}
+     68b:	c9                   	leave
+     68c:	c3                   	ret
+
+0000068d <exit>:
+
+int
+exit(void)
+{
+     68d:	55                   	push   %ebp
+     68e:	89 e5                	mov    %esp,%ebp
+     690:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     693:	6a ff                	push   $0xffffffff
+     695:	e8 90 fd ff ff       	call   42a <flush>
+  _exit();
+     69a:	e8 b8 00 00 00       	call   757 <_exit>
+
+0000069f <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     69f:	55                   	push   %ebp
+     6a0:	89 e5                	mov    %esp,%ebp
+     6a2:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     6a5:	6a ff                	push   $0xffffffff
+     6a7:	e8 7e fd ff ff       	call   42a <flush>
+  return _exec(path, argv);
+     6ac:	83 c4 08             	add    $0x8,%esp
+     6af:	ff 75 0c             	push   0xc(%ebp)
+     6b2:	ff 75 08             	push   0x8(%ebp)
+     6b5:	e8 bb 00 00 00       	call   775 <_exec>
+}
+     6ba:	c9                   	leave
+     6bb:	c3                   	ret
+
+000006bc <close>:
+
+int
+close(int fd)
+{
+     6bc:	55                   	push   %ebp
+     6bd:	89 e5                	mov    %esp,%ebp
+     6bf:	53                   	push   %ebx
+     6c0:	83 ec 04             	sub    $0x4,%esp
+     6c3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bufreset(fd);
+     6c6:	89 d8                	mov    %ebx,%eax
+     6c8:	e8 e7 fd ff ff       	call   4b4 <bufreset>
+  return _close(fd);
+     6cd:	83 ec 0c             	sub    $0xc,%esp
+     6d0:	53                   	push   %ebx
+     6d1:	e8 90 00 00 00       	call   766 <_close>
+}
+     6d6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6d9:	c9                   	leave
+     6da:	c3                   	ret
+
+000006db <stat>:
+{
+     6db:	55                   	push   %ebp
+     6dc:	89 e5                	mov    %esp,%ebp
+     6de:	56                   	push   %esi
+     6df:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     6e0:	83 ec 08             	sub    $0x8,%esp
+     6e3:	6a 00                	push   $0x0
+     6e5:	ff 75 08             	push   0x8(%ebp)
+     6e8:	e8 f1 00 00 00       	call   7de <open>
+  if(fd < 0)
+     6ed:	83 c4 10             	add    $0x10,%esp
+     6f0:	85 c0                	test   %eax,%eax
+     6f2:	78 24                	js     718 <stat+0x3d>
+     6f4:	89 c3                	mov    %eax,%ebx
+  r = fstat(fd, st);
+     6f6:	83 ec 08             	sub    $0x8,%esp
+     6f9:	ff 75 0c             	push   0xc(%ebp)
+     6fc:	50                   	push   %eax
+     6fd:	e8 09 01 00 00       	call   80b <fstat>
+     702:	89 c6                	mov    %eax,%esi
+  close(fd);
+     704:	89 1c 24             	mov    %ebx,(%esp)
+     707:	e8 b0 ff ff ff       	call   6bc <close>
+  return r;
+     70c:	83 c4 10             	add    $0x10,%esp
+}
+     70f:	89 f0                	mov    %esi,%eax
+     711:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     714:	5b                   	pop    %ebx
+     715:	5e                   	pop    %esi
+     716:	5d                   	pop    %ebp
+     717:	c3                   	ret
+    return -1;
+     718:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     71d:	eb f0                	jmp    70f <stat+0x34>
+
+0000071f <dup2>:
+
+int
+dup2(int oldfd, int newfd)
+{
+     71f:	55                   	push   %ebp
+     720:	89 e5                	mov    %esp,%ebp
+     722:	56                   	push   %esi
+     723:	53                   	push   %ebx
+     724:	8b 75 08             	mov    0x8(%ebp),%esi
+     727:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(oldfd != newfd)
+     72a:	39 de                	cmp    %ebx,%esi
+     72c:	75 11                	jne    73f <dup2+0x20>
+    bufreset(newfd);
+  return _dup2(oldfd, newfd);
+     72e:	83 ec 08             	sub    $0x8,%esp
+     731:	53                   	push   %ebx
+     732:	56                   	push   %esi
+     733:	e8 4c 00 00 00       	call   784 <_dup2>
+}
+     738:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     73b:	5b                   	pop    %ebx
+     73c:	5e                   	pop    %esi
+     73d:	5d                   	pop    %ebp
+     73e:	c3                   	ret
+    bufreset(newfd);
+     73f:	89 d8                	mov    %ebx,%eax
+     741:	e8 6e fd ff ff       	call   4b4 <bufreset>
+     746:	eb e6                	jmp    72e <dup2+0xf>
+
+00000748 <_fork>:
+  1: ret
+
+#define SYSCALL(name) STUB(name, SYS_ ## name)
+
+# ulib.c wraps these, to flush printf()'s buffers first.
+STUB(_fork, SYS_fork)
+     748:	b8 01 00 00 00       	mov    $0x1,%eax
+     74d:	89 e1                	mov    %esp,%ecx
+     74f:	ba 56 07 00 00       	mov    $0x756,%edx
+     754:	0f 34                	sysenter
+     756:	c3                   	ret
+
+00000757 <_exit>:
+STUB(_exit, SYS_exit)
+     757:	b8 02 00 00 00       	mov    $0x2,%eax
+     75c:	89 e1                	mov    %esp,%ecx
+     75e:	ba 65 07 00 00       	mov    $0x765,%edx
+     763:	0f 34                	sysenter
+     765:	c3                   	ret
+
+00000766 <_close>:
+STUB(_close, SYS_close)
+     766:	b8 15 00 00 00       	mov    $0x15,%eax
+     76b:	89 e1                	mov    %esp,%ecx
+     76d:	ba 74 07 00 00       	mov    $0x774,%edx
+     772:	0f 34                	sysenter
+     774:	c3                   	ret
+
+00000775 <_exec>:
+STUB(_exec, SYS_exec)
+     775:	b8 07 00 00 00       	mov    $0x7,%eax
+     77a:	89 e1                	mov    %esp,%ecx
+     77c:	ba 83 07 00 00       	mov    $0x783,%edx
+     781:	0f 34                	sysenter
+     783:	c3                   	ret
+
+00000784 <_dup2>:
+STUB(_dup2, SYS_dup2)
+     784:	b8 17 00 00 00       	mov    $0x17,%eax
+     789:	89 e1                	mov    %esp,%ecx
+     78b:	ba 92 07 00 00       	mov    $0x792,%edx
+     790:	0f 34                	sysenter
+     792:	c3                   	ret
+
+00000793 <wait>:
+
+SYSCALL(wait)
+     793:	b8 03 00 00 00       	mov    $0x3,%eax
+     798:	89 e1                	mov    %esp,%ecx
+     79a:	ba a1 07 00 00       	mov    $0x7a1,%edx
+     79f:	0f 34                	sysenter
+     7a1:	c3                   	ret
+
+000007a2 <pipe>:
+SYSCALL(pipe)
+     7a2:	b8 04 00 00 00       	mov    $0x4,%eax
+     7a7:	89 e1                	mov    %esp,%ecx
+     7a9:	ba b0 07 00 00       	mov    $0x7b0,%edx
+     7ae:	0f 34                	sysenter
+     7b0:	c3                   	ret
+
+000007b1 <read>:
+SYSCALL(read)
+     7b1:	b8 05 00 00 00       	mov    $0x5,%eax
+     7b6:	89 e1                	mov    %esp,%ecx
+     7b8:	ba bf 07 00 00       	mov    $0x7bf,%edx
+     7bd:	0f 34                	sysenter
+     7bf:	c3                   	ret
+
+000007c0 <write>:
+SYSCALL(write)
+     7c0:	b8 10 00 00 00       	mov    $0x10,%eax
+     7c5:	89 e1                	mov    %esp,%ecx
+     7c7:	ba ce 07 00 00       	mov    $0x7ce,%edx
+     7cc:	0f 34                	sysenter
+     7ce:	c3                   	ret
+
+000007cf <kill>:
+SYSCALL(kill)
+     7cf:	b8 06 00 00 00       	mov    $0x6,%eax
+     7d4:	89 e1                	mov    %esp,%ecx
+     7d6:	ba dd 07 00 00       	mov    $0x7dd,%edx
+     7db:	0f 34                	sysenter
+     7dd:	c3                   	ret
+
+000007de <open>:
+SYSCALL(open)
+     7de:	b8 0f 00 00 00       	mov    $0xf,%eax
+     7e3:	89 e1                	mov    %esp,%ecx
+     7e5:	ba ec 07 00 00       	mov    $0x7ec,%edx
+     7ea:	0f 34                	sysenter
+     7ec:	c3                   	ret
+
+000007ed <mknod>:
+SYSCALL(mknod)
+     7ed:	b8 11 00 00 00       	mov    $0x11,%eax
+     7f2:	89 e1                	mov    %esp,%ecx
+     7f4:	ba fb 07 00 00       	mov    $0x7fb,%edx
+     7f9:	0f 34                	sysenter
+     7fb:	c3                   	ret
+
+000007fc <unlink>:
+SYSCALL(unlink)
+     7fc:	b8 12 00 00 00       	mov    $0x12,%eax
+     801:	89 e1                	mov    %esp,%ecx
+     803:	ba 0a 08 00 00       	mov    $0x80a,%edx
+     808:	0f 34                	sysenter
+     80a:	c3                   	ret
+
+0000080b <fstat>:
+SYSCALL(fstat)
+     80b:	b8 08 00 00 00       	mov    $0x8,%eax
+     810:	89 e1                	mov    %esp,%ecx
+     812:	ba 19 08 00 00       	mov    $0x819,%edx
+     817:	0f 34                	sysenter
+     819:	c3                   	ret
+
+0000081a <link>:
+SYSCALL(link)
+     81a:	b8 13 00 00 00       	mov    $0x13,%eax
+     81f:	89 e1                	mov    %esp,%ecx
+     821:	ba 28 08 00 00       	mov    $0x828,%edx
+     826:	0f 34                	sysenter
+     828:	c3                   	ret
+
+00000829 <mkdir>:
+SYSCALL(mkdir)
+     829:	b8 14 00 00 00       	mov    $0x14,%eax
+     82e:	89 e1                	mov    %esp,%ecx
+     830:	ba 37 08 00 00       	mov    $0x837,%edx
+     835:	0f 34                	sysenter
+     837:	c3                   	ret
+
+00000838 <chdir>:
+SYSCALL(chdir)
+     838:	b8 09 00 00 00       	mov    $0x9,%eax
+     83d:	89 e1                	mov    %esp,%ecx
+     83f:	ba 46 08 00 00       	mov    $0x846,%edx
+     844:	0f 34                	sysenter
+     846:	c3                   	ret
+
+00000847 <dup>:
+SYSCALL(dup)
+     847:	b8 0a 00 00 00       	mov    $0xa,%eax
+     84c:	89 e1                	mov    %esp,%ecx
+     84e:	ba 55 08 00 00       	mov    $0x855,%edx
+     853:	0f 34                	sysenter
+     855:	c3                   	ret
+
+00000856 <getpid>:
+SYSCALL(getpid)
+     856:	b8 0b 00 00 00       	mov    $0xb,%eax
+     85b:	89 e1                	mov    %esp,%ecx
+     85d:	ba 64 08 00 00       	mov    $0x864,%edx
+     862:	0f 34                	sysenter
+     864:	c3                   	ret
+
+00000865 <sbrk>:
+SYSCALL(sbrk)
+     865:	b8 0c 00 00 00       	mov    $0xc,%eax
+     86a:	89 e1                	mov    %esp,%ecx
+     86c:	ba 73 08 00 00       	mov    $0x873,%edx
+     871:	0f 34                	sysenter
+     873:	c3                   	ret
+
+00000874 <sleep>:
+SYSCALL(sleep)
+     874:	b8 0d 00 00 00       	mov    $0xd,%eax
+     879:	89 e1                	mov    %esp,%ecx
+     87b:	ba 82 08 00 00       	mov    $0x882,%edx
+     880:	0f 34                	sysenter
+     882:	c3                   	ret
+
+00000883 <uptime>:
+SYSCALL(uptime)
+     883:	b8 0e 00 00 00       	mov    $0xe,%eax
+     888:	89 e1                	mov    %esp,%ecx
+     88a:	ba 91 08 00 00       	mov    $0x891,%edx
+     88f:	0f 34                	sysenter
+     891:	c3                   	ret
+
+00000892 <date>:
+SYSCALL(date)
+     892:	b8 16 00 00 00       	mov    $0x16,%eax
+     897:	89 e1                	mov    %esp,%ecx
+     899:	ba a0 08 00 00       	mov    $0x8a0,%edx
+     89e:	0f 34                	sysenter
+     8a0:	c3                   	ret
+
+000008a1 <faultaround>:
+SYSCALL(faultaround)
+     8a1:	b8 18 00 00 00       	mov    $0x18,%eax
+     8a6:	89 e1                	mov    %esp,%ecx
+     8a8:	ba af 08 00 00       	mov    $0x8af,%edx
+     8ad:	0f 34                	sysenter
+     8af:	c3                   	ret
+
+000008b0 <faultstat>:
+SYSCALL(faultstat)
+     8b0:	b8 19 00 00 00       	mov    $0x19,%eax
+     8b5:	89 e1                	mov    %esp,%ecx
+     8b7:	ba be 08 00 00       	mov    $0x8be,%edx
+     8bc:	0f 34                	sysenter
+     8be:	c3                   	ret
+
+000008bf <mmap>:
+SYSCALL(mmap)
+     8bf:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     8c4:	89 e1                	mov    %esp,%ecx
+     8c6:	ba cd 08 00 00       	mov    $0x8cd,%edx
+     8cb:	0f 34                	sysenter
+     8cd:	c3                   	ret
+
+000008ce <munmap>:
+SYSCALL(munmap)
+     8ce:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     8d3:	89 e1                	mov    %esp,%ecx
+     8d5:	ba dc 08 00 00       	mov    $0x8dc,%edx
+     8da:	0f 34                	sysenter
+     8dc:	c3                   	ret
+
+000008dd <largepages>:
+SYSCALL(largepages)
+     8dd:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     8e2:	89 e1                	mov    %esp,%ecx
+     8e4:	ba eb 08 00 00       	mov    $0x8eb,%edx
+     8e9:	0f 34                	sysenter
+     8eb:	c3                   	ret
+
+000008ec <spawn>:
+SYSCALL(spawn)
+     8ec:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     8f1:	89 e1                	mov    %esp,%ecx
+     8f3:	ba fa 08 00 00       	mov    $0x8fa,%edx
+     8f8:	0f 34                	sysenter
+     8fa:	c3                   	ret
+
+000008fb <setpriority>:
+SYSCALL(setpriority)
+     8fb:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     900:	89 e1                	mov    %esp,%ecx
+     902:	ba 09 09 00 00       	mov    $0x909,%edx
+     907:	0f 34                	sysenter
+     909:	c3                   	ret
+
+0000090a <getpriority>:
+SYSCALL(getpriority)
+     90a:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     90f:	89 e1                	mov    %esp,%ecx
+     911:	ba 18 09 00 00       	mov    $0x918,%edx
+     916:	0f 34                	sysenter
+     918:	c3                   	ret
+
+00000919 <getprocinfo>:
+SYSCALL(getprocinfo)
+     919:	b8 20 00 00 00       	mov    $0x20,%eax
+     91e:	89 e1                	mov    %esp,%ecx
+     920:	ba 27 09 00 00       	mov    $0x927,%edx
+     925:	0f 34                	sysenter
+     927:	c3                   	ret
+
+00000928 <getcpuinfo>:
+SYSCALL(getcpuinfo)
+     928:	b8 21 00 00 00       	mov    $0x21,%eax
+     92d:	89 e1                	mov    %esp,%ecx
+     92f:	ba 36 09 00 00       	mov    $0x936,%edx
+     934:	0f 34                	sysenter
+     936:	c3                   	ret
+
+00000937 <clone>:
+SYSCALL(clone)
+     937:	b8 22 00 00 00       	mov    $0x22,%eax
+     93c:	89 e1                	mov    %esp,%ecx
+     93e:	ba 45 09 00 00       	mov    $0x945,%edx
+     943:	0f 34                	sysenter
+     945:	c3                   	ret
+
+00000946 <join>:
+SYSCALL(join)
+     946:	b8 23 00 00 00       	mov    $0x23,%eax
+     94b:	89 e1                	mov    %esp,%ecx
+     94d:	ba 54 09 00 00       	mov    $0x954,%edx
+     952:	0f 34                	sysenter
+     954:	c3                   	ret
+
+00000955 <futex_wait>:
+SYSCALL(futex_wait)
+     955:	b8 24 00 00 00       	mov    $0x24,%eax
+     95a:	89 e1                	mov    %esp,%ecx
+     95c:	ba 63 09 00 00       	mov    $0x963,%edx
+     961:	0f 34                	sysenter
+     963:	c3                   	ret
+
+00000964 <futex_wake>:
+SYSCALL(futex_wake)
+     964:	b8 25 00 00 00       	mov    $0x25,%eax
+     969:	89 e1                	mov    %esp,%ecx
+     96b:	ba 72 09 00 00       	mov    $0x972,%edx
+     970:	0f 34                	sysenter
+     972:	c3                   	ret
+
+00000973 <setaffinity>:
+SYSCALL(setaffinity)
+     973:	b8 26 00 00 00       	mov    $0x26,%eax
+     978:	89 e1                	mov    %esp,%ecx
+     97a:	ba 81 09 00 00       	mov    $0x981,%edx
+     97f:	0f 34                	sysenter
+     981:	c3                   	ret
+
+00000982 <getaffinity>:
+SYSCALL(getaffinity)
+     982:	b8 27 00 00 00       	mov    $0x27,%eax
+     987:	89 e1                	mov    %esp,%ecx
+     989:	ba 90 09 00 00       	mov    $0x990,%edx
+     98e:	0f 34                	sysenter
+     990:	c3                   	ret
+
+00000991 <clock_gettime>:
+SYSCALL(clock_gettime)
+     991:	b8 28 00 00 00       	mov    $0x28,%eax
+     996:	89 e1                	mov    %esp,%ecx
+     998:	ba 9f 09 00 00       	mov    $0x99f,%edx
+     99d:	0f 34                	sysenter
+     99f:	c3                   	ret
+
+000009a0 <msleep>:
+SYSCALL(msleep)
+     9a0:	b8 29 00 00 00       	mov    $0x29,%eax
+     9a5:	89 e1                	mov    %esp,%ecx
+     9a7:	ba ae 09 00 00       	mov    $0x9ae,%edx
+     9ac:	0f 34                	sysenter
+     9ae:	c3                   	ret
+
+000009af <lockstat>:
+SYSCALL(lockstat)
+     9af:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     9b4:	89 e1                	mov    %esp,%ecx
+     9b6:	ba bd 09 00 00       	mov    $0x9bd,%edx
+     9bb:	0f 34                	sysenter
+     9bd:	c3                   	ret
+
+000009be <bstat>:
+SYSCALL(bstat)
+     9be:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     9c3:	89 e1                	mov    %esp,%ecx
+     9c5:	ba cc 09 00 00       	mov    $0x9cc,%edx
+     9ca:	0f 34                	sysenter
+     9cc:	c3                   	ret
+
+000009cd <iostat>:
+SYSCALL(iostat)
+     9cd:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     9d2:	89 e1                	mov    %esp,%ecx
+     9d4:	ba db 09 00 00       	mov    $0x9db,%edx
+     9d9:	0f 34                	sysenter
+     9db:	c3                   	ret
+
+000009dc <fsync>:
+SYSCALL(fsync)
+     9dc:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     9e1:	89 e1                	mov    %esp,%ecx
+     9e3:	ba ea 09 00 00       	mov    $0x9ea,%edx
+     9e8:	0f 34                	sysenter
+     9ea:	c3                   	ret
+
+000009eb <pread>:
+SYSCALL(pread)
+     9eb:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     9f0:	89 e1                	mov    %esp,%ecx
+     9f2:	ba f9 09 00 00       	mov    $0x9f9,%edx
+     9f7:	0f 34                	sysenter
+     9f9:	c3                   	ret
+
+000009fa <pwrite>:
+SYSCALL(pwrite)
+     9fa:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     9ff:	89 e1                	mov    %esp,%ecx
+     a01:	ba 08 0a 00 00       	mov    $0xa08,%edx
+     a06:	0f 34                	sysenter
+     a08:	c3                   	ret
+
+00000a09 <readv>:
+SYSCALL(readv)
+     a09:	b8 30 00 00 00       	mov    $0x30,%eax
+     a0e:	89 e1                	mov    %esp,%ecx
+     a10:	ba 17 0a 00 00       	mov    $0xa17,%edx
+     a15:	0f 34                	sysenter
+     a17:	c3                   	ret
+
+00000a18 <writev>:
+SYSCALL(writev)
+     a18:	b8 31 00 00 00       	mov    $0x31,%eax
+     a1d:	89 e1                	mov    %esp,%ecx
+     a1f:	ba 26 0a 00 00       	mov    $0xa26,%edx
+     a24:	0f 34                	sysenter
+     a26:	c3                   	ret
+
+00000a27 <sendfile>:
+SYSCALL(sendfile)
+     a27:	b8 32 00 00 00       	mov    $0x32,%eax
+     a2c:	89 e1                	mov    %esp,%ecx
+     a2e:	ba 35 0a 00 00       	mov    $0xa35,%edx
+     a33:	0f 34                	sysenter
+     a35:	c3                   	ret
+
+00000a36 <fcntl>:
+SYSCALL(fcntl)
+     a36:	b8 33 00 00 00       	mov    $0x33,%eax
+     a3b:	89 e1                	mov    %esp,%ecx
+     a3d:	ba 44 0a 00 00       	mov    $0xa44,%edx
+     a42:	0f 34                	sysenter
+     a44:	c3                   	ret
+
+00000a45 <mount>:
+SYSCALL(mount)
+     a45:	b8 34 00 00 00       	mov    $0x34,%eax
+     a4a:	89 e1                	mov    %esp,%ecx
+     a4c:	ba 53 0a 00 00       	mov    $0xa53,%edx
+     a51:	0f 34                	sysenter
+     a53:	c3                   	ret
+
+00000a54 <getdents>:
+SYSCALL(getdents)
+     a54:	b8 35 00 00 00       	mov    $0x35,%eax
+     a59:	89 e1                	mov    %esp,%ecx
+     a5b:	ba 62 0a 00 00       	mov    $0xa62,%edx
+     a60:	0f 34                	sysenter
+     a62:	c3                   	ret
+
+00000a63 <fstatat>:
+SYSCALL(fstatat)
+     a63:	b8 36 00 00 00       	mov    $0x36,%eax
+     a68:	89 e1                	mov    %esp,%ecx
+     a6a:	ba 71 0a 00 00       	mov    $0xa71,%edx
+     a6f:	0f 34                	sysenter
+     a71:	c3                   	ret
+
+00000a72 <sysstat>:
+SYSCALL(sysstat)
+     a72:	b8 37 00 00 00       	mov    $0x37,%eax
+     a77:	89 e1                	mov    %esp,%ecx
+     a79:	ba 80 0a 00 00       	mov    $0xa80,%edx
+     a7e:	0f 34                	sysenter
+     a80:	c3                   	ret
+
+00000a81 <ringenter>:
+SYSCALL(ringenter)
+     a81:	b8 38 00 00 00       	mov    $0x38,%eax
+     a86:	89 e1                	mov    %esp,%ecx
+     a88:	ba 8f 0a 00 00       	mov    $0xa8f,%edx
+     a8d:	0f 34                	sysenter
+     a8f:	c3                   	ret
+
+00000a90 <trace>:
+SYSCALL(trace)
+     a90:	b8 39 00 00 00       	mov    $0x39,%eax
+     a95:	89 e1                	mov    %esp,%ecx
+     a97:	ba 9e 0a 00 00       	mov    $0xa9e,%edx
+     a9c:	0f 34                	sysenter
+     a9e:	c3                   	ret
+
+00000a9f <memstat>:
+SYSCALL(memstat)
+     a9f:	b8 3a 00 00 00       	mov    $0x3a,%eax
+     aa4:	89 e1                	mov    %esp,%ecx
+     aa6:	ba ad 0a 00 00       	mov    $0xaad,%edx
+     aab:	0f 34                	sysenter
+     aad:	c3                   	ret
+
+00000aae <shmget>:
+SYSCALL(shmget)
+     aae:	b8 3b 00 00 00       	mov    $0x3b,%eax
+     ab3:	89 e1                	mov    %esp,%ecx
+     ab5:	ba bc 0a 00 00       	mov    $0xabc,%edx
+     aba:	0f 34                	sysenter
+     abc:	c3                   	ret
+
+00000abd <shmat>:
+SYSCALL(shmat)
+     abd:	b8 3c 00 00 00       	mov    $0x3c,%eax
+     ac2:	89 e1                	mov    %esp,%ecx
+     ac4:	ba cb 0a 00 00       	mov    $0xacb,%edx
+     ac9:	0f 34                	sysenter
+     acb:	c3                   	ret
+
+00000acc <shmdt>:
+SYSCALL(shmdt)
+     acc:	b8 3d 00 00 00       	mov    $0x3d,%eax
+     ad1:	89 e1                	mov    %esp,%ecx
+     ad3:	ba da 0a 00 00       	mov    $0xada,%edx
+     ad8:	0f 34                	sysenter
+     ada:	c3                   	ret
+
+00000adb <irqstat>:
+SYSCALL(irqstat)
+     adb:	b8 3e 00 00 00       	mov    $0x3e,%eax
+     ae0:	89 e1                	mov    %esp,%ecx
+     ae2:	ba e9 0a 00 00       	mov    $0xae9,%edx
+     ae7:	0f 34                	sysenter
+     ae9:	c3                   	ret
+
+00000aea <irqroute>:
+SYSCALL(irqroute)
+     aea:	b8 3f 00 00 00       	mov    $0x3f,%eax
+     aef:	89 e1                	mov    %esp,%ecx
+     af1:	ba f8 0a 00 00       	mov    $0xaf8,%edx
+     af6:	0f 34                	sysenter
+     af8:	c3                   	ret
+
+00000af9 <putc>:
+  char buf[64];
+};
+
+static void
+putc(struct out *o, char c)
+{
+     af9:	55                   	push   %ebp
+     afa:	89 e5                	mov    %esp,%ebp
+     afc:	56                   	push   %esi
+     afd:	53                   	push   %ebx
+     afe:	89 c3                	mov    %eax,%ebx
+     b00:	89 d6                	mov    %edx,%esi
+  if(o->n == sizeof(o->buf)){
+     b02:	8b 40 04             	mov    0x4(%eax),%eax
+     b05:	83 f8 40             	cmp    $0x40,%eax
+     b08:	74 16                	je     b20 <putc+0x27>
+    bufwrite(o->fd, o->buf, o->n);
+    o->n = 0;
+  }
+  o->buf[o->n++] = c;
+     b0a:	8b 43 04             	mov    0x4(%ebx),%eax
+     b0d:	8d 50 01             	lea    0x1(%eax),%edx
+     b10:	89 53 04             	mov    %edx,0x4(%ebx)
+     b13:	89 f1                	mov    %esi,%ecx
+     b15:	88 4c 03 08          	mov    %cl,0x8(%ebx,%eax,1)
+}
+     b19:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b1c:	5b                   	pop    %ebx
+     b1d:	5e                   	pop    %esi
+     b1e:	5d                   	pop    %ebp
+     b1f:	c3                   	ret
+    bufwrite(o->fd, o->buf, o->n);
+     b20:	8d 53 08             	lea    0x8(%ebx),%edx
+     b23:	83 ec 04             	sub    $0x4,%esp
+     b26:	50                   	push   %eax
+     b27:	52                   	push   %edx
+     b28:	ff 33                	push   (%ebx)
+     b2a:	e8 b2 f9 ff ff       	call   4e1 <bufwrite>
+    o->n = 0;
+     b2f:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     b36:	83 c4 10             	add    $0x10,%esp
+     b39:	eb cf                	jmp    b0a <putc+0x11>
+
+00000b3b <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     b3b:	55                   	push   %ebp
+     b3c:	89 e5                	mov    %esp,%ebp
+     b3e:	57                   	push   %edi
+     b3f:	56                   	push   %esi
+     b40:	53                   	push   %ebx
+     b41:	83 ec 2c             	sub    $0x2c,%esp
+     b44:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     b47:	89 d0                	mov    %edx,%eax
+     b49:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+     b4b:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     b4f:	0f 95 c1             	setne  %cl
+     b52:	c1 ea 1f             	shr    $0x1f,%edx
+     b55:	84 d1                	test   %dl,%cl
+     b57:	74 44                	je     b9d <printint+0x62>
+    neg = 1;
+    x = -xx;
+     b59:	f7 d8                	neg    %eax
+     b5b:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+     b5d:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     b64:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+     b69:	89 c8                	mov    %ecx,%eax
+     b6b:	ba 00 00 00 00       	mov    $0x0,%edx
+     b70:	f7 f6                	div    %esi
+     b72:	89 df                	mov    %ebx,%edi
+     b74:	83 c3 01             	add    $0x1,%ebx
+     b77:	0f b6 92 5c 12 00 00 	movzbl 0x125c(%edx),%edx
+     b7e:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+     b82:	89 ca                	mov    %ecx,%edx
+     b84:	89 c1                	mov    %eax,%ecx
+     b86:	39 f2                	cmp    %esi,%edx
+     b88:	73 df                	jae    b69 <printint+0x2e>
+  if(neg)
+     b8a:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     b8e:	74 31                	je     bc1 <printint+0x86>
+    buf[i++] = '-';
+     b90:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+     b95:	8d 5f 02             	lea    0x2(%edi),%ebx
+     b98:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     b9b:	eb 17                	jmp    bb4 <printint+0x79>
+    x = xx;
+     b9d:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+     b9f:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     ba6:	eb bc                	jmp    b64 <printint+0x29>
+
+  while(--i >= 0)
+    putc(o, buf[i]);
+     ba8:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+     bad:	89 f0                	mov    %esi,%eax
+     baf:	e8 45 ff ff ff       	call   af9 <putc>
+  while(--i >= 0)
+     bb4:	83 eb 01             	sub    $0x1,%ebx
+     bb7:	79 ef                	jns    ba8 <printint+0x6d>
+}
+     bb9:	83 c4 2c             	add    $0x2c,%esp
+     bbc:	5b                   	pop    %ebx
+     bbd:	5e                   	pop    %esi
+     bbe:	5f                   	pop    %edi
+     bbf:	5d                   	pop    %ebp
+     bc0:	c3                   	ret
+     bc1:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     bc4:	eb ee                	jmp    bb4 <printint+0x79>
+
+00000bc6 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     bc6:	55                   	push   %ebp
+     bc7:	89 e5                	mov    %esp,%ebp
+     bc9:	57                   	push   %edi
+     bca:	56                   	push   %esi
+     bcb:	53                   	push   %ebx
+     bcc:	83 ec 6c             	sub    $0x6c,%esp
+  int c, i, state;
+  uint *ap;
+  struct out out, *o;
+
+  o = &out;
+  o->fd = fd;
+     bcf:	8b 45 08             	mov    0x8(%ebp),%eax
+     bd2:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  o->n = 0;
+     bd5:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+     bdc:	8d 45 10             	lea    0x10(%ebp),%eax
+     bdf:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  state = 0;
+     be2:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+     be7:	bb 00 00 00 00       	mov    $0x0,%ebx
+     bec:	eb 14                	jmp    c02 <printf+0x3c>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(o, c);
+     bee:	89 fa                	mov    %edi,%edx
+     bf0:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     bf3:	e8 01 ff ff ff       	call   af9 <putc>
+     bf8:	eb 05                	jmp    bff <printf+0x39>
+      }
+    } else if(state == '%'){
+     bfa:	83 fe 25             	cmp    $0x25,%esi
+     bfd:	74 25                	je     c24 <printf+0x5e>
+  for(i = 0; fmt[i]; i++){
+     bff:	83 c3 01             	add    $0x1,%ebx
+     c02:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c05:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+     c09:	84 c0                	test   %al,%al
+     c0b:	0f 84 20 01 00 00    	je     d31 <printf+0x16b>
+    c = fmt[i] & 0xff;
+     c11:	0f be f8             	movsbl %al,%edi
+     c14:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     c17:	85 f6                	test   %esi,%esi
+     c19:	75 df                	jne    bfa <printf+0x34>
+      if(c == '%'){
+     c1b:	83 f8 25             	cmp    $0x25,%eax
+     c1e:	75 ce                	jne    bee <printf+0x28>
+        state = '%';
+     c20:	89 c6                	mov    %eax,%esi
+     c22:	eb db                	jmp    bff <printf+0x39>
+      if(c == 'd'){
+     c24:	83 f8 25             	cmp    $0x25,%eax
+     c27:	0f 84 cf 00 00 00    	je     cfc <printf+0x136>
+     c2d:	0f 8c dd 00 00 00    	jl     d10 <printf+0x14a>
+     c33:	83 f8 78             	cmp    $0x78,%eax
+     c36:	0f 8f d4 00 00 00    	jg     d10 <printf+0x14a>
+     c3c:	83 f8 63             	cmp    $0x63,%eax
+     c3f:	0f 8c cb 00 00 00    	jl     d10 <printf+0x14a>
+     c45:	83 e8 63             	sub    $0x63,%eax
+     c48:	83 f8 15             	cmp    $0x15,%eax
+     c4b:	0f 87 bf 00 00 00    	ja     d10 <printf+0x14a>
+     c51:	ff 24 85 04 12 00 00 	jmp    *0x1204(,%eax,4)
+        printint(o, *ap, 10, 1);
+     c58:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     c5b:	8b 17                	mov    (%edi),%edx
+     c5d:	83 ec 0c             	sub    $0xc,%esp
+     c60:	6a 01                	push   $0x1
+     c62:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     c67:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     c6a:	e8 cc fe ff ff       	call   b3b <printint>
+        ap++;
+     c6f:	83 c7 04             	add    $0x4,%edi
+     c72:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     c75:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(o, '%');
+        putc(o, c);
+      }
+      state = 0;
+     c78:	be 00 00 00 00       	mov    $0x0,%esi
+     c7d:	eb 80                	jmp    bff <printf+0x39>
+        printint(o, *ap, 16, 0);
+     c7f:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     c82:	8b 17                	mov    (%edi),%edx
+     c84:	83 ec 0c             	sub    $0xc,%esp
+     c87:	6a 00                	push   $0x0
+     c89:	b9 10 00 00 00       	mov    $0x10,%ecx
+     c8e:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     c91:	e8 a5 fe ff ff       	call   b3b <printint>
+        ap++;
+     c96:	83 c7 04             	add    $0x4,%edi
+     c99:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     c9c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     c9f:	be 00 00 00 00       	mov    $0x0,%esi
+     ca4:	e9 56 ff ff ff       	jmp    bff <printf+0x39>
+        s = (char*)*ap;
+     ca9:	8b 45 94             	mov    -0x6c(%ebp),%eax
+     cac:	8b 30                	mov    (%eax),%esi
+        ap++;
+     cae:	83 c0 04             	add    $0x4,%eax
+     cb1:	89 45 94             	mov    %eax,-0x6c(%ebp)
+        if(s == 0)
+     cb4:	85 f6                	test   %esi,%esi
+     cb6:	75 15                	jne    ccd <printf+0x107>
+          s = "(null)";
+     cb8:	be fb 11 00 00       	mov    $0x11fb,%esi
+     cbd:	eb 0e                	jmp    ccd <printf+0x107>
+          putc(o, *s);
+     cbf:	0f be d2             	movsbl %dl,%edx
+     cc2:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     cc5:	e8 2f fe ff ff       	call   af9 <putc>
+          s++;
+     cca:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+     ccd:	0f b6 16             	movzbl (%esi),%edx
+     cd0:	84 d2                	test   %dl,%dl
+     cd2:	75 eb                	jne    cbf <printf+0xf9>
+      state = 0;
+     cd4:	be 00 00 00 00       	mov    $0x0,%esi
+     cd9:	e9 21 ff ff ff       	jmp    bff <printf+0x39>
+        putc(o, *ap);
+     cde:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     ce1:	0f be 17             	movsbl (%edi),%edx
+     ce4:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     ce7:	e8 0d fe ff ff       	call   af9 <putc>
+        ap++;
+     cec:	83 c7 04             	add    $0x4,%edi
+     cef:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+      state = 0;
+     cf2:	be 00 00 00 00       	mov    $0x0,%esi
+     cf7:	e9 03 ff ff ff       	jmp    bff <printf+0x39>
+        putc(o, c);
+     cfc:	89 fa                	mov    %edi,%edx
+     cfe:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d01:	e8 f3 fd ff ff       	call   af9 <putc>
+      state = 0;
+     d06:	be 00 00 00 00       	mov    $0x0,%esi
+     d0b:	e9 ef fe ff ff       	jmp    bff <printf+0x39>
+        putc(o, '%');
+     d10:	ba 25 00 00 00       	mov    $0x25,%edx
+     d15:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d18:	e8 dc fd ff ff       	call   af9 <putc>
+        putc(o, c);
+     d1d:	89 fa                	mov    %edi,%edx
+     d1f:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d22:	e8 d2 fd ff ff       	call   af9 <putc>
+      state = 0;
+     d27:	be 00 00 00 00       	mov    $0x0,%esi
+     d2c:	e9 ce fe ff ff       	jmp    bff <printf+0x39>
+    }
+  }
+  if(o->n > 0)
+     d31:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     d34:	85 c0                	test   %eax,%eax
+     d36:	7f 08                	jg     d40 <printf+0x17a>
+    bufwrite(fd, o->buf, o->n);
+}
+     d38:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d3b:	5b                   	pop    %ebx
+     d3c:	5e                   	pop    %esi
+     d3d:	5f                   	pop    %edi
+     d3e:	5d                   	pop    %ebp
+     d3f:	c3                   	ret
+    bufwrite(fd, o->buf, o->n);
+     d40:	83 ec 04             	sub    $0x4,%esp
+     d43:	50                   	push   %eax
+     d44:	8d 45 a8             	lea    -0x58(%ebp),%eax
+     d47:	50                   	push   %eax
+     d48:	ff 75 08             	push   0x8(%ebp)
+     d4b:	e8 91 f7 ff ff       	call   4e1 <bufwrite>
+     d50:	83 c4 10             	add    $0x10,%esp
+}
+     d53:	eb e3                	jmp    d38 <printf+0x172>
+
+00000d55 <largefree>:
+  return &b->h;
+}
+
+static void
+largefree(Fblock *b)
+{
+     d55:	55                   	push   %ebp
+     d56:	89 e5                	mov    %esp,%ebp
+     d58:	57                   	push   %edi
+     d59:	56                   	push   %esi
+     d5a:	53                   	push   %ebx
+     d5b:	83 ec 0c             	sub    $0xc,%esp
+     d5e:	89 c1                	mov    %eax,%ecx
+  Fblock **pp, *p, *prev;
+
+  prev = 0;
+     d60:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     d65:	ba ac 39 00 00       	mov    $0x39ac,%edx
+     d6a:	eb 05                	jmp    d71 <largefree+0x1c>
+     d6c:	8d 50 08             	lea    0x8(%eax),%edx
+    prev = p;
+     d6f:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     d71:	8b 02                	mov    (%edx),%eax
+     d73:	85 c0                	test   %eax,%eax
+     d75:	74 04                	je     d7b <largefree+0x26>
+     d77:	39 c8                	cmp    %ecx,%eax
+     d79:	72 f1                	jb     d6c <largefree+0x17>
+  b->next = p;
+     d7b:	89 41 08             	mov    %eax,0x8(%ecx)
+  if(p && (char*)b + b->h.size == (char*)p){
+     d7e:	85 c0                	test   %eax,%eax
+     d80:	74 09                	je     d8b <largefree+0x36>
+     d82:	8b 31                	mov    (%ecx),%esi
+     d84:	8d 3c 31             	lea    (%ecx,%esi,1),%edi
+     d87:	39 c7                	cmp    %eax,%edi
+     d89:	74 21                	je     dac <largefree+0x57>
+    b->h.size += p->h.size;
+    b->next = p->next;
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+     d8b:	85 db                	test   %ebx,%ebx
+     d8d:	74 09                	je     d98 <largefree+0x43>
+     d8f:	8b 03                	mov    (%ebx),%eax
+     d91:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+     d94:	39 ce                	cmp    %ecx,%esi
+     d96:	74 20                	je     db8 <largefree+0x63>
+    prev->h.size += b->h.size;
+    prev->next = b->next;
+  } else
+    *pp = b;
+     d98:	89 0a                	mov    %ecx,(%edx)
+
+  // Give the top of the heap back.  With threads sharing the
+  // address space sbrk() cannot shrink it; keep the block then.
+  for(pp = &large; (*pp)->next; pp = &(*pp)->next)
+     d9a:	be ac 39 00 00       	mov    $0x39ac,%esi
+     d9f:	8b 1e                	mov    (%esi),%ebx
+     da1:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+     da5:	74 1d                	je     dc4 <largefree+0x6f>
+     da7:	8d 73 08             	lea    0x8(%ebx),%esi
+     daa:	eb f3                	jmp    d9f <largefree+0x4a>
+    b->h.size += p->h.size;
+     dac:	03 30                	add    (%eax),%esi
+     dae:	89 31                	mov    %esi,(%ecx)
+    b->next = p->next;
+     db0:	8b 40 08             	mov    0x8(%eax),%eax
+     db3:	89 41 08             	mov    %eax,0x8(%ecx)
+     db6:	eb d3                	jmp    d8b <largefree+0x36>
+    prev->h.size += b->h.size;
+     db8:	03 01                	add    (%ecx),%eax
+     dba:	89 03                	mov    %eax,(%ebx)
+    prev->next = b->next;
+     dbc:	8b 41 08             	mov    0x8(%ecx),%eax
+     dbf:	89 43 08             	mov    %eax,0x8(%ebx)
+     dc2:	eb d6                	jmp    d9a <largefree+0x45>
+    ;
+  b = *pp;
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     dc4:	89 df                	mov    %ebx,%edi
+     dc6:	03 3b                	add    (%ebx),%edi
+     dc8:	83 ec 0c             	sub    $0xc,%esp
+     dcb:	6a 00                	push   $0x0
+     dcd:	e8 93 fa ff ff       	call   865 <sbrk>
+     dd2:	83 c4 10             	add    $0x10,%esp
+     dd5:	39 c7                	cmp    %eax,%edi
+     dd7:	74 08                	je     de1 <largefree+0x8c>
+    *pp = 0;
+}
+     dd9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ddc:	5b                   	pop    %ebx
+     ddd:	5e                   	pop    %esi
+     dde:	5f                   	pop    %edi
+     ddf:	5d                   	pop    %ebp
+     de0:	c3                   	ret
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     de1:	8b 03                	mov    (%ebx),%eax
+     de3:	f7 d8                	neg    %eax
+     de5:	83 ec 0c             	sub    $0xc,%esp
+     de8:	50                   	push   %eax
+     de9:	e8 77 fa ff ff       	call   865 <sbrk>
+     dee:	83 c4 10             	add    $0x10,%esp
+     df1:	83 f8 ff             	cmp    $0xffffffff,%eax
+     df4:	74 e3                	je     dd9 <largefree+0x84>
+    *pp = 0;
+     df6:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+     dfc:	eb db                	jmp    dd9 <largefree+0x84>
+
+00000dfe <more>:
+{
+     dfe:	55                   	push   %ebp
+     dff:	89 e5                	mov    %esp,%ebp
+     e01:	56                   	push   %esi
+     e02:	53                   	push   %ebx
+     e03:	89 c6                	mov    %eax,%esi
+  pad = -(uint)sbrk(0) & 7;
+     e05:	83 ec 0c             	sub    $0xc,%esp
+     e08:	6a 00                	push   $0x0
+     e0a:	e8 56 fa ff ff       	call   865 <sbrk>
+     e0f:	f7 d8                	neg    %eax
+     e11:	89 c3                	mov    %eax,%ebx
+     e13:	83 e3 07             	and    $0x7,%ebx
+  if((p = sbrk(n + pad)) == (char*)-1)
+     e16:	01 de                	add    %ebx,%esi
+     e18:	89 34 24             	mov    %esi,(%esp)
+     e1b:	e8 45 fa ff ff       	call   865 <sbrk>
+     e20:	83 c4 10             	add    $0x10,%esp
+     e23:	83 f8 ff             	cmp    $0xffffffff,%eax
+     e26:	74 09                	je     e31 <more+0x33>
+  return p + pad;
+     e28:	01 d8                	add    %ebx,%eax
+}
+     e2a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e2d:	5b                   	pop    %ebx
+     e2e:	5e                   	pop    %esi
+     e2f:	5d                   	pop    %ebp
+     e30:	c3                   	ret
+    return 0;
+     e31:	b8 00 00 00 00       	mov    $0x0,%eax
+     e36:	eb f2                	jmp    e2a <more+0x2c>
+
+00000e38 <slaballoc>:
+{
+     e38:	55                   	push   %ebp
+     e39:	89 e5                	mov    %esp,%ebp
+     e3b:	56                   	push   %esi
+     e3c:	53                   	push   %ebx
+     e3d:	89 c6                	mov    %eax,%esi
+  n = 1 << (MINSHIFT + c);
+     e3f:	8d 48 04             	lea    0x4(%eax),%ecx
+     e42:	bb 01 00 00 00       	mov    $0x1,%ebx
+     e47:	d3 e3                	shl    %cl,%ebx
+  if(slab + n > slabend){
+     e49:	89 d8                	mov    %ebx,%eax
+     e4b:	03 05 a8 39 00 00    	add    0x39a8,%eax
+     e51:	39 05 a4 39 00 00    	cmp    %eax,0x39a4
+     e57:	72 17                	jb     e70 <slaballoc+0x38>
+  h = (Header*)slab;
+     e59:	a1 a8 39 00 00       	mov    0x39a8,%eax
+  slab += n;
+     e5e:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+     e61:	89 15 a8 39 00 00    	mov    %edx,0x39a8
+  h->size = n;
+     e67:	89 18                	mov    %ebx,(%eax)
+  h->class = c;
+     e69:	89 70 04             	mov    %esi,0x4(%eax)
+}
+     e6c:	5b                   	pop    %ebx
+     e6d:	5e                   	pop    %esi
+     e6e:	5d                   	pop    %ebp
+     e6f:	c3                   	ret
+    if((p = more(SLABSZ)) == 0)
+     e70:	b8 00 40 00 00       	mov    $0x4000,%eax
+     e75:	e8 84 ff ff ff       	call   dfe <more>
+     e7a:	85 c0                	test   %eax,%eax
+     e7c:	74 ee                	je     e6c <slaballoc+0x34>
+    if(p != slabend)
+     e7e:	39 05 a4 39 00 00    	cmp    %eax,0x39a4
+     e84:	74 05                	je     e8b <slaballoc+0x53>
+      slab = p;
+     e86:	a3 a8 39 00 00       	mov    %eax,0x39a8
+    slabend = p + SLABSZ;
+     e8b:	05 00 40 00 00       	add    $0x4000,%eax
+     e90:	a3 a4 39 00 00       	mov    %eax,0x39a4
+     e95:	eb c2                	jmp    e59 <slaballoc+0x21>
+
+00000e97 <largealloc>:
+{
+     e97:	55                   	push   %ebp
+     e98:	89 e5                	mov    %esp,%ebp
+     e9a:	56                   	push   %esi
+     e9b:	53                   	push   %ebx
+     e9c:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     e9e:	b9 ac 39 00 00       	mov    $0x39ac,%ecx
+     ea3:	8b 01                	mov    (%ecx),%eax
+     ea5:	85 c0                	test   %eax,%eax
+     ea7:	74 36                	je     edf <largealloc+0x48>
+    if(b->h.size < n)
+     ea9:	8b 10                	mov    (%eax),%edx
+     eab:	39 da                	cmp    %ebx,%edx
+     ead:	72 24                	jb     ed3 <largealloc+0x3c>
+    if(b->h.size - n > SMALLMAX){
+     eaf:	29 da                	sub    %ebx,%edx
+     eb1:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+     eb7:	76 1f                	jbe    ed8 <largealloc+0x41>
+      rest = (Fblock*)((char*)b + n);
+     eb9:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+      rest->h.size = b->h.size - n;
+     ebc:	89 16                	mov    %edx,(%esi)
+      rest->h.class = LARGE;
+     ebe:	c7 46 04 09 00 00 00 	movl   $0x9,0x4(%esi)
+      rest->next = b->next;
+     ec5:	8b 50 08             	mov    0x8(%eax),%edx
+     ec8:	89 56 08             	mov    %edx,0x8(%esi)
+      *pp = rest;
+     ecb:	89 31                	mov    %esi,(%ecx)
+      b->h.size = n;
+     ecd:	89 18                	mov    %ebx,(%eax)
+}
+     ecf:	5b                   	pop    %ebx
+     ed0:	5e                   	pop    %esi
+     ed1:	5d                   	pop    %ebp
+     ed2:	c3                   	ret
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     ed3:	8d 48 08             	lea    0x8(%eax),%ecx
+     ed6:	eb cb                	jmp    ea3 <largealloc+0xc>
+      *pp = b->next;
+     ed8:	8b 50 08             	mov    0x8(%eax),%edx
+     edb:	89 11                	mov    %edx,(%ecx)
+    return &b->h;
+     edd:	eb f0                	jmp    ecf <largealloc+0x38>
+  if((b = more(n)) == 0)
+     edf:	89 d8                	mov    %ebx,%eax
+     ee1:	e8 18 ff ff ff       	call   dfe <more>
+     ee6:	85 c0                	test   %eax,%eax
+     ee8:	74 e5                	je     ecf <largealloc+0x38>
+  b->h.size = n;
+     eea:	89 18                	mov    %ebx,(%eax)
+  b->h.class = LARGE;
+     eec:	c7 40 04 09 00 00 00 	movl   $0x9,0x4(%eax)
+  return &b->h;
+     ef3:	eb da                	jmp    ecf <largealloc+0x38>
+
+00000ef5 <free>:
+
+void
+free(void *ap)
+{
+     ef5:	55                   	push   %ebp
+     ef6:	89 e5                	mov    %esp,%ebp
+     ef8:	56                   	push   %esi
+     ef9:	53                   	push   %ebx
+     efa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+
+  if(ap == 0)
+     efd:	85 db                	test   %ebx,%ebx
+     eff:	74 3b                	je     f3c <free+0x47>
+    return;
+  h = (Header*)ap - 1;
+     f01:	8d 73 f8             	lea    -0x8(%ebx),%esi
+  lock_acquire(&lock);
+     f04:	83 ec 0c             	sub    $0xc,%esp
+     f07:	68 a0 39 00 00       	push   $0x39a0
+     f0c:	e8 9c 01 00 00       	call   10ad <lock_acquire>
+  if(h->class == LARGE)
+     f11:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     f14:	83 c4 10             	add    $0x10,%esp
+     f17:	83 f8 09             	cmp    $0x9,%eax
+     f1a:	74 27                	je     f43 <free+0x4e>
+    largefree((Fblock*)h);
+  else {
+    ((Fblock*)h)->next = freelist[h->class];
+     f1c:	8b 14 85 c0 39 00 00 	mov    0x39c0(,%eax,4),%edx
+     f23:	89 13                	mov    %edx,(%ebx)
+    freelist[h->class] = (Fblock*)h;
+     f25:	89 34 85 c0 39 00 00 	mov    %esi,0x39c0(,%eax,4)
+  }
+  lock_release(&lock);
+     f2c:	83 ec 0c             	sub    $0xc,%esp
+     f2f:	68 a0 39 00 00       	push   $0x39a0
+     f34:	e8 88 01 00 00       	call   10c1 <lock_release>
+     f39:	83 c4 10             	add    $0x10,%esp
+}
+     f3c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f3f:	5b                   	pop    %ebx
+     f40:	5e                   	pop    %esi
+     f41:	5d                   	pop    %ebp
+     f42:	c3                   	ret
+    largefree((Fblock*)h);
+     f43:	89 f0                	mov    %esi,%eax
+     f45:	e8 0b fe ff ff       	call   d55 <largefree>
+     f4a:	eb e0                	jmp    f2c <free+0x37>
+
+00000f4c <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     f4c:	55                   	push   %ebp
+     f4d:	89 e5                	mov    %esp,%ebp
+     f4f:	53                   	push   %ebx
+     f50:	83 ec 04             	sub    $0x4,%esp
+     f53:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+  uint n;
+  int c;
+
+  if(nbytes > 0x7fffffff - sizeof(Header) - 7)
+     f56:	81 fb f0 ff ff 7f    	cmp    $0x7ffffff0,%ebx
+     f5c:	0f 87 8b 00 00 00    	ja     fed <malloc+0xa1>
+    return 0;
+  n = (nbytes + sizeof(Header) + 7) & ~7;
+     f62:	83 c3 0f             	add    $0xf,%ebx
+     f65:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(n < sizeof(Fblock))
+     f68:	83 fb 0b             	cmp    $0xb,%ebx
+     f6b:	77 05                	ja     f72 <malloc+0x26>
+    n = sizeof(Fblock);
+     f6d:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  lock_acquire(&lock);
+     f72:	83 ec 0c             	sub    $0xc,%esp
+     f75:	68 a0 39 00 00       	push   $0x39a0
+     f7a:	e8 2e 01 00 00       	call   10ad <lock_acquire>
+  if(n <= SMALLMAX){
+     f7f:	83 c4 10             	add    $0x10,%esp
+     f82:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+     f88:	77 58                	ja     fe2 <malloc+0x96>
+    for(c = 0; (1 << (MINSHIFT + c)) < n; c++)
+     f8a:	ba 00 00 00 00       	mov    $0x0,%edx
+     f8f:	eb 03                	jmp    f94 <malloc+0x48>
+     f91:	83 c2 01             	add    $0x1,%edx
+     f94:	8d 4a 04             	lea    0x4(%edx),%ecx
+     f97:	b8 01 00 00 00       	mov    $0x1,%eax
+     f9c:	d3 e0                	shl    %cl,%eax
+     f9e:	39 d8                	cmp    %ebx,%eax
+     fa0:	72 ef                	jb     f91 <malloc+0x45>
+      ;
+    if(freelist[c]){
+     fa2:	8b 04 95 c0 39 00 00 	mov    0x39c0(,%edx,4),%eax
+     fa9:	85 c0                	test   %eax,%eax
+     fab:	74 2a                	je     fd7 <malloc+0x8b>
+      h = &freelist[c]->h;
+     fad:	89 c3                	mov    %eax,%ebx
+      freelist[c] = freelist[c]->next;
+     faf:	8b 40 08             	mov    0x8(%eax),%eax
+     fb2:	89 04 95 c0 39 00 00 	mov    %eax,0x39c0(,%edx,4)
+    } else
+      h = slaballoc(c);
+  } else
+    h = largealloc(n);
+  lock_release(&lock);
+     fb9:	83 ec 0c             	sub    $0xc,%esp
+     fbc:	68 a0 39 00 00       	push   $0x39a0
+     fc1:	e8 fb 00 00 00       	call   10c1 <lock_release>
+  return h ? (void*)(h + 1) : 0;
+     fc6:	83 c4 10             	add    $0x10,%esp
+     fc9:	85 db                	test   %ebx,%ebx
+     fcb:	74 03                	je     fd0 <malloc+0x84>
+     fcd:	83 c3 08             	add    $0x8,%ebx
+}
+     fd0:	89 d8                	mov    %ebx,%eax
+     fd2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     fd5:	c9                   	leave
+     fd6:	c3                   	ret
+      h = slaballoc(c);
+     fd7:	89 d0                	mov    %edx,%eax
+     fd9:	e8 5a fe ff ff       	call   e38 <slaballoc>
+     fde:	89 c3                	mov    %eax,%ebx
+     fe0:	eb d7                	jmp    fb9 <malloc+0x6d>
+    h = largealloc(n);
+     fe2:	89 d8                	mov    %ebx,%eax
+     fe4:	e8 ae fe ff ff       	call   e97 <largealloc>
+     fe9:	89 c3                	mov    %eax,%ebx
+     feb:	eb cc                	jmp    fb9 <malloc+0x6d>
+    return 0;
+     fed:	bb 00 00 00 00       	mov    $0x0,%ebx
+     ff2:	eb dc                	jmp    fd0 <malloc+0x84>
+
+00000ff4 <tstart>:
+  void *arg;
+};
+
+static void
+tstart(void *a)
+{
+     ff4:	55                   	push   %ebp
+     ff5:	89 e5                	mov    %esp,%ebp
+     ff7:	83 ec 14             	sub    $0x14,%esp
+     ffa:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+     ffd:	ff 70 04             	push   0x4(%eax)
+    1000:	ff 10                	call   *(%eax)
+  exit();
+    1002:	e8 86 f6 ff ff       	call   68d <exit>
+
+00001007 <thread_create>:
+}
+
+// Run fn(arg) in a new thread.  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1007:	55                   	push   %ebp
+    1008:	89 e5                	mov    %esp,%ebp
+    100a:	56                   	push   %esi
+    100b:	53                   	push   %ebx
+  struct tstart *t;
+  char *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    100c:	83 ec 0c             	sub    $0xc,%esp
+    100f:	68 00 10 00 00       	push   $0x1000
+    1014:	e8 33 ff ff ff       	call   f4c <malloc>
+    1019:	83 c4 10             	add    $0x10,%esp
+    101c:	85 c0                	test   %eax,%eax
+    101e:	74 42                	je     1062 <thread_create+0x5b>
+    1020:	89 c3                	mov    %eax,%ebx
+    return -1;
+  t = (struct tstart*)stack;
+  t->fn = fn;
+    1022:	8b 45 08             	mov    0x8(%ebp),%eax
+    1025:	89 03                	mov    %eax,(%ebx)
+  t->arg = arg;
+    1027:	8b 45 0c             	mov    0xc(%ebp),%eax
+    102a:	89 43 04             	mov    %eax,0x4(%ebx)
+  if((pid = clone(tstart, stack + TSTACK, t)) < 0)
+    102d:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    1033:	83 ec 04             	sub    $0x4,%esp
+    1036:	53                   	push   %ebx
+    1037:	50                   	push   %eax
+    1038:	68 f4 0f 00 00       	push   $0xff4
+    103d:	e8 f5 f8 ff ff       	call   937 <clone>
+    1042:	89 c6                	mov    %eax,%esi
+    1044:	83 c4 10             	add    $0x10,%esp
+    1047:	85 c0                	test   %eax,%eax
+    1049:	78 09                	js     1054 <thread_create+0x4d>
+    free(stack);
+  return pid;
+}
+    104b:	89 f0                	mov    %esi,%eax
+    104d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1050:	5b                   	pop    %ebx
+    1051:	5e                   	pop    %esi
+    1052:	5d                   	pop    %ebp
+    1053:	c3                   	ret
+    free(stack);
+    1054:	83 ec 0c             	sub    $0xc,%esp
+    1057:	53                   	push   %ebx
+    1058:	e8 98 fe ff ff       	call   ef5 <free>
+    105d:	83 c4 10             	add    $0x10,%esp
+    1060:	eb e9                	jmp    104b <thread_create+0x44>
+    return -1;
+    1062:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1067:	eb e2                	jmp    104b <thread_create+0x44>
+
+00001069 <thread_join>:
+
+// Wait for one of this process's threads to exit and free its
+// stack.  Returns its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+    1069:	55                   	push   %ebp
+    106a:	89 e5                	mov    %esp,%ebp
+    106c:	53                   	push   %ebx
+    106d:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    1070:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1073:	50                   	push   %eax
+    1074:	e8 cd f8 ff ff       	call   946 <join>
+    1079:	89 c3                	mov    %eax,%ebx
+    107b:	83 c4 10             	add    $0x10,%esp
+    107e:	85 c0                	test   %eax,%eax
+    1080:	79 07                	jns    1089 <thread_join+0x20>
+    free((char*)stack - TSTACK);
+  return pid;
+}
+    1082:	89 d8                	mov    %ebx,%eax
+    1084:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1087:	c9                   	leave
+    1088:	c3                   	ret
+    free((char*)stack - TSTACK);
+    1089:	83 ec 0c             	sub    $0xc,%esp
+    108c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    108f:	2d 00 10 00 00       	sub    $0x1000,%eax
+    1094:	50                   	push   %eax
+    1095:	e8 5b fe ff ff       	call   ef5 <free>
+    109a:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    109d:	eb e3                	jmp    1082 <thread_join+0x19>
+
+0000109f <lock_init>:
+
+void
+lock_init(lock_t *lk)
+{
+    109f:	55                   	push   %ebp
+    10a0:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    10a2:	8b 45 08             	mov    0x8(%ebp),%eax
+    10a5:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    10ab:	5d                   	pop    %ebp
+    10ac:	c3                   	ret
+
+000010ad <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+    10ad:	55                   	push   %ebp
+    10ae:	89 e5                	mov    %esp,%ebp
+    10b0:	8b 55 08             	mov    0x8(%ebp),%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    10b3:	b8 01 00 00 00       	mov    $0x1,%eax
+    10b8:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    10bb:	85 c0                	test   %eax,%eax
+    10bd:	75 f4                	jne    10b3 <lock_acquire+0x6>
+    ;
+}
+    10bf:	5d                   	pop    %ebp
+    10c0:	c3                   	ret
+
+000010c1 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+    10c1:	55                   	push   %ebp
+    10c2:	89 e5                	mov    %esp,%ebp
+    10c4:	8b 55 08             	mov    0x8(%ebp),%edx
+    10c7:	b8 00 00 00 00       	mov    $0x0,%eax
+    10cc:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    10cf:	5d                   	pop    %ebp
+    10d0:	c3                   	ret
+
+000010d1 <mutex_init>:
+// Are Tricky": state is 0 when free, 1 when held, 2 when held and
+// others may be waiting.  Unlocking an uncontended mutex costs no
+// system call.
+void
+mutex_init(mutex_t *m)
+{
+    10d1:	55                   	push   %ebp
+    10d2:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    10d4:	8b 45 08             	mov    0x8(%ebp),%eax
+    10d7:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    10dd:	5d                   	pop    %ebp
+    10de:	c3                   	ret
+
+000010df <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+    10df:	55                   	push   %ebp
+    10e0:	89 e5                	mov    %esp,%ebp
+    10e2:	53                   	push   %ebx
+    10e3:	83 ec 04             	sub    $0x4,%esp
+    10e6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    10e9:	b8 00 00 00 00       	mov    $0x0,%eax
+    10ee:	b9 01 00 00 00       	mov    $0x1,%ecx
+    10f3:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    10f7:	85 c0                	test   %eax,%eax
+    10f9:	74 29                	je     1124 <mutex_lock+0x45>
+    return;
+  if(c != 2)
+    10fb:	83 f8 02             	cmp    $0x2,%eax
+    10fe:	74 20                	je     1120 <mutex_lock+0x41>
+    1100:	b8 02 00 00 00       	mov    $0x2,%eax
+    1105:	f0 87 03             	lock xchg %eax,(%ebx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    1108:	eb 16                	jmp    1120 <mutex_lock+0x41>
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    110a:	83 ec 08             	sub    $0x8,%esp
+    110d:	6a 02                	push   $0x2
+    110f:	53                   	push   %ebx
+    1110:	e8 40 f8 ff ff       	call   955 <futex_wait>
+  asm volatile("lock; xchgl %0, %1" :
+    1115:	b8 02 00 00 00       	mov    $0x2,%eax
+    111a:	f0 87 03             	lock xchg %eax,(%ebx)
+    111d:	83 c4 10             	add    $0x10,%esp
+  while(c != 0){
+    1120:	85 c0                	test   %eax,%eax
+    1122:	75 e6                	jne    110a <mutex_lock+0x2b>
+    c = xchg(&m->state, 2);
+  }
+}
+    1124:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1127:	c9                   	leave
+    1128:	c3                   	ret
+
+00001129 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+    1129:	55                   	push   %ebp
+    112a:	89 e5                	mov    %esp,%ebp
+    112c:	83 ec 08             	sub    $0x8,%esp
+    112f:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    1132:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    1137:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    113b:	83 fa 01             	cmp    $0x1,%edx
+    113e:	75 02                	jne    1142 <mutex_unlock+0x19>
+    m->state = 0;
+    futex_wake(&m->state, 1);
+  }
+}
+    1140:	c9                   	leave
+    1141:	c3                   	ret
+    m->state = 0;
+    1142:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+    1148:	83 ec 08             	sub    $0x8,%esp
+    114b:	6a 01                	push   $0x1
+    114d:	50                   	push   %eax
+    114e:	e8 11 f8 ff ff       	call   964 <futex_wake>
+    1153:	83 c4 10             	add    $0x10,%esp
+}
+    1156:	eb e8                	jmp    1140 <mutex_unlock+0x17>
+
+00001158 <cond_init>:
+// Condition variable: waiters sleep on a sequence number that
+// every signal bumps, so a signal between the unlock and the
+// futex_wait() in cond_wait() is not lost.
+void
+cond_init(cond_t *c)
+{
+    1158:	55                   	push   %ebp
+    1159:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    115b:	8b 45 08             	mov    0x8(%ebp),%eax
+    115e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1164:	5d                   	pop    %ebp
+    1165:	c3                   	ret
+
+00001166 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+    1166:	55                   	push   %ebp
+    1167:	89 e5                	mov    %esp,%ebp
+    1169:	57                   	push   %edi
+    116a:	56                   	push   %esi
+    116b:	53                   	push   %ebx
+    116c:	83 ec 18             	sub    $0x18,%esp
+    116f:	8b 75 08             	mov    0x8(%ebp),%esi
+    1172:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    1175:	8b 3e                	mov    (%esi),%edi
+  mutex_unlock(m);
+    1177:	53                   	push   %ebx
+    1178:	e8 ac ff ff ff       	call   1129 <mutex_unlock>
+  futex_wait(&c->seq, seq);
+    117d:	83 c4 08             	add    $0x8,%esp
+    1180:	57                   	push   %edi
+    1181:	56                   	push   %esi
+    1182:	e8 ce f7 ff ff       	call   955 <futex_wait>
+  // Others may be waiting for m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+    1187:	83 c4 10             	add    $0x10,%esp
+    118a:	eb 0e                	jmp    119a <cond_wait+0x34>
+    futex_wait(&m->state, 2);
+    118c:	83 ec 08             	sub    $0x8,%esp
+    118f:	6a 02                	push   $0x2
+    1191:	53                   	push   %ebx
+    1192:	e8 be f7 ff ff       	call   955 <futex_wait>
+    1197:	83 c4 10             	add    $0x10,%esp
+    119a:	b8 02 00 00 00       	mov    $0x2,%eax
+    119f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    11a2:	85 c0                	test   %eax,%eax
+    11a4:	75 e6                	jne    118c <cond_wait+0x26>
+}
+    11a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11a9:	5b                   	pop    %ebx
+    11aa:	5e                   	pop    %esi
+    11ab:	5f                   	pop    %edi
+    11ac:	5d                   	pop    %ebp
+    11ad:	c3                   	ret
+
+000011ae <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+    11ae:	55                   	push   %ebp
+    11af:	89 e5                	mov    %esp,%ebp
+    11b1:	83 ec 10             	sub    $0x10,%esp
+    11b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    11b7:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+    11bb:	6a 01                	push   $0x1
+    11bd:	50                   	push   %eax
+    11be:	e8 a1 f7 ff ff       	call   964 <futex_wake>
+}
+    11c3:	83 c4 10             	add    $0x10,%esp
+    11c6:	c9                   	leave
+    11c7:	c3                   	ret
+
+000011c8 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+    11c8:	55                   	push   %ebp
+    11c9:	89 e5                	mov    %esp,%ebp
+    11cb:	83 ec 10             	sub    $0x10,%esp
+    11ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    11d1:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, NPROC);
+    11d5:	6a 40                	push   $0x40
+    11d7:	50                   	push   %eax
+    11d8:	e8 87 f7 ff ff       	call   964 <futex_wake>
+}
+    11dd:	83 c4 10             	add    $0x10,%esp
+    11e0:	c9                   	leave
+    11e1:	c3                   	ret
@@ -0,0 +1,161 @@
+// Directory entry cache.
+//
+// namex() looks up every path component with dirlookup(), which
+// reads the directory an entry at a time.  The dcache remembers
+// the answers, keyed by (dev, directory inum, name): the inum and
+// offset of the entry, or that there is no such name (a negative
+// entry, inum 0).  Only dirlookup() fills it, holding the
+// directory's lock at least shared, so no one can be changing the
+// directory meanwhile; the changes go through dirlink() and
+// sys_unlink(), which hold it exclusive and put in the new answer.
+// A directory that is freed has its entries purged, since its
+// inum may come back as another directory.
+//
+// Entries hang off NDHASH hash chains; when all NDCACHE are in
+// use the least recently used one is taken.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "spinlock.h"
+#include "fs.h"
+
+#define NDHASH 61
+
+struct dentry {
+  uint dev;
+  uint dir;                    // Directory inum, 0 if unused
+  char name[DIRSIZ];
+  uint inum;                   // 0: no such name
+  uint off;                    // Of the dirent
+  struct dentry *hnext;        // Hash chain
+  struct dentry *prev;         // LRU list, most recent first
+  struct dentry *next;
+};
+
+static struct {
+  struct spinlock lock;
+  struct dentry entry[NDCACHE];
+  struct dentry *hash[NDHASH];
+  struct dentry head;
+} dcache;
+
+static uint
+dhash(uint dev, uint dir, char *name)
+{
+  uint h;
+  int i;
+
+  h = dev * 31 + dir;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = h * 31 + (uchar)name[i];
+  return h % NDHASH;
+}
+
+// Move d to the front of the LRU list.
+static void
+dtouch(struct dentry *d)
+{
+  d->next->prev = d->prev;
+  d->prev->next = d->next;
+  d->next = dcache.head.next;
+  d->prev = &dcache.head;
+  dcache.head.next->prev = d;
+  dcache.head.next = d;
+}
+
+static struct dentry*
+dfind(uint dev, uint dir, char *name)
+{
+  struct dentry *d;
+
+  for(d = dcache.hash[dhash(dev, dir, name)]; d; d = d->hnext)
+    if(d->dir == dir && d->dev == dev && strncmp(d->name, name, DIRSIZ) == 0)
+      return d;
+  return 0;
+}
+
+// Take d off its hash chain.
+static void
+dunhash(struct dentry *d)
+{
+  struct dentry **pp;
+
+  if(d->dir == 0)
+    return;
+  for(pp = &dcache.hash[dhash(d->dev, d->dir, d->name)]; *pp != d; pp = &(*pp)->hnext)
+    ;
+  *pp = d->hnext;
+  d->dir = 0;
+}
+
+void
+dcacheinit(void)
+{
+  struct dentry *d;
+
+  initlock(&dcache.lock, "dcache");
+  dcache.head.prev = dcache.head.next = &dcache.head;
+  for(d = dcache.entry; d < &dcache.entry[NDCACHE]; d++){
+    d->next = dcache.head.next;
+    d->prev = &dcache.head;
+    dcache.head.next->prev = d;
+    dcache.head.next = d;
+  }
+}
+
+// Look up name in directory dir.  Returns 0 if the cache does
+// not know; else 1, with *inum set to the entry's inode (0 if
+// there is no such name) and *off to its offset.
+int
+dcachelookup(uint dev, uint dir, char *name, uint *inum, uint *off)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  if((d = dfind(dev, dir, name)) == 0){
+    release(&dcache.lock);
+    return 0;
+  }
+  dtouch(d);
+  *inum = d->inum;
+  *off = d->off;
+  release(&dcache.lock);
+  return 1;
+}
+
+// Record that name in directory dir is inode inum, at offset off
+// in the directory, or (inum 0) that there is no such name.
+void
+dcacheenter(uint dev, uint dir, char *name, uint inum, uint off)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  if((d = dfind(dev, dir, name)) == 0){
+    d = dcache.head.prev;
+    dunhash(d);
+    d->dev = dev;
+    d->dir = dir;
+    strncpy(d->name, name, DIRSIZ);
+    d->hnext = dcache.hash[dhash(dev, dir, name)];
+    dcache.hash[dhash(dev, dir, name)] = d;
+  }
+  d->inum = inum;
+  d->off = off;
+  dtouch(d);
+  release(&dcache.lock);
+}
+
+// Forget every entry of directory dir, which is being freed.
+void
+dcachepurge(uint dev, uint dir)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  for(d = dcache.entry; d < &dcache.entry[NDCACHE]; d++)
+    if(d->dir == dir && d->dev == dev)
+      dunhash(d);
+  release(&dcache.lock);
+}
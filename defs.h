@@ -1,53 +1,101 @@
 struct buf;
+struct bstat;
 struct context;
 struct file;
 struct inode;
+struct iostat;
+struct iovec;
 struct pipe;
 struct proc;
 struct rtcdate;
 struct spinlock;
 struct sleeplock;
+struct slabcache;
+struct procinfo;
+struct cpuinfo;
+struct lockcount;
+struct lockstat;
+struct memstat;
+struct clockpage;
+struct timespec;
 struct stat;
 struct superblock;
+struct syscount;
+struct tracev;
+struct vma;
 
 // bio.c
 void            binit(void);
 struct buf*     bread(uint, uint);
+struct buf*     bclaim(uint, uint);
 void            brelse(struct buf*);
+void            bdrop(struct buf*);
 void            bwrite(struct buf*);
+void            bwritev(struct buf**, int);
+int             bshrink(void);
+void            bunref(struct buf*);
+void            bprefetch(uint, uint);
+void            getbstat(struct bstat*);
+
+// clock.c
+extern struct clockpage* clockpg;
+void            clockinit(void);
+void            clocktick(uint);
+uint64          nanotime(void);
+int             clockgettime(int, struct timespec*);
+void            clockdate(struct rtcdate*);
+void            microdelay(int);
 
 // console.c
 void            consoleinit(void);
 void            cprintf(char*, ...);
 void            consoleintr(int(*)(void));
+void            consoletx(void);
 void            panic(char*) __attribute__((noreturn));
 
+// dcache.c
+void            dcacheinit(void);
+int             dcachelookup(uint, uint, char*, uint*, uint*);
+void            dcacheenter(uint, uint, char*, uint, uint);
+void            dcachepurge(uint, uint);
+
 // exec.c
 int             exec(char*, char**);
+int             execproc(struct proc*, char*, char**);
 
 // file.c
 struct file*    filealloc(void);
 void            fileclose(struct file*);
 struct file*    filedup(struct file*);
+int             filegetdents(struct file*, char*, int);
 void            fileinit(void);
 int             fileread(struct file*, char*, int n);
+int             filereadv(struct file*, struct iovec*, int, int);
+int             filesend(struct file*, struct file*, int);
 int             filestat(struct file*, struct stat*);
 int             filewrite(struct file*, char*, int n);
+int             filewritev(struct file*, struct iovec*, int, int);
 
 // fs.c
 void            readsb(int dev, struct superblock *sb);
 int             dirlink(struct inode*, char*, uint);
 struct inode*   dirlookup(struct inode*, char*, uint*);
+int             dirread(struct inode*, uint*, char*, uint);
+int             fsmount(struct inode*, uint);
 struct inode*   ialloc(uint, short);
 struct inode*   idup(struct inode*);
+void            icacheinit(void);
+void            iflush(struct inode*);
 void            iinit(int dev);
 void            ilock(struct inode*);
+void            ilockshared(struct inode*);
 void            iput(struct inode*);
 void            iunlock(struct inode*);
 void            iunlockput(struct inode*);
 void            iupdate(struct inode*);
 int             namecmp(const char*, const char*);
 struct inode*   namei(char*);
+struct inode*   nameiat(struct inode*, char*);
 struct inode*   nameiparent(char*, char*);
 int             readi(struct inode*, char*, uint, uint);
 void            stati(struct inode*, struct stat*);
@@ -57,17 +105,33 @@ int             writei(struct inode*, char*, uint, uint);
 void            ideinit(void);
 void            ideintr(void);
 void            iderw(struct buf*);
+void            iderwv(struct buf**, int);
+void            idereadahead(struct buf*);
+void            getiostat(struct iostat*);
+int             setiosched(char*);
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
 extern uchar    ioapicid;
 void            ioapicinit(void);
+void            irqbalance(void);
+int             irqroute(int, int);
+void            irqroutes(int*);
 
 // kalloc.c
 char*           kalloc(void);
+char*           kzalloc(void);
+char*           kallocn(int);
+void            kfreen(char*, int);
+void            ksplit(char*, int);
+int             kzeroidle(void);
+int             kfreepages(void);
 void            kfree(char*);
+void            kincref(char*);
+int             krefcnt(char*);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
+void            kmemstat(struct memstat*);
 
 // kbd.c
 void            kbdintr(void);
@@ -77,41 +141,76 @@ void            cmostime(struct rtcdate *r);
 int             lapicid(void);
 extern volatile uint*    lapic;
 void            lapiceoi(void);
+void            lapicipi(int, int);
 void            lapicinit(void);
-void            lapicstartap(uchar, uint);
-void            microdelay(int);
+void            lapicstartap(uchar*, int, uint);
+void            lapictimer(uint, int);
+void            lapiconeshot(uint);
+uint            lapiccount(void);
+void            lapiccalibrate(uint);
 
 // log.c
 void            initlog(int dev);
 void            log_write(struct buf*);
 void            begin_op();
 void            end_op();
+void            begin_opn(int);
+void            end_opn(int);
+int             log_opmax(void);
+void            log_force(void);
+int             log_claim(uint);
 
 // mp.c
 extern int      ismp;
 void            mpinit(void);
 
+// pcache.c
+void            pcinit(void);
+char*           pcget(struct inode*, uint);
+char*           pcadd(struct inode*, uint, char*);
+void            pcwrite(struct inode*, char*, uint, uint);
+void            pcinval(struct inode*);
+int             pcshrink(void);
+
+// pci.c
+uint            pciread(uint, int);
+void            pciwrite(uint, int, uint);
+int             pcifind(int, int, uint*);
+
 // picirq.c
 void            picenable(int);
 void            picinit(void);
 
 // pipe.c
 int             pipealloc(struct file**, struct file**);
+void            pipeinit(void);
 void            pipeclose(struct pipe*, int);
 int             piperead(struct pipe*, char*, int);
 int             pipewrite(struct pipe*, char*, int);
+int             pipesetsize(struct pipe*, int);
+int             pipesize(struct pipe*);
 
 //PAGEBREAK: 16
 // proc.c
 int             cpuid(void);
 void            exit(void);
 int             fork(void);
+int             spawn(char*, char**, int*);
+void            kthread(char*, void(*)(void));
+int             clone(uint, uint, uint);
+int             join(uint*);
 int             growproc(int);
+void            setsz(struct proc*, uint);
+void            vmlock(struct proc*);
+void            vmunlock(struct proc*);
+int             asput(struct proc*);
+int             fdgrow(struct proc*);
 int             kill(int);
 struct cpu*     mycpu(void);
 struct proc*    myproc();
 void            pinit(void);
 void            procdump(void);
+char*           swapvictim(uint);
 void            scheduler(void) __attribute__((noreturn));
 void            sched(void);
 void            setproc(struct proc*);
@@ -119,7 +218,25 @@ void            sleep(void*, struct spinlock*);
 void            userinit(void);
 int             wait(void);
 void            wakeup(void*);
+int             wakeupn(void*, int);
+int             futexwait(uint*, uint);
+int             futexwake(uint*, int);
 void            yield(void);
+void            schedtick(void);
+void            schedboost(void);
+int             setpriority(int, int);
+int             getpriority(int);
+int             setaffinity(int, uint);
+int             getaffinity(int);
+int             getprocinfo(int, struct procinfo*);
+int             getcpuinfo(int, struct cpuinfo*);
+
+// shm.c
+void            shminit(void);
+int             shmget(int, uint);
+int             shmat(struct proc*, int);
+int             shmdt(struct proc*, uint);
+void            shmreclaim(void);
 
 // swtch.S
 void            swtch(struct context**, struct context*);
@@ -129,15 +246,28 @@ void            acquire(struct spinlock*);
 void            getcallerpcs(void*, uint*);
 int             holding(struct spinlock*);
 void            initlock(struct spinlock*, char*);
+void            freelock(struct spinlock*);
 void            release(struct spinlock*);
 void            pushcli(void);
 void            popcli(void);
+void            lockstatadd(struct lockcount*, char*, int);
+void            lockstatdel(struct lockcount*);
+int             getlockstat(int, struct lockstat*);
+
+// slab.c
+void            slabinit(struct slabcache*, char*, uint);
+void*           slaballoc(struct slabcache*);
+void            slabfree(struct slabcache*, void*);
 
 // sleeplock.c
 void            acquiresleep(struct sleeplock*);
+void            acquiresleepshared(struct sleeplock*);
+void            downgradesleep(struct sleeplock*);
 void            releasesleep(struct sleeplock*);
 int             holdingsleep(struct sleeplock*);
+int             heldsleep(struct sleeplock*);
 void            initsleeplock(struct sleeplock*, char*);
+void            freesleeplock(struct sleeplock*);
 
 // string.c
 int             memcmp(const void*, const void*, uint);
@@ -147,17 +277,56 @@ char*           safestrcpy(char*, const char*, int);
 int             strlen(const char*);
 int             strncmp(const char*, const char*, uint);
 char*           strncpy(char*, const char*, int);
+extern int      ssemove;
+
+// swap.c
+void            swapinit(int);
+int             swapout(void);
+void            swapin(char*, uint);
+void            swapdup(uint);
+void            swapfree(uint);
 
 // syscall.c
 int             argint(int, int*);
 int             argptr(int, char**, int);
+int             argoutptr(int, char**, int);
 int             argstr(int, char**);
 int             fetchint(uint, int*);
 int             fetchstr(uint, char**);
+int             getsysstat(int, struct syscount*);
 void            syscall(void);
+void            sysstatadd(struct proc*, struct proc*);
+
+// textcache.c
+void            textinit(void);
+char*           textget(struct inode*, uint, uint);
+void            textinval(struct inode*);
+
+// timer.c
+void            timerinit(void);
 
 // timer.c
 void            timerinit(void);
+int             timerintr(void);
+int             timersleep(uint64);
+
+// tmpfs.c
+void            tmpfsinit(void);
+uint            tmpialloc(short);
+void            tmpiread(struct inode*);
+void            tmpitrunc(struct inode*);
+void            tmpiupdate(struct inode*);
+int             tmpreadi(struct inode*, char*, uint, uint);
+int             tmpwritei(struct inode*, char*, uint, uint);
+
+// tracebuf.c
+void            traceinit(void);
+int             traceread(int, struct tracev*, int);
+void            tracerec(int, uint, uint);
+int             traceset(int);
+extern uint     tracemask;
+#define TRACE(c, t, a, b) \
+  do { if(tracemask & (c)) tracerec((t), (a), (b)); } while(0)
 
 // trap.c
 void            idtinit(void);
@@ -165,10 +334,15 @@ extern uint     ticks;
 void            tvinit(void);
 extern struct spinlock tickslock;
 
+// trapasm.S
+void            sysentry(void);
+
 // uart.c
 void            uartinit(void);
 void            uartintr(void);
 void            uartputc(int);
+int             uartroom(void);
+void            uartsend(int);
 
 // vm.c
 void            seginit(void);
@@ -180,11 +354,32 @@ int             deallocuvm(pde_t*, uint, uint);
 void            freevm(pde_t*);
 void            inituvm(pde_t*, char*, uint);
 int             loaduvm(pde_t*, char*, struct inode*, uint, uint);
-pde_t*          copyuvm(pde_t*, uint);
+pde_t*          copyuvm(pde_t*, uint, uint, int*);
 void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
+int             cowfault(pde_t*, uint);
+int             heapfault(struct proc*, uint, int);
+int             vmfault(struct proc*, uint, uint);
+int             uvmtouch(struct proc*, uint, uint, int);
+int             uvmcopyin(struct proc*, void*, uint, uint);
+int             uvmcopyout(struct proc*, uint, void*, uint);
+int             copyinstr(struct proc*, char*, uint, uint);
+int             uvmpinned(struct proc*, uint);
+void            vmatrim(struct proc*, uint);
+int             uvmsplit(pde_t*, uint);
+int             uvmcheck(struct proc*, uint, uint);
+void            vmaput(pde_t*, struct vma*);
+int             munmap(struct proc*, uint, uint);
+void            mmaprise(struct proc*);
+void            tlbshootdown(void);
+uint*           futexaddr(struct proc*, uint);
+void            tlback(void);
+char*           uvmevict(struct proc*, uint*, uint);
+int             uvmshare(struct proc*, uint, char**, int);
+int             uvmunshare(struct proc*, uint, char**, int);
+extern char     zeropage[];
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
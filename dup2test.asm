@@ -0,0 +1,2898 @@
+
+_dup2test:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fcntl.h"
+#include "param.h"
+
+int
+main(int argc, char* argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	53                   	push   %ebx
+       e:	51                   	push   %ecx
+  int fd;
+
+  // Ejemplo de dup2 con un fd incorrecto
+  if (dup2 (-1,8) >= 0)
+       f:	83 ec 08             	sub    $0x8,%esp
+      12:	6a 08                	push   $0x8
+      14:	6a ff                	push   $0xffffffff
+      16:	e8 a8 08 00 00       	call   8c3 <dup2>
+      1b:	83 c4 10             	add    $0x10,%esp
+      1e:	85 c0                	test   %eax,%eax
+      20:	0f 89 1b 01 00 00    	jns    141 <main+0x141>
+    printf (1, "dup2 no funciona con fd incorrecto.\n");
+
+  // Ejemplo de dup2 con un newfd incorrecto
+  if (dup2 (1,-1) >= 0)
+      26:	83 ec 08             	sub    $0x8,%esp
+      29:	6a ff                	push   $0xffffffff
+      2b:	6a 01                	push   $0x1
+      2d:	e8 91 08 00 00       	call   8c3 <dup2>
+      32:	83 c4 10             	add    $0x10,%esp
+      35:	85 c0                	test   %eax,%eax
+      37:	0f 89 1b 01 00 00    	jns    158 <main+0x158>
+    printf (1, "dup2 no funciona con fd incorrecto (2).\n");
+
+  // Ejemplo de dup2 con un fd no mapeado
+  if (dup2 (6,8) >= 0)
+      3d:	83 ec 08             	sub    $0x8,%esp
+      40:	6a 08                	push   $0x8
+      42:	6a 06                	push   $0x6
+      44:	e8 7a 08 00 00       	call   8c3 <dup2>
+      49:	83 c4 10             	add    $0x10,%esp
+      4c:	85 c0                	test   %eax,%eax
+      4e:	0f 89 1b 01 00 00    	jns    16f <main+0x16f>
+    printf (1, "dup2 no funciona con fd inexistente.\n");
+
+  if (dup2 (1,NOFILE) >= 0)
+      54:	83 ec 08             	sub    $0x8,%esp
+      57:	68 00 04 00 00       	push   $0x400
+      5c:	6a 01                	push   $0x1
+      5e:	e8 60 08 00 00       	call   8c3 <dup2>
+      63:	83 c4 10             	add    $0x10,%esp
+      66:	85 c0                	test   %eax,%eax
+      68:	0f 89 18 01 00 00    	jns    186 <main+0x186>
+    printf (1, "dup2 no funciona con fd superior a NOFILE.\n");
+
+  // Ejemplo de dup2 con fd existente
+  if (dup2 (1,4) != 4)
+      6e:	83 ec 08             	sub    $0x8,%esp
+      71:	6a 04                	push   $0x4
+      73:	6a 01                	push   $0x1
+      75:	e8 49 08 00 00       	call   8c3 <dup2>
+      7a:	83 c4 10             	add    $0x10,%esp
+      7d:	83 f8 04             	cmp    $0x4,%eax
+      80:	0f 85 17 01 00 00    	jne    19d <main+0x19d>
+    printf (1, "dup2 no funciona con fd existente.\n");
+
+  printf (4, "Este mensaje debe salir por terminal.\n");
+      86:	83 ec 08             	sub    $0x8,%esp
+      89:	68 54 14 00 00       	push   $0x1454
+      8e:	6a 04                	push   $0x4
+      90:	e8 d5 0c 00 00       	call   d6a <printf>
+
+  fd = open ("fichero_salida.txt", O_CREATE|O_RDWR);
+      95:	83 c4 08             	add    $0x8,%esp
+      98:	68 02 02 00 00       	push   $0x202
+      9d:	68 f4 14 00 00       	push   $0x14f4
+      a2:	e8 db 08 00 00       	call   982 <open>
+      a7:	89 c3                	mov    %eax,%ebx
+  printf (fd, "Salida a fichero\n");
+      a9:	83 c4 08             	add    $0x8,%esp
+      ac:	68 07 15 00 00       	push   $0x1507
+      b1:	50                   	push   %eax
+      b2:	e8 b3 0c 00 00       	call   d6a <printf>
+
+  if (dup2 (fd, 9) != 9)
+      b7:	83 c4 08             	add    $0x8,%esp
+      ba:	6a 09                	push   $0x9
+      bc:	53                   	push   %ebx
+      bd:	e8 01 08 00 00       	call   8c3 <dup2>
+      c2:	83 c4 10             	add    $0x10,%esp
+      c5:	83 f8 09             	cmp    $0x9,%eax
+      c8:	0f 85 e6 00 00 00    	jne    1b4 <main+0x1b4>
+    printf (1, "dup2 no funciona con fd existente (2).\n");
+
+  printf (9, "Salida también a fichero.\n");
+      ce:	83 ec 08             	sub    $0x8,%esp
+      d1:	68 19 15 00 00       	push   $0x1519
+      d6:	6a 09                	push   $0x9
+      d8:	e8 8d 0c 00 00       	call   d6a <printf>
+
+  if (dup2 (9, 9) != 9)
+      dd:	83 c4 08             	add    $0x8,%esp
+      e0:	6a 09                	push   $0x9
+      e2:	6a 09                	push   $0x9
+      e4:	e8 da 07 00 00       	call   8c3 <dup2>
+      e9:	83 c4 10             	add    $0x10,%esp
+      ec:	83 f8 09             	cmp    $0x9,%eax
+      ef:	0f 85 d6 00 00 00    	jne    1cb <main+0x1cb>
+    printf (1, "dup2 no funciona con newfd=oldfd (3).\n");
+
+  printf (9, "Salida también a fichero.\n");
+      f5:	83 ec 08             	sub    $0x8,%esp
+      f8:	68 19 15 00 00       	push   $0x1519
+      fd:	6a 09                	push   $0x9
+      ff:	e8 66 0c 00 00       	call   d6a <printf>
+
+  close (9);
+     104:	c7 04 24 09 00 00 00 	movl   $0x9,(%esp)
+     10b:	e8 50 07 00 00       	call   860 <close>
+
+  if (dup2 (1, fd) != fd)
+     110:	83 c4 08             	add    $0x8,%esp
+     113:	53                   	push   %ebx
+     114:	6a 01                	push   $0x1
+     116:	e8 a8 07 00 00       	call   8c3 <dup2>
+     11b:	83 c4 10             	add    $0x10,%esp
+     11e:	39 d8                	cmp    %ebx,%eax
+     120:	0f 85 bc 00 00 00    	jne    1e2 <main+0x1e2>
+    printf (1, "dup2 no funciona con fd existente (4).\n");
+
+  printf (fd, "Este mensaje debe salir por terminal.\n");
+     126:	83 ec 08             	sub    $0x8,%esp
+     129:	68 54 14 00 00       	push   $0x1454
+     12e:	53                   	push   %ebx
+     12f:	e8 36 0c 00 00       	call   d6a <printf>
+  close (fd);
+     134:	89 1c 24             	mov    %ebx,(%esp)
+     137:	e8 24 07 00 00       	call   860 <close>
+
+  exit();
+     13c:	e8 f0 06 00 00       	call   831 <exit>
+    printf (1, "dup2 no funciona con fd incorrecto.\n");
+     141:	83 ec 08             	sub    $0x8,%esp
+     144:	68 88 13 00 00       	push   $0x1388
+     149:	6a 01                	push   $0x1
+     14b:	e8 1a 0c 00 00       	call   d6a <printf>
+     150:	83 c4 10             	add    $0x10,%esp
+     153:	e9 ce fe ff ff       	jmp    26 <main+0x26>
+    printf (1, "dup2 no funciona con fd incorrecto (2).\n");
+     158:	83 ec 08             	sub    $0x8,%esp
+     15b:	68 b0 13 00 00       	push   $0x13b0
+     160:	6a 01                	push   $0x1
+     162:	e8 03 0c 00 00       	call   d6a <printf>
+     167:	83 c4 10             	add    $0x10,%esp
+     16a:	e9 ce fe ff ff       	jmp    3d <main+0x3d>
+    printf (1, "dup2 no funciona con fd inexistente.\n");
+     16f:	83 ec 08             	sub    $0x8,%esp
+     172:	68 dc 13 00 00       	push   $0x13dc
+     177:	6a 01                	push   $0x1
+     179:	e8 ec 0b 00 00       	call   d6a <printf>
+     17e:	83 c4 10             	add    $0x10,%esp
+     181:	e9 ce fe ff ff       	jmp    54 <main+0x54>
+    printf (1, "dup2 no funciona con fd superior a NOFILE.\n");
+     186:	83 ec 08             	sub    $0x8,%esp
+     189:	68 04 14 00 00       	push   $0x1404
+     18e:	6a 01                	push   $0x1
+     190:	e8 d5 0b 00 00       	call   d6a <printf>
+     195:	83 c4 10             	add    $0x10,%esp
+     198:	e9 d1 fe ff ff       	jmp    6e <main+0x6e>
+    printf (1, "dup2 no funciona con fd existente.\n");
+     19d:	83 ec 08             	sub    $0x8,%esp
+     1a0:	68 30 14 00 00       	push   $0x1430
+     1a5:	6a 01                	push   $0x1
+     1a7:	e8 be 0b 00 00       	call   d6a <printf>
+     1ac:	83 c4 10             	add    $0x10,%esp
+     1af:	e9 d2 fe ff ff       	jmp    86 <main+0x86>
+    printf (1, "dup2 no funciona con fd existente (2).\n");
+     1b4:	83 ec 08             	sub    $0x8,%esp
+     1b7:	68 7c 14 00 00       	push   $0x147c
+     1bc:	6a 01                	push   $0x1
+     1be:	e8 a7 0b 00 00       	call   d6a <printf>
+     1c3:	83 c4 10             	add    $0x10,%esp
+     1c6:	e9 03 ff ff ff       	jmp    ce <main+0xce>
+    printf (1, "dup2 no funciona con newfd=oldfd (3).\n");
+     1cb:	83 ec 08             	sub    $0x8,%esp
+     1ce:	68 a4 14 00 00       	push   $0x14a4
+     1d3:	6a 01                	push   $0x1
+     1d5:	e8 90 0b 00 00       	call   d6a <printf>
+     1da:	83 c4 10             	add    $0x10,%esp
+     1dd:	e9 13 ff ff ff       	jmp    f5 <main+0xf5>
+    printf (1, "dup2 no funciona con fd existente (4).\n");
+     1e2:	83 ec 08             	sub    $0x8,%esp
+     1e5:	68 cc 14 00 00       	push   $0x14cc
+     1ea:	6a 01                	push   $0x1
+     1ec:	e8 79 0b 00 00       	call   d6a <printf>
+     1f1:	83 c4 10             	add    $0x10,%esp
+     1f4:	e9 2d ff ff ff       	jmp    126 <main+0x126>
+
+000001f9 <strcpy>:
+#include "memlayout.h"
+#include "clock.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     1f9:	55                   	push   %ebp
+     1fa:	89 e5                	mov    %esp,%ebp
+     1fc:	56                   	push   %esi
+     1fd:	53                   	push   %ebx
+     1fe:	8b 75 08             	mov    0x8(%ebp),%esi
+     201:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     204:	89 f0                	mov    %esi,%eax
+     206:	89 d1                	mov    %edx,%ecx
+     208:	83 c2 01             	add    $0x1,%edx
+     20b:	89 c3                	mov    %eax,%ebx
+     20d:	83 c0 01             	add    $0x1,%eax
+     210:	0f b6 09             	movzbl (%ecx),%ecx
+     213:	88 0b                	mov    %cl,(%ebx)
+     215:	84 c9                	test   %cl,%cl
+     217:	75 ed                	jne    206 <strcpy+0xd>
+    ;
+  return os;
+}
+     219:	89 f0                	mov    %esi,%eax
+     21b:	5b                   	pop    %ebx
+     21c:	5e                   	pop    %esi
+     21d:	5d                   	pop    %ebp
+     21e:	c3                   	ret
+
+0000021f <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     21f:	55                   	push   %ebp
+     220:	89 e5                	mov    %esp,%ebp
+     222:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     225:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+     228:	eb 06                	jmp    230 <strcmp+0x11>
+    p++, q++;
+     22a:	83 c1 01             	add    $0x1,%ecx
+     22d:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+     230:	0f b6 01             	movzbl (%ecx),%eax
+     233:	84 c0                	test   %al,%al
+     235:	74 04                	je     23b <strcmp+0x1c>
+     237:	3a 02                	cmp    (%edx),%al
+     239:	74 ef                	je     22a <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+     23b:	0f b6 c0             	movzbl %al,%eax
+     23e:	0f b6 12             	movzbl (%edx),%edx
+     241:	29 d0                	sub    %edx,%eax
+}
+     243:	5d                   	pop    %ebp
+     244:	c3                   	ret
+
+00000245 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     245:	55                   	push   %ebp
+     246:	89 e5                	mov    %esp,%ebp
+     248:	53                   	push   %ebx
+     249:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  const char *p;
+  uint w;
+
+  for(p = s; (uint)p & 3; p++)
+     24c:	89 c8                	mov    %ecx,%eax
+     24e:	eb 03                	jmp    253 <strlen+0xe>
+     250:	83 c0 01             	add    $0x1,%eax
+     253:	a8 03                	test   $0x3,%al
+     255:	74 09                	je     260 <strlen+0x1b>
+    if(*p == 0)
+     257:	80 38 00             	cmpb   $0x0,(%eax)
+     25a:	75 f4                	jne    250 <strlen+0xb>
+      return p - s;
+     25c:	29 c8                	sub    %ecx,%eax
+     25e:	eb 25                	jmp    285 <strlen+0x40>
+  // Then a word at a time, which never crosses into the next page:
+  // a word with a zero byte in it has one of these bits set.
+  for(;; p += 4){
+    w = *(uint*)p;
+     260:	8b 10                	mov    (%eax),%edx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     262:	8d 9a ff fe fe fe    	lea    -0x1010101(%edx),%ebx
+     268:	f7 d2                	not    %edx
+     26a:	21 da                	and    %ebx,%edx
+     26c:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+     272:	75 05                	jne    279 <strlen+0x34>
+  for(;; p += 4){
+     274:	83 c0 04             	add    $0x4,%eax
+    w = *(uint*)p;
+     277:	eb e7                	jmp    260 <strlen+0x1b>
+      break;
+  }
+  while(*p)
+     279:	80 38 00             	cmpb   $0x0,(%eax)
+     27c:	74 05                	je     283 <strlen+0x3e>
+    p++;
+     27e:	83 c0 01             	add    $0x1,%eax
+     281:	eb f6                	jmp    279 <strlen+0x34>
+  return p - s;
+     283:	29 c8                	sub    %ecx,%eax
+}
+     285:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     288:	c9                   	leave
+     289:	c3                   	ret
+
+0000028a <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     28a:	55                   	push   %ebp
+     28b:	89 e5                	mov    %esp,%ebp
+     28d:	57                   	push   %edi
+     28e:	56                   	push   %esi
+     28f:	53                   	push   %ebx
+     290:	8b 55 10             	mov    0x10(%ebp),%edx
+  uint h;
+  char *d;
+
+  d = dst;
+  c &= 0xFF;
+     293:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  if(n >= 16){
+     297:	83 fa 0f             	cmp    $0xf,%edx
+     29a:	76 52                	jbe    2ee <memset+0x64>
+    h = -(uint)d & 3;
+     29c:	8b 45 08             	mov    0x8(%ebp),%eax
+     29f:	f7 d8                	neg    %eax
+     2a1:	83 e0 03             	and    $0x3,%eax
+     2a4:	89 c6                	mov    %eax,%esi
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     2a6:	8b 7d 08             	mov    0x8(%ebp),%edi
+     2a9:	89 c1                	mov    %eax,%ecx
+     2ab:	89 d8                	mov    %ebx,%eax
+     2ad:	fc                   	cld
+     2ae:	f3 aa                	rep stos %al,%es:(%edi)
+    stosb(d, c, h);
+    stosl(d + h, (c<<24)|(c<<16)|(c<<8)|c, (n - h)/4);
+     2b0:	29 f2                	sub    %esi,%edx
+     2b2:	89 d1                	mov    %edx,%ecx
+     2b4:	c1 e9 02             	shr    $0x2,%ecx
+     2b7:	c1 e0 18             	shl    $0x18,%eax
+     2ba:	89 df                	mov    %ebx,%edi
+     2bc:	c1 e7 10             	shl    $0x10,%edi
+     2bf:	09 f8                	or     %edi,%eax
+     2c1:	89 df                	mov    %ebx,%edi
+     2c3:	c1 e7 08             	shl    $0x8,%edi
+     2c6:	09 f8                	or     %edi,%eax
+     2c8:	09 d8                	or     %ebx,%eax
+     2ca:	89 f7                	mov    %esi,%edi
+     2cc:	03 7d 08             	add    0x8(%ebp),%edi
+}
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosl" :
+     2cf:	fc                   	cld
+     2d0:	f3 ab                	rep stos %eax,%es:(%edi)
+    d += h + (n - h)/4*4;
+     2d2:	89 d7                	mov    %edx,%edi
+     2d4:	83 e7 fc             	and    $0xfffffffc,%edi
+     2d7:	09 f7                	or     %esi,%edi
+     2d9:	03 7d 08             	add    0x8(%ebp),%edi
+    n = (n - h)%4;
+     2dc:	83 e2 03             	and    $0x3,%edx
+  asm volatile("cld; rep stosb" :
+     2df:	89 d1                	mov    %edx,%ecx
+     2e1:	89 d8                	mov    %ebx,%eax
+     2e3:	fc                   	cld
+     2e4:	f3 aa                	rep stos %al,%es:(%edi)
+  }
+  stosb(d, c, n);
+  return dst;
+}
+     2e6:	8b 45 08             	mov    0x8(%ebp),%eax
+     2e9:	5b                   	pop    %ebx
+     2ea:	5e                   	pop    %esi
+     2eb:	5f                   	pop    %edi
+     2ec:	5d                   	pop    %ebp
+     2ed:	c3                   	ret
+  d = dst;
+     2ee:	8b 7d 08             	mov    0x8(%ebp),%edi
+     2f1:	eb ec                	jmp    2df <memset+0x55>
+
+000002f3 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     2f3:	55                   	push   %ebp
+     2f4:	89 e5                	mov    %esp,%ebp
+     2f6:	8b 45 08             	mov    0x8(%ebp),%eax
+     2f9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     2fd:	eb 03                	jmp    302 <strchr+0xf>
+     2ff:	83 c0 01             	add    $0x1,%eax
+     302:	0f b6 10             	movzbl (%eax),%edx
+     305:	84 d2                	test   %dl,%dl
+     307:	74 06                	je     30f <strchr+0x1c>
+    if(*s == c)
+     309:	38 ca                	cmp    %cl,%dl
+     30b:	75 f2                	jne    2ff <strchr+0xc>
+     30d:	eb 05                	jmp    314 <strchr+0x21>
+      return (char*)s;
+  return 0;
+     30f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     314:	5d                   	pop    %ebp
+     315:	c3                   	ret
+
+00000316 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     316:	55                   	push   %ebp
+     317:	89 e5                	mov    %esp,%ebp
+     319:	56                   	push   %esi
+     31a:	53                   	push   %ebx
+     31b:	8b 55 08             	mov    0x8(%ebp),%edx
+     31e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     321:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  // A word at a time while they agree.
+  if((((uint)s1 | (uint)s2) & 3) == 0)
+     324:	89 d3                	mov    %edx,%ebx
+     326:	09 cb                	or     %ecx,%ebx
+     328:	f6 c3 03             	test   $0x3,%bl
+     32b:	74 24                	je     351 <memcmp+0x3b>
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+      s1 += 4, s2 += 4;
+  while(n-- > 0){
+     32d:	8d 70 ff             	lea    -0x1(%eax),%esi
+     330:	85 c0                	test   %eax,%eax
+     332:	74 32                	je     366 <memcmp+0x50>
+    if(*s1 != *s2)
+     334:	0f b6 02             	movzbl (%edx),%eax
+     337:	0f b6 19             	movzbl (%ecx),%ebx
+     33a:	38 d8                	cmp    %bl,%al
+     33c:	75 20                	jne    35e <memcmp+0x48>
+      return *s1 - *s2;
+    s1++, s2++;
+     33e:	83 c2 01             	add    $0x1,%edx
+     341:	83 c1 01             	add    $0x1,%ecx
+  while(n-- > 0){
+     344:	89 f0                	mov    %esi,%eax
+     346:	eb e5                	jmp    32d <memcmp+0x17>
+      s1 += 4, s2 += 4;
+     348:	83 c2 04             	add    $0x4,%edx
+     34b:	83 c1 04             	add    $0x4,%ecx
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+     34e:	83 e8 04             	sub    $0x4,%eax
+     351:	83 f8 03             	cmp    $0x3,%eax
+     354:	76 d7                	jbe    32d <memcmp+0x17>
+     356:	8b 31                	mov    (%ecx),%esi
+     358:	39 32                	cmp    %esi,(%edx)
+     35a:	74 ec                	je     348 <memcmp+0x32>
+     35c:	eb cf                	jmp    32d <memcmp+0x17>
+      return *s1 - *s2;
+     35e:	0f b6 c0             	movzbl %al,%eax
+     361:	0f b6 db             	movzbl %bl,%ebx
+     364:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     366:	5b                   	pop    %ebx
+     367:	5e                   	pop    %esi
+     368:	5d                   	pop    %ebp
+     369:	c3                   	ret
+
+0000036a <memchr>:
+// The first c in the n bytes at v, or 0.  Once aligned, a word at
+// a time, with the word's bytes that equal c turned into zeroes
+// and those looked for.
+void*
+memchr(const void *v, int c, uint n)
+{
+     36a:	55                   	push   %ebp
+     36b:	89 e5                	mov    %esp,%ebp
+     36d:	57                   	push   %edi
+     36e:	56                   	push   %esi
+     36f:	53                   	push   %ebx
+     370:	8b 45 08             	mov    0x8(%ebp),%eax
+     373:	8b 55 10             	mov    0x10(%ebp),%edx
+  const uchar *s;
+  uint w, rep;
+
+  s = v;
+  c = (uchar)c;
+     376:	0f b6 75 0c          	movzbl 0xc(%ebp),%esi
+  for(; n > 0 && ((uint)s & 3); n--, s++)
+     37a:	eb 06                	jmp    382 <memchr+0x18>
+     37c:	83 ea 01             	sub    $0x1,%edx
+     37f:	83 c0 01             	add    $0x1,%eax
+     382:	85 d2                	test   %edx,%edx
+     384:	74 0d                	je     393 <memchr+0x29>
+     386:	a8 03                	test   $0x3,%al
+     388:	74 09                	je     393 <memchr+0x29>
+    if(*s == c)
+     38a:	0f b6 08             	movzbl (%eax),%ecx
+     38d:	39 f1                	cmp    %esi,%ecx
+     38f:	75 eb                	jne    37c <memchr+0x12>
+     391:	eb 41                	jmp    3d4 <memchr+0x6a>
+      return (void*)s;
+  rep = c * 0x01010101;
+     393:	69 fe 01 01 01 01    	imul   $0x1010101,%esi,%edi
+  for(; n >= 4; n -= 4, s += 4){
+     399:	eb 06                	jmp    3a1 <memchr+0x37>
+     39b:	83 ea 04             	sub    $0x4,%edx
+     39e:	83 c0 04             	add    $0x4,%eax
+     3a1:	83 fa 03             	cmp    $0x3,%edx
+     3a4:	76 16                	jbe    3bc <memchr+0x52>
+    w = *(uint*)s ^ rep;
+     3a6:	89 f9                	mov    %edi,%ecx
+     3a8:	33 08                	xor    (%eax),%ecx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     3aa:	8d 99 ff fe fe fe    	lea    -0x1010101(%ecx),%ebx
+     3b0:	f7 d1                	not    %ecx
+     3b2:	21 cb                	and    %ecx,%ebx
+     3b4:	f7 c3 80 80 80 80    	test   $0x80808080,%ebx
+     3ba:	74 df                	je     39b <memchr+0x31>
+      break;
+  }
+  for(; n > 0; n--, s++)
+     3bc:	85 d2                	test   %edx,%edx
+     3be:	74 0f                	je     3cf <memchr+0x65>
+    if(*s == c)
+     3c0:	0f b6 08             	movzbl (%eax),%ecx
+     3c3:	39 f1                	cmp    %esi,%ecx
+     3c5:	74 0d                	je     3d4 <memchr+0x6a>
+  for(; n > 0; n--, s++)
+     3c7:	83 ea 01             	sub    $0x1,%edx
+     3ca:	83 c0 01             	add    $0x1,%eax
+     3cd:	eb ed                	jmp    3bc <memchr+0x52>
+      return (void*)s;
+  return 0;
+     3cf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     3d4:	5b                   	pop    %ebx
+     3d5:	5e                   	pop    %esi
+     3d6:	5f                   	pop    %edi
+     3d7:	5d                   	pop    %ebp
+     3d8:	c3                   	ret
+
+000003d9 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     3d9:	55                   	push   %ebp
+     3da:	89 e5                	mov    %esp,%ebp
+     3dc:	57                   	push   %edi
+     3dd:	56                   	push   %esi
+     3de:	53                   	push   %ebx
+     3df:	83 ec 1c             	sub    $0x1c,%esp
+     3e2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     3e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+     3ea:	89 de                	mov    %ebx,%esi
+     3ec:	83 c3 01             	add    $0x1,%ebx
+     3ef:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     3f2:	7d 2e                	jge    422 <gets+0x49>
+    cc = read(0, &c, 1);
+     3f4:	83 ec 04             	sub    $0x4,%esp
+     3f7:	6a 01                	push   $0x1
+     3f9:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     3fc:	50                   	push   %eax
+     3fd:	6a 00                	push   $0x0
+     3ff:	e8 51 05 00 00       	call   955 <read>
+    if(cc < 1)
+     404:	83 c4 10             	add    $0x10,%esp
+     407:	85 c0                	test   %eax,%eax
+     409:	7e 17                	jle    422 <gets+0x49>
+      break;
+    buf[i++] = c;
+     40b:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     40f:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+     412:	3c 0a                	cmp    $0xa,%al
+     414:	0f 94 c2             	sete   %dl
+     417:	3c 0d                	cmp    $0xd,%al
+     419:	0f 94 c0             	sete   %al
+     41c:	08 c2                	or     %al,%dl
+     41e:	74 ca                	je     3ea <gets+0x11>
+    buf[i++] = c;
+     420:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+     422:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+     426:	89 f8                	mov    %edi,%eax
+     428:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     42b:	5b                   	pop    %ebx
+     42c:	5e                   	pop    %esi
+     42d:	5f                   	pop    %edi
+     42e:	5d                   	pop    %ebp
+     42f:	c3                   	ret
+
+00000430 <atoi>:
+  return r;
+}
+
+int
+atoi(const char *s)
+{
+     430:	55                   	push   %ebp
+     431:	89 e5                	mov    %esp,%ebp
+     433:	53                   	push   %ebx
+     434:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+     437:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+     43c:	eb 10                	jmp    44e <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+     43e:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+     441:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+     444:	83 c1 01             	add    $0x1,%ecx
+     447:	0f be c0             	movsbl %al,%eax
+     44a:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+     44e:	0f b6 01             	movzbl (%ecx),%eax
+     451:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     454:	80 fb 09             	cmp    $0x9,%bl
+     457:	76 e5                	jbe    43e <atoi+0xe>
+  return n;
+}
+     459:	89 d0                	mov    %edx,%eax
+     45b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     45e:	c9                   	leave
+     45f:	c3                   	ret
+
+00000460 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     460:	55                   	push   %ebp
+     461:	89 e5                	mov    %esp,%ebp
+     463:	57                   	push   %edi
+     464:	56                   	push   %esi
+     465:	53                   	push   %ebx
+     466:	83 ec 08             	sub    $0x8,%esp
+     469:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     46c:	8b 55 0c             	mov    0xc(%ebp),%edx
+     46f:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *src;
+  int h;
+
+  dst = vdst;
+  src = vsrc;
+  if(n <= 0)
+     472:	85 c0                	test   %eax,%eax
+     474:	0f 8e 82 00 00 00    	jle    4fc <memmove+0x9c>
+    return vdst;
+  if(src < dst && src + n > dst){
+     47a:	39 da                	cmp    %ebx,%edx
+     47c:	73 07                	jae    485 <memmove+0x25>
+     47e:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+     481:	39 cb                	cmp    %ecx,%ebx
+     483:	72 5e                	jb     4e3 <memmove+0x83>
+    movsbback(dst + n - 1, src + n - 1, n);
+    return vdst;
+  }
+  if(n >= 16 && (((uint)dst ^ (uint)src) & 3) == 0){
+     485:	83 f8 0f             	cmp    $0xf,%eax
+     488:	7e 69                	jle    4f3 <memmove+0x93>
+     48a:	89 d9                	mov    %ebx,%ecx
+     48c:	31 d1                	xor    %edx,%ecx
+     48e:	f6 c1 03             	test   $0x3,%cl
+     491:	75 73                	jne    506 <memmove+0xa6>
+    h = -(uint)dst & 3;
+     493:	89 d9                	mov    %ebx,%ecx
+     495:	f7 d9                	neg    %ecx
+     497:	83 e1 03             	and    $0x3,%ecx
+}
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsb" :
+     49a:	89 df                	mov    %ebx,%edi
+     49c:	89 d6                	mov    %edx,%esi
+     49e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+     4a1:	fc                   	cld
+     4a2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    movsb(dst, src, h);
+    dst += h, src += h, n -= h;
+     4a4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+     4a7:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+     4aa:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+     4ad:	29 f0                	sub    %esi,%eax
+    movsl(dst, src, n/4);
+     4af:	8d 50 03             	lea    0x3(%eax),%edx
+     4b2:	0f 49 d0             	cmovns %eax,%edx
+     4b5:	c1 fa 02             	sar    $0x2,%edx
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+     4b8:	89 7d f0             	mov    %edi,-0x10(%ebp)
+     4bb:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     4be:	89 ce                	mov    %ecx,%esi
+     4c0:	89 d1                	mov    %edx,%ecx
+     4c2:	fc                   	cld
+     4c3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    dst += n/4*4, src += n/4*4, n %= 4;
+     4c5:	c1 e2 02             	shl    $0x2,%edx
+     4c8:	8b 7d f0             	mov    -0x10(%ebp),%edi
+     4cb:	01 d7                	add    %edx,%edi
+     4cd:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     4d0:	01 ca                	add    %ecx,%edx
+     4d2:	89 c6                	mov    %eax,%esi
+     4d4:	c1 fe 1f             	sar    $0x1f,%esi
+     4d7:	c1 ee 1e             	shr    $0x1e,%esi
+     4da:	01 f0                	add    %esi,%eax
+     4dc:	83 e0 03             	and    $0x3,%eax
+     4df:	29 f0                	sub    %esi,%eax
+     4e1:	eb 12                	jmp    4f5 <memmove+0x95>
+    movsbback(dst + n - 1, src + n - 1, n);
+     4e3:	8d 78 ff             	lea    -0x1(%eax),%edi
+     4e6:	8d 34 3a             	lea    (%edx,%edi,1),%esi
+     4e9:	01 df                	add    %ebx,%edi
+// Copy cnt bytes down from the last ones, at dst and src, to the
+// first: for overlapping moves up.
+static inline void
+movsbback(void *dst, const void *src, int cnt)
+{
+  asm volatile("std; rep movsb; cld" :
+     4eb:	89 c1                	mov    %eax,%ecx
+     4ed:	fd                   	std
+     4ee:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     4f0:	fc                   	cld
+    return vdst;
+     4f1:	eb 09                	jmp    4fc <memmove+0x9c>
+  dst = vdst;
+     4f3:	89 df                	mov    %ebx,%edi
+  asm volatile("cld; rep movsb" :
+     4f5:	89 d6                	mov    %edx,%esi
+     4f7:	89 c1                	mov    %eax,%ecx
+     4f9:	fc                   	cld
+     4fa:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  }
+  movsb(dst, src, n);
+  return vdst;
+}
+     4fc:	89 d8                	mov    %ebx,%eax
+     4fe:	83 c4 08             	add    $0x8,%esp
+     501:	5b                   	pop    %ebx
+     502:	5e                   	pop    %esi
+     503:	5f                   	pop    %edi
+     504:	5d                   	pop    %ebp
+     505:	c3                   	ret
+  dst = vdst;
+     506:	89 df                	mov    %ebx,%edi
+     508:	eb eb                	jmp    4f5 <memmove+0x95>
+
+0000050a <vclock_gettime>:
+
+// clock_gettime() without a system call: read the clock page
+// that the kernel maps at CLOCKPAGE (see clock.h).
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+     50a:	55                   	push   %ebp
+     50b:	89 e5                	mov    %esp,%ebp
+     50d:	57                   	push   %edi
+     50e:	56                   	push   %esi
+     50f:	53                   	push   %ebx
+     510:	83 ec 14             	sub    $0x14,%esp
+  struct clockpage *cp = (struct clockpage*)CLOCKPAGE;
+  uint seq, rem, d;
+  uint64 tsc, ns, now;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+     513:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     517:	0f 87 a3 00 00 00    	ja     5c0 <vclock_gettime+0xb6>
+    return -1;
+  do {
+    seq = cp->seq;
+     51d:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+    __sync_synchronize();
+     522:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    tsc = cp->tsc;
+     527:	8b 15 10 f0 ff 7f    	mov    0x7ffff010,%edx
+     52d:	8b 1d 14 f0 ff 7f    	mov    0x7ffff014,%ebx
+    ns = cp->ns;
+     533:	8b 35 18 f0 ff 7f    	mov    0x7ffff018,%esi
+     539:	8b 3d 1c f0 ff 7f    	mov    0x7ffff01c,%edi
+    __sync_synchronize();
+     53f:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != cp->seq);
+     544:	89 c1                	mov    %eax,%ecx
+     546:	83 e1 01             	and    $0x1,%ecx
+     549:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     54c:	75 cf                	jne    51d <vclock_gettime+0x13>
+     54e:	8b 0d 00 f0 ff 7f    	mov    0x7ffff000,%ecx
+     554:	39 c1                	cmp    %eax,%ecx
+     556:	75 c5                	jne    51d <vclock_gettime+0x13>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+     558:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     55b:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     55e:	0f 31                	rdtsc
+     560:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     563:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     566:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  now = rdtsc();
+  // Less than a tick has passed since the update, so the delta
+  // fits in 32 bits.
+  d = now > tsc ? now - tsc : 0;
+     569:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     56c:	19 d3                	sbb    %edx,%ebx
+     56e:	73 07                	jae    577 <vclock_gettime+0x6d>
+     570:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+     573:	29 d8                	sub    %ebx,%eax
+     575:	89 c1                	mov    %eax,%ecx
+  ns += ((uint64)d * cp->mult) >> cp->shift;
+     577:	89 c8                	mov    %ecx,%eax
+     579:	f7 25 04 f0 ff 7f    	mull   0x7ffff004
+     57f:	0f b6 0d 08 f0 ff 7f 	movzbl 0x7ffff008,%ecx
+     586:	0f ad d0             	shrd   %cl,%edx,%eax
+     589:	d3 ea                	shr    %cl,%edx
+     58b:	f6 c1 20             	test   $0x20,%cl
+     58e:	74 04                	je     594 <vclock_gettime+0x8a>
+     590:	89 d0                	mov    %edx,%eax
+     592:	31 d2                	xor    %edx,%edx
+     594:	01 f0                	add    %esi,%eax
+     596:	11 fa                	adc    %edi,%edx
+static inline uint
+divl(uint64 n, uint d, uint *r)
+{
+  uint q;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (*r) :
+     598:	bb 00 ca 9a 3b       	mov    $0x3b9aca00,%ebx
+     59d:	f7 f3                	div    %ebx
+  ts->tv_sec = divl(ns, 1000000000, &rem);
+     59f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     5a2:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = rem;
+     5a4:	89 57 04             	mov    %edx,0x4(%edi)
+  if(clk == CLOCK_REALTIME)
+     5a7:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     5ab:	75 1a                	jne    5c7 <vclock_gettime+0xbd>
+    ts->tv_sec += cp->boottime;
+     5ad:	03 05 0c f0 ff 7f    	add    0x7ffff00c,%eax
+     5b3:	89 07                	mov    %eax,(%edi)
+  return 0;
+     5b5:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     5b8:	83 c4 14             	add    $0x14,%esp
+     5bb:	5b                   	pop    %ebx
+     5bc:	5e                   	pop    %esi
+     5bd:	5f                   	pop    %edi
+     5be:	5d                   	pop    %ebp
+     5bf:	c3                   	ret
+    return -1;
+     5c0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     5c5:	eb f1                	jmp    5b8 <vclock_gettime+0xae>
+  return 0;
+     5c7:	b8 00 00 00 00       	mov    $0x0,%eax
+     5cc:	eb ea                	jmp    5b8 <vclock_gettime+0xae>
+
+000005ce <flush>:
+
+// Write out fd's buffer, or with fd < 0 every buffer.
+// Returns -1 if a write fails.
+int
+flush(int fd)
+{
+     5ce:	55                   	push   %ebp
+     5cf:	89 e5                	mov    %esp,%ebp
+     5d1:	56                   	push   %esi
+     5d2:	53                   	push   %ebx
+     5d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  int r, n;
+
+  if(fd < 0){
+     5d6:	85 c0                	test   %eax,%eax
+     5d8:	78 5d                	js     637 <flush+0x69>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+      if(flush(fd) < 0)
+        r = -1;
+    return r;
+  }
+  if(fd >= NOBUF || (n = obuf[fd].n) == 0)
+     5da:	83 f8 0f             	cmp    $0xf,%eax
+     5dd:	7f 64                	jg     643 <flush+0x75>
+     5df:	69 d0 08 02 00 00    	imul   $0x208,%eax,%edx
+     5e5:	8b b2 64 1c 00 00    	mov    0x1c64(%edx),%esi
+     5eb:	85 f6                	test   %esi,%esi
+     5ed:	74 59                	je     648 <flush+0x7a>
+    return 0;
+  obuf[fd].n = 0;
+     5ef:	c7 82 64 1c 00 00 00 	movl   $0x0,0x1c64(%edx)
+     5f6:	00 00 00 
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     5f9:	81 c2 68 1c 00 00    	add    $0x1c68,%edx
+     5ff:	83 ec 04             	sub    $0x4,%esp
+     602:	56                   	push   %esi
+     603:	52                   	push   %edx
+     604:	50                   	push   %eax
+     605:	e8 5a 03 00 00       	call   964 <write>
+     60a:	83 c4 10             	add    $0x10,%esp
+     60d:	39 f0                	cmp    %esi,%eax
+     60f:	75 40                	jne    651 <flush+0x83>
+     611:	be 00 00 00 00       	mov    $0x0,%esi
+     616:	eb 30                	jmp    648 <flush+0x7a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     618:	83 c3 01             	add    $0x1,%ebx
+     61b:	83 fb 0f             	cmp    $0xf,%ebx
+     61e:	7f 28                	jg     648 <flush+0x7a>
+      if(flush(fd) < 0)
+     620:	83 ec 0c             	sub    $0xc,%esp
+     623:	53                   	push   %ebx
+     624:	e8 a5 ff ff ff       	call   5ce <flush>
+     629:	83 c4 10             	add    $0x10,%esp
+     62c:	85 c0                	test   %eax,%eax
+     62e:	79 e8                	jns    618 <flush+0x4a>
+        r = -1;
+     630:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     635:	eb e1                	jmp    618 <flush+0x4a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     637:	be 00 00 00 00       	mov    $0x0,%esi
+     63c:	bb 00 00 00 00       	mov    $0x0,%ebx
+     641:	eb d8                	jmp    61b <flush+0x4d>
+    return 0;
+     643:	be 00 00 00 00       	mov    $0x0,%esi
+}
+     648:	89 f0                	mov    %esi,%eax
+     64a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     64d:	5b                   	pop    %ebx
+     64e:	5e                   	pop    %esi
+     64f:	5d                   	pop    %ebp
+     650:	c3                   	ret
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     651:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     656:	eb f0                	jmp    648 <flush+0x7a>
+
+00000658 <bufreset>:
+
+static void
+bufreset(int fd)
+{
+  if(fd >= 0 && fd < NOBUF){
+     658:	83 f8 0f             	cmp    $0xf,%eax
+     65b:	76 01                	jbe    65e <bufreset+0x6>
+     65d:	c3                   	ret
+{
+     65e:	55                   	push   %ebp
+     65f:	89 e5                	mov    %esp,%ebp
+     661:	53                   	push   %ebx
+     662:	83 ec 10             	sub    $0x10,%esp
+     665:	89 c3                	mov    %eax,%ebx
+    flush(fd);
+     667:	50                   	push   %eax
+     668:	e8 61 ff ff ff       	call   5ce <flush>
+    obuf[fd].mode = BUNKNOWN;
+     66d:	69 db 08 02 00 00    	imul   $0x208,%ebx,%ebx
+     673:	c7 83 60 1c 00 00 00 	movl   $0x0,0x1c60(%ebx)
+     67a:	00 00 00 
+     67d:	83 c4 10             	add    $0x10,%esp
+  }
+}
+     680:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     683:	c9                   	leave
+     684:	c3                   	ret
+
+00000685 <bufwrite>:
+
+// Write n bytes from p to fd, through its buffer.
+// Returns n, or -1 if a write fails.
+int
+bufwrite(int fd, const void *p, int n)
+{
+     685:	55                   	push   %ebp
+     686:	89 e5                	mov    %esp,%ebp
+     688:	57                   	push   %edi
+     689:	56                   	push   %esi
+     68a:	53                   	push   %ebx
+     68b:	83 ec 3c             	sub    $0x3c,%esp
+     68e:	8b 75 08             	mov    0x8(%ebp),%esi
+     691:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct stat st;
+  const char *s;
+  int i;
+
+  if(fd < 0 || fd >= NOBUF)
+     694:	83 fe 0f             	cmp    $0xf,%esi
+     697:	0f 87 a2 00 00 00    	ja     73f <bufwrite+0xba>
+    return write(fd, p, n);
+  if(obuf[fd].mode == BUNKNOWN){
+     69d:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     6a3:	83 b8 60 1c 00 00 00 	cmpl   $0x0,0x1c60(%eax)
+     6aa:	75 19                	jne    6c5 <bufwrite+0x40>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     6ac:	83 fe 02             	cmp    $0x2,%esi
+     6af:	0f 85 9c 00 00 00    	jne    751 <bufwrite+0xcc>
+      obuf[fd].mode = BNONE;
+     6b5:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     6bb:	c7 80 60 1c 00 00 01 	movl   $0x1,0x1c60(%eax)
+     6c2:	00 00 00 
+    else
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+  }
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     6c5:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     6cb:	89 da                	mov    %ebx,%edx
+     6cd:	03 90 64 1c 00 00    	add    0x1c64(%eax),%edx
+     6d3:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+     6d9:	0f 8f ae 00 00 00    	jg     78d <bufwrite+0x108>
+    return -1;
+  if(n >= OBUFSZ)
+     6df:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+     6e5:	0f 8f bd 00 00 00    	jg     7a8 <bufwrite+0x123>
+    return write(fd, p, n);
+  memmove(obuf[fd].buf + obuf[fd].n, p, n);
+     6eb:	69 d6 08 02 00 00    	imul   $0x208,%esi,%edx
+     6f1:	8d ba 60 1c 00 00    	lea    0x1c60(%edx),%edi
+     6f7:	8b 82 64 1c 00 00    	mov    0x1c64(%edx),%eax
+     6fd:	83 ec 04             	sub    $0x4,%esp
+     700:	53                   	push   %ebx
+     701:	ff 75 0c             	push   0xc(%ebp)
+     704:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     707:	8d 84 10 68 1c 00 00 	lea    0x1c68(%eax,%edx,1),%eax
+     70e:	50                   	push   %eax
+     70f:	e8 4c fd ff ff       	call   460 <memmove>
+  obuf[fd].n += n;
+     714:	01 5f 04             	add    %ebx,0x4(%edi)
+  if(obuf[fd].mode == BNONE)
+     717:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     71a:	8b 82 60 1c 00 00    	mov    0x1c60(%edx),%eax
+     720:	83 c4 10             	add    $0x10,%esp
+     723:	83 f8 01             	cmp    $0x1,%eax
+     726:	0f 84 91 00 00 00    	je     7bd <bufwrite+0x138>
+    return flush(fd) < 0 ? -1 : n;
+  if(obuf[fd].mode == BLINE)
+     72c:	83 f8 02             	cmp    $0x2,%eax
+     72f:	0f 84 ca 00 00 00    	je     7ff <bufwrite+0x17a>
+    for(s = p, i = 0; i < n; i++)
+      if(s[i] == '\n')
+        return flush(fd) < 0 ? -1 : n;
+  return n;
+     735:	89 d8                	mov    %ebx,%eax
+}
+     737:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     73a:	5b                   	pop    %ebx
+     73b:	5e                   	pop    %esi
+     73c:	5f                   	pop    %edi
+     73d:	5d                   	pop    %ebp
+     73e:	c3                   	ret
+    return write(fd, p, n);
+     73f:	83 ec 04             	sub    $0x4,%esp
+     742:	53                   	push   %ebx
+     743:	ff 75 0c             	push   0xc(%ebp)
+     746:	56                   	push   %esi
+     747:	e8 18 02 00 00       	call   964 <write>
+     74c:	83 c4 10             	add    $0x10,%esp
+     74f:	eb e6                	jmp    737 <bufwrite+0xb2>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     751:	83 ec 08             	sub    $0x8,%esp
+     754:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     757:	50                   	push   %eax
+     758:	56                   	push   %esi
+     759:	e8 51 02 00 00       	call   9af <fstat>
+     75e:	83 c4 10             	add    $0x10,%esp
+     761:	85 c0                	test   %eax,%eax
+     763:	0f 88 4c ff ff ff    	js     6b5 <bufwrite+0x30>
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+     769:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     76e:	74 16                	je     786 <bufwrite+0x101>
+     770:	ba 03 00 00 00       	mov    $0x3,%edx
+     775:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     77b:	89 90 60 1c 00 00    	mov    %edx,0x1c60(%eax)
+     781:	e9 3f ff ff ff       	jmp    6c5 <bufwrite+0x40>
+     786:	ba 02 00 00 00       	mov    $0x2,%edx
+     78b:	eb e8                	jmp    775 <bufwrite+0xf0>
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     78d:	83 ec 0c             	sub    $0xc,%esp
+     790:	56                   	push   %esi
+     791:	e8 38 fe ff ff       	call   5ce <flush>
+     796:	83 c4 10             	add    $0x10,%esp
+     799:	85 c0                	test   %eax,%eax
+     79b:	0f 89 3e ff ff ff    	jns    6df <bufwrite+0x5a>
+    return -1;
+     7a1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     7a6:	eb 8f                	jmp    737 <bufwrite+0xb2>
+    return write(fd, p, n);
+     7a8:	83 ec 04             	sub    $0x4,%esp
+     7ab:	53                   	push   %ebx
+     7ac:	ff 75 0c             	push   0xc(%ebp)
+     7af:	56                   	push   %esi
+     7b0:	e8 af 01 00 00       	call   964 <write>
+     7b5:	83 c4 10             	add    $0x10,%esp
+     7b8:	e9 7a ff ff ff       	jmp    737 <bufwrite+0xb2>
+    return flush(fd) < 0 ? -1 : n;
+     7bd:	83 ec 0c             	sub    $0xc,%esp
+     7c0:	56                   	push   %esi
+     7c1:	e8 08 fe ff ff       	call   5ce <flush>
+     7c6:	83 c4 10             	add    $0x10,%esp
+     7c9:	85 c0                	test   %eax,%eax
+     7cb:	78 07                	js     7d4 <bufwrite+0x14f>
+     7cd:	89 d8                	mov    %ebx,%eax
+     7cf:	e9 63 ff ff ff       	jmp    737 <bufwrite+0xb2>
+     7d4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     7d9:	e9 59 ff ff ff       	jmp    737 <bufwrite+0xb2>
+        return flush(fd) < 0 ? -1 : n;
+     7de:	83 ec 0c             	sub    $0xc,%esp
+     7e1:	56                   	push   %esi
+     7e2:	e8 e7 fd ff ff       	call   5ce <flush>
+     7e7:	83 c4 10             	add    $0x10,%esp
+     7ea:	85 c0                	test   %eax,%eax
+     7ec:	78 07                	js     7f5 <bufwrite+0x170>
+     7ee:	89 d8                	mov    %ebx,%eax
+     7f0:	e9 42 ff ff ff       	jmp    737 <bufwrite+0xb2>
+     7f5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     7fa:	e9 38 ff ff ff       	jmp    737 <bufwrite+0xb2>
+    for(s = p, i = 0; i < n; i++)
+     7ff:	b8 00 00 00 00       	mov    $0x0,%eax
+     804:	39 d8                	cmp    %ebx,%eax
+     806:	7d 0e                	jge    816 <bufwrite+0x191>
+      if(s[i] == '\n')
+     808:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     80b:	80 3c 01 0a          	cmpb   $0xa,(%ecx,%eax,1)
+     80f:	74 cd                	je     7de <bufwrite+0x159>
+    for(s = p, i = 0; i < n; i++)
+     811:	83 c0 01             	add    $0x1,%eax
+     814:	eb ee                	jmp    804 <bufwrite+0x17f>
+  return n;
+     816:	89 d8                	mov    %ebx,%eax
+     818:	e9 1a ff ff ff       	jmp    737 <bufwrite+0xb2>
+
+0000081d <fork>:
+
+int
+fork(void)
+{
+     81d:	55                   	push   %ebp
+     81e:	89 e5                	mov    %esp,%ebp
+     820:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     823:	6a ff                	push   $0xffffffff
+     825:	e8 a4 fd ff ff       	call   5ce <flush>
+  return _fork();
+     82a:	e8 bd 00 00 00       	call   8ec <_fork>
+}
+     82f:	c9                   	leave
+     830:	c3                   	ret
+
+00000831 <exit>:
+
+int
+exit(void)
+{
+     831:	55                   	push   %ebp
+     832:	89 e5                	mov    %esp,%ebp
+     834:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     837:	6a ff                	push   $0xffffffff
+     839:	e8 90 fd ff ff       	call   5ce <flush>
+  _exit();
+     83e:	e8 b8 00 00 00       	call   8fb <_exit>
+
+00000843 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     843:	55                   	push   %ebp
+     844:	89 e5                	mov    %esp,%ebp
+     846:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     849:	6a ff                	push   $0xffffffff
+     84b:	e8 7e fd ff ff       	call   5ce <flush>
+  return _exec(path, argv);
+     850:	83 c4 08             	add    $0x8,%esp
+     853:	ff 75 0c             	push   0xc(%ebp)
+     856:	ff 75 08             	push   0x8(%ebp)
+     859:	e8 bb 00 00 00       	call   919 <_exec>
+}
+     85e:	c9                   	leave
+     85f:	c3                   	ret
+
+00000860 <close>:
+
+int
+close(int fd)
+{
+     860:	55                   	push   %ebp
+     861:	89 e5                	mov    %esp,%ebp
+     863:	53                   	push   %ebx
+     864:	83 ec 04             	sub    $0x4,%esp
+     867:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bufreset(fd);
+     86a:	89 d8                	mov    %ebx,%eax
+     86c:	e8 e7 fd ff ff       	call   658 <bufreset>
+  return _close(fd);
+     871:	83 ec 0c             	sub    $0xc,%esp
+     874:	53                   	push   %ebx
+     875:	e8 90 00 00 00       	call   90a <_close>
+}
+     87a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     87d:	c9                   	leave
+     87e:	c3                   	ret
+
+0000087f <stat>:
+{
+     87f:	55                   	push   %ebp
+     880:	89 e5                	mov    %esp,%ebp
+     882:	56                   	push   %esi
+     883:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     884:	83 ec 08             	sub    $0x8,%esp
+     887:	6a 00                	push   $0x0
+     889:	ff 75 08             	push   0x8(%ebp)
+     88c:	e8 f1 00 00 00       	call   982 <open>
+  if(fd < 0)
+     891:	83 c4 10             	add    $0x10,%esp
+     894:	85 c0                	test   %eax,%eax
+     896:	78 24                	js     8bc <stat+0x3d>
+     898:	89 c3                	mov    %eax,%ebx
+  r = fstat(fd, st);
+     89a:	83 ec 08             	sub    $0x8,%esp
+     89d:	ff 75 0c             	push   0xc(%ebp)
+     8a0:	50                   	push   %eax
+     8a1:	e8 09 01 00 00       	call   9af <fstat>
+     8a6:	89 c6                	mov    %eax,%esi
+  close(fd);
+     8a8:	89 1c 24             	mov    %ebx,(%esp)
+     8ab:	e8 b0 ff ff ff       	call   860 <close>
+  return r;
+     8b0:	83 c4 10             	add    $0x10,%esp
+}
+     8b3:	89 f0                	mov    %esi,%eax
+     8b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     8b8:	5b                   	pop    %ebx
+     8b9:	5e                   	pop    %esi
+     8ba:	5d                   	pop    %ebp
+     8bb:	c3                   	ret
+    return -1;
+     8bc:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     8c1:	eb f0                	jmp    8b3 <stat+0x34>
+
+000008c3 <dup2>:
+
+int
+dup2(int oldfd, int newfd)
+{
+     8c3:	55                   	push   %ebp
+     8c4:	89 e5                	mov    %esp,%ebp
+     8c6:	56                   	push   %esi
+     8c7:	53                   	push   %ebx
+     8c8:	8b 75 08             	mov    0x8(%ebp),%esi
+     8cb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(oldfd != newfd)
+     8ce:	39 de                	cmp    %ebx,%esi
+     8d0:	75 11                	jne    8e3 <dup2+0x20>
+    bufreset(newfd);
+  return _dup2(oldfd, newfd);
+     8d2:	83 ec 08             	sub    $0x8,%esp
+     8d5:	53                   	push   %ebx
+     8d6:	56                   	push   %esi
+     8d7:	e8 4c 00 00 00       	call   928 <_dup2>
+}
+     8dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     8df:	5b                   	pop    %ebx
+     8e0:	5e                   	pop    %esi
+     8e1:	5d                   	pop    %ebp
+     8e2:	c3                   	ret
+    bufreset(newfd);
+     8e3:	89 d8                	mov    %ebx,%eax
+     8e5:	e8 6e fd ff ff       	call   658 <bufreset>
+     8ea:	eb e6                	jmp    8d2 <dup2+0xf>
+
+000008ec <_fork>:
+  1: ret
+
+#define SYSCALL(name) STUB(name, SYS_ ## name)
+
+# ulib.c wraps these, to flush printf()'s buffers first.
+STUB(_fork, SYS_fork)
+     8ec:	b8 01 00 00 00       	mov    $0x1,%eax
+     8f1:	89 e1                	mov    %esp,%ecx
+     8f3:	ba fa 08 00 00       	mov    $0x8fa,%edx
+     8f8:	0f 34                	sysenter
+     8fa:	c3                   	ret
+
+000008fb <_exit>:
+STUB(_exit, SYS_exit)
+     8fb:	b8 02 00 00 00       	mov    $0x2,%eax
+     900:	89 e1                	mov    %esp,%ecx
+     902:	ba 09 09 00 00       	mov    $0x909,%edx
+     907:	0f 34                	sysenter
+     909:	c3                   	ret
+
+0000090a <_close>:
+STUB(_close, SYS_close)
+     90a:	b8 15 00 00 00       	mov    $0x15,%eax
+     90f:	89 e1                	mov    %esp,%ecx
+     911:	ba 18 09 00 00       	mov    $0x918,%edx
+     916:	0f 34                	sysenter
+     918:	c3                   	ret
+
+00000919 <_exec>:
+STUB(_exec, SYS_exec)
+     919:	b8 07 00 00 00       	mov    $0x7,%eax
+     91e:	89 e1                	mov    %esp,%ecx
+     920:	ba 27 09 00 00       	mov    $0x927,%edx
+     925:	0f 34                	sysenter
+     927:	c3                   	ret
+
+00000928 <_dup2>:
+STUB(_dup2, SYS_dup2)
+     928:	b8 17 00 00 00       	mov    $0x17,%eax
+     92d:	89 e1                	mov    %esp,%ecx
+     92f:	ba 36 09 00 00       	mov    $0x936,%edx
+     934:	0f 34                	sysenter
+     936:	c3                   	ret
+
+00000937 <wait>:
+
+SYSCALL(wait)
+     937:	b8 03 00 00 00       	mov    $0x3,%eax
+     93c:	89 e1                	mov    %esp,%ecx
+     93e:	ba 45 09 00 00       	mov    $0x945,%edx
+     943:	0f 34                	sysenter
+     945:	c3                   	ret
+
+00000946 <pipe>:
+SYSCALL(pipe)
+     946:	b8 04 00 00 00       	mov    $0x4,%eax
+     94b:	89 e1                	mov    %esp,%ecx
+     94d:	ba 54 09 00 00       	mov    $0x954,%edx
+     952:	0f 34                	sysenter
+     954:	c3                   	ret
+
+00000955 <read>:
+SYSCALL(read)
+     955:	b8 05 00 00 00       	mov    $0x5,%eax
+     95a:	89 e1                	mov    %esp,%ecx
+     95c:	ba 63 09 00 00       	mov    $0x963,%edx
+     961:	0f 34                	sysenter
+     963:	c3                   	ret
+
+00000964 <write>:
+SYSCALL(write)
+     964:	b8 10 00 00 00       	mov    $0x10,%eax
+     969:	89 e1                	mov    %esp,%ecx
+     96b:	ba 72 09 00 00       	mov    $0x972,%edx
+     970:	0f 34                	sysenter
+     972:	c3                   	ret
+
+00000973 <kill>:
+SYSCALL(kill)
+     973:	b8 06 00 00 00       	mov    $0x6,%eax
+     978:	89 e1                	mov    %esp,%ecx
+     97a:	ba 81 09 00 00       	mov    $0x981,%edx
+     97f:	0f 34                	sysenter
+     981:	c3                   	ret
+
+00000982 <open>:
+SYSCALL(open)
+     982:	b8 0f 00 00 00       	mov    $0xf,%eax
+     987:	89 e1                	mov    %esp,%ecx
+     989:	ba 90 09 00 00       	mov    $0x990,%edx
+     98e:	0f 34                	sysenter
+     990:	c3                   	ret
+
+00000991 <mknod>:
+SYSCALL(mknod)
+     991:	b8 11 00 00 00       	mov    $0x11,%eax
+     996:	89 e1                	mov    %esp,%ecx
+     998:	ba 9f 09 00 00       	mov    $0x99f,%edx
+     99d:	0f 34                	sysenter
+     99f:	c3                   	ret
+
+000009a0 <unlink>:
+SYSCALL(unlink)
+     9a0:	b8 12 00 00 00       	mov    $0x12,%eax
+     9a5:	89 e1                	mov    %esp,%ecx
+     9a7:	ba ae 09 00 00       	mov    $0x9ae,%edx
+     9ac:	0f 34                	sysenter
+     9ae:	c3                   	ret
+
+000009af <fstat>:
+SYSCALL(fstat)
+     9af:	b8 08 00 00 00       	mov    $0x8,%eax
+     9b4:	89 e1                	mov    %esp,%ecx
+     9b6:	ba bd 09 00 00       	mov    $0x9bd,%edx
+     9bb:	0f 34                	sysenter
+     9bd:	c3                   	ret
+
+000009be <link>:
+SYSCALL(link)
+     9be:	b8 13 00 00 00       	mov    $0x13,%eax
+     9c3:	89 e1                	mov    %esp,%ecx
+     9c5:	ba cc 09 00 00       	mov    $0x9cc,%edx
+     9ca:	0f 34                	sysenter
+     9cc:	c3                   	ret
+
+000009cd <mkdir>:
+SYSCALL(mkdir)
+     9cd:	b8 14 00 00 00       	mov    $0x14,%eax
+     9d2:	89 e1                	mov    %esp,%ecx
+     9d4:	ba db 09 00 00       	mov    $0x9db,%edx
+     9d9:	0f 34                	sysenter
+     9db:	c3                   	ret
+
+000009dc <chdir>:
+SYSCALL(chdir)
+     9dc:	b8 09 00 00 00       	mov    $0x9,%eax
+     9e1:	89 e1                	mov    %esp,%ecx
+     9e3:	ba ea 09 00 00       	mov    $0x9ea,%edx
+     9e8:	0f 34                	sysenter
+     9ea:	c3                   	ret
+
+000009eb <dup>:
+SYSCALL(dup)
+     9eb:	b8 0a 00 00 00       	mov    $0xa,%eax
+     9f0:	89 e1                	mov    %esp,%ecx
+     9f2:	ba f9 09 00 00       	mov    $0x9f9,%edx
+     9f7:	0f 34                	sysenter
+     9f9:	c3                   	ret
+
+000009fa <getpid>:
+SYSCALL(getpid)
+     9fa:	b8 0b 00 00 00       	mov    $0xb,%eax
+     9ff:	89 e1                	mov    %esp,%ecx
+     a01:	ba 08 0a 00 00       	mov    $0xa08,%edx
+     a06:	0f 34                	sysenter
+     a08:	c3                   	ret
+
+00000a09 <sbrk>:
+SYSCALL(sbrk)
+     a09:	b8 0c 00 00 00       	mov    $0xc,%eax
+     a0e:	89 e1                	mov    %esp,%ecx
+     a10:	ba 17 0a 00 00       	mov    $0xa17,%edx
+     a15:	0f 34                	sysenter
+     a17:	c3                   	ret
+
+00000a18 <sleep>:
+SYSCALL(sleep)
+     a18:	b8 0d 00 00 00       	mov    $0xd,%eax
+     a1d:	89 e1                	mov    %esp,%ecx
+     a1f:	ba 26 0a 00 00       	mov    $0xa26,%edx
+     a24:	0f 34                	sysenter
+     a26:	c3                   	ret
+
+00000a27 <uptime>:
+SYSCALL(uptime)
+     a27:	b8 0e 00 00 00       	mov    $0xe,%eax
+     a2c:	89 e1                	mov    %esp,%ecx
+     a2e:	ba 35 0a 00 00       	mov    $0xa35,%edx
+     a33:	0f 34                	sysenter
+     a35:	c3                   	ret
+
+00000a36 <date>:
+SYSCALL(date)
+     a36:	b8 16 00 00 00       	mov    $0x16,%eax
+     a3b:	89 e1                	mov    %esp,%ecx
+     a3d:	ba 44 0a 00 00       	mov    $0xa44,%edx
+     a42:	0f 34                	sysenter
+     a44:	c3                   	ret
+
+00000a45 <faultaround>:
+SYSCALL(faultaround)
+     a45:	b8 18 00 00 00       	mov    $0x18,%eax
+     a4a:	89 e1                	mov    %esp,%ecx
+     a4c:	ba 53 0a 00 00       	mov    $0xa53,%edx
+     a51:	0f 34                	sysenter
+     a53:	c3                   	ret
+
+00000a54 <faultstat>:
+SYSCALL(faultstat)
+     a54:	b8 19 00 00 00       	mov    $0x19,%eax
+     a59:	89 e1                	mov    %esp,%ecx
+     a5b:	ba 62 0a 00 00       	mov    $0xa62,%edx
+     a60:	0f 34                	sysenter
+     a62:	c3                   	ret
+
+00000a63 <mmap>:
+SYSCALL(mmap)
+     a63:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     a68:	89 e1                	mov    %esp,%ecx
+     a6a:	ba 71 0a 00 00       	mov    $0xa71,%edx
+     a6f:	0f 34                	sysenter
+     a71:	c3                   	ret
+
+00000a72 <munmap>:
+SYSCALL(munmap)
+     a72:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     a77:	89 e1                	mov    %esp,%ecx
+     a79:	ba 80 0a 00 00       	mov    $0xa80,%edx
+     a7e:	0f 34                	sysenter
+     a80:	c3                   	ret
+
+00000a81 <largepages>:
+SYSCALL(largepages)
+     a81:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     a86:	89 e1                	mov    %esp,%ecx
+     a88:	ba 8f 0a 00 00       	mov    $0xa8f,%edx
+     a8d:	0f 34                	sysenter
+     a8f:	c3                   	ret
+
+00000a90 <spawn>:
+SYSCALL(spawn)
+     a90:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     a95:	89 e1                	mov    %esp,%ecx
+     a97:	ba 9e 0a 00 00       	mov    $0xa9e,%edx
+     a9c:	0f 34                	sysenter
+     a9e:	c3                   	ret
+
+00000a9f <setpriority>:
+SYSCALL(setpriority)
+     a9f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     aa4:	89 e1                	mov    %esp,%ecx
+     aa6:	ba ad 0a 00 00       	mov    $0xaad,%edx
+     aab:	0f 34                	sysenter
+     aad:	c3                   	ret
+
+00000aae <getpriority>:
+SYSCALL(getpriority)
+     aae:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     ab3:	89 e1                	mov    %esp,%ecx
+     ab5:	ba bc 0a 00 00       	mov    $0xabc,%edx
+     aba:	0f 34                	sysenter
+     abc:	c3                   	ret
+
+00000abd <getprocinfo>:
+SYSCALL(getprocinfo)
+     abd:	b8 20 00 00 00       	mov    $0x20,%eax
+     ac2:	89 e1                	mov    %esp,%ecx
+     ac4:	ba cb 0a 00 00       	mov    $0xacb,%edx
+     ac9:	0f 34                	sysenter
+     acb:	c3                   	ret
+
+00000acc <getcpuinfo>:
+SYSCALL(getcpuinfo)
+     acc:	b8 21 00 00 00       	mov    $0x21,%eax
+     ad1:	89 e1                	mov    %esp,%ecx
+     ad3:	ba da 0a 00 00       	mov    $0xada,%edx
+     ad8:	0f 34                	sysenter
+     ada:	c3                   	ret
+
+00000adb <clone>:
+SYSCALL(clone)
+     adb:	b8 22 00 00 00       	mov    $0x22,%eax
+     ae0:	89 e1                	mov    %esp,%ecx
+     ae2:	ba e9 0a 00 00       	mov    $0xae9,%edx
+     ae7:	0f 34                	sysenter
+     ae9:	c3                   	ret
+
+00000aea <join>:
+SYSCALL(join)
+     aea:	b8 23 00 00 00       	mov    $0x23,%eax
+     aef:	89 e1                	mov    %esp,%ecx
+     af1:	ba f8 0a 00 00       	mov    $0xaf8,%edx
+     af6:	0f 34                	sysenter
+     af8:	c3                   	ret
+
+00000af9 <futex_wait>:
+SYSCALL(futex_wait)
+     af9:	b8 24 00 00 00       	mov    $0x24,%eax
+     afe:	89 e1                	mov    %esp,%ecx
+     b00:	ba 07 0b 00 00       	mov    $0xb07,%edx
+     b05:	0f 34                	sysenter
+     b07:	c3                   	ret
+
+00000b08 <futex_wake>:
+SYSCALL(futex_wake)
+     b08:	b8 25 00 00 00       	mov    $0x25,%eax
+     b0d:	89 e1                	mov    %esp,%ecx
+     b0f:	ba 16 0b 00 00       	mov    $0xb16,%edx
+     b14:	0f 34                	sysenter
+     b16:	c3                   	ret
+
+00000b17 <setaffinity>:
+SYSCALL(setaffinity)
+     b17:	b8 26 00 00 00       	mov    $0x26,%eax
+     b1c:	89 e1                	mov    %esp,%ecx
+     b1e:	ba 25 0b 00 00       	mov    $0xb25,%edx
+     b23:	0f 34                	sysenter
+     b25:	c3                   	ret
+
+00000b26 <getaffinity>:
+SYSCALL(getaffinity)
+     b26:	b8 27 00 00 00       	mov    $0x27,%eax
+     b2b:	89 e1                	mov    %esp,%ecx
+     b2d:	ba 34 0b 00 00       	mov    $0xb34,%edx
+     b32:	0f 34                	sysenter
+     b34:	c3                   	ret
+
+00000b35 <clock_gettime>:
+SYSCALL(clock_gettime)
+     b35:	b8 28 00 00 00       	mov    $0x28,%eax
+     b3a:	89 e1                	mov    %esp,%ecx
+     b3c:	ba 43 0b 00 00       	mov    $0xb43,%edx
+     b41:	0f 34                	sysenter
+     b43:	c3                   	ret
+
+00000b44 <msleep>:
+SYSCALL(msleep)
+     b44:	b8 29 00 00 00       	mov    $0x29,%eax
+     b49:	89 e1                	mov    %esp,%ecx
+     b4b:	ba 52 0b 00 00       	mov    $0xb52,%edx
+     b50:	0f 34                	sysenter
+     b52:	c3                   	ret
+
+00000b53 <lockstat>:
+SYSCALL(lockstat)
+     b53:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     b58:	89 e1                	mov    %esp,%ecx
+     b5a:	ba 61 0b 00 00       	mov    $0xb61,%edx
+     b5f:	0f 34                	sysenter
+     b61:	c3                   	ret
+
+00000b62 <bstat>:
+SYSCALL(bstat)
+     b62:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     b67:	89 e1                	mov    %esp,%ecx
+     b69:	ba 70 0b 00 00       	mov    $0xb70,%edx
+     b6e:	0f 34                	sysenter
+     b70:	c3                   	ret
+
+00000b71 <iostat>:
+SYSCALL(iostat)
+     b71:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     b76:	89 e1                	mov    %esp,%ecx
+     b78:	ba 7f 0b 00 00       	mov    $0xb7f,%edx
+     b7d:	0f 34                	sysenter
+     b7f:	c3                   	ret
+
+00000b80 <fsync>:
+SYSCALL(fsync)
+     b80:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     b85:	89 e1                	mov    %esp,%ecx
+     b87:	ba 8e 0b 00 00       	mov    $0xb8e,%edx
+     b8c:	0f 34                	sysenter
+     b8e:	c3                   	ret
+
+00000b8f <pread>:
+SYSCALL(pread)
+     b8f:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     b94:	89 e1                	mov    %esp,%ecx
+     b96:	ba 9d 0b 00 00       	mov    $0xb9d,%edx
+     b9b:	0f 34                	sysenter
+     b9d:	c3                   	ret
+
+00000b9e <pwrite>:
+SYSCALL(pwrite)
+     b9e:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     ba3:	89 e1                	mov    %esp,%ecx
+     ba5:	ba ac 0b 00 00       	mov    $0xbac,%edx
+     baa:	0f 34                	sysenter
+     bac:	c3                   	ret
+
+00000bad <readv>:
+SYSCALL(readv)
+     bad:	b8 30 00 00 00       	mov    $0x30,%eax
+     bb2:	89 e1                	mov    %esp,%ecx
+     bb4:	ba bb 0b 00 00       	mov    $0xbbb,%edx
+     bb9:	0f 34                	sysenter
+     bbb:	c3                   	ret
+
+00000bbc <writev>:
+SYSCALL(writev)
+     bbc:	b8 31 00 00 00       	mov    $0x31,%eax
+     bc1:	89 e1                	mov    %esp,%ecx
+     bc3:	ba ca 0b 00 00       	mov    $0xbca,%edx
+     bc8:	0f 34                	sysenter
+     bca:	c3                   	ret
+
+00000bcb <sendfile>:
+SYSCALL(sendfile)
+     bcb:	b8 32 00 00 00       	mov    $0x32,%eax
+     bd0:	89 e1                	mov    %esp,%ecx
+     bd2:	ba d9 0b 00 00       	mov    $0xbd9,%edx
+     bd7:	0f 34                	sysenter
+     bd9:	c3                   	ret
+
+00000bda <fcntl>:
+SYSCALL(fcntl)
+     bda:	b8 33 00 00 00       	mov    $0x33,%eax
+     bdf:	89 e1                	mov    %esp,%ecx
+     be1:	ba e8 0b 00 00       	mov    $0xbe8,%edx
+     be6:	0f 34                	sysenter
+     be8:	c3                   	ret
+
+00000be9 <mount>:
+SYSCALL(mount)
+     be9:	b8 34 00 00 00       	mov    $0x34,%eax
+     bee:	89 e1                	mov    %esp,%ecx
+     bf0:	ba f7 0b 00 00       	mov    $0xbf7,%edx
+     bf5:	0f 34                	sysenter
+     bf7:	c3                   	ret
+
+00000bf8 <getdents>:
+SYSCALL(getdents)
+     bf8:	b8 35 00 00 00       	mov    $0x35,%eax
+     bfd:	89 e1                	mov    %esp,%ecx
+     bff:	ba 06 0c 00 00       	mov    $0xc06,%edx
+     c04:	0f 34                	sysenter
+     c06:	c3                   	ret
+
+00000c07 <fstatat>:
+SYSCALL(fstatat)
+     c07:	b8 36 00 00 00       	mov    $0x36,%eax
+     c0c:	89 e1                	mov    %esp,%ecx
+     c0e:	ba 15 0c 00 00       	mov    $0xc15,%edx
+     c13:	0f 34                	sysenter
+     c15:	c3                   	ret
+
+00000c16 <sysstat>:
+SYSCALL(sysstat)
+     c16:	b8 37 00 00 00       	mov    $0x37,%eax
+     c1b:	89 e1                	mov    %esp,%ecx
+     c1d:	ba 24 0c 00 00       	mov    $0xc24,%edx
+     c22:	0f 34                	sysenter
+     c24:	c3                   	ret
+
+00000c25 <ringenter>:
+SYSCALL(ringenter)
+     c25:	b8 38 00 00 00       	mov    $0x38,%eax
+     c2a:	89 e1                	mov    %esp,%ecx
+     c2c:	ba 33 0c 00 00       	mov    $0xc33,%edx
+     c31:	0f 34                	sysenter
+     c33:	c3                   	ret
+
+00000c34 <trace>:
+SYSCALL(trace)
+     c34:	b8 39 00 00 00       	mov    $0x39,%eax
+     c39:	89 e1                	mov    %esp,%ecx
+     c3b:	ba 42 0c 00 00       	mov    $0xc42,%edx
+     c40:	0f 34                	sysenter
+     c42:	c3                   	ret
+
+00000c43 <memstat>:
+SYSCALL(memstat)
+     c43:	b8 3a 00 00 00       	mov    $0x3a,%eax
+     c48:	89 e1                	mov    %esp,%ecx
+     c4a:	ba 51 0c 00 00       	mov    $0xc51,%edx
+     c4f:	0f 34                	sysenter
+     c51:	c3                   	ret
+
+00000c52 <shmget>:
+SYSCALL(shmget)
+     c52:	b8 3b 00 00 00       	mov    $0x3b,%eax
+     c57:	89 e1                	mov    %esp,%ecx
+     c59:	ba 60 0c 00 00       	mov    $0xc60,%edx
+     c5e:	0f 34                	sysenter
+     c60:	c3                   	ret
+
+00000c61 <shmat>:
+SYSCALL(shmat)
+     c61:	b8 3c 00 00 00       	mov    $0x3c,%eax
+     c66:	89 e1                	mov    %esp,%ecx
+     c68:	ba 6f 0c 00 00       	mov    $0xc6f,%edx
+     c6d:	0f 34                	sysenter
+     c6f:	c3                   	ret
+
+00000c70 <shmdt>:
+SYSCALL(shmdt)
+     c70:	b8 3d 00 00 00       	mov    $0x3d,%eax
+     c75:	89 e1                	mov    %esp,%ecx
+     c77:	ba 7e 0c 00 00       	mov    $0xc7e,%edx
+     c7c:	0f 34                	sysenter
+     c7e:	c3                   	ret
+
+00000c7f <irqstat>:
+SYSCALL(irqstat)
+     c7f:	b8 3e 00 00 00       	mov    $0x3e,%eax
+     c84:	89 e1                	mov    %esp,%ecx
+     c86:	ba 8d 0c 00 00       	mov    $0xc8d,%edx
+     c8b:	0f 34                	sysenter
+     c8d:	c3                   	ret
+
+00000c8e <irqroute>:
+SYSCALL(irqroute)
+     c8e:	b8 3f 00 00 00       	mov    $0x3f,%eax
+     c93:	89 e1                	mov    %esp,%ecx
+     c95:	ba 9c 0c 00 00       	mov    $0xc9c,%edx
+     c9a:	0f 34                	sysenter
+     c9c:	c3                   	ret
+
+00000c9d <putc>:
+  char buf[64];
+};
+
+static void
+putc(struct out *o, char c)
+{
+     c9d:	55                   	push   %ebp
+     c9e:	89 e5                	mov    %esp,%ebp
+     ca0:	56                   	push   %esi
+     ca1:	53                   	push   %ebx
+     ca2:	89 c3                	mov    %eax,%ebx
+     ca4:	89 d6                	mov    %edx,%esi
+  if(o->n == sizeof(o->buf)){
+     ca6:	8b 40 04             	mov    0x4(%eax),%eax
+     ca9:	83 f8 40             	cmp    $0x40,%eax
+     cac:	74 16                	je     cc4 <putc+0x27>
+    bufwrite(o->fd, o->buf, o->n);
+    o->n = 0;
+  }
+  o->buf[o->n++] = c;
+     cae:	8b 43 04             	mov    0x4(%ebx),%eax
+     cb1:	8d 50 01             	lea    0x1(%eax),%edx
+     cb4:	89 53 04             	mov    %edx,0x4(%ebx)
+     cb7:	89 f1                	mov    %esi,%ecx
+     cb9:	88 4c 03 08          	mov    %cl,0x8(%ebx,%eax,1)
+}
+     cbd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     cc0:	5b                   	pop    %ebx
+     cc1:	5e                   	pop    %esi
+     cc2:	5d                   	pop    %ebp
+     cc3:	c3                   	ret
+    bufwrite(o->fd, o->buf, o->n);
+     cc4:	8d 53 08             	lea    0x8(%ebx),%edx
+     cc7:	83 ec 04             	sub    $0x4,%esp
+     cca:	50                   	push   %eax
+     ccb:	52                   	push   %edx
+     ccc:	ff 33                	push   (%ebx)
+     cce:	e8 b2 f9 ff ff       	call   685 <bufwrite>
+    o->n = 0;
+     cd3:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     cda:	83 c4 10             	add    $0x10,%esp
+     cdd:	eb cf                	jmp    cae <putc+0x11>
+
+00000cdf <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     cdf:	55                   	push   %ebp
+     ce0:	89 e5                	mov    %esp,%ebp
+     ce2:	57                   	push   %edi
+     ce3:	56                   	push   %esi
+     ce4:	53                   	push   %ebx
+     ce5:	83 ec 2c             	sub    $0x2c,%esp
+     ce8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     ceb:	89 d0                	mov    %edx,%eax
+     ced:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+     cef:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     cf3:	0f 95 c1             	setne  %cl
+     cf6:	c1 ea 1f             	shr    $0x1f,%edx
+     cf9:	84 d1                	test   %dl,%cl
+     cfb:	74 44                	je     d41 <printint+0x62>
+    neg = 1;
+    x = -xx;
+     cfd:	f7 d8                	neg    %eax
+     cff:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+     d01:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     d08:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+     d0d:	89 c8                	mov    %ecx,%eax
+     d0f:	ba 00 00 00 00       	mov    $0x0,%edx
+     d14:	f7 f6                	div    %esi
+     d16:	89 df                	mov    %ebx,%edi
+     d18:	83 c3 01             	add    $0x1,%ebx
+     d1b:	0f b6 92 94 15 00 00 	movzbl 0x1594(%edx),%edx
+     d22:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+     d26:	89 ca                	mov    %ecx,%edx
+     d28:	89 c1                	mov    %eax,%ecx
+     d2a:	39 f2                	cmp    %esi,%edx
+     d2c:	73 df                	jae    d0d <printint+0x2e>
+  if(neg)
+     d2e:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     d32:	74 31                	je     d65 <printint+0x86>
+    buf[i++] = '-';
+     d34:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+     d39:	8d 5f 02             	lea    0x2(%edi),%ebx
+     d3c:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     d3f:	eb 17                	jmp    d58 <printint+0x79>
+    x = xx;
+     d41:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+     d43:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     d4a:	eb bc                	jmp    d08 <printint+0x29>
+
+  while(--i >= 0)
+    putc(o, buf[i]);
+     d4c:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+     d51:	89 f0                	mov    %esi,%eax
+     d53:	e8 45 ff ff ff       	call   c9d <putc>
+  while(--i >= 0)
+     d58:	83 eb 01             	sub    $0x1,%ebx
+     d5b:	79 ef                	jns    d4c <printint+0x6d>
+}
+     d5d:	83 c4 2c             	add    $0x2c,%esp
+     d60:	5b                   	pop    %ebx
+     d61:	5e                   	pop    %esi
+     d62:	5f                   	pop    %edi
+     d63:	5d                   	pop    %ebp
+     d64:	c3                   	ret
+     d65:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     d68:	eb ee                	jmp    d58 <printint+0x79>
+
+00000d6a <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     d6a:	55                   	push   %ebp
+     d6b:	89 e5                	mov    %esp,%ebp
+     d6d:	57                   	push   %edi
+     d6e:	56                   	push   %esi
+     d6f:	53                   	push   %ebx
+     d70:	83 ec 6c             	sub    $0x6c,%esp
+  int c, i, state;
+  uint *ap;
+  struct out out, *o;
+
+  o = &out;
+  o->fd = fd;
+     d73:	8b 45 08             	mov    0x8(%ebp),%eax
+     d76:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  o->n = 0;
+     d79:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+     d80:	8d 45 10             	lea    0x10(%ebp),%eax
+     d83:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  state = 0;
+     d86:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+     d8b:	bb 00 00 00 00       	mov    $0x0,%ebx
+     d90:	eb 14                	jmp    da6 <printf+0x3c>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(o, c);
+     d92:	89 fa                	mov    %edi,%edx
+     d94:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d97:	e8 01 ff ff ff       	call   c9d <putc>
+     d9c:	eb 05                	jmp    da3 <printf+0x39>
+      }
+    } else if(state == '%'){
+     d9e:	83 fe 25             	cmp    $0x25,%esi
+     da1:	74 25                	je     dc8 <printf+0x5e>
+  for(i = 0; fmt[i]; i++){
+     da3:	83 c3 01             	add    $0x1,%ebx
+     da6:	8b 45 0c             	mov    0xc(%ebp),%eax
+     da9:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+     dad:	84 c0                	test   %al,%al
+     daf:	0f 84 20 01 00 00    	je     ed5 <printf+0x16b>
+    c = fmt[i] & 0xff;
+     db5:	0f be f8             	movsbl %al,%edi
+     db8:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     dbb:	85 f6                	test   %esi,%esi
+     dbd:	75 df                	jne    d9e <printf+0x34>
+      if(c == '%'){
+     dbf:	83 f8 25             	cmp    $0x25,%eax
+     dc2:	75 ce                	jne    d92 <printf+0x28>
+        state = '%';
+     dc4:	89 c6                	mov    %eax,%esi
+     dc6:	eb db                	jmp    da3 <printf+0x39>
+      if(c == 'd'){
+     dc8:	83 f8 25             	cmp    $0x25,%eax
+     dcb:	0f 84 cf 00 00 00    	je     ea0 <printf+0x136>
+     dd1:	0f 8c dd 00 00 00    	jl     eb4 <printf+0x14a>
+     dd7:	83 f8 78             	cmp    $0x78,%eax
+     dda:	0f 8f d4 00 00 00    	jg     eb4 <printf+0x14a>
+     de0:	83 f8 63             	cmp    $0x63,%eax
+     de3:	0f 8c cb 00 00 00    	jl     eb4 <printf+0x14a>
+     de9:	83 e8 63             	sub    $0x63,%eax
+     dec:	83 f8 15             	cmp    $0x15,%eax
+     def:	0f 87 bf 00 00 00    	ja     eb4 <printf+0x14a>
+     df5:	ff 24 85 3c 15 00 00 	jmp    *0x153c(,%eax,4)
+        printint(o, *ap, 10, 1);
+     dfc:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     dff:	8b 17                	mov    (%edi),%edx
+     e01:	83 ec 0c             	sub    $0xc,%esp
+     e04:	6a 01                	push   $0x1
+     e06:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     e0b:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     e0e:	e8 cc fe ff ff       	call   cdf <printint>
+        ap++;
+     e13:	83 c7 04             	add    $0x4,%edi
+     e16:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     e19:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(o, '%');
+        putc(o, c);
+      }
+      state = 0;
+     e1c:	be 00 00 00 00       	mov    $0x0,%esi
+     e21:	eb 80                	jmp    da3 <printf+0x39>
+        printint(o, *ap, 16, 0);
+     e23:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     e26:	8b 17                	mov    (%edi),%edx
+     e28:	83 ec 0c             	sub    $0xc,%esp
+     e2b:	6a 00                	push   $0x0
+     e2d:	b9 10 00 00 00       	mov    $0x10,%ecx
+     e32:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     e35:	e8 a5 fe ff ff       	call   cdf <printint>
+        ap++;
+     e3a:	83 c7 04             	add    $0x4,%edi
+     e3d:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     e40:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     e43:	be 00 00 00 00       	mov    $0x0,%esi
+     e48:	e9 56 ff ff ff       	jmp    da3 <printf+0x39>
+        s = (char*)*ap;
+     e4d:	8b 45 94             	mov    -0x6c(%ebp),%eax
+     e50:	8b 30                	mov    (%eax),%esi
+        ap++;
+     e52:	83 c0 04             	add    $0x4,%eax
+     e55:	89 45 94             	mov    %eax,-0x6c(%ebp)
+        if(s == 0)
+     e58:	85 f6                	test   %esi,%esi
+     e5a:	75 15                	jne    e71 <printf+0x107>
+          s = "(null)";
+     e5c:	be 35 15 00 00       	mov    $0x1535,%esi
+     e61:	eb 0e                	jmp    e71 <printf+0x107>
+          putc(o, *s);
+     e63:	0f be d2             	movsbl %dl,%edx
+     e66:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     e69:	e8 2f fe ff ff       	call   c9d <putc>
+          s++;
+     e6e:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+     e71:	0f b6 16             	movzbl (%esi),%edx
+     e74:	84 d2                	test   %dl,%dl
+     e76:	75 eb                	jne    e63 <printf+0xf9>
+      state = 0;
+     e78:	be 00 00 00 00       	mov    $0x0,%esi
+     e7d:	e9 21 ff ff ff       	jmp    da3 <printf+0x39>
+        putc(o, *ap);
+     e82:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     e85:	0f be 17             	movsbl (%edi),%edx
+     e88:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     e8b:	e8 0d fe ff ff       	call   c9d <putc>
+        ap++;
+     e90:	83 c7 04             	add    $0x4,%edi
+     e93:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+      state = 0;
+     e96:	be 00 00 00 00       	mov    $0x0,%esi
+     e9b:	e9 03 ff ff ff       	jmp    da3 <printf+0x39>
+        putc(o, c);
+     ea0:	89 fa                	mov    %edi,%edx
+     ea2:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     ea5:	e8 f3 fd ff ff       	call   c9d <putc>
+      state = 0;
+     eaa:	be 00 00 00 00       	mov    $0x0,%esi
+     eaf:	e9 ef fe ff ff       	jmp    da3 <printf+0x39>
+        putc(o, '%');
+     eb4:	ba 25 00 00 00       	mov    $0x25,%edx
+     eb9:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     ebc:	e8 dc fd ff ff       	call   c9d <putc>
+        putc(o, c);
+     ec1:	89 fa                	mov    %edi,%edx
+     ec3:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     ec6:	e8 d2 fd ff ff       	call   c9d <putc>
+      state = 0;
+     ecb:	be 00 00 00 00       	mov    $0x0,%esi
+     ed0:	e9 ce fe ff ff       	jmp    da3 <printf+0x39>
+    }
+  }
+  if(o->n > 0)
+     ed5:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     ed8:	85 c0                	test   %eax,%eax
+     eda:	7f 08                	jg     ee4 <printf+0x17a>
+    bufwrite(fd, o->buf, o->n);
+}
+     edc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     edf:	5b                   	pop    %ebx
+     ee0:	5e                   	pop    %esi
+     ee1:	5f                   	pop    %edi
+     ee2:	5d                   	pop    %ebp
+     ee3:	c3                   	ret
+    bufwrite(fd, o->buf, o->n);
+     ee4:	83 ec 04             	sub    $0x4,%esp
+     ee7:	50                   	push   %eax
+     ee8:	8d 45 a8             	lea    -0x58(%ebp),%eax
+     eeb:	50                   	push   %eax
+     eec:	ff 75 08             	push   0x8(%ebp)
+     eef:	e8 91 f7 ff ff       	call   685 <bufwrite>
+     ef4:	83 c4 10             	add    $0x10,%esp
+}
+     ef7:	eb e3                	jmp    edc <printf+0x172>
+
+00000ef9 <largefree>:
+  return &b->h;
+}
+
+static void
+largefree(Fblock *b)
+{
+     ef9:	55                   	push   %ebp
+     efa:	89 e5                	mov    %esp,%ebp
+     efc:	57                   	push   %edi
+     efd:	56                   	push   %esi
+     efe:	53                   	push   %ebx
+     eff:	83 ec 0c             	sub    $0xc,%esp
+     f02:	89 c1                	mov    %eax,%ecx
+  Fblock **pp, *p, *prev;
+
+  prev = 0;
+     f04:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     f09:	ba ec 3c 00 00       	mov    $0x3cec,%edx
+     f0e:	eb 05                	jmp    f15 <largefree+0x1c>
+     f10:	8d 50 08             	lea    0x8(%eax),%edx
+    prev = p;
+     f13:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     f15:	8b 02                	mov    (%edx),%eax
+     f17:	85 c0                	test   %eax,%eax
+     f19:	74 04                	je     f1f <largefree+0x26>
+     f1b:	39 c8                	cmp    %ecx,%eax
+     f1d:	72 f1                	jb     f10 <largefree+0x17>
+  b->next = p;
+     f1f:	89 41 08             	mov    %eax,0x8(%ecx)
+  if(p && (char*)b + b->h.size == (char*)p){
+     f22:	85 c0                	test   %eax,%eax
+     f24:	74 09                	je     f2f <largefree+0x36>
+     f26:	8b 31                	mov    (%ecx),%esi
+     f28:	8d 3c 31             	lea    (%ecx,%esi,1),%edi
+     f2b:	39 c7                	cmp    %eax,%edi
+     f2d:	74 21                	je     f50 <largefree+0x57>
+    b->h.size += p->h.size;
+    b->next = p->next;
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+     f2f:	85 db                	test   %ebx,%ebx
+     f31:	74 09                	je     f3c <largefree+0x43>
+     f33:	8b 03                	mov    (%ebx),%eax
+     f35:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+     f38:	39 ce                	cmp    %ecx,%esi
+     f3a:	74 20                	je     f5c <largefree+0x63>
+    prev->h.size += b->h.size;
+    prev->next = b->next;
+  } else
+    *pp = b;
+     f3c:	89 0a                	mov    %ecx,(%edx)
+
+  // Give the top of the heap back.  With threads sharing the
+  // address space sbrk() cannot shrink it; keep the block then.
+  for(pp = &large; (*pp)->next; pp = &(*pp)->next)
+     f3e:	be ec 3c 00 00       	mov    $0x3cec,%esi
+     f43:	8b 1e                	mov    (%esi),%ebx
+     f45:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+     f49:	74 1d                	je     f68 <largefree+0x6f>
+     f4b:	8d 73 08             	lea    0x8(%ebx),%esi
+     f4e:	eb f3                	jmp    f43 <largefree+0x4a>
+    b->h.size += p->h.size;
+     f50:	03 30                	add    (%eax),%esi
+     f52:	89 31                	mov    %esi,(%ecx)
+    b->next = p->next;
+     f54:	8b 40 08             	mov    0x8(%eax),%eax
+     f57:	89 41 08             	mov    %eax,0x8(%ecx)
+     f5a:	eb d3                	jmp    f2f <largefree+0x36>
+    prev->h.size += b->h.size;
+     f5c:	03 01                	add    (%ecx),%eax
+     f5e:	89 03                	mov    %eax,(%ebx)
+    prev->next = b->next;
+     f60:	8b 41 08             	mov    0x8(%ecx),%eax
+     f63:	89 43 08             	mov    %eax,0x8(%ebx)
+     f66:	eb d6                	jmp    f3e <largefree+0x45>
+    ;
+  b = *pp;
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     f68:	89 df                	mov    %ebx,%edi
+     f6a:	03 3b                	add    (%ebx),%edi
+     f6c:	83 ec 0c             	sub    $0xc,%esp
+     f6f:	6a 00                	push   $0x0
+     f71:	e8 93 fa ff ff       	call   a09 <sbrk>
+     f76:	83 c4 10             	add    $0x10,%esp
+     f79:	39 c7                	cmp    %eax,%edi
+     f7b:	74 08                	je     f85 <largefree+0x8c>
+    *pp = 0;
+}
+     f7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f80:	5b                   	pop    %ebx
+     f81:	5e                   	pop    %esi
+     f82:	5f                   	pop    %edi
+     f83:	5d                   	pop    %ebp
+     f84:	c3                   	ret
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     f85:	8b 03                	mov    (%ebx),%eax
+     f87:	f7 d8                	neg    %eax
+     f89:	83 ec 0c             	sub    $0xc,%esp
+     f8c:	50                   	push   %eax
+     f8d:	e8 77 fa ff ff       	call   a09 <sbrk>
+     f92:	83 c4 10             	add    $0x10,%esp
+     f95:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f98:	74 e3                	je     f7d <largefree+0x84>
+    *pp = 0;
+     f9a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+     fa0:	eb db                	jmp    f7d <largefree+0x84>
+
+00000fa2 <more>:
+{
+     fa2:	55                   	push   %ebp
+     fa3:	89 e5                	mov    %esp,%ebp
+     fa5:	56                   	push   %esi
+     fa6:	53                   	push   %ebx
+     fa7:	89 c6                	mov    %eax,%esi
+  pad = -(uint)sbrk(0) & 7;
+     fa9:	83 ec 0c             	sub    $0xc,%esp
+     fac:	6a 00                	push   $0x0
+     fae:	e8 56 fa ff ff       	call   a09 <sbrk>
+     fb3:	f7 d8                	neg    %eax
+     fb5:	89 c3                	mov    %eax,%ebx
+     fb7:	83 e3 07             	and    $0x7,%ebx
+  if((p = sbrk(n + pad)) == (char*)-1)
+     fba:	01 de                	add    %ebx,%esi
+     fbc:	89 34 24             	mov    %esi,(%esp)
+     fbf:	e8 45 fa ff ff       	call   a09 <sbrk>
+     fc4:	83 c4 10             	add    $0x10,%esp
+     fc7:	83 f8 ff             	cmp    $0xffffffff,%eax
+     fca:	74 09                	je     fd5 <more+0x33>
+  return p + pad;
+     fcc:	01 d8                	add    %ebx,%eax
+}
+     fce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     fd1:	5b                   	pop    %ebx
+     fd2:	5e                   	pop    %esi
+     fd3:	5d                   	pop    %ebp
+     fd4:	c3                   	ret
+    return 0;
+     fd5:	b8 00 00 00 00       	mov    $0x0,%eax
+     fda:	eb f2                	jmp    fce <more+0x2c>
+
+00000fdc <slaballoc>:
+{
+     fdc:	55                   	push   %ebp
+     fdd:	89 e5                	mov    %esp,%ebp
+     fdf:	56                   	push   %esi
+     fe0:	53                   	push   %ebx
+     fe1:	89 c6                	mov    %eax,%esi
+  n = 1 << (MINSHIFT + c);
+     fe3:	8d 48 04             	lea    0x4(%eax),%ecx
+     fe6:	bb 01 00 00 00       	mov    $0x1,%ebx
+     feb:	d3 e3                	shl    %cl,%ebx
+  if(slab + n > slabend){
+     fed:	89 d8                	mov    %ebx,%eax
+     fef:	03 05 e8 3c 00 00    	add    0x3ce8,%eax
+     ff5:	39 05 e4 3c 00 00    	cmp    %eax,0x3ce4
+     ffb:	72 17                	jb     1014 <slaballoc+0x38>
+  h = (Header*)slab;
+     ffd:	a1 e8 3c 00 00       	mov    0x3ce8,%eax
+  slab += n;
+    1002:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+    1005:	89 15 e8 3c 00 00    	mov    %edx,0x3ce8
+  h->size = n;
+    100b:	89 18                	mov    %ebx,(%eax)
+  h->class = c;
+    100d:	89 70 04             	mov    %esi,0x4(%eax)
+}
+    1010:	5b                   	pop    %ebx
+    1011:	5e                   	pop    %esi
+    1012:	5d                   	pop    %ebp
+    1013:	c3                   	ret
+    if((p = more(SLABSZ)) == 0)
+    1014:	b8 00 40 00 00       	mov    $0x4000,%eax
+    1019:	e8 84 ff ff ff       	call   fa2 <more>
+    101e:	85 c0                	test   %eax,%eax
+    1020:	74 ee                	je     1010 <slaballoc+0x34>
+    if(p != slabend)
+    1022:	39 05 e4 3c 00 00    	cmp    %eax,0x3ce4
+    1028:	74 05                	je     102f <slaballoc+0x53>
+      slab = p;
+    102a:	a3 e8 3c 00 00       	mov    %eax,0x3ce8
+    slabend = p + SLABSZ;
+    102f:	05 00 40 00 00       	add    $0x4000,%eax
+    1034:	a3 e4 3c 00 00       	mov    %eax,0x3ce4
+    1039:	eb c2                	jmp    ffd <slaballoc+0x21>
+
+0000103b <largealloc>:
+{
+    103b:	55                   	push   %ebp
+    103c:	89 e5                	mov    %esp,%ebp
+    103e:	56                   	push   %esi
+    103f:	53                   	push   %ebx
+    1040:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+    1042:	b9 ec 3c 00 00       	mov    $0x3cec,%ecx
+    1047:	8b 01                	mov    (%ecx),%eax
+    1049:	85 c0                	test   %eax,%eax
+    104b:	74 36                	je     1083 <largealloc+0x48>
+    if(b->h.size < n)
+    104d:	8b 10                	mov    (%eax),%edx
+    104f:	39 da                	cmp    %ebx,%edx
+    1051:	72 24                	jb     1077 <largealloc+0x3c>
+    if(b->h.size - n > SMALLMAX){
+    1053:	29 da                	sub    %ebx,%edx
+    1055:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+    105b:	76 1f                	jbe    107c <largealloc+0x41>
+      rest = (Fblock*)((char*)b + n);
+    105d:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+      rest->h.size = b->h.size - n;
+    1060:	89 16                	mov    %edx,(%esi)
+      rest->h.class = LARGE;
+    1062:	c7 46 04 09 00 00 00 	movl   $0x9,0x4(%esi)
+      rest->next = b->next;
+    1069:	8b 50 08             	mov    0x8(%eax),%edx
+    106c:	89 56 08             	mov    %edx,0x8(%esi)
+      *pp = rest;
+    106f:	89 31                	mov    %esi,(%ecx)
+      b->h.size = n;
+    1071:	89 18                	mov    %ebx,(%eax)
+}
+    1073:	5b                   	pop    %ebx
+    1074:	5e                   	pop    %esi
+    1075:	5d                   	pop    %ebp
+    1076:	c3                   	ret
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+    1077:	8d 48 08             	lea    0x8(%eax),%ecx
+    107a:	eb cb                	jmp    1047 <largealloc+0xc>
+      *pp = b->next;
+    107c:	8b 50 08             	mov    0x8(%eax),%edx
+    107f:	89 11                	mov    %edx,(%ecx)
+    return &b->h;
+    1081:	eb f0                	jmp    1073 <largealloc+0x38>
+  if((b = more(n)) == 0)
+    1083:	89 d8                	mov    %ebx,%eax
+    1085:	e8 18 ff ff ff       	call   fa2 <more>
+    108a:	85 c0                	test   %eax,%eax
+    108c:	74 e5                	je     1073 <largealloc+0x38>
+  b->h.size = n;
+    108e:	89 18                	mov    %ebx,(%eax)
+  b->h.class = LARGE;
+    1090:	c7 40 04 09 00 00 00 	movl   $0x9,0x4(%eax)
+  return &b->h;
+    1097:	eb da                	jmp    1073 <largealloc+0x38>
+
+00001099 <free>:
+
+void
+free(void *ap)
+{
+    1099:	55                   	push   %ebp
+    109a:	89 e5                	mov    %esp,%ebp
+    109c:	56                   	push   %esi
+    109d:	53                   	push   %ebx
+    109e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+
+  if(ap == 0)
+    10a1:	85 db                	test   %ebx,%ebx
+    10a3:	74 3b                	je     10e0 <free+0x47>
+    return;
+  h = (Header*)ap - 1;
+    10a5:	8d 73 f8             	lea    -0x8(%ebx),%esi
+  lock_acquire(&lock);
+    10a8:	83 ec 0c             	sub    $0xc,%esp
+    10ab:	68 e0 3c 00 00       	push   $0x3ce0
+    10b0:	e8 9c 01 00 00       	call   1251 <lock_acquire>
+  if(h->class == LARGE)
+    10b5:	8b 43 fc             	mov    -0x4(%ebx),%eax
+    10b8:	83 c4 10             	add    $0x10,%esp
+    10bb:	83 f8 09             	cmp    $0x9,%eax
+    10be:	74 27                	je     10e7 <free+0x4e>
+    largefree((Fblock*)h);
+  else {
+    ((Fblock*)h)->next = freelist[h->class];
+    10c0:	8b 14 85 00 3d 00 00 	mov    0x3d00(,%eax,4),%edx
+    10c7:	89 13                	mov    %edx,(%ebx)
+    freelist[h->class] = (Fblock*)h;
+    10c9:	89 34 85 00 3d 00 00 	mov    %esi,0x3d00(,%eax,4)
+  }
+  lock_release(&lock);
+    10d0:	83 ec 0c             	sub    $0xc,%esp
+    10d3:	68 e0 3c 00 00       	push   $0x3ce0
+    10d8:	e8 88 01 00 00       	call   1265 <lock_release>
+    10dd:	83 c4 10             	add    $0x10,%esp
+}
+    10e0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    10e3:	5b                   	pop    %ebx
+    10e4:	5e                   	pop    %esi
+    10e5:	5d                   	pop    %ebp
+    10e6:	c3                   	ret
+    largefree((Fblock*)h);
+    10e7:	89 f0                	mov    %esi,%eax
+    10e9:	e8 0b fe ff ff       	call   ef9 <largefree>
+    10ee:	eb e0                	jmp    10d0 <free+0x37>
+
+000010f0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    10f0:	55                   	push   %ebp
+    10f1:	89 e5                	mov    %esp,%ebp
+    10f3:	53                   	push   %ebx
+    10f4:	83 ec 04             	sub    $0x4,%esp
+    10f7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+  uint n;
+  int c;
+
+  if(nbytes > 0x7fffffff - sizeof(Header) - 7)
+    10fa:	81 fb f0 ff ff 7f    	cmp    $0x7ffffff0,%ebx
+    1100:	0f 87 8b 00 00 00    	ja     1191 <malloc+0xa1>
+    return 0;
+  n = (nbytes + sizeof(Header) + 7) & ~7;
+    1106:	83 c3 0f             	add    $0xf,%ebx
+    1109:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(n < sizeof(Fblock))
+    110c:	83 fb 0b             	cmp    $0xb,%ebx
+    110f:	77 05                	ja     1116 <malloc+0x26>
+    n = sizeof(Fblock);
+    1111:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  lock_acquire(&lock);
+    1116:	83 ec 0c             	sub    $0xc,%esp
+    1119:	68 e0 3c 00 00       	push   $0x3ce0
+    111e:	e8 2e 01 00 00       	call   1251 <lock_acquire>
+  if(n <= SMALLMAX){
+    1123:	83 c4 10             	add    $0x10,%esp
+    1126:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+    112c:	77 58                	ja     1186 <malloc+0x96>
+    for(c = 0; (1 << (MINSHIFT + c)) < n; c++)
+    112e:	ba 00 00 00 00       	mov    $0x0,%edx
+    1133:	eb 03                	jmp    1138 <malloc+0x48>
+    1135:	83 c2 01             	add    $0x1,%edx
+    1138:	8d 4a 04             	lea    0x4(%edx),%ecx
+    113b:	b8 01 00 00 00       	mov    $0x1,%eax
+    1140:	d3 e0                	shl    %cl,%eax
+    1142:	39 d8                	cmp    %ebx,%eax
+    1144:	72 ef                	jb     1135 <malloc+0x45>
+      ;
+    if(freelist[c]){
+    1146:	8b 04 95 00 3d 00 00 	mov    0x3d00(,%edx,4),%eax
+    114d:	85 c0                	test   %eax,%eax
+    114f:	74 2a                	je     117b <malloc+0x8b>
+      h = &freelist[c]->h;
+    1151:	89 c3                	mov    %eax,%ebx
+      freelist[c] = freelist[c]->next;
+    1153:	8b 40 08             	mov    0x8(%eax),%eax
+    1156:	89 04 95 00 3d 00 00 	mov    %eax,0x3d00(,%edx,4)
+    } else
+      h = slaballoc(c);
+  } else
+    h = largealloc(n);
+  lock_release(&lock);
+    115d:	83 ec 0c             	sub    $0xc,%esp
+    1160:	68 e0 3c 00 00       	push   $0x3ce0
+    1165:	e8 fb 00 00 00       	call   1265 <lock_release>
+  return h ? (void*)(h + 1) : 0;
+    116a:	83 c4 10             	add    $0x10,%esp
+    116d:	85 db                	test   %ebx,%ebx
+    116f:	74 03                	je     1174 <malloc+0x84>
+    1171:	83 c3 08             	add    $0x8,%ebx
+}
+    1174:	89 d8                	mov    %ebx,%eax
+    1176:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1179:	c9                   	leave
+    117a:	c3                   	ret
+      h = slaballoc(c);
+    117b:	89 d0                	mov    %edx,%eax
+    117d:	e8 5a fe ff ff       	call   fdc <slaballoc>
+    1182:	89 c3                	mov    %eax,%ebx
+    1184:	eb d7                	jmp    115d <malloc+0x6d>
+    h = largealloc(n);
+    1186:	89 d8                	mov    %ebx,%eax
+    1188:	e8 ae fe ff ff       	call   103b <largealloc>
+    118d:	89 c3                	mov    %eax,%ebx
+    118f:	eb cc                	jmp    115d <malloc+0x6d>
+    return 0;
+    1191:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1196:	eb dc                	jmp    1174 <malloc+0x84>
+
+00001198 <tstart>:
+  void *arg;
+};
+
+static void
+tstart(void *a)
+{
+    1198:	55                   	push   %ebp
+    1199:	89 e5                	mov    %esp,%ebp
+    119b:	83 ec 14             	sub    $0x14,%esp
+    119e:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+    11a1:	ff 70 04             	push   0x4(%eax)
+    11a4:	ff 10                	call   *(%eax)
+  exit();
+    11a6:	e8 86 f6 ff ff       	call   831 <exit>
+
+000011ab <thread_create>:
+}
+
+// Run fn(arg) in a new thread.  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    11ab:	55                   	push   %ebp
+    11ac:	89 e5                	mov    %esp,%ebp
+    11ae:	56                   	push   %esi
+    11af:	53                   	push   %ebx
+  struct tstart *t;
+  char *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    11b0:	83 ec 0c             	sub    $0xc,%esp
+    11b3:	68 00 10 00 00       	push   $0x1000
+    11b8:	e8 33 ff ff ff       	call   10f0 <malloc>
+    11bd:	83 c4 10             	add    $0x10,%esp
+    11c0:	85 c0                	test   %eax,%eax
+    11c2:	74 42                	je     1206 <thread_create+0x5b>
+    11c4:	89 c3                	mov    %eax,%ebx
+    return -1;
+  t = (struct tstart*)stack;
+  t->fn = fn;
+    11c6:	8b 45 08             	mov    0x8(%ebp),%eax
+    11c9:	89 03                	mov    %eax,(%ebx)
+  t->arg = arg;
+    11cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+    11ce:	89 43 04             	mov    %eax,0x4(%ebx)
+  if((pid = clone(tstart, stack + TSTACK, t)) < 0)
+    11d1:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    11d7:	83 ec 04             	sub    $0x4,%esp
+    11da:	53                   	push   %ebx
+    11db:	50                   	push   %eax
+    11dc:	68 98 11 00 00       	push   $0x1198
+    11e1:	e8 f5 f8 ff ff       	call   adb <clone>
+    11e6:	89 c6                	mov    %eax,%esi
+    11e8:	83 c4 10             	add    $0x10,%esp
+    11eb:	85 c0                	test   %eax,%eax
+    11ed:	78 09                	js     11f8 <thread_create+0x4d>
+    free(stack);
+  return pid;
+}
+    11ef:	89 f0                	mov    %esi,%eax
+    11f1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    11f4:	5b                   	pop    %ebx
+    11f5:	5e                   	pop    %esi
+    11f6:	5d                   	pop    %ebp
+    11f7:	c3                   	ret
+    free(stack);
+    11f8:	83 ec 0c             	sub    $0xc,%esp
+    11fb:	53                   	push   %ebx
+    11fc:	e8 98 fe ff ff       	call   1099 <free>
+    1201:	83 c4 10             	add    $0x10,%esp
+    1204:	eb e9                	jmp    11ef <thread_create+0x44>
+    return -1;
+    1206:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    120b:	eb e2                	jmp    11ef <thread_create+0x44>
+
+0000120d <thread_join>:
+
+// Wait for one of this process's threads to exit and free its
+// stack.  Returns its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+    120d:	55                   	push   %ebp
+    120e:	89 e5                	mov    %esp,%ebp
+    1210:	53                   	push   %ebx
+    1211:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    1214:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1217:	50                   	push   %eax
+    1218:	e8 cd f8 ff ff       	call   aea <join>
+    121d:	89 c3                	mov    %eax,%ebx
+    121f:	83 c4 10             	add    $0x10,%esp
+    1222:	85 c0                	test   %eax,%eax
+    1224:	79 07                	jns    122d <thread_join+0x20>
+    free((char*)stack - TSTACK);
+  return pid;
+}
+    1226:	89 d8                	mov    %ebx,%eax
+    1228:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    122b:	c9                   	leave
+    122c:	c3                   	ret
+    free((char*)stack - TSTACK);
+    122d:	83 ec 0c             	sub    $0xc,%esp
+    1230:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1233:	2d 00 10 00 00       	sub    $0x1000,%eax
+    1238:	50                   	push   %eax
+    1239:	e8 5b fe ff ff       	call   1099 <free>
+    123e:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    1241:	eb e3                	jmp    1226 <thread_join+0x19>
+
+00001243 <lock_init>:
+
+void
+lock_init(lock_t *lk)
+{
+    1243:	55                   	push   %ebp
+    1244:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    1246:	8b 45 08             	mov    0x8(%ebp),%eax
+    1249:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    124f:	5d                   	pop    %ebp
+    1250:	c3                   	ret
+
+00001251 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+    1251:	55                   	push   %ebp
+    1252:	89 e5                	mov    %esp,%ebp
+    1254:	8b 55 08             	mov    0x8(%ebp),%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    1257:	b8 01 00 00 00       	mov    $0x1,%eax
+    125c:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    125f:	85 c0                	test   %eax,%eax
+    1261:	75 f4                	jne    1257 <lock_acquire+0x6>
+    ;
+}
+    1263:	5d                   	pop    %ebp
+    1264:	c3                   	ret
+
+00001265 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+    1265:	55                   	push   %ebp
+    1266:	89 e5                	mov    %esp,%ebp
+    1268:	8b 55 08             	mov    0x8(%ebp),%edx
+    126b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1270:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    1273:	5d                   	pop    %ebp
+    1274:	c3                   	ret
+
+00001275 <mutex_init>:
+// Are Tricky": state is 0 when free, 1 when held, 2 when held and
+// others may be waiting.  Unlocking an uncontended mutex costs no
+// system call.
+void
+mutex_init(mutex_t *m)
+{
+    1275:	55                   	push   %ebp
+    1276:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    1278:	8b 45 08             	mov    0x8(%ebp),%eax
+    127b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1281:	5d                   	pop    %ebp
+    1282:	c3                   	ret
+
+00001283 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+    1283:	55                   	push   %ebp
+    1284:	89 e5                	mov    %esp,%ebp
+    1286:	53                   	push   %ebx
+    1287:	83 ec 04             	sub    $0x4,%esp
+    128a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    128d:	b8 00 00 00 00       	mov    $0x0,%eax
+    1292:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1297:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    129b:	85 c0                	test   %eax,%eax
+    129d:	74 29                	je     12c8 <mutex_lock+0x45>
+    return;
+  if(c != 2)
+    129f:	83 f8 02             	cmp    $0x2,%eax
+    12a2:	74 20                	je     12c4 <mutex_lock+0x41>
+    12a4:	b8 02 00 00 00       	mov    $0x2,%eax
+    12a9:	f0 87 03             	lock xchg %eax,(%ebx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    12ac:	eb 16                	jmp    12c4 <mutex_lock+0x41>
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    12ae:	83 ec 08             	sub    $0x8,%esp
+    12b1:	6a 02                	push   $0x2
+    12b3:	53                   	push   %ebx
+    12b4:	e8 40 f8 ff ff       	call   af9 <futex_wait>
+  asm volatile("lock; xchgl %0, %1" :
+    12b9:	b8 02 00 00 00       	mov    $0x2,%eax
+    12be:	f0 87 03             	lock xchg %eax,(%ebx)
+    12c1:	83 c4 10             	add    $0x10,%esp
+  while(c != 0){
+    12c4:	85 c0                	test   %eax,%eax
+    12c6:	75 e6                	jne    12ae <mutex_lock+0x2b>
+    c = xchg(&m->state, 2);
+  }
+}
+    12c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    12cb:	c9                   	leave
+    12cc:	c3                   	ret
+
+000012cd <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+    12cd:	55                   	push   %ebp
+    12ce:	89 e5                	mov    %esp,%ebp
+    12d0:	83 ec 08             	sub    $0x8,%esp
+    12d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    12d6:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    12db:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    12df:	83 fa 01             	cmp    $0x1,%edx
+    12e2:	75 02                	jne    12e6 <mutex_unlock+0x19>
+    m->state = 0;
+    futex_wake(&m->state, 1);
+  }
+}
+    12e4:	c9                   	leave
+    12e5:	c3                   	ret
+    m->state = 0;
+    12e6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+    12ec:	83 ec 08             	sub    $0x8,%esp
+    12ef:	6a 01                	push   $0x1
+    12f1:	50                   	push   %eax
+    12f2:	e8 11 f8 ff ff       	call   b08 <futex_wake>
+    12f7:	83 c4 10             	add    $0x10,%esp
+}
+    12fa:	eb e8                	jmp    12e4 <mutex_unlock+0x17>
+
+000012fc <cond_init>:
+// Condition variable: waiters sleep on a sequence number that
+// every signal bumps, so a signal between the unlock and the
+// futex_wait() in cond_wait() is not lost.
+void
+cond_init(cond_t *c)
+{
+    12fc:	55                   	push   %ebp
+    12fd:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    12ff:	8b 45 08             	mov    0x8(%ebp),%eax
+    1302:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1308:	5d                   	pop    %ebp
+    1309:	c3                   	ret
+
+0000130a <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+    130a:	55                   	push   %ebp
+    130b:	89 e5                	mov    %esp,%ebp
+    130d:	57                   	push   %edi
+    130e:	56                   	push   %esi
+    130f:	53                   	push   %ebx
+    1310:	83 ec 18             	sub    $0x18,%esp
+    1313:	8b 75 08             	mov    0x8(%ebp),%esi
+    1316:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    1319:	8b 3e                	mov    (%esi),%edi
+  mutex_unlock(m);
+    131b:	53                   	push   %ebx
+    131c:	e8 ac ff ff ff       	call   12cd <mutex_unlock>
+  futex_wait(&c->seq, seq);
+    1321:	83 c4 08             	add    $0x8,%esp
+    1324:	57                   	push   %edi
+    1325:	56                   	push   %esi
+    1326:	e8 ce f7 ff ff       	call   af9 <futex_wait>
+  // Others may be waiting for m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+    132b:	83 c4 10             	add    $0x10,%esp
+    132e:	eb 0e                	jmp    133e <cond_wait+0x34>
+    futex_wait(&m->state, 2);
+    1330:	83 ec 08             	sub    $0x8,%esp
+    1333:	6a 02                	push   $0x2
+    1335:	53                   	push   %ebx
+    1336:	e8 be f7 ff ff       	call   af9 <futex_wait>
+    133b:	83 c4 10             	add    $0x10,%esp
+    133e:	b8 02 00 00 00       	mov    $0x2,%eax
+    1343:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    1346:	85 c0                	test   %eax,%eax
+    1348:	75 e6                	jne    1330 <cond_wait+0x26>
+}
+    134a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    134d:	5b                   	pop    %ebx
+    134e:	5e                   	pop    %esi
+    134f:	5f                   	pop    %edi
+    1350:	5d                   	pop    %ebp
+    1351:	c3                   	ret
+
+00001352 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+    1352:	55                   	push   %ebp
+    1353:	89 e5                	mov    %esp,%ebp
+    1355:	83 ec 10             	sub    $0x10,%esp
+    1358:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    135b:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+    135f:	6a 01                	push   $0x1
+    1361:	50                   	push   %eax
+    1362:	e8 a1 f7 ff ff       	call   b08 <futex_wake>
+}
+    1367:	83 c4 10             	add    $0x10,%esp
+    136a:	c9                   	leave
+    136b:	c3                   	ret
+
+0000136c <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+    136c:	55                   	push   %ebp
+    136d:	89 e5                	mov    %esp,%ebp
+    136f:	83 ec 10             	sub    $0x10,%esp
+    1372:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    1375:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, NPROC);
+    1379:	6a 40                	push   $0x40
+    137b:	50                   	push   %eax
+    137c:	e8 87 f7 ff ff       	call   b08 <futex_wake>
+}
+    1381:	83 c4 10             	add    $0x10,%esp
+    1384:	c9                   	leave
+    1385:	c3                   	ret
@@ -2,6 +2,7 @@
 #include "stat.h"
 #include "user.h"
 #include "fcntl.h"
+#include "param.h"
 
 int
 main(int argc, char* argv[])
@@ -20,7 +21,7 @@ main(int argc, char* argv[])
   if (dup2 (6,8) >= 0)
     printf (1, "dup2 no funciona con fd inexistente.\n");
 
-  if (dup2 (1,20) >= 0)
+  if (dup2 (1,NOFILE) >= 0)
     printf (1, "dup2 no funciona con fd superior a NOFILE.\n");
 
   // Ejemplo de dup2 con fd existente
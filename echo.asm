@@ -0,0 +1,2741 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 08             	sub    $0x8,%esp
+      14:	8b 31                	mov    (%ecx),%esi
+      16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  for(i = 1; i < argc; i++)
+      19:	b8 01 00 00 00       	mov    $0x1,%eax
+      1e:	eb 1a                	jmp    3a <main+0x3a>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+      20:	ba e2 11 00 00       	mov    $0x11e2,%edx
+      25:	52                   	push   %edx
+      26:	ff 34 87             	push   (%edi,%eax,4)
+      29:	68 e4 11 00 00       	push   $0x11e4
+      2e:	6a 01                	push   $0x1
+      30:	e8 8d 0b 00 00       	call   bc2 <printf>
+      35:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++)
+      38:	89 d8                	mov    %ebx,%eax
+      3a:	39 f0                	cmp    %esi,%eax
+      3c:	7d 0e                	jge    4c <main+0x4c>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+      3e:	8d 58 01             	lea    0x1(%eax),%ebx
+      41:	39 f3                	cmp    %esi,%ebx
+      43:	7d db                	jge    20 <main+0x20>
+      45:	ba e0 11 00 00       	mov    $0x11e0,%edx
+      4a:	eb d9                	jmp    25 <main+0x25>
+  exit();
+      4c:	e8 38 06 00 00       	call   689 <exit>
+
+00000051 <strcpy>:
+#include "memlayout.h"
+#include "clock.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+      51:	55                   	push   %ebp
+      52:	89 e5                	mov    %esp,%ebp
+      54:	56                   	push   %esi
+      55:	53                   	push   %ebx
+      56:	8b 75 08             	mov    0x8(%ebp),%esi
+      59:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+      5c:	89 f0                	mov    %esi,%eax
+      5e:	89 d1                	mov    %edx,%ecx
+      60:	83 c2 01             	add    $0x1,%edx
+      63:	89 c3                	mov    %eax,%ebx
+      65:	83 c0 01             	add    $0x1,%eax
+      68:	0f b6 09             	movzbl (%ecx),%ecx
+      6b:	88 0b                	mov    %cl,(%ebx)
+      6d:	84 c9                	test   %cl,%cl
+      6f:	75 ed                	jne    5e <strcpy+0xd>
+    ;
+  return os;
+}
+      71:	89 f0                	mov    %esi,%eax
+      73:	5b                   	pop    %ebx
+      74:	5e                   	pop    %esi
+      75:	5d                   	pop    %ebp
+      76:	c3                   	ret
+
+00000077 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+      77:	55                   	push   %ebp
+      78:	89 e5                	mov    %esp,%ebp
+      7a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      7d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+      80:	eb 06                	jmp    88 <strcmp+0x11>
+    p++, q++;
+      82:	83 c1 01             	add    $0x1,%ecx
+      85:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+      88:	0f b6 01             	movzbl (%ecx),%eax
+      8b:	84 c0                	test   %al,%al
+      8d:	74 04                	je     93 <strcmp+0x1c>
+      8f:	3a 02                	cmp    (%edx),%al
+      91:	74 ef                	je     82 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+      93:	0f b6 c0             	movzbl %al,%eax
+      96:	0f b6 12             	movzbl (%edx),%edx
+      99:	29 d0                	sub    %edx,%eax
+}
+      9b:	5d                   	pop    %ebp
+      9c:	c3                   	ret
+
+0000009d <strlen>:
+
+uint
+strlen(const char *s)
+{
+      9d:	55                   	push   %ebp
+      9e:	89 e5                	mov    %esp,%ebp
+      a0:	53                   	push   %ebx
+      a1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  const char *p;
+  uint w;
+
+  for(p = s; (uint)p & 3; p++)
+      a4:	89 c8                	mov    %ecx,%eax
+      a6:	eb 03                	jmp    ab <strlen+0xe>
+      a8:	83 c0 01             	add    $0x1,%eax
+      ab:	a8 03                	test   $0x3,%al
+      ad:	74 09                	je     b8 <strlen+0x1b>
+    if(*p == 0)
+      af:	80 38 00             	cmpb   $0x0,(%eax)
+      b2:	75 f4                	jne    a8 <strlen+0xb>
+      return p - s;
+      b4:	29 c8                	sub    %ecx,%eax
+      b6:	eb 25                	jmp    dd <strlen+0x40>
+  // Then a word at a time, which never crosses into the next page:
+  // a word with a zero byte in it has one of these bits set.
+  for(;; p += 4){
+    w = *(uint*)p;
+      b8:	8b 10                	mov    (%eax),%edx
+    if((w - 0x01010101) & ~w & 0x80808080)
+      ba:	8d 9a ff fe fe fe    	lea    -0x1010101(%edx),%ebx
+      c0:	f7 d2                	not    %edx
+      c2:	21 da                	and    %ebx,%edx
+      c4:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+      ca:	75 05                	jne    d1 <strlen+0x34>
+  for(;; p += 4){
+      cc:	83 c0 04             	add    $0x4,%eax
+    w = *(uint*)p;
+      cf:	eb e7                	jmp    b8 <strlen+0x1b>
+      break;
+  }
+  while(*p)
+      d1:	80 38 00             	cmpb   $0x0,(%eax)
+      d4:	74 05                	je     db <strlen+0x3e>
+    p++;
+      d6:	83 c0 01             	add    $0x1,%eax
+      d9:	eb f6                	jmp    d1 <strlen+0x34>
+  return p - s;
+      db:	29 c8                	sub    %ecx,%eax
+}
+      dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      e0:	c9                   	leave
+      e1:	c3                   	ret
+
+000000e2 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+      e2:	55                   	push   %ebp
+      e3:	89 e5                	mov    %esp,%ebp
+      e5:	57                   	push   %edi
+      e6:	56                   	push   %esi
+      e7:	53                   	push   %ebx
+      e8:	8b 55 10             	mov    0x10(%ebp),%edx
+  uint h;
+  char *d;
+
+  d = dst;
+  c &= 0xFF;
+      eb:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  if(n >= 16){
+      ef:	83 fa 0f             	cmp    $0xf,%edx
+      f2:	76 52                	jbe    146 <memset+0x64>
+    h = -(uint)d & 3;
+      f4:	8b 45 08             	mov    0x8(%ebp),%eax
+      f7:	f7 d8                	neg    %eax
+      f9:	83 e0 03             	and    $0x3,%eax
+      fc:	89 c6                	mov    %eax,%esi
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+      fe:	8b 7d 08             	mov    0x8(%ebp),%edi
+     101:	89 c1                	mov    %eax,%ecx
+     103:	89 d8                	mov    %ebx,%eax
+     105:	fc                   	cld
+     106:	f3 aa                	rep stos %al,%es:(%edi)
+    stosb(d, c, h);
+    stosl(d + h, (c<<24)|(c<<16)|(c<<8)|c, (n - h)/4);
+     108:	29 f2                	sub    %esi,%edx
+     10a:	89 d1                	mov    %edx,%ecx
+     10c:	c1 e9 02             	shr    $0x2,%ecx
+     10f:	c1 e0 18             	shl    $0x18,%eax
+     112:	89 df                	mov    %ebx,%edi
+     114:	c1 e7 10             	shl    $0x10,%edi
+     117:	09 f8                	or     %edi,%eax
+     119:	89 df                	mov    %ebx,%edi
+     11b:	c1 e7 08             	shl    $0x8,%edi
+     11e:	09 f8                	or     %edi,%eax
+     120:	09 d8                	or     %ebx,%eax
+     122:	89 f7                	mov    %esi,%edi
+     124:	03 7d 08             	add    0x8(%ebp),%edi
+}
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosl" :
+     127:	fc                   	cld
+     128:	f3 ab                	rep stos %eax,%es:(%edi)
+    d += h + (n - h)/4*4;
+     12a:	89 d7                	mov    %edx,%edi
+     12c:	83 e7 fc             	and    $0xfffffffc,%edi
+     12f:	09 f7                	or     %esi,%edi
+     131:	03 7d 08             	add    0x8(%ebp),%edi
+    n = (n - h)%4;
+     134:	83 e2 03             	and    $0x3,%edx
+  asm volatile("cld; rep stosb" :
+     137:	89 d1                	mov    %edx,%ecx
+     139:	89 d8                	mov    %ebx,%eax
+     13b:	fc                   	cld
+     13c:	f3 aa                	rep stos %al,%es:(%edi)
+  }
+  stosb(d, c, n);
+  return dst;
+}
+     13e:	8b 45 08             	mov    0x8(%ebp),%eax
+     141:	5b                   	pop    %ebx
+     142:	5e                   	pop    %esi
+     143:	5f                   	pop    %edi
+     144:	5d                   	pop    %ebp
+     145:	c3                   	ret
+  d = dst;
+     146:	8b 7d 08             	mov    0x8(%ebp),%edi
+     149:	eb ec                	jmp    137 <memset+0x55>
+
+0000014b <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     14b:	55                   	push   %ebp
+     14c:	89 e5                	mov    %esp,%ebp
+     14e:	8b 45 08             	mov    0x8(%ebp),%eax
+     151:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     155:	eb 03                	jmp    15a <strchr+0xf>
+     157:	83 c0 01             	add    $0x1,%eax
+     15a:	0f b6 10             	movzbl (%eax),%edx
+     15d:	84 d2                	test   %dl,%dl
+     15f:	74 06                	je     167 <strchr+0x1c>
+    if(*s == c)
+     161:	38 ca                	cmp    %cl,%dl
+     163:	75 f2                	jne    157 <strchr+0xc>
+     165:	eb 05                	jmp    16c <strchr+0x21>
+      return (char*)s;
+  return 0;
+     167:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     16c:	5d                   	pop    %ebp
+     16d:	c3                   	ret
+
+0000016e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     16e:	55                   	push   %ebp
+     16f:	89 e5                	mov    %esp,%ebp
+     171:	56                   	push   %esi
+     172:	53                   	push   %ebx
+     173:	8b 55 08             	mov    0x8(%ebp),%edx
+     176:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     179:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  // A word at a time while they agree.
+  if((((uint)s1 | (uint)s2) & 3) == 0)
+     17c:	89 d3                	mov    %edx,%ebx
+     17e:	09 cb                	or     %ecx,%ebx
+     180:	f6 c3 03             	test   $0x3,%bl
+     183:	74 24                	je     1a9 <memcmp+0x3b>
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+      s1 += 4, s2 += 4;
+  while(n-- > 0){
+     185:	8d 70 ff             	lea    -0x1(%eax),%esi
+     188:	85 c0                	test   %eax,%eax
+     18a:	74 32                	je     1be <memcmp+0x50>
+    if(*s1 != *s2)
+     18c:	0f b6 02             	movzbl (%edx),%eax
+     18f:	0f b6 19             	movzbl (%ecx),%ebx
+     192:	38 d8                	cmp    %bl,%al
+     194:	75 20                	jne    1b6 <memcmp+0x48>
+      return *s1 - *s2;
+    s1++, s2++;
+     196:	83 c2 01             	add    $0x1,%edx
+     199:	83 c1 01             	add    $0x1,%ecx
+  while(n-- > 0){
+     19c:	89 f0                	mov    %esi,%eax
+     19e:	eb e5                	jmp    185 <memcmp+0x17>
+      s1 += 4, s2 += 4;
+     1a0:	83 c2 04             	add    $0x4,%edx
+     1a3:	83 c1 04             	add    $0x4,%ecx
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+     1a6:	83 e8 04             	sub    $0x4,%eax
+     1a9:	83 f8 03             	cmp    $0x3,%eax
+     1ac:	76 d7                	jbe    185 <memcmp+0x17>
+     1ae:	8b 31                	mov    (%ecx),%esi
+     1b0:	39 32                	cmp    %esi,(%edx)
+     1b2:	74 ec                	je     1a0 <memcmp+0x32>
+     1b4:	eb cf                	jmp    185 <memcmp+0x17>
+      return *s1 - *s2;
+     1b6:	0f b6 c0             	movzbl %al,%eax
+     1b9:	0f b6 db             	movzbl %bl,%ebx
+     1bc:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     1be:	5b                   	pop    %ebx
+     1bf:	5e                   	pop    %esi
+     1c0:	5d                   	pop    %ebp
+     1c1:	c3                   	ret
+
+000001c2 <memchr>:
+// The first c in the n bytes at v, or 0.  Once aligned, a word at
+// a time, with the word's bytes that equal c turned into zeroes
+// and those looked for.
+void*
+memchr(const void *v, int c, uint n)
+{
+     1c2:	55                   	push   %ebp
+     1c3:	89 e5                	mov    %esp,%ebp
+     1c5:	57                   	push   %edi
+     1c6:	56                   	push   %esi
+     1c7:	53                   	push   %ebx
+     1c8:	8b 45 08             	mov    0x8(%ebp),%eax
+     1cb:	8b 55 10             	mov    0x10(%ebp),%edx
+  const uchar *s;
+  uint w, rep;
+
+  s = v;
+  c = (uchar)c;
+     1ce:	0f b6 75 0c          	movzbl 0xc(%ebp),%esi
+  for(; n > 0 && ((uint)s & 3); n--, s++)
+     1d2:	eb 06                	jmp    1da <memchr+0x18>
+     1d4:	83 ea 01             	sub    $0x1,%edx
+     1d7:	83 c0 01             	add    $0x1,%eax
+     1da:	85 d2                	test   %edx,%edx
+     1dc:	74 0d                	je     1eb <memchr+0x29>
+     1de:	a8 03                	test   $0x3,%al
+     1e0:	74 09                	je     1eb <memchr+0x29>
+    if(*s == c)
+     1e2:	0f b6 08             	movzbl (%eax),%ecx
+     1e5:	39 f1                	cmp    %esi,%ecx
+     1e7:	75 eb                	jne    1d4 <memchr+0x12>
+     1e9:	eb 41                	jmp    22c <memchr+0x6a>
+      return (void*)s;
+  rep = c * 0x01010101;
+     1eb:	69 fe 01 01 01 01    	imul   $0x1010101,%esi,%edi
+  for(; n >= 4; n -= 4, s += 4){
+     1f1:	eb 06                	jmp    1f9 <memchr+0x37>
+     1f3:	83 ea 04             	sub    $0x4,%edx
+     1f6:	83 c0 04             	add    $0x4,%eax
+     1f9:	83 fa 03             	cmp    $0x3,%edx
+     1fc:	76 16                	jbe    214 <memchr+0x52>
+    w = *(uint*)s ^ rep;
+     1fe:	89 f9                	mov    %edi,%ecx
+     200:	33 08                	xor    (%eax),%ecx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     202:	8d 99 ff fe fe fe    	lea    -0x1010101(%ecx),%ebx
+     208:	f7 d1                	not    %ecx
+     20a:	21 cb                	and    %ecx,%ebx
+     20c:	f7 c3 80 80 80 80    	test   $0x80808080,%ebx
+     212:	74 df                	je     1f3 <memchr+0x31>
+      break;
+  }
+  for(; n > 0; n--, s++)
+     214:	85 d2                	test   %edx,%edx
+     216:	74 0f                	je     227 <memchr+0x65>
+    if(*s == c)
+     218:	0f b6 08             	movzbl (%eax),%ecx
+     21b:	39 f1                	cmp    %esi,%ecx
+     21d:	74 0d                	je     22c <memchr+0x6a>
+  for(; n > 0; n--, s++)
+     21f:	83 ea 01             	sub    $0x1,%edx
+     222:	83 c0 01             	add    $0x1,%eax
+     225:	eb ed                	jmp    214 <memchr+0x52>
+      return (void*)s;
+  return 0;
+     227:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     22c:	5b                   	pop    %ebx
+     22d:	5e                   	pop    %esi
+     22e:	5f                   	pop    %edi
+     22f:	5d                   	pop    %ebp
+     230:	c3                   	ret
+
+00000231 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     231:	55                   	push   %ebp
+     232:	89 e5                	mov    %esp,%ebp
+     234:	57                   	push   %edi
+     235:	56                   	push   %esi
+     236:	53                   	push   %ebx
+     237:	83 ec 1c             	sub    $0x1c,%esp
+     23a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     23d:	bb 00 00 00 00       	mov    $0x0,%ebx
+     242:	89 de                	mov    %ebx,%esi
+     244:	83 c3 01             	add    $0x1,%ebx
+     247:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     24a:	7d 2e                	jge    27a <gets+0x49>
+    cc = read(0, &c, 1);
+     24c:	83 ec 04             	sub    $0x4,%esp
+     24f:	6a 01                	push   $0x1
+     251:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     254:	50                   	push   %eax
+     255:	6a 00                	push   $0x0
+     257:	e8 51 05 00 00       	call   7ad <read>
+    if(cc < 1)
+     25c:	83 c4 10             	add    $0x10,%esp
+     25f:	85 c0                	test   %eax,%eax
+     261:	7e 17                	jle    27a <gets+0x49>
+      break;
+    buf[i++] = c;
+     263:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     267:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+     26a:	3c 0a                	cmp    $0xa,%al
+     26c:	0f 94 c2             	sete   %dl
+     26f:	3c 0d                	cmp    $0xd,%al
+     271:	0f 94 c0             	sete   %al
+     274:	08 c2                	or     %al,%dl
+     276:	74 ca                	je     242 <gets+0x11>
+    buf[i++] = c;
+     278:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+     27a:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+     27e:	89 f8                	mov    %edi,%eax
+     280:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     283:	5b                   	pop    %ebx
+     284:	5e                   	pop    %esi
+     285:	5f                   	pop    %edi
+     286:	5d                   	pop    %ebp
+     287:	c3                   	ret
+
+00000288 <atoi>:
+  return r;
+}
+
+int
+atoi(const char *s)
+{
+     288:	55                   	push   %ebp
+     289:	89 e5                	mov    %esp,%ebp
+     28b:	53                   	push   %ebx
+     28c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+     28f:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+     294:	eb 10                	jmp    2a6 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+     296:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+     299:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+     29c:	83 c1 01             	add    $0x1,%ecx
+     29f:	0f be c0             	movsbl %al,%eax
+     2a2:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+     2a6:	0f b6 01             	movzbl (%ecx),%eax
+     2a9:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     2ac:	80 fb 09             	cmp    $0x9,%bl
+     2af:	76 e5                	jbe    296 <atoi+0xe>
+  return n;
+}
+     2b1:	89 d0                	mov    %edx,%eax
+     2b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2b6:	c9                   	leave
+     2b7:	c3                   	ret
+
+000002b8 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     2b8:	55                   	push   %ebp
+     2b9:	89 e5                	mov    %esp,%ebp
+     2bb:	57                   	push   %edi
+     2bc:	56                   	push   %esi
+     2bd:	53                   	push   %ebx
+     2be:	83 ec 08             	sub    $0x8,%esp
+     2c1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     2c4:	8b 55 0c             	mov    0xc(%ebp),%edx
+     2c7:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *src;
+  int h;
+
+  dst = vdst;
+  src = vsrc;
+  if(n <= 0)
+     2ca:	85 c0                	test   %eax,%eax
+     2cc:	0f 8e 82 00 00 00    	jle    354 <memmove+0x9c>
+    return vdst;
+  if(src < dst && src + n > dst){
+     2d2:	39 da                	cmp    %ebx,%edx
+     2d4:	73 07                	jae    2dd <memmove+0x25>
+     2d6:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+     2d9:	39 cb                	cmp    %ecx,%ebx
+     2db:	72 5e                	jb     33b <memmove+0x83>
+    movsbback(dst + n - 1, src + n - 1, n);
+    return vdst;
+  }
+  if(n >= 16 && (((uint)dst ^ (uint)src) & 3) == 0){
+     2dd:	83 f8 0f             	cmp    $0xf,%eax
+     2e0:	7e 69                	jle    34b <memmove+0x93>
+     2e2:	89 d9                	mov    %ebx,%ecx
+     2e4:	31 d1                	xor    %edx,%ecx
+     2e6:	f6 c1 03             	test   $0x3,%cl
+     2e9:	75 73                	jne    35e <memmove+0xa6>
+    h = -(uint)dst & 3;
+     2eb:	89 d9                	mov    %ebx,%ecx
+     2ed:	f7 d9                	neg    %ecx
+     2ef:	83 e1 03             	and    $0x3,%ecx
+}
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsb" :
+     2f2:	89 df                	mov    %ebx,%edi
+     2f4:	89 d6                	mov    %edx,%esi
+     2f6:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+     2f9:	fc                   	cld
+     2fa:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    movsb(dst, src, h);
+    dst += h, src += h, n -= h;
+     2fc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+     2ff:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+     302:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+     305:	29 f0                	sub    %esi,%eax
+    movsl(dst, src, n/4);
+     307:	8d 50 03             	lea    0x3(%eax),%edx
+     30a:	0f 49 d0             	cmovns %eax,%edx
+     30d:	c1 fa 02             	sar    $0x2,%edx
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+     310:	89 7d f0             	mov    %edi,-0x10(%ebp)
+     313:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     316:	89 ce                	mov    %ecx,%esi
+     318:	89 d1                	mov    %edx,%ecx
+     31a:	fc                   	cld
+     31b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    dst += n/4*4, src += n/4*4, n %= 4;
+     31d:	c1 e2 02             	shl    $0x2,%edx
+     320:	8b 7d f0             	mov    -0x10(%ebp),%edi
+     323:	01 d7                	add    %edx,%edi
+     325:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     328:	01 ca                	add    %ecx,%edx
+     32a:	89 c6                	mov    %eax,%esi
+     32c:	c1 fe 1f             	sar    $0x1f,%esi
+     32f:	c1 ee 1e             	shr    $0x1e,%esi
+     332:	01 f0                	add    %esi,%eax
+     334:	83 e0 03             	and    $0x3,%eax
+     337:	29 f0                	sub    %esi,%eax
+     339:	eb 12                	jmp    34d <memmove+0x95>
+    movsbback(dst + n - 1, src + n - 1, n);
+     33b:	8d 78 ff             	lea    -0x1(%eax),%edi
+     33e:	8d 34 3a             	lea    (%edx,%edi,1),%esi
+     341:	01 df                	add    %ebx,%edi
+// Copy cnt bytes down from the last ones, at dst and src, to the
+// first: for overlapping moves up.
+static inline void
+movsbback(void *dst, const void *src, int cnt)
+{
+  asm volatile("std; rep movsb; cld" :
+     343:	89 c1                	mov    %eax,%ecx
+     345:	fd                   	std
+     346:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     348:	fc                   	cld
+    return vdst;
+     349:	eb 09                	jmp    354 <memmove+0x9c>
+  dst = vdst;
+     34b:	89 df                	mov    %ebx,%edi
+  asm volatile("cld; rep movsb" :
+     34d:	89 d6                	mov    %edx,%esi
+     34f:	89 c1                	mov    %eax,%ecx
+     351:	fc                   	cld
+     352:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  }
+  movsb(dst, src, n);
+  return vdst;
+}
+     354:	89 d8                	mov    %ebx,%eax
+     356:	83 c4 08             	add    $0x8,%esp
+     359:	5b                   	pop    %ebx
+     35a:	5e                   	pop    %esi
+     35b:	5f                   	pop    %edi
+     35c:	5d                   	pop    %ebp
+     35d:	c3                   	ret
+  dst = vdst;
+     35e:	89 df                	mov    %ebx,%edi
+     360:	eb eb                	jmp    34d <memmove+0x95>
+
+00000362 <vclock_gettime>:
+
+// clock_gettime() without a system call: read the clock page
+// that the kernel maps at CLOCKPAGE (see clock.h).
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+     362:	55                   	push   %ebp
+     363:	89 e5                	mov    %esp,%ebp
+     365:	57                   	push   %edi
+     366:	56                   	push   %esi
+     367:	53                   	push   %ebx
+     368:	83 ec 14             	sub    $0x14,%esp
+  struct clockpage *cp = (struct clockpage*)CLOCKPAGE;
+  uint seq, rem, d;
+  uint64 tsc, ns, now;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+     36b:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     36f:	0f 87 a3 00 00 00    	ja     418 <vclock_gettime+0xb6>
+    return -1;
+  do {
+    seq = cp->seq;
+     375:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+    __sync_synchronize();
+     37a:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    tsc = cp->tsc;
+     37f:	8b 15 10 f0 ff 7f    	mov    0x7ffff010,%edx
+     385:	8b 1d 14 f0 ff 7f    	mov    0x7ffff014,%ebx
+    ns = cp->ns;
+     38b:	8b 35 18 f0 ff 7f    	mov    0x7ffff018,%esi
+     391:	8b 3d 1c f0 ff 7f    	mov    0x7ffff01c,%edi
+    __sync_synchronize();
+     397:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != cp->seq);
+     39c:	89 c1                	mov    %eax,%ecx
+     39e:	83 e1 01             	and    $0x1,%ecx
+     3a1:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     3a4:	75 cf                	jne    375 <vclock_gettime+0x13>
+     3a6:	8b 0d 00 f0 ff 7f    	mov    0x7ffff000,%ecx
+     3ac:	39 c1                	cmp    %eax,%ecx
+     3ae:	75 c5                	jne    375 <vclock_gettime+0x13>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+     3b0:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     3b3:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     3b6:	0f 31                	rdtsc
+     3b8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     3bb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     3be:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  now = rdtsc();
+  // Less than a tick has passed since the update, so the delta
+  // fits in 32 bits.
+  d = now > tsc ? now - tsc : 0;
+     3c1:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     3c4:	19 d3                	sbb    %edx,%ebx
+     3c6:	73 07                	jae    3cf <vclock_gettime+0x6d>
+     3c8:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+     3cb:	29 d8                	sub    %ebx,%eax
+     3cd:	89 c1                	mov    %eax,%ecx
+  ns += ((uint64)d * cp->mult) >> cp->shift;
+     3cf:	89 c8                	mov    %ecx,%eax
+     3d1:	f7 25 04 f0 ff 7f    	mull   0x7ffff004
+     3d7:	0f b6 0d 08 f0 ff 7f 	movzbl 0x7ffff008,%ecx
+     3de:	0f ad d0             	shrd   %cl,%edx,%eax
+     3e1:	d3 ea                	shr    %cl,%edx
+     3e3:	f6 c1 20             	test   $0x20,%cl
+     3e6:	74 04                	je     3ec <vclock_gettime+0x8a>
+     3e8:	89 d0                	mov    %edx,%eax
+     3ea:	31 d2                	xor    %edx,%edx
+     3ec:	01 f0                	add    %esi,%eax
+     3ee:	11 fa                	adc    %edi,%edx
+static inline uint
+divl(uint64 n, uint d, uint *r)
+{
+  uint q;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (*r) :
+     3f0:	bb 00 ca 9a 3b       	mov    $0x3b9aca00,%ebx
+     3f5:	f7 f3                	div    %ebx
+  ts->tv_sec = divl(ns, 1000000000, &rem);
+     3f7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     3fa:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = rem;
+     3fc:	89 57 04             	mov    %edx,0x4(%edi)
+  if(clk == CLOCK_REALTIME)
+     3ff:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     403:	75 1a                	jne    41f <vclock_gettime+0xbd>
+    ts->tv_sec += cp->boottime;
+     405:	03 05 0c f0 ff 7f    	add    0x7ffff00c,%eax
+     40b:	89 07                	mov    %eax,(%edi)
+  return 0;
+     40d:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     410:	83 c4 14             	add    $0x14,%esp
+     413:	5b                   	pop    %ebx
+     414:	5e                   	pop    %esi
+     415:	5f                   	pop    %edi
+     416:	5d                   	pop    %ebp
+     417:	c3                   	ret
+    return -1;
+     418:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     41d:	eb f1                	jmp    410 <vclock_gettime+0xae>
+  return 0;
+     41f:	b8 00 00 00 00       	mov    $0x0,%eax
+     424:	eb ea                	jmp    410 <vclock_gettime+0xae>
+
+00000426 <flush>:
+
+// Write out fd's buffer, or with fd < 0 every buffer.
+// Returns -1 if a write fails.
+int
+flush(int fd)
+{
+     426:	55                   	push   %ebp
+     427:	89 e5                	mov    %esp,%ebp
+     429:	56                   	push   %esi
+     42a:	53                   	push   %ebx
+     42b:	8b 45 08             	mov    0x8(%ebp),%eax
+  int r, n;
+
+  if(fd < 0){
+     42e:	85 c0                	test   %eax,%eax
+     430:	78 5d                	js     48f <flush+0x69>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+      if(flush(fd) < 0)
+        r = -1;
+    return r;
+  }
+  if(fd >= NOBUF || (n = obuf[fd].n) == 0)
+     432:	83 f8 0f             	cmp    $0xf,%eax
+     435:	7f 64                	jg     49b <flush+0x75>
+     437:	69 d0 08 02 00 00    	imul   $0x208,%eax,%edx
+     43d:	8b b2 24 19 00 00    	mov    0x1924(%edx),%esi
+     443:	85 f6                	test   %esi,%esi
+     445:	74 59                	je     4a0 <flush+0x7a>
+    return 0;
+  obuf[fd].n = 0;
+     447:	c7 82 24 19 00 00 00 	movl   $0x0,0x1924(%edx)
+     44e:	00 00 00 
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     451:	81 c2 28 19 00 00    	add    $0x1928,%edx
+     457:	83 ec 04             	sub    $0x4,%esp
+     45a:	56                   	push   %esi
+     45b:	52                   	push   %edx
+     45c:	50                   	push   %eax
+     45d:	e8 5a 03 00 00       	call   7bc <write>
+     462:	83 c4 10             	add    $0x10,%esp
+     465:	39 f0                	cmp    %esi,%eax
+     467:	75 40                	jne    4a9 <flush+0x83>
+     469:	be 00 00 00 00       	mov    $0x0,%esi
+     46e:	eb 30                	jmp    4a0 <flush+0x7a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     470:	83 c3 01             	add    $0x1,%ebx
+     473:	83 fb 0f             	cmp    $0xf,%ebx
+     476:	7f 28                	jg     4a0 <flush+0x7a>
+      if(flush(fd) < 0)
+     478:	83 ec 0c             	sub    $0xc,%esp
+     47b:	53                   	push   %ebx
+     47c:	e8 a5 ff ff ff       	call   426 <flush>
+     481:	83 c4 10             	add    $0x10,%esp
+     484:	85 c0                	test   %eax,%eax
+     486:	79 e8                	jns    470 <flush+0x4a>
+        r = -1;
+     488:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     48d:	eb e1                	jmp    470 <flush+0x4a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     48f:	be 00 00 00 00       	mov    $0x0,%esi
+     494:	bb 00 00 00 00       	mov    $0x0,%ebx
+     499:	eb d8                	jmp    473 <flush+0x4d>
+    return 0;
+     49b:	be 00 00 00 00       	mov    $0x0,%esi
+}
+     4a0:	89 f0                	mov    %esi,%eax
+     4a2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     4a5:	5b                   	pop    %ebx
+     4a6:	5e                   	pop    %esi
+     4a7:	5d                   	pop    %ebp
+     4a8:	c3                   	ret
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     4a9:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     4ae:	eb f0                	jmp    4a0 <flush+0x7a>
+
+000004b0 <bufreset>:
+
+static void
+bufreset(int fd)
+{
+  if(fd >= 0 && fd < NOBUF){
+     4b0:	83 f8 0f             	cmp    $0xf,%eax
+     4b3:	76 01                	jbe    4b6 <bufreset+0x6>
+     4b5:	c3                   	ret
+{
+     4b6:	55                   	push   %ebp
+     4b7:	89 e5                	mov    %esp,%ebp
+     4b9:	53                   	push   %ebx
+     4ba:	83 ec 10             	sub    $0x10,%esp
+     4bd:	89 c3                	mov    %eax,%ebx
+    flush(fd);
+     4bf:	50                   	push   %eax
+     4c0:	e8 61 ff ff ff       	call   426 <flush>
+    obuf[fd].mode = BUNKNOWN;
+     4c5:	69 db 08 02 00 00    	imul   $0x208,%ebx,%ebx
+     4cb:	c7 83 20 19 00 00 00 	movl   $0x0,0x1920(%ebx)
+     4d2:	00 00 00 
+     4d5:	83 c4 10             	add    $0x10,%esp
+  }
+}
+     4d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4db:	c9                   	leave
+     4dc:	c3                   	ret
+
+000004dd <bufwrite>:
+
+// Write n bytes from p to fd, through its buffer.
+// Returns n, or -1 if a write fails.
+int
+bufwrite(int fd, const void *p, int n)
+{
+     4dd:	55                   	push   %ebp
+     4de:	89 e5                	mov    %esp,%ebp
+     4e0:	57                   	push   %edi
+     4e1:	56                   	push   %esi
+     4e2:	53                   	push   %ebx
+     4e3:	83 ec 3c             	sub    $0x3c,%esp
+     4e6:	8b 75 08             	mov    0x8(%ebp),%esi
+     4e9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct stat st;
+  const char *s;
+  int i;
+
+  if(fd < 0 || fd >= NOBUF)
+     4ec:	83 fe 0f             	cmp    $0xf,%esi
+     4ef:	0f 87 a2 00 00 00    	ja     597 <bufwrite+0xba>
+    return write(fd, p, n);
+  if(obuf[fd].mode == BUNKNOWN){
+     4f5:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     4fb:	83 b8 20 19 00 00 00 	cmpl   $0x0,0x1920(%eax)
+     502:	75 19                	jne    51d <bufwrite+0x40>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     504:	83 fe 02             	cmp    $0x2,%esi
+     507:	0f 85 9c 00 00 00    	jne    5a9 <bufwrite+0xcc>
+      obuf[fd].mode = BNONE;
+     50d:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     513:	c7 80 20 19 00 00 01 	movl   $0x1,0x1920(%eax)
+     51a:	00 00 00 
+    else
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+  }
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     51d:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     523:	89 da                	mov    %ebx,%edx
+     525:	03 90 24 19 00 00    	add    0x1924(%eax),%edx
+     52b:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+     531:	0f 8f ae 00 00 00    	jg     5e5 <bufwrite+0x108>
+    return -1;
+  if(n >= OBUFSZ)
+     537:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+     53d:	0f 8f bd 00 00 00    	jg     600 <bufwrite+0x123>
+    return write(fd, p, n);
+  memmove(obuf[fd].buf + obuf[fd].n, p, n);
+     543:	69 d6 08 02 00 00    	imul   $0x208,%esi,%edx
+     549:	8d ba 20 19 00 00    	lea    0x1920(%edx),%edi
+     54f:	8b 82 24 19 00 00    	mov    0x1924(%edx),%eax
+     555:	83 ec 04             	sub    $0x4,%esp
+     558:	53                   	push   %ebx
+     559:	ff 75 0c             	push   0xc(%ebp)
+     55c:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     55f:	8d 84 10 28 19 00 00 	lea    0x1928(%eax,%edx,1),%eax
+     566:	50                   	push   %eax
+     567:	e8 4c fd ff ff       	call   2b8 <memmove>
+  obuf[fd].n += n;
+     56c:	01 5f 04             	add    %ebx,0x4(%edi)
+  if(obuf[fd].mode == BNONE)
+     56f:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     572:	8b 82 20 19 00 00    	mov    0x1920(%edx),%eax
+     578:	83 c4 10             	add    $0x10,%esp
+     57b:	83 f8 01             	cmp    $0x1,%eax
+     57e:	0f 84 91 00 00 00    	je     615 <bufwrite+0x138>
+    return flush(fd) < 0 ? -1 : n;
+  if(obuf[fd].mode == BLINE)
+     584:	83 f8 02             	cmp    $0x2,%eax
+     587:	0f 84 ca 00 00 00    	je     657 <bufwrite+0x17a>
+    for(s = p, i = 0; i < n; i++)
+      if(s[i] == '\n')
+        return flush(fd) < 0 ? -1 : n;
+  return n;
+     58d:	89 d8                	mov    %ebx,%eax
+}
+     58f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     592:	5b                   	pop    %ebx
+     593:	5e                   	pop    %esi
+     594:	5f                   	pop    %edi
+     595:	5d                   	pop    %ebp
+     596:	c3                   	ret
+    return write(fd, p, n);
+     597:	83 ec 04             	sub    $0x4,%esp
+     59a:	53                   	push   %ebx
+     59b:	ff 75 0c             	push   0xc(%ebp)
+     59e:	56                   	push   %esi
+     59f:	e8 18 02 00 00       	call   7bc <write>
+     5a4:	83 c4 10             	add    $0x10,%esp
+     5a7:	eb e6                	jmp    58f <bufwrite+0xb2>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     5a9:	83 ec 08             	sub    $0x8,%esp
+     5ac:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     5af:	50                   	push   %eax
+     5b0:	56                   	push   %esi
+     5b1:	e8 51 02 00 00       	call   807 <fstat>
+     5b6:	83 c4 10             	add    $0x10,%esp
+     5b9:	85 c0                	test   %eax,%eax
+     5bb:	0f 88 4c ff ff ff    	js     50d <bufwrite+0x30>
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+     5c1:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     5c6:	74 16                	je     5de <bufwrite+0x101>
+     5c8:	ba 03 00 00 00       	mov    $0x3,%edx
+     5cd:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     5d3:	89 90 20 19 00 00    	mov    %edx,0x1920(%eax)
+     5d9:	e9 3f ff ff ff       	jmp    51d <bufwrite+0x40>
+     5de:	ba 02 00 00 00       	mov    $0x2,%edx
+     5e3:	eb e8                	jmp    5cd <bufwrite+0xf0>
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     5e5:	83 ec 0c             	sub    $0xc,%esp
+     5e8:	56                   	push   %esi
+     5e9:	e8 38 fe ff ff       	call   426 <flush>
+     5ee:	83 c4 10             	add    $0x10,%esp
+     5f1:	85 c0                	test   %eax,%eax
+     5f3:	0f 89 3e ff ff ff    	jns    537 <bufwrite+0x5a>
+    return -1;
+     5f9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     5fe:	eb 8f                	jmp    58f <bufwrite+0xb2>
+    return write(fd, p, n);
+     600:	83 ec 04             	sub    $0x4,%esp
+     603:	53                   	push   %ebx
+     604:	ff 75 0c             	push   0xc(%ebp)
+     607:	56                   	push   %esi
+     608:	e8 af 01 00 00       	call   7bc <write>
+     60d:	83 c4 10             	add    $0x10,%esp
+     610:	e9 7a ff ff ff       	jmp    58f <bufwrite+0xb2>
+    return flush(fd) < 0 ? -1 : n;
+     615:	83 ec 0c             	sub    $0xc,%esp
+     618:	56                   	push   %esi
+     619:	e8 08 fe ff ff       	call   426 <flush>
+     61e:	83 c4 10             	add    $0x10,%esp
+     621:	85 c0                	test   %eax,%eax
+     623:	78 07                	js     62c <bufwrite+0x14f>
+     625:	89 d8                	mov    %ebx,%eax
+     627:	e9 63 ff ff ff       	jmp    58f <bufwrite+0xb2>
+     62c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     631:	e9 59 ff ff ff       	jmp    58f <bufwrite+0xb2>
+        return flush(fd) < 0 ? -1 : n;
+     636:	83 ec 0c             	sub    $0xc,%esp
+     639:	56                   	push   %esi
+     63a:	e8 e7 fd ff ff       	call   426 <flush>
+     63f:	83 c4 10             	add    $0x10,%esp
+     642:	85 c0                	test   %eax,%eax
+     644:	78 07                	js     64d <bufwrite+0x170>
+     646:	89 d8                	mov    %ebx,%eax
+     648:	e9 42 ff ff ff       	jmp    58f <bufwrite+0xb2>
+     64d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     652:	e9 38 ff ff ff       	jmp    58f <bufwrite+0xb2>
+    for(s = p, i = 0; i < n; i++)
+     657:	b8 00 00 00 00       	mov    $0x0,%eax
+     65c:	39 d8                	cmp    %ebx,%eax
+     65e:	7d 0e                	jge    66e <bufwrite+0x191>
+      if(s[i] == '\n')
+     660:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     663:	80 3c 01 0a          	cmpb   $0xa,(%ecx,%eax,1)
+     667:	74 cd                	je     636 <bufwrite+0x159>
+    for(s = p, i = 0; i < n; i++)
+     669:	83 c0 01             	add    $0x1,%eax
+     66c:	eb ee                	jmp    65c <bufwrite+0x17f>
+  return n;
+     66e:	89 d8                	mov    %ebx,%eax
+     670:	e9 1a ff ff ff       	jmp    58f <bufwrite+0xb2>
+
+00000675 <fork>:
+
+int
+fork(void)
+{
+     675:	55                   	push   %ebp
+     676:	89 e5                	mov    %esp,%ebp
+     678:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     67b:	6a ff                	push   $0xffffffff
+     67d:	e8 a4 fd ff ff       	call   426 <flush>
+  return _fork();
+     682:	e8 bd 00 00 00       	call   744 <_fork>
+}
+     687:	c9                   	leave
+     688:	c3                   	ret
+
+00000689 <exit>:
+
+int
+exit(void)
+{
+     689:	55                   	push   %ebp
+     68a:	89 e5                	mov    %esp,%ebp
+     68c:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     68f:	6a ff                	push   $0xffffffff
+     691:	e8 90 fd ff ff       	call   426 <flush>
+  _exit();
+     696:	e8 b8 00 00 00       	call   753 <_exit>
+
+0000069b <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     69b:	55                   	push   %ebp
+     69c:	89 e5                	mov    %esp,%ebp
+     69e:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     6a1:	6a ff                	push   $0xffffffff
+     6a3:	e8 7e fd ff ff       	call   426 <flush>
+  return _exec(path, argv);
+     6a8:	83 c4 08             	add    $0x8,%esp
+     6ab:	ff 75 0c             	push   0xc(%ebp)
+     6ae:	ff 75 08             	push   0x8(%ebp)
+     6b1:	e8 bb 00 00 00       	call   771 <_exec>
+}
+     6b6:	c9                   	leave
+     6b7:	c3                   	ret
+
+000006b8 <close>:
+
+int
+close(int fd)
+{
+     6b8:	55                   	push   %ebp
+     6b9:	89 e5                	mov    %esp,%ebp
+     6bb:	53                   	push   %ebx
+     6bc:	83 ec 04             	sub    $0x4,%esp
+     6bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bufreset(fd);
+     6c2:	89 d8                	mov    %ebx,%eax
+     6c4:	e8 e7 fd ff ff       	call   4b0 <bufreset>
+  return _close(fd);
+     6c9:	83 ec 0c             	sub    $0xc,%esp
+     6cc:	53                   	push   %ebx
+     6cd:	e8 90 00 00 00       	call   762 <_close>
+}
+     6d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6d5:	c9                   	leave
+     6d6:	c3                   	ret
+
+000006d7 <stat>:
+{
+     6d7:	55                   	push   %ebp
+     6d8:	89 e5                	mov    %esp,%ebp
+     6da:	56                   	push   %esi
+     6db:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     6dc:	83 ec 08             	sub    $0x8,%esp
+     6df:	6a 00                	push   $0x0
+     6e1:	ff 75 08             	push   0x8(%ebp)
+     6e4:	e8 f1 00 00 00       	call   7da <open>
+  if(fd < 0)
+     6e9:	83 c4 10             	add    $0x10,%esp
+     6ec:	85 c0                	test   %eax,%eax
+     6ee:	78 24                	js     714 <stat+0x3d>
+     6f0:	89 c3                	mov    %eax,%ebx
+  r = fstat(fd, st);
+     6f2:	83 ec 08             	sub    $0x8,%esp
+     6f5:	ff 75 0c             	push   0xc(%ebp)
+     6f8:	50                   	push   %eax
+     6f9:	e8 09 01 00 00       	call   807 <fstat>
+     6fe:	89 c6                	mov    %eax,%esi
+  close(fd);
+     700:	89 1c 24             	mov    %ebx,(%esp)
+     703:	e8 b0 ff ff ff       	call   6b8 <close>
+  return r;
+     708:	83 c4 10             	add    $0x10,%esp
+}
+     70b:	89 f0                	mov    %esi,%eax
+     70d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     710:	5b                   	pop    %ebx
+     711:	5e                   	pop    %esi
+     712:	5d                   	pop    %ebp
+     713:	c3                   	ret
+    return -1;
+     714:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     719:	eb f0                	jmp    70b <stat+0x34>
+
+0000071b <dup2>:
+
+int
+dup2(int oldfd, int newfd)
+{
+     71b:	55                   	push   %ebp
+     71c:	89 e5                	mov    %esp,%ebp
+     71e:	56                   	push   %esi
+     71f:	53                   	push   %ebx
+     720:	8b 75 08             	mov    0x8(%ebp),%esi
+     723:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(oldfd != newfd)
+     726:	39 de                	cmp    %ebx,%esi
+     728:	75 11                	jne    73b <dup2+0x20>
+    bufreset(newfd);
+  return _dup2(oldfd, newfd);
+     72a:	83 ec 08             	sub    $0x8,%esp
+     72d:	53                   	push   %ebx
+     72e:	56                   	push   %esi
+     72f:	e8 4c 00 00 00       	call   780 <_dup2>
+}
+     734:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     737:	5b                   	pop    %ebx
+     738:	5e                   	pop    %esi
+     739:	5d                   	pop    %ebp
+     73a:	c3                   	ret
+    bufreset(newfd);
+     73b:	89 d8                	mov    %ebx,%eax
+     73d:	e8 6e fd ff ff       	call   4b0 <bufreset>
+     742:	eb e6                	jmp    72a <dup2+0xf>
+
+00000744 <_fork>:
+  1: ret
+
+#define SYSCALL(name) STUB(name, SYS_ ## name)
+
+# ulib.c wraps these, to flush printf()'s buffers first.
+STUB(_fork, SYS_fork)
+     744:	b8 01 00 00 00       	mov    $0x1,%eax
+     749:	89 e1                	mov    %esp,%ecx
+     74b:	ba 52 07 00 00       	mov    $0x752,%edx
+     750:	0f 34                	sysenter
+     752:	c3                   	ret
+
+00000753 <_exit>:
+STUB(_exit, SYS_exit)
+     753:	b8 02 00 00 00       	mov    $0x2,%eax
+     758:	89 e1                	mov    %esp,%ecx
+     75a:	ba 61 07 00 00       	mov    $0x761,%edx
+     75f:	0f 34                	sysenter
+     761:	c3                   	ret
+
+00000762 <_close>:
+STUB(_close, SYS_close)
+     762:	b8 15 00 00 00       	mov    $0x15,%eax
+     767:	89 e1                	mov    %esp,%ecx
+     769:	ba 70 07 00 00       	mov    $0x770,%edx
+     76e:	0f 34                	sysenter
+     770:	c3                   	ret
+
+00000771 <_exec>:
+STUB(_exec, SYS_exec)
+     771:	b8 07 00 00 00       	mov    $0x7,%eax
+     776:	89 e1                	mov    %esp,%ecx
+     778:	ba 7f 07 00 00       	mov    $0x77f,%edx
+     77d:	0f 34                	sysenter
+     77f:	c3                   	ret
+
+00000780 <_dup2>:
+STUB(_dup2, SYS_dup2)
+     780:	b8 17 00 00 00       	mov    $0x17,%eax
+     785:	89 e1                	mov    %esp,%ecx
+     787:	ba 8e 07 00 00       	mov    $0x78e,%edx
+     78c:	0f 34                	sysenter
+     78e:	c3                   	ret
+
+0000078f <wait>:
+
+SYSCALL(wait)
+     78f:	b8 03 00 00 00       	mov    $0x3,%eax
+     794:	89 e1                	mov    %esp,%ecx
+     796:	ba 9d 07 00 00       	mov    $0x79d,%edx
+     79b:	0f 34                	sysenter
+     79d:	c3                   	ret
+
+0000079e <pipe>:
+SYSCALL(pipe)
+     79e:	b8 04 00 00 00       	mov    $0x4,%eax
+     7a3:	89 e1                	mov    %esp,%ecx
+     7a5:	ba ac 07 00 00       	mov    $0x7ac,%edx
+     7aa:	0f 34                	sysenter
+     7ac:	c3                   	ret
+
+000007ad <read>:
+SYSCALL(read)
+     7ad:	b8 05 00 00 00       	mov    $0x5,%eax
+     7b2:	89 e1                	mov    %esp,%ecx
+     7b4:	ba bb 07 00 00       	mov    $0x7bb,%edx
+     7b9:	0f 34                	sysenter
+     7bb:	c3                   	ret
+
+000007bc <write>:
+SYSCALL(write)
+     7bc:	b8 10 00 00 00       	mov    $0x10,%eax
+     7c1:	89 e1                	mov    %esp,%ecx
+     7c3:	ba ca 07 00 00       	mov    $0x7ca,%edx
+     7c8:	0f 34                	sysenter
+     7ca:	c3                   	ret
+
+000007cb <kill>:
+SYSCALL(kill)
+     7cb:	b8 06 00 00 00       	mov    $0x6,%eax
+     7d0:	89 e1                	mov    %esp,%ecx
+     7d2:	ba d9 07 00 00       	mov    $0x7d9,%edx
+     7d7:	0f 34                	sysenter
+     7d9:	c3                   	ret
+
+000007da <open>:
+SYSCALL(open)
+     7da:	b8 0f 00 00 00       	mov    $0xf,%eax
+     7df:	89 e1                	mov    %esp,%ecx
+     7e1:	ba e8 07 00 00       	mov    $0x7e8,%edx
+     7e6:	0f 34                	sysenter
+     7e8:	c3                   	ret
+
+000007e9 <mknod>:
+SYSCALL(mknod)
+     7e9:	b8 11 00 00 00       	mov    $0x11,%eax
+     7ee:	89 e1                	mov    %esp,%ecx
+     7f0:	ba f7 07 00 00       	mov    $0x7f7,%edx
+     7f5:	0f 34                	sysenter
+     7f7:	c3                   	ret
+
+000007f8 <unlink>:
+SYSCALL(unlink)
+     7f8:	b8 12 00 00 00       	mov    $0x12,%eax
+     7fd:	89 e1                	mov    %esp,%ecx
+     7ff:	ba 06 08 00 00       	mov    $0x806,%edx
+     804:	0f 34                	sysenter
+     806:	c3                   	ret
+
+00000807 <fstat>:
+SYSCALL(fstat)
+     807:	b8 08 00 00 00       	mov    $0x8,%eax
+     80c:	89 e1                	mov    %esp,%ecx
+     80e:	ba 15 08 00 00       	mov    $0x815,%edx
+     813:	0f 34                	sysenter
+     815:	c3                   	ret
+
+00000816 <link>:
+SYSCALL(link)
+     816:	b8 13 00 00 00       	mov    $0x13,%eax
+     81b:	89 e1                	mov    %esp,%ecx
+     81d:	ba 24 08 00 00       	mov    $0x824,%edx
+     822:	0f 34                	sysenter
+     824:	c3                   	ret
+
+00000825 <mkdir>:
+SYSCALL(mkdir)
+     825:	b8 14 00 00 00       	mov    $0x14,%eax
+     82a:	89 e1                	mov    %esp,%ecx
+     82c:	ba 33 08 00 00       	mov    $0x833,%edx
+     831:	0f 34                	sysenter
+     833:	c3                   	ret
+
+00000834 <chdir>:
+SYSCALL(chdir)
+     834:	b8 09 00 00 00       	mov    $0x9,%eax
+     839:	89 e1                	mov    %esp,%ecx
+     83b:	ba 42 08 00 00       	mov    $0x842,%edx
+     840:	0f 34                	sysenter
+     842:	c3                   	ret
+
+00000843 <dup>:
+SYSCALL(dup)
+     843:	b8 0a 00 00 00       	mov    $0xa,%eax
+     848:	89 e1                	mov    %esp,%ecx
+     84a:	ba 51 08 00 00       	mov    $0x851,%edx
+     84f:	0f 34                	sysenter
+     851:	c3                   	ret
+
+00000852 <getpid>:
+SYSCALL(getpid)
+     852:	b8 0b 00 00 00       	mov    $0xb,%eax
+     857:	89 e1                	mov    %esp,%ecx
+     859:	ba 60 08 00 00       	mov    $0x860,%edx
+     85e:	0f 34                	sysenter
+     860:	c3                   	ret
+
+00000861 <sbrk>:
+SYSCALL(sbrk)
+     861:	b8 0c 00 00 00       	mov    $0xc,%eax
+     866:	89 e1                	mov    %esp,%ecx
+     868:	ba 6f 08 00 00       	mov    $0x86f,%edx
+     86d:	0f 34                	sysenter
+     86f:	c3                   	ret
+
+00000870 <sleep>:
+SYSCALL(sleep)
+     870:	b8 0d 00 00 00       	mov    $0xd,%eax
+     875:	89 e1                	mov    %esp,%ecx
+     877:	ba 7e 08 00 00       	mov    $0x87e,%edx
+     87c:	0f 34                	sysenter
+     87e:	c3                   	ret
+
+0000087f <uptime>:
+SYSCALL(uptime)
+     87f:	b8 0e 00 00 00       	mov    $0xe,%eax
+     884:	89 e1                	mov    %esp,%ecx
+     886:	ba 8d 08 00 00       	mov    $0x88d,%edx
+     88b:	0f 34                	sysenter
+     88d:	c3                   	ret
+
+0000088e <date>:
+SYSCALL(date)
+     88e:	b8 16 00 00 00       	mov    $0x16,%eax
+     893:	89 e1                	mov    %esp,%ecx
+     895:	ba 9c 08 00 00       	mov    $0x89c,%edx
+     89a:	0f 34                	sysenter
+     89c:	c3                   	ret
+
+0000089d <faultaround>:
+SYSCALL(faultaround)
+     89d:	b8 18 00 00 00       	mov    $0x18,%eax
+     8a2:	89 e1                	mov    %esp,%ecx
+     8a4:	ba ab 08 00 00       	mov    $0x8ab,%edx
+     8a9:	0f 34                	sysenter
+     8ab:	c3                   	ret
+
+000008ac <faultstat>:
+SYSCALL(faultstat)
+     8ac:	b8 19 00 00 00       	mov    $0x19,%eax
+     8b1:	89 e1                	mov    %esp,%ecx
+     8b3:	ba ba 08 00 00       	mov    $0x8ba,%edx
+     8b8:	0f 34                	sysenter
+     8ba:	c3                   	ret
+
+000008bb <mmap>:
+SYSCALL(mmap)
+     8bb:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     8c0:	89 e1                	mov    %esp,%ecx
+     8c2:	ba c9 08 00 00       	mov    $0x8c9,%edx
+     8c7:	0f 34                	sysenter
+     8c9:	c3                   	ret
+
+000008ca <munmap>:
+SYSCALL(munmap)
+     8ca:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     8cf:	89 e1                	mov    %esp,%ecx
+     8d1:	ba d8 08 00 00       	mov    $0x8d8,%edx
+     8d6:	0f 34                	sysenter
+     8d8:	c3                   	ret
+
+000008d9 <largepages>:
+SYSCALL(largepages)
+     8d9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     8de:	89 e1                	mov    %esp,%ecx
+     8e0:	ba e7 08 00 00       	mov    $0x8e7,%edx
+     8e5:	0f 34                	sysenter
+     8e7:	c3                   	ret
+
+000008e8 <spawn>:
+SYSCALL(spawn)
+     8e8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     8ed:	89 e1                	mov    %esp,%ecx
+     8ef:	ba f6 08 00 00       	mov    $0x8f6,%edx
+     8f4:	0f 34                	sysenter
+     8f6:	c3                   	ret
+
+000008f7 <setpriority>:
+SYSCALL(setpriority)
+     8f7:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     8fc:	89 e1                	mov    %esp,%ecx
+     8fe:	ba 05 09 00 00       	mov    $0x905,%edx
+     903:	0f 34                	sysenter
+     905:	c3                   	ret
+
+00000906 <getpriority>:
+SYSCALL(getpriority)
+     906:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     90b:	89 e1                	mov    %esp,%ecx
+     90d:	ba 14 09 00 00       	mov    $0x914,%edx
+     912:	0f 34                	sysenter
+     914:	c3                   	ret
+
+00000915 <getprocinfo>:
+SYSCALL(getprocinfo)
+     915:	b8 20 00 00 00       	mov    $0x20,%eax
+     91a:	89 e1                	mov    %esp,%ecx
+     91c:	ba 23 09 00 00       	mov    $0x923,%edx
+     921:	0f 34                	sysenter
+     923:	c3                   	ret
+
+00000924 <getcpuinfo>:
+SYSCALL(getcpuinfo)
+     924:	b8 21 00 00 00       	mov    $0x21,%eax
+     929:	89 e1                	mov    %esp,%ecx
+     92b:	ba 32 09 00 00       	mov    $0x932,%edx
+     930:	0f 34                	sysenter
+     932:	c3                   	ret
+
+00000933 <clone>:
+SYSCALL(clone)
+     933:	b8 22 00 00 00       	mov    $0x22,%eax
+     938:	89 e1                	mov    %esp,%ecx
+     93a:	ba 41 09 00 00       	mov    $0x941,%edx
+     93f:	0f 34                	sysenter
+     941:	c3                   	ret
+
+00000942 <join>:
+SYSCALL(join)
+     942:	b8 23 00 00 00       	mov    $0x23,%eax
+     947:	89 e1                	mov    %esp,%ecx
+     949:	ba 50 09 00 00       	mov    $0x950,%edx
+     94e:	0f 34                	sysenter
+     950:	c3                   	ret
+
+00000951 <futex_wait>:
+SYSCALL(futex_wait)
+     951:	b8 24 00 00 00       	mov    $0x24,%eax
+     956:	89 e1                	mov    %esp,%ecx
+     958:	ba 5f 09 00 00       	mov    $0x95f,%edx
+     95d:	0f 34                	sysenter
+     95f:	c3                   	ret
+
+00000960 <futex_wake>:
+SYSCALL(futex_wake)
+     960:	b8 25 00 00 00       	mov    $0x25,%eax
+     965:	89 e1                	mov    %esp,%ecx
+     967:	ba 6e 09 00 00       	mov    $0x96e,%edx
+     96c:	0f 34                	sysenter
+     96e:	c3                   	ret
+
+0000096f <setaffinity>:
+SYSCALL(setaffinity)
+     96f:	b8 26 00 00 00       	mov    $0x26,%eax
+     974:	89 e1                	mov    %esp,%ecx
+     976:	ba 7d 09 00 00       	mov    $0x97d,%edx
+     97b:	0f 34                	sysenter
+     97d:	c3                   	ret
+
+0000097e <getaffinity>:
+SYSCALL(getaffinity)
+     97e:	b8 27 00 00 00       	mov    $0x27,%eax
+     983:	89 e1                	mov    %esp,%ecx
+     985:	ba 8c 09 00 00       	mov    $0x98c,%edx
+     98a:	0f 34                	sysenter
+     98c:	c3                   	ret
+
+0000098d <clock_gettime>:
+SYSCALL(clock_gettime)
+     98d:	b8 28 00 00 00       	mov    $0x28,%eax
+     992:	89 e1                	mov    %esp,%ecx
+     994:	ba 9b 09 00 00       	mov    $0x99b,%edx
+     999:	0f 34                	sysenter
+     99b:	c3                   	ret
+
+0000099c <msleep>:
+SYSCALL(msleep)
+     99c:	b8 29 00 00 00       	mov    $0x29,%eax
+     9a1:	89 e1                	mov    %esp,%ecx
+     9a3:	ba aa 09 00 00       	mov    $0x9aa,%edx
+     9a8:	0f 34                	sysenter
+     9aa:	c3                   	ret
+
+000009ab <lockstat>:
+SYSCALL(lockstat)
+     9ab:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     9b0:	89 e1                	mov    %esp,%ecx
+     9b2:	ba b9 09 00 00       	mov    $0x9b9,%edx
+     9b7:	0f 34                	sysenter
+     9b9:	c3                   	ret
+
+000009ba <bstat>:
+SYSCALL(bstat)
+     9ba:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     9bf:	89 e1                	mov    %esp,%ecx
+     9c1:	ba c8 09 00 00       	mov    $0x9c8,%edx
+     9c6:	0f 34                	sysenter
+     9c8:	c3                   	ret
+
+000009c9 <iostat>:
+SYSCALL(iostat)
+     9c9:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     9ce:	89 e1                	mov    %esp,%ecx
+     9d0:	ba d7 09 00 00       	mov    $0x9d7,%edx
+     9d5:	0f 34                	sysenter
+     9d7:	c3                   	ret
+
+000009d8 <fsync>:
+SYSCALL(fsync)
+     9d8:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     9dd:	89 e1                	mov    %esp,%ecx
+     9df:	ba e6 09 00 00       	mov    $0x9e6,%edx
+     9e4:	0f 34                	sysenter
+     9e6:	c3                   	ret
+
+000009e7 <pread>:
+SYSCALL(pread)
+     9e7:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     9ec:	89 e1                	mov    %esp,%ecx
+     9ee:	ba f5 09 00 00       	mov    $0x9f5,%edx
+     9f3:	0f 34                	sysenter
+     9f5:	c3                   	ret
+
+000009f6 <pwrite>:
+SYSCALL(pwrite)
+     9f6:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     9fb:	89 e1                	mov    %esp,%ecx
+     9fd:	ba 04 0a 00 00       	mov    $0xa04,%edx
+     a02:	0f 34                	sysenter
+     a04:	c3                   	ret
+
+00000a05 <readv>:
+SYSCALL(readv)
+     a05:	b8 30 00 00 00       	mov    $0x30,%eax
+     a0a:	89 e1                	mov    %esp,%ecx
+     a0c:	ba 13 0a 00 00       	mov    $0xa13,%edx
+     a11:	0f 34                	sysenter
+     a13:	c3                   	ret
+
+00000a14 <writev>:
+SYSCALL(writev)
+     a14:	b8 31 00 00 00       	mov    $0x31,%eax
+     a19:	89 e1                	mov    %esp,%ecx
+     a1b:	ba 22 0a 00 00       	mov    $0xa22,%edx
+     a20:	0f 34                	sysenter
+     a22:	c3                   	ret
+
+00000a23 <sendfile>:
+SYSCALL(sendfile)
+     a23:	b8 32 00 00 00       	mov    $0x32,%eax
+     a28:	89 e1                	mov    %esp,%ecx
+     a2a:	ba 31 0a 00 00       	mov    $0xa31,%edx
+     a2f:	0f 34                	sysenter
+     a31:	c3                   	ret
+
+00000a32 <fcntl>:
+SYSCALL(fcntl)
+     a32:	b8 33 00 00 00       	mov    $0x33,%eax
+     a37:	89 e1                	mov    %esp,%ecx
+     a39:	ba 40 0a 00 00       	mov    $0xa40,%edx
+     a3e:	0f 34                	sysenter
+     a40:	c3                   	ret
+
+00000a41 <mount>:
+SYSCALL(mount)
+     a41:	b8 34 00 00 00       	mov    $0x34,%eax
+     a46:	89 e1                	mov    %esp,%ecx
+     a48:	ba 4f 0a 00 00       	mov    $0xa4f,%edx
+     a4d:	0f 34                	sysenter
+     a4f:	c3                   	ret
+
+00000a50 <getdents>:
+SYSCALL(getdents)
+     a50:	b8 35 00 00 00       	mov    $0x35,%eax
+     a55:	89 e1                	mov    %esp,%ecx
+     a57:	ba 5e 0a 00 00       	mov    $0xa5e,%edx
+     a5c:	0f 34                	sysenter
+     a5e:	c3                   	ret
+
+00000a5f <fstatat>:
+SYSCALL(fstatat)
+     a5f:	b8 36 00 00 00       	mov    $0x36,%eax
+     a64:	89 e1                	mov    %esp,%ecx
+     a66:	ba 6d 0a 00 00       	mov    $0xa6d,%edx
+     a6b:	0f 34                	sysenter
+     a6d:	c3                   	ret
+
+00000a6e <sysstat>:
+SYSCALL(sysstat)
+     a6e:	b8 37 00 00 00       	mov    $0x37,%eax
+     a73:	89 e1                	mov    %esp,%ecx
+     a75:	ba 7c 0a 00 00       	mov    $0xa7c,%edx
+     a7a:	0f 34                	sysenter
+     a7c:	c3                   	ret
+
+00000a7d <ringenter>:
+SYSCALL(ringenter)
+     a7d:	b8 38 00 00 00       	mov    $0x38,%eax
+     a82:	89 e1                	mov    %esp,%ecx
+     a84:	ba 8b 0a 00 00       	mov    $0xa8b,%edx
+     a89:	0f 34                	sysenter
+     a8b:	c3                   	ret
+
+00000a8c <trace>:
+SYSCALL(trace)
+     a8c:	b8 39 00 00 00       	mov    $0x39,%eax
+     a91:	89 e1                	mov    %esp,%ecx
+     a93:	ba 9a 0a 00 00       	mov    $0xa9a,%edx
+     a98:	0f 34                	sysenter
+     a9a:	c3                   	ret
+
+00000a9b <memstat>:
+SYSCALL(memstat)
+     a9b:	b8 3a 00 00 00       	mov    $0x3a,%eax
+     aa0:	89 e1                	mov    %esp,%ecx
+     aa2:	ba a9 0a 00 00       	mov    $0xaa9,%edx
+     aa7:	0f 34                	sysenter
+     aa9:	c3                   	ret
+
+00000aaa <shmget>:
+SYSCALL(shmget)
+     aaa:	b8 3b 00 00 00       	mov    $0x3b,%eax
+     aaf:	89 e1                	mov    %esp,%ecx
+     ab1:	ba b8 0a 00 00       	mov    $0xab8,%edx
+     ab6:	0f 34                	sysenter
+     ab8:	c3                   	ret
+
+00000ab9 <shmat>:
+SYSCALL(shmat)
+     ab9:	b8 3c 00 00 00       	mov    $0x3c,%eax
+     abe:	89 e1                	mov    %esp,%ecx
+     ac0:	ba c7 0a 00 00       	mov    $0xac7,%edx
+     ac5:	0f 34                	sysenter
+     ac7:	c3                   	ret
+
+00000ac8 <shmdt>:
+SYSCALL(shmdt)
+     ac8:	b8 3d 00 00 00       	mov    $0x3d,%eax
+     acd:	89 e1                	mov    %esp,%ecx
+     acf:	ba d6 0a 00 00       	mov    $0xad6,%edx
+     ad4:	0f 34                	sysenter
+     ad6:	c3                   	ret
+
+00000ad7 <irqstat>:
+SYSCALL(irqstat)
+     ad7:	b8 3e 00 00 00       	mov    $0x3e,%eax
+     adc:	89 e1                	mov    %esp,%ecx
+     ade:	ba e5 0a 00 00       	mov    $0xae5,%edx
+     ae3:	0f 34                	sysenter
+     ae5:	c3                   	ret
+
+00000ae6 <irqroute>:
+SYSCALL(irqroute)
+     ae6:	b8 3f 00 00 00       	mov    $0x3f,%eax
+     aeb:	89 e1                	mov    %esp,%ecx
+     aed:	ba f4 0a 00 00       	mov    $0xaf4,%edx
+     af2:	0f 34                	sysenter
+     af4:	c3                   	ret
+
+00000af5 <putc>:
+  char buf[64];
+};
+
+static void
+putc(struct out *o, char c)
+{
+     af5:	55                   	push   %ebp
+     af6:	89 e5                	mov    %esp,%ebp
+     af8:	56                   	push   %esi
+     af9:	53                   	push   %ebx
+     afa:	89 c3                	mov    %eax,%ebx
+     afc:	89 d6                	mov    %edx,%esi
+  if(o->n == sizeof(o->buf)){
+     afe:	8b 40 04             	mov    0x4(%eax),%eax
+     b01:	83 f8 40             	cmp    $0x40,%eax
+     b04:	74 16                	je     b1c <putc+0x27>
+    bufwrite(o->fd, o->buf, o->n);
+    o->n = 0;
+  }
+  o->buf[o->n++] = c;
+     b06:	8b 43 04             	mov    0x4(%ebx),%eax
+     b09:	8d 50 01             	lea    0x1(%eax),%edx
+     b0c:	89 53 04             	mov    %edx,0x4(%ebx)
+     b0f:	89 f1                	mov    %esi,%ecx
+     b11:	88 4c 03 08          	mov    %cl,0x8(%ebx,%eax,1)
+}
+     b15:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b18:	5b                   	pop    %ebx
+     b19:	5e                   	pop    %esi
+     b1a:	5d                   	pop    %ebp
+     b1b:	c3                   	ret
+    bufwrite(o->fd, o->buf, o->n);
+     b1c:	8d 53 08             	lea    0x8(%ebx),%edx
+     b1f:	83 ec 04             	sub    $0x4,%esp
+     b22:	50                   	push   %eax
+     b23:	52                   	push   %edx
+     b24:	ff 33                	push   (%ebx)
+     b26:	e8 b2 f9 ff ff       	call   4dd <bufwrite>
+    o->n = 0;
+     b2b:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     b32:	83 c4 10             	add    $0x10,%esp
+     b35:	eb cf                	jmp    b06 <putc+0x11>
+
+00000b37 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     b37:	55                   	push   %ebp
+     b38:	89 e5                	mov    %esp,%ebp
+     b3a:	57                   	push   %edi
+     b3b:	56                   	push   %esi
+     b3c:	53                   	push   %ebx
+     b3d:	83 ec 2c             	sub    $0x2c,%esp
+     b40:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     b43:	89 d0                	mov    %edx,%eax
+     b45:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+     b47:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     b4b:	0f 95 c1             	setne  %cl
+     b4e:	c1 ea 1f             	shr    $0x1f,%edx
+     b51:	84 d1                	test   %dl,%cl
+     b53:	74 44                	je     b99 <printint+0x62>
+    neg = 1;
+    x = -xx;
+     b55:	f7 d8                	neg    %eax
+     b57:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+     b59:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     b60:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+     b65:	89 c8                	mov    %ecx,%eax
+     b67:	ba 00 00 00 00       	mov    $0x0,%edx
+     b6c:	f7 f6                	div    %esi
+     b6e:	89 df                	mov    %ebx,%edi
+     b70:	83 c3 01             	add    $0x1,%ebx
+     b73:	0f b6 92 48 12 00 00 	movzbl 0x1248(%edx),%edx
+     b7a:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+     b7e:	89 ca                	mov    %ecx,%edx
+     b80:	89 c1                	mov    %eax,%ecx
+     b82:	39 f2                	cmp    %esi,%edx
+     b84:	73 df                	jae    b65 <printint+0x2e>
+  if(neg)
+     b86:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     b8a:	74 31                	je     bbd <printint+0x86>
+    buf[i++] = '-';
+     b8c:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+     b91:	8d 5f 02             	lea    0x2(%edi),%ebx
+     b94:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     b97:	eb 17                	jmp    bb0 <printint+0x79>
+    x = xx;
+     b99:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+     b9b:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     ba2:	eb bc                	jmp    b60 <printint+0x29>
+
+  while(--i >= 0)
+    putc(o, buf[i]);
+     ba4:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+     ba9:	89 f0                	mov    %esi,%eax
+     bab:	e8 45 ff ff ff       	call   af5 <putc>
+  while(--i >= 0)
+     bb0:	83 eb 01             	sub    $0x1,%ebx
+     bb3:	79 ef                	jns    ba4 <printint+0x6d>
+}
+     bb5:	83 c4 2c             	add    $0x2c,%esp
+     bb8:	5b                   	pop    %ebx
+     bb9:	5e                   	pop    %esi
+     bba:	5f                   	pop    %edi
+     bbb:	5d                   	pop    %ebp
+     bbc:	c3                   	ret
+     bbd:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     bc0:	eb ee                	jmp    bb0 <printint+0x79>
+
+00000bc2 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     bc2:	55                   	push   %ebp
+     bc3:	89 e5                	mov    %esp,%ebp
+     bc5:	57                   	push   %edi
+     bc6:	56                   	push   %esi
+     bc7:	53                   	push   %ebx
+     bc8:	83 ec 6c             	sub    $0x6c,%esp
+  int c, i, state;
+  uint *ap;
+  struct out out, *o;
+
+  o = &out;
+  o->fd = fd;
+     bcb:	8b 45 08             	mov    0x8(%ebp),%eax
+     bce:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  o->n = 0;
+     bd1:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+     bd8:	8d 45 10             	lea    0x10(%ebp),%eax
+     bdb:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  state = 0;
+     bde:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+     be3:	bb 00 00 00 00       	mov    $0x0,%ebx
+     be8:	eb 14                	jmp    bfe <printf+0x3c>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(o, c);
+     bea:	89 fa                	mov    %edi,%edx
+     bec:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     bef:	e8 01 ff ff ff       	call   af5 <putc>
+     bf4:	eb 05                	jmp    bfb <printf+0x39>
+      }
+    } else if(state == '%'){
+     bf6:	83 fe 25             	cmp    $0x25,%esi
+     bf9:	74 25                	je     c20 <printf+0x5e>
+  for(i = 0; fmt[i]; i++){
+     bfb:	83 c3 01             	add    $0x1,%ebx
+     bfe:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c01:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+     c05:	84 c0                	test   %al,%al
+     c07:	0f 84 20 01 00 00    	je     d2d <printf+0x16b>
+    c = fmt[i] & 0xff;
+     c0d:	0f be f8             	movsbl %al,%edi
+     c10:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     c13:	85 f6                	test   %esi,%esi
+     c15:	75 df                	jne    bf6 <printf+0x34>
+      if(c == '%'){
+     c17:	83 f8 25             	cmp    $0x25,%eax
+     c1a:	75 ce                	jne    bea <printf+0x28>
+        state = '%';
+     c1c:	89 c6                	mov    %eax,%esi
+     c1e:	eb db                	jmp    bfb <printf+0x39>
+      if(c == 'd'){
+     c20:	83 f8 25             	cmp    $0x25,%eax
+     c23:	0f 84 cf 00 00 00    	je     cf8 <printf+0x136>
+     c29:	0f 8c dd 00 00 00    	jl     d0c <printf+0x14a>
+     c2f:	83 f8 78             	cmp    $0x78,%eax
+     c32:	0f 8f d4 00 00 00    	jg     d0c <printf+0x14a>
+     c38:	83 f8 63             	cmp    $0x63,%eax
+     c3b:	0f 8c cb 00 00 00    	jl     d0c <printf+0x14a>
+     c41:	83 e8 63             	sub    $0x63,%eax
+     c44:	83 f8 15             	cmp    $0x15,%eax
+     c47:	0f 87 bf 00 00 00    	ja     d0c <printf+0x14a>
+     c4d:	ff 24 85 f0 11 00 00 	jmp    *0x11f0(,%eax,4)
+        printint(o, *ap, 10, 1);
+     c54:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     c57:	8b 17                	mov    (%edi),%edx
+     c59:	83 ec 0c             	sub    $0xc,%esp
+     c5c:	6a 01                	push   $0x1
+     c5e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     c63:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     c66:	e8 cc fe ff ff       	call   b37 <printint>
+        ap++;
+     c6b:	83 c7 04             	add    $0x4,%edi
+     c6e:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     c71:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(o, '%');
+        putc(o, c);
+      }
+      state = 0;
+     c74:	be 00 00 00 00       	mov    $0x0,%esi
+     c79:	eb 80                	jmp    bfb <printf+0x39>
+        printint(o, *ap, 16, 0);
+     c7b:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     c7e:	8b 17                	mov    (%edi),%edx
+     c80:	83 ec 0c             	sub    $0xc,%esp
+     c83:	6a 00                	push   $0x0
+     c85:	b9 10 00 00 00       	mov    $0x10,%ecx
+     c8a:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     c8d:	e8 a5 fe ff ff       	call   b37 <printint>
+        ap++;
+     c92:	83 c7 04             	add    $0x4,%edi
+     c95:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     c98:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     c9b:	be 00 00 00 00       	mov    $0x0,%esi
+     ca0:	e9 56 ff ff ff       	jmp    bfb <printf+0x39>
+        s = (char*)*ap;
+     ca5:	8b 45 94             	mov    -0x6c(%ebp),%eax
+     ca8:	8b 30                	mov    (%eax),%esi
+        ap++;
+     caa:	83 c0 04             	add    $0x4,%eax
+     cad:	89 45 94             	mov    %eax,-0x6c(%ebp)
+        if(s == 0)
+     cb0:	85 f6                	test   %esi,%esi
+     cb2:	75 15                	jne    cc9 <printf+0x107>
+          s = "(null)";
+     cb4:	be e9 11 00 00       	mov    $0x11e9,%esi
+     cb9:	eb 0e                	jmp    cc9 <printf+0x107>
+          putc(o, *s);
+     cbb:	0f be d2             	movsbl %dl,%edx
+     cbe:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     cc1:	e8 2f fe ff ff       	call   af5 <putc>
+          s++;
+     cc6:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+     cc9:	0f b6 16             	movzbl (%esi),%edx
+     ccc:	84 d2                	test   %dl,%dl
+     cce:	75 eb                	jne    cbb <printf+0xf9>
+      state = 0;
+     cd0:	be 00 00 00 00       	mov    $0x0,%esi
+     cd5:	e9 21 ff ff ff       	jmp    bfb <printf+0x39>
+        putc(o, *ap);
+     cda:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     cdd:	0f be 17             	movsbl (%edi),%edx
+     ce0:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     ce3:	e8 0d fe ff ff       	call   af5 <putc>
+        ap++;
+     ce8:	83 c7 04             	add    $0x4,%edi
+     ceb:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+      state = 0;
+     cee:	be 00 00 00 00       	mov    $0x0,%esi
+     cf3:	e9 03 ff ff ff       	jmp    bfb <printf+0x39>
+        putc(o, c);
+     cf8:	89 fa                	mov    %edi,%edx
+     cfa:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     cfd:	e8 f3 fd ff ff       	call   af5 <putc>
+      state = 0;
+     d02:	be 00 00 00 00       	mov    $0x0,%esi
+     d07:	e9 ef fe ff ff       	jmp    bfb <printf+0x39>
+        putc(o, '%');
+     d0c:	ba 25 00 00 00       	mov    $0x25,%edx
+     d11:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d14:	e8 dc fd ff ff       	call   af5 <putc>
+        putc(o, c);
+     d19:	89 fa                	mov    %edi,%edx
+     d1b:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d1e:	e8 d2 fd ff ff       	call   af5 <putc>
+      state = 0;
+     d23:	be 00 00 00 00       	mov    $0x0,%esi
+     d28:	e9 ce fe ff ff       	jmp    bfb <printf+0x39>
+    }
+  }
+  if(o->n > 0)
+     d2d:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     d30:	85 c0                	test   %eax,%eax
+     d32:	7f 08                	jg     d3c <printf+0x17a>
+    bufwrite(fd, o->buf, o->n);
+}
+     d34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d37:	5b                   	pop    %ebx
+     d38:	5e                   	pop    %esi
+     d39:	5f                   	pop    %edi
+     d3a:	5d                   	pop    %ebp
+     d3b:	c3                   	ret
+    bufwrite(fd, o->buf, o->n);
+     d3c:	83 ec 04             	sub    $0x4,%esp
+     d3f:	50                   	push   %eax
+     d40:	8d 45 a8             	lea    -0x58(%ebp),%eax
+     d43:	50                   	push   %eax
+     d44:	ff 75 08             	push   0x8(%ebp)
+     d47:	e8 91 f7 ff ff       	call   4dd <bufwrite>
+     d4c:	83 c4 10             	add    $0x10,%esp
+}
+     d4f:	eb e3                	jmp    d34 <printf+0x172>
+
+00000d51 <largefree>:
+  return &b->h;
+}
+
+static void
+largefree(Fblock *b)
+{
+     d51:	55                   	push   %ebp
+     d52:	89 e5                	mov    %esp,%ebp
+     d54:	57                   	push   %edi
+     d55:	56                   	push   %esi
+     d56:	53                   	push   %ebx
+     d57:	83 ec 0c             	sub    $0xc,%esp
+     d5a:	89 c1                	mov    %eax,%ecx
+  Fblock **pp, *p, *prev;
+
+  prev = 0;
+     d5c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     d61:	ba ac 39 00 00       	mov    $0x39ac,%edx
+     d66:	eb 05                	jmp    d6d <largefree+0x1c>
+     d68:	8d 50 08             	lea    0x8(%eax),%edx
+    prev = p;
+     d6b:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     d6d:	8b 02                	mov    (%edx),%eax
+     d6f:	85 c0                	test   %eax,%eax
+     d71:	74 04                	je     d77 <largefree+0x26>
+     d73:	39 c8                	cmp    %ecx,%eax
+     d75:	72 f1                	jb     d68 <largefree+0x17>
+  b->next = p;
+     d77:	89 41 08             	mov    %eax,0x8(%ecx)
+  if(p && (char*)b + b->h.size == (char*)p){
+     d7a:	85 c0                	test   %eax,%eax
+     d7c:	74 09                	je     d87 <largefree+0x36>
+     d7e:	8b 31                	mov    (%ecx),%esi
+     d80:	8d 3c 31             	lea    (%ecx,%esi,1),%edi
+     d83:	39 c7                	cmp    %eax,%edi
+     d85:	74 21                	je     da8 <largefree+0x57>
+    b->h.size += p->h.size;
+    b->next = p->next;
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+     d87:	85 db                	test   %ebx,%ebx
+     d89:	74 09                	je     d94 <largefree+0x43>
+     d8b:	8b 03                	mov    (%ebx),%eax
+     d8d:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+     d90:	39 ce                	cmp    %ecx,%esi
+     d92:	74 20                	je     db4 <largefree+0x63>
+    prev->h.size += b->h.size;
+    prev->next = b->next;
+  } else
+    *pp = b;
+     d94:	89 0a                	mov    %ecx,(%edx)
+
+  // Give the top of the heap back.  With threads sharing the
+  // address space sbrk() cannot shrink it; keep the block then.
+  for(pp = &large; (*pp)->next; pp = &(*pp)->next)
+     d96:	be ac 39 00 00       	mov    $0x39ac,%esi
+     d9b:	8b 1e                	mov    (%esi),%ebx
+     d9d:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+     da1:	74 1d                	je     dc0 <largefree+0x6f>
+     da3:	8d 73 08             	lea    0x8(%ebx),%esi
+     da6:	eb f3                	jmp    d9b <largefree+0x4a>
+    b->h.size += p->h.size;
+     da8:	03 30                	add    (%eax),%esi
+     daa:	89 31                	mov    %esi,(%ecx)
+    b->next = p->next;
+     dac:	8b 40 08             	mov    0x8(%eax),%eax
+     daf:	89 41 08             	mov    %eax,0x8(%ecx)
+     db2:	eb d3                	jmp    d87 <largefree+0x36>
+    prev->h.size += b->h.size;
+     db4:	03 01                	add    (%ecx),%eax
+     db6:	89 03                	mov    %eax,(%ebx)
+    prev->next = b->next;
+     db8:	8b 41 08             	mov    0x8(%ecx),%eax
+     dbb:	89 43 08             	mov    %eax,0x8(%ebx)
+     dbe:	eb d6                	jmp    d96 <largefree+0x45>
+    ;
+  b = *pp;
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     dc0:	89 df                	mov    %ebx,%edi
+     dc2:	03 3b                	add    (%ebx),%edi
+     dc4:	83 ec 0c             	sub    $0xc,%esp
+     dc7:	6a 00                	push   $0x0
+     dc9:	e8 93 fa ff ff       	call   861 <sbrk>
+     dce:	83 c4 10             	add    $0x10,%esp
+     dd1:	39 c7                	cmp    %eax,%edi
+     dd3:	74 08                	je     ddd <largefree+0x8c>
+    *pp = 0;
+}
+     dd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     dd8:	5b                   	pop    %ebx
+     dd9:	5e                   	pop    %esi
+     dda:	5f                   	pop    %edi
+     ddb:	5d                   	pop    %ebp
+     ddc:	c3                   	ret
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     ddd:	8b 03                	mov    (%ebx),%eax
+     ddf:	f7 d8                	neg    %eax
+     de1:	83 ec 0c             	sub    $0xc,%esp
+     de4:	50                   	push   %eax
+     de5:	e8 77 fa ff ff       	call   861 <sbrk>
+     dea:	83 c4 10             	add    $0x10,%esp
+     ded:	83 f8 ff             	cmp    $0xffffffff,%eax
+     df0:	74 e3                	je     dd5 <largefree+0x84>
+    *pp = 0;
+     df2:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+     df8:	eb db                	jmp    dd5 <largefree+0x84>
+
+00000dfa <more>:
+{
+     dfa:	55                   	push   %ebp
+     dfb:	89 e5                	mov    %esp,%ebp
+     dfd:	56                   	push   %esi
+     dfe:	53                   	push   %ebx
+     dff:	89 c6                	mov    %eax,%esi
+  pad = -(uint)sbrk(0) & 7;
+     e01:	83 ec 0c             	sub    $0xc,%esp
+     e04:	6a 00                	push   $0x0
+     e06:	e8 56 fa ff ff       	call   861 <sbrk>
+     e0b:	f7 d8                	neg    %eax
+     e0d:	89 c3                	mov    %eax,%ebx
+     e0f:	83 e3 07             	and    $0x7,%ebx
+  if((p = sbrk(n + pad)) == (char*)-1)
+     e12:	01 de                	add    %ebx,%esi
+     e14:	89 34 24             	mov    %esi,(%esp)
+     e17:	e8 45 fa ff ff       	call   861 <sbrk>
+     e1c:	83 c4 10             	add    $0x10,%esp
+     e1f:	83 f8 ff             	cmp    $0xffffffff,%eax
+     e22:	74 09                	je     e2d <more+0x33>
+  return p + pad;
+     e24:	01 d8                	add    %ebx,%eax
+}
+     e26:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e29:	5b                   	pop    %ebx
+     e2a:	5e                   	pop    %esi
+     e2b:	5d                   	pop    %ebp
+     e2c:	c3                   	ret
+    return 0;
+     e2d:	b8 00 00 00 00       	mov    $0x0,%eax
+     e32:	eb f2                	jmp    e26 <more+0x2c>
+
+00000e34 <slaballoc>:
+{
+     e34:	55                   	push   %ebp
+     e35:	89 e5                	mov    %esp,%ebp
+     e37:	56                   	push   %esi
+     e38:	53                   	push   %ebx
+     e39:	89 c6                	mov    %eax,%esi
+  n = 1 << (MINSHIFT + c);
+     e3b:	8d 48 04             	lea    0x4(%eax),%ecx
+     e3e:	bb 01 00 00 00       	mov    $0x1,%ebx
+     e43:	d3 e3                	shl    %cl,%ebx
+  if(slab + n > slabend){
+     e45:	89 d8                	mov    %ebx,%eax
+     e47:	03 05 a8 39 00 00    	add    0x39a8,%eax
+     e4d:	39 05 a4 39 00 00    	cmp    %eax,0x39a4
+     e53:	72 17                	jb     e6c <slaballoc+0x38>
+  h = (Header*)slab;
+     e55:	a1 a8 39 00 00       	mov    0x39a8,%eax
+  slab += n;
+     e5a:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+     e5d:	89 15 a8 39 00 00    	mov    %edx,0x39a8
+  h->size = n;
+     e63:	89 18                	mov    %ebx,(%eax)
+  h->class = c;
+     e65:	89 70 04             	mov    %esi,0x4(%eax)
+}
+     e68:	5b                   	pop    %ebx
+     e69:	5e                   	pop    %esi
+     e6a:	5d                   	pop    %ebp
+     e6b:	c3                   	ret
+    if((p = more(SLABSZ)) == 0)
+     e6c:	b8 00 40 00 00       	mov    $0x4000,%eax
+     e71:	e8 84 ff ff ff       	call   dfa <more>
+     e76:	85 c0                	test   %eax,%eax
+     e78:	74 ee                	je     e68 <slaballoc+0x34>
+    if(p != slabend)
+     e7a:	39 05 a4 39 00 00    	cmp    %eax,0x39a4
+     e80:	74 05                	je     e87 <slaballoc+0x53>
+      slab = p;
+     e82:	a3 a8 39 00 00       	mov    %eax,0x39a8
+    slabend = p + SLABSZ;
+     e87:	05 00 40 00 00       	add    $0x4000,%eax
+     e8c:	a3 a4 39 00 00       	mov    %eax,0x39a4
+     e91:	eb c2                	jmp    e55 <slaballoc+0x21>
+
+00000e93 <largealloc>:
+{
+     e93:	55                   	push   %ebp
+     e94:	89 e5                	mov    %esp,%ebp
+     e96:	56                   	push   %esi
+     e97:	53                   	push   %ebx
+     e98:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     e9a:	b9 ac 39 00 00       	mov    $0x39ac,%ecx
+     e9f:	8b 01                	mov    (%ecx),%eax
+     ea1:	85 c0                	test   %eax,%eax
+     ea3:	74 36                	je     edb <largealloc+0x48>
+    if(b->h.size < n)
+     ea5:	8b 10                	mov    (%eax),%edx
+     ea7:	39 da                	cmp    %ebx,%edx
+     ea9:	72 24                	jb     ecf <largealloc+0x3c>
+    if(b->h.size - n > SMALLMAX){
+     eab:	29 da                	sub    %ebx,%edx
+     ead:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+     eb3:	76 1f                	jbe    ed4 <largealloc+0x41>
+      rest = (Fblock*)((char*)b + n);
+     eb5:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+      rest->h.size = b->h.size - n;
+     eb8:	89 16                	mov    %edx,(%esi)
+      rest->h.class = LARGE;
+     eba:	c7 46 04 09 00 00 00 	movl   $0x9,0x4(%esi)
+      rest->next = b->next;
+     ec1:	8b 50 08             	mov    0x8(%eax),%edx
+     ec4:	89 56 08             	mov    %edx,0x8(%esi)
+      *pp = rest;
+     ec7:	89 31                	mov    %esi,(%ecx)
+      b->h.size = n;
+     ec9:	89 18                	mov    %ebx,(%eax)
+}
+     ecb:	5b                   	pop    %ebx
+     ecc:	5e                   	pop    %esi
+     ecd:	5d                   	pop    %ebp
+     ece:	c3                   	ret
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     ecf:	8d 48 08             	lea    0x8(%eax),%ecx
+     ed2:	eb cb                	jmp    e9f <largealloc+0xc>
+      *pp = b->next;
+     ed4:	8b 50 08             	mov    0x8(%eax),%edx
+     ed7:	89 11                	mov    %edx,(%ecx)
+    return &b->h;
+     ed9:	eb f0                	jmp    ecb <largealloc+0x38>
+  if((b = more(n)) == 0)
+     edb:	89 d8                	mov    %ebx,%eax
+     edd:	e8 18 ff ff ff       	call   dfa <more>
+     ee2:	85 c0                	test   %eax,%eax
+     ee4:	74 e5                	je     ecb <largealloc+0x38>
+  b->h.size = n;
+     ee6:	89 18                	mov    %ebx,(%eax)
+  b->h.class = LARGE;
+     ee8:	c7 40 04 09 00 00 00 	movl   $0x9,0x4(%eax)
+  return &b->h;
+     eef:	eb da                	jmp    ecb <largealloc+0x38>
+
+00000ef1 <free>:
+
+void
+free(void *ap)
+{
+     ef1:	55                   	push   %ebp
+     ef2:	89 e5                	mov    %esp,%ebp
+     ef4:	56                   	push   %esi
+     ef5:	53                   	push   %ebx
+     ef6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+
+  if(ap == 0)
+     ef9:	85 db                	test   %ebx,%ebx
+     efb:	74 3b                	je     f38 <free+0x47>
+    return;
+  h = (Header*)ap - 1;
+     efd:	8d 73 f8             	lea    -0x8(%ebx),%esi
+  lock_acquire(&lock);
+     f00:	83 ec 0c             	sub    $0xc,%esp
+     f03:	68 a0 39 00 00       	push   $0x39a0
+     f08:	e8 9c 01 00 00       	call   10a9 <lock_acquire>
+  if(h->class == LARGE)
+     f0d:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     f10:	83 c4 10             	add    $0x10,%esp
+     f13:	83 f8 09             	cmp    $0x9,%eax
+     f16:	74 27                	je     f3f <free+0x4e>
+    largefree((Fblock*)h);
+  else {
+    ((Fblock*)h)->next = freelist[h->class];
+     f18:	8b 14 85 c0 39 00 00 	mov    0x39c0(,%eax,4),%edx
+     f1f:	89 13                	mov    %edx,(%ebx)
+    freelist[h->class] = (Fblock*)h;
+     f21:	89 34 85 c0 39 00 00 	mov    %esi,0x39c0(,%eax,4)
+  }
+  lock_release(&lock);
+     f28:	83 ec 0c             	sub    $0xc,%esp
+     f2b:	68 a0 39 00 00       	push   $0x39a0
+     f30:	e8 88 01 00 00       	call   10bd <lock_release>
+     f35:	83 c4 10             	add    $0x10,%esp
+}
+     f38:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f3b:	5b                   	pop    %ebx
+     f3c:	5e                   	pop    %esi
+     f3d:	5d                   	pop    %ebp
+     f3e:	c3                   	ret
+    largefree((Fblock*)h);
+     f3f:	89 f0                	mov    %esi,%eax
+     f41:	e8 0b fe ff ff       	call   d51 <largefree>
+     f46:	eb e0                	jmp    f28 <free+0x37>
+
+00000f48 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     f48:	55                   	push   %ebp
+     f49:	89 e5                	mov    %esp,%ebp
+     f4b:	53                   	push   %ebx
+     f4c:	83 ec 04             	sub    $0x4,%esp
+     f4f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+  uint n;
+  int c;
+
+  if(nbytes > 0x7fffffff - sizeof(Header) - 7)
+     f52:	81 fb f0 ff ff 7f    	cmp    $0x7ffffff0,%ebx
+     f58:	0f 87 8b 00 00 00    	ja     fe9 <malloc+0xa1>
+    return 0;
+  n = (nbytes + sizeof(Header) + 7) & ~7;
+     f5e:	83 c3 0f             	add    $0xf,%ebx
+     f61:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(n < sizeof(Fblock))
+     f64:	83 fb 0b             	cmp    $0xb,%ebx
+     f67:	77 05                	ja     f6e <malloc+0x26>
+    n = sizeof(Fblock);
+     f69:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  lock_acquire(&lock);
+     f6e:	83 ec 0c             	sub    $0xc,%esp
+     f71:	68 a0 39 00 00       	push   $0x39a0
+     f76:	e8 2e 01 00 00       	call   10a9 <lock_acquire>
+  if(n <= SMALLMAX){
+     f7b:	83 c4 10             	add    $0x10,%esp
+     f7e:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+     f84:	77 58                	ja     fde <malloc+0x96>
+    for(c = 0; (1 << (MINSHIFT + c)) < n; c++)
+     f86:	ba 00 00 00 00       	mov    $0x0,%edx
+     f8b:	eb 03                	jmp    f90 <malloc+0x48>
+     f8d:	83 c2 01             	add    $0x1,%edx
+     f90:	8d 4a 04             	lea    0x4(%edx),%ecx
+     f93:	b8 01 00 00 00       	mov    $0x1,%eax
+     f98:	d3 e0                	shl    %cl,%eax
+     f9a:	39 d8                	cmp    %ebx,%eax
+     f9c:	72 ef                	jb     f8d <malloc+0x45>
+      ;
+    if(freelist[c]){
+     f9e:	8b 04 95 c0 39 00 00 	mov    0x39c0(,%edx,4),%eax
+     fa5:	85 c0                	test   %eax,%eax
+     fa7:	74 2a                	je     fd3 <malloc+0x8b>
+      h = &freelist[c]->h;
+     fa9:	89 c3                	mov    %eax,%ebx
+      freelist[c] = freelist[c]->next;
+     fab:	8b 40 08             	mov    0x8(%eax),%eax
+     fae:	89 04 95 c0 39 00 00 	mov    %eax,0x39c0(,%edx,4)
+    } else
+      h = slaballoc(c);
+  } else
+    h = largealloc(n);
+  lock_release(&lock);
+     fb5:	83 ec 0c             	sub    $0xc,%esp
+     fb8:	68 a0 39 00 00       	push   $0x39a0
+     fbd:	e8 fb 00 00 00       	call   10bd <lock_release>
+  return h ? (void*)(h + 1) : 0;
+     fc2:	83 c4 10             	add    $0x10,%esp
+     fc5:	85 db                	test   %ebx,%ebx
+     fc7:	74 03                	je     fcc <malloc+0x84>
+     fc9:	83 c3 08             	add    $0x8,%ebx
+}
+     fcc:	89 d8                	mov    %ebx,%eax
+     fce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     fd1:	c9                   	leave
+     fd2:	c3                   	ret
+      h = slaballoc(c);
+     fd3:	89 d0                	mov    %edx,%eax
+     fd5:	e8 5a fe ff ff       	call   e34 <slaballoc>
+     fda:	89 c3                	mov    %eax,%ebx
+     fdc:	eb d7                	jmp    fb5 <malloc+0x6d>
+    h = largealloc(n);
+     fde:	89 d8                	mov    %ebx,%eax
+     fe0:	e8 ae fe ff ff       	call   e93 <largealloc>
+     fe5:	89 c3                	mov    %eax,%ebx
+     fe7:	eb cc                	jmp    fb5 <malloc+0x6d>
+    return 0;
+     fe9:	bb 00 00 00 00       	mov    $0x0,%ebx
+     fee:	eb dc                	jmp    fcc <malloc+0x84>
+
+00000ff0 <tstart>:
+  void *arg;
+};
+
+static void
+tstart(void *a)
+{
+     ff0:	55                   	push   %ebp
+     ff1:	89 e5                	mov    %esp,%ebp
+     ff3:	83 ec 14             	sub    $0x14,%esp
+     ff6:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+     ff9:	ff 70 04             	push   0x4(%eax)
+     ffc:	ff 10                	call   *(%eax)
+  exit();
+     ffe:	e8 86 f6 ff ff       	call   689 <exit>
+
+00001003 <thread_create>:
+}
+
+// Run fn(arg) in a new thread.  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1003:	55                   	push   %ebp
+    1004:	89 e5                	mov    %esp,%ebp
+    1006:	56                   	push   %esi
+    1007:	53                   	push   %ebx
+  struct tstart *t;
+  char *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    1008:	83 ec 0c             	sub    $0xc,%esp
+    100b:	68 00 10 00 00       	push   $0x1000
+    1010:	e8 33 ff ff ff       	call   f48 <malloc>
+    1015:	83 c4 10             	add    $0x10,%esp
+    1018:	85 c0                	test   %eax,%eax
+    101a:	74 42                	je     105e <thread_create+0x5b>
+    101c:	89 c3                	mov    %eax,%ebx
+    return -1;
+  t = (struct tstart*)stack;
+  t->fn = fn;
+    101e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1021:	89 03                	mov    %eax,(%ebx)
+  t->arg = arg;
+    1023:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1026:	89 43 04             	mov    %eax,0x4(%ebx)
+  if((pid = clone(tstart, stack + TSTACK, t)) < 0)
+    1029:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    102f:	83 ec 04             	sub    $0x4,%esp
+    1032:	53                   	push   %ebx
+    1033:	50                   	push   %eax
+    1034:	68 f0 0f 00 00       	push   $0xff0
+    1039:	e8 f5 f8 ff ff       	call   933 <clone>
+    103e:	89 c6                	mov    %eax,%esi
+    1040:	83 c4 10             	add    $0x10,%esp
+    1043:	85 c0                	test   %eax,%eax
+    1045:	78 09                	js     1050 <thread_create+0x4d>
+    free(stack);
+  return pid;
+}
+    1047:	89 f0                	mov    %esi,%eax
+    1049:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    104c:	5b                   	pop    %ebx
+    104d:	5e                   	pop    %esi
+    104e:	5d                   	pop    %ebp
+    104f:	c3                   	ret
+    free(stack);
+    1050:	83 ec 0c             	sub    $0xc,%esp
+    1053:	53                   	push   %ebx
+    1054:	e8 98 fe ff ff       	call   ef1 <free>
+    1059:	83 c4 10             	add    $0x10,%esp
+    105c:	eb e9                	jmp    1047 <thread_create+0x44>
+    return -1;
+    105e:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1063:	eb e2                	jmp    1047 <thread_create+0x44>
+
+00001065 <thread_join>:
+
+// Wait for one of this process's threads to exit and free its
+// stack.  Returns its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+    1065:	55                   	push   %ebp
+    1066:	89 e5                	mov    %esp,%ebp
+    1068:	53                   	push   %ebx
+    1069:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    106c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    106f:	50                   	push   %eax
+    1070:	e8 cd f8 ff ff       	call   942 <join>
+    1075:	89 c3                	mov    %eax,%ebx
+    1077:	83 c4 10             	add    $0x10,%esp
+    107a:	85 c0                	test   %eax,%eax
+    107c:	79 07                	jns    1085 <thread_join+0x20>
+    free((char*)stack - TSTACK);
+  return pid;
+}
+    107e:	89 d8                	mov    %ebx,%eax
+    1080:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1083:	c9                   	leave
+    1084:	c3                   	ret
+    free((char*)stack - TSTACK);
+    1085:	83 ec 0c             	sub    $0xc,%esp
+    1088:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    108b:	2d 00 10 00 00       	sub    $0x1000,%eax
+    1090:	50                   	push   %eax
+    1091:	e8 5b fe ff ff       	call   ef1 <free>
+    1096:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    1099:	eb e3                	jmp    107e <thread_join+0x19>
+
+0000109b <lock_init>:
+
+void
+lock_init(lock_t *lk)
+{
+    109b:	55                   	push   %ebp
+    109c:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    109e:	8b 45 08             	mov    0x8(%ebp),%eax
+    10a1:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    10a7:	5d                   	pop    %ebp
+    10a8:	c3                   	ret
+
+000010a9 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+    10a9:	55                   	push   %ebp
+    10aa:	89 e5                	mov    %esp,%ebp
+    10ac:	8b 55 08             	mov    0x8(%ebp),%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    10af:	b8 01 00 00 00       	mov    $0x1,%eax
+    10b4:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    10b7:	85 c0                	test   %eax,%eax
+    10b9:	75 f4                	jne    10af <lock_acquire+0x6>
+    ;
+}
+    10bb:	5d                   	pop    %ebp
+    10bc:	c3                   	ret
+
+000010bd <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+    10bd:	55                   	push   %ebp
+    10be:	89 e5                	mov    %esp,%ebp
+    10c0:	8b 55 08             	mov    0x8(%ebp),%edx
+    10c3:	b8 00 00 00 00       	mov    $0x0,%eax
+    10c8:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    10cb:	5d                   	pop    %ebp
+    10cc:	c3                   	ret
+
+000010cd <mutex_init>:
+// Are Tricky": state is 0 when free, 1 when held, 2 when held and
+// others may be waiting.  Unlocking an uncontended mutex costs no
+// system call.
+void
+mutex_init(mutex_t *m)
+{
+    10cd:	55                   	push   %ebp
+    10ce:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    10d0:	8b 45 08             	mov    0x8(%ebp),%eax
+    10d3:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    10d9:	5d                   	pop    %ebp
+    10da:	c3                   	ret
+
+000010db <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+    10db:	55                   	push   %ebp
+    10dc:	89 e5                	mov    %esp,%ebp
+    10de:	53                   	push   %ebx
+    10df:	83 ec 04             	sub    $0x4,%esp
+    10e2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    10e5:	b8 00 00 00 00       	mov    $0x0,%eax
+    10ea:	b9 01 00 00 00       	mov    $0x1,%ecx
+    10ef:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    10f3:	85 c0                	test   %eax,%eax
+    10f5:	74 29                	je     1120 <mutex_lock+0x45>
+    return;
+  if(c != 2)
+    10f7:	83 f8 02             	cmp    $0x2,%eax
+    10fa:	74 20                	je     111c <mutex_lock+0x41>
+    10fc:	b8 02 00 00 00       	mov    $0x2,%eax
+    1101:	f0 87 03             	lock xchg %eax,(%ebx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    1104:	eb 16                	jmp    111c <mutex_lock+0x41>
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    1106:	83 ec 08             	sub    $0x8,%esp
+    1109:	6a 02                	push   $0x2
+    110b:	53                   	push   %ebx
+    110c:	e8 40 f8 ff ff       	call   951 <futex_wait>
+  asm volatile("lock; xchgl %0, %1" :
+    1111:	b8 02 00 00 00       	mov    $0x2,%eax
+    1116:	f0 87 03             	lock xchg %eax,(%ebx)
+    1119:	83 c4 10             	add    $0x10,%esp
+  while(c != 0){
+    111c:	85 c0                	test   %eax,%eax
+    111e:	75 e6                	jne    1106 <mutex_lock+0x2b>
+    c = xchg(&m->state, 2);
+  }
+}
+    1120:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1123:	c9                   	leave
+    1124:	c3                   	ret
+
+00001125 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+    1125:	55                   	push   %ebp
+    1126:	89 e5                	mov    %esp,%ebp
+    1128:	83 ec 08             	sub    $0x8,%esp
+    112b:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    112e:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    1133:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    1137:	83 fa 01             	cmp    $0x1,%edx
+    113a:	75 02                	jne    113e <mutex_unlock+0x19>
+    m->state = 0;
+    futex_wake(&m->state, 1);
+  }
+}
+    113c:	c9                   	leave
+    113d:	c3                   	ret
+    m->state = 0;
+    113e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+    1144:	83 ec 08             	sub    $0x8,%esp
+    1147:	6a 01                	push   $0x1
+    1149:	50                   	push   %eax
+    114a:	e8 11 f8 ff ff       	call   960 <futex_wake>
+    114f:	83 c4 10             	add    $0x10,%esp
+}
+    1152:	eb e8                	jmp    113c <mutex_unlock+0x17>
+
+00001154 <cond_init>:
+// Condition variable: waiters sleep on a sequence number that
+// every signal bumps, so a signal between the unlock and the
+// futex_wait() in cond_wait() is not lost.
+void
+cond_init(cond_t *c)
+{
+    1154:	55                   	push   %ebp
+    1155:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    1157:	8b 45 08             	mov    0x8(%ebp),%eax
+    115a:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1160:	5d                   	pop    %ebp
+    1161:	c3                   	ret
+
+00001162 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+    1162:	55                   	push   %ebp
+    1163:	89 e5                	mov    %esp,%ebp
+    1165:	57                   	push   %edi
+    1166:	56                   	push   %esi
+    1167:	53                   	push   %ebx
+    1168:	83 ec 18             	sub    $0x18,%esp
+    116b:	8b 75 08             	mov    0x8(%ebp),%esi
+    116e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    1171:	8b 3e                	mov    (%esi),%edi
+  mutex_unlock(m);
+    1173:	53                   	push   %ebx
+    1174:	e8 ac ff ff ff       	call   1125 <mutex_unlock>
+  futex_wait(&c->seq, seq);
+    1179:	83 c4 08             	add    $0x8,%esp
+    117c:	57                   	push   %edi
+    117d:	56                   	push   %esi
+    117e:	e8 ce f7 ff ff       	call   951 <futex_wait>
+  // Others may be waiting for m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+    1183:	83 c4 10             	add    $0x10,%esp
+    1186:	eb 0e                	jmp    1196 <cond_wait+0x34>
+    futex_wait(&m->state, 2);
+    1188:	83 ec 08             	sub    $0x8,%esp
+    118b:	6a 02                	push   $0x2
+    118d:	53                   	push   %ebx
+    118e:	e8 be f7 ff ff       	call   951 <futex_wait>
+    1193:	83 c4 10             	add    $0x10,%esp
+    1196:	b8 02 00 00 00       	mov    $0x2,%eax
+    119b:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    119e:	85 c0                	test   %eax,%eax
+    11a0:	75 e6                	jne    1188 <cond_wait+0x26>
+}
+    11a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11a5:	5b                   	pop    %ebx
+    11a6:	5e                   	pop    %esi
+    11a7:	5f                   	pop    %edi
+    11a8:	5d                   	pop    %ebp
+    11a9:	c3                   	ret
+
+000011aa <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+    11aa:	55                   	push   %ebp
+    11ab:	89 e5                	mov    %esp,%ebp
+    11ad:	83 ec 10             	sub    $0x10,%esp
+    11b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    11b3:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+    11b7:	6a 01                	push   $0x1
+    11b9:	50                   	push   %eax
+    11ba:	e8 a1 f7 ff ff       	call   960 <futex_wake>
+}
+    11bf:	83 c4 10             	add    $0x10,%esp
+    11c2:	c9                   	leave
+    11c3:	c3                   	ret
+
+000011c4 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+    11c4:	55                   	push   %ebp
+    11c5:	89 e5                	mov    %esp,%ebp
+    11c7:	83 ec 10             	sub    $0x10,%esp
+    11ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    11cd:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, NPROC);
+    11d1:	6a 40                	push   $0x40
+    11d3:	50                   	push   %eax
+    11d4:	e8 87 f7 ff ff       	call   960 <futex_wake>
+}
+    11d9:	83 c4 10             	add    $0x10,%esp
+    11dc:	c9                   	leave
+    11dd:	c3                   	ret
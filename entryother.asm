@@ -0,0 +1,134 @@
+
+bootblockother.o:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00007000 <start>:
+# This code combines elements of bootasm.S and entry.S.
+
+.code16           
+.globl start
+start:
+  cli            
+    7000:	fa                   	cli
+
+  # Zero data segment registers DS, ES, and SS.
+  xorw    %ax,%ax
+    7001:	31 c0                	xor    %eax,%eax
+  movw    %ax,%ds
+    7003:	8e d8                	mov    %eax,%ds
+  movw    %ax,%es
+    7005:	8e c0                	mov    %eax,%es
+  movw    %ax,%ss
+    7007:	8e d0                	mov    %eax,%ss
+
+  # Switch from real to protected mode.  Use a bootstrap GDT that makes
+  # virtual addresses map directly to physical addresses so that the
+  # effective memory map doesn't change during the transition.
+  lgdt    gdtdesc
+    7009:	0f 01 16             	lgdtl  (%esi)
+    700c:	98                   	cwtl
+    700d:	70 0f                	jo     701e <start+0x1e>
+  movl    %cr0, %eax
+    700f:	20 c0                	and    %al,%al
+  orl     $CR0_PE, %eax
+    7011:	66 83 c8 01          	or     $0x1,%ax
+  movl    %eax, %cr0
+    7015:	0f 22 c0             	mov    %eax,%cr0
+
+  # Complete the transition to 32-bit protected mode by using a long jmp
+  # to reload %cs and %eip.  The segment descriptors are set up with no
+  # translation, so that the mapping is still the identity mapping.
+  ljmpl    $(SEG_KCODE<<3), $(start32)
+    7018:	66 ea 20 70 00 00    	ljmpw  $0x0,$0x7020
+    701e:	08 00                	or     %al,(%eax)
+
+00007020 <start32>:
+
+//PAGEBREAK!
+.code32  # Tell assembler to generate 32-bit code now.
+start32:
+  # Set up the protected-mode data segment registers
+  movw    $(SEG_KDATA<<3), %ax    # Our data segment selector
+    7020:	66 b8 10 00          	mov    $0x10,%ax
+  movw    %ax, %ds                # -> DS: Data Segment
+    7024:	8e d8                	mov    %eax,%ds
+  movw    %ax, %es                # -> ES: Extra Segment
+    7026:	8e c0                	mov    %eax,%es
+  movw    %ax, %ss                # -> SS: Stack Segment
+    7028:	8e d0                	mov    %eax,%ss
+  movw    $0, %ax                 # Zero segments not ready for use
+    702a:	66 b8 00 00          	mov    $0x0,%ax
+  movw    %ax, %fs                # -> FS
+    702e:	8e e0                	mov    %eax,%fs
+  movw    %ax, %gs                # -> GS
+    7030:	8e e8                	mov    %eax,%gs
+
+  # Turn on page size extension for 4Mbyte pages, and global
+  # pages so the kernel's TLB entries survive CR3 loads
+  movl    %cr4, %eax
+    7032:	0f 20 e0             	mov    %cr4,%eax
+  orl     $(CR4_PSE|CR4_PGE), %eax
+    7035:	0d 90 00 00 00       	or     $0x90,%eax
+  movl    %eax, %cr4
+    703a:	0f 22 e0             	mov    %eax,%cr4
+  # Use entrypgdir as our initial page table
+  movl    (start-12), %eax
+    703d:	a1 f4 6f 00 00       	mov    0x6ff4,%eax
+  movl    %eax, %cr3
+    7042:	0f 22 d8             	mov    %eax,%cr3
+  # Turn on paging.
+  movl    %cr0, %eax
+    7045:	0f 20 c0             	mov    %cr0,%eax
+  orl     $(CR0_PE|CR0_PG|CR0_WP), %eax
+    7048:	0d 01 00 01 80       	or     $0x80010001,%eax
+  movl    %eax, %cr0
+    704d:	0f 22 c0             	mov    %eax,%cr0
+
+  # Switch to the stack allocated by startothers()
+  movl    $1, %eax
+    7050:	b8 01 00 00 00       	mov    $0x1,%eax
+  lock xaddl %eax, (start-4)
+    7055:	f0 0f c1 05 fc 6f 00 	lock xadd %eax,0x6ffc
+    705c:	00 
+  movl    (start-16), %esp
+    705d:	8b 25 f0 6f 00 00    	mov    0x6ff0,%esp
+  movl    (%esp,%eax,4), %esp
+    7063:	8b 24 84             	mov    (%esp,%eax,4),%esp
+  # Call mpenter()
+  call	 *(start-8)
+    7066:	ff 15 f8 6f 00 00    	call   *0x6ff8
+
+  movw    $0x8a00, %ax
+    706c:	66 b8 00 8a          	mov    $0x8a00,%ax
+  movw    %ax, %dx
+    7070:	66 89 c2             	mov    %ax,%dx
+  outw    %ax, %dx
+    7073:	66 ef                	out    %ax,(%dx)
+  movw    $0x8ae0, %ax
+    7075:	66 b8 e0 8a          	mov    $0x8ae0,%ax
+  outw    %ax, %dx
+    7079:	66 ef                	out    %ax,(%dx)
+
+0000707b <spin>:
+spin:
+  jmp     spin
+    707b:	eb fe                	jmp    707b <spin>
+    707d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00007080 <gdt>:
+	...
+    7088:	ff                   	(bad)
+    7089:	ff 00                	incl   (%eax)
+    708b:	00 00                	add    %al,(%eax)
+    708d:	9a cf 00 ff ff 00 00 	lcall  $0x0,$0xffff00cf
+    7094:	00                   	.byte 0x0
+    7095:	92                   	xchg   %eax,%edx
+    7096:	cf                   	iret
+	...
+
+00007098 <gdtdesc>:
+    7098:	17                   	pop    %ss
+    7099:	00                   	.byte 0x0
+    709a:	80 70 00 00          	xorb   $0x0,0x0(%eax)
@@ -2,22 +2,27 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "defs.h"
 #include "x86.h"
 #include "elf.h"
+#include "fcntl.h"
 
+// Replace the user image of p, the calling process or a new one
+// that spawn() is setting up, with the program at path.  argv
+// must be readable in the current address space.
 int
-exec(char *path, char **argv)
+execproc(struct proc *p, char *path, char **argv)
 {
   char *s, *last;
-  int i, off;
-  uint argc, sz, sp, ustack[3+MAXARG+1];
+  int i, off, nvma, rss;
+  uint argc, sz, oldsz, sp, ustack[3+MAXARG+1];
   struct elfhdr elf;
   struct inode *ip;
   struct proghdr ph;
+  struct vma vma[NVMA], oldvma[NVMA];
   pde_t *pgdir, *oldpgdir;
-  struct proc *curproc = myproc();
 
   begin_op();
 
@@ -26,8 +31,10 @@ exec(char *path, char **argv)
     cprintf("exec: fail\n");
     return -1;
   }
-  ilock(ip);
+  ilockshared(ip);
   pgdir = 0;
+  nvma = 0;
+  memset(vma, 0, sizeof(vma));
 
   // Check ELF header
   if(readi(ip, (char*)&elf, 0, sizeof(elf)) != sizeof(elf))
@@ -40,6 +47,7 @@ exec(char *path, char **argv)
 
   // Load program into memory.
   sz = 0;
+  rss = 0;
   for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
     if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
       goto bad;
@@ -49,10 +57,29 @@ exec(char *path, char **argv)
       goto bad;
     if(ph.vaddr + ph.memsz < ph.vaddr)
       goto bad;
-    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
-      goto bad;
     if(ph.vaddr % PGSIZE != 0)
       goto bad;
+    if(ph.vaddr + ph.memsz > CLOCKPAGE)
+      goto bad;
+    // Demand paging: only remember where the segment comes from;
+    // vmfault() reads each page in on first touch.
+    if(DEMANDEXEC && nvma < NVMA){
+      vma[nvma].start = ph.vaddr;
+      vma[nvma].end = PGROUNDUP(ph.vaddr + ph.memsz);
+      vma[nvma].ip = idup(ip);
+      vma[nvma].off = ph.off;
+      vma[nvma].filesz = ph.filesz;
+      vma[nvma].prot = PROT_READ|PROT_WRITE;
+      vma[nvma].flags = MAP_PRIVATE;
+      nvma++;
+      if(ph.vaddr + ph.memsz > sz)
+        sz = ph.vaddr + ph.memsz;
+      continue;
+    }
+    oldsz = sz;
+    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
+      goto bad;
+    rss += (PGROUNDUP(sz) - PGROUNDUP(oldsz)) / PGSIZE;
     if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
       goto bad;
   }
@@ -65,6 +92,7 @@ exec(char *path, char **argv)
   sz = PGROUNDUP(sz);
   if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE)) == 0)
     goto bad;
+  rss += 2;
 
   clearpteu(pgdir, (char*)(sz - 2*PGSIZE)); 
   // La funcion clearpteu borra el PTE_U en una página generando asi 
@@ -72,7 +100,7 @@ exec(char *path, char **argv)
 
   // Recuperamos la pagina inaccesible que genera clearpteu
   // Si nos fijamos bien, la direccion que ha usado clearpteu es (sz - 2*PGSIZE)
-  myproc()->paginaInvalida = sz - 2*PGSIZE;
+  p->paginaInvalida = sz - 2*PGSIZE;
 
   sp = sz;
 
@@ -99,24 +127,47 @@ exec(char *path, char **argv)
   for(last=s=path; *s; s++)
     if(*s == '/')
       last = s+1;
-  safestrcpy(curproc->name, last, sizeof(curproc->name));
+  safestrcpy(p->name, last, sizeof(p->name));
 
   // Commit to the user image.
-  oldpgdir = curproc->pgdir;
-  curproc->pgdir = pgdir;
-  curproc->sz = sz;
-  curproc->tf->eip = elf.entry;  // main
-  curproc->tf->esp = sp;
-  switchuvm(curproc);
-  freevm(oldpgdir);
+  oldpgdir = p->pgdir;
+  memmove(oldvma, p->vma, sizeof(oldvma));
+  memmove(p->vma, vma, sizeof(vma));
+  p->pgdir = pgdir;
+  p->sz = sz;
+  p->mmapbot = CLOCKPAGE;
+  p->tf->eip = elf.entry;  // main
+  p->tf->esp = sp;
+  p->ustack = 0;
+  if(p == myproc())
+    switchuvm(p);
+  // A thread leaves its old address space to the others.
+  if(oldpgdir && asput(p)){
+    vmaput(oldpgdir, oldvma);
+    freevm(oldpgdir);
+  } else if(oldpgdir)
+    vmaput(0, oldvma);
+  p->rss = rss;
   return 0;
 
  bad:
   if(pgdir)
     freevm(pgdir);
-  if(ip){
-    iunlockput(ip);
+  if(ip)
+    iunlock(ip);
+  else if(nvma > 0)
+    begin_op();
+  for(i = 0; i < nvma; i++)
+    iput(vma[i].ip);
+  if(ip)
+    iput(ip);
+  if(ip || nvma > 0)
     end_op();
-  }
   return -1;
 }
+
+int
+exec(char *path, char **argv)
+{
+  return execproc(myproc(), path, argv);
+}
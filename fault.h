@@ -0,0 +1,9 @@
+// Page-fault classes counted by vmfault() and reported by
+// faultstat().  NFAULT in param.h must match.
+#define FAULT_HEAP   0  // write to an unmapped heap page
+#define FAULT_ZERO   1  // read of an unmapped heap page (zero page)
+#define FAULT_COW    2  // write to a copy-on-write page
+#define FAULT_FILE   3  // page filled in from a file
+#define FAULT_GUARD  4  // touched the guard page below the stack
+#define FAULT_BAD    5  // anything else, or no memory to handle it
+#define FAULT_SWAP   6  // page read back from swap
@@ -2,3 +2,16 @@
 #define O_WRONLY  0x001
 #define O_RDWR    0x002
 #define O_CREATE  0x200
+
+// fstatat(): relative to the current directory
+#define AT_FDCWD  -100
+
+// fcntl() commands
+#define F_GETPIPE_SZ 1
+#define F_SETPIPE_SZ 2
+
+// mmap() protection and flags
+#define PROT_READ   0x1
+#define PROT_WRITE  0x2
+#define MAP_SHARED  0x1
+#define MAP_PRIVATE 0x2
@@ -5,21 +5,30 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
+#include "stat.h"
 #include "fs.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
+#include "slab.h"
+#include "uio.h"
+
+#define min(a, b) ((a) < (b) ? (a) : (b))
 
 struct devsw devsw[NDEV];
+// Open files come from a slab cache, whose per-CPU magazines
+// serve most allocations without a lock, so there is no fixed
+// limit on them.  The reference counts are changed with atomic
+// instructions: dup(), fork() and close() take no lock at all.
 struct {
-  struct spinlock lock;
-  struct file file[NFILE];
+  struct slabcache cache;
 } ftable;
 
 void
 fileinit(void)
 {
-  initlock(&ftable.lock, "ftable");
+  slabinit(&ftable.cache, "file", sizeof(struct file));
 }
 
 // Allocate a file structure.
@@ -28,27 +37,19 @@ filealloc(void)
 {
   struct file *f;
 
-  acquire(&ftable.lock);
-  for(f = ftable.file; f < ftable.file + NFILE; f++){
-    if(f->ref == 0){
-      f->ref = 1;
-      release(&ftable.lock);
-      return f;
-    }
-  }
-  release(&ftable.lock);
-  return 0;
+  if((f = slaballoc(&ftable.cache)) == 0)
+    return 0;
+  memset(f, 0, sizeof(*f));
+  f->ref = 1;
+  return f;
 }
 
 // Increment ref count for file f.
 struct file*
 filedup(struct file *f)
 {
-  acquire(&ftable.lock);
-  if(f->ref < 1)
+  if(__sync_fetch_and_add(&f->ref, 1) < 1)
     panic("filedup");
-  f->ref++;
-  release(&ftable.lock);
   return f;
 }
 
@@ -57,18 +58,16 @@ void
 fileclose(struct file *f)
 {
   struct file ff;
+  int ref;
 
-  acquire(&ftable.lock);
-  if(f->ref < 1)
-    panic("fileclose");
-  if(--f->ref > 0){
-    release(&ftable.lock);
+  if((ref = __sync_sub_and_fetch(&f->ref, 1)) > 0)
     return;
-  }
+  if(ref < 0)
+    panic("fileclose");
+  // The last reference: no one else can see f now.
   ff = *f;
-  f->ref = 0;
   f->type = FD_NONE;
-  release(&ftable.lock);
+  slabfree(&ftable.cache, f);
 
   if(ff.type == FD_PIPE)
     pipeclose(ff.pipe, ff.writable);
@@ -84,7 +83,7 @@ int
 filestat(struct file *f, struct stat *st)
 {
   if(f->type == FD_INODE){
-    ilock(f->ip);
+    ilockshared(f->ip);
     stati(f->ip, st);
     iunlock(f->ip);
     return 0;
@@ -92,66 +91,205 @@ filestat(struct file *f, struct stat *st)
   return -1;
 }
 
-// Read from file f.
+// Read from file f into the niov buffers of iov, in order, at
+// offset off, or at f->off (and advancing it) if off is -1.  The
+// whole vector is read under one lock of the inode.
 int
-fileread(struct file *f, char *addr, int n)
+filereadv(struct file *f, struct iovec *iov, int niov, int off)
 {
-  int r;
+  int i, r, tot;
+  uint o;
 
   if(f->readable == 0)
     return -1;
-  if(f->type == FD_PIPE)
-    return piperead(f->pipe, addr, n);
+  if(f->type == FD_PIPE){
+    if(off >= 0)
+      return -1;
+    for(tot = i = 0; i < niov; i++){
+      if((r = piperead(f->pipe, iov[i].base, iov[i].len)) < 0)
+        return tot > 0 ? tot : -1;
+      tot += r;
+      if(r < iov[i].len)
+        break;
+    }
+    return tot;
+  }
   if(f->type == FD_INODE){
-    ilock(f->ip);
-    if((r = readi(f->ip, addr, f->off, n)) > 0)
-      f->off += r;
+    // Readers share the inode lock, unless f, and so f->off, is
+    // shared with other descriptors.
+    if(off < 0 && f->ref > 1)
+      ilock(f->ip);
+    else
+      ilockshared(f->ip);
+    o = off < 0 ? f->off : off;
+    for(tot = i = 0; i < niov; i++){
+      if((r = readi(f->ip, iov[i].base, o, iov[i].len)) < 0){
+        if(tot == 0)
+          tot = -1;
+        break;
+      }
+      o += r;
+      tot += r;
+      if(r < iov[i].len)
+        break;
+    }
+    if(off < 0)
+      f->off = o;
     iunlock(f->ip);
-    return r;
+    return tot;
   }
   panic("fileread");
 }
 
-//PAGEBREAK!
-// Write to file f.
+// Read from file f.
 int
-filewrite(struct file *f, char *addr, int n)
+fileread(struct file *f, char *addr, int n)
+{
+  struct iovec iov;
+
+  iov.base = addr;
+  iov.len = n;
+  return filereadv(f, &iov, 1, -1);
+}
+
+// Copy the entries of directory f to addr, as many as fit in n
+// bytes, from where the last call left off.  Returns the number
+// of bytes copied, 0 at the end.
+int
+filegetdents(struct file *f, char *addr, int n)
 {
   int r;
 
+  if(f->type != FD_INODE || f->readable == 0)
+    return -1;
+  if(f->ref > 1)
+    ilock(f->ip);
+  else
+    ilockshared(f->ip);
+  r = -1;
+  if(f->ip->type == T_DIR)
+    r = dirread(f->ip, &f->off, addr, n);
+  iunlock(f->ip);
+  return r;
+}
+
+// Move up to n bytes from file in to file out, through a page of
+// the kernel's instead of a user buffer: fileread() fills it, from
+// the buffer cache or a pipe, and filewrite() empties it, into a
+// pipe or the cache.  Returns the number of bytes moved, which is
+// less than n at the end of in.
+int
+filesend(struct file *out, struct file *in, int n)
+{
+  char *page;
+  int r, w, tot;
+
+  if(in->readable == 0 || out->writable == 0)
+    return -1;
+  if((page = kalloc()) == 0)
+    return -1;
+  r = 0;
+  for(tot = 0; tot < n; tot += r){
+    if((r = fileread(in, page, min(n - tot, PGSIZE))) <= 0)
+      break;
+    if((w = filewrite(out, page, r)) != r){
+      r = -1;
+      break;
+    }
+  }
+  kfree(page);
+  return tot > 0 || r >= 0 ? tot : -1;
+}
+
+// Write the niov buffers of iov to file f, in order, at offset
+// off, or at f->off (and advancing it) if off is -1.  As many
+// bytes go in one transaction, under one lock of the inode, as
+// one system call may log: the whole vector, if it fits.
+int
+filewritev(struct file *f, struct iovec *iov, int niov, int off)
+{
+  int i, r, tot, n, n1, w, nb, max, full;
+  uint o, k, k1;
+
   if(f->writable == 0)
     return -1;
-  if(f->type == FD_PIPE)
-    return pipewrite(f->pipe, addr, n);
+  if(f->type == FD_PIPE){
+    if(off >= 0)
+      return -1;
+    for(tot = i = 0; i < niov; i++){
+      if((r = pipewrite(f->pipe, iov[i].base, iov[i].len)) < 0)
+        return -1;
+      tot += r;
+    }
+    return tot;
+  }
   if(f->type == FD_INODE){
-    // write a few blocks at a time to avoid exceeding
-    // the maximum log transaction size, including
-    // i-node, indirect block, allocation blocks,
-    // and 2 blocks of slop for non-aligned writes.
+    // write as many blocks at a time as one system call
+    // may log, reserving room for them (2 more for slop
+    // for non-aligned writes), their allocation blocks,
+    // and the i-node and up to 3 indirect blocks.
     // this really belongs lower down, since writei()
     // might be writing a device like the console.
-    int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
-    int i = 0;
-    while(i < n){
-      int n1 = n - i;
-      if(n1 > max)
-        n1 = max;
-
-      begin_op();
+    max = ((log_opmax()-4) / 2 - 2) * BSIZE;
+    o = off;
+    tot = 0;
+    full = 0;
+    i = 0;
+    k = 0;      // bytes of iov[i] already written
+    while(!full){
+      // The next transaction's worth.
+      n = 0;
+      for(r = i, k1 = k; r < niov && n < max; r++, k1 = 0)
+        n += min(iov[r].len - k1, max - n);
+      if(n == 0)
+        break;
+      nb = (n/BSIZE + 2) * 2 + 4;
+      if(nb < MAXOPBLOCKS)
+        nb = MAXOPBLOCKS;
+
+      begin_opn(nb);
       ilock(f->ip);
-      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
-        f->off += r;
+      if(off < 0)
+        o = f->off;
+      for(w = 0; w < n; ){
+        if((n1 = min(iov[i].len - k, n - w)) > 0){
+          r = writei(f->ip, (char*)iov[i].base + k, o, n1);
+          if(r > 0){
+            o += r;
+            w += r;
+            k += r;
+          }
+          if(r != n1){
+            full = 1;  // file full
+            break;
+          }
+        }
+        if(k == iov[i].len){
+          i++;
+          k = 0;
+        }
+      }
+      if(off < 0)
+        f->off = o;
       iunlock(f->ip);
-      end_op();
-
-      if(r < 0)
-        break;
-      if(r != n1)
-        panic("short filewrite");
-      i += r;
+      end_opn(nb);
+      tot += w;
     }
-    return i == n ? n : -1;
+    for(; i < niov && iov[i].len == k; i++, k = 0)
+      ;
+    return i == niov ? tot : -1;
   }
   panic("filewrite");
 }
 
+// Write to file f.
+int
+filewrite(struct file *f, char *addr, int n)
+{
+  struct iovec iov;
+
+  iov.base = addr;
+  iov.len = n;
+  return filewritev(f, &iov, 1, -1);
+}
+
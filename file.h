@@ -14,15 +14,43 @@ struct inode {
   uint dev;           // Device number
   uint inum;          // Inode number
   int ref;            // Reference count
+  struct inode *hnext; // icache hash chain, under icache.lock
+  struct inode *lprev; // icache LRU list, while ref is 0
+  struct inode *lnext;
   struct sleeplock lock; // protects everything below here
   int valid;          // inode has been read from disk?
 
   short type;         // copy of disk inode
+  short flags;
   short major;
   short minor;
   short nlink;
   uint size;
-  uint addrs[NDIRECT+1];
+  uint addrs[NDIRECT+2];   // direct, indirect and double-indirect
+
+  // The run of blocks bmap() last translated through an indirect
+  // or extent block: file blocks [mapbn, mapbn+maplen) are at disk
+  // blocks mapaddr on.  Readers sharing the lock update it, so it
+  // has a spin-lock of its own.
+  struct spinlock maplock;
+  uint mapbn;
+  uint mapaddr;
+  uint maplen;
+
+  // Delayed allocation (fs.c): file blocks [dfirst, dfirst+ndelay)
+  // are in memory, in dblk[], with no disk blocks yet.
+  uint dfirst;
+  uint ndelay;
+  uchar *dblk[NDELAY];
+  struct inode *dnext; // On the flusher's or reclaimer's list
+  int dlisted;
+
+  int npcache;        // Pages in the page cache, under its lock
+
+  // Read-ahead state (readi), a hint updated by readers that may
+  // share the lock.
+  uint ranext;        // Block a sequential reader reads next
+  uint raend;         // First block not yet read ahead
 };
 
 // table mapping major device number to
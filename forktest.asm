@@ -0,0 +1,1760 @@
+
+_forktest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <printf>:
+
+#define N  1000
+
+void
+printf(int fd, const char *s, ...)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	53                   	push   %ebx
+   4:	83 ec 10             	sub    $0x10,%esp
+   7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  write(fd, s, strlen(s));
+   a:	53                   	push   %ebx
+   b:	e8 25 01 00 00       	call   135 <strlen>
+  10:	83 c4 0c             	add    $0xc,%esp
+  13:	50                   	push   %eax
+  14:	53                   	push   %ebx
+  15:	ff 75 08             	push   0x8(%ebp)
+  18:	e8 37 08 00 00       	call   854 <write>
+}
+  1d:	83 c4 10             	add    $0x10,%esp
+  20:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  23:	c9                   	leave
+  24:	c3                   	ret
+
+00000025 <forktest>:
+
+void
+forktest(void)
+{
+  25:	55                   	push   %ebp
+  26:	89 e5                	mov    %esp,%ebp
+  28:	53                   	push   %ebx
+  29:	83 ec 0c             	sub    $0xc,%esp
+  int n, pid;
+
+  printf(1, "fork test\n");
+  2c:	68 90 0b 00 00       	push   $0xb90
+  31:	6a 01                	push   $0x1
+  33:	e8 c8 ff ff ff       	call   0 <printf>
+
+  for(n=0; n<N; n++){
+  38:	83 c4 10             	add    $0x10,%esp
+  3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  40:	81 fb e7 03 00 00    	cmp    $0x3e7,%ebx
+  46:	7f 15                	jg     5d <forktest+0x38>
+    pid = fork();
+  48:	e8 c0 06 00 00       	call   70d <fork>
+    if(pid < 0)
+  4d:	85 c0                	test   %eax,%eax
+  4f:	78 0c                	js     5d <forktest+0x38>
+      break;
+    if(pid == 0)
+  51:	74 05                	je     58 <forktest+0x33>
+  for(n=0; n<N; n++){
+  53:	83 c3 01             	add    $0x1,%ebx
+  56:	eb e8                	jmp    40 <forktest+0x1b>
+      exit();
+  58:	e8 c4 06 00 00       	call   721 <exit>
+  }
+
+  if(n == N){
+  5d:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+  63:	74 12                	je     77 <forktest+0x52>
+    printf(1, "fork claimed to work N times!\n", N);
+    exit();
+  }
+
+  for(; n > 0; n--){
+  65:	85 db                	test   %ebx,%ebx
+  67:	7e 3b                	jle    a4 <forktest+0x7f>
+    if(wait() < 0){
+  69:	e8 b9 07 00 00       	call   827 <wait>
+  6e:	85 c0                	test   %eax,%eax
+  70:	78 1e                	js     90 <forktest+0x6b>
+  for(; n > 0; n--){
+  72:	83 eb 01             	sub    $0x1,%ebx
+  75:	eb ee                	jmp    65 <forktest+0x40>
+    printf(1, "fork claimed to work N times!\n", N);
+  77:	83 ec 04             	sub    $0x4,%esp
+  7a:	68 e8 03 00 00       	push   $0x3e8
+  7f:	68 d0 0b 00 00       	push   $0xbd0
+  84:	6a 01                	push   $0x1
+  86:	e8 75 ff ff ff       	call   0 <printf>
+    exit();
+  8b:	e8 91 06 00 00       	call   721 <exit>
+      printf(1, "wait stopped early\n");
+  90:	83 ec 08             	sub    $0x8,%esp
+  93:	68 9b 0b 00 00       	push   $0xb9b
+  98:	6a 01                	push   $0x1
+  9a:	e8 61 ff ff ff       	call   0 <printf>
+      exit();
+  9f:	e8 7d 06 00 00       	call   721 <exit>
+    }
+  }
+
+  if(wait() != -1){
+  a4:	e8 7e 07 00 00       	call   827 <wait>
+  a9:	83 f8 ff             	cmp    $0xffffffff,%eax
+  ac:	75 17                	jne    c5 <forktest+0xa0>
+    printf(1, "wait got too many\n");
+    exit();
+  }
+
+  printf(1, "fork test OK\n");
+  ae:	83 ec 08             	sub    $0x8,%esp
+  b1:	68 c2 0b 00 00       	push   $0xbc2
+  b6:	6a 01                	push   $0x1
+  b8:	e8 43 ff ff ff       	call   0 <printf>
+}
+  bd:	83 c4 10             	add    $0x10,%esp
+  c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  c3:	c9                   	leave
+  c4:	c3                   	ret
+    printf(1, "wait got too many\n");
+  c5:	83 ec 08             	sub    $0x8,%esp
+  c8:	68 af 0b 00 00       	push   $0xbaf
+  cd:	6a 01                	push   $0x1
+  cf:	e8 2c ff ff ff       	call   0 <printf>
+    exit();
+  d4:	e8 48 06 00 00       	call   721 <exit>
+
+000000d9 <main>:
+
+int
+main(void)
+{
+  d9:	55                   	push   %ebp
+  da:	89 e5                	mov    %esp,%ebp
+  dc:	83 e4 f0             	and    $0xfffffff0,%esp
+  forktest();
+  df:	e8 41 ff ff ff       	call   25 <forktest>
+  exit();
+  e4:	e8 38 06 00 00       	call   721 <exit>
+
+000000e9 <strcpy>:
+#include "memlayout.h"
+#include "clock.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  e9:	55                   	push   %ebp
+  ea:	89 e5                	mov    %esp,%ebp
+  ec:	56                   	push   %esi
+  ed:	53                   	push   %ebx
+  ee:	8b 75 08             	mov    0x8(%ebp),%esi
+  f1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  f4:	89 f0                	mov    %esi,%eax
+  f6:	89 d1                	mov    %edx,%ecx
+  f8:	83 c2 01             	add    $0x1,%edx
+  fb:	89 c3                	mov    %eax,%ebx
+  fd:	83 c0 01             	add    $0x1,%eax
+ 100:	0f b6 09             	movzbl (%ecx),%ecx
+ 103:	88 0b                	mov    %cl,(%ebx)
+ 105:	84 c9                	test   %cl,%cl
+ 107:	75 ed                	jne    f6 <strcpy+0xd>
+    ;
+  return os;
+}
+ 109:	89 f0                	mov    %esi,%eax
+ 10b:	5b                   	pop    %ebx
+ 10c:	5e                   	pop    %esi
+ 10d:	5d                   	pop    %ebp
+ 10e:	c3                   	ret
+
+0000010f <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 10f:	55                   	push   %ebp
+ 110:	89 e5                	mov    %esp,%ebp
+ 112:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 115:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+ 118:	eb 06                	jmp    120 <strcmp+0x11>
+    p++, q++;
+ 11a:	83 c1 01             	add    $0x1,%ecx
+ 11d:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+ 120:	0f b6 01             	movzbl (%ecx),%eax
+ 123:	84 c0                	test   %al,%al
+ 125:	74 04                	je     12b <strcmp+0x1c>
+ 127:	3a 02                	cmp    (%edx),%al
+ 129:	74 ef                	je     11a <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+ 12b:	0f b6 c0             	movzbl %al,%eax
+ 12e:	0f b6 12             	movzbl (%edx),%edx
+ 131:	29 d0                	sub    %edx,%eax
+}
+ 133:	5d                   	pop    %ebp
+ 134:	c3                   	ret
+
+00000135 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 135:	55                   	push   %ebp
+ 136:	89 e5                	mov    %esp,%ebp
+ 138:	53                   	push   %ebx
+ 139:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  const char *p;
+  uint w;
+
+  for(p = s; (uint)p & 3; p++)
+ 13c:	89 c8                	mov    %ecx,%eax
+ 13e:	eb 03                	jmp    143 <strlen+0xe>
+ 140:	83 c0 01             	add    $0x1,%eax
+ 143:	a8 03                	test   $0x3,%al
+ 145:	74 09                	je     150 <strlen+0x1b>
+    if(*p == 0)
+ 147:	80 38 00             	cmpb   $0x0,(%eax)
+ 14a:	75 f4                	jne    140 <strlen+0xb>
+      return p - s;
+ 14c:	29 c8                	sub    %ecx,%eax
+ 14e:	eb 25                	jmp    175 <strlen+0x40>
+  // Then a word at a time, which never crosses into the next page:
+  // a word with a zero byte in it has one of these bits set.
+  for(;; p += 4){
+    w = *(uint*)p;
+ 150:	8b 10                	mov    (%eax),%edx
+    if((w - 0x01010101) & ~w & 0x80808080)
+ 152:	8d 9a ff fe fe fe    	lea    -0x1010101(%edx),%ebx
+ 158:	f7 d2                	not    %edx
+ 15a:	21 da                	and    %ebx,%edx
+ 15c:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+ 162:	75 05                	jne    169 <strlen+0x34>
+  for(;; p += 4){
+ 164:	83 c0 04             	add    $0x4,%eax
+    w = *(uint*)p;
+ 167:	eb e7                	jmp    150 <strlen+0x1b>
+      break;
+  }
+  while(*p)
+ 169:	80 38 00             	cmpb   $0x0,(%eax)
+ 16c:	74 05                	je     173 <strlen+0x3e>
+    p++;
+ 16e:	83 c0 01             	add    $0x1,%eax
+ 171:	eb f6                	jmp    169 <strlen+0x34>
+  return p - s;
+ 173:	29 c8                	sub    %ecx,%eax
+}
+ 175:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 178:	c9                   	leave
+ 179:	c3                   	ret
+
+0000017a <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 17a:	55                   	push   %ebp
+ 17b:	89 e5                	mov    %esp,%ebp
+ 17d:	57                   	push   %edi
+ 17e:	56                   	push   %esi
+ 17f:	53                   	push   %ebx
+ 180:	8b 55 10             	mov    0x10(%ebp),%edx
+  uint h;
+  char *d;
+
+  d = dst;
+  c &= 0xFF;
+ 183:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  if(n >= 16){
+ 187:	83 fa 0f             	cmp    $0xf,%edx
+ 18a:	76 52                	jbe    1de <memset+0x64>
+    h = -(uint)d & 3;
+ 18c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 18f:	f7 d8                	neg    %eax
+ 191:	83 e0 03             	and    $0x3,%eax
+ 194:	89 c6                	mov    %eax,%esi
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 196:	8b 7d 08             	mov    0x8(%ebp),%edi
+ 199:	89 c1                	mov    %eax,%ecx
+ 19b:	89 d8                	mov    %ebx,%eax
+ 19d:	fc                   	cld
+ 19e:	f3 aa                	rep stos %al,%es:(%edi)
+    stosb(d, c, h);
+    stosl(d + h, (c<<24)|(c<<16)|(c<<8)|c, (n - h)/4);
+ 1a0:	29 f2                	sub    %esi,%edx
+ 1a2:	89 d1                	mov    %edx,%ecx
+ 1a4:	c1 e9 02             	shr    $0x2,%ecx
+ 1a7:	c1 e0 18             	shl    $0x18,%eax
+ 1aa:	89 df                	mov    %ebx,%edi
+ 1ac:	c1 e7 10             	shl    $0x10,%edi
+ 1af:	09 f8                	or     %edi,%eax
+ 1b1:	89 df                	mov    %ebx,%edi
+ 1b3:	c1 e7 08             	shl    $0x8,%edi
+ 1b6:	09 f8                	or     %edi,%eax
+ 1b8:	09 d8                	or     %ebx,%eax
+ 1ba:	89 f7                	mov    %esi,%edi
+ 1bc:	03 7d 08             	add    0x8(%ebp),%edi
+}
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosl" :
+ 1bf:	fc                   	cld
+ 1c0:	f3 ab                	rep stos %eax,%es:(%edi)
+    d += h + (n - h)/4*4;
+ 1c2:	89 d7                	mov    %edx,%edi
+ 1c4:	83 e7 fc             	and    $0xfffffffc,%edi
+ 1c7:	09 f7                	or     %esi,%edi
+ 1c9:	03 7d 08             	add    0x8(%ebp),%edi
+    n = (n - h)%4;
+ 1cc:	83 e2 03             	and    $0x3,%edx
+  asm volatile("cld; rep stosb" :
+ 1cf:	89 d1                	mov    %edx,%ecx
+ 1d1:	89 d8                	mov    %ebx,%eax
+ 1d3:	fc                   	cld
+ 1d4:	f3 aa                	rep stos %al,%es:(%edi)
+  }
+  stosb(d, c, n);
+  return dst;
+}
+ 1d6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d9:	5b                   	pop    %ebx
+ 1da:	5e                   	pop    %esi
+ 1db:	5f                   	pop    %edi
+ 1dc:	5d                   	pop    %ebp
+ 1dd:	c3                   	ret
+  d = dst;
+ 1de:	8b 7d 08             	mov    0x8(%ebp),%edi
+ 1e1:	eb ec                	jmp    1cf <memset+0x55>
+
+000001e3 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1e3:	55                   	push   %ebp
+ 1e4:	89 e5                	mov    %esp,%ebp
+ 1e6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1ed:	eb 03                	jmp    1f2 <strchr+0xf>
+ 1ef:	83 c0 01             	add    $0x1,%eax
+ 1f2:	0f b6 10             	movzbl (%eax),%edx
+ 1f5:	84 d2                	test   %dl,%dl
+ 1f7:	74 06                	je     1ff <strchr+0x1c>
+    if(*s == c)
+ 1f9:	38 ca                	cmp    %cl,%dl
+ 1fb:	75 f2                	jne    1ef <strchr+0xc>
+ 1fd:	eb 05                	jmp    204 <strchr+0x21>
+      return (char*)s;
+  return 0;
+ 1ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 204:	5d                   	pop    %ebp
+ 205:	c3                   	ret
+
+00000206 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+ 206:	55                   	push   %ebp
+ 207:	89 e5                	mov    %esp,%ebp
+ 209:	56                   	push   %esi
+ 20a:	53                   	push   %ebx
+ 20b:	8b 55 08             	mov    0x8(%ebp),%edx
+ 20e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 211:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  // A word at a time while they agree.
+  if((((uint)s1 | (uint)s2) & 3) == 0)
+ 214:	89 d3                	mov    %edx,%ebx
+ 216:	09 cb                	or     %ecx,%ebx
+ 218:	f6 c3 03             	test   $0x3,%bl
+ 21b:	74 24                	je     241 <memcmp+0x3b>
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+      s1 += 4, s2 += 4;
+  while(n-- > 0){
+ 21d:	8d 70 ff             	lea    -0x1(%eax),%esi
+ 220:	85 c0                	test   %eax,%eax
+ 222:	74 32                	je     256 <memcmp+0x50>
+    if(*s1 != *s2)
+ 224:	0f b6 02             	movzbl (%edx),%eax
+ 227:	0f b6 19             	movzbl (%ecx),%ebx
+ 22a:	38 d8                	cmp    %bl,%al
+ 22c:	75 20                	jne    24e <memcmp+0x48>
+      return *s1 - *s2;
+    s1++, s2++;
+ 22e:	83 c2 01             	add    $0x1,%edx
+ 231:	83 c1 01             	add    $0x1,%ecx
+  while(n-- > 0){
+ 234:	89 f0                	mov    %esi,%eax
+ 236:	eb e5                	jmp    21d <memcmp+0x17>
+      s1 += 4, s2 += 4;
+ 238:	83 c2 04             	add    $0x4,%edx
+ 23b:	83 c1 04             	add    $0x4,%ecx
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+ 23e:	83 e8 04             	sub    $0x4,%eax
+ 241:	83 f8 03             	cmp    $0x3,%eax
+ 244:	76 d7                	jbe    21d <memcmp+0x17>
+ 246:	8b 31                	mov    (%ecx),%esi
+ 248:	39 32                	cmp    %esi,(%edx)
+ 24a:	74 ec                	je     238 <memcmp+0x32>
+ 24c:	eb cf                	jmp    21d <memcmp+0x17>
+      return *s1 - *s2;
+ 24e:	0f b6 c0             	movzbl %al,%eax
+ 251:	0f b6 db             	movzbl %bl,%ebx
+ 254:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+ 256:	5b                   	pop    %ebx
+ 257:	5e                   	pop    %esi
+ 258:	5d                   	pop    %ebp
+ 259:	c3                   	ret
+
+0000025a <memchr>:
+// The first c in the n bytes at v, or 0.  Once aligned, a word at
+// a time, with the word's bytes that equal c turned into zeroes
+// and those looked for.
+void*
+memchr(const void *v, int c, uint n)
+{
+ 25a:	55                   	push   %ebp
+ 25b:	89 e5                	mov    %esp,%ebp
+ 25d:	57                   	push   %edi
+ 25e:	56                   	push   %esi
+ 25f:	53                   	push   %ebx
+ 260:	8b 45 08             	mov    0x8(%ebp),%eax
+ 263:	8b 55 10             	mov    0x10(%ebp),%edx
+  const uchar *s;
+  uint w, rep;
+
+  s = v;
+  c = (uchar)c;
+ 266:	0f b6 75 0c          	movzbl 0xc(%ebp),%esi
+  for(; n > 0 && ((uint)s & 3); n--, s++)
+ 26a:	eb 06                	jmp    272 <memchr+0x18>
+ 26c:	83 ea 01             	sub    $0x1,%edx
+ 26f:	83 c0 01             	add    $0x1,%eax
+ 272:	85 d2                	test   %edx,%edx
+ 274:	74 0d                	je     283 <memchr+0x29>
+ 276:	a8 03                	test   $0x3,%al
+ 278:	74 09                	je     283 <memchr+0x29>
+    if(*s == c)
+ 27a:	0f b6 08             	movzbl (%eax),%ecx
+ 27d:	39 f1                	cmp    %esi,%ecx
+ 27f:	75 eb                	jne    26c <memchr+0x12>
+ 281:	eb 41                	jmp    2c4 <memchr+0x6a>
+      return (void*)s;
+  rep = c * 0x01010101;
+ 283:	69 fe 01 01 01 01    	imul   $0x1010101,%esi,%edi
+  for(; n >= 4; n -= 4, s += 4){
+ 289:	eb 06                	jmp    291 <memchr+0x37>
+ 28b:	83 ea 04             	sub    $0x4,%edx
+ 28e:	83 c0 04             	add    $0x4,%eax
+ 291:	83 fa 03             	cmp    $0x3,%edx
+ 294:	76 16                	jbe    2ac <memchr+0x52>
+    w = *(uint*)s ^ rep;
+ 296:	89 f9                	mov    %edi,%ecx
+ 298:	33 08                	xor    (%eax),%ecx
+    if((w - 0x01010101) & ~w & 0x80808080)
+ 29a:	8d 99 ff fe fe fe    	lea    -0x1010101(%ecx),%ebx
+ 2a0:	f7 d1                	not    %ecx
+ 2a2:	21 cb                	and    %ecx,%ebx
+ 2a4:	f7 c3 80 80 80 80    	test   $0x80808080,%ebx
+ 2aa:	74 df                	je     28b <memchr+0x31>
+      break;
+  }
+  for(; n > 0; n--, s++)
+ 2ac:	85 d2                	test   %edx,%edx
+ 2ae:	74 0f                	je     2bf <memchr+0x65>
+    if(*s == c)
+ 2b0:	0f b6 08             	movzbl (%eax),%ecx
+ 2b3:	39 f1                	cmp    %esi,%ecx
+ 2b5:	74 0d                	je     2c4 <memchr+0x6a>
+  for(; n > 0; n--, s++)
+ 2b7:	83 ea 01             	sub    $0x1,%edx
+ 2ba:	83 c0 01             	add    $0x1,%eax
+ 2bd:	eb ed                	jmp    2ac <memchr+0x52>
+      return (void*)s;
+  return 0;
+ 2bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 2c4:	5b                   	pop    %ebx
+ 2c5:	5e                   	pop    %esi
+ 2c6:	5f                   	pop    %edi
+ 2c7:	5d                   	pop    %ebp
+ 2c8:	c3                   	ret
+
+000002c9 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2c9:	55                   	push   %ebp
+ 2ca:	89 e5                	mov    %esp,%ebp
+ 2cc:	57                   	push   %edi
+ 2cd:	56                   	push   %esi
+ 2ce:	53                   	push   %ebx
+ 2cf:	83 ec 1c             	sub    $0x1c,%esp
+ 2d2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+ 2d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 2da:	89 de                	mov    %ebx,%esi
+ 2dc:	83 c3 01             	add    $0x1,%ebx
+ 2df:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2e2:	7d 2e                	jge    312 <gets+0x49>
+    cc = read(0, &c, 1);
+ 2e4:	83 ec 04             	sub    $0x4,%esp
+ 2e7:	6a 01                	push   $0x1
+ 2e9:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 2ec:	50                   	push   %eax
+ 2ed:	6a 00                	push   $0x0
+ 2ef:	e8 51 05 00 00       	call   845 <read>
+    if(cc < 1)
+ 2f4:	83 c4 10             	add    $0x10,%esp
+ 2f7:	85 c0                	test   %eax,%eax
+ 2f9:	7e 17                	jle    312 <gets+0x49>
+      break;
+    buf[i++] = c;
+ 2fb:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2ff:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+ 302:	3c 0a                	cmp    $0xa,%al
+ 304:	0f 94 c2             	sete   %dl
+ 307:	3c 0d                	cmp    $0xd,%al
+ 309:	0f 94 c0             	sete   %al
+ 30c:	08 c2                	or     %al,%dl
+ 30e:	74 ca                	je     2da <gets+0x11>
+    buf[i++] = c;
+ 310:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+ 312:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+ 316:	89 f8                	mov    %edi,%eax
+ 318:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 31b:	5b                   	pop    %ebx
+ 31c:	5e                   	pop    %esi
+ 31d:	5f                   	pop    %edi
+ 31e:	5d                   	pop    %ebp
+ 31f:	c3                   	ret
+
+00000320 <atoi>:
+  return r;
+}
+
+int
+atoi(const char *s)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	53                   	push   %ebx
+ 324:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+ 327:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+ 32c:	eb 10                	jmp    33e <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+ 32e:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+ 331:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+ 334:	83 c1 01             	add    $0x1,%ecx
+ 337:	0f be c0             	movsbl %al,%eax
+ 33a:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+ 33e:	0f b6 01             	movzbl (%ecx),%eax
+ 341:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 344:	80 fb 09             	cmp    $0x9,%bl
+ 347:	76 e5                	jbe    32e <atoi+0xe>
+  return n;
+}
+ 349:	89 d0                	mov    %edx,%eax
+ 34b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 34e:	c9                   	leave
+ 34f:	c3                   	ret
+
+00000350 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	57                   	push   %edi
+ 354:	56                   	push   %esi
+ 355:	53                   	push   %ebx
+ 356:	83 ec 08             	sub    $0x8,%esp
+ 359:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 35c:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 35f:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *src;
+  int h;
+
+  dst = vdst;
+  src = vsrc;
+  if(n <= 0)
+ 362:	85 c0                	test   %eax,%eax
+ 364:	0f 8e 82 00 00 00    	jle    3ec <memmove+0x9c>
+    return vdst;
+  if(src < dst && src + n > dst){
+ 36a:	39 da                	cmp    %ebx,%edx
+ 36c:	73 07                	jae    375 <memmove+0x25>
+ 36e:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+ 371:	39 cb                	cmp    %ecx,%ebx
+ 373:	72 5e                	jb     3d3 <memmove+0x83>
+    movsbback(dst + n - 1, src + n - 1, n);
+    return vdst;
+  }
+  if(n >= 16 && (((uint)dst ^ (uint)src) & 3) == 0){
+ 375:	83 f8 0f             	cmp    $0xf,%eax
+ 378:	7e 69                	jle    3e3 <memmove+0x93>
+ 37a:	89 d9                	mov    %ebx,%ecx
+ 37c:	31 d1                	xor    %edx,%ecx
+ 37e:	f6 c1 03             	test   $0x3,%cl
+ 381:	75 73                	jne    3f6 <memmove+0xa6>
+    h = -(uint)dst & 3;
+ 383:	89 d9                	mov    %ebx,%ecx
+ 385:	f7 d9                	neg    %ecx
+ 387:	83 e1 03             	and    $0x3,%ecx
+}
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsb" :
+ 38a:	89 df                	mov    %ebx,%edi
+ 38c:	89 d6                	mov    %edx,%esi
+ 38e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+ 391:	fc                   	cld
+ 392:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    movsb(dst, src, h);
+    dst += h, src += h, n -= h;
+ 394:	8b 75 f0             	mov    -0x10(%ebp),%esi
+ 397:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+ 39a:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+ 39d:	29 f0                	sub    %esi,%eax
+    movsl(dst, src, n/4);
+ 39f:	8d 50 03             	lea    0x3(%eax),%edx
+ 3a2:	0f 49 d0             	cmovns %eax,%edx
+ 3a5:	c1 fa 02             	sar    $0x2,%edx
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+ 3a8:	89 7d f0             	mov    %edi,-0x10(%ebp)
+ 3ab:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+ 3ae:	89 ce                	mov    %ecx,%esi
+ 3b0:	89 d1                	mov    %edx,%ecx
+ 3b2:	fc                   	cld
+ 3b3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    dst += n/4*4, src += n/4*4, n %= 4;
+ 3b5:	c1 e2 02             	shl    $0x2,%edx
+ 3b8:	8b 7d f0             	mov    -0x10(%ebp),%edi
+ 3bb:	01 d7                	add    %edx,%edi
+ 3bd:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 3c0:	01 ca                	add    %ecx,%edx
+ 3c2:	89 c6                	mov    %eax,%esi
+ 3c4:	c1 fe 1f             	sar    $0x1f,%esi
+ 3c7:	c1 ee 1e             	shr    $0x1e,%esi
+ 3ca:	01 f0                	add    %esi,%eax
+ 3cc:	83 e0 03             	and    $0x3,%eax
+ 3cf:	29 f0                	sub    %esi,%eax
+ 3d1:	eb 12                	jmp    3e5 <memmove+0x95>
+    movsbback(dst + n - 1, src + n - 1, n);
+ 3d3:	8d 78 ff             	lea    -0x1(%eax),%edi
+ 3d6:	8d 34 3a             	lea    (%edx,%edi,1),%esi
+ 3d9:	01 df                	add    %ebx,%edi
+// Copy cnt bytes down from the last ones, at dst and src, to the
+// first: for overlapping moves up.
+static inline void
+movsbback(void *dst, const void *src, int cnt)
+{
+  asm volatile("std; rep movsb; cld" :
+ 3db:	89 c1                	mov    %eax,%ecx
+ 3dd:	fd                   	std
+ 3de:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+ 3e0:	fc                   	cld
+    return vdst;
+ 3e1:	eb 09                	jmp    3ec <memmove+0x9c>
+  dst = vdst;
+ 3e3:	89 df                	mov    %ebx,%edi
+  asm volatile("cld; rep movsb" :
+ 3e5:	89 d6                	mov    %edx,%esi
+ 3e7:	89 c1                	mov    %eax,%ecx
+ 3e9:	fc                   	cld
+ 3ea:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  }
+  movsb(dst, src, n);
+  return vdst;
+}
+ 3ec:	89 d8                	mov    %ebx,%eax
+ 3ee:	83 c4 08             	add    $0x8,%esp
+ 3f1:	5b                   	pop    %ebx
+ 3f2:	5e                   	pop    %esi
+ 3f3:	5f                   	pop    %edi
+ 3f4:	5d                   	pop    %ebp
+ 3f5:	c3                   	ret
+  dst = vdst;
+ 3f6:	89 df                	mov    %ebx,%edi
+ 3f8:	eb eb                	jmp    3e5 <memmove+0x95>
+
+000003fa <vclock_gettime>:
+
+// clock_gettime() without a system call: read the clock page
+// that the kernel maps at CLOCKPAGE (see clock.h).
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+ 3fa:	55                   	push   %ebp
+ 3fb:	89 e5                	mov    %esp,%ebp
+ 3fd:	57                   	push   %edi
+ 3fe:	56                   	push   %esi
+ 3ff:	53                   	push   %ebx
+ 400:	83 ec 14             	sub    $0x14,%esp
+  struct clockpage *cp = (struct clockpage*)CLOCKPAGE;
+  uint seq, rem, d;
+  uint64 tsc, ns, now;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+ 403:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+ 407:	0f 87 a3 00 00 00    	ja     4b0 <vclock_gettime+0xb6>
+    return -1;
+  do {
+    seq = cp->seq;
+ 40d:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+    __sync_synchronize();
+ 412:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    tsc = cp->tsc;
+ 417:	8b 15 10 f0 ff 7f    	mov    0x7ffff010,%edx
+ 41d:	8b 1d 14 f0 ff 7f    	mov    0x7ffff014,%ebx
+    ns = cp->ns;
+ 423:	8b 35 18 f0 ff 7f    	mov    0x7ffff018,%esi
+ 429:	8b 3d 1c f0 ff 7f    	mov    0x7ffff01c,%edi
+    __sync_synchronize();
+ 42f:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != cp->seq);
+ 434:	89 c1                	mov    %eax,%ecx
+ 436:	83 e1 01             	and    $0x1,%ecx
+ 439:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+ 43c:	75 cf                	jne    40d <vclock_gettime+0x13>
+ 43e:	8b 0d 00 f0 ff 7f    	mov    0x7ffff000,%ecx
+ 444:	39 c1                	cmp    %eax,%ecx
+ 446:	75 c5                	jne    40d <vclock_gettime+0x13>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+ 448:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 44b:	89 55 ec             	mov    %edx,-0x14(%ebp)
+ 44e:	0f 31                	rdtsc
+ 450:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 453:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 456:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  now = rdtsc();
+  // Less than a tick has passed since the update, so the delta
+  // fits in 32 bits.
+  d = now > tsc ? now - tsc : 0;
+ 459:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 45c:	19 d3                	sbb    %edx,%ebx
+ 45e:	73 07                	jae    467 <vclock_gettime+0x6d>
+ 460:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+ 463:	29 d8                	sub    %ebx,%eax
+ 465:	89 c1                	mov    %eax,%ecx
+  ns += ((uint64)d * cp->mult) >> cp->shift;
+ 467:	89 c8                	mov    %ecx,%eax
+ 469:	f7 25 04 f0 ff 7f    	mull   0x7ffff004
+ 46f:	0f b6 0d 08 f0 ff 7f 	movzbl 0x7ffff008,%ecx
+ 476:	0f ad d0             	shrd   %cl,%edx,%eax
+ 479:	d3 ea                	shr    %cl,%edx
+ 47b:	f6 c1 20             	test   $0x20,%cl
+ 47e:	74 04                	je     484 <vclock_gettime+0x8a>
+ 480:	89 d0                	mov    %edx,%eax
+ 482:	31 d2                	xor    %edx,%edx
+ 484:	01 f0                	add    %esi,%eax
+ 486:	11 fa                	adc    %edi,%edx
+static inline uint
+divl(uint64 n, uint d, uint *r)
+{
+  uint q;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (*r) :
+ 488:	bb 00 ca 9a 3b       	mov    $0x3b9aca00,%ebx
+ 48d:	f7 f3                	div    %ebx
+  ts->tv_sec = divl(ns, 1000000000, &rem);
+ 48f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 492:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = rem;
+ 494:	89 57 04             	mov    %edx,0x4(%edi)
+  if(clk == CLOCK_REALTIME)
+ 497:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 49b:	75 1a                	jne    4b7 <vclock_gettime+0xbd>
+    ts->tv_sec += cp->boottime;
+ 49d:	03 05 0c f0 ff 7f    	add    0x7ffff00c,%eax
+ 4a3:	89 07                	mov    %eax,(%edi)
+  return 0;
+ 4a5:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 4a8:	83 c4 14             	add    $0x14,%esp
+ 4ab:	5b                   	pop    %ebx
+ 4ac:	5e                   	pop    %esi
+ 4ad:	5f                   	pop    %edi
+ 4ae:	5d                   	pop    %ebp
+ 4af:	c3                   	ret
+    return -1;
+ 4b0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 4b5:	eb f1                	jmp    4a8 <vclock_gettime+0xae>
+  return 0;
+ 4b7:	b8 00 00 00 00       	mov    $0x0,%eax
+ 4bc:	eb ea                	jmp    4a8 <vclock_gettime+0xae>
+
+000004be <flush>:
+
+// Write out fd's buffer, or with fd < 0 every buffer.
+// Returns -1 if a write fails.
+int
+flush(int fd)
+{
+ 4be:	55                   	push   %ebp
+ 4bf:	89 e5                	mov    %esp,%ebp
+ 4c1:	56                   	push   %esi
+ 4c2:	53                   	push   %ebx
+ 4c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  int r, n;
+
+  if(fd < 0){
+ 4c6:	85 c0                	test   %eax,%eax
+ 4c8:	78 5d                	js     527 <flush+0x69>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+      if(flush(fd) < 0)
+        r = -1;
+    return r;
+  }
+  if(fd >= NOBUF || (n = obuf[fd].n) == 0)
+ 4ca:	83 f8 0f             	cmp    $0xf,%eax
+ 4cd:	7f 64                	jg     533 <flush+0x75>
+ 4cf:	69 d0 08 02 00 00    	imul   $0x208,%eax,%edx
+ 4d5:	8b b2 a4 0f 00 00    	mov    0xfa4(%edx),%esi
+ 4db:	85 f6                	test   %esi,%esi
+ 4dd:	74 59                	je     538 <flush+0x7a>
+    return 0;
+  obuf[fd].n = 0;
+ 4df:	c7 82 a4 0f 00 00 00 	movl   $0x0,0xfa4(%edx)
+ 4e6:	00 00 00 
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+ 4e9:	81 c2 a8 0f 00 00    	add    $0xfa8,%edx
+ 4ef:	83 ec 04             	sub    $0x4,%esp
+ 4f2:	56                   	push   %esi
+ 4f3:	52                   	push   %edx
+ 4f4:	50                   	push   %eax
+ 4f5:	e8 5a 03 00 00       	call   854 <write>
+ 4fa:	83 c4 10             	add    $0x10,%esp
+ 4fd:	39 f0                	cmp    %esi,%eax
+ 4ff:	75 40                	jne    541 <flush+0x83>
+ 501:	be 00 00 00 00       	mov    $0x0,%esi
+ 506:	eb 30                	jmp    538 <flush+0x7a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+ 508:	83 c3 01             	add    $0x1,%ebx
+ 50b:	83 fb 0f             	cmp    $0xf,%ebx
+ 50e:	7f 28                	jg     538 <flush+0x7a>
+      if(flush(fd) < 0)
+ 510:	83 ec 0c             	sub    $0xc,%esp
+ 513:	53                   	push   %ebx
+ 514:	e8 a5 ff ff ff       	call   4be <flush>
+ 519:	83 c4 10             	add    $0x10,%esp
+ 51c:	85 c0                	test   %eax,%eax
+ 51e:	79 e8                	jns    508 <flush+0x4a>
+        r = -1;
+ 520:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 525:	eb e1                	jmp    508 <flush+0x4a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+ 527:	be 00 00 00 00       	mov    $0x0,%esi
+ 52c:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 531:	eb d8                	jmp    50b <flush+0x4d>
+    return 0;
+ 533:	be 00 00 00 00       	mov    $0x0,%esi
+}
+ 538:	89 f0                	mov    %esi,%eax
+ 53a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 53d:	5b                   	pop    %ebx
+ 53e:	5e                   	pop    %esi
+ 53f:	5d                   	pop    %ebp
+ 540:	c3                   	ret
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+ 541:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 546:	eb f0                	jmp    538 <flush+0x7a>
+
+00000548 <bufreset>:
+
+static void
+bufreset(int fd)
+{
+  if(fd >= 0 && fd < NOBUF){
+ 548:	83 f8 0f             	cmp    $0xf,%eax
+ 54b:	76 01                	jbe    54e <bufreset+0x6>
+ 54d:	c3                   	ret
+{
+ 54e:	55                   	push   %ebp
+ 54f:	89 e5                	mov    %esp,%ebp
+ 551:	53                   	push   %ebx
+ 552:	83 ec 10             	sub    $0x10,%esp
+ 555:	89 c3                	mov    %eax,%ebx
+    flush(fd);
+ 557:	50                   	push   %eax
+ 558:	e8 61 ff ff ff       	call   4be <flush>
+    obuf[fd].mode = BUNKNOWN;
+ 55d:	69 db 08 02 00 00    	imul   $0x208,%ebx,%ebx
+ 563:	c7 83 a0 0f 00 00 00 	movl   $0x0,0xfa0(%ebx)
+ 56a:	00 00 00 
+ 56d:	83 c4 10             	add    $0x10,%esp
+  }
+}
+ 570:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 573:	c9                   	leave
+ 574:	c3                   	ret
+
+00000575 <bufwrite>:
+
+// Write n bytes from p to fd, through its buffer.
+// Returns n, or -1 if a write fails.
+int
+bufwrite(int fd, const void *p, int n)
+{
+ 575:	55                   	push   %ebp
+ 576:	89 e5                	mov    %esp,%ebp
+ 578:	57                   	push   %edi
+ 579:	56                   	push   %esi
+ 57a:	53                   	push   %ebx
+ 57b:	83 ec 3c             	sub    $0x3c,%esp
+ 57e:	8b 75 08             	mov    0x8(%ebp),%esi
+ 581:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct stat st;
+  const char *s;
+  int i;
+
+  if(fd < 0 || fd >= NOBUF)
+ 584:	83 fe 0f             	cmp    $0xf,%esi
+ 587:	0f 87 a2 00 00 00    	ja     62f <bufwrite+0xba>
+    return write(fd, p, n);
+  if(obuf[fd].mode == BUNKNOWN){
+ 58d:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+ 593:	83 b8 a0 0f 00 00 00 	cmpl   $0x0,0xfa0(%eax)
+ 59a:	75 19                	jne    5b5 <bufwrite+0x40>
+    if(fd == 2 || fstat(fd, &st) < 0)
+ 59c:	83 fe 02             	cmp    $0x2,%esi
+ 59f:	0f 85 9c 00 00 00    	jne    641 <bufwrite+0xcc>
+      obuf[fd].mode = BNONE;
+ 5a5:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+ 5ab:	c7 80 a0 0f 00 00 01 	movl   $0x1,0xfa0(%eax)
+ 5b2:	00 00 00 
+    else
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+  }
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+ 5b5:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+ 5bb:	89 da                	mov    %ebx,%edx
+ 5bd:	03 90 a4 0f 00 00    	add    0xfa4(%eax),%edx
+ 5c3:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+ 5c9:	0f 8f ae 00 00 00    	jg     67d <bufwrite+0x108>
+    return -1;
+  if(n >= OBUFSZ)
+ 5cf:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+ 5d5:	0f 8f bd 00 00 00    	jg     698 <bufwrite+0x123>
+    return write(fd, p, n);
+  memmove(obuf[fd].buf + obuf[fd].n, p, n);
+ 5db:	69 d6 08 02 00 00    	imul   $0x208,%esi,%edx
+ 5e1:	8d ba a0 0f 00 00    	lea    0xfa0(%edx),%edi
+ 5e7:	8b 82 a4 0f 00 00    	mov    0xfa4(%edx),%eax
+ 5ed:	83 ec 04             	sub    $0x4,%esp
+ 5f0:	53                   	push   %ebx
+ 5f1:	ff 75 0c             	push   0xc(%ebp)
+ 5f4:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+ 5f7:	8d 84 10 a8 0f 00 00 	lea    0xfa8(%eax,%edx,1),%eax
+ 5fe:	50                   	push   %eax
+ 5ff:	e8 4c fd ff ff       	call   350 <memmove>
+  obuf[fd].n += n;
+ 604:	01 5f 04             	add    %ebx,0x4(%edi)
+  if(obuf[fd].mode == BNONE)
+ 607:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+ 60a:	8b 82 a0 0f 00 00    	mov    0xfa0(%edx),%eax
+ 610:	83 c4 10             	add    $0x10,%esp
+ 613:	83 f8 01             	cmp    $0x1,%eax
+ 616:	0f 84 91 00 00 00    	je     6ad <bufwrite+0x138>
+    return flush(fd) < 0 ? -1 : n;
+  if(obuf[fd].mode == BLINE)
+ 61c:	83 f8 02             	cmp    $0x2,%eax
+ 61f:	0f 84 ca 00 00 00    	je     6ef <bufwrite+0x17a>
+    for(s = p, i = 0; i < n; i++)
+      if(s[i] == '\n')
+        return flush(fd) < 0 ? -1 : n;
+  return n;
+ 625:	89 d8                	mov    %ebx,%eax
+}
+ 627:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 62a:	5b                   	pop    %ebx
+ 62b:	5e                   	pop    %esi
+ 62c:	5f                   	pop    %edi
+ 62d:	5d                   	pop    %ebp
+ 62e:	c3                   	ret
+    return write(fd, p, n);
+ 62f:	83 ec 04             	sub    $0x4,%esp
+ 632:	53                   	push   %ebx
+ 633:	ff 75 0c             	push   0xc(%ebp)
+ 636:	56                   	push   %esi
+ 637:	e8 18 02 00 00       	call   854 <write>
+ 63c:	83 c4 10             	add    $0x10,%esp
+ 63f:	eb e6                	jmp    627 <bufwrite+0xb2>
+    if(fd == 2 || fstat(fd, &st) < 0)
+ 641:	83 ec 08             	sub    $0x8,%esp
+ 644:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+ 647:	50                   	push   %eax
+ 648:	56                   	push   %esi
+ 649:	e8 51 02 00 00       	call   89f <fstat>
+ 64e:	83 c4 10             	add    $0x10,%esp
+ 651:	85 c0                	test   %eax,%eax
+ 653:	0f 88 4c ff ff ff    	js     5a5 <bufwrite+0x30>
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+ 659:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+ 65e:	74 16                	je     676 <bufwrite+0x101>
+ 660:	ba 03 00 00 00       	mov    $0x3,%edx
+ 665:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+ 66b:	89 90 a0 0f 00 00    	mov    %edx,0xfa0(%eax)
+ 671:	e9 3f ff ff ff       	jmp    5b5 <bufwrite+0x40>
+ 676:	ba 02 00 00 00       	mov    $0x2,%edx
+ 67b:	eb e8                	jmp    665 <bufwrite+0xf0>
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+ 67d:	83 ec 0c             	sub    $0xc,%esp
+ 680:	56                   	push   %esi
+ 681:	e8 38 fe ff ff       	call   4be <flush>
+ 686:	83 c4 10             	add    $0x10,%esp
+ 689:	85 c0                	test   %eax,%eax
+ 68b:	0f 89 3e ff ff ff    	jns    5cf <bufwrite+0x5a>
+    return -1;
+ 691:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 696:	eb 8f                	jmp    627 <bufwrite+0xb2>
+    return write(fd, p, n);
+ 698:	83 ec 04             	sub    $0x4,%esp
+ 69b:	53                   	push   %ebx
+ 69c:	ff 75 0c             	push   0xc(%ebp)
+ 69f:	56                   	push   %esi
+ 6a0:	e8 af 01 00 00       	call   854 <write>
+ 6a5:	83 c4 10             	add    $0x10,%esp
+ 6a8:	e9 7a ff ff ff       	jmp    627 <bufwrite+0xb2>
+    return flush(fd) < 0 ? -1 : n;
+ 6ad:	83 ec 0c             	sub    $0xc,%esp
+ 6b0:	56                   	push   %esi
+ 6b1:	e8 08 fe ff ff       	call   4be <flush>
+ 6b6:	83 c4 10             	add    $0x10,%esp
+ 6b9:	85 c0                	test   %eax,%eax
+ 6bb:	78 07                	js     6c4 <bufwrite+0x14f>
+ 6bd:	89 d8                	mov    %ebx,%eax
+ 6bf:	e9 63 ff ff ff       	jmp    627 <bufwrite+0xb2>
+ 6c4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 6c9:	e9 59 ff ff ff       	jmp    627 <bufwrite+0xb2>
+        return flush(fd) < 0 ? -1 : n;
+ 6ce:	83 ec 0c             	sub    $0xc,%esp
+ 6d1:	56                   	push   %esi
+ 6d2:	e8 e7 fd ff ff       	call   4be <flush>
+ 6d7:	83 c4 10             	add    $0x10,%esp
+ 6da:	85 c0                	test   %eax,%eax
+ 6dc:	78 07                	js     6e5 <bufwrite+0x170>
+ 6de:	89 d8                	mov    %ebx,%eax
+ 6e0:	e9 42 ff ff ff       	jmp    627 <bufwrite+0xb2>
+ 6e5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 6ea:	e9 38 ff ff ff       	jmp    627 <bufwrite+0xb2>
+    for(s = p, i = 0; i < n; i++)
+ 6ef:	b8 00 00 00 00       	mov    $0x0,%eax
+ 6f4:	39 d8                	cmp    %ebx,%eax
+ 6f6:	7d 0e                	jge    706 <bufwrite+0x191>
+      if(s[i] == '\n')
+ 6f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 6fb:	80 3c 01 0a          	cmpb   $0xa,(%ecx,%eax,1)
+ 6ff:	74 cd                	je     6ce <bufwrite+0x159>
+    for(s = p, i = 0; i < n; i++)
+ 701:	83 c0 01             	add    $0x1,%eax
+ 704:	eb ee                	jmp    6f4 <bufwrite+0x17f>
+  return n;
+ 706:	89 d8                	mov    %ebx,%eax
+ 708:	e9 1a ff ff ff       	jmp    627 <bufwrite+0xb2>
+
+0000070d <fork>:
+
+int
+fork(void)
+{
+ 70d:	55                   	push   %ebp
+ 70e:	89 e5                	mov    %esp,%ebp
+ 710:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+ 713:	6a ff                	push   $0xffffffff
+ 715:	e8 a4 fd ff ff       	call   4be <flush>
+  return _fork();
+ 71a:	e8 bd 00 00 00       	call   7dc <_fork>
+}
+ 71f:	c9                   	leave
+ 720:	c3                   	ret
+
+00000721 <exit>:
+
+int
+exit(void)
+{
+ 721:	55                   	push   %ebp
+ 722:	89 e5                	mov    %esp,%ebp
+ 724:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+ 727:	6a ff                	push   $0xffffffff
+ 729:	e8 90 fd ff ff       	call   4be <flush>
+  _exit();
+ 72e:	e8 b8 00 00 00       	call   7eb <_exit>
+
+00000733 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+ 733:	55                   	push   %ebp
+ 734:	89 e5                	mov    %esp,%ebp
+ 736:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+ 739:	6a ff                	push   $0xffffffff
+ 73b:	e8 7e fd ff ff       	call   4be <flush>
+  return _exec(path, argv);
+ 740:	83 c4 08             	add    $0x8,%esp
+ 743:	ff 75 0c             	push   0xc(%ebp)
+ 746:	ff 75 08             	push   0x8(%ebp)
+ 749:	e8 bb 00 00 00       	call   809 <_exec>
+}
+ 74e:	c9                   	leave
+ 74f:	c3                   	ret
+
+00000750 <close>:
+
+int
+close(int fd)
+{
+ 750:	55                   	push   %ebp
+ 751:	89 e5                	mov    %esp,%ebp
+ 753:	53                   	push   %ebx
+ 754:	83 ec 04             	sub    $0x4,%esp
+ 757:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bufreset(fd);
+ 75a:	89 d8                	mov    %ebx,%eax
+ 75c:	e8 e7 fd ff ff       	call   548 <bufreset>
+  return _close(fd);
+ 761:	83 ec 0c             	sub    $0xc,%esp
+ 764:	53                   	push   %ebx
+ 765:	e8 90 00 00 00       	call   7fa <_close>
+}
+ 76a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 76d:	c9                   	leave
+ 76e:	c3                   	ret
+
+0000076f <stat>:
+{
+ 76f:	55                   	push   %ebp
+ 770:	89 e5                	mov    %esp,%ebp
+ 772:	56                   	push   %esi
+ 773:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+ 774:	83 ec 08             	sub    $0x8,%esp
+ 777:	6a 00                	push   $0x0
+ 779:	ff 75 08             	push   0x8(%ebp)
+ 77c:	e8 f1 00 00 00       	call   872 <open>
+  if(fd < 0)
+ 781:	83 c4 10             	add    $0x10,%esp
+ 784:	85 c0                	test   %eax,%eax
+ 786:	78 24                	js     7ac <stat+0x3d>
+ 788:	89 c3                	mov    %eax,%ebx
+  r = fstat(fd, st);
+ 78a:	83 ec 08             	sub    $0x8,%esp
+ 78d:	ff 75 0c             	push   0xc(%ebp)
+ 790:	50                   	push   %eax
+ 791:	e8 09 01 00 00       	call   89f <fstat>
+ 796:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 798:	89 1c 24             	mov    %ebx,(%esp)
+ 79b:	e8 b0 ff ff ff       	call   750 <close>
+  return r;
+ 7a0:	83 c4 10             	add    $0x10,%esp
+}
+ 7a3:	89 f0                	mov    %esi,%eax
+ 7a5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 7a8:	5b                   	pop    %ebx
+ 7a9:	5e                   	pop    %esi
+ 7aa:	5d                   	pop    %ebp
+ 7ab:	c3                   	ret
+    return -1;
+ 7ac:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 7b1:	eb f0                	jmp    7a3 <stat+0x34>
+
+000007b3 <dup2>:
+
+int
+dup2(int oldfd, int newfd)
+{
+ 7b3:	55                   	push   %ebp
+ 7b4:	89 e5                	mov    %esp,%ebp
+ 7b6:	56                   	push   %esi
+ 7b7:	53                   	push   %ebx
+ 7b8:	8b 75 08             	mov    0x8(%ebp),%esi
+ 7bb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(oldfd != newfd)
+ 7be:	39 de                	cmp    %ebx,%esi
+ 7c0:	75 11                	jne    7d3 <dup2+0x20>
+    bufreset(newfd);
+  return _dup2(oldfd, newfd);
+ 7c2:	83 ec 08             	sub    $0x8,%esp
+ 7c5:	53                   	push   %ebx
+ 7c6:	56                   	push   %esi
+ 7c7:	e8 4c 00 00 00       	call   818 <_dup2>
+}
+ 7cc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 7cf:	5b                   	pop    %ebx
+ 7d0:	5e                   	pop    %esi
+ 7d1:	5d                   	pop    %ebp
+ 7d2:	c3                   	ret
+    bufreset(newfd);
+ 7d3:	89 d8                	mov    %ebx,%eax
+ 7d5:	e8 6e fd ff ff       	call   548 <bufreset>
+ 7da:	eb e6                	jmp    7c2 <dup2+0xf>
+
+000007dc <_fork>:
+  1: ret
+
+#define SYSCALL(name) STUB(name, SYS_ ## name)
+
+# ulib.c wraps these, to flush printf()'s buffers first.
+STUB(_fork, SYS_fork)
+ 7dc:	b8 01 00 00 00       	mov    $0x1,%eax
+ 7e1:	89 e1                	mov    %esp,%ecx
+ 7e3:	ba ea 07 00 00       	mov    $0x7ea,%edx
+ 7e8:	0f 34                	sysenter
+ 7ea:	c3                   	ret
+
+000007eb <_exit>:
+STUB(_exit, SYS_exit)
+ 7eb:	b8 02 00 00 00       	mov    $0x2,%eax
+ 7f0:	89 e1                	mov    %esp,%ecx
+ 7f2:	ba f9 07 00 00       	mov    $0x7f9,%edx
+ 7f7:	0f 34                	sysenter
+ 7f9:	c3                   	ret
+
+000007fa <_close>:
+STUB(_close, SYS_close)
+ 7fa:	b8 15 00 00 00       	mov    $0x15,%eax
+ 7ff:	89 e1                	mov    %esp,%ecx
+ 801:	ba 08 08 00 00       	mov    $0x808,%edx
+ 806:	0f 34                	sysenter
+ 808:	c3                   	ret
+
+00000809 <_exec>:
+STUB(_exec, SYS_exec)
+ 809:	b8 07 00 00 00       	mov    $0x7,%eax
+ 80e:	89 e1                	mov    %esp,%ecx
+ 810:	ba 17 08 00 00       	mov    $0x817,%edx
+ 815:	0f 34                	sysenter
+ 817:	c3                   	ret
+
+00000818 <_dup2>:
+STUB(_dup2, SYS_dup2)
+ 818:	b8 17 00 00 00       	mov    $0x17,%eax
+ 81d:	89 e1                	mov    %esp,%ecx
+ 81f:	ba 26 08 00 00       	mov    $0x826,%edx
+ 824:	0f 34                	sysenter
+ 826:	c3                   	ret
+
+00000827 <wait>:
+
+SYSCALL(wait)
+ 827:	b8 03 00 00 00       	mov    $0x3,%eax
+ 82c:	89 e1                	mov    %esp,%ecx
+ 82e:	ba 35 08 00 00       	mov    $0x835,%edx
+ 833:	0f 34                	sysenter
+ 835:	c3                   	ret
+
+00000836 <pipe>:
+SYSCALL(pipe)
+ 836:	b8 04 00 00 00       	mov    $0x4,%eax
+ 83b:	89 e1                	mov    %esp,%ecx
+ 83d:	ba 44 08 00 00       	mov    $0x844,%edx
+ 842:	0f 34                	sysenter
+ 844:	c3                   	ret
+
+00000845 <read>:
+SYSCALL(read)
+ 845:	b8 05 00 00 00       	mov    $0x5,%eax
+ 84a:	89 e1                	mov    %esp,%ecx
+ 84c:	ba 53 08 00 00       	mov    $0x853,%edx
+ 851:	0f 34                	sysenter
+ 853:	c3                   	ret
+
+00000854 <write>:
+SYSCALL(write)
+ 854:	b8 10 00 00 00       	mov    $0x10,%eax
+ 859:	89 e1                	mov    %esp,%ecx
+ 85b:	ba 62 08 00 00       	mov    $0x862,%edx
+ 860:	0f 34                	sysenter
+ 862:	c3                   	ret
+
+00000863 <kill>:
+SYSCALL(kill)
+ 863:	b8 06 00 00 00       	mov    $0x6,%eax
+ 868:	89 e1                	mov    %esp,%ecx
+ 86a:	ba 71 08 00 00       	mov    $0x871,%edx
+ 86f:	0f 34                	sysenter
+ 871:	c3                   	ret
+
+00000872 <open>:
+SYSCALL(open)
+ 872:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 877:	89 e1                	mov    %esp,%ecx
+ 879:	ba 80 08 00 00       	mov    $0x880,%edx
+ 87e:	0f 34                	sysenter
+ 880:	c3                   	ret
+
+00000881 <mknod>:
+SYSCALL(mknod)
+ 881:	b8 11 00 00 00       	mov    $0x11,%eax
+ 886:	89 e1                	mov    %esp,%ecx
+ 888:	ba 8f 08 00 00       	mov    $0x88f,%edx
+ 88d:	0f 34                	sysenter
+ 88f:	c3                   	ret
+
+00000890 <unlink>:
+SYSCALL(unlink)
+ 890:	b8 12 00 00 00       	mov    $0x12,%eax
+ 895:	89 e1                	mov    %esp,%ecx
+ 897:	ba 9e 08 00 00       	mov    $0x89e,%edx
+ 89c:	0f 34                	sysenter
+ 89e:	c3                   	ret
+
+0000089f <fstat>:
+SYSCALL(fstat)
+ 89f:	b8 08 00 00 00       	mov    $0x8,%eax
+ 8a4:	89 e1                	mov    %esp,%ecx
+ 8a6:	ba ad 08 00 00       	mov    $0x8ad,%edx
+ 8ab:	0f 34                	sysenter
+ 8ad:	c3                   	ret
+
+000008ae <link>:
+SYSCALL(link)
+ 8ae:	b8 13 00 00 00       	mov    $0x13,%eax
+ 8b3:	89 e1                	mov    %esp,%ecx
+ 8b5:	ba bc 08 00 00       	mov    $0x8bc,%edx
+ 8ba:	0f 34                	sysenter
+ 8bc:	c3                   	ret
+
+000008bd <mkdir>:
+SYSCALL(mkdir)
+ 8bd:	b8 14 00 00 00       	mov    $0x14,%eax
+ 8c2:	89 e1                	mov    %esp,%ecx
+ 8c4:	ba cb 08 00 00       	mov    $0x8cb,%edx
+ 8c9:	0f 34                	sysenter
+ 8cb:	c3                   	ret
+
+000008cc <chdir>:
+SYSCALL(chdir)
+ 8cc:	b8 09 00 00 00       	mov    $0x9,%eax
+ 8d1:	89 e1                	mov    %esp,%ecx
+ 8d3:	ba da 08 00 00       	mov    $0x8da,%edx
+ 8d8:	0f 34                	sysenter
+ 8da:	c3                   	ret
+
+000008db <dup>:
+SYSCALL(dup)
+ 8db:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 8e0:	89 e1                	mov    %esp,%ecx
+ 8e2:	ba e9 08 00 00       	mov    $0x8e9,%edx
+ 8e7:	0f 34                	sysenter
+ 8e9:	c3                   	ret
+
+000008ea <getpid>:
+SYSCALL(getpid)
+ 8ea:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 8ef:	89 e1                	mov    %esp,%ecx
+ 8f1:	ba f8 08 00 00       	mov    $0x8f8,%edx
+ 8f6:	0f 34                	sysenter
+ 8f8:	c3                   	ret
+
+000008f9 <sbrk>:
+SYSCALL(sbrk)
+ 8f9:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 8fe:	89 e1                	mov    %esp,%ecx
+ 900:	ba 07 09 00 00       	mov    $0x907,%edx
+ 905:	0f 34                	sysenter
+ 907:	c3                   	ret
+
+00000908 <sleep>:
+SYSCALL(sleep)
+ 908:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 90d:	89 e1                	mov    %esp,%ecx
+ 90f:	ba 16 09 00 00       	mov    $0x916,%edx
+ 914:	0f 34                	sysenter
+ 916:	c3                   	ret
+
+00000917 <uptime>:
+SYSCALL(uptime)
+ 917:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 91c:	89 e1                	mov    %esp,%ecx
+ 91e:	ba 25 09 00 00       	mov    $0x925,%edx
+ 923:	0f 34                	sysenter
+ 925:	c3                   	ret
+
+00000926 <date>:
+SYSCALL(date)
+ 926:	b8 16 00 00 00       	mov    $0x16,%eax
+ 92b:	89 e1                	mov    %esp,%ecx
+ 92d:	ba 34 09 00 00       	mov    $0x934,%edx
+ 932:	0f 34                	sysenter
+ 934:	c3                   	ret
+
+00000935 <faultaround>:
+SYSCALL(faultaround)
+ 935:	b8 18 00 00 00       	mov    $0x18,%eax
+ 93a:	89 e1                	mov    %esp,%ecx
+ 93c:	ba 43 09 00 00       	mov    $0x943,%edx
+ 941:	0f 34                	sysenter
+ 943:	c3                   	ret
+
+00000944 <faultstat>:
+SYSCALL(faultstat)
+ 944:	b8 19 00 00 00       	mov    $0x19,%eax
+ 949:	89 e1                	mov    %esp,%ecx
+ 94b:	ba 52 09 00 00       	mov    $0x952,%edx
+ 950:	0f 34                	sysenter
+ 952:	c3                   	ret
+
+00000953 <mmap>:
+SYSCALL(mmap)
+ 953:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 958:	89 e1                	mov    %esp,%ecx
+ 95a:	ba 61 09 00 00       	mov    $0x961,%edx
+ 95f:	0f 34                	sysenter
+ 961:	c3                   	ret
+
+00000962 <munmap>:
+SYSCALL(munmap)
+ 962:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 967:	89 e1                	mov    %esp,%ecx
+ 969:	ba 70 09 00 00       	mov    $0x970,%edx
+ 96e:	0f 34                	sysenter
+ 970:	c3                   	ret
+
+00000971 <largepages>:
+SYSCALL(largepages)
+ 971:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 976:	89 e1                	mov    %esp,%ecx
+ 978:	ba 7f 09 00 00       	mov    $0x97f,%edx
+ 97d:	0f 34                	sysenter
+ 97f:	c3                   	ret
+
+00000980 <spawn>:
+SYSCALL(spawn)
+ 980:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 985:	89 e1                	mov    %esp,%ecx
+ 987:	ba 8e 09 00 00       	mov    $0x98e,%edx
+ 98c:	0f 34                	sysenter
+ 98e:	c3                   	ret
+
+0000098f <setpriority>:
+SYSCALL(setpriority)
+ 98f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 994:	89 e1                	mov    %esp,%ecx
+ 996:	ba 9d 09 00 00       	mov    $0x99d,%edx
+ 99b:	0f 34                	sysenter
+ 99d:	c3                   	ret
+
+0000099e <getpriority>:
+SYSCALL(getpriority)
+ 99e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 9a3:	89 e1                	mov    %esp,%ecx
+ 9a5:	ba ac 09 00 00       	mov    $0x9ac,%edx
+ 9aa:	0f 34                	sysenter
+ 9ac:	c3                   	ret
+
+000009ad <getprocinfo>:
+SYSCALL(getprocinfo)
+ 9ad:	b8 20 00 00 00       	mov    $0x20,%eax
+ 9b2:	89 e1                	mov    %esp,%ecx
+ 9b4:	ba bb 09 00 00       	mov    $0x9bb,%edx
+ 9b9:	0f 34                	sysenter
+ 9bb:	c3                   	ret
+
+000009bc <getcpuinfo>:
+SYSCALL(getcpuinfo)
+ 9bc:	b8 21 00 00 00       	mov    $0x21,%eax
+ 9c1:	89 e1                	mov    %esp,%ecx
+ 9c3:	ba ca 09 00 00       	mov    $0x9ca,%edx
+ 9c8:	0f 34                	sysenter
+ 9ca:	c3                   	ret
+
+000009cb <clone>:
+SYSCALL(clone)
+ 9cb:	b8 22 00 00 00       	mov    $0x22,%eax
+ 9d0:	89 e1                	mov    %esp,%ecx
+ 9d2:	ba d9 09 00 00       	mov    $0x9d9,%edx
+ 9d7:	0f 34                	sysenter
+ 9d9:	c3                   	ret
+
+000009da <join>:
+SYSCALL(join)
+ 9da:	b8 23 00 00 00       	mov    $0x23,%eax
+ 9df:	89 e1                	mov    %esp,%ecx
+ 9e1:	ba e8 09 00 00       	mov    $0x9e8,%edx
+ 9e6:	0f 34                	sysenter
+ 9e8:	c3                   	ret
+
+000009e9 <futex_wait>:
+SYSCALL(futex_wait)
+ 9e9:	b8 24 00 00 00       	mov    $0x24,%eax
+ 9ee:	89 e1                	mov    %esp,%ecx
+ 9f0:	ba f7 09 00 00       	mov    $0x9f7,%edx
+ 9f5:	0f 34                	sysenter
+ 9f7:	c3                   	ret
+
+000009f8 <futex_wake>:
+SYSCALL(futex_wake)
+ 9f8:	b8 25 00 00 00       	mov    $0x25,%eax
+ 9fd:	89 e1                	mov    %esp,%ecx
+ 9ff:	ba 06 0a 00 00       	mov    $0xa06,%edx
+ a04:	0f 34                	sysenter
+ a06:	c3                   	ret
+
+00000a07 <setaffinity>:
+SYSCALL(setaffinity)
+ a07:	b8 26 00 00 00       	mov    $0x26,%eax
+ a0c:	89 e1                	mov    %esp,%ecx
+ a0e:	ba 15 0a 00 00       	mov    $0xa15,%edx
+ a13:	0f 34                	sysenter
+ a15:	c3                   	ret
+
+00000a16 <getaffinity>:
+SYSCALL(getaffinity)
+ a16:	b8 27 00 00 00       	mov    $0x27,%eax
+ a1b:	89 e1                	mov    %esp,%ecx
+ a1d:	ba 24 0a 00 00       	mov    $0xa24,%edx
+ a22:	0f 34                	sysenter
+ a24:	c3                   	ret
+
+00000a25 <clock_gettime>:
+SYSCALL(clock_gettime)
+ a25:	b8 28 00 00 00       	mov    $0x28,%eax
+ a2a:	89 e1                	mov    %esp,%ecx
+ a2c:	ba 33 0a 00 00       	mov    $0xa33,%edx
+ a31:	0f 34                	sysenter
+ a33:	c3                   	ret
+
+00000a34 <msleep>:
+SYSCALL(msleep)
+ a34:	b8 29 00 00 00       	mov    $0x29,%eax
+ a39:	89 e1                	mov    %esp,%ecx
+ a3b:	ba 42 0a 00 00       	mov    $0xa42,%edx
+ a40:	0f 34                	sysenter
+ a42:	c3                   	ret
+
+00000a43 <lockstat>:
+SYSCALL(lockstat)
+ a43:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ a48:	89 e1                	mov    %esp,%ecx
+ a4a:	ba 51 0a 00 00       	mov    $0xa51,%edx
+ a4f:	0f 34                	sysenter
+ a51:	c3                   	ret
+
+00000a52 <bstat>:
+SYSCALL(bstat)
+ a52:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ a57:	89 e1                	mov    %esp,%ecx
+ a59:	ba 60 0a 00 00       	mov    $0xa60,%edx
+ a5e:	0f 34                	sysenter
+ a60:	c3                   	ret
+
+00000a61 <iostat>:
+SYSCALL(iostat)
+ a61:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ a66:	89 e1                	mov    %esp,%ecx
+ a68:	ba 6f 0a 00 00       	mov    $0xa6f,%edx
+ a6d:	0f 34                	sysenter
+ a6f:	c3                   	ret
+
+00000a70 <fsync>:
+SYSCALL(fsync)
+ a70:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ a75:	89 e1                	mov    %esp,%ecx
+ a77:	ba 7e 0a 00 00       	mov    $0xa7e,%edx
+ a7c:	0f 34                	sysenter
+ a7e:	c3                   	ret
+
+00000a7f <pread>:
+SYSCALL(pread)
+ a7f:	b8 2e 00 00 00       	mov    $0x2e,%eax
+ a84:	89 e1                	mov    %esp,%ecx
+ a86:	ba 8d 0a 00 00       	mov    $0xa8d,%edx
+ a8b:	0f 34                	sysenter
+ a8d:	c3                   	ret
+
+00000a8e <pwrite>:
+SYSCALL(pwrite)
+ a8e:	b8 2f 00 00 00       	mov    $0x2f,%eax
+ a93:	89 e1                	mov    %esp,%ecx
+ a95:	ba 9c 0a 00 00       	mov    $0xa9c,%edx
+ a9a:	0f 34                	sysenter
+ a9c:	c3                   	ret
+
+00000a9d <readv>:
+SYSCALL(readv)
+ a9d:	b8 30 00 00 00       	mov    $0x30,%eax
+ aa2:	89 e1                	mov    %esp,%ecx
+ aa4:	ba ab 0a 00 00       	mov    $0xaab,%edx
+ aa9:	0f 34                	sysenter
+ aab:	c3                   	ret
+
+00000aac <writev>:
+SYSCALL(writev)
+ aac:	b8 31 00 00 00       	mov    $0x31,%eax
+ ab1:	89 e1                	mov    %esp,%ecx
+ ab3:	ba ba 0a 00 00       	mov    $0xaba,%edx
+ ab8:	0f 34                	sysenter
+ aba:	c3                   	ret
+
+00000abb <sendfile>:
+SYSCALL(sendfile)
+ abb:	b8 32 00 00 00       	mov    $0x32,%eax
+ ac0:	89 e1                	mov    %esp,%ecx
+ ac2:	ba c9 0a 00 00       	mov    $0xac9,%edx
+ ac7:	0f 34                	sysenter
+ ac9:	c3                   	ret
+
+00000aca <fcntl>:
+SYSCALL(fcntl)
+ aca:	b8 33 00 00 00       	mov    $0x33,%eax
+ acf:	89 e1                	mov    %esp,%ecx
+ ad1:	ba d8 0a 00 00       	mov    $0xad8,%edx
+ ad6:	0f 34                	sysenter
+ ad8:	c3                   	ret
+
+00000ad9 <mount>:
+SYSCALL(mount)
+ ad9:	b8 34 00 00 00       	mov    $0x34,%eax
+ ade:	89 e1                	mov    %esp,%ecx
+ ae0:	ba e7 0a 00 00       	mov    $0xae7,%edx
+ ae5:	0f 34                	sysenter
+ ae7:	c3                   	ret
+
+00000ae8 <getdents>:
+SYSCALL(getdents)
+ ae8:	b8 35 00 00 00       	mov    $0x35,%eax
+ aed:	89 e1                	mov    %esp,%ecx
+ aef:	ba f6 0a 00 00       	mov    $0xaf6,%edx
+ af4:	0f 34                	sysenter
+ af6:	c3                   	ret
+
+00000af7 <fstatat>:
+SYSCALL(fstatat)
+ af7:	b8 36 00 00 00       	mov    $0x36,%eax
+ afc:	89 e1                	mov    %esp,%ecx
+ afe:	ba 05 0b 00 00       	mov    $0xb05,%edx
+ b03:	0f 34                	sysenter
+ b05:	c3                   	ret
+
+00000b06 <sysstat>:
+SYSCALL(sysstat)
+ b06:	b8 37 00 00 00       	mov    $0x37,%eax
+ b0b:	89 e1                	mov    %esp,%ecx
+ b0d:	ba 14 0b 00 00       	mov    $0xb14,%edx
+ b12:	0f 34                	sysenter
+ b14:	c3                   	ret
+
+00000b15 <ringenter>:
+SYSCALL(ringenter)
+ b15:	b8 38 00 00 00       	mov    $0x38,%eax
+ b1a:	89 e1                	mov    %esp,%ecx
+ b1c:	ba 23 0b 00 00       	mov    $0xb23,%edx
+ b21:	0f 34                	sysenter
+ b23:	c3                   	ret
+
+00000b24 <trace>:
+SYSCALL(trace)
+ b24:	b8 39 00 00 00       	mov    $0x39,%eax
+ b29:	89 e1                	mov    %esp,%ecx
+ b2b:	ba 32 0b 00 00       	mov    $0xb32,%edx
+ b30:	0f 34                	sysenter
+ b32:	c3                   	ret
+
+00000b33 <memstat>:
+SYSCALL(memstat)
+ b33:	b8 3a 00 00 00       	mov    $0x3a,%eax
+ b38:	89 e1                	mov    %esp,%ecx
+ b3a:	ba 41 0b 00 00       	mov    $0xb41,%edx
+ b3f:	0f 34                	sysenter
+ b41:	c3                   	ret
+
+00000b42 <shmget>:
+SYSCALL(shmget)
+ b42:	b8 3b 00 00 00       	mov    $0x3b,%eax
+ b47:	89 e1                	mov    %esp,%ecx
+ b49:	ba 50 0b 00 00       	mov    $0xb50,%edx
+ b4e:	0f 34                	sysenter
+ b50:	c3                   	ret
+
+00000b51 <shmat>:
+SYSCALL(shmat)
+ b51:	b8 3c 00 00 00       	mov    $0x3c,%eax
+ b56:	89 e1                	mov    %esp,%ecx
+ b58:	ba 5f 0b 00 00       	mov    $0xb5f,%edx
+ b5d:	0f 34                	sysenter
+ b5f:	c3                   	ret
+
+00000b60 <shmdt>:
+SYSCALL(shmdt)
+ b60:	b8 3d 00 00 00       	mov    $0x3d,%eax
+ b65:	89 e1                	mov    %esp,%ecx
+ b67:	ba 6e 0b 00 00       	mov    $0xb6e,%edx
+ b6c:	0f 34                	sysenter
+ b6e:	c3                   	ret
+
+00000b6f <irqstat>:
+SYSCALL(irqstat)
+ b6f:	b8 3e 00 00 00       	mov    $0x3e,%eax
+ b74:	89 e1                	mov    %esp,%ecx
+ b76:	ba 7d 0b 00 00       	mov    $0xb7d,%edx
+ b7b:	0f 34                	sysenter
+ b7d:	c3                   	ret
+
+00000b7e <irqroute>:
+SYSCALL(irqroute)
+ b7e:	b8 3f 00 00 00       	mov    $0x3f,%eax
+ b83:	89 e1                	mov    %esp,%ecx
+ b85:	ba 8c 0b 00 00       	mov    $0xb8c,%edx
+ b8a:	0f 34                	sysenter
+ b8c:	c3                   	ret
@@ -0,0 +1,20 @@
+// free: show how much physical memory is in use and free, in KB.
+// "zeroed" is the part of the free memory already cleared for the
+// next kzalloc().
+#include "types.h"
+#include "user.h"
+#include "memstat.h"
+
+int
+main(int argc, char *argv[])
+{
+  struct memstat m;
+
+  if(memstat(&m) < 0){
+    printf(2, "free: memstat failed\n");
+    exit();
+  }
+  printf(1, "TOTAL\tUSED\tFREE\tZEROED\n");
+  printf(1, "%d\t%d\t%d\t%d\n", m.total*4, m.used*4, m.free*4, m.zero*4);
+  exit();
+}
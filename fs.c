@@ -14,15 +14,20 @@
 #include "param.h"
 #include "stat.h"
 #include "mmu.h"
-#include "proc.h"
 #include "spinlock.h"
+#include "proc.h"
+#include "slab.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
 #include "file.h"
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
+#define HDSPLITS 2   // Bucket splits one dirlink() may do
+
 static void itrunc(struct inode*);
+static uint ballocrun(uint, uint, uint, uint*);
+static int etrunc(struct inode*, uint);
 // there should be one superblock per disk device, but we run with
 // only one device
 struct superblock sb;
@@ -44,7 +49,7 @@ bzero(int dev, int bno)
 {
   struct buf *bp;
 
-  bp = bread(dev, bno);
+  bp = bclaim(dev, bno);
   memset(bp->data, 0, BSIZE);
   log_write(bp);
   brelse(bp);
@@ -52,27 +57,89 @@ bzero(int dev, int bno)
 
 // Blocks.
 
-// Allocate a zeroed disk block.
-static uint
-balloc(uint dev)
+// Free blocks under each bitmap block, and where to allocate
+// next when the caller has no better idea.  The counts change
+// only under the bitmap block's buffer lock; the search reads
+// them without it, as hints.
+static struct {
+  uint cursor;
+  uint nfree[FSSIZE/BPB + 1];
+} freemap;
+
+#define BITFREE(bp, bi) (((bp)->data[(bi)/8] & (1 << ((bi) % 8))) == 0)
+
+// Count the free blocks, once the log has been recovered.
+static void
+freecount(int dev)
 {
-  int b, bi, m;
   struct buf *bp;
+  uint b, bi;
 
-  bp = 0;
+  if(sb.size > NELEM(freemap.nfree) * BPB)
+    panic("freecount: disk too big");
   for(b = 0; b < sb.size; b += BPB){
     bp = bread(dev, BBLOCK(b, sb));
-    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
-      m = 1 << (bi % 8);
-      if((bp->data[bi/8] & m) == 0){  // Is block free?
-        bp->data[bi/8] |= m;  // Mark block in use.
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi++)
+      if(BITFREE(bp, bi))
+        freemap.nfree[b/BPB]++;
+    brelse(bp);
+  }
+  freemap.cursor = sb.swapstart + sb.nswap;  // the first data block
+}
+
+// Allocate a zeroed disk block, near goal if it is not 0.
+static uint
+balloc(uint dev, uint goal)
+{
+  uint b, n;
+
+  b = ballocrun(dev, goal, 1, &n);
+  bzero(dev, b);
+  return b;
+}
+
+// Allocate a run of up to want blocks, not zeroed: the first run
+// of that length at or after goal (or the cursor), or failing
+// that the first free blocks after it.  Bitmap blocks without
+// enough free blocks are not read.  Runs do not cross bitmap
+// blocks.  Sets *n to the length of the run.
+static uint
+ballocrun(uint dev, uint goal, uint want, uint *n)
+{
+  struct buf *bp;
+  uint b, bi, len, nb;
+  int j, pass;
+
+  if(goal == 0 || goal >= sb.size)
+    goal = freemap.cursor;
+  nb = (sb.size + BPB - 1) / BPB;
+  for(pass = 0; pass < 2; pass++){
+    for(j = 0; j <= nb; j++){
+      b = ((goal / BPB + j) % nb) * BPB;
+      if(freemap.nfree[b/BPB] < (pass == 0 ? want : 1))
+        continue;
+      bp = bread(dev, BBLOCK(b, sb));
+      for(bi = j == 0 ? goal % BPB : 0; bi < BPB && b + bi < sb.size; bi += len){
+        for(len = 0; len < want && bi + len < BPB && b + bi + len < sb.size &&
+            BITFREE(bp, bi + len); len++)
+          ;
+        if(len == 0){
+          len = 1;
+          continue;
+        }
+        if(len < want && pass == 0)
+          continue;
+        *n = len;
+        for(; len > 0; len--, bi++)
+          bp->data[bi/8] |= 1 << (bi % 8);
+        freemap.nfree[b/BPB] -= *n;
+        freemap.cursor = b + bi;
         log_write(bp);
         brelse(bp);
-        bzero(dev, b + bi);
-        return b + bi;
+        return b + bi - *n;
       }
+      brelse(bp);
     }
-    brelse(bp);
   }
   panic("balloc: out of blocks");
 }
@@ -91,6 +158,7 @@ bfree(int dev, uint b)
   if((bp->data[bi/8] & m) == 0)
     panic("freeing free block");
   bp->data[bi/8] &= ~m;
+  freemap.nfree[b/BPB]++;
   log_write(bp);
   brelse(bp);
 }
@@ -156,37 +224,131 @@ bfree(int dev, uint b)
 // multi-step atomic operations.
 //
 // The icache.lock spin-lock protects the allocation of icache
-// entries. Since ip->ref indicates whether an entry is free,
+// entries. Since ip->ref indicates whether an entry is in use,
 // and ip->dev and ip->inum indicate which i-node an entry
-// holds, one must hold icache.lock while using any of those fields.
+// holds, one must hold icache.lock while using any of those fields,
+// or the hash chain and LRU list links.
+//
+// Entries come from a slab cache and are found by hashing (dev,
+// inum).  One whose ref falls to 0 stays cached, valid, on an LRU
+// list, so that opening the file again finds it without reading
+// the dinode; up to NINODE of those are kept, and the least
+// recently used one is recycled when there are more.
 //
 // An ip->lock sleep-lock protects all ip-> fields other than ref,
 // dev, and inum.  One must hold ip->lock in order to
 // read or write that inode's ip->valid, ip->size, ip->type, &c.
 
+#define NIHASH 61
+#define IHASH(dev, inum) (((dev)*31 + (inum)) % NIHASH)
+
 struct {
   struct spinlock lock;
-  struct inode inode[NINODE];
+  struct slabcache cache;
+  struct inode *hash[NIHASH];
+  // Unreferenced inodes, through lprev/lnext.
+  // head.lnext is the most recently used.
+  struct inode head;
+  int nlru;
 } icache;
 
+// Delayed allocation.  A block appended to a regular file is not
+// given a disk block when written: writei() keeps it in a block of
+// memory of the inode's, until NDELAY of them are waiting, fsync()
+// wants them, or they have waited IFLUSHWAIT for the inode flusher.
+// iflush() then allocates them one contiguous run, writes them
+// there directly, not through the log, and only then logs the
+// extents and size that make them part of the file.
+#define IFLUSHWAIT 1000000000ULL  // ns
+
+static struct slabcache dblkcache;
+
+// Inodes with delayed blocks, through dnext; each holds a reference
+// for the flusher.
+static struct {
+  struct spinlock lock;
+  struct inode *head;
+} dlist;
+
+static void iflusher(void);
+
+// Reclaiming.  iput() leaves the blocks of a big file that has gone
+// (no links, no references) to a kernel thread, which frees them a
+// bounded batch per transaction, from the end, so the caller does
+// not wait for them all.  Such an orphan is found again after a
+// crash: on disk it is an inode with a type but no links, which
+// iinit() looks for.  Inodes to reclaim are on reclaim, through
+// dnext, each with the reference iput() did not drop.
+static struct {
+  struct spinlock lock;
+  struct inode *head;
+} reclaim;
+
+static void ireclaimer(void);
+static struct inode* iget(uint dev, uint inum);
+
+// Mount table.  namex() goes from a mount point mp to the root of
+// the file system dev mounted on it, and from that root back to mp
+// for "..".  Each mp keeps the reference fsmount() was given, so
+// its icache entry stays, and can be told by its address.
+static struct {
+  struct spinlock lock;
+  struct {
+    struct inode *mp;
+    uint dev;
+  } m[NMOUNT];
+} mtab;
+
 void
-iinit(int dev)
+icacheinit(void)
 {
-  int i = 0;
-
   initlock(&icache.lock, "icache");
-  for(i = 0; i < NINODE; i++) {
-    initsleeplock(&icache.inode[i].lock, "inode");
-  }
+  slabinit(&icache.cache, "inode", sizeof(struct inode));
+  slabinit(&dblkcache, "dblk", BSIZE);
+  initlock(&dlist.lock, "dlist");
+  initlock(&reclaim.lock, "reclaim");
+  initlock(&mtab.lock, "mtab");
+  icache.head.lprev = &icache.head;
+  icache.head.lnext = &icache.head;
+}
+
+static void
+reclaimadd(struct inode *ip)
+{
+  acquire(&reclaim.lock);
+  ip->dnext = reclaim.head;
+  reclaim.head = ip;
+  wakeup(&reclaim);
+  release(&reclaim.lock);
+}
+
+void
+iinit(int dev)
+{
+  struct dinode *dip;
+  struct buf *bp;
+  uint inum;
 
   readsb(dev, &sb);
   cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
  inodestart %d bmap start %d\n", sb.size, sb.nblocks,
           sb.ninodes, sb.nlog, sb.logstart, sb.inodestart,
           sb.bmapstart);
-}
+  freecount(dev);
+  kthread("iflush", iflusher);
 
-static struct inode* iget(uint dev, uint inum);
+  // Orphans left by a crash.
+  for(inum = 1; inum < sb.ninodes; inum++){
+    bp = bread(dev, IBLOCK(inum, sb));
+    dip = (struct dinode*)bp->data + inum%IPB;
+    if(dip->type != 0 && dip->nlink == 0){
+      cprintf("iinit: reclaiming orphan inode %d\n", inum);
+      reclaimadd(iget(dev, inum));
+    }
+    brelse(bp);
+  }
+  kthread("reclaim", ireclaimer);
+}
 
 //PAGEBREAK!
 // Allocate an inode on device dev.
@@ -199,12 +361,19 @@ ialloc(uint dev, short type)
   struct buf *bp;
   struct dinode *dip;
 
+  if(dev == TMPDEV){
+    if((inum = tmpialloc(type)) == 0)
+      return 0;
+    return iget(dev, inum);
+  }
   for(inum = 1; inum < sb.ninodes; inum++){
     bp = bread(dev, IBLOCK(inum, sb));
     dip = (struct dinode*)bp->data + inum%IPB;
     if(dip->type == 0){  // a free inode
       memset(dip, 0, sizeof(*dip));
       dip->type = type;
+      if(type == T_FILE)
+        dip->flags = I_INLINE;   // until it outgrows addrs[]
       log_write(bp);   // mark it allocated on the disk
       brelse(bp);
       return iget(dev, inum);
@@ -224,49 +393,89 @@ iupdate(struct inode *ip)
   struct buf *bp;
   struct dinode *dip;
 
+  if(ip->dev == TMPDEV){
+    tmpiupdate(ip);
+    return;
+  }
   bp = bread(ip->dev, IBLOCK(ip->inum, sb));
   dip = (struct dinode*)bp->data + ip->inum%IPB;
   dip->type = ip->type;
+  dip->flags = ip->flags;
   dip->major = ip->major;
   dip->minor = ip->minor;
   dip->nlink = ip->nlink;
   dip->size = ip->size;
+  // The disk has no blocks yet for delayed ones.
+  if(ip->ndelay > 0 && ip->size > ip->dfirst*BSIZE)
+    dip->size = ip->dfirst*BSIZE;
   memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
   log_write(bp);
   brelse(bp);
 }
 
+static void
+ihashdel(struct inode *ip)
+{
+  struct inode **pp;
+
+  for(pp = &icache.hash[IHASH(ip->dev, ip->inum)]; *pp != ip; pp = &(*pp)->hnext)
+    ;
+  *pp = ip->hnext;
+}
+
+static void
+lrudel(struct inode *ip)
+{
+  ip->lnext->lprev = ip->lprev;
+  ip->lprev->lnext = ip->lnext;
+  icache.nlru--;
+}
+
 // Find the inode with number inum on device dev
 // and return the in-memory copy. Does not lock
 // the inode and does not read it from disk.
 static struct inode*
 iget(uint dev, uint inum)
 {
-  struct inode *ip, *empty;
+  struct inode *ip;
 
   acquire(&icache.lock);
 
   // Is the inode already cached?
-  empty = 0;
-  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
-    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
-      ip->ref++;
+  for(ip = icache.hash[IHASH(dev, inum)]; ip; ip = ip->hnext){
+    if(ip->dev == dev && ip->inum == inum){
+      if(ip->ref++ == 0)
+        lrudel(ip);
       release(&icache.lock);
       return ip;
     }
-    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
-      empty = ip;
   }
 
-  // Recycle an inode cache entry.
-  if(empty == 0)
-    panic("iget: no inodes");
-
-  ip = empty;
+  // Allocate a new entry, or recycle the least recently used.
+  ip = 0;
+  if(icache.nlru < NINODE)
+    ip = slaballoc(&icache.cache);
+  if(ip){
+    initsleeplock(&ip->lock, "inode");
+    initlock(&ip->maplock, "inodemap");
+  } else {
+    ip = icache.head.lprev;
+    if(ip == &icache.head)
+      panic("iget: no inodes");
+    lrudel(ip);
+    ihashdel(ip);
+    pcinval(ip);
+  }
   ip->dev = dev;
   ip->inum = inum;
   ip->ref = 1;
   ip->valid = 0;
+  ip->ranext = ip->raend = 0;
+  ip->maplen = 0;
+  ip->ndelay = 0;
+  ip->npcache = 0;
+  ip->hnext = icache.hash[IHASH(dev, inum)];
+  icache.hash[IHASH(dev, inum)] = ip;
   release(&icache.lock);
 
   return ip;
@@ -296,10 +505,15 @@ ilock(struct inode *ip)
 
   acquiresleep(&ip->lock);
 
+  if(ip->valid == 0 && ip->dev == TMPDEV){
+    tmpiread(ip);
+    ip->valid = 1;
+  }
   if(ip->valid == 0){
     bp = bread(ip->dev, IBLOCK(ip->inum, sb));
     dip = (struct dinode*)bp->data + ip->inum%IPB;
     ip->type = dip->type;
+    ip->flags = dip->flags;
     ip->major = dip->major;
     ip->minor = dip->minor;
     ip->nlink = dip->nlink;
@@ -312,11 +526,30 @@ ilock(struct inode *ip)
   }
 }
 
-// Unlock the given inode.
+// Lock the given inode shared with other readers, for a caller
+// that only reads it: readi(), stati(), dirlookup().  Unlock with
+// iunlock().
+void
+ilockshared(struct inode *ip)
+{
+  if(ip == 0 || ip->ref < 1)
+    panic("ilockshared");
+
+  acquiresleepshared(&ip->lock);
+  if(ip->valid == 0){
+    // Reading it in from disk writes *ip: do that exclusive.
+    releasesleep(&ip->lock);
+    ilock(ip);
+    downgradesleep(&ip->lock);
+  }
+}
+
+// Unlock the given inode, locked by either ilock() or
+// ilockshared().
 void
 iunlock(struct inode *ip)
 {
-  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+  if(ip == 0 || !heldsleep(&ip->lock) || ip->ref < 1)
     panic("iunlock");
 
   releasesleep(&ip->lock);
@@ -339,16 +572,44 @@ iput(struct inode *ip)
     release(&icache.lock);
     if(r == 1){
       // inode has no links and no other references: truncate and free.
+      if(ip->type == T_DIR)
+        dcachepurge(ip->dev, ip->inum);
+      if(ip->dev != TMPDEV && (ip->size + BSIZE - 1) / BSIZE > NRECLAIM){
+        // Big: the reclaimer gets it, and this reference.
+        releasesleep(&ip->lock);
+        reclaimadd(ip);
+        return;
+      }
       itrunc(ip);
       ip->type = 0;
       iupdate(ip);
       ip->valid = 0;
     }
+  } else if(ip->valid && (ip->flags & I_EXTENT)){
+    acquire(&icache.lock);
+    int r = ip->ref;
+    release(&icache.lock);
+    // Last reference: give back the blocks allocated ahead.
+    if(r == 1 && etrunc(ip, (ip->size + BSIZE - 1) / BSIZE))
+      iupdate(ip);
   }
   releasesleep(&ip->lock);
 
   acquire(&icache.lock);
-  ip->ref--;
+  if(--ip->ref == 0){
+    if(ip->valid){
+      // Keep it cached for the next iget().
+      ip->lnext = icache.head.lnext;
+      ip->lprev = &icache.head;
+      icache.head.lnext->lprev = ip;
+      icache.head.lnext = ip;
+      icache.nlru++;
+    } else {
+      ihashdel(ip);
+      pcinval(ip);
+      slabfree(&icache.cache, ip);
+    }
+  }
   release(&icache.lock);
 }
 
@@ -420,16 +681,270 @@ iunlockput(struct inode *ip)
 ***********************************************************************************************************************************************/
 
 
+// Look file block bn up in ip's cached run.
+static int
+mapget(struct inode *ip, uint bn, uint *addr)
+{
+  int hit;
+
+  acquire(&ip->maplock);
+  hit = bn - ip->mapbn < ip->maplen;
+  if(hit)
+    *addr = ip->mapaddr + bn - ip->mapbn;
+  release(&ip->maplock);
+  return hit;
+}
+
+// Cache the run of len blocks of ip from file block bn at addr.
+static void
+mapset(struct inode *ip, uint bn, uint addr, uint len)
+{
+  acquire(&ip->maplock);
+  ip->mapbn = bn;
+  ip->mapaddr = addr;
+  ip->maplen = len;
+  release(&ip->maplock);
+}
+
+// Blocks of ip are being freed: forget the cached run.
+static void
+mapinval(struct inode *ip)
+{
+  mapset(ip, 0, 0, 0);
+}
+
+// Extent slot i of ip: in the inode, or in the extent block bp.
+static struct extent*
+extent(struct inode *ip, struct buf *bp, int i)
+{
+  if(i < NEXTENT)
+    return (struct extent*)ip->addrs + i;
+  return (struct extent*)bp->data + i - NEXTENT;
+}
+
+// Allocate up to want blocks at the end of extent-mapped ip, in
+// one run, after its last block if possible, and add them to its
+// extents.  Returns the first block and sets *n, or returns 0 if
+// ip is out of extents.
+static uint
+eextend(struct inode *ip, uint want, uint *n)
+{
+  struct extent *e, *last;
+  struct buf *bp;
+  uint addr;
+  int i;
+
+  bp = 0;
+  last = 0;
+  for(i = 0; i < NEXTENT + NXEXTENT; i++){
+    if(i == NEXTENT){
+      if(ip->addrs[XBLOCK] == 0)
+        break;
+      bp = bread(ip->dev, ip->addrs[XBLOCK]);
+    }
+    e = extent(ip, bp, i);
+    if(e->len == 0)
+      break;
+    last = e;
+  }
+
+  addr = ballocrun(ip->dev, last ? last->start + last->len : 0, want, n);
+  if(last && last->start + last->len == addr){
+    e = last;
+    e->len += *n;
+  } else if(i < NEXTENT + NXEXTENT){
+    if(i == NEXTENT){
+      ip->addrs[XBLOCK] = balloc(ip->dev, addr + *n);
+      bp = bread(ip->dev, ip->addrs[XBLOCK]);
+    }
+    e = extent(ip, bp, i);
+    e->start = addr;
+    e->len = *n;
+  } else {
+    while((*n)-- > 0)
+      bfree(ip->dev, addr + *n);
+    brelse(bp);
+    return 0;
+  }
+  if(bp && (uchar*)e >= bp->data && (uchar*)e < bp->data + BSIZE)
+    log_write(bp);
+  if(bp)
+    brelse(bp);
+  return addr;
+}
+
+// Is block bn of extent-mapped ip allocated?
+static int
+eallocated(struct inode *ip, uint bn)
+{
+  struct extent *e;
+  struct buf *bp;
+  uint lbn, addr;
+  int i, r;
+
+  if(mapget(ip, bn, &addr))
+    return 1;
+  bp = 0;
+  lbn = 0;
+  r = 0;
+  for(i = 0; i < NEXTENT + NXEXTENT; i++){
+    if(i == NEXTENT){
+      if(ip->addrs[XBLOCK] == 0)
+        break;
+      bp = bread(ip->dev, ip->addrs[XBLOCK]);
+    }
+    e = extent(ip, bp, i);
+    if(e->len == 0)
+      break;
+    lbn += e->len;
+    if(bn < lbn){
+      r = 1;
+      break;
+    }
+  }
+  if(bp)
+    brelse(bp);
+  return r;
+}
+
+// The number of extent slots ip has left.
+static uint
+eroom(struct inode *ip)
+{
+  struct buf *bp;
+  int i;
+
+  bp = 0;
+  for(i = 0; i < NEXTENT + NXEXTENT; i++){
+    if(i == NEXTENT){
+      if(ip->addrs[XBLOCK] == 0)
+        break;
+      bp = bread(ip->dev, ip->addrs[XBLOCK]);
+    }
+    if(extent(ip, bp, i)->len == 0)
+      break;
+  }
+  if(bp)
+    brelse(bp);
+  return NEXTENT + NXEXTENT - i;
+}
+
+// bmap() for an extent-mapped file.  Blocks are only added at the
+// end, a run at a time: as many as the file has already, up to
+// NEXTRUN, so that even a big file needs few extents.  Whatever
+// lies past the end goes back when the last reference does (see
+// iput).  A block handed out past the end is zeroed.  Returns 0
+// when the extents are used up.
+static uint
+emap(struct inode *ip, uint bn)
+{
+  struct extent *e;
+  struct buf *bp;
+  uint lbn, addr, n, want;
+  int i;
+
+  bp = 0;
+  lbn = 0;
+  for(i = 0; i < NEXTENT + NXEXTENT; i++){
+    if(i == NEXTENT){
+      if(ip->addrs[XBLOCK] == 0)
+        break;
+      bp = bread(ip->dev, ip->addrs[XBLOCK]);
+    }
+    e = extent(ip, bp, i);
+    if(e->len == 0)
+      break;
+    if(bn < lbn + e->len){
+      addr = e->start + bn - lbn;
+      mapset(ip, lbn, e->start, e->len);
+      goto found;
+    }
+    lbn += e->len;
+  }
+
+  if(bp)
+    brelse(bp);
+  if(bn != lbn)
+    panic("emap: hole");
+  want = lbn == 0 ? 1 : min(lbn, NEXTRUN);
+  if((addr = eextend(ip, want, &n)) == 0)
+    return 0;
+  bp = 0;
+
+found:
+  if(bp)
+    brelse(bp);
+  if(bn >= (ip->size + BSIZE - 1) / BSIZE)
+    bzero(ip->dev, addr);
+  return addr;
+}
+
+// Free the blocks of extent-mapped ip from block nblk of the file
+// on.  Returns 1 if there were any.
+static int
+etrunc(struct inode *ip, uint nblk)
+{
+  struct extent *e;
+  struct buf *bp;
+  uint lbn, keep, b;
+  int i, dirty;
+
+  mapinval(ip);
+  bp = 0;
+  if(ip->addrs[XBLOCK])
+    bp = bread(ip->dev, ip->addrs[XBLOCK]);
+  lbn = 0;
+  dirty = 0;
+  for(i = 0; i < NEXTENT + NXEXTENT; i++){
+    if(i == NEXTENT && bp == 0)
+      break;
+    e = extent(ip, bp, i);
+    if(e->len == 0)
+      break;
+    keep = lbn >= nblk ? 0 : min(e->len, nblk - lbn);
+    lbn += e->len;
+    if(keep == e->len)
+      continue;
+    for(b = keep; b < e->len; b++)
+      bfree(ip->dev, e->start + b);
+    e->len = keep;
+    if(keep == 0)
+      e->start = 0;
+    dirty |= i < NEXTENT ? 1 : 2;
+  }
+  if(bp){
+    if(extent(ip, bp, NEXTENT)->len == 0){
+      brelse(bp);
+      bfree(ip->dev, ip->addrs[XBLOCK]);
+      ip->addrs[XBLOCK] = 0;
+      return 1;
+    }
+    if(dirty & 2)
+      log_write(bp);
+    brelse(bp);
+  }
+  return dirty != 0;
+}
+
 static uint
 bmap(struct inode *ip, uint bn) //La numeración de los bloques empieza desde 0
 {
-  uint addr, *a;		
+  uint addr, *a, n;
   struct buf *bp;
 
+  // Past the direct blocks, try the last run translated first.
+  if((bn >= NDIRECT || (ip->flags & I_EXTENT)) && mapget(ip, bn, &addr)){
+    if((ip->flags & I_EXTENT) && bn >= (ip->size + BSIZE - 1) / BSIZE)
+      bzero(ip->dev, addr);   // as emap() does for blocks past EOF
+    return addr;
+  }
+  if(ip->flags & I_EXTENT)
+    return emap(ip, bn);
+
 /***********************Busqueda bloques directos ***************************/
   if(bn < NDIRECT){  //¿El bloque que queremos buscar está uno de los directos del nodo-i?
     if((addr = ip->addrs[bn]) == 0)  //Si no hay bloque, se reserva espacio para él y se retorna la dirección que la función balloc devuelve
-      ip->addrs[bn] = addr = balloc(ip->dev);
+      ip->addrs[bn] = addr = balloc(ip->dev, bn > 0 ? ip->addrs[bn-1] + 1 : 0);
     return addr;
   }
   bn -= NDIRECT;  //El bloque a buscar no está en los bloques directos del nodo-i.
@@ -443,7 +958,7 @@ bmap(struct inode *ip, uint bn) //La numeración de los bloques empieza desde 0
     // Load indirect block, allocating if necessary.
     if ((addr = ip->addrs[NDIRECT]) == 0) { /*Si no hay bloque, se reserva espacio para él y almancenaos la dirección que
 					    devuelve balloc al reservar*/
-      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+      ip->addrs[NDIRECT] = addr = balloc(ip->dev, ip->addrs[NDIRECT-1] + 1);
     }
 
 
@@ -458,10 +973,14 @@ bmap(struct inode *ip, uint bn) //La numeración de los bloques empieza desde 0
     if ((addr = a[bn]) == 0) /*Buscamos dentro del array si está el bloque bn y almacenamos su dirección en addr.
 			       Si no existe tal bloque, se crea*/
     {
-      a[bn] = addr = balloc(ip->dev); 
+      a[bn] = addr = balloc(ip->dev, bn > 0 ? a[bn-1] + 1 : ip->addrs[NDIRECT] + 1);
       log_write(bp); /*Es necesario llamar a esta función ya que hemos modificado el array "a" (es decir, bp->data)
 		     y ya hemos terminado con el buffer*/ 
     }
+    // Remember how far the blocks from here on are contiguous.
+    for(n = 1; bn + n < NINDIRECT && a[bn+n] == addr + n; n++)
+      ;
+    mapset(ip, NDIRECT + bn, addr, n);
     brelse(bp); //Libera el buffer (el acceso en exclusión mutua)
     return addr;
   }
@@ -480,7 +999,7 @@ bmap(struct inode *ip, uint bn) //La numeración de los bloques empieza desde 0
 				  //Es, luego a luego, repetir los mismos pasos tantas veces como a bloques indirectos se accedan.
   	
 	 if ((addr = ip->addrs[NDIRECT+1]) == 0) {
-		 ip->addrs[NDIRECT+1] = addr = balloc(ip->dev);
+		 ip->addrs[NDIRECT+1] = addr = balloc(ip->dev, 0);
 	 }
 	
 	 int posBSI = bn%NINDIRECT; //Para calcular la posición dentro del BSI
@@ -492,7 +1011,7 @@ bmap(struct inode *ip, uint bn) //La numeración de los bloques empieza desde 0
 
    	 if ((addr = a[bn]) == 0)
    	 {
-     		 a[bn] = addr = balloc(ip->dev);
+     		 a[bn] = addr = balloc(ip->dev, ip->addrs[NDIRECT+1] + 1);
      		 log_write(bp);
    	 }
 
@@ -504,9 +1023,12 @@ bmap(struct inode *ip, uint bn) //La numeración de los bloques empieza desde 0
 
 	 if ((addr = a[posBSI]) == 0)
 	 {
-		 a[posBSI] = addr = balloc(ip->dev);
+		 a[posBSI] = addr = balloc(ip->dev, posBSI > 0 ? a[posBSI-1] + 1 : bp->blockno + 1);
 		 log_write(bp);
 	 }
+	 for(n = 1; posBSI + n < NINDIRECT && a[posBSI+n] == addr + n; n++)
+	   ;
+	 mapset(ip, NDIRECT + NINDIRECT + bn*NINDIRECT + posBSI, addr, n);
 	 brelse(bp);
    	 return addr;
 
@@ -527,6 +1049,26 @@ itrunc(struct inode *ip)
   int i, j;
   struct buf *bp;
   uint *a;
+
+  textinval(ip);
+  mapinval(ip);
+  pcinval(ip);
+  if(ip->dev == TMPDEV){
+    tmpitrunc(ip);
+    return;
+  }
+  if(ip->flags & I_INLINE){
+    memset(ip->addrs, 0, sizeof(ip->addrs));
+    ip->size = 0;
+    iupdate(ip);
+    return;
+  }
+  if(ip->flags & I_EXTENT){
+    etrunc(ip, 0);
+    ip->size = 0;
+    iupdate(ip);
+    return;
+  }
 /***********************Borrado de los bloques directos ***************************/
   for(i = 0; i < NDIRECT; i++){ //Por cada bloque directo...
     if(ip->addrs[i]){ //Si existe...
@@ -586,6 +1128,86 @@ itrunc(struct inode *ip)
   iupdate(ip);
 }
 
+// Free a batch of ip's blocks from the end, for the reclaimer:
+// an extent-mapped file's last NRECLAIM, a block-mapped one's last
+// double-indirect leaf and the blocks it maps, or, once neither is
+// left, everything.  Returns 1 while there are blocks left.
+// Caller holds ip->lock, in a transaction.
+static int
+itruncstep(struct inode *ip)
+{
+  struct buf *bp, *lp;
+  uint nblk, i, j, *a, *b;
+
+  if(ip->flags & I_EXTENT){
+    textinval(ip);
+    nblk = (ip->size + BSIZE - 1) / BSIZE;
+    nblk = nblk > NRECLAIM ? nblk - NRECLAIM : 0;
+    etrunc(ip, nblk);
+    ip->size = min(ip->size, nblk*BSIZE);
+    iupdate(ip);
+    return nblk > 0;
+  }
+  if((ip->flags & I_INLINE) || ip->addrs[NDIRECT+1] == 0){
+    itrunc(ip);
+    return 0;
+  }
+
+  textinval(ip);
+  mapinval(ip);
+  bp = bread(ip->dev, ip->addrs[NDIRECT+1]);
+  a = (uint*)bp->data;
+  for(i = NINDIRECT; i > 0 && a[i-1] == 0; i--)
+    ;
+  if(i > 0){
+    lp = bread(ip->dev, a[i-1]);
+    b = (uint*)lp->data;
+    for(j = 0; j < NINDIRECT; j++)
+      if(b[j])
+        bfree(ip->dev, b[j]);
+    brelse(lp);
+    bfree(ip->dev, a[--i]);
+    a[i] = 0;
+    log_write(bp);
+  }
+  brelse(bp);
+  if(i == 0){
+    bfree(ip->dev, ip->addrs[NDIRECT+1]);
+    ip->addrs[NDIRECT+1] = 0;
+  }
+  ip->size = min(ip->size, (NDIRECT + NINDIRECT + i*NINDIRECT)*BSIZE);
+  iupdate(ip);
+  return 1;
+}
+
+// The reclaimer: truncate each inode on reclaim a batch at a time,
+// then let iput() free it.
+static void
+ireclaimer(void)
+{
+  struct inode *ip;
+  int more;
+
+  for(;;){
+    acquire(&reclaim.lock);
+    while((ip = reclaim.head) == 0)
+      sleep(&reclaim, &reclaim.lock);
+    reclaim.head = ip->dnext;
+    release(&reclaim.lock);
+
+    do {
+      begin_op();
+      ilock(ip);
+      more = itruncstep(ip);
+      iunlock(ip);
+      end_op();
+    } while(more);
+    begin_op();
+    iput(ip);
+    end_op();
+  }
+}
+
 // Copy stat information from inode.
 // Caller must hold ip->lock.
 void
@@ -598,14 +1220,229 @@ stati(struct inode *ip, struct stat *st)
   st->size = ip->size;
 }
 
+// A read of blocks first..last has just been done.  If it took up
+// where the last one left off, or started the file, keep the disk
+// NREADAHEAD blocks ahead of the reader with read-aheads.
+static void
+readahead(struct inode *ip, uint first, uint last)
+{
+  uint bn, end, nblk;
+
+  if(first != ip->ranext && first != 0){
+    ip->ranext = last + 1;
+    return;
+  }
+  ip->ranext = last + 1;
+  nblk = (ip->size + BSIZE - 1) / BSIZE;
+  if(ip->ndelay > 0)
+    nblk = min(nblk, ip->dfirst);   // the rest are in memory
+  end = min(last + 1 + NREADAHEAD, nblk);
+  if((bn = ip->raend) < last + 1 || bn > end)
+    bn = last + 1;
+  for(; bn < end; bn++)
+    bprefetch(ip->dev, bmap(ip, bn));
+  ip->raend = end;
+}
+
+// The memory block holding delayed block bn of ip, or 0 if bn is not
+// delayed.
+static uchar*
+idelayed(struct inode *ip, uint bn)
+{
+  if(bn - ip->dfirst < ip->ndelay)
+    return ip->dblk[bn - ip->dfirst];
+  return 0;
+}
+
+// Block bn of ip is about to be written.  Returns the memory block
+// to write it in if it is, or is now, delayed, or 0 if it is to be
+// written through bmap(): ip is not a regular file, bn is already
+// on the disk, there is no memory, or ip has too few extent slots
+// left.  Each delayed block may need a slot of its own, on a
+// fragmented disk, so that a write with no room fails in writei(),
+// never later in iflush().
+static uchar*
+idelay(struct inode *ip, uint bn)
+{
+  uchar *d;
+
+  if((ip->flags & I_EXTENT) == 0)
+    return 0;
+  if((d = idelayed(ip, bn)) != 0)
+    return d;
+  if(ip->ndelay > 0 && bn < ip->dfirst)
+    return 0;
+  if(ip->ndelay == NDELAY)
+    iflush(ip);
+  if(eroom(ip) <= ip->ndelay){
+    iflush(ip);
+    return 0;
+  }
+  if(ip->ndelay == 0){
+    if(eallocated(ip, bn))
+      return 0;
+    ip->dfirst = bn;
+  }
+  if(bn != ip->dfirst + ip->ndelay)
+    panic("idelay");
+  if((d = slaballoc(&dblkcache)) == 0){
+    iflush(ip);
+    return 0;
+  }
+  memset(d, 0, BSIZE);
+  ip->dblk[ip->ndelay++] = d;
+  if(ip->ndelay == 1){
+    acquire(&dlist.lock);
+    if(!ip->dlisted){
+      ip->dlisted = 1;
+      ip->dnext = dlist.head;
+      dlist.head = idup(ip);
+    }
+    release(&dlist.lock);
+  }
+  return d;
+}
+
+// Give the delayed blocks of ip disk blocks, in as few runs as the
+// free space allows, and write them there.  The caller holds
+// ip->lock and is in a transaction, which gets the bitmap, extent
+// and inode updates.  Each block is written directly, unless the
+// open transaction has it from before it was freed.
+void
+iflush(struct inode *ip)
+{
+  struct buf *bs[NCLUSTER], *bp;
+  uint addr, got, n, k;
+  int nb;
+
+  if(ip->ndelay == 0)
+    return;
+  for(got = 0; got < ip->ndelay; got += n){
+    if((addr = eextend(ip, ip->ndelay - got, &n)) == 0)
+      panic("iflush: out of extents");  // idelay() left room
+    nb = 0;
+    for(k = 0; k < n; k++){
+      if(log_claim(addr + k)){
+        bp = bclaim(ip->dev, addr + k);
+        memmove(bp->data, ip->dblk[got+k], BSIZE);
+        log_write(bp);
+        brelse(bp);
+      } else {
+        bp = bs[nb++] = bclaim(ip->dev, addr + k);
+        memmove(bp->data, ip->dblk[got+k], BSIZE);
+      }
+      if(nb == NCLUSTER || (k == n-1 && nb > 0)){
+        bwritev(bs, nb);
+        while(nb > 0)
+          brelse(bs[--nb]);
+      }
+    }
+  }
+  for(k = 0; k < ip->ndelay; k++)
+    slabfree(&dblkcache, ip->dblk[k]);
+  ip->ndelay = 0;
+  iupdate(ip);
+}
+
+// The inode flusher: every IFLUSHWAIT, flush the inodes on dlist.
+static void
+iflusher(void)
+{
+  struct inode *ip;
+
+  for(;;){
+    timersleep(nanotime() + IFLUSHWAIT);
+    acquire(&dlist.lock);
+    while((ip = dlist.head) != 0){
+      dlist.head = ip->dnext;
+      ip->dlisted = 0;
+      release(&dlist.lock);
+      begin_op();
+      ilock(ip);
+      iflush(ip);
+      iunlock(ip);
+      iput(ip);
+      end_op();
+      acquire(&dlist.lock);
+    }
+    release(&dlist.lock);
+  }
+}
+
+// ip is an inline file about to outgrow addrs[]: make it an
+// extent-mapped one, with the same data.
+static void
+unline(struct inode *ip)
+{
+  char data[NINLINE];
+  uint n;
+
+  n = ip->size;
+  memmove(data, ip->addrs, n);
+  memset(ip->addrs, 0, sizeof(ip->addrs));
+  ip->flags = (ip->flags & ~I_INLINE) | I_EXTENT;
+  ip->size = 0;
+  mapinval(ip);
+  if(n > 0 && writei(ip, data, 0, n) != n)
+    panic("unline");
+  iupdate(ip);
+}
+
+// Read page pn of regular file ip in from the disk into page.
+static void
+readpage(struct inode *ip, uint pn, char *page)
+{
+  uint bn, i, nblk;
+  struct buf *bp;
+  uchar *d;
+
+  nblk = (ip->size + BSIZE - 1) / BSIZE;
+  bn = pn * (PGSIZE/BSIZE);
+  for(i = 0; i < PGSIZE/BSIZE && bn + i < nblk; i++)
+    if(idelayed(ip, bn + i) == 0)
+      bprefetch(ip->dev, bmap(ip, bn + i));
+  for(i = 0; i < PGSIZE/BSIZE && bn + i < nblk; i++){
+    if((d = idelayed(ip, bn + i)) != 0){
+      memmove(page + i*BSIZE, d, BSIZE);
+      continue;
+    }
+    bp = bread(ip->dev, bmap(ip, bn + i));
+    memmove(page + i*BSIZE, bp->data, BSIZE);
+    bdrop(bp);
+  }
+  memset(page + i*BSIZE, 0, PGSIZE - i*BSIZE);
+}
+
+// Copy n bytes of ip from off, all in one page, out of the page
+// cache, reading the page in, and setting *miss, if it is not
+// there.  Returns -1 if there is no memory for it.
+static int
+readcached(struct inode *ip, char *dst, uint off, uint n, int *miss)
+{
+  char *page;
+
+  if((page = pcget(ip, off/PGSIZE)) == 0){
+    if((page = kalloc()) == 0)
+      return -1;
+    readpage(ip, off/PGSIZE, page);
+    page = pcadd(ip, off/PGSIZE, page);
+    *miss = 1;
+  }
+  memmove(dst, page + off%PGSIZE, n);
+  kfree(page);
+  return 0;
+}
+
 //PAGEBREAK!
 // Read data from inode.
 // Caller must hold ip->lock.
 int
 readi(struct inode *ip, char *dst, uint off, uint n)
 {
-  uint tot, m;
+  uint tot, m, first;
   struct buf *bp;
+  uchar *d;
+  int miss;
 
   if(ip->type == T_DEV){
     if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
@@ -617,13 +1454,34 @@ readi(struct inode *ip, char *dst, uint off, uint n)
     return -1;
   if(off + n > ip->size)
     n = ip->size - off;
+  if(ip->dev == TMPDEV)
+    return tmpreadi(ip, dst, off, n);
+  if(ip->flags & I_INLINE){
+    memmove(dst, (char*)ip->addrs + off, n);
+    return n;
+  }
 
+  first = off/BSIZE;
+  miss = 0;
   for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    if(ip->type == T_FILE){
+      m = min(n - tot, PGSIZE - off%PGSIZE);
+      if(readcached(ip, dst, off, m, &miss) == 0)
+        continue;
+    }
+    miss = 1;
     m = min(n - tot, BSIZE - off%BSIZE);
+    if((d = idelayed(ip, off/BSIZE)) != 0){
+      memmove(dst, d + off%BSIZE, m);
+      continue;
+    }
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
     memmove(dst, bp->data + off%BSIZE, m);
     brelse(bp);
   }
+  // Only worth it while reading the disk.
+  if(n > 0 && miss)
+    readahead(ip, first, (off-1)/BSIZE);
   return n;
 }
 
@@ -633,8 +1491,9 @@ readi(struct inode *ip, char *dst, uint off, uint n)
 int
 writei(struct inode *ip, char *src, uint off, uint n)
 {
-  uint tot, m;
+  uint tot, m, addr;
   struct buf *bp;
+  uchar *d;
 
   if(ip->type == T_DEV){
     if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
@@ -646,20 +1505,42 @@ writei(struct inode *ip, char *src, uint off, uint n)
     return -1;
   if(off + n > MAXFILE*BSIZE)
     return -1;
+  if(ip->type == T_FILE && n > 0)
+    textinval(ip);
+  if(ip->dev == TMPDEV)
+    return tmpwritei(ip, src, off, n);
+  if(ip->flags & I_INLINE){
+    if(off + n <= NINLINE){
+      memmove((char*)ip->addrs + off, src, n);
+      if(off + n > ip->size)
+        ip->size = off + n;
+      iupdate(ip);
+      return n;
+    }
+    unline(ip);
+  }
 
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
     m = min(n - tot, BSIZE - off%BSIZE);
+    if((d = idelay(ip, off/BSIZE)) != 0){
+      memmove(d + off%BSIZE, src, m);
+      continue;
+    }
+    if((addr = bmap(ip, off/BSIZE)) == 0)
+      break;  // out of extents
+    bp = bread(ip->dev, addr);
     memmove(bp->data + off%BSIZE, src, m);
     log_write(bp);
     brelse(bp);
   }
 
-  if(n > 0 && off > ip->size){
+  if(ip->type == T_FILE)
+    pcwrite(ip, src - tot, off - tot, tot);
+  if(tot > 0 && off > ip->size){
     ip->size = off;
     iupdate(ip);
   }
-  return n;
+  return tot > 0 || n == 0 ? tot : -1;
 }
 
 //PAGEBREAK!
@@ -671,6 +1552,218 @@ namecmp(const char *s, const char *t)
   return strncmp(s, t, DIRSIZ);
 }
 
+// Hashed directories, see struct dirhead in fs.h.
+
+// FNV-1a; mkfs.c has a copy.
+static uint
+dirhash(char *name)
+{
+  uint h;
+  int i;
+
+  h = 2166136261U;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = (h ^ (uchar)name[i]) * 16777619U;
+  return h;
+}
+
+static struct buf*
+dirblock(struct inode *dp, uint lbn)
+{
+  return bread(dp->dev, bmap(dp, lbn));
+}
+
+// Append a block to directory dp and return it, zeroed and locked.
+static struct buf*
+dirgrow(struct inode *dp, uint *plbn)
+{
+  struct buf *bp;
+
+  *plbn = dp->size / BSIZE;
+  bp = dirblock(dp, *plbn);
+  dp->size += BSIZE;
+  iupdate(dp);
+  return bp;
+}
+
+// The first block of the bucket for hash h, from index block ib.
+static uint
+hdirbucket(struct buf *ib, uint h)
+{
+  ushort *w = (ushort*)ib->data;
+
+  return w[HDIDX(2 + (h & ((1 << w[HDIDX(1)]) - 1)))];
+}
+
+// A free dirent in bucket block bp, or 0 if it is full.
+static int
+hdirslot(struct buf *bp)
+{
+  struct dirent *de = (struct dirent*)bp->data;
+  int i;
+
+  for(i = 1; i < DPB; i++)
+    if(de[i].inum == 0)
+      return i;
+  return 0;
+}
+
+static uint
+hdirlookup(struct inode *dp, char *name, uint *poff)
+{
+  struct buf *bp;
+  struct dirent *de;
+  uint lbn, inum;
+  int i;
+
+  bp = dirblock(dp, 0);
+  lbn = hdirbucket(bp, dirhash(name));
+  brelse(bp);
+  while(lbn != 0){
+    bp = dirblock(dp, lbn);
+    de = (struct dirent*)bp->data;
+    for(i = 1; i < DPB; i++){
+      if(de[i].inum != 0 && namecmp(name, de[i].name) == 0){
+        *poff = lbn*BSIZE + i*sizeof(*de);
+        inum = de[i].inum;
+        brelse(bp);
+        return inum;
+      }
+    }
+    lbn = ((struct dirhead*)bp->data)->next;
+    brelse(bp);
+  }
+  return 0;
+}
+
+// Split bucket block lbn of dp, held in bp, on the next bit of the
+// hash into itself and a new block, doubling the index in ib first
+// if the bucket already uses all its bits.  Entries move, so the
+// offsets the dcache has for dp go.
+static void
+hdirsplit(struct inode *dp, struct buf *ib, uint lbn, struct buf *bp)
+{
+  ushort *w = (ushort*)ib->data;
+  struct dirent *ode, *nde;
+  struct buf *nbp;
+  uint d, n, i, j, nlbn;
+
+  d = ((struct dirhead*)bp->data)->depth;
+  n = 1 << w[HDIDX(1)];
+  if(d == w[HDIDX(1)]){
+    for(i = 0; i < n; i++)
+      w[HDIDX(2+n+i)] = w[HDIDX(2+i)];
+    w[HDIDX(1)]++;
+    n *= 2;
+  }
+  nbp = dirgrow(dp, &nlbn);
+  ((struct dirhead*)bp->data)->depth = d + 1;
+  ((struct dirhead*)nbp->data)->depth = d + 1;
+  ode = (struct dirent*)bp->data;
+  nde = (struct dirent*)nbp->data;
+  for(i = j = 1; i < DPB; i++){
+    if(ode[i].inum != 0 && (dirhash(ode[i].name) >> d) & 1){
+      nde[j++] = ode[i];
+      memset(&ode[i], 0, sizeof(ode[i]));
+    }
+  }
+  for(i = 0; i < n; i++)
+    if(w[HDIDX(2+i)] == lbn && (i >> d) & 1)
+      w[HDIDX(2+i)] = nlbn;
+  log_write(nbp);
+  brelse(nbp);
+  log_write(bp);
+  log_write(ib);
+  dcachepurge(dp->dev, dp->inum);
+}
+
+// Put (name, inum) in its bucket of hashed directory dp, splitting
+// a full bucket at most *nsplit times before chaining on another
+// block, to bound the blocks one dirlink() writes.
+// Returns the byte offset of the entry.
+static uint
+hdirinsert(struct inode *dp, char *name, uint inum, int *nsplit)
+{
+  struct buf *ib, *bp, *nbp;
+  struct dirhead *hd;
+  struct dirent *de;
+  uint h, lbn, next;
+  int i;
+
+  h = dirhash(name);
+  ib = dirblock(dp, 0);
+  for(;;){
+    lbn = hdirbucket(ib, h);
+    bp = dirblock(dp, lbn);
+    while((i = hdirslot(bp)) == 0 &&
+          (next = ((struct dirhead*)bp->data)->next) != 0){
+      brelse(bp);
+      lbn = next;
+      bp = dirblock(dp, lbn);
+    }
+    if(i != 0)
+      break;
+    hd = (struct dirhead*)bp->data;
+    if(lbn == hdirbucket(ib, h) && hd->depth < HDMAXDEPTH && *nsplit > 0){
+      (*nsplit)--;
+      hdirsplit(dp, ib, lbn, bp);
+      brelse(bp);
+      continue;
+    }
+    nbp = dirgrow(dp, &next);
+    ((struct dirhead*)nbp->data)->depth = hd->depth;
+    hd->next = next;
+    log_write(bp);
+    brelse(bp);
+    bp = nbp;
+    lbn = next;
+    i = 1;
+    break;
+  }
+  brelse(ib);
+
+  de = (struct dirent*)bp->data + i;
+  memset(de, 0, sizeof(*de));
+  strncpy(de->name, name, DIRSIZ);
+  de->inum = inum;
+  log_write(bp);
+  brelse(bp);
+  return lbn*BSIZE + i*sizeof(*de);
+}
+
+// Turn the one full block of plain directory dp into the index of
+// a hashed directory, and rehash its entries into buckets.
+static void
+hdirconvert(struct inode *dp, int *nsplit)
+{
+  struct dirent *old;
+  struct buf *ib, *bp;
+  ushort *w;
+  uint lbn;
+  int i;
+
+  if((old = (struct dirent*)kalloc()) == 0)
+    panic("hdirconvert");
+  ib = dirblock(dp, 0);
+  memmove(old, ib->data, BSIZE);
+  memset(ib->data, 0, BSIZE);
+  w = (ushort*)ib->data;
+  w[HDIDX(0)] = HDMAGIC;
+  bp = dirgrow(dp, &lbn);   // an empty bucket of depth 0
+  brelse(bp);
+  w[HDIDX(2)] = lbn;
+  log_write(ib);
+  brelse(ib);
+  dp->flags |= I_HASHDIR;
+  iupdate(dp);
+
+  dcachepurge(dp->dev, dp->inum);
+  for(i = 0; i < DPB; i++)
+    if(old[i].inum != 0)
+      hdirinsert(dp, old[i].name, old[i].inum, nsplit);
+  kfree((char*)old);
+}
+
 // Look for a directory entry in a directory.
 // If found, set *poff to byte offset of entry.
 struct inode*
@@ -682,28 +1775,46 @@ dirlookup(struct inode *dp, char *name, uint *poff)
   if(dp->type != T_DIR)
     panic("dirlookup not DIR");
 
-  for(off = 0; off < dp->size; off += sizeof(de)){
-    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-      panic("dirlookup read");
-    if(de.inum == 0)
-      continue;
-    if(namecmp(name, de.name) == 0){
-      // entry matches path element
-      if(poff)
-        *poff = off;
-      inum = de.inum;
-      return iget(dp->dev, inum);
+  if(dcachelookup(dp->dev, dp->inum, name, &inum, &off)){
+    if(inum == 0)
+      return 0;
+    if(poff)
+      *poff = off;
+    return iget(dp->dev, inum);
+  }
+
+  inum = 0;
+  if(dp->flags & I_HASHDIR)
+    inum = hdirlookup(dp, name, &off);
+  else {
+    for(off = 0; off < dp->size; off += sizeof(de)){
+      if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+        panic("dirlookup read");
+      if(de.inum == 0)
+        continue;
+      if(namecmp(name, de.name) == 0){
+        // entry matches path element
+        inum = de.inum;
+        break;
+      }
     }
   }
 
-  return 0;
+  dcacheenter(dp->dev, dp->inum, name, inum, inum ? off : 0);
+  if(inum == 0)
+    return 0;
+  if(poff)
+    *poff = off;
+  return iget(dp->dev, inum);
 }
 
 // Write a new directory entry (name, inum) into the directory dp.
+// A plain directory about to outgrow its first block is hashed,
+// unless it is in memory, on tmpfs.
 int
 dirlink(struct inode *dp, char *name, uint inum)
 {
-  int off;
+  int off, nsplit;
   struct dirent de;
   struct inode *ip;
 
@@ -713,22 +1824,58 @@ dirlink(struct inode *dp, char *name, uint inum)
     return -1;
   }
 
-  // Look for an empty dirent.
-  for(off = 0; off < dp->size; off += sizeof(de)){
-    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-      panic("dirlink read");
-    if(de.inum == 0)
-      break;
-  }
+  nsplit = HDSPLITS;
+  if((dp->flags & I_HASHDIR) == 0){
+    // Look for an empty dirent.
+    for(off = 0; off < dp->size; off += sizeof(de)){
+      if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+        panic("dirlink read");
+      if(de.inum == 0)
+        break;
+    }
 
-  strncpy(de.name, name, DIRSIZ);
-  de.inum = inum;
-  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-    panic("dirlink");
+    if(off < dp->size || dp->size != BSIZE || dp->dev == TMPDEV){
+      strncpy(de.name, name, DIRSIZ);
+      de.inum = inum;
+      if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+        panic("dirlink");
+      dcacheenter(dp->dev, dp->inum, name, inum, off);
+      return 0;
+    }
+    hdirconvert(dp, &nsplit);
+  }
 
+  off = hdirinsert(dp, name, inum, &nsplit);
+  dcacheenter(dp->dev, dp->inum, name, inum, off);
   return 0;
 }
 
+// Copy the entries in use of directory dp, from byte offset *poff
+// on, to dst, as many as fit in n bytes, and leave *poff after the
+// last one looked at.  The index and bucket headers of a hashed
+// directory are skipped.  Returns the number of bytes copied.
+// Caller must hold dp->lock.
+int
+dirread(struct inode *dp, uint *poff, char *dst, uint n)
+{
+  struct dirent de;
+  uint off, tot;
+
+  tot = 0;
+  for(off = *poff; off < dp->size && tot + sizeof(de) <= n; off += sizeof(de)){
+    if((dp->flags & I_HASHDIR) && (off < BSIZE || off % BSIZE == 0))
+      continue;
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+      break;
+    if(de.inum == 0)
+      continue;
+    memmove(dst + tot, &de, sizeof(de));
+    tot += sizeof(de);
+  }
+  *poff = off;
+  return tot;
+}
+
 //PAGEBREAK!
 // Paths
 
@@ -769,22 +1916,85 @@ skipelem(char *path, char *name)
   return path;
 }
 
-// Look up and return the inode for a path name.
+// Mount file system dev on directory mp, giving the mount table
+// caller's reference to mp.  A file system is mounted only once.
+int
+fsmount(struct inode *mp, uint dev)
+{
+  int i, free;
+
+  acquire(&mtab.lock);
+  free = -1;
+  for(i = 0; i < NMOUNT; i++){
+    if(mtab.m[i].mp == 0){
+      if(free < 0)
+        free = i;
+    } else if(mtab.m[i].mp == mp || mtab.m[i].dev == dev){
+      release(&mtab.lock);
+      return -1;
+    }
+  }
+  if(free < 0){
+    release(&mtab.lock);
+    return -1;
+  }
+  mtab.m[free].mp = mp;
+  mtab.m[free].dev = dev;
+  release(&mtab.lock);
+  return 0;
+}
+
+// If ip is a mount point, put it and return the root mounted
+// there; if up and ip is the root of a mounted file system, put it
+// and return its mount point.  Otherwise return ip.
+static struct inode*
+mountcross(struct inode *ip, int up)
+{
+  struct inode *next;
+  int i;
+
+  if(up && (ip->inum != ROOTINO || ip->dev == ROOTDEV))
+    return ip;
+  next = 0;
+  acquire(&mtab.lock);
+  for(i = 0; i < NMOUNT; i++){
+    if(mtab.m[i].mp == 0)
+      continue;
+    if(up && mtab.m[i].dev == ip->dev){
+      next = idup(mtab.m[i].mp);
+      break;
+    }
+    if(!up && mtab.m[i].mp == ip){
+      next = iget(mtab.m[i].dev, ROOTINO);
+      break;
+    }
+  }
+  release(&mtab.lock);
+  if(next == 0)
+    return ip;
+  iput(ip);
+  return next;
+}
+
+// Look up and return the inode for a path name, relative to
+// directory at unless it starts with '/'.
 // If parent != 0, return the inode for the parent and copy the final
 // path element into name, which must have room for DIRSIZ bytes.
 // Must be called inside a transaction since it calls iput().
 static struct inode*
-namex(char *path, int nameiparent, char *name)
+namex(struct inode *at, char *path, int nameiparent, char *name)
 {
   struct inode *ip, *next;
 
   if(*path == '/')
     ip = iget(ROOTDEV, ROOTINO);
   else
-    ip = idup(myproc()->cwd);
+    ip = idup(at);
 
   while((path = skipelem(path, name)) != 0){
-    ilock(ip);
+    if(namecmp(name, "..") == 0)
+      ip = mountcross(ip, 1);
+    ilockshared(ip);
     if(ip->type != T_DIR){
       iunlockput(ip);
       return 0;
@@ -799,7 +2009,7 @@ namex(char *path, int nameiparent, char *name)
       return 0;
     }
     iunlockput(ip);
-    ip = next;
+    ip = mountcross(next, 0);
   }
   if(nameiparent){
     iput(ip);
@@ -812,11 +2022,19 @@ struct inode*
 namei(char *path)
 {
   char name[DIRSIZ];
-  return namex(path, 0, name);
+  return namex(myproc()->cwd, path, 0, name);
+}
+
+// namei() relative to directory dp instead of the current one.
+struct inode*
+nameiat(struct inode *dp, char *path)
+{
+  char name[DIRSIZ];
+  return namex(dp, path, 0, name);
 }
 
 struct inode*
 nameiparent(char *path, char *name)
 {
-  return namex(path, 1, name);
+  return namex(myproc()->cwd, path, 1, name);
 }
@@ -7,7 +7,7 @@
 
 // Disk layout:
 // [ boot block | super block | log | inode blocks |
-//                                          free bit map | data blocks]
+//                              free bit map | swap area | data blocks]
 //
 // mkfs computes the super block and builds an initial file system. The
 // super block describes the disk layout:
@@ -19,8 +19,14 @@ struct superblock {
   uint logstart;     // Block number of first log block
   uint inodestart;   // Block number of first inode block
   uint bmapstart;    // Block number of first free map block
+  uint nswap;        // Number of swap blocks
+  uint swapstart;    // Block number of first swap block
 };
 
+// Log header blocks for a log of n data blocks: the header holds
+// a count and n block numbers.
+#define LOGHEAD(n) ((sizeof(int)*(1+(n)) + BSIZE-1) / BSIZE)
+
 /*
 Además tendremos que reducir el número de bloques directos,
 para implementar el doblemente indirecto, 
@@ -46,7 +52,8 @@ por lo que prescindiremos de uno directo para implementar el indirecto
 
 // On-disk inode structure
 struct dinode {
-  short type;           // File type
+  uchar type;           // File type
+  uchar flags;          // I_EXTENT, I_HASHDIR, I_INLINE
   short major;          // Major device number (T_DEV only)
   short minor;          // Minor device number (T_DEV only)
   short nlink;          // Number of links to inode in file system
@@ -55,6 +62,23 @@ struct dinode {
   uint addrs[NDIRECT+1+1];   // Data block addresses
 };
 
+#define I_EXTENT 0x1    // addrs[] holds extents, not block numbers
+#define I_HASHDIR 0x2   // Directory is hashed, see struct dirhead
+#define I_INLINE  0x4   // addrs[] holds the data of a file of NINLINE bytes or less
+
+#define NINLINE  (sizeof(((struct dinode*)0)->addrs))
+
+// An extent-mapped file keeps NEXTENT runs of blocks in addrs[],
+// in file order, then the number of a block with NXEXTENT more.
+// A slot with len 0 ends the list.
+struct extent {
+  uint start;           // First disk block
+  uint len;             // Blocks, 0 if the slot is free
+};
+#define NEXTENT  ((NDIRECT+1) / 2)
+#define NXEXTENT (BSIZE / sizeof(struct extent))
+#define XBLOCK   (2*NEXTENT)    // addrs[] index of the extent block
+
 // Inodes per block.
 #define IPB           (BSIZE / sizeof(struct dinode))
 
@@ -75,3 +99,27 @@ struct dirent {
   char name[DIRSIZ];
 };
 
+// Dirents per block.
+#define DPB           (BSIZE / sizeof(struct dirent))
+
+// A hashed directory (I_HASHDIR) keeps its entries in buckets, by
+// a hash of the name.  Block 0 is an index of the 2^depth buckets,
+// and each bucket is a block of dirents, with more chained on when
+// it can't be split any further.  The first dirent of each bucket
+// block is a struct dirhead, and the index only uses the words
+// after each dirent's inum, so that reading the directory as an
+// array of dirents, as ls does, finds only free entries in them.
+struct dirhead {
+  ushort inum;          // Always 0
+  ushort next;          // Next block of the bucket, 0 if none
+  ushort depth;         // Bits of the hash the bucket is for
+  char pad[DIRSIZ-4];
+};
+
+#define HDMAGIC    0x4448
+#define HDMAXDEPTH 7            // At most 128 buckets
+
+// Word k of a hashed directory's index block, as a ushort: word 0
+// is HDMAGIC, word 1 the depth, word 2+i the block of bucket i.
+#define HDIDX(k)   ((k)/7*8 + 1 + (k)%7)
+
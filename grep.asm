@@ -0,0 +1,3227 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <compile>:
+  int lit;                     // A character every match has, or -1
+} re;
+
+int
+compile(char *p)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	53                   	push   %ebx
+       4:	83 ec 08             	sub    $0x8,%esp
+       7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int c, i;
+
+  memset(&re, 0, sizeof(re));
+       a:	68 14 04 00 00       	push   $0x414
+       f:	6a 00                	push   $0x0
+      11:	68 00 20 00 00       	push   $0x2000
+      16:	e8 37 04 00 00       	call   452 <memset>
+  re.lit = -1;
+      1b:	c7 05 10 24 00 00 ff 	movl   $0xffffffff,0x2410
+      22:	ff ff ff 
+  if(*p == '^'){
+      25:	83 c4 10             	add    $0x10,%esp
+      28:	80 3b 5e             	cmpb   $0x5e,(%ebx)
+      2b:	75 5d                	jne    8a <compile+0x8a>
+    re.bol = 1;
+      2d:	c7 05 04 20 00 00 01 	movl   $0x1,0x2004
+      34:	00 00 00 
+    p++;
+      37:	83 c3 01             	add    $0x1,%ebx
+      3a:	eb 4e                	jmp    8a <compile+0x8a>
+  }
+  for(; *p; p++){
+    if(p[0] == '$' && p[1] == '\0'){
+      3c:	80 7b 01 00          	cmpb   $0x0,0x1(%ebx)
+      40:	75 53                	jne    95 <compile+0x95>
+      re.eol = 1;
+      42:	c7 05 08 20 00 00 01 	movl   $0x1,0x2008
+      49:	00 00 00 
+      re.star |= 1 << i;
+      p++;
+    } else if(*p != '.' && re.lit < 0)
+      re.lit = (uchar)*p;
+  }
+  return 0;
+      4c:	b8 00 00 00 00       	mov    $0x0,%eax
+      break;
+      51:	e9 8f 00 00 00       	jmp    e5 <compile+0xe5>
+        re.match[c] |= 1 << i;
+      56:	ba 01 00 00 00       	mov    $0x1,%edx
+      5b:	d3 e2                	shl    %cl,%edx
+      5d:	09 14 85 10 20 00 00 	or     %edx,0x2010(,%eax,4)
+      for(c = 0; c < 256; c++)
+      64:	83 c0 01             	add    $0x1,%eax
+      67:	3d ff 00 00 00       	cmp    $0xff,%eax
+      6c:	7e e8                	jle    56 <compile+0x56>
+      6e:	eb 50                	jmp    c0 <compile+0xc0>
+      70:	b8 00 00 00 00       	mov    $0x0,%eax
+      75:	eb f0                	jmp    67 <compile+0x67>
+      re.star |= 1 << i;
+      77:	b8 01 00 00 00       	mov    $0x1,%eax
+      7c:	d3 e0                	shl    %cl,%eax
+      7e:	09 05 0c 20 00 00    	or     %eax,0x200c
+      p++;
+      84:	83 c3 01             	add    $0x1,%ebx
+  for(; *p; p++){
+      87:	83 c3 01             	add    $0x1,%ebx
+      8a:	0f b6 03             	movzbl (%ebx),%eax
+      8d:	84 c0                	test   %al,%al
+      8f:	74 4f                	je     e0 <compile+0xe0>
+    if(p[0] == '$' && p[1] == '\0'){
+      91:	3c 24                	cmp    $0x24,%al
+      93:	74 a7                	je     3c <compile+0x3c>
+    if(re.n == NITEM)
+      95:	8b 0d 00 20 00 00    	mov    0x2000,%ecx
+      9b:	83 f9 1f             	cmp    $0x1f,%ecx
+      9e:	74 4a                	je     ea <compile+0xea>
+    i = re.n++;
+      a0:	8d 41 01             	lea    0x1(%ecx),%eax
+      a3:	a3 00 20 00 00       	mov    %eax,0x2000
+    if(*p == '.')
+      a8:	0f b6 03             	movzbl (%ebx),%eax
+      ab:	3c 2e                	cmp    $0x2e,%al
+      ad:	74 c1                	je     70 <compile+0x70>
+      re.match[(uchar)*p] |= 1 << i;
+      af:	0f b6 c0             	movzbl %al,%eax
+      b2:	ba 01 00 00 00       	mov    $0x1,%edx
+      b7:	d3 e2                	shl    %cl,%edx
+      b9:	09 14 85 10 20 00 00 	or     %edx,0x2010(,%eax,4)
+    if(p[1] == '*'){
+      c0:	80 7b 01 2a          	cmpb   $0x2a,0x1(%ebx)
+      c4:	74 b1                	je     77 <compile+0x77>
+    } else if(*p != '.' && re.lit < 0)
+      c6:	0f b6 03             	movzbl (%ebx),%eax
+      c9:	3c 2e                	cmp    $0x2e,%al
+      cb:	74 ba                	je     87 <compile+0x87>
+      cd:	83 3d 10 24 00 00 00 	cmpl   $0x0,0x2410
+      d4:	79 b1                	jns    87 <compile+0x87>
+      re.lit = (uchar)*p;
+      d6:	0f b6 c0             	movzbl %al,%eax
+      d9:	a3 10 24 00 00       	mov    %eax,0x2410
+      de:	eb a7                	jmp    87 <compile+0x87>
+  return 0;
+      e0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+      e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      e8:	c9                   	leave
+      e9:	c3                   	ret
+      return -1;
+      ea:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+      ef:	eb f4                	jmp    e5 <compile+0xe5>
+
+000000f1 <closure>:
+
+// Add the items reached by skipping starred ones.
+uint
+closure(uint set)
+{
+      f1:	55                   	push   %ebp
+      f2:	89 e5                	mov    %esp,%ebp
+      f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  uint t;
+
+  while((t = set | ((set & re.star) << 1)) != set)
+      f7:	89 c2                	mov    %eax,%edx
+      f9:	23 15 0c 20 00 00    	and    0x200c,%edx
+      ff:	01 d2                	add    %edx,%edx
+     101:	89 c1                	mov    %eax,%ecx
+     103:	09 d0                	or     %edx,%eax
+     105:	39 c1                	cmp    %eax,%ecx
+     107:	75 ee                	jne    f7 <closure+0x6>
+    set = t;
+  return set;
+}
+     109:	89 c8                	mov    %ecx,%eax
+     10b:	5d                   	pop    %ebp
+     10c:	c3                   	ret
+
+0000010d <match>:
+
+// Does the line from s up to e match?
+int
+match(char *s, char *e)
+{
+     10d:	55                   	push   %ebp
+     10e:	89 e5                	mov    %esp,%ebp
+     110:	57                   	push   %edi
+     111:	56                   	push   %esi
+     112:	53                   	push   %ebx
+     113:	83 ec 28             	sub    $0x28,%esp
+     116:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     119:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  uint set, start, done, m;
+
+  done = 1 << re.n;
+     11c:	8b 0d 00 20 00 00    	mov    0x2000,%ecx
+     122:	be 01 00 00 00       	mov    $0x1,%esi
+     127:	d3 e6                	shl    %cl,%esi
+  start = closure(1);
+     129:	6a 01                	push   $0x1
+     12b:	e8 c1 ff ff ff       	call   f1 <closure>
+     130:	83 c4 10             	add    $0x10,%esp
+     133:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(set = start; ; s++){
+     136:	eb 17                	jmp    14f <match+0x42>
+    if((set & done) && !re.eol)
+      return 1;
+    if(s == e)
+      return (set & done) != 0;
+     138:	85 d2                	test   %edx,%edx
+     13a:	0f 95 c0             	setne  %al
+     13d:	0f b6 c0             	movzbl %al,%eax
+    if(!re.bol)
+      set |= start;
+    else if(set == 0)
+      return 0;
+  }
+}
+     140:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     143:	5b                   	pop    %ebx
+     144:	5e                   	pop    %esi
+     145:	5f                   	pop    %edi
+     146:	5d                   	pop    %ebp
+     147:	c3                   	ret
+    else if(set == 0)
+     148:	85 c0                	test   %eax,%eax
+     14a:	74 55                	je     1a1 <match+0x94>
+  for(set = start; ; s++){
+     14c:	83 c3 01             	add    $0x1,%ebx
+    if((set & done) && !re.eol)
+     14f:	89 c2                	mov    %eax,%edx
+     151:	21 f2                	and    %esi,%edx
+     153:	74 09                	je     15e <match+0x51>
+     155:	83 3d 08 20 00 00 00 	cmpl   $0x0,0x2008
+     15c:	74 3c                	je     19a <match+0x8d>
+    if(s == e)
+     15e:	39 fb                	cmp    %edi,%ebx
+     160:	74 d6                	je     138 <match+0x2b>
+    m = set & re.match[(uchar)*s];
+     162:	0f b6 13             	movzbl (%ebx),%edx
+     165:	23 04 95 10 20 00 00 	and    0x2010(,%edx,4),%eax
+    set = closure(((m & ~re.star) << 1) | (m & re.star));
+     16c:	8b 0d 0c 20 00 00    	mov    0x200c,%ecx
+     172:	89 ca                	mov    %ecx,%edx
+     174:	f7 d2                	not    %edx
+     176:	21 c2                	and    %eax,%edx
+     178:	01 d2                	add    %edx,%edx
+     17a:	21 c1                	and    %eax,%ecx
+     17c:	83 ec 0c             	sub    $0xc,%esp
+     17f:	09 ca                	or     %ecx,%edx
+     181:	52                   	push   %edx
+     182:	e8 6a ff ff ff       	call   f1 <closure>
+     187:	83 c4 10             	add    $0x10,%esp
+    if(!re.bol)
+     18a:	83 3d 04 20 00 00 00 	cmpl   $0x0,0x2004
+     191:	75 b5                	jne    148 <match+0x3b>
+      set |= start;
+     193:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     196:	09 c8                	or     %ecx,%eax
+     198:	eb b2                	jmp    14c <match+0x3f>
+      return 1;
+     19a:	b8 01 00 00 00       	mov    $0x1,%eax
+     19f:	eb 9f                	jmp    140 <match+0x33>
+      return 0;
+     1a1:	b8 00 00 00 00       	mov    $0x0,%eax
+     1a6:	eb 98                	jmp    140 <match+0x33>
+
+000001a8 <lines>:
+
+// Print the matching lines from s up to e, which ends one.
+void
+lines(char *s, char *e)
+{
+     1a8:	55                   	push   %ebp
+     1a9:	89 e5                	mov    %esp,%ebp
+     1ab:	57                   	push   %edi
+     1ac:	56                   	push   %esi
+     1ad:	53                   	push   %ebx
+     1ae:	83 ec 0c             	sub    $0xc,%esp
+     1b1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     1b4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *q;
+
+  while(s < e){
+     1b7:	eb 2c                	jmp    1e5 <lines+0x3d>
+    if(re.lit >= 0){
+      if((q = memchr(s, re.lit, e - s)) == 0)
+        return;
+      while(q > s && q[-1] != '\n')
+        q--;
+      s = q;
+     1b9:	89 c3                	mov    %eax,%ebx
+     1bb:	eb 02                	jmp    1bf <lines+0x17>
+     1bd:	89 c3                	mov    %eax,%ebx
+    }
+    q = memchr(s, '\n', e - s);
+     1bf:	89 f0                	mov    %esi,%eax
+     1c1:	29 d8                	sub    %ebx,%eax
+     1c3:	83 ec 04             	sub    $0x4,%esp
+     1c6:	50                   	push   %eax
+     1c7:	6a 0a                	push   $0xa
+     1c9:	53                   	push   %ebx
+     1ca:	e8 63 03 00 00       	call   532 <memchr>
+     1cf:	89 c7                	mov    %eax,%edi
+    if(match(s, q))
+     1d1:	83 c4 08             	add    $0x8,%esp
+     1d4:	50                   	push   %eax
+     1d5:	53                   	push   %ebx
+     1d6:	e8 32 ff ff ff       	call   10d <match>
+     1db:	83 c4 10             	add    $0x10,%esp
+     1de:	85 c0                	test   %eax,%eax
+     1e0:	75 35                	jne    217 <lines+0x6f>
+      bufwrite(1, s, q+1 - s);
+    s = q+1;
+     1e2:	8d 5f 01             	lea    0x1(%edi),%ebx
+  while(s < e){
+     1e5:	39 f3                	cmp    %esi,%ebx
+     1e7:	73 44                	jae    22d <lines+0x85>
+    if(re.lit >= 0){
+     1e9:	a1 10 24 00 00       	mov    0x2410,%eax
+     1ee:	85 c0                	test   %eax,%eax
+     1f0:	78 cd                	js     1bf <lines+0x17>
+      if((q = memchr(s, re.lit, e - s)) == 0)
+     1f2:	89 f2                	mov    %esi,%edx
+     1f4:	29 da                	sub    %ebx,%edx
+     1f6:	83 ec 04             	sub    $0x4,%esp
+     1f9:	52                   	push   %edx
+     1fa:	50                   	push   %eax
+     1fb:	53                   	push   %ebx
+     1fc:	e8 31 03 00 00       	call   532 <memchr>
+     201:	83 c4 10             	add    $0x10,%esp
+     204:	85 c0                	test   %eax,%eax
+     206:	74 25                	je     22d <lines+0x85>
+      while(q > s && q[-1] != '\n')
+     208:	39 c3                	cmp    %eax,%ebx
+     20a:	73 b1                	jae    1bd <lines+0x15>
+     20c:	80 78 ff 0a          	cmpb   $0xa,-0x1(%eax)
+     210:	74 a7                	je     1b9 <lines+0x11>
+        q--;
+     212:	83 e8 01             	sub    $0x1,%eax
+     215:	eb f1                	jmp    208 <lines+0x60>
+      bufwrite(1, s, q+1 - s);
+     217:	8d 47 01             	lea    0x1(%edi),%eax
+     21a:	83 ec 04             	sub    $0x4,%esp
+     21d:	29 d8                	sub    %ebx,%eax
+     21f:	50                   	push   %eax
+     220:	53                   	push   %ebx
+     221:	6a 01                	push   $0x1
+     223:	e8 25 06 00 00       	call   84d <bufwrite>
+     228:	83 c4 10             	add    $0x10,%esp
+     22b:	eb b5                	jmp    1e2 <lines+0x3a>
+  }
+}
+     22d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     230:	5b                   	pop    %ebx
+     231:	5e                   	pop    %esi
+     232:	5f                   	pop    %edi
+     233:	5d                   	pop    %ebp
+     234:	c3                   	ret
+
+00000235 <grep>:
+
+void
+grep(int fd)
+{
+     235:	55                   	push   %ebp
+     236:	89 e5                	mov    %esp,%ebp
+     238:	57                   	push   %edi
+     239:	56                   	push   %esi
+     23a:	53                   	push   %ebx
+     23b:	83 ec 0c             	sub    $0xc,%esp
+     23e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int n, m;
+  char *q;
+
+  m = 0;
+     241:	be 00 00 00 00       	mov    $0x0,%esi
+  while((n = read(fd, buf+m, BUFSZ-m)) > 0){
+     246:	eb 42                	jmp    28a <grep+0x55>
+    m += n;
+    for(q = buf+m; q > buf && q[-1] != '\n'; q--)
+     248:	83 eb 01             	sub    $0x1,%ebx
+     24b:	81 fb 00 30 00 00    	cmp    $0x3000,%ebx
+     251:	76 06                	jbe    259 <grep+0x24>
+     253:	80 7b ff 0a          	cmpb   $0xa,-0x1(%ebx)
+     257:	75 ef                	jne    248 <grep+0x13>
+      ;
+    if(q == buf){
+     259:	81 fb 00 30 00 00    	cmp    $0x3000,%ebx
+     25f:	74 54                	je     2b5 <grep+0x80>
+      if(m == BUFSZ)           // A line longer than buf: drop it
+        m = 0;
+      continue;
+    }
+    lines(buf, q);
+     261:	83 ec 08             	sub    $0x8,%esp
+     264:	53                   	push   %ebx
+     265:	68 00 30 00 00       	push   $0x3000
+     26a:	e8 39 ff ff ff       	call   1a8 <lines>
+    m -= q - buf;
+     26f:	89 d8                	mov    %ebx,%eax
+     271:	2d 00 30 00 00       	sub    $0x3000,%eax
+     276:	29 c6                	sub    %eax,%esi
+    memmove(buf, q, m);
+     278:	83 c4 0c             	add    $0xc,%esp
+     27b:	56                   	push   %esi
+     27c:	53                   	push   %ebx
+     27d:	68 00 30 00 00       	push   $0x3000
+     282:	e8 a1 03 00 00       	call   628 <memmove>
+     287:	83 c4 10             	add    $0x10,%esp
+  while((n = read(fd, buf+m, BUFSZ-m)) > 0){
+     28a:	89 f3                	mov    %esi,%ebx
+     28c:	83 ec 04             	sub    $0x4,%esp
+     28f:	b8 00 80 00 00       	mov    $0x8000,%eax
+     294:	29 f0                	sub    %esi,%eax
+     296:	50                   	push   %eax
+     297:	8d 86 00 30 00 00    	lea    0x3000(%esi),%eax
+     29d:	50                   	push   %eax
+     29e:	57                   	push   %edi
+     29f:	e8 79 08 00 00       	call   b1d <read>
+     2a4:	83 c4 10             	add    $0x10,%esp
+     2a7:	85 c0                	test   %eax,%eax
+     2a9:	7e 19                	jle    2c4 <grep+0x8f>
+    m += n;
+     2ab:	01 c6                	add    %eax,%esi
+    for(q = buf+m; q > buf && q[-1] != '\n'; q--)
+     2ad:	8d 9e 00 30 00 00    	lea    0x3000(%esi),%ebx
+     2b3:	eb 96                	jmp    24b <grep+0x16>
+      if(m == BUFSZ)           // A line longer than buf: drop it
+     2b5:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+     2bb:	75 cd                	jne    28a <grep+0x55>
+        m = 0;
+     2bd:	be 00 00 00 00       	mov    $0x0,%esi
+      continue;
+     2c2:	eb c6                	jmp    28a <grep+0x55>
+  }
+  if(m > 0){                   // A last line with no newline
+     2c4:	85 f6                	test   %esi,%esi
+     2c6:	7f 08                	jg     2d0 <grep+0x9b>
+    buf[m] = '\n';
+    lines(buf, buf+m+1);
+  }
+}
+     2c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     2cb:	5b                   	pop    %ebx
+     2cc:	5e                   	pop    %esi
+     2cd:	5f                   	pop    %edi
+     2ce:	5d                   	pop    %ebp
+     2cf:	c3                   	ret
+    buf[m] = '\n';
+     2d0:	c6 86 00 30 00 00 0a 	movb   $0xa,0x3000(%esi)
+    lines(buf, buf+m+1);
+     2d7:	83 ec 08             	sub    $0x8,%esp
+     2da:	81 c3 01 30 00 00    	add    $0x3001,%ebx
+     2e0:	53                   	push   %ebx
+     2e1:	68 00 30 00 00       	push   $0x3000
+     2e6:	e8 bd fe ff ff       	call   1a8 <lines>
+     2eb:	83 c4 10             	add    $0x10,%esp
+}
+     2ee:	eb d8                	jmp    2c8 <grep+0x93>
+
+000002f0 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     2f0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     2f4:	83 e4 f0             	and    $0xfffffff0,%esp
+     2f7:	ff 71 fc             	push   -0x4(%ecx)
+     2fa:	55                   	push   %ebp
+     2fb:	89 e5                	mov    %esp,%ebp
+     2fd:	57                   	push   %edi
+     2fe:	56                   	push   %esi
+     2ff:	53                   	push   %ebx
+     300:	51                   	push   %ecx
+     301:	83 ec 18             	sub    $0x18,%esp
+     304:	8b 01                	mov    (%ecx),%eax
+     306:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     309:	8b 51 04             	mov    0x4(%ecx),%edx
+     30c:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  int fd, i;
+
+  if(argc <= 1){
+     30f:	83 f8 01             	cmp    $0x1,%eax
+     312:	7e 22                	jle    336 <main+0x46>
+    printf(2, "usage: grep pattern [file ...]\n");
+    exit();
+  }
+  if(compile(argv[1]) < 0){
+     314:	83 ec 0c             	sub    $0xc,%esp
+     317:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     31a:	ff 70 04             	push   0x4(%eax)
+     31d:	e8 de fc ff ff       	call   0 <compile>
+     322:	83 c4 10             	add    $0x10,%esp
+     325:	85 c0                	test   %eax,%eax
+     327:	78 21                	js     34a <main+0x5a>
+    printf(2, "grep: pattern too long\n");
+    exit();
+  }
+
+  if(argc <= 2){
+     329:	83 7d e4 02          	cmpl   $0x2,-0x1c(%ebp)
+     32d:	7e 2f                	jle    35e <main+0x6e>
+    grep(0);
+    exit();
+  }
+
+  for(i = 2; i < argc; i++){
+     32f:	be 02 00 00 00       	mov    $0x2,%esi
+     334:	eb 4e                	jmp    384 <main+0x94>
+    printf(2, "usage: grep pattern [file ...]\n");
+     336:	83 ec 08             	sub    $0x8,%esp
+     339:	68 50 15 00 00       	push   $0x1550
+     33e:	6a 02                	push   $0x2
+     340:	e8 ed 0b 00 00       	call   f32 <printf>
+    exit();
+     345:	e8 af 06 00 00       	call   9f9 <exit>
+    printf(2, "grep: pattern too long\n");
+     34a:	83 ec 08             	sub    $0x8,%esp
+     34d:	68 70 15 00 00       	push   $0x1570
+     352:	6a 02                	push   $0x2
+     354:	e8 d9 0b 00 00       	call   f32 <printf>
+    exit();
+     359:	e8 9b 06 00 00       	call   9f9 <exit>
+    grep(0);
+     35e:	83 ec 0c             	sub    $0xc,%esp
+     361:	6a 00                	push   $0x0
+     363:	e8 cd fe ff ff       	call   235 <grep>
+    exit();
+     368:	e8 8c 06 00 00       	call   9f9 <exit>
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "grep: cannot open %s\n", argv[i]);
+      exit();
+    }
+    grep(fd);
+     36d:	83 ec 0c             	sub    $0xc,%esp
+     370:	50                   	push   %eax
+     371:	e8 bf fe ff ff       	call   235 <grep>
+    close(fd);
+     376:	89 1c 24             	mov    %ebx,(%esp)
+     379:	e8 aa 06 00 00       	call   a28 <close>
+  for(i = 2; i < argc; i++){
+     37e:	83 c6 01             	add    $0x1,%esi
+     381:	83 c4 10             	add    $0x10,%esp
+     384:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     387:	39 c6                	cmp    %eax,%esi
+     389:	7d 31                	jge    3bc <main+0xcc>
+    if((fd = open(argv[i], 0)) < 0){
+     38b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     38e:	8d 3c b0             	lea    (%eax,%esi,4),%edi
+     391:	83 ec 08             	sub    $0x8,%esp
+     394:	6a 00                	push   $0x0
+     396:	ff 37                	push   (%edi)
+     398:	e8 ad 07 00 00       	call   b4a <open>
+     39d:	89 c3                	mov    %eax,%ebx
+     39f:	83 c4 10             	add    $0x10,%esp
+     3a2:	85 c0                	test   %eax,%eax
+     3a4:	79 c7                	jns    36d <main+0x7d>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+     3a6:	83 ec 04             	sub    $0x4,%esp
+     3a9:	ff 37                	push   (%edi)
+     3ab:	68 88 15 00 00       	push   $0x1588
+     3b0:	6a 01                	push   $0x1
+     3b2:	e8 7b 0b 00 00       	call   f32 <printf>
+      exit();
+     3b7:	e8 3d 06 00 00       	call   9f9 <exit>
+  }
+  exit();
+     3bc:	e8 38 06 00 00       	call   9f9 <exit>
+
+000003c1 <strcpy>:
+#include "memlayout.h"
+#include "clock.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     3c1:	55                   	push   %ebp
+     3c2:	89 e5                	mov    %esp,%ebp
+     3c4:	56                   	push   %esi
+     3c5:	53                   	push   %ebx
+     3c6:	8b 75 08             	mov    0x8(%ebp),%esi
+     3c9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     3cc:	89 f0                	mov    %esi,%eax
+     3ce:	89 d1                	mov    %edx,%ecx
+     3d0:	83 c2 01             	add    $0x1,%edx
+     3d3:	89 c3                	mov    %eax,%ebx
+     3d5:	83 c0 01             	add    $0x1,%eax
+     3d8:	0f b6 09             	movzbl (%ecx),%ecx
+     3db:	88 0b                	mov    %cl,(%ebx)
+     3dd:	84 c9                	test   %cl,%cl
+     3df:	75 ed                	jne    3ce <strcpy+0xd>
+    ;
+  return os;
+}
+     3e1:	89 f0                	mov    %esi,%eax
+     3e3:	5b                   	pop    %ebx
+     3e4:	5e                   	pop    %esi
+     3e5:	5d                   	pop    %ebp
+     3e6:	c3                   	ret
+
+000003e7 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     3e7:	55                   	push   %ebp
+     3e8:	89 e5                	mov    %esp,%ebp
+     3ea:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     3ed:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+     3f0:	eb 06                	jmp    3f8 <strcmp+0x11>
+    p++, q++;
+     3f2:	83 c1 01             	add    $0x1,%ecx
+     3f5:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+     3f8:	0f b6 01             	movzbl (%ecx),%eax
+     3fb:	84 c0                	test   %al,%al
+     3fd:	74 04                	je     403 <strcmp+0x1c>
+     3ff:	3a 02                	cmp    (%edx),%al
+     401:	74 ef                	je     3f2 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+     403:	0f b6 c0             	movzbl %al,%eax
+     406:	0f b6 12             	movzbl (%edx),%edx
+     409:	29 d0                	sub    %edx,%eax
+}
+     40b:	5d                   	pop    %ebp
+     40c:	c3                   	ret
+
+0000040d <strlen>:
+
+uint
+strlen(const char *s)
+{
+     40d:	55                   	push   %ebp
+     40e:	89 e5                	mov    %esp,%ebp
+     410:	53                   	push   %ebx
+     411:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  const char *p;
+  uint w;
+
+  for(p = s; (uint)p & 3; p++)
+     414:	89 c8                	mov    %ecx,%eax
+     416:	eb 03                	jmp    41b <strlen+0xe>
+     418:	83 c0 01             	add    $0x1,%eax
+     41b:	a8 03                	test   $0x3,%al
+     41d:	74 09                	je     428 <strlen+0x1b>
+    if(*p == 0)
+     41f:	80 38 00             	cmpb   $0x0,(%eax)
+     422:	75 f4                	jne    418 <strlen+0xb>
+      return p - s;
+     424:	29 c8                	sub    %ecx,%eax
+     426:	eb 25                	jmp    44d <strlen+0x40>
+  // Then a word at a time, which never crosses into the next page:
+  // a word with a zero byte in it has one of these bits set.
+  for(;; p += 4){
+    w = *(uint*)p;
+     428:	8b 10                	mov    (%eax),%edx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     42a:	8d 9a ff fe fe fe    	lea    -0x1010101(%edx),%ebx
+     430:	f7 d2                	not    %edx
+     432:	21 da                	and    %ebx,%edx
+     434:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+     43a:	75 05                	jne    441 <strlen+0x34>
+  for(;; p += 4){
+     43c:	83 c0 04             	add    $0x4,%eax
+    w = *(uint*)p;
+     43f:	eb e7                	jmp    428 <strlen+0x1b>
+      break;
+  }
+  while(*p)
+     441:	80 38 00             	cmpb   $0x0,(%eax)
+     444:	74 05                	je     44b <strlen+0x3e>
+    p++;
+     446:	83 c0 01             	add    $0x1,%eax
+     449:	eb f6                	jmp    441 <strlen+0x34>
+  return p - s;
+     44b:	29 c8                	sub    %ecx,%eax
+}
+     44d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     450:	c9                   	leave
+     451:	c3                   	ret
+
+00000452 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     452:	55                   	push   %ebp
+     453:	89 e5                	mov    %esp,%ebp
+     455:	57                   	push   %edi
+     456:	56                   	push   %esi
+     457:	53                   	push   %ebx
+     458:	8b 55 10             	mov    0x10(%ebp),%edx
+  uint h;
+  char *d;
+
+  d = dst;
+  c &= 0xFF;
+     45b:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  if(n >= 16){
+     45f:	83 fa 0f             	cmp    $0xf,%edx
+     462:	76 52                	jbe    4b6 <memset+0x64>
+    h = -(uint)d & 3;
+     464:	8b 45 08             	mov    0x8(%ebp),%eax
+     467:	f7 d8                	neg    %eax
+     469:	83 e0 03             	and    $0x3,%eax
+     46c:	89 c6                	mov    %eax,%esi
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     46e:	8b 7d 08             	mov    0x8(%ebp),%edi
+     471:	89 c1                	mov    %eax,%ecx
+     473:	89 d8                	mov    %ebx,%eax
+     475:	fc                   	cld
+     476:	f3 aa                	rep stos %al,%es:(%edi)
+    stosb(d, c, h);
+    stosl(d + h, (c<<24)|(c<<16)|(c<<8)|c, (n - h)/4);
+     478:	29 f2                	sub    %esi,%edx
+     47a:	89 d1                	mov    %edx,%ecx
+     47c:	c1 e9 02             	shr    $0x2,%ecx
+     47f:	c1 e0 18             	shl    $0x18,%eax
+     482:	89 df                	mov    %ebx,%edi
+     484:	c1 e7 10             	shl    $0x10,%edi
+     487:	09 f8                	or     %edi,%eax
+     489:	89 df                	mov    %ebx,%edi
+     48b:	c1 e7 08             	shl    $0x8,%edi
+     48e:	09 f8                	or     %edi,%eax
+     490:	09 d8                	or     %ebx,%eax
+     492:	89 f7                	mov    %esi,%edi
+     494:	03 7d 08             	add    0x8(%ebp),%edi
+}
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosl" :
+     497:	fc                   	cld
+     498:	f3 ab                	rep stos %eax,%es:(%edi)
+    d += h + (n - h)/4*4;
+     49a:	89 d7                	mov    %edx,%edi
+     49c:	83 e7 fc             	and    $0xfffffffc,%edi
+     49f:	09 f7                	or     %esi,%edi
+     4a1:	03 7d 08             	add    0x8(%ebp),%edi
+    n = (n - h)%4;
+     4a4:	83 e2 03             	and    $0x3,%edx
+  asm volatile("cld; rep stosb" :
+     4a7:	89 d1                	mov    %edx,%ecx
+     4a9:	89 d8                	mov    %ebx,%eax
+     4ab:	fc                   	cld
+     4ac:	f3 aa                	rep stos %al,%es:(%edi)
+  }
+  stosb(d, c, n);
+  return dst;
+}
+     4ae:	8b 45 08             	mov    0x8(%ebp),%eax
+     4b1:	5b                   	pop    %ebx
+     4b2:	5e                   	pop    %esi
+     4b3:	5f                   	pop    %edi
+     4b4:	5d                   	pop    %ebp
+     4b5:	c3                   	ret
+  d = dst;
+     4b6:	8b 7d 08             	mov    0x8(%ebp),%edi
+     4b9:	eb ec                	jmp    4a7 <memset+0x55>
+
+000004bb <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     4bb:	55                   	push   %ebp
+     4bc:	89 e5                	mov    %esp,%ebp
+     4be:	8b 45 08             	mov    0x8(%ebp),%eax
+     4c1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     4c5:	eb 03                	jmp    4ca <strchr+0xf>
+     4c7:	83 c0 01             	add    $0x1,%eax
+     4ca:	0f b6 10             	movzbl (%eax),%edx
+     4cd:	84 d2                	test   %dl,%dl
+     4cf:	74 06                	je     4d7 <strchr+0x1c>
+    if(*s == c)
+     4d1:	38 ca                	cmp    %cl,%dl
+     4d3:	75 f2                	jne    4c7 <strchr+0xc>
+     4d5:	eb 05                	jmp    4dc <strchr+0x21>
+      return (char*)s;
+  return 0;
+     4d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     4dc:	5d                   	pop    %ebp
+     4dd:	c3                   	ret
+
+000004de <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     4de:	55                   	push   %ebp
+     4df:	89 e5                	mov    %esp,%ebp
+     4e1:	56                   	push   %esi
+     4e2:	53                   	push   %ebx
+     4e3:	8b 55 08             	mov    0x8(%ebp),%edx
+     4e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     4e9:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  // A word at a time while they agree.
+  if((((uint)s1 | (uint)s2) & 3) == 0)
+     4ec:	89 d3                	mov    %edx,%ebx
+     4ee:	09 cb                	or     %ecx,%ebx
+     4f0:	f6 c3 03             	test   $0x3,%bl
+     4f3:	74 24                	je     519 <memcmp+0x3b>
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+      s1 += 4, s2 += 4;
+  while(n-- > 0){
+     4f5:	8d 70 ff             	lea    -0x1(%eax),%esi
+     4f8:	85 c0                	test   %eax,%eax
+     4fa:	74 32                	je     52e <memcmp+0x50>
+    if(*s1 != *s2)
+     4fc:	0f b6 02             	movzbl (%edx),%eax
+     4ff:	0f b6 19             	movzbl (%ecx),%ebx
+     502:	38 d8                	cmp    %bl,%al
+     504:	75 20                	jne    526 <memcmp+0x48>
+      return *s1 - *s2;
+    s1++, s2++;
+     506:	83 c2 01             	add    $0x1,%edx
+     509:	83 c1 01             	add    $0x1,%ecx
+  while(n-- > 0){
+     50c:	89 f0                	mov    %esi,%eax
+     50e:	eb e5                	jmp    4f5 <memcmp+0x17>
+      s1 += 4, s2 += 4;
+     510:	83 c2 04             	add    $0x4,%edx
+     513:	83 c1 04             	add    $0x4,%ecx
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+     516:	83 e8 04             	sub    $0x4,%eax
+     519:	83 f8 03             	cmp    $0x3,%eax
+     51c:	76 d7                	jbe    4f5 <memcmp+0x17>
+     51e:	8b 31                	mov    (%ecx),%esi
+     520:	39 32                	cmp    %esi,(%edx)
+     522:	74 ec                	je     510 <memcmp+0x32>
+     524:	eb cf                	jmp    4f5 <memcmp+0x17>
+      return *s1 - *s2;
+     526:	0f b6 c0             	movzbl %al,%eax
+     529:	0f b6 db             	movzbl %bl,%ebx
+     52c:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     52e:	5b                   	pop    %ebx
+     52f:	5e                   	pop    %esi
+     530:	5d                   	pop    %ebp
+     531:	c3                   	ret
+
+00000532 <memchr>:
+// The first c in the n bytes at v, or 0.  Once aligned, a word at
+// a time, with the word's bytes that equal c turned into zeroes
+// and those looked for.
+void*
+memchr(const void *v, int c, uint n)
+{
+     532:	55                   	push   %ebp
+     533:	89 e5                	mov    %esp,%ebp
+     535:	57                   	push   %edi
+     536:	56                   	push   %esi
+     537:	53                   	push   %ebx
+     538:	8b 45 08             	mov    0x8(%ebp),%eax
+     53b:	8b 55 10             	mov    0x10(%ebp),%edx
+  const uchar *s;
+  uint w, rep;
+
+  s = v;
+  c = (uchar)c;
+     53e:	0f b6 75 0c          	movzbl 0xc(%ebp),%esi
+  for(; n > 0 && ((uint)s & 3); n--, s++)
+     542:	eb 06                	jmp    54a <memchr+0x18>
+     544:	83 ea 01             	sub    $0x1,%edx
+     547:	83 c0 01             	add    $0x1,%eax
+     54a:	85 d2                	test   %edx,%edx
+     54c:	74 0d                	je     55b <memchr+0x29>
+     54e:	a8 03                	test   $0x3,%al
+     550:	74 09                	je     55b <memchr+0x29>
+    if(*s == c)
+     552:	0f b6 08             	movzbl (%eax),%ecx
+     555:	39 f1                	cmp    %esi,%ecx
+     557:	75 eb                	jne    544 <memchr+0x12>
+     559:	eb 41                	jmp    59c <memchr+0x6a>
+      return (void*)s;
+  rep = c * 0x01010101;
+     55b:	69 fe 01 01 01 01    	imul   $0x1010101,%esi,%edi
+  for(; n >= 4; n -= 4, s += 4){
+     561:	eb 06                	jmp    569 <memchr+0x37>
+     563:	83 ea 04             	sub    $0x4,%edx
+     566:	83 c0 04             	add    $0x4,%eax
+     569:	83 fa 03             	cmp    $0x3,%edx
+     56c:	76 16                	jbe    584 <memchr+0x52>
+    w = *(uint*)s ^ rep;
+     56e:	89 f9                	mov    %edi,%ecx
+     570:	33 08                	xor    (%eax),%ecx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     572:	8d 99 ff fe fe fe    	lea    -0x1010101(%ecx),%ebx
+     578:	f7 d1                	not    %ecx
+     57a:	21 cb                	and    %ecx,%ebx
+     57c:	f7 c3 80 80 80 80    	test   $0x80808080,%ebx
+     582:	74 df                	je     563 <memchr+0x31>
+      break;
+  }
+  for(; n > 0; n--, s++)
+     584:	85 d2                	test   %edx,%edx
+     586:	74 0f                	je     597 <memchr+0x65>
+    if(*s == c)
+     588:	0f b6 08             	movzbl (%eax),%ecx
+     58b:	39 f1                	cmp    %esi,%ecx
+     58d:	74 0d                	je     59c <memchr+0x6a>
+  for(; n > 0; n--, s++)
+     58f:	83 ea 01             	sub    $0x1,%edx
+     592:	83 c0 01             	add    $0x1,%eax
+     595:	eb ed                	jmp    584 <memchr+0x52>
+      return (void*)s;
+  return 0;
+     597:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     59c:	5b                   	pop    %ebx
+     59d:	5e                   	pop    %esi
+     59e:	5f                   	pop    %edi
+     59f:	5d                   	pop    %ebp
+     5a0:	c3                   	ret
+
+000005a1 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     5a1:	55                   	push   %ebp
+     5a2:	89 e5                	mov    %esp,%ebp
+     5a4:	57                   	push   %edi
+     5a5:	56                   	push   %esi
+     5a6:	53                   	push   %ebx
+     5a7:	83 ec 1c             	sub    $0x1c,%esp
+     5aa:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     5ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+     5b2:	89 de                	mov    %ebx,%esi
+     5b4:	83 c3 01             	add    $0x1,%ebx
+     5b7:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     5ba:	7d 2e                	jge    5ea <gets+0x49>
+    cc = read(0, &c, 1);
+     5bc:	83 ec 04             	sub    $0x4,%esp
+     5bf:	6a 01                	push   $0x1
+     5c1:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     5c4:	50                   	push   %eax
+     5c5:	6a 00                	push   $0x0
+     5c7:	e8 51 05 00 00       	call   b1d <read>
+    if(cc < 1)
+     5cc:	83 c4 10             	add    $0x10,%esp
+     5cf:	85 c0                	test   %eax,%eax
+     5d1:	7e 17                	jle    5ea <gets+0x49>
+      break;
+    buf[i++] = c;
+     5d3:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     5d7:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+     5da:	3c 0a                	cmp    $0xa,%al
+     5dc:	0f 94 c2             	sete   %dl
+     5df:	3c 0d                	cmp    $0xd,%al
+     5e1:	0f 94 c0             	sete   %al
+     5e4:	08 c2                	or     %al,%dl
+     5e6:	74 ca                	je     5b2 <gets+0x11>
+    buf[i++] = c;
+     5e8:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+     5ea:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+     5ee:	89 f8                	mov    %edi,%eax
+     5f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     5f3:	5b                   	pop    %ebx
+     5f4:	5e                   	pop    %esi
+     5f5:	5f                   	pop    %edi
+     5f6:	5d                   	pop    %ebp
+     5f7:	c3                   	ret
+
+000005f8 <atoi>:
+  return r;
+}
+
+int
+atoi(const char *s)
+{
+     5f8:	55                   	push   %ebp
+     5f9:	89 e5                	mov    %esp,%ebp
+     5fb:	53                   	push   %ebx
+     5fc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+     5ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+     604:	eb 10                	jmp    616 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+     606:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+     609:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+     60c:	83 c1 01             	add    $0x1,%ecx
+     60f:	0f be c0             	movsbl %al,%eax
+     612:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+     616:	0f b6 01             	movzbl (%ecx),%eax
+     619:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     61c:	80 fb 09             	cmp    $0x9,%bl
+     61f:	76 e5                	jbe    606 <atoi+0xe>
+  return n;
+}
+     621:	89 d0                	mov    %edx,%eax
+     623:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     626:	c9                   	leave
+     627:	c3                   	ret
+
+00000628 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     628:	55                   	push   %ebp
+     629:	89 e5                	mov    %esp,%ebp
+     62b:	57                   	push   %edi
+     62c:	56                   	push   %esi
+     62d:	53                   	push   %ebx
+     62e:	83 ec 08             	sub    $0x8,%esp
+     631:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     634:	8b 55 0c             	mov    0xc(%ebp),%edx
+     637:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *src;
+  int h;
+
+  dst = vdst;
+  src = vsrc;
+  if(n <= 0)
+     63a:	85 c0                	test   %eax,%eax
+     63c:	0f 8e 82 00 00 00    	jle    6c4 <memmove+0x9c>
+    return vdst;
+  if(src < dst && src + n > dst){
+     642:	39 da                	cmp    %ebx,%edx
+     644:	73 07                	jae    64d <memmove+0x25>
+     646:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+     649:	39 cb                	cmp    %ecx,%ebx
+     64b:	72 5e                	jb     6ab <memmove+0x83>
+    movsbback(dst + n - 1, src + n - 1, n);
+    return vdst;
+  }
+  if(n >= 16 && (((uint)dst ^ (uint)src) & 3) == 0){
+     64d:	83 f8 0f             	cmp    $0xf,%eax
+     650:	7e 69                	jle    6bb <memmove+0x93>
+     652:	89 d9                	mov    %ebx,%ecx
+     654:	31 d1                	xor    %edx,%ecx
+     656:	f6 c1 03             	test   $0x3,%cl
+     659:	75 73                	jne    6ce <memmove+0xa6>
+    h = -(uint)dst & 3;
+     65b:	89 d9                	mov    %ebx,%ecx
+     65d:	f7 d9                	neg    %ecx
+     65f:	83 e1 03             	and    $0x3,%ecx
+}
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsb" :
+     662:	89 df                	mov    %ebx,%edi
+     664:	89 d6                	mov    %edx,%esi
+     666:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+     669:	fc                   	cld
+     66a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    movsb(dst, src, h);
+    dst += h, src += h, n -= h;
+     66c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+     66f:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+     672:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+     675:	29 f0                	sub    %esi,%eax
+    movsl(dst, src, n/4);
+     677:	8d 50 03             	lea    0x3(%eax),%edx
+     67a:	0f 49 d0             	cmovns %eax,%edx
+     67d:	c1 fa 02             	sar    $0x2,%edx
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+     680:	89 7d f0             	mov    %edi,-0x10(%ebp)
+     683:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     686:	89 ce                	mov    %ecx,%esi
+     688:	89 d1                	mov    %edx,%ecx
+     68a:	fc                   	cld
+     68b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    dst += n/4*4, src += n/4*4, n %= 4;
+     68d:	c1 e2 02             	shl    $0x2,%edx
+     690:	8b 7d f0             	mov    -0x10(%ebp),%edi
+     693:	01 d7                	add    %edx,%edi
+     695:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     698:	01 ca                	add    %ecx,%edx
+     69a:	89 c6                	mov    %eax,%esi
+     69c:	c1 fe 1f             	sar    $0x1f,%esi
+     69f:	c1 ee 1e             	shr    $0x1e,%esi
+     6a2:	01 f0                	add    %esi,%eax
+     6a4:	83 e0 03             	and    $0x3,%eax
+     6a7:	29 f0                	sub    %esi,%eax
+     6a9:	eb 12                	jmp    6bd <memmove+0x95>
+    movsbback(dst + n - 1, src + n - 1, n);
+     6ab:	8d 78 ff             	lea    -0x1(%eax),%edi
+     6ae:	8d 34 3a             	lea    (%edx,%edi,1),%esi
+     6b1:	01 df                	add    %ebx,%edi
+// Copy cnt bytes down from the last ones, at dst and src, to the
+// first: for overlapping moves up.
+static inline void
+movsbback(void *dst, const void *src, int cnt)
+{
+  asm volatile("std; rep movsb; cld" :
+     6b3:	89 c1                	mov    %eax,%ecx
+     6b5:	fd                   	std
+     6b6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     6b8:	fc                   	cld
+    return vdst;
+     6b9:	eb 09                	jmp    6c4 <memmove+0x9c>
+  dst = vdst;
+     6bb:	89 df                	mov    %ebx,%edi
+  asm volatile("cld; rep movsb" :
+     6bd:	89 d6                	mov    %edx,%esi
+     6bf:	89 c1                	mov    %eax,%ecx
+     6c1:	fc                   	cld
+     6c2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  }
+  movsb(dst, src, n);
+  return vdst;
+}
+     6c4:	89 d8                	mov    %ebx,%eax
+     6c6:	83 c4 08             	add    $0x8,%esp
+     6c9:	5b                   	pop    %ebx
+     6ca:	5e                   	pop    %esi
+     6cb:	5f                   	pop    %edi
+     6cc:	5d                   	pop    %ebp
+     6cd:	c3                   	ret
+  dst = vdst;
+     6ce:	89 df                	mov    %ebx,%edi
+     6d0:	eb eb                	jmp    6bd <memmove+0x95>
+
+000006d2 <vclock_gettime>:
+
+// clock_gettime() without a system call: read the clock page
+// that the kernel maps at CLOCKPAGE (see clock.h).
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+     6d2:	55                   	push   %ebp
+     6d3:	89 e5                	mov    %esp,%ebp
+     6d5:	57                   	push   %edi
+     6d6:	56                   	push   %esi
+     6d7:	53                   	push   %ebx
+     6d8:	83 ec 14             	sub    $0x14,%esp
+  struct clockpage *cp = (struct clockpage*)CLOCKPAGE;
+  uint seq, rem, d;
+  uint64 tsc, ns, now;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+     6db:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     6df:	0f 87 a3 00 00 00    	ja     788 <vclock_gettime+0xb6>
+    return -1;
+  do {
+    seq = cp->seq;
+     6e5:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+    __sync_synchronize();
+     6ea:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    tsc = cp->tsc;
+     6ef:	8b 15 10 f0 ff 7f    	mov    0x7ffff010,%edx
+     6f5:	8b 1d 14 f0 ff 7f    	mov    0x7ffff014,%ebx
+    ns = cp->ns;
+     6fb:	8b 35 18 f0 ff 7f    	mov    0x7ffff018,%esi
+     701:	8b 3d 1c f0 ff 7f    	mov    0x7ffff01c,%edi
+    __sync_synchronize();
+     707:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != cp->seq);
+     70c:	89 c1                	mov    %eax,%ecx
+     70e:	83 e1 01             	and    $0x1,%ecx
+     711:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     714:	75 cf                	jne    6e5 <vclock_gettime+0x13>
+     716:	8b 0d 00 f0 ff 7f    	mov    0x7ffff000,%ecx
+     71c:	39 c1                	cmp    %eax,%ecx
+     71e:	75 c5                	jne    6e5 <vclock_gettime+0x13>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+     720:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     723:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     726:	0f 31                	rdtsc
+     728:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     72b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     72e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  now = rdtsc();
+  // Less than a tick has passed since the update, so the delta
+  // fits in 32 bits.
+  d = now > tsc ? now - tsc : 0;
+     731:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     734:	19 d3                	sbb    %edx,%ebx
+     736:	73 07                	jae    73f <vclock_gettime+0x6d>
+     738:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+     73b:	29 d8                	sub    %ebx,%eax
+     73d:	89 c1                	mov    %eax,%ecx
+  ns += ((uint64)d * cp->mult) >> cp->shift;
+     73f:	89 c8                	mov    %ecx,%eax
+     741:	f7 25 04 f0 ff 7f    	mull   0x7ffff004
+     747:	0f b6 0d 08 f0 ff 7f 	movzbl 0x7ffff008,%ecx
+     74e:	0f ad d0             	shrd   %cl,%edx,%eax
+     751:	d3 ea                	shr    %cl,%edx
+     753:	f6 c1 20             	test   $0x20,%cl
+     756:	74 04                	je     75c <vclock_gettime+0x8a>
+     758:	89 d0                	mov    %edx,%eax
+     75a:	31 d2                	xor    %edx,%edx
+     75c:	01 f0                	add    %esi,%eax
+     75e:	11 fa                	adc    %edi,%edx
+static inline uint
+divl(uint64 n, uint d, uint *r)
+{
+  uint q;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (*r) :
+     760:	bb 00 ca 9a 3b       	mov    $0x3b9aca00,%ebx
+     765:	f7 f3                	div    %ebx
+  ts->tv_sec = divl(ns, 1000000000, &rem);
+     767:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     76a:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = rem;
+     76c:	89 57 04             	mov    %edx,0x4(%edi)
+  if(clk == CLOCK_REALTIME)
+     76f:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     773:	75 1a                	jne    78f <vclock_gettime+0xbd>
+    ts->tv_sec += cp->boottime;
+     775:	03 05 0c f0 ff 7f    	add    0x7ffff00c,%eax
+     77b:	89 07                	mov    %eax,(%edi)
+  return 0;
+     77d:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     780:	83 c4 14             	add    $0x14,%esp
+     783:	5b                   	pop    %ebx
+     784:	5e                   	pop    %esi
+     785:	5f                   	pop    %edi
+     786:	5d                   	pop    %ebp
+     787:	c3                   	ret
+    return -1;
+     788:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     78d:	eb f1                	jmp    780 <vclock_gettime+0xae>
+  return 0;
+     78f:	b8 00 00 00 00       	mov    $0x0,%eax
+     794:	eb ea                	jmp    780 <vclock_gettime+0xae>
+
+00000796 <flush>:
+
+// Write out fd's buffer, or with fd < 0 every buffer.
+// Returns -1 if a write fails.
+int
+flush(int fd)
+{
+     796:	55                   	push   %ebp
+     797:	89 e5                	mov    %esp,%ebp
+     799:	56                   	push   %esi
+     79a:	53                   	push   %ebx
+     79b:	8b 45 08             	mov    0x8(%ebp),%eax
+  int r, n;
+
+  if(fd < 0){
+     79e:	85 c0                	test   %eax,%eax
+     7a0:	78 5d                	js     7ff <flush+0x69>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+      if(flush(fd) < 0)
+        r = -1;
+    return r;
+  }
+  if(fd >= NOBUF || (n = obuf[fd].n) == 0)
+     7a2:	83 f8 0f             	cmp    $0xf,%eax
+     7a5:	7f 64                	jg     80b <flush+0x75>
+     7a7:	69 d0 08 02 00 00    	imul   $0x208,%eax,%edx
+     7ad:	8b b2 24 b0 00 00    	mov    0xb024(%edx),%esi
+     7b3:	85 f6                	test   %esi,%esi
+     7b5:	74 59                	je     810 <flush+0x7a>
+    return 0;
+  obuf[fd].n = 0;
+     7b7:	c7 82 24 b0 00 00 00 	movl   $0x0,0xb024(%edx)
+     7be:	00 00 00 
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     7c1:	81 c2 28 b0 00 00    	add    $0xb028,%edx
+     7c7:	83 ec 04             	sub    $0x4,%esp
+     7ca:	56                   	push   %esi
+     7cb:	52                   	push   %edx
+     7cc:	50                   	push   %eax
+     7cd:	e8 5a 03 00 00       	call   b2c <write>
+     7d2:	83 c4 10             	add    $0x10,%esp
+     7d5:	39 f0                	cmp    %esi,%eax
+     7d7:	75 40                	jne    819 <flush+0x83>
+     7d9:	be 00 00 00 00       	mov    $0x0,%esi
+     7de:	eb 30                	jmp    810 <flush+0x7a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     7e0:	83 c3 01             	add    $0x1,%ebx
+     7e3:	83 fb 0f             	cmp    $0xf,%ebx
+     7e6:	7f 28                	jg     810 <flush+0x7a>
+      if(flush(fd) < 0)
+     7e8:	83 ec 0c             	sub    $0xc,%esp
+     7eb:	53                   	push   %ebx
+     7ec:	e8 a5 ff ff ff       	call   796 <flush>
+     7f1:	83 c4 10             	add    $0x10,%esp
+     7f4:	85 c0                	test   %eax,%eax
+     7f6:	79 e8                	jns    7e0 <flush+0x4a>
+        r = -1;
+     7f8:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     7fd:	eb e1                	jmp    7e0 <flush+0x4a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     7ff:	be 00 00 00 00       	mov    $0x0,%esi
+     804:	bb 00 00 00 00       	mov    $0x0,%ebx
+     809:	eb d8                	jmp    7e3 <flush+0x4d>
+    return 0;
+     80b:	be 00 00 00 00       	mov    $0x0,%esi
+}
+     810:	89 f0                	mov    %esi,%eax
+     812:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     815:	5b                   	pop    %ebx
+     816:	5e                   	pop    %esi
+     817:	5d                   	pop    %ebp
+     818:	c3                   	ret
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     819:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     81e:	eb f0                	jmp    810 <flush+0x7a>
+
+00000820 <bufreset>:
+
+static void
+bufreset(int fd)
+{
+  if(fd >= 0 && fd < NOBUF){
+     820:	83 f8 0f             	cmp    $0xf,%eax
+     823:	76 01                	jbe    826 <bufreset+0x6>
+     825:	c3                   	ret
+{
+     826:	55                   	push   %ebp
+     827:	89 e5                	mov    %esp,%ebp
+     829:	53                   	push   %ebx
+     82a:	83 ec 10             	sub    $0x10,%esp
+     82d:	89 c3                	mov    %eax,%ebx
+    flush(fd);
+     82f:	50                   	push   %eax
+     830:	e8 61 ff ff ff       	call   796 <flush>
+    obuf[fd].mode = BUNKNOWN;
+     835:	69 db 08 02 00 00    	imul   $0x208,%ebx,%ebx
+     83b:	c7 83 20 b0 00 00 00 	movl   $0x0,0xb020(%ebx)
+     842:	00 00 00 
+     845:	83 c4 10             	add    $0x10,%esp
+  }
+}
+     848:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     84b:	c9                   	leave
+     84c:	c3                   	ret
+
+0000084d <bufwrite>:
+
+// Write n bytes from p to fd, through its buffer.
+// Returns n, or -1 if a write fails.
+int
+bufwrite(int fd, const void *p, int n)
+{
+     84d:	55                   	push   %ebp
+     84e:	89 e5                	mov    %esp,%ebp
+     850:	57                   	push   %edi
+     851:	56                   	push   %esi
+     852:	53                   	push   %ebx
+     853:	83 ec 3c             	sub    $0x3c,%esp
+     856:	8b 75 08             	mov    0x8(%ebp),%esi
+     859:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct stat st;
+  const char *s;
+  int i;
+
+  if(fd < 0 || fd >= NOBUF)
+     85c:	83 fe 0f             	cmp    $0xf,%esi
+     85f:	0f 87 a2 00 00 00    	ja     907 <bufwrite+0xba>
+    return write(fd, p, n);
+  if(obuf[fd].mode == BUNKNOWN){
+     865:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     86b:	83 b8 20 b0 00 00 00 	cmpl   $0x0,0xb020(%eax)
+     872:	75 19                	jne    88d <bufwrite+0x40>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     874:	83 fe 02             	cmp    $0x2,%esi
+     877:	0f 85 9c 00 00 00    	jne    919 <bufwrite+0xcc>
+      obuf[fd].mode = BNONE;
+     87d:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     883:	c7 80 20 b0 00 00 01 	movl   $0x1,0xb020(%eax)
+     88a:	00 00 00 
+    else
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+  }
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     88d:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     893:	89 da                	mov    %ebx,%edx
+     895:	03 90 24 b0 00 00    	add    0xb024(%eax),%edx
+     89b:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+     8a1:	0f 8f ae 00 00 00    	jg     955 <bufwrite+0x108>
+    return -1;
+  if(n >= OBUFSZ)
+     8a7:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+     8ad:	0f 8f bd 00 00 00    	jg     970 <bufwrite+0x123>
+    return write(fd, p, n);
+  memmove(obuf[fd].buf + obuf[fd].n, p, n);
+     8b3:	69 d6 08 02 00 00    	imul   $0x208,%esi,%edx
+     8b9:	8d ba 20 b0 00 00    	lea    0xb020(%edx),%edi
+     8bf:	8b 82 24 b0 00 00    	mov    0xb024(%edx),%eax
+     8c5:	83 ec 04             	sub    $0x4,%esp
+     8c8:	53                   	push   %ebx
+     8c9:	ff 75 0c             	push   0xc(%ebp)
+     8cc:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     8cf:	8d 84 10 28 b0 00 00 	lea    0xb028(%eax,%edx,1),%eax
+     8d6:	50                   	push   %eax
+     8d7:	e8 4c fd ff ff       	call   628 <memmove>
+  obuf[fd].n += n;
+     8dc:	01 5f 04             	add    %ebx,0x4(%edi)
+  if(obuf[fd].mode == BNONE)
+     8df:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     8e2:	8b 82 20 b0 00 00    	mov    0xb020(%edx),%eax
+     8e8:	83 c4 10             	add    $0x10,%esp
+     8eb:	83 f8 01             	cmp    $0x1,%eax
+     8ee:	0f 84 91 00 00 00    	je     985 <bufwrite+0x138>
+    return flush(fd) < 0 ? -1 : n;
+  if(obuf[fd].mode == BLINE)
+     8f4:	83 f8 02             	cmp    $0x2,%eax
+     8f7:	0f 84 ca 00 00 00    	je     9c7 <bufwrite+0x17a>
+    for(s = p, i = 0; i < n; i++)
+      if(s[i] == '\n')
+        return flush(fd) < 0 ? -1 : n;
+  return n;
+     8fd:	89 d8                	mov    %ebx,%eax
+}
+     8ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     902:	5b                   	pop    %ebx
+     903:	5e                   	pop    %esi
+     904:	5f                   	pop    %edi
+     905:	5d                   	pop    %ebp
+     906:	c3                   	ret
+    return write(fd, p, n);
+     907:	83 ec 04             	sub    $0x4,%esp
+     90a:	53                   	push   %ebx
+     90b:	ff 75 0c             	push   0xc(%ebp)
+     90e:	56                   	push   %esi
+     90f:	e8 18 02 00 00       	call   b2c <write>
+     914:	83 c4 10             	add    $0x10,%esp
+     917:	eb e6                	jmp    8ff <bufwrite+0xb2>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     919:	83 ec 08             	sub    $0x8,%esp
+     91c:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     91f:	50                   	push   %eax
+     920:	56                   	push   %esi
+     921:	e8 51 02 00 00       	call   b77 <fstat>
+     926:	83 c4 10             	add    $0x10,%esp
+     929:	85 c0                	test   %eax,%eax
+     92b:	0f 88 4c ff ff ff    	js     87d <bufwrite+0x30>
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+     931:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     936:	74 16                	je     94e <bufwrite+0x101>
+     938:	ba 03 00 00 00       	mov    $0x3,%edx
+     93d:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     943:	89 90 20 b0 00 00    	mov    %edx,0xb020(%eax)
+     949:	e9 3f ff ff ff       	jmp    88d <bufwrite+0x40>
+     94e:	ba 02 00 00 00       	mov    $0x2,%edx
+     953:	eb e8                	jmp    93d <bufwrite+0xf0>
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     955:	83 ec 0c             	sub    $0xc,%esp
+     958:	56                   	push   %esi
+     959:	e8 38 fe ff ff       	call   796 <flush>
+     95e:	83 c4 10             	add    $0x10,%esp
+     961:	85 c0                	test   %eax,%eax
+     963:	0f 89 3e ff ff ff    	jns    8a7 <bufwrite+0x5a>
+    return -1;
+     969:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     96e:	eb 8f                	jmp    8ff <bufwrite+0xb2>
+    return write(fd, p, n);
+     970:	83 ec 04             	sub    $0x4,%esp
+     973:	53                   	push   %ebx
+     974:	ff 75 0c             	push   0xc(%ebp)
+     977:	56                   	push   %esi
+     978:	e8 af 01 00 00       	call   b2c <write>
+     97d:	83 c4 10             	add    $0x10,%esp
+     980:	e9 7a ff ff ff       	jmp    8ff <bufwrite+0xb2>
+    return flush(fd) < 0 ? -1 : n;
+     985:	83 ec 0c             	sub    $0xc,%esp
+     988:	56                   	push   %esi
+     989:	e8 08 fe ff ff       	call   796 <flush>
+     98e:	83 c4 10             	add    $0x10,%esp
+     991:	85 c0                	test   %eax,%eax
+     993:	78 07                	js     99c <bufwrite+0x14f>
+     995:	89 d8                	mov    %ebx,%eax
+     997:	e9 63 ff ff ff       	jmp    8ff <bufwrite+0xb2>
+     99c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     9a1:	e9 59 ff ff ff       	jmp    8ff <bufwrite+0xb2>
+        return flush(fd) < 0 ? -1 : n;
+     9a6:	83 ec 0c             	sub    $0xc,%esp
+     9a9:	56                   	push   %esi
+     9aa:	e8 e7 fd ff ff       	call   796 <flush>
+     9af:	83 c4 10             	add    $0x10,%esp
+     9b2:	85 c0                	test   %eax,%eax
+     9b4:	78 07                	js     9bd <bufwrite+0x170>
+     9b6:	89 d8                	mov    %ebx,%eax
+     9b8:	e9 42 ff ff ff       	jmp    8ff <bufwrite+0xb2>
+     9bd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     9c2:	e9 38 ff ff ff       	jmp    8ff <bufwrite+0xb2>
+    for(s = p, i = 0; i < n; i++)
+     9c7:	b8 00 00 00 00       	mov    $0x0,%eax
+     9cc:	39 d8                	cmp    %ebx,%eax
+     9ce:	7d 0e                	jge    9de <bufwrite+0x191>
+      if(s[i] == '\n')
+     9d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     9d3:	80 3c 01 0a          	cmpb   $0xa,(%ecx,%eax,1)
+     9d7:	74 cd                	je     9a6 <bufwrite+0x159>
+    for(s = p, i = 0; i < n; i++)
+     9d9:	83 c0 01             	add    $0x1,%eax
+     9dc:	eb ee                	jmp    9cc <bufwrite+0x17f>
+  return n;
+     9de:	89 d8                	mov    %ebx,%eax
+     9e0:	e9 1a ff ff ff       	jmp    8ff <bufwrite+0xb2>
+
+000009e5 <fork>:
+
+int
+fork(void)
+{
+     9e5:	55                   	push   %ebp
+     9e6:	89 e5                	mov    %esp,%ebp
+     9e8:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     9eb:	6a ff                	push   $0xffffffff
+     9ed:	e8 a4 fd ff ff       	call   796 <flush>
+  return _fork();
+     9f2:	e8 bd 00 00 00       	call   ab4 <_fork>
+}
+     9f7:	c9                   	leave
+     9f8:	c3                   	ret
+
+000009f9 <exit>:
+
+int
+exit(void)
+{
+     9f9:	55                   	push   %ebp
+     9fa:	89 e5                	mov    %esp,%ebp
+     9fc:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     9ff:	6a ff                	push   $0xffffffff
+     a01:	e8 90 fd ff ff       	call   796 <flush>
+  _exit();
+     a06:	e8 b8 00 00 00       	call   ac3 <_exit>
+
+00000a0b <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     a0b:	55                   	push   %ebp
+     a0c:	89 e5                	mov    %esp,%ebp
+     a0e:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     a11:	6a ff                	push   $0xffffffff
+     a13:	e8 7e fd ff ff       	call   796 <flush>
+  return _exec(path, argv);
+     a18:	83 c4 08             	add    $0x8,%esp
+     a1b:	ff 75 0c             	push   0xc(%ebp)
+     a1e:	ff 75 08             	push   0x8(%ebp)
+     a21:	e8 bb 00 00 00       	call   ae1 <_exec>
+}
+     a26:	c9                   	leave
+     a27:	c3                   	ret
+
+00000a28 <close>:
+
+int
+close(int fd)
+{
+     a28:	55                   	push   %ebp
+     a29:	89 e5                	mov    %esp,%ebp
+     a2b:	53                   	push   %ebx
+     a2c:	83 ec 04             	sub    $0x4,%esp
+     a2f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bufreset(fd);
+     a32:	89 d8                	mov    %ebx,%eax
+     a34:	e8 e7 fd ff ff       	call   820 <bufreset>
+  return _close(fd);
+     a39:	83 ec 0c             	sub    $0xc,%esp
+     a3c:	53                   	push   %ebx
+     a3d:	e8 90 00 00 00       	call   ad2 <_close>
+}
+     a42:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a45:	c9                   	leave
+     a46:	c3                   	ret
+
+00000a47 <stat>:
+{
+     a47:	55                   	push   %ebp
+     a48:	89 e5                	mov    %esp,%ebp
+     a4a:	56                   	push   %esi
+     a4b:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     a4c:	83 ec 08             	sub    $0x8,%esp
+     a4f:	6a 00                	push   $0x0
+     a51:	ff 75 08             	push   0x8(%ebp)
+     a54:	e8 f1 00 00 00       	call   b4a <open>
+  if(fd < 0)
+     a59:	83 c4 10             	add    $0x10,%esp
+     a5c:	85 c0                	test   %eax,%eax
+     a5e:	78 24                	js     a84 <stat+0x3d>
+     a60:	89 c3                	mov    %eax,%ebx
+  r = fstat(fd, st);
+     a62:	83 ec 08             	sub    $0x8,%esp
+     a65:	ff 75 0c             	push   0xc(%ebp)
+     a68:	50                   	push   %eax
+     a69:	e8 09 01 00 00       	call   b77 <fstat>
+     a6e:	89 c6                	mov    %eax,%esi
+  close(fd);
+     a70:	89 1c 24             	mov    %ebx,(%esp)
+     a73:	e8 b0 ff ff ff       	call   a28 <close>
+  return r;
+     a78:	83 c4 10             	add    $0x10,%esp
+}
+     a7b:	89 f0                	mov    %esi,%eax
+     a7d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     a80:	5b                   	pop    %ebx
+     a81:	5e                   	pop    %esi
+     a82:	5d                   	pop    %ebp
+     a83:	c3                   	ret
+    return -1;
+     a84:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     a89:	eb f0                	jmp    a7b <stat+0x34>
+
+00000a8b <dup2>:
+
+int
+dup2(int oldfd, int newfd)
+{
+     a8b:	55                   	push   %ebp
+     a8c:	89 e5                	mov    %esp,%ebp
+     a8e:	56                   	push   %esi
+     a8f:	53                   	push   %ebx
+     a90:	8b 75 08             	mov    0x8(%ebp),%esi
+     a93:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(oldfd != newfd)
+     a96:	39 de                	cmp    %ebx,%esi
+     a98:	75 11                	jne    aab <dup2+0x20>
+    bufreset(newfd);
+  return _dup2(oldfd, newfd);
+     a9a:	83 ec 08             	sub    $0x8,%esp
+     a9d:	53                   	push   %ebx
+     a9e:	56                   	push   %esi
+     a9f:	e8 4c 00 00 00       	call   af0 <_dup2>
+}
+     aa4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     aa7:	5b                   	pop    %ebx
+     aa8:	5e                   	pop    %esi
+     aa9:	5d                   	pop    %ebp
+     aaa:	c3                   	ret
+    bufreset(newfd);
+     aab:	89 d8                	mov    %ebx,%eax
+     aad:	e8 6e fd ff ff       	call   820 <bufreset>
+     ab2:	eb e6                	jmp    a9a <dup2+0xf>
+
+00000ab4 <_fork>:
+  1: ret
+
+#define SYSCALL(name) STUB(name, SYS_ ## name)
+
+# ulib.c wraps these, to flush printf()'s buffers first.
+STUB(_fork, SYS_fork)
+     ab4:	b8 01 00 00 00       	mov    $0x1,%eax
+     ab9:	89 e1                	mov    %esp,%ecx
+     abb:	ba c2 0a 00 00       	mov    $0xac2,%edx
+     ac0:	0f 34                	sysenter
+     ac2:	c3                   	ret
+
+00000ac3 <_exit>:
+STUB(_exit, SYS_exit)
+     ac3:	b8 02 00 00 00       	mov    $0x2,%eax
+     ac8:	89 e1                	mov    %esp,%ecx
+     aca:	ba d1 0a 00 00       	mov    $0xad1,%edx
+     acf:	0f 34                	sysenter
+     ad1:	c3                   	ret
+
+00000ad2 <_close>:
+STUB(_close, SYS_close)
+     ad2:	b8 15 00 00 00       	mov    $0x15,%eax
+     ad7:	89 e1                	mov    %esp,%ecx
+     ad9:	ba e0 0a 00 00       	mov    $0xae0,%edx
+     ade:	0f 34                	sysenter
+     ae0:	c3                   	ret
+
+00000ae1 <_exec>:
+STUB(_exec, SYS_exec)
+     ae1:	b8 07 00 00 00       	mov    $0x7,%eax
+     ae6:	89 e1                	mov    %esp,%ecx
+     ae8:	ba ef 0a 00 00       	mov    $0xaef,%edx
+     aed:	0f 34                	sysenter
+     aef:	c3                   	ret
+
+00000af0 <_dup2>:
+STUB(_dup2, SYS_dup2)
+     af0:	b8 17 00 00 00       	mov    $0x17,%eax
+     af5:	89 e1                	mov    %esp,%ecx
+     af7:	ba fe 0a 00 00       	mov    $0xafe,%edx
+     afc:	0f 34                	sysenter
+     afe:	c3                   	ret
+
+00000aff <wait>:
+
+SYSCALL(wait)
+     aff:	b8 03 00 00 00       	mov    $0x3,%eax
+     b04:	89 e1                	mov    %esp,%ecx
+     b06:	ba 0d 0b 00 00       	mov    $0xb0d,%edx
+     b0b:	0f 34                	sysenter
+     b0d:	c3                   	ret
+
+00000b0e <pipe>:
+SYSCALL(pipe)
+     b0e:	b8 04 00 00 00       	mov    $0x4,%eax
+     b13:	89 e1                	mov    %esp,%ecx
+     b15:	ba 1c 0b 00 00       	mov    $0xb1c,%edx
+     b1a:	0f 34                	sysenter
+     b1c:	c3                   	ret
+
+00000b1d <read>:
+SYSCALL(read)
+     b1d:	b8 05 00 00 00       	mov    $0x5,%eax
+     b22:	89 e1                	mov    %esp,%ecx
+     b24:	ba 2b 0b 00 00       	mov    $0xb2b,%edx
+     b29:	0f 34                	sysenter
+     b2b:	c3                   	ret
+
+00000b2c <write>:
+SYSCALL(write)
+     b2c:	b8 10 00 00 00       	mov    $0x10,%eax
+     b31:	89 e1                	mov    %esp,%ecx
+     b33:	ba 3a 0b 00 00       	mov    $0xb3a,%edx
+     b38:	0f 34                	sysenter
+     b3a:	c3                   	ret
+
+00000b3b <kill>:
+SYSCALL(kill)
+     b3b:	b8 06 00 00 00       	mov    $0x6,%eax
+     b40:	89 e1                	mov    %esp,%ecx
+     b42:	ba 49 0b 00 00       	mov    $0xb49,%edx
+     b47:	0f 34                	sysenter
+     b49:	c3                   	ret
+
+00000b4a <open>:
+SYSCALL(open)
+     b4a:	b8 0f 00 00 00       	mov    $0xf,%eax
+     b4f:	89 e1                	mov    %esp,%ecx
+     b51:	ba 58 0b 00 00       	mov    $0xb58,%edx
+     b56:	0f 34                	sysenter
+     b58:	c3                   	ret
+
+00000b59 <mknod>:
+SYSCALL(mknod)
+     b59:	b8 11 00 00 00       	mov    $0x11,%eax
+     b5e:	89 e1                	mov    %esp,%ecx
+     b60:	ba 67 0b 00 00       	mov    $0xb67,%edx
+     b65:	0f 34                	sysenter
+     b67:	c3                   	ret
+
+00000b68 <unlink>:
+SYSCALL(unlink)
+     b68:	b8 12 00 00 00       	mov    $0x12,%eax
+     b6d:	89 e1                	mov    %esp,%ecx
+     b6f:	ba 76 0b 00 00       	mov    $0xb76,%edx
+     b74:	0f 34                	sysenter
+     b76:	c3                   	ret
+
+00000b77 <fstat>:
+SYSCALL(fstat)
+     b77:	b8 08 00 00 00       	mov    $0x8,%eax
+     b7c:	89 e1                	mov    %esp,%ecx
+     b7e:	ba 85 0b 00 00       	mov    $0xb85,%edx
+     b83:	0f 34                	sysenter
+     b85:	c3                   	ret
+
+00000b86 <link>:
+SYSCALL(link)
+     b86:	b8 13 00 00 00       	mov    $0x13,%eax
+     b8b:	89 e1                	mov    %esp,%ecx
+     b8d:	ba 94 0b 00 00       	mov    $0xb94,%edx
+     b92:	0f 34                	sysenter
+     b94:	c3                   	ret
+
+00000b95 <mkdir>:
+SYSCALL(mkdir)
+     b95:	b8 14 00 00 00       	mov    $0x14,%eax
+     b9a:	89 e1                	mov    %esp,%ecx
+     b9c:	ba a3 0b 00 00       	mov    $0xba3,%edx
+     ba1:	0f 34                	sysenter
+     ba3:	c3                   	ret
+
+00000ba4 <chdir>:
+SYSCALL(chdir)
+     ba4:	b8 09 00 00 00       	mov    $0x9,%eax
+     ba9:	89 e1                	mov    %esp,%ecx
+     bab:	ba b2 0b 00 00       	mov    $0xbb2,%edx
+     bb0:	0f 34                	sysenter
+     bb2:	c3                   	ret
+
+00000bb3 <dup>:
+SYSCALL(dup)
+     bb3:	b8 0a 00 00 00       	mov    $0xa,%eax
+     bb8:	89 e1                	mov    %esp,%ecx
+     bba:	ba c1 0b 00 00       	mov    $0xbc1,%edx
+     bbf:	0f 34                	sysenter
+     bc1:	c3                   	ret
+
+00000bc2 <getpid>:
+SYSCALL(getpid)
+     bc2:	b8 0b 00 00 00       	mov    $0xb,%eax
+     bc7:	89 e1                	mov    %esp,%ecx
+     bc9:	ba d0 0b 00 00       	mov    $0xbd0,%edx
+     bce:	0f 34                	sysenter
+     bd0:	c3                   	ret
+
+00000bd1 <sbrk>:
+SYSCALL(sbrk)
+     bd1:	b8 0c 00 00 00       	mov    $0xc,%eax
+     bd6:	89 e1                	mov    %esp,%ecx
+     bd8:	ba df 0b 00 00       	mov    $0xbdf,%edx
+     bdd:	0f 34                	sysenter
+     bdf:	c3                   	ret
+
+00000be0 <sleep>:
+SYSCALL(sleep)
+     be0:	b8 0d 00 00 00       	mov    $0xd,%eax
+     be5:	89 e1                	mov    %esp,%ecx
+     be7:	ba ee 0b 00 00       	mov    $0xbee,%edx
+     bec:	0f 34                	sysenter
+     bee:	c3                   	ret
+
+00000bef <uptime>:
+SYSCALL(uptime)
+     bef:	b8 0e 00 00 00       	mov    $0xe,%eax
+     bf4:	89 e1                	mov    %esp,%ecx
+     bf6:	ba fd 0b 00 00       	mov    $0xbfd,%edx
+     bfb:	0f 34                	sysenter
+     bfd:	c3                   	ret
+
+00000bfe <date>:
+SYSCALL(date)
+     bfe:	b8 16 00 00 00       	mov    $0x16,%eax
+     c03:	89 e1                	mov    %esp,%ecx
+     c05:	ba 0c 0c 00 00       	mov    $0xc0c,%edx
+     c0a:	0f 34                	sysenter
+     c0c:	c3                   	ret
+
+00000c0d <faultaround>:
+SYSCALL(faultaround)
+     c0d:	b8 18 00 00 00       	mov    $0x18,%eax
+     c12:	89 e1                	mov    %esp,%ecx
+     c14:	ba 1b 0c 00 00       	mov    $0xc1b,%edx
+     c19:	0f 34                	sysenter
+     c1b:	c3                   	ret
+
+00000c1c <faultstat>:
+SYSCALL(faultstat)
+     c1c:	b8 19 00 00 00       	mov    $0x19,%eax
+     c21:	89 e1                	mov    %esp,%ecx
+     c23:	ba 2a 0c 00 00       	mov    $0xc2a,%edx
+     c28:	0f 34                	sysenter
+     c2a:	c3                   	ret
+
+00000c2b <mmap>:
+SYSCALL(mmap)
+     c2b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     c30:	89 e1                	mov    %esp,%ecx
+     c32:	ba 39 0c 00 00       	mov    $0xc39,%edx
+     c37:	0f 34                	sysenter
+     c39:	c3                   	ret
+
+00000c3a <munmap>:
+SYSCALL(munmap)
+     c3a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     c3f:	89 e1                	mov    %esp,%ecx
+     c41:	ba 48 0c 00 00       	mov    $0xc48,%edx
+     c46:	0f 34                	sysenter
+     c48:	c3                   	ret
+
+00000c49 <largepages>:
+SYSCALL(largepages)
+     c49:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     c4e:	89 e1                	mov    %esp,%ecx
+     c50:	ba 57 0c 00 00       	mov    $0xc57,%edx
+     c55:	0f 34                	sysenter
+     c57:	c3                   	ret
+
+00000c58 <spawn>:
+SYSCALL(spawn)
+     c58:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     c5d:	89 e1                	mov    %esp,%ecx
+     c5f:	ba 66 0c 00 00       	mov    $0xc66,%edx
+     c64:	0f 34                	sysenter
+     c66:	c3                   	ret
+
+00000c67 <setpriority>:
+SYSCALL(setpriority)
+     c67:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     c6c:	89 e1                	mov    %esp,%ecx
+     c6e:	ba 75 0c 00 00       	mov    $0xc75,%edx
+     c73:	0f 34                	sysenter
+     c75:	c3                   	ret
+
+00000c76 <getpriority>:
+SYSCALL(getpriority)
+     c76:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     c7b:	89 e1                	mov    %esp,%ecx
+     c7d:	ba 84 0c 00 00       	mov    $0xc84,%edx
+     c82:	0f 34                	sysenter
+     c84:	c3                   	ret
+
+00000c85 <getprocinfo>:
+SYSCALL(getprocinfo)
+     c85:	b8 20 00 00 00       	mov    $0x20,%eax
+     c8a:	89 e1                	mov    %esp,%ecx
+     c8c:	ba 93 0c 00 00       	mov    $0xc93,%edx
+     c91:	0f 34                	sysenter
+     c93:	c3                   	ret
+
+00000c94 <getcpuinfo>:
+SYSCALL(getcpuinfo)
+     c94:	b8 21 00 00 00       	mov    $0x21,%eax
+     c99:	89 e1                	mov    %esp,%ecx
+     c9b:	ba a2 0c 00 00       	mov    $0xca2,%edx
+     ca0:	0f 34                	sysenter
+     ca2:	c3                   	ret
+
+00000ca3 <clone>:
+SYSCALL(clone)
+     ca3:	b8 22 00 00 00       	mov    $0x22,%eax
+     ca8:	89 e1                	mov    %esp,%ecx
+     caa:	ba b1 0c 00 00       	mov    $0xcb1,%edx
+     caf:	0f 34                	sysenter
+     cb1:	c3                   	ret
+
+00000cb2 <join>:
+SYSCALL(join)
+     cb2:	b8 23 00 00 00       	mov    $0x23,%eax
+     cb7:	89 e1                	mov    %esp,%ecx
+     cb9:	ba c0 0c 00 00       	mov    $0xcc0,%edx
+     cbe:	0f 34                	sysenter
+     cc0:	c3                   	ret
+
+00000cc1 <futex_wait>:
+SYSCALL(futex_wait)
+     cc1:	b8 24 00 00 00       	mov    $0x24,%eax
+     cc6:	89 e1                	mov    %esp,%ecx
+     cc8:	ba cf 0c 00 00       	mov    $0xccf,%edx
+     ccd:	0f 34                	sysenter
+     ccf:	c3                   	ret
+
+00000cd0 <futex_wake>:
+SYSCALL(futex_wake)
+     cd0:	b8 25 00 00 00       	mov    $0x25,%eax
+     cd5:	89 e1                	mov    %esp,%ecx
+     cd7:	ba de 0c 00 00       	mov    $0xcde,%edx
+     cdc:	0f 34                	sysenter
+     cde:	c3                   	ret
+
+00000cdf <setaffinity>:
+SYSCALL(setaffinity)
+     cdf:	b8 26 00 00 00       	mov    $0x26,%eax
+     ce4:	89 e1                	mov    %esp,%ecx
+     ce6:	ba ed 0c 00 00       	mov    $0xced,%edx
+     ceb:	0f 34                	sysenter
+     ced:	c3                   	ret
+
+00000cee <getaffinity>:
+SYSCALL(getaffinity)
+     cee:	b8 27 00 00 00       	mov    $0x27,%eax
+     cf3:	89 e1                	mov    %esp,%ecx
+     cf5:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+     cfa:	0f 34                	sysenter
+     cfc:	c3                   	ret
+
+00000cfd <clock_gettime>:
+SYSCALL(clock_gettime)
+     cfd:	b8 28 00 00 00       	mov    $0x28,%eax
+     d02:	89 e1                	mov    %esp,%ecx
+     d04:	ba 0b 0d 00 00       	mov    $0xd0b,%edx
+     d09:	0f 34                	sysenter
+     d0b:	c3                   	ret
+
+00000d0c <msleep>:
+SYSCALL(msleep)
+     d0c:	b8 29 00 00 00       	mov    $0x29,%eax
+     d11:	89 e1                	mov    %esp,%ecx
+     d13:	ba 1a 0d 00 00       	mov    $0xd1a,%edx
+     d18:	0f 34                	sysenter
+     d1a:	c3                   	ret
+
+00000d1b <lockstat>:
+SYSCALL(lockstat)
+     d1b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     d20:	89 e1                	mov    %esp,%ecx
+     d22:	ba 29 0d 00 00       	mov    $0xd29,%edx
+     d27:	0f 34                	sysenter
+     d29:	c3                   	ret
+
+00000d2a <bstat>:
+SYSCALL(bstat)
+     d2a:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     d2f:	89 e1                	mov    %esp,%ecx
+     d31:	ba 38 0d 00 00       	mov    $0xd38,%edx
+     d36:	0f 34                	sysenter
+     d38:	c3                   	ret
+
+00000d39 <iostat>:
+SYSCALL(iostat)
+     d39:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     d3e:	89 e1                	mov    %esp,%ecx
+     d40:	ba 47 0d 00 00       	mov    $0xd47,%edx
+     d45:	0f 34                	sysenter
+     d47:	c3                   	ret
+
+00000d48 <fsync>:
+SYSCALL(fsync)
+     d48:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     d4d:	89 e1                	mov    %esp,%ecx
+     d4f:	ba 56 0d 00 00       	mov    $0xd56,%edx
+     d54:	0f 34                	sysenter
+     d56:	c3                   	ret
+
+00000d57 <pread>:
+SYSCALL(pread)
+     d57:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     d5c:	89 e1                	mov    %esp,%ecx
+     d5e:	ba 65 0d 00 00       	mov    $0xd65,%edx
+     d63:	0f 34                	sysenter
+     d65:	c3                   	ret
+
+00000d66 <pwrite>:
+SYSCALL(pwrite)
+     d66:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     d6b:	89 e1                	mov    %esp,%ecx
+     d6d:	ba 74 0d 00 00       	mov    $0xd74,%edx
+     d72:	0f 34                	sysenter
+     d74:	c3                   	ret
+
+00000d75 <readv>:
+SYSCALL(readv)
+     d75:	b8 30 00 00 00       	mov    $0x30,%eax
+     d7a:	89 e1                	mov    %esp,%ecx
+     d7c:	ba 83 0d 00 00       	mov    $0xd83,%edx
+     d81:	0f 34                	sysenter
+     d83:	c3                   	ret
+
+00000d84 <writev>:
+SYSCALL(writev)
+     d84:	b8 31 00 00 00       	mov    $0x31,%eax
+     d89:	89 e1                	mov    %esp,%ecx
+     d8b:	ba 92 0d 00 00       	mov    $0xd92,%edx
+     d90:	0f 34                	sysenter
+     d92:	c3                   	ret
+
+00000d93 <sendfile>:
+SYSCALL(sendfile)
+     d93:	b8 32 00 00 00       	mov    $0x32,%eax
+     d98:	89 e1                	mov    %esp,%ecx
+     d9a:	ba a1 0d 00 00       	mov    $0xda1,%edx
+     d9f:	0f 34                	sysenter
+     da1:	c3                   	ret
+
+00000da2 <fcntl>:
+SYSCALL(fcntl)
+     da2:	b8 33 00 00 00       	mov    $0x33,%eax
+     da7:	89 e1                	mov    %esp,%ecx
+     da9:	ba b0 0d 00 00       	mov    $0xdb0,%edx
+     dae:	0f 34                	sysenter
+     db0:	c3                   	ret
+
+00000db1 <mount>:
+SYSCALL(mount)
+     db1:	b8 34 00 00 00       	mov    $0x34,%eax
+     db6:	89 e1                	mov    %esp,%ecx
+     db8:	ba bf 0d 00 00       	mov    $0xdbf,%edx
+     dbd:	0f 34                	sysenter
+     dbf:	c3                   	ret
+
+00000dc0 <getdents>:
+SYSCALL(getdents)
+     dc0:	b8 35 00 00 00       	mov    $0x35,%eax
+     dc5:	89 e1                	mov    %esp,%ecx
+     dc7:	ba ce 0d 00 00       	mov    $0xdce,%edx
+     dcc:	0f 34                	sysenter
+     dce:	c3                   	ret
+
+00000dcf <fstatat>:
+SYSCALL(fstatat)
+     dcf:	b8 36 00 00 00       	mov    $0x36,%eax
+     dd4:	89 e1                	mov    %esp,%ecx
+     dd6:	ba dd 0d 00 00       	mov    $0xddd,%edx
+     ddb:	0f 34                	sysenter
+     ddd:	c3                   	ret
+
+00000dde <sysstat>:
+SYSCALL(sysstat)
+     dde:	b8 37 00 00 00       	mov    $0x37,%eax
+     de3:	89 e1                	mov    %esp,%ecx
+     de5:	ba ec 0d 00 00       	mov    $0xdec,%edx
+     dea:	0f 34                	sysenter
+     dec:	c3                   	ret
+
+00000ded <ringenter>:
+SYSCALL(ringenter)
+     ded:	b8 38 00 00 00       	mov    $0x38,%eax
+     df2:	89 e1                	mov    %esp,%ecx
+     df4:	ba fb 0d 00 00       	mov    $0xdfb,%edx
+     df9:	0f 34                	sysenter
+     dfb:	c3                   	ret
+
+00000dfc <trace>:
+SYSCALL(trace)
+     dfc:	b8 39 00 00 00       	mov    $0x39,%eax
+     e01:	89 e1                	mov    %esp,%ecx
+     e03:	ba 0a 0e 00 00       	mov    $0xe0a,%edx
+     e08:	0f 34                	sysenter
+     e0a:	c3                   	ret
+
+00000e0b <memstat>:
+SYSCALL(memstat)
+     e0b:	b8 3a 00 00 00       	mov    $0x3a,%eax
+     e10:	89 e1                	mov    %esp,%ecx
+     e12:	ba 19 0e 00 00       	mov    $0xe19,%edx
+     e17:	0f 34                	sysenter
+     e19:	c3                   	ret
+
+00000e1a <shmget>:
+SYSCALL(shmget)
+     e1a:	b8 3b 00 00 00       	mov    $0x3b,%eax
+     e1f:	89 e1                	mov    %esp,%ecx
+     e21:	ba 28 0e 00 00       	mov    $0xe28,%edx
+     e26:	0f 34                	sysenter
+     e28:	c3                   	ret
+
+00000e29 <shmat>:
+SYSCALL(shmat)
+     e29:	b8 3c 00 00 00       	mov    $0x3c,%eax
+     e2e:	89 e1                	mov    %esp,%ecx
+     e30:	ba 37 0e 00 00       	mov    $0xe37,%edx
+     e35:	0f 34                	sysenter
+     e37:	c3                   	ret
+
+00000e38 <shmdt>:
+SYSCALL(shmdt)
+     e38:	b8 3d 00 00 00       	mov    $0x3d,%eax
+     e3d:	89 e1                	mov    %esp,%ecx
+     e3f:	ba 46 0e 00 00       	mov    $0xe46,%edx
+     e44:	0f 34                	sysenter
+     e46:	c3                   	ret
+
+00000e47 <irqstat>:
+SYSCALL(irqstat)
+     e47:	b8 3e 00 00 00       	mov    $0x3e,%eax
+     e4c:	89 e1                	mov    %esp,%ecx
+     e4e:	ba 55 0e 00 00       	mov    $0xe55,%edx
+     e53:	0f 34                	sysenter
+     e55:	c3                   	ret
+
+00000e56 <irqroute>:
+SYSCALL(irqroute)
+     e56:	b8 3f 00 00 00       	mov    $0x3f,%eax
+     e5b:	89 e1                	mov    %esp,%ecx
+     e5d:	ba 64 0e 00 00       	mov    $0xe64,%edx
+     e62:	0f 34                	sysenter
+     e64:	c3                   	ret
+
+00000e65 <putc>:
+  char buf[64];
+};
+
+static void
+putc(struct out *o, char c)
+{
+     e65:	55                   	push   %ebp
+     e66:	89 e5                	mov    %esp,%ebp
+     e68:	56                   	push   %esi
+     e69:	53                   	push   %ebx
+     e6a:	89 c3                	mov    %eax,%ebx
+     e6c:	89 d6                	mov    %edx,%esi
+  if(o->n == sizeof(o->buf)){
+     e6e:	8b 40 04             	mov    0x4(%eax),%eax
+     e71:	83 f8 40             	cmp    $0x40,%eax
+     e74:	74 16                	je     e8c <putc+0x27>
+    bufwrite(o->fd, o->buf, o->n);
+    o->n = 0;
+  }
+  o->buf[o->n++] = c;
+     e76:	8b 43 04             	mov    0x4(%ebx),%eax
+     e79:	8d 50 01             	lea    0x1(%eax),%edx
+     e7c:	89 53 04             	mov    %edx,0x4(%ebx)
+     e7f:	89 f1                	mov    %esi,%ecx
+     e81:	88 4c 03 08          	mov    %cl,0x8(%ebx,%eax,1)
+}
+     e85:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e88:	5b                   	pop    %ebx
+     e89:	5e                   	pop    %esi
+     e8a:	5d                   	pop    %ebp
+     e8b:	c3                   	ret
+    bufwrite(o->fd, o->buf, o->n);
+     e8c:	8d 53 08             	lea    0x8(%ebx),%edx
+     e8f:	83 ec 04             	sub    $0x4,%esp
+     e92:	50                   	push   %eax
+     e93:	52                   	push   %edx
+     e94:	ff 33                	push   (%ebx)
+     e96:	e8 b2 f9 ff ff       	call   84d <bufwrite>
+    o->n = 0;
+     e9b:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     ea2:	83 c4 10             	add    $0x10,%esp
+     ea5:	eb cf                	jmp    e76 <putc+0x11>
+
+00000ea7 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     ea7:	55                   	push   %ebp
+     ea8:	89 e5                	mov    %esp,%ebp
+     eaa:	57                   	push   %edi
+     eab:	56                   	push   %esi
+     eac:	53                   	push   %ebx
+     ead:	83 ec 2c             	sub    $0x2c,%esp
+     eb0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     eb3:	89 d0                	mov    %edx,%eax
+     eb5:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+     eb7:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     ebb:	0f 95 c1             	setne  %cl
+     ebe:	c1 ea 1f             	shr    $0x1f,%edx
+     ec1:	84 d1                	test   %dl,%cl
+     ec3:	74 44                	je     f09 <printint+0x62>
+    neg = 1;
+    x = -xx;
+     ec5:	f7 d8                	neg    %eax
+     ec7:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+     ec9:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     ed0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+     ed5:	89 c8                	mov    %ecx,%eax
+     ed7:	ba 00 00 00 00       	mov    $0x0,%edx
+     edc:	f7 f6                	div    %esi
+     ede:	89 df                	mov    %ebx,%edi
+     ee0:	83 c3 01             	add    $0x1,%ebx
+     ee3:	0f b6 92 00 16 00 00 	movzbl 0x1600(%edx),%edx
+     eea:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+     eee:	89 ca                	mov    %ecx,%edx
+     ef0:	89 c1                	mov    %eax,%ecx
+     ef2:	39 f2                	cmp    %esi,%edx
+     ef4:	73 df                	jae    ed5 <printint+0x2e>
+  if(neg)
+     ef6:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     efa:	74 31                	je     f2d <printint+0x86>
+    buf[i++] = '-';
+     efc:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+     f01:	8d 5f 02             	lea    0x2(%edi),%ebx
+     f04:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     f07:	eb 17                	jmp    f20 <printint+0x79>
+    x = xx;
+     f09:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+     f0b:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     f12:	eb bc                	jmp    ed0 <printint+0x29>
+
+  while(--i >= 0)
+    putc(o, buf[i]);
+     f14:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+     f19:	89 f0                	mov    %esi,%eax
+     f1b:	e8 45 ff ff ff       	call   e65 <putc>
+  while(--i >= 0)
+     f20:	83 eb 01             	sub    $0x1,%ebx
+     f23:	79 ef                	jns    f14 <printint+0x6d>
+}
+     f25:	83 c4 2c             	add    $0x2c,%esp
+     f28:	5b                   	pop    %ebx
+     f29:	5e                   	pop    %esi
+     f2a:	5f                   	pop    %edi
+     f2b:	5d                   	pop    %ebp
+     f2c:	c3                   	ret
+     f2d:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     f30:	eb ee                	jmp    f20 <printint+0x79>
+
+00000f32 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     f32:	55                   	push   %ebp
+     f33:	89 e5                	mov    %esp,%ebp
+     f35:	57                   	push   %edi
+     f36:	56                   	push   %esi
+     f37:	53                   	push   %ebx
+     f38:	83 ec 6c             	sub    $0x6c,%esp
+  int c, i, state;
+  uint *ap;
+  struct out out, *o;
+
+  o = &out;
+  o->fd = fd;
+     f3b:	8b 45 08             	mov    0x8(%ebp),%eax
+     f3e:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  o->n = 0;
+     f41:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+     f48:	8d 45 10             	lea    0x10(%ebp),%eax
+     f4b:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  state = 0;
+     f4e:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+     f53:	bb 00 00 00 00       	mov    $0x0,%ebx
+     f58:	eb 14                	jmp    f6e <printf+0x3c>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(o, c);
+     f5a:	89 fa                	mov    %edi,%edx
+     f5c:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     f5f:	e8 01 ff ff ff       	call   e65 <putc>
+     f64:	eb 05                	jmp    f6b <printf+0x39>
+      }
+    } else if(state == '%'){
+     f66:	83 fe 25             	cmp    $0x25,%esi
+     f69:	74 25                	je     f90 <printf+0x5e>
+  for(i = 0; fmt[i]; i++){
+     f6b:	83 c3 01             	add    $0x1,%ebx
+     f6e:	8b 45 0c             	mov    0xc(%ebp),%eax
+     f71:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+     f75:	84 c0                	test   %al,%al
+     f77:	0f 84 20 01 00 00    	je     109d <printf+0x16b>
+    c = fmt[i] & 0xff;
+     f7d:	0f be f8             	movsbl %al,%edi
+     f80:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     f83:	85 f6                	test   %esi,%esi
+     f85:	75 df                	jne    f66 <printf+0x34>
+      if(c == '%'){
+     f87:	83 f8 25             	cmp    $0x25,%eax
+     f8a:	75 ce                	jne    f5a <printf+0x28>
+        state = '%';
+     f8c:	89 c6                	mov    %eax,%esi
+     f8e:	eb db                	jmp    f6b <printf+0x39>
+      if(c == 'd'){
+     f90:	83 f8 25             	cmp    $0x25,%eax
+     f93:	0f 84 cf 00 00 00    	je     1068 <printf+0x136>
+     f99:	0f 8c dd 00 00 00    	jl     107c <printf+0x14a>
+     f9f:	83 f8 78             	cmp    $0x78,%eax
+     fa2:	0f 8f d4 00 00 00    	jg     107c <printf+0x14a>
+     fa8:	83 f8 63             	cmp    $0x63,%eax
+     fab:	0f 8c cb 00 00 00    	jl     107c <printf+0x14a>
+     fb1:	83 e8 63             	sub    $0x63,%eax
+     fb4:	83 f8 15             	cmp    $0x15,%eax
+     fb7:	0f 87 bf 00 00 00    	ja     107c <printf+0x14a>
+     fbd:	ff 24 85 a8 15 00 00 	jmp    *0x15a8(,%eax,4)
+        printint(o, *ap, 10, 1);
+     fc4:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     fc7:	8b 17                	mov    (%edi),%edx
+     fc9:	83 ec 0c             	sub    $0xc,%esp
+     fcc:	6a 01                	push   $0x1
+     fce:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     fd3:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     fd6:	e8 cc fe ff ff       	call   ea7 <printint>
+        ap++;
+     fdb:	83 c7 04             	add    $0x4,%edi
+     fde:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     fe1:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(o, '%');
+        putc(o, c);
+      }
+      state = 0;
+     fe4:	be 00 00 00 00       	mov    $0x0,%esi
+     fe9:	eb 80                	jmp    f6b <printf+0x39>
+        printint(o, *ap, 16, 0);
+     feb:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     fee:	8b 17                	mov    (%edi),%edx
+     ff0:	83 ec 0c             	sub    $0xc,%esp
+     ff3:	6a 00                	push   $0x0
+     ff5:	b9 10 00 00 00       	mov    $0x10,%ecx
+     ffa:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     ffd:	e8 a5 fe ff ff       	call   ea7 <printint>
+        ap++;
+    1002:	83 c7 04             	add    $0x4,%edi
+    1005:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+    1008:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    100b:	be 00 00 00 00       	mov    $0x0,%esi
+    1010:	e9 56 ff ff ff       	jmp    f6b <printf+0x39>
+        s = (char*)*ap;
+    1015:	8b 45 94             	mov    -0x6c(%ebp),%eax
+    1018:	8b 30                	mov    (%eax),%esi
+        ap++;
+    101a:	83 c0 04             	add    $0x4,%eax
+    101d:	89 45 94             	mov    %eax,-0x6c(%ebp)
+        if(s == 0)
+    1020:	85 f6                	test   %esi,%esi
+    1022:	75 15                	jne    1039 <printf+0x107>
+          s = "(null)";
+    1024:	be 9e 15 00 00       	mov    $0x159e,%esi
+    1029:	eb 0e                	jmp    1039 <printf+0x107>
+          putc(o, *s);
+    102b:	0f be d2             	movsbl %dl,%edx
+    102e:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    1031:	e8 2f fe ff ff       	call   e65 <putc>
+          s++;
+    1036:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+    1039:	0f b6 16             	movzbl (%esi),%edx
+    103c:	84 d2                	test   %dl,%dl
+    103e:	75 eb                	jne    102b <printf+0xf9>
+      state = 0;
+    1040:	be 00 00 00 00       	mov    $0x0,%esi
+    1045:	e9 21 ff ff ff       	jmp    f6b <printf+0x39>
+        putc(o, *ap);
+    104a:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+    104d:	0f be 17             	movsbl (%edi),%edx
+    1050:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    1053:	e8 0d fe ff ff       	call   e65 <putc>
+        ap++;
+    1058:	83 c7 04             	add    $0x4,%edi
+    105b:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+      state = 0;
+    105e:	be 00 00 00 00       	mov    $0x0,%esi
+    1063:	e9 03 ff ff ff       	jmp    f6b <printf+0x39>
+        putc(o, c);
+    1068:	89 fa                	mov    %edi,%edx
+    106a:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    106d:	e8 f3 fd ff ff       	call   e65 <putc>
+      state = 0;
+    1072:	be 00 00 00 00       	mov    $0x0,%esi
+    1077:	e9 ef fe ff ff       	jmp    f6b <printf+0x39>
+        putc(o, '%');
+    107c:	ba 25 00 00 00       	mov    $0x25,%edx
+    1081:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    1084:	e8 dc fd ff ff       	call   e65 <putc>
+        putc(o, c);
+    1089:	89 fa                	mov    %edi,%edx
+    108b:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    108e:	e8 d2 fd ff ff       	call   e65 <putc>
+      state = 0;
+    1093:	be 00 00 00 00       	mov    $0x0,%esi
+    1098:	e9 ce fe ff ff       	jmp    f6b <printf+0x39>
+    }
+  }
+  if(o->n > 0)
+    109d:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    10a0:	85 c0                	test   %eax,%eax
+    10a2:	7f 08                	jg     10ac <printf+0x17a>
+    bufwrite(fd, o->buf, o->n);
+}
+    10a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    10a7:	5b                   	pop    %ebx
+    10a8:	5e                   	pop    %esi
+    10a9:	5f                   	pop    %edi
+    10aa:	5d                   	pop    %ebp
+    10ab:	c3                   	ret
+    bufwrite(fd, o->buf, o->n);
+    10ac:	83 ec 04             	sub    $0x4,%esp
+    10af:	50                   	push   %eax
+    10b0:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    10b3:	50                   	push   %eax
+    10b4:	ff 75 08             	push   0x8(%ebp)
+    10b7:	e8 91 f7 ff ff       	call   84d <bufwrite>
+    10bc:	83 c4 10             	add    $0x10,%esp
+}
+    10bf:	eb e3                	jmp    10a4 <printf+0x172>
+
+000010c1 <largefree>:
+  return &b->h;
+}
+
+static void
+largefree(Fblock *b)
+{
+    10c1:	55                   	push   %ebp
+    10c2:	89 e5                	mov    %esp,%ebp
+    10c4:	57                   	push   %edi
+    10c5:	56                   	push   %esi
+    10c6:	53                   	push   %ebx
+    10c7:	83 ec 0c             	sub    $0xc,%esp
+    10ca:	89 c1                	mov    %eax,%ecx
+  Fblock **pp, *p, *prev;
+
+  prev = 0;
+    10cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+    10d1:	ba ac d0 00 00       	mov    $0xd0ac,%edx
+    10d6:	eb 05                	jmp    10dd <largefree+0x1c>
+    10d8:	8d 50 08             	lea    0x8(%eax),%edx
+    prev = p;
+    10db:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+    10dd:	8b 02                	mov    (%edx),%eax
+    10df:	85 c0                	test   %eax,%eax
+    10e1:	74 04                	je     10e7 <largefree+0x26>
+    10e3:	39 c8                	cmp    %ecx,%eax
+    10e5:	72 f1                	jb     10d8 <largefree+0x17>
+  b->next = p;
+    10e7:	89 41 08             	mov    %eax,0x8(%ecx)
+  if(p && (char*)b + b->h.size == (char*)p){
+    10ea:	85 c0                	test   %eax,%eax
+    10ec:	74 09                	je     10f7 <largefree+0x36>
+    10ee:	8b 31                	mov    (%ecx),%esi
+    10f0:	8d 3c 31             	lea    (%ecx,%esi,1),%edi
+    10f3:	39 c7                	cmp    %eax,%edi
+    10f5:	74 21                	je     1118 <largefree+0x57>
+    b->h.size += p->h.size;
+    b->next = p->next;
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+    10f7:	85 db                	test   %ebx,%ebx
+    10f9:	74 09                	je     1104 <largefree+0x43>
+    10fb:	8b 03                	mov    (%ebx),%eax
+    10fd:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+    1100:	39 ce                	cmp    %ecx,%esi
+    1102:	74 20                	je     1124 <largefree+0x63>
+    prev->h.size += b->h.size;
+    prev->next = b->next;
+  } else
+    *pp = b;
+    1104:	89 0a                	mov    %ecx,(%edx)
+
+  // Give the top of the heap back.  With threads sharing the
+  // address space sbrk() cannot shrink it; keep the block then.
+  for(pp = &large; (*pp)->next; pp = &(*pp)->next)
+    1106:	be ac d0 00 00       	mov    $0xd0ac,%esi
+    110b:	8b 1e                	mov    (%esi),%ebx
+    110d:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+    1111:	74 1d                	je     1130 <largefree+0x6f>
+    1113:	8d 73 08             	lea    0x8(%ebx),%esi
+    1116:	eb f3                	jmp    110b <largefree+0x4a>
+    b->h.size += p->h.size;
+    1118:	03 30                	add    (%eax),%esi
+    111a:	89 31                	mov    %esi,(%ecx)
+    b->next = p->next;
+    111c:	8b 40 08             	mov    0x8(%eax),%eax
+    111f:	89 41 08             	mov    %eax,0x8(%ecx)
+    1122:	eb d3                	jmp    10f7 <largefree+0x36>
+    prev->h.size += b->h.size;
+    1124:	03 01                	add    (%ecx),%eax
+    1126:	89 03                	mov    %eax,(%ebx)
+    prev->next = b->next;
+    1128:	8b 41 08             	mov    0x8(%ecx),%eax
+    112b:	89 43 08             	mov    %eax,0x8(%ebx)
+    112e:	eb d6                	jmp    1106 <largefree+0x45>
+    ;
+  b = *pp;
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+    1130:	89 df                	mov    %ebx,%edi
+    1132:	03 3b                	add    (%ebx),%edi
+    1134:	83 ec 0c             	sub    $0xc,%esp
+    1137:	6a 00                	push   $0x0
+    1139:	e8 93 fa ff ff       	call   bd1 <sbrk>
+    113e:	83 c4 10             	add    $0x10,%esp
+    1141:	39 c7                	cmp    %eax,%edi
+    1143:	74 08                	je     114d <largefree+0x8c>
+    *pp = 0;
+}
+    1145:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1148:	5b                   	pop    %ebx
+    1149:	5e                   	pop    %esi
+    114a:	5f                   	pop    %edi
+    114b:	5d                   	pop    %ebp
+    114c:	c3                   	ret
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+    114d:	8b 03                	mov    (%ebx),%eax
+    114f:	f7 d8                	neg    %eax
+    1151:	83 ec 0c             	sub    $0xc,%esp
+    1154:	50                   	push   %eax
+    1155:	e8 77 fa ff ff       	call   bd1 <sbrk>
+    115a:	83 c4 10             	add    $0x10,%esp
+    115d:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1160:	74 e3                	je     1145 <largefree+0x84>
+    *pp = 0;
+    1162:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+    1168:	eb db                	jmp    1145 <largefree+0x84>
+
+0000116a <more>:
+{
+    116a:	55                   	push   %ebp
+    116b:	89 e5                	mov    %esp,%ebp
+    116d:	56                   	push   %esi
+    116e:	53                   	push   %ebx
+    116f:	89 c6                	mov    %eax,%esi
+  pad = -(uint)sbrk(0) & 7;
+    1171:	83 ec 0c             	sub    $0xc,%esp
+    1174:	6a 00                	push   $0x0
+    1176:	e8 56 fa ff ff       	call   bd1 <sbrk>
+    117b:	f7 d8                	neg    %eax
+    117d:	89 c3                	mov    %eax,%ebx
+    117f:	83 e3 07             	and    $0x7,%ebx
+  if((p = sbrk(n + pad)) == (char*)-1)
+    1182:	01 de                	add    %ebx,%esi
+    1184:	89 34 24             	mov    %esi,(%esp)
+    1187:	e8 45 fa ff ff       	call   bd1 <sbrk>
+    118c:	83 c4 10             	add    $0x10,%esp
+    118f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1192:	74 09                	je     119d <more+0x33>
+  return p + pad;
+    1194:	01 d8                	add    %ebx,%eax
+}
+    1196:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1199:	5b                   	pop    %ebx
+    119a:	5e                   	pop    %esi
+    119b:	5d                   	pop    %ebp
+    119c:	c3                   	ret
+    return 0;
+    119d:	b8 00 00 00 00       	mov    $0x0,%eax
+    11a2:	eb f2                	jmp    1196 <more+0x2c>
+
+000011a4 <slaballoc>:
+{
+    11a4:	55                   	push   %ebp
+    11a5:	89 e5                	mov    %esp,%ebp
+    11a7:	56                   	push   %esi
+    11a8:	53                   	push   %ebx
+    11a9:	89 c6                	mov    %eax,%esi
+  n = 1 << (MINSHIFT + c);
+    11ab:	8d 48 04             	lea    0x4(%eax),%ecx
+    11ae:	bb 01 00 00 00       	mov    $0x1,%ebx
+    11b3:	d3 e3                	shl    %cl,%ebx
+  if(slab + n > slabend){
+    11b5:	89 d8                	mov    %ebx,%eax
+    11b7:	03 05 a8 d0 00 00    	add    0xd0a8,%eax
+    11bd:	39 05 a4 d0 00 00    	cmp    %eax,0xd0a4
+    11c3:	72 17                	jb     11dc <slaballoc+0x38>
+  h = (Header*)slab;
+    11c5:	a1 a8 d0 00 00       	mov    0xd0a8,%eax
+  slab += n;
+    11ca:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+    11cd:	89 15 a8 d0 00 00    	mov    %edx,0xd0a8
+  h->size = n;
+    11d3:	89 18                	mov    %ebx,(%eax)
+  h->class = c;
+    11d5:	89 70 04             	mov    %esi,0x4(%eax)
+}
+    11d8:	5b                   	pop    %ebx
+    11d9:	5e                   	pop    %esi
+    11da:	5d                   	pop    %ebp
+    11db:	c3                   	ret
+    if((p = more(SLABSZ)) == 0)
+    11dc:	b8 00 40 00 00       	mov    $0x4000,%eax
+    11e1:	e8 84 ff ff ff       	call   116a <more>
+    11e6:	85 c0                	test   %eax,%eax
+    11e8:	74 ee                	je     11d8 <slaballoc+0x34>
+    if(p != slabend)
+    11ea:	39 05 a4 d0 00 00    	cmp    %eax,0xd0a4
+    11f0:	74 05                	je     11f7 <slaballoc+0x53>
+      slab = p;
+    11f2:	a3 a8 d0 00 00       	mov    %eax,0xd0a8
+    slabend = p + SLABSZ;
+    11f7:	05 00 40 00 00       	add    $0x4000,%eax
+    11fc:	a3 a4 d0 00 00       	mov    %eax,0xd0a4
+    1201:	eb c2                	jmp    11c5 <slaballoc+0x21>
+
+00001203 <largealloc>:
+{
+    1203:	55                   	push   %ebp
+    1204:	89 e5                	mov    %esp,%ebp
+    1206:	56                   	push   %esi
+    1207:	53                   	push   %ebx
+    1208:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+    120a:	b9 ac d0 00 00       	mov    $0xd0ac,%ecx
+    120f:	8b 01                	mov    (%ecx),%eax
+    1211:	85 c0                	test   %eax,%eax
+    1213:	74 36                	je     124b <largealloc+0x48>
+    if(b->h.size < n)
+    1215:	8b 10                	mov    (%eax),%edx
+    1217:	39 da                	cmp    %ebx,%edx
+    1219:	72 24                	jb     123f <largealloc+0x3c>
+    if(b->h.size - n > SMALLMAX){
+    121b:	29 da                	sub    %ebx,%edx
+    121d:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+    1223:	76 1f                	jbe    1244 <largealloc+0x41>
+      rest = (Fblock*)((char*)b + n);
+    1225:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+      rest->h.size = b->h.size - n;
+    1228:	89 16                	mov    %edx,(%esi)
+      rest->h.class = LARGE;
+    122a:	c7 46 04 09 00 00 00 	movl   $0x9,0x4(%esi)
+      rest->next = b->next;
+    1231:	8b 50 08             	mov    0x8(%eax),%edx
+    1234:	89 56 08             	mov    %edx,0x8(%esi)
+      *pp = rest;
+    1237:	89 31                	mov    %esi,(%ecx)
+      b->h.size = n;
+    1239:	89 18                	mov    %ebx,(%eax)
+}
+    123b:	5b                   	pop    %ebx
+    123c:	5e                   	pop    %esi
+    123d:	5d                   	pop    %ebp
+    123e:	c3                   	ret
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+    123f:	8d 48 08             	lea    0x8(%eax),%ecx
+    1242:	eb cb                	jmp    120f <largealloc+0xc>
+      *pp = b->next;
+    1244:	8b 50 08             	mov    0x8(%eax),%edx
+    1247:	89 11                	mov    %edx,(%ecx)
+    return &b->h;
+    1249:	eb f0                	jmp    123b <largealloc+0x38>
+  if((b = more(n)) == 0)
+    124b:	89 d8                	mov    %ebx,%eax
+    124d:	e8 18 ff ff ff       	call   116a <more>
+    1252:	85 c0                	test   %eax,%eax
+    1254:	74 e5                	je     123b <largealloc+0x38>
+  b->h.size = n;
+    1256:	89 18                	mov    %ebx,(%eax)
+  b->h.class = LARGE;
+    1258:	c7 40 04 09 00 00 00 	movl   $0x9,0x4(%eax)
+  return &b->h;
+    125f:	eb da                	jmp    123b <largealloc+0x38>
+
+00001261 <free>:
+
+void
+free(void *ap)
+{
+    1261:	55                   	push   %ebp
+    1262:	89 e5                	mov    %esp,%ebp
+    1264:	56                   	push   %esi
+    1265:	53                   	push   %ebx
+    1266:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+
+  if(ap == 0)
+    1269:	85 db                	test   %ebx,%ebx
+    126b:	74 3b                	je     12a8 <free+0x47>
+    return;
+  h = (Header*)ap - 1;
+    126d:	8d 73 f8             	lea    -0x8(%ebx),%esi
+  lock_acquire(&lock);
+    1270:	83 ec 0c             	sub    $0xc,%esp
+    1273:	68 a0 d0 00 00       	push   $0xd0a0
+    1278:	e8 9c 01 00 00       	call   1419 <lock_acquire>
+  if(h->class == LARGE)
+    127d:	8b 43 fc             	mov    -0x4(%ebx),%eax
+    1280:	83 c4 10             	add    $0x10,%esp
+    1283:	83 f8 09             	cmp    $0x9,%eax
+    1286:	74 27                	je     12af <free+0x4e>
+    largefree((Fblock*)h);
+  else {
+    ((Fblock*)h)->next = freelist[h->class];
+    1288:	8b 14 85 c0 d0 00 00 	mov    0xd0c0(,%eax,4),%edx
+    128f:	89 13                	mov    %edx,(%ebx)
+    freelist[h->class] = (Fblock*)h;
+    1291:	89 34 85 c0 d0 00 00 	mov    %esi,0xd0c0(,%eax,4)
+  }
+  lock_release(&lock);
+    1298:	83 ec 0c             	sub    $0xc,%esp
+    129b:	68 a0 d0 00 00       	push   $0xd0a0
+    12a0:	e8 88 01 00 00       	call   142d <lock_release>
+    12a5:	83 c4 10             	add    $0x10,%esp
+}
+    12a8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    12ab:	5b                   	pop    %ebx
+    12ac:	5e                   	pop    %esi
+    12ad:	5d                   	pop    %ebp
+    12ae:	c3                   	ret
+    largefree((Fblock*)h);
+    12af:	89 f0                	mov    %esi,%eax
+    12b1:	e8 0b fe ff ff       	call   10c1 <largefree>
+    12b6:	eb e0                	jmp    1298 <free+0x37>
+
+000012b8 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    12b8:	55                   	push   %ebp
+    12b9:	89 e5                	mov    %esp,%ebp
+    12bb:	53                   	push   %ebx
+    12bc:	83 ec 04             	sub    $0x4,%esp
+    12bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+  uint n;
+  int c;
+
+  if(nbytes > 0x7fffffff - sizeof(Header) - 7)
+    12c2:	81 fb f0 ff ff 7f    	cmp    $0x7ffffff0,%ebx
+    12c8:	0f 87 8b 00 00 00    	ja     1359 <malloc+0xa1>
+    return 0;
+  n = (nbytes + sizeof(Header) + 7) & ~7;
+    12ce:	83 c3 0f             	add    $0xf,%ebx
+    12d1:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(n < sizeof(Fblock))
+    12d4:	83 fb 0b             	cmp    $0xb,%ebx
+    12d7:	77 05                	ja     12de <malloc+0x26>
+    n = sizeof(Fblock);
+    12d9:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  lock_acquire(&lock);
+    12de:	83 ec 0c             	sub    $0xc,%esp
+    12e1:	68 a0 d0 00 00       	push   $0xd0a0
+    12e6:	e8 2e 01 00 00       	call   1419 <lock_acquire>
+  if(n <= SMALLMAX){
+    12eb:	83 c4 10             	add    $0x10,%esp
+    12ee:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+    12f4:	77 58                	ja     134e <malloc+0x96>
+    for(c = 0; (1 << (MINSHIFT + c)) < n; c++)
+    12f6:	ba 00 00 00 00       	mov    $0x0,%edx
+    12fb:	eb 03                	jmp    1300 <malloc+0x48>
+    12fd:	83 c2 01             	add    $0x1,%edx
+    1300:	8d 4a 04             	lea    0x4(%edx),%ecx
+    1303:	b8 01 00 00 00       	mov    $0x1,%eax
+    1308:	d3 e0                	shl    %cl,%eax
+    130a:	39 d8                	cmp    %ebx,%eax
+    130c:	72 ef                	jb     12fd <malloc+0x45>
+      ;
+    if(freelist[c]){
+    130e:	8b 04 95 c0 d0 00 00 	mov    0xd0c0(,%edx,4),%eax
+    1315:	85 c0                	test   %eax,%eax
+    1317:	74 2a                	je     1343 <malloc+0x8b>
+      h = &freelist[c]->h;
+    1319:	89 c3                	mov    %eax,%ebx
+      freelist[c] = freelist[c]->next;
+    131b:	8b 40 08             	mov    0x8(%eax),%eax
+    131e:	89 04 95 c0 d0 00 00 	mov    %eax,0xd0c0(,%edx,4)
+    } else
+      h = slaballoc(c);
+  } else
+    h = largealloc(n);
+  lock_release(&lock);
+    1325:	83 ec 0c             	sub    $0xc,%esp
+    1328:	68 a0 d0 00 00       	push   $0xd0a0
+    132d:	e8 fb 00 00 00       	call   142d <lock_release>
+  return h ? (void*)(h + 1) : 0;
+    1332:	83 c4 10             	add    $0x10,%esp
+    1335:	85 db                	test   %ebx,%ebx
+    1337:	74 03                	je     133c <malloc+0x84>
+    1339:	83 c3 08             	add    $0x8,%ebx
+}
+    133c:	89 d8                	mov    %ebx,%eax
+    133e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1341:	c9                   	leave
+    1342:	c3                   	ret
+      h = slaballoc(c);
+    1343:	89 d0                	mov    %edx,%eax
+    1345:	e8 5a fe ff ff       	call   11a4 <slaballoc>
+    134a:	89 c3                	mov    %eax,%ebx
+    134c:	eb d7                	jmp    1325 <malloc+0x6d>
+    h = largealloc(n);
+    134e:	89 d8                	mov    %ebx,%eax
+    1350:	e8 ae fe ff ff       	call   1203 <largealloc>
+    1355:	89 c3                	mov    %eax,%ebx
+    1357:	eb cc                	jmp    1325 <malloc+0x6d>
+    return 0;
+    1359:	bb 00 00 00 00       	mov    $0x0,%ebx
+    135e:	eb dc                	jmp    133c <malloc+0x84>
+
+00001360 <tstart>:
+  void *arg;
+};
+
+static void
+tstart(void *a)
+{
+    1360:	55                   	push   %ebp
+    1361:	89 e5                	mov    %esp,%ebp
+    1363:	83 ec 14             	sub    $0x14,%esp
+    1366:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+    1369:	ff 70 04             	push   0x4(%eax)
+    136c:	ff 10                	call   *(%eax)
+  exit();
+    136e:	e8 86 f6 ff ff       	call   9f9 <exit>
+
+00001373 <thread_create>:
+}
+
+// Run fn(arg) in a new thread.  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1373:	55                   	push   %ebp
+    1374:	89 e5                	mov    %esp,%ebp
+    1376:	56                   	push   %esi
+    1377:	53                   	push   %ebx
+  struct tstart *t;
+  char *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    1378:	83 ec 0c             	sub    $0xc,%esp
+    137b:	68 00 10 00 00       	push   $0x1000
+    1380:	e8 33 ff ff ff       	call   12b8 <malloc>
+    1385:	83 c4 10             	add    $0x10,%esp
+    1388:	85 c0                	test   %eax,%eax
+    138a:	74 42                	je     13ce <thread_create+0x5b>
+    138c:	89 c3                	mov    %eax,%ebx
+    return -1;
+  t = (struct tstart*)stack;
+  t->fn = fn;
+    138e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1391:	89 03                	mov    %eax,(%ebx)
+  t->arg = arg;
+    1393:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1396:	89 43 04             	mov    %eax,0x4(%ebx)
+  if((pid = clone(tstart, stack + TSTACK, t)) < 0)
+    1399:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    139f:	83 ec 04             	sub    $0x4,%esp
+    13a2:	53                   	push   %ebx
+    13a3:	50                   	push   %eax
+    13a4:	68 60 13 00 00       	push   $0x1360
+    13a9:	e8 f5 f8 ff ff       	call   ca3 <clone>
+    13ae:	89 c6                	mov    %eax,%esi
+    13b0:	83 c4 10             	add    $0x10,%esp
+    13b3:	85 c0                	test   %eax,%eax
+    13b5:	78 09                	js     13c0 <thread_create+0x4d>
+    free(stack);
+  return pid;
+}
+    13b7:	89 f0                	mov    %esi,%eax
+    13b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    13bc:	5b                   	pop    %ebx
+    13bd:	5e                   	pop    %esi
+    13be:	5d                   	pop    %ebp
+    13bf:	c3                   	ret
+    free(stack);
+    13c0:	83 ec 0c             	sub    $0xc,%esp
+    13c3:	53                   	push   %ebx
+    13c4:	e8 98 fe ff ff       	call   1261 <free>
+    13c9:	83 c4 10             	add    $0x10,%esp
+    13cc:	eb e9                	jmp    13b7 <thread_create+0x44>
+    return -1;
+    13ce:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    13d3:	eb e2                	jmp    13b7 <thread_create+0x44>
+
+000013d5 <thread_join>:
+
+// Wait for one of this process's threads to exit and free its
+// stack.  Returns its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+    13d5:	55                   	push   %ebp
+    13d6:	89 e5                	mov    %esp,%ebp
+    13d8:	53                   	push   %ebx
+    13d9:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    13dc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    13df:	50                   	push   %eax
+    13e0:	e8 cd f8 ff ff       	call   cb2 <join>
+    13e5:	89 c3                	mov    %eax,%ebx
+    13e7:	83 c4 10             	add    $0x10,%esp
+    13ea:	85 c0                	test   %eax,%eax
+    13ec:	79 07                	jns    13f5 <thread_join+0x20>
+    free((char*)stack - TSTACK);
+  return pid;
+}
+    13ee:	89 d8                	mov    %ebx,%eax
+    13f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    13f3:	c9                   	leave
+    13f4:	c3                   	ret
+    free((char*)stack - TSTACK);
+    13f5:	83 ec 0c             	sub    $0xc,%esp
+    13f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    13fb:	2d 00 10 00 00       	sub    $0x1000,%eax
+    1400:	50                   	push   %eax
+    1401:	e8 5b fe ff ff       	call   1261 <free>
+    1406:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    1409:	eb e3                	jmp    13ee <thread_join+0x19>
+
+0000140b <lock_init>:
+
+void
+lock_init(lock_t *lk)
+{
+    140b:	55                   	push   %ebp
+    140c:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    140e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1411:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1417:	5d                   	pop    %ebp
+    1418:	c3                   	ret
+
+00001419 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+    1419:	55                   	push   %ebp
+    141a:	89 e5                	mov    %esp,%ebp
+    141c:	8b 55 08             	mov    0x8(%ebp),%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    141f:	b8 01 00 00 00       	mov    $0x1,%eax
+    1424:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    1427:	85 c0                	test   %eax,%eax
+    1429:	75 f4                	jne    141f <lock_acquire+0x6>
+    ;
+}
+    142b:	5d                   	pop    %ebp
+    142c:	c3                   	ret
+
+0000142d <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+    142d:	55                   	push   %ebp
+    142e:	89 e5                	mov    %esp,%ebp
+    1430:	8b 55 08             	mov    0x8(%ebp),%edx
+    1433:	b8 00 00 00 00       	mov    $0x0,%eax
+    1438:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    143b:	5d                   	pop    %ebp
+    143c:	c3                   	ret
+
+0000143d <mutex_init>:
+// Are Tricky": state is 0 when free, 1 when held, 2 when held and
+// others may be waiting.  Unlocking an uncontended mutex costs no
+// system call.
+void
+mutex_init(mutex_t *m)
+{
+    143d:	55                   	push   %ebp
+    143e:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    1440:	8b 45 08             	mov    0x8(%ebp),%eax
+    1443:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1449:	5d                   	pop    %ebp
+    144a:	c3                   	ret
+
+0000144b <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+    144b:	55                   	push   %ebp
+    144c:	89 e5                	mov    %esp,%ebp
+    144e:	53                   	push   %ebx
+    144f:	83 ec 04             	sub    $0x4,%esp
+    1452:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    1455:	b8 00 00 00 00       	mov    $0x0,%eax
+    145a:	b9 01 00 00 00       	mov    $0x1,%ecx
+    145f:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    1463:	85 c0                	test   %eax,%eax
+    1465:	74 29                	je     1490 <mutex_lock+0x45>
+    return;
+  if(c != 2)
+    1467:	83 f8 02             	cmp    $0x2,%eax
+    146a:	74 20                	je     148c <mutex_lock+0x41>
+    146c:	b8 02 00 00 00       	mov    $0x2,%eax
+    1471:	f0 87 03             	lock xchg %eax,(%ebx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    1474:	eb 16                	jmp    148c <mutex_lock+0x41>
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    1476:	83 ec 08             	sub    $0x8,%esp
+    1479:	6a 02                	push   $0x2
+    147b:	53                   	push   %ebx
+    147c:	e8 40 f8 ff ff       	call   cc1 <futex_wait>
+  asm volatile("lock; xchgl %0, %1" :
+    1481:	b8 02 00 00 00       	mov    $0x2,%eax
+    1486:	f0 87 03             	lock xchg %eax,(%ebx)
+    1489:	83 c4 10             	add    $0x10,%esp
+  while(c != 0){
+    148c:	85 c0                	test   %eax,%eax
+    148e:	75 e6                	jne    1476 <mutex_lock+0x2b>
+    c = xchg(&m->state, 2);
+  }
+}
+    1490:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1493:	c9                   	leave
+    1494:	c3                   	ret
+
+00001495 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+    1495:	55                   	push   %ebp
+    1496:	89 e5                	mov    %esp,%ebp
+    1498:	83 ec 08             	sub    $0x8,%esp
+    149b:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    149e:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    14a3:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    14a7:	83 fa 01             	cmp    $0x1,%edx
+    14aa:	75 02                	jne    14ae <mutex_unlock+0x19>
+    m->state = 0;
+    futex_wake(&m->state, 1);
+  }
+}
+    14ac:	c9                   	leave
+    14ad:	c3                   	ret
+    m->state = 0;
+    14ae:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+    14b4:	83 ec 08             	sub    $0x8,%esp
+    14b7:	6a 01                	push   $0x1
+    14b9:	50                   	push   %eax
+    14ba:	e8 11 f8 ff ff       	call   cd0 <futex_wake>
+    14bf:	83 c4 10             	add    $0x10,%esp
+}
+    14c2:	eb e8                	jmp    14ac <mutex_unlock+0x17>
+
+000014c4 <cond_init>:
+// Condition variable: waiters sleep on a sequence number that
+// every signal bumps, so a signal between the unlock and the
+// futex_wait() in cond_wait() is not lost.
+void
+cond_init(cond_t *c)
+{
+    14c4:	55                   	push   %ebp
+    14c5:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    14c7:	8b 45 08             	mov    0x8(%ebp),%eax
+    14ca:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    14d0:	5d                   	pop    %ebp
+    14d1:	c3                   	ret
+
+000014d2 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+    14d2:	55                   	push   %ebp
+    14d3:	89 e5                	mov    %esp,%ebp
+    14d5:	57                   	push   %edi
+    14d6:	56                   	push   %esi
+    14d7:	53                   	push   %ebx
+    14d8:	83 ec 18             	sub    $0x18,%esp
+    14db:	8b 75 08             	mov    0x8(%ebp),%esi
+    14de:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    14e1:	8b 3e                	mov    (%esi),%edi
+  mutex_unlock(m);
+    14e3:	53                   	push   %ebx
+    14e4:	e8 ac ff ff ff       	call   1495 <mutex_unlock>
+  futex_wait(&c->seq, seq);
+    14e9:	83 c4 08             	add    $0x8,%esp
+    14ec:	57                   	push   %edi
+    14ed:	56                   	push   %esi
+    14ee:	e8 ce f7 ff ff       	call   cc1 <futex_wait>
+  // Others may be waiting for m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+    14f3:	83 c4 10             	add    $0x10,%esp
+    14f6:	eb 0e                	jmp    1506 <cond_wait+0x34>
+    futex_wait(&m->state, 2);
+    14f8:	83 ec 08             	sub    $0x8,%esp
+    14fb:	6a 02                	push   $0x2
+    14fd:	53                   	push   %ebx
+    14fe:	e8 be f7 ff ff       	call   cc1 <futex_wait>
+    1503:	83 c4 10             	add    $0x10,%esp
+    1506:	b8 02 00 00 00       	mov    $0x2,%eax
+    150b:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    150e:	85 c0                	test   %eax,%eax
+    1510:	75 e6                	jne    14f8 <cond_wait+0x26>
+}
+    1512:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1515:	5b                   	pop    %ebx
+    1516:	5e                   	pop    %esi
+    1517:	5f                   	pop    %edi
+    1518:	5d                   	pop    %ebp
+    1519:	c3                   	ret
+
+0000151a <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+    151a:	55                   	push   %ebp
+    151b:	89 e5                	mov    %esp,%ebp
+    151d:	83 ec 10             	sub    $0x10,%esp
+    1520:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    1523:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+    1527:	6a 01                	push   $0x1
+    1529:	50                   	push   %eax
+    152a:	e8 a1 f7 ff ff       	call   cd0 <futex_wake>
+}
+    152f:	83 c4 10             	add    $0x10,%esp
+    1532:	c9                   	leave
+    1533:	c3                   	ret
+
+00001534 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+    1534:	55                   	push   %ebp
+    1535:	89 e5                	mov    %esp,%ebp
+    1537:	83 ec 10             	sub    $0x10,%esp
+    153a:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    153d:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, NPROC);
+    1541:	6a 40                	push   $0x40
+    1543:	50                   	push   %eax
+    1544:	e8 87 f7 ff ff       	call   cd0 <futex_wake>
+}
+    1549:	83 c4 10             	add    $0x10,%esp
+    154c:	c9                   	leave
+    154d:	c3                   	ret
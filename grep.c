@@ -1,37 +1,142 @@
 // Simple grep.  Only supports ^ . * $ operators.
+//
+// The pattern is compiled into a list of items, each a character
+// (or . for any), perhaps starred, and run as a Thompson NFA with
+// the set of items reached kept in a bit mask: every character of
+// a line costs the same whatever the pattern, with none of the
+// backtracking that a*a*a*b used to cost.  A matching line must
+// contain the first unstarred literal of the pattern, so grep
+// looks for that with memchr() and runs the NFA only on the lines
+// that have it.  Input is read BUFSZ bytes at a time.
 
 #include "types.h"
 #include "stat.h"
 #include "user.h"
 
-char buf[1024];
-int match(char*, char*);
+#define BUFSZ  (32*1024)
+#define NITEM  31              // Items in a pattern, one bit each
 
+char buf[BUFSZ+1] __attribute__((aligned(4096)));
+
+struct {
+  int n;                       // Number of items
+  int bol;                     // Anchored with ^
+  int eol;                     // Anchored with $
+  uint star;                   // The starred items
+  uint match[256];             // The items each character matches
+  int lit;                     // A character every match has, or -1
+} re;
+
+int
+compile(char *p)
+{
+  int c, i;
+
+  memset(&re, 0, sizeof(re));
+  re.lit = -1;
+  if(*p == '^'){
+    re.bol = 1;
+    p++;
+  }
+  for(; *p; p++){
+    if(p[0] == '$' && p[1] == '\0'){
+      re.eol = 1;
+      break;
+    }
+    if(re.n == NITEM)
+      return -1;
+    i = re.n++;
+    if(*p == '.')
+      for(c = 0; c < 256; c++)
+        re.match[c] |= 1 << i;
+    else
+      re.match[(uchar)*p] |= 1 << i;
+    if(p[1] == '*'){
+      re.star |= 1 << i;
+      p++;
+    } else if(*p != '.' && re.lit < 0)
+      re.lit = (uchar)*p;
+  }
+  return 0;
+}
+
+// Add the items reached by skipping starred ones.
+uint
+closure(uint set)
+{
+  uint t;
+
+  while((t = set | ((set & re.star) << 1)) != set)
+    set = t;
+  return set;
+}
+
+// Does the line from s up to e match?
+int
+match(char *s, char *e)
+{
+  uint set, start, done, m;
+
+  done = 1 << re.n;
+  start = closure(1);
+  for(set = start; ; s++){
+    if((set & done) && !re.eol)
+      return 1;
+    if(s == e)
+      return (set & done) != 0;
+    m = set & re.match[(uchar)*s];
+    set = closure(((m & ~re.star) << 1) | (m & re.star));
+    if(!re.bol)
+      set |= start;
+    else if(set == 0)
+      return 0;
+  }
+}
+
+// Print the matching lines from s up to e, which ends one.
 void
-grep(char *pattern, int fd)
+lines(char *s, char *e)
+{
+  char *q;
+
+  while(s < e){
+    if(re.lit >= 0){
+      if((q = memchr(s, re.lit, e - s)) == 0)
+        return;
+      while(q > s && q[-1] != '\n')
+        q--;
+      s = q;
+    }
+    q = memchr(s, '\n', e - s);
+    if(match(s, q))
+      bufwrite(1, s, q+1 - s);
+    s = q+1;
+  }
+}
+
+void
+grep(int fd)
 {
   int n, m;
-  char *p, *q;
+  char *q;
 
   m = 0;
-  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+  while((n = read(fd, buf+m, BUFSZ-m)) > 0){
     m += n;
-    buf[m] = '\0';
-    p = buf;
-    while((q = strchr(p, '\n')) != 0){
-      *q = 0;
-      if(match(pattern, p)){
-        *q = '\n';
-        write(1, p, q+1 - p);
-      }
-      p = q+1;
-    }
-    if(p == buf)
-      m = 0;
-    if(m > 0){
-      m -= p - buf;
-      memmove(buf, p, m);
+    for(q = buf+m; q > buf && q[-1] != '\n'; q--)
+      ;
+    if(q == buf){
+      if(m == BUFSZ)           // A line longer than buf: drop it
+        m = 0;
+      continue;
     }
+    lines(buf, q);
+    m -= q - buf;
+    memmove(buf, q, m);
+  }
+  if(m > 0){                   // A last line with no newline
+    buf[m] = '\n';
+    lines(buf, buf+m+1);
   }
 }
 
@@ -39,16 +144,18 @@ int
 main(int argc, char *argv[])
 {
   int fd, i;
-  char *pattern;
 
   if(argc <= 1){
     printf(2, "usage: grep pattern [file ...]\n");
     exit();
   }
-  pattern = argv[1];
+  if(compile(argv[1]) < 0){
+    printf(2, "grep: pattern too long\n");
+    exit();
+  }
 
   if(argc <= 2){
-    grep(pattern, 0);
+    grep(0);
     exit();
   }
 
@@ -57,51 +164,8 @@ main(int argc, char *argv[])
       printf(1, "grep: cannot open %s\n", argv[i]);
       exit();
     }
-    grep(pattern, fd);
+    grep(fd);
     close(fd);
   }
   exit();
 }
-
-// Regexp matcher from Kernighan & Pike,
-// The Practice of Programming, Chapter 9.
-
-int matchhere(char*, char*);
-int matchstar(int, char*, char*);
-
-int
-match(char *re, char *text)
-{
-  if(re[0] == '^')
-    return matchhere(re+1, text);
-  do{  // must look at empty string
-    if(matchhere(re, text))
-      return 1;
-  }while(*text++ != '\0');
-  return 0;
-}
-
-// matchhere: search for re at beginning of text
-int matchhere(char *re, char *text)
-{
-  if(re[0] == '\0')
-    return 1;
-  if(re[1] == '*')
-    return matchstar(re[0], re+2, text);
-  if(re[0] == '$' && re[1] == '\0')
-    return *text == '\0';
-  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
-    return matchhere(re+1, text+1);
-  return 0;
-}
-
-// matchstar: search for c*re at beginning of text
-int matchstar(int c, char *re, char *text)
-{
-  do{  // a * matches zero or more instances
-    if(matchhere(re, text))
-      return 1;
-  }while(*text!='\0' && (*text++==c || c=='.'));
-  return 0;
-}
-
@@ -1,17 +1,20 @@
-// Simple PIO-based (non-DMA) IDE driver code.
+// IDE driver code: bus-master DMA when the PCI IDE controller
+// offers it, else programmed I/O.
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
 #include "traps.h"
-#include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "iostat.h"
+#include "trace.h"
 
 #define SECTOR_SIZE   512
 #define IDE_BSY       0x80
@@ -23,16 +26,99 @@
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_SETMUL 0xc6
+#define IDE_CMD_RDDMA 0xc8
+#define IDE_CMD_WRDMA 0xca
+
+#define IDE_MULT      8        // Most sectors per PIO request
+#define IDE_MAXDMA    32       // Most blocks per DMA request
+
+// Bus-master IDE registers, for the primary channel, and the
+// physical region descriptors that tell the controller where in
+// memory the data goes.
+#define BM_CMD        0
+#define   BM_START    0x01
+#define   BM_READ     0x08     // Disk to memory
+#define BM_STATUS     2
+#define   BM_ERR      0x02
+#define   BM_IRQ      0x04
+#define   BM_DMA0     0x20     // Drives 0 and 1 can do DMA
+#define   BM_DMA1     0x40
+#define BM_PRDT       4
+
+struct prd {
+  uint addr;                   // Physical address
+  ushort n;                    // Bytes, no more than to a 64KB boundary
+  ushort flags;
+};
+#define PRD_EOT       0x8000   // Last entry
 
 // idequeue points to the buf now being read/written to the disk.
 // idequeue->qnext points to the next buf to be processed.
 // You must hold idelock while manipulating queue.
+// idestart() pulls the buffers for the blocks that follow the
+// head's, up to idemult sectors, in behind it and moves them all
+// with one READ/WRITE MULTIPLE command and one interrupt: idenrun
+// is how many buffers the request at the head covers.
 
 static struct spinlock idelock;
 static struct buf *idequeue;
+static int idenrun;
+static int idemult = 1;        // Sectors per interrupt, SET MULTIPLE
+static ushort bmbase;          // Bus-master registers, or 0 for PIO
+static struct prd *prdt;       // A page of PRDs
 
 static int havedisk1;
+static uint idepos;            // Last block the disk was sent to
+static struct iostat iostat;
 static void idestart(struct buf*);
+static void idequeueadd(struct buf*);
+static void dmainit(void);
+
+// I/O schedulers order the queue: where() returns the link, from
+// pp on, at which to insert b.  Blocks that come next on disk are
+// merged into one request by idestart() whatever the order.
+struct iosched {
+  char *name;
+  struct buf **(*where)(struct buf **pp, struct buf *b);
+};
+
+// Arrival order.
+static struct buf**
+fifowhere(struct buf **pp, struct buf *b)
+{
+  for(; *pp; pp = &(*pp)->qnext)  //DOC:insert-queue
+    ;
+  return pp;
+}
+
+// C-LOOK: sweep up through the block numbers from where the disk
+// is, then start again at the lowest.  A block at or before
+// idepos waits for the next sweep, so no stream of requests at
+// one spot can hold the sweep there.
+static int
+clookbefore(struct buf *a, struct buf *b)
+{
+  int wa = a->blockno <= idepos, wb = b->blockno <= idepos;
+
+  if(wa != wb)
+    return wb;
+  return a->blockno < b->blockno;
+}
+
+static struct buf**
+clookwhere(struct buf **pp, struct buf *b)
+{
+  for(; *pp && !clookbefore(b, *pp); pp = &(*pp)->qnext)
+    ;
+  return pp;
+}
+
+static struct iosched scheds[] = {
+  { "clook", clookwhere },
+  { "fifo",  fifowhere },
+};
+static struct iosched *cursched = &scheds[0];
 
 // Wait for IDE disk to become ready.
 static int
@@ -67,33 +153,135 @@ ideinit(void)
 
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0<<4));
+
+  // Have READ/WRITE MULTIPLE move IDE_MULT sectors per interrupt
+  // on each disk, with the interrupt for this command masked.
+  idemult = IDE_MULT;
+  outb(0x3f6, 2);
+  for(i = 0; i <= havedisk1; i++){
+    outb(0x1f6, 0xe0 | (i<<4));
+    outb(0x1f2, IDE_MULT);
+    outb(0x1f7, IDE_CMD_SETMUL);
+    if(idewait(1) < 0)
+      idemult = 1;
+  }
+  outb(0x1f6, 0xe0 | (0<<4));
+
+  dmainit();
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Find the PCI IDE controller and, if it can be a bus master, use
+// DMA from now on.
+static void
+dmainit(void)
+{
+  uint tag, bar;
+
+  if(pcifind(0x01, 0x01, &tag) < 0)
+    return;
+  bar = pciread(tag, 0x20);  // BAR4
+  if((bar & 1) == 0 || (bar & 0xFFFC) == 0)
+    return;
+  if((prdt = (struct prd*)kalloc()) == 0)
+    return;
+  pciwrite(tag, 0x04, pciread(tag, 0x04) | 0x05);  // I/O space, bus master
+  bmbase = bar & 0xFFFC;
+  outb(bmbase+BM_STATUS, inb(bmbase+BM_STATUS) | BM_DMA0 | BM_DMA1);
+  cprintf("ide: bus-master dma at 0x%x\n", bmbase);
+}
+
+// Point the PRDs at the data of the n buffers from b on.
+static void
+prdfill(struct buf *b, int n)
+{
+  struct prd *p;
+  uint pa, len, m;
+
+  p = prdt;
+  for(; n-- > 0; b = b->qnext){
+    pa = V2P(b->data);
+    for(len = BSIZE; len > 0; len -= m, pa += m){
+      m = 0x10000 - (pa & 0xFFFF);
+      if(m > len)
+        m = len;
+      p->addr = pa;
+      p->n = m;
+      p->flags = 0;
+      p++;
+    }
+  }
+  p[-1].flags = PRD_EOT;
+}
+
+// Start the request for b, the head of idequeue, clustered with
+// the queued buffers for the blocks after it.  Caller must hold
+// idelock.
 static void
 idestart(struct buf *b)
 {
+  struct buf *last, *c, **pp;
+  int n;
+
   if(b == 0)
     panic("idestart");
   if(b->blockno >= FSSIZE)
     panic("incorrect blockno");
   int sector_per_block =  BSIZE/SECTOR_SIZE;
   int sector = b->blockno * sector_per_block;
-  int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
-  int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
 
   if (sector_per_block > 7) panic("idestart");
 
+  // Pull the next blocks in the same direction in behind b.
+  last = b;
+  for(n = 1; bmbase ? n < IDE_MAXDMA : (n+1)*sector_per_block <= idemult; n++){
+    for(pp = &last->qnext; (c = *pp) != 0; pp = &c->qnext)
+      if(c->dev == b->dev && c->blockno == last->blockno + 1 &&
+         (c->flags & B_DIRTY) == (b->flags & B_DIRTY))
+        break;
+    if(c == 0)
+      break;
+    if(pp != &last->qnext){
+      *pp = c->qnext;
+      c->qnext = last->qnext;
+      last->qnext = c;
+    }
+    last = c;
+  }
+  idenrun = n;
+  idepos = last->blockno;
+  TRACE(TC_DISK, (b->flags & B_DIRTY) ? TE_DISKWRITE : TE_DISKREAD,
+        b->blockno, n);
+
+  int nsect = n * sector_per_block;
+  int read_cmd = (nsect == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
+  int write_cmd = (nsect == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+  int dir = (b->flags & B_DIRTY) ? 0 : BM_READ;
+
+  if(bmbase){
+    read_cmd = IDE_CMD_RDDMA;
+    write_cmd = IDE_CMD_WRDMA;
+    prdfill(b, n);
+    outb(bmbase+BM_CMD, 0);
+    outl(bmbase+BM_PRDT, V2P(prdt));
+    outb(bmbase+BM_STATUS, inb(bmbase+BM_STATUS) | BM_ERR | BM_IRQ);
+    outb(bmbase+BM_CMD, dir);
+  }
+
   idewait(0);
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f2, nsect);  // number of sectors
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
-  if(b->flags & B_DIRTY){
+  if(bmbase){
+    // The controller moves the data and interrupts when done.
+    outb(0x1f7, dir ? read_cmd : write_cmd);
+    outb(bmbase+BM_CMD, dir | BM_START);
+  } else if(b->flags & B_DIRTY){
     outb(0x1f7, write_cmd);
-    outsl(0x1f0, b->data, BSIZE/4);
+    for(c = b; n-- > 0; c = c->qnext)
+      outsl(0x1f0, c->data, BSIZE/4);
   } else {
     outb(0x1f7, read_cmd);
   }
@@ -104,65 +292,193 @@ void
 ideintr(void)
 {
   struct buf *b;
+  int n, ok, st;
+  uint lat, rem;
+  uint64 now;
 
-  // First queued buffer is the active request.
+  // The first idenrun queued buffers are the active request.
   acquire(&idelock);
 
   if((b = idequeue) == 0){
     release(&idelock);
     return;
   }
-  idequeue = b->qnext;
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, BSIZE/4);
+  if(bmbase){
+    // DMA has put the data in place already.  If it failed, go on
+    // with PIO, starting with this request again.
+    st = inb(bmbase+BM_STATUS);
+    outb(bmbase+BM_CMD, 0);
+    outb(bmbase+BM_STATUS, st | BM_ERR | BM_IRQ);
+    if((st & BM_ERR) || idewait(1) < 0){
+      cprintf("ide: dma error, falling back to pio\n");
+      bmbase = 0;
+      idestart(b);
+      release(&idelock);
+      return;
+    }
+    ok = 0;
+  } else {
+    // Read data if needed.
+    ok = !(b->flags & B_DIRTY) && idewait(1) >= 0;
+  }
+  TRACE(TC_DISK, TE_DISKDONE, b->blockno, idenrun);
+  iostat.nreq++;
+  iostat.nblk += idenrun;
+  now = nanotime();
+  for(n = idenrun; n > 0; n--){
+    b = idequeue;
+    idequeue = b->qnext;
+    if(ok)
+      insl(0x1f0, b->data, BSIZE/4);
+    iostat.depth--;
+    lat = now - b->qtime < (1000ULL << 32) ?
+          divl(now - b->qtime, 1000, &rem) : ~0;
+    iostat.sumlat += lat;
+    if(lat > iostat.maxlat)
+      iostat.maxlat = lat;
 
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+    // Wake process waiting for this buf.
+    b->flags |= B_VALID;
+    b->flags &= ~(B_DIRTY|B_QUEUED);
+    wakeup(b);
+    // A read-ahead's reference goes now that the data is in.
+    if(b->flags & B_ASYNC){
+      b->flags &= ~B_ASYNC;
+      bunref(b);
+    }
+  }
 
   // Start disk on next buf in queue.
+  idenrun = 0;
   if(idequeue != 0)
     idestart(idequeue);
 
   release(&idelock);
 }
 
-//PAGEBREAK!
-// Sync buf with disk.
-// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
-// Else if B_VALID is not set, read buf from disk, set B_VALID.
-void
-iderw(struct buf *b)
+// Add b to idequeue, behind the request the disk is working on,
+// where the scheduler says.  Caller must hold idelock, and start
+// the disk if the queue was empty.
+static void
+idequeueadd(struct buf *b)
 {
   struct buf **pp;
+  int i;
 
-  if(!holdingsleep(&b->lock))
-    panic("iderw: buf not locked");
-  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
-    panic("iderw: nothing to do");
-  if(b->dev != 0 && !havedisk1)
-    panic("iderw: ide disk 1 not present");
+  b->flags |= B_QUEUED;
+  b->qtime = nanotime();
+  pp = &idequeue;
+  for(i = 0; i < idenrun; i++)
+    pp = &(*pp)->qnext;
+  pp = cursched->where(pp, b);
+  b->qnext = *pp;
+  *pp = b;
 
-  acquire(&idelock);  //DOC:acquire-lock
+  iostat.nqueued++;
+  iostat.depth++;
+  iostat.sumdepth += iostat.depth;
+  if(iostat.depth > iostat.maxdepth)
+    iostat.maxdepth = iostat.depth;
+}
 
-  // Append b to idequeue.
-  b->qnext = 0;
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
-    ;
-  *pp = b;
+// Copy out the queue statistics.
+void
+getiostat(struct iostat *st)
+{
+  acquire(&idelock);
+  *st = iostat;
+  safestrcpy(st->sched, cursched->name, sizeof(st->sched));
+  release(&idelock);
+}
 
-  // Start disk if necessary.
+// Switch to the scheduler called name, zeroing the statistics.
+// Blocks already queued keep their place.
+int
+setiosched(char *name)
+{
+  uint depth;
+  int i;
+
+  for(i = 0; i < NELEM(scheds); i++)
+    if(strncmp(scheds[i].name, name, sizeof(iostat.sched)) == 0)
+      break;
+  if(i == NELEM(scheds))
+    return -1;
+  acquire(&idelock);
+  cursched = &scheds[i];
+  depth = iostat.depth;
+  memset(&iostat, 0, sizeof(iostat));
+  iostat.depth = depth;
+  release(&idelock);
+  return 0;
+}
+
+// Start reading b, unlocked, without waiting for it.  b carries a
+// reference for the read, which ideintr() drops with bunref() once
+// the data is in (or at once, if there is nothing to read).
+void
+idereadahead(struct buf *b)
+{
+  if(b->dev != 0 && !havedisk1)
+    panic("idereadahead: ide disk 1 not present");
+
+  acquire(&idelock);
+  if(b->flags & (B_VALID|B_QUEUED)){
+    release(&idelock);
+    bunref(b);
+    return;
+  }
+  b->flags |= B_ASYNC;
+  idequeueadd(b);
   if(idequeue == b)
     idestart(b);
+  release(&idelock);
+}
+
+//PAGEBREAK!
+// Sync the n bufs in bs with disk, queueing them all before
+// starting the disk so that idestart() can cluster them.
+// For each: if B_DIRTY is set, write it to disk, clear B_DIRTY,
+// set B_VALID; else if B_VALID is not set, read it from disk, set
+// B_VALID.
+void
+iderwv(struct buf **bs, int n)
+{
+  struct buf *b;
+  int i, idle;
 
-  // Wait for request to finish.
-  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
-    sleep(b, &idelock);
+  for(i = 0; i < n; i++){
+    if(!holdingsleep(&bs[i]->lock))
+      panic("iderw: buf not locked");
+    if(bs[i]->dev != 0 && !havedisk1)
+      panic("iderw: ide disk 1 not present");
   }
 
+  acquire(&idelock);  //DOC:acquire-lock
+
+  idle = idequeue == 0;
+  for(i = 0; i < n; i++){
+    b = bs[i];
+    // A read-ahead may have read it meanwhile, or be reading it now.
+    if((b->flags & (B_VALID|B_DIRTY)) != B_VALID && (b->flags & B_QUEUED) == 0)
+      idequeueadd(b);
+  }
+
+  // Start disk if necessary.
+  if(idle && idequeue)
+    idestart(idequeue);
+
+  // Wait for the requests to finish.
+  for(i = 0; i < n; i++)
+    while((bs[i]->flags & (B_VALID|B_DIRTY)) != B_VALID)
+      sleep(bs[i], &idelock);
 
   release(&idelock);
 }
+
+void
+iderw(struct buf *b)
+{
+  iderwv(&b, 1);
+}
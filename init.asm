@@ -0,0 +1,2818 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	53                   	push   %ebx
+       e:	51                   	push   %ecx
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+       f:	83 ec 08             	sub    $0x8,%esp
+      12:	6a 02                	push   $0x2
+      14:	68 a0 12 00 00       	push   $0x12a0
+      19:	e8 7c 08 00 00       	call   89a <open>
+      1e:	83 c4 10             	add    $0x10,%esp
+      21:	85 c0                	test   %eax,%eax
+      23:	78 4f                	js     74 <main+0x74>
+    mknod("console", 1, 1);
+    open("console", O_RDWR);
+  }
+  dup(0);  // stdout
+      25:	83 ec 0c             	sub    $0xc,%esp
+      28:	6a 00                	push   $0x0
+      2a:	e8 d4 08 00 00       	call   903 <dup>
+  dup(0);  // stderr
+      2f:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+      36:	e8 c8 08 00 00       	call   903 <dup>
+
+  mkdir("/tmp");
+      3b:	c7 04 24 a8 12 00 00 	movl   $0x12a8,(%esp)
+      42:	e8 9e 08 00 00       	call   8e5 <mkdir>
+  if(mount("tmpfs", "/tmp") < 0)
+      47:	83 c4 08             	add    $0x8,%esp
+      4a:	68 a8 12 00 00       	push   $0x12a8
+      4f:	68 ad 12 00 00       	push   $0x12ad
+      54:	e8 a8 0a 00 00       	call   b01 <mount>
+      59:	83 c4 10             	add    $0x10,%esp
+      5c:	85 c0                	test   %eax,%eax
+      5e:	79 6c                	jns    cc <main+0xcc>
+    printf(1, "init: cannot mount /tmp\n");
+      60:	83 ec 08             	sub    $0x8,%esp
+      63:	68 b3 12 00 00       	push   $0x12b3
+      68:	6a 01                	push   $0x1
+      6a:	e8 13 0c 00 00       	call   c82 <printf>
+      6f:	83 c4 10             	add    $0x10,%esp
+      72:	eb 58                	jmp    cc <main+0xcc>
+    mknod("console", 1, 1);
+      74:	83 ec 04             	sub    $0x4,%esp
+      77:	6a 01                	push   $0x1
+      79:	6a 01                	push   $0x1
+      7b:	68 a0 12 00 00       	push   $0x12a0
+      80:	e8 24 08 00 00       	call   8a9 <mknod>
+    open("console", O_RDWR);
+      85:	83 c4 08             	add    $0x8,%esp
+      88:	6a 02                	push   $0x2
+      8a:	68 a0 12 00 00       	push   $0x12a0
+      8f:	e8 06 08 00 00       	call   89a <open>
+      94:	83 c4 10             	add    $0x10,%esp
+      97:	eb 8c                	jmp    25 <main+0x25>
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+    pid = fork();
+    if(pid < 0){
+      printf(1, "init: fork failed\n");
+      99:	83 ec 08             	sub    $0x8,%esp
+      9c:	68 df 12 00 00       	push   $0x12df
+      a1:	6a 01                	push   $0x1
+      a3:	e8 da 0b 00 00       	call   c82 <printf>
+      exit();
+      a8:	e8 9c 06 00 00       	call   749 <exit>
+      exec("sh", argv);
+      printf(1, "init: exec sh failed\n");
+      exit();
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+      printf(1, "zombie!\n");
+      ad:	83 ec 08             	sub    $0x8,%esp
+      b0:	68 0b 13 00 00       	push   $0x130b
+      b5:	6a 01                	push   $0x1
+      b7:	e8 c6 0b 00 00       	call   c82 <printf>
+      bc:	83 c4 10             	add    $0x10,%esp
+    while((wpid=wait()) >= 0 && wpid != pid)
+      bf:	e8 8b 07 00 00       	call   84f <wait>
+      c4:	85 c0                	test   %eax,%eax
+      c6:	78 04                	js     cc <main+0xcc>
+      c8:	39 c3                	cmp    %eax,%ebx
+      ca:	75 e1                	jne    ad <main+0xad>
+    printf(1, "init: starting sh\n");
+      cc:	83 ec 08             	sub    $0x8,%esp
+      cf:	68 cc 12 00 00       	push   $0x12cc
+      d4:	6a 01                	push   $0x1
+      d6:	e8 a7 0b 00 00       	call   c82 <printf>
+    pid = fork();
+      db:	e8 55 06 00 00       	call   735 <fork>
+      e0:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+      e2:	83 c4 10             	add    $0x10,%esp
+      e5:	85 c0                	test   %eax,%eax
+      e7:	78 b0                	js     99 <main+0x99>
+    if(pid == 0){
+      e9:	75 d4                	jne    bf <main+0xbf>
+      exec("sh", argv);
+      eb:	83 ec 08             	sub    $0x8,%esp
+      ee:	68 38 1a 00 00       	push   $0x1a38
+      f3:	68 f2 12 00 00       	push   $0x12f2
+      f8:	e8 5e 06 00 00       	call   75b <exec>
+      printf(1, "init: exec sh failed\n");
+      fd:	83 c4 08             	add    $0x8,%esp
+     100:	68 f5 12 00 00       	push   $0x12f5
+     105:	6a 01                	push   $0x1
+     107:	e8 76 0b 00 00       	call   c82 <printf>
+      exit();
+     10c:	e8 38 06 00 00       	call   749 <exit>
+
+00000111 <strcpy>:
+#include "memlayout.h"
+#include "clock.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     111:	55                   	push   %ebp
+     112:	89 e5                	mov    %esp,%ebp
+     114:	56                   	push   %esi
+     115:	53                   	push   %ebx
+     116:	8b 75 08             	mov    0x8(%ebp),%esi
+     119:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     11c:	89 f0                	mov    %esi,%eax
+     11e:	89 d1                	mov    %edx,%ecx
+     120:	83 c2 01             	add    $0x1,%edx
+     123:	89 c3                	mov    %eax,%ebx
+     125:	83 c0 01             	add    $0x1,%eax
+     128:	0f b6 09             	movzbl (%ecx),%ecx
+     12b:	88 0b                	mov    %cl,(%ebx)
+     12d:	84 c9                	test   %cl,%cl
+     12f:	75 ed                	jne    11e <strcpy+0xd>
+    ;
+  return os;
+}
+     131:	89 f0                	mov    %esi,%eax
+     133:	5b                   	pop    %ebx
+     134:	5e                   	pop    %esi
+     135:	5d                   	pop    %ebp
+     136:	c3                   	ret
+
+00000137 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     137:	55                   	push   %ebp
+     138:	89 e5                	mov    %esp,%ebp
+     13a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     13d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+     140:	eb 06                	jmp    148 <strcmp+0x11>
+    p++, q++;
+     142:	83 c1 01             	add    $0x1,%ecx
+     145:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+     148:	0f b6 01             	movzbl (%ecx),%eax
+     14b:	84 c0                	test   %al,%al
+     14d:	74 04                	je     153 <strcmp+0x1c>
+     14f:	3a 02                	cmp    (%edx),%al
+     151:	74 ef                	je     142 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+     153:	0f b6 c0             	movzbl %al,%eax
+     156:	0f b6 12             	movzbl (%edx),%edx
+     159:	29 d0                	sub    %edx,%eax
+}
+     15b:	5d                   	pop    %ebp
+     15c:	c3                   	ret
+
+0000015d <strlen>:
+
+uint
+strlen(const char *s)
+{
+     15d:	55                   	push   %ebp
+     15e:	89 e5                	mov    %esp,%ebp
+     160:	53                   	push   %ebx
+     161:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  const char *p;
+  uint w;
+
+  for(p = s; (uint)p & 3; p++)
+     164:	89 c8                	mov    %ecx,%eax
+     166:	eb 03                	jmp    16b <strlen+0xe>
+     168:	83 c0 01             	add    $0x1,%eax
+     16b:	a8 03                	test   $0x3,%al
+     16d:	74 09                	je     178 <strlen+0x1b>
+    if(*p == 0)
+     16f:	80 38 00             	cmpb   $0x0,(%eax)
+     172:	75 f4                	jne    168 <strlen+0xb>
+      return p - s;
+     174:	29 c8                	sub    %ecx,%eax
+     176:	eb 25                	jmp    19d <strlen+0x40>
+  // Then a word at a time, which never crosses into the next page:
+  // a word with a zero byte in it has one of these bits set.
+  for(;; p += 4){
+    w = *(uint*)p;
+     178:	8b 10                	mov    (%eax),%edx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     17a:	8d 9a ff fe fe fe    	lea    -0x1010101(%edx),%ebx
+     180:	f7 d2                	not    %edx
+     182:	21 da                	and    %ebx,%edx
+     184:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+     18a:	75 05                	jne    191 <strlen+0x34>
+  for(;; p += 4){
+     18c:	83 c0 04             	add    $0x4,%eax
+    w = *(uint*)p;
+     18f:	eb e7                	jmp    178 <strlen+0x1b>
+      break;
+  }
+  while(*p)
+     191:	80 38 00             	cmpb   $0x0,(%eax)
+     194:	74 05                	je     19b <strlen+0x3e>
+    p++;
+     196:	83 c0 01             	add    $0x1,%eax
+     199:	eb f6                	jmp    191 <strlen+0x34>
+  return p - s;
+     19b:	29 c8                	sub    %ecx,%eax
+}
+     19d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     1a0:	c9                   	leave
+     1a1:	c3                   	ret
+
+000001a2 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     1a2:	55                   	push   %ebp
+     1a3:	89 e5                	mov    %esp,%ebp
+     1a5:	57                   	push   %edi
+     1a6:	56                   	push   %esi
+     1a7:	53                   	push   %ebx
+     1a8:	8b 55 10             	mov    0x10(%ebp),%edx
+  uint h;
+  char *d;
+
+  d = dst;
+  c &= 0xFF;
+     1ab:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  if(n >= 16){
+     1af:	83 fa 0f             	cmp    $0xf,%edx
+     1b2:	76 52                	jbe    206 <memset+0x64>
+    h = -(uint)d & 3;
+     1b4:	8b 45 08             	mov    0x8(%ebp),%eax
+     1b7:	f7 d8                	neg    %eax
+     1b9:	83 e0 03             	and    $0x3,%eax
+     1bc:	89 c6                	mov    %eax,%esi
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     1be:	8b 7d 08             	mov    0x8(%ebp),%edi
+     1c1:	89 c1                	mov    %eax,%ecx
+     1c3:	89 d8                	mov    %ebx,%eax
+     1c5:	fc                   	cld
+     1c6:	f3 aa                	rep stos %al,%es:(%edi)
+    stosb(d, c, h);
+    stosl(d + h, (c<<24)|(c<<16)|(c<<8)|c, (n - h)/4);
+     1c8:	29 f2                	sub    %esi,%edx
+     1ca:	89 d1                	mov    %edx,%ecx
+     1cc:	c1 e9 02             	shr    $0x2,%ecx
+     1cf:	c1 e0 18             	shl    $0x18,%eax
+     1d2:	89 df                	mov    %ebx,%edi
+     1d4:	c1 e7 10             	shl    $0x10,%edi
+     1d7:	09 f8                	or     %edi,%eax
+     1d9:	89 df                	mov    %ebx,%edi
+     1db:	c1 e7 08             	shl    $0x8,%edi
+     1de:	09 f8                	or     %edi,%eax
+     1e0:	09 d8                	or     %ebx,%eax
+     1e2:	89 f7                	mov    %esi,%edi
+     1e4:	03 7d 08             	add    0x8(%ebp),%edi
+}
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosl" :
+     1e7:	fc                   	cld
+     1e8:	f3 ab                	rep stos %eax,%es:(%edi)
+    d += h + (n - h)/4*4;
+     1ea:	89 d7                	mov    %edx,%edi
+     1ec:	83 e7 fc             	and    $0xfffffffc,%edi
+     1ef:	09 f7                	or     %esi,%edi
+     1f1:	03 7d 08             	add    0x8(%ebp),%edi
+    n = (n - h)%4;
+     1f4:	83 e2 03             	and    $0x3,%edx
+  asm volatile("cld; rep stosb" :
+     1f7:	89 d1                	mov    %edx,%ecx
+     1f9:	89 d8                	mov    %ebx,%eax
+     1fb:	fc                   	cld
+     1fc:	f3 aa                	rep stos %al,%es:(%edi)
+  }
+  stosb(d, c, n);
+  return dst;
+}
+     1fe:	8b 45 08             	mov    0x8(%ebp),%eax
+     201:	5b                   	pop    %ebx
+     202:	5e                   	pop    %esi
+     203:	5f                   	pop    %edi
+     204:	5d                   	pop    %ebp
+     205:	c3                   	ret
+  d = dst;
+     206:	8b 7d 08             	mov    0x8(%ebp),%edi
+     209:	eb ec                	jmp    1f7 <memset+0x55>
+
+0000020b <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     20b:	55                   	push   %ebp
+     20c:	89 e5                	mov    %esp,%ebp
+     20e:	8b 45 08             	mov    0x8(%ebp),%eax
+     211:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     215:	eb 03                	jmp    21a <strchr+0xf>
+     217:	83 c0 01             	add    $0x1,%eax
+     21a:	0f b6 10             	movzbl (%eax),%edx
+     21d:	84 d2                	test   %dl,%dl
+     21f:	74 06                	je     227 <strchr+0x1c>
+    if(*s == c)
+     221:	38 ca                	cmp    %cl,%dl
+     223:	75 f2                	jne    217 <strchr+0xc>
+     225:	eb 05                	jmp    22c <strchr+0x21>
+      return (char*)s;
+  return 0;
+     227:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     22c:	5d                   	pop    %ebp
+     22d:	c3                   	ret
+
+0000022e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     22e:	55                   	push   %ebp
+     22f:	89 e5                	mov    %esp,%ebp
+     231:	56                   	push   %esi
+     232:	53                   	push   %ebx
+     233:	8b 55 08             	mov    0x8(%ebp),%edx
+     236:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     239:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  // A word at a time while they agree.
+  if((((uint)s1 | (uint)s2) & 3) == 0)
+     23c:	89 d3                	mov    %edx,%ebx
+     23e:	09 cb                	or     %ecx,%ebx
+     240:	f6 c3 03             	test   $0x3,%bl
+     243:	74 24                	je     269 <memcmp+0x3b>
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+      s1 += 4, s2 += 4;
+  while(n-- > 0){
+     245:	8d 70 ff             	lea    -0x1(%eax),%esi
+     248:	85 c0                	test   %eax,%eax
+     24a:	74 32                	je     27e <memcmp+0x50>
+    if(*s1 != *s2)
+     24c:	0f b6 02             	movzbl (%edx),%eax
+     24f:	0f b6 19             	movzbl (%ecx),%ebx
+     252:	38 d8                	cmp    %bl,%al
+     254:	75 20                	jne    276 <memcmp+0x48>
+      return *s1 - *s2;
+    s1++, s2++;
+     256:	83 c2 01             	add    $0x1,%edx
+     259:	83 c1 01             	add    $0x1,%ecx
+  while(n-- > 0){
+     25c:	89 f0                	mov    %esi,%eax
+     25e:	eb e5                	jmp    245 <memcmp+0x17>
+      s1 += 4, s2 += 4;
+     260:	83 c2 04             	add    $0x4,%edx
+     263:	83 c1 04             	add    $0x4,%ecx
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+     266:	83 e8 04             	sub    $0x4,%eax
+     269:	83 f8 03             	cmp    $0x3,%eax
+     26c:	76 d7                	jbe    245 <memcmp+0x17>
+     26e:	8b 31                	mov    (%ecx),%esi
+     270:	39 32                	cmp    %esi,(%edx)
+     272:	74 ec                	je     260 <memcmp+0x32>
+     274:	eb cf                	jmp    245 <memcmp+0x17>
+      return *s1 - *s2;
+     276:	0f b6 c0             	movzbl %al,%eax
+     279:	0f b6 db             	movzbl %bl,%ebx
+     27c:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     27e:	5b                   	pop    %ebx
+     27f:	5e                   	pop    %esi
+     280:	5d                   	pop    %ebp
+     281:	c3                   	ret
+
+00000282 <memchr>:
+// The first c in the n bytes at v, or 0.  Once aligned, a word at
+// a time, with the word's bytes that equal c turned into zeroes
+// and those looked for.
+void*
+memchr(const void *v, int c, uint n)
+{
+     282:	55                   	push   %ebp
+     283:	89 e5                	mov    %esp,%ebp
+     285:	57                   	push   %edi
+     286:	56                   	push   %esi
+     287:	53                   	push   %ebx
+     288:	8b 45 08             	mov    0x8(%ebp),%eax
+     28b:	8b 55 10             	mov    0x10(%ebp),%edx
+  const uchar *s;
+  uint w, rep;
+
+  s = v;
+  c = (uchar)c;
+     28e:	0f b6 75 0c          	movzbl 0xc(%ebp),%esi
+  for(; n > 0 && ((uint)s & 3); n--, s++)
+     292:	eb 06                	jmp    29a <memchr+0x18>
+     294:	83 ea 01             	sub    $0x1,%edx
+     297:	83 c0 01             	add    $0x1,%eax
+     29a:	85 d2                	test   %edx,%edx
+     29c:	74 0d                	je     2ab <memchr+0x29>
+     29e:	a8 03                	test   $0x3,%al
+     2a0:	74 09                	je     2ab <memchr+0x29>
+    if(*s == c)
+     2a2:	0f b6 08             	movzbl (%eax),%ecx
+     2a5:	39 f1                	cmp    %esi,%ecx
+     2a7:	75 eb                	jne    294 <memchr+0x12>
+     2a9:	eb 41                	jmp    2ec <memchr+0x6a>
+      return (void*)s;
+  rep = c * 0x01010101;
+     2ab:	69 fe 01 01 01 01    	imul   $0x1010101,%esi,%edi
+  for(; n >= 4; n -= 4, s += 4){
+     2b1:	eb 06                	jmp    2b9 <memchr+0x37>
+     2b3:	83 ea 04             	sub    $0x4,%edx
+     2b6:	83 c0 04             	add    $0x4,%eax
+     2b9:	83 fa 03             	cmp    $0x3,%edx
+     2bc:	76 16                	jbe    2d4 <memchr+0x52>
+    w = *(uint*)s ^ rep;
+     2be:	89 f9                	mov    %edi,%ecx
+     2c0:	33 08                	xor    (%eax),%ecx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     2c2:	8d 99 ff fe fe fe    	lea    -0x1010101(%ecx),%ebx
+     2c8:	f7 d1                	not    %ecx
+     2ca:	21 cb                	and    %ecx,%ebx
+     2cc:	f7 c3 80 80 80 80    	test   $0x80808080,%ebx
+     2d2:	74 df                	je     2b3 <memchr+0x31>
+      break;
+  }
+  for(; n > 0; n--, s++)
+     2d4:	85 d2                	test   %edx,%edx
+     2d6:	74 0f                	je     2e7 <memchr+0x65>
+    if(*s == c)
+     2d8:	0f b6 08             	movzbl (%eax),%ecx
+     2db:	39 f1                	cmp    %esi,%ecx
+     2dd:	74 0d                	je     2ec <memchr+0x6a>
+  for(; n > 0; n--, s++)
+     2df:	83 ea 01             	sub    $0x1,%edx
+     2e2:	83 c0 01             	add    $0x1,%eax
+     2e5:	eb ed                	jmp    2d4 <memchr+0x52>
+      return (void*)s;
+  return 0;
+     2e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     2ec:	5b                   	pop    %ebx
+     2ed:	5e                   	pop    %esi
+     2ee:	5f                   	pop    %edi
+     2ef:	5d                   	pop    %ebp
+     2f0:	c3                   	ret
+
+000002f1 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     2f1:	55                   	push   %ebp
+     2f2:	89 e5                	mov    %esp,%ebp
+     2f4:	57                   	push   %edi
+     2f5:	56                   	push   %esi
+     2f6:	53                   	push   %ebx
+     2f7:	83 ec 1c             	sub    $0x1c,%esp
+     2fa:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     2fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+     302:	89 de                	mov    %ebx,%esi
+     304:	83 c3 01             	add    $0x1,%ebx
+     307:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     30a:	7d 2e                	jge    33a <gets+0x49>
+    cc = read(0, &c, 1);
+     30c:	83 ec 04             	sub    $0x4,%esp
+     30f:	6a 01                	push   $0x1
+     311:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     314:	50                   	push   %eax
+     315:	6a 00                	push   $0x0
+     317:	e8 51 05 00 00       	call   86d <read>
+    if(cc < 1)
+     31c:	83 c4 10             	add    $0x10,%esp
+     31f:	85 c0                	test   %eax,%eax
+     321:	7e 17                	jle    33a <gets+0x49>
+      break;
+    buf[i++] = c;
+     323:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     327:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+     32a:	3c 0a                	cmp    $0xa,%al
+     32c:	0f 94 c2             	sete   %dl
+     32f:	3c 0d                	cmp    $0xd,%al
+     331:	0f 94 c0             	sete   %al
+     334:	08 c2                	or     %al,%dl
+     336:	74 ca                	je     302 <gets+0x11>
+    buf[i++] = c;
+     338:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+     33a:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+     33e:	89 f8                	mov    %edi,%eax
+     340:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     343:	5b                   	pop    %ebx
+     344:	5e                   	pop    %esi
+     345:	5f                   	pop    %edi
+     346:	5d                   	pop    %ebp
+     347:	c3                   	ret
+
+00000348 <atoi>:
+  return r;
+}
+
+int
+atoi(const char *s)
+{
+     348:	55                   	push   %ebp
+     349:	89 e5                	mov    %esp,%ebp
+     34b:	53                   	push   %ebx
+     34c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+     34f:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+     354:	eb 10                	jmp    366 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+     356:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+     359:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+     35c:	83 c1 01             	add    $0x1,%ecx
+     35f:	0f be c0             	movsbl %al,%eax
+     362:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+     366:	0f b6 01             	movzbl (%ecx),%eax
+     369:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     36c:	80 fb 09             	cmp    $0x9,%bl
+     36f:	76 e5                	jbe    356 <atoi+0xe>
+  return n;
+}
+     371:	89 d0                	mov    %edx,%eax
+     373:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     376:	c9                   	leave
+     377:	c3                   	ret
+
+00000378 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     378:	55                   	push   %ebp
+     379:	89 e5                	mov    %esp,%ebp
+     37b:	57                   	push   %edi
+     37c:	56                   	push   %esi
+     37d:	53                   	push   %ebx
+     37e:	83 ec 08             	sub    $0x8,%esp
+     381:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     384:	8b 55 0c             	mov    0xc(%ebp),%edx
+     387:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *src;
+  int h;
+
+  dst = vdst;
+  src = vsrc;
+  if(n <= 0)
+     38a:	85 c0                	test   %eax,%eax
+     38c:	0f 8e 82 00 00 00    	jle    414 <memmove+0x9c>
+    return vdst;
+  if(src < dst && src + n > dst){
+     392:	39 da                	cmp    %ebx,%edx
+     394:	73 07                	jae    39d <memmove+0x25>
+     396:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+     399:	39 cb                	cmp    %ecx,%ebx
+     39b:	72 5e                	jb     3fb <memmove+0x83>
+    movsbback(dst + n - 1, src + n - 1, n);
+    return vdst;
+  }
+  if(n >= 16 && (((uint)dst ^ (uint)src) & 3) == 0){
+     39d:	83 f8 0f             	cmp    $0xf,%eax
+     3a0:	7e 69                	jle    40b <memmove+0x93>
+     3a2:	89 d9                	mov    %ebx,%ecx
+     3a4:	31 d1                	xor    %edx,%ecx
+     3a6:	f6 c1 03             	test   $0x3,%cl
+     3a9:	75 73                	jne    41e <memmove+0xa6>
+    h = -(uint)dst & 3;
+     3ab:	89 d9                	mov    %ebx,%ecx
+     3ad:	f7 d9                	neg    %ecx
+     3af:	83 e1 03             	and    $0x3,%ecx
+}
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsb" :
+     3b2:	89 df                	mov    %ebx,%edi
+     3b4:	89 d6                	mov    %edx,%esi
+     3b6:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+     3b9:	fc                   	cld
+     3ba:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    movsb(dst, src, h);
+    dst += h, src += h, n -= h;
+     3bc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+     3bf:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+     3c2:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+     3c5:	29 f0                	sub    %esi,%eax
+    movsl(dst, src, n/4);
+     3c7:	8d 50 03             	lea    0x3(%eax),%edx
+     3ca:	0f 49 d0             	cmovns %eax,%edx
+     3cd:	c1 fa 02             	sar    $0x2,%edx
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+     3d0:	89 7d f0             	mov    %edi,-0x10(%ebp)
+     3d3:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     3d6:	89 ce                	mov    %ecx,%esi
+     3d8:	89 d1                	mov    %edx,%ecx
+     3da:	fc                   	cld
+     3db:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    dst += n/4*4, src += n/4*4, n %= 4;
+     3dd:	c1 e2 02             	shl    $0x2,%edx
+     3e0:	8b 7d f0             	mov    -0x10(%ebp),%edi
+     3e3:	01 d7                	add    %edx,%edi
+     3e5:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     3e8:	01 ca                	add    %ecx,%edx
+     3ea:	89 c6                	mov    %eax,%esi
+     3ec:	c1 fe 1f             	sar    $0x1f,%esi
+     3ef:	c1 ee 1e             	shr    $0x1e,%esi
+     3f2:	01 f0                	add    %esi,%eax
+     3f4:	83 e0 03             	and    $0x3,%eax
+     3f7:	29 f0                	sub    %esi,%eax
+     3f9:	eb 12                	jmp    40d <memmove+0x95>
+    movsbback(dst + n - 1, src + n - 1, n);
+     3fb:	8d 78 ff             	lea    -0x1(%eax),%edi
+     3fe:	8d 34 3a             	lea    (%edx,%edi,1),%esi
+     401:	01 df                	add    %ebx,%edi
+// Copy cnt bytes down from the last ones, at dst and src, to the
+// first: for overlapping moves up.
+static inline void
+movsbback(void *dst, const void *src, int cnt)
+{
+  asm volatile("std; rep movsb; cld" :
+     403:	89 c1                	mov    %eax,%ecx
+     405:	fd                   	std
+     406:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     408:	fc                   	cld
+    return vdst;
+     409:	eb 09                	jmp    414 <memmove+0x9c>
+  dst = vdst;
+     40b:	89 df                	mov    %ebx,%edi
+  asm volatile("cld; rep movsb" :
+     40d:	89 d6                	mov    %edx,%esi
+     40f:	89 c1                	mov    %eax,%ecx
+     411:	fc                   	cld
+     412:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  }
+  movsb(dst, src, n);
+  return vdst;
+}
+     414:	89 d8                	mov    %ebx,%eax
+     416:	83 c4 08             	add    $0x8,%esp
+     419:	5b                   	pop    %ebx
+     41a:	5e                   	pop    %esi
+     41b:	5f                   	pop    %edi
+     41c:	5d                   	pop    %ebp
+     41d:	c3                   	ret
+  dst = vdst;
+     41e:	89 df                	mov    %ebx,%edi
+     420:	eb eb                	jmp    40d <memmove+0x95>
+
+00000422 <vclock_gettime>:
+
+// clock_gettime() without a system call: read the clock page
+// that the kernel maps at CLOCKPAGE (see clock.h).
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+     422:	55                   	push   %ebp
+     423:	89 e5                	mov    %esp,%ebp
+     425:	57                   	push   %edi
+     426:	56                   	push   %esi
+     427:	53                   	push   %ebx
+     428:	83 ec 14             	sub    $0x14,%esp
+  struct clockpage *cp = (struct clockpage*)CLOCKPAGE;
+  uint seq, rem, d;
+  uint64 tsc, ns, now;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+     42b:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     42f:	0f 87 a3 00 00 00    	ja     4d8 <vclock_gettime+0xb6>
+    return -1;
+  do {
+    seq = cp->seq;
+     435:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+    __sync_synchronize();
+     43a:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    tsc = cp->tsc;
+     43f:	8b 15 10 f0 ff 7f    	mov    0x7ffff010,%edx
+     445:	8b 1d 14 f0 ff 7f    	mov    0x7ffff014,%ebx
+    ns = cp->ns;
+     44b:	8b 35 18 f0 ff 7f    	mov    0x7ffff018,%esi
+     451:	8b 3d 1c f0 ff 7f    	mov    0x7ffff01c,%edi
+    __sync_synchronize();
+     457:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != cp->seq);
+     45c:	89 c1                	mov    %eax,%ecx
+     45e:	83 e1 01             	and    $0x1,%ecx
+     461:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     464:	75 cf                	jne    435 <vclock_gettime+0x13>
+     466:	8b 0d 00 f0 ff 7f    	mov    0x7ffff000,%ecx
+     46c:	39 c1                	cmp    %eax,%ecx
+     46e:	75 c5                	jne    435 <vclock_gettime+0x13>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+     470:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     473:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     476:	0f 31                	rdtsc
+     478:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     47b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     47e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  now = rdtsc();
+  // Less than a tick has passed since the update, so the delta
+  // fits in 32 bits.
+  d = now > tsc ? now - tsc : 0;
+     481:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     484:	19 d3                	sbb    %edx,%ebx
+     486:	73 07                	jae    48f <vclock_gettime+0x6d>
+     488:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+     48b:	29 d8                	sub    %ebx,%eax
+     48d:	89 c1                	mov    %eax,%ecx
+  ns += ((uint64)d * cp->mult) >> cp->shift;
+     48f:	89 c8                	mov    %ecx,%eax
+     491:	f7 25 04 f0 ff 7f    	mull   0x7ffff004
+     497:	0f b6 0d 08 f0 ff 7f 	movzbl 0x7ffff008,%ecx
+     49e:	0f ad d0             	shrd   %cl,%edx,%eax
+     4a1:	d3 ea                	shr    %cl,%edx
+     4a3:	f6 c1 20             	test   $0x20,%cl
+     4a6:	74 04                	je     4ac <vclock_gettime+0x8a>
+     4a8:	89 d0                	mov    %edx,%eax
+     4aa:	31 d2                	xor    %edx,%edx
+     4ac:	01 f0                	add    %esi,%eax
+     4ae:	11 fa                	adc    %edi,%edx
+static inline uint
+divl(uint64 n, uint d, uint *r)
+{
+  uint q;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (*r) :
+     4b0:	bb 00 ca 9a 3b       	mov    $0x3b9aca00,%ebx
+     4b5:	f7 f3                	div    %ebx
+  ts->tv_sec = divl(ns, 1000000000, &rem);
+     4b7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     4ba:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = rem;
+     4bc:	89 57 04             	mov    %edx,0x4(%edi)
+  if(clk == CLOCK_REALTIME)
+     4bf:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     4c3:	75 1a                	jne    4df <vclock_gettime+0xbd>
+    ts->tv_sec += cp->boottime;
+     4c5:	03 05 0c f0 ff 7f    	add    0x7ffff00c,%eax
+     4cb:	89 07                	mov    %eax,(%edi)
+  return 0;
+     4cd:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     4d0:	83 c4 14             	add    $0x14,%esp
+     4d3:	5b                   	pop    %ebx
+     4d4:	5e                   	pop    %esi
+     4d5:	5f                   	pop    %edi
+     4d6:	5d                   	pop    %ebp
+     4d7:	c3                   	ret
+    return -1;
+     4d8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     4dd:	eb f1                	jmp    4d0 <vclock_gettime+0xae>
+  return 0;
+     4df:	b8 00 00 00 00       	mov    $0x0,%eax
+     4e4:	eb ea                	jmp    4d0 <vclock_gettime+0xae>
+
+000004e6 <flush>:
+
+// Write out fd's buffer, or with fd < 0 every buffer.
+// Returns -1 if a write fails.
+int
+flush(int fd)
+{
+     4e6:	55                   	push   %ebp
+     4e7:	89 e5                	mov    %esp,%ebp
+     4e9:	56                   	push   %esi
+     4ea:	53                   	push   %ebx
+     4eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  int r, n;
+
+  if(fd < 0){
+     4ee:	85 c0                	test   %eax,%eax
+     4f0:	78 5d                	js     54f <flush+0x69>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+      if(flush(fd) < 0)
+        r = -1;
+    return r;
+  }
+  if(fd >= NOBUF || (n = obuf[fd].n) == 0)
+     4f2:	83 f8 0f             	cmp    $0xf,%eax
+     4f5:	7f 64                	jg     55b <flush+0x75>
+     4f7:	69 d0 08 02 00 00    	imul   $0x208,%eax,%edx
+     4fd:	8b b2 44 1a 00 00    	mov    0x1a44(%edx),%esi
+     503:	85 f6                	test   %esi,%esi
+     505:	74 59                	je     560 <flush+0x7a>
+    return 0;
+  obuf[fd].n = 0;
+     507:	c7 82 44 1a 00 00 00 	movl   $0x0,0x1a44(%edx)
+     50e:	00 00 00 
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     511:	81 c2 48 1a 00 00    	add    $0x1a48,%edx
+     517:	83 ec 04             	sub    $0x4,%esp
+     51a:	56                   	push   %esi
+     51b:	52                   	push   %edx
+     51c:	50                   	push   %eax
+     51d:	e8 5a 03 00 00       	call   87c <write>
+     522:	83 c4 10             	add    $0x10,%esp
+     525:	39 f0                	cmp    %esi,%eax
+     527:	75 40                	jne    569 <flush+0x83>
+     529:	be 00 00 00 00       	mov    $0x0,%esi
+     52e:	eb 30                	jmp    560 <flush+0x7a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     530:	83 c3 01             	add    $0x1,%ebx
+     533:	83 fb 0f             	cmp    $0xf,%ebx
+     536:	7f 28                	jg     560 <flush+0x7a>
+      if(flush(fd) < 0)
+     538:	83 ec 0c             	sub    $0xc,%esp
+     53b:	53                   	push   %ebx
+     53c:	e8 a5 ff ff ff       	call   4e6 <flush>
+     541:	83 c4 10             	add    $0x10,%esp
+     544:	85 c0                	test   %eax,%eax
+     546:	79 e8                	jns    530 <flush+0x4a>
+        r = -1;
+     548:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     54d:	eb e1                	jmp    530 <flush+0x4a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     54f:	be 00 00 00 00       	mov    $0x0,%esi
+     554:	bb 00 00 00 00       	mov    $0x0,%ebx
+     559:	eb d8                	jmp    533 <flush+0x4d>
+    return 0;
+     55b:	be 00 00 00 00       	mov    $0x0,%esi
+}
+     560:	89 f0                	mov    %esi,%eax
+     562:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     565:	5b                   	pop    %ebx
+     566:	5e                   	pop    %esi
+     567:	5d                   	pop    %ebp
+     568:	c3                   	ret
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     569:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     56e:	eb f0                	jmp    560 <flush+0x7a>
+
+00000570 <bufreset>:
+
+static void
+bufreset(int fd)
+{
+  if(fd >= 0 && fd < NOBUF){
+     570:	83 f8 0f             	cmp    $0xf,%eax
+     573:	76 01                	jbe    576 <bufreset+0x6>
+     575:	c3                   	ret
+{
+     576:	55                   	push   %ebp
+     577:	89 e5                	mov    %esp,%ebp
+     579:	53                   	push   %ebx
+     57a:	83 ec 10             	sub    $0x10,%esp
+     57d:	89 c3                	mov    %eax,%ebx
+    flush(fd);
+     57f:	50                   	push   %eax
+     580:	e8 61 ff ff ff       	call   4e6 <flush>
+    obuf[fd].mode = BUNKNOWN;
+     585:	69 db 08 02 00 00    	imul   $0x208,%ebx,%ebx
+     58b:	c7 83 40 1a 00 00 00 	movl   $0x0,0x1a40(%ebx)
+     592:	00 00 00 
+     595:	83 c4 10             	add    $0x10,%esp
+  }
+}
+     598:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     59b:	c9                   	leave
+     59c:	c3                   	ret
+
+0000059d <bufwrite>:
+
+// Write n bytes from p to fd, through its buffer.
+// Returns n, or -1 if a write fails.
+int
+bufwrite(int fd, const void *p, int n)
+{
+     59d:	55                   	push   %ebp
+     59e:	89 e5                	mov    %esp,%ebp
+     5a0:	57                   	push   %edi
+     5a1:	56                   	push   %esi
+     5a2:	53                   	push   %ebx
+     5a3:	83 ec 3c             	sub    $0x3c,%esp
+     5a6:	8b 75 08             	mov    0x8(%ebp),%esi
+     5a9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct stat st;
+  const char *s;
+  int i;
+
+  if(fd < 0 || fd >= NOBUF)
+     5ac:	83 fe 0f             	cmp    $0xf,%esi
+     5af:	0f 87 a2 00 00 00    	ja     657 <bufwrite+0xba>
+    return write(fd, p, n);
+  if(obuf[fd].mode == BUNKNOWN){
+     5b5:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     5bb:	83 b8 40 1a 00 00 00 	cmpl   $0x0,0x1a40(%eax)
+     5c2:	75 19                	jne    5dd <bufwrite+0x40>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     5c4:	83 fe 02             	cmp    $0x2,%esi
+     5c7:	0f 85 9c 00 00 00    	jne    669 <bufwrite+0xcc>
+      obuf[fd].mode = BNONE;
+     5cd:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     5d3:	c7 80 40 1a 00 00 01 	movl   $0x1,0x1a40(%eax)
+     5da:	00 00 00 
+    else
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+  }
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     5dd:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     5e3:	89 da                	mov    %ebx,%edx
+     5e5:	03 90 44 1a 00 00    	add    0x1a44(%eax),%edx
+     5eb:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+     5f1:	0f 8f ae 00 00 00    	jg     6a5 <bufwrite+0x108>
+    return -1;
+  if(n >= OBUFSZ)
+     5f7:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+     5fd:	0f 8f bd 00 00 00    	jg     6c0 <bufwrite+0x123>
+    return write(fd, p, n);
+  memmove(obuf[fd].buf + obuf[fd].n, p, n);
+     603:	69 d6 08 02 00 00    	imul   $0x208,%esi,%edx
+     609:	8d ba 40 1a 00 00    	lea    0x1a40(%edx),%edi
+     60f:	8b 82 44 1a 00 00    	mov    0x1a44(%edx),%eax
+     615:	83 ec 04             	sub    $0x4,%esp
+     618:	53                   	push   %ebx
+     619:	ff 75 0c             	push   0xc(%ebp)
+     61c:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     61f:	8d 84 10 48 1a 00 00 	lea    0x1a48(%eax,%edx,1),%eax
+     626:	50                   	push   %eax
+     627:	e8 4c fd ff ff       	call   378 <memmove>
+  obuf[fd].n += n;
+     62c:	01 5f 04             	add    %ebx,0x4(%edi)
+  if(obuf[fd].mode == BNONE)
+     62f:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     632:	8b 82 40 1a 00 00    	mov    0x1a40(%edx),%eax
+     638:	83 c4 10             	add    $0x10,%esp
+     63b:	83 f8 01             	cmp    $0x1,%eax
+     63e:	0f 84 91 00 00 00    	je     6d5 <bufwrite+0x138>
+    return flush(fd) < 0 ? -1 : n;
+  if(obuf[fd].mode == BLINE)
+     644:	83 f8 02             	cmp    $0x2,%eax
+     647:	0f 84 ca 00 00 00    	je     717 <bufwrite+0x17a>
+    for(s = p, i = 0; i < n; i++)
+      if(s[i] == '\n')
+        return flush(fd) < 0 ? -1 : n;
+  return n;
+     64d:	89 d8                	mov    %ebx,%eax
+}
+     64f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     652:	5b                   	pop    %ebx
+     653:	5e                   	pop    %esi
+     654:	5f                   	pop    %edi
+     655:	5d                   	pop    %ebp
+     656:	c3                   	ret
+    return write(fd, p, n);
+     657:	83 ec 04             	sub    $0x4,%esp
+     65a:	53                   	push   %ebx
+     65b:	ff 75 0c             	push   0xc(%ebp)
+     65e:	56                   	push   %esi
+     65f:	e8 18 02 00 00       	call   87c <write>
+     664:	83 c4 10             	add    $0x10,%esp
+     667:	eb e6                	jmp    64f <bufwrite+0xb2>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     669:	83 ec 08             	sub    $0x8,%esp
+     66c:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     66f:	50                   	push   %eax
+     670:	56                   	push   %esi
+     671:	e8 51 02 00 00       	call   8c7 <fstat>
+     676:	83 c4 10             	add    $0x10,%esp
+     679:	85 c0                	test   %eax,%eax
+     67b:	0f 88 4c ff ff ff    	js     5cd <bufwrite+0x30>
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+     681:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     686:	74 16                	je     69e <bufwrite+0x101>
+     688:	ba 03 00 00 00       	mov    $0x3,%edx
+     68d:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     693:	89 90 40 1a 00 00    	mov    %edx,0x1a40(%eax)
+     699:	e9 3f ff ff ff       	jmp    5dd <bufwrite+0x40>
+     69e:	ba 02 00 00 00       	mov    $0x2,%edx
+     6a3:	eb e8                	jmp    68d <bufwrite+0xf0>
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     6a5:	83 ec 0c             	sub    $0xc,%esp
+     6a8:	56                   	push   %esi
+     6a9:	e8 38 fe ff ff       	call   4e6 <flush>
+     6ae:	83 c4 10             	add    $0x10,%esp
+     6b1:	85 c0                	test   %eax,%eax
+     6b3:	0f 89 3e ff ff ff    	jns    5f7 <bufwrite+0x5a>
+    return -1;
+     6b9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     6be:	eb 8f                	jmp    64f <bufwrite+0xb2>
+    return write(fd, p, n);
+     6c0:	83 ec 04             	sub    $0x4,%esp
+     6c3:	53                   	push   %ebx
+     6c4:	ff 75 0c             	push   0xc(%ebp)
+     6c7:	56                   	push   %esi
+     6c8:	e8 af 01 00 00       	call   87c <write>
+     6cd:	83 c4 10             	add    $0x10,%esp
+     6d0:	e9 7a ff ff ff       	jmp    64f <bufwrite+0xb2>
+    return flush(fd) < 0 ? -1 : n;
+     6d5:	83 ec 0c             	sub    $0xc,%esp
+     6d8:	56                   	push   %esi
+     6d9:	e8 08 fe ff ff       	call   4e6 <flush>
+     6de:	83 c4 10             	add    $0x10,%esp
+     6e1:	85 c0                	test   %eax,%eax
+     6e3:	78 07                	js     6ec <bufwrite+0x14f>
+     6e5:	89 d8                	mov    %ebx,%eax
+     6e7:	e9 63 ff ff ff       	jmp    64f <bufwrite+0xb2>
+     6ec:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     6f1:	e9 59 ff ff ff       	jmp    64f <bufwrite+0xb2>
+        return flush(fd) < 0 ? -1 : n;
+     6f6:	83 ec 0c             	sub    $0xc,%esp
+     6f9:	56                   	push   %esi
+     6fa:	e8 e7 fd ff ff       	call   4e6 <flush>
+     6ff:	83 c4 10             	add    $0x10,%esp
+     702:	85 c0                	test   %eax,%eax
+     704:	78 07                	js     70d <bufwrite+0x170>
+     706:	89 d8                	mov    %ebx,%eax
+     708:	e9 42 ff ff ff       	jmp    64f <bufwrite+0xb2>
+     70d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     712:	e9 38 ff ff ff       	jmp    64f <bufwrite+0xb2>
+    for(s = p, i = 0; i < n; i++)
+     717:	b8 00 00 00 00       	mov    $0x0,%eax
+     71c:	39 d8                	cmp    %ebx,%eax
+     71e:	7d 0e                	jge    72e <bufwrite+0x191>
+      if(s[i] == '\n')
+     720:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     723:	80 3c 01 0a          	cmpb   $0xa,(%ecx,%eax,1)
+     727:	74 cd                	je     6f6 <bufwrite+0x159>
+    for(s = p, i = 0; i < n; i++)
+     729:	83 c0 01             	add    $0x1,%eax
+     72c:	eb ee                	jmp    71c <bufwrite+0x17f>
+  return n;
+     72e:	89 d8                	mov    %ebx,%eax
+     730:	e9 1a ff ff ff       	jmp    64f <bufwrite+0xb2>
+
+00000735 <fork>:
+
+int
+fork(void)
+{
+     735:	55                   	push   %ebp
+     736:	89 e5                	mov    %esp,%ebp
+     738:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     73b:	6a ff                	push   $0xffffffff
+     73d:	e8 a4 fd ff ff       	call   4e6 <flush>
+  return _fork();
+     742:	e8 bd 00 00 00       	call   804 <_fork>
+}
+     747:	c9                   	leave
+     748:	c3                   	ret
+
+00000749 <exit>:
+
+int
+exit(void)
+{
+     749:	55                   	push   %ebp
+     74a:	89 e5                	mov    %esp,%ebp
+     74c:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     74f:	6a ff                	push   $0xffffffff
+     751:	e8 90 fd ff ff       	call   4e6 <flush>
+  _exit();
+     756:	e8 b8 00 00 00       	call   813 <_exit>
+
+0000075b <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     75b:	55                   	push   %ebp
+     75c:	89 e5                	mov    %esp,%ebp
+     75e:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     761:	6a ff                	push   $0xffffffff
+     763:	e8 7e fd ff ff       	call   4e6 <flush>
+  return _exec(path, argv);
+     768:	83 c4 08             	add    $0x8,%esp
+     76b:	ff 75 0c             	push   0xc(%ebp)
+     76e:	ff 75 08             	push   0x8(%ebp)
+     771:	e8 bb 00 00 00       	call   831 <_exec>
+}
+     776:	c9                   	leave
+     777:	c3                   	ret
+
+00000778 <close>:
+
+int
+close(int fd)
+{
+     778:	55                   	push   %ebp
+     779:	89 e5                	mov    %esp,%ebp
+     77b:	53                   	push   %ebx
+     77c:	83 ec 04             	sub    $0x4,%esp
+     77f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bufreset(fd);
+     782:	89 d8                	mov    %ebx,%eax
+     784:	e8 e7 fd ff ff       	call   570 <bufreset>
+  return _close(fd);
+     789:	83 ec 0c             	sub    $0xc,%esp
+     78c:	53                   	push   %ebx
+     78d:	e8 90 00 00 00       	call   822 <_close>
+}
+     792:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     795:	c9                   	leave
+     796:	c3                   	ret
+
+00000797 <stat>:
+{
+     797:	55                   	push   %ebp
+     798:	89 e5                	mov    %esp,%ebp
+     79a:	56                   	push   %esi
+     79b:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     79c:	83 ec 08             	sub    $0x8,%esp
+     79f:	6a 00                	push   $0x0
+     7a1:	ff 75 08             	push   0x8(%ebp)
+     7a4:	e8 f1 00 00 00       	call   89a <open>
+  if(fd < 0)
+     7a9:	83 c4 10             	add    $0x10,%esp
+     7ac:	85 c0                	test   %eax,%eax
+     7ae:	78 24                	js     7d4 <stat+0x3d>
+     7b0:	89 c3                	mov    %eax,%ebx
+  r = fstat(fd, st);
+     7b2:	83 ec 08             	sub    $0x8,%esp
+     7b5:	ff 75 0c             	push   0xc(%ebp)
+     7b8:	50                   	push   %eax
+     7b9:	e8 09 01 00 00       	call   8c7 <fstat>
+     7be:	89 c6                	mov    %eax,%esi
+  close(fd);
+     7c0:	89 1c 24             	mov    %ebx,(%esp)
+     7c3:	e8 b0 ff ff ff       	call   778 <close>
+  return r;
+     7c8:	83 c4 10             	add    $0x10,%esp
+}
+     7cb:	89 f0                	mov    %esi,%eax
+     7cd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     7d0:	5b                   	pop    %ebx
+     7d1:	5e                   	pop    %esi
+     7d2:	5d                   	pop    %ebp
+     7d3:	c3                   	ret
+    return -1;
+     7d4:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     7d9:	eb f0                	jmp    7cb <stat+0x34>
+
+000007db <dup2>:
+
+int
+dup2(int oldfd, int newfd)
+{
+     7db:	55                   	push   %ebp
+     7dc:	89 e5                	mov    %esp,%ebp
+     7de:	56                   	push   %esi
+     7df:	53                   	push   %ebx
+     7e0:	8b 75 08             	mov    0x8(%ebp),%esi
+     7e3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(oldfd != newfd)
+     7e6:	39 de                	cmp    %ebx,%esi
+     7e8:	75 11                	jne    7fb <dup2+0x20>
+    bufreset(newfd);
+  return _dup2(oldfd, newfd);
+     7ea:	83 ec 08             	sub    $0x8,%esp
+     7ed:	53                   	push   %ebx
+     7ee:	56                   	push   %esi
+     7ef:	e8 4c 00 00 00       	call   840 <_dup2>
+}
+     7f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     7f7:	5b                   	pop    %ebx
+     7f8:	5e                   	pop    %esi
+     7f9:	5d                   	pop    %ebp
+     7fa:	c3                   	ret
+    bufreset(newfd);
+     7fb:	89 d8                	mov    %ebx,%eax
+     7fd:	e8 6e fd ff ff       	call   570 <bufreset>
+     802:	eb e6                	jmp    7ea <dup2+0xf>
+
+00000804 <_fork>:
+  1: ret
+
+#define SYSCALL(name) STUB(name, SYS_ ## name)
+
+# ulib.c wraps these, to flush printf()'s buffers first.
+STUB(_fork, SYS_fork)
+     804:	b8 01 00 00 00       	mov    $0x1,%eax
+     809:	89 e1                	mov    %esp,%ecx
+     80b:	ba 12 08 00 00       	mov    $0x812,%edx
+     810:	0f 34                	sysenter
+     812:	c3                   	ret
+
+00000813 <_exit>:
+STUB(_exit, SYS_exit)
+     813:	b8 02 00 00 00       	mov    $0x2,%eax
+     818:	89 e1                	mov    %esp,%ecx
+     81a:	ba 21 08 00 00       	mov    $0x821,%edx
+     81f:	0f 34                	sysenter
+     821:	c3                   	ret
+
+00000822 <_close>:
+STUB(_close, SYS_close)
+     822:	b8 15 00 00 00       	mov    $0x15,%eax
+     827:	89 e1                	mov    %esp,%ecx
+     829:	ba 30 08 00 00       	mov    $0x830,%edx
+     82e:	0f 34                	sysenter
+     830:	c3                   	ret
+
+00000831 <_exec>:
+STUB(_exec, SYS_exec)
+     831:	b8 07 00 00 00       	mov    $0x7,%eax
+     836:	89 e1                	mov    %esp,%ecx
+     838:	ba 3f 08 00 00       	mov    $0x83f,%edx
+     83d:	0f 34                	sysenter
+     83f:	c3                   	ret
+
+00000840 <_dup2>:
+STUB(_dup2, SYS_dup2)
+     840:	b8 17 00 00 00       	mov    $0x17,%eax
+     845:	89 e1                	mov    %esp,%ecx
+     847:	ba 4e 08 00 00       	mov    $0x84e,%edx
+     84c:	0f 34                	sysenter
+     84e:	c3                   	ret
+
+0000084f <wait>:
+
+SYSCALL(wait)
+     84f:	b8 03 00 00 00       	mov    $0x3,%eax
+     854:	89 e1                	mov    %esp,%ecx
+     856:	ba 5d 08 00 00       	mov    $0x85d,%edx
+     85b:	0f 34                	sysenter
+     85d:	c3                   	ret
+
+0000085e <pipe>:
+SYSCALL(pipe)
+     85e:	b8 04 00 00 00       	mov    $0x4,%eax
+     863:	89 e1                	mov    %esp,%ecx
+     865:	ba 6c 08 00 00       	mov    $0x86c,%edx
+     86a:	0f 34                	sysenter
+     86c:	c3                   	ret
+
+0000086d <read>:
+SYSCALL(read)
+     86d:	b8 05 00 00 00       	mov    $0x5,%eax
+     872:	89 e1                	mov    %esp,%ecx
+     874:	ba 7b 08 00 00       	mov    $0x87b,%edx
+     879:	0f 34                	sysenter
+     87b:	c3                   	ret
+
+0000087c <write>:
+SYSCALL(write)
+     87c:	b8 10 00 00 00       	mov    $0x10,%eax
+     881:	89 e1                	mov    %esp,%ecx
+     883:	ba 8a 08 00 00       	mov    $0x88a,%edx
+     888:	0f 34                	sysenter
+     88a:	c3                   	ret
+
+0000088b <kill>:
+SYSCALL(kill)
+     88b:	b8 06 00 00 00       	mov    $0x6,%eax
+     890:	89 e1                	mov    %esp,%ecx
+     892:	ba 99 08 00 00       	mov    $0x899,%edx
+     897:	0f 34                	sysenter
+     899:	c3                   	ret
+
+0000089a <open>:
+SYSCALL(open)
+     89a:	b8 0f 00 00 00       	mov    $0xf,%eax
+     89f:	89 e1                	mov    %esp,%ecx
+     8a1:	ba a8 08 00 00       	mov    $0x8a8,%edx
+     8a6:	0f 34                	sysenter
+     8a8:	c3                   	ret
+
+000008a9 <mknod>:
+SYSCALL(mknod)
+     8a9:	b8 11 00 00 00       	mov    $0x11,%eax
+     8ae:	89 e1                	mov    %esp,%ecx
+     8b0:	ba b7 08 00 00       	mov    $0x8b7,%edx
+     8b5:	0f 34                	sysenter
+     8b7:	c3                   	ret
+
+000008b8 <unlink>:
+SYSCALL(unlink)
+     8b8:	b8 12 00 00 00       	mov    $0x12,%eax
+     8bd:	89 e1                	mov    %esp,%ecx
+     8bf:	ba c6 08 00 00       	mov    $0x8c6,%edx
+     8c4:	0f 34                	sysenter
+     8c6:	c3                   	ret
+
+000008c7 <fstat>:
+SYSCALL(fstat)
+     8c7:	b8 08 00 00 00       	mov    $0x8,%eax
+     8cc:	89 e1                	mov    %esp,%ecx
+     8ce:	ba d5 08 00 00       	mov    $0x8d5,%edx
+     8d3:	0f 34                	sysenter
+     8d5:	c3                   	ret
+
+000008d6 <link>:
+SYSCALL(link)
+     8d6:	b8 13 00 00 00       	mov    $0x13,%eax
+     8db:	89 e1                	mov    %esp,%ecx
+     8dd:	ba e4 08 00 00       	mov    $0x8e4,%edx
+     8e2:	0f 34                	sysenter
+     8e4:	c3                   	ret
+
+000008e5 <mkdir>:
+SYSCALL(mkdir)
+     8e5:	b8 14 00 00 00       	mov    $0x14,%eax
+     8ea:	89 e1                	mov    %esp,%ecx
+     8ec:	ba f3 08 00 00       	mov    $0x8f3,%edx
+     8f1:	0f 34                	sysenter
+     8f3:	c3                   	ret
+
+000008f4 <chdir>:
+SYSCALL(chdir)
+     8f4:	b8 09 00 00 00       	mov    $0x9,%eax
+     8f9:	89 e1                	mov    %esp,%ecx
+     8fb:	ba 02 09 00 00       	mov    $0x902,%edx
+     900:	0f 34                	sysenter
+     902:	c3                   	ret
+
+00000903 <dup>:
+SYSCALL(dup)
+     903:	b8 0a 00 00 00       	mov    $0xa,%eax
+     908:	89 e1                	mov    %esp,%ecx
+     90a:	ba 11 09 00 00       	mov    $0x911,%edx
+     90f:	0f 34                	sysenter
+     911:	c3                   	ret
+
+00000912 <getpid>:
+SYSCALL(getpid)
+     912:	b8 0b 00 00 00       	mov    $0xb,%eax
+     917:	89 e1                	mov    %esp,%ecx
+     919:	ba 20 09 00 00       	mov    $0x920,%edx
+     91e:	0f 34                	sysenter
+     920:	c3                   	ret
+
+00000921 <sbrk>:
+SYSCALL(sbrk)
+     921:	b8 0c 00 00 00       	mov    $0xc,%eax
+     926:	89 e1                	mov    %esp,%ecx
+     928:	ba 2f 09 00 00       	mov    $0x92f,%edx
+     92d:	0f 34                	sysenter
+     92f:	c3                   	ret
+
+00000930 <sleep>:
+SYSCALL(sleep)
+     930:	b8 0d 00 00 00       	mov    $0xd,%eax
+     935:	89 e1                	mov    %esp,%ecx
+     937:	ba 3e 09 00 00       	mov    $0x93e,%edx
+     93c:	0f 34                	sysenter
+     93e:	c3                   	ret
+
+0000093f <uptime>:
+SYSCALL(uptime)
+     93f:	b8 0e 00 00 00       	mov    $0xe,%eax
+     944:	89 e1                	mov    %esp,%ecx
+     946:	ba 4d 09 00 00       	mov    $0x94d,%edx
+     94b:	0f 34                	sysenter
+     94d:	c3                   	ret
+
+0000094e <date>:
+SYSCALL(date)
+     94e:	b8 16 00 00 00       	mov    $0x16,%eax
+     953:	89 e1                	mov    %esp,%ecx
+     955:	ba 5c 09 00 00       	mov    $0x95c,%edx
+     95a:	0f 34                	sysenter
+     95c:	c3                   	ret
+
+0000095d <faultaround>:
+SYSCALL(faultaround)
+     95d:	b8 18 00 00 00       	mov    $0x18,%eax
+     962:	89 e1                	mov    %esp,%ecx
+     964:	ba 6b 09 00 00       	mov    $0x96b,%edx
+     969:	0f 34                	sysenter
+     96b:	c3                   	ret
+
+0000096c <faultstat>:
+SYSCALL(faultstat)
+     96c:	b8 19 00 00 00       	mov    $0x19,%eax
+     971:	89 e1                	mov    %esp,%ecx
+     973:	ba 7a 09 00 00       	mov    $0x97a,%edx
+     978:	0f 34                	sysenter
+     97a:	c3                   	ret
+
+0000097b <mmap>:
+SYSCALL(mmap)
+     97b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     980:	89 e1                	mov    %esp,%ecx
+     982:	ba 89 09 00 00       	mov    $0x989,%edx
+     987:	0f 34                	sysenter
+     989:	c3                   	ret
+
+0000098a <munmap>:
+SYSCALL(munmap)
+     98a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     98f:	89 e1                	mov    %esp,%ecx
+     991:	ba 98 09 00 00       	mov    $0x998,%edx
+     996:	0f 34                	sysenter
+     998:	c3                   	ret
+
+00000999 <largepages>:
+SYSCALL(largepages)
+     999:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     99e:	89 e1                	mov    %esp,%ecx
+     9a0:	ba a7 09 00 00       	mov    $0x9a7,%edx
+     9a5:	0f 34                	sysenter
+     9a7:	c3                   	ret
+
+000009a8 <spawn>:
+SYSCALL(spawn)
+     9a8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     9ad:	89 e1                	mov    %esp,%ecx
+     9af:	ba b6 09 00 00       	mov    $0x9b6,%edx
+     9b4:	0f 34                	sysenter
+     9b6:	c3                   	ret
+
+000009b7 <setpriority>:
+SYSCALL(setpriority)
+     9b7:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     9bc:	89 e1                	mov    %esp,%ecx
+     9be:	ba c5 09 00 00       	mov    $0x9c5,%edx
+     9c3:	0f 34                	sysenter
+     9c5:	c3                   	ret
+
+000009c6 <getpriority>:
+SYSCALL(getpriority)
+     9c6:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     9cb:	89 e1                	mov    %esp,%ecx
+     9cd:	ba d4 09 00 00       	mov    $0x9d4,%edx
+     9d2:	0f 34                	sysenter
+     9d4:	c3                   	ret
+
+000009d5 <getprocinfo>:
+SYSCALL(getprocinfo)
+     9d5:	b8 20 00 00 00       	mov    $0x20,%eax
+     9da:	89 e1                	mov    %esp,%ecx
+     9dc:	ba e3 09 00 00       	mov    $0x9e3,%edx
+     9e1:	0f 34                	sysenter
+     9e3:	c3                   	ret
+
+000009e4 <getcpuinfo>:
+SYSCALL(getcpuinfo)
+     9e4:	b8 21 00 00 00       	mov    $0x21,%eax
+     9e9:	89 e1                	mov    %esp,%ecx
+     9eb:	ba f2 09 00 00       	mov    $0x9f2,%edx
+     9f0:	0f 34                	sysenter
+     9f2:	c3                   	ret
+
+000009f3 <clone>:
+SYSCALL(clone)
+     9f3:	b8 22 00 00 00       	mov    $0x22,%eax
+     9f8:	89 e1                	mov    %esp,%ecx
+     9fa:	ba 01 0a 00 00       	mov    $0xa01,%edx
+     9ff:	0f 34                	sysenter
+     a01:	c3                   	ret
+
+00000a02 <join>:
+SYSCALL(join)
+     a02:	b8 23 00 00 00       	mov    $0x23,%eax
+     a07:	89 e1                	mov    %esp,%ecx
+     a09:	ba 10 0a 00 00       	mov    $0xa10,%edx
+     a0e:	0f 34                	sysenter
+     a10:	c3                   	ret
+
+00000a11 <futex_wait>:
+SYSCALL(futex_wait)
+     a11:	b8 24 00 00 00       	mov    $0x24,%eax
+     a16:	89 e1                	mov    %esp,%ecx
+     a18:	ba 1f 0a 00 00       	mov    $0xa1f,%edx
+     a1d:	0f 34                	sysenter
+     a1f:	c3                   	ret
+
+00000a20 <futex_wake>:
+SYSCALL(futex_wake)
+     a20:	b8 25 00 00 00       	mov    $0x25,%eax
+     a25:	89 e1                	mov    %esp,%ecx
+     a27:	ba 2e 0a 00 00       	mov    $0xa2e,%edx
+     a2c:	0f 34                	sysenter
+     a2e:	c3                   	ret
+
+00000a2f <setaffinity>:
+SYSCALL(setaffinity)
+     a2f:	b8 26 00 00 00       	mov    $0x26,%eax
+     a34:	89 e1                	mov    %esp,%ecx
+     a36:	ba 3d 0a 00 00       	mov    $0xa3d,%edx
+     a3b:	0f 34                	sysenter
+     a3d:	c3                   	ret
+
+00000a3e <getaffinity>:
+SYSCALL(getaffinity)
+     a3e:	b8 27 00 00 00       	mov    $0x27,%eax
+     a43:	89 e1                	mov    %esp,%ecx
+     a45:	ba 4c 0a 00 00       	mov    $0xa4c,%edx
+     a4a:	0f 34                	sysenter
+     a4c:	c3                   	ret
+
+00000a4d <clock_gettime>:
+SYSCALL(clock_gettime)
+     a4d:	b8 28 00 00 00       	mov    $0x28,%eax
+     a52:	89 e1                	mov    %esp,%ecx
+     a54:	ba 5b 0a 00 00       	mov    $0xa5b,%edx
+     a59:	0f 34                	sysenter
+     a5b:	c3                   	ret
+
+00000a5c <msleep>:
+SYSCALL(msleep)
+     a5c:	b8 29 00 00 00       	mov    $0x29,%eax
+     a61:	89 e1                	mov    %esp,%ecx
+     a63:	ba 6a 0a 00 00       	mov    $0xa6a,%edx
+     a68:	0f 34                	sysenter
+     a6a:	c3                   	ret
+
+00000a6b <lockstat>:
+SYSCALL(lockstat)
+     a6b:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     a70:	89 e1                	mov    %esp,%ecx
+     a72:	ba 79 0a 00 00       	mov    $0xa79,%edx
+     a77:	0f 34                	sysenter
+     a79:	c3                   	ret
+
+00000a7a <bstat>:
+SYSCALL(bstat)
+     a7a:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     a7f:	89 e1                	mov    %esp,%ecx
+     a81:	ba 88 0a 00 00       	mov    $0xa88,%edx
+     a86:	0f 34                	sysenter
+     a88:	c3                   	ret
+
+00000a89 <iostat>:
+SYSCALL(iostat)
+     a89:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     a8e:	89 e1                	mov    %esp,%ecx
+     a90:	ba 97 0a 00 00       	mov    $0xa97,%edx
+     a95:	0f 34                	sysenter
+     a97:	c3                   	ret
+
+00000a98 <fsync>:
+SYSCALL(fsync)
+     a98:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     a9d:	89 e1                	mov    %esp,%ecx
+     a9f:	ba a6 0a 00 00       	mov    $0xaa6,%edx
+     aa4:	0f 34                	sysenter
+     aa6:	c3                   	ret
+
+00000aa7 <pread>:
+SYSCALL(pread)
+     aa7:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     aac:	89 e1                	mov    %esp,%ecx
+     aae:	ba b5 0a 00 00       	mov    $0xab5,%edx
+     ab3:	0f 34                	sysenter
+     ab5:	c3                   	ret
+
+00000ab6 <pwrite>:
+SYSCALL(pwrite)
+     ab6:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     abb:	89 e1                	mov    %esp,%ecx
+     abd:	ba c4 0a 00 00       	mov    $0xac4,%edx
+     ac2:	0f 34                	sysenter
+     ac4:	c3                   	ret
+
+00000ac5 <readv>:
+SYSCALL(readv)
+     ac5:	b8 30 00 00 00       	mov    $0x30,%eax
+     aca:	89 e1                	mov    %esp,%ecx
+     acc:	ba d3 0a 00 00       	mov    $0xad3,%edx
+     ad1:	0f 34                	sysenter
+     ad3:	c3                   	ret
+
+00000ad4 <writev>:
+SYSCALL(writev)
+     ad4:	b8 31 00 00 00       	mov    $0x31,%eax
+     ad9:	89 e1                	mov    %esp,%ecx
+     adb:	ba e2 0a 00 00       	mov    $0xae2,%edx
+     ae0:	0f 34                	sysenter
+     ae2:	c3                   	ret
+
+00000ae3 <sendfile>:
+SYSCALL(sendfile)
+     ae3:	b8 32 00 00 00       	mov    $0x32,%eax
+     ae8:	89 e1                	mov    %esp,%ecx
+     aea:	ba f1 0a 00 00       	mov    $0xaf1,%edx
+     aef:	0f 34                	sysenter
+     af1:	c3                   	ret
+
+00000af2 <fcntl>:
+SYSCALL(fcntl)
+     af2:	b8 33 00 00 00       	mov    $0x33,%eax
+     af7:	89 e1                	mov    %esp,%ecx
+     af9:	ba 00 0b 00 00       	mov    $0xb00,%edx
+     afe:	0f 34                	sysenter
+     b00:	c3                   	ret
+
+00000b01 <mount>:
+SYSCALL(mount)
+     b01:	b8 34 00 00 00       	mov    $0x34,%eax
+     b06:	89 e1                	mov    %esp,%ecx
+     b08:	ba 0f 0b 00 00       	mov    $0xb0f,%edx
+     b0d:	0f 34                	sysenter
+     b0f:	c3                   	ret
+
+00000b10 <getdents>:
+SYSCALL(getdents)
+     b10:	b8 35 00 00 00       	mov    $0x35,%eax
+     b15:	89 e1                	mov    %esp,%ecx
+     b17:	ba 1e 0b 00 00       	mov    $0xb1e,%edx
+     b1c:	0f 34                	sysenter
+     b1e:	c3                   	ret
+
+00000b1f <fstatat>:
+SYSCALL(fstatat)
+     b1f:	b8 36 00 00 00       	mov    $0x36,%eax
+     b24:	89 e1                	mov    %esp,%ecx
+     b26:	ba 2d 0b 00 00       	mov    $0xb2d,%edx
+     b2b:	0f 34                	sysenter
+     b2d:	c3                   	ret
+
+00000b2e <sysstat>:
+SYSCALL(sysstat)
+     b2e:	b8 37 00 00 00       	mov    $0x37,%eax
+     b33:	89 e1                	mov    %esp,%ecx
+     b35:	ba 3c 0b 00 00       	mov    $0xb3c,%edx
+     b3a:	0f 34                	sysenter
+     b3c:	c3                   	ret
+
+00000b3d <ringenter>:
+SYSCALL(ringenter)
+     b3d:	b8 38 00 00 00       	mov    $0x38,%eax
+     b42:	89 e1                	mov    %esp,%ecx
+     b44:	ba 4b 0b 00 00       	mov    $0xb4b,%edx
+     b49:	0f 34                	sysenter
+     b4b:	c3                   	ret
+
+00000b4c <trace>:
+SYSCALL(trace)
+     b4c:	b8 39 00 00 00       	mov    $0x39,%eax
+     b51:	89 e1                	mov    %esp,%ecx
+     b53:	ba 5a 0b 00 00       	mov    $0xb5a,%edx
+     b58:	0f 34                	sysenter
+     b5a:	c3                   	ret
+
+00000b5b <memstat>:
+SYSCALL(memstat)
+     b5b:	b8 3a 00 00 00       	mov    $0x3a,%eax
+     b60:	89 e1                	mov    %esp,%ecx
+     b62:	ba 69 0b 00 00       	mov    $0xb69,%edx
+     b67:	0f 34                	sysenter
+     b69:	c3                   	ret
+
+00000b6a <shmget>:
+SYSCALL(shmget)
+     b6a:	b8 3b 00 00 00       	mov    $0x3b,%eax
+     b6f:	89 e1                	mov    %esp,%ecx
+     b71:	ba 78 0b 00 00       	mov    $0xb78,%edx
+     b76:	0f 34                	sysenter
+     b78:	c3                   	ret
+
+00000b79 <shmat>:
+SYSCALL(shmat)
+     b79:	b8 3c 00 00 00       	mov    $0x3c,%eax
+     b7e:	89 e1                	mov    %esp,%ecx
+     b80:	ba 87 0b 00 00       	mov    $0xb87,%edx
+     b85:	0f 34                	sysenter
+     b87:	c3                   	ret
+
+00000b88 <shmdt>:
+SYSCALL(shmdt)
+     b88:	b8 3d 00 00 00       	mov    $0x3d,%eax
+     b8d:	89 e1                	mov    %esp,%ecx
+     b8f:	ba 96 0b 00 00       	mov    $0xb96,%edx
+     b94:	0f 34                	sysenter
+     b96:	c3                   	ret
+
+00000b97 <irqstat>:
+SYSCALL(irqstat)
+     b97:	b8 3e 00 00 00       	mov    $0x3e,%eax
+     b9c:	89 e1                	mov    %esp,%ecx
+     b9e:	ba a5 0b 00 00       	mov    $0xba5,%edx
+     ba3:	0f 34                	sysenter
+     ba5:	c3                   	ret
+
+00000ba6 <irqroute>:
+SYSCALL(irqroute)
+     ba6:	b8 3f 00 00 00       	mov    $0x3f,%eax
+     bab:	89 e1                	mov    %esp,%ecx
+     bad:	ba b4 0b 00 00       	mov    $0xbb4,%edx
+     bb2:	0f 34                	sysenter
+     bb4:	c3                   	ret
+
+00000bb5 <putc>:
+  char buf[64];
+};
+
+static void
+putc(struct out *o, char c)
+{
+     bb5:	55                   	push   %ebp
+     bb6:	89 e5                	mov    %esp,%ebp
+     bb8:	56                   	push   %esi
+     bb9:	53                   	push   %ebx
+     bba:	89 c3                	mov    %eax,%ebx
+     bbc:	89 d6                	mov    %edx,%esi
+  if(o->n == sizeof(o->buf)){
+     bbe:	8b 40 04             	mov    0x4(%eax),%eax
+     bc1:	83 f8 40             	cmp    $0x40,%eax
+     bc4:	74 16                	je     bdc <putc+0x27>
+    bufwrite(o->fd, o->buf, o->n);
+    o->n = 0;
+  }
+  o->buf[o->n++] = c;
+     bc6:	8b 43 04             	mov    0x4(%ebx),%eax
+     bc9:	8d 50 01             	lea    0x1(%eax),%edx
+     bcc:	89 53 04             	mov    %edx,0x4(%ebx)
+     bcf:	89 f1                	mov    %esi,%ecx
+     bd1:	88 4c 03 08          	mov    %cl,0x8(%ebx,%eax,1)
+}
+     bd5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     bd8:	5b                   	pop    %ebx
+     bd9:	5e                   	pop    %esi
+     bda:	5d                   	pop    %ebp
+     bdb:	c3                   	ret
+    bufwrite(o->fd, o->buf, o->n);
+     bdc:	8d 53 08             	lea    0x8(%ebx),%edx
+     bdf:	83 ec 04             	sub    $0x4,%esp
+     be2:	50                   	push   %eax
+     be3:	52                   	push   %edx
+     be4:	ff 33                	push   (%ebx)
+     be6:	e8 b2 f9 ff ff       	call   59d <bufwrite>
+    o->n = 0;
+     beb:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     bf2:	83 c4 10             	add    $0x10,%esp
+     bf5:	eb cf                	jmp    bc6 <putc+0x11>
+
+00000bf7 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     bf7:	55                   	push   %ebp
+     bf8:	89 e5                	mov    %esp,%ebp
+     bfa:	57                   	push   %edi
+     bfb:	56                   	push   %esi
+     bfc:	53                   	push   %ebx
+     bfd:	83 ec 2c             	sub    $0x2c,%esp
+     c00:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     c03:	89 d0                	mov    %edx,%eax
+     c05:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+     c07:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     c0b:	0f 95 c1             	setne  %cl
+     c0e:	c1 ea 1f             	shr    $0x1f,%edx
+     c11:	84 d1                	test   %dl,%cl
+     c13:	74 44                	je     c59 <printint+0x62>
+    neg = 1;
+    x = -xx;
+     c15:	f7 d8                	neg    %eax
+     c17:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+     c19:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     c20:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+     c25:	89 c8                	mov    %ecx,%eax
+     c27:	ba 00 00 00 00       	mov    $0x0,%edx
+     c2c:	f7 f6                	div    %esi
+     c2e:	89 df                	mov    %ebx,%edi
+     c30:	83 c3 01             	add    $0x1,%ebx
+     c33:	0f b6 92 74 13 00 00 	movzbl 0x1374(%edx),%edx
+     c3a:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+     c3e:	89 ca                	mov    %ecx,%edx
+     c40:	89 c1                	mov    %eax,%ecx
+     c42:	39 f2                	cmp    %esi,%edx
+     c44:	73 df                	jae    c25 <printint+0x2e>
+  if(neg)
+     c46:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     c4a:	74 31                	je     c7d <printint+0x86>
+    buf[i++] = '-';
+     c4c:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+     c51:	8d 5f 02             	lea    0x2(%edi),%ebx
+     c54:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     c57:	eb 17                	jmp    c70 <printint+0x79>
+    x = xx;
+     c59:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+     c5b:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     c62:	eb bc                	jmp    c20 <printint+0x29>
+
+  while(--i >= 0)
+    putc(o, buf[i]);
+     c64:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+     c69:	89 f0                	mov    %esi,%eax
+     c6b:	e8 45 ff ff ff       	call   bb5 <putc>
+  while(--i >= 0)
+     c70:	83 eb 01             	sub    $0x1,%ebx
+     c73:	79 ef                	jns    c64 <printint+0x6d>
+}
+     c75:	83 c4 2c             	add    $0x2c,%esp
+     c78:	5b                   	pop    %ebx
+     c79:	5e                   	pop    %esi
+     c7a:	5f                   	pop    %edi
+     c7b:	5d                   	pop    %ebp
+     c7c:	c3                   	ret
+     c7d:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     c80:	eb ee                	jmp    c70 <printint+0x79>
+
+00000c82 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     c82:	55                   	push   %ebp
+     c83:	89 e5                	mov    %esp,%ebp
+     c85:	57                   	push   %edi
+     c86:	56                   	push   %esi
+     c87:	53                   	push   %ebx
+     c88:	83 ec 6c             	sub    $0x6c,%esp
+  int c, i, state;
+  uint *ap;
+  struct out out, *o;
+
+  o = &out;
+  o->fd = fd;
+     c8b:	8b 45 08             	mov    0x8(%ebp),%eax
+     c8e:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  o->n = 0;
+     c91:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+     c98:	8d 45 10             	lea    0x10(%ebp),%eax
+     c9b:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  state = 0;
+     c9e:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+     ca3:	bb 00 00 00 00       	mov    $0x0,%ebx
+     ca8:	eb 14                	jmp    cbe <printf+0x3c>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(o, c);
+     caa:	89 fa                	mov    %edi,%edx
+     cac:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     caf:	e8 01 ff ff ff       	call   bb5 <putc>
+     cb4:	eb 05                	jmp    cbb <printf+0x39>
+      }
+    } else if(state == '%'){
+     cb6:	83 fe 25             	cmp    $0x25,%esi
+     cb9:	74 25                	je     ce0 <printf+0x5e>
+  for(i = 0; fmt[i]; i++){
+     cbb:	83 c3 01             	add    $0x1,%ebx
+     cbe:	8b 45 0c             	mov    0xc(%ebp),%eax
+     cc1:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+     cc5:	84 c0                	test   %al,%al
+     cc7:	0f 84 20 01 00 00    	je     ded <printf+0x16b>
+    c = fmt[i] & 0xff;
+     ccd:	0f be f8             	movsbl %al,%edi
+     cd0:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     cd3:	85 f6                	test   %esi,%esi
+     cd5:	75 df                	jne    cb6 <printf+0x34>
+      if(c == '%'){
+     cd7:	83 f8 25             	cmp    $0x25,%eax
+     cda:	75 ce                	jne    caa <printf+0x28>
+        state = '%';
+     cdc:	89 c6                	mov    %eax,%esi
+     cde:	eb db                	jmp    cbb <printf+0x39>
+      if(c == 'd'){
+     ce0:	83 f8 25             	cmp    $0x25,%eax
+     ce3:	0f 84 cf 00 00 00    	je     db8 <printf+0x136>
+     ce9:	0f 8c dd 00 00 00    	jl     dcc <printf+0x14a>
+     cef:	83 f8 78             	cmp    $0x78,%eax
+     cf2:	0f 8f d4 00 00 00    	jg     dcc <printf+0x14a>
+     cf8:	83 f8 63             	cmp    $0x63,%eax
+     cfb:	0f 8c cb 00 00 00    	jl     dcc <printf+0x14a>
+     d01:	83 e8 63             	sub    $0x63,%eax
+     d04:	83 f8 15             	cmp    $0x15,%eax
+     d07:	0f 87 bf 00 00 00    	ja     dcc <printf+0x14a>
+     d0d:	ff 24 85 1c 13 00 00 	jmp    *0x131c(,%eax,4)
+        printint(o, *ap, 10, 1);
+     d14:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     d17:	8b 17                	mov    (%edi),%edx
+     d19:	83 ec 0c             	sub    $0xc,%esp
+     d1c:	6a 01                	push   $0x1
+     d1e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     d23:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d26:	e8 cc fe ff ff       	call   bf7 <printint>
+        ap++;
+     d2b:	83 c7 04             	add    $0x4,%edi
+     d2e:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     d31:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(o, '%');
+        putc(o, c);
+      }
+      state = 0;
+     d34:	be 00 00 00 00       	mov    $0x0,%esi
+     d39:	eb 80                	jmp    cbb <printf+0x39>
+        printint(o, *ap, 16, 0);
+     d3b:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     d3e:	8b 17                	mov    (%edi),%edx
+     d40:	83 ec 0c             	sub    $0xc,%esp
+     d43:	6a 00                	push   $0x0
+     d45:	b9 10 00 00 00       	mov    $0x10,%ecx
+     d4a:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d4d:	e8 a5 fe ff ff       	call   bf7 <printint>
+        ap++;
+     d52:	83 c7 04             	add    $0x4,%edi
+     d55:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     d58:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d5b:	be 00 00 00 00       	mov    $0x0,%esi
+     d60:	e9 56 ff ff ff       	jmp    cbb <printf+0x39>
+        s = (char*)*ap;
+     d65:	8b 45 94             	mov    -0x6c(%ebp),%eax
+     d68:	8b 30                	mov    (%eax),%esi
+        ap++;
+     d6a:	83 c0 04             	add    $0x4,%eax
+     d6d:	89 45 94             	mov    %eax,-0x6c(%ebp)
+        if(s == 0)
+     d70:	85 f6                	test   %esi,%esi
+     d72:	75 15                	jne    d89 <printf+0x107>
+          s = "(null)";
+     d74:	be 14 13 00 00       	mov    $0x1314,%esi
+     d79:	eb 0e                	jmp    d89 <printf+0x107>
+          putc(o, *s);
+     d7b:	0f be d2             	movsbl %dl,%edx
+     d7e:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d81:	e8 2f fe ff ff       	call   bb5 <putc>
+          s++;
+     d86:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+     d89:	0f b6 16             	movzbl (%esi),%edx
+     d8c:	84 d2                	test   %dl,%dl
+     d8e:	75 eb                	jne    d7b <printf+0xf9>
+      state = 0;
+     d90:	be 00 00 00 00       	mov    $0x0,%esi
+     d95:	e9 21 ff ff ff       	jmp    cbb <printf+0x39>
+        putc(o, *ap);
+     d9a:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     d9d:	0f be 17             	movsbl (%edi),%edx
+     da0:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     da3:	e8 0d fe ff ff       	call   bb5 <putc>
+        ap++;
+     da8:	83 c7 04             	add    $0x4,%edi
+     dab:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+      state = 0;
+     dae:	be 00 00 00 00       	mov    $0x0,%esi
+     db3:	e9 03 ff ff ff       	jmp    cbb <printf+0x39>
+        putc(o, c);
+     db8:	89 fa                	mov    %edi,%edx
+     dba:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     dbd:	e8 f3 fd ff ff       	call   bb5 <putc>
+      state = 0;
+     dc2:	be 00 00 00 00       	mov    $0x0,%esi
+     dc7:	e9 ef fe ff ff       	jmp    cbb <printf+0x39>
+        putc(o, '%');
+     dcc:	ba 25 00 00 00       	mov    $0x25,%edx
+     dd1:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     dd4:	e8 dc fd ff ff       	call   bb5 <putc>
+        putc(o, c);
+     dd9:	89 fa                	mov    %edi,%edx
+     ddb:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     dde:	e8 d2 fd ff ff       	call   bb5 <putc>
+      state = 0;
+     de3:	be 00 00 00 00       	mov    $0x0,%esi
+     de8:	e9 ce fe ff ff       	jmp    cbb <printf+0x39>
+    }
+  }
+  if(o->n > 0)
+     ded:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     df0:	85 c0                	test   %eax,%eax
+     df2:	7f 08                	jg     dfc <printf+0x17a>
+    bufwrite(fd, o->buf, o->n);
+}
+     df4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     df7:	5b                   	pop    %ebx
+     df8:	5e                   	pop    %esi
+     df9:	5f                   	pop    %edi
+     dfa:	5d                   	pop    %ebp
+     dfb:	c3                   	ret
+    bufwrite(fd, o->buf, o->n);
+     dfc:	83 ec 04             	sub    $0x4,%esp
+     dff:	50                   	push   %eax
+     e00:	8d 45 a8             	lea    -0x58(%ebp),%eax
+     e03:	50                   	push   %eax
+     e04:	ff 75 08             	push   0x8(%ebp)
+     e07:	e8 91 f7 ff ff       	call   59d <bufwrite>
+     e0c:	83 c4 10             	add    $0x10,%esp
+}
+     e0f:	eb e3                	jmp    df4 <printf+0x172>
+
+00000e11 <largefree>:
+  return &b->h;
+}
+
+static void
+largefree(Fblock *b)
+{
+     e11:	55                   	push   %ebp
+     e12:	89 e5                	mov    %esp,%ebp
+     e14:	57                   	push   %edi
+     e15:	56                   	push   %esi
+     e16:	53                   	push   %ebx
+     e17:	83 ec 0c             	sub    $0xc,%esp
+     e1a:	89 c1                	mov    %eax,%ecx
+  Fblock **pp, *p, *prev;
+
+  prev = 0;
+     e1c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     e21:	ba cc 3a 00 00       	mov    $0x3acc,%edx
+     e26:	eb 05                	jmp    e2d <largefree+0x1c>
+     e28:	8d 50 08             	lea    0x8(%eax),%edx
+    prev = p;
+     e2b:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     e2d:	8b 02                	mov    (%edx),%eax
+     e2f:	85 c0                	test   %eax,%eax
+     e31:	74 04                	je     e37 <largefree+0x26>
+     e33:	39 c8                	cmp    %ecx,%eax
+     e35:	72 f1                	jb     e28 <largefree+0x17>
+  b->next = p;
+     e37:	89 41 08             	mov    %eax,0x8(%ecx)
+  if(p && (char*)b + b->h.size == (char*)p){
+     e3a:	85 c0                	test   %eax,%eax
+     e3c:	74 09                	je     e47 <largefree+0x36>
+     e3e:	8b 31                	mov    (%ecx),%esi
+     e40:	8d 3c 31             	lea    (%ecx,%esi,1),%edi
+     e43:	39 c7                	cmp    %eax,%edi
+     e45:	74 21                	je     e68 <largefree+0x57>
+    b->h.size += p->h.size;
+    b->next = p->next;
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+     e47:	85 db                	test   %ebx,%ebx
+     e49:	74 09                	je     e54 <largefree+0x43>
+     e4b:	8b 03                	mov    (%ebx),%eax
+     e4d:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+     e50:	39 ce                	cmp    %ecx,%esi
+     e52:	74 20                	je     e74 <largefree+0x63>
+    prev->h.size += b->h.size;
+    prev->next = b->next;
+  } else
+    *pp = b;
+     e54:	89 0a                	mov    %ecx,(%edx)
+
+  // Give the top of the heap back.  With threads sharing the
+  // address space sbrk() cannot shrink it; keep the block then.
+  for(pp = &large; (*pp)->next; pp = &(*pp)->next)
+     e56:	be cc 3a 00 00       	mov    $0x3acc,%esi
+     e5b:	8b 1e                	mov    (%esi),%ebx
+     e5d:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+     e61:	74 1d                	je     e80 <largefree+0x6f>
+     e63:	8d 73 08             	lea    0x8(%ebx),%esi
+     e66:	eb f3                	jmp    e5b <largefree+0x4a>
+    b->h.size += p->h.size;
+     e68:	03 30                	add    (%eax),%esi
+     e6a:	89 31                	mov    %esi,(%ecx)
+    b->next = p->next;
+     e6c:	8b 40 08             	mov    0x8(%eax),%eax
+     e6f:	89 41 08             	mov    %eax,0x8(%ecx)
+     e72:	eb d3                	jmp    e47 <largefree+0x36>
+    prev->h.size += b->h.size;
+     e74:	03 01                	add    (%ecx),%eax
+     e76:	89 03                	mov    %eax,(%ebx)
+    prev->next = b->next;
+     e78:	8b 41 08             	mov    0x8(%ecx),%eax
+     e7b:	89 43 08             	mov    %eax,0x8(%ebx)
+     e7e:	eb d6                	jmp    e56 <largefree+0x45>
+    ;
+  b = *pp;
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     e80:	89 df                	mov    %ebx,%edi
+     e82:	03 3b                	add    (%ebx),%edi
+     e84:	83 ec 0c             	sub    $0xc,%esp
+     e87:	6a 00                	push   $0x0
+     e89:	e8 93 fa ff ff       	call   921 <sbrk>
+     e8e:	83 c4 10             	add    $0x10,%esp
+     e91:	39 c7                	cmp    %eax,%edi
+     e93:	74 08                	je     e9d <largefree+0x8c>
+    *pp = 0;
+}
+     e95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e98:	5b                   	pop    %ebx
+     e99:	5e                   	pop    %esi
+     e9a:	5f                   	pop    %edi
+     e9b:	5d                   	pop    %ebp
+     e9c:	c3                   	ret
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     e9d:	8b 03                	mov    (%ebx),%eax
+     e9f:	f7 d8                	neg    %eax
+     ea1:	83 ec 0c             	sub    $0xc,%esp
+     ea4:	50                   	push   %eax
+     ea5:	e8 77 fa ff ff       	call   921 <sbrk>
+     eaa:	83 c4 10             	add    $0x10,%esp
+     ead:	83 f8 ff             	cmp    $0xffffffff,%eax
+     eb0:	74 e3                	je     e95 <largefree+0x84>
+    *pp = 0;
+     eb2:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+     eb8:	eb db                	jmp    e95 <largefree+0x84>
+
+00000eba <more>:
+{
+     eba:	55                   	push   %ebp
+     ebb:	89 e5                	mov    %esp,%ebp
+     ebd:	56                   	push   %esi
+     ebe:	53                   	push   %ebx
+     ebf:	89 c6                	mov    %eax,%esi
+  pad = -(uint)sbrk(0) & 7;
+     ec1:	83 ec 0c             	sub    $0xc,%esp
+     ec4:	6a 00                	push   $0x0
+     ec6:	e8 56 fa ff ff       	call   921 <sbrk>
+     ecb:	f7 d8                	neg    %eax
+     ecd:	89 c3                	mov    %eax,%ebx
+     ecf:	83 e3 07             	and    $0x7,%ebx
+  if((p = sbrk(n + pad)) == (char*)-1)
+     ed2:	01 de                	add    %ebx,%esi
+     ed4:	89 34 24             	mov    %esi,(%esp)
+     ed7:	e8 45 fa ff ff       	call   921 <sbrk>
+     edc:	83 c4 10             	add    $0x10,%esp
+     edf:	83 f8 ff             	cmp    $0xffffffff,%eax
+     ee2:	74 09                	je     eed <more+0x33>
+  return p + pad;
+     ee4:	01 d8                	add    %ebx,%eax
+}
+     ee6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ee9:	5b                   	pop    %ebx
+     eea:	5e                   	pop    %esi
+     eeb:	5d                   	pop    %ebp
+     eec:	c3                   	ret
+    return 0;
+     eed:	b8 00 00 00 00       	mov    $0x0,%eax
+     ef2:	eb f2                	jmp    ee6 <more+0x2c>
+
+00000ef4 <slaballoc>:
+{
+     ef4:	55                   	push   %ebp
+     ef5:	89 e5                	mov    %esp,%ebp
+     ef7:	56                   	push   %esi
+     ef8:	53                   	push   %ebx
+     ef9:	89 c6                	mov    %eax,%esi
+  n = 1 << (MINSHIFT + c);
+     efb:	8d 48 04             	lea    0x4(%eax),%ecx
+     efe:	bb 01 00 00 00       	mov    $0x1,%ebx
+     f03:	d3 e3                	shl    %cl,%ebx
+  if(slab + n > slabend){
+     f05:	89 d8                	mov    %ebx,%eax
+     f07:	03 05 c8 3a 00 00    	add    0x3ac8,%eax
+     f0d:	39 05 c4 3a 00 00    	cmp    %eax,0x3ac4
+     f13:	72 17                	jb     f2c <slaballoc+0x38>
+  h = (Header*)slab;
+     f15:	a1 c8 3a 00 00       	mov    0x3ac8,%eax
+  slab += n;
+     f1a:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+     f1d:	89 15 c8 3a 00 00    	mov    %edx,0x3ac8
+  h->size = n;
+     f23:	89 18                	mov    %ebx,(%eax)
+  h->class = c;
+     f25:	89 70 04             	mov    %esi,0x4(%eax)
+}
+     f28:	5b                   	pop    %ebx
+     f29:	5e                   	pop    %esi
+     f2a:	5d                   	pop    %ebp
+     f2b:	c3                   	ret
+    if((p = more(SLABSZ)) == 0)
+     f2c:	b8 00 40 00 00       	mov    $0x4000,%eax
+     f31:	e8 84 ff ff ff       	call   eba <more>
+     f36:	85 c0                	test   %eax,%eax
+     f38:	74 ee                	je     f28 <slaballoc+0x34>
+    if(p != slabend)
+     f3a:	39 05 c4 3a 00 00    	cmp    %eax,0x3ac4
+     f40:	74 05                	je     f47 <slaballoc+0x53>
+      slab = p;
+     f42:	a3 c8 3a 00 00       	mov    %eax,0x3ac8
+    slabend = p + SLABSZ;
+     f47:	05 00 40 00 00       	add    $0x4000,%eax
+     f4c:	a3 c4 3a 00 00       	mov    %eax,0x3ac4
+     f51:	eb c2                	jmp    f15 <slaballoc+0x21>
+
+00000f53 <largealloc>:
+{
+     f53:	55                   	push   %ebp
+     f54:	89 e5                	mov    %esp,%ebp
+     f56:	56                   	push   %esi
+     f57:	53                   	push   %ebx
+     f58:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     f5a:	b9 cc 3a 00 00       	mov    $0x3acc,%ecx
+     f5f:	8b 01                	mov    (%ecx),%eax
+     f61:	85 c0                	test   %eax,%eax
+     f63:	74 36                	je     f9b <largealloc+0x48>
+    if(b->h.size < n)
+     f65:	8b 10                	mov    (%eax),%edx
+     f67:	39 da                	cmp    %ebx,%edx
+     f69:	72 24                	jb     f8f <largealloc+0x3c>
+    if(b->h.size - n > SMALLMAX){
+     f6b:	29 da                	sub    %ebx,%edx
+     f6d:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+     f73:	76 1f                	jbe    f94 <largealloc+0x41>
+      rest = (Fblock*)((char*)b + n);
+     f75:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+      rest->h.size = b->h.size - n;
+     f78:	89 16                	mov    %edx,(%esi)
+      rest->h.class = LARGE;
+     f7a:	c7 46 04 09 00 00 00 	movl   $0x9,0x4(%esi)
+      rest->next = b->next;
+     f81:	8b 50 08             	mov    0x8(%eax),%edx
+     f84:	89 56 08             	mov    %edx,0x8(%esi)
+      *pp = rest;
+     f87:	89 31                	mov    %esi,(%ecx)
+      b->h.size = n;
+     f89:	89 18                	mov    %ebx,(%eax)
+}
+     f8b:	5b                   	pop    %ebx
+     f8c:	5e                   	pop    %esi
+     f8d:	5d                   	pop    %ebp
+     f8e:	c3                   	ret
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     f8f:	8d 48 08             	lea    0x8(%eax),%ecx
+     f92:	eb cb                	jmp    f5f <largealloc+0xc>
+      *pp = b->next;
+     f94:	8b 50 08             	mov    0x8(%eax),%edx
+     f97:	89 11                	mov    %edx,(%ecx)
+    return &b->h;
+     f99:	eb f0                	jmp    f8b <largealloc+0x38>
+  if((b = more(n)) == 0)
+     f9b:	89 d8                	mov    %ebx,%eax
+     f9d:	e8 18 ff ff ff       	call   eba <more>
+     fa2:	85 c0                	test   %eax,%eax
+     fa4:	74 e5                	je     f8b <largealloc+0x38>
+  b->h.size = n;
+     fa6:	89 18                	mov    %ebx,(%eax)
+  b->h.class = LARGE;
+     fa8:	c7 40 04 09 00 00 00 	movl   $0x9,0x4(%eax)
+  return &b->h;
+     faf:	eb da                	jmp    f8b <largealloc+0x38>
+
+00000fb1 <free>:
+
+void
+free(void *ap)
+{
+     fb1:	55                   	push   %ebp
+     fb2:	89 e5                	mov    %esp,%ebp
+     fb4:	56                   	push   %esi
+     fb5:	53                   	push   %ebx
+     fb6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+
+  if(ap == 0)
+     fb9:	85 db                	test   %ebx,%ebx
+     fbb:	74 3b                	je     ff8 <free+0x47>
+    return;
+  h = (Header*)ap - 1;
+     fbd:	8d 73 f8             	lea    -0x8(%ebx),%esi
+  lock_acquire(&lock);
+     fc0:	83 ec 0c             	sub    $0xc,%esp
+     fc3:	68 c0 3a 00 00       	push   $0x3ac0
+     fc8:	e8 9c 01 00 00       	call   1169 <lock_acquire>
+  if(h->class == LARGE)
+     fcd:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     fd0:	83 c4 10             	add    $0x10,%esp
+     fd3:	83 f8 09             	cmp    $0x9,%eax
+     fd6:	74 27                	je     fff <free+0x4e>
+    largefree((Fblock*)h);
+  else {
+    ((Fblock*)h)->next = freelist[h->class];
+     fd8:	8b 14 85 e0 3a 00 00 	mov    0x3ae0(,%eax,4),%edx
+     fdf:	89 13                	mov    %edx,(%ebx)
+    freelist[h->class] = (Fblock*)h;
+     fe1:	89 34 85 e0 3a 00 00 	mov    %esi,0x3ae0(,%eax,4)
+  }
+  lock_release(&lock);
+     fe8:	83 ec 0c             	sub    $0xc,%esp
+     feb:	68 c0 3a 00 00       	push   $0x3ac0
+     ff0:	e8 88 01 00 00       	call   117d <lock_release>
+     ff5:	83 c4 10             	add    $0x10,%esp
+}
+     ff8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ffb:	5b                   	pop    %ebx
+     ffc:	5e                   	pop    %esi
+     ffd:	5d                   	pop    %ebp
+     ffe:	c3                   	ret
+    largefree((Fblock*)h);
+     fff:	89 f0                	mov    %esi,%eax
+    1001:	e8 0b fe ff ff       	call   e11 <largefree>
+    1006:	eb e0                	jmp    fe8 <free+0x37>
+
+00001008 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1008:	55                   	push   %ebp
+    1009:	89 e5                	mov    %esp,%ebp
+    100b:	53                   	push   %ebx
+    100c:	83 ec 04             	sub    $0x4,%esp
+    100f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+  uint n;
+  int c;
+
+  if(nbytes > 0x7fffffff - sizeof(Header) - 7)
+    1012:	81 fb f0 ff ff 7f    	cmp    $0x7ffffff0,%ebx
+    1018:	0f 87 8b 00 00 00    	ja     10a9 <malloc+0xa1>
+    return 0;
+  n = (nbytes + sizeof(Header) + 7) & ~7;
+    101e:	83 c3 0f             	add    $0xf,%ebx
+    1021:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(n < sizeof(Fblock))
+    1024:	83 fb 0b             	cmp    $0xb,%ebx
+    1027:	77 05                	ja     102e <malloc+0x26>
+    n = sizeof(Fblock);
+    1029:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  lock_acquire(&lock);
+    102e:	83 ec 0c             	sub    $0xc,%esp
+    1031:	68 c0 3a 00 00       	push   $0x3ac0
+    1036:	e8 2e 01 00 00       	call   1169 <lock_acquire>
+  if(n <= SMALLMAX){
+    103b:	83 c4 10             	add    $0x10,%esp
+    103e:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+    1044:	77 58                	ja     109e <malloc+0x96>
+    for(c = 0; (1 << (MINSHIFT + c)) < n; c++)
+    1046:	ba 00 00 00 00       	mov    $0x0,%edx
+    104b:	eb 03                	jmp    1050 <malloc+0x48>
+    104d:	83 c2 01             	add    $0x1,%edx
+    1050:	8d 4a 04             	lea    0x4(%edx),%ecx
+    1053:	b8 01 00 00 00       	mov    $0x1,%eax
+    1058:	d3 e0                	shl    %cl,%eax
+    105a:	39 d8                	cmp    %ebx,%eax
+    105c:	72 ef                	jb     104d <malloc+0x45>
+      ;
+    if(freelist[c]){
+    105e:	8b 04 95 e0 3a 00 00 	mov    0x3ae0(,%edx,4),%eax
+    1065:	85 c0                	test   %eax,%eax
+    1067:	74 2a                	je     1093 <malloc+0x8b>
+      h = &freelist[c]->h;
+    1069:	89 c3                	mov    %eax,%ebx
+      freelist[c] = freelist[c]->next;
+    106b:	8b 40 08             	mov    0x8(%eax),%eax
+    106e:	89 04 95 e0 3a 00 00 	mov    %eax,0x3ae0(,%edx,4)
+    } else
+      h = slaballoc(c);
+  } else
+    h = largealloc(n);
+  lock_release(&lock);
+    1075:	83 ec 0c             	sub    $0xc,%esp
+    1078:	68 c0 3a 00 00       	push   $0x3ac0
+    107d:	e8 fb 00 00 00       	call   117d <lock_release>
+  return h ? (void*)(h + 1) : 0;
+    1082:	83 c4 10             	add    $0x10,%esp
+    1085:	85 db                	test   %ebx,%ebx
+    1087:	74 03                	je     108c <malloc+0x84>
+    1089:	83 c3 08             	add    $0x8,%ebx
+}
+    108c:	89 d8                	mov    %ebx,%eax
+    108e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1091:	c9                   	leave
+    1092:	c3                   	ret
+      h = slaballoc(c);
+    1093:	89 d0                	mov    %edx,%eax
+    1095:	e8 5a fe ff ff       	call   ef4 <slaballoc>
+    109a:	89 c3                	mov    %eax,%ebx
+    109c:	eb d7                	jmp    1075 <malloc+0x6d>
+    h = largealloc(n);
+    109e:	89 d8                	mov    %ebx,%eax
+    10a0:	e8 ae fe ff ff       	call   f53 <largealloc>
+    10a5:	89 c3                	mov    %eax,%ebx
+    10a7:	eb cc                	jmp    1075 <malloc+0x6d>
+    return 0;
+    10a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+    10ae:	eb dc                	jmp    108c <malloc+0x84>
+
+000010b0 <tstart>:
+  void *arg;
+};
+
+static void
+tstart(void *a)
+{
+    10b0:	55                   	push   %ebp
+    10b1:	89 e5                	mov    %esp,%ebp
+    10b3:	83 ec 14             	sub    $0x14,%esp
+    10b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+    10b9:	ff 70 04             	push   0x4(%eax)
+    10bc:	ff 10                	call   *(%eax)
+  exit();
+    10be:	e8 86 f6 ff ff       	call   749 <exit>
+
+000010c3 <thread_create>:
+}
+
+// Run fn(arg) in a new thread.  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    10c3:	55                   	push   %ebp
+    10c4:	89 e5                	mov    %esp,%ebp
+    10c6:	56                   	push   %esi
+    10c7:	53                   	push   %ebx
+  struct tstart *t;
+  char *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    10c8:	83 ec 0c             	sub    $0xc,%esp
+    10cb:	68 00 10 00 00       	push   $0x1000
+    10d0:	e8 33 ff ff ff       	call   1008 <malloc>
+    10d5:	83 c4 10             	add    $0x10,%esp
+    10d8:	85 c0                	test   %eax,%eax
+    10da:	74 42                	je     111e <thread_create+0x5b>
+    10dc:	89 c3                	mov    %eax,%ebx
+    return -1;
+  t = (struct tstart*)stack;
+  t->fn = fn;
+    10de:	8b 45 08             	mov    0x8(%ebp),%eax
+    10e1:	89 03                	mov    %eax,(%ebx)
+  t->arg = arg;
+    10e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+    10e6:	89 43 04             	mov    %eax,0x4(%ebx)
+  if((pid = clone(tstart, stack + TSTACK, t)) < 0)
+    10e9:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    10ef:	83 ec 04             	sub    $0x4,%esp
+    10f2:	53                   	push   %ebx
+    10f3:	50                   	push   %eax
+    10f4:	68 b0 10 00 00       	push   $0x10b0
+    10f9:	e8 f5 f8 ff ff       	call   9f3 <clone>
+    10fe:	89 c6                	mov    %eax,%esi
+    1100:	83 c4 10             	add    $0x10,%esp
+    1103:	85 c0                	test   %eax,%eax
+    1105:	78 09                	js     1110 <thread_create+0x4d>
+    free(stack);
+  return pid;
+}
+    1107:	89 f0                	mov    %esi,%eax
+    1109:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    110c:	5b                   	pop    %ebx
+    110d:	5e                   	pop    %esi
+    110e:	5d                   	pop    %ebp
+    110f:	c3                   	ret
+    free(stack);
+    1110:	83 ec 0c             	sub    $0xc,%esp
+    1113:	53                   	push   %ebx
+    1114:	e8 98 fe ff ff       	call   fb1 <free>
+    1119:	83 c4 10             	add    $0x10,%esp
+    111c:	eb e9                	jmp    1107 <thread_create+0x44>
+    return -1;
+    111e:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1123:	eb e2                	jmp    1107 <thread_create+0x44>
+
+00001125 <thread_join>:
+
+// Wait for one of this process's threads to exit and free its
+// stack.  Returns its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+    1125:	55                   	push   %ebp
+    1126:	89 e5                	mov    %esp,%ebp
+    1128:	53                   	push   %ebx
+    1129:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    112c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    112f:	50                   	push   %eax
+    1130:	e8 cd f8 ff ff       	call   a02 <join>
+    1135:	89 c3                	mov    %eax,%ebx
+    1137:	83 c4 10             	add    $0x10,%esp
+    113a:	85 c0                	test   %eax,%eax
+    113c:	79 07                	jns    1145 <thread_join+0x20>
+    free((char*)stack - TSTACK);
+  return pid;
+}
+    113e:	89 d8                	mov    %ebx,%eax
+    1140:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1143:	c9                   	leave
+    1144:	c3                   	ret
+    free((char*)stack - TSTACK);
+    1145:	83 ec 0c             	sub    $0xc,%esp
+    1148:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    114b:	2d 00 10 00 00       	sub    $0x1000,%eax
+    1150:	50                   	push   %eax
+    1151:	e8 5b fe ff ff       	call   fb1 <free>
+    1156:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    1159:	eb e3                	jmp    113e <thread_join+0x19>
+
+0000115b <lock_init>:
+
+void
+lock_init(lock_t *lk)
+{
+    115b:	55                   	push   %ebp
+    115c:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    115e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1161:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1167:	5d                   	pop    %ebp
+    1168:	c3                   	ret
+
+00001169 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+    1169:	55                   	push   %ebp
+    116a:	89 e5                	mov    %esp,%ebp
+    116c:	8b 55 08             	mov    0x8(%ebp),%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    116f:	b8 01 00 00 00       	mov    $0x1,%eax
+    1174:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    1177:	85 c0                	test   %eax,%eax
+    1179:	75 f4                	jne    116f <lock_acquire+0x6>
+    ;
+}
+    117b:	5d                   	pop    %ebp
+    117c:	c3                   	ret
+
+0000117d <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+    117d:	55                   	push   %ebp
+    117e:	89 e5                	mov    %esp,%ebp
+    1180:	8b 55 08             	mov    0x8(%ebp),%edx
+    1183:	b8 00 00 00 00       	mov    $0x0,%eax
+    1188:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    118b:	5d                   	pop    %ebp
+    118c:	c3                   	ret
+
+0000118d <mutex_init>:
+// Are Tricky": state is 0 when free, 1 when held, 2 when held and
+// others may be waiting.  Unlocking an uncontended mutex costs no
+// system call.
+void
+mutex_init(mutex_t *m)
+{
+    118d:	55                   	push   %ebp
+    118e:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    1190:	8b 45 08             	mov    0x8(%ebp),%eax
+    1193:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1199:	5d                   	pop    %ebp
+    119a:	c3                   	ret
+
+0000119b <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+    119b:	55                   	push   %ebp
+    119c:	89 e5                	mov    %esp,%ebp
+    119e:	53                   	push   %ebx
+    119f:	83 ec 04             	sub    $0x4,%esp
+    11a2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    11a5:	b8 00 00 00 00       	mov    $0x0,%eax
+    11aa:	b9 01 00 00 00       	mov    $0x1,%ecx
+    11af:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    11b3:	85 c0                	test   %eax,%eax
+    11b5:	74 29                	je     11e0 <mutex_lock+0x45>
+    return;
+  if(c != 2)
+    11b7:	83 f8 02             	cmp    $0x2,%eax
+    11ba:	74 20                	je     11dc <mutex_lock+0x41>
+    11bc:	b8 02 00 00 00       	mov    $0x2,%eax
+    11c1:	f0 87 03             	lock xchg %eax,(%ebx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    11c4:	eb 16                	jmp    11dc <mutex_lock+0x41>
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    11c6:	83 ec 08             	sub    $0x8,%esp
+    11c9:	6a 02                	push   $0x2
+    11cb:	53                   	push   %ebx
+    11cc:	e8 40 f8 ff ff       	call   a11 <futex_wait>
+  asm volatile("lock; xchgl %0, %1" :
+    11d1:	b8 02 00 00 00       	mov    $0x2,%eax
+    11d6:	f0 87 03             	lock xchg %eax,(%ebx)
+    11d9:	83 c4 10             	add    $0x10,%esp
+  while(c != 0){
+    11dc:	85 c0                	test   %eax,%eax
+    11de:	75 e6                	jne    11c6 <mutex_lock+0x2b>
+    c = xchg(&m->state, 2);
+  }
+}
+    11e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    11e3:	c9                   	leave
+    11e4:	c3                   	ret
+
+000011e5 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+    11e5:	55                   	push   %ebp
+    11e6:	89 e5                	mov    %esp,%ebp
+    11e8:	83 ec 08             	sub    $0x8,%esp
+    11eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    11ee:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    11f3:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    11f7:	83 fa 01             	cmp    $0x1,%edx
+    11fa:	75 02                	jne    11fe <mutex_unlock+0x19>
+    m->state = 0;
+    futex_wake(&m->state, 1);
+  }
+}
+    11fc:	c9                   	leave
+    11fd:	c3                   	ret
+    m->state = 0;
+    11fe:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+    1204:	83 ec 08             	sub    $0x8,%esp
+    1207:	6a 01                	push   $0x1
+    1209:	50                   	push   %eax
+    120a:	e8 11 f8 ff ff       	call   a20 <futex_wake>
+    120f:	83 c4 10             	add    $0x10,%esp
+}
+    1212:	eb e8                	jmp    11fc <mutex_unlock+0x17>
+
+00001214 <cond_init>:
+// Condition variable: waiters sleep on a sequence number that
+// every signal bumps, so a signal between the unlock and the
+// futex_wait() in cond_wait() is not lost.
+void
+cond_init(cond_t *c)
+{
+    1214:	55                   	push   %ebp
+    1215:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    1217:	8b 45 08             	mov    0x8(%ebp),%eax
+    121a:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1220:	5d                   	pop    %ebp
+    1221:	c3                   	ret
+
+00001222 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+    1222:	55                   	push   %ebp
+    1223:	89 e5                	mov    %esp,%ebp
+    1225:	57                   	push   %edi
+    1226:	56                   	push   %esi
+    1227:	53                   	push   %ebx
+    1228:	83 ec 18             	sub    $0x18,%esp
+    122b:	8b 75 08             	mov    0x8(%ebp),%esi
+    122e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    1231:	8b 3e                	mov    (%esi),%edi
+  mutex_unlock(m);
+    1233:	53                   	push   %ebx
+    1234:	e8 ac ff ff ff       	call   11e5 <mutex_unlock>
+  futex_wait(&c->seq, seq);
+    1239:	83 c4 08             	add    $0x8,%esp
+    123c:	57                   	push   %edi
+    123d:	56                   	push   %esi
+    123e:	e8 ce f7 ff ff       	call   a11 <futex_wait>
+  // Others may be waiting for m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+    1243:	83 c4 10             	add    $0x10,%esp
+    1246:	eb 0e                	jmp    1256 <cond_wait+0x34>
+    futex_wait(&m->state, 2);
+    1248:	83 ec 08             	sub    $0x8,%esp
+    124b:	6a 02                	push   $0x2
+    124d:	53                   	push   %ebx
+    124e:	e8 be f7 ff ff       	call   a11 <futex_wait>
+    1253:	83 c4 10             	add    $0x10,%esp
+    1256:	b8 02 00 00 00       	mov    $0x2,%eax
+    125b:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    125e:	85 c0                	test   %eax,%eax
+    1260:	75 e6                	jne    1248 <cond_wait+0x26>
+}
+    1262:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1265:	5b                   	pop    %ebx
+    1266:	5e                   	pop    %esi
+    1267:	5f                   	pop    %edi
+    1268:	5d                   	pop    %ebp
+    1269:	c3                   	ret
+
+0000126a <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+    126a:	55                   	push   %ebp
+    126b:	89 e5                	mov    %esp,%ebp
+    126d:	83 ec 10             	sub    $0x10,%esp
+    1270:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    1273:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+    1277:	6a 01                	push   $0x1
+    1279:	50                   	push   %eax
+    127a:	e8 a1 f7 ff ff       	call   a20 <futex_wake>
+}
+    127f:	83 c4 10             	add    $0x10,%esp
+    1282:	c9                   	leave
+    1283:	c3                   	ret
+
+00001284 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+    1284:	55                   	push   %ebp
+    1285:	89 e5                	mov    %esp,%ebp
+    1287:	83 ec 10             	sub    $0x10,%esp
+    128a:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    128d:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, NPROC);
+    1291:	6a 40                	push   $0x40
+    1293:	50                   	push   %eax
+    1294:	e8 87 f7 ff ff       	call   a20 <futex_wake>
+}
+    1299:	83 c4 10             	add    $0x10,%esp
+    129c:	c9                   	leave
+    129d:	c3                   	ret
@@ -19,6 +19,10 @@ main(void)
   dup(0);  // stdout
   dup(0);  // stderr
 
+  mkdir("/tmp");
+  if(mount("tmpfs", "/tmp") < 0)
+    printf(1, "init: cannot mount /tmp\n");
+
   for(;;){
     printf(1, "init: starting sh\n");
     pid = fork();
@@ -1,10 +1,23 @@
 // The I/O APIC manages hardware interrupts for an SMP system.
 // http://www.intel.com/design/chipsets/datashts/29056601.pdf
 // See also picirq.c.
+//
+// Each enabled IRQ goes to one CPU.  Every IRQBALANCE ticks
+// irqbalance() looks at how many interrupts of each IRQ came in
+// since the last time (trap() counts them per CPU) and hands the
+// busiest ones to the least loaded CPUs, so that a disk-bound
+// workload does not keep one CPU in interrupt handlers while the
+// others are idle.  irqroute() pins an IRQ to a CPU of the user's
+// choice, out of the balancer's reach, or gives it back.
 
 #include "types.h"
 #include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
 #include "traps.h"
+#include "spinlock.h"
+#include "proc.h"
 
 #define IOAPIC  0xFEC00000   // Default physical address of IO APIC
 
@@ -24,6 +37,14 @@
 
 volatile struct ioapic *ioapic;
 
+static struct {
+  struct spinlock lock;
+  int maxintr;
+  int cpu[NIRQ];               // CPU each IRQ goes to, -1 if disabled
+  int pinned[NIRQ];            // Set by irqroute(), not balanced
+  uint last[NIRQ];             // Interrupts counted at the last balance
+} irqs;
+
 // IO APIC MMIO structure: write reg, then read or write data.
 struct ioapic {
   uint reg;
@@ -50,8 +71,12 @@ ioapicinit(void)
 {
   int i, id, maxintr;
 
+  initlock(&irqs.lock, "irqs");
   ioapic = (volatile struct ioapic*)IOAPIC;
   maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
+  irqs.maxintr = maxintr < NIRQ ? maxintr : NIRQ-1;
+  for(i = 0; i < NIRQ; i++)
+    irqs.cpu[i] = -1;
   id = ioapicread(REG_ID) >> 24;
   if(id != ioapicid)
     cprintf("ioapicinit: id isn't equal to ioapicid; not a MP\n");
@@ -68,8 +93,92 @@ void
 ioapicenable(int irq, int cpunum)
 {
   // Mark interrupt edge-triggered, active high,
-  // enabled, and routed to the given cpunum,
-  // which happens to be that cpu's APIC ID.
+  // enabled, and routed to the given cpunum.
+  acquire(&irqs.lock);
   ioapicwrite(REG_TABLE+2*irq, T_IRQ0 + irq);
-  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+  ioapicwrite(REG_TABLE+2*irq+1, cpus[cpunum].apicid << 24);
+  if(irq < NIRQ)
+    irqs.cpu[irq] = cpunum;
+  release(&irqs.lock);
+}
+
+// Send irq to cpu from now on.  Caller holds irqs.lock.
+static void
+reroute(int irq, int cpu)
+{
+  if(irqs.cpu[irq] == cpu)
+    return;
+  ioapicwrite(REG_TABLE+2*irq+1, cpus[cpu].apicid << 24);
+  irqs.cpu[irq] = cpu;
+}
+
+// Spread the IRQs nobody pinned over the CPUs that are up:
+// busiest first, each to the CPU with the least interrupt load
+// so far, pinned IRQs counted, staying put on a tie.  Called by
+// CPU 0's timer interrupt.
+void
+irqbalance(void)
+{
+  uint n[NIRQ], load[NCPU], tot;
+  int i, j, c, best, done[NIRQ];
+
+  acquire(&irqs.lock);
+  memset(load, 0, sizeof(load));
+  for(i = 0; i <= irqs.maxintr; i++){
+    done[i] = irqs.cpu[i] < 0;
+    if(done[i])
+      continue;
+    for(tot = 0, c = 0; c < ncpu; c++)
+      tot += cpus[c].nirq[i];
+    n[i] = tot - irqs.last[i];
+    irqs.last[i] = tot;
+    if(irqs.pinned[i]){
+      load[irqs.cpu[i]] += n[i];
+      done[i] = 1;
+    }
+  }
+  for(;;){
+    for(j = -1, i = 0; i <= irqs.maxintr; i++)
+      if(!done[i] && (j < 0 || n[i] > n[j]))
+        j = i;
+    if(j < 0 || n[j] == 0)
+      break;
+    best = irqs.cpu[j];
+    for(c = 0; c < ncpu; c++)
+      if(cpus[c].started && load[c] < load[best])
+        best = c;
+    reroute(j, best);
+    load[best] += n[j];
+    done[j] = 1;
+  }
+  release(&irqs.lock);
+}
+
+// Pin the enabled irq to cpu, or with cpu -1 give it back to the
+// balancer.  Returns 0, or -1 if there is no such IRQ or CPU.
+int
+irqroute(int irq, int cpu)
+{
+  if(irq < 0 || irq >= NIRQ || cpu < -1 || cpu >= ncpu ||
+     (cpu >= 0 && !cpus[cpu].started))
+    return -1;
+  acquire(&irqs.lock);
+  if(irqs.cpu[irq] < 0){
+    release(&irqs.lock);
+    return -1;
+  }
+  irqs.pinned[irq] = cpu >= 0;
+  if(cpu >= 0)
+    reroute(irq, cpu);
+  release(&irqs.lock);
+  return 0;
+}
+
+// The CPU each IRQ goes to, -1 for disabled ones, into cpu[NIRQ].
+void
+irqroutes(int *cpu)
+{
+  acquire(&irqs.lock);
+  memmove(cpu, irqs.cpu, sizeof(irqs.cpu));
+  release(&irqs.lock);
 }
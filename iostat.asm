@@ -0,0 +1,2822 @@
+
+_iostat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "user.h"
+#include "iostat.h"
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 38             	sub    $0x38,%esp
+      14:	8b 19                	mov    (%ecx),%ebx
+      16:	8b 71 04             	mov    0x4(%ecx),%esi
+  struct iostat st;
+  char *sched;
+
+  sched = 0;
+  if(argc > 2 && strcmp(argv[1], "-s") == 0)
+      19:	83 fb 02             	cmp    $0x2,%ebx
+      1c:	0f 8f 90 00 00 00    	jg     b2 <main+0xb2>
+    sched = argv[2];
+  else if(argc > 1){
+      22:	83 fb 01             	cmp    $0x1,%ebx
+      25:	0f 8f aa 00 00 00    	jg     d5 <main+0xd5>
+  sched = 0;
+      2b:	b8 00 00 00 00       	mov    $0x0,%eax
+    printf(2, "usage: iostat [-s sched]\n");
+    exit();
+  }
+  if(iostat(sched, &st) < 0){
+      30:	83 ec 08             	sub    $0x8,%esp
+      33:	8d 55 c0             	lea    -0x40(%ebp),%edx
+      36:	52                   	push   %edx
+      37:	50                   	push   %eax
+      38:	e8 43 0a 00 00       	call   a80 <iostat>
+      3d:	83 c4 10             	add    $0x10,%esp
+      40:	85 c0                	test   %eax,%eax
+      42:	0f 88 a1 00 00 00    	js     e9 <main+0xe9>
+    printf(2, "iostat: failed\n");
+    exit();
+  }
+  printf(1, "SCHED\tQUEUED\tREQS\tBLOCKS\tDEPTH\tMAXDEPTH\tAVGDEPTH\tAVGLAT\tMAXLAT\n");
+      48:	83 ec 08             	sub    $0x8,%esp
+      4b:	68 e4 12 00 00       	push   $0x12e4
+      50:	6a 01                	push   $0x1
+      52:	e8 22 0c 00 00       	call   c79 <printf>
+  printf(1, "%s\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\n", st.sched, st.nqueued,
+      57:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+         st.nreq, st.nblk, st.depth, st.maxdepth,
+         st.nqueued ? st.sumdepth / st.nqueued : 0,
+         st.nblk ? st.sumlat / st.nblk : 0, st.maxlat);
+      5a:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  printf(1, "%s\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\n", st.sched, st.nqueued,
+      5d:	83 c4 10             	add    $0x10,%esp
+      60:	85 db                	test   %ebx,%ebx
+      62:	0f 84 95 00 00 00    	je     fd <main+0xfd>
+         st.nblk ? st.sumlat / st.nblk : 0, st.maxlat);
+      68:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  printf(1, "%s\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\n", st.sched, st.nqueued,
+      6b:	ba 00 00 00 00       	mov    $0x0,%edx
+      70:	f7 f3                	div    %ebx
+      72:	89 c6                	mov    %eax,%esi
+         st.nqueued ? st.sumdepth / st.nqueued : 0,
+      74:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+  printf(1, "%s\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\n", st.sched, st.nqueued,
+      77:	85 c9                	test   %ecx,%ecx
+      79:	0f 84 85 00 00 00    	je     104 <main+0x104>
+         st.nqueued ? st.sumdepth / st.nqueued : 0,
+      7f:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  printf(1, "%s\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\n", st.sched, st.nqueued,
+      82:	ba 00 00 00 00       	mov    $0x0,%edx
+      87:	f7 f1                	div    %ecx
+      89:	83 ec 04             	sub    $0x4,%esp
+      8c:	57                   	push   %edi
+      8d:	56                   	push   %esi
+      8e:	50                   	push   %eax
+      8f:	ff 75 d8             	push   -0x28(%ebp)
+      92:	ff 75 d4             	push   -0x2c(%ebp)
+      95:	53                   	push   %ebx
+      96:	ff 75 cc             	push   -0x34(%ebp)
+      99:	51                   	push   %ecx
+      9a:	8d 45 c0             	lea    -0x40(%ebp),%eax
+      9d:	50                   	push   %eax
+      9e:	68 c5 12 00 00       	push   $0x12c5
+      a3:	6a 01                	push   $0x1
+      a5:	e8 cf 0b 00 00       	call   c79 <printf>
+  exit();
+      aa:	83 c4 30             	add    $0x30,%esp
+      ad:	e8 8e 06 00 00       	call   740 <exit>
+  if(argc > 2 && strcmp(argv[1], "-s") == 0)
+      b2:	83 ec 08             	sub    $0x8,%esp
+      b5:	68 98 12 00 00       	push   $0x1298
+      ba:	ff 76 04             	push   0x4(%esi)
+      bd:	e8 6c 00 00 00       	call   12e <strcmp>
+      c2:	83 c4 10             	add    $0x10,%esp
+      c5:	85 c0                	test   %eax,%eax
+      c7:	0f 85 55 ff ff ff    	jne    22 <main+0x22>
+    sched = argv[2];
+      cd:	8b 46 08             	mov    0x8(%esi),%eax
+      d0:	e9 5b ff ff ff       	jmp    30 <main+0x30>
+    printf(2, "usage: iostat [-s sched]\n");
+      d5:	83 ec 08             	sub    $0x8,%esp
+      d8:	68 9b 12 00 00       	push   $0x129b
+      dd:	6a 02                	push   $0x2
+      df:	e8 95 0b 00 00       	call   c79 <printf>
+    exit();
+      e4:	e8 57 06 00 00       	call   740 <exit>
+    printf(2, "iostat: failed\n");
+      e9:	83 ec 08             	sub    $0x8,%esp
+      ec:	68 b5 12 00 00       	push   $0x12b5
+      f1:	6a 02                	push   $0x2
+      f3:	e8 81 0b 00 00       	call   c79 <printf>
+    exit();
+      f8:	e8 43 06 00 00       	call   740 <exit>
+  printf(1, "%s\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\n", st.sched, st.nqueued,
+      fd:	89 de                	mov    %ebx,%esi
+      ff:	e9 70 ff ff ff       	jmp    74 <main+0x74>
+     104:	89 c8                	mov    %ecx,%eax
+     106:	eb 81                	jmp    89 <main+0x89>
+
+00000108 <strcpy>:
+#include "memlayout.h"
+#include "clock.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     108:	55                   	push   %ebp
+     109:	89 e5                	mov    %esp,%ebp
+     10b:	56                   	push   %esi
+     10c:	53                   	push   %ebx
+     10d:	8b 75 08             	mov    0x8(%ebp),%esi
+     110:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     113:	89 f0                	mov    %esi,%eax
+     115:	89 d1                	mov    %edx,%ecx
+     117:	83 c2 01             	add    $0x1,%edx
+     11a:	89 c3                	mov    %eax,%ebx
+     11c:	83 c0 01             	add    $0x1,%eax
+     11f:	0f b6 09             	movzbl (%ecx),%ecx
+     122:	88 0b                	mov    %cl,(%ebx)
+     124:	84 c9                	test   %cl,%cl
+     126:	75 ed                	jne    115 <strcpy+0xd>
+    ;
+  return os;
+}
+     128:	89 f0                	mov    %esi,%eax
+     12a:	5b                   	pop    %ebx
+     12b:	5e                   	pop    %esi
+     12c:	5d                   	pop    %ebp
+     12d:	c3                   	ret
+
+0000012e <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     12e:	55                   	push   %ebp
+     12f:	89 e5                	mov    %esp,%ebp
+     131:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     134:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+     137:	eb 06                	jmp    13f <strcmp+0x11>
+    p++, q++;
+     139:	83 c1 01             	add    $0x1,%ecx
+     13c:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+     13f:	0f b6 01             	movzbl (%ecx),%eax
+     142:	84 c0                	test   %al,%al
+     144:	74 04                	je     14a <strcmp+0x1c>
+     146:	3a 02                	cmp    (%edx),%al
+     148:	74 ef                	je     139 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+     14a:	0f b6 c0             	movzbl %al,%eax
+     14d:	0f b6 12             	movzbl (%edx),%edx
+     150:	29 d0                	sub    %edx,%eax
+}
+     152:	5d                   	pop    %ebp
+     153:	c3                   	ret
+
+00000154 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     154:	55                   	push   %ebp
+     155:	89 e5                	mov    %esp,%ebp
+     157:	53                   	push   %ebx
+     158:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  const char *p;
+  uint w;
+
+  for(p = s; (uint)p & 3; p++)
+     15b:	89 c8                	mov    %ecx,%eax
+     15d:	eb 03                	jmp    162 <strlen+0xe>
+     15f:	83 c0 01             	add    $0x1,%eax
+     162:	a8 03                	test   $0x3,%al
+     164:	74 09                	je     16f <strlen+0x1b>
+    if(*p == 0)
+     166:	80 38 00             	cmpb   $0x0,(%eax)
+     169:	75 f4                	jne    15f <strlen+0xb>
+      return p - s;
+     16b:	29 c8                	sub    %ecx,%eax
+     16d:	eb 25                	jmp    194 <strlen+0x40>
+  // Then a word at a time, which never crosses into the next page:
+  // a word with a zero byte in it has one of these bits set.
+  for(;; p += 4){
+    w = *(uint*)p;
+     16f:	8b 10                	mov    (%eax),%edx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     171:	8d 9a ff fe fe fe    	lea    -0x1010101(%edx),%ebx
+     177:	f7 d2                	not    %edx
+     179:	21 da                	and    %ebx,%edx
+     17b:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+     181:	75 05                	jne    188 <strlen+0x34>
+  for(;; p += 4){
+     183:	83 c0 04             	add    $0x4,%eax
+    w = *(uint*)p;
+     186:	eb e7                	jmp    16f <strlen+0x1b>
+      break;
+  }
+  while(*p)
+     188:	80 38 00             	cmpb   $0x0,(%eax)
+     18b:	74 05                	je     192 <strlen+0x3e>
+    p++;
+     18d:	83 c0 01             	add    $0x1,%eax
+     190:	eb f6                	jmp    188 <strlen+0x34>
+  return p - s;
+     192:	29 c8                	sub    %ecx,%eax
+}
+     194:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     197:	c9                   	leave
+     198:	c3                   	ret
+
+00000199 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     199:	55                   	push   %ebp
+     19a:	89 e5                	mov    %esp,%ebp
+     19c:	57                   	push   %edi
+     19d:	56                   	push   %esi
+     19e:	53                   	push   %ebx
+     19f:	8b 55 10             	mov    0x10(%ebp),%edx
+  uint h;
+  char *d;
+
+  d = dst;
+  c &= 0xFF;
+     1a2:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  if(n >= 16){
+     1a6:	83 fa 0f             	cmp    $0xf,%edx
+     1a9:	76 52                	jbe    1fd <memset+0x64>
+    h = -(uint)d & 3;
+     1ab:	8b 45 08             	mov    0x8(%ebp),%eax
+     1ae:	f7 d8                	neg    %eax
+     1b0:	83 e0 03             	and    $0x3,%eax
+     1b3:	89 c6                	mov    %eax,%esi
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     1b5:	8b 7d 08             	mov    0x8(%ebp),%edi
+     1b8:	89 c1                	mov    %eax,%ecx
+     1ba:	89 d8                	mov    %ebx,%eax
+     1bc:	fc                   	cld
+     1bd:	f3 aa                	rep stos %al,%es:(%edi)
+    stosb(d, c, h);
+    stosl(d + h, (c<<24)|(c<<16)|(c<<8)|c, (n - h)/4);
+     1bf:	29 f2                	sub    %esi,%edx
+     1c1:	89 d1                	mov    %edx,%ecx
+     1c3:	c1 e9 02             	shr    $0x2,%ecx
+     1c6:	c1 e0 18             	shl    $0x18,%eax
+     1c9:	89 df                	mov    %ebx,%edi
+     1cb:	c1 e7 10             	shl    $0x10,%edi
+     1ce:	09 f8                	or     %edi,%eax
+     1d0:	89 df                	mov    %ebx,%edi
+     1d2:	c1 e7 08             	shl    $0x8,%edi
+     1d5:	09 f8                	or     %edi,%eax
+     1d7:	09 d8                	or     %ebx,%eax
+     1d9:	89 f7                	mov    %esi,%edi
+     1db:	03 7d 08             	add    0x8(%ebp),%edi
+}
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosl" :
+     1de:	fc                   	cld
+     1df:	f3 ab                	rep stos %eax,%es:(%edi)
+    d += h + (n - h)/4*4;
+     1e1:	89 d7                	mov    %edx,%edi
+     1e3:	83 e7 fc             	and    $0xfffffffc,%edi
+     1e6:	09 f7                	or     %esi,%edi
+     1e8:	03 7d 08             	add    0x8(%ebp),%edi
+    n = (n - h)%4;
+     1eb:	83 e2 03             	and    $0x3,%edx
+  asm volatile("cld; rep stosb" :
+     1ee:	89 d1                	mov    %edx,%ecx
+     1f0:	89 d8                	mov    %ebx,%eax
+     1f2:	fc                   	cld
+     1f3:	f3 aa                	rep stos %al,%es:(%edi)
+  }
+  stosb(d, c, n);
+  return dst;
+}
+     1f5:	8b 45 08             	mov    0x8(%ebp),%eax
+     1f8:	5b                   	pop    %ebx
+     1f9:	5e                   	pop    %esi
+     1fa:	5f                   	pop    %edi
+     1fb:	5d                   	pop    %ebp
+     1fc:	c3                   	ret
+  d = dst;
+     1fd:	8b 7d 08             	mov    0x8(%ebp),%edi
+     200:	eb ec                	jmp    1ee <memset+0x55>
+
+00000202 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     202:	55                   	push   %ebp
+     203:	89 e5                	mov    %esp,%ebp
+     205:	8b 45 08             	mov    0x8(%ebp),%eax
+     208:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     20c:	eb 03                	jmp    211 <strchr+0xf>
+     20e:	83 c0 01             	add    $0x1,%eax
+     211:	0f b6 10             	movzbl (%eax),%edx
+     214:	84 d2                	test   %dl,%dl
+     216:	74 06                	je     21e <strchr+0x1c>
+    if(*s == c)
+     218:	38 ca                	cmp    %cl,%dl
+     21a:	75 f2                	jne    20e <strchr+0xc>
+     21c:	eb 05                	jmp    223 <strchr+0x21>
+      return (char*)s;
+  return 0;
+     21e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     223:	5d                   	pop    %ebp
+     224:	c3                   	ret
+
+00000225 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     225:	55                   	push   %ebp
+     226:	89 e5                	mov    %esp,%ebp
+     228:	56                   	push   %esi
+     229:	53                   	push   %ebx
+     22a:	8b 55 08             	mov    0x8(%ebp),%edx
+     22d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     230:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  // A word at a time while they agree.
+  if((((uint)s1 | (uint)s2) & 3) == 0)
+     233:	89 d3                	mov    %edx,%ebx
+     235:	09 cb                	or     %ecx,%ebx
+     237:	f6 c3 03             	test   $0x3,%bl
+     23a:	74 24                	je     260 <memcmp+0x3b>
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+      s1 += 4, s2 += 4;
+  while(n-- > 0){
+     23c:	8d 70 ff             	lea    -0x1(%eax),%esi
+     23f:	85 c0                	test   %eax,%eax
+     241:	74 32                	je     275 <memcmp+0x50>
+    if(*s1 != *s2)
+     243:	0f b6 02             	movzbl (%edx),%eax
+     246:	0f b6 19             	movzbl (%ecx),%ebx
+     249:	38 d8                	cmp    %bl,%al
+     24b:	75 20                	jne    26d <memcmp+0x48>
+      return *s1 - *s2;
+    s1++, s2++;
+     24d:	83 c2 01             	add    $0x1,%edx
+     250:	83 c1 01             	add    $0x1,%ecx
+  while(n-- > 0){
+     253:	89 f0                	mov    %esi,%eax
+     255:	eb e5                	jmp    23c <memcmp+0x17>
+      s1 += 4, s2 += 4;
+     257:	83 c2 04             	add    $0x4,%edx
+     25a:	83 c1 04             	add    $0x4,%ecx
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+     25d:	83 e8 04             	sub    $0x4,%eax
+     260:	83 f8 03             	cmp    $0x3,%eax
+     263:	76 d7                	jbe    23c <memcmp+0x17>
+     265:	8b 31                	mov    (%ecx),%esi
+     267:	39 32                	cmp    %esi,(%edx)
+     269:	74 ec                	je     257 <memcmp+0x32>
+     26b:	eb cf                	jmp    23c <memcmp+0x17>
+      return *s1 - *s2;
+     26d:	0f b6 c0             	movzbl %al,%eax
+     270:	0f b6 db             	movzbl %bl,%ebx
+     273:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     275:	5b                   	pop    %ebx
+     276:	5e                   	pop    %esi
+     277:	5d                   	pop    %ebp
+     278:	c3                   	ret
+
+00000279 <memchr>:
+// The first c in the n bytes at v, or 0.  Once aligned, a word at
+// a time, with the word's bytes that equal c turned into zeroes
+// and those looked for.
+void*
+memchr(const void *v, int c, uint n)
+{
+     279:	55                   	push   %ebp
+     27a:	89 e5                	mov    %esp,%ebp
+     27c:	57                   	push   %edi
+     27d:	56                   	push   %esi
+     27e:	53                   	push   %ebx
+     27f:	8b 45 08             	mov    0x8(%ebp),%eax
+     282:	8b 55 10             	mov    0x10(%ebp),%edx
+  const uchar *s;
+  uint w, rep;
+
+  s = v;
+  c = (uchar)c;
+     285:	0f b6 75 0c          	movzbl 0xc(%ebp),%esi
+  for(; n > 0 && ((uint)s & 3); n--, s++)
+     289:	eb 06                	jmp    291 <memchr+0x18>
+     28b:	83 ea 01             	sub    $0x1,%edx
+     28e:	83 c0 01             	add    $0x1,%eax
+     291:	85 d2                	test   %edx,%edx
+     293:	74 0d                	je     2a2 <memchr+0x29>
+     295:	a8 03                	test   $0x3,%al
+     297:	74 09                	je     2a2 <memchr+0x29>
+    if(*s == c)
+     299:	0f b6 08             	movzbl (%eax),%ecx
+     29c:	39 f1                	cmp    %esi,%ecx
+     29e:	75 eb                	jne    28b <memchr+0x12>
+     2a0:	eb 41                	jmp    2e3 <memchr+0x6a>
+      return (void*)s;
+  rep = c * 0x01010101;
+     2a2:	69 fe 01 01 01 01    	imul   $0x1010101,%esi,%edi
+  for(; n >= 4; n -= 4, s += 4){
+     2a8:	eb 06                	jmp    2b0 <memchr+0x37>
+     2aa:	83 ea 04             	sub    $0x4,%edx
+     2ad:	83 c0 04             	add    $0x4,%eax
+     2b0:	83 fa 03             	cmp    $0x3,%edx
+     2b3:	76 16                	jbe    2cb <memchr+0x52>
+    w = *(uint*)s ^ rep;
+     2b5:	89 f9                	mov    %edi,%ecx
+     2b7:	33 08                	xor    (%eax),%ecx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     2b9:	8d 99 ff fe fe fe    	lea    -0x1010101(%ecx),%ebx
+     2bf:	f7 d1                	not    %ecx
+     2c1:	21 cb                	and    %ecx,%ebx
+     2c3:	f7 c3 80 80 80 80    	test   $0x80808080,%ebx
+     2c9:	74 df                	je     2aa <memchr+0x31>
+      break;
+  }
+  for(; n > 0; n--, s++)
+     2cb:	85 d2                	test   %edx,%edx
+     2cd:	74 0f                	je     2de <memchr+0x65>
+    if(*s == c)
+     2cf:	0f b6 08             	movzbl (%eax),%ecx
+     2d2:	39 f1                	cmp    %esi,%ecx
+     2d4:	74 0d                	je     2e3 <memchr+0x6a>
+  for(; n > 0; n--, s++)
+     2d6:	83 ea 01             	sub    $0x1,%edx
+     2d9:	83 c0 01             	add    $0x1,%eax
+     2dc:	eb ed                	jmp    2cb <memchr+0x52>
+      return (void*)s;
+  return 0;
+     2de:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     2e3:	5b                   	pop    %ebx
+     2e4:	5e                   	pop    %esi
+     2e5:	5f                   	pop    %edi
+     2e6:	5d                   	pop    %ebp
+     2e7:	c3                   	ret
+
+000002e8 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     2e8:	55                   	push   %ebp
+     2e9:	89 e5                	mov    %esp,%ebp
+     2eb:	57                   	push   %edi
+     2ec:	56                   	push   %esi
+     2ed:	53                   	push   %ebx
+     2ee:	83 ec 1c             	sub    $0x1c,%esp
+     2f1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     2f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+     2f9:	89 de                	mov    %ebx,%esi
+     2fb:	83 c3 01             	add    $0x1,%ebx
+     2fe:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     301:	7d 2e                	jge    331 <gets+0x49>
+    cc = read(0, &c, 1);
+     303:	83 ec 04             	sub    $0x4,%esp
+     306:	6a 01                	push   $0x1
+     308:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     30b:	50                   	push   %eax
+     30c:	6a 00                	push   $0x0
+     30e:	e8 51 05 00 00       	call   864 <read>
+    if(cc < 1)
+     313:	83 c4 10             	add    $0x10,%esp
+     316:	85 c0                	test   %eax,%eax
+     318:	7e 17                	jle    331 <gets+0x49>
+      break;
+    buf[i++] = c;
+     31a:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     31e:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+     321:	3c 0a                	cmp    $0xa,%al
+     323:	0f 94 c2             	sete   %dl
+     326:	3c 0d                	cmp    $0xd,%al
+     328:	0f 94 c0             	sete   %al
+     32b:	08 c2                	or     %al,%dl
+     32d:	74 ca                	je     2f9 <gets+0x11>
+    buf[i++] = c;
+     32f:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+     331:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+     335:	89 f8                	mov    %edi,%eax
+     337:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     33a:	5b                   	pop    %ebx
+     33b:	5e                   	pop    %esi
+     33c:	5f                   	pop    %edi
+     33d:	5d                   	pop    %ebp
+     33e:	c3                   	ret
+
+0000033f <atoi>:
+  return r;
+}
+
+int
+atoi(const char *s)
+{
+     33f:	55                   	push   %ebp
+     340:	89 e5                	mov    %esp,%ebp
+     342:	53                   	push   %ebx
+     343:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+     346:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+     34b:	eb 10                	jmp    35d <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+     34d:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+     350:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+     353:	83 c1 01             	add    $0x1,%ecx
+     356:	0f be c0             	movsbl %al,%eax
+     359:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+     35d:	0f b6 01             	movzbl (%ecx),%eax
+     360:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     363:	80 fb 09             	cmp    $0x9,%bl
+     366:	76 e5                	jbe    34d <atoi+0xe>
+  return n;
+}
+     368:	89 d0                	mov    %edx,%eax
+     36a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     36d:	c9                   	leave
+     36e:	c3                   	ret
+
+0000036f <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     36f:	55                   	push   %ebp
+     370:	89 e5                	mov    %esp,%ebp
+     372:	57                   	push   %edi
+     373:	56                   	push   %esi
+     374:	53                   	push   %ebx
+     375:	83 ec 08             	sub    $0x8,%esp
+     378:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     37b:	8b 55 0c             	mov    0xc(%ebp),%edx
+     37e:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *src;
+  int h;
+
+  dst = vdst;
+  src = vsrc;
+  if(n <= 0)
+     381:	85 c0                	test   %eax,%eax
+     383:	0f 8e 82 00 00 00    	jle    40b <memmove+0x9c>
+    return vdst;
+  if(src < dst && src + n > dst){
+     389:	39 da                	cmp    %ebx,%edx
+     38b:	73 07                	jae    394 <memmove+0x25>
+     38d:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+     390:	39 cb                	cmp    %ecx,%ebx
+     392:	72 5e                	jb     3f2 <memmove+0x83>
+    movsbback(dst + n - 1, src + n - 1, n);
+    return vdst;
+  }
+  if(n >= 16 && (((uint)dst ^ (uint)src) & 3) == 0){
+     394:	83 f8 0f             	cmp    $0xf,%eax
+     397:	7e 69                	jle    402 <memmove+0x93>
+     399:	89 d9                	mov    %ebx,%ecx
+     39b:	31 d1                	xor    %edx,%ecx
+     39d:	f6 c1 03             	test   $0x3,%cl
+     3a0:	75 73                	jne    415 <memmove+0xa6>
+    h = -(uint)dst & 3;
+     3a2:	89 d9                	mov    %ebx,%ecx
+     3a4:	f7 d9                	neg    %ecx
+     3a6:	83 e1 03             	and    $0x3,%ecx
+}
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsb" :
+     3a9:	89 df                	mov    %ebx,%edi
+     3ab:	89 d6                	mov    %edx,%esi
+     3ad:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+     3b0:	fc                   	cld
+     3b1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    movsb(dst, src, h);
+    dst += h, src += h, n -= h;
+     3b3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+     3b6:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+     3b9:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+     3bc:	29 f0                	sub    %esi,%eax
+    movsl(dst, src, n/4);
+     3be:	8d 50 03             	lea    0x3(%eax),%edx
+     3c1:	0f 49 d0             	cmovns %eax,%edx
+     3c4:	c1 fa 02             	sar    $0x2,%edx
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+     3c7:	89 7d f0             	mov    %edi,-0x10(%ebp)
+     3ca:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     3cd:	89 ce                	mov    %ecx,%esi
+     3cf:	89 d1                	mov    %edx,%ecx
+     3d1:	fc                   	cld
+     3d2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    dst += n/4*4, src += n/4*4, n %= 4;
+     3d4:	c1 e2 02             	shl    $0x2,%edx
+     3d7:	8b 7d f0             	mov    -0x10(%ebp),%edi
+     3da:	01 d7                	add    %edx,%edi
+     3dc:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     3df:	01 ca                	add    %ecx,%edx
+     3e1:	89 c6                	mov    %eax,%esi
+     3e3:	c1 fe 1f             	sar    $0x1f,%esi
+     3e6:	c1 ee 1e             	shr    $0x1e,%esi
+     3e9:	01 f0                	add    %esi,%eax
+     3eb:	83 e0 03             	and    $0x3,%eax
+     3ee:	29 f0                	sub    %esi,%eax
+     3f0:	eb 12                	jmp    404 <memmove+0x95>
+    movsbback(dst + n - 1, src + n - 1, n);
+     3f2:	8d 78 ff             	lea    -0x1(%eax),%edi
+     3f5:	8d 34 3a             	lea    (%edx,%edi,1),%esi
+     3f8:	01 df                	add    %ebx,%edi
+// Copy cnt bytes down from the last ones, at dst and src, to the
+// first: for overlapping moves up.
+static inline void
+movsbback(void *dst, const void *src, int cnt)
+{
+  asm volatile("std; rep movsb; cld" :
+     3fa:	89 c1                	mov    %eax,%ecx
+     3fc:	fd                   	std
+     3fd:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     3ff:	fc                   	cld
+    return vdst;
+     400:	eb 09                	jmp    40b <memmove+0x9c>
+  dst = vdst;
+     402:	89 df                	mov    %ebx,%edi
+  asm volatile("cld; rep movsb" :
+     404:	89 d6                	mov    %edx,%esi
+     406:	89 c1                	mov    %eax,%ecx
+     408:	fc                   	cld
+     409:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  }
+  movsb(dst, src, n);
+  return vdst;
+}
+     40b:	89 d8                	mov    %ebx,%eax
+     40d:	83 c4 08             	add    $0x8,%esp
+     410:	5b                   	pop    %ebx
+     411:	5e                   	pop    %esi
+     412:	5f                   	pop    %edi
+     413:	5d                   	pop    %ebp
+     414:	c3                   	ret
+  dst = vdst;
+     415:	89 df                	mov    %ebx,%edi
+     417:	eb eb                	jmp    404 <memmove+0x95>
+
+00000419 <vclock_gettime>:
+
+// clock_gettime() without a system call: read the clock page
+// that the kernel maps at CLOCKPAGE (see clock.h).
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+     419:	55                   	push   %ebp
+     41a:	89 e5                	mov    %esp,%ebp
+     41c:	57                   	push   %edi
+     41d:	56                   	push   %esi
+     41e:	53                   	push   %ebx
+     41f:	83 ec 14             	sub    $0x14,%esp
+  struct clockpage *cp = (struct clockpage*)CLOCKPAGE;
+  uint seq, rem, d;
+  uint64 tsc, ns, now;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+     422:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     426:	0f 87 a3 00 00 00    	ja     4cf <vclock_gettime+0xb6>
+    return -1;
+  do {
+    seq = cp->seq;
+     42c:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+    __sync_synchronize();
+     431:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    tsc = cp->tsc;
+     436:	8b 15 10 f0 ff 7f    	mov    0x7ffff010,%edx
+     43c:	8b 1d 14 f0 ff 7f    	mov    0x7ffff014,%ebx
+    ns = cp->ns;
+     442:	8b 35 18 f0 ff 7f    	mov    0x7ffff018,%esi
+     448:	8b 3d 1c f0 ff 7f    	mov    0x7ffff01c,%edi
+    __sync_synchronize();
+     44e:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != cp->seq);
+     453:	89 c1                	mov    %eax,%ecx
+     455:	83 e1 01             	and    $0x1,%ecx
+     458:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     45b:	75 cf                	jne    42c <vclock_gettime+0x13>
+     45d:	8b 0d 00 f0 ff 7f    	mov    0x7ffff000,%ecx
+     463:	39 c1                	cmp    %eax,%ecx
+     465:	75 c5                	jne    42c <vclock_gettime+0x13>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+     467:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     46a:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     46d:	0f 31                	rdtsc
+     46f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     472:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     475:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  now = rdtsc();
+  // Less than a tick has passed since the update, so the delta
+  // fits in 32 bits.
+  d = now > tsc ? now - tsc : 0;
+     478:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     47b:	19 d3                	sbb    %edx,%ebx
+     47d:	73 07                	jae    486 <vclock_gettime+0x6d>
+     47f:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+     482:	29 d8                	sub    %ebx,%eax
+     484:	89 c1                	mov    %eax,%ecx
+  ns += ((uint64)d * cp->mult) >> cp->shift;
+     486:	89 c8                	mov    %ecx,%eax
+     488:	f7 25 04 f0 ff 7f    	mull   0x7ffff004
+     48e:	0f b6 0d 08 f0 ff 7f 	movzbl 0x7ffff008,%ecx
+     495:	0f ad d0             	shrd   %cl,%edx,%eax
+     498:	d3 ea                	shr    %cl,%edx
+     49a:	f6 c1 20             	test   $0x20,%cl
+     49d:	74 04                	je     4a3 <vclock_gettime+0x8a>
+     49f:	89 d0                	mov    %edx,%eax
+     4a1:	31 d2                	xor    %edx,%edx
+     4a3:	01 f0                	add    %esi,%eax
+     4a5:	11 fa                	adc    %edi,%edx
+static inline uint
+divl(uint64 n, uint d, uint *r)
+{
+  uint q;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (*r) :
+     4a7:	bb 00 ca 9a 3b       	mov    $0x3b9aca00,%ebx
+     4ac:	f7 f3                	div    %ebx
+  ts->tv_sec = divl(ns, 1000000000, &rem);
+     4ae:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     4b1:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = rem;
+     4b3:	89 57 04             	mov    %edx,0x4(%edi)
+  if(clk == CLOCK_REALTIME)
+     4b6:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     4ba:	75 1a                	jne    4d6 <vclock_gettime+0xbd>
+    ts->tv_sec += cp->boottime;
+     4bc:	03 05 0c f0 ff 7f    	add    0x7ffff00c,%eax
+     4c2:	89 07                	mov    %eax,(%edi)
+  return 0;
+     4c4:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     4c7:	83 c4 14             	add    $0x14,%esp
+     4ca:	5b                   	pop    %ebx
+     4cb:	5e                   	pop    %esi
+     4cc:	5f                   	pop    %edi
+     4cd:	5d                   	pop    %ebp
+     4ce:	c3                   	ret
+    return -1;
+     4cf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     4d4:	eb f1                	jmp    4c7 <vclock_gettime+0xae>
+  return 0;
+     4d6:	b8 00 00 00 00       	mov    $0x0,%eax
+     4db:	eb ea                	jmp    4c7 <vclock_gettime+0xae>
+
+000004dd <flush>:
+
+// Write out fd's buffer, or with fd < 0 every buffer.
+// Returns -1 if a write fails.
+int
+flush(int fd)
+{
+     4dd:	55                   	push   %ebp
+     4de:	89 e5                	mov    %esp,%ebp
+     4e0:	56                   	push   %esi
+     4e1:	53                   	push   %ebx
+     4e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  int r, n;
+
+  if(fd < 0){
+     4e5:	85 c0                	test   %eax,%eax
+     4e7:	78 5d                	js     546 <flush+0x69>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+      if(flush(fd) < 0)
+        r = -1;
+    return r;
+  }
+  if(fd >= NOBUF || (n = obuf[fd].n) == 0)
+     4e9:	83 f8 0f             	cmp    $0xf,%eax
+     4ec:	7f 64                	jg     552 <flush+0x75>
+     4ee:	69 d0 08 02 00 00    	imul   $0x208,%eax,%edx
+     4f4:	8b b2 64 1a 00 00    	mov    0x1a64(%edx),%esi
+     4fa:	85 f6                	test   %esi,%esi
+     4fc:	74 59                	je     557 <flush+0x7a>
+    return 0;
+  obuf[fd].n = 0;
+     4fe:	c7 82 64 1a 00 00 00 	movl   $0x0,0x1a64(%edx)
+     505:	00 00 00 
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     508:	81 c2 68 1a 00 00    	add    $0x1a68,%edx
+     50e:	83 ec 04             	sub    $0x4,%esp
+     511:	56                   	push   %esi
+     512:	52                   	push   %edx
+     513:	50                   	push   %eax
+     514:	e8 5a 03 00 00       	call   873 <write>
+     519:	83 c4 10             	add    $0x10,%esp
+     51c:	39 f0                	cmp    %esi,%eax
+     51e:	75 40                	jne    560 <flush+0x83>
+     520:	be 00 00 00 00       	mov    $0x0,%esi
+     525:	eb 30                	jmp    557 <flush+0x7a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     527:	83 c3 01             	add    $0x1,%ebx
+     52a:	83 fb 0f             	cmp    $0xf,%ebx
+     52d:	7f 28                	jg     557 <flush+0x7a>
+      if(flush(fd) < 0)
+     52f:	83 ec 0c             	sub    $0xc,%esp
+     532:	53                   	push   %ebx
+     533:	e8 a5 ff ff ff       	call   4dd <flush>
+     538:	83 c4 10             	add    $0x10,%esp
+     53b:	85 c0                	test   %eax,%eax
+     53d:	79 e8                	jns    527 <flush+0x4a>
+        r = -1;
+     53f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     544:	eb e1                	jmp    527 <flush+0x4a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     546:	be 00 00 00 00       	mov    $0x0,%esi
+     54b:	bb 00 00 00 00       	mov    $0x0,%ebx
+     550:	eb d8                	jmp    52a <flush+0x4d>
+    return 0;
+     552:	be 00 00 00 00       	mov    $0x0,%esi
+}
+     557:	89 f0                	mov    %esi,%eax
+     559:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     55c:	5b                   	pop    %ebx
+     55d:	5e                   	pop    %esi
+     55e:	5d                   	pop    %ebp
+     55f:	c3                   	ret
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     560:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     565:	eb f0                	jmp    557 <flush+0x7a>
+
+00000567 <bufreset>:
+
+static void
+bufreset(int fd)
+{
+  if(fd >= 0 && fd < NOBUF){
+     567:	83 f8 0f             	cmp    $0xf,%eax
+     56a:	76 01                	jbe    56d <bufreset+0x6>
+     56c:	c3                   	ret
+{
+     56d:	55                   	push   %ebp
+     56e:	89 e5                	mov    %esp,%ebp
+     570:	53                   	push   %ebx
+     571:	83 ec 10             	sub    $0x10,%esp
+     574:	89 c3                	mov    %eax,%ebx
+    flush(fd);
+     576:	50                   	push   %eax
+     577:	e8 61 ff ff ff       	call   4dd <flush>
+    obuf[fd].mode = BUNKNOWN;
+     57c:	69 db 08 02 00 00    	imul   $0x208,%ebx,%ebx
+     582:	c7 83 60 1a 00 00 00 	movl   $0x0,0x1a60(%ebx)
+     589:	00 00 00 
+     58c:	83 c4 10             	add    $0x10,%esp
+  }
+}
+     58f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     592:	c9                   	leave
+     593:	c3                   	ret
+
+00000594 <bufwrite>:
+
+// Write n bytes from p to fd, through its buffer.
+// Returns n, or -1 if a write fails.
+int
+bufwrite(int fd, const void *p, int n)
+{
+     594:	55                   	push   %ebp
+     595:	89 e5                	mov    %esp,%ebp
+     597:	57                   	push   %edi
+     598:	56                   	push   %esi
+     599:	53                   	push   %ebx
+     59a:	83 ec 3c             	sub    $0x3c,%esp
+     59d:	8b 75 08             	mov    0x8(%ebp),%esi
+     5a0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct stat st;
+  const char *s;
+  int i;
+
+  if(fd < 0 || fd >= NOBUF)
+     5a3:	83 fe 0f             	cmp    $0xf,%esi
+     5a6:	0f 87 a2 00 00 00    	ja     64e <bufwrite+0xba>
+    return write(fd, p, n);
+  if(obuf[fd].mode == BUNKNOWN){
+     5ac:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     5b2:	83 b8 60 1a 00 00 00 	cmpl   $0x0,0x1a60(%eax)
+     5b9:	75 19                	jne    5d4 <bufwrite+0x40>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     5bb:	83 fe 02             	cmp    $0x2,%esi
+     5be:	0f 85 9c 00 00 00    	jne    660 <bufwrite+0xcc>
+      obuf[fd].mode = BNONE;
+     5c4:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     5ca:	c7 80 60 1a 00 00 01 	movl   $0x1,0x1a60(%eax)
+     5d1:	00 00 00 
+    else
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+  }
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     5d4:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     5da:	89 da                	mov    %ebx,%edx
+     5dc:	03 90 64 1a 00 00    	add    0x1a64(%eax),%edx
+     5e2:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+     5e8:	0f 8f ae 00 00 00    	jg     69c <bufwrite+0x108>
+    return -1;
+  if(n >= OBUFSZ)
+     5ee:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+     5f4:	0f 8f bd 00 00 00    	jg     6b7 <bufwrite+0x123>
+    return write(fd, p, n);
+  memmove(obuf[fd].buf + obuf[fd].n, p, n);
+     5fa:	69 d6 08 02 00 00    	imul   $0x208,%esi,%edx
+     600:	8d ba 60 1a 00 00    	lea    0x1a60(%edx),%edi
+     606:	8b 82 64 1a 00 00    	mov    0x1a64(%edx),%eax
+     60c:	83 ec 04             	sub    $0x4,%esp
+     60f:	53                   	push   %ebx
+     610:	ff 75 0c             	push   0xc(%ebp)
+     613:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     616:	8d 84 10 68 1a 00 00 	lea    0x1a68(%eax,%edx,1),%eax
+     61d:	50                   	push   %eax
+     61e:	e8 4c fd ff ff       	call   36f <memmove>
+  obuf[fd].n += n;
+     623:	01 5f 04             	add    %ebx,0x4(%edi)
+  if(obuf[fd].mode == BNONE)
+     626:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     629:	8b 82 60 1a 00 00    	mov    0x1a60(%edx),%eax
+     62f:	83 c4 10             	add    $0x10,%esp
+     632:	83 f8 01             	cmp    $0x1,%eax
+     635:	0f 84 91 00 00 00    	je     6cc <bufwrite+0x138>
+    return flush(fd) < 0 ? -1 : n;
+  if(obuf[fd].mode == BLINE)
+     63b:	83 f8 02             	cmp    $0x2,%eax
+     63e:	0f 84 ca 00 00 00    	je     70e <bufwrite+0x17a>
+    for(s = p, i = 0; i < n; i++)
+      if(s[i] == '\n')
+        return flush(fd) < 0 ? -1 : n;
+  return n;
+     644:	89 d8                	mov    %ebx,%eax
+}
+     646:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     649:	5b                   	pop    %ebx
+     64a:	5e                   	pop    %esi
+     64b:	5f                   	pop    %edi
+     64c:	5d                   	pop    %ebp
+     64d:	c3                   	ret
+    return write(fd, p, n);
+     64e:	83 ec 04             	sub    $0x4,%esp
+     651:	53                   	push   %ebx
+     652:	ff 75 0c             	push   0xc(%ebp)
+     655:	56                   	push   %esi
+     656:	e8 18 02 00 00       	call   873 <write>
+     65b:	83 c4 10             	add    $0x10,%esp
+     65e:	eb e6                	jmp    646 <bufwrite+0xb2>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     660:	83 ec 08             	sub    $0x8,%esp
+     663:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     666:	50                   	push   %eax
+     667:	56                   	push   %esi
+     668:	e8 51 02 00 00       	call   8be <fstat>
+     66d:	83 c4 10             	add    $0x10,%esp
+     670:	85 c0                	test   %eax,%eax
+     672:	0f 88 4c ff ff ff    	js     5c4 <bufwrite+0x30>
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+     678:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     67d:	74 16                	je     695 <bufwrite+0x101>
+     67f:	ba 03 00 00 00       	mov    $0x3,%edx
+     684:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     68a:	89 90 60 1a 00 00    	mov    %edx,0x1a60(%eax)
+     690:	e9 3f ff ff ff       	jmp    5d4 <bufwrite+0x40>
+     695:	ba 02 00 00 00       	mov    $0x2,%edx
+     69a:	eb e8                	jmp    684 <bufwrite+0xf0>
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     69c:	83 ec 0c             	sub    $0xc,%esp
+     69f:	56                   	push   %esi
+     6a0:	e8 38 fe ff ff       	call   4dd <flush>
+     6a5:	83 c4 10             	add    $0x10,%esp
+     6a8:	85 c0                	test   %eax,%eax
+     6aa:	0f 89 3e ff ff ff    	jns    5ee <bufwrite+0x5a>
+    return -1;
+     6b0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     6b5:	eb 8f                	jmp    646 <bufwrite+0xb2>
+    return write(fd, p, n);
+     6b7:	83 ec 04             	sub    $0x4,%esp
+     6ba:	53                   	push   %ebx
+     6bb:	ff 75 0c             	push   0xc(%ebp)
+     6be:	56                   	push   %esi
+     6bf:	e8 af 01 00 00       	call   873 <write>
+     6c4:	83 c4 10             	add    $0x10,%esp
+     6c7:	e9 7a ff ff ff       	jmp    646 <bufwrite+0xb2>
+    return flush(fd) < 0 ? -1 : n;
+     6cc:	83 ec 0c             	sub    $0xc,%esp
+     6cf:	56                   	push   %esi
+     6d0:	e8 08 fe ff ff       	call   4dd <flush>
+     6d5:	83 c4 10             	add    $0x10,%esp
+     6d8:	85 c0                	test   %eax,%eax
+     6da:	78 07                	js     6e3 <bufwrite+0x14f>
+     6dc:	89 d8                	mov    %ebx,%eax
+     6de:	e9 63 ff ff ff       	jmp    646 <bufwrite+0xb2>
+     6e3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     6e8:	e9 59 ff ff ff       	jmp    646 <bufwrite+0xb2>
+        return flush(fd) < 0 ? -1 : n;
+     6ed:	83 ec 0c             	sub    $0xc,%esp
+     6f0:	56                   	push   %esi
+     6f1:	e8 e7 fd ff ff       	call   4dd <flush>
+     6f6:	83 c4 10             	add    $0x10,%esp
+     6f9:	85 c0                	test   %eax,%eax
+     6fb:	78 07                	js     704 <bufwrite+0x170>
+     6fd:	89 d8                	mov    %ebx,%eax
+     6ff:	e9 42 ff ff ff       	jmp    646 <bufwrite+0xb2>
+     704:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     709:	e9 38 ff ff ff       	jmp    646 <bufwrite+0xb2>
+    for(s = p, i = 0; i < n; i++)
+     70e:	b8 00 00 00 00       	mov    $0x0,%eax
+     713:	39 d8                	cmp    %ebx,%eax
+     715:	7d 0e                	jge    725 <bufwrite+0x191>
+      if(s[i] == '\n')
+     717:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     71a:	80 3c 01 0a          	cmpb   $0xa,(%ecx,%eax,1)
+     71e:	74 cd                	je     6ed <bufwrite+0x159>
+    for(s = p, i = 0; i < n; i++)
+     720:	83 c0 01             	add    $0x1,%eax
+     723:	eb ee                	jmp    713 <bufwrite+0x17f>
+  return n;
+     725:	89 d8                	mov    %ebx,%eax
+     727:	e9 1a ff ff ff       	jmp    646 <bufwrite+0xb2>
+
+0000072c <fork>:
+
+int
+fork(void)
+{
+     72c:	55                   	push   %ebp
+     72d:	89 e5                	mov    %esp,%ebp
+     72f:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     732:	6a ff                	push   $0xffffffff
+     734:	e8 a4 fd ff ff       	call   4dd <flush>
+  return _fork();
+     739:	e8 bd 00 00 00       	call   7fb <_fork>
+}
+     73e:	c9                   	leave
+     73f:	c3                   	ret
+
+00000740 <exit>:
+
+int
+exit(void)
+{
+     740:	55                   	push   %ebp
+     741:	89 e5                	mov    %esp,%ebp
+     743:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     746:	6a ff                	push   $0xffffffff
+     748:	e8 90 fd ff ff       	call   4dd <flush>
+  _exit();
+     74d:	e8 b8 00 00 00       	call   80a <_exit>
+
+00000752 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     752:	55                   	push   %ebp
+     753:	89 e5                	mov    %esp,%ebp
+     755:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     758:	6a ff                	push   $0xffffffff
+     75a:	e8 7e fd ff ff       	call   4dd <flush>
+  return _exec(path, argv);
+     75f:	83 c4 08             	add    $0x8,%esp
+     762:	ff 75 0c             	push   0xc(%ebp)
+     765:	ff 75 08             	push   0x8(%ebp)
+     768:	e8 bb 00 00 00       	call   828 <_exec>
+}
+     76d:	c9                   	leave
+     76e:	c3                   	ret
+
+0000076f <close>:
+
+int
+close(int fd)
+{
+     76f:	55                   	push   %ebp
+     770:	89 e5                	mov    %esp,%ebp
+     772:	53                   	push   %ebx
+     773:	83 ec 04             	sub    $0x4,%esp
+     776:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bufreset(fd);
+     779:	89 d8                	mov    %ebx,%eax
+     77b:	e8 e7 fd ff ff       	call   567 <bufreset>
+  return _close(fd);
+     780:	83 ec 0c             	sub    $0xc,%esp
+     783:	53                   	push   %ebx
+     784:	e8 90 00 00 00       	call   819 <_close>
+}
+     789:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     78c:	c9                   	leave
+     78d:	c3                   	ret
+
+0000078e <stat>:
+{
+     78e:	55                   	push   %ebp
+     78f:	89 e5                	mov    %esp,%ebp
+     791:	56                   	push   %esi
+     792:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     793:	83 ec 08             	sub    $0x8,%esp
+     796:	6a 00                	push   $0x0
+     798:	ff 75 08             	push   0x8(%ebp)
+     79b:	e8 f1 00 00 00       	call   891 <open>
+  if(fd < 0)
+     7a0:	83 c4 10             	add    $0x10,%esp
+     7a3:	85 c0                	test   %eax,%eax
+     7a5:	78 24                	js     7cb <stat+0x3d>
+     7a7:	89 c3                	mov    %eax,%ebx
+  r = fstat(fd, st);
+     7a9:	83 ec 08             	sub    $0x8,%esp
+     7ac:	ff 75 0c             	push   0xc(%ebp)
+     7af:	50                   	push   %eax
+     7b0:	e8 09 01 00 00       	call   8be <fstat>
+     7b5:	89 c6                	mov    %eax,%esi
+  close(fd);
+     7b7:	89 1c 24             	mov    %ebx,(%esp)
+     7ba:	e8 b0 ff ff ff       	call   76f <close>
+  return r;
+     7bf:	83 c4 10             	add    $0x10,%esp
+}
+     7c2:	89 f0                	mov    %esi,%eax
+     7c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     7c7:	5b                   	pop    %ebx
+     7c8:	5e                   	pop    %esi
+     7c9:	5d                   	pop    %ebp
+     7ca:	c3                   	ret
+    return -1;
+     7cb:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     7d0:	eb f0                	jmp    7c2 <stat+0x34>
+
+000007d2 <dup2>:
+
+int
+dup2(int oldfd, int newfd)
+{
+     7d2:	55                   	push   %ebp
+     7d3:	89 e5                	mov    %esp,%ebp
+     7d5:	56                   	push   %esi
+     7d6:	53                   	push   %ebx
+     7d7:	8b 75 08             	mov    0x8(%ebp),%esi
+     7da:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(oldfd != newfd)
+     7dd:	39 de                	cmp    %ebx,%esi
+     7df:	75 11                	jne    7f2 <dup2+0x20>
+    bufreset(newfd);
+  return _dup2(oldfd, newfd);
+     7e1:	83 ec 08             	sub    $0x8,%esp
+     7e4:	53                   	push   %ebx
+     7e5:	56                   	push   %esi
+     7e6:	e8 4c 00 00 00       	call   837 <_dup2>
+}
+     7eb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     7ee:	5b                   	pop    %ebx
+     7ef:	5e                   	pop    %esi
+     7f0:	5d                   	pop    %ebp
+     7f1:	c3                   	ret
+    bufreset(newfd);
+     7f2:	89 d8                	mov    %ebx,%eax
+     7f4:	e8 6e fd ff ff       	call   567 <bufreset>
+     7f9:	eb e6                	jmp    7e1 <dup2+0xf>
+
+000007fb <_fork>:
+  1: ret
+
+#define SYSCALL(name) STUB(name, SYS_ ## name)
+
+# ulib.c wraps these, to flush printf()'s buffers first.
+STUB(_fork, SYS_fork)
+     7fb:	b8 01 00 00 00       	mov    $0x1,%eax
+     800:	89 e1                	mov    %esp,%ecx
+     802:	ba 09 08 00 00       	mov    $0x809,%edx
+     807:	0f 34                	sysenter
+     809:	c3                   	ret
+
+0000080a <_exit>:
+STUB(_exit, SYS_exit)
+     80a:	b8 02 00 00 00       	mov    $0x2,%eax
+     80f:	89 e1                	mov    %esp,%ecx
+     811:	ba 18 08 00 00       	mov    $0x818,%edx
+     816:	0f 34                	sysenter
+     818:	c3                   	ret
+
+00000819 <_close>:
+STUB(_close, SYS_close)
+     819:	b8 15 00 00 00       	mov    $0x15,%eax
+     81e:	89 e1                	mov    %esp,%ecx
+     820:	ba 27 08 00 00       	mov    $0x827,%edx
+     825:	0f 34                	sysenter
+     827:	c3                   	ret
+
+00000828 <_exec>:
+STUB(_exec, SYS_exec)
+     828:	b8 07 00 00 00       	mov    $0x7,%eax
+     82d:	89 e1                	mov    %esp,%ecx
+     82f:	ba 36 08 00 00       	mov    $0x836,%edx
+     834:	0f 34                	sysenter
+     836:	c3                   	ret
+
+00000837 <_dup2>:
+STUB(_dup2, SYS_dup2)
+     837:	b8 17 00 00 00       	mov    $0x17,%eax
+     83c:	89 e1                	mov    %esp,%ecx
+     83e:	ba 45 08 00 00       	mov    $0x845,%edx
+     843:	0f 34                	sysenter
+     845:	c3                   	ret
+
+00000846 <wait>:
+
+SYSCALL(wait)
+     846:	b8 03 00 00 00       	mov    $0x3,%eax
+     84b:	89 e1                	mov    %esp,%ecx
+     84d:	ba 54 08 00 00       	mov    $0x854,%edx
+     852:	0f 34                	sysenter
+     854:	c3                   	ret
+
+00000855 <pipe>:
+SYSCALL(pipe)
+     855:	b8 04 00 00 00       	mov    $0x4,%eax
+     85a:	89 e1                	mov    %esp,%ecx
+     85c:	ba 63 08 00 00       	mov    $0x863,%edx
+     861:	0f 34                	sysenter
+     863:	c3                   	ret
+
+00000864 <read>:
+SYSCALL(read)
+     864:	b8 05 00 00 00       	mov    $0x5,%eax
+     869:	89 e1                	mov    %esp,%ecx
+     86b:	ba 72 08 00 00       	mov    $0x872,%edx
+     870:	0f 34                	sysenter
+     872:	c3                   	ret
+
+00000873 <write>:
+SYSCALL(write)
+     873:	b8 10 00 00 00       	mov    $0x10,%eax
+     878:	89 e1                	mov    %esp,%ecx
+     87a:	ba 81 08 00 00       	mov    $0x881,%edx
+     87f:	0f 34                	sysenter
+     881:	c3                   	ret
+
+00000882 <kill>:
+SYSCALL(kill)
+     882:	b8 06 00 00 00       	mov    $0x6,%eax
+     887:	89 e1                	mov    %esp,%ecx
+     889:	ba 90 08 00 00       	mov    $0x890,%edx
+     88e:	0f 34                	sysenter
+     890:	c3                   	ret
+
+00000891 <open>:
+SYSCALL(open)
+     891:	b8 0f 00 00 00       	mov    $0xf,%eax
+     896:	89 e1                	mov    %esp,%ecx
+     898:	ba 9f 08 00 00       	mov    $0x89f,%edx
+     89d:	0f 34                	sysenter
+     89f:	c3                   	ret
+
+000008a0 <mknod>:
+SYSCALL(mknod)
+     8a0:	b8 11 00 00 00       	mov    $0x11,%eax
+     8a5:	89 e1                	mov    %esp,%ecx
+     8a7:	ba ae 08 00 00       	mov    $0x8ae,%edx
+     8ac:	0f 34                	sysenter
+     8ae:	c3                   	ret
+
+000008af <unlink>:
+SYSCALL(unlink)
+     8af:	b8 12 00 00 00       	mov    $0x12,%eax
+     8b4:	89 e1                	mov    %esp,%ecx
+     8b6:	ba bd 08 00 00       	mov    $0x8bd,%edx
+     8bb:	0f 34                	sysenter
+     8bd:	c3                   	ret
+
+000008be <fstat>:
+SYSCALL(fstat)
+     8be:	b8 08 00 00 00       	mov    $0x8,%eax
+     8c3:	89 e1                	mov    %esp,%ecx
+     8c5:	ba cc 08 00 00       	mov    $0x8cc,%edx
+     8ca:	0f 34                	sysenter
+     8cc:	c3                   	ret
+
+000008cd <link>:
+SYSCALL(link)
+     8cd:	b8 13 00 00 00       	mov    $0x13,%eax
+     8d2:	89 e1                	mov    %esp,%ecx
+     8d4:	ba db 08 00 00       	mov    $0x8db,%edx
+     8d9:	0f 34                	sysenter
+     8db:	c3                   	ret
+
+000008dc <mkdir>:
+SYSCALL(mkdir)
+     8dc:	b8 14 00 00 00       	mov    $0x14,%eax
+     8e1:	89 e1                	mov    %esp,%ecx
+     8e3:	ba ea 08 00 00       	mov    $0x8ea,%edx
+     8e8:	0f 34                	sysenter
+     8ea:	c3                   	ret
+
+000008eb <chdir>:
+SYSCALL(chdir)
+     8eb:	b8 09 00 00 00       	mov    $0x9,%eax
+     8f0:	89 e1                	mov    %esp,%ecx
+     8f2:	ba f9 08 00 00       	mov    $0x8f9,%edx
+     8f7:	0f 34                	sysenter
+     8f9:	c3                   	ret
+
+000008fa <dup>:
+SYSCALL(dup)
+     8fa:	b8 0a 00 00 00       	mov    $0xa,%eax
+     8ff:	89 e1                	mov    %esp,%ecx
+     901:	ba 08 09 00 00       	mov    $0x908,%edx
+     906:	0f 34                	sysenter
+     908:	c3                   	ret
+
+00000909 <getpid>:
+SYSCALL(getpid)
+     909:	b8 0b 00 00 00       	mov    $0xb,%eax
+     90e:	89 e1                	mov    %esp,%ecx
+     910:	ba 17 09 00 00       	mov    $0x917,%edx
+     915:	0f 34                	sysenter
+     917:	c3                   	ret
+
+00000918 <sbrk>:
+SYSCALL(sbrk)
+     918:	b8 0c 00 00 00       	mov    $0xc,%eax
+     91d:	89 e1                	mov    %esp,%ecx
+     91f:	ba 26 09 00 00       	mov    $0x926,%edx
+     924:	0f 34                	sysenter
+     926:	c3                   	ret
+
+00000927 <sleep>:
+SYSCALL(sleep)
+     927:	b8 0d 00 00 00       	mov    $0xd,%eax
+     92c:	89 e1                	mov    %esp,%ecx
+     92e:	ba 35 09 00 00       	mov    $0x935,%edx
+     933:	0f 34                	sysenter
+     935:	c3                   	ret
+
+00000936 <uptime>:
+SYSCALL(uptime)
+     936:	b8 0e 00 00 00       	mov    $0xe,%eax
+     93b:	89 e1                	mov    %esp,%ecx
+     93d:	ba 44 09 00 00       	mov    $0x944,%edx
+     942:	0f 34                	sysenter
+     944:	c3                   	ret
+
+00000945 <date>:
+SYSCALL(date)
+     945:	b8 16 00 00 00       	mov    $0x16,%eax
+     94a:	89 e1                	mov    %esp,%ecx
+     94c:	ba 53 09 00 00       	mov    $0x953,%edx
+     951:	0f 34                	sysenter
+     953:	c3                   	ret
+
+00000954 <faultaround>:
+SYSCALL(faultaround)
+     954:	b8 18 00 00 00       	mov    $0x18,%eax
+     959:	89 e1                	mov    %esp,%ecx
+     95b:	ba 62 09 00 00       	mov    $0x962,%edx
+     960:	0f 34                	sysenter
+     962:	c3                   	ret
+
+00000963 <faultstat>:
+SYSCALL(faultstat)
+     963:	b8 19 00 00 00       	mov    $0x19,%eax
+     968:	89 e1                	mov    %esp,%ecx
+     96a:	ba 71 09 00 00       	mov    $0x971,%edx
+     96f:	0f 34                	sysenter
+     971:	c3                   	ret
+
+00000972 <mmap>:
+SYSCALL(mmap)
+     972:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     977:	89 e1                	mov    %esp,%ecx
+     979:	ba 80 09 00 00       	mov    $0x980,%edx
+     97e:	0f 34                	sysenter
+     980:	c3                   	ret
+
+00000981 <munmap>:
+SYSCALL(munmap)
+     981:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     986:	89 e1                	mov    %esp,%ecx
+     988:	ba 8f 09 00 00       	mov    $0x98f,%edx
+     98d:	0f 34                	sysenter
+     98f:	c3                   	ret
+
+00000990 <largepages>:
+SYSCALL(largepages)
+     990:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     995:	89 e1                	mov    %esp,%ecx
+     997:	ba 9e 09 00 00       	mov    $0x99e,%edx
+     99c:	0f 34                	sysenter
+     99e:	c3                   	ret
+
+0000099f <spawn>:
+SYSCALL(spawn)
+     99f:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     9a4:	89 e1                	mov    %esp,%ecx
+     9a6:	ba ad 09 00 00       	mov    $0x9ad,%edx
+     9ab:	0f 34                	sysenter
+     9ad:	c3                   	ret
+
+000009ae <setpriority>:
+SYSCALL(setpriority)
+     9ae:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     9b3:	89 e1                	mov    %esp,%ecx
+     9b5:	ba bc 09 00 00       	mov    $0x9bc,%edx
+     9ba:	0f 34                	sysenter
+     9bc:	c3                   	ret
+
+000009bd <getpriority>:
+SYSCALL(getpriority)
+     9bd:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     9c2:	89 e1                	mov    %esp,%ecx
+     9c4:	ba cb 09 00 00       	mov    $0x9cb,%edx
+     9c9:	0f 34                	sysenter
+     9cb:	c3                   	ret
+
+000009cc <getprocinfo>:
+SYSCALL(getprocinfo)
+     9cc:	b8 20 00 00 00       	mov    $0x20,%eax
+     9d1:	89 e1                	mov    %esp,%ecx
+     9d3:	ba da 09 00 00       	mov    $0x9da,%edx
+     9d8:	0f 34                	sysenter
+     9da:	c3                   	ret
+
+000009db <getcpuinfo>:
+SYSCALL(getcpuinfo)
+     9db:	b8 21 00 00 00       	mov    $0x21,%eax
+     9e0:	89 e1                	mov    %esp,%ecx
+     9e2:	ba e9 09 00 00       	mov    $0x9e9,%edx
+     9e7:	0f 34                	sysenter
+     9e9:	c3                   	ret
+
+000009ea <clone>:
+SYSCALL(clone)
+     9ea:	b8 22 00 00 00       	mov    $0x22,%eax
+     9ef:	89 e1                	mov    %esp,%ecx
+     9f1:	ba f8 09 00 00       	mov    $0x9f8,%edx
+     9f6:	0f 34                	sysenter
+     9f8:	c3                   	ret
+
+000009f9 <join>:
+SYSCALL(join)
+     9f9:	b8 23 00 00 00       	mov    $0x23,%eax
+     9fe:	89 e1                	mov    %esp,%ecx
+     a00:	ba 07 0a 00 00       	mov    $0xa07,%edx
+     a05:	0f 34                	sysenter
+     a07:	c3                   	ret
+
+00000a08 <futex_wait>:
+SYSCALL(futex_wait)
+     a08:	b8 24 00 00 00       	mov    $0x24,%eax
+     a0d:	89 e1                	mov    %esp,%ecx
+     a0f:	ba 16 0a 00 00       	mov    $0xa16,%edx
+     a14:	0f 34                	sysenter
+     a16:	c3                   	ret
+
+00000a17 <futex_wake>:
+SYSCALL(futex_wake)
+     a17:	b8 25 00 00 00       	mov    $0x25,%eax
+     a1c:	89 e1                	mov    %esp,%ecx
+     a1e:	ba 25 0a 00 00       	mov    $0xa25,%edx
+     a23:	0f 34                	sysenter
+     a25:	c3                   	ret
+
+00000a26 <setaffinity>:
+SYSCALL(setaffinity)
+     a26:	b8 26 00 00 00       	mov    $0x26,%eax
+     a2b:	89 e1                	mov    %esp,%ecx
+     a2d:	ba 34 0a 00 00       	mov    $0xa34,%edx
+     a32:	0f 34                	sysenter
+     a34:	c3                   	ret
+
+00000a35 <getaffinity>:
+SYSCALL(getaffinity)
+     a35:	b8 27 00 00 00       	mov    $0x27,%eax
+     a3a:	89 e1                	mov    %esp,%ecx
+     a3c:	ba 43 0a 00 00       	mov    $0xa43,%edx
+     a41:	0f 34                	sysenter
+     a43:	c3                   	ret
+
+00000a44 <clock_gettime>:
+SYSCALL(clock_gettime)
+     a44:	b8 28 00 00 00       	mov    $0x28,%eax
+     a49:	89 e1                	mov    %esp,%ecx
+     a4b:	ba 52 0a 00 00       	mov    $0xa52,%edx
+     a50:	0f 34                	sysenter
+     a52:	c3                   	ret
+
+00000a53 <msleep>:
+SYSCALL(msleep)
+     a53:	b8 29 00 00 00       	mov    $0x29,%eax
+     a58:	89 e1                	mov    %esp,%ecx
+     a5a:	ba 61 0a 00 00       	mov    $0xa61,%edx
+     a5f:	0f 34                	sysenter
+     a61:	c3                   	ret
+
+00000a62 <lockstat>:
+SYSCALL(lockstat)
+     a62:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     a67:	89 e1                	mov    %esp,%ecx
+     a69:	ba 70 0a 00 00       	mov    $0xa70,%edx
+     a6e:	0f 34                	sysenter
+     a70:	c3                   	ret
+
+00000a71 <bstat>:
+SYSCALL(bstat)
+     a71:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     a76:	89 e1                	mov    %esp,%ecx
+     a78:	ba 7f 0a 00 00       	mov    $0xa7f,%edx
+     a7d:	0f 34                	sysenter
+     a7f:	c3                   	ret
+
+00000a80 <iostat>:
+SYSCALL(iostat)
+     a80:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     a85:	89 e1                	mov    %esp,%ecx
+     a87:	ba 8e 0a 00 00       	mov    $0xa8e,%edx
+     a8c:	0f 34                	sysenter
+     a8e:	c3                   	ret
+
+00000a8f <fsync>:
+SYSCALL(fsync)
+     a8f:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     a94:	89 e1                	mov    %esp,%ecx
+     a96:	ba 9d 0a 00 00       	mov    $0xa9d,%edx
+     a9b:	0f 34                	sysenter
+     a9d:	c3                   	ret
+
+00000a9e <pread>:
+SYSCALL(pread)
+     a9e:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     aa3:	89 e1                	mov    %esp,%ecx
+     aa5:	ba ac 0a 00 00       	mov    $0xaac,%edx
+     aaa:	0f 34                	sysenter
+     aac:	c3                   	ret
+
+00000aad <pwrite>:
+SYSCALL(pwrite)
+     aad:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     ab2:	89 e1                	mov    %esp,%ecx
+     ab4:	ba bb 0a 00 00       	mov    $0xabb,%edx
+     ab9:	0f 34                	sysenter
+     abb:	c3                   	ret
+
+00000abc <readv>:
+SYSCALL(readv)
+     abc:	b8 30 00 00 00       	mov    $0x30,%eax
+     ac1:	89 e1                	mov    %esp,%ecx
+     ac3:	ba ca 0a 00 00       	mov    $0xaca,%edx
+     ac8:	0f 34                	sysenter
+     aca:	c3                   	ret
+
+00000acb <writev>:
+SYSCALL(writev)
+     acb:	b8 31 00 00 00       	mov    $0x31,%eax
+     ad0:	89 e1                	mov    %esp,%ecx
+     ad2:	ba d9 0a 00 00       	mov    $0xad9,%edx
+     ad7:	0f 34                	sysenter
+     ad9:	c3                   	ret
+
+00000ada <sendfile>:
+SYSCALL(sendfile)
+     ada:	b8 32 00 00 00       	mov    $0x32,%eax
+     adf:	89 e1                	mov    %esp,%ecx
+     ae1:	ba e8 0a 00 00       	mov    $0xae8,%edx
+     ae6:	0f 34                	sysenter
+     ae8:	c3                   	ret
+
+00000ae9 <fcntl>:
+SYSCALL(fcntl)
+     ae9:	b8 33 00 00 00       	mov    $0x33,%eax
+     aee:	89 e1                	mov    %esp,%ecx
+     af0:	ba f7 0a 00 00       	mov    $0xaf7,%edx
+     af5:	0f 34                	sysenter
+     af7:	c3                   	ret
+
+00000af8 <mount>:
+SYSCALL(mount)
+     af8:	b8 34 00 00 00       	mov    $0x34,%eax
+     afd:	89 e1                	mov    %esp,%ecx
+     aff:	ba 06 0b 00 00       	mov    $0xb06,%edx
+     b04:	0f 34                	sysenter
+     b06:	c3                   	ret
+
+00000b07 <getdents>:
+SYSCALL(getdents)
+     b07:	b8 35 00 00 00       	mov    $0x35,%eax
+     b0c:	89 e1                	mov    %esp,%ecx
+     b0e:	ba 15 0b 00 00       	mov    $0xb15,%edx
+     b13:	0f 34                	sysenter
+     b15:	c3                   	ret
+
+00000b16 <fstatat>:
+SYSCALL(fstatat)
+     b16:	b8 36 00 00 00       	mov    $0x36,%eax
+     b1b:	89 e1                	mov    %esp,%ecx
+     b1d:	ba 24 0b 00 00       	mov    $0xb24,%edx
+     b22:	0f 34                	sysenter
+     b24:	c3                   	ret
+
+00000b25 <sysstat>:
+SYSCALL(sysstat)
+     b25:	b8 37 00 00 00       	mov    $0x37,%eax
+     b2a:	89 e1                	mov    %esp,%ecx
+     b2c:	ba 33 0b 00 00       	mov    $0xb33,%edx
+     b31:	0f 34                	sysenter
+     b33:	c3                   	ret
+
+00000b34 <ringenter>:
+SYSCALL(ringenter)
+     b34:	b8 38 00 00 00       	mov    $0x38,%eax
+     b39:	89 e1                	mov    %esp,%ecx
+     b3b:	ba 42 0b 00 00       	mov    $0xb42,%edx
+     b40:	0f 34                	sysenter
+     b42:	c3                   	ret
+
+00000b43 <trace>:
+SYSCALL(trace)
+     b43:	b8 39 00 00 00       	mov    $0x39,%eax
+     b48:	89 e1                	mov    %esp,%ecx
+     b4a:	ba 51 0b 00 00       	mov    $0xb51,%edx
+     b4f:	0f 34                	sysenter
+     b51:	c3                   	ret
+
+00000b52 <memstat>:
+SYSCALL(memstat)
+     b52:	b8 3a 00 00 00       	mov    $0x3a,%eax
+     b57:	89 e1                	mov    %esp,%ecx
+     b59:	ba 60 0b 00 00       	mov    $0xb60,%edx
+     b5e:	0f 34                	sysenter
+     b60:	c3                   	ret
+
+00000b61 <shmget>:
+SYSCALL(shmget)
+     b61:	b8 3b 00 00 00       	mov    $0x3b,%eax
+     b66:	89 e1                	mov    %esp,%ecx
+     b68:	ba 6f 0b 00 00       	mov    $0xb6f,%edx
+     b6d:	0f 34                	sysenter
+     b6f:	c3                   	ret
+
+00000b70 <shmat>:
+SYSCALL(shmat)
+     b70:	b8 3c 00 00 00       	mov    $0x3c,%eax
+     b75:	89 e1                	mov    %esp,%ecx
+     b77:	ba 7e 0b 00 00       	mov    $0xb7e,%edx
+     b7c:	0f 34                	sysenter
+     b7e:	c3                   	ret
+
+00000b7f <shmdt>:
+SYSCALL(shmdt)
+     b7f:	b8 3d 00 00 00       	mov    $0x3d,%eax
+     b84:	89 e1                	mov    %esp,%ecx
+     b86:	ba 8d 0b 00 00       	mov    $0xb8d,%edx
+     b8b:	0f 34                	sysenter
+     b8d:	c3                   	ret
+
+00000b8e <irqstat>:
+SYSCALL(irqstat)
+     b8e:	b8 3e 00 00 00       	mov    $0x3e,%eax
+     b93:	89 e1                	mov    %esp,%ecx
+     b95:	ba 9c 0b 00 00       	mov    $0xb9c,%edx
+     b9a:	0f 34                	sysenter
+     b9c:	c3                   	ret
+
+00000b9d <irqroute>:
+SYSCALL(irqroute)
+     b9d:	b8 3f 00 00 00       	mov    $0x3f,%eax
+     ba2:	89 e1                	mov    %esp,%ecx
+     ba4:	ba ab 0b 00 00       	mov    $0xbab,%edx
+     ba9:	0f 34                	sysenter
+     bab:	c3                   	ret
+
+00000bac <putc>:
+  char buf[64];
+};
+
+static void
+putc(struct out *o, char c)
+{
+     bac:	55                   	push   %ebp
+     bad:	89 e5                	mov    %esp,%ebp
+     baf:	56                   	push   %esi
+     bb0:	53                   	push   %ebx
+     bb1:	89 c3                	mov    %eax,%ebx
+     bb3:	89 d6                	mov    %edx,%esi
+  if(o->n == sizeof(o->buf)){
+     bb5:	8b 40 04             	mov    0x4(%eax),%eax
+     bb8:	83 f8 40             	cmp    $0x40,%eax
+     bbb:	74 16                	je     bd3 <putc+0x27>
+    bufwrite(o->fd, o->buf, o->n);
+    o->n = 0;
+  }
+  o->buf[o->n++] = c;
+     bbd:	8b 43 04             	mov    0x4(%ebx),%eax
+     bc0:	8d 50 01             	lea    0x1(%eax),%edx
+     bc3:	89 53 04             	mov    %edx,0x4(%ebx)
+     bc6:	89 f1                	mov    %esi,%ecx
+     bc8:	88 4c 03 08          	mov    %cl,0x8(%ebx,%eax,1)
+}
+     bcc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     bcf:	5b                   	pop    %ebx
+     bd0:	5e                   	pop    %esi
+     bd1:	5d                   	pop    %ebp
+     bd2:	c3                   	ret
+    bufwrite(o->fd, o->buf, o->n);
+     bd3:	8d 53 08             	lea    0x8(%ebx),%edx
+     bd6:	83 ec 04             	sub    $0x4,%esp
+     bd9:	50                   	push   %eax
+     bda:	52                   	push   %edx
+     bdb:	ff 33                	push   (%ebx)
+     bdd:	e8 b2 f9 ff ff       	call   594 <bufwrite>
+    o->n = 0;
+     be2:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     be9:	83 c4 10             	add    $0x10,%esp
+     bec:	eb cf                	jmp    bbd <putc+0x11>
+
+00000bee <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     bee:	55                   	push   %ebp
+     bef:	89 e5                	mov    %esp,%ebp
+     bf1:	57                   	push   %edi
+     bf2:	56                   	push   %esi
+     bf3:	53                   	push   %ebx
+     bf4:	83 ec 2c             	sub    $0x2c,%esp
+     bf7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     bfa:	89 d0                	mov    %edx,%eax
+     bfc:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+     bfe:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     c02:	0f 95 c1             	setne  %cl
+     c05:	c1 ea 1f             	shr    $0x1f,%edx
+     c08:	84 d1                	test   %dl,%cl
+     c0a:	74 44                	je     c50 <printint+0x62>
+    neg = 1;
+    x = -xx;
+     c0c:	f7 d8                	neg    %eax
+     c0e:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+     c10:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     c17:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+     c1c:	89 c8                	mov    %ecx,%eax
+     c1e:	ba 00 00 00 00       	mov    $0x0,%edx
+     c23:	f7 f6                	div    %esi
+     c25:	89 df                	mov    %ebx,%edi
+     c27:	83 c3 01             	add    $0x1,%ebx
+     c2a:	0f b6 92 84 13 00 00 	movzbl 0x1384(%edx),%edx
+     c31:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+     c35:	89 ca                	mov    %ecx,%edx
+     c37:	89 c1                	mov    %eax,%ecx
+     c39:	39 f2                	cmp    %esi,%edx
+     c3b:	73 df                	jae    c1c <printint+0x2e>
+  if(neg)
+     c3d:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     c41:	74 31                	je     c74 <printint+0x86>
+    buf[i++] = '-';
+     c43:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+     c48:	8d 5f 02             	lea    0x2(%edi),%ebx
+     c4b:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     c4e:	eb 17                	jmp    c67 <printint+0x79>
+    x = xx;
+     c50:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+     c52:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     c59:	eb bc                	jmp    c17 <printint+0x29>
+
+  while(--i >= 0)
+    putc(o, buf[i]);
+     c5b:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+     c60:	89 f0                	mov    %esi,%eax
+     c62:	e8 45 ff ff ff       	call   bac <putc>
+  while(--i >= 0)
+     c67:	83 eb 01             	sub    $0x1,%ebx
+     c6a:	79 ef                	jns    c5b <printint+0x6d>
+}
+     c6c:	83 c4 2c             	add    $0x2c,%esp
+     c6f:	5b                   	pop    %ebx
+     c70:	5e                   	pop    %esi
+     c71:	5f                   	pop    %edi
+     c72:	5d                   	pop    %ebp
+     c73:	c3                   	ret
+     c74:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     c77:	eb ee                	jmp    c67 <printint+0x79>
+
+00000c79 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     c79:	55                   	push   %ebp
+     c7a:	89 e5                	mov    %esp,%ebp
+     c7c:	57                   	push   %edi
+     c7d:	56                   	push   %esi
+     c7e:	53                   	push   %ebx
+     c7f:	83 ec 6c             	sub    $0x6c,%esp
+  int c, i, state;
+  uint *ap;
+  struct out out, *o;
+
+  o = &out;
+  o->fd = fd;
+     c82:	8b 45 08             	mov    0x8(%ebp),%eax
+     c85:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  o->n = 0;
+     c88:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+     c8f:	8d 45 10             	lea    0x10(%ebp),%eax
+     c92:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  state = 0;
+     c95:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+     c9a:	bb 00 00 00 00       	mov    $0x0,%ebx
+     c9f:	eb 14                	jmp    cb5 <printf+0x3c>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(o, c);
+     ca1:	89 fa                	mov    %edi,%edx
+     ca3:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     ca6:	e8 01 ff ff ff       	call   bac <putc>
+     cab:	eb 05                	jmp    cb2 <printf+0x39>
+      }
+    } else if(state == '%'){
+     cad:	83 fe 25             	cmp    $0x25,%esi
+     cb0:	74 25                	je     cd7 <printf+0x5e>
+  for(i = 0; fmt[i]; i++){
+     cb2:	83 c3 01             	add    $0x1,%ebx
+     cb5:	8b 45 0c             	mov    0xc(%ebp),%eax
+     cb8:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+     cbc:	84 c0                	test   %al,%al
+     cbe:	0f 84 20 01 00 00    	je     de4 <printf+0x16b>
+    c = fmt[i] & 0xff;
+     cc4:	0f be f8             	movsbl %al,%edi
+     cc7:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     cca:	85 f6                	test   %esi,%esi
+     ccc:	75 df                	jne    cad <printf+0x34>
+      if(c == '%'){
+     cce:	83 f8 25             	cmp    $0x25,%eax
+     cd1:	75 ce                	jne    ca1 <printf+0x28>
+        state = '%';
+     cd3:	89 c6                	mov    %eax,%esi
+     cd5:	eb db                	jmp    cb2 <printf+0x39>
+      if(c == 'd'){
+     cd7:	83 f8 25             	cmp    $0x25,%eax
+     cda:	0f 84 cf 00 00 00    	je     daf <printf+0x136>
+     ce0:	0f 8c dd 00 00 00    	jl     dc3 <printf+0x14a>
+     ce6:	83 f8 78             	cmp    $0x78,%eax
+     ce9:	0f 8f d4 00 00 00    	jg     dc3 <printf+0x14a>
+     cef:	83 f8 63             	cmp    $0x63,%eax
+     cf2:	0f 8c cb 00 00 00    	jl     dc3 <printf+0x14a>
+     cf8:	83 e8 63             	sub    $0x63,%eax
+     cfb:	83 f8 15             	cmp    $0x15,%eax
+     cfe:	0f 87 bf 00 00 00    	ja     dc3 <printf+0x14a>
+     d04:	ff 24 85 2c 13 00 00 	jmp    *0x132c(,%eax,4)
+        printint(o, *ap, 10, 1);
+     d0b:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     d0e:	8b 17                	mov    (%edi),%edx
+     d10:	83 ec 0c             	sub    $0xc,%esp
+     d13:	6a 01                	push   $0x1
+     d15:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     d1a:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d1d:	e8 cc fe ff ff       	call   bee <printint>
+        ap++;
+     d22:	83 c7 04             	add    $0x4,%edi
+     d25:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     d28:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(o, '%');
+        putc(o, c);
+      }
+      state = 0;
+     d2b:	be 00 00 00 00       	mov    $0x0,%esi
+     d30:	eb 80                	jmp    cb2 <printf+0x39>
+        printint(o, *ap, 16, 0);
+     d32:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     d35:	8b 17                	mov    (%edi),%edx
+     d37:	83 ec 0c             	sub    $0xc,%esp
+     d3a:	6a 00                	push   $0x0
+     d3c:	b9 10 00 00 00       	mov    $0x10,%ecx
+     d41:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d44:	e8 a5 fe ff ff       	call   bee <printint>
+        ap++;
+     d49:	83 c7 04             	add    $0x4,%edi
+     d4c:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     d4f:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d52:	be 00 00 00 00       	mov    $0x0,%esi
+     d57:	e9 56 ff ff ff       	jmp    cb2 <printf+0x39>
+        s = (char*)*ap;
+     d5c:	8b 45 94             	mov    -0x6c(%ebp),%eax
+     d5f:	8b 30                	mov    (%eax),%esi
+        ap++;
+     d61:	83 c0 04             	add    $0x4,%eax
+     d64:	89 45 94             	mov    %eax,-0x6c(%ebp)
+        if(s == 0)
+     d67:	85 f6                	test   %esi,%esi
+     d69:	75 15                	jne    d80 <printf+0x107>
+          s = "(null)";
+     d6b:	be 24 13 00 00       	mov    $0x1324,%esi
+     d70:	eb 0e                	jmp    d80 <printf+0x107>
+          putc(o, *s);
+     d72:	0f be d2             	movsbl %dl,%edx
+     d75:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d78:	e8 2f fe ff ff       	call   bac <putc>
+          s++;
+     d7d:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+     d80:	0f b6 16             	movzbl (%esi),%edx
+     d83:	84 d2                	test   %dl,%dl
+     d85:	75 eb                	jne    d72 <printf+0xf9>
+      state = 0;
+     d87:	be 00 00 00 00       	mov    $0x0,%esi
+     d8c:	e9 21 ff ff ff       	jmp    cb2 <printf+0x39>
+        putc(o, *ap);
+     d91:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     d94:	0f be 17             	movsbl (%edi),%edx
+     d97:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d9a:	e8 0d fe ff ff       	call   bac <putc>
+        ap++;
+     d9f:	83 c7 04             	add    $0x4,%edi
+     da2:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+      state = 0;
+     da5:	be 00 00 00 00       	mov    $0x0,%esi
+     daa:	e9 03 ff ff ff       	jmp    cb2 <printf+0x39>
+        putc(o, c);
+     daf:	89 fa                	mov    %edi,%edx
+     db1:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     db4:	e8 f3 fd ff ff       	call   bac <putc>
+      state = 0;
+     db9:	be 00 00 00 00       	mov    $0x0,%esi
+     dbe:	e9 ef fe ff ff       	jmp    cb2 <printf+0x39>
+        putc(o, '%');
+     dc3:	ba 25 00 00 00       	mov    $0x25,%edx
+     dc8:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     dcb:	e8 dc fd ff ff       	call   bac <putc>
+        putc(o, c);
+     dd0:	89 fa                	mov    %edi,%edx
+     dd2:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     dd5:	e8 d2 fd ff ff       	call   bac <putc>
+      state = 0;
+     dda:	be 00 00 00 00       	mov    $0x0,%esi
+     ddf:	e9 ce fe ff ff       	jmp    cb2 <printf+0x39>
+    }
+  }
+  if(o->n > 0)
+     de4:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     de7:	85 c0                	test   %eax,%eax
+     de9:	7f 08                	jg     df3 <printf+0x17a>
+    bufwrite(fd, o->buf, o->n);
+}
+     deb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     dee:	5b                   	pop    %ebx
+     def:	5e                   	pop    %esi
+     df0:	5f                   	pop    %edi
+     df1:	5d                   	pop    %ebp
+     df2:	c3                   	ret
+    bufwrite(fd, o->buf, o->n);
+     df3:	83 ec 04             	sub    $0x4,%esp
+     df6:	50                   	push   %eax
+     df7:	8d 45 a8             	lea    -0x58(%ebp),%eax
+     dfa:	50                   	push   %eax
+     dfb:	ff 75 08             	push   0x8(%ebp)
+     dfe:	e8 91 f7 ff ff       	call   594 <bufwrite>
+     e03:	83 c4 10             	add    $0x10,%esp
+}
+     e06:	eb e3                	jmp    deb <printf+0x172>
+
+00000e08 <largefree>:
+  return &b->h;
+}
+
+static void
+largefree(Fblock *b)
+{
+     e08:	55                   	push   %ebp
+     e09:	89 e5                	mov    %esp,%ebp
+     e0b:	57                   	push   %edi
+     e0c:	56                   	push   %esi
+     e0d:	53                   	push   %ebx
+     e0e:	83 ec 0c             	sub    $0xc,%esp
+     e11:	89 c1                	mov    %eax,%ecx
+  Fblock **pp, *p, *prev;
+
+  prev = 0;
+     e13:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     e18:	ba ec 3a 00 00       	mov    $0x3aec,%edx
+     e1d:	eb 05                	jmp    e24 <largefree+0x1c>
+     e1f:	8d 50 08             	lea    0x8(%eax),%edx
+    prev = p;
+     e22:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     e24:	8b 02                	mov    (%edx),%eax
+     e26:	85 c0                	test   %eax,%eax
+     e28:	74 04                	je     e2e <largefree+0x26>
+     e2a:	39 c8                	cmp    %ecx,%eax
+     e2c:	72 f1                	jb     e1f <largefree+0x17>
+  b->next = p;
+     e2e:	89 41 08             	mov    %eax,0x8(%ecx)
+  if(p && (char*)b + b->h.size == (char*)p){
+     e31:	85 c0                	test   %eax,%eax
+     e33:	74 09                	je     e3e <largefree+0x36>
+     e35:	8b 31                	mov    (%ecx),%esi
+     e37:	8d 3c 31             	lea    (%ecx,%esi,1),%edi
+     e3a:	39 c7                	cmp    %eax,%edi
+     e3c:	74 21                	je     e5f <largefree+0x57>
+    b->h.size += p->h.size;
+    b->next = p->next;
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+     e3e:	85 db                	test   %ebx,%ebx
+     e40:	74 09                	je     e4b <largefree+0x43>
+     e42:	8b 03                	mov    (%ebx),%eax
+     e44:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+     e47:	39 ce                	cmp    %ecx,%esi
+     e49:	74 20                	je     e6b <largefree+0x63>
+    prev->h.size += b->h.size;
+    prev->next = b->next;
+  } else
+    *pp = b;
+     e4b:	89 0a                	mov    %ecx,(%edx)
+
+  // Give the top of the heap back.  With threads sharing the
+  // address space sbrk() cannot shrink it; keep the block then.
+  for(pp = &large; (*pp)->next; pp = &(*pp)->next)
+     e4d:	be ec 3a 00 00       	mov    $0x3aec,%esi
+     e52:	8b 1e                	mov    (%esi),%ebx
+     e54:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+     e58:	74 1d                	je     e77 <largefree+0x6f>
+     e5a:	8d 73 08             	lea    0x8(%ebx),%esi
+     e5d:	eb f3                	jmp    e52 <largefree+0x4a>
+    b->h.size += p->h.size;
+     e5f:	03 30                	add    (%eax),%esi
+     e61:	89 31                	mov    %esi,(%ecx)
+    b->next = p->next;
+     e63:	8b 40 08             	mov    0x8(%eax),%eax
+     e66:	89 41 08             	mov    %eax,0x8(%ecx)
+     e69:	eb d3                	jmp    e3e <largefree+0x36>
+    prev->h.size += b->h.size;
+     e6b:	03 01                	add    (%ecx),%eax
+     e6d:	89 03                	mov    %eax,(%ebx)
+    prev->next = b->next;
+     e6f:	8b 41 08             	mov    0x8(%ecx),%eax
+     e72:	89 43 08             	mov    %eax,0x8(%ebx)
+     e75:	eb d6                	jmp    e4d <largefree+0x45>
+    ;
+  b = *pp;
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     e77:	89 df                	mov    %ebx,%edi
+     e79:	03 3b                	add    (%ebx),%edi
+     e7b:	83 ec 0c             	sub    $0xc,%esp
+     e7e:	6a 00                	push   $0x0
+     e80:	e8 93 fa ff ff       	call   918 <sbrk>
+     e85:	83 c4 10             	add    $0x10,%esp
+     e88:	39 c7                	cmp    %eax,%edi
+     e8a:	74 08                	je     e94 <largefree+0x8c>
+    *pp = 0;
+}
+     e8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e8f:	5b                   	pop    %ebx
+     e90:	5e                   	pop    %esi
+     e91:	5f                   	pop    %edi
+     e92:	5d                   	pop    %ebp
+     e93:	c3                   	ret
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     e94:	8b 03                	mov    (%ebx),%eax
+     e96:	f7 d8                	neg    %eax
+     e98:	83 ec 0c             	sub    $0xc,%esp
+     e9b:	50                   	push   %eax
+     e9c:	e8 77 fa ff ff       	call   918 <sbrk>
+     ea1:	83 c4 10             	add    $0x10,%esp
+     ea4:	83 f8 ff             	cmp    $0xffffffff,%eax
+     ea7:	74 e3                	je     e8c <largefree+0x84>
+    *pp = 0;
+     ea9:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+     eaf:	eb db                	jmp    e8c <largefree+0x84>
+
+00000eb1 <more>:
+{
+     eb1:	55                   	push   %ebp
+     eb2:	89 e5                	mov    %esp,%ebp
+     eb4:	56                   	push   %esi
+     eb5:	53                   	push   %ebx
+     eb6:	89 c6                	mov    %eax,%esi
+  pad = -(uint)sbrk(0) & 7;
+     eb8:	83 ec 0c             	sub    $0xc,%esp
+     ebb:	6a 00                	push   $0x0
+     ebd:	e8 56 fa ff ff       	call   918 <sbrk>
+     ec2:	f7 d8                	neg    %eax
+     ec4:	89 c3                	mov    %eax,%ebx
+     ec6:	83 e3 07             	and    $0x7,%ebx
+  if((p = sbrk(n + pad)) == (char*)-1)
+     ec9:	01 de                	add    %ebx,%esi
+     ecb:	89 34 24             	mov    %esi,(%esp)
+     ece:	e8 45 fa ff ff       	call   918 <sbrk>
+     ed3:	83 c4 10             	add    $0x10,%esp
+     ed6:	83 f8 ff             	cmp    $0xffffffff,%eax
+     ed9:	74 09                	je     ee4 <more+0x33>
+  return p + pad;
+     edb:	01 d8                	add    %ebx,%eax
+}
+     edd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ee0:	5b                   	pop    %ebx
+     ee1:	5e                   	pop    %esi
+     ee2:	5d                   	pop    %ebp
+     ee3:	c3                   	ret
+    return 0;
+     ee4:	b8 00 00 00 00       	mov    $0x0,%eax
+     ee9:	eb f2                	jmp    edd <more+0x2c>
+
+00000eeb <slaballoc>:
+{
+     eeb:	55                   	push   %ebp
+     eec:	89 e5                	mov    %esp,%ebp
+     eee:	56                   	push   %esi
+     eef:	53                   	push   %ebx
+     ef0:	89 c6                	mov    %eax,%esi
+  n = 1 << (MINSHIFT + c);
+     ef2:	8d 48 04             	lea    0x4(%eax),%ecx
+     ef5:	bb 01 00 00 00       	mov    $0x1,%ebx
+     efa:	d3 e3                	shl    %cl,%ebx
+  if(slab + n > slabend){
+     efc:	89 d8                	mov    %ebx,%eax
+     efe:	03 05 e8 3a 00 00    	add    0x3ae8,%eax
+     f04:	39 05 e4 3a 00 00    	cmp    %eax,0x3ae4
+     f0a:	72 17                	jb     f23 <slaballoc+0x38>
+  h = (Header*)slab;
+     f0c:	a1 e8 3a 00 00       	mov    0x3ae8,%eax
+  slab += n;
+     f11:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+     f14:	89 15 e8 3a 00 00    	mov    %edx,0x3ae8
+  h->size = n;
+     f1a:	89 18                	mov    %ebx,(%eax)
+  h->class = c;
+     f1c:	89 70 04             	mov    %esi,0x4(%eax)
+}
+     f1f:	5b                   	pop    %ebx
+     f20:	5e                   	pop    %esi
+     f21:	5d                   	pop    %ebp
+     f22:	c3                   	ret
+    if((p = more(SLABSZ)) == 0)
+     f23:	b8 00 40 00 00       	mov    $0x4000,%eax
+     f28:	e8 84 ff ff ff       	call   eb1 <more>
+     f2d:	85 c0                	test   %eax,%eax
+     f2f:	74 ee                	je     f1f <slaballoc+0x34>
+    if(p != slabend)
+     f31:	39 05 e4 3a 00 00    	cmp    %eax,0x3ae4
+     f37:	74 05                	je     f3e <slaballoc+0x53>
+      slab = p;
+     f39:	a3 e8 3a 00 00       	mov    %eax,0x3ae8
+    slabend = p + SLABSZ;
+     f3e:	05 00 40 00 00       	add    $0x4000,%eax
+     f43:	a3 e4 3a 00 00       	mov    %eax,0x3ae4
+     f48:	eb c2                	jmp    f0c <slaballoc+0x21>
+
+00000f4a <largealloc>:
+{
+     f4a:	55                   	push   %ebp
+     f4b:	89 e5                	mov    %esp,%ebp
+     f4d:	56                   	push   %esi
+     f4e:	53                   	push   %ebx
+     f4f:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     f51:	b9 ec 3a 00 00       	mov    $0x3aec,%ecx
+     f56:	8b 01                	mov    (%ecx),%eax
+     f58:	85 c0                	test   %eax,%eax
+     f5a:	74 36                	je     f92 <largealloc+0x48>
+    if(b->h.size < n)
+     f5c:	8b 10                	mov    (%eax),%edx
+     f5e:	39 da                	cmp    %ebx,%edx
+     f60:	72 24                	jb     f86 <largealloc+0x3c>
+    if(b->h.size - n > SMALLMAX){
+     f62:	29 da                	sub    %ebx,%edx
+     f64:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+     f6a:	76 1f                	jbe    f8b <largealloc+0x41>
+      rest = (Fblock*)((char*)b + n);
+     f6c:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+      rest->h.size = b->h.size - n;
+     f6f:	89 16                	mov    %edx,(%esi)
+      rest->h.class = LARGE;
+     f71:	c7 46 04 09 00 00 00 	movl   $0x9,0x4(%esi)
+      rest->next = b->next;
+     f78:	8b 50 08             	mov    0x8(%eax),%edx
+     f7b:	89 56 08             	mov    %edx,0x8(%esi)
+      *pp = rest;
+     f7e:	89 31                	mov    %esi,(%ecx)
+      b->h.size = n;
+     f80:	89 18                	mov    %ebx,(%eax)
+}
+     f82:	5b                   	pop    %ebx
+     f83:	5e                   	pop    %esi
+     f84:	5d                   	pop    %ebp
+     f85:	c3                   	ret
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     f86:	8d 48 08             	lea    0x8(%eax),%ecx
+     f89:	eb cb                	jmp    f56 <largealloc+0xc>
+      *pp = b->next;
+     f8b:	8b 50 08             	mov    0x8(%eax),%edx
+     f8e:	89 11                	mov    %edx,(%ecx)
+    return &b->h;
+     f90:	eb f0                	jmp    f82 <largealloc+0x38>
+  if((b = more(n)) == 0)
+     f92:	89 d8                	mov    %ebx,%eax
+     f94:	e8 18 ff ff ff       	call   eb1 <more>
+     f99:	85 c0                	test   %eax,%eax
+     f9b:	74 e5                	je     f82 <largealloc+0x38>
+  b->h.size = n;
+     f9d:	89 18                	mov    %ebx,(%eax)
+  b->h.class = LARGE;
+     f9f:	c7 40 04 09 00 00 00 	movl   $0x9,0x4(%eax)
+  return &b->h;
+     fa6:	eb da                	jmp    f82 <largealloc+0x38>
+
+00000fa8 <free>:
+
+void
+free(void *ap)
+{
+     fa8:	55                   	push   %ebp
+     fa9:	89 e5                	mov    %esp,%ebp
+     fab:	56                   	push   %esi
+     fac:	53                   	push   %ebx
+     fad:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+
+  if(ap == 0)
+     fb0:	85 db                	test   %ebx,%ebx
+     fb2:	74 3b                	je     fef <free+0x47>
+    return;
+  h = (Header*)ap - 1;
+     fb4:	8d 73 f8             	lea    -0x8(%ebx),%esi
+  lock_acquire(&lock);
+     fb7:	83 ec 0c             	sub    $0xc,%esp
+     fba:	68 e0 3a 00 00       	push   $0x3ae0
+     fbf:	e8 9c 01 00 00       	call   1160 <lock_acquire>
+  if(h->class == LARGE)
+     fc4:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     fc7:	83 c4 10             	add    $0x10,%esp
+     fca:	83 f8 09             	cmp    $0x9,%eax
+     fcd:	74 27                	je     ff6 <free+0x4e>
+    largefree((Fblock*)h);
+  else {
+    ((Fblock*)h)->next = freelist[h->class];
+     fcf:	8b 14 85 00 3b 00 00 	mov    0x3b00(,%eax,4),%edx
+     fd6:	89 13                	mov    %edx,(%ebx)
+    freelist[h->class] = (Fblock*)h;
+     fd8:	89 34 85 00 3b 00 00 	mov    %esi,0x3b00(,%eax,4)
+  }
+  lock_release(&lock);
+     fdf:	83 ec 0c             	sub    $0xc,%esp
+     fe2:	68 e0 3a 00 00       	push   $0x3ae0
+     fe7:	e8 88 01 00 00       	call   1174 <lock_release>
+     fec:	83 c4 10             	add    $0x10,%esp
+}
+     fef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ff2:	5b                   	pop    %ebx
+     ff3:	5e                   	pop    %esi
+     ff4:	5d                   	pop    %ebp
+     ff5:	c3                   	ret
+    largefree((Fblock*)h);
+     ff6:	89 f0                	mov    %esi,%eax
+     ff8:	e8 0b fe ff ff       	call   e08 <largefree>
+     ffd:	eb e0                	jmp    fdf <free+0x37>
+
+00000fff <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     fff:	55                   	push   %ebp
+    1000:	89 e5                	mov    %esp,%ebp
+    1002:	53                   	push   %ebx
+    1003:	83 ec 04             	sub    $0x4,%esp
+    1006:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+  uint n;
+  int c;
+
+  if(nbytes > 0x7fffffff - sizeof(Header) - 7)
+    1009:	81 fb f0 ff ff 7f    	cmp    $0x7ffffff0,%ebx
+    100f:	0f 87 8b 00 00 00    	ja     10a0 <malloc+0xa1>
+    return 0;
+  n = (nbytes + sizeof(Header) + 7) & ~7;
+    1015:	83 c3 0f             	add    $0xf,%ebx
+    1018:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(n < sizeof(Fblock))
+    101b:	83 fb 0b             	cmp    $0xb,%ebx
+    101e:	77 05                	ja     1025 <malloc+0x26>
+    n = sizeof(Fblock);
+    1020:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  lock_acquire(&lock);
+    1025:	83 ec 0c             	sub    $0xc,%esp
+    1028:	68 e0 3a 00 00       	push   $0x3ae0
+    102d:	e8 2e 01 00 00       	call   1160 <lock_acquire>
+  if(n <= SMALLMAX){
+    1032:	83 c4 10             	add    $0x10,%esp
+    1035:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+    103b:	77 58                	ja     1095 <malloc+0x96>
+    for(c = 0; (1 << (MINSHIFT + c)) < n; c++)
+    103d:	ba 00 00 00 00       	mov    $0x0,%edx
+    1042:	eb 03                	jmp    1047 <malloc+0x48>
+    1044:	83 c2 01             	add    $0x1,%edx
+    1047:	8d 4a 04             	lea    0x4(%edx),%ecx
+    104a:	b8 01 00 00 00       	mov    $0x1,%eax
+    104f:	d3 e0                	shl    %cl,%eax
+    1051:	39 d8                	cmp    %ebx,%eax
+    1053:	72 ef                	jb     1044 <malloc+0x45>
+      ;
+    if(freelist[c]){
+    1055:	8b 04 95 00 3b 00 00 	mov    0x3b00(,%edx,4),%eax
+    105c:	85 c0                	test   %eax,%eax
+    105e:	74 2a                	je     108a <malloc+0x8b>
+      h = &freelist[c]->h;
+    1060:	89 c3                	mov    %eax,%ebx
+      freelist[c] = freelist[c]->next;
+    1062:	8b 40 08             	mov    0x8(%eax),%eax
+    1065:	89 04 95 00 3b 00 00 	mov    %eax,0x3b00(,%edx,4)
+    } else
+      h = slaballoc(c);
+  } else
+    h = largealloc(n);
+  lock_release(&lock);
+    106c:	83 ec 0c             	sub    $0xc,%esp
+    106f:	68 e0 3a 00 00       	push   $0x3ae0
+    1074:	e8 fb 00 00 00       	call   1174 <lock_release>
+  return h ? (void*)(h + 1) : 0;
+    1079:	83 c4 10             	add    $0x10,%esp
+    107c:	85 db                	test   %ebx,%ebx
+    107e:	74 03                	je     1083 <malloc+0x84>
+    1080:	83 c3 08             	add    $0x8,%ebx
+}
+    1083:	89 d8                	mov    %ebx,%eax
+    1085:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1088:	c9                   	leave
+    1089:	c3                   	ret
+      h = slaballoc(c);
+    108a:	89 d0                	mov    %edx,%eax
+    108c:	e8 5a fe ff ff       	call   eeb <slaballoc>
+    1091:	89 c3                	mov    %eax,%ebx
+    1093:	eb d7                	jmp    106c <malloc+0x6d>
+    h = largealloc(n);
+    1095:	89 d8                	mov    %ebx,%eax
+    1097:	e8 ae fe ff ff       	call   f4a <largealloc>
+    109c:	89 c3                	mov    %eax,%ebx
+    109e:	eb cc                	jmp    106c <malloc+0x6d>
+    return 0;
+    10a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    10a5:	eb dc                	jmp    1083 <malloc+0x84>
+
+000010a7 <tstart>:
+  void *arg;
+};
+
+static void
+tstart(void *a)
+{
+    10a7:	55                   	push   %ebp
+    10a8:	89 e5                	mov    %esp,%ebp
+    10aa:	83 ec 14             	sub    $0x14,%esp
+    10ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+    10b0:	ff 70 04             	push   0x4(%eax)
+    10b3:	ff 10                	call   *(%eax)
+  exit();
+    10b5:	e8 86 f6 ff ff       	call   740 <exit>
+
+000010ba <thread_create>:
+}
+
+// Run fn(arg) in a new thread.  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    10ba:	55                   	push   %ebp
+    10bb:	89 e5                	mov    %esp,%ebp
+    10bd:	56                   	push   %esi
+    10be:	53                   	push   %ebx
+  struct tstart *t;
+  char *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    10bf:	83 ec 0c             	sub    $0xc,%esp
+    10c2:	68 00 10 00 00       	push   $0x1000
+    10c7:	e8 33 ff ff ff       	call   fff <malloc>
+    10cc:	83 c4 10             	add    $0x10,%esp
+    10cf:	85 c0                	test   %eax,%eax
+    10d1:	74 42                	je     1115 <thread_create+0x5b>
+    10d3:	89 c3                	mov    %eax,%ebx
+    return -1;
+  t = (struct tstart*)stack;
+  t->fn = fn;
+    10d5:	8b 45 08             	mov    0x8(%ebp),%eax
+    10d8:	89 03                	mov    %eax,(%ebx)
+  t->arg = arg;
+    10da:	8b 45 0c             	mov    0xc(%ebp),%eax
+    10dd:	89 43 04             	mov    %eax,0x4(%ebx)
+  if((pid = clone(tstart, stack + TSTACK, t)) < 0)
+    10e0:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    10e6:	83 ec 04             	sub    $0x4,%esp
+    10e9:	53                   	push   %ebx
+    10ea:	50                   	push   %eax
+    10eb:	68 a7 10 00 00       	push   $0x10a7
+    10f0:	e8 f5 f8 ff ff       	call   9ea <clone>
+    10f5:	89 c6                	mov    %eax,%esi
+    10f7:	83 c4 10             	add    $0x10,%esp
+    10fa:	85 c0                	test   %eax,%eax
+    10fc:	78 09                	js     1107 <thread_create+0x4d>
+    free(stack);
+  return pid;
+}
+    10fe:	89 f0                	mov    %esi,%eax
+    1100:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1103:	5b                   	pop    %ebx
+    1104:	5e                   	pop    %esi
+    1105:	5d                   	pop    %ebp
+    1106:	c3                   	ret
+    free(stack);
+    1107:	83 ec 0c             	sub    $0xc,%esp
+    110a:	53                   	push   %ebx
+    110b:	e8 98 fe ff ff       	call   fa8 <free>
+    1110:	83 c4 10             	add    $0x10,%esp
+    1113:	eb e9                	jmp    10fe <thread_create+0x44>
+    return -1;
+    1115:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    111a:	eb e2                	jmp    10fe <thread_create+0x44>
+
+0000111c <thread_join>:
+
+// Wait for one of this process's threads to exit and free its
+// stack.  Returns its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+    111c:	55                   	push   %ebp
+    111d:	89 e5                	mov    %esp,%ebp
+    111f:	53                   	push   %ebx
+    1120:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    1123:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1126:	50                   	push   %eax
+    1127:	e8 cd f8 ff ff       	call   9f9 <join>
+    112c:	89 c3                	mov    %eax,%ebx
+    112e:	83 c4 10             	add    $0x10,%esp
+    1131:	85 c0                	test   %eax,%eax
+    1133:	79 07                	jns    113c <thread_join+0x20>
+    free((char*)stack - TSTACK);
+  return pid;
+}
+    1135:	89 d8                	mov    %ebx,%eax
+    1137:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    113a:	c9                   	leave
+    113b:	c3                   	ret
+    free((char*)stack - TSTACK);
+    113c:	83 ec 0c             	sub    $0xc,%esp
+    113f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1142:	2d 00 10 00 00       	sub    $0x1000,%eax
+    1147:	50                   	push   %eax
+    1148:	e8 5b fe ff ff       	call   fa8 <free>
+    114d:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    1150:	eb e3                	jmp    1135 <thread_join+0x19>
+
+00001152 <lock_init>:
+
+void
+lock_init(lock_t *lk)
+{
+    1152:	55                   	push   %ebp
+    1153:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    1155:	8b 45 08             	mov    0x8(%ebp),%eax
+    1158:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    115e:	5d                   	pop    %ebp
+    115f:	c3                   	ret
+
+00001160 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+    1160:	55                   	push   %ebp
+    1161:	89 e5                	mov    %esp,%ebp
+    1163:	8b 55 08             	mov    0x8(%ebp),%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    1166:	b8 01 00 00 00       	mov    $0x1,%eax
+    116b:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    116e:	85 c0                	test   %eax,%eax
+    1170:	75 f4                	jne    1166 <lock_acquire+0x6>
+    ;
+}
+    1172:	5d                   	pop    %ebp
+    1173:	c3                   	ret
+
+00001174 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+    1174:	55                   	push   %ebp
+    1175:	89 e5                	mov    %esp,%ebp
+    1177:	8b 55 08             	mov    0x8(%ebp),%edx
+    117a:	b8 00 00 00 00       	mov    $0x0,%eax
+    117f:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    1182:	5d                   	pop    %ebp
+    1183:	c3                   	ret
+
+00001184 <mutex_init>:
+// Are Tricky": state is 0 when free, 1 when held, 2 when held and
+// others may be waiting.  Unlocking an uncontended mutex costs no
+// system call.
+void
+mutex_init(mutex_t *m)
+{
+    1184:	55                   	push   %ebp
+    1185:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    1187:	8b 45 08             	mov    0x8(%ebp),%eax
+    118a:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1190:	5d                   	pop    %ebp
+    1191:	c3                   	ret
+
+00001192 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+    1192:	55                   	push   %ebp
+    1193:	89 e5                	mov    %esp,%ebp
+    1195:	53                   	push   %ebx
+    1196:	83 ec 04             	sub    $0x4,%esp
+    1199:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    119c:	b8 00 00 00 00       	mov    $0x0,%eax
+    11a1:	b9 01 00 00 00       	mov    $0x1,%ecx
+    11a6:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    11aa:	85 c0                	test   %eax,%eax
+    11ac:	74 29                	je     11d7 <mutex_lock+0x45>
+    return;
+  if(c != 2)
+    11ae:	83 f8 02             	cmp    $0x2,%eax
+    11b1:	74 20                	je     11d3 <mutex_lock+0x41>
+    11b3:	b8 02 00 00 00       	mov    $0x2,%eax
+    11b8:	f0 87 03             	lock xchg %eax,(%ebx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    11bb:	eb 16                	jmp    11d3 <mutex_lock+0x41>
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    11bd:	83 ec 08             	sub    $0x8,%esp
+    11c0:	6a 02                	push   $0x2
+    11c2:	53                   	push   %ebx
+    11c3:	e8 40 f8 ff ff       	call   a08 <futex_wait>
+  asm volatile("lock; xchgl %0, %1" :
+    11c8:	b8 02 00 00 00       	mov    $0x2,%eax
+    11cd:	f0 87 03             	lock xchg %eax,(%ebx)
+    11d0:	83 c4 10             	add    $0x10,%esp
+  while(c != 0){
+    11d3:	85 c0                	test   %eax,%eax
+    11d5:	75 e6                	jne    11bd <mutex_lock+0x2b>
+    c = xchg(&m->state, 2);
+  }
+}
+    11d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    11da:	c9                   	leave
+    11db:	c3                   	ret
+
+000011dc <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+    11dc:	55                   	push   %ebp
+    11dd:	89 e5                	mov    %esp,%ebp
+    11df:	83 ec 08             	sub    $0x8,%esp
+    11e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    11e5:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    11ea:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    11ee:	83 fa 01             	cmp    $0x1,%edx
+    11f1:	75 02                	jne    11f5 <mutex_unlock+0x19>
+    m->state = 0;
+    futex_wake(&m->state, 1);
+  }
+}
+    11f3:	c9                   	leave
+    11f4:	c3                   	ret
+    m->state = 0;
+    11f5:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+    11fb:	83 ec 08             	sub    $0x8,%esp
+    11fe:	6a 01                	push   $0x1
+    1200:	50                   	push   %eax
+    1201:	e8 11 f8 ff ff       	call   a17 <futex_wake>
+    1206:	83 c4 10             	add    $0x10,%esp
+}
+    1209:	eb e8                	jmp    11f3 <mutex_unlock+0x17>
+
+0000120b <cond_init>:
+// Condition variable: waiters sleep on a sequence number that
+// every signal bumps, so a signal between the unlock and the
+// futex_wait() in cond_wait() is not lost.
+void
+cond_init(cond_t *c)
+{
+    120b:	55                   	push   %ebp
+    120c:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    120e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1211:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1217:	5d                   	pop    %ebp
+    1218:	c3                   	ret
+
+00001219 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+    1219:	55                   	push   %ebp
+    121a:	89 e5                	mov    %esp,%ebp
+    121c:	57                   	push   %edi
+    121d:	56                   	push   %esi
+    121e:	53                   	push   %ebx
+    121f:	83 ec 18             	sub    $0x18,%esp
+    1222:	8b 75 08             	mov    0x8(%ebp),%esi
+    1225:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    1228:	8b 3e                	mov    (%esi),%edi
+  mutex_unlock(m);
+    122a:	53                   	push   %ebx
+    122b:	e8 ac ff ff ff       	call   11dc <mutex_unlock>
+  futex_wait(&c->seq, seq);
+    1230:	83 c4 08             	add    $0x8,%esp
+    1233:	57                   	push   %edi
+    1234:	56                   	push   %esi
+    1235:	e8 ce f7 ff ff       	call   a08 <futex_wait>
+  // Others may be waiting for m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+    123a:	83 c4 10             	add    $0x10,%esp
+    123d:	eb 0e                	jmp    124d <cond_wait+0x34>
+    futex_wait(&m->state, 2);
+    123f:	83 ec 08             	sub    $0x8,%esp
+    1242:	6a 02                	push   $0x2
+    1244:	53                   	push   %ebx
+    1245:	e8 be f7 ff ff       	call   a08 <futex_wait>
+    124a:	83 c4 10             	add    $0x10,%esp
+    124d:	b8 02 00 00 00       	mov    $0x2,%eax
+    1252:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    1255:	85 c0                	test   %eax,%eax
+    1257:	75 e6                	jne    123f <cond_wait+0x26>
+}
+    1259:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    125c:	5b                   	pop    %ebx
+    125d:	5e                   	pop    %esi
+    125e:	5f                   	pop    %edi
+    125f:	5d                   	pop    %ebp
+    1260:	c3                   	ret
+
+00001261 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+    1261:	55                   	push   %ebp
+    1262:	89 e5                	mov    %esp,%ebp
+    1264:	83 ec 10             	sub    $0x10,%esp
+    1267:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    126a:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+    126e:	6a 01                	push   $0x1
+    1270:	50                   	push   %eax
+    1271:	e8 a1 f7 ff ff       	call   a17 <futex_wake>
+}
+    1276:	83 c4 10             	add    $0x10,%esp
+    1279:	c9                   	leave
+    127a:	c3                   	ret
+
+0000127b <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+    127b:	55                   	push   %ebp
+    127c:	89 e5                	mov    %esp,%ebp
+    127e:	83 ec 10             	sub    $0x10,%esp
+    1281:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    1284:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, NPROC);
+    1288:	6a 40                	push   $0x40
+    128a:	50                   	push   %eax
+    128b:	e8 87 f7 ff ff       	call   a17 <futex_wake>
+}
+    1290:	83 c4 10             	add    $0x10,%esp
+    1293:	c9                   	leave
+    1294:	c3                   	ret
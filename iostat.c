@@ -0,0 +1,31 @@
+// iostat: show the disk queue statistics.  "iostat -s name"
+// switches to the I/O scheduler called name (clook or fifo) and
+// zeroes them.  Latencies are in microseconds.
+#include "types.h"
+#include "user.h"
+#include "iostat.h"
+
+int
+main(int argc, char *argv[])
+{
+  struct iostat st;
+  char *sched;
+
+  sched = 0;
+  if(argc > 2 && strcmp(argv[1], "-s") == 0)
+    sched = argv[2];
+  else if(argc > 1){
+    printf(2, "usage: iostat [-s sched]\n");
+    exit();
+  }
+  if(iostat(sched, &st) < 0){
+    printf(2, "iostat: failed\n");
+    exit();
+  }
+  printf(1, "SCHED\tQUEUED\tREQS\tBLOCKS\tDEPTH\tMAXDEPTH\tAVGDEPTH\tAVGLAT\tMAXLAT\n");
+  printf(1, "%s\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%d\n", st.sched, st.nqueued,
+         st.nreq, st.nblk, st.depth, st.maxdepth,
+         st.nqueued ? st.sumdepth / st.nqueued : 0,
+         st.nblk ? st.sumlat / st.nblk : 0, st.maxlat);
+  exit();
+}
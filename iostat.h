@@ -0,0 +1,14 @@
+// Disk queue statistics, as returned by iostat().
+// Latencies are in microseconds, from queueing to completion.
+
+struct iostat {
+  char sched[8];               // Name of the I/O scheduler
+  uint nqueued;                // Blocks queued
+  uint nreq;                   // Requests sent to the disk
+  uint nblk;                   // Blocks they moved; nblk-nreq were merged
+  uint depth;                  // Blocks in the queue now
+  uint maxdepth;               // ... at most
+  uint sumdepth;               // ... summed over arrivals, for the mean
+  uint sumlat;                 // Latency summed over completed blocks
+  uint maxlat;                 // ... at most
+};
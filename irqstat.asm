@@ -0,0 +1,2935 @@
+
+_irqstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+static uint n[NCPU][NIRQ];
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	81 ec 88 00 00 00    	sub    $0x88,%esp
+      17:	8b 19                	mov    (%ecx),%ebx
+      19:	8b 71 04             	mov    0x4(%ecx),%esi
+  int route[NIRQ];
+  int i, c, ncpu;
+  uint tot;
+
+  if(argc == 4 && strcmp(argv[1], "-r") == 0){
+      1c:	83 fb 04             	cmp    $0x4,%ebx
+      1f:	74 1d                	je     3e <main+0x3e>
+    c = strcmp(argv[3], "-1") == 0 ? -1 : atoi(argv[3]);
+    if(irqroute(atoi(argv[2]), c) < 0)
+      printf(2, "irqstat: cannot route irq %s to cpu %s\n", argv[2], argv[3]);
+    exit();
+  }
+  if(argc > 1){
+      21:	83 fb 01             	cmp    $0x1,%ebx
+      24:	0f 8e 91 00 00 00    	jle    bb <main+0xbb>
+    printf(2, "usage: irqstat [-r irq cpu]\n");
+      2a:	83 ec 08             	sub    $0x8,%esp
+      2d:	68 e6 13 00 00       	push   $0x13e6
+      32:	6a 02                	push   $0x2
+      34:	e8 70 0d 00 00       	call   da9 <printf>
+    exit();
+      39:	e8 32 08 00 00       	call   870 <exit>
+  if(argc == 4 && strcmp(argv[1], "-r") == 0){
+      3e:	83 ec 08             	sub    $0x8,%esp
+      41:	68 e0 13 00 00       	push   $0x13e0
+      46:	ff 76 04             	push   0x4(%esi)
+      49:	e8 10 02 00 00       	call   25e <strcmp>
+      4e:	83 c4 10             	add    $0x10,%esp
+      51:	85 c0                	test   %eax,%eax
+      53:	75 cc                	jne    21 <main+0x21>
+    c = strcmp(argv[3], "-1") == 0 ? -1 : atoi(argv[3]);
+      55:	83 ec 08             	sub    $0x8,%esp
+      58:	68 e3 13 00 00       	push   $0x13e3
+      5d:	ff 76 0c             	push   0xc(%esi)
+      60:	e8 f9 01 00 00       	call   25e <strcmp>
+      65:	83 c4 10             	add    $0x10,%esp
+      68:	85 c0                	test   %eax,%eax
+      6a:	75 26                	jne    92 <main+0x92>
+      6c:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    if(irqroute(atoi(argv[2]), c) < 0)
+      71:	83 ec 0c             	sub    $0xc,%esp
+      74:	ff 76 08             	push   0x8(%esi)
+      77:	e8 f3 03 00 00       	call   46f <atoi>
+      7c:	83 c4 08             	add    $0x8,%esp
+      7f:	53                   	push   %ebx
+      80:	50                   	push   %eax
+      81:	e8 47 0c 00 00       	call   ccd <irqroute>
+      86:	83 c4 10             	add    $0x10,%esp
+      89:	85 c0                	test   %eax,%eax
+      8b:	78 17                	js     a4 <main+0xa4>
+    exit();
+      8d:	e8 de 07 00 00       	call   870 <exit>
+    c = strcmp(argv[3], "-1") == 0 ? -1 : atoi(argv[3]);
+      92:	83 ec 0c             	sub    $0xc,%esp
+      95:	ff 76 0c             	push   0xc(%esi)
+      98:	e8 d2 03 00 00       	call   46f <atoi>
+      9d:	89 c3                	mov    %eax,%ebx
+      9f:	83 c4 10             	add    $0x10,%esp
+      a2:	eb cd                	jmp    71 <main+0x71>
+      printf(2, "irqstat: cannot route irq %s to cpu %s\n", argv[2], argv[3]);
+      a4:	ff 76 0c             	push   0xc(%esi)
+      a7:	ff 76 08             	push   0x8(%esi)
+      aa:	68 68 14 00 00       	push   $0x1468
+      af:	6a 02                	push   $0x2
+      b1:	e8 f3 0c 00 00       	call   da9 <printf>
+      b6:	83 c4 10             	add    $0x10,%esp
+      b9:	eb d2                	jmp    8d <main+0x8d>
+  }
+  if(irqstat(-1, (uint*)route) < 0){
+      bb:	83 ec 08             	sub    $0x8,%esp
+      be:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+      c4:	50                   	push   %eax
+      c5:	6a ff                	push   $0xffffffff
+      c7:	e8 f2 0b 00 00       	call   cbe <irqstat>
+      cc:	83 c4 10             	add    $0x10,%esp
+      cf:	85 c0                	test   %eax,%eax
+      d1:	78 07                	js     da <main+0xda>
+    printf(2, "irqstat: failed\n");
+    exit();
+  }
+  for(ncpu = 0; ncpu < NCPU && irqstat(ncpu, n[ncpu]) == 0; ncpu++)
+      d3:	be 00 00 00 00       	mov    $0x0,%esi
+      d8:	eb 17                	jmp    f1 <main+0xf1>
+    printf(2, "irqstat: failed\n");
+      da:	83 ec 08             	sub    $0x8,%esp
+      dd:	68 03 14 00 00       	push   $0x1403
+      e2:	6a 02                	push   $0x2
+      e4:	e8 c0 0c 00 00       	call   da9 <printf>
+    exit();
+      e9:	e8 82 07 00 00       	call   870 <exit>
+  for(ncpu = 0; ncpu < NCPU && irqstat(ncpu, n[ncpu]) == 0; ncpu++)
+      ee:	83 c6 01             	add    $0x1,%esi
+      f1:	83 fe 07             	cmp    $0x7,%esi
+      f4:	7f 1b                	jg     111 <main+0x111>
+      f6:	89 f0                	mov    %esi,%eax
+      f8:	c1 e0 07             	shl    $0x7,%eax
+      fb:	05 60 1c 00 00       	add    $0x1c60,%eax
+     100:	83 ec 08             	sub    $0x8,%esp
+     103:	50                   	push   %eax
+     104:	56                   	push   %esi
+     105:	e8 b4 0b 00 00       	call   cbe <irqstat>
+     10a:	83 c4 10             	add    $0x10,%esp
+     10d:	85 c0                	test   %eax,%eax
+     10f:	74 dd                	je     ee <main+0xee>
+    ;
+
+  printf(1, "IRQ\tNAME\tROUTE");
+     111:	83 ec 08             	sub    $0x8,%esp
+     114:	68 14 14 00 00       	push   $0x1414
+     119:	6a 01                	push   $0x1
+     11b:	e8 89 0c 00 00       	call   da9 <printf>
+  for(c = 0; c < ncpu; c++)
+     120:	83 c4 10             	add    $0x10,%esp
+     123:	bb 00 00 00 00       	mov    $0x0,%ebx
+     128:	eb 16                	jmp    140 <main+0x140>
+    printf(1, "\tCPU%d", c);
+     12a:	83 ec 04             	sub    $0x4,%esp
+     12d:	53                   	push   %ebx
+     12e:	68 23 14 00 00       	push   $0x1423
+     133:	6a 01                	push   $0x1
+     135:	e8 6f 0c 00 00       	call   da9 <printf>
+  for(c = 0; c < ncpu; c++)
+     13a:	83 c3 01             	add    $0x1,%ebx
+     13d:	83 c4 10             	add    $0x10,%esp
+     140:	39 f3                	cmp    %esi,%ebx
+     142:	7c e6                	jl     12a <main+0x12a>
+  printf(1, "\n");
+     144:	83 ec 08             	sub    $0x8,%esp
+     147:	68 01 14 00 00       	push   $0x1401
+     14c:	6a 01                	push   $0x1
+     14e:	e8 56 0c 00 00       	call   da9 <printf>
+  for(i = 0; i < NIRQ; i++){
+     153:	83 c4 10             	add    $0x10,%esp
+     156:	bb 00 00 00 00       	mov    $0x0,%ebx
+     15b:	e9 bf 00 00 00       	jmp    21f <main+0x21f>
+    for(tot = 0, c = 0; c < ncpu; c++)
+      tot += n[c][i];
+     160:	89 c2                	mov    %eax,%edx
+     162:	c1 e2 05             	shl    $0x5,%edx
+     165:	01 da                	add    %ebx,%edx
+     167:	03 0c 95 60 1c 00 00 	add    0x1c60(,%edx,4),%ecx
+    for(tot = 0, c = 0; c < ncpu; c++)
+     16e:	83 c0 01             	add    $0x1,%eax
+     171:	39 f0                	cmp    %esi,%eax
+     173:	7c eb                	jl     160 <main+0x160>
+    if(tot == 0 && route[i] < 0)
+     175:	85 c9                	test   %ecx,%ecx
+     177:	75 0e                	jne    187 <main+0x187>
+     179:	83 bc 9d 68 ff ff ff 	cmpl   $0x0,-0x98(%ebp,%ebx,4)
+     180:	00 
+     181:	0f 88 95 00 00 00    	js     21c <main+0x21c>
+      continue;
+    printf(1, "%d\t%s\t", i, names[i] ? names[i] : "");
+     187:	8b 04 9d a0 14 00 00 	mov    0x14a0(,%ebx,4),%eax
+     18e:	85 c0                	test   %eax,%eax
+     190:	74 36                	je     1c8 <main+0x1c8>
+     192:	50                   	push   %eax
+     193:	53                   	push   %ebx
+     194:	68 2a 14 00 00       	push   $0x142a
+     199:	6a 01                	push   $0x1
+     19b:	e8 09 0c 00 00       	call   da9 <printf>
+    if(route[i] < 0)
+     1a0:	8b 84 9d 68 ff ff ff 	mov    -0x98(%ebp,%ebx,4),%eax
+     1a7:	83 c4 10             	add    $0x10,%esp
+     1aa:	85 c0                	test   %eax,%eax
+     1ac:	78 21                	js     1cf <main+0x1cf>
+      printf(1, "-");
+    else
+      printf(1, "%d", route[i]);
+     1ae:	83 ec 04             	sub    $0x4,%esp
+     1b1:	50                   	push   %eax
+     1b2:	68 34 14 00 00       	push   $0x1434
+     1b7:	6a 01                	push   $0x1
+     1b9:	e8 eb 0b 00 00       	call   da9 <printf>
+     1be:	83 c4 10             	add    $0x10,%esp
+    printf(1, "%d\t%s\t", i, names[i] ? names[i] : "");
+     1c1:	bf 00 00 00 00       	mov    $0x0,%edi
+     1c6:	eb 3e                	jmp    206 <main+0x206>
+     1c8:	b8 30 14 00 00       	mov    $0x1430,%eax
+     1cd:	eb c3                	jmp    192 <main+0x192>
+      printf(1, "-");
+     1cf:	83 ec 08             	sub    $0x8,%esp
+     1d2:	68 31 14 00 00       	push   $0x1431
+     1d7:	6a 01                	push   $0x1
+     1d9:	e8 cb 0b 00 00       	call   da9 <printf>
+     1de:	83 c4 10             	add    $0x10,%esp
+     1e1:	eb de                	jmp    1c1 <main+0x1c1>
+    for(c = 0; c < ncpu; c++)
+      printf(1, "\t%d", n[c][i]);
+     1e3:	83 ec 04             	sub    $0x4,%esp
+     1e6:	89 f8                	mov    %edi,%eax
+     1e8:	c1 e0 05             	shl    $0x5,%eax
+     1eb:	01 d8                	add    %ebx,%eax
+     1ed:	ff 34 85 60 1c 00 00 	push   0x1c60(,%eax,4)
+     1f4:	68 33 14 00 00       	push   $0x1433
+     1f9:	6a 01                	push   $0x1
+     1fb:	e8 a9 0b 00 00       	call   da9 <printf>
+    for(c = 0; c < ncpu; c++)
+     200:	83 c7 01             	add    $0x1,%edi
+     203:	83 c4 10             	add    $0x10,%esp
+     206:	39 f7                	cmp    %esi,%edi
+     208:	7c d9                	jl     1e3 <main+0x1e3>
+    printf(1, "\n");
+     20a:	83 ec 08             	sub    $0x8,%esp
+     20d:	68 01 14 00 00       	push   $0x1401
+     212:	6a 01                	push   $0x1
+     214:	e8 90 0b 00 00       	call   da9 <printf>
+     219:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NIRQ; i++){
+     21c:	83 c3 01             	add    $0x1,%ebx
+     21f:	83 fb 1f             	cmp    $0x1f,%ebx
+     222:	7f 0f                	jg     233 <main+0x233>
+    for(tot = 0, c = 0; c < ncpu; c++)
+     224:	b9 00 00 00 00       	mov    $0x0,%ecx
+     229:	b8 00 00 00 00       	mov    $0x0,%eax
+     22e:	e9 3e ff ff ff       	jmp    171 <main+0x171>
+  }
+  exit();
+     233:	e8 38 06 00 00       	call   870 <exit>
+
+00000238 <strcpy>:
+#include "memlayout.h"
+#include "clock.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     238:	55                   	push   %ebp
+     239:	89 e5                	mov    %esp,%ebp
+     23b:	56                   	push   %esi
+     23c:	53                   	push   %ebx
+     23d:	8b 75 08             	mov    0x8(%ebp),%esi
+     240:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     243:	89 f0                	mov    %esi,%eax
+     245:	89 d1                	mov    %edx,%ecx
+     247:	83 c2 01             	add    $0x1,%edx
+     24a:	89 c3                	mov    %eax,%ebx
+     24c:	83 c0 01             	add    $0x1,%eax
+     24f:	0f b6 09             	movzbl (%ecx),%ecx
+     252:	88 0b                	mov    %cl,(%ebx)
+     254:	84 c9                	test   %cl,%cl
+     256:	75 ed                	jne    245 <strcpy+0xd>
+    ;
+  return os;
+}
+     258:	89 f0                	mov    %esi,%eax
+     25a:	5b                   	pop    %ebx
+     25b:	5e                   	pop    %esi
+     25c:	5d                   	pop    %ebp
+     25d:	c3                   	ret
+
+0000025e <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     25e:	55                   	push   %ebp
+     25f:	89 e5                	mov    %esp,%ebp
+     261:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     264:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+     267:	eb 06                	jmp    26f <strcmp+0x11>
+    p++, q++;
+     269:	83 c1 01             	add    $0x1,%ecx
+     26c:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+     26f:	0f b6 01             	movzbl (%ecx),%eax
+     272:	84 c0                	test   %al,%al
+     274:	74 04                	je     27a <strcmp+0x1c>
+     276:	3a 02                	cmp    (%edx),%al
+     278:	74 ef                	je     269 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+     27a:	0f b6 c0             	movzbl %al,%eax
+     27d:	0f b6 12             	movzbl (%edx),%edx
+     280:	29 d0                	sub    %edx,%eax
+}
+     282:	5d                   	pop    %ebp
+     283:	c3                   	ret
+
+00000284 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     284:	55                   	push   %ebp
+     285:	89 e5                	mov    %esp,%ebp
+     287:	53                   	push   %ebx
+     288:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  const char *p;
+  uint w;
+
+  for(p = s; (uint)p & 3; p++)
+     28b:	89 c8                	mov    %ecx,%eax
+     28d:	eb 03                	jmp    292 <strlen+0xe>
+     28f:	83 c0 01             	add    $0x1,%eax
+     292:	a8 03                	test   $0x3,%al
+     294:	74 09                	je     29f <strlen+0x1b>
+    if(*p == 0)
+     296:	80 38 00             	cmpb   $0x0,(%eax)
+     299:	75 f4                	jne    28f <strlen+0xb>
+      return p - s;
+     29b:	29 c8                	sub    %ecx,%eax
+     29d:	eb 25                	jmp    2c4 <strlen+0x40>
+  // Then a word at a time, which never crosses into the next page:
+  // a word with a zero byte in it has one of these bits set.
+  for(;; p += 4){
+    w = *(uint*)p;
+     29f:	8b 10                	mov    (%eax),%edx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     2a1:	8d 9a ff fe fe fe    	lea    -0x1010101(%edx),%ebx
+     2a7:	f7 d2                	not    %edx
+     2a9:	21 da                	and    %ebx,%edx
+     2ab:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+     2b1:	75 05                	jne    2b8 <strlen+0x34>
+  for(;; p += 4){
+     2b3:	83 c0 04             	add    $0x4,%eax
+    w = *(uint*)p;
+     2b6:	eb e7                	jmp    29f <strlen+0x1b>
+      break;
+  }
+  while(*p)
+     2b8:	80 38 00             	cmpb   $0x0,(%eax)
+     2bb:	74 05                	je     2c2 <strlen+0x3e>
+    p++;
+     2bd:	83 c0 01             	add    $0x1,%eax
+     2c0:	eb f6                	jmp    2b8 <strlen+0x34>
+  return p - s;
+     2c2:	29 c8                	sub    %ecx,%eax
+}
+     2c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2c7:	c9                   	leave
+     2c8:	c3                   	ret
+
+000002c9 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     2c9:	55                   	push   %ebp
+     2ca:	89 e5                	mov    %esp,%ebp
+     2cc:	57                   	push   %edi
+     2cd:	56                   	push   %esi
+     2ce:	53                   	push   %ebx
+     2cf:	8b 55 10             	mov    0x10(%ebp),%edx
+  uint h;
+  char *d;
+
+  d = dst;
+  c &= 0xFF;
+     2d2:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  if(n >= 16){
+     2d6:	83 fa 0f             	cmp    $0xf,%edx
+     2d9:	76 52                	jbe    32d <memset+0x64>
+    h = -(uint)d & 3;
+     2db:	8b 45 08             	mov    0x8(%ebp),%eax
+     2de:	f7 d8                	neg    %eax
+     2e0:	83 e0 03             	and    $0x3,%eax
+     2e3:	89 c6                	mov    %eax,%esi
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     2e5:	8b 7d 08             	mov    0x8(%ebp),%edi
+     2e8:	89 c1                	mov    %eax,%ecx
+     2ea:	89 d8                	mov    %ebx,%eax
+     2ec:	fc                   	cld
+     2ed:	f3 aa                	rep stos %al,%es:(%edi)
+    stosb(d, c, h);
+    stosl(d + h, (c<<24)|(c<<16)|(c<<8)|c, (n - h)/4);
+     2ef:	29 f2                	sub    %esi,%edx
+     2f1:	89 d1                	mov    %edx,%ecx
+     2f3:	c1 e9 02             	shr    $0x2,%ecx
+     2f6:	c1 e0 18             	shl    $0x18,%eax
+     2f9:	89 df                	mov    %ebx,%edi
+     2fb:	c1 e7 10             	shl    $0x10,%edi
+     2fe:	09 f8                	or     %edi,%eax
+     300:	89 df                	mov    %ebx,%edi
+     302:	c1 e7 08             	shl    $0x8,%edi
+     305:	09 f8                	or     %edi,%eax
+     307:	09 d8                	or     %ebx,%eax
+     309:	89 f7                	mov    %esi,%edi
+     30b:	03 7d 08             	add    0x8(%ebp),%edi
+}
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosl" :
+     30e:	fc                   	cld
+     30f:	f3 ab                	rep stos %eax,%es:(%edi)
+    d += h + (n - h)/4*4;
+     311:	89 d7                	mov    %edx,%edi
+     313:	83 e7 fc             	and    $0xfffffffc,%edi
+     316:	09 f7                	or     %esi,%edi
+     318:	03 7d 08             	add    0x8(%ebp),%edi
+    n = (n - h)%4;
+     31b:	83 e2 03             	and    $0x3,%edx
+  asm volatile("cld; rep stosb" :
+     31e:	89 d1                	mov    %edx,%ecx
+     320:	89 d8                	mov    %ebx,%eax
+     322:	fc                   	cld
+     323:	f3 aa                	rep stos %al,%es:(%edi)
+  }
+  stosb(d, c, n);
+  return dst;
+}
+     325:	8b 45 08             	mov    0x8(%ebp),%eax
+     328:	5b                   	pop    %ebx
+     329:	5e                   	pop    %esi
+     32a:	5f                   	pop    %edi
+     32b:	5d                   	pop    %ebp
+     32c:	c3                   	ret
+  d = dst;
+     32d:	8b 7d 08             	mov    0x8(%ebp),%edi
+     330:	eb ec                	jmp    31e <memset+0x55>
+
+00000332 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     332:	55                   	push   %ebp
+     333:	89 e5                	mov    %esp,%ebp
+     335:	8b 45 08             	mov    0x8(%ebp),%eax
+     338:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     33c:	eb 03                	jmp    341 <strchr+0xf>
+     33e:	83 c0 01             	add    $0x1,%eax
+     341:	0f b6 10             	movzbl (%eax),%edx
+     344:	84 d2                	test   %dl,%dl
+     346:	74 06                	je     34e <strchr+0x1c>
+    if(*s == c)
+     348:	38 ca                	cmp    %cl,%dl
+     34a:	75 f2                	jne    33e <strchr+0xc>
+     34c:	eb 05                	jmp    353 <strchr+0x21>
+      return (char*)s;
+  return 0;
+     34e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     353:	5d                   	pop    %ebp
+     354:	c3                   	ret
+
+00000355 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     355:	55                   	push   %ebp
+     356:	89 e5                	mov    %esp,%ebp
+     358:	56                   	push   %esi
+     359:	53                   	push   %ebx
+     35a:	8b 55 08             	mov    0x8(%ebp),%edx
+     35d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     360:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  // A word at a time while they agree.
+  if((((uint)s1 | (uint)s2) & 3) == 0)
+     363:	89 d3                	mov    %edx,%ebx
+     365:	09 cb                	or     %ecx,%ebx
+     367:	f6 c3 03             	test   $0x3,%bl
+     36a:	74 24                	je     390 <memcmp+0x3b>
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+      s1 += 4, s2 += 4;
+  while(n-- > 0){
+     36c:	8d 70 ff             	lea    -0x1(%eax),%esi
+     36f:	85 c0                	test   %eax,%eax
+     371:	74 32                	je     3a5 <memcmp+0x50>
+    if(*s1 != *s2)
+     373:	0f b6 02             	movzbl (%edx),%eax
+     376:	0f b6 19             	movzbl (%ecx),%ebx
+     379:	38 d8                	cmp    %bl,%al
+     37b:	75 20                	jne    39d <memcmp+0x48>
+      return *s1 - *s2;
+    s1++, s2++;
+     37d:	83 c2 01             	add    $0x1,%edx
+     380:	83 c1 01             	add    $0x1,%ecx
+  while(n-- > 0){
+     383:	89 f0                	mov    %esi,%eax
+     385:	eb e5                	jmp    36c <memcmp+0x17>
+      s1 += 4, s2 += 4;
+     387:	83 c2 04             	add    $0x4,%edx
+     38a:	83 c1 04             	add    $0x4,%ecx
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+     38d:	83 e8 04             	sub    $0x4,%eax
+     390:	83 f8 03             	cmp    $0x3,%eax
+     393:	76 d7                	jbe    36c <memcmp+0x17>
+     395:	8b 31                	mov    (%ecx),%esi
+     397:	39 32                	cmp    %esi,(%edx)
+     399:	74 ec                	je     387 <memcmp+0x32>
+     39b:	eb cf                	jmp    36c <memcmp+0x17>
+      return *s1 - *s2;
+     39d:	0f b6 c0             	movzbl %al,%eax
+     3a0:	0f b6 db             	movzbl %bl,%ebx
+     3a3:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     3a5:	5b                   	pop    %ebx
+     3a6:	5e                   	pop    %esi
+     3a7:	5d                   	pop    %ebp
+     3a8:	c3                   	ret
+
+000003a9 <memchr>:
+// The first c in the n bytes at v, or 0.  Once aligned, a word at
+// a time, with the word's bytes that equal c turned into zeroes
+// and those looked for.
+void*
+memchr(const void *v, int c, uint n)
+{
+     3a9:	55                   	push   %ebp
+     3aa:	89 e5                	mov    %esp,%ebp
+     3ac:	57                   	push   %edi
+     3ad:	56                   	push   %esi
+     3ae:	53                   	push   %ebx
+     3af:	8b 45 08             	mov    0x8(%ebp),%eax
+     3b2:	8b 55 10             	mov    0x10(%ebp),%edx
+  const uchar *s;
+  uint w, rep;
+
+  s = v;
+  c = (uchar)c;
+     3b5:	0f b6 75 0c          	movzbl 0xc(%ebp),%esi
+  for(; n > 0 && ((uint)s & 3); n--, s++)
+     3b9:	eb 06                	jmp    3c1 <memchr+0x18>
+     3bb:	83 ea 01             	sub    $0x1,%edx
+     3be:	83 c0 01             	add    $0x1,%eax
+     3c1:	85 d2                	test   %edx,%edx
+     3c3:	74 0d                	je     3d2 <memchr+0x29>
+     3c5:	a8 03                	test   $0x3,%al
+     3c7:	74 09                	je     3d2 <memchr+0x29>
+    if(*s == c)
+     3c9:	0f b6 08             	movzbl (%eax),%ecx
+     3cc:	39 f1                	cmp    %esi,%ecx
+     3ce:	75 eb                	jne    3bb <memchr+0x12>
+     3d0:	eb 41                	jmp    413 <memchr+0x6a>
+      return (void*)s;
+  rep = c * 0x01010101;
+     3d2:	69 fe 01 01 01 01    	imul   $0x1010101,%esi,%edi
+  for(; n >= 4; n -= 4, s += 4){
+     3d8:	eb 06                	jmp    3e0 <memchr+0x37>
+     3da:	83 ea 04             	sub    $0x4,%edx
+     3dd:	83 c0 04             	add    $0x4,%eax
+     3e0:	83 fa 03             	cmp    $0x3,%edx
+     3e3:	76 16                	jbe    3fb <memchr+0x52>
+    w = *(uint*)s ^ rep;
+     3e5:	89 f9                	mov    %edi,%ecx
+     3e7:	33 08                	xor    (%eax),%ecx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     3e9:	8d 99 ff fe fe fe    	lea    -0x1010101(%ecx),%ebx
+     3ef:	f7 d1                	not    %ecx
+     3f1:	21 cb                	and    %ecx,%ebx
+     3f3:	f7 c3 80 80 80 80    	test   $0x80808080,%ebx
+     3f9:	74 df                	je     3da <memchr+0x31>
+      break;
+  }
+  for(; n > 0; n--, s++)
+     3fb:	85 d2                	test   %edx,%edx
+     3fd:	74 0f                	je     40e <memchr+0x65>
+    if(*s == c)
+     3ff:	0f b6 08             	movzbl (%eax),%ecx
+     402:	39 f1                	cmp    %esi,%ecx
+     404:	74 0d                	je     413 <memchr+0x6a>
+  for(; n > 0; n--, s++)
+     406:	83 ea 01             	sub    $0x1,%edx
+     409:	83 c0 01             	add    $0x1,%eax
+     40c:	eb ed                	jmp    3fb <memchr+0x52>
+      return (void*)s;
+  return 0;
+     40e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     413:	5b                   	pop    %ebx
+     414:	5e                   	pop    %esi
+     415:	5f                   	pop    %edi
+     416:	5d                   	pop    %ebp
+     417:	c3                   	ret
+
+00000418 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     418:	55                   	push   %ebp
+     419:	89 e5                	mov    %esp,%ebp
+     41b:	57                   	push   %edi
+     41c:	56                   	push   %esi
+     41d:	53                   	push   %ebx
+     41e:	83 ec 1c             	sub    $0x1c,%esp
+     421:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     424:	bb 00 00 00 00       	mov    $0x0,%ebx
+     429:	89 de                	mov    %ebx,%esi
+     42b:	83 c3 01             	add    $0x1,%ebx
+     42e:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     431:	7d 2e                	jge    461 <gets+0x49>
+    cc = read(0, &c, 1);
+     433:	83 ec 04             	sub    $0x4,%esp
+     436:	6a 01                	push   $0x1
+     438:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     43b:	50                   	push   %eax
+     43c:	6a 00                	push   $0x0
+     43e:	e8 51 05 00 00       	call   994 <read>
+    if(cc < 1)
+     443:	83 c4 10             	add    $0x10,%esp
+     446:	85 c0                	test   %eax,%eax
+     448:	7e 17                	jle    461 <gets+0x49>
+      break;
+    buf[i++] = c;
+     44a:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     44e:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+     451:	3c 0a                	cmp    $0xa,%al
+     453:	0f 94 c2             	sete   %dl
+     456:	3c 0d                	cmp    $0xd,%al
+     458:	0f 94 c0             	sete   %al
+     45b:	08 c2                	or     %al,%dl
+     45d:	74 ca                	je     429 <gets+0x11>
+    buf[i++] = c;
+     45f:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+     461:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+     465:	89 f8                	mov    %edi,%eax
+     467:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     46a:	5b                   	pop    %ebx
+     46b:	5e                   	pop    %esi
+     46c:	5f                   	pop    %edi
+     46d:	5d                   	pop    %ebp
+     46e:	c3                   	ret
+
+0000046f <atoi>:
+  return r;
+}
+
+int
+atoi(const char *s)
+{
+     46f:	55                   	push   %ebp
+     470:	89 e5                	mov    %esp,%ebp
+     472:	53                   	push   %ebx
+     473:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+     476:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+     47b:	eb 10                	jmp    48d <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+     47d:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+     480:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+     483:	83 c1 01             	add    $0x1,%ecx
+     486:	0f be c0             	movsbl %al,%eax
+     489:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+     48d:	0f b6 01             	movzbl (%ecx),%eax
+     490:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     493:	80 fb 09             	cmp    $0x9,%bl
+     496:	76 e5                	jbe    47d <atoi+0xe>
+  return n;
+}
+     498:	89 d0                	mov    %edx,%eax
+     49a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     49d:	c9                   	leave
+     49e:	c3                   	ret
+
+0000049f <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     49f:	55                   	push   %ebp
+     4a0:	89 e5                	mov    %esp,%ebp
+     4a2:	57                   	push   %edi
+     4a3:	56                   	push   %esi
+     4a4:	53                   	push   %ebx
+     4a5:	83 ec 08             	sub    $0x8,%esp
+     4a8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     4ab:	8b 55 0c             	mov    0xc(%ebp),%edx
+     4ae:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *src;
+  int h;
+
+  dst = vdst;
+  src = vsrc;
+  if(n <= 0)
+     4b1:	85 c0                	test   %eax,%eax
+     4b3:	0f 8e 82 00 00 00    	jle    53b <memmove+0x9c>
+    return vdst;
+  if(src < dst && src + n > dst){
+     4b9:	39 da                	cmp    %ebx,%edx
+     4bb:	73 07                	jae    4c4 <memmove+0x25>
+     4bd:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+     4c0:	39 cb                	cmp    %ecx,%ebx
+     4c2:	72 5e                	jb     522 <memmove+0x83>
+    movsbback(dst + n - 1, src + n - 1, n);
+    return vdst;
+  }
+  if(n >= 16 && (((uint)dst ^ (uint)src) & 3) == 0){
+     4c4:	83 f8 0f             	cmp    $0xf,%eax
+     4c7:	7e 69                	jle    532 <memmove+0x93>
+     4c9:	89 d9                	mov    %ebx,%ecx
+     4cb:	31 d1                	xor    %edx,%ecx
+     4cd:	f6 c1 03             	test   $0x3,%cl
+     4d0:	75 73                	jne    545 <memmove+0xa6>
+    h = -(uint)dst & 3;
+     4d2:	89 d9                	mov    %ebx,%ecx
+     4d4:	f7 d9                	neg    %ecx
+     4d6:	83 e1 03             	and    $0x3,%ecx
+}
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsb" :
+     4d9:	89 df                	mov    %ebx,%edi
+     4db:	89 d6                	mov    %edx,%esi
+     4dd:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+     4e0:	fc                   	cld
+     4e1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    movsb(dst, src, h);
+    dst += h, src += h, n -= h;
+     4e3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+     4e6:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+     4e9:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+     4ec:	29 f0                	sub    %esi,%eax
+    movsl(dst, src, n/4);
+     4ee:	8d 50 03             	lea    0x3(%eax),%edx
+     4f1:	0f 49 d0             	cmovns %eax,%edx
+     4f4:	c1 fa 02             	sar    $0x2,%edx
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+     4f7:	89 7d f0             	mov    %edi,-0x10(%ebp)
+     4fa:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     4fd:	89 ce                	mov    %ecx,%esi
+     4ff:	89 d1                	mov    %edx,%ecx
+     501:	fc                   	cld
+     502:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    dst += n/4*4, src += n/4*4, n %= 4;
+     504:	c1 e2 02             	shl    $0x2,%edx
+     507:	8b 7d f0             	mov    -0x10(%ebp),%edi
+     50a:	01 d7                	add    %edx,%edi
+     50c:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     50f:	01 ca                	add    %ecx,%edx
+     511:	89 c6                	mov    %eax,%esi
+     513:	c1 fe 1f             	sar    $0x1f,%esi
+     516:	c1 ee 1e             	shr    $0x1e,%esi
+     519:	01 f0                	add    %esi,%eax
+     51b:	83 e0 03             	and    $0x3,%eax
+     51e:	29 f0                	sub    %esi,%eax
+     520:	eb 12                	jmp    534 <memmove+0x95>
+    movsbback(dst + n - 1, src + n - 1, n);
+     522:	8d 78 ff             	lea    -0x1(%eax),%edi
+     525:	8d 34 3a             	lea    (%edx,%edi,1),%esi
+     528:	01 df                	add    %ebx,%edi
+// Copy cnt bytes down from the last ones, at dst and src, to the
+// first: for overlapping moves up.
+static inline void
+movsbback(void *dst, const void *src, int cnt)
+{
+  asm volatile("std; rep movsb; cld" :
+     52a:	89 c1                	mov    %eax,%ecx
+     52c:	fd                   	std
+     52d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     52f:	fc                   	cld
+    return vdst;
+     530:	eb 09                	jmp    53b <memmove+0x9c>
+  dst = vdst;
+     532:	89 df                	mov    %ebx,%edi
+  asm volatile("cld; rep movsb" :
+     534:	89 d6                	mov    %edx,%esi
+     536:	89 c1                	mov    %eax,%ecx
+     538:	fc                   	cld
+     539:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  }
+  movsb(dst, src, n);
+  return vdst;
+}
+     53b:	89 d8                	mov    %ebx,%eax
+     53d:	83 c4 08             	add    $0x8,%esp
+     540:	5b                   	pop    %ebx
+     541:	5e                   	pop    %esi
+     542:	5f                   	pop    %edi
+     543:	5d                   	pop    %ebp
+     544:	c3                   	ret
+  dst = vdst;
+     545:	89 df                	mov    %ebx,%edi
+     547:	eb eb                	jmp    534 <memmove+0x95>
+
+00000549 <vclock_gettime>:
+
+// clock_gettime() without a system call: read the clock page
+// that the kernel maps at CLOCKPAGE (see clock.h).
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+     549:	55                   	push   %ebp
+     54a:	89 e5                	mov    %esp,%ebp
+     54c:	57                   	push   %edi
+     54d:	56                   	push   %esi
+     54e:	53                   	push   %ebx
+     54f:	83 ec 14             	sub    $0x14,%esp
+  struct clockpage *cp = (struct clockpage*)CLOCKPAGE;
+  uint seq, rem, d;
+  uint64 tsc, ns, now;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+     552:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     556:	0f 87 a3 00 00 00    	ja     5ff <vclock_gettime+0xb6>
+    return -1;
+  do {
+    seq = cp->seq;
+     55c:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+    __sync_synchronize();
+     561:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    tsc = cp->tsc;
+     566:	8b 15 10 f0 ff 7f    	mov    0x7ffff010,%edx
+     56c:	8b 1d 14 f0 ff 7f    	mov    0x7ffff014,%ebx
+    ns = cp->ns;
+     572:	8b 35 18 f0 ff 7f    	mov    0x7ffff018,%esi
+     578:	8b 3d 1c f0 ff 7f    	mov    0x7ffff01c,%edi
+    __sync_synchronize();
+     57e:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != cp->seq);
+     583:	89 c1                	mov    %eax,%ecx
+     585:	83 e1 01             	and    $0x1,%ecx
+     588:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     58b:	75 cf                	jne    55c <vclock_gettime+0x13>
+     58d:	8b 0d 00 f0 ff 7f    	mov    0x7ffff000,%ecx
+     593:	39 c1                	cmp    %eax,%ecx
+     595:	75 c5                	jne    55c <vclock_gettime+0x13>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+     597:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     59a:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     59d:	0f 31                	rdtsc
+     59f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     5a2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     5a5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  now = rdtsc();
+  // Less than a tick has passed since the update, so the delta
+  // fits in 32 bits.
+  d = now > tsc ? now - tsc : 0;
+     5a8:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     5ab:	19 d3                	sbb    %edx,%ebx
+     5ad:	73 07                	jae    5b6 <vclock_gettime+0x6d>
+     5af:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+     5b2:	29 d8                	sub    %ebx,%eax
+     5b4:	89 c1                	mov    %eax,%ecx
+  ns += ((uint64)d * cp->mult) >> cp->shift;
+     5b6:	89 c8                	mov    %ecx,%eax
+     5b8:	f7 25 04 f0 ff 7f    	mull   0x7ffff004
+     5be:	0f b6 0d 08 f0 ff 7f 	movzbl 0x7ffff008,%ecx
+     5c5:	0f ad d0             	shrd   %cl,%edx,%eax
+     5c8:	d3 ea                	shr    %cl,%edx
+     5ca:	f6 c1 20             	test   $0x20,%cl
+     5cd:	74 04                	je     5d3 <vclock_gettime+0x8a>
+     5cf:	89 d0                	mov    %edx,%eax
+     5d1:	31 d2                	xor    %edx,%edx
+     5d3:	01 f0                	add    %esi,%eax
+     5d5:	11 fa                	adc    %edi,%edx
+static inline uint
+divl(uint64 n, uint d, uint *r)
+{
+  uint q;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (*r) :
+     5d7:	bb 00 ca 9a 3b       	mov    $0x3b9aca00,%ebx
+     5dc:	f7 f3                	div    %ebx
+  ts->tv_sec = divl(ns, 1000000000, &rem);
+     5de:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     5e1:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = rem;
+     5e3:	89 57 04             	mov    %edx,0x4(%edi)
+  if(clk == CLOCK_REALTIME)
+     5e6:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     5ea:	75 1a                	jne    606 <vclock_gettime+0xbd>
+    ts->tv_sec += cp->boottime;
+     5ec:	03 05 0c f0 ff 7f    	add    0x7ffff00c,%eax
+     5f2:	89 07                	mov    %eax,(%edi)
+  return 0;
+     5f4:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     5f7:	83 c4 14             	add    $0x14,%esp
+     5fa:	5b                   	pop    %ebx
+     5fb:	5e                   	pop    %esi
+     5fc:	5f                   	pop    %edi
+     5fd:	5d                   	pop    %ebp
+     5fe:	c3                   	ret
+    return -1;
+     5ff:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     604:	eb f1                	jmp    5f7 <vclock_gettime+0xae>
+  return 0;
+     606:	b8 00 00 00 00       	mov    $0x0,%eax
+     60b:	eb ea                	jmp    5f7 <vclock_gettime+0xae>
+
+0000060d <flush>:
+
+// Write out fd's buffer, or with fd < 0 every buffer.
+// Returns -1 if a write fails.
+int
+flush(int fd)
+{
+     60d:	55                   	push   %ebp
+     60e:	89 e5                	mov    %esp,%ebp
+     610:	56                   	push   %esi
+     611:	53                   	push   %ebx
+     612:	8b 45 08             	mov    0x8(%ebp),%eax
+  int r, n;
+
+  if(fd < 0){
+     615:	85 c0                	test   %eax,%eax
+     617:	78 5d                	js     676 <flush+0x69>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+      if(flush(fd) < 0)
+        r = -1;
+    return r;
+  }
+  if(fd >= NOBUF || (n = obuf[fd].n) == 0)
+     619:	83 f8 0f             	cmp    $0xf,%eax
+     61c:	7f 64                	jg     682 <flush+0x75>
+     61e:	69 d0 08 02 00 00    	imul   $0x208,%eax,%edx
+     624:	8b b2 64 20 00 00    	mov    0x2064(%edx),%esi
+     62a:	85 f6                	test   %esi,%esi
+     62c:	74 59                	je     687 <flush+0x7a>
+    return 0;
+  obuf[fd].n = 0;
+     62e:	c7 82 64 20 00 00 00 	movl   $0x0,0x2064(%edx)
+     635:	00 00 00 
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     638:	81 c2 68 20 00 00    	add    $0x2068,%edx
+     63e:	83 ec 04             	sub    $0x4,%esp
+     641:	56                   	push   %esi
+     642:	52                   	push   %edx
+     643:	50                   	push   %eax
+     644:	e8 5a 03 00 00       	call   9a3 <write>
+     649:	83 c4 10             	add    $0x10,%esp
+     64c:	39 f0                	cmp    %esi,%eax
+     64e:	75 40                	jne    690 <flush+0x83>
+     650:	be 00 00 00 00       	mov    $0x0,%esi
+     655:	eb 30                	jmp    687 <flush+0x7a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     657:	83 c3 01             	add    $0x1,%ebx
+     65a:	83 fb 0f             	cmp    $0xf,%ebx
+     65d:	7f 28                	jg     687 <flush+0x7a>
+      if(flush(fd) < 0)
+     65f:	83 ec 0c             	sub    $0xc,%esp
+     662:	53                   	push   %ebx
+     663:	e8 a5 ff ff ff       	call   60d <flush>
+     668:	83 c4 10             	add    $0x10,%esp
+     66b:	85 c0                	test   %eax,%eax
+     66d:	79 e8                	jns    657 <flush+0x4a>
+        r = -1;
+     66f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     674:	eb e1                	jmp    657 <flush+0x4a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     676:	be 00 00 00 00       	mov    $0x0,%esi
+     67b:	bb 00 00 00 00       	mov    $0x0,%ebx
+     680:	eb d8                	jmp    65a <flush+0x4d>
+    return 0;
+     682:	be 00 00 00 00       	mov    $0x0,%esi
+}
+     687:	89 f0                	mov    %esi,%eax
+     689:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     68c:	5b                   	pop    %ebx
+     68d:	5e                   	pop    %esi
+     68e:	5d                   	pop    %ebp
+     68f:	c3                   	ret
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     690:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     695:	eb f0                	jmp    687 <flush+0x7a>
+
+00000697 <bufreset>:
+
+static void
+bufreset(int fd)
+{
+  if(fd >= 0 && fd < NOBUF){
+     697:	83 f8 0f             	cmp    $0xf,%eax
+     69a:	76 01                	jbe    69d <bufreset+0x6>
+     69c:	c3                   	ret
+{
+     69d:	55                   	push   %ebp
+     69e:	89 e5                	mov    %esp,%ebp
+     6a0:	53                   	push   %ebx
+     6a1:	83 ec 10             	sub    $0x10,%esp
+     6a4:	89 c3                	mov    %eax,%ebx
+    flush(fd);
+     6a6:	50                   	push   %eax
+     6a7:	e8 61 ff ff ff       	call   60d <flush>
+    obuf[fd].mode = BUNKNOWN;
+     6ac:	69 db 08 02 00 00    	imul   $0x208,%ebx,%ebx
+     6b2:	c7 83 60 20 00 00 00 	movl   $0x0,0x2060(%ebx)
+     6b9:	00 00 00 
+     6bc:	83 c4 10             	add    $0x10,%esp
+  }
+}
+     6bf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6c2:	c9                   	leave
+     6c3:	c3                   	ret
+
+000006c4 <bufwrite>:
+
+// Write n bytes from p to fd, through its buffer.
+// Returns n, or -1 if a write fails.
+int
+bufwrite(int fd, const void *p, int n)
+{
+     6c4:	55                   	push   %ebp
+     6c5:	89 e5                	mov    %esp,%ebp
+     6c7:	57                   	push   %edi
+     6c8:	56                   	push   %esi
+     6c9:	53                   	push   %ebx
+     6ca:	83 ec 3c             	sub    $0x3c,%esp
+     6cd:	8b 75 08             	mov    0x8(%ebp),%esi
+     6d0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct stat st;
+  const char *s;
+  int i;
+
+  if(fd < 0 || fd >= NOBUF)
+     6d3:	83 fe 0f             	cmp    $0xf,%esi
+     6d6:	0f 87 a2 00 00 00    	ja     77e <bufwrite+0xba>
+    return write(fd, p, n);
+  if(obuf[fd].mode == BUNKNOWN){
+     6dc:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     6e2:	83 b8 60 20 00 00 00 	cmpl   $0x0,0x2060(%eax)
+     6e9:	75 19                	jne    704 <bufwrite+0x40>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     6eb:	83 fe 02             	cmp    $0x2,%esi
+     6ee:	0f 85 9c 00 00 00    	jne    790 <bufwrite+0xcc>
+      obuf[fd].mode = BNONE;
+     6f4:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     6fa:	c7 80 60 20 00 00 01 	movl   $0x1,0x2060(%eax)
+     701:	00 00 00 
+    else
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+  }
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     704:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     70a:	89 da                	mov    %ebx,%edx
+     70c:	03 90 64 20 00 00    	add    0x2064(%eax),%edx
+     712:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+     718:	0f 8f ae 00 00 00    	jg     7cc <bufwrite+0x108>
+    return -1;
+  if(n >= OBUFSZ)
+     71e:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+     724:	0f 8f bd 00 00 00    	jg     7e7 <bufwrite+0x123>
+    return write(fd, p, n);
+  memmove(obuf[fd].buf + obuf[fd].n, p, n);
+     72a:	69 d6 08 02 00 00    	imul   $0x208,%esi,%edx
+     730:	8d ba 60 20 00 00    	lea    0x2060(%edx),%edi
+     736:	8b 82 64 20 00 00    	mov    0x2064(%edx),%eax
+     73c:	83 ec 04             	sub    $0x4,%esp
+     73f:	53                   	push   %ebx
+     740:	ff 75 0c             	push   0xc(%ebp)
+     743:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     746:	8d 84 10 68 20 00 00 	lea    0x2068(%eax,%edx,1),%eax
+     74d:	50                   	push   %eax
+     74e:	e8 4c fd ff ff       	call   49f <memmove>
+  obuf[fd].n += n;
+     753:	01 5f 04             	add    %ebx,0x4(%edi)
+  if(obuf[fd].mode == BNONE)
+     756:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     759:	8b 82 60 20 00 00    	mov    0x2060(%edx),%eax
+     75f:	83 c4 10             	add    $0x10,%esp
+     762:	83 f8 01             	cmp    $0x1,%eax
+     765:	0f 84 91 00 00 00    	je     7fc <bufwrite+0x138>
+    return flush(fd) < 0 ? -1 : n;
+  if(obuf[fd].mode == BLINE)
+     76b:	83 f8 02             	cmp    $0x2,%eax
+     76e:	0f 84 ca 00 00 00    	je     83e <bufwrite+0x17a>
+    for(s = p, i = 0; i < n; i++)
+      if(s[i] == '\n')
+        return flush(fd) < 0 ? -1 : n;
+  return n;
+     774:	89 d8                	mov    %ebx,%eax
+}
+     776:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     779:	5b                   	pop    %ebx
+     77a:	5e                   	pop    %esi
+     77b:	5f                   	pop    %edi
+     77c:	5d                   	pop    %ebp
+     77d:	c3                   	ret
+    return write(fd, p, n);
+     77e:	83 ec 04             	sub    $0x4,%esp
+     781:	53                   	push   %ebx
+     782:	ff 75 0c             	push   0xc(%ebp)
+     785:	56                   	push   %esi
+     786:	e8 18 02 00 00       	call   9a3 <write>
+     78b:	83 c4 10             	add    $0x10,%esp
+     78e:	eb e6                	jmp    776 <bufwrite+0xb2>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     790:	83 ec 08             	sub    $0x8,%esp
+     793:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     796:	50                   	push   %eax
+     797:	56                   	push   %esi
+     798:	e8 51 02 00 00       	call   9ee <fstat>
+     79d:	83 c4 10             	add    $0x10,%esp
+     7a0:	85 c0                	test   %eax,%eax
+     7a2:	0f 88 4c ff ff ff    	js     6f4 <bufwrite+0x30>
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+     7a8:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     7ad:	74 16                	je     7c5 <bufwrite+0x101>
+     7af:	ba 03 00 00 00       	mov    $0x3,%edx
+     7b4:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     7ba:	89 90 60 20 00 00    	mov    %edx,0x2060(%eax)
+     7c0:	e9 3f ff ff ff       	jmp    704 <bufwrite+0x40>
+     7c5:	ba 02 00 00 00       	mov    $0x2,%edx
+     7ca:	eb e8                	jmp    7b4 <bufwrite+0xf0>
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     7cc:	83 ec 0c             	sub    $0xc,%esp
+     7cf:	56                   	push   %esi
+     7d0:	e8 38 fe ff ff       	call   60d <flush>
+     7d5:	83 c4 10             	add    $0x10,%esp
+     7d8:	85 c0                	test   %eax,%eax
+     7da:	0f 89 3e ff ff ff    	jns    71e <bufwrite+0x5a>
+    return -1;
+     7e0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     7e5:	eb 8f                	jmp    776 <bufwrite+0xb2>
+    return write(fd, p, n);
+     7e7:	83 ec 04             	sub    $0x4,%esp
+     7ea:	53                   	push   %ebx
+     7eb:	ff 75 0c             	push   0xc(%ebp)
+     7ee:	56                   	push   %esi
+     7ef:	e8 af 01 00 00       	call   9a3 <write>
+     7f4:	83 c4 10             	add    $0x10,%esp
+     7f7:	e9 7a ff ff ff       	jmp    776 <bufwrite+0xb2>
+    return flush(fd) < 0 ? -1 : n;
+     7fc:	83 ec 0c             	sub    $0xc,%esp
+     7ff:	56                   	push   %esi
+     800:	e8 08 fe ff ff       	call   60d <flush>
+     805:	83 c4 10             	add    $0x10,%esp
+     808:	85 c0                	test   %eax,%eax
+     80a:	78 07                	js     813 <bufwrite+0x14f>
+     80c:	89 d8                	mov    %ebx,%eax
+     80e:	e9 63 ff ff ff       	jmp    776 <bufwrite+0xb2>
+     813:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     818:	e9 59 ff ff ff       	jmp    776 <bufwrite+0xb2>
+        return flush(fd) < 0 ? -1 : n;
+     81d:	83 ec 0c             	sub    $0xc,%esp
+     820:	56                   	push   %esi
+     821:	e8 e7 fd ff ff       	call   60d <flush>
+     826:	83 c4 10             	add    $0x10,%esp
+     829:	85 c0                	test   %eax,%eax
+     82b:	78 07                	js     834 <bufwrite+0x170>
+     82d:	89 d8                	mov    %ebx,%eax
+     82f:	e9 42 ff ff ff       	jmp    776 <bufwrite+0xb2>
+     834:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     839:	e9 38 ff ff ff       	jmp    776 <bufwrite+0xb2>
+    for(s = p, i = 0; i < n; i++)
+     83e:	b8 00 00 00 00       	mov    $0x0,%eax
+     843:	39 d8                	cmp    %ebx,%eax
+     845:	7d 0e                	jge    855 <bufwrite+0x191>
+      if(s[i] == '\n')
+     847:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     84a:	80 3c 01 0a          	cmpb   $0xa,(%ecx,%eax,1)
+     84e:	74 cd                	je     81d <bufwrite+0x159>
+    for(s = p, i = 0; i < n; i++)
+     850:	83 c0 01             	add    $0x1,%eax
+     853:	eb ee                	jmp    843 <bufwrite+0x17f>
+  return n;
+     855:	89 d8                	mov    %ebx,%eax
+     857:	e9 1a ff ff ff       	jmp    776 <bufwrite+0xb2>
+
+0000085c <fork>:
+
+int
+fork(void)
+{
+     85c:	55                   	push   %ebp
+     85d:	89 e5                	mov    %esp,%ebp
+     85f:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     862:	6a ff                	push   $0xffffffff
+     864:	e8 a4 fd ff ff       	call   60d <flush>
+  return _fork();
+     869:	e8 bd 00 00 00       	call   92b <_fork>
+}
+     86e:	c9                   	leave
+     86f:	c3                   	ret
+
+00000870 <exit>:
+
+int
+exit(void)
+{
+     870:	55                   	push   %ebp
+     871:	89 e5                	mov    %esp,%ebp
+     873:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     876:	6a ff                	push   $0xffffffff
+     878:	e8 90 fd ff ff       	call   60d <flush>
+  _exit();
+     87d:	e8 b8 00 00 00       	call   93a <_exit>
+
+00000882 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     882:	55                   	push   %ebp
+     883:	89 e5                	mov    %esp,%ebp
+     885:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     888:	6a ff                	push   $0xffffffff
+     88a:	e8 7e fd ff ff       	call   60d <flush>
+  return _exec(path, argv);
+     88f:	83 c4 08             	add    $0x8,%esp
+     892:	ff 75 0c             	push   0xc(%ebp)
+     895:	ff 75 08             	push   0x8(%ebp)
+     898:	e8 bb 00 00 00       	call   958 <_exec>
+}
+     89d:	c9                   	leave
+     89e:	c3                   	ret
+
+0000089f <close>:
+
+int
+close(int fd)
+{
+     89f:	55                   	push   %ebp
+     8a0:	89 e5                	mov    %esp,%ebp
+     8a2:	53                   	push   %ebx
+     8a3:	83 ec 04             	sub    $0x4,%esp
+     8a6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bufreset(fd);
+     8a9:	89 d8                	mov    %ebx,%eax
+     8ab:	e8 e7 fd ff ff       	call   697 <bufreset>
+  return _close(fd);
+     8b0:	83 ec 0c             	sub    $0xc,%esp
+     8b3:	53                   	push   %ebx
+     8b4:	e8 90 00 00 00       	call   949 <_close>
+}
+     8b9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     8bc:	c9                   	leave
+     8bd:	c3                   	ret
+
+000008be <stat>:
+{
+     8be:	55                   	push   %ebp
+     8bf:	89 e5                	mov    %esp,%ebp
+     8c1:	56                   	push   %esi
+     8c2:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     8c3:	83 ec 08             	sub    $0x8,%esp
+     8c6:	6a 00                	push   $0x0
+     8c8:	ff 75 08             	push   0x8(%ebp)
+     8cb:	e8 f1 00 00 00       	call   9c1 <open>
+  if(fd < 0)
+     8d0:	83 c4 10             	add    $0x10,%esp
+     8d3:	85 c0                	test   %eax,%eax
+     8d5:	78 24                	js     8fb <stat+0x3d>
+     8d7:	89 c3                	mov    %eax,%ebx
+  r = fstat(fd, st);
+     8d9:	83 ec 08             	sub    $0x8,%esp
+     8dc:	ff 75 0c             	push   0xc(%ebp)
+     8df:	50                   	push   %eax
+     8e0:	e8 09 01 00 00       	call   9ee <fstat>
+     8e5:	89 c6                	mov    %eax,%esi
+  close(fd);
+     8e7:	89 1c 24             	mov    %ebx,(%esp)
+     8ea:	e8 b0 ff ff ff       	call   89f <close>
+  return r;
+     8ef:	83 c4 10             	add    $0x10,%esp
+}
+     8f2:	89 f0                	mov    %esi,%eax
+     8f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     8f7:	5b                   	pop    %ebx
+     8f8:	5e                   	pop    %esi
+     8f9:	5d                   	pop    %ebp
+     8fa:	c3                   	ret
+    return -1;
+     8fb:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     900:	eb f0                	jmp    8f2 <stat+0x34>
+
+00000902 <dup2>:
+
+int
+dup2(int oldfd, int newfd)
+{
+     902:	55                   	push   %ebp
+     903:	89 e5                	mov    %esp,%ebp
+     905:	56                   	push   %esi
+     906:	53                   	push   %ebx
+     907:	8b 75 08             	mov    0x8(%ebp),%esi
+     90a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(oldfd != newfd)
+     90d:	39 de                	cmp    %ebx,%esi
+     90f:	75 11                	jne    922 <dup2+0x20>
+    bufreset(newfd);
+  return _dup2(oldfd, newfd);
+     911:	83 ec 08             	sub    $0x8,%esp
+     914:	53                   	push   %ebx
+     915:	56                   	push   %esi
+     916:	e8 4c 00 00 00       	call   967 <_dup2>
+}
+     91b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     91e:	5b                   	pop    %ebx
+     91f:	5e                   	pop    %esi
+     920:	5d                   	pop    %ebp
+     921:	c3                   	ret
+    bufreset(newfd);
+     922:	89 d8                	mov    %ebx,%eax
+     924:	e8 6e fd ff ff       	call   697 <bufreset>
+     929:	eb e6                	jmp    911 <dup2+0xf>
+
+0000092b <_fork>:
+  1: ret
+
+#define SYSCALL(name) STUB(name, SYS_ ## name)
+
+# ulib.c wraps these, to flush printf()'s buffers first.
+STUB(_fork, SYS_fork)
+     92b:	b8 01 00 00 00       	mov    $0x1,%eax
+     930:	89 e1                	mov    %esp,%ecx
+     932:	ba 39 09 00 00       	mov    $0x939,%edx
+     937:	0f 34                	sysenter
+     939:	c3                   	ret
+
+0000093a <_exit>:
+STUB(_exit, SYS_exit)
+     93a:	b8 02 00 00 00       	mov    $0x2,%eax
+     93f:	89 e1                	mov    %esp,%ecx
+     941:	ba 48 09 00 00       	mov    $0x948,%edx
+     946:	0f 34                	sysenter
+     948:	c3                   	ret
+
+00000949 <_close>:
+STUB(_close, SYS_close)
+     949:	b8 15 00 00 00       	mov    $0x15,%eax
+     94e:	89 e1                	mov    %esp,%ecx
+     950:	ba 57 09 00 00       	mov    $0x957,%edx
+     955:	0f 34                	sysenter
+     957:	c3                   	ret
+
+00000958 <_exec>:
+STUB(_exec, SYS_exec)
+     958:	b8 07 00 00 00       	mov    $0x7,%eax
+     95d:	89 e1                	mov    %esp,%ecx
+     95f:	ba 66 09 00 00       	mov    $0x966,%edx
+     964:	0f 34                	sysenter
+     966:	c3                   	ret
+
+00000967 <_dup2>:
+STUB(_dup2, SYS_dup2)
+     967:	b8 17 00 00 00       	mov    $0x17,%eax
+     96c:	89 e1                	mov    %esp,%ecx
+     96e:	ba 75 09 00 00       	mov    $0x975,%edx
+     973:	0f 34                	sysenter
+     975:	c3                   	ret
+
+00000976 <wait>:
+
+SYSCALL(wait)
+     976:	b8 03 00 00 00       	mov    $0x3,%eax
+     97b:	89 e1                	mov    %esp,%ecx
+     97d:	ba 84 09 00 00       	mov    $0x984,%edx
+     982:	0f 34                	sysenter
+     984:	c3                   	ret
+
+00000985 <pipe>:
+SYSCALL(pipe)
+     985:	b8 04 00 00 00       	mov    $0x4,%eax
+     98a:	89 e1                	mov    %esp,%ecx
+     98c:	ba 93 09 00 00       	mov    $0x993,%edx
+     991:	0f 34                	sysenter
+     993:	c3                   	ret
+
+00000994 <read>:
+SYSCALL(read)
+     994:	b8 05 00 00 00       	mov    $0x5,%eax
+     999:	89 e1                	mov    %esp,%ecx
+     99b:	ba a2 09 00 00       	mov    $0x9a2,%edx
+     9a0:	0f 34                	sysenter
+     9a2:	c3                   	ret
+
+000009a3 <write>:
+SYSCALL(write)
+     9a3:	b8 10 00 00 00       	mov    $0x10,%eax
+     9a8:	89 e1                	mov    %esp,%ecx
+     9aa:	ba b1 09 00 00       	mov    $0x9b1,%edx
+     9af:	0f 34                	sysenter
+     9b1:	c3                   	ret
+
+000009b2 <kill>:
+SYSCALL(kill)
+     9b2:	b8 06 00 00 00       	mov    $0x6,%eax
+     9b7:	89 e1                	mov    %esp,%ecx
+     9b9:	ba c0 09 00 00       	mov    $0x9c0,%edx
+     9be:	0f 34                	sysenter
+     9c0:	c3                   	ret
+
+000009c1 <open>:
+SYSCALL(open)
+     9c1:	b8 0f 00 00 00       	mov    $0xf,%eax
+     9c6:	89 e1                	mov    %esp,%ecx
+     9c8:	ba cf 09 00 00       	mov    $0x9cf,%edx
+     9cd:	0f 34                	sysenter
+     9cf:	c3                   	ret
+
+000009d0 <mknod>:
+SYSCALL(mknod)
+     9d0:	b8 11 00 00 00       	mov    $0x11,%eax
+     9d5:	89 e1                	mov    %esp,%ecx
+     9d7:	ba de 09 00 00       	mov    $0x9de,%edx
+     9dc:	0f 34                	sysenter
+     9de:	c3                   	ret
+
+000009df <unlink>:
+SYSCALL(unlink)
+     9df:	b8 12 00 00 00       	mov    $0x12,%eax
+     9e4:	89 e1                	mov    %esp,%ecx
+     9e6:	ba ed 09 00 00       	mov    $0x9ed,%edx
+     9eb:	0f 34                	sysenter
+     9ed:	c3                   	ret
+
+000009ee <fstat>:
+SYSCALL(fstat)
+     9ee:	b8 08 00 00 00       	mov    $0x8,%eax
+     9f3:	89 e1                	mov    %esp,%ecx
+     9f5:	ba fc 09 00 00       	mov    $0x9fc,%edx
+     9fa:	0f 34                	sysenter
+     9fc:	c3                   	ret
+
+000009fd <link>:
+SYSCALL(link)
+     9fd:	b8 13 00 00 00       	mov    $0x13,%eax
+     a02:	89 e1                	mov    %esp,%ecx
+     a04:	ba 0b 0a 00 00       	mov    $0xa0b,%edx
+     a09:	0f 34                	sysenter
+     a0b:	c3                   	ret
+
+00000a0c <mkdir>:
+SYSCALL(mkdir)
+     a0c:	b8 14 00 00 00       	mov    $0x14,%eax
+     a11:	89 e1                	mov    %esp,%ecx
+     a13:	ba 1a 0a 00 00       	mov    $0xa1a,%edx
+     a18:	0f 34                	sysenter
+     a1a:	c3                   	ret
+
+00000a1b <chdir>:
+SYSCALL(chdir)
+     a1b:	b8 09 00 00 00       	mov    $0x9,%eax
+     a20:	89 e1                	mov    %esp,%ecx
+     a22:	ba 29 0a 00 00       	mov    $0xa29,%edx
+     a27:	0f 34                	sysenter
+     a29:	c3                   	ret
+
+00000a2a <dup>:
+SYSCALL(dup)
+     a2a:	b8 0a 00 00 00       	mov    $0xa,%eax
+     a2f:	89 e1                	mov    %esp,%ecx
+     a31:	ba 38 0a 00 00       	mov    $0xa38,%edx
+     a36:	0f 34                	sysenter
+     a38:	c3                   	ret
+
+00000a39 <getpid>:
+SYSCALL(getpid)
+     a39:	b8 0b 00 00 00       	mov    $0xb,%eax
+     a3e:	89 e1                	mov    %esp,%ecx
+     a40:	ba 47 0a 00 00       	mov    $0xa47,%edx
+     a45:	0f 34                	sysenter
+     a47:	c3                   	ret
+
+00000a48 <sbrk>:
+SYSCALL(sbrk)
+     a48:	b8 0c 00 00 00       	mov    $0xc,%eax
+     a4d:	89 e1                	mov    %esp,%ecx
+     a4f:	ba 56 0a 00 00       	mov    $0xa56,%edx
+     a54:	0f 34                	sysenter
+     a56:	c3                   	ret
+
+00000a57 <sleep>:
+SYSCALL(sleep)
+     a57:	b8 0d 00 00 00       	mov    $0xd,%eax
+     a5c:	89 e1                	mov    %esp,%ecx
+     a5e:	ba 65 0a 00 00       	mov    $0xa65,%edx
+     a63:	0f 34                	sysenter
+     a65:	c3                   	ret
+
+00000a66 <uptime>:
+SYSCALL(uptime)
+     a66:	b8 0e 00 00 00       	mov    $0xe,%eax
+     a6b:	89 e1                	mov    %esp,%ecx
+     a6d:	ba 74 0a 00 00       	mov    $0xa74,%edx
+     a72:	0f 34                	sysenter
+     a74:	c3                   	ret
+
+00000a75 <date>:
+SYSCALL(date)
+     a75:	b8 16 00 00 00       	mov    $0x16,%eax
+     a7a:	89 e1                	mov    %esp,%ecx
+     a7c:	ba 83 0a 00 00       	mov    $0xa83,%edx
+     a81:	0f 34                	sysenter
+     a83:	c3                   	ret
+
+00000a84 <faultaround>:
+SYSCALL(faultaround)
+     a84:	b8 18 00 00 00       	mov    $0x18,%eax
+     a89:	89 e1                	mov    %esp,%ecx
+     a8b:	ba 92 0a 00 00       	mov    $0xa92,%edx
+     a90:	0f 34                	sysenter
+     a92:	c3                   	ret
+
+00000a93 <faultstat>:
+SYSCALL(faultstat)
+     a93:	b8 19 00 00 00       	mov    $0x19,%eax
+     a98:	89 e1                	mov    %esp,%ecx
+     a9a:	ba a1 0a 00 00       	mov    $0xaa1,%edx
+     a9f:	0f 34                	sysenter
+     aa1:	c3                   	ret
+
+00000aa2 <mmap>:
+SYSCALL(mmap)
+     aa2:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     aa7:	89 e1                	mov    %esp,%ecx
+     aa9:	ba b0 0a 00 00       	mov    $0xab0,%edx
+     aae:	0f 34                	sysenter
+     ab0:	c3                   	ret
+
+00000ab1 <munmap>:
+SYSCALL(munmap)
+     ab1:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     ab6:	89 e1                	mov    %esp,%ecx
+     ab8:	ba bf 0a 00 00       	mov    $0xabf,%edx
+     abd:	0f 34                	sysenter
+     abf:	c3                   	ret
+
+00000ac0 <largepages>:
+SYSCALL(largepages)
+     ac0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     ac5:	89 e1                	mov    %esp,%ecx
+     ac7:	ba ce 0a 00 00       	mov    $0xace,%edx
+     acc:	0f 34                	sysenter
+     ace:	c3                   	ret
+
+00000acf <spawn>:
+SYSCALL(spawn)
+     acf:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     ad4:	89 e1                	mov    %esp,%ecx
+     ad6:	ba dd 0a 00 00       	mov    $0xadd,%edx
+     adb:	0f 34                	sysenter
+     add:	c3                   	ret
+
+00000ade <setpriority>:
+SYSCALL(setpriority)
+     ade:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     ae3:	89 e1                	mov    %esp,%ecx
+     ae5:	ba ec 0a 00 00       	mov    $0xaec,%edx
+     aea:	0f 34                	sysenter
+     aec:	c3                   	ret
+
+00000aed <getpriority>:
+SYSCALL(getpriority)
+     aed:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     af2:	89 e1                	mov    %esp,%ecx
+     af4:	ba fb 0a 00 00       	mov    $0xafb,%edx
+     af9:	0f 34                	sysenter
+     afb:	c3                   	ret
+
+00000afc <getprocinfo>:
+SYSCALL(getprocinfo)
+     afc:	b8 20 00 00 00       	mov    $0x20,%eax
+     b01:	89 e1                	mov    %esp,%ecx
+     b03:	ba 0a 0b 00 00       	mov    $0xb0a,%edx
+     b08:	0f 34                	sysenter
+     b0a:	c3                   	ret
+
+00000b0b <getcpuinfo>:
+SYSCALL(getcpuinfo)
+     b0b:	b8 21 00 00 00       	mov    $0x21,%eax
+     b10:	89 e1                	mov    %esp,%ecx
+     b12:	ba 19 0b 00 00       	mov    $0xb19,%edx
+     b17:	0f 34                	sysenter
+     b19:	c3                   	ret
+
+00000b1a <clone>:
+SYSCALL(clone)
+     b1a:	b8 22 00 00 00       	mov    $0x22,%eax
+     b1f:	89 e1                	mov    %esp,%ecx
+     b21:	ba 28 0b 00 00       	mov    $0xb28,%edx
+     b26:	0f 34                	sysenter
+     b28:	c3                   	ret
+
+00000b29 <join>:
+SYSCALL(join)
+     b29:	b8 23 00 00 00       	mov    $0x23,%eax
+     b2e:	89 e1                	mov    %esp,%ecx
+     b30:	ba 37 0b 00 00       	mov    $0xb37,%edx
+     b35:	0f 34                	sysenter
+     b37:	c3                   	ret
+
+00000b38 <futex_wait>:
+SYSCALL(futex_wait)
+     b38:	b8 24 00 00 00       	mov    $0x24,%eax
+     b3d:	89 e1                	mov    %esp,%ecx
+     b3f:	ba 46 0b 00 00       	mov    $0xb46,%edx
+     b44:	0f 34                	sysenter
+     b46:	c3                   	ret
+
+00000b47 <futex_wake>:
+SYSCALL(futex_wake)
+     b47:	b8 25 00 00 00       	mov    $0x25,%eax
+     b4c:	89 e1                	mov    %esp,%ecx
+     b4e:	ba 55 0b 00 00       	mov    $0xb55,%edx
+     b53:	0f 34                	sysenter
+     b55:	c3                   	ret
+
+00000b56 <setaffinity>:
+SYSCALL(setaffinity)
+     b56:	b8 26 00 00 00       	mov    $0x26,%eax
+     b5b:	89 e1                	mov    %esp,%ecx
+     b5d:	ba 64 0b 00 00       	mov    $0xb64,%edx
+     b62:	0f 34                	sysenter
+     b64:	c3                   	ret
+
+00000b65 <getaffinity>:
+SYSCALL(getaffinity)
+     b65:	b8 27 00 00 00       	mov    $0x27,%eax
+     b6a:	89 e1                	mov    %esp,%ecx
+     b6c:	ba 73 0b 00 00       	mov    $0xb73,%edx
+     b71:	0f 34                	sysenter
+     b73:	c3                   	ret
+
+00000b74 <clock_gettime>:
+SYSCALL(clock_gettime)
+     b74:	b8 28 00 00 00       	mov    $0x28,%eax
+     b79:	89 e1                	mov    %esp,%ecx
+     b7b:	ba 82 0b 00 00       	mov    $0xb82,%edx
+     b80:	0f 34                	sysenter
+     b82:	c3                   	ret
+
+00000b83 <msleep>:
+SYSCALL(msleep)
+     b83:	b8 29 00 00 00       	mov    $0x29,%eax
+     b88:	89 e1                	mov    %esp,%ecx
+     b8a:	ba 91 0b 00 00       	mov    $0xb91,%edx
+     b8f:	0f 34                	sysenter
+     b91:	c3                   	ret
+
+00000b92 <lockstat>:
+SYSCALL(lockstat)
+     b92:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     b97:	89 e1                	mov    %esp,%ecx
+     b99:	ba a0 0b 00 00       	mov    $0xba0,%edx
+     b9e:	0f 34                	sysenter
+     ba0:	c3                   	ret
+
+00000ba1 <bstat>:
+SYSCALL(bstat)
+     ba1:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     ba6:	89 e1                	mov    %esp,%ecx
+     ba8:	ba af 0b 00 00       	mov    $0xbaf,%edx
+     bad:	0f 34                	sysenter
+     baf:	c3                   	ret
+
+00000bb0 <iostat>:
+SYSCALL(iostat)
+     bb0:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     bb5:	89 e1                	mov    %esp,%ecx
+     bb7:	ba be 0b 00 00       	mov    $0xbbe,%edx
+     bbc:	0f 34                	sysenter
+     bbe:	c3                   	ret
+
+00000bbf <fsync>:
+SYSCALL(fsync)
+     bbf:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     bc4:	89 e1                	mov    %esp,%ecx
+     bc6:	ba cd 0b 00 00       	mov    $0xbcd,%edx
+     bcb:	0f 34                	sysenter
+     bcd:	c3                   	ret
+
+00000bce <pread>:
+SYSCALL(pread)
+     bce:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     bd3:	89 e1                	mov    %esp,%ecx
+     bd5:	ba dc 0b 00 00       	mov    $0xbdc,%edx
+     bda:	0f 34                	sysenter
+     bdc:	c3                   	ret
+
+00000bdd <pwrite>:
+SYSCALL(pwrite)
+     bdd:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     be2:	89 e1                	mov    %esp,%ecx
+     be4:	ba eb 0b 00 00       	mov    $0xbeb,%edx
+     be9:	0f 34                	sysenter
+     beb:	c3                   	ret
+
+00000bec <readv>:
+SYSCALL(readv)
+     bec:	b8 30 00 00 00       	mov    $0x30,%eax
+     bf1:	89 e1                	mov    %esp,%ecx
+     bf3:	ba fa 0b 00 00       	mov    $0xbfa,%edx
+     bf8:	0f 34                	sysenter
+     bfa:	c3                   	ret
+
+00000bfb <writev>:
+SYSCALL(writev)
+     bfb:	b8 31 00 00 00       	mov    $0x31,%eax
+     c00:	89 e1                	mov    %esp,%ecx
+     c02:	ba 09 0c 00 00       	mov    $0xc09,%edx
+     c07:	0f 34                	sysenter
+     c09:	c3                   	ret
+
+00000c0a <sendfile>:
+SYSCALL(sendfile)
+     c0a:	b8 32 00 00 00       	mov    $0x32,%eax
+     c0f:	89 e1                	mov    %esp,%ecx
+     c11:	ba 18 0c 00 00       	mov    $0xc18,%edx
+     c16:	0f 34                	sysenter
+     c18:	c3                   	ret
+
+00000c19 <fcntl>:
+SYSCALL(fcntl)
+     c19:	b8 33 00 00 00       	mov    $0x33,%eax
+     c1e:	89 e1                	mov    %esp,%ecx
+     c20:	ba 27 0c 00 00       	mov    $0xc27,%edx
+     c25:	0f 34                	sysenter
+     c27:	c3                   	ret
+
+00000c28 <mount>:
+SYSCALL(mount)
+     c28:	b8 34 00 00 00       	mov    $0x34,%eax
+     c2d:	89 e1                	mov    %esp,%ecx
+     c2f:	ba 36 0c 00 00       	mov    $0xc36,%edx
+     c34:	0f 34                	sysenter
+     c36:	c3                   	ret
+
+00000c37 <getdents>:
+SYSCALL(getdents)
+     c37:	b8 35 00 00 00       	mov    $0x35,%eax
+     c3c:	89 e1                	mov    %esp,%ecx
+     c3e:	ba 45 0c 00 00       	mov    $0xc45,%edx
+     c43:	0f 34                	sysenter
+     c45:	c3                   	ret
+
+00000c46 <fstatat>:
+SYSCALL(fstatat)
+     c46:	b8 36 00 00 00       	mov    $0x36,%eax
+     c4b:	89 e1                	mov    %esp,%ecx
+     c4d:	ba 54 0c 00 00       	mov    $0xc54,%edx
+     c52:	0f 34                	sysenter
+     c54:	c3                   	ret
+
+00000c55 <sysstat>:
+SYSCALL(sysstat)
+     c55:	b8 37 00 00 00       	mov    $0x37,%eax
+     c5a:	89 e1                	mov    %esp,%ecx
+     c5c:	ba 63 0c 00 00       	mov    $0xc63,%edx
+     c61:	0f 34                	sysenter
+     c63:	c3                   	ret
+
+00000c64 <ringenter>:
+SYSCALL(ringenter)
+     c64:	b8 38 00 00 00       	mov    $0x38,%eax
+     c69:	89 e1                	mov    %esp,%ecx
+     c6b:	ba 72 0c 00 00       	mov    $0xc72,%edx
+     c70:	0f 34                	sysenter
+     c72:	c3                   	ret
+
+00000c73 <trace>:
+SYSCALL(trace)
+     c73:	b8 39 00 00 00       	mov    $0x39,%eax
+     c78:	89 e1                	mov    %esp,%ecx
+     c7a:	ba 81 0c 00 00       	mov    $0xc81,%edx
+     c7f:	0f 34                	sysenter
+     c81:	c3                   	ret
+
+00000c82 <memstat>:
+SYSCALL(memstat)
+     c82:	b8 3a 00 00 00       	mov    $0x3a,%eax
+     c87:	89 e1                	mov    %esp,%ecx
+     c89:	ba 90 0c 00 00       	mov    $0xc90,%edx
+     c8e:	0f 34                	sysenter
+     c90:	c3                   	ret
+
+00000c91 <shmget>:
+SYSCALL(shmget)
+     c91:	b8 3b 00 00 00       	mov    $0x3b,%eax
+     c96:	89 e1                	mov    %esp,%ecx
+     c98:	ba 9f 0c 00 00       	mov    $0xc9f,%edx
+     c9d:	0f 34                	sysenter
+     c9f:	c3                   	ret
+
+00000ca0 <shmat>:
+SYSCALL(shmat)
+     ca0:	b8 3c 00 00 00       	mov    $0x3c,%eax
+     ca5:	89 e1                	mov    %esp,%ecx
+     ca7:	ba ae 0c 00 00       	mov    $0xcae,%edx
+     cac:	0f 34                	sysenter
+     cae:	c3                   	ret
+
+00000caf <shmdt>:
+SYSCALL(shmdt)
+     caf:	b8 3d 00 00 00       	mov    $0x3d,%eax
+     cb4:	89 e1                	mov    %esp,%ecx
+     cb6:	ba bd 0c 00 00       	mov    $0xcbd,%edx
+     cbb:	0f 34                	sysenter
+     cbd:	c3                   	ret
+
+00000cbe <irqstat>:
+SYSCALL(irqstat)
+     cbe:	b8 3e 00 00 00       	mov    $0x3e,%eax
+     cc3:	89 e1                	mov    %esp,%ecx
+     cc5:	ba cc 0c 00 00       	mov    $0xccc,%edx
+     cca:	0f 34                	sysenter
+     ccc:	c3                   	ret
+
+00000ccd <irqroute>:
+SYSCALL(irqroute)
+     ccd:	b8 3f 00 00 00       	mov    $0x3f,%eax
+     cd2:	89 e1                	mov    %esp,%ecx
+     cd4:	ba db 0c 00 00       	mov    $0xcdb,%edx
+     cd9:	0f 34                	sysenter
+     cdb:	c3                   	ret
+
+00000cdc <putc>:
+  char buf[64];
+};
+
+static void
+putc(struct out *o, char c)
+{
+     cdc:	55                   	push   %ebp
+     cdd:	89 e5                	mov    %esp,%ebp
+     cdf:	56                   	push   %esi
+     ce0:	53                   	push   %ebx
+     ce1:	89 c3                	mov    %eax,%ebx
+     ce3:	89 d6                	mov    %edx,%esi
+  if(o->n == sizeof(o->buf)){
+     ce5:	8b 40 04             	mov    0x4(%eax),%eax
+     ce8:	83 f8 40             	cmp    $0x40,%eax
+     ceb:	74 16                	je     d03 <putc+0x27>
+    bufwrite(o->fd, o->buf, o->n);
+    o->n = 0;
+  }
+  o->buf[o->n++] = c;
+     ced:	8b 43 04             	mov    0x4(%ebx),%eax
+     cf0:	8d 50 01             	lea    0x1(%eax),%edx
+     cf3:	89 53 04             	mov    %edx,0x4(%ebx)
+     cf6:	89 f1                	mov    %esi,%ecx
+     cf8:	88 4c 03 08          	mov    %cl,0x8(%ebx,%eax,1)
+}
+     cfc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     cff:	5b                   	pop    %ebx
+     d00:	5e                   	pop    %esi
+     d01:	5d                   	pop    %ebp
+     d02:	c3                   	ret
+    bufwrite(o->fd, o->buf, o->n);
+     d03:	8d 53 08             	lea    0x8(%ebx),%edx
+     d06:	83 ec 04             	sub    $0x4,%esp
+     d09:	50                   	push   %eax
+     d0a:	52                   	push   %edx
+     d0b:	ff 33                	push   (%ebx)
+     d0d:	e8 b2 f9 ff ff       	call   6c4 <bufwrite>
+    o->n = 0;
+     d12:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     d19:	83 c4 10             	add    $0x10,%esp
+     d1c:	eb cf                	jmp    ced <putc+0x11>
+
+00000d1e <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     d1e:	55                   	push   %ebp
+     d1f:	89 e5                	mov    %esp,%ebp
+     d21:	57                   	push   %edi
+     d22:	56                   	push   %esi
+     d23:	53                   	push   %ebx
+     d24:	83 ec 2c             	sub    $0x2c,%esp
+     d27:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     d2a:	89 d0                	mov    %edx,%eax
+     d2c:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+     d2e:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     d32:	0f 95 c1             	setne  %cl
+     d35:	c1 ea 1f             	shr    $0x1f,%edx
+     d38:	84 d1                	test   %dl,%cl
+     d3a:	74 44                	je     d80 <printint+0x62>
+    neg = 1;
+    x = -xx;
+     d3c:	f7 d8                	neg    %eax
+     d3e:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+     d40:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     d47:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+     d4c:	89 c8                	mov    %ecx,%eax
+     d4e:	ba 00 00 00 00       	mov    $0x0,%edx
+     d53:	f7 f6                	div    %esi
+     d55:	89 df                	mov    %ebx,%edi
+     d57:	83 c3 01             	add    $0x1,%ebx
+     d5a:	0f b6 92 80 15 00 00 	movzbl 0x1580(%edx),%edx
+     d61:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+     d65:	89 ca                	mov    %ecx,%edx
+     d67:	89 c1                	mov    %eax,%ecx
+     d69:	39 f2                	cmp    %esi,%edx
+     d6b:	73 df                	jae    d4c <printint+0x2e>
+  if(neg)
+     d6d:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     d71:	74 31                	je     da4 <printint+0x86>
+    buf[i++] = '-';
+     d73:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+     d78:	8d 5f 02             	lea    0x2(%edi),%ebx
+     d7b:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     d7e:	eb 17                	jmp    d97 <printint+0x79>
+    x = xx;
+     d80:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+     d82:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     d89:	eb bc                	jmp    d47 <printint+0x29>
+
+  while(--i >= 0)
+    putc(o, buf[i]);
+     d8b:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+     d90:	89 f0                	mov    %esi,%eax
+     d92:	e8 45 ff ff ff       	call   cdc <putc>
+  while(--i >= 0)
+     d97:	83 eb 01             	sub    $0x1,%ebx
+     d9a:	79 ef                	jns    d8b <printint+0x6d>
+}
+     d9c:	83 c4 2c             	add    $0x2c,%esp
+     d9f:	5b                   	pop    %ebx
+     da0:	5e                   	pop    %esi
+     da1:	5f                   	pop    %edi
+     da2:	5d                   	pop    %ebp
+     da3:	c3                   	ret
+     da4:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     da7:	eb ee                	jmp    d97 <printint+0x79>
+
+00000da9 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     da9:	55                   	push   %ebp
+     daa:	89 e5                	mov    %esp,%ebp
+     dac:	57                   	push   %edi
+     dad:	56                   	push   %esi
+     dae:	53                   	push   %ebx
+     daf:	83 ec 6c             	sub    $0x6c,%esp
+  int c, i, state;
+  uint *ap;
+  struct out out, *o;
+
+  o = &out;
+  o->fd = fd;
+     db2:	8b 45 08             	mov    0x8(%ebp),%eax
+     db5:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  o->n = 0;
+     db8:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+     dbf:	8d 45 10             	lea    0x10(%ebp),%eax
+     dc2:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  state = 0;
+     dc5:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+     dca:	bb 00 00 00 00       	mov    $0x0,%ebx
+     dcf:	eb 14                	jmp    de5 <printf+0x3c>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(o, c);
+     dd1:	89 fa                	mov    %edi,%edx
+     dd3:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     dd6:	e8 01 ff ff ff       	call   cdc <putc>
+     ddb:	eb 05                	jmp    de2 <printf+0x39>
+      }
+    } else if(state == '%'){
+     ddd:	83 fe 25             	cmp    $0x25,%esi
+     de0:	74 25                	je     e07 <printf+0x5e>
+  for(i = 0; fmt[i]; i++){
+     de2:	83 c3 01             	add    $0x1,%ebx
+     de5:	8b 45 0c             	mov    0xc(%ebp),%eax
+     de8:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+     dec:	84 c0                	test   %al,%al
+     dee:	0f 84 20 01 00 00    	je     f14 <printf+0x16b>
+    c = fmt[i] & 0xff;
+     df4:	0f be f8             	movsbl %al,%edi
+     df7:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     dfa:	85 f6                	test   %esi,%esi
+     dfc:	75 df                	jne    ddd <printf+0x34>
+      if(c == '%'){
+     dfe:	83 f8 25             	cmp    $0x25,%eax
+     e01:	75 ce                	jne    dd1 <printf+0x28>
+        state = '%';
+     e03:	89 c6                	mov    %eax,%esi
+     e05:	eb db                	jmp    de2 <printf+0x39>
+      if(c == 'd'){
+     e07:	83 f8 25             	cmp    $0x25,%eax
+     e0a:	0f 84 cf 00 00 00    	je     edf <printf+0x136>
+     e10:	0f 8c dd 00 00 00    	jl     ef3 <printf+0x14a>
+     e16:	83 f8 78             	cmp    $0x78,%eax
+     e19:	0f 8f d4 00 00 00    	jg     ef3 <printf+0x14a>
+     e1f:	83 f8 63             	cmp    $0x63,%eax
+     e22:	0f 8c cb 00 00 00    	jl     ef3 <printf+0x14a>
+     e28:	83 e8 63             	sub    $0x63,%eax
+     e2b:	83 f8 15             	cmp    $0x15,%eax
+     e2e:	0f 87 bf 00 00 00    	ja     ef3 <printf+0x14a>
+     e34:	ff 24 85 28 15 00 00 	jmp    *0x1528(,%eax,4)
+        printint(o, *ap, 10, 1);
+     e3b:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     e3e:	8b 17                	mov    (%edi),%edx
+     e40:	83 ec 0c             	sub    $0xc,%esp
+     e43:	6a 01                	push   $0x1
+     e45:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     e4a:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     e4d:	e8 cc fe ff ff       	call   d1e <printint>
+        ap++;
+     e52:	83 c7 04             	add    $0x4,%edi
+     e55:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     e58:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(o, '%');
+        putc(o, c);
+      }
+      state = 0;
+     e5b:	be 00 00 00 00       	mov    $0x0,%esi
+     e60:	eb 80                	jmp    de2 <printf+0x39>
+        printint(o, *ap, 16, 0);
+     e62:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     e65:	8b 17                	mov    (%edi),%edx
+     e67:	83 ec 0c             	sub    $0xc,%esp
+     e6a:	6a 00                	push   $0x0
+     e6c:	b9 10 00 00 00       	mov    $0x10,%ecx
+     e71:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     e74:	e8 a5 fe ff ff       	call   d1e <printint>
+        ap++;
+     e79:	83 c7 04             	add    $0x4,%edi
+     e7c:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     e7f:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     e82:	be 00 00 00 00       	mov    $0x0,%esi
+     e87:	e9 56 ff ff ff       	jmp    de2 <printf+0x39>
+        s = (char*)*ap;
+     e8c:	8b 45 94             	mov    -0x6c(%ebp),%eax
+     e8f:	8b 30                	mov    (%eax),%esi
+        ap++;
+     e91:	83 c0 04             	add    $0x4,%eax
+     e94:	89 45 94             	mov    %eax,-0x6c(%ebp)
+        if(s == 0)
+     e97:	85 f6                	test   %esi,%esi
+     e99:	75 15                	jne    eb0 <printf+0x107>
+          s = "(null)";
+     e9b:	be 20 15 00 00       	mov    $0x1520,%esi
+     ea0:	eb 0e                	jmp    eb0 <printf+0x107>
+          putc(o, *s);
+     ea2:	0f be d2             	movsbl %dl,%edx
+     ea5:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     ea8:	e8 2f fe ff ff       	call   cdc <putc>
+          s++;
+     ead:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+     eb0:	0f b6 16             	movzbl (%esi),%edx
+     eb3:	84 d2                	test   %dl,%dl
+     eb5:	75 eb                	jne    ea2 <printf+0xf9>
+      state = 0;
+     eb7:	be 00 00 00 00       	mov    $0x0,%esi
+     ebc:	e9 21 ff ff ff       	jmp    de2 <printf+0x39>
+        putc(o, *ap);
+     ec1:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     ec4:	0f be 17             	movsbl (%edi),%edx
+     ec7:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     eca:	e8 0d fe ff ff       	call   cdc <putc>
+        ap++;
+     ecf:	83 c7 04             	add    $0x4,%edi
+     ed2:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+      state = 0;
+     ed5:	be 00 00 00 00       	mov    $0x0,%esi
+     eda:	e9 03 ff ff ff       	jmp    de2 <printf+0x39>
+        putc(o, c);
+     edf:	89 fa                	mov    %edi,%edx
+     ee1:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     ee4:	e8 f3 fd ff ff       	call   cdc <putc>
+      state = 0;
+     ee9:	be 00 00 00 00       	mov    $0x0,%esi
+     eee:	e9 ef fe ff ff       	jmp    de2 <printf+0x39>
+        putc(o, '%');
+     ef3:	ba 25 00 00 00       	mov    $0x25,%edx
+     ef8:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     efb:	e8 dc fd ff ff       	call   cdc <putc>
+        putc(o, c);
+     f00:	89 fa                	mov    %edi,%edx
+     f02:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     f05:	e8 d2 fd ff ff       	call   cdc <putc>
+      state = 0;
+     f0a:	be 00 00 00 00       	mov    $0x0,%esi
+     f0f:	e9 ce fe ff ff       	jmp    de2 <printf+0x39>
+    }
+  }
+  if(o->n > 0)
+     f14:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     f17:	85 c0                	test   %eax,%eax
+     f19:	7f 08                	jg     f23 <printf+0x17a>
+    bufwrite(fd, o->buf, o->n);
+}
+     f1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f1e:	5b                   	pop    %ebx
+     f1f:	5e                   	pop    %esi
+     f20:	5f                   	pop    %edi
+     f21:	5d                   	pop    %ebp
+     f22:	c3                   	ret
+    bufwrite(fd, o->buf, o->n);
+     f23:	83 ec 04             	sub    $0x4,%esp
+     f26:	50                   	push   %eax
+     f27:	8d 45 a8             	lea    -0x58(%ebp),%eax
+     f2a:	50                   	push   %eax
+     f2b:	ff 75 08             	push   0x8(%ebp)
+     f2e:	e8 91 f7 ff ff       	call   6c4 <bufwrite>
+     f33:	83 c4 10             	add    $0x10,%esp
+}
+     f36:	eb e3                	jmp    f1b <printf+0x172>
+
+00000f38 <largefree>:
+  return &b->h;
+}
+
+static void
+largefree(Fblock *b)
+{
+     f38:	55                   	push   %ebp
+     f39:	89 e5                	mov    %esp,%ebp
+     f3b:	57                   	push   %edi
+     f3c:	56                   	push   %esi
+     f3d:	53                   	push   %ebx
+     f3e:	83 ec 0c             	sub    $0xc,%esp
+     f41:	89 c1                	mov    %eax,%ecx
+  Fblock **pp, *p, *prev;
+
+  prev = 0;
+     f43:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     f48:	ba ec 40 00 00       	mov    $0x40ec,%edx
+     f4d:	eb 05                	jmp    f54 <largefree+0x1c>
+     f4f:	8d 50 08             	lea    0x8(%eax),%edx
+    prev = p;
+     f52:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     f54:	8b 02                	mov    (%edx),%eax
+     f56:	85 c0                	test   %eax,%eax
+     f58:	74 04                	je     f5e <largefree+0x26>
+     f5a:	39 c8                	cmp    %ecx,%eax
+     f5c:	72 f1                	jb     f4f <largefree+0x17>
+  b->next = p;
+     f5e:	89 41 08             	mov    %eax,0x8(%ecx)
+  if(p && (char*)b + b->h.size == (char*)p){
+     f61:	85 c0                	test   %eax,%eax
+     f63:	74 09                	je     f6e <largefree+0x36>
+     f65:	8b 31                	mov    (%ecx),%esi
+     f67:	8d 3c 31             	lea    (%ecx,%esi,1),%edi
+     f6a:	39 c7                	cmp    %eax,%edi
+     f6c:	74 21                	je     f8f <largefree+0x57>
+    b->h.size += p->h.size;
+    b->next = p->next;
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+     f6e:	85 db                	test   %ebx,%ebx
+     f70:	74 09                	je     f7b <largefree+0x43>
+     f72:	8b 03                	mov    (%ebx),%eax
+     f74:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+     f77:	39 ce                	cmp    %ecx,%esi
+     f79:	74 20                	je     f9b <largefree+0x63>
+    prev->h.size += b->h.size;
+    prev->next = b->next;
+  } else
+    *pp = b;
+     f7b:	89 0a                	mov    %ecx,(%edx)
+
+  // Give the top of the heap back.  With threads sharing the
+  // address space sbrk() cannot shrink it; keep the block then.
+  for(pp = &large; (*pp)->next; pp = &(*pp)->next)
+     f7d:	be ec 40 00 00       	mov    $0x40ec,%esi
+     f82:	8b 1e                	mov    (%esi),%ebx
+     f84:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+     f88:	74 1d                	je     fa7 <largefree+0x6f>
+     f8a:	8d 73 08             	lea    0x8(%ebx),%esi
+     f8d:	eb f3                	jmp    f82 <largefree+0x4a>
+    b->h.size += p->h.size;
+     f8f:	03 30                	add    (%eax),%esi
+     f91:	89 31                	mov    %esi,(%ecx)
+    b->next = p->next;
+     f93:	8b 40 08             	mov    0x8(%eax),%eax
+     f96:	89 41 08             	mov    %eax,0x8(%ecx)
+     f99:	eb d3                	jmp    f6e <largefree+0x36>
+    prev->h.size += b->h.size;
+     f9b:	03 01                	add    (%ecx),%eax
+     f9d:	89 03                	mov    %eax,(%ebx)
+    prev->next = b->next;
+     f9f:	8b 41 08             	mov    0x8(%ecx),%eax
+     fa2:	89 43 08             	mov    %eax,0x8(%ebx)
+     fa5:	eb d6                	jmp    f7d <largefree+0x45>
+    ;
+  b = *pp;
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     fa7:	89 df                	mov    %ebx,%edi
+     fa9:	03 3b                	add    (%ebx),%edi
+     fab:	83 ec 0c             	sub    $0xc,%esp
+     fae:	6a 00                	push   $0x0
+     fb0:	e8 93 fa ff ff       	call   a48 <sbrk>
+     fb5:	83 c4 10             	add    $0x10,%esp
+     fb8:	39 c7                	cmp    %eax,%edi
+     fba:	74 08                	je     fc4 <largefree+0x8c>
+    *pp = 0;
+}
+     fbc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     fbf:	5b                   	pop    %ebx
+     fc0:	5e                   	pop    %esi
+     fc1:	5f                   	pop    %edi
+     fc2:	5d                   	pop    %ebp
+     fc3:	c3                   	ret
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     fc4:	8b 03                	mov    (%ebx),%eax
+     fc6:	f7 d8                	neg    %eax
+     fc8:	83 ec 0c             	sub    $0xc,%esp
+     fcb:	50                   	push   %eax
+     fcc:	e8 77 fa ff ff       	call   a48 <sbrk>
+     fd1:	83 c4 10             	add    $0x10,%esp
+     fd4:	83 f8 ff             	cmp    $0xffffffff,%eax
+     fd7:	74 e3                	je     fbc <largefree+0x84>
+    *pp = 0;
+     fd9:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+     fdf:	eb db                	jmp    fbc <largefree+0x84>
+
+00000fe1 <more>:
+{
+     fe1:	55                   	push   %ebp
+     fe2:	89 e5                	mov    %esp,%ebp
+     fe4:	56                   	push   %esi
+     fe5:	53                   	push   %ebx
+     fe6:	89 c6                	mov    %eax,%esi
+  pad = -(uint)sbrk(0) & 7;
+     fe8:	83 ec 0c             	sub    $0xc,%esp
+     feb:	6a 00                	push   $0x0
+     fed:	e8 56 fa ff ff       	call   a48 <sbrk>
+     ff2:	f7 d8                	neg    %eax
+     ff4:	89 c3                	mov    %eax,%ebx
+     ff6:	83 e3 07             	and    $0x7,%ebx
+  if((p = sbrk(n + pad)) == (char*)-1)
+     ff9:	01 de                	add    %ebx,%esi
+     ffb:	89 34 24             	mov    %esi,(%esp)
+     ffe:	e8 45 fa ff ff       	call   a48 <sbrk>
+    1003:	83 c4 10             	add    $0x10,%esp
+    1006:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1009:	74 09                	je     1014 <more+0x33>
+  return p + pad;
+    100b:	01 d8                	add    %ebx,%eax
+}
+    100d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1010:	5b                   	pop    %ebx
+    1011:	5e                   	pop    %esi
+    1012:	5d                   	pop    %ebp
+    1013:	c3                   	ret
+    return 0;
+    1014:	b8 00 00 00 00       	mov    $0x0,%eax
+    1019:	eb f2                	jmp    100d <more+0x2c>
+
+0000101b <slaballoc>:
+{
+    101b:	55                   	push   %ebp
+    101c:	89 e5                	mov    %esp,%ebp
+    101e:	56                   	push   %esi
+    101f:	53                   	push   %ebx
+    1020:	89 c6                	mov    %eax,%esi
+  n = 1 << (MINSHIFT + c);
+    1022:	8d 48 04             	lea    0x4(%eax),%ecx
+    1025:	bb 01 00 00 00       	mov    $0x1,%ebx
+    102a:	d3 e3                	shl    %cl,%ebx
+  if(slab + n > slabend){
+    102c:	89 d8                	mov    %ebx,%eax
+    102e:	03 05 e8 40 00 00    	add    0x40e8,%eax
+    1034:	39 05 e4 40 00 00    	cmp    %eax,0x40e4
+    103a:	72 17                	jb     1053 <slaballoc+0x38>
+  h = (Header*)slab;
+    103c:	a1 e8 40 00 00       	mov    0x40e8,%eax
+  slab += n;
+    1041:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+    1044:	89 15 e8 40 00 00    	mov    %edx,0x40e8
+  h->size = n;
+    104a:	89 18                	mov    %ebx,(%eax)
+  h->class = c;
+    104c:	89 70 04             	mov    %esi,0x4(%eax)
+}
+    104f:	5b                   	pop    %ebx
+    1050:	5e                   	pop    %esi
+    1051:	5d                   	pop    %ebp
+    1052:	c3                   	ret
+    if((p = more(SLABSZ)) == 0)
+    1053:	b8 00 40 00 00       	mov    $0x4000,%eax
+    1058:	e8 84 ff ff ff       	call   fe1 <more>
+    105d:	85 c0                	test   %eax,%eax
+    105f:	74 ee                	je     104f <slaballoc+0x34>
+    if(p != slabend)
+    1061:	39 05 e4 40 00 00    	cmp    %eax,0x40e4
+    1067:	74 05                	je     106e <slaballoc+0x53>
+      slab = p;
+    1069:	a3 e8 40 00 00       	mov    %eax,0x40e8
+    slabend = p + SLABSZ;
+    106e:	05 00 40 00 00       	add    $0x4000,%eax
+    1073:	a3 e4 40 00 00       	mov    %eax,0x40e4
+    1078:	eb c2                	jmp    103c <slaballoc+0x21>
+
+0000107a <largealloc>:
+{
+    107a:	55                   	push   %ebp
+    107b:	89 e5                	mov    %esp,%ebp
+    107d:	56                   	push   %esi
+    107e:	53                   	push   %ebx
+    107f:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+    1081:	b9 ec 40 00 00       	mov    $0x40ec,%ecx
+    1086:	8b 01                	mov    (%ecx),%eax
+    1088:	85 c0                	test   %eax,%eax
+    108a:	74 36                	je     10c2 <largealloc+0x48>
+    if(b->h.size < n)
+    108c:	8b 10                	mov    (%eax),%edx
+    108e:	39 da                	cmp    %ebx,%edx
+    1090:	72 24                	jb     10b6 <largealloc+0x3c>
+    if(b->h.size - n > SMALLMAX){
+    1092:	29 da                	sub    %ebx,%edx
+    1094:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+    109a:	76 1f                	jbe    10bb <largealloc+0x41>
+      rest = (Fblock*)((char*)b + n);
+    109c:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+      rest->h.size = b->h.size - n;
+    109f:	89 16                	mov    %edx,(%esi)
+      rest->h.class = LARGE;
+    10a1:	c7 46 04 09 00 00 00 	movl   $0x9,0x4(%esi)
+      rest->next = b->next;
+    10a8:	8b 50 08             	mov    0x8(%eax),%edx
+    10ab:	89 56 08             	mov    %edx,0x8(%esi)
+      *pp = rest;
+    10ae:	89 31                	mov    %esi,(%ecx)
+      b->h.size = n;
+    10b0:	89 18                	mov    %ebx,(%eax)
+}
+    10b2:	5b                   	pop    %ebx
+    10b3:	5e                   	pop    %esi
+    10b4:	5d                   	pop    %ebp
+    10b5:	c3                   	ret
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+    10b6:	8d 48 08             	lea    0x8(%eax),%ecx
+    10b9:	eb cb                	jmp    1086 <largealloc+0xc>
+      *pp = b->next;
+    10bb:	8b 50 08             	mov    0x8(%eax),%edx
+    10be:	89 11                	mov    %edx,(%ecx)
+    return &b->h;
+    10c0:	eb f0                	jmp    10b2 <largealloc+0x38>
+  if((b = more(n)) == 0)
+    10c2:	89 d8                	mov    %ebx,%eax
+    10c4:	e8 18 ff ff ff       	call   fe1 <more>
+    10c9:	85 c0                	test   %eax,%eax
+    10cb:	74 e5                	je     10b2 <largealloc+0x38>
+  b->h.size = n;
+    10cd:	89 18                	mov    %ebx,(%eax)
+  b->h.class = LARGE;
+    10cf:	c7 40 04 09 00 00 00 	movl   $0x9,0x4(%eax)
+  return &b->h;
+    10d6:	eb da                	jmp    10b2 <largealloc+0x38>
+
+000010d8 <free>:
+
+void
+free(void *ap)
+{
+    10d8:	55                   	push   %ebp
+    10d9:	89 e5                	mov    %esp,%ebp
+    10db:	56                   	push   %esi
+    10dc:	53                   	push   %ebx
+    10dd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+
+  if(ap == 0)
+    10e0:	85 db                	test   %ebx,%ebx
+    10e2:	74 3b                	je     111f <free+0x47>
+    return;
+  h = (Header*)ap - 1;
+    10e4:	8d 73 f8             	lea    -0x8(%ebx),%esi
+  lock_acquire(&lock);
+    10e7:	83 ec 0c             	sub    $0xc,%esp
+    10ea:	68 e0 40 00 00       	push   $0x40e0
+    10ef:	e8 9c 01 00 00       	call   1290 <lock_acquire>
+  if(h->class == LARGE)
+    10f4:	8b 43 fc             	mov    -0x4(%ebx),%eax
+    10f7:	83 c4 10             	add    $0x10,%esp
+    10fa:	83 f8 09             	cmp    $0x9,%eax
+    10fd:	74 27                	je     1126 <free+0x4e>
+    largefree((Fblock*)h);
+  else {
+    ((Fblock*)h)->next = freelist[h->class];
+    10ff:	8b 14 85 00 41 00 00 	mov    0x4100(,%eax,4),%edx
+    1106:	89 13                	mov    %edx,(%ebx)
+    freelist[h->class] = (Fblock*)h;
+    1108:	89 34 85 00 41 00 00 	mov    %esi,0x4100(,%eax,4)
+  }
+  lock_release(&lock);
+    110f:	83 ec 0c             	sub    $0xc,%esp
+    1112:	68 e0 40 00 00       	push   $0x40e0
+    1117:	e8 88 01 00 00       	call   12a4 <lock_release>
+    111c:	83 c4 10             	add    $0x10,%esp
+}
+    111f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1122:	5b                   	pop    %ebx
+    1123:	5e                   	pop    %esi
+    1124:	5d                   	pop    %ebp
+    1125:	c3                   	ret
+    largefree((Fblock*)h);
+    1126:	89 f0                	mov    %esi,%eax
+    1128:	e8 0b fe ff ff       	call   f38 <largefree>
+    112d:	eb e0                	jmp    110f <free+0x37>
+
+0000112f <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    112f:	55                   	push   %ebp
+    1130:	89 e5                	mov    %esp,%ebp
+    1132:	53                   	push   %ebx
+    1133:	83 ec 04             	sub    $0x4,%esp
+    1136:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+  uint n;
+  int c;
+
+  if(nbytes > 0x7fffffff - sizeof(Header) - 7)
+    1139:	81 fb f0 ff ff 7f    	cmp    $0x7ffffff0,%ebx
+    113f:	0f 87 8b 00 00 00    	ja     11d0 <malloc+0xa1>
+    return 0;
+  n = (nbytes + sizeof(Header) + 7) & ~7;
+    1145:	83 c3 0f             	add    $0xf,%ebx
+    1148:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(n < sizeof(Fblock))
+    114b:	83 fb 0b             	cmp    $0xb,%ebx
+    114e:	77 05                	ja     1155 <malloc+0x26>
+    n = sizeof(Fblock);
+    1150:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  lock_acquire(&lock);
+    1155:	83 ec 0c             	sub    $0xc,%esp
+    1158:	68 e0 40 00 00       	push   $0x40e0
+    115d:	e8 2e 01 00 00       	call   1290 <lock_acquire>
+  if(n <= SMALLMAX){
+    1162:	83 c4 10             	add    $0x10,%esp
+    1165:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+    116b:	77 58                	ja     11c5 <malloc+0x96>
+    for(c = 0; (1 << (MINSHIFT + c)) < n; c++)
+    116d:	ba 00 00 00 00       	mov    $0x0,%edx
+    1172:	eb 03                	jmp    1177 <malloc+0x48>
+    1174:	83 c2 01             	add    $0x1,%edx
+    1177:	8d 4a 04             	lea    0x4(%edx),%ecx
+    117a:	b8 01 00 00 00       	mov    $0x1,%eax
+    117f:	d3 e0                	shl    %cl,%eax
+    1181:	39 d8                	cmp    %ebx,%eax
+    1183:	72 ef                	jb     1174 <malloc+0x45>
+      ;
+    if(freelist[c]){
+    1185:	8b 04 95 00 41 00 00 	mov    0x4100(,%edx,4),%eax
+    118c:	85 c0                	test   %eax,%eax
+    118e:	74 2a                	je     11ba <malloc+0x8b>
+      h = &freelist[c]->h;
+    1190:	89 c3                	mov    %eax,%ebx
+      freelist[c] = freelist[c]->next;
+    1192:	8b 40 08             	mov    0x8(%eax),%eax
+    1195:	89 04 95 00 41 00 00 	mov    %eax,0x4100(,%edx,4)
+    } else
+      h = slaballoc(c);
+  } else
+    h = largealloc(n);
+  lock_release(&lock);
+    119c:	83 ec 0c             	sub    $0xc,%esp
+    119f:	68 e0 40 00 00       	push   $0x40e0
+    11a4:	e8 fb 00 00 00       	call   12a4 <lock_release>
+  return h ? (void*)(h + 1) : 0;
+    11a9:	83 c4 10             	add    $0x10,%esp
+    11ac:	85 db                	test   %ebx,%ebx
+    11ae:	74 03                	je     11b3 <malloc+0x84>
+    11b0:	83 c3 08             	add    $0x8,%ebx
+}
+    11b3:	89 d8                	mov    %ebx,%eax
+    11b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    11b8:	c9                   	leave
+    11b9:	c3                   	ret
+      h = slaballoc(c);
+    11ba:	89 d0                	mov    %edx,%eax
+    11bc:	e8 5a fe ff ff       	call   101b <slaballoc>
+    11c1:	89 c3                	mov    %eax,%ebx
+    11c3:	eb d7                	jmp    119c <malloc+0x6d>
+    h = largealloc(n);
+    11c5:	89 d8                	mov    %ebx,%eax
+    11c7:	e8 ae fe ff ff       	call   107a <largealloc>
+    11cc:	89 c3                	mov    %eax,%ebx
+    11ce:	eb cc                	jmp    119c <malloc+0x6d>
+    return 0;
+    11d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    11d5:	eb dc                	jmp    11b3 <malloc+0x84>
+
+000011d7 <tstart>:
+  void *arg;
+};
+
+static void
+tstart(void *a)
+{
+    11d7:	55                   	push   %ebp
+    11d8:	89 e5                	mov    %esp,%ebp
+    11da:	83 ec 14             	sub    $0x14,%esp
+    11dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+    11e0:	ff 70 04             	push   0x4(%eax)
+    11e3:	ff 10                	call   *(%eax)
+  exit();
+    11e5:	e8 86 f6 ff ff       	call   870 <exit>
+
+000011ea <thread_create>:
+}
+
+// Run fn(arg) in a new thread.  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    11ea:	55                   	push   %ebp
+    11eb:	89 e5                	mov    %esp,%ebp
+    11ed:	56                   	push   %esi
+    11ee:	53                   	push   %ebx
+  struct tstart *t;
+  char *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    11ef:	83 ec 0c             	sub    $0xc,%esp
+    11f2:	68 00 10 00 00       	push   $0x1000
+    11f7:	e8 33 ff ff ff       	call   112f <malloc>
+    11fc:	83 c4 10             	add    $0x10,%esp
+    11ff:	85 c0                	test   %eax,%eax
+    1201:	74 42                	je     1245 <thread_create+0x5b>
+    1203:	89 c3                	mov    %eax,%ebx
+    return -1;
+  t = (struct tstart*)stack;
+  t->fn = fn;
+    1205:	8b 45 08             	mov    0x8(%ebp),%eax
+    1208:	89 03                	mov    %eax,(%ebx)
+  t->arg = arg;
+    120a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    120d:	89 43 04             	mov    %eax,0x4(%ebx)
+  if((pid = clone(tstart, stack + TSTACK, t)) < 0)
+    1210:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    1216:	83 ec 04             	sub    $0x4,%esp
+    1219:	53                   	push   %ebx
+    121a:	50                   	push   %eax
+    121b:	68 d7 11 00 00       	push   $0x11d7
+    1220:	e8 f5 f8 ff ff       	call   b1a <clone>
+    1225:	89 c6                	mov    %eax,%esi
+    1227:	83 c4 10             	add    $0x10,%esp
+    122a:	85 c0                	test   %eax,%eax
+    122c:	78 09                	js     1237 <thread_create+0x4d>
+    free(stack);
+  return pid;
+}
+    122e:	89 f0                	mov    %esi,%eax
+    1230:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1233:	5b                   	pop    %ebx
+    1234:	5e                   	pop    %esi
+    1235:	5d                   	pop    %ebp
+    1236:	c3                   	ret
+    free(stack);
+    1237:	83 ec 0c             	sub    $0xc,%esp
+    123a:	53                   	push   %ebx
+    123b:	e8 98 fe ff ff       	call   10d8 <free>
+    1240:	83 c4 10             	add    $0x10,%esp
+    1243:	eb e9                	jmp    122e <thread_create+0x44>
+    return -1;
+    1245:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    124a:	eb e2                	jmp    122e <thread_create+0x44>
+
+0000124c <thread_join>:
+
+// Wait for one of this process's threads to exit and free its
+// stack.  Returns its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+    124c:	55                   	push   %ebp
+    124d:	89 e5                	mov    %esp,%ebp
+    124f:	53                   	push   %ebx
+    1250:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    1253:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1256:	50                   	push   %eax
+    1257:	e8 cd f8 ff ff       	call   b29 <join>
+    125c:	89 c3                	mov    %eax,%ebx
+    125e:	83 c4 10             	add    $0x10,%esp
+    1261:	85 c0                	test   %eax,%eax
+    1263:	79 07                	jns    126c <thread_join+0x20>
+    free((char*)stack - TSTACK);
+  return pid;
+}
+    1265:	89 d8                	mov    %ebx,%eax
+    1267:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    126a:	c9                   	leave
+    126b:	c3                   	ret
+    free((char*)stack - TSTACK);
+    126c:	83 ec 0c             	sub    $0xc,%esp
+    126f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1272:	2d 00 10 00 00       	sub    $0x1000,%eax
+    1277:	50                   	push   %eax
+    1278:	e8 5b fe ff ff       	call   10d8 <free>
+    127d:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    1280:	eb e3                	jmp    1265 <thread_join+0x19>
+
+00001282 <lock_init>:
+
+void
+lock_init(lock_t *lk)
+{
+    1282:	55                   	push   %ebp
+    1283:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    1285:	8b 45 08             	mov    0x8(%ebp),%eax
+    1288:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    128e:	5d                   	pop    %ebp
+    128f:	c3                   	ret
+
+00001290 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+    1290:	55                   	push   %ebp
+    1291:	89 e5                	mov    %esp,%ebp
+    1293:	8b 55 08             	mov    0x8(%ebp),%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    1296:	b8 01 00 00 00       	mov    $0x1,%eax
+    129b:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    129e:	85 c0                	test   %eax,%eax
+    12a0:	75 f4                	jne    1296 <lock_acquire+0x6>
+    ;
+}
+    12a2:	5d                   	pop    %ebp
+    12a3:	c3                   	ret
+
+000012a4 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+    12a4:	55                   	push   %ebp
+    12a5:	89 e5                	mov    %esp,%ebp
+    12a7:	8b 55 08             	mov    0x8(%ebp),%edx
+    12aa:	b8 00 00 00 00       	mov    $0x0,%eax
+    12af:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    12b2:	5d                   	pop    %ebp
+    12b3:	c3                   	ret
+
+000012b4 <mutex_init>:
+// Are Tricky": state is 0 when free, 1 when held, 2 when held and
+// others may be waiting.  Unlocking an uncontended mutex costs no
+// system call.
+void
+mutex_init(mutex_t *m)
+{
+    12b4:	55                   	push   %ebp
+    12b5:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    12b7:	8b 45 08             	mov    0x8(%ebp),%eax
+    12ba:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    12c0:	5d                   	pop    %ebp
+    12c1:	c3                   	ret
+
+000012c2 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+    12c2:	55                   	push   %ebp
+    12c3:	89 e5                	mov    %esp,%ebp
+    12c5:	53                   	push   %ebx
+    12c6:	83 ec 04             	sub    $0x4,%esp
+    12c9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    12cc:	b8 00 00 00 00       	mov    $0x0,%eax
+    12d1:	b9 01 00 00 00       	mov    $0x1,%ecx
+    12d6:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    12da:	85 c0                	test   %eax,%eax
+    12dc:	74 29                	je     1307 <mutex_lock+0x45>
+    return;
+  if(c != 2)
+    12de:	83 f8 02             	cmp    $0x2,%eax
+    12e1:	74 20                	je     1303 <mutex_lock+0x41>
+    12e3:	b8 02 00 00 00       	mov    $0x2,%eax
+    12e8:	f0 87 03             	lock xchg %eax,(%ebx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    12eb:	eb 16                	jmp    1303 <mutex_lock+0x41>
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    12ed:	83 ec 08             	sub    $0x8,%esp
+    12f0:	6a 02                	push   $0x2
+    12f2:	53                   	push   %ebx
+    12f3:	e8 40 f8 ff ff       	call   b38 <futex_wait>
+  asm volatile("lock; xchgl %0, %1" :
+    12f8:	b8 02 00 00 00       	mov    $0x2,%eax
+    12fd:	f0 87 03             	lock xchg %eax,(%ebx)
+    1300:	83 c4 10             	add    $0x10,%esp
+  while(c != 0){
+    1303:	85 c0                	test   %eax,%eax
+    1305:	75 e6                	jne    12ed <mutex_lock+0x2b>
+    c = xchg(&m->state, 2);
+  }
+}
+    1307:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    130a:	c9                   	leave
+    130b:	c3                   	ret
+
+0000130c <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+    130c:	55                   	push   %ebp
+    130d:	89 e5                	mov    %esp,%ebp
+    130f:	83 ec 08             	sub    $0x8,%esp
+    1312:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    1315:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    131a:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    131e:	83 fa 01             	cmp    $0x1,%edx
+    1321:	75 02                	jne    1325 <mutex_unlock+0x19>
+    m->state = 0;
+    futex_wake(&m->state, 1);
+  }
+}
+    1323:	c9                   	leave
+    1324:	c3                   	ret
+    m->state = 0;
+    1325:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+    132b:	83 ec 08             	sub    $0x8,%esp
+    132e:	6a 01                	push   $0x1
+    1330:	50                   	push   %eax
+    1331:	e8 11 f8 ff ff       	call   b47 <futex_wake>
+    1336:	83 c4 10             	add    $0x10,%esp
+}
+    1339:	eb e8                	jmp    1323 <mutex_unlock+0x17>
+
+0000133b <cond_init>:
+// Condition variable: waiters sleep on a sequence number that
+// every signal bumps, so a signal between the unlock and the
+// futex_wait() in cond_wait() is not lost.
+void
+cond_init(cond_t *c)
+{
+    133b:	55                   	push   %ebp
+    133c:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    133e:	8b 45 08             	mov    0x8(%ebp),%eax
+    1341:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1347:	5d                   	pop    %ebp
+    1348:	c3                   	ret
+
+00001349 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+    1349:	55                   	push   %ebp
+    134a:	89 e5                	mov    %esp,%ebp
+    134c:	57                   	push   %edi
+    134d:	56                   	push   %esi
+    134e:	53                   	push   %ebx
+    134f:	83 ec 18             	sub    $0x18,%esp
+    1352:	8b 75 08             	mov    0x8(%ebp),%esi
+    1355:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    1358:	8b 3e                	mov    (%esi),%edi
+  mutex_unlock(m);
+    135a:	53                   	push   %ebx
+    135b:	e8 ac ff ff ff       	call   130c <mutex_unlock>
+  futex_wait(&c->seq, seq);
+    1360:	83 c4 08             	add    $0x8,%esp
+    1363:	57                   	push   %edi
+    1364:	56                   	push   %esi
+    1365:	e8 ce f7 ff ff       	call   b38 <futex_wait>
+  // Others may be waiting for m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+    136a:	83 c4 10             	add    $0x10,%esp
+    136d:	eb 0e                	jmp    137d <cond_wait+0x34>
+    futex_wait(&m->state, 2);
+    136f:	83 ec 08             	sub    $0x8,%esp
+    1372:	6a 02                	push   $0x2
+    1374:	53                   	push   %ebx
+    1375:	e8 be f7 ff ff       	call   b38 <futex_wait>
+    137a:	83 c4 10             	add    $0x10,%esp
+    137d:	b8 02 00 00 00       	mov    $0x2,%eax
+    1382:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    1385:	85 c0                	test   %eax,%eax
+    1387:	75 e6                	jne    136f <cond_wait+0x26>
+}
+    1389:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    138c:	5b                   	pop    %ebx
+    138d:	5e                   	pop    %esi
+    138e:	5f                   	pop    %edi
+    138f:	5d                   	pop    %ebp
+    1390:	c3                   	ret
+
+00001391 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+    1391:	55                   	push   %ebp
+    1392:	89 e5                	mov    %esp,%ebp
+    1394:	83 ec 10             	sub    $0x10,%esp
+    1397:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    139a:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+    139e:	6a 01                	push   $0x1
+    13a0:	50                   	push   %eax
+    13a1:	e8 a1 f7 ff ff       	call   b47 <futex_wake>
+}
+    13a6:	83 c4 10             	add    $0x10,%esp
+    13a9:	c9                   	leave
+    13aa:	c3                   	ret
+
+000013ab <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+    13ab:	55                   	push   %ebp
+    13ac:	89 e5                	mov    %esp,%ebp
+    13ae:	83 ec 10             	sub    $0x10,%esp
+    13b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    13b4:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, NPROC);
+    13b8:	6a 40                	push   $0x40
+    13ba:	50                   	push   %eax
+    13bb:	e8 87 f7 ff ff       	call   b47 <futex_wake>
+}
+    13c0:	83 c4 10             	add    $0x10,%esp
+    13c3:	c9                   	leave
+    13c4:	c3                   	ret
@@ -0,0 +1,67 @@
+// irqstat: show how many interrupts of each IRQ every CPU has
+// taken, and where each device IRQ is routed now ("-" if it
+// is not enabled, or a local one like the timer).
+// "irqstat -r irq cpu" pins irq to cpu; a cpu of -1 gives it back
+// to the kernel's balancer.
+#include "types.h"
+#include "param.h"
+#include "user.h"
+#include "traps.h"
+
+static char *names[NIRQ] = {
+[IRQ_TIMER]    "timer",
+[IRQ_KBD]      "kbd",
+[IRQ_COM1]     "com1",
+[IRQ_IDE]      "ide",
+[IRQ_ERROR]    "error",
+[IRQ_RESCHED]  "resched",
+[IRQ_TLB]      "tlb",
+[IRQ_SPURIOUS] "spurious",
+};
+
+static uint n[NCPU][NIRQ];
+
+int
+main(int argc, char *argv[])
+{
+  int route[NIRQ];
+  int i, c, ncpu;
+  uint tot;
+
+  if(argc == 4 && strcmp(argv[1], "-r") == 0){
+    c = strcmp(argv[3], "-1") == 0 ? -1 : atoi(argv[3]);
+    if(irqroute(atoi(argv[2]), c) < 0)
+      printf(2, "irqstat: cannot route irq %s to cpu %s\n", argv[2], argv[3]);
+    exit();
+  }
+  if(argc > 1){
+    printf(2, "usage: irqstat [-r irq cpu]\n");
+    exit();
+  }
+  if(irqstat(-1, (uint*)route) < 0){
+    printf(2, "irqstat: failed\n");
+    exit();
+  }
+  for(ncpu = 0; ncpu < NCPU && irqstat(ncpu, n[ncpu]) == 0; ncpu++)
+    ;
+
+  printf(1, "IRQ\tNAME\tROUTE");
+  for(c = 0; c < ncpu; c++)
+    printf(1, "\tCPU%d", c);
+  printf(1, "\n");
+  for(i = 0; i < NIRQ; i++){
+    for(tot = 0, c = 0; c < ncpu; c++)
+      tot += n[c][i];
+    if(tot == 0 && route[i] < 0)
+      continue;
+    printf(1, "%d\t%s\t", i, names[i] ? names[i] : "");
+    if(route[i] < 0)
+      printf(1, "-");
+    else
+      printf(1, "%d", route[i]);
+    for(c = 0; c < ncpu; c++)
+      printf(1, "\t%d", n[c][i]);
+    printf(1, "\n");
+  }
+  exit();
+}
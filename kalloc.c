@@ -1,6 +1,7 @@
 // Physical memory allocator, intended to allocate
 // memory for user processes, kernel stacks, page table pages,
-// and pipe buffers. Allocates 4096-byte pages.
+// and pipe buffers. Allocates 4096-byte pages, and with
+// kallocn() runs of 2^order physically contiguous pages.
 
 #include "types.h"
 #include "defs.h"
@@ -8,6 +9,7 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "spinlock.h"
+#include "memstat.h"
 
 void freerange(void *vstart, void *vend);
 extern char end[]; // first address after kernel loaded from ELF file
@@ -15,23 +17,73 @@ extern char end[]; // first address after kernel loaded from ELF file
 
 struct run {
   struct run *next;
+  struct run *prev;            // Only on the buddy lists
 };
 
+// Pages shared copy-on-write after fork() are reference counted
+// (except vm.c's zeropage, which lives in the kernel image).
+// ref[] holds one count per physical page; kalloc() sets it to 1
+// and kfree() only puts a page back on the free list once the
+// count drops to zero.  The counts are updated with atomic
+// instructions so that neither path needs a global lock.
+#define PAGENO(v) (V2P(v) / PGSIZE)
+
+// Each CPU keeps a small cache of free pages in front of the
+// global free list.  A CPU whose cache is empty takes KBATCH
+// pages from the global list at once, and one whose cache grows
+// past KHIGH gives KBATCH back.  When the global list is empty
+// too, kalloc() steals half of another CPU's cache.
+// Next to it each CPU keeps up to KZERO pages that kzeroidle() has
+// already cleared while the CPU had nothing to run, so kzalloc()
+// rarely has to zero a page while someone waits for it.
+#define KBATCH 32
+#define KHIGH  (2*KBATCH)
+#define KZERO  16
+
+// Behind the caches the global pool is a buddy allocator.  A free
+// block of 2^k pages starts at a page number that is a multiple
+// of 2^k and sits on free[k]; its buddy is the block whose page
+// number differs only in bit k.  order[] marks the first page of
+// every free block with BFREE|k, so kfree() can tell in O(1)
+// whether the buddy is free too and merge the two, and the
+// doubly linked lists let it unlink the buddy in O(1).
+#define NORDER 11                  // Blocks of up to 2^10 pages (4MB)
+#define NPAGE  (PHYSTOP / PGSIZE)
+#define BFREE  0x80
+
 struct {
   struct spinlock lock;
   int use_lock;
-  struct run *freelist;
+  struct run *free[NORDER];
+  uint npage;                  // Pages on the buddy lists
+  uint ntotal;                 // Pages handed over by freerange()
+  uchar order[NPAGE];
+  ushort ref[NPAGE];
 } kmem;
 
+struct kcache {
+  struct spinlock lock;
+  struct run *freelist;
+  int nfree;
+  struct run *zerolist;        // Pre-zeroed pages (next field aside)
+  int nzero;
+} kcache[NCPU];
+
 // Initialization happens in two phases.
 // 1. main() calls kinit1() while still using entrypgdir to place just
 // the pages mapped by entrypgdir on free list.
 // 2. main() calls kinit2() with the rest of the physical pages
 // after installing a full page table that maps them on all cores.
+// Until use_lock is set every page goes to the global list; the
+// per-CPU caches fill up on demand.
 void
 kinit1(void *vstart, void *vend)
 {
+  int i;
+
   initlock(&kmem.lock, "kmem");
+  for(i = 0; i < NCPU; i++)
+    initlock(&kcache[i].lock, "kcache");
   kmem.use_lock = 0;
   freerange(vstart, vend);
 }
@@ -43,14 +95,172 @@ kinit2(void *vstart, void *vend)
   kmem.use_lock = 1;
 }
 
+static void
+blink(struct run *r, int k)
+{
+  r->prev = 0;
+  r->next = kmem.free[k];
+  if(r->next)
+    r->next->prev = r;
+  kmem.free[k] = r;
+  kmem.order[PAGENO(r)] = BFREE | k;
+  kmem.npage += 1 << k;
+}
+
+static void
+bunlink(struct run *r, int k)
+{
+  if(r->prev)
+    r->prev->next = r->next;
+  else
+    kmem.free[k] = r->next;
+  if(r->next)
+    r->next->prev = r->prev;
+  kmem.order[PAGENO(r)] = 0;
+  kmem.npage -= 1 << k;
+}
+
+// Give the block of 2^k pages at r back to the buddy lists,
+// merging it with its buddy for as long as that is free.
+// Called with kmem.lock held (or before use_lock is set).
+static void
+buddyput(struct run *r, int k)
+{
+  uint pn, bn;
+
+  pn = PAGENO(r);
+  for(; k < NORDER-1; k++){
+    bn = pn ^ (1 << k);
+    if(bn >= NPAGE || kmem.order[bn] != (BFREE | k))
+      break;
+    bunlink((struct run*)P2V(bn * PGSIZE), k);
+    pn &= ~(1 << k);
+  }
+  blink((struct run*)P2V(pn * PGSIZE), k);
+}
+
+// Hand [vstart, vend) to the buddy lists in the largest aligned
+// blocks that fit, up to 4MB, instead of a page at a time: the
+// pages are not touched, and the whole of memory takes a few dozen
+// list insertions.
 void
 freerange(void *vstart, void *vend)
 {
   char *p;
+  uint pn;
+  int k;
+
   p = (char*)PGROUNDUP((uint)vstart);
-  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
-    kfree(p);
+  while(p + PGSIZE <= (char*)vend){
+    pn = PAGENO(p);
+    for(k = NORDER-1; k > 0; k--)
+      if(pn % (1 << k) == 0 && p + (PGSIZE << k) <= (char*)vend)
+        break;
+    buddyput((struct run*)p, k);
+    kmem.ntotal += 1 << k;
+    p += PGSIZE << k;
+  }
+}
+
+// Take a block of 2^k pages off the buddy lists, splitting a
+// larger one if needed.  Returns 0 if there is none.
+// Called with kmem.lock held (or before use_lock is set).
+static struct run*
+buddyget(int k)
+{
+  struct run *r;
+  int j;
+
+  for(j = k; j < NORDER && kmem.free[j] == 0; j++)
+    ;
+  if(j == NORDER)
+    return 0;
+  r = kmem.free[j];
+  bunlink(r, j);
+  while(j > k){
+    j--;
+    blink((struct run*)((char*)r + (PGSIZE << j)), j);
+  }
+  return r;
 }
+
+// Move up to n single pages from the buddy lists to the list *to.
+// Returns the number of pages moved.  Called with kmem.lock held.
+static int
+buddyfill(struct run **to, int n)
+{
+  struct run *r;
+  int i;
+
+  for(i = 0; i < n && (r = buddyget(0)) != 0; i++){
+    r->next = *to;
+    *to = r;
+  }
+  return i;
+}
+
+// Give up to n single pages from the list *from back to the buddy
+// lists.  Returns the number of pages moved.  Called with
+// kmem.lock held.
+static int
+buddydrain(struct run **from, int n)
+{
+  struct run *r;
+  int i;
+
+  for(i = 0; i < n && (r = *from) != 0; i++){
+    *from = r->next;
+    buddyput(r, 0);
+  }
+  return i;
+}
+
+// Move up to n pages from the list *from to the list *to.
+// Returns the number of pages moved.
+static int
+movepages(struct run **from, struct run **to, int n)
+{
+  struct run *r;
+  int i;
+
+  for(i = 0; i < n && (r = *from) != 0; i++){
+    *from = r->next;
+    r->next = *to;
+    *to = r;
+  }
+  return i;
+}
+
+// Take half of some other CPU's cache into c.
+// Called with c->lock not held, interrupts off.
+static void
+steal(struct kcache *c)
+{
+  struct kcache *o;
+  struct run *got;
+  int n;
+
+  got = 0;
+  n = 0;
+  for(o = kcache; o < &kcache[NCPU] && n == 0; o++){
+    if(o == c || o->nfree + o->nzero == 0)
+      continue;
+    acquire(&o->lock);
+    n = movepages(&o->freelist, &got, (o->nfree + 1) / 2);
+    o->nfree -= n;
+    if(n == 0){
+      n = movepages(&o->zerolist, &got, (o->nzero + 1) / 2);
+      o->nzero -= n;
+    }
+    release(&o->lock);
+  }
+  if(n == 0)
+    return;
+  acquire(&c->lock);
+  c->nfree += movepages(&got, &c->freelist, n);
+  release(&c->lock);
+}
+
 //PAGEBREAK: 21
 // Free the page of physical memory pointed at by v,
 // which normally should have been returned by a
@@ -60,37 +270,289 @@ void
 kfree(char *v)
 {
   struct run *r;
+  struct kcache *c;
 
+  if(v == zeropage)
+    return;
   if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
     panic("kfree");
 
+  // Drop one reference; the page stays in use while shared.
+  if(kmem.ref[PAGENO(v)] != 0 &&
+     __sync_sub_and_fetch(&kmem.ref[PAGENO(v)], 1) != 0)
+    return;
+
   // Fill with junk to catch dangling refs.
-  memset(v, 1, PGSIZE);
+  if(KJUNK)
+    memset(v, 1, PGSIZE);
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
   r = (struct run*)v;
-  r->next = kmem.freelist;
-  kmem.freelist = r;
-  if(kmem.use_lock)
+  if(!kmem.use_lock){
+    buddyput(r, 0);
+    return;
+  }
+
+  pushcli();
+  c = &kcache[cpuid()];
+  acquire(&c->lock);
+  r->next = c->freelist;
+  c->freelist = r;
+  if(++c->nfree > KHIGH){
+    acquire(&kmem.lock);
+    c->nfree -= buddydrain(&c->freelist, KBATCH);
+    release(&kmem.lock);
+  }
+  release(&c->lock);
+  popcli();
+}
+
+// Take a page from this CPU's cache, the buddy lists, or another
+// CPU's cache.  Returns 0 if there is none.
+static struct run*
+kget(void)
+{
+  struct run *r;
+  struct kcache *c;
+
+  if(!kmem.use_lock){
+    r = buddyget(0);
+    goto out;
+  }
+
+  pushcli();
+  c = &kcache[cpuid()];
+  acquire(&c->lock);
+  if(c->freelist == 0){
+    acquire(&kmem.lock);
+    c->nfree += buddyfill(&c->freelist, KBATCH);
     release(&kmem.lock);
+  }
+  if(c->freelist == 0 && c->zerolist == 0){
+    release(&c->lock);
+    steal(c);
+    acquire(&c->lock);
+  }
+  if((r = c->freelist) != 0){
+    c->freelist = r->next;
+    c->nfree--;
+  } else if((r = c->zerolist) != 0){
+    c->zerolist = r->next;
+    c->nzero--;
+  }
+  release(&c->lock);
+  popcli();
+
+out:
+  if(r)
+    kmem.ref[PAGENO(r)] = 1;
+  return r;
 }
 
 // Allocate one 4096-byte page of physical memory.
 // Returns a pointer that the kernel can use.
 // Returns 0 if the memory cannot be allocated.
+// When memory runs out, take pages back from the buffer cache and
+// the file page cache and try again.  Neither sleeps, so this works
+// for every caller, not just the fault path.
 char*
 kalloc(void)
 {
   struct run *r;
 
-  if(kmem.use_lock)
+  while((r = kget()) == 0 && kmem.use_lock)
+    if(bshrink() == 0 && pcshrink() == 0)
+      break;
+  return (char*)r;
+}
+
+// Allocate 2^order physically contiguous pages, aligned to their
+// size.  The run counts as one page for kincref() and kfree():
+// the reference count lives in its first page.  Free it with
+// kfreen() and the same order.
+// Returns 0 if the memory cannot be allocated.
+char*
+kallocn(int order)
+{
+  struct run *r, *got;
+  struct kcache *c;
+
+  if(order == 0)
+    return kalloc();
+  if(order < 0 || order >= NORDER)
+    return 0;
+
+  acquire(&kmem.lock);
+  r = buddyget(order);
+  release(&kmem.lock);
+  if(r == 0){
+    // Pages parked in the per-CPU caches keep their buddies from
+    // merging; hand them back and try once more.  The cache locks
+    // come before kmem.lock, so collect the pages first.
+    got = 0;
+    for(c = kcache; c < &kcache[NCPU]; c++){
+      acquire(&c->lock);
+      c->nfree -= movepages(&c->freelist, &got, c->nfree);
+      release(&c->lock);
+    }
     acquire(&kmem.lock);
-  r = kmem.freelist;
-  if(r)
-    kmem.freelist = r->next;
-  if(kmem.use_lock)
+    buddydrain(&got, NPAGE);
+    r = buddyget(order);
     release(&kmem.lock);
+  }
+
+  if(r)
+    kmem.ref[PAGENO(r)] = 1;
   return (char*)r;
 }
 
+// Free a run of 2^order pages returned by kallocn(order).
+void
+kfreen(char *v, int order)
+{
+  if(order == 0){
+    kfree(v);
+    return;
+  }
+  if(order < 0 || order >= NORDER || V2P(v) % (PGSIZE << order) ||
+     v < end || V2P(v) + (PGSIZE << order) > PHYSTOP)
+    panic("kfreen");
+
+  if(__sync_sub_and_fetch(&kmem.ref[PAGENO(v)], 1) != 0)
+    return;
+
+  acquire(&kmem.lock);
+  buddyput((struct run*)v, order);
+  release(&kmem.lock);
+}
+
+// Turn the run of 2^order pages at v, from kallocn(order), into
+// 2^order pages that kfree() can free one at a time.
+void
+ksplit(char *v, int order)
+{
+  int i;
+
+  for(i = 1; i < (1 << order); i++)
+    kmem.ref[PAGENO(v) + i] = kmem.ref[PAGENO(v)];
+}
+
+// Allocate one zero-filled page, preferably one that
+// kzeroidle() has already cleared.
+// Returns 0 if the memory cannot be allocated.
+char*
+kzalloc(void)
+{
+  struct run *r;
+  struct kcache *c;
+
+  r = 0;
+  if(kmem.use_lock){
+    pushcli();
+    c = &kcache[cpuid()];
+    acquire(&c->lock);
+    if((r = c->zerolist) != 0){
+      c->zerolist = r->next;
+      c->nzero--;
+    }
+    release(&c->lock);
+    popcli();
+  }
+  if(r){
+    r->next = 0;
+    kmem.ref[PAGENO(r)] = 1;
+    return (char*)r;
+  }
+  if((r = (struct run*)kalloc()) != 0)
+    memset(r, 0, PGSIZE);
+  return (char*)r;
+}
+
+// Zero one free page for this CPU's pre-zeroed list, if it is
+// not full yet.  Called by scheduler() when it found nothing to
+// run; the memset happens without holding any lock.
+// Returns 1 if it zeroed a page, 0 if there was nothing to do.
+int
+kzeroidle(void)
+{
+  struct run *r;
+  struct kcache *c;
+
+  if(!kmem.use_lock)
+    return 0;
+  pushcli();
+  c = &kcache[cpuid()];
+  acquire(&c->lock);
+  r = 0;
+  if(c->nzero < KZERO){
+    if((r = c->freelist) != 0){
+      c->freelist = r->next;
+      c->nfree--;
+    } else {
+      acquire(&kmem.lock);
+      r = buddyget(0);
+      release(&kmem.lock);
+    }
+  }
+  release(&c->lock);
+  if(r){
+    memset(r, 0, PGSIZE);
+    acquire(&c->lock);
+    r->next = c->zerolist;
+    c->zerolist = r;
+    c->nzero++;
+    release(&c->lock);
+  }
+  popcli();
+  return r != 0;
+}
+
+// Add a reference to the allocated page v, e.g. when
+// copyuvm() shares it between parent and child.
+void
+kincref(char *v)
+{
+  if(v == zeropage)
+    return;
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+    panic("kincref");
+
+  if(__sync_fetch_and_add(&kmem.ref[PAGENO(v)], 1) < 1)
+    panic("kincref: free page");
+}
+
+// Return the number of references to page v.
+int
+krefcnt(char *v)
+{
+  return kmem.ref[PAGENO(v)];
+}
+
+// Roughly how many pages are free, counting the per-CPU caches.
+// Read without locks, for callers that only want an estimate.
+int
+kfreepages(void)
+{
+  int i, n;
+
+  n = kmem.npage;
+  for(i = 0; i < NCPU; i++)
+    n += kcache[i].nfree + kcache[i].nzero;
+  return n;
+}
+
+// Fill in *m for memstat(): a snapshot of the counters, taken
+// without locks like kfreepages().
+void
+kmemstat(struct memstat *m)
+{
+  int i;
+
+  m->total = kmem.ntotal;
+  m->free = kmem.npage;
+  m->zero = 0;
+  for(i = 0; i < NCPU; i++){
+    m->free += kcache[i].nfree + kcache[i].nzero;
+    m->zero += kcache[i].nzero;
+  }
+  m->used = m->total - m->free;
+}
@@ -0,0 +1,2747 @@
+
+_kill:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char **argv)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 08             	sub    $0x8,%esp
+      14:	8b 31                	mov    (%ecx),%esi
+      16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+      19:	83 fe 01             	cmp    $0x1,%esi
+      1c:	7e 07                	jle    25 <main+0x25>
+    printf(2, "usage: kill pid...\n");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+      1e:	bb 01 00 00 00       	mov    $0x1,%ebx
+      23:	eb 2d                	jmp    52 <main+0x52>
+    printf(2, "usage: kill pid...\n");
+      25:	83 ec 08             	sub    $0x8,%esp
+      28:	68 e8 11 00 00       	push   $0x11e8
+      2d:	6a 02                	push   $0x2
+      2f:	e8 98 0b 00 00       	call   bcc <printf>
+    exit();
+      34:	e8 5a 06 00 00       	call   693 <exit>
+    kill(atoi(argv[i]));
+      39:	83 ec 0c             	sub    $0xc,%esp
+      3c:	ff 34 9f             	push   (%edi,%ebx,4)
+      3f:	e8 4e 02 00 00       	call   292 <atoi>
+      44:	89 04 24             	mov    %eax,(%esp)
+      47:	e8 89 07 00 00       	call   7d5 <kill>
+  for(i=1; i<argc; i++)
+      4c:	83 c3 01             	add    $0x1,%ebx
+      4f:	83 c4 10             	add    $0x10,%esp
+      52:	39 f3                	cmp    %esi,%ebx
+      54:	7c e3                	jl     39 <main+0x39>
+  exit();
+      56:	e8 38 06 00 00       	call   693 <exit>
+
+0000005b <strcpy>:
+#include "memlayout.h"
+#include "clock.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+      5b:	55                   	push   %ebp
+      5c:	89 e5                	mov    %esp,%ebp
+      5e:	56                   	push   %esi
+      5f:	53                   	push   %ebx
+      60:	8b 75 08             	mov    0x8(%ebp),%esi
+      63:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+      66:	89 f0                	mov    %esi,%eax
+      68:	89 d1                	mov    %edx,%ecx
+      6a:	83 c2 01             	add    $0x1,%edx
+      6d:	89 c3                	mov    %eax,%ebx
+      6f:	83 c0 01             	add    $0x1,%eax
+      72:	0f b6 09             	movzbl (%ecx),%ecx
+      75:	88 0b                	mov    %cl,(%ebx)
+      77:	84 c9                	test   %cl,%cl
+      79:	75 ed                	jne    68 <strcpy+0xd>
+    ;
+  return os;
+}
+      7b:	89 f0                	mov    %esi,%eax
+      7d:	5b                   	pop    %ebx
+      7e:	5e                   	pop    %esi
+      7f:	5d                   	pop    %ebp
+      80:	c3                   	ret
+
+00000081 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+      81:	55                   	push   %ebp
+      82:	89 e5                	mov    %esp,%ebp
+      84:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      87:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+      8a:	eb 06                	jmp    92 <strcmp+0x11>
+    p++, q++;
+      8c:	83 c1 01             	add    $0x1,%ecx
+      8f:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+      92:	0f b6 01             	movzbl (%ecx),%eax
+      95:	84 c0                	test   %al,%al
+      97:	74 04                	je     9d <strcmp+0x1c>
+      99:	3a 02                	cmp    (%edx),%al
+      9b:	74 ef                	je     8c <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+      9d:	0f b6 c0             	movzbl %al,%eax
+      a0:	0f b6 12             	movzbl (%edx),%edx
+      a3:	29 d0                	sub    %edx,%eax
+}
+      a5:	5d                   	pop    %ebp
+      a6:	c3                   	ret
+
+000000a7 <strlen>:
+
+uint
+strlen(const char *s)
+{
+      a7:	55                   	push   %ebp
+      a8:	89 e5                	mov    %esp,%ebp
+      aa:	53                   	push   %ebx
+      ab:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  const char *p;
+  uint w;
+
+  for(p = s; (uint)p & 3; p++)
+      ae:	89 c8                	mov    %ecx,%eax
+      b0:	eb 03                	jmp    b5 <strlen+0xe>
+      b2:	83 c0 01             	add    $0x1,%eax
+      b5:	a8 03                	test   $0x3,%al
+      b7:	74 09                	je     c2 <strlen+0x1b>
+    if(*p == 0)
+      b9:	80 38 00             	cmpb   $0x0,(%eax)
+      bc:	75 f4                	jne    b2 <strlen+0xb>
+      return p - s;
+      be:	29 c8                	sub    %ecx,%eax
+      c0:	eb 25                	jmp    e7 <strlen+0x40>
+  // Then a word at a time, which never crosses into the next page:
+  // a word with a zero byte in it has one of these bits set.
+  for(;; p += 4){
+    w = *(uint*)p;
+      c2:	8b 10                	mov    (%eax),%edx
+    if((w - 0x01010101) & ~w & 0x80808080)
+      c4:	8d 9a ff fe fe fe    	lea    -0x1010101(%edx),%ebx
+      ca:	f7 d2                	not    %edx
+      cc:	21 da                	and    %ebx,%edx
+      ce:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+      d4:	75 05                	jne    db <strlen+0x34>
+  for(;; p += 4){
+      d6:	83 c0 04             	add    $0x4,%eax
+    w = *(uint*)p;
+      d9:	eb e7                	jmp    c2 <strlen+0x1b>
+      break;
+  }
+  while(*p)
+      db:	80 38 00             	cmpb   $0x0,(%eax)
+      de:	74 05                	je     e5 <strlen+0x3e>
+    p++;
+      e0:	83 c0 01             	add    $0x1,%eax
+      e3:	eb f6                	jmp    db <strlen+0x34>
+  return p - s;
+      e5:	29 c8                	sub    %ecx,%eax
+}
+      e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      ea:	c9                   	leave
+      eb:	c3                   	ret
+
+000000ec <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+      ec:	55                   	push   %ebp
+      ed:	89 e5                	mov    %esp,%ebp
+      ef:	57                   	push   %edi
+      f0:	56                   	push   %esi
+      f1:	53                   	push   %ebx
+      f2:	8b 55 10             	mov    0x10(%ebp),%edx
+  uint h;
+  char *d;
+
+  d = dst;
+  c &= 0xFF;
+      f5:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  if(n >= 16){
+      f9:	83 fa 0f             	cmp    $0xf,%edx
+      fc:	76 52                	jbe    150 <memset+0x64>
+    h = -(uint)d & 3;
+      fe:	8b 45 08             	mov    0x8(%ebp),%eax
+     101:	f7 d8                	neg    %eax
+     103:	83 e0 03             	and    $0x3,%eax
+     106:	89 c6                	mov    %eax,%esi
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     108:	8b 7d 08             	mov    0x8(%ebp),%edi
+     10b:	89 c1                	mov    %eax,%ecx
+     10d:	89 d8                	mov    %ebx,%eax
+     10f:	fc                   	cld
+     110:	f3 aa                	rep stos %al,%es:(%edi)
+    stosb(d, c, h);
+    stosl(d + h, (c<<24)|(c<<16)|(c<<8)|c, (n - h)/4);
+     112:	29 f2                	sub    %esi,%edx
+     114:	89 d1                	mov    %edx,%ecx
+     116:	c1 e9 02             	shr    $0x2,%ecx
+     119:	c1 e0 18             	shl    $0x18,%eax
+     11c:	89 df                	mov    %ebx,%edi
+     11e:	c1 e7 10             	shl    $0x10,%edi
+     121:	09 f8                	or     %edi,%eax
+     123:	89 df                	mov    %ebx,%edi
+     125:	c1 e7 08             	shl    $0x8,%edi
+     128:	09 f8                	or     %edi,%eax
+     12a:	09 d8                	or     %ebx,%eax
+     12c:	89 f7                	mov    %esi,%edi
+     12e:	03 7d 08             	add    0x8(%ebp),%edi
+}
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosl" :
+     131:	fc                   	cld
+     132:	f3 ab                	rep stos %eax,%es:(%edi)
+    d += h + (n - h)/4*4;
+     134:	89 d7                	mov    %edx,%edi
+     136:	83 e7 fc             	and    $0xfffffffc,%edi
+     139:	09 f7                	or     %esi,%edi
+     13b:	03 7d 08             	add    0x8(%ebp),%edi
+    n = (n - h)%4;
+     13e:	83 e2 03             	and    $0x3,%edx
+  asm volatile("cld; rep stosb" :
+     141:	89 d1                	mov    %edx,%ecx
+     143:	89 d8                	mov    %ebx,%eax
+     145:	fc                   	cld
+     146:	f3 aa                	rep stos %al,%es:(%edi)
+  }
+  stosb(d, c, n);
+  return dst;
+}
+     148:	8b 45 08             	mov    0x8(%ebp),%eax
+     14b:	5b                   	pop    %ebx
+     14c:	5e                   	pop    %esi
+     14d:	5f                   	pop    %edi
+     14e:	5d                   	pop    %ebp
+     14f:	c3                   	ret
+  d = dst;
+     150:	8b 7d 08             	mov    0x8(%ebp),%edi
+     153:	eb ec                	jmp    141 <memset+0x55>
+
+00000155 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     155:	55                   	push   %ebp
+     156:	89 e5                	mov    %esp,%ebp
+     158:	8b 45 08             	mov    0x8(%ebp),%eax
+     15b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     15f:	eb 03                	jmp    164 <strchr+0xf>
+     161:	83 c0 01             	add    $0x1,%eax
+     164:	0f b6 10             	movzbl (%eax),%edx
+     167:	84 d2                	test   %dl,%dl
+     169:	74 06                	je     171 <strchr+0x1c>
+    if(*s == c)
+     16b:	38 ca                	cmp    %cl,%dl
+     16d:	75 f2                	jne    161 <strchr+0xc>
+     16f:	eb 05                	jmp    176 <strchr+0x21>
+      return (char*)s;
+  return 0;
+     171:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     176:	5d                   	pop    %ebp
+     177:	c3                   	ret
+
+00000178 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     178:	55                   	push   %ebp
+     179:	89 e5                	mov    %esp,%ebp
+     17b:	56                   	push   %esi
+     17c:	53                   	push   %ebx
+     17d:	8b 55 08             	mov    0x8(%ebp),%edx
+     180:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     183:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  // A word at a time while they agree.
+  if((((uint)s1 | (uint)s2) & 3) == 0)
+     186:	89 d3                	mov    %edx,%ebx
+     188:	09 cb                	or     %ecx,%ebx
+     18a:	f6 c3 03             	test   $0x3,%bl
+     18d:	74 24                	je     1b3 <memcmp+0x3b>
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+      s1 += 4, s2 += 4;
+  while(n-- > 0){
+     18f:	8d 70 ff             	lea    -0x1(%eax),%esi
+     192:	85 c0                	test   %eax,%eax
+     194:	74 32                	je     1c8 <memcmp+0x50>
+    if(*s1 != *s2)
+     196:	0f b6 02             	movzbl (%edx),%eax
+     199:	0f b6 19             	movzbl (%ecx),%ebx
+     19c:	38 d8                	cmp    %bl,%al
+     19e:	75 20                	jne    1c0 <memcmp+0x48>
+      return *s1 - *s2;
+    s1++, s2++;
+     1a0:	83 c2 01             	add    $0x1,%edx
+     1a3:	83 c1 01             	add    $0x1,%ecx
+  while(n-- > 0){
+     1a6:	89 f0                	mov    %esi,%eax
+     1a8:	eb e5                	jmp    18f <memcmp+0x17>
+      s1 += 4, s2 += 4;
+     1aa:	83 c2 04             	add    $0x4,%edx
+     1ad:	83 c1 04             	add    $0x4,%ecx
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+     1b0:	83 e8 04             	sub    $0x4,%eax
+     1b3:	83 f8 03             	cmp    $0x3,%eax
+     1b6:	76 d7                	jbe    18f <memcmp+0x17>
+     1b8:	8b 31                	mov    (%ecx),%esi
+     1ba:	39 32                	cmp    %esi,(%edx)
+     1bc:	74 ec                	je     1aa <memcmp+0x32>
+     1be:	eb cf                	jmp    18f <memcmp+0x17>
+      return *s1 - *s2;
+     1c0:	0f b6 c0             	movzbl %al,%eax
+     1c3:	0f b6 db             	movzbl %bl,%ebx
+     1c6:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     1c8:	5b                   	pop    %ebx
+     1c9:	5e                   	pop    %esi
+     1ca:	5d                   	pop    %ebp
+     1cb:	c3                   	ret
+
+000001cc <memchr>:
+// The first c in the n bytes at v, or 0.  Once aligned, a word at
+// a time, with the word's bytes that equal c turned into zeroes
+// and those looked for.
+void*
+memchr(const void *v, int c, uint n)
+{
+     1cc:	55                   	push   %ebp
+     1cd:	89 e5                	mov    %esp,%ebp
+     1cf:	57                   	push   %edi
+     1d0:	56                   	push   %esi
+     1d1:	53                   	push   %ebx
+     1d2:	8b 45 08             	mov    0x8(%ebp),%eax
+     1d5:	8b 55 10             	mov    0x10(%ebp),%edx
+  const uchar *s;
+  uint w, rep;
+
+  s = v;
+  c = (uchar)c;
+     1d8:	0f b6 75 0c          	movzbl 0xc(%ebp),%esi
+  for(; n > 0 && ((uint)s & 3); n--, s++)
+     1dc:	eb 06                	jmp    1e4 <memchr+0x18>
+     1de:	83 ea 01             	sub    $0x1,%edx
+     1e1:	83 c0 01             	add    $0x1,%eax
+     1e4:	85 d2                	test   %edx,%edx
+     1e6:	74 0d                	je     1f5 <memchr+0x29>
+     1e8:	a8 03                	test   $0x3,%al
+     1ea:	74 09                	je     1f5 <memchr+0x29>
+    if(*s == c)
+     1ec:	0f b6 08             	movzbl (%eax),%ecx
+     1ef:	39 f1                	cmp    %esi,%ecx
+     1f1:	75 eb                	jne    1de <memchr+0x12>
+     1f3:	eb 41                	jmp    236 <memchr+0x6a>
+      return (void*)s;
+  rep = c * 0x01010101;
+     1f5:	69 fe 01 01 01 01    	imul   $0x1010101,%esi,%edi
+  for(; n >= 4; n -= 4, s += 4){
+     1fb:	eb 06                	jmp    203 <memchr+0x37>
+     1fd:	83 ea 04             	sub    $0x4,%edx
+     200:	83 c0 04             	add    $0x4,%eax
+     203:	83 fa 03             	cmp    $0x3,%edx
+     206:	76 16                	jbe    21e <memchr+0x52>
+    w = *(uint*)s ^ rep;
+     208:	89 f9                	mov    %edi,%ecx
+     20a:	33 08                	xor    (%eax),%ecx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     20c:	8d 99 ff fe fe fe    	lea    -0x1010101(%ecx),%ebx
+     212:	f7 d1                	not    %ecx
+     214:	21 cb                	and    %ecx,%ebx
+     216:	f7 c3 80 80 80 80    	test   $0x80808080,%ebx
+     21c:	74 df                	je     1fd <memchr+0x31>
+      break;
+  }
+  for(; n > 0; n--, s++)
+     21e:	85 d2                	test   %edx,%edx
+     220:	74 0f                	je     231 <memchr+0x65>
+    if(*s == c)
+     222:	0f b6 08             	movzbl (%eax),%ecx
+     225:	39 f1                	cmp    %esi,%ecx
+     227:	74 0d                	je     236 <memchr+0x6a>
+  for(; n > 0; n--, s++)
+     229:	83 ea 01             	sub    $0x1,%edx
+     22c:	83 c0 01             	add    $0x1,%eax
+     22f:	eb ed                	jmp    21e <memchr+0x52>
+      return (void*)s;
+  return 0;
+     231:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     236:	5b                   	pop    %ebx
+     237:	5e                   	pop    %esi
+     238:	5f                   	pop    %edi
+     239:	5d                   	pop    %ebp
+     23a:	c3                   	ret
+
+0000023b <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     23b:	55                   	push   %ebp
+     23c:	89 e5                	mov    %esp,%ebp
+     23e:	57                   	push   %edi
+     23f:	56                   	push   %esi
+     240:	53                   	push   %ebx
+     241:	83 ec 1c             	sub    $0x1c,%esp
+     244:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     247:	bb 00 00 00 00       	mov    $0x0,%ebx
+     24c:	89 de                	mov    %ebx,%esi
+     24e:	83 c3 01             	add    $0x1,%ebx
+     251:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     254:	7d 2e                	jge    284 <gets+0x49>
+    cc = read(0, &c, 1);
+     256:	83 ec 04             	sub    $0x4,%esp
+     259:	6a 01                	push   $0x1
+     25b:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     25e:	50                   	push   %eax
+     25f:	6a 00                	push   $0x0
+     261:	e8 51 05 00 00       	call   7b7 <read>
+    if(cc < 1)
+     266:	83 c4 10             	add    $0x10,%esp
+     269:	85 c0                	test   %eax,%eax
+     26b:	7e 17                	jle    284 <gets+0x49>
+      break;
+    buf[i++] = c;
+     26d:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     271:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+     274:	3c 0a                	cmp    $0xa,%al
+     276:	0f 94 c2             	sete   %dl
+     279:	3c 0d                	cmp    $0xd,%al
+     27b:	0f 94 c0             	sete   %al
+     27e:	08 c2                	or     %al,%dl
+     280:	74 ca                	je     24c <gets+0x11>
+    buf[i++] = c;
+     282:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+     284:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+     288:	89 f8                	mov    %edi,%eax
+     28a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     28d:	5b                   	pop    %ebx
+     28e:	5e                   	pop    %esi
+     28f:	5f                   	pop    %edi
+     290:	5d                   	pop    %ebp
+     291:	c3                   	ret
+
+00000292 <atoi>:
+  return r;
+}
+
+int
+atoi(const char *s)
+{
+     292:	55                   	push   %ebp
+     293:	89 e5                	mov    %esp,%ebp
+     295:	53                   	push   %ebx
+     296:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+     299:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+     29e:	eb 10                	jmp    2b0 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+     2a0:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+     2a3:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+     2a6:	83 c1 01             	add    $0x1,%ecx
+     2a9:	0f be c0             	movsbl %al,%eax
+     2ac:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+     2b0:	0f b6 01             	movzbl (%ecx),%eax
+     2b3:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     2b6:	80 fb 09             	cmp    $0x9,%bl
+     2b9:	76 e5                	jbe    2a0 <atoi+0xe>
+  return n;
+}
+     2bb:	89 d0                	mov    %edx,%eax
+     2bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2c0:	c9                   	leave
+     2c1:	c3                   	ret
+
+000002c2 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     2c2:	55                   	push   %ebp
+     2c3:	89 e5                	mov    %esp,%ebp
+     2c5:	57                   	push   %edi
+     2c6:	56                   	push   %esi
+     2c7:	53                   	push   %ebx
+     2c8:	83 ec 08             	sub    $0x8,%esp
+     2cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     2ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+     2d1:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *src;
+  int h;
+
+  dst = vdst;
+  src = vsrc;
+  if(n <= 0)
+     2d4:	85 c0                	test   %eax,%eax
+     2d6:	0f 8e 82 00 00 00    	jle    35e <memmove+0x9c>
+    return vdst;
+  if(src < dst && src + n > dst){
+     2dc:	39 da                	cmp    %ebx,%edx
+     2de:	73 07                	jae    2e7 <memmove+0x25>
+     2e0:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+     2e3:	39 cb                	cmp    %ecx,%ebx
+     2e5:	72 5e                	jb     345 <memmove+0x83>
+    movsbback(dst + n - 1, src + n - 1, n);
+    return vdst;
+  }
+  if(n >= 16 && (((uint)dst ^ (uint)src) & 3) == 0){
+     2e7:	83 f8 0f             	cmp    $0xf,%eax
+     2ea:	7e 69                	jle    355 <memmove+0x93>
+     2ec:	89 d9                	mov    %ebx,%ecx
+     2ee:	31 d1                	xor    %edx,%ecx
+     2f0:	f6 c1 03             	test   $0x3,%cl
+     2f3:	75 73                	jne    368 <memmove+0xa6>
+    h = -(uint)dst & 3;
+     2f5:	89 d9                	mov    %ebx,%ecx
+     2f7:	f7 d9                	neg    %ecx
+     2f9:	83 e1 03             	and    $0x3,%ecx
+}
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsb" :
+     2fc:	89 df                	mov    %ebx,%edi
+     2fe:	89 d6                	mov    %edx,%esi
+     300:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+     303:	fc                   	cld
+     304:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    movsb(dst, src, h);
+    dst += h, src += h, n -= h;
+     306:	8b 75 f0             	mov    -0x10(%ebp),%esi
+     309:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+     30c:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+     30f:	29 f0                	sub    %esi,%eax
+    movsl(dst, src, n/4);
+     311:	8d 50 03             	lea    0x3(%eax),%edx
+     314:	0f 49 d0             	cmovns %eax,%edx
+     317:	c1 fa 02             	sar    $0x2,%edx
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+     31a:	89 7d f0             	mov    %edi,-0x10(%ebp)
+     31d:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     320:	89 ce                	mov    %ecx,%esi
+     322:	89 d1                	mov    %edx,%ecx
+     324:	fc                   	cld
+     325:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    dst += n/4*4, src += n/4*4, n %= 4;
+     327:	c1 e2 02             	shl    $0x2,%edx
+     32a:	8b 7d f0             	mov    -0x10(%ebp),%edi
+     32d:	01 d7                	add    %edx,%edi
+     32f:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     332:	01 ca                	add    %ecx,%edx
+     334:	89 c6                	mov    %eax,%esi
+     336:	c1 fe 1f             	sar    $0x1f,%esi
+     339:	c1 ee 1e             	shr    $0x1e,%esi
+     33c:	01 f0                	add    %esi,%eax
+     33e:	83 e0 03             	and    $0x3,%eax
+     341:	29 f0                	sub    %esi,%eax
+     343:	eb 12                	jmp    357 <memmove+0x95>
+    movsbback(dst + n - 1, src + n - 1, n);
+     345:	8d 78 ff             	lea    -0x1(%eax),%edi
+     348:	8d 34 3a             	lea    (%edx,%edi,1),%esi
+     34b:	01 df                	add    %ebx,%edi
+// Copy cnt bytes down from the last ones, at dst and src, to the
+// first: for overlapping moves up.
+static inline void
+movsbback(void *dst, const void *src, int cnt)
+{
+  asm volatile("std; rep movsb; cld" :
+     34d:	89 c1                	mov    %eax,%ecx
+     34f:	fd                   	std
+     350:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     352:	fc                   	cld
+    return vdst;
+     353:	eb 09                	jmp    35e <memmove+0x9c>
+  dst = vdst;
+     355:	89 df                	mov    %ebx,%edi
+  asm volatile("cld; rep movsb" :
+     357:	89 d6                	mov    %edx,%esi
+     359:	89 c1                	mov    %eax,%ecx
+     35b:	fc                   	cld
+     35c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  }
+  movsb(dst, src, n);
+  return vdst;
+}
+     35e:	89 d8                	mov    %ebx,%eax
+     360:	83 c4 08             	add    $0x8,%esp
+     363:	5b                   	pop    %ebx
+     364:	5e                   	pop    %esi
+     365:	5f                   	pop    %edi
+     366:	5d                   	pop    %ebp
+     367:	c3                   	ret
+  dst = vdst;
+     368:	89 df                	mov    %ebx,%edi
+     36a:	eb eb                	jmp    357 <memmove+0x95>
+
+0000036c <vclock_gettime>:
+
+// clock_gettime() without a system call: read the clock page
+// that the kernel maps at CLOCKPAGE (see clock.h).
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+     36c:	55                   	push   %ebp
+     36d:	89 e5                	mov    %esp,%ebp
+     36f:	57                   	push   %edi
+     370:	56                   	push   %esi
+     371:	53                   	push   %ebx
+     372:	83 ec 14             	sub    $0x14,%esp
+  struct clockpage *cp = (struct clockpage*)CLOCKPAGE;
+  uint seq, rem, d;
+  uint64 tsc, ns, now;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+     375:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     379:	0f 87 a3 00 00 00    	ja     422 <vclock_gettime+0xb6>
+    return -1;
+  do {
+    seq = cp->seq;
+     37f:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+    __sync_synchronize();
+     384:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    tsc = cp->tsc;
+     389:	8b 15 10 f0 ff 7f    	mov    0x7ffff010,%edx
+     38f:	8b 1d 14 f0 ff 7f    	mov    0x7ffff014,%ebx
+    ns = cp->ns;
+     395:	8b 35 18 f0 ff 7f    	mov    0x7ffff018,%esi
+     39b:	8b 3d 1c f0 ff 7f    	mov    0x7ffff01c,%edi
+    __sync_synchronize();
+     3a1:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != cp->seq);
+     3a6:	89 c1                	mov    %eax,%ecx
+     3a8:	83 e1 01             	and    $0x1,%ecx
+     3ab:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     3ae:	75 cf                	jne    37f <vclock_gettime+0x13>
+     3b0:	8b 0d 00 f0 ff 7f    	mov    0x7ffff000,%ecx
+     3b6:	39 c1                	cmp    %eax,%ecx
+     3b8:	75 c5                	jne    37f <vclock_gettime+0x13>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+     3ba:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     3bd:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     3c0:	0f 31                	rdtsc
+     3c2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     3c5:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     3c8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  now = rdtsc();
+  // Less than a tick has passed since the update, so the delta
+  // fits in 32 bits.
+  d = now > tsc ? now - tsc : 0;
+     3cb:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     3ce:	19 d3                	sbb    %edx,%ebx
+     3d0:	73 07                	jae    3d9 <vclock_gettime+0x6d>
+     3d2:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+     3d5:	29 d8                	sub    %ebx,%eax
+     3d7:	89 c1                	mov    %eax,%ecx
+  ns += ((uint64)d * cp->mult) >> cp->shift;
+     3d9:	89 c8                	mov    %ecx,%eax
+     3db:	f7 25 04 f0 ff 7f    	mull   0x7ffff004
+     3e1:	0f b6 0d 08 f0 ff 7f 	movzbl 0x7ffff008,%ecx
+     3e8:	0f ad d0             	shrd   %cl,%edx,%eax
+     3eb:	d3 ea                	shr    %cl,%edx
+     3ed:	f6 c1 20             	test   $0x20,%cl
+     3f0:	74 04                	je     3f6 <vclock_gettime+0x8a>
+     3f2:	89 d0                	mov    %edx,%eax
+     3f4:	31 d2                	xor    %edx,%edx
+     3f6:	01 f0                	add    %esi,%eax
+     3f8:	11 fa                	adc    %edi,%edx
+static inline uint
+divl(uint64 n, uint d, uint *r)
+{
+  uint q;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (*r) :
+     3fa:	bb 00 ca 9a 3b       	mov    $0x3b9aca00,%ebx
+     3ff:	f7 f3                	div    %ebx
+  ts->tv_sec = divl(ns, 1000000000, &rem);
+     401:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     404:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = rem;
+     406:	89 57 04             	mov    %edx,0x4(%edi)
+  if(clk == CLOCK_REALTIME)
+     409:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     40d:	75 1a                	jne    429 <vclock_gettime+0xbd>
+    ts->tv_sec += cp->boottime;
+     40f:	03 05 0c f0 ff 7f    	add    0x7ffff00c,%eax
+     415:	89 07                	mov    %eax,(%edi)
+  return 0;
+     417:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     41a:	83 c4 14             	add    $0x14,%esp
+     41d:	5b                   	pop    %ebx
+     41e:	5e                   	pop    %esi
+     41f:	5f                   	pop    %edi
+     420:	5d                   	pop    %ebp
+     421:	c3                   	ret
+    return -1;
+     422:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     427:	eb f1                	jmp    41a <vclock_gettime+0xae>
+  return 0;
+     429:	b8 00 00 00 00       	mov    $0x0,%eax
+     42e:	eb ea                	jmp    41a <vclock_gettime+0xae>
+
+00000430 <flush>:
+
+// Write out fd's buffer, or with fd < 0 every buffer.
+// Returns -1 if a write fails.
+int
+flush(int fd)
+{
+     430:	55                   	push   %ebp
+     431:	89 e5                	mov    %esp,%ebp
+     433:	56                   	push   %esi
+     434:	53                   	push   %ebx
+     435:	8b 45 08             	mov    0x8(%ebp),%eax
+  int r, n;
+
+  if(fd < 0){
+     438:	85 c0                	test   %eax,%eax
+     43a:	78 5d                	js     499 <flush+0x69>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+      if(flush(fd) < 0)
+        r = -1;
+    return r;
+  }
+  if(fd >= NOBUF || (n = obuf[fd].n) == 0)
+     43c:	83 f8 0f             	cmp    $0xf,%eax
+     43f:	7f 64                	jg     4a5 <flush+0x75>
+     441:	69 d0 08 02 00 00    	imul   $0x208,%eax,%edx
+     447:	8b b2 44 19 00 00    	mov    0x1944(%edx),%esi
+     44d:	85 f6                	test   %esi,%esi
+     44f:	74 59                	je     4aa <flush+0x7a>
+    return 0;
+  obuf[fd].n = 0;
+     451:	c7 82 44 19 00 00 00 	movl   $0x0,0x1944(%edx)
+     458:	00 00 00 
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     45b:	81 c2 48 19 00 00    	add    $0x1948,%edx
+     461:	83 ec 04             	sub    $0x4,%esp
+     464:	56                   	push   %esi
+     465:	52                   	push   %edx
+     466:	50                   	push   %eax
+     467:	e8 5a 03 00 00       	call   7c6 <write>
+     46c:	83 c4 10             	add    $0x10,%esp
+     46f:	39 f0                	cmp    %esi,%eax
+     471:	75 40                	jne    4b3 <flush+0x83>
+     473:	be 00 00 00 00       	mov    $0x0,%esi
+     478:	eb 30                	jmp    4aa <flush+0x7a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     47a:	83 c3 01             	add    $0x1,%ebx
+     47d:	83 fb 0f             	cmp    $0xf,%ebx
+     480:	7f 28                	jg     4aa <flush+0x7a>
+      if(flush(fd) < 0)
+     482:	83 ec 0c             	sub    $0xc,%esp
+     485:	53                   	push   %ebx
+     486:	e8 a5 ff ff ff       	call   430 <flush>
+     48b:	83 c4 10             	add    $0x10,%esp
+     48e:	85 c0                	test   %eax,%eax
+     490:	79 e8                	jns    47a <flush+0x4a>
+        r = -1;
+     492:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     497:	eb e1                	jmp    47a <flush+0x4a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     499:	be 00 00 00 00       	mov    $0x0,%esi
+     49e:	bb 00 00 00 00       	mov    $0x0,%ebx
+     4a3:	eb d8                	jmp    47d <flush+0x4d>
+    return 0;
+     4a5:	be 00 00 00 00       	mov    $0x0,%esi
+}
+     4aa:	89 f0                	mov    %esi,%eax
+     4ac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     4af:	5b                   	pop    %ebx
+     4b0:	5e                   	pop    %esi
+     4b1:	5d                   	pop    %ebp
+     4b2:	c3                   	ret
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     4b3:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     4b8:	eb f0                	jmp    4aa <flush+0x7a>
+
+000004ba <bufreset>:
+
+static void
+bufreset(int fd)
+{
+  if(fd >= 0 && fd < NOBUF){
+     4ba:	83 f8 0f             	cmp    $0xf,%eax
+     4bd:	76 01                	jbe    4c0 <bufreset+0x6>
+     4bf:	c3                   	ret
+{
+     4c0:	55                   	push   %ebp
+     4c1:	89 e5                	mov    %esp,%ebp
+     4c3:	53                   	push   %ebx
+     4c4:	83 ec 10             	sub    $0x10,%esp
+     4c7:	89 c3                	mov    %eax,%ebx
+    flush(fd);
+     4c9:	50                   	push   %eax
+     4ca:	e8 61 ff ff ff       	call   430 <flush>
+    obuf[fd].mode = BUNKNOWN;
+     4cf:	69 db 08 02 00 00    	imul   $0x208,%ebx,%ebx
+     4d5:	c7 83 40 19 00 00 00 	movl   $0x0,0x1940(%ebx)
+     4dc:	00 00 00 
+     4df:	83 c4 10             	add    $0x10,%esp
+  }
+}
+     4e2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4e5:	c9                   	leave
+     4e6:	c3                   	ret
+
+000004e7 <bufwrite>:
+
+// Write n bytes from p to fd, through its buffer.
+// Returns n, or -1 if a write fails.
+int
+bufwrite(int fd, const void *p, int n)
+{
+     4e7:	55                   	push   %ebp
+     4e8:	89 e5                	mov    %esp,%ebp
+     4ea:	57                   	push   %edi
+     4eb:	56                   	push   %esi
+     4ec:	53                   	push   %ebx
+     4ed:	83 ec 3c             	sub    $0x3c,%esp
+     4f0:	8b 75 08             	mov    0x8(%ebp),%esi
+     4f3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct stat st;
+  const char *s;
+  int i;
+
+  if(fd < 0 || fd >= NOBUF)
+     4f6:	83 fe 0f             	cmp    $0xf,%esi
+     4f9:	0f 87 a2 00 00 00    	ja     5a1 <bufwrite+0xba>
+    return write(fd, p, n);
+  if(obuf[fd].mode == BUNKNOWN){
+     4ff:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     505:	83 b8 40 19 00 00 00 	cmpl   $0x0,0x1940(%eax)
+     50c:	75 19                	jne    527 <bufwrite+0x40>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     50e:	83 fe 02             	cmp    $0x2,%esi
+     511:	0f 85 9c 00 00 00    	jne    5b3 <bufwrite+0xcc>
+      obuf[fd].mode = BNONE;
+     517:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     51d:	c7 80 40 19 00 00 01 	movl   $0x1,0x1940(%eax)
+     524:	00 00 00 
+    else
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+  }
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     527:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     52d:	89 da                	mov    %ebx,%edx
+     52f:	03 90 44 19 00 00    	add    0x1944(%eax),%edx
+     535:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+     53b:	0f 8f ae 00 00 00    	jg     5ef <bufwrite+0x108>
+    return -1;
+  if(n >= OBUFSZ)
+     541:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+     547:	0f 8f bd 00 00 00    	jg     60a <bufwrite+0x123>
+    return write(fd, p, n);
+  memmove(obuf[fd].buf + obuf[fd].n, p, n);
+     54d:	69 d6 08 02 00 00    	imul   $0x208,%esi,%edx
+     553:	8d ba 40 19 00 00    	lea    0x1940(%edx),%edi
+     559:	8b 82 44 19 00 00    	mov    0x1944(%edx),%eax
+     55f:	83 ec 04             	sub    $0x4,%esp
+     562:	53                   	push   %ebx
+     563:	ff 75 0c             	push   0xc(%ebp)
+     566:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     569:	8d 84 10 48 19 00 00 	lea    0x1948(%eax,%edx,1),%eax
+     570:	50                   	push   %eax
+     571:	e8 4c fd ff ff       	call   2c2 <memmove>
+  obuf[fd].n += n;
+     576:	01 5f 04             	add    %ebx,0x4(%edi)
+  if(obuf[fd].mode == BNONE)
+     579:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     57c:	8b 82 40 19 00 00    	mov    0x1940(%edx),%eax
+     582:	83 c4 10             	add    $0x10,%esp
+     585:	83 f8 01             	cmp    $0x1,%eax
+     588:	0f 84 91 00 00 00    	je     61f <bufwrite+0x138>
+    return flush(fd) < 0 ? -1 : n;
+  if(obuf[fd].mode == BLINE)
+     58e:	83 f8 02             	cmp    $0x2,%eax
+     591:	0f 84 ca 00 00 00    	je     661 <bufwrite+0x17a>
+    for(s = p, i = 0; i < n; i++)
+      if(s[i] == '\n')
+        return flush(fd) < 0 ? -1 : n;
+  return n;
+     597:	89 d8                	mov    %ebx,%eax
+}
+     599:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     59c:	5b                   	pop    %ebx
+     59d:	5e                   	pop    %esi
+     59e:	5f                   	pop    %edi
+     59f:	5d                   	pop    %ebp
+     5a0:	c3                   	ret
+    return write(fd, p, n);
+     5a1:	83 ec 04             	sub    $0x4,%esp
+     5a4:	53                   	push   %ebx
+     5a5:	ff 75 0c             	push   0xc(%ebp)
+     5a8:	56                   	push   %esi
+     5a9:	e8 18 02 00 00       	call   7c6 <write>
+     5ae:	83 c4 10             	add    $0x10,%esp
+     5b1:	eb e6                	jmp    599 <bufwrite+0xb2>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     5b3:	83 ec 08             	sub    $0x8,%esp
+     5b6:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     5b9:	50                   	push   %eax
+     5ba:	56                   	push   %esi
+     5bb:	e8 51 02 00 00       	call   811 <fstat>
+     5c0:	83 c4 10             	add    $0x10,%esp
+     5c3:	85 c0                	test   %eax,%eax
+     5c5:	0f 88 4c ff ff ff    	js     517 <bufwrite+0x30>
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+     5cb:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     5d0:	74 16                	je     5e8 <bufwrite+0x101>
+     5d2:	ba 03 00 00 00       	mov    $0x3,%edx
+     5d7:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     5dd:	89 90 40 19 00 00    	mov    %edx,0x1940(%eax)
+     5e3:	e9 3f ff ff ff       	jmp    527 <bufwrite+0x40>
+     5e8:	ba 02 00 00 00       	mov    $0x2,%edx
+     5ed:	eb e8                	jmp    5d7 <bufwrite+0xf0>
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     5ef:	83 ec 0c             	sub    $0xc,%esp
+     5f2:	56                   	push   %esi
+     5f3:	e8 38 fe ff ff       	call   430 <flush>
+     5f8:	83 c4 10             	add    $0x10,%esp
+     5fb:	85 c0                	test   %eax,%eax
+     5fd:	0f 89 3e ff ff ff    	jns    541 <bufwrite+0x5a>
+    return -1;
+     603:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     608:	eb 8f                	jmp    599 <bufwrite+0xb2>
+    return write(fd, p, n);
+     60a:	83 ec 04             	sub    $0x4,%esp
+     60d:	53                   	push   %ebx
+     60e:	ff 75 0c             	push   0xc(%ebp)
+     611:	56                   	push   %esi
+     612:	e8 af 01 00 00       	call   7c6 <write>
+     617:	83 c4 10             	add    $0x10,%esp
+     61a:	e9 7a ff ff ff       	jmp    599 <bufwrite+0xb2>
+    return flush(fd) < 0 ? -1 : n;
+     61f:	83 ec 0c             	sub    $0xc,%esp
+     622:	56                   	push   %esi
+     623:	e8 08 fe ff ff       	call   430 <flush>
+     628:	83 c4 10             	add    $0x10,%esp
+     62b:	85 c0                	test   %eax,%eax
+     62d:	78 07                	js     636 <bufwrite+0x14f>
+     62f:	89 d8                	mov    %ebx,%eax
+     631:	e9 63 ff ff ff       	jmp    599 <bufwrite+0xb2>
+     636:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     63b:	e9 59 ff ff ff       	jmp    599 <bufwrite+0xb2>
+        return flush(fd) < 0 ? -1 : n;
+     640:	83 ec 0c             	sub    $0xc,%esp
+     643:	56                   	push   %esi
+     644:	e8 e7 fd ff ff       	call   430 <flush>
+     649:	83 c4 10             	add    $0x10,%esp
+     64c:	85 c0                	test   %eax,%eax
+     64e:	78 07                	js     657 <bufwrite+0x170>
+     650:	89 d8                	mov    %ebx,%eax
+     652:	e9 42 ff ff ff       	jmp    599 <bufwrite+0xb2>
+     657:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     65c:	e9 38 ff ff ff       	jmp    599 <bufwrite+0xb2>
+    for(s = p, i = 0; i < n; i++)
+     661:	b8 00 00 00 00       	mov    $0x0,%eax
+     666:	39 d8                	cmp    %ebx,%eax
+     668:	7d 0e                	jge    678 <bufwrite+0x191>
+      if(s[i] == '\n')
+     66a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     66d:	80 3c 01 0a          	cmpb   $0xa,(%ecx,%eax,1)
+     671:	74 cd                	je     640 <bufwrite+0x159>
+    for(s = p, i = 0; i < n; i++)
+     673:	83 c0 01             	add    $0x1,%eax
+     676:	eb ee                	jmp    666 <bufwrite+0x17f>
+  return n;
+     678:	89 d8                	mov    %ebx,%eax
+     67a:	e9 1a ff ff ff       	jmp    599 <bufwrite+0xb2>
+
+0000067f <fork>:
+
+int
+fork(void)
+{
+     67f:	55                   	push   %ebp
+     680:	89 e5                	mov    %esp,%ebp
+     682:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     685:	6a ff                	push   $0xffffffff
+     687:	e8 a4 fd ff ff       	call   430 <flush>
+  return _fork();
+     68c:	e8 bd 00 00 00       	call   74e <_fork>
+}
+     691:	c9                   	leave
+     692:	c3                   	ret
+
+00000693 <exit>:
+
+int
+exit(void)
+{
+     693:	55                   	push   %ebp
+     694:	89 e5                	mov    %esp,%ebp
+     696:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     699:	6a ff                	push   $0xffffffff
+     69b:	e8 90 fd ff ff       	call   430 <flush>
+  _exit();
+     6a0:	e8 b8 00 00 00       	call   75d <_exit>
+
+000006a5 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     6a5:	55                   	push   %ebp
+     6a6:	89 e5                	mov    %esp,%ebp
+     6a8:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     6ab:	6a ff                	push   $0xffffffff
+     6ad:	e8 7e fd ff ff       	call   430 <flush>
+  return _exec(path, argv);
+     6b2:	83 c4 08             	add    $0x8,%esp
+     6b5:	ff 75 0c             	push   0xc(%ebp)
+     6b8:	ff 75 08             	push   0x8(%ebp)
+     6bb:	e8 bb 00 00 00       	call   77b <_exec>
+}
+     6c0:	c9                   	leave
+     6c1:	c3                   	ret
+
+000006c2 <close>:
+
+int
+close(int fd)
+{
+     6c2:	55                   	push   %ebp
+     6c3:	89 e5                	mov    %esp,%ebp
+     6c5:	53                   	push   %ebx
+     6c6:	83 ec 04             	sub    $0x4,%esp
+     6c9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bufreset(fd);
+     6cc:	89 d8                	mov    %ebx,%eax
+     6ce:	e8 e7 fd ff ff       	call   4ba <bufreset>
+  return _close(fd);
+     6d3:	83 ec 0c             	sub    $0xc,%esp
+     6d6:	53                   	push   %ebx
+     6d7:	e8 90 00 00 00       	call   76c <_close>
+}
+     6dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6df:	c9                   	leave
+     6e0:	c3                   	ret
+
+000006e1 <stat>:
+{
+     6e1:	55                   	push   %ebp
+     6e2:	89 e5                	mov    %esp,%ebp
+     6e4:	56                   	push   %esi
+     6e5:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     6e6:	83 ec 08             	sub    $0x8,%esp
+     6e9:	6a 00                	push   $0x0
+     6eb:	ff 75 08             	push   0x8(%ebp)
+     6ee:	e8 f1 00 00 00       	call   7e4 <open>
+  if(fd < 0)
+     6f3:	83 c4 10             	add    $0x10,%esp
+     6f6:	85 c0                	test   %eax,%eax
+     6f8:	78 24                	js     71e <stat+0x3d>
+     6fa:	89 c3                	mov    %eax,%ebx
+  r = fstat(fd, st);
+     6fc:	83 ec 08             	sub    $0x8,%esp
+     6ff:	ff 75 0c             	push   0xc(%ebp)
+     702:	50                   	push   %eax
+     703:	e8 09 01 00 00       	call   811 <fstat>
+     708:	89 c6                	mov    %eax,%esi
+  close(fd);
+     70a:	89 1c 24             	mov    %ebx,(%esp)
+     70d:	e8 b0 ff ff ff       	call   6c2 <close>
+  return r;
+     712:	83 c4 10             	add    $0x10,%esp
+}
+     715:	89 f0                	mov    %esi,%eax
+     717:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     71a:	5b                   	pop    %ebx
+     71b:	5e                   	pop    %esi
+     71c:	5d                   	pop    %ebp
+     71d:	c3                   	ret
+    return -1;
+     71e:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     723:	eb f0                	jmp    715 <stat+0x34>
+
+00000725 <dup2>:
+
+int
+dup2(int oldfd, int newfd)
+{
+     725:	55                   	push   %ebp
+     726:	89 e5                	mov    %esp,%ebp
+     728:	56                   	push   %esi
+     729:	53                   	push   %ebx
+     72a:	8b 75 08             	mov    0x8(%ebp),%esi
+     72d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(oldfd != newfd)
+     730:	39 de                	cmp    %ebx,%esi
+     732:	75 11                	jne    745 <dup2+0x20>
+    bufreset(newfd);
+  return _dup2(oldfd, newfd);
+     734:	83 ec 08             	sub    $0x8,%esp
+     737:	53                   	push   %ebx
+     738:	56                   	push   %esi
+     739:	e8 4c 00 00 00       	call   78a <_dup2>
+}
+     73e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     741:	5b                   	pop    %ebx
+     742:	5e                   	pop    %esi
+     743:	5d                   	pop    %ebp
+     744:	c3                   	ret
+    bufreset(newfd);
+     745:	89 d8                	mov    %ebx,%eax
+     747:	e8 6e fd ff ff       	call   4ba <bufreset>
+     74c:	eb e6                	jmp    734 <dup2+0xf>
+
+0000074e <_fork>:
+  1: ret
+
+#define SYSCALL(name) STUB(name, SYS_ ## name)
+
+# ulib.c wraps these, to flush printf()'s buffers first.
+STUB(_fork, SYS_fork)
+     74e:	b8 01 00 00 00       	mov    $0x1,%eax
+     753:	89 e1                	mov    %esp,%ecx
+     755:	ba 5c 07 00 00       	mov    $0x75c,%edx
+     75a:	0f 34                	sysenter
+     75c:	c3                   	ret
+
+0000075d <_exit>:
+STUB(_exit, SYS_exit)
+     75d:	b8 02 00 00 00       	mov    $0x2,%eax
+     762:	89 e1                	mov    %esp,%ecx
+     764:	ba 6b 07 00 00       	mov    $0x76b,%edx
+     769:	0f 34                	sysenter
+     76b:	c3                   	ret
+
+0000076c <_close>:
+STUB(_close, SYS_close)
+     76c:	b8 15 00 00 00       	mov    $0x15,%eax
+     771:	89 e1                	mov    %esp,%ecx
+     773:	ba 7a 07 00 00       	mov    $0x77a,%edx
+     778:	0f 34                	sysenter
+     77a:	c3                   	ret
+
+0000077b <_exec>:
+STUB(_exec, SYS_exec)
+     77b:	b8 07 00 00 00       	mov    $0x7,%eax
+     780:	89 e1                	mov    %esp,%ecx
+     782:	ba 89 07 00 00       	mov    $0x789,%edx
+     787:	0f 34                	sysenter
+     789:	c3                   	ret
+
+0000078a <_dup2>:
+STUB(_dup2, SYS_dup2)
+     78a:	b8 17 00 00 00       	mov    $0x17,%eax
+     78f:	89 e1                	mov    %esp,%ecx
+     791:	ba 98 07 00 00       	mov    $0x798,%edx
+     796:	0f 34                	sysenter
+     798:	c3                   	ret
+
+00000799 <wait>:
+
+SYSCALL(wait)
+     799:	b8 03 00 00 00       	mov    $0x3,%eax
+     79e:	89 e1                	mov    %esp,%ecx
+     7a0:	ba a7 07 00 00       	mov    $0x7a7,%edx
+     7a5:	0f 34                	sysenter
+     7a7:	c3                   	ret
+
+000007a8 <pipe>:
+SYSCALL(pipe)
+     7a8:	b8 04 00 00 00       	mov    $0x4,%eax
+     7ad:	89 e1                	mov    %esp,%ecx
+     7af:	ba b6 07 00 00       	mov    $0x7b6,%edx
+     7b4:	0f 34                	sysenter
+     7b6:	c3                   	ret
+
+000007b7 <read>:
+SYSCALL(read)
+     7b7:	b8 05 00 00 00       	mov    $0x5,%eax
+     7bc:	89 e1                	mov    %esp,%ecx
+     7be:	ba c5 07 00 00       	mov    $0x7c5,%edx
+     7c3:	0f 34                	sysenter
+     7c5:	c3                   	ret
+
+000007c6 <write>:
+SYSCALL(write)
+     7c6:	b8 10 00 00 00       	mov    $0x10,%eax
+     7cb:	89 e1                	mov    %esp,%ecx
+     7cd:	ba d4 07 00 00       	mov    $0x7d4,%edx
+     7d2:	0f 34                	sysenter
+     7d4:	c3                   	ret
+
+000007d5 <kill>:
+SYSCALL(kill)
+     7d5:	b8 06 00 00 00       	mov    $0x6,%eax
+     7da:	89 e1                	mov    %esp,%ecx
+     7dc:	ba e3 07 00 00       	mov    $0x7e3,%edx
+     7e1:	0f 34                	sysenter
+     7e3:	c3                   	ret
+
+000007e4 <open>:
+SYSCALL(open)
+     7e4:	b8 0f 00 00 00       	mov    $0xf,%eax
+     7e9:	89 e1                	mov    %esp,%ecx
+     7eb:	ba f2 07 00 00       	mov    $0x7f2,%edx
+     7f0:	0f 34                	sysenter
+     7f2:	c3                   	ret
+
+000007f3 <mknod>:
+SYSCALL(mknod)
+     7f3:	b8 11 00 00 00       	mov    $0x11,%eax
+     7f8:	89 e1                	mov    %esp,%ecx
+     7fa:	ba 01 08 00 00       	mov    $0x801,%edx
+     7ff:	0f 34                	sysenter
+     801:	c3                   	ret
+
+00000802 <unlink>:
+SYSCALL(unlink)
+     802:	b8 12 00 00 00       	mov    $0x12,%eax
+     807:	89 e1                	mov    %esp,%ecx
+     809:	ba 10 08 00 00       	mov    $0x810,%edx
+     80e:	0f 34                	sysenter
+     810:	c3                   	ret
+
+00000811 <fstat>:
+SYSCALL(fstat)
+     811:	b8 08 00 00 00       	mov    $0x8,%eax
+     816:	89 e1                	mov    %esp,%ecx
+     818:	ba 1f 08 00 00       	mov    $0x81f,%edx
+     81d:	0f 34                	sysenter
+     81f:	c3                   	ret
+
+00000820 <link>:
+SYSCALL(link)
+     820:	b8 13 00 00 00       	mov    $0x13,%eax
+     825:	89 e1                	mov    %esp,%ecx
+     827:	ba 2e 08 00 00       	mov    $0x82e,%edx
+     82c:	0f 34                	sysenter
+     82e:	c3                   	ret
+
+0000082f <mkdir>:
+SYSCALL(mkdir)
+     82f:	b8 14 00 00 00       	mov    $0x14,%eax
+     834:	89 e1                	mov    %esp,%ecx
+     836:	ba 3d 08 00 00       	mov    $0x83d,%edx
+     83b:	0f 34                	sysenter
+     83d:	c3                   	ret
+
+0000083e <chdir>:
+SYSCALL(chdir)
+     83e:	b8 09 00 00 00       	mov    $0x9,%eax
+     843:	89 e1                	mov    %esp,%ecx
+     845:	ba 4c 08 00 00       	mov    $0x84c,%edx
+     84a:	0f 34                	sysenter
+     84c:	c3                   	ret
+
+0000084d <dup>:
+SYSCALL(dup)
+     84d:	b8 0a 00 00 00       	mov    $0xa,%eax
+     852:	89 e1                	mov    %esp,%ecx
+     854:	ba 5b 08 00 00       	mov    $0x85b,%edx
+     859:	0f 34                	sysenter
+     85b:	c3                   	ret
+
+0000085c <getpid>:
+SYSCALL(getpid)
+     85c:	b8 0b 00 00 00       	mov    $0xb,%eax
+     861:	89 e1                	mov    %esp,%ecx
+     863:	ba 6a 08 00 00       	mov    $0x86a,%edx
+     868:	0f 34                	sysenter
+     86a:	c3                   	ret
+
+0000086b <sbrk>:
+SYSCALL(sbrk)
+     86b:	b8 0c 00 00 00       	mov    $0xc,%eax
+     870:	89 e1                	mov    %esp,%ecx
+     872:	ba 79 08 00 00       	mov    $0x879,%edx
+     877:	0f 34                	sysenter
+     879:	c3                   	ret
+
+0000087a <sleep>:
+SYSCALL(sleep)
+     87a:	b8 0d 00 00 00       	mov    $0xd,%eax
+     87f:	89 e1                	mov    %esp,%ecx
+     881:	ba 88 08 00 00       	mov    $0x888,%edx
+     886:	0f 34                	sysenter
+     888:	c3                   	ret
+
+00000889 <uptime>:
+SYSCALL(uptime)
+     889:	b8 0e 00 00 00       	mov    $0xe,%eax
+     88e:	89 e1                	mov    %esp,%ecx
+     890:	ba 97 08 00 00       	mov    $0x897,%edx
+     895:	0f 34                	sysenter
+     897:	c3                   	ret
+
+00000898 <date>:
+SYSCALL(date)
+     898:	b8 16 00 00 00       	mov    $0x16,%eax
+     89d:	89 e1                	mov    %esp,%ecx
+     89f:	ba a6 08 00 00       	mov    $0x8a6,%edx
+     8a4:	0f 34                	sysenter
+     8a6:	c3                   	ret
+
+000008a7 <faultaround>:
+SYSCALL(faultaround)
+     8a7:	b8 18 00 00 00       	mov    $0x18,%eax
+     8ac:	89 e1                	mov    %esp,%ecx
+     8ae:	ba b5 08 00 00       	mov    $0x8b5,%edx
+     8b3:	0f 34                	sysenter
+     8b5:	c3                   	ret
+
+000008b6 <faultstat>:
+SYSCALL(faultstat)
+     8b6:	b8 19 00 00 00       	mov    $0x19,%eax
+     8bb:	89 e1                	mov    %esp,%ecx
+     8bd:	ba c4 08 00 00       	mov    $0x8c4,%edx
+     8c2:	0f 34                	sysenter
+     8c4:	c3                   	ret
+
+000008c5 <mmap>:
+SYSCALL(mmap)
+     8c5:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     8ca:	89 e1                	mov    %esp,%ecx
+     8cc:	ba d3 08 00 00       	mov    $0x8d3,%edx
+     8d1:	0f 34                	sysenter
+     8d3:	c3                   	ret
+
+000008d4 <munmap>:
+SYSCALL(munmap)
+     8d4:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     8d9:	89 e1                	mov    %esp,%ecx
+     8db:	ba e2 08 00 00       	mov    $0x8e2,%edx
+     8e0:	0f 34                	sysenter
+     8e2:	c3                   	ret
+
+000008e3 <largepages>:
+SYSCALL(largepages)
+     8e3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     8e8:	89 e1                	mov    %esp,%ecx
+     8ea:	ba f1 08 00 00       	mov    $0x8f1,%edx
+     8ef:	0f 34                	sysenter
+     8f1:	c3                   	ret
+
+000008f2 <spawn>:
+SYSCALL(spawn)
+     8f2:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     8f7:	89 e1                	mov    %esp,%ecx
+     8f9:	ba 00 09 00 00       	mov    $0x900,%edx
+     8fe:	0f 34                	sysenter
+     900:	c3                   	ret
+
+00000901 <setpriority>:
+SYSCALL(setpriority)
+     901:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     906:	89 e1                	mov    %esp,%ecx
+     908:	ba 0f 09 00 00       	mov    $0x90f,%edx
+     90d:	0f 34                	sysenter
+     90f:	c3                   	ret
+
+00000910 <getpriority>:
+SYSCALL(getpriority)
+     910:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     915:	89 e1                	mov    %esp,%ecx
+     917:	ba 1e 09 00 00       	mov    $0x91e,%edx
+     91c:	0f 34                	sysenter
+     91e:	c3                   	ret
+
+0000091f <getprocinfo>:
+SYSCALL(getprocinfo)
+     91f:	b8 20 00 00 00       	mov    $0x20,%eax
+     924:	89 e1                	mov    %esp,%ecx
+     926:	ba 2d 09 00 00       	mov    $0x92d,%edx
+     92b:	0f 34                	sysenter
+     92d:	c3                   	ret
+
+0000092e <getcpuinfo>:
+SYSCALL(getcpuinfo)
+     92e:	b8 21 00 00 00       	mov    $0x21,%eax
+     933:	89 e1                	mov    %esp,%ecx
+     935:	ba 3c 09 00 00       	mov    $0x93c,%edx
+     93a:	0f 34                	sysenter
+     93c:	c3                   	ret
+
+0000093d <clone>:
+SYSCALL(clone)
+     93d:	b8 22 00 00 00       	mov    $0x22,%eax
+     942:	89 e1                	mov    %esp,%ecx
+     944:	ba 4b 09 00 00       	mov    $0x94b,%edx
+     949:	0f 34                	sysenter
+     94b:	c3                   	ret
+
+0000094c <join>:
+SYSCALL(join)
+     94c:	b8 23 00 00 00       	mov    $0x23,%eax
+     951:	89 e1                	mov    %esp,%ecx
+     953:	ba 5a 09 00 00       	mov    $0x95a,%edx
+     958:	0f 34                	sysenter
+     95a:	c3                   	ret
+
+0000095b <futex_wait>:
+SYSCALL(futex_wait)
+     95b:	b8 24 00 00 00       	mov    $0x24,%eax
+     960:	89 e1                	mov    %esp,%ecx
+     962:	ba 69 09 00 00       	mov    $0x969,%edx
+     967:	0f 34                	sysenter
+     969:	c3                   	ret
+
+0000096a <futex_wake>:
+SYSCALL(futex_wake)
+     96a:	b8 25 00 00 00       	mov    $0x25,%eax
+     96f:	89 e1                	mov    %esp,%ecx
+     971:	ba 78 09 00 00       	mov    $0x978,%edx
+     976:	0f 34                	sysenter
+     978:	c3                   	ret
+
+00000979 <setaffinity>:
+SYSCALL(setaffinity)
+     979:	b8 26 00 00 00       	mov    $0x26,%eax
+     97e:	89 e1                	mov    %esp,%ecx
+     980:	ba 87 09 00 00       	mov    $0x987,%edx
+     985:	0f 34                	sysenter
+     987:	c3                   	ret
+
+00000988 <getaffinity>:
+SYSCALL(getaffinity)
+     988:	b8 27 00 00 00       	mov    $0x27,%eax
+     98d:	89 e1                	mov    %esp,%ecx
+     98f:	ba 96 09 00 00       	mov    $0x996,%edx
+     994:	0f 34                	sysenter
+     996:	c3                   	ret
+
+00000997 <clock_gettime>:
+SYSCALL(clock_gettime)
+     997:	b8 28 00 00 00       	mov    $0x28,%eax
+     99c:	89 e1                	mov    %esp,%ecx
+     99e:	ba a5 09 00 00       	mov    $0x9a5,%edx
+     9a3:	0f 34                	sysenter
+     9a5:	c3                   	ret
+
+000009a6 <msleep>:
+SYSCALL(msleep)
+     9a6:	b8 29 00 00 00       	mov    $0x29,%eax
+     9ab:	89 e1                	mov    %esp,%ecx
+     9ad:	ba b4 09 00 00       	mov    $0x9b4,%edx
+     9b2:	0f 34                	sysenter
+     9b4:	c3                   	ret
+
+000009b5 <lockstat>:
+SYSCALL(lockstat)
+     9b5:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     9ba:	89 e1                	mov    %esp,%ecx
+     9bc:	ba c3 09 00 00       	mov    $0x9c3,%edx
+     9c1:	0f 34                	sysenter
+     9c3:	c3                   	ret
+
+000009c4 <bstat>:
+SYSCALL(bstat)
+     9c4:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     9c9:	89 e1                	mov    %esp,%ecx
+     9cb:	ba d2 09 00 00       	mov    $0x9d2,%edx
+     9d0:	0f 34                	sysenter
+     9d2:	c3                   	ret
+
+000009d3 <iostat>:
+SYSCALL(iostat)
+     9d3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     9d8:	89 e1                	mov    %esp,%ecx
+     9da:	ba e1 09 00 00       	mov    $0x9e1,%edx
+     9df:	0f 34                	sysenter
+     9e1:	c3                   	ret
+
+000009e2 <fsync>:
+SYSCALL(fsync)
+     9e2:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     9e7:	89 e1                	mov    %esp,%ecx
+     9e9:	ba f0 09 00 00       	mov    $0x9f0,%edx
+     9ee:	0f 34                	sysenter
+     9f0:	c3                   	ret
+
+000009f1 <pread>:
+SYSCALL(pread)
+     9f1:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     9f6:	89 e1                	mov    %esp,%ecx
+     9f8:	ba ff 09 00 00       	mov    $0x9ff,%edx
+     9fd:	0f 34                	sysenter
+     9ff:	c3                   	ret
+
+00000a00 <pwrite>:
+SYSCALL(pwrite)
+     a00:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     a05:	89 e1                	mov    %esp,%ecx
+     a07:	ba 0e 0a 00 00       	mov    $0xa0e,%edx
+     a0c:	0f 34                	sysenter
+     a0e:	c3                   	ret
+
+00000a0f <readv>:
+SYSCALL(readv)
+     a0f:	b8 30 00 00 00       	mov    $0x30,%eax
+     a14:	89 e1                	mov    %esp,%ecx
+     a16:	ba 1d 0a 00 00       	mov    $0xa1d,%edx
+     a1b:	0f 34                	sysenter
+     a1d:	c3                   	ret
+
+00000a1e <writev>:
+SYSCALL(writev)
+     a1e:	b8 31 00 00 00       	mov    $0x31,%eax
+     a23:	89 e1                	mov    %esp,%ecx
+     a25:	ba 2c 0a 00 00       	mov    $0xa2c,%edx
+     a2a:	0f 34                	sysenter
+     a2c:	c3                   	ret
+
+00000a2d <sendfile>:
+SYSCALL(sendfile)
+     a2d:	b8 32 00 00 00       	mov    $0x32,%eax
+     a32:	89 e1                	mov    %esp,%ecx
+     a34:	ba 3b 0a 00 00       	mov    $0xa3b,%edx
+     a39:	0f 34                	sysenter
+     a3b:	c3                   	ret
+
+00000a3c <fcntl>:
+SYSCALL(fcntl)
+     a3c:	b8 33 00 00 00       	mov    $0x33,%eax
+     a41:	89 e1                	mov    %esp,%ecx
+     a43:	ba 4a 0a 00 00       	mov    $0xa4a,%edx
+     a48:	0f 34                	sysenter
+     a4a:	c3                   	ret
+
+00000a4b <mount>:
+SYSCALL(mount)
+     a4b:	b8 34 00 00 00       	mov    $0x34,%eax
+     a50:	89 e1                	mov    %esp,%ecx
+     a52:	ba 59 0a 00 00       	mov    $0xa59,%edx
+     a57:	0f 34                	sysenter
+     a59:	c3                   	ret
+
+00000a5a <getdents>:
+SYSCALL(getdents)
+     a5a:	b8 35 00 00 00       	mov    $0x35,%eax
+     a5f:	89 e1                	mov    %esp,%ecx
+     a61:	ba 68 0a 00 00       	mov    $0xa68,%edx
+     a66:	0f 34                	sysenter
+     a68:	c3                   	ret
+
+00000a69 <fstatat>:
+SYSCALL(fstatat)
+     a69:	b8 36 00 00 00       	mov    $0x36,%eax
+     a6e:	89 e1                	mov    %esp,%ecx
+     a70:	ba 77 0a 00 00       	mov    $0xa77,%edx
+     a75:	0f 34                	sysenter
+     a77:	c3                   	ret
+
+00000a78 <sysstat>:
+SYSCALL(sysstat)
+     a78:	b8 37 00 00 00       	mov    $0x37,%eax
+     a7d:	89 e1                	mov    %esp,%ecx
+     a7f:	ba 86 0a 00 00       	mov    $0xa86,%edx
+     a84:	0f 34                	sysenter
+     a86:	c3                   	ret
+
+00000a87 <ringenter>:
+SYSCALL(ringenter)
+     a87:	b8 38 00 00 00       	mov    $0x38,%eax
+     a8c:	89 e1                	mov    %esp,%ecx
+     a8e:	ba 95 0a 00 00       	mov    $0xa95,%edx
+     a93:	0f 34                	sysenter
+     a95:	c3                   	ret
+
+00000a96 <trace>:
+SYSCALL(trace)
+     a96:	b8 39 00 00 00       	mov    $0x39,%eax
+     a9b:	89 e1                	mov    %esp,%ecx
+     a9d:	ba a4 0a 00 00       	mov    $0xaa4,%edx
+     aa2:	0f 34                	sysenter
+     aa4:	c3                   	ret
+
+00000aa5 <memstat>:
+SYSCALL(memstat)
+     aa5:	b8 3a 00 00 00       	mov    $0x3a,%eax
+     aaa:	89 e1                	mov    %esp,%ecx
+     aac:	ba b3 0a 00 00       	mov    $0xab3,%edx
+     ab1:	0f 34                	sysenter
+     ab3:	c3                   	ret
+
+00000ab4 <shmget>:
+SYSCALL(shmget)
+     ab4:	b8 3b 00 00 00       	mov    $0x3b,%eax
+     ab9:	89 e1                	mov    %esp,%ecx
+     abb:	ba c2 0a 00 00       	mov    $0xac2,%edx
+     ac0:	0f 34                	sysenter
+     ac2:	c3                   	ret
+
+00000ac3 <shmat>:
+SYSCALL(shmat)
+     ac3:	b8 3c 00 00 00       	mov    $0x3c,%eax
+     ac8:	89 e1                	mov    %esp,%ecx
+     aca:	ba d1 0a 00 00       	mov    $0xad1,%edx
+     acf:	0f 34                	sysenter
+     ad1:	c3                   	ret
+
+00000ad2 <shmdt>:
+SYSCALL(shmdt)
+     ad2:	b8 3d 00 00 00       	mov    $0x3d,%eax
+     ad7:	89 e1                	mov    %esp,%ecx
+     ad9:	ba e0 0a 00 00       	mov    $0xae0,%edx
+     ade:	0f 34                	sysenter
+     ae0:	c3                   	ret
+
+00000ae1 <irqstat>:
+SYSCALL(irqstat)
+     ae1:	b8 3e 00 00 00       	mov    $0x3e,%eax
+     ae6:	89 e1                	mov    %esp,%ecx
+     ae8:	ba ef 0a 00 00       	mov    $0xaef,%edx
+     aed:	0f 34                	sysenter
+     aef:	c3                   	ret
+
+00000af0 <irqroute>:
+SYSCALL(irqroute)
+     af0:	b8 3f 00 00 00       	mov    $0x3f,%eax
+     af5:	89 e1                	mov    %esp,%ecx
+     af7:	ba fe 0a 00 00       	mov    $0xafe,%edx
+     afc:	0f 34                	sysenter
+     afe:	c3                   	ret
+
+00000aff <putc>:
+  char buf[64];
+};
+
+static void
+putc(struct out *o, char c)
+{
+     aff:	55                   	push   %ebp
+     b00:	89 e5                	mov    %esp,%ebp
+     b02:	56                   	push   %esi
+     b03:	53                   	push   %ebx
+     b04:	89 c3                	mov    %eax,%ebx
+     b06:	89 d6                	mov    %edx,%esi
+  if(o->n == sizeof(o->buf)){
+     b08:	8b 40 04             	mov    0x4(%eax),%eax
+     b0b:	83 f8 40             	cmp    $0x40,%eax
+     b0e:	74 16                	je     b26 <putc+0x27>
+    bufwrite(o->fd, o->buf, o->n);
+    o->n = 0;
+  }
+  o->buf[o->n++] = c;
+     b10:	8b 43 04             	mov    0x4(%ebx),%eax
+     b13:	8d 50 01             	lea    0x1(%eax),%edx
+     b16:	89 53 04             	mov    %edx,0x4(%ebx)
+     b19:	89 f1                	mov    %esi,%ecx
+     b1b:	88 4c 03 08          	mov    %cl,0x8(%ebx,%eax,1)
+}
+     b1f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b22:	5b                   	pop    %ebx
+     b23:	5e                   	pop    %esi
+     b24:	5d                   	pop    %ebp
+     b25:	c3                   	ret
+    bufwrite(o->fd, o->buf, o->n);
+     b26:	8d 53 08             	lea    0x8(%ebx),%edx
+     b29:	83 ec 04             	sub    $0x4,%esp
+     b2c:	50                   	push   %eax
+     b2d:	52                   	push   %edx
+     b2e:	ff 33                	push   (%ebx)
+     b30:	e8 b2 f9 ff ff       	call   4e7 <bufwrite>
+    o->n = 0;
+     b35:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     b3c:	83 c4 10             	add    $0x10,%esp
+     b3f:	eb cf                	jmp    b10 <putc+0x11>
+
+00000b41 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     b41:	55                   	push   %ebp
+     b42:	89 e5                	mov    %esp,%ebp
+     b44:	57                   	push   %edi
+     b45:	56                   	push   %esi
+     b46:	53                   	push   %ebx
+     b47:	83 ec 2c             	sub    $0x2c,%esp
+     b4a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     b4d:	89 d0                	mov    %edx,%eax
+     b4f:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+     b51:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     b55:	0f 95 c1             	setne  %cl
+     b58:	c1 ea 1f             	shr    $0x1f,%edx
+     b5b:	84 d1                	test   %dl,%cl
+     b5d:	74 44                	je     ba3 <printint+0x62>
+    neg = 1;
+    x = -xx;
+     b5f:	f7 d8                	neg    %eax
+     b61:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+     b63:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     b6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+     b6f:	89 c8                	mov    %ecx,%eax
+     b71:	ba 00 00 00 00       	mov    $0x0,%edx
+     b76:	f7 f6                	div    %esi
+     b78:	89 df                	mov    %ebx,%edi
+     b7a:	83 c3 01             	add    $0x1,%ebx
+     b7d:	0f b6 92 5c 12 00 00 	movzbl 0x125c(%edx),%edx
+     b84:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+     b88:	89 ca                	mov    %ecx,%edx
+     b8a:	89 c1                	mov    %eax,%ecx
+     b8c:	39 f2                	cmp    %esi,%edx
+     b8e:	73 df                	jae    b6f <printint+0x2e>
+  if(neg)
+     b90:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     b94:	74 31                	je     bc7 <printint+0x86>
+    buf[i++] = '-';
+     b96:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+     b9b:	8d 5f 02             	lea    0x2(%edi),%ebx
+     b9e:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     ba1:	eb 17                	jmp    bba <printint+0x79>
+    x = xx;
+     ba3:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+     ba5:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     bac:	eb bc                	jmp    b6a <printint+0x29>
+
+  while(--i >= 0)
+    putc(o, buf[i]);
+     bae:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+     bb3:	89 f0                	mov    %esi,%eax
+     bb5:	e8 45 ff ff ff       	call   aff <putc>
+  while(--i >= 0)
+     bba:	83 eb 01             	sub    $0x1,%ebx
+     bbd:	79 ef                	jns    bae <printint+0x6d>
+}
+     bbf:	83 c4 2c             	add    $0x2c,%esp
+     bc2:	5b                   	pop    %ebx
+     bc3:	5e                   	pop    %esi
+     bc4:	5f                   	pop    %edi
+     bc5:	5d                   	pop    %ebp
+     bc6:	c3                   	ret
+     bc7:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     bca:	eb ee                	jmp    bba <printint+0x79>
+
+00000bcc <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     bcc:	55                   	push   %ebp
+     bcd:	89 e5                	mov    %esp,%ebp
+     bcf:	57                   	push   %edi
+     bd0:	56                   	push   %esi
+     bd1:	53                   	push   %ebx
+     bd2:	83 ec 6c             	sub    $0x6c,%esp
+  int c, i, state;
+  uint *ap;
+  struct out out, *o;
+
+  o = &out;
+  o->fd = fd;
+     bd5:	8b 45 08             	mov    0x8(%ebp),%eax
+     bd8:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  o->n = 0;
+     bdb:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+     be2:	8d 45 10             	lea    0x10(%ebp),%eax
+     be5:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  state = 0;
+     be8:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+     bed:	bb 00 00 00 00       	mov    $0x0,%ebx
+     bf2:	eb 14                	jmp    c08 <printf+0x3c>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(o, c);
+     bf4:	89 fa                	mov    %edi,%edx
+     bf6:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     bf9:	e8 01 ff ff ff       	call   aff <putc>
+     bfe:	eb 05                	jmp    c05 <printf+0x39>
+      }
+    } else if(state == '%'){
+     c00:	83 fe 25             	cmp    $0x25,%esi
+     c03:	74 25                	je     c2a <printf+0x5e>
+  for(i = 0; fmt[i]; i++){
+     c05:	83 c3 01             	add    $0x1,%ebx
+     c08:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c0b:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+     c0f:	84 c0                	test   %al,%al
+     c11:	0f 84 20 01 00 00    	je     d37 <printf+0x16b>
+    c = fmt[i] & 0xff;
+     c17:	0f be f8             	movsbl %al,%edi
+     c1a:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     c1d:	85 f6                	test   %esi,%esi
+     c1f:	75 df                	jne    c00 <printf+0x34>
+      if(c == '%'){
+     c21:	83 f8 25             	cmp    $0x25,%eax
+     c24:	75 ce                	jne    bf4 <printf+0x28>
+        state = '%';
+     c26:	89 c6                	mov    %eax,%esi
+     c28:	eb db                	jmp    c05 <printf+0x39>
+      if(c == 'd'){
+     c2a:	83 f8 25             	cmp    $0x25,%eax
+     c2d:	0f 84 cf 00 00 00    	je     d02 <printf+0x136>
+     c33:	0f 8c dd 00 00 00    	jl     d16 <printf+0x14a>
+     c39:	83 f8 78             	cmp    $0x78,%eax
+     c3c:	0f 8f d4 00 00 00    	jg     d16 <printf+0x14a>
+     c42:	83 f8 63             	cmp    $0x63,%eax
+     c45:	0f 8c cb 00 00 00    	jl     d16 <printf+0x14a>
+     c4b:	83 e8 63             	sub    $0x63,%eax
+     c4e:	83 f8 15             	cmp    $0x15,%eax
+     c51:	0f 87 bf 00 00 00    	ja     d16 <printf+0x14a>
+     c57:	ff 24 85 04 12 00 00 	jmp    *0x1204(,%eax,4)
+        printint(o, *ap, 10, 1);
+     c5e:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     c61:	8b 17                	mov    (%edi),%edx
+     c63:	83 ec 0c             	sub    $0xc,%esp
+     c66:	6a 01                	push   $0x1
+     c68:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     c6d:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     c70:	e8 cc fe ff ff       	call   b41 <printint>
+        ap++;
+     c75:	83 c7 04             	add    $0x4,%edi
+     c78:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     c7b:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(o, '%');
+        putc(o, c);
+      }
+      state = 0;
+     c7e:	be 00 00 00 00       	mov    $0x0,%esi
+     c83:	eb 80                	jmp    c05 <printf+0x39>
+        printint(o, *ap, 16, 0);
+     c85:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     c88:	8b 17                	mov    (%edi),%edx
+     c8a:	83 ec 0c             	sub    $0xc,%esp
+     c8d:	6a 00                	push   $0x0
+     c8f:	b9 10 00 00 00       	mov    $0x10,%ecx
+     c94:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     c97:	e8 a5 fe ff ff       	call   b41 <printint>
+        ap++;
+     c9c:	83 c7 04             	add    $0x4,%edi
+     c9f:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     ca2:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     ca5:	be 00 00 00 00       	mov    $0x0,%esi
+     caa:	e9 56 ff ff ff       	jmp    c05 <printf+0x39>
+        s = (char*)*ap;
+     caf:	8b 45 94             	mov    -0x6c(%ebp),%eax
+     cb2:	8b 30                	mov    (%eax),%esi
+        ap++;
+     cb4:	83 c0 04             	add    $0x4,%eax
+     cb7:	89 45 94             	mov    %eax,-0x6c(%ebp)
+        if(s == 0)
+     cba:	85 f6                	test   %esi,%esi
+     cbc:	75 15                	jne    cd3 <printf+0x107>
+          s = "(null)";
+     cbe:	be fc 11 00 00       	mov    $0x11fc,%esi
+     cc3:	eb 0e                	jmp    cd3 <printf+0x107>
+          putc(o, *s);
+     cc5:	0f be d2             	movsbl %dl,%edx
+     cc8:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     ccb:	e8 2f fe ff ff       	call   aff <putc>
+          s++;
+     cd0:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+     cd3:	0f b6 16             	movzbl (%esi),%edx
+     cd6:	84 d2                	test   %dl,%dl
+     cd8:	75 eb                	jne    cc5 <printf+0xf9>
+      state = 0;
+     cda:	be 00 00 00 00       	mov    $0x0,%esi
+     cdf:	e9 21 ff ff ff       	jmp    c05 <printf+0x39>
+        putc(o, *ap);
+     ce4:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     ce7:	0f be 17             	movsbl (%edi),%edx
+     cea:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     ced:	e8 0d fe ff ff       	call   aff <putc>
+        ap++;
+     cf2:	83 c7 04             	add    $0x4,%edi
+     cf5:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+      state = 0;
+     cf8:	be 00 00 00 00       	mov    $0x0,%esi
+     cfd:	e9 03 ff ff ff       	jmp    c05 <printf+0x39>
+        putc(o, c);
+     d02:	89 fa                	mov    %edi,%edx
+     d04:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d07:	e8 f3 fd ff ff       	call   aff <putc>
+      state = 0;
+     d0c:	be 00 00 00 00       	mov    $0x0,%esi
+     d11:	e9 ef fe ff ff       	jmp    c05 <printf+0x39>
+        putc(o, '%');
+     d16:	ba 25 00 00 00       	mov    $0x25,%edx
+     d1b:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d1e:	e8 dc fd ff ff       	call   aff <putc>
+        putc(o, c);
+     d23:	89 fa                	mov    %edi,%edx
+     d25:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d28:	e8 d2 fd ff ff       	call   aff <putc>
+      state = 0;
+     d2d:	be 00 00 00 00       	mov    $0x0,%esi
+     d32:	e9 ce fe ff ff       	jmp    c05 <printf+0x39>
+    }
+  }
+  if(o->n > 0)
+     d37:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     d3a:	85 c0                	test   %eax,%eax
+     d3c:	7f 08                	jg     d46 <printf+0x17a>
+    bufwrite(fd, o->buf, o->n);
+}
+     d3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d41:	5b                   	pop    %ebx
+     d42:	5e                   	pop    %esi
+     d43:	5f                   	pop    %edi
+     d44:	5d                   	pop    %ebp
+     d45:	c3                   	ret
+    bufwrite(fd, o->buf, o->n);
+     d46:	83 ec 04             	sub    $0x4,%esp
+     d49:	50                   	push   %eax
+     d4a:	8d 45 a8             	lea    -0x58(%ebp),%eax
+     d4d:	50                   	push   %eax
+     d4e:	ff 75 08             	push   0x8(%ebp)
+     d51:	e8 91 f7 ff ff       	call   4e7 <bufwrite>
+     d56:	83 c4 10             	add    $0x10,%esp
+}
+     d59:	eb e3                	jmp    d3e <printf+0x172>
+
+00000d5b <largefree>:
+  return &b->h;
+}
+
+static void
+largefree(Fblock *b)
+{
+     d5b:	55                   	push   %ebp
+     d5c:	89 e5                	mov    %esp,%ebp
+     d5e:	57                   	push   %edi
+     d5f:	56                   	push   %esi
+     d60:	53                   	push   %ebx
+     d61:	83 ec 0c             	sub    $0xc,%esp
+     d64:	89 c1                	mov    %eax,%ecx
+  Fblock **pp, *p, *prev;
+
+  prev = 0;
+     d66:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     d6b:	ba cc 39 00 00       	mov    $0x39cc,%edx
+     d70:	eb 05                	jmp    d77 <largefree+0x1c>
+     d72:	8d 50 08             	lea    0x8(%eax),%edx
+    prev = p;
+     d75:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     d77:	8b 02                	mov    (%edx),%eax
+     d79:	85 c0                	test   %eax,%eax
+     d7b:	74 04                	je     d81 <largefree+0x26>
+     d7d:	39 c8                	cmp    %ecx,%eax
+     d7f:	72 f1                	jb     d72 <largefree+0x17>
+  b->next = p;
+     d81:	89 41 08             	mov    %eax,0x8(%ecx)
+  if(p && (char*)b + b->h.size == (char*)p){
+     d84:	85 c0                	test   %eax,%eax
+     d86:	74 09                	je     d91 <largefree+0x36>
+     d88:	8b 31                	mov    (%ecx),%esi
+     d8a:	8d 3c 31             	lea    (%ecx,%esi,1),%edi
+     d8d:	39 c7                	cmp    %eax,%edi
+     d8f:	74 21                	je     db2 <largefree+0x57>
+    b->h.size += p->h.size;
+    b->next = p->next;
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+     d91:	85 db                	test   %ebx,%ebx
+     d93:	74 09                	je     d9e <largefree+0x43>
+     d95:	8b 03                	mov    (%ebx),%eax
+     d97:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+     d9a:	39 ce                	cmp    %ecx,%esi
+     d9c:	74 20                	je     dbe <largefree+0x63>
+    prev->h.size += b->h.size;
+    prev->next = b->next;
+  } else
+    *pp = b;
+     d9e:	89 0a                	mov    %ecx,(%edx)
+
+  // Give the top of the heap back.  With threads sharing the
+  // address space sbrk() cannot shrink it; keep the block then.
+  for(pp = &large; (*pp)->next; pp = &(*pp)->next)
+     da0:	be cc 39 00 00       	mov    $0x39cc,%esi
+     da5:	8b 1e                	mov    (%esi),%ebx
+     da7:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+     dab:	74 1d                	je     dca <largefree+0x6f>
+     dad:	8d 73 08             	lea    0x8(%ebx),%esi
+     db0:	eb f3                	jmp    da5 <largefree+0x4a>
+    b->h.size += p->h.size;
+     db2:	03 30                	add    (%eax),%esi
+     db4:	89 31                	mov    %esi,(%ecx)
+    b->next = p->next;
+     db6:	8b 40 08             	mov    0x8(%eax),%eax
+     db9:	89 41 08             	mov    %eax,0x8(%ecx)
+     dbc:	eb d3                	jmp    d91 <largefree+0x36>
+    prev->h.size += b->h.size;
+     dbe:	03 01                	add    (%ecx),%eax
+     dc0:	89 03                	mov    %eax,(%ebx)
+    prev->next = b->next;
+     dc2:	8b 41 08             	mov    0x8(%ecx),%eax
+     dc5:	89 43 08             	mov    %eax,0x8(%ebx)
+     dc8:	eb d6                	jmp    da0 <largefree+0x45>
+    ;
+  b = *pp;
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     dca:	89 df                	mov    %ebx,%edi
+     dcc:	03 3b                	add    (%ebx),%edi
+     dce:	83 ec 0c             	sub    $0xc,%esp
+     dd1:	6a 00                	push   $0x0
+     dd3:	e8 93 fa ff ff       	call   86b <sbrk>
+     dd8:	83 c4 10             	add    $0x10,%esp
+     ddb:	39 c7                	cmp    %eax,%edi
+     ddd:	74 08                	je     de7 <largefree+0x8c>
+    *pp = 0;
+}
+     ddf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     de2:	5b                   	pop    %ebx
+     de3:	5e                   	pop    %esi
+     de4:	5f                   	pop    %edi
+     de5:	5d                   	pop    %ebp
+     de6:	c3                   	ret
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     de7:	8b 03                	mov    (%ebx),%eax
+     de9:	f7 d8                	neg    %eax
+     deb:	83 ec 0c             	sub    $0xc,%esp
+     dee:	50                   	push   %eax
+     def:	e8 77 fa ff ff       	call   86b <sbrk>
+     df4:	83 c4 10             	add    $0x10,%esp
+     df7:	83 f8 ff             	cmp    $0xffffffff,%eax
+     dfa:	74 e3                	je     ddf <largefree+0x84>
+    *pp = 0;
+     dfc:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+     e02:	eb db                	jmp    ddf <largefree+0x84>
+
+00000e04 <more>:
+{
+     e04:	55                   	push   %ebp
+     e05:	89 e5                	mov    %esp,%ebp
+     e07:	56                   	push   %esi
+     e08:	53                   	push   %ebx
+     e09:	89 c6                	mov    %eax,%esi
+  pad = -(uint)sbrk(0) & 7;
+     e0b:	83 ec 0c             	sub    $0xc,%esp
+     e0e:	6a 00                	push   $0x0
+     e10:	e8 56 fa ff ff       	call   86b <sbrk>
+     e15:	f7 d8                	neg    %eax
+     e17:	89 c3                	mov    %eax,%ebx
+     e19:	83 e3 07             	and    $0x7,%ebx
+  if((p = sbrk(n + pad)) == (char*)-1)
+     e1c:	01 de                	add    %ebx,%esi
+     e1e:	89 34 24             	mov    %esi,(%esp)
+     e21:	e8 45 fa ff ff       	call   86b <sbrk>
+     e26:	83 c4 10             	add    $0x10,%esp
+     e29:	83 f8 ff             	cmp    $0xffffffff,%eax
+     e2c:	74 09                	je     e37 <more+0x33>
+  return p + pad;
+     e2e:	01 d8                	add    %ebx,%eax
+}
+     e30:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e33:	5b                   	pop    %ebx
+     e34:	5e                   	pop    %esi
+     e35:	5d                   	pop    %ebp
+     e36:	c3                   	ret
+    return 0;
+     e37:	b8 00 00 00 00       	mov    $0x0,%eax
+     e3c:	eb f2                	jmp    e30 <more+0x2c>
+
+00000e3e <slaballoc>:
+{
+     e3e:	55                   	push   %ebp
+     e3f:	89 e5                	mov    %esp,%ebp
+     e41:	56                   	push   %esi
+     e42:	53                   	push   %ebx
+     e43:	89 c6                	mov    %eax,%esi
+  n = 1 << (MINSHIFT + c);
+     e45:	8d 48 04             	lea    0x4(%eax),%ecx
+     e48:	bb 01 00 00 00       	mov    $0x1,%ebx
+     e4d:	d3 e3                	shl    %cl,%ebx
+  if(slab + n > slabend){
+     e4f:	89 d8                	mov    %ebx,%eax
+     e51:	03 05 c8 39 00 00    	add    0x39c8,%eax
+     e57:	39 05 c4 39 00 00    	cmp    %eax,0x39c4
+     e5d:	72 17                	jb     e76 <slaballoc+0x38>
+  h = (Header*)slab;
+     e5f:	a1 c8 39 00 00       	mov    0x39c8,%eax
+  slab += n;
+     e64:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+     e67:	89 15 c8 39 00 00    	mov    %edx,0x39c8
+  h->size = n;
+     e6d:	89 18                	mov    %ebx,(%eax)
+  h->class = c;
+     e6f:	89 70 04             	mov    %esi,0x4(%eax)
+}
+     e72:	5b                   	pop    %ebx
+     e73:	5e                   	pop    %esi
+     e74:	5d                   	pop    %ebp
+     e75:	c3                   	ret
+    if((p = more(SLABSZ)) == 0)
+     e76:	b8 00 40 00 00       	mov    $0x4000,%eax
+     e7b:	e8 84 ff ff ff       	call   e04 <more>
+     e80:	85 c0                	test   %eax,%eax
+     e82:	74 ee                	je     e72 <slaballoc+0x34>
+    if(p != slabend)
+     e84:	39 05 c4 39 00 00    	cmp    %eax,0x39c4
+     e8a:	74 05                	je     e91 <slaballoc+0x53>
+      slab = p;
+     e8c:	a3 c8 39 00 00       	mov    %eax,0x39c8
+    slabend = p + SLABSZ;
+     e91:	05 00 40 00 00       	add    $0x4000,%eax
+     e96:	a3 c4 39 00 00       	mov    %eax,0x39c4
+     e9b:	eb c2                	jmp    e5f <slaballoc+0x21>
+
+00000e9d <largealloc>:
+{
+     e9d:	55                   	push   %ebp
+     e9e:	89 e5                	mov    %esp,%ebp
+     ea0:	56                   	push   %esi
+     ea1:	53                   	push   %ebx
+     ea2:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     ea4:	b9 cc 39 00 00       	mov    $0x39cc,%ecx
+     ea9:	8b 01                	mov    (%ecx),%eax
+     eab:	85 c0                	test   %eax,%eax
+     ead:	74 36                	je     ee5 <largealloc+0x48>
+    if(b->h.size < n)
+     eaf:	8b 10                	mov    (%eax),%edx
+     eb1:	39 da                	cmp    %ebx,%edx
+     eb3:	72 24                	jb     ed9 <largealloc+0x3c>
+    if(b->h.size - n > SMALLMAX){
+     eb5:	29 da                	sub    %ebx,%edx
+     eb7:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+     ebd:	76 1f                	jbe    ede <largealloc+0x41>
+      rest = (Fblock*)((char*)b + n);
+     ebf:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+      rest->h.size = b->h.size - n;
+     ec2:	89 16                	mov    %edx,(%esi)
+      rest->h.class = LARGE;
+     ec4:	c7 46 04 09 00 00 00 	movl   $0x9,0x4(%esi)
+      rest->next = b->next;
+     ecb:	8b 50 08             	mov    0x8(%eax),%edx
+     ece:	89 56 08             	mov    %edx,0x8(%esi)
+      *pp = rest;
+     ed1:	89 31                	mov    %esi,(%ecx)
+      b->h.size = n;
+     ed3:	89 18                	mov    %ebx,(%eax)
+}
+     ed5:	5b                   	pop    %ebx
+     ed6:	5e                   	pop    %esi
+     ed7:	5d                   	pop    %ebp
+     ed8:	c3                   	ret
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     ed9:	8d 48 08             	lea    0x8(%eax),%ecx
+     edc:	eb cb                	jmp    ea9 <largealloc+0xc>
+      *pp = b->next;
+     ede:	8b 50 08             	mov    0x8(%eax),%edx
+     ee1:	89 11                	mov    %edx,(%ecx)
+    return &b->h;
+     ee3:	eb f0                	jmp    ed5 <largealloc+0x38>
+  if((b = more(n)) == 0)
+     ee5:	89 d8                	mov    %ebx,%eax
+     ee7:	e8 18 ff ff ff       	call   e04 <more>
+     eec:	85 c0                	test   %eax,%eax
+     eee:	74 e5                	je     ed5 <largealloc+0x38>
+  b->h.size = n;
+     ef0:	89 18                	mov    %ebx,(%eax)
+  b->h.class = LARGE;
+     ef2:	c7 40 04 09 00 00 00 	movl   $0x9,0x4(%eax)
+  return &b->h;
+     ef9:	eb da                	jmp    ed5 <largealloc+0x38>
+
+00000efb <free>:
+
+void
+free(void *ap)
+{
+     efb:	55                   	push   %ebp
+     efc:	89 e5                	mov    %esp,%ebp
+     efe:	56                   	push   %esi
+     eff:	53                   	push   %ebx
+     f00:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+
+  if(ap == 0)
+     f03:	85 db                	test   %ebx,%ebx
+     f05:	74 3b                	je     f42 <free+0x47>
+    return;
+  h = (Header*)ap - 1;
+     f07:	8d 73 f8             	lea    -0x8(%ebx),%esi
+  lock_acquire(&lock);
+     f0a:	83 ec 0c             	sub    $0xc,%esp
+     f0d:	68 c0 39 00 00       	push   $0x39c0
+     f12:	e8 9c 01 00 00       	call   10b3 <lock_acquire>
+  if(h->class == LARGE)
+     f17:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     f1a:	83 c4 10             	add    $0x10,%esp
+     f1d:	83 f8 09             	cmp    $0x9,%eax
+     f20:	74 27                	je     f49 <free+0x4e>
+    largefree((Fblock*)h);
+  else {
+    ((Fblock*)h)->next = freelist[h->class];
+     f22:	8b 14 85 e0 39 00 00 	mov    0x39e0(,%eax,4),%edx
+     f29:	89 13                	mov    %edx,(%ebx)
+    freelist[h->class] = (Fblock*)h;
+     f2b:	89 34 85 e0 39 00 00 	mov    %esi,0x39e0(,%eax,4)
+  }
+  lock_release(&lock);
+     f32:	83 ec 0c             	sub    $0xc,%esp
+     f35:	68 c0 39 00 00       	push   $0x39c0
+     f3a:	e8 88 01 00 00       	call   10c7 <lock_release>
+     f3f:	83 c4 10             	add    $0x10,%esp
+}
+     f42:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f45:	5b                   	pop    %ebx
+     f46:	5e                   	pop    %esi
+     f47:	5d                   	pop    %ebp
+     f48:	c3                   	ret
+    largefree((Fblock*)h);
+     f49:	89 f0                	mov    %esi,%eax
+     f4b:	e8 0b fe ff ff       	call   d5b <largefree>
+     f50:	eb e0                	jmp    f32 <free+0x37>
+
+00000f52 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     f52:	55                   	push   %ebp
+     f53:	89 e5                	mov    %esp,%ebp
+     f55:	53                   	push   %ebx
+     f56:	83 ec 04             	sub    $0x4,%esp
+     f59:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+  uint n;
+  int c;
+
+  if(nbytes > 0x7fffffff - sizeof(Header) - 7)
+     f5c:	81 fb f0 ff ff 7f    	cmp    $0x7ffffff0,%ebx
+     f62:	0f 87 8b 00 00 00    	ja     ff3 <malloc+0xa1>
+    return 0;
+  n = (nbytes + sizeof(Header) + 7) & ~7;
+     f68:	83 c3 0f             	add    $0xf,%ebx
+     f6b:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(n < sizeof(Fblock))
+     f6e:	83 fb 0b             	cmp    $0xb,%ebx
+     f71:	77 05                	ja     f78 <malloc+0x26>
+    n = sizeof(Fblock);
+     f73:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  lock_acquire(&lock);
+     f78:	83 ec 0c             	sub    $0xc,%esp
+     f7b:	68 c0 39 00 00       	push   $0x39c0
+     f80:	e8 2e 01 00 00       	call   10b3 <lock_acquire>
+  if(n <= SMALLMAX){
+     f85:	83 c4 10             	add    $0x10,%esp
+     f88:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+     f8e:	77 58                	ja     fe8 <malloc+0x96>
+    for(c = 0; (1 << (MINSHIFT + c)) < n; c++)
+     f90:	ba 00 00 00 00       	mov    $0x0,%edx
+     f95:	eb 03                	jmp    f9a <malloc+0x48>
+     f97:	83 c2 01             	add    $0x1,%edx
+     f9a:	8d 4a 04             	lea    0x4(%edx),%ecx
+     f9d:	b8 01 00 00 00       	mov    $0x1,%eax
+     fa2:	d3 e0                	shl    %cl,%eax
+     fa4:	39 d8                	cmp    %ebx,%eax
+     fa6:	72 ef                	jb     f97 <malloc+0x45>
+      ;
+    if(freelist[c]){
+     fa8:	8b 04 95 e0 39 00 00 	mov    0x39e0(,%edx,4),%eax
+     faf:	85 c0                	test   %eax,%eax
+     fb1:	74 2a                	je     fdd <malloc+0x8b>
+      h = &freelist[c]->h;
+     fb3:	89 c3                	mov    %eax,%ebx
+      freelist[c] = freelist[c]->next;
+     fb5:	8b 40 08             	mov    0x8(%eax),%eax
+     fb8:	89 04 95 e0 39 00 00 	mov    %eax,0x39e0(,%edx,4)
+    } else
+      h = slaballoc(c);
+  } else
+    h = largealloc(n);
+  lock_release(&lock);
+     fbf:	83 ec 0c             	sub    $0xc,%esp
+     fc2:	68 c0 39 00 00       	push   $0x39c0
+     fc7:	e8 fb 00 00 00       	call   10c7 <lock_release>
+  return h ? (void*)(h + 1) : 0;
+     fcc:	83 c4 10             	add    $0x10,%esp
+     fcf:	85 db                	test   %ebx,%ebx
+     fd1:	74 03                	je     fd6 <malloc+0x84>
+     fd3:	83 c3 08             	add    $0x8,%ebx
+}
+     fd6:	89 d8                	mov    %ebx,%eax
+     fd8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     fdb:	c9                   	leave
+     fdc:	c3                   	ret
+      h = slaballoc(c);
+     fdd:	89 d0                	mov    %edx,%eax
+     fdf:	e8 5a fe ff ff       	call   e3e <slaballoc>
+     fe4:	89 c3                	mov    %eax,%ebx
+     fe6:	eb d7                	jmp    fbf <malloc+0x6d>
+    h = largealloc(n);
+     fe8:	89 d8                	mov    %ebx,%eax
+     fea:	e8 ae fe ff ff       	call   e9d <largealloc>
+     fef:	89 c3                	mov    %eax,%ebx
+     ff1:	eb cc                	jmp    fbf <malloc+0x6d>
+    return 0;
+     ff3:	bb 00 00 00 00       	mov    $0x0,%ebx
+     ff8:	eb dc                	jmp    fd6 <malloc+0x84>
+
+00000ffa <tstart>:
+  void *arg;
+};
+
+static void
+tstart(void *a)
+{
+     ffa:	55                   	push   %ebp
+     ffb:	89 e5                	mov    %esp,%ebp
+     ffd:	83 ec 14             	sub    $0x14,%esp
+    1000:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+    1003:	ff 70 04             	push   0x4(%eax)
+    1006:	ff 10                	call   *(%eax)
+  exit();
+    1008:	e8 86 f6 ff ff       	call   693 <exit>
+
+0000100d <thread_create>:
+}
+
+// Run fn(arg) in a new thread.  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    100d:	55                   	push   %ebp
+    100e:	89 e5                	mov    %esp,%ebp
+    1010:	56                   	push   %esi
+    1011:	53                   	push   %ebx
+  struct tstart *t;
+  char *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    1012:	83 ec 0c             	sub    $0xc,%esp
+    1015:	68 00 10 00 00       	push   $0x1000
+    101a:	e8 33 ff ff ff       	call   f52 <malloc>
+    101f:	83 c4 10             	add    $0x10,%esp
+    1022:	85 c0                	test   %eax,%eax
+    1024:	74 42                	je     1068 <thread_create+0x5b>
+    1026:	89 c3                	mov    %eax,%ebx
+    return -1;
+  t = (struct tstart*)stack;
+  t->fn = fn;
+    1028:	8b 45 08             	mov    0x8(%ebp),%eax
+    102b:	89 03                	mov    %eax,(%ebx)
+  t->arg = arg;
+    102d:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1030:	89 43 04             	mov    %eax,0x4(%ebx)
+  if((pid = clone(tstart, stack + TSTACK, t)) < 0)
+    1033:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    1039:	83 ec 04             	sub    $0x4,%esp
+    103c:	53                   	push   %ebx
+    103d:	50                   	push   %eax
+    103e:	68 fa 0f 00 00       	push   $0xffa
+    1043:	e8 f5 f8 ff ff       	call   93d <clone>
+    1048:	89 c6                	mov    %eax,%esi
+    104a:	83 c4 10             	add    $0x10,%esp
+    104d:	85 c0                	test   %eax,%eax
+    104f:	78 09                	js     105a <thread_create+0x4d>
+    free(stack);
+  return pid;
+}
+    1051:	89 f0                	mov    %esi,%eax
+    1053:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1056:	5b                   	pop    %ebx
+    1057:	5e                   	pop    %esi
+    1058:	5d                   	pop    %ebp
+    1059:	c3                   	ret
+    free(stack);
+    105a:	83 ec 0c             	sub    $0xc,%esp
+    105d:	53                   	push   %ebx
+    105e:	e8 98 fe ff ff       	call   efb <free>
+    1063:	83 c4 10             	add    $0x10,%esp
+    1066:	eb e9                	jmp    1051 <thread_create+0x44>
+    return -1;
+    1068:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    106d:	eb e2                	jmp    1051 <thread_create+0x44>
+
+0000106f <thread_join>:
+
+// Wait for one of this process's threads to exit and free its
+// stack.  Returns its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+    106f:	55                   	push   %ebp
+    1070:	89 e5                	mov    %esp,%ebp
+    1072:	53                   	push   %ebx
+    1073:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    1076:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1079:	50                   	push   %eax
+    107a:	e8 cd f8 ff ff       	call   94c <join>
+    107f:	89 c3                	mov    %eax,%ebx
+    1081:	83 c4 10             	add    $0x10,%esp
+    1084:	85 c0                	test   %eax,%eax
+    1086:	79 07                	jns    108f <thread_join+0x20>
+    free((char*)stack - TSTACK);
+  return pid;
+}
+    1088:	89 d8                	mov    %ebx,%eax
+    108a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    108d:	c9                   	leave
+    108e:	c3                   	ret
+    free((char*)stack - TSTACK);
+    108f:	83 ec 0c             	sub    $0xc,%esp
+    1092:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1095:	2d 00 10 00 00       	sub    $0x1000,%eax
+    109a:	50                   	push   %eax
+    109b:	e8 5b fe ff ff       	call   efb <free>
+    10a0:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    10a3:	eb e3                	jmp    1088 <thread_join+0x19>
+
+000010a5 <lock_init>:
+
+void
+lock_init(lock_t *lk)
+{
+    10a5:	55                   	push   %ebp
+    10a6:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    10a8:	8b 45 08             	mov    0x8(%ebp),%eax
+    10ab:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    10b1:	5d                   	pop    %ebp
+    10b2:	c3                   	ret
+
+000010b3 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+    10b3:	55                   	push   %ebp
+    10b4:	89 e5                	mov    %esp,%ebp
+    10b6:	8b 55 08             	mov    0x8(%ebp),%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    10b9:	b8 01 00 00 00       	mov    $0x1,%eax
+    10be:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    10c1:	85 c0                	test   %eax,%eax
+    10c3:	75 f4                	jne    10b9 <lock_acquire+0x6>
+    ;
+}
+    10c5:	5d                   	pop    %ebp
+    10c6:	c3                   	ret
+
+000010c7 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+    10c7:	55                   	push   %ebp
+    10c8:	89 e5                	mov    %esp,%ebp
+    10ca:	8b 55 08             	mov    0x8(%ebp),%edx
+    10cd:	b8 00 00 00 00       	mov    $0x0,%eax
+    10d2:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    10d5:	5d                   	pop    %ebp
+    10d6:	c3                   	ret
+
+000010d7 <mutex_init>:
+// Are Tricky": state is 0 when free, 1 when held, 2 when held and
+// others may be waiting.  Unlocking an uncontended mutex costs no
+// system call.
+void
+mutex_init(mutex_t *m)
+{
+    10d7:	55                   	push   %ebp
+    10d8:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    10da:	8b 45 08             	mov    0x8(%ebp),%eax
+    10dd:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    10e3:	5d                   	pop    %ebp
+    10e4:	c3                   	ret
+
+000010e5 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+    10e5:	55                   	push   %ebp
+    10e6:	89 e5                	mov    %esp,%ebp
+    10e8:	53                   	push   %ebx
+    10e9:	83 ec 04             	sub    $0x4,%esp
+    10ec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    10ef:	b8 00 00 00 00       	mov    $0x0,%eax
+    10f4:	b9 01 00 00 00       	mov    $0x1,%ecx
+    10f9:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    10fd:	85 c0                	test   %eax,%eax
+    10ff:	74 29                	je     112a <mutex_lock+0x45>
+    return;
+  if(c != 2)
+    1101:	83 f8 02             	cmp    $0x2,%eax
+    1104:	74 20                	je     1126 <mutex_lock+0x41>
+    1106:	b8 02 00 00 00       	mov    $0x2,%eax
+    110b:	f0 87 03             	lock xchg %eax,(%ebx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    110e:	eb 16                	jmp    1126 <mutex_lock+0x41>
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    1110:	83 ec 08             	sub    $0x8,%esp
+    1113:	6a 02                	push   $0x2
+    1115:	53                   	push   %ebx
+    1116:	e8 40 f8 ff ff       	call   95b <futex_wait>
+  asm volatile("lock; xchgl %0, %1" :
+    111b:	b8 02 00 00 00       	mov    $0x2,%eax
+    1120:	f0 87 03             	lock xchg %eax,(%ebx)
+    1123:	83 c4 10             	add    $0x10,%esp
+  while(c != 0){
+    1126:	85 c0                	test   %eax,%eax
+    1128:	75 e6                	jne    1110 <mutex_lock+0x2b>
+    c = xchg(&m->state, 2);
+  }
+}
+    112a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    112d:	c9                   	leave
+    112e:	c3                   	ret
+
+0000112f <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+    112f:	55                   	push   %ebp
+    1130:	89 e5                	mov    %esp,%ebp
+    1132:	83 ec 08             	sub    $0x8,%esp
+    1135:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    1138:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    113d:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    1141:	83 fa 01             	cmp    $0x1,%edx
+    1144:	75 02                	jne    1148 <mutex_unlock+0x19>
+    m->state = 0;
+    futex_wake(&m->state, 1);
+  }
+}
+    1146:	c9                   	leave
+    1147:	c3                   	ret
+    m->state = 0;
+    1148:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+    114e:	83 ec 08             	sub    $0x8,%esp
+    1151:	6a 01                	push   $0x1
+    1153:	50                   	push   %eax
+    1154:	e8 11 f8 ff ff       	call   96a <futex_wake>
+    1159:	83 c4 10             	add    $0x10,%esp
+}
+    115c:	eb e8                	jmp    1146 <mutex_unlock+0x17>
+
+0000115e <cond_init>:
+// Condition variable: waiters sleep on a sequence number that
+// every signal bumps, so a signal between the unlock and the
+// futex_wait() in cond_wait() is not lost.
+void
+cond_init(cond_t *c)
+{
+    115e:	55                   	push   %ebp
+    115f:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    1161:	8b 45 08             	mov    0x8(%ebp),%eax
+    1164:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    116a:	5d                   	pop    %ebp
+    116b:	c3                   	ret
+
+0000116c <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+    116c:	55                   	push   %ebp
+    116d:	89 e5                	mov    %esp,%ebp
+    116f:	57                   	push   %edi
+    1170:	56                   	push   %esi
+    1171:	53                   	push   %ebx
+    1172:	83 ec 18             	sub    $0x18,%esp
+    1175:	8b 75 08             	mov    0x8(%ebp),%esi
+    1178:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    117b:	8b 3e                	mov    (%esi),%edi
+  mutex_unlock(m);
+    117d:	53                   	push   %ebx
+    117e:	e8 ac ff ff ff       	call   112f <mutex_unlock>
+  futex_wait(&c->seq, seq);
+    1183:	83 c4 08             	add    $0x8,%esp
+    1186:	57                   	push   %edi
+    1187:	56                   	push   %esi
+    1188:	e8 ce f7 ff ff       	call   95b <futex_wait>
+  // Others may be waiting for m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+    118d:	83 c4 10             	add    $0x10,%esp
+    1190:	eb 0e                	jmp    11a0 <cond_wait+0x34>
+    futex_wait(&m->state, 2);
+    1192:	83 ec 08             	sub    $0x8,%esp
+    1195:	6a 02                	push   $0x2
+    1197:	53                   	push   %ebx
+    1198:	e8 be f7 ff ff       	call   95b <futex_wait>
+    119d:	83 c4 10             	add    $0x10,%esp
+    11a0:	b8 02 00 00 00       	mov    $0x2,%eax
+    11a5:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    11a8:	85 c0                	test   %eax,%eax
+    11aa:	75 e6                	jne    1192 <cond_wait+0x26>
+}
+    11ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11af:	5b                   	pop    %ebx
+    11b0:	5e                   	pop    %esi
+    11b1:	5f                   	pop    %edi
+    11b2:	5d                   	pop    %ebp
+    11b3:	c3                   	ret
+
+000011b4 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+    11b4:	55                   	push   %ebp
+    11b5:	89 e5                	mov    %esp,%ebp
+    11b7:	83 ec 10             	sub    $0x10,%esp
+    11ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    11bd:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+    11c1:	6a 01                	push   $0x1
+    11c3:	50                   	push   %eax
+    11c4:	e8 a1 f7 ff ff       	call   96a <futex_wake>
+}
+    11c9:	83 c4 10             	add    $0x10,%esp
+    11cc:	c9                   	leave
+    11cd:	c3                   	ret
+
+000011ce <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+    11ce:	55                   	push   %ebp
+    11cf:	89 e5                	mov    %esp,%ebp
+    11d1:	83 ec 10             	sub    $0x10,%esp
+    11d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    11d7:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, NPROC);
+    11db:	6a 40                	push   $0x40
+    11dd:	50                   	push   %eax
+    11de:	e8 87 f7 ff ff       	call   96a <futex_wake>
+}
+    11e3:	83 c4 10             	add    $0x10,%esp
+    11e6:	c9                   	leave
+    11e7:	c3                   	ret
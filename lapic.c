@@ -42,6 +42,7 @@
 #define TDCR    (0x03E0/4)   // Timer Divide Configuration
 
 volatile uint *lapic;  // Initialized in mp.c
+static uint tickcount = 10000000;  // TICR for one tick, see lapiccalibrate()
 
 //PAGEBREAK!
 static void
@@ -62,11 +63,10 @@ lapicinit(void)
 
   // The timer repeatedly counts down at bus frequency
   // from lapic[TICR] and then issues an interrupt.
-  // If xv6 cared more about precise timekeeping,
-  // TICR would be calibrated using an external time source.
-  lapicw(TDCR, X1);
-  lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
-  lapicw(TICR, 10000000);
+  // CPU 0 calibrates TICR against the PIT in clockinit(),
+  // before the other CPUs get here, and then switches its
+  // own timer to one-shot mode for the timer wheel (timer.c).
+  lapictimer(tickcount, 1);
 
   // Disable logical interrupt lines.
   lapicw(LINT0, MASKED);
@@ -105,6 +105,45 @@ lapicid(void)
   return lapic[ID] >> 24;
 }
 
+// Start this CPU's timer counting down from count, at bus
+// frequency.  A periodic timer reloads count and goes on.
+void
+lapictimer(uint count, int periodic)
+{
+  if(!lapic)
+    return;
+  lapicw(TDCR, X1);
+  lapicw(TIMER, (periodic ? PERIODIC : 0) | (T_IRQ0 + IRQ_TIMER));
+  lapicw(TICR, count);
+}
+
+// Interrupt once, ns from now.
+void
+lapiconeshot(uint ns)
+{
+  uint rem, count;
+
+  count = divl((uint64)ns * tickcount, TICKNS, &rem);
+  lapictimer(count ? count : 1, 0);
+}
+
+// What is left of the current count.
+uint
+lapiccount(void)
+{
+  if(!lapic)
+    return 0;
+  return lapic[TCCR];
+}
+
+// Counts per tick, as measured by clockinit().
+void
+lapiccalibrate(uint count)
+{
+  if(count)
+    tickcount = count;
+}
+
 // Acknowledge interrupt.
 void
 lapiceoi(void)
@@ -113,11 +152,16 @@ lapiceoi(void)
     lapicw(EOI, 0);
 }
 
-// Spin for a given number of microseconds.
-// On real hardware would want to tune this dynamically.
+// Send interrupt vector to the CPU whose local APIC id is apicid.
 void
-microdelay(int us)
+lapicipi(int apicid, int vector)
 {
+  if(!lapic)
+    return;
+  lapicw(ICRHI, apicid<<24);
+  lapicw(ICRLO, FIXED | vector);
+  while(lapic[ICRLO] & DELIVS)
+    ;
 }
 
 #define CMOS_PORT    0x70
@@ -125,10 +169,13 @@ microdelay(int us)
 
 // Start additional processor running entry code at addr.
 // See Appendix B of MultiProcessor Specification.
+// The n processors in apicid[] go through the sequence together,
+// so starting them all takes the delays only once.  Each IPI is
+// delivered before the next is written to the ICR.
 void
-lapicstartap(uchar apicid, uint addr)
+lapicstartap(uchar *apicid, int n, uint addr)
 {
-  int i;
+  int i, j;
   ushort *wrv;
 
   // "The BSP must initialize CMOS shutdown code to 0AH
@@ -142,10 +189,19 @@ lapicstartap(uchar apicid, uint addr)
 
   // "Universal startup algorithm."
   // Send INIT (level-triggered) interrupt to reset other CPU.
-  lapicw(ICRHI, apicid<<24);
-  lapicw(ICRLO, INIT | LEVEL | ASSERT);
+  for(j = 0; j < n; j++){
+    lapicw(ICRHI, apicid[j]<<24);
+    lapicw(ICRLO, INIT | LEVEL | ASSERT);
+    while(lapic[ICRLO] & DELIVS)
+      ;
+  }
   microdelay(200);
-  lapicw(ICRLO, INIT | LEVEL);
+  for(j = 0; j < n; j++){
+    lapicw(ICRHI, apicid[j]<<24);
+    lapicw(ICRLO, INIT | LEVEL);
+    while(lapic[ICRLO] & DELIVS)
+      ;
+  }
   microdelay(100);    // should be 10ms, but too slow in Bochs!
 
   // Send startup IPI (twice!) to enter code.
@@ -154,8 +210,12 @@ lapicstartap(uchar apicid, uint addr)
   // should be ignored, but it is part of the official Intel algorithm.
   // Bochs complains about the second one.  Too bad for Bochs.
   for(i = 0; i < 2; i++){
-    lapicw(ICRHI, apicid<<24);
-    lapicw(ICRLO, STARTUP | (addr>>12));
+    for(j = 0; j < n; j++){
+      lapicw(ICRHI, apicid[j]<<24);
+      lapicw(ICRLO, STARTUP | (addr>>12));
+      while(lapic[ICRLO] & DELIVS)
+        ;
+    }
     microdelay(200);
   }
 }
@@ -0,0 +1,2742 @@
+
+_ln:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	53                   	push   %ebx
+       e:	51                   	push   %ecx
+       f:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc != 3){
+      12:	83 39 03             	cmpl   $0x3,(%ecx)
+      15:	74 14                	je     2b <main+0x2b>
+    printf(2, "Usage: ln old new\n");
+      17:	83 ec 08             	sub    $0x8,%esp
+      1a:	68 ec 11 00 00       	push   $0x11ec
+      1f:	6a 02                	push   $0x2
+      21:	e8 a7 0b 00 00       	call   bcd <printf>
+    exit();
+      26:	e8 69 06 00 00       	call   694 <exit>
+  }
+  if(link(argv[1], argv[2]) < 0)
+      2b:	83 ec 08             	sub    $0x8,%esp
+      2e:	ff 73 08             	push   0x8(%ebx)
+      31:	ff 73 04             	push   0x4(%ebx)
+      34:	e8 e8 07 00 00       	call   821 <link>
+      39:	83 c4 10             	add    $0x10,%esp
+      3c:	85 c0                	test   %eax,%eax
+      3e:	78 05                	js     45 <main+0x45>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  exit();
+      40:	e8 4f 06 00 00       	call   694 <exit>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+      45:	ff 73 08             	push   0x8(%ebx)
+      48:	ff 73 04             	push   0x4(%ebx)
+      4b:	68 ff 11 00 00       	push   $0x11ff
+      50:	6a 02                	push   $0x2
+      52:	e8 76 0b 00 00       	call   bcd <printf>
+      57:	83 c4 10             	add    $0x10,%esp
+      5a:	eb e4                	jmp    40 <main+0x40>
+
+0000005c <strcpy>:
+#include "memlayout.h"
+#include "clock.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+      5c:	55                   	push   %ebp
+      5d:	89 e5                	mov    %esp,%ebp
+      5f:	56                   	push   %esi
+      60:	53                   	push   %ebx
+      61:	8b 75 08             	mov    0x8(%ebp),%esi
+      64:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+      67:	89 f0                	mov    %esi,%eax
+      69:	89 d1                	mov    %edx,%ecx
+      6b:	83 c2 01             	add    $0x1,%edx
+      6e:	89 c3                	mov    %eax,%ebx
+      70:	83 c0 01             	add    $0x1,%eax
+      73:	0f b6 09             	movzbl (%ecx),%ecx
+      76:	88 0b                	mov    %cl,(%ebx)
+      78:	84 c9                	test   %cl,%cl
+      7a:	75 ed                	jne    69 <strcpy+0xd>
+    ;
+  return os;
+}
+      7c:	89 f0                	mov    %esi,%eax
+      7e:	5b                   	pop    %ebx
+      7f:	5e                   	pop    %esi
+      80:	5d                   	pop    %ebp
+      81:	c3                   	ret
+
+00000082 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+      82:	55                   	push   %ebp
+      83:	89 e5                	mov    %esp,%ebp
+      85:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      88:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+      8b:	eb 06                	jmp    93 <strcmp+0x11>
+    p++, q++;
+      8d:	83 c1 01             	add    $0x1,%ecx
+      90:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+      93:	0f b6 01             	movzbl (%ecx),%eax
+      96:	84 c0                	test   %al,%al
+      98:	74 04                	je     9e <strcmp+0x1c>
+      9a:	3a 02                	cmp    (%edx),%al
+      9c:	74 ef                	je     8d <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+      9e:	0f b6 c0             	movzbl %al,%eax
+      a1:	0f b6 12             	movzbl (%edx),%edx
+      a4:	29 d0                	sub    %edx,%eax
+}
+      a6:	5d                   	pop    %ebp
+      a7:	c3                   	ret
+
+000000a8 <strlen>:
+
+uint
+strlen(const char *s)
+{
+      a8:	55                   	push   %ebp
+      a9:	89 e5                	mov    %esp,%ebp
+      ab:	53                   	push   %ebx
+      ac:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  const char *p;
+  uint w;
+
+  for(p = s; (uint)p & 3; p++)
+      af:	89 c8                	mov    %ecx,%eax
+      b1:	eb 03                	jmp    b6 <strlen+0xe>
+      b3:	83 c0 01             	add    $0x1,%eax
+      b6:	a8 03                	test   $0x3,%al
+      b8:	74 09                	je     c3 <strlen+0x1b>
+    if(*p == 0)
+      ba:	80 38 00             	cmpb   $0x0,(%eax)
+      bd:	75 f4                	jne    b3 <strlen+0xb>
+      return p - s;
+      bf:	29 c8                	sub    %ecx,%eax
+      c1:	eb 25                	jmp    e8 <strlen+0x40>
+  // Then a word at a time, which never crosses into the next page:
+  // a word with a zero byte in it has one of these bits set.
+  for(;; p += 4){
+    w = *(uint*)p;
+      c3:	8b 10                	mov    (%eax),%edx
+    if((w - 0x01010101) & ~w & 0x80808080)
+      c5:	8d 9a ff fe fe fe    	lea    -0x1010101(%edx),%ebx
+      cb:	f7 d2                	not    %edx
+      cd:	21 da                	and    %ebx,%edx
+      cf:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+      d5:	75 05                	jne    dc <strlen+0x34>
+  for(;; p += 4){
+      d7:	83 c0 04             	add    $0x4,%eax
+    w = *(uint*)p;
+      da:	eb e7                	jmp    c3 <strlen+0x1b>
+      break;
+  }
+  while(*p)
+      dc:	80 38 00             	cmpb   $0x0,(%eax)
+      df:	74 05                	je     e6 <strlen+0x3e>
+    p++;
+      e1:	83 c0 01             	add    $0x1,%eax
+      e4:	eb f6                	jmp    dc <strlen+0x34>
+  return p - s;
+      e6:	29 c8                	sub    %ecx,%eax
+}
+      e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      eb:	c9                   	leave
+      ec:	c3                   	ret
+
+000000ed <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+      ed:	55                   	push   %ebp
+      ee:	89 e5                	mov    %esp,%ebp
+      f0:	57                   	push   %edi
+      f1:	56                   	push   %esi
+      f2:	53                   	push   %ebx
+      f3:	8b 55 10             	mov    0x10(%ebp),%edx
+  uint h;
+  char *d;
+
+  d = dst;
+  c &= 0xFF;
+      f6:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  if(n >= 16){
+      fa:	83 fa 0f             	cmp    $0xf,%edx
+      fd:	76 52                	jbe    151 <memset+0x64>
+    h = -(uint)d & 3;
+      ff:	8b 45 08             	mov    0x8(%ebp),%eax
+     102:	f7 d8                	neg    %eax
+     104:	83 e0 03             	and    $0x3,%eax
+     107:	89 c6                	mov    %eax,%esi
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     109:	8b 7d 08             	mov    0x8(%ebp),%edi
+     10c:	89 c1                	mov    %eax,%ecx
+     10e:	89 d8                	mov    %ebx,%eax
+     110:	fc                   	cld
+     111:	f3 aa                	rep stos %al,%es:(%edi)
+    stosb(d, c, h);
+    stosl(d + h, (c<<24)|(c<<16)|(c<<8)|c, (n - h)/4);
+     113:	29 f2                	sub    %esi,%edx
+     115:	89 d1                	mov    %edx,%ecx
+     117:	c1 e9 02             	shr    $0x2,%ecx
+     11a:	c1 e0 18             	shl    $0x18,%eax
+     11d:	89 df                	mov    %ebx,%edi
+     11f:	c1 e7 10             	shl    $0x10,%edi
+     122:	09 f8                	or     %edi,%eax
+     124:	89 df                	mov    %ebx,%edi
+     126:	c1 e7 08             	shl    $0x8,%edi
+     129:	09 f8                	or     %edi,%eax
+     12b:	09 d8                	or     %ebx,%eax
+     12d:	89 f7                	mov    %esi,%edi
+     12f:	03 7d 08             	add    0x8(%ebp),%edi
+}
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosl" :
+     132:	fc                   	cld
+     133:	f3 ab                	rep stos %eax,%es:(%edi)
+    d += h + (n - h)/4*4;
+     135:	89 d7                	mov    %edx,%edi
+     137:	83 e7 fc             	and    $0xfffffffc,%edi
+     13a:	09 f7                	or     %esi,%edi
+     13c:	03 7d 08             	add    0x8(%ebp),%edi
+    n = (n - h)%4;
+     13f:	83 e2 03             	and    $0x3,%edx
+  asm volatile("cld; rep stosb" :
+     142:	89 d1                	mov    %edx,%ecx
+     144:	89 d8                	mov    %ebx,%eax
+     146:	fc                   	cld
+     147:	f3 aa                	rep stos %al,%es:(%edi)
+  }
+  stosb(d, c, n);
+  return dst;
+}
+     149:	8b 45 08             	mov    0x8(%ebp),%eax
+     14c:	5b                   	pop    %ebx
+     14d:	5e                   	pop    %esi
+     14e:	5f                   	pop    %edi
+     14f:	5d                   	pop    %ebp
+     150:	c3                   	ret
+  d = dst;
+     151:	8b 7d 08             	mov    0x8(%ebp),%edi
+     154:	eb ec                	jmp    142 <memset+0x55>
+
+00000156 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     156:	55                   	push   %ebp
+     157:	89 e5                	mov    %esp,%ebp
+     159:	8b 45 08             	mov    0x8(%ebp),%eax
+     15c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     160:	eb 03                	jmp    165 <strchr+0xf>
+     162:	83 c0 01             	add    $0x1,%eax
+     165:	0f b6 10             	movzbl (%eax),%edx
+     168:	84 d2                	test   %dl,%dl
+     16a:	74 06                	je     172 <strchr+0x1c>
+    if(*s == c)
+     16c:	38 ca                	cmp    %cl,%dl
+     16e:	75 f2                	jne    162 <strchr+0xc>
+     170:	eb 05                	jmp    177 <strchr+0x21>
+      return (char*)s;
+  return 0;
+     172:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     177:	5d                   	pop    %ebp
+     178:	c3                   	ret
+
+00000179 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     179:	55                   	push   %ebp
+     17a:	89 e5                	mov    %esp,%ebp
+     17c:	56                   	push   %esi
+     17d:	53                   	push   %ebx
+     17e:	8b 55 08             	mov    0x8(%ebp),%edx
+     181:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     184:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  // A word at a time while they agree.
+  if((((uint)s1 | (uint)s2) & 3) == 0)
+     187:	89 d3                	mov    %edx,%ebx
+     189:	09 cb                	or     %ecx,%ebx
+     18b:	f6 c3 03             	test   $0x3,%bl
+     18e:	74 24                	je     1b4 <memcmp+0x3b>
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+      s1 += 4, s2 += 4;
+  while(n-- > 0){
+     190:	8d 70 ff             	lea    -0x1(%eax),%esi
+     193:	85 c0                	test   %eax,%eax
+     195:	74 32                	je     1c9 <memcmp+0x50>
+    if(*s1 != *s2)
+     197:	0f b6 02             	movzbl (%edx),%eax
+     19a:	0f b6 19             	movzbl (%ecx),%ebx
+     19d:	38 d8                	cmp    %bl,%al
+     19f:	75 20                	jne    1c1 <memcmp+0x48>
+      return *s1 - *s2;
+    s1++, s2++;
+     1a1:	83 c2 01             	add    $0x1,%edx
+     1a4:	83 c1 01             	add    $0x1,%ecx
+  while(n-- > 0){
+     1a7:	89 f0                	mov    %esi,%eax
+     1a9:	eb e5                	jmp    190 <memcmp+0x17>
+      s1 += 4, s2 += 4;
+     1ab:	83 c2 04             	add    $0x4,%edx
+     1ae:	83 c1 04             	add    $0x4,%ecx
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+     1b1:	83 e8 04             	sub    $0x4,%eax
+     1b4:	83 f8 03             	cmp    $0x3,%eax
+     1b7:	76 d7                	jbe    190 <memcmp+0x17>
+     1b9:	8b 31                	mov    (%ecx),%esi
+     1bb:	39 32                	cmp    %esi,(%edx)
+     1bd:	74 ec                	je     1ab <memcmp+0x32>
+     1bf:	eb cf                	jmp    190 <memcmp+0x17>
+      return *s1 - *s2;
+     1c1:	0f b6 c0             	movzbl %al,%eax
+     1c4:	0f b6 db             	movzbl %bl,%ebx
+     1c7:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     1c9:	5b                   	pop    %ebx
+     1ca:	5e                   	pop    %esi
+     1cb:	5d                   	pop    %ebp
+     1cc:	c3                   	ret
+
+000001cd <memchr>:
+// The first c in the n bytes at v, or 0.  Once aligned, a word at
+// a time, with the word's bytes that equal c turned into zeroes
+// and those looked for.
+void*
+memchr(const void *v, int c, uint n)
+{
+     1cd:	55                   	push   %ebp
+     1ce:	89 e5                	mov    %esp,%ebp
+     1d0:	57                   	push   %edi
+     1d1:	56                   	push   %esi
+     1d2:	53                   	push   %ebx
+     1d3:	8b 45 08             	mov    0x8(%ebp),%eax
+     1d6:	8b 55 10             	mov    0x10(%ebp),%edx
+  const uchar *s;
+  uint w, rep;
+
+  s = v;
+  c = (uchar)c;
+     1d9:	0f b6 75 0c          	movzbl 0xc(%ebp),%esi
+  for(; n > 0 && ((uint)s & 3); n--, s++)
+     1dd:	eb 06                	jmp    1e5 <memchr+0x18>
+     1df:	83 ea 01             	sub    $0x1,%edx
+     1e2:	83 c0 01             	add    $0x1,%eax
+     1e5:	85 d2                	test   %edx,%edx
+     1e7:	74 0d                	je     1f6 <memchr+0x29>
+     1e9:	a8 03                	test   $0x3,%al
+     1eb:	74 09                	je     1f6 <memchr+0x29>
+    if(*s == c)
+     1ed:	0f b6 08             	movzbl (%eax),%ecx
+     1f0:	39 f1                	cmp    %esi,%ecx
+     1f2:	75 eb                	jne    1df <memchr+0x12>
+     1f4:	eb 41                	jmp    237 <memchr+0x6a>
+      return (void*)s;
+  rep = c * 0x01010101;
+     1f6:	69 fe 01 01 01 01    	imul   $0x1010101,%esi,%edi
+  for(; n >= 4; n -= 4, s += 4){
+     1fc:	eb 06                	jmp    204 <memchr+0x37>
+     1fe:	83 ea 04             	sub    $0x4,%edx
+     201:	83 c0 04             	add    $0x4,%eax
+     204:	83 fa 03             	cmp    $0x3,%edx
+     207:	76 16                	jbe    21f <memchr+0x52>
+    w = *(uint*)s ^ rep;
+     209:	89 f9                	mov    %edi,%ecx
+     20b:	33 08                	xor    (%eax),%ecx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     20d:	8d 99 ff fe fe fe    	lea    -0x1010101(%ecx),%ebx
+     213:	f7 d1                	not    %ecx
+     215:	21 cb                	and    %ecx,%ebx
+     217:	f7 c3 80 80 80 80    	test   $0x80808080,%ebx
+     21d:	74 df                	je     1fe <memchr+0x31>
+      break;
+  }
+  for(; n > 0; n--, s++)
+     21f:	85 d2                	test   %edx,%edx
+     221:	74 0f                	je     232 <memchr+0x65>
+    if(*s == c)
+     223:	0f b6 08             	movzbl (%eax),%ecx
+     226:	39 f1                	cmp    %esi,%ecx
+     228:	74 0d                	je     237 <memchr+0x6a>
+  for(; n > 0; n--, s++)
+     22a:	83 ea 01             	sub    $0x1,%edx
+     22d:	83 c0 01             	add    $0x1,%eax
+     230:	eb ed                	jmp    21f <memchr+0x52>
+      return (void*)s;
+  return 0;
+     232:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     237:	5b                   	pop    %ebx
+     238:	5e                   	pop    %esi
+     239:	5f                   	pop    %edi
+     23a:	5d                   	pop    %ebp
+     23b:	c3                   	ret
+
+0000023c <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     23c:	55                   	push   %ebp
+     23d:	89 e5                	mov    %esp,%ebp
+     23f:	57                   	push   %edi
+     240:	56                   	push   %esi
+     241:	53                   	push   %ebx
+     242:	83 ec 1c             	sub    $0x1c,%esp
+     245:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     248:	bb 00 00 00 00       	mov    $0x0,%ebx
+     24d:	89 de                	mov    %ebx,%esi
+     24f:	83 c3 01             	add    $0x1,%ebx
+     252:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     255:	7d 2e                	jge    285 <gets+0x49>
+    cc = read(0, &c, 1);
+     257:	83 ec 04             	sub    $0x4,%esp
+     25a:	6a 01                	push   $0x1
+     25c:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     25f:	50                   	push   %eax
+     260:	6a 00                	push   $0x0
+     262:	e8 51 05 00 00       	call   7b8 <read>
+    if(cc < 1)
+     267:	83 c4 10             	add    $0x10,%esp
+     26a:	85 c0                	test   %eax,%eax
+     26c:	7e 17                	jle    285 <gets+0x49>
+      break;
+    buf[i++] = c;
+     26e:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     272:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+     275:	3c 0a                	cmp    $0xa,%al
+     277:	0f 94 c2             	sete   %dl
+     27a:	3c 0d                	cmp    $0xd,%al
+     27c:	0f 94 c0             	sete   %al
+     27f:	08 c2                	or     %al,%dl
+     281:	74 ca                	je     24d <gets+0x11>
+    buf[i++] = c;
+     283:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+     285:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+     289:	89 f8                	mov    %edi,%eax
+     28b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     28e:	5b                   	pop    %ebx
+     28f:	5e                   	pop    %esi
+     290:	5f                   	pop    %edi
+     291:	5d                   	pop    %ebp
+     292:	c3                   	ret
+
+00000293 <atoi>:
+  return r;
+}
+
+int
+atoi(const char *s)
+{
+     293:	55                   	push   %ebp
+     294:	89 e5                	mov    %esp,%ebp
+     296:	53                   	push   %ebx
+     297:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+     29a:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+     29f:	eb 10                	jmp    2b1 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+     2a1:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+     2a4:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+     2a7:	83 c1 01             	add    $0x1,%ecx
+     2aa:	0f be c0             	movsbl %al,%eax
+     2ad:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+     2b1:	0f b6 01             	movzbl (%ecx),%eax
+     2b4:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     2b7:	80 fb 09             	cmp    $0x9,%bl
+     2ba:	76 e5                	jbe    2a1 <atoi+0xe>
+  return n;
+}
+     2bc:	89 d0                	mov    %edx,%eax
+     2be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2c1:	c9                   	leave
+     2c2:	c3                   	ret
+
+000002c3 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     2c3:	55                   	push   %ebp
+     2c4:	89 e5                	mov    %esp,%ebp
+     2c6:	57                   	push   %edi
+     2c7:	56                   	push   %esi
+     2c8:	53                   	push   %ebx
+     2c9:	83 ec 08             	sub    $0x8,%esp
+     2cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     2cf:	8b 55 0c             	mov    0xc(%ebp),%edx
+     2d2:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *src;
+  int h;
+
+  dst = vdst;
+  src = vsrc;
+  if(n <= 0)
+     2d5:	85 c0                	test   %eax,%eax
+     2d7:	0f 8e 82 00 00 00    	jle    35f <memmove+0x9c>
+    return vdst;
+  if(src < dst && src + n > dst){
+     2dd:	39 da                	cmp    %ebx,%edx
+     2df:	73 07                	jae    2e8 <memmove+0x25>
+     2e1:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+     2e4:	39 cb                	cmp    %ecx,%ebx
+     2e6:	72 5e                	jb     346 <memmove+0x83>
+    movsbback(dst + n - 1, src + n - 1, n);
+    return vdst;
+  }
+  if(n >= 16 && (((uint)dst ^ (uint)src) & 3) == 0){
+     2e8:	83 f8 0f             	cmp    $0xf,%eax
+     2eb:	7e 69                	jle    356 <memmove+0x93>
+     2ed:	89 d9                	mov    %ebx,%ecx
+     2ef:	31 d1                	xor    %edx,%ecx
+     2f1:	f6 c1 03             	test   $0x3,%cl
+     2f4:	75 73                	jne    369 <memmove+0xa6>
+    h = -(uint)dst & 3;
+     2f6:	89 d9                	mov    %ebx,%ecx
+     2f8:	f7 d9                	neg    %ecx
+     2fa:	83 e1 03             	and    $0x3,%ecx
+}
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsb" :
+     2fd:	89 df                	mov    %ebx,%edi
+     2ff:	89 d6                	mov    %edx,%esi
+     301:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+     304:	fc                   	cld
+     305:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    movsb(dst, src, h);
+    dst += h, src += h, n -= h;
+     307:	8b 75 f0             	mov    -0x10(%ebp),%esi
+     30a:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+     30d:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+     310:	29 f0                	sub    %esi,%eax
+    movsl(dst, src, n/4);
+     312:	8d 50 03             	lea    0x3(%eax),%edx
+     315:	0f 49 d0             	cmovns %eax,%edx
+     318:	c1 fa 02             	sar    $0x2,%edx
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+     31b:	89 7d f0             	mov    %edi,-0x10(%ebp)
+     31e:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     321:	89 ce                	mov    %ecx,%esi
+     323:	89 d1                	mov    %edx,%ecx
+     325:	fc                   	cld
+     326:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    dst += n/4*4, src += n/4*4, n %= 4;
+     328:	c1 e2 02             	shl    $0x2,%edx
+     32b:	8b 7d f0             	mov    -0x10(%ebp),%edi
+     32e:	01 d7                	add    %edx,%edi
+     330:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     333:	01 ca                	add    %ecx,%edx
+     335:	89 c6                	mov    %eax,%esi
+     337:	c1 fe 1f             	sar    $0x1f,%esi
+     33a:	c1 ee 1e             	shr    $0x1e,%esi
+     33d:	01 f0                	add    %esi,%eax
+     33f:	83 e0 03             	and    $0x3,%eax
+     342:	29 f0                	sub    %esi,%eax
+     344:	eb 12                	jmp    358 <memmove+0x95>
+    movsbback(dst + n - 1, src + n - 1, n);
+     346:	8d 78 ff             	lea    -0x1(%eax),%edi
+     349:	8d 34 3a             	lea    (%edx,%edi,1),%esi
+     34c:	01 df                	add    %ebx,%edi
+// Copy cnt bytes down from the last ones, at dst and src, to the
+// first: for overlapping moves up.
+static inline void
+movsbback(void *dst, const void *src, int cnt)
+{
+  asm volatile("std; rep movsb; cld" :
+     34e:	89 c1                	mov    %eax,%ecx
+     350:	fd                   	std
+     351:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     353:	fc                   	cld
+    return vdst;
+     354:	eb 09                	jmp    35f <memmove+0x9c>
+  dst = vdst;
+     356:	89 df                	mov    %ebx,%edi
+  asm volatile("cld; rep movsb" :
+     358:	89 d6                	mov    %edx,%esi
+     35a:	89 c1                	mov    %eax,%ecx
+     35c:	fc                   	cld
+     35d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  }
+  movsb(dst, src, n);
+  return vdst;
+}
+     35f:	89 d8                	mov    %ebx,%eax
+     361:	83 c4 08             	add    $0x8,%esp
+     364:	5b                   	pop    %ebx
+     365:	5e                   	pop    %esi
+     366:	5f                   	pop    %edi
+     367:	5d                   	pop    %ebp
+     368:	c3                   	ret
+  dst = vdst;
+     369:	89 df                	mov    %ebx,%edi
+     36b:	eb eb                	jmp    358 <memmove+0x95>
+
+0000036d <vclock_gettime>:
+
+// clock_gettime() without a system call: read the clock page
+// that the kernel maps at CLOCKPAGE (see clock.h).
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+     36d:	55                   	push   %ebp
+     36e:	89 e5                	mov    %esp,%ebp
+     370:	57                   	push   %edi
+     371:	56                   	push   %esi
+     372:	53                   	push   %ebx
+     373:	83 ec 14             	sub    $0x14,%esp
+  struct clockpage *cp = (struct clockpage*)CLOCKPAGE;
+  uint seq, rem, d;
+  uint64 tsc, ns, now;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+     376:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     37a:	0f 87 a3 00 00 00    	ja     423 <vclock_gettime+0xb6>
+    return -1;
+  do {
+    seq = cp->seq;
+     380:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+    __sync_synchronize();
+     385:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    tsc = cp->tsc;
+     38a:	8b 15 10 f0 ff 7f    	mov    0x7ffff010,%edx
+     390:	8b 1d 14 f0 ff 7f    	mov    0x7ffff014,%ebx
+    ns = cp->ns;
+     396:	8b 35 18 f0 ff 7f    	mov    0x7ffff018,%esi
+     39c:	8b 3d 1c f0 ff 7f    	mov    0x7ffff01c,%edi
+    __sync_synchronize();
+     3a2:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != cp->seq);
+     3a7:	89 c1                	mov    %eax,%ecx
+     3a9:	83 e1 01             	and    $0x1,%ecx
+     3ac:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     3af:	75 cf                	jne    380 <vclock_gettime+0x13>
+     3b1:	8b 0d 00 f0 ff 7f    	mov    0x7ffff000,%ecx
+     3b7:	39 c1                	cmp    %eax,%ecx
+     3b9:	75 c5                	jne    380 <vclock_gettime+0x13>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+     3bb:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     3be:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     3c1:	0f 31                	rdtsc
+     3c3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     3c6:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     3c9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  now = rdtsc();
+  // Less than a tick has passed since the update, so the delta
+  // fits in 32 bits.
+  d = now > tsc ? now - tsc : 0;
+     3cc:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     3cf:	19 d3                	sbb    %edx,%ebx
+     3d1:	73 07                	jae    3da <vclock_gettime+0x6d>
+     3d3:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+     3d6:	29 d8                	sub    %ebx,%eax
+     3d8:	89 c1                	mov    %eax,%ecx
+  ns += ((uint64)d * cp->mult) >> cp->shift;
+     3da:	89 c8                	mov    %ecx,%eax
+     3dc:	f7 25 04 f0 ff 7f    	mull   0x7ffff004
+     3e2:	0f b6 0d 08 f0 ff 7f 	movzbl 0x7ffff008,%ecx
+     3e9:	0f ad d0             	shrd   %cl,%edx,%eax
+     3ec:	d3 ea                	shr    %cl,%edx
+     3ee:	f6 c1 20             	test   $0x20,%cl
+     3f1:	74 04                	je     3f7 <vclock_gettime+0x8a>
+     3f3:	89 d0                	mov    %edx,%eax
+     3f5:	31 d2                	xor    %edx,%edx
+     3f7:	01 f0                	add    %esi,%eax
+     3f9:	11 fa                	adc    %edi,%edx
+static inline uint
+divl(uint64 n, uint d, uint *r)
+{
+  uint q;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (*r) :
+     3fb:	bb 00 ca 9a 3b       	mov    $0x3b9aca00,%ebx
+     400:	f7 f3                	div    %ebx
+  ts->tv_sec = divl(ns, 1000000000, &rem);
+     402:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     405:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = rem;
+     407:	89 57 04             	mov    %edx,0x4(%edi)
+  if(clk == CLOCK_REALTIME)
+     40a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     40e:	75 1a                	jne    42a <vclock_gettime+0xbd>
+    ts->tv_sec += cp->boottime;
+     410:	03 05 0c f0 ff 7f    	add    0x7ffff00c,%eax
+     416:	89 07                	mov    %eax,(%edi)
+  return 0;
+     418:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     41b:	83 c4 14             	add    $0x14,%esp
+     41e:	5b                   	pop    %ebx
+     41f:	5e                   	pop    %esi
+     420:	5f                   	pop    %edi
+     421:	5d                   	pop    %ebp
+     422:	c3                   	ret
+    return -1;
+     423:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     428:	eb f1                	jmp    41b <vclock_gettime+0xae>
+  return 0;
+     42a:	b8 00 00 00 00       	mov    $0x0,%eax
+     42f:	eb ea                	jmp    41b <vclock_gettime+0xae>
+
+00000431 <flush>:
+
+// Write out fd's buffer, or with fd < 0 every buffer.
+// Returns -1 if a write fails.
+int
+flush(int fd)
+{
+     431:	55                   	push   %ebp
+     432:	89 e5                	mov    %esp,%ebp
+     434:	56                   	push   %esi
+     435:	53                   	push   %ebx
+     436:	8b 45 08             	mov    0x8(%ebp),%eax
+  int r, n;
+
+  if(fd < 0){
+     439:	85 c0                	test   %eax,%eax
+     43b:	78 5d                	js     49a <flush+0x69>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+      if(flush(fd) < 0)
+        r = -1;
+    return r;
+  }
+  if(fd >= NOBUF || (n = obuf[fd].n) == 0)
+     43d:	83 f8 0f             	cmp    $0xf,%eax
+     440:	7f 64                	jg     4a6 <flush+0x75>
+     442:	69 d0 08 02 00 00    	imul   $0x208,%eax,%edx
+     448:	8b b2 44 19 00 00    	mov    0x1944(%edx),%esi
+     44e:	85 f6                	test   %esi,%esi
+     450:	74 59                	je     4ab <flush+0x7a>
+    return 0;
+  obuf[fd].n = 0;
+     452:	c7 82 44 19 00 00 00 	movl   $0x0,0x1944(%edx)
+     459:	00 00 00 
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     45c:	81 c2 48 19 00 00    	add    $0x1948,%edx
+     462:	83 ec 04             	sub    $0x4,%esp
+     465:	56                   	push   %esi
+     466:	52                   	push   %edx
+     467:	50                   	push   %eax
+     468:	e8 5a 03 00 00       	call   7c7 <write>
+     46d:	83 c4 10             	add    $0x10,%esp
+     470:	39 f0                	cmp    %esi,%eax
+     472:	75 40                	jne    4b4 <flush+0x83>
+     474:	be 00 00 00 00       	mov    $0x0,%esi
+     479:	eb 30                	jmp    4ab <flush+0x7a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     47b:	83 c3 01             	add    $0x1,%ebx
+     47e:	83 fb 0f             	cmp    $0xf,%ebx
+     481:	7f 28                	jg     4ab <flush+0x7a>
+      if(flush(fd) < 0)
+     483:	83 ec 0c             	sub    $0xc,%esp
+     486:	53                   	push   %ebx
+     487:	e8 a5 ff ff ff       	call   431 <flush>
+     48c:	83 c4 10             	add    $0x10,%esp
+     48f:	85 c0                	test   %eax,%eax
+     491:	79 e8                	jns    47b <flush+0x4a>
+        r = -1;
+     493:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     498:	eb e1                	jmp    47b <flush+0x4a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     49a:	be 00 00 00 00       	mov    $0x0,%esi
+     49f:	bb 00 00 00 00       	mov    $0x0,%ebx
+     4a4:	eb d8                	jmp    47e <flush+0x4d>
+    return 0;
+     4a6:	be 00 00 00 00       	mov    $0x0,%esi
+}
+     4ab:	89 f0                	mov    %esi,%eax
+     4ad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     4b0:	5b                   	pop    %ebx
+     4b1:	5e                   	pop    %esi
+     4b2:	5d                   	pop    %ebp
+     4b3:	c3                   	ret
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     4b4:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     4b9:	eb f0                	jmp    4ab <flush+0x7a>
+
+000004bb <bufreset>:
+
+static void
+bufreset(int fd)
+{
+  if(fd >= 0 && fd < NOBUF){
+     4bb:	83 f8 0f             	cmp    $0xf,%eax
+     4be:	76 01                	jbe    4c1 <bufreset+0x6>
+     4c0:	c3                   	ret
+{
+     4c1:	55                   	push   %ebp
+     4c2:	89 e5                	mov    %esp,%ebp
+     4c4:	53                   	push   %ebx
+     4c5:	83 ec 10             	sub    $0x10,%esp
+     4c8:	89 c3                	mov    %eax,%ebx
+    flush(fd);
+     4ca:	50                   	push   %eax
+     4cb:	e8 61 ff ff ff       	call   431 <flush>
+    obuf[fd].mode = BUNKNOWN;
+     4d0:	69 db 08 02 00 00    	imul   $0x208,%ebx,%ebx
+     4d6:	c7 83 40 19 00 00 00 	movl   $0x0,0x1940(%ebx)
+     4dd:	00 00 00 
+     4e0:	83 c4 10             	add    $0x10,%esp
+  }
+}
+     4e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4e6:	c9                   	leave
+     4e7:	c3                   	ret
+
+000004e8 <bufwrite>:
+
+// Write n bytes from p to fd, through its buffer.
+// Returns n, or -1 if a write fails.
+int
+bufwrite(int fd, const void *p, int n)
+{
+     4e8:	55                   	push   %ebp
+     4e9:	89 e5                	mov    %esp,%ebp
+     4eb:	57                   	push   %edi
+     4ec:	56                   	push   %esi
+     4ed:	53                   	push   %ebx
+     4ee:	83 ec 3c             	sub    $0x3c,%esp
+     4f1:	8b 75 08             	mov    0x8(%ebp),%esi
+     4f4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct stat st;
+  const char *s;
+  int i;
+
+  if(fd < 0 || fd >= NOBUF)
+     4f7:	83 fe 0f             	cmp    $0xf,%esi
+     4fa:	0f 87 a2 00 00 00    	ja     5a2 <bufwrite+0xba>
+    return write(fd, p, n);
+  if(obuf[fd].mode == BUNKNOWN){
+     500:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     506:	83 b8 40 19 00 00 00 	cmpl   $0x0,0x1940(%eax)
+     50d:	75 19                	jne    528 <bufwrite+0x40>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     50f:	83 fe 02             	cmp    $0x2,%esi
+     512:	0f 85 9c 00 00 00    	jne    5b4 <bufwrite+0xcc>
+      obuf[fd].mode = BNONE;
+     518:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     51e:	c7 80 40 19 00 00 01 	movl   $0x1,0x1940(%eax)
+     525:	00 00 00 
+    else
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+  }
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     528:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     52e:	89 da                	mov    %ebx,%edx
+     530:	03 90 44 19 00 00    	add    0x1944(%eax),%edx
+     536:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+     53c:	0f 8f ae 00 00 00    	jg     5f0 <bufwrite+0x108>
+    return -1;
+  if(n >= OBUFSZ)
+     542:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+     548:	0f 8f bd 00 00 00    	jg     60b <bufwrite+0x123>
+    return write(fd, p, n);
+  memmove(obuf[fd].buf + obuf[fd].n, p, n);
+     54e:	69 d6 08 02 00 00    	imul   $0x208,%esi,%edx
+     554:	8d ba 40 19 00 00    	lea    0x1940(%edx),%edi
+     55a:	8b 82 44 19 00 00    	mov    0x1944(%edx),%eax
+     560:	83 ec 04             	sub    $0x4,%esp
+     563:	53                   	push   %ebx
+     564:	ff 75 0c             	push   0xc(%ebp)
+     567:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     56a:	8d 84 10 48 19 00 00 	lea    0x1948(%eax,%edx,1),%eax
+     571:	50                   	push   %eax
+     572:	e8 4c fd ff ff       	call   2c3 <memmove>
+  obuf[fd].n += n;
+     577:	01 5f 04             	add    %ebx,0x4(%edi)
+  if(obuf[fd].mode == BNONE)
+     57a:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     57d:	8b 82 40 19 00 00    	mov    0x1940(%edx),%eax
+     583:	83 c4 10             	add    $0x10,%esp
+     586:	83 f8 01             	cmp    $0x1,%eax
+     589:	0f 84 91 00 00 00    	je     620 <bufwrite+0x138>
+    return flush(fd) < 0 ? -1 : n;
+  if(obuf[fd].mode == BLINE)
+     58f:	83 f8 02             	cmp    $0x2,%eax
+     592:	0f 84 ca 00 00 00    	je     662 <bufwrite+0x17a>
+    for(s = p, i = 0; i < n; i++)
+      if(s[i] == '\n')
+        return flush(fd) < 0 ? -1 : n;
+  return n;
+     598:	89 d8                	mov    %ebx,%eax
+}
+     59a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     59d:	5b                   	pop    %ebx
+     59e:	5e                   	pop    %esi
+     59f:	5f                   	pop    %edi
+     5a0:	5d                   	pop    %ebp
+     5a1:	c3                   	ret
+    return write(fd, p, n);
+     5a2:	83 ec 04             	sub    $0x4,%esp
+     5a5:	53                   	push   %ebx
+     5a6:	ff 75 0c             	push   0xc(%ebp)
+     5a9:	56                   	push   %esi
+     5aa:	e8 18 02 00 00       	call   7c7 <write>
+     5af:	83 c4 10             	add    $0x10,%esp
+     5b2:	eb e6                	jmp    59a <bufwrite+0xb2>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     5b4:	83 ec 08             	sub    $0x8,%esp
+     5b7:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     5ba:	50                   	push   %eax
+     5bb:	56                   	push   %esi
+     5bc:	e8 51 02 00 00       	call   812 <fstat>
+     5c1:	83 c4 10             	add    $0x10,%esp
+     5c4:	85 c0                	test   %eax,%eax
+     5c6:	0f 88 4c ff ff ff    	js     518 <bufwrite+0x30>
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+     5cc:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     5d1:	74 16                	je     5e9 <bufwrite+0x101>
+     5d3:	ba 03 00 00 00       	mov    $0x3,%edx
+     5d8:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     5de:	89 90 40 19 00 00    	mov    %edx,0x1940(%eax)
+     5e4:	e9 3f ff ff ff       	jmp    528 <bufwrite+0x40>
+     5e9:	ba 02 00 00 00       	mov    $0x2,%edx
+     5ee:	eb e8                	jmp    5d8 <bufwrite+0xf0>
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     5f0:	83 ec 0c             	sub    $0xc,%esp
+     5f3:	56                   	push   %esi
+     5f4:	e8 38 fe ff ff       	call   431 <flush>
+     5f9:	83 c4 10             	add    $0x10,%esp
+     5fc:	85 c0                	test   %eax,%eax
+     5fe:	0f 89 3e ff ff ff    	jns    542 <bufwrite+0x5a>
+    return -1;
+     604:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     609:	eb 8f                	jmp    59a <bufwrite+0xb2>
+    return write(fd, p, n);
+     60b:	83 ec 04             	sub    $0x4,%esp
+     60e:	53                   	push   %ebx
+     60f:	ff 75 0c             	push   0xc(%ebp)
+     612:	56                   	push   %esi
+     613:	e8 af 01 00 00       	call   7c7 <write>
+     618:	83 c4 10             	add    $0x10,%esp
+     61b:	e9 7a ff ff ff       	jmp    59a <bufwrite+0xb2>
+    return flush(fd) < 0 ? -1 : n;
+     620:	83 ec 0c             	sub    $0xc,%esp
+     623:	56                   	push   %esi
+     624:	e8 08 fe ff ff       	call   431 <flush>
+     629:	83 c4 10             	add    $0x10,%esp
+     62c:	85 c0                	test   %eax,%eax
+     62e:	78 07                	js     637 <bufwrite+0x14f>
+     630:	89 d8                	mov    %ebx,%eax
+     632:	e9 63 ff ff ff       	jmp    59a <bufwrite+0xb2>
+     637:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     63c:	e9 59 ff ff ff       	jmp    59a <bufwrite+0xb2>
+        return flush(fd) < 0 ? -1 : n;
+     641:	83 ec 0c             	sub    $0xc,%esp
+     644:	56                   	push   %esi
+     645:	e8 e7 fd ff ff       	call   431 <flush>
+     64a:	83 c4 10             	add    $0x10,%esp
+     64d:	85 c0                	test   %eax,%eax
+     64f:	78 07                	js     658 <bufwrite+0x170>
+     651:	89 d8                	mov    %ebx,%eax
+     653:	e9 42 ff ff ff       	jmp    59a <bufwrite+0xb2>
+     658:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     65d:	e9 38 ff ff ff       	jmp    59a <bufwrite+0xb2>
+    for(s = p, i = 0; i < n; i++)
+     662:	b8 00 00 00 00       	mov    $0x0,%eax
+     667:	39 d8                	cmp    %ebx,%eax
+     669:	7d 0e                	jge    679 <bufwrite+0x191>
+      if(s[i] == '\n')
+     66b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     66e:	80 3c 01 0a          	cmpb   $0xa,(%ecx,%eax,1)
+     672:	74 cd                	je     641 <bufwrite+0x159>
+    for(s = p, i = 0; i < n; i++)
+     674:	83 c0 01             	add    $0x1,%eax
+     677:	eb ee                	jmp    667 <bufwrite+0x17f>
+  return n;
+     679:	89 d8                	mov    %ebx,%eax
+     67b:	e9 1a ff ff ff       	jmp    59a <bufwrite+0xb2>
+
+00000680 <fork>:
+
+int
+fork(void)
+{
+     680:	55                   	push   %ebp
+     681:	89 e5                	mov    %esp,%ebp
+     683:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     686:	6a ff                	push   $0xffffffff
+     688:	e8 a4 fd ff ff       	call   431 <flush>
+  return _fork();
+     68d:	e8 bd 00 00 00       	call   74f <_fork>
+}
+     692:	c9                   	leave
+     693:	c3                   	ret
+
+00000694 <exit>:
+
+int
+exit(void)
+{
+     694:	55                   	push   %ebp
+     695:	89 e5                	mov    %esp,%ebp
+     697:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     69a:	6a ff                	push   $0xffffffff
+     69c:	e8 90 fd ff ff       	call   431 <flush>
+  _exit();
+     6a1:	e8 b8 00 00 00       	call   75e <_exit>
+
+000006a6 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     6a6:	55                   	push   %ebp
+     6a7:	89 e5                	mov    %esp,%ebp
+     6a9:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     6ac:	6a ff                	push   $0xffffffff
+     6ae:	e8 7e fd ff ff       	call   431 <flush>
+  return _exec(path, argv);
+     6b3:	83 c4 08             	add    $0x8,%esp
+     6b6:	ff 75 0c             	push   0xc(%ebp)
+     6b9:	ff 75 08             	push   0x8(%ebp)
+     6bc:	e8 bb 00 00 00       	call   77c <_exec>
+}
+     6c1:	c9                   	leave
+     6c2:	c3                   	ret
+
+000006c3 <close>:
+
+int
+close(int fd)
+{
+     6c3:	55                   	push   %ebp
+     6c4:	89 e5                	mov    %esp,%ebp
+     6c6:	53                   	push   %ebx
+     6c7:	83 ec 04             	sub    $0x4,%esp
+     6ca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bufreset(fd);
+     6cd:	89 d8                	mov    %ebx,%eax
+     6cf:	e8 e7 fd ff ff       	call   4bb <bufreset>
+  return _close(fd);
+     6d4:	83 ec 0c             	sub    $0xc,%esp
+     6d7:	53                   	push   %ebx
+     6d8:	e8 90 00 00 00       	call   76d <_close>
+}
+     6dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6e0:	c9                   	leave
+     6e1:	c3                   	ret
+
+000006e2 <stat>:
+{
+     6e2:	55                   	push   %ebp
+     6e3:	89 e5                	mov    %esp,%ebp
+     6e5:	56                   	push   %esi
+     6e6:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     6e7:	83 ec 08             	sub    $0x8,%esp
+     6ea:	6a 00                	push   $0x0
+     6ec:	ff 75 08             	push   0x8(%ebp)
+     6ef:	e8 f1 00 00 00       	call   7e5 <open>
+  if(fd < 0)
+     6f4:	83 c4 10             	add    $0x10,%esp
+     6f7:	85 c0                	test   %eax,%eax
+     6f9:	78 24                	js     71f <stat+0x3d>
+     6fb:	89 c3                	mov    %eax,%ebx
+  r = fstat(fd, st);
+     6fd:	83 ec 08             	sub    $0x8,%esp
+     700:	ff 75 0c             	push   0xc(%ebp)
+     703:	50                   	push   %eax
+     704:	e8 09 01 00 00       	call   812 <fstat>
+     709:	89 c6                	mov    %eax,%esi
+  close(fd);
+     70b:	89 1c 24             	mov    %ebx,(%esp)
+     70e:	e8 b0 ff ff ff       	call   6c3 <close>
+  return r;
+     713:	83 c4 10             	add    $0x10,%esp
+}
+     716:	89 f0                	mov    %esi,%eax
+     718:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     71b:	5b                   	pop    %ebx
+     71c:	5e                   	pop    %esi
+     71d:	5d                   	pop    %ebp
+     71e:	c3                   	ret
+    return -1;
+     71f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     724:	eb f0                	jmp    716 <stat+0x34>
+
+00000726 <dup2>:
+
+int
+dup2(int oldfd, int newfd)
+{
+     726:	55                   	push   %ebp
+     727:	89 e5                	mov    %esp,%ebp
+     729:	56                   	push   %esi
+     72a:	53                   	push   %ebx
+     72b:	8b 75 08             	mov    0x8(%ebp),%esi
+     72e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(oldfd != newfd)
+     731:	39 de                	cmp    %ebx,%esi
+     733:	75 11                	jne    746 <dup2+0x20>
+    bufreset(newfd);
+  return _dup2(oldfd, newfd);
+     735:	83 ec 08             	sub    $0x8,%esp
+     738:	53                   	push   %ebx
+     739:	56                   	push   %esi
+     73a:	e8 4c 00 00 00       	call   78b <_dup2>
+}
+     73f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     742:	5b                   	pop    %ebx
+     743:	5e                   	pop    %esi
+     744:	5d                   	pop    %ebp
+     745:	c3                   	ret
+    bufreset(newfd);
+     746:	89 d8                	mov    %ebx,%eax
+     748:	e8 6e fd ff ff       	call   4bb <bufreset>
+     74d:	eb e6                	jmp    735 <dup2+0xf>
+
+0000074f <_fork>:
+  1: ret
+
+#define SYSCALL(name) STUB(name, SYS_ ## name)
+
+# ulib.c wraps these, to flush printf()'s buffers first.
+STUB(_fork, SYS_fork)
+     74f:	b8 01 00 00 00       	mov    $0x1,%eax
+     754:	89 e1                	mov    %esp,%ecx
+     756:	ba 5d 07 00 00       	mov    $0x75d,%edx
+     75b:	0f 34                	sysenter
+     75d:	c3                   	ret
+
+0000075e <_exit>:
+STUB(_exit, SYS_exit)
+     75e:	b8 02 00 00 00       	mov    $0x2,%eax
+     763:	89 e1                	mov    %esp,%ecx
+     765:	ba 6c 07 00 00       	mov    $0x76c,%edx
+     76a:	0f 34                	sysenter
+     76c:	c3                   	ret
+
+0000076d <_close>:
+STUB(_close, SYS_close)
+     76d:	b8 15 00 00 00       	mov    $0x15,%eax
+     772:	89 e1                	mov    %esp,%ecx
+     774:	ba 7b 07 00 00       	mov    $0x77b,%edx
+     779:	0f 34                	sysenter
+     77b:	c3                   	ret
+
+0000077c <_exec>:
+STUB(_exec, SYS_exec)
+     77c:	b8 07 00 00 00       	mov    $0x7,%eax
+     781:	89 e1                	mov    %esp,%ecx
+     783:	ba 8a 07 00 00       	mov    $0x78a,%edx
+     788:	0f 34                	sysenter
+     78a:	c3                   	ret
+
+0000078b <_dup2>:
+STUB(_dup2, SYS_dup2)
+     78b:	b8 17 00 00 00       	mov    $0x17,%eax
+     790:	89 e1                	mov    %esp,%ecx
+     792:	ba 99 07 00 00       	mov    $0x799,%edx
+     797:	0f 34                	sysenter
+     799:	c3                   	ret
+
+0000079a <wait>:
+
+SYSCALL(wait)
+     79a:	b8 03 00 00 00       	mov    $0x3,%eax
+     79f:	89 e1                	mov    %esp,%ecx
+     7a1:	ba a8 07 00 00       	mov    $0x7a8,%edx
+     7a6:	0f 34                	sysenter
+     7a8:	c3                   	ret
+
+000007a9 <pipe>:
+SYSCALL(pipe)
+     7a9:	b8 04 00 00 00       	mov    $0x4,%eax
+     7ae:	89 e1                	mov    %esp,%ecx
+     7b0:	ba b7 07 00 00       	mov    $0x7b7,%edx
+     7b5:	0f 34                	sysenter
+     7b7:	c3                   	ret
+
+000007b8 <read>:
+SYSCALL(read)
+     7b8:	b8 05 00 00 00       	mov    $0x5,%eax
+     7bd:	89 e1                	mov    %esp,%ecx
+     7bf:	ba c6 07 00 00       	mov    $0x7c6,%edx
+     7c4:	0f 34                	sysenter
+     7c6:	c3                   	ret
+
+000007c7 <write>:
+SYSCALL(write)
+     7c7:	b8 10 00 00 00       	mov    $0x10,%eax
+     7cc:	89 e1                	mov    %esp,%ecx
+     7ce:	ba d5 07 00 00       	mov    $0x7d5,%edx
+     7d3:	0f 34                	sysenter
+     7d5:	c3                   	ret
+
+000007d6 <kill>:
+SYSCALL(kill)
+     7d6:	b8 06 00 00 00       	mov    $0x6,%eax
+     7db:	89 e1                	mov    %esp,%ecx
+     7dd:	ba e4 07 00 00       	mov    $0x7e4,%edx
+     7e2:	0f 34                	sysenter
+     7e4:	c3                   	ret
+
+000007e5 <open>:
+SYSCALL(open)
+     7e5:	b8 0f 00 00 00       	mov    $0xf,%eax
+     7ea:	89 e1                	mov    %esp,%ecx
+     7ec:	ba f3 07 00 00       	mov    $0x7f3,%edx
+     7f1:	0f 34                	sysenter
+     7f3:	c3                   	ret
+
+000007f4 <mknod>:
+SYSCALL(mknod)
+     7f4:	b8 11 00 00 00       	mov    $0x11,%eax
+     7f9:	89 e1                	mov    %esp,%ecx
+     7fb:	ba 02 08 00 00       	mov    $0x802,%edx
+     800:	0f 34                	sysenter
+     802:	c3                   	ret
+
+00000803 <unlink>:
+SYSCALL(unlink)
+     803:	b8 12 00 00 00       	mov    $0x12,%eax
+     808:	89 e1                	mov    %esp,%ecx
+     80a:	ba 11 08 00 00       	mov    $0x811,%edx
+     80f:	0f 34                	sysenter
+     811:	c3                   	ret
+
+00000812 <fstat>:
+SYSCALL(fstat)
+     812:	b8 08 00 00 00       	mov    $0x8,%eax
+     817:	89 e1                	mov    %esp,%ecx
+     819:	ba 20 08 00 00       	mov    $0x820,%edx
+     81e:	0f 34                	sysenter
+     820:	c3                   	ret
+
+00000821 <link>:
+SYSCALL(link)
+     821:	b8 13 00 00 00       	mov    $0x13,%eax
+     826:	89 e1                	mov    %esp,%ecx
+     828:	ba 2f 08 00 00       	mov    $0x82f,%edx
+     82d:	0f 34                	sysenter
+     82f:	c3                   	ret
+
+00000830 <mkdir>:
+SYSCALL(mkdir)
+     830:	b8 14 00 00 00       	mov    $0x14,%eax
+     835:	89 e1                	mov    %esp,%ecx
+     837:	ba 3e 08 00 00       	mov    $0x83e,%edx
+     83c:	0f 34                	sysenter
+     83e:	c3                   	ret
+
+0000083f <chdir>:
+SYSCALL(chdir)
+     83f:	b8 09 00 00 00       	mov    $0x9,%eax
+     844:	89 e1                	mov    %esp,%ecx
+     846:	ba 4d 08 00 00       	mov    $0x84d,%edx
+     84b:	0f 34                	sysenter
+     84d:	c3                   	ret
+
+0000084e <dup>:
+SYSCALL(dup)
+     84e:	b8 0a 00 00 00       	mov    $0xa,%eax
+     853:	89 e1                	mov    %esp,%ecx
+     855:	ba 5c 08 00 00       	mov    $0x85c,%edx
+     85a:	0f 34                	sysenter
+     85c:	c3                   	ret
+
+0000085d <getpid>:
+SYSCALL(getpid)
+     85d:	b8 0b 00 00 00       	mov    $0xb,%eax
+     862:	89 e1                	mov    %esp,%ecx
+     864:	ba 6b 08 00 00       	mov    $0x86b,%edx
+     869:	0f 34                	sysenter
+     86b:	c3                   	ret
+
+0000086c <sbrk>:
+SYSCALL(sbrk)
+     86c:	b8 0c 00 00 00       	mov    $0xc,%eax
+     871:	89 e1                	mov    %esp,%ecx
+     873:	ba 7a 08 00 00       	mov    $0x87a,%edx
+     878:	0f 34                	sysenter
+     87a:	c3                   	ret
+
+0000087b <sleep>:
+SYSCALL(sleep)
+     87b:	b8 0d 00 00 00       	mov    $0xd,%eax
+     880:	89 e1                	mov    %esp,%ecx
+     882:	ba 89 08 00 00       	mov    $0x889,%edx
+     887:	0f 34                	sysenter
+     889:	c3                   	ret
+
+0000088a <uptime>:
+SYSCALL(uptime)
+     88a:	b8 0e 00 00 00       	mov    $0xe,%eax
+     88f:	89 e1                	mov    %esp,%ecx
+     891:	ba 98 08 00 00       	mov    $0x898,%edx
+     896:	0f 34                	sysenter
+     898:	c3                   	ret
+
+00000899 <date>:
+SYSCALL(date)
+     899:	b8 16 00 00 00       	mov    $0x16,%eax
+     89e:	89 e1                	mov    %esp,%ecx
+     8a0:	ba a7 08 00 00       	mov    $0x8a7,%edx
+     8a5:	0f 34                	sysenter
+     8a7:	c3                   	ret
+
+000008a8 <faultaround>:
+SYSCALL(faultaround)
+     8a8:	b8 18 00 00 00       	mov    $0x18,%eax
+     8ad:	89 e1                	mov    %esp,%ecx
+     8af:	ba b6 08 00 00       	mov    $0x8b6,%edx
+     8b4:	0f 34                	sysenter
+     8b6:	c3                   	ret
+
+000008b7 <faultstat>:
+SYSCALL(faultstat)
+     8b7:	b8 19 00 00 00       	mov    $0x19,%eax
+     8bc:	89 e1                	mov    %esp,%ecx
+     8be:	ba c5 08 00 00       	mov    $0x8c5,%edx
+     8c3:	0f 34                	sysenter
+     8c5:	c3                   	ret
+
+000008c6 <mmap>:
+SYSCALL(mmap)
+     8c6:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     8cb:	89 e1                	mov    %esp,%ecx
+     8cd:	ba d4 08 00 00       	mov    $0x8d4,%edx
+     8d2:	0f 34                	sysenter
+     8d4:	c3                   	ret
+
+000008d5 <munmap>:
+SYSCALL(munmap)
+     8d5:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     8da:	89 e1                	mov    %esp,%ecx
+     8dc:	ba e3 08 00 00       	mov    $0x8e3,%edx
+     8e1:	0f 34                	sysenter
+     8e3:	c3                   	ret
+
+000008e4 <largepages>:
+SYSCALL(largepages)
+     8e4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     8e9:	89 e1                	mov    %esp,%ecx
+     8eb:	ba f2 08 00 00       	mov    $0x8f2,%edx
+     8f0:	0f 34                	sysenter
+     8f2:	c3                   	ret
+
+000008f3 <spawn>:
+SYSCALL(spawn)
+     8f3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     8f8:	89 e1                	mov    %esp,%ecx
+     8fa:	ba 01 09 00 00       	mov    $0x901,%edx
+     8ff:	0f 34                	sysenter
+     901:	c3                   	ret
+
+00000902 <setpriority>:
+SYSCALL(setpriority)
+     902:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     907:	89 e1                	mov    %esp,%ecx
+     909:	ba 10 09 00 00       	mov    $0x910,%edx
+     90e:	0f 34                	sysenter
+     910:	c3                   	ret
+
+00000911 <getpriority>:
+SYSCALL(getpriority)
+     911:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     916:	89 e1                	mov    %esp,%ecx
+     918:	ba 1f 09 00 00       	mov    $0x91f,%edx
+     91d:	0f 34                	sysenter
+     91f:	c3                   	ret
+
+00000920 <getprocinfo>:
+SYSCALL(getprocinfo)
+     920:	b8 20 00 00 00       	mov    $0x20,%eax
+     925:	89 e1                	mov    %esp,%ecx
+     927:	ba 2e 09 00 00       	mov    $0x92e,%edx
+     92c:	0f 34                	sysenter
+     92e:	c3                   	ret
+
+0000092f <getcpuinfo>:
+SYSCALL(getcpuinfo)
+     92f:	b8 21 00 00 00       	mov    $0x21,%eax
+     934:	89 e1                	mov    %esp,%ecx
+     936:	ba 3d 09 00 00       	mov    $0x93d,%edx
+     93b:	0f 34                	sysenter
+     93d:	c3                   	ret
+
+0000093e <clone>:
+SYSCALL(clone)
+     93e:	b8 22 00 00 00       	mov    $0x22,%eax
+     943:	89 e1                	mov    %esp,%ecx
+     945:	ba 4c 09 00 00       	mov    $0x94c,%edx
+     94a:	0f 34                	sysenter
+     94c:	c3                   	ret
+
+0000094d <join>:
+SYSCALL(join)
+     94d:	b8 23 00 00 00       	mov    $0x23,%eax
+     952:	89 e1                	mov    %esp,%ecx
+     954:	ba 5b 09 00 00       	mov    $0x95b,%edx
+     959:	0f 34                	sysenter
+     95b:	c3                   	ret
+
+0000095c <futex_wait>:
+SYSCALL(futex_wait)
+     95c:	b8 24 00 00 00       	mov    $0x24,%eax
+     961:	89 e1                	mov    %esp,%ecx
+     963:	ba 6a 09 00 00       	mov    $0x96a,%edx
+     968:	0f 34                	sysenter
+     96a:	c3                   	ret
+
+0000096b <futex_wake>:
+SYSCALL(futex_wake)
+     96b:	b8 25 00 00 00       	mov    $0x25,%eax
+     970:	89 e1                	mov    %esp,%ecx
+     972:	ba 79 09 00 00       	mov    $0x979,%edx
+     977:	0f 34                	sysenter
+     979:	c3                   	ret
+
+0000097a <setaffinity>:
+SYSCALL(setaffinity)
+     97a:	b8 26 00 00 00       	mov    $0x26,%eax
+     97f:	89 e1                	mov    %esp,%ecx
+     981:	ba 88 09 00 00       	mov    $0x988,%edx
+     986:	0f 34                	sysenter
+     988:	c3                   	ret
+
+00000989 <getaffinity>:
+SYSCALL(getaffinity)
+     989:	b8 27 00 00 00       	mov    $0x27,%eax
+     98e:	89 e1                	mov    %esp,%ecx
+     990:	ba 97 09 00 00       	mov    $0x997,%edx
+     995:	0f 34                	sysenter
+     997:	c3                   	ret
+
+00000998 <clock_gettime>:
+SYSCALL(clock_gettime)
+     998:	b8 28 00 00 00       	mov    $0x28,%eax
+     99d:	89 e1                	mov    %esp,%ecx
+     99f:	ba a6 09 00 00       	mov    $0x9a6,%edx
+     9a4:	0f 34                	sysenter
+     9a6:	c3                   	ret
+
+000009a7 <msleep>:
+SYSCALL(msleep)
+     9a7:	b8 29 00 00 00       	mov    $0x29,%eax
+     9ac:	89 e1                	mov    %esp,%ecx
+     9ae:	ba b5 09 00 00       	mov    $0x9b5,%edx
+     9b3:	0f 34                	sysenter
+     9b5:	c3                   	ret
+
+000009b6 <lockstat>:
+SYSCALL(lockstat)
+     9b6:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     9bb:	89 e1                	mov    %esp,%ecx
+     9bd:	ba c4 09 00 00       	mov    $0x9c4,%edx
+     9c2:	0f 34                	sysenter
+     9c4:	c3                   	ret
+
+000009c5 <bstat>:
+SYSCALL(bstat)
+     9c5:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     9ca:	89 e1                	mov    %esp,%ecx
+     9cc:	ba d3 09 00 00       	mov    $0x9d3,%edx
+     9d1:	0f 34                	sysenter
+     9d3:	c3                   	ret
+
+000009d4 <iostat>:
+SYSCALL(iostat)
+     9d4:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     9d9:	89 e1                	mov    %esp,%ecx
+     9db:	ba e2 09 00 00       	mov    $0x9e2,%edx
+     9e0:	0f 34                	sysenter
+     9e2:	c3                   	ret
+
+000009e3 <fsync>:
+SYSCALL(fsync)
+     9e3:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     9e8:	89 e1                	mov    %esp,%ecx
+     9ea:	ba f1 09 00 00       	mov    $0x9f1,%edx
+     9ef:	0f 34                	sysenter
+     9f1:	c3                   	ret
+
+000009f2 <pread>:
+SYSCALL(pread)
+     9f2:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     9f7:	89 e1                	mov    %esp,%ecx
+     9f9:	ba 00 0a 00 00       	mov    $0xa00,%edx
+     9fe:	0f 34                	sysenter
+     a00:	c3                   	ret
+
+00000a01 <pwrite>:
+SYSCALL(pwrite)
+     a01:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     a06:	89 e1                	mov    %esp,%ecx
+     a08:	ba 0f 0a 00 00       	mov    $0xa0f,%edx
+     a0d:	0f 34                	sysenter
+     a0f:	c3                   	ret
+
+00000a10 <readv>:
+SYSCALL(readv)
+     a10:	b8 30 00 00 00       	mov    $0x30,%eax
+     a15:	89 e1                	mov    %esp,%ecx
+     a17:	ba 1e 0a 00 00       	mov    $0xa1e,%edx
+     a1c:	0f 34                	sysenter
+     a1e:	c3                   	ret
+
+00000a1f <writev>:
+SYSCALL(writev)
+     a1f:	b8 31 00 00 00       	mov    $0x31,%eax
+     a24:	89 e1                	mov    %esp,%ecx
+     a26:	ba 2d 0a 00 00       	mov    $0xa2d,%edx
+     a2b:	0f 34                	sysenter
+     a2d:	c3                   	ret
+
+00000a2e <sendfile>:
+SYSCALL(sendfile)
+     a2e:	b8 32 00 00 00       	mov    $0x32,%eax
+     a33:	89 e1                	mov    %esp,%ecx
+     a35:	ba 3c 0a 00 00       	mov    $0xa3c,%edx
+     a3a:	0f 34                	sysenter
+     a3c:	c3                   	ret
+
+00000a3d <fcntl>:
+SYSCALL(fcntl)
+     a3d:	b8 33 00 00 00       	mov    $0x33,%eax
+     a42:	89 e1                	mov    %esp,%ecx
+     a44:	ba 4b 0a 00 00       	mov    $0xa4b,%edx
+     a49:	0f 34                	sysenter
+     a4b:	c3                   	ret
+
+00000a4c <mount>:
+SYSCALL(mount)
+     a4c:	b8 34 00 00 00       	mov    $0x34,%eax
+     a51:	89 e1                	mov    %esp,%ecx
+     a53:	ba 5a 0a 00 00       	mov    $0xa5a,%edx
+     a58:	0f 34                	sysenter
+     a5a:	c3                   	ret
+
+00000a5b <getdents>:
+SYSCALL(getdents)
+     a5b:	b8 35 00 00 00       	mov    $0x35,%eax
+     a60:	89 e1                	mov    %esp,%ecx
+     a62:	ba 69 0a 00 00       	mov    $0xa69,%edx
+     a67:	0f 34                	sysenter
+     a69:	c3                   	ret
+
+00000a6a <fstatat>:
+SYSCALL(fstatat)
+     a6a:	b8 36 00 00 00       	mov    $0x36,%eax
+     a6f:	89 e1                	mov    %esp,%ecx
+     a71:	ba 78 0a 00 00       	mov    $0xa78,%edx
+     a76:	0f 34                	sysenter
+     a78:	c3                   	ret
+
+00000a79 <sysstat>:
+SYSCALL(sysstat)
+     a79:	b8 37 00 00 00       	mov    $0x37,%eax
+     a7e:	89 e1                	mov    %esp,%ecx
+     a80:	ba 87 0a 00 00       	mov    $0xa87,%edx
+     a85:	0f 34                	sysenter
+     a87:	c3                   	ret
+
+00000a88 <ringenter>:
+SYSCALL(ringenter)
+     a88:	b8 38 00 00 00       	mov    $0x38,%eax
+     a8d:	89 e1                	mov    %esp,%ecx
+     a8f:	ba 96 0a 00 00       	mov    $0xa96,%edx
+     a94:	0f 34                	sysenter
+     a96:	c3                   	ret
+
+00000a97 <trace>:
+SYSCALL(trace)
+     a97:	b8 39 00 00 00       	mov    $0x39,%eax
+     a9c:	89 e1                	mov    %esp,%ecx
+     a9e:	ba a5 0a 00 00       	mov    $0xaa5,%edx
+     aa3:	0f 34                	sysenter
+     aa5:	c3                   	ret
+
+00000aa6 <memstat>:
+SYSCALL(memstat)
+     aa6:	b8 3a 00 00 00       	mov    $0x3a,%eax
+     aab:	89 e1                	mov    %esp,%ecx
+     aad:	ba b4 0a 00 00       	mov    $0xab4,%edx
+     ab2:	0f 34                	sysenter
+     ab4:	c3                   	ret
+
+00000ab5 <shmget>:
+SYSCALL(shmget)
+     ab5:	b8 3b 00 00 00       	mov    $0x3b,%eax
+     aba:	89 e1                	mov    %esp,%ecx
+     abc:	ba c3 0a 00 00       	mov    $0xac3,%edx
+     ac1:	0f 34                	sysenter
+     ac3:	c3                   	ret
+
+00000ac4 <shmat>:
+SYSCALL(shmat)
+     ac4:	b8 3c 00 00 00       	mov    $0x3c,%eax
+     ac9:	89 e1                	mov    %esp,%ecx
+     acb:	ba d2 0a 00 00       	mov    $0xad2,%edx
+     ad0:	0f 34                	sysenter
+     ad2:	c3                   	ret
+
+00000ad3 <shmdt>:
+SYSCALL(shmdt)
+     ad3:	b8 3d 00 00 00       	mov    $0x3d,%eax
+     ad8:	89 e1                	mov    %esp,%ecx
+     ada:	ba e1 0a 00 00       	mov    $0xae1,%edx
+     adf:	0f 34                	sysenter
+     ae1:	c3                   	ret
+
+00000ae2 <irqstat>:
+SYSCALL(irqstat)
+     ae2:	b8 3e 00 00 00       	mov    $0x3e,%eax
+     ae7:	89 e1                	mov    %esp,%ecx
+     ae9:	ba f0 0a 00 00       	mov    $0xaf0,%edx
+     aee:	0f 34                	sysenter
+     af0:	c3                   	ret
+
+00000af1 <irqroute>:
+SYSCALL(irqroute)
+     af1:	b8 3f 00 00 00       	mov    $0x3f,%eax
+     af6:	89 e1                	mov    %esp,%ecx
+     af8:	ba ff 0a 00 00       	mov    $0xaff,%edx
+     afd:	0f 34                	sysenter
+     aff:	c3                   	ret
+
+00000b00 <putc>:
+  char buf[64];
+};
+
+static void
+putc(struct out *o, char c)
+{
+     b00:	55                   	push   %ebp
+     b01:	89 e5                	mov    %esp,%ebp
+     b03:	56                   	push   %esi
+     b04:	53                   	push   %ebx
+     b05:	89 c3                	mov    %eax,%ebx
+     b07:	89 d6                	mov    %edx,%esi
+  if(o->n == sizeof(o->buf)){
+     b09:	8b 40 04             	mov    0x4(%eax),%eax
+     b0c:	83 f8 40             	cmp    $0x40,%eax
+     b0f:	74 16                	je     b27 <putc+0x27>
+    bufwrite(o->fd, o->buf, o->n);
+    o->n = 0;
+  }
+  o->buf[o->n++] = c;
+     b11:	8b 43 04             	mov    0x4(%ebx),%eax
+     b14:	8d 50 01             	lea    0x1(%eax),%edx
+     b17:	89 53 04             	mov    %edx,0x4(%ebx)
+     b1a:	89 f1                	mov    %esi,%ecx
+     b1c:	88 4c 03 08          	mov    %cl,0x8(%ebx,%eax,1)
+}
+     b20:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b23:	5b                   	pop    %ebx
+     b24:	5e                   	pop    %esi
+     b25:	5d                   	pop    %ebp
+     b26:	c3                   	ret
+    bufwrite(o->fd, o->buf, o->n);
+     b27:	8d 53 08             	lea    0x8(%ebx),%edx
+     b2a:	83 ec 04             	sub    $0x4,%esp
+     b2d:	50                   	push   %eax
+     b2e:	52                   	push   %edx
+     b2f:	ff 33                	push   (%ebx)
+     b31:	e8 b2 f9 ff ff       	call   4e8 <bufwrite>
+    o->n = 0;
+     b36:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     b3d:	83 c4 10             	add    $0x10,%esp
+     b40:	eb cf                	jmp    b11 <putc+0x11>
+
+00000b42 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     b42:	55                   	push   %ebp
+     b43:	89 e5                	mov    %esp,%ebp
+     b45:	57                   	push   %edi
+     b46:	56                   	push   %esi
+     b47:	53                   	push   %ebx
+     b48:	83 ec 2c             	sub    $0x2c,%esp
+     b4b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     b4e:	89 d0                	mov    %edx,%eax
+     b50:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+     b52:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     b56:	0f 95 c1             	setne  %cl
+     b59:	c1 ea 1f             	shr    $0x1f,%edx
+     b5c:	84 d1                	test   %dl,%cl
+     b5e:	74 44                	je     ba4 <printint+0x62>
+    neg = 1;
+    x = -xx;
+     b60:	f7 d8                	neg    %eax
+     b62:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+     b64:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     b6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+     b70:	89 c8                	mov    %ecx,%eax
+     b72:	ba 00 00 00 00       	mov    $0x0,%edx
+     b77:	f7 f6                	div    %esi
+     b79:	89 df                	mov    %ebx,%edi
+     b7b:	83 c3 01             	add    $0x1,%ebx
+     b7e:	0f b6 92 74 12 00 00 	movzbl 0x1274(%edx),%edx
+     b85:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+     b89:	89 ca                	mov    %ecx,%edx
+     b8b:	89 c1                	mov    %eax,%ecx
+     b8d:	39 f2                	cmp    %esi,%edx
+     b8f:	73 df                	jae    b70 <printint+0x2e>
+  if(neg)
+     b91:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     b95:	74 31                	je     bc8 <printint+0x86>
+    buf[i++] = '-';
+     b97:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+     b9c:	8d 5f 02             	lea    0x2(%edi),%ebx
+     b9f:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     ba2:	eb 17                	jmp    bbb <printint+0x79>
+    x = xx;
+     ba4:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+     ba6:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     bad:	eb bc                	jmp    b6b <printint+0x29>
+
+  while(--i >= 0)
+    putc(o, buf[i]);
+     baf:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+     bb4:	89 f0                	mov    %esi,%eax
+     bb6:	e8 45 ff ff ff       	call   b00 <putc>
+  while(--i >= 0)
+     bbb:	83 eb 01             	sub    $0x1,%ebx
+     bbe:	79 ef                	jns    baf <printint+0x6d>
+}
+     bc0:	83 c4 2c             	add    $0x2c,%esp
+     bc3:	5b                   	pop    %ebx
+     bc4:	5e                   	pop    %esi
+     bc5:	5f                   	pop    %edi
+     bc6:	5d                   	pop    %ebp
+     bc7:	c3                   	ret
+     bc8:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     bcb:	eb ee                	jmp    bbb <printint+0x79>
+
+00000bcd <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     bcd:	55                   	push   %ebp
+     bce:	89 e5                	mov    %esp,%ebp
+     bd0:	57                   	push   %edi
+     bd1:	56                   	push   %esi
+     bd2:	53                   	push   %ebx
+     bd3:	83 ec 6c             	sub    $0x6c,%esp
+  int c, i, state;
+  uint *ap;
+  struct out out, *o;
+
+  o = &out;
+  o->fd = fd;
+     bd6:	8b 45 08             	mov    0x8(%ebp),%eax
+     bd9:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  o->n = 0;
+     bdc:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+     be3:	8d 45 10             	lea    0x10(%ebp),%eax
+     be6:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  state = 0;
+     be9:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+     bee:	bb 00 00 00 00       	mov    $0x0,%ebx
+     bf3:	eb 14                	jmp    c09 <printf+0x3c>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(o, c);
+     bf5:	89 fa                	mov    %edi,%edx
+     bf7:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     bfa:	e8 01 ff ff ff       	call   b00 <putc>
+     bff:	eb 05                	jmp    c06 <printf+0x39>
+      }
+    } else if(state == '%'){
+     c01:	83 fe 25             	cmp    $0x25,%esi
+     c04:	74 25                	je     c2b <printf+0x5e>
+  for(i = 0; fmt[i]; i++){
+     c06:	83 c3 01             	add    $0x1,%ebx
+     c09:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c0c:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+     c10:	84 c0                	test   %al,%al
+     c12:	0f 84 20 01 00 00    	je     d38 <printf+0x16b>
+    c = fmt[i] & 0xff;
+     c18:	0f be f8             	movsbl %al,%edi
+     c1b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     c1e:	85 f6                	test   %esi,%esi
+     c20:	75 df                	jne    c01 <printf+0x34>
+      if(c == '%'){
+     c22:	83 f8 25             	cmp    $0x25,%eax
+     c25:	75 ce                	jne    bf5 <printf+0x28>
+        state = '%';
+     c27:	89 c6                	mov    %eax,%esi
+     c29:	eb db                	jmp    c06 <printf+0x39>
+      if(c == 'd'){
+     c2b:	83 f8 25             	cmp    $0x25,%eax
+     c2e:	0f 84 cf 00 00 00    	je     d03 <printf+0x136>
+     c34:	0f 8c dd 00 00 00    	jl     d17 <printf+0x14a>
+     c3a:	83 f8 78             	cmp    $0x78,%eax
+     c3d:	0f 8f d4 00 00 00    	jg     d17 <printf+0x14a>
+     c43:	83 f8 63             	cmp    $0x63,%eax
+     c46:	0f 8c cb 00 00 00    	jl     d17 <printf+0x14a>
+     c4c:	83 e8 63             	sub    $0x63,%eax
+     c4f:	83 f8 15             	cmp    $0x15,%eax
+     c52:	0f 87 bf 00 00 00    	ja     d17 <printf+0x14a>
+     c58:	ff 24 85 1c 12 00 00 	jmp    *0x121c(,%eax,4)
+        printint(o, *ap, 10, 1);
+     c5f:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     c62:	8b 17                	mov    (%edi),%edx
+     c64:	83 ec 0c             	sub    $0xc,%esp
+     c67:	6a 01                	push   $0x1
+     c69:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     c6e:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     c71:	e8 cc fe ff ff       	call   b42 <printint>
+        ap++;
+     c76:	83 c7 04             	add    $0x4,%edi
+     c79:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     c7c:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(o, '%');
+        putc(o, c);
+      }
+      state = 0;
+     c7f:	be 00 00 00 00       	mov    $0x0,%esi
+     c84:	eb 80                	jmp    c06 <printf+0x39>
+        printint(o, *ap, 16, 0);
+     c86:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     c89:	8b 17                	mov    (%edi),%edx
+     c8b:	83 ec 0c             	sub    $0xc,%esp
+     c8e:	6a 00                	push   $0x0
+     c90:	b9 10 00 00 00       	mov    $0x10,%ecx
+     c95:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     c98:	e8 a5 fe ff ff       	call   b42 <printint>
+        ap++;
+     c9d:	83 c7 04             	add    $0x4,%edi
+     ca0:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     ca3:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     ca6:	be 00 00 00 00       	mov    $0x0,%esi
+     cab:	e9 56 ff ff ff       	jmp    c06 <printf+0x39>
+        s = (char*)*ap;
+     cb0:	8b 45 94             	mov    -0x6c(%ebp),%eax
+     cb3:	8b 30                	mov    (%eax),%esi
+        ap++;
+     cb5:	83 c0 04             	add    $0x4,%eax
+     cb8:	89 45 94             	mov    %eax,-0x6c(%ebp)
+        if(s == 0)
+     cbb:	85 f6                	test   %esi,%esi
+     cbd:	75 15                	jne    cd4 <printf+0x107>
+          s = "(null)";
+     cbf:	be 13 12 00 00       	mov    $0x1213,%esi
+     cc4:	eb 0e                	jmp    cd4 <printf+0x107>
+          putc(o, *s);
+     cc6:	0f be d2             	movsbl %dl,%edx
+     cc9:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     ccc:	e8 2f fe ff ff       	call   b00 <putc>
+          s++;
+     cd1:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+     cd4:	0f b6 16             	movzbl (%esi),%edx
+     cd7:	84 d2                	test   %dl,%dl
+     cd9:	75 eb                	jne    cc6 <printf+0xf9>
+      state = 0;
+     cdb:	be 00 00 00 00       	mov    $0x0,%esi
+     ce0:	e9 21 ff ff ff       	jmp    c06 <printf+0x39>
+        putc(o, *ap);
+     ce5:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     ce8:	0f be 17             	movsbl (%edi),%edx
+     ceb:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     cee:	e8 0d fe ff ff       	call   b00 <putc>
+        ap++;
+     cf3:	83 c7 04             	add    $0x4,%edi
+     cf6:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+      state = 0;
+     cf9:	be 00 00 00 00       	mov    $0x0,%esi
+     cfe:	e9 03 ff ff ff       	jmp    c06 <printf+0x39>
+        putc(o, c);
+     d03:	89 fa                	mov    %edi,%edx
+     d05:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d08:	e8 f3 fd ff ff       	call   b00 <putc>
+      state = 0;
+     d0d:	be 00 00 00 00       	mov    $0x0,%esi
+     d12:	e9 ef fe ff ff       	jmp    c06 <printf+0x39>
+        putc(o, '%');
+     d17:	ba 25 00 00 00       	mov    $0x25,%edx
+     d1c:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d1f:	e8 dc fd ff ff       	call   b00 <putc>
+        putc(o, c);
+     d24:	89 fa                	mov    %edi,%edx
+     d26:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d29:	e8 d2 fd ff ff       	call   b00 <putc>
+      state = 0;
+     d2e:	be 00 00 00 00       	mov    $0x0,%esi
+     d33:	e9 ce fe ff ff       	jmp    c06 <printf+0x39>
+    }
+  }
+  if(o->n > 0)
+     d38:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     d3b:	85 c0                	test   %eax,%eax
+     d3d:	7f 08                	jg     d47 <printf+0x17a>
+    bufwrite(fd, o->buf, o->n);
+}
+     d3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d42:	5b                   	pop    %ebx
+     d43:	5e                   	pop    %esi
+     d44:	5f                   	pop    %edi
+     d45:	5d                   	pop    %ebp
+     d46:	c3                   	ret
+    bufwrite(fd, o->buf, o->n);
+     d47:	83 ec 04             	sub    $0x4,%esp
+     d4a:	50                   	push   %eax
+     d4b:	8d 45 a8             	lea    -0x58(%ebp),%eax
+     d4e:	50                   	push   %eax
+     d4f:	ff 75 08             	push   0x8(%ebp)
+     d52:	e8 91 f7 ff ff       	call   4e8 <bufwrite>
+     d57:	83 c4 10             	add    $0x10,%esp
+}
+     d5a:	eb e3                	jmp    d3f <printf+0x172>
+
+00000d5c <largefree>:
+  return &b->h;
+}
+
+static void
+largefree(Fblock *b)
+{
+     d5c:	55                   	push   %ebp
+     d5d:	89 e5                	mov    %esp,%ebp
+     d5f:	57                   	push   %edi
+     d60:	56                   	push   %esi
+     d61:	53                   	push   %ebx
+     d62:	83 ec 0c             	sub    $0xc,%esp
+     d65:	89 c1                	mov    %eax,%ecx
+  Fblock **pp, *p, *prev;
+
+  prev = 0;
+     d67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     d6c:	ba cc 39 00 00       	mov    $0x39cc,%edx
+     d71:	eb 05                	jmp    d78 <largefree+0x1c>
+     d73:	8d 50 08             	lea    0x8(%eax),%edx
+    prev = p;
+     d76:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     d78:	8b 02                	mov    (%edx),%eax
+     d7a:	85 c0                	test   %eax,%eax
+     d7c:	74 04                	je     d82 <largefree+0x26>
+     d7e:	39 c8                	cmp    %ecx,%eax
+     d80:	72 f1                	jb     d73 <largefree+0x17>
+  b->next = p;
+     d82:	89 41 08             	mov    %eax,0x8(%ecx)
+  if(p && (char*)b + b->h.size == (char*)p){
+     d85:	85 c0                	test   %eax,%eax
+     d87:	74 09                	je     d92 <largefree+0x36>
+     d89:	8b 31                	mov    (%ecx),%esi
+     d8b:	8d 3c 31             	lea    (%ecx,%esi,1),%edi
+     d8e:	39 c7                	cmp    %eax,%edi
+     d90:	74 21                	je     db3 <largefree+0x57>
+    b->h.size += p->h.size;
+    b->next = p->next;
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+     d92:	85 db                	test   %ebx,%ebx
+     d94:	74 09                	je     d9f <largefree+0x43>
+     d96:	8b 03                	mov    (%ebx),%eax
+     d98:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+     d9b:	39 ce                	cmp    %ecx,%esi
+     d9d:	74 20                	je     dbf <largefree+0x63>
+    prev->h.size += b->h.size;
+    prev->next = b->next;
+  } else
+    *pp = b;
+     d9f:	89 0a                	mov    %ecx,(%edx)
+
+  // Give the top of the heap back.  With threads sharing the
+  // address space sbrk() cannot shrink it; keep the block then.
+  for(pp = &large; (*pp)->next; pp = &(*pp)->next)
+     da1:	be cc 39 00 00       	mov    $0x39cc,%esi
+     da6:	8b 1e                	mov    (%esi),%ebx
+     da8:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+     dac:	74 1d                	je     dcb <largefree+0x6f>
+     dae:	8d 73 08             	lea    0x8(%ebx),%esi
+     db1:	eb f3                	jmp    da6 <largefree+0x4a>
+    b->h.size += p->h.size;
+     db3:	03 30                	add    (%eax),%esi
+     db5:	89 31                	mov    %esi,(%ecx)
+    b->next = p->next;
+     db7:	8b 40 08             	mov    0x8(%eax),%eax
+     dba:	89 41 08             	mov    %eax,0x8(%ecx)
+     dbd:	eb d3                	jmp    d92 <largefree+0x36>
+    prev->h.size += b->h.size;
+     dbf:	03 01                	add    (%ecx),%eax
+     dc1:	89 03                	mov    %eax,(%ebx)
+    prev->next = b->next;
+     dc3:	8b 41 08             	mov    0x8(%ecx),%eax
+     dc6:	89 43 08             	mov    %eax,0x8(%ebx)
+     dc9:	eb d6                	jmp    da1 <largefree+0x45>
+    ;
+  b = *pp;
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     dcb:	89 df                	mov    %ebx,%edi
+     dcd:	03 3b                	add    (%ebx),%edi
+     dcf:	83 ec 0c             	sub    $0xc,%esp
+     dd2:	6a 00                	push   $0x0
+     dd4:	e8 93 fa ff ff       	call   86c <sbrk>
+     dd9:	83 c4 10             	add    $0x10,%esp
+     ddc:	39 c7                	cmp    %eax,%edi
+     dde:	74 08                	je     de8 <largefree+0x8c>
+    *pp = 0;
+}
+     de0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     de3:	5b                   	pop    %ebx
+     de4:	5e                   	pop    %esi
+     de5:	5f                   	pop    %edi
+     de6:	5d                   	pop    %ebp
+     de7:	c3                   	ret
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     de8:	8b 03                	mov    (%ebx),%eax
+     dea:	f7 d8                	neg    %eax
+     dec:	83 ec 0c             	sub    $0xc,%esp
+     def:	50                   	push   %eax
+     df0:	e8 77 fa ff ff       	call   86c <sbrk>
+     df5:	83 c4 10             	add    $0x10,%esp
+     df8:	83 f8 ff             	cmp    $0xffffffff,%eax
+     dfb:	74 e3                	je     de0 <largefree+0x84>
+    *pp = 0;
+     dfd:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+     e03:	eb db                	jmp    de0 <largefree+0x84>
+
+00000e05 <more>:
+{
+     e05:	55                   	push   %ebp
+     e06:	89 e5                	mov    %esp,%ebp
+     e08:	56                   	push   %esi
+     e09:	53                   	push   %ebx
+     e0a:	89 c6                	mov    %eax,%esi
+  pad = -(uint)sbrk(0) & 7;
+     e0c:	83 ec 0c             	sub    $0xc,%esp
+     e0f:	6a 00                	push   $0x0
+     e11:	e8 56 fa ff ff       	call   86c <sbrk>
+     e16:	f7 d8                	neg    %eax
+     e18:	89 c3                	mov    %eax,%ebx
+     e1a:	83 e3 07             	and    $0x7,%ebx
+  if((p = sbrk(n + pad)) == (char*)-1)
+     e1d:	01 de                	add    %ebx,%esi
+     e1f:	89 34 24             	mov    %esi,(%esp)
+     e22:	e8 45 fa ff ff       	call   86c <sbrk>
+     e27:	83 c4 10             	add    $0x10,%esp
+     e2a:	83 f8 ff             	cmp    $0xffffffff,%eax
+     e2d:	74 09                	je     e38 <more+0x33>
+  return p + pad;
+     e2f:	01 d8                	add    %ebx,%eax
+}
+     e31:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e34:	5b                   	pop    %ebx
+     e35:	5e                   	pop    %esi
+     e36:	5d                   	pop    %ebp
+     e37:	c3                   	ret
+    return 0;
+     e38:	b8 00 00 00 00       	mov    $0x0,%eax
+     e3d:	eb f2                	jmp    e31 <more+0x2c>
+
+00000e3f <slaballoc>:
+{
+     e3f:	55                   	push   %ebp
+     e40:	89 e5                	mov    %esp,%ebp
+     e42:	56                   	push   %esi
+     e43:	53                   	push   %ebx
+     e44:	89 c6                	mov    %eax,%esi
+  n = 1 << (MINSHIFT + c);
+     e46:	8d 48 04             	lea    0x4(%eax),%ecx
+     e49:	bb 01 00 00 00       	mov    $0x1,%ebx
+     e4e:	d3 e3                	shl    %cl,%ebx
+  if(slab + n > slabend){
+     e50:	89 d8                	mov    %ebx,%eax
+     e52:	03 05 c8 39 00 00    	add    0x39c8,%eax
+     e58:	39 05 c4 39 00 00    	cmp    %eax,0x39c4
+     e5e:	72 17                	jb     e77 <slaballoc+0x38>
+  h = (Header*)slab;
+     e60:	a1 c8 39 00 00       	mov    0x39c8,%eax
+  slab += n;
+     e65:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+     e68:	89 15 c8 39 00 00    	mov    %edx,0x39c8
+  h->size = n;
+     e6e:	89 18                	mov    %ebx,(%eax)
+  h->class = c;
+     e70:	89 70 04             	mov    %esi,0x4(%eax)
+}
+     e73:	5b                   	pop    %ebx
+     e74:	5e                   	pop    %esi
+     e75:	5d                   	pop    %ebp
+     e76:	c3                   	ret
+    if((p = more(SLABSZ)) == 0)
+     e77:	b8 00 40 00 00       	mov    $0x4000,%eax
+     e7c:	e8 84 ff ff ff       	call   e05 <more>
+     e81:	85 c0                	test   %eax,%eax
+     e83:	74 ee                	je     e73 <slaballoc+0x34>
+    if(p != slabend)
+     e85:	39 05 c4 39 00 00    	cmp    %eax,0x39c4
+     e8b:	74 05                	je     e92 <slaballoc+0x53>
+      slab = p;
+     e8d:	a3 c8 39 00 00       	mov    %eax,0x39c8
+    slabend = p + SLABSZ;
+     e92:	05 00 40 00 00       	add    $0x4000,%eax
+     e97:	a3 c4 39 00 00       	mov    %eax,0x39c4
+     e9c:	eb c2                	jmp    e60 <slaballoc+0x21>
+
+00000e9e <largealloc>:
+{
+     e9e:	55                   	push   %ebp
+     e9f:	89 e5                	mov    %esp,%ebp
+     ea1:	56                   	push   %esi
+     ea2:	53                   	push   %ebx
+     ea3:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     ea5:	b9 cc 39 00 00       	mov    $0x39cc,%ecx
+     eaa:	8b 01                	mov    (%ecx),%eax
+     eac:	85 c0                	test   %eax,%eax
+     eae:	74 36                	je     ee6 <largealloc+0x48>
+    if(b->h.size < n)
+     eb0:	8b 10                	mov    (%eax),%edx
+     eb2:	39 da                	cmp    %ebx,%edx
+     eb4:	72 24                	jb     eda <largealloc+0x3c>
+    if(b->h.size - n > SMALLMAX){
+     eb6:	29 da                	sub    %ebx,%edx
+     eb8:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+     ebe:	76 1f                	jbe    edf <largealloc+0x41>
+      rest = (Fblock*)((char*)b + n);
+     ec0:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+      rest->h.size = b->h.size - n;
+     ec3:	89 16                	mov    %edx,(%esi)
+      rest->h.class = LARGE;
+     ec5:	c7 46 04 09 00 00 00 	movl   $0x9,0x4(%esi)
+      rest->next = b->next;
+     ecc:	8b 50 08             	mov    0x8(%eax),%edx
+     ecf:	89 56 08             	mov    %edx,0x8(%esi)
+      *pp = rest;
+     ed2:	89 31                	mov    %esi,(%ecx)
+      b->h.size = n;
+     ed4:	89 18                	mov    %ebx,(%eax)
+}
+     ed6:	5b                   	pop    %ebx
+     ed7:	5e                   	pop    %esi
+     ed8:	5d                   	pop    %ebp
+     ed9:	c3                   	ret
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     eda:	8d 48 08             	lea    0x8(%eax),%ecx
+     edd:	eb cb                	jmp    eaa <largealloc+0xc>
+      *pp = b->next;
+     edf:	8b 50 08             	mov    0x8(%eax),%edx
+     ee2:	89 11                	mov    %edx,(%ecx)
+    return &b->h;
+     ee4:	eb f0                	jmp    ed6 <largealloc+0x38>
+  if((b = more(n)) == 0)
+     ee6:	89 d8                	mov    %ebx,%eax
+     ee8:	e8 18 ff ff ff       	call   e05 <more>
+     eed:	85 c0                	test   %eax,%eax
+     eef:	74 e5                	je     ed6 <largealloc+0x38>
+  b->h.size = n;
+     ef1:	89 18                	mov    %ebx,(%eax)
+  b->h.class = LARGE;
+     ef3:	c7 40 04 09 00 00 00 	movl   $0x9,0x4(%eax)
+  return &b->h;
+     efa:	eb da                	jmp    ed6 <largealloc+0x38>
+
+00000efc <free>:
+
+void
+free(void *ap)
+{
+     efc:	55                   	push   %ebp
+     efd:	89 e5                	mov    %esp,%ebp
+     eff:	56                   	push   %esi
+     f00:	53                   	push   %ebx
+     f01:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+
+  if(ap == 0)
+     f04:	85 db                	test   %ebx,%ebx
+     f06:	74 3b                	je     f43 <free+0x47>
+    return;
+  h = (Header*)ap - 1;
+     f08:	8d 73 f8             	lea    -0x8(%ebx),%esi
+  lock_acquire(&lock);
+     f0b:	83 ec 0c             	sub    $0xc,%esp
+     f0e:	68 c0 39 00 00       	push   $0x39c0
+     f13:	e8 9c 01 00 00       	call   10b4 <lock_acquire>
+  if(h->class == LARGE)
+     f18:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     f1b:	83 c4 10             	add    $0x10,%esp
+     f1e:	83 f8 09             	cmp    $0x9,%eax
+     f21:	74 27                	je     f4a <free+0x4e>
+    largefree((Fblock*)h);
+  else {
+    ((Fblock*)h)->next = freelist[h->class];
+     f23:	8b 14 85 e0 39 00 00 	mov    0x39e0(,%eax,4),%edx
+     f2a:	89 13                	mov    %edx,(%ebx)
+    freelist[h->class] = (Fblock*)h;
+     f2c:	89 34 85 e0 39 00 00 	mov    %esi,0x39e0(,%eax,4)
+  }
+  lock_release(&lock);
+     f33:	83 ec 0c             	sub    $0xc,%esp
+     f36:	68 c0 39 00 00       	push   $0x39c0
+     f3b:	e8 88 01 00 00       	call   10c8 <lock_release>
+     f40:	83 c4 10             	add    $0x10,%esp
+}
+     f43:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f46:	5b                   	pop    %ebx
+     f47:	5e                   	pop    %esi
+     f48:	5d                   	pop    %ebp
+     f49:	c3                   	ret
+    largefree((Fblock*)h);
+     f4a:	89 f0                	mov    %esi,%eax
+     f4c:	e8 0b fe ff ff       	call   d5c <largefree>
+     f51:	eb e0                	jmp    f33 <free+0x37>
+
+00000f53 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     f53:	55                   	push   %ebp
+     f54:	89 e5                	mov    %esp,%ebp
+     f56:	53                   	push   %ebx
+     f57:	83 ec 04             	sub    $0x4,%esp
+     f5a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+  uint n;
+  int c;
+
+  if(nbytes > 0x7fffffff - sizeof(Header) - 7)
+     f5d:	81 fb f0 ff ff 7f    	cmp    $0x7ffffff0,%ebx
+     f63:	0f 87 8b 00 00 00    	ja     ff4 <malloc+0xa1>
+    return 0;
+  n = (nbytes + sizeof(Header) + 7) & ~7;
+     f69:	83 c3 0f             	add    $0xf,%ebx
+     f6c:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(n < sizeof(Fblock))
+     f6f:	83 fb 0b             	cmp    $0xb,%ebx
+     f72:	77 05                	ja     f79 <malloc+0x26>
+    n = sizeof(Fblock);
+     f74:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  lock_acquire(&lock);
+     f79:	83 ec 0c             	sub    $0xc,%esp
+     f7c:	68 c0 39 00 00       	push   $0x39c0
+     f81:	e8 2e 01 00 00       	call   10b4 <lock_acquire>
+  if(n <= SMALLMAX){
+     f86:	83 c4 10             	add    $0x10,%esp
+     f89:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+     f8f:	77 58                	ja     fe9 <malloc+0x96>
+    for(c = 0; (1 << (MINSHIFT + c)) < n; c++)
+     f91:	ba 00 00 00 00       	mov    $0x0,%edx
+     f96:	eb 03                	jmp    f9b <malloc+0x48>
+     f98:	83 c2 01             	add    $0x1,%edx
+     f9b:	8d 4a 04             	lea    0x4(%edx),%ecx
+     f9e:	b8 01 00 00 00       	mov    $0x1,%eax
+     fa3:	d3 e0                	shl    %cl,%eax
+     fa5:	39 d8                	cmp    %ebx,%eax
+     fa7:	72 ef                	jb     f98 <malloc+0x45>
+      ;
+    if(freelist[c]){
+     fa9:	8b 04 95 e0 39 00 00 	mov    0x39e0(,%edx,4),%eax
+     fb0:	85 c0                	test   %eax,%eax
+     fb2:	74 2a                	je     fde <malloc+0x8b>
+      h = &freelist[c]->h;
+     fb4:	89 c3                	mov    %eax,%ebx
+      freelist[c] = freelist[c]->next;
+     fb6:	8b 40 08             	mov    0x8(%eax),%eax
+     fb9:	89 04 95 e0 39 00 00 	mov    %eax,0x39e0(,%edx,4)
+    } else
+      h = slaballoc(c);
+  } else
+    h = largealloc(n);
+  lock_release(&lock);
+     fc0:	83 ec 0c             	sub    $0xc,%esp
+     fc3:	68 c0 39 00 00       	push   $0x39c0
+     fc8:	e8 fb 00 00 00       	call   10c8 <lock_release>
+  return h ? (void*)(h + 1) : 0;
+     fcd:	83 c4 10             	add    $0x10,%esp
+     fd0:	85 db                	test   %ebx,%ebx
+     fd2:	74 03                	je     fd7 <malloc+0x84>
+     fd4:	83 c3 08             	add    $0x8,%ebx
+}
+     fd7:	89 d8                	mov    %ebx,%eax
+     fd9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     fdc:	c9                   	leave
+     fdd:	c3                   	ret
+      h = slaballoc(c);
+     fde:	89 d0                	mov    %edx,%eax
+     fe0:	e8 5a fe ff ff       	call   e3f <slaballoc>
+     fe5:	89 c3                	mov    %eax,%ebx
+     fe7:	eb d7                	jmp    fc0 <malloc+0x6d>
+    h = largealloc(n);
+     fe9:	89 d8                	mov    %ebx,%eax
+     feb:	e8 ae fe ff ff       	call   e9e <largealloc>
+     ff0:	89 c3                	mov    %eax,%ebx
+     ff2:	eb cc                	jmp    fc0 <malloc+0x6d>
+    return 0;
+     ff4:	bb 00 00 00 00       	mov    $0x0,%ebx
+     ff9:	eb dc                	jmp    fd7 <malloc+0x84>
+
+00000ffb <tstart>:
+  void *arg;
+};
+
+static void
+tstart(void *a)
+{
+     ffb:	55                   	push   %ebp
+     ffc:	89 e5                	mov    %esp,%ebp
+     ffe:	83 ec 14             	sub    $0x14,%esp
+    1001:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+    1004:	ff 70 04             	push   0x4(%eax)
+    1007:	ff 10                	call   *(%eax)
+  exit();
+    1009:	e8 86 f6 ff ff       	call   694 <exit>
+
+0000100e <thread_create>:
+}
+
+// Run fn(arg) in a new thread.  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    100e:	55                   	push   %ebp
+    100f:	89 e5                	mov    %esp,%ebp
+    1011:	56                   	push   %esi
+    1012:	53                   	push   %ebx
+  struct tstart *t;
+  char *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    1013:	83 ec 0c             	sub    $0xc,%esp
+    1016:	68 00 10 00 00       	push   $0x1000
+    101b:	e8 33 ff ff ff       	call   f53 <malloc>
+    1020:	83 c4 10             	add    $0x10,%esp
+    1023:	85 c0                	test   %eax,%eax
+    1025:	74 42                	je     1069 <thread_create+0x5b>
+    1027:	89 c3                	mov    %eax,%ebx
+    return -1;
+  t = (struct tstart*)stack;
+  t->fn = fn;
+    1029:	8b 45 08             	mov    0x8(%ebp),%eax
+    102c:	89 03                	mov    %eax,(%ebx)
+  t->arg = arg;
+    102e:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1031:	89 43 04             	mov    %eax,0x4(%ebx)
+  if((pid = clone(tstart, stack + TSTACK, t)) < 0)
+    1034:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    103a:	83 ec 04             	sub    $0x4,%esp
+    103d:	53                   	push   %ebx
+    103e:	50                   	push   %eax
+    103f:	68 fb 0f 00 00       	push   $0xffb
+    1044:	e8 f5 f8 ff ff       	call   93e <clone>
+    1049:	89 c6                	mov    %eax,%esi
+    104b:	83 c4 10             	add    $0x10,%esp
+    104e:	85 c0                	test   %eax,%eax
+    1050:	78 09                	js     105b <thread_create+0x4d>
+    free(stack);
+  return pid;
+}
+    1052:	89 f0                	mov    %esi,%eax
+    1054:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1057:	5b                   	pop    %ebx
+    1058:	5e                   	pop    %esi
+    1059:	5d                   	pop    %ebp
+    105a:	c3                   	ret
+    free(stack);
+    105b:	83 ec 0c             	sub    $0xc,%esp
+    105e:	53                   	push   %ebx
+    105f:	e8 98 fe ff ff       	call   efc <free>
+    1064:	83 c4 10             	add    $0x10,%esp
+    1067:	eb e9                	jmp    1052 <thread_create+0x44>
+    return -1;
+    1069:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    106e:	eb e2                	jmp    1052 <thread_create+0x44>
+
+00001070 <thread_join>:
+
+// Wait for one of this process's threads to exit and free its
+// stack.  Returns its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+    1070:	55                   	push   %ebp
+    1071:	89 e5                	mov    %esp,%ebp
+    1073:	53                   	push   %ebx
+    1074:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    1077:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    107a:	50                   	push   %eax
+    107b:	e8 cd f8 ff ff       	call   94d <join>
+    1080:	89 c3                	mov    %eax,%ebx
+    1082:	83 c4 10             	add    $0x10,%esp
+    1085:	85 c0                	test   %eax,%eax
+    1087:	79 07                	jns    1090 <thread_join+0x20>
+    free((char*)stack - TSTACK);
+  return pid;
+}
+    1089:	89 d8                	mov    %ebx,%eax
+    108b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    108e:	c9                   	leave
+    108f:	c3                   	ret
+    free((char*)stack - TSTACK);
+    1090:	83 ec 0c             	sub    $0xc,%esp
+    1093:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1096:	2d 00 10 00 00       	sub    $0x1000,%eax
+    109b:	50                   	push   %eax
+    109c:	e8 5b fe ff ff       	call   efc <free>
+    10a1:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    10a4:	eb e3                	jmp    1089 <thread_join+0x19>
+
+000010a6 <lock_init>:
+
+void
+lock_init(lock_t *lk)
+{
+    10a6:	55                   	push   %ebp
+    10a7:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    10a9:	8b 45 08             	mov    0x8(%ebp),%eax
+    10ac:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    10b2:	5d                   	pop    %ebp
+    10b3:	c3                   	ret
+
+000010b4 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+    10b4:	55                   	push   %ebp
+    10b5:	89 e5                	mov    %esp,%ebp
+    10b7:	8b 55 08             	mov    0x8(%ebp),%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    10ba:	b8 01 00 00 00       	mov    $0x1,%eax
+    10bf:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    10c2:	85 c0                	test   %eax,%eax
+    10c4:	75 f4                	jne    10ba <lock_acquire+0x6>
+    ;
+}
+    10c6:	5d                   	pop    %ebp
+    10c7:	c3                   	ret
+
+000010c8 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+    10c8:	55                   	push   %ebp
+    10c9:	89 e5                	mov    %esp,%ebp
+    10cb:	8b 55 08             	mov    0x8(%ebp),%edx
+    10ce:	b8 00 00 00 00       	mov    $0x0,%eax
+    10d3:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    10d6:	5d                   	pop    %ebp
+    10d7:	c3                   	ret
+
+000010d8 <mutex_init>:
+// Are Tricky": state is 0 when free, 1 when held, 2 when held and
+// others may be waiting.  Unlocking an uncontended mutex costs no
+// system call.
+void
+mutex_init(mutex_t *m)
+{
+    10d8:	55                   	push   %ebp
+    10d9:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    10db:	8b 45 08             	mov    0x8(%ebp),%eax
+    10de:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    10e4:	5d                   	pop    %ebp
+    10e5:	c3                   	ret
+
+000010e6 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+    10e6:	55                   	push   %ebp
+    10e7:	89 e5                	mov    %esp,%ebp
+    10e9:	53                   	push   %ebx
+    10ea:	83 ec 04             	sub    $0x4,%esp
+    10ed:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    10f0:	b8 00 00 00 00       	mov    $0x0,%eax
+    10f5:	b9 01 00 00 00       	mov    $0x1,%ecx
+    10fa:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    10fe:	85 c0                	test   %eax,%eax
+    1100:	74 29                	je     112b <mutex_lock+0x45>
+    return;
+  if(c != 2)
+    1102:	83 f8 02             	cmp    $0x2,%eax
+    1105:	74 20                	je     1127 <mutex_lock+0x41>
+    1107:	b8 02 00 00 00       	mov    $0x2,%eax
+    110c:	f0 87 03             	lock xchg %eax,(%ebx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    110f:	eb 16                	jmp    1127 <mutex_lock+0x41>
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    1111:	83 ec 08             	sub    $0x8,%esp
+    1114:	6a 02                	push   $0x2
+    1116:	53                   	push   %ebx
+    1117:	e8 40 f8 ff ff       	call   95c <futex_wait>
+  asm volatile("lock; xchgl %0, %1" :
+    111c:	b8 02 00 00 00       	mov    $0x2,%eax
+    1121:	f0 87 03             	lock xchg %eax,(%ebx)
+    1124:	83 c4 10             	add    $0x10,%esp
+  while(c != 0){
+    1127:	85 c0                	test   %eax,%eax
+    1129:	75 e6                	jne    1111 <mutex_lock+0x2b>
+    c = xchg(&m->state, 2);
+  }
+}
+    112b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    112e:	c9                   	leave
+    112f:	c3                   	ret
+
+00001130 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+    1130:	55                   	push   %ebp
+    1131:	89 e5                	mov    %esp,%ebp
+    1133:	83 ec 08             	sub    $0x8,%esp
+    1136:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    1139:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    113e:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    1142:	83 fa 01             	cmp    $0x1,%edx
+    1145:	75 02                	jne    1149 <mutex_unlock+0x19>
+    m->state = 0;
+    futex_wake(&m->state, 1);
+  }
+}
+    1147:	c9                   	leave
+    1148:	c3                   	ret
+    m->state = 0;
+    1149:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+    114f:	83 ec 08             	sub    $0x8,%esp
+    1152:	6a 01                	push   $0x1
+    1154:	50                   	push   %eax
+    1155:	e8 11 f8 ff ff       	call   96b <futex_wake>
+    115a:	83 c4 10             	add    $0x10,%esp
+}
+    115d:	eb e8                	jmp    1147 <mutex_unlock+0x17>
+
+0000115f <cond_init>:
+// Condition variable: waiters sleep on a sequence number that
+// every signal bumps, so a signal between the unlock and the
+// futex_wait() in cond_wait() is not lost.
+void
+cond_init(cond_t *c)
+{
+    115f:	55                   	push   %ebp
+    1160:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    1162:	8b 45 08             	mov    0x8(%ebp),%eax
+    1165:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    116b:	5d                   	pop    %ebp
+    116c:	c3                   	ret
+
+0000116d <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+    116d:	55                   	push   %ebp
+    116e:	89 e5                	mov    %esp,%ebp
+    1170:	57                   	push   %edi
+    1171:	56                   	push   %esi
+    1172:	53                   	push   %ebx
+    1173:	83 ec 18             	sub    $0x18,%esp
+    1176:	8b 75 08             	mov    0x8(%ebp),%esi
+    1179:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    117c:	8b 3e                	mov    (%esi),%edi
+  mutex_unlock(m);
+    117e:	53                   	push   %ebx
+    117f:	e8 ac ff ff ff       	call   1130 <mutex_unlock>
+  futex_wait(&c->seq, seq);
+    1184:	83 c4 08             	add    $0x8,%esp
+    1187:	57                   	push   %edi
+    1188:	56                   	push   %esi
+    1189:	e8 ce f7 ff ff       	call   95c <futex_wait>
+  // Others may be waiting for m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+    118e:	83 c4 10             	add    $0x10,%esp
+    1191:	eb 0e                	jmp    11a1 <cond_wait+0x34>
+    futex_wait(&m->state, 2);
+    1193:	83 ec 08             	sub    $0x8,%esp
+    1196:	6a 02                	push   $0x2
+    1198:	53                   	push   %ebx
+    1199:	e8 be f7 ff ff       	call   95c <futex_wait>
+    119e:	83 c4 10             	add    $0x10,%esp
+    11a1:	b8 02 00 00 00       	mov    $0x2,%eax
+    11a6:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    11a9:	85 c0                	test   %eax,%eax
+    11ab:	75 e6                	jne    1193 <cond_wait+0x26>
+}
+    11ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11b0:	5b                   	pop    %ebx
+    11b1:	5e                   	pop    %esi
+    11b2:	5f                   	pop    %edi
+    11b3:	5d                   	pop    %ebp
+    11b4:	c3                   	ret
+
+000011b5 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+    11b5:	55                   	push   %ebp
+    11b6:	89 e5                	mov    %esp,%ebp
+    11b8:	83 ec 10             	sub    $0x10,%esp
+    11bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    11be:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+    11c2:	6a 01                	push   $0x1
+    11c4:	50                   	push   %eax
+    11c5:	e8 a1 f7 ff ff       	call   96b <futex_wake>
+}
+    11ca:	83 c4 10             	add    $0x10,%esp
+    11cd:	c9                   	leave
+    11ce:	c3                   	ret
+
+000011cf <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+    11cf:	55                   	push   %ebp
+    11d0:	89 e5                	mov    %esp,%ebp
+    11d2:	83 ec 10             	sub    $0x10,%esp
+    11d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    11d8:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, NPROC);
+    11dc:	6a 40                	push   $0x40
+    11de:	50                   	push   %eax
+    11df:	e8 87 f7 ff ff       	call   96b <futex_wake>
+}
+    11e4:	83 c4 10             	add    $0x10,%esp
+    11e7:	c9                   	leave
+    11e8:	c3                   	ret
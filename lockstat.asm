@@ -0,0 +1,2948 @@
+
+_lockstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <print>:
+static struct lockstat sum[NNAME];
+static int nlock[NNAME];
+
+static void
+print(struct lockstat *ls, int n)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	57                   	push   %edi
+       4:	56                   	push   %esi
+       5:	53                   	push   %ebx
+       6:	83 ec 1c             	sub    $0x1c,%esp
+       9:	89 c1                	mov    %eax,%ecx
+       b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  printf(1, "%s\t%s\t%d\t%d\t%d\t%d\t%d\n", ls->name,
+         ls->sleep ? "sleep" : "spin", n, ls->nacq, ls->ncontend,
+         (uint)(ls->wait >> 10), (uint)(ls->maxhold >> 10));
+       e:	8b 40 24             	mov    0x24(%eax),%eax
+      11:	8b 51 28             	mov    0x28(%ecx),%edx
+      14:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+      18:	c1 ea 0a             	shr    $0xa,%edx
+  printf(1, "%s\t%s\t%d\t%d\t%d\t%d\t%d\n", ls->name,
+      1b:	89 c3                	mov    %eax,%ebx
+         (uint)(ls->wait >> 10), (uint)(ls->maxhold >> 10));
+      1d:	8b 41 1c             	mov    0x1c(%ecx),%eax
+      20:	8b 51 20             	mov    0x20(%ecx),%edx
+      23:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+      27:	c1 ea 0a             	shr    $0xa,%edx
+  printf(1, "%s\t%s\t%d\t%d\t%d\t%d\t%d\n", ls->name,
+      2a:	8b 79 18             	mov    0x18(%ecx),%edi
+      2d:	8b 71 14             	mov    0x14(%ecx),%esi
+      30:	83 79 10 00          	cmpl   $0x0,0x10(%ecx)
+      34:	74 28                	je     5e <print+0x5e>
+      36:	ba c8 13 00 00       	mov    $0x13c8,%edx
+      3b:	83 ec 0c             	sub    $0xc,%esp
+      3e:	53                   	push   %ebx
+      3f:	50                   	push   %eax
+      40:	57                   	push   %edi
+      41:	56                   	push   %esi
+      42:	ff 75 e4             	push   -0x1c(%ebp)
+      45:	52                   	push   %edx
+      46:	51                   	push   %ecx
+      47:	68 d3 13 00 00       	push   $0x13d3
+      4c:	6a 01                	push   $0x1
+      4e:	e8 59 0d 00 00       	call   dac <printf>
+}
+      53:	83 c4 30             	add    $0x30,%esp
+      56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      59:	5b                   	pop    %ebx
+      5a:	5e                   	pop    %esi
+      5b:	5f                   	pop    %edi
+      5c:	5d                   	pop    %ebp
+      5d:	c3                   	ret
+  printf(1, "%s\t%s\t%d\t%d\t%d\t%d\t%d\n", ls->name,
+      5e:	ba ce 13 00 00       	mov    $0x13ce,%edx
+      63:	eb d6                	jmp    3b <print+0x3b>
+
+00000065 <main>:
+
+int
+main(int argc, char *argv[])
+{
+      65:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+      69:	83 e4 f0             	and    $0xfffffff0,%esp
+      6c:	ff 71 fc             	push   -0x4(%ecx)
+      6f:	55                   	push   %ebp
+      70:	89 e5                	mov    %esp,%ebp
+      72:	57                   	push   %edi
+      73:	56                   	push   %esi
+      74:	53                   	push   %ebx
+      75:	51                   	push   %ecx
+      76:	83 ec 48             	sub    $0x48,%esp
+      79:	8b 59 04             	mov    0x4(%ecx),%ebx
+  struct lockstat ls;
+  int i, j, n, aflag;
+
+  if(argc > 1 && strcmp(argv[1], "-r") == 0){
+      7c:	83 39 01             	cmpl   $0x1,(%ecx)
+      7f:	7e 63                	jle    e4 <main+0x7f>
+      81:	83 ec 08             	sub    $0x8,%esp
+      84:	68 e9 13 00 00       	push   $0x13e9
+      89:	ff 73 04             	push   0x4(%ebx)
+      8c:	e8 d0 01 00 00       	call   261 <strcmp>
+      91:	83 c4 10             	add    $0x10,%esp
+      94:	85 c0                	test   %eax,%eax
+      96:	75 2c                	jne    c4 <main+0x5f>
+    if(lockstat(-1, 0) < 0){
+      98:	83 ec 08             	sub    $0x8,%esp
+      9b:	6a 00                	push   $0x0
+      9d:	6a ff                	push   $0xffffffff
+      9f:	e8 f1 0a 00 00       	call   b95 <lockstat>
+      a4:	83 c4 10             	add    $0x10,%esp
+      a7:	85 c0                	test   %eax,%eax
+      a9:	78 05                	js     b0 <main+0x4b>
+      printf(2, "lockstat: reset failed\n");
+      exit();
+    }
+    exit();
+      ab:	e8 c3 07 00 00       	call   873 <exit>
+      printf(2, "lockstat: reset failed\n");
+      b0:	83 ec 08             	sub    $0x8,%esp
+      b3:	68 ec 13 00 00       	push   $0x13ec
+      b8:	6a 02                	push   $0x2
+      ba:	e8 ed 0c 00 00       	call   dac <printf>
+      exit();
+      bf:	e8 af 07 00 00       	call   873 <exit>
+  }
+  aflag = argc > 1 && strcmp(argv[1], "-a") == 0;
+      c4:	83 ec 08             	sub    $0x8,%esp
+      c7:	68 04 14 00 00       	push   $0x1404
+      cc:	ff 73 04             	push   0x4(%ebx)
+      cf:	e8 8d 01 00 00       	call   261 <strcmp>
+      d4:	83 c4 10             	add    $0x10,%esp
+      d7:	85 c0                	test   %eax,%eax
+      d9:	75 31                	jne    10c <main+0xa7>
+      db:	c7 45 b4 01 00 00 00 	movl   $0x1,-0x4c(%ebp)
+      e2:	eb 07                	jmp    eb <main+0x86>
+      e4:	c7 45 b4 00 00 00 00 	movl   $0x0,-0x4c(%ebp)
+
+  printf(1, "NAME\tTYPE\tLOCKS\tACQ\tCONT\tWAIT\tMAXHOLD\n");
+      eb:	83 ec 08             	sub    $0x8,%esp
+      ee:	68 08 14 00 00       	push   $0x1408
+      f3:	6a 01                	push   $0x1
+      f5:	e8 b2 0c 00 00       	call   dac <printf>
+  n = 0;
+  for(i = 0; lockstat(i, &ls) == 0; i++){
+      fa:	83 c4 10             	add    $0x10,%esp
+  n = 0;
+      fd:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; lockstat(i, &ls) == 0; i++){
+     102:	bf 00 00 00 00       	mov    $0x0,%edi
+     107:	e9 b8 00 00 00       	jmp    1c4 <main+0x15f>
+  aflag = argc > 1 && strcmp(argv[1], "-a") == 0;
+     10c:	c7 45 b4 00 00 00 00 	movl   $0x0,-0x4c(%ebp)
+     113:	eb d6                	jmp    eb <main+0x86>
+    if(aflag){
+      print(&ls, 1);
+     115:	ba 01 00 00 00       	mov    $0x1,%edx
+     11a:	8d 45 bc             	lea    -0x44(%ebp),%eax
+     11d:	e8 de fe ff ff       	call   0 <print>
+      continue;
+     122:	e9 9a 00 00 00       	jmp    1c1 <main+0x15c>
+    }
+    for(j = 0; j < n; j++)
+     127:	83 c3 01             	add    $0x1,%ebx
+     12a:	39 f3                	cmp    %esi,%ebx
+     12c:	7d 27                	jge    155 <main+0xf0>
+      if(sum[j].sleep == ls.sleep && strcmp(sum[j].name, ls.name) == 0)
+     12e:	6b c3 2c             	imul   $0x2c,%ebx,%eax
+     131:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+     134:	39 88 b0 1c 00 00    	cmp    %ecx,0x1cb0(%eax)
+     13a:	75 eb                	jne    127 <main+0xc2>
+     13c:	05 a0 1c 00 00       	add    $0x1ca0,%eax
+     141:	83 ec 08             	sub    $0x8,%esp
+     144:	8d 55 bc             	lea    -0x44(%ebp),%edx
+     147:	52                   	push   %edx
+     148:	50                   	push   %eax
+     149:	e8 13 01 00 00       	call   261 <strcmp>
+     14e:	83 c4 10             	add    $0x10,%esp
+     151:	85 c0                	test   %eax,%eax
+     153:	75 d2                	jne    127 <main+0xc2>
+        break;
+    if(j == n){
+     155:	39 f3                	cmp    %esi,%ebx
+     157:	0f 84 8d 00 00 00    	je     1ea <main+0x185>
+      if(n == NNAME)
+        continue;
+      memmove(&sum[n++], &ls, sizeof(ls));
+    } else {
+      sum[j].nacq += ls.nacq;
+     15d:	6b cb 2c             	imul   $0x2c,%ebx,%ecx
+     160:	8d 81 a0 1c 00 00    	lea    0x1ca0(%ecx),%eax
+     166:	8b 55 d0             	mov    -0x30(%ebp),%edx
+     169:	03 91 b4 1c 00 00    	add    0x1cb4(%ecx),%edx
+     16f:	89 91 b4 1c 00 00    	mov    %edx,0x1cb4(%ecx)
+      sum[j].ncontend += ls.ncontend;
+     175:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     178:	01 50 18             	add    %edx,0x18(%eax)
+      sum[j].wait += ls.wait;
+     17b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+     17e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+     181:	01 50 1c             	add    %edx,0x1c(%eax)
+     184:	11 48 20             	adc    %ecx,0x20(%eax)
+      if(ls.maxhold > sum[j].maxhold)
+     187:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+     18a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     18d:	89 55 b0             	mov    %edx,-0x50(%ebp)
+     190:	8b 50 28             	mov    0x28(%eax),%edx
+     193:	83 c0 20             	add    $0x20,%eax
+     196:	39 48 04             	cmp    %ecx,0x4(%eax)
+     199:	1b 55 b0             	sbb    -0x50(%ebp),%edx
+     19c:	73 12                	jae    1b0 <main+0x14b>
+        sum[j].maxhold = ls.maxhold;
+     19e:	6b c3 2c             	imul   $0x2c,%ebx,%eax
+     1a1:	89 88 c4 1c 00 00    	mov    %ecx,0x1cc4(%eax)
+     1a7:	8b 55 b0             	mov    -0x50(%ebp),%edx
+     1aa:	89 90 c8 1c 00 00    	mov    %edx,0x1cc8(%eax)
+    }
+    nlock[j]++;
+     1b0:	8b 04 9d a0 1b 00 00 	mov    0x1ba0(,%ebx,4),%eax
+     1b7:	83 c0 01             	add    $0x1,%eax
+     1ba:	89 04 9d a0 1b 00 00 	mov    %eax,0x1ba0(,%ebx,4)
+  for(i = 0; lockstat(i, &ls) == 0; i++){
+     1c1:	83 c7 01             	add    $0x1,%edi
+     1c4:	83 ec 08             	sub    $0x8,%esp
+     1c7:	8d 45 bc             	lea    -0x44(%ebp),%eax
+     1ca:	50                   	push   %eax
+     1cb:	57                   	push   %edi
+     1cc:	e8 c4 09 00 00       	call   b95 <lockstat>
+     1d1:	83 c4 10             	add    $0x10,%esp
+     1d4:	85 c0                	test   %eax,%eax
+     1d6:	75 3c                	jne    214 <main+0x1af>
+    if(aflag){
+     1d8:	83 7d b4 00          	cmpl   $0x0,-0x4c(%ebp)
+     1dc:	0f 85 33 ff ff ff    	jne    115 <main+0xb0>
+    for(j = 0; j < n; j++)
+     1e2:	8b 5d b4             	mov    -0x4c(%ebp),%ebx
+     1e5:	e9 40 ff ff ff       	jmp    12a <main+0xc5>
+      if(n == NNAME)
+     1ea:	83 fe 40             	cmp    $0x40,%esi
+     1ed:	74 d2                	je     1c1 <main+0x15c>
+      memmove(&sum[n++], &ls, sizeof(ls));
+     1ef:	8d 46 01             	lea    0x1(%esi),%eax
+     1f2:	89 45 b0             	mov    %eax,-0x50(%ebp)
+     1f5:	6b c6 2c             	imul   $0x2c,%esi,%eax
+     1f8:	05 a0 1c 00 00       	add    $0x1ca0,%eax
+     1fd:	83 ec 04             	sub    $0x4,%esp
+     200:	6a 2c                	push   $0x2c
+     202:	8d 55 bc             	lea    -0x44(%ebp),%edx
+     205:	52                   	push   %edx
+     206:	50                   	push   %eax
+     207:	e8 96 02 00 00       	call   4a2 <memmove>
+     20c:	83 c4 10             	add    $0x10,%esp
+     20f:	8b 75 b0             	mov    -0x50(%ebp),%esi
+     212:	eb 9c                	jmp    1b0 <main+0x14b>
+  }
+  for(j = 0; j < n; j++)
+     214:	bb 00 00 00 00       	mov    $0x0,%ebx
+     219:	eb 17                	jmp    232 <main+0x1cd>
+    print(&sum[j], nlock[j]);
+     21b:	8b 14 9d a0 1b 00 00 	mov    0x1ba0(,%ebx,4),%edx
+     222:	6b c3 2c             	imul   $0x2c,%ebx,%eax
+     225:	05 a0 1c 00 00       	add    $0x1ca0,%eax
+     22a:	e8 d1 fd ff ff       	call   0 <print>
+  for(j = 0; j < n; j++)
+     22f:	83 c3 01             	add    $0x1,%ebx
+     232:	39 f3                	cmp    %esi,%ebx
+     234:	7c e5                	jl     21b <main+0x1b6>
+  exit();
+     236:	e8 38 06 00 00       	call   873 <exit>
+
+0000023b <strcpy>:
+#include "memlayout.h"
+#include "clock.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     23b:	55                   	push   %ebp
+     23c:	89 e5                	mov    %esp,%ebp
+     23e:	56                   	push   %esi
+     23f:	53                   	push   %ebx
+     240:	8b 75 08             	mov    0x8(%ebp),%esi
+     243:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     246:	89 f0                	mov    %esi,%eax
+     248:	89 d1                	mov    %edx,%ecx
+     24a:	83 c2 01             	add    $0x1,%edx
+     24d:	89 c3                	mov    %eax,%ebx
+     24f:	83 c0 01             	add    $0x1,%eax
+     252:	0f b6 09             	movzbl (%ecx),%ecx
+     255:	88 0b                	mov    %cl,(%ebx)
+     257:	84 c9                	test   %cl,%cl
+     259:	75 ed                	jne    248 <strcpy+0xd>
+    ;
+  return os;
+}
+     25b:	89 f0                	mov    %esi,%eax
+     25d:	5b                   	pop    %ebx
+     25e:	5e                   	pop    %esi
+     25f:	5d                   	pop    %ebp
+     260:	c3                   	ret
+
+00000261 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     261:	55                   	push   %ebp
+     262:	89 e5                	mov    %esp,%ebp
+     264:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     267:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+     26a:	eb 06                	jmp    272 <strcmp+0x11>
+    p++, q++;
+     26c:	83 c1 01             	add    $0x1,%ecx
+     26f:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+     272:	0f b6 01             	movzbl (%ecx),%eax
+     275:	84 c0                	test   %al,%al
+     277:	74 04                	je     27d <strcmp+0x1c>
+     279:	3a 02                	cmp    (%edx),%al
+     27b:	74 ef                	je     26c <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+     27d:	0f b6 c0             	movzbl %al,%eax
+     280:	0f b6 12             	movzbl (%edx),%edx
+     283:	29 d0                	sub    %edx,%eax
+}
+     285:	5d                   	pop    %ebp
+     286:	c3                   	ret
+
+00000287 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     287:	55                   	push   %ebp
+     288:	89 e5                	mov    %esp,%ebp
+     28a:	53                   	push   %ebx
+     28b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  const char *p;
+  uint w;
+
+  for(p = s; (uint)p & 3; p++)
+     28e:	89 c8                	mov    %ecx,%eax
+     290:	eb 03                	jmp    295 <strlen+0xe>
+     292:	83 c0 01             	add    $0x1,%eax
+     295:	a8 03                	test   $0x3,%al
+     297:	74 09                	je     2a2 <strlen+0x1b>
+    if(*p == 0)
+     299:	80 38 00             	cmpb   $0x0,(%eax)
+     29c:	75 f4                	jne    292 <strlen+0xb>
+      return p - s;
+     29e:	29 c8                	sub    %ecx,%eax
+     2a0:	eb 25                	jmp    2c7 <strlen+0x40>
+  // Then a word at a time, which never crosses into the next page:
+  // a word with a zero byte in it has one of these bits set.
+  for(;; p += 4){
+    w = *(uint*)p;
+     2a2:	8b 10                	mov    (%eax),%edx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     2a4:	8d 9a ff fe fe fe    	lea    -0x1010101(%edx),%ebx
+     2aa:	f7 d2                	not    %edx
+     2ac:	21 da                	and    %ebx,%edx
+     2ae:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+     2b4:	75 05                	jne    2bb <strlen+0x34>
+  for(;; p += 4){
+     2b6:	83 c0 04             	add    $0x4,%eax
+    w = *(uint*)p;
+     2b9:	eb e7                	jmp    2a2 <strlen+0x1b>
+      break;
+  }
+  while(*p)
+     2bb:	80 38 00             	cmpb   $0x0,(%eax)
+     2be:	74 05                	je     2c5 <strlen+0x3e>
+    p++;
+     2c0:	83 c0 01             	add    $0x1,%eax
+     2c3:	eb f6                	jmp    2bb <strlen+0x34>
+  return p - s;
+     2c5:	29 c8                	sub    %ecx,%eax
+}
+     2c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2ca:	c9                   	leave
+     2cb:	c3                   	ret
+
+000002cc <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     2cc:	55                   	push   %ebp
+     2cd:	89 e5                	mov    %esp,%ebp
+     2cf:	57                   	push   %edi
+     2d0:	56                   	push   %esi
+     2d1:	53                   	push   %ebx
+     2d2:	8b 55 10             	mov    0x10(%ebp),%edx
+  uint h;
+  char *d;
+
+  d = dst;
+  c &= 0xFF;
+     2d5:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  if(n >= 16){
+     2d9:	83 fa 0f             	cmp    $0xf,%edx
+     2dc:	76 52                	jbe    330 <memset+0x64>
+    h = -(uint)d & 3;
+     2de:	8b 45 08             	mov    0x8(%ebp),%eax
+     2e1:	f7 d8                	neg    %eax
+     2e3:	83 e0 03             	and    $0x3,%eax
+     2e6:	89 c6                	mov    %eax,%esi
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     2e8:	8b 7d 08             	mov    0x8(%ebp),%edi
+     2eb:	89 c1                	mov    %eax,%ecx
+     2ed:	89 d8                	mov    %ebx,%eax
+     2ef:	fc                   	cld
+     2f0:	f3 aa                	rep stos %al,%es:(%edi)
+    stosb(d, c, h);
+    stosl(d + h, (c<<24)|(c<<16)|(c<<8)|c, (n - h)/4);
+     2f2:	29 f2                	sub    %esi,%edx
+     2f4:	89 d1                	mov    %edx,%ecx
+     2f6:	c1 e9 02             	shr    $0x2,%ecx
+     2f9:	c1 e0 18             	shl    $0x18,%eax
+     2fc:	89 df                	mov    %ebx,%edi
+     2fe:	c1 e7 10             	shl    $0x10,%edi
+     301:	09 f8                	or     %edi,%eax
+     303:	89 df                	mov    %ebx,%edi
+     305:	c1 e7 08             	shl    $0x8,%edi
+     308:	09 f8                	or     %edi,%eax
+     30a:	09 d8                	or     %ebx,%eax
+     30c:	89 f7                	mov    %esi,%edi
+     30e:	03 7d 08             	add    0x8(%ebp),%edi
+}
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosl" :
+     311:	fc                   	cld
+     312:	f3 ab                	rep stos %eax,%es:(%edi)
+    d += h + (n - h)/4*4;
+     314:	89 d7                	mov    %edx,%edi
+     316:	83 e7 fc             	and    $0xfffffffc,%edi
+     319:	09 f7                	or     %esi,%edi
+     31b:	03 7d 08             	add    0x8(%ebp),%edi
+    n = (n - h)%4;
+     31e:	83 e2 03             	and    $0x3,%edx
+  asm volatile("cld; rep stosb" :
+     321:	89 d1                	mov    %edx,%ecx
+     323:	89 d8                	mov    %ebx,%eax
+     325:	fc                   	cld
+     326:	f3 aa                	rep stos %al,%es:(%edi)
+  }
+  stosb(d, c, n);
+  return dst;
+}
+     328:	8b 45 08             	mov    0x8(%ebp),%eax
+     32b:	5b                   	pop    %ebx
+     32c:	5e                   	pop    %esi
+     32d:	5f                   	pop    %edi
+     32e:	5d                   	pop    %ebp
+     32f:	c3                   	ret
+  d = dst;
+     330:	8b 7d 08             	mov    0x8(%ebp),%edi
+     333:	eb ec                	jmp    321 <memset+0x55>
+
+00000335 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     335:	55                   	push   %ebp
+     336:	89 e5                	mov    %esp,%ebp
+     338:	8b 45 08             	mov    0x8(%ebp),%eax
+     33b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     33f:	eb 03                	jmp    344 <strchr+0xf>
+     341:	83 c0 01             	add    $0x1,%eax
+     344:	0f b6 10             	movzbl (%eax),%edx
+     347:	84 d2                	test   %dl,%dl
+     349:	74 06                	je     351 <strchr+0x1c>
+    if(*s == c)
+     34b:	38 ca                	cmp    %cl,%dl
+     34d:	75 f2                	jne    341 <strchr+0xc>
+     34f:	eb 05                	jmp    356 <strchr+0x21>
+      return (char*)s;
+  return 0;
+     351:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     356:	5d                   	pop    %ebp
+     357:	c3                   	ret
+
+00000358 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     358:	55                   	push   %ebp
+     359:	89 e5                	mov    %esp,%ebp
+     35b:	56                   	push   %esi
+     35c:	53                   	push   %ebx
+     35d:	8b 55 08             	mov    0x8(%ebp),%edx
+     360:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     363:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  // A word at a time while they agree.
+  if((((uint)s1 | (uint)s2) & 3) == 0)
+     366:	89 d3                	mov    %edx,%ebx
+     368:	09 cb                	or     %ecx,%ebx
+     36a:	f6 c3 03             	test   $0x3,%bl
+     36d:	74 24                	je     393 <memcmp+0x3b>
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+      s1 += 4, s2 += 4;
+  while(n-- > 0){
+     36f:	8d 70 ff             	lea    -0x1(%eax),%esi
+     372:	85 c0                	test   %eax,%eax
+     374:	74 32                	je     3a8 <memcmp+0x50>
+    if(*s1 != *s2)
+     376:	0f b6 02             	movzbl (%edx),%eax
+     379:	0f b6 19             	movzbl (%ecx),%ebx
+     37c:	38 d8                	cmp    %bl,%al
+     37e:	75 20                	jne    3a0 <memcmp+0x48>
+      return *s1 - *s2;
+    s1++, s2++;
+     380:	83 c2 01             	add    $0x1,%edx
+     383:	83 c1 01             	add    $0x1,%ecx
+  while(n-- > 0){
+     386:	89 f0                	mov    %esi,%eax
+     388:	eb e5                	jmp    36f <memcmp+0x17>
+      s1 += 4, s2 += 4;
+     38a:	83 c2 04             	add    $0x4,%edx
+     38d:	83 c1 04             	add    $0x4,%ecx
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+     390:	83 e8 04             	sub    $0x4,%eax
+     393:	83 f8 03             	cmp    $0x3,%eax
+     396:	76 d7                	jbe    36f <memcmp+0x17>
+     398:	8b 31                	mov    (%ecx),%esi
+     39a:	39 32                	cmp    %esi,(%edx)
+     39c:	74 ec                	je     38a <memcmp+0x32>
+     39e:	eb cf                	jmp    36f <memcmp+0x17>
+      return *s1 - *s2;
+     3a0:	0f b6 c0             	movzbl %al,%eax
+     3a3:	0f b6 db             	movzbl %bl,%ebx
+     3a6:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     3a8:	5b                   	pop    %ebx
+     3a9:	5e                   	pop    %esi
+     3aa:	5d                   	pop    %ebp
+     3ab:	c3                   	ret
+
+000003ac <memchr>:
+// The first c in the n bytes at v, or 0.  Once aligned, a word at
+// a time, with the word's bytes that equal c turned into zeroes
+// and those looked for.
+void*
+memchr(const void *v, int c, uint n)
+{
+     3ac:	55                   	push   %ebp
+     3ad:	89 e5                	mov    %esp,%ebp
+     3af:	57                   	push   %edi
+     3b0:	56                   	push   %esi
+     3b1:	53                   	push   %ebx
+     3b2:	8b 45 08             	mov    0x8(%ebp),%eax
+     3b5:	8b 55 10             	mov    0x10(%ebp),%edx
+  const uchar *s;
+  uint w, rep;
+
+  s = v;
+  c = (uchar)c;
+     3b8:	0f b6 75 0c          	movzbl 0xc(%ebp),%esi
+  for(; n > 0 && ((uint)s & 3); n--, s++)
+     3bc:	eb 06                	jmp    3c4 <memchr+0x18>
+     3be:	83 ea 01             	sub    $0x1,%edx
+     3c1:	83 c0 01             	add    $0x1,%eax
+     3c4:	85 d2                	test   %edx,%edx
+     3c6:	74 0d                	je     3d5 <memchr+0x29>
+     3c8:	a8 03                	test   $0x3,%al
+     3ca:	74 09                	je     3d5 <memchr+0x29>
+    if(*s == c)
+     3cc:	0f b6 08             	movzbl (%eax),%ecx
+     3cf:	39 f1                	cmp    %esi,%ecx
+     3d1:	75 eb                	jne    3be <memchr+0x12>
+     3d3:	eb 41                	jmp    416 <memchr+0x6a>
+      return (void*)s;
+  rep = c * 0x01010101;
+     3d5:	69 fe 01 01 01 01    	imul   $0x1010101,%esi,%edi
+  for(; n >= 4; n -= 4, s += 4){
+     3db:	eb 06                	jmp    3e3 <memchr+0x37>
+     3dd:	83 ea 04             	sub    $0x4,%edx
+     3e0:	83 c0 04             	add    $0x4,%eax
+     3e3:	83 fa 03             	cmp    $0x3,%edx
+     3e6:	76 16                	jbe    3fe <memchr+0x52>
+    w = *(uint*)s ^ rep;
+     3e8:	89 f9                	mov    %edi,%ecx
+     3ea:	33 08                	xor    (%eax),%ecx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     3ec:	8d 99 ff fe fe fe    	lea    -0x1010101(%ecx),%ebx
+     3f2:	f7 d1                	not    %ecx
+     3f4:	21 cb                	and    %ecx,%ebx
+     3f6:	f7 c3 80 80 80 80    	test   $0x80808080,%ebx
+     3fc:	74 df                	je     3dd <memchr+0x31>
+      break;
+  }
+  for(; n > 0; n--, s++)
+     3fe:	85 d2                	test   %edx,%edx
+     400:	74 0f                	je     411 <memchr+0x65>
+    if(*s == c)
+     402:	0f b6 08             	movzbl (%eax),%ecx
+     405:	39 f1                	cmp    %esi,%ecx
+     407:	74 0d                	je     416 <memchr+0x6a>
+  for(; n > 0; n--, s++)
+     409:	83 ea 01             	sub    $0x1,%edx
+     40c:	83 c0 01             	add    $0x1,%eax
+     40f:	eb ed                	jmp    3fe <memchr+0x52>
+      return (void*)s;
+  return 0;
+     411:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     416:	5b                   	pop    %ebx
+     417:	5e                   	pop    %esi
+     418:	5f                   	pop    %edi
+     419:	5d                   	pop    %ebp
+     41a:	c3                   	ret
+
+0000041b <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     41b:	55                   	push   %ebp
+     41c:	89 e5                	mov    %esp,%ebp
+     41e:	57                   	push   %edi
+     41f:	56                   	push   %esi
+     420:	53                   	push   %ebx
+     421:	83 ec 1c             	sub    $0x1c,%esp
+     424:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     427:	bb 00 00 00 00       	mov    $0x0,%ebx
+     42c:	89 de                	mov    %ebx,%esi
+     42e:	83 c3 01             	add    $0x1,%ebx
+     431:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     434:	7d 2e                	jge    464 <gets+0x49>
+    cc = read(0, &c, 1);
+     436:	83 ec 04             	sub    $0x4,%esp
+     439:	6a 01                	push   $0x1
+     43b:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     43e:	50                   	push   %eax
+     43f:	6a 00                	push   $0x0
+     441:	e8 51 05 00 00       	call   997 <read>
+    if(cc < 1)
+     446:	83 c4 10             	add    $0x10,%esp
+     449:	85 c0                	test   %eax,%eax
+     44b:	7e 17                	jle    464 <gets+0x49>
+      break;
+    buf[i++] = c;
+     44d:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     451:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+     454:	3c 0a                	cmp    $0xa,%al
+     456:	0f 94 c2             	sete   %dl
+     459:	3c 0d                	cmp    $0xd,%al
+     45b:	0f 94 c0             	sete   %al
+     45e:	08 c2                	or     %al,%dl
+     460:	74 ca                	je     42c <gets+0x11>
+    buf[i++] = c;
+     462:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+     464:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+     468:	89 f8                	mov    %edi,%eax
+     46a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     46d:	5b                   	pop    %ebx
+     46e:	5e                   	pop    %esi
+     46f:	5f                   	pop    %edi
+     470:	5d                   	pop    %ebp
+     471:	c3                   	ret
+
+00000472 <atoi>:
+  return r;
+}
+
+int
+atoi(const char *s)
+{
+     472:	55                   	push   %ebp
+     473:	89 e5                	mov    %esp,%ebp
+     475:	53                   	push   %ebx
+     476:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+     479:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+     47e:	eb 10                	jmp    490 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+     480:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+     483:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+     486:	83 c1 01             	add    $0x1,%ecx
+     489:	0f be c0             	movsbl %al,%eax
+     48c:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+     490:	0f b6 01             	movzbl (%ecx),%eax
+     493:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     496:	80 fb 09             	cmp    $0x9,%bl
+     499:	76 e5                	jbe    480 <atoi+0xe>
+  return n;
+}
+     49b:	89 d0                	mov    %edx,%eax
+     49d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4a0:	c9                   	leave
+     4a1:	c3                   	ret
+
+000004a2 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     4a2:	55                   	push   %ebp
+     4a3:	89 e5                	mov    %esp,%ebp
+     4a5:	57                   	push   %edi
+     4a6:	56                   	push   %esi
+     4a7:	53                   	push   %ebx
+     4a8:	83 ec 08             	sub    $0x8,%esp
+     4ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     4ae:	8b 55 0c             	mov    0xc(%ebp),%edx
+     4b1:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *src;
+  int h;
+
+  dst = vdst;
+  src = vsrc;
+  if(n <= 0)
+     4b4:	85 c0                	test   %eax,%eax
+     4b6:	0f 8e 82 00 00 00    	jle    53e <memmove+0x9c>
+    return vdst;
+  if(src < dst && src + n > dst){
+     4bc:	39 da                	cmp    %ebx,%edx
+     4be:	73 07                	jae    4c7 <memmove+0x25>
+     4c0:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+     4c3:	39 cb                	cmp    %ecx,%ebx
+     4c5:	72 5e                	jb     525 <memmove+0x83>
+    movsbback(dst + n - 1, src + n - 1, n);
+    return vdst;
+  }
+  if(n >= 16 && (((uint)dst ^ (uint)src) & 3) == 0){
+     4c7:	83 f8 0f             	cmp    $0xf,%eax
+     4ca:	7e 69                	jle    535 <memmove+0x93>
+     4cc:	89 d9                	mov    %ebx,%ecx
+     4ce:	31 d1                	xor    %edx,%ecx
+     4d0:	f6 c1 03             	test   $0x3,%cl
+     4d3:	75 73                	jne    548 <memmove+0xa6>
+    h = -(uint)dst & 3;
+     4d5:	89 d9                	mov    %ebx,%ecx
+     4d7:	f7 d9                	neg    %ecx
+     4d9:	83 e1 03             	and    $0x3,%ecx
+}
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsb" :
+     4dc:	89 df                	mov    %ebx,%edi
+     4de:	89 d6                	mov    %edx,%esi
+     4e0:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+     4e3:	fc                   	cld
+     4e4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    movsb(dst, src, h);
+    dst += h, src += h, n -= h;
+     4e6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+     4e9:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+     4ec:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+     4ef:	29 f0                	sub    %esi,%eax
+    movsl(dst, src, n/4);
+     4f1:	8d 50 03             	lea    0x3(%eax),%edx
+     4f4:	0f 49 d0             	cmovns %eax,%edx
+     4f7:	c1 fa 02             	sar    $0x2,%edx
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+     4fa:	89 7d f0             	mov    %edi,-0x10(%ebp)
+     4fd:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     500:	89 ce                	mov    %ecx,%esi
+     502:	89 d1                	mov    %edx,%ecx
+     504:	fc                   	cld
+     505:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    dst += n/4*4, src += n/4*4, n %= 4;
+     507:	c1 e2 02             	shl    $0x2,%edx
+     50a:	8b 7d f0             	mov    -0x10(%ebp),%edi
+     50d:	01 d7                	add    %edx,%edi
+     50f:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     512:	01 ca                	add    %ecx,%edx
+     514:	89 c6                	mov    %eax,%esi
+     516:	c1 fe 1f             	sar    $0x1f,%esi
+     519:	c1 ee 1e             	shr    $0x1e,%esi
+     51c:	01 f0                	add    %esi,%eax
+     51e:	83 e0 03             	and    $0x3,%eax
+     521:	29 f0                	sub    %esi,%eax
+     523:	eb 12                	jmp    537 <memmove+0x95>
+    movsbback(dst + n - 1, src + n - 1, n);
+     525:	8d 78 ff             	lea    -0x1(%eax),%edi
+     528:	8d 34 3a             	lea    (%edx,%edi,1),%esi
+     52b:	01 df                	add    %ebx,%edi
+// Copy cnt bytes down from the last ones, at dst and src, to the
+// first: for overlapping moves up.
+static inline void
+movsbback(void *dst, const void *src, int cnt)
+{
+  asm volatile("std; rep movsb; cld" :
+     52d:	89 c1                	mov    %eax,%ecx
+     52f:	fd                   	std
+     530:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     532:	fc                   	cld
+    return vdst;
+     533:	eb 09                	jmp    53e <memmove+0x9c>
+  dst = vdst;
+     535:	89 df                	mov    %ebx,%edi
+  asm volatile("cld; rep movsb" :
+     537:	89 d6                	mov    %edx,%esi
+     539:	89 c1                	mov    %eax,%ecx
+     53b:	fc                   	cld
+     53c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  }
+  movsb(dst, src, n);
+  return vdst;
+}
+     53e:	89 d8                	mov    %ebx,%eax
+     540:	83 c4 08             	add    $0x8,%esp
+     543:	5b                   	pop    %ebx
+     544:	5e                   	pop    %esi
+     545:	5f                   	pop    %edi
+     546:	5d                   	pop    %ebp
+     547:	c3                   	ret
+  dst = vdst;
+     548:	89 df                	mov    %ebx,%edi
+     54a:	eb eb                	jmp    537 <memmove+0x95>
+
+0000054c <vclock_gettime>:
+
+// clock_gettime() without a system call: read the clock page
+// that the kernel maps at CLOCKPAGE (see clock.h).
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+     54c:	55                   	push   %ebp
+     54d:	89 e5                	mov    %esp,%ebp
+     54f:	57                   	push   %edi
+     550:	56                   	push   %esi
+     551:	53                   	push   %ebx
+     552:	83 ec 14             	sub    $0x14,%esp
+  struct clockpage *cp = (struct clockpage*)CLOCKPAGE;
+  uint seq, rem, d;
+  uint64 tsc, ns, now;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+     555:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     559:	0f 87 a3 00 00 00    	ja     602 <vclock_gettime+0xb6>
+    return -1;
+  do {
+    seq = cp->seq;
+     55f:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+    __sync_synchronize();
+     564:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    tsc = cp->tsc;
+     569:	8b 15 10 f0 ff 7f    	mov    0x7ffff010,%edx
+     56f:	8b 1d 14 f0 ff 7f    	mov    0x7ffff014,%ebx
+    ns = cp->ns;
+     575:	8b 35 18 f0 ff 7f    	mov    0x7ffff018,%esi
+     57b:	8b 3d 1c f0 ff 7f    	mov    0x7ffff01c,%edi
+    __sync_synchronize();
+     581:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != cp->seq);
+     586:	89 c1                	mov    %eax,%ecx
+     588:	83 e1 01             	and    $0x1,%ecx
+     58b:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     58e:	75 cf                	jne    55f <vclock_gettime+0x13>
+     590:	8b 0d 00 f0 ff 7f    	mov    0x7ffff000,%ecx
+     596:	39 c1                	cmp    %eax,%ecx
+     598:	75 c5                	jne    55f <vclock_gettime+0x13>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+     59a:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     59d:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     5a0:	0f 31                	rdtsc
+     5a2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     5a5:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     5a8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  now = rdtsc();
+  // Less than a tick has passed since the update, so the delta
+  // fits in 32 bits.
+  d = now > tsc ? now - tsc : 0;
+     5ab:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     5ae:	19 d3                	sbb    %edx,%ebx
+     5b0:	73 07                	jae    5b9 <vclock_gettime+0x6d>
+     5b2:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+     5b5:	29 d8                	sub    %ebx,%eax
+     5b7:	89 c1                	mov    %eax,%ecx
+  ns += ((uint64)d * cp->mult) >> cp->shift;
+     5b9:	89 c8                	mov    %ecx,%eax
+     5bb:	f7 25 04 f0 ff 7f    	mull   0x7ffff004
+     5c1:	0f b6 0d 08 f0 ff 7f 	movzbl 0x7ffff008,%ecx
+     5c8:	0f ad d0             	shrd   %cl,%edx,%eax
+     5cb:	d3 ea                	shr    %cl,%edx
+     5cd:	f6 c1 20             	test   $0x20,%cl
+     5d0:	74 04                	je     5d6 <vclock_gettime+0x8a>
+     5d2:	89 d0                	mov    %edx,%eax
+     5d4:	31 d2                	xor    %edx,%edx
+     5d6:	01 f0                	add    %esi,%eax
+     5d8:	11 fa                	adc    %edi,%edx
+static inline uint
+divl(uint64 n, uint d, uint *r)
+{
+  uint q;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (*r) :
+     5da:	bb 00 ca 9a 3b       	mov    $0x3b9aca00,%ebx
+     5df:	f7 f3                	div    %ebx
+  ts->tv_sec = divl(ns, 1000000000, &rem);
+     5e1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     5e4:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = rem;
+     5e6:	89 57 04             	mov    %edx,0x4(%edi)
+  if(clk == CLOCK_REALTIME)
+     5e9:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     5ed:	75 1a                	jne    609 <vclock_gettime+0xbd>
+    ts->tv_sec += cp->boottime;
+     5ef:	03 05 0c f0 ff 7f    	add    0x7ffff00c,%eax
+     5f5:	89 07                	mov    %eax,(%edi)
+  return 0;
+     5f7:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     5fa:	83 c4 14             	add    $0x14,%esp
+     5fd:	5b                   	pop    %ebx
+     5fe:	5e                   	pop    %esi
+     5ff:	5f                   	pop    %edi
+     600:	5d                   	pop    %ebp
+     601:	c3                   	ret
+    return -1;
+     602:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     607:	eb f1                	jmp    5fa <vclock_gettime+0xae>
+  return 0;
+     609:	b8 00 00 00 00       	mov    $0x0,%eax
+     60e:	eb ea                	jmp    5fa <vclock_gettime+0xae>
+
+00000610 <flush>:
+
+// Write out fd's buffer, or with fd < 0 every buffer.
+// Returns -1 if a write fails.
+int
+flush(int fd)
+{
+     610:	55                   	push   %ebp
+     611:	89 e5                	mov    %esp,%ebp
+     613:	56                   	push   %esi
+     614:	53                   	push   %ebx
+     615:	8b 45 08             	mov    0x8(%ebp),%eax
+  int r, n;
+
+  if(fd < 0){
+     618:	85 c0                	test   %eax,%eax
+     61a:	78 5d                	js     679 <flush+0x69>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+      if(flush(fd) < 0)
+        r = -1;
+    return r;
+  }
+  if(fd >= NOBUF || (n = obuf[fd].n) == 0)
+     61c:	83 f8 0f             	cmp    $0xf,%eax
+     61f:	7f 64                	jg     685 <flush+0x75>
+     621:	69 d0 08 02 00 00    	imul   $0x208,%eax,%edx
+     627:	8b b2 a4 27 00 00    	mov    0x27a4(%edx),%esi
+     62d:	85 f6                	test   %esi,%esi
+     62f:	74 59                	je     68a <flush+0x7a>
+    return 0;
+  obuf[fd].n = 0;
+     631:	c7 82 a4 27 00 00 00 	movl   $0x0,0x27a4(%edx)
+     638:	00 00 00 
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     63b:	81 c2 a8 27 00 00    	add    $0x27a8,%edx
+     641:	83 ec 04             	sub    $0x4,%esp
+     644:	56                   	push   %esi
+     645:	52                   	push   %edx
+     646:	50                   	push   %eax
+     647:	e8 5a 03 00 00       	call   9a6 <write>
+     64c:	83 c4 10             	add    $0x10,%esp
+     64f:	39 f0                	cmp    %esi,%eax
+     651:	75 40                	jne    693 <flush+0x83>
+     653:	be 00 00 00 00       	mov    $0x0,%esi
+     658:	eb 30                	jmp    68a <flush+0x7a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     65a:	83 c3 01             	add    $0x1,%ebx
+     65d:	83 fb 0f             	cmp    $0xf,%ebx
+     660:	7f 28                	jg     68a <flush+0x7a>
+      if(flush(fd) < 0)
+     662:	83 ec 0c             	sub    $0xc,%esp
+     665:	53                   	push   %ebx
+     666:	e8 a5 ff ff ff       	call   610 <flush>
+     66b:	83 c4 10             	add    $0x10,%esp
+     66e:	85 c0                	test   %eax,%eax
+     670:	79 e8                	jns    65a <flush+0x4a>
+        r = -1;
+     672:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     677:	eb e1                	jmp    65a <flush+0x4a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     679:	be 00 00 00 00       	mov    $0x0,%esi
+     67e:	bb 00 00 00 00       	mov    $0x0,%ebx
+     683:	eb d8                	jmp    65d <flush+0x4d>
+    return 0;
+     685:	be 00 00 00 00       	mov    $0x0,%esi
+}
+     68a:	89 f0                	mov    %esi,%eax
+     68c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     68f:	5b                   	pop    %ebx
+     690:	5e                   	pop    %esi
+     691:	5d                   	pop    %ebp
+     692:	c3                   	ret
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     693:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     698:	eb f0                	jmp    68a <flush+0x7a>
+
+0000069a <bufreset>:
+
+static void
+bufreset(int fd)
+{
+  if(fd >= 0 && fd < NOBUF){
+     69a:	83 f8 0f             	cmp    $0xf,%eax
+     69d:	76 01                	jbe    6a0 <bufreset+0x6>
+     69f:	c3                   	ret
+{
+     6a0:	55                   	push   %ebp
+     6a1:	89 e5                	mov    %esp,%ebp
+     6a3:	53                   	push   %ebx
+     6a4:	83 ec 10             	sub    $0x10,%esp
+     6a7:	89 c3                	mov    %eax,%ebx
+    flush(fd);
+     6a9:	50                   	push   %eax
+     6aa:	e8 61 ff ff ff       	call   610 <flush>
+    obuf[fd].mode = BUNKNOWN;
+     6af:	69 db 08 02 00 00    	imul   $0x208,%ebx,%ebx
+     6b5:	c7 83 a0 27 00 00 00 	movl   $0x0,0x27a0(%ebx)
+     6bc:	00 00 00 
+     6bf:	83 c4 10             	add    $0x10,%esp
+  }
+}
+     6c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6c5:	c9                   	leave
+     6c6:	c3                   	ret
+
+000006c7 <bufwrite>:
+
+// Write n bytes from p to fd, through its buffer.
+// Returns n, or -1 if a write fails.
+int
+bufwrite(int fd, const void *p, int n)
+{
+     6c7:	55                   	push   %ebp
+     6c8:	89 e5                	mov    %esp,%ebp
+     6ca:	57                   	push   %edi
+     6cb:	56                   	push   %esi
+     6cc:	53                   	push   %ebx
+     6cd:	83 ec 3c             	sub    $0x3c,%esp
+     6d0:	8b 75 08             	mov    0x8(%ebp),%esi
+     6d3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct stat st;
+  const char *s;
+  int i;
+
+  if(fd < 0 || fd >= NOBUF)
+     6d6:	83 fe 0f             	cmp    $0xf,%esi
+     6d9:	0f 87 a2 00 00 00    	ja     781 <bufwrite+0xba>
+    return write(fd, p, n);
+  if(obuf[fd].mode == BUNKNOWN){
+     6df:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     6e5:	83 b8 a0 27 00 00 00 	cmpl   $0x0,0x27a0(%eax)
+     6ec:	75 19                	jne    707 <bufwrite+0x40>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     6ee:	83 fe 02             	cmp    $0x2,%esi
+     6f1:	0f 85 9c 00 00 00    	jne    793 <bufwrite+0xcc>
+      obuf[fd].mode = BNONE;
+     6f7:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     6fd:	c7 80 a0 27 00 00 01 	movl   $0x1,0x27a0(%eax)
+     704:	00 00 00 
+    else
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+  }
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     707:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     70d:	89 da                	mov    %ebx,%edx
+     70f:	03 90 a4 27 00 00    	add    0x27a4(%eax),%edx
+     715:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+     71b:	0f 8f ae 00 00 00    	jg     7cf <bufwrite+0x108>
+    return -1;
+  if(n >= OBUFSZ)
+     721:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+     727:	0f 8f bd 00 00 00    	jg     7ea <bufwrite+0x123>
+    return write(fd, p, n);
+  memmove(obuf[fd].buf + obuf[fd].n, p, n);
+     72d:	69 d6 08 02 00 00    	imul   $0x208,%esi,%edx
+     733:	8d ba a0 27 00 00    	lea    0x27a0(%edx),%edi
+     739:	8b 82 a4 27 00 00    	mov    0x27a4(%edx),%eax
+     73f:	83 ec 04             	sub    $0x4,%esp
+     742:	53                   	push   %ebx
+     743:	ff 75 0c             	push   0xc(%ebp)
+     746:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     749:	8d 84 10 a8 27 00 00 	lea    0x27a8(%eax,%edx,1),%eax
+     750:	50                   	push   %eax
+     751:	e8 4c fd ff ff       	call   4a2 <memmove>
+  obuf[fd].n += n;
+     756:	01 5f 04             	add    %ebx,0x4(%edi)
+  if(obuf[fd].mode == BNONE)
+     759:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     75c:	8b 82 a0 27 00 00    	mov    0x27a0(%edx),%eax
+     762:	83 c4 10             	add    $0x10,%esp
+     765:	83 f8 01             	cmp    $0x1,%eax
+     768:	0f 84 91 00 00 00    	je     7ff <bufwrite+0x138>
+    return flush(fd) < 0 ? -1 : n;
+  if(obuf[fd].mode == BLINE)
+     76e:	83 f8 02             	cmp    $0x2,%eax
+     771:	0f 84 ca 00 00 00    	je     841 <bufwrite+0x17a>
+    for(s = p, i = 0; i < n; i++)
+      if(s[i] == '\n')
+        return flush(fd) < 0 ? -1 : n;
+  return n;
+     777:	89 d8                	mov    %ebx,%eax
+}
+     779:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     77c:	5b                   	pop    %ebx
+     77d:	5e                   	pop    %esi
+     77e:	5f                   	pop    %edi
+     77f:	5d                   	pop    %ebp
+     780:	c3                   	ret
+    return write(fd, p, n);
+     781:	83 ec 04             	sub    $0x4,%esp
+     784:	53                   	push   %ebx
+     785:	ff 75 0c             	push   0xc(%ebp)
+     788:	56                   	push   %esi
+     789:	e8 18 02 00 00       	call   9a6 <write>
+     78e:	83 c4 10             	add    $0x10,%esp
+     791:	eb e6                	jmp    779 <bufwrite+0xb2>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     793:	83 ec 08             	sub    $0x8,%esp
+     796:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     799:	50                   	push   %eax
+     79a:	56                   	push   %esi
+     79b:	e8 51 02 00 00       	call   9f1 <fstat>
+     7a0:	83 c4 10             	add    $0x10,%esp
+     7a3:	85 c0                	test   %eax,%eax
+     7a5:	0f 88 4c ff ff ff    	js     6f7 <bufwrite+0x30>
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+     7ab:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     7b0:	74 16                	je     7c8 <bufwrite+0x101>
+     7b2:	ba 03 00 00 00       	mov    $0x3,%edx
+     7b7:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     7bd:	89 90 a0 27 00 00    	mov    %edx,0x27a0(%eax)
+     7c3:	e9 3f ff ff ff       	jmp    707 <bufwrite+0x40>
+     7c8:	ba 02 00 00 00       	mov    $0x2,%edx
+     7cd:	eb e8                	jmp    7b7 <bufwrite+0xf0>
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     7cf:	83 ec 0c             	sub    $0xc,%esp
+     7d2:	56                   	push   %esi
+     7d3:	e8 38 fe ff ff       	call   610 <flush>
+     7d8:	83 c4 10             	add    $0x10,%esp
+     7db:	85 c0                	test   %eax,%eax
+     7dd:	0f 89 3e ff ff ff    	jns    721 <bufwrite+0x5a>
+    return -1;
+     7e3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     7e8:	eb 8f                	jmp    779 <bufwrite+0xb2>
+    return write(fd, p, n);
+     7ea:	83 ec 04             	sub    $0x4,%esp
+     7ed:	53                   	push   %ebx
+     7ee:	ff 75 0c             	push   0xc(%ebp)
+     7f1:	56                   	push   %esi
+     7f2:	e8 af 01 00 00       	call   9a6 <write>
+     7f7:	83 c4 10             	add    $0x10,%esp
+     7fa:	e9 7a ff ff ff       	jmp    779 <bufwrite+0xb2>
+    return flush(fd) < 0 ? -1 : n;
+     7ff:	83 ec 0c             	sub    $0xc,%esp
+     802:	56                   	push   %esi
+     803:	e8 08 fe ff ff       	call   610 <flush>
+     808:	83 c4 10             	add    $0x10,%esp
+     80b:	85 c0                	test   %eax,%eax
+     80d:	78 07                	js     816 <bufwrite+0x14f>
+     80f:	89 d8                	mov    %ebx,%eax
+     811:	e9 63 ff ff ff       	jmp    779 <bufwrite+0xb2>
+     816:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     81b:	e9 59 ff ff ff       	jmp    779 <bufwrite+0xb2>
+        return flush(fd) < 0 ? -1 : n;
+     820:	83 ec 0c             	sub    $0xc,%esp
+     823:	56                   	push   %esi
+     824:	e8 e7 fd ff ff       	call   610 <flush>
+     829:	83 c4 10             	add    $0x10,%esp
+     82c:	85 c0                	test   %eax,%eax
+     82e:	78 07                	js     837 <bufwrite+0x170>
+     830:	89 d8                	mov    %ebx,%eax
+     832:	e9 42 ff ff ff       	jmp    779 <bufwrite+0xb2>
+     837:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     83c:	e9 38 ff ff ff       	jmp    779 <bufwrite+0xb2>
+    for(s = p, i = 0; i < n; i++)
+     841:	b8 00 00 00 00       	mov    $0x0,%eax
+     846:	39 d8                	cmp    %ebx,%eax
+     848:	7d 0e                	jge    858 <bufwrite+0x191>
+      if(s[i] == '\n')
+     84a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     84d:	80 3c 01 0a          	cmpb   $0xa,(%ecx,%eax,1)
+     851:	74 cd                	je     820 <bufwrite+0x159>
+    for(s = p, i = 0; i < n; i++)
+     853:	83 c0 01             	add    $0x1,%eax
+     856:	eb ee                	jmp    846 <bufwrite+0x17f>
+  return n;
+     858:	89 d8                	mov    %ebx,%eax
+     85a:	e9 1a ff ff ff       	jmp    779 <bufwrite+0xb2>
+
+0000085f <fork>:
+
+int
+fork(void)
+{
+     85f:	55                   	push   %ebp
+     860:	89 e5                	mov    %esp,%ebp
+     862:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     865:	6a ff                	push   $0xffffffff
+     867:	e8 a4 fd ff ff       	call   610 <flush>
+  return _fork();
+     86c:	e8 bd 00 00 00       	call   92e <_fork>
+}
+     871:	c9                   	leave
+     872:	c3                   	ret
+
+00000873 <exit>:
+
+int
+exit(void)
+{
+     873:	55                   	push   %ebp
+     874:	89 e5                	mov    %esp,%ebp
+     876:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     879:	6a ff                	push   $0xffffffff
+     87b:	e8 90 fd ff ff       	call   610 <flush>
+  _exit();
+     880:	e8 b8 00 00 00       	call   93d <_exit>
+
+00000885 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     885:	55                   	push   %ebp
+     886:	89 e5                	mov    %esp,%ebp
+     888:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     88b:	6a ff                	push   $0xffffffff
+     88d:	e8 7e fd ff ff       	call   610 <flush>
+  return _exec(path, argv);
+     892:	83 c4 08             	add    $0x8,%esp
+     895:	ff 75 0c             	push   0xc(%ebp)
+     898:	ff 75 08             	push   0x8(%ebp)
+     89b:	e8 bb 00 00 00       	call   95b <_exec>
+}
+     8a0:	c9                   	leave
+     8a1:	c3                   	ret
+
+000008a2 <close>:
+
+int
+close(int fd)
+{
+     8a2:	55                   	push   %ebp
+     8a3:	89 e5                	mov    %esp,%ebp
+     8a5:	53                   	push   %ebx
+     8a6:	83 ec 04             	sub    $0x4,%esp
+     8a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bufreset(fd);
+     8ac:	89 d8                	mov    %ebx,%eax
+     8ae:	e8 e7 fd ff ff       	call   69a <bufreset>
+  return _close(fd);
+     8b3:	83 ec 0c             	sub    $0xc,%esp
+     8b6:	53                   	push   %ebx
+     8b7:	e8 90 00 00 00       	call   94c <_close>
+}
+     8bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     8bf:	c9                   	leave
+     8c0:	c3                   	ret
+
+000008c1 <stat>:
+{
+     8c1:	55                   	push   %ebp
+     8c2:	89 e5                	mov    %esp,%ebp
+     8c4:	56                   	push   %esi
+     8c5:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     8c6:	83 ec 08             	sub    $0x8,%esp
+     8c9:	6a 00                	push   $0x0
+     8cb:	ff 75 08             	push   0x8(%ebp)
+     8ce:	e8 f1 00 00 00       	call   9c4 <open>
+  if(fd < 0)
+     8d3:	83 c4 10             	add    $0x10,%esp
+     8d6:	85 c0                	test   %eax,%eax
+     8d8:	78 24                	js     8fe <stat+0x3d>
+     8da:	89 c3                	mov    %eax,%ebx
+  r = fstat(fd, st);
+     8dc:	83 ec 08             	sub    $0x8,%esp
+     8df:	ff 75 0c             	push   0xc(%ebp)
+     8e2:	50                   	push   %eax
+     8e3:	e8 09 01 00 00       	call   9f1 <fstat>
+     8e8:	89 c6                	mov    %eax,%esi
+  close(fd);
+     8ea:	89 1c 24             	mov    %ebx,(%esp)
+     8ed:	e8 b0 ff ff ff       	call   8a2 <close>
+  return r;
+     8f2:	83 c4 10             	add    $0x10,%esp
+}
+     8f5:	89 f0                	mov    %esi,%eax
+     8f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     8fa:	5b                   	pop    %ebx
+     8fb:	5e                   	pop    %esi
+     8fc:	5d                   	pop    %ebp
+     8fd:	c3                   	ret
+    return -1;
+     8fe:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     903:	eb f0                	jmp    8f5 <stat+0x34>
+
+00000905 <dup2>:
+
+int
+dup2(int oldfd, int newfd)
+{
+     905:	55                   	push   %ebp
+     906:	89 e5                	mov    %esp,%ebp
+     908:	56                   	push   %esi
+     909:	53                   	push   %ebx
+     90a:	8b 75 08             	mov    0x8(%ebp),%esi
+     90d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(oldfd != newfd)
+     910:	39 de                	cmp    %ebx,%esi
+     912:	75 11                	jne    925 <dup2+0x20>
+    bufreset(newfd);
+  return _dup2(oldfd, newfd);
+     914:	83 ec 08             	sub    $0x8,%esp
+     917:	53                   	push   %ebx
+     918:	56                   	push   %esi
+     919:	e8 4c 00 00 00       	call   96a <_dup2>
+}
+     91e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     921:	5b                   	pop    %ebx
+     922:	5e                   	pop    %esi
+     923:	5d                   	pop    %ebp
+     924:	c3                   	ret
+    bufreset(newfd);
+     925:	89 d8                	mov    %ebx,%eax
+     927:	e8 6e fd ff ff       	call   69a <bufreset>
+     92c:	eb e6                	jmp    914 <dup2+0xf>
+
+0000092e <_fork>:
+  1: ret
+
+#define SYSCALL(name) STUB(name, SYS_ ## name)
+
+# ulib.c wraps these, to flush printf()'s buffers first.
+STUB(_fork, SYS_fork)
+     92e:	b8 01 00 00 00       	mov    $0x1,%eax
+     933:	89 e1                	mov    %esp,%ecx
+     935:	ba 3c 09 00 00       	mov    $0x93c,%edx
+     93a:	0f 34                	sysenter
+     93c:	c3                   	ret
+
+0000093d <_exit>:
+STUB(_exit, SYS_exit)
+     93d:	b8 02 00 00 00       	mov    $0x2,%eax
+     942:	89 e1                	mov    %esp,%ecx
+     944:	ba 4b 09 00 00       	mov    $0x94b,%edx
+     949:	0f 34                	sysenter
+     94b:	c3                   	ret
+
+0000094c <_close>:
+STUB(_close, SYS_close)
+     94c:	b8 15 00 00 00       	mov    $0x15,%eax
+     951:	89 e1                	mov    %esp,%ecx
+     953:	ba 5a 09 00 00       	mov    $0x95a,%edx
+     958:	0f 34                	sysenter
+     95a:	c3                   	ret
+
+0000095b <_exec>:
+STUB(_exec, SYS_exec)
+     95b:	b8 07 00 00 00       	mov    $0x7,%eax
+     960:	89 e1                	mov    %esp,%ecx
+     962:	ba 69 09 00 00       	mov    $0x969,%edx
+     967:	0f 34                	sysenter
+     969:	c3                   	ret
+
+0000096a <_dup2>:
+STUB(_dup2, SYS_dup2)
+     96a:	b8 17 00 00 00       	mov    $0x17,%eax
+     96f:	89 e1                	mov    %esp,%ecx
+     971:	ba 78 09 00 00       	mov    $0x978,%edx
+     976:	0f 34                	sysenter
+     978:	c3                   	ret
+
+00000979 <wait>:
+
+SYSCALL(wait)
+     979:	b8 03 00 00 00       	mov    $0x3,%eax
+     97e:	89 e1                	mov    %esp,%ecx
+     980:	ba 87 09 00 00       	mov    $0x987,%edx
+     985:	0f 34                	sysenter
+     987:	c3                   	ret
+
+00000988 <pipe>:
+SYSCALL(pipe)
+     988:	b8 04 00 00 00       	mov    $0x4,%eax
+     98d:	89 e1                	mov    %esp,%ecx
+     98f:	ba 96 09 00 00       	mov    $0x996,%edx
+     994:	0f 34                	sysenter
+     996:	c3                   	ret
+
+00000997 <read>:
+SYSCALL(read)
+     997:	b8 05 00 00 00       	mov    $0x5,%eax
+     99c:	89 e1                	mov    %esp,%ecx
+     99e:	ba a5 09 00 00       	mov    $0x9a5,%edx
+     9a3:	0f 34                	sysenter
+     9a5:	c3                   	ret
+
+000009a6 <write>:
+SYSCALL(write)
+     9a6:	b8 10 00 00 00       	mov    $0x10,%eax
+     9ab:	89 e1                	mov    %esp,%ecx
+     9ad:	ba b4 09 00 00       	mov    $0x9b4,%edx
+     9b2:	0f 34                	sysenter
+     9b4:	c3                   	ret
+
+000009b5 <kill>:
+SYSCALL(kill)
+     9b5:	b8 06 00 00 00       	mov    $0x6,%eax
+     9ba:	89 e1                	mov    %esp,%ecx
+     9bc:	ba c3 09 00 00       	mov    $0x9c3,%edx
+     9c1:	0f 34                	sysenter
+     9c3:	c3                   	ret
+
+000009c4 <open>:
+SYSCALL(open)
+     9c4:	b8 0f 00 00 00       	mov    $0xf,%eax
+     9c9:	89 e1                	mov    %esp,%ecx
+     9cb:	ba d2 09 00 00       	mov    $0x9d2,%edx
+     9d0:	0f 34                	sysenter
+     9d2:	c3                   	ret
+
+000009d3 <mknod>:
+SYSCALL(mknod)
+     9d3:	b8 11 00 00 00       	mov    $0x11,%eax
+     9d8:	89 e1                	mov    %esp,%ecx
+     9da:	ba e1 09 00 00       	mov    $0x9e1,%edx
+     9df:	0f 34                	sysenter
+     9e1:	c3                   	ret
+
+000009e2 <unlink>:
+SYSCALL(unlink)
+     9e2:	b8 12 00 00 00       	mov    $0x12,%eax
+     9e7:	89 e1                	mov    %esp,%ecx
+     9e9:	ba f0 09 00 00       	mov    $0x9f0,%edx
+     9ee:	0f 34                	sysenter
+     9f0:	c3                   	ret
+
+000009f1 <fstat>:
+SYSCALL(fstat)
+     9f1:	b8 08 00 00 00       	mov    $0x8,%eax
+     9f6:	89 e1                	mov    %esp,%ecx
+     9f8:	ba ff 09 00 00       	mov    $0x9ff,%edx
+     9fd:	0f 34                	sysenter
+     9ff:	c3                   	ret
+
+00000a00 <link>:
+SYSCALL(link)
+     a00:	b8 13 00 00 00       	mov    $0x13,%eax
+     a05:	89 e1                	mov    %esp,%ecx
+     a07:	ba 0e 0a 00 00       	mov    $0xa0e,%edx
+     a0c:	0f 34                	sysenter
+     a0e:	c3                   	ret
+
+00000a0f <mkdir>:
+SYSCALL(mkdir)
+     a0f:	b8 14 00 00 00       	mov    $0x14,%eax
+     a14:	89 e1                	mov    %esp,%ecx
+     a16:	ba 1d 0a 00 00       	mov    $0xa1d,%edx
+     a1b:	0f 34                	sysenter
+     a1d:	c3                   	ret
+
+00000a1e <chdir>:
+SYSCALL(chdir)
+     a1e:	b8 09 00 00 00       	mov    $0x9,%eax
+     a23:	89 e1                	mov    %esp,%ecx
+     a25:	ba 2c 0a 00 00       	mov    $0xa2c,%edx
+     a2a:	0f 34                	sysenter
+     a2c:	c3                   	ret
+
+00000a2d <dup>:
+SYSCALL(dup)
+     a2d:	b8 0a 00 00 00       	mov    $0xa,%eax
+     a32:	89 e1                	mov    %esp,%ecx
+     a34:	ba 3b 0a 00 00       	mov    $0xa3b,%edx
+     a39:	0f 34                	sysenter
+     a3b:	c3                   	ret
+
+00000a3c <getpid>:
+SYSCALL(getpid)
+     a3c:	b8 0b 00 00 00       	mov    $0xb,%eax
+     a41:	89 e1                	mov    %esp,%ecx
+     a43:	ba 4a 0a 00 00       	mov    $0xa4a,%edx
+     a48:	0f 34                	sysenter
+     a4a:	c3                   	ret
+
+00000a4b <sbrk>:
+SYSCALL(sbrk)
+     a4b:	b8 0c 00 00 00       	mov    $0xc,%eax
+     a50:	89 e1                	mov    %esp,%ecx
+     a52:	ba 59 0a 00 00       	mov    $0xa59,%edx
+     a57:	0f 34                	sysenter
+     a59:	c3                   	ret
+
+00000a5a <sleep>:
+SYSCALL(sleep)
+     a5a:	b8 0d 00 00 00       	mov    $0xd,%eax
+     a5f:	89 e1                	mov    %esp,%ecx
+     a61:	ba 68 0a 00 00       	mov    $0xa68,%edx
+     a66:	0f 34                	sysenter
+     a68:	c3                   	ret
+
+00000a69 <uptime>:
+SYSCALL(uptime)
+     a69:	b8 0e 00 00 00       	mov    $0xe,%eax
+     a6e:	89 e1                	mov    %esp,%ecx
+     a70:	ba 77 0a 00 00       	mov    $0xa77,%edx
+     a75:	0f 34                	sysenter
+     a77:	c3                   	ret
+
+00000a78 <date>:
+SYSCALL(date)
+     a78:	b8 16 00 00 00       	mov    $0x16,%eax
+     a7d:	89 e1                	mov    %esp,%ecx
+     a7f:	ba 86 0a 00 00       	mov    $0xa86,%edx
+     a84:	0f 34                	sysenter
+     a86:	c3                   	ret
+
+00000a87 <faultaround>:
+SYSCALL(faultaround)
+     a87:	b8 18 00 00 00       	mov    $0x18,%eax
+     a8c:	89 e1                	mov    %esp,%ecx
+     a8e:	ba 95 0a 00 00       	mov    $0xa95,%edx
+     a93:	0f 34                	sysenter
+     a95:	c3                   	ret
+
+00000a96 <faultstat>:
+SYSCALL(faultstat)
+     a96:	b8 19 00 00 00       	mov    $0x19,%eax
+     a9b:	89 e1                	mov    %esp,%ecx
+     a9d:	ba a4 0a 00 00       	mov    $0xaa4,%edx
+     aa2:	0f 34                	sysenter
+     aa4:	c3                   	ret
+
+00000aa5 <mmap>:
+SYSCALL(mmap)
+     aa5:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     aaa:	89 e1                	mov    %esp,%ecx
+     aac:	ba b3 0a 00 00       	mov    $0xab3,%edx
+     ab1:	0f 34                	sysenter
+     ab3:	c3                   	ret
+
+00000ab4 <munmap>:
+SYSCALL(munmap)
+     ab4:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     ab9:	89 e1                	mov    %esp,%ecx
+     abb:	ba c2 0a 00 00       	mov    $0xac2,%edx
+     ac0:	0f 34                	sysenter
+     ac2:	c3                   	ret
+
+00000ac3 <largepages>:
+SYSCALL(largepages)
+     ac3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     ac8:	89 e1                	mov    %esp,%ecx
+     aca:	ba d1 0a 00 00       	mov    $0xad1,%edx
+     acf:	0f 34                	sysenter
+     ad1:	c3                   	ret
+
+00000ad2 <spawn>:
+SYSCALL(spawn)
+     ad2:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     ad7:	89 e1                	mov    %esp,%ecx
+     ad9:	ba e0 0a 00 00       	mov    $0xae0,%edx
+     ade:	0f 34                	sysenter
+     ae0:	c3                   	ret
+
+00000ae1 <setpriority>:
+SYSCALL(setpriority)
+     ae1:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     ae6:	89 e1                	mov    %esp,%ecx
+     ae8:	ba ef 0a 00 00       	mov    $0xaef,%edx
+     aed:	0f 34                	sysenter
+     aef:	c3                   	ret
+
+00000af0 <getpriority>:
+SYSCALL(getpriority)
+     af0:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     af5:	89 e1                	mov    %esp,%ecx
+     af7:	ba fe 0a 00 00       	mov    $0xafe,%edx
+     afc:	0f 34                	sysenter
+     afe:	c3                   	ret
+
+00000aff <getprocinfo>:
+SYSCALL(getprocinfo)
+     aff:	b8 20 00 00 00       	mov    $0x20,%eax
+     b04:	89 e1                	mov    %esp,%ecx
+     b06:	ba 0d 0b 00 00       	mov    $0xb0d,%edx
+     b0b:	0f 34                	sysenter
+     b0d:	c3                   	ret
+
+00000b0e <getcpuinfo>:
+SYSCALL(getcpuinfo)
+     b0e:	b8 21 00 00 00       	mov    $0x21,%eax
+     b13:	89 e1                	mov    %esp,%ecx
+     b15:	ba 1c 0b 00 00       	mov    $0xb1c,%edx
+     b1a:	0f 34                	sysenter
+     b1c:	c3                   	ret
+
+00000b1d <clone>:
+SYSCALL(clone)
+     b1d:	b8 22 00 00 00       	mov    $0x22,%eax
+     b22:	89 e1                	mov    %esp,%ecx
+     b24:	ba 2b 0b 00 00       	mov    $0xb2b,%edx
+     b29:	0f 34                	sysenter
+     b2b:	c3                   	ret
+
+00000b2c <join>:
+SYSCALL(join)
+     b2c:	b8 23 00 00 00       	mov    $0x23,%eax
+     b31:	89 e1                	mov    %esp,%ecx
+     b33:	ba 3a 0b 00 00       	mov    $0xb3a,%edx
+     b38:	0f 34                	sysenter
+     b3a:	c3                   	ret
+
+00000b3b <futex_wait>:
+SYSCALL(futex_wait)
+     b3b:	b8 24 00 00 00       	mov    $0x24,%eax
+     b40:	89 e1                	mov    %esp,%ecx
+     b42:	ba 49 0b 00 00       	mov    $0xb49,%edx
+     b47:	0f 34                	sysenter
+     b49:	c3                   	ret
+
+00000b4a <futex_wake>:
+SYSCALL(futex_wake)
+     b4a:	b8 25 00 00 00       	mov    $0x25,%eax
+     b4f:	89 e1                	mov    %esp,%ecx
+     b51:	ba 58 0b 00 00       	mov    $0xb58,%edx
+     b56:	0f 34                	sysenter
+     b58:	c3                   	ret
+
+00000b59 <setaffinity>:
+SYSCALL(setaffinity)
+     b59:	b8 26 00 00 00       	mov    $0x26,%eax
+     b5e:	89 e1                	mov    %esp,%ecx
+     b60:	ba 67 0b 00 00       	mov    $0xb67,%edx
+     b65:	0f 34                	sysenter
+     b67:	c3                   	ret
+
+00000b68 <getaffinity>:
+SYSCALL(getaffinity)
+     b68:	b8 27 00 00 00       	mov    $0x27,%eax
+     b6d:	89 e1                	mov    %esp,%ecx
+     b6f:	ba 76 0b 00 00       	mov    $0xb76,%edx
+     b74:	0f 34                	sysenter
+     b76:	c3                   	ret
+
+00000b77 <clock_gettime>:
+SYSCALL(clock_gettime)
+     b77:	b8 28 00 00 00       	mov    $0x28,%eax
+     b7c:	89 e1                	mov    %esp,%ecx
+     b7e:	ba 85 0b 00 00       	mov    $0xb85,%edx
+     b83:	0f 34                	sysenter
+     b85:	c3                   	ret
+
+00000b86 <msleep>:
+SYSCALL(msleep)
+     b86:	b8 29 00 00 00       	mov    $0x29,%eax
+     b8b:	89 e1                	mov    %esp,%ecx
+     b8d:	ba 94 0b 00 00       	mov    $0xb94,%edx
+     b92:	0f 34                	sysenter
+     b94:	c3                   	ret
+
+00000b95 <lockstat>:
+SYSCALL(lockstat)
+     b95:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     b9a:	89 e1                	mov    %esp,%ecx
+     b9c:	ba a3 0b 00 00       	mov    $0xba3,%edx
+     ba1:	0f 34                	sysenter
+     ba3:	c3                   	ret
+
+00000ba4 <bstat>:
+SYSCALL(bstat)
+     ba4:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     ba9:	89 e1                	mov    %esp,%ecx
+     bab:	ba b2 0b 00 00       	mov    $0xbb2,%edx
+     bb0:	0f 34                	sysenter
+     bb2:	c3                   	ret
+
+00000bb3 <iostat>:
+SYSCALL(iostat)
+     bb3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     bb8:	89 e1                	mov    %esp,%ecx
+     bba:	ba c1 0b 00 00       	mov    $0xbc1,%edx
+     bbf:	0f 34                	sysenter
+     bc1:	c3                   	ret
+
+00000bc2 <fsync>:
+SYSCALL(fsync)
+     bc2:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     bc7:	89 e1                	mov    %esp,%ecx
+     bc9:	ba d0 0b 00 00       	mov    $0xbd0,%edx
+     bce:	0f 34                	sysenter
+     bd0:	c3                   	ret
+
+00000bd1 <pread>:
+SYSCALL(pread)
+     bd1:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     bd6:	89 e1                	mov    %esp,%ecx
+     bd8:	ba df 0b 00 00       	mov    $0xbdf,%edx
+     bdd:	0f 34                	sysenter
+     bdf:	c3                   	ret
+
+00000be0 <pwrite>:
+SYSCALL(pwrite)
+     be0:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     be5:	89 e1                	mov    %esp,%ecx
+     be7:	ba ee 0b 00 00       	mov    $0xbee,%edx
+     bec:	0f 34                	sysenter
+     bee:	c3                   	ret
+
+00000bef <readv>:
+SYSCALL(readv)
+     bef:	b8 30 00 00 00       	mov    $0x30,%eax
+     bf4:	89 e1                	mov    %esp,%ecx
+     bf6:	ba fd 0b 00 00       	mov    $0xbfd,%edx
+     bfb:	0f 34                	sysenter
+     bfd:	c3                   	ret
+
+00000bfe <writev>:
+SYSCALL(writev)
+     bfe:	b8 31 00 00 00       	mov    $0x31,%eax
+     c03:	89 e1                	mov    %esp,%ecx
+     c05:	ba 0c 0c 00 00       	mov    $0xc0c,%edx
+     c0a:	0f 34                	sysenter
+     c0c:	c3                   	ret
+
+00000c0d <sendfile>:
+SYSCALL(sendfile)
+     c0d:	b8 32 00 00 00       	mov    $0x32,%eax
+     c12:	89 e1                	mov    %esp,%ecx
+     c14:	ba 1b 0c 00 00       	mov    $0xc1b,%edx
+     c19:	0f 34                	sysenter
+     c1b:	c3                   	ret
+
+00000c1c <fcntl>:
+SYSCALL(fcntl)
+     c1c:	b8 33 00 00 00       	mov    $0x33,%eax
+     c21:	89 e1                	mov    %esp,%ecx
+     c23:	ba 2a 0c 00 00       	mov    $0xc2a,%edx
+     c28:	0f 34                	sysenter
+     c2a:	c3                   	ret
+
+00000c2b <mount>:
+SYSCALL(mount)
+     c2b:	b8 34 00 00 00       	mov    $0x34,%eax
+     c30:	89 e1                	mov    %esp,%ecx
+     c32:	ba 39 0c 00 00       	mov    $0xc39,%edx
+     c37:	0f 34                	sysenter
+     c39:	c3                   	ret
+
+00000c3a <getdents>:
+SYSCALL(getdents)
+     c3a:	b8 35 00 00 00       	mov    $0x35,%eax
+     c3f:	89 e1                	mov    %esp,%ecx
+     c41:	ba 48 0c 00 00       	mov    $0xc48,%edx
+     c46:	0f 34                	sysenter
+     c48:	c3                   	ret
+
+00000c49 <fstatat>:
+SYSCALL(fstatat)
+     c49:	b8 36 00 00 00       	mov    $0x36,%eax
+     c4e:	89 e1                	mov    %esp,%ecx
+     c50:	ba 57 0c 00 00       	mov    $0xc57,%edx
+     c55:	0f 34                	sysenter
+     c57:	c3                   	ret
+
+00000c58 <sysstat>:
+SYSCALL(sysstat)
+     c58:	b8 37 00 00 00       	mov    $0x37,%eax
+     c5d:	89 e1                	mov    %esp,%ecx
+     c5f:	ba 66 0c 00 00       	mov    $0xc66,%edx
+     c64:	0f 34                	sysenter
+     c66:	c3                   	ret
+
+00000c67 <ringenter>:
+SYSCALL(ringenter)
+     c67:	b8 38 00 00 00       	mov    $0x38,%eax
+     c6c:	89 e1                	mov    %esp,%ecx
+     c6e:	ba 75 0c 00 00       	mov    $0xc75,%edx
+     c73:	0f 34                	sysenter
+     c75:	c3                   	ret
+
+00000c76 <trace>:
+SYSCALL(trace)
+     c76:	b8 39 00 00 00       	mov    $0x39,%eax
+     c7b:	89 e1                	mov    %esp,%ecx
+     c7d:	ba 84 0c 00 00       	mov    $0xc84,%edx
+     c82:	0f 34                	sysenter
+     c84:	c3                   	ret
+
+00000c85 <memstat>:
+SYSCALL(memstat)
+     c85:	b8 3a 00 00 00       	mov    $0x3a,%eax
+     c8a:	89 e1                	mov    %esp,%ecx
+     c8c:	ba 93 0c 00 00       	mov    $0xc93,%edx
+     c91:	0f 34                	sysenter
+     c93:	c3                   	ret
+
+00000c94 <shmget>:
+SYSCALL(shmget)
+     c94:	b8 3b 00 00 00       	mov    $0x3b,%eax
+     c99:	89 e1                	mov    %esp,%ecx
+     c9b:	ba a2 0c 00 00       	mov    $0xca2,%edx
+     ca0:	0f 34                	sysenter
+     ca2:	c3                   	ret
+
+00000ca3 <shmat>:
+SYSCALL(shmat)
+     ca3:	b8 3c 00 00 00       	mov    $0x3c,%eax
+     ca8:	89 e1                	mov    %esp,%ecx
+     caa:	ba b1 0c 00 00       	mov    $0xcb1,%edx
+     caf:	0f 34                	sysenter
+     cb1:	c3                   	ret
+
+00000cb2 <shmdt>:
+SYSCALL(shmdt)
+     cb2:	b8 3d 00 00 00       	mov    $0x3d,%eax
+     cb7:	89 e1                	mov    %esp,%ecx
+     cb9:	ba c0 0c 00 00       	mov    $0xcc0,%edx
+     cbe:	0f 34                	sysenter
+     cc0:	c3                   	ret
+
+00000cc1 <irqstat>:
+SYSCALL(irqstat)
+     cc1:	b8 3e 00 00 00       	mov    $0x3e,%eax
+     cc6:	89 e1                	mov    %esp,%ecx
+     cc8:	ba cf 0c 00 00       	mov    $0xccf,%edx
+     ccd:	0f 34                	sysenter
+     ccf:	c3                   	ret
+
+00000cd0 <irqroute>:
+SYSCALL(irqroute)
+     cd0:	b8 3f 00 00 00       	mov    $0x3f,%eax
+     cd5:	89 e1                	mov    %esp,%ecx
+     cd7:	ba de 0c 00 00       	mov    $0xcde,%edx
+     cdc:	0f 34                	sysenter
+     cde:	c3                   	ret
+
+00000cdf <putc>:
+  char buf[64];
+};
+
+static void
+putc(struct out *o, char c)
+{
+     cdf:	55                   	push   %ebp
+     ce0:	89 e5                	mov    %esp,%ebp
+     ce2:	56                   	push   %esi
+     ce3:	53                   	push   %ebx
+     ce4:	89 c3                	mov    %eax,%ebx
+     ce6:	89 d6                	mov    %edx,%esi
+  if(o->n == sizeof(o->buf)){
+     ce8:	8b 40 04             	mov    0x4(%eax),%eax
+     ceb:	83 f8 40             	cmp    $0x40,%eax
+     cee:	74 16                	je     d06 <putc+0x27>
+    bufwrite(o->fd, o->buf, o->n);
+    o->n = 0;
+  }
+  o->buf[o->n++] = c;
+     cf0:	8b 43 04             	mov    0x4(%ebx),%eax
+     cf3:	8d 50 01             	lea    0x1(%eax),%edx
+     cf6:	89 53 04             	mov    %edx,0x4(%ebx)
+     cf9:	89 f1                	mov    %esi,%ecx
+     cfb:	88 4c 03 08          	mov    %cl,0x8(%ebx,%eax,1)
+}
+     cff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d02:	5b                   	pop    %ebx
+     d03:	5e                   	pop    %esi
+     d04:	5d                   	pop    %ebp
+     d05:	c3                   	ret
+    bufwrite(o->fd, o->buf, o->n);
+     d06:	8d 53 08             	lea    0x8(%ebx),%edx
+     d09:	83 ec 04             	sub    $0x4,%esp
+     d0c:	50                   	push   %eax
+     d0d:	52                   	push   %edx
+     d0e:	ff 33                	push   (%ebx)
+     d10:	e8 b2 f9 ff ff       	call   6c7 <bufwrite>
+    o->n = 0;
+     d15:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     d1c:	83 c4 10             	add    $0x10,%esp
+     d1f:	eb cf                	jmp    cf0 <putc+0x11>
+
+00000d21 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     d21:	55                   	push   %ebp
+     d22:	89 e5                	mov    %esp,%ebp
+     d24:	57                   	push   %edi
+     d25:	56                   	push   %esi
+     d26:	53                   	push   %ebx
+     d27:	83 ec 2c             	sub    $0x2c,%esp
+     d2a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     d2d:	89 d0                	mov    %edx,%eax
+     d2f:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+     d31:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     d35:	0f 95 c1             	setne  %cl
+     d38:	c1 ea 1f             	shr    $0x1f,%edx
+     d3b:	84 d1                	test   %dl,%cl
+     d3d:	74 44                	je     d83 <printint+0x62>
+    neg = 1;
+    x = -xx;
+     d3f:	f7 d8                	neg    %eax
+     d41:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+     d43:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     d4a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+     d4f:	89 c8                	mov    %ecx,%eax
+     d51:	ba 00 00 00 00       	mov    $0x0,%edx
+     d56:	f7 f6                	div    %esi
+     d58:	89 df                	mov    %ebx,%edi
+     d5a:	83 c3 01             	add    $0x1,%ebx
+     d5d:	0f b6 92 90 14 00 00 	movzbl 0x1490(%edx),%edx
+     d64:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+     d68:	89 ca                	mov    %ecx,%edx
+     d6a:	89 c1                	mov    %eax,%ecx
+     d6c:	39 f2                	cmp    %esi,%edx
+     d6e:	73 df                	jae    d4f <printint+0x2e>
+  if(neg)
+     d70:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     d74:	74 31                	je     da7 <printint+0x86>
+    buf[i++] = '-';
+     d76:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+     d7b:	8d 5f 02             	lea    0x2(%edi),%ebx
+     d7e:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     d81:	eb 17                	jmp    d9a <printint+0x79>
+    x = xx;
+     d83:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+     d85:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     d8c:	eb bc                	jmp    d4a <printint+0x29>
+
+  while(--i >= 0)
+    putc(o, buf[i]);
+     d8e:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+     d93:	89 f0                	mov    %esi,%eax
+     d95:	e8 45 ff ff ff       	call   cdf <putc>
+  while(--i >= 0)
+     d9a:	83 eb 01             	sub    $0x1,%ebx
+     d9d:	79 ef                	jns    d8e <printint+0x6d>
+}
+     d9f:	83 c4 2c             	add    $0x2c,%esp
+     da2:	5b                   	pop    %ebx
+     da3:	5e                   	pop    %esi
+     da4:	5f                   	pop    %edi
+     da5:	5d                   	pop    %ebp
+     da6:	c3                   	ret
+     da7:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     daa:	eb ee                	jmp    d9a <printint+0x79>
+
+00000dac <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     dac:	55                   	push   %ebp
+     dad:	89 e5                	mov    %esp,%ebp
+     daf:	57                   	push   %edi
+     db0:	56                   	push   %esi
+     db1:	53                   	push   %ebx
+     db2:	83 ec 6c             	sub    $0x6c,%esp
+  int c, i, state;
+  uint *ap;
+  struct out out, *o;
+
+  o = &out;
+  o->fd = fd;
+     db5:	8b 45 08             	mov    0x8(%ebp),%eax
+     db8:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  o->n = 0;
+     dbb:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+     dc2:	8d 45 10             	lea    0x10(%ebp),%eax
+     dc5:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  state = 0;
+     dc8:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+     dcd:	bb 00 00 00 00       	mov    $0x0,%ebx
+     dd2:	eb 14                	jmp    de8 <printf+0x3c>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(o, c);
+     dd4:	89 fa                	mov    %edi,%edx
+     dd6:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     dd9:	e8 01 ff ff ff       	call   cdf <putc>
+     dde:	eb 05                	jmp    de5 <printf+0x39>
+      }
+    } else if(state == '%'){
+     de0:	83 fe 25             	cmp    $0x25,%esi
+     de3:	74 25                	je     e0a <printf+0x5e>
+  for(i = 0; fmt[i]; i++){
+     de5:	83 c3 01             	add    $0x1,%ebx
+     de8:	8b 45 0c             	mov    0xc(%ebp),%eax
+     deb:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+     def:	84 c0                	test   %al,%al
+     df1:	0f 84 20 01 00 00    	je     f17 <printf+0x16b>
+    c = fmt[i] & 0xff;
+     df7:	0f be f8             	movsbl %al,%edi
+     dfa:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     dfd:	85 f6                	test   %esi,%esi
+     dff:	75 df                	jne    de0 <printf+0x34>
+      if(c == '%'){
+     e01:	83 f8 25             	cmp    $0x25,%eax
+     e04:	75 ce                	jne    dd4 <printf+0x28>
+        state = '%';
+     e06:	89 c6                	mov    %eax,%esi
+     e08:	eb db                	jmp    de5 <printf+0x39>
+      if(c == 'd'){
+     e0a:	83 f8 25             	cmp    $0x25,%eax
+     e0d:	0f 84 cf 00 00 00    	je     ee2 <printf+0x136>
+     e13:	0f 8c dd 00 00 00    	jl     ef6 <printf+0x14a>
+     e19:	83 f8 78             	cmp    $0x78,%eax
+     e1c:	0f 8f d4 00 00 00    	jg     ef6 <printf+0x14a>
+     e22:	83 f8 63             	cmp    $0x63,%eax
+     e25:	0f 8c cb 00 00 00    	jl     ef6 <printf+0x14a>
+     e2b:	83 e8 63             	sub    $0x63,%eax
+     e2e:	83 f8 15             	cmp    $0x15,%eax
+     e31:	0f 87 bf 00 00 00    	ja     ef6 <printf+0x14a>
+     e37:	ff 24 85 38 14 00 00 	jmp    *0x1438(,%eax,4)
+        printint(o, *ap, 10, 1);
+     e3e:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     e41:	8b 17                	mov    (%edi),%edx
+     e43:	83 ec 0c             	sub    $0xc,%esp
+     e46:	6a 01                	push   $0x1
+     e48:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     e4d:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     e50:	e8 cc fe ff ff       	call   d21 <printint>
+        ap++;
+     e55:	83 c7 04             	add    $0x4,%edi
+     e58:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     e5b:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(o, '%');
+        putc(o, c);
+      }
+      state = 0;
+     e5e:	be 00 00 00 00       	mov    $0x0,%esi
+     e63:	eb 80                	jmp    de5 <printf+0x39>
+        printint(o, *ap, 16, 0);
+     e65:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     e68:	8b 17                	mov    (%edi),%edx
+     e6a:	83 ec 0c             	sub    $0xc,%esp
+     e6d:	6a 00                	push   $0x0
+     e6f:	b9 10 00 00 00       	mov    $0x10,%ecx
+     e74:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     e77:	e8 a5 fe ff ff       	call   d21 <printint>
+        ap++;
+     e7c:	83 c7 04             	add    $0x4,%edi
+     e7f:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     e82:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     e85:	be 00 00 00 00       	mov    $0x0,%esi
+     e8a:	e9 56 ff ff ff       	jmp    de5 <printf+0x39>
+        s = (char*)*ap;
+     e8f:	8b 45 94             	mov    -0x6c(%ebp),%eax
+     e92:	8b 30                	mov    (%eax),%esi
+        ap++;
+     e94:	83 c0 04             	add    $0x4,%eax
+     e97:	89 45 94             	mov    %eax,-0x6c(%ebp)
+        if(s == 0)
+     e9a:	85 f6                	test   %esi,%esi
+     e9c:	75 15                	jne    eb3 <printf+0x107>
+          s = "(null)";
+     e9e:	be 2f 14 00 00       	mov    $0x142f,%esi
+     ea3:	eb 0e                	jmp    eb3 <printf+0x107>
+          putc(o, *s);
+     ea5:	0f be d2             	movsbl %dl,%edx
+     ea8:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     eab:	e8 2f fe ff ff       	call   cdf <putc>
+          s++;
+     eb0:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+     eb3:	0f b6 16             	movzbl (%esi),%edx
+     eb6:	84 d2                	test   %dl,%dl
+     eb8:	75 eb                	jne    ea5 <printf+0xf9>
+      state = 0;
+     eba:	be 00 00 00 00       	mov    $0x0,%esi
+     ebf:	e9 21 ff ff ff       	jmp    de5 <printf+0x39>
+        putc(o, *ap);
+     ec4:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     ec7:	0f be 17             	movsbl (%edi),%edx
+     eca:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     ecd:	e8 0d fe ff ff       	call   cdf <putc>
+        ap++;
+     ed2:	83 c7 04             	add    $0x4,%edi
+     ed5:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+      state = 0;
+     ed8:	be 00 00 00 00       	mov    $0x0,%esi
+     edd:	e9 03 ff ff ff       	jmp    de5 <printf+0x39>
+        putc(o, c);
+     ee2:	89 fa                	mov    %edi,%edx
+     ee4:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     ee7:	e8 f3 fd ff ff       	call   cdf <putc>
+      state = 0;
+     eec:	be 00 00 00 00       	mov    $0x0,%esi
+     ef1:	e9 ef fe ff ff       	jmp    de5 <printf+0x39>
+        putc(o, '%');
+     ef6:	ba 25 00 00 00       	mov    $0x25,%edx
+     efb:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     efe:	e8 dc fd ff ff       	call   cdf <putc>
+        putc(o, c);
+     f03:	89 fa                	mov    %edi,%edx
+     f05:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     f08:	e8 d2 fd ff ff       	call   cdf <putc>
+      state = 0;
+     f0d:	be 00 00 00 00       	mov    $0x0,%esi
+     f12:	e9 ce fe ff ff       	jmp    de5 <printf+0x39>
+    }
+  }
+  if(o->n > 0)
+     f17:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     f1a:	85 c0                	test   %eax,%eax
+     f1c:	7f 08                	jg     f26 <printf+0x17a>
+    bufwrite(fd, o->buf, o->n);
+}
+     f1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f21:	5b                   	pop    %ebx
+     f22:	5e                   	pop    %esi
+     f23:	5f                   	pop    %edi
+     f24:	5d                   	pop    %ebp
+     f25:	c3                   	ret
+    bufwrite(fd, o->buf, o->n);
+     f26:	83 ec 04             	sub    $0x4,%esp
+     f29:	50                   	push   %eax
+     f2a:	8d 45 a8             	lea    -0x58(%ebp),%eax
+     f2d:	50                   	push   %eax
+     f2e:	ff 75 08             	push   0x8(%ebp)
+     f31:	e8 91 f7 ff ff       	call   6c7 <bufwrite>
+     f36:	83 c4 10             	add    $0x10,%esp
+}
+     f39:	eb e3                	jmp    f1e <printf+0x172>
+
+00000f3b <largefree>:
+  return &b->h;
+}
+
+static void
+largefree(Fblock *b)
+{
+     f3b:	55                   	push   %ebp
+     f3c:	89 e5                	mov    %esp,%ebp
+     f3e:	57                   	push   %edi
+     f3f:	56                   	push   %esi
+     f40:	53                   	push   %ebx
+     f41:	83 ec 0c             	sub    $0xc,%esp
+     f44:	89 c1                	mov    %eax,%ecx
+  Fblock **pp, *p, *prev;
+
+  prev = 0;
+     f46:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     f4b:	ba 2c 48 00 00       	mov    $0x482c,%edx
+     f50:	eb 05                	jmp    f57 <largefree+0x1c>
+     f52:	8d 50 08             	lea    0x8(%eax),%edx
+    prev = p;
+     f55:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     f57:	8b 02                	mov    (%edx),%eax
+     f59:	85 c0                	test   %eax,%eax
+     f5b:	74 04                	je     f61 <largefree+0x26>
+     f5d:	39 c8                	cmp    %ecx,%eax
+     f5f:	72 f1                	jb     f52 <largefree+0x17>
+  b->next = p;
+     f61:	89 41 08             	mov    %eax,0x8(%ecx)
+  if(p && (char*)b + b->h.size == (char*)p){
+     f64:	85 c0                	test   %eax,%eax
+     f66:	74 09                	je     f71 <largefree+0x36>
+     f68:	8b 31                	mov    (%ecx),%esi
+     f6a:	8d 3c 31             	lea    (%ecx,%esi,1),%edi
+     f6d:	39 c7                	cmp    %eax,%edi
+     f6f:	74 21                	je     f92 <largefree+0x57>
+    b->h.size += p->h.size;
+    b->next = p->next;
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+     f71:	85 db                	test   %ebx,%ebx
+     f73:	74 09                	je     f7e <largefree+0x43>
+     f75:	8b 03                	mov    (%ebx),%eax
+     f77:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+     f7a:	39 ce                	cmp    %ecx,%esi
+     f7c:	74 20                	je     f9e <largefree+0x63>
+    prev->h.size += b->h.size;
+    prev->next = b->next;
+  } else
+    *pp = b;
+     f7e:	89 0a                	mov    %ecx,(%edx)
+
+  // Give the top of the heap back.  With threads sharing the
+  // address space sbrk() cannot shrink it; keep the block then.
+  for(pp = &large; (*pp)->next; pp = &(*pp)->next)
+     f80:	be 2c 48 00 00       	mov    $0x482c,%esi
+     f85:	8b 1e                	mov    (%esi),%ebx
+     f87:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+     f8b:	74 1d                	je     faa <largefree+0x6f>
+     f8d:	8d 73 08             	lea    0x8(%ebx),%esi
+     f90:	eb f3                	jmp    f85 <largefree+0x4a>
+    b->h.size += p->h.size;
+     f92:	03 30                	add    (%eax),%esi
+     f94:	89 31                	mov    %esi,(%ecx)
+    b->next = p->next;
+     f96:	8b 40 08             	mov    0x8(%eax),%eax
+     f99:	89 41 08             	mov    %eax,0x8(%ecx)
+     f9c:	eb d3                	jmp    f71 <largefree+0x36>
+    prev->h.size += b->h.size;
+     f9e:	03 01                	add    (%ecx),%eax
+     fa0:	89 03                	mov    %eax,(%ebx)
+    prev->next = b->next;
+     fa2:	8b 41 08             	mov    0x8(%ecx),%eax
+     fa5:	89 43 08             	mov    %eax,0x8(%ebx)
+     fa8:	eb d6                	jmp    f80 <largefree+0x45>
+    ;
+  b = *pp;
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     faa:	89 df                	mov    %ebx,%edi
+     fac:	03 3b                	add    (%ebx),%edi
+     fae:	83 ec 0c             	sub    $0xc,%esp
+     fb1:	6a 00                	push   $0x0
+     fb3:	e8 93 fa ff ff       	call   a4b <sbrk>
+     fb8:	83 c4 10             	add    $0x10,%esp
+     fbb:	39 c7                	cmp    %eax,%edi
+     fbd:	74 08                	je     fc7 <largefree+0x8c>
+    *pp = 0;
+}
+     fbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     fc2:	5b                   	pop    %ebx
+     fc3:	5e                   	pop    %esi
+     fc4:	5f                   	pop    %edi
+     fc5:	5d                   	pop    %ebp
+     fc6:	c3                   	ret
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     fc7:	8b 03                	mov    (%ebx),%eax
+     fc9:	f7 d8                	neg    %eax
+     fcb:	83 ec 0c             	sub    $0xc,%esp
+     fce:	50                   	push   %eax
+     fcf:	e8 77 fa ff ff       	call   a4b <sbrk>
+     fd4:	83 c4 10             	add    $0x10,%esp
+     fd7:	83 f8 ff             	cmp    $0xffffffff,%eax
+     fda:	74 e3                	je     fbf <largefree+0x84>
+    *pp = 0;
+     fdc:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+     fe2:	eb db                	jmp    fbf <largefree+0x84>
+
+00000fe4 <more>:
+{
+     fe4:	55                   	push   %ebp
+     fe5:	89 e5                	mov    %esp,%ebp
+     fe7:	56                   	push   %esi
+     fe8:	53                   	push   %ebx
+     fe9:	89 c6                	mov    %eax,%esi
+  pad = -(uint)sbrk(0) & 7;
+     feb:	83 ec 0c             	sub    $0xc,%esp
+     fee:	6a 00                	push   $0x0
+     ff0:	e8 56 fa ff ff       	call   a4b <sbrk>
+     ff5:	f7 d8                	neg    %eax
+     ff7:	89 c3                	mov    %eax,%ebx
+     ff9:	83 e3 07             	and    $0x7,%ebx
+  if((p = sbrk(n + pad)) == (char*)-1)
+     ffc:	01 de                	add    %ebx,%esi
+     ffe:	89 34 24             	mov    %esi,(%esp)
+    1001:	e8 45 fa ff ff       	call   a4b <sbrk>
+    1006:	83 c4 10             	add    $0x10,%esp
+    1009:	83 f8 ff             	cmp    $0xffffffff,%eax
+    100c:	74 09                	je     1017 <more+0x33>
+  return p + pad;
+    100e:	01 d8                	add    %ebx,%eax
+}
+    1010:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1013:	5b                   	pop    %ebx
+    1014:	5e                   	pop    %esi
+    1015:	5d                   	pop    %ebp
+    1016:	c3                   	ret
+    return 0;
+    1017:	b8 00 00 00 00       	mov    $0x0,%eax
+    101c:	eb f2                	jmp    1010 <more+0x2c>
+
+0000101e <slaballoc>:
+{
+    101e:	55                   	push   %ebp
+    101f:	89 e5                	mov    %esp,%ebp
+    1021:	56                   	push   %esi
+    1022:	53                   	push   %ebx
+    1023:	89 c6                	mov    %eax,%esi
+  n = 1 << (MINSHIFT + c);
+    1025:	8d 48 04             	lea    0x4(%eax),%ecx
+    1028:	bb 01 00 00 00       	mov    $0x1,%ebx
+    102d:	d3 e3                	shl    %cl,%ebx
+  if(slab + n > slabend){
+    102f:	89 d8                	mov    %ebx,%eax
+    1031:	03 05 28 48 00 00    	add    0x4828,%eax
+    1037:	39 05 24 48 00 00    	cmp    %eax,0x4824
+    103d:	72 17                	jb     1056 <slaballoc+0x38>
+  h = (Header*)slab;
+    103f:	a1 28 48 00 00       	mov    0x4828,%eax
+  slab += n;
+    1044:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+    1047:	89 15 28 48 00 00    	mov    %edx,0x4828
+  h->size = n;
+    104d:	89 18                	mov    %ebx,(%eax)
+  h->class = c;
+    104f:	89 70 04             	mov    %esi,0x4(%eax)
+}
+    1052:	5b                   	pop    %ebx
+    1053:	5e                   	pop    %esi
+    1054:	5d                   	pop    %ebp
+    1055:	c3                   	ret
+    if((p = more(SLABSZ)) == 0)
+    1056:	b8 00 40 00 00       	mov    $0x4000,%eax
+    105b:	e8 84 ff ff ff       	call   fe4 <more>
+    1060:	85 c0                	test   %eax,%eax
+    1062:	74 ee                	je     1052 <slaballoc+0x34>
+    if(p != slabend)
+    1064:	39 05 24 48 00 00    	cmp    %eax,0x4824
+    106a:	74 05                	je     1071 <slaballoc+0x53>
+      slab = p;
+    106c:	a3 28 48 00 00       	mov    %eax,0x4828
+    slabend = p + SLABSZ;
+    1071:	05 00 40 00 00       	add    $0x4000,%eax
+    1076:	a3 24 48 00 00       	mov    %eax,0x4824
+    107b:	eb c2                	jmp    103f <slaballoc+0x21>
+
+0000107d <largealloc>:
+{
+    107d:	55                   	push   %ebp
+    107e:	89 e5                	mov    %esp,%ebp
+    1080:	56                   	push   %esi
+    1081:	53                   	push   %ebx
+    1082:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+    1084:	b9 2c 48 00 00       	mov    $0x482c,%ecx
+    1089:	8b 01                	mov    (%ecx),%eax
+    108b:	85 c0                	test   %eax,%eax
+    108d:	74 36                	je     10c5 <largealloc+0x48>
+    if(b->h.size < n)
+    108f:	8b 10                	mov    (%eax),%edx
+    1091:	39 da                	cmp    %ebx,%edx
+    1093:	72 24                	jb     10b9 <largealloc+0x3c>
+    if(b->h.size - n > SMALLMAX){
+    1095:	29 da                	sub    %ebx,%edx
+    1097:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+    109d:	76 1f                	jbe    10be <largealloc+0x41>
+      rest = (Fblock*)((char*)b + n);
+    109f:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+      rest->h.size = b->h.size - n;
+    10a2:	89 16                	mov    %edx,(%esi)
+      rest->h.class = LARGE;
+    10a4:	c7 46 04 09 00 00 00 	movl   $0x9,0x4(%esi)
+      rest->next = b->next;
+    10ab:	8b 50 08             	mov    0x8(%eax),%edx
+    10ae:	89 56 08             	mov    %edx,0x8(%esi)
+      *pp = rest;
+    10b1:	89 31                	mov    %esi,(%ecx)
+      b->h.size = n;
+    10b3:	89 18                	mov    %ebx,(%eax)
+}
+    10b5:	5b                   	pop    %ebx
+    10b6:	5e                   	pop    %esi
+    10b7:	5d                   	pop    %ebp
+    10b8:	c3                   	ret
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+    10b9:	8d 48 08             	lea    0x8(%eax),%ecx
+    10bc:	eb cb                	jmp    1089 <largealloc+0xc>
+      *pp = b->next;
+    10be:	8b 50 08             	mov    0x8(%eax),%edx
+    10c1:	89 11                	mov    %edx,(%ecx)
+    return &b->h;
+    10c3:	eb f0                	jmp    10b5 <largealloc+0x38>
+  if((b = more(n)) == 0)
+    10c5:	89 d8                	mov    %ebx,%eax
+    10c7:	e8 18 ff ff ff       	call   fe4 <more>
+    10cc:	85 c0                	test   %eax,%eax
+    10ce:	74 e5                	je     10b5 <largealloc+0x38>
+  b->h.size = n;
+    10d0:	89 18                	mov    %ebx,(%eax)
+  b->h.class = LARGE;
+    10d2:	c7 40 04 09 00 00 00 	movl   $0x9,0x4(%eax)
+  return &b->h;
+    10d9:	eb da                	jmp    10b5 <largealloc+0x38>
+
+000010db <free>:
+
+void
+free(void *ap)
+{
+    10db:	55                   	push   %ebp
+    10dc:	89 e5                	mov    %esp,%ebp
+    10de:	56                   	push   %esi
+    10df:	53                   	push   %ebx
+    10e0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+
+  if(ap == 0)
+    10e3:	85 db                	test   %ebx,%ebx
+    10e5:	74 3b                	je     1122 <free+0x47>
+    return;
+  h = (Header*)ap - 1;
+    10e7:	8d 73 f8             	lea    -0x8(%ebx),%esi
+  lock_acquire(&lock);
+    10ea:	83 ec 0c             	sub    $0xc,%esp
+    10ed:	68 20 48 00 00       	push   $0x4820
+    10f2:	e8 9c 01 00 00       	call   1293 <lock_acquire>
+  if(h->class == LARGE)
+    10f7:	8b 43 fc             	mov    -0x4(%ebx),%eax
+    10fa:	83 c4 10             	add    $0x10,%esp
+    10fd:	83 f8 09             	cmp    $0x9,%eax
+    1100:	74 27                	je     1129 <free+0x4e>
+    largefree((Fblock*)h);
+  else {
+    ((Fblock*)h)->next = freelist[h->class];
+    1102:	8b 14 85 40 48 00 00 	mov    0x4840(,%eax,4),%edx
+    1109:	89 13                	mov    %edx,(%ebx)
+    freelist[h->class] = (Fblock*)h;
+    110b:	89 34 85 40 48 00 00 	mov    %esi,0x4840(,%eax,4)
+  }
+  lock_release(&lock);
+    1112:	83 ec 0c             	sub    $0xc,%esp
+    1115:	68 20 48 00 00       	push   $0x4820
+    111a:	e8 88 01 00 00       	call   12a7 <lock_release>
+    111f:	83 c4 10             	add    $0x10,%esp
+}
+    1122:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1125:	5b                   	pop    %ebx
+    1126:	5e                   	pop    %esi
+    1127:	5d                   	pop    %ebp
+    1128:	c3                   	ret
+    largefree((Fblock*)h);
+    1129:	89 f0                	mov    %esi,%eax
+    112b:	e8 0b fe ff ff       	call   f3b <largefree>
+    1130:	eb e0                	jmp    1112 <free+0x37>
+
+00001132 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1132:	55                   	push   %ebp
+    1133:	89 e5                	mov    %esp,%ebp
+    1135:	53                   	push   %ebx
+    1136:	83 ec 04             	sub    $0x4,%esp
+    1139:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+  uint n;
+  int c;
+
+  if(nbytes > 0x7fffffff - sizeof(Header) - 7)
+    113c:	81 fb f0 ff ff 7f    	cmp    $0x7ffffff0,%ebx
+    1142:	0f 87 8b 00 00 00    	ja     11d3 <malloc+0xa1>
+    return 0;
+  n = (nbytes + sizeof(Header) + 7) & ~7;
+    1148:	83 c3 0f             	add    $0xf,%ebx
+    114b:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(n < sizeof(Fblock))
+    114e:	83 fb 0b             	cmp    $0xb,%ebx
+    1151:	77 05                	ja     1158 <malloc+0x26>
+    n = sizeof(Fblock);
+    1153:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  lock_acquire(&lock);
+    1158:	83 ec 0c             	sub    $0xc,%esp
+    115b:	68 20 48 00 00       	push   $0x4820
+    1160:	e8 2e 01 00 00       	call   1293 <lock_acquire>
+  if(n <= SMALLMAX){
+    1165:	83 c4 10             	add    $0x10,%esp
+    1168:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+    116e:	77 58                	ja     11c8 <malloc+0x96>
+    for(c = 0; (1 << (MINSHIFT + c)) < n; c++)
+    1170:	ba 00 00 00 00       	mov    $0x0,%edx
+    1175:	eb 03                	jmp    117a <malloc+0x48>
+    1177:	83 c2 01             	add    $0x1,%edx
+    117a:	8d 4a 04             	lea    0x4(%edx),%ecx
+    117d:	b8 01 00 00 00       	mov    $0x1,%eax
+    1182:	d3 e0                	shl    %cl,%eax
+    1184:	39 d8                	cmp    %ebx,%eax
+    1186:	72 ef                	jb     1177 <malloc+0x45>
+      ;
+    if(freelist[c]){
+    1188:	8b 04 95 40 48 00 00 	mov    0x4840(,%edx,4),%eax
+    118f:	85 c0                	test   %eax,%eax
+    1191:	74 2a                	je     11bd <malloc+0x8b>
+      h = &freelist[c]->h;
+    1193:	89 c3                	mov    %eax,%ebx
+      freelist[c] = freelist[c]->next;
+    1195:	8b 40 08             	mov    0x8(%eax),%eax
+    1198:	89 04 95 40 48 00 00 	mov    %eax,0x4840(,%edx,4)
+    } else
+      h = slaballoc(c);
+  } else
+    h = largealloc(n);
+  lock_release(&lock);
+    119f:	83 ec 0c             	sub    $0xc,%esp
+    11a2:	68 20 48 00 00       	push   $0x4820
+    11a7:	e8 fb 00 00 00       	call   12a7 <lock_release>
+  return h ? (void*)(h + 1) : 0;
+    11ac:	83 c4 10             	add    $0x10,%esp
+    11af:	85 db                	test   %ebx,%ebx
+    11b1:	74 03                	je     11b6 <malloc+0x84>
+    11b3:	83 c3 08             	add    $0x8,%ebx
+}
+    11b6:	89 d8                	mov    %ebx,%eax
+    11b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    11bb:	c9                   	leave
+    11bc:	c3                   	ret
+      h = slaballoc(c);
+    11bd:	89 d0                	mov    %edx,%eax
+    11bf:	e8 5a fe ff ff       	call   101e <slaballoc>
+    11c4:	89 c3                	mov    %eax,%ebx
+    11c6:	eb d7                	jmp    119f <malloc+0x6d>
+    h = largealloc(n);
+    11c8:	89 d8                	mov    %ebx,%eax
+    11ca:	e8 ae fe ff ff       	call   107d <largealloc>
+    11cf:	89 c3                	mov    %eax,%ebx
+    11d1:	eb cc                	jmp    119f <malloc+0x6d>
+    return 0;
+    11d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+    11d8:	eb dc                	jmp    11b6 <malloc+0x84>
+
+000011da <tstart>:
+  void *arg;
+};
+
+static void
+tstart(void *a)
+{
+    11da:	55                   	push   %ebp
+    11db:	89 e5                	mov    %esp,%ebp
+    11dd:	83 ec 14             	sub    $0x14,%esp
+    11e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+    11e3:	ff 70 04             	push   0x4(%eax)
+    11e6:	ff 10                	call   *(%eax)
+  exit();
+    11e8:	e8 86 f6 ff ff       	call   873 <exit>
+
+000011ed <thread_create>:
+}
+
+// Run fn(arg) in a new thread.  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    11ed:	55                   	push   %ebp
+    11ee:	89 e5                	mov    %esp,%ebp
+    11f0:	56                   	push   %esi
+    11f1:	53                   	push   %ebx
+  struct tstart *t;
+  char *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    11f2:	83 ec 0c             	sub    $0xc,%esp
+    11f5:	68 00 10 00 00       	push   $0x1000
+    11fa:	e8 33 ff ff ff       	call   1132 <malloc>
+    11ff:	83 c4 10             	add    $0x10,%esp
+    1202:	85 c0                	test   %eax,%eax
+    1204:	74 42                	je     1248 <thread_create+0x5b>
+    1206:	89 c3                	mov    %eax,%ebx
+    return -1;
+  t = (struct tstart*)stack;
+  t->fn = fn;
+    1208:	8b 45 08             	mov    0x8(%ebp),%eax
+    120b:	89 03                	mov    %eax,(%ebx)
+  t->arg = arg;
+    120d:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1210:	89 43 04             	mov    %eax,0x4(%ebx)
+  if((pid = clone(tstart, stack + TSTACK, t)) < 0)
+    1213:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    1219:	83 ec 04             	sub    $0x4,%esp
+    121c:	53                   	push   %ebx
+    121d:	50                   	push   %eax
+    121e:	68 da 11 00 00       	push   $0x11da
+    1223:	e8 f5 f8 ff ff       	call   b1d <clone>
+    1228:	89 c6                	mov    %eax,%esi
+    122a:	83 c4 10             	add    $0x10,%esp
+    122d:	85 c0                	test   %eax,%eax
+    122f:	78 09                	js     123a <thread_create+0x4d>
+    free(stack);
+  return pid;
+}
+    1231:	89 f0                	mov    %esi,%eax
+    1233:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1236:	5b                   	pop    %ebx
+    1237:	5e                   	pop    %esi
+    1238:	5d                   	pop    %ebp
+    1239:	c3                   	ret
+    free(stack);
+    123a:	83 ec 0c             	sub    $0xc,%esp
+    123d:	53                   	push   %ebx
+    123e:	e8 98 fe ff ff       	call   10db <free>
+    1243:	83 c4 10             	add    $0x10,%esp
+    1246:	eb e9                	jmp    1231 <thread_create+0x44>
+    return -1;
+    1248:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    124d:	eb e2                	jmp    1231 <thread_create+0x44>
+
+0000124f <thread_join>:
+
+// Wait for one of this process's threads to exit and free its
+// stack.  Returns its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+    124f:	55                   	push   %ebp
+    1250:	89 e5                	mov    %esp,%ebp
+    1252:	53                   	push   %ebx
+    1253:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    1256:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1259:	50                   	push   %eax
+    125a:	e8 cd f8 ff ff       	call   b2c <join>
+    125f:	89 c3                	mov    %eax,%ebx
+    1261:	83 c4 10             	add    $0x10,%esp
+    1264:	85 c0                	test   %eax,%eax
+    1266:	79 07                	jns    126f <thread_join+0x20>
+    free((char*)stack - TSTACK);
+  return pid;
+}
+    1268:	89 d8                	mov    %ebx,%eax
+    126a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    126d:	c9                   	leave
+    126e:	c3                   	ret
+    free((char*)stack - TSTACK);
+    126f:	83 ec 0c             	sub    $0xc,%esp
+    1272:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1275:	2d 00 10 00 00       	sub    $0x1000,%eax
+    127a:	50                   	push   %eax
+    127b:	e8 5b fe ff ff       	call   10db <free>
+    1280:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    1283:	eb e3                	jmp    1268 <thread_join+0x19>
+
+00001285 <lock_init>:
+
+void
+lock_init(lock_t *lk)
+{
+    1285:	55                   	push   %ebp
+    1286:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    1288:	8b 45 08             	mov    0x8(%ebp),%eax
+    128b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1291:	5d                   	pop    %ebp
+    1292:	c3                   	ret
+
+00001293 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+    1293:	55                   	push   %ebp
+    1294:	89 e5                	mov    %esp,%ebp
+    1296:	8b 55 08             	mov    0x8(%ebp),%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    1299:	b8 01 00 00 00       	mov    $0x1,%eax
+    129e:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    12a1:	85 c0                	test   %eax,%eax
+    12a3:	75 f4                	jne    1299 <lock_acquire+0x6>
+    ;
+}
+    12a5:	5d                   	pop    %ebp
+    12a6:	c3                   	ret
+
+000012a7 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+    12a7:	55                   	push   %ebp
+    12a8:	89 e5                	mov    %esp,%ebp
+    12aa:	8b 55 08             	mov    0x8(%ebp),%edx
+    12ad:	b8 00 00 00 00       	mov    $0x0,%eax
+    12b2:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    12b5:	5d                   	pop    %ebp
+    12b6:	c3                   	ret
+
+000012b7 <mutex_init>:
+// Are Tricky": state is 0 when free, 1 when held, 2 when held and
+// others may be waiting.  Unlocking an uncontended mutex costs no
+// system call.
+void
+mutex_init(mutex_t *m)
+{
+    12b7:	55                   	push   %ebp
+    12b8:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    12ba:	8b 45 08             	mov    0x8(%ebp),%eax
+    12bd:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    12c3:	5d                   	pop    %ebp
+    12c4:	c3                   	ret
+
+000012c5 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+    12c5:	55                   	push   %ebp
+    12c6:	89 e5                	mov    %esp,%ebp
+    12c8:	53                   	push   %ebx
+    12c9:	83 ec 04             	sub    $0x4,%esp
+    12cc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    12cf:	b8 00 00 00 00       	mov    $0x0,%eax
+    12d4:	b9 01 00 00 00       	mov    $0x1,%ecx
+    12d9:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    12dd:	85 c0                	test   %eax,%eax
+    12df:	74 29                	je     130a <mutex_lock+0x45>
+    return;
+  if(c != 2)
+    12e1:	83 f8 02             	cmp    $0x2,%eax
+    12e4:	74 20                	je     1306 <mutex_lock+0x41>
+    12e6:	b8 02 00 00 00       	mov    $0x2,%eax
+    12eb:	f0 87 03             	lock xchg %eax,(%ebx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    12ee:	eb 16                	jmp    1306 <mutex_lock+0x41>
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    12f0:	83 ec 08             	sub    $0x8,%esp
+    12f3:	6a 02                	push   $0x2
+    12f5:	53                   	push   %ebx
+    12f6:	e8 40 f8 ff ff       	call   b3b <futex_wait>
+  asm volatile("lock; xchgl %0, %1" :
+    12fb:	b8 02 00 00 00       	mov    $0x2,%eax
+    1300:	f0 87 03             	lock xchg %eax,(%ebx)
+    1303:	83 c4 10             	add    $0x10,%esp
+  while(c != 0){
+    1306:	85 c0                	test   %eax,%eax
+    1308:	75 e6                	jne    12f0 <mutex_lock+0x2b>
+    c = xchg(&m->state, 2);
+  }
+}
+    130a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    130d:	c9                   	leave
+    130e:	c3                   	ret
+
+0000130f <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+    130f:	55                   	push   %ebp
+    1310:	89 e5                	mov    %esp,%ebp
+    1312:	83 ec 08             	sub    $0x8,%esp
+    1315:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    1318:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    131d:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    1321:	83 fa 01             	cmp    $0x1,%edx
+    1324:	75 02                	jne    1328 <mutex_unlock+0x19>
+    m->state = 0;
+    futex_wake(&m->state, 1);
+  }
+}
+    1326:	c9                   	leave
+    1327:	c3                   	ret
+    m->state = 0;
+    1328:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+    132e:	83 ec 08             	sub    $0x8,%esp
+    1331:	6a 01                	push   $0x1
+    1333:	50                   	push   %eax
+    1334:	e8 11 f8 ff ff       	call   b4a <futex_wake>
+    1339:	83 c4 10             	add    $0x10,%esp
+}
+    133c:	eb e8                	jmp    1326 <mutex_unlock+0x17>
+
+0000133e <cond_init>:
+// Condition variable: waiters sleep on a sequence number that
+// every signal bumps, so a signal between the unlock and the
+// futex_wait() in cond_wait() is not lost.
+void
+cond_init(cond_t *c)
+{
+    133e:	55                   	push   %ebp
+    133f:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    1341:	8b 45 08             	mov    0x8(%ebp),%eax
+    1344:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    134a:	5d                   	pop    %ebp
+    134b:	c3                   	ret
+
+0000134c <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+    134c:	55                   	push   %ebp
+    134d:	89 e5                	mov    %esp,%ebp
+    134f:	57                   	push   %edi
+    1350:	56                   	push   %esi
+    1351:	53                   	push   %ebx
+    1352:	83 ec 18             	sub    $0x18,%esp
+    1355:	8b 75 08             	mov    0x8(%ebp),%esi
+    1358:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    135b:	8b 3e                	mov    (%esi),%edi
+  mutex_unlock(m);
+    135d:	53                   	push   %ebx
+    135e:	e8 ac ff ff ff       	call   130f <mutex_unlock>
+  futex_wait(&c->seq, seq);
+    1363:	83 c4 08             	add    $0x8,%esp
+    1366:	57                   	push   %edi
+    1367:	56                   	push   %esi
+    1368:	e8 ce f7 ff ff       	call   b3b <futex_wait>
+  // Others may be waiting for m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+    136d:	83 c4 10             	add    $0x10,%esp
+    1370:	eb 0e                	jmp    1380 <cond_wait+0x34>
+    futex_wait(&m->state, 2);
+    1372:	83 ec 08             	sub    $0x8,%esp
+    1375:	6a 02                	push   $0x2
+    1377:	53                   	push   %ebx
+    1378:	e8 be f7 ff ff       	call   b3b <futex_wait>
+    137d:	83 c4 10             	add    $0x10,%esp
+    1380:	b8 02 00 00 00       	mov    $0x2,%eax
+    1385:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    1388:	85 c0                	test   %eax,%eax
+    138a:	75 e6                	jne    1372 <cond_wait+0x26>
+}
+    138c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    138f:	5b                   	pop    %ebx
+    1390:	5e                   	pop    %esi
+    1391:	5f                   	pop    %edi
+    1392:	5d                   	pop    %ebp
+    1393:	c3                   	ret
+
+00001394 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+    1394:	55                   	push   %ebp
+    1395:	89 e5                	mov    %esp,%ebp
+    1397:	83 ec 10             	sub    $0x10,%esp
+    139a:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    139d:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+    13a1:	6a 01                	push   $0x1
+    13a3:	50                   	push   %eax
+    13a4:	e8 a1 f7 ff ff       	call   b4a <futex_wake>
+}
+    13a9:	83 c4 10             	add    $0x10,%esp
+    13ac:	c9                   	leave
+    13ad:	c3                   	ret
+
+000013ae <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+    13ae:	55                   	push   %ebp
+    13af:	89 e5                	mov    %esp,%ebp
+    13b1:	83 ec 10             	sub    $0x10,%esp
+    13b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    13b7:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, NPROC);
+    13bb:	6a 40                	push   $0x40
+    13bd:	50                   	push   %eax
+    13be:	e8 87 f7 ff ff       	call   b4a <futex_wake>
+}
+    13c3:	83 c4 10             	add    $0x10,%esp
+    13c6:	c9                   	leave
+    13c7:	c3                   	ret
@@ -0,0 +1,63 @@
+// lockstat: show the contention counters of the kernel's locks,
+// summed over the locks of each name (all the inode locks, say).
+// "lockstat -a" lists every lock on its own, "lockstat -r" zeroes
+// the counters.  Times are in thousands of TSC cycles.
+#include "types.h"
+#include "user.h"
+#include "lockstat.h"
+
+#define NNAME 64
+
+static struct lockstat sum[NNAME];
+static int nlock[NNAME];
+
+static void
+print(struct lockstat *ls, int n)
+{
+  printf(1, "%s\t%s\t%d\t%d\t%d\t%d\t%d\n", ls->name,
+         ls->sleep ? "sleep" : "spin", n, ls->nacq, ls->ncontend,
+         (uint)(ls->wait >> 10), (uint)(ls->maxhold >> 10));
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct lockstat ls;
+  int i, j, n, aflag;
+
+  if(argc > 1 && strcmp(argv[1], "-r") == 0){
+    if(lockstat(-1, 0) < 0){
+      printf(2, "lockstat: reset failed\n");
+      exit();
+    }
+    exit();
+  }
+  aflag = argc > 1 && strcmp(argv[1], "-a") == 0;
+
+  printf(1, "NAME\tTYPE\tLOCKS\tACQ\tCONT\tWAIT\tMAXHOLD\n");
+  n = 0;
+  for(i = 0; lockstat(i, &ls) == 0; i++){
+    if(aflag){
+      print(&ls, 1);
+      continue;
+    }
+    for(j = 0; j < n; j++)
+      if(sum[j].sleep == ls.sleep && strcmp(sum[j].name, ls.name) == 0)
+        break;
+    if(j == n){
+      if(n == NNAME)
+        continue;
+      memmove(&sum[n++], &ls, sizeof(ls));
+    } else {
+      sum[j].nacq += ls.nacq;
+      sum[j].ncontend += ls.ncontend;
+      sum[j].wait += ls.wait;
+      if(ls.maxhold > sum[j].maxhold)
+        sum[j].maxhold = ls.maxhold;
+    }
+    nlock[j]++;
+  }
+  for(j = 0; j < n; j++)
+    print(&sum[j], nlock[j]);
+  exit();
+}
@@ -0,0 +1,11 @@
+// One lock's contention counters, as returned by lockstat().
+// Times are in TSC cycles.
+
+struct lockstat {
+  char name[16];
+  int sleep;                   // 1 for a sleep lock
+  uint nacq;                   // Acquisitions
+  uint ncontend;               // Of those, ones that had to wait
+  uint64 wait;                 // Time spent waiting (spinning or asleep)
+  uint64 maxhold;              // Longest time held
+};
@@ -1,16 +1,18 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "trace.h"
 
 // Simple logging that allows concurrent FS system calls.
 //
 // A log transaction contains the updates of multiple FS system
-// calls. The logging system only commits when there are
-// no FS system calls active. Thus there is never
+// calls. The logging system only closes a transaction when there
+// are no FS system calls active in it. Thus there is never
 // any reasoning required about whether a commit might
 // write an uncommitted system call's updates to disk.
 //
@@ -18,18 +20,33 @@
 // its start and end. Usually begin_op() just increments
 // the count of in-progress FS system calls and returns.
 // But if it thinks the log is close to running out, it
-// sleeps until the last outstanding end_op() commits.
+// sleeps until the transaction has been closed.
+//
+// Commits are the job of a kernel thread, the log flusher, so
+// that no system call waits for one.  It gives a transaction
+// LOGWAIT for more system calls to join it (or less, if one finds
+// it full), waits for those to end, and closes it: it copies the
+// transaction's blocks out of the buffer cache and lets new system
+// calls begin a new transaction, in the cache, while it writes the
+// copies to the log and then to their home locations.  The next
+// close waits for that commit to finish, so there are at most
+// two transactions in memory and one in the log.
 //
 // The log is a physical re-do log containing disk blocks.
+// mkfs sizes it from FSSIZE; log.c uses as much of it as
+// LOGSIZE allows.
 // The on-disk log format:
-//   header block, containing block #s for block A, B, C, ...
+//   header blocks, containing the count and block #s for
+//     block A, B, C, ... (LOGHEAD(size) of them, see fs.h)
 //   block A
 //   block B
 //   block C
 //   ...
-// Log appends are synchronous.
+// Log appends are synchronous, in the flusher.
+
+#define LOGWAIT 2000000  // ns a transaction stays open for others
 
-// Contents of the header block, used for both the on-disk header block
+// Contents of the header blocks, used for both the on-disk header
 // and to keep track in memory of logged block# before commit.
 struct logheader {
   int n;
@@ -39,77 +56,128 @@ struct logheader {
 struct log {
   struct spinlock lock;
   int start;
-  int size;
+  int nhead;       // header blocks; the data blocks follow
+  int size;        // data blocks
   int outstanding; // how many FS sys calls are executing.
-  int committing;  // in commit(), please wait.
+  int reserved;    // blocks they may still log, between them.
+  int closing;     // the flusher wants the transaction, please wait.
+  uint nclosed;    // transactions closed,
+  uint ncommitted; //   and how many of them are on disk
   int dev;
-  struct logheader lh;
+  struct logheader lh;   // the open transaction
+  struct logheader clh;  // the one being committed,
+  struct buf *cp[LOGSIZE];  //   and copies of its blocks as they
+                            //   were at the close
 };
 struct log log;
 
 static void recover_from_log(void);
-static void commit();
+static void logflush(void);
+
+#define min(a, b) ((a) < (b) ? (a) : (b))
 
 void
 initlog(int dev)
 {
-  if (sizeof(struct logheader) >= BSIZE)
-    panic("initlog: too big logheader");
-
   struct superblock sb;
+  struct buf *b;
+  char *pg;
+  int i;
+
   initlock(&log.lock, "log");
   readsb(dev, &sb);
   log.start = sb.logstart;
-  log.size = sb.nlog;
+  log.size = min(sb.nlog - 1, LOGSIZE);
+  while (LOGHEAD(log.size) + log.size > sb.nlog)
+    log.size--;
+  log.nhead = LOGHEAD(log.size);
   log.dev = dev;
   recover_from_log();
+
+  // The copies, a page of them at a time.
+  b = 0;
+  pg = 0;
+  for (i = 0; i < log.size; i++, b++) {
+    if (b == 0 || (char*)(b + 1) > pg + PGSIZE) {
+      if ((pg = kalloc()) == 0)
+        panic("initlog: out of memory");
+      memset(pg, 0, PGSIZE);
+      b = (struct buf*)pg;
+    }
+    initsleeplock(&b->lock, "logcopy");
+    log.cp[i] = b;
+  }
+  kthread("logflush", logflush);
+}
+
+// The most blocks one system call may reserve with begin_opn():
+// half the log, so that a big write still shares its transaction.
+int
+log_opmax(void)
+{
+  return log.size / 2;
 }
 
 // Copy committed blocks from log to their home location
+// NCLUSTER blocks at a time, so that the disk can take
+// contiguous ones in one request.
 static void
 install_trans(void)
 {
-  int tail;
+  struct buf *dbuf[NCLUSTER];
+  int tail, i, n;
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
-    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
-    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
-    bwrite(dbuf);  // write dst to disk
-    brelse(lbuf);
-    brelse(dbuf);
+  for (tail = 0; tail < log.lh.n; tail += n) {
+    n = min(log.lh.n - tail, NCLUSTER);
+    for (i = 0; i < n; i++) {
+      struct buf *lbuf = bread(log.dev, log.start+log.nhead+tail+i); // read log block
+      dbuf[i] = bclaim(log.dev, log.lh.block[tail+i]); // dst, overwritten whole
+      memmove(dbuf[i]->data, lbuf->data, BSIZE);  // copy block to dst
+      brelse(lbuf);
+    }
+    bwritev(dbuf, n);  // write dst to disk
+    for (i = 0; i < n; i++)
+      brelse(dbuf[i]);
   }
 }
 
-// Read the log header from disk into the in-memory log header
+// Read the log header from disk into the in-memory log header.
+// The count is in the first header block, and says how many of
+// the others to read.
 static void
 read_head(void)
 {
-  struct buf *buf = bread(log.dev, log.start);
-  struct logheader *lh = (struct logheader *) (buf->data);
-  int i;
-  log.lh.n = lh->n;
-  for (i = 0; i < log.lh.n; i++) {
-    log.lh.block[i] = lh->block[i];
+  struct buf *buf;
+  int i, off;
+
+  for (i = 0; i == 0 || i < LOGHEAD(log.lh.n); i++) {
+    buf = bread(log.dev, log.start+i);
+    off = i*BSIZE;
+    memmove((char*)&log.lh + off, buf->data, min(BSIZE, sizeof(log.lh) - off));
+    brelse(buf);
+    if (log.lh.n < 0 || log.lh.n > log.size)
+      panic("read_head: bad log header");
   }
-  brelse(buf);
 }
 
-// Write in-memory log header to disk.
-// This is the true point at which the
-// current transaction commits.
+// Write log header lh to disk, the first block last: that one
+// sector, with the count in it, is the true point at which the
+// transaction commits.
 static void
-write_head(void)
+write_head(struct logheader *lh)
 {
-  struct buf *buf = bread(log.dev, log.start);
-  struct logheader *hb = (struct logheader *) (buf->data);
-  int i;
-  hb->n = log.lh.n;
-  for (i = 0; i < log.lh.n; i++) {
-    hb->block[i] = log.lh.block[i];
+  struct buf *buf;
+  int i, off, n;
+
+  for (i = LOGHEAD(lh->n)-1; i >= 0; i--) {
+    buf = bclaim(log.dev, log.start+i);
+    off = i*BSIZE;
+    n = min(BSIZE, sizeof(*lh) - off);
+    memmove(buf->data, (char*)lh + off, n);
+    memset(buf->data + n, 0, BSIZE - n);
+    bwrite(buf);
+    brelse(buf);
   }
-  bwrite(buf);
-  brelse(buf);
 }
 
 static void
@@ -118,42 +186,54 @@ recover_from_log(void)
   read_head();
   install_trans(); // if committed, copy from log to disk
   log.lh.n = 0;
-  write_head(); // clear the log
+  write_head(&log.lh); // clear the log
 }
 
-// called at the start of each FS system call.
+// called at the start of each FS system call that logs up to
+// n blocks.
 void
-begin_op(void)
+begin_opn(int n)
 {
+  if(n > log_opmax())
+    panic("begin_opn");
   acquire(&log.lock);
   while(1){
-    if(log.committing){
+    if(log.closing){
       sleep(&log, &log.lock);
-    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
-      // this op might exhaust log space; wait for commit.
+    } else if(log.lh.n + log.reserved + n > log.size){
+      // this op might exhaust log space; have the flusher
+      // close the transaction now.
+      log.closing = 1;
+      wakeup(&log.closing);
       sleep(&log, &log.lock);
     } else {
       log.outstanding += 1;
+      log.reserved += n;
       release(&log.lock);
       break;
     }
   }
 }
 
-// called at the end of each FS system call.
-// commits if this was the last outstanding operation.
+// called at the start of each FS system call.
 void
-end_op(void)
+begin_op(void)
 {
-  int do_commit = 0;
+  begin_opn(MAXOPBLOCKS);
+}
 
+// called at the end of each FS system call that began with
+// begin_opn(n).
+// once there are no more outstanding operations the flusher
+// may close the transaction.
+void
+end_opn(int n)
+{
   acquire(&log.lock);
   log.outstanding -= 1;
-  if(log.committing)
-    panic("log.committing");
+  log.reserved -= n;
   if(log.outstanding == 0){
-    do_commit = 1;
-    log.committing = 1;
+    wakeup(&log.closing);
   } else {
     // begin_op() may be waiting for log space,
     // and decrementing log.outstanding has decreased
@@ -161,49 +241,148 @@ end_op(void)
     wakeup(&log);
   }
   release(&log.lock);
+}
 
-  if(do_commit){
-    // call commit w/o holding locks, since not allowed
-    // to sleep with locks.
-    commit();
-    acquire(&log.lock);
-    log.committing = 0;
-    wakeup(&log);
-    release(&log.lock);
-  }
+// called at the end of each FS system call.
+void
+end_op(void)
+{
+  end_opn(MAXOPBLOCKS);
 }
 
-// Copy modified blocks from cache to log.
+// Is blockno in transaction lh?  Caller must hold log.lock.
+static int
+inlog(struct logheader *lh, int blockno)
+{
+  int i;
+
+  for (i = 0; i < lh->n; i++)
+    if (lh->block[i] == blockno)
+      return 1;
+  return 0;
+}
+
+// Write the copies of the closed transaction to the log, commit
+// it, and install them.  The log blocks are contiguous, so the
+// disk takes them in a few requests; ide.c sorts the home ones.
 static void
-write_log(void)
+commit(void)
 {
-  int tail;
+  struct buf *b;
+  int i, n;
+
+  if ((n = log.clh.n) == 0)
+    return;
+  TRACE(TC_LOG, TE_COMMIT, n, 0);
+  for (i = 0; i < n; i++) {
+    acquiresleep(&log.cp[i]->lock);
+    log.cp[i]->dev = log.dev;
+    log.cp[i]->blockno = log.start+log.nhead+i;
+  }
+  bwritev(log.cp, n);      // Write the copies to the log
+  write_head(&log.clh);    // Write header to disk -- the real commit
+  for (i = 0; i < n; i++)
+    log.cp[i]->blockno = log.clh.block[i];
+  bwritev(log.cp, n);      // Now install writes to home locations
+  for (i = 0; i < n; i++)
+    releasesleep(&log.cp[i]->lock);
 
-  for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *to = bread(log.dev, log.start+tail+1); // log block
-    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
-    memmove(to->data, from->data, BSIZE);
-    bwrite(to);  // write the log
-    brelse(from);
-    brelse(to);
+  // The cache blocks are clean now, unless the open transaction
+  // has written them again since.
+  for (i = 0; i < n; i++) {
+    b = bread(log.dev, log.clh.block[i]);
+    acquire(&log.lock);
+    if (!inlog(&log.lh, b->blockno))
+      b->flags &= ~B_DIRTY;
+    release(&log.lock);
+    brelse(b);
   }
+  log.clh.n = 0;
+  write_head(&log.clh);    // Erase the transaction from the log
 }
 
+// The log flusher.  Closes each transaction once it has had
+// LOGWAIT to gather system calls, or at once if begin_op() finds
+// it full, and commits it.
 static void
-commit()
+logflush(void)
 {
-  if (log.lh.n > 0) {
-    write_log();     // Write modified blocks from cache to log
-    write_head();    // Write header to disk -- the real commit
-    install_trans(); // Now install writes to home locations
+  struct buf *b;
+  int i;
+
+  for (;;) {
+    acquire(&log.lock);
+    while (log.lh.n == 0 && !log.closing)
+      sleep(&log.closing, &log.lock);
+    if (!log.closing) {
+      release(&log.lock);
+      timersleep(nanotime() + LOGWAIT);
+      acquire(&log.lock);
+      log.closing = 1;
+    }
+    while (log.outstanding > 0)
+      sleep(&log.closing, &log.lock);
+    log.clh = log.lh;
     log.lh.n = 0;
-    write_head();    // Erase the transaction from the log
+    log.nclosed++;
+    release(&log.lock);
+
+    // No system call is in a transaction, so none will change
+    // these blocks until closing is cleared.
+    for (i = 0; i < log.clh.n; i++) {
+      b = bread(log.dev, log.clh.block[i]);
+      memmove(log.cp[i]->data, b->data, BSIZE);
+      brelse(b);
+    }
+
+    acquire(&log.lock);
+    log.closing = 0;
+    wakeup(&log);
+    release(&log.lock);
+
+    commit();
+
+    acquire(&log.lock);
+    log.ncommitted++;
+    wakeup(&log.ncommitted);
+    release(&log.lock);
   }
 }
 
+// Wait until every system call that has ended so far is on disk,
+// for fsync().  Must not be called inside a transaction.
+void
+log_force(void)
+{
+  uint t;
+
+  acquire(&log.lock);
+  t = log.nclosed + (log.lh.n > 0);
+  while((int)(log.ncommitted - t) < 0)
+    sleep(&log.ncommitted, &log.lock);
+  release(&log.lock);
+}
+
+// The caller is about to write blockno straight to disk, not
+// through the log.  Wait for a commit that would install an older
+// copy over it; returns 1 if the open transaction has the block,
+// and the caller must log_write() it instead.
+int
+log_claim(uint blockno)
+{
+  int r;
+
+  acquire(&log.lock);
+  while(log.ncommitted != log.nclosed && inlog(&log.clh, blockno))
+    sleep(&log.ncommitted, &log.lock);
+  r = inlog(&log.lh, blockno);
+  release(&log.lock);
+  return r;
+}
+
 // Caller has modified b->data and is done with the buffer.
 // Record the block number and pin in the cache with B_DIRTY.
-// commit()/write_log() will do the disk write.
+// The flusher will copy it out and do the disk write.
 //
 // log_write() replaces bwrite(); a typical use is:
 //   bp = bread(...)
@@ -215,7 +394,7 @@ log_write(struct buf *b)
 {
   int i;
 
-  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+  if (log.lh.n >= log.size)
     panic("too big a transaction");
   if (log.outstanding < 1)
     panic("log_write outside of trans");
@@ -0,0 +1,3001 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <fmtname>:
+#include "fs.h"
+#include "fcntl.h"
+
+char*
+fmtname(char *path)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	56                   	push   %esi
+       4:	53                   	push   %ebx
+       5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  static char buf[DIRSIZ+1];
+  char *p;
+
+  // Find first character after last slash.
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+       8:	83 ec 0c             	sub    $0xc,%esp
+       b:	53                   	push   %ebx
+       c:	e8 d7 02 00 00       	call   2e8 <strlen>
+      11:	01 d8                	add    %ebx,%eax
+      13:	83 c4 10             	add    $0x10,%esp
+      16:	eb 03                	jmp    1b <fmtname+0x1b>
+      18:	83 e8 01             	sub    $0x1,%eax
+      1b:	39 d8                	cmp    %ebx,%eax
+      1d:	72 05                	jb     24 <fmtname+0x24>
+      1f:	80 38 2f             	cmpb   $0x2f,(%eax)
+      22:	75 f4                	jne    18 <fmtname+0x18>
+    ;
+  p++;
+      24:	8d 58 01             	lea    0x1(%eax),%ebx
+
+  // Return blank-padded name.
+  if(strlen(p) >= DIRSIZ)
+      27:	83 ec 0c             	sub    $0xc,%esp
+      2a:	53                   	push   %ebx
+      2b:	e8 b8 02 00 00       	call   2e8 <strlen>
+      30:	83 c4 10             	add    $0x10,%esp
+      33:	83 f8 0d             	cmp    $0xd,%eax
+      36:	76 09                	jbe    41 <fmtname+0x41>
+    return p;
+  memmove(buf, p, strlen(p));
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  return buf;
+}
+      38:	89 d8                	mov    %ebx,%eax
+      3a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      3d:	5b                   	pop    %ebx
+      3e:	5e                   	pop    %esi
+      3f:	5d                   	pop    %ebp
+      40:	c3                   	ret
+  memmove(buf, p, strlen(p));
+      41:	83 ec 0c             	sub    $0xc,%esp
+      44:	53                   	push   %ebx
+      45:	e8 9e 02 00 00       	call   2e8 <strlen>
+      4a:	83 c4 0c             	add    $0xc,%esp
+      4d:	50                   	push   %eax
+      4e:	53                   	push   %ebx
+      4f:	68 00 1c 00 00       	push   $0x1c00
+      54:	e8 aa 04 00 00       	call   503 <memmove>
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+      59:	89 1c 24             	mov    %ebx,(%esp)
+      5c:	e8 87 02 00 00       	call   2e8 <strlen>
+      61:	89 c6                	mov    %eax,%esi
+      63:	89 1c 24             	mov    %ebx,(%esp)
+      66:	e8 7d 02 00 00       	call   2e8 <strlen>
+      6b:	83 c4 0c             	add    $0xc,%esp
+      6e:	ba 0e 00 00 00       	mov    $0xe,%edx
+      73:	29 f2                	sub    %esi,%edx
+      75:	52                   	push   %edx
+      76:	6a 20                	push   $0x20
+      78:	05 00 1c 00 00       	add    $0x1c00,%eax
+      7d:	50                   	push   %eax
+      7e:	e8 aa 02 00 00       	call   32d <memset>
+  return buf;
+      83:	83 c4 10             	add    $0x10,%esp
+      86:	bb 00 1c 00 00       	mov    $0x1c00,%ebx
+      8b:	eb ab                	jmp    38 <fmtname+0x38>
+
+0000008d <ls>:
+
+void
+ls(char *path)
+{
+      8d:	55                   	push   %ebp
+      8e:	89 e5                	mov    %esp,%ebp
+      90:	57                   	push   %edi
+      91:	56                   	push   %esi
+      92:	53                   	push   %ebx
+      93:	81 ec 54 02 00 00    	sub    $0x254,%esp
+      99:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  char name[DIRSIZ+1];
+  int fd, i, n;
+  struct dirent de[32];
+  struct stat st;
+
+  if((fd = open(path, 0)) < 0){
+      9c:	6a 00                	push   $0x0
+      9e:	53                   	push   %ebx
+      9f:	e8 81 09 00 00       	call   a25 <open>
+      a4:	89 85 b0 fd ff ff    	mov    %eax,-0x250(%ebp)
+      aa:	83 c4 10             	add    $0x10,%esp
+      ad:	85 c0                	test   %eax,%eax
+      af:	0f 88 85 00 00 00    	js     13a <ls+0xad>
+    printf(2, "ls: cannot open %s\n", path);
+    return;
+  }
+
+  if(fstat(fd, &st) < 0){
+      b5:	83 ec 08             	sub    $0x8,%esp
+      b8:	8d 85 c4 fd ff ff    	lea    -0x23c(%ebp),%eax
+      be:	50                   	push   %eax
+      bf:	ff b5 b0 fd ff ff    	push   -0x250(%ebp)
+      c5:	e8 88 09 00 00       	call   a52 <fstat>
+      ca:	83 c4 10             	add    $0x10,%esp
+      cd:	85 c0                	test   %eax,%eax
+      cf:	78 7e                	js     14f <ls+0xc2>
+    printf(2, "ls: cannot stat %s\n", path);
+    close(fd);
+    return;
+  }
+
+  switch(st.type){
+      d1:	0f b7 85 c4 fd ff ff 	movzwl -0x23c(%ebp),%eax
+      d8:	0f bf f0             	movswl %ax,%esi
+      db:	66 83 f8 01          	cmp    $0x1,%ax
+      df:	0f 84 8d 00 00 00    	je     172 <ls+0xe5>
+      e5:	66 83 f8 02          	cmp    $0x2,%ax
+      e9:	75 36                	jne    121 <ls+0x94>
+  case T_FILE:
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+      eb:	8b bd d4 fd ff ff    	mov    -0x22c(%ebp),%edi
+      f1:	8b 85 cc fd ff ff    	mov    -0x234(%ebp),%eax
+      f7:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+      fd:	83 ec 0c             	sub    $0xc,%esp
+     100:	53                   	push   %ebx
+     101:	e8 fa fe ff ff       	call   0 <fmtname>
+     106:	83 c4 08             	add    $0x8,%esp
+     109:	57                   	push   %edi
+     10a:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+     110:	56                   	push   %esi
+     111:	50                   	push   %eax
+     112:	68 54 14 00 00       	push   $0x1454
+     117:	6a 01                	push   $0x1
+     119:	e8 ef 0c 00 00       	call   e0d <printf>
+    break;
+     11e:	83 c4 20             	add    $0x20,%esp
+        printf(1, "%s %d %d %d\n", fmtname(name), st.type, st.ino, st.size);
+      }
+    }
+    break;
+  }
+  close(fd);
+     121:	83 ec 0c             	sub    $0xc,%esp
+     124:	ff b5 b0 fd ff ff    	push   -0x250(%ebp)
+     12a:	e8 d4 07 00 00       	call   903 <close>
+     12f:	83 c4 10             	add    $0x10,%esp
+}
+     132:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     135:	5b                   	pop    %ebx
+     136:	5e                   	pop    %esi
+     137:	5f                   	pop    %edi
+     138:	5d                   	pop    %ebp
+     139:	c3                   	ret
+    printf(2, "ls: cannot open %s\n", path);
+     13a:	83 ec 04             	sub    $0x4,%esp
+     13d:	53                   	push   %ebx
+     13e:	68 2c 14 00 00       	push   $0x142c
+     143:	6a 02                	push   $0x2
+     145:	e8 c3 0c 00 00       	call   e0d <printf>
+    return;
+     14a:	83 c4 10             	add    $0x10,%esp
+     14d:	eb e3                	jmp    132 <ls+0xa5>
+    printf(2, "ls: cannot stat %s\n", path);
+     14f:	83 ec 04             	sub    $0x4,%esp
+     152:	53                   	push   %ebx
+     153:	68 40 14 00 00       	push   $0x1440
+     158:	6a 02                	push   $0x2
+     15a:	e8 ae 0c 00 00       	call   e0d <printf>
+    close(fd);
+     15f:	83 c4 04             	add    $0x4,%esp
+     162:	ff b5 b0 fd ff ff    	push   -0x250(%ebp)
+     168:	e8 96 07 00 00       	call   903 <close>
+    return;
+     16d:	83 c4 10             	add    $0x10,%esp
+     170:	eb c0                	jmp    132 <ls+0xa5>
+    name[DIRSIZ] = 0;
+     172:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+    while((n = getdents(fd, de, sizeof(de))) > 0){
+     176:	83 ec 04             	sub    $0x4,%esp
+     179:	68 00 02 00 00       	push   $0x200
+     17e:	8d 85 d8 fd ff ff    	lea    -0x228(%ebp),%eax
+     184:	50                   	push   %eax
+     185:	ff b5 b0 fd ff ff    	push   -0x250(%ebp)
+     18b:	e8 0b 0b 00 00       	call   c9b <getdents>
+     190:	89 c2                	mov    %eax,%edx
+     192:	83 c4 10             	add    $0x10,%esp
+     195:	85 c0                	test   %eax,%eax
+     197:	7e 88                	jle    121 <ls+0x94>
+      for(i = 0; i < n / sizeof(de[0]); i++){
+     199:	be 00 00 00 00       	mov    $0x0,%esi
+     19e:	89 95 ac fd ff ff    	mov    %edx,-0x254(%ebp)
+     1a4:	eb 16                	jmp    1bc <ls+0x12f>
+          printf(1, "ls: cannot stat %s\n", name);
+     1a6:	83 ec 04             	sub    $0x4,%esp
+     1a9:	53                   	push   %ebx
+     1aa:	68 40 14 00 00       	push   $0x1440
+     1af:	6a 01                	push   $0x1
+     1b1:	e8 57 0c 00 00       	call   e0d <printf>
+          continue;
+     1b6:	83 c4 10             	add    $0x10,%esp
+      for(i = 0; i < n / sizeof(de[0]); i++){
+     1b9:	83 c6 01             	add    $0x1,%esi
+     1bc:	8b 85 ac fd ff ff    	mov    -0x254(%ebp),%eax
+     1c2:	c1 e8 04             	shr    $0x4,%eax
+     1c5:	39 c6                	cmp    %eax,%esi
+     1c7:	73 ad                	jae    176 <ls+0xe9>
+        memmove(name, de[i].name, DIRSIZ);
+     1c9:	89 f0                	mov    %esi,%eax
+     1cb:	c1 e0 04             	shl    $0x4,%eax
+     1ce:	8d 84 05 da fd ff ff 	lea    -0x226(%ebp,%eax,1),%eax
+     1d5:	83 ec 04             	sub    $0x4,%esp
+     1d8:	6a 0e                	push   $0xe
+     1da:	50                   	push   %eax
+     1db:	8d 5d d9             	lea    -0x27(%ebp),%ebx
+     1de:	53                   	push   %ebx
+     1df:	e8 1f 03 00 00       	call   503 <memmove>
+        if(fstatat(fd, name, &st) < 0){
+     1e4:	83 c4 0c             	add    $0xc,%esp
+     1e7:	8d 85 c4 fd ff ff    	lea    -0x23c(%ebp),%eax
+     1ed:	50                   	push   %eax
+     1ee:	53                   	push   %ebx
+     1ef:	ff b5 b0 fd ff ff    	push   -0x250(%ebp)
+     1f5:	e8 b0 0a 00 00       	call   caa <fstatat>
+     1fa:	83 c4 10             	add    $0x10,%esp
+     1fd:	85 c0                	test   %eax,%eax
+     1ff:	78 a5                	js     1a6 <ls+0x119>
+        printf(1, "%s %d %d %d\n", fmtname(name), st.type, st.ino, st.size);
+     201:	8b bd d4 fd ff ff    	mov    -0x22c(%ebp),%edi
+     207:	8b 9d cc fd ff ff    	mov    -0x234(%ebp),%ebx
+     20d:	0f b7 85 c4 fd ff ff 	movzwl -0x23c(%ebp),%eax
+     214:	66 89 85 b4 fd ff ff 	mov    %ax,-0x24c(%ebp)
+     21b:	83 ec 0c             	sub    $0xc,%esp
+     21e:	8d 45 d9             	lea    -0x27(%ebp),%eax
+     221:	50                   	push   %eax
+     222:	e8 d9 fd ff ff       	call   0 <fmtname>
+     227:	89 c2                	mov    %eax,%edx
+     229:	83 c4 08             	add    $0x8,%esp
+     22c:	57                   	push   %edi
+     22d:	53                   	push   %ebx
+     22e:	0f bf 85 b4 fd ff ff 	movswl -0x24c(%ebp),%eax
+     235:	50                   	push   %eax
+     236:	52                   	push   %edx
+     237:	68 54 14 00 00       	push   $0x1454
+     23c:	6a 01                	push   $0x1
+     23e:	e8 ca 0b 00 00       	call   e0d <printf>
+     243:	83 c4 20             	add    $0x20,%esp
+     246:	e9 6e ff ff ff       	jmp    1b9 <ls+0x12c>
+
+0000024b <main>:
+
+int
+main(int argc, char *argv[])
+{
+     24b:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     24f:	83 e4 f0             	and    $0xfffffff0,%esp
+     252:	ff 71 fc             	push   -0x4(%ecx)
+     255:	55                   	push   %ebp
+     256:	89 e5                	mov    %esp,%ebp
+     258:	57                   	push   %edi
+     259:	56                   	push   %esi
+     25a:	53                   	push   %ebx
+     25b:	51                   	push   %ecx
+     25c:	83 ec 08             	sub    $0x8,%esp
+     25f:	8b 31                	mov    (%ecx),%esi
+     261:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+     264:	83 fe 01             	cmp    $0x1,%esi
+     267:	7e 07                	jle    270 <main+0x25>
+    ls(".");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+     269:	bb 01 00 00 00       	mov    $0x1,%ebx
+     26e:	eb 23                	jmp    293 <main+0x48>
+    ls(".");
+     270:	83 ec 0c             	sub    $0xc,%esp
+     273:	68 61 14 00 00       	push   $0x1461
+     278:	e8 10 fe ff ff       	call   8d <ls>
+    exit();
+     27d:	e8 52 06 00 00       	call   8d4 <exit>
+    ls(argv[i]);
+     282:	83 ec 0c             	sub    $0xc,%esp
+     285:	ff 34 9f             	push   (%edi,%ebx,4)
+     288:	e8 00 fe ff ff       	call   8d <ls>
+  for(i=1; i<argc; i++)
+     28d:	83 c3 01             	add    $0x1,%ebx
+     290:	83 c4 10             	add    $0x10,%esp
+     293:	39 f3                	cmp    %esi,%ebx
+     295:	7c eb                	jl     282 <main+0x37>
+  exit();
+     297:	e8 38 06 00 00       	call   8d4 <exit>
+
+0000029c <strcpy>:
+#include "memlayout.h"
+#include "clock.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     29c:	55                   	push   %ebp
+     29d:	89 e5                	mov    %esp,%ebp
+     29f:	56                   	push   %esi
+     2a0:	53                   	push   %ebx
+     2a1:	8b 75 08             	mov    0x8(%ebp),%esi
+     2a4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     2a7:	89 f0                	mov    %esi,%eax
+     2a9:	89 d1                	mov    %edx,%ecx
+     2ab:	83 c2 01             	add    $0x1,%edx
+     2ae:	89 c3                	mov    %eax,%ebx
+     2b0:	83 c0 01             	add    $0x1,%eax
+     2b3:	0f b6 09             	movzbl (%ecx),%ecx
+     2b6:	88 0b                	mov    %cl,(%ebx)
+     2b8:	84 c9                	test   %cl,%cl
+     2ba:	75 ed                	jne    2a9 <strcpy+0xd>
+    ;
+  return os;
+}
+     2bc:	89 f0                	mov    %esi,%eax
+     2be:	5b                   	pop    %ebx
+     2bf:	5e                   	pop    %esi
+     2c0:	5d                   	pop    %ebp
+     2c1:	c3                   	ret
+
+000002c2 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     2c2:	55                   	push   %ebp
+     2c3:	89 e5                	mov    %esp,%ebp
+     2c5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     2c8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+     2cb:	eb 06                	jmp    2d3 <strcmp+0x11>
+    p++, q++;
+     2cd:	83 c1 01             	add    $0x1,%ecx
+     2d0:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+     2d3:	0f b6 01             	movzbl (%ecx),%eax
+     2d6:	84 c0                	test   %al,%al
+     2d8:	74 04                	je     2de <strcmp+0x1c>
+     2da:	3a 02                	cmp    (%edx),%al
+     2dc:	74 ef                	je     2cd <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+     2de:	0f b6 c0             	movzbl %al,%eax
+     2e1:	0f b6 12             	movzbl (%edx),%edx
+     2e4:	29 d0                	sub    %edx,%eax
+}
+     2e6:	5d                   	pop    %ebp
+     2e7:	c3                   	ret
+
+000002e8 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     2e8:	55                   	push   %ebp
+     2e9:	89 e5                	mov    %esp,%ebp
+     2eb:	53                   	push   %ebx
+     2ec:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  const char *p;
+  uint w;
+
+  for(p = s; (uint)p & 3; p++)
+     2ef:	89 c8                	mov    %ecx,%eax
+     2f1:	eb 03                	jmp    2f6 <strlen+0xe>
+     2f3:	83 c0 01             	add    $0x1,%eax
+     2f6:	a8 03                	test   $0x3,%al
+     2f8:	74 09                	je     303 <strlen+0x1b>
+    if(*p == 0)
+     2fa:	80 38 00             	cmpb   $0x0,(%eax)
+     2fd:	75 f4                	jne    2f3 <strlen+0xb>
+      return p - s;
+     2ff:	29 c8                	sub    %ecx,%eax
+     301:	eb 25                	jmp    328 <strlen+0x40>
+  // Then a word at a time, which never crosses into the next page:
+  // a word with a zero byte in it has one of these bits set.
+  for(;; p += 4){
+    w = *(uint*)p;
+     303:	8b 10                	mov    (%eax),%edx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     305:	8d 9a ff fe fe fe    	lea    -0x1010101(%edx),%ebx
+     30b:	f7 d2                	not    %edx
+     30d:	21 da                	and    %ebx,%edx
+     30f:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+     315:	75 05                	jne    31c <strlen+0x34>
+  for(;; p += 4){
+     317:	83 c0 04             	add    $0x4,%eax
+    w = *(uint*)p;
+     31a:	eb e7                	jmp    303 <strlen+0x1b>
+      break;
+  }
+  while(*p)
+     31c:	80 38 00             	cmpb   $0x0,(%eax)
+     31f:	74 05                	je     326 <strlen+0x3e>
+    p++;
+     321:	83 c0 01             	add    $0x1,%eax
+     324:	eb f6                	jmp    31c <strlen+0x34>
+  return p - s;
+     326:	29 c8                	sub    %ecx,%eax
+}
+     328:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     32b:	c9                   	leave
+     32c:	c3                   	ret
+
+0000032d <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     32d:	55                   	push   %ebp
+     32e:	89 e5                	mov    %esp,%ebp
+     330:	57                   	push   %edi
+     331:	56                   	push   %esi
+     332:	53                   	push   %ebx
+     333:	8b 55 10             	mov    0x10(%ebp),%edx
+  uint h;
+  char *d;
+
+  d = dst;
+  c &= 0xFF;
+     336:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  if(n >= 16){
+     33a:	83 fa 0f             	cmp    $0xf,%edx
+     33d:	76 52                	jbe    391 <memset+0x64>
+    h = -(uint)d & 3;
+     33f:	8b 45 08             	mov    0x8(%ebp),%eax
+     342:	f7 d8                	neg    %eax
+     344:	83 e0 03             	and    $0x3,%eax
+     347:	89 c6                	mov    %eax,%esi
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     349:	8b 7d 08             	mov    0x8(%ebp),%edi
+     34c:	89 c1                	mov    %eax,%ecx
+     34e:	89 d8                	mov    %ebx,%eax
+     350:	fc                   	cld
+     351:	f3 aa                	rep stos %al,%es:(%edi)
+    stosb(d, c, h);
+    stosl(d + h, (c<<24)|(c<<16)|(c<<8)|c, (n - h)/4);
+     353:	29 f2                	sub    %esi,%edx
+     355:	89 d1                	mov    %edx,%ecx
+     357:	c1 e9 02             	shr    $0x2,%ecx
+     35a:	c1 e0 18             	shl    $0x18,%eax
+     35d:	89 df                	mov    %ebx,%edi
+     35f:	c1 e7 10             	shl    $0x10,%edi
+     362:	09 f8                	or     %edi,%eax
+     364:	89 df                	mov    %ebx,%edi
+     366:	c1 e7 08             	shl    $0x8,%edi
+     369:	09 f8                	or     %edi,%eax
+     36b:	09 d8                	or     %ebx,%eax
+     36d:	89 f7                	mov    %esi,%edi
+     36f:	03 7d 08             	add    0x8(%ebp),%edi
+}
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosl" :
+     372:	fc                   	cld
+     373:	f3 ab                	rep stos %eax,%es:(%edi)
+    d += h + (n - h)/4*4;
+     375:	89 d7                	mov    %edx,%edi
+     377:	83 e7 fc             	and    $0xfffffffc,%edi
+     37a:	09 f7                	or     %esi,%edi
+     37c:	03 7d 08             	add    0x8(%ebp),%edi
+    n = (n - h)%4;
+     37f:	83 e2 03             	and    $0x3,%edx
+  asm volatile("cld; rep stosb" :
+     382:	89 d1                	mov    %edx,%ecx
+     384:	89 d8                	mov    %ebx,%eax
+     386:	fc                   	cld
+     387:	f3 aa                	rep stos %al,%es:(%edi)
+  }
+  stosb(d, c, n);
+  return dst;
+}
+     389:	8b 45 08             	mov    0x8(%ebp),%eax
+     38c:	5b                   	pop    %ebx
+     38d:	5e                   	pop    %esi
+     38e:	5f                   	pop    %edi
+     38f:	5d                   	pop    %ebp
+     390:	c3                   	ret
+  d = dst;
+     391:	8b 7d 08             	mov    0x8(%ebp),%edi
+     394:	eb ec                	jmp    382 <memset+0x55>
+
+00000396 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     396:	55                   	push   %ebp
+     397:	89 e5                	mov    %esp,%ebp
+     399:	8b 45 08             	mov    0x8(%ebp),%eax
+     39c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     3a0:	eb 03                	jmp    3a5 <strchr+0xf>
+     3a2:	83 c0 01             	add    $0x1,%eax
+     3a5:	0f b6 10             	movzbl (%eax),%edx
+     3a8:	84 d2                	test   %dl,%dl
+     3aa:	74 06                	je     3b2 <strchr+0x1c>
+    if(*s == c)
+     3ac:	38 ca                	cmp    %cl,%dl
+     3ae:	75 f2                	jne    3a2 <strchr+0xc>
+     3b0:	eb 05                	jmp    3b7 <strchr+0x21>
+      return (char*)s;
+  return 0;
+     3b2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     3b7:	5d                   	pop    %ebp
+     3b8:	c3                   	ret
+
+000003b9 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     3b9:	55                   	push   %ebp
+     3ba:	89 e5                	mov    %esp,%ebp
+     3bc:	56                   	push   %esi
+     3bd:	53                   	push   %ebx
+     3be:	8b 55 08             	mov    0x8(%ebp),%edx
+     3c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     3c4:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  // A word at a time while they agree.
+  if((((uint)s1 | (uint)s2) & 3) == 0)
+     3c7:	89 d3                	mov    %edx,%ebx
+     3c9:	09 cb                	or     %ecx,%ebx
+     3cb:	f6 c3 03             	test   $0x3,%bl
+     3ce:	74 24                	je     3f4 <memcmp+0x3b>
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+      s1 += 4, s2 += 4;
+  while(n-- > 0){
+     3d0:	8d 70 ff             	lea    -0x1(%eax),%esi
+     3d3:	85 c0                	test   %eax,%eax
+     3d5:	74 32                	je     409 <memcmp+0x50>
+    if(*s1 != *s2)
+     3d7:	0f b6 02             	movzbl (%edx),%eax
+     3da:	0f b6 19             	movzbl (%ecx),%ebx
+     3dd:	38 d8                	cmp    %bl,%al
+     3df:	75 20                	jne    401 <memcmp+0x48>
+      return *s1 - *s2;
+    s1++, s2++;
+     3e1:	83 c2 01             	add    $0x1,%edx
+     3e4:	83 c1 01             	add    $0x1,%ecx
+  while(n-- > 0){
+     3e7:	89 f0                	mov    %esi,%eax
+     3e9:	eb e5                	jmp    3d0 <memcmp+0x17>
+      s1 += 4, s2 += 4;
+     3eb:	83 c2 04             	add    $0x4,%edx
+     3ee:	83 c1 04             	add    $0x4,%ecx
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+     3f1:	83 e8 04             	sub    $0x4,%eax
+     3f4:	83 f8 03             	cmp    $0x3,%eax
+     3f7:	76 d7                	jbe    3d0 <memcmp+0x17>
+     3f9:	8b 31                	mov    (%ecx),%esi
+     3fb:	39 32                	cmp    %esi,(%edx)
+     3fd:	74 ec                	je     3eb <memcmp+0x32>
+     3ff:	eb cf                	jmp    3d0 <memcmp+0x17>
+      return *s1 - *s2;
+     401:	0f b6 c0             	movzbl %al,%eax
+     404:	0f b6 db             	movzbl %bl,%ebx
+     407:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     409:	5b                   	pop    %ebx
+     40a:	5e                   	pop    %esi
+     40b:	5d                   	pop    %ebp
+     40c:	c3                   	ret
+
+0000040d <memchr>:
+// The first c in the n bytes at v, or 0.  Once aligned, a word at
+// a time, with the word's bytes that equal c turned into zeroes
+// and those looked for.
+void*
+memchr(const void *v, int c, uint n)
+{
+     40d:	55                   	push   %ebp
+     40e:	89 e5                	mov    %esp,%ebp
+     410:	57                   	push   %edi
+     411:	56                   	push   %esi
+     412:	53                   	push   %ebx
+     413:	8b 45 08             	mov    0x8(%ebp),%eax
+     416:	8b 55 10             	mov    0x10(%ebp),%edx
+  const uchar *s;
+  uint w, rep;
+
+  s = v;
+  c = (uchar)c;
+     419:	0f b6 75 0c          	movzbl 0xc(%ebp),%esi
+  for(; n > 0 && ((uint)s & 3); n--, s++)
+     41d:	eb 06                	jmp    425 <memchr+0x18>
+     41f:	83 ea 01             	sub    $0x1,%edx
+     422:	83 c0 01             	add    $0x1,%eax
+     425:	85 d2                	test   %edx,%edx
+     427:	74 0d                	je     436 <memchr+0x29>
+     429:	a8 03                	test   $0x3,%al
+     42b:	74 09                	je     436 <memchr+0x29>
+    if(*s == c)
+     42d:	0f b6 08             	movzbl (%eax),%ecx
+     430:	39 f1                	cmp    %esi,%ecx
+     432:	75 eb                	jne    41f <memchr+0x12>
+     434:	eb 41                	jmp    477 <memchr+0x6a>
+      return (void*)s;
+  rep = c * 0x01010101;
+     436:	69 fe 01 01 01 01    	imul   $0x1010101,%esi,%edi
+  for(; n >= 4; n -= 4, s += 4){
+     43c:	eb 06                	jmp    444 <memchr+0x37>
+     43e:	83 ea 04             	sub    $0x4,%edx
+     441:	83 c0 04             	add    $0x4,%eax
+     444:	83 fa 03             	cmp    $0x3,%edx
+     447:	76 16                	jbe    45f <memchr+0x52>
+    w = *(uint*)s ^ rep;
+     449:	89 f9                	mov    %edi,%ecx
+     44b:	33 08                	xor    (%eax),%ecx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     44d:	8d 99 ff fe fe fe    	lea    -0x1010101(%ecx),%ebx
+     453:	f7 d1                	not    %ecx
+     455:	21 cb                	and    %ecx,%ebx
+     457:	f7 c3 80 80 80 80    	test   $0x80808080,%ebx
+     45d:	74 df                	je     43e <memchr+0x31>
+      break;
+  }
+  for(; n > 0; n--, s++)
+     45f:	85 d2                	test   %edx,%edx
+     461:	74 0f                	je     472 <memchr+0x65>
+    if(*s == c)
+     463:	0f b6 08             	movzbl (%eax),%ecx
+     466:	39 f1                	cmp    %esi,%ecx
+     468:	74 0d                	je     477 <memchr+0x6a>
+  for(; n > 0; n--, s++)
+     46a:	83 ea 01             	sub    $0x1,%edx
+     46d:	83 c0 01             	add    $0x1,%eax
+     470:	eb ed                	jmp    45f <memchr+0x52>
+      return (void*)s;
+  return 0;
+     472:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     477:	5b                   	pop    %ebx
+     478:	5e                   	pop    %esi
+     479:	5f                   	pop    %edi
+     47a:	5d                   	pop    %ebp
+     47b:	c3                   	ret
+
+0000047c <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     47c:	55                   	push   %ebp
+     47d:	89 e5                	mov    %esp,%ebp
+     47f:	57                   	push   %edi
+     480:	56                   	push   %esi
+     481:	53                   	push   %ebx
+     482:	83 ec 1c             	sub    $0x1c,%esp
+     485:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     488:	bb 00 00 00 00       	mov    $0x0,%ebx
+     48d:	89 de                	mov    %ebx,%esi
+     48f:	83 c3 01             	add    $0x1,%ebx
+     492:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     495:	7d 2e                	jge    4c5 <gets+0x49>
+    cc = read(0, &c, 1);
+     497:	83 ec 04             	sub    $0x4,%esp
+     49a:	6a 01                	push   $0x1
+     49c:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     49f:	50                   	push   %eax
+     4a0:	6a 00                	push   $0x0
+     4a2:	e8 51 05 00 00       	call   9f8 <read>
+    if(cc < 1)
+     4a7:	83 c4 10             	add    $0x10,%esp
+     4aa:	85 c0                	test   %eax,%eax
+     4ac:	7e 17                	jle    4c5 <gets+0x49>
+      break;
+    buf[i++] = c;
+     4ae:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     4b2:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+     4b5:	3c 0a                	cmp    $0xa,%al
+     4b7:	0f 94 c2             	sete   %dl
+     4ba:	3c 0d                	cmp    $0xd,%al
+     4bc:	0f 94 c0             	sete   %al
+     4bf:	08 c2                	or     %al,%dl
+     4c1:	74 ca                	je     48d <gets+0x11>
+    buf[i++] = c;
+     4c3:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+     4c5:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+     4c9:	89 f8                	mov    %edi,%eax
+     4cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4ce:	5b                   	pop    %ebx
+     4cf:	5e                   	pop    %esi
+     4d0:	5f                   	pop    %edi
+     4d1:	5d                   	pop    %ebp
+     4d2:	c3                   	ret
+
+000004d3 <atoi>:
+  return r;
+}
+
+int
+atoi(const char *s)
+{
+     4d3:	55                   	push   %ebp
+     4d4:	89 e5                	mov    %esp,%ebp
+     4d6:	53                   	push   %ebx
+     4d7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+     4da:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+     4df:	eb 10                	jmp    4f1 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+     4e1:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+     4e4:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+     4e7:	83 c1 01             	add    $0x1,%ecx
+     4ea:	0f be c0             	movsbl %al,%eax
+     4ed:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+     4f1:	0f b6 01             	movzbl (%ecx),%eax
+     4f4:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     4f7:	80 fb 09             	cmp    $0x9,%bl
+     4fa:	76 e5                	jbe    4e1 <atoi+0xe>
+  return n;
+}
+     4fc:	89 d0                	mov    %edx,%eax
+     4fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     501:	c9                   	leave
+     502:	c3                   	ret
+
+00000503 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     503:	55                   	push   %ebp
+     504:	89 e5                	mov    %esp,%ebp
+     506:	57                   	push   %edi
+     507:	56                   	push   %esi
+     508:	53                   	push   %ebx
+     509:	83 ec 08             	sub    $0x8,%esp
+     50c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     50f:	8b 55 0c             	mov    0xc(%ebp),%edx
+     512:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *src;
+  int h;
+
+  dst = vdst;
+  src = vsrc;
+  if(n <= 0)
+     515:	85 c0                	test   %eax,%eax
+     517:	0f 8e 82 00 00 00    	jle    59f <memmove+0x9c>
+    return vdst;
+  if(src < dst && src + n > dst){
+     51d:	39 da                	cmp    %ebx,%edx
+     51f:	73 07                	jae    528 <memmove+0x25>
+     521:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+     524:	39 cb                	cmp    %ecx,%ebx
+     526:	72 5e                	jb     586 <memmove+0x83>
+    movsbback(dst + n - 1, src + n - 1, n);
+    return vdst;
+  }
+  if(n >= 16 && (((uint)dst ^ (uint)src) & 3) == 0){
+     528:	83 f8 0f             	cmp    $0xf,%eax
+     52b:	7e 69                	jle    596 <memmove+0x93>
+     52d:	89 d9                	mov    %ebx,%ecx
+     52f:	31 d1                	xor    %edx,%ecx
+     531:	f6 c1 03             	test   $0x3,%cl
+     534:	75 73                	jne    5a9 <memmove+0xa6>
+    h = -(uint)dst & 3;
+     536:	89 d9                	mov    %ebx,%ecx
+     538:	f7 d9                	neg    %ecx
+     53a:	83 e1 03             	and    $0x3,%ecx
+}
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsb" :
+     53d:	89 df                	mov    %ebx,%edi
+     53f:	89 d6                	mov    %edx,%esi
+     541:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+     544:	fc                   	cld
+     545:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    movsb(dst, src, h);
+    dst += h, src += h, n -= h;
+     547:	8b 75 f0             	mov    -0x10(%ebp),%esi
+     54a:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+     54d:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+     550:	29 f0                	sub    %esi,%eax
+    movsl(dst, src, n/4);
+     552:	8d 50 03             	lea    0x3(%eax),%edx
+     555:	0f 49 d0             	cmovns %eax,%edx
+     558:	c1 fa 02             	sar    $0x2,%edx
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+     55b:	89 7d f0             	mov    %edi,-0x10(%ebp)
+     55e:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     561:	89 ce                	mov    %ecx,%esi
+     563:	89 d1                	mov    %edx,%ecx
+     565:	fc                   	cld
+     566:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    dst += n/4*4, src += n/4*4, n %= 4;
+     568:	c1 e2 02             	shl    $0x2,%edx
+     56b:	8b 7d f0             	mov    -0x10(%ebp),%edi
+     56e:	01 d7                	add    %edx,%edi
+     570:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     573:	01 ca                	add    %ecx,%edx
+     575:	89 c6                	mov    %eax,%esi
+     577:	c1 fe 1f             	sar    $0x1f,%esi
+     57a:	c1 ee 1e             	shr    $0x1e,%esi
+     57d:	01 f0                	add    %esi,%eax
+     57f:	83 e0 03             	and    $0x3,%eax
+     582:	29 f0                	sub    %esi,%eax
+     584:	eb 12                	jmp    598 <memmove+0x95>
+    movsbback(dst + n - 1, src + n - 1, n);
+     586:	8d 78 ff             	lea    -0x1(%eax),%edi
+     589:	8d 34 3a             	lea    (%edx,%edi,1),%esi
+     58c:	01 df                	add    %ebx,%edi
+// Copy cnt bytes down from the last ones, at dst and src, to the
+// first: for overlapping moves up.
+static inline void
+movsbback(void *dst, const void *src, int cnt)
+{
+  asm volatile("std; rep movsb; cld" :
+     58e:	89 c1                	mov    %eax,%ecx
+     590:	fd                   	std
+     591:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     593:	fc                   	cld
+    return vdst;
+     594:	eb 09                	jmp    59f <memmove+0x9c>
+  dst = vdst;
+     596:	89 df                	mov    %ebx,%edi
+  asm volatile("cld; rep movsb" :
+     598:	89 d6                	mov    %edx,%esi
+     59a:	89 c1                	mov    %eax,%ecx
+     59c:	fc                   	cld
+     59d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  }
+  movsb(dst, src, n);
+  return vdst;
+}
+     59f:	89 d8                	mov    %ebx,%eax
+     5a1:	83 c4 08             	add    $0x8,%esp
+     5a4:	5b                   	pop    %ebx
+     5a5:	5e                   	pop    %esi
+     5a6:	5f                   	pop    %edi
+     5a7:	5d                   	pop    %ebp
+     5a8:	c3                   	ret
+  dst = vdst;
+     5a9:	89 df                	mov    %ebx,%edi
+     5ab:	eb eb                	jmp    598 <memmove+0x95>
+
+000005ad <vclock_gettime>:
+
+// clock_gettime() without a system call: read the clock page
+// that the kernel maps at CLOCKPAGE (see clock.h).
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+     5ad:	55                   	push   %ebp
+     5ae:	89 e5                	mov    %esp,%ebp
+     5b0:	57                   	push   %edi
+     5b1:	56                   	push   %esi
+     5b2:	53                   	push   %ebx
+     5b3:	83 ec 14             	sub    $0x14,%esp
+  struct clockpage *cp = (struct clockpage*)CLOCKPAGE;
+  uint seq, rem, d;
+  uint64 tsc, ns, now;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+     5b6:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     5ba:	0f 87 a3 00 00 00    	ja     663 <vclock_gettime+0xb6>
+    return -1;
+  do {
+    seq = cp->seq;
+     5c0:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+    __sync_synchronize();
+     5c5:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    tsc = cp->tsc;
+     5ca:	8b 15 10 f0 ff 7f    	mov    0x7ffff010,%edx
+     5d0:	8b 1d 14 f0 ff 7f    	mov    0x7ffff014,%ebx
+    ns = cp->ns;
+     5d6:	8b 35 18 f0 ff 7f    	mov    0x7ffff018,%esi
+     5dc:	8b 3d 1c f0 ff 7f    	mov    0x7ffff01c,%edi
+    __sync_synchronize();
+     5e2:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != cp->seq);
+     5e7:	89 c1                	mov    %eax,%ecx
+     5e9:	83 e1 01             	and    $0x1,%ecx
+     5ec:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     5ef:	75 cf                	jne    5c0 <vclock_gettime+0x13>
+     5f1:	8b 0d 00 f0 ff 7f    	mov    0x7ffff000,%ecx
+     5f7:	39 c1                	cmp    %eax,%ecx
+     5f9:	75 c5                	jne    5c0 <vclock_gettime+0x13>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+     5fb:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     5fe:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     601:	0f 31                	rdtsc
+     603:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     606:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     609:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  now = rdtsc();
+  // Less than a tick has passed since the update, so the delta
+  // fits in 32 bits.
+  d = now > tsc ? now - tsc : 0;
+     60c:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     60f:	19 d3                	sbb    %edx,%ebx
+     611:	73 07                	jae    61a <vclock_gettime+0x6d>
+     613:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+     616:	29 d8                	sub    %ebx,%eax
+     618:	89 c1                	mov    %eax,%ecx
+  ns += ((uint64)d * cp->mult) >> cp->shift;
+     61a:	89 c8                	mov    %ecx,%eax
+     61c:	f7 25 04 f0 ff 7f    	mull   0x7ffff004
+     622:	0f b6 0d 08 f0 ff 7f 	movzbl 0x7ffff008,%ecx
+     629:	0f ad d0             	shrd   %cl,%edx,%eax
+     62c:	d3 ea                	shr    %cl,%edx
+     62e:	f6 c1 20             	test   $0x20,%cl
+     631:	74 04                	je     637 <vclock_gettime+0x8a>
+     633:	89 d0                	mov    %edx,%eax
+     635:	31 d2                	xor    %edx,%edx
+     637:	01 f0                	add    %esi,%eax
+     639:	11 fa                	adc    %edi,%edx
+static inline uint
+divl(uint64 n, uint d, uint *r)
+{
+  uint q;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (*r) :
+     63b:	bb 00 ca 9a 3b       	mov    $0x3b9aca00,%ebx
+     640:	f7 f3                	div    %ebx
+  ts->tv_sec = divl(ns, 1000000000, &rem);
+     642:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     645:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = rem;
+     647:	89 57 04             	mov    %edx,0x4(%edi)
+  if(clk == CLOCK_REALTIME)
+     64a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     64e:	75 1a                	jne    66a <vclock_gettime+0xbd>
+    ts->tv_sec += cp->boottime;
+     650:	03 05 0c f0 ff 7f    	add    0x7ffff00c,%eax
+     656:	89 07                	mov    %eax,(%edi)
+  return 0;
+     658:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     65b:	83 c4 14             	add    $0x14,%esp
+     65e:	5b                   	pop    %ebx
+     65f:	5e                   	pop    %esi
+     660:	5f                   	pop    %edi
+     661:	5d                   	pop    %ebp
+     662:	c3                   	ret
+    return -1;
+     663:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     668:	eb f1                	jmp    65b <vclock_gettime+0xae>
+  return 0;
+     66a:	b8 00 00 00 00       	mov    $0x0,%eax
+     66f:	eb ea                	jmp    65b <vclock_gettime+0xae>
+
+00000671 <flush>:
+
+// Write out fd's buffer, or with fd < 0 every buffer.
+// Returns -1 if a write fails.
+int
+flush(int fd)
+{
+     671:	55                   	push   %ebp
+     672:	89 e5                	mov    %esp,%ebp
+     674:	56                   	push   %esi
+     675:	53                   	push   %ebx
+     676:	8b 45 08             	mov    0x8(%ebp),%eax
+  int r, n;
+
+  if(fd < 0){
+     679:	85 c0                	test   %eax,%eax
+     67b:	78 5d                	js     6da <flush+0x69>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+      if(flush(fd) < 0)
+        r = -1;
+    return r;
+  }
+  if(fd >= NOBUF || (n = obuf[fd].n) == 0)
+     67d:	83 f8 0f             	cmp    $0xf,%eax
+     680:	7f 64                	jg     6e6 <flush+0x75>
+     682:	69 d0 08 02 00 00    	imul   $0x208,%eax,%edx
+     688:	8b b2 24 1c 00 00    	mov    0x1c24(%edx),%esi
+     68e:	85 f6                	test   %esi,%esi
+     690:	74 59                	je     6eb <flush+0x7a>
+    return 0;
+  obuf[fd].n = 0;
+     692:	c7 82 24 1c 00 00 00 	movl   $0x0,0x1c24(%edx)
+     699:	00 00 00 
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     69c:	81 c2 28 1c 00 00    	add    $0x1c28,%edx
+     6a2:	83 ec 04             	sub    $0x4,%esp
+     6a5:	56                   	push   %esi
+     6a6:	52                   	push   %edx
+     6a7:	50                   	push   %eax
+     6a8:	e8 5a 03 00 00       	call   a07 <write>
+     6ad:	83 c4 10             	add    $0x10,%esp
+     6b0:	39 f0                	cmp    %esi,%eax
+     6b2:	75 40                	jne    6f4 <flush+0x83>
+     6b4:	be 00 00 00 00       	mov    $0x0,%esi
+     6b9:	eb 30                	jmp    6eb <flush+0x7a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     6bb:	83 c3 01             	add    $0x1,%ebx
+     6be:	83 fb 0f             	cmp    $0xf,%ebx
+     6c1:	7f 28                	jg     6eb <flush+0x7a>
+      if(flush(fd) < 0)
+     6c3:	83 ec 0c             	sub    $0xc,%esp
+     6c6:	53                   	push   %ebx
+     6c7:	e8 a5 ff ff ff       	call   671 <flush>
+     6cc:	83 c4 10             	add    $0x10,%esp
+     6cf:	85 c0                	test   %eax,%eax
+     6d1:	79 e8                	jns    6bb <flush+0x4a>
+        r = -1;
+     6d3:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     6d8:	eb e1                	jmp    6bb <flush+0x4a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     6da:	be 00 00 00 00       	mov    $0x0,%esi
+     6df:	bb 00 00 00 00       	mov    $0x0,%ebx
+     6e4:	eb d8                	jmp    6be <flush+0x4d>
+    return 0;
+     6e6:	be 00 00 00 00       	mov    $0x0,%esi
+}
+     6eb:	89 f0                	mov    %esi,%eax
+     6ed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     6f0:	5b                   	pop    %ebx
+     6f1:	5e                   	pop    %esi
+     6f2:	5d                   	pop    %ebp
+     6f3:	c3                   	ret
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     6f4:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     6f9:	eb f0                	jmp    6eb <flush+0x7a>
+
+000006fb <bufreset>:
+
+static void
+bufreset(int fd)
+{
+  if(fd >= 0 && fd < NOBUF){
+     6fb:	83 f8 0f             	cmp    $0xf,%eax
+     6fe:	76 01                	jbe    701 <bufreset+0x6>
+     700:	c3                   	ret
+{
+     701:	55                   	push   %ebp
+     702:	89 e5                	mov    %esp,%ebp
+     704:	53                   	push   %ebx
+     705:	83 ec 10             	sub    $0x10,%esp
+     708:	89 c3                	mov    %eax,%ebx
+    flush(fd);
+     70a:	50                   	push   %eax
+     70b:	e8 61 ff ff ff       	call   671 <flush>
+    obuf[fd].mode = BUNKNOWN;
+     710:	69 db 08 02 00 00    	imul   $0x208,%ebx,%ebx
+     716:	c7 83 20 1c 00 00 00 	movl   $0x0,0x1c20(%ebx)
+     71d:	00 00 00 
+     720:	83 c4 10             	add    $0x10,%esp
+  }
+}
+     723:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     726:	c9                   	leave
+     727:	c3                   	ret
+
+00000728 <bufwrite>:
+
+// Write n bytes from p to fd, through its buffer.
+// Returns n, or -1 if a write fails.
+int
+bufwrite(int fd, const void *p, int n)
+{
+     728:	55                   	push   %ebp
+     729:	89 e5                	mov    %esp,%ebp
+     72b:	57                   	push   %edi
+     72c:	56                   	push   %esi
+     72d:	53                   	push   %ebx
+     72e:	83 ec 3c             	sub    $0x3c,%esp
+     731:	8b 75 08             	mov    0x8(%ebp),%esi
+     734:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct stat st;
+  const char *s;
+  int i;
+
+  if(fd < 0 || fd >= NOBUF)
+     737:	83 fe 0f             	cmp    $0xf,%esi
+     73a:	0f 87 a2 00 00 00    	ja     7e2 <bufwrite+0xba>
+    return write(fd, p, n);
+  if(obuf[fd].mode == BUNKNOWN){
+     740:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     746:	83 b8 20 1c 00 00 00 	cmpl   $0x0,0x1c20(%eax)
+     74d:	75 19                	jne    768 <bufwrite+0x40>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     74f:	83 fe 02             	cmp    $0x2,%esi
+     752:	0f 85 9c 00 00 00    	jne    7f4 <bufwrite+0xcc>
+      obuf[fd].mode = BNONE;
+     758:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     75e:	c7 80 20 1c 00 00 01 	movl   $0x1,0x1c20(%eax)
+     765:	00 00 00 
+    else
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+  }
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     768:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     76e:	89 da                	mov    %ebx,%edx
+     770:	03 90 24 1c 00 00    	add    0x1c24(%eax),%edx
+     776:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+     77c:	0f 8f ae 00 00 00    	jg     830 <bufwrite+0x108>
+    return -1;
+  if(n >= OBUFSZ)
+     782:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+     788:	0f 8f bd 00 00 00    	jg     84b <bufwrite+0x123>
+    return write(fd, p, n);
+  memmove(obuf[fd].buf + obuf[fd].n, p, n);
+     78e:	69 d6 08 02 00 00    	imul   $0x208,%esi,%edx
+     794:	8d ba 20 1c 00 00    	lea    0x1c20(%edx),%edi
+     79a:	8b 82 24 1c 00 00    	mov    0x1c24(%edx),%eax
+     7a0:	83 ec 04             	sub    $0x4,%esp
+     7a3:	53                   	push   %ebx
+     7a4:	ff 75 0c             	push   0xc(%ebp)
+     7a7:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     7aa:	8d 84 10 28 1c 00 00 	lea    0x1c28(%eax,%edx,1),%eax
+     7b1:	50                   	push   %eax
+     7b2:	e8 4c fd ff ff       	call   503 <memmove>
+  obuf[fd].n += n;
+     7b7:	01 5f 04             	add    %ebx,0x4(%edi)
+  if(obuf[fd].mode == BNONE)
+     7ba:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     7bd:	8b 82 20 1c 00 00    	mov    0x1c20(%edx),%eax
+     7c3:	83 c4 10             	add    $0x10,%esp
+     7c6:	83 f8 01             	cmp    $0x1,%eax
+     7c9:	0f 84 91 00 00 00    	je     860 <bufwrite+0x138>
+    return flush(fd) < 0 ? -1 : n;
+  if(obuf[fd].mode == BLINE)
+     7cf:	83 f8 02             	cmp    $0x2,%eax
+     7d2:	0f 84 ca 00 00 00    	je     8a2 <bufwrite+0x17a>
+    for(s = p, i = 0; i < n; i++)
+      if(s[i] == '\n')
+        return flush(fd) < 0 ? -1 : n;
+  return n;
+     7d8:	89 d8                	mov    %ebx,%eax
+}
+     7da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     7dd:	5b                   	pop    %ebx
+     7de:	5e                   	pop    %esi
+     7df:	5f                   	pop    %edi
+     7e0:	5d                   	pop    %ebp
+     7e1:	c3                   	ret
+    return write(fd, p, n);
+     7e2:	83 ec 04             	sub    $0x4,%esp
+     7e5:	53                   	push   %ebx
+     7e6:	ff 75 0c             	push   0xc(%ebp)
+     7e9:	56                   	push   %esi
+     7ea:	e8 18 02 00 00       	call   a07 <write>
+     7ef:	83 c4 10             	add    $0x10,%esp
+     7f2:	eb e6                	jmp    7da <bufwrite+0xb2>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     7f4:	83 ec 08             	sub    $0x8,%esp
+     7f7:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     7fa:	50                   	push   %eax
+     7fb:	56                   	push   %esi
+     7fc:	e8 51 02 00 00       	call   a52 <fstat>
+     801:	83 c4 10             	add    $0x10,%esp
+     804:	85 c0                	test   %eax,%eax
+     806:	0f 88 4c ff ff ff    	js     758 <bufwrite+0x30>
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+     80c:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     811:	74 16                	je     829 <bufwrite+0x101>
+     813:	ba 03 00 00 00       	mov    $0x3,%edx
+     818:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     81e:	89 90 20 1c 00 00    	mov    %edx,0x1c20(%eax)
+     824:	e9 3f ff ff ff       	jmp    768 <bufwrite+0x40>
+     829:	ba 02 00 00 00       	mov    $0x2,%edx
+     82e:	eb e8                	jmp    818 <bufwrite+0xf0>
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     830:	83 ec 0c             	sub    $0xc,%esp
+     833:	56                   	push   %esi
+     834:	e8 38 fe ff ff       	call   671 <flush>
+     839:	83 c4 10             	add    $0x10,%esp
+     83c:	85 c0                	test   %eax,%eax
+     83e:	0f 89 3e ff ff ff    	jns    782 <bufwrite+0x5a>
+    return -1;
+     844:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     849:	eb 8f                	jmp    7da <bufwrite+0xb2>
+    return write(fd, p, n);
+     84b:	83 ec 04             	sub    $0x4,%esp
+     84e:	53                   	push   %ebx
+     84f:	ff 75 0c             	push   0xc(%ebp)
+     852:	56                   	push   %esi
+     853:	e8 af 01 00 00       	call   a07 <write>
+     858:	83 c4 10             	add    $0x10,%esp
+     85b:	e9 7a ff ff ff       	jmp    7da <bufwrite+0xb2>
+    return flush(fd) < 0 ? -1 : n;
+     860:	83 ec 0c             	sub    $0xc,%esp
+     863:	56                   	push   %esi
+     864:	e8 08 fe ff ff       	call   671 <flush>
+     869:	83 c4 10             	add    $0x10,%esp
+     86c:	85 c0                	test   %eax,%eax
+     86e:	78 07                	js     877 <bufwrite+0x14f>
+     870:	89 d8                	mov    %ebx,%eax
+     872:	e9 63 ff ff ff       	jmp    7da <bufwrite+0xb2>
+     877:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     87c:	e9 59 ff ff ff       	jmp    7da <bufwrite+0xb2>
+        return flush(fd) < 0 ? -1 : n;
+     881:	83 ec 0c             	sub    $0xc,%esp
+     884:	56                   	push   %esi
+     885:	e8 e7 fd ff ff       	call   671 <flush>
+     88a:	83 c4 10             	add    $0x10,%esp
+     88d:	85 c0                	test   %eax,%eax
+     88f:	78 07                	js     898 <bufwrite+0x170>
+     891:	89 d8                	mov    %ebx,%eax
+     893:	e9 42 ff ff ff       	jmp    7da <bufwrite+0xb2>
+     898:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     89d:	e9 38 ff ff ff       	jmp    7da <bufwrite+0xb2>
+    for(s = p, i = 0; i < n; i++)
+     8a2:	b8 00 00 00 00       	mov    $0x0,%eax
+     8a7:	39 d8                	cmp    %ebx,%eax
+     8a9:	7d 0e                	jge    8b9 <bufwrite+0x191>
+      if(s[i] == '\n')
+     8ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     8ae:	80 3c 01 0a          	cmpb   $0xa,(%ecx,%eax,1)
+     8b2:	74 cd                	je     881 <bufwrite+0x159>
+    for(s = p, i = 0; i < n; i++)
+     8b4:	83 c0 01             	add    $0x1,%eax
+     8b7:	eb ee                	jmp    8a7 <bufwrite+0x17f>
+  return n;
+     8b9:	89 d8                	mov    %ebx,%eax
+     8bb:	e9 1a ff ff ff       	jmp    7da <bufwrite+0xb2>
+
+000008c0 <fork>:
+
+int
+fork(void)
+{
+     8c0:	55                   	push   %ebp
+     8c1:	89 e5                	mov    %esp,%ebp
+     8c3:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     8c6:	6a ff                	push   $0xffffffff
+     8c8:	e8 a4 fd ff ff       	call   671 <flush>
+  return _fork();
+     8cd:	e8 bd 00 00 00       	call   98f <_fork>
+}
+     8d2:	c9                   	leave
+     8d3:	c3                   	ret
+
+000008d4 <exit>:
+
+int
+exit(void)
+{
+     8d4:	55                   	push   %ebp
+     8d5:	89 e5                	mov    %esp,%ebp
+     8d7:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     8da:	6a ff                	push   $0xffffffff
+     8dc:	e8 90 fd ff ff       	call   671 <flush>
+  _exit();
+     8e1:	e8 b8 00 00 00       	call   99e <_exit>
+
+000008e6 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     8e6:	55                   	push   %ebp
+     8e7:	89 e5                	mov    %esp,%ebp
+     8e9:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     8ec:	6a ff                	push   $0xffffffff
+     8ee:	e8 7e fd ff ff       	call   671 <flush>
+  return _exec(path, argv);
+     8f3:	83 c4 08             	add    $0x8,%esp
+     8f6:	ff 75 0c             	push   0xc(%ebp)
+     8f9:	ff 75 08             	push   0x8(%ebp)
+     8fc:	e8 bb 00 00 00       	call   9bc <_exec>
+}
+     901:	c9                   	leave
+     902:	c3                   	ret
+
+00000903 <close>:
+
+int
+close(int fd)
+{
+     903:	55                   	push   %ebp
+     904:	89 e5                	mov    %esp,%ebp
+     906:	53                   	push   %ebx
+     907:	83 ec 04             	sub    $0x4,%esp
+     90a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bufreset(fd);
+     90d:	89 d8                	mov    %ebx,%eax
+     90f:	e8 e7 fd ff ff       	call   6fb <bufreset>
+  return _close(fd);
+     914:	83 ec 0c             	sub    $0xc,%esp
+     917:	53                   	push   %ebx
+     918:	e8 90 00 00 00       	call   9ad <_close>
+}
+     91d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     920:	c9                   	leave
+     921:	c3                   	ret
+
+00000922 <stat>:
+{
+     922:	55                   	push   %ebp
+     923:	89 e5                	mov    %esp,%ebp
+     925:	56                   	push   %esi
+     926:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     927:	83 ec 08             	sub    $0x8,%esp
+     92a:	6a 00                	push   $0x0
+     92c:	ff 75 08             	push   0x8(%ebp)
+     92f:	e8 f1 00 00 00       	call   a25 <open>
+  if(fd < 0)
+     934:	83 c4 10             	add    $0x10,%esp
+     937:	85 c0                	test   %eax,%eax
+     939:	78 24                	js     95f <stat+0x3d>
+     93b:	89 c3                	mov    %eax,%ebx
+  r = fstat(fd, st);
+     93d:	83 ec 08             	sub    $0x8,%esp
+     940:	ff 75 0c             	push   0xc(%ebp)
+     943:	50                   	push   %eax
+     944:	e8 09 01 00 00       	call   a52 <fstat>
+     949:	89 c6                	mov    %eax,%esi
+  close(fd);
+     94b:	89 1c 24             	mov    %ebx,(%esp)
+     94e:	e8 b0 ff ff ff       	call   903 <close>
+  return r;
+     953:	83 c4 10             	add    $0x10,%esp
+}
+     956:	89 f0                	mov    %esi,%eax
+     958:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     95b:	5b                   	pop    %ebx
+     95c:	5e                   	pop    %esi
+     95d:	5d                   	pop    %ebp
+     95e:	c3                   	ret
+    return -1;
+     95f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     964:	eb f0                	jmp    956 <stat+0x34>
+
+00000966 <dup2>:
+
+int
+dup2(int oldfd, int newfd)
+{
+     966:	55                   	push   %ebp
+     967:	89 e5                	mov    %esp,%ebp
+     969:	56                   	push   %esi
+     96a:	53                   	push   %ebx
+     96b:	8b 75 08             	mov    0x8(%ebp),%esi
+     96e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(oldfd != newfd)
+     971:	39 de                	cmp    %ebx,%esi
+     973:	75 11                	jne    986 <dup2+0x20>
+    bufreset(newfd);
+  return _dup2(oldfd, newfd);
+     975:	83 ec 08             	sub    $0x8,%esp
+     978:	53                   	push   %ebx
+     979:	56                   	push   %esi
+     97a:	e8 4c 00 00 00       	call   9cb <_dup2>
+}
+     97f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     982:	5b                   	pop    %ebx
+     983:	5e                   	pop    %esi
+     984:	5d                   	pop    %ebp
+     985:	c3                   	ret
+    bufreset(newfd);
+     986:	89 d8                	mov    %ebx,%eax
+     988:	e8 6e fd ff ff       	call   6fb <bufreset>
+     98d:	eb e6                	jmp    975 <dup2+0xf>
+
+0000098f <_fork>:
+  1: ret
+
+#define SYSCALL(name) STUB(name, SYS_ ## name)
+
+# ulib.c wraps these, to flush printf()'s buffers first.
+STUB(_fork, SYS_fork)
+     98f:	b8 01 00 00 00       	mov    $0x1,%eax
+     994:	89 e1                	mov    %esp,%ecx
+     996:	ba 9d 09 00 00       	mov    $0x99d,%edx
+     99b:	0f 34                	sysenter
+     99d:	c3                   	ret
+
+0000099e <_exit>:
+STUB(_exit, SYS_exit)
+     99e:	b8 02 00 00 00       	mov    $0x2,%eax
+     9a3:	89 e1                	mov    %esp,%ecx
+     9a5:	ba ac 09 00 00       	mov    $0x9ac,%edx
+     9aa:	0f 34                	sysenter
+     9ac:	c3                   	ret
+
+000009ad <_close>:
+STUB(_close, SYS_close)
+     9ad:	b8 15 00 00 00       	mov    $0x15,%eax
+     9b2:	89 e1                	mov    %esp,%ecx
+     9b4:	ba bb 09 00 00       	mov    $0x9bb,%edx
+     9b9:	0f 34                	sysenter
+     9bb:	c3                   	ret
+
+000009bc <_exec>:
+STUB(_exec, SYS_exec)
+     9bc:	b8 07 00 00 00       	mov    $0x7,%eax
+     9c1:	89 e1                	mov    %esp,%ecx
+     9c3:	ba ca 09 00 00       	mov    $0x9ca,%edx
+     9c8:	0f 34                	sysenter
+     9ca:	c3                   	ret
+
+000009cb <_dup2>:
+STUB(_dup2, SYS_dup2)
+     9cb:	b8 17 00 00 00       	mov    $0x17,%eax
+     9d0:	89 e1                	mov    %esp,%ecx
+     9d2:	ba d9 09 00 00       	mov    $0x9d9,%edx
+     9d7:	0f 34                	sysenter
+     9d9:	c3                   	ret
+
+000009da <wait>:
+
+SYSCALL(wait)
+     9da:	b8 03 00 00 00       	mov    $0x3,%eax
+     9df:	89 e1                	mov    %esp,%ecx
+     9e1:	ba e8 09 00 00       	mov    $0x9e8,%edx
+     9e6:	0f 34                	sysenter
+     9e8:	c3                   	ret
+
+000009e9 <pipe>:
+SYSCALL(pipe)
+     9e9:	b8 04 00 00 00       	mov    $0x4,%eax
+     9ee:	89 e1                	mov    %esp,%ecx
+     9f0:	ba f7 09 00 00       	mov    $0x9f7,%edx
+     9f5:	0f 34                	sysenter
+     9f7:	c3                   	ret
+
+000009f8 <read>:
+SYSCALL(read)
+     9f8:	b8 05 00 00 00       	mov    $0x5,%eax
+     9fd:	89 e1                	mov    %esp,%ecx
+     9ff:	ba 06 0a 00 00       	mov    $0xa06,%edx
+     a04:	0f 34                	sysenter
+     a06:	c3                   	ret
+
+00000a07 <write>:
+SYSCALL(write)
+     a07:	b8 10 00 00 00       	mov    $0x10,%eax
+     a0c:	89 e1                	mov    %esp,%ecx
+     a0e:	ba 15 0a 00 00       	mov    $0xa15,%edx
+     a13:	0f 34                	sysenter
+     a15:	c3                   	ret
+
+00000a16 <kill>:
+SYSCALL(kill)
+     a16:	b8 06 00 00 00       	mov    $0x6,%eax
+     a1b:	89 e1                	mov    %esp,%ecx
+     a1d:	ba 24 0a 00 00       	mov    $0xa24,%edx
+     a22:	0f 34                	sysenter
+     a24:	c3                   	ret
+
+00000a25 <open>:
+SYSCALL(open)
+     a25:	b8 0f 00 00 00       	mov    $0xf,%eax
+     a2a:	89 e1                	mov    %esp,%ecx
+     a2c:	ba 33 0a 00 00       	mov    $0xa33,%edx
+     a31:	0f 34                	sysenter
+     a33:	c3                   	ret
+
+00000a34 <mknod>:
+SYSCALL(mknod)
+     a34:	b8 11 00 00 00       	mov    $0x11,%eax
+     a39:	89 e1                	mov    %esp,%ecx
+     a3b:	ba 42 0a 00 00       	mov    $0xa42,%edx
+     a40:	0f 34                	sysenter
+     a42:	c3                   	ret
+
+00000a43 <unlink>:
+SYSCALL(unlink)
+     a43:	b8 12 00 00 00       	mov    $0x12,%eax
+     a48:	89 e1                	mov    %esp,%ecx
+     a4a:	ba 51 0a 00 00       	mov    $0xa51,%edx
+     a4f:	0f 34                	sysenter
+     a51:	c3                   	ret
+
+00000a52 <fstat>:
+SYSCALL(fstat)
+     a52:	b8 08 00 00 00       	mov    $0x8,%eax
+     a57:	89 e1                	mov    %esp,%ecx
+     a59:	ba 60 0a 00 00       	mov    $0xa60,%edx
+     a5e:	0f 34                	sysenter
+     a60:	c3                   	ret
+
+00000a61 <link>:
+SYSCALL(link)
+     a61:	b8 13 00 00 00       	mov    $0x13,%eax
+     a66:	89 e1                	mov    %esp,%ecx
+     a68:	ba 6f 0a 00 00       	mov    $0xa6f,%edx
+     a6d:	0f 34                	sysenter
+     a6f:	c3                   	ret
+
+00000a70 <mkdir>:
+SYSCALL(mkdir)
+     a70:	b8 14 00 00 00       	mov    $0x14,%eax
+     a75:	89 e1                	mov    %esp,%ecx
+     a77:	ba 7e 0a 00 00       	mov    $0xa7e,%edx
+     a7c:	0f 34                	sysenter
+     a7e:	c3                   	ret
+
+00000a7f <chdir>:
+SYSCALL(chdir)
+     a7f:	b8 09 00 00 00       	mov    $0x9,%eax
+     a84:	89 e1                	mov    %esp,%ecx
+     a86:	ba 8d 0a 00 00       	mov    $0xa8d,%edx
+     a8b:	0f 34                	sysenter
+     a8d:	c3                   	ret
+
+00000a8e <dup>:
+SYSCALL(dup)
+     a8e:	b8 0a 00 00 00       	mov    $0xa,%eax
+     a93:	89 e1                	mov    %esp,%ecx
+     a95:	ba 9c 0a 00 00       	mov    $0xa9c,%edx
+     a9a:	0f 34                	sysenter
+     a9c:	c3                   	ret
+
+00000a9d <getpid>:
+SYSCALL(getpid)
+     a9d:	b8 0b 00 00 00       	mov    $0xb,%eax
+     aa2:	89 e1                	mov    %esp,%ecx
+     aa4:	ba ab 0a 00 00       	mov    $0xaab,%edx
+     aa9:	0f 34                	sysenter
+     aab:	c3                   	ret
+
+00000aac <sbrk>:
+SYSCALL(sbrk)
+     aac:	b8 0c 00 00 00       	mov    $0xc,%eax
+     ab1:	89 e1                	mov    %esp,%ecx
+     ab3:	ba ba 0a 00 00       	mov    $0xaba,%edx
+     ab8:	0f 34                	sysenter
+     aba:	c3                   	ret
+
+00000abb <sleep>:
+SYSCALL(sleep)
+     abb:	b8 0d 00 00 00       	mov    $0xd,%eax
+     ac0:	89 e1                	mov    %esp,%ecx
+     ac2:	ba c9 0a 00 00       	mov    $0xac9,%edx
+     ac7:	0f 34                	sysenter
+     ac9:	c3                   	ret
+
+00000aca <uptime>:
+SYSCALL(uptime)
+     aca:	b8 0e 00 00 00       	mov    $0xe,%eax
+     acf:	89 e1                	mov    %esp,%ecx
+     ad1:	ba d8 0a 00 00       	mov    $0xad8,%edx
+     ad6:	0f 34                	sysenter
+     ad8:	c3                   	ret
+
+00000ad9 <date>:
+SYSCALL(date)
+     ad9:	b8 16 00 00 00       	mov    $0x16,%eax
+     ade:	89 e1                	mov    %esp,%ecx
+     ae0:	ba e7 0a 00 00       	mov    $0xae7,%edx
+     ae5:	0f 34                	sysenter
+     ae7:	c3                   	ret
+
+00000ae8 <faultaround>:
+SYSCALL(faultaround)
+     ae8:	b8 18 00 00 00       	mov    $0x18,%eax
+     aed:	89 e1                	mov    %esp,%ecx
+     aef:	ba f6 0a 00 00       	mov    $0xaf6,%edx
+     af4:	0f 34                	sysenter
+     af6:	c3                   	ret
+
+00000af7 <faultstat>:
+SYSCALL(faultstat)
+     af7:	b8 19 00 00 00       	mov    $0x19,%eax
+     afc:	89 e1                	mov    %esp,%ecx
+     afe:	ba 05 0b 00 00       	mov    $0xb05,%edx
+     b03:	0f 34                	sysenter
+     b05:	c3                   	ret
+
+00000b06 <mmap>:
+SYSCALL(mmap)
+     b06:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     b0b:	89 e1                	mov    %esp,%ecx
+     b0d:	ba 14 0b 00 00       	mov    $0xb14,%edx
+     b12:	0f 34                	sysenter
+     b14:	c3                   	ret
+
+00000b15 <munmap>:
+SYSCALL(munmap)
+     b15:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     b1a:	89 e1                	mov    %esp,%ecx
+     b1c:	ba 23 0b 00 00       	mov    $0xb23,%edx
+     b21:	0f 34                	sysenter
+     b23:	c3                   	ret
+
+00000b24 <largepages>:
+SYSCALL(largepages)
+     b24:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     b29:	89 e1                	mov    %esp,%ecx
+     b2b:	ba 32 0b 00 00       	mov    $0xb32,%edx
+     b30:	0f 34                	sysenter
+     b32:	c3                   	ret
+
+00000b33 <spawn>:
+SYSCALL(spawn)
+     b33:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     b38:	89 e1                	mov    %esp,%ecx
+     b3a:	ba 41 0b 00 00       	mov    $0xb41,%edx
+     b3f:	0f 34                	sysenter
+     b41:	c3                   	ret
+
+00000b42 <setpriority>:
+SYSCALL(setpriority)
+     b42:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     b47:	89 e1                	mov    %esp,%ecx
+     b49:	ba 50 0b 00 00       	mov    $0xb50,%edx
+     b4e:	0f 34                	sysenter
+     b50:	c3                   	ret
+
+00000b51 <getpriority>:
+SYSCALL(getpriority)
+     b51:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     b56:	89 e1                	mov    %esp,%ecx
+     b58:	ba 5f 0b 00 00       	mov    $0xb5f,%edx
+     b5d:	0f 34                	sysenter
+     b5f:	c3                   	ret
+
+00000b60 <getprocinfo>:
+SYSCALL(getprocinfo)
+     b60:	b8 20 00 00 00       	mov    $0x20,%eax
+     b65:	89 e1                	mov    %esp,%ecx
+     b67:	ba 6e 0b 00 00       	mov    $0xb6e,%edx
+     b6c:	0f 34                	sysenter
+     b6e:	c3                   	ret
+
+00000b6f <getcpuinfo>:
+SYSCALL(getcpuinfo)
+     b6f:	b8 21 00 00 00       	mov    $0x21,%eax
+     b74:	89 e1                	mov    %esp,%ecx
+     b76:	ba 7d 0b 00 00       	mov    $0xb7d,%edx
+     b7b:	0f 34                	sysenter
+     b7d:	c3                   	ret
+
+00000b7e <clone>:
+SYSCALL(clone)
+     b7e:	b8 22 00 00 00       	mov    $0x22,%eax
+     b83:	89 e1                	mov    %esp,%ecx
+     b85:	ba 8c 0b 00 00       	mov    $0xb8c,%edx
+     b8a:	0f 34                	sysenter
+     b8c:	c3                   	ret
+
+00000b8d <join>:
+SYSCALL(join)
+     b8d:	b8 23 00 00 00       	mov    $0x23,%eax
+     b92:	89 e1                	mov    %esp,%ecx
+     b94:	ba 9b 0b 00 00       	mov    $0xb9b,%edx
+     b99:	0f 34                	sysenter
+     b9b:	c3                   	ret
+
+00000b9c <futex_wait>:
+SYSCALL(futex_wait)
+     b9c:	b8 24 00 00 00       	mov    $0x24,%eax
+     ba1:	89 e1                	mov    %esp,%ecx
+     ba3:	ba aa 0b 00 00       	mov    $0xbaa,%edx
+     ba8:	0f 34                	sysenter
+     baa:	c3                   	ret
+
+00000bab <futex_wake>:
+SYSCALL(futex_wake)
+     bab:	b8 25 00 00 00       	mov    $0x25,%eax
+     bb0:	89 e1                	mov    %esp,%ecx
+     bb2:	ba b9 0b 00 00       	mov    $0xbb9,%edx
+     bb7:	0f 34                	sysenter
+     bb9:	c3                   	ret
+
+00000bba <setaffinity>:
+SYSCALL(setaffinity)
+     bba:	b8 26 00 00 00       	mov    $0x26,%eax
+     bbf:	89 e1                	mov    %esp,%ecx
+     bc1:	ba c8 0b 00 00       	mov    $0xbc8,%edx
+     bc6:	0f 34                	sysenter
+     bc8:	c3                   	ret
+
+00000bc9 <getaffinity>:
+SYSCALL(getaffinity)
+     bc9:	b8 27 00 00 00       	mov    $0x27,%eax
+     bce:	89 e1                	mov    %esp,%ecx
+     bd0:	ba d7 0b 00 00       	mov    $0xbd7,%edx
+     bd5:	0f 34                	sysenter
+     bd7:	c3                   	ret
+
+00000bd8 <clock_gettime>:
+SYSCALL(clock_gettime)
+     bd8:	b8 28 00 00 00       	mov    $0x28,%eax
+     bdd:	89 e1                	mov    %esp,%ecx
+     bdf:	ba e6 0b 00 00       	mov    $0xbe6,%edx
+     be4:	0f 34                	sysenter
+     be6:	c3                   	ret
+
+00000be7 <msleep>:
+SYSCALL(msleep)
+     be7:	b8 29 00 00 00       	mov    $0x29,%eax
+     bec:	89 e1                	mov    %esp,%ecx
+     bee:	ba f5 0b 00 00       	mov    $0xbf5,%edx
+     bf3:	0f 34                	sysenter
+     bf5:	c3                   	ret
+
+00000bf6 <lockstat>:
+SYSCALL(lockstat)
+     bf6:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     bfb:	89 e1                	mov    %esp,%ecx
+     bfd:	ba 04 0c 00 00       	mov    $0xc04,%edx
+     c02:	0f 34                	sysenter
+     c04:	c3                   	ret
+
+00000c05 <bstat>:
+SYSCALL(bstat)
+     c05:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     c0a:	89 e1                	mov    %esp,%ecx
+     c0c:	ba 13 0c 00 00       	mov    $0xc13,%edx
+     c11:	0f 34                	sysenter
+     c13:	c3                   	ret
+
+00000c14 <iostat>:
+SYSCALL(iostat)
+     c14:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     c19:	89 e1                	mov    %esp,%ecx
+     c1b:	ba 22 0c 00 00       	mov    $0xc22,%edx
+     c20:	0f 34                	sysenter
+     c22:	c3                   	ret
+
+00000c23 <fsync>:
+SYSCALL(fsync)
+     c23:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     c28:	89 e1                	mov    %esp,%ecx
+     c2a:	ba 31 0c 00 00       	mov    $0xc31,%edx
+     c2f:	0f 34                	sysenter
+     c31:	c3                   	ret
+
+00000c32 <pread>:
+SYSCALL(pread)
+     c32:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     c37:	89 e1                	mov    %esp,%ecx
+     c39:	ba 40 0c 00 00       	mov    $0xc40,%edx
+     c3e:	0f 34                	sysenter
+     c40:	c3                   	ret
+
+00000c41 <pwrite>:
+SYSCALL(pwrite)
+     c41:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     c46:	89 e1                	mov    %esp,%ecx
+     c48:	ba 4f 0c 00 00       	mov    $0xc4f,%edx
+     c4d:	0f 34                	sysenter
+     c4f:	c3                   	ret
+
+00000c50 <readv>:
+SYSCALL(readv)
+     c50:	b8 30 00 00 00       	mov    $0x30,%eax
+     c55:	89 e1                	mov    %esp,%ecx
+     c57:	ba 5e 0c 00 00       	mov    $0xc5e,%edx
+     c5c:	0f 34                	sysenter
+     c5e:	c3                   	ret
+
+00000c5f <writev>:
+SYSCALL(writev)
+     c5f:	b8 31 00 00 00       	mov    $0x31,%eax
+     c64:	89 e1                	mov    %esp,%ecx
+     c66:	ba 6d 0c 00 00       	mov    $0xc6d,%edx
+     c6b:	0f 34                	sysenter
+     c6d:	c3                   	ret
+
+00000c6e <sendfile>:
+SYSCALL(sendfile)
+     c6e:	b8 32 00 00 00       	mov    $0x32,%eax
+     c73:	89 e1                	mov    %esp,%ecx
+     c75:	ba 7c 0c 00 00       	mov    $0xc7c,%edx
+     c7a:	0f 34                	sysenter
+     c7c:	c3                   	ret
+
+00000c7d <fcntl>:
+SYSCALL(fcntl)
+     c7d:	b8 33 00 00 00       	mov    $0x33,%eax
+     c82:	89 e1                	mov    %esp,%ecx
+     c84:	ba 8b 0c 00 00       	mov    $0xc8b,%edx
+     c89:	0f 34                	sysenter
+     c8b:	c3                   	ret
+
+00000c8c <mount>:
+SYSCALL(mount)
+     c8c:	b8 34 00 00 00       	mov    $0x34,%eax
+     c91:	89 e1                	mov    %esp,%ecx
+     c93:	ba 9a 0c 00 00       	mov    $0xc9a,%edx
+     c98:	0f 34                	sysenter
+     c9a:	c3                   	ret
+
+00000c9b <getdents>:
+SYSCALL(getdents)
+     c9b:	b8 35 00 00 00       	mov    $0x35,%eax
+     ca0:	89 e1                	mov    %esp,%ecx
+     ca2:	ba a9 0c 00 00       	mov    $0xca9,%edx
+     ca7:	0f 34                	sysenter
+     ca9:	c3                   	ret
+
+00000caa <fstatat>:
+SYSCALL(fstatat)
+     caa:	b8 36 00 00 00       	mov    $0x36,%eax
+     caf:	89 e1                	mov    %esp,%ecx
+     cb1:	ba b8 0c 00 00       	mov    $0xcb8,%edx
+     cb6:	0f 34                	sysenter
+     cb8:	c3                   	ret
+
+00000cb9 <sysstat>:
+SYSCALL(sysstat)
+     cb9:	b8 37 00 00 00       	mov    $0x37,%eax
+     cbe:	89 e1                	mov    %esp,%ecx
+     cc0:	ba c7 0c 00 00       	mov    $0xcc7,%edx
+     cc5:	0f 34                	sysenter
+     cc7:	c3                   	ret
+
+00000cc8 <ringenter>:
+SYSCALL(ringenter)
+     cc8:	b8 38 00 00 00       	mov    $0x38,%eax
+     ccd:	89 e1                	mov    %esp,%ecx
+     ccf:	ba d6 0c 00 00       	mov    $0xcd6,%edx
+     cd4:	0f 34                	sysenter
+     cd6:	c3                   	ret
+
+00000cd7 <trace>:
+SYSCALL(trace)
+     cd7:	b8 39 00 00 00       	mov    $0x39,%eax
+     cdc:	89 e1                	mov    %esp,%ecx
+     cde:	ba e5 0c 00 00       	mov    $0xce5,%edx
+     ce3:	0f 34                	sysenter
+     ce5:	c3                   	ret
+
+00000ce6 <memstat>:
+SYSCALL(memstat)
+     ce6:	b8 3a 00 00 00       	mov    $0x3a,%eax
+     ceb:	89 e1                	mov    %esp,%ecx
+     ced:	ba f4 0c 00 00       	mov    $0xcf4,%edx
+     cf2:	0f 34                	sysenter
+     cf4:	c3                   	ret
+
+00000cf5 <shmget>:
+SYSCALL(shmget)
+     cf5:	b8 3b 00 00 00       	mov    $0x3b,%eax
+     cfa:	89 e1                	mov    %esp,%ecx
+     cfc:	ba 03 0d 00 00       	mov    $0xd03,%edx
+     d01:	0f 34                	sysenter
+     d03:	c3                   	ret
+
+00000d04 <shmat>:
+SYSCALL(shmat)
+     d04:	b8 3c 00 00 00       	mov    $0x3c,%eax
+     d09:	89 e1                	mov    %esp,%ecx
+     d0b:	ba 12 0d 00 00       	mov    $0xd12,%edx
+     d10:	0f 34                	sysenter
+     d12:	c3                   	ret
+
+00000d13 <shmdt>:
+SYSCALL(shmdt)
+     d13:	b8 3d 00 00 00       	mov    $0x3d,%eax
+     d18:	89 e1                	mov    %esp,%ecx
+     d1a:	ba 21 0d 00 00       	mov    $0xd21,%edx
+     d1f:	0f 34                	sysenter
+     d21:	c3                   	ret
+
+00000d22 <irqstat>:
+SYSCALL(irqstat)
+     d22:	b8 3e 00 00 00       	mov    $0x3e,%eax
+     d27:	89 e1                	mov    %esp,%ecx
+     d29:	ba 30 0d 00 00       	mov    $0xd30,%edx
+     d2e:	0f 34                	sysenter
+     d30:	c3                   	ret
+
+00000d31 <irqroute>:
+SYSCALL(irqroute)
+     d31:	b8 3f 00 00 00       	mov    $0x3f,%eax
+     d36:	89 e1                	mov    %esp,%ecx
+     d38:	ba 3f 0d 00 00       	mov    $0xd3f,%edx
+     d3d:	0f 34                	sysenter
+     d3f:	c3                   	ret
+
+00000d40 <putc>:
+  char buf[64];
+};
+
+static void
+putc(struct out *o, char c)
+{
+     d40:	55                   	push   %ebp
+     d41:	89 e5                	mov    %esp,%ebp
+     d43:	56                   	push   %esi
+     d44:	53                   	push   %ebx
+     d45:	89 c3                	mov    %eax,%ebx
+     d47:	89 d6                	mov    %edx,%esi
+  if(o->n == sizeof(o->buf)){
+     d49:	8b 40 04             	mov    0x4(%eax),%eax
+     d4c:	83 f8 40             	cmp    $0x40,%eax
+     d4f:	74 16                	je     d67 <putc+0x27>
+    bufwrite(o->fd, o->buf, o->n);
+    o->n = 0;
+  }
+  o->buf[o->n++] = c;
+     d51:	8b 43 04             	mov    0x4(%ebx),%eax
+     d54:	8d 50 01             	lea    0x1(%eax),%edx
+     d57:	89 53 04             	mov    %edx,0x4(%ebx)
+     d5a:	89 f1                	mov    %esi,%ecx
+     d5c:	88 4c 03 08          	mov    %cl,0x8(%ebx,%eax,1)
+}
+     d60:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d63:	5b                   	pop    %ebx
+     d64:	5e                   	pop    %esi
+     d65:	5d                   	pop    %ebp
+     d66:	c3                   	ret
+    bufwrite(o->fd, o->buf, o->n);
+     d67:	8d 53 08             	lea    0x8(%ebx),%edx
+     d6a:	83 ec 04             	sub    $0x4,%esp
+     d6d:	50                   	push   %eax
+     d6e:	52                   	push   %edx
+     d6f:	ff 33                	push   (%ebx)
+     d71:	e8 b2 f9 ff ff       	call   728 <bufwrite>
+    o->n = 0;
+     d76:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     d7d:	83 c4 10             	add    $0x10,%esp
+     d80:	eb cf                	jmp    d51 <putc+0x11>
+
+00000d82 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     d82:	55                   	push   %ebp
+     d83:	89 e5                	mov    %esp,%ebp
+     d85:	57                   	push   %edi
+     d86:	56                   	push   %esi
+     d87:	53                   	push   %ebx
+     d88:	83 ec 2c             	sub    $0x2c,%esp
+     d8b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     d8e:	89 d0                	mov    %edx,%eax
+     d90:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+     d92:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     d96:	0f 95 c1             	setne  %cl
+     d99:	c1 ea 1f             	shr    $0x1f,%edx
+     d9c:	84 d1                	test   %dl,%cl
+     d9e:	74 44                	je     de4 <printint+0x62>
+    neg = 1;
+    x = -xx;
+     da0:	f7 d8                	neg    %eax
+     da2:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+     da4:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     dab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+     db0:	89 c8                	mov    %ecx,%eax
+     db2:	ba 00 00 00 00       	mov    $0x0,%edx
+     db7:	f7 f6                	div    %esi
+     db9:	89 df                	mov    %ebx,%edi
+     dbb:	83 c3 01             	add    $0x1,%ebx
+     dbe:	0f b6 92 c4 14 00 00 	movzbl 0x14c4(%edx),%edx
+     dc5:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+     dc9:	89 ca                	mov    %ecx,%edx
+     dcb:	89 c1                	mov    %eax,%ecx
+     dcd:	39 f2                	cmp    %esi,%edx
+     dcf:	73 df                	jae    db0 <printint+0x2e>
+  if(neg)
+     dd1:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     dd5:	74 31                	je     e08 <printint+0x86>
+    buf[i++] = '-';
+     dd7:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+     ddc:	8d 5f 02             	lea    0x2(%edi),%ebx
+     ddf:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     de2:	eb 17                	jmp    dfb <printint+0x79>
+    x = xx;
+     de4:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+     de6:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     ded:	eb bc                	jmp    dab <printint+0x29>
+
+  while(--i >= 0)
+    putc(o, buf[i]);
+     def:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+     df4:	89 f0                	mov    %esi,%eax
+     df6:	e8 45 ff ff ff       	call   d40 <putc>
+  while(--i >= 0)
+     dfb:	83 eb 01             	sub    $0x1,%ebx
+     dfe:	79 ef                	jns    def <printint+0x6d>
+}
+     e00:	83 c4 2c             	add    $0x2c,%esp
+     e03:	5b                   	pop    %ebx
+     e04:	5e                   	pop    %esi
+     e05:	5f                   	pop    %edi
+     e06:	5d                   	pop    %ebp
+     e07:	c3                   	ret
+     e08:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     e0b:	eb ee                	jmp    dfb <printint+0x79>
+
+00000e0d <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     e0d:	55                   	push   %ebp
+     e0e:	89 e5                	mov    %esp,%ebp
+     e10:	57                   	push   %edi
+     e11:	56                   	push   %esi
+     e12:	53                   	push   %ebx
+     e13:	83 ec 6c             	sub    $0x6c,%esp
+  int c, i, state;
+  uint *ap;
+  struct out out, *o;
+
+  o = &out;
+  o->fd = fd;
+     e16:	8b 45 08             	mov    0x8(%ebp),%eax
+     e19:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  o->n = 0;
+     e1c:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+     e23:	8d 45 10             	lea    0x10(%ebp),%eax
+     e26:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  state = 0;
+     e29:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+     e2e:	bb 00 00 00 00       	mov    $0x0,%ebx
+     e33:	eb 14                	jmp    e49 <printf+0x3c>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(o, c);
+     e35:	89 fa                	mov    %edi,%edx
+     e37:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     e3a:	e8 01 ff ff ff       	call   d40 <putc>
+     e3f:	eb 05                	jmp    e46 <printf+0x39>
+      }
+    } else if(state == '%'){
+     e41:	83 fe 25             	cmp    $0x25,%esi
+     e44:	74 25                	je     e6b <printf+0x5e>
+  for(i = 0; fmt[i]; i++){
+     e46:	83 c3 01             	add    $0x1,%ebx
+     e49:	8b 45 0c             	mov    0xc(%ebp),%eax
+     e4c:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+     e50:	84 c0                	test   %al,%al
+     e52:	0f 84 20 01 00 00    	je     f78 <printf+0x16b>
+    c = fmt[i] & 0xff;
+     e58:	0f be f8             	movsbl %al,%edi
+     e5b:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     e5e:	85 f6                	test   %esi,%esi
+     e60:	75 df                	jne    e41 <printf+0x34>
+      if(c == '%'){
+     e62:	83 f8 25             	cmp    $0x25,%eax
+     e65:	75 ce                	jne    e35 <printf+0x28>
+        state = '%';
+     e67:	89 c6                	mov    %eax,%esi
+     e69:	eb db                	jmp    e46 <printf+0x39>
+      if(c == 'd'){
+     e6b:	83 f8 25             	cmp    $0x25,%eax
+     e6e:	0f 84 cf 00 00 00    	je     f43 <printf+0x136>
+     e74:	0f 8c dd 00 00 00    	jl     f57 <printf+0x14a>
+     e7a:	83 f8 78             	cmp    $0x78,%eax
+     e7d:	0f 8f d4 00 00 00    	jg     f57 <printf+0x14a>
+     e83:	83 f8 63             	cmp    $0x63,%eax
+     e86:	0f 8c cb 00 00 00    	jl     f57 <printf+0x14a>
+     e8c:	83 e8 63             	sub    $0x63,%eax
+     e8f:	83 f8 15             	cmp    $0x15,%eax
+     e92:	0f 87 bf 00 00 00    	ja     f57 <printf+0x14a>
+     e98:	ff 24 85 6c 14 00 00 	jmp    *0x146c(,%eax,4)
+        printint(o, *ap, 10, 1);
+     e9f:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     ea2:	8b 17                	mov    (%edi),%edx
+     ea4:	83 ec 0c             	sub    $0xc,%esp
+     ea7:	6a 01                	push   $0x1
+     ea9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     eae:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     eb1:	e8 cc fe ff ff       	call   d82 <printint>
+        ap++;
+     eb6:	83 c7 04             	add    $0x4,%edi
+     eb9:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     ebc:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(o, '%');
+        putc(o, c);
+      }
+      state = 0;
+     ebf:	be 00 00 00 00       	mov    $0x0,%esi
+     ec4:	eb 80                	jmp    e46 <printf+0x39>
+        printint(o, *ap, 16, 0);
+     ec6:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     ec9:	8b 17                	mov    (%edi),%edx
+     ecb:	83 ec 0c             	sub    $0xc,%esp
+     ece:	6a 00                	push   $0x0
+     ed0:	b9 10 00 00 00       	mov    $0x10,%ecx
+     ed5:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     ed8:	e8 a5 fe ff ff       	call   d82 <printint>
+        ap++;
+     edd:	83 c7 04             	add    $0x4,%edi
+     ee0:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     ee3:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     ee6:	be 00 00 00 00       	mov    $0x0,%esi
+     eeb:	e9 56 ff ff ff       	jmp    e46 <printf+0x39>
+        s = (char*)*ap;
+     ef0:	8b 45 94             	mov    -0x6c(%ebp),%eax
+     ef3:	8b 30                	mov    (%eax),%esi
+        ap++;
+     ef5:	83 c0 04             	add    $0x4,%eax
+     ef8:	89 45 94             	mov    %eax,-0x6c(%ebp)
+        if(s == 0)
+     efb:	85 f6                	test   %esi,%esi
+     efd:	75 15                	jne    f14 <printf+0x107>
+          s = "(null)";
+     eff:	be 63 14 00 00       	mov    $0x1463,%esi
+     f04:	eb 0e                	jmp    f14 <printf+0x107>
+          putc(o, *s);
+     f06:	0f be d2             	movsbl %dl,%edx
+     f09:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     f0c:	e8 2f fe ff ff       	call   d40 <putc>
+          s++;
+     f11:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+     f14:	0f b6 16             	movzbl (%esi),%edx
+     f17:	84 d2                	test   %dl,%dl
+     f19:	75 eb                	jne    f06 <printf+0xf9>
+      state = 0;
+     f1b:	be 00 00 00 00       	mov    $0x0,%esi
+     f20:	e9 21 ff ff ff       	jmp    e46 <printf+0x39>
+        putc(o, *ap);
+     f25:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     f28:	0f be 17             	movsbl (%edi),%edx
+     f2b:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     f2e:	e8 0d fe ff ff       	call   d40 <putc>
+        ap++;
+     f33:	83 c7 04             	add    $0x4,%edi
+     f36:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+      state = 0;
+     f39:	be 00 00 00 00       	mov    $0x0,%esi
+     f3e:	e9 03 ff ff ff       	jmp    e46 <printf+0x39>
+        putc(o, c);
+     f43:	89 fa                	mov    %edi,%edx
+     f45:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     f48:	e8 f3 fd ff ff       	call   d40 <putc>
+      state = 0;
+     f4d:	be 00 00 00 00       	mov    $0x0,%esi
+     f52:	e9 ef fe ff ff       	jmp    e46 <printf+0x39>
+        putc(o, '%');
+     f57:	ba 25 00 00 00       	mov    $0x25,%edx
+     f5c:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     f5f:	e8 dc fd ff ff       	call   d40 <putc>
+        putc(o, c);
+     f64:	89 fa                	mov    %edi,%edx
+     f66:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     f69:	e8 d2 fd ff ff       	call   d40 <putc>
+      state = 0;
+     f6e:	be 00 00 00 00       	mov    $0x0,%esi
+     f73:	e9 ce fe ff ff       	jmp    e46 <printf+0x39>
+    }
+  }
+  if(o->n > 0)
+     f78:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     f7b:	85 c0                	test   %eax,%eax
+     f7d:	7f 08                	jg     f87 <printf+0x17a>
+    bufwrite(fd, o->buf, o->n);
+}
+     f7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f82:	5b                   	pop    %ebx
+     f83:	5e                   	pop    %esi
+     f84:	5f                   	pop    %edi
+     f85:	5d                   	pop    %ebp
+     f86:	c3                   	ret
+    bufwrite(fd, o->buf, o->n);
+     f87:	83 ec 04             	sub    $0x4,%esp
+     f8a:	50                   	push   %eax
+     f8b:	8d 45 a8             	lea    -0x58(%ebp),%eax
+     f8e:	50                   	push   %eax
+     f8f:	ff 75 08             	push   0x8(%ebp)
+     f92:	e8 91 f7 ff ff       	call   728 <bufwrite>
+     f97:	83 c4 10             	add    $0x10,%esp
+}
+     f9a:	eb e3                	jmp    f7f <printf+0x172>
+
+00000f9c <largefree>:
+  return &b->h;
+}
+
+static void
+largefree(Fblock *b)
+{
+     f9c:	55                   	push   %ebp
+     f9d:	89 e5                	mov    %esp,%ebp
+     f9f:	57                   	push   %edi
+     fa0:	56                   	push   %esi
+     fa1:	53                   	push   %ebx
+     fa2:	83 ec 0c             	sub    $0xc,%esp
+     fa5:	89 c1                	mov    %eax,%ecx
+  Fblock **pp, *p, *prev;
+
+  prev = 0;
+     fa7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     fac:	ba ac 3c 00 00       	mov    $0x3cac,%edx
+     fb1:	eb 05                	jmp    fb8 <largefree+0x1c>
+     fb3:	8d 50 08             	lea    0x8(%eax),%edx
+    prev = p;
+     fb6:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     fb8:	8b 02                	mov    (%edx),%eax
+     fba:	85 c0                	test   %eax,%eax
+     fbc:	74 04                	je     fc2 <largefree+0x26>
+     fbe:	39 c8                	cmp    %ecx,%eax
+     fc0:	72 f1                	jb     fb3 <largefree+0x17>
+  b->next = p;
+     fc2:	89 41 08             	mov    %eax,0x8(%ecx)
+  if(p && (char*)b + b->h.size == (char*)p){
+     fc5:	85 c0                	test   %eax,%eax
+     fc7:	74 09                	je     fd2 <largefree+0x36>
+     fc9:	8b 31                	mov    (%ecx),%esi
+     fcb:	8d 3c 31             	lea    (%ecx,%esi,1),%edi
+     fce:	39 c7                	cmp    %eax,%edi
+     fd0:	74 21                	je     ff3 <largefree+0x57>
+    b->h.size += p->h.size;
+    b->next = p->next;
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+     fd2:	85 db                	test   %ebx,%ebx
+     fd4:	74 09                	je     fdf <largefree+0x43>
+     fd6:	8b 03                	mov    (%ebx),%eax
+     fd8:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+     fdb:	39 ce                	cmp    %ecx,%esi
+     fdd:	74 20                	je     fff <largefree+0x63>
+    prev->h.size += b->h.size;
+    prev->next = b->next;
+  } else
+    *pp = b;
+     fdf:	89 0a                	mov    %ecx,(%edx)
+
+  // Give the top of the heap back.  With threads sharing the
+  // address space sbrk() cannot shrink it; keep the block then.
+  for(pp = &large; (*pp)->next; pp = &(*pp)->next)
+     fe1:	be ac 3c 00 00       	mov    $0x3cac,%esi
+     fe6:	8b 1e                	mov    (%esi),%ebx
+     fe8:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+     fec:	74 1d                	je     100b <largefree+0x6f>
+     fee:	8d 73 08             	lea    0x8(%ebx),%esi
+     ff1:	eb f3                	jmp    fe6 <largefree+0x4a>
+    b->h.size += p->h.size;
+     ff3:	03 30                	add    (%eax),%esi
+     ff5:	89 31                	mov    %esi,(%ecx)
+    b->next = p->next;
+     ff7:	8b 40 08             	mov    0x8(%eax),%eax
+     ffa:	89 41 08             	mov    %eax,0x8(%ecx)
+     ffd:	eb d3                	jmp    fd2 <largefree+0x36>
+    prev->h.size += b->h.size;
+     fff:	03 01                	add    (%ecx),%eax
+    1001:	89 03                	mov    %eax,(%ebx)
+    prev->next = b->next;
+    1003:	8b 41 08             	mov    0x8(%ecx),%eax
+    1006:	89 43 08             	mov    %eax,0x8(%ebx)
+    1009:	eb d6                	jmp    fe1 <largefree+0x45>
+    ;
+  b = *pp;
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+    100b:	89 df                	mov    %ebx,%edi
+    100d:	03 3b                	add    (%ebx),%edi
+    100f:	83 ec 0c             	sub    $0xc,%esp
+    1012:	6a 00                	push   $0x0
+    1014:	e8 93 fa ff ff       	call   aac <sbrk>
+    1019:	83 c4 10             	add    $0x10,%esp
+    101c:	39 c7                	cmp    %eax,%edi
+    101e:	74 08                	je     1028 <largefree+0x8c>
+    *pp = 0;
+}
+    1020:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1023:	5b                   	pop    %ebx
+    1024:	5e                   	pop    %esi
+    1025:	5f                   	pop    %edi
+    1026:	5d                   	pop    %ebp
+    1027:	c3                   	ret
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+    1028:	8b 03                	mov    (%ebx),%eax
+    102a:	f7 d8                	neg    %eax
+    102c:	83 ec 0c             	sub    $0xc,%esp
+    102f:	50                   	push   %eax
+    1030:	e8 77 fa ff ff       	call   aac <sbrk>
+    1035:	83 c4 10             	add    $0x10,%esp
+    1038:	83 f8 ff             	cmp    $0xffffffff,%eax
+    103b:	74 e3                	je     1020 <largefree+0x84>
+    *pp = 0;
+    103d:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+    1043:	eb db                	jmp    1020 <largefree+0x84>
+
+00001045 <more>:
+{
+    1045:	55                   	push   %ebp
+    1046:	89 e5                	mov    %esp,%ebp
+    1048:	56                   	push   %esi
+    1049:	53                   	push   %ebx
+    104a:	89 c6                	mov    %eax,%esi
+  pad = -(uint)sbrk(0) & 7;
+    104c:	83 ec 0c             	sub    $0xc,%esp
+    104f:	6a 00                	push   $0x0
+    1051:	e8 56 fa ff ff       	call   aac <sbrk>
+    1056:	f7 d8                	neg    %eax
+    1058:	89 c3                	mov    %eax,%ebx
+    105a:	83 e3 07             	and    $0x7,%ebx
+  if((p = sbrk(n + pad)) == (char*)-1)
+    105d:	01 de                	add    %ebx,%esi
+    105f:	89 34 24             	mov    %esi,(%esp)
+    1062:	e8 45 fa ff ff       	call   aac <sbrk>
+    1067:	83 c4 10             	add    $0x10,%esp
+    106a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    106d:	74 09                	je     1078 <more+0x33>
+  return p + pad;
+    106f:	01 d8                	add    %ebx,%eax
+}
+    1071:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1074:	5b                   	pop    %ebx
+    1075:	5e                   	pop    %esi
+    1076:	5d                   	pop    %ebp
+    1077:	c3                   	ret
+    return 0;
+    1078:	b8 00 00 00 00       	mov    $0x0,%eax
+    107d:	eb f2                	jmp    1071 <more+0x2c>
+
+0000107f <slaballoc>:
+{
+    107f:	55                   	push   %ebp
+    1080:	89 e5                	mov    %esp,%ebp
+    1082:	56                   	push   %esi
+    1083:	53                   	push   %ebx
+    1084:	89 c6                	mov    %eax,%esi
+  n = 1 << (MINSHIFT + c);
+    1086:	8d 48 04             	lea    0x4(%eax),%ecx
+    1089:	bb 01 00 00 00       	mov    $0x1,%ebx
+    108e:	d3 e3                	shl    %cl,%ebx
+  if(slab + n > slabend){
+    1090:	89 d8                	mov    %ebx,%eax
+    1092:	03 05 a8 3c 00 00    	add    0x3ca8,%eax
+    1098:	39 05 a4 3c 00 00    	cmp    %eax,0x3ca4
+    109e:	72 17                	jb     10b7 <slaballoc+0x38>
+  h = (Header*)slab;
+    10a0:	a1 a8 3c 00 00       	mov    0x3ca8,%eax
+  slab += n;
+    10a5:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+    10a8:	89 15 a8 3c 00 00    	mov    %edx,0x3ca8
+  h->size = n;
+    10ae:	89 18                	mov    %ebx,(%eax)
+  h->class = c;
+    10b0:	89 70 04             	mov    %esi,0x4(%eax)
+}
+    10b3:	5b                   	pop    %ebx
+    10b4:	5e                   	pop    %esi
+    10b5:	5d                   	pop    %ebp
+    10b6:	c3                   	ret
+    if((p = more(SLABSZ)) == 0)
+    10b7:	b8 00 40 00 00       	mov    $0x4000,%eax
+    10bc:	e8 84 ff ff ff       	call   1045 <more>
+    10c1:	85 c0                	test   %eax,%eax
+    10c3:	74 ee                	je     10b3 <slaballoc+0x34>
+    if(p != slabend)
+    10c5:	39 05 a4 3c 00 00    	cmp    %eax,0x3ca4
+    10cb:	74 05                	je     10d2 <slaballoc+0x53>
+      slab = p;
+    10cd:	a3 a8 3c 00 00       	mov    %eax,0x3ca8
+    slabend = p + SLABSZ;
+    10d2:	05 00 40 00 00       	add    $0x4000,%eax
+    10d7:	a3 a4 3c 00 00       	mov    %eax,0x3ca4
+    10dc:	eb c2                	jmp    10a0 <slaballoc+0x21>
+
+000010de <largealloc>:
+{
+    10de:	55                   	push   %ebp
+    10df:	89 e5                	mov    %esp,%ebp
+    10e1:	56                   	push   %esi
+    10e2:	53                   	push   %ebx
+    10e3:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+    10e5:	b9 ac 3c 00 00       	mov    $0x3cac,%ecx
+    10ea:	8b 01                	mov    (%ecx),%eax
+    10ec:	85 c0                	test   %eax,%eax
+    10ee:	74 36                	je     1126 <largealloc+0x48>
+    if(b->h.size < n)
+    10f0:	8b 10                	mov    (%eax),%edx
+    10f2:	39 da                	cmp    %ebx,%edx
+    10f4:	72 24                	jb     111a <largealloc+0x3c>
+    if(b->h.size - n > SMALLMAX){
+    10f6:	29 da                	sub    %ebx,%edx
+    10f8:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+    10fe:	76 1f                	jbe    111f <largealloc+0x41>
+      rest = (Fblock*)((char*)b + n);
+    1100:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+      rest->h.size = b->h.size - n;
+    1103:	89 16                	mov    %edx,(%esi)
+      rest->h.class = LARGE;
+    1105:	c7 46 04 09 00 00 00 	movl   $0x9,0x4(%esi)
+      rest->next = b->next;
+    110c:	8b 50 08             	mov    0x8(%eax),%edx
+    110f:	89 56 08             	mov    %edx,0x8(%esi)
+      *pp = rest;
+    1112:	89 31                	mov    %esi,(%ecx)
+      b->h.size = n;
+    1114:	89 18                	mov    %ebx,(%eax)
+}
+    1116:	5b                   	pop    %ebx
+    1117:	5e                   	pop    %esi
+    1118:	5d                   	pop    %ebp
+    1119:	c3                   	ret
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+    111a:	8d 48 08             	lea    0x8(%eax),%ecx
+    111d:	eb cb                	jmp    10ea <largealloc+0xc>
+      *pp = b->next;
+    111f:	8b 50 08             	mov    0x8(%eax),%edx
+    1122:	89 11                	mov    %edx,(%ecx)
+    return &b->h;
+    1124:	eb f0                	jmp    1116 <largealloc+0x38>
+  if((b = more(n)) == 0)
+    1126:	89 d8                	mov    %ebx,%eax
+    1128:	e8 18 ff ff ff       	call   1045 <more>
+    112d:	85 c0                	test   %eax,%eax
+    112f:	74 e5                	je     1116 <largealloc+0x38>
+  b->h.size = n;
+    1131:	89 18                	mov    %ebx,(%eax)
+  b->h.class = LARGE;
+    1133:	c7 40 04 09 00 00 00 	movl   $0x9,0x4(%eax)
+  return &b->h;
+    113a:	eb da                	jmp    1116 <largealloc+0x38>
+
+0000113c <free>:
+
+void
+free(void *ap)
+{
+    113c:	55                   	push   %ebp
+    113d:	89 e5                	mov    %esp,%ebp
+    113f:	56                   	push   %esi
+    1140:	53                   	push   %ebx
+    1141:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+
+  if(ap == 0)
+    1144:	85 db                	test   %ebx,%ebx
+    1146:	74 3b                	je     1183 <free+0x47>
+    return;
+  h = (Header*)ap - 1;
+    1148:	8d 73 f8             	lea    -0x8(%ebx),%esi
+  lock_acquire(&lock);
+    114b:	83 ec 0c             	sub    $0xc,%esp
+    114e:	68 a0 3c 00 00       	push   $0x3ca0
+    1153:	e8 9c 01 00 00       	call   12f4 <lock_acquire>
+  if(h->class == LARGE)
+    1158:	8b 43 fc             	mov    -0x4(%ebx),%eax
+    115b:	83 c4 10             	add    $0x10,%esp
+    115e:	83 f8 09             	cmp    $0x9,%eax
+    1161:	74 27                	je     118a <free+0x4e>
+    largefree((Fblock*)h);
+  else {
+    ((Fblock*)h)->next = freelist[h->class];
+    1163:	8b 14 85 c0 3c 00 00 	mov    0x3cc0(,%eax,4),%edx
+    116a:	89 13                	mov    %edx,(%ebx)
+    freelist[h->class] = (Fblock*)h;
+    116c:	89 34 85 c0 3c 00 00 	mov    %esi,0x3cc0(,%eax,4)
+  }
+  lock_release(&lock);
+    1173:	83 ec 0c             	sub    $0xc,%esp
+    1176:	68 a0 3c 00 00       	push   $0x3ca0
+    117b:	e8 88 01 00 00       	call   1308 <lock_release>
+    1180:	83 c4 10             	add    $0x10,%esp
+}
+    1183:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1186:	5b                   	pop    %ebx
+    1187:	5e                   	pop    %esi
+    1188:	5d                   	pop    %ebp
+    1189:	c3                   	ret
+    largefree((Fblock*)h);
+    118a:	89 f0                	mov    %esi,%eax
+    118c:	e8 0b fe ff ff       	call   f9c <largefree>
+    1191:	eb e0                	jmp    1173 <free+0x37>
+
+00001193 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1193:	55                   	push   %ebp
+    1194:	89 e5                	mov    %esp,%ebp
+    1196:	53                   	push   %ebx
+    1197:	83 ec 04             	sub    $0x4,%esp
+    119a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+  uint n;
+  int c;
+
+  if(nbytes > 0x7fffffff - sizeof(Header) - 7)
+    119d:	81 fb f0 ff ff 7f    	cmp    $0x7ffffff0,%ebx
+    11a3:	0f 87 8b 00 00 00    	ja     1234 <malloc+0xa1>
+    return 0;
+  n = (nbytes + sizeof(Header) + 7) & ~7;
+    11a9:	83 c3 0f             	add    $0xf,%ebx
+    11ac:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(n < sizeof(Fblock))
+    11af:	83 fb 0b             	cmp    $0xb,%ebx
+    11b2:	77 05                	ja     11b9 <malloc+0x26>
+    n = sizeof(Fblock);
+    11b4:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  lock_acquire(&lock);
+    11b9:	83 ec 0c             	sub    $0xc,%esp
+    11bc:	68 a0 3c 00 00       	push   $0x3ca0
+    11c1:	e8 2e 01 00 00       	call   12f4 <lock_acquire>
+  if(n <= SMALLMAX){
+    11c6:	83 c4 10             	add    $0x10,%esp
+    11c9:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+    11cf:	77 58                	ja     1229 <malloc+0x96>
+    for(c = 0; (1 << (MINSHIFT + c)) < n; c++)
+    11d1:	ba 00 00 00 00       	mov    $0x0,%edx
+    11d6:	eb 03                	jmp    11db <malloc+0x48>
+    11d8:	83 c2 01             	add    $0x1,%edx
+    11db:	8d 4a 04             	lea    0x4(%edx),%ecx
+    11de:	b8 01 00 00 00       	mov    $0x1,%eax
+    11e3:	d3 e0                	shl    %cl,%eax
+    11e5:	39 d8                	cmp    %ebx,%eax
+    11e7:	72 ef                	jb     11d8 <malloc+0x45>
+      ;
+    if(freelist[c]){
+    11e9:	8b 04 95 c0 3c 00 00 	mov    0x3cc0(,%edx,4),%eax
+    11f0:	85 c0                	test   %eax,%eax
+    11f2:	74 2a                	je     121e <malloc+0x8b>
+      h = &freelist[c]->h;
+    11f4:	89 c3                	mov    %eax,%ebx
+      freelist[c] = freelist[c]->next;
+    11f6:	8b 40 08             	mov    0x8(%eax),%eax
+    11f9:	89 04 95 c0 3c 00 00 	mov    %eax,0x3cc0(,%edx,4)
+    } else
+      h = slaballoc(c);
+  } else
+    h = largealloc(n);
+  lock_release(&lock);
+    1200:	83 ec 0c             	sub    $0xc,%esp
+    1203:	68 a0 3c 00 00       	push   $0x3ca0
+    1208:	e8 fb 00 00 00       	call   1308 <lock_release>
+  return h ? (void*)(h + 1) : 0;
+    120d:	83 c4 10             	add    $0x10,%esp
+    1210:	85 db                	test   %ebx,%ebx
+    1212:	74 03                	je     1217 <malloc+0x84>
+    1214:	83 c3 08             	add    $0x8,%ebx
+}
+    1217:	89 d8                	mov    %ebx,%eax
+    1219:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    121c:	c9                   	leave
+    121d:	c3                   	ret
+      h = slaballoc(c);
+    121e:	89 d0                	mov    %edx,%eax
+    1220:	e8 5a fe ff ff       	call   107f <slaballoc>
+    1225:	89 c3                	mov    %eax,%ebx
+    1227:	eb d7                	jmp    1200 <malloc+0x6d>
+    h = largealloc(n);
+    1229:	89 d8                	mov    %ebx,%eax
+    122b:	e8 ae fe ff ff       	call   10de <largealloc>
+    1230:	89 c3                	mov    %eax,%ebx
+    1232:	eb cc                	jmp    1200 <malloc+0x6d>
+    return 0;
+    1234:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1239:	eb dc                	jmp    1217 <malloc+0x84>
+
+0000123b <tstart>:
+  void *arg;
+};
+
+static void
+tstart(void *a)
+{
+    123b:	55                   	push   %ebp
+    123c:	89 e5                	mov    %esp,%ebp
+    123e:	83 ec 14             	sub    $0x14,%esp
+    1241:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+    1244:	ff 70 04             	push   0x4(%eax)
+    1247:	ff 10                	call   *(%eax)
+  exit();
+    1249:	e8 86 f6 ff ff       	call   8d4 <exit>
+
+0000124e <thread_create>:
+}
+
+// Run fn(arg) in a new thread.  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    124e:	55                   	push   %ebp
+    124f:	89 e5                	mov    %esp,%ebp
+    1251:	56                   	push   %esi
+    1252:	53                   	push   %ebx
+  struct tstart *t;
+  char *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    1253:	83 ec 0c             	sub    $0xc,%esp
+    1256:	68 00 10 00 00       	push   $0x1000
+    125b:	e8 33 ff ff ff       	call   1193 <malloc>
+    1260:	83 c4 10             	add    $0x10,%esp
+    1263:	85 c0                	test   %eax,%eax
+    1265:	74 42                	je     12a9 <thread_create+0x5b>
+    1267:	89 c3                	mov    %eax,%ebx
+    return -1;
+  t = (struct tstart*)stack;
+  t->fn = fn;
+    1269:	8b 45 08             	mov    0x8(%ebp),%eax
+    126c:	89 03                	mov    %eax,(%ebx)
+  t->arg = arg;
+    126e:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1271:	89 43 04             	mov    %eax,0x4(%ebx)
+  if((pid = clone(tstart, stack + TSTACK, t)) < 0)
+    1274:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    127a:	83 ec 04             	sub    $0x4,%esp
+    127d:	53                   	push   %ebx
+    127e:	50                   	push   %eax
+    127f:	68 3b 12 00 00       	push   $0x123b
+    1284:	e8 f5 f8 ff ff       	call   b7e <clone>
+    1289:	89 c6                	mov    %eax,%esi
+    128b:	83 c4 10             	add    $0x10,%esp
+    128e:	85 c0                	test   %eax,%eax
+    1290:	78 09                	js     129b <thread_create+0x4d>
+    free(stack);
+  return pid;
+}
+    1292:	89 f0                	mov    %esi,%eax
+    1294:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1297:	5b                   	pop    %ebx
+    1298:	5e                   	pop    %esi
+    1299:	5d                   	pop    %ebp
+    129a:	c3                   	ret
+    free(stack);
+    129b:	83 ec 0c             	sub    $0xc,%esp
+    129e:	53                   	push   %ebx
+    129f:	e8 98 fe ff ff       	call   113c <free>
+    12a4:	83 c4 10             	add    $0x10,%esp
+    12a7:	eb e9                	jmp    1292 <thread_create+0x44>
+    return -1;
+    12a9:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    12ae:	eb e2                	jmp    1292 <thread_create+0x44>
+
+000012b0 <thread_join>:
+
+// Wait for one of this process's threads to exit and free its
+// stack.  Returns its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+    12b0:	55                   	push   %ebp
+    12b1:	89 e5                	mov    %esp,%ebp
+    12b3:	53                   	push   %ebx
+    12b4:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    12b7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    12ba:	50                   	push   %eax
+    12bb:	e8 cd f8 ff ff       	call   b8d <join>
+    12c0:	89 c3                	mov    %eax,%ebx
+    12c2:	83 c4 10             	add    $0x10,%esp
+    12c5:	85 c0                	test   %eax,%eax
+    12c7:	79 07                	jns    12d0 <thread_join+0x20>
+    free((char*)stack - TSTACK);
+  return pid;
+}
+    12c9:	89 d8                	mov    %ebx,%eax
+    12cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    12ce:	c9                   	leave
+    12cf:	c3                   	ret
+    free((char*)stack - TSTACK);
+    12d0:	83 ec 0c             	sub    $0xc,%esp
+    12d3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    12d6:	2d 00 10 00 00       	sub    $0x1000,%eax
+    12db:	50                   	push   %eax
+    12dc:	e8 5b fe ff ff       	call   113c <free>
+    12e1:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    12e4:	eb e3                	jmp    12c9 <thread_join+0x19>
+
+000012e6 <lock_init>:
+
+void
+lock_init(lock_t *lk)
+{
+    12e6:	55                   	push   %ebp
+    12e7:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    12e9:	8b 45 08             	mov    0x8(%ebp),%eax
+    12ec:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    12f2:	5d                   	pop    %ebp
+    12f3:	c3                   	ret
+
+000012f4 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+    12f4:	55                   	push   %ebp
+    12f5:	89 e5                	mov    %esp,%ebp
+    12f7:	8b 55 08             	mov    0x8(%ebp),%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    12fa:	b8 01 00 00 00       	mov    $0x1,%eax
+    12ff:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    1302:	85 c0                	test   %eax,%eax
+    1304:	75 f4                	jne    12fa <lock_acquire+0x6>
+    ;
+}
+    1306:	5d                   	pop    %ebp
+    1307:	c3                   	ret
+
+00001308 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+    1308:	55                   	push   %ebp
+    1309:	89 e5                	mov    %esp,%ebp
+    130b:	8b 55 08             	mov    0x8(%ebp),%edx
+    130e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1313:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    1316:	5d                   	pop    %ebp
+    1317:	c3                   	ret
+
+00001318 <mutex_init>:
+// Are Tricky": state is 0 when free, 1 when held, 2 when held and
+// others may be waiting.  Unlocking an uncontended mutex costs no
+// system call.
+void
+mutex_init(mutex_t *m)
+{
+    1318:	55                   	push   %ebp
+    1319:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    131b:	8b 45 08             	mov    0x8(%ebp),%eax
+    131e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1324:	5d                   	pop    %ebp
+    1325:	c3                   	ret
+
+00001326 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+    1326:	55                   	push   %ebp
+    1327:	89 e5                	mov    %esp,%ebp
+    1329:	53                   	push   %ebx
+    132a:	83 ec 04             	sub    $0x4,%esp
+    132d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    1330:	b8 00 00 00 00       	mov    $0x0,%eax
+    1335:	b9 01 00 00 00       	mov    $0x1,%ecx
+    133a:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    133e:	85 c0                	test   %eax,%eax
+    1340:	74 29                	je     136b <mutex_lock+0x45>
+    return;
+  if(c != 2)
+    1342:	83 f8 02             	cmp    $0x2,%eax
+    1345:	74 20                	je     1367 <mutex_lock+0x41>
+    1347:	b8 02 00 00 00       	mov    $0x2,%eax
+    134c:	f0 87 03             	lock xchg %eax,(%ebx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    134f:	eb 16                	jmp    1367 <mutex_lock+0x41>
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    1351:	83 ec 08             	sub    $0x8,%esp
+    1354:	6a 02                	push   $0x2
+    1356:	53                   	push   %ebx
+    1357:	e8 40 f8 ff ff       	call   b9c <futex_wait>
+  asm volatile("lock; xchgl %0, %1" :
+    135c:	b8 02 00 00 00       	mov    $0x2,%eax
+    1361:	f0 87 03             	lock xchg %eax,(%ebx)
+    1364:	83 c4 10             	add    $0x10,%esp
+  while(c != 0){
+    1367:	85 c0                	test   %eax,%eax
+    1369:	75 e6                	jne    1351 <mutex_lock+0x2b>
+    c = xchg(&m->state, 2);
+  }
+}
+    136b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    136e:	c9                   	leave
+    136f:	c3                   	ret
+
+00001370 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+    1370:	55                   	push   %ebp
+    1371:	89 e5                	mov    %esp,%ebp
+    1373:	83 ec 08             	sub    $0x8,%esp
+    1376:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    1379:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    137e:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    1382:	83 fa 01             	cmp    $0x1,%edx
+    1385:	75 02                	jne    1389 <mutex_unlock+0x19>
+    m->state = 0;
+    futex_wake(&m->state, 1);
+  }
+}
+    1387:	c9                   	leave
+    1388:	c3                   	ret
+    m->state = 0;
+    1389:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+    138f:	83 ec 08             	sub    $0x8,%esp
+    1392:	6a 01                	push   $0x1
+    1394:	50                   	push   %eax
+    1395:	e8 11 f8 ff ff       	call   bab <futex_wake>
+    139a:	83 c4 10             	add    $0x10,%esp
+}
+    139d:	eb e8                	jmp    1387 <mutex_unlock+0x17>
+
+0000139f <cond_init>:
+// Condition variable: waiters sleep on a sequence number that
+// every signal bumps, so a signal between the unlock and the
+// futex_wait() in cond_wait() is not lost.
+void
+cond_init(cond_t *c)
+{
+    139f:	55                   	push   %ebp
+    13a0:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    13a2:	8b 45 08             	mov    0x8(%ebp),%eax
+    13a5:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    13ab:	5d                   	pop    %ebp
+    13ac:	c3                   	ret
+
+000013ad <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+    13ad:	55                   	push   %ebp
+    13ae:	89 e5                	mov    %esp,%ebp
+    13b0:	57                   	push   %edi
+    13b1:	56                   	push   %esi
+    13b2:	53                   	push   %ebx
+    13b3:	83 ec 18             	sub    $0x18,%esp
+    13b6:	8b 75 08             	mov    0x8(%ebp),%esi
+    13b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    13bc:	8b 3e                	mov    (%esi),%edi
+  mutex_unlock(m);
+    13be:	53                   	push   %ebx
+    13bf:	e8 ac ff ff ff       	call   1370 <mutex_unlock>
+  futex_wait(&c->seq, seq);
+    13c4:	83 c4 08             	add    $0x8,%esp
+    13c7:	57                   	push   %edi
+    13c8:	56                   	push   %esi
+    13c9:	e8 ce f7 ff ff       	call   b9c <futex_wait>
+  // Others may be waiting for m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+    13ce:	83 c4 10             	add    $0x10,%esp
+    13d1:	eb 0e                	jmp    13e1 <cond_wait+0x34>
+    futex_wait(&m->state, 2);
+    13d3:	83 ec 08             	sub    $0x8,%esp
+    13d6:	6a 02                	push   $0x2
+    13d8:	53                   	push   %ebx
+    13d9:	e8 be f7 ff ff       	call   b9c <futex_wait>
+    13de:	83 c4 10             	add    $0x10,%esp
+    13e1:	b8 02 00 00 00       	mov    $0x2,%eax
+    13e6:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    13e9:	85 c0                	test   %eax,%eax
+    13eb:	75 e6                	jne    13d3 <cond_wait+0x26>
+}
+    13ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13f0:	5b                   	pop    %ebx
+    13f1:	5e                   	pop    %esi
+    13f2:	5f                   	pop    %edi
+    13f3:	5d                   	pop    %ebp
+    13f4:	c3                   	ret
+
+000013f5 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+    13f5:	55                   	push   %ebp
+    13f6:	89 e5                	mov    %esp,%ebp
+    13f8:	83 ec 10             	sub    $0x10,%esp
+    13fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    13fe:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+    1402:	6a 01                	push   $0x1
+    1404:	50                   	push   %eax
+    1405:	e8 a1 f7 ff ff       	call   bab <futex_wake>
+}
+    140a:	83 c4 10             	add    $0x10,%esp
+    140d:	c9                   	leave
+    140e:	c3                   	ret
+
+0000140f <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+    140f:	55                   	push   %ebp
+    1410:	89 e5                	mov    %esp,%ebp
+    1412:	83 ec 10             	sub    $0x10,%esp
+    1415:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    1418:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, NPROC);
+    141c:	6a 40                	push   $0x40
+    141e:	50                   	push   %eax
+    141f:	e8 87 f7 ff ff       	call   bab <futex_wake>
+}
+    1424:	83 c4 10             	add    $0x10,%esp
+    1427:	c9                   	leave
+    1428:	c3                   	ret
@@ -2,6 +2,7 @@
 #include "stat.h"
 #include "user.h"
 #include "fs.h"
+#include "fcntl.h"
 
 char*
 fmtname(char *path)
@@ -25,9 +26,9 @@ fmtname(char *path)
 void
 ls(char *path)
 {
-  char buf[512], *p;
-  int fd;
-  struct dirent de;
+  char name[DIRSIZ+1];
+  int fd, i, n;
+  struct dirent de[32];
   struct stat st;
 
   if((fd = open(path, 0)) < 0){
@@ -47,23 +48,17 @@ ls(char *path)
     break;
 
   case T_DIR:
-    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
-      printf(1, "ls: path too long\n");
-      break;
-    }
-    strcpy(buf, path);
-    p = buf+strlen(buf);
-    *p++ = '/';
-    while(read(fd, &de, sizeof(de)) == sizeof(de)){
-      if(de.inum == 0)
-        continue;
-      memmove(p, de.name, DIRSIZ);
-      p[DIRSIZ] = 0;
-      if(stat(buf, &st) < 0){
-        printf(1, "ls: cannot stat %s\n", buf);
-        continue;
+    // A batch of entries per getdents(), each looked up from fd.
+    name[DIRSIZ] = 0;
+    while((n = getdents(fd, de, sizeof(de))) > 0){
+      for(i = 0; i < n / sizeof(de[0]); i++){
+        memmove(name, de[i].name, DIRSIZ);
+        if(fstatat(fd, name, &st) < 0){
+          printf(1, "ls: cannot stat %s\n", name);
+          continue;
+        }
+        printf(1, "%s %d %d %d\n", fmtname(name), st.type, st.ino, st.size);
       }
-      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
     }
     break;
   }
@@ -3,6 +3,7 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
 
@@ -21,6 +22,8 @@ main(void)
   kvmalloc();      // kernel page table
   mpinit();        // detect other processors
   lapicinit();     // interrupt controller
+  clockinit();     // TSC calibration, clock page
+  timerinit();     // timer wheel, one-shot timer on CPU 0
   seginit();       // segment descriptors
   picinit();       // disable pic
   ioapicinit();    // another interrupt controller
@@ -28,8 +31,16 @@ main(void)
   uartinit();      // serial port
   pinit();         // process table
   tvinit();        // trap vectors
+  traceinit();     // event trace
   binit();         // buffer cache
+  textinit();      // executable page cache
+  pcinit();        // file page cache
+  dcacheinit();    // directory entry cache
+  icacheinit();    // inode cache
+  tmpfsinit();     // in-memory file system
   fileinit();      // file table
+  pipeinit();      // pipe cache
+  shminit();       // shared memory segments
   ideinit();       // disk 
   startothers();   // start other processors
   kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
@@ -59,14 +70,17 @@ mpmain(void)
 
 pde_t entrypgdir[];  // For entry.S
 
-// Start the non-boot (AP) processors.
+// Start the non-boot (AP) processors, all at once: they set up
+// their segments, lapics and IDTs in parallel rather than one
+// after the other.
 static void
 startothers(void)
 {
   extern uchar _binary_entryother_start[], _binary_entryother_size[];
-  uchar *code;
+  static char *stacks[NCPU];
+  uchar *code, apicid[NCPU];
   struct cpu *c;
-  char *stack;
+  int n;
 
   // Write entry code to unused memory at 0x7000.
   // The linker has placed the image of entryother.S in
@@ -74,24 +88,29 @@ startothers(void)
   code = P2V(0x7000);
   memmove(code, _binary_entryother_start, (uint)_binary_entryother_size);
 
+  // Tell entryother.S what stacks to use, where to enter, and what
+  // pgdir to use. We cannot use kpgdir yet, because the AP processor
+  // is running in low  memory, so we use entrypgdir for the APs too.
+  n = 0;
   for(c = cpus; c < cpus+ncpu; c++){
     if(c == mycpu())  // We've started already.
       continue;
+    stacks[n] = kalloc() + KSTACKSIZE;
+    apicid[n++] = c->apicid;
+  }
+  if(n == 0)
+    return;
+  *(uint*)(code-4) = 0;
+  *(void(**)(void))(code-8) = mpenter;
+  *(int**)(code-12) = (void *) V2P(entrypgdir);
+  *(char***)(code-16) = stacks;
 
-    // Tell entryother.S what stack to use, where to enter, and what
-    // pgdir to use. We cannot use kpgdir yet, because the AP processor
-    // is running in low  memory, so we use entrypgdir for the APs too.
-    stack = kalloc();
-    *(void**)(code-4) = stack + KSTACKSIZE;
-    *(void(**)(void))(code-8) = mpenter;
-    *(int**)(code-12) = (void *) V2P(entrypgdir);
-
-    lapicstartap(c->apicid, V2P(code));
+  lapicstartap(apicid, n, V2P(code));
 
-    // wait for cpu to finish mpmain()
-    while(c->started == 0)
+  // wait for every cpu to finish mpmain()
+  for(c = cpus; c < cpus+ncpu; c++)
+    while(c != mycpu() && c->started == 0)
       ;
-  }
 }
 
 // The boot page table used in entry.S and entryother.S.
@@ -5,13 +5,14 @@
 #include "defs.h"
 #include "param.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
 #include "traps.h"
-#include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "iostat.h"
 
 extern uchar _binary_fs_img_start[], _binary_fs_img_size[];
 
@@ -43,7 +44,7 @@ iderw(struct buf *b)
   if(!holdingsleep(&b->lock))
     panic("iderw: buf not locked");
   if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
-    panic("iderw: nothing to do");
+    return;
   if(b->dev != 1)
     panic("iderw: request not for disk 1");
   if(b->blockno >= disksize)
@@ -58,3 +59,37 @@ iderw(struct buf *b)
     memmove(b->data, p, BSIZE);
   b->flags |= B_VALID;
 }
+
+// The memory disk has no latency to hide: read now.
+void
+idereadahead(struct buf *b)
+{
+  if((b->flags & B_VALID) == 0 && b->blockno < disksize){
+    memmove(b->data, memdisk + b->blockno*BSIZE, BSIZE);
+    b->flags |= B_VALID;
+  }
+  bunref(b);
+}
+
+void
+iderwv(struct buf **bs, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++)
+    iderw(bs[i]);
+}
+
+// There is no queue to order or measure.
+void
+getiostat(struct iostat *st)
+{
+  memset(st, 0, sizeof(*st));
+  safestrcpy(st->sched, "none", sizeof(st->sched));
+}
+
+int
+setiosched(char *name)
+{
+  return -1;
+}
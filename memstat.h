@@ -0,0 +1,11 @@
+// Physical memory counters, as returned by memstat(), in pages
+// of 4096 bytes.  free counts the pages on the buddy lists and in
+// the per-CPU caches; zero is the part of it that kzeroidle() has
+// already cleared.
+
+struct memstat {
+  uint total;                  // Pages the allocator manages
+  uint free;
+  uint used;                   // total - free
+  uint zero;                   // Free pages already zeroed
+};
@@ -18,12 +18,16 @@
 #define NINODES 200
 
 // Disk layout:
-// [ boot block | sb block | log | inode blocks | free bit map | data blocks ]
+// [ boot block | sb block | log | inode blocks | free bit map | swap | data blocks ]
 
 int nbitmap = FSSIZE/(BSIZE*8) + 1;
 int ninodeblocks = NINODES / IPB + 1;
-int nlog = LOGSIZE;
-int nmeta;    // Number of meta blocks (boot, sb, nlog, inode, bitmap)
+// The log gets 1/64 of the disk, within what the kernel uses.
+#define NLOGDATA (FSSIZE/64 < MAXOPBLOCKS*3 ? MAXOPBLOCKS*3 : \
+                  FSSIZE/64 > LOGSIZE ? LOGSIZE : FSSIZE/64)
+int nlog = LOGHEAD(NLOGDATA) + NLOGDATA;
+int nswap = NSWAP;
+int nmeta;    // Number of meta blocks (boot, sb, nlog, inode, bitmap, swap)
 int nblocks;  // Number of data blocks
 
 int fsfd;
@@ -40,6 +44,13 @@ void rinode(uint inum, struct dinode *ip);
 void rsect(uint sec, void *buf);
 uint ialloc(ushort type);
 void iappend(uint inum, void *p, int n);
+void ilayout(uint inum, uint nblk);
+void wfile(uint inum, int fd);
+int layoutrank(char *name);
+void hashdir(uint inum, struct dirent *de, int n);
+
+struct dirent rootde[NINODES];
+int nrootde;
 
 // convert to intel byte order
 ushort
@@ -67,11 +78,11 @@ xint(uint x)
 int
 main(int argc, char *argv[])
 {
-  int i, cc, fd;
-  uint rootino, inum, off;
-  struct dirent de;
+  int i, k, fd, rank, nfile;
+  int file[NINODES], fds[NINODES];
+  uint rootino, inums[NINODES];
+  struct dirent *de;
   char buf[BSIZE];
-  struct dinode din;
 
 
   static_assert(sizeof(int) == 4, "Integers must be 4 bytes!");
@@ -91,7 +102,7 @@ main(int argc, char *argv[])
   }
 
   // 1 fs block = 1 disk sector
-  nmeta = 2 + nlog + ninodeblocks + nbitmap;
+  nmeta = 2 + nlog + ninodeblocks + nbitmap + nswap;
   nblocks = FSSIZE - nmeta;
 
   sb.size = xint(FSSIZE);
@@ -101,9 +112,11 @@ main(int argc, char *argv[])
   sb.logstart = xint(2);
   sb.inodestart = xint(2+nlog);
   sb.bmapstart = xint(2+nlog+ninodeblocks);
+  sb.nswap = xint(nswap);
+  sb.swapstart = xint(2+nlog+ninodeblocks+nbitmap);
 
-  printf("nmeta %d (boot, super, log blocks %u inode blocks %u, bitmap blocks %u) blocks %d total %d\n",
-         nmeta, nlog, ninodeblocks, nbitmap, nblocks, FSSIZE);
+  printf("nmeta %d (boot, super, log blocks %u inode blocks %u, bitmap blocks %u, swap blocks %u) blocks %d total %d\n",
+         nmeta, nlog, ninodeblocks, nbitmap, nswap, nblocks, FSSIZE);
 
   freeblock = nmeta;     // the first free block that we can allocate
 
@@ -117,23 +130,33 @@ main(int argc, char *argv[])
   rootino = ialloc(T_DIR);
   assert(rootino == ROOTINO);
 
-  bzero(&de, sizeof(de));
-  de.inum = xshort(rootino);
-  strcpy(de.name, ".");
-  iappend(rootino, &de, sizeof(de));
-
-  bzero(&de, sizeof(de));
-  de.inum = xshort(rootino);
-  strcpy(de.name, "..");
-  iappend(rootino, &de, sizeof(de));
-
-  for(i = 2; i < argc; i++){
+  de = &rootde[nrootde++];
+  de->inum = xshort(rootino);
+  strcpy(de->name, ".");
+
+  de = &rootde[nrootde++];
+  de->inum = xshort(rootino);
+  strcpy(de->name, "..");
+
+  // Lay the files out in the order they are expected to be read:
+  // init and sh at boot, then the rest as given.  Their inodes are
+  // allocated in that order, the root directory goes next to the
+  // inode blocks, and then each file's data, as one run.
+  nfile = 0;
+  for(rank = 0; rank < 3; rank++)
+    for(i = 2; i < argc; i++)
+      if(layoutrank(argv[i]) == rank)
+        file[nfile++] = i;
+
+  for(k = 0; k < nfile; k++){
+    i = file[k];
     assert(index(argv[i], '/') == 0);
 
     if((fd = open(argv[i], 0)) < 0){
       perror(argv[i]);
       exit(1);
     }
+    fds[k] = fd;
 
     // Skip leading _ in name when writing to file system.
     // The binaries are named _rm, _cat, etc. to keep the
@@ -142,26 +165,20 @@ main(int argc, char *argv[])
     if(argv[i][0] == '_')
       ++argv[i];
 
-    inum = ialloc(T_FILE);
+    inums[k] = ialloc(T_FILE);
 
-    bzero(&de, sizeof(de));
-    de.inum = xshort(inum);
-    strncpy(de.name, argv[i], DIRSIZ);
-    iappend(rootino, &de, sizeof(de));
+    de = &rootde[nrootde++];
+    de->inum = xshort(inums[k]);
+    strncpy(de->name, argv[i], DIRSIZ);
+  }
 
-    while((cc = read(fd, buf, sizeof(buf))) > 0)
-      iappend(inum, buf, cc);
+  hashdir(rootino, rootde, nrootde);
 
-    close(fd);
+  for(k = 0; k < nfile; k++){
+    wfile(inums[k], fds[k]);
+    close(fds[k]);
   }
 
-  // fix size of root inode dir
-  rinode(rootino, &din);
-  off = xint(din.size);
-  off = ((off/BSIZE) + 1) * BSIZE;
-  din.size = xint(off);
-  winode(rootino, &din);
-
   balloc(freeblock);
 
   exit(0);
@@ -227,7 +244,7 @@ ialloc(ushort type)
   struct dinode din;
 
   bzero(&din, sizeof(din));
-  din.type = xshort(type);
+  din.type = type;
   din.nlink = xshort(1);
   din.size = xint(0);
   winode(inum, &din);
@@ -238,16 +255,77 @@ void
 balloc(int used)
 {
   uchar buf[BSIZE];
-  int i;
+  int i, b;
 
   printf("balloc: first %d blocks have been allocated\n", used);
-  assert(used < BSIZE*8);
-  bzero(buf, BSIZE);
-  for(i = 0; i < used; i++){
-    buf[i/8] = buf[i/8] | (0x1 << (i%8));
+  assert(used < nbitmap*BSIZE*8);
+  // The swap area alone can fill more than one bitmap block.
+  for(b = 0; b*BSIZE*8 < used; b++){
+    bzero(buf, BSIZE);
+    for(i = b*BSIZE*8; i < used && i < (b+1)*BSIZE*8; i++){
+      buf[(i%(BSIZE*8))/8] |= 0x1 << (i%8);
+    }
+    printf("balloc: write bitmap block at sector %d\n", sb.bmapstart+b);
+    wsect(sb.bmapstart+b, buf);
   }
-  printf("balloc: write bitmap block at sector %d\n", sb.bmapstart);
-  wsect(sb.bmapstart, buf);
+}
+
+// FNV-1a, as dirhash() in fs.c.
+uint
+dirhash(char *name)
+{
+  uint h;
+  int i;
+
+  h = 2166136261U;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = (h ^ (uchar)name[i]) * 16777619U;
+  return h;
+}
+
+// Write the n entries de as the hashed directory inum, with as
+// few buckets as they fit in without chaining.
+void
+hashdir(uint inum, struct dirent *de, int n)
+{
+  static char dir[(1+(1<<HDMAXDEPTH))*BSIZE];
+  int nent[1<<HDMAXDEPTH];
+  struct dirhead *hd;
+  struct dinode din;
+  ushort *w;
+  uint d, i, b;
+
+  for(d = 0; ; d++){
+    assert(d <= HDMAXDEPTH);
+    bzero(nent, sizeof(nent));
+    for(i = 0; i < n; i++)
+      nent[dirhash(de[i].name) & ((1<<d)-1)]++;
+    for(b = 0; b < 1<<d && nent[b] < DPB; b++)
+      ;
+    if(b == 1<<d)
+      break;
+  }
+
+  bzero(dir, sizeof(dir));
+  w = (ushort*)dir;
+  w[HDIDX(0)] = xshort(HDMAGIC);
+  w[HDIDX(1)] = xshort(d);
+  for(b = 0; b < 1<<d; b++){
+    w[HDIDX(2+b)] = xshort(1+b);
+    hd = (struct dirhead*)(dir + (1+b)*BSIZE);
+    hd->depth = xshort(d);
+    nent[b] = 1;
+  }
+  for(i = 0; i < n; i++){
+    b = dirhash(de[i].name) & ((1<<d)-1);
+    memmove((struct dirent*)(dir + (1+b)*BSIZE) + nent[b]++, &de[i], sizeof(de[i]));
+  }
+  ilayout(inum, 1 + (1<<d));
+  iappend(inum, dir, (1 + (1<<d))*BSIZE);
+
+  rinode(inum, &din);
+  din.flags = I_HASHDIR;
+  winode(inum, &din);
 }
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
@@ -260,7 +338,7 @@ iappend(uint inum, void *xp, int n)
   struct dinode din;
   char buf[BSIZE];
   uint indirect[NINDIRECT];
-  uint x;
+  uint x, y, bn;
 
   rinode(inum, &din);
   off = xint(din.size);
@@ -273,7 +351,7 @@ iappend(uint inum, void *xp, int n)
         din.addrs[fbn] = xint(freeblock++);
       }
       x = xint(din.addrs[fbn]);
-    } else {
+    } else if(fbn < NDIRECT + NINDIRECT){
       if(xint(din.addrs[NDIRECT]) == 0){
         din.addrs[NDIRECT] = xint(freeblock++);
       }
@@ -283,6 +361,24 @@ iappend(uint inum, void *xp, int n)
         wsect(xint(din.addrs[NDIRECT]), (char*)indirect);
       }
       x = xint(indirect[fbn-NDIRECT]);
+    } else {
+      // Doubly-indirect block, as in bmap() in fs.c.
+      bn = fbn - NDIRECT - NINDIRECT;
+      if(xint(din.addrs[NDIRECT+1]) == 0){
+        din.addrs[NDIRECT+1] = xint(freeblock++);
+      }
+      rsect(xint(din.addrs[NDIRECT+1]), (char*)indirect);
+      if(indirect[bn / NINDIRECT] == 0){
+        indirect[bn / NINDIRECT] = xint(freeblock++);
+        wsect(xint(din.addrs[NDIRECT+1]), (char*)indirect);
+      }
+      y = xint(indirect[bn / NINDIRECT]);
+      rsect(y, (char*)indirect);
+      if(indirect[bn % NINDIRECT] == 0){
+        indirect[bn % NINDIRECT] = xint(freeblock++);
+        wsect(y, (char*)indirect);
+      }
+      x = xint(indirect[bn % NINDIRECT]);
     }
     n1 = min(n, (fbn + 1) * BSIZE - off);
     rsect(x, buf);
@@ -295,3 +391,103 @@ iappend(uint inum, void *xp, int n)
   din.size = xint(off);
   winode(inum, &din);
 }
+
+// Where file name goes in the layout: 0 for init, 1 for sh, which
+// are read at boot, and 2 for the rest.
+int
+layoutrank(char *name)
+{
+  if(name[0] == '_')
+    name++;
+  if(strcmp(name, "init") == 0)
+    return 0;
+  if(strcmp(name, "sh") == 0)
+    return 1;
+  return 2;
+}
+
+// Give block-mapped inum, still empty, nblk blocks in one run from
+// freeblock: its indirect and doubly-indirect blocks first, then the
+// data blocks in file order, for iappend() to find allocated.
+void
+ilayout(uint inum, uint nblk)
+{
+  struct dinode din;
+  uint ind[NINDIRECT], dind[NINDIRECT], *ind2;
+  uint bn, k, x, nind2, ind2start, data;
+
+  rinode(inum, &din);
+  assert(xint(din.size) == 0 && nblk <= MAXFILE);
+  x = freeblock;
+  if(nblk > NDIRECT)
+    din.addrs[NDIRECT] = xint(x++);
+  nind2 = 0;
+  if(nblk > NDIRECT + NINDIRECT){
+    din.addrs[NDIRECT+1] = xint(x++);
+    nind2 = (nblk - NDIRECT - NINDIRECT + NINDIRECT - 1) / NINDIRECT;
+  }
+  ind2start = x;
+  data = x + nind2;
+
+  bzero(ind, sizeof(ind));
+  bzero(dind, sizeof(dind));
+  ind2 = calloc(nind2 + 1, BSIZE);
+  for(bn = 0; bn < nblk; bn++){
+    if(bn < NDIRECT)
+      din.addrs[bn] = xint(data + bn);
+    else if(bn < NDIRECT + NINDIRECT)
+      ind[bn - NDIRECT] = xint(data + bn);
+    else {
+      k = bn - NDIRECT - NINDIRECT;
+      dind[k / NINDIRECT] = xint(ind2start + k / NINDIRECT);
+      ind2[k] = xint(data + bn);
+    }
+  }
+  if(nblk > NDIRECT)
+    wsect(xint(din.addrs[NDIRECT]), ind);
+  if(nind2 > 0){
+    wsect(xint(din.addrs[NDIRECT+1]), dind);
+    for(k = 0; k < nind2; k++)
+      wsect(ind2start + k, ind2 + k*NINDIRECT);
+  }
+  free(ind2);
+  winode(inum, &din);
+  freeblock = data + nblk;
+}
+
+// Write the file open on fd as the data of inum, as the kernel would
+// keep it: in addrs[] if it fits there, or else extent-mapped, here
+// as a single extent from freeblock, with no indirect blocks at all.
+void
+wfile(uint inum, int fd)
+{
+  struct dinode din;
+  struct extent *e;
+  char buf[BSIZE];
+  uint size, start;
+  int cc;
+
+  rinode(inum, &din);
+  size = lseek(fd, 0, SEEK_END);
+  lseek(fd, 0, SEEK_SET);
+  if(size <= NINLINE){
+    if(read(fd, din.addrs, size) != size){
+      perror("read");
+      exit(1);
+    }
+    din.flags = I_INLINE;
+  } else {
+    start = freeblock;
+    while((cc = read(fd, buf, sizeof(buf))) > 0){
+      bzero(buf + cc, sizeof(buf) - cc);
+      wsect(freeblock++, buf);
+    }
+    assert(freeblock - start == (size + BSIZE - 1) / BSIZE);
+    e = (struct extent*)din.addrs;
+    e->start = xint(start);
+    e->len = xint(freeblock - start);
+    din.flags = I_EXTENT;
+  }
+  din.size = xint(size);
+  winode(inum, &din);
+}
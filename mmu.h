@@ -10,6 +10,18 @@
 #define CR0_PG          0x80000000      // Paging
 
 #define CR4_PSE         0x00000010      // Page size extension
+#define CR4_PGE         0x00000080      // Page global enable
+#define CR4_OSFXSR      0x00000200      // SSE instructions enabled
+
+// CPUID leaf 1 %edx feature flags
+#define CPUID_SEP       0x00000800      // sysenter/sysexit
+#define CPUID_FXSR      0x01000000      // fxsave/fxrstor
+#define CPUID_SSE       0x02000000
+
+// Model-specific registers for sysenter
+#define MSR_SYSENTER_CS  0x174
+#define MSR_SYSENTER_ESP 0x175
+#define MSR_SYSENTER_EIP 0x176
 
 // various segment selectors.
 #define SEG_KCODE 1  // kernel code
@@ -83,6 +95,7 @@ struct segdesc {
 #define NPDENTRIES      1024    // # directory entries per page directory
 #define NPTENTRIES      1024    // # PTEs per page table
 #define PGSIZE          4096    // bytes mapped by a page
+#define LPGSIZE         (NPTENTRIES*PGSIZE) // bytes mapped by a 4MB page (PTE_PS)
 
 #define PTXSHIFT        12      // offset of PTX in a linear address
 #define PDXSHIFT        22      // offset of PDX in a linear address
@@ -94,7 +107,18 @@ struct segdesc {
 #define PTE_P           0x001   // Present
 #define PTE_W           0x002   // Writeable
 #define PTE_U           0x004   // User
+#define PTE_A           0x020   // Accessed
+#define PTE_D           0x040   // Dirty
 #define PTE_PS          0x080   // Page Size
+#define PTE_G           0x100   // Global: kept in the TLB across CR3 loads
+#define PTE_SWAP        0x200   // Not present, PTE_ADDR holds a swap slot (software-defined)
+#define PTE_SHARED      0x400   // MAP_SHARED page, kept writable by fork (software-defined)
+#define PTE_COW         0x800   // Copy-on-write (software-defined)
+
+// Page fault error code bits (tf->err on T_PGFLT)
+#define FEC_PR          0x1     // Fault caused by protection violation
+#define FEC_WR          0x2     // Fault caused by a write
+#define FEC_U           0x4     // Fault occurred in user mode
 
 // Address in page table or page directory entry
 #define PTE_ADDR(pte)   ((uint)(pte) & ~0xFFF)
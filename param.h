@@ -1,15 +1,51 @@
 #define NPROC        64  // maximum number of processes
 #define KSTACKSIZE 4096  // size of per-process kernel stack
 #define NCPU          8  // maximum number of CPUs
-#define NOFILE       16  // open files per process
-#define NFILE       100  // open files per system
-#define NINODE       50  // maximum number of active i-nodes
+#define NOFILE     1024  // open files per process (a page of pointers)
+#define NOFILE0      16  // fds a process has before its table grows
+#define NINODE       50  // unreferenced i-nodes kept cached
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
+#define TMPDEV        2  // device number of the in-memory tmpfs
+#define NTMPINODE    64  // inodes on tmpfs
+#define NMOUNT        4  // mounted file systems
 #define MAXARG       32  // max exec arguments
-#define MAXOPBLOCKS  10  // max # of blocks any FS op writes
-#define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
+#define MAXOPBLOCKS  12  // max # of blocks any FS op writes
+#define LOGSIZE      512  // max data blocks of the log that log.c uses
+#define NCLUSTER     8  // blocks per clustered disk write
+#define NREADAHEAD   8  // blocks read ahead of a sequential reader
+#define NEXTRUN    512  // most blocks an extent file allocates at once
+#define NDELAY      64  // written file blocks an inode keeps unallocated
+#define NRECLAIM   256  // blocks the reclaimer frees per transaction
+#define NBUF         (MAXOPBLOCKS*3)  // disk block cache buffers set aside at boot
+#define FAULTAROUND  16  // default max heap pages mapped per page fault
+#define MAXFAULTAROUND 64  // upper bound for faultaround()
+#define NFAULT        7  // page-fault classes, see fault.h
+#define NVMA         16  // file-backed memory ranges (exec, mmap) per process
+#define NSHM         16  // shared memory segments (shmget)
+#define SHMMAXPG     64  // pages in one shared memory segment
+#define DEMANDEXEC    1  // exec() reads program pages in on first touch
+#define NTEXT        64  // pages in the shared executable page cache
+#define NDCACHE     256  // names in the directory entry cache
+#define NPCACHE     256  // pages of file data in the page cache
+#define NSWAP       4096  // blocks of swap area on disk (512 pages)
+#define IOVMAX        8  // buffers in one readv() or writev()
+#define NPIN   (IOVMAX+2)  // user buffers pinned in memory per system call
+#ifndef MLFQ
+#define MLFQ          1  // multilevel feedback queue scheduler (make SCHED=RR: round robin)
+#endif
+#ifndef SSEMOVE
+#define SSEMOVE       0  // memmove() big copies in SSE registers (make MEMMOVE=SSE)
+#endif
+#ifndef KJUNK
+#define KJUNK         0  // kfree() fills pages with junk (make KJUNK=1)
+#endif
+#define NPRIO         3  // MLFQ priority levels, 0 highest
+#define TICKNS  10000000  // ns per timer tick (100 Hz)
+#define BOOSTTICKS  100  // ticks between MLFQ priority boosts
+#define NLAT         10  // run-queue latency histogram buckets (procinfo.h)
+#define NIRQ         32  // interrupt vectors from T_IRQ0 counted per CPU
+#define IRQBALANCE  100  // ticks between interrupt balancing (ioapic.c)
 #define FSSIZE       20000  // size of file system in blocks
 //#define FSSIZE       1000  // Por defecto mkfs inicializa el sistema de fichero con menos de 1000 bloques libres, demasiados pocos para los cambios que queremos realizar. 
 
@@ -0,0 +1,217 @@
+// Page cache.
+//
+// readi() reads the data of regular files a page (PGSIZE bytes of
+// the file, from a page boundary) at a time into pages kept here,
+// keyed by (inode, page number): a file read again is copied out
+// of memory, with no buffer cache lookups per block, and the
+// buffers the page was read through go back as the first to be
+// recycled, leaving the buffer cache to metadata.  writei() writes
+// through, to the disk path and to the cached pages, so they stay
+// current; itrunc() drops a file's pages, as does the icache when
+// it recycles or frees the inode.
+//
+// The cache holds a reference on each of its pages, and each
+// pcget() or pcadd() gives the caller another, so a page can be
+// dropped while someone copies from it.  A reader copying from a
+// page holds the inode's lock at least shared and a writer holds
+// it exclusive, so no one reads a page while it is written.  When
+// all NPCACHE entries are in use the least recently used one is
+// taken; pcshrink() gives pages back when memory runs out.
+//
+// Lock order: icache.lock, pcache.lock.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#define NPHASH 61
+
+struct cpage {
+  struct inode *ip;            // 0 if unused
+  uint pn;                     // Page number in the file
+  char *page;
+  struct cpage *hnext;         // Hash chain
+  struct cpage *prev;          // LRU list, most recent first,
+  struct cpage *next;          //   unused entries at the end
+};
+
+static struct {
+  struct spinlock lock;
+  struct cpage cpage[NPCACHE];
+  struct cpage *hash[NPHASH];
+  struct cpage head;
+} pcache;
+
+static uint
+phash(struct inode *ip, uint pn)
+{
+  return ((uint)ip / sizeof(*ip) + pn) % NPHASH;
+}
+
+static void
+lruput(struct cpage *c, int mru)
+{
+  struct cpage *h;
+
+  h = mru ? &pcache.head : pcache.head.prev;
+  c->next = h->next;
+  c->prev = h;
+  h->next->prev = c;
+  h->next = c;
+}
+
+static void
+lrudel(struct cpage *c)
+{
+  c->next->prev = c->prev;
+  c->prev->next = c->next;
+}
+
+static struct cpage*
+pfind(struct inode *ip, uint pn)
+{
+  struct cpage *c;
+
+  for(c = pcache.hash[phash(ip, pn)]; c; c = c->hnext)
+    if(c->ip == ip && c->pn == pn)
+      return c;
+  return 0;
+}
+
+// Empty entry c, which goes to the end of the LRU list.
+// Caller holds pcache.lock.
+static void
+pdrop(struct cpage *c)
+{
+  struct cpage **pp;
+
+  for(pp = &pcache.hash[phash(c->ip, c->pn)]; *pp != c; pp = &(*pp)->hnext)
+    ;
+  *pp = c->hnext;
+  c->ip->npcache--;
+  c->ip = 0;
+  kfree(c->page);
+  c->page = 0;
+  lrudel(c);
+  lruput(c, 0);
+}
+
+void
+pcinit(void)
+{
+  struct cpage *c;
+
+  initlock(&pcache.lock, "pcache");
+  pcache.head.prev = &pcache.head;
+  pcache.head.next = &pcache.head;
+  for(c = pcache.cpage; c < &pcache.cpage[NPCACHE]; c++)
+    lruput(c, 1);
+}
+
+// The cached page pn of ip, with a reference for the caller to
+// kfree(), or 0.
+char*
+pcget(struct inode *ip, uint pn)
+{
+  struct cpage *c;
+  char *page;
+
+  page = 0;
+  acquire(&pcache.lock);
+  if((c = pfind(ip, pn)) != 0){
+    lrudel(c);
+    lruput(c, 1);
+    kincref(c->page);
+    page = c->page;
+  }
+  release(&pcache.lock);
+  return page;
+}
+
+// Cache page, just read as page pn of ip, and return it with the
+// caller's reference; or, if someone got there first, free page
+// and return theirs.
+char*
+pcadd(struct inode *ip, uint pn, char *page)
+{
+  struct cpage *c;
+
+  acquire(&pcache.lock);
+  if((c = pfind(ip, pn)) != 0){
+    kincref(c->page);
+    release(&pcache.lock);
+    kfree(page);
+    return c->page;
+  }
+  c = pcache.head.prev;
+  if(c->ip)
+    pdrop(c);
+  c->ip = ip;
+  c->pn = pn;
+  c->page = page;
+  kincref(page);
+  c->hnext = pcache.hash[phash(ip, pn)];
+  pcache.hash[phash(ip, pn)] = c;
+  ip->npcache++;
+  lrudel(c);
+  lruput(c, 1);
+  release(&pcache.lock);
+  return page;
+}
+
+// n bytes from src have been written to ip at off: copy them into
+// its cached pages.  Caller holds ip->lock.
+void
+pcwrite(struct inode *ip, char *src, uint off, uint n)
+{
+  uint tot, m;
+  char *page;
+
+  if(ip->npcache == 0)
+    return;
+  for(tot = 0; tot < n; tot += m, off += m, src += m){
+    m = min(n - tot, PGSIZE - off%PGSIZE);
+    if((page = pcget(ip, off/PGSIZE)) != 0){
+      memmove(page + off%PGSIZE, src, m);
+      kfree(page);
+    }
+  }
+}
+
+// Drop the cached pages of ip.
+void
+pcinval(struct inode *ip)
+{
+  struct cpage *c;
+
+  acquire(&pcache.lock);
+  for(c = pcache.cpage; ip->npcache > 0 && c < &pcache.cpage[NPCACHE]; c++)
+    if(c->ip == ip)
+      pdrop(c);
+  release(&pcache.lock);
+}
+
+// Drop the least recently used page.  Returns the number of pages
+// dropped, 0 or 1.
+int
+pcshrink(void)
+{
+  struct cpage *c;
+  int n;
+
+  n = 0;
+  acquire(&pcache.lock);
+  c = pcache.head.prev;
+  if(c->ip){
+    pdrop(c);
+    n = 1;
+  }
+  release(&pcache.lock);
+  return n;
+}
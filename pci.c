@@ -0,0 +1,55 @@
+// PCI configuration space, through configuration mechanism #1
+// (ports 0xCF8 and 0xCFC): just enough to find a device by its
+// class and to read and write its configuration registers.
+// A device function is named by a tag, bus<<16 | dev<<11 | fn<<8.
+
+#include "types.h"
+#include "defs.h"
+#include "x86.h"
+
+#define PCICONF  0xCF8
+#define PCIDATA  0xCFC
+#define NPCIBUS  4             // Buses to look on
+
+uint
+pciread(uint tag, int off)
+{
+  outl(PCICONF, 0x80000000 | tag | (off & 0xFC));
+  return inl(PCIDATA);
+}
+
+void
+pciwrite(uint tag, int off, uint v)
+{
+  outl(PCICONF, 0x80000000 | tag | (off & 0xFC));
+  outl(PCIDATA, v);
+}
+
+// Find the first function of class class and subclass sub.
+// Returns its tag in *tag, or -1 if there is none.
+int
+pcifind(int class, int sub, uint *tag)
+{
+  uint bus, dev, fn, t, id, cl;
+
+  for(bus = 0; bus < NPCIBUS; bus++)
+    for(dev = 0; dev < 32; dev++)
+      for(fn = 0; fn < 8; fn++){
+        t = bus<<16 | dev<<11 | fn<<8;
+        id = pciread(t, 0x00);
+        if((id & 0xFFFF) == 0xFFFF){
+          if(fn == 0)
+            break;
+          continue;
+        }
+        cl = pciread(t, 0x08);
+        if((cl >> 24) == class && ((cl >> 16) & 0xFF) == sub){
+          *tag = t;
+          return 0;
+        }
+        // Only multi-function devices have functions past 0.
+        if(fn == 0 && (pciread(t, 0x0C) & 0x800000) == 0)
+          break;
+      }
+  return -1;
+}
@@ -2,23 +2,65 @@
 #include "defs.h"
 #include "param.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "fs.h"
-#include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
+#include "slab.h"
+
+#define min(a, b) ((a) < (b) ? (a) : (b))
 
-#define PIPESIZE 512
+// The ring is PIPEPG pages, and fcntl(F_SETPIPE_SZ) can make it
+// up to PIPEMAXPG, a power of two of them so that the byte counts
+// map to the same place in it when they wrap.  Data is copied in
+// runs, up to the end of a page or of what there is room for, and
+// each side only wakes the other when it might be waiting: the
+// reader when there was nothing to read, the writer when a read
+// takes the room in the ring above a quarter of it.
+#define PIPEPG     1
+#define PIPEMAXPG  16
 
 struct pipe {
   struct spinlock lock;
-  char data[PIPESIZE];
+  char *page[PIPEMAXPG];
+  uint size;      // bytes in the ring
   uint nread;     // number of bytes read
   uint nwrite;    // number of bytes written
   int readopen;   // read fd is still open
   int writeopen;  // write fd is still open
 };
 
+// Several pipes share a page instead of taking one each.
+static struct slabcache pipecache;
+
+void
+pipeinit(void)
+{
+  slabinit(&pipecache, "pipe", sizeof(struct pipe));
+}
+
+static void
+pagesfree(char **page, int n)
+{
+  while(n-- > 0)
+    kfree(page[n]);
+}
+
+static int
+pagesalloc(char **page, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++){
+    if((page[i] = kalloc()) == 0){
+      pagesfree(page, i);
+      return -1;
+    }
+  }
+  return 0;
+}
+
 int
 pipealloc(struct file **f0, struct file **f1)
 {
@@ -28,8 +70,14 @@ pipealloc(struct file **f0, struct file **f1)
   *f0 = *f1 = 0;
   if((*f0 = filealloc()) == 0 || (*f1 = filealloc()) == 0)
     goto bad;
-  if((p = (struct pipe*)kalloc()) == 0)
+  if((p = slaballoc(&pipecache)) == 0)
     goto bad;
+  if(pagesalloc(p->page, PIPEPG) < 0){
+    slabfree(&pipecache, p);
+    p = 0;
+    goto bad;
+  }
+  p->size = PIPEPG*PGSIZE;
   p->readopen = 1;
   p->writeopen = 1;
   p->nwrite = 0;
@@ -47,8 +95,10 @@ pipealloc(struct file **f0, struct file **f1)
 
 //PAGEBREAK: 20
  bad:
-  if(p)
-    kfree((char*)p);
+  if(p){
+    pagesfree(p->page, PIPEPG);
+    slabfree(&pipecache, p);
+  }
   if(*f0)
     fileclose(*f0);
   if(*f1)
@@ -69,30 +119,54 @@ pipeclose(struct pipe *p, int writable)
   }
   if(p->readopen == 0 && p->writeopen == 0){
     release(&p->lock);
-    kfree((char*)p);
+    freelock(&p->lock);
+    pagesfree(p->page, p->size / PGSIZE);
+    slabfree(&pipecache, p);
   } else
     release(&p->lock);
 }
 
+// Where byte count i of p is in the ring, and how many bytes
+// follow it on the same page.
+static char*
+ringat(struct pipe *p, uint i, uint *n)
+{
+  uint off;
+
+  off = i & (p->size - 1);
+  *n = PGSIZE - off % PGSIZE;
+  return p->page[off / PGSIZE] + off % PGSIZE;
+}
+
 //PAGEBREAK: 40
 int
 pipewrite(struct pipe *p, char *addr, int n)
 {
-  int i;
+  int i, wake;
+  uint m, k;
+  char *r;
 
   acquire(&p->lock);
-  for(i = 0; i < n; i++){
-    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
+  wake = 0;
+  for(i = 0; i < n; i += m){
+    while(p->nwrite == p->nread + p->size){  //DOC: pipewrite-full
       if(p->readopen == 0 || myproc()->killed){
         release(&p->lock);
         return -1;
       }
       wakeup(&p->nread);
+      wake = 0;
       sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
     }
-    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+    if(p->nwrite == p->nread)
+      wake = 1;   // a reader may be waiting
+    r = ringat(p, p->nwrite, &k);
+    m = min(n - i, min(k, p->nread + p->size - p->nwrite));
+    memmove(r, addr + i, m);
+    p->nwrite += m;
   }
-  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+  if(wake)
+    wakeup(&p->nread);  //DOC: pipewrite-wakeup1
   release(&p->lock);
   return n;
 }
@@ -101,6 +175,8 @@ int
 piperead(struct pipe *p, char *addr, int n)
 {
   int i;
+  uint m, k, room;
+  char *r;
 
   acquire(&p->lock);
   while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
@@ -110,12 +186,61 @@ piperead(struct pipe *p, char *addr, int n)
     }
     sleep(&p->nread, &p->lock); //DOC: piperead-sleep
   }
-  for(i = 0; i < n; i++){  //DOC: piperead-copy
-    if(p->nread == p->nwrite)
-      break;
-    addr[i] = p->data[p->nread++ % PIPESIZE];
+  room = p->size - (p->nwrite - p->nread);
+  for(i = 0; i < n && p->nread != p->nwrite; i += m){  //DOC: piperead-copy
+    r = ringat(p, p->nread, &k);
+    m = min(n - i, min(k, p->nwrite - p->nread));
+    memmove(addr + i, r, m);
+    p->nread += m;
   }
-  wakeup(&p->nwrite);  //DOC: piperead-wakeup
+  if(room < p->size/4 && p->size - (p->nwrite - p->nread) >= p->size/4)
+    wakeup(&p->nwrite);  //DOC: piperead-wakeup
   release(&p->lock);
   return i;
 }
+
+// Resize p's ring to n bytes, rounded up to a power of two pages.
+// Fails if that is too many or the data in the ring does not fit.
+int
+pipesetsize(struct pipe *p, int n)
+{
+  char *page[PIPEMAXPG], *old[PIPEMAXPG], *r;
+  uint npg, oldnpg, i, k, m, size;
+
+  if(n <= 0 || n > PIPEMAXPG*PGSIZE)
+    return -1;
+  for(npg = 1; npg*PGSIZE < n; npg *= 2)
+    ;
+  if(pagesalloc(page, npg) < 0)
+    return -1;
+  size = npg*PGSIZE;
+
+  acquire(&p->lock);
+  if(p->nwrite - p->nread > size){
+    release(&p->lock);
+    pagesfree(page, npg);
+    return -1;
+  }
+  // Copy the data to where the byte counts put it in the new ring.
+  for(i = p->nread; i != p->nwrite; i += m){
+    r = ringat(p, i, &k);
+    m = min(k, p->nwrite - i);
+    k = i & (size - 1);
+    m = min(m, PGSIZE - k % PGSIZE);
+    memmove(page[k / PGSIZE] + k % PGSIZE, r, m);
+  }
+  oldnpg = p->size / PGSIZE;
+  memmove(old, p->page, sizeof(old));
+  memmove(p->page, page, sizeof(page));
+  p->size = size;
+  wakeup(&p->nwrite);
+  release(&p->lock);
+  pagesfree(old, oldnpg);
+  return size;
+}
+
+int
+pipesize(struct pipe *p)
+{
+  return p->size;
+}
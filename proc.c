@@ -4,26 +4,338 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "x86.h"
-#include "proc.h"
+#include "traps.h"
 #include "spinlock.h"
-
+#include "proc.h"
+#include "sleeplock.h"
+#include "slab.h"
+#include "fault.h"
+#include "procinfo.h"
+#include "trace.h"
+
+// There is no lock over the whole table.  Each process has its
+// own, p->lock, which protects its state and what goes with it
+// (chan, killed, its place on a run queue or sleepq list), and
+// which the scheduler holds across the switch to and from it.
+// treelock protects the family links (parent, children,
+// sibling), the threads' shared aspace ref and the reaping of
+// zombies, so fork(), exit() and wait() serialize on it but
+// sleep(), wakeup() and the scheduler never touch it.  pidlock
+// guards nextpid.  Lock order:
+//   treelock, then sleepq[].lock, then p->lock, then runq[].lock
+// and no one holds two processes' locks at once.
 struct {
-  struct spinlock lock;
+  struct spinlock treelock;
+  struct spinlock pidlock;
   struct proc proc[NPROC];
 } ptable;
 
+// Each CPU has a queue of the RUNNABLE processes waiting for it,
+// so the scheduler never has to scan ptable: a process is on
+// exactly one queue while it is RUNNABLE, and on none otherwise.
+// A CPU whose queue is empty steals from the others.  Processes
+// are queued with their p->lock held (lock order: p->lock, then
+// runq[].lock); the scheduler and stealers take a queue's lock on
+// its own and then the lock of the process they took off it.
+//
+// With MLFQ (param.h) a queue has one FIFO list per priority
+// level, and the scheduler always takes from the highest level
+// that has a process.  A process that uses up the quantum of its
+// level drops one level; one that sleeps before that keeps it.
+// Every BOOSTTICKS ticks schedboost() puts every process back at
+// its base level (setpriority()), so demoted processes do not
+// starve.  Without MLFQ everything stays at level 0: plain round
+// robin, one tick each.
+struct runq {
+  struct spinlock lock;
+  struct proc *head[NPRIO];
+  struct proc *tail[NPRIO];
+  int n;                       // Length; read without the lock as a hint
+} runq[NCPU];
+
+// Sleeping processes hang off a hash table keyed by chan, so
+// wakeup() only looks at processes that may be sleeping on its
+// chan.  Each list has a lock of its own, which sleep() takes
+// before it lets go of the caller's lock and holds until the
+// process is on the list, so a wakeup() on chan either finds it
+// there or ran before the sleeper's check.
+#define NSLEEPQ 64
+#define SLEEPHASH(chan) (((uint)(chan) * 2654435761U) >> 26)
+
+static struct sleepq {
+  struct spinlock lock;
+  struct proc *head;
+} sleepq[NSLEEPQ];
+
+// Ticks a process may run at each level before it is demoted.
+static int quantum[NPRIO] = { 1, 2, 8 };
+
+#define LEVEL(p) (MLFQ ? (p)->prio : 0)
+
+// An address space shared by threads made with clone().  The
+// threads keep their own copies of sz and vma[]: setsz() updates
+// the sz of all of them, and mmap() and munmap() are refused while
+// a space is shared, so vma[] never changes.  lock serializes page
+// faults and sbrk() on the space.  A process that never called
+// clone() has none (p->as == 0) and needs no locking.
+struct aspace {
+  int ref;                     // Threads using it; protected by treelock
+  struct sleeplock lock;
+};
+
+static struct slabcache ascache;
+
 static struct proc *initproc;
+extern pde_t *kpgdir;
+
+// The clock hand of swapvictim().
+static struct {
+  struct spinlock lock;
+  int proc;                    // Process index
+  uint va;                     //   and address within it
+} hand;
 
 int nextpid = 1;
 extern void forkret(void);
 extern void trapret(void);
 
-static void wakeup1(void *chan);
+static void reap(struct proc *p);
 
 void
 pinit(void)
 {
-  initlock(&ptable.lock, "ptable");
+  struct proc *p;
+  int i;
+
+  initlock(&ptable.treelock, "proctree");
+  initlock(&ptable.pidlock, "pid");
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+    initlock(&p->lock, "proc");
+  for(i = 0; i < NSLEEPQ; i++)
+    initlock(&sleepq[i].lock, "sleepq");
+  initlock(&hand.lock, "swaphand");
+  for(i = 0; i < NCPU; i++)
+    initlock(&runq[i].lock, "runq");
+  slabinit(&ascache, "aspace", sizeof(struct aspace));
+}
+
+// Make c a child of p.  Caller must hold treelock.
+static void
+addchild(struct proc *p, struct proc *c)
+{
+  c->parent = p;
+  c->sibprev = 0;
+  c->sibling = p->children;
+  if(p->children)
+    p->children->sibprev = c;
+  p->children = c;
+}
+
+// Take c off its parent's list of children.
+// Caller must hold treelock.
+static void
+delchild(struct proc *c)
+{
+  if(c->sibprev)
+    c->sibprev->sibling = c->sibling;
+  else
+    c->parent->children = c->sibling;
+  if(c->sibling)
+    c->sibling->sibprev = c->sibprev;
+  c->sibling = c->sibprev = 0;
+  c->parent = 0;
+}
+
+// Put p, about to sleep on p->chan, on its sleepq list.
+// Caller must hold the list's lock and p->lock.
+static void
+sleepenq(struct proc *p)
+{
+  struct proc **h;
+
+  h = &sleepq[SLEEPHASH(p->chan)].head;
+  p->sleepprev = 0;
+  p->sleepnext = *h;
+  if(*h)
+    (*h)->sleepprev = p;
+  *h = p;
+}
+
+// Take the sleeping p off its sleepq list.
+// Caller must hold the list's lock and p->lock.
+static void
+sleepdeq(struct proc *p)
+{
+  if(p->sleepprev)
+    p->sleepprev->sleepnext = p->sleepnext;
+  else
+    sleepq[SLEEPHASH(p->chan)].head = p->sleepnext;
+  if(p->sleepnext)
+    p->sleepnext->sleepprev = p->sleepprev;
+  p->sleepnext = p->sleepprev = 0;
+}
+
+// Append p to q at its level.  Caller must hold q->lock.
+static void
+rqpush(struct runq *q, struct proc *p)
+{
+  int k;
+
+  k = LEVEL(p);
+  p->rqnext = 0;
+  if(q->tail[k])
+    q->tail[k]->rqnext = p;
+  else
+    q->head[k] = p;
+  q->tail[k] = p;
+  q->n++;
+}
+
+#define ONCPU(p, i) ((p)->cpumask & (1 << (i)))
+
+// A CPU for p to queue on when the one it last ran on is not in
+// its affinity mask: this one if allowed, else the allowed CPU
+// with the shortest queue.
+static int
+pickcpu(struct proc *p)
+{
+  int i, best;
+
+  if(ONCPU(p, cpuid()))
+    return cpuid();
+  best = -1;
+  for(i = 0; i < ncpu; i++)
+    if(ONCPU(p, i) && (best < 0 || runq[i].n < runq[best].n))
+      best = i;
+  if(best < 0)
+    panic("pickcpu");
+  return best;
+}
+
+// Mark p RUNNABLE and put it at the tail of the queue of the CPU
+// it last ran on (the current CPU for a new process), so that it
+// finds its caches and TLB warm there, unless its affinity mask
+// no longer allows that CPU.
+// Caller must hold p->lock.
+static void
+setrunnable(struct proc *p)
+{
+  struct runq *q;
+  struct cpu *c;
+
+  if(!holding(&p->lock))
+    panic("setrunnable");
+  if(p->lastcpu < 0 || !ONCPU(p, p->lastcpu))
+    p->lastcpu = pickcpu(p);
+  q = &runq[p->lastcpu];
+  p->state = RUNNABLE;
+  p->tsc = rdtsc();
+  acquire(&q->lock);
+  rqpush(q, p);
+  release(&q->lock);
+
+  // If that CPU is halted, wake it up; if it is busy, wake some
+  // halted CPU that p may run on instead so that it steals p.
+  // The barrier orders the queue update before the reads of
+  // idle; scheduler() does the opposite.
+  __sync_synchronize();
+  c = &cpus[p->lastcpu];
+  if(!c->idle)
+    for(c = cpus; c < &cpus[ncpu] && !(c->idle && ONCPU(p, c-cpus)); c++)
+      ;
+  if(c < &cpus[ncpu] && c != mycpu())
+    lapicipi(c->apicid, T_IRQ0 + IRQ_RESCHED);
+}
+
+// Find the first process of the highest non-empty level of q
+// that may run on CPU cpu, or just the process want if it is not
+// 0, and unlink it from q if take is set.
+// Caller must hold q->lock.
+static struct proc*
+rqfind(struct runq *q, int cpu, struct proc *want, int take)
+{
+  struct proc *p, *prev;
+  int k;
+
+  for(k = 0; k < NPRIO; k++){
+    prev = 0;
+    for(p = q->head[k]; p; prev = p, p = p->rqnext){
+      if(want ? p != want : !ONCPU(p, cpu))
+        continue;
+      if(!take)
+        return p;
+      if(prev)
+        prev->rqnext = p->rqnext;
+      else
+        q->head[k] = p->rqnext;
+      if(q->tail[k] == p)
+        q->tail[k] = prev;
+      q->n--;
+      p->rqnext = 0;
+      return p;
+    }
+  }
+  return 0;
+}
+
+// Is there a process queued on any CPU that CPU cpu may run?
+static int
+rqany(int cpu)
+{
+  struct runq *q;
+  int i, found;
+
+  for(i = 0; i < ncpu; i++){
+    q = &runq[i];
+    if(q->n == 0)
+      continue;
+    acquire(&q->lock);
+    found = rqfind(q, cpu, 0, 0) != 0;
+    release(&q->lock);
+    if(found)
+      return 1;
+  }
+  return 0;
+}
+
+// Take the first process of the highest non-empty level of CPU
+// i's queue that may run on CPU cpu, or return 0.
+static struct proc*
+rqpop(int i, int cpu)
+{
+  struct runq *q;
+  struct proc *p;
+
+  q = &runq[i];
+  if(q->n == 0)
+    return 0;
+  acquire(&q->lock);
+  p = rqfind(q, cpu, 0, 1);
+  release(&q->lock);
+  return p;
+}
+
+// CPU i has nothing to run: take a process it may run from the
+// CPU with the longest queue, or failing that from any other, or
+// return 0.
+static struct proc*
+rqsteal(int i)
+{
+  struct proc *p;
+  int j, best;
+
+  best = -1;
+  for(j = 0; j < ncpu; j++)
+    if(j != i && runq[j].n > 0 && (best < 0 || runq[j].n > runq[best].n))
+      best = j;
+  if(best < 0)
+    return 0;
+  if((p = rqpop(best, i)) != 0)
+    return p;
+  for(j = 0; j < ncpu; j++)
+    if(j != i && j != best && (p = rqpop(j, i)) != 0)
+      return p;
+  return 0;
 }
 
 // Must be called with interrupts disabled
@@ -65,6 +377,32 @@ myproc(void) {
   return p;
 }
 
+static int
+allocpid(void)
+{
+  int pid;
+
+  acquire(&ptable.pidlock);
+  pid = nextpid++;
+  release(&ptable.pidlock);
+  return pid;
+}
+
+// The process with the given pid, with its lock held, or 0.
+static struct proc*
+findproc(int pid)
+{
+  struct proc *p;
+
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    acquire(&p->lock);
+    if(p->pid == pid && p->state != UNUSED)
+      return p;
+    release(&p->lock);
+  }
+  return 0;
+}
+
 //PAGEBREAK: 32
 // Look in the process table for an UNUSED proc.
 // If found, change state to EMBRYO and initialize
@@ -76,20 +414,48 @@ allocproc(void)
   struct proc *p;
   char *sp;
 
-  acquire(&ptable.lock);
-
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    acquire(&p->lock);
     if(p->state == UNUSED)
       goto found;
-
-  release(&ptable.lock);
+    release(&p->lock);
+  }
   return 0;
 
 found:
   p->state = EMBRYO;
-  p->pid = nextpid++;
-
-  release(&ptable.lock);
+  release(&p->lock);
+
+  // The rest of an EMBRYO is ours alone.
+  p->pid = allocpid();
+  p->lastcpu = -1;
+  p->cpumask = ~0;
+  p->cputime = p->waittime = 0;
+  p->nvcsw = p->nivcsw = 0;
+  memset(p->lat, 0, sizeof(p->lat));
+  p->children = 0;
+  p->prio = p->baseprio = 0;
+  p->ticks = 0;
+  p->faultaround = FAULTAROUND;
+  p->largepages = 0;
+  p->faultwin = 0;
+  p->faultnext = 0;
+  memset(p->faults, 0, sizeof(p->faults));
+  p->rss = 0;
+  memset(p->vma, 0, sizeof(p->vma));
+  p->mmapbot = CLOCKPAGE;
+  p->npin = 0;
+  p->as = 0;
+  p->ustack = 0;
+  p->ofile = p->ofile0;
+  p->nofile = NOFILE0;
+
+  // The system call counters' page stays with the slot.
+  if(p->sc == 0 && (p->sc = (struct syscount*)kalloc()) == 0){
+    p->state = UNUSED;
+    return 0;
+  }
+  memset(p->sc, 0, PGSIZE);
 
   // Allocate kernel stack.
   if((p->kstack = kalloc()) == 0){
@@ -130,6 +496,7 @@ userinit(void)
     panic("userinit: out of memory?");
   inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
   p->sz = PGSIZE;
+  p->rss = 1;
   memset(p->tf, 0, sizeof(*p->tf));
   p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
   p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
@@ -146,15 +513,39 @@ userinit(void)
   // run this process. the acquire forces the above
   // writes to be visible, and the lock is also needed
   // because the assignment might not be atomic.
-  acquire(&ptable.lock);
+  acquire(&p->lock);
 
-  p->state = RUNNABLE;
+  setrunnable(p);
+
+  release(&p->lock);
+}
 
-  release(&ptable.lock);
+// Start a kernel thread running fn, which must never return.
+// It has no user memory, runs on the kernel page table, cannot be
+// killed, and is nobody's child.  Its first scheduling goes
+// through forkret(), which "returns" into fn instead of trapret.
+void
+kthread(char *name, void (*fn)(void))
+{
+  struct proc *p;
+
+  if((p = allocproc()) == 0)
+    panic("kthread");
+  p->pgdir = kpgdir;
+  p->sz = 0;
+  *(uint*)(p->context + 1) = (uint)fn;
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  acquire(&p->lock);
+  setrunnable(p);
+  release(&p->lock);
 }
 
 // Grow current process's memory by n bytes.
 // Return 0 on success, -1 on failure.
+// A shared address space cannot shrink: other CPUs may still
+// have the freed pages in their TLBs.
+// Caller must hold vmlock().
 int
 growproc(int n)
 {
@@ -165,22 +556,155 @@ growproc(int n)
   if(n > 0){
     if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
       return -1;
+    __sync_fetch_and_add(&curproc->rss,
+                         (PGROUNDUP(sz) - PGROUNDUP(curproc->sz)) / PGSIZE);
   } else if(n < 0){
-    if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    if(curproc->as || sz + n > sz)
+      return -1;
+    if(uvmsplit(curproc->pgdir, sz + n) < 0)
       return -1;
+    curproc->rss -= deallocuvm(curproc->pgdir, sz, sz + n);
+    sz += n;
+    vmatrim(curproc, sz);
   }
-  curproc->sz = sz;
+  setsz(curproc, sz);
   switchuvm(curproc);
   return 0;
 }
 
+// Set the size of p's memory, and of the threads sharing it.
+void
+setsz(struct proc *p, uint sz)
+{
+  struct proc *q;
+
+  p->sz = sz;
+  if(p->as == 0)
+    return;
+  acquire(&ptable.treelock);
+  for(q = ptable.proc; q < &ptable.proc[NPROC]; q++)
+    if(q->as == p->as && q->state != UNUSED && q->state != ZOMBIE)
+      q->sz = sz;
+  release(&ptable.treelock);
+}
+
+// Lock p's address space against the other threads, if it has any.
+void
+vmlock(struct proc *p)
+{
+  if(p->as)
+    acquiresleep(&p->as->lock);
+}
+
+void
+vmunlock(struct proc *p)
+{
+  if(p->as)
+    releasesleep(&p->as->lock);
+}
+
+// p stops using its shared address space (exit() or exec()); it
+// must not be running on that page table any more.  Returns 1 if
+// p was the last thread, or had none: the caller then owns the
+// page table and must free it.  Otherwise p's share of the
+// resident page count goes to one of the threads that stay.
+int
+asput(struct proc *p)
+{
+  struct proc *q;
+  int last;
+
+  if(p->as == 0)
+    return 1;
+  acquire(&ptable.treelock);
+  last = --p->as->ref == 0;
+  if(last){
+    freesleeplock(&p->as->lock);
+    slabfree(&ascache, p->as);
+  } else {
+    for(q = ptable.proc; q < &ptable.proc[NPROC]; q++)
+      if(q != p && q->as == p->as)
+        break;
+    __sync_fetch_and_add(&q->rss, p->rss);
+    p->rss = 0;
+  }
+  p->as = 0;
+  release(&ptable.treelock);
+  return last;
+}
+
+// Grow p's descriptor table from the NOFILE0 slots in struct
+// proc to a page of NOFILE.  Returns 0, or -1 if out of memory.
+int
+fdgrow(struct proc *p)
+{
+  struct file **t;
+
+  if(p->nofile == NOFILE)
+    return 0;
+  if((t = (struct file**)kzalloc()) == 0)
+    return -1;
+  memmove(t, p->ofile0, sizeof(p->ofile0));
+  memset(p->ofile0, 0, sizeof(p->ofile0));
+  p->ofile = t;
+  p->nofile = NOFILE;
+  return 0;
+}
+
+// Back to the table in struct proc, whose slots are all closed.
+static void
+fdshrink(struct proc *p)
+{
+  if(p->ofile != p->ofile0)
+    kfree((char*)p->ofile);
+  p->ofile = p->ofile0;
+  p->nofile = NOFILE0;
+}
+
+// Undo allocproc() for a process that never ran.
+static void
+unalloc(struct proc *p)
+{
+  fdshrink(p);
+  kfree(p->kstack);
+  p->kstack = 0;
+  p->state = UNUSED;
+}
+
+// Give np what fork() and clone() copy from p besides memory:
+// open files, current directory, file-backed ranges and settings.
+// np's descriptor table must be as big as p's.
+static void
+inherit(struct proc *np, struct proc *p)
+{
+  int i;
+
+  np->sz = p->sz;
+  np->paginaInvalida = p->paginaInvalida;
+  np->faultaround = p->faultaround;
+  np->largepages = p->largepages;
+  np->prio = np->baseprio = p->baseprio;
+  np->cpumask = p->cpumask;
+  np->mmapbot = p->mmapbot;
+  for(i = 0; i < p->nofile; i++)
+    if(p->ofile[i])
+      np->ofile[i] = filedup(p->ofile[i]);
+  np->cwd = idup(p->cwd);
+  for(i = 0; i < NVMA; i++){
+    np->vma[i] = p->vma[i];
+    if(np->vma[i].ip)
+      idup(np->vma[i].ip);
+  }
+  safestrcpy(np->name, p->name, sizeof(p->name));
+}
+
 // Create a new process copying p as the parent.
 // Sets up stack to return as if from system call.
 // Caller must set state of returned proc to RUNNABLE.
 int
 fork(void)
 {
-  int i, pid;
+  int pid;
   struct proc *np;
   struct proc *curproc = myproc();
 
@@ -188,35 +712,194 @@ fork(void)
   if((np = allocproc()) == 0){
     return -1;
   }
+  if(curproc->nofile > np->nofile && fdgrow(np) < 0){
+    unalloc(np);
+    return -1;
+  }
 
-  // Copy process state from proc.
-  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
-    kfree(np->kstack);
-    np->kstack = 0;
-    np->state = UNUSED;
+  // Copy process state from proc.  copyuvm() makes the caller's
+  // pages read-only, so threads on other CPUs must drop their
+  // writable TLB entries.
+  vmlock(curproc);
+  np->pgdir = copyuvm(curproc->pgdir, curproc->sz, curproc->mmapbot,
+                     &np->rss);
+  if(np->pgdir && curproc->as)
+    tlbshootdown();
+  vmunlock(curproc);
+  if(np->pgdir == 0){
+    unalloc(np);
     return -1;
   }
-  np->sz = curproc->sz;
-  np->parent = curproc;
   *np->tf = *curproc->tf;
 
   // Clear %eax so that fork returns 0 in the child.
   np->tf->eax = 0;
 
-  for(i = 0; i < NOFILE; i++)
-    if(curproc->ofile[i])
-      np->ofile[i] = filedup(curproc->ofile[i]);
-  np->cwd = idup(curproc->cwd);
+  inherit(np, curproc);
+
+  pid = np->pid;
+
+  acquire(&ptable.treelock);
+  addchild(curproc, np);
+  release(&ptable.treelock);
+
+  acquire(&np->lock);
+  setrunnable(np);
+  release(&np->lock);
+
+  return pid;
+}
+
+// Create a thread: a process that shares the caller's page table,
+// starts at fn with its stack pointer at stack (the top of a stack
+// the caller allocated) and arg as its argument, and returns to
+// the fake PC 0xffffffff if fn returns, so fn must call exit().
+// The thread gets duplicates of the caller's open files, like
+// fork().  Returns the thread's pid, or -1 on error.
+int
+clone(uint fn, uint stack, uint arg)
+{
+  int pid;
+  uint sp, ustack[2];
+  struct proc *np;
+  struct proc *curproc = myproc();
+
+  sp = stack - sizeof(ustack);
+  if((stack & 3) || sp > stack)
+    return -1;
+  ustack[0] = 0xffffffff;  // fake return PC
+  ustack[1] = arg;
+  if(uvmcopyout(curproc, sp, ustack, sizeof(ustack)) < 0)
+    return -1;
 
-  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+  if((np = allocproc()) == 0)
+    return -1;
+  if(curproc->nofile > np->nofile && fdgrow(np) < 0){
+    unalloc(np);
+    return -1;
+  }
+  if(curproc->as == 0){
+    if((curproc->as = slaballoc(&ascache)) == 0){
+      unalloc(np);
+      return -1;
+    }
+    curproc->as->ref = 1;
+    initsleeplock(&curproc->as->lock, "aspace");
+  }
+
+  np->pgdir = curproc->pgdir;
+  np->as = curproc->as;
+  np->ustack = stack;
+  *np->tf = *curproc->tf;
+  np->tf->eip = fn;
+  np->tf->esp = sp;
+  np->tf->eax = 0;
+  inherit(np, curproc);
 
   pid = np->pid;
 
-  acquire(&ptable.lock);
+  acquire(&ptable.treelock);
+  np->as->ref++;
+  addchild(curproc, np);
+  release(&ptable.treelock);
 
-  np->state = RUNNABLE;
+  acquire(&np->lock);
+  setrunnable(np);
+  release(&np->lock);
+
+  return pid;
+}
 
-  release(&ptable.lock);
+// Wait for a thread made by this process with clone() to exit and
+// return its pid; *stack is set to the stack it was given.
+// Return -1 if this process has no threads.  wait() leaves
+// threads (p->ustack != 0) alone.
+int
+join(uint *stack)
+{
+  struct proc *p;
+  int havekids, pid;
+  struct proc *curproc = myproc();
+
+  acquire(&ptable.treelock);
+  for(;;){
+    havekids = 0;
+    for(p = curproc->children; p; p = p->sibling){
+      if(p->ustack == 0)
+        continue;
+      havekids = 1;
+      if(p->state == ZOMBIE){
+        pid = p->pid;
+        *stack = p->ustack;
+        acquire(&p->lock);
+        reap(p);
+        release(&p->lock);
+        release(&ptable.treelock);
+        return pid;
+      }
+    }
+
+    if(!havekids || curproc->killed){
+      release(&ptable.treelock);
+      return -1;
+    }
+
+    sleep(curproc, &ptable.treelock);  //DOC: wait-sleep
+  }
+}
+
+// Create a new process running the program at path, like fork()
+// followed by exec() in the child, but without copying the
+// caller's address space first.  The child gets only file
+// descriptors 0, 1 and 2: fd i is a duplicate of the caller's fd
+// fds[i], or stays closed if fds[i] < 0.  If fds is 0 the child
+// gets the caller's own 0, 1 and 2.
+// Returns the child's pid, or -1 on error.
+int
+spawn(char *path, char **argv, int *fds)
+{
+  int i, fd, pid;
+  struct proc *np;
+  struct proc *curproc = myproc();
+
+  if(fds){
+    for(i = 0; i < 3; i++)
+      if(fds[i] >= curproc->nofile || (fds[i] >= 0 && curproc->ofile[fds[i]] == 0))
+        return -1;
+  }
+
+  // Allocate process.
+  if((np = allocproc()) == 0){
+    return -1;
+  }
+  np->faultaround = curproc->faultaround;
+  np->largepages = curproc->largepages;
+  np->prio = np->baseprio = curproc->baseprio;
+  np->cpumask = curproc->cpumask;
+  *np->tf = *curproc->tf;
+  np->tf->eax = 0;
+
+  if(execproc(np, path, argv) < 0){
+    unalloc(np);
+    return -1;
+  }
+
+  for(i = 0; i < 3; i++){
+    fd = fds ? fds[i] : i;
+    if(fd >= 0 && curproc->ofile[fd])
+      np->ofile[i] = filedup(curproc->ofile[fd]);
+  }
+  np->cwd = idup(curproc->cwd);
+
+  pid = np->pid;
+
+  acquire(&ptable.treelock);
+  addchild(curproc, np);
+  release(&ptable.treelock);
+
+  acquire(&np->lock);
+  setrunnable(np);
+  release(&np->lock);
 
   return pid;
 }
@@ -229,44 +912,87 @@ exit(void)
 {
   struct proc *curproc = myproc();
   struct proc *p;
+  pde_t *pgdir;
   int fd;
 
   if(curproc == initproc)
     panic("init exiting");
 
   // Close all open files.
-  for(fd = 0; fd < NOFILE; fd++){
+  for(fd = 0; fd < curproc->nofile; fd++){
     if(curproc->ofile[fd]){
       fileclose(curproc->ofile[fd]);
       curproc->ofile[fd] = 0;
     }
   }
+  fdshrink(curproc);
+
+  // A thread moves to the kernel page table before letting go of
+  // the shared one, which the last thread out frees.  Only that
+  // one writes back shared mappings; the others just drop the
+  // mapped files.
+  pgdir = curproc->pgdir;
+  if(curproc->as){
+    pushcli();
+    curproc->pgdir = kpgdir;
+    switchkvm();
+    popcli();
+  }
+  if(asput(curproc)){
+    curproc->pgdir = pgdir;
+    vmaput(pgdir, curproc->vma);
+  } else
+    vmaput(0, curproc->vma);
 
   begin_op();
   iput(curproc->cwd);
   end_op();
   curproc->cwd = 0;
 
-  acquire(&ptable.lock);
+  acquire(&ptable.treelock);
 
   // Parent might be sleeping in wait().
-  wakeup1(curproc->parent);
-
-  // Pass abandoned children to init.
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->parent == curproc){
-      p->parent = initproc;
-      if(p->state == ZOMBIE)
-        wakeup1(initproc);
-    }
+  wakeup(curproc->parent);
+
+  // Pass abandoned children to init, which reaps threads too.
+  while((p = curproc->children) != 0){
+    delchild(p);
+    p->ustack = 0;
+    addchild(initproc, p);
+    if(p->state == ZOMBIE)
+      wakeup(initproc);
   }
 
-  // Jump into the scheduler, never to return.
+  // Jump into the scheduler, never to return.  The parent sees
+  // ZOMBIE under treelock, and its wait() then takes our lock,
+  // which the scheduler lets go of only once we are off this
+  // stack.
+  acquire(&curproc->lock);
   curproc->state = ZOMBIE;
+  release(&ptable.treelock);
   sched();
   panic("zombie exit");
 }
 
+// Free the zombie child p.  Its page table goes too, unless p
+// was a thread that left it to others (see exit()).
+// Caller must hold treelock and p->lock.
+static void
+reap(struct proc *p)
+{
+  kfree(p->kstack);
+  p->kstack = 0;
+  if(p->pgdir != kpgdir)
+    freevm(p->pgdir);
+  p->pgdir = 0;
+  p->ustack = 0;
+  delchild(p);
+  p->pid = 0;
+  p->name[0] = 0;
+  p->killed = 0;
+  p->state = UNUSED;
+}
+
 // Wait for a child process to exit and return its pid.
 // Return -1 if this process has no children.
 int
@@ -276,41 +1002,58 @@ wait(void)
   int havekids, pid;
   struct proc *curproc = myproc();
   
-  acquire(&ptable.lock);
+  acquire(&ptable.treelock);
   for(;;){
-    // Scan through table looking for exited children.
+    // Scan through our children looking for exited ones.
+    // Threads made by clone() are for join().
     havekids = 0;
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->parent != curproc)
+    for(p = curproc->children; p; p = p->sibling){
+      if(p->ustack)
         continue;
       havekids = 1;
       if(p->state == ZOMBIE){
         // Found one.
         pid = p->pid;
-        kfree(p->kstack);
-        p->kstack = 0;
-        freevm(p->pgdir);
-        p->pid = 0;
-        p->parent = 0;
-        p->name[0] = 0;
-        p->killed = 0;
-        p->state = UNUSED;
-        release(&ptable.lock);
+        acquire(&p->lock);
+        sysstatadd(curproc, p);
+        reap(p);
+        release(&p->lock);
+        release(&ptable.treelock);
         return pid;
       }
     }
 
     // No point waiting if we don't have any children.
     if(!havekids || curproc->killed){
-      release(&ptable.lock);
+      release(&ptable.treelock);
       return -1;
     }
 
-    // Wait for children to exit.  (See wakeup1 call in proc_exit.)
-    sleep(curproc, &ptable.lock);  //DOC: wait-sleep
+    // Wait for children to exit.  (See wakeup call in proc_exit.)
+    sleep(curproc, &ptable.treelock);  //DOC: wait-sleep
   }
 }
 
+// p, RUNNABLE since p->tsc, is being dispatched on c: count its
+// run-queue latency and start its on-CPU time.
+// Caller must hold p->lock.
+static void
+account(struct cpu *c, struct proc *p)
+{
+  uint64 now, lat;
+  int k;
+
+  now = rdtsc();
+  lat = now - p->tsc;
+  p->waittime += lat;
+  p->tsc = now;
+  for(k = 0; k < NLAT-1 && lat >= (1ULL << (10 + 2*k)); k++)
+    ;
+  p->lat[k]++;
+  c->lat[k]++;
+  c->nswitch++;
+}
+
 //PAGEBREAK: 42
 // Per-CPU process scheduler.
 // Each CPU calls scheduler() after setting itself up.
@@ -322,40 +1065,79 @@ wait(void)
 void
 scheduler(void)
 {
-  struct proc *p;
+  struct proc *p, *next;
   struct cpu *c = mycpu();
+  uint64 t;
+  int me;
   c->proc = 0;
+  me = c - cpus;
   
   for(;;){
     // Enable interrupts on this processor.
     sti();
 
-    // Loop over process table looking for process to run.
-    acquire(&ptable.lock);
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->state != RUNNABLE)
+    // Take a process from our queue, or steal one.
+    if((p = rqpop(me, me)) == 0 && (p = rqsteal(me)) == 0){
+      // Nothing to run: use the time to zero free pages, and
+      // once there are enough of them halt until the next
+      // interrupt, the timer's or setrunnable()'s IRQ_RESCHED.
+      if(kzeroidle())
         continue;
+      cli();
+      c->idle = 1;
+      __sync_synchronize();
+      t = rdtsc();
+      if(!rqany(me))
+        stihlt();
+      c->idletime += rdtsc() - t;
+      c->idle = 0;
+      continue;
+    }
+
+    acquire(&p->lock);
+    for(;;){
+      if(p->state != RUNNABLE)
+        panic("scheduler: queued process not runnable");
 
       // Switch to chosen process.  It is the process's job
-      // to release ptable.lock and then reacquire it
+      // to release its lock and then reacquire it
       // before jumping back to us.
       c->proc = p;
+      p->lastcpu = me;
       switchuvm(p);
       p->state = RUNNING;
+      account(c, p);
+      TRACE(TC_SCHED, TE_SWITCH, p->pid, 0);
 
       swtch(&(c->scheduler), p->context);
-      switchkvm();
+
+      t = rdtsc() - p->tsc;
+      p->cputime += t;
+      c->busytime += t;
 
       // Process is done running for now.
       // It should have changed its p->state before coming back.
+      // Its page table stays loaded while we hold p->lock:
+      // until then no other CPU can run it, reap it or swap
+      // its pages out.  If it is the next one to run here we
+      // keep the lock, and switchuvm() can skip the CR3 load;
+      // so it can for a thread sharing the page table, which
+      // keeps it alive and is never swapped from.
       c->proc = 0;
+      next = rqpop(me, me);
+      if(next == p)
+        continue;
+      if(next == 0 || next->pgdir != p->pgdir)
+        switchkvm();
+      release(&p->lock);
+      if((p = next) == 0)
+        break;
+      acquire(&p->lock);
     }
-    release(&ptable.lock);
-
   }
 }
 
-// Enter scheduler.  Must hold only ptable.lock
+// Enter scheduler.  Must hold only p->lock
 // and have changed proc->state. Saves and restores
 // intena because intena is a property of this
 // kernel thread, not this CPU. It should
@@ -368,8 +1150,8 @@ sched(void)
   int intena;
   struct proc *p = myproc();
 
-  if(!holding(&ptable.lock))
-    panic("sched ptable.lock");
+  if(!holding(&p->lock))
+    panic("sched p->lock");
   if(mycpu()->ncli != 1)
     panic("sched locks");
   if(p->state == RUNNING)
@@ -385,10 +1167,185 @@ sched(void)
 void
 yield(void)
 {
-  acquire(&ptable.lock);  //DOC: yieldlock
-  myproc()->state = RUNNABLE;
+  struct proc *p;
+  int n;
+
+  // Fast path: if nothing is waiting for this CPU, keep running
+  // without touching any lock.  A process queued right after
+  // the check gets its turn at the next tick.  A process that may
+  // no longer run here (setaffinity()) must move.
+  pushcli();
+  n = runq[cpuid()].n;
+  if(!ONCPU(myproc(), cpuid()))
+    n = -1;
+  popcli();
+  if(n == 0)
+    return;
+
+  p = myproc();
+  acquire(&p->lock);  //DOC: yieldlock
+  p->nivcsw++;
+  setrunnable(p);
   sched();
-  release(&ptable.lock);
+  release(&p->lock);
+}
+
+// Called on every timer tick while a process is running.  The
+// process gives up the CPU when it has used its quantum (and, with
+// MLFQ, drops a level) or when a process of a higher level is
+// waiting for this CPU.
+void
+schedtick(void)
+{
+  struct proc *p = myproc();
+  struct runq *q;
+  int k;
+
+  if(!MLFQ){
+    yield();
+    return;
+  }
+  pushcli();
+  k = ONCPU(p, cpuid());
+  popcli();
+  if(!k){
+    yield();
+    return;
+  }
+  if(++p->ticks >= quantum[p->prio]){
+    p->ticks = 0;
+    if(p->prio < NPRIO-1)
+      p->prio++;
+    yield();
+    return;
+  }
+  pushcli();
+  q = &runq[cpuid()];
+  for(k = 0; k < p->prio && q->head[k] == 0; k++)
+    ;
+  popcli();
+  if(k < p->prio)
+    yield();
+}
+
+// Put every process back at its base level and re-file the
+// queued ones.  Called by the timer every BOOSTTICKS ticks.
+void
+schedboost(void)
+{
+  struct proc *p, *list[NPRIO];
+  struct runq *q;
+  int i, k;
+
+  if(!MLFQ)
+    return;
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    acquire(&p->lock);
+    if(p->state != UNUSED){
+      p->prio = p->baseprio;
+      p->ticks = 0;
+    }
+    release(&p->lock);
+  }
+  for(i = 0; i < ncpu; i++){
+    q = &runq[i];
+    acquire(&q->lock);
+    for(k = 0; k < NPRIO; k++){
+      list[k] = q->head[k];
+      q->head[k] = q->tail[k] = 0;
+    }
+    q->n = 0;
+    for(k = 0; k < NPRIO; k++){
+      while((p = list[k]) != 0){
+        list[k] = p->rqnext;
+        rqpush(q, p);
+      }
+    }
+    release(&q->lock);
+  }
+}
+
+// Set the base priority level of process pid (0 is the highest,
+// NPRIO-1 the lowest).  It takes effect the next time the process
+// is queued.  Returns 0, or -1 if there is no such process.
+int
+setpriority(int pid, int prio)
+{
+  struct proc *p;
+
+  if(prio < 0 || prio >= NPRIO)
+    return -1;
+  if((p = findproc(pid)) == 0)
+    return -1;
+  p->prio = p->baseprio = prio;
+  p->ticks = 0;
+  release(&p->lock);
+  return 0;
+}
+
+// Return the current priority level of process pid, or -1 if
+// there is no such process.
+int
+getpriority(int pid)
+{
+  struct proc *p;
+  int prio;
+
+  if((p = findproc(pid)) == 0)
+    return -1;
+  prio = p->prio;
+  release(&p->lock);
+  return prio;
+}
+
+// Restrict process pid to the CPUs in mask (bit i for CPU i);
+// fork() and clone() children inherit it.  Bits for CPUs that do
+// not exist are dropped, and at least one must remain.  A queued
+// process moves to an allowed CPU now, a running one at its next
+// tick or yield() (at once if it is the caller).
+// Returns 0, or -1 if there is no such process or the mask is empty.
+int
+setaffinity(int pid, uint mask)
+{
+  struct proc *p;
+  struct runq *q;
+  int queued;
+
+  mask &= (1 << ncpu) - 1;
+  if(mask == 0)
+    return -1;
+  if((p = findproc(pid)) == 0)
+    return -1;
+  p->cpumask = mask;
+  if(p->state == RUNNABLE && !ONCPU(p, p->lastcpu)){
+    // Off to the queue of a CPU it may run on.  (A stealer may
+    // have taken it off already and be waiting for p->lock.)
+    q = &runq[p->lastcpu];
+    acquire(&q->lock);
+    queued = rqfind(q, 0, p, 1) != 0;
+    release(&q->lock);
+    if(queued)
+      setrunnable(p);
+  }
+  release(&p->lock);
+  if(p == myproc())
+    yield();
+  return 0;
+}
+
+// Return the affinity mask of process pid, or -1 if there is no
+// such process.
+int
+getaffinity(int pid)
+{
+  struct proc *p;
+  int mask;
+
+  if((p = findproc(pid)) == 0)
+    return -1;
+  mask = p->cpumask & ((1 << ncpu) - 1);
+  release(&p->lock);
+  return mask;
 }
 
 // A fork child's very first scheduling by scheduler()
@@ -397,16 +1354,18 @@ void
 forkret(void)
 {
   static int first = 1;
-  // Still holding ptable.lock from scheduler.
-  release(&ptable.lock);
+  // Still holding p->lock from scheduler.
+  release(&myproc()->lock);
 
   if (first) {
     // Some initialization functions must be run in the context
     // of a regular process (e.g., they call sleep), and thus cannot
     // be run from main().
     first = 0;
-    iinit(ROOTDEV);
+    // Recover the log first: iinit() counts the free blocks.
     initlog(ROOTDEV);
+    iinit(ROOTDEV);
+    swapinit(ROOTDEV);
   }
 
   // Return to "caller", actually trapret (see allocproc).
@@ -418,6 +1377,7 @@ void
 sleep(void *chan, struct spinlock *lk)
 {
   struct proc *p = myproc();
+  struct sleepq *q;
   
   if(p == 0)
     panic("sleep");
@@ -425,52 +1385,120 @@ sleep(void *chan, struct spinlock *lk)
   if(lk == 0)
     panic("sleep without lk");
 
-  // Must acquire ptable.lock in order to
-  // change p->state and then call sched.
-  // Once we hold ptable.lock, we can be
-  // guaranteed that we won't miss any wakeup
-  // (wakeup runs with ptable.lock locked),
-  // so it's okay to release lk.
-  if(lk != &ptable.lock){  //DOC: sleeplock0
-    acquire(&ptable.lock);  //DOC: sleeplock1
+  // Must acquire chan's sleepq lock before
+  // letting go of lk.  Once we hold it, we
+  // can be guaranteed that we won't miss any
+  // wakeup (wakeup runs with it locked), so
+  // it's okay to release lk.
+  q = &sleepq[SLEEPHASH(chan)];
+  if(lk != &q->lock){  //DOC: sleeplock0
+    acquire(&q->lock);  //DOC: sleeplock1
     release(lk);
   }
-  // Go to sleep.
+  // Go to sleep.  p->lock, which sched() needs, is
+  // released by the scheduler once we are off the CPU.
+  acquire(&p->lock);
   p->chan = chan;
   p->state = SLEEPING;
+  p->nvcsw++;
+  sleepenq(p);
+  TRACE(TC_SLEEP, TE_SLEEP, p->pid, (uint)chan);
+  release(&q->lock);
 
   sched();
 
   // Tidy up.
   p->chan = 0;
+  release(&p->lock);
 
   // Reacquire original lock.
-  if(lk != &ptable.lock){  //DOC: sleeplock2
-    release(&ptable.lock);
-    acquire(lk);
-  }
+  acquire(lk);  //DOC: sleeplock2
 }
 
 //PAGEBREAK!
 // Wake up all processes sleeping on chan.
-// The ptable lock must be held.
-static void
-wakeup1(void *chan)
+void
+wakeup(void *chan)
 {
-  struct proc *p;
+  struct sleepq *q;
+  struct proc *p, *next;
+
+  q = &sleepq[SLEEPHASH(chan)];
+  acquire(&q->lock);
+  for(p = q->head; p; p = next){
+    next = p->sleepnext;
+    if(p->chan == chan){
+      acquire(&p->lock);
+      sleepdeq(p);
+      TRACE(TC_SLEEP, TE_WAKEUP, p->pid, (uint)chan);
+      setrunnable(p);
+      release(&p->lock);
+    }
+  }
+  release(&q->lock);
+}
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == SLEEPING && p->chan == chan)
-      p->state = RUNNABLE;
+// Wake up at most n processes sleeping on chan, those that have
+// slept longest first (sleepenq() puts new sleepers at the head).
+// Returns how many were woken.
+int
+wakeupn(void *chan, int n)
+{
+  struct sleepq *q;
+  struct proc *p, *prev;
+  int woken;
+
+  woken = 0;
+  q = &sleepq[SLEEPHASH(chan)];
+  acquire(&q->lock);
+  p = q->head;
+  while(p && p->sleepnext)
+    p = p->sleepnext;
+  for(; p && woken < n; p = prev){
+    prev = p->sleepprev;
+    if(p->chan == chan){
+      acquire(&p->lock);
+      sleepdeq(p);
+      TRACE(TC_SLEEP, TE_WAKEUP, p->pid, (uint)chan);
+      setrunnable(p);
+      release(&p->lock);
+      woken++;
+    }
+  }
+  release(&q->lock);
+  return woken;
 }
 
-// Wake up all processes sleeping on chan.
-void
-wakeup(void *chan)
+// Sleep until futexwake() on addr, the kernel address of a user
+// word (futexaddr()), if the word still holds val.  The check and
+// the sleep are atomic under addr's sleepq lock, which futexwake()
+// takes too, so a wakeup after the user changed the word cannot be
+// lost.
+// Returns 0 when woken, -1 if the word changed or the process was
+// killed.  Like every sleep, the wakeup may be spurious.
+int
+futexwait(uint *addr, uint val)
+{
+  struct proc *p = myproc();
+  struct sleepq *q;
+
+  q = &sleepq[SLEEPHASH(addr)];
+  acquire(&q->lock);
+  if(*addr != val || p->killed){
+    release(&q->lock);
+    return -1;
+  }
+  sleep(addr, &q->lock);
+  release(&q->lock);
+  return p->killed ? -1 : 0;
+}
+
+// Wake up at most n processes in futexwait() on addr.
+// Returns how many were woken.
+int
+futexwake(uint *addr, int n)
 {
-  acquire(&ptable.lock);
-  wakeup1(chan);
-  release(&ptable.lock);
+  return wakeupn(addr, n);
 }
 
 // Kill the process with the given pid.
@@ -480,22 +1508,144 @@ int
 kill(int pid)
 {
   struct proc *p;
+  struct sleepq *q;
+  void *chan;
+
+  if((p = findproc(pid)) == 0)
+    return -1;
+  if(p->pgdir == kpgdir){
+    release(&p->lock);
+    return -1;
+  }
+  p->killed = 1;
+  if(p->state != SLEEPING){
+    release(&p->lock);
+    return 0;
+  }
+
+  // Wake process from sleep.  Its sleepq lock comes before
+  // p->lock, so let go and look again under both: it may have
+  // been woken meanwhile.
+  chan = p->chan;
+  release(&p->lock);
+  q = &sleepq[SLEEPHASH(chan)];
+  acquire(&q->lock);
+  acquire(&p->lock);
+  if(p->state == SLEEPING && p->chan == chan){
+    sleepdeq(p);
+    setrunnable(p);
+  }
+  release(&p->lock);
+  release(&q->lock);
+  return 0;
+}
+
+// Pick a user page to swap out for swapout(), with a clock over
+// the processes and the accessed bits of their PTEs.  Only the
+// calling process and processes that are not running are
+// scanned, and p->lock keeps them from being scheduled meanwhile,
+// so no other CPU can have their mappings in its TLB; threads
+// sharing an address space are never scanned for the same reason.
+// The chosen PTE is pointed at swap slot slot.  Returns the
+// page's kernel address, or 0 if two sweeps found nothing.
+char*
+swapvictim(uint slot)
+{
+  struct proc *p;
+  char *mem;
+  int n;
+
+  mem = 0;
+  acquire(&hand.lock);
+  for(n = 0; n <= 2*NPROC && mem == 0; n++){
+    p = &ptable.proc[hand.proc];
+    acquire(&p->lock);
+    if(p->as == 0 && p->pgdir != kpgdir &&
+       (p == myproc() || p->state == RUNNABLE || p->state == SLEEPING))
+      mem = uvmevict(p, &hand.va, slot);
+    release(&p->lock);
+    if(mem == 0){
+      hand.proc = (hand.proc + 1) % NPROC;
+      hand.va = 0;
+    }
+  }
+  release(&hand.lock);
+  return mem;
+}
+
+// Fill in *pi for the n-th process in use (in ptable order).
+// Returns 0, or -1 if there are not that many processes.
+int
+getprocinfo(int n, struct procinfo *pi)
+{
+  struct proc *p, *q;
 
-  acquire(&ptable.lock);
+  acquire(&ptable.treelock);
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->pid == pid){
-      p->killed = 1;
-      // Wake process from sleep if necessary.
-      if(p->state == SLEEPING)
-        p->state = RUNNABLE;
-      release(&ptable.lock);
-      return 0;
+    acquire(&p->lock);
+    if(p->state == UNUSED || n-- > 0){
+      release(&p->lock);
+      continue;
     }
+    pi->pid = p->pid;
+    pi->ppid = p->parent ? p->parent->pid : 0;
+    pi->state = p->state;
+    pi->prio = p->prio;
+    pi->sz = p->sz;
+    // Threads count the pages each of them mapped and unmapped in
+    // the address space they share; its total is the sum.
+    pi->rss = p->rss;
+    if(p->as)
+      for(q = ptable.proc; q < &ptable.proc[NPROC]; q++)
+        if(q != p && q->as == p->as)
+          pi->rss += q->rss;
+    pi->cputime = p->cputime;
+    pi->waittime = p->waittime;
+    // Count the running time of a process that is on a CPU now.
+    if(p->state == RUNNING)
+      pi->cputime += rdtsc() - p->tsc;
+    pi->nvcsw = p->nvcsw;
+    pi->nivcsw = p->nivcsw;
+    memmove(pi->lat, p->lat, sizeof(pi->lat));
+    safestrcpy(pi->name, p->name, sizeof(pi->name));
+    release(&p->lock);
+    release(&ptable.treelock);
+    return 0;
   }
-  release(&ptable.lock);
+  release(&ptable.treelock);
   return -1;
 }
 
+// A counter that its CPU updates without a lock; read it again
+// if the two halves were caught mid-update.
+static uint64
+read64(volatile uint64 *x)
+{
+  uint64 v;
+
+  do
+    v = *x;
+  while(v != *x);
+  return v;
+}
+
+// Fill in *ci for CPU i.  Returns -1 if there is no such CPU.
+// The counters are read without a lock, as for getlockstat().
+int
+getcpuinfo(int i, struct cpuinfo *ci)
+{
+  struct cpu *c;
+
+  if(i < 0 || i >= ncpu)
+    return -1;
+  c = &cpus[i];
+  ci->busytime = read64(&c->busytime);
+  ci->idletime = read64(&c->idletime);
+  ci->nswitch = c->nswitch;
+  memmove(ci->lat, c->lat, sizeof(ci->lat));
+  return 0;
+}
+
 //PAGEBREAK: 36
 // Print a process listing to console.  For debugging.
 // Runs when user types ^P on console.
@@ -514,7 +1664,7 @@ procdump(void)
   int i;
   struct proc *p;
   char *state;
-  uint pc[10];
+  uint pc[10], *f;
 
   for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
     if(p->state == UNUSED)
@@ -523,7 +1673,12 @@ procdump(void)
       state = states[p->state];
     else
       state = "???";
-    cprintf("%d %s %s", p->pid, state, p->name);
+    cprintf("%d %s %s prio %d cpu %dM vcsw %d ivcsw %d", p->pid, state, p->name,
+            p->prio, (uint)(p->cputime >> 20), p->nvcsw, p->nivcsw);
+    cprintf(" faults heap %d zero %d cow %d file %d guard %d bad %d swap %d",
+            p->faults[FAULT_HEAP], p->faults[FAULT_ZERO], p->faults[FAULT_COW],
+            p->faults[FAULT_FILE], p->faults[FAULT_GUARD], p->faults[FAULT_BAD],
+            p->faults[FAULT_SWAP]);
     if(p->state == SLEEPING){
       getcallerpcs((uint*)p->context->ebp+2, pc);
       for(i=0; i<10 && pc[i] != 0; i++)
@@ -531,4 +1686,10 @@ procdump(void)
     }
     cprintf("\n");
   }
+  for(i = 0; i < ncpu; i++){
+    f = cpus[i].faults;
+    cprintf("cpu%d faults heap %d zero %d cow %d file %d guard %d bad %d swap %d\n",
+            i, f[FAULT_HEAP], f[FAULT_ZERO], f[FAULT_COW],
+            f[FAULT_FILE], f[FAULT_GUARD], f[FAULT_BAD], f[FAULT_SWAP]);
+  }
 }
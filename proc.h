@@ -8,6 +8,16 @@ struct cpu {
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
   struct proc *proc;           // The process running on this cpu or null
+  uint faults[NFAULT];         // Page faults handled here, by class
+  volatile int idle;           // Halted in scheduler(), wake with IRQ_RESCHED
+  uint64 busytime;             // TSC cycles running processes (procinfo.h)
+  uint64 idletime;             // TSC cycles halted
+  uint nswitch;                // Processes dispatched
+  uint lat[NLAT];              // Their run-queue latency histogram
+  volatile uint tlbreq;        // TLB shootdowns asked of this CPU (vm.c)
+  volatile uint tlbdone;       //   and the last one it has done
+  int sysenter;                // System calls may come in by sysenter
+  uint nirq[NIRQ];             // Interrupts taken here, by IRQ (irqstat())
 };
 
 extern struct cpu cpus[NCPU];
@@ -34,23 +44,72 @@ struct context {
 
 enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
+// A range of user memory whose pages are read in from a file
+// on first touch, see filefault() in vm.c.  exec() creates one
+// per program segment below sz, mmap() the others above it.
+struct vma {
+  uint start;                  // First user address, page aligned
+  uint end;                    // One past the last address, page aligned
+  struct inode *ip;            // File the pages come from; 0 if unused
+  uint off;                    // File offset of start
+  uint filesz;                 // Bytes of file data from start; rest is zero
+  int prot;                    // PROT_* (fcntl.h)
+  int flags;                   // MAP_SHARED or MAP_PRIVATE
+};
+
 // Per-process state
 struct proc {
+  struct spinlock lock;        // Protects state, chan, killed (proc.c)
   uint sz;                     // Size of process memory (bytes)
   pde_t* pgdir;                // Page table
   char *kstack;                // Bottom of kernel stack for this process
   enum procstate state;        // Process state
   int pid;                     // Process ID
   struct proc *parent;         // Parent process
+  struct proc *children;       // First child; the rest follow sibling
+  struct proc *sibling;        // Next child of the same parent
+  struct proc *sibprev;        // Previous one, or 0 if first
   struct trapframe *tf;        // Trap frame for current syscall
   struct context *context;     // swtch() here to run process
   void *chan;                  // If non-zero, sleeping on chan
   int killed;                  // If non-zero, have been killed
-  struct file *ofile[NOFILE];  // Open files
+  struct file **ofile;         // Open files: ofile0, or a page once grown
+  int nofile;                  // Slots in ofile, NOFILE0 or NOFILE
+  struct file *ofile0[NOFILE0];
   struct inode *cwd;           // Current directory
   char name[16];               // Process name (debugging)
   uint paginaInvalida;	       // Para guardar la pagina inaccesible que exec() coloca  justo debajo de la página de pila
-
+  int faultaround;             // Max heap pages mapped per fault (see heapfault)
+  int faultwin;                // Current fault-around window, in pages
+  uint faultnext;              // First page after the last fault-around window
+  int largepages;              // Back big heap ranges with 4MB pages
+  int lastcpu;                 // CPU it last ran on, whose queue it joins
+  uint cpumask;                // CPUs it may run on, bit i for CPU i
+  struct proc *rqnext;         // Next on that CPU's run queue
+  struct proc *sleepnext;      // Others on the same sleepq list (proc.c)
+  struct proc *sleepprev;
+  uint tmwhen;                 // Timer wheel deadline, and channel (timer.c)
+  struct proc *tmnext;         // Others in the same wheel slot
+  struct proc **tmpprev;       // What points here, or 0 if not queued
+  int prio;                    // Current priority level, 0 highest (MLFQ)
+  int baseprio;                // Level set by setpriority(), restored by boosts
+  int ticks;                   // Ticks used of the current level's quantum
+  uint64 cputime;              // TSC cycles spent running (procinfo.h)
+  uint64 waittime;             // TSC cycles spent RUNNABLE
+  uint64 tsc;                  // When it became RUNNABLE, or RUNNING
+  uint nvcsw;                  // Voluntary context switches
+  uint nivcsw;                 // Involuntary context switches
+  uint lat[NLAT];              // Run-queue latency histogram
+  uint faults[NFAULT];         // Page faults taken, by class (fault.h)
+  int rss;                     // Pages it mapped minus those unmapped (vm.c)
+  struct vma vma[NVMA];        // File-backed memory ranges
+  uint mmapbot;                // Lowest mmap() address; the heap stays below
+  uint pinva[NPIN];            // User buffers of the current system call,
+  uint pinend[NPIN];           //   never swapped out (see uvmtouch)
+  int npin;
+  struct aspace *as;           // Shared with clone()d threads, or 0 (proc.c)
+  uint ustack;                 // Stack given to clone(), returned by join()
+  struct syscount *sc;         // System calls made, then by reaped children (sysstat.h)
 };
 
 // Process memory is laid out contiguously, low addresses first:
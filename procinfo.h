@@ -0,0 +1,27 @@
+// Per-process and per-CPU scheduling statistics, as returned by
+// getprocinfo() and getcpuinfo().  Times are in TSC cycles.
+// Run-queue latency (RUNNABLE until RUNNING) is counted in NLAT
+// (param.h) buckets: bucket 0 is below 2^10 cycles, each next one
+// is 4 times wider, and the last one has everything above.
+
+struct procinfo {
+  int pid;
+  int ppid;                    // 0 for init and kernel threads
+  int state;                   // enum procstate
+  int prio;                    // Current priority level
+  uint sz;                     // Size of process memory (bytes)
+  uint rss;                    // Resident pages, shared ones included
+  uint64 cputime;              // Time spent running
+  uint64 waittime;             // Time spent RUNNABLE, waiting for a CPU
+  uint nvcsw;                  // Voluntary switches (sleep)
+  uint nivcsw;                 // Involuntary switches (preempted)
+  uint lat[NLAT];              // Run-queue latency histogram
+  char name[16];
+};
+
+struct cpuinfo {
+  uint64 busytime;             // Time spent running processes
+  uint64 idletime;             // Time spent halted
+  uint nswitch;                // Processes dispatched
+  uint lat[NLAT];              // Run-queue latency of those dispatches
+};
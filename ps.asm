@@ -0,0 +1,2899 @@
+
+_ps:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <printlat>:
+  "unused", "embryo", "sleep", "runble", "run", "zombie"
+};
+
+static void
+printlat(uint *lat)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	56                   	push   %esi
+       4:	53                   	push   %ebx
+       5:	89 c6                	mov    %eax,%esi
+  int k;
+
+  for(k = 0; k < NLAT; k++)
+       7:	bb 00 00 00 00       	mov    $0x0,%ebx
+       c:	eb 18                	jmp    26 <printlat+0x26>
+    printf(1, " %d", lat[k]);
+       e:	83 ec 04             	sub    $0x4,%esp
+      11:	ff 34 9e             	push   (%esi,%ebx,4)
+      14:	68 84 13 00 00       	push   $0x1384
+      19:	6a 01                	push   $0x1
+      1b:	e8 45 0d 00 00       	call   d65 <printf>
+  for(k = 0; k < NLAT; k++)
+      20:	83 c3 01             	add    $0x1,%ebx
+      23:	83 c4 10             	add    $0x10,%esp
+      26:	83 fb 09             	cmp    $0x9,%ebx
+      29:	7e e3                	jle    e <printlat+0xe>
+  printf(1, "\n");
+      2b:	83 ec 08             	sub    $0x8,%esp
+      2e:	68 a8 13 00 00       	push   $0x13a8
+      33:	6a 01                	push   $0x1
+      35:	e8 2b 0d 00 00       	call   d65 <printf>
+}
+      3a:	83 c4 10             	add    $0x10,%esp
+      3d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      40:	5b                   	pop    %ebx
+      41:	5e                   	pop    %esi
+      42:	5d                   	pop    %ebp
+      43:	c3                   	ret
+
+00000044 <main>:
+
+int
+main(int argc, char *argv[])
+{
+      44:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+      48:	83 e4 f0             	and    $0xfffffff0,%esp
+      4b:	ff 71 fc             	push   -0x4(%ecx)
+      4e:	55                   	push   %ebp
+      4f:	89 e5                	mov    %esp,%ebp
+      51:	57                   	push   %edi
+      52:	56                   	push   %esi
+      53:	53                   	push   %ebx
+      54:	51                   	push   %ecx
+      55:	81 ec c8 00 00 00    	sub    $0xc8,%esp
+      5b:	8b 41 04             	mov    0x4(%ecx),%eax
+  struct procinfo pi;
+  struct cpuinfo ci;
+  int i, lflag;
+
+  lflag = argc > 1 && strcmp(argv[1], "-l") == 0;
+      5e:	83 39 01             	cmpl   $0x1,(%ecx)
+      61:	7f 23                	jg     86 <main+0x42>
+      63:	c7 85 2c ff ff ff 00 	movl   $0x0,-0xd4(%ebp)
+      6a:	00 00 00 
+  printf(1, "PID\tPPID\tSTATE\tPRIO\tSZ\tRSS\tCPU\tVCSW\tICSW\tWAIT\tNAME\n");
+      6d:	83 ec 08             	sub    $0x8,%esp
+      70:	68 e0 13 00 00       	push   $0x13e0
+      75:	6a 01                	push   $0x1
+      77:	e8 e9 0c 00 00       	call   d65 <printf>
+  for(i = 0; getprocinfo(i, &pi) == 0; i++){
+      7c:	83 c4 10             	add    $0x10,%esp
+      7f:	bb 00 00 00 00       	mov    $0x0,%ebx
+      84:	eb 32                	jmp    b8 <main+0x74>
+  lflag = argc > 1 && strcmp(argv[1], "-l") == 0;
+      86:	83 ec 08             	sub    $0x8,%esp
+      89:	68 88 13 00 00       	push   $0x1388
+      8e:	ff 70 04             	push   0x4(%eax)
+      91:	e8 84 01 00 00       	call   21a <strcmp>
+      96:	83 c4 10             	add    $0x10,%esp
+      99:	85 c0                	test   %eax,%eax
+      9b:	75 0c                	jne    a9 <main+0x65>
+      9d:	c7 85 2c ff ff ff 01 	movl   $0x1,-0xd4(%ebp)
+      a4:	00 00 00 
+      a7:	eb c4                	jmp    6d <main+0x29>
+      a9:	c7 85 2c ff ff ff 00 	movl   $0x0,-0xd4(%ebp)
+      b0:	00 00 00 
+      b3:	eb b8                	jmp    6d <main+0x29>
+  for(i = 0; getprocinfo(i, &pi) == 0; i++){
+      b5:	83 c3 01             	add    $0x1,%ebx
+      b8:	83 ec 08             	sub    $0x8,%esp
+      bb:	8d 45 80             	lea    -0x80(%ebp),%eax
+      be:	50                   	push   %eax
+      bf:	53                   	push   %ebx
+      c0:	e8 f3 09 00 00       	call   ab8 <getprocinfo>
+      c5:	83 c4 10             	add    $0x10,%esp
+      c8:	85 c0                	test   %eax,%eax
+      ca:	0f 85 92 00 00 00    	jne    162 <main+0x11e>
+    printf(1, "%d\t%d\t%s\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%s\n",
+           pi.pid, pi.ppid, states[pi.state], pi.prio, pi.sz, pi.rss*4,
+           (uint)(pi.cputime >> 20), pi.nvcsw, pi.nivcsw,
+           (uint)(pi.waittime >> 20), pi.name);
+      d0:	8b 75 a0             	mov    -0x60(%ebp),%esi
+      d3:	8b 7d a4             	mov    -0x5c(%ebp),%edi
+      d6:	0f ac fe 14          	shrd   $0x14,%edi,%esi
+      da:	c1 ef 14             	shr    $0x14,%edi
+           (uint)(pi.cputime >> 20), pi.nvcsw, pi.nivcsw,
+      dd:	8b 45 98             	mov    -0x68(%ebp),%eax
+      e0:	8b 55 9c             	mov    -0x64(%ebp),%edx
+      e3:	0f ac d0 14          	shrd   $0x14,%edx,%eax
+      e7:	c1 ea 14             	shr    $0x14,%edx
+      ea:	89 85 30 ff ff ff    	mov    %eax,-0xd0(%ebp)
+      f0:	89 95 34 ff ff ff    	mov    %edx,-0xcc(%ebp)
+    printf(1, "%d\t%d\t%s\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%s\n",
+      f6:	83 ec 0c             	sub    $0xc,%esp
+      f9:	8d 55 d8             	lea    -0x28(%ebp),%edx
+      fc:	52                   	push   %edx
+      fd:	56                   	push   %esi
+      fe:	ff 75 ac             	push   -0x54(%ebp)
+     101:	ff 75 a8             	push   -0x58(%ebp)
+     104:	ff b5 30 ff ff ff    	push   -0xd0(%ebp)
+     10a:	8b 45 94             	mov    -0x6c(%ebp),%eax
+     10d:	c1 e0 02             	shl    $0x2,%eax
+     110:	50                   	push   %eax
+     111:	ff 75 90             	push   -0x70(%ebp)
+     114:	ff 75 8c             	push   -0x74(%ebp)
+     117:	8b 45 88             	mov    -0x78(%ebp),%eax
+     11a:	ff 34 85 38 14 00 00 	push   0x1438(,%eax,4)
+     121:	ff 75 84             	push   -0x7c(%ebp)
+     124:	ff 75 80             	push   -0x80(%ebp)
+     127:	68 14 14 00 00       	push   $0x1414
+     12c:	6a 01                	push   $0x1
+     12e:	e8 32 0c 00 00       	call   d65 <printf>
+    if(lflag){
+     133:	83 c4 40             	add    $0x40,%esp
+     136:	83 bd 2c ff ff ff 00 	cmpl   $0x0,-0xd4(%ebp)
+     13d:	0f 84 72 ff ff ff    	je     b5 <main+0x71>
+      printf(1, "\tlat");
+     143:	83 ec 08             	sub    $0x8,%esp
+     146:	68 8b 13 00 00       	push   $0x138b
+     14b:	6a 01                	push   $0x1
+     14d:	e8 13 0c 00 00       	call   d65 <printf>
+      printlat(pi.lat);
+     152:	8d 45 b0             	lea    -0x50(%ebp),%eax
+     155:	e8 a6 fe ff ff       	call   0 <printlat>
+     15a:	83 c4 10             	add    $0x10,%esp
+     15d:	e9 53 ff ff ff       	jmp    b5 <main+0x71>
+    }
+  }
+  if(!lflag)
+     162:	83 bd 2c ff ff ff 00 	cmpl   $0x0,-0xd4(%ebp)
+     169:	75 05                	jne    170 <main+0x12c>
+    exit();
+     16b:	e8 bc 06 00 00       	call   82c <exit>
+
+  // Bucket k counts waits below 2^(10+2k) cycles.
+  printf(1, "CPU\tBUSY\tIDLE\tSWITCH\tLAT\n");
+     170:	83 ec 08             	sub    $0x8,%esp
+     173:	68 90 13 00 00       	push   $0x1390
+     178:	6a 01                	push   $0x1
+     17a:	e8 e6 0b 00 00       	call   d65 <printf>
+  for(i = 0; getcpuinfo(i, &ci) == 0; i++){
+     17f:	83 c4 10             	add    $0x10,%esp
+     182:	bb 00 00 00 00       	mov    $0x0,%ebx
+     187:	83 ec 08             	sub    $0x8,%esp
+     18a:	8d 85 44 ff ff ff    	lea    -0xbc(%ebp),%eax
+     190:	50                   	push   %eax
+     191:	53                   	push   %ebx
+     192:	e8 30 09 00 00       	call   ac7 <getcpuinfo>
+     197:	83 c4 10             	add    $0x10,%esp
+     19a:	85 c0                	test   %eax,%eax
+     19c:	75 51                	jne    1ef <main+0x1ab>
+    printf(1, "%d\t%d\t%d\t%d\t", i, (uint)(ci.busytime >> 20),
+           (uint)(ci.idletime >> 20), ci.nswitch);
+     19e:	8b b5 4c ff ff ff    	mov    -0xb4(%ebp),%esi
+     1a4:	8b bd 50 ff ff ff    	mov    -0xb0(%ebp),%edi
+     1aa:	0f ac fe 14          	shrd   $0x14,%edi,%esi
+     1ae:	c1 ef 14             	shr    $0x14,%edi
+    printf(1, "%d\t%d\t%d\t%d\t", i, (uint)(ci.busytime >> 20),
+     1b1:	8b 85 44 ff ff ff    	mov    -0xbc(%ebp),%eax
+     1b7:	8b 95 48 ff ff ff    	mov    -0xb8(%ebp),%edx
+     1bd:	0f ac d0 14          	shrd   $0x14,%edx,%eax
+     1c1:	c1 ea 14             	shr    $0x14,%edx
+     1c4:	83 ec 08             	sub    $0x8,%esp
+     1c7:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+     1cd:	56                   	push   %esi
+     1ce:	50                   	push   %eax
+     1cf:	53                   	push   %ebx
+     1d0:	68 aa 13 00 00       	push   $0x13aa
+     1d5:	6a 01                	push   $0x1
+     1d7:	e8 89 0b 00 00       	call   d65 <printf>
+    printlat(ci.lat);
+     1dc:	83 c4 20             	add    $0x20,%esp
+     1df:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+     1e5:	e8 16 fe ff ff       	call   0 <printlat>
+  for(i = 0; getcpuinfo(i, &ci) == 0; i++){
+     1ea:	83 c3 01             	add    $0x1,%ebx
+     1ed:	eb 98                	jmp    187 <main+0x143>
+  }
+  exit();
+     1ef:	e8 38 06 00 00       	call   82c <exit>
+
+000001f4 <strcpy>:
+#include "memlayout.h"
+#include "clock.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     1f4:	55                   	push   %ebp
+     1f5:	89 e5                	mov    %esp,%ebp
+     1f7:	56                   	push   %esi
+     1f8:	53                   	push   %ebx
+     1f9:	8b 75 08             	mov    0x8(%ebp),%esi
+     1fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     1ff:	89 f0                	mov    %esi,%eax
+     201:	89 d1                	mov    %edx,%ecx
+     203:	83 c2 01             	add    $0x1,%edx
+     206:	89 c3                	mov    %eax,%ebx
+     208:	83 c0 01             	add    $0x1,%eax
+     20b:	0f b6 09             	movzbl (%ecx),%ecx
+     20e:	88 0b                	mov    %cl,(%ebx)
+     210:	84 c9                	test   %cl,%cl
+     212:	75 ed                	jne    201 <strcpy+0xd>
+    ;
+  return os;
+}
+     214:	89 f0                	mov    %esi,%eax
+     216:	5b                   	pop    %ebx
+     217:	5e                   	pop    %esi
+     218:	5d                   	pop    %ebp
+     219:	c3                   	ret
+
+0000021a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     21a:	55                   	push   %ebp
+     21b:	89 e5                	mov    %esp,%ebp
+     21d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     220:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+     223:	eb 06                	jmp    22b <strcmp+0x11>
+    p++, q++;
+     225:	83 c1 01             	add    $0x1,%ecx
+     228:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+     22b:	0f b6 01             	movzbl (%ecx),%eax
+     22e:	84 c0                	test   %al,%al
+     230:	74 04                	je     236 <strcmp+0x1c>
+     232:	3a 02                	cmp    (%edx),%al
+     234:	74 ef                	je     225 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+     236:	0f b6 c0             	movzbl %al,%eax
+     239:	0f b6 12             	movzbl (%edx),%edx
+     23c:	29 d0                	sub    %edx,%eax
+}
+     23e:	5d                   	pop    %ebp
+     23f:	c3                   	ret
+
+00000240 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     240:	55                   	push   %ebp
+     241:	89 e5                	mov    %esp,%ebp
+     243:	53                   	push   %ebx
+     244:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  const char *p;
+  uint w;
+
+  for(p = s; (uint)p & 3; p++)
+     247:	89 c8                	mov    %ecx,%eax
+     249:	eb 03                	jmp    24e <strlen+0xe>
+     24b:	83 c0 01             	add    $0x1,%eax
+     24e:	a8 03                	test   $0x3,%al
+     250:	74 09                	je     25b <strlen+0x1b>
+    if(*p == 0)
+     252:	80 38 00             	cmpb   $0x0,(%eax)
+     255:	75 f4                	jne    24b <strlen+0xb>
+      return p - s;
+     257:	29 c8                	sub    %ecx,%eax
+     259:	eb 25                	jmp    280 <strlen+0x40>
+  // Then a word at a time, which never crosses into the next page:
+  // a word with a zero byte in it has one of these bits set.
+  for(;; p += 4){
+    w = *(uint*)p;
+     25b:	8b 10                	mov    (%eax),%edx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     25d:	8d 9a ff fe fe fe    	lea    -0x1010101(%edx),%ebx
+     263:	f7 d2                	not    %edx
+     265:	21 da                	and    %ebx,%edx
+     267:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+     26d:	75 05                	jne    274 <strlen+0x34>
+  for(;; p += 4){
+     26f:	83 c0 04             	add    $0x4,%eax
+    w = *(uint*)p;
+     272:	eb e7                	jmp    25b <strlen+0x1b>
+      break;
+  }
+  while(*p)
+     274:	80 38 00             	cmpb   $0x0,(%eax)
+     277:	74 05                	je     27e <strlen+0x3e>
+    p++;
+     279:	83 c0 01             	add    $0x1,%eax
+     27c:	eb f6                	jmp    274 <strlen+0x34>
+  return p - s;
+     27e:	29 c8                	sub    %ecx,%eax
+}
+     280:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     283:	c9                   	leave
+     284:	c3                   	ret
+
+00000285 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     285:	55                   	push   %ebp
+     286:	89 e5                	mov    %esp,%ebp
+     288:	57                   	push   %edi
+     289:	56                   	push   %esi
+     28a:	53                   	push   %ebx
+     28b:	8b 55 10             	mov    0x10(%ebp),%edx
+  uint h;
+  char *d;
+
+  d = dst;
+  c &= 0xFF;
+     28e:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  if(n >= 16){
+     292:	83 fa 0f             	cmp    $0xf,%edx
+     295:	76 52                	jbe    2e9 <memset+0x64>
+    h = -(uint)d & 3;
+     297:	8b 45 08             	mov    0x8(%ebp),%eax
+     29a:	f7 d8                	neg    %eax
+     29c:	83 e0 03             	and    $0x3,%eax
+     29f:	89 c6                	mov    %eax,%esi
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     2a1:	8b 7d 08             	mov    0x8(%ebp),%edi
+     2a4:	89 c1                	mov    %eax,%ecx
+     2a6:	89 d8                	mov    %ebx,%eax
+     2a8:	fc                   	cld
+     2a9:	f3 aa                	rep stos %al,%es:(%edi)
+    stosb(d, c, h);
+    stosl(d + h, (c<<24)|(c<<16)|(c<<8)|c, (n - h)/4);
+     2ab:	29 f2                	sub    %esi,%edx
+     2ad:	89 d1                	mov    %edx,%ecx
+     2af:	c1 e9 02             	shr    $0x2,%ecx
+     2b2:	c1 e0 18             	shl    $0x18,%eax
+     2b5:	89 df                	mov    %ebx,%edi
+     2b7:	c1 e7 10             	shl    $0x10,%edi
+     2ba:	09 f8                	or     %edi,%eax
+     2bc:	89 df                	mov    %ebx,%edi
+     2be:	c1 e7 08             	shl    $0x8,%edi
+     2c1:	09 f8                	or     %edi,%eax
+     2c3:	09 d8                	or     %ebx,%eax
+     2c5:	89 f7                	mov    %esi,%edi
+     2c7:	03 7d 08             	add    0x8(%ebp),%edi
+}
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosl" :
+     2ca:	fc                   	cld
+     2cb:	f3 ab                	rep stos %eax,%es:(%edi)
+    d += h + (n - h)/4*4;
+     2cd:	89 d7                	mov    %edx,%edi
+     2cf:	83 e7 fc             	and    $0xfffffffc,%edi
+     2d2:	09 f7                	or     %esi,%edi
+     2d4:	03 7d 08             	add    0x8(%ebp),%edi
+    n = (n - h)%4;
+     2d7:	83 e2 03             	and    $0x3,%edx
+  asm volatile("cld; rep stosb" :
+     2da:	89 d1                	mov    %edx,%ecx
+     2dc:	89 d8                	mov    %ebx,%eax
+     2de:	fc                   	cld
+     2df:	f3 aa                	rep stos %al,%es:(%edi)
+  }
+  stosb(d, c, n);
+  return dst;
+}
+     2e1:	8b 45 08             	mov    0x8(%ebp),%eax
+     2e4:	5b                   	pop    %ebx
+     2e5:	5e                   	pop    %esi
+     2e6:	5f                   	pop    %edi
+     2e7:	5d                   	pop    %ebp
+     2e8:	c3                   	ret
+  d = dst;
+     2e9:	8b 7d 08             	mov    0x8(%ebp),%edi
+     2ec:	eb ec                	jmp    2da <memset+0x55>
+
+000002ee <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     2ee:	55                   	push   %ebp
+     2ef:	89 e5                	mov    %esp,%ebp
+     2f1:	8b 45 08             	mov    0x8(%ebp),%eax
+     2f4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     2f8:	eb 03                	jmp    2fd <strchr+0xf>
+     2fa:	83 c0 01             	add    $0x1,%eax
+     2fd:	0f b6 10             	movzbl (%eax),%edx
+     300:	84 d2                	test   %dl,%dl
+     302:	74 06                	je     30a <strchr+0x1c>
+    if(*s == c)
+     304:	38 ca                	cmp    %cl,%dl
+     306:	75 f2                	jne    2fa <strchr+0xc>
+     308:	eb 05                	jmp    30f <strchr+0x21>
+      return (char*)s;
+  return 0;
+     30a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     30f:	5d                   	pop    %ebp
+     310:	c3                   	ret
+
+00000311 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     311:	55                   	push   %ebp
+     312:	89 e5                	mov    %esp,%ebp
+     314:	56                   	push   %esi
+     315:	53                   	push   %ebx
+     316:	8b 55 08             	mov    0x8(%ebp),%edx
+     319:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     31c:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  // A word at a time while they agree.
+  if((((uint)s1 | (uint)s2) & 3) == 0)
+     31f:	89 d3                	mov    %edx,%ebx
+     321:	09 cb                	or     %ecx,%ebx
+     323:	f6 c3 03             	test   $0x3,%bl
+     326:	74 24                	je     34c <memcmp+0x3b>
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+      s1 += 4, s2 += 4;
+  while(n-- > 0){
+     328:	8d 70 ff             	lea    -0x1(%eax),%esi
+     32b:	85 c0                	test   %eax,%eax
+     32d:	74 32                	je     361 <memcmp+0x50>
+    if(*s1 != *s2)
+     32f:	0f b6 02             	movzbl (%edx),%eax
+     332:	0f b6 19             	movzbl (%ecx),%ebx
+     335:	38 d8                	cmp    %bl,%al
+     337:	75 20                	jne    359 <memcmp+0x48>
+      return *s1 - *s2;
+    s1++, s2++;
+     339:	83 c2 01             	add    $0x1,%edx
+     33c:	83 c1 01             	add    $0x1,%ecx
+  while(n-- > 0){
+     33f:	89 f0                	mov    %esi,%eax
+     341:	eb e5                	jmp    328 <memcmp+0x17>
+      s1 += 4, s2 += 4;
+     343:	83 c2 04             	add    $0x4,%edx
+     346:	83 c1 04             	add    $0x4,%ecx
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+     349:	83 e8 04             	sub    $0x4,%eax
+     34c:	83 f8 03             	cmp    $0x3,%eax
+     34f:	76 d7                	jbe    328 <memcmp+0x17>
+     351:	8b 31                	mov    (%ecx),%esi
+     353:	39 32                	cmp    %esi,(%edx)
+     355:	74 ec                	je     343 <memcmp+0x32>
+     357:	eb cf                	jmp    328 <memcmp+0x17>
+      return *s1 - *s2;
+     359:	0f b6 c0             	movzbl %al,%eax
+     35c:	0f b6 db             	movzbl %bl,%ebx
+     35f:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     361:	5b                   	pop    %ebx
+     362:	5e                   	pop    %esi
+     363:	5d                   	pop    %ebp
+     364:	c3                   	ret
+
+00000365 <memchr>:
+// The first c in the n bytes at v, or 0.  Once aligned, a word at
+// a time, with the word's bytes that equal c turned into zeroes
+// and those looked for.
+void*
+memchr(const void *v, int c, uint n)
+{
+     365:	55                   	push   %ebp
+     366:	89 e5                	mov    %esp,%ebp
+     368:	57                   	push   %edi
+     369:	56                   	push   %esi
+     36a:	53                   	push   %ebx
+     36b:	8b 45 08             	mov    0x8(%ebp),%eax
+     36e:	8b 55 10             	mov    0x10(%ebp),%edx
+  const uchar *s;
+  uint w, rep;
+
+  s = v;
+  c = (uchar)c;
+     371:	0f b6 75 0c          	movzbl 0xc(%ebp),%esi
+  for(; n > 0 && ((uint)s & 3); n--, s++)
+     375:	eb 06                	jmp    37d <memchr+0x18>
+     377:	83 ea 01             	sub    $0x1,%edx
+     37a:	83 c0 01             	add    $0x1,%eax
+     37d:	85 d2                	test   %edx,%edx
+     37f:	74 0d                	je     38e <memchr+0x29>
+     381:	a8 03                	test   $0x3,%al
+     383:	74 09                	je     38e <memchr+0x29>
+    if(*s == c)
+     385:	0f b6 08             	movzbl (%eax),%ecx
+     388:	39 f1                	cmp    %esi,%ecx
+     38a:	75 eb                	jne    377 <memchr+0x12>
+     38c:	eb 41                	jmp    3cf <memchr+0x6a>
+      return (void*)s;
+  rep = c * 0x01010101;
+     38e:	69 fe 01 01 01 01    	imul   $0x1010101,%esi,%edi
+  for(; n >= 4; n -= 4, s += 4){
+     394:	eb 06                	jmp    39c <memchr+0x37>
+     396:	83 ea 04             	sub    $0x4,%edx
+     399:	83 c0 04             	add    $0x4,%eax
+     39c:	83 fa 03             	cmp    $0x3,%edx
+     39f:	76 16                	jbe    3b7 <memchr+0x52>
+    w = *(uint*)s ^ rep;
+     3a1:	89 f9                	mov    %edi,%ecx
+     3a3:	33 08                	xor    (%eax),%ecx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     3a5:	8d 99 ff fe fe fe    	lea    -0x1010101(%ecx),%ebx
+     3ab:	f7 d1                	not    %ecx
+     3ad:	21 cb                	and    %ecx,%ebx
+     3af:	f7 c3 80 80 80 80    	test   $0x80808080,%ebx
+     3b5:	74 df                	je     396 <memchr+0x31>
+      break;
+  }
+  for(; n > 0; n--, s++)
+     3b7:	85 d2                	test   %edx,%edx
+     3b9:	74 0f                	je     3ca <memchr+0x65>
+    if(*s == c)
+     3bb:	0f b6 08             	movzbl (%eax),%ecx
+     3be:	39 f1                	cmp    %esi,%ecx
+     3c0:	74 0d                	je     3cf <memchr+0x6a>
+  for(; n > 0; n--, s++)
+     3c2:	83 ea 01             	sub    $0x1,%edx
+     3c5:	83 c0 01             	add    $0x1,%eax
+     3c8:	eb ed                	jmp    3b7 <memchr+0x52>
+      return (void*)s;
+  return 0;
+     3ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     3cf:	5b                   	pop    %ebx
+     3d0:	5e                   	pop    %esi
+     3d1:	5f                   	pop    %edi
+     3d2:	5d                   	pop    %ebp
+     3d3:	c3                   	ret
+
+000003d4 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     3d4:	55                   	push   %ebp
+     3d5:	89 e5                	mov    %esp,%ebp
+     3d7:	57                   	push   %edi
+     3d8:	56                   	push   %esi
+     3d9:	53                   	push   %ebx
+     3da:	83 ec 1c             	sub    $0x1c,%esp
+     3dd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     3e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+     3e5:	89 de                	mov    %ebx,%esi
+     3e7:	83 c3 01             	add    $0x1,%ebx
+     3ea:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     3ed:	7d 2e                	jge    41d <gets+0x49>
+    cc = read(0, &c, 1);
+     3ef:	83 ec 04             	sub    $0x4,%esp
+     3f2:	6a 01                	push   $0x1
+     3f4:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     3f7:	50                   	push   %eax
+     3f8:	6a 00                	push   $0x0
+     3fa:	e8 51 05 00 00       	call   950 <read>
+    if(cc < 1)
+     3ff:	83 c4 10             	add    $0x10,%esp
+     402:	85 c0                	test   %eax,%eax
+     404:	7e 17                	jle    41d <gets+0x49>
+      break;
+    buf[i++] = c;
+     406:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     40a:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+     40d:	3c 0a                	cmp    $0xa,%al
+     40f:	0f 94 c2             	sete   %dl
+     412:	3c 0d                	cmp    $0xd,%al
+     414:	0f 94 c0             	sete   %al
+     417:	08 c2                	or     %al,%dl
+     419:	74 ca                	je     3e5 <gets+0x11>
+    buf[i++] = c;
+     41b:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+     41d:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+     421:	89 f8                	mov    %edi,%eax
+     423:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     426:	5b                   	pop    %ebx
+     427:	5e                   	pop    %esi
+     428:	5f                   	pop    %edi
+     429:	5d                   	pop    %ebp
+     42a:	c3                   	ret
+
+0000042b <atoi>:
+  return r;
+}
+
+int
+atoi(const char *s)
+{
+     42b:	55                   	push   %ebp
+     42c:	89 e5                	mov    %esp,%ebp
+     42e:	53                   	push   %ebx
+     42f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+     432:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+     437:	eb 10                	jmp    449 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+     439:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+     43c:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+     43f:	83 c1 01             	add    $0x1,%ecx
+     442:	0f be c0             	movsbl %al,%eax
+     445:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+     449:	0f b6 01             	movzbl (%ecx),%eax
+     44c:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     44f:	80 fb 09             	cmp    $0x9,%bl
+     452:	76 e5                	jbe    439 <atoi+0xe>
+  return n;
+}
+     454:	89 d0                	mov    %edx,%eax
+     456:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     459:	c9                   	leave
+     45a:	c3                   	ret
+
+0000045b <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     45b:	55                   	push   %ebp
+     45c:	89 e5                	mov    %esp,%ebp
+     45e:	57                   	push   %edi
+     45f:	56                   	push   %esi
+     460:	53                   	push   %ebx
+     461:	83 ec 08             	sub    $0x8,%esp
+     464:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     467:	8b 55 0c             	mov    0xc(%ebp),%edx
+     46a:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *src;
+  int h;
+
+  dst = vdst;
+  src = vsrc;
+  if(n <= 0)
+     46d:	85 c0                	test   %eax,%eax
+     46f:	0f 8e 82 00 00 00    	jle    4f7 <memmove+0x9c>
+    return vdst;
+  if(src < dst && src + n > dst){
+     475:	39 da                	cmp    %ebx,%edx
+     477:	73 07                	jae    480 <memmove+0x25>
+     479:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+     47c:	39 cb                	cmp    %ecx,%ebx
+     47e:	72 5e                	jb     4de <memmove+0x83>
+    movsbback(dst + n - 1, src + n - 1, n);
+    return vdst;
+  }
+  if(n >= 16 && (((uint)dst ^ (uint)src) & 3) == 0){
+     480:	83 f8 0f             	cmp    $0xf,%eax
+     483:	7e 69                	jle    4ee <memmove+0x93>
+     485:	89 d9                	mov    %ebx,%ecx
+     487:	31 d1                	xor    %edx,%ecx
+     489:	f6 c1 03             	test   $0x3,%cl
+     48c:	75 73                	jne    501 <memmove+0xa6>
+    h = -(uint)dst & 3;
+     48e:	89 d9                	mov    %ebx,%ecx
+     490:	f7 d9                	neg    %ecx
+     492:	83 e1 03             	and    $0x3,%ecx
+}
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsb" :
+     495:	89 df                	mov    %ebx,%edi
+     497:	89 d6                	mov    %edx,%esi
+     499:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+     49c:	fc                   	cld
+     49d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    movsb(dst, src, h);
+    dst += h, src += h, n -= h;
+     49f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+     4a2:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+     4a5:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+     4a8:	29 f0                	sub    %esi,%eax
+    movsl(dst, src, n/4);
+     4aa:	8d 50 03             	lea    0x3(%eax),%edx
+     4ad:	0f 49 d0             	cmovns %eax,%edx
+     4b0:	c1 fa 02             	sar    $0x2,%edx
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+     4b3:	89 7d f0             	mov    %edi,-0x10(%ebp)
+     4b6:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     4b9:	89 ce                	mov    %ecx,%esi
+     4bb:	89 d1                	mov    %edx,%ecx
+     4bd:	fc                   	cld
+     4be:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    dst += n/4*4, src += n/4*4, n %= 4;
+     4c0:	c1 e2 02             	shl    $0x2,%edx
+     4c3:	8b 7d f0             	mov    -0x10(%ebp),%edi
+     4c6:	01 d7                	add    %edx,%edi
+     4c8:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     4cb:	01 ca                	add    %ecx,%edx
+     4cd:	89 c6                	mov    %eax,%esi
+     4cf:	c1 fe 1f             	sar    $0x1f,%esi
+     4d2:	c1 ee 1e             	shr    $0x1e,%esi
+     4d5:	01 f0                	add    %esi,%eax
+     4d7:	83 e0 03             	and    $0x3,%eax
+     4da:	29 f0                	sub    %esi,%eax
+     4dc:	eb 12                	jmp    4f0 <memmove+0x95>
+    movsbback(dst + n - 1, src + n - 1, n);
+     4de:	8d 78 ff             	lea    -0x1(%eax),%edi
+     4e1:	8d 34 3a             	lea    (%edx,%edi,1),%esi
+     4e4:	01 df                	add    %ebx,%edi
+// Copy cnt bytes down from the last ones, at dst and src, to the
+// first: for overlapping moves up.
+static inline void
+movsbback(void *dst, const void *src, int cnt)
+{
+  asm volatile("std; rep movsb; cld" :
+     4e6:	89 c1                	mov    %eax,%ecx
+     4e8:	fd                   	std
+     4e9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     4eb:	fc                   	cld
+    return vdst;
+     4ec:	eb 09                	jmp    4f7 <memmove+0x9c>
+  dst = vdst;
+     4ee:	89 df                	mov    %ebx,%edi
+  asm volatile("cld; rep movsb" :
+     4f0:	89 d6                	mov    %edx,%esi
+     4f2:	89 c1                	mov    %eax,%ecx
+     4f4:	fc                   	cld
+     4f5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  }
+  movsb(dst, src, n);
+  return vdst;
+}
+     4f7:	89 d8                	mov    %ebx,%eax
+     4f9:	83 c4 08             	add    $0x8,%esp
+     4fc:	5b                   	pop    %ebx
+     4fd:	5e                   	pop    %esi
+     4fe:	5f                   	pop    %edi
+     4ff:	5d                   	pop    %ebp
+     500:	c3                   	ret
+  dst = vdst;
+     501:	89 df                	mov    %ebx,%edi
+     503:	eb eb                	jmp    4f0 <memmove+0x95>
+
+00000505 <vclock_gettime>:
+
+// clock_gettime() without a system call: read the clock page
+// that the kernel maps at CLOCKPAGE (see clock.h).
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+     505:	55                   	push   %ebp
+     506:	89 e5                	mov    %esp,%ebp
+     508:	57                   	push   %edi
+     509:	56                   	push   %esi
+     50a:	53                   	push   %ebx
+     50b:	83 ec 14             	sub    $0x14,%esp
+  struct clockpage *cp = (struct clockpage*)CLOCKPAGE;
+  uint seq, rem, d;
+  uint64 tsc, ns, now;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+     50e:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     512:	0f 87 a3 00 00 00    	ja     5bb <vclock_gettime+0xb6>
+    return -1;
+  do {
+    seq = cp->seq;
+     518:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+    __sync_synchronize();
+     51d:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    tsc = cp->tsc;
+     522:	8b 15 10 f0 ff 7f    	mov    0x7ffff010,%edx
+     528:	8b 1d 14 f0 ff 7f    	mov    0x7ffff014,%ebx
+    ns = cp->ns;
+     52e:	8b 35 18 f0 ff 7f    	mov    0x7ffff018,%esi
+     534:	8b 3d 1c f0 ff 7f    	mov    0x7ffff01c,%edi
+    __sync_synchronize();
+     53a:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != cp->seq);
+     53f:	89 c1                	mov    %eax,%ecx
+     541:	83 e1 01             	and    $0x1,%ecx
+     544:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     547:	75 cf                	jne    518 <vclock_gettime+0x13>
+     549:	8b 0d 00 f0 ff 7f    	mov    0x7ffff000,%ecx
+     54f:	39 c1                	cmp    %eax,%ecx
+     551:	75 c5                	jne    518 <vclock_gettime+0x13>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+     553:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     556:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     559:	0f 31                	rdtsc
+     55b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     55e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     561:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  now = rdtsc();
+  // Less than a tick has passed since the update, so the delta
+  // fits in 32 bits.
+  d = now > tsc ? now - tsc : 0;
+     564:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     567:	19 d3                	sbb    %edx,%ebx
+     569:	73 07                	jae    572 <vclock_gettime+0x6d>
+     56b:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+     56e:	29 d8                	sub    %ebx,%eax
+     570:	89 c1                	mov    %eax,%ecx
+  ns += ((uint64)d * cp->mult) >> cp->shift;
+     572:	89 c8                	mov    %ecx,%eax
+     574:	f7 25 04 f0 ff 7f    	mull   0x7ffff004
+     57a:	0f b6 0d 08 f0 ff 7f 	movzbl 0x7ffff008,%ecx
+     581:	0f ad d0             	shrd   %cl,%edx,%eax
+     584:	d3 ea                	shr    %cl,%edx
+     586:	f6 c1 20             	test   $0x20,%cl
+     589:	74 04                	je     58f <vclock_gettime+0x8a>
+     58b:	89 d0                	mov    %edx,%eax
+     58d:	31 d2                	xor    %edx,%edx
+     58f:	01 f0                	add    %esi,%eax
+     591:	11 fa                	adc    %edi,%edx
+static inline uint
+divl(uint64 n, uint d, uint *r)
+{
+  uint q;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (*r) :
+     593:	bb 00 ca 9a 3b       	mov    $0x3b9aca00,%ebx
+     598:	f7 f3                	div    %ebx
+  ts->tv_sec = divl(ns, 1000000000, &rem);
+     59a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     59d:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = rem;
+     59f:	89 57 04             	mov    %edx,0x4(%edi)
+  if(clk == CLOCK_REALTIME)
+     5a2:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     5a6:	75 1a                	jne    5c2 <vclock_gettime+0xbd>
+    ts->tv_sec += cp->boottime;
+     5a8:	03 05 0c f0 ff 7f    	add    0x7ffff00c,%eax
+     5ae:	89 07                	mov    %eax,(%edi)
+  return 0;
+     5b0:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     5b3:	83 c4 14             	add    $0x14,%esp
+     5b6:	5b                   	pop    %ebx
+     5b7:	5e                   	pop    %esi
+     5b8:	5f                   	pop    %edi
+     5b9:	5d                   	pop    %ebp
+     5ba:	c3                   	ret
+    return -1;
+     5bb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     5c0:	eb f1                	jmp    5b3 <vclock_gettime+0xae>
+  return 0;
+     5c2:	b8 00 00 00 00       	mov    $0x0,%eax
+     5c7:	eb ea                	jmp    5b3 <vclock_gettime+0xae>
+
+000005c9 <flush>:
+
+// Write out fd's buffer, or with fd < 0 every buffer.
+// Returns -1 if a write fails.
+int
+flush(int fd)
+{
+     5c9:	55                   	push   %ebp
+     5ca:	89 e5                	mov    %esp,%ebp
+     5cc:	56                   	push   %esi
+     5cd:	53                   	push   %ebx
+     5ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  int r, n;
+
+  if(fd < 0){
+     5d1:	85 c0                	test   %eax,%eax
+     5d3:	78 5d                	js     632 <flush+0x69>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+      if(flush(fd) < 0)
+        r = -1;
+    return r;
+  }
+  if(fd >= NOBUF || (n = obuf[fd].n) == 0)
+     5d5:	83 f8 0f             	cmp    $0xf,%eax
+     5d8:	7f 64                	jg     63e <flush+0x75>
+     5da:	69 d0 08 02 00 00    	imul   $0x208,%eax,%edx
+     5e0:	8b b2 c4 1b 00 00    	mov    0x1bc4(%edx),%esi
+     5e6:	85 f6                	test   %esi,%esi
+     5e8:	74 59                	je     643 <flush+0x7a>
+    return 0;
+  obuf[fd].n = 0;
+     5ea:	c7 82 c4 1b 00 00 00 	movl   $0x0,0x1bc4(%edx)
+     5f1:	00 00 00 
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     5f4:	81 c2 c8 1b 00 00    	add    $0x1bc8,%edx
+     5fa:	83 ec 04             	sub    $0x4,%esp
+     5fd:	56                   	push   %esi
+     5fe:	52                   	push   %edx
+     5ff:	50                   	push   %eax
+     600:	e8 5a 03 00 00       	call   95f <write>
+     605:	83 c4 10             	add    $0x10,%esp
+     608:	39 f0                	cmp    %esi,%eax
+     60a:	75 40                	jne    64c <flush+0x83>
+     60c:	be 00 00 00 00       	mov    $0x0,%esi
+     611:	eb 30                	jmp    643 <flush+0x7a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     613:	83 c3 01             	add    $0x1,%ebx
+     616:	83 fb 0f             	cmp    $0xf,%ebx
+     619:	7f 28                	jg     643 <flush+0x7a>
+      if(flush(fd) < 0)
+     61b:	83 ec 0c             	sub    $0xc,%esp
+     61e:	53                   	push   %ebx
+     61f:	e8 a5 ff ff ff       	call   5c9 <flush>
+     624:	83 c4 10             	add    $0x10,%esp
+     627:	85 c0                	test   %eax,%eax
+     629:	79 e8                	jns    613 <flush+0x4a>
+        r = -1;
+     62b:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     630:	eb e1                	jmp    613 <flush+0x4a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     632:	be 00 00 00 00       	mov    $0x0,%esi
+     637:	bb 00 00 00 00       	mov    $0x0,%ebx
+     63c:	eb d8                	jmp    616 <flush+0x4d>
+    return 0;
+     63e:	be 00 00 00 00       	mov    $0x0,%esi
+}
+     643:	89 f0                	mov    %esi,%eax
+     645:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     648:	5b                   	pop    %ebx
+     649:	5e                   	pop    %esi
+     64a:	5d                   	pop    %ebp
+     64b:	c3                   	ret
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     64c:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     651:	eb f0                	jmp    643 <flush+0x7a>
+
+00000653 <bufreset>:
+
+static void
+bufreset(int fd)
+{
+  if(fd >= 0 && fd < NOBUF){
+     653:	83 f8 0f             	cmp    $0xf,%eax
+     656:	76 01                	jbe    659 <bufreset+0x6>
+     658:	c3                   	ret
+{
+     659:	55                   	push   %ebp
+     65a:	89 e5                	mov    %esp,%ebp
+     65c:	53                   	push   %ebx
+     65d:	83 ec 10             	sub    $0x10,%esp
+     660:	89 c3                	mov    %eax,%ebx
+    flush(fd);
+     662:	50                   	push   %eax
+     663:	e8 61 ff ff ff       	call   5c9 <flush>
+    obuf[fd].mode = BUNKNOWN;
+     668:	69 db 08 02 00 00    	imul   $0x208,%ebx,%ebx
+     66e:	c7 83 c0 1b 00 00 00 	movl   $0x0,0x1bc0(%ebx)
+     675:	00 00 00 
+     678:	83 c4 10             	add    $0x10,%esp
+  }
+}
+     67b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     67e:	c9                   	leave
+     67f:	c3                   	ret
+
+00000680 <bufwrite>:
+
+// Write n bytes from p to fd, through its buffer.
+// Returns n, or -1 if a write fails.
+int
+bufwrite(int fd, const void *p, int n)
+{
+     680:	55                   	push   %ebp
+     681:	89 e5                	mov    %esp,%ebp
+     683:	57                   	push   %edi
+     684:	56                   	push   %esi
+     685:	53                   	push   %ebx
+     686:	83 ec 3c             	sub    $0x3c,%esp
+     689:	8b 75 08             	mov    0x8(%ebp),%esi
+     68c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct stat st;
+  const char *s;
+  int i;
+
+  if(fd < 0 || fd >= NOBUF)
+     68f:	83 fe 0f             	cmp    $0xf,%esi
+     692:	0f 87 a2 00 00 00    	ja     73a <bufwrite+0xba>
+    return write(fd, p, n);
+  if(obuf[fd].mode == BUNKNOWN){
+     698:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     69e:	83 b8 c0 1b 00 00 00 	cmpl   $0x0,0x1bc0(%eax)
+     6a5:	75 19                	jne    6c0 <bufwrite+0x40>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     6a7:	83 fe 02             	cmp    $0x2,%esi
+     6aa:	0f 85 9c 00 00 00    	jne    74c <bufwrite+0xcc>
+      obuf[fd].mode = BNONE;
+     6b0:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     6b6:	c7 80 c0 1b 00 00 01 	movl   $0x1,0x1bc0(%eax)
+     6bd:	00 00 00 
+    else
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+  }
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     6c0:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     6c6:	89 da                	mov    %ebx,%edx
+     6c8:	03 90 c4 1b 00 00    	add    0x1bc4(%eax),%edx
+     6ce:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+     6d4:	0f 8f ae 00 00 00    	jg     788 <bufwrite+0x108>
+    return -1;
+  if(n >= OBUFSZ)
+     6da:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+     6e0:	0f 8f bd 00 00 00    	jg     7a3 <bufwrite+0x123>
+    return write(fd, p, n);
+  memmove(obuf[fd].buf + obuf[fd].n, p, n);
+     6e6:	69 d6 08 02 00 00    	imul   $0x208,%esi,%edx
+     6ec:	8d ba c0 1b 00 00    	lea    0x1bc0(%edx),%edi
+     6f2:	8b 82 c4 1b 00 00    	mov    0x1bc4(%edx),%eax
+     6f8:	83 ec 04             	sub    $0x4,%esp
+     6fb:	53                   	push   %ebx
+     6fc:	ff 75 0c             	push   0xc(%ebp)
+     6ff:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     702:	8d 84 10 c8 1b 00 00 	lea    0x1bc8(%eax,%edx,1),%eax
+     709:	50                   	push   %eax
+     70a:	e8 4c fd ff ff       	call   45b <memmove>
+  obuf[fd].n += n;
+     70f:	01 5f 04             	add    %ebx,0x4(%edi)
+  if(obuf[fd].mode == BNONE)
+     712:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     715:	8b 82 c0 1b 00 00    	mov    0x1bc0(%edx),%eax
+     71b:	83 c4 10             	add    $0x10,%esp
+     71e:	83 f8 01             	cmp    $0x1,%eax
+     721:	0f 84 91 00 00 00    	je     7b8 <bufwrite+0x138>
+    return flush(fd) < 0 ? -1 : n;
+  if(obuf[fd].mode == BLINE)
+     727:	83 f8 02             	cmp    $0x2,%eax
+     72a:	0f 84 ca 00 00 00    	je     7fa <bufwrite+0x17a>
+    for(s = p, i = 0; i < n; i++)
+      if(s[i] == '\n')
+        return flush(fd) < 0 ? -1 : n;
+  return n;
+     730:	89 d8                	mov    %ebx,%eax
+}
+     732:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     735:	5b                   	pop    %ebx
+     736:	5e                   	pop    %esi
+     737:	5f                   	pop    %edi
+     738:	5d                   	pop    %ebp
+     739:	c3                   	ret
+    return write(fd, p, n);
+     73a:	83 ec 04             	sub    $0x4,%esp
+     73d:	53                   	push   %ebx
+     73e:	ff 75 0c             	push   0xc(%ebp)
+     741:	56                   	push   %esi
+     742:	e8 18 02 00 00       	call   95f <write>
+     747:	83 c4 10             	add    $0x10,%esp
+     74a:	eb e6                	jmp    732 <bufwrite+0xb2>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     74c:	83 ec 08             	sub    $0x8,%esp
+     74f:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     752:	50                   	push   %eax
+     753:	56                   	push   %esi
+     754:	e8 51 02 00 00       	call   9aa <fstat>
+     759:	83 c4 10             	add    $0x10,%esp
+     75c:	85 c0                	test   %eax,%eax
+     75e:	0f 88 4c ff ff ff    	js     6b0 <bufwrite+0x30>
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+     764:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     769:	74 16                	je     781 <bufwrite+0x101>
+     76b:	ba 03 00 00 00       	mov    $0x3,%edx
+     770:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     776:	89 90 c0 1b 00 00    	mov    %edx,0x1bc0(%eax)
+     77c:	e9 3f ff ff ff       	jmp    6c0 <bufwrite+0x40>
+     781:	ba 02 00 00 00       	mov    $0x2,%edx
+     786:	eb e8                	jmp    770 <bufwrite+0xf0>
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     788:	83 ec 0c             	sub    $0xc,%esp
+     78b:	56                   	push   %esi
+     78c:	e8 38 fe ff ff       	call   5c9 <flush>
+     791:	83 c4 10             	add    $0x10,%esp
+     794:	85 c0                	test   %eax,%eax
+     796:	0f 89 3e ff ff ff    	jns    6da <bufwrite+0x5a>
+    return -1;
+     79c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     7a1:	eb 8f                	jmp    732 <bufwrite+0xb2>
+    return write(fd, p, n);
+     7a3:	83 ec 04             	sub    $0x4,%esp
+     7a6:	53                   	push   %ebx
+     7a7:	ff 75 0c             	push   0xc(%ebp)
+     7aa:	56                   	push   %esi
+     7ab:	e8 af 01 00 00       	call   95f <write>
+     7b0:	83 c4 10             	add    $0x10,%esp
+     7b3:	e9 7a ff ff ff       	jmp    732 <bufwrite+0xb2>
+    return flush(fd) < 0 ? -1 : n;
+     7b8:	83 ec 0c             	sub    $0xc,%esp
+     7bb:	56                   	push   %esi
+     7bc:	e8 08 fe ff ff       	call   5c9 <flush>
+     7c1:	83 c4 10             	add    $0x10,%esp
+     7c4:	85 c0                	test   %eax,%eax
+     7c6:	78 07                	js     7cf <bufwrite+0x14f>
+     7c8:	89 d8                	mov    %ebx,%eax
+     7ca:	e9 63 ff ff ff       	jmp    732 <bufwrite+0xb2>
+     7cf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     7d4:	e9 59 ff ff ff       	jmp    732 <bufwrite+0xb2>
+        return flush(fd) < 0 ? -1 : n;
+     7d9:	83 ec 0c             	sub    $0xc,%esp
+     7dc:	56                   	push   %esi
+     7dd:	e8 e7 fd ff ff       	call   5c9 <flush>
+     7e2:	83 c4 10             	add    $0x10,%esp
+     7e5:	85 c0                	test   %eax,%eax
+     7e7:	78 07                	js     7f0 <bufwrite+0x170>
+     7e9:	89 d8                	mov    %ebx,%eax
+     7eb:	e9 42 ff ff ff       	jmp    732 <bufwrite+0xb2>
+     7f0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     7f5:	e9 38 ff ff ff       	jmp    732 <bufwrite+0xb2>
+    for(s = p, i = 0; i < n; i++)
+     7fa:	b8 00 00 00 00       	mov    $0x0,%eax
+     7ff:	39 d8                	cmp    %ebx,%eax
+     801:	7d 0e                	jge    811 <bufwrite+0x191>
+      if(s[i] == '\n')
+     803:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     806:	80 3c 01 0a          	cmpb   $0xa,(%ecx,%eax,1)
+     80a:	74 cd                	je     7d9 <bufwrite+0x159>
+    for(s = p, i = 0; i < n; i++)
+     80c:	83 c0 01             	add    $0x1,%eax
+     80f:	eb ee                	jmp    7ff <bufwrite+0x17f>
+  return n;
+     811:	89 d8                	mov    %ebx,%eax
+     813:	e9 1a ff ff ff       	jmp    732 <bufwrite+0xb2>
+
+00000818 <fork>:
+
+int
+fork(void)
+{
+     818:	55                   	push   %ebp
+     819:	89 e5                	mov    %esp,%ebp
+     81b:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     81e:	6a ff                	push   $0xffffffff
+     820:	e8 a4 fd ff ff       	call   5c9 <flush>
+  return _fork();
+     825:	e8 bd 00 00 00       	call   8e7 <_fork>
+}
+     82a:	c9                   	leave
+     82b:	c3                   	ret
+
+0000082c <exit>:
+
+int
+exit(void)
+{
+     82c:	55                   	push   %ebp
+     82d:	89 e5                	mov    %esp,%ebp
+     82f:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     832:	6a ff                	push   $0xffffffff
+     834:	e8 90 fd ff ff       	call   5c9 <flush>
+  _exit();
+     839:	e8 b8 00 00 00       	call   8f6 <_exit>
+
+0000083e <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     83e:	55                   	push   %ebp
+     83f:	89 e5                	mov    %esp,%ebp
+     841:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     844:	6a ff                	push   $0xffffffff
+     846:	e8 7e fd ff ff       	call   5c9 <flush>
+  return _exec(path, argv);
+     84b:	83 c4 08             	add    $0x8,%esp
+     84e:	ff 75 0c             	push   0xc(%ebp)
+     851:	ff 75 08             	push   0x8(%ebp)
+     854:	e8 bb 00 00 00       	call   914 <_exec>
+}
+     859:	c9                   	leave
+     85a:	c3                   	ret
+
+0000085b <close>:
+
+int
+close(int fd)
+{
+     85b:	55                   	push   %ebp
+     85c:	89 e5                	mov    %esp,%ebp
+     85e:	53                   	push   %ebx
+     85f:	83 ec 04             	sub    $0x4,%esp
+     862:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bufreset(fd);
+     865:	89 d8                	mov    %ebx,%eax
+     867:	e8 e7 fd ff ff       	call   653 <bufreset>
+  return _close(fd);
+     86c:	83 ec 0c             	sub    $0xc,%esp
+     86f:	53                   	push   %ebx
+     870:	e8 90 00 00 00       	call   905 <_close>
+}
+     875:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     878:	c9                   	leave
+     879:	c3                   	ret
+
+0000087a <stat>:
+{
+     87a:	55                   	push   %ebp
+     87b:	89 e5                	mov    %esp,%ebp
+     87d:	56                   	push   %esi
+     87e:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     87f:	83 ec 08             	sub    $0x8,%esp
+     882:	6a 00                	push   $0x0
+     884:	ff 75 08             	push   0x8(%ebp)
+     887:	e8 f1 00 00 00       	call   97d <open>
+  if(fd < 0)
+     88c:	83 c4 10             	add    $0x10,%esp
+     88f:	85 c0                	test   %eax,%eax
+     891:	78 24                	js     8b7 <stat+0x3d>
+     893:	89 c3                	mov    %eax,%ebx
+  r = fstat(fd, st);
+     895:	83 ec 08             	sub    $0x8,%esp
+     898:	ff 75 0c             	push   0xc(%ebp)
+     89b:	50                   	push   %eax
+     89c:	e8 09 01 00 00       	call   9aa <fstat>
+     8a1:	89 c6                	mov    %eax,%esi
+  close(fd);
+     8a3:	89 1c 24             	mov    %ebx,(%esp)
+     8a6:	e8 b0 ff ff ff       	call   85b <close>
+  return r;
+     8ab:	83 c4 10             	add    $0x10,%esp
+}
+     8ae:	89 f0                	mov    %esi,%eax
+     8b0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     8b3:	5b                   	pop    %ebx
+     8b4:	5e                   	pop    %esi
+     8b5:	5d                   	pop    %ebp
+     8b6:	c3                   	ret
+    return -1;
+     8b7:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     8bc:	eb f0                	jmp    8ae <stat+0x34>
+
+000008be <dup2>:
+
+int
+dup2(int oldfd, int newfd)
+{
+     8be:	55                   	push   %ebp
+     8bf:	89 e5                	mov    %esp,%ebp
+     8c1:	56                   	push   %esi
+     8c2:	53                   	push   %ebx
+     8c3:	8b 75 08             	mov    0x8(%ebp),%esi
+     8c6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(oldfd != newfd)
+     8c9:	39 de                	cmp    %ebx,%esi
+     8cb:	75 11                	jne    8de <dup2+0x20>
+    bufreset(newfd);
+  return _dup2(oldfd, newfd);
+     8cd:	83 ec 08             	sub    $0x8,%esp
+     8d0:	53                   	push   %ebx
+     8d1:	56                   	push   %esi
+     8d2:	e8 4c 00 00 00       	call   923 <_dup2>
+}
+     8d7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     8da:	5b                   	pop    %ebx
+     8db:	5e                   	pop    %esi
+     8dc:	5d                   	pop    %ebp
+     8dd:	c3                   	ret
+    bufreset(newfd);
+     8de:	89 d8                	mov    %ebx,%eax
+     8e0:	e8 6e fd ff ff       	call   653 <bufreset>
+     8e5:	eb e6                	jmp    8cd <dup2+0xf>
+
+000008e7 <_fork>:
+  1: ret
+
+#define SYSCALL(name) STUB(name, SYS_ ## name)
+
+# ulib.c wraps these, to flush printf()'s buffers first.
+STUB(_fork, SYS_fork)
+     8e7:	b8 01 00 00 00       	mov    $0x1,%eax
+     8ec:	89 e1                	mov    %esp,%ecx
+     8ee:	ba f5 08 00 00       	mov    $0x8f5,%edx
+     8f3:	0f 34                	sysenter
+     8f5:	c3                   	ret
+
+000008f6 <_exit>:
+STUB(_exit, SYS_exit)
+     8f6:	b8 02 00 00 00       	mov    $0x2,%eax
+     8fb:	89 e1                	mov    %esp,%ecx
+     8fd:	ba 04 09 00 00       	mov    $0x904,%edx
+     902:	0f 34                	sysenter
+     904:	c3                   	ret
+
+00000905 <_close>:
+STUB(_close, SYS_close)
+     905:	b8 15 00 00 00       	mov    $0x15,%eax
+     90a:	89 e1                	mov    %esp,%ecx
+     90c:	ba 13 09 00 00       	mov    $0x913,%edx
+     911:	0f 34                	sysenter
+     913:	c3                   	ret
+
+00000914 <_exec>:
+STUB(_exec, SYS_exec)
+     914:	b8 07 00 00 00       	mov    $0x7,%eax
+     919:	89 e1                	mov    %esp,%ecx
+     91b:	ba 22 09 00 00       	mov    $0x922,%edx
+     920:	0f 34                	sysenter
+     922:	c3                   	ret
+
+00000923 <_dup2>:
+STUB(_dup2, SYS_dup2)
+     923:	b8 17 00 00 00       	mov    $0x17,%eax
+     928:	89 e1                	mov    %esp,%ecx
+     92a:	ba 31 09 00 00       	mov    $0x931,%edx
+     92f:	0f 34                	sysenter
+     931:	c3                   	ret
+
+00000932 <wait>:
+
+SYSCALL(wait)
+     932:	b8 03 00 00 00       	mov    $0x3,%eax
+     937:	89 e1                	mov    %esp,%ecx
+     939:	ba 40 09 00 00       	mov    $0x940,%edx
+     93e:	0f 34                	sysenter
+     940:	c3                   	ret
+
+00000941 <pipe>:
+SYSCALL(pipe)
+     941:	b8 04 00 00 00       	mov    $0x4,%eax
+     946:	89 e1                	mov    %esp,%ecx
+     948:	ba 4f 09 00 00       	mov    $0x94f,%edx
+     94d:	0f 34                	sysenter
+     94f:	c3                   	ret
+
+00000950 <read>:
+SYSCALL(read)
+     950:	b8 05 00 00 00       	mov    $0x5,%eax
+     955:	89 e1                	mov    %esp,%ecx
+     957:	ba 5e 09 00 00       	mov    $0x95e,%edx
+     95c:	0f 34                	sysenter
+     95e:	c3                   	ret
+
+0000095f <write>:
+SYSCALL(write)
+     95f:	b8 10 00 00 00       	mov    $0x10,%eax
+     964:	89 e1                	mov    %esp,%ecx
+     966:	ba 6d 09 00 00       	mov    $0x96d,%edx
+     96b:	0f 34                	sysenter
+     96d:	c3                   	ret
+
+0000096e <kill>:
+SYSCALL(kill)
+     96e:	b8 06 00 00 00       	mov    $0x6,%eax
+     973:	89 e1                	mov    %esp,%ecx
+     975:	ba 7c 09 00 00       	mov    $0x97c,%edx
+     97a:	0f 34                	sysenter
+     97c:	c3                   	ret
+
+0000097d <open>:
+SYSCALL(open)
+     97d:	b8 0f 00 00 00       	mov    $0xf,%eax
+     982:	89 e1                	mov    %esp,%ecx
+     984:	ba 8b 09 00 00       	mov    $0x98b,%edx
+     989:	0f 34                	sysenter
+     98b:	c3                   	ret
+
+0000098c <mknod>:
+SYSCALL(mknod)
+     98c:	b8 11 00 00 00       	mov    $0x11,%eax
+     991:	89 e1                	mov    %esp,%ecx
+     993:	ba 9a 09 00 00       	mov    $0x99a,%edx
+     998:	0f 34                	sysenter
+     99a:	c3                   	ret
+
+0000099b <unlink>:
+SYSCALL(unlink)
+     99b:	b8 12 00 00 00       	mov    $0x12,%eax
+     9a0:	89 e1                	mov    %esp,%ecx
+     9a2:	ba a9 09 00 00       	mov    $0x9a9,%edx
+     9a7:	0f 34                	sysenter
+     9a9:	c3                   	ret
+
+000009aa <fstat>:
+SYSCALL(fstat)
+     9aa:	b8 08 00 00 00       	mov    $0x8,%eax
+     9af:	89 e1                	mov    %esp,%ecx
+     9b1:	ba b8 09 00 00       	mov    $0x9b8,%edx
+     9b6:	0f 34                	sysenter
+     9b8:	c3                   	ret
+
+000009b9 <link>:
+SYSCALL(link)
+     9b9:	b8 13 00 00 00       	mov    $0x13,%eax
+     9be:	89 e1                	mov    %esp,%ecx
+     9c0:	ba c7 09 00 00       	mov    $0x9c7,%edx
+     9c5:	0f 34                	sysenter
+     9c7:	c3                   	ret
+
+000009c8 <mkdir>:
+SYSCALL(mkdir)
+     9c8:	b8 14 00 00 00       	mov    $0x14,%eax
+     9cd:	89 e1                	mov    %esp,%ecx
+     9cf:	ba d6 09 00 00       	mov    $0x9d6,%edx
+     9d4:	0f 34                	sysenter
+     9d6:	c3                   	ret
+
+000009d7 <chdir>:
+SYSCALL(chdir)
+     9d7:	b8 09 00 00 00       	mov    $0x9,%eax
+     9dc:	89 e1                	mov    %esp,%ecx
+     9de:	ba e5 09 00 00       	mov    $0x9e5,%edx
+     9e3:	0f 34                	sysenter
+     9e5:	c3                   	ret
+
+000009e6 <dup>:
+SYSCALL(dup)
+     9e6:	b8 0a 00 00 00       	mov    $0xa,%eax
+     9eb:	89 e1                	mov    %esp,%ecx
+     9ed:	ba f4 09 00 00       	mov    $0x9f4,%edx
+     9f2:	0f 34                	sysenter
+     9f4:	c3                   	ret
+
+000009f5 <getpid>:
+SYSCALL(getpid)
+     9f5:	b8 0b 00 00 00       	mov    $0xb,%eax
+     9fa:	89 e1                	mov    %esp,%ecx
+     9fc:	ba 03 0a 00 00       	mov    $0xa03,%edx
+     a01:	0f 34                	sysenter
+     a03:	c3                   	ret
+
+00000a04 <sbrk>:
+SYSCALL(sbrk)
+     a04:	b8 0c 00 00 00       	mov    $0xc,%eax
+     a09:	89 e1                	mov    %esp,%ecx
+     a0b:	ba 12 0a 00 00       	mov    $0xa12,%edx
+     a10:	0f 34                	sysenter
+     a12:	c3                   	ret
+
+00000a13 <sleep>:
+SYSCALL(sleep)
+     a13:	b8 0d 00 00 00       	mov    $0xd,%eax
+     a18:	89 e1                	mov    %esp,%ecx
+     a1a:	ba 21 0a 00 00       	mov    $0xa21,%edx
+     a1f:	0f 34                	sysenter
+     a21:	c3                   	ret
+
+00000a22 <uptime>:
+SYSCALL(uptime)
+     a22:	b8 0e 00 00 00       	mov    $0xe,%eax
+     a27:	89 e1                	mov    %esp,%ecx
+     a29:	ba 30 0a 00 00       	mov    $0xa30,%edx
+     a2e:	0f 34                	sysenter
+     a30:	c3                   	ret
+
+00000a31 <date>:
+SYSCALL(date)
+     a31:	b8 16 00 00 00       	mov    $0x16,%eax
+     a36:	89 e1                	mov    %esp,%ecx
+     a38:	ba 3f 0a 00 00       	mov    $0xa3f,%edx
+     a3d:	0f 34                	sysenter
+     a3f:	c3                   	ret
+
+00000a40 <faultaround>:
+SYSCALL(faultaround)
+     a40:	b8 18 00 00 00       	mov    $0x18,%eax
+     a45:	89 e1                	mov    %esp,%ecx
+     a47:	ba 4e 0a 00 00       	mov    $0xa4e,%edx
+     a4c:	0f 34                	sysenter
+     a4e:	c3                   	ret
+
+00000a4f <faultstat>:
+SYSCALL(faultstat)
+     a4f:	b8 19 00 00 00       	mov    $0x19,%eax
+     a54:	89 e1                	mov    %esp,%ecx
+     a56:	ba 5d 0a 00 00       	mov    $0xa5d,%edx
+     a5b:	0f 34                	sysenter
+     a5d:	c3                   	ret
+
+00000a5e <mmap>:
+SYSCALL(mmap)
+     a5e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     a63:	89 e1                	mov    %esp,%ecx
+     a65:	ba 6c 0a 00 00       	mov    $0xa6c,%edx
+     a6a:	0f 34                	sysenter
+     a6c:	c3                   	ret
+
+00000a6d <munmap>:
+SYSCALL(munmap)
+     a6d:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     a72:	89 e1                	mov    %esp,%ecx
+     a74:	ba 7b 0a 00 00       	mov    $0xa7b,%edx
+     a79:	0f 34                	sysenter
+     a7b:	c3                   	ret
+
+00000a7c <largepages>:
+SYSCALL(largepages)
+     a7c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     a81:	89 e1                	mov    %esp,%ecx
+     a83:	ba 8a 0a 00 00       	mov    $0xa8a,%edx
+     a88:	0f 34                	sysenter
+     a8a:	c3                   	ret
+
+00000a8b <spawn>:
+SYSCALL(spawn)
+     a8b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     a90:	89 e1                	mov    %esp,%ecx
+     a92:	ba 99 0a 00 00       	mov    $0xa99,%edx
+     a97:	0f 34                	sysenter
+     a99:	c3                   	ret
+
+00000a9a <setpriority>:
+SYSCALL(setpriority)
+     a9a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     a9f:	89 e1                	mov    %esp,%ecx
+     aa1:	ba a8 0a 00 00       	mov    $0xaa8,%edx
+     aa6:	0f 34                	sysenter
+     aa8:	c3                   	ret
+
+00000aa9 <getpriority>:
+SYSCALL(getpriority)
+     aa9:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     aae:	89 e1                	mov    %esp,%ecx
+     ab0:	ba b7 0a 00 00       	mov    $0xab7,%edx
+     ab5:	0f 34                	sysenter
+     ab7:	c3                   	ret
+
+00000ab8 <getprocinfo>:
+SYSCALL(getprocinfo)
+     ab8:	b8 20 00 00 00       	mov    $0x20,%eax
+     abd:	89 e1                	mov    %esp,%ecx
+     abf:	ba c6 0a 00 00       	mov    $0xac6,%edx
+     ac4:	0f 34                	sysenter
+     ac6:	c3                   	ret
+
+00000ac7 <getcpuinfo>:
+SYSCALL(getcpuinfo)
+     ac7:	b8 21 00 00 00       	mov    $0x21,%eax
+     acc:	89 e1                	mov    %esp,%ecx
+     ace:	ba d5 0a 00 00       	mov    $0xad5,%edx
+     ad3:	0f 34                	sysenter
+     ad5:	c3                   	ret
+
+00000ad6 <clone>:
+SYSCALL(clone)
+     ad6:	b8 22 00 00 00       	mov    $0x22,%eax
+     adb:	89 e1                	mov    %esp,%ecx
+     add:	ba e4 0a 00 00       	mov    $0xae4,%edx
+     ae2:	0f 34                	sysenter
+     ae4:	c3                   	ret
+
+00000ae5 <join>:
+SYSCALL(join)
+     ae5:	b8 23 00 00 00       	mov    $0x23,%eax
+     aea:	89 e1                	mov    %esp,%ecx
+     aec:	ba f3 0a 00 00       	mov    $0xaf3,%edx
+     af1:	0f 34                	sysenter
+     af3:	c3                   	ret
+
+00000af4 <futex_wait>:
+SYSCALL(futex_wait)
+     af4:	b8 24 00 00 00       	mov    $0x24,%eax
+     af9:	89 e1                	mov    %esp,%ecx
+     afb:	ba 02 0b 00 00       	mov    $0xb02,%edx
+     b00:	0f 34                	sysenter
+     b02:	c3                   	ret
+
+00000b03 <futex_wake>:
+SYSCALL(futex_wake)
+     b03:	b8 25 00 00 00       	mov    $0x25,%eax
+     b08:	89 e1                	mov    %esp,%ecx
+     b0a:	ba 11 0b 00 00       	mov    $0xb11,%edx
+     b0f:	0f 34                	sysenter
+     b11:	c3                   	ret
+
+00000b12 <setaffinity>:
+SYSCALL(setaffinity)
+     b12:	b8 26 00 00 00       	mov    $0x26,%eax
+     b17:	89 e1                	mov    %esp,%ecx
+     b19:	ba 20 0b 00 00       	mov    $0xb20,%edx
+     b1e:	0f 34                	sysenter
+     b20:	c3                   	ret
+
+00000b21 <getaffinity>:
+SYSCALL(getaffinity)
+     b21:	b8 27 00 00 00       	mov    $0x27,%eax
+     b26:	89 e1                	mov    %esp,%ecx
+     b28:	ba 2f 0b 00 00       	mov    $0xb2f,%edx
+     b2d:	0f 34                	sysenter
+     b2f:	c3                   	ret
+
+00000b30 <clock_gettime>:
+SYSCALL(clock_gettime)
+     b30:	b8 28 00 00 00       	mov    $0x28,%eax
+     b35:	89 e1                	mov    %esp,%ecx
+     b37:	ba 3e 0b 00 00       	mov    $0xb3e,%edx
+     b3c:	0f 34                	sysenter
+     b3e:	c3                   	ret
+
+00000b3f <msleep>:
+SYSCALL(msleep)
+     b3f:	b8 29 00 00 00       	mov    $0x29,%eax
+     b44:	89 e1                	mov    %esp,%ecx
+     b46:	ba 4d 0b 00 00       	mov    $0xb4d,%edx
+     b4b:	0f 34                	sysenter
+     b4d:	c3                   	ret
+
+00000b4e <lockstat>:
+SYSCALL(lockstat)
+     b4e:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     b53:	89 e1                	mov    %esp,%ecx
+     b55:	ba 5c 0b 00 00       	mov    $0xb5c,%edx
+     b5a:	0f 34                	sysenter
+     b5c:	c3                   	ret
+
+00000b5d <bstat>:
+SYSCALL(bstat)
+     b5d:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     b62:	89 e1                	mov    %esp,%ecx
+     b64:	ba 6b 0b 00 00       	mov    $0xb6b,%edx
+     b69:	0f 34                	sysenter
+     b6b:	c3                   	ret
+
+00000b6c <iostat>:
+SYSCALL(iostat)
+     b6c:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     b71:	89 e1                	mov    %esp,%ecx
+     b73:	ba 7a 0b 00 00       	mov    $0xb7a,%edx
+     b78:	0f 34                	sysenter
+     b7a:	c3                   	ret
+
+00000b7b <fsync>:
+SYSCALL(fsync)
+     b7b:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     b80:	89 e1                	mov    %esp,%ecx
+     b82:	ba 89 0b 00 00       	mov    $0xb89,%edx
+     b87:	0f 34                	sysenter
+     b89:	c3                   	ret
+
+00000b8a <pread>:
+SYSCALL(pread)
+     b8a:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     b8f:	89 e1                	mov    %esp,%ecx
+     b91:	ba 98 0b 00 00       	mov    $0xb98,%edx
+     b96:	0f 34                	sysenter
+     b98:	c3                   	ret
+
+00000b99 <pwrite>:
+SYSCALL(pwrite)
+     b99:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     b9e:	89 e1                	mov    %esp,%ecx
+     ba0:	ba a7 0b 00 00       	mov    $0xba7,%edx
+     ba5:	0f 34                	sysenter
+     ba7:	c3                   	ret
+
+00000ba8 <readv>:
+SYSCALL(readv)
+     ba8:	b8 30 00 00 00       	mov    $0x30,%eax
+     bad:	89 e1                	mov    %esp,%ecx
+     baf:	ba b6 0b 00 00       	mov    $0xbb6,%edx
+     bb4:	0f 34                	sysenter
+     bb6:	c3                   	ret
+
+00000bb7 <writev>:
+SYSCALL(writev)
+     bb7:	b8 31 00 00 00       	mov    $0x31,%eax
+     bbc:	89 e1                	mov    %esp,%ecx
+     bbe:	ba c5 0b 00 00       	mov    $0xbc5,%edx
+     bc3:	0f 34                	sysenter
+     bc5:	c3                   	ret
+
+00000bc6 <sendfile>:
+SYSCALL(sendfile)
+     bc6:	b8 32 00 00 00       	mov    $0x32,%eax
+     bcb:	89 e1                	mov    %esp,%ecx
+     bcd:	ba d4 0b 00 00       	mov    $0xbd4,%edx
+     bd2:	0f 34                	sysenter
+     bd4:	c3                   	ret
+
+00000bd5 <fcntl>:
+SYSCALL(fcntl)
+     bd5:	b8 33 00 00 00       	mov    $0x33,%eax
+     bda:	89 e1                	mov    %esp,%ecx
+     bdc:	ba e3 0b 00 00       	mov    $0xbe3,%edx
+     be1:	0f 34                	sysenter
+     be3:	c3                   	ret
+
+00000be4 <mount>:
+SYSCALL(mount)
+     be4:	b8 34 00 00 00       	mov    $0x34,%eax
+     be9:	89 e1                	mov    %esp,%ecx
+     beb:	ba f2 0b 00 00       	mov    $0xbf2,%edx
+     bf0:	0f 34                	sysenter
+     bf2:	c3                   	ret
+
+00000bf3 <getdents>:
+SYSCALL(getdents)
+     bf3:	b8 35 00 00 00       	mov    $0x35,%eax
+     bf8:	89 e1                	mov    %esp,%ecx
+     bfa:	ba 01 0c 00 00       	mov    $0xc01,%edx
+     bff:	0f 34                	sysenter
+     c01:	c3                   	ret
+
+00000c02 <fstatat>:
+SYSCALL(fstatat)
+     c02:	b8 36 00 00 00       	mov    $0x36,%eax
+     c07:	89 e1                	mov    %esp,%ecx
+     c09:	ba 10 0c 00 00       	mov    $0xc10,%edx
+     c0e:	0f 34                	sysenter
+     c10:	c3                   	ret
+
+00000c11 <sysstat>:
+SYSCALL(sysstat)
+     c11:	b8 37 00 00 00       	mov    $0x37,%eax
+     c16:	89 e1                	mov    %esp,%ecx
+     c18:	ba 1f 0c 00 00       	mov    $0xc1f,%edx
+     c1d:	0f 34                	sysenter
+     c1f:	c3                   	ret
+
+00000c20 <ringenter>:
+SYSCALL(ringenter)
+     c20:	b8 38 00 00 00       	mov    $0x38,%eax
+     c25:	89 e1                	mov    %esp,%ecx
+     c27:	ba 2e 0c 00 00       	mov    $0xc2e,%edx
+     c2c:	0f 34                	sysenter
+     c2e:	c3                   	ret
+
+00000c2f <trace>:
+SYSCALL(trace)
+     c2f:	b8 39 00 00 00       	mov    $0x39,%eax
+     c34:	89 e1                	mov    %esp,%ecx
+     c36:	ba 3d 0c 00 00       	mov    $0xc3d,%edx
+     c3b:	0f 34                	sysenter
+     c3d:	c3                   	ret
+
+00000c3e <memstat>:
+SYSCALL(memstat)
+     c3e:	b8 3a 00 00 00       	mov    $0x3a,%eax
+     c43:	89 e1                	mov    %esp,%ecx
+     c45:	ba 4c 0c 00 00       	mov    $0xc4c,%edx
+     c4a:	0f 34                	sysenter
+     c4c:	c3                   	ret
+
+00000c4d <shmget>:
+SYSCALL(shmget)
+     c4d:	b8 3b 00 00 00       	mov    $0x3b,%eax
+     c52:	89 e1                	mov    %esp,%ecx
+     c54:	ba 5b 0c 00 00       	mov    $0xc5b,%edx
+     c59:	0f 34                	sysenter
+     c5b:	c3                   	ret
+
+00000c5c <shmat>:
+SYSCALL(shmat)
+     c5c:	b8 3c 00 00 00       	mov    $0x3c,%eax
+     c61:	89 e1                	mov    %esp,%ecx
+     c63:	ba 6a 0c 00 00       	mov    $0xc6a,%edx
+     c68:	0f 34                	sysenter
+     c6a:	c3                   	ret
+
+00000c6b <shmdt>:
+SYSCALL(shmdt)
+     c6b:	b8 3d 00 00 00       	mov    $0x3d,%eax
+     c70:	89 e1                	mov    %esp,%ecx
+     c72:	ba 79 0c 00 00       	mov    $0xc79,%edx
+     c77:	0f 34                	sysenter
+     c79:	c3                   	ret
+
+00000c7a <irqstat>:
+SYSCALL(irqstat)
+     c7a:	b8 3e 00 00 00       	mov    $0x3e,%eax
+     c7f:	89 e1                	mov    %esp,%ecx
+     c81:	ba 88 0c 00 00       	mov    $0xc88,%edx
+     c86:	0f 34                	sysenter
+     c88:	c3                   	ret
+
+00000c89 <irqroute>:
+SYSCALL(irqroute)
+     c89:	b8 3f 00 00 00       	mov    $0x3f,%eax
+     c8e:	89 e1                	mov    %esp,%ecx
+     c90:	ba 97 0c 00 00       	mov    $0xc97,%edx
+     c95:	0f 34                	sysenter
+     c97:	c3                   	ret
+
+00000c98 <putc>:
+  char buf[64];
+};
+
+static void
+putc(struct out *o, char c)
+{
+     c98:	55                   	push   %ebp
+     c99:	89 e5                	mov    %esp,%ebp
+     c9b:	56                   	push   %esi
+     c9c:	53                   	push   %ebx
+     c9d:	89 c3                	mov    %eax,%ebx
+     c9f:	89 d6                	mov    %edx,%esi
+  if(o->n == sizeof(o->buf)){
+     ca1:	8b 40 04             	mov    0x4(%eax),%eax
+     ca4:	83 f8 40             	cmp    $0x40,%eax
+     ca7:	74 16                	je     cbf <putc+0x27>
+    bufwrite(o->fd, o->buf, o->n);
+    o->n = 0;
+  }
+  o->buf[o->n++] = c;
+     ca9:	8b 43 04             	mov    0x4(%ebx),%eax
+     cac:	8d 50 01             	lea    0x1(%eax),%edx
+     caf:	89 53 04             	mov    %edx,0x4(%ebx)
+     cb2:	89 f1                	mov    %esi,%ecx
+     cb4:	88 4c 03 08          	mov    %cl,0x8(%ebx,%eax,1)
+}
+     cb8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     cbb:	5b                   	pop    %ebx
+     cbc:	5e                   	pop    %esi
+     cbd:	5d                   	pop    %ebp
+     cbe:	c3                   	ret
+    bufwrite(o->fd, o->buf, o->n);
+     cbf:	8d 53 08             	lea    0x8(%ebx),%edx
+     cc2:	83 ec 04             	sub    $0x4,%esp
+     cc5:	50                   	push   %eax
+     cc6:	52                   	push   %edx
+     cc7:	ff 33                	push   (%ebx)
+     cc9:	e8 b2 f9 ff ff       	call   680 <bufwrite>
+    o->n = 0;
+     cce:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     cd5:	83 c4 10             	add    $0x10,%esp
+     cd8:	eb cf                	jmp    ca9 <putc+0x11>
+
+00000cda <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     cda:	55                   	push   %ebp
+     cdb:	89 e5                	mov    %esp,%ebp
+     cdd:	57                   	push   %edi
+     cde:	56                   	push   %esi
+     cdf:	53                   	push   %ebx
+     ce0:	83 ec 2c             	sub    $0x2c,%esp
+     ce3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     ce6:	89 d0                	mov    %edx,%eax
+     ce8:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+     cea:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     cee:	0f 95 c1             	setne  %cl
+     cf1:	c1 ea 1f             	shr    $0x1f,%edx
+     cf4:	84 d1                	test   %dl,%cl
+     cf6:	74 44                	je     d3c <printint+0x62>
+    neg = 1;
+    x = -xx;
+     cf8:	f7 d8                	neg    %eax
+     cfa:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+     cfc:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     d03:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+     d08:	89 c8                	mov    %ecx,%eax
+     d0a:	ba 00 00 00 00       	mov    $0x0,%edx
+     d0f:	f7 f6                	div    %esi
+     d11:	89 df                	mov    %ebx,%edi
+     d13:	83 c3 01             	add    $0x1,%ebx
+     d16:	0f b6 92 b0 14 00 00 	movzbl 0x14b0(%edx),%edx
+     d1d:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+     d21:	89 ca                	mov    %ecx,%edx
+     d23:	89 c1                	mov    %eax,%ecx
+     d25:	39 f2                	cmp    %esi,%edx
+     d27:	73 df                	jae    d08 <printint+0x2e>
+  if(neg)
+     d29:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     d2d:	74 31                	je     d60 <printint+0x86>
+    buf[i++] = '-';
+     d2f:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+     d34:	8d 5f 02             	lea    0x2(%edi),%ebx
+     d37:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     d3a:	eb 17                	jmp    d53 <printint+0x79>
+    x = xx;
+     d3c:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+     d3e:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     d45:	eb bc                	jmp    d03 <printint+0x29>
+
+  while(--i >= 0)
+    putc(o, buf[i]);
+     d47:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+     d4c:	89 f0                	mov    %esi,%eax
+     d4e:	e8 45 ff ff ff       	call   c98 <putc>
+  while(--i >= 0)
+     d53:	83 eb 01             	sub    $0x1,%ebx
+     d56:	79 ef                	jns    d47 <printint+0x6d>
+}
+     d58:	83 c4 2c             	add    $0x2c,%esp
+     d5b:	5b                   	pop    %ebx
+     d5c:	5e                   	pop    %esi
+     d5d:	5f                   	pop    %edi
+     d5e:	5d                   	pop    %ebp
+     d5f:	c3                   	ret
+     d60:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     d63:	eb ee                	jmp    d53 <printint+0x79>
+
+00000d65 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     d65:	55                   	push   %ebp
+     d66:	89 e5                	mov    %esp,%ebp
+     d68:	57                   	push   %edi
+     d69:	56                   	push   %esi
+     d6a:	53                   	push   %ebx
+     d6b:	83 ec 6c             	sub    $0x6c,%esp
+  int c, i, state;
+  uint *ap;
+  struct out out, *o;
+
+  o = &out;
+  o->fd = fd;
+     d6e:	8b 45 08             	mov    0x8(%ebp),%eax
+     d71:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  o->n = 0;
+     d74:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+     d7b:	8d 45 10             	lea    0x10(%ebp),%eax
+     d7e:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  state = 0;
+     d81:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+     d86:	bb 00 00 00 00       	mov    $0x0,%ebx
+     d8b:	eb 14                	jmp    da1 <printf+0x3c>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(o, c);
+     d8d:	89 fa                	mov    %edi,%edx
+     d8f:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d92:	e8 01 ff ff ff       	call   c98 <putc>
+     d97:	eb 05                	jmp    d9e <printf+0x39>
+      }
+    } else if(state == '%'){
+     d99:	83 fe 25             	cmp    $0x25,%esi
+     d9c:	74 25                	je     dc3 <printf+0x5e>
+  for(i = 0; fmt[i]; i++){
+     d9e:	83 c3 01             	add    $0x1,%ebx
+     da1:	8b 45 0c             	mov    0xc(%ebp),%eax
+     da4:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+     da8:	84 c0                	test   %al,%al
+     daa:	0f 84 20 01 00 00    	je     ed0 <printf+0x16b>
+    c = fmt[i] & 0xff;
+     db0:	0f be f8             	movsbl %al,%edi
+     db3:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     db6:	85 f6                	test   %esi,%esi
+     db8:	75 df                	jne    d99 <printf+0x34>
+      if(c == '%'){
+     dba:	83 f8 25             	cmp    $0x25,%eax
+     dbd:	75 ce                	jne    d8d <printf+0x28>
+        state = '%';
+     dbf:	89 c6                	mov    %eax,%esi
+     dc1:	eb db                	jmp    d9e <printf+0x39>
+      if(c == 'd'){
+     dc3:	83 f8 25             	cmp    $0x25,%eax
+     dc6:	0f 84 cf 00 00 00    	je     e9b <printf+0x136>
+     dcc:	0f 8c dd 00 00 00    	jl     eaf <printf+0x14a>
+     dd2:	83 f8 78             	cmp    $0x78,%eax
+     dd5:	0f 8f d4 00 00 00    	jg     eaf <printf+0x14a>
+     ddb:	83 f8 63             	cmp    $0x63,%eax
+     dde:	0f 8c cb 00 00 00    	jl     eaf <printf+0x14a>
+     de4:	83 e8 63             	sub    $0x63,%eax
+     de7:	83 f8 15             	cmp    $0x15,%eax
+     dea:	0f 87 bf 00 00 00    	ja     eaf <printf+0x14a>
+     df0:	ff 24 85 58 14 00 00 	jmp    *0x1458(,%eax,4)
+        printint(o, *ap, 10, 1);
+     df7:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     dfa:	8b 17                	mov    (%edi),%edx
+     dfc:	83 ec 0c             	sub    $0xc,%esp
+     dff:	6a 01                	push   $0x1
+     e01:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     e06:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     e09:	e8 cc fe ff ff       	call   cda <printint>
+        ap++;
+     e0e:	83 c7 04             	add    $0x4,%edi
+     e11:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     e14:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(o, '%');
+        putc(o, c);
+      }
+      state = 0;
+     e17:	be 00 00 00 00       	mov    $0x0,%esi
+     e1c:	eb 80                	jmp    d9e <printf+0x39>
+        printint(o, *ap, 16, 0);
+     e1e:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     e21:	8b 17                	mov    (%edi),%edx
+     e23:	83 ec 0c             	sub    $0xc,%esp
+     e26:	6a 00                	push   $0x0
+     e28:	b9 10 00 00 00       	mov    $0x10,%ecx
+     e2d:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     e30:	e8 a5 fe ff ff       	call   cda <printint>
+        ap++;
+     e35:	83 c7 04             	add    $0x4,%edi
+     e38:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     e3b:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     e3e:	be 00 00 00 00       	mov    $0x0,%esi
+     e43:	e9 56 ff ff ff       	jmp    d9e <printf+0x39>
+        s = (char*)*ap;
+     e48:	8b 45 94             	mov    -0x6c(%ebp),%eax
+     e4b:	8b 30                	mov    (%eax),%esi
+        ap++;
+     e4d:	83 c0 04             	add    $0x4,%eax
+     e50:	89 45 94             	mov    %eax,-0x6c(%ebp)
+        if(s == 0)
+     e53:	85 f6                	test   %esi,%esi
+     e55:	75 15                	jne    e6c <printf+0x107>
+          s = "(null)";
+     e57:	be 50 14 00 00       	mov    $0x1450,%esi
+     e5c:	eb 0e                	jmp    e6c <printf+0x107>
+          putc(o, *s);
+     e5e:	0f be d2             	movsbl %dl,%edx
+     e61:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     e64:	e8 2f fe ff ff       	call   c98 <putc>
+          s++;
+     e69:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+     e6c:	0f b6 16             	movzbl (%esi),%edx
+     e6f:	84 d2                	test   %dl,%dl
+     e71:	75 eb                	jne    e5e <printf+0xf9>
+      state = 0;
+     e73:	be 00 00 00 00       	mov    $0x0,%esi
+     e78:	e9 21 ff ff ff       	jmp    d9e <printf+0x39>
+        putc(o, *ap);
+     e7d:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     e80:	0f be 17             	movsbl (%edi),%edx
+     e83:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     e86:	e8 0d fe ff ff       	call   c98 <putc>
+        ap++;
+     e8b:	83 c7 04             	add    $0x4,%edi
+     e8e:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+      state = 0;
+     e91:	be 00 00 00 00       	mov    $0x0,%esi
+     e96:	e9 03 ff ff ff       	jmp    d9e <printf+0x39>
+        putc(o, c);
+     e9b:	89 fa                	mov    %edi,%edx
+     e9d:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     ea0:	e8 f3 fd ff ff       	call   c98 <putc>
+      state = 0;
+     ea5:	be 00 00 00 00       	mov    $0x0,%esi
+     eaa:	e9 ef fe ff ff       	jmp    d9e <printf+0x39>
+        putc(o, '%');
+     eaf:	ba 25 00 00 00       	mov    $0x25,%edx
+     eb4:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     eb7:	e8 dc fd ff ff       	call   c98 <putc>
+        putc(o, c);
+     ebc:	89 fa                	mov    %edi,%edx
+     ebe:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     ec1:	e8 d2 fd ff ff       	call   c98 <putc>
+      state = 0;
+     ec6:	be 00 00 00 00       	mov    $0x0,%esi
+     ecb:	e9 ce fe ff ff       	jmp    d9e <printf+0x39>
+    }
+  }
+  if(o->n > 0)
+     ed0:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     ed3:	85 c0                	test   %eax,%eax
+     ed5:	7f 08                	jg     edf <printf+0x17a>
+    bufwrite(fd, o->buf, o->n);
+}
+     ed7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     eda:	5b                   	pop    %ebx
+     edb:	5e                   	pop    %esi
+     edc:	5f                   	pop    %edi
+     edd:	5d                   	pop    %ebp
+     ede:	c3                   	ret
+    bufwrite(fd, o->buf, o->n);
+     edf:	83 ec 04             	sub    $0x4,%esp
+     ee2:	50                   	push   %eax
+     ee3:	8d 45 a8             	lea    -0x58(%ebp),%eax
+     ee6:	50                   	push   %eax
+     ee7:	ff 75 08             	push   0x8(%ebp)
+     eea:	e8 91 f7 ff ff       	call   680 <bufwrite>
+     eef:	83 c4 10             	add    $0x10,%esp
+}
+     ef2:	eb e3                	jmp    ed7 <printf+0x172>
+
+00000ef4 <largefree>:
+  return &b->h;
+}
+
+static void
+largefree(Fblock *b)
+{
+     ef4:	55                   	push   %ebp
+     ef5:	89 e5                	mov    %esp,%ebp
+     ef7:	57                   	push   %edi
+     ef8:	56                   	push   %esi
+     ef9:	53                   	push   %ebx
+     efa:	83 ec 0c             	sub    $0xc,%esp
+     efd:	89 c1                	mov    %eax,%ecx
+  Fblock **pp, *p, *prev;
+
+  prev = 0;
+     eff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     f04:	ba 4c 3c 00 00       	mov    $0x3c4c,%edx
+     f09:	eb 05                	jmp    f10 <largefree+0x1c>
+     f0b:	8d 50 08             	lea    0x8(%eax),%edx
+    prev = p;
+     f0e:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     f10:	8b 02                	mov    (%edx),%eax
+     f12:	85 c0                	test   %eax,%eax
+     f14:	74 04                	je     f1a <largefree+0x26>
+     f16:	39 c8                	cmp    %ecx,%eax
+     f18:	72 f1                	jb     f0b <largefree+0x17>
+  b->next = p;
+     f1a:	89 41 08             	mov    %eax,0x8(%ecx)
+  if(p && (char*)b + b->h.size == (char*)p){
+     f1d:	85 c0                	test   %eax,%eax
+     f1f:	74 09                	je     f2a <largefree+0x36>
+     f21:	8b 31                	mov    (%ecx),%esi
+     f23:	8d 3c 31             	lea    (%ecx,%esi,1),%edi
+     f26:	39 c7                	cmp    %eax,%edi
+     f28:	74 21                	je     f4b <largefree+0x57>
+    b->h.size += p->h.size;
+    b->next = p->next;
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+     f2a:	85 db                	test   %ebx,%ebx
+     f2c:	74 09                	je     f37 <largefree+0x43>
+     f2e:	8b 03                	mov    (%ebx),%eax
+     f30:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+     f33:	39 ce                	cmp    %ecx,%esi
+     f35:	74 20                	je     f57 <largefree+0x63>
+    prev->h.size += b->h.size;
+    prev->next = b->next;
+  } else
+    *pp = b;
+     f37:	89 0a                	mov    %ecx,(%edx)
+
+  // Give the top of the heap back.  With threads sharing the
+  // address space sbrk() cannot shrink it; keep the block then.
+  for(pp = &large; (*pp)->next; pp = &(*pp)->next)
+     f39:	be 4c 3c 00 00       	mov    $0x3c4c,%esi
+     f3e:	8b 1e                	mov    (%esi),%ebx
+     f40:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+     f44:	74 1d                	je     f63 <largefree+0x6f>
+     f46:	8d 73 08             	lea    0x8(%ebx),%esi
+     f49:	eb f3                	jmp    f3e <largefree+0x4a>
+    b->h.size += p->h.size;
+     f4b:	03 30                	add    (%eax),%esi
+     f4d:	89 31                	mov    %esi,(%ecx)
+    b->next = p->next;
+     f4f:	8b 40 08             	mov    0x8(%eax),%eax
+     f52:	89 41 08             	mov    %eax,0x8(%ecx)
+     f55:	eb d3                	jmp    f2a <largefree+0x36>
+    prev->h.size += b->h.size;
+     f57:	03 01                	add    (%ecx),%eax
+     f59:	89 03                	mov    %eax,(%ebx)
+    prev->next = b->next;
+     f5b:	8b 41 08             	mov    0x8(%ecx),%eax
+     f5e:	89 43 08             	mov    %eax,0x8(%ebx)
+     f61:	eb d6                	jmp    f39 <largefree+0x45>
+    ;
+  b = *pp;
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     f63:	89 df                	mov    %ebx,%edi
+     f65:	03 3b                	add    (%ebx),%edi
+     f67:	83 ec 0c             	sub    $0xc,%esp
+     f6a:	6a 00                	push   $0x0
+     f6c:	e8 93 fa ff ff       	call   a04 <sbrk>
+     f71:	83 c4 10             	add    $0x10,%esp
+     f74:	39 c7                	cmp    %eax,%edi
+     f76:	74 08                	je     f80 <largefree+0x8c>
+    *pp = 0;
+}
+     f78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f7b:	5b                   	pop    %ebx
+     f7c:	5e                   	pop    %esi
+     f7d:	5f                   	pop    %edi
+     f7e:	5d                   	pop    %ebp
+     f7f:	c3                   	ret
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     f80:	8b 03                	mov    (%ebx),%eax
+     f82:	f7 d8                	neg    %eax
+     f84:	83 ec 0c             	sub    $0xc,%esp
+     f87:	50                   	push   %eax
+     f88:	e8 77 fa ff ff       	call   a04 <sbrk>
+     f8d:	83 c4 10             	add    $0x10,%esp
+     f90:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f93:	74 e3                	je     f78 <largefree+0x84>
+    *pp = 0;
+     f95:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+     f9b:	eb db                	jmp    f78 <largefree+0x84>
+
+00000f9d <more>:
+{
+     f9d:	55                   	push   %ebp
+     f9e:	89 e5                	mov    %esp,%ebp
+     fa0:	56                   	push   %esi
+     fa1:	53                   	push   %ebx
+     fa2:	89 c6                	mov    %eax,%esi
+  pad = -(uint)sbrk(0) & 7;
+     fa4:	83 ec 0c             	sub    $0xc,%esp
+     fa7:	6a 00                	push   $0x0
+     fa9:	e8 56 fa ff ff       	call   a04 <sbrk>
+     fae:	f7 d8                	neg    %eax
+     fb0:	89 c3                	mov    %eax,%ebx
+     fb2:	83 e3 07             	and    $0x7,%ebx
+  if((p = sbrk(n + pad)) == (char*)-1)
+     fb5:	01 de                	add    %ebx,%esi
+     fb7:	89 34 24             	mov    %esi,(%esp)
+     fba:	e8 45 fa ff ff       	call   a04 <sbrk>
+     fbf:	83 c4 10             	add    $0x10,%esp
+     fc2:	83 f8 ff             	cmp    $0xffffffff,%eax
+     fc5:	74 09                	je     fd0 <more+0x33>
+  return p + pad;
+     fc7:	01 d8                	add    %ebx,%eax
+}
+     fc9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     fcc:	5b                   	pop    %ebx
+     fcd:	5e                   	pop    %esi
+     fce:	5d                   	pop    %ebp
+     fcf:	c3                   	ret
+    return 0;
+     fd0:	b8 00 00 00 00       	mov    $0x0,%eax
+     fd5:	eb f2                	jmp    fc9 <more+0x2c>
+
+00000fd7 <slaballoc>:
+{
+     fd7:	55                   	push   %ebp
+     fd8:	89 e5                	mov    %esp,%ebp
+     fda:	56                   	push   %esi
+     fdb:	53                   	push   %ebx
+     fdc:	89 c6                	mov    %eax,%esi
+  n = 1 << (MINSHIFT + c);
+     fde:	8d 48 04             	lea    0x4(%eax),%ecx
+     fe1:	bb 01 00 00 00       	mov    $0x1,%ebx
+     fe6:	d3 e3                	shl    %cl,%ebx
+  if(slab + n > slabend){
+     fe8:	89 d8                	mov    %ebx,%eax
+     fea:	03 05 48 3c 00 00    	add    0x3c48,%eax
+     ff0:	39 05 44 3c 00 00    	cmp    %eax,0x3c44
+     ff6:	72 17                	jb     100f <slaballoc+0x38>
+  h = (Header*)slab;
+     ff8:	a1 48 3c 00 00       	mov    0x3c48,%eax
+  slab += n;
+     ffd:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+    1000:	89 15 48 3c 00 00    	mov    %edx,0x3c48
+  h->size = n;
+    1006:	89 18                	mov    %ebx,(%eax)
+  h->class = c;
+    1008:	89 70 04             	mov    %esi,0x4(%eax)
+}
+    100b:	5b                   	pop    %ebx
+    100c:	5e                   	pop    %esi
+    100d:	5d                   	pop    %ebp
+    100e:	c3                   	ret
+    if((p = more(SLABSZ)) == 0)
+    100f:	b8 00 40 00 00       	mov    $0x4000,%eax
+    1014:	e8 84 ff ff ff       	call   f9d <more>
+    1019:	85 c0                	test   %eax,%eax
+    101b:	74 ee                	je     100b <slaballoc+0x34>
+    if(p != slabend)
+    101d:	39 05 44 3c 00 00    	cmp    %eax,0x3c44
+    1023:	74 05                	je     102a <slaballoc+0x53>
+      slab = p;
+    1025:	a3 48 3c 00 00       	mov    %eax,0x3c48
+    slabend = p + SLABSZ;
+    102a:	05 00 40 00 00       	add    $0x4000,%eax
+    102f:	a3 44 3c 00 00       	mov    %eax,0x3c44
+    1034:	eb c2                	jmp    ff8 <slaballoc+0x21>
+
+00001036 <largealloc>:
+{
+    1036:	55                   	push   %ebp
+    1037:	89 e5                	mov    %esp,%ebp
+    1039:	56                   	push   %esi
+    103a:	53                   	push   %ebx
+    103b:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+    103d:	b9 4c 3c 00 00       	mov    $0x3c4c,%ecx
+    1042:	8b 01                	mov    (%ecx),%eax
+    1044:	85 c0                	test   %eax,%eax
+    1046:	74 36                	je     107e <largealloc+0x48>
+    if(b->h.size < n)
+    1048:	8b 10                	mov    (%eax),%edx
+    104a:	39 da                	cmp    %ebx,%edx
+    104c:	72 24                	jb     1072 <largealloc+0x3c>
+    if(b->h.size - n > SMALLMAX){
+    104e:	29 da                	sub    %ebx,%edx
+    1050:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+    1056:	76 1f                	jbe    1077 <largealloc+0x41>
+      rest = (Fblock*)((char*)b + n);
+    1058:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+      rest->h.size = b->h.size - n;
+    105b:	89 16                	mov    %edx,(%esi)
+      rest->h.class = LARGE;
+    105d:	c7 46 04 09 00 00 00 	movl   $0x9,0x4(%esi)
+      rest->next = b->next;
+    1064:	8b 50 08             	mov    0x8(%eax),%edx
+    1067:	89 56 08             	mov    %edx,0x8(%esi)
+      *pp = rest;
+    106a:	89 31                	mov    %esi,(%ecx)
+      b->h.size = n;
+    106c:	89 18                	mov    %ebx,(%eax)
+}
+    106e:	5b                   	pop    %ebx
+    106f:	5e                   	pop    %esi
+    1070:	5d                   	pop    %ebp
+    1071:	c3                   	ret
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+    1072:	8d 48 08             	lea    0x8(%eax),%ecx
+    1075:	eb cb                	jmp    1042 <largealloc+0xc>
+      *pp = b->next;
+    1077:	8b 50 08             	mov    0x8(%eax),%edx
+    107a:	89 11                	mov    %edx,(%ecx)
+    return &b->h;
+    107c:	eb f0                	jmp    106e <largealloc+0x38>
+  if((b = more(n)) == 0)
+    107e:	89 d8                	mov    %ebx,%eax
+    1080:	e8 18 ff ff ff       	call   f9d <more>
+    1085:	85 c0                	test   %eax,%eax
+    1087:	74 e5                	je     106e <largealloc+0x38>
+  b->h.size = n;
+    1089:	89 18                	mov    %ebx,(%eax)
+  b->h.class = LARGE;
+    108b:	c7 40 04 09 00 00 00 	movl   $0x9,0x4(%eax)
+  return &b->h;
+    1092:	eb da                	jmp    106e <largealloc+0x38>
+
+00001094 <free>:
+
+void
+free(void *ap)
+{
+    1094:	55                   	push   %ebp
+    1095:	89 e5                	mov    %esp,%ebp
+    1097:	56                   	push   %esi
+    1098:	53                   	push   %ebx
+    1099:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+
+  if(ap == 0)
+    109c:	85 db                	test   %ebx,%ebx
+    109e:	74 3b                	je     10db <free+0x47>
+    return;
+  h = (Header*)ap - 1;
+    10a0:	8d 73 f8             	lea    -0x8(%ebx),%esi
+  lock_acquire(&lock);
+    10a3:	83 ec 0c             	sub    $0xc,%esp
+    10a6:	68 40 3c 00 00       	push   $0x3c40
+    10ab:	e8 9c 01 00 00       	call   124c <lock_acquire>
+  if(h->class == LARGE)
+    10b0:	8b 43 fc             	mov    -0x4(%ebx),%eax
+    10b3:	83 c4 10             	add    $0x10,%esp
+    10b6:	83 f8 09             	cmp    $0x9,%eax
+    10b9:	74 27                	je     10e2 <free+0x4e>
+    largefree((Fblock*)h);
+  else {
+    ((Fblock*)h)->next = freelist[h->class];
+    10bb:	8b 14 85 60 3c 00 00 	mov    0x3c60(,%eax,4),%edx
+    10c2:	89 13                	mov    %edx,(%ebx)
+    freelist[h->class] = (Fblock*)h;
+    10c4:	89 34 85 60 3c 00 00 	mov    %esi,0x3c60(,%eax,4)
+  }
+  lock_release(&lock);
+    10cb:	83 ec 0c             	sub    $0xc,%esp
+    10ce:	68 40 3c 00 00       	push   $0x3c40
+    10d3:	e8 88 01 00 00       	call   1260 <lock_release>
+    10d8:	83 c4 10             	add    $0x10,%esp
+}
+    10db:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    10de:	5b                   	pop    %ebx
+    10df:	5e                   	pop    %esi
+    10e0:	5d                   	pop    %ebp
+    10e1:	c3                   	ret
+    largefree((Fblock*)h);
+    10e2:	89 f0                	mov    %esi,%eax
+    10e4:	e8 0b fe ff ff       	call   ef4 <largefree>
+    10e9:	eb e0                	jmp    10cb <free+0x37>
+
+000010eb <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    10eb:	55                   	push   %ebp
+    10ec:	89 e5                	mov    %esp,%ebp
+    10ee:	53                   	push   %ebx
+    10ef:	83 ec 04             	sub    $0x4,%esp
+    10f2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+  uint n;
+  int c;
+
+  if(nbytes > 0x7fffffff - sizeof(Header) - 7)
+    10f5:	81 fb f0 ff ff 7f    	cmp    $0x7ffffff0,%ebx
+    10fb:	0f 87 8b 00 00 00    	ja     118c <malloc+0xa1>
+    return 0;
+  n = (nbytes + sizeof(Header) + 7) & ~7;
+    1101:	83 c3 0f             	add    $0xf,%ebx
+    1104:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(n < sizeof(Fblock))
+    1107:	83 fb 0b             	cmp    $0xb,%ebx
+    110a:	77 05                	ja     1111 <malloc+0x26>
+    n = sizeof(Fblock);
+    110c:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  lock_acquire(&lock);
+    1111:	83 ec 0c             	sub    $0xc,%esp
+    1114:	68 40 3c 00 00       	push   $0x3c40
+    1119:	e8 2e 01 00 00       	call   124c <lock_acquire>
+  if(n <= SMALLMAX){
+    111e:	83 c4 10             	add    $0x10,%esp
+    1121:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+    1127:	77 58                	ja     1181 <malloc+0x96>
+    for(c = 0; (1 << (MINSHIFT + c)) < n; c++)
+    1129:	ba 00 00 00 00       	mov    $0x0,%edx
+    112e:	eb 03                	jmp    1133 <malloc+0x48>
+    1130:	83 c2 01             	add    $0x1,%edx
+    1133:	8d 4a 04             	lea    0x4(%edx),%ecx
+    1136:	b8 01 00 00 00       	mov    $0x1,%eax
+    113b:	d3 e0                	shl    %cl,%eax
+    113d:	39 d8                	cmp    %ebx,%eax
+    113f:	72 ef                	jb     1130 <malloc+0x45>
+      ;
+    if(freelist[c]){
+    1141:	8b 04 95 60 3c 00 00 	mov    0x3c60(,%edx,4),%eax
+    1148:	85 c0                	test   %eax,%eax
+    114a:	74 2a                	je     1176 <malloc+0x8b>
+      h = &freelist[c]->h;
+    114c:	89 c3                	mov    %eax,%ebx
+      freelist[c] = freelist[c]->next;
+    114e:	8b 40 08             	mov    0x8(%eax),%eax
+    1151:	89 04 95 60 3c 00 00 	mov    %eax,0x3c60(,%edx,4)
+    } else
+      h = slaballoc(c);
+  } else
+    h = largealloc(n);
+  lock_release(&lock);
+    1158:	83 ec 0c             	sub    $0xc,%esp
+    115b:	68 40 3c 00 00       	push   $0x3c40
+    1160:	e8 fb 00 00 00       	call   1260 <lock_release>
+  return h ? (void*)(h + 1) : 0;
+    1165:	83 c4 10             	add    $0x10,%esp
+    1168:	85 db                	test   %ebx,%ebx
+    116a:	74 03                	je     116f <malloc+0x84>
+    116c:	83 c3 08             	add    $0x8,%ebx
+}
+    116f:	89 d8                	mov    %ebx,%eax
+    1171:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1174:	c9                   	leave
+    1175:	c3                   	ret
+      h = slaballoc(c);
+    1176:	89 d0                	mov    %edx,%eax
+    1178:	e8 5a fe ff ff       	call   fd7 <slaballoc>
+    117d:	89 c3                	mov    %eax,%ebx
+    117f:	eb d7                	jmp    1158 <malloc+0x6d>
+    h = largealloc(n);
+    1181:	89 d8                	mov    %ebx,%eax
+    1183:	e8 ae fe ff ff       	call   1036 <largealloc>
+    1188:	89 c3                	mov    %eax,%ebx
+    118a:	eb cc                	jmp    1158 <malloc+0x6d>
+    return 0;
+    118c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1191:	eb dc                	jmp    116f <malloc+0x84>
+
+00001193 <tstart>:
+  void *arg;
+};
+
+static void
+tstart(void *a)
+{
+    1193:	55                   	push   %ebp
+    1194:	89 e5                	mov    %esp,%ebp
+    1196:	83 ec 14             	sub    $0x14,%esp
+    1199:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+    119c:	ff 70 04             	push   0x4(%eax)
+    119f:	ff 10                	call   *(%eax)
+  exit();
+    11a1:	e8 86 f6 ff ff       	call   82c <exit>
+
+000011a6 <thread_create>:
+}
+
+// Run fn(arg) in a new thread.  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    11a6:	55                   	push   %ebp
+    11a7:	89 e5                	mov    %esp,%ebp
+    11a9:	56                   	push   %esi
+    11aa:	53                   	push   %ebx
+  struct tstart *t;
+  char *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    11ab:	83 ec 0c             	sub    $0xc,%esp
+    11ae:	68 00 10 00 00       	push   $0x1000
+    11b3:	e8 33 ff ff ff       	call   10eb <malloc>
+    11b8:	83 c4 10             	add    $0x10,%esp
+    11bb:	85 c0                	test   %eax,%eax
+    11bd:	74 42                	je     1201 <thread_create+0x5b>
+    11bf:	89 c3                	mov    %eax,%ebx
+    return -1;
+  t = (struct tstart*)stack;
+  t->fn = fn;
+    11c1:	8b 45 08             	mov    0x8(%ebp),%eax
+    11c4:	89 03                	mov    %eax,(%ebx)
+  t->arg = arg;
+    11c6:	8b 45 0c             	mov    0xc(%ebp),%eax
+    11c9:	89 43 04             	mov    %eax,0x4(%ebx)
+  if((pid = clone(tstart, stack + TSTACK, t)) < 0)
+    11cc:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    11d2:	83 ec 04             	sub    $0x4,%esp
+    11d5:	53                   	push   %ebx
+    11d6:	50                   	push   %eax
+    11d7:	68 93 11 00 00       	push   $0x1193
+    11dc:	e8 f5 f8 ff ff       	call   ad6 <clone>
+    11e1:	89 c6                	mov    %eax,%esi
+    11e3:	83 c4 10             	add    $0x10,%esp
+    11e6:	85 c0                	test   %eax,%eax
+    11e8:	78 09                	js     11f3 <thread_create+0x4d>
+    free(stack);
+  return pid;
+}
+    11ea:	89 f0                	mov    %esi,%eax
+    11ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    11ef:	5b                   	pop    %ebx
+    11f0:	5e                   	pop    %esi
+    11f1:	5d                   	pop    %ebp
+    11f2:	c3                   	ret
+    free(stack);
+    11f3:	83 ec 0c             	sub    $0xc,%esp
+    11f6:	53                   	push   %ebx
+    11f7:	e8 98 fe ff ff       	call   1094 <free>
+    11fc:	83 c4 10             	add    $0x10,%esp
+    11ff:	eb e9                	jmp    11ea <thread_create+0x44>
+    return -1;
+    1201:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1206:	eb e2                	jmp    11ea <thread_create+0x44>
+
+00001208 <thread_join>:
+
+// Wait for one of this process's threads to exit and free its
+// stack.  Returns its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+    1208:	55                   	push   %ebp
+    1209:	89 e5                	mov    %esp,%ebp
+    120b:	53                   	push   %ebx
+    120c:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    120f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1212:	50                   	push   %eax
+    1213:	e8 cd f8 ff ff       	call   ae5 <join>
+    1218:	89 c3                	mov    %eax,%ebx
+    121a:	83 c4 10             	add    $0x10,%esp
+    121d:	85 c0                	test   %eax,%eax
+    121f:	79 07                	jns    1228 <thread_join+0x20>
+    free((char*)stack - TSTACK);
+  return pid;
+}
+    1221:	89 d8                	mov    %ebx,%eax
+    1223:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1226:	c9                   	leave
+    1227:	c3                   	ret
+    free((char*)stack - TSTACK);
+    1228:	83 ec 0c             	sub    $0xc,%esp
+    122b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    122e:	2d 00 10 00 00       	sub    $0x1000,%eax
+    1233:	50                   	push   %eax
+    1234:	e8 5b fe ff ff       	call   1094 <free>
+    1239:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    123c:	eb e3                	jmp    1221 <thread_join+0x19>
+
+0000123e <lock_init>:
+
+void
+lock_init(lock_t *lk)
+{
+    123e:	55                   	push   %ebp
+    123f:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    1241:	8b 45 08             	mov    0x8(%ebp),%eax
+    1244:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    124a:	5d                   	pop    %ebp
+    124b:	c3                   	ret
+
+0000124c <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+    124c:	55                   	push   %ebp
+    124d:	89 e5                	mov    %esp,%ebp
+    124f:	8b 55 08             	mov    0x8(%ebp),%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    1252:	b8 01 00 00 00       	mov    $0x1,%eax
+    1257:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    125a:	85 c0                	test   %eax,%eax
+    125c:	75 f4                	jne    1252 <lock_acquire+0x6>
+    ;
+}
+    125e:	5d                   	pop    %ebp
+    125f:	c3                   	ret
+
+00001260 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+    1260:	55                   	push   %ebp
+    1261:	89 e5                	mov    %esp,%ebp
+    1263:	8b 55 08             	mov    0x8(%ebp),%edx
+    1266:	b8 00 00 00 00       	mov    $0x0,%eax
+    126b:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    126e:	5d                   	pop    %ebp
+    126f:	c3                   	ret
+
+00001270 <mutex_init>:
+// Are Tricky": state is 0 when free, 1 when held, 2 when held and
+// others may be waiting.  Unlocking an uncontended mutex costs no
+// system call.
+void
+mutex_init(mutex_t *m)
+{
+    1270:	55                   	push   %ebp
+    1271:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    1273:	8b 45 08             	mov    0x8(%ebp),%eax
+    1276:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    127c:	5d                   	pop    %ebp
+    127d:	c3                   	ret
+
+0000127e <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+    127e:	55                   	push   %ebp
+    127f:	89 e5                	mov    %esp,%ebp
+    1281:	53                   	push   %ebx
+    1282:	83 ec 04             	sub    $0x4,%esp
+    1285:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    1288:	b8 00 00 00 00       	mov    $0x0,%eax
+    128d:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1292:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    1296:	85 c0                	test   %eax,%eax
+    1298:	74 29                	je     12c3 <mutex_lock+0x45>
+    return;
+  if(c != 2)
+    129a:	83 f8 02             	cmp    $0x2,%eax
+    129d:	74 20                	je     12bf <mutex_lock+0x41>
+    129f:	b8 02 00 00 00       	mov    $0x2,%eax
+    12a4:	f0 87 03             	lock xchg %eax,(%ebx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    12a7:	eb 16                	jmp    12bf <mutex_lock+0x41>
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    12a9:	83 ec 08             	sub    $0x8,%esp
+    12ac:	6a 02                	push   $0x2
+    12ae:	53                   	push   %ebx
+    12af:	e8 40 f8 ff ff       	call   af4 <futex_wait>
+  asm volatile("lock; xchgl %0, %1" :
+    12b4:	b8 02 00 00 00       	mov    $0x2,%eax
+    12b9:	f0 87 03             	lock xchg %eax,(%ebx)
+    12bc:	83 c4 10             	add    $0x10,%esp
+  while(c != 0){
+    12bf:	85 c0                	test   %eax,%eax
+    12c1:	75 e6                	jne    12a9 <mutex_lock+0x2b>
+    c = xchg(&m->state, 2);
+  }
+}
+    12c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    12c6:	c9                   	leave
+    12c7:	c3                   	ret
+
+000012c8 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+    12c8:	55                   	push   %ebp
+    12c9:	89 e5                	mov    %esp,%ebp
+    12cb:	83 ec 08             	sub    $0x8,%esp
+    12ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    12d1:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    12d6:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    12da:	83 fa 01             	cmp    $0x1,%edx
+    12dd:	75 02                	jne    12e1 <mutex_unlock+0x19>
+    m->state = 0;
+    futex_wake(&m->state, 1);
+  }
+}
+    12df:	c9                   	leave
+    12e0:	c3                   	ret
+    m->state = 0;
+    12e1:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+    12e7:	83 ec 08             	sub    $0x8,%esp
+    12ea:	6a 01                	push   $0x1
+    12ec:	50                   	push   %eax
+    12ed:	e8 11 f8 ff ff       	call   b03 <futex_wake>
+    12f2:	83 c4 10             	add    $0x10,%esp
+}
+    12f5:	eb e8                	jmp    12df <mutex_unlock+0x17>
+
+000012f7 <cond_init>:
+// Condition variable: waiters sleep on a sequence number that
+// every signal bumps, so a signal between the unlock and the
+// futex_wait() in cond_wait() is not lost.
+void
+cond_init(cond_t *c)
+{
+    12f7:	55                   	push   %ebp
+    12f8:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    12fa:	8b 45 08             	mov    0x8(%ebp),%eax
+    12fd:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1303:	5d                   	pop    %ebp
+    1304:	c3                   	ret
+
+00001305 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+    1305:	55                   	push   %ebp
+    1306:	89 e5                	mov    %esp,%ebp
+    1308:	57                   	push   %edi
+    1309:	56                   	push   %esi
+    130a:	53                   	push   %ebx
+    130b:	83 ec 18             	sub    $0x18,%esp
+    130e:	8b 75 08             	mov    0x8(%ebp),%esi
+    1311:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    1314:	8b 3e                	mov    (%esi),%edi
+  mutex_unlock(m);
+    1316:	53                   	push   %ebx
+    1317:	e8 ac ff ff ff       	call   12c8 <mutex_unlock>
+  futex_wait(&c->seq, seq);
+    131c:	83 c4 08             	add    $0x8,%esp
+    131f:	57                   	push   %edi
+    1320:	56                   	push   %esi
+    1321:	e8 ce f7 ff ff       	call   af4 <futex_wait>
+  // Others may be waiting for m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+    1326:	83 c4 10             	add    $0x10,%esp
+    1329:	eb 0e                	jmp    1339 <cond_wait+0x34>
+    futex_wait(&m->state, 2);
+    132b:	83 ec 08             	sub    $0x8,%esp
+    132e:	6a 02                	push   $0x2
+    1330:	53                   	push   %ebx
+    1331:	e8 be f7 ff ff       	call   af4 <futex_wait>
+    1336:	83 c4 10             	add    $0x10,%esp
+    1339:	b8 02 00 00 00       	mov    $0x2,%eax
+    133e:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    1341:	85 c0                	test   %eax,%eax
+    1343:	75 e6                	jne    132b <cond_wait+0x26>
+}
+    1345:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1348:	5b                   	pop    %ebx
+    1349:	5e                   	pop    %esi
+    134a:	5f                   	pop    %edi
+    134b:	5d                   	pop    %ebp
+    134c:	c3                   	ret
+
+0000134d <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+    134d:	55                   	push   %ebp
+    134e:	89 e5                	mov    %esp,%ebp
+    1350:	83 ec 10             	sub    $0x10,%esp
+    1353:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    1356:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+    135a:	6a 01                	push   $0x1
+    135c:	50                   	push   %eax
+    135d:	e8 a1 f7 ff ff       	call   b03 <futex_wake>
+}
+    1362:	83 c4 10             	add    $0x10,%esp
+    1365:	c9                   	leave
+    1366:	c3                   	ret
+
+00001367 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+    1367:	55                   	push   %ebp
+    1368:	89 e5                	mov    %esp,%ebp
+    136a:	83 ec 10             	sub    $0x10,%esp
+    136d:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    1370:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, NPROC);
+    1374:	6a 40                	push   $0x40
+    1376:	50                   	push   %eax
+    1377:	e8 87 f7 ff ff       	call   b03 <futex_wake>
+}
+    137c:	83 c4 10             	add    $0x10,%esp
+    137f:	c9                   	leave
+    1380:	c3                   	ret
@@ -0,0 +1,54 @@
+// ps: list processes with their size, resident memory, CPU time,
+// context switches and run-queue wait.  "ps -l" adds the latency
+// histograms of each process and the per-CPU totals.  SZ is in
+// bytes and RSS in KB; times are in millions of TSC cycles.
+#include "types.h"
+#include "param.h"
+#include "user.h"
+#include "procinfo.h"
+
+static char *states[] = {
+  "unused", "embryo", "sleep", "runble", "run", "zombie"
+};
+
+static void
+printlat(uint *lat)
+{
+  int k;
+
+  for(k = 0; k < NLAT; k++)
+    printf(1, " %d", lat[k]);
+  printf(1, "\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct procinfo pi;
+  struct cpuinfo ci;
+  int i, lflag;
+
+  lflag = argc > 1 && strcmp(argv[1], "-l") == 0;
+  printf(1, "PID\tPPID\tSTATE\tPRIO\tSZ\tRSS\tCPU\tVCSW\tICSW\tWAIT\tNAME\n");
+  for(i = 0; getprocinfo(i, &pi) == 0; i++){
+    printf(1, "%d\t%d\t%s\t%d\t%d\t%d\t%d\t%d\t%d\t%d\t%s\n",
+           pi.pid, pi.ppid, states[pi.state], pi.prio, pi.sz, pi.rss*4,
+           (uint)(pi.cputime >> 20), pi.nvcsw, pi.nivcsw,
+           (uint)(pi.waittime >> 20), pi.name);
+    if(lflag){
+      printf(1, "\tlat");
+      printlat(pi.lat);
+    }
+  }
+  if(!lflag)
+    exit();
+
+  // Bucket k counts waits below 2^(10+2k) cycles.
+  printf(1, "CPU\tBUSY\tIDLE\tSWITCH\tLAT\n");
+  for(i = 0; getcpuinfo(i, &ci) == 0; i++){
+    printf(1, "%d\t%d\t%d\t%d\t", i, (uint)(ci.busytime >> 20),
+           (uint)(ci.idletime >> 20), ci.nswitch);
+    printlat(ci.lat);
+  }
+  exit();
+}
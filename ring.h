@@ -0,0 +1,39 @@
+// Submission and completion rings, shared between a process and
+// the kernel through its own memory, for ringenter().  The process
+// fills sq[sqtail % NRING] and advances sqtail; ringenter() does the
+// requests from sqhead on, in order, and puts each one's result in
+// cq[cqtail % NRING], with the request's data, advancing sqhead and
+// cqtail.  The process takes completions from cqhead on.
+
+#define NRING 32
+
+// Requests
+#define RING_NOP    0
+#define RING_READ   1          // read(fd, addr, len), or pread() at off >= 0
+#define RING_WRITE  2          // write(fd, addr, len), or pwrite() at off >= 0
+#define RING_OPEN   3          // open(addr, len)
+#define RING_CLOSE  4          // close(fd)
+#define RING_FSYNC  5          // fsync(fd)
+
+struct sqe {
+  int op;
+  int fd;
+  uint addr;
+  uint len;
+  int off;
+  uint data;                   // Copied to the completion
+};
+
+struct cqe {
+  uint data;
+  int res;                     // What the system call would return
+};
+
+struct ring {
+  uint sqhead;                 // Advanced by the kernel
+  uint sqtail;                 // Advanced by the process
+  uint cqhead;                 // Advanced by the process
+  uint cqtail;                 // Advanced by the kernel
+  struct sqe sq[NRING];
+  struct cqe cq[NRING];
+};
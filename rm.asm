@@ -0,0 +1,2762 @@
+
+_rm:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 18             	sub    $0x18,%esp
+      14:	8b 39                	mov    (%ecx),%edi
+      16:	8b 41 04             	mov    0x4(%ecx),%eax
+      19:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  int i;
+
+  if(argc < 2){
+      1c:	83 ff 01             	cmp    $0x1,%edi
+      1f:	7e 07                	jle    28 <main+0x28>
+    printf(2, "Usage: rm files...\n");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+      21:	bb 01 00 00 00       	mov    $0x1,%ebx
+      26:	eb 17                	jmp    3f <main+0x3f>
+    printf(2, "Usage: rm files...\n");
+      28:	83 ec 08             	sub    $0x8,%esp
+      2b:	68 00 12 00 00       	push   $0x1200
+      30:	6a 02                	push   $0x2
+      32:	e8 ad 0b 00 00       	call   be4 <printf>
+    exit();
+      37:	e8 6f 06 00 00       	call   6ab <exit>
+  for(i = 1; i < argc; i++){
+      3c:	83 c3 01             	add    $0x1,%ebx
+      3f:	39 fb                	cmp    %edi,%ebx
+      41:	7d 2b                	jge    6e <main+0x6e>
+    if(unlink(argv[i]) < 0){
+      43:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+      46:	8d 34 98             	lea    (%eax,%ebx,4),%esi
+      49:	83 ec 0c             	sub    $0xc,%esp
+      4c:	ff 36                	push   (%esi)
+      4e:	e8 c7 07 00 00       	call   81a <unlink>
+      53:	83 c4 10             	add    $0x10,%esp
+      56:	85 c0                	test   %eax,%eax
+      58:	79 e2                	jns    3c <main+0x3c>
+      printf(2, "rm: %s failed to delete\n", argv[i]);
+      5a:	83 ec 04             	sub    $0x4,%esp
+      5d:	ff 36                	push   (%esi)
+      5f:	68 14 12 00 00       	push   $0x1214
+      64:	6a 02                	push   $0x2
+      66:	e8 79 0b 00 00       	call   be4 <printf>
+      break;
+      6b:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+
+  exit();
+      6e:	e8 38 06 00 00       	call   6ab <exit>
+
+00000073 <strcpy>:
+#include "memlayout.h"
+#include "clock.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+      73:	55                   	push   %ebp
+      74:	89 e5                	mov    %esp,%ebp
+      76:	56                   	push   %esi
+      77:	53                   	push   %ebx
+      78:	8b 75 08             	mov    0x8(%ebp),%esi
+      7b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+      7e:	89 f0                	mov    %esi,%eax
+      80:	89 d1                	mov    %edx,%ecx
+      82:	83 c2 01             	add    $0x1,%edx
+      85:	89 c3                	mov    %eax,%ebx
+      87:	83 c0 01             	add    $0x1,%eax
+      8a:	0f b6 09             	movzbl (%ecx),%ecx
+      8d:	88 0b                	mov    %cl,(%ebx)
+      8f:	84 c9                	test   %cl,%cl
+      91:	75 ed                	jne    80 <strcpy+0xd>
+    ;
+  return os;
+}
+      93:	89 f0                	mov    %esi,%eax
+      95:	5b                   	pop    %ebx
+      96:	5e                   	pop    %esi
+      97:	5d                   	pop    %ebp
+      98:	c3                   	ret
+
+00000099 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+      99:	55                   	push   %ebp
+      9a:	89 e5                	mov    %esp,%ebp
+      9c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      9f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+      a2:	eb 06                	jmp    aa <strcmp+0x11>
+    p++, q++;
+      a4:	83 c1 01             	add    $0x1,%ecx
+      a7:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+      aa:	0f b6 01             	movzbl (%ecx),%eax
+      ad:	84 c0                	test   %al,%al
+      af:	74 04                	je     b5 <strcmp+0x1c>
+      b1:	3a 02                	cmp    (%edx),%al
+      b3:	74 ef                	je     a4 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+      b5:	0f b6 c0             	movzbl %al,%eax
+      b8:	0f b6 12             	movzbl (%edx),%edx
+      bb:	29 d0                	sub    %edx,%eax
+}
+      bd:	5d                   	pop    %ebp
+      be:	c3                   	ret
+
+000000bf <strlen>:
+
+uint
+strlen(const char *s)
+{
+      bf:	55                   	push   %ebp
+      c0:	89 e5                	mov    %esp,%ebp
+      c2:	53                   	push   %ebx
+      c3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  const char *p;
+  uint w;
+
+  for(p = s; (uint)p & 3; p++)
+      c6:	89 c8                	mov    %ecx,%eax
+      c8:	eb 03                	jmp    cd <strlen+0xe>
+      ca:	83 c0 01             	add    $0x1,%eax
+      cd:	a8 03                	test   $0x3,%al
+      cf:	74 09                	je     da <strlen+0x1b>
+    if(*p == 0)
+      d1:	80 38 00             	cmpb   $0x0,(%eax)
+      d4:	75 f4                	jne    ca <strlen+0xb>
+      return p - s;
+      d6:	29 c8                	sub    %ecx,%eax
+      d8:	eb 25                	jmp    ff <strlen+0x40>
+  // Then a word at a time, which never crosses into the next page:
+  // a word with a zero byte in it has one of these bits set.
+  for(;; p += 4){
+    w = *(uint*)p;
+      da:	8b 10                	mov    (%eax),%edx
+    if((w - 0x01010101) & ~w & 0x80808080)
+      dc:	8d 9a ff fe fe fe    	lea    -0x1010101(%edx),%ebx
+      e2:	f7 d2                	not    %edx
+      e4:	21 da                	and    %ebx,%edx
+      e6:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+      ec:	75 05                	jne    f3 <strlen+0x34>
+  for(;; p += 4){
+      ee:	83 c0 04             	add    $0x4,%eax
+    w = *(uint*)p;
+      f1:	eb e7                	jmp    da <strlen+0x1b>
+      break;
+  }
+  while(*p)
+      f3:	80 38 00             	cmpb   $0x0,(%eax)
+      f6:	74 05                	je     fd <strlen+0x3e>
+    p++;
+      f8:	83 c0 01             	add    $0x1,%eax
+      fb:	eb f6                	jmp    f3 <strlen+0x34>
+  return p - s;
+      fd:	29 c8                	sub    %ecx,%eax
+}
+      ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     102:	c9                   	leave
+     103:	c3                   	ret
+
+00000104 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     104:	55                   	push   %ebp
+     105:	89 e5                	mov    %esp,%ebp
+     107:	57                   	push   %edi
+     108:	56                   	push   %esi
+     109:	53                   	push   %ebx
+     10a:	8b 55 10             	mov    0x10(%ebp),%edx
+  uint h;
+  char *d;
+
+  d = dst;
+  c &= 0xFF;
+     10d:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  if(n >= 16){
+     111:	83 fa 0f             	cmp    $0xf,%edx
+     114:	76 52                	jbe    168 <memset+0x64>
+    h = -(uint)d & 3;
+     116:	8b 45 08             	mov    0x8(%ebp),%eax
+     119:	f7 d8                	neg    %eax
+     11b:	83 e0 03             	and    $0x3,%eax
+     11e:	89 c6                	mov    %eax,%esi
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     120:	8b 7d 08             	mov    0x8(%ebp),%edi
+     123:	89 c1                	mov    %eax,%ecx
+     125:	89 d8                	mov    %ebx,%eax
+     127:	fc                   	cld
+     128:	f3 aa                	rep stos %al,%es:(%edi)
+    stosb(d, c, h);
+    stosl(d + h, (c<<24)|(c<<16)|(c<<8)|c, (n - h)/4);
+     12a:	29 f2                	sub    %esi,%edx
+     12c:	89 d1                	mov    %edx,%ecx
+     12e:	c1 e9 02             	shr    $0x2,%ecx
+     131:	c1 e0 18             	shl    $0x18,%eax
+     134:	89 df                	mov    %ebx,%edi
+     136:	c1 e7 10             	shl    $0x10,%edi
+     139:	09 f8                	or     %edi,%eax
+     13b:	89 df                	mov    %ebx,%edi
+     13d:	c1 e7 08             	shl    $0x8,%edi
+     140:	09 f8                	or     %edi,%eax
+     142:	09 d8                	or     %ebx,%eax
+     144:	89 f7                	mov    %esi,%edi
+     146:	03 7d 08             	add    0x8(%ebp),%edi
+}
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosl" :
+     149:	fc                   	cld
+     14a:	f3 ab                	rep stos %eax,%es:(%edi)
+    d += h + (n - h)/4*4;
+     14c:	89 d7                	mov    %edx,%edi
+     14e:	83 e7 fc             	and    $0xfffffffc,%edi
+     151:	09 f7                	or     %esi,%edi
+     153:	03 7d 08             	add    0x8(%ebp),%edi
+    n = (n - h)%4;
+     156:	83 e2 03             	and    $0x3,%edx
+  asm volatile("cld; rep stosb" :
+     159:	89 d1                	mov    %edx,%ecx
+     15b:	89 d8                	mov    %ebx,%eax
+     15d:	fc                   	cld
+     15e:	f3 aa                	rep stos %al,%es:(%edi)
+  }
+  stosb(d, c, n);
+  return dst;
+}
+     160:	8b 45 08             	mov    0x8(%ebp),%eax
+     163:	5b                   	pop    %ebx
+     164:	5e                   	pop    %esi
+     165:	5f                   	pop    %edi
+     166:	5d                   	pop    %ebp
+     167:	c3                   	ret
+  d = dst;
+     168:	8b 7d 08             	mov    0x8(%ebp),%edi
+     16b:	eb ec                	jmp    159 <memset+0x55>
+
+0000016d <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     16d:	55                   	push   %ebp
+     16e:	89 e5                	mov    %esp,%ebp
+     170:	8b 45 08             	mov    0x8(%ebp),%eax
+     173:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     177:	eb 03                	jmp    17c <strchr+0xf>
+     179:	83 c0 01             	add    $0x1,%eax
+     17c:	0f b6 10             	movzbl (%eax),%edx
+     17f:	84 d2                	test   %dl,%dl
+     181:	74 06                	je     189 <strchr+0x1c>
+    if(*s == c)
+     183:	38 ca                	cmp    %cl,%dl
+     185:	75 f2                	jne    179 <strchr+0xc>
+     187:	eb 05                	jmp    18e <strchr+0x21>
+      return (char*)s;
+  return 0;
+     189:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     18e:	5d                   	pop    %ebp
+     18f:	c3                   	ret
+
+00000190 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     190:	55                   	push   %ebp
+     191:	89 e5                	mov    %esp,%ebp
+     193:	56                   	push   %esi
+     194:	53                   	push   %ebx
+     195:	8b 55 08             	mov    0x8(%ebp),%edx
+     198:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     19b:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  // A word at a time while they agree.
+  if((((uint)s1 | (uint)s2) & 3) == 0)
+     19e:	89 d3                	mov    %edx,%ebx
+     1a0:	09 cb                	or     %ecx,%ebx
+     1a2:	f6 c3 03             	test   $0x3,%bl
+     1a5:	74 24                	je     1cb <memcmp+0x3b>
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+      s1 += 4, s2 += 4;
+  while(n-- > 0){
+     1a7:	8d 70 ff             	lea    -0x1(%eax),%esi
+     1aa:	85 c0                	test   %eax,%eax
+     1ac:	74 32                	je     1e0 <memcmp+0x50>
+    if(*s1 != *s2)
+     1ae:	0f b6 02             	movzbl (%edx),%eax
+     1b1:	0f b6 19             	movzbl (%ecx),%ebx
+     1b4:	38 d8                	cmp    %bl,%al
+     1b6:	75 20                	jne    1d8 <memcmp+0x48>
+      return *s1 - *s2;
+    s1++, s2++;
+     1b8:	83 c2 01             	add    $0x1,%edx
+     1bb:	83 c1 01             	add    $0x1,%ecx
+  while(n-- > 0){
+     1be:	89 f0                	mov    %esi,%eax
+     1c0:	eb e5                	jmp    1a7 <memcmp+0x17>
+      s1 += 4, s2 += 4;
+     1c2:	83 c2 04             	add    $0x4,%edx
+     1c5:	83 c1 04             	add    $0x4,%ecx
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+     1c8:	83 e8 04             	sub    $0x4,%eax
+     1cb:	83 f8 03             	cmp    $0x3,%eax
+     1ce:	76 d7                	jbe    1a7 <memcmp+0x17>
+     1d0:	8b 31                	mov    (%ecx),%esi
+     1d2:	39 32                	cmp    %esi,(%edx)
+     1d4:	74 ec                	je     1c2 <memcmp+0x32>
+     1d6:	eb cf                	jmp    1a7 <memcmp+0x17>
+      return *s1 - *s2;
+     1d8:	0f b6 c0             	movzbl %al,%eax
+     1db:	0f b6 db             	movzbl %bl,%ebx
+     1de:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     1e0:	5b                   	pop    %ebx
+     1e1:	5e                   	pop    %esi
+     1e2:	5d                   	pop    %ebp
+     1e3:	c3                   	ret
+
+000001e4 <memchr>:
+// The first c in the n bytes at v, or 0.  Once aligned, a word at
+// a time, with the word's bytes that equal c turned into zeroes
+// and those looked for.
+void*
+memchr(const void *v, int c, uint n)
+{
+     1e4:	55                   	push   %ebp
+     1e5:	89 e5                	mov    %esp,%ebp
+     1e7:	57                   	push   %edi
+     1e8:	56                   	push   %esi
+     1e9:	53                   	push   %ebx
+     1ea:	8b 45 08             	mov    0x8(%ebp),%eax
+     1ed:	8b 55 10             	mov    0x10(%ebp),%edx
+  const uchar *s;
+  uint w, rep;
+
+  s = v;
+  c = (uchar)c;
+     1f0:	0f b6 75 0c          	movzbl 0xc(%ebp),%esi
+  for(; n > 0 && ((uint)s & 3); n--, s++)
+     1f4:	eb 06                	jmp    1fc <memchr+0x18>
+     1f6:	83 ea 01             	sub    $0x1,%edx
+     1f9:	83 c0 01             	add    $0x1,%eax
+     1fc:	85 d2                	test   %edx,%edx
+     1fe:	74 0d                	je     20d <memchr+0x29>
+     200:	a8 03                	test   $0x3,%al
+     202:	74 09                	je     20d <memchr+0x29>
+    if(*s == c)
+     204:	0f b6 08             	movzbl (%eax),%ecx
+     207:	39 f1                	cmp    %esi,%ecx
+     209:	75 eb                	jne    1f6 <memchr+0x12>
+     20b:	eb 41                	jmp    24e <memchr+0x6a>
+      return (void*)s;
+  rep = c * 0x01010101;
+     20d:	69 fe 01 01 01 01    	imul   $0x1010101,%esi,%edi
+  for(; n >= 4; n -= 4, s += 4){
+     213:	eb 06                	jmp    21b <memchr+0x37>
+     215:	83 ea 04             	sub    $0x4,%edx
+     218:	83 c0 04             	add    $0x4,%eax
+     21b:	83 fa 03             	cmp    $0x3,%edx
+     21e:	76 16                	jbe    236 <memchr+0x52>
+    w = *(uint*)s ^ rep;
+     220:	89 f9                	mov    %edi,%ecx
+     222:	33 08                	xor    (%eax),%ecx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     224:	8d 99 ff fe fe fe    	lea    -0x1010101(%ecx),%ebx
+     22a:	f7 d1                	not    %ecx
+     22c:	21 cb                	and    %ecx,%ebx
+     22e:	f7 c3 80 80 80 80    	test   $0x80808080,%ebx
+     234:	74 df                	je     215 <memchr+0x31>
+      break;
+  }
+  for(; n > 0; n--, s++)
+     236:	85 d2                	test   %edx,%edx
+     238:	74 0f                	je     249 <memchr+0x65>
+    if(*s == c)
+     23a:	0f b6 08             	movzbl (%eax),%ecx
+     23d:	39 f1                	cmp    %esi,%ecx
+     23f:	74 0d                	je     24e <memchr+0x6a>
+  for(; n > 0; n--, s++)
+     241:	83 ea 01             	sub    $0x1,%edx
+     244:	83 c0 01             	add    $0x1,%eax
+     247:	eb ed                	jmp    236 <memchr+0x52>
+      return (void*)s;
+  return 0;
+     249:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     24e:	5b                   	pop    %ebx
+     24f:	5e                   	pop    %esi
+     250:	5f                   	pop    %edi
+     251:	5d                   	pop    %ebp
+     252:	c3                   	ret
+
+00000253 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     253:	55                   	push   %ebp
+     254:	89 e5                	mov    %esp,%ebp
+     256:	57                   	push   %edi
+     257:	56                   	push   %esi
+     258:	53                   	push   %ebx
+     259:	83 ec 1c             	sub    $0x1c,%esp
+     25c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     25f:	bb 00 00 00 00       	mov    $0x0,%ebx
+     264:	89 de                	mov    %ebx,%esi
+     266:	83 c3 01             	add    $0x1,%ebx
+     269:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     26c:	7d 2e                	jge    29c <gets+0x49>
+    cc = read(0, &c, 1);
+     26e:	83 ec 04             	sub    $0x4,%esp
+     271:	6a 01                	push   $0x1
+     273:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     276:	50                   	push   %eax
+     277:	6a 00                	push   $0x0
+     279:	e8 51 05 00 00       	call   7cf <read>
+    if(cc < 1)
+     27e:	83 c4 10             	add    $0x10,%esp
+     281:	85 c0                	test   %eax,%eax
+     283:	7e 17                	jle    29c <gets+0x49>
+      break;
+    buf[i++] = c;
+     285:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     289:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+     28c:	3c 0a                	cmp    $0xa,%al
+     28e:	0f 94 c2             	sete   %dl
+     291:	3c 0d                	cmp    $0xd,%al
+     293:	0f 94 c0             	sete   %al
+     296:	08 c2                	or     %al,%dl
+     298:	74 ca                	je     264 <gets+0x11>
+    buf[i++] = c;
+     29a:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+     29c:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+     2a0:	89 f8                	mov    %edi,%eax
+     2a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     2a5:	5b                   	pop    %ebx
+     2a6:	5e                   	pop    %esi
+     2a7:	5f                   	pop    %edi
+     2a8:	5d                   	pop    %ebp
+     2a9:	c3                   	ret
+
+000002aa <atoi>:
+  return r;
+}
+
+int
+atoi(const char *s)
+{
+     2aa:	55                   	push   %ebp
+     2ab:	89 e5                	mov    %esp,%ebp
+     2ad:	53                   	push   %ebx
+     2ae:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+     2b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+     2b6:	eb 10                	jmp    2c8 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+     2b8:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+     2bb:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+     2be:	83 c1 01             	add    $0x1,%ecx
+     2c1:	0f be c0             	movsbl %al,%eax
+     2c4:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+     2c8:	0f b6 01             	movzbl (%ecx),%eax
+     2cb:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     2ce:	80 fb 09             	cmp    $0x9,%bl
+     2d1:	76 e5                	jbe    2b8 <atoi+0xe>
+  return n;
+}
+     2d3:	89 d0                	mov    %edx,%eax
+     2d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2d8:	c9                   	leave
+     2d9:	c3                   	ret
+
+000002da <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     2da:	55                   	push   %ebp
+     2db:	89 e5                	mov    %esp,%ebp
+     2dd:	57                   	push   %edi
+     2de:	56                   	push   %esi
+     2df:	53                   	push   %ebx
+     2e0:	83 ec 08             	sub    $0x8,%esp
+     2e3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     2e6:	8b 55 0c             	mov    0xc(%ebp),%edx
+     2e9:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *src;
+  int h;
+
+  dst = vdst;
+  src = vsrc;
+  if(n <= 0)
+     2ec:	85 c0                	test   %eax,%eax
+     2ee:	0f 8e 82 00 00 00    	jle    376 <memmove+0x9c>
+    return vdst;
+  if(src < dst && src + n > dst){
+     2f4:	39 da                	cmp    %ebx,%edx
+     2f6:	73 07                	jae    2ff <memmove+0x25>
+     2f8:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+     2fb:	39 cb                	cmp    %ecx,%ebx
+     2fd:	72 5e                	jb     35d <memmove+0x83>
+    movsbback(dst + n - 1, src + n - 1, n);
+    return vdst;
+  }
+  if(n >= 16 && (((uint)dst ^ (uint)src) & 3) == 0){
+     2ff:	83 f8 0f             	cmp    $0xf,%eax
+     302:	7e 69                	jle    36d <memmove+0x93>
+     304:	89 d9                	mov    %ebx,%ecx
+     306:	31 d1                	xor    %edx,%ecx
+     308:	f6 c1 03             	test   $0x3,%cl
+     30b:	75 73                	jne    380 <memmove+0xa6>
+    h = -(uint)dst & 3;
+     30d:	89 d9                	mov    %ebx,%ecx
+     30f:	f7 d9                	neg    %ecx
+     311:	83 e1 03             	and    $0x3,%ecx
+}
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsb" :
+     314:	89 df                	mov    %ebx,%edi
+     316:	89 d6                	mov    %edx,%esi
+     318:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+     31b:	fc                   	cld
+     31c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    movsb(dst, src, h);
+    dst += h, src += h, n -= h;
+     31e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+     321:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+     324:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+     327:	29 f0                	sub    %esi,%eax
+    movsl(dst, src, n/4);
+     329:	8d 50 03             	lea    0x3(%eax),%edx
+     32c:	0f 49 d0             	cmovns %eax,%edx
+     32f:	c1 fa 02             	sar    $0x2,%edx
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+     332:	89 7d f0             	mov    %edi,-0x10(%ebp)
+     335:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     338:	89 ce                	mov    %ecx,%esi
+     33a:	89 d1                	mov    %edx,%ecx
+     33c:	fc                   	cld
+     33d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    dst += n/4*4, src += n/4*4, n %= 4;
+     33f:	c1 e2 02             	shl    $0x2,%edx
+     342:	8b 7d f0             	mov    -0x10(%ebp),%edi
+     345:	01 d7                	add    %edx,%edi
+     347:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     34a:	01 ca                	add    %ecx,%edx
+     34c:	89 c6                	mov    %eax,%esi
+     34e:	c1 fe 1f             	sar    $0x1f,%esi
+     351:	c1 ee 1e             	shr    $0x1e,%esi
+     354:	01 f0                	add    %esi,%eax
+     356:	83 e0 03             	and    $0x3,%eax
+     359:	29 f0                	sub    %esi,%eax
+     35b:	eb 12                	jmp    36f <memmove+0x95>
+    movsbback(dst + n - 1, src + n - 1, n);
+     35d:	8d 78 ff             	lea    -0x1(%eax),%edi
+     360:	8d 34 3a             	lea    (%edx,%edi,1),%esi
+     363:	01 df                	add    %ebx,%edi
+// Copy cnt bytes down from the last ones, at dst and src, to the
+// first: for overlapping moves up.
+static inline void
+movsbback(void *dst, const void *src, int cnt)
+{
+  asm volatile("std; rep movsb; cld" :
+     365:	89 c1                	mov    %eax,%ecx
+     367:	fd                   	std
+     368:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     36a:	fc                   	cld
+    return vdst;
+     36b:	eb 09                	jmp    376 <memmove+0x9c>
+  dst = vdst;
+     36d:	89 df                	mov    %ebx,%edi
+  asm volatile("cld; rep movsb" :
+     36f:	89 d6                	mov    %edx,%esi
+     371:	89 c1                	mov    %eax,%ecx
+     373:	fc                   	cld
+     374:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  }
+  movsb(dst, src, n);
+  return vdst;
+}
+     376:	89 d8                	mov    %ebx,%eax
+     378:	83 c4 08             	add    $0x8,%esp
+     37b:	5b                   	pop    %ebx
+     37c:	5e                   	pop    %esi
+     37d:	5f                   	pop    %edi
+     37e:	5d                   	pop    %ebp
+     37f:	c3                   	ret
+  dst = vdst;
+     380:	89 df                	mov    %ebx,%edi
+     382:	eb eb                	jmp    36f <memmove+0x95>
+
+00000384 <vclock_gettime>:
+
+// clock_gettime() without a system call: read the clock page
+// that the kernel maps at CLOCKPAGE (see clock.h).
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+     384:	55                   	push   %ebp
+     385:	89 e5                	mov    %esp,%ebp
+     387:	57                   	push   %edi
+     388:	56                   	push   %esi
+     389:	53                   	push   %ebx
+     38a:	83 ec 14             	sub    $0x14,%esp
+  struct clockpage *cp = (struct clockpage*)CLOCKPAGE;
+  uint seq, rem, d;
+  uint64 tsc, ns, now;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+     38d:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     391:	0f 87 a3 00 00 00    	ja     43a <vclock_gettime+0xb6>
+    return -1;
+  do {
+    seq = cp->seq;
+     397:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+    __sync_synchronize();
+     39c:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    tsc = cp->tsc;
+     3a1:	8b 15 10 f0 ff 7f    	mov    0x7ffff010,%edx
+     3a7:	8b 1d 14 f0 ff 7f    	mov    0x7ffff014,%ebx
+    ns = cp->ns;
+     3ad:	8b 35 18 f0 ff 7f    	mov    0x7ffff018,%esi
+     3b3:	8b 3d 1c f0 ff 7f    	mov    0x7ffff01c,%edi
+    __sync_synchronize();
+     3b9:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != cp->seq);
+     3be:	89 c1                	mov    %eax,%ecx
+     3c0:	83 e1 01             	and    $0x1,%ecx
+     3c3:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     3c6:	75 cf                	jne    397 <vclock_gettime+0x13>
+     3c8:	8b 0d 00 f0 ff 7f    	mov    0x7ffff000,%ecx
+     3ce:	39 c1                	cmp    %eax,%ecx
+     3d0:	75 c5                	jne    397 <vclock_gettime+0x13>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+     3d2:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     3d5:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     3d8:	0f 31                	rdtsc
+     3da:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     3dd:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     3e0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  now = rdtsc();
+  // Less than a tick has passed since the update, so the delta
+  // fits in 32 bits.
+  d = now > tsc ? now - tsc : 0;
+     3e3:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     3e6:	19 d3                	sbb    %edx,%ebx
+     3e8:	73 07                	jae    3f1 <vclock_gettime+0x6d>
+     3ea:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+     3ed:	29 d8                	sub    %ebx,%eax
+     3ef:	89 c1                	mov    %eax,%ecx
+  ns += ((uint64)d * cp->mult) >> cp->shift;
+     3f1:	89 c8                	mov    %ecx,%eax
+     3f3:	f7 25 04 f0 ff 7f    	mull   0x7ffff004
+     3f9:	0f b6 0d 08 f0 ff 7f 	movzbl 0x7ffff008,%ecx
+     400:	0f ad d0             	shrd   %cl,%edx,%eax
+     403:	d3 ea                	shr    %cl,%edx
+     405:	f6 c1 20             	test   $0x20,%cl
+     408:	74 04                	je     40e <vclock_gettime+0x8a>
+     40a:	89 d0                	mov    %edx,%eax
+     40c:	31 d2                	xor    %edx,%edx
+     40e:	01 f0                	add    %esi,%eax
+     410:	11 fa                	adc    %edi,%edx
+static inline uint
+divl(uint64 n, uint d, uint *r)
+{
+  uint q;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (*r) :
+     412:	bb 00 ca 9a 3b       	mov    $0x3b9aca00,%ebx
+     417:	f7 f3                	div    %ebx
+  ts->tv_sec = divl(ns, 1000000000, &rem);
+     419:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     41c:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = rem;
+     41e:	89 57 04             	mov    %edx,0x4(%edi)
+  if(clk == CLOCK_REALTIME)
+     421:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     425:	75 1a                	jne    441 <vclock_gettime+0xbd>
+    ts->tv_sec += cp->boottime;
+     427:	03 05 0c f0 ff 7f    	add    0x7ffff00c,%eax
+     42d:	89 07                	mov    %eax,(%edi)
+  return 0;
+     42f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     432:	83 c4 14             	add    $0x14,%esp
+     435:	5b                   	pop    %ebx
+     436:	5e                   	pop    %esi
+     437:	5f                   	pop    %edi
+     438:	5d                   	pop    %ebp
+     439:	c3                   	ret
+    return -1;
+     43a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     43f:	eb f1                	jmp    432 <vclock_gettime+0xae>
+  return 0;
+     441:	b8 00 00 00 00       	mov    $0x0,%eax
+     446:	eb ea                	jmp    432 <vclock_gettime+0xae>
+
+00000448 <flush>:
+
+// Write out fd's buffer, or with fd < 0 every buffer.
+// Returns -1 if a write fails.
+int
+flush(int fd)
+{
+     448:	55                   	push   %ebp
+     449:	89 e5                	mov    %esp,%ebp
+     44b:	56                   	push   %esi
+     44c:	53                   	push   %ebx
+     44d:	8b 45 08             	mov    0x8(%ebp),%eax
+  int r, n;
+
+  if(fd < 0){
+     450:	85 c0                	test   %eax,%eax
+     452:	78 5d                	js     4b1 <flush+0x69>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+      if(flush(fd) < 0)
+        r = -1;
+    return r;
+  }
+  if(fd >= NOBUF || (n = obuf[fd].n) == 0)
+     454:	83 f8 0f             	cmp    $0xf,%eax
+     457:	7f 64                	jg     4bd <flush+0x75>
+     459:	69 d0 08 02 00 00    	imul   $0x208,%eax,%edx
+     45f:	8b b2 64 19 00 00    	mov    0x1964(%edx),%esi
+     465:	85 f6                	test   %esi,%esi
+     467:	74 59                	je     4c2 <flush+0x7a>
+    return 0;
+  obuf[fd].n = 0;
+     469:	c7 82 64 19 00 00 00 	movl   $0x0,0x1964(%edx)
+     470:	00 00 00 
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     473:	81 c2 68 19 00 00    	add    $0x1968,%edx
+     479:	83 ec 04             	sub    $0x4,%esp
+     47c:	56                   	push   %esi
+     47d:	52                   	push   %edx
+     47e:	50                   	push   %eax
+     47f:	e8 5a 03 00 00       	call   7de <write>
+     484:	83 c4 10             	add    $0x10,%esp
+     487:	39 f0                	cmp    %esi,%eax
+     489:	75 40                	jne    4cb <flush+0x83>
+     48b:	be 00 00 00 00       	mov    $0x0,%esi
+     490:	eb 30                	jmp    4c2 <flush+0x7a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     492:	83 c3 01             	add    $0x1,%ebx
+     495:	83 fb 0f             	cmp    $0xf,%ebx
+     498:	7f 28                	jg     4c2 <flush+0x7a>
+      if(flush(fd) < 0)
+     49a:	83 ec 0c             	sub    $0xc,%esp
+     49d:	53                   	push   %ebx
+     49e:	e8 a5 ff ff ff       	call   448 <flush>
+     4a3:	83 c4 10             	add    $0x10,%esp
+     4a6:	85 c0                	test   %eax,%eax
+     4a8:	79 e8                	jns    492 <flush+0x4a>
+        r = -1;
+     4aa:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     4af:	eb e1                	jmp    492 <flush+0x4a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     4b1:	be 00 00 00 00       	mov    $0x0,%esi
+     4b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+     4bb:	eb d8                	jmp    495 <flush+0x4d>
+    return 0;
+     4bd:	be 00 00 00 00       	mov    $0x0,%esi
+}
+     4c2:	89 f0                	mov    %esi,%eax
+     4c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     4c7:	5b                   	pop    %ebx
+     4c8:	5e                   	pop    %esi
+     4c9:	5d                   	pop    %ebp
+     4ca:	c3                   	ret
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     4cb:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     4d0:	eb f0                	jmp    4c2 <flush+0x7a>
+
+000004d2 <bufreset>:
+
+static void
+bufreset(int fd)
+{
+  if(fd >= 0 && fd < NOBUF){
+     4d2:	83 f8 0f             	cmp    $0xf,%eax
+     4d5:	76 01                	jbe    4d8 <bufreset+0x6>
+     4d7:	c3                   	ret
+{
+     4d8:	55                   	push   %ebp
+     4d9:	89 e5                	mov    %esp,%ebp
+     4db:	53                   	push   %ebx
+     4dc:	83 ec 10             	sub    $0x10,%esp
+     4df:	89 c3                	mov    %eax,%ebx
+    flush(fd);
+     4e1:	50                   	push   %eax
+     4e2:	e8 61 ff ff ff       	call   448 <flush>
+    obuf[fd].mode = BUNKNOWN;
+     4e7:	69 db 08 02 00 00    	imul   $0x208,%ebx,%ebx
+     4ed:	c7 83 60 19 00 00 00 	movl   $0x0,0x1960(%ebx)
+     4f4:	00 00 00 
+     4f7:	83 c4 10             	add    $0x10,%esp
+  }
+}
+     4fa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4fd:	c9                   	leave
+     4fe:	c3                   	ret
+
+000004ff <bufwrite>:
+
+// Write n bytes from p to fd, through its buffer.
+// Returns n, or -1 if a write fails.
+int
+bufwrite(int fd, const void *p, int n)
+{
+     4ff:	55                   	push   %ebp
+     500:	89 e5                	mov    %esp,%ebp
+     502:	57                   	push   %edi
+     503:	56                   	push   %esi
+     504:	53                   	push   %ebx
+     505:	83 ec 3c             	sub    $0x3c,%esp
+     508:	8b 75 08             	mov    0x8(%ebp),%esi
+     50b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct stat st;
+  const char *s;
+  int i;
+
+  if(fd < 0 || fd >= NOBUF)
+     50e:	83 fe 0f             	cmp    $0xf,%esi
+     511:	0f 87 a2 00 00 00    	ja     5b9 <bufwrite+0xba>
+    return write(fd, p, n);
+  if(obuf[fd].mode == BUNKNOWN){
+     517:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     51d:	83 b8 60 19 00 00 00 	cmpl   $0x0,0x1960(%eax)
+     524:	75 19                	jne    53f <bufwrite+0x40>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     526:	83 fe 02             	cmp    $0x2,%esi
+     529:	0f 85 9c 00 00 00    	jne    5cb <bufwrite+0xcc>
+      obuf[fd].mode = BNONE;
+     52f:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     535:	c7 80 60 19 00 00 01 	movl   $0x1,0x1960(%eax)
+     53c:	00 00 00 
+    else
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+  }
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     53f:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     545:	89 da                	mov    %ebx,%edx
+     547:	03 90 64 19 00 00    	add    0x1964(%eax),%edx
+     54d:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+     553:	0f 8f ae 00 00 00    	jg     607 <bufwrite+0x108>
+    return -1;
+  if(n >= OBUFSZ)
+     559:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+     55f:	0f 8f bd 00 00 00    	jg     622 <bufwrite+0x123>
+    return write(fd, p, n);
+  memmove(obuf[fd].buf + obuf[fd].n, p, n);
+     565:	69 d6 08 02 00 00    	imul   $0x208,%esi,%edx
+     56b:	8d ba 60 19 00 00    	lea    0x1960(%edx),%edi
+     571:	8b 82 64 19 00 00    	mov    0x1964(%edx),%eax
+     577:	83 ec 04             	sub    $0x4,%esp
+     57a:	53                   	push   %ebx
+     57b:	ff 75 0c             	push   0xc(%ebp)
+     57e:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     581:	8d 84 10 68 19 00 00 	lea    0x1968(%eax,%edx,1),%eax
+     588:	50                   	push   %eax
+     589:	e8 4c fd ff ff       	call   2da <memmove>
+  obuf[fd].n += n;
+     58e:	01 5f 04             	add    %ebx,0x4(%edi)
+  if(obuf[fd].mode == BNONE)
+     591:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     594:	8b 82 60 19 00 00    	mov    0x1960(%edx),%eax
+     59a:	83 c4 10             	add    $0x10,%esp
+     59d:	83 f8 01             	cmp    $0x1,%eax
+     5a0:	0f 84 91 00 00 00    	je     637 <bufwrite+0x138>
+    return flush(fd) < 0 ? -1 : n;
+  if(obuf[fd].mode == BLINE)
+     5a6:	83 f8 02             	cmp    $0x2,%eax
+     5a9:	0f 84 ca 00 00 00    	je     679 <bufwrite+0x17a>
+    for(s = p, i = 0; i < n; i++)
+      if(s[i] == '\n')
+        return flush(fd) < 0 ? -1 : n;
+  return n;
+     5af:	89 d8                	mov    %ebx,%eax
+}
+     5b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     5b4:	5b                   	pop    %ebx
+     5b5:	5e                   	pop    %esi
+     5b6:	5f                   	pop    %edi
+     5b7:	5d                   	pop    %ebp
+     5b8:	c3                   	ret
+    return write(fd, p, n);
+     5b9:	83 ec 04             	sub    $0x4,%esp
+     5bc:	53                   	push   %ebx
+     5bd:	ff 75 0c             	push   0xc(%ebp)
+     5c0:	56                   	push   %esi
+     5c1:	e8 18 02 00 00       	call   7de <write>
+     5c6:	83 c4 10             	add    $0x10,%esp
+     5c9:	eb e6                	jmp    5b1 <bufwrite+0xb2>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     5cb:	83 ec 08             	sub    $0x8,%esp
+     5ce:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     5d1:	50                   	push   %eax
+     5d2:	56                   	push   %esi
+     5d3:	e8 51 02 00 00       	call   829 <fstat>
+     5d8:	83 c4 10             	add    $0x10,%esp
+     5db:	85 c0                	test   %eax,%eax
+     5dd:	0f 88 4c ff ff ff    	js     52f <bufwrite+0x30>
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+     5e3:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     5e8:	74 16                	je     600 <bufwrite+0x101>
+     5ea:	ba 03 00 00 00       	mov    $0x3,%edx
+     5ef:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     5f5:	89 90 60 19 00 00    	mov    %edx,0x1960(%eax)
+     5fb:	e9 3f ff ff ff       	jmp    53f <bufwrite+0x40>
+     600:	ba 02 00 00 00       	mov    $0x2,%edx
+     605:	eb e8                	jmp    5ef <bufwrite+0xf0>
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     607:	83 ec 0c             	sub    $0xc,%esp
+     60a:	56                   	push   %esi
+     60b:	e8 38 fe ff ff       	call   448 <flush>
+     610:	83 c4 10             	add    $0x10,%esp
+     613:	85 c0                	test   %eax,%eax
+     615:	0f 89 3e ff ff ff    	jns    559 <bufwrite+0x5a>
+    return -1;
+     61b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     620:	eb 8f                	jmp    5b1 <bufwrite+0xb2>
+    return write(fd, p, n);
+     622:	83 ec 04             	sub    $0x4,%esp
+     625:	53                   	push   %ebx
+     626:	ff 75 0c             	push   0xc(%ebp)
+     629:	56                   	push   %esi
+     62a:	e8 af 01 00 00       	call   7de <write>
+     62f:	83 c4 10             	add    $0x10,%esp
+     632:	e9 7a ff ff ff       	jmp    5b1 <bufwrite+0xb2>
+    return flush(fd) < 0 ? -1 : n;
+     637:	83 ec 0c             	sub    $0xc,%esp
+     63a:	56                   	push   %esi
+     63b:	e8 08 fe ff ff       	call   448 <flush>
+     640:	83 c4 10             	add    $0x10,%esp
+     643:	85 c0                	test   %eax,%eax
+     645:	78 07                	js     64e <bufwrite+0x14f>
+     647:	89 d8                	mov    %ebx,%eax
+     649:	e9 63 ff ff ff       	jmp    5b1 <bufwrite+0xb2>
+     64e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     653:	e9 59 ff ff ff       	jmp    5b1 <bufwrite+0xb2>
+        return flush(fd) < 0 ? -1 : n;
+     658:	83 ec 0c             	sub    $0xc,%esp
+     65b:	56                   	push   %esi
+     65c:	e8 e7 fd ff ff       	call   448 <flush>
+     661:	83 c4 10             	add    $0x10,%esp
+     664:	85 c0                	test   %eax,%eax
+     666:	78 07                	js     66f <bufwrite+0x170>
+     668:	89 d8                	mov    %ebx,%eax
+     66a:	e9 42 ff ff ff       	jmp    5b1 <bufwrite+0xb2>
+     66f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     674:	e9 38 ff ff ff       	jmp    5b1 <bufwrite+0xb2>
+    for(s = p, i = 0; i < n; i++)
+     679:	b8 00 00 00 00       	mov    $0x0,%eax
+     67e:	39 d8                	cmp    %ebx,%eax
+     680:	7d 0e                	jge    690 <bufwrite+0x191>
+      if(s[i] == '\n')
+     682:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     685:	80 3c 01 0a          	cmpb   $0xa,(%ecx,%eax,1)
+     689:	74 cd                	je     658 <bufwrite+0x159>
+    for(s = p, i = 0; i < n; i++)
+     68b:	83 c0 01             	add    $0x1,%eax
+     68e:	eb ee                	jmp    67e <bufwrite+0x17f>
+  return n;
+     690:	89 d8                	mov    %ebx,%eax
+     692:	e9 1a ff ff ff       	jmp    5b1 <bufwrite+0xb2>
+
+00000697 <fork>:
+
+int
+fork(void)
+{
+     697:	55                   	push   %ebp
+     698:	89 e5                	mov    %esp,%ebp
+     69a:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     69d:	6a ff                	push   $0xffffffff
+     69f:	e8 a4 fd ff ff       	call   448 <flush>
+  return _fork();
+     6a4:	e8 bd 00 00 00       	call   766 <_fork>
+}
+     6a9:	c9                   	leave
+     6aa:	c3                   	ret
+
+000006ab <exit>:
+
+int
+exit(void)
+{
+     6ab:	55                   	push   %ebp
+     6ac:	89 e5                	mov    %esp,%ebp
+     6ae:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     6b1:	6a ff                	push   $0xffffffff
+     6b3:	e8 90 fd ff ff       	call   448 <flush>
+  _exit();
+     6b8:	e8 b8 00 00 00       	call   775 <_exit>
+
+000006bd <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     6bd:	55                   	push   %ebp
+     6be:	89 e5                	mov    %esp,%ebp
+     6c0:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     6c3:	6a ff                	push   $0xffffffff
+     6c5:	e8 7e fd ff ff       	call   448 <flush>
+  return _exec(path, argv);
+     6ca:	83 c4 08             	add    $0x8,%esp
+     6cd:	ff 75 0c             	push   0xc(%ebp)
+     6d0:	ff 75 08             	push   0x8(%ebp)
+     6d3:	e8 bb 00 00 00       	call   793 <_exec>
+}
+     6d8:	c9                   	leave
+     6d9:	c3                   	ret
+
+000006da <close>:
+
+int
+close(int fd)
+{
+     6da:	55                   	push   %ebp
+     6db:	89 e5                	mov    %esp,%ebp
+     6dd:	53                   	push   %ebx
+     6de:	83 ec 04             	sub    $0x4,%esp
+     6e1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bufreset(fd);
+     6e4:	89 d8                	mov    %ebx,%eax
+     6e6:	e8 e7 fd ff ff       	call   4d2 <bufreset>
+  return _close(fd);
+     6eb:	83 ec 0c             	sub    $0xc,%esp
+     6ee:	53                   	push   %ebx
+     6ef:	e8 90 00 00 00       	call   784 <_close>
+}
+     6f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6f7:	c9                   	leave
+     6f8:	c3                   	ret
+
+000006f9 <stat>:
+{
+     6f9:	55                   	push   %ebp
+     6fa:	89 e5                	mov    %esp,%ebp
+     6fc:	56                   	push   %esi
+     6fd:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     6fe:	83 ec 08             	sub    $0x8,%esp
+     701:	6a 00                	push   $0x0
+     703:	ff 75 08             	push   0x8(%ebp)
+     706:	e8 f1 00 00 00       	call   7fc <open>
+  if(fd < 0)
+     70b:	83 c4 10             	add    $0x10,%esp
+     70e:	85 c0                	test   %eax,%eax
+     710:	78 24                	js     736 <stat+0x3d>
+     712:	89 c3                	mov    %eax,%ebx
+  r = fstat(fd, st);
+     714:	83 ec 08             	sub    $0x8,%esp
+     717:	ff 75 0c             	push   0xc(%ebp)
+     71a:	50                   	push   %eax
+     71b:	e8 09 01 00 00       	call   829 <fstat>
+     720:	89 c6                	mov    %eax,%esi
+  close(fd);
+     722:	89 1c 24             	mov    %ebx,(%esp)
+     725:	e8 b0 ff ff ff       	call   6da <close>
+  return r;
+     72a:	83 c4 10             	add    $0x10,%esp
+}
+     72d:	89 f0                	mov    %esi,%eax
+     72f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     732:	5b                   	pop    %ebx
+     733:	5e                   	pop    %esi
+     734:	5d                   	pop    %ebp
+     735:	c3                   	ret
+    return -1;
+     736:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     73b:	eb f0                	jmp    72d <stat+0x34>
+
+0000073d <dup2>:
+
+int
+dup2(int oldfd, int newfd)
+{
+     73d:	55                   	push   %ebp
+     73e:	89 e5                	mov    %esp,%ebp
+     740:	56                   	push   %esi
+     741:	53                   	push   %ebx
+     742:	8b 75 08             	mov    0x8(%ebp),%esi
+     745:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(oldfd != newfd)
+     748:	39 de                	cmp    %ebx,%esi
+     74a:	75 11                	jne    75d <dup2+0x20>
+    bufreset(newfd);
+  return _dup2(oldfd, newfd);
+     74c:	83 ec 08             	sub    $0x8,%esp
+     74f:	53                   	push   %ebx
+     750:	56                   	push   %esi
+     751:	e8 4c 00 00 00       	call   7a2 <_dup2>
+}
+     756:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     759:	5b                   	pop    %ebx
+     75a:	5e                   	pop    %esi
+     75b:	5d                   	pop    %ebp
+     75c:	c3                   	ret
+    bufreset(newfd);
+     75d:	89 d8                	mov    %ebx,%eax
+     75f:	e8 6e fd ff ff       	call   4d2 <bufreset>
+     764:	eb e6                	jmp    74c <dup2+0xf>
+
+00000766 <_fork>:
+  1: ret
+
+#define SYSCALL(name) STUB(name, SYS_ ## name)
+
+# ulib.c wraps these, to flush printf()'s buffers first.
+STUB(_fork, SYS_fork)
+     766:	b8 01 00 00 00       	mov    $0x1,%eax
+     76b:	89 e1                	mov    %esp,%ecx
+     76d:	ba 74 07 00 00       	mov    $0x774,%edx
+     772:	0f 34                	sysenter
+     774:	c3                   	ret
+
+00000775 <_exit>:
+STUB(_exit, SYS_exit)
+     775:	b8 02 00 00 00       	mov    $0x2,%eax
+     77a:	89 e1                	mov    %esp,%ecx
+     77c:	ba 83 07 00 00       	mov    $0x783,%edx
+     781:	0f 34                	sysenter
+     783:	c3                   	ret
+
+00000784 <_close>:
+STUB(_close, SYS_close)
+     784:	b8 15 00 00 00       	mov    $0x15,%eax
+     789:	89 e1                	mov    %esp,%ecx
+     78b:	ba 92 07 00 00       	mov    $0x792,%edx
+     790:	0f 34                	sysenter
+     792:	c3                   	ret
+
+00000793 <_exec>:
+STUB(_exec, SYS_exec)
+     793:	b8 07 00 00 00       	mov    $0x7,%eax
+     798:	89 e1                	mov    %esp,%ecx
+     79a:	ba a1 07 00 00       	mov    $0x7a1,%edx
+     79f:	0f 34                	sysenter
+     7a1:	c3                   	ret
+
+000007a2 <_dup2>:
+STUB(_dup2, SYS_dup2)
+     7a2:	b8 17 00 00 00       	mov    $0x17,%eax
+     7a7:	89 e1                	mov    %esp,%ecx
+     7a9:	ba b0 07 00 00       	mov    $0x7b0,%edx
+     7ae:	0f 34                	sysenter
+     7b0:	c3                   	ret
+
+000007b1 <wait>:
+
+SYSCALL(wait)
+     7b1:	b8 03 00 00 00       	mov    $0x3,%eax
+     7b6:	89 e1                	mov    %esp,%ecx
+     7b8:	ba bf 07 00 00       	mov    $0x7bf,%edx
+     7bd:	0f 34                	sysenter
+     7bf:	c3                   	ret
+
+000007c0 <pipe>:
+SYSCALL(pipe)
+     7c0:	b8 04 00 00 00       	mov    $0x4,%eax
+     7c5:	89 e1                	mov    %esp,%ecx
+     7c7:	ba ce 07 00 00       	mov    $0x7ce,%edx
+     7cc:	0f 34                	sysenter
+     7ce:	c3                   	ret
+
+000007cf <read>:
+SYSCALL(read)
+     7cf:	b8 05 00 00 00       	mov    $0x5,%eax
+     7d4:	89 e1                	mov    %esp,%ecx
+     7d6:	ba dd 07 00 00       	mov    $0x7dd,%edx
+     7db:	0f 34                	sysenter
+     7dd:	c3                   	ret
+
+000007de <write>:
+SYSCALL(write)
+     7de:	b8 10 00 00 00       	mov    $0x10,%eax
+     7e3:	89 e1                	mov    %esp,%ecx
+     7e5:	ba ec 07 00 00       	mov    $0x7ec,%edx
+     7ea:	0f 34                	sysenter
+     7ec:	c3                   	ret
+
+000007ed <kill>:
+SYSCALL(kill)
+     7ed:	b8 06 00 00 00       	mov    $0x6,%eax
+     7f2:	89 e1                	mov    %esp,%ecx
+     7f4:	ba fb 07 00 00       	mov    $0x7fb,%edx
+     7f9:	0f 34                	sysenter
+     7fb:	c3                   	ret
+
+000007fc <open>:
+SYSCALL(open)
+     7fc:	b8 0f 00 00 00       	mov    $0xf,%eax
+     801:	89 e1                	mov    %esp,%ecx
+     803:	ba 0a 08 00 00       	mov    $0x80a,%edx
+     808:	0f 34                	sysenter
+     80a:	c3                   	ret
+
+0000080b <mknod>:
+SYSCALL(mknod)
+     80b:	b8 11 00 00 00       	mov    $0x11,%eax
+     810:	89 e1                	mov    %esp,%ecx
+     812:	ba 19 08 00 00       	mov    $0x819,%edx
+     817:	0f 34                	sysenter
+     819:	c3                   	ret
+
+0000081a <unlink>:
+SYSCALL(unlink)
+     81a:	b8 12 00 00 00       	mov    $0x12,%eax
+     81f:	89 e1                	mov    %esp,%ecx
+     821:	ba 28 08 00 00       	mov    $0x828,%edx
+     826:	0f 34                	sysenter
+     828:	c3                   	ret
+
+00000829 <fstat>:
+SYSCALL(fstat)
+     829:	b8 08 00 00 00       	mov    $0x8,%eax
+     82e:	89 e1                	mov    %esp,%ecx
+     830:	ba 37 08 00 00       	mov    $0x837,%edx
+     835:	0f 34                	sysenter
+     837:	c3                   	ret
+
+00000838 <link>:
+SYSCALL(link)
+     838:	b8 13 00 00 00       	mov    $0x13,%eax
+     83d:	89 e1                	mov    %esp,%ecx
+     83f:	ba 46 08 00 00       	mov    $0x846,%edx
+     844:	0f 34                	sysenter
+     846:	c3                   	ret
+
+00000847 <mkdir>:
+SYSCALL(mkdir)
+     847:	b8 14 00 00 00       	mov    $0x14,%eax
+     84c:	89 e1                	mov    %esp,%ecx
+     84e:	ba 55 08 00 00       	mov    $0x855,%edx
+     853:	0f 34                	sysenter
+     855:	c3                   	ret
+
+00000856 <chdir>:
+SYSCALL(chdir)
+     856:	b8 09 00 00 00       	mov    $0x9,%eax
+     85b:	89 e1                	mov    %esp,%ecx
+     85d:	ba 64 08 00 00       	mov    $0x864,%edx
+     862:	0f 34                	sysenter
+     864:	c3                   	ret
+
+00000865 <dup>:
+SYSCALL(dup)
+     865:	b8 0a 00 00 00       	mov    $0xa,%eax
+     86a:	89 e1                	mov    %esp,%ecx
+     86c:	ba 73 08 00 00       	mov    $0x873,%edx
+     871:	0f 34                	sysenter
+     873:	c3                   	ret
+
+00000874 <getpid>:
+SYSCALL(getpid)
+     874:	b8 0b 00 00 00       	mov    $0xb,%eax
+     879:	89 e1                	mov    %esp,%ecx
+     87b:	ba 82 08 00 00       	mov    $0x882,%edx
+     880:	0f 34                	sysenter
+     882:	c3                   	ret
+
+00000883 <sbrk>:
+SYSCALL(sbrk)
+     883:	b8 0c 00 00 00       	mov    $0xc,%eax
+     888:	89 e1                	mov    %esp,%ecx
+     88a:	ba 91 08 00 00       	mov    $0x891,%edx
+     88f:	0f 34                	sysenter
+     891:	c3                   	ret
+
+00000892 <sleep>:
+SYSCALL(sleep)
+     892:	b8 0d 00 00 00       	mov    $0xd,%eax
+     897:	89 e1                	mov    %esp,%ecx
+     899:	ba a0 08 00 00       	mov    $0x8a0,%edx
+     89e:	0f 34                	sysenter
+     8a0:	c3                   	ret
+
+000008a1 <uptime>:
+SYSCALL(uptime)
+     8a1:	b8 0e 00 00 00       	mov    $0xe,%eax
+     8a6:	89 e1                	mov    %esp,%ecx
+     8a8:	ba af 08 00 00       	mov    $0x8af,%edx
+     8ad:	0f 34                	sysenter
+     8af:	c3                   	ret
+
+000008b0 <date>:
+SYSCALL(date)
+     8b0:	b8 16 00 00 00       	mov    $0x16,%eax
+     8b5:	89 e1                	mov    %esp,%ecx
+     8b7:	ba be 08 00 00       	mov    $0x8be,%edx
+     8bc:	0f 34                	sysenter
+     8be:	c3                   	ret
+
+000008bf <faultaround>:
+SYSCALL(faultaround)
+     8bf:	b8 18 00 00 00       	mov    $0x18,%eax
+     8c4:	89 e1                	mov    %esp,%ecx
+     8c6:	ba cd 08 00 00       	mov    $0x8cd,%edx
+     8cb:	0f 34                	sysenter
+     8cd:	c3                   	ret
+
+000008ce <faultstat>:
+SYSCALL(faultstat)
+     8ce:	b8 19 00 00 00       	mov    $0x19,%eax
+     8d3:	89 e1                	mov    %esp,%ecx
+     8d5:	ba dc 08 00 00       	mov    $0x8dc,%edx
+     8da:	0f 34                	sysenter
+     8dc:	c3                   	ret
+
+000008dd <mmap>:
+SYSCALL(mmap)
+     8dd:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     8e2:	89 e1                	mov    %esp,%ecx
+     8e4:	ba eb 08 00 00       	mov    $0x8eb,%edx
+     8e9:	0f 34                	sysenter
+     8eb:	c3                   	ret
+
+000008ec <munmap>:
+SYSCALL(munmap)
+     8ec:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     8f1:	89 e1                	mov    %esp,%ecx
+     8f3:	ba fa 08 00 00       	mov    $0x8fa,%edx
+     8f8:	0f 34                	sysenter
+     8fa:	c3                   	ret
+
+000008fb <largepages>:
+SYSCALL(largepages)
+     8fb:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     900:	89 e1                	mov    %esp,%ecx
+     902:	ba 09 09 00 00       	mov    $0x909,%edx
+     907:	0f 34                	sysenter
+     909:	c3                   	ret
+
+0000090a <spawn>:
+SYSCALL(spawn)
+     90a:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     90f:	89 e1                	mov    %esp,%ecx
+     911:	ba 18 09 00 00       	mov    $0x918,%edx
+     916:	0f 34                	sysenter
+     918:	c3                   	ret
+
+00000919 <setpriority>:
+SYSCALL(setpriority)
+     919:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     91e:	89 e1                	mov    %esp,%ecx
+     920:	ba 27 09 00 00       	mov    $0x927,%edx
+     925:	0f 34                	sysenter
+     927:	c3                   	ret
+
+00000928 <getpriority>:
+SYSCALL(getpriority)
+     928:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     92d:	89 e1                	mov    %esp,%ecx
+     92f:	ba 36 09 00 00       	mov    $0x936,%edx
+     934:	0f 34                	sysenter
+     936:	c3                   	ret
+
+00000937 <getprocinfo>:
+SYSCALL(getprocinfo)
+     937:	b8 20 00 00 00       	mov    $0x20,%eax
+     93c:	89 e1                	mov    %esp,%ecx
+     93e:	ba 45 09 00 00       	mov    $0x945,%edx
+     943:	0f 34                	sysenter
+     945:	c3                   	ret
+
+00000946 <getcpuinfo>:
+SYSCALL(getcpuinfo)
+     946:	b8 21 00 00 00       	mov    $0x21,%eax
+     94b:	89 e1                	mov    %esp,%ecx
+     94d:	ba 54 09 00 00       	mov    $0x954,%edx
+     952:	0f 34                	sysenter
+     954:	c3                   	ret
+
+00000955 <clone>:
+SYSCALL(clone)
+     955:	b8 22 00 00 00       	mov    $0x22,%eax
+     95a:	89 e1                	mov    %esp,%ecx
+     95c:	ba 63 09 00 00       	mov    $0x963,%edx
+     961:	0f 34                	sysenter
+     963:	c3                   	ret
+
+00000964 <join>:
+SYSCALL(join)
+     964:	b8 23 00 00 00       	mov    $0x23,%eax
+     969:	89 e1                	mov    %esp,%ecx
+     96b:	ba 72 09 00 00       	mov    $0x972,%edx
+     970:	0f 34                	sysenter
+     972:	c3                   	ret
+
+00000973 <futex_wait>:
+SYSCALL(futex_wait)
+     973:	b8 24 00 00 00       	mov    $0x24,%eax
+     978:	89 e1                	mov    %esp,%ecx
+     97a:	ba 81 09 00 00       	mov    $0x981,%edx
+     97f:	0f 34                	sysenter
+     981:	c3                   	ret
+
+00000982 <futex_wake>:
+SYSCALL(futex_wake)
+     982:	b8 25 00 00 00       	mov    $0x25,%eax
+     987:	89 e1                	mov    %esp,%ecx
+     989:	ba 90 09 00 00       	mov    $0x990,%edx
+     98e:	0f 34                	sysenter
+     990:	c3                   	ret
+
+00000991 <setaffinity>:
+SYSCALL(setaffinity)
+     991:	b8 26 00 00 00       	mov    $0x26,%eax
+     996:	89 e1                	mov    %esp,%ecx
+     998:	ba 9f 09 00 00       	mov    $0x99f,%edx
+     99d:	0f 34                	sysenter
+     99f:	c3                   	ret
+
+000009a0 <getaffinity>:
+SYSCALL(getaffinity)
+     9a0:	b8 27 00 00 00       	mov    $0x27,%eax
+     9a5:	89 e1                	mov    %esp,%ecx
+     9a7:	ba ae 09 00 00       	mov    $0x9ae,%edx
+     9ac:	0f 34                	sysenter
+     9ae:	c3                   	ret
+
+000009af <clock_gettime>:
+SYSCALL(clock_gettime)
+     9af:	b8 28 00 00 00       	mov    $0x28,%eax
+     9b4:	89 e1                	mov    %esp,%ecx
+     9b6:	ba bd 09 00 00       	mov    $0x9bd,%edx
+     9bb:	0f 34                	sysenter
+     9bd:	c3                   	ret
+
+000009be <msleep>:
+SYSCALL(msleep)
+     9be:	b8 29 00 00 00       	mov    $0x29,%eax
+     9c3:	89 e1                	mov    %esp,%ecx
+     9c5:	ba cc 09 00 00       	mov    $0x9cc,%edx
+     9ca:	0f 34                	sysenter
+     9cc:	c3                   	ret
+
+000009cd <lockstat>:
+SYSCALL(lockstat)
+     9cd:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     9d2:	89 e1                	mov    %esp,%ecx
+     9d4:	ba db 09 00 00       	mov    $0x9db,%edx
+     9d9:	0f 34                	sysenter
+     9db:	c3                   	ret
+
+000009dc <bstat>:
+SYSCALL(bstat)
+     9dc:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     9e1:	89 e1                	mov    %esp,%ecx
+     9e3:	ba ea 09 00 00       	mov    $0x9ea,%edx
+     9e8:	0f 34                	sysenter
+     9ea:	c3                   	ret
+
+000009eb <iostat>:
+SYSCALL(iostat)
+     9eb:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     9f0:	89 e1                	mov    %esp,%ecx
+     9f2:	ba f9 09 00 00       	mov    $0x9f9,%edx
+     9f7:	0f 34                	sysenter
+     9f9:	c3                   	ret
+
+000009fa <fsync>:
+SYSCALL(fsync)
+     9fa:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     9ff:	89 e1                	mov    %esp,%ecx
+     a01:	ba 08 0a 00 00       	mov    $0xa08,%edx
+     a06:	0f 34                	sysenter
+     a08:	c3                   	ret
+
+00000a09 <pread>:
+SYSCALL(pread)
+     a09:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     a0e:	89 e1                	mov    %esp,%ecx
+     a10:	ba 17 0a 00 00       	mov    $0xa17,%edx
+     a15:	0f 34                	sysenter
+     a17:	c3                   	ret
+
+00000a18 <pwrite>:
+SYSCALL(pwrite)
+     a18:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     a1d:	89 e1                	mov    %esp,%ecx
+     a1f:	ba 26 0a 00 00       	mov    $0xa26,%edx
+     a24:	0f 34                	sysenter
+     a26:	c3                   	ret
+
+00000a27 <readv>:
+SYSCALL(readv)
+     a27:	b8 30 00 00 00       	mov    $0x30,%eax
+     a2c:	89 e1                	mov    %esp,%ecx
+     a2e:	ba 35 0a 00 00       	mov    $0xa35,%edx
+     a33:	0f 34                	sysenter
+     a35:	c3                   	ret
+
+00000a36 <writev>:
+SYSCALL(writev)
+     a36:	b8 31 00 00 00       	mov    $0x31,%eax
+     a3b:	89 e1                	mov    %esp,%ecx
+     a3d:	ba 44 0a 00 00       	mov    $0xa44,%edx
+     a42:	0f 34                	sysenter
+     a44:	c3                   	ret
+
+00000a45 <sendfile>:
+SYSCALL(sendfile)
+     a45:	b8 32 00 00 00       	mov    $0x32,%eax
+     a4a:	89 e1                	mov    %esp,%ecx
+     a4c:	ba 53 0a 00 00       	mov    $0xa53,%edx
+     a51:	0f 34                	sysenter
+     a53:	c3                   	ret
+
+00000a54 <fcntl>:
+SYSCALL(fcntl)
+     a54:	b8 33 00 00 00       	mov    $0x33,%eax
+     a59:	89 e1                	mov    %esp,%ecx
+     a5b:	ba 62 0a 00 00       	mov    $0xa62,%edx
+     a60:	0f 34                	sysenter
+     a62:	c3                   	ret
+
+00000a63 <mount>:
+SYSCALL(mount)
+     a63:	b8 34 00 00 00       	mov    $0x34,%eax
+     a68:	89 e1                	mov    %esp,%ecx
+     a6a:	ba 71 0a 00 00       	mov    $0xa71,%edx
+     a6f:	0f 34                	sysenter
+     a71:	c3                   	ret
+
+00000a72 <getdents>:
+SYSCALL(getdents)
+     a72:	b8 35 00 00 00       	mov    $0x35,%eax
+     a77:	89 e1                	mov    %esp,%ecx
+     a79:	ba 80 0a 00 00       	mov    $0xa80,%edx
+     a7e:	0f 34                	sysenter
+     a80:	c3                   	ret
+
+00000a81 <fstatat>:
+SYSCALL(fstatat)
+     a81:	b8 36 00 00 00       	mov    $0x36,%eax
+     a86:	89 e1                	mov    %esp,%ecx
+     a88:	ba 8f 0a 00 00       	mov    $0xa8f,%edx
+     a8d:	0f 34                	sysenter
+     a8f:	c3                   	ret
+
+00000a90 <sysstat>:
+SYSCALL(sysstat)
+     a90:	b8 37 00 00 00       	mov    $0x37,%eax
+     a95:	89 e1                	mov    %esp,%ecx
+     a97:	ba 9e 0a 00 00       	mov    $0xa9e,%edx
+     a9c:	0f 34                	sysenter
+     a9e:	c3                   	ret
+
+00000a9f <ringenter>:
+SYSCALL(ringenter)
+     a9f:	b8 38 00 00 00       	mov    $0x38,%eax
+     aa4:	89 e1                	mov    %esp,%ecx
+     aa6:	ba ad 0a 00 00       	mov    $0xaad,%edx
+     aab:	0f 34                	sysenter
+     aad:	c3                   	ret
+
+00000aae <trace>:
+SYSCALL(trace)
+     aae:	b8 39 00 00 00       	mov    $0x39,%eax
+     ab3:	89 e1                	mov    %esp,%ecx
+     ab5:	ba bc 0a 00 00       	mov    $0xabc,%edx
+     aba:	0f 34                	sysenter
+     abc:	c3                   	ret
+
+00000abd <memstat>:
+SYSCALL(memstat)
+     abd:	b8 3a 00 00 00       	mov    $0x3a,%eax
+     ac2:	89 e1                	mov    %esp,%ecx
+     ac4:	ba cb 0a 00 00       	mov    $0xacb,%edx
+     ac9:	0f 34                	sysenter
+     acb:	c3                   	ret
+
+00000acc <shmget>:
+SYSCALL(shmget)
+     acc:	b8 3b 00 00 00       	mov    $0x3b,%eax
+     ad1:	89 e1                	mov    %esp,%ecx
+     ad3:	ba da 0a 00 00       	mov    $0xada,%edx
+     ad8:	0f 34                	sysenter
+     ada:	c3                   	ret
+
+00000adb <shmat>:
+SYSCALL(shmat)
+     adb:	b8 3c 00 00 00       	mov    $0x3c,%eax
+     ae0:	89 e1                	mov    %esp,%ecx
+     ae2:	ba e9 0a 00 00       	mov    $0xae9,%edx
+     ae7:	0f 34                	sysenter
+     ae9:	c3                   	ret
+
+00000aea <shmdt>:
+SYSCALL(shmdt)
+     aea:	b8 3d 00 00 00       	mov    $0x3d,%eax
+     aef:	89 e1                	mov    %esp,%ecx
+     af1:	ba f8 0a 00 00       	mov    $0xaf8,%edx
+     af6:	0f 34                	sysenter
+     af8:	c3                   	ret
+
+00000af9 <irqstat>:
+SYSCALL(irqstat)
+     af9:	b8 3e 00 00 00       	mov    $0x3e,%eax
+     afe:	89 e1                	mov    %esp,%ecx
+     b00:	ba 07 0b 00 00       	mov    $0xb07,%edx
+     b05:	0f 34                	sysenter
+     b07:	c3                   	ret
+
+00000b08 <irqroute>:
+SYSCALL(irqroute)
+     b08:	b8 3f 00 00 00       	mov    $0x3f,%eax
+     b0d:	89 e1                	mov    %esp,%ecx
+     b0f:	ba 16 0b 00 00       	mov    $0xb16,%edx
+     b14:	0f 34                	sysenter
+     b16:	c3                   	ret
+
+00000b17 <putc>:
+  char buf[64];
+};
+
+static void
+putc(struct out *o, char c)
+{
+     b17:	55                   	push   %ebp
+     b18:	89 e5                	mov    %esp,%ebp
+     b1a:	56                   	push   %esi
+     b1b:	53                   	push   %ebx
+     b1c:	89 c3                	mov    %eax,%ebx
+     b1e:	89 d6                	mov    %edx,%esi
+  if(o->n == sizeof(o->buf)){
+     b20:	8b 40 04             	mov    0x4(%eax),%eax
+     b23:	83 f8 40             	cmp    $0x40,%eax
+     b26:	74 16                	je     b3e <putc+0x27>
+    bufwrite(o->fd, o->buf, o->n);
+    o->n = 0;
+  }
+  o->buf[o->n++] = c;
+     b28:	8b 43 04             	mov    0x4(%ebx),%eax
+     b2b:	8d 50 01             	lea    0x1(%eax),%edx
+     b2e:	89 53 04             	mov    %edx,0x4(%ebx)
+     b31:	89 f1                	mov    %esi,%ecx
+     b33:	88 4c 03 08          	mov    %cl,0x8(%ebx,%eax,1)
+}
+     b37:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b3a:	5b                   	pop    %ebx
+     b3b:	5e                   	pop    %esi
+     b3c:	5d                   	pop    %ebp
+     b3d:	c3                   	ret
+    bufwrite(o->fd, o->buf, o->n);
+     b3e:	8d 53 08             	lea    0x8(%ebx),%edx
+     b41:	83 ec 04             	sub    $0x4,%esp
+     b44:	50                   	push   %eax
+     b45:	52                   	push   %edx
+     b46:	ff 33                	push   (%ebx)
+     b48:	e8 b2 f9 ff ff       	call   4ff <bufwrite>
+    o->n = 0;
+     b4d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     b54:	83 c4 10             	add    $0x10,%esp
+     b57:	eb cf                	jmp    b28 <putc+0x11>
+
+00000b59 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     b59:	55                   	push   %ebp
+     b5a:	89 e5                	mov    %esp,%ebp
+     b5c:	57                   	push   %edi
+     b5d:	56                   	push   %esi
+     b5e:	53                   	push   %ebx
+     b5f:	83 ec 2c             	sub    $0x2c,%esp
+     b62:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     b65:	89 d0                	mov    %edx,%eax
+     b67:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+     b69:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     b6d:	0f 95 c1             	setne  %cl
+     b70:	c1 ea 1f             	shr    $0x1f,%edx
+     b73:	84 d1                	test   %dl,%cl
+     b75:	74 44                	je     bbb <printint+0x62>
+    neg = 1;
+    x = -xx;
+     b77:	f7 d8                	neg    %eax
+     b79:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+     b7b:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     b82:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+     b87:	89 c8                	mov    %ecx,%eax
+     b89:	ba 00 00 00 00       	mov    $0x0,%edx
+     b8e:	f7 f6                	div    %esi
+     b90:	89 df                	mov    %ebx,%edi
+     b92:	83 c3 01             	add    $0x1,%ebx
+     b95:	0f b6 92 8c 12 00 00 	movzbl 0x128c(%edx),%edx
+     b9c:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+     ba0:	89 ca                	mov    %ecx,%edx
+     ba2:	89 c1                	mov    %eax,%ecx
+     ba4:	39 f2                	cmp    %esi,%edx
+     ba6:	73 df                	jae    b87 <printint+0x2e>
+  if(neg)
+     ba8:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     bac:	74 31                	je     bdf <printint+0x86>
+    buf[i++] = '-';
+     bae:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+     bb3:	8d 5f 02             	lea    0x2(%edi),%ebx
+     bb6:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     bb9:	eb 17                	jmp    bd2 <printint+0x79>
+    x = xx;
+     bbb:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+     bbd:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     bc4:	eb bc                	jmp    b82 <printint+0x29>
+
+  while(--i >= 0)
+    putc(o, buf[i]);
+     bc6:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+     bcb:	89 f0                	mov    %esi,%eax
+     bcd:	e8 45 ff ff ff       	call   b17 <putc>
+  while(--i >= 0)
+     bd2:	83 eb 01             	sub    $0x1,%ebx
+     bd5:	79 ef                	jns    bc6 <printint+0x6d>
+}
+     bd7:	83 c4 2c             	add    $0x2c,%esp
+     bda:	5b                   	pop    %ebx
+     bdb:	5e                   	pop    %esi
+     bdc:	5f                   	pop    %edi
+     bdd:	5d                   	pop    %ebp
+     bde:	c3                   	ret
+     bdf:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     be2:	eb ee                	jmp    bd2 <printint+0x79>
+
+00000be4 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     be4:	55                   	push   %ebp
+     be5:	89 e5                	mov    %esp,%ebp
+     be7:	57                   	push   %edi
+     be8:	56                   	push   %esi
+     be9:	53                   	push   %ebx
+     bea:	83 ec 6c             	sub    $0x6c,%esp
+  int c, i, state;
+  uint *ap;
+  struct out out, *o;
+
+  o = &out;
+  o->fd = fd;
+     bed:	8b 45 08             	mov    0x8(%ebp),%eax
+     bf0:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  o->n = 0;
+     bf3:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+     bfa:	8d 45 10             	lea    0x10(%ebp),%eax
+     bfd:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  state = 0;
+     c00:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+     c05:	bb 00 00 00 00       	mov    $0x0,%ebx
+     c0a:	eb 14                	jmp    c20 <printf+0x3c>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(o, c);
+     c0c:	89 fa                	mov    %edi,%edx
+     c0e:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     c11:	e8 01 ff ff ff       	call   b17 <putc>
+     c16:	eb 05                	jmp    c1d <printf+0x39>
+      }
+    } else if(state == '%'){
+     c18:	83 fe 25             	cmp    $0x25,%esi
+     c1b:	74 25                	je     c42 <printf+0x5e>
+  for(i = 0; fmt[i]; i++){
+     c1d:	83 c3 01             	add    $0x1,%ebx
+     c20:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c23:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+     c27:	84 c0                	test   %al,%al
+     c29:	0f 84 20 01 00 00    	je     d4f <printf+0x16b>
+    c = fmt[i] & 0xff;
+     c2f:	0f be f8             	movsbl %al,%edi
+     c32:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     c35:	85 f6                	test   %esi,%esi
+     c37:	75 df                	jne    c18 <printf+0x34>
+      if(c == '%'){
+     c39:	83 f8 25             	cmp    $0x25,%eax
+     c3c:	75 ce                	jne    c0c <printf+0x28>
+        state = '%';
+     c3e:	89 c6                	mov    %eax,%esi
+     c40:	eb db                	jmp    c1d <printf+0x39>
+      if(c == 'd'){
+     c42:	83 f8 25             	cmp    $0x25,%eax
+     c45:	0f 84 cf 00 00 00    	je     d1a <printf+0x136>
+     c4b:	0f 8c dd 00 00 00    	jl     d2e <printf+0x14a>
+     c51:	83 f8 78             	cmp    $0x78,%eax
+     c54:	0f 8f d4 00 00 00    	jg     d2e <printf+0x14a>
+     c5a:	83 f8 63             	cmp    $0x63,%eax
+     c5d:	0f 8c cb 00 00 00    	jl     d2e <printf+0x14a>
+     c63:	83 e8 63             	sub    $0x63,%eax
+     c66:	83 f8 15             	cmp    $0x15,%eax
+     c69:	0f 87 bf 00 00 00    	ja     d2e <printf+0x14a>
+     c6f:	ff 24 85 34 12 00 00 	jmp    *0x1234(,%eax,4)
+        printint(o, *ap, 10, 1);
+     c76:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     c79:	8b 17                	mov    (%edi),%edx
+     c7b:	83 ec 0c             	sub    $0xc,%esp
+     c7e:	6a 01                	push   $0x1
+     c80:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     c85:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     c88:	e8 cc fe ff ff       	call   b59 <printint>
+        ap++;
+     c8d:	83 c7 04             	add    $0x4,%edi
+     c90:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     c93:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(o, '%');
+        putc(o, c);
+      }
+      state = 0;
+     c96:	be 00 00 00 00       	mov    $0x0,%esi
+     c9b:	eb 80                	jmp    c1d <printf+0x39>
+        printint(o, *ap, 16, 0);
+     c9d:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     ca0:	8b 17                	mov    (%edi),%edx
+     ca2:	83 ec 0c             	sub    $0xc,%esp
+     ca5:	6a 00                	push   $0x0
+     ca7:	b9 10 00 00 00       	mov    $0x10,%ecx
+     cac:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     caf:	e8 a5 fe ff ff       	call   b59 <printint>
+        ap++;
+     cb4:	83 c7 04             	add    $0x4,%edi
+     cb7:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     cba:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     cbd:	be 00 00 00 00       	mov    $0x0,%esi
+     cc2:	e9 56 ff ff ff       	jmp    c1d <printf+0x39>
+        s = (char*)*ap;
+     cc7:	8b 45 94             	mov    -0x6c(%ebp),%eax
+     cca:	8b 30                	mov    (%eax),%esi
+        ap++;
+     ccc:	83 c0 04             	add    $0x4,%eax
+     ccf:	89 45 94             	mov    %eax,-0x6c(%ebp)
+        if(s == 0)
+     cd2:	85 f6                	test   %esi,%esi
+     cd4:	75 15                	jne    ceb <printf+0x107>
+          s = "(null)";
+     cd6:	be 2d 12 00 00       	mov    $0x122d,%esi
+     cdb:	eb 0e                	jmp    ceb <printf+0x107>
+          putc(o, *s);
+     cdd:	0f be d2             	movsbl %dl,%edx
+     ce0:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     ce3:	e8 2f fe ff ff       	call   b17 <putc>
+          s++;
+     ce8:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+     ceb:	0f b6 16             	movzbl (%esi),%edx
+     cee:	84 d2                	test   %dl,%dl
+     cf0:	75 eb                	jne    cdd <printf+0xf9>
+      state = 0;
+     cf2:	be 00 00 00 00       	mov    $0x0,%esi
+     cf7:	e9 21 ff ff ff       	jmp    c1d <printf+0x39>
+        putc(o, *ap);
+     cfc:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     cff:	0f be 17             	movsbl (%edi),%edx
+     d02:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d05:	e8 0d fe ff ff       	call   b17 <putc>
+        ap++;
+     d0a:	83 c7 04             	add    $0x4,%edi
+     d0d:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+      state = 0;
+     d10:	be 00 00 00 00       	mov    $0x0,%esi
+     d15:	e9 03 ff ff ff       	jmp    c1d <printf+0x39>
+        putc(o, c);
+     d1a:	89 fa                	mov    %edi,%edx
+     d1c:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d1f:	e8 f3 fd ff ff       	call   b17 <putc>
+      state = 0;
+     d24:	be 00 00 00 00       	mov    $0x0,%esi
+     d29:	e9 ef fe ff ff       	jmp    c1d <printf+0x39>
+        putc(o, '%');
+     d2e:	ba 25 00 00 00       	mov    $0x25,%edx
+     d33:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d36:	e8 dc fd ff ff       	call   b17 <putc>
+        putc(o, c);
+     d3b:	89 fa                	mov    %edi,%edx
+     d3d:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d40:	e8 d2 fd ff ff       	call   b17 <putc>
+      state = 0;
+     d45:	be 00 00 00 00       	mov    $0x0,%esi
+     d4a:	e9 ce fe ff ff       	jmp    c1d <printf+0x39>
+    }
+  }
+  if(o->n > 0)
+     d4f:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     d52:	85 c0                	test   %eax,%eax
+     d54:	7f 08                	jg     d5e <printf+0x17a>
+    bufwrite(fd, o->buf, o->n);
+}
+     d56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d59:	5b                   	pop    %ebx
+     d5a:	5e                   	pop    %esi
+     d5b:	5f                   	pop    %edi
+     d5c:	5d                   	pop    %ebp
+     d5d:	c3                   	ret
+    bufwrite(fd, o->buf, o->n);
+     d5e:	83 ec 04             	sub    $0x4,%esp
+     d61:	50                   	push   %eax
+     d62:	8d 45 a8             	lea    -0x58(%ebp),%eax
+     d65:	50                   	push   %eax
+     d66:	ff 75 08             	push   0x8(%ebp)
+     d69:	e8 91 f7 ff ff       	call   4ff <bufwrite>
+     d6e:	83 c4 10             	add    $0x10,%esp
+}
+     d71:	eb e3                	jmp    d56 <printf+0x172>
+
+00000d73 <largefree>:
+  return &b->h;
+}
+
+static void
+largefree(Fblock *b)
+{
+     d73:	55                   	push   %ebp
+     d74:	89 e5                	mov    %esp,%ebp
+     d76:	57                   	push   %edi
+     d77:	56                   	push   %esi
+     d78:	53                   	push   %ebx
+     d79:	83 ec 0c             	sub    $0xc,%esp
+     d7c:	89 c1                	mov    %eax,%ecx
+  Fblock **pp, *p, *prev;
+
+  prev = 0;
+     d7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     d83:	ba ec 39 00 00       	mov    $0x39ec,%edx
+     d88:	eb 05                	jmp    d8f <largefree+0x1c>
+     d8a:	8d 50 08             	lea    0x8(%eax),%edx
+    prev = p;
+     d8d:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     d8f:	8b 02                	mov    (%edx),%eax
+     d91:	85 c0                	test   %eax,%eax
+     d93:	74 04                	je     d99 <largefree+0x26>
+     d95:	39 c8                	cmp    %ecx,%eax
+     d97:	72 f1                	jb     d8a <largefree+0x17>
+  b->next = p;
+     d99:	89 41 08             	mov    %eax,0x8(%ecx)
+  if(p && (char*)b + b->h.size == (char*)p){
+     d9c:	85 c0                	test   %eax,%eax
+     d9e:	74 09                	je     da9 <largefree+0x36>
+     da0:	8b 31                	mov    (%ecx),%esi
+     da2:	8d 3c 31             	lea    (%ecx,%esi,1),%edi
+     da5:	39 c7                	cmp    %eax,%edi
+     da7:	74 21                	je     dca <largefree+0x57>
+    b->h.size += p->h.size;
+    b->next = p->next;
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+     da9:	85 db                	test   %ebx,%ebx
+     dab:	74 09                	je     db6 <largefree+0x43>
+     dad:	8b 03                	mov    (%ebx),%eax
+     daf:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+     db2:	39 ce                	cmp    %ecx,%esi
+     db4:	74 20                	je     dd6 <largefree+0x63>
+    prev->h.size += b->h.size;
+    prev->next = b->next;
+  } else
+    *pp = b;
+     db6:	89 0a                	mov    %ecx,(%edx)
+
+  // Give the top of the heap back.  With threads sharing the
+  // address space sbrk() cannot shrink it; keep the block then.
+  for(pp = &large; (*pp)->next; pp = &(*pp)->next)
+     db8:	be ec 39 00 00       	mov    $0x39ec,%esi
+     dbd:	8b 1e                	mov    (%esi),%ebx
+     dbf:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+     dc3:	74 1d                	je     de2 <largefree+0x6f>
+     dc5:	8d 73 08             	lea    0x8(%ebx),%esi
+     dc8:	eb f3                	jmp    dbd <largefree+0x4a>
+    b->h.size += p->h.size;
+     dca:	03 30                	add    (%eax),%esi
+     dcc:	89 31                	mov    %esi,(%ecx)
+    b->next = p->next;
+     dce:	8b 40 08             	mov    0x8(%eax),%eax
+     dd1:	89 41 08             	mov    %eax,0x8(%ecx)
+     dd4:	eb d3                	jmp    da9 <largefree+0x36>
+    prev->h.size += b->h.size;
+     dd6:	03 01                	add    (%ecx),%eax
+     dd8:	89 03                	mov    %eax,(%ebx)
+    prev->next = b->next;
+     dda:	8b 41 08             	mov    0x8(%ecx),%eax
+     ddd:	89 43 08             	mov    %eax,0x8(%ebx)
+     de0:	eb d6                	jmp    db8 <largefree+0x45>
+    ;
+  b = *pp;
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     de2:	89 df                	mov    %ebx,%edi
+     de4:	03 3b                	add    (%ebx),%edi
+     de6:	83 ec 0c             	sub    $0xc,%esp
+     de9:	6a 00                	push   $0x0
+     deb:	e8 93 fa ff ff       	call   883 <sbrk>
+     df0:	83 c4 10             	add    $0x10,%esp
+     df3:	39 c7                	cmp    %eax,%edi
+     df5:	74 08                	je     dff <largefree+0x8c>
+    *pp = 0;
+}
+     df7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     dfa:	5b                   	pop    %ebx
+     dfb:	5e                   	pop    %esi
+     dfc:	5f                   	pop    %edi
+     dfd:	5d                   	pop    %ebp
+     dfe:	c3                   	ret
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     dff:	8b 03                	mov    (%ebx),%eax
+     e01:	f7 d8                	neg    %eax
+     e03:	83 ec 0c             	sub    $0xc,%esp
+     e06:	50                   	push   %eax
+     e07:	e8 77 fa ff ff       	call   883 <sbrk>
+     e0c:	83 c4 10             	add    $0x10,%esp
+     e0f:	83 f8 ff             	cmp    $0xffffffff,%eax
+     e12:	74 e3                	je     df7 <largefree+0x84>
+    *pp = 0;
+     e14:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+     e1a:	eb db                	jmp    df7 <largefree+0x84>
+
+00000e1c <more>:
+{
+     e1c:	55                   	push   %ebp
+     e1d:	89 e5                	mov    %esp,%ebp
+     e1f:	56                   	push   %esi
+     e20:	53                   	push   %ebx
+     e21:	89 c6                	mov    %eax,%esi
+  pad = -(uint)sbrk(0) & 7;
+     e23:	83 ec 0c             	sub    $0xc,%esp
+     e26:	6a 00                	push   $0x0
+     e28:	e8 56 fa ff ff       	call   883 <sbrk>
+     e2d:	f7 d8                	neg    %eax
+     e2f:	89 c3                	mov    %eax,%ebx
+     e31:	83 e3 07             	and    $0x7,%ebx
+  if((p = sbrk(n + pad)) == (char*)-1)
+     e34:	01 de                	add    %ebx,%esi
+     e36:	89 34 24             	mov    %esi,(%esp)
+     e39:	e8 45 fa ff ff       	call   883 <sbrk>
+     e3e:	83 c4 10             	add    $0x10,%esp
+     e41:	83 f8 ff             	cmp    $0xffffffff,%eax
+     e44:	74 09                	je     e4f <more+0x33>
+  return p + pad;
+     e46:	01 d8                	add    %ebx,%eax
+}
+     e48:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e4b:	5b                   	pop    %ebx
+     e4c:	5e                   	pop    %esi
+     e4d:	5d                   	pop    %ebp
+     e4e:	c3                   	ret
+    return 0;
+     e4f:	b8 00 00 00 00       	mov    $0x0,%eax
+     e54:	eb f2                	jmp    e48 <more+0x2c>
+
+00000e56 <slaballoc>:
+{
+     e56:	55                   	push   %ebp
+     e57:	89 e5                	mov    %esp,%ebp
+     e59:	56                   	push   %esi
+     e5a:	53                   	push   %ebx
+     e5b:	89 c6                	mov    %eax,%esi
+  n = 1 << (MINSHIFT + c);
+     e5d:	8d 48 04             	lea    0x4(%eax),%ecx
+     e60:	bb 01 00 00 00       	mov    $0x1,%ebx
+     e65:	d3 e3                	shl    %cl,%ebx
+  if(slab + n > slabend){
+     e67:	89 d8                	mov    %ebx,%eax
+     e69:	03 05 e8 39 00 00    	add    0x39e8,%eax
+     e6f:	39 05 e4 39 00 00    	cmp    %eax,0x39e4
+     e75:	72 17                	jb     e8e <slaballoc+0x38>
+  h = (Header*)slab;
+     e77:	a1 e8 39 00 00       	mov    0x39e8,%eax
+  slab += n;
+     e7c:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+     e7f:	89 15 e8 39 00 00    	mov    %edx,0x39e8
+  h->size = n;
+     e85:	89 18                	mov    %ebx,(%eax)
+  h->class = c;
+     e87:	89 70 04             	mov    %esi,0x4(%eax)
+}
+     e8a:	5b                   	pop    %ebx
+     e8b:	5e                   	pop    %esi
+     e8c:	5d                   	pop    %ebp
+     e8d:	c3                   	ret
+    if((p = more(SLABSZ)) == 0)
+     e8e:	b8 00 40 00 00       	mov    $0x4000,%eax
+     e93:	e8 84 ff ff ff       	call   e1c <more>
+     e98:	85 c0                	test   %eax,%eax
+     e9a:	74 ee                	je     e8a <slaballoc+0x34>
+    if(p != slabend)
+     e9c:	39 05 e4 39 00 00    	cmp    %eax,0x39e4
+     ea2:	74 05                	je     ea9 <slaballoc+0x53>
+      slab = p;
+     ea4:	a3 e8 39 00 00       	mov    %eax,0x39e8
+    slabend = p + SLABSZ;
+     ea9:	05 00 40 00 00       	add    $0x4000,%eax
+     eae:	a3 e4 39 00 00       	mov    %eax,0x39e4
+     eb3:	eb c2                	jmp    e77 <slaballoc+0x21>
+
+00000eb5 <largealloc>:
+{
+     eb5:	55                   	push   %ebp
+     eb6:	89 e5                	mov    %esp,%ebp
+     eb8:	56                   	push   %esi
+     eb9:	53                   	push   %ebx
+     eba:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     ebc:	b9 ec 39 00 00       	mov    $0x39ec,%ecx
+     ec1:	8b 01                	mov    (%ecx),%eax
+     ec3:	85 c0                	test   %eax,%eax
+     ec5:	74 36                	je     efd <largealloc+0x48>
+    if(b->h.size < n)
+     ec7:	8b 10                	mov    (%eax),%edx
+     ec9:	39 da                	cmp    %ebx,%edx
+     ecb:	72 24                	jb     ef1 <largealloc+0x3c>
+    if(b->h.size - n > SMALLMAX){
+     ecd:	29 da                	sub    %ebx,%edx
+     ecf:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+     ed5:	76 1f                	jbe    ef6 <largealloc+0x41>
+      rest = (Fblock*)((char*)b + n);
+     ed7:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+      rest->h.size = b->h.size - n;
+     eda:	89 16                	mov    %edx,(%esi)
+      rest->h.class = LARGE;
+     edc:	c7 46 04 09 00 00 00 	movl   $0x9,0x4(%esi)
+      rest->next = b->next;
+     ee3:	8b 50 08             	mov    0x8(%eax),%edx
+     ee6:	89 56 08             	mov    %edx,0x8(%esi)
+      *pp = rest;
+     ee9:	89 31                	mov    %esi,(%ecx)
+      b->h.size = n;
+     eeb:	89 18                	mov    %ebx,(%eax)
+}
+     eed:	5b                   	pop    %ebx
+     eee:	5e                   	pop    %esi
+     eef:	5d                   	pop    %ebp
+     ef0:	c3                   	ret
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     ef1:	8d 48 08             	lea    0x8(%eax),%ecx
+     ef4:	eb cb                	jmp    ec1 <largealloc+0xc>
+      *pp = b->next;
+     ef6:	8b 50 08             	mov    0x8(%eax),%edx
+     ef9:	89 11                	mov    %edx,(%ecx)
+    return &b->h;
+     efb:	eb f0                	jmp    eed <largealloc+0x38>
+  if((b = more(n)) == 0)
+     efd:	89 d8                	mov    %ebx,%eax
+     eff:	e8 18 ff ff ff       	call   e1c <more>
+     f04:	85 c0                	test   %eax,%eax
+     f06:	74 e5                	je     eed <largealloc+0x38>
+  b->h.size = n;
+     f08:	89 18                	mov    %ebx,(%eax)
+  b->h.class = LARGE;
+     f0a:	c7 40 04 09 00 00 00 	movl   $0x9,0x4(%eax)
+  return &b->h;
+     f11:	eb da                	jmp    eed <largealloc+0x38>
+
+00000f13 <free>:
+
+void
+free(void *ap)
+{
+     f13:	55                   	push   %ebp
+     f14:	89 e5                	mov    %esp,%ebp
+     f16:	56                   	push   %esi
+     f17:	53                   	push   %ebx
+     f18:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+
+  if(ap == 0)
+     f1b:	85 db                	test   %ebx,%ebx
+     f1d:	74 3b                	je     f5a <free+0x47>
+    return;
+  h = (Header*)ap - 1;
+     f1f:	8d 73 f8             	lea    -0x8(%ebx),%esi
+  lock_acquire(&lock);
+     f22:	83 ec 0c             	sub    $0xc,%esp
+     f25:	68 e0 39 00 00       	push   $0x39e0
+     f2a:	e8 9c 01 00 00       	call   10cb <lock_acquire>
+  if(h->class == LARGE)
+     f2f:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     f32:	83 c4 10             	add    $0x10,%esp
+     f35:	83 f8 09             	cmp    $0x9,%eax
+     f38:	74 27                	je     f61 <free+0x4e>
+    largefree((Fblock*)h);
+  else {
+    ((Fblock*)h)->next = freelist[h->class];
+     f3a:	8b 14 85 00 3a 00 00 	mov    0x3a00(,%eax,4),%edx
+     f41:	89 13                	mov    %edx,(%ebx)
+    freelist[h->class] = (Fblock*)h;
+     f43:	89 34 85 00 3a 00 00 	mov    %esi,0x3a00(,%eax,4)
+  }
+  lock_release(&lock);
+     f4a:	83 ec 0c             	sub    $0xc,%esp
+     f4d:	68 e0 39 00 00       	push   $0x39e0
+     f52:	e8 88 01 00 00       	call   10df <lock_release>
+     f57:	83 c4 10             	add    $0x10,%esp
+}
+     f5a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f5d:	5b                   	pop    %ebx
+     f5e:	5e                   	pop    %esi
+     f5f:	5d                   	pop    %ebp
+     f60:	c3                   	ret
+    largefree((Fblock*)h);
+     f61:	89 f0                	mov    %esi,%eax
+     f63:	e8 0b fe ff ff       	call   d73 <largefree>
+     f68:	eb e0                	jmp    f4a <free+0x37>
+
+00000f6a <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     f6a:	55                   	push   %ebp
+     f6b:	89 e5                	mov    %esp,%ebp
+     f6d:	53                   	push   %ebx
+     f6e:	83 ec 04             	sub    $0x4,%esp
+     f71:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+  uint n;
+  int c;
+
+  if(nbytes > 0x7fffffff - sizeof(Header) - 7)
+     f74:	81 fb f0 ff ff 7f    	cmp    $0x7ffffff0,%ebx
+     f7a:	0f 87 8b 00 00 00    	ja     100b <malloc+0xa1>
+    return 0;
+  n = (nbytes + sizeof(Header) + 7) & ~7;
+     f80:	83 c3 0f             	add    $0xf,%ebx
+     f83:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(n < sizeof(Fblock))
+     f86:	83 fb 0b             	cmp    $0xb,%ebx
+     f89:	77 05                	ja     f90 <malloc+0x26>
+    n = sizeof(Fblock);
+     f8b:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  lock_acquire(&lock);
+     f90:	83 ec 0c             	sub    $0xc,%esp
+     f93:	68 e0 39 00 00       	push   $0x39e0
+     f98:	e8 2e 01 00 00       	call   10cb <lock_acquire>
+  if(n <= SMALLMAX){
+     f9d:	83 c4 10             	add    $0x10,%esp
+     fa0:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+     fa6:	77 58                	ja     1000 <malloc+0x96>
+    for(c = 0; (1 << (MINSHIFT + c)) < n; c++)
+     fa8:	ba 00 00 00 00       	mov    $0x0,%edx
+     fad:	eb 03                	jmp    fb2 <malloc+0x48>
+     faf:	83 c2 01             	add    $0x1,%edx
+     fb2:	8d 4a 04             	lea    0x4(%edx),%ecx
+     fb5:	b8 01 00 00 00       	mov    $0x1,%eax
+     fba:	d3 e0                	shl    %cl,%eax
+     fbc:	39 d8                	cmp    %ebx,%eax
+     fbe:	72 ef                	jb     faf <malloc+0x45>
+      ;
+    if(freelist[c]){
+     fc0:	8b 04 95 00 3a 00 00 	mov    0x3a00(,%edx,4),%eax
+     fc7:	85 c0                	test   %eax,%eax
+     fc9:	74 2a                	je     ff5 <malloc+0x8b>
+      h = &freelist[c]->h;
+     fcb:	89 c3                	mov    %eax,%ebx
+      freelist[c] = freelist[c]->next;
+     fcd:	8b 40 08             	mov    0x8(%eax),%eax
+     fd0:	89 04 95 00 3a 00 00 	mov    %eax,0x3a00(,%edx,4)
+    } else
+      h = slaballoc(c);
+  } else
+    h = largealloc(n);
+  lock_release(&lock);
+     fd7:	83 ec 0c             	sub    $0xc,%esp
+     fda:	68 e0 39 00 00       	push   $0x39e0
+     fdf:	e8 fb 00 00 00       	call   10df <lock_release>
+  return h ? (void*)(h + 1) : 0;
+     fe4:	83 c4 10             	add    $0x10,%esp
+     fe7:	85 db                	test   %ebx,%ebx
+     fe9:	74 03                	je     fee <malloc+0x84>
+     feb:	83 c3 08             	add    $0x8,%ebx
+}
+     fee:	89 d8                	mov    %ebx,%eax
+     ff0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ff3:	c9                   	leave
+     ff4:	c3                   	ret
+      h = slaballoc(c);
+     ff5:	89 d0                	mov    %edx,%eax
+     ff7:	e8 5a fe ff ff       	call   e56 <slaballoc>
+     ffc:	89 c3                	mov    %eax,%ebx
+     ffe:	eb d7                	jmp    fd7 <malloc+0x6d>
+    h = largealloc(n);
+    1000:	89 d8                	mov    %ebx,%eax
+    1002:	e8 ae fe ff ff       	call   eb5 <largealloc>
+    1007:	89 c3                	mov    %eax,%ebx
+    1009:	eb cc                	jmp    fd7 <malloc+0x6d>
+    return 0;
+    100b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1010:	eb dc                	jmp    fee <malloc+0x84>
+
+00001012 <tstart>:
+  void *arg;
+};
+
+static void
+tstart(void *a)
+{
+    1012:	55                   	push   %ebp
+    1013:	89 e5                	mov    %esp,%ebp
+    1015:	83 ec 14             	sub    $0x14,%esp
+    1018:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+    101b:	ff 70 04             	push   0x4(%eax)
+    101e:	ff 10                	call   *(%eax)
+  exit();
+    1020:	e8 86 f6 ff ff       	call   6ab <exit>
+
+00001025 <thread_create>:
+}
+
+// Run fn(arg) in a new thread.  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1025:	55                   	push   %ebp
+    1026:	89 e5                	mov    %esp,%ebp
+    1028:	56                   	push   %esi
+    1029:	53                   	push   %ebx
+  struct tstart *t;
+  char *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    102a:	83 ec 0c             	sub    $0xc,%esp
+    102d:	68 00 10 00 00       	push   $0x1000
+    1032:	e8 33 ff ff ff       	call   f6a <malloc>
+    1037:	83 c4 10             	add    $0x10,%esp
+    103a:	85 c0                	test   %eax,%eax
+    103c:	74 42                	je     1080 <thread_create+0x5b>
+    103e:	89 c3                	mov    %eax,%ebx
+    return -1;
+  t = (struct tstart*)stack;
+  t->fn = fn;
+    1040:	8b 45 08             	mov    0x8(%ebp),%eax
+    1043:	89 03                	mov    %eax,(%ebx)
+  t->arg = arg;
+    1045:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1048:	89 43 04             	mov    %eax,0x4(%ebx)
+  if((pid = clone(tstart, stack + TSTACK, t)) < 0)
+    104b:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    1051:	83 ec 04             	sub    $0x4,%esp
+    1054:	53                   	push   %ebx
+    1055:	50                   	push   %eax
+    1056:	68 12 10 00 00       	push   $0x1012
+    105b:	e8 f5 f8 ff ff       	call   955 <clone>
+    1060:	89 c6                	mov    %eax,%esi
+    1062:	83 c4 10             	add    $0x10,%esp
+    1065:	85 c0                	test   %eax,%eax
+    1067:	78 09                	js     1072 <thread_create+0x4d>
+    free(stack);
+  return pid;
+}
+    1069:	89 f0                	mov    %esi,%eax
+    106b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    106e:	5b                   	pop    %ebx
+    106f:	5e                   	pop    %esi
+    1070:	5d                   	pop    %ebp
+    1071:	c3                   	ret
+    free(stack);
+    1072:	83 ec 0c             	sub    $0xc,%esp
+    1075:	53                   	push   %ebx
+    1076:	e8 98 fe ff ff       	call   f13 <free>
+    107b:	83 c4 10             	add    $0x10,%esp
+    107e:	eb e9                	jmp    1069 <thread_create+0x44>
+    return -1;
+    1080:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1085:	eb e2                	jmp    1069 <thread_create+0x44>
+
+00001087 <thread_join>:
+
+// Wait for one of this process's threads to exit and free its
+// stack.  Returns its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+    1087:	55                   	push   %ebp
+    1088:	89 e5                	mov    %esp,%ebp
+    108a:	53                   	push   %ebx
+    108b:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    108e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1091:	50                   	push   %eax
+    1092:	e8 cd f8 ff ff       	call   964 <join>
+    1097:	89 c3                	mov    %eax,%ebx
+    1099:	83 c4 10             	add    $0x10,%esp
+    109c:	85 c0                	test   %eax,%eax
+    109e:	79 07                	jns    10a7 <thread_join+0x20>
+    free((char*)stack - TSTACK);
+  return pid;
+}
+    10a0:	89 d8                	mov    %ebx,%eax
+    10a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10a5:	c9                   	leave
+    10a6:	c3                   	ret
+    free((char*)stack - TSTACK);
+    10a7:	83 ec 0c             	sub    $0xc,%esp
+    10aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10ad:	2d 00 10 00 00       	sub    $0x1000,%eax
+    10b2:	50                   	push   %eax
+    10b3:	e8 5b fe ff ff       	call   f13 <free>
+    10b8:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    10bb:	eb e3                	jmp    10a0 <thread_join+0x19>
+
+000010bd <lock_init>:
+
+void
+lock_init(lock_t *lk)
+{
+    10bd:	55                   	push   %ebp
+    10be:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    10c0:	8b 45 08             	mov    0x8(%ebp),%eax
+    10c3:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    10c9:	5d                   	pop    %ebp
+    10ca:	c3                   	ret
+
+000010cb <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+    10cb:	55                   	push   %ebp
+    10cc:	89 e5                	mov    %esp,%ebp
+    10ce:	8b 55 08             	mov    0x8(%ebp),%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    10d1:	b8 01 00 00 00       	mov    $0x1,%eax
+    10d6:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    10d9:	85 c0                	test   %eax,%eax
+    10db:	75 f4                	jne    10d1 <lock_acquire+0x6>
+    ;
+}
+    10dd:	5d                   	pop    %ebp
+    10de:	c3                   	ret
+
+000010df <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+    10df:	55                   	push   %ebp
+    10e0:	89 e5                	mov    %esp,%ebp
+    10e2:	8b 55 08             	mov    0x8(%ebp),%edx
+    10e5:	b8 00 00 00 00       	mov    $0x0,%eax
+    10ea:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    10ed:	5d                   	pop    %ebp
+    10ee:	c3                   	ret
+
+000010ef <mutex_init>:
+// Are Tricky": state is 0 when free, 1 when held, 2 when held and
+// others may be waiting.  Unlocking an uncontended mutex costs no
+// system call.
+void
+mutex_init(mutex_t *m)
+{
+    10ef:	55                   	push   %ebp
+    10f0:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    10f2:	8b 45 08             	mov    0x8(%ebp),%eax
+    10f5:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    10fb:	5d                   	pop    %ebp
+    10fc:	c3                   	ret
+
+000010fd <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+    10fd:	55                   	push   %ebp
+    10fe:	89 e5                	mov    %esp,%ebp
+    1100:	53                   	push   %ebx
+    1101:	83 ec 04             	sub    $0x4,%esp
+    1104:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    1107:	b8 00 00 00 00       	mov    $0x0,%eax
+    110c:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1111:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    1115:	85 c0                	test   %eax,%eax
+    1117:	74 29                	je     1142 <mutex_lock+0x45>
+    return;
+  if(c != 2)
+    1119:	83 f8 02             	cmp    $0x2,%eax
+    111c:	74 20                	je     113e <mutex_lock+0x41>
+    111e:	b8 02 00 00 00       	mov    $0x2,%eax
+    1123:	f0 87 03             	lock xchg %eax,(%ebx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    1126:	eb 16                	jmp    113e <mutex_lock+0x41>
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    1128:	83 ec 08             	sub    $0x8,%esp
+    112b:	6a 02                	push   $0x2
+    112d:	53                   	push   %ebx
+    112e:	e8 40 f8 ff ff       	call   973 <futex_wait>
+  asm volatile("lock; xchgl %0, %1" :
+    1133:	b8 02 00 00 00       	mov    $0x2,%eax
+    1138:	f0 87 03             	lock xchg %eax,(%ebx)
+    113b:	83 c4 10             	add    $0x10,%esp
+  while(c != 0){
+    113e:	85 c0                	test   %eax,%eax
+    1140:	75 e6                	jne    1128 <mutex_lock+0x2b>
+    c = xchg(&m->state, 2);
+  }
+}
+    1142:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1145:	c9                   	leave
+    1146:	c3                   	ret
+
+00001147 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+    1147:	55                   	push   %ebp
+    1148:	89 e5                	mov    %esp,%ebp
+    114a:	83 ec 08             	sub    $0x8,%esp
+    114d:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    1150:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    1155:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    1159:	83 fa 01             	cmp    $0x1,%edx
+    115c:	75 02                	jne    1160 <mutex_unlock+0x19>
+    m->state = 0;
+    futex_wake(&m->state, 1);
+  }
+}
+    115e:	c9                   	leave
+    115f:	c3                   	ret
+    m->state = 0;
+    1160:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+    1166:	83 ec 08             	sub    $0x8,%esp
+    1169:	6a 01                	push   $0x1
+    116b:	50                   	push   %eax
+    116c:	e8 11 f8 ff ff       	call   982 <futex_wake>
+    1171:	83 c4 10             	add    $0x10,%esp
+}
+    1174:	eb e8                	jmp    115e <mutex_unlock+0x17>
+
+00001176 <cond_init>:
+// Condition variable: waiters sleep on a sequence number that
+// every signal bumps, so a signal between the unlock and the
+// futex_wait() in cond_wait() is not lost.
+void
+cond_init(cond_t *c)
+{
+    1176:	55                   	push   %ebp
+    1177:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    1179:	8b 45 08             	mov    0x8(%ebp),%eax
+    117c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1182:	5d                   	pop    %ebp
+    1183:	c3                   	ret
+
+00001184 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+    1184:	55                   	push   %ebp
+    1185:	89 e5                	mov    %esp,%ebp
+    1187:	57                   	push   %edi
+    1188:	56                   	push   %esi
+    1189:	53                   	push   %ebx
+    118a:	83 ec 18             	sub    $0x18,%esp
+    118d:	8b 75 08             	mov    0x8(%ebp),%esi
+    1190:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    1193:	8b 3e                	mov    (%esi),%edi
+  mutex_unlock(m);
+    1195:	53                   	push   %ebx
+    1196:	e8 ac ff ff ff       	call   1147 <mutex_unlock>
+  futex_wait(&c->seq, seq);
+    119b:	83 c4 08             	add    $0x8,%esp
+    119e:	57                   	push   %edi
+    119f:	56                   	push   %esi
+    11a0:	e8 ce f7 ff ff       	call   973 <futex_wait>
+  // Others may be waiting for m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+    11a5:	83 c4 10             	add    $0x10,%esp
+    11a8:	eb 0e                	jmp    11b8 <cond_wait+0x34>
+    futex_wait(&m->state, 2);
+    11aa:	83 ec 08             	sub    $0x8,%esp
+    11ad:	6a 02                	push   $0x2
+    11af:	53                   	push   %ebx
+    11b0:	e8 be f7 ff ff       	call   973 <futex_wait>
+    11b5:	83 c4 10             	add    $0x10,%esp
+    11b8:	b8 02 00 00 00       	mov    $0x2,%eax
+    11bd:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    11c0:	85 c0                	test   %eax,%eax
+    11c2:	75 e6                	jne    11aa <cond_wait+0x26>
+}
+    11c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11c7:	5b                   	pop    %ebx
+    11c8:	5e                   	pop    %esi
+    11c9:	5f                   	pop    %edi
+    11ca:	5d                   	pop    %ebp
+    11cb:	c3                   	ret
+
+000011cc <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+    11cc:	55                   	push   %ebp
+    11cd:	89 e5                	mov    %esp,%ebp
+    11cf:	83 ec 10             	sub    $0x10,%esp
+    11d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    11d5:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+    11d9:	6a 01                	push   $0x1
+    11db:	50                   	push   %eax
+    11dc:	e8 a1 f7 ff ff       	call   982 <futex_wake>
+}
+    11e1:	83 c4 10             	add    $0x10,%esp
+    11e4:	c9                   	leave
+    11e5:	c3                   	ret
+
+000011e6 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+    11e6:	55                   	push   %ebp
+    11e7:	89 e5                	mov    %esp,%ebp
+    11e9:	83 ec 10             	sub    $0x10,%esp
+    11ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    11ef:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, NPROC);
+    11f3:	6a 40                	push   $0x40
+    11f5:	50                   	push   %eax
+    11f6:	e8 87 f7 ff ff       	call   982 <futex_wake>
+}
+    11fb:	83 c4 10             	add    $0x10,%esp
+    11fe:	c9                   	leave
+    11ff:	c3                   	ret
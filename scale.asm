@@ -0,0 +1,3407 @@
+
+_scale:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <fail>:
+  return ts.tv_sec*1000 + ts.tv_nsec/1000000;
+}
+
+static void
+fail(char *what)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "scale: %s failed\n", what);
+       6:	50                   	push   %eax
+       7:	68 e0 17 00 00       	push   $0x17e0
+       c:	6a 02                	push   $0x2
+       e:	e8 a4 11 00 00       	call   11b7 <printf>
+  exit();
+      13:	e8 66 0c 00 00       	call   c7e <exit>
+
+00000018 <create>:
+  }
+}
+
+static void
+create(int w, int n)
+{
+      18:	55                   	push   %ebp
+      19:	89 e5                	mov    %esp,%ebp
+      1b:	57                   	push   %edi
+      1c:	56                   	push   %esi
+      1d:	53                   	push   %ebx
+      1e:	83 ec 1c             	sub    $0x1c,%esp
+  char name[8];
+  int i, fd;
+
+  name[0] = 's';
+      21:	c6 45 e0 73          	movb   $0x73,-0x20(%ebp)
+  name[1] = 'a' + w;
+      25:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+      29:	83 c0 61             	add    $0x61,%eax
+      2c:	88 45 e1             	mov    %al,-0x1f(%ebp)
+  name[5] = 0;
+      2f:	c6 45 e5 00          	movb   $0x0,-0x1b(%ebp)
+  for(i = 0; i < n; i++){
+      33:	be 00 00 00 00       	mov    $0x0,%esi
+      38:	3b 75 0c             	cmp    0xc(%ebp),%esi
+      3b:	0f 8d b7 00 00 00    	jge    f8 <create+0xe0>
+    name[2] = 'a' + i/676%26;
+      41:	ba eb 5d f2 60       	mov    $0x60f25deb,%edx
+      46:	89 f0                	mov    %esi,%eax
+      48:	f7 ea                	imul   %edx
+      4a:	c1 fa 08             	sar    $0x8,%edx
+      4d:	89 f7                	mov    %esi,%edi
+      4f:	c1 ff 1f             	sar    $0x1f,%edi
+      52:	89 d3                	mov    %edx,%ebx
+      54:	29 fb                	sub    %edi,%ebx
+      56:	b9 4f ec c4 4e       	mov    $0x4ec4ec4f,%ecx
+      5b:	89 d8                	mov    %ebx,%eax
+      5d:	f7 e9                	imul   %ecx
+      5f:	c1 fa 03             	sar    $0x3,%edx
+      62:	89 d8                	mov    %ebx,%eax
+      64:	c1 f8 1f             	sar    $0x1f,%eax
+      67:	29 c2                	sub    %eax,%edx
+      69:	6b c2 1a             	imul   $0x1a,%edx,%eax
+      6c:	29 c3                	sub    %eax,%ebx
+      6e:	89 da                	mov    %ebx,%edx
+      70:	83 c2 61             	add    $0x61,%edx
+      73:	88 55 e2             	mov    %dl,-0x1e(%ebp)
+    name[3] = 'a' + i/26%26;
+      76:	89 f0                	mov    %esi,%eax
+      78:	f7 e9                	imul   %ecx
+      7a:	89 d3                	mov    %edx,%ebx
+      7c:	c1 fb 03             	sar    $0x3,%ebx
+      7f:	29 fb                	sub    %edi,%ebx
+      81:	89 d8                	mov    %ebx,%eax
+      83:	f7 e9                	imul   %ecx
+      85:	c1 fa 03             	sar    $0x3,%edx
+      88:	89 d8                	mov    %ebx,%eax
+      8a:	c1 f8 1f             	sar    $0x1f,%eax
+      8d:	29 c2                	sub    %eax,%edx
+      8f:	6b c2 1a             	imul   $0x1a,%edx,%eax
+      92:	89 da                	mov    %ebx,%edx
+      94:	29 c2                	sub    %eax,%edx
+      96:	83 c2 61             	add    $0x61,%edx
+      99:	88 55 e3             	mov    %dl,-0x1d(%ebp)
+    name[4] = 'a' + i%26;
+      9c:	6b db 1a             	imul   $0x1a,%ebx,%ebx
+      9f:	89 f0                	mov    %esi,%eax
+      a1:	29 d8                	sub    %ebx,%eax
+      a3:	83 c0 61             	add    $0x61,%eax
+      a6:	88 45 e4             	mov    %al,-0x1c(%ebp)
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0)
+      a9:	83 ec 08             	sub    $0x8,%esp
+      ac:	68 02 02 00 00       	push   $0x202
+      b1:	8d 45 e0             	lea    -0x20(%ebp),%eax
+      b4:	50                   	push   %eax
+      b5:	e8 15 0d 00 00       	call   dcf <open>
+      ba:	83 c4 10             	add    $0x10,%esp
+      bd:	85 c0                	test   %eax,%eax
+      bf:	78 23                	js     e4 <create+0xcc>
+      fail("create");
+    close(fd);
+      c1:	83 ec 0c             	sub    $0xc,%esp
+      c4:	50                   	push   %eax
+      c5:	e8 e3 0b 00 00       	call   cad <close>
+    if(unlink(name) < 0)
+      ca:	8d 45 e0             	lea    -0x20(%ebp),%eax
+      cd:	89 04 24             	mov    %eax,(%esp)
+      d0:	e8 18 0d 00 00       	call   ded <unlink>
+      d5:	83 c4 10             	add    $0x10,%esp
+      d8:	85 c0                	test   %eax,%eax
+      da:	78 12                	js     ee <create+0xd6>
+  for(i = 0; i < n; i++){
+      dc:	83 c6 01             	add    $0x1,%esi
+      df:	e9 54 ff ff ff       	jmp    38 <create+0x20>
+      fail("create");
+      e4:	b8 f2 17 00 00       	mov    $0x17f2,%eax
+      e9:	e8 12 ff ff ff       	call   0 <fail>
+      fail("unlink");
+      ee:	b8 f9 17 00 00       	mov    $0x17f9,%eax
+      f3:	e8 08 ff ff ff       	call   0 <fail>
+  }
+}
+      f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      fb:	5b                   	pop    %ebx
+      fc:	5e                   	pop    %esi
+      fd:	5f                   	pop    %edi
+      fe:	5d                   	pop    %ebp
+      ff:	c3                   	ret
+
+00000100 <bread>:
+  wait();
+}
+
+static void
+bread(int w, int n)
+{
+     100:	55                   	push   %ebp
+     101:	89 e5                	mov    %esp,%ebp
+     103:	57                   	push   %edi
+     104:	56                   	push   %esi
+     105:	53                   	push   %ebx
+     106:	81 ec 14 02 00 00    	sub    $0x214,%esp
+     10c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char buf[512];
+  int i, fd;
+
+  if((fd = open("scalef", O_RDONLY)) < 0)
+     10f:	6a 00                	push   $0x0
+     111:	68 00 18 00 00       	push   $0x1800
+     116:	e8 b4 0c 00 00       	call   dcf <open>
+     11b:	83 c4 10             	add    $0x10,%esp
+     11e:	85 c0                	test   %eax,%eax
+     120:	78 3d                	js     15f <bread+0x5f>
+     122:	89 c6                	mov    %eax,%esi
+    fail("open");
+  for(i = 0; i < n; i++)
+     124:	bb 00 00 00 00       	mov    $0x0,%ebx
+     129:	39 fb                	cmp    %edi,%ebx
+     12b:	7d 46                	jge    173 <bread+0x73>
+    if(pread(fd, buf, sizeof(buf), (i*sizeof(buf) + w*4096) % SHAREDSZ) !=
+     12d:	89 d8                	mov    %ebx,%eax
+     12f:	c1 e0 09             	shl    $0x9,%eax
+     132:	8b 55 08             	mov    0x8(%ebp),%edx
+     135:	c1 e2 0c             	shl    $0xc,%edx
+     138:	01 d0                	add    %edx,%eax
+     13a:	0f b7 c0             	movzwl %ax,%eax
+     13d:	50                   	push   %eax
+     13e:	68 00 02 00 00       	push   $0x200
+     143:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+     149:	50                   	push   %eax
+     14a:	56                   	push   %esi
+     14b:	e8 8c 0e 00 00       	call   fdc <pread>
+     150:	83 c4 10             	add    $0x10,%esp
+     153:	3d 00 02 00 00       	cmp    $0x200,%eax
+     158:	75 0f                	jne    169 <bread+0x69>
+  for(i = 0; i < n; i++)
+     15a:	83 c3 01             	add    $0x1,%ebx
+     15d:	eb ca                	jmp    129 <bread+0x29>
+    fail("open");
+     15f:	b8 07 18 00 00       	mov    $0x1807,%eax
+     164:	e8 97 fe ff ff       	call   0 <fail>
+       sizeof(buf))
+      fail("pread");
+     169:	b8 0c 18 00 00       	mov    $0x180c,%eax
+     16e:	e8 8d fe ff ff       	call   0 <fail>
+  close(fd);
+     173:	83 ec 0c             	sub    $0xc,%esp
+     176:	56                   	push   %esi
+     177:	e8 31 0b 00 00       	call   cad <close>
+}
+     17c:	83 c4 10             	add    $0x10,%esp
+     17f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     182:	5b                   	pop    %ebx
+     183:	5e                   	pop    %esi
+     184:	5f                   	pop    %edi
+     185:	5d                   	pop    %ebp
+     186:	c3                   	ret
+
+00000187 <pipes>:
+{
+     187:	55                   	push   %ebp
+     188:	89 e5                	mov    %esp,%ebp
+     18a:	56                   	push   %esi
+     18b:	53                   	push   %ebx
+     18c:	83 ec 2c             	sub    $0x2c,%esp
+     18f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(pipe(p) < 0 || pipe(q) < 0)
+     192:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     195:	50                   	push   %eax
+     196:	e8 f8 0b 00 00       	call   d93 <pipe>
+     19b:	83 c4 10             	add    $0x10,%esp
+     19e:	85 c0                	test   %eax,%eax
+     1a0:	78 63                	js     205 <pipes+0x7e>
+     1a2:	83 ec 0c             	sub    $0xc,%esp
+     1a5:	8d 45 e8             	lea    -0x18(%ebp),%eax
+     1a8:	50                   	push   %eax
+     1a9:	e8 e5 0b 00 00       	call   d93 <pipe>
+     1ae:	83 c4 10             	add    $0x10,%esp
+     1b1:	85 c0                	test   %eax,%eax
+     1b3:	78 50                	js     205 <pipes+0x7e>
+  if(fork() == 0){
+     1b5:	e8 b0 0a 00 00       	call   c6a <fork>
+     1ba:	89 c3                	mov    %eax,%ebx
+     1bc:	85 c0                	test   %eax,%eax
+     1be:	74 59                	je     219 <pipes+0x92>
+  for(i = 0; i < n; i++)
+     1c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+     1c5:	39 f3                	cmp    %esi,%ebx
+     1c7:	0f 8d 96 00 00 00    	jge    263 <pipes+0xdc>
+    if(write(p[1], "x", 1) != 1 || read(q[0], &c, 1) != 1)
+     1cd:	83 ec 04             	sub    $0x4,%esp
+     1d0:	6a 01                	push   $0x1
+     1d2:	68 1c 18 00 00       	push   $0x181c
+     1d7:	ff 75 f4             	push   -0xc(%ebp)
+     1da:	e8 d2 0b 00 00       	call   db1 <write>
+     1df:	83 c4 10             	add    $0x10,%esp
+     1e2:	83 f8 01             	cmp    $0x1,%eax
+     1e5:	75 72                	jne    259 <pipes+0xd2>
+     1e7:	83 ec 04             	sub    $0x4,%esp
+     1ea:	6a 01                	push   $0x1
+     1ec:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     1ef:	50                   	push   %eax
+     1f0:	ff 75 e8             	push   -0x18(%ebp)
+     1f3:	e8 aa 0b 00 00       	call   da2 <read>
+     1f8:	83 c4 10             	add    $0x10,%esp
+     1fb:	83 f8 01             	cmp    $0x1,%eax
+     1fe:	75 59                	jne    259 <pipes+0xd2>
+  for(i = 0; i < n; i++)
+     200:	83 c3 01             	add    $0x1,%ebx
+     203:	eb c0                	jmp    1c5 <pipes+0x3e>
+    fail("pipe");
+     205:	b8 12 18 00 00       	mov    $0x1812,%eax
+     20a:	e8 f1 fd ff ff       	call   0 <fail>
+        fail("pong");
+     20f:	b8 17 18 00 00       	mov    $0x1817,%eax
+     214:	e8 e7 fd ff ff       	call   0 <fail>
+    for(i = 0; i < n; i++)
+     219:	39 f3                	cmp    %esi,%ebx
+     21b:	7d 37                	jge    254 <pipes+0xcd>
+      if(read(p[0], &c, 1) != 1 || write(q[1], &c, 1) != 1)
+     21d:	83 ec 04             	sub    $0x4,%esp
+     220:	6a 01                	push   $0x1
+     222:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     225:	50                   	push   %eax
+     226:	ff 75 f0             	push   -0x10(%ebp)
+     229:	e8 74 0b 00 00       	call   da2 <read>
+     22e:	83 c4 10             	add    $0x10,%esp
+     231:	83 f8 01             	cmp    $0x1,%eax
+     234:	75 d9                	jne    20f <pipes+0x88>
+     236:	83 ec 04             	sub    $0x4,%esp
+     239:	6a 01                	push   $0x1
+     23b:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     23e:	50                   	push   %eax
+     23f:	ff 75 ec             	push   -0x14(%ebp)
+     242:	e8 6a 0b 00 00       	call   db1 <write>
+     247:	83 c4 10             	add    $0x10,%esp
+     24a:	83 f8 01             	cmp    $0x1,%eax
+     24d:	75 c0                	jne    20f <pipes+0x88>
+    for(i = 0; i < n; i++)
+     24f:	83 c3 01             	add    $0x1,%ebx
+     252:	eb c5                	jmp    219 <pipes+0x92>
+    exit();
+     254:	e8 25 0a 00 00       	call   c7e <exit>
+      fail("ping");
+     259:	b8 1e 18 00 00       	mov    $0x181e,%eax
+     25e:	e8 9d fd ff ff       	call   0 <fail>
+  wait();
+     263:	e8 1c 0b 00 00       	call   d84 <wait>
+}
+     268:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     26b:	5b                   	pop    %ebx
+     26c:	5e                   	pop    %esi
+     26d:	5d                   	pop    %ebp
+     26e:	c3                   	ret
+
+0000026f <fault>:
+{
+     26f:	55                   	push   %ebp
+     270:	89 e5                	mov    %esp,%ebp
+     272:	56                   	push   %esi
+     273:	53                   	push   %ebx
+     274:	8b 75 0c             	mov    0xc(%ebp),%esi
+  for(i = 0; i < n; i += 16){
+     277:	bb 00 00 00 00       	mov    $0x0,%ebx
+     27c:	eb 2d                	jmp    2ab <fault+0x3c>
+      fail("sbrk");
+     27e:	b8 23 18 00 00       	mov    $0x1823,%eax
+     283:	e8 78 fd ff ff       	call   0 <fail>
+      a[j*4096] = j;
+     288:	89 d1                	mov    %edx,%ecx
+     28a:	c1 e1 0c             	shl    $0xc,%ecx
+     28d:	88 14 08             	mov    %dl,(%eax,%ecx,1)
+    for(j = 0; j < 16; j++)
+     290:	83 c2 01             	add    $0x1,%edx
+     293:	83 fa 0f             	cmp    $0xf,%edx
+     296:	7e f0                	jle    288 <fault+0x19>
+    sbrk(-16*4096);
+     298:	83 ec 0c             	sub    $0xc,%esp
+     29b:	68 00 00 ff ff       	push   $0xffff0000
+     2a0:	e8 b1 0b 00 00       	call   e56 <sbrk>
+  for(i = 0; i < n; i += 16){
+     2a5:	83 c3 10             	add    $0x10,%ebx
+     2a8:	83 c4 10             	add    $0x10,%esp
+     2ab:	39 f3                	cmp    %esi,%ebx
+     2ad:	7d 1c                	jge    2cb <fault+0x5c>
+    if((a = sbrk(16*4096)) == (char*)-1)
+     2af:	83 ec 0c             	sub    $0xc,%esp
+     2b2:	68 00 00 01 00       	push   $0x10000
+     2b7:	e8 9a 0b 00 00       	call   e56 <sbrk>
+     2bc:	83 c4 10             	add    $0x10,%esp
+     2bf:	83 f8 ff             	cmp    $0xffffffff,%eax
+     2c2:	74 ba                	je     27e <fault+0xf>
+    for(j = 0; j < 16; j++)
+     2c4:	ba 00 00 00 00       	mov    $0x0,%edx
+     2c9:	eb c8                	jmp    293 <fault+0x24>
+}
+     2cb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     2ce:	5b                   	pop    %ebx
+     2cf:	5e                   	pop    %esi
+     2d0:	5d                   	pop    %ebp
+     2d1:	c3                   	ret
+
+000002d2 <msec>:
+{
+     2d2:	55                   	push   %ebp
+     2d3:	89 e5                	mov    %esp,%ebp
+     2d5:	83 ec 20             	sub    $0x20,%esp
+  vclock_gettime(CLOCK_MONOTONIC, &ts);
+     2d8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     2db:	50                   	push   %eax
+     2dc:	6a 01                	push   $0x1
+     2de:	e8 74 06 00 00       	call   957 <vclock_gettime>
+  return ts.tv_sec*1000 + ts.tv_nsec/1000000;
+     2e3:	69 4d f0 e8 03 00 00 	imul   $0x3e8,-0x10(%ebp),%ecx
+     2ea:	ba 83 de 1b 43       	mov    $0x431bde83,%edx
+     2ef:	89 d0                	mov    %edx,%eax
+     2f1:	f7 65 f4             	mull   -0xc(%ebp)
+     2f4:	c1 ea 12             	shr    $0x12,%edx
+     2f7:	8d 04 11             	lea    (%ecx,%edx,1),%eax
+}
+     2fa:	c9                   	leave
+     2fb:	c3                   	ret
+
+000002fc <trial>:
+};
+
+// Run load k with nw workers and report its throughput.
+static void
+trial(int k, int nw)
+{
+     2fc:	55                   	push   %ebp
+     2fd:	89 e5                	mov    %esp,%ebp
+     2ff:	57                   	push   %edi
+     300:	56                   	push   %esi
+     301:	53                   	push   %ebx
+     302:	83 ec 38             	sub    $0x38,%esp
+     305:	89 c7                	mov    %eax,%edi
+     307:	89 d3                	mov    %edx,%ebx
+  int go[2], w, pid;
+  uint t, ops;
+  char c;
+
+  if(pipe(go) < 0)
+     309:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     30c:	50                   	push   %eax
+     30d:	e8 81 0a 00 00       	call   d93 <pipe>
+     312:	83 c4 10             	add    $0x10,%esp
+     315:	85 c0                	test   %eax,%eax
+     317:	78 1d                	js     336 <trial+0x3a>
+    fail("pipe");
+  for(w = 0; w < nw; w++){
+     319:	be 00 00 00 00       	mov    $0x0,%esi
+     31e:	39 de                	cmp    %ebx,%esi
+     320:	0f 8d a1 00 00 00    	jge    3c7 <trial+0xcb>
+    if((pid = fork()) < 0)
+     326:	e8 3f 09 00 00       	call   c6a <fork>
+     32b:	85 c0                	test   %eax,%eax
+     32d:	78 11                	js     340 <trial+0x44>
+      fail("fork");
+    if(pid == 0){
+     32f:	74 19                	je     34a <trial+0x4e>
+  for(w = 0; w < nw; w++){
+     331:	83 c6 01             	add    $0x1,%esi
+     334:	eb e8                	jmp    31e <trial+0x22>
+    fail("pipe");
+     336:	b8 12 18 00 00       	mov    $0x1812,%eax
+     33b:	e8 c0 fc ff ff       	call   0 <fail>
+      fail("fork");
+     340:	b8 28 18 00 00       	mov    $0x1828,%eax
+     345:	e8 b6 fc ff ff       	call   0 <fail>
+      close(go[1]);
+     34a:	83 ec 0c             	sub    $0xc,%esp
+     34d:	ff 75 e4             	push   -0x1c(%ebp)
+     350:	e8 58 09 00 00       	call   cad <close>
+      if(!spread)
+     355:	83 c4 10             	add    $0x10,%esp
+     358:	83 3d 04 21 00 00 00 	cmpl   $0x0,0x2104
+     35f:	74 36                	je     397 <trial+0x9b>
+        setaffinity(getpid(), 1 << (w % ncpu));
+      if(read(go[0], &c, 1) != 1)
+     361:	83 ec 04             	sub    $0x4,%esp
+     364:	6a 01                	push   $0x1
+     366:	8d 45 df             	lea    -0x21(%ebp),%eax
+     369:	50                   	push   %eax
+     36a:	ff 75 e0             	push   -0x20(%ebp)
+     36d:	e8 30 0a 00 00       	call   da2 <read>
+     372:	83 c4 10             	add    $0x10,%esp
+     375:	83 f8 01             	cmp    $0x1,%eax
+     378:	75 43                	jne    3bd <trial+0xc1>
+        fail("start");
+      loads[k].fn(w, loads[k].n);
+     37a:	8d 04 3f             	lea    (%edi,%edi,1),%eax
+     37d:	8d 14 38             	lea    (%eax,%edi,1),%edx
+     380:	83 ec 08             	sub    $0x8,%esp
+     383:	ff 34 95 88 18 00 00 	push   0x1888(,%edx,4)
+     38a:	56                   	push   %esi
+     38b:	ff 14 95 84 18 00 00 	call   *0x1884(,%edx,4)
+      exit();
+     392:	e8 e7 08 00 00       	call   c7e <exit>
+        setaffinity(getpid(), 1 << (w % ncpu));
+     397:	89 f0                	mov    %esi,%eax
+     399:	99                   	cltd
+     39a:	f7 3d 00 21 00 00    	idivl  0x2100
+     3a0:	bb 01 00 00 00       	mov    $0x1,%ebx
+     3a5:	89 d1                	mov    %edx,%ecx
+     3a7:	d3 e3                	shl    %cl,%ebx
+     3a9:	e8 99 0a 00 00       	call   e47 <getpid>
+     3ae:	83 ec 08             	sub    $0x8,%esp
+     3b1:	53                   	push   %ebx
+     3b2:	50                   	push   %eax
+     3b3:	e8 ac 0b 00 00       	call   f64 <setaffinity>
+     3b8:	83 c4 10             	add    $0x10,%esp
+     3bb:	eb a4                	jmp    361 <trial+0x65>
+        fail("start");
+     3bd:	b8 2d 18 00 00       	mov    $0x182d,%eax
+     3c2:	e8 39 fc ff ff       	call   0 <fail>
+    }
+  }
+  close(go[0]);
+     3c7:	83 ec 0c             	sub    $0xc,%esp
+     3ca:	ff 75 e0             	push   -0x20(%ebp)
+     3cd:	e8 db 08 00 00       	call   cad <close>
+  t = msec();
+     3d2:	e8 fb fe ff ff       	call   2d2 <msec>
+     3d7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  for(w = 0; w < nw; w++)
+     3da:	83 c4 10             	add    $0x10,%esp
+     3dd:	be 00 00 00 00       	mov    $0x0,%esi
+     3e2:	39 de                	cmp    %ebx,%esi
+     3e4:	7d 1a                	jge    400 <trial+0x104>
+    write(go[1], "g", 1);
+     3e6:	83 ec 04             	sub    $0x4,%esp
+     3e9:	6a 01                	push   $0x1
+     3eb:	68 21 18 00 00       	push   $0x1821
+     3f0:	ff 75 e4             	push   -0x1c(%ebp)
+     3f3:	e8 b9 09 00 00       	call   db1 <write>
+  for(w = 0; w < nw; w++)
+     3f8:	83 c6 01             	add    $0x1,%esi
+     3fb:	83 c4 10             	add    $0x10,%esp
+     3fe:	eb e2                	jmp    3e2 <trial+0xe6>
+  close(go[1]);
+     400:	83 ec 0c             	sub    $0xc,%esp
+     403:	ff 75 e4             	push   -0x1c(%ebp)
+     406:	e8 a2 08 00 00       	call   cad <close>
+  for(w = 0; w < nw; w++)
+     40b:	83 c4 10             	add    $0x10,%esp
+     40e:	be 00 00 00 00       	mov    $0x0,%esi
+     413:	39 de                	cmp    %ebx,%esi
+     415:	7d 0a                	jge    421 <trial+0x125>
+    wait();
+     417:	e8 68 09 00 00       	call   d84 <wait>
+  for(w = 0; w < nw; w++)
+     41c:	83 c6 01             	add    $0x1,%esi
+     41f:	eb f2                	jmp    413 <trial+0x117>
+  t = msec() - t;
+     421:	e8 ac fe ff ff       	call   2d2 <msec>
+  if(t == 0)
+     426:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     429:	29 c8                	sub    %ecx,%eax
+     42b:	89 c1                	mov    %eax,%ecx
+     42d:	75 05                	jne    434 <trial+0x138>
+    t = 1;
+     42f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  ops = nw * loads[k].n;
+     434:	8d 34 3f             	lea    (%edi,%edi,1),%esi
+     437:	8d 04 3e             	lea    (%esi,%edi,1),%eax
+     43a:	89 da                	mov    %ebx,%edx
+     43c:	0f af 14 85 88 18 00 	imul   0x1888(,%eax,4),%edx
+     443:	00 
+  printf(1, "scale %s %d %d\n", loads[k].name, nw, ops*1000/t);
+     444:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+     44a:	83 ec 0c             	sub    $0xc,%esp
+     44d:	ba 00 00 00 00       	mov    $0x0,%edx
+     452:	f7 f1                	div    %ecx
+     454:	50                   	push   %eax
+     455:	53                   	push   %ebx
+     456:	01 fe                	add    %edi,%esi
+     458:	ff 34 b5 80 18 00 00 	push   0x1880(,%esi,4)
+     45f:	68 33 18 00 00       	push   $0x1833
+     464:	6a 01                	push   $0x1
+     466:	e8 4c 0d 00 00       	call   11b7 <printf>
+}
+     46b:	83 c4 20             	add    $0x20,%esp
+     46e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     471:	5b                   	pop    %ebx
+     472:	5e                   	pop    %esi
+     473:	5f                   	pop    %edi
+     474:	5d                   	pop    %ebp
+     475:	c3                   	ret
+
+00000476 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     476:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     47a:	83 e4 f0             	and    $0xfffffff0,%esp
+     47d:	ff 71 fc             	push   -0x4(%ecx)
+     480:	55                   	push   %ebp
+     481:	89 e5                	mov    %esp,%ebp
+     483:	57                   	push   %edi
+     484:	56                   	push   %esi
+     485:	53                   	push   %ebx
+     486:	51                   	push   %ecx
+     487:	81 ec 58 02 00 00    	sub    $0x258,%esp
+     48d:	8b 39                	mov    (%ecx),%edi
+     48f:	8b 41 04             	mov    0x4(%ecx),%eax
+     492:	89 85 a4 fd ff ff    	mov    %eax,-0x25c(%ebp)
+  struct cpuinfo ci;
+  char buf[512];
+  int i, j, k, nw, fd, named;
+
+  i = 1;
+  if(argc > 1 && strcmp(argv[1], "-s") == 0){
+     498:	83 ff 01             	cmp    $0x1,%edi
+     49b:	7f 23                	jg     4c0 <main+0x4a>
+  i = 1;
+     49d:	c7 85 a0 fd ff ff 01 	movl   $0x1,-0x260(%ebp)
+     4a4:	00 00 00 
+    spread = 1;
+    i++;
+  }
+  named = i < argc;
+     4a7:	39 bd a0 fd ff ff    	cmp    %edi,-0x260(%ebp)
+     4ad:	0f 9c 85 9f fd ff ff 	setl   -0x261(%ebp)
+  for(ncpu = 0; getcpuinfo(ncpu, &ci) == 0; ncpu++)
+     4b4:	c7 05 00 21 00 00 00 	movl   $0x0,0x2100
+     4bb:	00 00 00 
+     4be:	eb 40                	jmp    500 <main+0x8a>
+  if(argc > 1 && strcmp(argv[1], "-s") == 0){
+     4c0:	83 ec 08             	sub    $0x8,%esp
+     4c3:	68 43 18 00 00       	push   $0x1843
+     4c8:	ff 70 04             	push   0x4(%eax)
+     4cb:	e8 9c 01 00 00       	call   66c <strcmp>
+     4d0:	83 c4 10             	add    $0x10,%esp
+     4d3:	85 c0                	test   %eax,%eax
+     4d5:	75 16                	jne    4ed <main+0x77>
+    spread = 1;
+     4d7:	c7 05 04 21 00 00 01 	movl   $0x1,0x2104
+     4de:	00 00 00 
+    i++;
+     4e1:	c7 85 a0 fd ff ff 02 	movl   $0x2,-0x260(%ebp)
+     4e8:	00 00 00 
+     4eb:	eb ba                	jmp    4a7 <main+0x31>
+  i = 1;
+     4ed:	c7 85 a0 fd ff ff 01 	movl   $0x1,-0x260(%ebp)
+     4f4:	00 00 00 
+     4f7:	eb ae                	jmp    4a7 <main+0x31>
+  for(ncpu = 0; getcpuinfo(ncpu, &ci) == 0; ncpu++)
+     4f9:	83 05 00 21 00 00 01 	addl   $0x1,0x2100
+     500:	83 ec 08             	sub    $0x8,%esp
+     503:	8d 45 ac             	lea    -0x54(%ebp),%eax
+     506:	50                   	push   %eax
+     507:	ff 35 00 21 00 00    	push   0x2100
+     50d:	e8 07 0a 00 00       	call   f19 <getcpuinfo>
+     512:	83 c4 10             	add    $0x10,%esp
+     515:	85 c0                	test   %eax,%eax
+     517:	74 e0                	je     4f9 <main+0x83>
+    ;
+
+  memset(buf, 's', sizeof(buf));
+     519:	83 ec 04             	sub    $0x4,%esp
+     51c:	68 00 02 00 00       	push   $0x200
+     521:	6a 73                	push   $0x73
+     523:	8d 85 ac fd ff ff    	lea    -0x254(%ebp),%eax
+     529:	50                   	push   %eax
+     52a:	e8 a8 01 00 00       	call   6d7 <memset>
+  if((fd = open("scalef", O_CREATE|O_RDWR)) < 0)
+     52f:	83 c4 08             	add    $0x8,%esp
+     532:	68 02 02 00 00       	push   $0x202
+     537:	68 00 18 00 00       	push   $0x1800
+     53c:	e8 8e 08 00 00       	call   dcf <open>
+     541:	89 c6                	mov    %eax,%esi
+     543:	83 c4 10             	add    $0x10,%esp
+     546:	85 c0                	test   %eax,%eax
+     548:	78 34                	js     57e <main+0x108>
+    fail("create");
+  for(j = 0; j < SHAREDSZ; j += sizeof(buf))
+     54a:	bb 00 00 00 00       	mov    $0x0,%ebx
+     54f:	81 fb ff ff 00 00    	cmp    $0xffff,%ebx
+     555:	7f 3b                	jg     592 <main+0x11c>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf))
+     557:	83 ec 04             	sub    $0x4,%esp
+     55a:	68 00 02 00 00       	push   $0x200
+     55f:	8d 85 ac fd ff ff    	lea    -0x254(%ebp),%eax
+     565:	50                   	push   %eax
+     566:	56                   	push   %esi
+     567:	e8 45 08 00 00       	call   db1 <write>
+     56c:	83 c4 10             	add    $0x10,%esp
+     56f:	3d 00 02 00 00       	cmp    $0x200,%eax
+     574:	75 12                	jne    588 <main+0x112>
+  for(j = 0; j < SHAREDSZ; j += sizeof(buf))
+     576:	81 c3 00 02 00 00    	add    $0x200,%ebx
+     57c:	eb d1                	jmp    54f <main+0xd9>
+    fail("create");
+     57e:	b8 f2 17 00 00       	mov    $0x17f2,%eax
+     583:	e8 78 fa ff ff       	call   0 <fail>
+      fail("write");
+     588:	b8 46 18 00 00       	mov    $0x1846,%eax
+     58d:	e8 6e fa ff ff       	call   0 <fail>
+  close(fd);
+     592:	83 ec 0c             	sub    $0xc,%esp
+     595:	56                   	push   %esi
+     596:	e8 12 07 00 00       	call   cad <close>
+
+  printf(1, "scale cpus %d\n", ncpu);
+     59b:	83 c4 0c             	add    $0xc,%esp
+     59e:	ff 35 00 21 00 00    	push   0x2100
+     5a4:	68 4c 18 00 00       	push   $0x184c
+     5a9:	6a 01                	push   $0x1
+     5ab:	e8 07 0c 00 00       	call   11b7 <printf>
+  for(k = 0; k < sizeof(loads)/sizeof(loads[0]); k++){
+     5b0:	83 c4 10             	add    $0x10,%esp
+     5b3:	be 00 00 00 00       	mov    $0x0,%esi
+     5b8:	eb 39                	jmp    5f3 <main+0x17d>
+    for(j = i; j < argc && strcmp(argv[j], loads[k].name) != 0; j++)
+     5ba:	83 c3 01             	add    $0x1,%ebx
+     5bd:	39 fb                	cmp    %edi,%ebx
+     5bf:	7d 22                	jge    5e3 <main+0x16d>
+     5c1:	8d 04 76             	lea    (%esi,%esi,2),%eax
+     5c4:	83 ec 08             	sub    $0x8,%esp
+     5c7:	ff 34 85 80 18 00 00 	push   0x1880(,%eax,4)
+     5ce:	8b 85 a4 fd ff ff    	mov    -0x25c(%ebp),%eax
+     5d4:	ff 34 98             	push   (%eax,%ebx,4)
+     5d7:	e8 90 00 00 00       	call   66c <strcmp>
+     5dc:	83 c4 10             	add    $0x10,%esp
+     5df:	85 c0                	test   %eax,%eax
+     5e1:	75 d7                	jne    5ba <main+0x144>
+      ;
+    if(named && j == argc)
+     5e3:	39 fb                	cmp    %edi,%ebx
+     5e5:	0f 94 c0             	sete   %al
+     5e8:	84 85 9f fd ff ff    	test   %al,-0x261(%ebp)
+     5ee:	74 10                	je     600 <main+0x18a>
+  for(k = 0; k < sizeof(loads)/sizeof(loads[0]); k++){
+     5f0:	83 c6 01             	add    $0x1,%esi
+     5f3:	83 fe 03             	cmp    $0x3,%esi
+     5f6:	77 2d                	ja     625 <main+0x1af>
+    for(j = i; j < argc && strcmp(argv[j], loads[k].name) != 0; j++)
+     5f8:	8b 9d a0 fd ff ff    	mov    -0x260(%ebp),%ebx
+     5fe:	eb bd                	jmp    5bd <main+0x147>
+      continue;
+    for(nw = 1; nw < ncpu; nw *= 2)
+     600:	bb 01 00 00 00       	mov    $0x1,%ebx
+     605:	eb 0b                	jmp    612 <main+0x19c>
+      trial(k, nw);
+     607:	89 da                	mov    %ebx,%edx
+     609:	89 f0                	mov    %esi,%eax
+     60b:	e8 ec fc ff ff       	call   2fc <trial>
+    for(nw = 1; nw < ncpu; nw *= 2)
+     610:	01 db                	add    %ebx,%ebx
+     612:	8b 15 00 21 00 00    	mov    0x2100,%edx
+     618:	39 da                	cmp    %ebx,%edx
+     61a:	7f eb                	jg     607 <main+0x191>
+    trial(k, ncpu);
+     61c:	89 f0                	mov    %esi,%eax
+     61e:	e8 d9 fc ff ff       	call   2fc <trial>
+     623:	eb cb                	jmp    5f0 <main+0x17a>
+  }
+  unlink("scalef");
+     625:	83 ec 0c             	sub    $0xc,%esp
+     628:	68 00 18 00 00       	push   $0x1800
+     62d:	e8 bb 07 00 00       	call   ded <unlink>
+  printf(1, "scale done\n");
+     632:	83 c4 08             	add    $0x8,%esp
+     635:	68 5b 18 00 00       	push   $0x185b
+     63a:	6a 01                	push   $0x1
+     63c:	e8 76 0b 00 00       	call   11b7 <printf>
+  exit();
+     641:	e8 38 06 00 00       	call   c7e <exit>
+
+00000646 <strcpy>:
+#include "memlayout.h"
+#include "clock.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     646:	55                   	push   %ebp
+     647:	89 e5                	mov    %esp,%ebp
+     649:	56                   	push   %esi
+     64a:	53                   	push   %ebx
+     64b:	8b 75 08             	mov    0x8(%ebp),%esi
+     64e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     651:	89 f0                	mov    %esi,%eax
+     653:	89 d1                	mov    %edx,%ecx
+     655:	83 c2 01             	add    $0x1,%edx
+     658:	89 c3                	mov    %eax,%ebx
+     65a:	83 c0 01             	add    $0x1,%eax
+     65d:	0f b6 09             	movzbl (%ecx),%ecx
+     660:	88 0b                	mov    %cl,(%ebx)
+     662:	84 c9                	test   %cl,%cl
+     664:	75 ed                	jne    653 <strcpy+0xd>
+    ;
+  return os;
+}
+     666:	89 f0                	mov    %esi,%eax
+     668:	5b                   	pop    %ebx
+     669:	5e                   	pop    %esi
+     66a:	5d                   	pop    %ebp
+     66b:	c3                   	ret
+
+0000066c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     66c:	55                   	push   %ebp
+     66d:	89 e5                	mov    %esp,%ebp
+     66f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     672:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+     675:	eb 06                	jmp    67d <strcmp+0x11>
+    p++, q++;
+     677:	83 c1 01             	add    $0x1,%ecx
+     67a:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+     67d:	0f b6 01             	movzbl (%ecx),%eax
+     680:	84 c0                	test   %al,%al
+     682:	74 04                	je     688 <strcmp+0x1c>
+     684:	3a 02                	cmp    (%edx),%al
+     686:	74 ef                	je     677 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+     688:	0f b6 c0             	movzbl %al,%eax
+     68b:	0f b6 12             	movzbl (%edx),%edx
+     68e:	29 d0                	sub    %edx,%eax
+}
+     690:	5d                   	pop    %ebp
+     691:	c3                   	ret
+
+00000692 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     692:	55                   	push   %ebp
+     693:	89 e5                	mov    %esp,%ebp
+     695:	53                   	push   %ebx
+     696:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  const char *p;
+  uint w;
+
+  for(p = s; (uint)p & 3; p++)
+     699:	89 c8                	mov    %ecx,%eax
+     69b:	eb 03                	jmp    6a0 <strlen+0xe>
+     69d:	83 c0 01             	add    $0x1,%eax
+     6a0:	a8 03                	test   $0x3,%al
+     6a2:	74 09                	je     6ad <strlen+0x1b>
+    if(*p == 0)
+     6a4:	80 38 00             	cmpb   $0x0,(%eax)
+     6a7:	75 f4                	jne    69d <strlen+0xb>
+      return p - s;
+     6a9:	29 c8                	sub    %ecx,%eax
+     6ab:	eb 25                	jmp    6d2 <strlen+0x40>
+  // Then a word at a time, which never crosses into the next page:
+  // a word with a zero byte in it has one of these bits set.
+  for(;; p += 4){
+    w = *(uint*)p;
+     6ad:	8b 10                	mov    (%eax),%edx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     6af:	8d 9a ff fe fe fe    	lea    -0x1010101(%edx),%ebx
+     6b5:	f7 d2                	not    %edx
+     6b7:	21 da                	and    %ebx,%edx
+     6b9:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+     6bf:	75 05                	jne    6c6 <strlen+0x34>
+  for(;; p += 4){
+     6c1:	83 c0 04             	add    $0x4,%eax
+    w = *(uint*)p;
+     6c4:	eb e7                	jmp    6ad <strlen+0x1b>
+      break;
+  }
+  while(*p)
+     6c6:	80 38 00             	cmpb   $0x0,(%eax)
+     6c9:	74 05                	je     6d0 <strlen+0x3e>
+    p++;
+     6cb:	83 c0 01             	add    $0x1,%eax
+     6ce:	eb f6                	jmp    6c6 <strlen+0x34>
+  return p - s;
+     6d0:	29 c8                	sub    %ecx,%eax
+}
+     6d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6d5:	c9                   	leave
+     6d6:	c3                   	ret
+
+000006d7 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     6d7:	55                   	push   %ebp
+     6d8:	89 e5                	mov    %esp,%ebp
+     6da:	57                   	push   %edi
+     6db:	56                   	push   %esi
+     6dc:	53                   	push   %ebx
+     6dd:	8b 55 10             	mov    0x10(%ebp),%edx
+  uint h;
+  char *d;
+
+  d = dst;
+  c &= 0xFF;
+     6e0:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  if(n >= 16){
+     6e4:	83 fa 0f             	cmp    $0xf,%edx
+     6e7:	76 52                	jbe    73b <memset+0x64>
+    h = -(uint)d & 3;
+     6e9:	8b 45 08             	mov    0x8(%ebp),%eax
+     6ec:	f7 d8                	neg    %eax
+     6ee:	83 e0 03             	and    $0x3,%eax
+     6f1:	89 c6                	mov    %eax,%esi
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     6f3:	8b 7d 08             	mov    0x8(%ebp),%edi
+     6f6:	89 c1                	mov    %eax,%ecx
+     6f8:	89 d8                	mov    %ebx,%eax
+     6fa:	fc                   	cld
+     6fb:	f3 aa                	rep stos %al,%es:(%edi)
+    stosb(d, c, h);
+    stosl(d + h, (c<<24)|(c<<16)|(c<<8)|c, (n - h)/4);
+     6fd:	29 f2                	sub    %esi,%edx
+     6ff:	89 d1                	mov    %edx,%ecx
+     701:	c1 e9 02             	shr    $0x2,%ecx
+     704:	c1 e0 18             	shl    $0x18,%eax
+     707:	89 df                	mov    %ebx,%edi
+     709:	c1 e7 10             	shl    $0x10,%edi
+     70c:	09 f8                	or     %edi,%eax
+     70e:	89 df                	mov    %ebx,%edi
+     710:	c1 e7 08             	shl    $0x8,%edi
+     713:	09 f8                	or     %edi,%eax
+     715:	09 d8                	or     %ebx,%eax
+     717:	89 f7                	mov    %esi,%edi
+     719:	03 7d 08             	add    0x8(%ebp),%edi
+}
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosl" :
+     71c:	fc                   	cld
+     71d:	f3 ab                	rep stos %eax,%es:(%edi)
+    d += h + (n - h)/4*4;
+     71f:	89 d7                	mov    %edx,%edi
+     721:	83 e7 fc             	and    $0xfffffffc,%edi
+     724:	09 f7                	or     %esi,%edi
+     726:	03 7d 08             	add    0x8(%ebp),%edi
+    n = (n - h)%4;
+     729:	83 e2 03             	and    $0x3,%edx
+  asm volatile("cld; rep stosb" :
+     72c:	89 d1                	mov    %edx,%ecx
+     72e:	89 d8                	mov    %ebx,%eax
+     730:	fc                   	cld
+     731:	f3 aa                	rep stos %al,%es:(%edi)
+  }
+  stosb(d, c, n);
+  return dst;
+}
+     733:	8b 45 08             	mov    0x8(%ebp),%eax
+     736:	5b                   	pop    %ebx
+     737:	5e                   	pop    %esi
+     738:	5f                   	pop    %edi
+     739:	5d                   	pop    %ebp
+     73a:	c3                   	ret
+  d = dst;
+     73b:	8b 7d 08             	mov    0x8(%ebp),%edi
+     73e:	eb ec                	jmp    72c <memset+0x55>
+
+00000740 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     740:	55                   	push   %ebp
+     741:	89 e5                	mov    %esp,%ebp
+     743:	8b 45 08             	mov    0x8(%ebp),%eax
+     746:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     74a:	eb 03                	jmp    74f <strchr+0xf>
+     74c:	83 c0 01             	add    $0x1,%eax
+     74f:	0f b6 10             	movzbl (%eax),%edx
+     752:	84 d2                	test   %dl,%dl
+     754:	74 06                	je     75c <strchr+0x1c>
+    if(*s == c)
+     756:	38 ca                	cmp    %cl,%dl
+     758:	75 f2                	jne    74c <strchr+0xc>
+     75a:	eb 05                	jmp    761 <strchr+0x21>
+      return (char*)s;
+  return 0;
+     75c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     761:	5d                   	pop    %ebp
+     762:	c3                   	ret
+
+00000763 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     763:	55                   	push   %ebp
+     764:	89 e5                	mov    %esp,%ebp
+     766:	56                   	push   %esi
+     767:	53                   	push   %ebx
+     768:	8b 55 08             	mov    0x8(%ebp),%edx
+     76b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     76e:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  // A word at a time while they agree.
+  if((((uint)s1 | (uint)s2) & 3) == 0)
+     771:	89 d3                	mov    %edx,%ebx
+     773:	09 cb                	or     %ecx,%ebx
+     775:	f6 c3 03             	test   $0x3,%bl
+     778:	74 24                	je     79e <memcmp+0x3b>
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+      s1 += 4, s2 += 4;
+  while(n-- > 0){
+     77a:	8d 70 ff             	lea    -0x1(%eax),%esi
+     77d:	85 c0                	test   %eax,%eax
+     77f:	74 32                	je     7b3 <memcmp+0x50>
+    if(*s1 != *s2)
+     781:	0f b6 02             	movzbl (%edx),%eax
+     784:	0f b6 19             	movzbl (%ecx),%ebx
+     787:	38 d8                	cmp    %bl,%al
+     789:	75 20                	jne    7ab <memcmp+0x48>
+      return *s1 - *s2;
+    s1++, s2++;
+     78b:	83 c2 01             	add    $0x1,%edx
+     78e:	83 c1 01             	add    $0x1,%ecx
+  while(n-- > 0){
+     791:	89 f0                	mov    %esi,%eax
+     793:	eb e5                	jmp    77a <memcmp+0x17>
+      s1 += 4, s2 += 4;
+     795:	83 c2 04             	add    $0x4,%edx
+     798:	83 c1 04             	add    $0x4,%ecx
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+     79b:	83 e8 04             	sub    $0x4,%eax
+     79e:	83 f8 03             	cmp    $0x3,%eax
+     7a1:	76 d7                	jbe    77a <memcmp+0x17>
+     7a3:	8b 31                	mov    (%ecx),%esi
+     7a5:	39 32                	cmp    %esi,(%edx)
+     7a7:	74 ec                	je     795 <memcmp+0x32>
+     7a9:	eb cf                	jmp    77a <memcmp+0x17>
+      return *s1 - *s2;
+     7ab:	0f b6 c0             	movzbl %al,%eax
+     7ae:	0f b6 db             	movzbl %bl,%ebx
+     7b1:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     7b3:	5b                   	pop    %ebx
+     7b4:	5e                   	pop    %esi
+     7b5:	5d                   	pop    %ebp
+     7b6:	c3                   	ret
+
+000007b7 <memchr>:
+// The first c in the n bytes at v, or 0.  Once aligned, a word at
+// a time, with the word's bytes that equal c turned into zeroes
+// and those looked for.
+void*
+memchr(const void *v, int c, uint n)
+{
+     7b7:	55                   	push   %ebp
+     7b8:	89 e5                	mov    %esp,%ebp
+     7ba:	57                   	push   %edi
+     7bb:	56                   	push   %esi
+     7bc:	53                   	push   %ebx
+     7bd:	8b 45 08             	mov    0x8(%ebp),%eax
+     7c0:	8b 55 10             	mov    0x10(%ebp),%edx
+  const uchar *s;
+  uint w, rep;
+
+  s = v;
+  c = (uchar)c;
+     7c3:	0f b6 75 0c          	movzbl 0xc(%ebp),%esi
+  for(; n > 0 && ((uint)s & 3); n--, s++)
+     7c7:	eb 06                	jmp    7cf <memchr+0x18>
+     7c9:	83 ea 01             	sub    $0x1,%edx
+     7cc:	83 c0 01             	add    $0x1,%eax
+     7cf:	85 d2                	test   %edx,%edx
+     7d1:	74 0d                	je     7e0 <memchr+0x29>
+     7d3:	a8 03                	test   $0x3,%al
+     7d5:	74 09                	je     7e0 <memchr+0x29>
+    if(*s == c)
+     7d7:	0f b6 08             	movzbl (%eax),%ecx
+     7da:	39 f1                	cmp    %esi,%ecx
+     7dc:	75 eb                	jne    7c9 <memchr+0x12>
+     7de:	eb 41                	jmp    821 <memchr+0x6a>
+      return (void*)s;
+  rep = c * 0x01010101;
+     7e0:	69 fe 01 01 01 01    	imul   $0x1010101,%esi,%edi
+  for(; n >= 4; n -= 4, s += 4){
+     7e6:	eb 06                	jmp    7ee <memchr+0x37>
+     7e8:	83 ea 04             	sub    $0x4,%edx
+     7eb:	83 c0 04             	add    $0x4,%eax
+     7ee:	83 fa 03             	cmp    $0x3,%edx
+     7f1:	76 16                	jbe    809 <memchr+0x52>
+    w = *(uint*)s ^ rep;
+     7f3:	89 f9                	mov    %edi,%ecx
+     7f5:	33 08                	xor    (%eax),%ecx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     7f7:	8d 99 ff fe fe fe    	lea    -0x1010101(%ecx),%ebx
+     7fd:	f7 d1                	not    %ecx
+     7ff:	21 cb                	and    %ecx,%ebx
+     801:	f7 c3 80 80 80 80    	test   $0x80808080,%ebx
+     807:	74 df                	je     7e8 <memchr+0x31>
+      break;
+  }
+  for(; n > 0; n--, s++)
+     809:	85 d2                	test   %edx,%edx
+     80b:	74 0f                	je     81c <memchr+0x65>
+    if(*s == c)
+     80d:	0f b6 08             	movzbl (%eax),%ecx
+     810:	39 f1                	cmp    %esi,%ecx
+     812:	74 0d                	je     821 <memchr+0x6a>
+  for(; n > 0; n--, s++)
+     814:	83 ea 01             	sub    $0x1,%edx
+     817:	83 c0 01             	add    $0x1,%eax
+     81a:	eb ed                	jmp    809 <memchr+0x52>
+      return (void*)s;
+  return 0;
+     81c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     821:	5b                   	pop    %ebx
+     822:	5e                   	pop    %esi
+     823:	5f                   	pop    %edi
+     824:	5d                   	pop    %ebp
+     825:	c3                   	ret
+
+00000826 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     826:	55                   	push   %ebp
+     827:	89 e5                	mov    %esp,%ebp
+     829:	57                   	push   %edi
+     82a:	56                   	push   %esi
+     82b:	53                   	push   %ebx
+     82c:	83 ec 1c             	sub    $0x1c,%esp
+     82f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     832:	bb 00 00 00 00       	mov    $0x0,%ebx
+     837:	89 de                	mov    %ebx,%esi
+     839:	83 c3 01             	add    $0x1,%ebx
+     83c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     83f:	7d 2e                	jge    86f <gets+0x49>
+    cc = read(0, &c, 1);
+     841:	83 ec 04             	sub    $0x4,%esp
+     844:	6a 01                	push   $0x1
+     846:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     849:	50                   	push   %eax
+     84a:	6a 00                	push   $0x0
+     84c:	e8 51 05 00 00       	call   da2 <read>
+    if(cc < 1)
+     851:	83 c4 10             	add    $0x10,%esp
+     854:	85 c0                	test   %eax,%eax
+     856:	7e 17                	jle    86f <gets+0x49>
+      break;
+    buf[i++] = c;
+     858:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     85c:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+     85f:	3c 0a                	cmp    $0xa,%al
+     861:	0f 94 c2             	sete   %dl
+     864:	3c 0d                	cmp    $0xd,%al
+     866:	0f 94 c0             	sete   %al
+     869:	08 c2                	or     %al,%dl
+     86b:	74 ca                	je     837 <gets+0x11>
+    buf[i++] = c;
+     86d:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+     86f:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+     873:	89 f8                	mov    %edi,%eax
+     875:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     878:	5b                   	pop    %ebx
+     879:	5e                   	pop    %esi
+     87a:	5f                   	pop    %edi
+     87b:	5d                   	pop    %ebp
+     87c:	c3                   	ret
+
+0000087d <atoi>:
+  return r;
+}
+
+int
+atoi(const char *s)
+{
+     87d:	55                   	push   %ebp
+     87e:	89 e5                	mov    %esp,%ebp
+     880:	53                   	push   %ebx
+     881:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+     884:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+     889:	eb 10                	jmp    89b <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+     88b:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+     88e:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+     891:	83 c1 01             	add    $0x1,%ecx
+     894:	0f be c0             	movsbl %al,%eax
+     897:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+     89b:	0f b6 01             	movzbl (%ecx),%eax
+     89e:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     8a1:	80 fb 09             	cmp    $0x9,%bl
+     8a4:	76 e5                	jbe    88b <atoi+0xe>
+  return n;
+}
+     8a6:	89 d0                	mov    %edx,%eax
+     8a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     8ab:	c9                   	leave
+     8ac:	c3                   	ret
+
+000008ad <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     8ad:	55                   	push   %ebp
+     8ae:	89 e5                	mov    %esp,%ebp
+     8b0:	57                   	push   %edi
+     8b1:	56                   	push   %esi
+     8b2:	53                   	push   %ebx
+     8b3:	83 ec 08             	sub    $0x8,%esp
+     8b6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     8b9:	8b 55 0c             	mov    0xc(%ebp),%edx
+     8bc:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *src;
+  int h;
+
+  dst = vdst;
+  src = vsrc;
+  if(n <= 0)
+     8bf:	85 c0                	test   %eax,%eax
+     8c1:	0f 8e 82 00 00 00    	jle    949 <memmove+0x9c>
+    return vdst;
+  if(src < dst && src + n > dst){
+     8c7:	39 da                	cmp    %ebx,%edx
+     8c9:	73 07                	jae    8d2 <memmove+0x25>
+     8cb:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+     8ce:	39 cb                	cmp    %ecx,%ebx
+     8d0:	72 5e                	jb     930 <memmove+0x83>
+    movsbback(dst + n - 1, src + n - 1, n);
+    return vdst;
+  }
+  if(n >= 16 && (((uint)dst ^ (uint)src) & 3) == 0){
+     8d2:	83 f8 0f             	cmp    $0xf,%eax
+     8d5:	7e 69                	jle    940 <memmove+0x93>
+     8d7:	89 d9                	mov    %ebx,%ecx
+     8d9:	31 d1                	xor    %edx,%ecx
+     8db:	f6 c1 03             	test   $0x3,%cl
+     8de:	75 73                	jne    953 <memmove+0xa6>
+    h = -(uint)dst & 3;
+     8e0:	89 d9                	mov    %ebx,%ecx
+     8e2:	f7 d9                	neg    %ecx
+     8e4:	83 e1 03             	and    $0x3,%ecx
+}
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsb" :
+     8e7:	89 df                	mov    %ebx,%edi
+     8e9:	89 d6                	mov    %edx,%esi
+     8eb:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+     8ee:	fc                   	cld
+     8ef:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    movsb(dst, src, h);
+    dst += h, src += h, n -= h;
+     8f1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+     8f4:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+     8f7:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+     8fa:	29 f0                	sub    %esi,%eax
+    movsl(dst, src, n/4);
+     8fc:	8d 50 03             	lea    0x3(%eax),%edx
+     8ff:	0f 49 d0             	cmovns %eax,%edx
+     902:	c1 fa 02             	sar    $0x2,%edx
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+     905:	89 7d f0             	mov    %edi,-0x10(%ebp)
+     908:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     90b:	89 ce                	mov    %ecx,%esi
+     90d:	89 d1                	mov    %edx,%ecx
+     90f:	fc                   	cld
+     910:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    dst += n/4*4, src += n/4*4, n %= 4;
+     912:	c1 e2 02             	shl    $0x2,%edx
+     915:	8b 7d f0             	mov    -0x10(%ebp),%edi
+     918:	01 d7                	add    %edx,%edi
+     91a:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     91d:	01 ca                	add    %ecx,%edx
+     91f:	89 c6                	mov    %eax,%esi
+     921:	c1 fe 1f             	sar    $0x1f,%esi
+     924:	c1 ee 1e             	shr    $0x1e,%esi
+     927:	01 f0                	add    %esi,%eax
+     929:	83 e0 03             	and    $0x3,%eax
+     92c:	29 f0                	sub    %esi,%eax
+     92e:	eb 12                	jmp    942 <memmove+0x95>
+    movsbback(dst + n - 1, src + n - 1, n);
+     930:	8d 78 ff             	lea    -0x1(%eax),%edi
+     933:	8d 34 3a             	lea    (%edx,%edi,1),%esi
+     936:	01 df                	add    %ebx,%edi
+// Copy cnt bytes down from the last ones, at dst and src, to the
+// first: for overlapping moves up.
+static inline void
+movsbback(void *dst, const void *src, int cnt)
+{
+  asm volatile("std; rep movsb; cld" :
+     938:	89 c1                	mov    %eax,%ecx
+     93a:	fd                   	std
+     93b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     93d:	fc                   	cld
+    return vdst;
+     93e:	eb 09                	jmp    949 <memmove+0x9c>
+  dst = vdst;
+     940:	89 df                	mov    %ebx,%edi
+  asm volatile("cld; rep movsb" :
+     942:	89 d6                	mov    %edx,%esi
+     944:	89 c1                	mov    %eax,%ecx
+     946:	fc                   	cld
+     947:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  }
+  movsb(dst, src, n);
+  return vdst;
+}
+     949:	89 d8                	mov    %ebx,%eax
+     94b:	83 c4 08             	add    $0x8,%esp
+     94e:	5b                   	pop    %ebx
+     94f:	5e                   	pop    %esi
+     950:	5f                   	pop    %edi
+     951:	5d                   	pop    %ebp
+     952:	c3                   	ret
+  dst = vdst;
+     953:	89 df                	mov    %ebx,%edi
+     955:	eb eb                	jmp    942 <memmove+0x95>
+
+00000957 <vclock_gettime>:
+
+// clock_gettime() without a system call: read the clock page
+// that the kernel maps at CLOCKPAGE (see clock.h).
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+     957:	55                   	push   %ebp
+     958:	89 e5                	mov    %esp,%ebp
+     95a:	57                   	push   %edi
+     95b:	56                   	push   %esi
+     95c:	53                   	push   %ebx
+     95d:	83 ec 14             	sub    $0x14,%esp
+  struct clockpage *cp = (struct clockpage*)CLOCKPAGE;
+  uint seq, rem, d;
+  uint64 tsc, ns, now;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+     960:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     964:	0f 87 a3 00 00 00    	ja     a0d <vclock_gettime+0xb6>
+    return -1;
+  do {
+    seq = cp->seq;
+     96a:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+    __sync_synchronize();
+     96f:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    tsc = cp->tsc;
+     974:	8b 15 10 f0 ff 7f    	mov    0x7ffff010,%edx
+     97a:	8b 1d 14 f0 ff 7f    	mov    0x7ffff014,%ebx
+    ns = cp->ns;
+     980:	8b 35 18 f0 ff 7f    	mov    0x7ffff018,%esi
+     986:	8b 3d 1c f0 ff 7f    	mov    0x7ffff01c,%edi
+    __sync_synchronize();
+     98c:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != cp->seq);
+     991:	89 c1                	mov    %eax,%ecx
+     993:	83 e1 01             	and    $0x1,%ecx
+     996:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     999:	75 cf                	jne    96a <vclock_gettime+0x13>
+     99b:	8b 0d 00 f0 ff 7f    	mov    0x7ffff000,%ecx
+     9a1:	39 c1                	cmp    %eax,%ecx
+     9a3:	75 c5                	jne    96a <vclock_gettime+0x13>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+     9a5:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     9a8:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     9ab:	0f 31                	rdtsc
+     9ad:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     9b0:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     9b3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  now = rdtsc();
+  // Less than a tick has passed since the update, so the delta
+  // fits in 32 bits.
+  d = now > tsc ? now - tsc : 0;
+     9b6:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     9b9:	19 d3                	sbb    %edx,%ebx
+     9bb:	73 07                	jae    9c4 <vclock_gettime+0x6d>
+     9bd:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+     9c0:	29 d8                	sub    %ebx,%eax
+     9c2:	89 c1                	mov    %eax,%ecx
+  ns += ((uint64)d * cp->mult) >> cp->shift;
+     9c4:	89 c8                	mov    %ecx,%eax
+     9c6:	f7 25 04 f0 ff 7f    	mull   0x7ffff004
+     9cc:	0f b6 0d 08 f0 ff 7f 	movzbl 0x7ffff008,%ecx
+     9d3:	0f ad d0             	shrd   %cl,%edx,%eax
+     9d6:	d3 ea                	shr    %cl,%edx
+     9d8:	f6 c1 20             	test   $0x20,%cl
+     9db:	74 04                	je     9e1 <vclock_gettime+0x8a>
+     9dd:	89 d0                	mov    %edx,%eax
+     9df:	31 d2                	xor    %edx,%edx
+     9e1:	01 f0                	add    %esi,%eax
+     9e3:	11 fa                	adc    %edi,%edx
+static inline uint
+divl(uint64 n, uint d, uint *r)
+{
+  uint q;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (*r) :
+     9e5:	bb 00 ca 9a 3b       	mov    $0x3b9aca00,%ebx
+     9ea:	f7 f3                	div    %ebx
+  ts->tv_sec = divl(ns, 1000000000, &rem);
+     9ec:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     9ef:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = rem;
+     9f1:	89 57 04             	mov    %edx,0x4(%edi)
+  if(clk == CLOCK_REALTIME)
+     9f4:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     9f8:	75 1a                	jne    a14 <vclock_gettime+0xbd>
+    ts->tv_sec += cp->boottime;
+     9fa:	03 05 0c f0 ff 7f    	add    0x7ffff00c,%eax
+     a00:	89 07                	mov    %eax,(%edi)
+  return 0;
+     a02:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     a05:	83 c4 14             	add    $0x14,%esp
+     a08:	5b                   	pop    %ebx
+     a09:	5e                   	pop    %esi
+     a0a:	5f                   	pop    %edi
+     a0b:	5d                   	pop    %ebp
+     a0c:	c3                   	ret
+    return -1;
+     a0d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     a12:	eb f1                	jmp    a05 <vclock_gettime+0xae>
+  return 0;
+     a14:	b8 00 00 00 00       	mov    $0x0,%eax
+     a19:	eb ea                	jmp    a05 <vclock_gettime+0xae>
+
+00000a1b <flush>:
+
+// Write out fd's buffer, or with fd < 0 every buffer.
+// Returns -1 if a write fails.
+int
+flush(int fd)
+{
+     a1b:	55                   	push   %ebp
+     a1c:	89 e5                	mov    %esp,%ebp
+     a1e:	56                   	push   %esi
+     a1f:	53                   	push   %ebx
+     a20:	8b 45 08             	mov    0x8(%ebp),%eax
+  int r, n;
+
+  if(fd < 0){
+     a23:	85 c0                	test   %eax,%eax
+     a25:	78 5d                	js     a84 <flush+0x69>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+      if(flush(fd) < 0)
+        r = -1;
+    return r;
+  }
+  if(fd >= NOBUF || (n = obuf[fd].n) == 0)
+     a27:	83 f8 0f             	cmp    $0xf,%eax
+     a2a:	7f 64                	jg     a90 <flush+0x75>
+     a2c:	69 d0 08 02 00 00    	imul   $0x208,%eax,%edx
+     a32:	8b b2 24 21 00 00    	mov    0x2124(%edx),%esi
+     a38:	85 f6                	test   %esi,%esi
+     a3a:	74 59                	je     a95 <flush+0x7a>
+    return 0;
+  obuf[fd].n = 0;
+     a3c:	c7 82 24 21 00 00 00 	movl   $0x0,0x2124(%edx)
+     a43:	00 00 00 
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     a46:	81 c2 28 21 00 00    	add    $0x2128,%edx
+     a4c:	83 ec 04             	sub    $0x4,%esp
+     a4f:	56                   	push   %esi
+     a50:	52                   	push   %edx
+     a51:	50                   	push   %eax
+     a52:	e8 5a 03 00 00       	call   db1 <write>
+     a57:	83 c4 10             	add    $0x10,%esp
+     a5a:	39 f0                	cmp    %esi,%eax
+     a5c:	75 40                	jne    a9e <flush+0x83>
+     a5e:	be 00 00 00 00       	mov    $0x0,%esi
+     a63:	eb 30                	jmp    a95 <flush+0x7a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     a65:	83 c3 01             	add    $0x1,%ebx
+     a68:	83 fb 0f             	cmp    $0xf,%ebx
+     a6b:	7f 28                	jg     a95 <flush+0x7a>
+      if(flush(fd) < 0)
+     a6d:	83 ec 0c             	sub    $0xc,%esp
+     a70:	53                   	push   %ebx
+     a71:	e8 a5 ff ff ff       	call   a1b <flush>
+     a76:	83 c4 10             	add    $0x10,%esp
+     a79:	85 c0                	test   %eax,%eax
+     a7b:	79 e8                	jns    a65 <flush+0x4a>
+        r = -1;
+     a7d:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     a82:	eb e1                	jmp    a65 <flush+0x4a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     a84:	be 00 00 00 00       	mov    $0x0,%esi
+     a89:	bb 00 00 00 00       	mov    $0x0,%ebx
+     a8e:	eb d8                	jmp    a68 <flush+0x4d>
+    return 0;
+     a90:	be 00 00 00 00       	mov    $0x0,%esi
+}
+     a95:	89 f0                	mov    %esi,%eax
+     a97:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     a9a:	5b                   	pop    %ebx
+     a9b:	5e                   	pop    %esi
+     a9c:	5d                   	pop    %ebp
+     a9d:	c3                   	ret
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     a9e:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     aa3:	eb f0                	jmp    a95 <flush+0x7a>
+
+00000aa5 <bufreset>:
+
+static void
+bufreset(int fd)
+{
+  if(fd >= 0 && fd < NOBUF){
+     aa5:	83 f8 0f             	cmp    $0xf,%eax
+     aa8:	76 01                	jbe    aab <bufreset+0x6>
+     aaa:	c3                   	ret
+{
+     aab:	55                   	push   %ebp
+     aac:	89 e5                	mov    %esp,%ebp
+     aae:	53                   	push   %ebx
+     aaf:	83 ec 10             	sub    $0x10,%esp
+     ab2:	89 c3                	mov    %eax,%ebx
+    flush(fd);
+     ab4:	50                   	push   %eax
+     ab5:	e8 61 ff ff ff       	call   a1b <flush>
+    obuf[fd].mode = BUNKNOWN;
+     aba:	69 db 08 02 00 00    	imul   $0x208,%ebx,%ebx
+     ac0:	c7 83 20 21 00 00 00 	movl   $0x0,0x2120(%ebx)
+     ac7:	00 00 00 
+     aca:	83 c4 10             	add    $0x10,%esp
+  }
+}
+     acd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ad0:	c9                   	leave
+     ad1:	c3                   	ret
+
+00000ad2 <bufwrite>:
+
+// Write n bytes from p to fd, through its buffer.
+// Returns n, or -1 if a write fails.
+int
+bufwrite(int fd, const void *p, int n)
+{
+     ad2:	55                   	push   %ebp
+     ad3:	89 e5                	mov    %esp,%ebp
+     ad5:	57                   	push   %edi
+     ad6:	56                   	push   %esi
+     ad7:	53                   	push   %ebx
+     ad8:	83 ec 3c             	sub    $0x3c,%esp
+     adb:	8b 75 08             	mov    0x8(%ebp),%esi
+     ade:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct stat st;
+  const char *s;
+  int i;
+
+  if(fd < 0 || fd >= NOBUF)
+     ae1:	83 fe 0f             	cmp    $0xf,%esi
+     ae4:	0f 87 a2 00 00 00    	ja     b8c <bufwrite+0xba>
+    return write(fd, p, n);
+  if(obuf[fd].mode == BUNKNOWN){
+     aea:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     af0:	83 b8 20 21 00 00 00 	cmpl   $0x0,0x2120(%eax)
+     af7:	75 19                	jne    b12 <bufwrite+0x40>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     af9:	83 fe 02             	cmp    $0x2,%esi
+     afc:	0f 85 9c 00 00 00    	jne    b9e <bufwrite+0xcc>
+      obuf[fd].mode = BNONE;
+     b02:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     b08:	c7 80 20 21 00 00 01 	movl   $0x1,0x2120(%eax)
+     b0f:	00 00 00 
+    else
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+  }
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     b12:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     b18:	89 da                	mov    %ebx,%edx
+     b1a:	03 90 24 21 00 00    	add    0x2124(%eax),%edx
+     b20:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+     b26:	0f 8f ae 00 00 00    	jg     bda <bufwrite+0x108>
+    return -1;
+  if(n >= OBUFSZ)
+     b2c:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+     b32:	0f 8f bd 00 00 00    	jg     bf5 <bufwrite+0x123>
+    return write(fd, p, n);
+  memmove(obuf[fd].buf + obuf[fd].n, p, n);
+     b38:	69 d6 08 02 00 00    	imul   $0x208,%esi,%edx
+     b3e:	8d ba 20 21 00 00    	lea    0x2120(%edx),%edi
+     b44:	8b 82 24 21 00 00    	mov    0x2124(%edx),%eax
+     b4a:	83 ec 04             	sub    $0x4,%esp
+     b4d:	53                   	push   %ebx
+     b4e:	ff 75 0c             	push   0xc(%ebp)
+     b51:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     b54:	8d 84 10 28 21 00 00 	lea    0x2128(%eax,%edx,1),%eax
+     b5b:	50                   	push   %eax
+     b5c:	e8 4c fd ff ff       	call   8ad <memmove>
+  obuf[fd].n += n;
+     b61:	01 5f 04             	add    %ebx,0x4(%edi)
+  if(obuf[fd].mode == BNONE)
+     b64:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     b67:	8b 82 20 21 00 00    	mov    0x2120(%edx),%eax
+     b6d:	83 c4 10             	add    $0x10,%esp
+     b70:	83 f8 01             	cmp    $0x1,%eax
+     b73:	0f 84 91 00 00 00    	je     c0a <bufwrite+0x138>
+    return flush(fd) < 0 ? -1 : n;
+  if(obuf[fd].mode == BLINE)
+     b79:	83 f8 02             	cmp    $0x2,%eax
+     b7c:	0f 84 ca 00 00 00    	je     c4c <bufwrite+0x17a>
+    for(s = p, i = 0; i < n; i++)
+      if(s[i] == '\n')
+        return flush(fd) < 0 ? -1 : n;
+  return n;
+     b82:	89 d8                	mov    %ebx,%eax
+}
+     b84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b87:	5b                   	pop    %ebx
+     b88:	5e                   	pop    %esi
+     b89:	5f                   	pop    %edi
+     b8a:	5d                   	pop    %ebp
+     b8b:	c3                   	ret
+    return write(fd, p, n);
+     b8c:	83 ec 04             	sub    $0x4,%esp
+     b8f:	53                   	push   %ebx
+     b90:	ff 75 0c             	push   0xc(%ebp)
+     b93:	56                   	push   %esi
+     b94:	e8 18 02 00 00       	call   db1 <write>
+     b99:	83 c4 10             	add    $0x10,%esp
+     b9c:	eb e6                	jmp    b84 <bufwrite+0xb2>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     b9e:	83 ec 08             	sub    $0x8,%esp
+     ba1:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     ba4:	50                   	push   %eax
+     ba5:	56                   	push   %esi
+     ba6:	e8 51 02 00 00       	call   dfc <fstat>
+     bab:	83 c4 10             	add    $0x10,%esp
+     bae:	85 c0                	test   %eax,%eax
+     bb0:	0f 88 4c ff ff ff    	js     b02 <bufwrite+0x30>
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+     bb6:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     bbb:	74 16                	je     bd3 <bufwrite+0x101>
+     bbd:	ba 03 00 00 00       	mov    $0x3,%edx
+     bc2:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     bc8:	89 90 20 21 00 00    	mov    %edx,0x2120(%eax)
+     bce:	e9 3f ff ff ff       	jmp    b12 <bufwrite+0x40>
+     bd3:	ba 02 00 00 00       	mov    $0x2,%edx
+     bd8:	eb e8                	jmp    bc2 <bufwrite+0xf0>
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     bda:	83 ec 0c             	sub    $0xc,%esp
+     bdd:	56                   	push   %esi
+     bde:	e8 38 fe ff ff       	call   a1b <flush>
+     be3:	83 c4 10             	add    $0x10,%esp
+     be6:	85 c0                	test   %eax,%eax
+     be8:	0f 89 3e ff ff ff    	jns    b2c <bufwrite+0x5a>
+    return -1;
+     bee:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     bf3:	eb 8f                	jmp    b84 <bufwrite+0xb2>
+    return write(fd, p, n);
+     bf5:	83 ec 04             	sub    $0x4,%esp
+     bf8:	53                   	push   %ebx
+     bf9:	ff 75 0c             	push   0xc(%ebp)
+     bfc:	56                   	push   %esi
+     bfd:	e8 af 01 00 00       	call   db1 <write>
+     c02:	83 c4 10             	add    $0x10,%esp
+     c05:	e9 7a ff ff ff       	jmp    b84 <bufwrite+0xb2>
+    return flush(fd) < 0 ? -1 : n;
+     c0a:	83 ec 0c             	sub    $0xc,%esp
+     c0d:	56                   	push   %esi
+     c0e:	e8 08 fe ff ff       	call   a1b <flush>
+     c13:	83 c4 10             	add    $0x10,%esp
+     c16:	85 c0                	test   %eax,%eax
+     c18:	78 07                	js     c21 <bufwrite+0x14f>
+     c1a:	89 d8                	mov    %ebx,%eax
+     c1c:	e9 63 ff ff ff       	jmp    b84 <bufwrite+0xb2>
+     c21:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     c26:	e9 59 ff ff ff       	jmp    b84 <bufwrite+0xb2>
+        return flush(fd) < 0 ? -1 : n;
+     c2b:	83 ec 0c             	sub    $0xc,%esp
+     c2e:	56                   	push   %esi
+     c2f:	e8 e7 fd ff ff       	call   a1b <flush>
+     c34:	83 c4 10             	add    $0x10,%esp
+     c37:	85 c0                	test   %eax,%eax
+     c39:	78 07                	js     c42 <bufwrite+0x170>
+     c3b:	89 d8                	mov    %ebx,%eax
+     c3d:	e9 42 ff ff ff       	jmp    b84 <bufwrite+0xb2>
+     c42:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     c47:	e9 38 ff ff ff       	jmp    b84 <bufwrite+0xb2>
+    for(s = p, i = 0; i < n; i++)
+     c4c:	b8 00 00 00 00       	mov    $0x0,%eax
+     c51:	39 d8                	cmp    %ebx,%eax
+     c53:	7d 0e                	jge    c63 <bufwrite+0x191>
+      if(s[i] == '\n')
+     c55:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     c58:	80 3c 01 0a          	cmpb   $0xa,(%ecx,%eax,1)
+     c5c:	74 cd                	je     c2b <bufwrite+0x159>
+    for(s = p, i = 0; i < n; i++)
+     c5e:	83 c0 01             	add    $0x1,%eax
+     c61:	eb ee                	jmp    c51 <bufwrite+0x17f>
+  return n;
+     c63:	89 d8                	mov    %ebx,%eax
+     c65:	e9 1a ff ff ff       	jmp    b84 <bufwrite+0xb2>
+
+00000c6a <fork>:
+
+int
+fork(void)
+{
+     c6a:	55                   	push   %ebp
+     c6b:	89 e5                	mov    %esp,%ebp
+     c6d:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     c70:	6a ff                	push   $0xffffffff
+     c72:	e8 a4 fd ff ff       	call   a1b <flush>
+  return _fork();
+     c77:	e8 bd 00 00 00       	call   d39 <_fork>
+}
+     c7c:	c9                   	leave
+     c7d:	c3                   	ret
+
+00000c7e <exit>:
+
+int
+exit(void)
+{
+     c7e:	55                   	push   %ebp
+     c7f:	89 e5                	mov    %esp,%ebp
+     c81:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     c84:	6a ff                	push   $0xffffffff
+     c86:	e8 90 fd ff ff       	call   a1b <flush>
+  _exit();
+     c8b:	e8 b8 00 00 00       	call   d48 <_exit>
+
+00000c90 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     c90:	55                   	push   %ebp
+     c91:	89 e5                	mov    %esp,%ebp
+     c93:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     c96:	6a ff                	push   $0xffffffff
+     c98:	e8 7e fd ff ff       	call   a1b <flush>
+  return _exec(path, argv);
+     c9d:	83 c4 08             	add    $0x8,%esp
+     ca0:	ff 75 0c             	push   0xc(%ebp)
+     ca3:	ff 75 08             	push   0x8(%ebp)
+     ca6:	e8 bb 00 00 00       	call   d66 <_exec>
+}
+     cab:	c9                   	leave
+     cac:	c3                   	ret
+
+00000cad <close>:
+
+int
+close(int fd)
+{
+     cad:	55                   	push   %ebp
+     cae:	89 e5                	mov    %esp,%ebp
+     cb0:	53                   	push   %ebx
+     cb1:	83 ec 04             	sub    $0x4,%esp
+     cb4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bufreset(fd);
+     cb7:	89 d8                	mov    %ebx,%eax
+     cb9:	e8 e7 fd ff ff       	call   aa5 <bufreset>
+  return _close(fd);
+     cbe:	83 ec 0c             	sub    $0xc,%esp
+     cc1:	53                   	push   %ebx
+     cc2:	e8 90 00 00 00       	call   d57 <_close>
+}
+     cc7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     cca:	c9                   	leave
+     ccb:	c3                   	ret
+
+00000ccc <stat>:
+{
+     ccc:	55                   	push   %ebp
+     ccd:	89 e5                	mov    %esp,%ebp
+     ccf:	56                   	push   %esi
+     cd0:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     cd1:	83 ec 08             	sub    $0x8,%esp
+     cd4:	6a 00                	push   $0x0
+     cd6:	ff 75 08             	push   0x8(%ebp)
+     cd9:	e8 f1 00 00 00       	call   dcf <open>
+  if(fd < 0)
+     cde:	83 c4 10             	add    $0x10,%esp
+     ce1:	85 c0                	test   %eax,%eax
+     ce3:	78 24                	js     d09 <stat+0x3d>
+     ce5:	89 c3                	mov    %eax,%ebx
+  r = fstat(fd, st);
+     ce7:	83 ec 08             	sub    $0x8,%esp
+     cea:	ff 75 0c             	push   0xc(%ebp)
+     ced:	50                   	push   %eax
+     cee:	e8 09 01 00 00       	call   dfc <fstat>
+     cf3:	89 c6                	mov    %eax,%esi
+  close(fd);
+     cf5:	89 1c 24             	mov    %ebx,(%esp)
+     cf8:	e8 b0 ff ff ff       	call   cad <close>
+  return r;
+     cfd:	83 c4 10             	add    $0x10,%esp
+}
+     d00:	89 f0                	mov    %esi,%eax
+     d02:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d05:	5b                   	pop    %ebx
+     d06:	5e                   	pop    %esi
+     d07:	5d                   	pop    %ebp
+     d08:	c3                   	ret
+    return -1;
+     d09:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     d0e:	eb f0                	jmp    d00 <stat+0x34>
+
+00000d10 <dup2>:
+
+int
+dup2(int oldfd, int newfd)
+{
+     d10:	55                   	push   %ebp
+     d11:	89 e5                	mov    %esp,%ebp
+     d13:	56                   	push   %esi
+     d14:	53                   	push   %ebx
+     d15:	8b 75 08             	mov    0x8(%ebp),%esi
+     d18:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(oldfd != newfd)
+     d1b:	39 de                	cmp    %ebx,%esi
+     d1d:	75 11                	jne    d30 <dup2+0x20>
+    bufreset(newfd);
+  return _dup2(oldfd, newfd);
+     d1f:	83 ec 08             	sub    $0x8,%esp
+     d22:	53                   	push   %ebx
+     d23:	56                   	push   %esi
+     d24:	e8 4c 00 00 00       	call   d75 <_dup2>
+}
+     d29:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d2c:	5b                   	pop    %ebx
+     d2d:	5e                   	pop    %esi
+     d2e:	5d                   	pop    %ebp
+     d2f:	c3                   	ret
+    bufreset(newfd);
+     d30:	89 d8                	mov    %ebx,%eax
+     d32:	e8 6e fd ff ff       	call   aa5 <bufreset>
+     d37:	eb e6                	jmp    d1f <dup2+0xf>
+
+00000d39 <_fork>:
+  1: ret
+
+#define SYSCALL(name) STUB(name, SYS_ ## name)
+
+# ulib.c wraps these, to flush printf()'s buffers first.
+STUB(_fork, SYS_fork)
+     d39:	b8 01 00 00 00       	mov    $0x1,%eax
+     d3e:	89 e1                	mov    %esp,%ecx
+     d40:	ba 47 0d 00 00       	mov    $0xd47,%edx
+     d45:	0f 34                	sysenter
+     d47:	c3                   	ret
+
+00000d48 <_exit>:
+STUB(_exit, SYS_exit)
+     d48:	b8 02 00 00 00       	mov    $0x2,%eax
+     d4d:	89 e1                	mov    %esp,%ecx
+     d4f:	ba 56 0d 00 00       	mov    $0xd56,%edx
+     d54:	0f 34                	sysenter
+     d56:	c3                   	ret
+
+00000d57 <_close>:
+STUB(_close, SYS_close)
+     d57:	b8 15 00 00 00       	mov    $0x15,%eax
+     d5c:	89 e1                	mov    %esp,%ecx
+     d5e:	ba 65 0d 00 00       	mov    $0xd65,%edx
+     d63:	0f 34                	sysenter
+     d65:	c3                   	ret
+
+00000d66 <_exec>:
+STUB(_exec, SYS_exec)
+     d66:	b8 07 00 00 00       	mov    $0x7,%eax
+     d6b:	89 e1                	mov    %esp,%ecx
+     d6d:	ba 74 0d 00 00       	mov    $0xd74,%edx
+     d72:	0f 34                	sysenter
+     d74:	c3                   	ret
+
+00000d75 <_dup2>:
+STUB(_dup2, SYS_dup2)
+     d75:	b8 17 00 00 00       	mov    $0x17,%eax
+     d7a:	89 e1                	mov    %esp,%ecx
+     d7c:	ba 83 0d 00 00       	mov    $0xd83,%edx
+     d81:	0f 34                	sysenter
+     d83:	c3                   	ret
+
+00000d84 <wait>:
+
+SYSCALL(wait)
+     d84:	b8 03 00 00 00       	mov    $0x3,%eax
+     d89:	89 e1                	mov    %esp,%ecx
+     d8b:	ba 92 0d 00 00       	mov    $0xd92,%edx
+     d90:	0f 34                	sysenter
+     d92:	c3                   	ret
+
+00000d93 <pipe>:
+SYSCALL(pipe)
+     d93:	b8 04 00 00 00       	mov    $0x4,%eax
+     d98:	89 e1                	mov    %esp,%ecx
+     d9a:	ba a1 0d 00 00       	mov    $0xda1,%edx
+     d9f:	0f 34                	sysenter
+     da1:	c3                   	ret
+
+00000da2 <read>:
+SYSCALL(read)
+     da2:	b8 05 00 00 00       	mov    $0x5,%eax
+     da7:	89 e1                	mov    %esp,%ecx
+     da9:	ba b0 0d 00 00       	mov    $0xdb0,%edx
+     dae:	0f 34                	sysenter
+     db0:	c3                   	ret
+
+00000db1 <write>:
+SYSCALL(write)
+     db1:	b8 10 00 00 00       	mov    $0x10,%eax
+     db6:	89 e1                	mov    %esp,%ecx
+     db8:	ba bf 0d 00 00       	mov    $0xdbf,%edx
+     dbd:	0f 34                	sysenter
+     dbf:	c3                   	ret
+
+00000dc0 <kill>:
+SYSCALL(kill)
+     dc0:	b8 06 00 00 00       	mov    $0x6,%eax
+     dc5:	89 e1                	mov    %esp,%ecx
+     dc7:	ba ce 0d 00 00       	mov    $0xdce,%edx
+     dcc:	0f 34                	sysenter
+     dce:	c3                   	ret
+
+00000dcf <open>:
+SYSCALL(open)
+     dcf:	b8 0f 00 00 00       	mov    $0xf,%eax
+     dd4:	89 e1                	mov    %esp,%ecx
+     dd6:	ba dd 0d 00 00       	mov    $0xddd,%edx
+     ddb:	0f 34                	sysenter
+     ddd:	c3                   	ret
+
+00000dde <mknod>:
+SYSCALL(mknod)
+     dde:	b8 11 00 00 00       	mov    $0x11,%eax
+     de3:	89 e1                	mov    %esp,%ecx
+     de5:	ba ec 0d 00 00       	mov    $0xdec,%edx
+     dea:	0f 34                	sysenter
+     dec:	c3                   	ret
+
+00000ded <unlink>:
+SYSCALL(unlink)
+     ded:	b8 12 00 00 00       	mov    $0x12,%eax
+     df2:	89 e1                	mov    %esp,%ecx
+     df4:	ba fb 0d 00 00       	mov    $0xdfb,%edx
+     df9:	0f 34                	sysenter
+     dfb:	c3                   	ret
+
+00000dfc <fstat>:
+SYSCALL(fstat)
+     dfc:	b8 08 00 00 00       	mov    $0x8,%eax
+     e01:	89 e1                	mov    %esp,%ecx
+     e03:	ba 0a 0e 00 00       	mov    $0xe0a,%edx
+     e08:	0f 34                	sysenter
+     e0a:	c3                   	ret
+
+00000e0b <link>:
+SYSCALL(link)
+     e0b:	b8 13 00 00 00       	mov    $0x13,%eax
+     e10:	89 e1                	mov    %esp,%ecx
+     e12:	ba 19 0e 00 00       	mov    $0xe19,%edx
+     e17:	0f 34                	sysenter
+     e19:	c3                   	ret
+
+00000e1a <mkdir>:
+SYSCALL(mkdir)
+     e1a:	b8 14 00 00 00       	mov    $0x14,%eax
+     e1f:	89 e1                	mov    %esp,%ecx
+     e21:	ba 28 0e 00 00       	mov    $0xe28,%edx
+     e26:	0f 34                	sysenter
+     e28:	c3                   	ret
+
+00000e29 <chdir>:
+SYSCALL(chdir)
+     e29:	b8 09 00 00 00       	mov    $0x9,%eax
+     e2e:	89 e1                	mov    %esp,%ecx
+     e30:	ba 37 0e 00 00       	mov    $0xe37,%edx
+     e35:	0f 34                	sysenter
+     e37:	c3                   	ret
+
+00000e38 <dup>:
+SYSCALL(dup)
+     e38:	b8 0a 00 00 00       	mov    $0xa,%eax
+     e3d:	89 e1                	mov    %esp,%ecx
+     e3f:	ba 46 0e 00 00       	mov    $0xe46,%edx
+     e44:	0f 34                	sysenter
+     e46:	c3                   	ret
+
+00000e47 <getpid>:
+SYSCALL(getpid)
+     e47:	b8 0b 00 00 00       	mov    $0xb,%eax
+     e4c:	89 e1                	mov    %esp,%ecx
+     e4e:	ba 55 0e 00 00       	mov    $0xe55,%edx
+     e53:	0f 34                	sysenter
+     e55:	c3                   	ret
+
+00000e56 <sbrk>:
+SYSCALL(sbrk)
+     e56:	b8 0c 00 00 00       	mov    $0xc,%eax
+     e5b:	89 e1                	mov    %esp,%ecx
+     e5d:	ba 64 0e 00 00       	mov    $0xe64,%edx
+     e62:	0f 34                	sysenter
+     e64:	c3                   	ret
+
+00000e65 <sleep>:
+SYSCALL(sleep)
+     e65:	b8 0d 00 00 00       	mov    $0xd,%eax
+     e6a:	89 e1                	mov    %esp,%ecx
+     e6c:	ba 73 0e 00 00       	mov    $0xe73,%edx
+     e71:	0f 34                	sysenter
+     e73:	c3                   	ret
+
+00000e74 <uptime>:
+SYSCALL(uptime)
+     e74:	b8 0e 00 00 00       	mov    $0xe,%eax
+     e79:	89 e1                	mov    %esp,%ecx
+     e7b:	ba 82 0e 00 00       	mov    $0xe82,%edx
+     e80:	0f 34                	sysenter
+     e82:	c3                   	ret
+
+00000e83 <date>:
+SYSCALL(date)
+     e83:	b8 16 00 00 00       	mov    $0x16,%eax
+     e88:	89 e1                	mov    %esp,%ecx
+     e8a:	ba 91 0e 00 00       	mov    $0xe91,%edx
+     e8f:	0f 34                	sysenter
+     e91:	c3                   	ret
+
+00000e92 <faultaround>:
+SYSCALL(faultaround)
+     e92:	b8 18 00 00 00       	mov    $0x18,%eax
+     e97:	89 e1                	mov    %esp,%ecx
+     e99:	ba a0 0e 00 00       	mov    $0xea0,%edx
+     e9e:	0f 34                	sysenter
+     ea0:	c3                   	ret
+
+00000ea1 <faultstat>:
+SYSCALL(faultstat)
+     ea1:	b8 19 00 00 00       	mov    $0x19,%eax
+     ea6:	89 e1                	mov    %esp,%ecx
+     ea8:	ba af 0e 00 00       	mov    $0xeaf,%edx
+     ead:	0f 34                	sysenter
+     eaf:	c3                   	ret
+
+00000eb0 <mmap>:
+SYSCALL(mmap)
+     eb0:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     eb5:	89 e1                	mov    %esp,%ecx
+     eb7:	ba be 0e 00 00       	mov    $0xebe,%edx
+     ebc:	0f 34                	sysenter
+     ebe:	c3                   	ret
+
+00000ebf <munmap>:
+SYSCALL(munmap)
+     ebf:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     ec4:	89 e1                	mov    %esp,%ecx
+     ec6:	ba cd 0e 00 00       	mov    $0xecd,%edx
+     ecb:	0f 34                	sysenter
+     ecd:	c3                   	ret
+
+00000ece <largepages>:
+SYSCALL(largepages)
+     ece:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     ed3:	89 e1                	mov    %esp,%ecx
+     ed5:	ba dc 0e 00 00       	mov    $0xedc,%edx
+     eda:	0f 34                	sysenter
+     edc:	c3                   	ret
+
+00000edd <spawn>:
+SYSCALL(spawn)
+     edd:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     ee2:	89 e1                	mov    %esp,%ecx
+     ee4:	ba eb 0e 00 00       	mov    $0xeeb,%edx
+     ee9:	0f 34                	sysenter
+     eeb:	c3                   	ret
+
+00000eec <setpriority>:
+SYSCALL(setpriority)
+     eec:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     ef1:	89 e1                	mov    %esp,%ecx
+     ef3:	ba fa 0e 00 00       	mov    $0xefa,%edx
+     ef8:	0f 34                	sysenter
+     efa:	c3                   	ret
+
+00000efb <getpriority>:
+SYSCALL(getpriority)
+     efb:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     f00:	89 e1                	mov    %esp,%ecx
+     f02:	ba 09 0f 00 00       	mov    $0xf09,%edx
+     f07:	0f 34                	sysenter
+     f09:	c3                   	ret
+
+00000f0a <getprocinfo>:
+SYSCALL(getprocinfo)
+     f0a:	b8 20 00 00 00       	mov    $0x20,%eax
+     f0f:	89 e1                	mov    %esp,%ecx
+     f11:	ba 18 0f 00 00       	mov    $0xf18,%edx
+     f16:	0f 34                	sysenter
+     f18:	c3                   	ret
+
+00000f19 <getcpuinfo>:
+SYSCALL(getcpuinfo)
+     f19:	b8 21 00 00 00       	mov    $0x21,%eax
+     f1e:	89 e1                	mov    %esp,%ecx
+     f20:	ba 27 0f 00 00       	mov    $0xf27,%edx
+     f25:	0f 34                	sysenter
+     f27:	c3                   	ret
+
+00000f28 <clone>:
+SYSCALL(clone)
+     f28:	b8 22 00 00 00       	mov    $0x22,%eax
+     f2d:	89 e1                	mov    %esp,%ecx
+     f2f:	ba 36 0f 00 00       	mov    $0xf36,%edx
+     f34:	0f 34                	sysenter
+     f36:	c3                   	ret
+
+00000f37 <join>:
+SYSCALL(join)
+     f37:	b8 23 00 00 00       	mov    $0x23,%eax
+     f3c:	89 e1                	mov    %esp,%ecx
+     f3e:	ba 45 0f 00 00       	mov    $0xf45,%edx
+     f43:	0f 34                	sysenter
+     f45:	c3                   	ret
+
+00000f46 <futex_wait>:
+SYSCALL(futex_wait)
+     f46:	b8 24 00 00 00       	mov    $0x24,%eax
+     f4b:	89 e1                	mov    %esp,%ecx
+     f4d:	ba 54 0f 00 00       	mov    $0xf54,%edx
+     f52:	0f 34                	sysenter
+     f54:	c3                   	ret
+
+00000f55 <futex_wake>:
+SYSCALL(futex_wake)
+     f55:	b8 25 00 00 00       	mov    $0x25,%eax
+     f5a:	89 e1                	mov    %esp,%ecx
+     f5c:	ba 63 0f 00 00       	mov    $0xf63,%edx
+     f61:	0f 34                	sysenter
+     f63:	c3                   	ret
+
+00000f64 <setaffinity>:
+SYSCALL(setaffinity)
+     f64:	b8 26 00 00 00       	mov    $0x26,%eax
+     f69:	89 e1                	mov    %esp,%ecx
+     f6b:	ba 72 0f 00 00       	mov    $0xf72,%edx
+     f70:	0f 34                	sysenter
+     f72:	c3                   	ret
+
+00000f73 <getaffinity>:
+SYSCALL(getaffinity)
+     f73:	b8 27 00 00 00       	mov    $0x27,%eax
+     f78:	89 e1                	mov    %esp,%ecx
+     f7a:	ba 81 0f 00 00       	mov    $0xf81,%edx
+     f7f:	0f 34                	sysenter
+     f81:	c3                   	ret
+
+00000f82 <clock_gettime>:
+SYSCALL(clock_gettime)
+     f82:	b8 28 00 00 00       	mov    $0x28,%eax
+     f87:	89 e1                	mov    %esp,%ecx
+     f89:	ba 90 0f 00 00       	mov    $0xf90,%edx
+     f8e:	0f 34                	sysenter
+     f90:	c3                   	ret
+
+00000f91 <msleep>:
+SYSCALL(msleep)
+     f91:	b8 29 00 00 00       	mov    $0x29,%eax
+     f96:	89 e1                	mov    %esp,%ecx
+     f98:	ba 9f 0f 00 00       	mov    $0xf9f,%edx
+     f9d:	0f 34                	sysenter
+     f9f:	c3                   	ret
+
+00000fa0 <lockstat>:
+SYSCALL(lockstat)
+     fa0:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     fa5:	89 e1                	mov    %esp,%ecx
+     fa7:	ba ae 0f 00 00       	mov    $0xfae,%edx
+     fac:	0f 34                	sysenter
+     fae:	c3                   	ret
+
+00000faf <bstat>:
+SYSCALL(bstat)
+     faf:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     fb4:	89 e1                	mov    %esp,%ecx
+     fb6:	ba bd 0f 00 00       	mov    $0xfbd,%edx
+     fbb:	0f 34                	sysenter
+     fbd:	c3                   	ret
+
+00000fbe <iostat>:
+SYSCALL(iostat)
+     fbe:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     fc3:	89 e1                	mov    %esp,%ecx
+     fc5:	ba cc 0f 00 00       	mov    $0xfcc,%edx
+     fca:	0f 34                	sysenter
+     fcc:	c3                   	ret
+
+00000fcd <fsync>:
+SYSCALL(fsync)
+     fcd:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     fd2:	89 e1                	mov    %esp,%ecx
+     fd4:	ba db 0f 00 00       	mov    $0xfdb,%edx
+     fd9:	0f 34                	sysenter
+     fdb:	c3                   	ret
+
+00000fdc <pread>:
+SYSCALL(pread)
+     fdc:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     fe1:	89 e1                	mov    %esp,%ecx
+     fe3:	ba ea 0f 00 00       	mov    $0xfea,%edx
+     fe8:	0f 34                	sysenter
+     fea:	c3                   	ret
+
+00000feb <pwrite>:
+SYSCALL(pwrite)
+     feb:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     ff0:	89 e1                	mov    %esp,%ecx
+     ff2:	ba f9 0f 00 00       	mov    $0xff9,%edx
+     ff7:	0f 34                	sysenter
+     ff9:	c3                   	ret
+
+00000ffa <readv>:
+SYSCALL(readv)
+     ffa:	b8 30 00 00 00       	mov    $0x30,%eax
+     fff:	89 e1                	mov    %esp,%ecx
+    1001:	ba 08 10 00 00       	mov    $0x1008,%edx
+    1006:	0f 34                	sysenter
+    1008:	c3                   	ret
+
+00001009 <writev>:
+SYSCALL(writev)
+    1009:	b8 31 00 00 00       	mov    $0x31,%eax
+    100e:	89 e1                	mov    %esp,%ecx
+    1010:	ba 17 10 00 00       	mov    $0x1017,%edx
+    1015:	0f 34                	sysenter
+    1017:	c3                   	ret
+
+00001018 <sendfile>:
+SYSCALL(sendfile)
+    1018:	b8 32 00 00 00       	mov    $0x32,%eax
+    101d:	89 e1                	mov    %esp,%ecx
+    101f:	ba 26 10 00 00       	mov    $0x1026,%edx
+    1024:	0f 34                	sysenter
+    1026:	c3                   	ret
+
+00001027 <fcntl>:
+SYSCALL(fcntl)
+    1027:	b8 33 00 00 00       	mov    $0x33,%eax
+    102c:	89 e1                	mov    %esp,%ecx
+    102e:	ba 35 10 00 00       	mov    $0x1035,%edx
+    1033:	0f 34                	sysenter
+    1035:	c3                   	ret
+
+00001036 <mount>:
+SYSCALL(mount)
+    1036:	b8 34 00 00 00       	mov    $0x34,%eax
+    103b:	89 e1                	mov    %esp,%ecx
+    103d:	ba 44 10 00 00       	mov    $0x1044,%edx
+    1042:	0f 34                	sysenter
+    1044:	c3                   	ret
+
+00001045 <getdents>:
+SYSCALL(getdents)
+    1045:	b8 35 00 00 00       	mov    $0x35,%eax
+    104a:	89 e1                	mov    %esp,%ecx
+    104c:	ba 53 10 00 00       	mov    $0x1053,%edx
+    1051:	0f 34                	sysenter
+    1053:	c3                   	ret
+
+00001054 <fstatat>:
+SYSCALL(fstatat)
+    1054:	b8 36 00 00 00       	mov    $0x36,%eax
+    1059:	89 e1                	mov    %esp,%ecx
+    105b:	ba 62 10 00 00       	mov    $0x1062,%edx
+    1060:	0f 34                	sysenter
+    1062:	c3                   	ret
+
+00001063 <sysstat>:
+SYSCALL(sysstat)
+    1063:	b8 37 00 00 00       	mov    $0x37,%eax
+    1068:	89 e1                	mov    %esp,%ecx
+    106a:	ba 71 10 00 00       	mov    $0x1071,%edx
+    106f:	0f 34                	sysenter
+    1071:	c3                   	ret
+
+00001072 <ringenter>:
+SYSCALL(ringenter)
+    1072:	b8 38 00 00 00       	mov    $0x38,%eax
+    1077:	89 e1                	mov    %esp,%ecx
+    1079:	ba 80 10 00 00       	mov    $0x1080,%edx
+    107e:	0f 34                	sysenter
+    1080:	c3                   	ret
+
+00001081 <trace>:
+SYSCALL(trace)
+    1081:	b8 39 00 00 00       	mov    $0x39,%eax
+    1086:	89 e1                	mov    %esp,%ecx
+    1088:	ba 8f 10 00 00       	mov    $0x108f,%edx
+    108d:	0f 34                	sysenter
+    108f:	c3                   	ret
+
+00001090 <memstat>:
+SYSCALL(memstat)
+    1090:	b8 3a 00 00 00       	mov    $0x3a,%eax
+    1095:	89 e1                	mov    %esp,%ecx
+    1097:	ba 9e 10 00 00       	mov    $0x109e,%edx
+    109c:	0f 34                	sysenter
+    109e:	c3                   	ret
+
+0000109f <shmget>:
+SYSCALL(shmget)
+    109f:	b8 3b 00 00 00       	mov    $0x3b,%eax
+    10a4:	89 e1                	mov    %esp,%ecx
+    10a6:	ba ad 10 00 00       	mov    $0x10ad,%edx
+    10ab:	0f 34                	sysenter
+    10ad:	c3                   	ret
+
+000010ae <shmat>:
+SYSCALL(shmat)
+    10ae:	b8 3c 00 00 00       	mov    $0x3c,%eax
+    10b3:	89 e1                	mov    %esp,%ecx
+    10b5:	ba bc 10 00 00       	mov    $0x10bc,%edx
+    10ba:	0f 34                	sysenter
+    10bc:	c3                   	ret
+
+000010bd <shmdt>:
+SYSCALL(shmdt)
+    10bd:	b8 3d 00 00 00       	mov    $0x3d,%eax
+    10c2:	89 e1                	mov    %esp,%ecx
+    10c4:	ba cb 10 00 00       	mov    $0x10cb,%edx
+    10c9:	0f 34                	sysenter
+    10cb:	c3                   	ret
+
+000010cc <irqstat>:
+SYSCALL(irqstat)
+    10cc:	b8 3e 00 00 00       	mov    $0x3e,%eax
+    10d1:	89 e1                	mov    %esp,%ecx
+    10d3:	ba da 10 00 00       	mov    $0x10da,%edx
+    10d8:	0f 34                	sysenter
+    10da:	c3                   	ret
+
+000010db <irqroute>:
+SYSCALL(irqroute)
+    10db:	b8 3f 00 00 00       	mov    $0x3f,%eax
+    10e0:	89 e1                	mov    %esp,%ecx
+    10e2:	ba e9 10 00 00       	mov    $0x10e9,%edx
+    10e7:	0f 34                	sysenter
+    10e9:	c3                   	ret
+
+000010ea <putc>:
+  char buf[64];
+};
+
+static void
+putc(struct out *o, char c)
+{
+    10ea:	55                   	push   %ebp
+    10eb:	89 e5                	mov    %esp,%ebp
+    10ed:	56                   	push   %esi
+    10ee:	53                   	push   %ebx
+    10ef:	89 c3                	mov    %eax,%ebx
+    10f1:	89 d6                	mov    %edx,%esi
+  if(o->n == sizeof(o->buf)){
+    10f3:	8b 40 04             	mov    0x4(%eax),%eax
+    10f6:	83 f8 40             	cmp    $0x40,%eax
+    10f9:	74 16                	je     1111 <putc+0x27>
+    bufwrite(o->fd, o->buf, o->n);
+    o->n = 0;
+  }
+  o->buf[o->n++] = c;
+    10fb:	8b 43 04             	mov    0x4(%ebx),%eax
+    10fe:	8d 50 01             	lea    0x1(%eax),%edx
+    1101:	89 53 04             	mov    %edx,0x4(%ebx)
+    1104:	89 f1                	mov    %esi,%ecx
+    1106:	88 4c 03 08          	mov    %cl,0x8(%ebx,%eax,1)
+}
+    110a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    110d:	5b                   	pop    %ebx
+    110e:	5e                   	pop    %esi
+    110f:	5d                   	pop    %ebp
+    1110:	c3                   	ret
+    bufwrite(o->fd, o->buf, o->n);
+    1111:	8d 53 08             	lea    0x8(%ebx),%edx
+    1114:	83 ec 04             	sub    $0x4,%esp
+    1117:	50                   	push   %eax
+    1118:	52                   	push   %edx
+    1119:	ff 33                	push   (%ebx)
+    111b:	e8 b2 f9 ff ff       	call   ad2 <bufwrite>
+    o->n = 0;
+    1120:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    1127:	83 c4 10             	add    $0x10,%esp
+    112a:	eb cf                	jmp    10fb <putc+0x11>
+
+0000112c <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+    112c:	55                   	push   %ebp
+    112d:	89 e5                	mov    %esp,%ebp
+    112f:	57                   	push   %edi
+    1130:	56                   	push   %esi
+    1131:	53                   	push   %ebx
+    1132:	83 ec 2c             	sub    $0x2c,%esp
+    1135:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    1138:	89 d0                	mov    %edx,%eax
+    113a:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    113c:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    1140:	0f 95 c1             	setne  %cl
+    1143:	c1 ea 1f             	shr    $0x1f,%edx
+    1146:	84 d1                	test   %dl,%cl
+    1148:	74 44                	je     118e <printint+0x62>
+    neg = 1;
+    x = -xx;
+    114a:	f7 d8                	neg    %eax
+    114c:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+    114e:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1155:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+    115a:	89 c8                	mov    %ecx,%eax
+    115c:	ba 00 00 00 00       	mov    $0x0,%edx
+    1161:	f7 f6                	div    %esi
+    1163:	89 df                	mov    %ebx,%edi
+    1165:	83 c3 01             	add    $0x1,%ebx
+    1168:	0f b6 92 10 19 00 00 	movzbl 0x1910(%edx),%edx
+    116f:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+    1173:	89 ca                	mov    %ecx,%edx
+    1175:	89 c1                	mov    %eax,%ecx
+    1177:	39 f2                	cmp    %esi,%edx
+    1179:	73 df                	jae    115a <printint+0x2e>
+  if(neg)
+    117b:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+    117f:	74 31                	je     11b2 <printint+0x86>
+    buf[i++] = '-';
+    1181:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+    1186:	8d 5f 02             	lea    0x2(%edi),%ebx
+    1189:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    118c:	eb 17                	jmp    11a5 <printint+0x79>
+    x = xx;
+    118e:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+    1190:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+    1197:	eb bc                	jmp    1155 <printint+0x29>
+
+  while(--i >= 0)
+    putc(o, buf[i]);
+    1199:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+    119e:	89 f0                	mov    %esi,%eax
+    11a0:	e8 45 ff ff ff       	call   10ea <putc>
+  while(--i >= 0)
+    11a5:	83 eb 01             	sub    $0x1,%ebx
+    11a8:	79 ef                	jns    1199 <printint+0x6d>
+}
+    11aa:	83 c4 2c             	add    $0x2c,%esp
+    11ad:	5b                   	pop    %ebx
+    11ae:	5e                   	pop    %esi
+    11af:	5f                   	pop    %edi
+    11b0:	5d                   	pop    %ebp
+    11b1:	c3                   	ret
+    11b2:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    11b5:	eb ee                	jmp    11a5 <printint+0x79>
+
+000011b7 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    11b7:	55                   	push   %ebp
+    11b8:	89 e5                	mov    %esp,%ebp
+    11ba:	57                   	push   %edi
+    11bb:	56                   	push   %esi
+    11bc:	53                   	push   %ebx
+    11bd:	83 ec 6c             	sub    $0x6c,%esp
+  int c, i, state;
+  uint *ap;
+  struct out out, *o;
+
+  o = &out;
+  o->fd = fd;
+    11c0:	8b 45 08             	mov    0x8(%ebp),%eax
+    11c3:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  o->n = 0;
+    11c6:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+    11cd:	8d 45 10             	lea    0x10(%ebp),%eax
+    11d0:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  state = 0;
+    11d3:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+    11d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    11dd:	eb 14                	jmp    11f3 <printf+0x3c>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(o, c);
+    11df:	89 fa                	mov    %edi,%edx
+    11e1:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    11e4:	e8 01 ff ff ff       	call   10ea <putc>
+    11e9:	eb 05                	jmp    11f0 <printf+0x39>
+      }
+    } else if(state == '%'){
+    11eb:	83 fe 25             	cmp    $0x25,%esi
+    11ee:	74 25                	je     1215 <printf+0x5e>
+  for(i = 0; fmt[i]; i++){
+    11f0:	83 c3 01             	add    $0x1,%ebx
+    11f3:	8b 45 0c             	mov    0xc(%ebp),%eax
+    11f6:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+    11fa:	84 c0                	test   %al,%al
+    11fc:	0f 84 20 01 00 00    	je     1322 <printf+0x16b>
+    c = fmt[i] & 0xff;
+    1202:	0f be f8             	movsbl %al,%edi
+    1205:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    1208:	85 f6                	test   %esi,%esi
+    120a:	75 df                	jne    11eb <printf+0x34>
+      if(c == '%'){
+    120c:	83 f8 25             	cmp    $0x25,%eax
+    120f:	75 ce                	jne    11df <printf+0x28>
+        state = '%';
+    1211:	89 c6                	mov    %eax,%esi
+    1213:	eb db                	jmp    11f0 <printf+0x39>
+      if(c == 'd'){
+    1215:	83 f8 25             	cmp    $0x25,%eax
+    1218:	0f 84 cf 00 00 00    	je     12ed <printf+0x136>
+    121e:	0f 8c dd 00 00 00    	jl     1301 <printf+0x14a>
+    1224:	83 f8 78             	cmp    $0x78,%eax
+    1227:	0f 8f d4 00 00 00    	jg     1301 <printf+0x14a>
+    122d:	83 f8 63             	cmp    $0x63,%eax
+    1230:	0f 8c cb 00 00 00    	jl     1301 <printf+0x14a>
+    1236:	83 e8 63             	sub    $0x63,%eax
+    1239:	83 f8 15             	cmp    $0x15,%eax
+    123c:	0f 87 bf 00 00 00    	ja     1301 <printf+0x14a>
+    1242:	ff 24 85 b8 18 00 00 	jmp    *0x18b8(,%eax,4)
+        printint(o, *ap, 10, 1);
+    1249:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+    124c:	8b 17                	mov    (%edi),%edx
+    124e:	83 ec 0c             	sub    $0xc,%esp
+    1251:	6a 01                	push   $0x1
+    1253:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    1258:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    125b:	e8 cc fe ff ff       	call   112c <printint>
+        ap++;
+    1260:	83 c7 04             	add    $0x4,%edi
+    1263:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+    1266:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(o, '%');
+        putc(o, c);
+      }
+      state = 0;
+    1269:	be 00 00 00 00       	mov    $0x0,%esi
+    126e:	eb 80                	jmp    11f0 <printf+0x39>
+        printint(o, *ap, 16, 0);
+    1270:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+    1273:	8b 17                	mov    (%edi),%edx
+    1275:	83 ec 0c             	sub    $0xc,%esp
+    1278:	6a 00                	push   $0x0
+    127a:	b9 10 00 00 00       	mov    $0x10,%ecx
+    127f:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    1282:	e8 a5 fe ff ff       	call   112c <printint>
+        ap++;
+    1287:	83 c7 04             	add    $0x4,%edi
+    128a:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+    128d:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    1290:	be 00 00 00 00       	mov    $0x0,%esi
+    1295:	e9 56 ff ff ff       	jmp    11f0 <printf+0x39>
+        s = (char*)*ap;
+    129a:	8b 45 94             	mov    -0x6c(%ebp),%eax
+    129d:	8b 30                	mov    (%eax),%esi
+        ap++;
+    129f:	83 c0 04             	add    $0x4,%eax
+    12a2:	89 45 94             	mov    %eax,-0x6c(%ebp)
+        if(s == 0)
+    12a5:	85 f6                	test   %esi,%esi
+    12a7:	75 15                	jne    12be <printf+0x107>
+          s = "(null)";
+    12a9:	be b0 18 00 00       	mov    $0x18b0,%esi
+    12ae:	eb 0e                	jmp    12be <printf+0x107>
+          putc(o, *s);
+    12b0:	0f be d2             	movsbl %dl,%edx
+    12b3:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    12b6:	e8 2f fe ff ff       	call   10ea <putc>
+          s++;
+    12bb:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+    12be:	0f b6 16             	movzbl (%esi),%edx
+    12c1:	84 d2                	test   %dl,%dl
+    12c3:	75 eb                	jne    12b0 <printf+0xf9>
+      state = 0;
+    12c5:	be 00 00 00 00       	mov    $0x0,%esi
+    12ca:	e9 21 ff ff ff       	jmp    11f0 <printf+0x39>
+        putc(o, *ap);
+    12cf:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+    12d2:	0f be 17             	movsbl (%edi),%edx
+    12d5:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    12d8:	e8 0d fe ff ff       	call   10ea <putc>
+        ap++;
+    12dd:	83 c7 04             	add    $0x4,%edi
+    12e0:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+      state = 0;
+    12e3:	be 00 00 00 00       	mov    $0x0,%esi
+    12e8:	e9 03 ff ff ff       	jmp    11f0 <printf+0x39>
+        putc(o, c);
+    12ed:	89 fa                	mov    %edi,%edx
+    12ef:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    12f2:	e8 f3 fd ff ff       	call   10ea <putc>
+      state = 0;
+    12f7:	be 00 00 00 00       	mov    $0x0,%esi
+    12fc:	e9 ef fe ff ff       	jmp    11f0 <printf+0x39>
+        putc(o, '%');
+    1301:	ba 25 00 00 00       	mov    $0x25,%edx
+    1306:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    1309:	e8 dc fd ff ff       	call   10ea <putc>
+        putc(o, c);
+    130e:	89 fa                	mov    %edi,%edx
+    1310:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    1313:	e8 d2 fd ff ff       	call   10ea <putc>
+      state = 0;
+    1318:	be 00 00 00 00       	mov    $0x0,%esi
+    131d:	e9 ce fe ff ff       	jmp    11f0 <printf+0x39>
+    }
+  }
+  if(o->n > 0)
+    1322:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    1325:	85 c0                	test   %eax,%eax
+    1327:	7f 08                	jg     1331 <printf+0x17a>
+    bufwrite(fd, o->buf, o->n);
+}
+    1329:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    132c:	5b                   	pop    %ebx
+    132d:	5e                   	pop    %esi
+    132e:	5f                   	pop    %edi
+    132f:	5d                   	pop    %ebp
+    1330:	c3                   	ret
+    bufwrite(fd, o->buf, o->n);
+    1331:	83 ec 04             	sub    $0x4,%esp
+    1334:	50                   	push   %eax
+    1335:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    1338:	50                   	push   %eax
+    1339:	ff 75 08             	push   0x8(%ebp)
+    133c:	e8 91 f7 ff ff       	call   ad2 <bufwrite>
+    1341:	83 c4 10             	add    $0x10,%esp
+}
+    1344:	eb e3                	jmp    1329 <printf+0x172>
+
+00001346 <largefree>:
+  return &b->h;
+}
+
+static void
+largefree(Fblock *b)
+{
+    1346:	55                   	push   %ebp
+    1347:	89 e5                	mov    %esp,%ebp
+    1349:	57                   	push   %edi
+    134a:	56                   	push   %esi
+    134b:	53                   	push   %ebx
+    134c:	83 ec 0c             	sub    $0xc,%esp
+    134f:	89 c1                	mov    %eax,%ecx
+  Fblock **pp, *p, *prev;
+
+  prev = 0;
+    1351:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+    1356:	ba ac 41 00 00       	mov    $0x41ac,%edx
+    135b:	eb 05                	jmp    1362 <largefree+0x1c>
+    135d:	8d 50 08             	lea    0x8(%eax),%edx
+    prev = p;
+    1360:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+    1362:	8b 02                	mov    (%edx),%eax
+    1364:	85 c0                	test   %eax,%eax
+    1366:	74 04                	je     136c <largefree+0x26>
+    1368:	39 c8                	cmp    %ecx,%eax
+    136a:	72 f1                	jb     135d <largefree+0x17>
+  b->next = p;
+    136c:	89 41 08             	mov    %eax,0x8(%ecx)
+  if(p && (char*)b + b->h.size == (char*)p){
+    136f:	85 c0                	test   %eax,%eax
+    1371:	74 09                	je     137c <largefree+0x36>
+    1373:	8b 31                	mov    (%ecx),%esi
+    1375:	8d 3c 31             	lea    (%ecx,%esi,1),%edi
+    1378:	39 c7                	cmp    %eax,%edi
+    137a:	74 21                	je     139d <largefree+0x57>
+    b->h.size += p->h.size;
+    b->next = p->next;
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+    137c:	85 db                	test   %ebx,%ebx
+    137e:	74 09                	je     1389 <largefree+0x43>
+    1380:	8b 03                	mov    (%ebx),%eax
+    1382:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+    1385:	39 ce                	cmp    %ecx,%esi
+    1387:	74 20                	je     13a9 <largefree+0x63>
+    prev->h.size += b->h.size;
+    prev->next = b->next;
+  } else
+    *pp = b;
+    1389:	89 0a                	mov    %ecx,(%edx)
+
+  // Give the top of the heap back.  With threads sharing the
+  // address space sbrk() cannot shrink it; keep the block then.
+  for(pp = &large; (*pp)->next; pp = &(*pp)->next)
+    138b:	be ac 41 00 00       	mov    $0x41ac,%esi
+    1390:	8b 1e                	mov    (%esi),%ebx
+    1392:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+    1396:	74 1d                	je     13b5 <largefree+0x6f>
+    1398:	8d 73 08             	lea    0x8(%ebx),%esi
+    139b:	eb f3                	jmp    1390 <largefree+0x4a>
+    b->h.size += p->h.size;
+    139d:	03 30                	add    (%eax),%esi
+    139f:	89 31                	mov    %esi,(%ecx)
+    b->next = p->next;
+    13a1:	8b 40 08             	mov    0x8(%eax),%eax
+    13a4:	89 41 08             	mov    %eax,0x8(%ecx)
+    13a7:	eb d3                	jmp    137c <largefree+0x36>
+    prev->h.size += b->h.size;
+    13a9:	03 01                	add    (%ecx),%eax
+    13ab:	89 03                	mov    %eax,(%ebx)
+    prev->next = b->next;
+    13ad:	8b 41 08             	mov    0x8(%ecx),%eax
+    13b0:	89 43 08             	mov    %eax,0x8(%ebx)
+    13b3:	eb d6                	jmp    138b <largefree+0x45>
+    ;
+  b = *pp;
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+    13b5:	89 df                	mov    %ebx,%edi
+    13b7:	03 3b                	add    (%ebx),%edi
+    13b9:	83 ec 0c             	sub    $0xc,%esp
+    13bc:	6a 00                	push   $0x0
+    13be:	e8 93 fa ff ff       	call   e56 <sbrk>
+    13c3:	83 c4 10             	add    $0x10,%esp
+    13c6:	39 c7                	cmp    %eax,%edi
+    13c8:	74 08                	je     13d2 <largefree+0x8c>
+    *pp = 0;
+}
+    13ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    13cd:	5b                   	pop    %ebx
+    13ce:	5e                   	pop    %esi
+    13cf:	5f                   	pop    %edi
+    13d0:	5d                   	pop    %ebp
+    13d1:	c3                   	ret
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+    13d2:	8b 03                	mov    (%ebx),%eax
+    13d4:	f7 d8                	neg    %eax
+    13d6:	83 ec 0c             	sub    $0xc,%esp
+    13d9:	50                   	push   %eax
+    13da:	e8 77 fa ff ff       	call   e56 <sbrk>
+    13df:	83 c4 10             	add    $0x10,%esp
+    13e2:	83 f8 ff             	cmp    $0xffffffff,%eax
+    13e5:	74 e3                	je     13ca <largefree+0x84>
+    *pp = 0;
+    13e7:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+    13ed:	eb db                	jmp    13ca <largefree+0x84>
+
+000013ef <more>:
+{
+    13ef:	55                   	push   %ebp
+    13f0:	89 e5                	mov    %esp,%ebp
+    13f2:	56                   	push   %esi
+    13f3:	53                   	push   %ebx
+    13f4:	89 c6                	mov    %eax,%esi
+  pad = -(uint)sbrk(0) & 7;
+    13f6:	83 ec 0c             	sub    $0xc,%esp
+    13f9:	6a 00                	push   $0x0
+    13fb:	e8 56 fa ff ff       	call   e56 <sbrk>
+    1400:	f7 d8                	neg    %eax
+    1402:	89 c3                	mov    %eax,%ebx
+    1404:	83 e3 07             	and    $0x7,%ebx
+  if((p = sbrk(n + pad)) == (char*)-1)
+    1407:	01 de                	add    %ebx,%esi
+    1409:	89 34 24             	mov    %esi,(%esp)
+    140c:	e8 45 fa ff ff       	call   e56 <sbrk>
+    1411:	83 c4 10             	add    $0x10,%esp
+    1414:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1417:	74 09                	je     1422 <more+0x33>
+  return p + pad;
+    1419:	01 d8                	add    %ebx,%eax
+}
+    141b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    141e:	5b                   	pop    %ebx
+    141f:	5e                   	pop    %esi
+    1420:	5d                   	pop    %ebp
+    1421:	c3                   	ret
+    return 0;
+    1422:	b8 00 00 00 00       	mov    $0x0,%eax
+    1427:	eb f2                	jmp    141b <more+0x2c>
+
+00001429 <slaballoc>:
+{
+    1429:	55                   	push   %ebp
+    142a:	89 e5                	mov    %esp,%ebp
+    142c:	56                   	push   %esi
+    142d:	53                   	push   %ebx
+    142e:	89 c6                	mov    %eax,%esi
+  n = 1 << (MINSHIFT + c);
+    1430:	8d 48 04             	lea    0x4(%eax),%ecx
+    1433:	bb 01 00 00 00       	mov    $0x1,%ebx
+    1438:	d3 e3                	shl    %cl,%ebx
+  if(slab + n > slabend){
+    143a:	89 d8                	mov    %ebx,%eax
+    143c:	03 05 a8 41 00 00    	add    0x41a8,%eax
+    1442:	39 05 a4 41 00 00    	cmp    %eax,0x41a4
+    1448:	72 17                	jb     1461 <slaballoc+0x38>
+  h = (Header*)slab;
+    144a:	a1 a8 41 00 00       	mov    0x41a8,%eax
+  slab += n;
+    144f:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+    1452:	89 15 a8 41 00 00    	mov    %edx,0x41a8
+  h->size = n;
+    1458:	89 18                	mov    %ebx,(%eax)
+  h->class = c;
+    145a:	89 70 04             	mov    %esi,0x4(%eax)
+}
+    145d:	5b                   	pop    %ebx
+    145e:	5e                   	pop    %esi
+    145f:	5d                   	pop    %ebp
+    1460:	c3                   	ret
+    if((p = more(SLABSZ)) == 0)
+    1461:	b8 00 40 00 00       	mov    $0x4000,%eax
+    1466:	e8 84 ff ff ff       	call   13ef <more>
+    146b:	85 c0                	test   %eax,%eax
+    146d:	74 ee                	je     145d <slaballoc+0x34>
+    if(p != slabend)
+    146f:	39 05 a4 41 00 00    	cmp    %eax,0x41a4
+    1475:	74 05                	je     147c <slaballoc+0x53>
+      slab = p;
+    1477:	a3 a8 41 00 00       	mov    %eax,0x41a8
+    slabend = p + SLABSZ;
+    147c:	05 00 40 00 00       	add    $0x4000,%eax
+    1481:	a3 a4 41 00 00       	mov    %eax,0x41a4
+    1486:	eb c2                	jmp    144a <slaballoc+0x21>
+
+00001488 <largealloc>:
+{
+    1488:	55                   	push   %ebp
+    1489:	89 e5                	mov    %esp,%ebp
+    148b:	56                   	push   %esi
+    148c:	53                   	push   %ebx
+    148d:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+    148f:	b9 ac 41 00 00       	mov    $0x41ac,%ecx
+    1494:	8b 01                	mov    (%ecx),%eax
+    1496:	85 c0                	test   %eax,%eax
+    1498:	74 36                	je     14d0 <largealloc+0x48>
+    if(b->h.size < n)
+    149a:	8b 10                	mov    (%eax),%edx
+    149c:	39 da                	cmp    %ebx,%edx
+    149e:	72 24                	jb     14c4 <largealloc+0x3c>
+    if(b->h.size - n > SMALLMAX){
+    14a0:	29 da                	sub    %ebx,%edx
+    14a2:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+    14a8:	76 1f                	jbe    14c9 <largealloc+0x41>
+      rest = (Fblock*)((char*)b + n);
+    14aa:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+      rest->h.size = b->h.size - n;
+    14ad:	89 16                	mov    %edx,(%esi)
+      rest->h.class = LARGE;
+    14af:	c7 46 04 09 00 00 00 	movl   $0x9,0x4(%esi)
+      rest->next = b->next;
+    14b6:	8b 50 08             	mov    0x8(%eax),%edx
+    14b9:	89 56 08             	mov    %edx,0x8(%esi)
+      *pp = rest;
+    14bc:	89 31                	mov    %esi,(%ecx)
+      b->h.size = n;
+    14be:	89 18                	mov    %ebx,(%eax)
+}
+    14c0:	5b                   	pop    %ebx
+    14c1:	5e                   	pop    %esi
+    14c2:	5d                   	pop    %ebp
+    14c3:	c3                   	ret
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+    14c4:	8d 48 08             	lea    0x8(%eax),%ecx
+    14c7:	eb cb                	jmp    1494 <largealloc+0xc>
+      *pp = b->next;
+    14c9:	8b 50 08             	mov    0x8(%eax),%edx
+    14cc:	89 11                	mov    %edx,(%ecx)
+    return &b->h;
+    14ce:	eb f0                	jmp    14c0 <largealloc+0x38>
+  if((b = more(n)) == 0)
+    14d0:	89 d8                	mov    %ebx,%eax
+    14d2:	e8 18 ff ff ff       	call   13ef <more>
+    14d7:	85 c0                	test   %eax,%eax
+    14d9:	74 e5                	je     14c0 <largealloc+0x38>
+  b->h.size = n;
+    14db:	89 18                	mov    %ebx,(%eax)
+  b->h.class = LARGE;
+    14dd:	c7 40 04 09 00 00 00 	movl   $0x9,0x4(%eax)
+  return &b->h;
+    14e4:	eb da                	jmp    14c0 <largealloc+0x38>
+
+000014e6 <free>:
+
+void
+free(void *ap)
+{
+    14e6:	55                   	push   %ebp
+    14e7:	89 e5                	mov    %esp,%ebp
+    14e9:	56                   	push   %esi
+    14ea:	53                   	push   %ebx
+    14eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+
+  if(ap == 0)
+    14ee:	85 db                	test   %ebx,%ebx
+    14f0:	74 3b                	je     152d <free+0x47>
+    return;
+  h = (Header*)ap - 1;
+    14f2:	8d 73 f8             	lea    -0x8(%ebx),%esi
+  lock_acquire(&lock);
+    14f5:	83 ec 0c             	sub    $0xc,%esp
+    14f8:	68 a0 41 00 00       	push   $0x41a0
+    14fd:	e8 9c 01 00 00       	call   169e <lock_acquire>
+  if(h->class == LARGE)
+    1502:	8b 43 fc             	mov    -0x4(%ebx),%eax
+    1505:	83 c4 10             	add    $0x10,%esp
+    1508:	83 f8 09             	cmp    $0x9,%eax
+    150b:	74 27                	je     1534 <free+0x4e>
+    largefree((Fblock*)h);
+  else {
+    ((Fblock*)h)->next = freelist[h->class];
+    150d:	8b 14 85 c0 41 00 00 	mov    0x41c0(,%eax,4),%edx
+    1514:	89 13                	mov    %edx,(%ebx)
+    freelist[h->class] = (Fblock*)h;
+    1516:	89 34 85 c0 41 00 00 	mov    %esi,0x41c0(,%eax,4)
+  }
+  lock_release(&lock);
+    151d:	83 ec 0c             	sub    $0xc,%esp
+    1520:	68 a0 41 00 00       	push   $0x41a0
+    1525:	e8 88 01 00 00       	call   16b2 <lock_release>
+    152a:	83 c4 10             	add    $0x10,%esp
+}
+    152d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1530:	5b                   	pop    %ebx
+    1531:	5e                   	pop    %esi
+    1532:	5d                   	pop    %ebp
+    1533:	c3                   	ret
+    largefree((Fblock*)h);
+    1534:	89 f0                	mov    %esi,%eax
+    1536:	e8 0b fe ff ff       	call   1346 <largefree>
+    153b:	eb e0                	jmp    151d <free+0x37>
+
+0000153d <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    153d:	55                   	push   %ebp
+    153e:	89 e5                	mov    %esp,%ebp
+    1540:	53                   	push   %ebx
+    1541:	83 ec 04             	sub    $0x4,%esp
+    1544:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+  uint n;
+  int c;
+
+  if(nbytes > 0x7fffffff - sizeof(Header) - 7)
+    1547:	81 fb f0 ff ff 7f    	cmp    $0x7ffffff0,%ebx
+    154d:	0f 87 8b 00 00 00    	ja     15de <malloc+0xa1>
+    return 0;
+  n = (nbytes + sizeof(Header) + 7) & ~7;
+    1553:	83 c3 0f             	add    $0xf,%ebx
+    1556:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(n < sizeof(Fblock))
+    1559:	83 fb 0b             	cmp    $0xb,%ebx
+    155c:	77 05                	ja     1563 <malloc+0x26>
+    n = sizeof(Fblock);
+    155e:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  lock_acquire(&lock);
+    1563:	83 ec 0c             	sub    $0xc,%esp
+    1566:	68 a0 41 00 00       	push   $0x41a0
+    156b:	e8 2e 01 00 00       	call   169e <lock_acquire>
+  if(n <= SMALLMAX){
+    1570:	83 c4 10             	add    $0x10,%esp
+    1573:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+    1579:	77 58                	ja     15d3 <malloc+0x96>
+    for(c = 0; (1 << (MINSHIFT + c)) < n; c++)
+    157b:	ba 00 00 00 00       	mov    $0x0,%edx
+    1580:	eb 03                	jmp    1585 <malloc+0x48>
+    1582:	83 c2 01             	add    $0x1,%edx
+    1585:	8d 4a 04             	lea    0x4(%edx),%ecx
+    1588:	b8 01 00 00 00       	mov    $0x1,%eax
+    158d:	d3 e0                	shl    %cl,%eax
+    158f:	39 d8                	cmp    %ebx,%eax
+    1591:	72 ef                	jb     1582 <malloc+0x45>
+      ;
+    if(freelist[c]){
+    1593:	8b 04 95 c0 41 00 00 	mov    0x41c0(,%edx,4),%eax
+    159a:	85 c0                	test   %eax,%eax
+    159c:	74 2a                	je     15c8 <malloc+0x8b>
+      h = &freelist[c]->h;
+    159e:	89 c3                	mov    %eax,%ebx
+      freelist[c] = freelist[c]->next;
+    15a0:	8b 40 08             	mov    0x8(%eax),%eax
+    15a3:	89 04 95 c0 41 00 00 	mov    %eax,0x41c0(,%edx,4)
+    } else
+      h = slaballoc(c);
+  } else
+    h = largealloc(n);
+  lock_release(&lock);
+    15aa:	83 ec 0c             	sub    $0xc,%esp
+    15ad:	68 a0 41 00 00       	push   $0x41a0
+    15b2:	e8 fb 00 00 00       	call   16b2 <lock_release>
+  return h ? (void*)(h + 1) : 0;
+    15b7:	83 c4 10             	add    $0x10,%esp
+    15ba:	85 db                	test   %ebx,%ebx
+    15bc:	74 03                	je     15c1 <malloc+0x84>
+    15be:	83 c3 08             	add    $0x8,%ebx
+}
+    15c1:	89 d8                	mov    %ebx,%eax
+    15c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    15c6:	c9                   	leave
+    15c7:	c3                   	ret
+      h = slaballoc(c);
+    15c8:	89 d0                	mov    %edx,%eax
+    15ca:	e8 5a fe ff ff       	call   1429 <slaballoc>
+    15cf:	89 c3                	mov    %eax,%ebx
+    15d1:	eb d7                	jmp    15aa <malloc+0x6d>
+    h = largealloc(n);
+    15d3:	89 d8                	mov    %ebx,%eax
+    15d5:	e8 ae fe ff ff       	call   1488 <largealloc>
+    15da:	89 c3                	mov    %eax,%ebx
+    15dc:	eb cc                	jmp    15aa <malloc+0x6d>
+    return 0;
+    15de:	bb 00 00 00 00       	mov    $0x0,%ebx
+    15e3:	eb dc                	jmp    15c1 <malloc+0x84>
+
+000015e5 <tstart>:
+  void *arg;
+};
+
+static void
+tstart(void *a)
+{
+    15e5:	55                   	push   %ebp
+    15e6:	89 e5                	mov    %esp,%ebp
+    15e8:	83 ec 14             	sub    $0x14,%esp
+    15eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+    15ee:	ff 70 04             	push   0x4(%eax)
+    15f1:	ff 10                	call   *(%eax)
+  exit();
+    15f3:	e8 86 f6 ff ff       	call   c7e <exit>
+
+000015f8 <thread_create>:
+}
+
+// Run fn(arg) in a new thread.  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    15f8:	55                   	push   %ebp
+    15f9:	89 e5                	mov    %esp,%ebp
+    15fb:	56                   	push   %esi
+    15fc:	53                   	push   %ebx
+  struct tstart *t;
+  char *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    15fd:	83 ec 0c             	sub    $0xc,%esp
+    1600:	68 00 10 00 00       	push   $0x1000
+    1605:	e8 33 ff ff ff       	call   153d <malloc>
+    160a:	83 c4 10             	add    $0x10,%esp
+    160d:	85 c0                	test   %eax,%eax
+    160f:	74 42                	je     1653 <thread_create+0x5b>
+    1611:	89 c3                	mov    %eax,%ebx
+    return -1;
+  t = (struct tstart*)stack;
+  t->fn = fn;
+    1613:	8b 45 08             	mov    0x8(%ebp),%eax
+    1616:	89 03                	mov    %eax,(%ebx)
+  t->arg = arg;
+    1618:	8b 45 0c             	mov    0xc(%ebp),%eax
+    161b:	89 43 04             	mov    %eax,0x4(%ebx)
+  if((pid = clone(tstart, stack + TSTACK, t)) < 0)
+    161e:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    1624:	83 ec 04             	sub    $0x4,%esp
+    1627:	53                   	push   %ebx
+    1628:	50                   	push   %eax
+    1629:	68 e5 15 00 00       	push   $0x15e5
+    162e:	e8 f5 f8 ff ff       	call   f28 <clone>
+    1633:	89 c6                	mov    %eax,%esi
+    1635:	83 c4 10             	add    $0x10,%esp
+    1638:	85 c0                	test   %eax,%eax
+    163a:	78 09                	js     1645 <thread_create+0x4d>
+    free(stack);
+  return pid;
+}
+    163c:	89 f0                	mov    %esi,%eax
+    163e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1641:	5b                   	pop    %ebx
+    1642:	5e                   	pop    %esi
+    1643:	5d                   	pop    %ebp
+    1644:	c3                   	ret
+    free(stack);
+    1645:	83 ec 0c             	sub    $0xc,%esp
+    1648:	53                   	push   %ebx
+    1649:	e8 98 fe ff ff       	call   14e6 <free>
+    164e:	83 c4 10             	add    $0x10,%esp
+    1651:	eb e9                	jmp    163c <thread_create+0x44>
+    return -1;
+    1653:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1658:	eb e2                	jmp    163c <thread_create+0x44>
+
+0000165a <thread_join>:
+
+// Wait for one of this process's threads to exit and free its
+// stack.  Returns its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+    165a:	55                   	push   %ebp
+    165b:	89 e5                	mov    %esp,%ebp
+    165d:	53                   	push   %ebx
+    165e:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    1661:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1664:	50                   	push   %eax
+    1665:	e8 cd f8 ff ff       	call   f37 <join>
+    166a:	89 c3                	mov    %eax,%ebx
+    166c:	83 c4 10             	add    $0x10,%esp
+    166f:	85 c0                	test   %eax,%eax
+    1671:	79 07                	jns    167a <thread_join+0x20>
+    free((char*)stack - TSTACK);
+  return pid;
+}
+    1673:	89 d8                	mov    %ebx,%eax
+    1675:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1678:	c9                   	leave
+    1679:	c3                   	ret
+    free((char*)stack - TSTACK);
+    167a:	83 ec 0c             	sub    $0xc,%esp
+    167d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1680:	2d 00 10 00 00       	sub    $0x1000,%eax
+    1685:	50                   	push   %eax
+    1686:	e8 5b fe ff ff       	call   14e6 <free>
+    168b:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    168e:	eb e3                	jmp    1673 <thread_join+0x19>
+
+00001690 <lock_init>:
+
+void
+lock_init(lock_t *lk)
+{
+    1690:	55                   	push   %ebp
+    1691:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    1693:	8b 45 08             	mov    0x8(%ebp),%eax
+    1696:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    169c:	5d                   	pop    %ebp
+    169d:	c3                   	ret
+
+0000169e <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+    169e:	55                   	push   %ebp
+    169f:	89 e5                	mov    %esp,%ebp
+    16a1:	8b 55 08             	mov    0x8(%ebp),%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    16a4:	b8 01 00 00 00       	mov    $0x1,%eax
+    16a9:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    16ac:	85 c0                	test   %eax,%eax
+    16ae:	75 f4                	jne    16a4 <lock_acquire+0x6>
+    ;
+}
+    16b0:	5d                   	pop    %ebp
+    16b1:	c3                   	ret
+
+000016b2 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+    16b2:	55                   	push   %ebp
+    16b3:	89 e5                	mov    %esp,%ebp
+    16b5:	8b 55 08             	mov    0x8(%ebp),%edx
+    16b8:	b8 00 00 00 00       	mov    $0x0,%eax
+    16bd:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    16c0:	5d                   	pop    %ebp
+    16c1:	c3                   	ret
+
+000016c2 <mutex_init>:
+// Are Tricky": state is 0 when free, 1 when held, 2 when held and
+// others may be waiting.  Unlocking an uncontended mutex costs no
+// system call.
+void
+mutex_init(mutex_t *m)
+{
+    16c2:	55                   	push   %ebp
+    16c3:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    16c5:	8b 45 08             	mov    0x8(%ebp),%eax
+    16c8:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    16ce:	5d                   	pop    %ebp
+    16cf:	c3                   	ret
+
+000016d0 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+    16d0:	55                   	push   %ebp
+    16d1:	89 e5                	mov    %esp,%ebp
+    16d3:	53                   	push   %ebx
+    16d4:	83 ec 04             	sub    $0x4,%esp
+    16d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    16da:	b8 00 00 00 00       	mov    $0x0,%eax
+    16df:	b9 01 00 00 00       	mov    $0x1,%ecx
+    16e4:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    16e8:	85 c0                	test   %eax,%eax
+    16ea:	74 29                	je     1715 <mutex_lock+0x45>
+    return;
+  if(c != 2)
+    16ec:	83 f8 02             	cmp    $0x2,%eax
+    16ef:	74 20                	je     1711 <mutex_lock+0x41>
+    16f1:	b8 02 00 00 00       	mov    $0x2,%eax
+    16f6:	f0 87 03             	lock xchg %eax,(%ebx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    16f9:	eb 16                	jmp    1711 <mutex_lock+0x41>
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    16fb:	83 ec 08             	sub    $0x8,%esp
+    16fe:	6a 02                	push   $0x2
+    1700:	53                   	push   %ebx
+    1701:	e8 40 f8 ff ff       	call   f46 <futex_wait>
+  asm volatile("lock; xchgl %0, %1" :
+    1706:	b8 02 00 00 00       	mov    $0x2,%eax
+    170b:	f0 87 03             	lock xchg %eax,(%ebx)
+    170e:	83 c4 10             	add    $0x10,%esp
+  while(c != 0){
+    1711:	85 c0                	test   %eax,%eax
+    1713:	75 e6                	jne    16fb <mutex_lock+0x2b>
+    c = xchg(&m->state, 2);
+  }
+}
+    1715:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1718:	c9                   	leave
+    1719:	c3                   	ret
+
+0000171a <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+    171a:	55                   	push   %ebp
+    171b:	89 e5                	mov    %esp,%ebp
+    171d:	83 ec 08             	sub    $0x8,%esp
+    1720:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    1723:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    1728:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    172c:	83 fa 01             	cmp    $0x1,%edx
+    172f:	75 02                	jne    1733 <mutex_unlock+0x19>
+    m->state = 0;
+    futex_wake(&m->state, 1);
+  }
+}
+    1731:	c9                   	leave
+    1732:	c3                   	ret
+    m->state = 0;
+    1733:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+    1739:	83 ec 08             	sub    $0x8,%esp
+    173c:	6a 01                	push   $0x1
+    173e:	50                   	push   %eax
+    173f:	e8 11 f8 ff ff       	call   f55 <futex_wake>
+    1744:	83 c4 10             	add    $0x10,%esp
+}
+    1747:	eb e8                	jmp    1731 <mutex_unlock+0x17>
+
+00001749 <cond_init>:
+// Condition variable: waiters sleep on a sequence number that
+// every signal bumps, so a signal between the unlock and the
+// futex_wait() in cond_wait() is not lost.
+void
+cond_init(cond_t *c)
+{
+    1749:	55                   	push   %ebp
+    174a:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    174c:	8b 45 08             	mov    0x8(%ebp),%eax
+    174f:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1755:	5d                   	pop    %ebp
+    1756:	c3                   	ret
+
+00001757 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+    1757:	55                   	push   %ebp
+    1758:	89 e5                	mov    %esp,%ebp
+    175a:	57                   	push   %edi
+    175b:	56                   	push   %esi
+    175c:	53                   	push   %ebx
+    175d:	83 ec 18             	sub    $0x18,%esp
+    1760:	8b 75 08             	mov    0x8(%ebp),%esi
+    1763:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    1766:	8b 3e                	mov    (%esi),%edi
+  mutex_unlock(m);
+    1768:	53                   	push   %ebx
+    1769:	e8 ac ff ff ff       	call   171a <mutex_unlock>
+  futex_wait(&c->seq, seq);
+    176e:	83 c4 08             	add    $0x8,%esp
+    1771:	57                   	push   %edi
+    1772:	56                   	push   %esi
+    1773:	e8 ce f7 ff ff       	call   f46 <futex_wait>
+  // Others may be waiting for m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+    1778:	83 c4 10             	add    $0x10,%esp
+    177b:	eb 0e                	jmp    178b <cond_wait+0x34>
+    futex_wait(&m->state, 2);
+    177d:	83 ec 08             	sub    $0x8,%esp
+    1780:	6a 02                	push   $0x2
+    1782:	53                   	push   %ebx
+    1783:	e8 be f7 ff ff       	call   f46 <futex_wait>
+    1788:	83 c4 10             	add    $0x10,%esp
+    178b:	b8 02 00 00 00       	mov    $0x2,%eax
+    1790:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    1793:	85 c0                	test   %eax,%eax
+    1795:	75 e6                	jne    177d <cond_wait+0x26>
+}
+    1797:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    179a:	5b                   	pop    %ebx
+    179b:	5e                   	pop    %esi
+    179c:	5f                   	pop    %edi
+    179d:	5d                   	pop    %ebp
+    179e:	c3                   	ret
+
+0000179f <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+    179f:	55                   	push   %ebp
+    17a0:	89 e5                	mov    %esp,%ebp
+    17a2:	83 ec 10             	sub    $0x10,%esp
+    17a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    17a8:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+    17ac:	6a 01                	push   $0x1
+    17ae:	50                   	push   %eax
+    17af:	e8 a1 f7 ff ff       	call   f55 <futex_wake>
+}
+    17b4:	83 c4 10             	add    $0x10,%esp
+    17b7:	c9                   	leave
+    17b8:	c3                   	ret
+
+000017b9 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+    17b9:	55                   	push   %ebp
+    17ba:	89 e5                	mov    %esp,%ebp
+    17bc:	83 ec 10             	sub    $0x10,%esp
+    17bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    17c2:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, NPROC);
+    17c6:	6a 40                	push   $0x40
+    17c8:	50                   	push   %eax
+    17c9:	e8 87 f7 ff ff       	call   f55 <futex_wake>
+}
+    17ce:	83 c4 10             	add    $0x10,%esp
+    17d1:	c9                   	leave
+    17d2:	c3                   	ret
@@ -0,0 +1,199 @@
+// scale: measure how throughput scales with the number of CPUs.
+// For 1, 2, 4, ... workers, up to the number of CPUs, it forks
+// that many workers, each pinned to its own CPU (or, with -s, left
+// for the scheduler to spread), starts them together and times
+// how long they take to do a fixed amount of work each.  The
+// workloads stress the locks that are shared by all CPUs:
+//   fault   page faults on fresh sbrk() memory (kmem)
+//   create  file creates and unlinks (log, icache)
+//   pipe    one-byte ping-pong with a partner (wakeups, run queues)
+//   bread   reads of blocks of a shared file (bcache, pcache)
+// "scale [-s] [workload...]" runs the ones named, or all.  Each
+// result is a line "scale workload workers ops/s"; "make scale"
+// runs it at several CPU counts.
+#include "types.h"
+#include "param.h"
+#include "user.h"
+#include "fcntl.h"
+#include "procinfo.h"
+#include "clock.h"
+
+#define SHAREDSZ (64*1024)     // Bytes of the bread workload's file
+
+static int spread;
+static int ncpu;
+
+static uint
+msec(void)
+{
+  struct timespec ts;
+
+  vclock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec*1000 + ts.tv_nsec/1000000;
+}
+
+static void
+fail(char *what)
+{
+  printf(2, "scale: %s failed\n", what);
+  exit();
+}
+
+// Each workload does n operations for worker w.
+static void
+fault(int w, int n)
+{
+  char *a;
+  int i, j;
+
+  for(i = 0; i < n; i += 16){
+    if((a = sbrk(16*4096)) == (char*)-1)
+      fail("sbrk");
+    for(j = 0; j < 16; j++)
+      a[j*4096] = j;
+    sbrk(-16*4096);
+  }
+}
+
+static void
+create(int w, int n)
+{
+  char name[8];
+  int i, fd;
+
+  name[0] = 's';
+  name[1] = 'a' + w;
+  name[5] = 0;
+  for(i = 0; i < n; i++){
+    name[2] = 'a' + i/676%26;
+    name[3] = 'a' + i/26%26;
+    name[4] = 'a' + i%26;
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0)
+      fail("create");
+    close(fd);
+    if(unlink(name) < 0)
+      fail("unlink");
+  }
+}
+
+static void
+pipes(int w, int n)
+{
+  int p[2], q[2], i;
+  char c;
+
+  if(pipe(p) < 0 || pipe(q) < 0)
+    fail("pipe");
+  if(fork() == 0){
+    for(i = 0; i < n; i++)
+      if(read(p[0], &c, 1) != 1 || write(q[1], &c, 1) != 1)
+        fail("pong");
+    exit();
+  }
+  for(i = 0; i < n; i++)
+    if(write(p[1], "x", 1) != 1 || read(q[0], &c, 1) != 1)
+      fail("ping");
+  wait();
+}
+
+static void
+bread(int w, int n)
+{
+  char buf[512];
+  int i, fd;
+
+  if((fd = open("scalef", O_RDONLY)) < 0)
+    fail("open");
+  for(i = 0; i < n; i++)
+    if(pread(fd, buf, sizeof(buf), (i*sizeof(buf) + w*4096) % SHAREDSZ) !=
+       sizeof(buf))
+      fail("pread");
+  close(fd);
+}
+
+static struct {
+  char *name;
+  void (*fn)(int, int);
+  int n;                       // Operations per worker
+} loads[] = {
+  { "fault",  fault,  2048 },
+  { "create", create, 100 },
+  { "pipe",   pipes,  1000 },
+  { "bread",  bread,  5000 },
+};
+
+// Run load k with nw workers and report its throughput.
+static void
+trial(int k, int nw)
+{
+  int go[2], w, pid;
+  uint t, ops;
+  char c;
+
+  if(pipe(go) < 0)
+    fail("pipe");
+  for(w = 0; w < nw; w++){
+    if((pid = fork()) < 0)
+      fail("fork");
+    if(pid == 0){
+      close(go[1]);
+      if(!spread)
+        setaffinity(getpid(), 1 << (w % ncpu));
+      if(read(go[0], &c, 1) != 1)
+        fail("start");
+      loads[k].fn(w, loads[k].n);
+      exit();
+    }
+  }
+  close(go[0]);
+  t = msec();
+  for(w = 0; w < nw; w++)
+    write(go[1], "g", 1);
+  close(go[1]);
+  for(w = 0; w < nw; w++)
+    wait();
+  t = msec() - t;
+  if(t == 0)
+    t = 1;
+  ops = nw * loads[k].n;
+  printf(1, "scale %s %d %d\n", loads[k].name, nw, ops*1000/t);
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct cpuinfo ci;
+  char buf[512];
+  int i, j, k, nw, fd, named;
+
+  i = 1;
+  if(argc > 1 && strcmp(argv[1], "-s") == 0){
+    spread = 1;
+    i++;
+  }
+  named = i < argc;
+  for(ncpu = 0; getcpuinfo(ncpu, &ci) == 0; ncpu++)
+    ;
+
+  memset(buf, 's', sizeof(buf));
+  if((fd = open("scalef", O_CREATE|O_RDWR)) < 0)
+    fail("create");
+  for(j = 0; j < SHAREDSZ; j += sizeof(buf))
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf))
+      fail("write");
+  close(fd);
+
+  printf(1, "scale cpus %d\n", ncpu);
+  for(k = 0; k < sizeof(loads)/sizeof(loads[0]); k++){
+    for(j = i; j < argc && strcmp(argv[j], loads[k].name) != 0; j++)
+      ;
+    if(named && j == argc)
+      continue;
+    for(nw = 1; nw < ncpu; nw *= 2)
+      trial(k, nw);
+    trial(k, ncpu);
+  }
+  unlink("scalef");
+  printf(1, "scale done\n");
+  exit();
+}
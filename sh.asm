@@ -0,0 +1,4389 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <getcmd>:
+  }
+}
+
+int
+getcmd(char *buf, int nbuf)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	56                   	push   %esi
+       4:	53                   	push   %ebx
+       5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+       8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(2, "$ ");
+       b:	83 ec 08             	sub    $0x8,%esp
+       e:	68 90 1e 00 00       	push   $0x1e90
+      13:	6a 02                	push   $0x2
+      15:	e8 59 18 00 00       	call   1873 <printf>
+  memset(buf, 0, nbuf);
+      1a:	83 c4 0c             	add    $0xc,%esp
+      1d:	56                   	push   %esi
+      1e:	6a 00                	push   $0x0
+      20:	53                   	push   %ebx
+      21:	e8 6d 0d 00 00       	call   d93 <memset>
+  gets(buf, nbuf);
+      26:	83 c4 08             	add    $0x8,%esp
+      29:	56                   	push   %esi
+      2a:	53                   	push   %ebx
+      2b:	e8 b2 0e 00 00       	call   ee2 <gets>
+  if(buf[0] == 0) // EOF
+      30:	83 c4 10             	add    $0x10,%esp
+      33:	80 3b 00             	cmpb   $0x0,(%ebx)
+      36:	74 0c                	je     44 <getcmd+0x44>
+    return -1;
+  return 0;
+      38:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+      3d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      40:	5b                   	pop    %ebx
+      41:	5e                   	pop    %esi
+      42:	5d                   	pop    %ebp
+      43:	c3                   	ret
+    return -1;
+      44:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+      49:	eb f2                	jmp    3d <getcmd+0x3d>
+
+0000004b <panic>:
+  exit();
+}
+
+void
+panic(char *s)
+{
+      4b:	55                   	push   %ebp
+      4c:	89 e5                	mov    %esp,%ebp
+      4e:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "%s\n", s);
+      51:	ff 75 08             	push   0x8(%ebp)
+      54:	68 47 1f 00 00       	push   $0x1f47
+      59:	6a 02                	push   $0x2
+      5b:	e8 13 18 00 00       	call   1873 <printf>
+  exit();
+      60:	e8 d5 12 00 00       	call   133a <exit>
+
+00000065 <fork1>:
+}
+
+int
+fork1(void)
+{
+      65:	55                   	push   %ebp
+      66:	89 e5                	mov    %esp,%ebp
+      68:	83 ec 08             	sub    $0x8,%esp
+  int pid;
+
+  pid = fork();
+      6b:	e8 b6 12 00 00       	call   1326 <fork>
+  if(pid == -1)
+      70:	83 f8 ff             	cmp    $0xffffffff,%eax
+      73:	74 02                	je     77 <fork1+0x12>
+    panic("fork");
+  return pid;
+}
+      75:	c9                   	leave
+      76:	c3                   	ret
+    panic("fork");
+      77:	83 ec 0c             	sub    $0xc,%esp
+      7a:	68 93 1e 00 00       	push   $0x1e93
+      7f:	e8 c7 ff ff ff       	call   4b <panic>
+
+00000084 <runcmd>:
+{
+      84:	55                   	push   %ebp
+      85:	89 e5                	mov    %esp,%ebp
+      87:	53                   	push   %ebx
+      88:	83 ec 14             	sub    $0x14,%esp
+      8b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(cmd == 0)
+      8e:	85 db                	test   %ebx,%ebx
+      90:	74 0e                	je     a0 <runcmd+0x1c>
+  switch(cmd->type){
+      92:	8b 03                	mov    (%ebx),%eax
+      94:	83 f8 05             	cmp    $0x5,%eax
+      97:	77 0c                	ja     a5 <runcmd+0x21>
+      99:	ff 24 85 64 1f 00 00 	jmp    *0x1f64(,%eax,4)
+    exit();
+      a0:	e8 95 12 00 00       	call   133a <exit>
+    panic("runcmd");
+      a5:	83 ec 0c             	sub    $0xc,%esp
+      a8:	68 98 1e 00 00       	push   $0x1e98
+      ad:	e8 99 ff ff ff       	call   4b <panic>
+    if(ecmd->argv[0] == 0)
+      b2:	8b 43 04             	mov    0x4(%ebx),%eax
+      b5:	85 c0                	test   %eax,%eax
+      b7:	74 27                	je     e0 <runcmd+0x5c>
+    exec(ecmd->argv[0], ecmd->argv);
+      b9:	8d 53 04             	lea    0x4(%ebx),%edx
+      bc:	83 ec 08             	sub    $0x8,%esp
+      bf:	52                   	push   %edx
+      c0:	50                   	push   %eax
+      c1:	e8 86 12 00 00       	call   134c <exec>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+      c6:	83 c4 0c             	add    $0xc,%esp
+      c9:	ff 73 04             	push   0x4(%ebx)
+      cc:	68 9f 1e 00 00       	push   $0x1e9f
+      d1:	6a 02                	push   $0x2
+      d3:	e8 9b 17 00 00       	call   1873 <printf>
+    break;
+      d8:	83 c4 10             	add    $0x10,%esp
+  exit();
+      db:	e8 5a 12 00 00       	call   133a <exit>
+      exit();
+      e0:	e8 55 12 00 00       	call   133a <exit>
+    close(rcmd->fd);
+      e5:	83 ec 0c             	sub    $0xc,%esp
+      e8:	ff 73 14             	push   0x14(%ebx)
+      eb:	e8 79 12 00 00       	call   1369 <close>
+    if(open(rcmd->file, rcmd->mode) < 0){
+      f0:	83 c4 08             	add    $0x8,%esp
+      f3:	ff 73 10             	push   0x10(%ebx)
+      f6:	ff 73 08             	push   0x8(%ebx)
+      f9:	e8 8d 13 00 00       	call   148b <open>
+      fe:	83 c4 10             	add    $0x10,%esp
+     101:	85 c0                	test   %eax,%eax
+     103:	78 0b                	js     110 <runcmd+0x8c>
+    runcmd(rcmd->cmd);
+     105:	83 ec 0c             	sub    $0xc,%esp
+     108:	ff 73 04             	push   0x4(%ebx)
+     10b:	e8 74 ff ff ff       	call   84 <runcmd>
+      printf(2, "open %s failed\n", rcmd->file);
+     110:	83 ec 04             	sub    $0x4,%esp
+     113:	ff 73 08             	push   0x8(%ebx)
+     116:	68 af 1e 00 00       	push   $0x1eaf
+     11b:	6a 02                	push   $0x2
+     11d:	e8 51 17 00 00       	call   1873 <printf>
+      exit();
+     122:	e8 13 12 00 00       	call   133a <exit>
+    if(fork1() == 0)
+     127:	e8 39 ff ff ff       	call   65 <fork1>
+     12c:	85 c0                	test   %eax,%eax
+     12e:	75 0b                	jne    13b <runcmd+0xb7>
+      runcmd(lcmd->left);
+     130:	83 ec 0c             	sub    $0xc,%esp
+     133:	ff 73 04             	push   0x4(%ebx)
+     136:	e8 49 ff ff ff       	call   84 <runcmd>
+    wait();
+     13b:	e8 00 13 00 00       	call   1440 <wait>
+    runcmd(lcmd->right);
+     140:	83 ec 0c             	sub    $0xc,%esp
+     143:	ff 73 08             	push   0x8(%ebx)
+     146:	e8 39 ff ff ff       	call   84 <runcmd>
+    if(pipe(p) < 0)
+     14b:	83 ec 0c             	sub    $0xc,%esp
+     14e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     151:	50                   	push   %eax
+     152:	e8 f8 12 00 00       	call   144f <pipe>
+     157:	83 c4 10             	add    $0x10,%esp
+     15a:	85 c0                	test   %eax,%eax
+     15c:	78 3f                	js     19d <runcmd+0x119>
+    if(fork1() == 0){
+     15e:	e8 02 ff ff ff       	call   65 <fork1>
+     163:	85 c0                	test   %eax,%eax
+     165:	75 43                	jne    1aa <runcmd+0x126>
+      close(1);
+     167:	83 ec 0c             	sub    $0xc,%esp
+     16a:	6a 01                	push   $0x1
+     16c:	e8 f8 11 00 00       	call   1369 <close>
+      dup(p[1]);
+     171:	83 c4 04             	add    $0x4,%esp
+     174:	ff 75 f4             	push   -0xc(%ebp)
+     177:	e8 78 13 00 00       	call   14f4 <dup>
+      close(p[0]);
+     17c:	83 c4 04             	add    $0x4,%esp
+     17f:	ff 75 f0             	push   -0x10(%ebp)
+     182:	e8 e2 11 00 00       	call   1369 <close>
+      close(p[1]);
+     187:	83 c4 04             	add    $0x4,%esp
+     18a:	ff 75 f4             	push   -0xc(%ebp)
+     18d:	e8 d7 11 00 00       	call   1369 <close>
+      runcmd(pcmd->left);
+     192:	83 c4 04             	add    $0x4,%esp
+     195:	ff 73 04             	push   0x4(%ebx)
+     198:	e8 e7 fe ff ff       	call   84 <runcmd>
+      panic("pipe");
+     19d:	83 ec 0c             	sub    $0xc,%esp
+     1a0:	68 bf 1e 00 00       	push   $0x1ebf
+     1a5:	e8 a1 fe ff ff       	call   4b <panic>
+    if(fork1() == 0){
+     1aa:	e8 b6 fe ff ff       	call   65 <fork1>
+     1af:	85 c0                	test   %eax,%eax
+     1b1:	75 36                	jne    1e9 <runcmd+0x165>
+      close(0);
+     1b3:	83 ec 0c             	sub    $0xc,%esp
+     1b6:	6a 00                	push   $0x0
+     1b8:	e8 ac 11 00 00       	call   1369 <close>
+      dup(p[0]);
+     1bd:	83 c4 04             	add    $0x4,%esp
+     1c0:	ff 75 f0             	push   -0x10(%ebp)
+     1c3:	e8 2c 13 00 00       	call   14f4 <dup>
+      close(p[0]);
+     1c8:	83 c4 04             	add    $0x4,%esp
+     1cb:	ff 75 f0             	push   -0x10(%ebp)
+     1ce:	e8 96 11 00 00       	call   1369 <close>
+      close(p[1]);
+     1d3:	83 c4 04             	add    $0x4,%esp
+     1d6:	ff 75 f4             	push   -0xc(%ebp)
+     1d9:	e8 8b 11 00 00       	call   1369 <close>
+      runcmd(pcmd->right);
+     1de:	83 c4 04             	add    $0x4,%esp
+     1e1:	ff 73 08             	push   0x8(%ebx)
+     1e4:	e8 9b fe ff ff       	call   84 <runcmd>
+    close(p[0]);
+     1e9:	83 ec 0c             	sub    $0xc,%esp
+     1ec:	ff 75 f0             	push   -0x10(%ebp)
+     1ef:	e8 75 11 00 00       	call   1369 <close>
+    close(p[1]);
+     1f4:	83 c4 04             	add    $0x4,%esp
+     1f7:	ff 75 f4             	push   -0xc(%ebp)
+     1fa:	e8 6a 11 00 00       	call   1369 <close>
+    wait();
+     1ff:	e8 3c 12 00 00       	call   1440 <wait>
+    wait();
+     204:	e8 37 12 00 00       	call   1440 <wait>
+    break;
+     209:	83 c4 10             	add    $0x10,%esp
+     20c:	e9 ca fe ff ff       	jmp    db <runcmd+0x57>
+    if(fork1() == 0)
+     211:	e8 4f fe ff ff       	call   65 <fork1>
+     216:	85 c0                	test   %eax,%eax
+     218:	0f 85 bd fe ff ff    	jne    db <runcmd+0x57>
+      runcmd(bcmd->cmd);
+     21e:	83 ec 0c             	sub    $0xc,%esp
+     221:	ff 73 04             	push   0x4(%ebx)
+     224:	e8 5b fe ff ff       	call   84 <runcmd>
+
+00000229 <spawncmd>:
+{
+     229:	55                   	push   %ebp
+     22a:	89 e5                	mov    %esp,%ebp
+     22c:	57                   	push   %edi
+     22d:	56                   	push   %esi
+     22e:	53                   	push   %ebx
+     22f:	83 ec 2c             	sub    $0x2c,%esp
+     232:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(cmd == 0)
+     235:	85 f6                	test   %esi,%esi
+     237:	0f 84 fc 01 00 00    	je     439 <spawncmd+0x210>
+  switch(cmd->type){
+     23d:	8b 1e                	mov    (%esi),%ebx
+     23f:	83 fb 02             	cmp    $0x2,%ebx
+     242:	74 72                	je     2b6 <spawncmd+0x8d>
+     244:	83 fb 03             	cmp    $0x3,%ebx
+     247:	0f 84 e2 00 00 00    	je     32f <spawncmd+0x106>
+     24d:	83 fb 01             	cmp    $0x1,%ebx
+     250:	74 1f                	je     271 <spawncmd+0x48>
+    if((fd = fork()) < 0){
+     252:	e8 cf 10 00 00       	call   1326 <fork>
+     257:	89 c3                	mov    %eax,%ebx
+     259:	85 c0                	test   %eax,%eax
+     25b:	0f 88 77 01 00 00    	js     3d8 <spawncmd+0x1af>
+    if(fd == 0){
+     261:	0f 84 8d 01 00 00    	je     3f4 <spawncmd+0x1cb>
+    return 1;
+     267:	bb 01 00 00 00       	mov    $0x1,%ebx
+     26c:	e9 cd 01 00 00       	jmp    43e <spawncmd+0x215>
+    if(ecmd->argv[0] == 0)
+     271:	8b 46 04             	mov    0x4(%esi),%eax
+     274:	85 c0                	test   %eax,%eax
+     276:	0f 84 cc 01 00 00    	je     448 <spawncmd+0x21f>
+    if(spawn(ecmd->argv[0], ecmd->argv, fds) < 0){
+     27c:	8d 56 04             	lea    0x4(%esi),%edx
+     27f:	83 ec 04             	sub    $0x4,%esp
+     282:	ff 75 0c             	push   0xc(%ebp)
+     285:	52                   	push   %edx
+     286:	50                   	push   %eax
+     287:	e8 0d 13 00 00       	call   1599 <spawn>
+     28c:	83 c4 10             	add    $0x10,%esp
+     28f:	85 c0                	test   %eax,%eax
+     291:	0f 89 a7 01 00 00    	jns    43e <spawncmd+0x215>
+      printf(2, "exec %s failed\n", ecmd->argv[0]);
+     297:	83 ec 04             	sub    $0x4,%esp
+     29a:	ff 76 04             	push   0x4(%esi)
+     29d:	68 9f 1e 00 00       	push   $0x1e9f
+     2a2:	6a 02                	push   $0x2
+     2a4:	e8 ca 15 00 00       	call   1873 <printf>
+      return 0;
+     2a9:	83 c4 10             	add    $0x10,%esp
+     2ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+     2b1:	e9 88 01 00 00       	jmp    43e <spawncmd+0x215>
+    if((fd = open(rcmd->file, rcmd->mode)) < 0){
+     2b6:	83 ec 08             	sub    $0x8,%esp
+     2b9:	ff 76 10             	push   0x10(%esi)
+     2bc:	ff 76 08             	push   0x8(%esi)
+     2bf:	e8 c7 11 00 00       	call   148b <open>
+     2c4:	89 c7                	mov    %eax,%edi
+     2c6:	83 c4 10             	add    $0x10,%esp
+     2c9:	85 c0                	test   %eax,%eax
+     2cb:	78 43                	js     310 <spawncmd+0xe7>
+    if(fd > maxfd)
+     2cd:	39 05 28 2a 00 00    	cmp    %eax,0x2a28
+     2d3:	7d 05                	jge    2da <spawncmd+0xb1>
+      maxfd = fd;
+     2d5:	a3 28 2a 00 00       	mov    %eax,0x2a28
+    memmove(nfds, fds, sizeof(nfds));
+     2da:	83 ec 04             	sub    $0x4,%esp
+     2dd:	6a 0c                	push   $0xc
+     2df:	ff 75 0c             	push   0xc(%ebp)
+     2e2:	8d 5d d4             	lea    -0x2c(%ebp),%ebx
+     2e5:	53                   	push   %ebx
+     2e6:	e8 7e 0c 00 00       	call   f69 <memmove>
+    nfds[rcmd->fd] = fd;
+     2eb:	8b 46 14             	mov    0x14(%esi),%eax
+     2ee:	89 7c 85 d4          	mov    %edi,-0x2c(%ebp,%eax,4)
+    n = spawncmd(rcmd->cmd, nfds);
+     2f2:	83 c4 08             	add    $0x8,%esp
+     2f5:	53                   	push   %ebx
+     2f6:	ff 76 04             	push   0x4(%esi)
+     2f9:	e8 2b ff ff ff       	call   229 <spawncmd>
+     2fe:	89 c3                	mov    %eax,%ebx
+    close(fd);
+     300:	89 3c 24             	mov    %edi,(%esp)
+     303:	e8 61 10 00 00       	call   1369 <close>
+    return n;
+     308:	83 c4 10             	add    $0x10,%esp
+     30b:	e9 2e 01 00 00       	jmp    43e <spawncmd+0x215>
+      printf(2, "open %s failed\n", rcmd->file);
+     310:	83 ec 04             	sub    $0x4,%esp
+     313:	ff 76 08             	push   0x8(%esi)
+     316:	68 af 1e 00 00       	push   $0x1eaf
+     31b:	6a 02                	push   $0x2
+     31d:	e8 51 15 00 00       	call   1873 <printf>
+      return 0;
+     322:	83 c4 10             	add    $0x10,%esp
+     325:	bb 00 00 00 00       	mov    $0x0,%ebx
+     32a:	e9 0f 01 00 00       	jmp    43e <spawncmd+0x215>
+    if(pipe(p) < 0){
+     32f:	83 ec 0c             	sub    $0xc,%esp
+     332:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     335:	50                   	push   %eax
+     336:	e8 14 11 00 00       	call   144f <pipe>
+     33b:	83 c4 10             	add    $0x10,%esp
+     33e:	85 c0                	test   %eax,%eax
+     340:	78 7d                	js     3bf <spawncmd+0x196>
+    if(p[0] > maxfd)
+     342:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     345:	3b 05 28 2a 00 00    	cmp    0x2a28,%eax
+     34b:	7e 05                	jle    352 <spawncmd+0x129>
+      maxfd = p[0];
+     34d:	a3 28 2a 00 00       	mov    %eax,0x2a28
+    if(p[1] > maxfd)
+     352:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     355:	3b 05 28 2a 00 00    	cmp    0x2a28,%eax
+     35b:	7e 05                	jle    362 <spawncmd+0x139>
+      maxfd = p[1];
+     35d:	a3 28 2a 00 00       	mov    %eax,0x2a28
+    memmove(nfds, fds, sizeof(nfds));
+     362:	83 ec 04             	sub    $0x4,%esp
+     365:	6a 0c                	push   $0xc
+     367:	ff 75 0c             	push   0xc(%ebp)
+     36a:	8d 7d d4             	lea    -0x2c(%ebp),%edi
+     36d:	57                   	push   %edi
+     36e:	e8 f6 0b 00 00       	call   f69 <memmove>
+    nfds[1] = p[1];
+     373:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     376:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    n = spawncmd(pcmd->left, nfds);
+     379:	83 c4 08             	add    $0x8,%esp
+     37c:	57                   	push   %edi
+     37d:	ff 76 04             	push   0x4(%esi)
+     380:	e8 a4 fe ff ff       	call   229 <spawncmd>
+     385:	89 c3                	mov    %eax,%ebx
+    close(p[1]);
+     387:	83 c4 04             	add    $0x4,%esp
+     38a:	ff 75 e4             	push   -0x1c(%ebp)
+     38d:	e8 d7 0f 00 00       	call   1369 <close>
+    nfds[0] = p[0];
+     392:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     395:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    nfds[1] = fds[1];
+     398:	8b 45 0c             	mov    0xc(%ebp),%eax
+     39b:	8b 40 04             	mov    0x4(%eax),%eax
+     39e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    n += spawncmd(pcmd->right, nfds);
+     3a1:	83 c4 08             	add    $0x8,%esp
+     3a4:	57                   	push   %edi
+     3a5:	ff 76 08             	push   0x8(%esi)
+     3a8:	e8 7c fe ff ff       	call   229 <spawncmd>
+     3ad:	01 c3                	add    %eax,%ebx
+    close(p[0]);
+     3af:	83 c4 04             	add    $0x4,%esp
+     3b2:	ff 75 e0             	push   -0x20(%ebp)
+     3b5:	e8 af 0f 00 00       	call   1369 <close>
+    return n;
+     3ba:	83 c4 10             	add    $0x10,%esp
+     3bd:	eb 7f                	jmp    43e <spawncmd+0x215>
+      printf(2, "pipe failed\n");
+     3bf:	83 ec 08             	sub    $0x8,%esp
+     3c2:	68 c4 1e 00 00       	push   $0x1ec4
+     3c7:	6a 02                	push   $0x2
+     3c9:	e8 a5 14 00 00       	call   1873 <printf>
+      return 0;
+     3ce:	83 c4 10             	add    $0x10,%esp
+     3d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+     3d6:	eb 66                	jmp    43e <spawncmd+0x215>
+      printf(2, "fork failed\n");
+     3d8:	83 ec 08             	sub    $0x8,%esp
+     3db:	68 d1 1e 00 00       	push   $0x1ed1
+     3e0:	6a 02                	push   $0x2
+     3e2:	e8 8c 14 00 00       	call   1873 <printf>
+      return 0;
+     3e7:	83 c4 10             	add    $0x10,%esp
+     3ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+     3ef:	eb 4d                	jmp    43e <spawncmd+0x215>
+      for(fd = 0; fd < 3; fd++)
+     3f1:	83 c3 01             	add    $0x1,%ebx
+     3f4:	83 fb 02             	cmp    $0x2,%ebx
+     3f7:	7f 19                	jg     412 <spawncmd+0x1e9>
+        if(fds[fd] != fd)
+     3f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     3fc:	8b 04 98             	mov    (%eax,%ebx,4),%eax
+     3ff:	39 d8                	cmp    %ebx,%eax
+     401:	74 ee                	je     3f1 <spawncmd+0x1c8>
+          dup2(fds[fd], fd);
+     403:	83 ec 08             	sub    $0x8,%esp
+     406:	53                   	push   %ebx
+     407:	50                   	push   %eax
+     408:	e8 bf 0f 00 00       	call   13cc <dup2>
+     40d:	83 c4 10             	add    $0x10,%esp
+     410:	eb df                	jmp    3f1 <spawncmd+0x1c8>
+      for(fd = 3; fd <= maxfd; fd++)
+     412:	bb 03 00 00 00       	mov    $0x3,%ebx
+     417:	eb 0f                	jmp    428 <spawncmd+0x1ff>
+        close(fd);
+     419:	83 ec 0c             	sub    $0xc,%esp
+     41c:	53                   	push   %ebx
+     41d:	e8 47 0f 00 00       	call   1369 <close>
+      for(fd = 3; fd <= maxfd; fd++)
+     422:	83 c3 01             	add    $0x1,%ebx
+     425:	83 c4 10             	add    $0x10,%esp
+     428:	39 1d 28 2a 00 00    	cmp    %ebx,0x2a28
+     42e:	7d e9                	jge    419 <spawncmd+0x1f0>
+      runcmd(cmd);
+     430:	83 ec 0c             	sub    $0xc,%esp
+     433:	56                   	push   %esi
+     434:	e8 4b fc ff ff       	call   84 <runcmd>
+    return 0;
+     439:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+     43e:	89 d8                	mov    %ebx,%eax
+     440:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     443:	5b                   	pop    %ebx
+     444:	5e                   	pop    %esi
+     445:	5f                   	pop    %edi
+     446:	5d                   	pop    %ebp
+     447:	c3                   	ret
+      return 0;
+     448:	bb 00 00 00 00       	mov    $0x0,%ebx
+     44d:	eb ef                	jmp    43e <spawncmd+0x215>
+
+0000044f <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+     44f:	55                   	push   %ebp
+     450:	89 e5                	mov    %esp,%ebp
+     452:	53                   	push   %ebx
+     453:	83 ec 10             	sub    $0x10,%esp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     456:	6a 54                	push   $0x54
+     458:	e8 9c 17 00 00       	call   1bf9 <malloc>
+     45d:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     45f:	83 c4 0c             	add    $0xc,%esp
+     462:	6a 54                	push   $0x54
+     464:	6a 00                	push   $0x0
+     466:	50                   	push   %eax
+     467:	e8 27 09 00 00       	call   d93 <memset>
+  cmd->type = EXEC;
+     46c:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  return (struct cmd*)cmd;
+}
+     472:	89 d8                	mov    %ebx,%eax
+     474:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     477:	c9                   	leave
+     478:	c3                   	ret
+
+00000479 <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     479:	55                   	push   %ebp
+     47a:	89 e5                	mov    %esp,%ebp
+     47c:	53                   	push   %ebx
+     47d:	83 ec 10             	sub    $0x10,%esp
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     480:	6a 18                	push   $0x18
+     482:	e8 72 17 00 00       	call   1bf9 <malloc>
+     487:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     489:	83 c4 0c             	add    $0xc,%esp
+     48c:	6a 18                	push   $0x18
+     48e:	6a 00                	push   $0x0
+     490:	50                   	push   %eax
+     491:	e8 fd 08 00 00       	call   d93 <memset>
+  cmd->type = REDIR;
+     496:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  cmd->cmd = subcmd;
+     49c:	8b 45 08             	mov    0x8(%ebp),%eax
+     49f:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->file = file;
+     4a2:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4a5:	89 43 08             	mov    %eax,0x8(%ebx)
+  cmd->efile = efile;
+     4a8:	8b 45 10             	mov    0x10(%ebp),%eax
+     4ab:	89 43 0c             	mov    %eax,0xc(%ebx)
+  cmd->mode = mode;
+     4ae:	8b 45 14             	mov    0x14(%ebp),%eax
+     4b1:	89 43 10             	mov    %eax,0x10(%ebx)
+  cmd->fd = fd;
+     4b4:	8b 45 18             	mov    0x18(%ebp),%eax
+     4b7:	89 43 14             	mov    %eax,0x14(%ebx)
+  return (struct cmd*)cmd;
+}
+     4ba:	89 d8                	mov    %ebx,%eax
+     4bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4bf:	c9                   	leave
+     4c0:	c3                   	ret
+
+000004c1 <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     4c1:	55                   	push   %ebp
+     4c2:	89 e5                	mov    %esp,%ebp
+     4c4:	53                   	push   %ebx
+     4c5:	83 ec 10             	sub    $0x10,%esp
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     4c8:	6a 0c                	push   $0xc
+     4ca:	e8 2a 17 00 00       	call   1bf9 <malloc>
+     4cf:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     4d1:	83 c4 0c             	add    $0xc,%esp
+     4d4:	6a 0c                	push   $0xc
+     4d6:	6a 00                	push   $0x0
+     4d8:	50                   	push   %eax
+     4d9:	e8 b5 08 00 00       	call   d93 <memset>
+  cmd->type = PIPE;
+     4de:	c7 03 03 00 00 00    	movl   $0x3,(%ebx)
+  cmd->left = left;
+     4e4:	8b 45 08             	mov    0x8(%ebp),%eax
+     4e7:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     4ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4ed:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     4f0:	89 d8                	mov    %ebx,%eax
+     4f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4f5:	c9                   	leave
+     4f6:	c3                   	ret
+
+000004f7 <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+     4f7:	55                   	push   %ebp
+     4f8:	89 e5                	mov    %esp,%ebp
+     4fa:	53                   	push   %ebx
+     4fb:	83 ec 10             	sub    $0x10,%esp
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     4fe:	6a 0c                	push   $0xc
+     500:	e8 f4 16 00 00       	call   1bf9 <malloc>
+     505:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     507:	83 c4 0c             	add    $0xc,%esp
+     50a:	6a 0c                	push   $0xc
+     50c:	6a 00                	push   $0x0
+     50e:	50                   	push   %eax
+     50f:	e8 7f 08 00 00       	call   d93 <memset>
+  cmd->type = LIST;
+     514:	c7 03 04 00 00 00    	movl   $0x4,(%ebx)
+  cmd->left = left;
+     51a:	8b 45 08             	mov    0x8(%ebp),%eax
+     51d:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     520:	8b 45 0c             	mov    0xc(%ebp),%eax
+     523:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     526:	89 d8                	mov    %ebx,%eax
+     528:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     52b:	c9                   	leave
+     52c:	c3                   	ret
+
+0000052d <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+     52d:	55                   	push   %ebp
+     52e:	89 e5                	mov    %esp,%ebp
+     530:	53                   	push   %ebx
+     531:	83 ec 10             	sub    $0x10,%esp
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     534:	6a 08                	push   $0x8
+     536:	e8 be 16 00 00       	call   1bf9 <malloc>
+     53b:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     53d:	83 c4 0c             	add    $0xc,%esp
+     540:	6a 08                	push   $0x8
+     542:	6a 00                	push   $0x0
+     544:	50                   	push   %eax
+     545:	e8 49 08 00 00       	call   d93 <memset>
+  cmd->type = BACK;
+     54a:	c7 03 05 00 00 00    	movl   $0x5,(%ebx)
+  cmd->cmd = subcmd;
+     550:	8b 45 08             	mov    0x8(%ebp),%eax
+     553:	89 43 04             	mov    %eax,0x4(%ebx)
+  return (struct cmd*)cmd;
+}
+     556:	89 d8                	mov    %ebx,%eax
+     558:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     55b:	c9                   	leave
+     55c:	c3                   	ret
+
+0000055d <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+     55d:	55                   	push   %ebp
+     55e:	89 e5                	mov    %esp,%ebp
+     560:	57                   	push   %edi
+     561:	56                   	push   %esi
+     562:	53                   	push   %ebx
+     563:	83 ec 0c             	sub    $0xc,%esp
+     566:	8b 75 0c             	mov    0xc(%ebp),%esi
+     569:	8b 7d 10             	mov    0x10(%ebp),%edi
+  char *s;
+  int ret;
+
+  s = *ps;
+     56c:	8b 45 08             	mov    0x8(%ebp),%eax
+     56f:	8b 18                	mov    (%eax),%ebx
+  while(s < es && strchr(whitespace, *s))
+     571:	eb 03                	jmp    576 <gettoken+0x19>
+    s++;
+     573:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     576:	39 f3                	cmp    %esi,%ebx
+     578:	73 18                	jae    592 <gettoken+0x35>
+     57a:	83 ec 08             	sub    $0x8,%esp
+     57d:	0f be 03             	movsbl (%ebx),%eax
+     580:	50                   	push   %eax
+     581:	68 20 2a 00 00       	push   $0x2a20
+     586:	e8 71 08 00 00       	call   dfc <strchr>
+     58b:	83 c4 10             	add    $0x10,%esp
+     58e:	85 c0                	test   %eax,%eax
+     590:	75 e1                	jne    573 <gettoken+0x16>
+  if(q)
+     592:	85 ff                	test   %edi,%edi
+     594:	74 02                	je     598 <gettoken+0x3b>
+    *q = s;
+     596:	89 1f                	mov    %ebx,(%edi)
+  ret = *s;
+     598:	0f b6 03             	movzbl (%ebx),%eax
+     59b:	0f be f8             	movsbl %al,%edi
+  switch(*s){
+     59e:	3c 3c                	cmp    $0x3c,%al
+     5a0:	7f 27                	jg     5c9 <gettoken+0x6c>
+     5a2:	3c 3b                	cmp    $0x3b,%al
+     5a4:	7d 13                	jge    5b9 <gettoken+0x5c>
+     5a6:	84 c0                	test   %al,%al
+     5a8:	74 12                	je     5bc <gettoken+0x5f>
+     5aa:	78 41                	js     5ed <gettoken+0x90>
+     5ac:	3c 26                	cmp    $0x26,%al
+     5ae:	74 09                	je     5b9 <gettoken+0x5c>
+     5b0:	7c 3b                	jl     5ed <gettoken+0x90>
+     5b2:	83 e8 28             	sub    $0x28,%eax
+     5b5:	3c 01                	cmp    $0x1,%al
+     5b7:	77 34                	ja     5ed <gettoken+0x90>
+  case '(':
+  case ')':
+  case ';':
+  case '&':
+  case '<':
+    s++;
+     5b9:	83 c3 01             	add    $0x1,%ebx
+    ret = 'a';
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+      s++;
+    break;
+  }
+  if(eq)
+     5bc:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     5c0:	74 77                	je     639 <gettoken+0xdc>
+    *eq = s;
+     5c2:	8b 45 14             	mov    0x14(%ebp),%eax
+     5c5:	89 18                	mov    %ebx,(%eax)
+     5c7:	eb 70                	jmp    639 <gettoken+0xdc>
+  switch(*s){
+     5c9:	3c 3e                	cmp    $0x3e,%al
+     5cb:	75 0d                	jne    5da <gettoken+0x7d>
+    s++;
+     5cd:	8d 43 01             	lea    0x1(%ebx),%eax
+    if(*s == '>'){
+     5d0:	80 7b 01 3e          	cmpb   $0x3e,0x1(%ebx)
+     5d4:	74 0a                	je     5e0 <gettoken+0x83>
+    s++;
+     5d6:	89 c3                	mov    %eax,%ebx
+     5d8:	eb e2                	jmp    5bc <gettoken+0x5f>
+  switch(*s){
+     5da:	3c 7c                	cmp    $0x7c,%al
+     5dc:	75 0f                	jne    5ed <gettoken+0x90>
+     5de:	eb d9                	jmp    5b9 <gettoken+0x5c>
+      s++;
+     5e0:	83 c3 02             	add    $0x2,%ebx
+      ret = '+';
+     5e3:	bf 2b 00 00 00       	mov    $0x2b,%edi
+     5e8:	eb d2                	jmp    5bc <gettoken+0x5f>
+      s++;
+     5ea:	83 c3 01             	add    $0x1,%ebx
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     5ed:	39 f3                	cmp    %esi,%ebx
+     5ef:	73 37                	jae    628 <gettoken+0xcb>
+     5f1:	83 ec 08             	sub    $0x8,%esp
+     5f4:	0f be 03             	movsbl (%ebx),%eax
+     5f7:	50                   	push   %eax
+     5f8:	68 20 2a 00 00       	push   $0x2a20
+     5fd:	e8 fa 07 00 00       	call   dfc <strchr>
+     602:	83 c4 10             	add    $0x10,%esp
+     605:	85 c0                	test   %eax,%eax
+     607:	75 26                	jne    62f <gettoken+0xd2>
+     609:	83 ec 08             	sub    $0x8,%esp
+     60c:	0f be 03             	movsbl (%ebx),%eax
+     60f:	50                   	push   %eax
+     610:	68 18 2a 00 00       	push   $0x2a18
+     615:	e8 e2 07 00 00       	call   dfc <strchr>
+     61a:	83 c4 10             	add    $0x10,%esp
+     61d:	85 c0                	test   %eax,%eax
+     61f:	74 c9                	je     5ea <gettoken+0x8d>
+    ret = 'a';
+     621:	bf 61 00 00 00       	mov    $0x61,%edi
+     626:	eb 94                	jmp    5bc <gettoken+0x5f>
+     628:	bf 61 00 00 00       	mov    $0x61,%edi
+     62d:	eb 8d                	jmp    5bc <gettoken+0x5f>
+     62f:	bf 61 00 00 00       	mov    $0x61,%edi
+     634:	eb 86                	jmp    5bc <gettoken+0x5f>
+
+  while(s < es && strchr(whitespace, *s))
+    s++;
+     636:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     639:	39 f3                	cmp    %esi,%ebx
+     63b:	73 18                	jae    655 <gettoken+0xf8>
+     63d:	83 ec 08             	sub    $0x8,%esp
+     640:	0f be 03             	movsbl (%ebx),%eax
+     643:	50                   	push   %eax
+     644:	68 20 2a 00 00       	push   $0x2a20
+     649:	e8 ae 07 00 00       	call   dfc <strchr>
+     64e:	83 c4 10             	add    $0x10,%esp
+     651:	85 c0                	test   %eax,%eax
+     653:	75 e1                	jne    636 <gettoken+0xd9>
+  *ps = s;
+     655:	8b 45 08             	mov    0x8(%ebp),%eax
+     658:	89 18                	mov    %ebx,(%eax)
+  return ret;
+}
+     65a:	89 f8                	mov    %edi,%eax
+     65c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     65f:	5b                   	pop    %ebx
+     660:	5e                   	pop    %esi
+     661:	5f                   	pop    %edi
+     662:	5d                   	pop    %ebp
+     663:	c3                   	ret
+
+00000664 <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+     664:	55                   	push   %ebp
+     665:	89 e5                	mov    %esp,%ebp
+     667:	57                   	push   %edi
+     668:	56                   	push   %esi
+     669:	53                   	push   %ebx
+     66a:	83 ec 0c             	sub    $0xc,%esp
+     66d:	8b 7d 08             	mov    0x8(%ebp),%edi
+     670:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *s;
+
+  s = *ps;
+     673:	8b 1f                	mov    (%edi),%ebx
+  while(s < es && strchr(whitespace, *s))
+     675:	eb 03                	jmp    67a <peek+0x16>
+    s++;
+     677:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     67a:	39 f3                	cmp    %esi,%ebx
+     67c:	73 18                	jae    696 <peek+0x32>
+     67e:	83 ec 08             	sub    $0x8,%esp
+     681:	0f be 03             	movsbl (%ebx),%eax
+     684:	50                   	push   %eax
+     685:	68 20 2a 00 00       	push   $0x2a20
+     68a:	e8 6d 07 00 00       	call   dfc <strchr>
+     68f:	83 c4 10             	add    $0x10,%esp
+     692:	85 c0                	test   %eax,%eax
+     694:	75 e1                	jne    677 <peek+0x13>
+  *ps = s;
+     696:	89 1f                	mov    %ebx,(%edi)
+  return *s && strchr(toks, *s);
+     698:	0f b6 03             	movzbl (%ebx),%eax
+     69b:	84 c0                	test   %al,%al
+     69d:	75 0d                	jne    6ac <peek+0x48>
+     69f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     6a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     6a7:	5b                   	pop    %ebx
+     6a8:	5e                   	pop    %esi
+     6a9:	5f                   	pop    %edi
+     6aa:	5d                   	pop    %ebp
+     6ab:	c3                   	ret
+  return *s && strchr(toks, *s);
+     6ac:	83 ec 08             	sub    $0x8,%esp
+     6af:	0f be c0             	movsbl %al,%eax
+     6b2:	50                   	push   %eax
+     6b3:	ff 75 10             	push   0x10(%ebp)
+     6b6:	e8 41 07 00 00       	call   dfc <strchr>
+     6bb:	83 c4 10             	add    $0x10,%esp
+     6be:	85 c0                	test   %eax,%eax
+     6c0:	74 07                	je     6c9 <peek+0x65>
+     6c2:	b8 01 00 00 00       	mov    $0x1,%eax
+     6c7:	eb db                	jmp    6a4 <peek+0x40>
+     6c9:	b8 00 00 00 00       	mov    $0x0,%eax
+     6ce:	eb d4                	jmp    6a4 <peek+0x40>
+
+000006d0 <syntax>:
+int parseerr;
+
+void
+syntax(char *s)
+{
+  if(!parseerr)
+     6d0:	83 3d 40 2a 00 00 00 	cmpl   $0x0,0x2a40
+     6d7:	74 0b                	je     6e4 <syntax+0x14>
+    printf(2, "%s\n", s);
+  parseerr = 1;
+     6d9:	c7 05 40 2a 00 00 01 	movl   $0x1,0x2a40
+     6e0:	00 00 00 
+     6e3:	c3                   	ret
+{
+     6e4:	55                   	push   %ebp
+     6e5:	89 e5                	mov    %esp,%ebp
+     6e7:	83 ec 0c             	sub    $0xc,%esp
+    printf(2, "%s\n", s);
+     6ea:	ff 75 08             	push   0x8(%ebp)
+     6ed:	68 47 1f 00 00       	push   $0x1f47
+     6f2:	6a 02                	push   $0x2
+     6f4:	e8 7a 11 00 00       	call   1873 <printf>
+     6f9:	83 c4 10             	add    $0x10,%esp
+  parseerr = 1;
+     6fc:	c7 05 40 2a 00 00 01 	movl   $0x1,0x2a40
+     703:	00 00 00 
+}
+     706:	c9                   	leave
+     707:	c3                   	ret
+
+00000708 <parseredirs>:
+  return cmd;
+}
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     708:	55                   	push   %ebp
+     709:	89 e5                	mov    %esp,%ebp
+     70b:	57                   	push   %edi
+     70c:	56                   	push   %esi
+     70d:	53                   	push   %ebx
+     70e:	83 ec 1c             	sub    $0x1c,%esp
+     711:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     714:	8b 75 10             	mov    0x10(%ebp),%esi
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+     717:	eb 36                	jmp    74f <parseredirs+0x47>
+    tok = gettoken(ps, es, 0, 0);
+    if(gettoken(ps, es, &q, &eq) != 'a'){
+      syntax("missing file for redirection");
+     719:	83 ec 0c             	sub    $0xc,%esp
+     71c:	68 de 1e 00 00       	push   $0x1ede
+     721:	e8 aa ff ff ff       	call   6d0 <syntax>
+      break;
+     726:	83 c4 10             	add    $0x10,%esp
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+      break;
+    }
+  }
+  return cmd;
+}
+     729:	8b 45 08             	mov    0x8(%ebp),%eax
+     72c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     72f:	5b                   	pop    %ebx
+     730:	5e                   	pop    %esi
+     731:	5f                   	pop    %edi
+     732:	5d                   	pop    %ebp
+     733:	c3                   	ret
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     734:	83 ec 0c             	sub    $0xc,%esp
+     737:	6a 00                	push   $0x0
+     739:	6a 00                	push   $0x0
+     73b:	ff 75 e0             	push   -0x20(%ebp)
+     73e:	ff 75 e4             	push   -0x1c(%ebp)
+     741:	ff 75 08             	push   0x8(%ebp)
+     744:	e8 30 fd ff ff       	call   479 <redircmd>
+     749:	89 45 08             	mov    %eax,0x8(%ebp)
+      break;
+     74c:	83 c4 20             	add    $0x20,%esp
+  while(peek(ps, es, "<>")){
+     74f:	83 ec 04             	sub    $0x4,%esp
+     752:	68 fb 1e 00 00       	push   $0x1efb
+     757:	56                   	push   %esi
+     758:	57                   	push   %edi
+     759:	e8 06 ff ff ff       	call   664 <peek>
+     75e:	83 c4 10             	add    $0x10,%esp
+     761:	85 c0                	test   %eax,%eax
+     763:	74 c4                	je     729 <parseredirs+0x21>
+    tok = gettoken(ps, es, 0, 0);
+     765:	6a 00                	push   $0x0
+     767:	6a 00                	push   $0x0
+     769:	56                   	push   %esi
+     76a:	57                   	push   %edi
+     76b:	e8 ed fd ff ff       	call   55d <gettoken>
+     770:	89 c3                	mov    %eax,%ebx
+    if(gettoken(ps, es, &q, &eq) != 'a'){
+     772:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     775:	50                   	push   %eax
+     776:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     779:	50                   	push   %eax
+     77a:	56                   	push   %esi
+     77b:	57                   	push   %edi
+     77c:	e8 dc fd ff ff       	call   55d <gettoken>
+     781:	83 c4 20             	add    $0x20,%esp
+     784:	83 f8 61             	cmp    $0x61,%eax
+     787:	75 90                	jne    719 <parseredirs+0x11>
+    switch(tok){
+     789:	83 fb 3c             	cmp    $0x3c,%ebx
+     78c:	74 a6                	je     734 <parseredirs+0x2c>
+     78e:	83 fb 3e             	cmp    $0x3e,%ebx
+     791:	74 25                	je     7b8 <parseredirs+0xb0>
+     793:	83 fb 2b             	cmp    $0x2b,%ebx
+     796:	75 b7                	jne    74f <parseredirs+0x47>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     798:	83 ec 0c             	sub    $0xc,%esp
+     79b:	6a 01                	push   $0x1
+     79d:	68 01 02 00 00       	push   $0x201
+     7a2:	ff 75 e0             	push   -0x20(%ebp)
+     7a5:	ff 75 e4             	push   -0x1c(%ebp)
+     7a8:	ff 75 08             	push   0x8(%ebp)
+     7ab:	e8 c9 fc ff ff       	call   479 <redircmd>
+     7b0:	89 45 08             	mov    %eax,0x8(%ebp)
+      break;
+     7b3:	83 c4 20             	add    $0x20,%esp
+     7b6:	eb 97                	jmp    74f <parseredirs+0x47>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     7b8:	83 ec 0c             	sub    $0xc,%esp
+     7bb:	6a 01                	push   $0x1
+     7bd:	68 01 02 00 00       	push   $0x201
+     7c2:	ff 75 e0             	push   -0x20(%ebp)
+     7c5:	ff 75 e4             	push   -0x1c(%ebp)
+     7c8:	ff 75 08             	push   0x8(%ebp)
+     7cb:	e8 a9 fc ff ff       	call   479 <redircmd>
+     7d0:	89 45 08             	mov    %eax,0x8(%ebp)
+      break;
+     7d3:	83 c4 20             	add    $0x20,%esp
+     7d6:	e9 74 ff ff ff       	jmp    74f <parseredirs+0x47>
+
+000007db <parseexec>:
+  return cmd;
+}
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+     7db:	55                   	push   %ebp
+     7dc:	89 e5                	mov    %esp,%ebp
+     7de:	57                   	push   %edi
+     7df:	56                   	push   %esi
+     7e0:	53                   	push   %ebx
+     7e1:	83 ec 30             	sub    $0x30,%esp
+     7e4:	8b 75 08             	mov    0x8(%ebp),%esi
+     7e7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if(peek(ps, es, "("))
+     7ea:	68 fe 1e 00 00       	push   $0x1efe
+     7ef:	57                   	push   %edi
+     7f0:	56                   	push   %esi
+     7f1:	e8 6e fe ff ff       	call   664 <peek>
+     7f6:	83 c4 10             	add    $0x10,%esp
+     7f9:	85 c0                	test   %eax,%eax
+     7fb:	75 7a                	jne    877 <parseexec+0x9c>
+     7fd:	89 c3                	mov    %eax,%ebx
+    return parseblock(ps, es);
+
+  ret = execcmd();
+     7ff:	e8 4b fc ff ff       	call   44f <execcmd>
+     804:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  cmd = (struct execcmd*)ret;
+
+  argc = 0;
+  ret = parseredirs(ret, ps, es);
+     807:	83 ec 04             	sub    $0x4,%esp
+     80a:	57                   	push   %edi
+     80b:	56                   	push   %esi
+     80c:	50                   	push   %eax
+     80d:	e8 f6 fe ff ff       	call   708 <parseredirs>
+     812:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     815:	83 c4 10             	add    $0x10,%esp
+     818:	83 ec 04             	sub    $0x4,%esp
+     81b:	68 15 1f 00 00       	push   $0x1f15
+     820:	57                   	push   %edi
+     821:	56                   	push   %esi
+     822:	e8 3d fe ff ff       	call   664 <peek>
+     827:	83 c4 10             	add    $0x10,%esp
+     82a:	85 c0                	test   %eax,%eax
+     82c:	75 7d                	jne    8ab <parseexec+0xd0>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+     82e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     831:	50                   	push   %eax
+     832:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     835:	50                   	push   %eax
+     836:	57                   	push   %edi
+     837:	56                   	push   %esi
+     838:	e8 20 fd ff ff       	call   55d <gettoken>
+     83d:	83 c4 10             	add    $0x10,%esp
+     840:	85 c0                	test   %eax,%eax
+     842:	74 67                	je     8ab <parseexec+0xd0>
+      break;
+    if(tok != 'a'){
+     844:	83 f8 61             	cmp    $0x61,%eax
+     847:	75 40                	jne    889 <parseexec+0xae>
+      syntax("syntax");
+      break;
+    }
+    if(argc >= MAXARGS-1){
+     849:	83 fb 08             	cmp    $0x8,%ebx
+     84c:	7f 4d                	jg     89b <parseexec+0xc0>
+      syntax("too many args");
+      break;
+    }
+    cmd->argv[argc] = q;
+     84e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     851:	8b 55 d0             	mov    -0x30(%ebp),%edx
+     854:	89 44 9a 04          	mov    %eax,0x4(%edx,%ebx,4)
+    cmd->eargv[argc] = eq;
+     858:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     85b:	89 44 9a 2c          	mov    %eax,0x2c(%edx,%ebx,4)
+    argc++;
+     85f:	83 c3 01             	add    $0x1,%ebx
+    ret = parseredirs(ret, ps, es);
+     862:	83 ec 04             	sub    $0x4,%esp
+     865:	57                   	push   %edi
+     866:	56                   	push   %esi
+     867:	ff 75 d4             	push   -0x2c(%ebp)
+     86a:	e8 99 fe ff ff       	call   708 <parseredirs>
+     86f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     872:	83 c4 10             	add    $0x10,%esp
+     875:	eb a1                	jmp    818 <parseexec+0x3d>
+    return parseblock(ps, es);
+     877:	83 ec 08             	sub    $0x8,%esp
+     87a:	57                   	push   %edi
+     87b:	56                   	push   %esi
+     87c:	e8 37 01 00 00       	call   9b8 <parseblock>
+     881:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     884:	83 c4 10             	add    $0x10,%esp
+     887:	eb 35                	jmp    8be <parseexec+0xe3>
+      syntax("syntax");
+     889:	83 ec 0c             	sub    $0xc,%esp
+     88c:	68 00 1f 00 00       	push   $0x1f00
+     891:	e8 3a fe ff ff       	call   6d0 <syntax>
+      break;
+     896:	83 c4 10             	add    $0x10,%esp
+     899:	eb 10                	jmp    8ab <parseexec+0xd0>
+      syntax("too many args");
+     89b:	83 ec 0c             	sub    $0xc,%esp
+     89e:	68 07 1f 00 00       	push   $0x1f07
+     8a3:	e8 28 fe ff ff       	call   6d0 <syntax>
+      break;
+     8a8:	83 c4 10             	add    $0x10,%esp
+  }
+  cmd->argv[argc] = 0;
+     8ab:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     8ae:	c7 44 98 04 00 00 00 	movl   $0x0,0x4(%eax,%ebx,4)
+     8b5:	00 
+  cmd->eargv[argc] = 0;
+     8b6:	c7 44 98 2c 00 00 00 	movl   $0x0,0x2c(%eax,%ebx,4)
+     8bd:	00 
+  return ret;
+}
+     8be:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     8c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8c4:	5b                   	pop    %ebx
+     8c5:	5e                   	pop    %esi
+     8c6:	5f                   	pop    %edi
+     8c7:	5d                   	pop    %ebp
+     8c8:	c3                   	ret
+
+000008c9 <parsepipe>:
+{
+     8c9:	55                   	push   %ebp
+     8ca:	89 e5                	mov    %esp,%ebp
+     8cc:	57                   	push   %edi
+     8cd:	56                   	push   %esi
+     8ce:	53                   	push   %ebx
+     8cf:	83 ec 14             	sub    $0x14,%esp
+     8d2:	8b 75 08             	mov    0x8(%ebp),%esi
+     8d5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parseexec(ps, es);
+     8d8:	57                   	push   %edi
+     8d9:	56                   	push   %esi
+     8da:	e8 fc fe ff ff       	call   7db <parseexec>
+     8df:	89 c3                	mov    %eax,%ebx
+  if(peek(ps, es, "|")){
+     8e1:	83 c4 0c             	add    $0xc,%esp
+     8e4:	68 1a 1f 00 00       	push   $0x1f1a
+     8e9:	57                   	push   %edi
+     8ea:	56                   	push   %esi
+     8eb:	e8 74 fd ff ff       	call   664 <peek>
+     8f0:	83 c4 10             	add    $0x10,%esp
+     8f3:	85 c0                	test   %eax,%eax
+     8f5:	75 0a                	jne    901 <parsepipe+0x38>
+}
+     8f7:	89 d8                	mov    %ebx,%eax
+     8f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8fc:	5b                   	pop    %ebx
+     8fd:	5e                   	pop    %esi
+     8fe:	5f                   	pop    %edi
+     8ff:	5d                   	pop    %ebp
+     900:	c3                   	ret
+    gettoken(ps, es, 0, 0);
+     901:	6a 00                	push   $0x0
+     903:	6a 00                	push   $0x0
+     905:	57                   	push   %edi
+     906:	56                   	push   %esi
+     907:	e8 51 fc ff ff       	call   55d <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     90c:	83 c4 08             	add    $0x8,%esp
+     90f:	57                   	push   %edi
+     910:	56                   	push   %esi
+     911:	e8 b3 ff ff ff       	call   8c9 <parsepipe>
+     916:	83 c4 08             	add    $0x8,%esp
+     919:	50                   	push   %eax
+     91a:	53                   	push   %ebx
+     91b:	e8 a1 fb ff ff       	call   4c1 <pipecmd>
+     920:	89 c3                	mov    %eax,%ebx
+     922:	83 c4 10             	add    $0x10,%esp
+  return cmd;
+     925:	eb d0                	jmp    8f7 <parsepipe+0x2e>
+
+00000927 <parseline>:
+{
+     927:	55                   	push   %ebp
+     928:	89 e5                	mov    %esp,%ebp
+     92a:	57                   	push   %edi
+     92b:	56                   	push   %esi
+     92c:	53                   	push   %ebx
+     92d:	83 ec 14             	sub    $0x14,%esp
+     930:	8b 75 08             	mov    0x8(%ebp),%esi
+     933:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parsepipe(ps, es);
+     936:	57                   	push   %edi
+     937:	56                   	push   %esi
+     938:	e8 8c ff ff ff       	call   8c9 <parsepipe>
+     93d:	89 c3                	mov    %eax,%ebx
+  while(peek(ps, es, "&")){
+     93f:	83 c4 10             	add    $0x10,%esp
+     942:	eb 18                	jmp    95c <parseline+0x35>
+    gettoken(ps, es, 0, 0);
+     944:	6a 00                	push   $0x0
+     946:	6a 00                	push   $0x0
+     948:	57                   	push   %edi
+     949:	56                   	push   %esi
+     94a:	e8 0e fc ff ff       	call   55d <gettoken>
+    cmd = backcmd(cmd);
+     94f:	89 1c 24             	mov    %ebx,(%esp)
+     952:	e8 d6 fb ff ff       	call   52d <backcmd>
+     957:	89 c3                	mov    %eax,%ebx
+     959:	83 c4 10             	add    $0x10,%esp
+  while(peek(ps, es, "&")){
+     95c:	83 ec 04             	sub    $0x4,%esp
+     95f:	68 1c 1f 00 00       	push   $0x1f1c
+     964:	57                   	push   %edi
+     965:	56                   	push   %esi
+     966:	e8 f9 fc ff ff       	call   664 <peek>
+     96b:	83 c4 10             	add    $0x10,%esp
+     96e:	85 c0                	test   %eax,%eax
+     970:	75 d2                	jne    944 <parseline+0x1d>
+  if(peek(ps, es, ";")){
+     972:	83 ec 04             	sub    $0x4,%esp
+     975:	68 18 1f 00 00       	push   $0x1f18
+     97a:	57                   	push   %edi
+     97b:	56                   	push   %esi
+     97c:	e8 e3 fc ff ff       	call   664 <peek>
+     981:	83 c4 10             	add    $0x10,%esp
+     984:	85 c0                	test   %eax,%eax
+     986:	75 0a                	jne    992 <parseline+0x6b>
+}
+     988:	89 d8                	mov    %ebx,%eax
+     98a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     98d:	5b                   	pop    %ebx
+     98e:	5e                   	pop    %esi
+     98f:	5f                   	pop    %edi
+     990:	5d                   	pop    %ebp
+     991:	c3                   	ret
+    gettoken(ps, es, 0, 0);
+     992:	6a 00                	push   $0x0
+     994:	6a 00                	push   $0x0
+     996:	57                   	push   %edi
+     997:	56                   	push   %esi
+     998:	e8 c0 fb ff ff       	call   55d <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+     99d:	83 c4 08             	add    $0x8,%esp
+     9a0:	57                   	push   %edi
+     9a1:	56                   	push   %esi
+     9a2:	e8 80 ff ff ff       	call   927 <parseline>
+     9a7:	83 c4 08             	add    $0x8,%esp
+     9aa:	50                   	push   %eax
+     9ab:	53                   	push   %ebx
+     9ac:	e8 46 fb ff ff       	call   4f7 <listcmd>
+     9b1:	89 c3                	mov    %eax,%ebx
+     9b3:	83 c4 10             	add    $0x10,%esp
+  return cmd;
+     9b6:	eb d0                	jmp    988 <parseline+0x61>
+
+000009b8 <parseblock>:
+{
+     9b8:	55                   	push   %ebp
+     9b9:	89 e5                	mov    %esp,%ebp
+     9bb:	57                   	push   %edi
+     9bc:	56                   	push   %esi
+     9bd:	53                   	push   %ebx
+     9be:	83 ec 10             	sub    $0x10,%esp
+     9c1:	8b 75 08             	mov    0x8(%ebp),%esi
+     9c4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if(!peek(ps, es, "("))
+     9c7:	68 fe 1e 00 00       	push   $0x1efe
+     9cc:	57                   	push   %edi
+     9cd:	56                   	push   %esi
+     9ce:	e8 91 fc ff ff       	call   664 <peek>
+     9d3:	83 c4 10             	add    $0x10,%esp
+     9d6:	85 c0                	test   %eax,%eax
+     9d8:	74 52                	je     a2c <parseblock+0x74>
+  gettoken(ps, es, 0, 0);
+     9da:	6a 00                	push   $0x0
+     9dc:	6a 00                	push   $0x0
+     9de:	57                   	push   %edi
+     9df:	56                   	push   %esi
+     9e0:	e8 78 fb ff ff       	call   55d <gettoken>
+  cmd = parseline(ps, es);
+     9e5:	83 c4 08             	add    $0x8,%esp
+     9e8:	57                   	push   %edi
+     9e9:	56                   	push   %esi
+     9ea:	e8 38 ff ff ff       	call   927 <parseline>
+     9ef:	89 c3                	mov    %eax,%ebx
+  if(!peek(ps, es, ")")){
+     9f1:	83 c4 0c             	add    $0xc,%esp
+     9f4:	68 3a 1f 00 00       	push   $0x1f3a
+     9f9:	57                   	push   %edi
+     9fa:	56                   	push   %esi
+     9fb:	e8 64 fc ff ff       	call   664 <peek>
+     a00:	83 c4 10             	add    $0x10,%esp
+     a03:	85 c0                	test   %eax,%eax
+     a05:	74 32                	je     a39 <parseblock+0x81>
+  gettoken(ps, es, 0, 0);
+     a07:	6a 00                	push   $0x0
+     a09:	6a 00                	push   $0x0
+     a0b:	57                   	push   %edi
+     a0c:	56                   	push   %esi
+     a0d:	e8 4b fb ff ff       	call   55d <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+     a12:	83 c4 0c             	add    $0xc,%esp
+     a15:	57                   	push   %edi
+     a16:	56                   	push   %esi
+     a17:	53                   	push   %ebx
+     a18:	e8 eb fc ff ff       	call   708 <parseredirs>
+     a1d:	89 c3                	mov    %eax,%ebx
+  return cmd;
+     a1f:	83 c4 10             	add    $0x10,%esp
+}
+     a22:	89 d8                	mov    %ebx,%eax
+     a24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a27:	5b                   	pop    %ebx
+     a28:	5e                   	pop    %esi
+     a29:	5f                   	pop    %edi
+     a2a:	5d                   	pop    %ebp
+     a2b:	c3                   	ret
+    panic("parseblock");
+     a2c:	83 ec 0c             	sub    $0xc,%esp
+     a2f:	68 1e 1f 00 00       	push   $0x1f1e
+     a34:	e8 12 f6 ff ff       	call   4b <panic>
+    syntax("syntax - missing )");
+     a39:	83 ec 0c             	sub    $0xc,%esp
+     a3c:	68 29 1f 00 00       	push   $0x1f29
+     a41:	e8 8a fc ff ff       	call   6d0 <syntax>
+    return cmd;
+     a46:	83 c4 10             	add    $0x10,%esp
+     a49:	eb d7                	jmp    a22 <parseblock+0x6a>
+
+00000a4b <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+     a4b:	55                   	push   %ebp
+     a4c:	89 e5                	mov    %esp,%ebp
+     a4e:	53                   	push   %ebx
+     a4f:	83 ec 04             	sub    $0x4,%esp
+     a52:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     a55:	85 db                	test   %ebx,%ebx
+     a57:	74 1f                	je     a78 <nulterminate+0x2d>
+    return 0;
+
+  switch(cmd->type){
+     a59:	8b 03                	mov    (%ebx),%eax
+     a5b:	83 f8 05             	cmp    $0x5,%eax
+     a5e:	77 18                	ja     a78 <nulterminate+0x2d>
+     a60:	ff 24 85 7c 1f 00 00 	jmp    *0x1f7c(,%eax,4)
+  case EXEC:
+    ecmd = (struct execcmd*)cmd;
+    for(i=0; ecmd->argv[i]; i++)
+      *ecmd->eargv[i] = 0;
+     a67:	8b 54 83 2c          	mov    0x2c(%ebx,%eax,4),%edx
+     a6b:	c6 02 00             	movb   $0x0,(%edx)
+    for(i=0; ecmd->argv[i]; i++)
+     a6e:	83 c0 01             	add    $0x1,%eax
+     a71:	83 7c 83 04 00       	cmpl   $0x0,0x4(%ebx,%eax,4)
+     a76:	75 ef                	jne    a67 <nulterminate+0x1c>
+    bcmd = (struct backcmd*)cmd;
+    nulterminate(bcmd->cmd);
+    break;
+  }
+  return cmd;
+}
+     a78:	89 d8                	mov    %ebx,%eax
+     a7a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     a7d:	c9                   	leave
+     a7e:	c3                   	ret
+  switch(cmd->type){
+     a7f:	b8 00 00 00 00       	mov    $0x0,%eax
+     a84:	eb eb                	jmp    a71 <nulterminate+0x26>
+    nulterminate(rcmd->cmd);
+     a86:	83 ec 0c             	sub    $0xc,%esp
+     a89:	ff 73 04             	push   0x4(%ebx)
+     a8c:	e8 ba ff ff ff       	call   a4b <nulterminate>
+    *rcmd->efile = 0;
+     a91:	8b 43 0c             	mov    0xc(%ebx),%eax
+     a94:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+     a97:	83 c4 10             	add    $0x10,%esp
+     a9a:	eb dc                	jmp    a78 <nulterminate+0x2d>
+    nulterminate(pcmd->left);
+     a9c:	83 ec 0c             	sub    $0xc,%esp
+     a9f:	ff 73 04             	push   0x4(%ebx)
+     aa2:	e8 a4 ff ff ff       	call   a4b <nulterminate>
+    nulterminate(pcmd->right);
+     aa7:	83 c4 04             	add    $0x4,%esp
+     aaa:	ff 73 08             	push   0x8(%ebx)
+     aad:	e8 99 ff ff ff       	call   a4b <nulterminate>
+    break;
+     ab2:	83 c4 10             	add    $0x10,%esp
+     ab5:	eb c1                	jmp    a78 <nulterminate+0x2d>
+    nulterminate(lcmd->left);
+     ab7:	83 ec 0c             	sub    $0xc,%esp
+     aba:	ff 73 04             	push   0x4(%ebx)
+     abd:	e8 89 ff ff ff       	call   a4b <nulterminate>
+    nulterminate(lcmd->right);
+     ac2:	83 c4 04             	add    $0x4,%esp
+     ac5:	ff 73 08             	push   0x8(%ebx)
+     ac8:	e8 7e ff ff ff       	call   a4b <nulterminate>
+    break;
+     acd:	83 c4 10             	add    $0x10,%esp
+     ad0:	eb a6                	jmp    a78 <nulterminate+0x2d>
+    nulterminate(bcmd->cmd);
+     ad2:	83 ec 0c             	sub    $0xc,%esp
+     ad5:	ff 73 04             	push   0x4(%ebx)
+     ad8:	e8 6e ff ff ff       	call   a4b <nulterminate>
+    break;
+     add:	83 c4 10             	add    $0x10,%esp
+     ae0:	eb 96                	jmp    a78 <nulterminate+0x2d>
+
+00000ae2 <freecmd>:
+
+// Free the nodes of a parsed command.
+void
+freecmd(struct cmd *cmd)
+{
+     ae2:	55                   	push   %ebp
+     ae3:	89 e5                	mov    %esp,%ebp
+     ae5:	53                   	push   %ebx
+     ae6:	83 ec 04             	sub    $0x4,%esp
+     ae9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct backcmd *bcmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     aec:	85 db                	test   %ebx,%ebx
+     aee:	74 5d                	je     b4d <freecmd+0x6b>
+    return;
+
+  switch(cmd->type){
+     af0:	8b 03                	mov    (%ebx),%eax
+     af2:	83 f8 04             	cmp    $0x4,%eax
+     af5:	74 5b                	je     b52 <freecmd+0x70>
+     af7:	7f 25                	jg     b1e <freecmd+0x3c>
+     af9:	83 f8 02             	cmp    $0x2,%eax
+     afc:	74 35                	je     b33 <freecmd+0x51>
+     afe:	83 f8 03             	cmp    $0x3,%eax
+     b01:	75 3e                	jne    b41 <freecmd+0x5f>
+    freecmd(rcmd->cmd);
+    break;
+
+  case PIPE:
+    pcmd = (struct pipecmd*)cmd;
+    freecmd(pcmd->left);
+     b03:	83 ec 0c             	sub    $0xc,%esp
+     b06:	ff 73 04             	push   0x4(%ebx)
+     b09:	e8 d4 ff ff ff       	call   ae2 <freecmd>
+    freecmd(pcmd->right);
+     b0e:	83 c4 04             	add    $0x4,%esp
+     b11:	ff 73 08             	push   0x8(%ebx)
+     b14:	e8 c9 ff ff ff       	call   ae2 <freecmd>
+    break;
+     b19:	83 c4 10             	add    $0x10,%esp
+     b1c:	eb 23                	jmp    b41 <freecmd+0x5f>
+  switch(cmd->type){
+     b1e:	83 f8 05             	cmp    $0x5,%eax
+     b21:	75 1e                	jne    b41 <freecmd+0x5f>
+    freecmd(lcmd->right);
+    break;
+
+  case BACK:
+    bcmd = (struct backcmd*)cmd;
+    freecmd(bcmd->cmd);
+     b23:	83 ec 0c             	sub    $0xc,%esp
+     b26:	ff 73 04             	push   0x4(%ebx)
+     b29:	e8 b4 ff ff ff       	call   ae2 <freecmd>
+    break;
+     b2e:	83 c4 10             	add    $0x10,%esp
+     b31:	eb 0e                	jmp    b41 <freecmd+0x5f>
+    freecmd(rcmd->cmd);
+     b33:	83 ec 0c             	sub    $0xc,%esp
+     b36:	ff 73 04             	push   0x4(%ebx)
+     b39:	e8 a4 ff ff ff       	call   ae2 <freecmd>
+    break;
+     b3e:	83 c4 10             	add    $0x10,%esp
+  }
+  free(cmd);
+     b41:	83 ec 0c             	sub    $0xc,%esp
+     b44:	53                   	push   %ebx
+     b45:	e8 58 10 00 00       	call   1ba2 <free>
+     b4a:	83 c4 10             	add    $0x10,%esp
+}
+     b4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b50:	c9                   	leave
+     b51:	c3                   	ret
+    freecmd(lcmd->left);
+     b52:	83 ec 0c             	sub    $0xc,%esp
+     b55:	ff 73 04             	push   0x4(%ebx)
+     b58:	e8 85 ff ff ff       	call   ae2 <freecmd>
+    freecmd(lcmd->right);
+     b5d:	83 c4 04             	add    $0x4,%esp
+     b60:	ff 73 08             	push   0x8(%ebx)
+     b63:	e8 7a ff ff ff       	call   ae2 <freecmd>
+    break;
+     b68:	83 c4 10             	add    $0x10,%esp
+     b6b:	eb d4                	jmp    b41 <freecmd+0x5f>
+
+00000b6d <parsecmd>:
+{
+     b6d:	55                   	push   %ebp
+     b6e:	89 e5                	mov    %esp,%ebp
+     b70:	56                   	push   %esi
+     b71:	53                   	push   %ebx
+  parseerr = 0;
+     b72:	c7 05 40 2a 00 00 00 	movl   $0x0,0x2a40
+     b79:	00 00 00 
+  es = s + strlen(s);
+     b7c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     b7f:	83 ec 0c             	sub    $0xc,%esp
+     b82:	53                   	push   %ebx
+     b83:	e8 c6 01 00 00       	call   d4e <strlen>
+     b88:	01 c3                	add    %eax,%ebx
+  cmd = parseline(&s, es);
+     b8a:	83 c4 08             	add    $0x8,%esp
+     b8d:	53                   	push   %ebx
+     b8e:	8d 45 08             	lea    0x8(%ebp),%eax
+     b91:	50                   	push   %eax
+     b92:	e8 90 fd ff ff       	call   927 <parseline>
+     b97:	89 c6                	mov    %eax,%esi
+  peek(&s, es, "");
+     b99:	83 c4 0c             	add    $0xc,%esp
+     b9c:	68 d0 1e 00 00       	push   $0x1ed0
+     ba1:	53                   	push   %ebx
+     ba2:	8d 45 08             	lea    0x8(%ebp),%eax
+     ba5:	50                   	push   %eax
+     ba6:	e8 b9 fa ff ff       	call   664 <peek>
+  if(s != es && !parseerr){
+     bab:	8b 45 08             	mov    0x8(%ebp),%eax
+     bae:	83 c4 10             	add    $0x10,%esp
+     bb1:	39 d8                	cmp    %ebx,%eax
+     bb3:	74 09                	je     bbe <parsecmd+0x51>
+     bb5:	83 3d 40 2a 00 00 00 	cmpl   $0x0,0x2a40
+     bbc:	74 1e                	je     bdc <parsecmd+0x6f>
+  if(parseerr){
+     bbe:	83 3d 40 2a 00 00 00 	cmpl   $0x0,0x2a40
+     bc5:	75 36                	jne    bfd <parsecmd+0x90>
+  nulterminate(cmd);
+     bc7:	83 ec 0c             	sub    $0xc,%esp
+     bca:	56                   	push   %esi
+     bcb:	e8 7b fe ff ff       	call   a4b <nulterminate>
+  return cmd;
+     bd0:	83 c4 10             	add    $0x10,%esp
+}
+     bd3:	89 f0                	mov    %esi,%eax
+     bd5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     bd8:	5b                   	pop    %ebx
+     bd9:	5e                   	pop    %esi
+     bda:	5d                   	pop    %ebp
+     bdb:	c3                   	ret
+    printf(2, "leftovers: %s\n", s);
+     bdc:	83 ec 04             	sub    $0x4,%esp
+     bdf:	50                   	push   %eax
+     be0:	68 3c 1f 00 00       	push   $0x1f3c
+     be5:	6a 02                	push   $0x2
+     be7:	e8 87 0c 00 00       	call   1873 <printf>
+    syntax("syntax");
+     bec:	c7 04 24 00 1f 00 00 	movl   $0x1f00,(%esp)
+     bf3:	e8 d8 fa ff ff       	call   6d0 <syntax>
+     bf8:	83 c4 10             	add    $0x10,%esp
+     bfb:	eb c1                	jmp    bbe <parsecmd+0x51>
+    freecmd(cmd);
+     bfd:	83 ec 0c             	sub    $0xc,%esp
+     c00:	56                   	push   %esi
+     c01:	e8 dc fe ff ff       	call   ae2 <freecmd>
+    return 0;
+     c06:	83 c4 10             	add    $0x10,%esp
+     c09:	be 00 00 00 00       	mov    $0x0,%esi
+     c0e:	eb c3                	jmp    bd3 <parsecmd+0x66>
+
+00000c10 <main>:
+{
+     c10:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     c14:	83 e4 f0             	and    $0xfffffff0,%esp
+     c17:	ff 71 fc             	push   -0x4(%ecx)
+     c1a:	55                   	push   %ebp
+     c1b:	89 e5                	mov    %esp,%ebp
+     c1d:	56                   	push   %esi
+     c1e:	53                   	push   %ebx
+     c1f:	51                   	push   %ecx
+     c20:	83 ec 0c             	sub    $0xc,%esp
+  while((fd = open("console", O_RDWR)) >= 0){
+     c23:	83 ec 08             	sub    $0x8,%esp
+     c26:	6a 02                	push   $0x2
+     c28:	68 4b 1f 00 00       	push   $0x1f4b
+     c2d:	e8 59 08 00 00       	call   148b <open>
+     c32:	83 c4 10             	add    $0x10,%esp
+     c35:	85 c0                	test   %eax,%eax
+     c37:	78 6b                	js     ca4 <main+0x94>
+    if(fd >= 3){
+     c39:	83 f8 02             	cmp    $0x2,%eax
+     c3c:	7e e5                	jle    c23 <main+0x13>
+      close(fd);
+     c3e:	83 ec 0c             	sub    $0xc,%esp
+     c41:	50                   	push   %eax
+     c42:	e8 22 07 00 00       	call   1369 <close>
+      break;
+     c47:	83 c4 10             	add    $0x10,%esp
+     c4a:	eb 58                	jmp    ca4 <main+0x94>
+      buf[strlen(buf)-1] = 0;  // chop \n
+     c4c:	83 ec 0c             	sub    $0xc,%esp
+     c4f:	68 60 2a 00 00       	push   $0x2a60
+     c54:	e8 f5 00 00 00       	call   d4e <strlen>
+     c59:	c6 80 5f 2a 00 00 00 	movb   $0x0,0x2a5f(%eax)
+      if(chdir(buf+3) < 0)
+     c60:	c7 04 24 63 2a 00 00 	movl   $0x2a63,(%esp)
+     c67:	e8 79 08 00 00       	call   14e5 <chdir>
+     c6c:	83 c4 10             	add    $0x10,%esp
+     c6f:	85 c0                	test   %eax,%eax
+     c71:	79 31                	jns    ca4 <main+0x94>
+        printf(2, "cannot cd %s\n", buf+3);
+     c73:	83 ec 04             	sub    $0x4,%esp
+     c76:	68 63 2a 00 00       	push   $0x2a63
+     c7b:	68 53 1f 00 00       	push   $0x1f53
+     c80:	6a 02                	push   $0x2
+     c82:	e8 ec 0b 00 00       	call   1873 <printf>
+     c87:	83 c4 10             	add    $0x10,%esp
+      continue;
+     c8a:	eb 18                	jmp    ca4 <main+0x94>
+      wait();
+     c8c:	e8 af 07 00 00       	call   1440 <wait>
+    for(n = spawncmd(cmd, stdfds); n > 0; n--)
+     c91:	83 eb 01             	sub    $0x1,%ebx
+     c94:	85 db                	test   %ebx,%ebx
+     c96:	7f f4                	jg     c8c <main+0x7c>
+    freecmd(cmd);
+     c98:	83 ec 0c             	sub    $0xc,%esp
+     c9b:	56                   	push   %esi
+     c9c:	e8 41 fe ff ff       	call   ae2 <freecmd>
+     ca1:	83 c4 10             	add    $0x10,%esp
+  while(getcmd(buf, sizeof(buf)) >= 0){
+     ca4:	83 ec 08             	sub    $0x8,%esp
+     ca7:	6a 64                	push   $0x64
+     ca9:	68 60 2a 00 00       	push   $0x2a60
+     cae:	e8 4d f3 ff ff       	call   0 <getcmd>
+     cb3:	83 c4 10             	add    $0x10,%esp
+     cb6:	85 c0                	test   %eax,%eax
+     cb8:	78 43                	js     cfd <main+0xed>
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+     cba:	80 3d 60 2a 00 00 63 	cmpb   $0x63,0x2a60
+     cc1:	75 16                	jne    cd9 <main+0xc9>
+     cc3:	80 3d 61 2a 00 00 64 	cmpb   $0x64,0x2a61
+     cca:	75 0d                	jne    cd9 <main+0xc9>
+     ccc:	80 3d 62 2a 00 00 20 	cmpb   $0x20,0x2a62
+     cd3:	0f 84 73 ff ff ff    	je     c4c <main+0x3c>
+    cmd = parsecmd(buf);
+     cd9:	83 ec 0c             	sub    $0xc,%esp
+     cdc:	68 60 2a 00 00       	push   $0x2a60
+     ce1:	e8 87 fe ff ff       	call   b6d <parsecmd>
+     ce6:	89 c6                	mov    %eax,%esi
+    for(n = spawncmd(cmd, stdfds); n > 0; n--)
+     ce8:	83 c4 08             	add    $0x8,%esp
+     ceb:	68 0c 2a 00 00       	push   $0x2a0c
+     cf0:	50                   	push   %eax
+     cf1:	e8 33 f5 ff ff       	call   229 <spawncmd>
+     cf6:	89 c3                	mov    %eax,%ebx
+     cf8:	83 c4 10             	add    $0x10,%esp
+     cfb:	eb 97                	jmp    c94 <main+0x84>
+  exit();
+     cfd:	e8 38 06 00 00       	call   133a <exit>
+
+00000d02 <strcpy>:
+#include "memlayout.h"
+#include "clock.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     d02:	55                   	push   %ebp
+     d03:	89 e5                	mov    %esp,%ebp
+     d05:	56                   	push   %esi
+     d06:	53                   	push   %ebx
+     d07:	8b 75 08             	mov    0x8(%ebp),%esi
+     d0a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     d0d:	89 f0                	mov    %esi,%eax
+     d0f:	89 d1                	mov    %edx,%ecx
+     d11:	83 c2 01             	add    $0x1,%edx
+     d14:	89 c3                	mov    %eax,%ebx
+     d16:	83 c0 01             	add    $0x1,%eax
+     d19:	0f b6 09             	movzbl (%ecx),%ecx
+     d1c:	88 0b                	mov    %cl,(%ebx)
+     d1e:	84 c9                	test   %cl,%cl
+     d20:	75 ed                	jne    d0f <strcpy+0xd>
+    ;
+  return os;
+}
+     d22:	89 f0                	mov    %esi,%eax
+     d24:	5b                   	pop    %ebx
+     d25:	5e                   	pop    %esi
+     d26:	5d                   	pop    %ebp
+     d27:	c3                   	ret
+
+00000d28 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     d28:	55                   	push   %ebp
+     d29:	89 e5                	mov    %esp,%ebp
+     d2b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     d2e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+     d31:	eb 06                	jmp    d39 <strcmp+0x11>
+    p++, q++;
+     d33:	83 c1 01             	add    $0x1,%ecx
+     d36:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+     d39:	0f b6 01             	movzbl (%ecx),%eax
+     d3c:	84 c0                	test   %al,%al
+     d3e:	74 04                	je     d44 <strcmp+0x1c>
+     d40:	3a 02                	cmp    (%edx),%al
+     d42:	74 ef                	je     d33 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+     d44:	0f b6 c0             	movzbl %al,%eax
+     d47:	0f b6 12             	movzbl (%edx),%edx
+     d4a:	29 d0                	sub    %edx,%eax
+}
+     d4c:	5d                   	pop    %ebp
+     d4d:	c3                   	ret
+
+00000d4e <strlen>:
+
+uint
+strlen(const char *s)
+{
+     d4e:	55                   	push   %ebp
+     d4f:	89 e5                	mov    %esp,%ebp
+     d51:	53                   	push   %ebx
+     d52:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  const char *p;
+  uint w;
+
+  for(p = s; (uint)p & 3; p++)
+     d55:	89 c8                	mov    %ecx,%eax
+     d57:	eb 03                	jmp    d5c <strlen+0xe>
+     d59:	83 c0 01             	add    $0x1,%eax
+     d5c:	a8 03                	test   $0x3,%al
+     d5e:	74 09                	je     d69 <strlen+0x1b>
+    if(*p == 0)
+     d60:	80 38 00             	cmpb   $0x0,(%eax)
+     d63:	75 f4                	jne    d59 <strlen+0xb>
+      return p - s;
+     d65:	29 c8                	sub    %ecx,%eax
+     d67:	eb 25                	jmp    d8e <strlen+0x40>
+  // Then a word at a time, which never crosses into the next page:
+  // a word with a zero byte in it has one of these bits set.
+  for(;; p += 4){
+    w = *(uint*)p;
+     d69:	8b 10                	mov    (%eax),%edx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     d6b:	8d 9a ff fe fe fe    	lea    -0x1010101(%edx),%ebx
+     d71:	f7 d2                	not    %edx
+     d73:	21 da                	and    %ebx,%edx
+     d75:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+     d7b:	75 05                	jne    d82 <strlen+0x34>
+  for(;; p += 4){
+     d7d:	83 c0 04             	add    $0x4,%eax
+    w = *(uint*)p;
+     d80:	eb e7                	jmp    d69 <strlen+0x1b>
+      break;
+  }
+  while(*p)
+     d82:	80 38 00             	cmpb   $0x0,(%eax)
+     d85:	74 05                	je     d8c <strlen+0x3e>
+    p++;
+     d87:	83 c0 01             	add    $0x1,%eax
+     d8a:	eb f6                	jmp    d82 <strlen+0x34>
+  return p - s;
+     d8c:	29 c8                	sub    %ecx,%eax
+}
+     d8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     d91:	c9                   	leave
+     d92:	c3                   	ret
+
+00000d93 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     d93:	55                   	push   %ebp
+     d94:	89 e5                	mov    %esp,%ebp
+     d96:	57                   	push   %edi
+     d97:	56                   	push   %esi
+     d98:	53                   	push   %ebx
+     d99:	8b 55 10             	mov    0x10(%ebp),%edx
+  uint h;
+  char *d;
+
+  d = dst;
+  c &= 0xFF;
+     d9c:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  if(n >= 16){
+     da0:	83 fa 0f             	cmp    $0xf,%edx
+     da3:	76 52                	jbe    df7 <memset+0x64>
+    h = -(uint)d & 3;
+     da5:	8b 45 08             	mov    0x8(%ebp),%eax
+     da8:	f7 d8                	neg    %eax
+     daa:	83 e0 03             	and    $0x3,%eax
+     dad:	89 c6                	mov    %eax,%esi
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     daf:	8b 7d 08             	mov    0x8(%ebp),%edi
+     db2:	89 c1                	mov    %eax,%ecx
+     db4:	89 d8                	mov    %ebx,%eax
+     db6:	fc                   	cld
+     db7:	f3 aa                	rep stos %al,%es:(%edi)
+    stosb(d, c, h);
+    stosl(d + h, (c<<24)|(c<<16)|(c<<8)|c, (n - h)/4);
+     db9:	29 f2                	sub    %esi,%edx
+     dbb:	89 d1                	mov    %edx,%ecx
+     dbd:	c1 e9 02             	shr    $0x2,%ecx
+     dc0:	c1 e0 18             	shl    $0x18,%eax
+     dc3:	89 df                	mov    %ebx,%edi
+     dc5:	c1 e7 10             	shl    $0x10,%edi
+     dc8:	09 f8                	or     %edi,%eax
+     dca:	89 df                	mov    %ebx,%edi
+     dcc:	c1 e7 08             	shl    $0x8,%edi
+     dcf:	09 f8                	or     %edi,%eax
+     dd1:	09 d8                	or     %ebx,%eax
+     dd3:	89 f7                	mov    %esi,%edi
+     dd5:	03 7d 08             	add    0x8(%ebp),%edi
+}
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosl" :
+     dd8:	fc                   	cld
+     dd9:	f3 ab                	rep stos %eax,%es:(%edi)
+    d += h + (n - h)/4*4;
+     ddb:	89 d7                	mov    %edx,%edi
+     ddd:	83 e7 fc             	and    $0xfffffffc,%edi
+     de0:	09 f7                	or     %esi,%edi
+     de2:	03 7d 08             	add    0x8(%ebp),%edi
+    n = (n - h)%4;
+     de5:	83 e2 03             	and    $0x3,%edx
+  asm volatile("cld; rep stosb" :
+     de8:	89 d1                	mov    %edx,%ecx
+     dea:	89 d8                	mov    %ebx,%eax
+     dec:	fc                   	cld
+     ded:	f3 aa                	rep stos %al,%es:(%edi)
+  }
+  stosb(d, c, n);
+  return dst;
+}
+     def:	8b 45 08             	mov    0x8(%ebp),%eax
+     df2:	5b                   	pop    %ebx
+     df3:	5e                   	pop    %esi
+     df4:	5f                   	pop    %edi
+     df5:	5d                   	pop    %ebp
+     df6:	c3                   	ret
+  d = dst;
+     df7:	8b 7d 08             	mov    0x8(%ebp),%edi
+     dfa:	eb ec                	jmp    de8 <memset+0x55>
+
+00000dfc <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     dfc:	55                   	push   %ebp
+     dfd:	89 e5                	mov    %esp,%ebp
+     dff:	8b 45 08             	mov    0x8(%ebp),%eax
+     e02:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     e06:	eb 03                	jmp    e0b <strchr+0xf>
+     e08:	83 c0 01             	add    $0x1,%eax
+     e0b:	0f b6 10             	movzbl (%eax),%edx
+     e0e:	84 d2                	test   %dl,%dl
+     e10:	74 06                	je     e18 <strchr+0x1c>
+    if(*s == c)
+     e12:	38 ca                	cmp    %cl,%dl
+     e14:	75 f2                	jne    e08 <strchr+0xc>
+     e16:	eb 05                	jmp    e1d <strchr+0x21>
+      return (char*)s;
+  return 0;
+     e18:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     e1d:	5d                   	pop    %ebp
+     e1e:	c3                   	ret
+
+00000e1f <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     e1f:	55                   	push   %ebp
+     e20:	89 e5                	mov    %esp,%ebp
+     e22:	56                   	push   %esi
+     e23:	53                   	push   %ebx
+     e24:	8b 55 08             	mov    0x8(%ebp),%edx
+     e27:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     e2a:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  // A word at a time while they agree.
+  if((((uint)s1 | (uint)s2) & 3) == 0)
+     e2d:	89 d3                	mov    %edx,%ebx
+     e2f:	09 cb                	or     %ecx,%ebx
+     e31:	f6 c3 03             	test   $0x3,%bl
+     e34:	74 24                	je     e5a <memcmp+0x3b>
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+      s1 += 4, s2 += 4;
+  while(n-- > 0){
+     e36:	8d 70 ff             	lea    -0x1(%eax),%esi
+     e39:	85 c0                	test   %eax,%eax
+     e3b:	74 32                	je     e6f <memcmp+0x50>
+    if(*s1 != *s2)
+     e3d:	0f b6 02             	movzbl (%edx),%eax
+     e40:	0f b6 19             	movzbl (%ecx),%ebx
+     e43:	38 d8                	cmp    %bl,%al
+     e45:	75 20                	jne    e67 <memcmp+0x48>
+      return *s1 - *s2;
+    s1++, s2++;
+     e47:	83 c2 01             	add    $0x1,%edx
+     e4a:	83 c1 01             	add    $0x1,%ecx
+  while(n-- > 0){
+     e4d:	89 f0                	mov    %esi,%eax
+     e4f:	eb e5                	jmp    e36 <memcmp+0x17>
+      s1 += 4, s2 += 4;
+     e51:	83 c2 04             	add    $0x4,%edx
+     e54:	83 c1 04             	add    $0x4,%ecx
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+     e57:	83 e8 04             	sub    $0x4,%eax
+     e5a:	83 f8 03             	cmp    $0x3,%eax
+     e5d:	76 d7                	jbe    e36 <memcmp+0x17>
+     e5f:	8b 31                	mov    (%ecx),%esi
+     e61:	39 32                	cmp    %esi,(%edx)
+     e63:	74 ec                	je     e51 <memcmp+0x32>
+     e65:	eb cf                	jmp    e36 <memcmp+0x17>
+      return *s1 - *s2;
+     e67:	0f b6 c0             	movzbl %al,%eax
+     e6a:	0f b6 db             	movzbl %bl,%ebx
+     e6d:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     e6f:	5b                   	pop    %ebx
+     e70:	5e                   	pop    %esi
+     e71:	5d                   	pop    %ebp
+     e72:	c3                   	ret
+
+00000e73 <memchr>:
+// The first c in the n bytes at v, or 0.  Once aligned, a word at
+// a time, with the word's bytes that equal c turned into zeroes
+// and those looked for.
+void*
+memchr(const void *v, int c, uint n)
+{
+     e73:	55                   	push   %ebp
+     e74:	89 e5                	mov    %esp,%ebp
+     e76:	57                   	push   %edi
+     e77:	56                   	push   %esi
+     e78:	53                   	push   %ebx
+     e79:	8b 45 08             	mov    0x8(%ebp),%eax
+     e7c:	8b 55 10             	mov    0x10(%ebp),%edx
+  const uchar *s;
+  uint w, rep;
+
+  s = v;
+  c = (uchar)c;
+     e7f:	0f b6 75 0c          	movzbl 0xc(%ebp),%esi
+  for(; n > 0 && ((uint)s & 3); n--, s++)
+     e83:	eb 06                	jmp    e8b <memchr+0x18>
+     e85:	83 ea 01             	sub    $0x1,%edx
+     e88:	83 c0 01             	add    $0x1,%eax
+     e8b:	85 d2                	test   %edx,%edx
+     e8d:	74 0d                	je     e9c <memchr+0x29>
+     e8f:	a8 03                	test   $0x3,%al
+     e91:	74 09                	je     e9c <memchr+0x29>
+    if(*s == c)
+     e93:	0f b6 08             	movzbl (%eax),%ecx
+     e96:	39 f1                	cmp    %esi,%ecx
+     e98:	75 eb                	jne    e85 <memchr+0x12>
+     e9a:	eb 41                	jmp    edd <memchr+0x6a>
+      return (void*)s;
+  rep = c * 0x01010101;
+     e9c:	69 fe 01 01 01 01    	imul   $0x1010101,%esi,%edi
+  for(; n >= 4; n -= 4, s += 4){
+     ea2:	eb 06                	jmp    eaa <memchr+0x37>
+     ea4:	83 ea 04             	sub    $0x4,%edx
+     ea7:	83 c0 04             	add    $0x4,%eax
+     eaa:	83 fa 03             	cmp    $0x3,%edx
+     ead:	76 16                	jbe    ec5 <memchr+0x52>
+    w = *(uint*)s ^ rep;
+     eaf:	89 f9                	mov    %edi,%ecx
+     eb1:	33 08                	xor    (%eax),%ecx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     eb3:	8d 99 ff fe fe fe    	lea    -0x1010101(%ecx),%ebx
+     eb9:	f7 d1                	not    %ecx
+     ebb:	21 cb                	and    %ecx,%ebx
+     ebd:	f7 c3 80 80 80 80    	test   $0x80808080,%ebx
+     ec3:	74 df                	je     ea4 <memchr+0x31>
+      break;
+  }
+  for(; n > 0; n--, s++)
+     ec5:	85 d2                	test   %edx,%edx
+     ec7:	74 0f                	je     ed8 <memchr+0x65>
+    if(*s == c)
+     ec9:	0f b6 08             	movzbl (%eax),%ecx
+     ecc:	39 f1                	cmp    %esi,%ecx
+     ece:	74 0d                	je     edd <memchr+0x6a>
+  for(; n > 0; n--, s++)
+     ed0:	83 ea 01             	sub    $0x1,%edx
+     ed3:	83 c0 01             	add    $0x1,%eax
+     ed6:	eb ed                	jmp    ec5 <memchr+0x52>
+      return (void*)s;
+  return 0;
+     ed8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     edd:	5b                   	pop    %ebx
+     ede:	5e                   	pop    %esi
+     edf:	5f                   	pop    %edi
+     ee0:	5d                   	pop    %ebp
+     ee1:	c3                   	ret
+
+00000ee2 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     ee2:	55                   	push   %ebp
+     ee3:	89 e5                	mov    %esp,%ebp
+     ee5:	57                   	push   %edi
+     ee6:	56                   	push   %esi
+     ee7:	53                   	push   %ebx
+     ee8:	83 ec 1c             	sub    $0x1c,%esp
+     eeb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     eee:	bb 00 00 00 00       	mov    $0x0,%ebx
+     ef3:	89 de                	mov    %ebx,%esi
+     ef5:	83 c3 01             	add    $0x1,%ebx
+     ef8:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     efb:	7d 2e                	jge    f2b <gets+0x49>
+    cc = read(0, &c, 1);
+     efd:	83 ec 04             	sub    $0x4,%esp
+     f00:	6a 01                	push   $0x1
+     f02:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     f05:	50                   	push   %eax
+     f06:	6a 00                	push   $0x0
+     f08:	e8 51 05 00 00       	call   145e <read>
+    if(cc < 1)
+     f0d:	83 c4 10             	add    $0x10,%esp
+     f10:	85 c0                	test   %eax,%eax
+     f12:	7e 17                	jle    f2b <gets+0x49>
+      break;
+    buf[i++] = c;
+     f14:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     f18:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+     f1b:	3c 0a                	cmp    $0xa,%al
+     f1d:	0f 94 c2             	sete   %dl
+     f20:	3c 0d                	cmp    $0xd,%al
+     f22:	0f 94 c0             	sete   %al
+     f25:	08 c2                	or     %al,%dl
+     f27:	74 ca                	je     ef3 <gets+0x11>
+    buf[i++] = c;
+     f29:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+     f2b:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+     f2f:	89 f8                	mov    %edi,%eax
+     f31:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f34:	5b                   	pop    %ebx
+     f35:	5e                   	pop    %esi
+     f36:	5f                   	pop    %edi
+     f37:	5d                   	pop    %ebp
+     f38:	c3                   	ret
+
+00000f39 <atoi>:
+  return r;
+}
+
+int
+atoi(const char *s)
+{
+     f39:	55                   	push   %ebp
+     f3a:	89 e5                	mov    %esp,%ebp
+     f3c:	53                   	push   %ebx
+     f3d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+     f40:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+     f45:	eb 10                	jmp    f57 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+     f47:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+     f4a:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+     f4d:	83 c1 01             	add    $0x1,%ecx
+     f50:	0f be c0             	movsbl %al,%eax
+     f53:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+     f57:	0f b6 01             	movzbl (%ecx),%eax
+     f5a:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     f5d:	80 fb 09             	cmp    $0x9,%bl
+     f60:	76 e5                	jbe    f47 <atoi+0xe>
+  return n;
+}
+     f62:	89 d0                	mov    %edx,%eax
+     f64:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     f67:	c9                   	leave
+     f68:	c3                   	ret
+
+00000f69 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     f69:	55                   	push   %ebp
+     f6a:	89 e5                	mov    %esp,%ebp
+     f6c:	57                   	push   %edi
+     f6d:	56                   	push   %esi
+     f6e:	53                   	push   %ebx
+     f6f:	83 ec 08             	sub    $0x8,%esp
+     f72:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     f75:	8b 55 0c             	mov    0xc(%ebp),%edx
+     f78:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *src;
+  int h;
+
+  dst = vdst;
+  src = vsrc;
+  if(n <= 0)
+     f7b:	85 c0                	test   %eax,%eax
+     f7d:	0f 8e 82 00 00 00    	jle    1005 <memmove+0x9c>
+    return vdst;
+  if(src < dst && src + n > dst){
+     f83:	39 da                	cmp    %ebx,%edx
+     f85:	73 07                	jae    f8e <memmove+0x25>
+     f87:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+     f8a:	39 cb                	cmp    %ecx,%ebx
+     f8c:	72 5e                	jb     fec <memmove+0x83>
+    movsbback(dst + n - 1, src + n - 1, n);
+    return vdst;
+  }
+  if(n >= 16 && (((uint)dst ^ (uint)src) & 3) == 0){
+     f8e:	83 f8 0f             	cmp    $0xf,%eax
+     f91:	7e 69                	jle    ffc <memmove+0x93>
+     f93:	89 d9                	mov    %ebx,%ecx
+     f95:	31 d1                	xor    %edx,%ecx
+     f97:	f6 c1 03             	test   $0x3,%cl
+     f9a:	75 73                	jne    100f <memmove+0xa6>
+    h = -(uint)dst & 3;
+     f9c:	89 d9                	mov    %ebx,%ecx
+     f9e:	f7 d9                	neg    %ecx
+     fa0:	83 e1 03             	and    $0x3,%ecx
+}
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsb" :
+     fa3:	89 df                	mov    %ebx,%edi
+     fa5:	89 d6                	mov    %edx,%esi
+     fa7:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+     faa:	fc                   	cld
+     fab:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    movsb(dst, src, h);
+    dst += h, src += h, n -= h;
+     fad:	8b 75 f0             	mov    -0x10(%ebp),%esi
+     fb0:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+     fb3:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+     fb6:	29 f0                	sub    %esi,%eax
+    movsl(dst, src, n/4);
+     fb8:	8d 50 03             	lea    0x3(%eax),%edx
+     fbb:	0f 49 d0             	cmovns %eax,%edx
+     fbe:	c1 fa 02             	sar    $0x2,%edx
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+     fc1:	89 7d f0             	mov    %edi,-0x10(%ebp)
+     fc4:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     fc7:	89 ce                	mov    %ecx,%esi
+     fc9:	89 d1                	mov    %edx,%ecx
+     fcb:	fc                   	cld
+     fcc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    dst += n/4*4, src += n/4*4, n %= 4;
+     fce:	c1 e2 02             	shl    $0x2,%edx
+     fd1:	8b 7d f0             	mov    -0x10(%ebp),%edi
+     fd4:	01 d7                	add    %edx,%edi
+     fd6:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     fd9:	01 ca                	add    %ecx,%edx
+     fdb:	89 c6                	mov    %eax,%esi
+     fdd:	c1 fe 1f             	sar    $0x1f,%esi
+     fe0:	c1 ee 1e             	shr    $0x1e,%esi
+     fe3:	01 f0                	add    %esi,%eax
+     fe5:	83 e0 03             	and    $0x3,%eax
+     fe8:	29 f0                	sub    %esi,%eax
+     fea:	eb 12                	jmp    ffe <memmove+0x95>
+    movsbback(dst + n - 1, src + n - 1, n);
+     fec:	8d 78 ff             	lea    -0x1(%eax),%edi
+     fef:	8d 34 3a             	lea    (%edx,%edi,1),%esi
+     ff2:	01 df                	add    %ebx,%edi
+// Copy cnt bytes down from the last ones, at dst and src, to the
+// first: for overlapping moves up.
+static inline void
+movsbback(void *dst, const void *src, int cnt)
+{
+  asm volatile("std; rep movsb; cld" :
+     ff4:	89 c1                	mov    %eax,%ecx
+     ff6:	fd                   	std
+     ff7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     ff9:	fc                   	cld
+    return vdst;
+     ffa:	eb 09                	jmp    1005 <memmove+0x9c>
+  dst = vdst;
+     ffc:	89 df                	mov    %ebx,%edi
+  asm volatile("cld; rep movsb" :
+     ffe:	89 d6                	mov    %edx,%esi
+    1000:	89 c1                	mov    %eax,%ecx
+    1002:	fc                   	cld
+    1003:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  }
+  movsb(dst, src, n);
+  return vdst;
+}
+    1005:	89 d8                	mov    %ebx,%eax
+    1007:	83 c4 08             	add    $0x8,%esp
+    100a:	5b                   	pop    %ebx
+    100b:	5e                   	pop    %esi
+    100c:	5f                   	pop    %edi
+    100d:	5d                   	pop    %ebp
+    100e:	c3                   	ret
+  dst = vdst;
+    100f:	89 df                	mov    %ebx,%edi
+    1011:	eb eb                	jmp    ffe <memmove+0x95>
+
+00001013 <vclock_gettime>:
+
+// clock_gettime() without a system call: read the clock page
+// that the kernel maps at CLOCKPAGE (see clock.h).
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+    1013:	55                   	push   %ebp
+    1014:	89 e5                	mov    %esp,%ebp
+    1016:	57                   	push   %edi
+    1017:	56                   	push   %esi
+    1018:	53                   	push   %ebx
+    1019:	83 ec 14             	sub    $0x14,%esp
+  struct clockpage *cp = (struct clockpage*)CLOCKPAGE;
+  uint seq, rem, d;
+  uint64 tsc, ns, now;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+    101c:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+    1020:	0f 87 a3 00 00 00    	ja     10c9 <vclock_gettime+0xb6>
+    return -1;
+  do {
+    seq = cp->seq;
+    1026:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+    __sync_synchronize();
+    102b:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    tsc = cp->tsc;
+    1030:	8b 15 10 f0 ff 7f    	mov    0x7ffff010,%edx
+    1036:	8b 1d 14 f0 ff 7f    	mov    0x7ffff014,%ebx
+    ns = cp->ns;
+    103c:	8b 35 18 f0 ff 7f    	mov    0x7ffff018,%esi
+    1042:	8b 3d 1c f0 ff 7f    	mov    0x7ffff01c,%edi
+    __sync_synchronize();
+    1048:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != cp->seq);
+    104d:	89 c1                	mov    %eax,%ecx
+    104f:	83 e1 01             	and    $0x1,%ecx
+    1052:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+    1055:	75 cf                	jne    1026 <vclock_gettime+0x13>
+    1057:	8b 0d 00 f0 ff 7f    	mov    0x7ffff000,%ecx
+    105d:	39 c1                	cmp    %eax,%ecx
+    105f:	75 c5                	jne    1026 <vclock_gettime+0x13>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+    1061:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+    1064:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    1067:	0f 31                	rdtsc
+    1069:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    106c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    106f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  now = rdtsc();
+  // Less than a tick has passed since the update, so the delta
+  // fits in 32 bits.
+  d = now > tsc ? now - tsc : 0;
+    1072:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    1075:	19 d3                	sbb    %edx,%ebx
+    1077:	73 07                	jae    1080 <vclock_gettime+0x6d>
+    1079:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+    107c:	29 d8                	sub    %ebx,%eax
+    107e:	89 c1                	mov    %eax,%ecx
+  ns += ((uint64)d * cp->mult) >> cp->shift;
+    1080:	89 c8                	mov    %ecx,%eax
+    1082:	f7 25 04 f0 ff 7f    	mull   0x7ffff004
+    1088:	0f b6 0d 08 f0 ff 7f 	movzbl 0x7ffff008,%ecx
+    108f:	0f ad d0             	shrd   %cl,%edx,%eax
+    1092:	d3 ea                	shr    %cl,%edx
+    1094:	f6 c1 20             	test   $0x20,%cl
+    1097:	74 04                	je     109d <vclock_gettime+0x8a>
+    1099:	89 d0                	mov    %edx,%eax
+    109b:	31 d2                	xor    %edx,%edx
+    109d:	01 f0                	add    %esi,%eax
+    109f:	11 fa                	adc    %edi,%edx
+static inline uint
+divl(uint64 n, uint d, uint *r)
+{
+  uint q;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (*r) :
+    10a1:	bb 00 ca 9a 3b       	mov    $0x3b9aca00,%ebx
+    10a6:	f7 f3                	div    %ebx
+  ts->tv_sec = divl(ns, 1000000000, &rem);
+    10a8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    10ab:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = rem;
+    10ad:	89 57 04             	mov    %edx,0x4(%edi)
+  if(clk == CLOCK_REALTIME)
+    10b0:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    10b4:	75 1a                	jne    10d0 <vclock_gettime+0xbd>
+    ts->tv_sec += cp->boottime;
+    10b6:	03 05 0c f0 ff 7f    	add    0x7ffff00c,%eax
+    10bc:	89 07                	mov    %eax,(%edi)
+  return 0;
+    10be:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    10c1:	83 c4 14             	add    $0x14,%esp
+    10c4:	5b                   	pop    %ebx
+    10c5:	5e                   	pop    %esi
+    10c6:	5f                   	pop    %edi
+    10c7:	5d                   	pop    %ebp
+    10c8:	c3                   	ret
+    return -1;
+    10c9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    10ce:	eb f1                	jmp    10c1 <vclock_gettime+0xae>
+  return 0;
+    10d0:	b8 00 00 00 00       	mov    $0x0,%eax
+    10d5:	eb ea                	jmp    10c1 <vclock_gettime+0xae>
+
+000010d7 <flush>:
+
+// Write out fd's buffer, or with fd < 0 every buffer.
+// Returns -1 if a write fails.
+int
+flush(int fd)
+{
+    10d7:	55                   	push   %ebp
+    10d8:	89 e5                	mov    %esp,%ebp
+    10da:	56                   	push   %esi
+    10db:	53                   	push   %ebx
+    10dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  int r, n;
+
+  if(fd < 0){
+    10df:	85 c0                	test   %eax,%eax
+    10e1:	78 5d                	js     1140 <flush+0x69>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+      if(flush(fd) < 0)
+        r = -1;
+    return r;
+  }
+  if(fd >= NOBUF || (n = obuf[fd].n) == 0)
+    10e3:	83 f8 0f             	cmp    $0xf,%eax
+    10e6:	7f 64                	jg     114c <flush+0x75>
+    10e8:	69 d0 08 02 00 00    	imul   $0x208,%eax,%edx
+    10ee:	8b b2 e4 2a 00 00    	mov    0x2ae4(%edx),%esi
+    10f4:	85 f6                	test   %esi,%esi
+    10f6:	74 59                	je     1151 <flush+0x7a>
+    return 0;
+  obuf[fd].n = 0;
+    10f8:	c7 82 e4 2a 00 00 00 	movl   $0x0,0x2ae4(%edx)
+    10ff:	00 00 00 
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+    1102:	81 c2 e8 2a 00 00    	add    $0x2ae8,%edx
+    1108:	83 ec 04             	sub    $0x4,%esp
+    110b:	56                   	push   %esi
+    110c:	52                   	push   %edx
+    110d:	50                   	push   %eax
+    110e:	e8 5a 03 00 00       	call   146d <write>
+    1113:	83 c4 10             	add    $0x10,%esp
+    1116:	39 f0                	cmp    %esi,%eax
+    1118:	75 40                	jne    115a <flush+0x83>
+    111a:	be 00 00 00 00       	mov    $0x0,%esi
+    111f:	eb 30                	jmp    1151 <flush+0x7a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+    1121:	83 c3 01             	add    $0x1,%ebx
+    1124:	83 fb 0f             	cmp    $0xf,%ebx
+    1127:	7f 28                	jg     1151 <flush+0x7a>
+      if(flush(fd) < 0)
+    1129:	83 ec 0c             	sub    $0xc,%esp
+    112c:	53                   	push   %ebx
+    112d:	e8 a5 ff ff ff       	call   10d7 <flush>
+    1132:	83 c4 10             	add    $0x10,%esp
+    1135:	85 c0                	test   %eax,%eax
+    1137:	79 e8                	jns    1121 <flush+0x4a>
+        r = -1;
+    1139:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    113e:	eb e1                	jmp    1121 <flush+0x4a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+    1140:	be 00 00 00 00       	mov    $0x0,%esi
+    1145:	bb 00 00 00 00       	mov    $0x0,%ebx
+    114a:	eb d8                	jmp    1124 <flush+0x4d>
+    return 0;
+    114c:	be 00 00 00 00       	mov    $0x0,%esi
+}
+    1151:	89 f0                	mov    %esi,%eax
+    1153:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1156:	5b                   	pop    %ebx
+    1157:	5e                   	pop    %esi
+    1158:	5d                   	pop    %ebp
+    1159:	c3                   	ret
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+    115a:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    115f:	eb f0                	jmp    1151 <flush+0x7a>
+
+00001161 <bufreset>:
+
+static void
+bufreset(int fd)
+{
+  if(fd >= 0 && fd < NOBUF){
+    1161:	83 f8 0f             	cmp    $0xf,%eax
+    1164:	76 01                	jbe    1167 <bufreset+0x6>
+    1166:	c3                   	ret
+{
+    1167:	55                   	push   %ebp
+    1168:	89 e5                	mov    %esp,%ebp
+    116a:	53                   	push   %ebx
+    116b:	83 ec 10             	sub    $0x10,%esp
+    116e:	89 c3                	mov    %eax,%ebx
+    flush(fd);
+    1170:	50                   	push   %eax
+    1171:	e8 61 ff ff ff       	call   10d7 <flush>
+    obuf[fd].mode = BUNKNOWN;
+    1176:	69 db 08 02 00 00    	imul   $0x208,%ebx,%ebx
+    117c:	c7 83 e0 2a 00 00 00 	movl   $0x0,0x2ae0(%ebx)
+    1183:	00 00 00 
+    1186:	83 c4 10             	add    $0x10,%esp
+  }
+}
+    1189:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    118c:	c9                   	leave
+    118d:	c3                   	ret
+
+0000118e <bufwrite>:
+
+// Write n bytes from p to fd, through its buffer.
+// Returns n, or -1 if a write fails.
+int
+bufwrite(int fd, const void *p, int n)
+{
+    118e:	55                   	push   %ebp
+    118f:	89 e5                	mov    %esp,%ebp
+    1191:	57                   	push   %edi
+    1192:	56                   	push   %esi
+    1193:	53                   	push   %ebx
+    1194:	83 ec 3c             	sub    $0x3c,%esp
+    1197:	8b 75 08             	mov    0x8(%ebp),%esi
+    119a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct stat st;
+  const char *s;
+  int i;
+
+  if(fd < 0 || fd >= NOBUF)
+    119d:	83 fe 0f             	cmp    $0xf,%esi
+    11a0:	0f 87 a2 00 00 00    	ja     1248 <bufwrite+0xba>
+    return write(fd, p, n);
+  if(obuf[fd].mode == BUNKNOWN){
+    11a6:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+    11ac:	83 b8 e0 2a 00 00 00 	cmpl   $0x0,0x2ae0(%eax)
+    11b3:	75 19                	jne    11ce <bufwrite+0x40>
+    if(fd == 2 || fstat(fd, &st) < 0)
+    11b5:	83 fe 02             	cmp    $0x2,%esi
+    11b8:	0f 85 9c 00 00 00    	jne    125a <bufwrite+0xcc>
+      obuf[fd].mode = BNONE;
+    11be:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+    11c4:	c7 80 e0 2a 00 00 01 	movl   $0x1,0x2ae0(%eax)
+    11cb:	00 00 00 
+    else
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+  }
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+    11ce:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+    11d4:	89 da                	mov    %ebx,%edx
+    11d6:	03 90 e4 2a 00 00    	add    0x2ae4(%eax),%edx
+    11dc:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+    11e2:	0f 8f ae 00 00 00    	jg     1296 <bufwrite+0x108>
+    return -1;
+  if(n >= OBUFSZ)
+    11e8:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+    11ee:	0f 8f bd 00 00 00    	jg     12b1 <bufwrite+0x123>
+    return write(fd, p, n);
+  memmove(obuf[fd].buf + obuf[fd].n, p, n);
+    11f4:	69 d6 08 02 00 00    	imul   $0x208,%esi,%edx
+    11fa:	8d ba e0 2a 00 00    	lea    0x2ae0(%edx),%edi
+    1200:	8b 82 e4 2a 00 00    	mov    0x2ae4(%edx),%eax
+    1206:	83 ec 04             	sub    $0x4,%esp
+    1209:	53                   	push   %ebx
+    120a:	ff 75 0c             	push   0xc(%ebp)
+    120d:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+    1210:	8d 84 10 e8 2a 00 00 	lea    0x2ae8(%eax,%edx,1),%eax
+    1217:	50                   	push   %eax
+    1218:	e8 4c fd ff ff       	call   f69 <memmove>
+  obuf[fd].n += n;
+    121d:	01 5f 04             	add    %ebx,0x4(%edi)
+  if(obuf[fd].mode == BNONE)
+    1220:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+    1223:	8b 82 e0 2a 00 00    	mov    0x2ae0(%edx),%eax
+    1229:	83 c4 10             	add    $0x10,%esp
+    122c:	83 f8 01             	cmp    $0x1,%eax
+    122f:	0f 84 91 00 00 00    	je     12c6 <bufwrite+0x138>
+    return flush(fd) < 0 ? -1 : n;
+  if(obuf[fd].mode == BLINE)
+    1235:	83 f8 02             	cmp    $0x2,%eax
+    1238:	0f 84 ca 00 00 00    	je     1308 <bufwrite+0x17a>
+    for(s = p, i = 0; i < n; i++)
+      if(s[i] == '\n')
+        return flush(fd) < 0 ? -1 : n;
+  return n;
+    123e:	89 d8                	mov    %ebx,%eax
+}
+    1240:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1243:	5b                   	pop    %ebx
+    1244:	5e                   	pop    %esi
+    1245:	5f                   	pop    %edi
+    1246:	5d                   	pop    %ebp
+    1247:	c3                   	ret
+    return write(fd, p, n);
+    1248:	83 ec 04             	sub    $0x4,%esp
+    124b:	53                   	push   %ebx
+    124c:	ff 75 0c             	push   0xc(%ebp)
+    124f:	56                   	push   %esi
+    1250:	e8 18 02 00 00       	call   146d <write>
+    1255:	83 c4 10             	add    $0x10,%esp
+    1258:	eb e6                	jmp    1240 <bufwrite+0xb2>
+    if(fd == 2 || fstat(fd, &st) < 0)
+    125a:	83 ec 08             	sub    $0x8,%esp
+    125d:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+    1260:	50                   	push   %eax
+    1261:	56                   	push   %esi
+    1262:	e8 51 02 00 00       	call   14b8 <fstat>
+    1267:	83 c4 10             	add    $0x10,%esp
+    126a:	85 c0                	test   %eax,%eax
+    126c:	0f 88 4c ff ff ff    	js     11be <bufwrite+0x30>
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+    1272:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+    1277:	74 16                	je     128f <bufwrite+0x101>
+    1279:	ba 03 00 00 00       	mov    $0x3,%edx
+    127e:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+    1284:	89 90 e0 2a 00 00    	mov    %edx,0x2ae0(%eax)
+    128a:	e9 3f ff ff ff       	jmp    11ce <bufwrite+0x40>
+    128f:	ba 02 00 00 00       	mov    $0x2,%edx
+    1294:	eb e8                	jmp    127e <bufwrite+0xf0>
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+    1296:	83 ec 0c             	sub    $0xc,%esp
+    1299:	56                   	push   %esi
+    129a:	e8 38 fe ff ff       	call   10d7 <flush>
+    129f:	83 c4 10             	add    $0x10,%esp
+    12a2:	85 c0                	test   %eax,%eax
+    12a4:	0f 89 3e ff ff ff    	jns    11e8 <bufwrite+0x5a>
+    return -1;
+    12aa:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12af:	eb 8f                	jmp    1240 <bufwrite+0xb2>
+    return write(fd, p, n);
+    12b1:	83 ec 04             	sub    $0x4,%esp
+    12b4:	53                   	push   %ebx
+    12b5:	ff 75 0c             	push   0xc(%ebp)
+    12b8:	56                   	push   %esi
+    12b9:	e8 af 01 00 00       	call   146d <write>
+    12be:	83 c4 10             	add    $0x10,%esp
+    12c1:	e9 7a ff ff ff       	jmp    1240 <bufwrite+0xb2>
+    return flush(fd) < 0 ? -1 : n;
+    12c6:	83 ec 0c             	sub    $0xc,%esp
+    12c9:	56                   	push   %esi
+    12ca:	e8 08 fe ff ff       	call   10d7 <flush>
+    12cf:	83 c4 10             	add    $0x10,%esp
+    12d2:	85 c0                	test   %eax,%eax
+    12d4:	78 07                	js     12dd <bufwrite+0x14f>
+    12d6:	89 d8                	mov    %ebx,%eax
+    12d8:	e9 63 ff ff ff       	jmp    1240 <bufwrite+0xb2>
+    12dd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    12e2:	e9 59 ff ff ff       	jmp    1240 <bufwrite+0xb2>
+        return flush(fd) < 0 ? -1 : n;
+    12e7:	83 ec 0c             	sub    $0xc,%esp
+    12ea:	56                   	push   %esi
+    12eb:	e8 e7 fd ff ff       	call   10d7 <flush>
+    12f0:	83 c4 10             	add    $0x10,%esp
+    12f3:	85 c0                	test   %eax,%eax
+    12f5:	78 07                	js     12fe <bufwrite+0x170>
+    12f7:	89 d8                	mov    %ebx,%eax
+    12f9:	e9 42 ff ff ff       	jmp    1240 <bufwrite+0xb2>
+    12fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1303:	e9 38 ff ff ff       	jmp    1240 <bufwrite+0xb2>
+    for(s = p, i = 0; i < n; i++)
+    1308:	b8 00 00 00 00       	mov    $0x0,%eax
+    130d:	39 d8                	cmp    %ebx,%eax
+    130f:	7d 0e                	jge    131f <bufwrite+0x191>
+      if(s[i] == '\n')
+    1311:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    1314:	80 3c 01 0a          	cmpb   $0xa,(%ecx,%eax,1)
+    1318:	74 cd                	je     12e7 <bufwrite+0x159>
+    for(s = p, i = 0; i < n; i++)
+    131a:	83 c0 01             	add    $0x1,%eax
+    131d:	eb ee                	jmp    130d <bufwrite+0x17f>
+  return n;
+    131f:	89 d8                	mov    %ebx,%eax
+    1321:	e9 1a ff ff ff       	jmp    1240 <bufwrite+0xb2>
+
+00001326 <fork>:
+
+int
+fork(void)
+{
+    1326:	55                   	push   %ebp
+    1327:	89 e5                	mov    %esp,%ebp
+    1329:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+    132c:	6a ff                	push   $0xffffffff
+    132e:	e8 a4 fd ff ff       	call   10d7 <flush>
+  return _fork();
+    1333:	e8 bd 00 00 00       	call   13f5 <_fork>
+}
+    1338:	c9                   	leave
+    1339:	c3                   	ret
+
+0000133a <exit>:
+
+int
+exit(void)
+{
+    133a:	55                   	push   %ebp
+    133b:	89 e5                	mov    %esp,%ebp
+    133d:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+    1340:	6a ff                	push   $0xffffffff
+    1342:	e8 90 fd ff ff       	call   10d7 <flush>
+  _exit();
+    1347:	e8 b8 00 00 00       	call   1404 <_exit>
+
+0000134c <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+    134c:	55                   	push   %ebp
+    134d:	89 e5                	mov    %esp,%ebp
+    134f:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+    1352:	6a ff                	push   $0xffffffff
+    1354:	e8 7e fd ff ff       	call   10d7 <flush>
+  return _exec(path, argv);
+    1359:	83 c4 08             	add    $0x8,%esp
+    135c:	ff 75 0c             	push   0xc(%ebp)
+    135f:	ff 75 08             	push   0x8(%ebp)
+    1362:	e8 bb 00 00 00       	call   1422 <_exec>
+}
+    1367:	c9                   	leave
+    1368:	c3                   	ret
+
+00001369 <close>:
+
+int
+close(int fd)
+{
+    1369:	55                   	push   %ebp
+    136a:	89 e5                	mov    %esp,%ebp
+    136c:	53                   	push   %ebx
+    136d:	83 ec 04             	sub    $0x4,%esp
+    1370:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bufreset(fd);
+    1373:	89 d8                	mov    %ebx,%eax
+    1375:	e8 e7 fd ff ff       	call   1161 <bufreset>
+  return _close(fd);
+    137a:	83 ec 0c             	sub    $0xc,%esp
+    137d:	53                   	push   %ebx
+    137e:	e8 90 00 00 00       	call   1413 <_close>
+}
+    1383:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1386:	c9                   	leave
+    1387:	c3                   	ret
+
+00001388 <stat>:
+{
+    1388:	55                   	push   %ebp
+    1389:	89 e5                	mov    %esp,%ebp
+    138b:	56                   	push   %esi
+    138c:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+    138d:	83 ec 08             	sub    $0x8,%esp
+    1390:	6a 00                	push   $0x0
+    1392:	ff 75 08             	push   0x8(%ebp)
+    1395:	e8 f1 00 00 00       	call   148b <open>
+  if(fd < 0)
+    139a:	83 c4 10             	add    $0x10,%esp
+    139d:	85 c0                	test   %eax,%eax
+    139f:	78 24                	js     13c5 <stat+0x3d>
+    13a1:	89 c3                	mov    %eax,%ebx
+  r = fstat(fd, st);
+    13a3:	83 ec 08             	sub    $0x8,%esp
+    13a6:	ff 75 0c             	push   0xc(%ebp)
+    13a9:	50                   	push   %eax
+    13aa:	e8 09 01 00 00       	call   14b8 <fstat>
+    13af:	89 c6                	mov    %eax,%esi
+  close(fd);
+    13b1:	89 1c 24             	mov    %ebx,(%esp)
+    13b4:	e8 b0 ff ff ff       	call   1369 <close>
+  return r;
+    13b9:	83 c4 10             	add    $0x10,%esp
+}
+    13bc:	89 f0                	mov    %esi,%eax
+    13be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    13c1:	5b                   	pop    %ebx
+    13c2:	5e                   	pop    %esi
+    13c3:	5d                   	pop    %ebp
+    13c4:	c3                   	ret
+    return -1;
+    13c5:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    13ca:	eb f0                	jmp    13bc <stat+0x34>
+
+000013cc <dup2>:
+
+int
+dup2(int oldfd, int newfd)
+{
+    13cc:	55                   	push   %ebp
+    13cd:	89 e5                	mov    %esp,%ebp
+    13cf:	56                   	push   %esi
+    13d0:	53                   	push   %ebx
+    13d1:	8b 75 08             	mov    0x8(%ebp),%esi
+    13d4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(oldfd != newfd)
+    13d7:	39 de                	cmp    %ebx,%esi
+    13d9:	75 11                	jne    13ec <dup2+0x20>
+    bufreset(newfd);
+  return _dup2(oldfd, newfd);
+    13db:	83 ec 08             	sub    $0x8,%esp
+    13de:	53                   	push   %ebx
+    13df:	56                   	push   %esi
+    13e0:	e8 4c 00 00 00       	call   1431 <_dup2>
+}
+    13e5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    13e8:	5b                   	pop    %ebx
+    13e9:	5e                   	pop    %esi
+    13ea:	5d                   	pop    %ebp
+    13eb:	c3                   	ret
+    bufreset(newfd);
+    13ec:	89 d8                	mov    %ebx,%eax
+    13ee:	e8 6e fd ff ff       	call   1161 <bufreset>
+    13f3:	eb e6                	jmp    13db <dup2+0xf>
+
+000013f5 <_fork>:
+  1: ret
+
+#define SYSCALL(name) STUB(name, SYS_ ## name)
+
+# ulib.c wraps these, to flush printf()'s buffers first.
+STUB(_fork, SYS_fork)
+    13f5:	b8 01 00 00 00       	mov    $0x1,%eax
+    13fa:	89 e1                	mov    %esp,%ecx
+    13fc:	ba 03 14 00 00       	mov    $0x1403,%edx
+    1401:	0f 34                	sysenter
+    1403:	c3                   	ret
+
+00001404 <_exit>:
+STUB(_exit, SYS_exit)
+    1404:	b8 02 00 00 00       	mov    $0x2,%eax
+    1409:	89 e1                	mov    %esp,%ecx
+    140b:	ba 12 14 00 00       	mov    $0x1412,%edx
+    1410:	0f 34                	sysenter
+    1412:	c3                   	ret
+
+00001413 <_close>:
+STUB(_close, SYS_close)
+    1413:	b8 15 00 00 00       	mov    $0x15,%eax
+    1418:	89 e1                	mov    %esp,%ecx
+    141a:	ba 21 14 00 00       	mov    $0x1421,%edx
+    141f:	0f 34                	sysenter
+    1421:	c3                   	ret
+
+00001422 <_exec>:
+STUB(_exec, SYS_exec)
+    1422:	b8 07 00 00 00       	mov    $0x7,%eax
+    1427:	89 e1                	mov    %esp,%ecx
+    1429:	ba 30 14 00 00       	mov    $0x1430,%edx
+    142e:	0f 34                	sysenter
+    1430:	c3                   	ret
+
+00001431 <_dup2>:
+STUB(_dup2, SYS_dup2)
+    1431:	b8 17 00 00 00       	mov    $0x17,%eax
+    1436:	89 e1                	mov    %esp,%ecx
+    1438:	ba 3f 14 00 00       	mov    $0x143f,%edx
+    143d:	0f 34                	sysenter
+    143f:	c3                   	ret
+
+00001440 <wait>:
+
+SYSCALL(wait)
+    1440:	b8 03 00 00 00       	mov    $0x3,%eax
+    1445:	89 e1                	mov    %esp,%ecx
+    1447:	ba 4e 14 00 00       	mov    $0x144e,%edx
+    144c:	0f 34                	sysenter
+    144e:	c3                   	ret
+
+0000144f <pipe>:
+SYSCALL(pipe)
+    144f:	b8 04 00 00 00       	mov    $0x4,%eax
+    1454:	89 e1                	mov    %esp,%ecx
+    1456:	ba 5d 14 00 00       	mov    $0x145d,%edx
+    145b:	0f 34                	sysenter
+    145d:	c3                   	ret
+
+0000145e <read>:
+SYSCALL(read)
+    145e:	b8 05 00 00 00       	mov    $0x5,%eax
+    1463:	89 e1                	mov    %esp,%ecx
+    1465:	ba 6c 14 00 00       	mov    $0x146c,%edx
+    146a:	0f 34                	sysenter
+    146c:	c3                   	ret
+
+0000146d <write>:
+SYSCALL(write)
+    146d:	b8 10 00 00 00       	mov    $0x10,%eax
+    1472:	89 e1                	mov    %esp,%ecx
+    1474:	ba 7b 14 00 00       	mov    $0x147b,%edx
+    1479:	0f 34                	sysenter
+    147b:	c3                   	ret
+
+0000147c <kill>:
+SYSCALL(kill)
+    147c:	b8 06 00 00 00       	mov    $0x6,%eax
+    1481:	89 e1                	mov    %esp,%ecx
+    1483:	ba 8a 14 00 00       	mov    $0x148a,%edx
+    1488:	0f 34                	sysenter
+    148a:	c3                   	ret
+
+0000148b <open>:
+SYSCALL(open)
+    148b:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1490:	89 e1                	mov    %esp,%ecx
+    1492:	ba 99 14 00 00       	mov    $0x1499,%edx
+    1497:	0f 34                	sysenter
+    1499:	c3                   	ret
+
+0000149a <mknod>:
+SYSCALL(mknod)
+    149a:	b8 11 00 00 00       	mov    $0x11,%eax
+    149f:	89 e1                	mov    %esp,%ecx
+    14a1:	ba a8 14 00 00       	mov    $0x14a8,%edx
+    14a6:	0f 34                	sysenter
+    14a8:	c3                   	ret
+
+000014a9 <unlink>:
+SYSCALL(unlink)
+    14a9:	b8 12 00 00 00       	mov    $0x12,%eax
+    14ae:	89 e1                	mov    %esp,%ecx
+    14b0:	ba b7 14 00 00       	mov    $0x14b7,%edx
+    14b5:	0f 34                	sysenter
+    14b7:	c3                   	ret
+
+000014b8 <fstat>:
+SYSCALL(fstat)
+    14b8:	b8 08 00 00 00       	mov    $0x8,%eax
+    14bd:	89 e1                	mov    %esp,%ecx
+    14bf:	ba c6 14 00 00       	mov    $0x14c6,%edx
+    14c4:	0f 34                	sysenter
+    14c6:	c3                   	ret
+
+000014c7 <link>:
+SYSCALL(link)
+    14c7:	b8 13 00 00 00       	mov    $0x13,%eax
+    14cc:	89 e1                	mov    %esp,%ecx
+    14ce:	ba d5 14 00 00       	mov    $0x14d5,%edx
+    14d3:	0f 34                	sysenter
+    14d5:	c3                   	ret
+
+000014d6 <mkdir>:
+SYSCALL(mkdir)
+    14d6:	b8 14 00 00 00       	mov    $0x14,%eax
+    14db:	89 e1                	mov    %esp,%ecx
+    14dd:	ba e4 14 00 00       	mov    $0x14e4,%edx
+    14e2:	0f 34                	sysenter
+    14e4:	c3                   	ret
+
+000014e5 <chdir>:
+SYSCALL(chdir)
+    14e5:	b8 09 00 00 00       	mov    $0x9,%eax
+    14ea:	89 e1                	mov    %esp,%ecx
+    14ec:	ba f3 14 00 00       	mov    $0x14f3,%edx
+    14f1:	0f 34                	sysenter
+    14f3:	c3                   	ret
+
+000014f4 <dup>:
+SYSCALL(dup)
+    14f4:	b8 0a 00 00 00       	mov    $0xa,%eax
+    14f9:	89 e1                	mov    %esp,%ecx
+    14fb:	ba 02 15 00 00       	mov    $0x1502,%edx
+    1500:	0f 34                	sysenter
+    1502:	c3                   	ret
+
+00001503 <getpid>:
+SYSCALL(getpid)
+    1503:	b8 0b 00 00 00       	mov    $0xb,%eax
+    1508:	89 e1                	mov    %esp,%ecx
+    150a:	ba 11 15 00 00       	mov    $0x1511,%edx
+    150f:	0f 34                	sysenter
+    1511:	c3                   	ret
+
+00001512 <sbrk>:
+SYSCALL(sbrk)
+    1512:	b8 0c 00 00 00       	mov    $0xc,%eax
+    1517:	89 e1                	mov    %esp,%ecx
+    1519:	ba 20 15 00 00       	mov    $0x1520,%edx
+    151e:	0f 34                	sysenter
+    1520:	c3                   	ret
+
+00001521 <sleep>:
+SYSCALL(sleep)
+    1521:	b8 0d 00 00 00       	mov    $0xd,%eax
+    1526:	89 e1                	mov    %esp,%ecx
+    1528:	ba 2f 15 00 00       	mov    $0x152f,%edx
+    152d:	0f 34                	sysenter
+    152f:	c3                   	ret
+
+00001530 <uptime>:
+SYSCALL(uptime)
+    1530:	b8 0e 00 00 00       	mov    $0xe,%eax
+    1535:	89 e1                	mov    %esp,%ecx
+    1537:	ba 3e 15 00 00       	mov    $0x153e,%edx
+    153c:	0f 34                	sysenter
+    153e:	c3                   	ret
+
+0000153f <date>:
+SYSCALL(date)
+    153f:	b8 16 00 00 00       	mov    $0x16,%eax
+    1544:	89 e1                	mov    %esp,%ecx
+    1546:	ba 4d 15 00 00       	mov    $0x154d,%edx
+    154b:	0f 34                	sysenter
+    154d:	c3                   	ret
+
+0000154e <faultaround>:
+SYSCALL(faultaround)
+    154e:	b8 18 00 00 00       	mov    $0x18,%eax
+    1553:	89 e1                	mov    %esp,%ecx
+    1555:	ba 5c 15 00 00       	mov    $0x155c,%edx
+    155a:	0f 34                	sysenter
+    155c:	c3                   	ret
+
+0000155d <faultstat>:
+SYSCALL(faultstat)
+    155d:	b8 19 00 00 00       	mov    $0x19,%eax
+    1562:	89 e1                	mov    %esp,%ecx
+    1564:	ba 6b 15 00 00       	mov    $0x156b,%edx
+    1569:	0f 34                	sysenter
+    156b:	c3                   	ret
+
+0000156c <mmap>:
+SYSCALL(mmap)
+    156c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    1571:	89 e1                	mov    %esp,%ecx
+    1573:	ba 7a 15 00 00       	mov    $0x157a,%edx
+    1578:	0f 34                	sysenter
+    157a:	c3                   	ret
+
+0000157b <munmap>:
+SYSCALL(munmap)
+    157b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1580:	89 e1                	mov    %esp,%ecx
+    1582:	ba 89 15 00 00       	mov    $0x1589,%edx
+    1587:	0f 34                	sysenter
+    1589:	c3                   	ret
+
+0000158a <largepages>:
+SYSCALL(largepages)
+    158a:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    158f:	89 e1                	mov    %esp,%ecx
+    1591:	ba 98 15 00 00       	mov    $0x1598,%edx
+    1596:	0f 34                	sysenter
+    1598:	c3                   	ret
+
+00001599 <spawn>:
+SYSCALL(spawn)
+    1599:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    159e:	89 e1                	mov    %esp,%ecx
+    15a0:	ba a7 15 00 00       	mov    $0x15a7,%edx
+    15a5:	0f 34                	sysenter
+    15a7:	c3                   	ret
+
+000015a8 <setpriority>:
+SYSCALL(setpriority)
+    15a8:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    15ad:	89 e1                	mov    %esp,%ecx
+    15af:	ba b6 15 00 00       	mov    $0x15b6,%edx
+    15b4:	0f 34                	sysenter
+    15b6:	c3                   	ret
+
+000015b7 <getpriority>:
+SYSCALL(getpriority)
+    15b7:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    15bc:	89 e1                	mov    %esp,%ecx
+    15be:	ba c5 15 00 00       	mov    $0x15c5,%edx
+    15c3:	0f 34                	sysenter
+    15c5:	c3                   	ret
+
+000015c6 <getprocinfo>:
+SYSCALL(getprocinfo)
+    15c6:	b8 20 00 00 00       	mov    $0x20,%eax
+    15cb:	89 e1                	mov    %esp,%ecx
+    15cd:	ba d4 15 00 00       	mov    $0x15d4,%edx
+    15d2:	0f 34                	sysenter
+    15d4:	c3                   	ret
+
+000015d5 <getcpuinfo>:
+SYSCALL(getcpuinfo)
+    15d5:	b8 21 00 00 00       	mov    $0x21,%eax
+    15da:	89 e1                	mov    %esp,%ecx
+    15dc:	ba e3 15 00 00       	mov    $0x15e3,%edx
+    15e1:	0f 34                	sysenter
+    15e3:	c3                   	ret
+
+000015e4 <clone>:
+SYSCALL(clone)
+    15e4:	b8 22 00 00 00       	mov    $0x22,%eax
+    15e9:	89 e1                	mov    %esp,%ecx
+    15eb:	ba f2 15 00 00       	mov    $0x15f2,%edx
+    15f0:	0f 34                	sysenter
+    15f2:	c3                   	ret
+
+000015f3 <join>:
+SYSCALL(join)
+    15f3:	b8 23 00 00 00       	mov    $0x23,%eax
+    15f8:	89 e1                	mov    %esp,%ecx
+    15fa:	ba 01 16 00 00       	mov    $0x1601,%edx
+    15ff:	0f 34                	sysenter
+    1601:	c3                   	ret
+
+00001602 <futex_wait>:
+SYSCALL(futex_wait)
+    1602:	b8 24 00 00 00       	mov    $0x24,%eax
+    1607:	89 e1                	mov    %esp,%ecx
+    1609:	ba 10 16 00 00       	mov    $0x1610,%edx
+    160e:	0f 34                	sysenter
+    1610:	c3                   	ret
+
+00001611 <futex_wake>:
+SYSCALL(futex_wake)
+    1611:	b8 25 00 00 00       	mov    $0x25,%eax
+    1616:	89 e1                	mov    %esp,%ecx
+    1618:	ba 1f 16 00 00       	mov    $0x161f,%edx
+    161d:	0f 34                	sysenter
+    161f:	c3                   	ret
+
+00001620 <setaffinity>:
+SYSCALL(setaffinity)
+    1620:	b8 26 00 00 00       	mov    $0x26,%eax
+    1625:	89 e1                	mov    %esp,%ecx
+    1627:	ba 2e 16 00 00       	mov    $0x162e,%edx
+    162c:	0f 34                	sysenter
+    162e:	c3                   	ret
+
+0000162f <getaffinity>:
+SYSCALL(getaffinity)
+    162f:	b8 27 00 00 00       	mov    $0x27,%eax
+    1634:	89 e1                	mov    %esp,%ecx
+    1636:	ba 3d 16 00 00       	mov    $0x163d,%edx
+    163b:	0f 34                	sysenter
+    163d:	c3                   	ret
+
+0000163e <clock_gettime>:
+SYSCALL(clock_gettime)
+    163e:	b8 28 00 00 00       	mov    $0x28,%eax
+    1643:	89 e1                	mov    %esp,%ecx
+    1645:	ba 4c 16 00 00       	mov    $0x164c,%edx
+    164a:	0f 34                	sysenter
+    164c:	c3                   	ret
+
+0000164d <msleep>:
+SYSCALL(msleep)
+    164d:	b8 29 00 00 00       	mov    $0x29,%eax
+    1652:	89 e1                	mov    %esp,%ecx
+    1654:	ba 5b 16 00 00       	mov    $0x165b,%edx
+    1659:	0f 34                	sysenter
+    165b:	c3                   	ret
+
+0000165c <lockstat>:
+SYSCALL(lockstat)
+    165c:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1661:	89 e1                	mov    %esp,%ecx
+    1663:	ba 6a 16 00 00       	mov    $0x166a,%edx
+    1668:	0f 34                	sysenter
+    166a:	c3                   	ret
+
+0000166b <bstat>:
+SYSCALL(bstat)
+    166b:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    1670:	89 e1                	mov    %esp,%ecx
+    1672:	ba 79 16 00 00       	mov    $0x1679,%edx
+    1677:	0f 34                	sysenter
+    1679:	c3                   	ret
+
+0000167a <iostat>:
+SYSCALL(iostat)
+    167a:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    167f:	89 e1                	mov    %esp,%ecx
+    1681:	ba 88 16 00 00       	mov    $0x1688,%edx
+    1686:	0f 34                	sysenter
+    1688:	c3                   	ret
+
+00001689 <fsync>:
+SYSCALL(fsync)
+    1689:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    168e:	89 e1                	mov    %esp,%ecx
+    1690:	ba 97 16 00 00       	mov    $0x1697,%edx
+    1695:	0f 34                	sysenter
+    1697:	c3                   	ret
+
+00001698 <pread>:
+SYSCALL(pread)
+    1698:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    169d:	89 e1                	mov    %esp,%ecx
+    169f:	ba a6 16 00 00       	mov    $0x16a6,%edx
+    16a4:	0f 34                	sysenter
+    16a6:	c3                   	ret
+
+000016a7 <pwrite>:
+SYSCALL(pwrite)
+    16a7:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    16ac:	89 e1                	mov    %esp,%ecx
+    16ae:	ba b5 16 00 00       	mov    $0x16b5,%edx
+    16b3:	0f 34                	sysenter
+    16b5:	c3                   	ret
+
+000016b6 <readv>:
+SYSCALL(readv)
+    16b6:	b8 30 00 00 00       	mov    $0x30,%eax
+    16bb:	89 e1                	mov    %esp,%ecx
+    16bd:	ba c4 16 00 00       	mov    $0x16c4,%edx
+    16c2:	0f 34                	sysenter
+    16c4:	c3                   	ret
+
+000016c5 <writev>:
+SYSCALL(writev)
+    16c5:	b8 31 00 00 00       	mov    $0x31,%eax
+    16ca:	89 e1                	mov    %esp,%ecx
+    16cc:	ba d3 16 00 00       	mov    $0x16d3,%edx
+    16d1:	0f 34                	sysenter
+    16d3:	c3                   	ret
+
+000016d4 <sendfile>:
+SYSCALL(sendfile)
+    16d4:	b8 32 00 00 00       	mov    $0x32,%eax
+    16d9:	89 e1                	mov    %esp,%ecx
+    16db:	ba e2 16 00 00       	mov    $0x16e2,%edx
+    16e0:	0f 34                	sysenter
+    16e2:	c3                   	ret
+
+000016e3 <fcntl>:
+SYSCALL(fcntl)
+    16e3:	b8 33 00 00 00       	mov    $0x33,%eax
+    16e8:	89 e1                	mov    %esp,%ecx
+    16ea:	ba f1 16 00 00       	mov    $0x16f1,%edx
+    16ef:	0f 34                	sysenter
+    16f1:	c3                   	ret
+
+000016f2 <mount>:
+SYSCALL(mount)
+    16f2:	b8 34 00 00 00       	mov    $0x34,%eax
+    16f7:	89 e1                	mov    %esp,%ecx
+    16f9:	ba 00 17 00 00       	mov    $0x1700,%edx
+    16fe:	0f 34                	sysenter
+    1700:	c3                   	ret
+
+00001701 <getdents>:
+SYSCALL(getdents)
+    1701:	b8 35 00 00 00       	mov    $0x35,%eax
+    1706:	89 e1                	mov    %esp,%ecx
+    1708:	ba 0f 17 00 00       	mov    $0x170f,%edx
+    170d:	0f 34                	sysenter
+    170f:	c3                   	ret
+
+00001710 <fstatat>:
+SYSCALL(fstatat)
+    1710:	b8 36 00 00 00       	mov    $0x36,%eax
+    1715:	89 e1                	mov    %esp,%ecx
+    1717:	ba 1e 17 00 00       	mov    $0x171e,%edx
+    171c:	0f 34                	sysenter
+    171e:	c3                   	ret
+
+0000171f <sysstat>:
+SYSCALL(sysstat)
+    171f:	b8 37 00 00 00       	mov    $0x37,%eax
+    1724:	89 e1                	mov    %esp,%ecx
+    1726:	ba 2d 17 00 00       	mov    $0x172d,%edx
+    172b:	0f 34                	sysenter
+    172d:	c3                   	ret
+
+0000172e <ringenter>:
+SYSCALL(ringenter)
+    172e:	b8 38 00 00 00       	mov    $0x38,%eax
+    1733:	89 e1                	mov    %esp,%ecx
+    1735:	ba 3c 17 00 00       	mov    $0x173c,%edx
+    173a:	0f 34                	sysenter
+    173c:	c3                   	ret
+
+0000173d <trace>:
+SYSCALL(trace)
+    173d:	b8 39 00 00 00       	mov    $0x39,%eax
+    1742:	89 e1                	mov    %esp,%ecx
+    1744:	ba 4b 17 00 00       	mov    $0x174b,%edx
+    1749:	0f 34                	sysenter
+    174b:	c3                   	ret
+
+0000174c <memstat>:
+SYSCALL(memstat)
+    174c:	b8 3a 00 00 00       	mov    $0x3a,%eax
+    1751:	89 e1                	mov    %esp,%ecx
+    1753:	ba 5a 17 00 00       	mov    $0x175a,%edx
+    1758:	0f 34                	sysenter
+    175a:	c3                   	ret
+
+0000175b <shmget>:
+SYSCALL(shmget)
+    175b:	b8 3b 00 00 00       	mov    $0x3b,%eax
+    1760:	89 e1                	mov    %esp,%ecx
+    1762:	ba 69 17 00 00       	mov    $0x1769,%edx
+    1767:	0f 34                	sysenter
+    1769:	c3                   	ret
+
+0000176a <shmat>:
+SYSCALL(shmat)
+    176a:	b8 3c 00 00 00       	mov    $0x3c,%eax
+    176f:	89 e1                	mov    %esp,%ecx
+    1771:	ba 78 17 00 00       	mov    $0x1778,%edx
+    1776:	0f 34                	sysenter
+    1778:	c3                   	ret
+
+00001779 <shmdt>:
+SYSCALL(shmdt)
+    1779:	b8 3d 00 00 00       	mov    $0x3d,%eax
+    177e:	89 e1                	mov    %esp,%ecx
+    1780:	ba 87 17 00 00       	mov    $0x1787,%edx
+    1785:	0f 34                	sysenter
+    1787:	c3                   	ret
+
+00001788 <irqstat>:
+SYSCALL(irqstat)
+    1788:	b8 3e 00 00 00       	mov    $0x3e,%eax
+    178d:	89 e1                	mov    %esp,%ecx
+    178f:	ba 96 17 00 00       	mov    $0x1796,%edx
+    1794:	0f 34                	sysenter
+    1796:	c3                   	ret
+
+00001797 <irqroute>:
+SYSCALL(irqroute)
+    1797:	b8 3f 00 00 00       	mov    $0x3f,%eax
+    179c:	89 e1                	mov    %esp,%ecx
+    179e:	ba a5 17 00 00       	mov    $0x17a5,%edx
+    17a3:	0f 34                	sysenter
+    17a5:	c3                   	ret
+
+000017a6 <putc>:
+  char buf[64];
+};
+
+static void
+putc(struct out *o, char c)
+{
+    17a6:	55                   	push   %ebp
+    17a7:	89 e5                	mov    %esp,%ebp
+    17a9:	56                   	push   %esi
+    17aa:	53                   	push   %ebx
+    17ab:	89 c3                	mov    %eax,%ebx
+    17ad:	89 d6                	mov    %edx,%esi
+  if(o->n == sizeof(o->buf)){
+    17af:	8b 40 04             	mov    0x4(%eax),%eax
+    17b2:	83 f8 40             	cmp    $0x40,%eax
+    17b5:	74 16                	je     17cd <putc+0x27>
+    bufwrite(o->fd, o->buf, o->n);
+    o->n = 0;
+  }
+  o->buf[o->n++] = c;
+    17b7:	8b 43 04             	mov    0x4(%ebx),%eax
+    17ba:	8d 50 01             	lea    0x1(%eax),%edx
+    17bd:	89 53 04             	mov    %edx,0x4(%ebx)
+    17c0:	89 f1                	mov    %esi,%ecx
+    17c2:	88 4c 03 08          	mov    %cl,0x8(%ebx,%eax,1)
+}
+    17c6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    17c9:	5b                   	pop    %ebx
+    17ca:	5e                   	pop    %esi
+    17cb:	5d                   	pop    %ebp
+    17cc:	c3                   	ret
+    bufwrite(o->fd, o->buf, o->n);
+    17cd:	8d 53 08             	lea    0x8(%ebx),%edx
+    17d0:	83 ec 04             	sub    $0x4,%esp
+    17d3:	50                   	push   %eax
+    17d4:	52                   	push   %edx
+    17d5:	ff 33                	push   (%ebx)
+    17d7:	e8 b2 f9 ff ff       	call   118e <bufwrite>
+    o->n = 0;
+    17dc:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    17e3:	83 c4 10             	add    $0x10,%esp
+    17e6:	eb cf                	jmp    17b7 <putc+0x11>
+
+000017e8 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+    17e8:	55                   	push   %ebp
+    17e9:	89 e5                	mov    %esp,%ebp
+    17eb:	57                   	push   %edi
+    17ec:	56                   	push   %esi
+    17ed:	53                   	push   %ebx
+    17ee:	83 ec 2c             	sub    $0x2c,%esp
+    17f1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    17f4:	89 d0                	mov    %edx,%eax
+    17f6:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    17f8:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    17fc:	0f 95 c1             	setne  %cl
+    17ff:	c1 ea 1f             	shr    $0x1f,%edx
+    1802:	84 d1                	test   %dl,%cl
+    1804:	74 44                	je     184a <printint+0x62>
+    neg = 1;
+    x = -xx;
+    1806:	f7 d8                	neg    %eax
+    1808:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+    180a:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    1811:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+    1816:	89 c8                	mov    %ecx,%eax
+    1818:	ba 00 00 00 00       	mov    $0x0,%edx
+    181d:	f7 f6                	div    %esi
+    181f:	89 df                	mov    %ebx,%edi
+    1821:	83 c3 01             	add    $0x1,%ebx
+    1824:	0f b6 92 f4 1f 00 00 	movzbl 0x1ff4(%edx),%edx
+    182b:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+    182f:	89 ca                	mov    %ecx,%edx
+    1831:	89 c1                	mov    %eax,%ecx
+    1833:	39 f2                	cmp    %esi,%edx
+    1835:	73 df                	jae    1816 <printint+0x2e>
+  if(neg)
+    1837:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+    183b:	74 31                	je     186e <printint+0x86>
+    buf[i++] = '-';
+    183d:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+    1842:	8d 5f 02             	lea    0x2(%edi),%ebx
+    1845:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    1848:	eb 17                	jmp    1861 <printint+0x79>
+    x = xx;
+    184a:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+    184c:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+    1853:	eb bc                	jmp    1811 <printint+0x29>
+
+  while(--i >= 0)
+    putc(o, buf[i]);
+    1855:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+    185a:	89 f0                	mov    %esi,%eax
+    185c:	e8 45 ff ff ff       	call   17a6 <putc>
+  while(--i >= 0)
+    1861:	83 eb 01             	sub    $0x1,%ebx
+    1864:	79 ef                	jns    1855 <printint+0x6d>
+}
+    1866:	83 c4 2c             	add    $0x2c,%esp
+    1869:	5b                   	pop    %ebx
+    186a:	5e                   	pop    %esi
+    186b:	5f                   	pop    %edi
+    186c:	5d                   	pop    %ebp
+    186d:	c3                   	ret
+    186e:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    1871:	eb ee                	jmp    1861 <printint+0x79>
+
+00001873 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1873:	55                   	push   %ebp
+    1874:	89 e5                	mov    %esp,%ebp
+    1876:	57                   	push   %edi
+    1877:	56                   	push   %esi
+    1878:	53                   	push   %ebx
+    1879:	83 ec 6c             	sub    $0x6c,%esp
+  int c, i, state;
+  uint *ap;
+  struct out out, *o;
+
+  o = &out;
+  o->fd = fd;
+    187c:	8b 45 08             	mov    0x8(%ebp),%eax
+    187f:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  o->n = 0;
+    1882:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+    1889:	8d 45 10             	lea    0x10(%ebp),%eax
+    188c:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  state = 0;
+    188f:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+    1894:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1899:	eb 14                	jmp    18af <printf+0x3c>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(o, c);
+    189b:	89 fa                	mov    %edi,%edx
+    189d:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    18a0:	e8 01 ff ff ff       	call   17a6 <putc>
+    18a5:	eb 05                	jmp    18ac <printf+0x39>
+      }
+    } else if(state == '%'){
+    18a7:	83 fe 25             	cmp    $0x25,%esi
+    18aa:	74 25                	je     18d1 <printf+0x5e>
+  for(i = 0; fmt[i]; i++){
+    18ac:	83 c3 01             	add    $0x1,%ebx
+    18af:	8b 45 0c             	mov    0xc(%ebp),%eax
+    18b2:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+    18b6:	84 c0                	test   %al,%al
+    18b8:	0f 84 20 01 00 00    	je     19de <printf+0x16b>
+    c = fmt[i] & 0xff;
+    18be:	0f be f8             	movsbl %al,%edi
+    18c1:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    18c4:	85 f6                	test   %esi,%esi
+    18c6:	75 df                	jne    18a7 <printf+0x34>
+      if(c == '%'){
+    18c8:	83 f8 25             	cmp    $0x25,%eax
+    18cb:	75 ce                	jne    189b <printf+0x28>
+        state = '%';
+    18cd:	89 c6                	mov    %eax,%esi
+    18cf:	eb db                	jmp    18ac <printf+0x39>
+      if(c == 'd'){
+    18d1:	83 f8 25             	cmp    $0x25,%eax
+    18d4:	0f 84 cf 00 00 00    	je     19a9 <printf+0x136>
+    18da:	0f 8c dd 00 00 00    	jl     19bd <printf+0x14a>
+    18e0:	83 f8 78             	cmp    $0x78,%eax
+    18e3:	0f 8f d4 00 00 00    	jg     19bd <printf+0x14a>
+    18e9:	83 f8 63             	cmp    $0x63,%eax
+    18ec:	0f 8c cb 00 00 00    	jl     19bd <printf+0x14a>
+    18f2:	83 e8 63             	sub    $0x63,%eax
+    18f5:	83 f8 15             	cmp    $0x15,%eax
+    18f8:	0f 87 bf 00 00 00    	ja     19bd <printf+0x14a>
+    18fe:	ff 24 85 9c 1f 00 00 	jmp    *0x1f9c(,%eax,4)
+        printint(o, *ap, 10, 1);
+    1905:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+    1908:	8b 17                	mov    (%edi),%edx
+    190a:	83 ec 0c             	sub    $0xc,%esp
+    190d:	6a 01                	push   $0x1
+    190f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    1914:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    1917:	e8 cc fe ff ff       	call   17e8 <printint>
+        ap++;
+    191c:	83 c7 04             	add    $0x4,%edi
+    191f:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+    1922:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(o, '%');
+        putc(o, c);
+      }
+      state = 0;
+    1925:	be 00 00 00 00       	mov    $0x0,%esi
+    192a:	eb 80                	jmp    18ac <printf+0x39>
+        printint(o, *ap, 16, 0);
+    192c:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+    192f:	8b 17                	mov    (%edi),%edx
+    1931:	83 ec 0c             	sub    $0xc,%esp
+    1934:	6a 00                	push   $0x0
+    1936:	b9 10 00 00 00       	mov    $0x10,%ecx
+    193b:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    193e:	e8 a5 fe ff ff       	call   17e8 <printint>
+        ap++;
+    1943:	83 c7 04             	add    $0x4,%edi
+    1946:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+    1949:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    194c:	be 00 00 00 00       	mov    $0x0,%esi
+    1951:	e9 56 ff ff ff       	jmp    18ac <printf+0x39>
+        s = (char*)*ap;
+    1956:	8b 45 94             	mov    -0x6c(%ebp),%eax
+    1959:	8b 30                	mov    (%eax),%esi
+        ap++;
+    195b:	83 c0 04             	add    $0x4,%eax
+    195e:	89 45 94             	mov    %eax,-0x6c(%ebp)
+        if(s == 0)
+    1961:	85 f6                	test   %esi,%esi
+    1963:	75 15                	jne    197a <printf+0x107>
+          s = "(null)";
+    1965:	be 94 1f 00 00       	mov    $0x1f94,%esi
+    196a:	eb 0e                	jmp    197a <printf+0x107>
+          putc(o, *s);
+    196c:	0f be d2             	movsbl %dl,%edx
+    196f:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    1972:	e8 2f fe ff ff       	call   17a6 <putc>
+          s++;
+    1977:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+    197a:	0f b6 16             	movzbl (%esi),%edx
+    197d:	84 d2                	test   %dl,%dl
+    197f:	75 eb                	jne    196c <printf+0xf9>
+      state = 0;
+    1981:	be 00 00 00 00       	mov    $0x0,%esi
+    1986:	e9 21 ff ff ff       	jmp    18ac <printf+0x39>
+        putc(o, *ap);
+    198b:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+    198e:	0f be 17             	movsbl (%edi),%edx
+    1991:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    1994:	e8 0d fe ff ff       	call   17a6 <putc>
+        ap++;
+    1999:	83 c7 04             	add    $0x4,%edi
+    199c:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+      state = 0;
+    199f:	be 00 00 00 00       	mov    $0x0,%esi
+    19a4:	e9 03 ff ff ff       	jmp    18ac <printf+0x39>
+        putc(o, c);
+    19a9:	89 fa                	mov    %edi,%edx
+    19ab:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    19ae:	e8 f3 fd ff ff       	call   17a6 <putc>
+      state = 0;
+    19b3:	be 00 00 00 00       	mov    $0x0,%esi
+    19b8:	e9 ef fe ff ff       	jmp    18ac <printf+0x39>
+        putc(o, '%');
+    19bd:	ba 25 00 00 00       	mov    $0x25,%edx
+    19c2:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    19c5:	e8 dc fd ff ff       	call   17a6 <putc>
+        putc(o, c);
+    19ca:	89 fa                	mov    %edi,%edx
+    19cc:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    19cf:	e8 d2 fd ff ff       	call   17a6 <putc>
+      state = 0;
+    19d4:	be 00 00 00 00       	mov    $0x0,%esi
+    19d9:	e9 ce fe ff ff       	jmp    18ac <printf+0x39>
+    }
+  }
+  if(o->n > 0)
+    19de:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    19e1:	85 c0                	test   %eax,%eax
+    19e3:	7f 08                	jg     19ed <printf+0x17a>
+    bufwrite(fd, o->buf, o->n);
+}
+    19e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    19e8:	5b                   	pop    %ebx
+    19e9:	5e                   	pop    %esi
+    19ea:	5f                   	pop    %edi
+    19eb:	5d                   	pop    %ebp
+    19ec:	c3                   	ret
+    bufwrite(fd, o->buf, o->n);
+    19ed:	83 ec 04             	sub    $0x4,%esp
+    19f0:	50                   	push   %eax
+    19f1:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    19f4:	50                   	push   %eax
+    19f5:	ff 75 08             	push   0x8(%ebp)
+    19f8:	e8 91 f7 ff ff       	call   118e <bufwrite>
+    19fd:	83 c4 10             	add    $0x10,%esp
+}
+    1a00:	eb e3                	jmp    19e5 <printf+0x172>
+
+00001a02 <largefree>:
+  return &b->h;
+}
+
+static void
+largefree(Fblock *b)
+{
+    1a02:	55                   	push   %ebp
+    1a03:	89 e5                	mov    %esp,%ebp
+    1a05:	57                   	push   %edi
+    1a06:	56                   	push   %esi
+    1a07:	53                   	push   %ebx
+    1a08:	83 ec 0c             	sub    $0xc,%esp
+    1a0b:	89 c1                	mov    %eax,%ecx
+  Fblock **pp, *p, *prev;
+
+  prev = 0;
+    1a0d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+    1a12:	ba 6c 4b 00 00       	mov    $0x4b6c,%edx
+    1a17:	eb 05                	jmp    1a1e <largefree+0x1c>
+    1a19:	8d 50 08             	lea    0x8(%eax),%edx
+    prev = p;
+    1a1c:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+    1a1e:	8b 02                	mov    (%edx),%eax
+    1a20:	85 c0                	test   %eax,%eax
+    1a22:	74 04                	je     1a28 <largefree+0x26>
+    1a24:	39 c8                	cmp    %ecx,%eax
+    1a26:	72 f1                	jb     1a19 <largefree+0x17>
+  b->next = p;
+    1a28:	89 41 08             	mov    %eax,0x8(%ecx)
+  if(p && (char*)b + b->h.size == (char*)p){
+    1a2b:	85 c0                	test   %eax,%eax
+    1a2d:	74 09                	je     1a38 <largefree+0x36>
+    1a2f:	8b 31                	mov    (%ecx),%esi
+    1a31:	8d 3c 31             	lea    (%ecx,%esi,1),%edi
+    1a34:	39 c7                	cmp    %eax,%edi
+    1a36:	74 21                	je     1a59 <largefree+0x57>
+    b->h.size += p->h.size;
+    b->next = p->next;
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+    1a38:	85 db                	test   %ebx,%ebx
+    1a3a:	74 09                	je     1a45 <largefree+0x43>
+    1a3c:	8b 03                	mov    (%ebx),%eax
+    1a3e:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+    1a41:	39 ce                	cmp    %ecx,%esi
+    1a43:	74 20                	je     1a65 <largefree+0x63>
+    prev->h.size += b->h.size;
+    prev->next = b->next;
+  } else
+    *pp = b;
+    1a45:	89 0a                	mov    %ecx,(%edx)
+
+  // Give the top of the heap back.  With threads sharing the
+  // address space sbrk() cannot shrink it; keep the block then.
+  for(pp = &large; (*pp)->next; pp = &(*pp)->next)
+    1a47:	be 6c 4b 00 00       	mov    $0x4b6c,%esi
+    1a4c:	8b 1e                	mov    (%esi),%ebx
+    1a4e:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+    1a52:	74 1d                	je     1a71 <largefree+0x6f>
+    1a54:	8d 73 08             	lea    0x8(%ebx),%esi
+    1a57:	eb f3                	jmp    1a4c <largefree+0x4a>
+    b->h.size += p->h.size;
+    1a59:	03 30                	add    (%eax),%esi
+    1a5b:	89 31                	mov    %esi,(%ecx)
+    b->next = p->next;
+    1a5d:	8b 40 08             	mov    0x8(%eax),%eax
+    1a60:	89 41 08             	mov    %eax,0x8(%ecx)
+    1a63:	eb d3                	jmp    1a38 <largefree+0x36>
+    prev->h.size += b->h.size;
+    1a65:	03 01                	add    (%ecx),%eax
+    1a67:	89 03                	mov    %eax,(%ebx)
+    prev->next = b->next;
+    1a69:	8b 41 08             	mov    0x8(%ecx),%eax
+    1a6c:	89 43 08             	mov    %eax,0x8(%ebx)
+    1a6f:	eb d6                	jmp    1a47 <largefree+0x45>
+    ;
+  b = *pp;
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+    1a71:	89 df                	mov    %ebx,%edi
+    1a73:	03 3b                	add    (%ebx),%edi
+    1a75:	83 ec 0c             	sub    $0xc,%esp
+    1a78:	6a 00                	push   $0x0
+    1a7a:	e8 93 fa ff ff       	call   1512 <sbrk>
+    1a7f:	83 c4 10             	add    $0x10,%esp
+    1a82:	39 c7                	cmp    %eax,%edi
+    1a84:	74 08                	je     1a8e <largefree+0x8c>
+    *pp = 0;
+}
+    1a86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1a89:	5b                   	pop    %ebx
+    1a8a:	5e                   	pop    %esi
+    1a8b:	5f                   	pop    %edi
+    1a8c:	5d                   	pop    %ebp
+    1a8d:	c3                   	ret
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+    1a8e:	8b 03                	mov    (%ebx),%eax
+    1a90:	f7 d8                	neg    %eax
+    1a92:	83 ec 0c             	sub    $0xc,%esp
+    1a95:	50                   	push   %eax
+    1a96:	e8 77 fa ff ff       	call   1512 <sbrk>
+    1a9b:	83 c4 10             	add    $0x10,%esp
+    1a9e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1aa1:	74 e3                	je     1a86 <largefree+0x84>
+    *pp = 0;
+    1aa3:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+    1aa9:	eb db                	jmp    1a86 <largefree+0x84>
+
+00001aab <more>:
+{
+    1aab:	55                   	push   %ebp
+    1aac:	89 e5                	mov    %esp,%ebp
+    1aae:	56                   	push   %esi
+    1aaf:	53                   	push   %ebx
+    1ab0:	89 c6                	mov    %eax,%esi
+  pad = -(uint)sbrk(0) & 7;
+    1ab2:	83 ec 0c             	sub    $0xc,%esp
+    1ab5:	6a 00                	push   $0x0
+    1ab7:	e8 56 fa ff ff       	call   1512 <sbrk>
+    1abc:	f7 d8                	neg    %eax
+    1abe:	89 c3                	mov    %eax,%ebx
+    1ac0:	83 e3 07             	and    $0x7,%ebx
+  if((p = sbrk(n + pad)) == (char*)-1)
+    1ac3:	01 de                	add    %ebx,%esi
+    1ac5:	89 34 24             	mov    %esi,(%esp)
+    1ac8:	e8 45 fa ff ff       	call   1512 <sbrk>
+    1acd:	83 c4 10             	add    $0x10,%esp
+    1ad0:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1ad3:	74 09                	je     1ade <more+0x33>
+  return p + pad;
+    1ad5:	01 d8                	add    %ebx,%eax
+}
+    1ad7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1ada:	5b                   	pop    %ebx
+    1adb:	5e                   	pop    %esi
+    1adc:	5d                   	pop    %ebp
+    1add:	c3                   	ret
+    return 0;
+    1ade:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ae3:	eb f2                	jmp    1ad7 <more+0x2c>
+
+00001ae5 <slaballoc>:
+{
+    1ae5:	55                   	push   %ebp
+    1ae6:	89 e5                	mov    %esp,%ebp
+    1ae8:	56                   	push   %esi
+    1ae9:	53                   	push   %ebx
+    1aea:	89 c6                	mov    %eax,%esi
+  n = 1 << (MINSHIFT + c);
+    1aec:	8d 48 04             	lea    0x4(%eax),%ecx
+    1aef:	bb 01 00 00 00       	mov    $0x1,%ebx
+    1af4:	d3 e3                	shl    %cl,%ebx
+  if(slab + n > slabend){
+    1af6:	89 d8                	mov    %ebx,%eax
+    1af8:	03 05 68 4b 00 00    	add    0x4b68,%eax
+    1afe:	39 05 64 4b 00 00    	cmp    %eax,0x4b64
+    1b04:	72 17                	jb     1b1d <slaballoc+0x38>
+  h = (Header*)slab;
+    1b06:	a1 68 4b 00 00       	mov    0x4b68,%eax
+  slab += n;
+    1b0b:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+    1b0e:	89 15 68 4b 00 00    	mov    %edx,0x4b68
+  h->size = n;
+    1b14:	89 18                	mov    %ebx,(%eax)
+  h->class = c;
+    1b16:	89 70 04             	mov    %esi,0x4(%eax)
+}
+    1b19:	5b                   	pop    %ebx
+    1b1a:	5e                   	pop    %esi
+    1b1b:	5d                   	pop    %ebp
+    1b1c:	c3                   	ret
+    if((p = more(SLABSZ)) == 0)
+    1b1d:	b8 00 40 00 00       	mov    $0x4000,%eax
+    1b22:	e8 84 ff ff ff       	call   1aab <more>
+    1b27:	85 c0                	test   %eax,%eax
+    1b29:	74 ee                	je     1b19 <slaballoc+0x34>
+    if(p != slabend)
+    1b2b:	39 05 64 4b 00 00    	cmp    %eax,0x4b64
+    1b31:	74 05                	je     1b38 <slaballoc+0x53>
+      slab = p;
+    1b33:	a3 68 4b 00 00       	mov    %eax,0x4b68
+    slabend = p + SLABSZ;
+    1b38:	05 00 40 00 00       	add    $0x4000,%eax
+    1b3d:	a3 64 4b 00 00       	mov    %eax,0x4b64
+    1b42:	eb c2                	jmp    1b06 <slaballoc+0x21>
+
+00001b44 <largealloc>:
+{
+    1b44:	55                   	push   %ebp
+    1b45:	89 e5                	mov    %esp,%ebp
+    1b47:	56                   	push   %esi
+    1b48:	53                   	push   %ebx
+    1b49:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+    1b4b:	b9 6c 4b 00 00       	mov    $0x4b6c,%ecx
+    1b50:	8b 01                	mov    (%ecx),%eax
+    1b52:	85 c0                	test   %eax,%eax
+    1b54:	74 36                	je     1b8c <largealloc+0x48>
+    if(b->h.size < n)
+    1b56:	8b 10                	mov    (%eax),%edx
+    1b58:	39 da                	cmp    %ebx,%edx
+    1b5a:	72 24                	jb     1b80 <largealloc+0x3c>
+    if(b->h.size - n > SMALLMAX){
+    1b5c:	29 da                	sub    %ebx,%edx
+    1b5e:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+    1b64:	76 1f                	jbe    1b85 <largealloc+0x41>
+      rest = (Fblock*)((char*)b + n);
+    1b66:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+      rest->h.size = b->h.size - n;
+    1b69:	89 16                	mov    %edx,(%esi)
+      rest->h.class = LARGE;
+    1b6b:	c7 46 04 09 00 00 00 	movl   $0x9,0x4(%esi)
+      rest->next = b->next;
+    1b72:	8b 50 08             	mov    0x8(%eax),%edx
+    1b75:	89 56 08             	mov    %edx,0x8(%esi)
+      *pp = rest;
+    1b78:	89 31                	mov    %esi,(%ecx)
+      b->h.size = n;
+    1b7a:	89 18                	mov    %ebx,(%eax)
+}
+    1b7c:	5b                   	pop    %ebx
+    1b7d:	5e                   	pop    %esi
+    1b7e:	5d                   	pop    %ebp
+    1b7f:	c3                   	ret
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+    1b80:	8d 48 08             	lea    0x8(%eax),%ecx
+    1b83:	eb cb                	jmp    1b50 <largealloc+0xc>
+      *pp = b->next;
+    1b85:	8b 50 08             	mov    0x8(%eax),%edx
+    1b88:	89 11                	mov    %edx,(%ecx)
+    return &b->h;
+    1b8a:	eb f0                	jmp    1b7c <largealloc+0x38>
+  if((b = more(n)) == 0)
+    1b8c:	89 d8                	mov    %ebx,%eax
+    1b8e:	e8 18 ff ff ff       	call   1aab <more>
+    1b93:	85 c0                	test   %eax,%eax
+    1b95:	74 e5                	je     1b7c <largealloc+0x38>
+  b->h.size = n;
+    1b97:	89 18                	mov    %ebx,(%eax)
+  b->h.class = LARGE;
+    1b99:	c7 40 04 09 00 00 00 	movl   $0x9,0x4(%eax)
+  return &b->h;
+    1ba0:	eb da                	jmp    1b7c <largealloc+0x38>
+
+00001ba2 <free>:
+
+void
+free(void *ap)
+{
+    1ba2:	55                   	push   %ebp
+    1ba3:	89 e5                	mov    %esp,%ebp
+    1ba5:	56                   	push   %esi
+    1ba6:	53                   	push   %ebx
+    1ba7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+
+  if(ap == 0)
+    1baa:	85 db                	test   %ebx,%ebx
+    1bac:	74 3b                	je     1be9 <free+0x47>
+    return;
+  h = (Header*)ap - 1;
+    1bae:	8d 73 f8             	lea    -0x8(%ebx),%esi
+  lock_acquire(&lock);
+    1bb1:	83 ec 0c             	sub    $0xc,%esp
+    1bb4:	68 60 4b 00 00       	push   $0x4b60
+    1bb9:	e8 9c 01 00 00       	call   1d5a <lock_acquire>
+  if(h->class == LARGE)
+    1bbe:	8b 43 fc             	mov    -0x4(%ebx),%eax
+    1bc1:	83 c4 10             	add    $0x10,%esp
+    1bc4:	83 f8 09             	cmp    $0x9,%eax
+    1bc7:	74 27                	je     1bf0 <free+0x4e>
+    largefree((Fblock*)h);
+  else {
+    ((Fblock*)h)->next = freelist[h->class];
+    1bc9:	8b 14 85 80 4b 00 00 	mov    0x4b80(,%eax,4),%edx
+    1bd0:	89 13                	mov    %edx,(%ebx)
+    freelist[h->class] = (Fblock*)h;
+    1bd2:	89 34 85 80 4b 00 00 	mov    %esi,0x4b80(,%eax,4)
+  }
+  lock_release(&lock);
+    1bd9:	83 ec 0c             	sub    $0xc,%esp
+    1bdc:	68 60 4b 00 00       	push   $0x4b60
+    1be1:	e8 88 01 00 00       	call   1d6e <lock_release>
+    1be6:	83 c4 10             	add    $0x10,%esp
+}
+    1be9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1bec:	5b                   	pop    %ebx
+    1bed:	5e                   	pop    %esi
+    1bee:	5d                   	pop    %ebp
+    1bef:	c3                   	ret
+    largefree((Fblock*)h);
+    1bf0:	89 f0                	mov    %esi,%eax
+    1bf2:	e8 0b fe ff ff       	call   1a02 <largefree>
+    1bf7:	eb e0                	jmp    1bd9 <free+0x37>
+
+00001bf9 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1bf9:	55                   	push   %ebp
+    1bfa:	89 e5                	mov    %esp,%ebp
+    1bfc:	53                   	push   %ebx
+    1bfd:	83 ec 04             	sub    $0x4,%esp
+    1c00:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+  uint n;
+  int c;
+
+  if(nbytes > 0x7fffffff - sizeof(Header) - 7)
+    1c03:	81 fb f0 ff ff 7f    	cmp    $0x7ffffff0,%ebx
+    1c09:	0f 87 8b 00 00 00    	ja     1c9a <malloc+0xa1>
+    return 0;
+  n = (nbytes + sizeof(Header) + 7) & ~7;
+    1c0f:	83 c3 0f             	add    $0xf,%ebx
+    1c12:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(n < sizeof(Fblock))
+    1c15:	83 fb 0b             	cmp    $0xb,%ebx
+    1c18:	77 05                	ja     1c1f <malloc+0x26>
+    n = sizeof(Fblock);
+    1c1a:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  lock_acquire(&lock);
+    1c1f:	83 ec 0c             	sub    $0xc,%esp
+    1c22:	68 60 4b 00 00       	push   $0x4b60
+    1c27:	e8 2e 01 00 00       	call   1d5a <lock_acquire>
+  if(n <= SMALLMAX){
+    1c2c:	83 c4 10             	add    $0x10,%esp
+    1c2f:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+    1c35:	77 58                	ja     1c8f <malloc+0x96>
+    for(c = 0; (1 << (MINSHIFT + c)) < n; c++)
+    1c37:	ba 00 00 00 00       	mov    $0x0,%edx
+    1c3c:	eb 03                	jmp    1c41 <malloc+0x48>
+    1c3e:	83 c2 01             	add    $0x1,%edx
+    1c41:	8d 4a 04             	lea    0x4(%edx),%ecx
+    1c44:	b8 01 00 00 00       	mov    $0x1,%eax
+    1c49:	d3 e0                	shl    %cl,%eax
+    1c4b:	39 d8                	cmp    %ebx,%eax
+    1c4d:	72 ef                	jb     1c3e <malloc+0x45>
+      ;
+    if(freelist[c]){
+    1c4f:	8b 04 95 80 4b 00 00 	mov    0x4b80(,%edx,4),%eax
+    1c56:	85 c0                	test   %eax,%eax
+    1c58:	74 2a                	je     1c84 <malloc+0x8b>
+      h = &freelist[c]->h;
+    1c5a:	89 c3                	mov    %eax,%ebx
+      freelist[c] = freelist[c]->next;
+    1c5c:	8b 40 08             	mov    0x8(%eax),%eax
+    1c5f:	89 04 95 80 4b 00 00 	mov    %eax,0x4b80(,%edx,4)
+    } else
+      h = slaballoc(c);
+  } else
+    h = largealloc(n);
+  lock_release(&lock);
+    1c66:	83 ec 0c             	sub    $0xc,%esp
+    1c69:	68 60 4b 00 00       	push   $0x4b60
+    1c6e:	e8 fb 00 00 00       	call   1d6e <lock_release>
+  return h ? (void*)(h + 1) : 0;
+    1c73:	83 c4 10             	add    $0x10,%esp
+    1c76:	85 db                	test   %ebx,%ebx
+    1c78:	74 03                	je     1c7d <malloc+0x84>
+    1c7a:	83 c3 08             	add    $0x8,%ebx
+}
+    1c7d:	89 d8                	mov    %ebx,%eax
+    1c7f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1c82:	c9                   	leave
+    1c83:	c3                   	ret
+      h = slaballoc(c);
+    1c84:	89 d0                	mov    %edx,%eax
+    1c86:	e8 5a fe ff ff       	call   1ae5 <slaballoc>
+    1c8b:	89 c3                	mov    %eax,%ebx
+    1c8d:	eb d7                	jmp    1c66 <malloc+0x6d>
+    h = largealloc(n);
+    1c8f:	89 d8                	mov    %ebx,%eax
+    1c91:	e8 ae fe ff ff       	call   1b44 <largealloc>
+    1c96:	89 c3                	mov    %eax,%ebx
+    1c98:	eb cc                	jmp    1c66 <malloc+0x6d>
+    return 0;
+    1c9a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1c9f:	eb dc                	jmp    1c7d <malloc+0x84>
+
+00001ca1 <tstart>:
+  void *arg;
+};
+
+static void
+tstart(void *a)
+{
+    1ca1:	55                   	push   %ebp
+    1ca2:	89 e5                	mov    %esp,%ebp
+    1ca4:	83 ec 14             	sub    $0x14,%esp
+    1ca7:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+    1caa:	ff 70 04             	push   0x4(%eax)
+    1cad:	ff 10                	call   *(%eax)
+  exit();
+    1caf:	e8 86 f6 ff ff       	call   133a <exit>
+
+00001cb4 <thread_create>:
+}
+
+// Run fn(arg) in a new thread.  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1cb4:	55                   	push   %ebp
+    1cb5:	89 e5                	mov    %esp,%ebp
+    1cb7:	56                   	push   %esi
+    1cb8:	53                   	push   %ebx
+  struct tstart *t;
+  char *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    1cb9:	83 ec 0c             	sub    $0xc,%esp
+    1cbc:	68 00 10 00 00       	push   $0x1000
+    1cc1:	e8 33 ff ff ff       	call   1bf9 <malloc>
+    1cc6:	83 c4 10             	add    $0x10,%esp
+    1cc9:	85 c0                	test   %eax,%eax
+    1ccb:	74 42                	je     1d0f <thread_create+0x5b>
+    1ccd:	89 c3                	mov    %eax,%ebx
+    return -1;
+  t = (struct tstart*)stack;
+  t->fn = fn;
+    1ccf:	8b 45 08             	mov    0x8(%ebp),%eax
+    1cd2:	89 03                	mov    %eax,(%ebx)
+  t->arg = arg;
+    1cd4:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1cd7:	89 43 04             	mov    %eax,0x4(%ebx)
+  if((pid = clone(tstart, stack + TSTACK, t)) < 0)
+    1cda:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    1ce0:	83 ec 04             	sub    $0x4,%esp
+    1ce3:	53                   	push   %ebx
+    1ce4:	50                   	push   %eax
+    1ce5:	68 a1 1c 00 00       	push   $0x1ca1
+    1cea:	e8 f5 f8 ff ff       	call   15e4 <clone>
+    1cef:	89 c6                	mov    %eax,%esi
+    1cf1:	83 c4 10             	add    $0x10,%esp
+    1cf4:	85 c0                	test   %eax,%eax
+    1cf6:	78 09                	js     1d01 <thread_create+0x4d>
+    free(stack);
+  return pid;
+}
+    1cf8:	89 f0                	mov    %esi,%eax
+    1cfa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1cfd:	5b                   	pop    %ebx
+    1cfe:	5e                   	pop    %esi
+    1cff:	5d                   	pop    %ebp
+    1d00:	c3                   	ret
+    free(stack);
+    1d01:	83 ec 0c             	sub    $0xc,%esp
+    1d04:	53                   	push   %ebx
+    1d05:	e8 98 fe ff ff       	call   1ba2 <free>
+    1d0a:	83 c4 10             	add    $0x10,%esp
+    1d0d:	eb e9                	jmp    1cf8 <thread_create+0x44>
+    return -1;
+    1d0f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1d14:	eb e2                	jmp    1cf8 <thread_create+0x44>
+
+00001d16 <thread_join>:
+
+// Wait for one of this process's threads to exit and free its
+// stack.  Returns its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+    1d16:	55                   	push   %ebp
+    1d17:	89 e5                	mov    %esp,%ebp
+    1d19:	53                   	push   %ebx
+    1d1a:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    1d1d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1d20:	50                   	push   %eax
+    1d21:	e8 cd f8 ff ff       	call   15f3 <join>
+    1d26:	89 c3                	mov    %eax,%ebx
+    1d28:	83 c4 10             	add    $0x10,%esp
+    1d2b:	85 c0                	test   %eax,%eax
+    1d2d:	79 07                	jns    1d36 <thread_join+0x20>
+    free((char*)stack - TSTACK);
+  return pid;
+}
+    1d2f:	89 d8                	mov    %ebx,%eax
+    1d31:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1d34:	c9                   	leave
+    1d35:	c3                   	ret
+    free((char*)stack - TSTACK);
+    1d36:	83 ec 0c             	sub    $0xc,%esp
+    1d39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1d3c:	2d 00 10 00 00       	sub    $0x1000,%eax
+    1d41:	50                   	push   %eax
+    1d42:	e8 5b fe ff ff       	call   1ba2 <free>
+    1d47:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    1d4a:	eb e3                	jmp    1d2f <thread_join+0x19>
+
+00001d4c <lock_init>:
+
+void
+lock_init(lock_t *lk)
+{
+    1d4c:	55                   	push   %ebp
+    1d4d:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    1d4f:	8b 45 08             	mov    0x8(%ebp),%eax
+    1d52:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1d58:	5d                   	pop    %ebp
+    1d59:	c3                   	ret
+
+00001d5a <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+    1d5a:	55                   	push   %ebp
+    1d5b:	89 e5                	mov    %esp,%ebp
+    1d5d:	8b 55 08             	mov    0x8(%ebp),%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    1d60:	b8 01 00 00 00       	mov    $0x1,%eax
+    1d65:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    1d68:	85 c0                	test   %eax,%eax
+    1d6a:	75 f4                	jne    1d60 <lock_acquire+0x6>
+    ;
+}
+    1d6c:	5d                   	pop    %ebp
+    1d6d:	c3                   	ret
+
+00001d6e <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+    1d6e:	55                   	push   %ebp
+    1d6f:	89 e5                	mov    %esp,%ebp
+    1d71:	8b 55 08             	mov    0x8(%ebp),%edx
+    1d74:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d79:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    1d7c:	5d                   	pop    %ebp
+    1d7d:	c3                   	ret
+
+00001d7e <mutex_init>:
+// Are Tricky": state is 0 when free, 1 when held, 2 when held and
+// others may be waiting.  Unlocking an uncontended mutex costs no
+// system call.
+void
+mutex_init(mutex_t *m)
+{
+    1d7e:	55                   	push   %ebp
+    1d7f:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    1d81:	8b 45 08             	mov    0x8(%ebp),%eax
+    1d84:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1d8a:	5d                   	pop    %ebp
+    1d8b:	c3                   	ret
+
+00001d8c <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+    1d8c:	55                   	push   %ebp
+    1d8d:	89 e5                	mov    %esp,%ebp
+    1d8f:	53                   	push   %ebx
+    1d90:	83 ec 04             	sub    $0x4,%esp
+    1d93:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    1d96:	b8 00 00 00 00       	mov    $0x0,%eax
+    1d9b:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1da0:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    1da4:	85 c0                	test   %eax,%eax
+    1da6:	74 29                	je     1dd1 <mutex_lock+0x45>
+    return;
+  if(c != 2)
+    1da8:	83 f8 02             	cmp    $0x2,%eax
+    1dab:	74 20                	je     1dcd <mutex_lock+0x41>
+    1dad:	b8 02 00 00 00       	mov    $0x2,%eax
+    1db2:	f0 87 03             	lock xchg %eax,(%ebx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    1db5:	eb 16                	jmp    1dcd <mutex_lock+0x41>
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    1db7:	83 ec 08             	sub    $0x8,%esp
+    1dba:	6a 02                	push   $0x2
+    1dbc:	53                   	push   %ebx
+    1dbd:	e8 40 f8 ff ff       	call   1602 <futex_wait>
+  asm volatile("lock; xchgl %0, %1" :
+    1dc2:	b8 02 00 00 00       	mov    $0x2,%eax
+    1dc7:	f0 87 03             	lock xchg %eax,(%ebx)
+    1dca:	83 c4 10             	add    $0x10,%esp
+  while(c != 0){
+    1dcd:	85 c0                	test   %eax,%eax
+    1dcf:	75 e6                	jne    1db7 <mutex_lock+0x2b>
+    c = xchg(&m->state, 2);
+  }
+}
+    1dd1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1dd4:	c9                   	leave
+    1dd5:	c3                   	ret
+
+00001dd6 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+    1dd6:	55                   	push   %ebp
+    1dd7:	89 e5                	mov    %esp,%ebp
+    1dd9:	83 ec 08             	sub    $0x8,%esp
+    1ddc:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    1ddf:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    1de4:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    1de8:	83 fa 01             	cmp    $0x1,%edx
+    1deb:	75 02                	jne    1def <mutex_unlock+0x19>
+    m->state = 0;
+    futex_wake(&m->state, 1);
+  }
+}
+    1ded:	c9                   	leave
+    1dee:	c3                   	ret
+    m->state = 0;
+    1def:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+    1df5:	83 ec 08             	sub    $0x8,%esp
+    1df8:	6a 01                	push   $0x1
+    1dfa:	50                   	push   %eax
+    1dfb:	e8 11 f8 ff ff       	call   1611 <futex_wake>
+    1e00:	83 c4 10             	add    $0x10,%esp
+}
+    1e03:	eb e8                	jmp    1ded <mutex_unlock+0x17>
+
+00001e05 <cond_init>:
+// Condition variable: waiters sleep on a sequence number that
+// every signal bumps, so a signal between the unlock and the
+// futex_wait() in cond_wait() is not lost.
+void
+cond_init(cond_t *c)
+{
+    1e05:	55                   	push   %ebp
+    1e06:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    1e08:	8b 45 08             	mov    0x8(%ebp),%eax
+    1e0b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1e11:	5d                   	pop    %ebp
+    1e12:	c3                   	ret
+
+00001e13 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+    1e13:	55                   	push   %ebp
+    1e14:	89 e5                	mov    %esp,%ebp
+    1e16:	57                   	push   %edi
+    1e17:	56                   	push   %esi
+    1e18:	53                   	push   %ebx
+    1e19:	83 ec 18             	sub    $0x18,%esp
+    1e1c:	8b 75 08             	mov    0x8(%ebp),%esi
+    1e1f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    1e22:	8b 3e                	mov    (%esi),%edi
+  mutex_unlock(m);
+    1e24:	53                   	push   %ebx
+    1e25:	e8 ac ff ff ff       	call   1dd6 <mutex_unlock>
+  futex_wait(&c->seq, seq);
+    1e2a:	83 c4 08             	add    $0x8,%esp
+    1e2d:	57                   	push   %edi
+    1e2e:	56                   	push   %esi
+    1e2f:	e8 ce f7 ff ff       	call   1602 <futex_wait>
+  // Others may be waiting for m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+    1e34:	83 c4 10             	add    $0x10,%esp
+    1e37:	eb 0e                	jmp    1e47 <cond_wait+0x34>
+    futex_wait(&m->state, 2);
+    1e39:	83 ec 08             	sub    $0x8,%esp
+    1e3c:	6a 02                	push   $0x2
+    1e3e:	53                   	push   %ebx
+    1e3f:	e8 be f7 ff ff       	call   1602 <futex_wait>
+    1e44:	83 c4 10             	add    $0x10,%esp
+    1e47:	b8 02 00 00 00       	mov    $0x2,%eax
+    1e4c:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    1e4f:	85 c0                	test   %eax,%eax
+    1e51:	75 e6                	jne    1e39 <cond_wait+0x26>
+}
+    1e53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1e56:	5b                   	pop    %ebx
+    1e57:	5e                   	pop    %esi
+    1e58:	5f                   	pop    %edi
+    1e59:	5d                   	pop    %ebp
+    1e5a:	c3                   	ret
+
+00001e5b <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+    1e5b:	55                   	push   %ebp
+    1e5c:	89 e5                	mov    %esp,%ebp
+    1e5e:	83 ec 10             	sub    $0x10,%esp
+    1e61:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    1e64:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+    1e68:	6a 01                	push   $0x1
+    1e6a:	50                   	push   %eax
+    1e6b:	e8 a1 f7 ff ff       	call   1611 <futex_wake>
+}
+    1e70:	83 c4 10             	add    $0x10,%esp
+    1e73:	c9                   	leave
+    1e74:	c3                   	ret
+
+00001e75 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+    1e75:	55                   	push   %ebp
+    1e76:	89 e5                	mov    %esp,%ebp
+    1e78:	83 ec 10             	sub    $0x10,%esp
+    1e7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    1e7e:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, NPROC);
+    1e82:	6a 40                	push   $0x40
+    1e84:	50                   	push   %eax
+    1e85:	e8 87 f7 ff ff       	call   1611 <futex_wake>
+}
+    1e8a:	83 c4 10             	add    $0x10,%esp
+    1e8d:	c9                   	leave
+    1e8e:	c3                   	ret
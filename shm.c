@@ -0,0 +1,173 @@
+// Shared memory segments.  shmget() names a segment of zeroed
+// pages by a key, creating it on first use, and shmat() maps all
+// of it into the caller's mmap() area, just above whatever is
+// mapped there already, so processes that agree on a key share
+// the pages with no copies between them.  The mappings are
+// PTE_SHARED, so fork() gives the child the same pages rather
+// than copy-on-write ones, and exit() and exec() unmap them like
+// any other page.
+//
+// The segment holds a reference on each of its pages and every
+// mapping another one.  A segment that has been attached and
+// that no page table maps any more (its first page is down to the
+// segment's own reference) is freed, by shmdt() or by freevm()
+// once the last process using it is gone.  New mappings are only
+// made with shm.lock held, so such a segment cannot come back.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "proc.h"
+
+struct shmseg {
+  int key;
+  int npage;                   // 0 if unused
+  int attached;                // Mapped at least once
+  char *page[SHMMAXPG];
+};
+
+static struct {
+  struct spinlock lock;
+  int nseg;                    // Segments in use
+  struct shmseg seg[NSHM];
+} shm;
+
+void
+shminit(void)
+{
+  initlock(&shm.lock, "shm");
+}
+
+// Free the segments no one maps any more.
+// Caller holds shm.lock.
+static void
+reclaim(void)
+{
+  struct shmseg *s;
+  int i;
+
+  for(s = shm.seg; s < &shm.seg[NSHM]; s++){
+    if(s->npage == 0 || !s->attached || krefcnt(s->page[0]) != 1)
+      continue;
+    for(i = 0; i < s->npage; i++)
+      kfree(s->page[i]);
+    s->npage = 0;
+    shm.nseg--;
+  }
+}
+
+// A page table went away: free what it was the last to map.
+void
+shmreclaim(void)
+{
+  if(shm.nseg == 0)
+    return;
+  acquire(&shm.lock);
+  reclaim();
+  release(&shm.lock);
+}
+
+// The id of the segment named key, created with size bytes if
+// there is none.  Returns -1 if an existing one is smaller than
+// size, or if a new one can't be made.
+int
+shmget(int key, uint size)
+{
+  struct shmseg *s, *free;
+  int i, n;
+
+  n = PGROUNDUP(size) / PGSIZE;
+  if(size == 0 || n > SHMMAXPG)
+    return -1;
+  acquire(&shm.lock);
+  reclaim();
+  free = 0;
+  for(s = shm.seg; s < &shm.seg[NSHM]; s++){
+    if(s->npage == 0){
+      if(free == 0)
+        free = s;
+    } else if(s->key == key){
+      release(&shm.lock);
+      return n <= s->npage ? s - shm.seg : -1;
+    }
+  }
+  if((s = free) == 0){
+    release(&shm.lock);
+    return -1;
+  }
+  for(i = 0; i < n; i++){
+    if((s->page[i] = kzalloc()) == 0){
+      while(--i >= 0)
+        kfree(s->page[i]);
+      release(&shm.lock);
+      return -1;
+    }
+  }
+  s->key = key;
+  s->npage = n;
+  s->attached = 0;
+  shm.nseg++;
+  release(&shm.lock);
+  return s - shm.seg;
+}
+
+// Map segment id into p's mmap() area and return its address,
+// or -1.
+int
+shmat(struct proc *p, int id)
+{
+  struct shmseg *s;
+  uint size, start;
+
+  if(id < 0 || id >= NSHM || p->as)
+    return -1;
+  acquire(&shm.lock);
+  s = &shm.seg[id];
+  size = s->npage * PGSIZE;
+  if(s->npage == 0 || size > p->mmapbot ||
+     p->mmapbot - size < PGROUNDUP(p->sz)){
+    release(&shm.lock);
+    return -1;
+  }
+  start = p->mmapbot - size;
+  if(uvmshare(p, start, s->page, s->npage) < 0){
+    release(&shm.lock);
+    return -1;
+  }
+  s->attached = 1;
+  p->mmapbot = start;
+  release(&shm.lock);
+  return start;
+}
+
+// Unmap the segment that shmat() mapped at va in p.  Returns -1
+// if there is none there.
+int
+shmdt(struct proc *p, uint va)
+{
+  struct shmseg *s;
+  char *k;
+
+  if(va % PGSIZE || va >= KERNBASE || p->as)
+    return -1;
+  acquire(&shm.lock);
+  if((k = uva2ka(p->pgdir, (char*)va)) != 0){
+    for(s = shm.seg; s < &shm.seg[NSHM]; s++){
+      if(s->npage == 0 || s->page[0] != k)
+        continue;
+      if(uvmunshare(p, va, s->page, s->npage) < 0)
+        break;
+      // The lowest mapping: its space can be used again.
+      if(va == p->mmapbot)
+        mmaprise(p);
+      reclaim();
+      release(&shm.lock);
+      return 0;
+    }
+  }
+  release(&shm.lock);
+  return -1;
+}
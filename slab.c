@@ -0,0 +1,182 @@
+// Slab allocator for kernel objects smaller than a page.
+//
+// Every cache hands out objects of one size.  Each slab is one
+// page from kalloc(): a struct slab header followed by as many
+// objects as fit, so slabfree() finds an object's slab by
+// rounding its address down.  Free objects in a slab are kept
+// on a list threaded through the objects themselves.
+//
+// In front of the slabs each CPU keeps a magazine of up to NMAG
+// free objects.  slaballoc() and slabfree() only need to turn
+// interrupts off to use it; they take the cache lock to move
+// NMAG/2 objects at a time when the magazine runs empty or full.
+// A slab whose objects have all come back is returned to
+// kalloc(), unless it is the cache's last one.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "slab.h"
+
+struct slab {
+  struct slab *next;           // On cache->partial
+  struct slab *prev;
+  struct slabcache *cache;
+  void *free;                  // First free object
+  uint inuse;                  // Objects not on free
+};
+
+#define SLAB(obj) ((struct slab*)PGROUNDDOWN((uint)(obj)))
+
+void
+slabinit(struct slabcache *c, char *name, uint size)
+{
+  int i;
+
+  initlock(&c->lock, name);
+  c->name = name;
+  if(size < sizeof(void*))
+    size = sizeof(void*);
+  c->size = (size + 3) & ~3;
+  c->perslab = (PGSIZE - sizeof(struct slab)) / c->size;
+  if(c->perslab == 0)
+    panic("slabinit");
+  c->partial = 0;
+  c->nslab = 0;
+  c->nobj = 0;
+  for(i = 0; i < NCPU; i++)
+    c->mag[i].n = 0;
+}
+
+static void
+slabunlink(struct slabcache *c, struct slab *s)
+{
+  if(s->prev)
+    s->prev->next = s->next;
+  else
+    c->partial = s->next;
+  if(s->next)
+    s->next->prev = s->prev;
+  s->next = s->prev = 0;
+}
+
+static void
+slablink(struct slabcache *c, struct slab *s)
+{
+  s->prev = 0;
+  s->next = c->partial;
+  if(s->next)
+    s->next->prev = s;
+  c->partial = s;
+}
+
+// Carve a new page into a slab of free objects.
+// Called with c->lock held.
+static struct slab*
+slabgrow(struct slabcache *c)
+{
+  struct slab *s;
+  char *o;
+  uint i;
+
+  if((s = (struct slab*)kalloc()) == 0)
+    return 0;
+  s->cache = c;
+  s->inuse = 0;
+  s->free = 0;
+  o = (char*)(s + 1) + (c->perslab - 1) * c->size;
+  for(i = 0; i < c->perslab; i++, o -= c->size){
+    *(void**)o = s->free;
+    s->free = o;
+  }
+  slablink(c, s);
+  c->nslab++;
+  return s;
+}
+
+// Move up to n objects from the slabs into m.
+// Called with c->lock held.
+static void
+slabfill(struct slabcache *c, struct magazine *m, int n)
+{
+  struct slab *s;
+  void *o;
+
+  while(n-- > 0){
+    if((s = c->partial) == 0 && (s = slabgrow(c)) == 0)
+      break;
+    o = s->free;
+    s->free = *(void**)o;
+    if(++s->inuse == c->perslab)
+      slabunlink(c, s);
+    m->obj[m->n++] = o;
+    c->nobj++;
+  }
+}
+
+// Move n objects from m back to their slabs.
+// Called with c->lock held.
+static void
+slabdrain(struct slabcache *c, struct magazine *m, int n)
+{
+  struct slab *s;
+  void *o;
+
+  while(n-- > 0 && m->n > 0){
+    o = m->obj[--m->n];
+    s = SLAB(o);
+    if(s->cache != c)
+      panic("slabfree");
+    if(s->inuse-- == c->perslab)
+      slablink(c, s);
+    *(void**)o = s->free;
+    s->free = o;
+    c->nobj--;
+    if(s->inuse == 0 && (s->next || s->prev)){
+      slabunlink(c, s);
+      c->nslab--;
+      kfree((char*)s);
+    }
+  }
+}
+
+// Allocate one object from cache c.
+// Returns 0 if the memory cannot be allocated.
+void*
+slaballoc(struct slabcache *c)
+{
+  struct magazine *m;
+  void *o;
+
+  o = 0;
+  pushcli();
+  m = &c->mag[cpuid()];
+  if(m->n == 0){
+    acquire(&c->lock);
+    slabfill(c, m, NMAG/2);
+    release(&c->lock);
+  }
+  if(m->n > 0)
+    o = m->obj[--m->n];
+  popcli();
+  return o;
+}
+
+// Free object o, which slaballoc(c) returned.
+void
+slabfree(struct slabcache *c, void *o)
+{
+  struct magazine *m;
+
+  pushcli();
+  m = &c->mag[cpuid()];
+  if(m->n == NMAG){
+    acquire(&c->lock);
+    slabdrain(c, m, NMAG/2);
+    release(&c->lock);
+  }
+  m->obj[m->n++] = o;
+  popcli();
+}
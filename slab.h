@@ -0,0 +1,19 @@
+// Object cache: allocates fixed-size kernel objects out of
+// whole pages (slabs), with a magazine of free objects per CPU.
+#define NMAG 16                // Objects per magazine
+
+struct magazine {
+  int n;                       // Number of objects in obj[]
+  void *obj[NMAG];
+};
+
+struct slabcache {
+  struct spinlock lock;        // Protects the slab lists and counts
+  char *name;                  // Name of cache (debugging)
+  uint size;                   // Object size, rounded up
+  uint perslab;                // Objects in one slab
+  struct slab *partial;        // Slabs with free objects
+  uint nslab;                  // Pages in use
+  uint nobj;                   // Objects handed out (incl. magazines)
+  struct magazine mag[NCPU];   // Per-CPU free objects
+};
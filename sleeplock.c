@@ -1,4 +1,6 @@
-// Sleeping locks
+// Sleeping locks, exclusive or shared.  A process waiting to
+// hold a lock exclusive holds off new readers, so that a stream of
+// readers cannot starve it.
 
 #include "types.h"
 #include "defs.h"
@@ -6,8 +8,8 @@
 #include "x86.h"
 #include "memlayout.h"
 #include "mmu.h"
-#include "proc.h"
 #include "spinlock.h"
+#include "proc.h"
 #include "sleeplock.h"
 
 void
@@ -16,27 +18,95 @@ initsleeplock(struct sleeplock *lk, char *name)
   initlock(&lk->lk, "sleep lock");
   lk->name = name;
   lk->locked = 0;
+  lk->readers = 0;
+  lk->wwait = 0;
   lk->pid = 0;
+  lockstatadd(&lk->stat, name, 1);
+}
+
+// lk is about to be freed.
+void
+freesleeplock(struct sleeplock *lk)
+{
+  lockstatdel(&lk->stat);
+  freelock(&lk->lk);
 }
 
 void
 acquiresleep(struct sleeplock *lk)
 {
+  uint64 t0;
+
   acquire(&lk->lk);
-  while (lk->locked) {
-    sleep(lk, &lk->lk);
+  if(lk->locked || lk->readers){
+    t0 = rdtsc();
+    lk->wwait++;
+    while (lk->locked || lk->readers) {
+      sleep(lk, &lk->lk);
+    }
+    lk->wwait--;
+    lk->stat.ncontend++;
+    lk->stat.wait += rdtsc() - t0;
   }
   lk->locked = 1;
   lk->pid = myproc()->pid;
+  lk->stat.nacq++;
+  lk->stat.tsc = rdtsc();
   release(&lk->lk);
 }
 
+// Hold lk shared with other readers.  Release with releasesleep().
 void
-releasesleep(struct sleeplock *lk)
+acquiresleepshared(struct sleeplock *lk)
+{
+  uint64 t0;
+
+  acquire(&lk->lk);
+  if(lk->locked || lk->wwait){
+    t0 = rdtsc();
+    while (lk->locked || lk->wwait) {
+      sleep(lk, &lk->lk);
+    }
+    lk->stat.ncontend++;
+    lk->stat.wait += rdtsc() - t0;
+  }
+  // The hold time of shared mode is that of a run of readers.
+  if(lk->readers++ == 0)
+    lk->stat.tsc = rdtsc();
+  lk->stat.nacq++;
+  release(&lk->lk);
+}
+
+// Turn an exclusive hold into a shared one, letting other readers
+// in.
+void
+downgradesleep(struct sleeplock *lk)
 {
   acquire(&lk->lk);
   lk->locked = 0;
   lk->pid = 0;
+  lk->readers = 1;
+  wakeup(lk);
+  release(&lk->lk);
+}
+
+// Release lk, in whichever mode it is held.
+void
+releasesleep(struct sleeplock *lk)
+{
+  uint64 t;
+
+  acquire(&lk->lk);
+  if(lk->locked){
+    lk->locked = 0;
+    lk->pid = 0;
+  } else if(--lk->readers > 0){
+    release(&lk->lk);
+    return;
+  }
+  t = rdtsc() - lk->stat.tsc;
+  if(t > lk->stat.maxhold)
+    lk->stat.maxhold = t;
   wakeup(lk);
   release(&lk->lk);
 }
@@ -52,5 +122,17 @@ holdingsleep(struct sleeplock *lk)
   return r;
 }
 
+// Is lk held exclusive by this process, or shared by anyone?
+int
+heldsleep(struct sleeplock *lk)
+{
+  int r;
+
+  acquire(&lk->lk);
+  r = (lk->locked && lk->pid == myproc()->pid) || lk->readers > 0;
+  release(&lk->lk);
+  return r;
+}
+
 
 
@@ -1,10 +1,14 @@
-// Long-term locks for processes
+// Long-term locks for processes, held exclusive (acquiresleep)
+// or shared by any number of readers (acquiresleepshared).
 struct sleeplock {
-  uint locked;       // Is the lock held?
+  uint locked;       // Is the lock held exclusive?
+  int readers;       // Holders in shared mode
+  int wwait;         // Waiting to hold it exclusive; readers wait too
   struct spinlock lk; // spinlock protecting this sleep lock
   
   // For debugging:
   char *name;        // Name of lock.
   int pid;           // Process holding lock
+  struct lockcount stat;
 };
 
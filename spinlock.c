@@ -1,4 +1,13 @@
 // Mutual exclusion spin locks.
+//
+// These are MCS locks (Mellor-Crummey and Scott): a CPU that finds
+// the lock held queues a node of its own behind the last waiter
+// and spins on a flag in that node, which the holder before it
+// clears on release.  So waiters are served in FIFO order, and each
+// spins on its own cache line instead of all of them hammering the
+// lock's.  A CPU cannot be rescheduled between acquire() and
+// release(), so each CPU keeps its nodes in a small array of its
+// own, one per lock it holds or waits for.
 
 #include "types.h"
 #include "defs.h"
@@ -6,15 +15,115 @@
 #include "x86.h"
 #include "memlayout.h"
 #include "mmu.h"
-#include "proc.h"
 #include "spinlock.h"
+#include "proc.h"
+#include "lockstat.h"
+
+#define NLOCKDEPTH 16          // Locks a CPU may hold at once
+
+struct mcsnode {
+  struct mcsnode *volatile next;  // Next waiter
+  volatile uint wait;             // Set until our turn comes
+  struct spinlock *lk;            // Lock using this node, 0 if free
+} __attribute__((aligned(64)));
+
+static struct mcsnode mcsnodes[NCPU][NLOCKDEPTH];
+
+// This CPU's node for lk; with new set, a free one to use for it.
+static struct mcsnode*
+mcsnode(struct spinlock *lk, int new)
+{
+  struct mcsnode *n, *end;
+
+  n = mcsnodes[mycpu() - cpus];
+  for(end = n + NLOCKDEPTH; n < end; n++)
+    if(n->lk == (new ? 0 : lk))
+      return n;
+  panic(new ? "acquire: too many locks" : "release: no node");
+}
+
+// All locks, for getlockstat().  statlock is free when zeroed, so
+// it needs no initlock(); it is not on the list itself.
+static struct spinlock statlock;
+static struct lockcount *locklist;
+
+// Put c on the list of locks, with counters zeroed.  The locks
+// kinit1() makes come before mpinit(), when there is no mycpu()
+// to acquire statlock with, but also no other CPU.
+void
+lockstatadd(struct lockcount *c, char *name, int sleep)
+{
+  memset(c, 0, sizeof(*c));
+  c->name = name;
+  c->sleep = sleep;
+  if(ncpu)
+    acquire(&statlock);
+  c->next = locklist;
+  if(locklist)
+    locklist->pprev = &c->next;
+  locklist = c;
+  c->pprev = &locklist;
+  if(ncpu)
+    release(&statlock);
+}
+
+// Take c off the list, before the lock's memory is freed.
+void
+lockstatdel(struct lockcount *c)
+{
+  acquire(&statlock);
+  *c->pprev = c->next;
+  if(c->next)
+    c->next->pprev = c->pprev;
+  release(&statlock);
+}
+
+// Copy the counters of the n-th lock on the list into *ls, or with
+// n < 0 zero the counters of all.  Returns -1 if there are not
+// that many locks.  The counters are read without their locks, so
+// a snapshot may be a little inconsistent.
+int
+getlockstat(int n, struct lockstat *ls)
+{
+  struct lockcount *c;
+
+  acquire(&statlock);
+  if(n < 0){
+    for(c = locklist; c; c = c->next){
+      c->nacq = c->ncontend = 0;
+      c->wait = c->maxhold = 0;
+    }
+    release(&statlock);
+    return 0;
+  }
+  for(c = locklist; c && n > 0; c = c->next)
+    n--;
+  if(c){
+    safestrcpy(ls->name, c->name, sizeof(ls->name));
+    ls->sleep = c->sleep;
+    ls->nacq = c->nacq;
+    ls->ncontend = c->ncontend;
+    ls->wait = c->wait;
+    ls->maxhold = c->maxhold;
+  }
+  release(&statlock);
+  return c ? 0 : -1;
+}
 
 void
 initlock(struct spinlock *lk, char *name)
 {
   lk->name = name;
-  lk->locked = 0;
+  lk->tail = 0;
   lk->cpu = 0;
+  lockstatadd(&lk->stat, name, 0);
+}
+
+// lk is about to be freed.
+void
+freelock(struct spinlock *lk)
+{
+  lockstatdel(&lk->stat);
 }
 
 // Acquire the lock.
@@ -24,13 +133,27 @@ initlock(struct spinlock *lk, char *name)
 void
 acquire(struct spinlock *lk)
 {
+  struct mcsnode *n, *prev;
+  uint64 t0;
+
   pushcli(); // disable interrupts to avoid deadlock.
   if(holding(lk))
     panic("acquire");
 
-  // The xchg is atomic.
-  while(xchg(&lk->locked, 1) != 0)
-    ;
+  n = mcsnode(lk, 1);
+  n->lk = lk;
+  n->next = 0;
+  n->wait = 1;
+  // The xchg is atomic: it queues us behind the last waiter.
+  prev = (struct mcsnode*)xchg((uint*)&lk->tail, (uint)n);
+  if(prev){
+    t0 = rdtsc();
+    prev->next = n;
+    while(n->wait)
+      pause();
+    lk->stat.ncontend++;
+    lk->stat.wait += rdtsc() - t0;
+  }
 
   // Tell the C compiler and the processor to not move loads or stores
   // past this point, to ensure that the critical section's memory
@@ -40,14 +163,23 @@ acquire(struct spinlock *lk)
   // Record info about lock acquisition for debugging.
   lk->cpu = mycpu();
   getcallerpcs(&lk, lk->pcs);
+  lk->stat.nacq++;
+  lk->stat.tsc = rdtsc();
 }
 
 // Release the lock.
 void
 release(struct spinlock *lk)
 {
+  struct mcsnode *n;
+  uint64 t;
+
   if(!holding(lk))
     panic("release");
+  n = mcsnode(lk, 0);
+  t = rdtsc() - lk->stat.tsc;
+  if(t > lk->stat.maxhold)
+    lk->stat.maxhold = t;
 
   lk->pcs[0] = 0;
   lk->cpu = 0;
@@ -59,11 +191,18 @@ release(struct spinlock *lk)
   // stores; __sync_synchronize() tells them both not to.
   __sync_synchronize();
 
-  // Release the lock, equivalent to lk->locked = 0.
-  // This code can't use a C assignment, since it might
-  // not be atomic. A real OS would use C atomics here.
-  asm volatile("movl $0, %0" : "+m" (lk->locked) : );
-
+  // Hand the lock to the next waiter.  With none queued, free it,
+  // unless one is just queueing itself behind us: then wait for it
+  // to link itself in.
+  if(n->next == 0){
+    if(cmpxchg((uint*)&lk->tail, (uint)n, 0) == (uint)n)
+      goto out;
+    while(n->next == 0)
+      pause();
+  }
+  n->next->wait = 0;
+out:
+  n->lk = 0;
   popcli();
 }
 
@@ -91,7 +230,7 @@ holding(struct spinlock *lock)
 {
   int r;
   pushcli();
-  r = lock->locked && lock->cpu == mycpu();
+  r = lock->tail && lock->cpu == mycpu();
   popcli();
   return r;
 }
@@ -1,11 +1,27 @@
-// Mutual exclusion lock.
+// Contention counters kept in every lock, and the links of the
+// list of all locks that getlockstat() (spinlock.c) walks.
+// Times are in TSC cycles.
+struct lockcount {
+  char *name;
+  int sleep;                   // In a sleep lock
+  uint nacq;                   // Acquisitions
+  uint ncontend;               // Of those, ones that had to wait
+  uint64 wait;                 // Time spent waiting
+  uint64 maxhold;              // Longest time held
+  uint64 tsc;                  // When last acquired
+  struct lockcount *next;
+  struct lockcount **pprev;
+};
+
+// Mutual exclusion lock: an MCS queue lock (spinlock.c).
 struct spinlock {
-  uint locked;       // Is the lock held?
+  struct mcsnode *tail;  // Last of the holder and its waiters, or 0 if free
 
   // For debugging:
   char *name;        // Name of lock.
   struct cpu *cpu;   // The cpu holding the lock.
   uint pcs[10];      // The call stack (an array of program counters)
                      // that locked the lock.
+  struct lockcount stat;
 };
 
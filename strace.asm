@@ -0,0 +1,3000 @@
+
+_strace:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <report>:
+
+static struct syscount sc[NSYSCALL];
+
+static void
+report(void)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	57                   	push   %edi
+       4:	56                   	push   %esi
+       5:	53                   	push   %ebx
+       6:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  uint kc[NSYSCALL], total, n;
+  int i, j, best;
+
+  total = n = 0;
+  for(i = 0; i < NSYSCALL; i++){
+       c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  total = n = 0;
+      11:	be 00 00 00 00       	mov    $0x0,%esi
+      16:	bf 00 00 00 00       	mov    $0x0,%edi
+  for(i = 0; i < NSYSCALL; i++){
+      1b:	eb 49                	jmp    66 <report+0x66>
+    kc[i] = sc[i].time >> 10;
+      1d:	8d 04 8d 00 00 00 00 	lea    0x0(,%ecx,4),%eax
+      24:	01 c8                	add    %ecx,%eax
+      26:	8d 1c 85 00 00 00 00 	lea    0x0(,%eax,4),%ebx
+      2d:	8b 83 84 1f 00 00    	mov    0x1f84(%ebx),%eax
+      33:	8b 93 88 1f 00 00    	mov    0x1f88(%ebx),%edx
+      39:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+      3d:	c1 ea 0a             	shr    $0xa,%edx
+      40:	89 85 e0 fe ff ff    	mov    %eax,-0x120(%ebp)
+      46:	89 95 e4 fe ff ff    	mov    %edx,-0x11c(%ebp)
+      4c:	89 c2                	mov    %eax,%edx
+      4e:	8b 85 e0 fe ff ff    	mov    -0x120(%ebp),%eax
+      54:	89 84 8d e8 fe ff ff 	mov    %eax,-0x118(%ebp,%ecx,4)
+    total += kc[i];
+      5b:	01 d7                	add    %edx,%edi
+    n += sc[i].n;
+      5d:	03 b3 80 1f 00 00    	add    0x1f80(%ebx),%esi
+  for(i = 0; i < NSYSCALL; i++){
+      63:	83 c1 01             	add    $0x1,%ecx
+      66:	83 f9 3f             	cmp    $0x3f,%ecx
+      69:	7e b2                	jle    1d <report+0x1d>
+  }
+  printf(2, "%% time\tkcycles\tmax\tcalls\tsyscall\n");
+      6b:	83 ec 08             	sub    $0x8,%esp
+      6e:	68 c4 16 00 00       	push   $0x16c4
+      73:	6a 02                	push   $0x2
+      75:	e8 f3 0d 00 00       	call   e6d <printf>
+  for(j = 0; j < NSYSCALL; j++){
+      7a:	83 c4 10             	add    $0x10,%esp
+      7d:	c7 85 dc fe ff ff 00 	movl   $0x0,-0x124(%ebp)
+      84:	00 00 00 
+      87:	89 bd e0 fe ff ff    	mov    %edi,-0x120(%ebp)
+      8d:	89 b5 d0 fe ff ff    	mov    %esi,-0x130(%ebp)
+      93:	e9 e1 00 00 00       	jmp    179 <report+0x179>
+    best = -1;
+    for(i = 0; i < NSYSCALL; i++)
+      if(sc[i].n > 0 && (best < 0 || kc[i] > kc[best]))
+        best = i;
+      98:	89 c3                	mov    %eax,%ebx
+    for(i = 0; i < NSYSCALL; i++)
+      9a:	83 c0 01             	add    $0x1,%eax
+      9d:	83 f8 3f             	cmp    $0x3f,%eax
+      a0:	7f 2b                	jg     cd <report+0xcd>
+      if(sc[i].n > 0 && (best < 0 || kc[i] > kc[best]))
+      a2:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+      a5:	8d 14 8d 00 00 00 00 	lea    0x0(,%ecx,4),%edx
+      ac:	83 ba 80 1f 00 00 00 	cmpl   $0x0,0x1f80(%edx)
+      b3:	74 e5                	je     9a <report+0x9a>
+      b5:	85 db                	test   %ebx,%ebx
+      b7:	78 df                	js     98 <report+0x98>
+      b9:	8b bc 85 e8 fe ff ff 	mov    -0x118(%ebp,%eax,4),%edi
+      c0:	39 bc 9d e8 fe ff ff 	cmp    %edi,-0x118(%ebp,%ebx,4)
+      c7:	73 d1                	jae    9a <report+0x9a>
+        best = i;
+      c9:	89 c3                	mov    %eax,%ebx
+      cb:	eb cd                	jmp    9a <report+0x9a>
+    if(best < 0)
+      cd:	85 db                	test   %ebx,%ebx
+      cf:	0f 88 e8 00 00 00    	js     1bd <report+0x1bd>
+      break;
+    printf(2, "%d\t%d\t%d\t%d\t%s\n",
+           total >= 100 ? kc[best] / (total/100) : (total ? kc[best]*100/total : 0),
+           kc[best], (uint)(sc[best].max >> 10), sc[best].n,
+           names[best] ? names[best] : "?");
+      d5:	8b 34 9d 20 17 00 00 	mov    0x1720(,%ebx,4),%esi
+    printf(2, "%d\t%d\t%d\t%d\t%s\n",
+      dc:	85 f6                	test   %esi,%esi
+      de:	0f 84 ad 00 00 00    	je     191 <report+0x191>
+      e4:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+      eb:	01 d8                	add    %ebx,%eax
+      ed:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+      f4:	8b 8a 80 1f 00 00    	mov    0x1f80(%edx),%ecx
+           kc[best], (uint)(sc[best].max >> 10), sc[best].n,
+      fa:	8b 82 8c 1f 00 00    	mov    0x1f8c(%edx),%eax
+     100:	8b 92 90 1f 00 00    	mov    0x1f90(%edx),%edx
+     106:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+     10a:	c1 ea 0a             	shr    $0xa,%edx
+    printf(2, "%d\t%d\t%d\t%d\t%s\n",
+     10d:	89 85 d8 fe ff ff    	mov    %eax,-0x128(%ebp)
+     113:	8b bc 9d e8 fe ff ff 	mov    -0x118(%ebp,%ebx,4),%edi
+     11a:	8b 85 e0 fe ff ff    	mov    -0x120(%ebp),%eax
+     120:	83 f8 63             	cmp    $0x63,%eax
+     123:	76 76                	jbe    19b <report+0x19b>
+           total >= 100 ? kc[best] / (total/100) : (total ? kc[best]*100/total : 0),
+     125:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+     12a:	f7 e2                	mul    %edx
+     12c:	c1 ea 05             	shr    $0x5,%edx
+    printf(2, "%d\t%d\t%d\t%d\t%s\n",
+     12f:	89 f8                	mov    %edi,%eax
+     131:	89 95 d4 fe ff ff    	mov    %edx,-0x12c(%ebp)
+     137:	ba 00 00 00 00       	mov    $0x0,%edx
+     13c:	f7 b5 d4 fe ff ff    	divl   -0x12c(%ebp)
+     142:	83 ec 04             	sub    $0x4,%esp
+     145:	56                   	push   %esi
+     146:	51                   	push   %ecx
+     147:	ff b5 d8 fe ff ff    	push   -0x128(%ebp)
+     14d:	57                   	push   %edi
+     14e:	50                   	push   %eax
+     14f:	68 a2 14 00 00       	push   $0x14a2
+     154:	6a 02                	push   $0x2
+     156:	e8 12 0d 00 00       	call   e6d <printf>
+    sc[best].n = 0;
+     15b:	8d 14 9b             	lea    (%ebx,%ebx,4),%edx
+     15e:	8d 04 95 00 00 00 00 	lea    0x0(,%edx,4),%eax
+     165:	c7 80 80 1f 00 00 00 	movl   $0x0,0x1f80(%eax)
+     16c:	00 00 00 
+  for(j = 0; j < NSYSCALL; j++){
+     16f:	83 85 dc fe ff ff 01 	addl   $0x1,-0x124(%ebp)
+     176:	83 c4 20             	add    $0x20,%esp
+     179:	83 bd dc fe ff ff 3f 	cmpl   $0x3f,-0x124(%ebp)
+     180:	7f 3b                	jg     1bd <report+0x1bd>
+    best = -1;
+     182:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    for(i = 0; i < NSYSCALL; i++)
+     187:	b8 00 00 00 00       	mov    $0x0,%eax
+     18c:	e9 0c ff ff ff       	jmp    9d <report+0x9d>
+    printf(2, "%d\t%d\t%d\t%d\t%s\n",
+     191:	be a0 14 00 00       	mov    $0x14a0,%esi
+     196:	e9 49 ff ff ff       	jmp    e4 <report+0xe4>
+           total >= 100 ? kc[best] / (total/100) : (total ? kc[best]*100/total : 0),
+     19b:	8b 95 e0 fe ff ff    	mov    -0x120(%ebp),%edx
+     1a1:	85 d2                	test   %edx,%edx
+     1a3:	74 10                	je     1b5 <report+0x1b5>
+     1a5:	6b c7 64             	imul   $0x64,%edi,%eax
+     1a8:	ba 00 00 00 00       	mov    $0x0,%edx
+     1ad:	f7 b5 e0 fe ff ff    	divl   -0x120(%ebp)
+     1b3:	eb 8d                	jmp    142 <report+0x142>
+     1b5:	8b 85 e0 fe ff ff    	mov    -0x120(%ebp),%eax
+     1bb:	eb 85                	jmp    142 <report+0x142>
+  }
+  printf(2, "100\t%d\t\t%d\ttotal\n", total, n);
+     1bd:	8b bd e0 fe ff ff    	mov    -0x120(%ebp),%edi
+     1c3:	8b b5 d0 fe ff ff    	mov    -0x130(%ebp),%esi
+     1c9:	56                   	push   %esi
+     1ca:	57                   	push   %edi
+     1cb:	68 b2 14 00 00       	push   $0x14b2
+     1d0:	6a 02                	push   $0x2
+     1d2:	e8 96 0c 00 00       	call   e6d <printf>
+}
+     1d7:	83 c4 10             	add    $0x10,%esp
+     1da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     1dd:	5b                   	pop    %ebx
+     1de:	5e                   	pop    %esi
+     1df:	5f                   	pop    %edi
+     1e0:	5d                   	pop    %ebp
+     1e1:	c3                   	ret
+
+000001e2 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     1e2:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     1e6:	83 e4 f0             	and    $0xfffffff0,%esp
+     1e9:	ff 71 fc             	push   -0x4(%ecx)
+     1ec:	55                   	push   %ebp
+     1ed:	89 e5                	mov    %esp,%ebp
+     1ef:	56                   	push   %esi
+     1f0:	53                   	push   %ebx
+     1f1:	51                   	push   %ecx
+     1f2:	83 ec 0c             	sub    $0xc,%esp
+     1f5:	8b 19                	mov    (%ecx),%ebx
+     1f7:	8b 71 04             	mov    0x4(%ecx),%esi
+  int pid;
+
+  if(argc == 2 && strcmp(argv[1], "-a") == 0){
+     1fa:	83 fb 02             	cmp    $0x2,%ebx
+     1fd:	74 30                	je     22f <main+0x4d>
+      exit();
+    }
+    report();
+    exit();
+  }
+  if(argc < 3 || strcmp(argv[1], "-c") != 0){
+     1ff:	83 fb 02             	cmp    $0x2,%ebx
+     202:	7e 17                	jle    21b <main+0x39>
+     204:	83 ec 08             	sub    $0x8,%esp
+     207:	68 df 14 00 00       	push   $0x14df
+     20c:	ff 76 04             	push   0x4(%esi)
+     20f:	e8 0e 01 00 00       	call   322 <strcmp>
+     214:	83 c4 10             	add    $0x10,%esp
+     217:	85 c0                	test   %eax,%eax
+     219:	74 5f                	je     27a <main+0x98>
+    printf(2, "usage: strace -c cmd [arg ...] | strace -a\n");
+     21b:	83 ec 08             	sub    $0x8,%esp
+     21e:	68 e8 16 00 00       	push   $0x16e8
+     223:	6a 02                	push   $0x2
+     225:	e8 43 0c 00 00       	call   e6d <printf>
+    exit();
+     22a:	e8 05 07 00 00       	call   934 <exit>
+  if(argc == 2 && strcmp(argv[1], "-a") == 0){
+     22f:	83 ec 08             	sub    $0x8,%esp
+     232:	68 c4 14 00 00       	push   $0x14c4
+     237:	ff 76 04             	push   0x4(%esi)
+     23a:	e8 e3 00 00 00       	call   322 <strcmp>
+     23f:	83 c4 10             	add    $0x10,%esp
+     242:	85 c0                	test   %eax,%eax
+     244:	75 b9                	jne    1ff <main+0x1d>
+    if(sysstat(SS_ALL, sc) < 0){
+     246:	83 ec 08             	sub    $0x8,%esp
+     249:	68 80 1f 00 00       	push   $0x1f80
+     24e:	6a 00                	push   $0x0
+     250:	e8 c4 0a 00 00       	call   d19 <sysstat>
+     255:	83 c4 10             	add    $0x10,%esp
+     258:	85 c0                	test   %eax,%eax
+     25a:	78 0a                	js     266 <main+0x84>
+    report();
+     25c:	e8 9f fd ff ff       	call   0 <report>
+    exit();
+     261:	e8 ce 06 00 00       	call   934 <exit>
+      printf(2, "strace: sysstat failed\n");
+     266:	83 ec 08             	sub    $0x8,%esp
+     269:	68 c7 14 00 00       	push   $0x14c7
+     26e:	6a 02                	push   $0x2
+     270:	e8 f8 0b 00 00       	call   e6d <printf>
+      exit();
+     275:	e8 ba 06 00 00       	call   934 <exit>
+  }
+  if((pid = fork()) < 0){
+     27a:	e8 a1 06 00 00       	call   920 <fork>
+     27f:	85 c0                	test   %eax,%eax
+     281:	78 2b                	js     2ae <main+0xcc>
+    printf(2, "strace: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+     283:	74 3d                	je     2c2 <main+0xe0>
+    exec(argv[2], argv + 2);
+    printf(2, "strace: exec %s failed\n", argv[2]);
+    exit();
+  }
+  while(wait() >= 0)
+     285:	e8 b0 07 00 00       	call   a3a <wait>
+     28a:	85 c0                	test   %eax,%eax
+     28c:	79 f7                	jns    285 <main+0xa3>
+    ;
+  if(sysstat(SS_CHILDREN, sc) < 0){
+     28e:	83 ec 08             	sub    $0x8,%esp
+     291:	68 80 1f 00 00       	push   $0x1f80
+     296:	6a 02                	push   $0x2
+     298:	e8 7c 0a 00 00       	call   d19 <sysstat>
+     29d:	83 c4 10             	add    $0x10,%esp
+     2a0:	85 c0                	test   %eax,%eax
+     2a2:	78 44                	js     2e8 <main+0x106>
+    printf(2, "strace: sysstat failed\n");
+    exit();
+  }
+  report();
+     2a4:	e8 57 fd ff ff       	call   0 <report>
+  exit();
+     2a9:	e8 86 06 00 00       	call   934 <exit>
+    printf(2, "strace: fork failed\n");
+     2ae:	83 ec 08             	sub    $0x8,%esp
+     2b1:	68 e2 14 00 00       	push   $0x14e2
+     2b6:	6a 02                	push   $0x2
+     2b8:	e8 b0 0b 00 00       	call   e6d <printf>
+    exit();
+     2bd:	e8 72 06 00 00       	call   934 <exit>
+    exec(argv[2], argv + 2);
+     2c2:	83 ec 08             	sub    $0x8,%esp
+     2c5:	8d 46 08             	lea    0x8(%esi),%eax
+     2c8:	50                   	push   %eax
+     2c9:	ff 76 08             	push   0x8(%esi)
+     2cc:	e8 75 06 00 00       	call   946 <exec>
+    printf(2, "strace: exec %s failed\n", argv[2]);
+     2d1:	83 c4 0c             	add    $0xc,%esp
+     2d4:	ff 76 08             	push   0x8(%esi)
+     2d7:	68 f7 14 00 00       	push   $0x14f7
+     2dc:	6a 02                	push   $0x2
+     2de:	e8 8a 0b 00 00       	call   e6d <printf>
+    exit();
+     2e3:	e8 4c 06 00 00       	call   934 <exit>
+    printf(2, "strace: sysstat failed\n");
+     2e8:	83 ec 08             	sub    $0x8,%esp
+     2eb:	68 c7 14 00 00       	push   $0x14c7
+     2f0:	6a 02                	push   $0x2
+     2f2:	e8 76 0b 00 00       	call   e6d <printf>
+    exit();
+     2f7:	e8 38 06 00 00       	call   934 <exit>
+
+000002fc <strcpy>:
+#include "memlayout.h"
+#include "clock.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     2fc:	55                   	push   %ebp
+     2fd:	89 e5                	mov    %esp,%ebp
+     2ff:	56                   	push   %esi
+     300:	53                   	push   %ebx
+     301:	8b 75 08             	mov    0x8(%ebp),%esi
+     304:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     307:	89 f0                	mov    %esi,%eax
+     309:	89 d1                	mov    %edx,%ecx
+     30b:	83 c2 01             	add    $0x1,%edx
+     30e:	89 c3                	mov    %eax,%ebx
+     310:	83 c0 01             	add    $0x1,%eax
+     313:	0f b6 09             	movzbl (%ecx),%ecx
+     316:	88 0b                	mov    %cl,(%ebx)
+     318:	84 c9                	test   %cl,%cl
+     31a:	75 ed                	jne    309 <strcpy+0xd>
+    ;
+  return os;
+}
+     31c:	89 f0                	mov    %esi,%eax
+     31e:	5b                   	pop    %ebx
+     31f:	5e                   	pop    %esi
+     320:	5d                   	pop    %ebp
+     321:	c3                   	ret
+
+00000322 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     322:	55                   	push   %ebp
+     323:	89 e5                	mov    %esp,%ebp
+     325:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     328:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+     32b:	eb 06                	jmp    333 <strcmp+0x11>
+    p++, q++;
+     32d:	83 c1 01             	add    $0x1,%ecx
+     330:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+     333:	0f b6 01             	movzbl (%ecx),%eax
+     336:	84 c0                	test   %al,%al
+     338:	74 04                	je     33e <strcmp+0x1c>
+     33a:	3a 02                	cmp    (%edx),%al
+     33c:	74 ef                	je     32d <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+     33e:	0f b6 c0             	movzbl %al,%eax
+     341:	0f b6 12             	movzbl (%edx),%edx
+     344:	29 d0                	sub    %edx,%eax
+}
+     346:	5d                   	pop    %ebp
+     347:	c3                   	ret
+
+00000348 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     348:	55                   	push   %ebp
+     349:	89 e5                	mov    %esp,%ebp
+     34b:	53                   	push   %ebx
+     34c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  const char *p;
+  uint w;
+
+  for(p = s; (uint)p & 3; p++)
+     34f:	89 c8                	mov    %ecx,%eax
+     351:	eb 03                	jmp    356 <strlen+0xe>
+     353:	83 c0 01             	add    $0x1,%eax
+     356:	a8 03                	test   $0x3,%al
+     358:	74 09                	je     363 <strlen+0x1b>
+    if(*p == 0)
+     35a:	80 38 00             	cmpb   $0x0,(%eax)
+     35d:	75 f4                	jne    353 <strlen+0xb>
+      return p - s;
+     35f:	29 c8                	sub    %ecx,%eax
+     361:	eb 25                	jmp    388 <strlen+0x40>
+  // Then a word at a time, which never crosses into the next page:
+  // a word with a zero byte in it has one of these bits set.
+  for(;; p += 4){
+    w = *(uint*)p;
+     363:	8b 10                	mov    (%eax),%edx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     365:	8d 9a ff fe fe fe    	lea    -0x1010101(%edx),%ebx
+     36b:	f7 d2                	not    %edx
+     36d:	21 da                	and    %ebx,%edx
+     36f:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+     375:	75 05                	jne    37c <strlen+0x34>
+  for(;; p += 4){
+     377:	83 c0 04             	add    $0x4,%eax
+    w = *(uint*)p;
+     37a:	eb e7                	jmp    363 <strlen+0x1b>
+      break;
+  }
+  while(*p)
+     37c:	80 38 00             	cmpb   $0x0,(%eax)
+     37f:	74 05                	je     386 <strlen+0x3e>
+    p++;
+     381:	83 c0 01             	add    $0x1,%eax
+     384:	eb f6                	jmp    37c <strlen+0x34>
+  return p - s;
+     386:	29 c8                	sub    %ecx,%eax
+}
+     388:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     38b:	c9                   	leave
+     38c:	c3                   	ret
+
+0000038d <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     38d:	55                   	push   %ebp
+     38e:	89 e5                	mov    %esp,%ebp
+     390:	57                   	push   %edi
+     391:	56                   	push   %esi
+     392:	53                   	push   %ebx
+     393:	8b 55 10             	mov    0x10(%ebp),%edx
+  uint h;
+  char *d;
+
+  d = dst;
+  c &= 0xFF;
+     396:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  if(n >= 16){
+     39a:	83 fa 0f             	cmp    $0xf,%edx
+     39d:	76 52                	jbe    3f1 <memset+0x64>
+    h = -(uint)d & 3;
+     39f:	8b 45 08             	mov    0x8(%ebp),%eax
+     3a2:	f7 d8                	neg    %eax
+     3a4:	83 e0 03             	and    $0x3,%eax
+     3a7:	89 c6                	mov    %eax,%esi
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     3a9:	8b 7d 08             	mov    0x8(%ebp),%edi
+     3ac:	89 c1                	mov    %eax,%ecx
+     3ae:	89 d8                	mov    %ebx,%eax
+     3b0:	fc                   	cld
+     3b1:	f3 aa                	rep stos %al,%es:(%edi)
+    stosb(d, c, h);
+    stosl(d + h, (c<<24)|(c<<16)|(c<<8)|c, (n - h)/4);
+     3b3:	29 f2                	sub    %esi,%edx
+     3b5:	89 d1                	mov    %edx,%ecx
+     3b7:	c1 e9 02             	shr    $0x2,%ecx
+     3ba:	c1 e0 18             	shl    $0x18,%eax
+     3bd:	89 df                	mov    %ebx,%edi
+     3bf:	c1 e7 10             	shl    $0x10,%edi
+     3c2:	09 f8                	or     %edi,%eax
+     3c4:	89 df                	mov    %ebx,%edi
+     3c6:	c1 e7 08             	shl    $0x8,%edi
+     3c9:	09 f8                	or     %edi,%eax
+     3cb:	09 d8                	or     %ebx,%eax
+     3cd:	89 f7                	mov    %esi,%edi
+     3cf:	03 7d 08             	add    0x8(%ebp),%edi
+}
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosl" :
+     3d2:	fc                   	cld
+     3d3:	f3 ab                	rep stos %eax,%es:(%edi)
+    d += h + (n - h)/4*4;
+     3d5:	89 d7                	mov    %edx,%edi
+     3d7:	83 e7 fc             	and    $0xfffffffc,%edi
+     3da:	09 f7                	or     %esi,%edi
+     3dc:	03 7d 08             	add    0x8(%ebp),%edi
+    n = (n - h)%4;
+     3df:	83 e2 03             	and    $0x3,%edx
+  asm volatile("cld; rep stosb" :
+     3e2:	89 d1                	mov    %edx,%ecx
+     3e4:	89 d8                	mov    %ebx,%eax
+     3e6:	fc                   	cld
+     3e7:	f3 aa                	rep stos %al,%es:(%edi)
+  }
+  stosb(d, c, n);
+  return dst;
+}
+     3e9:	8b 45 08             	mov    0x8(%ebp),%eax
+     3ec:	5b                   	pop    %ebx
+     3ed:	5e                   	pop    %esi
+     3ee:	5f                   	pop    %edi
+     3ef:	5d                   	pop    %ebp
+     3f0:	c3                   	ret
+  d = dst;
+     3f1:	8b 7d 08             	mov    0x8(%ebp),%edi
+     3f4:	eb ec                	jmp    3e2 <memset+0x55>
+
+000003f6 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     3f6:	55                   	push   %ebp
+     3f7:	89 e5                	mov    %esp,%ebp
+     3f9:	8b 45 08             	mov    0x8(%ebp),%eax
+     3fc:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     400:	eb 03                	jmp    405 <strchr+0xf>
+     402:	83 c0 01             	add    $0x1,%eax
+     405:	0f b6 10             	movzbl (%eax),%edx
+     408:	84 d2                	test   %dl,%dl
+     40a:	74 06                	je     412 <strchr+0x1c>
+    if(*s == c)
+     40c:	38 ca                	cmp    %cl,%dl
+     40e:	75 f2                	jne    402 <strchr+0xc>
+     410:	eb 05                	jmp    417 <strchr+0x21>
+      return (char*)s;
+  return 0;
+     412:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     417:	5d                   	pop    %ebp
+     418:	c3                   	ret
+
+00000419 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     419:	55                   	push   %ebp
+     41a:	89 e5                	mov    %esp,%ebp
+     41c:	56                   	push   %esi
+     41d:	53                   	push   %ebx
+     41e:	8b 55 08             	mov    0x8(%ebp),%edx
+     421:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     424:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  // A word at a time while they agree.
+  if((((uint)s1 | (uint)s2) & 3) == 0)
+     427:	89 d3                	mov    %edx,%ebx
+     429:	09 cb                	or     %ecx,%ebx
+     42b:	f6 c3 03             	test   $0x3,%bl
+     42e:	74 24                	je     454 <memcmp+0x3b>
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+      s1 += 4, s2 += 4;
+  while(n-- > 0){
+     430:	8d 70 ff             	lea    -0x1(%eax),%esi
+     433:	85 c0                	test   %eax,%eax
+     435:	74 32                	je     469 <memcmp+0x50>
+    if(*s1 != *s2)
+     437:	0f b6 02             	movzbl (%edx),%eax
+     43a:	0f b6 19             	movzbl (%ecx),%ebx
+     43d:	38 d8                	cmp    %bl,%al
+     43f:	75 20                	jne    461 <memcmp+0x48>
+      return *s1 - *s2;
+    s1++, s2++;
+     441:	83 c2 01             	add    $0x1,%edx
+     444:	83 c1 01             	add    $0x1,%ecx
+  while(n-- > 0){
+     447:	89 f0                	mov    %esi,%eax
+     449:	eb e5                	jmp    430 <memcmp+0x17>
+      s1 += 4, s2 += 4;
+     44b:	83 c2 04             	add    $0x4,%edx
+     44e:	83 c1 04             	add    $0x4,%ecx
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+     451:	83 e8 04             	sub    $0x4,%eax
+     454:	83 f8 03             	cmp    $0x3,%eax
+     457:	76 d7                	jbe    430 <memcmp+0x17>
+     459:	8b 31                	mov    (%ecx),%esi
+     45b:	39 32                	cmp    %esi,(%edx)
+     45d:	74 ec                	je     44b <memcmp+0x32>
+     45f:	eb cf                	jmp    430 <memcmp+0x17>
+      return *s1 - *s2;
+     461:	0f b6 c0             	movzbl %al,%eax
+     464:	0f b6 db             	movzbl %bl,%ebx
+     467:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     469:	5b                   	pop    %ebx
+     46a:	5e                   	pop    %esi
+     46b:	5d                   	pop    %ebp
+     46c:	c3                   	ret
+
+0000046d <memchr>:
+// The first c in the n bytes at v, or 0.  Once aligned, a word at
+// a time, with the word's bytes that equal c turned into zeroes
+// and those looked for.
+void*
+memchr(const void *v, int c, uint n)
+{
+     46d:	55                   	push   %ebp
+     46e:	89 e5                	mov    %esp,%ebp
+     470:	57                   	push   %edi
+     471:	56                   	push   %esi
+     472:	53                   	push   %ebx
+     473:	8b 45 08             	mov    0x8(%ebp),%eax
+     476:	8b 55 10             	mov    0x10(%ebp),%edx
+  const uchar *s;
+  uint w, rep;
+
+  s = v;
+  c = (uchar)c;
+     479:	0f b6 75 0c          	movzbl 0xc(%ebp),%esi
+  for(; n > 0 && ((uint)s & 3); n--, s++)
+     47d:	eb 06                	jmp    485 <memchr+0x18>
+     47f:	83 ea 01             	sub    $0x1,%edx
+     482:	83 c0 01             	add    $0x1,%eax
+     485:	85 d2                	test   %edx,%edx
+     487:	74 0d                	je     496 <memchr+0x29>
+     489:	a8 03                	test   $0x3,%al
+     48b:	74 09                	je     496 <memchr+0x29>
+    if(*s == c)
+     48d:	0f b6 08             	movzbl (%eax),%ecx
+     490:	39 f1                	cmp    %esi,%ecx
+     492:	75 eb                	jne    47f <memchr+0x12>
+     494:	eb 41                	jmp    4d7 <memchr+0x6a>
+      return (void*)s;
+  rep = c * 0x01010101;
+     496:	69 fe 01 01 01 01    	imul   $0x1010101,%esi,%edi
+  for(; n >= 4; n -= 4, s += 4){
+     49c:	eb 06                	jmp    4a4 <memchr+0x37>
+     49e:	83 ea 04             	sub    $0x4,%edx
+     4a1:	83 c0 04             	add    $0x4,%eax
+     4a4:	83 fa 03             	cmp    $0x3,%edx
+     4a7:	76 16                	jbe    4bf <memchr+0x52>
+    w = *(uint*)s ^ rep;
+     4a9:	89 f9                	mov    %edi,%ecx
+     4ab:	33 08                	xor    (%eax),%ecx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     4ad:	8d 99 ff fe fe fe    	lea    -0x1010101(%ecx),%ebx
+     4b3:	f7 d1                	not    %ecx
+     4b5:	21 cb                	and    %ecx,%ebx
+     4b7:	f7 c3 80 80 80 80    	test   $0x80808080,%ebx
+     4bd:	74 df                	je     49e <memchr+0x31>
+      break;
+  }
+  for(; n > 0; n--, s++)
+     4bf:	85 d2                	test   %edx,%edx
+     4c1:	74 0f                	je     4d2 <memchr+0x65>
+    if(*s == c)
+     4c3:	0f b6 08             	movzbl (%eax),%ecx
+     4c6:	39 f1                	cmp    %esi,%ecx
+     4c8:	74 0d                	je     4d7 <memchr+0x6a>
+  for(; n > 0; n--, s++)
+     4ca:	83 ea 01             	sub    $0x1,%edx
+     4cd:	83 c0 01             	add    $0x1,%eax
+     4d0:	eb ed                	jmp    4bf <memchr+0x52>
+      return (void*)s;
+  return 0;
+     4d2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     4d7:	5b                   	pop    %ebx
+     4d8:	5e                   	pop    %esi
+     4d9:	5f                   	pop    %edi
+     4da:	5d                   	pop    %ebp
+     4db:	c3                   	ret
+
+000004dc <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     4dc:	55                   	push   %ebp
+     4dd:	89 e5                	mov    %esp,%ebp
+     4df:	57                   	push   %edi
+     4e0:	56                   	push   %esi
+     4e1:	53                   	push   %ebx
+     4e2:	83 ec 1c             	sub    $0x1c,%esp
+     4e5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     4e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+     4ed:	89 de                	mov    %ebx,%esi
+     4ef:	83 c3 01             	add    $0x1,%ebx
+     4f2:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     4f5:	7d 2e                	jge    525 <gets+0x49>
+    cc = read(0, &c, 1);
+     4f7:	83 ec 04             	sub    $0x4,%esp
+     4fa:	6a 01                	push   $0x1
+     4fc:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     4ff:	50                   	push   %eax
+     500:	6a 00                	push   $0x0
+     502:	e8 51 05 00 00       	call   a58 <read>
+    if(cc < 1)
+     507:	83 c4 10             	add    $0x10,%esp
+     50a:	85 c0                	test   %eax,%eax
+     50c:	7e 17                	jle    525 <gets+0x49>
+      break;
+    buf[i++] = c;
+     50e:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     512:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+     515:	3c 0a                	cmp    $0xa,%al
+     517:	0f 94 c2             	sete   %dl
+     51a:	3c 0d                	cmp    $0xd,%al
+     51c:	0f 94 c0             	sete   %al
+     51f:	08 c2                	or     %al,%dl
+     521:	74 ca                	je     4ed <gets+0x11>
+    buf[i++] = c;
+     523:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+     525:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+     529:	89 f8                	mov    %edi,%eax
+     52b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     52e:	5b                   	pop    %ebx
+     52f:	5e                   	pop    %esi
+     530:	5f                   	pop    %edi
+     531:	5d                   	pop    %ebp
+     532:	c3                   	ret
+
+00000533 <atoi>:
+  return r;
+}
+
+int
+atoi(const char *s)
+{
+     533:	55                   	push   %ebp
+     534:	89 e5                	mov    %esp,%ebp
+     536:	53                   	push   %ebx
+     537:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+     53a:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+     53f:	eb 10                	jmp    551 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+     541:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+     544:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+     547:	83 c1 01             	add    $0x1,%ecx
+     54a:	0f be c0             	movsbl %al,%eax
+     54d:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+     551:	0f b6 01             	movzbl (%ecx),%eax
+     554:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     557:	80 fb 09             	cmp    $0x9,%bl
+     55a:	76 e5                	jbe    541 <atoi+0xe>
+  return n;
+}
+     55c:	89 d0                	mov    %edx,%eax
+     55e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     561:	c9                   	leave
+     562:	c3                   	ret
+
+00000563 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     563:	55                   	push   %ebp
+     564:	89 e5                	mov    %esp,%ebp
+     566:	57                   	push   %edi
+     567:	56                   	push   %esi
+     568:	53                   	push   %ebx
+     569:	83 ec 08             	sub    $0x8,%esp
+     56c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     56f:	8b 55 0c             	mov    0xc(%ebp),%edx
+     572:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *src;
+  int h;
+
+  dst = vdst;
+  src = vsrc;
+  if(n <= 0)
+     575:	85 c0                	test   %eax,%eax
+     577:	0f 8e 82 00 00 00    	jle    5ff <memmove+0x9c>
+    return vdst;
+  if(src < dst && src + n > dst){
+     57d:	39 da                	cmp    %ebx,%edx
+     57f:	73 07                	jae    588 <memmove+0x25>
+     581:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+     584:	39 cb                	cmp    %ecx,%ebx
+     586:	72 5e                	jb     5e6 <memmove+0x83>
+    movsbback(dst + n - 1, src + n - 1, n);
+    return vdst;
+  }
+  if(n >= 16 && (((uint)dst ^ (uint)src) & 3) == 0){
+     588:	83 f8 0f             	cmp    $0xf,%eax
+     58b:	7e 69                	jle    5f6 <memmove+0x93>
+     58d:	89 d9                	mov    %ebx,%ecx
+     58f:	31 d1                	xor    %edx,%ecx
+     591:	f6 c1 03             	test   $0x3,%cl
+     594:	75 73                	jne    609 <memmove+0xa6>
+    h = -(uint)dst & 3;
+     596:	89 d9                	mov    %ebx,%ecx
+     598:	f7 d9                	neg    %ecx
+     59a:	83 e1 03             	and    $0x3,%ecx
+}
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsb" :
+     59d:	89 df                	mov    %ebx,%edi
+     59f:	89 d6                	mov    %edx,%esi
+     5a1:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+     5a4:	fc                   	cld
+     5a5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    movsb(dst, src, h);
+    dst += h, src += h, n -= h;
+     5a7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+     5aa:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+     5ad:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+     5b0:	29 f0                	sub    %esi,%eax
+    movsl(dst, src, n/4);
+     5b2:	8d 50 03             	lea    0x3(%eax),%edx
+     5b5:	0f 49 d0             	cmovns %eax,%edx
+     5b8:	c1 fa 02             	sar    $0x2,%edx
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+     5bb:	89 7d f0             	mov    %edi,-0x10(%ebp)
+     5be:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     5c1:	89 ce                	mov    %ecx,%esi
+     5c3:	89 d1                	mov    %edx,%ecx
+     5c5:	fc                   	cld
+     5c6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    dst += n/4*4, src += n/4*4, n %= 4;
+     5c8:	c1 e2 02             	shl    $0x2,%edx
+     5cb:	8b 7d f0             	mov    -0x10(%ebp),%edi
+     5ce:	01 d7                	add    %edx,%edi
+     5d0:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     5d3:	01 ca                	add    %ecx,%edx
+     5d5:	89 c6                	mov    %eax,%esi
+     5d7:	c1 fe 1f             	sar    $0x1f,%esi
+     5da:	c1 ee 1e             	shr    $0x1e,%esi
+     5dd:	01 f0                	add    %esi,%eax
+     5df:	83 e0 03             	and    $0x3,%eax
+     5e2:	29 f0                	sub    %esi,%eax
+     5e4:	eb 12                	jmp    5f8 <memmove+0x95>
+    movsbback(dst + n - 1, src + n - 1, n);
+     5e6:	8d 78 ff             	lea    -0x1(%eax),%edi
+     5e9:	8d 34 3a             	lea    (%edx,%edi,1),%esi
+     5ec:	01 df                	add    %ebx,%edi
+// Copy cnt bytes down from the last ones, at dst and src, to the
+// first: for overlapping moves up.
+static inline void
+movsbback(void *dst, const void *src, int cnt)
+{
+  asm volatile("std; rep movsb; cld" :
+     5ee:	89 c1                	mov    %eax,%ecx
+     5f0:	fd                   	std
+     5f1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     5f3:	fc                   	cld
+    return vdst;
+     5f4:	eb 09                	jmp    5ff <memmove+0x9c>
+  dst = vdst;
+     5f6:	89 df                	mov    %ebx,%edi
+  asm volatile("cld; rep movsb" :
+     5f8:	89 d6                	mov    %edx,%esi
+     5fa:	89 c1                	mov    %eax,%ecx
+     5fc:	fc                   	cld
+     5fd:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  }
+  movsb(dst, src, n);
+  return vdst;
+}
+     5ff:	89 d8                	mov    %ebx,%eax
+     601:	83 c4 08             	add    $0x8,%esp
+     604:	5b                   	pop    %ebx
+     605:	5e                   	pop    %esi
+     606:	5f                   	pop    %edi
+     607:	5d                   	pop    %ebp
+     608:	c3                   	ret
+  dst = vdst;
+     609:	89 df                	mov    %ebx,%edi
+     60b:	eb eb                	jmp    5f8 <memmove+0x95>
+
+0000060d <vclock_gettime>:
+
+// clock_gettime() without a system call: read the clock page
+// that the kernel maps at CLOCKPAGE (see clock.h).
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+     60d:	55                   	push   %ebp
+     60e:	89 e5                	mov    %esp,%ebp
+     610:	57                   	push   %edi
+     611:	56                   	push   %esi
+     612:	53                   	push   %ebx
+     613:	83 ec 14             	sub    $0x14,%esp
+  struct clockpage *cp = (struct clockpage*)CLOCKPAGE;
+  uint seq, rem, d;
+  uint64 tsc, ns, now;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+     616:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     61a:	0f 87 a3 00 00 00    	ja     6c3 <vclock_gettime+0xb6>
+    return -1;
+  do {
+    seq = cp->seq;
+     620:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+    __sync_synchronize();
+     625:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    tsc = cp->tsc;
+     62a:	8b 15 10 f0 ff 7f    	mov    0x7ffff010,%edx
+     630:	8b 1d 14 f0 ff 7f    	mov    0x7ffff014,%ebx
+    ns = cp->ns;
+     636:	8b 35 18 f0 ff 7f    	mov    0x7ffff018,%esi
+     63c:	8b 3d 1c f0 ff 7f    	mov    0x7ffff01c,%edi
+    __sync_synchronize();
+     642:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != cp->seq);
+     647:	89 c1                	mov    %eax,%ecx
+     649:	83 e1 01             	and    $0x1,%ecx
+     64c:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     64f:	75 cf                	jne    620 <vclock_gettime+0x13>
+     651:	8b 0d 00 f0 ff 7f    	mov    0x7ffff000,%ecx
+     657:	39 c1                	cmp    %eax,%ecx
+     659:	75 c5                	jne    620 <vclock_gettime+0x13>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+     65b:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     65e:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     661:	0f 31                	rdtsc
+     663:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     666:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     669:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  now = rdtsc();
+  // Less than a tick has passed since the update, so the delta
+  // fits in 32 bits.
+  d = now > tsc ? now - tsc : 0;
+     66c:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     66f:	19 d3                	sbb    %edx,%ebx
+     671:	73 07                	jae    67a <vclock_gettime+0x6d>
+     673:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+     676:	29 d8                	sub    %ebx,%eax
+     678:	89 c1                	mov    %eax,%ecx
+  ns += ((uint64)d * cp->mult) >> cp->shift;
+     67a:	89 c8                	mov    %ecx,%eax
+     67c:	f7 25 04 f0 ff 7f    	mull   0x7ffff004
+     682:	0f b6 0d 08 f0 ff 7f 	movzbl 0x7ffff008,%ecx
+     689:	0f ad d0             	shrd   %cl,%edx,%eax
+     68c:	d3 ea                	shr    %cl,%edx
+     68e:	f6 c1 20             	test   $0x20,%cl
+     691:	74 04                	je     697 <vclock_gettime+0x8a>
+     693:	89 d0                	mov    %edx,%eax
+     695:	31 d2                	xor    %edx,%edx
+     697:	01 f0                	add    %esi,%eax
+     699:	11 fa                	adc    %edi,%edx
+static inline uint
+divl(uint64 n, uint d, uint *r)
+{
+  uint q;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (*r) :
+     69b:	bb 00 ca 9a 3b       	mov    $0x3b9aca00,%ebx
+     6a0:	f7 f3                	div    %ebx
+  ts->tv_sec = divl(ns, 1000000000, &rem);
+     6a2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     6a5:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = rem;
+     6a7:	89 57 04             	mov    %edx,0x4(%edi)
+  if(clk == CLOCK_REALTIME)
+     6aa:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     6ae:	75 1a                	jne    6ca <vclock_gettime+0xbd>
+    ts->tv_sec += cp->boottime;
+     6b0:	03 05 0c f0 ff 7f    	add    0x7ffff00c,%eax
+     6b6:	89 07                	mov    %eax,(%edi)
+  return 0;
+     6b8:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     6bb:	83 c4 14             	add    $0x14,%esp
+     6be:	5b                   	pop    %ebx
+     6bf:	5e                   	pop    %esi
+     6c0:	5f                   	pop    %edi
+     6c1:	5d                   	pop    %ebp
+     6c2:	c3                   	ret
+    return -1;
+     6c3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     6c8:	eb f1                	jmp    6bb <vclock_gettime+0xae>
+  return 0;
+     6ca:	b8 00 00 00 00       	mov    $0x0,%eax
+     6cf:	eb ea                	jmp    6bb <vclock_gettime+0xae>
+
+000006d1 <flush>:
+
+// Write out fd's buffer, or with fd < 0 every buffer.
+// Returns -1 if a write fails.
+int
+flush(int fd)
+{
+     6d1:	55                   	push   %ebp
+     6d2:	89 e5                	mov    %esp,%ebp
+     6d4:	56                   	push   %esi
+     6d5:	53                   	push   %ebx
+     6d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  int r, n;
+
+  if(fd < 0){
+     6d9:	85 c0                	test   %eax,%eax
+     6db:	78 5d                	js     73a <flush+0x69>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+      if(flush(fd) < 0)
+        r = -1;
+    return r;
+  }
+  if(fd >= NOBUF || (n = obuf[fd].n) == 0)
+     6dd:	83 f8 0f             	cmp    $0xf,%eax
+     6e0:	7f 64                	jg     746 <flush+0x75>
+     6e2:	69 d0 08 02 00 00    	imul   $0x208,%eax,%edx
+     6e8:	8b b2 84 24 00 00    	mov    0x2484(%edx),%esi
+     6ee:	85 f6                	test   %esi,%esi
+     6f0:	74 59                	je     74b <flush+0x7a>
+    return 0;
+  obuf[fd].n = 0;
+     6f2:	c7 82 84 24 00 00 00 	movl   $0x0,0x2484(%edx)
+     6f9:	00 00 00 
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     6fc:	81 c2 88 24 00 00    	add    $0x2488,%edx
+     702:	83 ec 04             	sub    $0x4,%esp
+     705:	56                   	push   %esi
+     706:	52                   	push   %edx
+     707:	50                   	push   %eax
+     708:	e8 5a 03 00 00       	call   a67 <write>
+     70d:	83 c4 10             	add    $0x10,%esp
+     710:	39 f0                	cmp    %esi,%eax
+     712:	75 40                	jne    754 <flush+0x83>
+     714:	be 00 00 00 00       	mov    $0x0,%esi
+     719:	eb 30                	jmp    74b <flush+0x7a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     71b:	83 c3 01             	add    $0x1,%ebx
+     71e:	83 fb 0f             	cmp    $0xf,%ebx
+     721:	7f 28                	jg     74b <flush+0x7a>
+      if(flush(fd) < 0)
+     723:	83 ec 0c             	sub    $0xc,%esp
+     726:	53                   	push   %ebx
+     727:	e8 a5 ff ff ff       	call   6d1 <flush>
+     72c:	83 c4 10             	add    $0x10,%esp
+     72f:	85 c0                	test   %eax,%eax
+     731:	79 e8                	jns    71b <flush+0x4a>
+        r = -1;
+     733:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     738:	eb e1                	jmp    71b <flush+0x4a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     73a:	be 00 00 00 00       	mov    $0x0,%esi
+     73f:	bb 00 00 00 00       	mov    $0x0,%ebx
+     744:	eb d8                	jmp    71e <flush+0x4d>
+    return 0;
+     746:	be 00 00 00 00       	mov    $0x0,%esi
+}
+     74b:	89 f0                	mov    %esi,%eax
+     74d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     750:	5b                   	pop    %ebx
+     751:	5e                   	pop    %esi
+     752:	5d                   	pop    %ebp
+     753:	c3                   	ret
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     754:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     759:	eb f0                	jmp    74b <flush+0x7a>
+
+0000075b <bufreset>:
+
+static void
+bufreset(int fd)
+{
+  if(fd >= 0 && fd < NOBUF){
+     75b:	83 f8 0f             	cmp    $0xf,%eax
+     75e:	76 01                	jbe    761 <bufreset+0x6>
+     760:	c3                   	ret
+{
+     761:	55                   	push   %ebp
+     762:	89 e5                	mov    %esp,%ebp
+     764:	53                   	push   %ebx
+     765:	83 ec 10             	sub    $0x10,%esp
+     768:	89 c3                	mov    %eax,%ebx
+    flush(fd);
+     76a:	50                   	push   %eax
+     76b:	e8 61 ff ff ff       	call   6d1 <flush>
+    obuf[fd].mode = BUNKNOWN;
+     770:	69 db 08 02 00 00    	imul   $0x208,%ebx,%ebx
+     776:	c7 83 80 24 00 00 00 	movl   $0x0,0x2480(%ebx)
+     77d:	00 00 00 
+     780:	83 c4 10             	add    $0x10,%esp
+  }
+}
+     783:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     786:	c9                   	leave
+     787:	c3                   	ret
+
+00000788 <bufwrite>:
+
+// Write n bytes from p to fd, through its buffer.
+// Returns n, or -1 if a write fails.
+int
+bufwrite(int fd, const void *p, int n)
+{
+     788:	55                   	push   %ebp
+     789:	89 e5                	mov    %esp,%ebp
+     78b:	57                   	push   %edi
+     78c:	56                   	push   %esi
+     78d:	53                   	push   %ebx
+     78e:	83 ec 3c             	sub    $0x3c,%esp
+     791:	8b 75 08             	mov    0x8(%ebp),%esi
+     794:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct stat st;
+  const char *s;
+  int i;
+
+  if(fd < 0 || fd >= NOBUF)
+     797:	83 fe 0f             	cmp    $0xf,%esi
+     79a:	0f 87 a2 00 00 00    	ja     842 <bufwrite+0xba>
+    return write(fd, p, n);
+  if(obuf[fd].mode == BUNKNOWN){
+     7a0:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     7a6:	83 b8 80 24 00 00 00 	cmpl   $0x0,0x2480(%eax)
+     7ad:	75 19                	jne    7c8 <bufwrite+0x40>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     7af:	83 fe 02             	cmp    $0x2,%esi
+     7b2:	0f 85 9c 00 00 00    	jne    854 <bufwrite+0xcc>
+      obuf[fd].mode = BNONE;
+     7b8:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     7be:	c7 80 80 24 00 00 01 	movl   $0x1,0x2480(%eax)
+     7c5:	00 00 00 
+    else
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+  }
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     7c8:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     7ce:	89 da                	mov    %ebx,%edx
+     7d0:	03 90 84 24 00 00    	add    0x2484(%eax),%edx
+     7d6:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+     7dc:	0f 8f ae 00 00 00    	jg     890 <bufwrite+0x108>
+    return -1;
+  if(n >= OBUFSZ)
+     7e2:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+     7e8:	0f 8f bd 00 00 00    	jg     8ab <bufwrite+0x123>
+    return write(fd, p, n);
+  memmove(obuf[fd].buf + obuf[fd].n, p, n);
+     7ee:	69 d6 08 02 00 00    	imul   $0x208,%esi,%edx
+     7f4:	8d ba 80 24 00 00    	lea    0x2480(%edx),%edi
+     7fa:	8b 82 84 24 00 00    	mov    0x2484(%edx),%eax
+     800:	83 ec 04             	sub    $0x4,%esp
+     803:	53                   	push   %ebx
+     804:	ff 75 0c             	push   0xc(%ebp)
+     807:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     80a:	8d 84 10 88 24 00 00 	lea    0x2488(%eax,%edx,1),%eax
+     811:	50                   	push   %eax
+     812:	e8 4c fd ff ff       	call   563 <memmove>
+  obuf[fd].n += n;
+     817:	01 5f 04             	add    %ebx,0x4(%edi)
+  if(obuf[fd].mode == BNONE)
+     81a:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     81d:	8b 82 80 24 00 00    	mov    0x2480(%edx),%eax
+     823:	83 c4 10             	add    $0x10,%esp
+     826:	83 f8 01             	cmp    $0x1,%eax
+     829:	0f 84 91 00 00 00    	je     8c0 <bufwrite+0x138>
+    return flush(fd) < 0 ? -1 : n;
+  if(obuf[fd].mode == BLINE)
+     82f:	83 f8 02             	cmp    $0x2,%eax
+     832:	0f 84 ca 00 00 00    	je     902 <bufwrite+0x17a>
+    for(s = p, i = 0; i < n; i++)
+      if(s[i] == '\n')
+        return flush(fd) < 0 ? -1 : n;
+  return n;
+     838:	89 d8                	mov    %ebx,%eax
+}
+     83a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     83d:	5b                   	pop    %ebx
+     83e:	5e                   	pop    %esi
+     83f:	5f                   	pop    %edi
+     840:	5d                   	pop    %ebp
+     841:	c3                   	ret
+    return write(fd, p, n);
+     842:	83 ec 04             	sub    $0x4,%esp
+     845:	53                   	push   %ebx
+     846:	ff 75 0c             	push   0xc(%ebp)
+     849:	56                   	push   %esi
+     84a:	e8 18 02 00 00       	call   a67 <write>
+     84f:	83 c4 10             	add    $0x10,%esp
+     852:	eb e6                	jmp    83a <bufwrite+0xb2>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     854:	83 ec 08             	sub    $0x8,%esp
+     857:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     85a:	50                   	push   %eax
+     85b:	56                   	push   %esi
+     85c:	e8 51 02 00 00       	call   ab2 <fstat>
+     861:	83 c4 10             	add    $0x10,%esp
+     864:	85 c0                	test   %eax,%eax
+     866:	0f 88 4c ff ff ff    	js     7b8 <bufwrite+0x30>
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+     86c:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     871:	74 16                	je     889 <bufwrite+0x101>
+     873:	ba 03 00 00 00       	mov    $0x3,%edx
+     878:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     87e:	89 90 80 24 00 00    	mov    %edx,0x2480(%eax)
+     884:	e9 3f ff ff ff       	jmp    7c8 <bufwrite+0x40>
+     889:	ba 02 00 00 00       	mov    $0x2,%edx
+     88e:	eb e8                	jmp    878 <bufwrite+0xf0>
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     890:	83 ec 0c             	sub    $0xc,%esp
+     893:	56                   	push   %esi
+     894:	e8 38 fe ff ff       	call   6d1 <flush>
+     899:	83 c4 10             	add    $0x10,%esp
+     89c:	85 c0                	test   %eax,%eax
+     89e:	0f 89 3e ff ff ff    	jns    7e2 <bufwrite+0x5a>
+    return -1;
+     8a4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     8a9:	eb 8f                	jmp    83a <bufwrite+0xb2>
+    return write(fd, p, n);
+     8ab:	83 ec 04             	sub    $0x4,%esp
+     8ae:	53                   	push   %ebx
+     8af:	ff 75 0c             	push   0xc(%ebp)
+     8b2:	56                   	push   %esi
+     8b3:	e8 af 01 00 00       	call   a67 <write>
+     8b8:	83 c4 10             	add    $0x10,%esp
+     8bb:	e9 7a ff ff ff       	jmp    83a <bufwrite+0xb2>
+    return flush(fd) < 0 ? -1 : n;
+     8c0:	83 ec 0c             	sub    $0xc,%esp
+     8c3:	56                   	push   %esi
+     8c4:	e8 08 fe ff ff       	call   6d1 <flush>
+     8c9:	83 c4 10             	add    $0x10,%esp
+     8cc:	85 c0                	test   %eax,%eax
+     8ce:	78 07                	js     8d7 <bufwrite+0x14f>
+     8d0:	89 d8                	mov    %ebx,%eax
+     8d2:	e9 63 ff ff ff       	jmp    83a <bufwrite+0xb2>
+     8d7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     8dc:	e9 59 ff ff ff       	jmp    83a <bufwrite+0xb2>
+        return flush(fd) < 0 ? -1 : n;
+     8e1:	83 ec 0c             	sub    $0xc,%esp
+     8e4:	56                   	push   %esi
+     8e5:	e8 e7 fd ff ff       	call   6d1 <flush>
+     8ea:	83 c4 10             	add    $0x10,%esp
+     8ed:	85 c0                	test   %eax,%eax
+     8ef:	78 07                	js     8f8 <bufwrite+0x170>
+     8f1:	89 d8                	mov    %ebx,%eax
+     8f3:	e9 42 ff ff ff       	jmp    83a <bufwrite+0xb2>
+     8f8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     8fd:	e9 38 ff ff ff       	jmp    83a <bufwrite+0xb2>
+    for(s = p, i = 0; i < n; i++)
+     902:	b8 00 00 00 00       	mov    $0x0,%eax
+     907:	39 d8                	cmp    %ebx,%eax
+     909:	7d 0e                	jge    919 <bufwrite+0x191>
+      if(s[i] == '\n')
+     90b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     90e:	80 3c 01 0a          	cmpb   $0xa,(%ecx,%eax,1)
+     912:	74 cd                	je     8e1 <bufwrite+0x159>
+    for(s = p, i = 0; i < n; i++)
+     914:	83 c0 01             	add    $0x1,%eax
+     917:	eb ee                	jmp    907 <bufwrite+0x17f>
+  return n;
+     919:	89 d8                	mov    %ebx,%eax
+     91b:	e9 1a ff ff ff       	jmp    83a <bufwrite+0xb2>
+
+00000920 <fork>:
+
+int
+fork(void)
+{
+     920:	55                   	push   %ebp
+     921:	89 e5                	mov    %esp,%ebp
+     923:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     926:	6a ff                	push   $0xffffffff
+     928:	e8 a4 fd ff ff       	call   6d1 <flush>
+  return _fork();
+     92d:	e8 bd 00 00 00       	call   9ef <_fork>
+}
+     932:	c9                   	leave
+     933:	c3                   	ret
+
+00000934 <exit>:
+
+int
+exit(void)
+{
+     934:	55                   	push   %ebp
+     935:	89 e5                	mov    %esp,%ebp
+     937:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     93a:	6a ff                	push   $0xffffffff
+     93c:	e8 90 fd ff ff       	call   6d1 <flush>
+  _exit();
+     941:	e8 b8 00 00 00       	call   9fe <_exit>
+
+00000946 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     946:	55                   	push   %ebp
+     947:	89 e5                	mov    %esp,%ebp
+     949:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     94c:	6a ff                	push   $0xffffffff
+     94e:	e8 7e fd ff ff       	call   6d1 <flush>
+  return _exec(path, argv);
+     953:	83 c4 08             	add    $0x8,%esp
+     956:	ff 75 0c             	push   0xc(%ebp)
+     959:	ff 75 08             	push   0x8(%ebp)
+     95c:	e8 bb 00 00 00       	call   a1c <_exec>
+}
+     961:	c9                   	leave
+     962:	c3                   	ret
+
+00000963 <close>:
+
+int
+close(int fd)
+{
+     963:	55                   	push   %ebp
+     964:	89 e5                	mov    %esp,%ebp
+     966:	53                   	push   %ebx
+     967:	83 ec 04             	sub    $0x4,%esp
+     96a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bufreset(fd);
+     96d:	89 d8                	mov    %ebx,%eax
+     96f:	e8 e7 fd ff ff       	call   75b <bufreset>
+  return _close(fd);
+     974:	83 ec 0c             	sub    $0xc,%esp
+     977:	53                   	push   %ebx
+     978:	e8 90 00 00 00       	call   a0d <_close>
+}
+     97d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     980:	c9                   	leave
+     981:	c3                   	ret
+
+00000982 <stat>:
+{
+     982:	55                   	push   %ebp
+     983:	89 e5                	mov    %esp,%ebp
+     985:	56                   	push   %esi
+     986:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     987:	83 ec 08             	sub    $0x8,%esp
+     98a:	6a 00                	push   $0x0
+     98c:	ff 75 08             	push   0x8(%ebp)
+     98f:	e8 f1 00 00 00       	call   a85 <open>
+  if(fd < 0)
+     994:	83 c4 10             	add    $0x10,%esp
+     997:	85 c0                	test   %eax,%eax
+     999:	78 24                	js     9bf <stat+0x3d>
+     99b:	89 c3                	mov    %eax,%ebx
+  r = fstat(fd, st);
+     99d:	83 ec 08             	sub    $0x8,%esp
+     9a0:	ff 75 0c             	push   0xc(%ebp)
+     9a3:	50                   	push   %eax
+     9a4:	e8 09 01 00 00       	call   ab2 <fstat>
+     9a9:	89 c6                	mov    %eax,%esi
+  close(fd);
+     9ab:	89 1c 24             	mov    %ebx,(%esp)
+     9ae:	e8 b0 ff ff ff       	call   963 <close>
+  return r;
+     9b3:	83 c4 10             	add    $0x10,%esp
+}
+     9b6:	89 f0                	mov    %esi,%eax
+     9b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     9bb:	5b                   	pop    %ebx
+     9bc:	5e                   	pop    %esi
+     9bd:	5d                   	pop    %ebp
+     9be:	c3                   	ret
+    return -1;
+     9bf:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     9c4:	eb f0                	jmp    9b6 <stat+0x34>
+
+000009c6 <dup2>:
+
+int
+dup2(int oldfd, int newfd)
+{
+     9c6:	55                   	push   %ebp
+     9c7:	89 e5                	mov    %esp,%ebp
+     9c9:	56                   	push   %esi
+     9ca:	53                   	push   %ebx
+     9cb:	8b 75 08             	mov    0x8(%ebp),%esi
+     9ce:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(oldfd != newfd)
+     9d1:	39 de                	cmp    %ebx,%esi
+     9d3:	75 11                	jne    9e6 <dup2+0x20>
+    bufreset(newfd);
+  return _dup2(oldfd, newfd);
+     9d5:	83 ec 08             	sub    $0x8,%esp
+     9d8:	53                   	push   %ebx
+     9d9:	56                   	push   %esi
+     9da:	e8 4c 00 00 00       	call   a2b <_dup2>
+}
+     9df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     9e2:	5b                   	pop    %ebx
+     9e3:	5e                   	pop    %esi
+     9e4:	5d                   	pop    %ebp
+     9e5:	c3                   	ret
+    bufreset(newfd);
+     9e6:	89 d8                	mov    %ebx,%eax
+     9e8:	e8 6e fd ff ff       	call   75b <bufreset>
+     9ed:	eb e6                	jmp    9d5 <dup2+0xf>
+
+000009ef <_fork>:
+  1: ret
+
+#define SYSCALL(name) STUB(name, SYS_ ## name)
+
+# ulib.c wraps these, to flush printf()'s buffers first.
+STUB(_fork, SYS_fork)
+     9ef:	b8 01 00 00 00       	mov    $0x1,%eax
+     9f4:	89 e1                	mov    %esp,%ecx
+     9f6:	ba fd 09 00 00       	mov    $0x9fd,%edx
+     9fb:	0f 34                	sysenter
+     9fd:	c3                   	ret
+
+000009fe <_exit>:
+STUB(_exit, SYS_exit)
+     9fe:	b8 02 00 00 00       	mov    $0x2,%eax
+     a03:	89 e1                	mov    %esp,%ecx
+     a05:	ba 0c 0a 00 00       	mov    $0xa0c,%edx
+     a0a:	0f 34                	sysenter
+     a0c:	c3                   	ret
+
+00000a0d <_close>:
+STUB(_close, SYS_close)
+     a0d:	b8 15 00 00 00       	mov    $0x15,%eax
+     a12:	89 e1                	mov    %esp,%ecx
+     a14:	ba 1b 0a 00 00       	mov    $0xa1b,%edx
+     a19:	0f 34                	sysenter
+     a1b:	c3                   	ret
+
+00000a1c <_exec>:
+STUB(_exec, SYS_exec)
+     a1c:	b8 07 00 00 00       	mov    $0x7,%eax
+     a21:	89 e1                	mov    %esp,%ecx
+     a23:	ba 2a 0a 00 00       	mov    $0xa2a,%edx
+     a28:	0f 34                	sysenter
+     a2a:	c3                   	ret
+
+00000a2b <_dup2>:
+STUB(_dup2, SYS_dup2)
+     a2b:	b8 17 00 00 00       	mov    $0x17,%eax
+     a30:	89 e1                	mov    %esp,%ecx
+     a32:	ba 39 0a 00 00       	mov    $0xa39,%edx
+     a37:	0f 34                	sysenter
+     a39:	c3                   	ret
+
+00000a3a <wait>:
+
+SYSCALL(wait)
+     a3a:	b8 03 00 00 00       	mov    $0x3,%eax
+     a3f:	89 e1                	mov    %esp,%ecx
+     a41:	ba 48 0a 00 00       	mov    $0xa48,%edx
+     a46:	0f 34                	sysenter
+     a48:	c3                   	ret
+
+00000a49 <pipe>:
+SYSCALL(pipe)
+     a49:	b8 04 00 00 00       	mov    $0x4,%eax
+     a4e:	89 e1                	mov    %esp,%ecx
+     a50:	ba 57 0a 00 00       	mov    $0xa57,%edx
+     a55:	0f 34                	sysenter
+     a57:	c3                   	ret
+
+00000a58 <read>:
+SYSCALL(read)
+     a58:	b8 05 00 00 00       	mov    $0x5,%eax
+     a5d:	89 e1                	mov    %esp,%ecx
+     a5f:	ba 66 0a 00 00       	mov    $0xa66,%edx
+     a64:	0f 34                	sysenter
+     a66:	c3                   	ret
+
+00000a67 <write>:
+SYSCALL(write)
+     a67:	b8 10 00 00 00       	mov    $0x10,%eax
+     a6c:	89 e1                	mov    %esp,%ecx
+     a6e:	ba 75 0a 00 00       	mov    $0xa75,%edx
+     a73:	0f 34                	sysenter
+     a75:	c3                   	ret
+
+00000a76 <kill>:
+SYSCALL(kill)
+     a76:	b8 06 00 00 00       	mov    $0x6,%eax
+     a7b:	89 e1                	mov    %esp,%ecx
+     a7d:	ba 84 0a 00 00       	mov    $0xa84,%edx
+     a82:	0f 34                	sysenter
+     a84:	c3                   	ret
+
+00000a85 <open>:
+SYSCALL(open)
+     a85:	b8 0f 00 00 00       	mov    $0xf,%eax
+     a8a:	89 e1                	mov    %esp,%ecx
+     a8c:	ba 93 0a 00 00       	mov    $0xa93,%edx
+     a91:	0f 34                	sysenter
+     a93:	c3                   	ret
+
+00000a94 <mknod>:
+SYSCALL(mknod)
+     a94:	b8 11 00 00 00       	mov    $0x11,%eax
+     a99:	89 e1                	mov    %esp,%ecx
+     a9b:	ba a2 0a 00 00       	mov    $0xaa2,%edx
+     aa0:	0f 34                	sysenter
+     aa2:	c3                   	ret
+
+00000aa3 <unlink>:
+SYSCALL(unlink)
+     aa3:	b8 12 00 00 00       	mov    $0x12,%eax
+     aa8:	89 e1                	mov    %esp,%ecx
+     aaa:	ba b1 0a 00 00       	mov    $0xab1,%edx
+     aaf:	0f 34                	sysenter
+     ab1:	c3                   	ret
+
+00000ab2 <fstat>:
+SYSCALL(fstat)
+     ab2:	b8 08 00 00 00       	mov    $0x8,%eax
+     ab7:	89 e1                	mov    %esp,%ecx
+     ab9:	ba c0 0a 00 00       	mov    $0xac0,%edx
+     abe:	0f 34                	sysenter
+     ac0:	c3                   	ret
+
+00000ac1 <link>:
+SYSCALL(link)
+     ac1:	b8 13 00 00 00       	mov    $0x13,%eax
+     ac6:	89 e1                	mov    %esp,%ecx
+     ac8:	ba cf 0a 00 00       	mov    $0xacf,%edx
+     acd:	0f 34                	sysenter
+     acf:	c3                   	ret
+
+00000ad0 <mkdir>:
+SYSCALL(mkdir)
+     ad0:	b8 14 00 00 00       	mov    $0x14,%eax
+     ad5:	89 e1                	mov    %esp,%ecx
+     ad7:	ba de 0a 00 00       	mov    $0xade,%edx
+     adc:	0f 34                	sysenter
+     ade:	c3                   	ret
+
+00000adf <chdir>:
+SYSCALL(chdir)
+     adf:	b8 09 00 00 00       	mov    $0x9,%eax
+     ae4:	89 e1                	mov    %esp,%ecx
+     ae6:	ba ed 0a 00 00       	mov    $0xaed,%edx
+     aeb:	0f 34                	sysenter
+     aed:	c3                   	ret
+
+00000aee <dup>:
+SYSCALL(dup)
+     aee:	b8 0a 00 00 00       	mov    $0xa,%eax
+     af3:	89 e1                	mov    %esp,%ecx
+     af5:	ba fc 0a 00 00       	mov    $0xafc,%edx
+     afa:	0f 34                	sysenter
+     afc:	c3                   	ret
+
+00000afd <getpid>:
+SYSCALL(getpid)
+     afd:	b8 0b 00 00 00       	mov    $0xb,%eax
+     b02:	89 e1                	mov    %esp,%ecx
+     b04:	ba 0b 0b 00 00       	mov    $0xb0b,%edx
+     b09:	0f 34                	sysenter
+     b0b:	c3                   	ret
+
+00000b0c <sbrk>:
+SYSCALL(sbrk)
+     b0c:	b8 0c 00 00 00       	mov    $0xc,%eax
+     b11:	89 e1                	mov    %esp,%ecx
+     b13:	ba 1a 0b 00 00       	mov    $0xb1a,%edx
+     b18:	0f 34                	sysenter
+     b1a:	c3                   	ret
+
+00000b1b <sleep>:
+SYSCALL(sleep)
+     b1b:	b8 0d 00 00 00       	mov    $0xd,%eax
+     b20:	89 e1                	mov    %esp,%ecx
+     b22:	ba 29 0b 00 00       	mov    $0xb29,%edx
+     b27:	0f 34                	sysenter
+     b29:	c3                   	ret
+
+00000b2a <uptime>:
+SYSCALL(uptime)
+     b2a:	b8 0e 00 00 00       	mov    $0xe,%eax
+     b2f:	89 e1                	mov    %esp,%ecx
+     b31:	ba 38 0b 00 00       	mov    $0xb38,%edx
+     b36:	0f 34                	sysenter
+     b38:	c3                   	ret
+
+00000b39 <date>:
+SYSCALL(date)
+     b39:	b8 16 00 00 00       	mov    $0x16,%eax
+     b3e:	89 e1                	mov    %esp,%ecx
+     b40:	ba 47 0b 00 00       	mov    $0xb47,%edx
+     b45:	0f 34                	sysenter
+     b47:	c3                   	ret
+
+00000b48 <faultaround>:
+SYSCALL(faultaround)
+     b48:	b8 18 00 00 00       	mov    $0x18,%eax
+     b4d:	89 e1                	mov    %esp,%ecx
+     b4f:	ba 56 0b 00 00       	mov    $0xb56,%edx
+     b54:	0f 34                	sysenter
+     b56:	c3                   	ret
+
+00000b57 <faultstat>:
+SYSCALL(faultstat)
+     b57:	b8 19 00 00 00       	mov    $0x19,%eax
+     b5c:	89 e1                	mov    %esp,%ecx
+     b5e:	ba 65 0b 00 00       	mov    $0xb65,%edx
+     b63:	0f 34                	sysenter
+     b65:	c3                   	ret
+
+00000b66 <mmap>:
+SYSCALL(mmap)
+     b66:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     b6b:	89 e1                	mov    %esp,%ecx
+     b6d:	ba 74 0b 00 00       	mov    $0xb74,%edx
+     b72:	0f 34                	sysenter
+     b74:	c3                   	ret
+
+00000b75 <munmap>:
+SYSCALL(munmap)
+     b75:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     b7a:	89 e1                	mov    %esp,%ecx
+     b7c:	ba 83 0b 00 00       	mov    $0xb83,%edx
+     b81:	0f 34                	sysenter
+     b83:	c3                   	ret
+
+00000b84 <largepages>:
+SYSCALL(largepages)
+     b84:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     b89:	89 e1                	mov    %esp,%ecx
+     b8b:	ba 92 0b 00 00       	mov    $0xb92,%edx
+     b90:	0f 34                	sysenter
+     b92:	c3                   	ret
+
+00000b93 <spawn>:
+SYSCALL(spawn)
+     b93:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     b98:	89 e1                	mov    %esp,%ecx
+     b9a:	ba a1 0b 00 00       	mov    $0xba1,%edx
+     b9f:	0f 34                	sysenter
+     ba1:	c3                   	ret
+
+00000ba2 <setpriority>:
+SYSCALL(setpriority)
+     ba2:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     ba7:	89 e1                	mov    %esp,%ecx
+     ba9:	ba b0 0b 00 00       	mov    $0xbb0,%edx
+     bae:	0f 34                	sysenter
+     bb0:	c3                   	ret
+
+00000bb1 <getpriority>:
+SYSCALL(getpriority)
+     bb1:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     bb6:	89 e1                	mov    %esp,%ecx
+     bb8:	ba bf 0b 00 00       	mov    $0xbbf,%edx
+     bbd:	0f 34                	sysenter
+     bbf:	c3                   	ret
+
+00000bc0 <getprocinfo>:
+SYSCALL(getprocinfo)
+     bc0:	b8 20 00 00 00       	mov    $0x20,%eax
+     bc5:	89 e1                	mov    %esp,%ecx
+     bc7:	ba ce 0b 00 00       	mov    $0xbce,%edx
+     bcc:	0f 34                	sysenter
+     bce:	c3                   	ret
+
+00000bcf <getcpuinfo>:
+SYSCALL(getcpuinfo)
+     bcf:	b8 21 00 00 00       	mov    $0x21,%eax
+     bd4:	89 e1                	mov    %esp,%ecx
+     bd6:	ba dd 0b 00 00       	mov    $0xbdd,%edx
+     bdb:	0f 34                	sysenter
+     bdd:	c3                   	ret
+
+00000bde <clone>:
+SYSCALL(clone)
+     bde:	b8 22 00 00 00       	mov    $0x22,%eax
+     be3:	89 e1                	mov    %esp,%ecx
+     be5:	ba ec 0b 00 00       	mov    $0xbec,%edx
+     bea:	0f 34                	sysenter
+     bec:	c3                   	ret
+
+00000bed <join>:
+SYSCALL(join)
+     bed:	b8 23 00 00 00       	mov    $0x23,%eax
+     bf2:	89 e1                	mov    %esp,%ecx
+     bf4:	ba fb 0b 00 00       	mov    $0xbfb,%edx
+     bf9:	0f 34                	sysenter
+     bfb:	c3                   	ret
+
+00000bfc <futex_wait>:
+SYSCALL(futex_wait)
+     bfc:	b8 24 00 00 00       	mov    $0x24,%eax
+     c01:	89 e1                	mov    %esp,%ecx
+     c03:	ba 0a 0c 00 00       	mov    $0xc0a,%edx
+     c08:	0f 34                	sysenter
+     c0a:	c3                   	ret
+
+00000c0b <futex_wake>:
+SYSCALL(futex_wake)
+     c0b:	b8 25 00 00 00       	mov    $0x25,%eax
+     c10:	89 e1                	mov    %esp,%ecx
+     c12:	ba 19 0c 00 00       	mov    $0xc19,%edx
+     c17:	0f 34                	sysenter
+     c19:	c3                   	ret
+
+00000c1a <setaffinity>:
+SYSCALL(setaffinity)
+     c1a:	b8 26 00 00 00       	mov    $0x26,%eax
+     c1f:	89 e1                	mov    %esp,%ecx
+     c21:	ba 28 0c 00 00       	mov    $0xc28,%edx
+     c26:	0f 34                	sysenter
+     c28:	c3                   	ret
+
+00000c29 <getaffinity>:
+SYSCALL(getaffinity)
+     c29:	b8 27 00 00 00       	mov    $0x27,%eax
+     c2e:	89 e1                	mov    %esp,%ecx
+     c30:	ba 37 0c 00 00       	mov    $0xc37,%edx
+     c35:	0f 34                	sysenter
+     c37:	c3                   	ret
+
+00000c38 <clock_gettime>:
+SYSCALL(clock_gettime)
+     c38:	b8 28 00 00 00       	mov    $0x28,%eax
+     c3d:	89 e1                	mov    %esp,%ecx
+     c3f:	ba 46 0c 00 00       	mov    $0xc46,%edx
+     c44:	0f 34                	sysenter
+     c46:	c3                   	ret
+
+00000c47 <msleep>:
+SYSCALL(msleep)
+     c47:	b8 29 00 00 00       	mov    $0x29,%eax
+     c4c:	89 e1                	mov    %esp,%ecx
+     c4e:	ba 55 0c 00 00       	mov    $0xc55,%edx
+     c53:	0f 34                	sysenter
+     c55:	c3                   	ret
+
+00000c56 <lockstat>:
+SYSCALL(lockstat)
+     c56:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     c5b:	89 e1                	mov    %esp,%ecx
+     c5d:	ba 64 0c 00 00       	mov    $0xc64,%edx
+     c62:	0f 34                	sysenter
+     c64:	c3                   	ret
+
+00000c65 <bstat>:
+SYSCALL(bstat)
+     c65:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     c6a:	89 e1                	mov    %esp,%ecx
+     c6c:	ba 73 0c 00 00       	mov    $0xc73,%edx
+     c71:	0f 34                	sysenter
+     c73:	c3                   	ret
+
+00000c74 <iostat>:
+SYSCALL(iostat)
+     c74:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     c79:	89 e1                	mov    %esp,%ecx
+     c7b:	ba 82 0c 00 00       	mov    $0xc82,%edx
+     c80:	0f 34                	sysenter
+     c82:	c3                   	ret
+
+00000c83 <fsync>:
+SYSCALL(fsync)
+     c83:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     c88:	89 e1                	mov    %esp,%ecx
+     c8a:	ba 91 0c 00 00       	mov    $0xc91,%edx
+     c8f:	0f 34                	sysenter
+     c91:	c3                   	ret
+
+00000c92 <pread>:
+SYSCALL(pread)
+     c92:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     c97:	89 e1                	mov    %esp,%ecx
+     c99:	ba a0 0c 00 00       	mov    $0xca0,%edx
+     c9e:	0f 34                	sysenter
+     ca0:	c3                   	ret
+
+00000ca1 <pwrite>:
+SYSCALL(pwrite)
+     ca1:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     ca6:	89 e1                	mov    %esp,%ecx
+     ca8:	ba af 0c 00 00       	mov    $0xcaf,%edx
+     cad:	0f 34                	sysenter
+     caf:	c3                   	ret
+
+00000cb0 <readv>:
+SYSCALL(readv)
+     cb0:	b8 30 00 00 00       	mov    $0x30,%eax
+     cb5:	89 e1                	mov    %esp,%ecx
+     cb7:	ba be 0c 00 00       	mov    $0xcbe,%edx
+     cbc:	0f 34                	sysenter
+     cbe:	c3                   	ret
+
+00000cbf <writev>:
+SYSCALL(writev)
+     cbf:	b8 31 00 00 00       	mov    $0x31,%eax
+     cc4:	89 e1                	mov    %esp,%ecx
+     cc6:	ba cd 0c 00 00       	mov    $0xccd,%edx
+     ccb:	0f 34                	sysenter
+     ccd:	c3                   	ret
+
+00000cce <sendfile>:
+SYSCALL(sendfile)
+     cce:	b8 32 00 00 00       	mov    $0x32,%eax
+     cd3:	89 e1                	mov    %esp,%ecx
+     cd5:	ba dc 0c 00 00       	mov    $0xcdc,%edx
+     cda:	0f 34                	sysenter
+     cdc:	c3                   	ret
+
+00000cdd <fcntl>:
+SYSCALL(fcntl)
+     cdd:	b8 33 00 00 00       	mov    $0x33,%eax
+     ce2:	89 e1                	mov    %esp,%ecx
+     ce4:	ba eb 0c 00 00       	mov    $0xceb,%edx
+     ce9:	0f 34                	sysenter
+     ceb:	c3                   	ret
+
+00000cec <mount>:
+SYSCALL(mount)
+     cec:	b8 34 00 00 00       	mov    $0x34,%eax
+     cf1:	89 e1                	mov    %esp,%ecx
+     cf3:	ba fa 0c 00 00       	mov    $0xcfa,%edx
+     cf8:	0f 34                	sysenter
+     cfa:	c3                   	ret
+
+00000cfb <getdents>:
+SYSCALL(getdents)
+     cfb:	b8 35 00 00 00       	mov    $0x35,%eax
+     d00:	89 e1                	mov    %esp,%ecx
+     d02:	ba 09 0d 00 00       	mov    $0xd09,%edx
+     d07:	0f 34                	sysenter
+     d09:	c3                   	ret
+
+00000d0a <fstatat>:
+SYSCALL(fstatat)
+     d0a:	b8 36 00 00 00       	mov    $0x36,%eax
+     d0f:	89 e1                	mov    %esp,%ecx
+     d11:	ba 18 0d 00 00       	mov    $0xd18,%edx
+     d16:	0f 34                	sysenter
+     d18:	c3                   	ret
+
+00000d19 <sysstat>:
+SYSCALL(sysstat)
+     d19:	b8 37 00 00 00       	mov    $0x37,%eax
+     d1e:	89 e1                	mov    %esp,%ecx
+     d20:	ba 27 0d 00 00       	mov    $0xd27,%edx
+     d25:	0f 34                	sysenter
+     d27:	c3                   	ret
+
+00000d28 <ringenter>:
+SYSCALL(ringenter)
+     d28:	b8 38 00 00 00       	mov    $0x38,%eax
+     d2d:	89 e1                	mov    %esp,%ecx
+     d2f:	ba 36 0d 00 00       	mov    $0xd36,%edx
+     d34:	0f 34                	sysenter
+     d36:	c3                   	ret
+
+00000d37 <trace>:
+SYSCALL(trace)
+     d37:	b8 39 00 00 00       	mov    $0x39,%eax
+     d3c:	89 e1                	mov    %esp,%ecx
+     d3e:	ba 45 0d 00 00       	mov    $0xd45,%edx
+     d43:	0f 34                	sysenter
+     d45:	c3                   	ret
+
+00000d46 <memstat>:
+SYSCALL(memstat)
+     d46:	b8 3a 00 00 00       	mov    $0x3a,%eax
+     d4b:	89 e1                	mov    %esp,%ecx
+     d4d:	ba 54 0d 00 00       	mov    $0xd54,%edx
+     d52:	0f 34                	sysenter
+     d54:	c3                   	ret
+
+00000d55 <shmget>:
+SYSCALL(shmget)
+     d55:	b8 3b 00 00 00       	mov    $0x3b,%eax
+     d5a:	89 e1                	mov    %esp,%ecx
+     d5c:	ba 63 0d 00 00       	mov    $0xd63,%edx
+     d61:	0f 34                	sysenter
+     d63:	c3                   	ret
+
+00000d64 <shmat>:
+SYSCALL(shmat)
+     d64:	b8 3c 00 00 00       	mov    $0x3c,%eax
+     d69:	89 e1                	mov    %esp,%ecx
+     d6b:	ba 72 0d 00 00       	mov    $0xd72,%edx
+     d70:	0f 34                	sysenter
+     d72:	c3                   	ret
+
+00000d73 <shmdt>:
+SYSCALL(shmdt)
+     d73:	b8 3d 00 00 00       	mov    $0x3d,%eax
+     d78:	89 e1                	mov    %esp,%ecx
+     d7a:	ba 81 0d 00 00       	mov    $0xd81,%edx
+     d7f:	0f 34                	sysenter
+     d81:	c3                   	ret
+
+00000d82 <irqstat>:
+SYSCALL(irqstat)
+     d82:	b8 3e 00 00 00       	mov    $0x3e,%eax
+     d87:	89 e1                	mov    %esp,%ecx
+     d89:	ba 90 0d 00 00       	mov    $0xd90,%edx
+     d8e:	0f 34                	sysenter
+     d90:	c3                   	ret
+
+00000d91 <irqroute>:
+SYSCALL(irqroute)
+     d91:	b8 3f 00 00 00       	mov    $0x3f,%eax
+     d96:	89 e1                	mov    %esp,%ecx
+     d98:	ba 9f 0d 00 00       	mov    $0xd9f,%edx
+     d9d:	0f 34                	sysenter
+     d9f:	c3                   	ret
+
+00000da0 <putc>:
+  char buf[64];
+};
+
+static void
+putc(struct out *o, char c)
+{
+     da0:	55                   	push   %ebp
+     da1:	89 e5                	mov    %esp,%ebp
+     da3:	56                   	push   %esi
+     da4:	53                   	push   %ebx
+     da5:	89 c3                	mov    %eax,%ebx
+     da7:	89 d6                	mov    %edx,%esi
+  if(o->n == sizeof(o->buf)){
+     da9:	8b 40 04             	mov    0x4(%eax),%eax
+     dac:	83 f8 40             	cmp    $0x40,%eax
+     daf:	74 16                	je     dc7 <putc+0x27>
+    bufwrite(o->fd, o->buf, o->n);
+    o->n = 0;
+  }
+  o->buf[o->n++] = c;
+     db1:	8b 43 04             	mov    0x4(%ebx),%eax
+     db4:	8d 50 01             	lea    0x1(%eax),%edx
+     db7:	89 53 04             	mov    %edx,0x4(%ebx)
+     dba:	89 f1                	mov    %esi,%ecx
+     dbc:	88 4c 03 08          	mov    %cl,0x8(%ebx,%eax,1)
+}
+     dc0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     dc3:	5b                   	pop    %ebx
+     dc4:	5e                   	pop    %esi
+     dc5:	5d                   	pop    %ebp
+     dc6:	c3                   	ret
+    bufwrite(o->fd, o->buf, o->n);
+     dc7:	8d 53 08             	lea    0x8(%ebx),%edx
+     dca:	83 ec 04             	sub    $0x4,%esp
+     dcd:	50                   	push   %eax
+     dce:	52                   	push   %edx
+     dcf:	ff 33                	push   (%ebx)
+     dd1:	e8 b2 f9 ff ff       	call   788 <bufwrite>
+    o->n = 0;
+     dd6:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     ddd:	83 c4 10             	add    $0x10,%esp
+     de0:	eb cf                	jmp    db1 <putc+0x11>
+
+00000de2 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     de2:	55                   	push   %ebp
+     de3:	89 e5                	mov    %esp,%ebp
+     de5:	57                   	push   %edi
+     de6:	56                   	push   %esi
+     de7:	53                   	push   %ebx
+     de8:	83 ec 2c             	sub    $0x2c,%esp
+     deb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     dee:	89 d0                	mov    %edx,%eax
+     df0:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+     df2:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     df6:	0f 95 c1             	setne  %cl
+     df9:	c1 ea 1f             	shr    $0x1f,%edx
+     dfc:	84 d1                	test   %dl,%cl
+     dfe:	74 44                	je     e44 <printint+0x62>
+    neg = 1;
+    x = -xx;
+     e00:	f7 d8                	neg    %eax
+     e02:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+     e04:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     e0b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+     e10:	89 c8                	mov    %ecx,%eax
+     e12:	ba 00 00 00 00       	mov    $0x0,%edx
+     e17:	f7 f6                	div    %esi
+     e19:	89 df                	mov    %ebx,%edi
+     e1b:	83 c3 01             	add    $0x1,%ebx
+     e1e:	0f b6 92 80 18 00 00 	movzbl 0x1880(%edx),%edx
+     e25:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+     e29:	89 ca                	mov    %ecx,%edx
+     e2b:	89 c1                	mov    %eax,%ecx
+     e2d:	39 f2                	cmp    %esi,%edx
+     e2f:	73 df                	jae    e10 <printint+0x2e>
+  if(neg)
+     e31:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     e35:	74 31                	je     e68 <printint+0x86>
+    buf[i++] = '-';
+     e37:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+     e3c:	8d 5f 02             	lea    0x2(%edi),%ebx
+     e3f:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     e42:	eb 17                	jmp    e5b <printint+0x79>
+    x = xx;
+     e44:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+     e46:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     e4d:	eb bc                	jmp    e0b <printint+0x29>
+
+  while(--i >= 0)
+    putc(o, buf[i]);
+     e4f:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+     e54:	89 f0                	mov    %esi,%eax
+     e56:	e8 45 ff ff ff       	call   da0 <putc>
+  while(--i >= 0)
+     e5b:	83 eb 01             	sub    $0x1,%ebx
+     e5e:	79 ef                	jns    e4f <printint+0x6d>
+}
+     e60:	83 c4 2c             	add    $0x2c,%esp
+     e63:	5b                   	pop    %ebx
+     e64:	5e                   	pop    %esi
+     e65:	5f                   	pop    %edi
+     e66:	5d                   	pop    %ebp
+     e67:	c3                   	ret
+     e68:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     e6b:	eb ee                	jmp    e5b <printint+0x79>
+
+00000e6d <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     e6d:	55                   	push   %ebp
+     e6e:	89 e5                	mov    %esp,%ebp
+     e70:	57                   	push   %edi
+     e71:	56                   	push   %esi
+     e72:	53                   	push   %ebx
+     e73:	83 ec 6c             	sub    $0x6c,%esp
+  int c, i, state;
+  uint *ap;
+  struct out out, *o;
+
+  o = &out;
+  o->fd = fd;
+     e76:	8b 45 08             	mov    0x8(%ebp),%eax
+     e79:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  o->n = 0;
+     e7c:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+     e83:	8d 45 10             	lea    0x10(%ebp),%eax
+     e86:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  state = 0;
+     e89:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+     e8e:	bb 00 00 00 00       	mov    $0x0,%ebx
+     e93:	eb 14                	jmp    ea9 <printf+0x3c>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(o, c);
+     e95:	89 fa                	mov    %edi,%edx
+     e97:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     e9a:	e8 01 ff ff ff       	call   da0 <putc>
+     e9f:	eb 05                	jmp    ea6 <printf+0x39>
+      }
+    } else if(state == '%'){
+     ea1:	83 fe 25             	cmp    $0x25,%esi
+     ea4:	74 25                	je     ecb <printf+0x5e>
+  for(i = 0; fmt[i]; i++){
+     ea6:	83 c3 01             	add    $0x1,%ebx
+     ea9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     eac:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+     eb0:	84 c0                	test   %al,%al
+     eb2:	0f 84 20 01 00 00    	je     fd8 <printf+0x16b>
+    c = fmt[i] & 0xff;
+     eb8:	0f be f8             	movsbl %al,%edi
+     ebb:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     ebe:	85 f6                	test   %esi,%esi
+     ec0:	75 df                	jne    ea1 <printf+0x34>
+      if(c == '%'){
+     ec2:	83 f8 25             	cmp    $0x25,%eax
+     ec5:	75 ce                	jne    e95 <printf+0x28>
+        state = '%';
+     ec7:	89 c6                	mov    %eax,%esi
+     ec9:	eb db                	jmp    ea6 <printf+0x39>
+      if(c == 'd'){
+     ecb:	83 f8 25             	cmp    $0x25,%eax
+     ece:	0f 84 cf 00 00 00    	je     fa3 <printf+0x136>
+     ed4:	0f 8c dd 00 00 00    	jl     fb7 <printf+0x14a>
+     eda:	83 f8 78             	cmp    $0x78,%eax
+     edd:	0f 8f d4 00 00 00    	jg     fb7 <printf+0x14a>
+     ee3:	83 f8 63             	cmp    $0x63,%eax
+     ee6:	0f 8c cb 00 00 00    	jl     fb7 <printf+0x14a>
+     eec:	83 e8 63             	sub    $0x63,%eax
+     eef:	83 f8 15             	cmp    $0x15,%eax
+     ef2:	0f 87 bf 00 00 00    	ja     fb7 <printf+0x14a>
+     ef8:	ff 24 85 28 18 00 00 	jmp    *0x1828(,%eax,4)
+        printint(o, *ap, 10, 1);
+     eff:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     f02:	8b 17                	mov    (%edi),%edx
+     f04:	83 ec 0c             	sub    $0xc,%esp
+     f07:	6a 01                	push   $0x1
+     f09:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     f0e:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     f11:	e8 cc fe ff ff       	call   de2 <printint>
+        ap++;
+     f16:	83 c7 04             	add    $0x4,%edi
+     f19:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     f1c:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(o, '%');
+        putc(o, c);
+      }
+      state = 0;
+     f1f:	be 00 00 00 00       	mov    $0x0,%esi
+     f24:	eb 80                	jmp    ea6 <printf+0x39>
+        printint(o, *ap, 16, 0);
+     f26:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     f29:	8b 17                	mov    (%edi),%edx
+     f2b:	83 ec 0c             	sub    $0xc,%esp
+     f2e:	6a 00                	push   $0x0
+     f30:	b9 10 00 00 00       	mov    $0x10,%ecx
+     f35:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     f38:	e8 a5 fe ff ff       	call   de2 <printint>
+        ap++;
+     f3d:	83 c7 04             	add    $0x4,%edi
+     f40:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     f43:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     f46:	be 00 00 00 00       	mov    $0x0,%esi
+     f4b:	e9 56 ff ff ff       	jmp    ea6 <printf+0x39>
+        s = (char*)*ap;
+     f50:	8b 45 94             	mov    -0x6c(%ebp),%eax
+     f53:	8b 30                	mov    (%eax),%esi
+        ap++;
+     f55:	83 c0 04             	add    $0x4,%eax
+     f58:	89 45 94             	mov    %eax,-0x6c(%ebp)
+        if(s == 0)
+     f5b:	85 f6                	test   %esi,%esi
+     f5d:	75 15                	jne    f74 <printf+0x107>
+          s = "(null)";
+     f5f:	be 20 18 00 00       	mov    $0x1820,%esi
+     f64:	eb 0e                	jmp    f74 <printf+0x107>
+          putc(o, *s);
+     f66:	0f be d2             	movsbl %dl,%edx
+     f69:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     f6c:	e8 2f fe ff ff       	call   da0 <putc>
+          s++;
+     f71:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+     f74:	0f b6 16             	movzbl (%esi),%edx
+     f77:	84 d2                	test   %dl,%dl
+     f79:	75 eb                	jne    f66 <printf+0xf9>
+      state = 0;
+     f7b:	be 00 00 00 00       	mov    $0x0,%esi
+     f80:	e9 21 ff ff ff       	jmp    ea6 <printf+0x39>
+        putc(o, *ap);
+     f85:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     f88:	0f be 17             	movsbl (%edi),%edx
+     f8b:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     f8e:	e8 0d fe ff ff       	call   da0 <putc>
+        ap++;
+     f93:	83 c7 04             	add    $0x4,%edi
+     f96:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+      state = 0;
+     f99:	be 00 00 00 00       	mov    $0x0,%esi
+     f9e:	e9 03 ff ff ff       	jmp    ea6 <printf+0x39>
+        putc(o, c);
+     fa3:	89 fa                	mov    %edi,%edx
+     fa5:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     fa8:	e8 f3 fd ff ff       	call   da0 <putc>
+      state = 0;
+     fad:	be 00 00 00 00       	mov    $0x0,%esi
+     fb2:	e9 ef fe ff ff       	jmp    ea6 <printf+0x39>
+        putc(o, '%');
+     fb7:	ba 25 00 00 00       	mov    $0x25,%edx
+     fbc:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     fbf:	e8 dc fd ff ff       	call   da0 <putc>
+        putc(o, c);
+     fc4:	89 fa                	mov    %edi,%edx
+     fc6:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     fc9:	e8 d2 fd ff ff       	call   da0 <putc>
+      state = 0;
+     fce:	be 00 00 00 00       	mov    $0x0,%esi
+     fd3:	e9 ce fe ff ff       	jmp    ea6 <printf+0x39>
+    }
+  }
+  if(o->n > 0)
+     fd8:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     fdb:	85 c0                	test   %eax,%eax
+     fdd:	7f 08                	jg     fe7 <printf+0x17a>
+    bufwrite(fd, o->buf, o->n);
+}
+     fdf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     fe2:	5b                   	pop    %ebx
+     fe3:	5e                   	pop    %esi
+     fe4:	5f                   	pop    %edi
+     fe5:	5d                   	pop    %ebp
+     fe6:	c3                   	ret
+    bufwrite(fd, o->buf, o->n);
+     fe7:	83 ec 04             	sub    $0x4,%esp
+     fea:	50                   	push   %eax
+     feb:	8d 45 a8             	lea    -0x58(%ebp),%eax
+     fee:	50                   	push   %eax
+     fef:	ff 75 08             	push   0x8(%ebp)
+     ff2:	e8 91 f7 ff ff       	call   788 <bufwrite>
+     ff7:	83 c4 10             	add    $0x10,%esp
+}
+     ffa:	eb e3                	jmp    fdf <printf+0x172>
+
+00000ffc <largefree>:
+  return &b->h;
+}
+
+static void
+largefree(Fblock *b)
+{
+     ffc:	55                   	push   %ebp
+     ffd:	89 e5                	mov    %esp,%ebp
+     fff:	57                   	push   %edi
+    1000:	56                   	push   %esi
+    1001:	53                   	push   %ebx
+    1002:	83 ec 0c             	sub    $0xc,%esp
+    1005:	89 c1                	mov    %eax,%ecx
+  Fblock **pp, *p, *prev;
+
+  prev = 0;
+    1007:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+    100c:	ba 0c 45 00 00       	mov    $0x450c,%edx
+    1011:	eb 05                	jmp    1018 <largefree+0x1c>
+    1013:	8d 50 08             	lea    0x8(%eax),%edx
+    prev = p;
+    1016:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+    1018:	8b 02                	mov    (%edx),%eax
+    101a:	85 c0                	test   %eax,%eax
+    101c:	74 04                	je     1022 <largefree+0x26>
+    101e:	39 c8                	cmp    %ecx,%eax
+    1020:	72 f1                	jb     1013 <largefree+0x17>
+  b->next = p;
+    1022:	89 41 08             	mov    %eax,0x8(%ecx)
+  if(p && (char*)b + b->h.size == (char*)p){
+    1025:	85 c0                	test   %eax,%eax
+    1027:	74 09                	je     1032 <largefree+0x36>
+    1029:	8b 31                	mov    (%ecx),%esi
+    102b:	8d 3c 31             	lea    (%ecx,%esi,1),%edi
+    102e:	39 c7                	cmp    %eax,%edi
+    1030:	74 21                	je     1053 <largefree+0x57>
+    b->h.size += p->h.size;
+    b->next = p->next;
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+    1032:	85 db                	test   %ebx,%ebx
+    1034:	74 09                	je     103f <largefree+0x43>
+    1036:	8b 03                	mov    (%ebx),%eax
+    1038:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+    103b:	39 ce                	cmp    %ecx,%esi
+    103d:	74 20                	je     105f <largefree+0x63>
+    prev->h.size += b->h.size;
+    prev->next = b->next;
+  } else
+    *pp = b;
+    103f:	89 0a                	mov    %ecx,(%edx)
+
+  // Give the top of the heap back.  With threads sharing the
+  // address space sbrk() cannot shrink it; keep the block then.
+  for(pp = &large; (*pp)->next; pp = &(*pp)->next)
+    1041:	be 0c 45 00 00       	mov    $0x450c,%esi
+    1046:	8b 1e                	mov    (%esi),%ebx
+    1048:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+    104c:	74 1d                	je     106b <largefree+0x6f>
+    104e:	8d 73 08             	lea    0x8(%ebx),%esi
+    1051:	eb f3                	jmp    1046 <largefree+0x4a>
+    b->h.size += p->h.size;
+    1053:	03 30                	add    (%eax),%esi
+    1055:	89 31                	mov    %esi,(%ecx)
+    b->next = p->next;
+    1057:	8b 40 08             	mov    0x8(%eax),%eax
+    105a:	89 41 08             	mov    %eax,0x8(%ecx)
+    105d:	eb d3                	jmp    1032 <largefree+0x36>
+    prev->h.size += b->h.size;
+    105f:	03 01                	add    (%ecx),%eax
+    1061:	89 03                	mov    %eax,(%ebx)
+    prev->next = b->next;
+    1063:	8b 41 08             	mov    0x8(%ecx),%eax
+    1066:	89 43 08             	mov    %eax,0x8(%ebx)
+    1069:	eb d6                	jmp    1041 <largefree+0x45>
+    ;
+  b = *pp;
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+    106b:	89 df                	mov    %ebx,%edi
+    106d:	03 3b                	add    (%ebx),%edi
+    106f:	83 ec 0c             	sub    $0xc,%esp
+    1072:	6a 00                	push   $0x0
+    1074:	e8 93 fa ff ff       	call   b0c <sbrk>
+    1079:	83 c4 10             	add    $0x10,%esp
+    107c:	39 c7                	cmp    %eax,%edi
+    107e:	74 08                	je     1088 <largefree+0x8c>
+    *pp = 0;
+}
+    1080:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1083:	5b                   	pop    %ebx
+    1084:	5e                   	pop    %esi
+    1085:	5f                   	pop    %edi
+    1086:	5d                   	pop    %ebp
+    1087:	c3                   	ret
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+    1088:	8b 03                	mov    (%ebx),%eax
+    108a:	f7 d8                	neg    %eax
+    108c:	83 ec 0c             	sub    $0xc,%esp
+    108f:	50                   	push   %eax
+    1090:	e8 77 fa ff ff       	call   b0c <sbrk>
+    1095:	83 c4 10             	add    $0x10,%esp
+    1098:	83 f8 ff             	cmp    $0xffffffff,%eax
+    109b:	74 e3                	je     1080 <largefree+0x84>
+    *pp = 0;
+    109d:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+    10a3:	eb db                	jmp    1080 <largefree+0x84>
+
+000010a5 <more>:
+{
+    10a5:	55                   	push   %ebp
+    10a6:	89 e5                	mov    %esp,%ebp
+    10a8:	56                   	push   %esi
+    10a9:	53                   	push   %ebx
+    10aa:	89 c6                	mov    %eax,%esi
+  pad = -(uint)sbrk(0) & 7;
+    10ac:	83 ec 0c             	sub    $0xc,%esp
+    10af:	6a 00                	push   $0x0
+    10b1:	e8 56 fa ff ff       	call   b0c <sbrk>
+    10b6:	f7 d8                	neg    %eax
+    10b8:	89 c3                	mov    %eax,%ebx
+    10ba:	83 e3 07             	and    $0x7,%ebx
+  if((p = sbrk(n + pad)) == (char*)-1)
+    10bd:	01 de                	add    %ebx,%esi
+    10bf:	89 34 24             	mov    %esi,(%esp)
+    10c2:	e8 45 fa ff ff       	call   b0c <sbrk>
+    10c7:	83 c4 10             	add    $0x10,%esp
+    10ca:	83 f8 ff             	cmp    $0xffffffff,%eax
+    10cd:	74 09                	je     10d8 <more+0x33>
+  return p + pad;
+    10cf:	01 d8                	add    %ebx,%eax
+}
+    10d1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    10d4:	5b                   	pop    %ebx
+    10d5:	5e                   	pop    %esi
+    10d6:	5d                   	pop    %ebp
+    10d7:	c3                   	ret
+    return 0;
+    10d8:	b8 00 00 00 00       	mov    $0x0,%eax
+    10dd:	eb f2                	jmp    10d1 <more+0x2c>
+
+000010df <slaballoc>:
+{
+    10df:	55                   	push   %ebp
+    10e0:	89 e5                	mov    %esp,%ebp
+    10e2:	56                   	push   %esi
+    10e3:	53                   	push   %ebx
+    10e4:	89 c6                	mov    %eax,%esi
+  n = 1 << (MINSHIFT + c);
+    10e6:	8d 48 04             	lea    0x4(%eax),%ecx
+    10e9:	bb 01 00 00 00       	mov    $0x1,%ebx
+    10ee:	d3 e3                	shl    %cl,%ebx
+  if(slab + n > slabend){
+    10f0:	89 d8                	mov    %ebx,%eax
+    10f2:	03 05 08 45 00 00    	add    0x4508,%eax
+    10f8:	39 05 04 45 00 00    	cmp    %eax,0x4504
+    10fe:	72 17                	jb     1117 <slaballoc+0x38>
+  h = (Header*)slab;
+    1100:	a1 08 45 00 00       	mov    0x4508,%eax
+  slab += n;
+    1105:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+    1108:	89 15 08 45 00 00    	mov    %edx,0x4508
+  h->size = n;
+    110e:	89 18                	mov    %ebx,(%eax)
+  h->class = c;
+    1110:	89 70 04             	mov    %esi,0x4(%eax)
+}
+    1113:	5b                   	pop    %ebx
+    1114:	5e                   	pop    %esi
+    1115:	5d                   	pop    %ebp
+    1116:	c3                   	ret
+    if((p = more(SLABSZ)) == 0)
+    1117:	b8 00 40 00 00       	mov    $0x4000,%eax
+    111c:	e8 84 ff ff ff       	call   10a5 <more>
+    1121:	85 c0                	test   %eax,%eax
+    1123:	74 ee                	je     1113 <slaballoc+0x34>
+    if(p != slabend)
+    1125:	39 05 04 45 00 00    	cmp    %eax,0x4504
+    112b:	74 05                	je     1132 <slaballoc+0x53>
+      slab = p;
+    112d:	a3 08 45 00 00       	mov    %eax,0x4508
+    slabend = p + SLABSZ;
+    1132:	05 00 40 00 00       	add    $0x4000,%eax
+    1137:	a3 04 45 00 00       	mov    %eax,0x4504
+    113c:	eb c2                	jmp    1100 <slaballoc+0x21>
+
+0000113e <largealloc>:
+{
+    113e:	55                   	push   %ebp
+    113f:	89 e5                	mov    %esp,%ebp
+    1141:	56                   	push   %esi
+    1142:	53                   	push   %ebx
+    1143:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+    1145:	b9 0c 45 00 00       	mov    $0x450c,%ecx
+    114a:	8b 01                	mov    (%ecx),%eax
+    114c:	85 c0                	test   %eax,%eax
+    114e:	74 36                	je     1186 <largealloc+0x48>
+    if(b->h.size < n)
+    1150:	8b 10                	mov    (%eax),%edx
+    1152:	39 da                	cmp    %ebx,%edx
+    1154:	72 24                	jb     117a <largealloc+0x3c>
+    if(b->h.size - n > SMALLMAX){
+    1156:	29 da                	sub    %ebx,%edx
+    1158:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+    115e:	76 1f                	jbe    117f <largealloc+0x41>
+      rest = (Fblock*)((char*)b + n);
+    1160:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+      rest->h.size = b->h.size - n;
+    1163:	89 16                	mov    %edx,(%esi)
+      rest->h.class = LARGE;
+    1165:	c7 46 04 09 00 00 00 	movl   $0x9,0x4(%esi)
+      rest->next = b->next;
+    116c:	8b 50 08             	mov    0x8(%eax),%edx
+    116f:	89 56 08             	mov    %edx,0x8(%esi)
+      *pp = rest;
+    1172:	89 31                	mov    %esi,(%ecx)
+      b->h.size = n;
+    1174:	89 18                	mov    %ebx,(%eax)
+}
+    1176:	5b                   	pop    %ebx
+    1177:	5e                   	pop    %esi
+    1178:	5d                   	pop    %ebp
+    1179:	c3                   	ret
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+    117a:	8d 48 08             	lea    0x8(%eax),%ecx
+    117d:	eb cb                	jmp    114a <largealloc+0xc>
+      *pp = b->next;
+    117f:	8b 50 08             	mov    0x8(%eax),%edx
+    1182:	89 11                	mov    %edx,(%ecx)
+    return &b->h;
+    1184:	eb f0                	jmp    1176 <largealloc+0x38>
+  if((b = more(n)) == 0)
+    1186:	89 d8                	mov    %ebx,%eax
+    1188:	e8 18 ff ff ff       	call   10a5 <more>
+    118d:	85 c0                	test   %eax,%eax
+    118f:	74 e5                	je     1176 <largealloc+0x38>
+  b->h.size = n;
+    1191:	89 18                	mov    %ebx,(%eax)
+  b->h.class = LARGE;
+    1193:	c7 40 04 09 00 00 00 	movl   $0x9,0x4(%eax)
+  return &b->h;
+    119a:	eb da                	jmp    1176 <largealloc+0x38>
+
+0000119c <free>:
+
+void
+free(void *ap)
+{
+    119c:	55                   	push   %ebp
+    119d:	89 e5                	mov    %esp,%ebp
+    119f:	56                   	push   %esi
+    11a0:	53                   	push   %ebx
+    11a1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+
+  if(ap == 0)
+    11a4:	85 db                	test   %ebx,%ebx
+    11a6:	74 3b                	je     11e3 <free+0x47>
+    return;
+  h = (Header*)ap - 1;
+    11a8:	8d 73 f8             	lea    -0x8(%ebx),%esi
+  lock_acquire(&lock);
+    11ab:	83 ec 0c             	sub    $0xc,%esp
+    11ae:	68 00 45 00 00       	push   $0x4500
+    11b3:	e8 9c 01 00 00       	call   1354 <lock_acquire>
+  if(h->class == LARGE)
+    11b8:	8b 43 fc             	mov    -0x4(%ebx),%eax
+    11bb:	83 c4 10             	add    $0x10,%esp
+    11be:	83 f8 09             	cmp    $0x9,%eax
+    11c1:	74 27                	je     11ea <free+0x4e>
+    largefree((Fblock*)h);
+  else {
+    ((Fblock*)h)->next = freelist[h->class];
+    11c3:	8b 14 85 20 45 00 00 	mov    0x4520(,%eax,4),%edx
+    11ca:	89 13                	mov    %edx,(%ebx)
+    freelist[h->class] = (Fblock*)h;
+    11cc:	89 34 85 20 45 00 00 	mov    %esi,0x4520(,%eax,4)
+  }
+  lock_release(&lock);
+    11d3:	83 ec 0c             	sub    $0xc,%esp
+    11d6:	68 00 45 00 00       	push   $0x4500
+    11db:	e8 88 01 00 00       	call   1368 <lock_release>
+    11e0:	83 c4 10             	add    $0x10,%esp
+}
+    11e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    11e6:	5b                   	pop    %ebx
+    11e7:	5e                   	pop    %esi
+    11e8:	5d                   	pop    %ebp
+    11e9:	c3                   	ret
+    largefree((Fblock*)h);
+    11ea:	89 f0                	mov    %esi,%eax
+    11ec:	e8 0b fe ff ff       	call   ffc <largefree>
+    11f1:	eb e0                	jmp    11d3 <free+0x37>
+
+000011f3 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    11f3:	55                   	push   %ebp
+    11f4:	89 e5                	mov    %esp,%ebp
+    11f6:	53                   	push   %ebx
+    11f7:	83 ec 04             	sub    $0x4,%esp
+    11fa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+  uint n;
+  int c;
+
+  if(nbytes > 0x7fffffff - sizeof(Header) - 7)
+    11fd:	81 fb f0 ff ff 7f    	cmp    $0x7ffffff0,%ebx
+    1203:	0f 87 8b 00 00 00    	ja     1294 <malloc+0xa1>
+    return 0;
+  n = (nbytes + sizeof(Header) + 7) & ~7;
+    1209:	83 c3 0f             	add    $0xf,%ebx
+    120c:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(n < sizeof(Fblock))
+    120f:	83 fb 0b             	cmp    $0xb,%ebx
+    1212:	77 05                	ja     1219 <malloc+0x26>
+    n = sizeof(Fblock);
+    1214:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  lock_acquire(&lock);
+    1219:	83 ec 0c             	sub    $0xc,%esp
+    121c:	68 00 45 00 00       	push   $0x4500
+    1221:	e8 2e 01 00 00       	call   1354 <lock_acquire>
+  if(n <= SMALLMAX){
+    1226:	83 c4 10             	add    $0x10,%esp
+    1229:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+    122f:	77 58                	ja     1289 <malloc+0x96>
+    for(c = 0; (1 << (MINSHIFT + c)) < n; c++)
+    1231:	ba 00 00 00 00       	mov    $0x0,%edx
+    1236:	eb 03                	jmp    123b <malloc+0x48>
+    1238:	83 c2 01             	add    $0x1,%edx
+    123b:	8d 4a 04             	lea    0x4(%edx),%ecx
+    123e:	b8 01 00 00 00       	mov    $0x1,%eax
+    1243:	d3 e0                	shl    %cl,%eax
+    1245:	39 d8                	cmp    %ebx,%eax
+    1247:	72 ef                	jb     1238 <malloc+0x45>
+      ;
+    if(freelist[c]){
+    1249:	8b 04 95 20 45 00 00 	mov    0x4520(,%edx,4),%eax
+    1250:	85 c0                	test   %eax,%eax
+    1252:	74 2a                	je     127e <malloc+0x8b>
+      h = &freelist[c]->h;
+    1254:	89 c3                	mov    %eax,%ebx
+      freelist[c] = freelist[c]->next;
+    1256:	8b 40 08             	mov    0x8(%eax),%eax
+    1259:	89 04 95 20 45 00 00 	mov    %eax,0x4520(,%edx,4)
+    } else
+      h = slaballoc(c);
+  } else
+    h = largealloc(n);
+  lock_release(&lock);
+    1260:	83 ec 0c             	sub    $0xc,%esp
+    1263:	68 00 45 00 00       	push   $0x4500
+    1268:	e8 fb 00 00 00       	call   1368 <lock_release>
+  return h ? (void*)(h + 1) : 0;
+    126d:	83 c4 10             	add    $0x10,%esp
+    1270:	85 db                	test   %ebx,%ebx
+    1272:	74 03                	je     1277 <malloc+0x84>
+    1274:	83 c3 08             	add    $0x8,%ebx
+}
+    1277:	89 d8                	mov    %ebx,%eax
+    1279:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    127c:	c9                   	leave
+    127d:	c3                   	ret
+      h = slaballoc(c);
+    127e:	89 d0                	mov    %edx,%eax
+    1280:	e8 5a fe ff ff       	call   10df <slaballoc>
+    1285:	89 c3                	mov    %eax,%ebx
+    1287:	eb d7                	jmp    1260 <malloc+0x6d>
+    h = largealloc(n);
+    1289:	89 d8                	mov    %ebx,%eax
+    128b:	e8 ae fe ff ff       	call   113e <largealloc>
+    1290:	89 c3                	mov    %eax,%ebx
+    1292:	eb cc                	jmp    1260 <malloc+0x6d>
+    return 0;
+    1294:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1299:	eb dc                	jmp    1277 <malloc+0x84>
+
+0000129b <tstart>:
+  void *arg;
+};
+
+static void
+tstart(void *a)
+{
+    129b:	55                   	push   %ebp
+    129c:	89 e5                	mov    %esp,%ebp
+    129e:	83 ec 14             	sub    $0x14,%esp
+    12a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+    12a4:	ff 70 04             	push   0x4(%eax)
+    12a7:	ff 10                	call   *(%eax)
+  exit();
+    12a9:	e8 86 f6 ff ff       	call   934 <exit>
+
+000012ae <thread_create>:
+}
+
+// Run fn(arg) in a new thread.  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    12ae:	55                   	push   %ebp
+    12af:	89 e5                	mov    %esp,%ebp
+    12b1:	56                   	push   %esi
+    12b2:	53                   	push   %ebx
+  struct tstart *t;
+  char *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    12b3:	83 ec 0c             	sub    $0xc,%esp
+    12b6:	68 00 10 00 00       	push   $0x1000
+    12bb:	e8 33 ff ff ff       	call   11f3 <malloc>
+    12c0:	83 c4 10             	add    $0x10,%esp
+    12c3:	85 c0                	test   %eax,%eax
+    12c5:	74 42                	je     1309 <thread_create+0x5b>
+    12c7:	89 c3                	mov    %eax,%ebx
+    return -1;
+  t = (struct tstart*)stack;
+  t->fn = fn;
+    12c9:	8b 45 08             	mov    0x8(%ebp),%eax
+    12cc:	89 03                	mov    %eax,(%ebx)
+  t->arg = arg;
+    12ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+    12d1:	89 43 04             	mov    %eax,0x4(%ebx)
+  if((pid = clone(tstart, stack + TSTACK, t)) < 0)
+    12d4:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    12da:	83 ec 04             	sub    $0x4,%esp
+    12dd:	53                   	push   %ebx
+    12de:	50                   	push   %eax
+    12df:	68 9b 12 00 00       	push   $0x129b
+    12e4:	e8 f5 f8 ff ff       	call   bde <clone>
+    12e9:	89 c6                	mov    %eax,%esi
+    12eb:	83 c4 10             	add    $0x10,%esp
+    12ee:	85 c0                	test   %eax,%eax
+    12f0:	78 09                	js     12fb <thread_create+0x4d>
+    free(stack);
+  return pid;
+}
+    12f2:	89 f0                	mov    %esi,%eax
+    12f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    12f7:	5b                   	pop    %ebx
+    12f8:	5e                   	pop    %esi
+    12f9:	5d                   	pop    %ebp
+    12fa:	c3                   	ret
+    free(stack);
+    12fb:	83 ec 0c             	sub    $0xc,%esp
+    12fe:	53                   	push   %ebx
+    12ff:	e8 98 fe ff ff       	call   119c <free>
+    1304:	83 c4 10             	add    $0x10,%esp
+    1307:	eb e9                	jmp    12f2 <thread_create+0x44>
+    return -1;
+    1309:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    130e:	eb e2                	jmp    12f2 <thread_create+0x44>
+
+00001310 <thread_join>:
+
+// Wait for one of this process's threads to exit and free its
+// stack.  Returns its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+    1310:	55                   	push   %ebp
+    1311:	89 e5                	mov    %esp,%ebp
+    1313:	53                   	push   %ebx
+    1314:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    1317:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    131a:	50                   	push   %eax
+    131b:	e8 cd f8 ff ff       	call   bed <join>
+    1320:	89 c3                	mov    %eax,%ebx
+    1322:	83 c4 10             	add    $0x10,%esp
+    1325:	85 c0                	test   %eax,%eax
+    1327:	79 07                	jns    1330 <thread_join+0x20>
+    free((char*)stack - TSTACK);
+  return pid;
+}
+    1329:	89 d8                	mov    %ebx,%eax
+    132b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    132e:	c9                   	leave
+    132f:	c3                   	ret
+    free((char*)stack - TSTACK);
+    1330:	83 ec 0c             	sub    $0xc,%esp
+    1333:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1336:	2d 00 10 00 00       	sub    $0x1000,%eax
+    133b:	50                   	push   %eax
+    133c:	e8 5b fe ff ff       	call   119c <free>
+    1341:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    1344:	eb e3                	jmp    1329 <thread_join+0x19>
+
+00001346 <lock_init>:
+
+void
+lock_init(lock_t *lk)
+{
+    1346:	55                   	push   %ebp
+    1347:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    1349:	8b 45 08             	mov    0x8(%ebp),%eax
+    134c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1352:	5d                   	pop    %ebp
+    1353:	c3                   	ret
+
+00001354 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+    1354:	55                   	push   %ebp
+    1355:	89 e5                	mov    %esp,%ebp
+    1357:	8b 55 08             	mov    0x8(%ebp),%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    135a:	b8 01 00 00 00       	mov    $0x1,%eax
+    135f:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    1362:	85 c0                	test   %eax,%eax
+    1364:	75 f4                	jne    135a <lock_acquire+0x6>
+    ;
+}
+    1366:	5d                   	pop    %ebp
+    1367:	c3                   	ret
+
+00001368 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+    1368:	55                   	push   %ebp
+    1369:	89 e5                	mov    %esp,%ebp
+    136b:	8b 55 08             	mov    0x8(%ebp),%edx
+    136e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1373:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    1376:	5d                   	pop    %ebp
+    1377:	c3                   	ret
+
+00001378 <mutex_init>:
+// Are Tricky": state is 0 when free, 1 when held, 2 when held and
+// others may be waiting.  Unlocking an uncontended mutex costs no
+// system call.
+void
+mutex_init(mutex_t *m)
+{
+    1378:	55                   	push   %ebp
+    1379:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    137b:	8b 45 08             	mov    0x8(%ebp),%eax
+    137e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1384:	5d                   	pop    %ebp
+    1385:	c3                   	ret
+
+00001386 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+    1386:	55                   	push   %ebp
+    1387:	89 e5                	mov    %esp,%ebp
+    1389:	53                   	push   %ebx
+    138a:	83 ec 04             	sub    $0x4,%esp
+    138d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    1390:	b8 00 00 00 00       	mov    $0x0,%eax
+    1395:	b9 01 00 00 00       	mov    $0x1,%ecx
+    139a:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    139e:	85 c0                	test   %eax,%eax
+    13a0:	74 29                	je     13cb <mutex_lock+0x45>
+    return;
+  if(c != 2)
+    13a2:	83 f8 02             	cmp    $0x2,%eax
+    13a5:	74 20                	je     13c7 <mutex_lock+0x41>
+    13a7:	b8 02 00 00 00       	mov    $0x2,%eax
+    13ac:	f0 87 03             	lock xchg %eax,(%ebx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    13af:	eb 16                	jmp    13c7 <mutex_lock+0x41>
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    13b1:	83 ec 08             	sub    $0x8,%esp
+    13b4:	6a 02                	push   $0x2
+    13b6:	53                   	push   %ebx
+    13b7:	e8 40 f8 ff ff       	call   bfc <futex_wait>
+  asm volatile("lock; xchgl %0, %1" :
+    13bc:	b8 02 00 00 00       	mov    $0x2,%eax
+    13c1:	f0 87 03             	lock xchg %eax,(%ebx)
+    13c4:	83 c4 10             	add    $0x10,%esp
+  while(c != 0){
+    13c7:	85 c0                	test   %eax,%eax
+    13c9:	75 e6                	jne    13b1 <mutex_lock+0x2b>
+    c = xchg(&m->state, 2);
+  }
+}
+    13cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    13ce:	c9                   	leave
+    13cf:	c3                   	ret
+
+000013d0 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+    13d0:	55                   	push   %ebp
+    13d1:	89 e5                	mov    %esp,%ebp
+    13d3:	83 ec 08             	sub    $0x8,%esp
+    13d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    13d9:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    13de:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    13e2:	83 fa 01             	cmp    $0x1,%edx
+    13e5:	75 02                	jne    13e9 <mutex_unlock+0x19>
+    m->state = 0;
+    futex_wake(&m->state, 1);
+  }
+}
+    13e7:	c9                   	leave
+    13e8:	c3                   	ret
+    m->state = 0;
+    13e9:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+    13ef:	83 ec 08             	sub    $0x8,%esp
+    13f2:	6a 01                	push   $0x1
+    13f4:	50                   	push   %eax
+    13f5:	e8 11 f8 ff ff       	call   c0b <futex_wake>
+    13fa:	83 c4 10             	add    $0x10,%esp
+}
+    13fd:	eb e8                	jmp    13e7 <mutex_unlock+0x17>
+
+000013ff <cond_init>:
+// Condition variable: waiters sleep on a sequence number that
+// every signal bumps, so a signal between the unlock and the
+// futex_wait() in cond_wait() is not lost.
+void
+cond_init(cond_t *c)
+{
+    13ff:	55                   	push   %ebp
+    1400:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    1402:	8b 45 08             	mov    0x8(%ebp),%eax
+    1405:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    140b:	5d                   	pop    %ebp
+    140c:	c3                   	ret
+
+0000140d <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+    140d:	55                   	push   %ebp
+    140e:	89 e5                	mov    %esp,%ebp
+    1410:	57                   	push   %edi
+    1411:	56                   	push   %esi
+    1412:	53                   	push   %ebx
+    1413:	83 ec 18             	sub    $0x18,%esp
+    1416:	8b 75 08             	mov    0x8(%ebp),%esi
+    1419:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    141c:	8b 3e                	mov    (%esi),%edi
+  mutex_unlock(m);
+    141e:	53                   	push   %ebx
+    141f:	e8 ac ff ff ff       	call   13d0 <mutex_unlock>
+  futex_wait(&c->seq, seq);
+    1424:	83 c4 08             	add    $0x8,%esp
+    1427:	57                   	push   %edi
+    1428:	56                   	push   %esi
+    1429:	e8 ce f7 ff ff       	call   bfc <futex_wait>
+  // Others may be waiting for m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+    142e:	83 c4 10             	add    $0x10,%esp
+    1431:	eb 0e                	jmp    1441 <cond_wait+0x34>
+    futex_wait(&m->state, 2);
+    1433:	83 ec 08             	sub    $0x8,%esp
+    1436:	6a 02                	push   $0x2
+    1438:	53                   	push   %ebx
+    1439:	e8 be f7 ff ff       	call   bfc <futex_wait>
+    143e:	83 c4 10             	add    $0x10,%esp
+    1441:	b8 02 00 00 00       	mov    $0x2,%eax
+    1446:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    1449:	85 c0                	test   %eax,%eax
+    144b:	75 e6                	jne    1433 <cond_wait+0x26>
+}
+    144d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1450:	5b                   	pop    %ebx
+    1451:	5e                   	pop    %esi
+    1452:	5f                   	pop    %edi
+    1453:	5d                   	pop    %ebp
+    1454:	c3                   	ret
+
+00001455 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+    1455:	55                   	push   %ebp
+    1456:	89 e5                	mov    %esp,%ebp
+    1458:	83 ec 10             	sub    $0x10,%esp
+    145b:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    145e:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+    1462:	6a 01                	push   $0x1
+    1464:	50                   	push   %eax
+    1465:	e8 a1 f7 ff ff       	call   c0b <futex_wake>
+}
+    146a:	83 c4 10             	add    $0x10,%esp
+    146d:	c9                   	leave
+    146e:	c3                   	ret
+
+0000146f <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+    146f:	55                   	push   %ebp
+    1470:	89 e5                	mov    %esp,%ebp
+    1472:	83 ec 10             	sub    $0x10,%esp
+    1475:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    1478:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, NPROC);
+    147c:	6a 40                	push   $0x40
+    147e:	50                   	push   %eax
+    147f:	e8 87 f7 ff ff       	call   c0b <futex_wake>
+}
+    1484:	83 c4 10             	add    $0x10,%esp
+    1487:	c9                   	leave
+    1488:	c3                   	ret
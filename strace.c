@@ -0,0 +1,142 @@
+// strace -c: run a command and count the system calls it and its
+// children make, the way strace -c does: how many of each, the
+// time spent in them and the longest one.  "strace -a" shows the
+// counts of every process since boot instead.  Times are in
+// thousands of TSC cycles.
+#include "types.h"
+#include "user.h"
+#include "syscall.h"
+#include "sysstat.h"
+
+static char *names[NSYSCALL] = {
+[SYS_fork]    "fork",
+[SYS_exit]    "exit",
+[SYS_wait]    "wait",
+[SYS_pipe]    "pipe",
+[SYS_read]    "read",
+[SYS_kill]    "kill",
+[SYS_exec]    "exec",
+[SYS_fstat]   "fstat",
+[SYS_chdir]   "chdir",
+[SYS_dup]     "dup",
+[SYS_getpid]  "getpid",
+[SYS_sbrk]    "sbrk",
+[SYS_sleep]   "sleep",
+[SYS_uptime]  "uptime",
+[SYS_open]    "open",
+[SYS_write]   "write",
+[SYS_mknod]   "mknod",
+[SYS_unlink]  "unlink",
+[SYS_link]    "link",
+[SYS_mkdir]   "mkdir",
+[SYS_close]   "close",
+[SYS_date]    "date",
+[SYS_dup2]    "dup2",
+[SYS_faultaround] "faultaround",
+[SYS_faultstat] "faultstat",
+[SYS_mmap]    "mmap",
+[SYS_munmap]  "munmap",
+[SYS_largepages] "largepages",
+[SYS_spawn]   "spawn",
+[SYS_setpriority] "setpriority",
+[SYS_getpriority] "getpriority",
+[SYS_getprocinfo] "getprocinfo",
+[SYS_getcpuinfo] "getcpuinfo",
+[SYS_clone]   "clone",
+[SYS_join]    "join",
+[SYS_futex_wait] "futex_wait",
+[SYS_futex_wake] "futex_wake",
+[SYS_setaffinity] "setaffinity",
+[SYS_getaffinity] "getaffinity",
+[SYS_clock_gettime] "clock_gettime",
+[SYS_msleep]  "msleep",
+[SYS_lockstat] "lockstat",
+[SYS_bstat]   "bstat",
+[SYS_iostat]  "iostat",
+[SYS_fsync]   "fsync",
+[SYS_pread]   "pread",
+[SYS_pwrite]  "pwrite",
+[SYS_readv]   "readv",
+[SYS_writev]  "writev",
+[SYS_sendfile] "sendfile",
+[SYS_fcntl]   "fcntl",
+[SYS_mount]   "mount",
+[SYS_getdents] "getdents",
+[SYS_fstatat] "fstatat",
+[SYS_sysstat] "sysstat",
+[SYS_ringenter] "ringenter",
+[SYS_trace]   "trace",
+[SYS_memstat] "memstat",
+[SYS_shmget]  "shmget",
+[SYS_shmat]   "shmat",
+[SYS_shmdt]   "shmdt",
+[SYS_irqstat] "irqstat",
+[SYS_irqroute] "irqroute",
+};
+
+static struct syscount sc[NSYSCALL];
+
+static void
+report(void)
+{
+  uint kc[NSYSCALL], total, n;
+  int i, j, best;
+
+  total = n = 0;
+  for(i = 0; i < NSYSCALL; i++){
+    kc[i] = sc[i].time >> 10;
+    total += kc[i];
+    n += sc[i].n;
+  }
+  printf(2, "%% time\tkcycles\tmax\tcalls\tsyscall\n");
+  for(j = 0; j < NSYSCALL; j++){
+    best = -1;
+    for(i = 0; i < NSYSCALL; i++)
+      if(sc[i].n > 0 && (best < 0 || kc[i] > kc[best]))
+        best = i;
+    if(best < 0)
+      break;
+    printf(2, "%d\t%d\t%d\t%d\t%s\n",
+           total >= 100 ? kc[best] / (total/100) : (total ? kc[best]*100/total : 0),
+           kc[best], (uint)(sc[best].max >> 10), sc[best].n,
+           names[best] ? names[best] : "?");
+    sc[best].n = 0;
+  }
+  printf(2, "100\t%d\t\t%d\ttotal\n", total, n);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int pid;
+
+  if(argc == 2 && strcmp(argv[1], "-a") == 0){
+    if(sysstat(SS_ALL, sc) < 0){
+      printf(2, "strace: sysstat failed\n");
+      exit();
+    }
+    report();
+    exit();
+  }
+  if(argc < 3 || strcmp(argv[1], "-c") != 0){
+    printf(2, "usage: strace -c cmd [arg ...] | strace -a\n");
+    exit();
+  }
+  if((pid = fork()) < 0){
+    printf(2, "strace: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    exec(argv[2], argv + 2);
+    printf(2, "strace: exec %s failed\n", argv[2]);
+    exit();
+  }
+  while(wait() >= 0)
+    ;
+  if(sysstat(SS_CHILDREN, sc) < 0){
+    printf(2, "strace: sysstat failed\n");
+    exit();
+  }
+  report();
+  exit();
+}
@@ -0,0 +1,2823 @@
+
+_stressfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fs.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	56                   	push   %esi
+       e:	53                   	push   %ebx
+       f:	51                   	push   %ecx
+      10:	81 ec 24 02 00 00    	sub    $0x224,%esp
+  int fd, i;
+  char path[] = "stressfs0";
+      16:	c7 45 de 73 74 72 65 	movl   $0x65727473,-0x22(%ebp)
+      1d:	c7 45 e2 73 73 66 73 	movl   $0x73667373,-0x1e(%ebp)
+      24:	66 c7 45 e6 30 00    	movw   $0x30,-0x1a(%ebp)
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+      2a:	68 ac 12 00 00       	push   $0x12ac
+      2f:	6a 01                	push   $0x1
+      31:	e8 57 0c 00 00       	call   c8d <printf>
+  memset(data, 'a', sizeof(data));
+      36:	83 c4 0c             	add    $0xc,%esp
+      39:	68 00 02 00 00       	push   $0x200
+      3e:	6a 61                	push   $0x61
+      40:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+      46:	50                   	push   %eax
+      47:	e8 61 01 00 00       	call   1ad <memset>
+
+  for(i = 0; i < 4; i++)
+      4c:	83 c4 10             	add    $0x10,%esp
+      4f:	bb 00 00 00 00       	mov    $0x0,%ebx
+      54:	83 fb 03             	cmp    $0x3,%ebx
+      57:	7f 0e                	jg     67 <main+0x67>
+    if(fork() > 0)
+      59:	e8 e2 06 00 00       	call   740 <fork>
+      5e:	85 c0                	test   %eax,%eax
+      60:	7f 05                	jg     67 <main+0x67>
+  for(i = 0; i < 4; i++)
+      62:	83 c3 01             	add    $0x1,%ebx
+      65:	eb ed                	jmp    54 <main+0x54>
+      break;
+
+  printf(1, "write %d\n", i);
+      67:	83 ec 04             	sub    $0x4,%esp
+      6a:	53                   	push   %ebx
+      6b:	68 bf 12 00 00       	push   $0x12bf
+      70:	6a 01                	push   $0x1
+      72:	e8 16 0c 00 00       	call   c8d <printf>
+
+  path[8] += i;
+      77:	00 5d e6             	add    %bl,-0x1a(%ebp)
+  fd = open(path, O_CREATE | O_RDWR);
+      7a:	83 c4 08             	add    $0x8,%esp
+      7d:	68 02 02 00 00       	push   $0x202
+      82:	8d 45 de             	lea    -0x22(%ebp),%eax
+      85:	50                   	push   %eax
+      86:	e8 1a 08 00 00       	call   8a5 <open>
+      8b:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++)
+      8d:	83 c4 10             	add    $0x10,%esp
+      90:	bb 00 00 00 00       	mov    $0x0,%ebx
+      95:	eb 1b                	jmp    b2 <main+0xb2>
+//    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+      97:	83 ec 04             	sub    $0x4,%esp
+      9a:	68 00 02 00 00       	push   $0x200
+      9f:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+      a5:	50                   	push   %eax
+      a6:	56                   	push   %esi
+      a7:	e8 db 07 00 00       	call   887 <write>
+  for(i = 0; i < 20; i++)
+      ac:	83 c3 01             	add    $0x1,%ebx
+      af:	83 c4 10             	add    $0x10,%esp
+      b2:	83 fb 13             	cmp    $0x13,%ebx
+      b5:	7e e0                	jle    97 <main+0x97>
+  close(fd);
+      b7:	83 ec 0c             	sub    $0xc,%esp
+      ba:	56                   	push   %esi
+      bb:	e8 c3 06 00 00       	call   783 <close>
+
+  printf(1, "read\n");
+      c0:	83 c4 08             	add    $0x8,%esp
+      c3:	68 c9 12 00 00       	push   $0x12c9
+      c8:	6a 01                	push   $0x1
+      ca:	e8 be 0b 00 00       	call   c8d <printf>
+
+  fd = open(path, O_RDONLY);
+      cf:	83 c4 08             	add    $0x8,%esp
+      d2:	6a 00                	push   $0x0
+      d4:	8d 45 de             	lea    -0x22(%ebp),%eax
+      d7:	50                   	push   %eax
+      d8:	e8 c8 07 00 00       	call   8a5 <open>
+      dd:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < 20; i++)
+      df:	83 c4 10             	add    $0x10,%esp
+      e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+      e7:	eb 1b                	jmp    104 <main+0x104>
+    read(fd, data, sizeof(data));
+      e9:	83 ec 04             	sub    $0x4,%esp
+      ec:	68 00 02 00 00       	push   $0x200
+      f1:	8d 85 de fd ff ff    	lea    -0x222(%ebp),%eax
+      f7:	50                   	push   %eax
+      f8:	56                   	push   %esi
+      f9:	e8 7a 07 00 00       	call   878 <read>
+  for (i = 0; i < 20; i++)
+      fe:	83 c3 01             	add    $0x1,%ebx
+     101:	83 c4 10             	add    $0x10,%esp
+     104:	83 fb 13             	cmp    $0x13,%ebx
+     107:	7e e0                	jle    e9 <main+0xe9>
+  close(fd);
+     109:	83 ec 0c             	sub    $0xc,%esp
+     10c:	56                   	push   %esi
+     10d:	e8 71 06 00 00       	call   783 <close>
+
+  wait();
+     112:	e8 43 07 00 00       	call   85a <wait>
+
+  exit();
+     117:	e8 38 06 00 00       	call   754 <exit>
+
+0000011c <strcpy>:
+#include "memlayout.h"
+#include "clock.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     11c:	55                   	push   %ebp
+     11d:	89 e5                	mov    %esp,%ebp
+     11f:	56                   	push   %esi
+     120:	53                   	push   %ebx
+     121:	8b 75 08             	mov    0x8(%ebp),%esi
+     124:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     127:	89 f0                	mov    %esi,%eax
+     129:	89 d1                	mov    %edx,%ecx
+     12b:	83 c2 01             	add    $0x1,%edx
+     12e:	89 c3                	mov    %eax,%ebx
+     130:	83 c0 01             	add    $0x1,%eax
+     133:	0f b6 09             	movzbl (%ecx),%ecx
+     136:	88 0b                	mov    %cl,(%ebx)
+     138:	84 c9                	test   %cl,%cl
+     13a:	75 ed                	jne    129 <strcpy+0xd>
+    ;
+  return os;
+}
+     13c:	89 f0                	mov    %esi,%eax
+     13e:	5b                   	pop    %ebx
+     13f:	5e                   	pop    %esi
+     140:	5d                   	pop    %ebp
+     141:	c3                   	ret
+
+00000142 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     142:	55                   	push   %ebp
+     143:	89 e5                	mov    %esp,%ebp
+     145:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     148:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+     14b:	eb 06                	jmp    153 <strcmp+0x11>
+    p++, q++;
+     14d:	83 c1 01             	add    $0x1,%ecx
+     150:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+     153:	0f b6 01             	movzbl (%ecx),%eax
+     156:	84 c0                	test   %al,%al
+     158:	74 04                	je     15e <strcmp+0x1c>
+     15a:	3a 02                	cmp    (%edx),%al
+     15c:	74 ef                	je     14d <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+     15e:	0f b6 c0             	movzbl %al,%eax
+     161:	0f b6 12             	movzbl (%edx),%edx
+     164:	29 d0                	sub    %edx,%eax
+}
+     166:	5d                   	pop    %ebp
+     167:	c3                   	ret
+
+00000168 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     168:	55                   	push   %ebp
+     169:	89 e5                	mov    %esp,%ebp
+     16b:	53                   	push   %ebx
+     16c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  const char *p;
+  uint w;
+
+  for(p = s; (uint)p & 3; p++)
+     16f:	89 c8                	mov    %ecx,%eax
+     171:	eb 03                	jmp    176 <strlen+0xe>
+     173:	83 c0 01             	add    $0x1,%eax
+     176:	a8 03                	test   $0x3,%al
+     178:	74 09                	je     183 <strlen+0x1b>
+    if(*p == 0)
+     17a:	80 38 00             	cmpb   $0x0,(%eax)
+     17d:	75 f4                	jne    173 <strlen+0xb>
+      return p - s;
+     17f:	29 c8                	sub    %ecx,%eax
+     181:	eb 25                	jmp    1a8 <strlen+0x40>
+  // Then a word at a time, which never crosses into the next page:
+  // a word with a zero byte in it has one of these bits set.
+  for(;; p += 4){
+    w = *(uint*)p;
+     183:	8b 10                	mov    (%eax),%edx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     185:	8d 9a ff fe fe fe    	lea    -0x1010101(%edx),%ebx
+     18b:	f7 d2                	not    %edx
+     18d:	21 da                	and    %ebx,%edx
+     18f:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+     195:	75 05                	jne    19c <strlen+0x34>
+  for(;; p += 4){
+     197:	83 c0 04             	add    $0x4,%eax
+    w = *(uint*)p;
+     19a:	eb e7                	jmp    183 <strlen+0x1b>
+      break;
+  }
+  while(*p)
+     19c:	80 38 00             	cmpb   $0x0,(%eax)
+     19f:	74 05                	je     1a6 <strlen+0x3e>
+    p++;
+     1a1:	83 c0 01             	add    $0x1,%eax
+     1a4:	eb f6                	jmp    19c <strlen+0x34>
+  return p - s;
+     1a6:	29 c8                	sub    %ecx,%eax
+}
+     1a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     1ab:	c9                   	leave
+     1ac:	c3                   	ret
+
+000001ad <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     1ad:	55                   	push   %ebp
+     1ae:	89 e5                	mov    %esp,%ebp
+     1b0:	57                   	push   %edi
+     1b1:	56                   	push   %esi
+     1b2:	53                   	push   %ebx
+     1b3:	8b 55 10             	mov    0x10(%ebp),%edx
+  uint h;
+  char *d;
+
+  d = dst;
+  c &= 0xFF;
+     1b6:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  if(n >= 16){
+     1ba:	83 fa 0f             	cmp    $0xf,%edx
+     1bd:	76 52                	jbe    211 <memset+0x64>
+    h = -(uint)d & 3;
+     1bf:	8b 45 08             	mov    0x8(%ebp),%eax
+     1c2:	f7 d8                	neg    %eax
+     1c4:	83 e0 03             	and    $0x3,%eax
+     1c7:	89 c6                	mov    %eax,%esi
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     1c9:	8b 7d 08             	mov    0x8(%ebp),%edi
+     1cc:	89 c1                	mov    %eax,%ecx
+     1ce:	89 d8                	mov    %ebx,%eax
+     1d0:	fc                   	cld
+     1d1:	f3 aa                	rep stos %al,%es:(%edi)
+    stosb(d, c, h);
+    stosl(d + h, (c<<24)|(c<<16)|(c<<8)|c, (n - h)/4);
+     1d3:	29 f2                	sub    %esi,%edx
+     1d5:	89 d1                	mov    %edx,%ecx
+     1d7:	c1 e9 02             	shr    $0x2,%ecx
+     1da:	c1 e0 18             	shl    $0x18,%eax
+     1dd:	89 df                	mov    %ebx,%edi
+     1df:	c1 e7 10             	shl    $0x10,%edi
+     1e2:	09 f8                	or     %edi,%eax
+     1e4:	89 df                	mov    %ebx,%edi
+     1e6:	c1 e7 08             	shl    $0x8,%edi
+     1e9:	09 f8                	or     %edi,%eax
+     1eb:	09 d8                	or     %ebx,%eax
+     1ed:	89 f7                	mov    %esi,%edi
+     1ef:	03 7d 08             	add    0x8(%ebp),%edi
+}
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosl" :
+     1f2:	fc                   	cld
+     1f3:	f3 ab                	rep stos %eax,%es:(%edi)
+    d += h + (n - h)/4*4;
+     1f5:	89 d7                	mov    %edx,%edi
+     1f7:	83 e7 fc             	and    $0xfffffffc,%edi
+     1fa:	09 f7                	or     %esi,%edi
+     1fc:	03 7d 08             	add    0x8(%ebp),%edi
+    n = (n - h)%4;
+     1ff:	83 e2 03             	and    $0x3,%edx
+  asm volatile("cld; rep stosb" :
+     202:	89 d1                	mov    %edx,%ecx
+     204:	89 d8                	mov    %ebx,%eax
+     206:	fc                   	cld
+     207:	f3 aa                	rep stos %al,%es:(%edi)
+  }
+  stosb(d, c, n);
+  return dst;
+}
+     209:	8b 45 08             	mov    0x8(%ebp),%eax
+     20c:	5b                   	pop    %ebx
+     20d:	5e                   	pop    %esi
+     20e:	5f                   	pop    %edi
+     20f:	5d                   	pop    %ebp
+     210:	c3                   	ret
+  d = dst;
+     211:	8b 7d 08             	mov    0x8(%ebp),%edi
+     214:	eb ec                	jmp    202 <memset+0x55>
+
+00000216 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     216:	55                   	push   %ebp
+     217:	89 e5                	mov    %esp,%ebp
+     219:	8b 45 08             	mov    0x8(%ebp),%eax
+     21c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     220:	eb 03                	jmp    225 <strchr+0xf>
+     222:	83 c0 01             	add    $0x1,%eax
+     225:	0f b6 10             	movzbl (%eax),%edx
+     228:	84 d2                	test   %dl,%dl
+     22a:	74 06                	je     232 <strchr+0x1c>
+    if(*s == c)
+     22c:	38 ca                	cmp    %cl,%dl
+     22e:	75 f2                	jne    222 <strchr+0xc>
+     230:	eb 05                	jmp    237 <strchr+0x21>
+      return (char*)s;
+  return 0;
+     232:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     237:	5d                   	pop    %ebp
+     238:	c3                   	ret
+
+00000239 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     239:	55                   	push   %ebp
+     23a:	89 e5                	mov    %esp,%ebp
+     23c:	56                   	push   %esi
+     23d:	53                   	push   %ebx
+     23e:	8b 55 08             	mov    0x8(%ebp),%edx
+     241:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     244:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  // A word at a time while they agree.
+  if((((uint)s1 | (uint)s2) & 3) == 0)
+     247:	89 d3                	mov    %edx,%ebx
+     249:	09 cb                	or     %ecx,%ebx
+     24b:	f6 c3 03             	test   $0x3,%bl
+     24e:	74 24                	je     274 <memcmp+0x3b>
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+      s1 += 4, s2 += 4;
+  while(n-- > 0){
+     250:	8d 70 ff             	lea    -0x1(%eax),%esi
+     253:	85 c0                	test   %eax,%eax
+     255:	74 32                	je     289 <memcmp+0x50>
+    if(*s1 != *s2)
+     257:	0f b6 02             	movzbl (%edx),%eax
+     25a:	0f b6 19             	movzbl (%ecx),%ebx
+     25d:	38 d8                	cmp    %bl,%al
+     25f:	75 20                	jne    281 <memcmp+0x48>
+      return *s1 - *s2;
+    s1++, s2++;
+     261:	83 c2 01             	add    $0x1,%edx
+     264:	83 c1 01             	add    $0x1,%ecx
+  while(n-- > 0){
+     267:	89 f0                	mov    %esi,%eax
+     269:	eb e5                	jmp    250 <memcmp+0x17>
+      s1 += 4, s2 += 4;
+     26b:	83 c2 04             	add    $0x4,%edx
+     26e:	83 c1 04             	add    $0x4,%ecx
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+     271:	83 e8 04             	sub    $0x4,%eax
+     274:	83 f8 03             	cmp    $0x3,%eax
+     277:	76 d7                	jbe    250 <memcmp+0x17>
+     279:	8b 31                	mov    (%ecx),%esi
+     27b:	39 32                	cmp    %esi,(%edx)
+     27d:	74 ec                	je     26b <memcmp+0x32>
+     27f:	eb cf                	jmp    250 <memcmp+0x17>
+      return *s1 - *s2;
+     281:	0f b6 c0             	movzbl %al,%eax
+     284:	0f b6 db             	movzbl %bl,%ebx
+     287:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     289:	5b                   	pop    %ebx
+     28a:	5e                   	pop    %esi
+     28b:	5d                   	pop    %ebp
+     28c:	c3                   	ret
+
+0000028d <memchr>:
+// The first c in the n bytes at v, or 0.  Once aligned, a word at
+// a time, with the word's bytes that equal c turned into zeroes
+// and those looked for.
+void*
+memchr(const void *v, int c, uint n)
+{
+     28d:	55                   	push   %ebp
+     28e:	89 e5                	mov    %esp,%ebp
+     290:	57                   	push   %edi
+     291:	56                   	push   %esi
+     292:	53                   	push   %ebx
+     293:	8b 45 08             	mov    0x8(%ebp),%eax
+     296:	8b 55 10             	mov    0x10(%ebp),%edx
+  const uchar *s;
+  uint w, rep;
+
+  s = v;
+  c = (uchar)c;
+     299:	0f b6 75 0c          	movzbl 0xc(%ebp),%esi
+  for(; n > 0 && ((uint)s & 3); n--, s++)
+     29d:	eb 06                	jmp    2a5 <memchr+0x18>
+     29f:	83 ea 01             	sub    $0x1,%edx
+     2a2:	83 c0 01             	add    $0x1,%eax
+     2a5:	85 d2                	test   %edx,%edx
+     2a7:	74 0d                	je     2b6 <memchr+0x29>
+     2a9:	a8 03                	test   $0x3,%al
+     2ab:	74 09                	je     2b6 <memchr+0x29>
+    if(*s == c)
+     2ad:	0f b6 08             	movzbl (%eax),%ecx
+     2b0:	39 f1                	cmp    %esi,%ecx
+     2b2:	75 eb                	jne    29f <memchr+0x12>
+     2b4:	eb 41                	jmp    2f7 <memchr+0x6a>
+      return (void*)s;
+  rep = c * 0x01010101;
+     2b6:	69 fe 01 01 01 01    	imul   $0x1010101,%esi,%edi
+  for(; n >= 4; n -= 4, s += 4){
+     2bc:	eb 06                	jmp    2c4 <memchr+0x37>
+     2be:	83 ea 04             	sub    $0x4,%edx
+     2c1:	83 c0 04             	add    $0x4,%eax
+     2c4:	83 fa 03             	cmp    $0x3,%edx
+     2c7:	76 16                	jbe    2df <memchr+0x52>
+    w = *(uint*)s ^ rep;
+     2c9:	89 f9                	mov    %edi,%ecx
+     2cb:	33 08                	xor    (%eax),%ecx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     2cd:	8d 99 ff fe fe fe    	lea    -0x1010101(%ecx),%ebx
+     2d3:	f7 d1                	not    %ecx
+     2d5:	21 cb                	and    %ecx,%ebx
+     2d7:	f7 c3 80 80 80 80    	test   $0x80808080,%ebx
+     2dd:	74 df                	je     2be <memchr+0x31>
+      break;
+  }
+  for(; n > 0; n--, s++)
+     2df:	85 d2                	test   %edx,%edx
+     2e1:	74 0f                	je     2f2 <memchr+0x65>
+    if(*s == c)
+     2e3:	0f b6 08             	movzbl (%eax),%ecx
+     2e6:	39 f1                	cmp    %esi,%ecx
+     2e8:	74 0d                	je     2f7 <memchr+0x6a>
+  for(; n > 0; n--, s++)
+     2ea:	83 ea 01             	sub    $0x1,%edx
+     2ed:	83 c0 01             	add    $0x1,%eax
+     2f0:	eb ed                	jmp    2df <memchr+0x52>
+      return (void*)s;
+  return 0;
+     2f2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     2f7:	5b                   	pop    %ebx
+     2f8:	5e                   	pop    %esi
+     2f9:	5f                   	pop    %edi
+     2fa:	5d                   	pop    %ebp
+     2fb:	c3                   	ret
+
+000002fc <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     2fc:	55                   	push   %ebp
+     2fd:	89 e5                	mov    %esp,%ebp
+     2ff:	57                   	push   %edi
+     300:	56                   	push   %esi
+     301:	53                   	push   %ebx
+     302:	83 ec 1c             	sub    $0x1c,%esp
+     305:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     308:	bb 00 00 00 00       	mov    $0x0,%ebx
+     30d:	89 de                	mov    %ebx,%esi
+     30f:	83 c3 01             	add    $0x1,%ebx
+     312:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     315:	7d 2e                	jge    345 <gets+0x49>
+    cc = read(0, &c, 1);
+     317:	83 ec 04             	sub    $0x4,%esp
+     31a:	6a 01                	push   $0x1
+     31c:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     31f:	50                   	push   %eax
+     320:	6a 00                	push   $0x0
+     322:	e8 51 05 00 00       	call   878 <read>
+    if(cc < 1)
+     327:	83 c4 10             	add    $0x10,%esp
+     32a:	85 c0                	test   %eax,%eax
+     32c:	7e 17                	jle    345 <gets+0x49>
+      break;
+    buf[i++] = c;
+     32e:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     332:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+     335:	3c 0a                	cmp    $0xa,%al
+     337:	0f 94 c2             	sete   %dl
+     33a:	3c 0d                	cmp    $0xd,%al
+     33c:	0f 94 c0             	sete   %al
+     33f:	08 c2                	or     %al,%dl
+     341:	74 ca                	je     30d <gets+0x11>
+    buf[i++] = c;
+     343:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+     345:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+     349:	89 f8                	mov    %edi,%eax
+     34b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     34e:	5b                   	pop    %ebx
+     34f:	5e                   	pop    %esi
+     350:	5f                   	pop    %edi
+     351:	5d                   	pop    %ebp
+     352:	c3                   	ret
+
+00000353 <atoi>:
+  return r;
+}
+
+int
+atoi(const char *s)
+{
+     353:	55                   	push   %ebp
+     354:	89 e5                	mov    %esp,%ebp
+     356:	53                   	push   %ebx
+     357:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+     35a:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+     35f:	eb 10                	jmp    371 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+     361:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+     364:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+     367:	83 c1 01             	add    $0x1,%ecx
+     36a:	0f be c0             	movsbl %al,%eax
+     36d:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+     371:	0f b6 01             	movzbl (%ecx),%eax
+     374:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     377:	80 fb 09             	cmp    $0x9,%bl
+     37a:	76 e5                	jbe    361 <atoi+0xe>
+  return n;
+}
+     37c:	89 d0                	mov    %edx,%eax
+     37e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     381:	c9                   	leave
+     382:	c3                   	ret
+
+00000383 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     383:	55                   	push   %ebp
+     384:	89 e5                	mov    %esp,%ebp
+     386:	57                   	push   %edi
+     387:	56                   	push   %esi
+     388:	53                   	push   %ebx
+     389:	83 ec 08             	sub    $0x8,%esp
+     38c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     38f:	8b 55 0c             	mov    0xc(%ebp),%edx
+     392:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *src;
+  int h;
+
+  dst = vdst;
+  src = vsrc;
+  if(n <= 0)
+     395:	85 c0                	test   %eax,%eax
+     397:	0f 8e 82 00 00 00    	jle    41f <memmove+0x9c>
+    return vdst;
+  if(src < dst && src + n > dst){
+     39d:	39 da                	cmp    %ebx,%edx
+     39f:	73 07                	jae    3a8 <memmove+0x25>
+     3a1:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+     3a4:	39 cb                	cmp    %ecx,%ebx
+     3a6:	72 5e                	jb     406 <memmove+0x83>
+    movsbback(dst + n - 1, src + n - 1, n);
+    return vdst;
+  }
+  if(n >= 16 && (((uint)dst ^ (uint)src) & 3) == 0){
+     3a8:	83 f8 0f             	cmp    $0xf,%eax
+     3ab:	7e 69                	jle    416 <memmove+0x93>
+     3ad:	89 d9                	mov    %ebx,%ecx
+     3af:	31 d1                	xor    %edx,%ecx
+     3b1:	f6 c1 03             	test   $0x3,%cl
+     3b4:	75 73                	jne    429 <memmove+0xa6>
+    h = -(uint)dst & 3;
+     3b6:	89 d9                	mov    %ebx,%ecx
+     3b8:	f7 d9                	neg    %ecx
+     3ba:	83 e1 03             	and    $0x3,%ecx
+}
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsb" :
+     3bd:	89 df                	mov    %ebx,%edi
+     3bf:	89 d6                	mov    %edx,%esi
+     3c1:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+     3c4:	fc                   	cld
+     3c5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    movsb(dst, src, h);
+    dst += h, src += h, n -= h;
+     3c7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+     3ca:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+     3cd:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+     3d0:	29 f0                	sub    %esi,%eax
+    movsl(dst, src, n/4);
+     3d2:	8d 50 03             	lea    0x3(%eax),%edx
+     3d5:	0f 49 d0             	cmovns %eax,%edx
+     3d8:	c1 fa 02             	sar    $0x2,%edx
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+     3db:	89 7d f0             	mov    %edi,-0x10(%ebp)
+     3de:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     3e1:	89 ce                	mov    %ecx,%esi
+     3e3:	89 d1                	mov    %edx,%ecx
+     3e5:	fc                   	cld
+     3e6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    dst += n/4*4, src += n/4*4, n %= 4;
+     3e8:	c1 e2 02             	shl    $0x2,%edx
+     3eb:	8b 7d f0             	mov    -0x10(%ebp),%edi
+     3ee:	01 d7                	add    %edx,%edi
+     3f0:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     3f3:	01 ca                	add    %ecx,%edx
+     3f5:	89 c6                	mov    %eax,%esi
+     3f7:	c1 fe 1f             	sar    $0x1f,%esi
+     3fa:	c1 ee 1e             	shr    $0x1e,%esi
+     3fd:	01 f0                	add    %esi,%eax
+     3ff:	83 e0 03             	and    $0x3,%eax
+     402:	29 f0                	sub    %esi,%eax
+     404:	eb 12                	jmp    418 <memmove+0x95>
+    movsbback(dst + n - 1, src + n - 1, n);
+     406:	8d 78 ff             	lea    -0x1(%eax),%edi
+     409:	8d 34 3a             	lea    (%edx,%edi,1),%esi
+     40c:	01 df                	add    %ebx,%edi
+// Copy cnt bytes down from the last ones, at dst and src, to the
+// first: for overlapping moves up.
+static inline void
+movsbback(void *dst, const void *src, int cnt)
+{
+  asm volatile("std; rep movsb; cld" :
+     40e:	89 c1                	mov    %eax,%ecx
+     410:	fd                   	std
+     411:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     413:	fc                   	cld
+    return vdst;
+     414:	eb 09                	jmp    41f <memmove+0x9c>
+  dst = vdst;
+     416:	89 df                	mov    %ebx,%edi
+  asm volatile("cld; rep movsb" :
+     418:	89 d6                	mov    %edx,%esi
+     41a:	89 c1                	mov    %eax,%ecx
+     41c:	fc                   	cld
+     41d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  }
+  movsb(dst, src, n);
+  return vdst;
+}
+     41f:	89 d8                	mov    %ebx,%eax
+     421:	83 c4 08             	add    $0x8,%esp
+     424:	5b                   	pop    %ebx
+     425:	5e                   	pop    %esi
+     426:	5f                   	pop    %edi
+     427:	5d                   	pop    %ebp
+     428:	c3                   	ret
+  dst = vdst;
+     429:	89 df                	mov    %ebx,%edi
+     42b:	eb eb                	jmp    418 <memmove+0x95>
+
+0000042d <vclock_gettime>:
+
+// clock_gettime() without a system call: read the clock page
+// that the kernel maps at CLOCKPAGE (see clock.h).
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+     42d:	55                   	push   %ebp
+     42e:	89 e5                	mov    %esp,%ebp
+     430:	57                   	push   %edi
+     431:	56                   	push   %esi
+     432:	53                   	push   %ebx
+     433:	83 ec 14             	sub    $0x14,%esp
+  struct clockpage *cp = (struct clockpage*)CLOCKPAGE;
+  uint seq, rem, d;
+  uint64 tsc, ns, now;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+     436:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     43a:	0f 87 a3 00 00 00    	ja     4e3 <vclock_gettime+0xb6>
+    return -1;
+  do {
+    seq = cp->seq;
+     440:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+    __sync_synchronize();
+     445:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    tsc = cp->tsc;
+     44a:	8b 15 10 f0 ff 7f    	mov    0x7ffff010,%edx
+     450:	8b 1d 14 f0 ff 7f    	mov    0x7ffff014,%ebx
+    ns = cp->ns;
+     456:	8b 35 18 f0 ff 7f    	mov    0x7ffff018,%esi
+     45c:	8b 3d 1c f0 ff 7f    	mov    0x7ffff01c,%edi
+    __sync_synchronize();
+     462:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != cp->seq);
+     467:	89 c1                	mov    %eax,%ecx
+     469:	83 e1 01             	and    $0x1,%ecx
+     46c:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     46f:	75 cf                	jne    440 <vclock_gettime+0x13>
+     471:	8b 0d 00 f0 ff 7f    	mov    0x7ffff000,%ecx
+     477:	39 c1                	cmp    %eax,%ecx
+     479:	75 c5                	jne    440 <vclock_gettime+0x13>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+     47b:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     47e:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     481:	0f 31                	rdtsc
+     483:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     486:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     489:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  now = rdtsc();
+  // Less than a tick has passed since the update, so the delta
+  // fits in 32 bits.
+  d = now > tsc ? now - tsc : 0;
+     48c:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     48f:	19 d3                	sbb    %edx,%ebx
+     491:	73 07                	jae    49a <vclock_gettime+0x6d>
+     493:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+     496:	29 d8                	sub    %ebx,%eax
+     498:	89 c1                	mov    %eax,%ecx
+  ns += ((uint64)d * cp->mult) >> cp->shift;
+     49a:	89 c8                	mov    %ecx,%eax
+     49c:	f7 25 04 f0 ff 7f    	mull   0x7ffff004
+     4a2:	0f b6 0d 08 f0 ff 7f 	movzbl 0x7ffff008,%ecx
+     4a9:	0f ad d0             	shrd   %cl,%edx,%eax
+     4ac:	d3 ea                	shr    %cl,%edx
+     4ae:	f6 c1 20             	test   $0x20,%cl
+     4b1:	74 04                	je     4b7 <vclock_gettime+0x8a>
+     4b3:	89 d0                	mov    %edx,%eax
+     4b5:	31 d2                	xor    %edx,%edx
+     4b7:	01 f0                	add    %esi,%eax
+     4b9:	11 fa                	adc    %edi,%edx
+static inline uint
+divl(uint64 n, uint d, uint *r)
+{
+  uint q;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (*r) :
+     4bb:	bb 00 ca 9a 3b       	mov    $0x3b9aca00,%ebx
+     4c0:	f7 f3                	div    %ebx
+  ts->tv_sec = divl(ns, 1000000000, &rem);
+     4c2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     4c5:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = rem;
+     4c7:	89 57 04             	mov    %edx,0x4(%edi)
+  if(clk == CLOCK_REALTIME)
+     4ca:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     4ce:	75 1a                	jne    4ea <vclock_gettime+0xbd>
+    ts->tv_sec += cp->boottime;
+     4d0:	03 05 0c f0 ff 7f    	add    0x7ffff00c,%eax
+     4d6:	89 07                	mov    %eax,(%edi)
+  return 0;
+     4d8:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     4db:	83 c4 14             	add    $0x14,%esp
+     4de:	5b                   	pop    %ebx
+     4df:	5e                   	pop    %esi
+     4e0:	5f                   	pop    %edi
+     4e1:	5d                   	pop    %ebp
+     4e2:	c3                   	ret
+    return -1;
+     4e3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     4e8:	eb f1                	jmp    4db <vclock_gettime+0xae>
+  return 0;
+     4ea:	b8 00 00 00 00       	mov    $0x0,%eax
+     4ef:	eb ea                	jmp    4db <vclock_gettime+0xae>
+
+000004f1 <flush>:
+
+// Write out fd's buffer, or with fd < 0 every buffer.
+// Returns -1 if a write fails.
+int
+flush(int fd)
+{
+     4f1:	55                   	push   %ebp
+     4f2:	89 e5                	mov    %esp,%ebp
+     4f4:	56                   	push   %esi
+     4f5:	53                   	push   %ebx
+     4f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  int r, n;
+
+  if(fd < 0){
+     4f9:	85 c0                	test   %eax,%eax
+     4fb:	78 5d                	js     55a <flush+0x69>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+      if(flush(fd) < 0)
+        r = -1;
+    return r;
+  }
+  if(fd >= NOBUF || (n = obuf[fd].n) == 0)
+     4fd:	83 f8 0f             	cmp    $0xf,%eax
+     500:	7f 64                	jg     566 <flush+0x75>
+     502:	69 d0 08 02 00 00    	imul   $0x208,%eax,%edx
+     508:	8b b2 04 1a 00 00    	mov    0x1a04(%edx),%esi
+     50e:	85 f6                	test   %esi,%esi
+     510:	74 59                	je     56b <flush+0x7a>
+    return 0;
+  obuf[fd].n = 0;
+     512:	c7 82 04 1a 00 00 00 	movl   $0x0,0x1a04(%edx)
+     519:	00 00 00 
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     51c:	81 c2 08 1a 00 00    	add    $0x1a08,%edx
+     522:	83 ec 04             	sub    $0x4,%esp
+     525:	56                   	push   %esi
+     526:	52                   	push   %edx
+     527:	50                   	push   %eax
+     528:	e8 5a 03 00 00       	call   887 <write>
+     52d:	83 c4 10             	add    $0x10,%esp
+     530:	39 f0                	cmp    %esi,%eax
+     532:	75 40                	jne    574 <flush+0x83>
+     534:	be 00 00 00 00       	mov    $0x0,%esi
+     539:	eb 30                	jmp    56b <flush+0x7a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     53b:	83 c3 01             	add    $0x1,%ebx
+     53e:	83 fb 0f             	cmp    $0xf,%ebx
+     541:	7f 28                	jg     56b <flush+0x7a>
+      if(flush(fd) < 0)
+     543:	83 ec 0c             	sub    $0xc,%esp
+     546:	53                   	push   %ebx
+     547:	e8 a5 ff ff ff       	call   4f1 <flush>
+     54c:	83 c4 10             	add    $0x10,%esp
+     54f:	85 c0                	test   %eax,%eax
+     551:	79 e8                	jns    53b <flush+0x4a>
+        r = -1;
+     553:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     558:	eb e1                	jmp    53b <flush+0x4a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     55a:	be 00 00 00 00       	mov    $0x0,%esi
+     55f:	bb 00 00 00 00       	mov    $0x0,%ebx
+     564:	eb d8                	jmp    53e <flush+0x4d>
+    return 0;
+     566:	be 00 00 00 00       	mov    $0x0,%esi
+}
+     56b:	89 f0                	mov    %esi,%eax
+     56d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     570:	5b                   	pop    %ebx
+     571:	5e                   	pop    %esi
+     572:	5d                   	pop    %ebp
+     573:	c3                   	ret
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     574:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     579:	eb f0                	jmp    56b <flush+0x7a>
+
+0000057b <bufreset>:
+
+static void
+bufreset(int fd)
+{
+  if(fd >= 0 && fd < NOBUF){
+     57b:	83 f8 0f             	cmp    $0xf,%eax
+     57e:	76 01                	jbe    581 <bufreset+0x6>
+     580:	c3                   	ret
+{
+     581:	55                   	push   %ebp
+     582:	89 e5                	mov    %esp,%ebp
+     584:	53                   	push   %ebx
+     585:	83 ec 10             	sub    $0x10,%esp
+     588:	89 c3                	mov    %eax,%ebx
+    flush(fd);
+     58a:	50                   	push   %eax
+     58b:	e8 61 ff ff ff       	call   4f1 <flush>
+    obuf[fd].mode = BUNKNOWN;
+     590:	69 db 08 02 00 00    	imul   $0x208,%ebx,%ebx
+     596:	c7 83 00 1a 00 00 00 	movl   $0x0,0x1a00(%ebx)
+     59d:	00 00 00 
+     5a0:	83 c4 10             	add    $0x10,%esp
+  }
+}
+     5a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5a6:	c9                   	leave
+     5a7:	c3                   	ret
+
+000005a8 <bufwrite>:
+
+// Write n bytes from p to fd, through its buffer.
+// Returns n, or -1 if a write fails.
+int
+bufwrite(int fd, const void *p, int n)
+{
+     5a8:	55                   	push   %ebp
+     5a9:	89 e5                	mov    %esp,%ebp
+     5ab:	57                   	push   %edi
+     5ac:	56                   	push   %esi
+     5ad:	53                   	push   %ebx
+     5ae:	83 ec 3c             	sub    $0x3c,%esp
+     5b1:	8b 75 08             	mov    0x8(%ebp),%esi
+     5b4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct stat st;
+  const char *s;
+  int i;
+
+  if(fd < 0 || fd >= NOBUF)
+     5b7:	83 fe 0f             	cmp    $0xf,%esi
+     5ba:	0f 87 a2 00 00 00    	ja     662 <bufwrite+0xba>
+    return write(fd, p, n);
+  if(obuf[fd].mode == BUNKNOWN){
+     5c0:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     5c6:	83 b8 00 1a 00 00 00 	cmpl   $0x0,0x1a00(%eax)
+     5cd:	75 19                	jne    5e8 <bufwrite+0x40>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     5cf:	83 fe 02             	cmp    $0x2,%esi
+     5d2:	0f 85 9c 00 00 00    	jne    674 <bufwrite+0xcc>
+      obuf[fd].mode = BNONE;
+     5d8:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     5de:	c7 80 00 1a 00 00 01 	movl   $0x1,0x1a00(%eax)
+     5e5:	00 00 00 
+    else
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+  }
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     5e8:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     5ee:	89 da                	mov    %ebx,%edx
+     5f0:	03 90 04 1a 00 00    	add    0x1a04(%eax),%edx
+     5f6:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+     5fc:	0f 8f ae 00 00 00    	jg     6b0 <bufwrite+0x108>
+    return -1;
+  if(n >= OBUFSZ)
+     602:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+     608:	0f 8f bd 00 00 00    	jg     6cb <bufwrite+0x123>
+    return write(fd, p, n);
+  memmove(obuf[fd].buf + obuf[fd].n, p, n);
+     60e:	69 d6 08 02 00 00    	imul   $0x208,%esi,%edx
+     614:	8d ba 00 1a 00 00    	lea    0x1a00(%edx),%edi
+     61a:	8b 82 04 1a 00 00    	mov    0x1a04(%edx),%eax
+     620:	83 ec 04             	sub    $0x4,%esp
+     623:	53                   	push   %ebx
+     624:	ff 75 0c             	push   0xc(%ebp)
+     627:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     62a:	8d 84 10 08 1a 00 00 	lea    0x1a08(%eax,%edx,1),%eax
+     631:	50                   	push   %eax
+     632:	e8 4c fd ff ff       	call   383 <memmove>
+  obuf[fd].n += n;
+     637:	01 5f 04             	add    %ebx,0x4(%edi)
+  if(obuf[fd].mode == BNONE)
+     63a:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     63d:	8b 82 00 1a 00 00    	mov    0x1a00(%edx),%eax
+     643:	83 c4 10             	add    $0x10,%esp
+     646:	83 f8 01             	cmp    $0x1,%eax
+     649:	0f 84 91 00 00 00    	je     6e0 <bufwrite+0x138>
+    return flush(fd) < 0 ? -1 : n;
+  if(obuf[fd].mode == BLINE)
+     64f:	83 f8 02             	cmp    $0x2,%eax
+     652:	0f 84 ca 00 00 00    	je     722 <bufwrite+0x17a>
+    for(s = p, i = 0; i < n; i++)
+      if(s[i] == '\n')
+        return flush(fd) < 0 ? -1 : n;
+  return n;
+     658:	89 d8                	mov    %ebx,%eax
+}
+     65a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     65d:	5b                   	pop    %ebx
+     65e:	5e                   	pop    %esi
+     65f:	5f                   	pop    %edi
+     660:	5d                   	pop    %ebp
+     661:	c3                   	ret
+    return write(fd, p, n);
+     662:	83 ec 04             	sub    $0x4,%esp
+     665:	53                   	push   %ebx
+     666:	ff 75 0c             	push   0xc(%ebp)
+     669:	56                   	push   %esi
+     66a:	e8 18 02 00 00       	call   887 <write>
+     66f:	83 c4 10             	add    $0x10,%esp
+     672:	eb e6                	jmp    65a <bufwrite+0xb2>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     674:	83 ec 08             	sub    $0x8,%esp
+     677:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     67a:	50                   	push   %eax
+     67b:	56                   	push   %esi
+     67c:	e8 51 02 00 00       	call   8d2 <fstat>
+     681:	83 c4 10             	add    $0x10,%esp
+     684:	85 c0                	test   %eax,%eax
+     686:	0f 88 4c ff ff ff    	js     5d8 <bufwrite+0x30>
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+     68c:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     691:	74 16                	je     6a9 <bufwrite+0x101>
+     693:	ba 03 00 00 00       	mov    $0x3,%edx
+     698:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     69e:	89 90 00 1a 00 00    	mov    %edx,0x1a00(%eax)
+     6a4:	e9 3f ff ff ff       	jmp    5e8 <bufwrite+0x40>
+     6a9:	ba 02 00 00 00       	mov    $0x2,%edx
+     6ae:	eb e8                	jmp    698 <bufwrite+0xf0>
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     6b0:	83 ec 0c             	sub    $0xc,%esp
+     6b3:	56                   	push   %esi
+     6b4:	e8 38 fe ff ff       	call   4f1 <flush>
+     6b9:	83 c4 10             	add    $0x10,%esp
+     6bc:	85 c0                	test   %eax,%eax
+     6be:	0f 89 3e ff ff ff    	jns    602 <bufwrite+0x5a>
+    return -1;
+     6c4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     6c9:	eb 8f                	jmp    65a <bufwrite+0xb2>
+    return write(fd, p, n);
+     6cb:	83 ec 04             	sub    $0x4,%esp
+     6ce:	53                   	push   %ebx
+     6cf:	ff 75 0c             	push   0xc(%ebp)
+     6d2:	56                   	push   %esi
+     6d3:	e8 af 01 00 00       	call   887 <write>
+     6d8:	83 c4 10             	add    $0x10,%esp
+     6db:	e9 7a ff ff ff       	jmp    65a <bufwrite+0xb2>
+    return flush(fd) < 0 ? -1 : n;
+     6e0:	83 ec 0c             	sub    $0xc,%esp
+     6e3:	56                   	push   %esi
+     6e4:	e8 08 fe ff ff       	call   4f1 <flush>
+     6e9:	83 c4 10             	add    $0x10,%esp
+     6ec:	85 c0                	test   %eax,%eax
+     6ee:	78 07                	js     6f7 <bufwrite+0x14f>
+     6f0:	89 d8                	mov    %ebx,%eax
+     6f2:	e9 63 ff ff ff       	jmp    65a <bufwrite+0xb2>
+     6f7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     6fc:	e9 59 ff ff ff       	jmp    65a <bufwrite+0xb2>
+        return flush(fd) < 0 ? -1 : n;
+     701:	83 ec 0c             	sub    $0xc,%esp
+     704:	56                   	push   %esi
+     705:	e8 e7 fd ff ff       	call   4f1 <flush>
+     70a:	83 c4 10             	add    $0x10,%esp
+     70d:	85 c0                	test   %eax,%eax
+     70f:	78 07                	js     718 <bufwrite+0x170>
+     711:	89 d8                	mov    %ebx,%eax
+     713:	e9 42 ff ff ff       	jmp    65a <bufwrite+0xb2>
+     718:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     71d:	e9 38 ff ff ff       	jmp    65a <bufwrite+0xb2>
+    for(s = p, i = 0; i < n; i++)
+     722:	b8 00 00 00 00       	mov    $0x0,%eax
+     727:	39 d8                	cmp    %ebx,%eax
+     729:	7d 0e                	jge    739 <bufwrite+0x191>
+      if(s[i] == '\n')
+     72b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     72e:	80 3c 01 0a          	cmpb   $0xa,(%ecx,%eax,1)
+     732:	74 cd                	je     701 <bufwrite+0x159>
+    for(s = p, i = 0; i < n; i++)
+     734:	83 c0 01             	add    $0x1,%eax
+     737:	eb ee                	jmp    727 <bufwrite+0x17f>
+  return n;
+     739:	89 d8                	mov    %ebx,%eax
+     73b:	e9 1a ff ff ff       	jmp    65a <bufwrite+0xb2>
+
+00000740 <fork>:
+
+int
+fork(void)
+{
+     740:	55                   	push   %ebp
+     741:	89 e5                	mov    %esp,%ebp
+     743:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     746:	6a ff                	push   $0xffffffff
+     748:	e8 a4 fd ff ff       	call   4f1 <flush>
+  return _fork();
+     74d:	e8 bd 00 00 00       	call   80f <_fork>
+}
+     752:	c9                   	leave
+     753:	c3                   	ret
+
+00000754 <exit>:
+
+int
+exit(void)
+{
+     754:	55                   	push   %ebp
+     755:	89 e5                	mov    %esp,%ebp
+     757:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     75a:	6a ff                	push   $0xffffffff
+     75c:	e8 90 fd ff ff       	call   4f1 <flush>
+  _exit();
+     761:	e8 b8 00 00 00       	call   81e <_exit>
+
+00000766 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     766:	55                   	push   %ebp
+     767:	89 e5                	mov    %esp,%ebp
+     769:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     76c:	6a ff                	push   $0xffffffff
+     76e:	e8 7e fd ff ff       	call   4f1 <flush>
+  return _exec(path, argv);
+     773:	83 c4 08             	add    $0x8,%esp
+     776:	ff 75 0c             	push   0xc(%ebp)
+     779:	ff 75 08             	push   0x8(%ebp)
+     77c:	e8 bb 00 00 00       	call   83c <_exec>
+}
+     781:	c9                   	leave
+     782:	c3                   	ret
+
+00000783 <close>:
+
+int
+close(int fd)
+{
+     783:	55                   	push   %ebp
+     784:	89 e5                	mov    %esp,%ebp
+     786:	53                   	push   %ebx
+     787:	83 ec 04             	sub    $0x4,%esp
+     78a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bufreset(fd);
+     78d:	89 d8                	mov    %ebx,%eax
+     78f:	e8 e7 fd ff ff       	call   57b <bufreset>
+  return _close(fd);
+     794:	83 ec 0c             	sub    $0xc,%esp
+     797:	53                   	push   %ebx
+     798:	e8 90 00 00 00       	call   82d <_close>
+}
+     79d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7a0:	c9                   	leave
+     7a1:	c3                   	ret
+
+000007a2 <stat>:
+{
+     7a2:	55                   	push   %ebp
+     7a3:	89 e5                	mov    %esp,%ebp
+     7a5:	56                   	push   %esi
+     7a6:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     7a7:	83 ec 08             	sub    $0x8,%esp
+     7aa:	6a 00                	push   $0x0
+     7ac:	ff 75 08             	push   0x8(%ebp)
+     7af:	e8 f1 00 00 00       	call   8a5 <open>
+  if(fd < 0)
+     7b4:	83 c4 10             	add    $0x10,%esp
+     7b7:	85 c0                	test   %eax,%eax
+     7b9:	78 24                	js     7df <stat+0x3d>
+     7bb:	89 c3                	mov    %eax,%ebx
+  r = fstat(fd, st);
+     7bd:	83 ec 08             	sub    $0x8,%esp
+     7c0:	ff 75 0c             	push   0xc(%ebp)
+     7c3:	50                   	push   %eax
+     7c4:	e8 09 01 00 00       	call   8d2 <fstat>
+     7c9:	89 c6                	mov    %eax,%esi
+  close(fd);
+     7cb:	89 1c 24             	mov    %ebx,(%esp)
+     7ce:	e8 b0 ff ff ff       	call   783 <close>
+  return r;
+     7d3:	83 c4 10             	add    $0x10,%esp
+}
+     7d6:	89 f0                	mov    %esi,%eax
+     7d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     7db:	5b                   	pop    %ebx
+     7dc:	5e                   	pop    %esi
+     7dd:	5d                   	pop    %ebp
+     7de:	c3                   	ret
+    return -1;
+     7df:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     7e4:	eb f0                	jmp    7d6 <stat+0x34>
+
+000007e6 <dup2>:
+
+int
+dup2(int oldfd, int newfd)
+{
+     7e6:	55                   	push   %ebp
+     7e7:	89 e5                	mov    %esp,%ebp
+     7e9:	56                   	push   %esi
+     7ea:	53                   	push   %ebx
+     7eb:	8b 75 08             	mov    0x8(%ebp),%esi
+     7ee:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(oldfd != newfd)
+     7f1:	39 de                	cmp    %ebx,%esi
+     7f3:	75 11                	jne    806 <dup2+0x20>
+    bufreset(newfd);
+  return _dup2(oldfd, newfd);
+     7f5:	83 ec 08             	sub    $0x8,%esp
+     7f8:	53                   	push   %ebx
+     7f9:	56                   	push   %esi
+     7fa:	e8 4c 00 00 00       	call   84b <_dup2>
+}
+     7ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     802:	5b                   	pop    %ebx
+     803:	5e                   	pop    %esi
+     804:	5d                   	pop    %ebp
+     805:	c3                   	ret
+    bufreset(newfd);
+     806:	89 d8                	mov    %ebx,%eax
+     808:	e8 6e fd ff ff       	call   57b <bufreset>
+     80d:	eb e6                	jmp    7f5 <dup2+0xf>
+
+0000080f <_fork>:
+  1: ret
+
+#define SYSCALL(name) STUB(name, SYS_ ## name)
+
+# ulib.c wraps these, to flush printf()'s buffers first.
+STUB(_fork, SYS_fork)
+     80f:	b8 01 00 00 00       	mov    $0x1,%eax
+     814:	89 e1                	mov    %esp,%ecx
+     816:	ba 1d 08 00 00       	mov    $0x81d,%edx
+     81b:	0f 34                	sysenter
+     81d:	c3                   	ret
+
+0000081e <_exit>:
+STUB(_exit, SYS_exit)
+     81e:	b8 02 00 00 00       	mov    $0x2,%eax
+     823:	89 e1                	mov    %esp,%ecx
+     825:	ba 2c 08 00 00       	mov    $0x82c,%edx
+     82a:	0f 34                	sysenter
+     82c:	c3                   	ret
+
+0000082d <_close>:
+STUB(_close, SYS_close)
+     82d:	b8 15 00 00 00       	mov    $0x15,%eax
+     832:	89 e1                	mov    %esp,%ecx
+     834:	ba 3b 08 00 00       	mov    $0x83b,%edx
+     839:	0f 34                	sysenter
+     83b:	c3                   	ret
+
+0000083c <_exec>:
+STUB(_exec, SYS_exec)
+     83c:	b8 07 00 00 00       	mov    $0x7,%eax
+     841:	89 e1                	mov    %esp,%ecx
+     843:	ba 4a 08 00 00       	mov    $0x84a,%edx
+     848:	0f 34                	sysenter
+     84a:	c3                   	ret
+
+0000084b <_dup2>:
+STUB(_dup2, SYS_dup2)
+     84b:	b8 17 00 00 00       	mov    $0x17,%eax
+     850:	89 e1                	mov    %esp,%ecx
+     852:	ba 59 08 00 00       	mov    $0x859,%edx
+     857:	0f 34                	sysenter
+     859:	c3                   	ret
+
+0000085a <wait>:
+
+SYSCALL(wait)
+     85a:	b8 03 00 00 00       	mov    $0x3,%eax
+     85f:	89 e1                	mov    %esp,%ecx
+     861:	ba 68 08 00 00       	mov    $0x868,%edx
+     866:	0f 34                	sysenter
+     868:	c3                   	ret
+
+00000869 <pipe>:
+SYSCALL(pipe)
+     869:	b8 04 00 00 00       	mov    $0x4,%eax
+     86e:	89 e1                	mov    %esp,%ecx
+     870:	ba 77 08 00 00       	mov    $0x877,%edx
+     875:	0f 34                	sysenter
+     877:	c3                   	ret
+
+00000878 <read>:
+SYSCALL(read)
+     878:	b8 05 00 00 00       	mov    $0x5,%eax
+     87d:	89 e1                	mov    %esp,%ecx
+     87f:	ba 86 08 00 00       	mov    $0x886,%edx
+     884:	0f 34                	sysenter
+     886:	c3                   	ret
+
+00000887 <write>:
+SYSCALL(write)
+     887:	b8 10 00 00 00       	mov    $0x10,%eax
+     88c:	89 e1                	mov    %esp,%ecx
+     88e:	ba 95 08 00 00       	mov    $0x895,%edx
+     893:	0f 34                	sysenter
+     895:	c3                   	ret
+
+00000896 <kill>:
+SYSCALL(kill)
+     896:	b8 06 00 00 00       	mov    $0x6,%eax
+     89b:	89 e1                	mov    %esp,%ecx
+     89d:	ba a4 08 00 00       	mov    $0x8a4,%edx
+     8a2:	0f 34                	sysenter
+     8a4:	c3                   	ret
+
+000008a5 <open>:
+SYSCALL(open)
+     8a5:	b8 0f 00 00 00       	mov    $0xf,%eax
+     8aa:	89 e1                	mov    %esp,%ecx
+     8ac:	ba b3 08 00 00       	mov    $0x8b3,%edx
+     8b1:	0f 34                	sysenter
+     8b3:	c3                   	ret
+
+000008b4 <mknod>:
+SYSCALL(mknod)
+     8b4:	b8 11 00 00 00       	mov    $0x11,%eax
+     8b9:	89 e1                	mov    %esp,%ecx
+     8bb:	ba c2 08 00 00       	mov    $0x8c2,%edx
+     8c0:	0f 34                	sysenter
+     8c2:	c3                   	ret
+
+000008c3 <unlink>:
+SYSCALL(unlink)
+     8c3:	b8 12 00 00 00       	mov    $0x12,%eax
+     8c8:	89 e1                	mov    %esp,%ecx
+     8ca:	ba d1 08 00 00       	mov    $0x8d1,%edx
+     8cf:	0f 34                	sysenter
+     8d1:	c3                   	ret
+
+000008d2 <fstat>:
+SYSCALL(fstat)
+     8d2:	b8 08 00 00 00       	mov    $0x8,%eax
+     8d7:	89 e1                	mov    %esp,%ecx
+     8d9:	ba e0 08 00 00       	mov    $0x8e0,%edx
+     8de:	0f 34                	sysenter
+     8e0:	c3                   	ret
+
+000008e1 <link>:
+SYSCALL(link)
+     8e1:	b8 13 00 00 00       	mov    $0x13,%eax
+     8e6:	89 e1                	mov    %esp,%ecx
+     8e8:	ba ef 08 00 00       	mov    $0x8ef,%edx
+     8ed:	0f 34                	sysenter
+     8ef:	c3                   	ret
+
+000008f0 <mkdir>:
+SYSCALL(mkdir)
+     8f0:	b8 14 00 00 00       	mov    $0x14,%eax
+     8f5:	89 e1                	mov    %esp,%ecx
+     8f7:	ba fe 08 00 00       	mov    $0x8fe,%edx
+     8fc:	0f 34                	sysenter
+     8fe:	c3                   	ret
+
+000008ff <chdir>:
+SYSCALL(chdir)
+     8ff:	b8 09 00 00 00       	mov    $0x9,%eax
+     904:	89 e1                	mov    %esp,%ecx
+     906:	ba 0d 09 00 00       	mov    $0x90d,%edx
+     90b:	0f 34                	sysenter
+     90d:	c3                   	ret
+
+0000090e <dup>:
+SYSCALL(dup)
+     90e:	b8 0a 00 00 00       	mov    $0xa,%eax
+     913:	89 e1                	mov    %esp,%ecx
+     915:	ba 1c 09 00 00       	mov    $0x91c,%edx
+     91a:	0f 34                	sysenter
+     91c:	c3                   	ret
+
+0000091d <getpid>:
+SYSCALL(getpid)
+     91d:	b8 0b 00 00 00       	mov    $0xb,%eax
+     922:	89 e1                	mov    %esp,%ecx
+     924:	ba 2b 09 00 00       	mov    $0x92b,%edx
+     929:	0f 34                	sysenter
+     92b:	c3                   	ret
+
+0000092c <sbrk>:
+SYSCALL(sbrk)
+     92c:	b8 0c 00 00 00       	mov    $0xc,%eax
+     931:	89 e1                	mov    %esp,%ecx
+     933:	ba 3a 09 00 00       	mov    $0x93a,%edx
+     938:	0f 34                	sysenter
+     93a:	c3                   	ret
+
+0000093b <sleep>:
+SYSCALL(sleep)
+     93b:	b8 0d 00 00 00       	mov    $0xd,%eax
+     940:	89 e1                	mov    %esp,%ecx
+     942:	ba 49 09 00 00       	mov    $0x949,%edx
+     947:	0f 34                	sysenter
+     949:	c3                   	ret
+
+0000094a <uptime>:
+SYSCALL(uptime)
+     94a:	b8 0e 00 00 00       	mov    $0xe,%eax
+     94f:	89 e1                	mov    %esp,%ecx
+     951:	ba 58 09 00 00       	mov    $0x958,%edx
+     956:	0f 34                	sysenter
+     958:	c3                   	ret
+
+00000959 <date>:
+SYSCALL(date)
+     959:	b8 16 00 00 00       	mov    $0x16,%eax
+     95e:	89 e1                	mov    %esp,%ecx
+     960:	ba 67 09 00 00       	mov    $0x967,%edx
+     965:	0f 34                	sysenter
+     967:	c3                   	ret
+
+00000968 <faultaround>:
+SYSCALL(faultaround)
+     968:	b8 18 00 00 00       	mov    $0x18,%eax
+     96d:	89 e1                	mov    %esp,%ecx
+     96f:	ba 76 09 00 00       	mov    $0x976,%edx
+     974:	0f 34                	sysenter
+     976:	c3                   	ret
+
+00000977 <faultstat>:
+SYSCALL(faultstat)
+     977:	b8 19 00 00 00       	mov    $0x19,%eax
+     97c:	89 e1                	mov    %esp,%ecx
+     97e:	ba 85 09 00 00       	mov    $0x985,%edx
+     983:	0f 34                	sysenter
+     985:	c3                   	ret
+
+00000986 <mmap>:
+SYSCALL(mmap)
+     986:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     98b:	89 e1                	mov    %esp,%ecx
+     98d:	ba 94 09 00 00       	mov    $0x994,%edx
+     992:	0f 34                	sysenter
+     994:	c3                   	ret
+
+00000995 <munmap>:
+SYSCALL(munmap)
+     995:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     99a:	89 e1                	mov    %esp,%ecx
+     99c:	ba a3 09 00 00       	mov    $0x9a3,%edx
+     9a1:	0f 34                	sysenter
+     9a3:	c3                   	ret
+
+000009a4 <largepages>:
+SYSCALL(largepages)
+     9a4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     9a9:	89 e1                	mov    %esp,%ecx
+     9ab:	ba b2 09 00 00       	mov    $0x9b2,%edx
+     9b0:	0f 34                	sysenter
+     9b2:	c3                   	ret
+
+000009b3 <spawn>:
+SYSCALL(spawn)
+     9b3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     9b8:	89 e1                	mov    %esp,%ecx
+     9ba:	ba c1 09 00 00       	mov    $0x9c1,%edx
+     9bf:	0f 34                	sysenter
+     9c1:	c3                   	ret
+
+000009c2 <setpriority>:
+SYSCALL(setpriority)
+     9c2:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     9c7:	89 e1                	mov    %esp,%ecx
+     9c9:	ba d0 09 00 00       	mov    $0x9d0,%edx
+     9ce:	0f 34                	sysenter
+     9d0:	c3                   	ret
+
+000009d1 <getpriority>:
+SYSCALL(getpriority)
+     9d1:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     9d6:	89 e1                	mov    %esp,%ecx
+     9d8:	ba df 09 00 00       	mov    $0x9df,%edx
+     9dd:	0f 34                	sysenter
+     9df:	c3                   	ret
+
+000009e0 <getprocinfo>:
+SYSCALL(getprocinfo)
+     9e0:	b8 20 00 00 00       	mov    $0x20,%eax
+     9e5:	89 e1                	mov    %esp,%ecx
+     9e7:	ba ee 09 00 00       	mov    $0x9ee,%edx
+     9ec:	0f 34                	sysenter
+     9ee:	c3                   	ret
+
+000009ef <getcpuinfo>:
+SYSCALL(getcpuinfo)
+     9ef:	b8 21 00 00 00       	mov    $0x21,%eax
+     9f4:	89 e1                	mov    %esp,%ecx
+     9f6:	ba fd 09 00 00       	mov    $0x9fd,%edx
+     9fb:	0f 34                	sysenter
+     9fd:	c3                   	ret
+
+000009fe <clone>:
+SYSCALL(clone)
+     9fe:	b8 22 00 00 00       	mov    $0x22,%eax
+     a03:	89 e1                	mov    %esp,%ecx
+     a05:	ba 0c 0a 00 00       	mov    $0xa0c,%edx
+     a0a:	0f 34                	sysenter
+     a0c:	c3                   	ret
+
+00000a0d <join>:
+SYSCALL(join)
+     a0d:	b8 23 00 00 00       	mov    $0x23,%eax
+     a12:	89 e1                	mov    %esp,%ecx
+     a14:	ba 1b 0a 00 00       	mov    $0xa1b,%edx
+     a19:	0f 34                	sysenter
+     a1b:	c3                   	ret
+
+00000a1c <futex_wait>:
+SYSCALL(futex_wait)
+     a1c:	b8 24 00 00 00       	mov    $0x24,%eax
+     a21:	89 e1                	mov    %esp,%ecx
+     a23:	ba 2a 0a 00 00       	mov    $0xa2a,%edx
+     a28:	0f 34                	sysenter
+     a2a:	c3                   	ret
+
+00000a2b <futex_wake>:
+SYSCALL(futex_wake)
+     a2b:	b8 25 00 00 00       	mov    $0x25,%eax
+     a30:	89 e1                	mov    %esp,%ecx
+     a32:	ba 39 0a 00 00       	mov    $0xa39,%edx
+     a37:	0f 34                	sysenter
+     a39:	c3                   	ret
+
+00000a3a <setaffinity>:
+SYSCALL(setaffinity)
+     a3a:	b8 26 00 00 00       	mov    $0x26,%eax
+     a3f:	89 e1                	mov    %esp,%ecx
+     a41:	ba 48 0a 00 00       	mov    $0xa48,%edx
+     a46:	0f 34                	sysenter
+     a48:	c3                   	ret
+
+00000a49 <getaffinity>:
+SYSCALL(getaffinity)
+     a49:	b8 27 00 00 00       	mov    $0x27,%eax
+     a4e:	89 e1                	mov    %esp,%ecx
+     a50:	ba 57 0a 00 00       	mov    $0xa57,%edx
+     a55:	0f 34                	sysenter
+     a57:	c3                   	ret
+
+00000a58 <clock_gettime>:
+SYSCALL(clock_gettime)
+     a58:	b8 28 00 00 00       	mov    $0x28,%eax
+     a5d:	89 e1                	mov    %esp,%ecx
+     a5f:	ba 66 0a 00 00       	mov    $0xa66,%edx
+     a64:	0f 34                	sysenter
+     a66:	c3                   	ret
+
+00000a67 <msleep>:
+SYSCALL(msleep)
+     a67:	b8 29 00 00 00       	mov    $0x29,%eax
+     a6c:	89 e1                	mov    %esp,%ecx
+     a6e:	ba 75 0a 00 00       	mov    $0xa75,%edx
+     a73:	0f 34                	sysenter
+     a75:	c3                   	ret
+
+00000a76 <lockstat>:
+SYSCALL(lockstat)
+     a76:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     a7b:	89 e1                	mov    %esp,%ecx
+     a7d:	ba 84 0a 00 00       	mov    $0xa84,%edx
+     a82:	0f 34                	sysenter
+     a84:	c3                   	ret
+
+00000a85 <bstat>:
+SYSCALL(bstat)
+     a85:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     a8a:	89 e1                	mov    %esp,%ecx
+     a8c:	ba 93 0a 00 00       	mov    $0xa93,%edx
+     a91:	0f 34                	sysenter
+     a93:	c3                   	ret
+
+00000a94 <iostat>:
+SYSCALL(iostat)
+     a94:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     a99:	89 e1                	mov    %esp,%ecx
+     a9b:	ba a2 0a 00 00       	mov    $0xaa2,%edx
+     aa0:	0f 34                	sysenter
+     aa2:	c3                   	ret
+
+00000aa3 <fsync>:
+SYSCALL(fsync)
+     aa3:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     aa8:	89 e1                	mov    %esp,%ecx
+     aaa:	ba b1 0a 00 00       	mov    $0xab1,%edx
+     aaf:	0f 34                	sysenter
+     ab1:	c3                   	ret
+
+00000ab2 <pread>:
+SYSCALL(pread)
+     ab2:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     ab7:	89 e1                	mov    %esp,%ecx
+     ab9:	ba c0 0a 00 00       	mov    $0xac0,%edx
+     abe:	0f 34                	sysenter
+     ac0:	c3                   	ret
+
+00000ac1 <pwrite>:
+SYSCALL(pwrite)
+     ac1:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     ac6:	89 e1                	mov    %esp,%ecx
+     ac8:	ba cf 0a 00 00       	mov    $0xacf,%edx
+     acd:	0f 34                	sysenter
+     acf:	c3                   	ret
+
+00000ad0 <readv>:
+SYSCALL(readv)
+     ad0:	b8 30 00 00 00       	mov    $0x30,%eax
+     ad5:	89 e1                	mov    %esp,%ecx
+     ad7:	ba de 0a 00 00       	mov    $0xade,%edx
+     adc:	0f 34                	sysenter
+     ade:	c3                   	ret
+
+00000adf <writev>:
+SYSCALL(writev)
+     adf:	b8 31 00 00 00       	mov    $0x31,%eax
+     ae4:	89 e1                	mov    %esp,%ecx
+     ae6:	ba ed 0a 00 00       	mov    $0xaed,%edx
+     aeb:	0f 34                	sysenter
+     aed:	c3                   	ret
+
+00000aee <sendfile>:
+SYSCALL(sendfile)
+     aee:	b8 32 00 00 00       	mov    $0x32,%eax
+     af3:	89 e1                	mov    %esp,%ecx
+     af5:	ba fc 0a 00 00       	mov    $0xafc,%edx
+     afa:	0f 34                	sysenter
+     afc:	c3                   	ret
+
+00000afd <fcntl>:
+SYSCALL(fcntl)
+     afd:	b8 33 00 00 00       	mov    $0x33,%eax
+     b02:	89 e1                	mov    %esp,%ecx
+     b04:	ba 0b 0b 00 00       	mov    $0xb0b,%edx
+     b09:	0f 34                	sysenter
+     b0b:	c3                   	ret
+
+00000b0c <mount>:
+SYSCALL(mount)
+     b0c:	b8 34 00 00 00       	mov    $0x34,%eax
+     b11:	89 e1                	mov    %esp,%ecx
+     b13:	ba 1a 0b 00 00       	mov    $0xb1a,%edx
+     b18:	0f 34                	sysenter
+     b1a:	c3                   	ret
+
+00000b1b <getdents>:
+SYSCALL(getdents)
+     b1b:	b8 35 00 00 00       	mov    $0x35,%eax
+     b20:	89 e1                	mov    %esp,%ecx
+     b22:	ba 29 0b 00 00       	mov    $0xb29,%edx
+     b27:	0f 34                	sysenter
+     b29:	c3                   	ret
+
+00000b2a <fstatat>:
+SYSCALL(fstatat)
+     b2a:	b8 36 00 00 00       	mov    $0x36,%eax
+     b2f:	89 e1                	mov    %esp,%ecx
+     b31:	ba 38 0b 00 00       	mov    $0xb38,%edx
+     b36:	0f 34                	sysenter
+     b38:	c3                   	ret
+
+00000b39 <sysstat>:
+SYSCALL(sysstat)
+     b39:	b8 37 00 00 00       	mov    $0x37,%eax
+     b3e:	89 e1                	mov    %esp,%ecx
+     b40:	ba 47 0b 00 00       	mov    $0xb47,%edx
+     b45:	0f 34                	sysenter
+     b47:	c3                   	ret
+
+00000b48 <ringenter>:
+SYSCALL(ringenter)
+     b48:	b8 38 00 00 00       	mov    $0x38,%eax
+     b4d:	89 e1                	mov    %esp,%ecx
+     b4f:	ba 56 0b 00 00       	mov    $0xb56,%edx
+     b54:	0f 34                	sysenter
+     b56:	c3                   	ret
+
+00000b57 <trace>:
+SYSCALL(trace)
+     b57:	b8 39 00 00 00       	mov    $0x39,%eax
+     b5c:	89 e1                	mov    %esp,%ecx
+     b5e:	ba 65 0b 00 00       	mov    $0xb65,%edx
+     b63:	0f 34                	sysenter
+     b65:	c3                   	ret
+
+00000b66 <memstat>:
+SYSCALL(memstat)
+     b66:	b8 3a 00 00 00       	mov    $0x3a,%eax
+     b6b:	89 e1                	mov    %esp,%ecx
+     b6d:	ba 74 0b 00 00       	mov    $0xb74,%edx
+     b72:	0f 34                	sysenter
+     b74:	c3                   	ret
+
+00000b75 <shmget>:
+SYSCALL(shmget)
+     b75:	b8 3b 00 00 00       	mov    $0x3b,%eax
+     b7a:	89 e1                	mov    %esp,%ecx
+     b7c:	ba 83 0b 00 00       	mov    $0xb83,%edx
+     b81:	0f 34                	sysenter
+     b83:	c3                   	ret
+
+00000b84 <shmat>:
+SYSCALL(shmat)
+     b84:	b8 3c 00 00 00       	mov    $0x3c,%eax
+     b89:	89 e1                	mov    %esp,%ecx
+     b8b:	ba 92 0b 00 00       	mov    $0xb92,%edx
+     b90:	0f 34                	sysenter
+     b92:	c3                   	ret
+
+00000b93 <shmdt>:
+SYSCALL(shmdt)
+     b93:	b8 3d 00 00 00       	mov    $0x3d,%eax
+     b98:	89 e1                	mov    %esp,%ecx
+     b9a:	ba a1 0b 00 00       	mov    $0xba1,%edx
+     b9f:	0f 34                	sysenter
+     ba1:	c3                   	ret
+
+00000ba2 <irqstat>:
+SYSCALL(irqstat)
+     ba2:	b8 3e 00 00 00       	mov    $0x3e,%eax
+     ba7:	89 e1                	mov    %esp,%ecx
+     ba9:	ba b0 0b 00 00       	mov    $0xbb0,%edx
+     bae:	0f 34                	sysenter
+     bb0:	c3                   	ret
+
+00000bb1 <irqroute>:
+SYSCALL(irqroute)
+     bb1:	b8 3f 00 00 00       	mov    $0x3f,%eax
+     bb6:	89 e1                	mov    %esp,%ecx
+     bb8:	ba bf 0b 00 00       	mov    $0xbbf,%edx
+     bbd:	0f 34                	sysenter
+     bbf:	c3                   	ret
+
+00000bc0 <putc>:
+  char buf[64];
+};
+
+static void
+putc(struct out *o, char c)
+{
+     bc0:	55                   	push   %ebp
+     bc1:	89 e5                	mov    %esp,%ebp
+     bc3:	56                   	push   %esi
+     bc4:	53                   	push   %ebx
+     bc5:	89 c3                	mov    %eax,%ebx
+     bc7:	89 d6                	mov    %edx,%esi
+  if(o->n == sizeof(o->buf)){
+     bc9:	8b 40 04             	mov    0x4(%eax),%eax
+     bcc:	83 f8 40             	cmp    $0x40,%eax
+     bcf:	74 16                	je     be7 <putc+0x27>
+    bufwrite(o->fd, o->buf, o->n);
+    o->n = 0;
+  }
+  o->buf[o->n++] = c;
+     bd1:	8b 43 04             	mov    0x4(%ebx),%eax
+     bd4:	8d 50 01             	lea    0x1(%eax),%edx
+     bd7:	89 53 04             	mov    %edx,0x4(%ebx)
+     bda:	89 f1                	mov    %esi,%ecx
+     bdc:	88 4c 03 08          	mov    %cl,0x8(%ebx,%eax,1)
+}
+     be0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     be3:	5b                   	pop    %ebx
+     be4:	5e                   	pop    %esi
+     be5:	5d                   	pop    %ebp
+     be6:	c3                   	ret
+    bufwrite(o->fd, o->buf, o->n);
+     be7:	8d 53 08             	lea    0x8(%ebx),%edx
+     bea:	83 ec 04             	sub    $0x4,%esp
+     bed:	50                   	push   %eax
+     bee:	52                   	push   %edx
+     bef:	ff 33                	push   (%ebx)
+     bf1:	e8 b2 f9 ff ff       	call   5a8 <bufwrite>
+    o->n = 0;
+     bf6:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     bfd:	83 c4 10             	add    $0x10,%esp
+     c00:	eb cf                	jmp    bd1 <putc+0x11>
+
+00000c02 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     c02:	55                   	push   %ebp
+     c03:	89 e5                	mov    %esp,%ebp
+     c05:	57                   	push   %edi
+     c06:	56                   	push   %esi
+     c07:	53                   	push   %ebx
+     c08:	83 ec 2c             	sub    $0x2c,%esp
+     c0b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     c0e:	89 d0                	mov    %edx,%eax
+     c10:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+     c12:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     c16:	0f 95 c1             	setne  %cl
+     c19:	c1 ea 1f             	shr    $0x1f,%edx
+     c1c:	84 d1                	test   %dl,%cl
+     c1e:	74 44                	je     c64 <printint+0x62>
+    neg = 1;
+    x = -xx;
+     c20:	f7 d8                	neg    %eax
+     c22:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+     c24:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     c2b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+     c30:	89 c8                	mov    %ecx,%eax
+     c32:	ba 00 00 00 00       	mov    $0x0,%edx
+     c37:	f7 f6                	div    %esi
+     c39:	89 df                	mov    %ebx,%edi
+     c3b:	83 c3 01             	add    $0x1,%ebx
+     c3e:	0f b6 92 30 13 00 00 	movzbl 0x1330(%edx),%edx
+     c45:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+     c49:	89 ca                	mov    %ecx,%edx
+     c4b:	89 c1                	mov    %eax,%ecx
+     c4d:	39 f2                	cmp    %esi,%edx
+     c4f:	73 df                	jae    c30 <printint+0x2e>
+  if(neg)
+     c51:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     c55:	74 31                	je     c88 <printint+0x86>
+    buf[i++] = '-';
+     c57:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+     c5c:	8d 5f 02             	lea    0x2(%edi),%ebx
+     c5f:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     c62:	eb 17                	jmp    c7b <printint+0x79>
+    x = xx;
+     c64:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+     c66:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     c6d:	eb bc                	jmp    c2b <printint+0x29>
+
+  while(--i >= 0)
+    putc(o, buf[i]);
+     c6f:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+     c74:	89 f0                	mov    %esi,%eax
+     c76:	e8 45 ff ff ff       	call   bc0 <putc>
+  while(--i >= 0)
+     c7b:	83 eb 01             	sub    $0x1,%ebx
+     c7e:	79 ef                	jns    c6f <printint+0x6d>
+}
+     c80:	83 c4 2c             	add    $0x2c,%esp
+     c83:	5b                   	pop    %ebx
+     c84:	5e                   	pop    %esi
+     c85:	5f                   	pop    %edi
+     c86:	5d                   	pop    %ebp
+     c87:	c3                   	ret
+     c88:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     c8b:	eb ee                	jmp    c7b <printint+0x79>
+
+00000c8d <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     c8d:	55                   	push   %ebp
+     c8e:	89 e5                	mov    %esp,%ebp
+     c90:	57                   	push   %edi
+     c91:	56                   	push   %esi
+     c92:	53                   	push   %ebx
+     c93:	83 ec 6c             	sub    $0x6c,%esp
+  int c, i, state;
+  uint *ap;
+  struct out out, *o;
+
+  o = &out;
+  o->fd = fd;
+     c96:	8b 45 08             	mov    0x8(%ebp),%eax
+     c99:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  o->n = 0;
+     c9c:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+     ca3:	8d 45 10             	lea    0x10(%ebp),%eax
+     ca6:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  state = 0;
+     ca9:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+     cae:	bb 00 00 00 00       	mov    $0x0,%ebx
+     cb3:	eb 14                	jmp    cc9 <printf+0x3c>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(o, c);
+     cb5:	89 fa                	mov    %edi,%edx
+     cb7:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     cba:	e8 01 ff ff ff       	call   bc0 <putc>
+     cbf:	eb 05                	jmp    cc6 <printf+0x39>
+      }
+    } else if(state == '%'){
+     cc1:	83 fe 25             	cmp    $0x25,%esi
+     cc4:	74 25                	je     ceb <printf+0x5e>
+  for(i = 0; fmt[i]; i++){
+     cc6:	83 c3 01             	add    $0x1,%ebx
+     cc9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     ccc:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+     cd0:	84 c0                	test   %al,%al
+     cd2:	0f 84 20 01 00 00    	je     df8 <printf+0x16b>
+    c = fmt[i] & 0xff;
+     cd8:	0f be f8             	movsbl %al,%edi
+     cdb:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     cde:	85 f6                	test   %esi,%esi
+     ce0:	75 df                	jne    cc1 <printf+0x34>
+      if(c == '%'){
+     ce2:	83 f8 25             	cmp    $0x25,%eax
+     ce5:	75 ce                	jne    cb5 <printf+0x28>
+        state = '%';
+     ce7:	89 c6                	mov    %eax,%esi
+     ce9:	eb db                	jmp    cc6 <printf+0x39>
+      if(c == 'd'){
+     ceb:	83 f8 25             	cmp    $0x25,%eax
+     cee:	0f 84 cf 00 00 00    	je     dc3 <printf+0x136>
+     cf4:	0f 8c dd 00 00 00    	jl     dd7 <printf+0x14a>
+     cfa:	83 f8 78             	cmp    $0x78,%eax
+     cfd:	0f 8f d4 00 00 00    	jg     dd7 <printf+0x14a>
+     d03:	83 f8 63             	cmp    $0x63,%eax
+     d06:	0f 8c cb 00 00 00    	jl     dd7 <printf+0x14a>
+     d0c:	83 e8 63             	sub    $0x63,%eax
+     d0f:	83 f8 15             	cmp    $0x15,%eax
+     d12:	0f 87 bf 00 00 00    	ja     dd7 <printf+0x14a>
+     d18:	ff 24 85 d8 12 00 00 	jmp    *0x12d8(,%eax,4)
+        printint(o, *ap, 10, 1);
+     d1f:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     d22:	8b 17                	mov    (%edi),%edx
+     d24:	83 ec 0c             	sub    $0xc,%esp
+     d27:	6a 01                	push   $0x1
+     d29:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     d2e:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d31:	e8 cc fe ff ff       	call   c02 <printint>
+        ap++;
+     d36:	83 c7 04             	add    $0x4,%edi
+     d39:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     d3c:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(o, '%');
+        putc(o, c);
+      }
+      state = 0;
+     d3f:	be 00 00 00 00       	mov    $0x0,%esi
+     d44:	eb 80                	jmp    cc6 <printf+0x39>
+        printint(o, *ap, 16, 0);
+     d46:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     d49:	8b 17                	mov    (%edi),%edx
+     d4b:	83 ec 0c             	sub    $0xc,%esp
+     d4e:	6a 00                	push   $0x0
+     d50:	b9 10 00 00 00       	mov    $0x10,%ecx
+     d55:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d58:	e8 a5 fe ff ff       	call   c02 <printint>
+        ap++;
+     d5d:	83 c7 04             	add    $0x4,%edi
+     d60:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     d63:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d66:	be 00 00 00 00       	mov    $0x0,%esi
+     d6b:	e9 56 ff ff ff       	jmp    cc6 <printf+0x39>
+        s = (char*)*ap;
+     d70:	8b 45 94             	mov    -0x6c(%ebp),%eax
+     d73:	8b 30                	mov    (%eax),%esi
+        ap++;
+     d75:	83 c0 04             	add    $0x4,%eax
+     d78:	89 45 94             	mov    %eax,-0x6c(%ebp)
+        if(s == 0)
+     d7b:	85 f6                	test   %esi,%esi
+     d7d:	75 15                	jne    d94 <printf+0x107>
+          s = "(null)";
+     d7f:	be cf 12 00 00       	mov    $0x12cf,%esi
+     d84:	eb 0e                	jmp    d94 <printf+0x107>
+          putc(o, *s);
+     d86:	0f be d2             	movsbl %dl,%edx
+     d89:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d8c:	e8 2f fe ff ff       	call   bc0 <putc>
+          s++;
+     d91:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+     d94:	0f b6 16             	movzbl (%esi),%edx
+     d97:	84 d2                	test   %dl,%dl
+     d99:	75 eb                	jne    d86 <printf+0xf9>
+      state = 0;
+     d9b:	be 00 00 00 00       	mov    $0x0,%esi
+     da0:	e9 21 ff ff ff       	jmp    cc6 <printf+0x39>
+        putc(o, *ap);
+     da5:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     da8:	0f be 17             	movsbl (%edi),%edx
+     dab:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     dae:	e8 0d fe ff ff       	call   bc0 <putc>
+        ap++;
+     db3:	83 c7 04             	add    $0x4,%edi
+     db6:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+      state = 0;
+     db9:	be 00 00 00 00       	mov    $0x0,%esi
+     dbe:	e9 03 ff ff ff       	jmp    cc6 <printf+0x39>
+        putc(o, c);
+     dc3:	89 fa                	mov    %edi,%edx
+     dc5:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     dc8:	e8 f3 fd ff ff       	call   bc0 <putc>
+      state = 0;
+     dcd:	be 00 00 00 00       	mov    $0x0,%esi
+     dd2:	e9 ef fe ff ff       	jmp    cc6 <printf+0x39>
+        putc(o, '%');
+     dd7:	ba 25 00 00 00       	mov    $0x25,%edx
+     ddc:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     ddf:	e8 dc fd ff ff       	call   bc0 <putc>
+        putc(o, c);
+     de4:	89 fa                	mov    %edi,%edx
+     de6:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     de9:	e8 d2 fd ff ff       	call   bc0 <putc>
+      state = 0;
+     dee:	be 00 00 00 00       	mov    $0x0,%esi
+     df3:	e9 ce fe ff ff       	jmp    cc6 <printf+0x39>
+    }
+  }
+  if(o->n > 0)
+     df8:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     dfb:	85 c0                	test   %eax,%eax
+     dfd:	7f 08                	jg     e07 <printf+0x17a>
+    bufwrite(fd, o->buf, o->n);
+}
+     dff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e02:	5b                   	pop    %ebx
+     e03:	5e                   	pop    %esi
+     e04:	5f                   	pop    %edi
+     e05:	5d                   	pop    %ebp
+     e06:	c3                   	ret
+    bufwrite(fd, o->buf, o->n);
+     e07:	83 ec 04             	sub    $0x4,%esp
+     e0a:	50                   	push   %eax
+     e0b:	8d 45 a8             	lea    -0x58(%ebp),%eax
+     e0e:	50                   	push   %eax
+     e0f:	ff 75 08             	push   0x8(%ebp)
+     e12:	e8 91 f7 ff ff       	call   5a8 <bufwrite>
+     e17:	83 c4 10             	add    $0x10,%esp
+}
+     e1a:	eb e3                	jmp    dff <printf+0x172>
+
+00000e1c <largefree>:
+  return &b->h;
+}
+
+static void
+largefree(Fblock *b)
+{
+     e1c:	55                   	push   %ebp
+     e1d:	89 e5                	mov    %esp,%ebp
+     e1f:	57                   	push   %edi
+     e20:	56                   	push   %esi
+     e21:	53                   	push   %ebx
+     e22:	83 ec 0c             	sub    $0xc,%esp
+     e25:	89 c1                	mov    %eax,%ecx
+  Fblock **pp, *p, *prev;
+
+  prev = 0;
+     e27:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     e2c:	ba 8c 3a 00 00       	mov    $0x3a8c,%edx
+     e31:	eb 05                	jmp    e38 <largefree+0x1c>
+     e33:	8d 50 08             	lea    0x8(%eax),%edx
+    prev = p;
+     e36:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     e38:	8b 02                	mov    (%edx),%eax
+     e3a:	85 c0                	test   %eax,%eax
+     e3c:	74 04                	je     e42 <largefree+0x26>
+     e3e:	39 c8                	cmp    %ecx,%eax
+     e40:	72 f1                	jb     e33 <largefree+0x17>
+  b->next = p;
+     e42:	89 41 08             	mov    %eax,0x8(%ecx)
+  if(p && (char*)b + b->h.size == (char*)p){
+     e45:	85 c0                	test   %eax,%eax
+     e47:	74 09                	je     e52 <largefree+0x36>
+     e49:	8b 31                	mov    (%ecx),%esi
+     e4b:	8d 3c 31             	lea    (%ecx,%esi,1),%edi
+     e4e:	39 c7                	cmp    %eax,%edi
+     e50:	74 21                	je     e73 <largefree+0x57>
+    b->h.size += p->h.size;
+    b->next = p->next;
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+     e52:	85 db                	test   %ebx,%ebx
+     e54:	74 09                	je     e5f <largefree+0x43>
+     e56:	8b 03                	mov    (%ebx),%eax
+     e58:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+     e5b:	39 ce                	cmp    %ecx,%esi
+     e5d:	74 20                	je     e7f <largefree+0x63>
+    prev->h.size += b->h.size;
+    prev->next = b->next;
+  } else
+    *pp = b;
+     e5f:	89 0a                	mov    %ecx,(%edx)
+
+  // Give the top of the heap back.  With threads sharing the
+  // address space sbrk() cannot shrink it; keep the block then.
+  for(pp = &large; (*pp)->next; pp = &(*pp)->next)
+     e61:	be 8c 3a 00 00       	mov    $0x3a8c,%esi
+     e66:	8b 1e                	mov    (%esi),%ebx
+     e68:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+     e6c:	74 1d                	je     e8b <largefree+0x6f>
+     e6e:	8d 73 08             	lea    0x8(%ebx),%esi
+     e71:	eb f3                	jmp    e66 <largefree+0x4a>
+    b->h.size += p->h.size;
+     e73:	03 30                	add    (%eax),%esi
+     e75:	89 31                	mov    %esi,(%ecx)
+    b->next = p->next;
+     e77:	8b 40 08             	mov    0x8(%eax),%eax
+     e7a:	89 41 08             	mov    %eax,0x8(%ecx)
+     e7d:	eb d3                	jmp    e52 <largefree+0x36>
+    prev->h.size += b->h.size;
+     e7f:	03 01                	add    (%ecx),%eax
+     e81:	89 03                	mov    %eax,(%ebx)
+    prev->next = b->next;
+     e83:	8b 41 08             	mov    0x8(%ecx),%eax
+     e86:	89 43 08             	mov    %eax,0x8(%ebx)
+     e89:	eb d6                	jmp    e61 <largefree+0x45>
+    ;
+  b = *pp;
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     e8b:	89 df                	mov    %ebx,%edi
+     e8d:	03 3b                	add    (%ebx),%edi
+     e8f:	83 ec 0c             	sub    $0xc,%esp
+     e92:	6a 00                	push   $0x0
+     e94:	e8 93 fa ff ff       	call   92c <sbrk>
+     e99:	83 c4 10             	add    $0x10,%esp
+     e9c:	39 c7                	cmp    %eax,%edi
+     e9e:	74 08                	je     ea8 <largefree+0x8c>
+    *pp = 0;
+}
+     ea0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ea3:	5b                   	pop    %ebx
+     ea4:	5e                   	pop    %esi
+     ea5:	5f                   	pop    %edi
+     ea6:	5d                   	pop    %ebp
+     ea7:	c3                   	ret
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     ea8:	8b 03                	mov    (%ebx),%eax
+     eaa:	f7 d8                	neg    %eax
+     eac:	83 ec 0c             	sub    $0xc,%esp
+     eaf:	50                   	push   %eax
+     eb0:	e8 77 fa ff ff       	call   92c <sbrk>
+     eb5:	83 c4 10             	add    $0x10,%esp
+     eb8:	83 f8 ff             	cmp    $0xffffffff,%eax
+     ebb:	74 e3                	je     ea0 <largefree+0x84>
+    *pp = 0;
+     ebd:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+     ec3:	eb db                	jmp    ea0 <largefree+0x84>
+
+00000ec5 <more>:
+{
+     ec5:	55                   	push   %ebp
+     ec6:	89 e5                	mov    %esp,%ebp
+     ec8:	56                   	push   %esi
+     ec9:	53                   	push   %ebx
+     eca:	89 c6                	mov    %eax,%esi
+  pad = -(uint)sbrk(0) & 7;
+     ecc:	83 ec 0c             	sub    $0xc,%esp
+     ecf:	6a 00                	push   $0x0
+     ed1:	e8 56 fa ff ff       	call   92c <sbrk>
+     ed6:	f7 d8                	neg    %eax
+     ed8:	89 c3                	mov    %eax,%ebx
+     eda:	83 e3 07             	and    $0x7,%ebx
+  if((p = sbrk(n + pad)) == (char*)-1)
+     edd:	01 de                	add    %ebx,%esi
+     edf:	89 34 24             	mov    %esi,(%esp)
+     ee2:	e8 45 fa ff ff       	call   92c <sbrk>
+     ee7:	83 c4 10             	add    $0x10,%esp
+     eea:	83 f8 ff             	cmp    $0xffffffff,%eax
+     eed:	74 09                	je     ef8 <more+0x33>
+  return p + pad;
+     eef:	01 d8                	add    %ebx,%eax
+}
+     ef1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ef4:	5b                   	pop    %ebx
+     ef5:	5e                   	pop    %esi
+     ef6:	5d                   	pop    %ebp
+     ef7:	c3                   	ret
+    return 0;
+     ef8:	b8 00 00 00 00       	mov    $0x0,%eax
+     efd:	eb f2                	jmp    ef1 <more+0x2c>
+
+00000eff <slaballoc>:
+{
+     eff:	55                   	push   %ebp
+     f00:	89 e5                	mov    %esp,%ebp
+     f02:	56                   	push   %esi
+     f03:	53                   	push   %ebx
+     f04:	89 c6                	mov    %eax,%esi
+  n = 1 << (MINSHIFT + c);
+     f06:	8d 48 04             	lea    0x4(%eax),%ecx
+     f09:	bb 01 00 00 00       	mov    $0x1,%ebx
+     f0e:	d3 e3                	shl    %cl,%ebx
+  if(slab + n > slabend){
+     f10:	89 d8                	mov    %ebx,%eax
+     f12:	03 05 88 3a 00 00    	add    0x3a88,%eax
+     f18:	39 05 84 3a 00 00    	cmp    %eax,0x3a84
+     f1e:	72 17                	jb     f37 <slaballoc+0x38>
+  h = (Header*)slab;
+     f20:	a1 88 3a 00 00       	mov    0x3a88,%eax
+  slab += n;
+     f25:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+     f28:	89 15 88 3a 00 00    	mov    %edx,0x3a88
+  h->size = n;
+     f2e:	89 18                	mov    %ebx,(%eax)
+  h->class = c;
+     f30:	89 70 04             	mov    %esi,0x4(%eax)
+}
+     f33:	5b                   	pop    %ebx
+     f34:	5e                   	pop    %esi
+     f35:	5d                   	pop    %ebp
+     f36:	c3                   	ret
+    if((p = more(SLABSZ)) == 0)
+     f37:	b8 00 40 00 00       	mov    $0x4000,%eax
+     f3c:	e8 84 ff ff ff       	call   ec5 <more>
+     f41:	85 c0                	test   %eax,%eax
+     f43:	74 ee                	je     f33 <slaballoc+0x34>
+    if(p != slabend)
+     f45:	39 05 84 3a 00 00    	cmp    %eax,0x3a84
+     f4b:	74 05                	je     f52 <slaballoc+0x53>
+      slab = p;
+     f4d:	a3 88 3a 00 00       	mov    %eax,0x3a88
+    slabend = p + SLABSZ;
+     f52:	05 00 40 00 00       	add    $0x4000,%eax
+     f57:	a3 84 3a 00 00       	mov    %eax,0x3a84
+     f5c:	eb c2                	jmp    f20 <slaballoc+0x21>
+
+00000f5e <largealloc>:
+{
+     f5e:	55                   	push   %ebp
+     f5f:	89 e5                	mov    %esp,%ebp
+     f61:	56                   	push   %esi
+     f62:	53                   	push   %ebx
+     f63:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     f65:	b9 8c 3a 00 00       	mov    $0x3a8c,%ecx
+     f6a:	8b 01                	mov    (%ecx),%eax
+     f6c:	85 c0                	test   %eax,%eax
+     f6e:	74 36                	je     fa6 <largealloc+0x48>
+    if(b->h.size < n)
+     f70:	8b 10                	mov    (%eax),%edx
+     f72:	39 da                	cmp    %ebx,%edx
+     f74:	72 24                	jb     f9a <largealloc+0x3c>
+    if(b->h.size - n > SMALLMAX){
+     f76:	29 da                	sub    %ebx,%edx
+     f78:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+     f7e:	76 1f                	jbe    f9f <largealloc+0x41>
+      rest = (Fblock*)((char*)b + n);
+     f80:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+      rest->h.size = b->h.size - n;
+     f83:	89 16                	mov    %edx,(%esi)
+      rest->h.class = LARGE;
+     f85:	c7 46 04 09 00 00 00 	movl   $0x9,0x4(%esi)
+      rest->next = b->next;
+     f8c:	8b 50 08             	mov    0x8(%eax),%edx
+     f8f:	89 56 08             	mov    %edx,0x8(%esi)
+      *pp = rest;
+     f92:	89 31                	mov    %esi,(%ecx)
+      b->h.size = n;
+     f94:	89 18                	mov    %ebx,(%eax)
+}
+     f96:	5b                   	pop    %ebx
+     f97:	5e                   	pop    %esi
+     f98:	5d                   	pop    %ebp
+     f99:	c3                   	ret
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     f9a:	8d 48 08             	lea    0x8(%eax),%ecx
+     f9d:	eb cb                	jmp    f6a <largealloc+0xc>
+      *pp = b->next;
+     f9f:	8b 50 08             	mov    0x8(%eax),%edx
+     fa2:	89 11                	mov    %edx,(%ecx)
+    return &b->h;
+     fa4:	eb f0                	jmp    f96 <largealloc+0x38>
+  if((b = more(n)) == 0)
+     fa6:	89 d8                	mov    %ebx,%eax
+     fa8:	e8 18 ff ff ff       	call   ec5 <more>
+     fad:	85 c0                	test   %eax,%eax
+     faf:	74 e5                	je     f96 <largealloc+0x38>
+  b->h.size = n;
+     fb1:	89 18                	mov    %ebx,(%eax)
+  b->h.class = LARGE;
+     fb3:	c7 40 04 09 00 00 00 	movl   $0x9,0x4(%eax)
+  return &b->h;
+     fba:	eb da                	jmp    f96 <largealloc+0x38>
+
+00000fbc <free>:
+
+void
+free(void *ap)
+{
+     fbc:	55                   	push   %ebp
+     fbd:	89 e5                	mov    %esp,%ebp
+     fbf:	56                   	push   %esi
+     fc0:	53                   	push   %ebx
+     fc1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+
+  if(ap == 0)
+     fc4:	85 db                	test   %ebx,%ebx
+     fc6:	74 3b                	je     1003 <free+0x47>
+    return;
+  h = (Header*)ap - 1;
+     fc8:	8d 73 f8             	lea    -0x8(%ebx),%esi
+  lock_acquire(&lock);
+     fcb:	83 ec 0c             	sub    $0xc,%esp
+     fce:	68 80 3a 00 00       	push   $0x3a80
+     fd3:	e8 9c 01 00 00       	call   1174 <lock_acquire>
+  if(h->class == LARGE)
+     fd8:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     fdb:	83 c4 10             	add    $0x10,%esp
+     fde:	83 f8 09             	cmp    $0x9,%eax
+     fe1:	74 27                	je     100a <free+0x4e>
+    largefree((Fblock*)h);
+  else {
+    ((Fblock*)h)->next = freelist[h->class];
+     fe3:	8b 14 85 a0 3a 00 00 	mov    0x3aa0(,%eax,4),%edx
+     fea:	89 13                	mov    %edx,(%ebx)
+    freelist[h->class] = (Fblock*)h;
+     fec:	89 34 85 a0 3a 00 00 	mov    %esi,0x3aa0(,%eax,4)
+  }
+  lock_release(&lock);
+     ff3:	83 ec 0c             	sub    $0xc,%esp
+     ff6:	68 80 3a 00 00       	push   $0x3a80
+     ffb:	e8 88 01 00 00       	call   1188 <lock_release>
+    1000:	83 c4 10             	add    $0x10,%esp
+}
+    1003:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1006:	5b                   	pop    %ebx
+    1007:	5e                   	pop    %esi
+    1008:	5d                   	pop    %ebp
+    1009:	c3                   	ret
+    largefree((Fblock*)h);
+    100a:	89 f0                	mov    %esi,%eax
+    100c:	e8 0b fe ff ff       	call   e1c <largefree>
+    1011:	eb e0                	jmp    ff3 <free+0x37>
+
+00001013 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1013:	55                   	push   %ebp
+    1014:	89 e5                	mov    %esp,%ebp
+    1016:	53                   	push   %ebx
+    1017:	83 ec 04             	sub    $0x4,%esp
+    101a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+  uint n;
+  int c;
+
+  if(nbytes > 0x7fffffff - sizeof(Header) - 7)
+    101d:	81 fb f0 ff ff 7f    	cmp    $0x7ffffff0,%ebx
+    1023:	0f 87 8b 00 00 00    	ja     10b4 <malloc+0xa1>
+    return 0;
+  n = (nbytes + sizeof(Header) + 7) & ~7;
+    1029:	83 c3 0f             	add    $0xf,%ebx
+    102c:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(n < sizeof(Fblock))
+    102f:	83 fb 0b             	cmp    $0xb,%ebx
+    1032:	77 05                	ja     1039 <malloc+0x26>
+    n = sizeof(Fblock);
+    1034:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  lock_acquire(&lock);
+    1039:	83 ec 0c             	sub    $0xc,%esp
+    103c:	68 80 3a 00 00       	push   $0x3a80
+    1041:	e8 2e 01 00 00       	call   1174 <lock_acquire>
+  if(n <= SMALLMAX){
+    1046:	83 c4 10             	add    $0x10,%esp
+    1049:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+    104f:	77 58                	ja     10a9 <malloc+0x96>
+    for(c = 0; (1 << (MINSHIFT + c)) < n; c++)
+    1051:	ba 00 00 00 00       	mov    $0x0,%edx
+    1056:	eb 03                	jmp    105b <malloc+0x48>
+    1058:	83 c2 01             	add    $0x1,%edx
+    105b:	8d 4a 04             	lea    0x4(%edx),%ecx
+    105e:	b8 01 00 00 00       	mov    $0x1,%eax
+    1063:	d3 e0                	shl    %cl,%eax
+    1065:	39 d8                	cmp    %ebx,%eax
+    1067:	72 ef                	jb     1058 <malloc+0x45>
+      ;
+    if(freelist[c]){
+    1069:	8b 04 95 a0 3a 00 00 	mov    0x3aa0(,%edx,4),%eax
+    1070:	85 c0                	test   %eax,%eax
+    1072:	74 2a                	je     109e <malloc+0x8b>
+      h = &freelist[c]->h;
+    1074:	89 c3                	mov    %eax,%ebx
+      freelist[c] = freelist[c]->next;
+    1076:	8b 40 08             	mov    0x8(%eax),%eax
+    1079:	89 04 95 a0 3a 00 00 	mov    %eax,0x3aa0(,%edx,4)
+    } else
+      h = slaballoc(c);
+  } else
+    h = largealloc(n);
+  lock_release(&lock);
+    1080:	83 ec 0c             	sub    $0xc,%esp
+    1083:	68 80 3a 00 00       	push   $0x3a80
+    1088:	e8 fb 00 00 00       	call   1188 <lock_release>
+  return h ? (void*)(h + 1) : 0;
+    108d:	83 c4 10             	add    $0x10,%esp
+    1090:	85 db                	test   %ebx,%ebx
+    1092:	74 03                	je     1097 <malloc+0x84>
+    1094:	83 c3 08             	add    $0x8,%ebx
+}
+    1097:	89 d8                	mov    %ebx,%eax
+    1099:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    109c:	c9                   	leave
+    109d:	c3                   	ret
+      h = slaballoc(c);
+    109e:	89 d0                	mov    %edx,%eax
+    10a0:	e8 5a fe ff ff       	call   eff <slaballoc>
+    10a5:	89 c3                	mov    %eax,%ebx
+    10a7:	eb d7                	jmp    1080 <malloc+0x6d>
+    h = largealloc(n);
+    10a9:	89 d8                	mov    %ebx,%eax
+    10ab:	e8 ae fe ff ff       	call   f5e <largealloc>
+    10b0:	89 c3                	mov    %eax,%ebx
+    10b2:	eb cc                	jmp    1080 <malloc+0x6d>
+    return 0;
+    10b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    10b9:	eb dc                	jmp    1097 <malloc+0x84>
+
+000010bb <tstart>:
+  void *arg;
+};
+
+static void
+tstart(void *a)
+{
+    10bb:	55                   	push   %ebp
+    10bc:	89 e5                	mov    %esp,%ebp
+    10be:	83 ec 14             	sub    $0x14,%esp
+    10c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+    10c4:	ff 70 04             	push   0x4(%eax)
+    10c7:	ff 10                	call   *(%eax)
+  exit();
+    10c9:	e8 86 f6 ff ff       	call   754 <exit>
+
+000010ce <thread_create>:
+}
+
+// Run fn(arg) in a new thread.  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    10ce:	55                   	push   %ebp
+    10cf:	89 e5                	mov    %esp,%ebp
+    10d1:	56                   	push   %esi
+    10d2:	53                   	push   %ebx
+  struct tstart *t;
+  char *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    10d3:	83 ec 0c             	sub    $0xc,%esp
+    10d6:	68 00 10 00 00       	push   $0x1000
+    10db:	e8 33 ff ff ff       	call   1013 <malloc>
+    10e0:	83 c4 10             	add    $0x10,%esp
+    10e3:	85 c0                	test   %eax,%eax
+    10e5:	74 42                	je     1129 <thread_create+0x5b>
+    10e7:	89 c3                	mov    %eax,%ebx
+    return -1;
+  t = (struct tstart*)stack;
+  t->fn = fn;
+    10e9:	8b 45 08             	mov    0x8(%ebp),%eax
+    10ec:	89 03                	mov    %eax,(%ebx)
+  t->arg = arg;
+    10ee:	8b 45 0c             	mov    0xc(%ebp),%eax
+    10f1:	89 43 04             	mov    %eax,0x4(%ebx)
+  if((pid = clone(tstart, stack + TSTACK, t)) < 0)
+    10f4:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    10fa:	83 ec 04             	sub    $0x4,%esp
+    10fd:	53                   	push   %ebx
+    10fe:	50                   	push   %eax
+    10ff:	68 bb 10 00 00       	push   $0x10bb
+    1104:	e8 f5 f8 ff ff       	call   9fe <clone>
+    1109:	89 c6                	mov    %eax,%esi
+    110b:	83 c4 10             	add    $0x10,%esp
+    110e:	85 c0                	test   %eax,%eax
+    1110:	78 09                	js     111b <thread_create+0x4d>
+    free(stack);
+  return pid;
+}
+    1112:	89 f0                	mov    %esi,%eax
+    1114:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1117:	5b                   	pop    %ebx
+    1118:	5e                   	pop    %esi
+    1119:	5d                   	pop    %ebp
+    111a:	c3                   	ret
+    free(stack);
+    111b:	83 ec 0c             	sub    $0xc,%esp
+    111e:	53                   	push   %ebx
+    111f:	e8 98 fe ff ff       	call   fbc <free>
+    1124:	83 c4 10             	add    $0x10,%esp
+    1127:	eb e9                	jmp    1112 <thread_create+0x44>
+    return -1;
+    1129:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    112e:	eb e2                	jmp    1112 <thread_create+0x44>
+
+00001130 <thread_join>:
+
+// Wait for one of this process's threads to exit and free its
+// stack.  Returns its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+    1130:	55                   	push   %ebp
+    1131:	89 e5                	mov    %esp,%ebp
+    1133:	53                   	push   %ebx
+    1134:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    1137:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    113a:	50                   	push   %eax
+    113b:	e8 cd f8 ff ff       	call   a0d <join>
+    1140:	89 c3                	mov    %eax,%ebx
+    1142:	83 c4 10             	add    $0x10,%esp
+    1145:	85 c0                	test   %eax,%eax
+    1147:	79 07                	jns    1150 <thread_join+0x20>
+    free((char*)stack - TSTACK);
+  return pid;
+}
+    1149:	89 d8                	mov    %ebx,%eax
+    114b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    114e:	c9                   	leave
+    114f:	c3                   	ret
+    free((char*)stack - TSTACK);
+    1150:	83 ec 0c             	sub    $0xc,%esp
+    1153:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1156:	2d 00 10 00 00       	sub    $0x1000,%eax
+    115b:	50                   	push   %eax
+    115c:	e8 5b fe ff ff       	call   fbc <free>
+    1161:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    1164:	eb e3                	jmp    1149 <thread_join+0x19>
+
+00001166 <lock_init>:
+
+void
+lock_init(lock_t *lk)
+{
+    1166:	55                   	push   %ebp
+    1167:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    1169:	8b 45 08             	mov    0x8(%ebp),%eax
+    116c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1172:	5d                   	pop    %ebp
+    1173:	c3                   	ret
+
+00001174 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+    1174:	55                   	push   %ebp
+    1175:	89 e5                	mov    %esp,%ebp
+    1177:	8b 55 08             	mov    0x8(%ebp),%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    117a:	b8 01 00 00 00       	mov    $0x1,%eax
+    117f:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    1182:	85 c0                	test   %eax,%eax
+    1184:	75 f4                	jne    117a <lock_acquire+0x6>
+    ;
+}
+    1186:	5d                   	pop    %ebp
+    1187:	c3                   	ret
+
+00001188 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+    1188:	55                   	push   %ebp
+    1189:	89 e5                	mov    %esp,%ebp
+    118b:	8b 55 08             	mov    0x8(%ebp),%edx
+    118e:	b8 00 00 00 00       	mov    $0x0,%eax
+    1193:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    1196:	5d                   	pop    %ebp
+    1197:	c3                   	ret
+
+00001198 <mutex_init>:
+// Are Tricky": state is 0 when free, 1 when held, 2 when held and
+// others may be waiting.  Unlocking an uncontended mutex costs no
+// system call.
+void
+mutex_init(mutex_t *m)
+{
+    1198:	55                   	push   %ebp
+    1199:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    119b:	8b 45 08             	mov    0x8(%ebp),%eax
+    119e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    11a4:	5d                   	pop    %ebp
+    11a5:	c3                   	ret
+
+000011a6 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+    11a6:	55                   	push   %ebp
+    11a7:	89 e5                	mov    %esp,%ebp
+    11a9:	53                   	push   %ebx
+    11aa:	83 ec 04             	sub    $0x4,%esp
+    11ad:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    11b0:	b8 00 00 00 00       	mov    $0x0,%eax
+    11b5:	b9 01 00 00 00       	mov    $0x1,%ecx
+    11ba:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    11be:	85 c0                	test   %eax,%eax
+    11c0:	74 29                	je     11eb <mutex_lock+0x45>
+    return;
+  if(c != 2)
+    11c2:	83 f8 02             	cmp    $0x2,%eax
+    11c5:	74 20                	je     11e7 <mutex_lock+0x41>
+    11c7:	b8 02 00 00 00       	mov    $0x2,%eax
+    11cc:	f0 87 03             	lock xchg %eax,(%ebx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    11cf:	eb 16                	jmp    11e7 <mutex_lock+0x41>
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    11d1:	83 ec 08             	sub    $0x8,%esp
+    11d4:	6a 02                	push   $0x2
+    11d6:	53                   	push   %ebx
+    11d7:	e8 40 f8 ff ff       	call   a1c <futex_wait>
+  asm volatile("lock; xchgl %0, %1" :
+    11dc:	b8 02 00 00 00       	mov    $0x2,%eax
+    11e1:	f0 87 03             	lock xchg %eax,(%ebx)
+    11e4:	83 c4 10             	add    $0x10,%esp
+  while(c != 0){
+    11e7:	85 c0                	test   %eax,%eax
+    11e9:	75 e6                	jne    11d1 <mutex_lock+0x2b>
+    c = xchg(&m->state, 2);
+  }
+}
+    11eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    11ee:	c9                   	leave
+    11ef:	c3                   	ret
+
+000011f0 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+    11f0:	55                   	push   %ebp
+    11f1:	89 e5                	mov    %esp,%ebp
+    11f3:	83 ec 08             	sub    $0x8,%esp
+    11f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    11f9:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    11fe:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    1202:	83 fa 01             	cmp    $0x1,%edx
+    1205:	75 02                	jne    1209 <mutex_unlock+0x19>
+    m->state = 0;
+    futex_wake(&m->state, 1);
+  }
+}
+    1207:	c9                   	leave
+    1208:	c3                   	ret
+    m->state = 0;
+    1209:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+    120f:	83 ec 08             	sub    $0x8,%esp
+    1212:	6a 01                	push   $0x1
+    1214:	50                   	push   %eax
+    1215:	e8 11 f8 ff ff       	call   a2b <futex_wake>
+    121a:	83 c4 10             	add    $0x10,%esp
+}
+    121d:	eb e8                	jmp    1207 <mutex_unlock+0x17>
+
+0000121f <cond_init>:
+// Condition variable: waiters sleep on a sequence number that
+// every signal bumps, so a signal between the unlock and the
+// futex_wait() in cond_wait() is not lost.
+void
+cond_init(cond_t *c)
+{
+    121f:	55                   	push   %ebp
+    1220:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    1222:	8b 45 08             	mov    0x8(%ebp),%eax
+    1225:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    122b:	5d                   	pop    %ebp
+    122c:	c3                   	ret
+
+0000122d <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+    122d:	55                   	push   %ebp
+    122e:	89 e5                	mov    %esp,%ebp
+    1230:	57                   	push   %edi
+    1231:	56                   	push   %esi
+    1232:	53                   	push   %ebx
+    1233:	83 ec 18             	sub    $0x18,%esp
+    1236:	8b 75 08             	mov    0x8(%ebp),%esi
+    1239:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    123c:	8b 3e                	mov    (%esi),%edi
+  mutex_unlock(m);
+    123e:	53                   	push   %ebx
+    123f:	e8 ac ff ff ff       	call   11f0 <mutex_unlock>
+  futex_wait(&c->seq, seq);
+    1244:	83 c4 08             	add    $0x8,%esp
+    1247:	57                   	push   %edi
+    1248:	56                   	push   %esi
+    1249:	e8 ce f7 ff ff       	call   a1c <futex_wait>
+  // Others may be waiting for m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+    124e:	83 c4 10             	add    $0x10,%esp
+    1251:	eb 0e                	jmp    1261 <cond_wait+0x34>
+    futex_wait(&m->state, 2);
+    1253:	83 ec 08             	sub    $0x8,%esp
+    1256:	6a 02                	push   $0x2
+    1258:	53                   	push   %ebx
+    1259:	e8 be f7 ff ff       	call   a1c <futex_wait>
+    125e:	83 c4 10             	add    $0x10,%esp
+    1261:	b8 02 00 00 00       	mov    $0x2,%eax
+    1266:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    1269:	85 c0                	test   %eax,%eax
+    126b:	75 e6                	jne    1253 <cond_wait+0x26>
+}
+    126d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1270:	5b                   	pop    %ebx
+    1271:	5e                   	pop    %esi
+    1272:	5f                   	pop    %edi
+    1273:	5d                   	pop    %ebp
+    1274:	c3                   	ret
+
+00001275 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+    1275:	55                   	push   %ebp
+    1276:	89 e5                	mov    %esp,%ebp
+    1278:	83 ec 10             	sub    $0x10,%esp
+    127b:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    127e:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+    1282:	6a 01                	push   $0x1
+    1284:	50                   	push   %eax
+    1285:	e8 a1 f7 ff ff       	call   a2b <futex_wake>
+}
+    128a:	83 c4 10             	add    $0x10,%esp
+    128d:	c9                   	leave
+    128e:	c3                   	ret
+
+0000128f <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+    128f:	55                   	push   %ebp
+    1290:	89 e5                	mov    %esp,%ebp
+    1292:	83 ec 10             	sub    $0x10,%esp
+    1295:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    1298:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, NPROC);
+    129c:	6a 40                	push   $0x40
+    129e:	50                   	push   %eax
+    129f:	e8 87 f7 ff ff       	call   a2b <futex_wake>
+}
+    12a4:	83 c4 10             	add    $0x10,%esp
+    12a7:	c9                   	leave
+    12a8:	c3                   	ret
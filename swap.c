@@ -0,0 +1,145 @@
+// Swap space for anonymous user pages.
+//
+// When a page fault finds no free physical memory, allocpage() in
+// vm.c calls swapout().  It lets swapvictim() in proc.c pick a
+// cold user page, using a clock over the PTE accessed bits, and
+// writes that page to the swap area.  mkfs places the area right
+// after the free bitmap.  The PTE then holds the slot number, with
+// PTE_SWAP set and PTE_P clear, and the next fault on it calls
+// swapin() to read the page back.
+//
+// Slots are reference counted because fork() shares them the
+// way it shares pages.  A slot stays busy while its page is being
+// written, and swapin() waits for that to finish.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+
+#define SLOTBLOCKS (PGSIZE / BSIZE)
+#define NSLOT      (NSWAP / SLOTBLOCKS)
+
+struct {
+  struct spinlock lock;
+  uint dev;
+  uint start;                  // First block of the swap area
+  uint nslot;                  // 0 if the disk has no swap area
+  uchar ref[NSLOT];            // References to each slot; 0 if free
+  uchar busy[NSLOT];           // Page still being written out
+} swap;
+
+// One buffer for all swap I/O, which goes straight to the disk
+// driver, bypassing the buffer cache and the log.
+struct buf swapbuf;
+
+void
+swapinit(int dev)
+{
+  struct superblock sb;
+
+  initlock(&swap.lock, "swap");
+  initsleeplock(&swapbuf.lock, "swapbuf");
+  readsb(dev, &sb);
+  swap.dev = dev;
+  swap.start = sb.swapstart;
+  swap.nslot = sb.nswap / SLOTBLOCKS;
+  if(swap.nslot > NSLOT)
+    swap.nslot = NSLOT;
+}
+
+// Read or write the page at kernel address mem from or to slot.
+static void
+swaprw(char *mem, uint slot, int write)
+{
+  int i;
+
+  acquiresleep(&swapbuf.lock);
+  for(i = 0; i < SLOTBLOCKS; i++){
+    swapbuf.dev = swap.dev;
+    swapbuf.blockno = swap.start + slot*SLOTBLOCKS + i;
+    if(write){
+      memmove(swapbuf.data, mem + i*BSIZE, BSIZE);
+      swapbuf.flags = B_DIRTY;
+    } else {
+      swapbuf.flags = 0;
+    }
+    iderw(&swapbuf);
+    if(!write)
+      memmove(mem + i*BSIZE, swapbuf.data, BSIZE);
+  }
+  releasesleep(&swapbuf.lock);
+}
+
+// Free one page of physical memory by writing a cold user page
+// to swap.  May sleep.  Returns 0 if a page was freed, -1 if not.
+int
+swapout(void)
+{
+  char *mem;
+  uint slot;
+
+  acquire(&swap.lock);
+  for(slot = 0; slot < swap.nslot; slot++)
+    if(swap.ref[slot] == 0 && !swap.busy[slot])
+      break;
+  if(slot == swap.nslot){
+    release(&swap.lock);
+    return -1;
+  }
+  swap.ref[slot] = 1;
+  swap.busy[slot] = 1;
+  release(&swap.lock);
+
+  if((mem = swapvictim(slot)) == 0){
+    acquire(&swap.lock);
+    swap.ref[slot] = 0;
+    swap.busy[slot] = 0;
+    release(&swap.lock);
+    return -1;
+  }
+  swaprw(mem, slot, 1);
+
+  acquire(&swap.lock);
+  swap.busy[slot] = 0;
+  wakeup(&swap.busy[slot]);
+  release(&swap.lock);
+  kfree(mem);
+  return 0;
+}
+
+// Read slot back into the page mem and drop one reference to it.
+void
+swapin(char *mem, uint slot)
+{
+  acquire(&swap.lock);
+  while(swap.busy[slot])
+    sleep(&swap.busy[slot], &swap.lock);
+  release(&swap.lock);
+  swaprw(mem, slot, 0);
+  swapfree(slot);
+}
+
+// Another PTE (fork) refers to slot.
+void
+swapdup(uint slot)
+{
+  acquire(&swap.lock);
+  swap.ref[slot]++;
+  release(&swap.lock);
+}
+
+// A PTE referring to slot went away.
+void
+swapfree(uint slot)
+{
+  acquire(&swap.lock);
+  if(swap.ref[slot] == 0)
+    panic("swapfree");
+  swap.ref[slot]--;
+  release(&swap.lock);
+}
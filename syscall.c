@@ -3,9 +3,12 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
 #include "syscall.h"
+#include "sysstat.h"
+#include "trace.h"
 
 // User code makes a system call with INT T_SYSCALL.
 // System call number in %eax.
@@ -21,28 +24,26 @@ fetchint(uint addr, int *ip)
 
   if(addr >= curproc->sz || addr+4 > curproc->sz)
     return -1;
-  *ip = *(int*)(addr);
-  return 0;
+  return uvmcopyin(curproc, ip, addr, 4);
 }
 
 // Fetch the nul-terminated string at addr from the current process.
-// Doesn't actually copy the string - just sets *pp to point at it.
+// Doesn't actually copy the string - just sets *pp to point at it,
+// with its pages faulted in and pinned like argptr()'s.
 // Returns length of string, not including nul.
 int
 fetchstr(uint addr, char **pp)
 {
-  char *s, *ep;
   struct proc *curproc = myproc();
+  int n;
 
   if(addr >= curproc->sz)
     return -1;
+  if((n = copyinstr(curproc, 0, addr, curproc->sz - addr)) < 0 ||
+     uvmtouch(curproc, addr, n + 1, 0) < 0)
+    return -1;
   *pp = (char*)addr;
-  ep = (char*)curproc->sz;
-  for(s = *pp; s < ep; s++){
-    if(*s == 0)
-      return s - *pp;
-  }
-  return -1;
+  return n;
 }
 
 // Fetch the nth 32-bit system call argument.
@@ -63,7 +64,28 @@ argptr(int n, char **pp, int size)
  
   if(argint(n, &i) < 0)
     return -1;
-  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+  if(size < 0 || uvmcheck(curproc, i, size) < 0)
+    return -1;
+  if(uvmtouch(curproc, i, size, 0) < 0)
+    return -1;
+  *pp = (char*)i;
+  return 0;
+}
+
+// Like argptr(), for a buffer the system call is to write into:
+// its pages are made writable too, so the kernel takes no faults
+// on it.
+int
+argoutptr(int n, char **pp, int size)
+{
+  int i;
+  struct proc *curproc = myproc();
+
+  if(argint(n, &i) < 0)
+    return -1;
+  if(size < 0 || uvmcheck(curproc, i, size) < 0)
+    return -1;
+  if(uvmtouch(curproc, i, size, 1) < 0)
     return -1;
   *pp = (char*)i;
   return 0;
@@ -105,6 +127,46 @@ extern int sys_write(void);
 extern int sys_uptime(void);
 extern int sys_date(void);
 extern int sys_dup2(void);
+extern int sys_faultaround(void);
+extern int sys_faultstat(void);
+extern int sys_mmap(void);
+extern int sys_munmap(void);
+extern int sys_largepages(void);
+extern int sys_spawn(void);
+extern int sys_setpriority(void);
+extern int sys_getpriority(void);
+extern int sys_getprocinfo(void);
+extern int sys_getcpuinfo(void);
+extern int sys_clone(void);
+extern int sys_join(void);
+extern int sys_futex_wait(void);
+extern int sys_futex_wake(void);
+extern int sys_setaffinity(void);
+extern int sys_getaffinity(void);
+extern int sys_clock_gettime(void);
+extern int sys_msleep(void);
+extern int sys_lockstat(void);
+extern int sys_bstat(void);
+extern int sys_iostat(void);
+extern int sys_fsync(void);
+extern int sys_pread(void);
+extern int sys_pwrite(void);
+extern int sys_readv(void);
+extern int sys_writev(void);
+extern int sys_sendfile(void);
+extern int sys_fcntl(void);
+extern int sys_mount(void);
+extern int sys_getdents(void);
+extern int sys_fstatat(void);
+extern int sys_sysstat(void);
+extern int sys_ringenter(void);
+extern int sys_trace(void);
+extern int sys_memstat(void);
+extern int sys_shmget(void);
+extern int sys_shmat(void);
+extern int sys_shmdt(void);
+extern int sys_irqstat(void);
+extern int sys_irqroute(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -130,18 +192,128 @@ static int (*syscalls[])(void) = {
 [SYS_close]   sys_close,
 [SYS_date]    sys_date,
 [SYS_dup2]    sys_dup2,
+[SYS_faultaround] sys_faultaround,
+[SYS_faultstat] sys_faultstat,
+[SYS_mmap]    sys_mmap,
+[SYS_munmap]  sys_munmap,
+[SYS_largepages] sys_largepages,
+[SYS_spawn]   sys_spawn,
+[SYS_setpriority] sys_setpriority,
+[SYS_getpriority] sys_getpriority,
+[SYS_getprocinfo] sys_getprocinfo,
+[SYS_getcpuinfo] sys_getcpuinfo,
+[SYS_clone]   sys_clone,
+[SYS_join]    sys_join,
+[SYS_futex_wait] sys_futex_wait,
+[SYS_futex_wake] sys_futex_wake,
+[SYS_setaffinity] sys_setaffinity,
+[SYS_getaffinity] sys_getaffinity,
+[SYS_clock_gettime] sys_clock_gettime,
+[SYS_msleep] sys_msleep,
+[SYS_lockstat] sys_lockstat,
+[SYS_bstat]   sys_bstat,
+[SYS_iostat]  sys_iostat,
+[SYS_fsync]   sys_fsync,
+[SYS_pread]   sys_pread,
+[SYS_pwrite]  sys_pwrite,
+[SYS_readv]   sys_readv,
+[SYS_writev]  sys_writev,
+[SYS_sendfile] sys_sendfile,
+[SYS_fcntl]   sys_fcntl,
+[SYS_mount]   sys_mount,
+[SYS_getdents] sys_getdents,
+[SYS_fstatat] sys_fstatat,
+[SYS_sysstat] sys_sysstat,
+[SYS_ringenter] sys_ringenter,
+[SYS_trace]   sys_trace,
+[SYS_memstat] sys_memstat,
+[SYS_shmget]  sys_shmget,
+[SYS_shmat]   sys_shmat,
+[SYS_shmdt]   sys_shmdt,
+[SYS_irqstat] sys_irqstat,
+[SYS_irqroute] sys_irqroute,
 
 };
 
+// System call counters of each CPU, summed by sysstat(SS_ALL).
+// Each process has its own too.
+static struct syscount cpusc[NCPU][NSYSCALL];
+
+static void
+sccount(struct syscount *sc, uint64 t)
+{
+  sc->n++;
+  sc->time += t;
+  if(t > sc->max)
+    sc->max = t;
+}
+
+static void
+scadd(struct syscount *to, struct syscount *from)
+{
+  int i;
+
+  for(i = 0; i < NSYSCALL; i++){
+    to[i].n += from[i].n;
+    to[i].time += from[i].time;
+    if(from[i].max > to[i].max)
+      to[i].max = from[i].max;
+  }
+}
+
+// Child, being reaped, leaves its counters and its children's to p.
+void
+sysstatadd(struct proc *p, struct proc *child)
+{
+  scadd(p->sc + NSYSCALL, child->sc);
+  scadd(p->sc + NSYSCALL, child->sc + NSYSCALL);
+}
+
+// Copy the counters of who (SS_ALL, SS_SELF or SS_CHILDREN) to sc.
+int
+getsysstat(int who, struct syscount *sc)
+{
+  struct proc *p = myproc();
+  int i;
+
+  switch(who){
+  case SS_ALL:
+    memset(sc, 0, NSYSCALL*sizeof(*sc));
+    for(i = 0; i < ncpu; i++)
+      scadd(sc, cpusc[i]);
+    return 0;
+  case SS_SELF:
+    memmove(sc, p->sc, NSYSCALL*sizeof(*sc));
+    return 0;
+  case SS_CHILDREN:
+    memmove(sc, p->sc + NSYSCALL, NSYSCALL*sizeof(*sc));
+    return 0;
+  }
+  return -1;
+}
+
 void
 syscall(void)
 {
   int num;
+  uint64 t;
   struct proc *curproc = myproc();
 
   num = curproc->tf->eax;
+  curproc->npin = 0;
   if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
+    TRACE(TC_SYSCALL, TE_SYSCALL, curproc->pid, num);
+    t = rdtsc();
     curproc->tf->eax = syscalls[num]();
+    curproc->npin = 0;
+    t = rdtsc() - t;
+    TRACE(TC_SYSCALL, TE_SYSRET, curproc->pid, curproc->tf->eax);
+    if(num < NSYSCALL){
+      sccount(&curproc->sc[num], t);
+      pushcli();
+      sccount(&cpusc[cpuid()][num], t);
+      popcli();
+    }
   } else {
     cprintf("%d %s: unknown sys call %d\n",
             curproc->pid, curproc->name, num);
@@ -23,4 +23,44 @@
 #define SYS_close  21
 #define SYS_date   22
 #define SYS_dup2   23
+#define SYS_faultaround 24
+#define SYS_faultstat 25
+#define SYS_mmap   26
+#define SYS_munmap 27
+#define SYS_largepages 28
+#define SYS_spawn  29
+#define SYS_setpriority 30
+#define SYS_getpriority 31
+#define SYS_getprocinfo 32
+#define SYS_getcpuinfo 33
+#define SYS_clone  34
+#define SYS_join   35
+#define SYS_futex_wait 36
+#define SYS_futex_wake 37
+#define SYS_setaffinity 38
+#define SYS_getaffinity 39
+#define SYS_clock_gettime 40
+#define SYS_msleep 41
+#define SYS_lockstat 42
+#define SYS_bstat 43
+#define SYS_iostat 44
+#define SYS_fsync 45
+#define SYS_pread 46
+#define SYS_pwrite 47
+#define SYS_readv 48
+#define SYS_writev 49
+#define SYS_sendfile 50
+#define SYS_fcntl  51
+#define SYS_mount  52
+#define SYS_getdents 53
+#define SYS_fstatat 54
+#define SYS_sysstat 55
+#define SYS_ringenter 56
+#define SYS_trace 57
+#define SYS_memstat 58
+#define SYS_shmget 59
+#define SYS_shmat  60
+#define SYS_shmdt  61
+#define SYS_irqstat 62
+#define SYS_irqroute 63
 
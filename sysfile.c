@@ -9,12 +9,16 @@
 #include "param.h"
 #include "stat.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "fs.h"
-#include "spinlock.h"
 #include "sleeplock.h"
 #include "file.h"
 #include "fcntl.h"
+#include "ring.h"
+#include "bstat.h"
+#include "iostat.h"
+#include "uio.h"
 
 
 
@@ -92,9 +96,9 @@ argfd(int n, int *pfd, struct file **pf)
   if(argint(n, &fd) < 0)
     return -1;
 
-  // Comprueba que el descriptor este en el rango permitido entre 0 y 16
+  // Comprueba que el descriptor este en el rango de la tabla del proceso
   // 
-  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+  if(fd < 0 || fd >= myproc()->nofile || (f=myproc()->ofile[fd]) == 0)
     return -1;
 
   if(pfd)
@@ -116,13 +120,17 @@ fdalloc(struct file *f)
   int fd;
   struct proc *curproc = myproc();
 
-  for(fd = 0; fd < NOFILE; fd++){
+  for(fd = 0; fd < curproc->nofile; fd++){
     if(curproc->ofile[fd] == 0){
       curproc->ofile[fd] = f;
       return fd;
     }
   }
-  return -1;
+  // All NOFILE0 in use: move to a table of NOFILE.
+  if(fd == NOFILE || fdgrow(curproc) < 0)
+    return -1;
+  curproc->ofile[fd] = f;
+  return fd;
 }
 
 //dup y dup2 crean una copia del descriptor de fichero oldfd.
@@ -177,7 +185,7 @@ int sys_dup2(void)
 		return -1;
 	}
 
-	// Comprueba que el descriptor este en el rango permitido entre 0 y 16
+	// Comprueba que el descriptor este en el rango permitido entre 0 y NOFILE
 	if ( newfd <= 0 || newfd >= NOFILE){
 		return -1;
 	}
@@ -186,6 +194,11 @@ int sys_dup2(void)
         if( oldfd == newfd){
 		return newfd;
 	}
+
+	// Si newfd no cabe en la tabla de descriptores, la agrandamos
+	if ( newfd >= myproc()->nofile && fdgrow(myproc()) < 0){
+		return -1;
+	}
          
 	// Comprobamos si newfd esta abierto, si lo esta lo cerramos
 	if (myproc()->ofile[newfd] != 0){
@@ -215,7 +228,7 @@ sys_read(void)
   int n;
   char *p;
 
-  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argoutptr(1, &p, n) < 0)
     return -1;
   return fileread(f, p, n);
 }
@@ -232,19 +245,171 @@ sys_write(void)
   return filewrite(f, p, n);
 }
 
+// Read or write n bytes at offset off, leaving the file offset be.
 int
-sys_close(void)
+sys_pread(void)
+{
+  struct file *f;
+  struct iovec iov;
+  int n, off;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argoutptr(1, (char**)&iov.base, n) < 0 ||
+     argint(3, &off) < 0 || off < 0)
+    return -1;
+  iov.len = n;
+  return filereadv(f, &iov, 1, off);
+}
+
+int
+sys_pwrite(void)
+{
+  struct file *f;
+  struct iovec iov;
+  int n, off;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, (char**)&iov.base, n) < 0 ||
+     argint(3, &off) < 0 || off < 0)
+    return -1;
+  iov.len = n;
+  return filewritev(f, &iov, 1, off);
+}
+
+// Fetch the n-th argument as a vector of niov iovecs, the niov-th,
+// into iov[], and check (and pin) each of their buffers.
+static int
+argiov(int n, int niov, struct iovec *iov, int write)
+{
+  struct proc *curproc = myproc();
+  struct iovec *uiov;
+  int i;
+
+  if(niov < 0 || niov > IOVMAX ||
+     argptr(n, (char**)&uiov, niov*sizeof(*uiov)) < 0)
+    return -1;
+  for(i = 0; i < niov; i++){
+    iov[i] = uiov[i];
+    if((int)iov[i].len < 0 ||
+       uvmcheck(curproc, (uint)iov[i].base, iov[i].len) < 0 ||
+       uvmtouch(curproc, (uint)iov[i].base, iov[i].len, write) < 0)
+      return -1;
+  }
+  return 0;
+}
+
+int
+sys_readv(void)
+{
+  struct file *f;
+  struct iovec iov[IOVMAX];
+  int niov;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &niov) < 0 || argiov(1, niov, iov, 1) < 0)
+    return -1;
+  return filereadv(f, iov, niov, -1);
+}
+
+int
+sys_writev(void)
+{
+  struct file *f;
+  struct iovec iov[IOVMAX];
+  int niov;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &niov) < 0 || argiov(1, niov, iov, 0) < 0)
+    return -1;
+  return filewritev(f, iov, niov, -1);
+}
+
+// Copy n bytes from file descriptor in to out, at their offsets,
+// within the kernel.
+int
+sys_sendfile(void)
+{
+  struct file *out, *in;
+  int n;
+
+  if(argfd(0, 0, &out) < 0 || argfd(1, 0, &in) < 0 || argint(2, &n) < 0 || n < 0)
+    return -1;
+  return filesend(out, in, n);
+}
+
+// Only the size of a pipe's buffer can be got or set so far.
+int
+sys_fcntl(void)
+{
+  struct file *f;
+  int cmd, arg;
+
+  if(argfd(0, 0, &f) < 0 || argint(1, &cmd) < 0 || argint(2, &arg) < 0)
+    return -1;
+  if(f->type != FD_PIPE)
+    return -1;
+  switch(cmd){
+  case F_GETPIPE_SZ:
+    return pipesize(f->pipe);
+  case F_SETPIPE_SZ:
+    return pipesetsize(f->pipe, arg);
+  }
+  return -1;
+}
+
+// The open file fd of the current process, or 0.
+static struct file*
+fdfile(int fd)
+{
+  if(fd < 0 || fd >= myproc()->nofile)
+    return 0;
+  return myproc()->ofile[fd];
+}
+
+static int
+fdclose(int fd)
 {
-  int fd;
   struct file *f;
 
-  if(argfd(0, &fd, &f) < 0)
+  if((f = fdfile(fd)) == 0)
     return -1;
   myproc()->ofile[fd] = 0;
   fileclose(f);
   return 0;
 }
 
+int
+sys_close(void)
+{
+  int fd;
+
+  if(argint(0, &fd) < 0)
+    return -1;
+  return fdclose(fd);
+}
+
+static int
+filesync(struct file *f)
+{
+  if(f->type == FD_INODE){
+    begin_op();
+    ilock(f->ip);
+    iflush(f->ip);
+    iunlock(f->ip);
+    end_op();
+  }
+  log_force();
+  return 0;
+}
+
+// Write the delayed blocks of fd's file to the disk, and wait
+// until they and everything logged so far are committed.
+int
+sys_fsync(void)
+{
+  struct file *f;
+
+  if(argfd(0, 0, &f) < 0)
+    return -1;
+  return filesync(f);
+}
+
 int
 sys_fstat(void)
 {
@@ -256,6 +421,51 @@ sys_fstat(void)
   return filestat(f, st);
 }
 
+int
+sys_getdents(void)
+{
+  struct file *f;
+  int n;
+  char *p;
+
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || n < 0 || argptr(1, &p, n) < 0)
+    return -1;
+  return filegetdents(f, p, n);
+}
+
+// stat() of path, relative to the directory open as dirfd, or to
+// the current one if dirfd is AT_FDCWD, without opening it.
+int
+sys_fstatat(void)
+{
+  struct file *f;
+  struct inode *dp, *ip;
+  struct stat *st;
+  char *path;
+  int fd;
+
+  if(argint(0, &fd) < 0 || argstr(1, &path) < 0 ||
+     argptr(2, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  if(fd == AT_FDCWD)
+    dp = myproc()->cwd;
+  else {
+    if(argfd(0, 0, &f) < 0 || f->type != FD_INODE)
+      return -1;
+    dp = f->ip;
+  }
+  begin_op();
+  if((ip = nameiat(dp, path)) == 0){
+    end_op();
+    return -1;
+  }
+  ilockshared(ip);
+  stati(ip, st);
+  iunlockput(ip);
+  end_op();
+  return 0;
+}
+
 // Create the path new as a link to the same inode as old.
 int
 sys_link(void)
@@ -313,10 +523,11 @@ isdirempty(struct inode *dp)
   int off;
   struct dirent de;
 
-  for(off=2*sizeof(de); off<dp->size; off+=sizeof(de)){
+  // "." and ".." are in the first two dirents only if dp is not hashed.
+  for(off=0; off<dp->size; off+=sizeof(de)){
     if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
       panic("isdirempty: readi");
-    if(de.inum != 0)
+    if(de.inum != 0 && namecmp(de.name, ".") != 0 && namecmp(de.name, "..") != 0)
       return 0;
   }
   return 1;
@@ -360,6 +571,7 @@ sys_unlink(void)
   memset(&de, 0, sizeof(de));
   if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
     panic("unlink: writei");
+  dcacheenter(dp->dev, dp->inum, name, 0, 0);
   if(ip->type == T_DIR){
     dp->nlink--;
     iupdate(dp);
@@ -425,17 +637,13 @@ create(char *path, short type, short major, short minor)
   return ip;
 }
 
-int
-sys_open(void)
+static int
+fileopen(char *path, int omode)
 {
-  char *path;
-  int fd, omode;
+  int fd;
   struct file *f;
   struct inode *ip;
 
-  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
-    return -1;
-
   begin_op();
 
   if(omode & O_CREATE){
@@ -449,7 +657,7 @@ sys_open(void)
       end_op();
       return -1;
     }
-    ilock(ip);
+    ilockshared(ip);
     if(ip->type == T_DIR && omode != O_RDONLY){
       iunlockput(ip);
       end_op();
@@ -475,6 +683,91 @@ sys_open(void)
   return fd;
 }
 
+int
+sys_open(void)
+{
+  char *path;
+  int omode;
+
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+    return -1;
+  return fileopen(path, omode);
+}
+
+// Do request e of a ring, pinning its buffer for as long as it
+// takes, as argptr() would.
+static int
+ringdo(struct sqe *e)
+{
+  struct proc *p = myproc();
+  struct iovec iov;
+  struct file *f;
+  char *path;
+  int npin, r;
+
+  switch(e->op){
+  case RING_NOP:
+    return 0;
+  case RING_OPEN:
+    if(fetchstr(e->addr, &path) < 0)
+      return -1;
+    return fileopen(path, e->len);
+  case RING_CLOSE:
+    return fdclose(e->fd);
+  }
+  if((f = fdfile(e->fd)) == 0)
+    return -1;
+  switch(e->op){
+  case RING_READ:
+  case RING_WRITE:
+    if((int)e->len < 0 || uvmcheck(p, e->addr, e->len) < 0)
+      return -1;
+    npin = p->npin;
+    r = -1;
+    if(uvmtouch(p, e->addr, e->len, e->op == RING_READ) == 0){
+      iov.base = (char*)e->addr;
+      iov.len = e->len;
+      if(e->op == RING_READ)
+        r = filereadv(f, &iov, 1, e->off);
+      else
+        r = filewritev(f, &iov, 1, e->off);
+    }
+    p->npin = npin;
+    return r;
+  case RING_FSYNC:
+    return filesync(f);
+  }
+  return -1;
+}
+
+// Do up to n of the requests queued in ring r, in order, as long
+// as there is room for their completions.  One trap for all of
+// them.  Returns how many were done.
+int
+sys_ringenter(void)
+{
+  struct ring *r;
+  struct sqe e;
+  uint tail;
+  int n, done;
+
+  if(argptr(0, (char**)&r, sizeof(*r)) < 0 || argint(1, &n) < 0)
+    return -1;
+  tail = r->sqtail;
+  if(tail - r->sqhead > NRING)
+    return -1;
+  for(done = 0; done < n && r->sqhead != tail; done++){
+    if(r->cqtail - r->cqhead >= NRING)
+      break;
+    e = r->sq[r->sqhead % NRING];
+    r->cq[r->cqtail % NRING].data = e.data;
+    r->cq[r->cqtail % NRING].res = ringdo(&e);
+    r->cqtail++;
+    r->sqhead++;
+  }
+  return done;
+}
+
 int
 sys_mkdir(void)
 {
@@ -523,7 +816,7 @@ sys_chdir(void)
     end_op();
     return -1;
   }
-  ilock(ip);
+  ilockshared(ip);
   if(ip->type != T_DIR){
     iunlockput(ip);
     end_op();
@@ -536,19 +829,54 @@ sys_chdir(void)
   return 0;
 }
 
+// Mount a file system of type fs, only "tmpfs" so far, on the
+// directory path.
 int
-sys_exec(void)
+sys_mount(void)
 {
-  char *path, *argv[MAXARG];
-  int i;
-  uint uargv, uarg;
+  char *fs, *path;
+  struct inode *ip;
 
-  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+  if(argstr(0, &fs) < 0 || argstr(1, &path) < 0)
+    return -1;
+  if(strncmp(fs, "tmpfs", 6) != 0)
+    return -1;
+  begin_op();
+  if((ip = namei(path)) == 0){
+    end_op();
     return -1;
   }
-  memset(argv, 0, sizeof(argv));
+  ilockshared(ip);
+  if(ip->type != T_DIR){
+    iunlockput(ip);
+    end_op();
+    return -1;
+  }
+  iunlock(ip);
+  if(fsmount(ip, TMPDEV) < 0){
+    iput(ip);
+    end_op();
+    return -1;
+  }
+  end_op();
+  return 0;
+}
+
+// Copy the user's null-terminated array of string pointers at
+// uargv, and the strings, into argv[MAXARG] and the page buf: so
+// exec() reads them from the kernel, with no faults on user memory
+// that it is about to free.
+static int
+fetchargv(uint uargv, char **argv, char *buf)
+{
+  struct proc *curproc = myproc();
+  int i, n, used;
+  uint uarg;
+
+  used = 0;
+  memset(argv, 0, MAXARG*sizeof(argv[0]));
   for(i=0;; i++){
-    if(i >= NELEM(argv))
+    if(i >= MAXARG)
       return -1;
     if(fetchint(uargv+4*i, (int*)&uarg) < 0)
       return -1;
@@ -556,10 +884,53 @@ sys_exec(void)
       argv[i] = 0;
       break;
     }
-    if(fetchstr(uarg, &argv[i]) < 0)
+    if((n = copyinstr(curproc, buf + used, uarg, PGSIZE - used)) < 0)
       return -1;
+    argv[i] = buf + used;
+    used += n + 1;
+  }
+  return 0;
+}
+
+int
+sys_exec(void)
+{
+  char *path, *argv[MAXARG], *buf;
+  uint uargv;
+  int r;
+
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+    return -1;
   }
-  return exec(path, argv);
+  if((buf = kalloc()) == 0)
+    return -1;
+  r = -1;
+  if(fetchargv(uargv, argv, buf) == 0)
+    r = exec(path, argv);
+  kfree(buf);
+  return r;
+}
+
+int
+sys_spawn(void)
+{
+  char *path, *argv[MAXARG], *buf;
+  uint uargv;
+  int *fds, ufds, r;
+
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0 ||
+     argint(2, &ufds) < 0)
+    return -1;
+  fds = 0;
+  if(ufds != 0 && argptr(2, (void*)&fds, 3*sizeof(fds[0])) < 0)
+    return -1;
+  if((buf = kalloc()) == 0)
+    return -1;
+  r = -1;
+  if(fetchargv(uargv, argv, buf) == 0)
+    r = spawn(path, argv, fds);
+  kfree(buf);
+  return r;
 }
 
 int
@@ -585,3 +956,110 @@ sys_pipe(void)
   fd[1] = fd1;
   return 0;
 }
+
+// Map len bytes of file fd, from page-aligned offset off, into
+// memory.  The pages are read in on first touch (see filefault()
+// in vm.c) and come from the shared page cache.  With MAP_SHARED,
+// stores go to the file when the range is unmapped or the process
+// exits or execs; with MAP_PRIVATE they stay private.  addr is
+// only a hint and is ignored: mappings are placed top-down below
+// the clock page (CLOCKPAGE), above the heap.  Returns the
+// address, or -1.
+int
+sys_mmap(void)
+{
+  int addr, len, prot, flags, off;
+  uint size, start;
+  struct file *f;
+  struct vma *v;
+  struct proc *curproc = myproc();
+
+  if(argint(0, &addr) < 0 || argint(1, &len) < 0 || argint(2, &prot) < 0 ||
+     argint(3, &flags) < 0 || argfd(4, 0, &f) < 0 || argint(5, &off) < 0)
+    return -1;
+  if(len <= 0 || off < 0 || off % PGSIZE != 0)
+    return -1;
+  if(!(prot & PROT_READ) || (prot & ~(PROT_READ|PROT_WRITE)))
+    return -1;
+  if(flags != MAP_SHARED && flags != MAP_PRIVATE)
+    return -1;
+  if(f->type != FD_INODE || !f->readable)
+    return -1;
+  if(flags == MAP_SHARED && (prot & PROT_WRITE) && !f->writable)
+    return -1;
+  // Threads keep their own copies of vma[] (see clone()).
+  if(curproc->as)
+    return -1;
+
+  for(v = curproc->vma; v < &curproc->vma[NVMA] && v->ip; v++)
+    ;
+  if(v == &curproc->vma[NVMA])
+    return -1;
+  size = PGROUNDUP(len);
+  if(size > curproc->mmapbot || curproc->mmapbot - size < PGROUNDUP(curproc->sz))
+    return -1;
+  start = curproc->mmapbot - size;
+
+  ilockshared(f->ip);
+  if(f->ip->type != T_FILE){
+    iunlock(f->ip);
+    return -1;
+  }
+  v->filesz = 0;
+  if(off < f->ip->size)
+    v->filesz = f->ip->size - off < len ? f->ip->size - off : len;
+  iunlock(f->ip);
+
+  v->start = start;
+  v->end = start + size;
+  v->ip = idup(f->ip);
+  v->off = off;
+  v->prot = prot;
+  v->flags = flags;
+  curproc->mmapbot = start;
+  return start;
+}
+
+// Unmap [addr, addr+len), which must lie within one mapping.
+int
+sys_munmap(void)
+{
+  int addr, len;
+
+  if(argint(0, &addr) < 0 || argint(1, &len) < 0)
+    return -1;
+  if(myproc()->as)
+    return -1;
+  return munmap(myproc(), addr, len);
+}
+
+// Size and hit rate of the buffer cache.
+int
+sys_bstat(void)
+{
+  struct bstat st, *ust;
+
+  if(argptr(0, (char**)&ust, sizeof(*ust)) < 0)
+    return -1;
+  getbstat(&st);
+  *ust = st;
+  return 0;
+}
+
+// Disk queue statistics.  If sched is not null, first switch to
+// the I/O scheduler of that name, which zeroes them.
+int
+sys_iostat(void)
+{
+  struct iostat st, *ust;
+  char *name;
+  int sched;
+
+  if(argint(0, &sched) < 0 || argptr(1, (char**)&ust, sizeof(*ust)) < 0)
+    return -1;
+  if(sched && (argstr(0, &name) < 0 || setiosched(name) < 0))
+    return -1;
+  getiostat(&st);
+  *ust = st;
+  return 0;
+}
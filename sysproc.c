@@ -5,7 +5,14 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
+#include "procinfo.h"
+#include "clock.h"
+#include "lockstat.h"
+#include "trace.h"
+#include "sysstat.h"
+#include "memstat.h"
 
 int
 sys_fork(void)
@@ -70,16 +77,26 @@ sys_sbrk(void)
   if(argint(0, &n) < 0)
     return -1;
 
+  // Los hilos de clone() comparten el tamano: lo leemos y cambiamos con vmlock
+  vmlock(myproc());
+
   // Guardamos el tamano antiguo
   addr = myproc()->sz;
 
   // Si n<0 liberar los marcos mapeados
     if (n < 0){ //Ejercicio 2, en el caso de sys_brk reciba un argumento negativo
 	if(growproc(n) < 0){
-	 return -1;
+	 addr = -1;
 	}
     } 
-    else {  myproc()->sz += n;} //incrementamos el tamano del proceso sin reservar memoria
+    else {  // el heap no puede crecer hasta las regiones de mmap()
+	if(addr + n < addr || addr + n > myproc()->mmapbot)
+	  addr = -1;
+	else
+	  setsz(myproc(), addr + n); //incrementamos el tamano del proceso sin reservar memoria
+    }
+
+  vmunlock(myproc());
 	
    return addr; // devolvemos el tamano antiguo
   
@@ -101,21 +118,24 @@ int
 sys_sleep(void)
 {
   int n;
-  uint ticks0;
 
   if(argint(0, &n) < 0)
     return -1;
-  acquire(&tickslock);
-  ticks0 = ticks;
-  while(ticks - ticks0 < n){
-    if(myproc()->killed){
-      release(&tickslock);
-      return -1;
-    }
-    sleep(&ticks, &tickslock);
-  }
-  release(&tickslock);
-  return 0;
+  if(n < 0)
+    n = 0;
+  return timersleep(nanotime() + (uint64)n * TICKNS);
+}
+
+// Sleep for ms milliseconds, to the resolution of the timer
+// wheel (timer.c) rather than of a tick.
+int
+sys_msleep(void)
+{
+  int ms;
+
+  if(argint(0, &ms) < 0 || ms < 0)
+    return -1;
+  return timersleep(nanotime() + (uint64)ms * 1000000);
 }
 
 // return how many clock tick interrupts have occurred
@@ -137,7 +157,338 @@ int sys_date(void)
     if ( argptr(0,(char**)&r,sizeof(struct rtcdate)) !=0){
         return -1;
 }
-    cmostime(r);
+    clockdate(r); // sin leer el CMOS en cada llamada (ver clock.c)
     return 0;
 }
 
+
+// Set the largest number of heap pages one page fault may map
+// (1 turns fault-around off).  n <= 0 only queries the setting.
+// Returns the previous setting.
+int
+sys_faultaround(void)
+{
+  int n, old;
+
+  if(argint(0, &n) < 0)
+    return -1;
+  old = myproc()->faultaround;
+  if(n > 0){
+    if(n > MAXFAULTAROUND)
+      n = MAXFAULTAROUND;
+    myproc()->faultaround = n;
+    myproc()->faultwin = 0;
+  }
+  return old;
+}
+
+// Turn 4MB heap pages on (on > 0) or off (on == 0) for the calling
+// process; on < 0 only queries the setting.  With it on, heap
+// faults map whole 4MB-aligned ranges below sz with one large
+// page.  Returns the previous setting.
+int
+sys_largepages(void)
+{
+  int on, old;
+
+  if(argint(0, &on) < 0)
+    return -1;
+  old = myproc()->largepages;
+  if(on >= 0)
+    myproc()->largepages = on > 0;
+  return old;
+}
+
+int
+sys_setpriority(void)
+{
+  int pid, prio;
+
+  if(argint(0, &pid) < 0 || argint(1, &prio) < 0)
+    return -1;
+  return setpriority(pid, prio);
+}
+
+int
+sys_getpriority(void)
+{
+  int pid;
+
+  if(argint(0, &pid) < 0)
+    return -1;
+  return getpriority(pid);
+}
+
+// Restrict process pid to the CPUs in mask.
+int
+sys_setaffinity(void)
+{
+  int pid, mask;
+
+  if(argint(0, &pid) < 0 || argint(1, &mask) < 0)
+    return -1;
+  return setaffinity(pid, mask);
+}
+
+int
+sys_getaffinity(void)
+{
+  int pid;
+
+  if(argint(0, &pid) < 0)
+    return -1;
+  return getaffinity(pid);
+}
+
+// Copy page-fault counts (NFAULT entries, indexed by the
+// classes in fault.h) to the user array.  cpu < 0 asks for the
+// calling process's counts, otherwise for that CPU's.
+int
+sys_faultstat(void)
+{
+  int cpu;
+  uint *counts;
+
+  if(argint(0, &cpu) < 0 || argptr(1, (char**)&counts, NFAULT*sizeof(uint)) < 0)
+    return -1;
+  if(cpu >= ncpu)
+    return -1;
+  if(cpu < 0)
+    memmove(counts, myproc()->faults, sizeof(myproc()->faults));
+  else
+    memmove(counts, cpus[cpu].faults, sizeof(cpus[cpu].faults));
+  return 0;
+}
+
+// Statistics of the n-th process in use, for ps.
+int
+sys_getprocinfo(void)
+{
+  int n;
+  struct procinfo *pi;
+
+  if(argint(0, &n) < 0 || argptr(1, (char**)&pi, sizeof(*pi)) < 0)
+    return -1;
+  return getprocinfo(n, pi);
+}
+
+// Busy/idle time, switch count and latency histogram of a CPU.
+int
+sys_getcpuinfo(void)
+{
+  int cpu;
+  struct cpuinfo *ci;
+
+  if(argint(0, &cpu) < 0 || argptr(1, (char**)&ci, sizeof(*ci)) < 0)
+    return -1;
+  return getcpuinfo(cpu, ci);
+}
+
+// Contention counters of the n-th lock, for lockstat; with n < 0,
+// zero those of all locks.
+int
+sys_lockstat(void)
+{
+  int n;
+  struct lockstat ls, *uls;
+
+  if(argint(0, &n) < 0)
+    return -1;
+  if(n < 0)
+    return getlockstat(n, 0);
+  if(argptr(1, (char**)&uls, sizeof(*uls)) < 0 || getlockstat(n, &ls) < 0)
+    return -1;
+  *uls = ls;
+  return 0;
+}
+
+// System call counters of who, for strace -c.
+int
+sys_sysstat(void)
+{
+  int who;
+  struct syscount *sc;
+
+  if(argint(0, &who) < 0 ||
+     argptr(1, (char**)&sc, NSYSCALL*sizeof(*sc)) < 0)
+    return -1;
+  return getsysstat(who, sc);
+}
+
+// Physical memory counters, for free.
+int
+sys_memstat(void)
+{
+  struct memstat *m;
+
+  if(argoutptr(0, (char**)&m, sizeof(*m)) < 0)
+    return -1;
+  kmemstat(m);
+  return 0;
+}
+
+// The id of the shared memory segment named key, made with size
+// bytes if it does not exist yet.
+int
+sys_shmget(void)
+{
+  int key, size;
+
+  if(argint(0, &key) < 0 || argint(1, &size) < 0 || size <= 0)
+    return -1;
+  return shmget(key, size);
+}
+
+// Map segment id into the mmap() area; returns its address.
+int
+sys_shmat(void)
+{
+  int id;
+
+  if(argint(0, &id) < 0)
+    return -1;
+  return shmat(myproc(), id);
+}
+
+// Unmap the segment shmat() returned addr for.
+int
+sys_shmdt(void)
+{
+  int addr;
+
+  if(argint(0, &addr) < 0)
+    return -1;
+  return shmdt(myproc(), addr);
+}
+
+// irqstat(cpu, n) copies the NIRQ interrupt counters of CPU cpu
+// to n; irqstat(-1, n) puts there the CPU each IRQ is routed to,
+// or -1 for IRQs that are not enabled.
+int
+sys_irqstat(void)
+{
+  int cpu;
+  uint *n;
+
+  if(argint(0, &cpu) < 0 || argoutptr(1, (char**)&n, NIRQ*sizeof(*n)) < 0)
+    return -1;
+  if(cpu == -1){
+    irqroutes((int*)n);
+    return 0;
+  }
+  if(cpu < 0 || cpu >= ncpu)
+    return -1;
+  memmove(n, cpus[cpu].nirq, sizeof(cpus[cpu].nirq));
+  return 0;
+}
+
+// Pin an IRQ to a CPU, or give it back to the balancer (cpu -1).
+int
+sys_irqroute(void)
+{
+  int irq, cpu;
+
+  if(argint(0, &irq) < 0 || argint(1, &cpu) < 0)
+    return -1;
+  return irqroute(irq, cpu);
+}
+
+// trace(TR_ENABLE, mask, 0, 0) sets the categories recorded;
+// trace(TR_READ, cpu, ev, n) takes up to n of CPU cpu's events,
+// a page's worth at most, returning how many.
+int
+sys_trace(void)
+{
+  int cmd, arg, n;
+  struct tracev *ev;
+  char *buf;
+
+  if(argint(0, &cmd) < 0 || argint(1, &arg) < 0)
+    return -1;
+  if(cmd == TR_ENABLE)
+    return traceset(arg);
+  if(cmd != TR_READ || argint(3, &n) < 0 || n < 0)
+    return -1;
+  if(n > PGSIZE/sizeof(*ev))
+    n = PGSIZE/sizeof(*ev);
+  if(argptr(2, (char**)&ev, n*sizeof(*ev)) < 0 || (buf = kalloc()) == 0)
+    return -1;
+  // traceread() holds a spin lock: copy out after.
+  if((n = traceread(arg, (struct tracev*)buf, n)) > 0)
+    memmove(ev, buf, n*sizeof(*ev));
+  kfree(buf);
+  return n;
+}
+
+// Start a thread at fn(arg) on the stack whose top is stack.
+int
+sys_clone(void)
+{
+  int fn, stack, arg;
+
+  if(argint(0, &fn) < 0 || argint(1, &stack) < 0 || argint(2, &arg) < 0)
+    return -1;
+  return clone(fn, stack, arg);
+}
+
+// Wait for a thread; store the stack it was given in *stack,
+// unless stack is null.
+int
+sys_join(void)
+{
+  int p, pid;
+  uint *stack, ustack;
+
+  if(argint(0, &p) < 0)
+    return -1;
+  if(p != 0 && argptr(0, (char**)&stack, sizeof(*stack)) < 0)
+    return -1;
+  if((pid = join(&ustack)) >= 0 && p != 0)
+    *stack = ustack;
+  return pid;
+}
+
+// Sleep until futex_wake() on the word at addr, unless it no
+// longer holds val.
+int
+sys_futex_wait(void)
+{
+  int val;
+  char *addr;
+  uint *k;
+
+  if(argptr(0, &addr, sizeof(uint)) < 0 || argint(1, &val) < 0)
+    return -1;
+  if((k = futexaddr(myproc(), (uint)addr)) == 0)
+    return -1;
+  return futexwait(k, val);
+}
+
+// Wake up at most n threads sleeping on the word at addr.
+int
+sys_futex_wake(void)
+{
+  int n;
+  char *addr;
+  uint *k;
+
+  if(argptr(0, &addr, sizeof(uint)) < 0 || argint(1, &n) < 0)
+    return -1;
+  if((k = futexaddr(myproc(), (uint)addr)) == 0)
+    return -1;
+  return futexwake(k, n);
+}
+
+// Read clock clk (CLOCK_REALTIME or CLOCK_MONOTONIC) into *ts,
+// with ns resolution.  vclock_gettime() in ulib.c does the same
+// from the clock page without a trap.
+int
+sys_clock_gettime(void)
+{
+  int clk;
+  struct timespec *ts;
+
+  if(argint(0, &clk) < 0 || argptr(1, (char**)&ts, sizeof(*ts)) < 0)
+    return -1;
+  return clockgettime(clk, ts);
+}
@@ -0,0 +1,17 @@
+// System call counters, as returned by sysstat(): one struct
+// syscount for each system call number below NSYSCALL.  Times are
+// in TSC cycles, from entering the call to returning from it, so
+// they include any time spent asleep in it.
+
+#define NSYSCALL 64
+
+struct syscount {
+  uint n;                      // Calls
+  uint64 time;                 // Total time in them
+  uint64 max;                  // Longest one
+};
+
+// Whose counters sysstat() returns
+#define SS_ALL      0          // Every process's since boot
+#define SS_SELF     1          // The caller's
+#define SS_CHILDREN 2          // Its children's that it has waited for, and theirs
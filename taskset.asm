@@ -0,0 +1,2832 @@
+
+_taskset:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "types.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 08             	sub    $0x8,%esp
+      14:	8b 31                	mov    (%ecx),%esi
+      16:	8b 59 04             	mov    0x4(%ecx),%ebx
+  int pid, mask;
+
+  if(argc >= 3 && strcmp(argv[1], "-p") == 0){
+      19:	83 fe 02             	cmp    $0x2,%esi
+      1c:	0f 8e 99 00 00 00    	jle    bb <main+0xbb>
+      22:	83 ec 08             	sub    $0x8,%esp
+      25:	68 bc 12 00 00       	push   $0x12bc
+      2a:	ff 73 04             	push   0x4(%ebx)
+      2d:	e8 23 01 00 00       	call   155 <strcmp>
+      32:	83 c4 10             	add    $0x10,%esp
+      35:	85 c0                	test   %eax,%eax
+      37:	0f 85 92 00 00 00    	jne    cf <main+0xcf>
+    pid = atoi(argv[2]);
+      3d:	83 ec 0c             	sub    $0xc,%esp
+      40:	ff 73 08             	push   0x8(%ebx)
+      43:	e8 1e 03 00 00       	call   366 <atoi>
+      48:	89 c7                	mov    %eax,%edi
+    if(argc > 3 && setaffinity(pid, atoi(argv[3])) < 0){
+      4a:	83 c4 10             	add    $0x10,%esp
+      4d:	83 fe 03             	cmp    $0x3,%esi
+      50:	7e 1c                	jle    6e <main+0x6e>
+      52:	83 ec 0c             	sub    $0xc,%esp
+      55:	ff 73 0c             	push   0xc(%ebx)
+      58:	e8 09 03 00 00       	call   366 <atoi>
+      5d:	83 c4 08             	add    $0x8,%esp
+      60:	50                   	push   %eax
+      61:	57                   	push   %edi
+      62:	e8 e6 09 00 00       	call   a4d <setaffinity>
+      67:	83 c4 10             	add    $0x10,%esp
+      6a:	85 c0                	test   %eax,%eax
+      6c:	78 23                	js     91 <main+0x91>
+      printf(2, "taskset: cannot set mask of %d\n", pid);
+      exit();
+    }
+    if((mask = getaffinity(pid)) < 0){
+      6e:	83 ec 0c             	sub    $0xc,%esp
+      71:	57                   	push   %edi
+      72:	e8 e5 09 00 00       	call   a5c <getaffinity>
+      77:	83 c4 10             	add    $0x10,%esp
+      7a:	85 c0                	test   %eax,%eax
+      7c:	78 28                	js     a6 <main+0xa6>
+      printf(2, "taskset: no process %d\n", pid);
+      exit();
+    }
+    printf(1, "pid %d mask %d\n", pid, mask);
+      7e:	50                   	push   %eax
+      7f:	57                   	push   %edi
+      80:	68 d7 12 00 00       	push   $0x12d7
+      85:	6a 01                	push   $0x1
+      87:	e8 14 0c 00 00       	call   ca0 <printf>
+    exit();
+      8c:	e8 d6 06 00 00       	call   767 <exit>
+      printf(2, "taskset: cannot set mask of %d\n", pid);
+      91:	83 ec 04             	sub    $0x4,%esp
+      94:	57                   	push   %edi
+      95:	68 18 13 00 00       	push   $0x1318
+      9a:	6a 02                	push   $0x2
+      9c:	e8 ff 0b 00 00       	call   ca0 <printf>
+      exit();
+      a1:	e8 c1 06 00 00       	call   767 <exit>
+      printf(2, "taskset: no process %d\n", pid);
+      a6:	83 ec 04             	sub    $0x4,%esp
+      a9:	57                   	push   %edi
+      aa:	68 bf 12 00 00       	push   $0x12bf
+      af:	6a 02                	push   $0x2
+      b1:	e8 ea 0b 00 00       	call   ca0 <printf>
+      exit();
+      b6:	e8 ac 06 00 00       	call   767 <exit>
+  }
+  if(argc < 3){
+    printf(2, "usage: taskset mask prog [args] | taskset -p pid [mask]\n");
+      bb:	83 ec 08             	sub    $0x8,%esp
+      be:	68 38 13 00 00       	push   $0x1338
+      c3:	6a 02                	push   $0x2
+      c5:	e8 d6 0b 00 00       	call   ca0 <printf>
+    exit();
+      ca:	e8 98 06 00 00       	call   767 <exit>
+  }
+  if(setaffinity(getpid(), atoi(argv[1])) < 0){
+      cf:	83 ec 0c             	sub    $0xc,%esp
+      d2:	ff 73 04             	push   0x4(%ebx)
+      d5:	e8 8c 02 00 00       	call   366 <atoi>
+      da:	89 c6                	mov    %eax,%esi
+      dc:	e8 4f 08 00 00       	call   930 <getpid>
+      e1:	83 c4 08             	add    $0x8,%esp
+      e4:	56                   	push   %esi
+      e5:	50                   	push   %eax
+      e6:	e8 62 09 00 00       	call   a4d <setaffinity>
+      eb:	83 c4 10             	add    $0x10,%esp
+      ee:	85 c0                	test   %eax,%eax
+      f0:	78 26                	js     118 <main+0x118>
+    printf(2, "taskset: bad mask %s\n", argv[1]);
+    exit();
+  }
+  exec(argv[2], argv + 2);
+      f2:	83 ec 08             	sub    $0x8,%esp
+      f5:	8d 43 08             	lea    0x8(%ebx),%eax
+      f8:	50                   	push   %eax
+      f9:	ff 73 08             	push   0x8(%ebx)
+      fc:	e8 78 06 00 00       	call   779 <exec>
+  printf(2, "taskset: exec %s failed\n", argv[2]);
+     101:	83 c4 0c             	add    $0xc,%esp
+     104:	ff 73 08             	push   0x8(%ebx)
+     107:	68 fd 12 00 00       	push   $0x12fd
+     10c:	6a 02                	push   $0x2
+     10e:	e8 8d 0b 00 00       	call   ca0 <printf>
+  exit();
+     113:	e8 4f 06 00 00       	call   767 <exit>
+    printf(2, "taskset: bad mask %s\n", argv[1]);
+     118:	83 ec 04             	sub    $0x4,%esp
+     11b:	ff 73 04             	push   0x4(%ebx)
+     11e:	68 e7 12 00 00       	push   $0x12e7
+     123:	6a 02                	push   $0x2
+     125:	e8 76 0b 00 00       	call   ca0 <printf>
+    exit();
+     12a:	e8 38 06 00 00       	call   767 <exit>
+
+0000012f <strcpy>:
+#include "memlayout.h"
+#include "clock.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     12f:	55                   	push   %ebp
+     130:	89 e5                	mov    %esp,%ebp
+     132:	56                   	push   %esi
+     133:	53                   	push   %ebx
+     134:	8b 75 08             	mov    0x8(%ebp),%esi
+     137:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     13a:	89 f0                	mov    %esi,%eax
+     13c:	89 d1                	mov    %edx,%ecx
+     13e:	83 c2 01             	add    $0x1,%edx
+     141:	89 c3                	mov    %eax,%ebx
+     143:	83 c0 01             	add    $0x1,%eax
+     146:	0f b6 09             	movzbl (%ecx),%ecx
+     149:	88 0b                	mov    %cl,(%ebx)
+     14b:	84 c9                	test   %cl,%cl
+     14d:	75 ed                	jne    13c <strcpy+0xd>
+    ;
+  return os;
+}
+     14f:	89 f0                	mov    %esi,%eax
+     151:	5b                   	pop    %ebx
+     152:	5e                   	pop    %esi
+     153:	5d                   	pop    %ebp
+     154:	c3                   	ret
+
+00000155 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     155:	55                   	push   %ebp
+     156:	89 e5                	mov    %esp,%ebp
+     158:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     15b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+     15e:	eb 06                	jmp    166 <strcmp+0x11>
+    p++, q++;
+     160:	83 c1 01             	add    $0x1,%ecx
+     163:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+     166:	0f b6 01             	movzbl (%ecx),%eax
+     169:	84 c0                	test   %al,%al
+     16b:	74 04                	je     171 <strcmp+0x1c>
+     16d:	3a 02                	cmp    (%edx),%al
+     16f:	74 ef                	je     160 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+     171:	0f b6 c0             	movzbl %al,%eax
+     174:	0f b6 12             	movzbl (%edx),%edx
+     177:	29 d0                	sub    %edx,%eax
+}
+     179:	5d                   	pop    %ebp
+     17a:	c3                   	ret
+
+0000017b <strlen>:
+
+uint
+strlen(const char *s)
+{
+     17b:	55                   	push   %ebp
+     17c:	89 e5                	mov    %esp,%ebp
+     17e:	53                   	push   %ebx
+     17f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  const char *p;
+  uint w;
+
+  for(p = s; (uint)p & 3; p++)
+     182:	89 c8                	mov    %ecx,%eax
+     184:	eb 03                	jmp    189 <strlen+0xe>
+     186:	83 c0 01             	add    $0x1,%eax
+     189:	a8 03                	test   $0x3,%al
+     18b:	74 09                	je     196 <strlen+0x1b>
+    if(*p == 0)
+     18d:	80 38 00             	cmpb   $0x0,(%eax)
+     190:	75 f4                	jne    186 <strlen+0xb>
+      return p - s;
+     192:	29 c8                	sub    %ecx,%eax
+     194:	eb 25                	jmp    1bb <strlen+0x40>
+  // Then a word at a time, which never crosses into the next page:
+  // a word with a zero byte in it has one of these bits set.
+  for(;; p += 4){
+    w = *(uint*)p;
+     196:	8b 10                	mov    (%eax),%edx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     198:	8d 9a ff fe fe fe    	lea    -0x1010101(%edx),%ebx
+     19e:	f7 d2                	not    %edx
+     1a0:	21 da                	and    %ebx,%edx
+     1a2:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+     1a8:	75 05                	jne    1af <strlen+0x34>
+  for(;; p += 4){
+     1aa:	83 c0 04             	add    $0x4,%eax
+    w = *(uint*)p;
+     1ad:	eb e7                	jmp    196 <strlen+0x1b>
+      break;
+  }
+  while(*p)
+     1af:	80 38 00             	cmpb   $0x0,(%eax)
+     1b2:	74 05                	je     1b9 <strlen+0x3e>
+    p++;
+     1b4:	83 c0 01             	add    $0x1,%eax
+     1b7:	eb f6                	jmp    1af <strlen+0x34>
+  return p - s;
+     1b9:	29 c8                	sub    %ecx,%eax
+}
+     1bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     1be:	c9                   	leave
+     1bf:	c3                   	ret
+
+000001c0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     1c0:	55                   	push   %ebp
+     1c1:	89 e5                	mov    %esp,%ebp
+     1c3:	57                   	push   %edi
+     1c4:	56                   	push   %esi
+     1c5:	53                   	push   %ebx
+     1c6:	8b 55 10             	mov    0x10(%ebp),%edx
+  uint h;
+  char *d;
+
+  d = dst;
+  c &= 0xFF;
+     1c9:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  if(n >= 16){
+     1cd:	83 fa 0f             	cmp    $0xf,%edx
+     1d0:	76 52                	jbe    224 <memset+0x64>
+    h = -(uint)d & 3;
+     1d2:	8b 45 08             	mov    0x8(%ebp),%eax
+     1d5:	f7 d8                	neg    %eax
+     1d7:	83 e0 03             	and    $0x3,%eax
+     1da:	89 c6                	mov    %eax,%esi
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     1dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+     1df:	89 c1                	mov    %eax,%ecx
+     1e1:	89 d8                	mov    %ebx,%eax
+     1e3:	fc                   	cld
+     1e4:	f3 aa                	rep stos %al,%es:(%edi)
+    stosb(d, c, h);
+    stosl(d + h, (c<<24)|(c<<16)|(c<<8)|c, (n - h)/4);
+     1e6:	29 f2                	sub    %esi,%edx
+     1e8:	89 d1                	mov    %edx,%ecx
+     1ea:	c1 e9 02             	shr    $0x2,%ecx
+     1ed:	c1 e0 18             	shl    $0x18,%eax
+     1f0:	89 df                	mov    %ebx,%edi
+     1f2:	c1 e7 10             	shl    $0x10,%edi
+     1f5:	09 f8                	or     %edi,%eax
+     1f7:	89 df                	mov    %ebx,%edi
+     1f9:	c1 e7 08             	shl    $0x8,%edi
+     1fc:	09 f8                	or     %edi,%eax
+     1fe:	09 d8                	or     %ebx,%eax
+     200:	89 f7                	mov    %esi,%edi
+     202:	03 7d 08             	add    0x8(%ebp),%edi
+}
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosl" :
+     205:	fc                   	cld
+     206:	f3 ab                	rep stos %eax,%es:(%edi)
+    d += h + (n - h)/4*4;
+     208:	89 d7                	mov    %edx,%edi
+     20a:	83 e7 fc             	and    $0xfffffffc,%edi
+     20d:	09 f7                	or     %esi,%edi
+     20f:	03 7d 08             	add    0x8(%ebp),%edi
+    n = (n - h)%4;
+     212:	83 e2 03             	and    $0x3,%edx
+  asm volatile("cld; rep stosb" :
+     215:	89 d1                	mov    %edx,%ecx
+     217:	89 d8                	mov    %ebx,%eax
+     219:	fc                   	cld
+     21a:	f3 aa                	rep stos %al,%es:(%edi)
+  }
+  stosb(d, c, n);
+  return dst;
+}
+     21c:	8b 45 08             	mov    0x8(%ebp),%eax
+     21f:	5b                   	pop    %ebx
+     220:	5e                   	pop    %esi
+     221:	5f                   	pop    %edi
+     222:	5d                   	pop    %ebp
+     223:	c3                   	ret
+  d = dst;
+     224:	8b 7d 08             	mov    0x8(%ebp),%edi
+     227:	eb ec                	jmp    215 <memset+0x55>
+
+00000229 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     229:	55                   	push   %ebp
+     22a:	89 e5                	mov    %esp,%ebp
+     22c:	8b 45 08             	mov    0x8(%ebp),%eax
+     22f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     233:	eb 03                	jmp    238 <strchr+0xf>
+     235:	83 c0 01             	add    $0x1,%eax
+     238:	0f b6 10             	movzbl (%eax),%edx
+     23b:	84 d2                	test   %dl,%dl
+     23d:	74 06                	je     245 <strchr+0x1c>
+    if(*s == c)
+     23f:	38 ca                	cmp    %cl,%dl
+     241:	75 f2                	jne    235 <strchr+0xc>
+     243:	eb 05                	jmp    24a <strchr+0x21>
+      return (char*)s;
+  return 0;
+     245:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     24a:	5d                   	pop    %ebp
+     24b:	c3                   	ret
+
+0000024c <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     24c:	55                   	push   %ebp
+     24d:	89 e5                	mov    %esp,%ebp
+     24f:	56                   	push   %esi
+     250:	53                   	push   %ebx
+     251:	8b 55 08             	mov    0x8(%ebp),%edx
+     254:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     257:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  // A word at a time while they agree.
+  if((((uint)s1 | (uint)s2) & 3) == 0)
+     25a:	89 d3                	mov    %edx,%ebx
+     25c:	09 cb                	or     %ecx,%ebx
+     25e:	f6 c3 03             	test   $0x3,%bl
+     261:	74 24                	je     287 <memcmp+0x3b>
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+      s1 += 4, s2 += 4;
+  while(n-- > 0){
+     263:	8d 70 ff             	lea    -0x1(%eax),%esi
+     266:	85 c0                	test   %eax,%eax
+     268:	74 32                	je     29c <memcmp+0x50>
+    if(*s1 != *s2)
+     26a:	0f b6 02             	movzbl (%edx),%eax
+     26d:	0f b6 19             	movzbl (%ecx),%ebx
+     270:	38 d8                	cmp    %bl,%al
+     272:	75 20                	jne    294 <memcmp+0x48>
+      return *s1 - *s2;
+    s1++, s2++;
+     274:	83 c2 01             	add    $0x1,%edx
+     277:	83 c1 01             	add    $0x1,%ecx
+  while(n-- > 0){
+     27a:	89 f0                	mov    %esi,%eax
+     27c:	eb e5                	jmp    263 <memcmp+0x17>
+      s1 += 4, s2 += 4;
+     27e:	83 c2 04             	add    $0x4,%edx
+     281:	83 c1 04             	add    $0x4,%ecx
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+     284:	83 e8 04             	sub    $0x4,%eax
+     287:	83 f8 03             	cmp    $0x3,%eax
+     28a:	76 d7                	jbe    263 <memcmp+0x17>
+     28c:	8b 31                	mov    (%ecx),%esi
+     28e:	39 32                	cmp    %esi,(%edx)
+     290:	74 ec                	je     27e <memcmp+0x32>
+     292:	eb cf                	jmp    263 <memcmp+0x17>
+      return *s1 - *s2;
+     294:	0f b6 c0             	movzbl %al,%eax
+     297:	0f b6 db             	movzbl %bl,%ebx
+     29a:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     29c:	5b                   	pop    %ebx
+     29d:	5e                   	pop    %esi
+     29e:	5d                   	pop    %ebp
+     29f:	c3                   	ret
+
+000002a0 <memchr>:
+// The first c in the n bytes at v, or 0.  Once aligned, a word at
+// a time, with the word's bytes that equal c turned into zeroes
+// and those looked for.
+void*
+memchr(const void *v, int c, uint n)
+{
+     2a0:	55                   	push   %ebp
+     2a1:	89 e5                	mov    %esp,%ebp
+     2a3:	57                   	push   %edi
+     2a4:	56                   	push   %esi
+     2a5:	53                   	push   %ebx
+     2a6:	8b 45 08             	mov    0x8(%ebp),%eax
+     2a9:	8b 55 10             	mov    0x10(%ebp),%edx
+  const uchar *s;
+  uint w, rep;
+
+  s = v;
+  c = (uchar)c;
+     2ac:	0f b6 75 0c          	movzbl 0xc(%ebp),%esi
+  for(; n > 0 && ((uint)s & 3); n--, s++)
+     2b0:	eb 06                	jmp    2b8 <memchr+0x18>
+     2b2:	83 ea 01             	sub    $0x1,%edx
+     2b5:	83 c0 01             	add    $0x1,%eax
+     2b8:	85 d2                	test   %edx,%edx
+     2ba:	74 0d                	je     2c9 <memchr+0x29>
+     2bc:	a8 03                	test   $0x3,%al
+     2be:	74 09                	je     2c9 <memchr+0x29>
+    if(*s == c)
+     2c0:	0f b6 08             	movzbl (%eax),%ecx
+     2c3:	39 f1                	cmp    %esi,%ecx
+     2c5:	75 eb                	jne    2b2 <memchr+0x12>
+     2c7:	eb 41                	jmp    30a <memchr+0x6a>
+      return (void*)s;
+  rep = c * 0x01010101;
+     2c9:	69 fe 01 01 01 01    	imul   $0x1010101,%esi,%edi
+  for(; n >= 4; n -= 4, s += 4){
+     2cf:	eb 06                	jmp    2d7 <memchr+0x37>
+     2d1:	83 ea 04             	sub    $0x4,%edx
+     2d4:	83 c0 04             	add    $0x4,%eax
+     2d7:	83 fa 03             	cmp    $0x3,%edx
+     2da:	76 16                	jbe    2f2 <memchr+0x52>
+    w = *(uint*)s ^ rep;
+     2dc:	89 f9                	mov    %edi,%ecx
+     2de:	33 08                	xor    (%eax),%ecx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     2e0:	8d 99 ff fe fe fe    	lea    -0x1010101(%ecx),%ebx
+     2e6:	f7 d1                	not    %ecx
+     2e8:	21 cb                	and    %ecx,%ebx
+     2ea:	f7 c3 80 80 80 80    	test   $0x80808080,%ebx
+     2f0:	74 df                	je     2d1 <memchr+0x31>
+      break;
+  }
+  for(; n > 0; n--, s++)
+     2f2:	85 d2                	test   %edx,%edx
+     2f4:	74 0f                	je     305 <memchr+0x65>
+    if(*s == c)
+     2f6:	0f b6 08             	movzbl (%eax),%ecx
+     2f9:	39 f1                	cmp    %esi,%ecx
+     2fb:	74 0d                	je     30a <memchr+0x6a>
+  for(; n > 0; n--, s++)
+     2fd:	83 ea 01             	sub    $0x1,%edx
+     300:	83 c0 01             	add    $0x1,%eax
+     303:	eb ed                	jmp    2f2 <memchr+0x52>
+      return (void*)s;
+  return 0;
+     305:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     30a:	5b                   	pop    %ebx
+     30b:	5e                   	pop    %esi
+     30c:	5f                   	pop    %edi
+     30d:	5d                   	pop    %ebp
+     30e:	c3                   	ret
+
+0000030f <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     30f:	55                   	push   %ebp
+     310:	89 e5                	mov    %esp,%ebp
+     312:	57                   	push   %edi
+     313:	56                   	push   %esi
+     314:	53                   	push   %ebx
+     315:	83 ec 1c             	sub    $0x1c,%esp
+     318:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     31b:	bb 00 00 00 00       	mov    $0x0,%ebx
+     320:	89 de                	mov    %ebx,%esi
+     322:	83 c3 01             	add    $0x1,%ebx
+     325:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     328:	7d 2e                	jge    358 <gets+0x49>
+    cc = read(0, &c, 1);
+     32a:	83 ec 04             	sub    $0x4,%esp
+     32d:	6a 01                	push   $0x1
+     32f:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     332:	50                   	push   %eax
+     333:	6a 00                	push   $0x0
+     335:	e8 51 05 00 00       	call   88b <read>
+    if(cc < 1)
+     33a:	83 c4 10             	add    $0x10,%esp
+     33d:	85 c0                	test   %eax,%eax
+     33f:	7e 17                	jle    358 <gets+0x49>
+      break;
+    buf[i++] = c;
+     341:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     345:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+     348:	3c 0a                	cmp    $0xa,%al
+     34a:	0f 94 c2             	sete   %dl
+     34d:	3c 0d                	cmp    $0xd,%al
+     34f:	0f 94 c0             	sete   %al
+     352:	08 c2                	or     %al,%dl
+     354:	74 ca                	je     320 <gets+0x11>
+    buf[i++] = c;
+     356:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+     358:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+     35c:	89 f8                	mov    %edi,%eax
+     35e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     361:	5b                   	pop    %ebx
+     362:	5e                   	pop    %esi
+     363:	5f                   	pop    %edi
+     364:	5d                   	pop    %ebp
+     365:	c3                   	ret
+
+00000366 <atoi>:
+  return r;
+}
+
+int
+atoi(const char *s)
+{
+     366:	55                   	push   %ebp
+     367:	89 e5                	mov    %esp,%ebp
+     369:	53                   	push   %ebx
+     36a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+     36d:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+     372:	eb 10                	jmp    384 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+     374:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+     377:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+     37a:	83 c1 01             	add    $0x1,%ecx
+     37d:	0f be c0             	movsbl %al,%eax
+     380:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+     384:	0f b6 01             	movzbl (%ecx),%eax
+     387:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     38a:	80 fb 09             	cmp    $0x9,%bl
+     38d:	76 e5                	jbe    374 <atoi+0xe>
+  return n;
+}
+     38f:	89 d0                	mov    %edx,%eax
+     391:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     394:	c9                   	leave
+     395:	c3                   	ret
+
+00000396 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     396:	55                   	push   %ebp
+     397:	89 e5                	mov    %esp,%ebp
+     399:	57                   	push   %edi
+     39a:	56                   	push   %esi
+     39b:	53                   	push   %ebx
+     39c:	83 ec 08             	sub    $0x8,%esp
+     39f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     3a2:	8b 55 0c             	mov    0xc(%ebp),%edx
+     3a5:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *src;
+  int h;
+
+  dst = vdst;
+  src = vsrc;
+  if(n <= 0)
+     3a8:	85 c0                	test   %eax,%eax
+     3aa:	0f 8e 82 00 00 00    	jle    432 <memmove+0x9c>
+    return vdst;
+  if(src < dst && src + n > dst){
+     3b0:	39 da                	cmp    %ebx,%edx
+     3b2:	73 07                	jae    3bb <memmove+0x25>
+     3b4:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+     3b7:	39 cb                	cmp    %ecx,%ebx
+     3b9:	72 5e                	jb     419 <memmove+0x83>
+    movsbback(dst + n - 1, src + n - 1, n);
+    return vdst;
+  }
+  if(n >= 16 && (((uint)dst ^ (uint)src) & 3) == 0){
+     3bb:	83 f8 0f             	cmp    $0xf,%eax
+     3be:	7e 69                	jle    429 <memmove+0x93>
+     3c0:	89 d9                	mov    %ebx,%ecx
+     3c2:	31 d1                	xor    %edx,%ecx
+     3c4:	f6 c1 03             	test   $0x3,%cl
+     3c7:	75 73                	jne    43c <memmove+0xa6>
+    h = -(uint)dst & 3;
+     3c9:	89 d9                	mov    %ebx,%ecx
+     3cb:	f7 d9                	neg    %ecx
+     3cd:	83 e1 03             	and    $0x3,%ecx
+}
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsb" :
+     3d0:	89 df                	mov    %ebx,%edi
+     3d2:	89 d6                	mov    %edx,%esi
+     3d4:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+     3d7:	fc                   	cld
+     3d8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    movsb(dst, src, h);
+    dst += h, src += h, n -= h;
+     3da:	8b 75 f0             	mov    -0x10(%ebp),%esi
+     3dd:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+     3e0:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+     3e3:	29 f0                	sub    %esi,%eax
+    movsl(dst, src, n/4);
+     3e5:	8d 50 03             	lea    0x3(%eax),%edx
+     3e8:	0f 49 d0             	cmovns %eax,%edx
+     3eb:	c1 fa 02             	sar    $0x2,%edx
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+     3ee:	89 7d f0             	mov    %edi,-0x10(%ebp)
+     3f1:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     3f4:	89 ce                	mov    %ecx,%esi
+     3f6:	89 d1                	mov    %edx,%ecx
+     3f8:	fc                   	cld
+     3f9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    dst += n/4*4, src += n/4*4, n %= 4;
+     3fb:	c1 e2 02             	shl    $0x2,%edx
+     3fe:	8b 7d f0             	mov    -0x10(%ebp),%edi
+     401:	01 d7                	add    %edx,%edi
+     403:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     406:	01 ca                	add    %ecx,%edx
+     408:	89 c6                	mov    %eax,%esi
+     40a:	c1 fe 1f             	sar    $0x1f,%esi
+     40d:	c1 ee 1e             	shr    $0x1e,%esi
+     410:	01 f0                	add    %esi,%eax
+     412:	83 e0 03             	and    $0x3,%eax
+     415:	29 f0                	sub    %esi,%eax
+     417:	eb 12                	jmp    42b <memmove+0x95>
+    movsbback(dst + n - 1, src + n - 1, n);
+     419:	8d 78 ff             	lea    -0x1(%eax),%edi
+     41c:	8d 34 3a             	lea    (%edx,%edi,1),%esi
+     41f:	01 df                	add    %ebx,%edi
+// Copy cnt bytes down from the last ones, at dst and src, to the
+// first: for overlapping moves up.
+static inline void
+movsbback(void *dst, const void *src, int cnt)
+{
+  asm volatile("std; rep movsb; cld" :
+     421:	89 c1                	mov    %eax,%ecx
+     423:	fd                   	std
+     424:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     426:	fc                   	cld
+    return vdst;
+     427:	eb 09                	jmp    432 <memmove+0x9c>
+  dst = vdst;
+     429:	89 df                	mov    %ebx,%edi
+  asm volatile("cld; rep movsb" :
+     42b:	89 d6                	mov    %edx,%esi
+     42d:	89 c1                	mov    %eax,%ecx
+     42f:	fc                   	cld
+     430:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  }
+  movsb(dst, src, n);
+  return vdst;
+}
+     432:	89 d8                	mov    %ebx,%eax
+     434:	83 c4 08             	add    $0x8,%esp
+     437:	5b                   	pop    %ebx
+     438:	5e                   	pop    %esi
+     439:	5f                   	pop    %edi
+     43a:	5d                   	pop    %ebp
+     43b:	c3                   	ret
+  dst = vdst;
+     43c:	89 df                	mov    %ebx,%edi
+     43e:	eb eb                	jmp    42b <memmove+0x95>
+
+00000440 <vclock_gettime>:
+
+// clock_gettime() without a system call: read the clock page
+// that the kernel maps at CLOCKPAGE (see clock.h).
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+     440:	55                   	push   %ebp
+     441:	89 e5                	mov    %esp,%ebp
+     443:	57                   	push   %edi
+     444:	56                   	push   %esi
+     445:	53                   	push   %ebx
+     446:	83 ec 14             	sub    $0x14,%esp
+  struct clockpage *cp = (struct clockpage*)CLOCKPAGE;
+  uint seq, rem, d;
+  uint64 tsc, ns, now;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+     449:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     44d:	0f 87 a3 00 00 00    	ja     4f6 <vclock_gettime+0xb6>
+    return -1;
+  do {
+    seq = cp->seq;
+     453:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+    __sync_synchronize();
+     458:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    tsc = cp->tsc;
+     45d:	8b 15 10 f0 ff 7f    	mov    0x7ffff010,%edx
+     463:	8b 1d 14 f0 ff 7f    	mov    0x7ffff014,%ebx
+    ns = cp->ns;
+     469:	8b 35 18 f0 ff 7f    	mov    0x7ffff018,%esi
+     46f:	8b 3d 1c f0 ff 7f    	mov    0x7ffff01c,%edi
+    __sync_synchronize();
+     475:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != cp->seq);
+     47a:	89 c1                	mov    %eax,%ecx
+     47c:	83 e1 01             	and    $0x1,%ecx
+     47f:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     482:	75 cf                	jne    453 <vclock_gettime+0x13>
+     484:	8b 0d 00 f0 ff 7f    	mov    0x7ffff000,%ecx
+     48a:	39 c1                	cmp    %eax,%ecx
+     48c:	75 c5                	jne    453 <vclock_gettime+0x13>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+     48e:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     491:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     494:	0f 31                	rdtsc
+     496:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     499:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     49c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  now = rdtsc();
+  // Less than a tick has passed since the update, so the delta
+  // fits in 32 bits.
+  d = now > tsc ? now - tsc : 0;
+     49f:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     4a2:	19 d3                	sbb    %edx,%ebx
+     4a4:	73 07                	jae    4ad <vclock_gettime+0x6d>
+     4a6:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+     4a9:	29 d8                	sub    %ebx,%eax
+     4ab:	89 c1                	mov    %eax,%ecx
+  ns += ((uint64)d * cp->mult) >> cp->shift;
+     4ad:	89 c8                	mov    %ecx,%eax
+     4af:	f7 25 04 f0 ff 7f    	mull   0x7ffff004
+     4b5:	0f b6 0d 08 f0 ff 7f 	movzbl 0x7ffff008,%ecx
+     4bc:	0f ad d0             	shrd   %cl,%edx,%eax
+     4bf:	d3 ea                	shr    %cl,%edx
+     4c1:	f6 c1 20             	test   $0x20,%cl
+     4c4:	74 04                	je     4ca <vclock_gettime+0x8a>
+     4c6:	89 d0                	mov    %edx,%eax
+     4c8:	31 d2                	xor    %edx,%edx
+     4ca:	01 f0                	add    %esi,%eax
+     4cc:	11 fa                	adc    %edi,%edx
+static inline uint
+divl(uint64 n, uint d, uint *r)
+{
+  uint q;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (*r) :
+     4ce:	bb 00 ca 9a 3b       	mov    $0x3b9aca00,%ebx
+     4d3:	f7 f3                	div    %ebx
+  ts->tv_sec = divl(ns, 1000000000, &rem);
+     4d5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     4d8:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = rem;
+     4da:	89 57 04             	mov    %edx,0x4(%edi)
+  if(clk == CLOCK_REALTIME)
+     4dd:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     4e1:	75 1a                	jne    4fd <vclock_gettime+0xbd>
+    ts->tv_sec += cp->boottime;
+     4e3:	03 05 0c f0 ff 7f    	add    0x7ffff00c,%eax
+     4e9:	89 07                	mov    %eax,(%edi)
+  return 0;
+     4eb:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     4ee:	83 c4 14             	add    $0x14,%esp
+     4f1:	5b                   	pop    %ebx
+     4f2:	5e                   	pop    %esi
+     4f3:	5f                   	pop    %edi
+     4f4:	5d                   	pop    %ebp
+     4f5:	c3                   	ret
+    return -1;
+     4f6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     4fb:	eb f1                	jmp    4ee <vclock_gettime+0xae>
+  return 0;
+     4fd:	b8 00 00 00 00       	mov    $0x0,%eax
+     502:	eb ea                	jmp    4ee <vclock_gettime+0xae>
+
+00000504 <flush>:
+
+// Write out fd's buffer, or with fd < 0 every buffer.
+// Returns -1 if a write fails.
+int
+flush(int fd)
+{
+     504:	55                   	push   %ebp
+     505:	89 e5                	mov    %esp,%ebp
+     507:	56                   	push   %esi
+     508:	53                   	push   %ebx
+     509:	8b 45 08             	mov    0x8(%ebp),%eax
+  int r, n;
+
+  if(fd < 0){
+     50c:	85 c0                	test   %eax,%eax
+     50e:	78 5d                	js     56d <flush+0x69>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+      if(flush(fd) < 0)
+        r = -1;
+    return r;
+  }
+  if(fd >= NOBUF || (n = obuf[fd].n) == 0)
+     510:	83 f8 0f             	cmp    $0xf,%eax
+     513:	7f 64                	jg     579 <flush+0x75>
+     515:	69 d0 08 02 00 00    	imul   $0x208,%eax,%edx
+     51b:	8b b2 a4 1a 00 00    	mov    0x1aa4(%edx),%esi
+     521:	85 f6                	test   %esi,%esi
+     523:	74 59                	je     57e <flush+0x7a>
+    return 0;
+  obuf[fd].n = 0;
+     525:	c7 82 a4 1a 00 00 00 	movl   $0x0,0x1aa4(%edx)
+     52c:	00 00 00 
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     52f:	81 c2 a8 1a 00 00    	add    $0x1aa8,%edx
+     535:	83 ec 04             	sub    $0x4,%esp
+     538:	56                   	push   %esi
+     539:	52                   	push   %edx
+     53a:	50                   	push   %eax
+     53b:	e8 5a 03 00 00       	call   89a <write>
+     540:	83 c4 10             	add    $0x10,%esp
+     543:	39 f0                	cmp    %esi,%eax
+     545:	75 40                	jne    587 <flush+0x83>
+     547:	be 00 00 00 00       	mov    $0x0,%esi
+     54c:	eb 30                	jmp    57e <flush+0x7a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     54e:	83 c3 01             	add    $0x1,%ebx
+     551:	83 fb 0f             	cmp    $0xf,%ebx
+     554:	7f 28                	jg     57e <flush+0x7a>
+      if(flush(fd) < 0)
+     556:	83 ec 0c             	sub    $0xc,%esp
+     559:	53                   	push   %ebx
+     55a:	e8 a5 ff ff ff       	call   504 <flush>
+     55f:	83 c4 10             	add    $0x10,%esp
+     562:	85 c0                	test   %eax,%eax
+     564:	79 e8                	jns    54e <flush+0x4a>
+        r = -1;
+     566:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     56b:	eb e1                	jmp    54e <flush+0x4a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     56d:	be 00 00 00 00       	mov    $0x0,%esi
+     572:	bb 00 00 00 00       	mov    $0x0,%ebx
+     577:	eb d8                	jmp    551 <flush+0x4d>
+    return 0;
+     579:	be 00 00 00 00       	mov    $0x0,%esi
+}
+     57e:	89 f0                	mov    %esi,%eax
+     580:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     583:	5b                   	pop    %ebx
+     584:	5e                   	pop    %esi
+     585:	5d                   	pop    %ebp
+     586:	c3                   	ret
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     587:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     58c:	eb f0                	jmp    57e <flush+0x7a>
+
+0000058e <bufreset>:
+
+static void
+bufreset(int fd)
+{
+  if(fd >= 0 && fd < NOBUF){
+     58e:	83 f8 0f             	cmp    $0xf,%eax
+     591:	76 01                	jbe    594 <bufreset+0x6>
+     593:	c3                   	ret
+{
+     594:	55                   	push   %ebp
+     595:	89 e5                	mov    %esp,%ebp
+     597:	53                   	push   %ebx
+     598:	83 ec 10             	sub    $0x10,%esp
+     59b:	89 c3                	mov    %eax,%ebx
+    flush(fd);
+     59d:	50                   	push   %eax
+     59e:	e8 61 ff ff ff       	call   504 <flush>
+    obuf[fd].mode = BUNKNOWN;
+     5a3:	69 db 08 02 00 00    	imul   $0x208,%ebx,%ebx
+     5a9:	c7 83 a0 1a 00 00 00 	movl   $0x0,0x1aa0(%ebx)
+     5b0:	00 00 00 
+     5b3:	83 c4 10             	add    $0x10,%esp
+  }
+}
+     5b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5b9:	c9                   	leave
+     5ba:	c3                   	ret
+
+000005bb <bufwrite>:
+
+// Write n bytes from p to fd, through its buffer.
+// Returns n, or -1 if a write fails.
+int
+bufwrite(int fd, const void *p, int n)
+{
+     5bb:	55                   	push   %ebp
+     5bc:	89 e5                	mov    %esp,%ebp
+     5be:	57                   	push   %edi
+     5bf:	56                   	push   %esi
+     5c0:	53                   	push   %ebx
+     5c1:	83 ec 3c             	sub    $0x3c,%esp
+     5c4:	8b 75 08             	mov    0x8(%ebp),%esi
+     5c7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct stat st;
+  const char *s;
+  int i;
+
+  if(fd < 0 || fd >= NOBUF)
+     5ca:	83 fe 0f             	cmp    $0xf,%esi
+     5cd:	0f 87 a2 00 00 00    	ja     675 <bufwrite+0xba>
+    return write(fd, p, n);
+  if(obuf[fd].mode == BUNKNOWN){
+     5d3:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     5d9:	83 b8 a0 1a 00 00 00 	cmpl   $0x0,0x1aa0(%eax)
+     5e0:	75 19                	jne    5fb <bufwrite+0x40>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     5e2:	83 fe 02             	cmp    $0x2,%esi
+     5e5:	0f 85 9c 00 00 00    	jne    687 <bufwrite+0xcc>
+      obuf[fd].mode = BNONE;
+     5eb:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     5f1:	c7 80 a0 1a 00 00 01 	movl   $0x1,0x1aa0(%eax)
+     5f8:	00 00 00 
+    else
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+  }
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     5fb:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     601:	89 da                	mov    %ebx,%edx
+     603:	03 90 a4 1a 00 00    	add    0x1aa4(%eax),%edx
+     609:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+     60f:	0f 8f ae 00 00 00    	jg     6c3 <bufwrite+0x108>
+    return -1;
+  if(n >= OBUFSZ)
+     615:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+     61b:	0f 8f bd 00 00 00    	jg     6de <bufwrite+0x123>
+    return write(fd, p, n);
+  memmove(obuf[fd].buf + obuf[fd].n, p, n);
+     621:	69 d6 08 02 00 00    	imul   $0x208,%esi,%edx
+     627:	8d ba a0 1a 00 00    	lea    0x1aa0(%edx),%edi
+     62d:	8b 82 a4 1a 00 00    	mov    0x1aa4(%edx),%eax
+     633:	83 ec 04             	sub    $0x4,%esp
+     636:	53                   	push   %ebx
+     637:	ff 75 0c             	push   0xc(%ebp)
+     63a:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     63d:	8d 84 10 a8 1a 00 00 	lea    0x1aa8(%eax,%edx,1),%eax
+     644:	50                   	push   %eax
+     645:	e8 4c fd ff ff       	call   396 <memmove>
+  obuf[fd].n += n;
+     64a:	01 5f 04             	add    %ebx,0x4(%edi)
+  if(obuf[fd].mode == BNONE)
+     64d:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     650:	8b 82 a0 1a 00 00    	mov    0x1aa0(%edx),%eax
+     656:	83 c4 10             	add    $0x10,%esp
+     659:	83 f8 01             	cmp    $0x1,%eax
+     65c:	0f 84 91 00 00 00    	je     6f3 <bufwrite+0x138>
+    return flush(fd) < 0 ? -1 : n;
+  if(obuf[fd].mode == BLINE)
+     662:	83 f8 02             	cmp    $0x2,%eax
+     665:	0f 84 ca 00 00 00    	je     735 <bufwrite+0x17a>
+    for(s = p, i = 0; i < n; i++)
+      if(s[i] == '\n')
+        return flush(fd) < 0 ? -1 : n;
+  return n;
+     66b:	89 d8                	mov    %ebx,%eax
+}
+     66d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     670:	5b                   	pop    %ebx
+     671:	5e                   	pop    %esi
+     672:	5f                   	pop    %edi
+     673:	5d                   	pop    %ebp
+     674:	c3                   	ret
+    return write(fd, p, n);
+     675:	83 ec 04             	sub    $0x4,%esp
+     678:	53                   	push   %ebx
+     679:	ff 75 0c             	push   0xc(%ebp)
+     67c:	56                   	push   %esi
+     67d:	e8 18 02 00 00       	call   89a <write>
+     682:	83 c4 10             	add    $0x10,%esp
+     685:	eb e6                	jmp    66d <bufwrite+0xb2>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     687:	83 ec 08             	sub    $0x8,%esp
+     68a:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     68d:	50                   	push   %eax
+     68e:	56                   	push   %esi
+     68f:	e8 51 02 00 00       	call   8e5 <fstat>
+     694:	83 c4 10             	add    $0x10,%esp
+     697:	85 c0                	test   %eax,%eax
+     699:	0f 88 4c ff ff ff    	js     5eb <bufwrite+0x30>
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+     69f:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     6a4:	74 16                	je     6bc <bufwrite+0x101>
+     6a6:	ba 03 00 00 00       	mov    $0x3,%edx
+     6ab:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     6b1:	89 90 a0 1a 00 00    	mov    %edx,0x1aa0(%eax)
+     6b7:	e9 3f ff ff ff       	jmp    5fb <bufwrite+0x40>
+     6bc:	ba 02 00 00 00       	mov    $0x2,%edx
+     6c1:	eb e8                	jmp    6ab <bufwrite+0xf0>
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     6c3:	83 ec 0c             	sub    $0xc,%esp
+     6c6:	56                   	push   %esi
+     6c7:	e8 38 fe ff ff       	call   504 <flush>
+     6cc:	83 c4 10             	add    $0x10,%esp
+     6cf:	85 c0                	test   %eax,%eax
+     6d1:	0f 89 3e ff ff ff    	jns    615 <bufwrite+0x5a>
+    return -1;
+     6d7:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     6dc:	eb 8f                	jmp    66d <bufwrite+0xb2>
+    return write(fd, p, n);
+     6de:	83 ec 04             	sub    $0x4,%esp
+     6e1:	53                   	push   %ebx
+     6e2:	ff 75 0c             	push   0xc(%ebp)
+     6e5:	56                   	push   %esi
+     6e6:	e8 af 01 00 00       	call   89a <write>
+     6eb:	83 c4 10             	add    $0x10,%esp
+     6ee:	e9 7a ff ff ff       	jmp    66d <bufwrite+0xb2>
+    return flush(fd) < 0 ? -1 : n;
+     6f3:	83 ec 0c             	sub    $0xc,%esp
+     6f6:	56                   	push   %esi
+     6f7:	e8 08 fe ff ff       	call   504 <flush>
+     6fc:	83 c4 10             	add    $0x10,%esp
+     6ff:	85 c0                	test   %eax,%eax
+     701:	78 07                	js     70a <bufwrite+0x14f>
+     703:	89 d8                	mov    %ebx,%eax
+     705:	e9 63 ff ff ff       	jmp    66d <bufwrite+0xb2>
+     70a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     70f:	e9 59 ff ff ff       	jmp    66d <bufwrite+0xb2>
+        return flush(fd) < 0 ? -1 : n;
+     714:	83 ec 0c             	sub    $0xc,%esp
+     717:	56                   	push   %esi
+     718:	e8 e7 fd ff ff       	call   504 <flush>
+     71d:	83 c4 10             	add    $0x10,%esp
+     720:	85 c0                	test   %eax,%eax
+     722:	78 07                	js     72b <bufwrite+0x170>
+     724:	89 d8                	mov    %ebx,%eax
+     726:	e9 42 ff ff ff       	jmp    66d <bufwrite+0xb2>
+     72b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     730:	e9 38 ff ff ff       	jmp    66d <bufwrite+0xb2>
+    for(s = p, i = 0; i < n; i++)
+     735:	b8 00 00 00 00       	mov    $0x0,%eax
+     73a:	39 d8                	cmp    %ebx,%eax
+     73c:	7d 0e                	jge    74c <bufwrite+0x191>
+      if(s[i] == '\n')
+     73e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     741:	80 3c 01 0a          	cmpb   $0xa,(%ecx,%eax,1)
+     745:	74 cd                	je     714 <bufwrite+0x159>
+    for(s = p, i = 0; i < n; i++)
+     747:	83 c0 01             	add    $0x1,%eax
+     74a:	eb ee                	jmp    73a <bufwrite+0x17f>
+  return n;
+     74c:	89 d8                	mov    %ebx,%eax
+     74e:	e9 1a ff ff ff       	jmp    66d <bufwrite+0xb2>
+
+00000753 <fork>:
+
+int
+fork(void)
+{
+     753:	55                   	push   %ebp
+     754:	89 e5                	mov    %esp,%ebp
+     756:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     759:	6a ff                	push   $0xffffffff
+     75b:	e8 a4 fd ff ff       	call   504 <flush>
+  return _fork();
+     760:	e8 bd 00 00 00       	call   822 <_fork>
+}
+     765:	c9                   	leave
+     766:	c3                   	ret
+
+00000767 <exit>:
+
+int
+exit(void)
+{
+     767:	55                   	push   %ebp
+     768:	89 e5                	mov    %esp,%ebp
+     76a:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     76d:	6a ff                	push   $0xffffffff
+     76f:	e8 90 fd ff ff       	call   504 <flush>
+  _exit();
+     774:	e8 b8 00 00 00       	call   831 <_exit>
+
+00000779 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     779:	55                   	push   %ebp
+     77a:	89 e5                	mov    %esp,%ebp
+     77c:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     77f:	6a ff                	push   $0xffffffff
+     781:	e8 7e fd ff ff       	call   504 <flush>
+  return _exec(path, argv);
+     786:	83 c4 08             	add    $0x8,%esp
+     789:	ff 75 0c             	push   0xc(%ebp)
+     78c:	ff 75 08             	push   0x8(%ebp)
+     78f:	e8 bb 00 00 00       	call   84f <_exec>
+}
+     794:	c9                   	leave
+     795:	c3                   	ret
+
+00000796 <close>:
+
+int
+close(int fd)
+{
+     796:	55                   	push   %ebp
+     797:	89 e5                	mov    %esp,%ebp
+     799:	53                   	push   %ebx
+     79a:	83 ec 04             	sub    $0x4,%esp
+     79d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bufreset(fd);
+     7a0:	89 d8                	mov    %ebx,%eax
+     7a2:	e8 e7 fd ff ff       	call   58e <bufreset>
+  return _close(fd);
+     7a7:	83 ec 0c             	sub    $0xc,%esp
+     7aa:	53                   	push   %ebx
+     7ab:	e8 90 00 00 00       	call   840 <_close>
+}
+     7b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7b3:	c9                   	leave
+     7b4:	c3                   	ret
+
+000007b5 <stat>:
+{
+     7b5:	55                   	push   %ebp
+     7b6:	89 e5                	mov    %esp,%ebp
+     7b8:	56                   	push   %esi
+     7b9:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     7ba:	83 ec 08             	sub    $0x8,%esp
+     7bd:	6a 00                	push   $0x0
+     7bf:	ff 75 08             	push   0x8(%ebp)
+     7c2:	e8 f1 00 00 00       	call   8b8 <open>
+  if(fd < 0)
+     7c7:	83 c4 10             	add    $0x10,%esp
+     7ca:	85 c0                	test   %eax,%eax
+     7cc:	78 24                	js     7f2 <stat+0x3d>
+     7ce:	89 c3                	mov    %eax,%ebx
+  r = fstat(fd, st);
+     7d0:	83 ec 08             	sub    $0x8,%esp
+     7d3:	ff 75 0c             	push   0xc(%ebp)
+     7d6:	50                   	push   %eax
+     7d7:	e8 09 01 00 00       	call   8e5 <fstat>
+     7dc:	89 c6                	mov    %eax,%esi
+  close(fd);
+     7de:	89 1c 24             	mov    %ebx,(%esp)
+     7e1:	e8 b0 ff ff ff       	call   796 <close>
+  return r;
+     7e6:	83 c4 10             	add    $0x10,%esp
+}
+     7e9:	89 f0                	mov    %esi,%eax
+     7eb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     7ee:	5b                   	pop    %ebx
+     7ef:	5e                   	pop    %esi
+     7f0:	5d                   	pop    %ebp
+     7f1:	c3                   	ret
+    return -1;
+     7f2:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     7f7:	eb f0                	jmp    7e9 <stat+0x34>
+
+000007f9 <dup2>:
+
+int
+dup2(int oldfd, int newfd)
+{
+     7f9:	55                   	push   %ebp
+     7fa:	89 e5                	mov    %esp,%ebp
+     7fc:	56                   	push   %esi
+     7fd:	53                   	push   %ebx
+     7fe:	8b 75 08             	mov    0x8(%ebp),%esi
+     801:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(oldfd != newfd)
+     804:	39 de                	cmp    %ebx,%esi
+     806:	75 11                	jne    819 <dup2+0x20>
+    bufreset(newfd);
+  return _dup2(oldfd, newfd);
+     808:	83 ec 08             	sub    $0x8,%esp
+     80b:	53                   	push   %ebx
+     80c:	56                   	push   %esi
+     80d:	e8 4c 00 00 00       	call   85e <_dup2>
+}
+     812:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     815:	5b                   	pop    %ebx
+     816:	5e                   	pop    %esi
+     817:	5d                   	pop    %ebp
+     818:	c3                   	ret
+    bufreset(newfd);
+     819:	89 d8                	mov    %ebx,%eax
+     81b:	e8 6e fd ff ff       	call   58e <bufreset>
+     820:	eb e6                	jmp    808 <dup2+0xf>
+
+00000822 <_fork>:
+  1: ret
+
+#define SYSCALL(name) STUB(name, SYS_ ## name)
+
+# ulib.c wraps these, to flush printf()'s buffers first.
+STUB(_fork, SYS_fork)
+     822:	b8 01 00 00 00       	mov    $0x1,%eax
+     827:	89 e1                	mov    %esp,%ecx
+     829:	ba 30 08 00 00       	mov    $0x830,%edx
+     82e:	0f 34                	sysenter
+     830:	c3                   	ret
+
+00000831 <_exit>:
+STUB(_exit, SYS_exit)
+     831:	b8 02 00 00 00       	mov    $0x2,%eax
+     836:	89 e1                	mov    %esp,%ecx
+     838:	ba 3f 08 00 00       	mov    $0x83f,%edx
+     83d:	0f 34                	sysenter
+     83f:	c3                   	ret
+
+00000840 <_close>:
+STUB(_close, SYS_close)
+     840:	b8 15 00 00 00       	mov    $0x15,%eax
+     845:	89 e1                	mov    %esp,%ecx
+     847:	ba 4e 08 00 00       	mov    $0x84e,%edx
+     84c:	0f 34                	sysenter
+     84e:	c3                   	ret
+
+0000084f <_exec>:
+STUB(_exec, SYS_exec)
+     84f:	b8 07 00 00 00       	mov    $0x7,%eax
+     854:	89 e1                	mov    %esp,%ecx
+     856:	ba 5d 08 00 00       	mov    $0x85d,%edx
+     85b:	0f 34                	sysenter
+     85d:	c3                   	ret
+
+0000085e <_dup2>:
+STUB(_dup2, SYS_dup2)
+     85e:	b8 17 00 00 00       	mov    $0x17,%eax
+     863:	89 e1                	mov    %esp,%ecx
+     865:	ba 6c 08 00 00       	mov    $0x86c,%edx
+     86a:	0f 34                	sysenter
+     86c:	c3                   	ret
+
+0000086d <wait>:
+
+SYSCALL(wait)
+     86d:	b8 03 00 00 00       	mov    $0x3,%eax
+     872:	89 e1                	mov    %esp,%ecx
+     874:	ba 7b 08 00 00       	mov    $0x87b,%edx
+     879:	0f 34                	sysenter
+     87b:	c3                   	ret
+
+0000087c <pipe>:
+SYSCALL(pipe)
+     87c:	b8 04 00 00 00       	mov    $0x4,%eax
+     881:	89 e1                	mov    %esp,%ecx
+     883:	ba 8a 08 00 00       	mov    $0x88a,%edx
+     888:	0f 34                	sysenter
+     88a:	c3                   	ret
+
+0000088b <read>:
+SYSCALL(read)
+     88b:	b8 05 00 00 00       	mov    $0x5,%eax
+     890:	89 e1                	mov    %esp,%ecx
+     892:	ba 99 08 00 00       	mov    $0x899,%edx
+     897:	0f 34                	sysenter
+     899:	c3                   	ret
+
+0000089a <write>:
+SYSCALL(write)
+     89a:	b8 10 00 00 00       	mov    $0x10,%eax
+     89f:	89 e1                	mov    %esp,%ecx
+     8a1:	ba a8 08 00 00       	mov    $0x8a8,%edx
+     8a6:	0f 34                	sysenter
+     8a8:	c3                   	ret
+
+000008a9 <kill>:
+SYSCALL(kill)
+     8a9:	b8 06 00 00 00       	mov    $0x6,%eax
+     8ae:	89 e1                	mov    %esp,%ecx
+     8b0:	ba b7 08 00 00       	mov    $0x8b7,%edx
+     8b5:	0f 34                	sysenter
+     8b7:	c3                   	ret
+
+000008b8 <open>:
+SYSCALL(open)
+     8b8:	b8 0f 00 00 00       	mov    $0xf,%eax
+     8bd:	89 e1                	mov    %esp,%ecx
+     8bf:	ba c6 08 00 00       	mov    $0x8c6,%edx
+     8c4:	0f 34                	sysenter
+     8c6:	c3                   	ret
+
+000008c7 <mknod>:
+SYSCALL(mknod)
+     8c7:	b8 11 00 00 00       	mov    $0x11,%eax
+     8cc:	89 e1                	mov    %esp,%ecx
+     8ce:	ba d5 08 00 00       	mov    $0x8d5,%edx
+     8d3:	0f 34                	sysenter
+     8d5:	c3                   	ret
+
+000008d6 <unlink>:
+SYSCALL(unlink)
+     8d6:	b8 12 00 00 00       	mov    $0x12,%eax
+     8db:	89 e1                	mov    %esp,%ecx
+     8dd:	ba e4 08 00 00       	mov    $0x8e4,%edx
+     8e2:	0f 34                	sysenter
+     8e4:	c3                   	ret
+
+000008e5 <fstat>:
+SYSCALL(fstat)
+     8e5:	b8 08 00 00 00       	mov    $0x8,%eax
+     8ea:	89 e1                	mov    %esp,%ecx
+     8ec:	ba f3 08 00 00       	mov    $0x8f3,%edx
+     8f1:	0f 34                	sysenter
+     8f3:	c3                   	ret
+
+000008f4 <link>:
+SYSCALL(link)
+     8f4:	b8 13 00 00 00       	mov    $0x13,%eax
+     8f9:	89 e1                	mov    %esp,%ecx
+     8fb:	ba 02 09 00 00       	mov    $0x902,%edx
+     900:	0f 34                	sysenter
+     902:	c3                   	ret
+
+00000903 <mkdir>:
+SYSCALL(mkdir)
+     903:	b8 14 00 00 00       	mov    $0x14,%eax
+     908:	89 e1                	mov    %esp,%ecx
+     90a:	ba 11 09 00 00       	mov    $0x911,%edx
+     90f:	0f 34                	sysenter
+     911:	c3                   	ret
+
+00000912 <chdir>:
+SYSCALL(chdir)
+     912:	b8 09 00 00 00       	mov    $0x9,%eax
+     917:	89 e1                	mov    %esp,%ecx
+     919:	ba 20 09 00 00       	mov    $0x920,%edx
+     91e:	0f 34                	sysenter
+     920:	c3                   	ret
+
+00000921 <dup>:
+SYSCALL(dup)
+     921:	b8 0a 00 00 00       	mov    $0xa,%eax
+     926:	89 e1                	mov    %esp,%ecx
+     928:	ba 2f 09 00 00       	mov    $0x92f,%edx
+     92d:	0f 34                	sysenter
+     92f:	c3                   	ret
+
+00000930 <getpid>:
+SYSCALL(getpid)
+     930:	b8 0b 00 00 00       	mov    $0xb,%eax
+     935:	89 e1                	mov    %esp,%ecx
+     937:	ba 3e 09 00 00       	mov    $0x93e,%edx
+     93c:	0f 34                	sysenter
+     93e:	c3                   	ret
+
+0000093f <sbrk>:
+SYSCALL(sbrk)
+     93f:	b8 0c 00 00 00       	mov    $0xc,%eax
+     944:	89 e1                	mov    %esp,%ecx
+     946:	ba 4d 09 00 00       	mov    $0x94d,%edx
+     94b:	0f 34                	sysenter
+     94d:	c3                   	ret
+
+0000094e <sleep>:
+SYSCALL(sleep)
+     94e:	b8 0d 00 00 00       	mov    $0xd,%eax
+     953:	89 e1                	mov    %esp,%ecx
+     955:	ba 5c 09 00 00       	mov    $0x95c,%edx
+     95a:	0f 34                	sysenter
+     95c:	c3                   	ret
+
+0000095d <uptime>:
+SYSCALL(uptime)
+     95d:	b8 0e 00 00 00       	mov    $0xe,%eax
+     962:	89 e1                	mov    %esp,%ecx
+     964:	ba 6b 09 00 00       	mov    $0x96b,%edx
+     969:	0f 34                	sysenter
+     96b:	c3                   	ret
+
+0000096c <date>:
+SYSCALL(date)
+     96c:	b8 16 00 00 00       	mov    $0x16,%eax
+     971:	89 e1                	mov    %esp,%ecx
+     973:	ba 7a 09 00 00       	mov    $0x97a,%edx
+     978:	0f 34                	sysenter
+     97a:	c3                   	ret
+
+0000097b <faultaround>:
+SYSCALL(faultaround)
+     97b:	b8 18 00 00 00       	mov    $0x18,%eax
+     980:	89 e1                	mov    %esp,%ecx
+     982:	ba 89 09 00 00       	mov    $0x989,%edx
+     987:	0f 34                	sysenter
+     989:	c3                   	ret
+
+0000098a <faultstat>:
+SYSCALL(faultstat)
+     98a:	b8 19 00 00 00       	mov    $0x19,%eax
+     98f:	89 e1                	mov    %esp,%ecx
+     991:	ba 98 09 00 00       	mov    $0x998,%edx
+     996:	0f 34                	sysenter
+     998:	c3                   	ret
+
+00000999 <mmap>:
+SYSCALL(mmap)
+     999:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     99e:	89 e1                	mov    %esp,%ecx
+     9a0:	ba a7 09 00 00       	mov    $0x9a7,%edx
+     9a5:	0f 34                	sysenter
+     9a7:	c3                   	ret
+
+000009a8 <munmap>:
+SYSCALL(munmap)
+     9a8:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     9ad:	89 e1                	mov    %esp,%ecx
+     9af:	ba b6 09 00 00       	mov    $0x9b6,%edx
+     9b4:	0f 34                	sysenter
+     9b6:	c3                   	ret
+
+000009b7 <largepages>:
+SYSCALL(largepages)
+     9b7:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     9bc:	89 e1                	mov    %esp,%ecx
+     9be:	ba c5 09 00 00       	mov    $0x9c5,%edx
+     9c3:	0f 34                	sysenter
+     9c5:	c3                   	ret
+
+000009c6 <spawn>:
+SYSCALL(spawn)
+     9c6:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     9cb:	89 e1                	mov    %esp,%ecx
+     9cd:	ba d4 09 00 00       	mov    $0x9d4,%edx
+     9d2:	0f 34                	sysenter
+     9d4:	c3                   	ret
+
+000009d5 <setpriority>:
+SYSCALL(setpriority)
+     9d5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     9da:	89 e1                	mov    %esp,%ecx
+     9dc:	ba e3 09 00 00       	mov    $0x9e3,%edx
+     9e1:	0f 34                	sysenter
+     9e3:	c3                   	ret
+
+000009e4 <getpriority>:
+SYSCALL(getpriority)
+     9e4:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     9e9:	89 e1                	mov    %esp,%ecx
+     9eb:	ba f2 09 00 00       	mov    $0x9f2,%edx
+     9f0:	0f 34                	sysenter
+     9f2:	c3                   	ret
+
+000009f3 <getprocinfo>:
+SYSCALL(getprocinfo)
+     9f3:	b8 20 00 00 00       	mov    $0x20,%eax
+     9f8:	89 e1                	mov    %esp,%ecx
+     9fa:	ba 01 0a 00 00       	mov    $0xa01,%edx
+     9ff:	0f 34                	sysenter
+     a01:	c3                   	ret
+
+00000a02 <getcpuinfo>:
+SYSCALL(getcpuinfo)
+     a02:	b8 21 00 00 00       	mov    $0x21,%eax
+     a07:	89 e1                	mov    %esp,%ecx
+     a09:	ba 10 0a 00 00       	mov    $0xa10,%edx
+     a0e:	0f 34                	sysenter
+     a10:	c3                   	ret
+
+00000a11 <clone>:
+SYSCALL(clone)
+     a11:	b8 22 00 00 00       	mov    $0x22,%eax
+     a16:	89 e1                	mov    %esp,%ecx
+     a18:	ba 1f 0a 00 00       	mov    $0xa1f,%edx
+     a1d:	0f 34                	sysenter
+     a1f:	c3                   	ret
+
+00000a20 <join>:
+SYSCALL(join)
+     a20:	b8 23 00 00 00       	mov    $0x23,%eax
+     a25:	89 e1                	mov    %esp,%ecx
+     a27:	ba 2e 0a 00 00       	mov    $0xa2e,%edx
+     a2c:	0f 34                	sysenter
+     a2e:	c3                   	ret
+
+00000a2f <futex_wait>:
+SYSCALL(futex_wait)
+     a2f:	b8 24 00 00 00       	mov    $0x24,%eax
+     a34:	89 e1                	mov    %esp,%ecx
+     a36:	ba 3d 0a 00 00       	mov    $0xa3d,%edx
+     a3b:	0f 34                	sysenter
+     a3d:	c3                   	ret
+
+00000a3e <futex_wake>:
+SYSCALL(futex_wake)
+     a3e:	b8 25 00 00 00       	mov    $0x25,%eax
+     a43:	89 e1                	mov    %esp,%ecx
+     a45:	ba 4c 0a 00 00       	mov    $0xa4c,%edx
+     a4a:	0f 34                	sysenter
+     a4c:	c3                   	ret
+
+00000a4d <setaffinity>:
+SYSCALL(setaffinity)
+     a4d:	b8 26 00 00 00       	mov    $0x26,%eax
+     a52:	89 e1                	mov    %esp,%ecx
+     a54:	ba 5b 0a 00 00       	mov    $0xa5b,%edx
+     a59:	0f 34                	sysenter
+     a5b:	c3                   	ret
+
+00000a5c <getaffinity>:
+SYSCALL(getaffinity)
+     a5c:	b8 27 00 00 00       	mov    $0x27,%eax
+     a61:	89 e1                	mov    %esp,%ecx
+     a63:	ba 6a 0a 00 00       	mov    $0xa6a,%edx
+     a68:	0f 34                	sysenter
+     a6a:	c3                   	ret
+
+00000a6b <clock_gettime>:
+SYSCALL(clock_gettime)
+     a6b:	b8 28 00 00 00       	mov    $0x28,%eax
+     a70:	89 e1                	mov    %esp,%ecx
+     a72:	ba 79 0a 00 00       	mov    $0xa79,%edx
+     a77:	0f 34                	sysenter
+     a79:	c3                   	ret
+
+00000a7a <msleep>:
+SYSCALL(msleep)
+     a7a:	b8 29 00 00 00       	mov    $0x29,%eax
+     a7f:	89 e1                	mov    %esp,%ecx
+     a81:	ba 88 0a 00 00       	mov    $0xa88,%edx
+     a86:	0f 34                	sysenter
+     a88:	c3                   	ret
+
+00000a89 <lockstat>:
+SYSCALL(lockstat)
+     a89:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     a8e:	89 e1                	mov    %esp,%ecx
+     a90:	ba 97 0a 00 00       	mov    $0xa97,%edx
+     a95:	0f 34                	sysenter
+     a97:	c3                   	ret
+
+00000a98 <bstat>:
+SYSCALL(bstat)
+     a98:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     a9d:	89 e1                	mov    %esp,%ecx
+     a9f:	ba a6 0a 00 00       	mov    $0xaa6,%edx
+     aa4:	0f 34                	sysenter
+     aa6:	c3                   	ret
+
+00000aa7 <iostat>:
+SYSCALL(iostat)
+     aa7:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     aac:	89 e1                	mov    %esp,%ecx
+     aae:	ba b5 0a 00 00       	mov    $0xab5,%edx
+     ab3:	0f 34                	sysenter
+     ab5:	c3                   	ret
+
+00000ab6 <fsync>:
+SYSCALL(fsync)
+     ab6:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     abb:	89 e1                	mov    %esp,%ecx
+     abd:	ba c4 0a 00 00       	mov    $0xac4,%edx
+     ac2:	0f 34                	sysenter
+     ac4:	c3                   	ret
+
+00000ac5 <pread>:
+SYSCALL(pread)
+     ac5:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     aca:	89 e1                	mov    %esp,%ecx
+     acc:	ba d3 0a 00 00       	mov    $0xad3,%edx
+     ad1:	0f 34                	sysenter
+     ad3:	c3                   	ret
+
+00000ad4 <pwrite>:
+SYSCALL(pwrite)
+     ad4:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     ad9:	89 e1                	mov    %esp,%ecx
+     adb:	ba e2 0a 00 00       	mov    $0xae2,%edx
+     ae0:	0f 34                	sysenter
+     ae2:	c3                   	ret
+
+00000ae3 <readv>:
+SYSCALL(readv)
+     ae3:	b8 30 00 00 00       	mov    $0x30,%eax
+     ae8:	89 e1                	mov    %esp,%ecx
+     aea:	ba f1 0a 00 00       	mov    $0xaf1,%edx
+     aef:	0f 34                	sysenter
+     af1:	c3                   	ret
+
+00000af2 <writev>:
+SYSCALL(writev)
+     af2:	b8 31 00 00 00       	mov    $0x31,%eax
+     af7:	89 e1                	mov    %esp,%ecx
+     af9:	ba 00 0b 00 00       	mov    $0xb00,%edx
+     afe:	0f 34                	sysenter
+     b00:	c3                   	ret
+
+00000b01 <sendfile>:
+SYSCALL(sendfile)
+     b01:	b8 32 00 00 00       	mov    $0x32,%eax
+     b06:	89 e1                	mov    %esp,%ecx
+     b08:	ba 0f 0b 00 00       	mov    $0xb0f,%edx
+     b0d:	0f 34                	sysenter
+     b0f:	c3                   	ret
+
+00000b10 <fcntl>:
+SYSCALL(fcntl)
+     b10:	b8 33 00 00 00       	mov    $0x33,%eax
+     b15:	89 e1                	mov    %esp,%ecx
+     b17:	ba 1e 0b 00 00       	mov    $0xb1e,%edx
+     b1c:	0f 34                	sysenter
+     b1e:	c3                   	ret
+
+00000b1f <mount>:
+SYSCALL(mount)
+     b1f:	b8 34 00 00 00       	mov    $0x34,%eax
+     b24:	89 e1                	mov    %esp,%ecx
+     b26:	ba 2d 0b 00 00       	mov    $0xb2d,%edx
+     b2b:	0f 34                	sysenter
+     b2d:	c3                   	ret
+
+00000b2e <getdents>:
+SYSCALL(getdents)
+     b2e:	b8 35 00 00 00       	mov    $0x35,%eax
+     b33:	89 e1                	mov    %esp,%ecx
+     b35:	ba 3c 0b 00 00       	mov    $0xb3c,%edx
+     b3a:	0f 34                	sysenter
+     b3c:	c3                   	ret
+
+00000b3d <fstatat>:
+SYSCALL(fstatat)
+     b3d:	b8 36 00 00 00       	mov    $0x36,%eax
+     b42:	89 e1                	mov    %esp,%ecx
+     b44:	ba 4b 0b 00 00       	mov    $0xb4b,%edx
+     b49:	0f 34                	sysenter
+     b4b:	c3                   	ret
+
+00000b4c <sysstat>:
+SYSCALL(sysstat)
+     b4c:	b8 37 00 00 00       	mov    $0x37,%eax
+     b51:	89 e1                	mov    %esp,%ecx
+     b53:	ba 5a 0b 00 00       	mov    $0xb5a,%edx
+     b58:	0f 34                	sysenter
+     b5a:	c3                   	ret
+
+00000b5b <ringenter>:
+SYSCALL(ringenter)
+     b5b:	b8 38 00 00 00       	mov    $0x38,%eax
+     b60:	89 e1                	mov    %esp,%ecx
+     b62:	ba 69 0b 00 00       	mov    $0xb69,%edx
+     b67:	0f 34                	sysenter
+     b69:	c3                   	ret
+
+00000b6a <trace>:
+SYSCALL(trace)
+     b6a:	b8 39 00 00 00       	mov    $0x39,%eax
+     b6f:	89 e1                	mov    %esp,%ecx
+     b71:	ba 78 0b 00 00       	mov    $0xb78,%edx
+     b76:	0f 34                	sysenter
+     b78:	c3                   	ret
+
+00000b79 <memstat>:
+SYSCALL(memstat)
+     b79:	b8 3a 00 00 00       	mov    $0x3a,%eax
+     b7e:	89 e1                	mov    %esp,%ecx
+     b80:	ba 87 0b 00 00       	mov    $0xb87,%edx
+     b85:	0f 34                	sysenter
+     b87:	c3                   	ret
+
+00000b88 <shmget>:
+SYSCALL(shmget)
+     b88:	b8 3b 00 00 00       	mov    $0x3b,%eax
+     b8d:	89 e1                	mov    %esp,%ecx
+     b8f:	ba 96 0b 00 00       	mov    $0xb96,%edx
+     b94:	0f 34                	sysenter
+     b96:	c3                   	ret
+
+00000b97 <shmat>:
+SYSCALL(shmat)
+     b97:	b8 3c 00 00 00       	mov    $0x3c,%eax
+     b9c:	89 e1                	mov    %esp,%ecx
+     b9e:	ba a5 0b 00 00       	mov    $0xba5,%edx
+     ba3:	0f 34                	sysenter
+     ba5:	c3                   	ret
+
+00000ba6 <shmdt>:
+SYSCALL(shmdt)
+     ba6:	b8 3d 00 00 00       	mov    $0x3d,%eax
+     bab:	89 e1                	mov    %esp,%ecx
+     bad:	ba b4 0b 00 00       	mov    $0xbb4,%edx
+     bb2:	0f 34                	sysenter
+     bb4:	c3                   	ret
+
+00000bb5 <irqstat>:
+SYSCALL(irqstat)
+     bb5:	b8 3e 00 00 00       	mov    $0x3e,%eax
+     bba:	89 e1                	mov    %esp,%ecx
+     bbc:	ba c3 0b 00 00       	mov    $0xbc3,%edx
+     bc1:	0f 34                	sysenter
+     bc3:	c3                   	ret
+
+00000bc4 <irqroute>:
+SYSCALL(irqroute)
+     bc4:	b8 3f 00 00 00       	mov    $0x3f,%eax
+     bc9:	89 e1                	mov    %esp,%ecx
+     bcb:	ba d2 0b 00 00       	mov    $0xbd2,%edx
+     bd0:	0f 34                	sysenter
+     bd2:	c3                   	ret
+
+00000bd3 <putc>:
+  char buf[64];
+};
+
+static void
+putc(struct out *o, char c)
+{
+     bd3:	55                   	push   %ebp
+     bd4:	89 e5                	mov    %esp,%ebp
+     bd6:	56                   	push   %esi
+     bd7:	53                   	push   %ebx
+     bd8:	89 c3                	mov    %eax,%ebx
+     bda:	89 d6                	mov    %edx,%esi
+  if(o->n == sizeof(o->buf)){
+     bdc:	8b 40 04             	mov    0x4(%eax),%eax
+     bdf:	83 f8 40             	cmp    $0x40,%eax
+     be2:	74 16                	je     bfa <putc+0x27>
+    bufwrite(o->fd, o->buf, o->n);
+    o->n = 0;
+  }
+  o->buf[o->n++] = c;
+     be4:	8b 43 04             	mov    0x4(%ebx),%eax
+     be7:	8d 50 01             	lea    0x1(%eax),%edx
+     bea:	89 53 04             	mov    %edx,0x4(%ebx)
+     bed:	89 f1                	mov    %esi,%ecx
+     bef:	88 4c 03 08          	mov    %cl,0x8(%ebx,%eax,1)
+}
+     bf3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     bf6:	5b                   	pop    %ebx
+     bf7:	5e                   	pop    %esi
+     bf8:	5d                   	pop    %ebp
+     bf9:	c3                   	ret
+    bufwrite(o->fd, o->buf, o->n);
+     bfa:	8d 53 08             	lea    0x8(%ebx),%edx
+     bfd:	83 ec 04             	sub    $0x4,%esp
+     c00:	50                   	push   %eax
+     c01:	52                   	push   %edx
+     c02:	ff 33                	push   (%ebx)
+     c04:	e8 b2 f9 ff ff       	call   5bb <bufwrite>
+    o->n = 0;
+     c09:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     c10:	83 c4 10             	add    $0x10,%esp
+     c13:	eb cf                	jmp    be4 <putc+0x11>
+
+00000c15 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     c15:	55                   	push   %ebp
+     c16:	89 e5                	mov    %esp,%ebp
+     c18:	57                   	push   %edi
+     c19:	56                   	push   %esi
+     c1a:	53                   	push   %ebx
+     c1b:	83 ec 2c             	sub    $0x2c,%esp
+     c1e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     c21:	89 d0                	mov    %edx,%eax
+     c23:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+     c25:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     c29:	0f 95 c1             	setne  %cl
+     c2c:	c1 ea 1f             	shr    $0x1f,%edx
+     c2f:	84 d1                	test   %dl,%cl
+     c31:	74 44                	je     c77 <printint+0x62>
+    neg = 1;
+    x = -xx;
+     c33:	f7 d8                	neg    %eax
+     c35:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+     c37:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     c3e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+     c43:	89 c8                	mov    %ecx,%eax
+     c45:	ba 00 00 00 00       	mov    $0x0,%edx
+     c4a:	f7 f6                	div    %esi
+     c4c:	89 df                	mov    %ebx,%edi
+     c4e:	83 c3 01             	add    $0x1,%ebx
+     c51:	0f b6 92 d0 13 00 00 	movzbl 0x13d0(%edx),%edx
+     c58:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+     c5c:	89 ca                	mov    %ecx,%edx
+     c5e:	89 c1                	mov    %eax,%ecx
+     c60:	39 f2                	cmp    %esi,%edx
+     c62:	73 df                	jae    c43 <printint+0x2e>
+  if(neg)
+     c64:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     c68:	74 31                	je     c9b <printint+0x86>
+    buf[i++] = '-';
+     c6a:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+     c6f:	8d 5f 02             	lea    0x2(%edi),%ebx
+     c72:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     c75:	eb 17                	jmp    c8e <printint+0x79>
+    x = xx;
+     c77:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+     c79:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     c80:	eb bc                	jmp    c3e <printint+0x29>
+
+  while(--i >= 0)
+    putc(o, buf[i]);
+     c82:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+     c87:	89 f0                	mov    %esi,%eax
+     c89:	e8 45 ff ff ff       	call   bd3 <putc>
+  while(--i >= 0)
+     c8e:	83 eb 01             	sub    $0x1,%ebx
+     c91:	79 ef                	jns    c82 <printint+0x6d>
+}
+     c93:	83 c4 2c             	add    $0x2c,%esp
+     c96:	5b                   	pop    %ebx
+     c97:	5e                   	pop    %esi
+     c98:	5f                   	pop    %edi
+     c99:	5d                   	pop    %ebp
+     c9a:	c3                   	ret
+     c9b:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     c9e:	eb ee                	jmp    c8e <printint+0x79>
+
+00000ca0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     ca0:	55                   	push   %ebp
+     ca1:	89 e5                	mov    %esp,%ebp
+     ca3:	57                   	push   %edi
+     ca4:	56                   	push   %esi
+     ca5:	53                   	push   %ebx
+     ca6:	83 ec 6c             	sub    $0x6c,%esp
+  int c, i, state;
+  uint *ap;
+  struct out out, *o;
+
+  o = &out;
+  o->fd = fd;
+     ca9:	8b 45 08             	mov    0x8(%ebp),%eax
+     cac:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  o->n = 0;
+     caf:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+     cb6:	8d 45 10             	lea    0x10(%ebp),%eax
+     cb9:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  state = 0;
+     cbc:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+     cc1:	bb 00 00 00 00       	mov    $0x0,%ebx
+     cc6:	eb 14                	jmp    cdc <printf+0x3c>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(o, c);
+     cc8:	89 fa                	mov    %edi,%edx
+     cca:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     ccd:	e8 01 ff ff ff       	call   bd3 <putc>
+     cd2:	eb 05                	jmp    cd9 <printf+0x39>
+      }
+    } else if(state == '%'){
+     cd4:	83 fe 25             	cmp    $0x25,%esi
+     cd7:	74 25                	je     cfe <printf+0x5e>
+  for(i = 0; fmt[i]; i++){
+     cd9:	83 c3 01             	add    $0x1,%ebx
+     cdc:	8b 45 0c             	mov    0xc(%ebp),%eax
+     cdf:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+     ce3:	84 c0                	test   %al,%al
+     ce5:	0f 84 20 01 00 00    	je     e0b <printf+0x16b>
+    c = fmt[i] & 0xff;
+     ceb:	0f be f8             	movsbl %al,%edi
+     cee:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     cf1:	85 f6                	test   %esi,%esi
+     cf3:	75 df                	jne    cd4 <printf+0x34>
+      if(c == '%'){
+     cf5:	83 f8 25             	cmp    $0x25,%eax
+     cf8:	75 ce                	jne    cc8 <printf+0x28>
+        state = '%';
+     cfa:	89 c6                	mov    %eax,%esi
+     cfc:	eb db                	jmp    cd9 <printf+0x39>
+      if(c == 'd'){
+     cfe:	83 f8 25             	cmp    $0x25,%eax
+     d01:	0f 84 cf 00 00 00    	je     dd6 <printf+0x136>
+     d07:	0f 8c dd 00 00 00    	jl     dea <printf+0x14a>
+     d0d:	83 f8 78             	cmp    $0x78,%eax
+     d10:	0f 8f d4 00 00 00    	jg     dea <printf+0x14a>
+     d16:	83 f8 63             	cmp    $0x63,%eax
+     d19:	0f 8c cb 00 00 00    	jl     dea <printf+0x14a>
+     d1f:	83 e8 63             	sub    $0x63,%eax
+     d22:	83 f8 15             	cmp    $0x15,%eax
+     d25:	0f 87 bf 00 00 00    	ja     dea <printf+0x14a>
+     d2b:	ff 24 85 78 13 00 00 	jmp    *0x1378(,%eax,4)
+        printint(o, *ap, 10, 1);
+     d32:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     d35:	8b 17                	mov    (%edi),%edx
+     d37:	83 ec 0c             	sub    $0xc,%esp
+     d3a:	6a 01                	push   $0x1
+     d3c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     d41:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d44:	e8 cc fe ff ff       	call   c15 <printint>
+        ap++;
+     d49:	83 c7 04             	add    $0x4,%edi
+     d4c:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     d4f:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(o, '%');
+        putc(o, c);
+      }
+      state = 0;
+     d52:	be 00 00 00 00       	mov    $0x0,%esi
+     d57:	eb 80                	jmp    cd9 <printf+0x39>
+        printint(o, *ap, 16, 0);
+     d59:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     d5c:	8b 17                	mov    (%edi),%edx
+     d5e:	83 ec 0c             	sub    $0xc,%esp
+     d61:	6a 00                	push   $0x0
+     d63:	b9 10 00 00 00       	mov    $0x10,%ecx
+     d68:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d6b:	e8 a5 fe ff ff       	call   c15 <printint>
+        ap++;
+     d70:	83 c7 04             	add    $0x4,%edi
+     d73:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     d76:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d79:	be 00 00 00 00       	mov    $0x0,%esi
+     d7e:	e9 56 ff ff ff       	jmp    cd9 <printf+0x39>
+        s = (char*)*ap;
+     d83:	8b 45 94             	mov    -0x6c(%ebp),%eax
+     d86:	8b 30                	mov    (%eax),%esi
+        ap++;
+     d88:	83 c0 04             	add    $0x4,%eax
+     d8b:	89 45 94             	mov    %eax,-0x6c(%ebp)
+        if(s == 0)
+     d8e:	85 f6                	test   %esi,%esi
+     d90:	75 15                	jne    da7 <printf+0x107>
+          s = "(null)";
+     d92:	be 71 13 00 00       	mov    $0x1371,%esi
+     d97:	eb 0e                	jmp    da7 <printf+0x107>
+          putc(o, *s);
+     d99:	0f be d2             	movsbl %dl,%edx
+     d9c:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d9f:	e8 2f fe ff ff       	call   bd3 <putc>
+          s++;
+     da4:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+     da7:	0f b6 16             	movzbl (%esi),%edx
+     daa:	84 d2                	test   %dl,%dl
+     dac:	75 eb                	jne    d99 <printf+0xf9>
+      state = 0;
+     dae:	be 00 00 00 00       	mov    $0x0,%esi
+     db3:	e9 21 ff ff ff       	jmp    cd9 <printf+0x39>
+        putc(o, *ap);
+     db8:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     dbb:	0f be 17             	movsbl (%edi),%edx
+     dbe:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     dc1:	e8 0d fe ff ff       	call   bd3 <putc>
+        ap++;
+     dc6:	83 c7 04             	add    $0x4,%edi
+     dc9:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+      state = 0;
+     dcc:	be 00 00 00 00       	mov    $0x0,%esi
+     dd1:	e9 03 ff ff ff       	jmp    cd9 <printf+0x39>
+        putc(o, c);
+     dd6:	89 fa                	mov    %edi,%edx
+     dd8:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     ddb:	e8 f3 fd ff ff       	call   bd3 <putc>
+      state = 0;
+     de0:	be 00 00 00 00       	mov    $0x0,%esi
+     de5:	e9 ef fe ff ff       	jmp    cd9 <printf+0x39>
+        putc(o, '%');
+     dea:	ba 25 00 00 00       	mov    $0x25,%edx
+     def:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     df2:	e8 dc fd ff ff       	call   bd3 <putc>
+        putc(o, c);
+     df7:	89 fa                	mov    %edi,%edx
+     df9:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     dfc:	e8 d2 fd ff ff       	call   bd3 <putc>
+      state = 0;
+     e01:	be 00 00 00 00       	mov    $0x0,%esi
+     e06:	e9 ce fe ff ff       	jmp    cd9 <printf+0x39>
+    }
+  }
+  if(o->n > 0)
+     e0b:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     e0e:	85 c0                	test   %eax,%eax
+     e10:	7f 08                	jg     e1a <printf+0x17a>
+    bufwrite(fd, o->buf, o->n);
+}
+     e12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e15:	5b                   	pop    %ebx
+     e16:	5e                   	pop    %esi
+     e17:	5f                   	pop    %edi
+     e18:	5d                   	pop    %ebp
+     e19:	c3                   	ret
+    bufwrite(fd, o->buf, o->n);
+     e1a:	83 ec 04             	sub    $0x4,%esp
+     e1d:	50                   	push   %eax
+     e1e:	8d 45 a8             	lea    -0x58(%ebp),%eax
+     e21:	50                   	push   %eax
+     e22:	ff 75 08             	push   0x8(%ebp)
+     e25:	e8 91 f7 ff ff       	call   5bb <bufwrite>
+     e2a:	83 c4 10             	add    $0x10,%esp
+}
+     e2d:	eb e3                	jmp    e12 <printf+0x172>
+
+00000e2f <largefree>:
+  return &b->h;
+}
+
+static void
+largefree(Fblock *b)
+{
+     e2f:	55                   	push   %ebp
+     e30:	89 e5                	mov    %esp,%ebp
+     e32:	57                   	push   %edi
+     e33:	56                   	push   %esi
+     e34:	53                   	push   %ebx
+     e35:	83 ec 0c             	sub    $0xc,%esp
+     e38:	89 c1                	mov    %eax,%ecx
+  Fblock **pp, *p, *prev;
+
+  prev = 0;
+     e3a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     e3f:	ba 2c 3b 00 00       	mov    $0x3b2c,%edx
+     e44:	eb 05                	jmp    e4b <largefree+0x1c>
+     e46:	8d 50 08             	lea    0x8(%eax),%edx
+    prev = p;
+     e49:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     e4b:	8b 02                	mov    (%edx),%eax
+     e4d:	85 c0                	test   %eax,%eax
+     e4f:	74 04                	je     e55 <largefree+0x26>
+     e51:	39 c8                	cmp    %ecx,%eax
+     e53:	72 f1                	jb     e46 <largefree+0x17>
+  b->next = p;
+     e55:	89 41 08             	mov    %eax,0x8(%ecx)
+  if(p && (char*)b + b->h.size == (char*)p){
+     e58:	85 c0                	test   %eax,%eax
+     e5a:	74 09                	je     e65 <largefree+0x36>
+     e5c:	8b 31                	mov    (%ecx),%esi
+     e5e:	8d 3c 31             	lea    (%ecx,%esi,1),%edi
+     e61:	39 c7                	cmp    %eax,%edi
+     e63:	74 21                	je     e86 <largefree+0x57>
+    b->h.size += p->h.size;
+    b->next = p->next;
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+     e65:	85 db                	test   %ebx,%ebx
+     e67:	74 09                	je     e72 <largefree+0x43>
+     e69:	8b 03                	mov    (%ebx),%eax
+     e6b:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+     e6e:	39 ce                	cmp    %ecx,%esi
+     e70:	74 20                	je     e92 <largefree+0x63>
+    prev->h.size += b->h.size;
+    prev->next = b->next;
+  } else
+    *pp = b;
+     e72:	89 0a                	mov    %ecx,(%edx)
+
+  // Give the top of the heap back.  With threads sharing the
+  // address space sbrk() cannot shrink it; keep the block then.
+  for(pp = &large; (*pp)->next; pp = &(*pp)->next)
+     e74:	be 2c 3b 00 00       	mov    $0x3b2c,%esi
+     e79:	8b 1e                	mov    (%esi),%ebx
+     e7b:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+     e7f:	74 1d                	je     e9e <largefree+0x6f>
+     e81:	8d 73 08             	lea    0x8(%ebx),%esi
+     e84:	eb f3                	jmp    e79 <largefree+0x4a>
+    b->h.size += p->h.size;
+     e86:	03 30                	add    (%eax),%esi
+     e88:	89 31                	mov    %esi,(%ecx)
+    b->next = p->next;
+     e8a:	8b 40 08             	mov    0x8(%eax),%eax
+     e8d:	89 41 08             	mov    %eax,0x8(%ecx)
+     e90:	eb d3                	jmp    e65 <largefree+0x36>
+    prev->h.size += b->h.size;
+     e92:	03 01                	add    (%ecx),%eax
+     e94:	89 03                	mov    %eax,(%ebx)
+    prev->next = b->next;
+     e96:	8b 41 08             	mov    0x8(%ecx),%eax
+     e99:	89 43 08             	mov    %eax,0x8(%ebx)
+     e9c:	eb d6                	jmp    e74 <largefree+0x45>
+    ;
+  b = *pp;
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     e9e:	89 df                	mov    %ebx,%edi
+     ea0:	03 3b                	add    (%ebx),%edi
+     ea2:	83 ec 0c             	sub    $0xc,%esp
+     ea5:	6a 00                	push   $0x0
+     ea7:	e8 93 fa ff ff       	call   93f <sbrk>
+     eac:	83 c4 10             	add    $0x10,%esp
+     eaf:	39 c7                	cmp    %eax,%edi
+     eb1:	74 08                	je     ebb <largefree+0x8c>
+    *pp = 0;
+}
+     eb3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     eb6:	5b                   	pop    %ebx
+     eb7:	5e                   	pop    %esi
+     eb8:	5f                   	pop    %edi
+     eb9:	5d                   	pop    %ebp
+     eba:	c3                   	ret
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     ebb:	8b 03                	mov    (%ebx),%eax
+     ebd:	f7 d8                	neg    %eax
+     ebf:	83 ec 0c             	sub    $0xc,%esp
+     ec2:	50                   	push   %eax
+     ec3:	e8 77 fa ff ff       	call   93f <sbrk>
+     ec8:	83 c4 10             	add    $0x10,%esp
+     ecb:	83 f8 ff             	cmp    $0xffffffff,%eax
+     ece:	74 e3                	je     eb3 <largefree+0x84>
+    *pp = 0;
+     ed0:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+     ed6:	eb db                	jmp    eb3 <largefree+0x84>
+
+00000ed8 <more>:
+{
+     ed8:	55                   	push   %ebp
+     ed9:	89 e5                	mov    %esp,%ebp
+     edb:	56                   	push   %esi
+     edc:	53                   	push   %ebx
+     edd:	89 c6                	mov    %eax,%esi
+  pad = -(uint)sbrk(0) & 7;
+     edf:	83 ec 0c             	sub    $0xc,%esp
+     ee2:	6a 00                	push   $0x0
+     ee4:	e8 56 fa ff ff       	call   93f <sbrk>
+     ee9:	f7 d8                	neg    %eax
+     eeb:	89 c3                	mov    %eax,%ebx
+     eed:	83 e3 07             	and    $0x7,%ebx
+  if((p = sbrk(n + pad)) == (char*)-1)
+     ef0:	01 de                	add    %ebx,%esi
+     ef2:	89 34 24             	mov    %esi,(%esp)
+     ef5:	e8 45 fa ff ff       	call   93f <sbrk>
+     efa:	83 c4 10             	add    $0x10,%esp
+     efd:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f00:	74 09                	je     f0b <more+0x33>
+  return p + pad;
+     f02:	01 d8                	add    %ebx,%eax
+}
+     f04:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f07:	5b                   	pop    %ebx
+     f08:	5e                   	pop    %esi
+     f09:	5d                   	pop    %ebp
+     f0a:	c3                   	ret
+    return 0;
+     f0b:	b8 00 00 00 00       	mov    $0x0,%eax
+     f10:	eb f2                	jmp    f04 <more+0x2c>
+
+00000f12 <slaballoc>:
+{
+     f12:	55                   	push   %ebp
+     f13:	89 e5                	mov    %esp,%ebp
+     f15:	56                   	push   %esi
+     f16:	53                   	push   %ebx
+     f17:	89 c6                	mov    %eax,%esi
+  n = 1 << (MINSHIFT + c);
+     f19:	8d 48 04             	lea    0x4(%eax),%ecx
+     f1c:	bb 01 00 00 00       	mov    $0x1,%ebx
+     f21:	d3 e3                	shl    %cl,%ebx
+  if(slab + n > slabend){
+     f23:	89 d8                	mov    %ebx,%eax
+     f25:	03 05 28 3b 00 00    	add    0x3b28,%eax
+     f2b:	39 05 24 3b 00 00    	cmp    %eax,0x3b24
+     f31:	72 17                	jb     f4a <slaballoc+0x38>
+  h = (Header*)slab;
+     f33:	a1 28 3b 00 00       	mov    0x3b28,%eax
+  slab += n;
+     f38:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+     f3b:	89 15 28 3b 00 00    	mov    %edx,0x3b28
+  h->size = n;
+     f41:	89 18                	mov    %ebx,(%eax)
+  h->class = c;
+     f43:	89 70 04             	mov    %esi,0x4(%eax)
+}
+     f46:	5b                   	pop    %ebx
+     f47:	5e                   	pop    %esi
+     f48:	5d                   	pop    %ebp
+     f49:	c3                   	ret
+    if((p = more(SLABSZ)) == 0)
+     f4a:	b8 00 40 00 00       	mov    $0x4000,%eax
+     f4f:	e8 84 ff ff ff       	call   ed8 <more>
+     f54:	85 c0                	test   %eax,%eax
+     f56:	74 ee                	je     f46 <slaballoc+0x34>
+    if(p != slabend)
+     f58:	39 05 24 3b 00 00    	cmp    %eax,0x3b24
+     f5e:	74 05                	je     f65 <slaballoc+0x53>
+      slab = p;
+     f60:	a3 28 3b 00 00       	mov    %eax,0x3b28
+    slabend = p + SLABSZ;
+     f65:	05 00 40 00 00       	add    $0x4000,%eax
+     f6a:	a3 24 3b 00 00       	mov    %eax,0x3b24
+     f6f:	eb c2                	jmp    f33 <slaballoc+0x21>
+
+00000f71 <largealloc>:
+{
+     f71:	55                   	push   %ebp
+     f72:	89 e5                	mov    %esp,%ebp
+     f74:	56                   	push   %esi
+     f75:	53                   	push   %ebx
+     f76:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     f78:	b9 2c 3b 00 00       	mov    $0x3b2c,%ecx
+     f7d:	8b 01                	mov    (%ecx),%eax
+     f7f:	85 c0                	test   %eax,%eax
+     f81:	74 36                	je     fb9 <largealloc+0x48>
+    if(b->h.size < n)
+     f83:	8b 10                	mov    (%eax),%edx
+     f85:	39 da                	cmp    %ebx,%edx
+     f87:	72 24                	jb     fad <largealloc+0x3c>
+    if(b->h.size - n > SMALLMAX){
+     f89:	29 da                	sub    %ebx,%edx
+     f8b:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+     f91:	76 1f                	jbe    fb2 <largealloc+0x41>
+      rest = (Fblock*)((char*)b + n);
+     f93:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+      rest->h.size = b->h.size - n;
+     f96:	89 16                	mov    %edx,(%esi)
+      rest->h.class = LARGE;
+     f98:	c7 46 04 09 00 00 00 	movl   $0x9,0x4(%esi)
+      rest->next = b->next;
+     f9f:	8b 50 08             	mov    0x8(%eax),%edx
+     fa2:	89 56 08             	mov    %edx,0x8(%esi)
+      *pp = rest;
+     fa5:	89 31                	mov    %esi,(%ecx)
+      b->h.size = n;
+     fa7:	89 18                	mov    %ebx,(%eax)
+}
+     fa9:	5b                   	pop    %ebx
+     faa:	5e                   	pop    %esi
+     fab:	5d                   	pop    %ebp
+     fac:	c3                   	ret
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     fad:	8d 48 08             	lea    0x8(%eax),%ecx
+     fb0:	eb cb                	jmp    f7d <largealloc+0xc>
+      *pp = b->next;
+     fb2:	8b 50 08             	mov    0x8(%eax),%edx
+     fb5:	89 11                	mov    %edx,(%ecx)
+    return &b->h;
+     fb7:	eb f0                	jmp    fa9 <largealloc+0x38>
+  if((b = more(n)) == 0)
+     fb9:	89 d8                	mov    %ebx,%eax
+     fbb:	e8 18 ff ff ff       	call   ed8 <more>
+     fc0:	85 c0                	test   %eax,%eax
+     fc2:	74 e5                	je     fa9 <largealloc+0x38>
+  b->h.size = n;
+     fc4:	89 18                	mov    %ebx,(%eax)
+  b->h.class = LARGE;
+     fc6:	c7 40 04 09 00 00 00 	movl   $0x9,0x4(%eax)
+  return &b->h;
+     fcd:	eb da                	jmp    fa9 <largealloc+0x38>
+
+00000fcf <free>:
+
+void
+free(void *ap)
+{
+     fcf:	55                   	push   %ebp
+     fd0:	89 e5                	mov    %esp,%ebp
+     fd2:	56                   	push   %esi
+     fd3:	53                   	push   %ebx
+     fd4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+
+  if(ap == 0)
+     fd7:	85 db                	test   %ebx,%ebx
+     fd9:	74 3b                	je     1016 <free+0x47>
+    return;
+  h = (Header*)ap - 1;
+     fdb:	8d 73 f8             	lea    -0x8(%ebx),%esi
+  lock_acquire(&lock);
+     fde:	83 ec 0c             	sub    $0xc,%esp
+     fe1:	68 20 3b 00 00       	push   $0x3b20
+     fe6:	e8 9c 01 00 00       	call   1187 <lock_acquire>
+  if(h->class == LARGE)
+     feb:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     fee:	83 c4 10             	add    $0x10,%esp
+     ff1:	83 f8 09             	cmp    $0x9,%eax
+     ff4:	74 27                	je     101d <free+0x4e>
+    largefree((Fblock*)h);
+  else {
+    ((Fblock*)h)->next = freelist[h->class];
+     ff6:	8b 14 85 40 3b 00 00 	mov    0x3b40(,%eax,4),%edx
+     ffd:	89 13                	mov    %edx,(%ebx)
+    freelist[h->class] = (Fblock*)h;
+     fff:	89 34 85 40 3b 00 00 	mov    %esi,0x3b40(,%eax,4)
+  }
+  lock_release(&lock);
+    1006:	83 ec 0c             	sub    $0xc,%esp
+    1009:	68 20 3b 00 00       	push   $0x3b20
+    100e:	e8 88 01 00 00       	call   119b <lock_release>
+    1013:	83 c4 10             	add    $0x10,%esp
+}
+    1016:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1019:	5b                   	pop    %ebx
+    101a:	5e                   	pop    %esi
+    101b:	5d                   	pop    %ebp
+    101c:	c3                   	ret
+    largefree((Fblock*)h);
+    101d:	89 f0                	mov    %esi,%eax
+    101f:	e8 0b fe ff ff       	call   e2f <largefree>
+    1024:	eb e0                	jmp    1006 <free+0x37>
+
+00001026 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1026:	55                   	push   %ebp
+    1027:	89 e5                	mov    %esp,%ebp
+    1029:	53                   	push   %ebx
+    102a:	83 ec 04             	sub    $0x4,%esp
+    102d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+  uint n;
+  int c;
+
+  if(nbytes > 0x7fffffff - sizeof(Header) - 7)
+    1030:	81 fb f0 ff ff 7f    	cmp    $0x7ffffff0,%ebx
+    1036:	0f 87 8b 00 00 00    	ja     10c7 <malloc+0xa1>
+    return 0;
+  n = (nbytes + sizeof(Header) + 7) & ~7;
+    103c:	83 c3 0f             	add    $0xf,%ebx
+    103f:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(n < sizeof(Fblock))
+    1042:	83 fb 0b             	cmp    $0xb,%ebx
+    1045:	77 05                	ja     104c <malloc+0x26>
+    n = sizeof(Fblock);
+    1047:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  lock_acquire(&lock);
+    104c:	83 ec 0c             	sub    $0xc,%esp
+    104f:	68 20 3b 00 00       	push   $0x3b20
+    1054:	e8 2e 01 00 00       	call   1187 <lock_acquire>
+  if(n <= SMALLMAX){
+    1059:	83 c4 10             	add    $0x10,%esp
+    105c:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+    1062:	77 58                	ja     10bc <malloc+0x96>
+    for(c = 0; (1 << (MINSHIFT + c)) < n; c++)
+    1064:	ba 00 00 00 00       	mov    $0x0,%edx
+    1069:	eb 03                	jmp    106e <malloc+0x48>
+    106b:	83 c2 01             	add    $0x1,%edx
+    106e:	8d 4a 04             	lea    0x4(%edx),%ecx
+    1071:	b8 01 00 00 00       	mov    $0x1,%eax
+    1076:	d3 e0                	shl    %cl,%eax
+    1078:	39 d8                	cmp    %ebx,%eax
+    107a:	72 ef                	jb     106b <malloc+0x45>
+      ;
+    if(freelist[c]){
+    107c:	8b 04 95 40 3b 00 00 	mov    0x3b40(,%edx,4),%eax
+    1083:	85 c0                	test   %eax,%eax
+    1085:	74 2a                	je     10b1 <malloc+0x8b>
+      h = &freelist[c]->h;
+    1087:	89 c3                	mov    %eax,%ebx
+      freelist[c] = freelist[c]->next;
+    1089:	8b 40 08             	mov    0x8(%eax),%eax
+    108c:	89 04 95 40 3b 00 00 	mov    %eax,0x3b40(,%edx,4)
+    } else
+      h = slaballoc(c);
+  } else
+    h = largealloc(n);
+  lock_release(&lock);
+    1093:	83 ec 0c             	sub    $0xc,%esp
+    1096:	68 20 3b 00 00       	push   $0x3b20
+    109b:	e8 fb 00 00 00       	call   119b <lock_release>
+  return h ? (void*)(h + 1) : 0;
+    10a0:	83 c4 10             	add    $0x10,%esp
+    10a3:	85 db                	test   %ebx,%ebx
+    10a5:	74 03                	je     10aa <malloc+0x84>
+    10a7:	83 c3 08             	add    $0x8,%ebx
+}
+    10aa:	89 d8                	mov    %ebx,%eax
+    10ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10af:	c9                   	leave
+    10b0:	c3                   	ret
+      h = slaballoc(c);
+    10b1:	89 d0                	mov    %edx,%eax
+    10b3:	e8 5a fe ff ff       	call   f12 <slaballoc>
+    10b8:	89 c3                	mov    %eax,%ebx
+    10ba:	eb d7                	jmp    1093 <malloc+0x6d>
+    h = largealloc(n);
+    10bc:	89 d8                	mov    %ebx,%eax
+    10be:	e8 ae fe ff ff       	call   f71 <largealloc>
+    10c3:	89 c3                	mov    %eax,%ebx
+    10c5:	eb cc                	jmp    1093 <malloc+0x6d>
+    return 0;
+    10c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+    10cc:	eb dc                	jmp    10aa <malloc+0x84>
+
+000010ce <tstart>:
+  void *arg;
+};
+
+static void
+tstart(void *a)
+{
+    10ce:	55                   	push   %ebp
+    10cf:	89 e5                	mov    %esp,%ebp
+    10d1:	83 ec 14             	sub    $0x14,%esp
+    10d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+    10d7:	ff 70 04             	push   0x4(%eax)
+    10da:	ff 10                	call   *(%eax)
+  exit();
+    10dc:	e8 86 f6 ff ff       	call   767 <exit>
+
+000010e1 <thread_create>:
+}
+
+// Run fn(arg) in a new thread.  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    10e1:	55                   	push   %ebp
+    10e2:	89 e5                	mov    %esp,%ebp
+    10e4:	56                   	push   %esi
+    10e5:	53                   	push   %ebx
+  struct tstart *t;
+  char *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    10e6:	83 ec 0c             	sub    $0xc,%esp
+    10e9:	68 00 10 00 00       	push   $0x1000
+    10ee:	e8 33 ff ff ff       	call   1026 <malloc>
+    10f3:	83 c4 10             	add    $0x10,%esp
+    10f6:	85 c0                	test   %eax,%eax
+    10f8:	74 42                	je     113c <thread_create+0x5b>
+    10fa:	89 c3                	mov    %eax,%ebx
+    return -1;
+  t = (struct tstart*)stack;
+  t->fn = fn;
+    10fc:	8b 45 08             	mov    0x8(%ebp),%eax
+    10ff:	89 03                	mov    %eax,(%ebx)
+  t->arg = arg;
+    1101:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1104:	89 43 04             	mov    %eax,0x4(%ebx)
+  if((pid = clone(tstart, stack + TSTACK, t)) < 0)
+    1107:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    110d:	83 ec 04             	sub    $0x4,%esp
+    1110:	53                   	push   %ebx
+    1111:	50                   	push   %eax
+    1112:	68 ce 10 00 00       	push   $0x10ce
+    1117:	e8 f5 f8 ff ff       	call   a11 <clone>
+    111c:	89 c6                	mov    %eax,%esi
+    111e:	83 c4 10             	add    $0x10,%esp
+    1121:	85 c0                	test   %eax,%eax
+    1123:	78 09                	js     112e <thread_create+0x4d>
+    free(stack);
+  return pid;
+}
+    1125:	89 f0                	mov    %esi,%eax
+    1127:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    112a:	5b                   	pop    %ebx
+    112b:	5e                   	pop    %esi
+    112c:	5d                   	pop    %ebp
+    112d:	c3                   	ret
+    free(stack);
+    112e:	83 ec 0c             	sub    $0xc,%esp
+    1131:	53                   	push   %ebx
+    1132:	e8 98 fe ff ff       	call   fcf <free>
+    1137:	83 c4 10             	add    $0x10,%esp
+    113a:	eb e9                	jmp    1125 <thread_create+0x44>
+    return -1;
+    113c:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1141:	eb e2                	jmp    1125 <thread_create+0x44>
+
+00001143 <thread_join>:
+
+// Wait for one of this process's threads to exit and free its
+// stack.  Returns its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+    1143:	55                   	push   %ebp
+    1144:	89 e5                	mov    %esp,%ebp
+    1146:	53                   	push   %ebx
+    1147:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    114a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    114d:	50                   	push   %eax
+    114e:	e8 cd f8 ff ff       	call   a20 <join>
+    1153:	89 c3                	mov    %eax,%ebx
+    1155:	83 c4 10             	add    $0x10,%esp
+    1158:	85 c0                	test   %eax,%eax
+    115a:	79 07                	jns    1163 <thread_join+0x20>
+    free((char*)stack - TSTACK);
+  return pid;
+}
+    115c:	89 d8                	mov    %ebx,%eax
+    115e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1161:	c9                   	leave
+    1162:	c3                   	ret
+    free((char*)stack - TSTACK);
+    1163:	83 ec 0c             	sub    $0xc,%esp
+    1166:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1169:	2d 00 10 00 00       	sub    $0x1000,%eax
+    116e:	50                   	push   %eax
+    116f:	e8 5b fe ff ff       	call   fcf <free>
+    1174:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    1177:	eb e3                	jmp    115c <thread_join+0x19>
+
+00001179 <lock_init>:
+
+void
+lock_init(lock_t *lk)
+{
+    1179:	55                   	push   %ebp
+    117a:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    117c:	8b 45 08             	mov    0x8(%ebp),%eax
+    117f:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1185:	5d                   	pop    %ebp
+    1186:	c3                   	ret
+
+00001187 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+    1187:	55                   	push   %ebp
+    1188:	89 e5                	mov    %esp,%ebp
+    118a:	8b 55 08             	mov    0x8(%ebp),%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    118d:	b8 01 00 00 00       	mov    $0x1,%eax
+    1192:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    1195:	85 c0                	test   %eax,%eax
+    1197:	75 f4                	jne    118d <lock_acquire+0x6>
+    ;
+}
+    1199:	5d                   	pop    %ebp
+    119a:	c3                   	ret
+
+0000119b <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+    119b:	55                   	push   %ebp
+    119c:	89 e5                	mov    %esp,%ebp
+    119e:	8b 55 08             	mov    0x8(%ebp),%edx
+    11a1:	b8 00 00 00 00       	mov    $0x0,%eax
+    11a6:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    11a9:	5d                   	pop    %ebp
+    11aa:	c3                   	ret
+
+000011ab <mutex_init>:
+// Are Tricky": state is 0 when free, 1 when held, 2 when held and
+// others may be waiting.  Unlocking an uncontended mutex costs no
+// system call.
+void
+mutex_init(mutex_t *m)
+{
+    11ab:	55                   	push   %ebp
+    11ac:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    11ae:	8b 45 08             	mov    0x8(%ebp),%eax
+    11b1:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    11b7:	5d                   	pop    %ebp
+    11b8:	c3                   	ret
+
+000011b9 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+    11b9:	55                   	push   %ebp
+    11ba:	89 e5                	mov    %esp,%ebp
+    11bc:	53                   	push   %ebx
+    11bd:	83 ec 04             	sub    $0x4,%esp
+    11c0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    11c3:	b8 00 00 00 00       	mov    $0x0,%eax
+    11c8:	b9 01 00 00 00       	mov    $0x1,%ecx
+    11cd:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    11d1:	85 c0                	test   %eax,%eax
+    11d3:	74 29                	je     11fe <mutex_lock+0x45>
+    return;
+  if(c != 2)
+    11d5:	83 f8 02             	cmp    $0x2,%eax
+    11d8:	74 20                	je     11fa <mutex_lock+0x41>
+    11da:	b8 02 00 00 00       	mov    $0x2,%eax
+    11df:	f0 87 03             	lock xchg %eax,(%ebx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    11e2:	eb 16                	jmp    11fa <mutex_lock+0x41>
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    11e4:	83 ec 08             	sub    $0x8,%esp
+    11e7:	6a 02                	push   $0x2
+    11e9:	53                   	push   %ebx
+    11ea:	e8 40 f8 ff ff       	call   a2f <futex_wait>
+  asm volatile("lock; xchgl %0, %1" :
+    11ef:	b8 02 00 00 00       	mov    $0x2,%eax
+    11f4:	f0 87 03             	lock xchg %eax,(%ebx)
+    11f7:	83 c4 10             	add    $0x10,%esp
+  while(c != 0){
+    11fa:	85 c0                	test   %eax,%eax
+    11fc:	75 e6                	jne    11e4 <mutex_lock+0x2b>
+    c = xchg(&m->state, 2);
+  }
+}
+    11fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1201:	c9                   	leave
+    1202:	c3                   	ret
+
+00001203 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+    1203:	55                   	push   %ebp
+    1204:	89 e5                	mov    %esp,%ebp
+    1206:	83 ec 08             	sub    $0x8,%esp
+    1209:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    120c:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    1211:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    1215:	83 fa 01             	cmp    $0x1,%edx
+    1218:	75 02                	jne    121c <mutex_unlock+0x19>
+    m->state = 0;
+    futex_wake(&m->state, 1);
+  }
+}
+    121a:	c9                   	leave
+    121b:	c3                   	ret
+    m->state = 0;
+    121c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+    1222:	83 ec 08             	sub    $0x8,%esp
+    1225:	6a 01                	push   $0x1
+    1227:	50                   	push   %eax
+    1228:	e8 11 f8 ff ff       	call   a3e <futex_wake>
+    122d:	83 c4 10             	add    $0x10,%esp
+}
+    1230:	eb e8                	jmp    121a <mutex_unlock+0x17>
+
+00001232 <cond_init>:
+// Condition variable: waiters sleep on a sequence number that
+// every signal bumps, so a signal between the unlock and the
+// futex_wait() in cond_wait() is not lost.
+void
+cond_init(cond_t *c)
+{
+    1232:	55                   	push   %ebp
+    1233:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    1235:	8b 45 08             	mov    0x8(%ebp),%eax
+    1238:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    123e:	5d                   	pop    %ebp
+    123f:	c3                   	ret
+
+00001240 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+    1240:	55                   	push   %ebp
+    1241:	89 e5                	mov    %esp,%ebp
+    1243:	57                   	push   %edi
+    1244:	56                   	push   %esi
+    1245:	53                   	push   %ebx
+    1246:	83 ec 18             	sub    $0x18,%esp
+    1249:	8b 75 08             	mov    0x8(%ebp),%esi
+    124c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    124f:	8b 3e                	mov    (%esi),%edi
+  mutex_unlock(m);
+    1251:	53                   	push   %ebx
+    1252:	e8 ac ff ff ff       	call   1203 <mutex_unlock>
+  futex_wait(&c->seq, seq);
+    1257:	83 c4 08             	add    $0x8,%esp
+    125a:	57                   	push   %edi
+    125b:	56                   	push   %esi
+    125c:	e8 ce f7 ff ff       	call   a2f <futex_wait>
+  // Others may be waiting for m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+    1261:	83 c4 10             	add    $0x10,%esp
+    1264:	eb 0e                	jmp    1274 <cond_wait+0x34>
+    futex_wait(&m->state, 2);
+    1266:	83 ec 08             	sub    $0x8,%esp
+    1269:	6a 02                	push   $0x2
+    126b:	53                   	push   %ebx
+    126c:	e8 be f7 ff ff       	call   a2f <futex_wait>
+    1271:	83 c4 10             	add    $0x10,%esp
+    1274:	b8 02 00 00 00       	mov    $0x2,%eax
+    1279:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    127c:	85 c0                	test   %eax,%eax
+    127e:	75 e6                	jne    1266 <cond_wait+0x26>
+}
+    1280:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1283:	5b                   	pop    %ebx
+    1284:	5e                   	pop    %esi
+    1285:	5f                   	pop    %edi
+    1286:	5d                   	pop    %ebp
+    1287:	c3                   	ret
+
+00001288 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+    1288:	55                   	push   %ebp
+    1289:	89 e5                	mov    %esp,%ebp
+    128b:	83 ec 10             	sub    $0x10,%esp
+    128e:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    1291:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+    1295:	6a 01                	push   $0x1
+    1297:	50                   	push   %eax
+    1298:	e8 a1 f7 ff ff       	call   a3e <futex_wake>
+}
+    129d:	83 c4 10             	add    $0x10,%esp
+    12a0:	c9                   	leave
+    12a1:	c3                   	ret
+
+000012a2 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+    12a2:	55                   	push   %ebp
+    12a3:	89 e5                	mov    %esp,%ebp
+    12a5:	83 ec 10             	sub    $0x10,%esp
+    12a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    12ab:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, NPROC);
+    12af:	6a 40                	push   $0x40
+    12b1:	50                   	push   %eax
+    12b2:	e8 87 f7 ff ff       	call   a3e <futex_wake>
+}
+    12b7:	83 c4 10             	add    $0x10,%esp
+    12ba:	c9                   	leave
+    12bb:	c3                   	ret
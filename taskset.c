@@ -0,0 +1,38 @@
+// taskset: run a program on a set of CPUs, or show/change the CPU
+// mask of a process.
+//   taskset mask prog [args]  run prog on CPUs in mask
+//   taskset -p pid [mask]     show, or set, pid's mask
+// Masks are decimal, bit i for CPU i.
+#include "types.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+  int pid, mask;
+
+  if(argc >= 3 && strcmp(argv[1], "-p") == 0){
+    pid = atoi(argv[2]);
+    if(argc > 3 && setaffinity(pid, atoi(argv[3])) < 0){
+      printf(2, "taskset: cannot set mask of %d\n", pid);
+      exit();
+    }
+    if((mask = getaffinity(pid)) < 0){
+      printf(2, "taskset: no process %d\n", pid);
+      exit();
+    }
+    printf(1, "pid %d mask %d\n", pid, mask);
+    exit();
+  }
+  if(argc < 3){
+    printf(2, "usage: taskset mask prog [args] | taskset -p pid [mask]\n");
+    exit();
+  }
+  if(setaffinity(getpid(), atoi(argv[1])) < 0){
+    printf(2, "taskset: bad mask %s\n", argv[1]);
+    exit();
+  }
+  exec(argv[2], argv + 2);
+  printf(2, "taskset: exec %s failed\n", argv[2]);
+  exit();
+}
@@ -0,0 +1,134 @@
+// Executable page cache.
+//
+// exec() maps a program lazily (see filefault() in vm.c).  Instead
+// of reading a private copy of each page for every process,
+// filefault() asks textget() for a shared copy, keyed by
+// (dev, inum, file offset, length), and maps it read-only and
+// copy-on-write.  Processes running the same binary share its
+// pages until they write to them.
+//
+// The cache holds one reference on each of its pages.  writei()
+// and itrunc() call textinval(), which drops the cached pages of
+// the changed file; mappings made earlier keep the old contents,
+// just as private copies would.  When the cache is full the least
+// recently used entry is dropped.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+
+struct text {
+  uint dev;
+  uint inum;
+  uint off;      // File offset of the page
+  uint n;        // Bytes of file data in it; the rest is zero
+  char *page;    // 0 if the entry is unused
+  uint lastuse;
+};
+
+struct {
+  struct spinlock lock;
+  struct text text[NTEXT];
+  uint clock;    // Advances on every hit, for LRU
+  uint gen;      // Advances on every textinval()
+} tcache;
+
+void
+textinit(void)
+{
+  initlock(&tcache.lock, "tcache");
+}
+
+// Find the cached page.  Called with tcache.lock held.
+static struct text*
+textlookup(uint dev, uint inum, uint off, uint n)
+{
+  struct text *t;
+
+  for(t = tcache.text; t < &tcache.text[NTEXT]; t++)
+    if(t->page && t->dev == dev && t->inum == inum &&
+       t->off == off && t->n == n)
+      return t;
+  return 0;
+}
+
+// Return a page holding n bytes of ip from offset off, zero
+// filled after that.  The caller gets its own reference to the
+// page and must not write to it while krefcnt() > 1.  ip must
+// not be locked.  Returns 0 if the page can't be read.
+char*
+textget(struct inode *ip, uint off, uint n)
+{
+  struct text *t, *victim;
+  char *mem;
+  uint gen;
+
+  acquire(&tcache.lock);
+  if((t = textlookup(ip->dev, ip->inum, off, n)) != 0){
+    t->lastuse = ++tcache.clock;
+    kincref(t->page);
+    release(&tcache.lock);
+    return t->page;
+  }
+  gen = tcache.gen;
+  release(&tcache.lock);
+
+  if((mem = kalloc()) == 0)
+    return 0;
+  ilockshared(ip);
+  if(readi(ip, mem, off, n) != n){
+    iunlock(ip);
+    kfree(mem);
+    return 0;
+  }
+  iunlock(ip);
+  memset(mem + n, 0, PGSIZE - n);
+
+  // Don't cache what we read if the file changed meanwhile or
+  // someone else got there first.
+  acquire(&tcache.lock);
+  if(gen == tcache.gen && textlookup(ip->dev, ip->inum, off, n) == 0){
+    victim = tcache.text;
+    for(t = tcache.text; t < &tcache.text[NTEXT]; t++){
+      if(t->page == 0){
+        victim = t;
+        break;
+      }
+      if(t->lastuse < victim->lastuse)
+        victim = t;
+    }
+    if(victim->page)
+      kfree(victim->page);
+    victim->dev = ip->dev;
+    victim->inum = ip->inum;
+    victim->off = off;
+    victim->n = n;
+    victim->page = mem;
+    victim->lastuse = ++tcache.clock;
+    kincref(mem);
+  }
+  release(&tcache.lock);
+  return mem;
+}
+
+// The contents of ip are about to change: forget its pages.
+void
+textinval(struct inode *ip)
+{
+  struct text *t;
+
+  acquire(&tcache.lock);
+  tcache.gen++;
+  for(t = tcache.text; t < &tcache.text[NTEXT]; t++){
+    if(t->page && t->dev == ip->dev && t->inum == ip->inum){
+      kfree(t->page);
+      t->page = 0;
+    }
+  }
+  release(&tcache.lock);
+}
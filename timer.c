@@ -0,0 +1,210 @@
+// Timer wheel.  A process sleeping until a deadline waits in one
+// slot of a hierarchical wheel, on a channel of its own, instead of
+// on &ticks, so it is woken once, when its deadline has passed,
+// rather than on every tick to check again.
+//
+// The wheel turns in units of 2^WSHIFT ns (about 1ms).  Level 0
+// has a slot for each of the next LSIZE units, level k a slot for
+// each LSIZE^k units after that; whenever level 0 wraps around,
+// the current slot of the level above is cascaded down into the
+// finer levels, as in the Linux timer wheel.  CPU 0 runs its lapic
+// timer in one-shot mode, set for the next non-empty level-0 slot
+// or the next timer tick, whichever comes first, so that sleeps
+// have the resolution of a unit rather than of a tick.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "traps.h"
+#include "spinlock.h"
+#include "proc.h"
+
+#define WSHIFT  20             // ns per unit, as a shift
+#define LBITS   6
+#define LSIZE   (1<<LBITS)     // Slots per level
+#define NLEVEL  4              // Levels, covering 2^24 units (~4.9h)
+#define WSPAN   (1<<(LBITS*NLEVEL))
+
+static struct {
+  struct spinlock lock;
+  uint now;                    // Next unit to expire
+  uint next;                   // Unit CPU 0's timer is set for
+  uint64 tickns;               // When the next tick is due
+  struct proc *slot[NLEVEL][LSIZE];
+} wheel;
+
+// Queue p in the slot for p->tmwhen.  Deadlines beyond the wheel
+// go in its last slot, and are queued again when they get there.
+static void
+wheeladd(struct proc *p)
+{
+  struct proc **h;
+  uint when, d;
+  int k;
+
+  when = p->tmwhen;
+  d = when - wheel.now;
+  if((int)d < 0){
+    when = wheel.now;
+    d = 0;
+  } else if(d >= WSPAN){
+    d = WSPAN - 1;
+    when = wheel.now + d;
+  }
+  for(k = 0; d >= 1 << (LBITS*(k+1)); k++)
+    ;
+  h = &wheel.slot[k][(when >> (LBITS*k)) & (LSIZE-1)];
+  p->tmnext = *h;
+  if(*h)
+    (*h)->tmpprev = &p->tmnext;
+  *h = p;
+  p->tmpprev = h;
+}
+
+static void
+wheeldel(struct proc *p)
+{
+  if(p->tmpprev == 0)
+    return;
+  *p->tmpprev = p->tmnext;
+  if(p->tmnext)
+    p->tmnext->tmpprev = p->tmpprev;
+  p->tmpprev = 0;
+}
+
+// Move the current slot of level k down to the levels below.
+// Returns its index: if 0, level k has wrapped around too.
+static int
+cascade(int k)
+{
+  struct proc *p, *next;
+  int i;
+
+  i = (wheel.now >> (LBITS*k)) & (LSIZE-1);
+  p = wheel.slot[k][i];
+  wheel.slot[k][i] = 0;
+  for(; p; p = next){
+    next = p->tmnext;
+    p->tmpprev = 0;
+    wheeladd(p);
+  }
+  return i;
+}
+
+// Expire every unit up to and including to.
+static void
+advance(uint to)
+{
+  struct proc *p;
+  int i, k;
+
+  while((int)(to - wheel.now) >= 0){
+    i = wheel.now & (LSIZE-1);
+    if(i == 0)
+      for(k = 1; k < NLEVEL && cascade(k) == 0; k++)
+        ;
+    while((p = wheel.slot[0][i]) != 0){
+      wheeldel(p);
+      if((int)(p->tmwhen - wheel.now) > 0)
+        wheeladd(p);
+      else
+        wakeup(&p->tmwhen);
+    }
+    wheel.now++;
+  }
+}
+
+// The next unit with something to do: a level-0 slot with
+// sleepers in it, or a cascade.
+static uint
+nextunit(void)
+{
+  uint u;
+
+  for(u = wheel.now; ; u++)
+    if((u & (LSIZE-1)) == 0 || wheel.slot[0][u & (LSIZE-1)])
+      return u;
+}
+
+// Arm CPU 0's timer for whatever comes first, the next unit with
+// work or the next tick.
+static void
+rearm(uint64 now)
+{
+  uint64 ns, tns;
+  uint next;
+
+  next = nextunit();
+  ns = ((uint64)(next - (uint)(now >> WSHIFT)) << WSHIFT) -
+       (now & ((1 << WSHIFT) - 1));
+  tns = wheel.tickns - now;
+  if(tns < ns){
+    ns = tns;
+    next = wheel.tickns >> WSHIFT;
+  }
+  wheel.next = next;
+  lapiconeshot(ns);
+}
+
+// Called by CPU 0 once clockinit() has calibrated the lapic timer.
+void
+timerinit(void)
+{
+  uint64 now;
+
+  initlock(&wheel.lock, "timer");
+  now = nanotime();
+  wheel.now = now >> WSHIFT;
+  wheel.tickns = now + TICKNS;
+  rearm(now);
+}
+
+// CPU 0's timer interrupt: wake the sleepers whose time has come
+// and arm the timer again.  Returns the number of ticks that have
+// passed since the last call, usually 0 or 1.
+int
+timerintr(void)
+{
+  uint64 now;
+  int n;
+
+  acquire(&wheel.lock);
+  now = nanotime();
+  for(n = 0; now >= wheel.tickns; n++)
+    wheel.tickns += TICKNS;
+  advance(now >> WSHIFT);
+  rearm(now);
+  release(&wheel.lock);
+  return n;
+}
+
+// Sleep until nanotime() reaches ns.  Returns -1 if killed.
+int
+timersleep(uint64 ns)
+{
+  struct proc *p = myproc();
+  uint when;
+
+  when = (ns + (1 << WSHIFT) - 1) >> WSHIFT;
+  acquire(&wheel.lock);
+  while(nanotime() < ns){
+    if(p->killed){
+      release(&wheel.lock);
+      return -1;
+    }
+    p->tmwhen = when;
+    wheeladd(p);
+    // Sooner than CPU 0 would look: have it rearm now.
+    if((int)(when - wheel.next) < 0){
+      wheel.next = when;
+      lapicipi(cpus[0].apicid, T_IRQ0 + IRQ_TIMER);
+    }
+    sleep(&p->tmwhen, &wheel.lock);
+    wheeldel(p);
+  }
+  release(&wheel.lock);
+  return 0;
+}
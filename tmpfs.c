@@ -0,0 +1,193 @@
+// tmpfs: a file system in memory, device TMPDEV, which init
+// mounts on /tmp.
+//
+// Its inodes are tmpnodes, and its data is in pages from kalloc(),
+// each file's found through an index page of its own, so nothing on
+// it goes through the buffer cache, the log or the disk.  fs.c
+// sends tmpfs inodes here where it would read or write the disk:
+// ialloc(), ilock(), iupdate(), itrunc(), readi() and writei().
+// Directories are plain ones, in their data pages like any file.
+//
+// A tmpnode is protected by the lock of its inode in the icache,
+// which is written through to it like to a dinode; tmpfs.lock only
+// guards taking free ones.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "stat.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+
+#define min(a, b) ((a) < (b) ? (a) : (b))
+#define NTMPIDX (PGSIZE / sizeof(char*))   // Data pages per file
+#define TMPMAXFILE (NTMPIDX*PGSIZE)
+
+struct tmpnode {
+  short type;          // 0 if free
+  short major;
+  short minor;
+  short nlink;
+  uint size;
+  char **idx;          // NTMPIDX data pages, or 0
+};
+
+static struct {
+  struct spinlock lock;
+  struct tmpnode node[NTMPINODE];
+} tmpfs;
+
+// Data page pn of t, allocated and zeroed if need be.
+// Returns 0 if out of memory.
+static char*
+tmppage(struct tmpnode *t, uint pn, int alloc)
+{
+  if(t->idx == 0 && (!alloc || (t->idx = (char**)kzalloc()) == 0))
+    return 0;
+  if(t->idx[pn] == 0 && alloc)
+    t->idx[pn] = kzalloc();
+  return t->idx[pn];
+}
+
+static int
+tmpwrite(struct tmpnode *t, char *src, uint off, uint n)
+{
+  uint tot, m;
+  char *pg;
+
+  for(tot = 0; tot < n; tot += m, off += m, src += m){
+    m = min(n - tot, PGSIZE - off%PGSIZE);
+    if((pg = tmppage(t, off/PGSIZE, 1)) == 0)
+      break;
+    memmove(pg + off%PGSIZE, src, m);
+  }
+  if(off > t->size)
+    t->size = off;
+  return tot;
+}
+
+// The root directory, with "." and "..", which namex() takes up to
+// the mount point.
+void
+tmpfsinit(void)
+{
+  struct tmpnode *t;
+  struct dirent de[2];
+
+  initlock(&tmpfs.lock, "tmpfs");
+  t = &tmpfs.node[ROOTINO];
+  t->type = T_DIR;
+  t->nlink = 1;
+  memset(de, 0, sizeof(de));
+  de[0].inum = de[1].inum = ROOTINO;
+  safestrcpy(de[0].name, ".", DIRSIZ);
+  safestrcpy(de[1].name, "..", DIRSIZ);
+  if(tmpwrite(t, (char*)de, 0, sizeof(de)) != sizeof(de))
+    panic("tmpfsinit");
+}
+
+// Take a free tmpnode for an inode of type type.
+// Returns its number, or 0 if there are none.
+uint
+tmpialloc(short type)
+{
+  struct tmpnode *t;
+  uint inum;
+
+  acquire(&tmpfs.lock);
+  for(inum = 1; inum < NTMPINODE; inum++){
+    t = &tmpfs.node[inum];
+    if(t->type == 0){
+      memset(t, 0, sizeof(*t));
+      t->type = type;
+      release(&tmpfs.lock);
+      return inum;
+    }
+  }
+  release(&tmpfs.lock);
+  return 0;
+}
+
+// Fill in ip from its tmpnode, the way ilock() reads a dinode.
+void
+tmpiread(struct inode *ip)
+{
+  struct tmpnode *t = &tmpfs.node[ip->inum];
+
+  ip->type = t->type;
+  ip->flags = 0;
+  ip->major = t->major;
+  ip->minor = t->minor;
+  ip->nlink = t->nlink;
+  ip->size = t->size;
+  memset(ip->addrs, 0, sizeof(ip->addrs));
+}
+
+// Copy ip back to its tmpnode, which is free again if ip's type
+// is 0.
+void
+tmpiupdate(struct inode *ip)
+{
+  struct tmpnode *t = &tmpfs.node[ip->inum];
+
+  acquire(&tmpfs.lock);
+  t->type = ip->type;
+  t->major = ip->major;
+  t->minor = ip->minor;
+  t->nlink = ip->nlink;
+  t->size = ip->size;
+  release(&tmpfs.lock);
+}
+
+// Free ip's pages.
+void
+tmpitrunc(struct inode *ip)
+{
+  struct tmpnode *t = &tmpfs.node[ip->inum];
+  uint i;
+
+  if(t->idx){
+    for(i = 0; i < NTMPIDX; i++)
+      if(t->idx[i])
+        kfree(t->idx[i]);
+    kfree((char*)t->idx);
+    t->idx = 0;
+  }
+  ip->size = 0;
+  tmpiupdate(ip);
+}
+
+// readi() for ip, which has checked off and clamped n.
+int
+tmpreadi(struct inode *ip, char *dst, uint off, uint n)
+{
+  struct tmpnode *t = &tmpfs.node[ip->inum];
+  uint tot, m;
+  char *pg;
+
+  for(tot = 0; tot < n; tot += m, off += m, dst += m){
+    m = min(n - tot, PGSIZE - off%PGSIZE);
+    if((pg = tmppage(t, off/PGSIZE, 0)) != 0)
+      memmove(dst, pg + off%PGSIZE, m);
+    else
+      memset(dst, 0, m);
+  }
+  return n;
+}
+
+// writei() for ip, which has checked off.
+int
+tmpwritei(struct inode *ip, char *src, uint off, uint n)
+{
+  struct tmpnode *t = &tmpfs.node[ip->inum];
+  int tot;
+
+  if(off + n > TMPMAXFILE)
+    return -1;
+  tot = tmpwrite(t, src, off, n);
+  ip->size = t->size;
+  return tot > 0 || n == 0 ? tot : -1;
+}
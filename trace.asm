@@ -0,0 +1,3229 @@
+
+_trace:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <cats>:
+static int
+cats(char *s)
+{
+  int m;
+
+  for(m = 0; *s; s++){
+       0:	b9 00 00 00 00       	mov    $0x0,%ecx
+       5:	eb 06                	jmp    d <cats+0xd>
+    switch(*s){
+    case 's': m |= TC_SCHED; break;
+       7:	83 c9 01             	or     $0x1,%ecx
+  for(m = 0; *s; s++){
+       a:	83 c0 01             	add    $0x1,%eax
+       d:	0f b6 10             	movzbl (%eax),%edx
+      10:	84 d2                	test   %dl,%dl
+      12:	74 30                	je     44 <cats+0x44>
+    switch(*s){
+      14:	83 ea 63             	sub    $0x63,%edx
+      17:	80 fa 14             	cmp    $0x14,%dl
+      1a:	77 23                	ja     3f <cats+0x3f>
+      1c:	0f b6 d2             	movzbl %dl,%edx
+      1f:	ff 24 95 54 16 00 00 	jmp    *0x1654(,%edx,4)
+    case 'w': m |= TC_SLEEP; break;
+      26:	83 c9 02             	or     $0x2,%ecx
+      29:	eb df                	jmp    a <cats+0xa>
+    case 'f': m |= TC_FAULT; break;
+      2b:	83 c9 04             	or     $0x4,%ecx
+      2e:	eb da                	jmp    a <cats+0xa>
+    case 'c': m |= TC_SYSCALL; break;
+      30:	83 c9 08             	or     $0x8,%ecx
+      33:	eb d5                	jmp    a <cats+0xa>
+    case 'd': m |= TC_DISK; break;
+      35:	83 c9 10             	or     $0x10,%ecx
+      38:	eb d0                	jmp    a <cats+0xa>
+    case 'l': m |= TC_LOG; break;
+      3a:	83 c9 20             	or     $0x20,%ecx
+      3d:	eb cb                	jmp    a <cats+0xa>
+    switch(*s){
+      3f:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+    default: return -1;
+    }
+  }
+  return m;
+}
+      44:	89 c8                	mov    %ecx,%eax
+      46:	c3                   	ret
+
+00000047 <print>:
+  return 0;
+}
+
+static void
+print(struct tracev *e, uint64 t0)
+{
+      47:	55                   	push   %ebp
+      48:	89 e5                	mov    %esp,%ebp
+      4a:	57                   	push   %edi
+      4b:	56                   	push   %esi
+      4c:	53                   	push   %ebx
+      4d:	83 ec 0c             	sub    $0xc,%esp
+      50:	89 c3                	mov    %eax,%ebx
+      52:	89 d6                	mov    %edx,%esi
+  printf(1, "%d\t%d\t", (uint)((e->tsc - t0) >> 10), e->cpu);
+      54:	8b 00                	mov    (%eax),%eax
+      56:	8b 53 04             	mov    0x4(%ebx),%edx
+      59:	29 f0                	sub    %esi,%eax
+      5b:	19 ca                	sbb    %ecx,%edx
+      5d:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+      61:	c1 ea 0a             	shr    $0xa,%edx
+      64:	89 c6                	mov    %eax,%esi
+      66:	0f b7 53 0a          	movzwl 0xa(%ebx),%edx
+      6a:	52                   	push   %edx
+      6b:	56                   	push   %esi
+      6c:	68 d4 16 00 00       	push   $0x16d4
+      71:	6a 01                	push   $0x1
+      73:	e8 be 0f 00 00       	call   1036 <printf>
+  switch(e->type){
+      78:	0f b7 43 08          	movzwl 0x8(%ebx),%eax
+      7c:	0f b7 d0             	movzwl %ax,%edx
+      7f:	83 c4 10             	add    $0x10,%esp
+      82:	66 83 f8 0a          	cmp    $0xa,%ax
+      86:	0f 87 ff 00 00 00    	ja     18b <print+0x144>
+      8c:	ff 24 95 a8 16 00 00 	jmp    *0x16a8(,%edx,4)
+  case TE_SWITCH:
+    printf(1, "switch\tpid %d\n", e->a);
+      93:	83 ec 04             	sub    $0x4,%esp
+      96:	ff 73 0c             	push   0xc(%ebx)
+      99:	68 db 16 00 00       	push   $0x16db
+      9e:	6a 01                	push   $0x1
+      a0:	e8 91 0f 00 00       	call   1036 <printf>
+    break;
+      a5:	83 c4 10             	add    $0x10,%esp
+    printf(1, "commit\t%d blocks\n", e->a);
+    break;
+  default:
+    printf(1, "event %d\t%d %d\n", e->type, e->a, e->b);
+  }
+}
+      a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      ab:	5b                   	pop    %ebx
+      ac:	5e                   	pop    %esi
+      ad:	5f                   	pop    %edi
+      ae:	5d                   	pop    %ebp
+      af:	c3                   	ret
+    printf(1, "sleep\tpid %d chan 0x%x\n", e->a, e->b);
+      b0:	ff 73 10             	push   0x10(%ebx)
+      b3:	ff 73 0c             	push   0xc(%ebx)
+      b6:	68 ea 16 00 00       	push   $0x16ea
+      bb:	6a 01                	push   $0x1
+      bd:	e8 74 0f 00 00       	call   1036 <printf>
+    break;
+      c2:	83 c4 10             	add    $0x10,%esp
+      c5:	eb e1                	jmp    a8 <print+0x61>
+    printf(1, "wakeup\tpid %d chan 0x%x\n", e->a, e->b);
+      c7:	ff 73 10             	push   0x10(%ebx)
+      ca:	ff 73 0c             	push   0xc(%ebx)
+      cd:	68 02 17 00 00       	push   $0x1702
+      d2:	6a 01                	push   $0x1
+      d4:	e8 5d 0f 00 00       	call   1036 <printf>
+    break;
+      d9:	83 c4 10             	add    $0x10,%esp
+      dc:	eb ca                	jmp    a8 <print+0x61>
+    printf(1, "fault\tpid %d va 0x%x\n", e->a, e->b);
+      de:	ff 73 10             	push   0x10(%ebx)
+      e1:	ff 73 0c             	push   0xc(%ebx)
+      e4:	68 1b 17 00 00       	push   $0x171b
+      e9:	6a 01                	push   $0x1
+      eb:	e8 46 0f 00 00       	call   1036 <printf>
+    break;
+      f0:	83 c4 10             	add    $0x10,%esp
+      f3:	eb b3                	jmp    a8 <print+0x61>
+    printf(1, "syscall\tpid %d call %d\n", e->a, e->b);
+      f5:	ff 73 10             	push   0x10(%ebx)
+      f8:	ff 73 0c             	push   0xc(%ebx)
+      fb:	68 31 17 00 00       	push   $0x1731
+     100:	6a 01                	push   $0x1
+     102:	e8 2f 0f 00 00       	call   1036 <printf>
+    break;
+     107:	83 c4 10             	add    $0x10,%esp
+     10a:	eb 9c                	jmp    a8 <print+0x61>
+    printf(1, "sysret\tpid %d = %d\n", e->a, e->b);
+     10c:	ff 73 10             	push   0x10(%ebx)
+     10f:	ff 73 0c             	push   0xc(%ebx)
+     112:	68 49 17 00 00       	push   $0x1749
+     117:	6a 01                	push   $0x1
+     119:	e8 18 0f 00 00       	call   1036 <printf>
+    break;
+     11e:	83 c4 10             	add    $0x10,%esp
+     121:	eb 85                	jmp    a8 <print+0x61>
+    printf(1, "read\tblock %d +%d\n", e->a, e->b);
+     123:	ff 73 10             	push   0x10(%ebx)
+     126:	ff 73 0c             	push   0xc(%ebx)
+     129:	68 5d 17 00 00       	push   $0x175d
+     12e:	6a 01                	push   $0x1
+     130:	e8 01 0f 00 00       	call   1036 <printf>
+    break;
+     135:	83 c4 10             	add    $0x10,%esp
+     138:	e9 6b ff ff ff       	jmp    a8 <print+0x61>
+    printf(1, "write\tblock %d +%d\n", e->a, e->b);
+     13d:	ff 73 10             	push   0x10(%ebx)
+     140:	ff 73 0c             	push   0xc(%ebx)
+     143:	68 70 17 00 00       	push   $0x1770
+     148:	6a 01                	push   $0x1
+     14a:	e8 e7 0e 00 00       	call   1036 <printf>
+    break;
+     14f:	83 c4 10             	add    $0x10,%esp
+     152:	e9 51 ff ff ff       	jmp    a8 <print+0x61>
+    printf(1, "done\tblock %d +%d\n", e->a, e->b);
+     157:	ff 73 10             	push   0x10(%ebx)
+     15a:	ff 73 0c             	push   0xc(%ebx)
+     15d:	68 84 17 00 00       	push   $0x1784
+     162:	6a 01                	push   $0x1
+     164:	e8 cd 0e 00 00       	call   1036 <printf>
+    break;
+     169:	83 c4 10             	add    $0x10,%esp
+     16c:	e9 37 ff ff ff       	jmp    a8 <print+0x61>
+    printf(1, "commit\t%d blocks\n", e->a);
+     171:	83 ec 04             	sub    $0x4,%esp
+     174:	ff 73 0c             	push   0xc(%ebx)
+     177:	68 97 17 00 00       	push   $0x1797
+     17c:	6a 01                	push   $0x1
+     17e:	e8 b3 0e 00 00       	call   1036 <printf>
+    break;
+     183:	83 c4 10             	add    $0x10,%esp
+     186:	e9 1d ff ff ff       	jmp    a8 <print+0x61>
+    printf(1, "event %d\t%d %d\n", e->type, e->a, e->b);
+     18b:	83 ec 0c             	sub    $0xc,%esp
+     18e:	ff 73 10             	push   0x10(%ebx)
+     191:	ff 73 0c             	push   0xc(%ebx)
+     194:	52                   	push   %edx
+     195:	68 a9 17 00 00       	push   $0x17a9
+     19a:	6a 01                	push   $0x1
+     19c:	e8 95 0e 00 00       	call   1036 <printf>
+     1a1:	83 c4 20             	add    $0x20,%esp
+}
+     1a4:	e9 ff fe ff ff       	jmp    a8 <print+0x61>
+
+000001a9 <drain>:
+{
+     1a9:	55                   	push   %ebp
+     1aa:	89 e5                	mov    %esp,%ebp
+     1ac:	56                   	push   %esi
+     1ad:	53                   	push   %ebx
+     1ae:	89 c3                	mov    %eax,%ebx
+     1b0:	89 d6                	mov    %edx,%esi
+  if(keep && ev[cpu] == 0 &&
+     1b2:	85 d2                	test   %edx,%edx
+     1b4:	74 0a                	je     1c0 <drain+0x17>
+     1b6:	83 3c 85 e0 25 00 00 	cmpl   $0x0,0x25e0(,%eax,4)
+     1bd:	00 
+     1be:	74 66                	je     226 <drain+0x7d>
+  nev[cpu] = 0;
+     1c0:	c7 04 9d e0 24 00 00 	movl   $0x0,0x24e0(,%ebx,4)
+     1c7:	00 00 00 00 
+    if(keep)
+     1cb:	85 f6                	test   %esi,%esi
+     1cd:	0f 84 86 00 00 00    	je     259 <drain+0xb0>
+      n = trace(TR_READ, cpu, ev[cpu] + nev[cpu], NTRACE - nev[cpu]);
+     1d3:	8b 0c 9d e0 24 00 00 	mov    0x24e0(,%ebx,4),%ecx
+     1da:	8d 04 89             	lea    (%ecx,%ecx,4),%eax
+     1dd:	c1 e0 02             	shl    $0x2,%eax
+     1e0:	ba 00 04 00 00       	mov    $0x400,%edx
+     1e5:	29 ca                	sub    %ecx,%edx
+     1e7:	52                   	push   %edx
+     1e8:	03 04 9d e0 25 00 00 	add    0x25e0(,%ebx,4),%eax
+     1ef:	50                   	push   %eax
+     1f0:	53                   	push   %ebx
+     1f1:	6a 01                	push   $0x1
+     1f3:	e8 08 0d 00 00       	call   f00 <trace>
+     1f8:	83 c4 10             	add    $0x10,%esp
+    if(n < 0)
+     1fb:	85 c0                	test   %eax,%eax
+     1fd:	78 6e                	js     26d <drain+0xc4>
+    if(keep)
+     1ff:	85 f6                	test   %esi,%esi
+     201:	74 07                	je     20a <drain+0x61>
+      nev[cpu] += n;
+     203:	01 04 9d e0 24 00 00 	add    %eax,0x24e0(,%ebx,4)
+  } while(n > 0 && (!keep || nev[cpu] < NTRACE));
+     20a:	85 c0                	test   %eax,%eax
+     20c:	7e 6b                	jle    279 <drain+0xd0>
+     20e:	85 f6                	test   %esi,%esi
+     210:	74 b9                	je     1cb <drain+0x22>
+     212:	81 3c 9d e0 24 00 00 	cmpl   $0x3ff,0x24e0(,%ebx,4)
+     219:	ff 03 00 00 
+     21d:	7e ac                	jle    1cb <drain+0x22>
+  return 0;
+     21f:	b8 00 00 00 00       	mov    $0x0,%eax
+     224:	eb 4c                	jmp    272 <drain+0xc9>
+     (ev[cpu] = malloc(NTRACE*sizeof(struct tracev))) == 0){
+     226:	83 ec 0c             	sub    $0xc,%esp
+     229:	68 00 50 00 00       	push   $0x5000
+     22e:	e8 89 11 00 00       	call   13bc <malloc>
+     233:	89 04 9d e0 25 00 00 	mov    %eax,0x25e0(,%ebx,4)
+  if(keep && ev[cpu] == 0 &&
+     23a:	83 c4 10             	add    $0x10,%esp
+     23d:	85 c0                	test   %eax,%eax
+     23f:	0f 85 7b ff ff ff    	jne    1c0 <drain+0x17>
+    printf(2, "trace: out of memory\n");
+     245:	83 ec 08             	sub    $0x8,%esp
+     248:	68 b9 17 00 00       	push   $0x17b9
+     24d:	6a 02                	push   $0x2
+     24f:	e8 e2 0d 00 00       	call   1036 <printf>
+    exit();
+     254:	e8 a4 08 00 00       	call   afd <exit>
+      n = trace(TR_READ, cpu, junk, sizeof(junk)/sizeof(junk[0]));
+     259:	6a 40                	push   $0x40
+     25b:	68 e0 1f 00 00       	push   $0x1fe0
+     260:	53                   	push   %ebx
+     261:	6a 01                	push   $0x1
+     263:	e8 98 0c 00 00       	call   f00 <trace>
+     268:	83 c4 10             	add    $0x10,%esp
+     26b:	eb 8e                	jmp    1fb <drain+0x52>
+      return -1;
+     26d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     272:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     275:	5b                   	pop    %ebx
+     276:	5e                   	pop    %esi
+     277:	5d                   	pop    %ebp
+     278:	c3                   	ret
+  return 0;
+     279:	b8 00 00 00 00       	mov    $0x0,%eax
+     27e:	eb f2                	jmp    272 <drain+0xc9>
+
+00000280 <main>:
+
+int
+main(int argc, char *argv[])
+{
+     280:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+     284:	83 e4 f0             	and    $0xfffffff0,%esp
+     287:	ff 71 fc             	push   -0x4(%ecx)
+     28a:	55                   	push   %ebp
+     28b:	89 e5                	mov    %esp,%ebp
+     28d:	57                   	push   %edi
+     28e:	56                   	push   %esi
+     28f:	53                   	push   %ebx
+     290:	51                   	push   %ecx
+     291:	81 ec 18 01 00 00    	sub    $0x118,%esp
+     297:	8b 39                	mov    (%ecx),%edi
+     299:	8b 59 04             	mov    0x4(%ecx),%ebx
+  int i, pid, mask, ncpu, pos[MAXCPU], best;
+  uint64 t0;
+
+  mask = TC_ALL;
+  if(argc > 2 && strcmp(argv[1], "-e") == 0){
+     29c:	83 ff 02             	cmp    $0x2,%edi
+     29f:	7f 11                	jg     2b2 <main+0x32>
+  mask = TC_ALL;
+     2a1:	be 3f 00 00 00       	mov    $0x3f,%esi
+      exit();
+    }
+    argv += 2;
+    argc -= 2;
+  }
+  if(argc < 2){
+     2a6:	83 ff 01             	cmp    $0x1,%edi
+     2a9:	7e 5b                	jle    306 <main+0x86>
+    printf(2, "usage: trace [-e swfcdl] cmd [arg ...]\n");
+    exit();
+  }
+
+  for(ncpu = 0; ncpu < MAXCPU && drain(ncpu, 0) == 0; ncpu++)
+     2ab:	bf 00 00 00 00       	mov    $0x0,%edi
+     2b0:	eb 6b                	jmp    31d <main+0x9d>
+  if(argc > 2 && strcmp(argv[1], "-e") == 0){
+     2b2:	83 ec 08             	sub    $0x8,%esp
+     2b5:	68 cf 17 00 00       	push   $0x17cf
+     2ba:	ff 73 04             	push   0x4(%ebx)
+     2bd:	e8 29 02 00 00       	call   4eb <strcmp>
+     2c2:	83 c4 10             	add    $0x10,%esp
+     2c5:	85 c0                	test   %eax,%eax
+     2c7:	74 07                	je     2d0 <main+0x50>
+  mask = TC_ALL;
+     2c9:	be 3f 00 00 00       	mov    $0x3f,%esi
+     2ce:	eb d6                	jmp    2a6 <main+0x26>
+    if((mask = cats(argv[2])) <= 0){
+     2d0:	8b 43 08             	mov    0x8(%ebx),%eax
+     2d3:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+     2d9:	e8 22 fd ff ff       	call   0 <cats>
+     2de:	89 c6                	mov    %eax,%esi
+     2e0:	85 c0                	test   %eax,%eax
+     2e2:	7e 08                	jle    2ec <main+0x6c>
+    argv += 2;
+     2e4:	83 c3 08             	add    $0x8,%ebx
+    argc -= 2;
+     2e7:	83 ef 02             	sub    $0x2,%edi
+     2ea:	eb ba                	jmp    2a6 <main+0x26>
+      printf(2, "trace: bad categories %s\n", argv[2]);
+     2ec:	83 ec 04             	sub    $0x4,%esp
+     2ef:	ff b5 e4 fe ff ff    	push   -0x11c(%ebp)
+     2f5:	68 d2 17 00 00       	push   $0x17d2
+     2fa:	6a 02                	push   $0x2
+     2fc:	e8 35 0d 00 00       	call   1036 <printf>
+      exit();
+     301:	e8 f7 07 00 00       	call   afd <exit>
+    printf(2, "usage: trace [-e swfcdl] cmd [arg ...]\n");
+     306:	83 ec 08             	sub    $0x8,%esp
+     309:	68 18 18 00 00       	push   $0x1818
+     30e:	6a 02                	push   $0x2
+     310:	e8 21 0d 00 00       	call   1036 <printf>
+    exit();
+     315:	e8 e3 07 00 00       	call   afd <exit>
+  for(ncpu = 0; ncpu < MAXCPU && drain(ncpu, 0) == 0; ncpu++)
+     31a:	83 c7 01             	add    $0x1,%edi
+     31d:	83 ff 3f             	cmp    $0x3f,%edi
+     320:	7f 10                	jg     332 <main+0xb2>
+     322:	ba 00 00 00 00       	mov    $0x0,%edx
+     327:	89 f8                	mov    %edi,%eax
+     329:	e8 7b fe ff ff       	call   1a9 <drain>
+     32e:	85 c0                	test   %eax,%eax
+     330:	74 e8                	je     31a <main+0x9a>
+    ;
+  trace(TR_ENABLE, mask, 0, 0);
+     332:	6a 00                	push   $0x0
+     334:	6a 00                	push   $0x0
+     336:	56                   	push   %esi
+     337:	6a 00                	push   $0x0
+     339:	e8 c2 0b 00 00       	call   f00 <trace>
+  if((pid = fork()) < 0){
+     33e:	e8 a6 07 00 00       	call   ae9 <fork>
+     343:	83 c4 10             	add    $0x10,%esp
+     346:	85 c0                	test   %eax,%eax
+     348:	78 31                	js     37b <main+0xfb>
+    printf(2, "trace: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+     34a:	74 43                	je     38f <main+0x10f>
+    exec(argv[1], argv + 1);
+    printf(2, "trace: exec %s failed\n", argv[1]);
+    exit();
+  }
+  while(wait() >= 0)
+     34c:	e8 b2 08 00 00       	call   c03 <wait>
+     351:	85 c0                	test   %eax,%eax
+     353:	79 f7                	jns    34c <main+0xcc>
+    ;
+  trace(TR_ENABLE, 0, 0, 0);
+     355:	6a 00                	push   $0x0
+     357:	6a 00                	push   $0x0
+     359:	6a 00                	push   $0x0
+     35b:	6a 00                	push   $0x0
+     35d:	e8 9e 0b 00 00       	call   f00 <trace>
+
+  t0 = 0;
+  for(i = 0; i < ncpu; i++){
+     362:	83 c4 10             	add    $0x10,%esp
+  t0 = 0;
+     365:	be 00 00 00 00       	mov    $0x0,%esi
+     36a:	c7 85 dc fe ff ff 00 	movl   $0x0,-0x124(%ebp)
+     371:	00 00 00 
+  for(i = 0; i < ncpu; i++){
+     374:	bb 00 00 00 00       	mov    $0x0,%ebx
+     379:	eb 4f                	jmp    3ca <main+0x14a>
+    printf(2, "trace: fork failed\n");
+     37b:	83 ec 08             	sub    $0x8,%esp
+     37e:	68 ec 17 00 00       	push   $0x17ec
+     383:	6a 02                	push   $0x2
+     385:	e8 ac 0c 00 00       	call   1036 <printf>
+    exit();
+     38a:	e8 6e 07 00 00       	call   afd <exit>
+    exec(argv[1], argv + 1);
+     38f:	83 ec 08             	sub    $0x8,%esp
+     392:	8d 43 04             	lea    0x4(%ebx),%eax
+     395:	50                   	push   %eax
+     396:	ff 73 04             	push   0x4(%ebx)
+     399:	e8 71 07 00 00       	call   b0f <exec>
+    printf(2, "trace: exec %s failed\n", argv[1]);
+     39e:	83 c4 0c             	add    $0xc,%esp
+     3a1:	ff 73 04             	push   0x4(%ebx)
+     3a4:	68 00 18 00 00       	push   $0x1800
+     3a9:	6a 02                	push   $0x2
+     3ab:	e8 86 0c 00 00       	call   1036 <printf>
+    exit();
+     3b0:	e8 48 07 00 00       	call   afd <exit>
+    drain(i, 1);
+    pos[i] = 0;
+    if(nev[i] > 0 && (t0 == 0 || ev[i][0].tsc < t0))
+      t0 = ev[i][0].tsc;
+     3b5:	8b 04 9d e0 25 00 00 	mov    0x25e0(,%ebx,4),%eax
+     3bc:	8b 30                	mov    (%eax),%esi
+     3be:	8b 40 04             	mov    0x4(%eax),%eax
+     3c1:	89 85 dc fe ff ff    	mov    %eax,-0x124(%ebp)
+  for(i = 0; i < ncpu; i++){
+     3c7:	83 c3 01             	add    $0x1,%ebx
+     3ca:	39 fb                	cmp    %edi,%ebx
+     3cc:	7d 3f                	jge    40d <main+0x18d>
+    drain(i, 1);
+     3ce:	ba 01 00 00 00       	mov    $0x1,%edx
+     3d3:	89 d8                	mov    %ebx,%eax
+     3d5:	e8 cf fd ff ff       	call   1a9 <drain>
+    pos[i] = 0;
+     3da:	c7 84 9d e8 fe ff ff 	movl   $0x0,-0x118(%ebp,%ebx,4)
+     3e1:	00 00 00 00 
+    if(nev[i] > 0 && (t0 == 0 || ev[i][0].tsc < t0))
+     3e5:	83 3c 9d e0 24 00 00 	cmpl   $0x0,0x24e0(,%ebx,4)
+     3ec:	00 
+     3ed:	7e d8                	jle    3c7 <main+0x147>
+     3ef:	8b 8d dc fe ff ff    	mov    -0x124(%ebp),%ecx
+     3f5:	89 c8                	mov    %ecx,%eax
+     3f7:	09 f0                	or     %esi,%eax
+     3f9:	74 ba                	je     3b5 <main+0x135>
+     3fb:	8b 14 9d e0 25 00 00 	mov    0x25e0(,%ebx,4),%edx
+     402:	8b 42 04             	mov    0x4(%edx),%eax
+     405:	39 32                	cmp    %esi,(%edx)
+     407:	19 c8                	sbb    %ecx,%eax
+     409:	73 bc                	jae    3c7 <main+0x147>
+     40b:	eb a8                	jmp    3b5 <main+0x135>
+     40d:	89 b5 d8 fe ff ff    	mov    %esi,-0x128(%ebp)
+     413:	e9 99 00 00 00       	jmp    4b1 <main+0x231>
+  for(;;){
+    best = -1;
+    for(i = 0; i < ncpu; i++)
+      if(pos[i] < nev[i] &&
+         (best < 0 || ev[i][pos[i]].tsc < ev[best][pos[best]].tsc))
+        best = i;
+     418:	89 c3                	mov    %eax,%ebx
+    for(i = 0; i < ncpu; i++)
+     41a:	83 c0 01             	add    $0x1,%eax
+     41d:	39 f8                	cmp    %edi,%eax
+     41f:	7d 5d                	jge    47e <main+0x1fe>
+      if(pos[i] < nev[i] &&
+     421:	8b 94 85 e8 fe ff ff 	mov    -0x118(%ebp,%eax,4),%edx
+     428:	3b 14 85 e0 24 00 00 	cmp    0x24e0(,%eax,4),%edx
+     42f:	7d e9                	jge    41a <main+0x19a>
+     431:	85 db                	test   %ebx,%ebx
+     433:	78 e3                	js     418 <main+0x198>
+         (best < 0 || ev[i][pos[i]].tsc < ev[best][pos[best]].tsc))
+     435:	8d 0c 92             	lea    (%edx,%edx,4),%ecx
+     438:	c1 e1 02             	shl    $0x2,%ecx
+     43b:	03 0c 85 e0 25 00 00 	add    0x25e0(,%eax,4),%ecx
+     442:	8b 71 04             	mov    0x4(%ecx),%esi
+     445:	89 b5 e4 fe ff ff    	mov    %esi,-0x11c(%ebp)
+     44b:	8b 94 9d e8 fe ff ff 	mov    -0x118(%ebp,%ebx,4),%edx
+     452:	8d 14 92             	lea    (%edx,%edx,4),%edx
+     455:	c1 e2 02             	shl    $0x2,%edx
+     458:	03 14 9d e0 25 00 00 	add    0x25e0(,%ebx,4),%edx
+     45f:	8b 72 04             	mov    0x4(%edx),%esi
+     462:	89 b5 e0 fe ff ff    	mov    %esi,-0x120(%ebp)
+     468:	8b 12                	mov    (%edx),%edx
+     46a:	39 11                	cmp    %edx,(%ecx)
+     46c:	8b b5 e4 fe ff ff    	mov    -0x11c(%ebp),%esi
+     472:	1b b5 e0 fe ff ff    	sbb    -0x120(%ebp),%esi
+     478:	73 a0                	jae    41a <main+0x19a>
+        best = i;
+     47a:	89 c3                	mov    %eax,%ebx
+     47c:	eb 9c                	jmp    41a <main+0x19a>
+    if(best < 0)
+     47e:	85 db                	test   %ebx,%ebx
+     480:	78 3e                	js     4c0 <main+0x240>
+      break;
+    print(&ev[best][pos[best]++], t0);
+     482:	8b 84 9d e8 fe ff ff 	mov    -0x118(%ebp,%ebx,4),%eax
+     489:	8d 50 01             	lea    0x1(%eax),%edx
+     48c:	89 94 9d e8 fe ff ff 	mov    %edx,-0x118(%ebp,%ebx,4)
+     493:	8d 04 80             	lea    (%eax,%eax,4),%eax
+     496:	c1 e0 02             	shl    $0x2,%eax
+     499:	03 04 9d e0 25 00 00 	add    0x25e0(,%ebx,4),%eax
+     4a0:	8b 95 d8 fe ff ff    	mov    -0x128(%ebp),%edx
+     4a6:	8b 8d dc fe ff ff    	mov    -0x124(%ebp),%ecx
+     4ac:	e8 96 fb ff ff       	call   47 <print>
+    best = -1;
+     4b1:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+    for(i = 0; i < ncpu; i++)
+     4b6:	b8 00 00 00 00       	mov    $0x0,%eax
+     4bb:	e9 5d ff ff ff       	jmp    41d <main+0x19d>
+  }
+  exit();
+     4c0:	e8 38 06 00 00       	call   afd <exit>
+
+000004c5 <strcpy>:
+#include "memlayout.h"
+#include "clock.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     4c5:	55                   	push   %ebp
+     4c6:	89 e5                	mov    %esp,%ebp
+     4c8:	56                   	push   %esi
+     4c9:	53                   	push   %ebx
+     4ca:	8b 75 08             	mov    0x8(%ebp),%esi
+     4cd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     4d0:	89 f0                	mov    %esi,%eax
+     4d2:	89 d1                	mov    %edx,%ecx
+     4d4:	83 c2 01             	add    $0x1,%edx
+     4d7:	89 c3                	mov    %eax,%ebx
+     4d9:	83 c0 01             	add    $0x1,%eax
+     4dc:	0f b6 09             	movzbl (%ecx),%ecx
+     4df:	88 0b                	mov    %cl,(%ebx)
+     4e1:	84 c9                	test   %cl,%cl
+     4e3:	75 ed                	jne    4d2 <strcpy+0xd>
+    ;
+  return os;
+}
+     4e5:	89 f0                	mov    %esi,%eax
+     4e7:	5b                   	pop    %ebx
+     4e8:	5e                   	pop    %esi
+     4e9:	5d                   	pop    %ebp
+     4ea:	c3                   	ret
+
+000004eb <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     4eb:	55                   	push   %ebp
+     4ec:	89 e5                	mov    %esp,%ebp
+     4ee:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     4f1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+     4f4:	eb 06                	jmp    4fc <strcmp+0x11>
+    p++, q++;
+     4f6:	83 c1 01             	add    $0x1,%ecx
+     4f9:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+     4fc:	0f b6 01             	movzbl (%ecx),%eax
+     4ff:	84 c0                	test   %al,%al
+     501:	74 04                	je     507 <strcmp+0x1c>
+     503:	3a 02                	cmp    (%edx),%al
+     505:	74 ef                	je     4f6 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+     507:	0f b6 c0             	movzbl %al,%eax
+     50a:	0f b6 12             	movzbl (%edx),%edx
+     50d:	29 d0                	sub    %edx,%eax
+}
+     50f:	5d                   	pop    %ebp
+     510:	c3                   	ret
+
+00000511 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     511:	55                   	push   %ebp
+     512:	89 e5                	mov    %esp,%ebp
+     514:	53                   	push   %ebx
+     515:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  const char *p;
+  uint w;
+
+  for(p = s; (uint)p & 3; p++)
+     518:	89 c8                	mov    %ecx,%eax
+     51a:	eb 03                	jmp    51f <strlen+0xe>
+     51c:	83 c0 01             	add    $0x1,%eax
+     51f:	a8 03                	test   $0x3,%al
+     521:	74 09                	je     52c <strlen+0x1b>
+    if(*p == 0)
+     523:	80 38 00             	cmpb   $0x0,(%eax)
+     526:	75 f4                	jne    51c <strlen+0xb>
+      return p - s;
+     528:	29 c8                	sub    %ecx,%eax
+     52a:	eb 25                	jmp    551 <strlen+0x40>
+  // Then a word at a time, which never crosses into the next page:
+  // a word with a zero byte in it has one of these bits set.
+  for(;; p += 4){
+    w = *(uint*)p;
+     52c:	8b 10                	mov    (%eax),%edx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     52e:	8d 9a ff fe fe fe    	lea    -0x1010101(%edx),%ebx
+     534:	f7 d2                	not    %edx
+     536:	21 da                	and    %ebx,%edx
+     538:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+     53e:	75 05                	jne    545 <strlen+0x34>
+  for(;; p += 4){
+     540:	83 c0 04             	add    $0x4,%eax
+    w = *(uint*)p;
+     543:	eb e7                	jmp    52c <strlen+0x1b>
+      break;
+  }
+  while(*p)
+     545:	80 38 00             	cmpb   $0x0,(%eax)
+     548:	74 05                	je     54f <strlen+0x3e>
+    p++;
+     54a:	83 c0 01             	add    $0x1,%eax
+     54d:	eb f6                	jmp    545 <strlen+0x34>
+  return p - s;
+     54f:	29 c8                	sub    %ecx,%eax
+}
+     551:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     554:	c9                   	leave
+     555:	c3                   	ret
+
+00000556 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     556:	55                   	push   %ebp
+     557:	89 e5                	mov    %esp,%ebp
+     559:	57                   	push   %edi
+     55a:	56                   	push   %esi
+     55b:	53                   	push   %ebx
+     55c:	8b 55 10             	mov    0x10(%ebp),%edx
+  uint h;
+  char *d;
+
+  d = dst;
+  c &= 0xFF;
+     55f:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  if(n >= 16){
+     563:	83 fa 0f             	cmp    $0xf,%edx
+     566:	76 52                	jbe    5ba <memset+0x64>
+    h = -(uint)d & 3;
+     568:	8b 45 08             	mov    0x8(%ebp),%eax
+     56b:	f7 d8                	neg    %eax
+     56d:	83 e0 03             	and    $0x3,%eax
+     570:	89 c6                	mov    %eax,%esi
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     572:	8b 7d 08             	mov    0x8(%ebp),%edi
+     575:	89 c1                	mov    %eax,%ecx
+     577:	89 d8                	mov    %ebx,%eax
+     579:	fc                   	cld
+     57a:	f3 aa                	rep stos %al,%es:(%edi)
+    stosb(d, c, h);
+    stosl(d + h, (c<<24)|(c<<16)|(c<<8)|c, (n - h)/4);
+     57c:	29 f2                	sub    %esi,%edx
+     57e:	89 d1                	mov    %edx,%ecx
+     580:	c1 e9 02             	shr    $0x2,%ecx
+     583:	c1 e0 18             	shl    $0x18,%eax
+     586:	89 df                	mov    %ebx,%edi
+     588:	c1 e7 10             	shl    $0x10,%edi
+     58b:	09 f8                	or     %edi,%eax
+     58d:	89 df                	mov    %ebx,%edi
+     58f:	c1 e7 08             	shl    $0x8,%edi
+     592:	09 f8                	or     %edi,%eax
+     594:	09 d8                	or     %ebx,%eax
+     596:	89 f7                	mov    %esi,%edi
+     598:	03 7d 08             	add    0x8(%ebp),%edi
+}
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosl" :
+     59b:	fc                   	cld
+     59c:	f3 ab                	rep stos %eax,%es:(%edi)
+    d += h + (n - h)/4*4;
+     59e:	89 d7                	mov    %edx,%edi
+     5a0:	83 e7 fc             	and    $0xfffffffc,%edi
+     5a3:	09 f7                	or     %esi,%edi
+     5a5:	03 7d 08             	add    0x8(%ebp),%edi
+    n = (n - h)%4;
+     5a8:	83 e2 03             	and    $0x3,%edx
+  asm volatile("cld; rep stosb" :
+     5ab:	89 d1                	mov    %edx,%ecx
+     5ad:	89 d8                	mov    %ebx,%eax
+     5af:	fc                   	cld
+     5b0:	f3 aa                	rep stos %al,%es:(%edi)
+  }
+  stosb(d, c, n);
+  return dst;
+}
+     5b2:	8b 45 08             	mov    0x8(%ebp),%eax
+     5b5:	5b                   	pop    %ebx
+     5b6:	5e                   	pop    %esi
+     5b7:	5f                   	pop    %edi
+     5b8:	5d                   	pop    %ebp
+     5b9:	c3                   	ret
+  d = dst;
+     5ba:	8b 7d 08             	mov    0x8(%ebp),%edi
+     5bd:	eb ec                	jmp    5ab <memset+0x55>
+
+000005bf <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     5bf:	55                   	push   %ebp
+     5c0:	89 e5                	mov    %esp,%ebp
+     5c2:	8b 45 08             	mov    0x8(%ebp),%eax
+     5c5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     5c9:	eb 03                	jmp    5ce <strchr+0xf>
+     5cb:	83 c0 01             	add    $0x1,%eax
+     5ce:	0f b6 10             	movzbl (%eax),%edx
+     5d1:	84 d2                	test   %dl,%dl
+     5d3:	74 06                	je     5db <strchr+0x1c>
+    if(*s == c)
+     5d5:	38 ca                	cmp    %cl,%dl
+     5d7:	75 f2                	jne    5cb <strchr+0xc>
+     5d9:	eb 05                	jmp    5e0 <strchr+0x21>
+      return (char*)s;
+  return 0;
+     5db:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     5e0:	5d                   	pop    %ebp
+     5e1:	c3                   	ret
+
+000005e2 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     5e2:	55                   	push   %ebp
+     5e3:	89 e5                	mov    %esp,%ebp
+     5e5:	56                   	push   %esi
+     5e6:	53                   	push   %ebx
+     5e7:	8b 55 08             	mov    0x8(%ebp),%edx
+     5ea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     5ed:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  // A word at a time while they agree.
+  if((((uint)s1 | (uint)s2) & 3) == 0)
+     5f0:	89 d3                	mov    %edx,%ebx
+     5f2:	09 cb                	or     %ecx,%ebx
+     5f4:	f6 c3 03             	test   $0x3,%bl
+     5f7:	74 24                	je     61d <memcmp+0x3b>
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+      s1 += 4, s2 += 4;
+  while(n-- > 0){
+     5f9:	8d 70 ff             	lea    -0x1(%eax),%esi
+     5fc:	85 c0                	test   %eax,%eax
+     5fe:	74 32                	je     632 <memcmp+0x50>
+    if(*s1 != *s2)
+     600:	0f b6 02             	movzbl (%edx),%eax
+     603:	0f b6 19             	movzbl (%ecx),%ebx
+     606:	38 d8                	cmp    %bl,%al
+     608:	75 20                	jne    62a <memcmp+0x48>
+      return *s1 - *s2;
+    s1++, s2++;
+     60a:	83 c2 01             	add    $0x1,%edx
+     60d:	83 c1 01             	add    $0x1,%ecx
+  while(n-- > 0){
+     610:	89 f0                	mov    %esi,%eax
+     612:	eb e5                	jmp    5f9 <memcmp+0x17>
+      s1 += 4, s2 += 4;
+     614:	83 c2 04             	add    $0x4,%edx
+     617:	83 c1 04             	add    $0x4,%ecx
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+     61a:	83 e8 04             	sub    $0x4,%eax
+     61d:	83 f8 03             	cmp    $0x3,%eax
+     620:	76 d7                	jbe    5f9 <memcmp+0x17>
+     622:	8b 31                	mov    (%ecx),%esi
+     624:	39 32                	cmp    %esi,(%edx)
+     626:	74 ec                	je     614 <memcmp+0x32>
+     628:	eb cf                	jmp    5f9 <memcmp+0x17>
+      return *s1 - *s2;
+     62a:	0f b6 c0             	movzbl %al,%eax
+     62d:	0f b6 db             	movzbl %bl,%ebx
+     630:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     632:	5b                   	pop    %ebx
+     633:	5e                   	pop    %esi
+     634:	5d                   	pop    %ebp
+     635:	c3                   	ret
+
+00000636 <memchr>:
+// The first c in the n bytes at v, or 0.  Once aligned, a word at
+// a time, with the word's bytes that equal c turned into zeroes
+// and those looked for.
+void*
+memchr(const void *v, int c, uint n)
+{
+     636:	55                   	push   %ebp
+     637:	89 e5                	mov    %esp,%ebp
+     639:	57                   	push   %edi
+     63a:	56                   	push   %esi
+     63b:	53                   	push   %ebx
+     63c:	8b 45 08             	mov    0x8(%ebp),%eax
+     63f:	8b 55 10             	mov    0x10(%ebp),%edx
+  const uchar *s;
+  uint w, rep;
+
+  s = v;
+  c = (uchar)c;
+     642:	0f b6 75 0c          	movzbl 0xc(%ebp),%esi
+  for(; n > 0 && ((uint)s & 3); n--, s++)
+     646:	eb 06                	jmp    64e <memchr+0x18>
+     648:	83 ea 01             	sub    $0x1,%edx
+     64b:	83 c0 01             	add    $0x1,%eax
+     64e:	85 d2                	test   %edx,%edx
+     650:	74 0d                	je     65f <memchr+0x29>
+     652:	a8 03                	test   $0x3,%al
+     654:	74 09                	je     65f <memchr+0x29>
+    if(*s == c)
+     656:	0f b6 08             	movzbl (%eax),%ecx
+     659:	39 f1                	cmp    %esi,%ecx
+     65b:	75 eb                	jne    648 <memchr+0x12>
+     65d:	eb 41                	jmp    6a0 <memchr+0x6a>
+      return (void*)s;
+  rep = c * 0x01010101;
+     65f:	69 fe 01 01 01 01    	imul   $0x1010101,%esi,%edi
+  for(; n >= 4; n -= 4, s += 4){
+     665:	eb 06                	jmp    66d <memchr+0x37>
+     667:	83 ea 04             	sub    $0x4,%edx
+     66a:	83 c0 04             	add    $0x4,%eax
+     66d:	83 fa 03             	cmp    $0x3,%edx
+     670:	76 16                	jbe    688 <memchr+0x52>
+    w = *(uint*)s ^ rep;
+     672:	89 f9                	mov    %edi,%ecx
+     674:	33 08                	xor    (%eax),%ecx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     676:	8d 99 ff fe fe fe    	lea    -0x1010101(%ecx),%ebx
+     67c:	f7 d1                	not    %ecx
+     67e:	21 cb                	and    %ecx,%ebx
+     680:	f7 c3 80 80 80 80    	test   $0x80808080,%ebx
+     686:	74 df                	je     667 <memchr+0x31>
+      break;
+  }
+  for(; n > 0; n--, s++)
+     688:	85 d2                	test   %edx,%edx
+     68a:	74 0f                	je     69b <memchr+0x65>
+    if(*s == c)
+     68c:	0f b6 08             	movzbl (%eax),%ecx
+     68f:	39 f1                	cmp    %esi,%ecx
+     691:	74 0d                	je     6a0 <memchr+0x6a>
+  for(; n > 0; n--, s++)
+     693:	83 ea 01             	sub    $0x1,%edx
+     696:	83 c0 01             	add    $0x1,%eax
+     699:	eb ed                	jmp    688 <memchr+0x52>
+      return (void*)s;
+  return 0;
+     69b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     6a0:	5b                   	pop    %ebx
+     6a1:	5e                   	pop    %esi
+     6a2:	5f                   	pop    %edi
+     6a3:	5d                   	pop    %ebp
+     6a4:	c3                   	ret
+
+000006a5 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     6a5:	55                   	push   %ebp
+     6a6:	89 e5                	mov    %esp,%ebp
+     6a8:	57                   	push   %edi
+     6a9:	56                   	push   %esi
+     6aa:	53                   	push   %ebx
+     6ab:	83 ec 1c             	sub    $0x1c,%esp
+     6ae:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     6b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+     6b6:	89 de                	mov    %ebx,%esi
+     6b8:	83 c3 01             	add    $0x1,%ebx
+     6bb:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     6be:	7d 2e                	jge    6ee <gets+0x49>
+    cc = read(0, &c, 1);
+     6c0:	83 ec 04             	sub    $0x4,%esp
+     6c3:	6a 01                	push   $0x1
+     6c5:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     6c8:	50                   	push   %eax
+     6c9:	6a 00                	push   $0x0
+     6cb:	e8 51 05 00 00       	call   c21 <read>
+    if(cc < 1)
+     6d0:	83 c4 10             	add    $0x10,%esp
+     6d3:	85 c0                	test   %eax,%eax
+     6d5:	7e 17                	jle    6ee <gets+0x49>
+      break;
+    buf[i++] = c;
+     6d7:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     6db:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+     6de:	3c 0a                	cmp    $0xa,%al
+     6e0:	0f 94 c2             	sete   %dl
+     6e3:	3c 0d                	cmp    $0xd,%al
+     6e5:	0f 94 c0             	sete   %al
+     6e8:	08 c2                	or     %al,%dl
+     6ea:	74 ca                	je     6b6 <gets+0x11>
+    buf[i++] = c;
+     6ec:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+     6ee:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+     6f2:	89 f8                	mov    %edi,%eax
+     6f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     6f7:	5b                   	pop    %ebx
+     6f8:	5e                   	pop    %esi
+     6f9:	5f                   	pop    %edi
+     6fa:	5d                   	pop    %ebp
+     6fb:	c3                   	ret
+
+000006fc <atoi>:
+  return r;
+}
+
+int
+atoi(const char *s)
+{
+     6fc:	55                   	push   %ebp
+     6fd:	89 e5                	mov    %esp,%ebp
+     6ff:	53                   	push   %ebx
+     700:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+     703:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+     708:	eb 10                	jmp    71a <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+     70a:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+     70d:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+     710:	83 c1 01             	add    $0x1,%ecx
+     713:	0f be c0             	movsbl %al,%eax
+     716:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+     71a:	0f b6 01             	movzbl (%ecx),%eax
+     71d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     720:	80 fb 09             	cmp    $0x9,%bl
+     723:	76 e5                	jbe    70a <atoi+0xe>
+  return n;
+}
+     725:	89 d0                	mov    %edx,%eax
+     727:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     72a:	c9                   	leave
+     72b:	c3                   	ret
+
+0000072c <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     72c:	55                   	push   %ebp
+     72d:	89 e5                	mov    %esp,%ebp
+     72f:	57                   	push   %edi
+     730:	56                   	push   %esi
+     731:	53                   	push   %ebx
+     732:	83 ec 08             	sub    $0x8,%esp
+     735:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     738:	8b 55 0c             	mov    0xc(%ebp),%edx
+     73b:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *src;
+  int h;
+
+  dst = vdst;
+  src = vsrc;
+  if(n <= 0)
+     73e:	85 c0                	test   %eax,%eax
+     740:	0f 8e 82 00 00 00    	jle    7c8 <memmove+0x9c>
+    return vdst;
+  if(src < dst && src + n > dst){
+     746:	39 da                	cmp    %ebx,%edx
+     748:	73 07                	jae    751 <memmove+0x25>
+     74a:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+     74d:	39 cb                	cmp    %ecx,%ebx
+     74f:	72 5e                	jb     7af <memmove+0x83>
+    movsbback(dst + n - 1, src + n - 1, n);
+    return vdst;
+  }
+  if(n >= 16 && (((uint)dst ^ (uint)src) & 3) == 0){
+     751:	83 f8 0f             	cmp    $0xf,%eax
+     754:	7e 69                	jle    7bf <memmove+0x93>
+     756:	89 d9                	mov    %ebx,%ecx
+     758:	31 d1                	xor    %edx,%ecx
+     75a:	f6 c1 03             	test   $0x3,%cl
+     75d:	75 73                	jne    7d2 <memmove+0xa6>
+    h = -(uint)dst & 3;
+     75f:	89 d9                	mov    %ebx,%ecx
+     761:	f7 d9                	neg    %ecx
+     763:	83 e1 03             	and    $0x3,%ecx
+}
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsb" :
+     766:	89 df                	mov    %ebx,%edi
+     768:	89 d6                	mov    %edx,%esi
+     76a:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+     76d:	fc                   	cld
+     76e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    movsb(dst, src, h);
+    dst += h, src += h, n -= h;
+     770:	8b 75 f0             	mov    -0x10(%ebp),%esi
+     773:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+     776:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+     779:	29 f0                	sub    %esi,%eax
+    movsl(dst, src, n/4);
+     77b:	8d 50 03             	lea    0x3(%eax),%edx
+     77e:	0f 49 d0             	cmovns %eax,%edx
+     781:	c1 fa 02             	sar    $0x2,%edx
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+     784:	89 7d f0             	mov    %edi,-0x10(%ebp)
+     787:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     78a:	89 ce                	mov    %ecx,%esi
+     78c:	89 d1                	mov    %edx,%ecx
+     78e:	fc                   	cld
+     78f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    dst += n/4*4, src += n/4*4, n %= 4;
+     791:	c1 e2 02             	shl    $0x2,%edx
+     794:	8b 7d f0             	mov    -0x10(%ebp),%edi
+     797:	01 d7                	add    %edx,%edi
+     799:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     79c:	01 ca                	add    %ecx,%edx
+     79e:	89 c6                	mov    %eax,%esi
+     7a0:	c1 fe 1f             	sar    $0x1f,%esi
+     7a3:	c1 ee 1e             	shr    $0x1e,%esi
+     7a6:	01 f0                	add    %esi,%eax
+     7a8:	83 e0 03             	and    $0x3,%eax
+     7ab:	29 f0                	sub    %esi,%eax
+     7ad:	eb 12                	jmp    7c1 <memmove+0x95>
+    movsbback(dst + n - 1, src + n - 1, n);
+     7af:	8d 78 ff             	lea    -0x1(%eax),%edi
+     7b2:	8d 34 3a             	lea    (%edx,%edi,1),%esi
+     7b5:	01 df                	add    %ebx,%edi
+// Copy cnt bytes down from the last ones, at dst and src, to the
+// first: for overlapping moves up.
+static inline void
+movsbback(void *dst, const void *src, int cnt)
+{
+  asm volatile("std; rep movsb; cld" :
+     7b7:	89 c1                	mov    %eax,%ecx
+     7b9:	fd                   	std
+     7ba:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     7bc:	fc                   	cld
+    return vdst;
+     7bd:	eb 09                	jmp    7c8 <memmove+0x9c>
+  dst = vdst;
+     7bf:	89 df                	mov    %ebx,%edi
+  asm volatile("cld; rep movsb" :
+     7c1:	89 d6                	mov    %edx,%esi
+     7c3:	89 c1                	mov    %eax,%ecx
+     7c5:	fc                   	cld
+     7c6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  }
+  movsb(dst, src, n);
+  return vdst;
+}
+     7c8:	89 d8                	mov    %ebx,%eax
+     7ca:	83 c4 08             	add    $0x8,%esp
+     7cd:	5b                   	pop    %ebx
+     7ce:	5e                   	pop    %esi
+     7cf:	5f                   	pop    %edi
+     7d0:	5d                   	pop    %ebp
+     7d1:	c3                   	ret
+  dst = vdst;
+     7d2:	89 df                	mov    %ebx,%edi
+     7d4:	eb eb                	jmp    7c1 <memmove+0x95>
+
+000007d6 <vclock_gettime>:
+
+// clock_gettime() without a system call: read the clock page
+// that the kernel maps at CLOCKPAGE (see clock.h).
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+     7d6:	55                   	push   %ebp
+     7d7:	89 e5                	mov    %esp,%ebp
+     7d9:	57                   	push   %edi
+     7da:	56                   	push   %esi
+     7db:	53                   	push   %ebx
+     7dc:	83 ec 14             	sub    $0x14,%esp
+  struct clockpage *cp = (struct clockpage*)CLOCKPAGE;
+  uint seq, rem, d;
+  uint64 tsc, ns, now;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+     7df:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     7e3:	0f 87 a3 00 00 00    	ja     88c <vclock_gettime+0xb6>
+    return -1;
+  do {
+    seq = cp->seq;
+     7e9:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+    __sync_synchronize();
+     7ee:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    tsc = cp->tsc;
+     7f3:	8b 15 10 f0 ff 7f    	mov    0x7ffff010,%edx
+     7f9:	8b 1d 14 f0 ff 7f    	mov    0x7ffff014,%ebx
+    ns = cp->ns;
+     7ff:	8b 35 18 f0 ff 7f    	mov    0x7ffff018,%esi
+     805:	8b 3d 1c f0 ff 7f    	mov    0x7ffff01c,%edi
+    __sync_synchronize();
+     80b:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != cp->seq);
+     810:	89 c1                	mov    %eax,%ecx
+     812:	83 e1 01             	and    $0x1,%ecx
+     815:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     818:	75 cf                	jne    7e9 <vclock_gettime+0x13>
+     81a:	8b 0d 00 f0 ff 7f    	mov    0x7ffff000,%ecx
+     820:	39 c1                	cmp    %eax,%ecx
+     822:	75 c5                	jne    7e9 <vclock_gettime+0x13>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+     824:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     827:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     82a:	0f 31                	rdtsc
+     82c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     82f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     832:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  now = rdtsc();
+  // Less than a tick has passed since the update, so the delta
+  // fits in 32 bits.
+  d = now > tsc ? now - tsc : 0;
+     835:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     838:	19 d3                	sbb    %edx,%ebx
+     83a:	73 07                	jae    843 <vclock_gettime+0x6d>
+     83c:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+     83f:	29 d8                	sub    %ebx,%eax
+     841:	89 c1                	mov    %eax,%ecx
+  ns += ((uint64)d * cp->mult) >> cp->shift;
+     843:	89 c8                	mov    %ecx,%eax
+     845:	f7 25 04 f0 ff 7f    	mull   0x7ffff004
+     84b:	0f b6 0d 08 f0 ff 7f 	movzbl 0x7ffff008,%ecx
+     852:	0f ad d0             	shrd   %cl,%edx,%eax
+     855:	d3 ea                	shr    %cl,%edx
+     857:	f6 c1 20             	test   $0x20,%cl
+     85a:	74 04                	je     860 <vclock_gettime+0x8a>
+     85c:	89 d0                	mov    %edx,%eax
+     85e:	31 d2                	xor    %edx,%edx
+     860:	01 f0                	add    %esi,%eax
+     862:	11 fa                	adc    %edi,%edx
+static inline uint
+divl(uint64 n, uint d, uint *r)
+{
+  uint q;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (*r) :
+     864:	bb 00 ca 9a 3b       	mov    $0x3b9aca00,%ebx
+     869:	f7 f3                	div    %ebx
+  ts->tv_sec = divl(ns, 1000000000, &rem);
+     86b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     86e:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = rem;
+     870:	89 57 04             	mov    %edx,0x4(%edi)
+  if(clk == CLOCK_REALTIME)
+     873:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     877:	75 1a                	jne    893 <vclock_gettime+0xbd>
+    ts->tv_sec += cp->boottime;
+     879:	03 05 0c f0 ff 7f    	add    0x7ffff00c,%eax
+     87f:	89 07                	mov    %eax,(%edi)
+  return 0;
+     881:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     884:	83 c4 14             	add    $0x14,%esp
+     887:	5b                   	pop    %ebx
+     888:	5e                   	pop    %esi
+     889:	5f                   	pop    %edi
+     88a:	5d                   	pop    %ebp
+     88b:	c3                   	ret
+    return -1;
+     88c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     891:	eb f1                	jmp    884 <vclock_gettime+0xae>
+  return 0;
+     893:	b8 00 00 00 00       	mov    $0x0,%eax
+     898:	eb ea                	jmp    884 <vclock_gettime+0xae>
+
+0000089a <flush>:
+
+// Write out fd's buffer, or with fd < 0 every buffer.
+// Returns -1 if a write fails.
+int
+flush(int fd)
+{
+     89a:	55                   	push   %ebp
+     89b:	89 e5                	mov    %esp,%ebp
+     89d:	56                   	push   %esi
+     89e:	53                   	push   %ebx
+     89f:	8b 45 08             	mov    0x8(%ebp),%eax
+  int r, n;
+
+  if(fd < 0){
+     8a2:	85 c0                	test   %eax,%eax
+     8a4:	78 5d                	js     903 <flush+0x69>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+      if(flush(fd) < 0)
+        r = -1;
+    return r;
+  }
+  if(fd >= NOBUF || (n = obuf[fd].n) == 0)
+     8a6:	83 f8 0f             	cmp    $0xf,%eax
+     8a9:	7f 64                	jg     90f <flush+0x75>
+     8ab:	69 d0 08 02 00 00    	imul   $0x208,%eax,%edx
+     8b1:	8b b2 e4 26 00 00    	mov    0x26e4(%edx),%esi
+     8b7:	85 f6                	test   %esi,%esi
+     8b9:	74 59                	je     914 <flush+0x7a>
+    return 0;
+  obuf[fd].n = 0;
+     8bb:	c7 82 e4 26 00 00 00 	movl   $0x0,0x26e4(%edx)
+     8c2:	00 00 00 
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     8c5:	81 c2 e8 26 00 00    	add    $0x26e8,%edx
+     8cb:	83 ec 04             	sub    $0x4,%esp
+     8ce:	56                   	push   %esi
+     8cf:	52                   	push   %edx
+     8d0:	50                   	push   %eax
+     8d1:	e8 5a 03 00 00       	call   c30 <write>
+     8d6:	83 c4 10             	add    $0x10,%esp
+     8d9:	39 f0                	cmp    %esi,%eax
+     8db:	75 40                	jne    91d <flush+0x83>
+     8dd:	be 00 00 00 00       	mov    $0x0,%esi
+     8e2:	eb 30                	jmp    914 <flush+0x7a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     8e4:	83 c3 01             	add    $0x1,%ebx
+     8e7:	83 fb 0f             	cmp    $0xf,%ebx
+     8ea:	7f 28                	jg     914 <flush+0x7a>
+      if(flush(fd) < 0)
+     8ec:	83 ec 0c             	sub    $0xc,%esp
+     8ef:	53                   	push   %ebx
+     8f0:	e8 a5 ff ff ff       	call   89a <flush>
+     8f5:	83 c4 10             	add    $0x10,%esp
+     8f8:	85 c0                	test   %eax,%eax
+     8fa:	79 e8                	jns    8e4 <flush+0x4a>
+        r = -1;
+     8fc:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     901:	eb e1                	jmp    8e4 <flush+0x4a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     903:	be 00 00 00 00       	mov    $0x0,%esi
+     908:	bb 00 00 00 00       	mov    $0x0,%ebx
+     90d:	eb d8                	jmp    8e7 <flush+0x4d>
+    return 0;
+     90f:	be 00 00 00 00       	mov    $0x0,%esi
+}
+     914:	89 f0                	mov    %esi,%eax
+     916:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     919:	5b                   	pop    %ebx
+     91a:	5e                   	pop    %esi
+     91b:	5d                   	pop    %ebp
+     91c:	c3                   	ret
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     91d:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     922:	eb f0                	jmp    914 <flush+0x7a>
+
+00000924 <bufreset>:
+
+static void
+bufreset(int fd)
+{
+  if(fd >= 0 && fd < NOBUF){
+     924:	83 f8 0f             	cmp    $0xf,%eax
+     927:	76 01                	jbe    92a <bufreset+0x6>
+     929:	c3                   	ret
+{
+     92a:	55                   	push   %ebp
+     92b:	89 e5                	mov    %esp,%ebp
+     92d:	53                   	push   %ebx
+     92e:	83 ec 10             	sub    $0x10,%esp
+     931:	89 c3                	mov    %eax,%ebx
+    flush(fd);
+     933:	50                   	push   %eax
+     934:	e8 61 ff ff ff       	call   89a <flush>
+    obuf[fd].mode = BUNKNOWN;
+     939:	69 db 08 02 00 00    	imul   $0x208,%ebx,%ebx
+     93f:	c7 83 e0 26 00 00 00 	movl   $0x0,0x26e0(%ebx)
+     946:	00 00 00 
+     949:	83 c4 10             	add    $0x10,%esp
+  }
+}
+     94c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     94f:	c9                   	leave
+     950:	c3                   	ret
+
+00000951 <bufwrite>:
+
+// Write n bytes from p to fd, through its buffer.
+// Returns n, or -1 if a write fails.
+int
+bufwrite(int fd, const void *p, int n)
+{
+     951:	55                   	push   %ebp
+     952:	89 e5                	mov    %esp,%ebp
+     954:	57                   	push   %edi
+     955:	56                   	push   %esi
+     956:	53                   	push   %ebx
+     957:	83 ec 3c             	sub    $0x3c,%esp
+     95a:	8b 75 08             	mov    0x8(%ebp),%esi
+     95d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct stat st;
+  const char *s;
+  int i;
+
+  if(fd < 0 || fd >= NOBUF)
+     960:	83 fe 0f             	cmp    $0xf,%esi
+     963:	0f 87 a2 00 00 00    	ja     a0b <bufwrite+0xba>
+    return write(fd, p, n);
+  if(obuf[fd].mode == BUNKNOWN){
+     969:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     96f:	83 b8 e0 26 00 00 00 	cmpl   $0x0,0x26e0(%eax)
+     976:	75 19                	jne    991 <bufwrite+0x40>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     978:	83 fe 02             	cmp    $0x2,%esi
+     97b:	0f 85 9c 00 00 00    	jne    a1d <bufwrite+0xcc>
+      obuf[fd].mode = BNONE;
+     981:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     987:	c7 80 e0 26 00 00 01 	movl   $0x1,0x26e0(%eax)
+     98e:	00 00 00 
+    else
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+  }
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     991:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     997:	89 da                	mov    %ebx,%edx
+     999:	03 90 e4 26 00 00    	add    0x26e4(%eax),%edx
+     99f:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+     9a5:	0f 8f ae 00 00 00    	jg     a59 <bufwrite+0x108>
+    return -1;
+  if(n >= OBUFSZ)
+     9ab:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+     9b1:	0f 8f bd 00 00 00    	jg     a74 <bufwrite+0x123>
+    return write(fd, p, n);
+  memmove(obuf[fd].buf + obuf[fd].n, p, n);
+     9b7:	69 d6 08 02 00 00    	imul   $0x208,%esi,%edx
+     9bd:	8d ba e0 26 00 00    	lea    0x26e0(%edx),%edi
+     9c3:	8b 82 e4 26 00 00    	mov    0x26e4(%edx),%eax
+     9c9:	83 ec 04             	sub    $0x4,%esp
+     9cc:	53                   	push   %ebx
+     9cd:	ff 75 0c             	push   0xc(%ebp)
+     9d0:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     9d3:	8d 84 10 e8 26 00 00 	lea    0x26e8(%eax,%edx,1),%eax
+     9da:	50                   	push   %eax
+     9db:	e8 4c fd ff ff       	call   72c <memmove>
+  obuf[fd].n += n;
+     9e0:	01 5f 04             	add    %ebx,0x4(%edi)
+  if(obuf[fd].mode == BNONE)
+     9e3:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     9e6:	8b 82 e0 26 00 00    	mov    0x26e0(%edx),%eax
+     9ec:	83 c4 10             	add    $0x10,%esp
+     9ef:	83 f8 01             	cmp    $0x1,%eax
+     9f2:	0f 84 91 00 00 00    	je     a89 <bufwrite+0x138>
+    return flush(fd) < 0 ? -1 : n;
+  if(obuf[fd].mode == BLINE)
+     9f8:	83 f8 02             	cmp    $0x2,%eax
+     9fb:	0f 84 ca 00 00 00    	je     acb <bufwrite+0x17a>
+    for(s = p, i = 0; i < n; i++)
+      if(s[i] == '\n')
+        return flush(fd) < 0 ? -1 : n;
+  return n;
+     a01:	89 d8                	mov    %ebx,%eax
+}
+     a03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a06:	5b                   	pop    %ebx
+     a07:	5e                   	pop    %esi
+     a08:	5f                   	pop    %edi
+     a09:	5d                   	pop    %ebp
+     a0a:	c3                   	ret
+    return write(fd, p, n);
+     a0b:	83 ec 04             	sub    $0x4,%esp
+     a0e:	53                   	push   %ebx
+     a0f:	ff 75 0c             	push   0xc(%ebp)
+     a12:	56                   	push   %esi
+     a13:	e8 18 02 00 00       	call   c30 <write>
+     a18:	83 c4 10             	add    $0x10,%esp
+     a1b:	eb e6                	jmp    a03 <bufwrite+0xb2>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     a1d:	83 ec 08             	sub    $0x8,%esp
+     a20:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     a23:	50                   	push   %eax
+     a24:	56                   	push   %esi
+     a25:	e8 51 02 00 00       	call   c7b <fstat>
+     a2a:	83 c4 10             	add    $0x10,%esp
+     a2d:	85 c0                	test   %eax,%eax
+     a2f:	0f 88 4c ff ff ff    	js     981 <bufwrite+0x30>
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+     a35:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     a3a:	74 16                	je     a52 <bufwrite+0x101>
+     a3c:	ba 03 00 00 00       	mov    $0x3,%edx
+     a41:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     a47:	89 90 e0 26 00 00    	mov    %edx,0x26e0(%eax)
+     a4d:	e9 3f ff ff ff       	jmp    991 <bufwrite+0x40>
+     a52:	ba 02 00 00 00       	mov    $0x2,%edx
+     a57:	eb e8                	jmp    a41 <bufwrite+0xf0>
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     a59:	83 ec 0c             	sub    $0xc,%esp
+     a5c:	56                   	push   %esi
+     a5d:	e8 38 fe ff ff       	call   89a <flush>
+     a62:	83 c4 10             	add    $0x10,%esp
+     a65:	85 c0                	test   %eax,%eax
+     a67:	0f 89 3e ff ff ff    	jns    9ab <bufwrite+0x5a>
+    return -1;
+     a6d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     a72:	eb 8f                	jmp    a03 <bufwrite+0xb2>
+    return write(fd, p, n);
+     a74:	83 ec 04             	sub    $0x4,%esp
+     a77:	53                   	push   %ebx
+     a78:	ff 75 0c             	push   0xc(%ebp)
+     a7b:	56                   	push   %esi
+     a7c:	e8 af 01 00 00       	call   c30 <write>
+     a81:	83 c4 10             	add    $0x10,%esp
+     a84:	e9 7a ff ff ff       	jmp    a03 <bufwrite+0xb2>
+    return flush(fd) < 0 ? -1 : n;
+     a89:	83 ec 0c             	sub    $0xc,%esp
+     a8c:	56                   	push   %esi
+     a8d:	e8 08 fe ff ff       	call   89a <flush>
+     a92:	83 c4 10             	add    $0x10,%esp
+     a95:	85 c0                	test   %eax,%eax
+     a97:	78 07                	js     aa0 <bufwrite+0x14f>
+     a99:	89 d8                	mov    %ebx,%eax
+     a9b:	e9 63 ff ff ff       	jmp    a03 <bufwrite+0xb2>
+     aa0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     aa5:	e9 59 ff ff ff       	jmp    a03 <bufwrite+0xb2>
+        return flush(fd) < 0 ? -1 : n;
+     aaa:	83 ec 0c             	sub    $0xc,%esp
+     aad:	56                   	push   %esi
+     aae:	e8 e7 fd ff ff       	call   89a <flush>
+     ab3:	83 c4 10             	add    $0x10,%esp
+     ab6:	85 c0                	test   %eax,%eax
+     ab8:	78 07                	js     ac1 <bufwrite+0x170>
+     aba:	89 d8                	mov    %ebx,%eax
+     abc:	e9 42 ff ff ff       	jmp    a03 <bufwrite+0xb2>
+     ac1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     ac6:	e9 38 ff ff ff       	jmp    a03 <bufwrite+0xb2>
+    for(s = p, i = 0; i < n; i++)
+     acb:	b8 00 00 00 00       	mov    $0x0,%eax
+     ad0:	39 d8                	cmp    %ebx,%eax
+     ad2:	7d 0e                	jge    ae2 <bufwrite+0x191>
+      if(s[i] == '\n')
+     ad4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     ad7:	80 3c 01 0a          	cmpb   $0xa,(%ecx,%eax,1)
+     adb:	74 cd                	je     aaa <bufwrite+0x159>
+    for(s = p, i = 0; i < n; i++)
+     add:	83 c0 01             	add    $0x1,%eax
+     ae0:	eb ee                	jmp    ad0 <bufwrite+0x17f>
+  return n;
+     ae2:	89 d8                	mov    %ebx,%eax
+     ae4:	e9 1a ff ff ff       	jmp    a03 <bufwrite+0xb2>
+
+00000ae9 <fork>:
+
+int
+fork(void)
+{
+     ae9:	55                   	push   %ebp
+     aea:	89 e5                	mov    %esp,%ebp
+     aec:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     aef:	6a ff                	push   $0xffffffff
+     af1:	e8 a4 fd ff ff       	call   89a <flush>
+  return _fork();
+     af6:	e8 bd 00 00 00       	call   bb8 <_fork>
+}
+     afb:	c9                   	leave
+     afc:	c3                   	ret
+
+00000afd <exit>:
+
+int
+exit(void)
+{
+     afd:	55                   	push   %ebp
+     afe:	89 e5                	mov    %esp,%ebp
+     b00:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     b03:	6a ff                	push   $0xffffffff
+     b05:	e8 90 fd ff ff       	call   89a <flush>
+  _exit();
+     b0a:	e8 b8 00 00 00       	call   bc7 <_exit>
+
+00000b0f <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     b0f:	55                   	push   %ebp
+     b10:	89 e5                	mov    %esp,%ebp
+     b12:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     b15:	6a ff                	push   $0xffffffff
+     b17:	e8 7e fd ff ff       	call   89a <flush>
+  return _exec(path, argv);
+     b1c:	83 c4 08             	add    $0x8,%esp
+     b1f:	ff 75 0c             	push   0xc(%ebp)
+     b22:	ff 75 08             	push   0x8(%ebp)
+     b25:	e8 bb 00 00 00       	call   be5 <_exec>
+}
+     b2a:	c9                   	leave
+     b2b:	c3                   	ret
+
+00000b2c <close>:
+
+int
+close(int fd)
+{
+     b2c:	55                   	push   %ebp
+     b2d:	89 e5                	mov    %esp,%ebp
+     b2f:	53                   	push   %ebx
+     b30:	83 ec 04             	sub    $0x4,%esp
+     b33:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bufreset(fd);
+     b36:	89 d8                	mov    %ebx,%eax
+     b38:	e8 e7 fd ff ff       	call   924 <bufreset>
+  return _close(fd);
+     b3d:	83 ec 0c             	sub    $0xc,%esp
+     b40:	53                   	push   %ebx
+     b41:	e8 90 00 00 00       	call   bd6 <_close>
+}
+     b46:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     b49:	c9                   	leave
+     b4a:	c3                   	ret
+
+00000b4b <stat>:
+{
+     b4b:	55                   	push   %ebp
+     b4c:	89 e5                	mov    %esp,%ebp
+     b4e:	56                   	push   %esi
+     b4f:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     b50:	83 ec 08             	sub    $0x8,%esp
+     b53:	6a 00                	push   $0x0
+     b55:	ff 75 08             	push   0x8(%ebp)
+     b58:	e8 f1 00 00 00       	call   c4e <open>
+  if(fd < 0)
+     b5d:	83 c4 10             	add    $0x10,%esp
+     b60:	85 c0                	test   %eax,%eax
+     b62:	78 24                	js     b88 <stat+0x3d>
+     b64:	89 c3                	mov    %eax,%ebx
+  r = fstat(fd, st);
+     b66:	83 ec 08             	sub    $0x8,%esp
+     b69:	ff 75 0c             	push   0xc(%ebp)
+     b6c:	50                   	push   %eax
+     b6d:	e8 09 01 00 00       	call   c7b <fstat>
+     b72:	89 c6                	mov    %eax,%esi
+  close(fd);
+     b74:	89 1c 24             	mov    %ebx,(%esp)
+     b77:	e8 b0 ff ff ff       	call   b2c <close>
+  return r;
+     b7c:	83 c4 10             	add    $0x10,%esp
+}
+     b7f:	89 f0                	mov    %esi,%eax
+     b81:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b84:	5b                   	pop    %ebx
+     b85:	5e                   	pop    %esi
+     b86:	5d                   	pop    %ebp
+     b87:	c3                   	ret
+    return -1;
+     b88:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     b8d:	eb f0                	jmp    b7f <stat+0x34>
+
+00000b8f <dup2>:
+
+int
+dup2(int oldfd, int newfd)
+{
+     b8f:	55                   	push   %ebp
+     b90:	89 e5                	mov    %esp,%ebp
+     b92:	56                   	push   %esi
+     b93:	53                   	push   %ebx
+     b94:	8b 75 08             	mov    0x8(%ebp),%esi
+     b97:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(oldfd != newfd)
+     b9a:	39 de                	cmp    %ebx,%esi
+     b9c:	75 11                	jne    baf <dup2+0x20>
+    bufreset(newfd);
+  return _dup2(oldfd, newfd);
+     b9e:	83 ec 08             	sub    $0x8,%esp
+     ba1:	53                   	push   %ebx
+     ba2:	56                   	push   %esi
+     ba3:	e8 4c 00 00 00       	call   bf4 <_dup2>
+}
+     ba8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     bab:	5b                   	pop    %ebx
+     bac:	5e                   	pop    %esi
+     bad:	5d                   	pop    %ebp
+     bae:	c3                   	ret
+    bufreset(newfd);
+     baf:	89 d8                	mov    %ebx,%eax
+     bb1:	e8 6e fd ff ff       	call   924 <bufreset>
+     bb6:	eb e6                	jmp    b9e <dup2+0xf>
+
+00000bb8 <_fork>:
+  1: ret
+
+#define SYSCALL(name) STUB(name, SYS_ ## name)
+
+# ulib.c wraps these, to flush printf()'s buffers first.
+STUB(_fork, SYS_fork)
+     bb8:	b8 01 00 00 00       	mov    $0x1,%eax
+     bbd:	89 e1                	mov    %esp,%ecx
+     bbf:	ba c6 0b 00 00       	mov    $0xbc6,%edx
+     bc4:	0f 34                	sysenter
+     bc6:	c3                   	ret
+
+00000bc7 <_exit>:
+STUB(_exit, SYS_exit)
+     bc7:	b8 02 00 00 00       	mov    $0x2,%eax
+     bcc:	89 e1                	mov    %esp,%ecx
+     bce:	ba d5 0b 00 00       	mov    $0xbd5,%edx
+     bd3:	0f 34                	sysenter
+     bd5:	c3                   	ret
+
+00000bd6 <_close>:
+STUB(_close, SYS_close)
+     bd6:	b8 15 00 00 00       	mov    $0x15,%eax
+     bdb:	89 e1                	mov    %esp,%ecx
+     bdd:	ba e4 0b 00 00       	mov    $0xbe4,%edx
+     be2:	0f 34                	sysenter
+     be4:	c3                   	ret
+
+00000be5 <_exec>:
+STUB(_exec, SYS_exec)
+     be5:	b8 07 00 00 00       	mov    $0x7,%eax
+     bea:	89 e1                	mov    %esp,%ecx
+     bec:	ba f3 0b 00 00       	mov    $0xbf3,%edx
+     bf1:	0f 34                	sysenter
+     bf3:	c3                   	ret
+
+00000bf4 <_dup2>:
+STUB(_dup2, SYS_dup2)
+     bf4:	b8 17 00 00 00       	mov    $0x17,%eax
+     bf9:	89 e1                	mov    %esp,%ecx
+     bfb:	ba 02 0c 00 00       	mov    $0xc02,%edx
+     c00:	0f 34                	sysenter
+     c02:	c3                   	ret
+
+00000c03 <wait>:
+
+SYSCALL(wait)
+     c03:	b8 03 00 00 00       	mov    $0x3,%eax
+     c08:	89 e1                	mov    %esp,%ecx
+     c0a:	ba 11 0c 00 00       	mov    $0xc11,%edx
+     c0f:	0f 34                	sysenter
+     c11:	c3                   	ret
+
+00000c12 <pipe>:
+SYSCALL(pipe)
+     c12:	b8 04 00 00 00       	mov    $0x4,%eax
+     c17:	89 e1                	mov    %esp,%ecx
+     c19:	ba 20 0c 00 00       	mov    $0xc20,%edx
+     c1e:	0f 34                	sysenter
+     c20:	c3                   	ret
+
+00000c21 <read>:
+SYSCALL(read)
+     c21:	b8 05 00 00 00       	mov    $0x5,%eax
+     c26:	89 e1                	mov    %esp,%ecx
+     c28:	ba 2f 0c 00 00       	mov    $0xc2f,%edx
+     c2d:	0f 34                	sysenter
+     c2f:	c3                   	ret
+
+00000c30 <write>:
+SYSCALL(write)
+     c30:	b8 10 00 00 00       	mov    $0x10,%eax
+     c35:	89 e1                	mov    %esp,%ecx
+     c37:	ba 3e 0c 00 00       	mov    $0xc3e,%edx
+     c3c:	0f 34                	sysenter
+     c3e:	c3                   	ret
+
+00000c3f <kill>:
+SYSCALL(kill)
+     c3f:	b8 06 00 00 00       	mov    $0x6,%eax
+     c44:	89 e1                	mov    %esp,%ecx
+     c46:	ba 4d 0c 00 00       	mov    $0xc4d,%edx
+     c4b:	0f 34                	sysenter
+     c4d:	c3                   	ret
+
+00000c4e <open>:
+SYSCALL(open)
+     c4e:	b8 0f 00 00 00       	mov    $0xf,%eax
+     c53:	89 e1                	mov    %esp,%ecx
+     c55:	ba 5c 0c 00 00       	mov    $0xc5c,%edx
+     c5a:	0f 34                	sysenter
+     c5c:	c3                   	ret
+
+00000c5d <mknod>:
+SYSCALL(mknod)
+     c5d:	b8 11 00 00 00       	mov    $0x11,%eax
+     c62:	89 e1                	mov    %esp,%ecx
+     c64:	ba 6b 0c 00 00       	mov    $0xc6b,%edx
+     c69:	0f 34                	sysenter
+     c6b:	c3                   	ret
+
+00000c6c <unlink>:
+SYSCALL(unlink)
+     c6c:	b8 12 00 00 00       	mov    $0x12,%eax
+     c71:	89 e1                	mov    %esp,%ecx
+     c73:	ba 7a 0c 00 00       	mov    $0xc7a,%edx
+     c78:	0f 34                	sysenter
+     c7a:	c3                   	ret
+
+00000c7b <fstat>:
+SYSCALL(fstat)
+     c7b:	b8 08 00 00 00       	mov    $0x8,%eax
+     c80:	89 e1                	mov    %esp,%ecx
+     c82:	ba 89 0c 00 00       	mov    $0xc89,%edx
+     c87:	0f 34                	sysenter
+     c89:	c3                   	ret
+
+00000c8a <link>:
+SYSCALL(link)
+     c8a:	b8 13 00 00 00       	mov    $0x13,%eax
+     c8f:	89 e1                	mov    %esp,%ecx
+     c91:	ba 98 0c 00 00       	mov    $0xc98,%edx
+     c96:	0f 34                	sysenter
+     c98:	c3                   	ret
+
+00000c99 <mkdir>:
+SYSCALL(mkdir)
+     c99:	b8 14 00 00 00       	mov    $0x14,%eax
+     c9e:	89 e1                	mov    %esp,%ecx
+     ca0:	ba a7 0c 00 00       	mov    $0xca7,%edx
+     ca5:	0f 34                	sysenter
+     ca7:	c3                   	ret
+
+00000ca8 <chdir>:
+SYSCALL(chdir)
+     ca8:	b8 09 00 00 00       	mov    $0x9,%eax
+     cad:	89 e1                	mov    %esp,%ecx
+     caf:	ba b6 0c 00 00       	mov    $0xcb6,%edx
+     cb4:	0f 34                	sysenter
+     cb6:	c3                   	ret
+
+00000cb7 <dup>:
+SYSCALL(dup)
+     cb7:	b8 0a 00 00 00       	mov    $0xa,%eax
+     cbc:	89 e1                	mov    %esp,%ecx
+     cbe:	ba c5 0c 00 00       	mov    $0xcc5,%edx
+     cc3:	0f 34                	sysenter
+     cc5:	c3                   	ret
+
+00000cc6 <getpid>:
+SYSCALL(getpid)
+     cc6:	b8 0b 00 00 00       	mov    $0xb,%eax
+     ccb:	89 e1                	mov    %esp,%ecx
+     ccd:	ba d4 0c 00 00       	mov    $0xcd4,%edx
+     cd2:	0f 34                	sysenter
+     cd4:	c3                   	ret
+
+00000cd5 <sbrk>:
+SYSCALL(sbrk)
+     cd5:	b8 0c 00 00 00       	mov    $0xc,%eax
+     cda:	89 e1                	mov    %esp,%ecx
+     cdc:	ba e3 0c 00 00       	mov    $0xce3,%edx
+     ce1:	0f 34                	sysenter
+     ce3:	c3                   	ret
+
+00000ce4 <sleep>:
+SYSCALL(sleep)
+     ce4:	b8 0d 00 00 00       	mov    $0xd,%eax
+     ce9:	89 e1                	mov    %esp,%ecx
+     ceb:	ba f2 0c 00 00       	mov    $0xcf2,%edx
+     cf0:	0f 34                	sysenter
+     cf2:	c3                   	ret
+
+00000cf3 <uptime>:
+SYSCALL(uptime)
+     cf3:	b8 0e 00 00 00       	mov    $0xe,%eax
+     cf8:	89 e1                	mov    %esp,%ecx
+     cfa:	ba 01 0d 00 00       	mov    $0xd01,%edx
+     cff:	0f 34                	sysenter
+     d01:	c3                   	ret
+
+00000d02 <date>:
+SYSCALL(date)
+     d02:	b8 16 00 00 00       	mov    $0x16,%eax
+     d07:	89 e1                	mov    %esp,%ecx
+     d09:	ba 10 0d 00 00       	mov    $0xd10,%edx
+     d0e:	0f 34                	sysenter
+     d10:	c3                   	ret
+
+00000d11 <faultaround>:
+SYSCALL(faultaround)
+     d11:	b8 18 00 00 00       	mov    $0x18,%eax
+     d16:	89 e1                	mov    %esp,%ecx
+     d18:	ba 1f 0d 00 00       	mov    $0xd1f,%edx
+     d1d:	0f 34                	sysenter
+     d1f:	c3                   	ret
+
+00000d20 <faultstat>:
+SYSCALL(faultstat)
+     d20:	b8 19 00 00 00       	mov    $0x19,%eax
+     d25:	89 e1                	mov    %esp,%ecx
+     d27:	ba 2e 0d 00 00       	mov    $0xd2e,%edx
+     d2c:	0f 34                	sysenter
+     d2e:	c3                   	ret
+
+00000d2f <mmap>:
+SYSCALL(mmap)
+     d2f:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     d34:	89 e1                	mov    %esp,%ecx
+     d36:	ba 3d 0d 00 00       	mov    $0xd3d,%edx
+     d3b:	0f 34                	sysenter
+     d3d:	c3                   	ret
+
+00000d3e <munmap>:
+SYSCALL(munmap)
+     d3e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     d43:	89 e1                	mov    %esp,%ecx
+     d45:	ba 4c 0d 00 00       	mov    $0xd4c,%edx
+     d4a:	0f 34                	sysenter
+     d4c:	c3                   	ret
+
+00000d4d <largepages>:
+SYSCALL(largepages)
+     d4d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     d52:	89 e1                	mov    %esp,%ecx
+     d54:	ba 5b 0d 00 00       	mov    $0xd5b,%edx
+     d59:	0f 34                	sysenter
+     d5b:	c3                   	ret
+
+00000d5c <spawn>:
+SYSCALL(spawn)
+     d5c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     d61:	89 e1                	mov    %esp,%ecx
+     d63:	ba 6a 0d 00 00       	mov    $0xd6a,%edx
+     d68:	0f 34                	sysenter
+     d6a:	c3                   	ret
+
+00000d6b <setpriority>:
+SYSCALL(setpriority)
+     d6b:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     d70:	89 e1                	mov    %esp,%ecx
+     d72:	ba 79 0d 00 00       	mov    $0xd79,%edx
+     d77:	0f 34                	sysenter
+     d79:	c3                   	ret
+
+00000d7a <getpriority>:
+SYSCALL(getpriority)
+     d7a:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     d7f:	89 e1                	mov    %esp,%ecx
+     d81:	ba 88 0d 00 00       	mov    $0xd88,%edx
+     d86:	0f 34                	sysenter
+     d88:	c3                   	ret
+
+00000d89 <getprocinfo>:
+SYSCALL(getprocinfo)
+     d89:	b8 20 00 00 00       	mov    $0x20,%eax
+     d8e:	89 e1                	mov    %esp,%ecx
+     d90:	ba 97 0d 00 00       	mov    $0xd97,%edx
+     d95:	0f 34                	sysenter
+     d97:	c3                   	ret
+
+00000d98 <getcpuinfo>:
+SYSCALL(getcpuinfo)
+     d98:	b8 21 00 00 00       	mov    $0x21,%eax
+     d9d:	89 e1                	mov    %esp,%ecx
+     d9f:	ba a6 0d 00 00       	mov    $0xda6,%edx
+     da4:	0f 34                	sysenter
+     da6:	c3                   	ret
+
+00000da7 <clone>:
+SYSCALL(clone)
+     da7:	b8 22 00 00 00       	mov    $0x22,%eax
+     dac:	89 e1                	mov    %esp,%ecx
+     dae:	ba b5 0d 00 00       	mov    $0xdb5,%edx
+     db3:	0f 34                	sysenter
+     db5:	c3                   	ret
+
+00000db6 <join>:
+SYSCALL(join)
+     db6:	b8 23 00 00 00       	mov    $0x23,%eax
+     dbb:	89 e1                	mov    %esp,%ecx
+     dbd:	ba c4 0d 00 00       	mov    $0xdc4,%edx
+     dc2:	0f 34                	sysenter
+     dc4:	c3                   	ret
+
+00000dc5 <futex_wait>:
+SYSCALL(futex_wait)
+     dc5:	b8 24 00 00 00       	mov    $0x24,%eax
+     dca:	89 e1                	mov    %esp,%ecx
+     dcc:	ba d3 0d 00 00       	mov    $0xdd3,%edx
+     dd1:	0f 34                	sysenter
+     dd3:	c3                   	ret
+
+00000dd4 <futex_wake>:
+SYSCALL(futex_wake)
+     dd4:	b8 25 00 00 00       	mov    $0x25,%eax
+     dd9:	89 e1                	mov    %esp,%ecx
+     ddb:	ba e2 0d 00 00       	mov    $0xde2,%edx
+     de0:	0f 34                	sysenter
+     de2:	c3                   	ret
+
+00000de3 <setaffinity>:
+SYSCALL(setaffinity)
+     de3:	b8 26 00 00 00       	mov    $0x26,%eax
+     de8:	89 e1                	mov    %esp,%ecx
+     dea:	ba f1 0d 00 00       	mov    $0xdf1,%edx
+     def:	0f 34                	sysenter
+     df1:	c3                   	ret
+
+00000df2 <getaffinity>:
+SYSCALL(getaffinity)
+     df2:	b8 27 00 00 00       	mov    $0x27,%eax
+     df7:	89 e1                	mov    %esp,%ecx
+     df9:	ba 00 0e 00 00       	mov    $0xe00,%edx
+     dfe:	0f 34                	sysenter
+     e00:	c3                   	ret
+
+00000e01 <clock_gettime>:
+SYSCALL(clock_gettime)
+     e01:	b8 28 00 00 00       	mov    $0x28,%eax
+     e06:	89 e1                	mov    %esp,%ecx
+     e08:	ba 0f 0e 00 00       	mov    $0xe0f,%edx
+     e0d:	0f 34                	sysenter
+     e0f:	c3                   	ret
+
+00000e10 <msleep>:
+SYSCALL(msleep)
+     e10:	b8 29 00 00 00       	mov    $0x29,%eax
+     e15:	89 e1                	mov    %esp,%ecx
+     e17:	ba 1e 0e 00 00       	mov    $0xe1e,%edx
+     e1c:	0f 34                	sysenter
+     e1e:	c3                   	ret
+
+00000e1f <lockstat>:
+SYSCALL(lockstat)
+     e1f:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     e24:	89 e1                	mov    %esp,%ecx
+     e26:	ba 2d 0e 00 00       	mov    $0xe2d,%edx
+     e2b:	0f 34                	sysenter
+     e2d:	c3                   	ret
+
+00000e2e <bstat>:
+SYSCALL(bstat)
+     e2e:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     e33:	89 e1                	mov    %esp,%ecx
+     e35:	ba 3c 0e 00 00       	mov    $0xe3c,%edx
+     e3a:	0f 34                	sysenter
+     e3c:	c3                   	ret
+
+00000e3d <iostat>:
+SYSCALL(iostat)
+     e3d:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     e42:	89 e1                	mov    %esp,%ecx
+     e44:	ba 4b 0e 00 00       	mov    $0xe4b,%edx
+     e49:	0f 34                	sysenter
+     e4b:	c3                   	ret
+
+00000e4c <fsync>:
+SYSCALL(fsync)
+     e4c:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     e51:	89 e1                	mov    %esp,%ecx
+     e53:	ba 5a 0e 00 00       	mov    $0xe5a,%edx
+     e58:	0f 34                	sysenter
+     e5a:	c3                   	ret
+
+00000e5b <pread>:
+SYSCALL(pread)
+     e5b:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     e60:	89 e1                	mov    %esp,%ecx
+     e62:	ba 69 0e 00 00       	mov    $0xe69,%edx
+     e67:	0f 34                	sysenter
+     e69:	c3                   	ret
+
+00000e6a <pwrite>:
+SYSCALL(pwrite)
+     e6a:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     e6f:	89 e1                	mov    %esp,%ecx
+     e71:	ba 78 0e 00 00       	mov    $0xe78,%edx
+     e76:	0f 34                	sysenter
+     e78:	c3                   	ret
+
+00000e79 <readv>:
+SYSCALL(readv)
+     e79:	b8 30 00 00 00       	mov    $0x30,%eax
+     e7e:	89 e1                	mov    %esp,%ecx
+     e80:	ba 87 0e 00 00       	mov    $0xe87,%edx
+     e85:	0f 34                	sysenter
+     e87:	c3                   	ret
+
+00000e88 <writev>:
+SYSCALL(writev)
+     e88:	b8 31 00 00 00       	mov    $0x31,%eax
+     e8d:	89 e1                	mov    %esp,%ecx
+     e8f:	ba 96 0e 00 00       	mov    $0xe96,%edx
+     e94:	0f 34                	sysenter
+     e96:	c3                   	ret
+
+00000e97 <sendfile>:
+SYSCALL(sendfile)
+     e97:	b8 32 00 00 00       	mov    $0x32,%eax
+     e9c:	89 e1                	mov    %esp,%ecx
+     e9e:	ba a5 0e 00 00       	mov    $0xea5,%edx
+     ea3:	0f 34                	sysenter
+     ea5:	c3                   	ret
+
+00000ea6 <fcntl>:
+SYSCALL(fcntl)
+     ea6:	b8 33 00 00 00       	mov    $0x33,%eax
+     eab:	89 e1                	mov    %esp,%ecx
+     ead:	ba b4 0e 00 00       	mov    $0xeb4,%edx
+     eb2:	0f 34                	sysenter
+     eb4:	c3                   	ret
+
+00000eb5 <mount>:
+SYSCALL(mount)
+     eb5:	b8 34 00 00 00       	mov    $0x34,%eax
+     eba:	89 e1                	mov    %esp,%ecx
+     ebc:	ba c3 0e 00 00       	mov    $0xec3,%edx
+     ec1:	0f 34                	sysenter
+     ec3:	c3                   	ret
+
+00000ec4 <getdents>:
+SYSCALL(getdents)
+     ec4:	b8 35 00 00 00       	mov    $0x35,%eax
+     ec9:	89 e1                	mov    %esp,%ecx
+     ecb:	ba d2 0e 00 00       	mov    $0xed2,%edx
+     ed0:	0f 34                	sysenter
+     ed2:	c3                   	ret
+
+00000ed3 <fstatat>:
+SYSCALL(fstatat)
+     ed3:	b8 36 00 00 00       	mov    $0x36,%eax
+     ed8:	89 e1                	mov    %esp,%ecx
+     eda:	ba e1 0e 00 00       	mov    $0xee1,%edx
+     edf:	0f 34                	sysenter
+     ee1:	c3                   	ret
+
+00000ee2 <sysstat>:
+SYSCALL(sysstat)
+     ee2:	b8 37 00 00 00       	mov    $0x37,%eax
+     ee7:	89 e1                	mov    %esp,%ecx
+     ee9:	ba f0 0e 00 00       	mov    $0xef0,%edx
+     eee:	0f 34                	sysenter
+     ef0:	c3                   	ret
+
+00000ef1 <ringenter>:
+SYSCALL(ringenter)
+     ef1:	b8 38 00 00 00       	mov    $0x38,%eax
+     ef6:	89 e1                	mov    %esp,%ecx
+     ef8:	ba ff 0e 00 00       	mov    $0xeff,%edx
+     efd:	0f 34                	sysenter
+     eff:	c3                   	ret
+
+00000f00 <trace>:
+SYSCALL(trace)
+     f00:	b8 39 00 00 00       	mov    $0x39,%eax
+     f05:	89 e1                	mov    %esp,%ecx
+     f07:	ba 0e 0f 00 00       	mov    $0xf0e,%edx
+     f0c:	0f 34                	sysenter
+     f0e:	c3                   	ret
+
+00000f0f <memstat>:
+SYSCALL(memstat)
+     f0f:	b8 3a 00 00 00       	mov    $0x3a,%eax
+     f14:	89 e1                	mov    %esp,%ecx
+     f16:	ba 1d 0f 00 00       	mov    $0xf1d,%edx
+     f1b:	0f 34                	sysenter
+     f1d:	c3                   	ret
+
+00000f1e <shmget>:
+SYSCALL(shmget)
+     f1e:	b8 3b 00 00 00       	mov    $0x3b,%eax
+     f23:	89 e1                	mov    %esp,%ecx
+     f25:	ba 2c 0f 00 00       	mov    $0xf2c,%edx
+     f2a:	0f 34                	sysenter
+     f2c:	c3                   	ret
+
+00000f2d <shmat>:
+SYSCALL(shmat)
+     f2d:	b8 3c 00 00 00       	mov    $0x3c,%eax
+     f32:	89 e1                	mov    %esp,%ecx
+     f34:	ba 3b 0f 00 00       	mov    $0xf3b,%edx
+     f39:	0f 34                	sysenter
+     f3b:	c3                   	ret
+
+00000f3c <shmdt>:
+SYSCALL(shmdt)
+     f3c:	b8 3d 00 00 00       	mov    $0x3d,%eax
+     f41:	89 e1                	mov    %esp,%ecx
+     f43:	ba 4a 0f 00 00       	mov    $0xf4a,%edx
+     f48:	0f 34                	sysenter
+     f4a:	c3                   	ret
+
+00000f4b <irqstat>:
+SYSCALL(irqstat)
+     f4b:	b8 3e 00 00 00       	mov    $0x3e,%eax
+     f50:	89 e1                	mov    %esp,%ecx
+     f52:	ba 59 0f 00 00       	mov    $0xf59,%edx
+     f57:	0f 34                	sysenter
+     f59:	c3                   	ret
+
+00000f5a <irqroute>:
+SYSCALL(irqroute)
+     f5a:	b8 3f 00 00 00       	mov    $0x3f,%eax
+     f5f:	89 e1                	mov    %esp,%ecx
+     f61:	ba 68 0f 00 00       	mov    $0xf68,%edx
+     f66:	0f 34                	sysenter
+     f68:	c3                   	ret
+
+00000f69 <putc>:
+  char buf[64];
+};
+
+static void
+putc(struct out *o, char c)
+{
+     f69:	55                   	push   %ebp
+     f6a:	89 e5                	mov    %esp,%ebp
+     f6c:	56                   	push   %esi
+     f6d:	53                   	push   %ebx
+     f6e:	89 c3                	mov    %eax,%ebx
+     f70:	89 d6                	mov    %edx,%esi
+  if(o->n == sizeof(o->buf)){
+     f72:	8b 40 04             	mov    0x4(%eax),%eax
+     f75:	83 f8 40             	cmp    $0x40,%eax
+     f78:	74 16                	je     f90 <putc+0x27>
+    bufwrite(o->fd, o->buf, o->n);
+    o->n = 0;
+  }
+  o->buf[o->n++] = c;
+     f7a:	8b 43 04             	mov    0x4(%ebx),%eax
+     f7d:	8d 50 01             	lea    0x1(%eax),%edx
+     f80:	89 53 04             	mov    %edx,0x4(%ebx)
+     f83:	89 f1                	mov    %esi,%ecx
+     f85:	88 4c 03 08          	mov    %cl,0x8(%ebx,%eax,1)
+}
+     f89:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f8c:	5b                   	pop    %ebx
+     f8d:	5e                   	pop    %esi
+     f8e:	5d                   	pop    %ebp
+     f8f:	c3                   	ret
+    bufwrite(o->fd, o->buf, o->n);
+     f90:	8d 53 08             	lea    0x8(%ebx),%edx
+     f93:	83 ec 04             	sub    $0x4,%esp
+     f96:	50                   	push   %eax
+     f97:	52                   	push   %edx
+     f98:	ff 33                	push   (%ebx)
+     f9a:	e8 b2 f9 ff ff       	call   951 <bufwrite>
+    o->n = 0;
+     f9f:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     fa6:	83 c4 10             	add    $0x10,%esp
+     fa9:	eb cf                	jmp    f7a <putc+0x11>
+
+00000fab <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     fab:	55                   	push   %ebp
+     fac:	89 e5                	mov    %esp,%ebp
+     fae:	57                   	push   %edi
+     faf:	56                   	push   %esi
+     fb0:	53                   	push   %ebx
+     fb1:	83 ec 2c             	sub    $0x2c,%esp
+     fb4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     fb7:	89 d0                	mov    %edx,%eax
+     fb9:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+     fbb:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     fbf:	0f 95 c1             	setne  %cl
+     fc2:	c1 ea 1f             	shr    $0x1f,%edx
+     fc5:	84 d1                	test   %dl,%cl
+     fc7:	74 44                	je     100d <printint+0x62>
+    neg = 1;
+    x = -xx;
+     fc9:	f7 d8                	neg    %eax
+     fcb:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+     fcd:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     fd4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+     fd9:	89 c8                	mov    %ecx,%eax
+     fdb:	ba 00 00 00 00       	mov    $0x0,%edx
+     fe0:	f7 f6                	div    %esi
+     fe2:	89 df                	mov    %ebx,%edi
+     fe4:	83 c3 01             	add    $0x1,%ebx
+     fe7:	0f b6 92 a0 18 00 00 	movzbl 0x18a0(%edx),%edx
+     fee:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+     ff2:	89 ca                	mov    %ecx,%edx
+     ff4:	89 c1                	mov    %eax,%ecx
+     ff6:	39 f2                	cmp    %esi,%edx
+     ff8:	73 df                	jae    fd9 <printint+0x2e>
+  if(neg)
+     ffa:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     ffe:	74 31                	je     1031 <printint+0x86>
+    buf[i++] = '-';
+    1000:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+    1005:	8d 5f 02             	lea    0x2(%edi),%ebx
+    1008:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    100b:	eb 17                	jmp    1024 <printint+0x79>
+    x = xx;
+    100d:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+    100f:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+    1016:	eb bc                	jmp    fd4 <printint+0x29>
+
+  while(--i >= 0)
+    putc(o, buf[i]);
+    1018:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+    101d:	89 f0                	mov    %esi,%eax
+    101f:	e8 45 ff ff ff       	call   f69 <putc>
+  while(--i >= 0)
+    1024:	83 eb 01             	sub    $0x1,%ebx
+    1027:	79 ef                	jns    1018 <printint+0x6d>
+}
+    1029:	83 c4 2c             	add    $0x2c,%esp
+    102c:	5b                   	pop    %ebx
+    102d:	5e                   	pop    %esi
+    102e:	5f                   	pop    %edi
+    102f:	5d                   	pop    %ebp
+    1030:	c3                   	ret
+    1031:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    1034:	eb ee                	jmp    1024 <printint+0x79>
+
+00001036 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1036:	55                   	push   %ebp
+    1037:	89 e5                	mov    %esp,%ebp
+    1039:	57                   	push   %edi
+    103a:	56                   	push   %esi
+    103b:	53                   	push   %ebx
+    103c:	83 ec 6c             	sub    $0x6c,%esp
+  int c, i, state;
+  uint *ap;
+  struct out out, *o;
+
+  o = &out;
+  o->fd = fd;
+    103f:	8b 45 08             	mov    0x8(%ebp),%eax
+    1042:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  o->n = 0;
+    1045:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+    104c:	8d 45 10             	lea    0x10(%ebp),%eax
+    104f:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  state = 0;
+    1052:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+    1057:	bb 00 00 00 00       	mov    $0x0,%ebx
+    105c:	eb 14                	jmp    1072 <printf+0x3c>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(o, c);
+    105e:	89 fa                	mov    %edi,%edx
+    1060:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    1063:	e8 01 ff ff ff       	call   f69 <putc>
+    1068:	eb 05                	jmp    106f <printf+0x39>
+      }
+    } else if(state == '%'){
+    106a:	83 fe 25             	cmp    $0x25,%esi
+    106d:	74 25                	je     1094 <printf+0x5e>
+  for(i = 0; fmt[i]; i++){
+    106f:	83 c3 01             	add    $0x1,%ebx
+    1072:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1075:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+    1079:	84 c0                	test   %al,%al
+    107b:	0f 84 20 01 00 00    	je     11a1 <printf+0x16b>
+    c = fmt[i] & 0xff;
+    1081:	0f be f8             	movsbl %al,%edi
+    1084:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    1087:	85 f6                	test   %esi,%esi
+    1089:	75 df                	jne    106a <printf+0x34>
+      if(c == '%'){
+    108b:	83 f8 25             	cmp    $0x25,%eax
+    108e:	75 ce                	jne    105e <printf+0x28>
+        state = '%';
+    1090:	89 c6                	mov    %eax,%esi
+    1092:	eb db                	jmp    106f <printf+0x39>
+      if(c == 'd'){
+    1094:	83 f8 25             	cmp    $0x25,%eax
+    1097:	0f 84 cf 00 00 00    	je     116c <printf+0x136>
+    109d:	0f 8c dd 00 00 00    	jl     1180 <printf+0x14a>
+    10a3:	83 f8 78             	cmp    $0x78,%eax
+    10a6:	0f 8f d4 00 00 00    	jg     1180 <printf+0x14a>
+    10ac:	83 f8 63             	cmp    $0x63,%eax
+    10af:	0f 8c cb 00 00 00    	jl     1180 <printf+0x14a>
+    10b5:	83 e8 63             	sub    $0x63,%eax
+    10b8:	83 f8 15             	cmp    $0x15,%eax
+    10bb:	0f 87 bf 00 00 00    	ja     1180 <printf+0x14a>
+    10c1:	ff 24 85 48 18 00 00 	jmp    *0x1848(,%eax,4)
+        printint(o, *ap, 10, 1);
+    10c8:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+    10cb:	8b 17                	mov    (%edi),%edx
+    10cd:	83 ec 0c             	sub    $0xc,%esp
+    10d0:	6a 01                	push   $0x1
+    10d2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    10d7:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    10da:	e8 cc fe ff ff       	call   fab <printint>
+        ap++;
+    10df:	83 c7 04             	add    $0x4,%edi
+    10e2:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+    10e5:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(o, '%');
+        putc(o, c);
+      }
+      state = 0;
+    10e8:	be 00 00 00 00       	mov    $0x0,%esi
+    10ed:	eb 80                	jmp    106f <printf+0x39>
+        printint(o, *ap, 16, 0);
+    10ef:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+    10f2:	8b 17                	mov    (%edi),%edx
+    10f4:	83 ec 0c             	sub    $0xc,%esp
+    10f7:	6a 00                	push   $0x0
+    10f9:	b9 10 00 00 00       	mov    $0x10,%ecx
+    10fe:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    1101:	e8 a5 fe ff ff       	call   fab <printint>
+        ap++;
+    1106:	83 c7 04             	add    $0x4,%edi
+    1109:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+    110c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    110f:	be 00 00 00 00       	mov    $0x0,%esi
+    1114:	e9 56 ff ff ff       	jmp    106f <printf+0x39>
+        s = (char*)*ap;
+    1119:	8b 45 94             	mov    -0x6c(%ebp),%eax
+    111c:	8b 30                	mov    (%eax),%esi
+        ap++;
+    111e:	83 c0 04             	add    $0x4,%eax
+    1121:	89 45 94             	mov    %eax,-0x6c(%ebp)
+        if(s == 0)
+    1124:	85 f6                	test   %esi,%esi
+    1126:	75 15                	jne    113d <printf+0x107>
+          s = "(null)";
+    1128:	be 40 18 00 00       	mov    $0x1840,%esi
+    112d:	eb 0e                	jmp    113d <printf+0x107>
+          putc(o, *s);
+    112f:	0f be d2             	movsbl %dl,%edx
+    1132:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    1135:	e8 2f fe ff ff       	call   f69 <putc>
+          s++;
+    113a:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+    113d:	0f b6 16             	movzbl (%esi),%edx
+    1140:	84 d2                	test   %dl,%dl
+    1142:	75 eb                	jne    112f <printf+0xf9>
+      state = 0;
+    1144:	be 00 00 00 00       	mov    $0x0,%esi
+    1149:	e9 21 ff ff ff       	jmp    106f <printf+0x39>
+        putc(o, *ap);
+    114e:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+    1151:	0f be 17             	movsbl (%edi),%edx
+    1154:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    1157:	e8 0d fe ff ff       	call   f69 <putc>
+        ap++;
+    115c:	83 c7 04             	add    $0x4,%edi
+    115f:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+      state = 0;
+    1162:	be 00 00 00 00       	mov    $0x0,%esi
+    1167:	e9 03 ff ff ff       	jmp    106f <printf+0x39>
+        putc(o, c);
+    116c:	89 fa                	mov    %edi,%edx
+    116e:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    1171:	e8 f3 fd ff ff       	call   f69 <putc>
+      state = 0;
+    1176:	be 00 00 00 00       	mov    $0x0,%esi
+    117b:	e9 ef fe ff ff       	jmp    106f <printf+0x39>
+        putc(o, '%');
+    1180:	ba 25 00 00 00       	mov    $0x25,%edx
+    1185:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    1188:	e8 dc fd ff ff       	call   f69 <putc>
+        putc(o, c);
+    118d:	89 fa                	mov    %edi,%edx
+    118f:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    1192:	e8 d2 fd ff ff       	call   f69 <putc>
+      state = 0;
+    1197:	be 00 00 00 00       	mov    $0x0,%esi
+    119c:	e9 ce fe ff ff       	jmp    106f <printf+0x39>
+    }
+  }
+  if(o->n > 0)
+    11a1:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    11a4:	85 c0                	test   %eax,%eax
+    11a6:	7f 08                	jg     11b0 <printf+0x17a>
+    bufwrite(fd, o->buf, o->n);
+}
+    11a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11ab:	5b                   	pop    %ebx
+    11ac:	5e                   	pop    %esi
+    11ad:	5f                   	pop    %edi
+    11ae:	5d                   	pop    %ebp
+    11af:	c3                   	ret
+    bufwrite(fd, o->buf, o->n);
+    11b0:	83 ec 04             	sub    $0x4,%esp
+    11b3:	50                   	push   %eax
+    11b4:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    11b7:	50                   	push   %eax
+    11b8:	ff 75 08             	push   0x8(%ebp)
+    11bb:	e8 91 f7 ff ff       	call   951 <bufwrite>
+    11c0:	83 c4 10             	add    $0x10,%esp
+}
+    11c3:	eb e3                	jmp    11a8 <printf+0x172>
+
+000011c5 <largefree>:
+  return &b->h;
+}
+
+static void
+largefree(Fblock *b)
+{
+    11c5:	55                   	push   %ebp
+    11c6:	89 e5                	mov    %esp,%ebp
+    11c8:	57                   	push   %edi
+    11c9:	56                   	push   %esi
+    11ca:	53                   	push   %ebx
+    11cb:	83 ec 0c             	sub    $0xc,%esp
+    11ce:	89 c1                	mov    %eax,%ecx
+  Fblock **pp, *p, *prev;
+
+  prev = 0;
+    11d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+    11d5:	ba 6c 47 00 00       	mov    $0x476c,%edx
+    11da:	eb 05                	jmp    11e1 <largefree+0x1c>
+    11dc:	8d 50 08             	lea    0x8(%eax),%edx
+    prev = p;
+    11df:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+    11e1:	8b 02                	mov    (%edx),%eax
+    11e3:	85 c0                	test   %eax,%eax
+    11e5:	74 04                	je     11eb <largefree+0x26>
+    11e7:	39 c8                	cmp    %ecx,%eax
+    11e9:	72 f1                	jb     11dc <largefree+0x17>
+  b->next = p;
+    11eb:	89 41 08             	mov    %eax,0x8(%ecx)
+  if(p && (char*)b + b->h.size == (char*)p){
+    11ee:	85 c0                	test   %eax,%eax
+    11f0:	74 09                	je     11fb <largefree+0x36>
+    11f2:	8b 31                	mov    (%ecx),%esi
+    11f4:	8d 3c 31             	lea    (%ecx,%esi,1),%edi
+    11f7:	39 c7                	cmp    %eax,%edi
+    11f9:	74 21                	je     121c <largefree+0x57>
+    b->h.size += p->h.size;
+    b->next = p->next;
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+    11fb:	85 db                	test   %ebx,%ebx
+    11fd:	74 09                	je     1208 <largefree+0x43>
+    11ff:	8b 03                	mov    (%ebx),%eax
+    1201:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+    1204:	39 ce                	cmp    %ecx,%esi
+    1206:	74 20                	je     1228 <largefree+0x63>
+    prev->h.size += b->h.size;
+    prev->next = b->next;
+  } else
+    *pp = b;
+    1208:	89 0a                	mov    %ecx,(%edx)
+
+  // Give the top of the heap back.  With threads sharing the
+  // address space sbrk() cannot shrink it; keep the block then.
+  for(pp = &large; (*pp)->next; pp = &(*pp)->next)
+    120a:	be 6c 47 00 00       	mov    $0x476c,%esi
+    120f:	8b 1e                	mov    (%esi),%ebx
+    1211:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+    1215:	74 1d                	je     1234 <largefree+0x6f>
+    1217:	8d 73 08             	lea    0x8(%ebx),%esi
+    121a:	eb f3                	jmp    120f <largefree+0x4a>
+    b->h.size += p->h.size;
+    121c:	03 30                	add    (%eax),%esi
+    121e:	89 31                	mov    %esi,(%ecx)
+    b->next = p->next;
+    1220:	8b 40 08             	mov    0x8(%eax),%eax
+    1223:	89 41 08             	mov    %eax,0x8(%ecx)
+    1226:	eb d3                	jmp    11fb <largefree+0x36>
+    prev->h.size += b->h.size;
+    1228:	03 01                	add    (%ecx),%eax
+    122a:	89 03                	mov    %eax,(%ebx)
+    prev->next = b->next;
+    122c:	8b 41 08             	mov    0x8(%ecx),%eax
+    122f:	89 43 08             	mov    %eax,0x8(%ebx)
+    1232:	eb d6                	jmp    120a <largefree+0x45>
+    ;
+  b = *pp;
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+    1234:	89 df                	mov    %ebx,%edi
+    1236:	03 3b                	add    (%ebx),%edi
+    1238:	83 ec 0c             	sub    $0xc,%esp
+    123b:	6a 00                	push   $0x0
+    123d:	e8 93 fa ff ff       	call   cd5 <sbrk>
+    1242:	83 c4 10             	add    $0x10,%esp
+    1245:	39 c7                	cmp    %eax,%edi
+    1247:	74 08                	je     1251 <largefree+0x8c>
+    *pp = 0;
+}
+    1249:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    124c:	5b                   	pop    %ebx
+    124d:	5e                   	pop    %esi
+    124e:	5f                   	pop    %edi
+    124f:	5d                   	pop    %ebp
+    1250:	c3                   	ret
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+    1251:	8b 03                	mov    (%ebx),%eax
+    1253:	f7 d8                	neg    %eax
+    1255:	83 ec 0c             	sub    $0xc,%esp
+    1258:	50                   	push   %eax
+    1259:	e8 77 fa ff ff       	call   cd5 <sbrk>
+    125e:	83 c4 10             	add    $0x10,%esp
+    1261:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1264:	74 e3                	je     1249 <largefree+0x84>
+    *pp = 0;
+    1266:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+    126c:	eb db                	jmp    1249 <largefree+0x84>
+
+0000126e <more>:
+{
+    126e:	55                   	push   %ebp
+    126f:	89 e5                	mov    %esp,%ebp
+    1271:	56                   	push   %esi
+    1272:	53                   	push   %ebx
+    1273:	89 c6                	mov    %eax,%esi
+  pad = -(uint)sbrk(0) & 7;
+    1275:	83 ec 0c             	sub    $0xc,%esp
+    1278:	6a 00                	push   $0x0
+    127a:	e8 56 fa ff ff       	call   cd5 <sbrk>
+    127f:	f7 d8                	neg    %eax
+    1281:	89 c3                	mov    %eax,%ebx
+    1283:	83 e3 07             	and    $0x7,%ebx
+  if((p = sbrk(n + pad)) == (char*)-1)
+    1286:	01 de                	add    %ebx,%esi
+    1288:	89 34 24             	mov    %esi,(%esp)
+    128b:	e8 45 fa ff ff       	call   cd5 <sbrk>
+    1290:	83 c4 10             	add    $0x10,%esp
+    1293:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1296:	74 09                	je     12a1 <more+0x33>
+  return p + pad;
+    1298:	01 d8                	add    %ebx,%eax
+}
+    129a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    129d:	5b                   	pop    %ebx
+    129e:	5e                   	pop    %esi
+    129f:	5d                   	pop    %ebp
+    12a0:	c3                   	ret
+    return 0;
+    12a1:	b8 00 00 00 00       	mov    $0x0,%eax
+    12a6:	eb f2                	jmp    129a <more+0x2c>
+
+000012a8 <slaballoc>:
+{
+    12a8:	55                   	push   %ebp
+    12a9:	89 e5                	mov    %esp,%ebp
+    12ab:	56                   	push   %esi
+    12ac:	53                   	push   %ebx
+    12ad:	89 c6                	mov    %eax,%esi
+  n = 1 << (MINSHIFT + c);
+    12af:	8d 48 04             	lea    0x4(%eax),%ecx
+    12b2:	bb 01 00 00 00       	mov    $0x1,%ebx
+    12b7:	d3 e3                	shl    %cl,%ebx
+  if(slab + n > slabend){
+    12b9:	89 d8                	mov    %ebx,%eax
+    12bb:	03 05 68 47 00 00    	add    0x4768,%eax
+    12c1:	39 05 64 47 00 00    	cmp    %eax,0x4764
+    12c7:	72 17                	jb     12e0 <slaballoc+0x38>
+  h = (Header*)slab;
+    12c9:	a1 68 47 00 00       	mov    0x4768,%eax
+  slab += n;
+    12ce:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+    12d1:	89 15 68 47 00 00    	mov    %edx,0x4768
+  h->size = n;
+    12d7:	89 18                	mov    %ebx,(%eax)
+  h->class = c;
+    12d9:	89 70 04             	mov    %esi,0x4(%eax)
+}
+    12dc:	5b                   	pop    %ebx
+    12dd:	5e                   	pop    %esi
+    12de:	5d                   	pop    %ebp
+    12df:	c3                   	ret
+    if((p = more(SLABSZ)) == 0)
+    12e0:	b8 00 40 00 00       	mov    $0x4000,%eax
+    12e5:	e8 84 ff ff ff       	call   126e <more>
+    12ea:	85 c0                	test   %eax,%eax
+    12ec:	74 ee                	je     12dc <slaballoc+0x34>
+    if(p != slabend)
+    12ee:	39 05 64 47 00 00    	cmp    %eax,0x4764
+    12f4:	74 05                	je     12fb <slaballoc+0x53>
+      slab = p;
+    12f6:	a3 68 47 00 00       	mov    %eax,0x4768
+    slabend = p + SLABSZ;
+    12fb:	05 00 40 00 00       	add    $0x4000,%eax
+    1300:	a3 64 47 00 00       	mov    %eax,0x4764
+    1305:	eb c2                	jmp    12c9 <slaballoc+0x21>
+
+00001307 <largealloc>:
+{
+    1307:	55                   	push   %ebp
+    1308:	89 e5                	mov    %esp,%ebp
+    130a:	56                   	push   %esi
+    130b:	53                   	push   %ebx
+    130c:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+    130e:	b9 6c 47 00 00       	mov    $0x476c,%ecx
+    1313:	8b 01                	mov    (%ecx),%eax
+    1315:	85 c0                	test   %eax,%eax
+    1317:	74 36                	je     134f <largealloc+0x48>
+    if(b->h.size < n)
+    1319:	8b 10                	mov    (%eax),%edx
+    131b:	39 da                	cmp    %ebx,%edx
+    131d:	72 24                	jb     1343 <largealloc+0x3c>
+    if(b->h.size - n > SMALLMAX){
+    131f:	29 da                	sub    %ebx,%edx
+    1321:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+    1327:	76 1f                	jbe    1348 <largealloc+0x41>
+      rest = (Fblock*)((char*)b + n);
+    1329:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+      rest->h.size = b->h.size - n;
+    132c:	89 16                	mov    %edx,(%esi)
+      rest->h.class = LARGE;
+    132e:	c7 46 04 09 00 00 00 	movl   $0x9,0x4(%esi)
+      rest->next = b->next;
+    1335:	8b 50 08             	mov    0x8(%eax),%edx
+    1338:	89 56 08             	mov    %edx,0x8(%esi)
+      *pp = rest;
+    133b:	89 31                	mov    %esi,(%ecx)
+      b->h.size = n;
+    133d:	89 18                	mov    %ebx,(%eax)
+}
+    133f:	5b                   	pop    %ebx
+    1340:	5e                   	pop    %esi
+    1341:	5d                   	pop    %ebp
+    1342:	c3                   	ret
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+    1343:	8d 48 08             	lea    0x8(%eax),%ecx
+    1346:	eb cb                	jmp    1313 <largealloc+0xc>
+      *pp = b->next;
+    1348:	8b 50 08             	mov    0x8(%eax),%edx
+    134b:	89 11                	mov    %edx,(%ecx)
+    return &b->h;
+    134d:	eb f0                	jmp    133f <largealloc+0x38>
+  if((b = more(n)) == 0)
+    134f:	89 d8                	mov    %ebx,%eax
+    1351:	e8 18 ff ff ff       	call   126e <more>
+    1356:	85 c0                	test   %eax,%eax
+    1358:	74 e5                	je     133f <largealloc+0x38>
+  b->h.size = n;
+    135a:	89 18                	mov    %ebx,(%eax)
+  b->h.class = LARGE;
+    135c:	c7 40 04 09 00 00 00 	movl   $0x9,0x4(%eax)
+  return &b->h;
+    1363:	eb da                	jmp    133f <largealloc+0x38>
+
+00001365 <free>:
+
+void
+free(void *ap)
+{
+    1365:	55                   	push   %ebp
+    1366:	89 e5                	mov    %esp,%ebp
+    1368:	56                   	push   %esi
+    1369:	53                   	push   %ebx
+    136a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+
+  if(ap == 0)
+    136d:	85 db                	test   %ebx,%ebx
+    136f:	74 3b                	je     13ac <free+0x47>
+    return;
+  h = (Header*)ap - 1;
+    1371:	8d 73 f8             	lea    -0x8(%ebx),%esi
+  lock_acquire(&lock);
+    1374:	83 ec 0c             	sub    $0xc,%esp
+    1377:	68 60 47 00 00       	push   $0x4760
+    137c:	e8 9c 01 00 00       	call   151d <lock_acquire>
+  if(h->class == LARGE)
+    1381:	8b 43 fc             	mov    -0x4(%ebx),%eax
+    1384:	83 c4 10             	add    $0x10,%esp
+    1387:	83 f8 09             	cmp    $0x9,%eax
+    138a:	74 27                	je     13b3 <free+0x4e>
+    largefree((Fblock*)h);
+  else {
+    ((Fblock*)h)->next = freelist[h->class];
+    138c:	8b 14 85 80 47 00 00 	mov    0x4780(,%eax,4),%edx
+    1393:	89 13                	mov    %edx,(%ebx)
+    freelist[h->class] = (Fblock*)h;
+    1395:	89 34 85 80 47 00 00 	mov    %esi,0x4780(,%eax,4)
+  }
+  lock_release(&lock);
+    139c:	83 ec 0c             	sub    $0xc,%esp
+    139f:	68 60 47 00 00       	push   $0x4760
+    13a4:	e8 88 01 00 00       	call   1531 <lock_release>
+    13a9:	83 c4 10             	add    $0x10,%esp
+}
+    13ac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    13af:	5b                   	pop    %ebx
+    13b0:	5e                   	pop    %esi
+    13b1:	5d                   	pop    %ebp
+    13b2:	c3                   	ret
+    largefree((Fblock*)h);
+    13b3:	89 f0                	mov    %esi,%eax
+    13b5:	e8 0b fe ff ff       	call   11c5 <largefree>
+    13ba:	eb e0                	jmp    139c <free+0x37>
+
+000013bc <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    13bc:	55                   	push   %ebp
+    13bd:	89 e5                	mov    %esp,%ebp
+    13bf:	53                   	push   %ebx
+    13c0:	83 ec 04             	sub    $0x4,%esp
+    13c3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+  uint n;
+  int c;
+
+  if(nbytes > 0x7fffffff - sizeof(Header) - 7)
+    13c6:	81 fb f0 ff ff 7f    	cmp    $0x7ffffff0,%ebx
+    13cc:	0f 87 8b 00 00 00    	ja     145d <malloc+0xa1>
+    return 0;
+  n = (nbytes + sizeof(Header) + 7) & ~7;
+    13d2:	83 c3 0f             	add    $0xf,%ebx
+    13d5:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(n < sizeof(Fblock))
+    13d8:	83 fb 0b             	cmp    $0xb,%ebx
+    13db:	77 05                	ja     13e2 <malloc+0x26>
+    n = sizeof(Fblock);
+    13dd:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  lock_acquire(&lock);
+    13e2:	83 ec 0c             	sub    $0xc,%esp
+    13e5:	68 60 47 00 00       	push   $0x4760
+    13ea:	e8 2e 01 00 00       	call   151d <lock_acquire>
+  if(n <= SMALLMAX){
+    13ef:	83 c4 10             	add    $0x10,%esp
+    13f2:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+    13f8:	77 58                	ja     1452 <malloc+0x96>
+    for(c = 0; (1 << (MINSHIFT + c)) < n; c++)
+    13fa:	ba 00 00 00 00       	mov    $0x0,%edx
+    13ff:	eb 03                	jmp    1404 <malloc+0x48>
+    1401:	83 c2 01             	add    $0x1,%edx
+    1404:	8d 4a 04             	lea    0x4(%edx),%ecx
+    1407:	b8 01 00 00 00       	mov    $0x1,%eax
+    140c:	d3 e0                	shl    %cl,%eax
+    140e:	39 d8                	cmp    %ebx,%eax
+    1410:	72 ef                	jb     1401 <malloc+0x45>
+      ;
+    if(freelist[c]){
+    1412:	8b 04 95 80 47 00 00 	mov    0x4780(,%edx,4),%eax
+    1419:	85 c0                	test   %eax,%eax
+    141b:	74 2a                	je     1447 <malloc+0x8b>
+      h = &freelist[c]->h;
+    141d:	89 c3                	mov    %eax,%ebx
+      freelist[c] = freelist[c]->next;
+    141f:	8b 40 08             	mov    0x8(%eax),%eax
+    1422:	89 04 95 80 47 00 00 	mov    %eax,0x4780(,%edx,4)
+    } else
+      h = slaballoc(c);
+  } else
+    h = largealloc(n);
+  lock_release(&lock);
+    1429:	83 ec 0c             	sub    $0xc,%esp
+    142c:	68 60 47 00 00       	push   $0x4760
+    1431:	e8 fb 00 00 00       	call   1531 <lock_release>
+  return h ? (void*)(h + 1) : 0;
+    1436:	83 c4 10             	add    $0x10,%esp
+    1439:	85 db                	test   %ebx,%ebx
+    143b:	74 03                	je     1440 <malloc+0x84>
+    143d:	83 c3 08             	add    $0x8,%ebx
+}
+    1440:	89 d8                	mov    %ebx,%eax
+    1442:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1445:	c9                   	leave
+    1446:	c3                   	ret
+      h = slaballoc(c);
+    1447:	89 d0                	mov    %edx,%eax
+    1449:	e8 5a fe ff ff       	call   12a8 <slaballoc>
+    144e:	89 c3                	mov    %eax,%ebx
+    1450:	eb d7                	jmp    1429 <malloc+0x6d>
+    h = largealloc(n);
+    1452:	89 d8                	mov    %ebx,%eax
+    1454:	e8 ae fe ff ff       	call   1307 <largealloc>
+    1459:	89 c3                	mov    %eax,%ebx
+    145b:	eb cc                	jmp    1429 <malloc+0x6d>
+    return 0;
+    145d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1462:	eb dc                	jmp    1440 <malloc+0x84>
+
+00001464 <tstart>:
+  void *arg;
+};
+
+static void
+tstart(void *a)
+{
+    1464:	55                   	push   %ebp
+    1465:	89 e5                	mov    %esp,%ebp
+    1467:	83 ec 14             	sub    $0x14,%esp
+    146a:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+    146d:	ff 70 04             	push   0x4(%eax)
+    1470:	ff 10                	call   *(%eax)
+  exit();
+    1472:	e8 86 f6 ff ff       	call   afd <exit>
+
+00001477 <thread_create>:
+}
+
+// Run fn(arg) in a new thread.  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1477:	55                   	push   %ebp
+    1478:	89 e5                	mov    %esp,%ebp
+    147a:	56                   	push   %esi
+    147b:	53                   	push   %ebx
+  struct tstart *t;
+  char *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    147c:	83 ec 0c             	sub    $0xc,%esp
+    147f:	68 00 10 00 00       	push   $0x1000
+    1484:	e8 33 ff ff ff       	call   13bc <malloc>
+    1489:	83 c4 10             	add    $0x10,%esp
+    148c:	85 c0                	test   %eax,%eax
+    148e:	74 42                	je     14d2 <thread_create+0x5b>
+    1490:	89 c3                	mov    %eax,%ebx
+    return -1;
+  t = (struct tstart*)stack;
+  t->fn = fn;
+    1492:	8b 45 08             	mov    0x8(%ebp),%eax
+    1495:	89 03                	mov    %eax,(%ebx)
+  t->arg = arg;
+    1497:	8b 45 0c             	mov    0xc(%ebp),%eax
+    149a:	89 43 04             	mov    %eax,0x4(%ebx)
+  if((pid = clone(tstart, stack + TSTACK, t)) < 0)
+    149d:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    14a3:	83 ec 04             	sub    $0x4,%esp
+    14a6:	53                   	push   %ebx
+    14a7:	50                   	push   %eax
+    14a8:	68 64 14 00 00       	push   $0x1464
+    14ad:	e8 f5 f8 ff ff       	call   da7 <clone>
+    14b2:	89 c6                	mov    %eax,%esi
+    14b4:	83 c4 10             	add    $0x10,%esp
+    14b7:	85 c0                	test   %eax,%eax
+    14b9:	78 09                	js     14c4 <thread_create+0x4d>
+    free(stack);
+  return pid;
+}
+    14bb:	89 f0                	mov    %esi,%eax
+    14bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    14c0:	5b                   	pop    %ebx
+    14c1:	5e                   	pop    %esi
+    14c2:	5d                   	pop    %ebp
+    14c3:	c3                   	ret
+    free(stack);
+    14c4:	83 ec 0c             	sub    $0xc,%esp
+    14c7:	53                   	push   %ebx
+    14c8:	e8 98 fe ff ff       	call   1365 <free>
+    14cd:	83 c4 10             	add    $0x10,%esp
+    14d0:	eb e9                	jmp    14bb <thread_create+0x44>
+    return -1;
+    14d2:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    14d7:	eb e2                	jmp    14bb <thread_create+0x44>
+
+000014d9 <thread_join>:
+
+// Wait for one of this process's threads to exit and free its
+// stack.  Returns its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+    14d9:	55                   	push   %ebp
+    14da:	89 e5                	mov    %esp,%ebp
+    14dc:	53                   	push   %ebx
+    14dd:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    14e0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    14e3:	50                   	push   %eax
+    14e4:	e8 cd f8 ff ff       	call   db6 <join>
+    14e9:	89 c3                	mov    %eax,%ebx
+    14eb:	83 c4 10             	add    $0x10,%esp
+    14ee:	85 c0                	test   %eax,%eax
+    14f0:	79 07                	jns    14f9 <thread_join+0x20>
+    free((char*)stack - TSTACK);
+  return pid;
+}
+    14f2:	89 d8                	mov    %ebx,%eax
+    14f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    14f7:	c9                   	leave
+    14f8:	c3                   	ret
+    free((char*)stack - TSTACK);
+    14f9:	83 ec 0c             	sub    $0xc,%esp
+    14fc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    14ff:	2d 00 10 00 00       	sub    $0x1000,%eax
+    1504:	50                   	push   %eax
+    1505:	e8 5b fe ff ff       	call   1365 <free>
+    150a:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    150d:	eb e3                	jmp    14f2 <thread_join+0x19>
+
+0000150f <lock_init>:
+
+void
+lock_init(lock_t *lk)
+{
+    150f:	55                   	push   %ebp
+    1510:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    1512:	8b 45 08             	mov    0x8(%ebp),%eax
+    1515:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    151b:	5d                   	pop    %ebp
+    151c:	c3                   	ret
+
+0000151d <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+    151d:	55                   	push   %ebp
+    151e:	89 e5                	mov    %esp,%ebp
+    1520:	8b 55 08             	mov    0x8(%ebp),%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    1523:	b8 01 00 00 00       	mov    $0x1,%eax
+    1528:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    152b:	85 c0                	test   %eax,%eax
+    152d:	75 f4                	jne    1523 <lock_acquire+0x6>
+    ;
+}
+    152f:	5d                   	pop    %ebp
+    1530:	c3                   	ret
+
+00001531 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+    1531:	55                   	push   %ebp
+    1532:	89 e5                	mov    %esp,%ebp
+    1534:	8b 55 08             	mov    0x8(%ebp),%edx
+    1537:	b8 00 00 00 00       	mov    $0x0,%eax
+    153c:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    153f:	5d                   	pop    %ebp
+    1540:	c3                   	ret
+
+00001541 <mutex_init>:
+// Are Tricky": state is 0 when free, 1 when held, 2 when held and
+// others may be waiting.  Unlocking an uncontended mutex costs no
+// system call.
+void
+mutex_init(mutex_t *m)
+{
+    1541:	55                   	push   %ebp
+    1542:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    1544:	8b 45 08             	mov    0x8(%ebp),%eax
+    1547:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    154d:	5d                   	pop    %ebp
+    154e:	c3                   	ret
+
+0000154f <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+    154f:	55                   	push   %ebp
+    1550:	89 e5                	mov    %esp,%ebp
+    1552:	53                   	push   %ebx
+    1553:	83 ec 04             	sub    $0x4,%esp
+    1556:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    1559:	b8 00 00 00 00       	mov    $0x0,%eax
+    155e:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1563:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    1567:	85 c0                	test   %eax,%eax
+    1569:	74 29                	je     1594 <mutex_lock+0x45>
+    return;
+  if(c != 2)
+    156b:	83 f8 02             	cmp    $0x2,%eax
+    156e:	74 20                	je     1590 <mutex_lock+0x41>
+    1570:	b8 02 00 00 00       	mov    $0x2,%eax
+    1575:	f0 87 03             	lock xchg %eax,(%ebx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    1578:	eb 16                	jmp    1590 <mutex_lock+0x41>
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    157a:	83 ec 08             	sub    $0x8,%esp
+    157d:	6a 02                	push   $0x2
+    157f:	53                   	push   %ebx
+    1580:	e8 40 f8 ff ff       	call   dc5 <futex_wait>
+  asm volatile("lock; xchgl %0, %1" :
+    1585:	b8 02 00 00 00       	mov    $0x2,%eax
+    158a:	f0 87 03             	lock xchg %eax,(%ebx)
+    158d:	83 c4 10             	add    $0x10,%esp
+  while(c != 0){
+    1590:	85 c0                	test   %eax,%eax
+    1592:	75 e6                	jne    157a <mutex_lock+0x2b>
+    c = xchg(&m->state, 2);
+  }
+}
+    1594:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1597:	c9                   	leave
+    1598:	c3                   	ret
+
+00001599 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+    1599:	55                   	push   %ebp
+    159a:	89 e5                	mov    %esp,%ebp
+    159c:	83 ec 08             	sub    $0x8,%esp
+    159f:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    15a2:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    15a7:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    15ab:	83 fa 01             	cmp    $0x1,%edx
+    15ae:	75 02                	jne    15b2 <mutex_unlock+0x19>
+    m->state = 0;
+    futex_wake(&m->state, 1);
+  }
+}
+    15b0:	c9                   	leave
+    15b1:	c3                   	ret
+    m->state = 0;
+    15b2:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+    15b8:	83 ec 08             	sub    $0x8,%esp
+    15bb:	6a 01                	push   $0x1
+    15bd:	50                   	push   %eax
+    15be:	e8 11 f8 ff ff       	call   dd4 <futex_wake>
+    15c3:	83 c4 10             	add    $0x10,%esp
+}
+    15c6:	eb e8                	jmp    15b0 <mutex_unlock+0x17>
+
+000015c8 <cond_init>:
+// Condition variable: waiters sleep on a sequence number that
+// every signal bumps, so a signal between the unlock and the
+// futex_wait() in cond_wait() is not lost.
+void
+cond_init(cond_t *c)
+{
+    15c8:	55                   	push   %ebp
+    15c9:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    15cb:	8b 45 08             	mov    0x8(%ebp),%eax
+    15ce:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    15d4:	5d                   	pop    %ebp
+    15d5:	c3                   	ret
+
+000015d6 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+    15d6:	55                   	push   %ebp
+    15d7:	89 e5                	mov    %esp,%ebp
+    15d9:	57                   	push   %edi
+    15da:	56                   	push   %esi
+    15db:	53                   	push   %ebx
+    15dc:	83 ec 18             	sub    $0x18,%esp
+    15df:	8b 75 08             	mov    0x8(%ebp),%esi
+    15e2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    15e5:	8b 3e                	mov    (%esi),%edi
+  mutex_unlock(m);
+    15e7:	53                   	push   %ebx
+    15e8:	e8 ac ff ff ff       	call   1599 <mutex_unlock>
+  futex_wait(&c->seq, seq);
+    15ed:	83 c4 08             	add    $0x8,%esp
+    15f0:	57                   	push   %edi
+    15f1:	56                   	push   %esi
+    15f2:	e8 ce f7 ff ff       	call   dc5 <futex_wait>
+  // Others may be waiting for m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+    15f7:	83 c4 10             	add    $0x10,%esp
+    15fa:	eb 0e                	jmp    160a <cond_wait+0x34>
+    futex_wait(&m->state, 2);
+    15fc:	83 ec 08             	sub    $0x8,%esp
+    15ff:	6a 02                	push   $0x2
+    1601:	53                   	push   %ebx
+    1602:	e8 be f7 ff ff       	call   dc5 <futex_wait>
+    1607:	83 c4 10             	add    $0x10,%esp
+    160a:	b8 02 00 00 00       	mov    $0x2,%eax
+    160f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    1612:	85 c0                	test   %eax,%eax
+    1614:	75 e6                	jne    15fc <cond_wait+0x26>
+}
+    1616:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1619:	5b                   	pop    %ebx
+    161a:	5e                   	pop    %esi
+    161b:	5f                   	pop    %edi
+    161c:	5d                   	pop    %ebp
+    161d:	c3                   	ret
+
+0000161e <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+    161e:	55                   	push   %ebp
+    161f:	89 e5                	mov    %esp,%ebp
+    1621:	83 ec 10             	sub    $0x10,%esp
+    1624:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    1627:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+    162b:	6a 01                	push   $0x1
+    162d:	50                   	push   %eax
+    162e:	e8 a1 f7 ff ff       	call   dd4 <futex_wake>
+}
+    1633:	83 c4 10             	add    $0x10,%esp
+    1636:	c9                   	leave
+    1637:	c3                   	ret
+
+00001638 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+    1638:	55                   	push   %ebp
+    1639:	89 e5                	mov    %esp,%ebp
+    163b:	83 ec 10             	sub    $0x10,%esp
+    163e:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    1641:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, NPROC);
+    1645:	6a 40                	push   $0x40
+    1647:	50                   	push   %eax
+    1648:	e8 87 f7 ff ff       	call   dd4 <futex_wake>
+}
+    164d:	83 c4 10             	add    $0x10,%esp
+    1650:	c9                   	leave
+    1651:	c3                   	ret
@@ -0,0 +1,157 @@
+// trace: run a command with kernel event tracing on and print the
+// events the CPUs recorded while it ran, merged in TSC order.
+// "trace -e cats cmd" records only some categories, given as
+// letters: s (scheduler switches), w (sleep and wakeup), f (page
+// faults), c (system calls), d (disk) and l (log commits); the
+// default is all of them.  Times are in thousands of TSC cycles
+// from the first event.
+#include "types.h"
+#include "user.h"
+#include "trace.h"
+
+#define MAXCPU 64
+
+static struct tracev *ev[MAXCPU];
+static int nev[MAXCPU];
+
+static int
+cats(char *s)
+{
+  int m;
+
+  for(m = 0; *s; s++){
+    switch(*s){
+    case 's': m |= TC_SCHED; break;
+    case 'w': m |= TC_SLEEP; break;
+    case 'f': m |= TC_FAULT; break;
+    case 'c': m |= TC_SYSCALL; break;
+    case 'd': m |= TC_DISK; break;
+    case 'l': m |= TC_LOG; break;
+    default: return -1;
+    }
+  }
+  return m;
+}
+
+// Take all of CPU cpu's events into ev[cpu]; or, with keep 0,
+// throw them away.  Returns -1 if there is no such CPU.
+static int
+drain(int cpu, int keep)
+{
+  static struct tracev junk[64];
+  int n;
+
+  if(keep && ev[cpu] == 0 &&
+     (ev[cpu] = malloc(NTRACE*sizeof(struct tracev))) == 0){
+    printf(2, "trace: out of memory\n");
+    exit();
+  }
+  nev[cpu] = 0;
+  do {
+    if(keep)
+      n = trace(TR_READ, cpu, ev[cpu] + nev[cpu], NTRACE - nev[cpu]);
+    else
+      n = trace(TR_READ, cpu, junk, sizeof(junk)/sizeof(junk[0]));
+    if(n < 0)
+      return -1;
+    if(keep)
+      nev[cpu] += n;
+  } while(n > 0 && (!keep || nev[cpu] < NTRACE));
+  return 0;
+}
+
+static void
+print(struct tracev *e, uint64 t0)
+{
+  printf(1, "%d\t%d\t", (uint)((e->tsc - t0) >> 10), e->cpu);
+  switch(e->type){
+  case TE_SWITCH:
+    printf(1, "switch\tpid %d\n", e->a);
+    break;
+  case TE_SLEEP:
+    printf(1, "sleep\tpid %d chan 0x%x\n", e->a, e->b);
+    break;
+  case TE_WAKEUP:
+    printf(1, "wakeup\tpid %d chan 0x%x\n", e->a, e->b);
+    break;
+  case TE_FAULT:
+    printf(1, "fault\tpid %d va 0x%x\n", e->a, e->b);
+    break;
+  case TE_SYSCALL:
+    printf(1, "syscall\tpid %d call %d\n", e->a, e->b);
+    break;
+  case TE_SYSRET:
+    printf(1, "sysret\tpid %d = %d\n", e->a, e->b);
+    break;
+  case TE_DISKREAD:
+    printf(1, "read\tblock %d +%d\n", e->a, e->b);
+    break;
+  case TE_DISKWRITE:
+    printf(1, "write\tblock %d +%d\n", e->a, e->b);
+    break;
+  case TE_DISKDONE:
+    printf(1, "done\tblock %d +%d\n", e->a, e->b);
+    break;
+  case TE_COMMIT:
+    printf(1, "commit\t%d blocks\n", e->a);
+    break;
+  default:
+    printf(1, "event %d\t%d %d\n", e->type, e->a, e->b);
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, pid, mask, ncpu, pos[MAXCPU], best;
+  uint64 t0;
+
+  mask = TC_ALL;
+  if(argc > 2 && strcmp(argv[1], "-e") == 0){
+    if((mask = cats(argv[2])) <= 0){
+      printf(2, "trace: bad categories %s\n", argv[2]);
+      exit();
+    }
+    argv += 2;
+    argc -= 2;
+  }
+  if(argc < 2){
+    printf(2, "usage: trace [-e swfcdl] cmd [arg ...]\n");
+    exit();
+  }
+
+  for(ncpu = 0; ncpu < MAXCPU && drain(ncpu, 0) == 0; ncpu++)
+    ;
+  trace(TR_ENABLE, mask, 0, 0);
+  if((pid = fork()) < 0){
+    printf(2, "trace: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    exec(argv[1], argv + 1);
+    printf(2, "trace: exec %s failed\n", argv[1]);
+    exit();
+  }
+  while(wait() >= 0)
+    ;
+  trace(TR_ENABLE, 0, 0, 0);
+
+  t0 = 0;
+  for(i = 0; i < ncpu; i++){
+    drain(i, 1);
+    pos[i] = 0;
+    if(nev[i] > 0 && (t0 == 0 || ev[i][0].tsc < t0))
+      t0 = ev[i][0].tsc;
+  }
+  for(;;){
+    best = -1;
+    for(i = 0; i < ncpu; i++)
+      if(pos[i] < nev[i] &&
+         (best < 0 || ev[i][pos[i]].tsc < ev[best][pos[best]].tsc))
+        best = i;
+    if(best < 0)
+      break;
+    print(&ev[best][pos[best]++], t0);
+  }
+  exit();
+}
@@ -0,0 +1,39 @@
+// Kernel event trace, as read out by trace().  Each CPU records
+// its events in a ring of NTRACE, the oldest overwritten first,
+// with the TSC at the time; only the categories turned on with
+// TR_ENABLE are recorded.
+
+#define NTRACE 1024            // Events in each CPU's ring
+
+// Categories, a bit each
+#define TC_SCHED   0x01        // Scheduler switches
+#define TC_SLEEP   0x02        // sleep() and wakeup()
+#define TC_FAULT   0x04        // Page faults
+#define TC_SYSCALL 0x08        // System call entry and exit
+#define TC_DISK    0x10        // Disk requests and completions
+#define TC_LOG     0x20        // Log commits
+#define TC_ALL     0x3f
+
+// Events, and what a and b are
+#define TE_SWITCH   1          // Switch to pid a
+#define TE_SLEEP    2          // pid a sleeps on chan b
+#define TE_WAKEUP   3          // pid a woken from chan b
+#define TE_FAULT    4          // pid a faults at va b
+#define TE_SYSCALL  5          // pid a calls b
+#define TE_SYSRET   6          // pid a returns b
+#define TE_DISKREAD  7         // Read b blocks from block a
+#define TE_DISKWRITE 8         // Write b blocks to block a
+#define TE_DISKDONE  9         // Done with b blocks from block a
+#define TE_COMMIT   10         // Commit a blocks
+
+struct tracev {
+  uint64 tsc;
+  ushort type;
+  ushort cpu;
+  uint a;
+  uint b;
+};
+
+// trace()'s commands
+#define TR_ENABLE  0           // Record the categories in arg; returns the old ones
+#define TR_READ    1           // Take up to n events from CPU arg's ring
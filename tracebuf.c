@@ -0,0 +1,93 @@
+// Kernel event trace.
+//
+// Each CPU has a ring of the last NTRACE events it recorded, which
+// only it writes, with interrupts off, so recording takes no lock:
+// it fills in the slot and then moves head on.  A reader (traceread(),
+// under tracelock) copies events out from its tail and checks head
+// again afterwards: if the writer has come round to the slot in the
+// meantime, the copy may be torn, and it is dropped along with the
+// others that have been overwritten.  TRACE() in defs.h checks
+// tracemask first, so a category that is off costs a load and a
+// test.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "trace.h"
+
+struct tring {
+  volatile uint head;          // Events recorded
+  uint tail;                   // Events read or lost
+  struct tracev ev[NTRACE];
+};
+
+uint tracemask;
+static struct spinlock tracelock;
+static struct tring tring[NCPU];
+
+void
+traceinit(void)
+{
+  initlock(&tracelock, "trace");
+}
+
+void
+tracerec(int type, uint a, uint b)
+{
+  struct tring *r;
+  struct tracev *e;
+
+  pushcli();
+  r = &tring[cpuid()];
+  e = &r->ev[r->head % NTRACE];
+  e->tsc = rdtsc();
+  e->type = type;
+  e->a = a;
+  e->b = b;
+  __sync_synchronize();
+  r->head++;
+  popcli();
+}
+
+// Record the categories in mask from now on.  Returns the old mask.
+int
+traceset(int mask)
+{
+  int old;
+
+  old = tracemask;
+  tracemask = mask & TC_ALL;
+  return old;
+}
+
+// Take up to n of the events in cpu's ring, oldest first, into ev.
+// Returns how many, or -1 if there is no such CPU.
+int
+traceread(int cpu, struct tracev *ev, int n)
+{
+  struct tring *r;
+  int i;
+
+  if(cpu < 0 || cpu >= ncpu || n < 0)
+    return -1;
+  r = &tring[cpu];
+  acquire(&tracelock);
+  for(i = 0; i < n && r->tail != r->head; ){
+    if(r->head - r->tail >= NTRACE){
+      r->tail = r->head - NTRACE + 1;
+      continue;
+    }
+    ev[i] = r->ev[r->tail % NTRACE];
+    __sync_synchronize();
+    if(r->head - r->tail >= NTRACE)
+      continue;
+    ev[i++].cpu = cpu;
+    r->tail++;
+  }
+  release(&tracelock);
+  return i;
+}
@@ -3,10 +3,11 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
 #include "traps.h"
-#include "spinlock.h"
+#include "trace.h"
 
 // Interrupt descriptor table (shared by all CPUs).
 struct gatedesc idt[256];
@@ -141,6 +142,16 @@ idtinit(void)
 void
 trap(struct trapframe *tf)
 {
+  int n, tick;
+
+  // A sysenter (usys.S) on a CPU without it: the same system call.
+  if(tf->trapno == T_ILLOP && (tf->cs&3) == DPL_USER && myproc() &&
+     uvmcheck(myproc(), tf->eip, 2) == 0 && *(ushort*)tf->eip == 0x340f){
+    tf->eip = tf->edx;
+    tf->esp = tf->ecx;
+    tf->trapno = T_SYSCALL;
+  }
+
   if(tf->trapno == T_SYSCALL){
     if(myproc()->killed)
       exit();
@@ -151,13 +162,26 @@ trap(struct trapframe *tf)
     return;
   }
 
+  if(tf->trapno >= T_IRQ0 && tf->trapno < T_IRQ0 + NIRQ)
+    mycpu()->nirq[tf->trapno - T_IRQ0]++;
+
+  tick = 0;
   switch(tf->trapno){
   case T_IRQ0 + IRQ_TIMER:
+    // CPU 0's one-shot timer also fires between ticks, for the
+    // timer wheel; the other CPUs' timers tick periodically.
+    tick = 1;
     if(cpuid() == 0){
-      acquire(&tickslock);
-      ticks++;
-      wakeup(&ticks);
-      release(&tickslock);
+      for(tick = n = timerintr(); n > 0; n--){
+        acquire(&tickslock);
+        ticks++;
+        release(&tickslock);
+        clocktick(ticks);
+        if(ticks % BOOSTTICKS == 0)
+          schedboost();
+        if(ticks % IRQBALANCE == 0)
+          irqbalance();
+      }
     }
     lapiceoi();
     break;
@@ -176,6 +200,14 @@ trap(struct trapframe *tf)
     uartintr();
     lapiceoi();
     break;
+  case T_IRQ0 + IRQ_RESCHED:
+    // Only needs to end a hlt in scheduler().
+    lapiceoi();
+    break;
+  case T_IRQ0 + IRQ_TLB:
+    tlback();
+    lapiceoi();
+    break;
   case T_IRQ0 + 7:
   case T_IRQ0 + IRQ_SPURIOUS:
     cprintf("cpu%d: spurious interrupt at %x:%x\n",
@@ -185,101 +217,30 @@ trap(struct trapframe *tf)
 
   //PAGEBREAK: 13
   default:
-
-    //if(myproc() == 0 || (tf->cs&3) == 0){
-
-    if(myproc() == 0){ 
+    // Page faults on user memory (lazy heap, copy-on-write, ...)
+    // are classified and handled by vmfault() in vm.c.  The kernel
+    // faults pages in before it touches them (uvmtouch() and the
+    // copies in vm.c), so it may fault only on the pinned buffers
+    // of a system call; anywhere else it is our mistake.
+    if(myproc() && tf->trapno == T_PGFLT)
+      TRACE(TC_FAULT, TE_FAULT, myproc()->pid, rcr2());
+    if(myproc() && tf->trapno == T_PGFLT &&
+       ((tf->cs&3) == DPL_USER || uvmpinned(myproc(), rcr2())) &&
+       vmfault(myproc(), rcr2(), tf->err) == 0)
+      break;
+    if(myproc() == 0 || (tf->cs&3) == 0){
       // In kernel, it must be our mistake.
       cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
               tf->trapno, cpuid(), tf->eip, rcr2());
       panic("trap");
     }
-    
-    // cs selector de segmento de codigo de usuario 
-    else if ((tf->cs&3) == 0){ 
-
-		//Vemos si el valor de la página que provocó el fallo se corresponde con la página inaccesible que habíamos guardado
-		if ( PGROUNDDOWN(rcr2()) == myproc()->paginaInvalida ){ 
-			myproc()->killed = 1; //Matamos el proceso si lo es
-			break;
-	    	}
-
-		// Intentamos reservar una página de 4096 bytes de memoria física
-		char *bloque = kalloc();
-
-		
-        	if (bloque==0){ // Si no queda memoria para asignarle al proceso, lo eliminamos
-                	cprintf("Out of memory\n");
-       			myproc()->killed = 1;
-		   	break;
-            	}
-
-		// Limpiamos la página inicializandola a 0
-	   	memset(bloque, 0, PGSIZE);
-
-
-		//Mapeamos la página de memoria fisica reservada a la pagina virtual que ha dado el fallo
-	    	if (mappages(myproc()->pgdir, (char*)PGROUNDDOWN(rcr2()), PGSIZE, V2P(bloque), PTE_W|PTE_U) < 0){
-			cprintf("Out of memory (2)\n");
-			myproc()->killed = 1; //Si no es posible, matamos el proceso
-			kfree(bloque); // liberamos la memoria que habiamos reservado
-			break;
-	   	}
-
-    }
-
-    // Si la excep, ha sido la de fallo de pagina (T_PGFLT)
-    // -> mapeo la dir.virtual a una nueva pagina fisica
-    else if (tf->trapno == T_PGFLT){
-
-		// Ejercicio 1 -clase
-		//char* bloque = kalloc();
-		//mappages(myproc()->pgdir, (void*)PGROUNDDOWN(rcr2()), PGSIZE, V2P(bloque), PTE_W|PTE_U);
-
-
-		//Vemos si el valor de la página que provocó el fallo se corresponde con la página inaccesible que habíamos guardado
-		if ( PGROUNDDOWN(rcr2()) == myproc()->paginaInvalida ){ 
-			myproc()->killed = 1; //Matamos el proceso si lo es
-			break;
-	    	}
-
-
-		// Intentamos reservar una página de 4096 bytes de memoria física
-		char *bloque = kalloc();
-
-		
-        	if (bloque==0){ // Si no queda memoria para asignarle al proceso, lo eliminamos
-                	cprintf("Out of memory\n");
-       			myproc()->killed = 1;
-		   	break;
-            	}
-
-		// Limpiamos la página inicializandola a 0
-	   	memset(bloque, 0, PGSIZE);
-
-
-		//Mapeamos la página de memoria fisica reservada a la pagina virtual que ha dado el fallo
-	    	if (mappages(myproc()->pgdir, (char*)PGROUNDDOWN(rcr2()), PGSIZE, V2P(bloque), PTE_W|PTE_U) < 0){
-			cprintf("Out of memory (2)\n");
-			myproc()->killed = 1; //Si no es posible, matamos el proceso
-			kfree(bloque); // liberamos la memoria que habiamos reservado
-			break;
-	   	}
-
-
-         }//else if (tf->trapno == T_PGFLT)
-
-	 // In user space, assume process misbehaved.
-         else{
-    		cprintf("pid %d %s: trap %d err %d on cpu %d "
-            	"eip 0x%x addr 0x%x--kill proc\n",
-            	myproc()->pid, myproc()->name, tf->trapno,
-            	tf->err, cpuid(), tf->eip, rcr2());
-    		myproc()->killed = 1;
-		break;
-         }
-
-  }//else if
+    // In user space, assume process misbehaved.
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+            "eip 0x%x addr 0x%x--kill proc\n",
+            myproc()->pid, myproc()->name, tf->trapno,
+            tf->err, cpuid(), tf->eip, rcr2());
+    myproc()->killed = 1;
+  }
 
 
 
@@ -291,9 +252,8 @@ trap(struct trapframe *tf)
 
   // Force process to give up CPU on clock tick.
   // If interrupts were on while locks held, would need to check nlock.
-  if(myproc() && myproc()->state == RUNNING &&
-     tf->trapno == T_IRQ0+IRQ_TIMER)
-    yield();
+  if(myproc() && myproc()->state == RUNNING && tick)
+    schedtick();
 
   // Check if the process has been killed since we yielded
   if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
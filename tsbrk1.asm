@@ -0,0 +1,2785 @@
+
+_tsbrk1:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "types.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	56                   	push   %esi
+       e:	53                   	push   %ebx
+       f:	51                   	push   %ecx
+      10:	83 ec 18             	sub    $0x18,%esp
+  char* a = sbrk (15000);
+      13:	68 98 3a 00 00       	push   $0x3a98
+      18:	e8 bb 08 00 00       	call   8d8 <sbrk>
+      1d:	89 c3                	mov    %eax,%ebx
+
+  a[500] = 1;
+      1f:	c6 80 f4 01 00 00 01 	movb   $0x1,0x1f4(%eax)
+
+  if ((uint)a + 15000 != (uint) sbrk (-15000))
+      26:	8d b0 98 3a 00 00    	lea    0x3a98(%eax),%esi
+      2c:	c7 04 24 68 c5 ff ff 	movl   $0xffffc568,(%esp)
+      33:	e8 a0 08 00 00       	call   8d8 <sbrk>
+      38:	83 c4 10             	add    $0x10,%esp
+      3b:	39 c6                	cmp    %eax,%esi
+      3d:	74 14                	je     53 <main+0x53>
+  {
+    printf (1, "sbrk() con número positivo falló.\n");
+      3f:	83 ec 08             	sub    $0x8,%esp
+      42:	68 58 12 00 00       	push   $0x1258
+      47:	6a 01                	push   $0x1
+      49:	e8 eb 0b 00 00       	call   c39 <printf>
+    exit();
+      4e:	e8 ad 06 00 00       	call   700 <exit>
+  }
+
+  if (a != sbrk (0))
+      53:	83 ec 0c             	sub    $0xc,%esp
+      56:	6a 00                	push   $0x0
+      58:	e8 7b 08 00 00       	call   8d8 <sbrk>
+      5d:	83 c4 10             	add    $0x10,%esp
+      60:	39 c3                	cmp    %eax,%ebx
+      62:	74 14                	je     78 <main+0x78>
+  {
+    printf (1, "sbrk() con cero falló.\n");
+      64:	83 ec 08             	sub    $0x8,%esp
+      67:	68 7d 12 00 00       	push   $0x127d
+      6c:	6a 01                	push   $0x1
+      6e:	e8 c6 0b 00 00       	call   c39 <printf>
+    exit();
+      73:	e8 88 06 00 00       	call   700 <exit>
+  }
+
+  if (a != sbrk (15000))
+      78:	83 ec 0c             	sub    $0xc,%esp
+      7b:	68 98 3a 00 00       	push   $0x3a98
+      80:	e8 53 08 00 00       	call   8d8 <sbrk>
+      85:	83 c4 10             	add    $0x10,%esp
+      88:	39 c3                	cmp    %eax,%ebx
+      8a:	74 14                	je     a0 <main+0xa0>
+  {
+    printf (1, "sbrk() negativo falló.\n");
+      8c:	83 ec 08             	sub    $0x8,%esp
+      8f:	68 96 12 00 00       	push   $0x1296
+      94:	6a 01                	push   $0x1
+      96:	e8 9e 0b 00 00       	call   c39 <printf>
+    exit();
+      9b:	e8 60 06 00 00       	call   700 <exit>
+  }
+
+  printf (1, "Debe imprimir 1: %d.\n", ++a[500]);
+      a0:	0f b6 83 f4 01 00 00 	movzbl 0x1f4(%ebx),%eax
+      a7:	83 c0 01             	add    $0x1,%eax
+      aa:	88 83 f4 01 00 00    	mov    %al,0x1f4(%ebx)
+      b0:	83 ec 04             	sub    $0x4,%esp
+      b3:	0f be c0             	movsbl %al,%eax
+      b6:	50                   	push   %eax
+      b7:	68 af 12 00 00       	push   $0x12af
+      bc:	6a 01                	push   $0x1
+      be:	e8 76 0b 00 00       	call   c39 <printf>
+
+  exit();
+      c3:	e8 38 06 00 00       	call   700 <exit>
+
+000000c8 <strcpy>:
+#include "memlayout.h"
+#include "clock.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+      c8:	55                   	push   %ebp
+      c9:	89 e5                	mov    %esp,%ebp
+      cb:	56                   	push   %esi
+      cc:	53                   	push   %ebx
+      cd:	8b 75 08             	mov    0x8(%ebp),%esi
+      d0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+      d3:	89 f0                	mov    %esi,%eax
+      d5:	89 d1                	mov    %edx,%ecx
+      d7:	83 c2 01             	add    $0x1,%edx
+      da:	89 c3                	mov    %eax,%ebx
+      dc:	83 c0 01             	add    $0x1,%eax
+      df:	0f b6 09             	movzbl (%ecx),%ecx
+      e2:	88 0b                	mov    %cl,(%ebx)
+      e4:	84 c9                	test   %cl,%cl
+      e6:	75 ed                	jne    d5 <strcpy+0xd>
+    ;
+  return os;
+}
+      e8:	89 f0                	mov    %esi,%eax
+      ea:	5b                   	pop    %ebx
+      eb:	5e                   	pop    %esi
+      ec:	5d                   	pop    %ebp
+      ed:	c3                   	ret
+
+000000ee <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+      ee:	55                   	push   %ebp
+      ef:	89 e5                	mov    %esp,%ebp
+      f1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      f4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+      f7:	eb 06                	jmp    ff <strcmp+0x11>
+    p++, q++;
+      f9:	83 c1 01             	add    $0x1,%ecx
+      fc:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+      ff:	0f b6 01             	movzbl (%ecx),%eax
+     102:	84 c0                	test   %al,%al
+     104:	74 04                	je     10a <strcmp+0x1c>
+     106:	3a 02                	cmp    (%edx),%al
+     108:	74 ef                	je     f9 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+     10a:	0f b6 c0             	movzbl %al,%eax
+     10d:	0f b6 12             	movzbl (%edx),%edx
+     110:	29 d0                	sub    %edx,%eax
+}
+     112:	5d                   	pop    %ebp
+     113:	c3                   	ret
+
+00000114 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     114:	55                   	push   %ebp
+     115:	89 e5                	mov    %esp,%ebp
+     117:	53                   	push   %ebx
+     118:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  const char *p;
+  uint w;
+
+  for(p = s; (uint)p & 3; p++)
+     11b:	89 c8                	mov    %ecx,%eax
+     11d:	eb 03                	jmp    122 <strlen+0xe>
+     11f:	83 c0 01             	add    $0x1,%eax
+     122:	a8 03                	test   $0x3,%al
+     124:	74 09                	je     12f <strlen+0x1b>
+    if(*p == 0)
+     126:	80 38 00             	cmpb   $0x0,(%eax)
+     129:	75 f4                	jne    11f <strlen+0xb>
+      return p - s;
+     12b:	29 c8                	sub    %ecx,%eax
+     12d:	eb 25                	jmp    154 <strlen+0x40>
+  // Then a word at a time, which never crosses into the next page:
+  // a word with a zero byte in it has one of these bits set.
+  for(;; p += 4){
+    w = *(uint*)p;
+     12f:	8b 10                	mov    (%eax),%edx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     131:	8d 9a ff fe fe fe    	lea    -0x1010101(%edx),%ebx
+     137:	f7 d2                	not    %edx
+     139:	21 da                	and    %ebx,%edx
+     13b:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+     141:	75 05                	jne    148 <strlen+0x34>
+  for(;; p += 4){
+     143:	83 c0 04             	add    $0x4,%eax
+    w = *(uint*)p;
+     146:	eb e7                	jmp    12f <strlen+0x1b>
+      break;
+  }
+  while(*p)
+     148:	80 38 00             	cmpb   $0x0,(%eax)
+     14b:	74 05                	je     152 <strlen+0x3e>
+    p++;
+     14d:	83 c0 01             	add    $0x1,%eax
+     150:	eb f6                	jmp    148 <strlen+0x34>
+  return p - s;
+     152:	29 c8                	sub    %ecx,%eax
+}
+     154:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     157:	c9                   	leave
+     158:	c3                   	ret
+
+00000159 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     159:	55                   	push   %ebp
+     15a:	89 e5                	mov    %esp,%ebp
+     15c:	57                   	push   %edi
+     15d:	56                   	push   %esi
+     15e:	53                   	push   %ebx
+     15f:	8b 55 10             	mov    0x10(%ebp),%edx
+  uint h;
+  char *d;
+
+  d = dst;
+  c &= 0xFF;
+     162:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  if(n >= 16){
+     166:	83 fa 0f             	cmp    $0xf,%edx
+     169:	76 52                	jbe    1bd <memset+0x64>
+    h = -(uint)d & 3;
+     16b:	8b 45 08             	mov    0x8(%ebp),%eax
+     16e:	f7 d8                	neg    %eax
+     170:	83 e0 03             	and    $0x3,%eax
+     173:	89 c6                	mov    %eax,%esi
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     175:	8b 7d 08             	mov    0x8(%ebp),%edi
+     178:	89 c1                	mov    %eax,%ecx
+     17a:	89 d8                	mov    %ebx,%eax
+     17c:	fc                   	cld
+     17d:	f3 aa                	rep stos %al,%es:(%edi)
+    stosb(d, c, h);
+    stosl(d + h, (c<<24)|(c<<16)|(c<<8)|c, (n - h)/4);
+     17f:	29 f2                	sub    %esi,%edx
+     181:	89 d1                	mov    %edx,%ecx
+     183:	c1 e9 02             	shr    $0x2,%ecx
+     186:	c1 e0 18             	shl    $0x18,%eax
+     189:	89 df                	mov    %ebx,%edi
+     18b:	c1 e7 10             	shl    $0x10,%edi
+     18e:	09 f8                	or     %edi,%eax
+     190:	89 df                	mov    %ebx,%edi
+     192:	c1 e7 08             	shl    $0x8,%edi
+     195:	09 f8                	or     %edi,%eax
+     197:	09 d8                	or     %ebx,%eax
+     199:	89 f7                	mov    %esi,%edi
+     19b:	03 7d 08             	add    0x8(%ebp),%edi
+}
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosl" :
+     19e:	fc                   	cld
+     19f:	f3 ab                	rep stos %eax,%es:(%edi)
+    d += h + (n - h)/4*4;
+     1a1:	89 d7                	mov    %edx,%edi
+     1a3:	83 e7 fc             	and    $0xfffffffc,%edi
+     1a6:	09 f7                	or     %esi,%edi
+     1a8:	03 7d 08             	add    0x8(%ebp),%edi
+    n = (n - h)%4;
+     1ab:	83 e2 03             	and    $0x3,%edx
+  asm volatile("cld; rep stosb" :
+     1ae:	89 d1                	mov    %edx,%ecx
+     1b0:	89 d8                	mov    %ebx,%eax
+     1b2:	fc                   	cld
+     1b3:	f3 aa                	rep stos %al,%es:(%edi)
+  }
+  stosb(d, c, n);
+  return dst;
+}
+     1b5:	8b 45 08             	mov    0x8(%ebp),%eax
+     1b8:	5b                   	pop    %ebx
+     1b9:	5e                   	pop    %esi
+     1ba:	5f                   	pop    %edi
+     1bb:	5d                   	pop    %ebp
+     1bc:	c3                   	ret
+  d = dst;
+     1bd:	8b 7d 08             	mov    0x8(%ebp),%edi
+     1c0:	eb ec                	jmp    1ae <memset+0x55>
+
+000001c2 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     1c2:	55                   	push   %ebp
+     1c3:	89 e5                	mov    %esp,%ebp
+     1c5:	8b 45 08             	mov    0x8(%ebp),%eax
+     1c8:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     1cc:	eb 03                	jmp    1d1 <strchr+0xf>
+     1ce:	83 c0 01             	add    $0x1,%eax
+     1d1:	0f b6 10             	movzbl (%eax),%edx
+     1d4:	84 d2                	test   %dl,%dl
+     1d6:	74 06                	je     1de <strchr+0x1c>
+    if(*s == c)
+     1d8:	38 ca                	cmp    %cl,%dl
+     1da:	75 f2                	jne    1ce <strchr+0xc>
+     1dc:	eb 05                	jmp    1e3 <strchr+0x21>
+      return (char*)s;
+  return 0;
+     1de:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     1e3:	5d                   	pop    %ebp
+     1e4:	c3                   	ret
+
+000001e5 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     1e5:	55                   	push   %ebp
+     1e6:	89 e5                	mov    %esp,%ebp
+     1e8:	56                   	push   %esi
+     1e9:	53                   	push   %ebx
+     1ea:	8b 55 08             	mov    0x8(%ebp),%edx
+     1ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     1f0:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  // A word at a time while they agree.
+  if((((uint)s1 | (uint)s2) & 3) == 0)
+     1f3:	89 d3                	mov    %edx,%ebx
+     1f5:	09 cb                	or     %ecx,%ebx
+     1f7:	f6 c3 03             	test   $0x3,%bl
+     1fa:	74 24                	je     220 <memcmp+0x3b>
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+      s1 += 4, s2 += 4;
+  while(n-- > 0){
+     1fc:	8d 70 ff             	lea    -0x1(%eax),%esi
+     1ff:	85 c0                	test   %eax,%eax
+     201:	74 32                	je     235 <memcmp+0x50>
+    if(*s1 != *s2)
+     203:	0f b6 02             	movzbl (%edx),%eax
+     206:	0f b6 19             	movzbl (%ecx),%ebx
+     209:	38 d8                	cmp    %bl,%al
+     20b:	75 20                	jne    22d <memcmp+0x48>
+      return *s1 - *s2;
+    s1++, s2++;
+     20d:	83 c2 01             	add    $0x1,%edx
+     210:	83 c1 01             	add    $0x1,%ecx
+  while(n-- > 0){
+     213:	89 f0                	mov    %esi,%eax
+     215:	eb e5                	jmp    1fc <memcmp+0x17>
+      s1 += 4, s2 += 4;
+     217:	83 c2 04             	add    $0x4,%edx
+     21a:	83 c1 04             	add    $0x4,%ecx
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+     21d:	83 e8 04             	sub    $0x4,%eax
+     220:	83 f8 03             	cmp    $0x3,%eax
+     223:	76 d7                	jbe    1fc <memcmp+0x17>
+     225:	8b 31                	mov    (%ecx),%esi
+     227:	39 32                	cmp    %esi,(%edx)
+     229:	74 ec                	je     217 <memcmp+0x32>
+     22b:	eb cf                	jmp    1fc <memcmp+0x17>
+      return *s1 - *s2;
+     22d:	0f b6 c0             	movzbl %al,%eax
+     230:	0f b6 db             	movzbl %bl,%ebx
+     233:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     235:	5b                   	pop    %ebx
+     236:	5e                   	pop    %esi
+     237:	5d                   	pop    %ebp
+     238:	c3                   	ret
+
+00000239 <memchr>:
+// The first c in the n bytes at v, or 0.  Once aligned, a word at
+// a time, with the word's bytes that equal c turned into zeroes
+// and those looked for.
+void*
+memchr(const void *v, int c, uint n)
+{
+     239:	55                   	push   %ebp
+     23a:	89 e5                	mov    %esp,%ebp
+     23c:	57                   	push   %edi
+     23d:	56                   	push   %esi
+     23e:	53                   	push   %ebx
+     23f:	8b 45 08             	mov    0x8(%ebp),%eax
+     242:	8b 55 10             	mov    0x10(%ebp),%edx
+  const uchar *s;
+  uint w, rep;
+
+  s = v;
+  c = (uchar)c;
+     245:	0f b6 75 0c          	movzbl 0xc(%ebp),%esi
+  for(; n > 0 && ((uint)s & 3); n--, s++)
+     249:	eb 06                	jmp    251 <memchr+0x18>
+     24b:	83 ea 01             	sub    $0x1,%edx
+     24e:	83 c0 01             	add    $0x1,%eax
+     251:	85 d2                	test   %edx,%edx
+     253:	74 0d                	je     262 <memchr+0x29>
+     255:	a8 03                	test   $0x3,%al
+     257:	74 09                	je     262 <memchr+0x29>
+    if(*s == c)
+     259:	0f b6 08             	movzbl (%eax),%ecx
+     25c:	39 f1                	cmp    %esi,%ecx
+     25e:	75 eb                	jne    24b <memchr+0x12>
+     260:	eb 41                	jmp    2a3 <memchr+0x6a>
+      return (void*)s;
+  rep = c * 0x01010101;
+     262:	69 fe 01 01 01 01    	imul   $0x1010101,%esi,%edi
+  for(; n >= 4; n -= 4, s += 4){
+     268:	eb 06                	jmp    270 <memchr+0x37>
+     26a:	83 ea 04             	sub    $0x4,%edx
+     26d:	83 c0 04             	add    $0x4,%eax
+     270:	83 fa 03             	cmp    $0x3,%edx
+     273:	76 16                	jbe    28b <memchr+0x52>
+    w = *(uint*)s ^ rep;
+     275:	89 f9                	mov    %edi,%ecx
+     277:	33 08                	xor    (%eax),%ecx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     279:	8d 99 ff fe fe fe    	lea    -0x1010101(%ecx),%ebx
+     27f:	f7 d1                	not    %ecx
+     281:	21 cb                	and    %ecx,%ebx
+     283:	f7 c3 80 80 80 80    	test   $0x80808080,%ebx
+     289:	74 df                	je     26a <memchr+0x31>
+      break;
+  }
+  for(; n > 0; n--, s++)
+     28b:	85 d2                	test   %edx,%edx
+     28d:	74 0f                	je     29e <memchr+0x65>
+    if(*s == c)
+     28f:	0f b6 08             	movzbl (%eax),%ecx
+     292:	39 f1                	cmp    %esi,%ecx
+     294:	74 0d                	je     2a3 <memchr+0x6a>
+  for(; n > 0; n--, s++)
+     296:	83 ea 01             	sub    $0x1,%edx
+     299:	83 c0 01             	add    $0x1,%eax
+     29c:	eb ed                	jmp    28b <memchr+0x52>
+      return (void*)s;
+  return 0;
+     29e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     2a3:	5b                   	pop    %ebx
+     2a4:	5e                   	pop    %esi
+     2a5:	5f                   	pop    %edi
+     2a6:	5d                   	pop    %ebp
+     2a7:	c3                   	ret
+
+000002a8 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     2a8:	55                   	push   %ebp
+     2a9:	89 e5                	mov    %esp,%ebp
+     2ab:	57                   	push   %edi
+     2ac:	56                   	push   %esi
+     2ad:	53                   	push   %ebx
+     2ae:	83 ec 1c             	sub    $0x1c,%esp
+     2b1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     2b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+     2b9:	89 de                	mov    %ebx,%esi
+     2bb:	83 c3 01             	add    $0x1,%ebx
+     2be:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     2c1:	7d 2e                	jge    2f1 <gets+0x49>
+    cc = read(0, &c, 1);
+     2c3:	83 ec 04             	sub    $0x4,%esp
+     2c6:	6a 01                	push   $0x1
+     2c8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     2cb:	50                   	push   %eax
+     2cc:	6a 00                	push   $0x0
+     2ce:	e8 51 05 00 00       	call   824 <read>
+    if(cc < 1)
+     2d3:	83 c4 10             	add    $0x10,%esp
+     2d6:	85 c0                	test   %eax,%eax
+     2d8:	7e 17                	jle    2f1 <gets+0x49>
+      break;
+    buf[i++] = c;
+     2da:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     2de:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+     2e1:	3c 0a                	cmp    $0xa,%al
+     2e3:	0f 94 c2             	sete   %dl
+     2e6:	3c 0d                	cmp    $0xd,%al
+     2e8:	0f 94 c0             	sete   %al
+     2eb:	08 c2                	or     %al,%dl
+     2ed:	74 ca                	je     2b9 <gets+0x11>
+    buf[i++] = c;
+     2ef:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+     2f1:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+     2f5:	89 f8                	mov    %edi,%eax
+     2f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     2fa:	5b                   	pop    %ebx
+     2fb:	5e                   	pop    %esi
+     2fc:	5f                   	pop    %edi
+     2fd:	5d                   	pop    %ebp
+     2fe:	c3                   	ret
+
+000002ff <atoi>:
+  return r;
+}
+
+int
+atoi(const char *s)
+{
+     2ff:	55                   	push   %ebp
+     300:	89 e5                	mov    %esp,%ebp
+     302:	53                   	push   %ebx
+     303:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+     306:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+     30b:	eb 10                	jmp    31d <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+     30d:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+     310:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+     313:	83 c1 01             	add    $0x1,%ecx
+     316:	0f be c0             	movsbl %al,%eax
+     319:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+     31d:	0f b6 01             	movzbl (%ecx),%eax
+     320:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     323:	80 fb 09             	cmp    $0x9,%bl
+     326:	76 e5                	jbe    30d <atoi+0xe>
+  return n;
+}
+     328:	89 d0                	mov    %edx,%eax
+     32a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     32d:	c9                   	leave
+     32e:	c3                   	ret
+
+0000032f <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     32f:	55                   	push   %ebp
+     330:	89 e5                	mov    %esp,%ebp
+     332:	57                   	push   %edi
+     333:	56                   	push   %esi
+     334:	53                   	push   %ebx
+     335:	83 ec 08             	sub    $0x8,%esp
+     338:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     33b:	8b 55 0c             	mov    0xc(%ebp),%edx
+     33e:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *src;
+  int h;
+
+  dst = vdst;
+  src = vsrc;
+  if(n <= 0)
+     341:	85 c0                	test   %eax,%eax
+     343:	0f 8e 82 00 00 00    	jle    3cb <memmove+0x9c>
+    return vdst;
+  if(src < dst && src + n > dst){
+     349:	39 da                	cmp    %ebx,%edx
+     34b:	73 07                	jae    354 <memmove+0x25>
+     34d:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+     350:	39 cb                	cmp    %ecx,%ebx
+     352:	72 5e                	jb     3b2 <memmove+0x83>
+    movsbback(dst + n - 1, src + n - 1, n);
+    return vdst;
+  }
+  if(n >= 16 && (((uint)dst ^ (uint)src) & 3) == 0){
+     354:	83 f8 0f             	cmp    $0xf,%eax
+     357:	7e 69                	jle    3c2 <memmove+0x93>
+     359:	89 d9                	mov    %ebx,%ecx
+     35b:	31 d1                	xor    %edx,%ecx
+     35d:	f6 c1 03             	test   $0x3,%cl
+     360:	75 73                	jne    3d5 <memmove+0xa6>
+    h = -(uint)dst & 3;
+     362:	89 d9                	mov    %ebx,%ecx
+     364:	f7 d9                	neg    %ecx
+     366:	83 e1 03             	and    $0x3,%ecx
+}
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsb" :
+     369:	89 df                	mov    %ebx,%edi
+     36b:	89 d6                	mov    %edx,%esi
+     36d:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+     370:	fc                   	cld
+     371:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    movsb(dst, src, h);
+    dst += h, src += h, n -= h;
+     373:	8b 75 f0             	mov    -0x10(%ebp),%esi
+     376:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+     379:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+     37c:	29 f0                	sub    %esi,%eax
+    movsl(dst, src, n/4);
+     37e:	8d 50 03             	lea    0x3(%eax),%edx
+     381:	0f 49 d0             	cmovns %eax,%edx
+     384:	c1 fa 02             	sar    $0x2,%edx
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+     387:	89 7d f0             	mov    %edi,-0x10(%ebp)
+     38a:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     38d:	89 ce                	mov    %ecx,%esi
+     38f:	89 d1                	mov    %edx,%ecx
+     391:	fc                   	cld
+     392:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    dst += n/4*4, src += n/4*4, n %= 4;
+     394:	c1 e2 02             	shl    $0x2,%edx
+     397:	8b 7d f0             	mov    -0x10(%ebp),%edi
+     39a:	01 d7                	add    %edx,%edi
+     39c:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     39f:	01 ca                	add    %ecx,%edx
+     3a1:	89 c6                	mov    %eax,%esi
+     3a3:	c1 fe 1f             	sar    $0x1f,%esi
+     3a6:	c1 ee 1e             	shr    $0x1e,%esi
+     3a9:	01 f0                	add    %esi,%eax
+     3ab:	83 e0 03             	and    $0x3,%eax
+     3ae:	29 f0                	sub    %esi,%eax
+     3b0:	eb 12                	jmp    3c4 <memmove+0x95>
+    movsbback(dst + n - 1, src + n - 1, n);
+     3b2:	8d 78 ff             	lea    -0x1(%eax),%edi
+     3b5:	8d 34 3a             	lea    (%edx,%edi,1),%esi
+     3b8:	01 df                	add    %ebx,%edi
+// Copy cnt bytes down from the last ones, at dst and src, to the
+// first: for overlapping moves up.
+static inline void
+movsbback(void *dst, const void *src, int cnt)
+{
+  asm volatile("std; rep movsb; cld" :
+     3ba:	89 c1                	mov    %eax,%ecx
+     3bc:	fd                   	std
+     3bd:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     3bf:	fc                   	cld
+    return vdst;
+     3c0:	eb 09                	jmp    3cb <memmove+0x9c>
+  dst = vdst;
+     3c2:	89 df                	mov    %ebx,%edi
+  asm volatile("cld; rep movsb" :
+     3c4:	89 d6                	mov    %edx,%esi
+     3c6:	89 c1                	mov    %eax,%ecx
+     3c8:	fc                   	cld
+     3c9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  }
+  movsb(dst, src, n);
+  return vdst;
+}
+     3cb:	89 d8                	mov    %ebx,%eax
+     3cd:	83 c4 08             	add    $0x8,%esp
+     3d0:	5b                   	pop    %ebx
+     3d1:	5e                   	pop    %esi
+     3d2:	5f                   	pop    %edi
+     3d3:	5d                   	pop    %ebp
+     3d4:	c3                   	ret
+  dst = vdst;
+     3d5:	89 df                	mov    %ebx,%edi
+     3d7:	eb eb                	jmp    3c4 <memmove+0x95>
+
+000003d9 <vclock_gettime>:
+
+// clock_gettime() without a system call: read the clock page
+// that the kernel maps at CLOCKPAGE (see clock.h).
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+     3d9:	55                   	push   %ebp
+     3da:	89 e5                	mov    %esp,%ebp
+     3dc:	57                   	push   %edi
+     3dd:	56                   	push   %esi
+     3de:	53                   	push   %ebx
+     3df:	83 ec 14             	sub    $0x14,%esp
+  struct clockpage *cp = (struct clockpage*)CLOCKPAGE;
+  uint seq, rem, d;
+  uint64 tsc, ns, now;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+     3e2:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     3e6:	0f 87 a3 00 00 00    	ja     48f <vclock_gettime+0xb6>
+    return -1;
+  do {
+    seq = cp->seq;
+     3ec:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+    __sync_synchronize();
+     3f1:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    tsc = cp->tsc;
+     3f6:	8b 15 10 f0 ff 7f    	mov    0x7ffff010,%edx
+     3fc:	8b 1d 14 f0 ff 7f    	mov    0x7ffff014,%ebx
+    ns = cp->ns;
+     402:	8b 35 18 f0 ff 7f    	mov    0x7ffff018,%esi
+     408:	8b 3d 1c f0 ff 7f    	mov    0x7ffff01c,%edi
+    __sync_synchronize();
+     40e:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != cp->seq);
+     413:	89 c1                	mov    %eax,%ecx
+     415:	83 e1 01             	and    $0x1,%ecx
+     418:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     41b:	75 cf                	jne    3ec <vclock_gettime+0x13>
+     41d:	8b 0d 00 f0 ff 7f    	mov    0x7ffff000,%ecx
+     423:	39 c1                	cmp    %eax,%ecx
+     425:	75 c5                	jne    3ec <vclock_gettime+0x13>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+     427:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     42a:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     42d:	0f 31                	rdtsc
+     42f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     432:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     435:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  now = rdtsc();
+  // Less than a tick has passed since the update, so the delta
+  // fits in 32 bits.
+  d = now > tsc ? now - tsc : 0;
+     438:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     43b:	19 d3                	sbb    %edx,%ebx
+     43d:	73 07                	jae    446 <vclock_gettime+0x6d>
+     43f:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+     442:	29 d8                	sub    %ebx,%eax
+     444:	89 c1                	mov    %eax,%ecx
+  ns += ((uint64)d * cp->mult) >> cp->shift;
+     446:	89 c8                	mov    %ecx,%eax
+     448:	f7 25 04 f0 ff 7f    	mull   0x7ffff004
+     44e:	0f b6 0d 08 f0 ff 7f 	movzbl 0x7ffff008,%ecx
+     455:	0f ad d0             	shrd   %cl,%edx,%eax
+     458:	d3 ea                	shr    %cl,%edx
+     45a:	f6 c1 20             	test   $0x20,%cl
+     45d:	74 04                	je     463 <vclock_gettime+0x8a>
+     45f:	89 d0                	mov    %edx,%eax
+     461:	31 d2                	xor    %edx,%edx
+     463:	01 f0                	add    %esi,%eax
+     465:	11 fa                	adc    %edi,%edx
+static inline uint
+divl(uint64 n, uint d, uint *r)
+{
+  uint q;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (*r) :
+     467:	bb 00 ca 9a 3b       	mov    $0x3b9aca00,%ebx
+     46c:	f7 f3                	div    %ebx
+  ts->tv_sec = divl(ns, 1000000000, &rem);
+     46e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     471:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = rem;
+     473:	89 57 04             	mov    %edx,0x4(%edi)
+  if(clk == CLOCK_REALTIME)
+     476:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     47a:	75 1a                	jne    496 <vclock_gettime+0xbd>
+    ts->tv_sec += cp->boottime;
+     47c:	03 05 0c f0 ff 7f    	add    0x7ffff00c,%eax
+     482:	89 07                	mov    %eax,(%edi)
+  return 0;
+     484:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     487:	83 c4 14             	add    $0x14,%esp
+     48a:	5b                   	pop    %ebx
+     48b:	5e                   	pop    %esi
+     48c:	5f                   	pop    %edi
+     48d:	5d                   	pop    %ebp
+     48e:	c3                   	ret
+    return -1;
+     48f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     494:	eb f1                	jmp    487 <vclock_gettime+0xae>
+  return 0;
+     496:	b8 00 00 00 00       	mov    $0x0,%eax
+     49b:	eb ea                	jmp    487 <vclock_gettime+0xae>
+
+0000049d <flush>:
+
+// Write out fd's buffer, or with fd < 0 every buffer.
+// Returns -1 if a write fails.
+int
+flush(int fd)
+{
+     49d:	55                   	push   %ebp
+     49e:	89 e5                	mov    %esp,%ebp
+     4a0:	56                   	push   %esi
+     4a1:	53                   	push   %ebx
+     4a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  int r, n;
+
+  if(fd < 0){
+     4a5:	85 c0                	test   %eax,%eax
+     4a7:	78 5d                	js     506 <flush+0x69>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+      if(flush(fd) < 0)
+        r = -1;
+    return r;
+  }
+  if(fd >= NOBUF || (n = obuf[fd].n) == 0)
+     4a9:	83 f8 0f             	cmp    $0xf,%eax
+     4ac:	7f 64                	jg     512 <flush+0x75>
+     4ae:	69 d0 08 02 00 00    	imul   $0x208,%eax,%edx
+     4b4:	8b b2 04 1a 00 00    	mov    0x1a04(%edx),%esi
+     4ba:	85 f6                	test   %esi,%esi
+     4bc:	74 59                	je     517 <flush+0x7a>
+    return 0;
+  obuf[fd].n = 0;
+     4be:	c7 82 04 1a 00 00 00 	movl   $0x0,0x1a04(%edx)
+     4c5:	00 00 00 
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     4c8:	81 c2 08 1a 00 00    	add    $0x1a08,%edx
+     4ce:	83 ec 04             	sub    $0x4,%esp
+     4d1:	56                   	push   %esi
+     4d2:	52                   	push   %edx
+     4d3:	50                   	push   %eax
+     4d4:	e8 5a 03 00 00       	call   833 <write>
+     4d9:	83 c4 10             	add    $0x10,%esp
+     4dc:	39 f0                	cmp    %esi,%eax
+     4de:	75 40                	jne    520 <flush+0x83>
+     4e0:	be 00 00 00 00       	mov    $0x0,%esi
+     4e5:	eb 30                	jmp    517 <flush+0x7a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     4e7:	83 c3 01             	add    $0x1,%ebx
+     4ea:	83 fb 0f             	cmp    $0xf,%ebx
+     4ed:	7f 28                	jg     517 <flush+0x7a>
+      if(flush(fd) < 0)
+     4ef:	83 ec 0c             	sub    $0xc,%esp
+     4f2:	53                   	push   %ebx
+     4f3:	e8 a5 ff ff ff       	call   49d <flush>
+     4f8:	83 c4 10             	add    $0x10,%esp
+     4fb:	85 c0                	test   %eax,%eax
+     4fd:	79 e8                	jns    4e7 <flush+0x4a>
+        r = -1;
+     4ff:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     504:	eb e1                	jmp    4e7 <flush+0x4a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     506:	be 00 00 00 00       	mov    $0x0,%esi
+     50b:	bb 00 00 00 00       	mov    $0x0,%ebx
+     510:	eb d8                	jmp    4ea <flush+0x4d>
+    return 0;
+     512:	be 00 00 00 00       	mov    $0x0,%esi
+}
+     517:	89 f0                	mov    %esi,%eax
+     519:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     51c:	5b                   	pop    %ebx
+     51d:	5e                   	pop    %esi
+     51e:	5d                   	pop    %ebp
+     51f:	c3                   	ret
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     520:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     525:	eb f0                	jmp    517 <flush+0x7a>
+
+00000527 <bufreset>:
+
+static void
+bufreset(int fd)
+{
+  if(fd >= 0 && fd < NOBUF){
+     527:	83 f8 0f             	cmp    $0xf,%eax
+     52a:	76 01                	jbe    52d <bufreset+0x6>
+     52c:	c3                   	ret
+{
+     52d:	55                   	push   %ebp
+     52e:	89 e5                	mov    %esp,%ebp
+     530:	53                   	push   %ebx
+     531:	83 ec 10             	sub    $0x10,%esp
+     534:	89 c3                	mov    %eax,%ebx
+    flush(fd);
+     536:	50                   	push   %eax
+     537:	e8 61 ff ff ff       	call   49d <flush>
+    obuf[fd].mode = BUNKNOWN;
+     53c:	69 db 08 02 00 00    	imul   $0x208,%ebx,%ebx
+     542:	c7 83 00 1a 00 00 00 	movl   $0x0,0x1a00(%ebx)
+     549:	00 00 00 
+     54c:	83 c4 10             	add    $0x10,%esp
+  }
+}
+     54f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     552:	c9                   	leave
+     553:	c3                   	ret
+
+00000554 <bufwrite>:
+
+// Write n bytes from p to fd, through its buffer.
+// Returns n, or -1 if a write fails.
+int
+bufwrite(int fd, const void *p, int n)
+{
+     554:	55                   	push   %ebp
+     555:	89 e5                	mov    %esp,%ebp
+     557:	57                   	push   %edi
+     558:	56                   	push   %esi
+     559:	53                   	push   %ebx
+     55a:	83 ec 3c             	sub    $0x3c,%esp
+     55d:	8b 75 08             	mov    0x8(%ebp),%esi
+     560:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct stat st;
+  const char *s;
+  int i;
+
+  if(fd < 0 || fd >= NOBUF)
+     563:	83 fe 0f             	cmp    $0xf,%esi
+     566:	0f 87 a2 00 00 00    	ja     60e <bufwrite+0xba>
+    return write(fd, p, n);
+  if(obuf[fd].mode == BUNKNOWN){
+     56c:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     572:	83 b8 00 1a 00 00 00 	cmpl   $0x0,0x1a00(%eax)
+     579:	75 19                	jne    594 <bufwrite+0x40>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     57b:	83 fe 02             	cmp    $0x2,%esi
+     57e:	0f 85 9c 00 00 00    	jne    620 <bufwrite+0xcc>
+      obuf[fd].mode = BNONE;
+     584:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     58a:	c7 80 00 1a 00 00 01 	movl   $0x1,0x1a00(%eax)
+     591:	00 00 00 
+    else
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+  }
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     594:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     59a:	89 da                	mov    %ebx,%edx
+     59c:	03 90 04 1a 00 00    	add    0x1a04(%eax),%edx
+     5a2:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+     5a8:	0f 8f ae 00 00 00    	jg     65c <bufwrite+0x108>
+    return -1;
+  if(n >= OBUFSZ)
+     5ae:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+     5b4:	0f 8f bd 00 00 00    	jg     677 <bufwrite+0x123>
+    return write(fd, p, n);
+  memmove(obuf[fd].buf + obuf[fd].n, p, n);
+     5ba:	69 d6 08 02 00 00    	imul   $0x208,%esi,%edx
+     5c0:	8d ba 00 1a 00 00    	lea    0x1a00(%edx),%edi
+     5c6:	8b 82 04 1a 00 00    	mov    0x1a04(%edx),%eax
+     5cc:	83 ec 04             	sub    $0x4,%esp
+     5cf:	53                   	push   %ebx
+     5d0:	ff 75 0c             	push   0xc(%ebp)
+     5d3:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     5d6:	8d 84 10 08 1a 00 00 	lea    0x1a08(%eax,%edx,1),%eax
+     5dd:	50                   	push   %eax
+     5de:	e8 4c fd ff ff       	call   32f <memmove>
+  obuf[fd].n += n;
+     5e3:	01 5f 04             	add    %ebx,0x4(%edi)
+  if(obuf[fd].mode == BNONE)
+     5e6:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     5e9:	8b 82 00 1a 00 00    	mov    0x1a00(%edx),%eax
+     5ef:	83 c4 10             	add    $0x10,%esp
+     5f2:	83 f8 01             	cmp    $0x1,%eax
+     5f5:	0f 84 91 00 00 00    	je     68c <bufwrite+0x138>
+    return flush(fd) < 0 ? -1 : n;
+  if(obuf[fd].mode == BLINE)
+     5fb:	83 f8 02             	cmp    $0x2,%eax
+     5fe:	0f 84 ca 00 00 00    	je     6ce <bufwrite+0x17a>
+    for(s = p, i = 0; i < n; i++)
+      if(s[i] == '\n')
+        return flush(fd) < 0 ? -1 : n;
+  return n;
+     604:	89 d8                	mov    %ebx,%eax
+}
+     606:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     609:	5b                   	pop    %ebx
+     60a:	5e                   	pop    %esi
+     60b:	5f                   	pop    %edi
+     60c:	5d                   	pop    %ebp
+     60d:	c3                   	ret
+    return write(fd, p, n);
+     60e:	83 ec 04             	sub    $0x4,%esp
+     611:	53                   	push   %ebx
+     612:	ff 75 0c             	push   0xc(%ebp)
+     615:	56                   	push   %esi
+     616:	e8 18 02 00 00       	call   833 <write>
+     61b:	83 c4 10             	add    $0x10,%esp
+     61e:	eb e6                	jmp    606 <bufwrite+0xb2>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     620:	83 ec 08             	sub    $0x8,%esp
+     623:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     626:	50                   	push   %eax
+     627:	56                   	push   %esi
+     628:	e8 51 02 00 00       	call   87e <fstat>
+     62d:	83 c4 10             	add    $0x10,%esp
+     630:	85 c0                	test   %eax,%eax
+     632:	0f 88 4c ff ff ff    	js     584 <bufwrite+0x30>
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+     638:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     63d:	74 16                	je     655 <bufwrite+0x101>
+     63f:	ba 03 00 00 00       	mov    $0x3,%edx
+     644:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     64a:	89 90 00 1a 00 00    	mov    %edx,0x1a00(%eax)
+     650:	e9 3f ff ff ff       	jmp    594 <bufwrite+0x40>
+     655:	ba 02 00 00 00       	mov    $0x2,%edx
+     65a:	eb e8                	jmp    644 <bufwrite+0xf0>
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     65c:	83 ec 0c             	sub    $0xc,%esp
+     65f:	56                   	push   %esi
+     660:	e8 38 fe ff ff       	call   49d <flush>
+     665:	83 c4 10             	add    $0x10,%esp
+     668:	85 c0                	test   %eax,%eax
+     66a:	0f 89 3e ff ff ff    	jns    5ae <bufwrite+0x5a>
+    return -1;
+     670:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     675:	eb 8f                	jmp    606 <bufwrite+0xb2>
+    return write(fd, p, n);
+     677:	83 ec 04             	sub    $0x4,%esp
+     67a:	53                   	push   %ebx
+     67b:	ff 75 0c             	push   0xc(%ebp)
+     67e:	56                   	push   %esi
+     67f:	e8 af 01 00 00       	call   833 <write>
+     684:	83 c4 10             	add    $0x10,%esp
+     687:	e9 7a ff ff ff       	jmp    606 <bufwrite+0xb2>
+    return flush(fd) < 0 ? -1 : n;
+     68c:	83 ec 0c             	sub    $0xc,%esp
+     68f:	56                   	push   %esi
+     690:	e8 08 fe ff ff       	call   49d <flush>
+     695:	83 c4 10             	add    $0x10,%esp
+     698:	85 c0                	test   %eax,%eax
+     69a:	78 07                	js     6a3 <bufwrite+0x14f>
+     69c:	89 d8                	mov    %ebx,%eax
+     69e:	e9 63 ff ff ff       	jmp    606 <bufwrite+0xb2>
+     6a3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     6a8:	e9 59 ff ff ff       	jmp    606 <bufwrite+0xb2>
+        return flush(fd) < 0 ? -1 : n;
+     6ad:	83 ec 0c             	sub    $0xc,%esp
+     6b0:	56                   	push   %esi
+     6b1:	e8 e7 fd ff ff       	call   49d <flush>
+     6b6:	83 c4 10             	add    $0x10,%esp
+     6b9:	85 c0                	test   %eax,%eax
+     6bb:	78 07                	js     6c4 <bufwrite+0x170>
+     6bd:	89 d8                	mov    %ebx,%eax
+     6bf:	e9 42 ff ff ff       	jmp    606 <bufwrite+0xb2>
+     6c4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     6c9:	e9 38 ff ff ff       	jmp    606 <bufwrite+0xb2>
+    for(s = p, i = 0; i < n; i++)
+     6ce:	b8 00 00 00 00       	mov    $0x0,%eax
+     6d3:	39 d8                	cmp    %ebx,%eax
+     6d5:	7d 0e                	jge    6e5 <bufwrite+0x191>
+      if(s[i] == '\n')
+     6d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     6da:	80 3c 01 0a          	cmpb   $0xa,(%ecx,%eax,1)
+     6de:	74 cd                	je     6ad <bufwrite+0x159>
+    for(s = p, i = 0; i < n; i++)
+     6e0:	83 c0 01             	add    $0x1,%eax
+     6e3:	eb ee                	jmp    6d3 <bufwrite+0x17f>
+  return n;
+     6e5:	89 d8                	mov    %ebx,%eax
+     6e7:	e9 1a ff ff ff       	jmp    606 <bufwrite+0xb2>
+
+000006ec <fork>:
+
+int
+fork(void)
+{
+     6ec:	55                   	push   %ebp
+     6ed:	89 e5                	mov    %esp,%ebp
+     6ef:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     6f2:	6a ff                	push   $0xffffffff
+     6f4:	e8 a4 fd ff ff       	call   49d <flush>
+  return _fork();
+     6f9:	e8 bd 00 00 00       	call   7bb <_fork>
+}
+     6fe:	c9                   	leave
+     6ff:	c3                   	ret
+
+00000700 <exit>:
+
+int
+exit(void)
+{
+     700:	55                   	push   %ebp
+     701:	89 e5                	mov    %esp,%ebp
+     703:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     706:	6a ff                	push   $0xffffffff
+     708:	e8 90 fd ff ff       	call   49d <flush>
+  _exit();
+     70d:	e8 b8 00 00 00       	call   7ca <_exit>
+
+00000712 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     712:	55                   	push   %ebp
+     713:	89 e5                	mov    %esp,%ebp
+     715:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     718:	6a ff                	push   $0xffffffff
+     71a:	e8 7e fd ff ff       	call   49d <flush>
+  return _exec(path, argv);
+     71f:	83 c4 08             	add    $0x8,%esp
+     722:	ff 75 0c             	push   0xc(%ebp)
+     725:	ff 75 08             	push   0x8(%ebp)
+     728:	e8 bb 00 00 00       	call   7e8 <_exec>
+}
+     72d:	c9                   	leave
+     72e:	c3                   	ret
+
+0000072f <close>:
+
+int
+close(int fd)
+{
+     72f:	55                   	push   %ebp
+     730:	89 e5                	mov    %esp,%ebp
+     732:	53                   	push   %ebx
+     733:	83 ec 04             	sub    $0x4,%esp
+     736:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bufreset(fd);
+     739:	89 d8                	mov    %ebx,%eax
+     73b:	e8 e7 fd ff ff       	call   527 <bufreset>
+  return _close(fd);
+     740:	83 ec 0c             	sub    $0xc,%esp
+     743:	53                   	push   %ebx
+     744:	e8 90 00 00 00       	call   7d9 <_close>
+}
+     749:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     74c:	c9                   	leave
+     74d:	c3                   	ret
+
+0000074e <stat>:
+{
+     74e:	55                   	push   %ebp
+     74f:	89 e5                	mov    %esp,%ebp
+     751:	56                   	push   %esi
+     752:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     753:	83 ec 08             	sub    $0x8,%esp
+     756:	6a 00                	push   $0x0
+     758:	ff 75 08             	push   0x8(%ebp)
+     75b:	e8 f1 00 00 00       	call   851 <open>
+  if(fd < 0)
+     760:	83 c4 10             	add    $0x10,%esp
+     763:	85 c0                	test   %eax,%eax
+     765:	78 24                	js     78b <stat+0x3d>
+     767:	89 c3                	mov    %eax,%ebx
+  r = fstat(fd, st);
+     769:	83 ec 08             	sub    $0x8,%esp
+     76c:	ff 75 0c             	push   0xc(%ebp)
+     76f:	50                   	push   %eax
+     770:	e8 09 01 00 00       	call   87e <fstat>
+     775:	89 c6                	mov    %eax,%esi
+  close(fd);
+     777:	89 1c 24             	mov    %ebx,(%esp)
+     77a:	e8 b0 ff ff ff       	call   72f <close>
+  return r;
+     77f:	83 c4 10             	add    $0x10,%esp
+}
+     782:	89 f0                	mov    %esi,%eax
+     784:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     787:	5b                   	pop    %ebx
+     788:	5e                   	pop    %esi
+     789:	5d                   	pop    %ebp
+     78a:	c3                   	ret
+    return -1;
+     78b:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     790:	eb f0                	jmp    782 <stat+0x34>
+
+00000792 <dup2>:
+
+int
+dup2(int oldfd, int newfd)
+{
+     792:	55                   	push   %ebp
+     793:	89 e5                	mov    %esp,%ebp
+     795:	56                   	push   %esi
+     796:	53                   	push   %ebx
+     797:	8b 75 08             	mov    0x8(%ebp),%esi
+     79a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(oldfd != newfd)
+     79d:	39 de                	cmp    %ebx,%esi
+     79f:	75 11                	jne    7b2 <dup2+0x20>
+    bufreset(newfd);
+  return _dup2(oldfd, newfd);
+     7a1:	83 ec 08             	sub    $0x8,%esp
+     7a4:	53                   	push   %ebx
+     7a5:	56                   	push   %esi
+     7a6:	e8 4c 00 00 00       	call   7f7 <_dup2>
+}
+     7ab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     7ae:	5b                   	pop    %ebx
+     7af:	5e                   	pop    %esi
+     7b0:	5d                   	pop    %ebp
+     7b1:	c3                   	ret
+    bufreset(newfd);
+     7b2:	89 d8                	mov    %ebx,%eax
+     7b4:	e8 6e fd ff ff       	call   527 <bufreset>
+     7b9:	eb e6                	jmp    7a1 <dup2+0xf>
+
+000007bb <_fork>:
+  1: ret
+
+#define SYSCALL(name) STUB(name, SYS_ ## name)
+
+# ulib.c wraps these, to flush printf()'s buffers first.
+STUB(_fork, SYS_fork)
+     7bb:	b8 01 00 00 00       	mov    $0x1,%eax
+     7c0:	89 e1                	mov    %esp,%ecx
+     7c2:	ba c9 07 00 00       	mov    $0x7c9,%edx
+     7c7:	0f 34                	sysenter
+     7c9:	c3                   	ret
+
+000007ca <_exit>:
+STUB(_exit, SYS_exit)
+     7ca:	b8 02 00 00 00       	mov    $0x2,%eax
+     7cf:	89 e1                	mov    %esp,%ecx
+     7d1:	ba d8 07 00 00       	mov    $0x7d8,%edx
+     7d6:	0f 34                	sysenter
+     7d8:	c3                   	ret
+
+000007d9 <_close>:
+STUB(_close, SYS_close)
+     7d9:	b8 15 00 00 00       	mov    $0x15,%eax
+     7de:	89 e1                	mov    %esp,%ecx
+     7e0:	ba e7 07 00 00       	mov    $0x7e7,%edx
+     7e5:	0f 34                	sysenter
+     7e7:	c3                   	ret
+
+000007e8 <_exec>:
+STUB(_exec, SYS_exec)
+     7e8:	b8 07 00 00 00       	mov    $0x7,%eax
+     7ed:	89 e1                	mov    %esp,%ecx
+     7ef:	ba f6 07 00 00       	mov    $0x7f6,%edx
+     7f4:	0f 34                	sysenter
+     7f6:	c3                   	ret
+
+000007f7 <_dup2>:
+STUB(_dup2, SYS_dup2)
+     7f7:	b8 17 00 00 00       	mov    $0x17,%eax
+     7fc:	89 e1                	mov    %esp,%ecx
+     7fe:	ba 05 08 00 00       	mov    $0x805,%edx
+     803:	0f 34                	sysenter
+     805:	c3                   	ret
+
+00000806 <wait>:
+
+SYSCALL(wait)
+     806:	b8 03 00 00 00       	mov    $0x3,%eax
+     80b:	89 e1                	mov    %esp,%ecx
+     80d:	ba 14 08 00 00       	mov    $0x814,%edx
+     812:	0f 34                	sysenter
+     814:	c3                   	ret
+
+00000815 <pipe>:
+SYSCALL(pipe)
+     815:	b8 04 00 00 00       	mov    $0x4,%eax
+     81a:	89 e1                	mov    %esp,%ecx
+     81c:	ba 23 08 00 00       	mov    $0x823,%edx
+     821:	0f 34                	sysenter
+     823:	c3                   	ret
+
+00000824 <read>:
+SYSCALL(read)
+     824:	b8 05 00 00 00       	mov    $0x5,%eax
+     829:	89 e1                	mov    %esp,%ecx
+     82b:	ba 32 08 00 00       	mov    $0x832,%edx
+     830:	0f 34                	sysenter
+     832:	c3                   	ret
+
+00000833 <write>:
+SYSCALL(write)
+     833:	b8 10 00 00 00       	mov    $0x10,%eax
+     838:	89 e1                	mov    %esp,%ecx
+     83a:	ba 41 08 00 00       	mov    $0x841,%edx
+     83f:	0f 34                	sysenter
+     841:	c3                   	ret
+
+00000842 <kill>:
+SYSCALL(kill)
+     842:	b8 06 00 00 00       	mov    $0x6,%eax
+     847:	89 e1                	mov    %esp,%ecx
+     849:	ba 50 08 00 00       	mov    $0x850,%edx
+     84e:	0f 34                	sysenter
+     850:	c3                   	ret
+
+00000851 <open>:
+SYSCALL(open)
+     851:	b8 0f 00 00 00       	mov    $0xf,%eax
+     856:	89 e1                	mov    %esp,%ecx
+     858:	ba 5f 08 00 00       	mov    $0x85f,%edx
+     85d:	0f 34                	sysenter
+     85f:	c3                   	ret
+
+00000860 <mknod>:
+SYSCALL(mknod)
+     860:	b8 11 00 00 00       	mov    $0x11,%eax
+     865:	89 e1                	mov    %esp,%ecx
+     867:	ba 6e 08 00 00       	mov    $0x86e,%edx
+     86c:	0f 34                	sysenter
+     86e:	c3                   	ret
+
+0000086f <unlink>:
+SYSCALL(unlink)
+     86f:	b8 12 00 00 00       	mov    $0x12,%eax
+     874:	89 e1                	mov    %esp,%ecx
+     876:	ba 7d 08 00 00       	mov    $0x87d,%edx
+     87b:	0f 34                	sysenter
+     87d:	c3                   	ret
+
+0000087e <fstat>:
+SYSCALL(fstat)
+     87e:	b8 08 00 00 00       	mov    $0x8,%eax
+     883:	89 e1                	mov    %esp,%ecx
+     885:	ba 8c 08 00 00       	mov    $0x88c,%edx
+     88a:	0f 34                	sysenter
+     88c:	c3                   	ret
+
+0000088d <link>:
+SYSCALL(link)
+     88d:	b8 13 00 00 00       	mov    $0x13,%eax
+     892:	89 e1                	mov    %esp,%ecx
+     894:	ba 9b 08 00 00       	mov    $0x89b,%edx
+     899:	0f 34                	sysenter
+     89b:	c3                   	ret
+
+0000089c <mkdir>:
+SYSCALL(mkdir)
+     89c:	b8 14 00 00 00       	mov    $0x14,%eax
+     8a1:	89 e1                	mov    %esp,%ecx
+     8a3:	ba aa 08 00 00       	mov    $0x8aa,%edx
+     8a8:	0f 34                	sysenter
+     8aa:	c3                   	ret
+
+000008ab <chdir>:
+SYSCALL(chdir)
+     8ab:	b8 09 00 00 00       	mov    $0x9,%eax
+     8b0:	89 e1                	mov    %esp,%ecx
+     8b2:	ba b9 08 00 00       	mov    $0x8b9,%edx
+     8b7:	0f 34                	sysenter
+     8b9:	c3                   	ret
+
+000008ba <dup>:
+SYSCALL(dup)
+     8ba:	b8 0a 00 00 00       	mov    $0xa,%eax
+     8bf:	89 e1                	mov    %esp,%ecx
+     8c1:	ba c8 08 00 00       	mov    $0x8c8,%edx
+     8c6:	0f 34                	sysenter
+     8c8:	c3                   	ret
+
+000008c9 <getpid>:
+SYSCALL(getpid)
+     8c9:	b8 0b 00 00 00       	mov    $0xb,%eax
+     8ce:	89 e1                	mov    %esp,%ecx
+     8d0:	ba d7 08 00 00       	mov    $0x8d7,%edx
+     8d5:	0f 34                	sysenter
+     8d7:	c3                   	ret
+
+000008d8 <sbrk>:
+SYSCALL(sbrk)
+     8d8:	b8 0c 00 00 00       	mov    $0xc,%eax
+     8dd:	89 e1                	mov    %esp,%ecx
+     8df:	ba e6 08 00 00       	mov    $0x8e6,%edx
+     8e4:	0f 34                	sysenter
+     8e6:	c3                   	ret
+
+000008e7 <sleep>:
+SYSCALL(sleep)
+     8e7:	b8 0d 00 00 00       	mov    $0xd,%eax
+     8ec:	89 e1                	mov    %esp,%ecx
+     8ee:	ba f5 08 00 00       	mov    $0x8f5,%edx
+     8f3:	0f 34                	sysenter
+     8f5:	c3                   	ret
+
+000008f6 <uptime>:
+SYSCALL(uptime)
+     8f6:	b8 0e 00 00 00       	mov    $0xe,%eax
+     8fb:	89 e1                	mov    %esp,%ecx
+     8fd:	ba 04 09 00 00       	mov    $0x904,%edx
+     902:	0f 34                	sysenter
+     904:	c3                   	ret
+
+00000905 <date>:
+SYSCALL(date)
+     905:	b8 16 00 00 00       	mov    $0x16,%eax
+     90a:	89 e1                	mov    %esp,%ecx
+     90c:	ba 13 09 00 00       	mov    $0x913,%edx
+     911:	0f 34                	sysenter
+     913:	c3                   	ret
+
+00000914 <faultaround>:
+SYSCALL(faultaround)
+     914:	b8 18 00 00 00       	mov    $0x18,%eax
+     919:	89 e1                	mov    %esp,%ecx
+     91b:	ba 22 09 00 00       	mov    $0x922,%edx
+     920:	0f 34                	sysenter
+     922:	c3                   	ret
+
+00000923 <faultstat>:
+SYSCALL(faultstat)
+     923:	b8 19 00 00 00       	mov    $0x19,%eax
+     928:	89 e1                	mov    %esp,%ecx
+     92a:	ba 31 09 00 00       	mov    $0x931,%edx
+     92f:	0f 34                	sysenter
+     931:	c3                   	ret
+
+00000932 <mmap>:
+SYSCALL(mmap)
+     932:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     937:	89 e1                	mov    %esp,%ecx
+     939:	ba 40 09 00 00       	mov    $0x940,%edx
+     93e:	0f 34                	sysenter
+     940:	c3                   	ret
+
+00000941 <munmap>:
+SYSCALL(munmap)
+     941:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     946:	89 e1                	mov    %esp,%ecx
+     948:	ba 4f 09 00 00       	mov    $0x94f,%edx
+     94d:	0f 34                	sysenter
+     94f:	c3                   	ret
+
+00000950 <largepages>:
+SYSCALL(largepages)
+     950:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     955:	89 e1                	mov    %esp,%ecx
+     957:	ba 5e 09 00 00       	mov    $0x95e,%edx
+     95c:	0f 34                	sysenter
+     95e:	c3                   	ret
+
+0000095f <spawn>:
+SYSCALL(spawn)
+     95f:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     964:	89 e1                	mov    %esp,%ecx
+     966:	ba 6d 09 00 00       	mov    $0x96d,%edx
+     96b:	0f 34                	sysenter
+     96d:	c3                   	ret
+
+0000096e <setpriority>:
+SYSCALL(setpriority)
+     96e:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     973:	89 e1                	mov    %esp,%ecx
+     975:	ba 7c 09 00 00       	mov    $0x97c,%edx
+     97a:	0f 34                	sysenter
+     97c:	c3                   	ret
+
+0000097d <getpriority>:
+SYSCALL(getpriority)
+     97d:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     982:	89 e1                	mov    %esp,%ecx
+     984:	ba 8b 09 00 00       	mov    $0x98b,%edx
+     989:	0f 34                	sysenter
+     98b:	c3                   	ret
+
+0000098c <getprocinfo>:
+SYSCALL(getprocinfo)
+     98c:	b8 20 00 00 00       	mov    $0x20,%eax
+     991:	89 e1                	mov    %esp,%ecx
+     993:	ba 9a 09 00 00       	mov    $0x99a,%edx
+     998:	0f 34                	sysenter
+     99a:	c3                   	ret
+
+0000099b <getcpuinfo>:
+SYSCALL(getcpuinfo)
+     99b:	b8 21 00 00 00       	mov    $0x21,%eax
+     9a0:	89 e1                	mov    %esp,%ecx
+     9a2:	ba a9 09 00 00       	mov    $0x9a9,%edx
+     9a7:	0f 34                	sysenter
+     9a9:	c3                   	ret
+
+000009aa <clone>:
+SYSCALL(clone)
+     9aa:	b8 22 00 00 00       	mov    $0x22,%eax
+     9af:	89 e1                	mov    %esp,%ecx
+     9b1:	ba b8 09 00 00       	mov    $0x9b8,%edx
+     9b6:	0f 34                	sysenter
+     9b8:	c3                   	ret
+
+000009b9 <join>:
+SYSCALL(join)
+     9b9:	b8 23 00 00 00       	mov    $0x23,%eax
+     9be:	89 e1                	mov    %esp,%ecx
+     9c0:	ba c7 09 00 00       	mov    $0x9c7,%edx
+     9c5:	0f 34                	sysenter
+     9c7:	c3                   	ret
+
+000009c8 <futex_wait>:
+SYSCALL(futex_wait)
+     9c8:	b8 24 00 00 00       	mov    $0x24,%eax
+     9cd:	89 e1                	mov    %esp,%ecx
+     9cf:	ba d6 09 00 00       	mov    $0x9d6,%edx
+     9d4:	0f 34                	sysenter
+     9d6:	c3                   	ret
+
+000009d7 <futex_wake>:
+SYSCALL(futex_wake)
+     9d7:	b8 25 00 00 00       	mov    $0x25,%eax
+     9dc:	89 e1                	mov    %esp,%ecx
+     9de:	ba e5 09 00 00       	mov    $0x9e5,%edx
+     9e3:	0f 34                	sysenter
+     9e5:	c3                   	ret
+
+000009e6 <setaffinity>:
+SYSCALL(setaffinity)
+     9e6:	b8 26 00 00 00       	mov    $0x26,%eax
+     9eb:	89 e1                	mov    %esp,%ecx
+     9ed:	ba f4 09 00 00       	mov    $0x9f4,%edx
+     9f2:	0f 34                	sysenter
+     9f4:	c3                   	ret
+
+000009f5 <getaffinity>:
+SYSCALL(getaffinity)
+     9f5:	b8 27 00 00 00       	mov    $0x27,%eax
+     9fa:	89 e1                	mov    %esp,%ecx
+     9fc:	ba 03 0a 00 00       	mov    $0xa03,%edx
+     a01:	0f 34                	sysenter
+     a03:	c3                   	ret
+
+00000a04 <clock_gettime>:
+SYSCALL(clock_gettime)
+     a04:	b8 28 00 00 00       	mov    $0x28,%eax
+     a09:	89 e1                	mov    %esp,%ecx
+     a0b:	ba 12 0a 00 00       	mov    $0xa12,%edx
+     a10:	0f 34                	sysenter
+     a12:	c3                   	ret
+
+00000a13 <msleep>:
+SYSCALL(msleep)
+     a13:	b8 29 00 00 00       	mov    $0x29,%eax
+     a18:	89 e1                	mov    %esp,%ecx
+     a1a:	ba 21 0a 00 00       	mov    $0xa21,%edx
+     a1f:	0f 34                	sysenter
+     a21:	c3                   	ret
+
+00000a22 <lockstat>:
+SYSCALL(lockstat)
+     a22:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     a27:	89 e1                	mov    %esp,%ecx
+     a29:	ba 30 0a 00 00       	mov    $0xa30,%edx
+     a2e:	0f 34                	sysenter
+     a30:	c3                   	ret
+
+00000a31 <bstat>:
+SYSCALL(bstat)
+     a31:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     a36:	89 e1                	mov    %esp,%ecx
+     a38:	ba 3f 0a 00 00       	mov    $0xa3f,%edx
+     a3d:	0f 34                	sysenter
+     a3f:	c3                   	ret
+
+00000a40 <iostat>:
+SYSCALL(iostat)
+     a40:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     a45:	89 e1                	mov    %esp,%ecx
+     a47:	ba 4e 0a 00 00       	mov    $0xa4e,%edx
+     a4c:	0f 34                	sysenter
+     a4e:	c3                   	ret
+
+00000a4f <fsync>:
+SYSCALL(fsync)
+     a4f:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     a54:	89 e1                	mov    %esp,%ecx
+     a56:	ba 5d 0a 00 00       	mov    $0xa5d,%edx
+     a5b:	0f 34                	sysenter
+     a5d:	c3                   	ret
+
+00000a5e <pread>:
+SYSCALL(pread)
+     a5e:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     a63:	89 e1                	mov    %esp,%ecx
+     a65:	ba 6c 0a 00 00       	mov    $0xa6c,%edx
+     a6a:	0f 34                	sysenter
+     a6c:	c3                   	ret
+
+00000a6d <pwrite>:
+SYSCALL(pwrite)
+     a6d:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     a72:	89 e1                	mov    %esp,%ecx
+     a74:	ba 7b 0a 00 00       	mov    $0xa7b,%edx
+     a79:	0f 34                	sysenter
+     a7b:	c3                   	ret
+
+00000a7c <readv>:
+SYSCALL(readv)
+     a7c:	b8 30 00 00 00       	mov    $0x30,%eax
+     a81:	89 e1                	mov    %esp,%ecx
+     a83:	ba 8a 0a 00 00       	mov    $0xa8a,%edx
+     a88:	0f 34                	sysenter
+     a8a:	c3                   	ret
+
+00000a8b <writev>:
+SYSCALL(writev)
+     a8b:	b8 31 00 00 00       	mov    $0x31,%eax
+     a90:	89 e1                	mov    %esp,%ecx
+     a92:	ba 99 0a 00 00       	mov    $0xa99,%edx
+     a97:	0f 34                	sysenter
+     a99:	c3                   	ret
+
+00000a9a <sendfile>:
+SYSCALL(sendfile)
+     a9a:	b8 32 00 00 00       	mov    $0x32,%eax
+     a9f:	89 e1                	mov    %esp,%ecx
+     aa1:	ba a8 0a 00 00       	mov    $0xaa8,%edx
+     aa6:	0f 34                	sysenter
+     aa8:	c3                   	ret
+
+00000aa9 <fcntl>:
+SYSCALL(fcntl)
+     aa9:	b8 33 00 00 00       	mov    $0x33,%eax
+     aae:	89 e1                	mov    %esp,%ecx
+     ab0:	ba b7 0a 00 00       	mov    $0xab7,%edx
+     ab5:	0f 34                	sysenter
+     ab7:	c3                   	ret
+
+00000ab8 <mount>:
+SYSCALL(mount)
+     ab8:	b8 34 00 00 00       	mov    $0x34,%eax
+     abd:	89 e1                	mov    %esp,%ecx
+     abf:	ba c6 0a 00 00       	mov    $0xac6,%edx
+     ac4:	0f 34                	sysenter
+     ac6:	c3                   	ret
+
+00000ac7 <getdents>:
+SYSCALL(getdents)
+     ac7:	b8 35 00 00 00       	mov    $0x35,%eax
+     acc:	89 e1                	mov    %esp,%ecx
+     ace:	ba d5 0a 00 00       	mov    $0xad5,%edx
+     ad3:	0f 34                	sysenter
+     ad5:	c3                   	ret
+
+00000ad6 <fstatat>:
+SYSCALL(fstatat)
+     ad6:	b8 36 00 00 00       	mov    $0x36,%eax
+     adb:	89 e1                	mov    %esp,%ecx
+     add:	ba e4 0a 00 00       	mov    $0xae4,%edx
+     ae2:	0f 34                	sysenter
+     ae4:	c3                   	ret
+
+00000ae5 <sysstat>:
+SYSCALL(sysstat)
+     ae5:	b8 37 00 00 00       	mov    $0x37,%eax
+     aea:	89 e1                	mov    %esp,%ecx
+     aec:	ba f3 0a 00 00       	mov    $0xaf3,%edx
+     af1:	0f 34                	sysenter
+     af3:	c3                   	ret
+
+00000af4 <ringenter>:
+SYSCALL(ringenter)
+     af4:	b8 38 00 00 00       	mov    $0x38,%eax
+     af9:	89 e1                	mov    %esp,%ecx
+     afb:	ba 02 0b 00 00       	mov    $0xb02,%edx
+     b00:	0f 34                	sysenter
+     b02:	c3                   	ret
+
+00000b03 <trace>:
+SYSCALL(trace)
+     b03:	b8 39 00 00 00       	mov    $0x39,%eax
+     b08:	89 e1                	mov    %esp,%ecx
+     b0a:	ba 11 0b 00 00       	mov    $0xb11,%edx
+     b0f:	0f 34                	sysenter
+     b11:	c3                   	ret
+
+00000b12 <memstat>:
+SYSCALL(memstat)
+     b12:	b8 3a 00 00 00       	mov    $0x3a,%eax
+     b17:	89 e1                	mov    %esp,%ecx
+     b19:	ba 20 0b 00 00       	mov    $0xb20,%edx
+     b1e:	0f 34                	sysenter
+     b20:	c3                   	ret
+
+00000b21 <shmget>:
+SYSCALL(shmget)
+     b21:	b8 3b 00 00 00       	mov    $0x3b,%eax
+     b26:	89 e1                	mov    %esp,%ecx
+     b28:	ba 2f 0b 00 00       	mov    $0xb2f,%edx
+     b2d:	0f 34                	sysenter
+     b2f:	c3                   	ret
+
+00000b30 <shmat>:
+SYSCALL(shmat)
+     b30:	b8 3c 00 00 00       	mov    $0x3c,%eax
+     b35:	89 e1                	mov    %esp,%ecx
+     b37:	ba 3e 0b 00 00       	mov    $0xb3e,%edx
+     b3c:	0f 34                	sysenter
+     b3e:	c3                   	ret
+
+00000b3f <shmdt>:
+SYSCALL(shmdt)
+     b3f:	b8 3d 00 00 00       	mov    $0x3d,%eax
+     b44:	89 e1                	mov    %esp,%ecx
+     b46:	ba 4d 0b 00 00       	mov    $0xb4d,%edx
+     b4b:	0f 34                	sysenter
+     b4d:	c3                   	ret
+
+00000b4e <irqstat>:
+SYSCALL(irqstat)
+     b4e:	b8 3e 00 00 00       	mov    $0x3e,%eax
+     b53:	89 e1                	mov    %esp,%ecx
+     b55:	ba 5c 0b 00 00       	mov    $0xb5c,%edx
+     b5a:	0f 34                	sysenter
+     b5c:	c3                   	ret
+
+00000b5d <irqroute>:
+SYSCALL(irqroute)
+     b5d:	b8 3f 00 00 00       	mov    $0x3f,%eax
+     b62:	89 e1                	mov    %esp,%ecx
+     b64:	ba 6b 0b 00 00       	mov    $0xb6b,%edx
+     b69:	0f 34                	sysenter
+     b6b:	c3                   	ret
+
+00000b6c <putc>:
+  char buf[64];
+};
+
+static void
+putc(struct out *o, char c)
+{
+     b6c:	55                   	push   %ebp
+     b6d:	89 e5                	mov    %esp,%ebp
+     b6f:	56                   	push   %esi
+     b70:	53                   	push   %ebx
+     b71:	89 c3                	mov    %eax,%ebx
+     b73:	89 d6                	mov    %edx,%esi
+  if(o->n == sizeof(o->buf)){
+     b75:	8b 40 04             	mov    0x4(%eax),%eax
+     b78:	83 f8 40             	cmp    $0x40,%eax
+     b7b:	74 16                	je     b93 <putc+0x27>
+    bufwrite(o->fd, o->buf, o->n);
+    o->n = 0;
+  }
+  o->buf[o->n++] = c;
+     b7d:	8b 43 04             	mov    0x4(%ebx),%eax
+     b80:	8d 50 01             	lea    0x1(%eax),%edx
+     b83:	89 53 04             	mov    %edx,0x4(%ebx)
+     b86:	89 f1                	mov    %esi,%ecx
+     b88:	88 4c 03 08          	mov    %cl,0x8(%ebx,%eax,1)
+}
+     b8c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b8f:	5b                   	pop    %ebx
+     b90:	5e                   	pop    %esi
+     b91:	5d                   	pop    %ebp
+     b92:	c3                   	ret
+    bufwrite(o->fd, o->buf, o->n);
+     b93:	8d 53 08             	lea    0x8(%ebx),%edx
+     b96:	83 ec 04             	sub    $0x4,%esp
+     b99:	50                   	push   %eax
+     b9a:	52                   	push   %edx
+     b9b:	ff 33                	push   (%ebx)
+     b9d:	e8 b2 f9 ff ff       	call   554 <bufwrite>
+    o->n = 0;
+     ba2:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     ba9:	83 c4 10             	add    $0x10,%esp
+     bac:	eb cf                	jmp    b7d <putc+0x11>
+
+00000bae <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     bae:	55                   	push   %ebp
+     baf:	89 e5                	mov    %esp,%ebp
+     bb1:	57                   	push   %edi
+     bb2:	56                   	push   %esi
+     bb3:	53                   	push   %ebx
+     bb4:	83 ec 2c             	sub    $0x2c,%esp
+     bb7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     bba:	89 d0                	mov    %edx,%eax
+     bbc:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+     bbe:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     bc2:	0f 95 c1             	setne  %cl
+     bc5:	c1 ea 1f             	shr    $0x1f,%edx
+     bc8:	84 d1                	test   %dl,%cl
+     bca:	74 44                	je     c10 <printint+0x62>
+    neg = 1;
+    x = -xx;
+     bcc:	f7 d8                	neg    %eax
+     bce:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+     bd0:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     bd7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+     bdc:	89 c8                	mov    %ecx,%eax
+     bde:	ba 00 00 00 00       	mov    $0x0,%edx
+     be3:	f7 f6                	div    %esi
+     be5:	89 df                	mov    %ebx,%edi
+     be7:	83 c3 01             	add    $0x1,%ebx
+     bea:	0f b6 92 24 13 00 00 	movzbl 0x1324(%edx),%edx
+     bf1:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+     bf5:	89 ca                	mov    %ecx,%edx
+     bf7:	89 c1                	mov    %eax,%ecx
+     bf9:	39 f2                	cmp    %esi,%edx
+     bfb:	73 df                	jae    bdc <printint+0x2e>
+  if(neg)
+     bfd:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     c01:	74 31                	je     c34 <printint+0x86>
+    buf[i++] = '-';
+     c03:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+     c08:	8d 5f 02             	lea    0x2(%edi),%ebx
+     c0b:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     c0e:	eb 17                	jmp    c27 <printint+0x79>
+    x = xx;
+     c10:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+     c12:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     c19:	eb bc                	jmp    bd7 <printint+0x29>
+
+  while(--i >= 0)
+    putc(o, buf[i]);
+     c1b:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+     c20:	89 f0                	mov    %esi,%eax
+     c22:	e8 45 ff ff ff       	call   b6c <putc>
+  while(--i >= 0)
+     c27:	83 eb 01             	sub    $0x1,%ebx
+     c2a:	79 ef                	jns    c1b <printint+0x6d>
+}
+     c2c:	83 c4 2c             	add    $0x2c,%esp
+     c2f:	5b                   	pop    %ebx
+     c30:	5e                   	pop    %esi
+     c31:	5f                   	pop    %edi
+     c32:	5d                   	pop    %ebp
+     c33:	c3                   	ret
+     c34:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     c37:	eb ee                	jmp    c27 <printint+0x79>
+
+00000c39 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     c39:	55                   	push   %ebp
+     c3a:	89 e5                	mov    %esp,%ebp
+     c3c:	57                   	push   %edi
+     c3d:	56                   	push   %esi
+     c3e:	53                   	push   %ebx
+     c3f:	83 ec 6c             	sub    $0x6c,%esp
+  int c, i, state;
+  uint *ap;
+  struct out out, *o;
+
+  o = &out;
+  o->fd = fd;
+     c42:	8b 45 08             	mov    0x8(%ebp),%eax
+     c45:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  o->n = 0;
+     c48:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+     c4f:	8d 45 10             	lea    0x10(%ebp),%eax
+     c52:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  state = 0;
+     c55:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+     c5a:	bb 00 00 00 00       	mov    $0x0,%ebx
+     c5f:	eb 14                	jmp    c75 <printf+0x3c>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(o, c);
+     c61:	89 fa                	mov    %edi,%edx
+     c63:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     c66:	e8 01 ff ff ff       	call   b6c <putc>
+     c6b:	eb 05                	jmp    c72 <printf+0x39>
+      }
+    } else if(state == '%'){
+     c6d:	83 fe 25             	cmp    $0x25,%esi
+     c70:	74 25                	je     c97 <printf+0x5e>
+  for(i = 0; fmt[i]; i++){
+     c72:	83 c3 01             	add    $0x1,%ebx
+     c75:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c78:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+     c7c:	84 c0                	test   %al,%al
+     c7e:	0f 84 20 01 00 00    	je     da4 <printf+0x16b>
+    c = fmt[i] & 0xff;
+     c84:	0f be f8             	movsbl %al,%edi
+     c87:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     c8a:	85 f6                	test   %esi,%esi
+     c8c:	75 df                	jne    c6d <printf+0x34>
+      if(c == '%'){
+     c8e:	83 f8 25             	cmp    $0x25,%eax
+     c91:	75 ce                	jne    c61 <printf+0x28>
+        state = '%';
+     c93:	89 c6                	mov    %eax,%esi
+     c95:	eb db                	jmp    c72 <printf+0x39>
+      if(c == 'd'){
+     c97:	83 f8 25             	cmp    $0x25,%eax
+     c9a:	0f 84 cf 00 00 00    	je     d6f <printf+0x136>
+     ca0:	0f 8c dd 00 00 00    	jl     d83 <printf+0x14a>
+     ca6:	83 f8 78             	cmp    $0x78,%eax
+     ca9:	0f 8f d4 00 00 00    	jg     d83 <printf+0x14a>
+     caf:	83 f8 63             	cmp    $0x63,%eax
+     cb2:	0f 8c cb 00 00 00    	jl     d83 <printf+0x14a>
+     cb8:	83 e8 63             	sub    $0x63,%eax
+     cbb:	83 f8 15             	cmp    $0x15,%eax
+     cbe:	0f 87 bf 00 00 00    	ja     d83 <printf+0x14a>
+     cc4:	ff 24 85 cc 12 00 00 	jmp    *0x12cc(,%eax,4)
+        printint(o, *ap, 10, 1);
+     ccb:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     cce:	8b 17                	mov    (%edi),%edx
+     cd0:	83 ec 0c             	sub    $0xc,%esp
+     cd3:	6a 01                	push   $0x1
+     cd5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     cda:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     cdd:	e8 cc fe ff ff       	call   bae <printint>
+        ap++;
+     ce2:	83 c7 04             	add    $0x4,%edi
+     ce5:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     ce8:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(o, '%');
+        putc(o, c);
+      }
+      state = 0;
+     ceb:	be 00 00 00 00       	mov    $0x0,%esi
+     cf0:	eb 80                	jmp    c72 <printf+0x39>
+        printint(o, *ap, 16, 0);
+     cf2:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     cf5:	8b 17                	mov    (%edi),%edx
+     cf7:	83 ec 0c             	sub    $0xc,%esp
+     cfa:	6a 00                	push   $0x0
+     cfc:	b9 10 00 00 00       	mov    $0x10,%ecx
+     d01:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d04:	e8 a5 fe ff ff       	call   bae <printint>
+        ap++;
+     d09:	83 c7 04             	add    $0x4,%edi
+     d0c:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     d0f:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d12:	be 00 00 00 00       	mov    $0x0,%esi
+     d17:	e9 56 ff ff ff       	jmp    c72 <printf+0x39>
+        s = (char*)*ap;
+     d1c:	8b 45 94             	mov    -0x6c(%ebp),%eax
+     d1f:	8b 30                	mov    (%eax),%esi
+        ap++;
+     d21:	83 c0 04             	add    $0x4,%eax
+     d24:	89 45 94             	mov    %eax,-0x6c(%ebp)
+        if(s == 0)
+     d27:	85 f6                	test   %esi,%esi
+     d29:	75 15                	jne    d40 <printf+0x107>
+          s = "(null)";
+     d2b:	be c5 12 00 00       	mov    $0x12c5,%esi
+     d30:	eb 0e                	jmp    d40 <printf+0x107>
+          putc(o, *s);
+     d32:	0f be d2             	movsbl %dl,%edx
+     d35:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d38:	e8 2f fe ff ff       	call   b6c <putc>
+          s++;
+     d3d:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+     d40:	0f b6 16             	movzbl (%esi),%edx
+     d43:	84 d2                	test   %dl,%dl
+     d45:	75 eb                	jne    d32 <printf+0xf9>
+      state = 0;
+     d47:	be 00 00 00 00       	mov    $0x0,%esi
+     d4c:	e9 21 ff ff ff       	jmp    c72 <printf+0x39>
+        putc(o, *ap);
+     d51:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     d54:	0f be 17             	movsbl (%edi),%edx
+     d57:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d5a:	e8 0d fe ff ff       	call   b6c <putc>
+        ap++;
+     d5f:	83 c7 04             	add    $0x4,%edi
+     d62:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+      state = 0;
+     d65:	be 00 00 00 00       	mov    $0x0,%esi
+     d6a:	e9 03 ff ff ff       	jmp    c72 <printf+0x39>
+        putc(o, c);
+     d6f:	89 fa                	mov    %edi,%edx
+     d71:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d74:	e8 f3 fd ff ff       	call   b6c <putc>
+      state = 0;
+     d79:	be 00 00 00 00       	mov    $0x0,%esi
+     d7e:	e9 ef fe ff ff       	jmp    c72 <printf+0x39>
+        putc(o, '%');
+     d83:	ba 25 00 00 00       	mov    $0x25,%edx
+     d88:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d8b:	e8 dc fd ff ff       	call   b6c <putc>
+        putc(o, c);
+     d90:	89 fa                	mov    %edi,%edx
+     d92:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d95:	e8 d2 fd ff ff       	call   b6c <putc>
+      state = 0;
+     d9a:	be 00 00 00 00       	mov    $0x0,%esi
+     d9f:	e9 ce fe ff ff       	jmp    c72 <printf+0x39>
+    }
+  }
+  if(o->n > 0)
+     da4:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     da7:	85 c0                	test   %eax,%eax
+     da9:	7f 08                	jg     db3 <printf+0x17a>
+    bufwrite(fd, o->buf, o->n);
+}
+     dab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     dae:	5b                   	pop    %ebx
+     daf:	5e                   	pop    %esi
+     db0:	5f                   	pop    %edi
+     db1:	5d                   	pop    %ebp
+     db2:	c3                   	ret
+    bufwrite(fd, o->buf, o->n);
+     db3:	83 ec 04             	sub    $0x4,%esp
+     db6:	50                   	push   %eax
+     db7:	8d 45 a8             	lea    -0x58(%ebp),%eax
+     dba:	50                   	push   %eax
+     dbb:	ff 75 08             	push   0x8(%ebp)
+     dbe:	e8 91 f7 ff ff       	call   554 <bufwrite>
+     dc3:	83 c4 10             	add    $0x10,%esp
+}
+     dc6:	eb e3                	jmp    dab <printf+0x172>
+
+00000dc8 <largefree>:
+  return &b->h;
+}
+
+static void
+largefree(Fblock *b)
+{
+     dc8:	55                   	push   %ebp
+     dc9:	89 e5                	mov    %esp,%ebp
+     dcb:	57                   	push   %edi
+     dcc:	56                   	push   %esi
+     dcd:	53                   	push   %ebx
+     dce:	83 ec 0c             	sub    $0xc,%esp
+     dd1:	89 c1                	mov    %eax,%ecx
+  Fblock **pp, *p, *prev;
+
+  prev = 0;
+     dd3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     dd8:	ba 8c 3a 00 00       	mov    $0x3a8c,%edx
+     ddd:	eb 05                	jmp    de4 <largefree+0x1c>
+     ddf:	8d 50 08             	lea    0x8(%eax),%edx
+    prev = p;
+     de2:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     de4:	8b 02                	mov    (%edx),%eax
+     de6:	85 c0                	test   %eax,%eax
+     de8:	74 04                	je     dee <largefree+0x26>
+     dea:	39 c8                	cmp    %ecx,%eax
+     dec:	72 f1                	jb     ddf <largefree+0x17>
+  b->next = p;
+     dee:	89 41 08             	mov    %eax,0x8(%ecx)
+  if(p && (char*)b + b->h.size == (char*)p){
+     df1:	85 c0                	test   %eax,%eax
+     df3:	74 09                	je     dfe <largefree+0x36>
+     df5:	8b 31                	mov    (%ecx),%esi
+     df7:	8d 3c 31             	lea    (%ecx,%esi,1),%edi
+     dfa:	39 c7                	cmp    %eax,%edi
+     dfc:	74 21                	je     e1f <largefree+0x57>
+    b->h.size += p->h.size;
+    b->next = p->next;
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+     dfe:	85 db                	test   %ebx,%ebx
+     e00:	74 09                	je     e0b <largefree+0x43>
+     e02:	8b 03                	mov    (%ebx),%eax
+     e04:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+     e07:	39 ce                	cmp    %ecx,%esi
+     e09:	74 20                	je     e2b <largefree+0x63>
+    prev->h.size += b->h.size;
+    prev->next = b->next;
+  } else
+    *pp = b;
+     e0b:	89 0a                	mov    %ecx,(%edx)
+
+  // Give the top of the heap back.  With threads sharing the
+  // address space sbrk() cannot shrink it; keep the block then.
+  for(pp = &large; (*pp)->next; pp = &(*pp)->next)
+     e0d:	be 8c 3a 00 00       	mov    $0x3a8c,%esi
+     e12:	8b 1e                	mov    (%esi),%ebx
+     e14:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+     e18:	74 1d                	je     e37 <largefree+0x6f>
+     e1a:	8d 73 08             	lea    0x8(%ebx),%esi
+     e1d:	eb f3                	jmp    e12 <largefree+0x4a>
+    b->h.size += p->h.size;
+     e1f:	03 30                	add    (%eax),%esi
+     e21:	89 31                	mov    %esi,(%ecx)
+    b->next = p->next;
+     e23:	8b 40 08             	mov    0x8(%eax),%eax
+     e26:	89 41 08             	mov    %eax,0x8(%ecx)
+     e29:	eb d3                	jmp    dfe <largefree+0x36>
+    prev->h.size += b->h.size;
+     e2b:	03 01                	add    (%ecx),%eax
+     e2d:	89 03                	mov    %eax,(%ebx)
+    prev->next = b->next;
+     e2f:	8b 41 08             	mov    0x8(%ecx),%eax
+     e32:	89 43 08             	mov    %eax,0x8(%ebx)
+     e35:	eb d6                	jmp    e0d <largefree+0x45>
+    ;
+  b = *pp;
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     e37:	89 df                	mov    %ebx,%edi
+     e39:	03 3b                	add    (%ebx),%edi
+     e3b:	83 ec 0c             	sub    $0xc,%esp
+     e3e:	6a 00                	push   $0x0
+     e40:	e8 93 fa ff ff       	call   8d8 <sbrk>
+     e45:	83 c4 10             	add    $0x10,%esp
+     e48:	39 c7                	cmp    %eax,%edi
+     e4a:	74 08                	je     e54 <largefree+0x8c>
+    *pp = 0;
+}
+     e4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e4f:	5b                   	pop    %ebx
+     e50:	5e                   	pop    %esi
+     e51:	5f                   	pop    %edi
+     e52:	5d                   	pop    %ebp
+     e53:	c3                   	ret
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     e54:	8b 03                	mov    (%ebx),%eax
+     e56:	f7 d8                	neg    %eax
+     e58:	83 ec 0c             	sub    $0xc,%esp
+     e5b:	50                   	push   %eax
+     e5c:	e8 77 fa ff ff       	call   8d8 <sbrk>
+     e61:	83 c4 10             	add    $0x10,%esp
+     e64:	83 f8 ff             	cmp    $0xffffffff,%eax
+     e67:	74 e3                	je     e4c <largefree+0x84>
+    *pp = 0;
+     e69:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+     e6f:	eb db                	jmp    e4c <largefree+0x84>
+
+00000e71 <more>:
+{
+     e71:	55                   	push   %ebp
+     e72:	89 e5                	mov    %esp,%ebp
+     e74:	56                   	push   %esi
+     e75:	53                   	push   %ebx
+     e76:	89 c6                	mov    %eax,%esi
+  pad = -(uint)sbrk(0) & 7;
+     e78:	83 ec 0c             	sub    $0xc,%esp
+     e7b:	6a 00                	push   $0x0
+     e7d:	e8 56 fa ff ff       	call   8d8 <sbrk>
+     e82:	f7 d8                	neg    %eax
+     e84:	89 c3                	mov    %eax,%ebx
+     e86:	83 e3 07             	and    $0x7,%ebx
+  if((p = sbrk(n + pad)) == (char*)-1)
+     e89:	01 de                	add    %ebx,%esi
+     e8b:	89 34 24             	mov    %esi,(%esp)
+     e8e:	e8 45 fa ff ff       	call   8d8 <sbrk>
+     e93:	83 c4 10             	add    $0x10,%esp
+     e96:	83 f8 ff             	cmp    $0xffffffff,%eax
+     e99:	74 09                	je     ea4 <more+0x33>
+  return p + pad;
+     e9b:	01 d8                	add    %ebx,%eax
+}
+     e9d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ea0:	5b                   	pop    %ebx
+     ea1:	5e                   	pop    %esi
+     ea2:	5d                   	pop    %ebp
+     ea3:	c3                   	ret
+    return 0;
+     ea4:	b8 00 00 00 00       	mov    $0x0,%eax
+     ea9:	eb f2                	jmp    e9d <more+0x2c>
+
+00000eab <slaballoc>:
+{
+     eab:	55                   	push   %ebp
+     eac:	89 e5                	mov    %esp,%ebp
+     eae:	56                   	push   %esi
+     eaf:	53                   	push   %ebx
+     eb0:	89 c6                	mov    %eax,%esi
+  n = 1 << (MINSHIFT + c);
+     eb2:	8d 48 04             	lea    0x4(%eax),%ecx
+     eb5:	bb 01 00 00 00       	mov    $0x1,%ebx
+     eba:	d3 e3                	shl    %cl,%ebx
+  if(slab + n > slabend){
+     ebc:	89 d8                	mov    %ebx,%eax
+     ebe:	03 05 88 3a 00 00    	add    0x3a88,%eax
+     ec4:	39 05 84 3a 00 00    	cmp    %eax,0x3a84
+     eca:	72 17                	jb     ee3 <slaballoc+0x38>
+  h = (Header*)slab;
+     ecc:	a1 88 3a 00 00       	mov    0x3a88,%eax
+  slab += n;
+     ed1:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+     ed4:	89 15 88 3a 00 00    	mov    %edx,0x3a88
+  h->size = n;
+     eda:	89 18                	mov    %ebx,(%eax)
+  h->class = c;
+     edc:	89 70 04             	mov    %esi,0x4(%eax)
+}
+     edf:	5b                   	pop    %ebx
+     ee0:	5e                   	pop    %esi
+     ee1:	5d                   	pop    %ebp
+     ee2:	c3                   	ret
+    if((p = more(SLABSZ)) == 0)
+     ee3:	b8 00 40 00 00       	mov    $0x4000,%eax
+     ee8:	e8 84 ff ff ff       	call   e71 <more>
+     eed:	85 c0                	test   %eax,%eax
+     eef:	74 ee                	je     edf <slaballoc+0x34>
+    if(p != slabend)
+     ef1:	39 05 84 3a 00 00    	cmp    %eax,0x3a84
+     ef7:	74 05                	je     efe <slaballoc+0x53>
+      slab = p;
+     ef9:	a3 88 3a 00 00       	mov    %eax,0x3a88
+    slabend = p + SLABSZ;
+     efe:	05 00 40 00 00       	add    $0x4000,%eax
+     f03:	a3 84 3a 00 00       	mov    %eax,0x3a84
+     f08:	eb c2                	jmp    ecc <slaballoc+0x21>
+
+00000f0a <largealloc>:
+{
+     f0a:	55                   	push   %ebp
+     f0b:	89 e5                	mov    %esp,%ebp
+     f0d:	56                   	push   %esi
+     f0e:	53                   	push   %ebx
+     f0f:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     f11:	b9 8c 3a 00 00       	mov    $0x3a8c,%ecx
+     f16:	8b 01                	mov    (%ecx),%eax
+     f18:	85 c0                	test   %eax,%eax
+     f1a:	74 36                	je     f52 <largealloc+0x48>
+    if(b->h.size < n)
+     f1c:	8b 10                	mov    (%eax),%edx
+     f1e:	39 da                	cmp    %ebx,%edx
+     f20:	72 24                	jb     f46 <largealloc+0x3c>
+    if(b->h.size - n > SMALLMAX){
+     f22:	29 da                	sub    %ebx,%edx
+     f24:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+     f2a:	76 1f                	jbe    f4b <largealloc+0x41>
+      rest = (Fblock*)((char*)b + n);
+     f2c:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+      rest->h.size = b->h.size - n;
+     f2f:	89 16                	mov    %edx,(%esi)
+      rest->h.class = LARGE;
+     f31:	c7 46 04 09 00 00 00 	movl   $0x9,0x4(%esi)
+      rest->next = b->next;
+     f38:	8b 50 08             	mov    0x8(%eax),%edx
+     f3b:	89 56 08             	mov    %edx,0x8(%esi)
+      *pp = rest;
+     f3e:	89 31                	mov    %esi,(%ecx)
+      b->h.size = n;
+     f40:	89 18                	mov    %ebx,(%eax)
+}
+     f42:	5b                   	pop    %ebx
+     f43:	5e                   	pop    %esi
+     f44:	5d                   	pop    %ebp
+     f45:	c3                   	ret
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     f46:	8d 48 08             	lea    0x8(%eax),%ecx
+     f49:	eb cb                	jmp    f16 <largealloc+0xc>
+      *pp = b->next;
+     f4b:	8b 50 08             	mov    0x8(%eax),%edx
+     f4e:	89 11                	mov    %edx,(%ecx)
+    return &b->h;
+     f50:	eb f0                	jmp    f42 <largealloc+0x38>
+  if((b = more(n)) == 0)
+     f52:	89 d8                	mov    %ebx,%eax
+     f54:	e8 18 ff ff ff       	call   e71 <more>
+     f59:	85 c0                	test   %eax,%eax
+     f5b:	74 e5                	je     f42 <largealloc+0x38>
+  b->h.size = n;
+     f5d:	89 18                	mov    %ebx,(%eax)
+  b->h.class = LARGE;
+     f5f:	c7 40 04 09 00 00 00 	movl   $0x9,0x4(%eax)
+  return &b->h;
+     f66:	eb da                	jmp    f42 <largealloc+0x38>
+
+00000f68 <free>:
+
+void
+free(void *ap)
+{
+     f68:	55                   	push   %ebp
+     f69:	89 e5                	mov    %esp,%ebp
+     f6b:	56                   	push   %esi
+     f6c:	53                   	push   %ebx
+     f6d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+
+  if(ap == 0)
+     f70:	85 db                	test   %ebx,%ebx
+     f72:	74 3b                	je     faf <free+0x47>
+    return;
+  h = (Header*)ap - 1;
+     f74:	8d 73 f8             	lea    -0x8(%ebx),%esi
+  lock_acquire(&lock);
+     f77:	83 ec 0c             	sub    $0xc,%esp
+     f7a:	68 80 3a 00 00       	push   $0x3a80
+     f7f:	e8 9c 01 00 00       	call   1120 <lock_acquire>
+  if(h->class == LARGE)
+     f84:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     f87:	83 c4 10             	add    $0x10,%esp
+     f8a:	83 f8 09             	cmp    $0x9,%eax
+     f8d:	74 27                	je     fb6 <free+0x4e>
+    largefree((Fblock*)h);
+  else {
+    ((Fblock*)h)->next = freelist[h->class];
+     f8f:	8b 14 85 a0 3a 00 00 	mov    0x3aa0(,%eax,4),%edx
+     f96:	89 13                	mov    %edx,(%ebx)
+    freelist[h->class] = (Fblock*)h;
+     f98:	89 34 85 a0 3a 00 00 	mov    %esi,0x3aa0(,%eax,4)
+  }
+  lock_release(&lock);
+     f9f:	83 ec 0c             	sub    $0xc,%esp
+     fa2:	68 80 3a 00 00       	push   $0x3a80
+     fa7:	e8 88 01 00 00       	call   1134 <lock_release>
+     fac:	83 c4 10             	add    $0x10,%esp
+}
+     faf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     fb2:	5b                   	pop    %ebx
+     fb3:	5e                   	pop    %esi
+     fb4:	5d                   	pop    %ebp
+     fb5:	c3                   	ret
+    largefree((Fblock*)h);
+     fb6:	89 f0                	mov    %esi,%eax
+     fb8:	e8 0b fe ff ff       	call   dc8 <largefree>
+     fbd:	eb e0                	jmp    f9f <free+0x37>
+
+00000fbf <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     fbf:	55                   	push   %ebp
+     fc0:	89 e5                	mov    %esp,%ebp
+     fc2:	53                   	push   %ebx
+     fc3:	83 ec 04             	sub    $0x4,%esp
+     fc6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+  uint n;
+  int c;
+
+  if(nbytes > 0x7fffffff - sizeof(Header) - 7)
+     fc9:	81 fb f0 ff ff 7f    	cmp    $0x7ffffff0,%ebx
+     fcf:	0f 87 8b 00 00 00    	ja     1060 <malloc+0xa1>
+    return 0;
+  n = (nbytes + sizeof(Header) + 7) & ~7;
+     fd5:	83 c3 0f             	add    $0xf,%ebx
+     fd8:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(n < sizeof(Fblock))
+     fdb:	83 fb 0b             	cmp    $0xb,%ebx
+     fde:	77 05                	ja     fe5 <malloc+0x26>
+    n = sizeof(Fblock);
+     fe0:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  lock_acquire(&lock);
+     fe5:	83 ec 0c             	sub    $0xc,%esp
+     fe8:	68 80 3a 00 00       	push   $0x3a80
+     fed:	e8 2e 01 00 00       	call   1120 <lock_acquire>
+  if(n <= SMALLMAX){
+     ff2:	83 c4 10             	add    $0x10,%esp
+     ff5:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+     ffb:	77 58                	ja     1055 <malloc+0x96>
+    for(c = 0; (1 << (MINSHIFT + c)) < n; c++)
+     ffd:	ba 00 00 00 00       	mov    $0x0,%edx
+    1002:	eb 03                	jmp    1007 <malloc+0x48>
+    1004:	83 c2 01             	add    $0x1,%edx
+    1007:	8d 4a 04             	lea    0x4(%edx),%ecx
+    100a:	b8 01 00 00 00       	mov    $0x1,%eax
+    100f:	d3 e0                	shl    %cl,%eax
+    1011:	39 d8                	cmp    %ebx,%eax
+    1013:	72 ef                	jb     1004 <malloc+0x45>
+      ;
+    if(freelist[c]){
+    1015:	8b 04 95 a0 3a 00 00 	mov    0x3aa0(,%edx,4),%eax
+    101c:	85 c0                	test   %eax,%eax
+    101e:	74 2a                	je     104a <malloc+0x8b>
+      h = &freelist[c]->h;
+    1020:	89 c3                	mov    %eax,%ebx
+      freelist[c] = freelist[c]->next;
+    1022:	8b 40 08             	mov    0x8(%eax),%eax
+    1025:	89 04 95 a0 3a 00 00 	mov    %eax,0x3aa0(,%edx,4)
+    } else
+      h = slaballoc(c);
+  } else
+    h = largealloc(n);
+  lock_release(&lock);
+    102c:	83 ec 0c             	sub    $0xc,%esp
+    102f:	68 80 3a 00 00       	push   $0x3a80
+    1034:	e8 fb 00 00 00       	call   1134 <lock_release>
+  return h ? (void*)(h + 1) : 0;
+    1039:	83 c4 10             	add    $0x10,%esp
+    103c:	85 db                	test   %ebx,%ebx
+    103e:	74 03                	je     1043 <malloc+0x84>
+    1040:	83 c3 08             	add    $0x8,%ebx
+}
+    1043:	89 d8                	mov    %ebx,%eax
+    1045:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1048:	c9                   	leave
+    1049:	c3                   	ret
+      h = slaballoc(c);
+    104a:	89 d0                	mov    %edx,%eax
+    104c:	e8 5a fe ff ff       	call   eab <slaballoc>
+    1051:	89 c3                	mov    %eax,%ebx
+    1053:	eb d7                	jmp    102c <malloc+0x6d>
+    h = largealloc(n);
+    1055:	89 d8                	mov    %ebx,%eax
+    1057:	e8 ae fe ff ff       	call   f0a <largealloc>
+    105c:	89 c3                	mov    %eax,%ebx
+    105e:	eb cc                	jmp    102c <malloc+0x6d>
+    return 0;
+    1060:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1065:	eb dc                	jmp    1043 <malloc+0x84>
+
+00001067 <tstart>:
+  void *arg;
+};
+
+static void
+tstart(void *a)
+{
+    1067:	55                   	push   %ebp
+    1068:	89 e5                	mov    %esp,%ebp
+    106a:	83 ec 14             	sub    $0x14,%esp
+    106d:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+    1070:	ff 70 04             	push   0x4(%eax)
+    1073:	ff 10                	call   *(%eax)
+  exit();
+    1075:	e8 86 f6 ff ff       	call   700 <exit>
+
+0000107a <thread_create>:
+}
+
+// Run fn(arg) in a new thread.  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    107a:	55                   	push   %ebp
+    107b:	89 e5                	mov    %esp,%ebp
+    107d:	56                   	push   %esi
+    107e:	53                   	push   %ebx
+  struct tstart *t;
+  char *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    107f:	83 ec 0c             	sub    $0xc,%esp
+    1082:	68 00 10 00 00       	push   $0x1000
+    1087:	e8 33 ff ff ff       	call   fbf <malloc>
+    108c:	83 c4 10             	add    $0x10,%esp
+    108f:	85 c0                	test   %eax,%eax
+    1091:	74 42                	je     10d5 <thread_create+0x5b>
+    1093:	89 c3                	mov    %eax,%ebx
+    return -1;
+  t = (struct tstart*)stack;
+  t->fn = fn;
+    1095:	8b 45 08             	mov    0x8(%ebp),%eax
+    1098:	89 03                	mov    %eax,(%ebx)
+  t->arg = arg;
+    109a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    109d:	89 43 04             	mov    %eax,0x4(%ebx)
+  if((pid = clone(tstart, stack + TSTACK, t)) < 0)
+    10a0:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    10a6:	83 ec 04             	sub    $0x4,%esp
+    10a9:	53                   	push   %ebx
+    10aa:	50                   	push   %eax
+    10ab:	68 67 10 00 00       	push   $0x1067
+    10b0:	e8 f5 f8 ff ff       	call   9aa <clone>
+    10b5:	89 c6                	mov    %eax,%esi
+    10b7:	83 c4 10             	add    $0x10,%esp
+    10ba:	85 c0                	test   %eax,%eax
+    10bc:	78 09                	js     10c7 <thread_create+0x4d>
+    free(stack);
+  return pid;
+}
+    10be:	89 f0                	mov    %esi,%eax
+    10c0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    10c3:	5b                   	pop    %ebx
+    10c4:	5e                   	pop    %esi
+    10c5:	5d                   	pop    %ebp
+    10c6:	c3                   	ret
+    free(stack);
+    10c7:	83 ec 0c             	sub    $0xc,%esp
+    10ca:	53                   	push   %ebx
+    10cb:	e8 98 fe ff ff       	call   f68 <free>
+    10d0:	83 c4 10             	add    $0x10,%esp
+    10d3:	eb e9                	jmp    10be <thread_create+0x44>
+    return -1;
+    10d5:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    10da:	eb e2                	jmp    10be <thread_create+0x44>
+
+000010dc <thread_join>:
+
+// Wait for one of this process's threads to exit and free its
+// stack.  Returns its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+    10dc:	55                   	push   %ebp
+    10dd:	89 e5                	mov    %esp,%ebp
+    10df:	53                   	push   %ebx
+    10e0:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    10e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    10e6:	50                   	push   %eax
+    10e7:	e8 cd f8 ff ff       	call   9b9 <join>
+    10ec:	89 c3                	mov    %eax,%ebx
+    10ee:	83 c4 10             	add    $0x10,%esp
+    10f1:	85 c0                	test   %eax,%eax
+    10f3:	79 07                	jns    10fc <thread_join+0x20>
+    free((char*)stack - TSTACK);
+  return pid;
+}
+    10f5:	89 d8                	mov    %ebx,%eax
+    10f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10fa:	c9                   	leave
+    10fb:	c3                   	ret
+    free((char*)stack - TSTACK);
+    10fc:	83 ec 0c             	sub    $0xc,%esp
+    10ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1102:	2d 00 10 00 00       	sub    $0x1000,%eax
+    1107:	50                   	push   %eax
+    1108:	e8 5b fe ff ff       	call   f68 <free>
+    110d:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    1110:	eb e3                	jmp    10f5 <thread_join+0x19>
+
+00001112 <lock_init>:
+
+void
+lock_init(lock_t *lk)
+{
+    1112:	55                   	push   %ebp
+    1113:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    1115:	8b 45 08             	mov    0x8(%ebp),%eax
+    1118:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    111e:	5d                   	pop    %ebp
+    111f:	c3                   	ret
+
+00001120 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+    1120:	55                   	push   %ebp
+    1121:	89 e5                	mov    %esp,%ebp
+    1123:	8b 55 08             	mov    0x8(%ebp),%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    1126:	b8 01 00 00 00       	mov    $0x1,%eax
+    112b:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    112e:	85 c0                	test   %eax,%eax
+    1130:	75 f4                	jne    1126 <lock_acquire+0x6>
+    ;
+}
+    1132:	5d                   	pop    %ebp
+    1133:	c3                   	ret
+
+00001134 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+    1134:	55                   	push   %ebp
+    1135:	89 e5                	mov    %esp,%ebp
+    1137:	8b 55 08             	mov    0x8(%ebp),%edx
+    113a:	b8 00 00 00 00       	mov    $0x0,%eax
+    113f:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    1142:	5d                   	pop    %ebp
+    1143:	c3                   	ret
+
+00001144 <mutex_init>:
+// Are Tricky": state is 0 when free, 1 when held, 2 when held and
+// others may be waiting.  Unlocking an uncontended mutex costs no
+// system call.
+void
+mutex_init(mutex_t *m)
+{
+    1144:	55                   	push   %ebp
+    1145:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    1147:	8b 45 08             	mov    0x8(%ebp),%eax
+    114a:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1150:	5d                   	pop    %ebp
+    1151:	c3                   	ret
+
+00001152 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+    1152:	55                   	push   %ebp
+    1153:	89 e5                	mov    %esp,%ebp
+    1155:	53                   	push   %ebx
+    1156:	83 ec 04             	sub    $0x4,%esp
+    1159:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    115c:	b8 00 00 00 00       	mov    $0x0,%eax
+    1161:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1166:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    116a:	85 c0                	test   %eax,%eax
+    116c:	74 29                	je     1197 <mutex_lock+0x45>
+    return;
+  if(c != 2)
+    116e:	83 f8 02             	cmp    $0x2,%eax
+    1171:	74 20                	je     1193 <mutex_lock+0x41>
+    1173:	b8 02 00 00 00       	mov    $0x2,%eax
+    1178:	f0 87 03             	lock xchg %eax,(%ebx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    117b:	eb 16                	jmp    1193 <mutex_lock+0x41>
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    117d:	83 ec 08             	sub    $0x8,%esp
+    1180:	6a 02                	push   $0x2
+    1182:	53                   	push   %ebx
+    1183:	e8 40 f8 ff ff       	call   9c8 <futex_wait>
+  asm volatile("lock; xchgl %0, %1" :
+    1188:	b8 02 00 00 00       	mov    $0x2,%eax
+    118d:	f0 87 03             	lock xchg %eax,(%ebx)
+    1190:	83 c4 10             	add    $0x10,%esp
+  while(c != 0){
+    1193:	85 c0                	test   %eax,%eax
+    1195:	75 e6                	jne    117d <mutex_lock+0x2b>
+    c = xchg(&m->state, 2);
+  }
+}
+    1197:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    119a:	c9                   	leave
+    119b:	c3                   	ret
+
+0000119c <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+    119c:	55                   	push   %ebp
+    119d:	89 e5                	mov    %esp,%ebp
+    119f:	83 ec 08             	sub    $0x8,%esp
+    11a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    11a5:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    11aa:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    11ae:	83 fa 01             	cmp    $0x1,%edx
+    11b1:	75 02                	jne    11b5 <mutex_unlock+0x19>
+    m->state = 0;
+    futex_wake(&m->state, 1);
+  }
+}
+    11b3:	c9                   	leave
+    11b4:	c3                   	ret
+    m->state = 0;
+    11b5:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+    11bb:	83 ec 08             	sub    $0x8,%esp
+    11be:	6a 01                	push   $0x1
+    11c0:	50                   	push   %eax
+    11c1:	e8 11 f8 ff ff       	call   9d7 <futex_wake>
+    11c6:	83 c4 10             	add    $0x10,%esp
+}
+    11c9:	eb e8                	jmp    11b3 <mutex_unlock+0x17>
+
+000011cb <cond_init>:
+// Condition variable: waiters sleep on a sequence number that
+// every signal bumps, so a signal between the unlock and the
+// futex_wait() in cond_wait() is not lost.
+void
+cond_init(cond_t *c)
+{
+    11cb:	55                   	push   %ebp
+    11cc:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    11ce:	8b 45 08             	mov    0x8(%ebp),%eax
+    11d1:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    11d7:	5d                   	pop    %ebp
+    11d8:	c3                   	ret
+
+000011d9 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+    11d9:	55                   	push   %ebp
+    11da:	89 e5                	mov    %esp,%ebp
+    11dc:	57                   	push   %edi
+    11dd:	56                   	push   %esi
+    11de:	53                   	push   %ebx
+    11df:	83 ec 18             	sub    $0x18,%esp
+    11e2:	8b 75 08             	mov    0x8(%ebp),%esi
+    11e5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    11e8:	8b 3e                	mov    (%esi),%edi
+  mutex_unlock(m);
+    11ea:	53                   	push   %ebx
+    11eb:	e8 ac ff ff ff       	call   119c <mutex_unlock>
+  futex_wait(&c->seq, seq);
+    11f0:	83 c4 08             	add    $0x8,%esp
+    11f3:	57                   	push   %edi
+    11f4:	56                   	push   %esi
+    11f5:	e8 ce f7 ff ff       	call   9c8 <futex_wait>
+  // Others may be waiting for m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+    11fa:	83 c4 10             	add    $0x10,%esp
+    11fd:	eb 0e                	jmp    120d <cond_wait+0x34>
+    futex_wait(&m->state, 2);
+    11ff:	83 ec 08             	sub    $0x8,%esp
+    1202:	6a 02                	push   $0x2
+    1204:	53                   	push   %ebx
+    1205:	e8 be f7 ff ff       	call   9c8 <futex_wait>
+    120a:	83 c4 10             	add    $0x10,%esp
+    120d:	b8 02 00 00 00       	mov    $0x2,%eax
+    1212:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    1215:	85 c0                	test   %eax,%eax
+    1217:	75 e6                	jne    11ff <cond_wait+0x26>
+}
+    1219:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    121c:	5b                   	pop    %ebx
+    121d:	5e                   	pop    %esi
+    121e:	5f                   	pop    %edi
+    121f:	5d                   	pop    %ebp
+    1220:	c3                   	ret
+
+00001221 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+    1221:	55                   	push   %ebp
+    1222:	89 e5                	mov    %esp,%ebp
+    1224:	83 ec 10             	sub    $0x10,%esp
+    1227:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    122a:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+    122e:	6a 01                	push   $0x1
+    1230:	50                   	push   %eax
+    1231:	e8 a1 f7 ff ff       	call   9d7 <futex_wake>
+}
+    1236:	83 c4 10             	add    $0x10,%esp
+    1239:	c9                   	leave
+    123a:	c3                   	ret
+
+0000123b <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+    123b:	55                   	push   %ebp
+    123c:	89 e5                	mov    %esp,%ebp
+    123e:	83 ec 10             	sub    $0x10,%esp
+    1241:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    1244:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, NPROC);
+    1248:	6a 40                	push   $0x40
+    124a:	50                   	push   %eax
+    124b:	e8 87 f7 ff ff       	call   9d7 <futex_wake>
+}
+    1250:	83 c4 10             	add    $0x10,%esp
+    1253:	c9                   	leave
+    1254:	c3                   	ret
@@ -0,0 +1,2766 @@
+
+_tsbrk2:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <recursive>:
+#include "types.h"
+#include "user.h"
+
+int recursive(int v)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	56                   	push   %esi
+       4:	53                   	push   %ebx
+       5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  printf (1, ".");
+       8:	83 ec 08             	sub    $0x8,%esp
+       b:	68 04 12 00 00       	push   $0x1204
+      10:	6a 01                	push   $0x1
+      12:	e8 d1 0b 00 00       	call   be8 <printf>
+  if (v > 0)
+      17:	83 c4 10             	add    $0x10,%esp
+      1a:	85 db                	test   %ebx,%ebx
+      1c:	7f 0c                	jg     2a <recursive+0x2a>
+    return recursive (v+1)+recursive (v+2);
+  return 0;
+      1e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+      23:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      26:	5b                   	pop    %ebx
+      27:	5e                   	pop    %esi
+      28:	5d                   	pop    %ebp
+      29:	c3                   	ret
+    return recursive (v+1)+recursive (v+2);
+      2a:	83 ec 0c             	sub    $0xc,%esp
+      2d:	8d 43 01             	lea    0x1(%ebx),%eax
+      30:	50                   	push   %eax
+      31:	e8 ca ff ff ff       	call   0 <recursive>
+      36:	89 c6                	mov    %eax,%esi
+      38:	83 c3 02             	add    $0x2,%ebx
+      3b:	89 1c 24             	mov    %ebx,(%esp)
+      3e:	e8 bd ff ff ff       	call   0 <recursive>
+      43:	01 f0                	add    %esi,%eax
+      45:	83 c4 10             	add    $0x10,%esp
+      48:	eb d9                	jmp    23 <recursive+0x23>
+
+0000004a <main>:
+
+
+int
+main(int argc, char *argv[])
+{
+      4a:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+      4e:	83 e4 f0             	and    $0xfffffff0,%esp
+      51:	ff 71 fc             	push   -0x4(%ecx)
+      54:	55                   	push   %ebp
+      55:	89 e5                	mov    %esp,%ebp
+      57:	51                   	push   %ecx
+      58:	83 ec 10             	sub    $0x10,%esp
+  int i = 1;
+
+  // Llamar recursivamente a recursive
+  printf (1, ": %d\n", recursive (i));
+      5b:	6a 01                	push   $0x1
+      5d:	e8 9e ff ff ff       	call   0 <recursive>
+      62:	83 c4 0c             	add    $0xc,%esp
+      65:	50                   	push   %eax
+      66:	68 06 12 00 00       	push   $0x1206
+      6b:	6a 01                	push   $0x1
+      6d:	e8 76 0b 00 00       	call   be8 <printf>
+
+  exit();
+      72:	e8 38 06 00 00       	call   6af <exit>
+
+00000077 <strcpy>:
+#include "memlayout.h"
+#include "clock.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+      77:	55                   	push   %ebp
+      78:	89 e5                	mov    %esp,%ebp
+      7a:	56                   	push   %esi
+      7b:	53                   	push   %ebx
+      7c:	8b 75 08             	mov    0x8(%ebp),%esi
+      7f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+      82:	89 f0                	mov    %esi,%eax
+      84:	89 d1                	mov    %edx,%ecx
+      86:	83 c2 01             	add    $0x1,%edx
+      89:	89 c3                	mov    %eax,%ebx
+      8b:	83 c0 01             	add    $0x1,%eax
+      8e:	0f b6 09             	movzbl (%ecx),%ecx
+      91:	88 0b                	mov    %cl,(%ebx)
+      93:	84 c9                	test   %cl,%cl
+      95:	75 ed                	jne    84 <strcpy+0xd>
+    ;
+  return os;
+}
+      97:	89 f0                	mov    %esi,%eax
+      99:	5b                   	pop    %ebx
+      9a:	5e                   	pop    %esi
+      9b:	5d                   	pop    %ebp
+      9c:	c3                   	ret
+
+0000009d <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+      9d:	55                   	push   %ebp
+      9e:	89 e5                	mov    %esp,%ebp
+      a0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      a3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+      a6:	eb 06                	jmp    ae <strcmp+0x11>
+    p++, q++;
+      a8:	83 c1 01             	add    $0x1,%ecx
+      ab:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+      ae:	0f b6 01             	movzbl (%ecx),%eax
+      b1:	84 c0                	test   %al,%al
+      b3:	74 04                	je     b9 <strcmp+0x1c>
+      b5:	3a 02                	cmp    (%edx),%al
+      b7:	74 ef                	je     a8 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+      b9:	0f b6 c0             	movzbl %al,%eax
+      bc:	0f b6 12             	movzbl (%edx),%edx
+      bf:	29 d0                	sub    %edx,%eax
+}
+      c1:	5d                   	pop    %ebp
+      c2:	c3                   	ret
+
+000000c3 <strlen>:
+
+uint
+strlen(const char *s)
+{
+      c3:	55                   	push   %ebp
+      c4:	89 e5                	mov    %esp,%ebp
+      c6:	53                   	push   %ebx
+      c7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  const char *p;
+  uint w;
+
+  for(p = s; (uint)p & 3; p++)
+      ca:	89 c8                	mov    %ecx,%eax
+      cc:	eb 03                	jmp    d1 <strlen+0xe>
+      ce:	83 c0 01             	add    $0x1,%eax
+      d1:	a8 03                	test   $0x3,%al
+      d3:	74 09                	je     de <strlen+0x1b>
+    if(*p == 0)
+      d5:	80 38 00             	cmpb   $0x0,(%eax)
+      d8:	75 f4                	jne    ce <strlen+0xb>
+      return p - s;
+      da:	29 c8                	sub    %ecx,%eax
+      dc:	eb 25                	jmp    103 <strlen+0x40>
+  // Then a word at a time, which never crosses into the next page:
+  // a word with a zero byte in it has one of these bits set.
+  for(;; p += 4){
+    w = *(uint*)p;
+      de:	8b 10                	mov    (%eax),%edx
+    if((w - 0x01010101) & ~w & 0x80808080)
+      e0:	8d 9a ff fe fe fe    	lea    -0x1010101(%edx),%ebx
+      e6:	f7 d2                	not    %edx
+      e8:	21 da                	and    %ebx,%edx
+      ea:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+      f0:	75 05                	jne    f7 <strlen+0x34>
+  for(;; p += 4){
+      f2:	83 c0 04             	add    $0x4,%eax
+    w = *(uint*)p;
+      f5:	eb e7                	jmp    de <strlen+0x1b>
+      break;
+  }
+  while(*p)
+      f7:	80 38 00             	cmpb   $0x0,(%eax)
+      fa:	74 05                	je     101 <strlen+0x3e>
+    p++;
+      fc:	83 c0 01             	add    $0x1,%eax
+      ff:	eb f6                	jmp    f7 <strlen+0x34>
+  return p - s;
+     101:	29 c8                	sub    %ecx,%eax
+}
+     103:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     106:	c9                   	leave
+     107:	c3                   	ret
+
+00000108 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     108:	55                   	push   %ebp
+     109:	89 e5                	mov    %esp,%ebp
+     10b:	57                   	push   %edi
+     10c:	56                   	push   %esi
+     10d:	53                   	push   %ebx
+     10e:	8b 55 10             	mov    0x10(%ebp),%edx
+  uint h;
+  char *d;
+
+  d = dst;
+  c &= 0xFF;
+     111:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  if(n >= 16){
+     115:	83 fa 0f             	cmp    $0xf,%edx
+     118:	76 52                	jbe    16c <memset+0x64>
+    h = -(uint)d & 3;
+     11a:	8b 45 08             	mov    0x8(%ebp),%eax
+     11d:	f7 d8                	neg    %eax
+     11f:	83 e0 03             	and    $0x3,%eax
+     122:	89 c6                	mov    %eax,%esi
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     124:	8b 7d 08             	mov    0x8(%ebp),%edi
+     127:	89 c1                	mov    %eax,%ecx
+     129:	89 d8                	mov    %ebx,%eax
+     12b:	fc                   	cld
+     12c:	f3 aa                	rep stos %al,%es:(%edi)
+    stosb(d, c, h);
+    stosl(d + h, (c<<24)|(c<<16)|(c<<8)|c, (n - h)/4);
+     12e:	29 f2                	sub    %esi,%edx
+     130:	89 d1                	mov    %edx,%ecx
+     132:	c1 e9 02             	shr    $0x2,%ecx
+     135:	c1 e0 18             	shl    $0x18,%eax
+     138:	89 df                	mov    %ebx,%edi
+     13a:	c1 e7 10             	shl    $0x10,%edi
+     13d:	09 f8                	or     %edi,%eax
+     13f:	89 df                	mov    %ebx,%edi
+     141:	c1 e7 08             	shl    $0x8,%edi
+     144:	09 f8                	or     %edi,%eax
+     146:	09 d8                	or     %ebx,%eax
+     148:	89 f7                	mov    %esi,%edi
+     14a:	03 7d 08             	add    0x8(%ebp),%edi
+}
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosl" :
+     14d:	fc                   	cld
+     14e:	f3 ab                	rep stos %eax,%es:(%edi)
+    d += h + (n - h)/4*4;
+     150:	89 d7                	mov    %edx,%edi
+     152:	83 e7 fc             	and    $0xfffffffc,%edi
+     155:	09 f7                	or     %esi,%edi
+     157:	03 7d 08             	add    0x8(%ebp),%edi
+    n = (n - h)%4;
+     15a:	83 e2 03             	and    $0x3,%edx
+  asm volatile("cld; rep stosb" :
+     15d:	89 d1                	mov    %edx,%ecx
+     15f:	89 d8                	mov    %ebx,%eax
+     161:	fc                   	cld
+     162:	f3 aa                	rep stos %al,%es:(%edi)
+  }
+  stosb(d, c, n);
+  return dst;
+}
+     164:	8b 45 08             	mov    0x8(%ebp),%eax
+     167:	5b                   	pop    %ebx
+     168:	5e                   	pop    %esi
+     169:	5f                   	pop    %edi
+     16a:	5d                   	pop    %ebp
+     16b:	c3                   	ret
+  d = dst;
+     16c:	8b 7d 08             	mov    0x8(%ebp),%edi
+     16f:	eb ec                	jmp    15d <memset+0x55>
+
+00000171 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     171:	55                   	push   %ebp
+     172:	89 e5                	mov    %esp,%ebp
+     174:	8b 45 08             	mov    0x8(%ebp),%eax
+     177:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     17b:	eb 03                	jmp    180 <strchr+0xf>
+     17d:	83 c0 01             	add    $0x1,%eax
+     180:	0f b6 10             	movzbl (%eax),%edx
+     183:	84 d2                	test   %dl,%dl
+     185:	74 06                	je     18d <strchr+0x1c>
+    if(*s == c)
+     187:	38 ca                	cmp    %cl,%dl
+     189:	75 f2                	jne    17d <strchr+0xc>
+     18b:	eb 05                	jmp    192 <strchr+0x21>
+      return (char*)s;
+  return 0;
+     18d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     192:	5d                   	pop    %ebp
+     193:	c3                   	ret
+
+00000194 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     194:	55                   	push   %ebp
+     195:	89 e5                	mov    %esp,%ebp
+     197:	56                   	push   %esi
+     198:	53                   	push   %ebx
+     199:	8b 55 08             	mov    0x8(%ebp),%edx
+     19c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     19f:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  // A word at a time while they agree.
+  if((((uint)s1 | (uint)s2) & 3) == 0)
+     1a2:	89 d3                	mov    %edx,%ebx
+     1a4:	09 cb                	or     %ecx,%ebx
+     1a6:	f6 c3 03             	test   $0x3,%bl
+     1a9:	74 24                	je     1cf <memcmp+0x3b>
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+      s1 += 4, s2 += 4;
+  while(n-- > 0){
+     1ab:	8d 70 ff             	lea    -0x1(%eax),%esi
+     1ae:	85 c0                	test   %eax,%eax
+     1b0:	74 32                	je     1e4 <memcmp+0x50>
+    if(*s1 != *s2)
+     1b2:	0f b6 02             	movzbl (%edx),%eax
+     1b5:	0f b6 19             	movzbl (%ecx),%ebx
+     1b8:	38 d8                	cmp    %bl,%al
+     1ba:	75 20                	jne    1dc <memcmp+0x48>
+      return *s1 - *s2;
+    s1++, s2++;
+     1bc:	83 c2 01             	add    $0x1,%edx
+     1bf:	83 c1 01             	add    $0x1,%ecx
+  while(n-- > 0){
+     1c2:	89 f0                	mov    %esi,%eax
+     1c4:	eb e5                	jmp    1ab <memcmp+0x17>
+      s1 += 4, s2 += 4;
+     1c6:	83 c2 04             	add    $0x4,%edx
+     1c9:	83 c1 04             	add    $0x4,%ecx
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+     1cc:	83 e8 04             	sub    $0x4,%eax
+     1cf:	83 f8 03             	cmp    $0x3,%eax
+     1d2:	76 d7                	jbe    1ab <memcmp+0x17>
+     1d4:	8b 31                	mov    (%ecx),%esi
+     1d6:	39 32                	cmp    %esi,(%edx)
+     1d8:	74 ec                	je     1c6 <memcmp+0x32>
+     1da:	eb cf                	jmp    1ab <memcmp+0x17>
+      return *s1 - *s2;
+     1dc:	0f b6 c0             	movzbl %al,%eax
+     1df:	0f b6 db             	movzbl %bl,%ebx
+     1e2:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     1e4:	5b                   	pop    %ebx
+     1e5:	5e                   	pop    %esi
+     1e6:	5d                   	pop    %ebp
+     1e7:	c3                   	ret
+
+000001e8 <memchr>:
+// The first c in the n bytes at v, or 0.  Once aligned, a word at
+// a time, with the word's bytes that equal c turned into zeroes
+// and those looked for.
+void*
+memchr(const void *v, int c, uint n)
+{
+     1e8:	55                   	push   %ebp
+     1e9:	89 e5                	mov    %esp,%ebp
+     1eb:	57                   	push   %edi
+     1ec:	56                   	push   %esi
+     1ed:	53                   	push   %ebx
+     1ee:	8b 45 08             	mov    0x8(%ebp),%eax
+     1f1:	8b 55 10             	mov    0x10(%ebp),%edx
+  const uchar *s;
+  uint w, rep;
+
+  s = v;
+  c = (uchar)c;
+     1f4:	0f b6 75 0c          	movzbl 0xc(%ebp),%esi
+  for(; n > 0 && ((uint)s & 3); n--, s++)
+     1f8:	eb 06                	jmp    200 <memchr+0x18>
+     1fa:	83 ea 01             	sub    $0x1,%edx
+     1fd:	83 c0 01             	add    $0x1,%eax
+     200:	85 d2                	test   %edx,%edx
+     202:	74 0d                	je     211 <memchr+0x29>
+     204:	a8 03                	test   $0x3,%al
+     206:	74 09                	je     211 <memchr+0x29>
+    if(*s == c)
+     208:	0f b6 08             	movzbl (%eax),%ecx
+     20b:	39 f1                	cmp    %esi,%ecx
+     20d:	75 eb                	jne    1fa <memchr+0x12>
+     20f:	eb 41                	jmp    252 <memchr+0x6a>
+      return (void*)s;
+  rep = c * 0x01010101;
+     211:	69 fe 01 01 01 01    	imul   $0x1010101,%esi,%edi
+  for(; n >= 4; n -= 4, s += 4){
+     217:	eb 06                	jmp    21f <memchr+0x37>
+     219:	83 ea 04             	sub    $0x4,%edx
+     21c:	83 c0 04             	add    $0x4,%eax
+     21f:	83 fa 03             	cmp    $0x3,%edx
+     222:	76 16                	jbe    23a <memchr+0x52>
+    w = *(uint*)s ^ rep;
+     224:	89 f9                	mov    %edi,%ecx
+     226:	33 08                	xor    (%eax),%ecx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     228:	8d 99 ff fe fe fe    	lea    -0x1010101(%ecx),%ebx
+     22e:	f7 d1                	not    %ecx
+     230:	21 cb                	and    %ecx,%ebx
+     232:	f7 c3 80 80 80 80    	test   $0x80808080,%ebx
+     238:	74 df                	je     219 <memchr+0x31>
+      break;
+  }
+  for(; n > 0; n--, s++)
+     23a:	85 d2                	test   %edx,%edx
+     23c:	74 0f                	je     24d <memchr+0x65>
+    if(*s == c)
+     23e:	0f b6 08             	movzbl (%eax),%ecx
+     241:	39 f1                	cmp    %esi,%ecx
+     243:	74 0d                	je     252 <memchr+0x6a>
+  for(; n > 0; n--, s++)
+     245:	83 ea 01             	sub    $0x1,%edx
+     248:	83 c0 01             	add    $0x1,%eax
+     24b:	eb ed                	jmp    23a <memchr+0x52>
+      return (void*)s;
+  return 0;
+     24d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     252:	5b                   	pop    %ebx
+     253:	5e                   	pop    %esi
+     254:	5f                   	pop    %edi
+     255:	5d                   	pop    %ebp
+     256:	c3                   	ret
+
+00000257 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     257:	55                   	push   %ebp
+     258:	89 e5                	mov    %esp,%ebp
+     25a:	57                   	push   %edi
+     25b:	56                   	push   %esi
+     25c:	53                   	push   %ebx
+     25d:	83 ec 1c             	sub    $0x1c,%esp
+     260:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     263:	bb 00 00 00 00       	mov    $0x0,%ebx
+     268:	89 de                	mov    %ebx,%esi
+     26a:	83 c3 01             	add    $0x1,%ebx
+     26d:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     270:	7d 2e                	jge    2a0 <gets+0x49>
+    cc = read(0, &c, 1);
+     272:	83 ec 04             	sub    $0x4,%esp
+     275:	6a 01                	push   $0x1
+     277:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     27a:	50                   	push   %eax
+     27b:	6a 00                	push   $0x0
+     27d:	e8 51 05 00 00       	call   7d3 <read>
+    if(cc < 1)
+     282:	83 c4 10             	add    $0x10,%esp
+     285:	85 c0                	test   %eax,%eax
+     287:	7e 17                	jle    2a0 <gets+0x49>
+      break;
+    buf[i++] = c;
+     289:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     28d:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+     290:	3c 0a                	cmp    $0xa,%al
+     292:	0f 94 c2             	sete   %dl
+     295:	3c 0d                	cmp    $0xd,%al
+     297:	0f 94 c0             	sete   %al
+     29a:	08 c2                	or     %al,%dl
+     29c:	74 ca                	je     268 <gets+0x11>
+    buf[i++] = c;
+     29e:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+     2a0:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+     2a4:	89 f8                	mov    %edi,%eax
+     2a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     2a9:	5b                   	pop    %ebx
+     2aa:	5e                   	pop    %esi
+     2ab:	5f                   	pop    %edi
+     2ac:	5d                   	pop    %ebp
+     2ad:	c3                   	ret
+
+000002ae <atoi>:
+  return r;
+}
+
+int
+atoi(const char *s)
+{
+     2ae:	55                   	push   %ebp
+     2af:	89 e5                	mov    %esp,%ebp
+     2b1:	53                   	push   %ebx
+     2b2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+     2b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+     2ba:	eb 10                	jmp    2cc <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+     2bc:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+     2bf:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+     2c2:	83 c1 01             	add    $0x1,%ecx
+     2c5:	0f be c0             	movsbl %al,%eax
+     2c8:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+     2cc:	0f b6 01             	movzbl (%ecx),%eax
+     2cf:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     2d2:	80 fb 09             	cmp    $0x9,%bl
+     2d5:	76 e5                	jbe    2bc <atoi+0xe>
+  return n;
+}
+     2d7:	89 d0                	mov    %edx,%eax
+     2d9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2dc:	c9                   	leave
+     2dd:	c3                   	ret
+
+000002de <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     2de:	55                   	push   %ebp
+     2df:	89 e5                	mov    %esp,%ebp
+     2e1:	57                   	push   %edi
+     2e2:	56                   	push   %esi
+     2e3:	53                   	push   %ebx
+     2e4:	83 ec 08             	sub    $0x8,%esp
+     2e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     2ea:	8b 55 0c             	mov    0xc(%ebp),%edx
+     2ed:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *src;
+  int h;
+
+  dst = vdst;
+  src = vsrc;
+  if(n <= 0)
+     2f0:	85 c0                	test   %eax,%eax
+     2f2:	0f 8e 82 00 00 00    	jle    37a <memmove+0x9c>
+    return vdst;
+  if(src < dst && src + n > dst){
+     2f8:	39 da                	cmp    %ebx,%edx
+     2fa:	73 07                	jae    303 <memmove+0x25>
+     2fc:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+     2ff:	39 cb                	cmp    %ecx,%ebx
+     301:	72 5e                	jb     361 <memmove+0x83>
+    movsbback(dst + n - 1, src + n - 1, n);
+    return vdst;
+  }
+  if(n >= 16 && (((uint)dst ^ (uint)src) & 3) == 0){
+     303:	83 f8 0f             	cmp    $0xf,%eax
+     306:	7e 69                	jle    371 <memmove+0x93>
+     308:	89 d9                	mov    %ebx,%ecx
+     30a:	31 d1                	xor    %edx,%ecx
+     30c:	f6 c1 03             	test   $0x3,%cl
+     30f:	75 73                	jne    384 <memmove+0xa6>
+    h = -(uint)dst & 3;
+     311:	89 d9                	mov    %ebx,%ecx
+     313:	f7 d9                	neg    %ecx
+     315:	83 e1 03             	and    $0x3,%ecx
+}
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsb" :
+     318:	89 df                	mov    %ebx,%edi
+     31a:	89 d6                	mov    %edx,%esi
+     31c:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+     31f:	fc                   	cld
+     320:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    movsb(dst, src, h);
+    dst += h, src += h, n -= h;
+     322:	8b 75 f0             	mov    -0x10(%ebp),%esi
+     325:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+     328:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+     32b:	29 f0                	sub    %esi,%eax
+    movsl(dst, src, n/4);
+     32d:	8d 50 03             	lea    0x3(%eax),%edx
+     330:	0f 49 d0             	cmovns %eax,%edx
+     333:	c1 fa 02             	sar    $0x2,%edx
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+     336:	89 7d f0             	mov    %edi,-0x10(%ebp)
+     339:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     33c:	89 ce                	mov    %ecx,%esi
+     33e:	89 d1                	mov    %edx,%ecx
+     340:	fc                   	cld
+     341:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    dst += n/4*4, src += n/4*4, n %= 4;
+     343:	c1 e2 02             	shl    $0x2,%edx
+     346:	8b 7d f0             	mov    -0x10(%ebp),%edi
+     349:	01 d7                	add    %edx,%edi
+     34b:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     34e:	01 ca                	add    %ecx,%edx
+     350:	89 c6                	mov    %eax,%esi
+     352:	c1 fe 1f             	sar    $0x1f,%esi
+     355:	c1 ee 1e             	shr    $0x1e,%esi
+     358:	01 f0                	add    %esi,%eax
+     35a:	83 e0 03             	and    $0x3,%eax
+     35d:	29 f0                	sub    %esi,%eax
+     35f:	eb 12                	jmp    373 <memmove+0x95>
+    movsbback(dst + n - 1, src + n - 1, n);
+     361:	8d 78 ff             	lea    -0x1(%eax),%edi
+     364:	8d 34 3a             	lea    (%edx,%edi,1),%esi
+     367:	01 df                	add    %ebx,%edi
+// Copy cnt bytes down from the last ones, at dst and src, to the
+// first: for overlapping moves up.
+static inline void
+movsbback(void *dst, const void *src, int cnt)
+{
+  asm volatile("std; rep movsb; cld" :
+     369:	89 c1                	mov    %eax,%ecx
+     36b:	fd                   	std
+     36c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     36e:	fc                   	cld
+    return vdst;
+     36f:	eb 09                	jmp    37a <memmove+0x9c>
+  dst = vdst;
+     371:	89 df                	mov    %ebx,%edi
+  asm volatile("cld; rep movsb" :
+     373:	89 d6                	mov    %edx,%esi
+     375:	89 c1                	mov    %eax,%ecx
+     377:	fc                   	cld
+     378:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  }
+  movsb(dst, src, n);
+  return vdst;
+}
+     37a:	89 d8                	mov    %ebx,%eax
+     37c:	83 c4 08             	add    $0x8,%esp
+     37f:	5b                   	pop    %ebx
+     380:	5e                   	pop    %esi
+     381:	5f                   	pop    %edi
+     382:	5d                   	pop    %ebp
+     383:	c3                   	ret
+  dst = vdst;
+     384:	89 df                	mov    %ebx,%edi
+     386:	eb eb                	jmp    373 <memmove+0x95>
+
+00000388 <vclock_gettime>:
+
+// clock_gettime() without a system call: read the clock page
+// that the kernel maps at CLOCKPAGE (see clock.h).
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+     388:	55                   	push   %ebp
+     389:	89 e5                	mov    %esp,%ebp
+     38b:	57                   	push   %edi
+     38c:	56                   	push   %esi
+     38d:	53                   	push   %ebx
+     38e:	83 ec 14             	sub    $0x14,%esp
+  struct clockpage *cp = (struct clockpage*)CLOCKPAGE;
+  uint seq, rem, d;
+  uint64 tsc, ns, now;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+     391:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     395:	0f 87 a3 00 00 00    	ja     43e <vclock_gettime+0xb6>
+    return -1;
+  do {
+    seq = cp->seq;
+     39b:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+    __sync_synchronize();
+     3a0:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    tsc = cp->tsc;
+     3a5:	8b 15 10 f0 ff 7f    	mov    0x7ffff010,%edx
+     3ab:	8b 1d 14 f0 ff 7f    	mov    0x7ffff014,%ebx
+    ns = cp->ns;
+     3b1:	8b 35 18 f0 ff 7f    	mov    0x7ffff018,%esi
+     3b7:	8b 3d 1c f0 ff 7f    	mov    0x7ffff01c,%edi
+    __sync_synchronize();
+     3bd:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != cp->seq);
+     3c2:	89 c1                	mov    %eax,%ecx
+     3c4:	83 e1 01             	and    $0x1,%ecx
+     3c7:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     3ca:	75 cf                	jne    39b <vclock_gettime+0x13>
+     3cc:	8b 0d 00 f0 ff 7f    	mov    0x7ffff000,%ecx
+     3d2:	39 c1                	cmp    %eax,%ecx
+     3d4:	75 c5                	jne    39b <vclock_gettime+0x13>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+     3d6:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     3d9:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     3dc:	0f 31                	rdtsc
+     3de:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     3e1:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     3e4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  now = rdtsc();
+  // Less than a tick has passed since the update, so the delta
+  // fits in 32 bits.
+  d = now > tsc ? now - tsc : 0;
+     3e7:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     3ea:	19 d3                	sbb    %edx,%ebx
+     3ec:	73 07                	jae    3f5 <vclock_gettime+0x6d>
+     3ee:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+     3f1:	29 d8                	sub    %ebx,%eax
+     3f3:	89 c1                	mov    %eax,%ecx
+  ns += ((uint64)d * cp->mult) >> cp->shift;
+     3f5:	89 c8                	mov    %ecx,%eax
+     3f7:	f7 25 04 f0 ff 7f    	mull   0x7ffff004
+     3fd:	0f b6 0d 08 f0 ff 7f 	movzbl 0x7ffff008,%ecx
+     404:	0f ad d0             	shrd   %cl,%edx,%eax
+     407:	d3 ea                	shr    %cl,%edx
+     409:	f6 c1 20             	test   $0x20,%cl
+     40c:	74 04                	je     412 <vclock_gettime+0x8a>
+     40e:	89 d0                	mov    %edx,%eax
+     410:	31 d2                	xor    %edx,%edx
+     412:	01 f0                	add    %esi,%eax
+     414:	11 fa                	adc    %edi,%edx
+static inline uint
+divl(uint64 n, uint d, uint *r)
+{
+  uint q;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (*r) :
+     416:	bb 00 ca 9a 3b       	mov    $0x3b9aca00,%ebx
+     41b:	f7 f3                	div    %ebx
+  ts->tv_sec = divl(ns, 1000000000, &rem);
+     41d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     420:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = rem;
+     422:	89 57 04             	mov    %edx,0x4(%edi)
+  if(clk == CLOCK_REALTIME)
+     425:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     429:	75 1a                	jne    445 <vclock_gettime+0xbd>
+    ts->tv_sec += cp->boottime;
+     42b:	03 05 0c f0 ff 7f    	add    0x7ffff00c,%eax
+     431:	89 07                	mov    %eax,(%edi)
+  return 0;
+     433:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     436:	83 c4 14             	add    $0x14,%esp
+     439:	5b                   	pop    %ebx
+     43a:	5e                   	pop    %esi
+     43b:	5f                   	pop    %edi
+     43c:	5d                   	pop    %ebp
+     43d:	c3                   	ret
+    return -1;
+     43e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     443:	eb f1                	jmp    436 <vclock_gettime+0xae>
+  return 0;
+     445:	b8 00 00 00 00       	mov    $0x0,%eax
+     44a:	eb ea                	jmp    436 <vclock_gettime+0xae>
+
+0000044c <flush>:
+
+// Write out fd's buffer, or with fd < 0 every buffer.
+// Returns -1 if a write fails.
+int
+flush(int fd)
+{
+     44c:	55                   	push   %ebp
+     44d:	89 e5                	mov    %esp,%ebp
+     44f:	56                   	push   %esi
+     450:	53                   	push   %ebx
+     451:	8b 45 08             	mov    0x8(%ebp),%eax
+  int r, n;
+
+  if(fd < 0){
+     454:	85 c0                	test   %eax,%eax
+     456:	78 5d                	js     4b5 <flush+0x69>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+      if(flush(fd) < 0)
+        r = -1;
+    return r;
+  }
+  if(fd >= NOBUF || (n = obuf[fd].n) == 0)
+     458:	83 f8 0f             	cmp    $0xf,%eax
+     45b:	7f 64                	jg     4c1 <flush+0x75>
+     45d:	69 d0 08 02 00 00    	imul   $0x208,%eax,%edx
+     463:	8b b2 64 19 00 00    	mov    0x1964(%edx),%esi
+     469:	85 f6                	test   %esi,%esi
+     46b:	74 59                	je     4c6 <flush+0x7a>
+    return 0;
+  obuf[fd].n = 0;
+     46d:	c7 82 64 19 00 00 00 	movl   $0x0,0x1964(%edx)
+     474:	00 00 00 
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     477:	81 c2 68 19 00 00    	add    $0x1968,%edx
+     47d:	83 ec 04             	sub    $0x4,%esp
+     480:	56                   	push   %esi
+     481:	52                   	push   %edx
+     482:	50                   	push   %eax
+     483:	e8 5a 03 00 00       	call   7e2 <write>
+     488:	83 c4 10             	add    $0x10,%esp
+     48b:	39 f0                	cmp    %esi,%eax
+     48d:	75 40                	jne    4cf <flush+0x83>
+     48f:	be 00 00 00 00       	mov    $0x0,%esi
+     494:	eb 30                	jmp    4c6 <flush+0x7a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     496:	83 c3 01             	add    $0x1,%ebx
+     499:	83 fb 0f             	cmp    $0xf,%ebx
+     49c:	7f 28                	jg     4c6 <flush+0x7a>
+      if(flush(fd) < 0)
+     49e:	83 ec 0c             	sub    $0xc,%esp
+     4a1:	53                   	push   %ebx
+     4a2:	e8 a5 ff ff ff       	call   44c <flush>
+     4a7:	83 c4 10             	add    $0x10,%esp
+     4aa:	85 c0                	test   %eax,%eax
+     4ac:	79 e8                	jns    496 <flush+0x4a>
+        r = -1;
+     4ae:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     4b3:	eb e1                	jmp    496 <flush+0x4a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     4b5:	be 00 00 00 00       	mov    $0x0,%esi
+     4ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+     4bf:	eb d8                	jmp    499 <flush+0x4d>
+    return 0;
+     4c1:	be 00 00 00 00       	mov    $0x0,%esi
+}
+     4c6:	89 f0                	mov    %esi,%eax
+     4c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     4cb:	5b                   	pop    %ebx
+     4cc:	5e                   	pop    %esi
+     4cd:	5d                   	pop    %ebp
+     4ce:	c3                   	ret
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     4cf:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     4d4:	eb f0                	jmp    4c6 <flush+0x7a>
+
+000004d6 <bufreset>:
+
+static void
+bufreset(int fd)
+{
+  if(fd >= 0 && fd < NOBUF){
+     4d6:	83 f8 0f             	cmp    $0xf,%eax
+     4d9:	76 01                	jbe    4dc <bufreset+0x6>
+     4db:	c3                   	ret
+{
+     4dc:	55                   	push   %ebp
+     4dd:	89 e5                	mov    %esp,%ebp
+     4df:	53                   	push   %ebx
+     4e0:	83 ec 10             	sub    $0x10,%esp
+     4e3:	89 c3                	mov    %eax,%ebx
+    flush(fd);
+     4e5:	50                   	push   %eax
+     4e6:	e8 61 ff ff ff       	call   44c <flush>
+    obuf[fd].mode = BUNKNOWN;
+     4eb:	69 db 08 02 00 00    	imul   $0x208,%ebx,%ebx
+     4f1:	c7 83 60 19 00 00 00 	movl   $0x0,0x1960(%ebx)
+     4f8:	00 00 00 
+     4fb:	83 c4 10             	add    $0x10,%esp
+  }
+}
+     4fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     501:	c9                   	leave
+     502:	c3                   	ret
+
+00000503 <bufwrite>:
+
+// Write n bytes from p to fd, through its buffer.
+// Returns n, or -1 if a write fails.
+int
+bufwrite(int fd, const void *p, int n)
+{
+     503:	55                   	push   %ebp
+     504:	89 e5                	mov    %esp,%ebp
+     506:	57                   	push   %edi
+     507:	56                   	push   %esi
+     508:	53                   	push   %ebx
+     509:	83 ec 3c             	sub    $0x3c,%esp
+     50c:	8b 75 08             	mov    0x8(%ebp),%esi
+     50f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct stat st;
+  const char *s;
+  int i;
+
+  if(fd < 0 || fd >= NOBUF)
+     512:	83 fe 0f             	cmp    $0xf,%esi
+     515:	0f 87 a2 00 00 00    	ja     5bd <bufwrite+0xba>
+    return write(fd, p, n);
+  if(obuf[fd].mode == BUNKNOWN){
+     51b:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     521:	83 b8 60 19 00 00 00 	cmpl   $0x0,0x1960(%eax)
+     528:	75 19                	jne    543 <bufwrite+0x40>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     52a:	83 fe 02             	cmp    $0x2,%esi
+     52d:	0f 85 9c 00 00 00    	jne    5cf <bufwrite+0xcc>
+      obuf[fd].mode = BNONE;
+     533:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     539:	c7 80 60 19 00 00 01 	movl   $0x1,0x1960(%eax)
+     540:	00 00 00 
+    else
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+  }
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     543:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     549:	89 da                	mov    %ebx,%edx
+     54b:	03 90 64 19 00 00    	add    0x1964(%eax),%edx
+     551:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+     557:	0f 8f ae 00 00 00    	jg     60b <bufwrite+0x108>
+    return -1;
+  if(n >= OBUFSZ)
+     55d:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+     563:	0f 8f bd 00 00 00    	jg     626 <bufwrite+0x123>
+    return write(fd, p, n);
+  memmove(obuf[fd].buf + obuf[fd].n, p, n);
+     569:	69 d6 08 02 00 00    	imul   $0x208,%esi,%edx
+     56f:	8d ba 60 19 00 00    	lea    0x1960(%edx),%edi
+     575:	8b 82 64 19 00 00    	mov    0x1964(%edx),%eax
+     57b:	83 ec 04             	sub    $0x4,%esp
+     57e:	53                   	push   %ebx
+     57f:	ff 75 0c             	push   0xc(%ebp)
+     582:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     585:	8d 84 10 68 19 00 00 	lea    0x1968(%eax,%edx,1),%eax
+     58c:	50                   	push   %eax
+     58d:	e8 4c fd ff ff       	call   2de <memmove>
+  obuf[fd].n += n;
+     592:	01 5f 04             	add    %ebx,0x4(%edi)
+  if(obuf[fd].mode == BNONE)
+     595:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     598:	8b 82 60 19 00 00    	mov    0x1960(%edx),%eax
+     59e:	83 c4 10             	add    $0x10,%esp
+     5a1:	83 f8 01             	cmp    $0x1,%eax
+     5a4:	0f 84 91 00 00 00    	je     63b <bufwrite+0x138>
+    return flush(fd) < 0 ? -1 : n;
+  if(obuf[fd].mode == BLINE)
+     5aa:	83 f8 02             	cmp    $0x2,%eax
+     5ad:	0f 84 ca 00 00 00    	je     67d <bufwrite+0x17a>
+    for(s = p, i = 0; i < n; i++)
+      if(s[i] == '\n')
+        return flush(fd) < 0 ? -1 : n;
+  return n;
+     5b3:	89 d8                	mov    %ebx,%eax
+}
+     5b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     5b8:	5b                   	pop    %ebx
+     5b9:	5e                   	pop    %esi
+     5ba:	5f                   	pop    %edi
+     5bb:	5d                   	pop    %ebp
+     5bc:	c3                   	ret
+    return write(fd, p, n);
+     5bd:	83 ec 04             	sub    $0x4,%esp
+     5c0:	53                   	push   %ebx
+     5c1:	ff 75 0c             	push   0xc(%ebp)
+     5c4:	56                   	push   %esi
+     5c5:	e8 18 02 00 00       	call   7e2 <write>
+     5ca:	83 c4 10             	add    $0x10,%esp
+     5cd:	eb e6                	jmp    5b5 <bufwrite+0xb2>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     5cf:	83 ec 08             	sub    $0x8,%esp
+     5d2:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     5d5:	50                   	push   %eax
+     5d6:	56                   	push   %esi
+     5d7:	e8 51 02 00 00       	call   82d <fstat>
+     5dc:	83 c4 10             	add    $0x10,%esp
+     5df:	85 c0                	test   %eax,%eax
+     5e1:	0f 88 4c ff ff ff    	js     533 <bufwrite+0x30>
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+     5e7:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     5ec:	74 16                	je     604 <bufwrite+0x101>
+     5ee:	ba 03 00 00 00       	mov    $0x3,%edx
+     5f3:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     5f9:	89 90 60 19 00 00    	mov    %edx,0x1960(%eax)
+     5ff:	e9 3f ff ff ff       	jmp    543 <bufwrite+0x40>
+     604:	ba 02 00 00 00       	mov    $0x2,%edx
+     609:	eb e8                	jmp    5f3 <bufwrite+0xf0>
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     60b:	83 ec 0c             	sub    $0xc,%esp
+     60e:	56                   	push   %esi
+     60f:	e8 38 fe ff ff       	call   44c <flush>
+     614:	83 c4 10             	add    $0x10,%esp
+     617:	85 c0                	test   %eax,%eax
+     619:	0f 89 3e ff ff ff    	jns    55d <bufwrite+0x5a>
+    return -1;
+     61f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     624:	eb 8f                	jmp    5b5 <bufwrite+0xb2>
+    return write(fd, p, n);
+     626:	83 ec 04             	sub    $0x4,%esp
+     629:	53                   	push   %ebx
+     62a:	ff 75 0c             	push   0xc(%ebp)
+     62d:	56                   	push   %esi
+     62e:	e8 af 01 00 00       	call   7e2 <write>
+     633:	83 c4 10             	add    $0x10,%esp
+     636:	e9 7a ff ff ff       	jmp    5b5 <bufwrite+0xb2>
+    return flush(fd) < 0 ? -1 : n;
+     63b:	83 ec 0c             	sub    $0xc,%esp
+     63e:	56                   	push   %esi
+     63f:	e8 08 fe ff ff       	call   44c <flush>
+     644:	83 c4 10             	add    $0x10,%esp
+     647:	85 c0                	test   %eax,%eax
+     649:	78 07                	js     652 <bufwrite+0x14f>
+     64b:	89 d8                	mov    %ebx,%eax
+     64d:	e9 63 ff ff ff       	jmp    5b5 <bufwrite+0xb2>
+     652:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     657:	e9 59 ff ff ff       	jmp    5b5 <bufwrite+0xb2>
+        return flush(fd) < 0 ? -1 : n;
+     65c:	83 ec 0c             	sub    $0xc,%esp
+     65f:	56                   	push   %esi
+     660:	e8 e7 fd ff ff       	call   44c <flush>
+     665:	83 c4 10             	add    $0x10,%esp
+     668:	85 c0                	test   %eax,%eax
+     66a:	78 07                	js     673 <bufwrite+0x170>
+     66c:	89 d8                	mov    %ebx,%eax
+     66e:	e9 42 ff ff ff       	jmp    5b5 <bufwrite+0xb2>
+     673:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     678:	e9 38 ff ff ff       	jmp    5b5 <bufwrite+0xb2>
+    for(s = p, i = 0; i < n; i++)
+     67d:	b8 00 00 00 00       	mov    $0x0,%eax
+     682:	39 d8                	cmp    %ebx,%eax
+     684:	7d 0e                	jge    694 <bufwrite+0x191>
+      if(s[i] == '\n')
+     686:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     689:	80 3c 01 0a          	cmpb   $0xa,(%ecx,%eax,1)
+     68d:	74 cd                	je     65c <bufwrite+0x159>
+    for(s = p, i = 0; i < n; i++)
+     68f:	83 c0 01             	add    $0x1,%eax
+     692:	eb ee                	jmp    682 <bufwrite+0x17f>
+  return n;
+     694:	89 d8                	mov    %ebx,%eax
+     696:	e9 1a ff ff ff       	jmp    5b5 <bufwrite+0xb2>
+
+0000069b <fork>:
+
+int
+fork(void)
+{
+     69b:	55                   	push   %ebp
+     69c:	89 e5                	mov    %esp,%ebp
+     69e:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     6a1:	6a ff                	push   $0xffffffff
+     6a3:	e8 a4 fd ff ff       	call   44c <flush>
+  return _fork();
+     6a8:	e8 bd 00 00 00       	call   76a <_fork>
+}
+     6ad:	c9                   	leave
+     6ae:	c3                   	ret
+
+000006af <exit>:
+
+int
+exit(void)
+{
+     6af:	55                   	push   %ebp
+     6b0:	89 e5                	mov    %esp,%ebp
+     6b2:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     6b5:	6a ff                	push   $0xffffffff
+     6b7:	e8 90 fd ff ff       	call   44c <flush>
+  _exit();
+     6bc:	e8 b8 00 00 00       	call   779 <_exit>
+
+000006c1 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     6c1:	55                   	push   %ebp
+     6c2:	89 e5                	mov    %esp,%ebp
+     6c4:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     6c7:	6a ff                	push   $0xffffffff
+     6c9:	e8 7e fd ff ff       	call   44c <flush>
+  return _exec(path, argv);
+     6ce:	83 c4 08             	add    $0x8,%esp
+     6d1:	ff 75 0c             	push   0xc(%ebp)
+     6d4:	ff 75 08             	push   0x8(%ebp)
+     6d7:	e8 bb 00 00 00       	call   797 <_exec>
+}
+     6dc:	c9                   	leave
+     6dd:	c3                   	ret
+
+000006de <close>:
+
+int
+close(int fd)
+{
+     6de:	55                   	push   %ebp
+     6df:	89 e5                	mov    %esp,%ebp
+     6e1:	53                   	push   %ebx
+     6e2:	83 ec 04             	sub    $0x4,%esp
+     6e5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bufreset(fd);
+     6e8:	89 d8                	mov    %ebx,%eax
+     6ea:	e8 e7 fd ff ff       	call   4d6 <bufreset>
+  return _close(fd);
+     6ef:	83 ec 0c             	sub    $0xc,%esp
+     6f2:	53                   	push   %ebx
+     6f3:	e8 90 00 00 00       	call   788 <_close>
+}
+     6f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6fb:	c9                   	leave
+     6fc:	c3                   	ret
+
+000006fd <stat>:
+{
+     6fd:	55                   	push   %ebp
+     6fe:	89 e5                	mov    %esp,%ebp
+     700:	56                   	push   %esi
+     701:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     702:	83 ec 08             	sub    $0x8,%esp
+     705:	6a 00                	push   $0x0
+     707:	ff 75 08             	push   0x8(%ebp)
+     70a:	e8 f1 00 00 00       	call   800 <open>
+  if(fd < 0)
+     70f:	83 c4 10             	add    $0x10,%esp
+     712:	85 c0                	test   %eax,%eax
+     714:	78 24                	js     73a <stat+0x3d>
+     716:	89 c3                	mov    %eax,%ebx
+  r = fstat(fd, st);
+     718:	83 ec 08             	sub    $0x8,%esp
+     71b:	ff 75 0c             	push   0xc(%ebp)
+     71e:	50                   	push   %eax
+     71f:	e8 09 01 00 00       	call   82d <fstat>
+     724:	89 c6                	mov    %eax,%esi
+  close(fd);
+     726:	89 1c 24             	mov    %ebx,(%esp)
+     729:	e8 b0 ff ff ff       	call   6de <close>
+  return r;
+     72e:	83 c4 10             	add    $0x10,%esp
+}
+     731:	89 f0                	mov    %esi,%eax
+     733:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     736:	5b                   	pop    %ebx
+     737:	5e                   	pop    %esi
+     738:	5d                   	pop    %ebp
+     739:	c3                   	ret
+    return -1;
+     73a:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     73f:	eb f0                	jmp    731 <stat+0x34>
+
+00000741 <dup2>:
+
+int
+dup2(int oldfd, int newfd)
+{
+     741:	55                   	push   %ebp
+     742:	89 e5                	mov    %esp,%ebp
+     744:	56                   	push   %esi
+     745:	53                   	push   %ebx
+     746:	8b 75 08             	mov    0x8(%ebp),%esi
+     749:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(oldfd != newfd)
+     74c:	39 de                	cmp    %ebx,%esi
+     74e:	75 11                	jne    761 <dup2+0x20>
+    bufreset(newfd);
+  return _dup2(oldfd, newfd);
+     750:	83 ec 08             	sub    $0x8,%esp
+     753:	53                   	push   %ebx
+     754:	56                   	push   %esi
+     755:	e8 4c 00 00 00       	call   7a6 <_dup2>
+}
+     75a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     75d:	5b                   	pop    %ebx
+     75e:	5e                   	pop    %esi
+     75f:	5d                   	pop    %ebp
+     760:	c3                   	ret
+    bufreset(newfd);
+     761:	89 d8                	mov    %ebx,%eax
+     763:	e8 6e fd ff ff       	call   4d6 <bufreset>
+     768:	eb e6                	jmp    750 <dup2+0xf>
+
+0000076a <_fork>:
+  1: ret
+
+#define SYSCALL(name) STUB(name, SYS_ ## name)
+
+# ulib.c wraps these, to flush printf()'s buffers first.
+STUB(_fork, SYS_fork)
+     76a:	b8 01 00 00 00       	mov    $0x1,%eax
+     76f:	89 e1                	mov    %esp,%ecx
+     771:	ba 78 07 00 00       	mov    $0x778,%edx
+     776:	0f 34                	sysenter
+     778:	c3                   	ret
+
+00000779 <_exit>:
+STUB(_exit, SYS_exit)
+     779:	b8 02 00 00 00       	mov    $0x2,%eax
+     77e:	89 e1                	mov    %esp,%ecx
+     780:	ba 87 07 00 00       	mov    $0x787,%edx
+     785:	0f 34                	sysenter
+     787:	c3                   	ret
+
+00000788 <_close>:
+STUB(_close, SYS_close)
+     788:	b8 15 00 00 00       	mov    $0x15,%eax
+     78d:	89 e1                	mov    %esp,%ecx
+     78f:	ba 96 07 00 00       	mov    $0x796,%edx
+     794:	0f 34                	sysenter
+     796:	c3                   	ret
+
+00000797 <_exec>:
+STUB(_exec, SYS_exec)
+     797:	b8 07 00 00 00       	mov    $0x7,%eax
+     79c:	89 e1                	mov    %esp,%ecx
+     79e:	ba a5 07 00 00       	mov    $0x7a5,%edx
+     7a3:	0f 34                	sysenter
+     7a5:	c3                   	ret
+
+000007a6 <_dup2>:
+STUB(_dup2, SYS_dup2)
+     7a6:	b8 17 00 00 00       	mov    $0x17,%eax
+     7ab:	89 e1                	mov    %esp,%ecx
+     7ad:	ba b4 07 00 00       	mov    $0x7b4,%edx
+     7b2:	0f 34                	sysenter
+     7b4:	c3                   	ret
+
+000007b5 <wait>:
+
+SYSCALL(wait)
+     7b5:	b8 03 00 00 00       	mov    $0x3,%eax
+     7ba:	89 e1                	mov    %esp,%ecx
+     7bc:	ba c3 07 00 00       	mov    $0x7c3,%edx
+     7c1:	0f 34                	sysenter
+     7c3:	c3                   	ret
+
+000007c4 <pipe>:
+SYSCALL(pipe)
+     7c4:	b8 04 00 00 00       	mov    $0x4,%eax
+     7c9:	89 e1                	mov    %esp,%ecx
+     7cb:	ba d2 07 00 00       	mov    $0x7d2,%edx
+     7d0:	0f 34                	sysenter
+     7d2:	c3                   	ret
+
+000007d3 <read>:
+SYSCALL(read)
+     7d3:	b8 05 00 00 00       	mov    $0x5,%eax
+     7d8:	89 e1                	mov    %esp,%ecx
+     7da:	ba e1 07 00 00       	mov    $0x7e1,%edx
+     7df:	0f 34                	sysenter
+     7e1:	c3                   	ret
+
+000007e2 <write>:
+SYSCALL(write)
+     7e2:	b8 10 00 00 00       	mov    $0x10,%eax
+     7e7:	89 e1                	mov    %esp,%ecx
+     7e9:	ba f0 07 00 00       	mov    $0x7f0,%edx
+     7ee:	0f 34                	sysenter
+     7f0:	c3                   	ret
+
+000007f1 <kill>:
+SYSCALL(kill)
+     7f1:	b8 06 00 00 00       	mov    $0x6,%eax
+     7f6:	89 e1                	mov    %esp,%ecx
+     7f8:	ba ff 07 00 00       	mov    $0x7ff,%edx
+     7fd:	0f 34                	sysenter
+     7ff:	c3                   	ret
+
+00000800 <open>:
+SYSCALL(open)
+     800:	b8 0f 00 00 00       	mov    $0xf,%eax
+     805:	89 e1                	mov    %esp,%ecx
+     807:	ba 0e 08 00 00       	mov    $0x80e,%edx
+     80c:	0f 34                	sysenter
+     80e:	c3                   	ret
+
+0000080f <mknod>:
+SYSCALL(mknod)
+     80f:	b8 11 00 00 00       	mov    $0x11,%eax
+     814:	89 e1                	mov    %esp,%ecx
+     816:	ba 1d 08 00 00       	mov    $0x81d,%edx
+     81b:	0f 34                	sysenter
+     81d:	c3                   	ret
+
+0000081e <unlink>:
+SYSCALL(unlink)
+     81e:	b8 12 00 00 00       	mov    $0x12,%eax
+     823:	89 e1                	mov    %esp,%ecx
+     825:	ba 2c 08 00 00       	mov    $0x82c,%edx
+     82a:	0f 34                	sysenter
+     82c:	c3                   	ret
+
+0000082d <fstat>:
+SYSCALL(fstat)
+     82d:	b8 08 00 00 00       	mov    $0x8,%eax
+     832:	89 e1                	mov    %esp,%ecx
+     834:	ba 3b 08 00 00       	mov    $0x83b,%edx
+     839:	0f 34                	sysenter
+     83b:	c3                   	ret
+
+0000083c <link>:
+SYSCALL(link)
+     83c:	b8 13 00 00 00       	mov    $0x13,%eax
+     841:	89 e1                	mov    %esp,%ecx
+     843:	ba 4a 08 00 00       	mov    $0x84a,%edx
+     848:	0f 34                	sysenter
+     84a:	c3                   	ret
+
+0000084b <mkdir>:
+SYSCALL(mkdir)
+     84b:	b8 14 00 00 00       	mov    $0x14,%eax
+     850:	89 e1                	mov    %esp,%ecx
+     852:	ba 59 08 00 00       	mov    $0x859,%edx
+     857:	0f 34                	sysenter
+     859:	c3                   	ret
+
+0000085a <chdir>:
+SYSCALL(chdir)
+     85a:	b8 09 00 00 00       	mov    $0x9,%eax
+     85f:	89 e1                	mov    %esp,%ecx
+     861:	ba 68 08 00 00       	mov    $0x868,%edx
+     866:	0f 34                	sysenter
+     868:	c3                   	ret
+
+00000869 <dup>:
+SYSCALL(dup)
+     869:	b8 0a 00 00 00       	mov    $0xa,%eax
+     86e:	89 e1                	mov    %esp,%ecx
+     870:	ba 77 08 00 00       	mov    $0x877,%edx
+     875:	0f 34                	sysenter
+     877:	c3                   	ret
+
+00000878 <getpid>:
+SYSCALL(getpid)
+     878:	b8 0b 00 00 00       	mov    $0xb,%eax
+     87d:	89 e1                	mov    %esp,%ecx
+     87f:	ba 86 08 00 00       	mov    $0x886,%edx
+     884:	0f 34                	sysenter
+     886:	c3                   	ret
+
+00000887 <sbrk>:
+SYSCALL(sbrk)
+     887:	b8 0c 00 00 00       	mov    $0xc,%eax
+     88c:	89 e1                	mov    %esp,%ecx
+     88e:	ba 95 08 00 00       	mov    $0x895,%edx
+     893:	0f 34                	sysenter
+     895:	c3                   	ret
+
+00000896 <sleep>:
+SYSCALL(sleep)
+     896:	b8 0d 00 00 00       	mov    $0xd,%eax
+     89b:	89 e1                	mov    %esp,%ecx
+     89d:	ba a4 08 00 00       	mov    $0x8a4,%edx
+     8a2:	0f 34                	sysenter
+     8a4:	c3                   	ret
+
+000008a5 <uptime>:
+SYSCALL(uptime)
+     8a5:	b8 0e 00 00 00       	mov    $0xe,%eax
+     8aa:	89 e1                	mov    %esp,%ecx
+     8ac:	ba b3 08 00 00       	mov    $0x8b3,%edx
+     8b1:	0f 34                	sysenter
+     8b3:	c3                   	ret
+
+000008b4 <date>:
+SYSCALL(date)
+     8b4:	b8 16 00 00 00       	mov    $0x16,%eax
+     8b9:	89 e1                	mov    %esp,%ecx
+     8bb:	ba c2 08 00 00       	mov    $0x8c2,%edx
+     8c0:	0f 34                	sysenter
+     8c2:	c3                   	ret
+
+000008c3 <faultaround>:
+SYSCALL(faultaround)
+     8c3:	b8 18 00 00 00       	mov    $0x18,%eax
+     8c8:	89 e1                	mov    %esp,%ecx
+     8ca:	ba d1 08 00 00       	mov    $0x8d1,%edx
+     8cf:	0f 34                	sysenter
+     8d1:	c3                   	ret
+
+000008d2 <faultstat>:
+SYSCALL(faultstat)
+     8d2:	b8 19 00 00 00       	mov    $0x19,%eax
+     8d7:	89 e1                	mov    %esp,%ecx
+     8d9:	ba e0 08 00 00       	mov    $0x8e0,%edx
+     8de:	0f 34                	sysenter
+     8e0:	c3                   	ret
+
+000008e1 <mmap>:
+SYSCALL(mmap)
+     8e1:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     8e6:	89 e1                	mov    %esp,%ecx
+     8e8:	ba ef 08 00 00       	mov    $0x8ef,%edx
+     8ed:	0f 34                	sysenter
+     8ef:	c3                   	ret
+
+000008f0 <munmap>:
+SYSCALL(munmap)
+     8f0:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     8f5:	89 e1                	mov    %esp,%ecx
+     8f7:	ba fe 08 00 00       	mov    $0x8fe,%edx
+     8fc:	0f 34                	sysenter
+     8fe:	c3                   	ret
+
+000008ff <largepages>:
+SYSCALL(largepages)
+     8ff:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     904:	89 e1                	mov    %esp,%ecx
+     906:	ba 0d 09 00 00       	mov    $0x90d,%edx
+     90b:	0f 34                	sysenter
+     90d:	c3                   	ret
+
+0000090e <spawn>:
+SYSCALL(spawn)
+     90e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     913:	89 e1                	mov    %esp,%ecx
+     915:	ba 1c 09 00 00       	mov    $0x91c,%edx
+     91a:	0f 34                	sysenter
+     91c:	c3                   	ret
+
+0000091d <setpriority>:
+SYSCALL(setpriority)
+     91d:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     922:	89 e1                	mov    %esp,%ecx
+     924:	ba 2b 09 00 00       	mov    $0x92b,%edx
+     929:	0f 34                	sysenter
+     92b:	c3                   	ret
+
+0000092c <getpriority>:
+SYSCALL(getpriority)
+     92c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     931:	89 e1                	mov    %esp,%ecx
+     933:	ba 3a 09 00 00       	mov    $0x93a,%edx
+     938:	0f 34                	sysenter
+     93a:	c3                   	ret
+
+0000093b <getprocinfo>:
+SYSCALL(getprocinfo)
+     93b:	b8 20 00 00 00       	mov    $0x20,%eax
+     940:	89 e1                	mov    %esp,%ecx
+     942:	ba 49 09 00 00       	mov    $0x949,%edx
+     947:	0f 34                	sysenter
+     949:	c3                   	ret
+
+0000094a <getcpuinfo>:
+SYSCALL(getcpuinfo)
+     94a:	b8 21 00 00 00       	mov    $0x21,%eax
+     94f:	89 e1                	mov    %esp,%ecx
+     951:	ba 58 09 00 00       	mov    $0x958,%edx
+     956:	0f 34                	sysenter
+     958:	c3                   	ret
+
+00000959 <clone>:
+SYSCALL(clone)
+     959:	b8 22 00 00 00       	mov    $0x22,%eax
+     95e:	89 e1                	mov    %esp,%ecx
+     960:	ba 67 09 00 00       	mov    $0x967,%edx
+     965:	0f 34                	sysenter
+     967:	c3                   	ret
+
+00000968 <join>:
+SYSCALL(join)
+     968:	b8 23 00 00 00       	mov    $0x23,%eax
+     96d:	89 e1                	mov    %esp,%ecx
+     96f:	ba 76 09 00 00       	mov    $0x976,%edx
+     974:	0f 34                	sysenter
+     976:	c3                   	ret
+
+00000977 <futex_wait>:
+SYSCALL(futex_wait)
+     977:	b8 24 00 00 00       	mov    $0x24,%eax
+     97c:	89 e1                	mov    %esp,%ecx
+     97e:	ba 85 09 00 00       	mov    $0x985,%edx
+     983:	0f 34                	sysenter
+     985:	c3                   	ret
+
+00000986 <futex_wake>:
+SYSCALL(futex_wake)
+     986:	b8 25 00 00 00       	mov    $0x25,%eax
+     98b:	89 e1                	mov    %esp,%ecx
+     98d:	ba 94 09 00 00       	mov    $0x994,%edx
+     992:	0f 34                	sysenter
+     994:	c3                   	ret
+
+00000995 <setaffinity>:
+SYSCALL(setaffinity)
+     995:	b8 26 00 00 00       	mov    $0x26,%eax
+     99a:	89 e1                	mov    %esp,%ecx
+     99c:	ba a3 09 00 00       	mov    $0x9a3,%edx
+     9a1:	0f 34                	sysenter
+     9a3:	c3                   	ret
+
+000009a4 <getaffinity>:
+SYSCALL(getaffinity)
+     9a4:	b8 27 00 00 00       	mov    $0x27,%eax
+     9a9:	89 e1                	mov    %esp,%ecx
+     9ab:	ba b2 09 00 00       	mov    $0x9b2,%edx
+     9b0:	0f 34                	sysenter
+     9b2:	c3                   	ret
+
+000009b3 <clock_gettime>:
+SYSCALL(clock_gettime)
+     9b3:	b8 28 00 00 00       	mov    $0x28,%eax
+     9b8:	89 e1                	mov    %esp,%ecx
+     9ba:	ba c1 09 00 00       	mov    $0x9c1,%edx
+     9bf:	0f 34                	sysenter
+     9c1:	c3                   	ret
+
+000009c2 <msleep>:
+SYSCALL(msleep)
+     9c2:	b8 29 00 00 00       	mov    $0x29,%eax
+     9c7:	89 e1                	mov    %esp,%ecx
+     9c9:	ba d0 09 00 00       	mov    $0x9d0,%edx
+     9ce:	0f 34                	sysenter
+     9d0:	c3                   	ret
+
+000009d1 <lockstat>:
+SYSCALL(lockstat)
+     9d1:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     9d6:	89 e1                	mov    %esp,%ecx
+     9d8:	ba df 09 00 00       	mov    $0x9df,%edx
+     9dd:	0f 34                	sysenter
+     9df:	c3                   	ret
+
+000009e0 <bstat>:
+SYSCALL(bstat)
+     9e0:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     9e5:	89 e1                	mov    %esp,%ecx
+     9e7:	ba ee 09 00 00       	mov    $0x9ee,%edx
+     9ec:	0f 34                	sysenter
+     9ee:	c3                   	ret
+
+000009ef <iostat>:
+SYSCALL(iostat)
+     9ef:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     9f4:	89 e1                	mov    %esp,%ecx
+     9f6:	ba fd 09 00 00       	mov    $0x9fd,%edx
+     9fb:	0f 34                	sysenter
+     9fd:	c3                   	ret
+
+000009fe <fsync>:
+SYSCALL(fsync)
+     9fe:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     a03:	89 e1                	mov    %esp,%ecx
+     a05:	ba 0c 0a 00 00       	mov    $0xa0c,%edx
+     a0a:	0f 34                	sysenter
+     a0c:	c3                   	ret
+
+00000a0d <pread>:
+SYSCALL(pread)
+     a0d:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     a12:	89 e1                	mov    %esp,%ecx
+     a14:	ba 1b 0a 00 00       	mov    $0xa1b,%edx
+     a19:	0f 34                	sysenter
+     a1b:	c3                   	ret
+
+00000a1c <pwrite>:
+SYSCALL(pwrite)
+     a1c:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     a21:	89 e1                	mov    %esp,%ecx
+     a23:	ba 2a 0a 00 00       	mov    $0xa2a,%edx
+     a28:	0f 34                	sysenter
+     a2a:	c3                   	ret
+
+00000a2b <readv>:
+SYSCALL(readv)
+     a2b:	b8 30 00 00 00       	mov    $0x30,%eax
+     a30:	89 e1                	mov    %esp,%ecx
+     a32:	ba 39 0a 00 00       	mov    $0xa39,%edx
+     a37:	0f 34                	sysenter
+     a39:	c3                   	ret
+
+00000a3a <writev>:
+SYSCALL(writev)
+     a3a:	b8 31 00 00 00       	mov    $0x31,%eax
+     a3f:	89 e1                	mov    %esp,%ecx
+     a41:	ba 48 0a 00 00       	mov    $0xa48,%edx
+     a46:	0f 34                	sysenter
+     a48:	c3                   	ret
+
+00000a49 <sendfile>:
+SYSCALL(sendfile)
+     a49:	b8 32 00 00 00       	mov    $0x32,%eax
+     a4e:	89 e1                	mov    %esp,%ecx
+     a50:	ba 57 0a 00 00       	mov    $0xa57,%edx
+     a55:	0f 34                	sysenter
+     a57:	c3                   	ret
+
+00000a58 <fcntl>:
+SYSCALL(fcntl)
+     a58:	b8 33 00 00 00       	mov    $0x33,%eax
+     a5d:	89 e1                	mov    %esp,%ecx
+     a5f:	ba 66 0a 00 00       	mov    $0xa66,%edx
+     a64:	0f 34                	sysenter
+     a66:	c3                   	ret
+
+00000a67 <mount>:
+SYSCALL(mount)
+     a67:	b8 34 00 00 00       	mov    $0x34,%eax
+     a6c:	89 e1                	mov    %esp,%ecx
+     a6e:	ba 75 0a 00 00       	mov    $0xa75,%edx
+     a73:	0f 34                	sysenter
+     a75:	c3                   	ret
+
+00000a76 <getdents>:
+SYSCALL(getdents)
+     a76:	b8 35 00 00 00       	mov    $0x35,%eax
+     a7b:	89 e1                	mov    %esp,%ecx
+     a7d:	ba 84 0a 00 00       	mov    $0xa84,%edx
+     a82:	0f 34                	sysenter
+     a84:	c3                   	ret
+
+00000a85 <fstatat>:
+SYSCALL(fstatat)
+     a85:	b8 36 00 00 00       	mov    $0x36,%eax
+     a8a:	89 e1                	mov    %esp,%ecx
+     a8c:	ba 93 0a 00 00       	mov    $0xa93,%edx
+     a91:	0f 34                	sysenter
+     a93:	c3                   	ret
+
+00000a94 <sysstat>:
+SYSCALL(sysstat)
+     a94:	b8 37 00 00 00       	mov    $0x37,%eax
+     a99:	89 e1                	mov    %esp,%ecx
+     a9b:	ba a2 0a 00 00       	mov    $0xaa2,%edx
+     aa0:	0f 34                	sysenter
+     aa2:	c3                   	ret
+
+00000aa3 <ringenter>:
+SYSCALL(ringenter)
+     aa3:	b8 38 00 00 00       	mov    $0x38,%eax
+     aa8:	89 e1                	mov    %esp,%ecx
+     aaa:	ba b1 0a 00 00       	mov    $0xab1,%edx
+     aaf:	0f 34                	sysenter
+     ab1:	c3                   	ret
+
+00000ab2 <trace>:
+SYSCALL(trace)
+     ab2:	b8 39 00 00 00       	mov    $0x39,%eax
+     ab7:	89 e1                	mov    %esp,%ecx
+     ab9:	ba c0 0a 00 00       	mov    $0xac0,%edx
+     abe:	0f 34                	sysenter
+     ac0:	c3                   	ret
+
+00000ac1 <memstat>:
+SYSCALL(memstat)
+     ac1:	b8 3a 00 00 00       	mov    $0x3a,%eax
+     ac6:	89 e1                	mov    %esp,%ecx
+     ac8:	ba cf 0a 00 00       	mov    $0xacf,%edx
+     acd:	0f 34                	sysenter
+     acf:	c3                   	ret
+
+00000ad0 <shmget>:
+SYSCALL(shmget)
+     ad0:	b8 3b 00 00 00       	mov    $0x3b,%eax
+     ad5:	89 e1                	mov    %esp,%ecx
+     ad7:	ba de 0a 00 00       	mov    $0xade,%edx
+     adc:	0f 34                	sysenter
+     ade:	c3                   	ret
+
+00000adf <shmat>:
+SYSCALL(shmat)
+     adf:	b8 3c 00 00 00       	mov    $0x3c,%eax
+     ae4:	89 e1                	mov    %esp,%ecx
+     ae6:	ba ed 0a 00 00       	mov    $0xaed,%edx
+     aeb:	0f 34                	sysenter
+     aed:	c3                   	ret
+
+00000aee <shmdt>:
+SYSCALL(shmdt)
+     aee:	b8 3d 00 00 00       	mov    $0x3d,%eax
+     af3:	89 e1                	mov    %esp,%ecx
+     af5:	ba fc 0a 00 00       	mov    $0xafc,%edx
+     afa:	0f 34                	sysenter
+     afc:	c3                   	ret
+
+00000afd <irqstat>:
+SYSCALL(irqstat)
+     afd:	b8 3e 00 00 00       	mov    $0x3e,%eax
+     b02:	89 e1                	mov    %esp,%ecx
+     b04:	ba 0b 0b 00 00       	mov    $0xb0b,%edx
+     b09:	0f 34                	sysenter
+     b0b:	c3                   	ret
+
+00000b0c <irqroute>:
+SYSCALL(irqroute)
+     b0c:	b8 3f 00 00 00       	mov    $0x3f,%eax
+     b11:	89 e1                	mov    %esp,%ecx
+     b13:	ba 1a 0b 00 00       	mov    $0xb1a,%edx
+     b18:	0f 34                	sysenter
+     b1a:	c3                   	ret
+
+00000b1b <putc>:
+  char buf[64];
+};
+
+static void
+putc(struct out *o, char c)
+{
+     b1b:	55                   	push   %ebp
+     b1c:	89 e5                	mov    %esp,%ebp
+     b1e:	56                   	push   %esi
+     b1f:	53                   	push   %ebx
+     b20:	89 c3                	mov    %eax,%ebx
+     b22:	89 d6                	mov    %edx,%esi
+  if(o->n == sizeof(o->buf)){
+     b24:	8b 40 04             	mov    0x4(%eax),%eax
+     b27:	83 f8 40             	cmp    $0x40,%eax
+     b2a:	74 16                	je     b42 <putc+0x27>
+    bufwrite(o->fd, o->buf, o->n);
+    o->n = 0;
+  }
+  o->buf[o->n++] = c;
+     b2c:	8b 43 04             	mov    0x4(%ebx),%eax
+     b2f:	8d 50 01             	lea    0x1(%eax),%edx
+     b32:	89 53 04             	mov    %edx,0x4(%ebx)
+     b35:	89 f1                	mov    %esi,%ecx
+     b37:	88 4c 03 08          	mov    %cl,0x8(%ebx,%eax,1)
+}
+     b3b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b3e:	5b                   	pop    %ebx
+     b3f:	5e                   	pop    %esi
+     b40:	5d                   	pop    %ebp
+     b41:	c3                   	ret
+    bufwrite(o->fd, o->buf, o->n);
+     b42:	8d 53 08             	lea    0x8(%ebx),%edx
+     b45:	83 ec 04             	sub    $0x4,%esp
+     b48:	50                   	push   %eax
+     b49:	52                   	push   %edx
+     b4a:	ff 33                	push   (%ebx)
+     b4c:	e8 b2 f9 ff ff       	call   503 <bufwrite>
+    o->n = 0;
+     b51:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     b58:	83 c4 10             	add    $0x10,%esp
+     b5b:	eb cf                	jmp    b2c <putc+0x11>
+
+00000b5d <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     b5d:	55                   	push   %ebp
+     b5e:	89 e5                	mov    %esp,%ebp
+     b60:	57                   	push   %edi
+     b61:	56                   	push   %esi
+     b62:	53                   	push   %ebx
+     b63:	83 ec 2c             	sub    $0x2c,%esp
+     b66:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     b69:	89 d0                	mov    %edx,%eax
+     b6b:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+     b6d:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     b71:	0f 95 c1             	setne  %cl
+     b74:	c1 ea 1f             	shr    $0x1f,%edx
+     b77:	84 d1                	test   %dl,%cl
+     b79:	74 44                	je     bbf <printint+0x62>
+    neg = 1;
+    x = -xx;
+     b7b:	f7 d8                	neg    %eax
+     b7d:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+     b7f:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     b86:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+     b8b:	89 c8                	mov    %ecx,%eax
+     b8d:	ba 00 00 00 00       	mov    $0x0,%edx
+     b92:	f7 f6                	div    %esi
+     b94:	89 df                	mov    %ebx,%edi
+     b96:	83 c3 01             	add    $0x1,%ebx
+     b99:	0f b6 92 6c 12 00 00 	movzbl 0x126c(%edx),%edx
+     ba0:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+     ba4:	89 ca                	mov    %ecx,%edx
+     ba6:	89 c1                	mov    %eax,%ecx
+     ba8:	39 f2                	cmp    %esi,%edx
+     baa:	73 df                	jae    b8b <printint+0x2e>
+  if(neg)
+     bac:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     bb0:	74 31                	je     be3 <printint+0x86>
+    buf[i++] = '-';
+     bb2:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+     bb7:	8d 5f 02             	lea    0x2(%edi),%ebx
+     bba:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     bbd:	eb 17                	jmp    bd6 <printint+0x79>
+    x = xx;
+     bbf:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+     bc1:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     bc8:	eb bc                	jmp    b86 <printint+0x29>
+
+  while(--i >= 0)
+    putc(o, buf[i]);
+     bca:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+     bcf:	89 f0                	mov    %esi,%eax
+     bd1:	e8 45 ff ff ff       	call   b1b <putc>
+  while(--i >= 0)
+     bd6:	83 eb 01             	sub    $0x1,%ebx
+     bd9:	79 ef                	jns    bca <printint+0x6d>
+}
+     bdb:	83 c4 2c             	add    $0x2c,%esp
+     bde:	5b                   	pop    %ebx
+     bdf:	5e                   	pop    %esi
+     be0:	5f                   	pop    %edi
+     be1:	5d                   	pop    %ebp
+     be2:	c3                   	ret
+     be3:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     be6:	eb ee                	jmp    bd6 <printint+0x79>
+
+00000be8 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     be8:	55                   	push   %ebp
+     be9:	89 e5                	mov    %esp,%ebp
+     beb:	57                   	push   %edi
+     bec:	56                   	push   %esi
+     bed:	53                   	push   %ebx
+     bee:	83 ec 6c             	sub    $0x6c,%esp
+  int c, i, state;
+  uint *ap;
+  struct out out, *o;
+
+  o = &out;
+  o->fd = fd;
+     bf1:	8b 45 08             	mov    0x8(%ebp),%eax
+     bf4:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  o->n = 0;
+     bf7:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+     bfe:	8d 45 10             	lea    0x10(%ebp),%eax
+     c01:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  state = 0;
+     c04:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+     c09:	bb 00 00 00 00       	mov    $0x0,%ebx
+     c0e:	eb 14                	jmp    c24 <printf+0x3c>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(o, c);
+     c10:	89 fa                	mov    %edi,%edx
+     c12:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     c15:	e8 01 ff ff ff       	call   b1b <putc>
+     c1a:	eb 05                	jmp    c21 <printf+0x39>
+      }
+    } else if(state == '%'){
+     c1c:	83 fe 25             	cmp    $0x25,%esi
+     c1f:	74 25                	je     c46 <printf+0x5e>
+  for(i = 0; fmt[i]; i++){
+     c21:	83 c3 01             	add    $0x1,%ebx
+     c24:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c27:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+     c2b:	84 c0                	test   %al,%al
+     c2d:	0f 84 20 01 00 00    	je     d53 <printf+0x16b>
+    c = fmt[i] & 0xff;
+     c33:	0f be f8             	movsbl %al,%edi
+     c36:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     c39:	85 f6                	test   %esi,%esi
+     c3b:	75 df                	jne    c1c <printf+0x34>
+      if(c == '%'){
+     c3d:	83 f8 25             	cmp    $0x25,%eax
+     c40:	75 ce                	jne    c10 <printf+0x28>
+        state = '%';
+     c42:	89 c6                	mov    %eax,%esi
+     c44:	eb db                	jmp    c21 <printf+0x39>
+      if(c == 'd'){
+     c46:	83 f8 25             	cmp    $0x25,%eax
+     c49:	0f 84 cf 00 00 00    	je     d1e <printf+0x136>
+     c4f:	0f 8c dd 00 00 00    	jl     d32 <printf+0x14a>
+     c55:	83 f8 78             	cmp    $0x78,%eax
+     c58:	0f 8f d4 00 00 00    	jg     d32 <printf+0x14a>
+     c5e:	83 f8 63             	cmp    $0x63,%eax
+     c61:	0f 8c cb 00 00 00    	jl     d32 <printf+0x14a>
+     c67:	83 e8 63             	sub    $0x63,%eax
+     c6a:	83 f8 15             	cmp    $0x15,%eax
+     c6d:	0f 87 bf 00 00 00    	ja     d32 <printf+0x14a>
+     c73:	ff 24 85 14 12 00 00 	jmp    *0x1214(,%eax,4)
+        printint(o, *ap, 10, 1);
+     c7a:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     c7d:	8b 17                	mov    (%edi),%edx
+     c7f:	83 ec 0c             	sub    $0xc,%esp
+     c82:	6a 01                	push   $0x1
+     c84:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     c89:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     c8c:	e8 cc fe ff ff       	call   b5d <printint>
+        ap++;
+     c91:	83 c7 04             	add    $0x4,%edi
+     c94:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     c97:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(o, '%');
+        putc(o, c);
+      }
+      state = 0;
+     c9a:	be 00 00 00 00       	mov    $0x0,%esi
+     c9f:	eb 80                	jmp    c21 <printf+0x39>
+        printint(o, *ap, 16, 0);
+     ca1:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     ca4:	8b 17                	mov    (%edi),%edx
+     ca6:	83 ec 0c             	sub    $0xc,%esp
+     ca9:	6a 00                	push   $0x0
+     cab:	b9 10 00 00 00       	mov    $0x10,%ecx
+     cb0:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     cb3:	e8 a5 fe ff ff       	call   b5d <printint>
+        ap++;
+     cb8:	83 c7 04             	add    $0x4,%edi
+     cbb:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     cbe:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     cc1:	be 00 00 00 00       	mov    $0x0,%esi
+     cc6:	e9 56 ff ff ff       	jmp    c21 <printf+0x39>
+        s = (char*)*ap;
+     ccb:	8b 45 94             	mov    -0x6c(%ebp),%eax
+     cce:	8b 30                	mov    (%eax),%esi
+        ap++;
+     cd0:	83 c0 04             	add    $0x4,%eax
+     cd3:	89 45 94             	mov    %eax,-0x6c(%ebp)
+        if(s == 0)
+     cd6:	85 f6                	test   %esi,%esi
+     cd8:	75 15                	jne    cef <printf+0x107>
+          s = "(null)";
+     cda:	be 0c 12 00 00       	mov    $0x120c,%esi
+     cdf:	eb 0e                	jmp    cef <printf+0x107>
+          putc(o, *s);
+     ce1:	0f be d2             	movsbl %dl,%edx
+     ce4:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     ce7:	e8 2f fe ff ff       	call   b1b <putc>
+          s++;
+     cec:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+     cef:	0f b6 16             	movzbl (%esi),%edx
+     cf2:	84 d2                	test   %dl,%dl
+     cf4:	75 eb                	jne    ce1 <printf+0xf9>
+      state = 0;
+     cf6:	be 00 00 00 00       	mov    $0x0,%esi
+     cfb:	e9 21 ff ff ff       	jmp    c21 <printf+0x39>
+        putc(o, *ap);
+     d00:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     d03:	0f be 17             	movsbl (%edi),%edx
+     d06:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d09:	e8 0d fe ff ff       	call   b1b <putc>
+        ap++;
+     d0e:	83 c7 04             	add    $0x4,%edi
+     d11:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+      state = 0;
+     d14:	be 00 00 00 00       	mov    $0x0,%esi
+     d19:	e9 03 ff ff ff       	jmp    c21 <printf+0x39>
+        putc(o, c);
+     d1e:	89 fa                	mov    %edi,%edx
+     d20:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d23:	e8 f3 fd ff ff       	call   b1b <putc>
+      state = 0;
+     d28:	be 00 00 00 00       	mov    $0x0,%esi
+     d2d:	e9 ef fe ff ff       	jmp    c21 <printf+0x39>
+        putc(o, '%');
+     d32:	ba 25 00 00 00       	mov    $0x25,%edx
+     d37:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d3a:	e8 dc fd ff ff       	call   b1b <putc>
+        putc(o, c);
+     d3f:	89 fa                	mov    %edi,%edx
+     d41:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d44:	e8 d2 fd ff ff       	call   b1b <putc>
+      state = 0;
+     d49:	be 00 00 00 00       	mov    $0x0,%esi
+     d4e:	e9 ce fe ff ff       	jmp    c21 <printf+0x39>
+    }
+  }
+  if(o->n > 0)
+     d53:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     d56:	85 c0                	test   %eax,%eax
+     d58:	7f 08                	jg     d62 <printf+0x17a>
+    bufwrite(fd, o->buf, o->n);
+}
+     d5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d5d:	5b                   	pop    %ebx
+     d5e:	5e                   	pop    %esi
+     d5f:	5f                   	pop    %edi
+     d60:	5d                   	pop    %ebp
+     d61:	c3                   	ret
+    bufwrite(fd, o->buf, o->n);
+     d62:	83 ec 04             	sub    $0x4,%esp
+     d65:	50                   	push   %eax
+     d66:	8d 45 a8             	lea    -0x58(%ebp),%eax
+     d69:	50                   	push   %eax
+     d6a:	ff 75 08             	push   0x8(%ebp)
+     d6d:	e8 91 f7 ff ff       	call   503 <bufwrite>
+     d72:	83 c4 10             	add    $0x10,%esp
+}
+     d75:	eb e3                	jmp    d5a <printf+0x172>
+
+00000d77 <largefree>:
+  return &b->h;
+}
+
+static void
+largefree(Fblock *b)
+{
+     d77:	55                   	push   %ebp
+     d78:	89 e5                	mov    %esp,%ebp
+     d7a:	57                   	push   %edi
+     d7b:	56                   	push   %esi
+     d7c:	53                   	push   %ebx
+     d7d:	83 ec 0c             	sub    $0xc,%esp
+     d80:	89 c1                	mov    %eax,%ecx
+  Fblock **pp, *p, *prev;
+
+  prev = 0;
+     d82:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     d87:	ba ec 39 00 00       	mov    $0x39ec,%edx
+     d8c:	eb 05                	jmp    d93 <largefree+0x1c>
+     d8e:	8d 50 08             	lea    0x8(%eax),%edx
+    prev = p;
+     d91:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     d93:	8b 02                	mov    (%edx),%eax
+     d95:	85 c0                	test   %eax,%eax
+     d97:	74 04                	je     d9d <largefree+0x26>
+     d99:	39 c8                	cmp    %ecx,%eax
+     d9b:	72 f1                	jb     d8e <largefree+0x17>
+  b->next = p;
+     d9d:	89 41 08             	mov    %eax,0x8(%ecx)
+  if(p && (char*)b + b->h.size == (char*)p){
+     da0:	85 c0                	test   %eax,%eax
+     da2:	74 09                	je     dad <largefree+0x36>
+     da4:	8b 31                	mov    (%ecx),%esi
+     da6:	8d 3c 31             	lea    (%ecx,%esi,1),%edi
+     da9:	39 c7                	cmp    %eax,%edi
+     dab:	74 21                	je     dce <largefree+0x57>
+    b->h.size += p->h.size;
+    b->next = p->next;
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+     dad:	85 db                	test   %ebx,%ebx
+     daf:	74 09                	je     dba <largefree+0x43>
+     db1:	8b 03                	mov    (%ebx),%eax
+     db3:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+     db6:	39 ce                	cmp    %ecx,%esi
+     db8:	74 20                	je     dda <largefree+0x63>
+    prev->h.size += b->h.size;
+    prev->next = b->next;
+  } else
+    *pp = b;
+     dba:	89 0a                	mov    %ecx,(%edx)
+
+  // Give the top of the heap back.  With threads sharing the
+  // address space sbrk() cannot shrink it; keep the block then.
+  for(pp = &large; (*pp)->next; pp = &(*pp)->next)
+     dbc:	be ec 39 00 00       	mov    $0x39ec,%esi
+     dc1:	8b 1e                	mov    (%esi),%ebx
+     dc3:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+     dc7:	74 1d                	je     de6 <largefree+0x6f>
+     dc9:	8d 73 08             	lea    0x8(%ebx),%esi
+     dcc:	eb f3                	jmp    dc1 <largefree+0x4a>
+    b->h.size += p->h.size;
+     dce:	03 30                	add    (%eax),%esi
+     dd0:	89 31                	mov    %esi,(%ecx)
+    b->next = p->next;
+     dd2:	8b 40 08             	mov    0x8(%eax),%eax
+     dd5:	89 41 08             	mov    %eax,0x8(%ecx)
+     dd8:	eb d3                	jmp    dad <largefree+0x36>
+    prev->h.size += b->h.size;
+     dda:	03 01                	add    (%ecx),%eax
+     ddc:	89 03                	mov    %eax,(%ebx)
+    prev->next = b->next;
+     dde:	8b 41 08             	mov    0x8(%ecx),%eax
+     de1:	89 43 08             	mov    %eax,0x8(%ebx)
+     de4:	eb d6                	jmp    dbc <largefree+0x45>
+    ;
+  b = *pp;
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     de6:	89 df                	mov    %ebx,%edi
+     de8:	03 3b                	add    (%ebx),%edi
+     dea:	83 ec 0c             	sub    $0xc,%esp
+     ded:	6a 00                	push   $0x0
+     def:	e8 93 fa ff ff       	call   887 <sbrk>
+     df4:	83 c4 10             	add    $0x10,%esp
+     df7:	39 c7                	cmp    %eax,%edi
+     df9:	74 08                	je     e03 <largefree+0x8c>
+    *pp = 0;
+}
+     dfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     dfe:	5b                   	pop    %ebx
+     dff:	5e                   	pop    %esi
+     e00:	5f                   	pop    %edi
+     e01:	5d                   	pop    %ebp
+     e02:	c3                   	ret
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     e03:	8b 03                	mov    (%ebx),%eax
+     e05:	f7 d8                	neg    %eax
+     e07:	83 ec 0c             	sub    $0xc,%esp
+     e0a:	50                   	push   %eax
+     e0b:	e8 77 fa ff ff       	call   887 <sbrk>
+     e10:	83 c4 10             	add    $0x10,%esp
+     e13:	83 f8 ff             	cmp    $0xffffffff,%eax
+     e16:	74 e3                	je     dfb <largefree+0x84>
+    *pp = 0;
+     e18:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+     e1e:	eb db                	jmp    dfb <largefree+0x84>
+
+00000e20 <more>:
+{
+     e20:	55                   	push   %ebp
+     e21:	89 e5                	mov    %esp,%ebp
+     e23:	56                   	push   %esi
+     e24:	53                   	push   %ebx
+     e25:	89 c6                	mov    %eax,%esi
+  pad = -(uint)sbrk(0) & 7;
+     e27:	83 ec 0c             	sub    $0xc,%esp
+     e2a:	6a 00                	push   $0x0
+     e2c:	e8 56 fa ff ff       	call   887 <sbrk>
+     e31:	f7 d8                	neg    %eax
+     e33:	89 c3                	mov    %eax,%ebx
+     e35:	83 e3 07             	and    $0x7,%ebx
+  if((p = sbrk(n + pad)) == (char*)-1)
+     e38:	01 de                	add    %ebx,%esi
+     e3a:	89 34 24             	mov    %esi,(%esp)
+     e3d:	e8 45 fa ff ff       	call   887 <sbrk>
+     e42:	83 c4 10             	add    $0x10,%esp
+     e45:	83 f8 ff             	cmp    $0xffffffff,%eax
+     e48:	74 09                	je     e53 <more+0x33>
+  return p + pad;
+     e4a:	01 d8                	add    %ebx,%eax
+}
+     e4c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e4f:	5b                   	pop    %ebx
+     e50:	5e                   	pop    %esi
+     e51:	5d                   	pop    %ebp
+     e52:	c3                   	ret
+    return 0;
+     e53:	b8 00 00 00 00       	mov    $0x0,%eax
+     e58:	eb f2                	jmp    e4c <more+0x2c>
+
+00000e5a <slaballoc>:
+{
+     e5a:	55                   	push   %ebp
+     e5b:	89 e5                	mov    %esp,%ebp
+     e5d:	56                   	push   %esi
+     e5e:	53                   	push   %ebx
+     e5f:	89 c6                	mov    %eax,%esi
+  n = 1 << (MINSHIFT + c);
+     e61:	8d 48 04             	lea    0x4(%eax),%ecx
+     e64:	bb 01 00 00 00       	mov    $0x1,%ebx
+     e69:	d3 e3                	shl    %cl,%ebx
+  if(slab + n > slabend){
+     e6b:	89 d8                	mov    %ebx,%eax
+     e6d:	03 05 e8 39 00 00    	add    0x39e8,%eax
+     e73:	39 05 e4 39 00 00    	cmp    %eax,0x39e4
+     e79:	72 17                	jb     e92 <slaballoc+0x38>
+  h = (Header*)slab;
+     e7b:	a1 e8 39 00 00       	mov    0x39e8,%eax
+  slab += n;
+     e80:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+     e83:	89 15 e8 39 00 00    	mov    %edx,0x39e8
+  h->size = n;
+     e89:	89 18                	mov    %ebx,(%eax)
+  h->class = c;
+     e8b:	89 70 04             	mov    %esi,0x4(%eax)
+}
+     e8e:	5b                   	pop    %ebx
+     e8f:	5e                   	pop    %esi
+     e90:	5d                   	pop    %ebp
+     e91:	c3                   	ret
+    if((p = more(SLABSZ)) == 0)
+     e92:	b8 00 40 00 00       	mov    $0x4000,%eax
+     e97:	e8 84 ff ff ff       	call   e20 <more>
+     e9c:	85 c0                	test   %eax,%eax
+     e9e:	74 ee                	je     e8e <slaballoc+0x34>
+    if(p != slabend)
+     ea0:	39 05 e4 39 00 00    	cmp    %eax,0x39e4
+     ea6:	74 05                	je     ead <slaballoc+0x53>
+      slab = p;
+     ea8:	a3 e8 39 00 00       	mov    %eax,0x39e8
+    slabend = p + SLABSZ;
+     ead:	05 00 40 00 00       	add    $0x4000,%eax
+     eb2:	a3 e4 39 00 00       	mov    %eax,0x39e4
+     eb7:	eb c2                	jmp    e7b <slaballoc+0x21>
+
+00000eb9 <largealloc>:
+{
+     eb9:	55                   	push   %ebp
+     eba:	89 e5                	mov    %esp,%ebp
+     ebc:	56                   	push   %esi
+     ebd:	53                   	push   %ebx
+     ebe:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     ec0:	b9 ec 39 00 00       	mov    $0x39ec,%ecx
+     ec5:	8b 01                	mov    (%ecx),%eax
+     ec7:	85 c0                	test   %eax,%eax
+     ec9:	74 36                	je     f01 <largealloc+0x48>
+    if(b->h.size < n)
+     ecb:	8b 10                	mov    (%eax),%edx
+     ecd:	39 da                	cmp    %ebx,%edx
+     ecf:	72 24                	jb     ef5 <largealloc+0x3c>
+    if(b->h.size - n > SMALLMAX){
+     ed1:	29 da                	sub    %ebx,%edx
+     ed3:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+     ed9:	76 1f                	jbe    efa <largealloc+0x41>
+      rest = (Fblock*)((char*)b + n);
+     edb:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+      rest->h.size = b->h.size - n;
+     ede:	89 16                	mov    %edx,(%esi)
+      rest->h.class = LARGE;
+     ee0:	c7 46 04 09 00 00 00 	movl   $0x9,0x4(%esi)
+      rest->next = b->next;
+     ee7:	8b 50 08             	mov    0x8(%eax),%edx
+     eea:	89 56 08             	mov    %edx,0x8(%esi)
+      *pp = rest;
+     eed:	89 31                	mov    %esi,(%ecx)
+      b->h.size = n;
+     eef:	89 18                	mov    %ebx,(%eax)
+}
+     ef1:	5b                   	pop    %ebx
+     ef2:	5e                   	pop    %esi
+     ef3:	5d                   	pop    %ebp
+     ef4:	c3                   	ret
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     ef5:	8d 48 08             	lea    0x8(%eax),%ecx
+     ef8:	eb cb                	jmp    ec5 <largealloc+0xc>
+      *pp = b->next;
+     efa:	8b 50 08             	mov    0x8(%eax),%edx
+     efd:	89 11                	mov    %edx,(%ecx)
+    return &b->h;
+     eff:	eb f0                	jmp    ef1 <largealloc+0x38>
+  if((b = more(n)) == 0)
+     f01:	89 d8                	mov    %ebx,%eax
+     f03:	e8 18 ff ff ff       	call   e20 <more>
+     f08:	85 c0                	test   %eax,%eax
+     f0a:	74 e5                	je     ef1 <largealloc+0x38>
+  b->h.size = n;
+     f0c:	89 18                	mov    %ebx,(%eax)
+  b->h.class = LARGE;
+     f0e:	c7 40 04 09 00 00 00 	movl   $0x9,0x4(%eax)
+  return &b->h;
+     f15:	eb da                	jmp    ef1 <largealloc+0x38>
+
+00000f17 <free>:
+
+void
+free(void *ap)
+{
+     f17:	55                   	push   %ebp
+     f18:	89 e5                	mov    %esp,%ebp
+     f1a:	56                   	push   %esi
+     f1b:	53                   	push   %ebx
+     f1c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+
+  if(ap == 0)
+     f1f:	85 db                	test   %ebx,%ebx
+     f21:	74 3b                	je     f5e <free+0x47>
+    return;
+  h = (Header*)ap - 1;
+     f23:	8d 73 f8             	lea    -0x8(%ebx),%esi
+  lock_acquire(&lock);
+     f26:	83 ec 0c             	sub    $0xc,%esp
+     f29:	68 e0 39 00 00       	push   $0x39e0
+     f2e:	e8 9c 01 00 00       	call   10cf <lock_acquire>
+  if(h->class == LARGE)
+     f33:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     f36:	83 c4 10             	add    $0x10,%esp
+     f39:	83 f8 09             	cmp    $0x9,%eax
+     f3c:	74 27                	je     f65 <free+0x4e>
+    largefree((Fblock*)h);
+  else {
+    ((Fblock*)h)->next = freelist[h->class];
+     f3e:	8b 14 85 00 3a 00 00 	mov    0x3a00(,%eax,4),%edx
+     f45:	89 13                	mov    %edx,(%ebx)
+    freelist[h->class] = (Fblock*)h;
+     f47:	89 34 85 00 3a 00 00 	mov    %esi,0x3a00(,%eax,4)
+  }
+  lock_release(&lock);
+     f4e:	83 ec 0c             	sub    $0xc,%esp
+     f51:	68 e0 39 00 00       	push   $0x39e0
+     f56:	e8 88 01 00 00       	call   10e3 <lock_release>
+     f5b:	83 c4 10             	add    $0x10,%esp
+}
+     f5e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f61:	5b                   	pop    %ebx
+     f62:	5e                   	pop    %esi
+     f63:	5d                   	pop    %ebp
+     f64:	c3                   	ret
+    largefree((Fblock*)h);
+     f65:	89 f0                	mov    %esi,%eax
+     f67:	e8 0b fe ff ff       	call   d77 <largefree>
+     f6c:	eb e0                	jmp    f4e <free+0x37>
+
+00000f6e <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     f6e:	55                   	push   %ebp
+     f6f:	89 e5                	mov    %esp,%ebp
+     f71:	53                   	push   %ebx
+     f72:	83 ec 04             	sub    $0x4,%esp
+     f75:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+  uint n;
+  int c;
+
+  if(nbytes > 0x7fffffff - sizeof(Header) - 7)
+     f78:	81 fb f0 ff ff 7f    	cmp    $0x7ffffff0,%ebx
+     f7e:	0f 87 8b 00 00 00    	ja     100f <malloc+0xa1>
+    return 0;
+  n = (nbytes + sizeof(Header) + 7) & ~7;
+     f84:	83 c3 0f             	add    $0xf,%ebx
+     f87:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(n < sizeof(Fblock))
+     f8a:	83 fb 0b             	cmp    $0xb,%ebx
+     f8d:	77 05                	ja     f94 <malloc+0x26>
+    n = sizeof(Fblock);
+     f8f:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  lock_acquire(&lock);
+     f94:	83 ec 0c             	sub    $0xc,%esp
+     f97:	68 e0 39 00 00       	push   $0x39e0
+     f9c:	e8 2e 01 00 00       	call   10cf <lock_acquire>
+  if(n <= SMALLMAX){
+     fa1:	83 c4 10             	add    $0x10,%esp
+     fa4:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+     faa:	77 58                	ja     1004 <malloc+0x96>
+    for(c = 0; (1 << (MINSHIFT + c)) < n; c++)
+     fac:	ba 00 00 00 00       	mov    $0x0,%edx
+     fb1:	eb 03                	jmp    fb6 <malloc+0x48>
+     fb3:	83 c2 01             	add    $0x1,%edx
+     fb6:	8d 4a 04             	lea    0x4(%edx),%ecx
+     fb9:	b8 01 00 00 00       	mov    $0x1,%eax
+     fbe:	d3 e0                	shl    %cl,%eax
+     fc0:	39 d8                	cmp    %ebx,%eax
+     fc2:	72 ef                	jb     fb3 <malloc+0x45>
+      ;
+    if(freelist[c]){
+     fc4:	8b 04 95 00 3a 00 00 	mov    0x3a00(,%edx,4),%eax
+     fcb:	85 c0                	test   %eax,%eax
+     fcd:	74 2a                	je     ff9 <malloc+0x8b>
+      h = &freelist[c]->h;
+     fcf:	89 c3                	mov    %eax,%ebx
+      freelist[c] = freelist[c]->next;
+     fd1:	8b 40 08             	mov    0x8(%eax),%eax
+     fd4:	89 04 95 00 3a 00 00 	mov    %eax,0x3a00(,%edx,4)
+    } else
+      h = slaballoc(c);
+  } else
+    h = largealloc(n);
+  lock_release(&lock);
+     fdb:	83 ec 0c             	sub    $0xc,%esp
+     fde:	68 e0 39 00 00       	push   $0x39e0
+     fe3:	e8 fb 00 00 00       	call   10e3 <lock_release>
+  return h ? (void*)(h + 1) : 0;
+     fe8:	83 c4 10             	add    $0x10,%esp
+     feb:	85 db                	test   %ebx,%ebx
+     fed:	74 03                	je     ff2 <malloc+0x84>
+     fef:	83 c3 08             	add    $0x8,%ebx
+}
+     ff2:	89 d8                	mov    %ebx,%eax
+     ff4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ff7:	c9                   	leave
+     ff8:	c3                   	ret
+      h = slaballoc(c);
+     ff9:	89 d0                	mov    %edx,%eax
+     ffb:	e8 5a fe ff ff       	call   e5a <slaballoc>
+    1000:	89 c3                	mov    %eax,%ebx
+    1002:	eb d7                	jmp    fdb <malloc+0x6d>
+    h = largealloc(n);
+    1004:	89 d8                	mov    %ebx,%eax
+    1006:	e8 ae fe ff ff       	call   eb9 <largealloc>
+    100b:	89 c3                	mov    %eax,%ebx
+    100d:	eb cc                	jmp    fdb <malloc+0x6d>
+    return 0;
+    100f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1014:	eb dc                	jmp    ff2 <malloc+0x84>
+
+00001016 <tstart>:
+  void *arg;
+};
+
+static void
+tstart(void *a)
+{
+    1016:	55                   	push   %ebp
+    1017:	89 e5                	mov    %esp,%ebp
+    1019:	83 ec 14             	sub    $0x14,%esp
+    101c:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+    101f:	ff 70 04             	push   0x4(%eax)
+    1022:	ff 10                	call   *(%eax)
+  exit();
+    1024:	e8 86 f6 ff ff       	call   6af <exit>
+
+00001029 <thread_create>:
+}
+
+// Run fn(arg) in a new thread.  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1029:	55                   	push   %ebp
+    102a:	89 e5                	mov    %esp,%ebp
+    102c:	56                   	push   %esi
+    102d:	53                   	push   %ebx
+  struct tstart *t;
+  char *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    102e:	83 ec 0c             	sub    $0xc,%esp
+    1031:	68 00 10 00 00       	push   $0x1000
+    1036:	e8 33 ff ff ff       	call   f6e <malloc>
+    103b:	83 c4 10             	add    $0x10,%esp
+    103e:	85 c0                	test   %eax,%eax
+    1040:	74 42                	je     1084 <thread_create+0x5b>
+    1042:	89 c3                	mov    %eax,%ebx
+    return -1;
+  t = (struct tstart*)stack;
+  t->fn = fn;
+    1044:	8b 45 08             	mov    0x8(%ebp),%eax
+    1047:	89 03                	mov    %eax,(%ebx)
+  t->arg = arg;
+    1049:	8b 45 0c             	mov    0xc(%ebp),%eax
+    104c:	89 43 04             	mov    %eax,0x4(%ebx)
+  if((pid = clone(tstart, stack + TSTACK, t)) < 0)
+    104f:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    1055:	83 ec 04             	sub    $0x4,%esp
+    1058:	53                   	push   %ebx
+    1059:	50                   	push   %eax
+    105a:	68 16 10 00 00       	push   $0x1016
+    105f:	e8 f5 f8 ff ff       	call   959 <clone>
+    1064:	89 c6                	mov    %eax,%esi
+    1066:	83 c4 10             	add    $0x10,%esp
+    1069:	85 c0                	test   %eax,%eax
+    106b:	78 09                	js     1076 <thread_create+0x4d>
+    free(stack);
+  return pid;
+}
+    106d:	89 f0                	mov    %esi,%eax
+    106f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1072:	5b                   	pop    %ebx
+    1073:	5e                   	pop    %esi
+    1074:	5d                   	pop    %ebp
+    1075:	c3                   	ret
+    free(stack);
+    1076:	83 ec 0c             	sub    $0xc,%esp
+    1079:	53                   	push   %ebx
+    107a:	e8 98 fe ff ff       	call   f17 <free>
+    107f:	83 c4 10             	add    $0x10,%esp
+    1082:	eb e9                	jmp    106d <thread_create+0x44>
+    return -1;
+    1084:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1089:	eb e2                	jmp    106d <thread_create+0x44>
+
+0000108b <thread_join>:
+
+// Wait for one of this process's threads to exit and free its
+// stack.  Returns its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+    108b:	55                   	push   %ebp
+    108c:	89 e5                	mov    %esp,%ebp
+    108e:	53                   	push   %ebx
+    108f:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    1092:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1095:	50                   	push   %eax
+    1096:	e8 cd f8 ff ff       	call   968 <join>
+    109b:	89 c3                	mov    %eax,%ebx
+    109d:	83 c4 10             	add    $0x10,%esp
+    10a0:	85 c0                	test   %eax,%eax
+    10a2:	79 07                	jns    10ab <thread_join+0x20>
+    free((char*)stack - TSTACK);
+  return pid;
+}
+    10a4:	89 d8                	mov    %ebx,%eax
+    10a6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10a9:	c9                   	leave
+    10aa:	c3                   	ret
+    free((char*)stack - TSTACK);
+    10ab:	83 ec 0c             	sub    $0xc,%esp
+    10ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10b1:	2d 00 10 00 00       	sub    $0x1000,%eax
+    10b6:	50                   	push   %eax
+    10b7:	e8 5b fe ff ff       	call   f17 <free>
+    10bc:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    10bf:	eb e3                	jmp    10a4 <thread_join+0x19>
+
+000010c1 <lock_init>:
+
+void
+lock_init(lock_t *lk)
+{
+    10c1:	55                   	push   %ebp
+    10c2:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    10c4:	8b 45 08             	mov    0x8(%ebp),%eax
+    10c7:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    10cd:	5d                   	pop    %ebp
+    10ce:	c3                   	ret
+
+000010cf <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+    10cf:	55                   	push   %ebp
+    10d0:	89 e5                	mov    %esp,%ebp
+    10d2:	8b 55 08             	mov    0x8(%ebp),%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    10d5:	b8 01 00 00 00       	mov    $0x1,%eax
+    10da:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    10dd:	85 c0                	test   %eax,%eax
+    10df:	75 f4                	jne    10d5 <lock_acquire+0x6>
+    ;
+}
+    10e1:	5d                   	pop    %ebp
+    10e2:	c3                   	ret
+
+000010e3 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+    10e3:	55                   	push   %ebp
+    10e4:	89 e5                	mov    %esp,%ebp
+    10e6:	8b 55 08             	mov    0x8(%ebp),%edx
+    10e9:	b8 00 00 00 00       	mov    $0x0,%eax
+    10ee:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    10f1:	5d                   	pop    %ebp
+    10f2:	c3                   	ret
+
+000010f3 <mutex_init>:
+// Are Tricky": state is 0 when free, 1 when held, 2 when held and
+// others may be waiting.  Unlocking an uncontended mutex costs no
+// system call.
+void
+mutex_init(mutex_t *m)
+{
+    10f3:	55                   	push   %ebp
+    10f4:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    10f6:	8b 45 08             	mov    0x8(%ebp),%eax
+    10f9:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    10ff:	5d                   	pop    %ebp
+    1100:	c3                   	ret
+
+00001101 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+    1101:	55                   	push   %ebp
+    1102:	89 e5                	mov    %esp,%ebp
+    1104:	53                   	push   %ebx
+    1105:	83 ec 04             	sub    $0x4,%esp
+    1108:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    110b:	b8 00 00 00 00       	mov    $0x0,%eax
+    1110:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1115:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    1119:	85 c0                	test   %eax,%eax
+    111b:	74 29                	je     1146 <mutex_lock+0x45>
+    return;
+  if(c != 2)
+    111d:	83 f8 02             	cmp    $0x2,%eax
+    1120:	74 20                	je     1142 <mutex_lock+0x41>
+    1122:	b8 02 00 00 00       	mov    $0x2,%eax
+    1127:	f0 87 03             	lock xchg %eax,(%ebx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    112a:	eb 16                	jmp    1142 <mutex_lock+0x41>
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    112c:	83 ec 08             	sub    $0x8,%esp
+    112f:	6a 02                	push   $0x2
+    1131:	53                   	push   %ebx
+    1132:	e8 40 f8 ff ff       	call   977 <futex_wait>
+  asm volatile("lock; xchgl %0, %1" :
+    1137:	b8 02 00 00 00       	mov    $0x2,%eax
+    113c:	f0 87 03             	lock xchg %eax,(%ebx)
+    113f:	83 c4 10             	add    $0x10,%esp
+  while(c != 0){
+    1142:	85 c0                	test   %eax,%eax
+    1144:	75 e6                	jne    112c <mutex_lock+0x2b>
+    c = xchg(&m->state, 2);
+  }
+}
+    1146:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1149:	c9                   	leave
+    114a:	c3                   	ret
+
+0000114b <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+    114b:	55                   	push   %ebp
+    114c:	89 e5                	mov    %esp,%ebp
+    114e:	83 ec 08             	sub    $0x8,%esp
+    1151:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    1154:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    1159:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    115d:	83 fa 01             	cmp    $0x1,%edx
+    1160:	75 02                	jne    1164 <mutex_unlock+0x19>
+    m->state = 0;
+    futex_wake(&m->state, 1);
+  }
+}
+    1162:	c9                   	leave
+    1163:	c3                   	ret
+    m->state = 0;
+    1164:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+    116a:	83 ec 08             	sub    $0x8,%esp
+    116d:	6a 01                	push   $0x1
+    116f:	50                   	push   %eax
+    1170:	e8 11 f8 ff ff       	call   986 <futex_wake>
+    1175:	83 c4 10             	add    $0x10,%esp
+}
+    1178:	eb e8                	jmp    1162 <mutex_unlock+0x17>
+
+0000117a <cond_init>:
+// Condition variable: waiters sleep on a sequence number that
+// every signal bumps, so a signal between the unlock and the
+// futex_wait() in cond_wait() is not lost.
+void
+cond_init(cond_t *c)
+{
+    117a:	55                   	push   %ebp
+    117b:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    117d:	8b 45 08             	mov    0x8(%ebp),%eax
+    1180:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1186:	5d                   	pop    %ebp
+    1187:	c3                   	ret
+
+00001188 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+    1188:	55                   	push   %ebp
+    1189:	89 e5                	mov    %esp,%ebp
+    118b:	57                   	push   %edi
+    118c:	56                   	push   %esi
+    118d:	53                   	push   %ebx
+    118e:	83 ec 18             	sub    $0x18,%esp
+    1191:	8b 75 08             	mov    0x8(%ebp),%esi
+    1194:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    1197:	8b 3e                	mov    (%esi),%edi
+  mutex_unlock(m);
+    1199:	53                   	push   %ebx
+    119a:	e8 ac ff ff ff       	call   114b <mutex_unlock>
+  futex_wait(&c->seq, seq);
+    119f:	83 c4 08             	add    $0x8,%esp
+    11a2:	57                   	push   %edi
+    11a3:	56                   	push   %esi
+    11a4:	e8 ce f7 ff ff       	call   977 <futex_wait>
+  // Others may be waiting for m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+    11a9:	83 c4 10             	add    $0x10,%esp
+    11ac:	eb 0e                	jmp    11bc <cond_wait+0x34>
+    futex_wait(&m->state, 2);
+    11ae:	83 ec 08             	sub    $0x8,%esp
+    11b1:	6a 02                	push   $0x2
+    11b3:	53                   	push   %ebx
+    11b4:	e8 be f7 ff ff       	call   977 <futex_wait>
+    11b9:	83 c4 10             	add    $0x10,%esp
+    11bc:	b8 02 00 00 00       	mov    $0x2,%eax
+    11c1:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    11c4:	85 c0                	test   %eax,%eax
+    11c6:	75 e6                	jne    11ae <cond_wait+0x26>
+}
+    11c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11cb:	5b                   	pop    %ebx
+    11cc:	5e                   	pop    %esi
+    11cd:	5f                   	pop    %edi
+    11ce:	5d                   	pop    %ebp
+    11cf:	c3                   	ret
+
+000011d0 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+    11d0:	55                   	push   %ebp
+    11d1:	89 e5                	mov    %esp,%ebp
+    11d3:	83 ec 10             	sub    $0x10,%esp
+    11d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    11d9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+    11dd:	6a 01                	push   $0x1
+    11df:	50                   	push   %eax
+    11e0:	e8 a1 f7 ff ff       	call   986 <futex_wake>
+}
+    11e5:	83 c4 10             	add    $0x10,%esp
+    11e8:	c9                   	leave
+    11e9:	c3                   	ret
+
+000011ea <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+    11ea:	55                   	push   %ebp
+    11eb:	89 e5                	mov    %esp,%ebp
+    11ed:	83 ec 10             	sub    $0x10,%esp
+    11f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    11f3:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, NPROC);
+    11f7:	6a 40                	push   $0x40
+    11f9:	50                   	push   %eax
+    11fa:	e8 87 f7 ff ff       	call   986 <futex_wake>
+}
+    11ff:	83 c4 10             	add    $0x10,%esp
+    1202:	c9                   	leave
+    1203:	c3                   	ret
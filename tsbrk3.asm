@@ -0,0 +1,2750 @@
+
+_tsbrk3:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fcntl.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	56                   	push   %esi
+       e:	53                   	push   %ebx
+       f:	51                   	push   %ecx
+      10:	83 ec 14             	sub    $0x14,%esp
+  int fh = open ("README", O_RDONLY);
+      13:	6a 00                	push   $0x0
+      15:	68 f8 11 00 00       	push   $0x11f8
+      1a:	e8 d5 07 00 00       	call   7f4 <open>
+      1f:	89 c3                	mov    %eax,%ebx
+
+  char* a = sbrk (15000);
+      21:	c7 04 24 98 3a 00 00 	movl   $0x3a98,(%esp)
+      28:	e8 4e 08 00 00       	call   87b <sbrk>
+
+  read (fh, a+8192, 50);
+      2d:	8d b0 00 20 00 00    	lea    0x2000(%eax),%esi
+      33:	83 c4 0c             	add    $0xc,%esp
+      36:	6a 32                	push   $0x32
+      38:	56                   	push   %esi
+      39:	53                   	push   %ebx
+      3a:	e8 88 07 00 00       	call   7c7 <read>
+
+  // Debe imprimir los 50 primeros caracteres de README
+  printf (1, "Debe imprimir los 50 primeros caracteres de README:\n");
+      3f:	83 c4 08             	add    $0x8,%esp
+      42:	68 04 12 00 00       	push   $0x1204
+      47:	6a 01                	push   $0x1
+      49:	e8 8e 0b 00 00       	call   bdc <printf>
+  printf (1, "%s\n", a+8192);
+      4e:	83 c4 0c             	add    $0xc,%esp
+      51:	56                   	push   %esi
+      52:	68 ff 11 00 00       	push   $0x11ff
+      57:	6a 01                	push   $0x1
+      59:	e8 7e 0b 00 00       	call   bdc <printf>
+
+  close (fh);
+      5e:	89 1c 24             	mov    %ebx,(%esp)
+      61:	e8 6c 06 00 00       	call   6d2 <close>
+
+  exit();
+      66:	e8 38 06 00 00       	call   6a3 <exit>
+
+0000006b <strcpy>:
+#include "memlayout.h"
+#include "clock.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+      6b:	55                   	push   %ebp
+      6c:	89 e5                	mov    %esp,%ebp
+      6e:	56                   	push   %esi
+      6f:	53                   	push   %ebx
+      70:	8b 75 08             	mov    0x8(%ebp),%esi
+      73:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+      76:	89 f0                	mov    %esi,%eax
+      78:	89 d1                	mov    %edx,%ecx
+      7a:	83 c2 01             	add    $0x1,%edx
+      7d:	89 c3                	mov    %eax,%ebx
+      7f:	83 c0 01             	add    $0x1,%eax
+      82:	0f b6 09             	movzbl (%ecx),%ecx
+      85:	88 0b                	mov    %cl,(%ebx)
+      87:	84 c9                	test   %cl,%cl
+      89:	75 ed                	jne    78 <strcpy+0xd>
+    ;
+  return os;
+}
+      8b:	89 f0                	mov    %esi,%eax
+      8d:	5b                   	pop    %ebx
+      8e:	5e                   	pop    %esi
+      8f:	5d                   	pop    %ebp
+      90:	c3                   	ret
+
+00000091 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+      91:	55                   	push   %ebp
+      92:	89 e5                	mov    %esp,%ebp
+      94:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      97:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+      9a:	eb 06                	jmp    a2 <strcmp+0x11>
+    p++, q++;
+      9c:	83 c1 01             	add    $0x1,%ecx
+      9f:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+      a2:	0f b6 01             	movzbl (%ecx),%eax
+      a5:	84 c0                	test   %al,%al
+      a7:	74 04                	je     ad <strcmp+0x1c>
+      a9:	3a 02                	cmp    (%edx),%al
+      ab:	74 ef                	je     9c <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+      ad:	0f b6 c0             	movzbl %al,%eax
+      b0:	0f b6 12             	movzbl (%edx),%edx
+      b3:	29 d0                	sub    %edx,%eax
+}
+      b5:	5d                   	pop    %ebp
+      b6:	c3                   	ret
+
+000000b7 <strlen>:
+
+uint
+strlen(const char *s)
+{
+      b7:	55                   	push   %ebp
+      b8:	89 e5                	mov    %esp,%ebp
+      ba:	53                   	push   %ebx
+      bb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  const char *p;
+  uint w;
+
+  for(p = s; (uint)p & 3; p++)
+      be:	89 c8                	mov    %ecx,%eax
+      c0:	eb 03                	jmp    c5 <strlen+0xe>
+      c2:	83 c0 01             	add    $0x1,%eax
+      c5:	a8 03                	test   $0x3,%al
+      c7:	74 09                	je     d2 <strlen+0x1b>
+    if(*p == 0)
+      c9:	80 38 00             	cmpb   $0x0,(%eax)
+      cc:	75 f4                	jne    c2 <strlen+0xb>
+      return p - s;
+      ce:	29 c8                	sub    %ecx,%eax
+      d0:	eb 25                	jmp    f7 <strlen+0x40>
+  // Then a word at a time, which never crosses into the next page:
+  // a word with a zero byte in it has one of these bits set.
+  for(;; p += 4){
+    w = *(uint*)p;
+      d2:	8b 10                	mov    (%eax),%edx
+    if((w - 0x01010101) & ~w & 0x80808080)
+      d4:	8d 9a ff fe fe fe    	lea    -0x1010101(%edx),%ebx
+      da:	f7 d2                	not    %edx
+      dc:	21 da                	and    %ebx,%edx
+      de:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+      e4:	75 05                	jne    eb <strlen+0x34>
+  for(;; p += 4){
+      e6:	83 c0 04             	add    $0x4,%eax
+    w = *(uint*)p;
+      e9:	eb e7                	jmp    d2 <strlen+0x1b>
+      break;
+  }
+  while(*p)
+      eb:	80 38 00             	cmpb   $0x0,(%eax)
+      ee:	74 05                	je     f5 <strlen+0x3e>
+    p++;
+      f0:	83 c0 01             	add    $0x1,%eax
+      f3:	eb f6                	jmp    eb <strlen+0x34>
+  return p - s;
+      f5:	29 c8                	sub    %ecx,%eax
+}
+      f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      fa:	c9                   	leave
+      fb:	c3                   	ret
+
+000000fc <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+      fc:	55                   	push   %ebp
+      fd:	89 e5                	mov    %esp,%ebp
+      ff:	57                   	push   %edi
+     100:	56                   	push   %esi
+     101:	53                   	push   %ebx
+     102:	8b 55 10             	mov    0x10(%ebp),%edx
+  uint h;
+  char *d;
+
+  d = dst;
+  c &= 0xFF;
+     105:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  if(n >= 16){
+     109:	83 fa 0f             	cmp    $0xf,%edx
+     10c:	76 52                	jbe    160 <memset+0x64>
+    h = -(uint)d & 3;
+     10e:	8b 45 08             	mov    0x8(%ebp),%eax
+     111:	f7 d8                	neg    %eax
+     113:	83 e0 03             	and    $0x3,%eax
+     116:	89 c6                	mov    %eax,%esi
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     118:	8b 7d 08             	mov    0x8(%ebp),%edi
+     11b:	89 c1                	mov    %eax,%ecx
+     11d:	89 d8                	mov    %ebx,%eax
+     11f:	fc                   	cld
+     120:	f3 aa                	rep stos %al,%es:(%edi)
+    stosb(d, c, h);
+    stosl(d + h, (c<<24)|(c<<16)|(c<<8)|c, (n - h)/4);
+     122:	29 f2                	sub    %esi,%edx
+     124:	89 d1                	mov    %edx,%ecx
+     126:	c1 e9 02             	shr    $0x2,%ecx
+     129:	c1 e0 18             	shl    $0x18,%eax
+     12c:	89 df                	mov    %ebx,%edi
+     12e:	c1 e7 10             	shl    $0x10,%edi
+     131:	09 f8                	or     %edi,%eax
+     133:	89 df                	mov    %ebx,%edi
+     135:	c1 e7 08             	shl    $0x8,%edi
+     138:	09 f8                	or     %edi,%eax
+     13a:	09 d8                	or     %ebx,%eax
+     13c:	89 f7                	mov    %esi,%edi
+     13e:	03 7d 08             	add    0x8(%ebp),%edi
+}
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosl" :
+     141:	fc                   	cld
+     142:	f3 ab                	rep stos %eax,%es:(%edi)
+    d += h + (n - h)/4*4;
+     144:	89 d7                	mov    %edx,%edi
+     146:	83 e7 fc             	and    $0xfffffffc,%edi
+     149:	09 f7                	or     %esi,%edi
+     14b:	03 7d 08             	add    0x8(%ebp),%edi
+    n = (n - h)%4;
+     14e:	83 e2 03             	and    $0x3,%edx
+  asm volatile("cld; rep stosb" :
+     151:	89 d1                	mov    %edx,%ecx
+     153:	89 d8                	mov    %ebx,%eax
+     155:	fc                   	cld
+     156:	f3 aa                	rep stos %al,%es:(%edi)
+  }
+  stosb(d, c, n);
+  return dst;
+}
+     158:	8b 45 08             	mov    0x8(%ebp),%eax
+     15b:	5b                   	pop    %ebx
+     15c:	5e                   	pop    %esi
+     15d:	5f                   	pop    %edi
+     15e:	5d                   	pop    %ebp
+     15f:	c3                   	ret
+  d = dst;
+     160:	8b 7d 08             	mov    0x8(%ebp),%edi
+     163:	eb ec                	jmp    151 <memset+0x55>
+
+00000165 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     165:	55                   	push   %ebp
+     166:	89 e5                	mov    %esp,%ebp
+     168:	8b 45 08             	mov    0x8(%ebp),%eax
+     16b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     16f:	eb 03                	jmp    174 <strchr+0xf>
+     171:	83 c0 01             	add    $0x1,%eax
+     174:	0f b6 10             	movzbl (%eax),%edx
+     177:	84 d2                	test   %dl,%dl
+     179:	74 06                	je     181 <strchr+0x1c>
+    if(*s == c)
+     17b:	38 ca                	cmp    %cl,%dl
+     17d:	75 f2                	jne    171 <strchr+0xc>
+     17f:	eb 05                	jmp    186 <strchr+0x21>
+      return (char*)s;
+  return 0;
+     181:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     186:	5d                   	pop    %ebp
+     187:	c3                   	ret
+
+00000188 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     188:	55                   	push   %ebp
+     189:	89 e5                	mov    %esp,%ebp
+     18b:	56                   	push   %esi
+     18c:	53                   	push   %ebx
+     18d:	8b 55 08             	mov    0x8(%ebp),%edx
+     190:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     193:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  // A word at a time while they agree.
+  if((((uint)s1 | (uint)s2) & 3) == 0)
+     196:	89 d3                	mov    %edx,%ebx
+     198:	09 cb                	or     %ecx,%ebx
+     19a:	f6 c3 03             	test   $0x3,%bl
+     19d:	74 24                	je     1c3 <memcmp+0x3b>
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+      s1 += 4, s2 += 4;
+  while(n-- > 0){
+     19f:	8d 70 ff             	lea    -0x1(%eax),%esi
+     1a2:	85 c0                	test   %eax,%eax
+     1a4:	74 32                	je     1d8 <memcmp+0x50>
+    if(*s1 != *s2)
+     1a6:	0f b6 02             	movzbl (%edx),%eax
+     1a9:	0f b6 19             	movzbl (%ecx),%ebx
+     1ac:	38 d8                	cmp    %bl,%al
+     1ae:	75 20                	jne    1d0 <memcmp+0x48>
+      return *s1 - *s2;
+    s1++, s2++;
+     1b0:	83 c2 01             	add    $0x1,%edx
+     1b3:	83 c1 01             	add    $0x1,%ecx
+  while(n-- > 0){
+     1b6:	89 f0                	mov    %esi,%eax
+     1b8:	eb e5                	jmp    19f <memcmp+0x17>
+      s1 += 4, s2 += 4;
+     1ba:	83 c2 04             	add    $0x4,%edx
+     1bd:	83 c1 04             	add    $0x4,%ecx
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+     1c0:	83 e8 04             	sub    $0x4,%eax
+     1c3:	83 f8 03             	cmp    $0x3,%eax
+     1c6:	76 d7                	jbe    19f <memcmp+0x17>
+     1c8:	8b 31                	mov    (%ecx),%esi
+     1ca:	39 32                	cmp    %esi,(%edx)
+     1cc:	74 ec                	je     1ba <memcmp+0x32>
+     1ce:	eb cf                	jmp    19f <memcmp+0x17>
+      return *s1 - *s2;
+     1d0:	0f b6 c0             	movzbl %al,%eax
+     1d3:	0f b6 db             	movzbl %bl,%ebx
+     1d6:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     1d8:	5b                   	pop    %ebx
+     1d9:	5e                   	pop    %esi
+     1da:	5d                   	pop    %ebp
+     1db:	c3                   	ret
+
+000001dc <memchr>:
+// The first c in the n bytes at v, or 0.  Once aligned, a word at
+// a time, with the word's bytes that equal c turned into zeroes
+// and those looked for.
+void*
+memchr(const void *v, int c, uint n)
+{
+     1dc:	55                   	push   %ebp
+     1dd:	89 e5                	mov    %esp,%ebp
+     1df:	57                   	push   %edi
+     1e0:	56                   	push   %esi
+     1e1:	53                   	push   %ebx
+     1e2:	8b 45 08             	mov    0x8(%ebp),%eax
+     1e5:	8b 55 10             	mov    0x10(%ebp),%edx
+  const uchar *s;
+  uint w, rep;
+
+  s = v;
+  c = (uchar)c;
+     1e8:	0f b6 75 0c          	movzbl 0xc(%ebp),%esi
+  for(; n > 0 && ((uint)s & 3); n--, s++)
+     1ec:	eb 06                	jmp    1f4 <memchr+0x18>
+     1ee:	83 ea 01             	sub    $0x1,%edx
+     1f1:	83 c0 01             	add    $0x1,%eax
+     1f4:	85 d2                	test   %edx,%edx
+     1f6:	74 0d                	je     205 <memchr+0x29>
+     1f8:	a8 03                	test   $0x3,%al
+     1fa:	74 09                	je     205 <memchr+0x29>
+    if(*s == c)
+     1fc:	0f b6 08             	movzbl (%eax),%ecx
+     1ff:	39 f1                	cmp    %esi,%ecx
+     201:	75 eb                	jne    1ee <memchr+0x12>
+     203:	eb 41                	jmp    246 <memchr+0x6a>
+      return (void*)s;
+  rep = c * 0x01010101;
+     205:	69 fe 01 01 01 01    	imul   $0x1010101,%esi,%edi
+  for(; n >= 4; n -= 4, s += 4){
+     20b:	eb 06                	jmp    213 <memchr+0x37>
+     20d:	83 ea 04             	sub    $0x4,%edx
+     210:	83 c0 04             	add    $0x4,%eax
+     213:	83 fa 03             	cmp    $0x3,%edx
+     216:	76 16                	jbe    22e <memchr+0x52>
+    w = *(uint*)s ^ rep;
+     218:	89 f9                	mov    %edi,%ecx
+     21a:	33 08                	xor    (%eax),%ecx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     21c:	8d 99 ff fe fe fe    	lea    -0x1010101(%ecx),%ebx
+     222:	f7 d1                	not    %ecx
+     224:	21 cb                	and    %ecx,%ebx
+     226:	f7 c3 80 80 80 80    	test   $0x80808080,%ebx
+     22c:	74 df                	je     20d <memchr+0x31>
+      break;
+  }
+  for(; n > 0; n--, s++)
+     22e:	85 d2                	test   %edx,%edx
+     230:	74 0f                	je     241 <memchr+0x65>
+    if(*s == c)
+     232:	0f b6 08             	movzbl (%eax),%ecx
+     235:	39 f1                	cmp    %esi,%ecx
+     237:	74 0d                	je     246 <memchr+0x6a>
+  for(; n > 0; n--, s++)
+     239:	83 ea 01             	sub    $0x1,%edx
+     23c:	83 c0 01             	add    $0x1,%eax
+     23f:	eb ed                	jmp    22e <memchr+0x52>
+      return (void*)s;
+  return 0;
+     241:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     246:	5b                   	pop    %ebx
+     247:	5e                   	pop    %esi
+     248:	5f                   	pop    %edi
+     249:	5d                   	pop    %ebp
+     24a:	c3                   	ret
+
+0000024b <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     24b:	55                   	push   %ebp
+     24c:	89 e5                	mov    %esp,%ebp
+     24e:	57                   	push   %edi
+     24f:	56                   	push   %esi
+     250:	53                   	push   %ebx
+     251:	83 ec 1c             	sub    $0x1c,%esp
+     254:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     257:	bb 00 00 00 00       	mov    $0x0,%ebx
+     25c:	89 de                	mov    %ebx,%esi
+     25e:	83 c3 01             	add    $0x1,%ebx
+     261:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     264:	7d 2e                	jge    294 <gets+0x49>
+    cc = read(0, &c, 1);
+     266:	83 ec 04             	sub    $0x4,%esp
+     269:	6a 01                	push   $0x1
+     26b:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     26e:	50                   	push   %eax
+     26f:	6a 00                	push   $0x0
+     271:	e8 51 05 00 00       	call   7c7 <read>
+    if(cc < 1)
+     276:	83 c4 10             	add    $0x10,%esp
+     279:	85 c0                	test   %eax,%eax
+     27b:	7e 17                	jle    294 <gets+0x49>
+      break;
+    buf[i++] = c;
+     27d:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     281:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+     284:	3c 0a                	cmp    $0xa,%al
+     286:	0f 94 c2             	sete   %dl
+     289:	3c 0d                	cmp    $0xd,%al
+     28b:	0f 94 c0             	sete   %al
+     28e:	08 c2                	or     %al,%dl
+     290:	74 ca                	je     25c <gets+0x11>
+    buf[i++] = c;
+     292:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+     294:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+     298:	89 f8                	mov    %edi,%eax
+     29a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     29d:	5b                   	pop    %ebx
+     29e:	5e                   	pop    %esi
+     29f:	5f                   	pop    %edi
+     2a0:	5d                   	pop    %ebp
+     2a1:	c3                   	ret
+
+000002a2 <atoi>:
+  return r;
+}
+
+int
+atoi(const char *s)
+{
+     2a2:	55                   	push   %ebp
+     2a3:	89 e5                	mov    %esp,%ebp
+     2a5:	53                   	push   %ebx
+     2a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+     2a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+     2ae:	eb 10                	jmp    2c0 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+     2b0:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+     2b3:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+     2b6:	83 c1 01             	add    $0x1,%ecx
+     2b9:	0f be c0             	movsbl %al,%eax
+     2bc:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+     2c0:	0f b6 01             	movzbl (%ecx),%eax
+     2c3:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     2c6:	80 fb 09             	cmp    $0x9,%bl
+     2c9:	76 e5                	jbe    2b0 <atoi+0xe>
+  return n;
+}
+     2cb:	89 d0                	mov    %edx,%eax
+     2cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     2d0:	c9                   	leave
+     2d1:	c3                   	ret
+
+000002d2 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     2d2:	55                   	push   %ebp
+     2d3:	89 e5                	mov    %esp,%ebp
+     2d5:	57                   	push   %edi
+     2d6:	56                   	push   %esi
+     2d7:	53                   	push   %ebx
+     2d8:	83 ec 08             	sub    $0x8,%esp
+     2db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     2de:	8b 55 0c             	mov    0xc(%ebp),%edx
+     2e1:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *src;
+  int h;
+
+  dst = vdst;
+  src = vsrc;
+  if(n <= 0)
+     2e4:	85 c0                	test   %eax,%eax
+     2e6:	0f 8e 82 00 00 00    	jle    36e <memmove+0x9c>
+    return vdst;
+  if(src < dst && src + n > dst){
+     2ec:	39 da                	cmp    %ebx,%edx
+     2ee:	73 07                	jae    2f7 <memmove+0x25>
+     2f0:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+     2f3:	39 cb                	cmp    %ecx,%ebx
+     2f5:	72 5e                	jb     355 <memmove+0x83>
+    movsbback(dst + n - 1, src + n - 1, n);
+    return vdst;
+  }
+  if(n >= 16 && (((uint)dst ^ (uint)src) & 3) == 0){
+     2f7:	83 f8 0f             	cmp    $0xf,%eax
+     2fa:	7e 69                	jle    365 <memmove+0x93>
+     2fc:	89 d9                	mov    %ebx,%ecx
+     2fe:	31 d1                	xor    %edx,%ecx
+     300:	f6 c1 03             	test   $0x3,%cl
+     303:	75 73                	jne    378 <memmove+0xa6>
+    h = -(uint)dst & 3;
+     305:	89 d9                	mov    %ebx,%ecx
+     307:	f7 d9                	neg    %ecx
+     309:	83 e1 03             	and    $0x3,%ecx
+}
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsb" :
+     30c:	89 df                	mov    %ebx,%edi
+     30e:	89 d6                	mov    %edx,%esi
+     310:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+     313:	fc                   	cld
+     314:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    movsb(dst, src, h);
+    dst += h, src += h, n -= h;
+     316:	8b 75 f0             	mov    -0x10(%ebp),%esi
+     319:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+     31c:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+     31f:	29 f0                	sub    %esi,%eax
+    movsl(dst, src, n/4);
+     321:	8d 50 03             	lea    0x3(%eax),%edx
+     324:	0f 49 d0             	cmovns %eax,%edx
+     327:	c1 fa 02             	sar    $0x2,%edx
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+     32a:	89 7d f0             	mov    %edi,-0x10(%ebp)
+     32d:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     330:	89 ce                	mov    %ecx,%esi
+     332:	89 d1                	mov    %edx,%ecx
+     334:	fc                   	cld
+     335:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    dst += n/4*4, src += n/4*4, n %= 4;
+     337:	c1 e2 02             	shl    $0x2,%edx
+     33a:	8b 7d f0             	mov    -0x10(%ebp),%edi
+     33d:	01 d7                	add    %edx,%edi
+     33f:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     342:	01 ca                	add    %ecx,%edx
+     344:	89 c6                	mov    %eax,%esi
+     346:	c1 fe 1f             	sar    $0x1f,%esi
+     349:	c1 ee 1e             	shr    $0x1e,%esi
+     34c:	01 f0                	add    %esi,%eax
+     34e:	83 e0 03             	and    $0x3,%eax
+     351:	29 f0                	sub    %esi,%eax
+     353:	eb 12                	jmp    367 <memmove+0x95>
+    movsbback(dst + n - 1, src + n - 1, n);
+     355:	8d 78 ff             	lea    -0x1(%eax),%edi
+     358:	8d 34 3a             	lea    (%edx,%edi,1),%esi
+     35b:	01 df                	add    %ebx,%edi
+// Copy cnt bytes down from the last ones, at dst and src, to the
+// first: for overlapping moves up.
+static inline void
+movsbback(void *dst, const void *src, int cnt)
+{
+  asm volatile("std; rep movsb; cld" :
+     35d:	89 c1                	mov    %eax,%ecx
+     35f:	fd                   	std
+     360:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     362:	fc                   	cld
+    return vdst;
+     363:	eb 09                	jmp    36e <memmove+0x9c>
+  dst = vdst;
+     365:	89 df                	mov    %ebx,%edi
+  asm volatile("cld; rep movsb" :
+     367:	89 d6                	mov    %edx,%esi
+     369:	89 c1                	mov    %eax,%ecx
+     36b:	fc                   	cld
+     36c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  }
+  movsb(dst, src, n);
+  return vdst;
+}
+     36e:	89 d8                	mov    %ebx,%eax
+     370:	83 c4 08             	add    $0x8,%esp
+     373:	5b                   	pop    %ebx
+     374:	5e                   	pop    %esi
+     375:	5f                   	pop    %edi
+     376:	5d                   	pop    %ebp
+     377:	c3                   	ret
+  dst = vdst;
+     378:	89 df                	mov    %ebx,%edi
+     37a:	eb eb                	jmp    367 <memmove+0x95>
+
+0000037c <vclock_gettime>:
+
+// clock_gettime() without a system call: read the clock page
+// that the kernel maps at CLOCKPAGE (see clock.h).
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+     37c:	55                   	push   %ebp
+     37d:	89 e5                	mov    %esp,%ebp
+     37f:	57                   	push   %edi
+     380:	56                   	push   %esi
+     381:	53                   	push   %ebx
+     382:	83 ec 14             	sub    $0x14,%esp
+  struct clockpage *cp = (struct clockpage*)CLOCKPAGE;
+  uint seq, rem, d;
+  uint64 tsc, ns, now;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+     385:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     389:	0f 87 a3 00 00 00    	ja     432 <vclock_gettime+0xb6>
+    return -1;
+  do {
+    seq = cp->seq;
+     38f:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+    __sync_synchronize();
+     394:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    tsc = cp->tsc;
+     399:	8b 15 10 f0 ff 7f    	mov    0x7ffff010,%edx
+     39f:	8b 1d 14 f0 ff 7f    	mov    0x7ffff014,%ebx
+    ns = cp->ns;
+     3a5:	8b 35 18 f0 ff 7f    	mov    0x7ffff018,%esi
+     3ab:	8b 3d 1c f0 ff 7f    	mov    0x7ffff01c,%edi
+    __sync_synchronize();
+     3b1:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != cp->seq);
+     3b6:	89 c1                	mov    %eax,%ecx
+     3b8:	83 e1 01             	and    $0x1,%ecx
+     3bb:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     3be:	75 cf                	jne    38f <vclock_gettime+0x13>
+     3c0:	8b 0d 00 f0 ff 7f    	mov    0x7ffff000,%ecx
+     3c6:	39 c1                	cmp    %eax,%ecx
+     3c8:	75 c5                	jne    38f <vclock_gettime+0x13>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+     3ca:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     3cd:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     3d0:	0f 31                	rdtsc
+     3d2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     3d5:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     3d8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  now = rdtsc();
+  // Less than a tick has passed since the update, so the delta
+  // fits in 32 bits.
+  d = now > tsc ? now - tsc : 0;
+     3db:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     3de:	19 d3                	sbb    %edx,%ebx
+     3e0:	73 07                	jae    3e9 <vclock_gettime+0x6d>
+     3e2:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+     3e5:	29 d8                	sub    %ebx,%eax
+     3e7:	89 c1                	mov    %eax,%ecx
+  ns += ((uint64)d * cp->mult) >> cp->shift;
+     3e9:	89 c8                	mov    %ecx,%eax
+     3eb:	f7 25 04 f0 ff 7f    	mull   0x7ffff004
+     3f1:	0f b6 0d 08 f0 ff 7f 	movzbl 0x7ffff008,%ecx
+     3f8:	0f ad d0             	shrd   %cl,%edx,%eax
+     3fb:	d3 ea                	shr    %cl,%edx
+     3fd:	f6 c1 20             	test   $0x20,%cl
+     400:	74 04                	je     406 <vclock_gettime+0x8a>
+     402:	89 d0                	mov    %edx,%eax
+     404:	31 d2                	xor    %edx,%edx
+     406:	01 f0                	add    %esi,%eax
+     408:	11 fa                	adc    %edi,%edx
+static inline uint
+divl(uint64 n, uint d, uint *r)
+{
+  uint q;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (*r) :
+     40a:	bb 00 ca 9a 3b       	mov    $0x3b9aca00,%ebx
+     40f:	f7 f3                	div    %ebx
+  ts->tv_sec = divl(ns, 1000000000, &rem);
+     411:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     414:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = rem;
+     416:	89 57 04             	mov    %edx,0x4(%edi)
+  if(clk == CLOCK_REALTIME)
+     419:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     41d:	75 1a                	jne    439 <vclock_gettime+0xbd>
+    ts->tv_sec += cp->boottime;
+     41f:	03 05 0c f0 ff 7f    	add    0x7ffff00c,%eax
+     425:	89 07                	mov    %eax,(%edi)
+  return 0;
+     427:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     42a:	83 c4 14             	add    $0x14,%esp
+     42d:	5b                   	pop    %ebx
+     42e:	5e                   	pop    %esi
+     42f:	5f                   	pop    %edi
+     430:	5d                   	pop    %ebp
+     431:	c3                   	ret
+    return -1;
+     432:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     437:	eb f1                	jmp    42a <vclock_gettime+0xae>
+  return 0;
+     439:	b8 00 00 00 00       	mov    $0x0,%eax
+     43e:	eb ea                	jmp    42a <vclock_gettime+0xae>
+
+00000440 <flush>:
+
+// Write out fd's buffer, or with fd < 0 every buffer.
+// Returns -1 if a write fails.
+int
+flush(int fd)
+{
+     440:	55                   	push   %ebp
+     441:	89 e5                	mov    %esp,%ebp
+     443:	56                   	push   %esi
+     444:	53                   	push   %ebx
+     445:	8b 45 08             	mov    0x8(%ebp),%eax
+  int r, n;
+
+  if(fd < 0){
+     448:	85 c0                	test   %eax,%eax
+     44a:	78 5d                	js     4a9 <flush+0x69>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+      if(flush(fd) < 0)
+        r = -1;
+    return r;
+  }
+  if(fd >= NOBUF || (n = obuf[fd].n) == 0)
+     44c:	83 f8 0f             	cmp    $0xf,%eax
+     44f:	7f 64                	jg     4b5 <flush+0x75>
+     451:	69 d0 08 02 00 00    	imul   $0x208,%eax,%edx
+     457:	8b b2 64 19 00 00    	mov    0x1964(%edx),%esi
+     45d:	85 f6                	test   %esi,%esi
+     45f:	74 59                	je     4ba <flush+0x7a>
+    return 0;
+  obuf[fd].n = 0;
+     461:	c7 82 64 19 00 00 00 	movl   $0x0,0x1964(%edx)
+     468:	00 00 00 
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     46b:	81 c2 68 19 00 00    	add    $0x1968,%edx
+     471:	83 ec 04             	sub    $0x4,%esp
+     474:	56                   	push   %esi
+     475:	52                   	push   %edx
+     476:	50                   	push   %eax
+     477:	e8 5a 03 00 00       	call   7d6 <write>
+     47c:	83 c4 10             	add    $0x10,%esp
+     47f:	39 f0                	cmp    %esi,%eax
+     481:	75 40                	jne    4c3 <flush+0x83>
+     483:	be 00 00 00 00       	mov    $0x0,%esi
+     488:	eb 30                	jmp    4ba <flush+0x7a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     48a:	83 c3 01             	add    $0x1,%ebx
+     48d:	83 fb 0f             	cmp    $0xf,%ebx
+     490:	7f 28                	jg     4ba <flush+0x7a>
+      if(flush(fd) < 0)
+     492:	83 ec 0c             	sub    $0xc,%esp
+     495:	53                   	push   %ebx
+     496:	e8 a5 ff ff ff       	call   440 <flush>
+     49b:	83 c4 10             	add    $0x10,%esp
+     49e:	85 c0                	test   %eax,%eax
+     4a0:	79 e8                	jns    48a <flush+0x4a>
+        r = -1;
+     4a2:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     4a7:	eb e1                	jmp    48a <flush+0x4a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     4a9:	be 00 00 00 00       	mov    $0x0,%esi
+     4ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+     4b3:	eb d8                	jmp    48d <flush+0x4d>
+    return 0;
+     4b5:	be 00 00 00 00       	mov    $0x0,%esi
+}
+     4ba:	89 f0                	mov    %esi,%eax
+     4bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     4bf:	5b                   	pop    %ebx
+     4c0:	5e                   	pop    %esi
+     4c1:	5d                   	pop    %ebp
+     4c2:	c3                   	ret
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     4c3:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     4c8:	eb f0                	jmp    4ba <flush+0x7a>
+
+000004ca <bufreset>:
+
+static void
+bufreset(int fd)
+{
+  if(fd >= 0 && fd < NOBUF){
+     4ca:	83 f8 0f             	cmp    $0xf,%eax
+     4cd:	76 01                	jbe    4d0 <bufreset+0x6>
+     4cf:	c3                   	ret
+{
+     4d0:	55                   	push   %ebp
+     4d1:	89 e5                	mov    %esp,%ebp
+     4d3:	53                   	push   %ebx
+     4d4:	83 ec 10             	sub    $0x10,%esp
+     4d7:	89 c3                	mov    %eax,%ebx
+    flush(fd);
+     4d9:	50                   	push   %eax
+     4da:	e8 61 ff ff ff       	call   440 <flush>
+    obuf[fd].mode = BUNKNOWN;
+     4df:	69 db 08 02 00 00    	imul   $0x208,%ebx,%ebx
+     4e5:	c7 83 60 19 00 00 00 	movl   $0x0,0x1960(%ebx)
+     4ec:	00 00 00 
+     4ef:	83 c4 10             	add    $0x10,%esp
+  }
+}
+     4f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4f5:	c9                   	leave
+     4f6:	c3                   	ret
+
+000004f7 <bufwrite>:
+
+// Write n bytes from p to fd, through its buffer.
+// Returns n, or -1 if a write fails.
+int
+bufwrite(int fd, const void *p, int n)
+{
+     4f7:	55                   	push   %ebp
+     4f8:	89 e5                	mov    %esp,%ebp
+     4fa:	57                   	push   %edi
+     4fb:	56                   	push   %esi
+     4fc:	53                   	push   %ebx
+     4fd:	83 ec 3c             	sub    $0x3c,%esp
+     500:	8b 75 08             	mov    0x8(%ebp),%esi
+     503:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct stat st;
+  const char *s;
+  int i;
+
+  if(fd < 0 || fd >= NOBUF)
+     506:	83 fe 0f             	cmp    $0xf,%esi
+     509:	0f 87 a2 00 00 00    	ja     5b1 <bufwrite+0xba>
+    return write(fd, p, n);
+  if(obuf[fd].mode == BUNKNOWN){
+     50f:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     515:	83 b8 60 19 00 00 00 	cmpl   $0x0,0x1960(%eax)
+     51c:	75 19                	jne    537 <bufwrite+0x40>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     51e:	83 fe 02             	cmp    $0x2,%esi
+     521:	0f 85 9c 00 00 00    	jne    5c3 <bufwrite+0xcc>
+      obuf[fd].mode = BNONE;
+     527:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     52d:	c7 80 60 19 00 00 01 	movl   $0x1,0x1960(%eax)
+     534:	00 00 00 
+    else
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+  }
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     537:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     53d:	89 da                	mov    %ebx,%edx
+     53f:	03 90 64 19 00 00    	add    0x1964(%eax),%edx
+     545:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+     54b:	0f 8f ae 00 00 00    	jg     5ff <bufwrite+0x108>
+    return -1;
+  if(n >= OBUFSZ)
+     551:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+     557:	0f 8f bd 00 00 00    	jg     61a <bufwrite+0x123>
+    return write(fd, p, n);
+  memmove(obuf[fd].buf + obuf[fd].n, p, n);
+     55d:	69 d6 08 02 00 00    	imul   $0x208,%esi,%edx
+     563:	8d ba 60 19 00 00    	lea    0x1960(%edx),%edi
+     569:	8b 82 64 19 00 00    	mov    0x1964(%edx),%eax
+     56f:	83 ec 04             	sub    $0x4,%esp
+     572:	53                   	push   %ebx
+     573:	ff 75 0c             	push   0xc(%ebp)
+     576:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     579:	8d 84 10 68 19 00 00 	lea    0x1968(%eax,%edx,1),%eax
+     580:	50                   	push   %eax
+     581:	e8 4c fd ff ff       	call   2d2 <memmove>
+  obuf[fd].n += n;
+     586:	01 5f 04             	add    %ebx,0x4(%edi)
+  if(obuf[fd].mode == BNONE)
+     589:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     58c:	8b 82 60 19 00 00    	mov    0x1960(%edx),%eax
+     592:	83 c4 10             	add    $0x10,%esp
+     595:	83 f8 01             	cmp    $0x1,%eax
+     598:	0f 84 91 00 00 00    	je     62f <bufwrite+0x138>
+    return flush(fd) < 0 ? -1 : n;
+  if(obuf[fd].mode == BLINE)
+     59e:	83 f8 02             	cmp    $0x2,%eax
+     5a1:	0f 84 ca 00 00 00    	je     671 <bufwrite+0x17a>
+    for(s = p, i = 0; i < n; i++)
+      if(s[i] == '\n')
+        return flush(fd) < 0 ? -1 : n;
+  return n;
+     5a7:	89 d8                	mov    %ebx,%eax
+}
+     5a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     5ac:	5b                   	pop    %ebx
+     5ad:	5e                   	pop    %esi
+     5ae:	5f                   	pop    %edi
+     5af:	5d                   	pop    %ebp
+     5b0:	c3                   	ret
+    return write(fd, p, n);
+     5b1:	83 ec 04             	sub    $0x4,%esp
+     5b4:	53                   	push   %ebx
+     5b5:	ff 75 0c             	push   0xc(%ebp)
+     5b8:	56                   	push   %esi
+     5b9:	e8 18 02 00 00       	call   7d6 <write>
+     5be:	83 c4 10             	add    $0x10,%esp
+     5c1:	eb e6                	jmp    5a9 <bufwrite+0xb2>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     5c3:	83 ec 08             	sub    $0x8,%esp
+     5c6:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     5c9:	50                   	push   %eax
+     5ca:	56                   	push   %esi
+     5cb:	e8 51 02 00 00       	call   821 <fstat>
+     5d0:	83 c4 10             	add    $0x10,%esp
+     5d3:	85 c0                	test   %eax,%eax
+     5d5:	0f 88 4c ff ff ff    	js     527 <bufwrite+0x30>
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+     5db:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     5e0:	74 16                	je     5f8 <bufwrite+0x101>
+     5e2:	ba 03 00 00 00       	mov    $0x3,%edx
+     5e7:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     5ed:	89 90 60 19 00 00    	mov    %edx,0x1960(%eax)
+     5f3:	e9 3f ff ff ff       	jmp    537 <bufwrite+0x40>
+     5f8:	ba 02 00 00 00       	mov    $0x2,%edx
+     5fd:	eb e8                	jmp    5e7 <bufwrite+0xf0>
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     5ff:	83 ec 0c             	sub    $0xc,%esp
+     602:	56                   	push   %esi
+     603:	e8 38 fe ff ff       	call   440 <flush>
+     608:	83 c4 10             	add    $0x10,%esp
+     60b:	85 c0                	test   %eax,%eax
+     60d:	0f 89 3e ff ff ff    	jns    551 <bufwrite+0x5a>
+    return -1;
+     613:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     618:	eb 8f                	jmp    5a9 <bufwrite+0xb2>
+    return write(fd, p, n);
+     61a:	83 ec 04             	sub    $0x4,%esp
+     61d:	53                   	push   %ebx
+     61e:	ff 75 0c             	push   0xc(%ebp)
+     621:	56                   	push   %esi
+     622:	e8 af 01 00 00       	call   7d6 <write>
+     627:	83 c4 10             	add    $0x10,%esp
+     62a:	e9 7a ff ff ff       	jmp    5a9 <bufwrite+0xb2>
+    return flush(fd) < 0 ? -1 : n;
+     62f:	83 ec 0c             	sub    $0xc,%esp
+     632:	56                   	push   %esi
+     633:	e8 08 fe ff ff       	call   440 <flush>
+     638:	83 c4 10             	add    $0x10,%esp
+     63b:	85 c0                	test   %eax,%eax
+     63d:	78 07                	js     646 <bufwrite+0x14f>
+     63f:	89 d8                	mov    %ebx,%eax
+     641:	e9 63 ff ff ff       	jmp    5a9 <bufwrite+0xb2>
+     646:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     64b:	e9 59 ff ff ff       	jmp    5a9 <bufwrite+0xb2>
+        return flush(fd) < 0 ? -1 : n;
+     650:	83 ec 0c             	sub    $0xc,%esp
+     653:	56                   	push   %esi
+     654:	e8 e7 fd ff ff       	call   440 <flush>
+     659:	83 c4 10             	add    $0x10,%esp
+     65c:	85 c0                	test   %eax,%eax
+     65e:	78 07                	js     667 <bufwrite+0x170>
+     660:	89 d8                	mov    %ebx,%eax
+     662:	e9 42 ff ff ff       	jmp    5a9 <bufwrite+0xb2>
+     667:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     66c:	e9 38 ff ff ff       	jmp    5a9 <bufwrite+0xb2>
+    for(s = p, i = 0; i < n; i++)
+     671:	b8 00 00 00 00       	mov    $0x0,%eax
+     676:	39 d8                	cmp    %ebx,%eax
+     678:	7d 0e                	jge    688 <bufwrite+0x191>
+      if(s[i] == '\n')
+     67a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     67d:	80 3c 01 0a          	cmpb   $0xa,(%ecx,%eax,1)
+     681:	74 cd                	je     650 <bufwrite+0x159>
+    for(s = p, i = 0; i < n; i++)
+     683:	83 c0 01             	add    $0x1,%eax
+     686:	eb ee                	jmp    676 <bufwrite+0x17f>
+  return n;
+     688:	89 d8                	mov    %ebx,%eax
+     68a:	e9 1a ff ff ff       	jmp    5a9 <bufwrite+0xb2>
+
+0000068f <fork>:
+
+int
+fork(void)
+{
+     68f:	55                   	push   %ebp
+     690:	89 e5                	mov    %esp,%ebp
+     692:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     695:	6a ff                	push   $0xffffffff
+     697:	e8 a4 fd ff ff       	call   440 <flush>
+  return _fork();
+     69c:	e8 bd 00 00 00       	call   75e <_fork>
+}
+     6a1:	c9                   	leave
+     6a2:	c3                   	ret
+
+000006a3 <exit>:
+
+int
+exit(void)
+{
+     6a3:	55                   	push   %ebp
+     6a4:	89 e5                	mov    %esp,%ebp
+     6a6:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     6a9:	6a ff                	push   $0xffffffff
+     6ab:	e8 90 fd ff ff       	call   440 <flush>
+  _exit();
+     6b0:	e8 b8 00 00 00       	call   76d <_exit>
+
+000006b5 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     6b5:	55                   	push   %ebp
+     6b6:	89 e5                	mov    %esp,%ebp
+     6b8:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     6bb:	6a ff                	push   $0xffffffff
+     6bd:	e8 7e fd ff ff       	call   440 <flush>
+  return _exec(path, argv);
+     6c2:	83 c4 08             	add    $0x8,%esp
+     6c5:	ff 75 0c             	push   0xc(%ebp)
+     6c8:	ff 75 08             	push   0x8(%ebp)
+     6cb:	e8 bb 00 00 00       	call   78b <_exec>
+}
+     6d0:	c9                   	leave
+     6d1:	c3                   	ret
+
+000006d2 <close>:
+
+int
+close(int fd)
+{
+     6d2:	55                   	push   %ebp
+     6d3:	89 e5                	mov    %esp,%ebp
+     6d5:	53                   	push   %ebx
+     6d6:	83 ec 04             	sub    $0x4,%esp
+     6d9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bufreset(fd);
+     6dc:	89 d8                	mov    %ebx,%eax
+     6de:	e8 e7 fd ff ff       	call   4ca <bufreset>
+  return _close(fd);
+     6e3:	83 ec 0c             	sub    $0xc,%esp
+     6e6:	53                   	push   %ebx
+     6e7:	e8 90 00 00 00       	call   77c <_close>
+}
+     6ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6ef:	c9                   	leave
+     6f0:	c3                   	ret
+
+000006f1 <stat>:
+{
+     6f1:	55                   	push   %ebp
+     6f2:	89 e5                	mov    %esp,%ebp
+     6f4:	56                   	push   %esi
+     6f5:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     6f6:	83 ec 08             	sub    $0x8,%esp
+     6f9:	6a 00                	push   $0x0
+     6fb:	ff 75 08             	push   0x8(%ebp)
+     6fe:	e8 f1 00 00 00       	call   7f4 <open>
+  if(fd < 0)
+     703:	83 c4 10             	add    $0x10,%esp
+     706:	85 c0                	test   %eax,%eax
+     708:	78 24                	js     72e <stat+0x3d>
+     70a:	89 c3                	mov    %eax,%ebx
+  r = fstat(fd, st);
+     70c:	83 ec 08             	sub    $0x8,%esp
+     70f:	ff 75 0c             	push   0xc(%ebp)
+     712:	50                   	push   %eax
+     713:	e8 09 01 00 00       	call   821 <fstat>
+     718:	89 c6                	mov    %eax,%esi
+  close(fd);
+     71a:	89 1c 24             	mov    %ebx,(%esp)
+     71d:	e8 b0 ff ff ff       	call   6d2 <close>
+  return r;
+     722:	83 c4 10             	add    $0x10,%esp
+}
+     725:	89 f0                	mov    %esi,%eax
+     727:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     72a:	5b                   	pop    %ebx
+     72b:	5e                   	pop    %esi
+     72c:	5d                   	pop    %ebp
+     72d:	c3                   	ret
+    return -1;
+     72e:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     733:	eb f0                	jmp    725 <stat+0x34>
+
+00000735 <dup2>:
+
+int
+dup2(int oldfd, int newfd)
+{
+     735:	55                   	push   %ebp
+     736:	89 e5                	mov    %esp,%ebp
+     738:	56                   	push   %esi
+     739:	53                   	push   %ebx
+     73a:	8b 75 08             	mov    0x8(%ebp),%esi
+     73d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(oldfd != newfd)
+     740:	39 de                	cmp    %ebx,%esi
+     742:	75 11                	jne    755 <dup2+0x20>
+    bufreset(newfd);
+  return _dup2(oldfd, newfd);
+     744:	83 ec 08             	sub    $0x8,%esp
+     747:	53                   	push   %ebx
+     748:	56                   	push   %esi
+     749:	e8 4c 00 00 00       	call   79a <_dup2>
+}
+     74e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     751:	5b                   	pop    %ebx
+     752:	5e                   	pop    %esi
+     753:	5d                   	pop    %ebp
+     754:	c3                   	ret
+    bufreset(newfd);
+     755:	89 d8                	mov    %ebx,%eax
+     757:	e8 6e fd ff ff       	call   4ca <bufreset>
+     75c:	eb e6                	jmp    744 <dup2+0xf>
+
+0000075e <_fork>:
+  1: ret
+
+#define SYSCALL(name) STUB(name, SYS_ ## name)
+
+# ulib.c wraps these, to flush printf()'s buffers first.
+STUB(_fork, SYS_fork)
+     75e:	b8 01 00 00 00       	mov    $0x1,%eax
+     763:	89 e1                	mov    %esp,%ecx
+     765:	ba 6c 07 00 00       	mov    $0x76c,%edx
+     76a:	0f 34                	sysenter
+     76c:	c3                   	ret
+
+0000076d <_exit>:
+STUB(_exit, SYS_exit)
+     76d:	b8 02 00 00 00       	mov    $0x2,%eax
+     772:	89 e1                	mov    %esp,%ecx
+     774:	ba 7b 07 00 00       	mov    $0x77b,%edx
+     779:	0f 34                	sysenter
+     77b:	c3                   	ret
+
+0000077c <_close>:
+STUB(_close, SYS_close)
+     77c:	b8 15 00 00 00       	mov    $0x15,%eax
+     781:	89 e1                	mov    %esp,%ecx
+     783:	ba 8a 07 00 00       	mov    $0x78a,%edx
+     788:	0f 34                	sysenter
+     78a:	c3                   	ret
+
+0000078b <_exec>:
+STUB(_exec, SYS_exec)
+     78b:	b8 07 00 00 00       	mov    $0x7,%eax
+     790:	89 e1                	mov    %esp,%ecx
+     792:	ba 99 07 00 00       	mov    $0x799,%edx
+     797:	0f 34                	sysenter
+     799:	c3                   	ret
+
+0000079a <_dup2>:
+STUB(_dup2, SYS_dup2)
+     79a:	b8 17 00 00 00       	mov    $0x17,%eax
+     79f:	89 e1                	mov    %esp,%ecx
+     7a1:	ba a8 07 00 00       	mov    $0x7a8,%edx
+     7a6:	0f 34                	sysenter
+     7a8:	c3                   	ret
+
+000007a9 <wait>:
+
+SYSCALL(wait)
+     7a9:	b8 03 00 00 00       	mov    $0x3,%eax
+     7ae:	89 e1                	mov    %esp,%ecx
+     7b0:	ba b7 07 00 00       	mov    $0x7b7,%edx
+     7b5:	0f 34                	sysenter
+     7b7:	c3                   	ret
+
+000007b8 <pipe>:
+SYSCALL(pipe)
+     7b8:	b8 04 00 00 00       	mov    $0x4,%eax
+     7bd:	89 e1                	mov    %esp,%ecx
+     7bf:	ba c6 07 00 00       	mov    $0x7c6,%edx
+     7c4:	0f 34                	sysenter
+     7c6:	c3                   	ret
+
+000007c7 <read>:
+SYSCALL(read)
+     7c7:	b8 05 00 00 00       	mov    $0x5,%eax
+     7cc:	89 e1                	mov    %esp,%ecx
+     7ce:	ba d5 07 00 00       	mov    $0x7d5,%edx
+     7d3:	0f 34                	sysenter
+     7d5:	c3                   	ret
+
+000007d6 <write>:
+SYSCALL(write)
+     7d6:	b8 10 00 00 00       	mov    $0x10,%eax
+     7db:	89 e1                	mov    %esp,%ecx
+     7dd:	ba e4 07 00 00       	mov    $0x7e4,%edx
+     7e2:	0f 34                	sysenter
+     7e4:	c3                   	ret
+
+000007e5 <kill>:
+SYSCALL(kill)
+     7e5:	b8 06 00 00 00       	mov    $0x6,%eax
+     7ea:	89 e1                	mov    %esp,%ecx
+     7ec:	ba f3 07 00 00       	mov    $0x7f3,%edx
+     7f1:	0f 34                	sysenter
+     7f3:	c3                   	ret
+
+000007f4 <open>:
+SYSCALL(open)
+     7f4:	b8 0f 00 00 00       	mov    $0xf,%eax
+     7f9:	89 e1                	mov    %esp,%ecx
+     7fb:	ba 02 08 00 00       	mov    $0x802,%edx
+     800:	0f 34                	sysenter
+     802:	c3                   	ret
+
+00000803 <mknod>:
+SYSCALL(mknod)
+     803:	b8 11 00 00 00       	mov    $0x11,%eax
+     808:	89 e1                	mov    %esp,%ecx
+     80a:	ba 11 08 00 00       	mov    $0x811,%edx
+     80f:	0f 34                	sysenter
+     811:	c3                   	ret
+
+00000812 <unlink>:
+SYSCALL(unlink)
+     812:	b8 12 00 00 00       	mov    $0x12,%eax
+     817:	89 e1                	mov    %esp,%ecx
+     819:	ba 20 08 00 00       	mov    $0x820,%edx
+     81e:	0f 34                	sysenter
+     820:	c3                   	ret
+
+00000821 <fstat>:
+SYSCALL(fstat)
+     821:	b8 08 00 00 00       	mov    $0x8,%eax
+     826:	89 e1                	mov    %esp,%ecx
+     828:	ba 2f 08 00 00       	mov    $0x82f,%edx
+     82d:	0f 34                	sysenter
+     82f:	c3                   	ret
+
+00000830 <link>:
+SYSCALL(link)
+     830:	b8 13 00 00 00       	mov    $0x13,%eax
+     835:	89 e1                	mov    %esp,%ecx
+     837:	ba 3e 08 00 00       	mov    $0x83e,%edx
+     83c:	0f 34                	sysenter
+     83e:	c3                   	ret
+
+0000083f <mkdir>:
+SYSCALL(mkdir)
+     83f:	b8 14 00 00 00       	mov    $0x14,%eax
+     844:	89 e1                	mov    %esp,%ecx
+     846:	ba 4d 08 00 00       	mov    $0x84d,%edx
+     84b:	0f 34                	sysenter
+     84d:	c3                   	ret
+
+0000084e <chdir>:
+SYSCALL(chdir)
+     84e:	b8 09 00 00 00       	mov    $0x9,%eax
+     853:	89 e1                	mov    %esp,%ecx
+     855:	ba 5c 08 00 00       	mov    $0x85c,%edx
+     85a:	0f 34                	sysenter
+     85c:	c3                   	ret
+
+0000085d <dup>:
+SYSCALL(dup)
+     85d:	b8 0a 00 00 00       	mov    $0xa,%eax
+     862:	89 e1                	mov    %esp,%ecx
+     864:	ba 6b 08 00 00       	mov    $0x86b,%edx
+     869:	0f 34                	sysenter
+     86b:	c3                   	ret
+
+0000086c <getpid>:
+SYSCALL(getpid)
+     86c:	b8 0b 00 00 00       	mov    $0xb,%eax
+     871:	89 e1                	mov    %esp,%ecx
+     873:	ba 7a 08 00 00       	mov    $0x87a,%edx
+     878:	0f 34                	sysenter
+     87a:	c3                   	ret
+
+0000087b <sbrk>:
+SYSCALL(sbrk)
+     87b:	b8 0c 00 00 00       	mov    $0xc,%eax
+     880:	89 e1                	mov    %esp,%ecx
+     882:	ba 89 08 00 00       	mov    $0x889,%edx
+     887:	0f 34                	sysenter
+     889:	c3                   	ret
+
+0000088a <sleep>:
+SYSCALL(sleep)
+     88a:	b8 0d 00 00 00       	mov    $0xd,%eax
+     88f:	89 e1                	mov    %esp,%ecx
+     891:	ba 98 08 00 00       	mov    $0x898,%edx
+     896:	0f 34                	sysenter
+     898:	c3                   	ret
+
+00000899 <uptime>:
+SYSCALL(uptime)
+     899:	b8 0e 00 00 00       	mov    $0xe,%eax
+     89e:	89 e1                	mov    %esp,%ecx
+     8a0:	ba a7 08 00 00       	mov    $0x8a7,%edx
+     8a5:	0f 34                	sysenter
+     8a7:	c3                   	ret
+
+000008a8 <date>:
+SYSCALL(date)
+     8a8:	b8 16 00 00 00       	mov    $0x16,%eax
+     8ad:	89 e1                	mov    %esp,%ecx
+     8af:	ba b6 08 00 00       	mov    $0x8b6,%edx
+     8b4:	0f 34                	sysenter
+     8b6:	c3                   	ret
+
+000008b7 <faultaround>:
+SYSCALL(faultaround)
+     8b7:	b8 18 00 00 00       	mov    $0x18,%eax
+     8bc:	89 e1                	mov    %esp,%ecx
+     8be:	ba c5 08 00 00       	mov    $0x8c5,%edx
+     8c3:	0f 34                	sysenter
+     8c5:	c3                   	ret
+
+000008c6 <faultstat>:
+SYSCALL(faultstat)
+     8c6:	b8 19 00 00 00       	mov    $0x19,%eax
+     8cb:	89 e1                	mov    %esp,%ecx
+     8cd:	ba d4 08 00 00       	mov    $0x8d4,%edx
+     8d2:	0f 34                	sysenter
+     8d4:	c3                   	ret
+
+000008d5 <mmap>:
+SYSCALL(mmap)
+     8d5:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     8da:	89 e1                	mov    %esp,%ecx
+     8dc:	ba e3 08 00 00       	mov    $0x8e3,%edx
+     8e1:	0f 34                	sysenter
+     8e3:	c3                   	ret
+
+000008e4 <munmap>:
+SYSCALL(munmap)
+     8e4:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     8e9:	89 e1                	mov    %esp,%ecx
+     8eb:	ba f2 08 00 00       	mov    $0x8f2,%edx
+     8f0:	0f 34                	sysenter
+     8f2:	c3                   	ret
+
+000008f3 <largepages>:
+SYSCALL(largepages)
+     8f3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     8f8:	89 e1                	mov    %esp,%ecx
+     8fa:	ba 01 09 00 00       	mov    $0x901,%edx
+     8ff:	0f 34                	sysenter
+     901:	c3                   	ret
+
+00000902 <spawn>:
+SYSCALL(spawn)
+     902:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     907:	89 e1                	mov    %esp,%ecx
+     909:	ba 10 09 00 00       	mov    $0x910,%edx
+     90e:	0f 34                	sysenter
+     910:	c3                   	ret
+
+00000911 <setpriority>:
+SYSCALL(setpriority)
+     911:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     916:	89 e1                	mov    %esp,%ecx
+     918:	ba 1f 09 00 00       	mov    $0x91f,%edx
+     91d:	0f 34                	sysenter
+     91f:	c3                   	ret
+
+00000920 <getpriority>:
+SYSCALL(getpriority)
+     920:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     925:	89 e1                	mov    %esp,%ecx
+     927:	ba 2e 09 00 00       	mov    $0x92e,%edx
+     92c:	0f 34                	sysenter
+     92e:	c3                   	ret
+
+0000092f <getprocinfo>:
+SYSCALL(getprocinfo)
+     92f:	b8 20 00 00 00       	mov    $0x20,%eax
+     934:	89 e1                	mov    %esp,%ecx
+     936:	ba 3d 09 00 00       	mov    $0x93d,%edx
+     93b:	0f 34                	sysenter
+     93d:	c3                   	ret
+
+0000093e <getcpuinfo>:
+SYSCALL(getcpuinfo)
+     93e:	b8 21 00 00 00       	mov    $0x21,%eax
+     943:	89 e1                	mov    %esp,%ecx
+     945:	ba 4c 09 00 00       	mov    $0x94c,%edx
+     94a:	0f 34                	sysenter
+     94c:	c3                   	ret
+
+0000094d <clone>:
+SYSCALL(clone)
+     94d:	b8 22 00 00 00       	mov    $0x22,%eax
+     952:	89 e1                	mov    %esp,%ecx
+     954:	ba 5b 09 00 00       	mov    $0x95b,%edx
+     959:	0f 34                	sysenter
+     95b:	c3                   	ret
+
+0000095c <join>:
+SYSCALL(join)
+     95c:	b8 23 00 00 00       	mov    $0x23,%eax
+     961:	89 e1                	mov    %esp,%ecx
+     963:	ba 6a 09 00 00       	mov    $0x96a,%edx
+     968:	0f 34                	sysenter
+     96a:	c3                   	ret
+
+0000096b <futex_wait>:
+SYSCALL(futex_wait)
+     96b:	b8 24 00 00 00       	mov    $0x24,%eax
+     970:	89 e1                	mov    %esp,%ecx
+     972:	ba 79 09 00 00       	mov    $0x979,%edx
+     977:	0f 34                	sysenter
+     979:	c3                   	ret
+
+0000097a <futex_wake>:
+SYSCALL(futex_wake)
+     97a:	b8 25 00 00 00       	mov    $0x25,%eax
+     97f:	89 e1                	mov    %esp,%ecx
+     981:	ba 88 09 00 00       	mov    $0x988,%edx
+     986:	0f 34                	sysenter
+     988:	c3                   	ret
+
+00000989 <setaffinity>:
+SYSCALL(setaffinity)
+     989:	b8 26 00 00 00       	mov    $0x26,%eax
+     98e:	89 e1                	mov    %esp,%ecx
+     990:	ba 97 09 00 00       	mov    $0x997,%edx
+     995:	0f 34                	sysenter
+     997:	c3                   	ret
+
+00000998 <getaffinity>:
+SYSCALL(getaffinity)
+     998:	b8 27 00 00 00       	mov    $0x27,%eax
+     99d:	89 e1                	mov    %esp,%ecx
+     99f:	ba a6 09 00 00       	mov    $0x9a6,%edx
+     9a4:	0f 34                	sysenter
+     9a6:	c3                   	ret
+
+000009a7 <clock_gettime>:
+SYSCALL(clock_gettime)
+     9a7:	b8 28 00 00 00       	mov    $0x28,%eax
+     9ac:	89 e1                	mov    %esp,%ecx
+     9ae:	ba b5 09 00 00       	mov    $0x9b5,%edx
+     9b3:	0f 34                	sysenter
+     9b5:	c3                   	ret
+
+000009b6 <msleep>:
+SYSCALL(msleep)
+     9b6:	b8 29 00 00 00       	mov    $0x29,%eax
+     9bb:	89 e1                	mov    %esp,%ecx
+     9bd:	ba c4 09 00 00       	mov    $0x9c4,%edx
+     9c2:	0f 34                	sysenter
+     9c4:	c3                   	ret
+
+000009c5 <lockstat>:
+SYSCALL(lockstat)
+     9c5:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     9ca:	89 e1                	mov    %esp,%ecx
+     9cc:	ba d3 09 00 00       	mov    $0x9d3,%edx
+     9d1:	0f 34                	sysenter
+     9d3:	c3                   	ret
+
+000009d4 <bstat>:
+SYSCALL(bstat)
+     9d4:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     9d9:	89 e1                	mov    %esp,%ecx
+     9db:	ba e2 09 00 00       	mov    $0x9e2,%edx
+     9e0:	0f 34                	sysenter
+     9e2:	c3                   	ret
+
+000009e3 <iostat>:
+SYSCALL(iostat)
+     9e3:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     9e8:	89 e1                	mov    %esp,%ecx
+     9ea:	ba f1 09 00 00       	mov    $0x9f1,%edx
+     9ef:	0f 34                	sysenter
+     9f1:	c3                   	ret
+
+000009f2 <fsync>:
+SYSCALL(fsync)
+     9f2:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     9f7:	89 e1                	mov    %esp,%ecx
+     9f9:	ba 00 0a 00 00       	mov    $0xa00,%edx
+     9fe:	0f 34                	sysenter
+     a00:	c3                   	ret
+
+00000a01 <pread>:
+SYSCALL(pread)
+     a01:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     a06:	89 e1                	mov    %esp,%ecx
+     a08:	ba 0f 0a 00 00       	mov    $0xa0f,%edx
+     a0d:	0f 34                	sysenter
+     a0f:	c3                   	ret
+
+00000a10 <pwrite>:
+SYSCALL(pwrite)
+     a10:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     a15:	89 e1                	mov    %esp,%ecx
+     a17:	ba 1e 0a 00 00       	mov    $0xa1e,%edx
+     a1c:	0f 34                	sysenter
+     a1e:	c3                   	ret
+
+00000a1f <readv>:
+SYSCALL(readv)
+     a1f:	b8 30 00 00 00       	mov    $0x30,%eax
+     a24:	89 e1                	mov    %esp,%ecx
+     a26:	ba 2d 0a 00 00       	mov    $0xa2d,%edx
+     a2b:	0f 34                	sysenter
+     a2d:	c3                   	ret
+
+00000a2e <writev>:
+SYSCALL(writev)
+     a2e:	b8 31 00 00 00       	mov    $0x31,%eax
+     a33:	89 e1                	mov    %esp,%ecx
+     a35:	ba 3c 0a 00 00       	mov    $0xa3c,%edx
+     a3a:	0f 34                	sysenter
+     a3c:	c3                   	ret
+
+00000a3d <sendfile>:
+SYSCALL(sendfile)
+     a3d:	b8 32 00 00 00       	mov    $0x32,%eax
+     a42:	89 e1                	mov    %esp,%ecx
+     a44:	ba 4b 0a 00 00       	mov    $0xa4b,%edx
+     a49:	0f 34                	sysenter
+     a4b:	c3                   	ret
+
+00000a4c <fcntl>:
+SYSCALL(fcntl)
+     a4c:	b8 33 00 00 00       	mov    $0x33,%eax
+     a51:	89 e1                	mov    %esp,%ecx
+     a53:	ba 5a 0a 00 00       	mov    $0xa5a,%edx
+     a58:	0f 34                	sysenter
+     a5a:	c3                   	ret
+
+00000a5b <mount>:
+SYSCALL(mount)
+     a5b:	b8 34 00 00 00       	mov    $0x34,%eax
+     a60:	89 e1                	mov    %esp,%ecx
+     a62:	ba 69 0a 00 00       	mov    $0xa69,%edx
+     a67:	0f 34                	sysenter
+     a69:	c3                   	ret
+
+00000a6a <getdents>:
+SYSCALL(getdents)
+     a6a:	b8 35 00 00 00       	mov    $0x35,%eax
+     a6f:	89 e1                	mov    %esp,%ecx
+     a71:	ba 78 0a 00 00       	mov    $0xa78,%edx
+     a76:	0f 34                	sysenter
+     a78:	c3                   	ret
+
+00000a79 <fstatat>:
+SYSCALL(fstatat)
+     a79:	b8 36 00 00 00       	mov    $0x36,%eax
+     a7e:	89 e1                	mov    %esp,%ecx
+     a80:	ba 87 0a 00 00       	mov    $0xa87,%edx
+     a85:	0f 34                	sysenter
+     a87:	c3                   	ret
+
+00000a88 <sysstat>:
+SYSCALL(sysstat)
+     a88:	b8 37 00 00 00       	mov    $0x37,%eax
+     a8d:	89 e1                	mov    %esp,%ecx
+     a8f:	ba 96 0a 00 00       	mov    $0xa96,%edx
+     a94:	0f 34                	sysenter
+     a96:	c3                   	ret
+
+00000a97 <ringenter>:
+SYSCALL(ringenter)
+     a97:	b8 38 00 00 00       	mov    $0x38,%eax
+     a9c:	89 e1                	mov    %esp,%ecx
+     a9e:	ba a5 0a 00 00       	mov    $0xaa5,%edx
+     aa3:	0f 34                	sysenter
+     aa5:	c3                   	ret
+
+00000aa6 <trace>:
+SYSCALL(trace)
+     aa6:	b8 39 00 00 00       	mov    $0x39,%eax
+     aab:	89 e1                	mov    %esp,%ecx
+     aad:	ba b4 0a 00 00       	mov    $0xab4,%edx
+     ab2:	0f 34                	sysenter
+     ab4:	c3                   	ret
+
+00000ab5 <memstat>:
+SYSCALL(memstat)
+     ab5:	b8 3a 00 00 00       	mov    $0x3a,%eax
+     aba:	89 e1                	mov    %esp,%ecx
+     abc:	ba c3 0a 00 00       	mov    $0xac3,%edx
+     ac1:	0f 34                	sysenter
+     ac3:	c3                   	ret
+
+00000ac4 <shmget>:
+SYSCALL(shmget)
+     ac4:	b8 3b 00 00 00       	mov    $0x3b,%eax
+     ac9:	89 e1                	mov    %esp,%ecx
+     acb:	ba d2 0a 00 00       	mov    $0xad2,%edx
+     ad0:	0f 34                	sysenter
+     ad2:	c3                   	ret
+
+00000ad3 <shmat>:
+SYSCALL(shmat)
+     ad3:	b8 3c 00 00 00       	mov    $0x3c,%eax
+     ad8:	89 e1                	mov    %esp,%ecx
+     ada:	ba e1 0a 00 00       	mov    $0xae1,%edx
+     adf:	0f 34                	sysenter
+     ae1:	c3                   	ret
+
+00000ae2 <shmdt>:
+SYSCALL(shmdt)
+     ae2:	b8 3d 00 00 00       	mov    $0x3d,%eax
+     ae7:	89 e1                	mov    %esp,%ecx
+     ae9:	ba f0 0a 00 00       	mov    $0xaf0,%edx
+     aee:	0f 34                	sysenter
+     af0:	c3                   	ret
+
+00000af1 <irqstat>:
+SYSCALL(irqstat)
+     af1:	b8 3e 00 00 00       	mov    $0x3e,%eax
+     af6:	89 e1                	mov    %esp,%ecx
+     af8:	ba ff 0a 00 00       	mov    $0xaff,%edx
+     afd:	0f 34                	sysenter
+     aff:	c3                   	ret
+
+00000b00 <irqroute>:
+SYSCALL(irqroute)
+     b00:	b8 3f 00 00 00       	mov    $0x3f,%eax
+     b05:	89 e1                	mov    %esp,%ecx
+     b07:	ba 0e 0b 00 00       	mov    $0xb0e,%edx
+     b0c:	0f 34                	sysenter
+     b0e:	c3                   	ret
+
+00000b0f <putc>:
+  char buf[64];
+};
+
+static void
+putc(struct out *o, char c)
+{
+     b0f:	55                   	push   %ebp
+     b10:	89 e5                	mov    %esp,%ebp
+     b12:	56                   	push   %esi
+     b13:	53                   	push   %ebx
+     b14:	89 c3                	mov    %eax,%ebx
+     b16:	89 d6                	mov    %edx,%esi
+  if(o->n == sizeof(o->buf)){
+     b18:	8b 40 04             	mov    0x4(%eax),%eax
+     b1b:	83 f8 40             	cmp    $0x40,%eax
+     b1e:	74 16                	je     b36 <putc+0x27>
+    bufwrite(o->fd, o->buf, o->n);
+    o->n = 0;
+  }
+  o->buf[o->n++] = c;
+     b20:	8b 43 04             	mov    0x4(%ebx),%eax
+     b23:	8d 50 01             	lea    0x1(%eax),%edx
+     b26:	89 53 04             	mov    %edx,0x4(%ebx)
+     b29:	89 f1                	mov    %esi,%ecx
+     b2b:	88 4c 03 08          	mov    %cl,0x8(%ebx,%eax,1)
+}
+     b2f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     b32:	5b                   	pop    %ebx
+     b33:	5e                   	pop    %esi
+     b34:	5d                   	pop    %ebp
+     b35:	c3                   	ret
+    bufwrite(o->fd, o->buf, o->n);
+     b36:	8d 53 08             	lea    0x8(%ebx),%edx
+     b39:	83 ec 04             	sub    $0x4,%esp
+     b3c:	50                   	push   %eax
+     b3d:	52                   	push   %edx
+     b3e:	ff 33                	push   (%ebx)
+     b40:	e8 b2 f9 ff ff       	call   4f7 <bufwrite>
+    o->n = 0;
+     b45:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     b4c:	83 c4 10             	add    $0x10,%esp
+     b4f:	eb cf                	jmp    b20 <putc+0x11>
+
+00000b51 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     b51:	55                   	push   %ebp
+     b52:	89 e5                	mov    %esp,%ebp
+     b54:	57                   	push   %edi
+     b55:	56                   	push   %esi
+     b56:	53                   	push   %ebx
+     b57:	83 ec 2c             	sub    $0x2c,%esp
+     b5a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     b5d:	89 d0                	mov    %edx,%eax
+     b5f:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+     b61:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     b65:	0f 95 c1             	setne  %cl
+     b68:	c1 ea 1f             	shr    $0x1f,%edx
+     b6b:	84 d1                	test   %dl,%cl
+     b6d:	74 44                	je     bb3 <printint+0x62>
+    neg = 1;
+    x = -xx;
+     b6f:	f7 d8                	neg    %eax
+     b71:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+     b73:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     b7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+     b7f:	89 c8                	mov    %ecx,%eax
+     b81:	ba 00 00 00 00       	mov    $0x0,%edx
+     b86:	f7 f6                	div    %esi
+     b88:	89 df                	mov    %ebx,%edi
+     b8a:	83 c3 01             	add    $0x1,%ebx
+     b8d:	0f b6 92 98 12 00 00 	movzbl 0x1298(%edx),%edx
+     b94:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+     b98:	89 ca                	mov    %ecx,%edx
+     b9a:	89 c1                	mov    %eax,%ecx
+     b9c:	39 f2                	cmp    %esi,%edx
+     b9e:	73 df                	jae    b7f <printint+0x2e>
+  if(neg)
+     ba0:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     ba4:	74 31                	je     bd7 <printint+0x86>
+    buf[i++] = '-';
+     ba6:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+     bab:	8d 5f 02             	lea    0x2(%edi),%ebx
+     bae:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     bb1:	eb 17                	jmp    bca <printint+0x79>
+    x = xx;
+     bb3:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+     bb5:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     bbc:	eb bc                	jmp    b7a <printint+0x29>
+
+  while(--i >= 0)
+    putc(o, buf[i]);
+     bbe:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+     bc3:	89 f0                	mov    %esi,%eax
+     bc5:	e8 45 ff ff ff       	call   b0f <putc>
+  while(--i >= 0)
+     bca:	83 eb 01             	sub    $0x1,%ebx
+     bcd:	79 ef                	jns    bbe <printint+0x6d>
+}
+     bcf:	83 c4 2c             	add    $0x2c,%esp
+     bd2:	5b                   	pop    %ebx
+     bd3:	5e                   	pop    %esi
+     bd4:	5f                   	pop    %edi
+     bd5:	5d                   	pop    %ebp
+     bd6:	c3                   	ret
+     bd7:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     bda:	eb ee                	jmp    bca <printint+0x79>
+
+00000bdc <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     bdc:	55                   	push   %ebp
+     bdd:	89 e5                	mov    %esp,%ebp
+     bdf:	57                   	push   %edi
+     be0:	56                   	push   %esi
+     be1:	53                   	push   %ebx
+     be2:	83 ec 6c             	sub    $0x6c,%esp
+  int c, i, state;
+  uint *ap;
+  struct out out, *o;
+
+  o = &out;
+  o->fd = fd;
+     be5:	8b 45 08             	mov    0x8(%ebp),%eax
+     be8:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  o->n = 0;
+     beb:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+     bf2:	8d 45 10             	lea    0x10(%ebp),%eax
+     bf5:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  state = 0;
+     bf8:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+     bfd:	bb 00 00 00 00       	mov    $0x0,%ebx
+     c02:	eb 14                	jmp    c18 <printf+0x3c>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(o, c);
+     c04:	89 fa                	mov    %edi,%edx
+     c06:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     c09:	e8 01 ff ff ff       	call   b0f <putc>
+     c0e:	eb 05                	jmp    c15 <printf+0x39>
+      }
+    } else if(state == '%'){
+     c10:	83 fe 25             	cmp    $0x25,%esi
+     c13:	74 25                	je     c3a <printf+0x5e>
+  for(i = 0; fmt[i]; i++){
+     c15:	83 c3 01             	add    $0x1,%ebx
+     c18:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c1b:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+     c1f:	84 c0                	test   %al,%al
+     c21:	0f 84 20 01 00 00    	je     d47 <printf+0x16b>
+    c = fmt[i] & 0xff;
+     c27:	0f be f8             	movsbl %al,%edi
+     c2a:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     c2d:	85 f6                	test   %esi,%esi
+     c2f:	75 df                	jne    c10 <printf+0x34>
+      if(c == '%'){
+     c31:	83 f8 25             	cmp    $0x25,%eax
+     c34:	75 ce                	jne    c04 <printf+0x28>
+        state = '%';
+     c36:	89 c6                	mov    %eax,%esi
+     c38:	eb db                	jmp    c15 <printf+0x39>
+      if(c == 'd'){
+     c3a:	83 f8 25             	cmp    $0x25,%eax
+     c3d:	0f 84 cf 00 00 00    	je     d12 <printf+0x136>
+     c43:	0f 8c dd 00 00 00    	jl     d26 <printf+0x14a>
+     c49:	83 f8 78             	cmp    $0x78,%eax
+     c4c:	0f 8f d4 00 00 00    	jg     d26 <printf+0x14a>
+     c52:	83 f8 63             	cmp    $0x63,%eax
+     c55:	0f 8c cb 00 00 00    	jl     d26 <printf+0x14a>
+     c5b:	83 e8 63             	sub    $0x63,%eax
+     c5e:	83 f8 15             	cmp    $0x15,%eax
+     c61:	0f 87 bf 00 00 00    	ja     d26 <printf+0x14a>
+     c67:	ff 24 85 40 12 00 00 	jmp    *0x1240(,%eax,4)
+        printint(o, *ap, 10, 1);
+     c6e:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     c71:	8b 17                	mov    (%edi),%edx
+     c73:	83 ec 0c             	sub    $0xc,%esp
+     c76:	6a 01                	push   $0x1
+     c78:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     c7d:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     c80:	e8 cc fe ff ff       	call   b51 <printint>
+        ap++;
+     c85:	83 c7 04             	add    $0x4,%edi
+     c88:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     c8b:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(o, '%');
+        putc(o, c);
+      }
+      state = 0;
+     c8e:	be 00 00 00 00       	mov    $0x0,%esi
+     c93:	eb 80                	jmp    c15 <printf+0x39>
+        printint(o, *ap, 16, 0);
+     c95:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     c98:	8b 17                	mov    (%edi),%edx
+     c9a:	83 ec 0c             	sub    $0xc,%esp
+     c9d:	6a 00                	push   $0x0
+     c9f:	b9 10 00 00 00       	mov    $0x10,%ecx
+     ca4:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     ca7:	e8 a5 fe ff ff       	call   b51 <printint>
+        ap++;
+     cac:	83 c7 04             	add    $0x4,%edi
+     caf:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     cb2:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     cb5:	be 00 00 00 00       	mov    $0x0,%esi
+     cba:	e9 56 ff ff ff       	jmp    c15 <printf+0x39>
+        s = (char*)*ap;
+     cbf:	8b 45 94             	mov    -0x6c(%ebp),%eax
+     cc2:	8b 30                	mov    (%eax),%esi
+        ap++;
+     cc4:	83 c0 04             	add    $0x4,%eax
+     cc7:	89 45 94             	mov    %eax,-0x6c(%ebp)
+        if(s == 0)
+     cca:	85 f6                	test   %esi,%esi
+     ccc:	75 15                	jne    ce3 <printf+0x107>
+          s = "(null)";
+     cce:	be 39 12 00 00       	mov    $0x1239,%esi
+     cd3:	eb 0e                	jmp    ce3 <printf+0x107>
+          putc(o, *s);
+     cd5:	0f be d2             	movsbl %dl,%edx
+     cd8:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     cdb:	e8 2f fe ff ff       	call   b0f <putc>
+          s++;
+     ce0:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+     ce3:	0f b6 16             	movzbl (%esi),%edx
+     ce6:	84 d2                	test   %dl,%dl
+     ce8:	75 eb                	jne    cd5 <printf+0xf9>
+      state = 0;
+     cea:	be 00 00 00 00       	mov    $0x0,%esi
+     cef:	e9 21 ff ff ff       	jmp    c15 <printf+0x39>
+        putc(o, *ap);
+     cf4:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     cf7:	0f be 17             	movsbl (%edi),%edx
+     cfa:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     cfd:	e8 0d fe ff ff       	call   b0f <putc>
+        ap++;
+     d02:	83 c7 04             	add    $0x4,%edi
+     d05:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+      state = 0;
+     d08:	be 00 00 00 00       	mov    $0x0,%esi
+     d0d:	e9 03 ff ff ff       	jmp    c15 <printf+0x39>
+        putc(o, c);
+     d12:	89 fa                	mov    %edi,%edx
+     d14:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d17:	e8 f3 fd ff ff       	call   b0f <putc>
+      state = 0;
+     d1c:	be 00 00 00 00       	mov    $0x0,%esi
+     d21:	e9 ef fe ff ff       	jmp    c15 <printf+0x39>
+        putc(o, '%');
+     d26:	ba 25 00 00 00       	mov    $0x25,%edx
+     d2b:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d2e:	e8 dc fd ff ff       	call   b0f <putc>
+        putc(o, c);
+     d33:	89 fa                	mov    %edi,%edx
+     d35:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d38:	e8 d2 fd ff ff       	call   b0f <putc>
+      state = 0;
+     d3d:	be 00 00 00 00       	mov    $0x0,%esi
+     d42:	e9 ce fe ff ff       	jmp    c15 <printf+0x39>
+    }
+  }
+  if(o->n > 0)
+     d47:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     d4a:	85 c0                	test   %eax,%eax
+     d4c:	7f 08                	jg     d56 <printf+0x17a>
+    bufwrite(fd, o->buf, o->n);
+}
+     d4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d51:	5b                   	pop    %ebx
+     d52:	5e                   	pop    %esi
+     d53:	5f                   	pop    %edi
+     d54:	5d                   	pop    %ebp
+     d55:	c3                   	ret
+    bufwrite(fd, o->buf, o->n);
+     d56:	83 ec 04             	sub    $0x4,%esp
+     d59:	50                   	push   %eax
+     d5a:	8d 45 a8             	lea    -0x58(%ebp),%eax
+     d5d:	50                   	push   %eax
+     d5e:	ff 75 08             	push   0x8(%ebp)
+     d61:	e8 91 f7 ff ff       	call   4f7 <bufwrite>
+     d66:	83 c4 10             	add    $0x10,%esp
+}
+     d69:	eb e3                	jmp    d4e <printf+0x172>
+
+00000d6b <largefree>:
+  return &b->h;
+}
+
+static void
+largefree(Fblock *b)
+{
+     d6b:	55                   	push   %ebp
+     d6c:	89 e5                	mov    %esp,%ebp
+     d6e:	57                   	push   %edi
+     d6f:	56                   	push   %esi
+     d70:	53                   	push   %ebx
+     d71:	83 ec 0c             	sub    $0xc,%esp
+     d74:	89 c1                	mov    %eax,%ecx
+  Fblock **pp, *p, *prev;
+
+  prev = 0;
+     d76:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     d7b:	ba ec 39 00 00       	mov    $0x39ec,%edx
+     d80:	eb 05                	jmp    d87 <largefree+0x1c>
+     d82:	8d 50 08             	lea    0x8(%eax),%edx
+    prev = p;
+     d85:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     d87:	8b 02                	mov    (%edx),%eax
+     d89:	85 c0                	test   %eax,%eax
+     d8b:	74 04                	je     d91 <largefree+0x26>
+     d8d:	39 c8                	cmp    %ecx,%eax
+     d8f:	72 f1                	jb     d82 <largefree+0x17>
+  b->next = p;
+     d91:	89 41 08             	mov    %eax,0x8(%ecx)
+  if(p && (char*)b + b->h.size == (char*)p){
+     d94:	85 c0                	test   %eax,%eax
+     d96:	74 09                	je     da1 <largefree+0x36>
+     d98:	8b 31                	mov    (%ecx),%esi
+     d9a:	8d 3c 31             	lea    (%ecx,%esi,1),%edi
+     d9d:	39 c7                	cmp    %eax,%edi
+     d9f:	74 21                	je     dc2 <largefree+0x57>
+    b->h.size += p->h.size;
+    b->next = p->next;
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+     da1:	85 db                	test   %ebx,%ebx
+     da3:	74 09                	je     dae <largefree+0x43>
+     da5:	8b 03                	mov    (%ebx),%eax
+     da7:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+     daa:	39 ce                	cmp    %ecx,%esi
+     dac:	74 20                	je     dce <largefree+0x63>
+    prev->h.size += b->h.size;
+    prev->next = b->next;
+  } else
+    *pp = b;
+     dae:	89 0a                	mov    %ecx,(%edx)
+
+  // Give the top of the heap back.  With threads sharing the
+  // address space sbrk() cannot shrink it; keep the block then.
+  for(pp = &large; (*pp)->next; pp = &(*pp)->next)
+     db0:	be ec 39 00 00       	mov    $0x39ec,%esi
+     db5:	8b 1e                	mov    (%esi),%ebx
+     db7:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+     dbb:	74 1d                	je     dda <largefree+0x6f>
+     dbd:	8d 73 08             	lea    0x8(%ebx),%esi
+     dc0:	eb f3                	jmp    db5 <largefree+0x4a>
+    b->h.size += p->h.size;
+     dc2:	03 30                	add    (%eax),%esi
+     dc4:	89 31                	mov    %esi,(%ecx)
+    b->next = p->next;
+     dc6:	8b 40 08             	mov    0x8(%eax),%eax
+     dc9:	89 41 08             	mov    %eax,0x8(%ecx)
+     dcc:	eb d3                	jmp    da1 <largefree+0x36>
+    prev->h.size += b->h.size;
+     dce:	03 01                	add    (%ecx),%eax
+     dd0:	89 03                	mov    %eax,(%ebx)
+    prev->next = b->next;
+     dd2:	8b 41 08             	mov    0x8(%ecx),%eax
+     dd5:	89 43 08             	mov    %eax,0x8(%ebx)
+     dd8:	eb d6                	jmp    db0 <largefree+0x45>
+    ;
+  b = *pp;
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     dda:	89 df                	mov    %ebx,%edi
+     ddc:	03 3b                	add    (%ebx),%edi
+     dde:	83 ec 0c             	sub    $0xc,%esp
+     de1:	6a 00                	push   $0x0
+     de3:	e8 93 fa ff ff       	call   87b <sbrk>
+     de8:	83 c4 10             	add    $0x10,%esp
+     deb:	39 c7                	cmp    %eax,%edi
+     ded:	74 08                	je     df7 <largefree+0x8c>
+    *pp = 0;
+}
+     def:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     df2:	5b                   	pop    %ebx
+     df3:	5e                   	pop    %esi
+     df4:	5f                   	pop    %edi
+     df5:	5d                   	pop    %ebp
+     df6:	c3                   	ret
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     df7:	8b 03                	mov    (%ebx),%eax
+     df9:	f7 d8                	neg    %eax
+     dfb:	83 ec 0c             	sub    $0xc,%esp
+     dfe:	50                   	push   %eax
+     dff:	e8 77 fa ff ff       	call   87b <sbrk>
+     e04:	83 c4 10             	add    $0x10,%esp
+     e07:	83 f8 ff             	cmp    $0xffffffff,%eax
+     e0a:	74 e3                	je     def <largefree+0x84>
+    *pp = 0;
+     e0c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+     e12:	eb db                	jmp    def <largefree+0x84>
+
+00000e14 <more>:
+{
+     e14:	55                   	push   %ebp
+     e15:	89 e5                	mov    %esp,%ebp
+     e17:	56                   	push   %esi
+     e18:	53                   	push   %ebx
+     e19:	89 c6                	mov    %eax,%esi
+  pad = -(uint)sbrk(0) & 7;
+     e1b:	83 ec 0c             	sub    $0xc,%esp
+     e1e:	6a 00                	push   $0x0
+     e20:	e8 56 fa ff ff       	call   87b <sbrk>
+     e25:	f7 d8                	neg    %eax
+     e27:	89 c3                	mov    %eax,%ebx
+     e29:	83 e3 07             	and    $0x7,%ebx
+  if((p = sbrk(n + pad)) == (char*)-1)
+     e2c:	01 de                	add    %ebx,%esi
+     e2e:	89 34 24             	mov    %esi,(%esp)
+     e31:	e8 45 fa ff ff       	call   87b <sbrk>
+     e36:	83 c4 10             	add    $0x10,%esp
+     e39:	83 f8 ff             	cmp    $0xffffffff,%eax
+     e3c:	74 09                	je     e47 <more+0x33>
+  return p + pad;
+     e3e:	01 d8                	add    %ebx,%eax
+}
+     e40:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e43:	5b                   	pop    %ebx
+     e44:	5e                   	pop    %esi
+     e45:	5d                   	pop    %ebp
+     e46:	c3                   	ret
+    return 0;
+     e47:	b8 00 00 00 00       	mov    $0x0,%eax
+     e4c:	eb f2                	jmp    e40 <more+0x2c>
+
+00000e4e <slaballoc>:
+{
+     e4e:	55                   	push   %ebp
+     e4f:	89 e5                	mov    %esp,%ebp
+     e51:	56                   	push   %esi
+     e52:	53                   	push   %ebx
+     e53:	89 c6                	mov    %eax,%esi
+  n = 1 << (MINSHIFT + c);
+     e55:	8d 48 04             	lea    0x4(%eax),%ecx
+     e58:	bb 01 00 00 00       	mov    $0x1,%ebx
+     e5d:	d3 e3                	shl    %cl,%ebx
+  if(slab + n > slabend){
+     e5f:	89 d8                	mov    %ebx,%eax
+     e61:	03 05 e8 39 00 00    	add    0x39e8,%eax
+     e67:	39 05 e4 39 00 00    	cmp    %eax,0x39e4
+     e6d:	72 17                	jb     e86 <slaballoc+0x38>
+  h = (Header*)slab;
+     e6f:	a1 e8 39 00 00       	mov    0x39e8,%eax
+  slab += n;
+     e74:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+     e77:	89 15 e8 39 00 00    	mov    %edx,0x39e8
+  h->size = n;
+     e7d:	89 18                	mov    %ebx,(%eax)
+  h->class = c;
+     e7f:	89 70 04             	mov    %esi,0x4(%eax)
+}
+     e82:	5b                   	pop    %ebx
+     e83:	5e                   	pop    %esi
+     e84:	5d                   	pop    %ebp
+     e85:	c3                   	ret
+    if((p = more(SLABSZ)) == 0)
+     e86:	b8 00 40 00 00       	mov    $0x4000,%eax
+     e8b:	e8 84 ff ff ff       	call   e14 <more>
+     e90:	85 c0                	test   %eax,%eax
+     e92:	74 ee                	je     e82 <slaballoc+0x34>
+    if(p != slabend)
+     e94:	39 05 e4 39 00 00    	cmp    %eax,0x39e4
+     e9a:	74 05                	je     ea1 <slaballoc+0x53>
+      slab = p;
+     e9c:	a3 e8 39 00 00       	mov    %eax,0x39e8
+    slabend = p + SLABSZ;
+     ea1:	05 00 40 00 00       	add    $0x4000,%eax
+     ea6:	a3 e4 39 00 00       	mov    %eax,0x39e4
+     eab:	eb c2                	jmp    e6f <slaballoc+0x21>
+
+00000ead <largealloc>:
+{
+     ead:	55                   	push   %ebp
+     eae:	89 e5                	mov    %esp,%ebp
+     eb0:	56                   	push   %esi
+     eb1:	53                   	push   %ebx
+     eb2:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     eb4:	b9 ec 39 00 00       	mov    $0x39ec,%ecx
+     eb9:	8b 01                	mov    (%ecx),%eax
+     ebb:	85 c0                	test   %eax,%eax
+     ebd:	74 36                	je     ef5 <largealloc+0x48>
+    if(b->h.size < n)
+     ebf:	8b 10                	mov    (%eax),%edx
+     ec1:	39 da                	cmp    %ebx,%edx
+     ec3:	72 24                	jb     ee9 <largealloc+0x3c>
+    if(b->h.size - n > SMALLMAX){
+     ec5:	29 da                	sub    %ebx,%edx
+     ec7:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+     ecd:	76 1f                	jbe    eee <largealloc+0x41>
+      rest = (Fblock*)((char*)b + n);
+     ecf:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+      rest->h.size = b->h.size - n;
+     ed2:	89 16                	mov    %edx,(%esi)
+      rest->h.class = LARGE;
+     ed4:	c7 46 04 09 00 00 00 	movl   $0x9,0x4(%esi)
+      rest->next = b->next;
+     edb:	8b 50 08             	mov    0x8(%eax),%edx
+     ede:	89 56 08             	mov    %edx,0x8(%esi)
+      *pp = rest;
+     ee1:	89 31                	mov    %esi,(%ecx)
+      b->h.size = n;
+     ee3:	89 18                	mov    %ebx,(%eax)
+}
+     ee5:	5b                   	pop    %ebx
+     ee6:	5e                   	pop    %esi
+     ee7:	5d                   	pop    %ebp
+     ee8:	c3                   	ret
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     ee9:	8d 48 08             	lea    0x8(%eax),%ecx
+     eec:	eb cb                	jmp    eb9 <largealloc+0xc>
+      *pp = b->next;
+     eee:	8b 50 08             	mov    0x8(%eax),%edx
+     ef1:	89 11                	mov    %edx,(%ecx)
+    return &b->h;
+     ef3:	eb f0                	jmp    ee5 <largealloc+0x38>
+  if((b = more(n)) == 0)
+     ef5:	89 d8                	mov    %ebx,%eax
+     ef7:	e8 18 ff ff ff       	call   e14 <more>
+     efc:	85 c0                	test   %eax,%eax
+     efe:	74 e5                	je     ee5 <largealloc+0x38>
+  b->h.size = n;
+     f00:	89 18                	mov    %ebx,(%eax)
+  b->h.class = LARGE;
+     f02:	c7 40 04 09 00 00 00 	movl   $0x9,0x4(%eax)
+  return &b->h;
+     f09:	eb da                	jmp    ee5 <largealloc+0x38>
+
+00000f0b <free>:
+
+void
+free(void *ap)
+{
+     f0b:	55                   	push   %ebp
+     f0c:	89 e5                	mov    %esp,%ebp
+     f0e:	56                   	push   %esi
+     f0f:	53                   	push   %ebx
+     f10:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+
+  if(ap == 0)
+     f13:	85 db                	test   %ebx,%ebx
+     f15:	74 3b                	je     f52 <free+0x47>
+    return;
+  h = (Header*)ap - 1;
+     f17:	8d 73 f8             	lea    -0x8(%ebx),%esi
+  lock_acquire(&lock);
+     f1a:	83 ec 0c             	sub    $0xc,%esp
+     f1d:	68 e0 39 00 00       	push   $0x39e0
+     f22:	e8 9c 01 00 00       	call   10c3 <lock_acquire>
+  if(h->class == LARGE)
+     f27:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     f2a:	83 c4 10             	add    $0x10,%esp
+     f2d:	83 f8 09             	cmp    $0x9,%eax
+     f30:	74 27                	je     f59 <free+0x4e>
+    largefree((Fblock*)h);
+  else {
+    ((Fblock*)h)->next = freelist[h->class];
+     f32:	8b 14 85 00 3a 00 00 	mov    0x3a00(,%eax,4),%edx
+     f39:	89 13                	mov    %edx,(%ebx)
+    freelist[h->class] = (Fblock*)h;
+     f3b:	89 34 85 00 3a 00 00 	mov    %esi,0x3a00(,%eax,4)
+  }
+  lock_release(&lock);
+     f42:	83 ec 0c             	sub    $0xc,%esp
+     f45:	68 e0 39 00 00       	push   $0x39e0
+     f4a:	e8 88 01 00 00       	call   10d7 <lock_release>
+     f4f:	83 c4 10             	add    $0x10,%esp
+}
+     f52:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f55:	5b                   	pop    %ebx
+     f56:	5e                   	pop    %esi
+     f57:	5d                   	pop    %ebp
+     f58:	c3                   	ret
+    largefree((Fblock*)h);
+     f59:	89 f0                	mov    %esi,%eax
+     f5b:	e8 0b fe ff ff       	call   d6b <largefree>
+     f60:	eb e0                	jmp    f42 <free+0x37>
+
+00000f62 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     f62:	55                   	push   %ebp
+     f63:	89 e5                	mov    %esp,%ebp
+     f65:	53                   	push   %ebx
+     f66:	83 ec 04             	sub    $0x4,%esp
+     f69:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+  uint n;
+  int c;
+
+  if(nbytes > 0x7fffffff - sizeof(Header) - 7)
+     f6c:	81 fb f0 ff ff 7f    	cmp    $0x7ffffff0,%ebx
+     f72:	0f 87 8b 00 00 00    	ja     1003 <malloc+0xa1>
+    return 0;
+  n = (nbytes + sizeof(Header) + 7) & ~7;
+     f78:	83 c3 0f             	add    $0xf,%ebx
+     f7b:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(n < sizeof(Fblock))
+     f7e:	83 fb 0b             	cmp    $0xb,%ebx
+     f81:	77 05                	ja     f88 <malloc+0x26>
+    n = sizeof(Fblock);
+     f83:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  lock_acquire(&lock);
+     f88:	83 ec 0c             	sub    $0xc,%esp
+     f8b:	68 e0 39 00 00       	push   $0x39e0
+     f90:	e8 2e 01 00 00       	call   10c3 <lock_acquire>
+  if(n <= SMALLMAX){
+     f95:	83 c4 10             	add    $0x10,%esp
+     f98:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+     f9e:	77 58                	ja     ff8 <malloc+0x96>
+    for(c = 0; (1 << (MINSHIFT + c)) < n; c++)
+     fa0:	ba 00 00 00 00       	mov    $0x0,%edx
+     fa5:	eb 03                	jmp    faa <malloc+0x48>
+     fa7:	83 c2 01             	add    $0x1,%edx
+     faa:	8d 4a 04             	lea    0x4(%edx),%ecx
+     fad:	b8 01 00 00 00       	mov    $0x1,%eax
+     fb2:	d3 e0                	shl    %cl,%eax
+     fb4:	39 d8                	cmp    %ebx,%eax
+     fb6:	72 ef                	jb     fa7 <malloc+0x45>
+      ;
+    if(freelist[c]){
+     fb8:	8b 04 95 00 3a 00 00 	mov    0x3a00(,%edx,4),%eax
+     fbf:	85 c0                	test   %eax,%eax
+     fc1:	74 2a                	je     fed <malloc+0x8b>
+      h = &freelist[c]->h;
+     fc3:	89 c3                	mov    %eax,%ebx
+      freelist[c] = freelist[c]->next;
+     fc5:	8b 40 08             	mov    0x8(%eax),%eax
+     fc8:	89 04 95 00 3a 00 00 	mov    %eax,0x3a00(,%edx,4)
+    } else
+      h = slaballoc(c);
+  } else
+    h = largealloc(n);
+  lock_release(&lock);
+     fcf:	83 ec 0c             	sub    $0xc,%esp
+     fd2:	68 e0 39 00 00       	push   $0x39e0
+     fd7:	e8 fb 00 00 00       	call   10d7 <lock_release>
+  return h ? (void*)(h + 1) : 0;
+     fdc:	83 c4 10             	add    $0x10,%esp
+     fdf:	85 db                	test   %ebx,%ebx
+     fe1:	74 03                	je     fe6 <malloc+0x84>
+     fe3:	83 c3 08             	add    $0x8,%ebx
+}
+     fe6:	89 d8                	mov    %ebx,%eax
+     fe8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     feb:	c9                   	leave
+     fec:	c3                   	ret
+      h = slaballoc(c);
+     fed:	89 d0                	mov    %edx,%eax
+     fef:	e8 5a fe ff ff       	call   e4e <slaballoc>
+     ff4:	89 c3                	mov    %eax,%ebx
+     ff6:	eb d7                	jmp    fcf <malloc+0x6d>
+    h = largealloc(n);
+     ff8:	89 d8                	mov    %ebx,%eax
+     ffa:	e8 ae fe ff ff       	call   ead <largealloc>
+     fff:	89 c3                	mov    %eax,%ebx
+    1001:	eb cc                	jmp    fcf <malloc+0x6d>
+    return 0;
+    1003:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1008:	eb dc                	jmp    fe6 <malloc+0x84>
+
+0000100a <tstart>:
+  void *arg;
+};
+
+static void
+tstart(void *a)
+{
+    100a:	55                   	push   %ebp
+    100b:	89 e5                	mov    %esp,%ebp
+    100d:	83 ec 14             	sub    $0x14,%esp
+    1010:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+    1013:	ff 70 04             	push   0x4(%eax)
+    1016:	ff 10                	call   *(%eax)
+  exit();
+    1018:	e8 86 f6 ff ff       	call   6a3 <exit>
+
+0000101d <thread_create>:
+}
+
+// Run fn(arg) in a new thread.  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    101d:	55                   	push   %ebp
+    101e:	89 e5                	mov    %esp,%ebp
+    1020:	56                   	push   %esi
+    1021:	53                   	push   %ebx
+  struct tstart *t;
+  char *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    1022:	83 ec 0c             	sub    $0xc,%esp
+    1025:	68 00 10 00 00       	push   $0x1000
+    102a:	e8 33 ff ff ff       	call   f62 <malloc>
+    102f:	83 c4 10             	add    $0x10,%esp
+    1032:	85 c0                	test   %eax,%eax
+    1034:	74 42                	je     1078 <thread_create+0x5b>
+    1036:	89 c3                	mov    %eax,%ebx
+    return -1;
+  t = (struct tstart*)stack;
+  t->fn = fn;
+    1038:	8b 45 08             	mov    0x8(%ebp),%eax
+    103b:	89 03                	mov    %eax,(%ebx)
+  t->arg = arg;
+    103d:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1040:	89 43 04             	mov    %eax,0x4(%ebx)
+  if((pid = clone(tstart, stack + TSTACK, t)) < 0)
+    1043:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    1049:	83 ec 04             	sub    $0x4,%esp
+    104c:	53                   	push   %ebx
+    104d:	50                   	push   %eax
+    104e:	68 0a 10 00 00       	push   $0x100a
+    1053:	e8 f5 f8 ff ff       	call   94d <clone>
+    1058:	89 c6                	mov    %eax,%esi
+    105a:	83 c4 10             	add    $0x10,%esp
+    105d:	85 c0                	test   %eax,%eax
+    105f:	78 09                	js     106a <thread_create+0x4d>
+    free(stack);
+  return pid;
+}
+    1061:	89 f0                	mov    %esi,%eax
+    1063:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1066:	5b                   	pop    %ebx
+    1067:	5e                   	pop    %esi
+    1068:	5d                   	pop    %ebp
+    1069:	c3                   	ret
+    free(stack);
+    106a:	83 ec 0c             	sub    $0xc,%esp
+    106d:	53                   	push   %ebx
+    106e:	e8 98 fe ff ff       	call   f0b <free>
+    1073:	83 c4 10             	add    $0x10,%esp
+    1076:	eb e9                	jmp    1061 <thread_create+0x44>
+    return -1;
+    1078:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    107d:	eb e2                	jmp    1061 <thread_create+0x44>
+
+0000107f <thread_join>:
+
+// Wait for one of this process's threads to exit and free its
+// stack.  Returns its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+    107f:	55                   	push   %ebp
+    1080:	89 e5                	mov    %esp,%ebp
+    1082:	53                   	push   %ebx
+    1083:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    1086:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1089:	50                   	push   %eax
+    108a:	e8 cd f8 ff ff       	call   95c <join>
+    108f:	89 c3                	mov    %eax,%ebx
+    1091:	83 c4 10             	add    $0x10,%esp
+    1094:	85 c0                	test   %eax,%eax
+    1096:	79 07                	jns    109f <thread_join+0x20>
+    free((char*)stack - TSTACK);
+  return pid;
+}
+    1098:	89 d8                	mov    %ebx,%eax
+    109a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    109d:	c9                   	leave
+    109e:	c3                   	ret
+    free((char*)stack - TSTACK);
+    109f:	83 ec 0c             	sub    $0xc,%esp
+    10a2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    10a5:	2d 00 10 00 00       	sub    $0x1000,%eax
+    10aa:	50                   	push   %eax
+    10ab:	e8 5b fe ff ff       	call   f0b <free>
+    10b0:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    10b3:	eb e3                	jmp    1098 <thread_join+0x19>
+
+000010b5 <lock_init>:
+
+void
+lock_init(lock_t *lk)
+{
+    10b5:	55                   	push   %ebp
+    10b6:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    10b8:	8b 45 08             	mov    0x8(%ebp),%eax
+    10bb:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    10c1:	5d                   	pop    %ebp
+    10c2:	c3                   	ret
+
+000010c3 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+    10c3:	55                   	push   %ebp
+    10c4:	89 e5                	mov    %esp,%ebp
+    10c6:	8b 55 08             	mov    0x8(%ebp),%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    10c9:	b8 01 00 00 00       	mov    $0x1,%eax
+    10ce:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    10d1:	85 c0                	test   %eax,%eax
+    10d3:	75 f4                	jne    10c9 <lock_acquire+0x6>
+    ;
+}
+    10d5:	5d                   	pop    %ebp
+    10d6:	c3                   	ret
+
+000010d7 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+    10d7:	55                   	push   %ebp
+    10d8:	89 e5                	mov    %esp,%ebp
+    10da:	8b 55 08             	mov    0x8(%ebp),%edx
+    10dd:	b8 00 00 00 00       	mov    $0x0,%eax
+    10e2:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    10e5:	5d                   	pop    %ebp
+    10e6:	c3                   	ret
+
+000010e7 <mutex_init>:
+// Are Tricky": state is 0 when free, 1 when held, 2 when held and
+// others may be waiting.  Unlocking an uncontended mutex costs no
+// system call.
+void
+mutex_init(mutex_t *m)
+{
+    10e7:	55                   	push   %ebp
+    10e8:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    10ea:	8b 45 08             	mov    0x8(%ebp),%eax
+    10ed:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    10f3:	5d                   	pop    %ebp
+    10f4:	c3                   	ret
+
+000010f5 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+    10f5:	55                   	push   %ebp
+    10f6:	89 e5                	mov    %esp,%ebp
+    10f8:	53                   	push   %ebx
+    10f9:	83 ec 04             	sub    $0x4,%esp
+    10fc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    10ff:	b8 00 00 00 00       	mov    $0x0,%eax
+    1104:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1109:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    110d:	85 c0                	test   %eax,%eax
+    110f:	74 29                	je     113a <mutex_lock+0x45>
+    return;
+  if(c != 2)
+    1111:	83 f8 02             	cmp    $0x2,%eax
+    1114:	74 20                	je     1136 <mutex_lock+0x41>
+    1116:	b8 02 00 00 00       	mov    $0x2,%eax
+    111b:	f0 87 03             	lock xchg %eax,(%ebx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    111e:	eb 16                	jmp    1136 <mutex_lock+0x41>
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    1120:	83 ec 08             	sub    $0x8,%esp
+    1123:	6a 02                	push   $0x2
+    1125:	53                   	push   %ebx
+    1126:	e8 40 f8 ff ff       	call   96b <futex_wait>
+  asm volatile("lock; xchgl %0, %1" :
+    112b:	b8 02 00 00 00       	mov    $0x2,%eax
+    1130:	f0 87 03             	lock xchg %eax,(%ebx)
+    1133:	83 c4 10             	add    $0x10,%esp
+  while(c != 0){
+    1136:	85 c0                	test   %eax,%eax
+    1138:	75 e6                	jne    1120 <mutex_lock+0x2b>
+    c = xchg(&m->state, 2);
+  }
+}
+    113a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    113d:	c9                   	leave
+    113e:	c3                   	ret
+
+0000113f <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+    113f:	55                   	push   %ebp
+    1140:	89 e5                	mov    %esp,%ebp
+    1142:	83 ec 08             	sub    $0x8,%esp
+    1145:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    1148:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    114d:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    1151:	83 fa 01             	cmp    $0x1,%edx
+    1154:	75 02                	jne    1158 <mutex_unlock+0x19>
+    m->state = 0;
+    futex_wake(&m->state, 1);
+  }
+}
+    1156:	c9                   	leave
+    1157:	c3                   	ret
+    m->state = 0;
+    1158:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+    115e:	83 ec 08             	sub    $0x8,%esp
+    1161:	6a 01                	push   $0x1
+    1163:	50                   	push   %eax
+    1164:	e8 11 f8 ff ff       	call   97a <futex_wake>
+    1169:	83 c4 10             	add    $0x10,%esp
+}
+    116c:	eb e8                	jmp    1156 <mutex_unlock+0x17>
+
+0000116e <cond_init>:
+// Condition variable: waiters sleep on a sequence number that
+// every signal bumps, so a signal between the unlock and the
+// futex_wait() in cond_wait() is not lost.
+void
+cond_init(cond_t *c)
+{
+    116e:	55                   	push   %ebp
+    116f:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    1171:	8b 45 08             	mov    0x8(%ebp),%eax
+    1174:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    117a:	5d                   	pop    %ebp
+    117b:	c3                   	ret
+
+0000117c <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+    117c:	55                   	push   %ebp
+    117d:	89 e5                	mov    %esp,%ebp
+    117f:	57                   	push   %edi
+    1180:	56                   	push   %esi
+    1181:	53                   	push   %ebx
+    1182:	83 ec 18             	sub    $0x18,%esp
+    1185:	8b 75 08             	mov    0x8(%ebp),%esi
+    1188:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    118b:	8b 3e                	mov    (%esi),%edi
+  mutex_unlock(m);
+    118d:	53                   	push   %ebx
+    118e:	e8 ac ff ff ff       	call   113f <mutex_unlock>
+  futex_wait(&c->seq, seq);
+    1193:	83 c4 08             	add    $0x8,%esp
+    1196:	57                   	push   %edi
+    1197:	56                   	push   %esi
+    1198:	e8 ce f7 ff ff       	call   96b <futex_wait>
+  // Others may be waiting for m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+    119d:	83 c4 10             	add    $0x10,%esp
+    11a0:	eb 0e                	jmp    11b0 <cond_wait+0x34>
+    futex_wait(&m->state, 2);
+    11a2:	83 ec 08             	sub    $0x8,%esp
+    11a5:	6a 02                	push   $0x2
+    11a7:	53                   	push   %ebx
+    11a8:	e8 be f7 ff ff       	call   96b <futex_wait>
+    11ad:	83 c4 10             	add    $0x10,%esp
+    11b0:	b8 02 00 00 00       	mov    $0x2,%eax
+    11b5:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    11b8:	85 c0                	test   %eax,%eax
+    11ba:	75 e6                	jne    11a2 <cond_wait+0x26>
+}
+    11bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11bf:	5b                   	pop    %ebx
+    11c0:	5e                   	pop    %esi
+    11c1:	5f                   	pop    %edi
+    11c2:	5d                   	pop    %ebp
+    11c3:	c3                   	ret
+
+000011c4 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+    11c4:	55                   	push   %ebp
+    11c5:	89 e5                	mov    %esp,%ebp
+    11c7:	83 ec 10             	sub    $0x10,%esp
+    11ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    11cd:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+    11d1:	6a 01                	push   $0x1
+    11d3:	50                   	push   %eax
+    11d4:	e8 a1 f7 ff ff       	call   97a <futex_wake>
+}
+    11d9:	83 c4 10             	add    $0x10,%esp
+    11dc:	c9                   	leave
+    11dd:	c3                   	ret
+
+000011de <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+    11de:	55                   	push   %ebp
+    11df:	89 e5                	mov    %esp,%ebp
+    11e1:	83 ec 10             	sub    $0x10,%esp
+    11e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    11e7:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, NPROC);
+    11eb:	6a 40                	push   $0x40
+    11ed:	50                   	push   %eax
+    11ee:	e8 87 f7 ff ff       	call   97a <futex_wake>
+}
+    11f3:	83 c4 10             	add    $0x10,%esp
+    11f6:	c9                   	leave
+    11f7:	c3                   	ret
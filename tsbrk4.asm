@@ -0,0 +1,2822 @@
+
+_tsbrk4:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "types.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	56                   	push   %esi
+       e:	53                   	push   %ebx
+       f:	51                   	push   %ecx
+      10:	83 ec 18             	sub    $0x18,%esp
+  char* a = sbrk (15000);
+      13:	68 98 3a 00 00       	push   $0x3a98
+      18:	e8 21 09 00 00       	call   93e <sbrk>
+      1d:	89 c3                	mov    %eax,%ebx
+
+  fork();
+      1f:	e8 2e 07 00 00       	call   752 <fork>
+
+  a[500] = 1;
+      24:	c6 83 f4 01 00 00 01 	movb   $0x1,0x1f4(%ebx)
+
+  if ((uint)a + 15000 != (uint) sbrk (-15000))
+      2b:	8d b3 98 3a 00 00    	lea    0x3a98(%ebx),%esi
+      31:	c7 04 24 68 c5 ff ff 	movl   $0xffffc568,(%esp)
+      38:	e8 01 09 00 00       	call   93e <sbrk>
+      3d:	83 c4 10             	add    $0x10,%esp
+      40:	39 c6                	cmp    %eax,%esi
+      42:	74 14                	je     58 <main+0x58>
+  {
+    printf (1, "sbrk() con número positivo falló.\n");
+      44:	83 ec 08             	sub    $0x8,%esp
+      47:	68 bc 12 00 00       	push   $0x12bc
+      4c:	6a 01                	push   $0x1
+      4e:	e8 4c 0c 00 00       	call   c9f <printf>
+    exit();
+      53:	e8 0e 07 00 00       	call   766 <exit>
+  }
+
+  if (a != sbrk (0))
+      58:	83 ec 0c             	sub    $0xc,%esp
+      5b:	6a 00                	push   $0x0
+      5d:	e8 dc 08 00 00       	call   93e <sbrk>
+      62:	83 c4 10             	add    $0x10,%esp
+      65:	39 c3                	cmp    %eax,%ebx
+      67:	74 14                	je     7d <main+0x7d>
+  {
+    printf (1, "sbrk() con cero falló.\n");
+      69:	83 ec 08             	sub    $0x8,%esp
+      6c:	68 e1 12 00 00       	push   $0x12e1
+      71:	6a 01                	push   $0x1
+      73:	e8 27 0c 00 00       	call   c9f <printf>
+    exit();
+      78:	e8 e9 06 00 00       	call   766 <exit>
+  }
+
+  if (a != sbrk (15000))
+      7d:	83 ec 0c             	sub    $0xc,%esp
+      80:	68 98 3a 00 00       	push   $0x3a98
+      85:	e8 b4 08 00 00       	call   93e <sbrk>
+      8a:	83 c4 10             	add    $0x10,%esp
+      8d:	39 c3                	cmp    %eax,%ebx
+      8f:	74 14                	je     a5 <main+0xa5>
+  {
+    printf (1, "sbrk() negativo falló.\n");
+      91:	83 ec 08             	sub    $0x8,%esp
+      94:	68 fa 12 00 00       	push   $0x12fa
+      99:	6a 01                	push   $0x1
+      9b:	e8 ff 0b 00 00       	call   c9f <printf>
+    exit();
+      a0:	e8 c1 06 00 00       	call   766 <exit>
+  }
+
+  printf (1, "Debe imprimir 1: %d.\n", ++a[500]);
+      a5:	0f b6 83 f4 01 00 00 	movzbl 0x1f4(%ebx),%eax
+      ac:	83 c0 01             	add    $0x1,%eax
+      af:	88 83 f4 01 00 00    	mov    %al,0x1f4(%ebx)
+      b5:	83 ec 04             	sub    $0x4,%esp
+      b8:	0f be c0             	movsbl %al,%eax
+      bb:	50                   	push   %eax
+      bc:	68 13 13 00 00       	push   $0x1313
+      c1:	6a 01                	push   $0x1
+      c3:	e8 d7 0b 00 00       	call   c9f <printf>
+
+  a=sbrk (-15000);
+      c8:	c7 04 24 68 c5 ff ff 	movl   $0xffffc568,(%esp)
+      cf:	e8 6a 08 00 00       	call   93e <sbrk>
+
+  a=sbrk(1024*4096*2);
+      d4:	c7 04 24 00 00 80 00 	movl   $0x800000,(%esp)
+      db:	e8 5e 08 00 00       	call   93e <sbrk>
+      e0:	89 c3                	mov    %eax,%ebx
+
+  fork();
+      e2:	e8 6b 06 00 00       	call   752 <fork>
+
+  a[600*4096*2] = 1;
+      e7:	c6 83 00 00 4b 00 01 	movb   $0x1,0x4b0000(%ebx)
+
+  sbrk(-1024*4096*2);
+      ee:	c7 04 24 00 00 80 ff 	movl   $0xff800000,(%esp)
+      f5:	e8 44 08 00 00       	call   93e <sbrk>
+
+  a=sbrk(1024*4096*2);
+      fa:	c7 04 24 00 00 80 00 	movl   $0x800000,(%esp)
+     101:	e8 38 08 00 00       	call   93e <sbrk>
+
+  printf (1, "Debe imprimir 1: %d.\n", ++a[600*4096*2]);
+     106:	0f b6 88 00 00 4b 00 	movzbl 0x4b0000(%eax),%ecx
+     10d:	8d 51 01             	lea    0x1(%ecx),%edx
+     110:	88 90 00 00 4b 00    	mov    %dl,0x4b0000(%eax)
+     116:	83 c4 0c             	add    $0xc,%esp
+     119:	0f be d2             	movsbl %dl,%edx
+     11c:	52                   	push   %edx
+     11d:	68 13 13 00 00       	push   $0x1313
+     122:	6a 01                	push   $0x1
+     124:	e8 76 0b 00 00       	call   c9f <printf>
+
+  exit();
+     129:	e8 38 06 00 00       	call   766 <exit>
+
+0000012e <strcpy>:
+#include "memlayout.h"
+#include "clock.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     12e:	55                   	push   %ebp
+     12f:	89 e5                	mov    %esp,%ebp
+     131:	56                   	push   %esi
+     132:	53                   	push   %ebx
+     133:	8b 75 08             	mov    0x8(%ebp),%esi
+     136:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     139:	89 f0                	mov    %esi,%eax
+     13b:	89 d1                	mov    %edx,%ecx
+     13d:	83 c2 01             	add    $0x1,%edx
+     140:	89 c3                	mov    %eax,%ebx
+     142:	83 c0 01             	add    $0x1,%eax
+     145:	0f b6 09             	movzbl (%ecx),%ecx
+     148:	88 0b                	mov    %cl,(%ebx)
+     14a:	84 c9                	test   %cl,%cl
+     14c:	75 ed                	jne    13b <strcpy+0xd>
+    ;
+  return os;
+}
+     14e:	89 f0                	mov    %esi,%eax
+     150:	5b                   	pop    %ebx
+     151:	5e                   	pop    %esi
+     152:	5d                   	pop    %ebp
+     153:	c3                   	ret
+
+00000154 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     154:	55                   	push   %ebp
+     155:	89 e5                	mov    %esp,%ebp
+     157:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     15a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+     15d:	eb 06                	jmp    165 <strcmp+0x11>
+    p++, q++;
+     15f:	83 c1 01             	add    $0x1,%ecx
+     162:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+     165:	0f b6 01             	movzbl (%ecx),%eax
+     168:	84 c0                	test   %al,%al
+     16a:	74 04                	je     170 <strcmp+0x1c>
+     16c:	3a 02                	cmp    (%edx),%al
+     16e:	74 ef                	je     15f <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+     170:	0f b6 c0             	movzbl %al,%eax
+     173:	0f b6 12             	movzbl (%edx),%edx
+     176:	29 d0                	sub    %edx,%eax
+}
+     178:	5d                   	pop    %ebp
+     179:	c3                   	ret
+
+0000017a <strlen>:
+
+uint
+strlen(const char *s)
+{
+     17a:	55                   	push   %ebp
+     17b:	89 e5                	mov    %esp,%ebp
+     17d:	53                   	push   %ebx
+     17e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  const char *p;
+  uint w;
+
+  for(p = s; (uint)p & 3; p++)
+     181:	89 c8                	mov    %ecx,%eax
+     183:	eb 03                	jmp    188 <strlen+0xe>
+     185:	83 c0 01             	add    $0x1,%eax
+     188:	a8 03                	test   $0x3,%al
+     18a:	74 09                	je     195 <strlen+0x1b>
+    if(*p == 0)
+     18c:	80 38 00             	cmpb   $0x0,(%eax)
+     18f:	75 f4                	jne    185 <strlen+0xb>
+      return p - s;
+     191:	29 c8                	sub    %ecx,%eax
+     193:	eb 25                	jmp    1ba <strlen+0x40>
+  // Then a word at a time, which never crosses into the next page:
+  // a word with a zero byte in it has one of these bits set.
+  for(;; p += 4){
+    w = *(uint*)p;
+     195:	8b 10                	mov    (%eax),%edx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     197:	8d 9a ff fe fe fe    	lea    -0x1010101(%edx),%ebx
+     19d:	f7 d2                	not    %edx
+     19f:	21 da                	and    %ebx,%edx
+     1a1:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+     1a7:	75 05                	jne    1ae <strlen+0x34>
+  for(;; p += 4){
+     1a9:	83 c0 04             	add    $0x4,%eax
+    w = *(uint*)p;
+     1ac:	eb e7                	jmp    195 <strlen+0x1b>
+      break;
+  }
+  while(*p)
+     1ae:	80 38 00             	cmpb   $0x0,(%eax)
+     1b1:	74 05                	je     1b8 <strlen+0x3e>
+    p++;
+     1b3:	83 c0 01             	add    $0x1,%eax
+     1b6:	eb f6                	jmp    1ae <strlen+0x34>
+  return p - s;
+     1b8:	29 c8                	sub    %ecx,%eax
+}
+     1ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     1bd:	c9                   	leave
+     1be:	c3                   	ret
+
+000001bf <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     1bf:	55                   	push   %ebp
+     1c0:	89 e5                	mov    %esp,%ebp
+     1c2:	57                   	push   %edi
+     1c3:	56                   	push   %esi
+     1c4:	53                   	push   %ebx
+     1c5:	8b 55 10             	mov    0x10(%ebp),%edx
+  uint h;
+  char *d;
+
+  d = dst;
+  c &= 0xFF;
+     1c8:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  if(n >= 16){
+     1cc:	83 fa 0f             	cmp    $0xf,%edx
+     1cf:	76 52                	jbe    223 <memset+0x64>
+    h = -(uint)d & 3;
+     1d1:	8b 45 08             	mov    0x8(%ebp),%eax
+     1d4:	f7 d8                	neg    %eax
+     1d6:	83 e0 03             	and    $0x3,%eax
+     1d9:	89 c6                	mov    %eax,%esi
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     1db:	8b 7d 08             	mov    0x8(%ebp),%edi
+     1de:	89 c1                	mov    %eax,%ecx
+     1e0:	89 d8                	mov    %ebx,%eax
+     1e2:	fc                   	cld
+     1e3:	f3 aa                	rep stos %al,%es:(%edi)
+    stosb(d, c, h);
+    stosl(d + h, (c<<24)|(c<<16)|(c<<8)|c, (n - h)/4);
+     1e5:	29 f2                	sub    %esi,%edx
+     1e7:	89 d1                	mov    %edx,%ecx
+     1e9:	c1 e9 02             	shr    $0x2,%ecx
+     1ec:	c1 e0 18             	shl    $0x18,%eax
+     1ef:	89 df                	mov    %ebx,%edi
+     1f1:	c1 e7 10             	shl    $0x10,%edi
+     1f4:	09 f8                	or     %edi,%eax
+     1f6:	89 df                	mov    %ebx,%edi
+     1f8:	c1 e7 08             	shl    $0x8,%edi
+     1fb:	09 f8                	or     %edi,%eax
+     1fd:	09 d8                	or     %ebx,%eax
+     1ff:	89 f7                	mov    %esi,%edi
+     201:	03 7d 08             	add    0x8(%ebp),%edi
+}
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosl" :
+     204:	fc                   	cld
+     205:	f3 ab                	rep stos %eax,%es:(%edi)
+    d += h + (n - h)/4*4;
+     207:	89 d7                	mov    %edx,%edi
+     209:	83 e7 fc             	and    $0xfffffffc,%edi
+     20c:	09 f7                	or     %esi,%edi
+     20e:	03 7d 08             	add    0x8(%ebp),%edi
+    n = (n - h)%4;
+     211:	83 e2 03             	and    $0x3,%edx
+  asm volatile("cld; rep stosb" :
+     214:	89 d1                	mov    %edx,%ecx
+     216:	89 d8                	mov    %ebx,%eax
+     218:	fc                   	cld
+     219:	f3 aa                	rep stos %al,%es:(%edi)
+  }
+  stosb(d, c, n);
+  return dst;
+}
+     21b:	8b 45 08             	mov    0x8(%ebp),%eax
+     21e:	5b                   	pop    %ebx
+     21f:	5e                   	pop    %esi
+     220:	5f                   	pop    %edi
+     221:	5d                   	pop    %ebp
+     222:	c3                   	ret
+  d = dst;
+     223:	8b 7d 08             	mov    0x8(%ebp),%edi
+     226:	eb ec                	jmp    214 <memset+0x55>
+
+00000228 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     228:	55                   	push   %ebp
+     229:	89 e5                	mov    %esp,%ebp
+     22b:	8b 45 08             	mov    0x8(%ebp),%eax
+     22e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     232:	eb 03                	jmp    237 <strchr+0xf>
+     234:	83 c0 01             	add    $0x1,%eax
+     237:	0f b6 10             	movzbl (%eax),%edx
+     23a:	84 d2                	test   %dl,%dl
+     23c:	74 06                	je     244 <strchr+0x1c>
+    if(*s == c)
+     23e:	38 ca                	cmp    %cl,%dl
+     240:	75 f2                	jne    234 <strchr+0xc>
+     242:	eb 05                	jmp    249 <strchr+0x21>
+      return (char*)s;
+  return 0;
+     244:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     249:	5d                   	pop    %ebp
+     24a:	c3                   	ret
+
+0000024b <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     24b:	55                   	push   %ebp
+     24c:	89 e5                	mov    %esp,%ebp
+     24e:	56                   	push   %esi
+     24f:	53                   	push   %ebx
+     250:	8b 55 08             	mov    0x8(%ebp),%edx
+     253:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     256:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  // A word at a time while they agree.
+  if((((uint)s1 | (uint)s2) & 3) == 0)
+     259:	89 d3                	mov    %edx,%ebx
+     25b:	09 cb                	or     %ecx,%ebx
+     25d:	f6 c3 03             	test   $0x3,%bl
+     260:	74 24                	je     286 <memcmp+0x3b>
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+      s1 += 4, s2 += 4;
+  while(n-- > 0){
+     262:	8d 70 ff             	lea    -0x1(%eax),%esi
+     265:	85 c0                	test   %eax,%eax
+     267:	74 32                	je     29b <memcmp+0x50>
+    if(*s1 != *s2)
+     269:	0f b6 02             	movzbl (%edx),%eax
+     26c:	0f b6 19             	movzbl (%ecx),%ebx
+     26f:	38 d8                	cmp    %bl,%al
+     271:	75 20                	jne    293 <memcmp+0x48>
+      return *s1 - *s2;
+    s1++, s2++;
+     273:	83 c2 01             	add    $0x1,%edx
+     276:	83 c1 01             	add    $0x1,%ecx
+  while(n-- > 0){
+     279:	89 f0                	mov    %esi,%eax
+     27b:	eb e5                	jmp    262 <memcmp+0x17>
+      s1 += 4, s2 += 4;
+     27d:	83 c2 04             	add    $0x4,%edx
+     280:	83 c1 04             	add    $0x4,%ecx
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+     283:	83 e8 04             	sub    $0x4,%eax
+     286:	83 f8 03             	cmp    $0x3,%eax
+     289:	76 d7                	jbe    262 <memcmp+0x17>
+     28b:	8b 31                	mov    (%ecx),%esi
+     28d:	39 32                	cmp    %esi,(%edx)
+     28f:	74 ec                	je     27d <memcmp+0x32>
+     291:	eb cf                	jmp    262 <memcmp+0x17>
+      return *s1 - *s2;
+     293:	0f b6 c0             	movzbl %al,%eax
+     296:	0f b6 db             	movzbl %bl,%ebx
+     299:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     29b:	5b                   	pop    %ebx
+     29c:	5e                   	pop    %esi
+     29d:	5d                   	pop    %ebp
+     29e:	c3                   	ret
+
+0000029f <memchr>:
+// The first c in the n bytes at v, or 0.  Once aligned, a word at
+// a time, with the word's bytes that equal c turned into zeroes
+// and those looked for.
+void*
+memchr(const void *v, int c, uint n)
+{
+     29f:	55                   	push   %ebp
+     2a0:	89 e5                	mov    %esp,%ebp
+     2a2:	57                   	push   %edi
+     2a3:	56                   	push   %esi
+     2a4:	53                   	push   %ebx
+     2a5:	8b 45 08             	mov    0x8(%ebp),%eax
+     2a8:	8b 55 10             	mov    0x10(%ebp),%edx
+  const uchar *s;
+  uint w, rep;
+
+  s = v;
+  c = (uchar)c;
+     2ab:	0f b6 75 0c          	movzbl 0xc(%ebp),%esi
+  for(; n > 0 && ((uint)s & 3); n--, s++)
+     2af:	eb 06                	jmp    2b7 <memchr+0x18>
+     2b1:	83 ea 01             	sub    $0x1,%edx
+     2b4:	83 c0 01             	add    $0x1,%eax
+     2b7:	85 d2                	test   %edx,%edx
+     2b9:	74 0d                	je     2c8 <memchr+0x29>
+     2bb:	a8 03                	test   $0x3,%al
+     2bd:	74 09                	je     2c8 <memchr+0x29>
+    if(*s == c)
+     2bf:	0f b6 08             	movzbl (%eax),%ecx
+     2c2:	39 f1                	cmp    %esi,%ecx
+     2c4:	75 eb                	jne    2b1 <memchr+0x12>
+     2c6:	eb 41                	jmp    309 <memchr+0x6a>
+      return (void*)s;
+  rep = c * 0x01010101;
+     2c8:	69 fe 01 01 01 01    	imul   $0x1010101,%esi,%edi
+  for(; n >= 4; n -= 4, s += 4){
+     2ce:	eb 06                	jmp    2d6 <memchr+0x37>
+     2d0:	83 ea 04             	sub    $0x4,%edx
+     2d3:	83 c0 04             	add    $0x4,%eax
+     2d6:	83 fa 03             	cmp    $0x3,%edx
+     2d9:	76 16                	jbe    2f1 <memchr+0x52>
+    w = *(uint*)s ^ rep;
+     2db:	89 f9                	mov    %edi,%ecx
+     2dd:	33 08                	xor    (%eax),%ecx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     2df:	8d 99 ff fe fe fe    	lea    -0x1010101(%ecx),%ebx
+     2e5:	f7 d1                	not    %ecx
+     2e7:	21 cb                	and    %ecx,%ebx
+     2e9:	f7 c3 80 80 80 80    	test   $0x80808080,%ebx
+     2ef:	74 df                	je     2d0 <memchr+0x31>
+      break;
+  }
+  for(; n > 0; n--, s++)
+     2f1:	85 d2                	test   %edx,%edx
+     2f3:	74 0f                	je     304 <memchr+0x65>
+    if(*s == c)
+     2f5:	0f b6 08             	movzbl (%eax),%ecx
+     2f8:	39 f1                	cmp    %esi,%ecx
+     2fa:	74 0d                	je     309 <memchr+0x6a>
+  for(; n > 0; n--, s++)
+     2fc:	83 ea 01             	sub    $0x1,%edx
+     2ff:	83 c0 01             	add    $0x1,%eax
+     302:	eb ed                	jmp    2f1 <memchr+0x52>
+      return (void*)s;
+  return 0;
+     304:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     309:	5b                   	pop    %ebx
+     30a:	5e                   	pop    %esi
+     30b:	5f                   	pop    %edi
+     30c:	5d                   	pop    %ebp
+     30d:	c3                   	ret
+
+0000030e <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     30e:	55                   	push   %ebp
+     30f:	89 e5                	mov    %esp,%ebp
+     311:	57                   	push   %edi
+     312:	56                   	push   %esi
+     313:	53                   	push   %ebx
+     314:	83 ec 1c             	sub    $0x1c,%esp
+     317:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     31a:	bb 00 00 00 00       	mov    $0x0,%ebx
+     31f:	89 de                	mov    %ebx,%esi
+     321:	83 c3 01             	add    $0x1,%ebx
+     324:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     327:	7d 2e                	jge    357 <gets+0x49>
+    cc = read(0, &c, 1);
+     329:	83 ec 04             	sub    $0x4,%esp
+     32c:	6a 01                	push   $0x1
+     32e:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     331:	50                   	push   %eax
+     332:	6a 00                	push   $0x0
+     334:	e8 51 05 00 00       	call   88a <read>
+    if(cc < 1)
+     339:	83 c4 10             	add    $0x10,%esp
+     33c:	85 c0                	test   %eax,%eax
+     33e:	7e 17                	jle    357 <gets+0x49>
+      break;
+    buf[i++] = c;
+     340:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     344:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+     347:	3c 0a                	cmp    $0xa,%al
+     349:	0f 94 c2             	sete   %dl
+     34c:	3c 0d                	cmp    $0xd,%al
+     34e:	0f 94 c0             	sete   %al
+     351:	08 c2                	or     %al,%dl
+     353:	74 ca                	je     31f <gets+0x11>
+    buf[i++] = c;
+     355:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+     357:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+     35b:	89 f8                	mov    %edi,%eax
+     35d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     360:	5b                   	pop    %ebx
+     361:	5e                   	pop    %esi
+     362:	5f                   	pop    %edi
+     363:	5d                   	pop    %ebp
+     364:	c3                   	ret
+
+00000365 <atoi>:
+  return r;
+}
+
+int
+atoi(const char *s)
+{
+     365:	55                   	push   %ebp
+     366:	89 e5                	mov    %esp,%ebp
+     368:	53                   	push   %ebx
+     369:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+     36c:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+     371:	eb 10                	jmp    383 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+     373:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+     376:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+     379:	83 c1 01             	add    $0x1,%ecx
+     37c:	0f be c0             	movsbl %al,%eax
+     37f:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+     383:	0f b6 01             	movzbl (%ecx),%eax
+     386:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     389:	80 fb 09             	cmp    $0x9,%bl
+     38c:	76 e5                	jbe    373 <atoi+0xe>
+  return n;
+}
+     38e:	89 d0                	mov    %edx,%eax
+     390:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     393:	c9                   	leave
+     394:	c3                   	ret
+
+00000395 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     395:	55                   	push   %ebp
+     396:	89 e5                	mov    %esp,%ebp
+     398:	57                   	push   %edi
+     399:	56                   	push   %esi
+     39a:	53                   	push   %ebx
+     39b:	83 ec 08             	sub    $0x8,%esp
+     39e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     3a1:	8b 55 0c             	mov    0xc(%ebp),%edx
+     3a4:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *src;
+  int h;
+
+  dst = vdst;
+  src = vsrc;
+  if(n <= 0)
+     3a7:	85 c0                	test   %eax,%eax
+     3a9:	0f 8e 82 00 00 00    	jle    431 <memmove+0x9c>
+    return vdst;
+  if(src < dst && src + n > dst){
+     3af:	39 da                	cmp    %ebx,%edx
+     3b1:	73 07                	jae    3ba <memmove+0x25>
+     3b3:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+     3b6:	39 cb                	cmp    %ecx,%ebx
+     3b8:	72 5e                	jb     418 <memmove+0x83>
+    movsbback(dst + n - 1, src + n - 1, n);
+    return vdst;
+  }
+  if(n >= 16 && (((uint)dst ^ (uint)src) & 3) == 0){
+     3ba:	83 f8 0f             	cmp    $0xf,%eax
+     3bd:	7e 69                	jle    428 <memmove+0x93>
+     3bf:	89 d9                	mov    %ebx,%ecx
+     3c1:	31 d1                	xor    %edx,%ecx
+     3c3:	f6 c1 03             	test   $0x3,%cl
+     3c6:	75 73                	jne    43b <memmove+0xa6>
+    h = -(uint)dst & 3;
+     3c8:	89 d9                	mov    %ebx,%ecx
+     3ca:	f7 d9                	neg    %ecx
+     3cc:	83 e1 03             	and    $0x3,%ecx
+}
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsb" :
+     3cf:	89 df                	mov    %ebx,%edi
+     3d1:	89 d6                	mov    %edx,%esi
+     3d3:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+     3d6:	fc                   	cld
+     3d7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    movsb(dst, src, h);
+    dst += h, src += h, n -= h;
+     3d9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+     3dc:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+     3df:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+     3e2:	29 f0                	sub    %esi,%eax
+    movsl(dst, src, n/4);
+     3e4:	8d 50 03             	lea    0x3(%eax),%edx
+     3e7:	0f 49 d0             	cmovns %eax,%edx
+     3ea:	c1 fa 02             	sar    $0x2,%edx
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+     3ed:	89 7d f0             	mov    %edi,-0x10(%ebp)
+     3f0:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     3f3:	89 ce                	mov    %ecx,%esi
+     3f5:	89 d1                	mov    %edx,%ecx
+     3f7:	fc                   	cld
+     3f8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    dst += n/4*4, src += n/4*4, n %= 4;
+     3fa:	c1 e2 02             	shl    $0x2,%edx
+     3fd:	8b 7d f0             	mov    -0x10(%ebp),%edi
+     400:	01 d7                	add    %edx,%edi
+     402:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     405:	01 ca                	add    %ecx,%edx
+     407:	89 c6                	mov    %eax,%esi
+     409:	c1 fe 1f             	sar    $0x1f,%esi
+     40c:	c1 ee 1e             	shr    $0x1e,%esi
+     40f:	01 f0                	add    %esi,%eax
+     411:	83 e0 03             	and    $0x3,%eax
+     414:	29 f0                	sub    %esi,%eax
+     416:	eb 12                	jmp    42a <memmove+0x95>
+    movsbback(dst + n - 1, src + n - 1, n);
+     418:	8d 78 ff             	lea    -0x1(%eax),%edi
+     41b:	8d 34 3a             	lea    (%edx,%edi,1),%esi
+     41e:	01 df                	add    %ebx,%edi
+// Copy cnt bytes down from the last ones, at dst and src, to the
+// first: for overlapping moves up.
+static inline void
+movsbback(void *dst, const void *src, int cnt)
+{
+  asm volatile("std; rep movsb; cld" :
+     420:	89 c1                	mov    %eax,%ecx
+     422:	fd                   	std
+     423:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     425:	fc                   	cld
+    return vdst;
+     426:	eb 09                	jmp    431 <memmove+0x9c>
+  dst = vdst;
+     428:	89 df                	mov    %ebx,%edi
+  asm volatile("cld; rep movsb" :
+     42a:	89 d6                	mov    %edx,%esi
+     42c:	89 c1                	mov    %eax,%ecx
+     42e:	fc                   	cld
+     42f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  }
+  movsb(dst, src, n);
+  return vdst;
+}
+     431:	89 d8                	mov    %ebx,%eax
+     433:	83 c4 08             	add    $0x8,%esp
+     436:	5b                   	pop    %ebx
+     437:	5e                   	pop    %esi
+     438:	5f                   	pop    %edi
+     439:	5d                   	pop    %ebp
+     43a:	c3                   	ret
+  dst = vdst;
+     43b:	89 df                	mov    %ebx,%edi
+     43d:	eb eb                	jmp    42a <memmove+0x95>
+
+0000043f <vclock_gettime>:
+
+// clock_gettime() without a system call: read the clock page
+// that the kernel maps at CLOCKPAGE (see clock.h).
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+     43f:	55                   	push   %ebp
+     440:	89 e5                	mov    %esp,%ebp
+     442:	57                   	push   %edi
+     443:	56                   	push   %esi
+     444:	53                   	push   %ebx
+     445:	83 ec 14             	sub    $0x14,%esp
+  struct clockpage *cp = (struct clockpage*)CLOCKPAGE;
+  uint seq, rem, d;
+  uint64 tsc, ns, now;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+     448:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     44c:	0f 87 a3 00 00 00    	ja     4f5 <vclock_gettime+0xb6>
+    return -1;
+  do {
+    seq = cp->seq;
+     452:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+    __sync_synchronize();
+     457:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    tsc = cp->tsc;
+     45c:	8b 15 10 f0 ff 7f    	mov    0x7ffff010,%edx
+     462:	8b 1d 14 f0 ff 7f    	mov    0x7ffff014,%ebx
+    ns = cp->ns;
+     468:	8b 35 18 f0 ff 7f    	mov    0x7ffff018,%esi
+     46e:	8b 3d 1c f0 ff 7f    	mov    0x7ffff01c,%edi
+    __sync_synchronize();
+     474:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != cp->seq);
+     479:	89 c1                	mov    %eax,%ecx
+     47b:	83 e1 01             	and    $0x1,%ecx
+     47e:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     481:	75 cf                	jne    452 <vclock_gettime+0x13>
+     483:	8b 0d 00 f0 ff 7f    	mov    0x7ffff000,%ecx
+     489:	39 c1                	cmp    %eax,%ecx
+     48b:	75 c5                	jne    452 <vclock_gettime+0x13>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+     48d:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     490:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     493:	0f 31                	rdtsc
+     495:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     498:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     49b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  now = rdtsc();
+  // Less than a tick has passed since the update, so the delta
+  // fits in 32 bits.
+  d = now > tsc ? now - tsc : 0;
+     49e:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     4a1:	19 d3                	sbb    %edx,%ebx
+     4a3:	73 07                	jae    4ac <vclock_gettime+0x6d>
+     4a5:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+     4a8:	29 d8                	sub    %ebx,%eax
+     4aa:	89 c1                	mov    %eax,%ecx
+  ns += ((uint64)d * cp->mult) >> cp->shift;
+     4ac:	89 c8                	mov    %ecx,%eax
+     4ae:	f7 25 04 f0 ff 7f    	mull   0x7ffff004
+     4b4:	0f b6 0d 08 f0 ff 7f 	movzbl 0x7ffff008,%ecx
+     4bb:	0f ad d0             	shrd   %cl,%edx,%eax
+     4be:	d3 ea                	shr    %cl,%edx
+     4c0:	f6 c1 20             	test   $0x20,%cl
+     4c3:	74 04                	je     4c9 <vclock_gettime+0x8a>
+     4c5:	89 d0                	mov    %edx,%eax
+     4c7:	31 d2                	xor    %edx,%edx
+     4c9:	01 f0                	add    %esi,%eax
+     4cb:	11 fa                	adc    %edi,%edx
+static inline uint
+divl(uint64 n, uint d, uint *r)
+{
+  uint q;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (*r) :
+     4cd:	bb 00 ca 9a 3b       	mov    $0x3b9aca00,%ebx
+     4d2:	f7 f3                	div    %ebx
+  ts->tv_sec = divl(ns, 1000000000, &rem);
+     4d4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     4d7:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = rem;
+     4d9:	89 57 04             	mov    %edx,0x4(%edi)
+  if(clk == CLOCK_REALTIME)
+     4dc:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     4e0:	75 1a                	jne    4fc <vclock_gettime+0xbd>
+    ts->tv_sec += cp->boottime;
+     4e2:	03 05 0c f0 ff 7f    	add    0x7ffff00c,%eax
+     4e8:	89 07                	mov    %eax,(%edi)
+  return 0;
+     4ea:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     4ed:	83 c4 14             	add    $0x14,%esp
+     4f0:	5b                   	pop    %ebx
+     4f1:	5e                   	pop    %esi
+     4f2:	5f                   	pop    %edi
+     4f3:	5d                   	pop    %ebp
+     4f4:	c3                   	ret
+    return -1;
+     4f5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     4fa:	eb f1                	jmp    4ed <vclock_gettime+0xae>
+  return 0;
+     4fc:	b8 00 00 00 00       	mov    $0x0,%eax
+     501:	eb ea                	jmp    4ed <vclock_gettime+0xae>
+
+00000503 <flush>:
+
+// Write out fd's buffer, or with fd < 0 every buffer.
+// Returns -1 if a write fails.
+int
+flush(int fd)
+{
+     503:	55                   	push   %ebp
+     504:	89 e5                	mov    %esp,%ebp
+     506:	56                   	push   %esi
+     507:	53                   	push   %ebx
+     508:	8b 45 08             	mov    0x8(%ebp),%eax
+  int r, n;
+
+  if(fd < 0){
+     50b:	85 c0                	test   %eax,%eax
+     50d:	78 5d                	js     56c <flush+0x69>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+      if(flush(fd) < 0)
+        r = -1;
+    return r;
+  }
+  if(fd >= NOBUF || (n = obuf[fd].n) == 0)
+     50f:	83 f8 0f             	cmp    $0xf,%eax
+     512:	7f 64                	jg     578 <flush+0x75>
+     514:	69 d0 08 02 00 00    	imul   $0x208,%eax,%edx
+     51a:	8b b2 64 1a 00 00    	mov    0x1a64(%edx),%esi
+     520:	85 f6                	test   %esi,%esi
+     522:	74 59                	je     57d <flush+0x7a>
+    return 0;
+  obuf[fd].n = 0;
+     524:	c7 82 64 1a 00 00 00 	movl   $0x0,0x1a64(%edx)
+     52b:	00 00 00 
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     52e:	81 c2 68 1a 00 00    	add    $0x1a68,%edx
+     534:	83 ec 04             	sub    $0x4,%esp
+     537:	56                   	push   %esi
+     538:	52                   	push   %edx
+     539:	50                   	push   %eax
+     53a:	e8 5a 03 00 00       	call   899 <write>
+     53f:	83 c4 10             	add    $0x10,%esp
+     542:	39 f0                	cmp    %esi,%eax
+     544:	75 40                	jne    586 <flush+0x83>
+     546:	be 00 00 00 00       	mov    $0x0,%esi
+     54b:	eb 30                	jmp    57d <flush+0x7a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     54d:	83 c3 01             	add    $0x1,%ebx
+     550:	83 fb 0f             	cmp    $0xf,%ebx
+     553:	7f 28                	jg     57d <flush+0x7a>
+      if(flush(fd) < 0)
+     555:	83 ec 0c             	sub    $0xc,%esp
+     558:	53                   	push   %ebx
+     559:	e8 a5 ff ff ff       	call   503 <flush>
+     55e:	83 c4 10             	add    $0x10,%esp
+     561:	85 c0                	test   %eax,%eax
+     563:	79 e8                	jns    54d <flush+0x4a>
+        r = -1;
+     565:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     56a:	eb e1                	jmp    54d <flush+0x4a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     56c:	be 00 00 00 00       	mov    $0x0,%esi
+     571:	bb 00 00 00 00       	mov    $0x0,%ebx
+     576:	eb d8                	jmp    550 <flush+0x4d>
+    return 0;
+     578:	be 00 00 00 00       	mov    $0x0,%esi
+}
+     57d:	89 f0                	mov    %esi,%eax
+     57f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     582:	5b                   	pop    %ebx
+     583:	5e                   	pop    %esi
+     584:	5d                   	pop    %ebp
+     585:	c3                   	ret
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     586:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     58b:	eb f0                	jmp    57d <flush+0x7a>
+
+0000058d <bufreset>:
+
+static void
+bufreset(int fd)
+{
+  if(fd >= 0 && fd < NOBUF){
+     58d:	83 f8 0f             	cmp    $0xf,%eax
+     590:	76 01                	jbe    593 <bufreset+0x6>
+     592:	c3                   	ret
+{
+     593:	55                   	push   %ebp
+     594:	89 e5                	mov    %esp,%ebp
+     596:	53                   	push   %ebx
+     597:	83 ec 10             	sub    $0x10,%esp
+     59a:	89 c3                	mov    %eax,%ebx
+    flush(fd);
+     59c:	50                   	push   %eax
+     59d:	e8 61 ff ff ff       	call   503 <flush>
+    obuf[fd].mode = BUNKNOWN;
+     5a2:	69 db 08 02 00 00    	imul   $0x208,%ebx,%ebx
+     5a8:	c7 83 60 1a 00 00 00 	movl   $0x0,0x1a60(%ebx)
+     5af:	00 00 00 
+     5b2:	83 c4 10             	add    $0x10,%esp
+  }
+}
+     5b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5b8:	c9                   	leave
+     5b9:	c3                   	ret
+
+000005ba <bufwrite>:
+
+// Write n bytes from p to fd, through its buffer.
+// Returns n, or -1 if a write fails.
+int
+bufwrite(int fd, const void *p, int n)
+{
+     5ba:	55                   	push   %ebp
+     5bb:	89 e5                	mov    %esp,%ebp
+     5bd:	57                   	push   %edi
+     5be:	56                   	push   %esi
+     5bf:	53                   	push   %ebx
+     5c0:	83 ec 3c             	sub    $0x3c,%esp
+     5c3:	8b 75 08             	mov    0x8(%ebp),%esi
+     5c6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct stat st;
+  const char *s;
+  int i;
+
+  if(fd < 0 || fd >= NOBUF)
+     5c9:	83 fe 0f             	cmp    $0xf,%esi
+     5cc:	0f 87 a2 00 00 00    	ja     674 <bufwrite+0xba>
+    return write(fd, p, n);
+  if(obuf[fd].mode == BUNKNOWN){
+     5d2:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     5d8:	83 b8 60 1a 00 00 00 	cmpl   $0x0,0x1a60(%eax)
+     5df:	75 19                	jne    5fa <bufwrite+0x40>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     5e1:	83 fe 02             	cmp    $0x2,%esi
+     5e4:	0f 85 9c 00 00 00    	jne    686 <bufwrite+0xcc>
+      obuf[fd].mode = BNONE;
+     5ea:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     5f0:	c7 80 60 1a 00 00 01 	movl   $0x1,0x1a60(%eax)
+     5f7:	00 00 00 
+    else
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+  }
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     5fa:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     600:	89 da                	mov    %ebx,%edx
+     602:	03 90 64 1a 00 00    	add    0x1a64(%eax),%edx
+     608:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+     60e:	0f 8f ae 00 00 00    	jg     6c2 <bufwrite+0x108>
+    return -1;
+  if(n >= OBUFSZ)
+     614:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+     61a:	0f 8f bd 00 00 00    	jg     6dd <bufwrite+0x123>
+    return write(fd, p, n);
+  memmove(obuf[fd].buf + obuf[fd].n, p, n);
+     620:	69 d6 08 02 00 00    	imul   $0x208,%esi,%edx
+     626:	8d ba 60 1a 00 00    	lea    0x1a60(%edx),%edi
+     62c:	8b 82 64 1a 00 00    	mov    0x1a64(%edx),%eax
+     632:	83 ec 04             	sub    $0x4,%esp
+     635:	53                   	push   %ebx
+     636:	ff 75 0c             	push   0xc(%ebp)
+     639:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     63c:	8d 84 10 68 1a 00 00 	lea    0x1a68(%eax,%edx,1),%eax
+     643:	50                   	push   %eax
+     644:	e8 4c fd ff ff       	call   395 <memmove>
+  obuf[fd].n += n;
+     649:	01 5f 04             	add    %ebx,0x4(%edi)
+  if(obuf[fd].mode == BNONE)
+     64c:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     64f:	8b 82 60 1a 00 00    	mov    0x1a60(%edx),%eax
+     655:	83 c4 10             	add    $0x10,%esp
+     658:	83 f8 01             	cmp    $0x1,%eax
+     65b:	0f 84 91 00 00 00    	je     6f2 <bufwrite+0x138>
+    return flush(fd) < 0 ? -1 : n;
+  if(obuf[fd].mode == BLINE)
+     661:	83 f8 02             	cmp    $0x2,%eax
+     664:	0f 84 ca 00 00 00    	je     734 <bufwrite+0x17a>
+    for(s = p, i = 0; i < n; i++)
+      if(s[i] == '\n')
+        return flush(fd) < 0 ? -1 : n;
+  return n;
+     66a:	89 d8                	mov    %ebx,%eax
+}
+     66c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     66f:	5b                   	pop    %ebx
+     670:	5e                   	pop    %esi
+     671:	5f                   	pop    %edi
+     672:	5d                   	pop    %ebp
+     673:	c3                   	ret
+    return write(fd, p, n);
+     674:	83 ec 04             	sub    $0x4,%esp
+     677:	53                   	push   %ebx
+     678:	ff 75 0c             	push   0xc(%ebp)
+     67b:	56                   	push   %esi
+     67c:	e8 18 02 00 00       	call   899 <write>
+     681:	83 c4 10             	add    $0x10,%esp
+     684:	eb e6                	jmp    66c <bufwrite+0xb2>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     686:	83 ec 08             	sub    $0x8,%esp
+     689:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     68c:	50                   	push   %eax
+     68d:	56                   	push   %esi
+     68e:	e8 51 02 00 00       	call   8e4 <fstat>
+     693:	83 c4 10             	add    $0x10,%esp
+     696:	85 c0                	test   %eax,%eax
+     698:	0f 88 4c ff ff ff    	js     5ea <bufwrite+0x30>
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+     69e:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     6a3:	74 16                	je     6bb <bufwrite+0x101>
+     6a5:	ba 03 00 00 00       	mov    $0x3,%edx
+     6aa:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     6b0:	89 90 60 1a 00 00    	mov    %edx,0x1a60(%eax)
+     6b6:	e9 3f ff ff ff       	jmp    5fa <bufwrite+0x40>
+     6bb:	ba 02 00 00 00       	mov    $0x2,%edx
+     6c0:	eb e8                	jmp    6aa <bufwrite+0xf0>
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     6c2:	83 ec 0c             	sub    $0xc,%esp
+     6c5:	56                   	push   %esi
+     6c6:	e8 38 fe ff ff       	call   503 <flush>
+     6cb:	83 c4 10             	add    $0x10,%esp
+     6ce:	85 c0                	test   %eax,%eax
+     6d0:	0f 89 3e ff ff ff    	jns    614 <bufwrite+0x5a>
+    return -1;
+     6d6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     6db:	eb 8f                	jmp    66c <bufwrite+0xb2>
+    return write(fd, p, n);
+     6dd:	83 ec 04             	sub    $0x4,%esp
+     6e0:	53                   	push   %ebx
+     6e1:	ff 75 0c             	push   0xc(%ebp)
+     6e4:	56                   	push   %esi
+     6e5:	e8 af 01 00 00       	call   899 <write>
+     6ea:	83 c4 10             	add    $0x10,%esp
+     6ed:	e9 7a ff ff ff       	jmp    66c <bufwrite+0xb2>
+    return flush(fd) < 0 ? -1 : n;
+     6f2:	83 ec 0c             	sub    $0xc,%esp
+     6f5:	56                   	push   %esi
+     6f6:	e8 08 fe ff ff       	call   503 <flush>
+     6fb:	83 c4 10             	add    $0x10,%esp
+     6fe:	85 c0                	test   %eax,%eax
+     700:	78 07                	js     709 <bufwrite+0x14f>
+     702:	89 d8                	mov    %ebx,%eax
+     704:	e9 63 ff ff ff       	jmp    66c <bufwrite+0xb2>
+     709:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     70e:	e9 59 ff ff ff       	jmp    66c <bufwrite+0xb2>
+        return flush(fd) < 0 ? -1 : n;
+     713:	83 ec 0c             	sub    $0xc,%esp
+     716:	56                   	push   %esi
+     717:	e8 e7 fd ff ff       	call   503 <flush>
+     71c:	83 c4 10             	add    $0x10,%esp
+     71f:	85 c0                	test   %eax,%eax
+     721:	78 07                	js     72a <bufwrite+0x170>
+     723:	89 d8                	mov    %ebx,%eax
+     725:	e9 42 ff ff ff       	jmp    66c <bufwrite+0xb2>
+     72a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     72f:	e9 38 ff ff ff       	jmp    66c <bufwrite+0xb2>
+    for(s = p, i = 0; i < n; i++)
+     734:	b8 00 00 00 00       	mov    $0x0,%eax
+     739:	39 d8                	cmp    %ebx,%eax
+     73b:	7d 0e                	jge    74b <bufwrite+0x191>
+      if(s[i] == '\n')
+     73d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     740:	80 3c 01 0a          	cmpb   $0xa,(%ecx,%eax,1)
+     744:	74 cd                	je     713 <bufwrite+0x159>
+    for(s = p, i = 0; i < n; i++)
+     746:	83 c0 01             	add    $0x1,%eax
+     749:	eb ee                	jmp    739 <bufwrite+0x17f>
+  return n;
+     74b:	89 d8                	mov    %ebx,%eax
+     74d:	e9 1a ff ff ff       	jmp    66c <bufwrite+0xb2>
+
+00000752 <fork>:
+
+int
+fork(void)
+{
+     752:	55                   	push   %ebp
+     753:	89 e5                	mov    %esp,%ebp
+     755:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     758:	6a ff                	push   $0xffffffff
+     75a:	e8 a4 fd ff ff       	call   503 <flush>
+  return _fork();
+     75f:	e8 bd 00 00 00       	call   821 <_fork>
+}
+     764:	c9                   	leave
+     765:	c3                   	ret
+
+00000766 <exit>:
+
+int
+exit(void)
+{
+     766:	55                   	push   %ebp
+     767:	89 e5                	mov    %esp,%ebp
+     769:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     76c:	6a ff                	push   $0xffffffff
+     76e:	e8 90 fd ff ff       	call   503 <flush>
+  _exit();
+     773:	e8 b8 00 00 00       	call   830 <_exit>
+
+00000778 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     778:	55                   	push   %ebp
+     779:	89 e5                	mov    %esp,%ebp
+     77b:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     77e:	6a ff                	push   $0xffffffff
+     780:	e8 7e fd ff ff       	call   503 <flush>
+  return _exec(path, argv);
+     785:	83 c4 08             	add    $0x8,%esp
+     788:	ff 75 0c             	push   0xc(%ebp)
+     78b:	ff 75 08             	push   0x8(%ebp)
+     78e:	e8 bb 00 00 00       	call   84e <_exec>
+}
+     793:	c9                   	leave
+     794:	c3                   	ret
+
+00000795 <close>:
+
+int
+close(int fd)
+{
+     795:	55                   	push   %ebp
+     796:	89 e5                	mov    %esp,%ebp
+     798:	53                   	push   %ebx
+     799:	83 ec 04             	sub    $0x4,%esp
+     79c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bufreset(fd);
+     79f:	89 d8                	mov    %ebx,%eax
+     7a1:	e8 e7 fd ff ff       	call   58d <bufreset>
+  return _close(fd);
+     7a6:	83 ec 0c             	sub    $0xc,%esp
+     7a9:	53                   	push   %ebx
+     7aa:	e8 90 00 00 00       	call   83f <_close>
+}
+     7af:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7b2:	c9                   	leave
+     7b3:	c3                   	ret
+
+000007b4 <stat>:
+{
+     7b4:	55                   	push   %ebp
+     7b5:	89 e5                	mov    %esp,%ebp
+     7b7:	56                   	push   %esi
+     7b8:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     7b9:	83 ec 08             	sub    $0x8,%esp
+     7bc:	6a 00                	push   $0x0
+     7be:	ff 75 08             	push   0x8(%ebp)
+     7c1:	e8 f1 00 00 00       	call   8b7 <open>
+  if(fd < 0)
+     7c6:	83 c4 10             	add    $0x10,%esp
+     7c9:	85 c0                	test   %eax,%eax
+     7cb:	78 24                	js     7f1 <stat+0x3d>
+     7cd:	89 c3                	mov    %eax,%ebx
+  r = fstat(fd, st);
+     7cf:	83 ec 08             	sub    $0x8,%esp
+     7d2:	ff 75 0c             	push   0xc(%ebp)
+     7d5:	50                   	push   %eax
+     7d6:	e8 09 01 00 00       	call   8e4 <fstat>
+     7db:	89 c6                	mov    %eax,%esi
+  close(fd);
+     7dd:	89 1c 24             	mov    %ebx,(%esp)
+     7e0:	e8 b0 ff ff ff       	call   795 <close>
+  return r;
+     7e5:	83 c4 10             	add    $0x10,%esp
+}
+     7e8:	89 f0                	mov    %esi,%eax
+     7ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     7ed:	5b                   	pop    %ebx
+     7ee:	5e                   	pop    %esi
+     7ef:	5d                   	pop    %ebp
+     7f0:	c3                   	ret
+    return -1;
+     7f1:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     7f6:	eb f0                	jmp    7e8 <stat+0x34>
+
+000007f8 <dup2>:
+
+int
+dup2(int oldfd, int newfd)
+{
+     7f8:	55                   	push   %ebp
+     7f9:	89 e5                	mov    %esp,%ebp
+     7fb:	56                   	push   %esi
+     7fc:	53                   	push   %ebx
+     7fd:	8b 75 08             	mov    0x8(%ebp),%esi
+     800:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(oldfd != newfd)
+     803:	39 de                	cmp    %ebx,%esi
+     805:	75 11                	jne    818 <dup2+0x20>
+    bufreset(newfd);
+  return _dup2(oldfd, newfd);
+     807:	83 ec 08             	sub    $0x8,%esp
+     80a:	53                   	push   %ebx
+     80b:	56                   	push   %esi
+     80c:	e8 4c 00 00 00       	call   85d <_dup2>
+}
+     811:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     814:	5b                   	pop    %ebx
+     815:	5e                   	pop    %esi
+     816:	5d                   	pop    %ebp
+     817:	c3                   	ret
+    bufreset(newfd);
+     818:	89 d8                	mov    %ebx,%eax
+     81a:	e8 6e fd ff ff       	call   58d <bufreset>
+     81f:	eb e6                	jmp    807 <dup2+0xf>
+
+00000821 <_fork>:
+  1: ret
+
+#define SYSCALL(name) STUB(name, SYS_ ## name)
+
+# ulib.c wraps these, to flush printf()'s buffers first.
+STUB(_fork, SYS_fork)
+     821:	b8 01 00 00 00       	mov    $0x1,%eax
+     826:	89 e1                	mov    %esp,%ecx
+     828:	ba 2f 08 00 00       	mov    $0x82f,%edx
+     82d:	0f 34                	sysenter
+     82f:	c3                   	ret
+
+00000830 <_exit>:
+STUB(_exit, SYS_exit)
+     830:	b8 02 00 00 00       	mov    $0x2,%eax
+     835:	89 e1                	mov    %esp,%ecx
+     837:	ba 3e 08 00 00       	mov    $0x83e,%edx
+     83c:	0f 34                	sysenter
+     83e:	c3                   	ret
+
+0000083f <_close>:
+STUB(_close, SYS_close)
+     83f:	b8 15 00 00 00       	mov    $0x15,%eax
+     844:	89 e1                	mov    %esp,%ecx
+     846:	ba 4d 08 00 00       	mov    $0x84d,%edx
+     84b:	0f 34                	sysenter
+     84d:	c3                   	ret
+
+0000084e <_exec>:
+STUB(_exec, SYS_exec)
+     84e:	b8 07 00 00 00       	mov    $0x7,%eax
+     853:	89 e1                	mov    %esp,%ecx
+     855:	ba 5c 08 00 00       	mov    $0x85c,%edx
+     85a:	0f 34                	sysenter
+     85c:	c3                   	ret
+
+0000085d <_dup2>:
+STUB(_dup2, SYS_dup2)
+     85d:	b8 17 00 00 00       	mov    $0x17,%eax
+     862:	89 e1                	mov    %esp,%ecx
+     864:	ba 6b 08 00 00       	mov    $0x86b,%edx
+     869:	0f 34                	sysenter
+     86b:	c3                   	ret
+
+0000086c <wait>:
+
+SYSCALL(wait)
+     86c:	b8 03 00 00 00       	mov    $0x3,%eax
+     871:	89 e1                	mov    %esp,%ecx
+     873:	ba 7a 08 00 00       	mov    $0x87a,%edx
+     878:	0f 34                	sysenter
+     87a:	c3                   	ret
+
+0000087b <pipe>:
+SYSCALL(pipe)
+     87b:	b8 04 00 00 00       	mov    $0x4,%eax
+     880:	89 e1                	mov    %esp,%ecx
+     882:	ba 89 08 00 00       	mov    $0x889,%edx
+     887:	0f 34                	sysenter
+     889:	c3                   	ret
+
+0000088a <read>:
+SYSCALL(read)
+     88a:	b8 05 00 00 00       	mov    $0x5,%eax
+     88f:	89 e1                	mov    %esp,%ecx
+     891:	ba 98 08 00 00       	mov    $0x898,%edx
+     896:	0f 34                	sysenter
+     898:	c3                   	ret
+
+00000899 <write>:
+SYSCALL(write)
+     899:	b8 10 00 00 00       	mov    $0x10,%eax
+     89e:	89 e1                	mov    %esp,%ecx
+     8a0:	ba a7 08 00 00       	mov    $0x8a7,%edx
+     8a5:	0f 34                	sysenter
+     8a7:	c3                   	ret
+
+000008a8 <kill>:
+SYSCALL(kill)
+     8a8:	b8 06 00 00 00       	mov    $0x6,%eax
+     8ad:	89 e1                	mov    %esp,%ecx
+     8af:	ba b6 08 00 00       	mov    $0x8b6,%edx
+     8b4:	0f 34                	sysenter
+     8b6:	c3                   	ret
+
+000008b7 <open>:
+SYSCALL(open)
+     8b7:	b8 0f 00 00 00       	mov    $0xf,%eax
+     8bc:	89 e1                	mov    %esp,%ecx
+     8be:	ba c5 08 00 00       	mov    $0x8c5,%edx
+     8c3:	0f 34                	sysenter
+     8c5:	c3                   	ret
+
+000008c6 <mknod>:
+SYSCALL(mknod)
+     8c6:	b8 11 00 00 00       	mov    $0x11,%eax
+     8cb:	89 e1                	mov    %esp,%ecx
+     8cd:	ba d4 08 00 00       	mov    $0x8d4,%edx
+     8d2:	0f 34                	sysenter
+     8d4:	c3                   	ret
+
+000008d5 <unlink>:
+SYSCALL(unlink)
+     8d5:	b8 12 00 00 00       	mov    $0x12,%eax
+     8da:	89 e1                	mov    %esp,%ecx
+     8dc:	ba e3 08 00 00       	mov    $0x8e3,%edx
+     8e1:	0f 34                	sysenter
+     8e3:	c3                   	ret
+
+000008e4 <fstat>:
+SYSCALL(fstat)
+     8e4:	b8 08 00 00 00       	mov    $0x8,%eax
+     8e9:	89 e1                	mov    %esp,%ecx
+     8eb:	ba f2 08 00 00       	mov    $0x8f2,%edx
+     8f0:	0f 34                	sysenter
+     8f2:	c3                   	ret
+
+000008f3 <link>:
+SYSCALL(link)
+     8f3:	b8 13 00 00 00       	mov    $0x13,%eax
+     8f8:	89 e1                	mov    %esp,%ecx
+     8fa:	ba 01 09 00 00       	mov    $0x901,%edx
+     8ff:	0f 34                	sysenter
+     901:	c3                   	ret
+
+00000902 <mkdir>:
+SYSCALL(mkdir)
+     902:	b8 14 00 00 00       	mov    $0x14,%eax
+     907:	89 e1                	mov    %esp,%ecx
+     909:	ba 10 09 00 00       	mov    $0x910,%edx
+     90e:	0f 34                	sysenter
+     910:	c3                   	ret
+
+00000911 <chdir>:
+SYSCALL(chdir)
+     911:	b8 09 00 00 00       	mov    $0x9,%eax
+     916:	89 e1                	mov    %esp,%ecx
+     918:	ba 1f 09 00 00       	mov    $0x91f,%edx
+     91d:	0f 34                	sysenter
+     91f:	c3                   	ret
+
+00000920 <dup>:
+SYSCALL(dup)
+     920:	b8 0a 00 00 00       	mov    $0xa,%eax
+     925:	89 e1                	mov    %esp,%ecx
+     927:	ba 2e 09 00 00       	mov    $0x92e,%edx
+     92c:	0f 34                	sysenter
+     92e:	c3                   	ret
+
+0000092f <getpid>:
+SYSCALL(getpid)
+     92f:	b8 0b 00 00 00       	mov    $0xb,%eax
+     934:	89 e1                	mov    %esp,%ecx
+     936:	ba 3d 09 00 00       	mov    $0x93d,%edx
+     93b:	0f 34                	sysenter
+     93d:	c3                   	ret
+
+0000093e <sbrk>:
+SYSCALL(sbrk)
+     93e:	b8 0c 00 00 00       	mov    $0xc,%eax
+     943:	89 e1                	mov    %esp,%ecx
+     945:	ba 4c 09 00 00       	mov    $0x94c,%edx
+     94a:	0f 34                	sysenter
+     94c:	c3                   	ret
+
+0000094d <sleep>:
+SYSCALL(sleep)
+     94d:	b8 0d 00 00 00       	mov    $0xd,%eax
+     952:	89 e1                	mov    %esp,%ecx
+     954:	ba 5b 09 00 00       	mov    $0x95b,%edx
+     959:	0f 34                	sysenter
+     95b:	c3                   	ret
+
+0000095c <uptime>:
+SYSCALL(uptime)
+     95c:	b8 0e 00 00 00       	mov    $0xe,%eax
+     961:	89 e1                	mov    %esp,%ecx
+     963:	ba 6a 09 00 00       	mov    $0x96a,%edx
+     968:	0f 34                	sysenter
+     96a:	c3                   	ret
+
+0000096b <date>:
+SYSCALL(date)
+     96b:	b8 16 00 00 00       	mov    $0x16,%eax
+     970:	89 e1                	mov    %esp,%ecx
+     972:	ba 79 09 00 00       	mov    $0x979,%edx
+     977:	0f 34                	sysenter
+     979:	c3                   	ret
+
+0000097a <faultaround>:
+SYSCALL(faultaround)
+     97a:	b8 18 00 00 00       	mov    $0x18,%eax
+     97f:	89 e1                	mov    %esp,%ecx
+     981:	ba 88 09 00 00       	mov    $0x988,%edx
+     986:	0f 34                	sysenter
+     988:	c3                   	ret
+
+00000989 <faultstat>:
+SYSCALL(faultstat)
+     989:	b8 19 00 00 00       	mov    $0x19,%eax
+     98e:	89 e1                	mov    %esp,%ecx
+     990:	ba 97 09 00 00       	mov    $0x997,%edx
+     995:	0f 34                	sysenter
+     997:	c3                   	ret
+
+00000998 <mmap>:
+SYSCALL(mmap)
+     998:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     99d:	89 e1                	mov    %esp,%ecx
+     99f:	ba a6 09 00 00       	mov    $0x9a6,%edx
+     9a4:	0f 34                	sysenter
+     9a6:	c3                   	ret
+
+000009a7 <munmap>:
+SYSCALL(munmap)
+     9a7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     9ac:	89 e1                	mov    %esp,%ecx
+     9ae:	ba b5 09 00 00       	mov    $0x9b5,%edx
+     9b3:	0f 34                	sysenter
+     9b5:	c3                   	ret
+
+000009b6 <largepages>:
+SYSCALL(largepages)
+     9b6:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     9bb:	89 e1                	mov    %esp,%ecx
+     9bd:	ba c4 09 00 00       	mov    $0x9c4,%edx
+     9c2:	0f 34                	sysenter
+     9c4:	c3                   	ret
+
+000009c5 <spawn>:
+SYSCALL(spawn)
+     9c5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     9ca:	89 e1                	mov    %esp,%ecx
+     9cc:	ba d3 09 00 00       	mov    $0x9d3,%edx
+     9d1:	0f 34                	sysenter
+     9d3:	c3                   	ret
+
+000009d4 <setpriority>:
+SYSCALL(setpriority)
+     9d4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     9d9:	89 e1                	mov    %esp,%ecx
+     9db:	ba e2 09 00 00       	mov    $0x9e2,%edx
+     9e0:	0f 34                	sysenter
+     9e2:	c3                   	ret
+
+000009e3 <getpriority>:
+SYSCALL(getpriority)
+     9e3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     9e8:	89 e1                	mov    %esp,%ecx
+     9ea:	ba f1 09 00 00       	mov    $0x9f1,%edx
+     9ef:	0f 34                	sysenter
+     9f1:	c3                   	ret
+
+000009f2 <getprocinfo>:
+SYSCALL(getprocinfo)
+     9f2:	b8 20 00 00 00       	mov    $0x20,%eax
+     9f7:	89 e1                	mov    %esp,%ecx
+     9f9:	ba 00 0a 00 00       	mov    $0xa00,%edx
+     9fe:	0f 34                	sysenter
+     a00:	c3                   	ret
+
+00000a01 <getcpuinfo>:
+SYSCALL(getcpuinfo)
+     a01:	b8 21 00 00 00       	mov    $0x21,%eax
+     a06:	89 e1                	mov    %esp,%ecx
+     a08:	ba 0f 0a 00 00       	mov    $0xa0f,%edx
+     a0d:	0f 34                	sysenter
+     a0f:	c3                   	ret
+
+00000a10 <clone>:
+SYSCALL(clone)
+     a10:	b8 22 00 00 00       	mov    $0x22,%eax
+     a15:	89 e1                	mov    %esp,%ecx
+     a17:	ba 1e 0a 00 00       	mov    $0xa1e,%edx
+     a1c:	0f 34                	sysenter
+     a1e:	c3                   	ret
+
+00000a1f <join>:
+SYSCALL(join)
+     a1f:	b8 23 00 00 00       	mov    $0x23,%eax
+     a24:	89 e1                	mov    %esp,%ecx
+     a26:	ba 2d 0a 00 00       	mov    $0xa2d,%edx
+     a2b:	0f 34                	sysenter
+     a2d:	c3                   	ret
+
+00000a2e <futex_wait>:
+SYSCALL(futex_wait)
+     a2e:	b8 24 00 00 00       	mov    $0x24,%eax
+     a33:	89 e1                	mov    %esp,%ecx
+     a35:	ba 3c 0a 00 00       	mov    $0xa3c,%edx
+     a3a:	0f 34                	sysenter
+     a3c:	c3                   	ret
+
+00000a3d <futex_wake>:
+SYSCALL(futex_wake)
+     a3d:	b8 25 00 00 00       	mov    $0x25,%eax
+     a42:	89 e1                	mov    %esp,%ecx
+     a44:	ba 4b 0a 00 00       	mov    $0xa4b,%edx
+     a49:	0f 34                	sysenter
+     a4b:	c3                   	ret
+
+00000a4c <setaffinity>:
+SYSCALL(setaffinity)
+     a4c:	b8 26 00 00 00       	mov    $0x26,%eax
+     a51:	89 e1                	mov    %esp,%ecx
+     a53:	ba 5a 0a 00 00       	mov    $0xa5a,%edx
+     a58:	0f 34                	sysenter
+     a5a:	c3                   	ret
+
+00000a5b <getaffinity>:
+SYSCALL(getaffinity)
+     a5b:	b8 27 00 00 00       	mov    $0x27,%eax
+     a60:	89 e1                	mov    %esp,%ecx
+     a62:	ba 69 0a 00 00       	mov    $0xa69,%edx
+     a67:	0f 34                	sysenter
+     a69:	c3                   	ret
+
+00000a6a <clock_gettime>:
+SYSCALL(clock_gettime)
+     a6a:	b8 28 00 00 00       	mov    $0x28,%eax
+     a6f:	89 e1                	mov    %esp,%ecx
+     a71:	ba 78 0a 00 00       	mov    $0xa78,%edx
+     a76:	0f 34                	sysenter
+     a78:	c3                   	ret
+
+00000a79 <msleep>:
+SYSCALL(msleep)
+     a79:	b8 29 00 00 00       	mov    $0x29,%eax
+     a7e:	89 e1                	mov    %esp,%ecx
+     a80:	ba 87 0a 00 00       	mov    $0xa87,%edx
+     a85:	0f 34                	sysenter
+     a87:	c3                   	ret
+
+00000a88 <lockstat>:
+SYSCALL(lockstat)
+     a88:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     a8d:	89 e1                	mov    %esp,%ecx
+     a8f:	ba 96 0a 00 00       	mov    $0xa96,%edx
+     a94:	0f 34                	sysenter
+     a96:	c3                   	ret
+
+00000a97 <bstat>:
+SYSCALL(bstat)
+     a97:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     a9c:	89 e1                	mov    %esp,%ecx
+     a9e:	ba a5 0a 00 00       	mov    $0xaa5,%edx
+     aa3:	0f 34                	sysenter
+     aa5:	c3                   	ret
+
+00000aa6 <iostat>:
+SYSCALL(iostat)
+     aa6:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     aab:	89 e1                	mov    %esp,%ecx
+     aad:	ba b4 0a 00 00       	mov    $0xab4,%edx
+     ab2:	0f 34                	sysenter
+     ab4:	c3                   	ret
+
+00000ab5 <fsync>:
+SYSCALL(fsync)
+     ab5:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     aba:	89 e1                	mov    %esp,%ecx
+     abc:	ba c3 0a 00 00       	mov    $0xac3,%edx
+     ac1:	0f 34                	sysenter
+     ac3:	c3                   	ret
+
+00000ac4 <pread>:
+SYSCALL(pread)
+     ac4:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     ac9:	89 e1                	mov    %esp,%ecx
+     acb:	ba d2 0a 00 00       	mov    $0xad2,%edx
+     ad0:	0f 34                	sysenter
+     ad2:	c3                   	ret
+
+00000ad3 <pwrite>:
+SYSCALL(pwrite)
+     ad3:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     ad8:	89 e1                	mov    %esp,%ecx
+     ada:	ba e1 0a 00 00       	mov    $0xae1,%edx
+     adf:	0f 34                	sysenter
+     ae1:	c3                   	ret
+
+00000ae2 <readv>:
+SYSCALL(readv)
+     ae2:	b8 30 00 00 00       	mov    $0x30,%eax
+     ae7:	89 e1                	mov    %esp,%ecx
+     ae9:	ba f0 0a 00 00       	mov    $0xaf0,%edx
+     aee:	0f 34                	sysenter
+     af0:	c3                   	ret
+
+00000af1 <writev>:
+SYSCALL(writev)
+     af1:	b8 31 00 00 00       	mov    $0x31,%eax
+     af6:	89 e1                	mov    %esp,%ecx
+     af8:	ba ff 0a 00 00       	mov    $0xaff,%edx
+     afd:	0f 34                	sysenter
+     aff:	c3                   	ret
+
+00000b00 <sendfile>:
+SYSCALL(sendfile)
+     b00:	b8 32 00 00 00       	mov    $0x32,%eax
+     b05:	89 e1                	mov    %esp,%ecx
+     b07:	ba 0e 0b 00 00       	mov    $0xb0e,%edx
+     b0c:	0f 34                	sysenter
+     b0e:	c3                   	ret
+
+00000b0f <fcntl>:
+SYSCALL(fcntl)
+     b0f:	b8 33 00 00 00       	mov    $0x33,%eax
+     b14:	89 e1                	mov    %esp,%ecx
+     b16:	ba 1d 0b 00 00       	mov    $0xb1d,%edx
+     b1b:	0f 34                	sysenter
+     b1d:	c3                   	ret
+
+00000b1e <mount>:
+SYSCALL(mount)
+     b1e:	b8 34 00 00 00       	mov    $0x34,%eax
+     b23:	89 e1                	mov    %esp,%ecx
+     b25:	ba 2c 0b 00 00       	mov    $0xb2c,%edx
+     b2a:	0f 34                	sysenter
+     b2c:	c3                   	ret
+
+00000b2d <getdents>:
+SYSCALL(getdents)
+     b2d:	b8 35 00 00 00       	mov    $0x35,%eax
+     b32:	89 e1                	mov    %esp,%ecx
+     b34:	ba 3b 0b 00 00       	mov    $0xb3b,%edx
+     b39:	0f 34                	sysenter
+     b3b:	c3                   	ret
+
+00000b3c <fstatat>:
+SYSCALL(fstatat)
+     b3c:	b8 36 00 00 00       	mov    $0x36,%eax
+     b41:	89 e1                	mov    %esp,%ecx
+     b43:	ba 4a 0b 00 00       	mov    $0xb4a,%edx
+     b48:	0f 34                	sysenter
+     b4a:	c3                   	ret
+
+00000b4b <sysstat>:
+SYSCALL(sysstat)
+     b4b:	b8 37 00 00 00       	mov    $0x37,%eax
+     b50:	89 e1                	mov    %esp,%ecx
+     b52:	ba 59 0b 00 00       	mov    $0xb59,%edx
+     b57:	0f 34                	sysenter
+     b59:	c3                   	ret
+
+00000b5a <ringenter>:
+SYSCALL(ringenter)
+     b5a:	b8 38 00 00 00       	mov    $0x38,%eax
+     b5f:	89 e1                	mov    %esp,%ecx
+     b61:	ba 68 0b 00 00       	mov    $0xb68,%edx
+     b66:	0f 34                	sysenter
+     b68:	c3                   	ret
+
+00000b69 <trace>:
+SYSCALL(trace)
+     b69:	b8 39 00 00 00       	mov    $0x39,%eax
+     b6e:	89 e1                	mov    %esp,%ecx
+     b70:	ba 77 0b 00 00       	mov    $0xb77,%edx
+     b75:	0f 34                	sysenter
+     b77:	c3                   	ret
+
+00000b78 <memstat>:
+SYSCALL(memstat)
+     b78:	b8 3a 00 00 00       	mov    $0x3a,%eax
+     b7d:	89 e1                	mov    %esp,%ecx
+     b7f:	ba 86 0b 00 00       	mov    $0xb86,%edx
+     b84:	0f 34                	sysenter
+     b86:	c3                   	ret
+
+00000b87 <shmget>:
+SYSCALL(shmget)
+     b87:	b8 3b 00 00 00       	mov    $0x3b,%eax
+     b8c:	89 e1                	mov    %esp,%ecx
+     b8e:	ba 95 0b 00 00       	mov    $0xb95,%edx
+     b93:	0f 34                	sysenter
+     b95:	c3                   	ret
+
+00000b96 <shmat>:
+SYSCALL(shmat)
+     b96:	b8 3c 00 00 00       	mov    $0x3c,%eax
+     b9b:	89 e1                	mov    %esp,%ecx
+     b9d:	ba a4 0b 00 00       	mov    $0xba4,%edx
+     ba2:	0f 34                	sysenter
+     ba4:	c3                   	ret
+
+00000ba5 <shmdt>:
+SYSCALL(shmdt)
+     ba5:	b8 3d 00 00 00       	mov    $0x3d,%eax
+     baa:	89 e1                	mov    %esp,%ecx
+     bac:	ba b3 0b 00 00       	mov    $0xbb3,%edx
+     bb1:	0f 34                	sysenter
+     bb3:	c3                   	ret
+
+00000bb4 <irqstat>:
+SYSCALL(irqstat)
+     bb4:	b8 3e 00 00 00       	mov    $0x3e,%eax
+     bb9:	89 e1                	mov    %esp,%ecx
+     bbb:	ba c2 0b 00 00       	mov    $0xbc2,%edx
+     bc0:	0f 34                	sysenter
+     bc2:	c3                   	ret
+
+00000bc3 <irqroute>:
+SYSCALL(irqroute)
+     bc3:	b8 3f 00 00 00       	mov    $0x3f,%eax
+     bc8:	89 e1                	mov    %esp,%ecx
+     bca:	ba d1 0b 00 00       	mov    $0xbd1,%edx
+     bcf:	0f 34                	sysenter
+     bd1:	c3                   	ret
+
+00000bd2 <putc>:
+  char buf[64];
+};
+
+static void
+putc(struct out *o, char c)
+{
+     bd2:	55                   	push   %ebp
+     bd3:	89 e5                	mov    %esp,%ebp
+     bd5:	56                   	push   %esi
+     bd6:	53                   	push   %ebx
+     bd7:	89 c3                	mov    %eax,%ebx
+     bd9:	89 d6                	mov    %edx,%esi
+  if(o->n == sizeof(o->buf)){
+     bdb:	8b 40 04             	mov    0x4(%eax),%eax
+     bde:	83 f8 40             	cmp    $0x40,%eax
+     be1:	74 16                	je     bf9 <putc+0x27>
+    bufwrite(o->fd, o->buf, o->n);
+    o->n = 0;
+  }
+  o->buf[o->n++] = c;
+     be3:	8b 43 04             	mov    0x4(%ebx),%eax
+     be6:	8d 50 01             	lea    0x1(%eax),%edx
+     be9:	89 53 04             	mov    %edx,0x4(%ebx)
+     bec:	89 f1                	mov    %esi,%ecx
+     bee:	88 4c 03 08          	mov    %cl,0x8(%ebx,%eax,1)
+}
+     bf2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     bf5:	5b                   	pop    %ebx
+     bf6:	5e                   	pop    %esi
+     bf7:	5d                   	pop    %ebp
+     bf8:	c3                   	ret
+    bufwrite(o->fd, o->buf, o->n);
+     bf9:	8d 53 08             	lea    0x8(%ebx),%edx
+     bfc:	83 ec 04             	sub    $0x4,%esp
+     bff:	50                   	push   %eax
+     c00:	52                   	push   %edx
+     c01:	ff 33                	push   (%ebx)
+     c03:	e8 b2 f9 ff ff       	call   5ba <bufwrite>
+    o->n = 0;
+     c08:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     c0f:	83 c4 10             	add    $0x10,%esp
+     c12:	eb cf                	jmp    be3 <putc+0x11>
+
+00000c14 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     c14:	55                   	push   %ebp
+     c15:	89 e5                	mov    %esp,%ebp
+     c17:	57                   	push   %edi
+     c18:	56                   	push   %esi
+     c19:	53                   	push   %ebx
+     c1a:	83 ec 2c             	sub    $0x2c,%esp
+     c1d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     c20:	89 d0                	mov    %edx,%eax
+     c22:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+     c24:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     c28:	0f 95 c1             	setne  %cl
+     c2b:	c1 ea 1f             	shr    $0x1f,%edx
+     c2e:	84 d1                	test   %dl,%cl
+     c30:	74 44                	je     c76 <printint+0x62>
+    neg = 1;
+    x = -xx;
+     c32:	f7 d8                	neg    %eax
+     c34:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+     c36:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     c3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+     c42:	89 c8                	mov    %ecx,%eax
+     c44:	ba 00 00 00 00       	mov    $0x0,%edx
+     c49:	f7 f6                	div    %esi
+     c4b:	89 df                	mov    %ebx,%edi
+     c4d:	83 c3 01             	add    $0x1,%ebx
+     c50:	0f b6 92 88 13 00 00 	movzbl 0x1388(%edx),%edx
+     c57:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+     c5b:	89 ca                	mov    %ecx,%edx
+     c5d:	89 c1                	mov    %eax,%ecx
+     c5f:	39 f2                	cmp    %esi,%edx
+     c61:	73 df                	jae    c42 <printint+0x2e>
+  if(neg)
+     c63:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     c67:	74 31                	je     c9a <printint+0x86>
+    buf[i++] = '-';
+     c69:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+     c6e:	8d 5f 02             	lea    0x2(%edi),%ebx
+     c71:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     c74:	eb 17                	jmp    c8d <printint+0x79>
+    x = xx;
+     c76:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+     c78:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     c7f:	eb bc                	jmp    c3d <printint+0x29>
+
+  while(--i >= 0)
+    putc(o, buf[i]);
+     c81:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+     c86:	89 f0                	mov    %esi,%eax
+     c88:	e8 45 ff ff ff       	call   bd2 <putc>
+  while(--i >= 0)
+     c8d:	83 eb 01             	sub    $0x1,%ebx
+     c90:	79 ef                	jns    c81 <printint+0x6d>
+}
+     c92:	83 c4 2c             	add    $0x2c,%esp
+     c95:	5b                   	pop    %ebx
+     c96:	5e                   	pop    %esi
+     c97:	5f                   	pop    %edi
+     c98:	5d                   	pop    %ebp
+     c99:	c3                   	ret
+     c9a:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     c9d:	eb ee                	jmp    c8d <printint+0x79>
+
+00000c9f <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     c9f:	55                   	push   %ebp
+     ca0:	89 e5                	mov    %esp,%ebp
+     ca2:	57                   	push   %edi
+     ca3:	56                   	push   %esi
+     ca4:	53                   	push   %ebx
+     ca5:	83 ec 6c             	sub    $0x6c,%esp
+  int c, i, state;
+  uint *ap;
+  struct out out, *o;
+
+  o = &out;
+  o->fd = fd;
+     ca8:	8b 45 08             	mov    0x8(%ebp),%eax
+     cab:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  o->n = 0;
+     cae:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+     cb5:	8d 45 10             	lea    0x10(%ebp),%eax
+     cb8:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  state = 0;
+     cbb:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+     cc0:	bb 00 00 00 00       	mov    $0x0,%ebx
+     cc5:	eb 14                	jmp    cdb <printf+0x3c>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(o, c);
+     cc7:	89 fa                	mov    %edi,%edx
+     cc9:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     ccc:	e8 01 ff ff ff       	call   bd2 <putc>
+     cd1:	eb 05                	jmp    cd8 <printf+0x39>
+      }
+    } else if(state == '%'){
+     cd3:	83 fe 25             	cmp    $0x25,%esi
+     cd6:	74 25                	je     cfd <printf+0x5e>
+  for(i = 0; fmt[i]; i++){
+     cd8:	83 c3 01             	add    $0x1,%ebx
+     cdb:	8b 45 0c             	mov    0xc(%ebp),%eax
+     cde:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+     ce2:	84 c0                	test   %al,%al
+     ce4:	0f 84 20 01 00 00    	je     e0a <printf+0x16b>
+    c = fmt[i] & 0xff;
+     cea:	0f be f8             	movsbl %al,%edi
+     ced:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     cf0:	85 f6                	test   %esi,%esi
+     cf2:	75 df                	jne    cd3 <printf+0x34>
+      if(c == '%'){
+     cf4:	83 f8 25             	cmp    $0x25,%eax
+     cf7:	75 ce                	jne    cc7 <printf+0x28>
+        state = '%';
+     cf9:	89 c6                	mov    %eax,%esi
+     cfb:	eb db                	jmp    cd8 <printf+0x39>
+      if(c == 'd'){
+     cfd:	83 f8 25             	cmp    $0x25,%eax
+     d00:	0f 84 cf 00 00 00    	je     dd5 <printf+0x136>
+     d06:	0f 8c dd 00 00 00    	jl     de9 <printf+0x14a>
+     d0c:	83 f8 78             	cmp    $0x78,%eax
+     d0f:	0f 8f d4 00 00 00    	jg     de9 <printf+0x14a>
+     d15:	83 f8 63             	cmp    $0x63,%eax
+     d18:	0f 8c cb 00 00 00    	jl     de9 <printf+0x14a>
+     d1e:	83 e8 63             	sub    $0x63,%eax
+     d21:	83 f8 15             	cmp    $0x15,%eax
+     d24:	0f 87 bf 00 00 00    	ja     de9 <printf+0x14a>
+     d2a:	ff 24 85 30 13 00 00 	jmp    *0x1330(,%eax,4)
+        printint(o, *ap, 10, 1);
+     d31:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     d34:	8b 17                	mov    (%edi),%edx
+     d36:	83 ec 0c             	sub    $0xc,%esp
+     d39:	6a 01                	push   $0x1
+     d3b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     d40:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d43:	e8 cc fe ff ff       	call   c14 <printint>
+        ap++;
+     d48:	83 c7 04             	add    $0x4,%edi
+     d4b:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     d4e:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(o, '%');
+        putc(o, c);
+      }
+      state = 0;
+     d51:	be 00 00 00 00       	mov    $0x0,%esi
+     d56:	eb 80                	jmp    cd8 <printf+0x39>
+        printint(o, *ap, 16, 0);
+     d58:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     d5b:	8b 17                	mov    (%edi),%edx
+     d5d:	83 ec 0c             	sub    $0xc,%esp
+     d60:	6a 00                	push   $0x0
+     d62:	b9 10 00 00 00       	mov    $0x10,%ecx
+     d67:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d6a:	e8 a5 fe ff ff       	call   c14 <printint>
+        ap++;
+     d6f:	83 c7 04             	add    $0x4,%edi
+     d72:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     d75:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     d78:	be 00 00 00 00       	mov    $0x0,%esi
+     d7d:	e9 56 ff ff ff       	jmp    cd8 <printf+0x39>
+        s = (char*)*ap;
+     d82:	8b 45 94             	mov    -0x6c(%ebp),%eax
+     d85:	8b 30                	mov    (%eax),%esi
+        ap++;
+     d87:	83 c0 04             	add    $0x4,%eax
+     d8a:	89 45 94             	mov    %eax,-0x6c(%ebp)
+        if(s == 0)
+     d8d:	85 f6                	test   %esi,%esi
+     d8f:	75 15                	jne    da6 <printf+0x107>
+          s = "(null)";
+     d91:	be 29 13 00 00       	mov    $0x1329,%esi
+     d96:	eb 0e                	jmp    da6 <printf+0x107>
+          putc(o, *s);
+     d98:	0f be d2             	movsbl %dl,%edx
+     d9b:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d9e:	e8 2f fe ff ff       	call   bd2 <putc>
+          s++;
+     da3:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+     da6:	0f b6 16             	movzbl (%esi),%edx
+     da9:	84 d2                	test   %dl,%dl
+     dab:	75 eb                	jne    d98 <printf+0xf9>
+      state = 0;
+     dad:	be 00 00 00 00       	mov    $0x0,%esi
+     db2:	e9 21 ff ff ff       	jmp    cd8 <printf+0x39>
+        putc(o, *ap);
+     db7:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     dba:	0f be 17             	movsbl (%edi),%edx
+     dbd:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     dc0:	e8 0d fe ff ff       	call   bd2 <putc>
+        ap++;
+     dc5:	83 c7 04             	add    $0x4,%edi
+     dc8:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+      state = 0;
+     dcb:	be 00 00 00 00       	mov    $0x0,%esi
+     dd0:	e9 03 ff ff ff       	jmp    cd8 <printf+0x39>
+        putc(o, c);
+     dd5:	89 fa                	mov    %edi,%edx
+     dd7:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     dda:	e8 f3 fd ff ff       	call   bd2 <putc>
+      state = 0;
+     ddf:	be 00 00 00 00       	mov    $0x0,%esi
+     de4:	e9 ef fe ff ff       	jmp    cd8 <printf+0x39>
+        putc(o, '%');
+     de9:	ba 25 00 00 00       	mov    $0x25,%edx
+     dee:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     df1:	e8 dc fd ff ff       	call   bd2 <putc>
+        putc(o, c);
+     df6:	89 fa                	mov    %edi,%edx
+     df8:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     dfb:	e8 d2 fd ff ff       	call   bd2 <putc>
+      state = 0;
+     e00:	be 00 00 00 00       	mov    $0x0,%esi
+     e05:	e9 ce fe ff ff       	jmp    cd8 <printf+0x39>
+    }
+  }
+  if(o->n > 0)
+     e0a:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     e0d:	85 c0                	test   %eax,%eax
+     e0f:	7f 08                	jg     e19 <printf+0x17a>
+    bufwrite(fd, o->buf, o->n);
+}
+     e11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e14:	5b                   	pop    %ebx
+     e15:	5e                   	pop    %esi
+     e16:	5f                   	pop    %edi
+     e17:	5d                   	pop    %ebp
+     e18:	c3                   	ret
+    bufwrite(fd, o->buf, o->n);
+     e19:	83 ec 04             	sub    $0x4,%esp
+     e1c:	50                   	push   %eax
+     e1d:	8d 45 a8             	lea    -0x58(%ebp),%eax
+     e20:	50                   	push   %eax
+     e21:	ff 75 08             	push   0x8(%ebp)
+     e24:	e8 91 f7 ff ff       	call   5ba <bufwrite>
+     e29:	83 c4 10             	add    $0x10,%esp
+}
+     e2c:	eb e3                	jmp    e11 <printf+0x172>
+
+00000e2e <largefree>:
+  return &b->h;
+}
+
+static void
+largefree(Fblock *b)
+{
+     e2e:	55                   	push   %ebp
+     e2f:	89 e5                	mov    %esp,%ebp
+     e31:	57                   	push   %edi
+     e32:	56                   	push   %esi
+     e33:	53                   	push   %ebx
+     e34:	83 ec 0c             	sub    $0xc,%esp
+     e37:	89 c1                	mov    %eax,%ecx
+  Fblock **pp, *p, *prev;
+
+  prev = 0;
+     e39:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     e3e:	ba ec 3a 00 00       	mov    $0x3aec,%edx
+     e43:	eb 05                	jmp    e4a <largefree+0x1c>
+     e45:	8d 50 08             	lea    0x8(%eax),%edx
+    prev = p;
+     e48:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     e4a:	8b 02                	mov    (%edx),%eax
+     e4c:	85 c0                	test   %eax,%eax
+     e4e:	74 04                	je     e54 <largefree+0x26>
+     e50:	39 c8                	cmp    %ecx,%eax
+     e52:	72 f1                	jb     e45 <largefree+0x17>
+  b->next = p;
+     e54:	89 41 08             	mov    %eax,0x8(%ecx)
+  if(p && (char*)b + b->h.size == (char*)p){
+     e57:	85 c0                	test   %eax,%eax
+     e59:	74 09                	je     e64 <largefree+0x36>
+     e5b:	8b 31                	mov    (%ecx),%esi
+     e5d:	8d 3c 31             	lea    (%ecx,%esi,1),%edi
+     e60:	39 c7                	cmp    %eax,%edi
+     e62:	74 21                	je     e85 <largefree+0x57>
+    b->h.size += p->h.size;
+    b->next = p->next;
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+     e64:	85 db                	test   %ebx,%ebx
+     e66:	74 09                	je     e71 <largefree+0x43>
+     e68:	8b 03                	mov    (%ebx),%eax
+     e6a:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+     e6d:	39 ce                	cmp    %ecx,%esi
+     e6f:	74 20                	je     e91 <largefree+0x63>
+    prev->h.size += b->h.size;
+    prev->next = b->next;
+  } else
+    *pp = b;
+     e71:	89 0a                	mov    %ecx,(%edx)
+
+  // Give the top of the heap back.  With threads sharing the
+  // address space sbrk() cannot shrink it; keep the block then.
+  for(pp = &large; (*pp)->next; pp = &(*pp)->next)
+     e73:	be ec 3a 00 00       	mov    $0x3aec,%esi
+     e78:	8b 1e                	mov    (%esi),%ebx
+     e7a:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+     e7e:	74 1d                	je     e9d <largefree+0x6f>
+     e80:	8d 73 08             	lea    0x8(%ebx),%esi
+     e83:	eb f3                	jmp    e78 <largefree+0x4a>
+    b->h.size += p->h.size;
+     e85:	03 30                	add    (%eax),%esi
+     e87:	89 31                	mov    %esi,(%ecx)
+    b->next = p->next;
+     e89:	8b 40 08             	mov    0x8(%eax),%eax
+     e8c:	89 41 08             	mov    %eax,0x8(%ecx)
+     e8f:	eb d3                	jmp    e64 <largefree+0x36>
+    prev->h.size += b->h.size;
+     e91:	03 01                	add    (%ecx),%eax
+     e93:	89 03                	mov    %eax,(%ebx)
+    prev->next = b->next;
+     e95:	8b 41 08             	mov    0x8(%ecx),%eax
+     e98:	89 43 08             	mov    %eax,0x8(%ebx)
+     e9b:	eb d6                	jmp    e73 <largefree+0x45>
+    ;
+  b = *pp;
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     e9d:	89 df                	mov    %ebx,%edi
+     e9f:	03 3b                	add    (%ebx),%edi
+     ea1:	83 ec 0c             	sub    $0xc,%esp
+     ea4:	6a 00                	push   $0x0
+     ea6:	e8 93 fa ff ff       	call   93e <sbrk>
+     eab:	83 c4 10             	add    $0x10,%esp
+     eae:	39 c7                	cmp    %eax,%edi
+     eb0:	74 08                	je     eba <largefree+0x8c>
+    *pp = 0;
+}
+     eb2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     eb5:	5b                   	pop    %ebx
+     eb6:	5e                   	pop    %esi
+     eb7:	5f                   	pop    %edi
+     eb8:	5d                   	pop    %ebp
+     eb9:	c3                   	ret
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     eba:	8b 03                	mov    (%ebx),%eax
+     ebc:	f7 d8                	neg    %eax
+     ebe:	83 ec 0c             	sub    $0xc,%esp
+     ec1:	50                   	push   %eax
+     ec2:	e8 77 fa ff ff       	call   93e <sbrk>
+     ec7:	83 c4 10             	add    $0x10,%esp
+     eca:	83 f8 ff             	cmp    $0xffffffff,%eax
+     ecd:	74 e3                	je     eb2 <largefree+0x84>
+    *pp = 0;
+     ecf:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+     ed5:	eb db                	jmp    eb2 <largefree+0x84>
+
+00000ed7 <more>:
+{
+     ed7:	55                   	push   %ebp
+     ed8:	89 e5                	mov    %esp,%ebp
+     eda:	56                   	push   %esi
+     edb:	53                   	push   %ebx
+     edc:	89 c6                	mov    %eax,%esi
+  pad = -(uint)sbrk(0) & 7;
+     ede:	83 ec 0c             	sub    $0xc,%esp
+     ee1:	6a 00                	push   $0x0
+     ee3:	e8 56 fa ff ff       	call   93e <sbrk>
+     ee8:	f7 d8                	neg    %eax
+     eea:	89 c3                	mov    %eax,%ebx
+     eec:	83 e3 07             	and    $0x7,%ebx
+  if((p = sbrk(n + pad)) == (char*)-1)
+     eef:	01 de                	add    %ebx,%esi
+     ef1:	89 34 24             	mov    %esi,(%esp)
+     ef4:	e8 45 fa ff ff       	call   93e <sbrk>
+     ef9:	83 c4 10             	add    $0x10,%esp
+     efc:	83 f8 ff             	cmp    $0xffffffff,%eax
+     eff:	74 09                	je     f0a <more+0x33>
+  return p + pad;
+     f01:	01 d8                	add    %ebx,%eax
+}
+     f03:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f06:	5b                   	pop    %ebx
+     f07:	5e                   	pop    %esi
+     f08:	5d                   	pop    %ebp
+     f09:	c3                   	ret
+    return 0;
+     f0a:	b8 00 00 00 00       	mov    $0x0,%eax
+     f0f:	eb f2                	jmp    f03 <more+0x2c>
+
+00000f11 <slaballoc>:
+{
+     f11:	55                   	push   %ebp
+     f12:	89 e5                	mov    %esp,%ebp
+     f14:	56                   	push   %esi
+     f15:	53                   	push   %ebx
+     f16:	89 c6                	mov    %eax,%esi
+  n = 1 << (MINSHIFT + c);
+     f18:	8d 48 04             	lea    0x4(%eax),%ecx
+     f1b:	bb 01 00 00 00       	mov    $0x1,%ebx
+     f20:	d3 e3                	shl    %cl,%ebx
+  if(slab + n > slabend){
+     f22:	89 d8                	mov    %ebx,%eax
+     f24:	03 05 e8 3a 00 00    	add    0x3ae8,%eax
+     f2a:	39 05 e4 3a 00 00    	cmp    %eax,0x3ae4
+     f30:	72 17                	jb     f49 <slaballoc+0x38>
+  h = (Header*)slab;
+     f32:	a1 e8 3a 00 00       	mov    0x3ae8,%eax
+  slab += n;
+     f37:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+     f3a:	89 15 e8 3a 00 00    	mov    %edx,0x3ae8
+  h->size = n;
+     f40:	89 18                	mov    %ebx,(%eax)
+  h->class = c;
+     f42:	89 70 04             	mov    %esi,0x4(%eax)
+}
+     f45:	5b                   	pop    %ebx
+     f46:	5e                   	pop    %esi
+     f47:	5d                   	pop    %ebp
+     f48:	c3                   	ret
+    if((p = more(SLABSZ)) == 0)
+     f49:	b8 00 40 00 00       	mov    $0x4000,%eax
+     f4e:	e8 84 ff ff ff       	call   ed7 <more>
+     f53:	85 c0                	test   %eax,%eax
+     f55:	74 ee                	je     f45 <slaballoc+0x34>
+    if(p != slabend)
+     f57:	39 05 e4 3a 00 00    	cmp    %eax,0x3ae4
+     f5d:	74 05                	je     f64 <slaballoc+0x53>
+      slab = p;
+     f5f:	a3 e8 3a 00 00       	mov    %eax,0x3ae8
+    slabend = p + SLABSZ;
+     f64:	05 00 40 00 00       	add    $0x4000,%eax
+     f69:	a3 e4 3a 00 00       	mov    %eax,0x3ae4
+     f6e:	eb c2                	jmp    f32 <slaballoc+0x21>
+
+00000f70 <largealloc>:
+{
+     f70:	55                   	push   %ebp
+     f71:	89 e5                	mov    %esp,%ebp
+     f73:	56                   	push   %esi
+     f74:	53                   	push   %ebx
+     f75:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     f77:	b9 ec 3a 00 00       	mov    $0x3aec,%ecx
+     f7c:	8b 01                	mov    (%ecx),%eax
+     f7e:	85 c0                	test   %eax,%eax
+     f80:	74 36                	je     fb8 <largealloc+0x48>
+    if(b->h.size < n)
+     f82:	8b 10                	mov    (%eax),%edx
+     f84:	39 da                	cmp    %ebx,%edx
+     f86:	72 24                	jb     fac <largealloc+0x3c>
+    if(b->h.size - n > SMALLMAX){
+     f88:	29 da                	sub    %ebx,%edx
+     f8a:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+     f90:	76 1f                	jbe    fb1 <largealloc+0x41>
+      rest = (Fblock*)((char*)b + n);
+     f92:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+      rest->h.size = b->h.size - n;
+     f95:	89 16                	mov    %edx,(%esi)
+      rest->h.class = LARGE;
+     f97:	c7 46 04 09 00 00 00 	movl   $0x9,0x4(%esi)
+      rest->next = b->next;
+     f9e:	8b 50 08             	mov    0x8(%eax),%edx
+     fa1:	89 56 08             	mov    %edx,0x8(%esi)
+      *pp = rest;
+     fa4:	89 31                	mov    %esi,(%ecx)
+      b->h.size = n;
+     fa6:	89 18                	mov    %ebx,(%eax)
+}
+     fa8:	5b                   	pop    %ebx
+     fa9:	5e                   	pop    %esi
+     faa:	5d                   	pop    %ebp
+     fab:	c3                   	ret
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     fac:	8d 48 08             	lea    0x8(%eax),%ecx
+     faf:	eb cb                	jmp    f7c <largealloc+0xc>
+      *pp = b->next;
+     fb1:	8b 50 08             	mov    0x8(%eax),%edx
+     fb4:	89 11                	mov    %edx,(%ecx)
+    return &b->h;
+     fb6:	eb f0                	jmp    fa8 <largealloc+0x38>
+  if((b = more(n)) == 0)
+     fb8:	89 d8                	mov    %ebx,%eax
+     fba:	e8 18 ff ff ff       	call   ed7 <more>
+     fbf:	85 c0                	test   %eax,%eax
+     fc1:	74 e5                	je     fa8 <largealloc+0x38>
+  b->h.size = n;
+     fc3:	89 18                	mov    %ebx,(%eax)
+  b->h.class = LARGE;
+     fc5:	c7 40 04 09 00 00 00 	movl   $0x9,0x4(%eax)
+  return &b->h;
+     fcc:	eb da                	jmp    fa8 <largealloc+0x38>
+
+00000fce <free>:
+
+void
+free(void *ap)
+{
+     fce:	55                   	push   %ebp
+     fcf:	89 e5                	mov    %esp,%ebp
+     fd1:	56                   	push   %esi
+     fd2:	53                   	push   %ebx
+     fd3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+
+  if(ap == 0)
+     fd6:	85 db                	test   %ebx,%ebx
+     fd8:	74 3b                	je     1015 <free+0x47>
+    return;
+  h = (Header*)ap - 1;
+     fda:	8d 73 f8             	lea    -0x8(%ebx),%esi
+  lock_acquire(&lock);
+     fdd:	83 ec 0c             	sub    $0xc,%esp
+     fe0:	68 e0 3a 00 00       	push   $0x3ae0
+     fe5:	e8 9c 01 00 00       	call   1186 <lock_acquire>
+  if(h->class == LARGE)
+     fea:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     fed:	83 c4 10             	add    $0x10,%esp
+     ff0:	83 f8 09             	cmp    $0x9,%eax
+     ff3:	74 27                	je     101c <free+0x4e>
+    largefree((Fblock*)h);
+  else {
+    ((Fblock*)h)->next = freelist[h->class];
+     ff5:	8b 14 85 00 3b 00 00 	mov    0x3b00(,%eax,4),%edx
+     ffc:	89 13                	mov    %edx,(%ebx)
+    freelist[h->class] = (Fblock*)h;
+     ffe:	89 34 85 00 3b 00 00 	mov    %esi,0x3b00(,%eax,4)
+  }
+  lock_release(&lock);
+    1005:	83 ec 0c             	sub    $0xc,%esp
+    1008:	68 e0 3a 00 00       	push   $0x3ae0
+    100d:	e8 88 01 00 00       	call   119a <lock_release>
+    1012:	83 c4 10             	add    $0x10,%esp
+}
+    1015:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1018:	5b                   	pop    %ebx
+    1019:	5e                   	pop    %esi
+    101a:	5d                   	pop    %ebp
+    101b:	c3                   	ret
+    largefree((Fblock*)h);
+    101c:	89 f0                	mov    %esi,%eax
+    101e:	e8 0b fe ff ff       	call   e2e <largefree>
+    1023:	eb e0                	jmp    1005 <free+0x37>
+
+00001025 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    1025:	55                   	push   %ebp
+    1026:	89 e5                	mov    %esp,%ebp
+    1028:	53                   	push   %ebx
+    1029:	83 ec 04             	sub    $0x4,%esp
+    102c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+  uint n;
+  int c;
+
+  if(nbytes > 0x7fffffff - sizeof(Header) - 7)
+    102f:	81 fb f0 ff ff 7f    	cmp    $0x7ffffff0,%ebx
+    1035:	0f 87 8b 00 00 00    	ja     10c6 <malloc+0xa1>
+    return 0;
+  n = (nbytes + sizeof(Header) + 7) & ~7;
+    103b:	83 c3 0f             	add    $0xf,%ebx
+    103e:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(n < sizeof(Fblock))
+    1041:	83 fb 0b             	cmp    $0xb,%ebx
+    1044:	77 05                	ja     104b <malloc+0x26>
+    n = sizeof(Fblock);
+    1046:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  lock_acquire(&lock);
+    104b:	83 ec 0c             	sub    $0xc,%esp
+    104e:	68 e0 3a 00 00       	push   $0x3ae0
+    1053:	e8 2e 01 00 00       	call   1186 <lock_acquire>
+  if(n <= SMALLMAX){
+    1058:	83 c4 10             	add    $0x10,%esp
+    105b:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+    1061:	77 58                	ja     10bb <malloc+0x96>
+    for(c = 0; (1 << (MINSHIFT + c)) < n; c++)
+    1063:	ba 00 00 00 00       	mov    $0x0,%edx
+    1068:	eb 03                	jmp    106d <malloc+0x48>
+    106a:	83 c2 01             	add    $0x1,%edx
+    106d:	8d 4a 04             	lea    0x4(%edx),%ecx
+    1070:	b8 01 00 00 00       	mov    $0x1,%eax
+    1075:	d3 e0                	shl    %cl,%eax
+    1077:	39 d8                	cmp    %ebx,%eax
+    1079:	72 ef                	jb     106a <malloc+0x45>
+      ;
+    if(freelist[c]){
+    107b:	8b 04 95 00 3b 00 00 	mov    0x3b00(,%edx,4),%eax
+    1082:	85 c0                	test   %eax,%eax
+    1084:	74 2a                	je     10b0 <malloc+0x8b>
+      h = &freelist[c]->h;
+    1086:	89 c3                	mov    %eax,%ebx
+      freelist[c] = freelist[c]->next;
+    1088:	8b 40 08             	mov    0x8(%eax),%eax
+    108b:	89 04 95 00 3b 00 00 	mov    %eax,0x3b00(,%edx,4)
+    } else
+      h = slaballoc(c);
+  } else
+    h = largealloc(n);
+  lock_release(&lock);
+    1092:	83 ec 0c             	sub    $0xc,%esp
+    1095:	68 e0 3a 00 00       	push   $0x3ae0
+    109a:	e8 fb 00 00 00       	call   119a <lock_release>
+  return h ? (void*)(h + 1) : 0;
+    109f:	83 c4 10             	add    $0x10,%esp
+    10a2:	85 db                	test   %ebx,%ebx
+    10a4:	74 03                	je     10a9 <malloc+0x84>
+    10a6:	83 c3 08             	add    $0x8,%ebx
+}
+    10a9:	89 d8                	mov    %ebx,%eax
+    10ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10ae:	c9                   	leave
+    10af:	c3                   	ret
+      h = slaballoc(c);
+    10b0:	89 d0                	mov    %edx,%eax
+    10b2:	e8 5a fe ff ff       	call   f11 <slaballoc>
+    10b7:	89 c3                	mov    %eax,%ebx
+    10b9:	eb d7                	jmp    1092 <malloc+0x6d>
+    h = largealloc(n);
+    10bb:	89 d8                	mov    %ebx,%eax
+    10bd:	e8 ae fe ff ff       	call   f70 <largealloc>
+    10c2:	89 c3                	mov    %eax,%ebx
+    10c4:	eb cc                	jmp    1092 <malloc+0x6d>
+    return 0;
+    10c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+    10cb:	eb dc                	jmp    10a9 <malloc+0x84>
+
+000010cd <tstart>:
+  void *arg;
+};
+
+static void
+tstart(void *a)
+{
+    10cd:	55                   	push   %ebp
+    10ce:	89 e5                	mov    %esp,%ebp
+    10d0:	83 ec 14             	sub    $0x14,%esp
+    10d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+    10d6:	ff 70 04             	push   0x4(%eax)
+    10d9:	ff 10                	call   *(%eax)
+  exit();
+    10db:	e8 86 f6 ff ff       	call   766 <exit>
+
+000010e0 <thread_create>:
+}
+
+// Run fn(arg) in a new thread.  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    10e0:	55                   	push   %ebp
+    10e1:	89 e5                	mov    %esp,%ebp
+    10e3:	56                   	push   %esi
+    10e4:	53                   	push   %ebx
+  struct tstart *t;
+  char *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    10e5:	83 ec 0c             	sub    $0xc,%esp
+    10e8:	68 00 10 00 00       	push   $0x1000
+    10ed:	e8 33 ff ff ff       	call   1025 <malloc>
+    10f2:	83 c4 10             	add    $0x10,%esp
+    10f5:	85 c0                	test   %eax,%eax
+    10f7:	74 42                	je     113b <thread_create+0x5b>
+    10f9:	89 c3                	mov    %eax,%ebx
+    return -1;
+  t = (struct tstart*)stack;
+  t->fn = fn;
+    10fb:	8b 45 08             	mov    0x8(%ebp),%eax
+    10fe:	89 03                	mov    %eax,(%ebx)
+  t->arg = arg;
+    1100:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1103:	89 43 04             	mov    %eax,0x4(%ebx)
+  if((pid = clone(tstart, stack + TSTACK, t)) < 0)
+    1106:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    110c:	83 ec 04             	sub    $0x4,%esp
+    110f:	53                   	push   %ebx
+    1110:	50                   	push   %eax
+    1111:	68 cd 10 00 00       	push   $0x10cd
+    1116:	e8 f5 f8 ff ff       	call   a10 <clone>
+    111b:	89 c6                	mov    %eax,%esi
+    111d:	83 c4 10             	add    $0x10,%esp
+    1120:	85 c0                	test   %eax,%eax
+    1122:	78 09                	js     112d <thread_create+0x4d>
+    free(stack);
+  return pid;
+}
+    1124:	89 f0                	mov    %esi,%eax
+    1126:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1129:	5b                   	pop    %ebx
+    112a:	5e                   	pop    %esi
+    112b:	5d                   	pop    %ebp
+    112c:	c3                   	ret
+    free(stack);
+    112d:	83 ec 0c             	sub    $0xc,%esp
+    1130:	53                   	push   %ebx
+    1131:	e8 98 fe ff ff       	call   fce <free>
+    1136:	83 c4 10             	add    $0x10,%esp
+    1139:	eb e9                	jmp    1124 <thread_create+0x44>
+    return -1;
+    113b:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1140:	eb e2                	jmp    1124 <thread_create+0x44>
+
+00001142 <thread_join>:
+
+// Wait for one of this process's threads to exit and free its
+// stack.  Returns its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+    1142:	55                   	push   %ebp
+    1143:	89 e5                	mov    %esp,%ebp
+    1145:	53                   	push   %ebx
+    1146:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    1149:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    114c:	50                   	push   %eax
+    114d:	e8 cd f8 ff ff       	call   a1f <join>
+    1152:	89 c3                	mov    %eax,%ebx
+    1154:	83 c4 10             	add    $0x10,%esp
+    1157:	85 c0                	test   %eax,%eax
+    1159:	79 07                	jns    1162 <thread_join+0x20>
+    free((char*)stack - TSTACK);
+  return pid;
+}
+    115b:	89 d8                	mov    %ebx,%eax
+    115d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1160:	c9                   	leave
+    1161:	c3                   	ret
+    free((char*)stack - TSTACK);
+    1162:	83 ec 0c             	sub    $0xc,%esp
+    1165:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1168:	2d 00 10 00 00       	sub    $0x1000,%eax
+    116d:	50                   	push   %eax
+    116e:	e8 5b fe ff ff       	call   fce <free>
+    1173:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    1176:	eb e3                	jmp    115b <thread_join+0x19>
+
+00001178 <lock_init>:
+
+void
+lock_init(lock_t *lk)
+{
+    1178:	55                   	push   %ebp
+    1179:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    117b:	8b 45 08             	mov    0x8(%ebp),%eax
+    117e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1184:	5d                   	pop    %ebp
+    1185:	c3                   	ret
+
+00001186 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+    1186:	55                   	push   %ebp
+    1187:	89 e5                	mov    %esp,%ebp
+    1189:	8b 55 08             	mov    0x8(%ebp),%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    118c:	b8 01 00 00 00       	mov    $0x1,%eax
+    1191:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    1194:	85 c0                	test   %eax,%eax
+    1196:	75 f4                	jne    118c <lock_acquire+0x6>
+    ;
+}
+    1198:	5d                   	pop    %ebp
+    1199:	c3                   	ret
+
+0000119a <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+    119a:	55                   	push   %ebp
+    119b:	89 e5                	mov    %esp,%ebp
+    119d:	8b 55 08             	mov    0x8(%ebp),%edx
+    11a0:	b8 00 00 00 00       	mov    $0x0,%eax
+    11a5:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    11a8:	5d                   	pop    %ebp
+    11a9:	c3                   	ret
+
+000011aa <mutex_init>:
+// Are Tricky": state is 0 when free, 1 when held, 2 when held and
+// others may be waiting.  Unlocking an uncontended mutex costs no
+// system call.
+void
+mutex_init(mutex_t *m)
+{
+    11aa:	55                   	push   %ebp
+    11ab:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    11ad:	8b 45 08             	mov    0x8(%ebp),%eax
+    11b0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    11b6:	5d                   	pop    %ebp
+    11b7:	c3                   	ret
+
+000011b8 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+    11b8:	55                   	push   %ebp
+    11b9:	89 e5                	mov    %esp,%ebp
+    11bb:	53                   	push   %ebx
+    11bc:	83 ec 04             	sub    $0x4,%esp
+    11bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    11c2:	b8 00 00 00 00       	mov    $0x0,%eax
+    11c7:	b9 01 00 00 00       	mov    $0x1,%ecx
+    11cc:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    11d0:	85 c0                	test   %eax,%eax
+    11d2:	74 29                	je     11fd <mutex_lock+0x45>
+    return;
+  if(c != 2)
+    11d4:	83 f8 02             	cmp    $0x2,%eax
+    11d7:	74 20                	je     11f9 <mutex_lock+0x41>
+    11d9:	b8 02 00 00 00       	mov    $0x2,%eax
+    11de:	f0 87 03             	lock xchg %eax,(%ebx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    11e1:	eb 16                	jmp    11f9 <mutex_lock+0x41>
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    11e3:	83 ec 08             	sub    $0x8,%esp
+    11e6:	6a 02                	push   $0x2
+    11e8:	53                   	push   %ebx
+    11e9:	e8 40 f8 ff ff       	call   a2e <futex_wait>
+  asm volatile("lock; xchgl %0, %1" :
+    11ee:	b8 02 00 00 00       	mov    $0x2,%eax
+    11f3:	f0 87 03             	lock xchg %eax,(%ebx)
+    11f6:	83 c4 10             	add    $0x10,%esp
+  while(c != 0){
+    11f9:	85 c0                	test   %eax,%eax
+    11fb:	75 e6                	jne    11e3 <mutex_lock+0x2b>
+    c = xchg(&m->state, 2);
+  }
+}
+    11fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1200:	c9                   	leave
+    1201:	c3                   	ret
+
+00001202 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+    1202:	55                   	push   %ebp
+    1203:	89 e5                	mov    %esp,%ebp
+    1205:	83 ec 08             	sub    $0x8,%esp
+    1208:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    120b:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    1210:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    1214:	83 fa 01             	cmp    $0x1,%edx
+    1217:	75 02                	jne    121b <mutex_unlock+0x19>
+    m->state = 0;
+    futex_wake(&m->state, 1);
+  }
+}
+    1219:	c9                   	leave
+    121a:	c3                   	ret
+    m->state = 0;
+    121b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+    1221:	83 ec 08             	sub    $0x8,%esp
+    1224:	6a 01                	push   $0x1
+    1226:	50                   	push   %eax
+    1227:	e8 11 f8 ff ff       	call   a3d <futex_wake>
+    122c:	83 c4 10             	add    $0x10,%esp
+}
+    122f:	eb e8                	jmp    1219 <mutex_unlock+0x17>
+
+00001231 <cond_init>:
+// Condition variable: waiters sleep on a sequence number that
+// every signal bumps, so a signal between the unlock and the
+// futex_wait() in cond_wait() is not lost.
+void
+cond_init(cond_t *c)
+{
+    1231:	55                   	push   %ebp
+    1232:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    1234:	8b 45 08             	mov    0x8(%ebp),%eax
+    1237:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    123d:	5d                   	pop    %ebp
+    123e:	c3                   	ret
+
+0000123f <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+    123f:	55                   	push   %ebp
+    1240:	89 e5                	mov    %esp,%ebp
+    1242:	57                   	push   %edi
+    1243:	56                   	push   %esi
+    1244:	53                   	push   %ebx
+    1245:	83 ec 18             	sub    $0x18,%esp
+    1248:	8b 75 08             	mov    0x8(%ebp),%esi
+    124b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    124e:	8b 3e                	mov    (%esi),%edi
+  mutex_unlock(m);
+    1250:	53                   	push   %ebx
+    1251:	e8 ac ff ff ff       	call   1202 <mutex_unlock>
+  futex_wait(&c->seq, seq);
+    1256:	83 c4 08             	add    $0x8,%esp
+    1259:	57                   	push   %edi
+    125a:	56                   	push   %esi
+    125b:	e8 ce f7 ff ff       	call   a2e <futex_wait>
+  // Others may be waiting for m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+    1260:	83 c4 10             	add    $0x10,%esp
+    1263:	eb 0e                	jmp    1273 <cond_wait+0x34>
+    futex_wait(&m->state, 2);
+    1265:	83 ec 08             	sub    $0x8,%esp
+    1268:	6a 02                	push   $0x2
+    126a:	53                   	push   %ebx
+    126b:	e8 be f7 ff ff       	call   a2e <futex_wait>
+    1270:	83 c4 10             	add    $0x10,%esp
+    1273:	b8 02 00 00 00       	mov    $0x2,%eax
+    1278:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    127b:	85 c0                	test   %eax,%eax
+    127d:	75 e6                	jne    1265 <cond_wait+0x26>
+}
+    127f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1282:	5b                   	pop    %ebx
+    1283:	5e                   	pop    %esi
+    1284:	5f                   	pop    %edi
+    1285:	5d                   	pop    %ebp
+    1286:	c3                   	ret
+
+00001287 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+    1287:	55                   	push   %ebp
+    1288:	89 e5                	mov    %esp,%ebp
+    128a:	83 ec 10             	sub    $0x10,%esp
+    128d:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    1290:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+    1294:	6a 01                	push   $0x1
+    1296:	50                   	push   %eax
+    1297:	e8 a1 f7 ff ff       	call   a3d <futex_wake>
+}
+    129c:	83 c4 10             	add    $0x10,%esp
+    129f:	c9                   	leave
+    12a0:	c3                   	ret
+
+000012a1 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+    12a1:	55                   	push   %ebp
+    12a2:	89 e5                	mov    %esp,%ebp
+    12a4:	83 ec 10             	sub    $0x10,%esp
+    12a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    12aa:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, NPROC);
+    12ae:	6a 40                	push   $0x40
+    12b0:	50                   	push   %eax
+    12b1:	e8 87 f7 ff ff       	call   a3d <futex_wake>
+}
+    12b6:	83 c4 10             	add    $0x10,%esp
+    12b9:	c9                   	leave
+    12ba:	c3                   	ret
@@ -15,6 +15,7 @@
 #define COM1    0x3f8
 
 static int uart;    // is there a uart?
+static int fifo;    // bytes the transmitter takes at once
 
 void
 uartinit(void)
@@ -37,6 +38,14 @@ uartinit(void)
     return;
   uart = 1;
 
+  // Turn the FIFO on if it is a 16550's, for 16 bytes per
+  // transmitter-empty interrupt.
+  outb(COM1+2, 0x07);
+  fifo = (inb(COM1+2) & 0xC0) == 0xC0 ? 16 : 1;
+  if(fifo == 1)
+    outb(COM1+2, 0);
+  outb(COM1+1, 0x03);    // Receive and transmitter-empty interrupts.
+
   // Acknowledge pre-existing interrupt conditions;
   // enable interrupts.
   inb(COM1+2);
@@ -60,6 +69,21 @@ uartputc(int c)
   outb(COM1+0, c);
 }
 
+// How many bytes uartsend() may write now.
+int
+uartroom(void)
+{
+  if(!uart || !(inb(COM1+5) & 0x20))
+    return 0;
+  return fifo;
+}
+
+void
+uartsend(int c)
+{
+  outb(COM1+0, c);
+}
+
 static int
 uartgetc(void)
 {
@@ -73,5 +97,7 @@ uartgetc(void)
 void
 uartintr(void)
 {
+  inb(COM1+2);    // Acknowledge a transmitter-empty interrupt.
   consoleintr(uartgetc);
+  consoletx();
 }
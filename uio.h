@@ -0,0 +1,6 @@
+// One buffer of a readv() or writev().
+
+struct iovec {
+  void *base;
+  uint len;
+};
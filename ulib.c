@@ -3,6 +3,8 @@
 #include "fcntl.h"
 #include "user.h"
 #include "x86.h"
+#include "memlayout.h"
+#include "clock.h"
 
 char*
 strcpy(char *s, const char *t)
@@ -26,17 +28,40 @@ strcmp(const char *p, const char *q)
 uint
 strlen(const char *s)
 {
-  int n;
+  const char *p;
+  uint w;
 
-  for(n = 0; s[n]; n++)
-    ;
-  return n;
+  for(p = s; (uint)p & 3; p++)
+    if(*p == 0)
+      return p - s;
+  // Then a word at a time, which never crosses into the next page:
+  // a word with a zero byte in it has one of these bits set.
+  for(;; p += 4){
+    w = *(uint*)p;
+    if((w - 0x01010101) & ~w & 0x80808080)
+      break;
+  }
+  while(*p)
+    p++;
+  return p - s;
 }
 
 void*
 memset(void *dst, int c, uint n)
 {
-  stosb(dst, c, n);
+  uint h;
+  char *d;
+
+  d = dst;
+  c &= 0xFF;
+  if(n >= 16){
+    h = -(uint)d & 3;
+    stosb(d, c, h);
+    stosl(d + h, (c<<24)|(c<<16)|(c<<8)|c, (n - h)/4);
+    d += h + (n - h)/4*4;
+    n = (n - h)%4;
+  }
+  stosb(d, c, n);
   return dst;
 }
 
@@ -49,6 +74,51 @@ strchr(const char *s, char c)
   return 0;
 }
 
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  // A word at a time while they agree.
+  if((((uint)s1 | (uint)s2) & 3) == 0)
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+      s1 += 4, s2 += 4;
+  while(n-- > 0){
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+  }
+  return 0;
+}
+
+// The first c in the n bytes at v, or 0.  Once aligned, a word at
+// a time, with the word's bytes that equal c turned into zeroes
+// and those looked for.
+void*
+memchr(const void *v, int c, uint n)
+{
+  const uchar *s;
+  uint w, rep;
+
+  s = v;
+  c = (uchar)c;
+  for(; n > 0 && ((uint)s & 3); n--, s++)
+    if(*s == c)
+      return (void*)s;
+  rep = c * 0x01010101;
+  for(; n >= 4; n -= 4, s += 4){
+    w = *(uint*)s ^ rep;
+    if((w - 0x01010101) & ~w & 0x80808080)
+      break;
+  }
+  for(; n > 0; n--, s++)
+    if(*s == c)
+      return (void*)s;
+  return 0;
+}
+
 char*
 gets(char *buf, int max)
 {
@@ -97,10 +167,170 @@ memmove(void *vdst, const void *vsrc, int n)
 {
   char *dst;
   const char *src;
+  int h;
 
   dst = vdst;
   src = vsrc;
-  while(n-- > 0)
-    *dst++ = *src++;
+  if(n <= 0)
+    return vdst;
+  if(src < dst && src + n > dst){
+    movsbback(dst + n - 1, src + n - 1, n);
+    return vdst;
+  }
+  if(n >= 16 && (((uint)dst ^ (uint)src) & 3) == 0){
+    h = -(uint)dst & 3;
+    movsb(dst, src, h);
+    dst += h, src += h, n -= h;
+    movsl(dst, src, n/4);
+    dst += n/4*4, src += n/4*4, n %= 4;
+  }
+  movsb(dst, src, n);
   return vdst;
 }
+
+// clock_gettime() without a system call: read the clock page
+// that the kernel maps at CLOCKPAGE (see clock.h).
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+  struct clockpage *cp = (struct clockpage*)CLOCKPAGE;
+  uint seq, rem, d;
+  uint64 tsc, ns, now;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+    return -1;
+  do {
+    seq = cp->seq;
+    __sync_synchronize();
+    tsc = cp->tsc;
+    ns = cp->ns;
+    __sync_synchronize();
+  } while((seq & 1) || seq != cp->seq);
+  now = rdtsc();
+  // Less than a tick has passed since the update, so the delta
+  // fits in 32 bits.
+  d = now > tsc ? now - tsc : 0;
+  ns += ((uint64)d * cp->mult) >> cp->shift;
+  ts->tv_sec = divl(ns, 1000000000, &rem);
+  ts->tv_nsec = rem;
+  if(clk == CLOCK_REALTIME)
+    ts->tv_sec += cp->boottime;
+  return 0;
+}
+
+// Buffered output, for printf() and bufwrite().  Each of the first
+// NOBUF fds has a buffer, whose mode is found out the first time it
+// is written through: the console (any device) is line buffered,
+// files and pipes fully buffered, and fd 2 goes out at the end of
+// every call.  fork(), exec() and exit() flush all the buffers
+// first, so output is neither doubled nor lost, and close() and
+// dup2() the buffer of the fd they take away.
+#define NOBUF   16
+#define OBUFSZ  512
+
+#define BUNKNOWN 0
+#define BNONE    1
+#define BLINE    2
+#define BFULL    3
+
+static struct {
+  int mode;
+  int n;
+  char buf[OBUFSZ];
+} obuf[NOBUF];
+
+// Write out fd's buffer, or with fd < 0 every buffer.
+// Returns -1 if a write fails.
+int
+flush(int fd)
+{
+  int r, n;
+
+  if(fd < 0){
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+      if(flush(fd) < 0)
+        r = -1;
+    return r;
+  }
+  if(fd >= NOBUF || (n = obuf[fd].n) == 0)
+    return 0;
+  obuf[fd].n = 0;
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+}
+
+static void
+bufreset(int fd)
+{
+  if(fd >= 0 && fd < NOBUF){
+    flush(fd);
+    obuf[fd].mode = BUNKNOWN;
+  }
+}
+
+// Write n bytes from p to fd, through its buffer.
+// Returns n, or -1 if a write fails.
+int
+bufwrite(int fd, const void *p, int n)
+{
+  struct stat st;
+  const char *s;
+  int i;
+
+  if(fd < 0 || fd >= NOBUF)
+    return write(fd, p, n);
+  if(obuf[fd].mode == BUNKNOWN){
+    if(fd == 2 || fstat(fd, &st) < 0)
+      obuf[fd].mode = BNONE;
+    else
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+  }
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+    return -1;
+  if(n >= OBUFSZ)
+    return write(fd, p, n);
+  memmove(obuf[fd].buf + obuf[fd].n, p, n);
+  obuf[fd].n += n;
+  if(obuf[fd].mode == BNONE)
+    return flush(fd) < 0 ? -1 : n;
+  if(obuf[fd].mode == BLINE)
+    for(s = p, i = 0; i < n; i++)
+      if(s[i] == '\n')
+        return flush(fd) < 0 ? -1 : n;
+  return n;
+}
+
+int
+fork(void)
+{
+  flush(-1);
+  return _fork();
+}
+
+int
+exit(void)
+{
+  flush(-1);
+  _exit();
+}
+
+int
+exec(char *path, char **argv)
+{
+  flush(-1);
+  return _exec(path, argv);
+}
+
+int
+close(int fd)
+{
+  bufreset(fd);
+  return _close(fd);
+}
+
+int
+dup2(int oldfd, int newfd)
+{
+  if(oldfd != newfd)
+    bufreset(newfd);
+  return _dup2(oldfd, newfd);
+}
@@ -3,88 +3,172 @@
 #include "user.h"
 #include "param.h"
 
-// Memory allocator by Kernighan and Ritchie,
-// The C programming Language, 2nd ed.  Section 8.7.
+// Memory allocator with size classes.
+//
+// Small blocks, of 16 to 4096 bytes with their header, come in
+// NCLASS power-of-two classes.  A freed small block goes on its
+// class's free list, to be taken again by the next malloc() of that
+// class; a new one is cut from the current slab, a run of memory
+// from sbrk() handed out by moving a pointer.  Neither takes a walk
+// down a list.  Larger blocks are sbrk()ed for each request, and go
+// on an address-ordered free list when freed, merged with their
+// neighbours; whatever free block ends at the break is given back to
+// the kernel with a negative sbrk().
 
-typedef long Align;
+#define NCLASS   9             // 16 .. 4096 bytes
+#define MINSHIFT 4
+#define SMALLMAX (1 << (MINSHIFT + NCLASS - 1))
+#define SLABSZ   16384
+#define LARGE    NCLASS
 
-union header {
-  struct {
-    union header *ptr;
-    uint size;
-  } s;
-  Align x;
-};
+typedef struct header {
+  uint size;                   // Bytes in the block, header included
+  uint class;                  // Its size class, or LARGE
+} Header;
 
-typedef union header Header;
+// A free block, its header and what follows it.
+typedef struct fblock {
+  Header h;
+  struct fblock *next;
+} Fblock;
 
-static Header base;
-static Header *freep;
+static Fblock *freelist[NCLASS];
+static Fblock *large;          // Free large blocks, by address
+static char *slab, *slabend;   // What is left of the current slab
+static lock_t lock;            // Threads (uthread.c) share the heap
 
-void
-free(void *ap)
+// n more bytes from sbrk(), 8-byte aligned.
+static void*
+more(uint n)
 {
-  Header *bp, *p;
-
-  bp = (Header*)ap - 1;
-  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
-    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
-      break;
-  if(bp + bp->s.size == p->s.ptr){
-    bp->s.size += p->s.ptr->s.size;
-    bp->s.ptr = p->s.ptr->s.ptr;
-  } else
-    bp->s.ptr = p->s.ptr;
-  if(p + p->s.size == bp){
-    p->s.size += bp->s.size;
-    p->s.ptr = bp->s.ptr;
-  } else
-    p->s.ptr = bp;
-  freep = p;
+  uint pad;
+  char *p;
+
+  pad = -(uint)sbrk(0) & 7;
+  if((p = sbrk(n + pad)) == (char*)-1)
+    return 0;
+  return p + pad;
 }
 
+// A new block of class c, from the slab.
 static Header*
-morecore(uint nu)
+slaballoc(int c)
 {
+  uint n;
   char *p;
-  Header *hp;
+  Header *h;
+
+  n = 1 << (MINSHIFT + c);
+  if(slab + n > slabend){
+    if((p = more(SLABSZ)) == 0)
+      return 0;
+    if(p != slabend)
+      slab = p;
+    slabend = p + SLABSZ;
+  }
+  h = (Header*)slab;
+  slab += n;
+  h->size = n;
+  h->class = c;
+  return h;
+}
+
+// A block of n bytes or more, from the large free list or sbrk().
+static Header*
+largealloc(uint n)
+{
+  Fblock **pp, *b, *rest;
 
-  if(nu < 4096)
-    nu = 4096;
-  p = sbrk(nu * sizeof(Header));
-  if(p == (char*)-1)
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+    if(b->h.size < n)
+      continue;
+    if(b->h.size - n > SMALLMAX){
+      rest = (Fblock*)((char*)b + n);
+      rest->h.size = b->h.size - n;
+      rest->h.class = LARGE;
+      rest->next = b->next;
+      *pp = rest;
+      b->h.size = n;
+    } else
+      *pp = b->next;
+    return &b->h;
+  }
+  if((b = more(n)) == 0)
     return 0;
-  hp = (Header*)p;
-  hp->s.size = nu;
-  free((void*)(hp + 1));
-  return freep;
+  b->h.size = n;
+  b->h.class = LARGE;
+  return &b->h;
 }
 
-void*
-malloc(uint nbytes)
+static void
+largefree(Fblock *b)
 {
-  Header *p, *prevp;
-  uint nunits;
+  Fblock **pp, *p, *prev;
 
-  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
-  if((prevp = freep) == 0){
-    base.s.ptr = freep = prevp = &base;
-    base.s.size = 0;
+  prev = 0;
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+    prev = p;
+  b->next = p;
+  if(p && (char*)b + b->h.size == (char*)p){
+    b->h.size += p->h.size;
+    b->next = p->next;
   }
-  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
-    if(p->s.size >= nunits){
-      if(p->s.size == nunits)
-        prevp->s.ptr = p->s.ptr;
-      else {
-        p->s.size -= nunits;
-        p += p->s.size;
-        p->s.size = nunits;
-      }
-      freep = prevp;
-      return (void*)(p + 1);
-    }
-    if(p == freep)
-      if((p = morecore(nunits)) == 0)
-        return 0;
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+    prev->h.size += b->h.size;
+    prev->next = b->next;
+  } else
+    *pp = b;
+
+  // Give the top of the heap back.  With threads sharing the
+  // address space sbrk() cannot shrink it; keep the block then.
+  for(pp = &large; (*pp)->next; pp = &(*pp)->next)
+    ;
+  b = *pp;
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+    *pp = 0;
+}
+
+void
+free(void *ap)
+{
+  Header *h;
+
+  if(ap == 0)
+    return;
+  h = (Header*)ap - 1;
+  lock_acquire(&lock);
+  if(h->class == LARGE)
+    largefree((Fblock*)h);
+  else {
+    ((Fblock*)h)->next = freelist[h->class];
+    freelist[h->class] = (Fblock*)h;
   }
+  lock_release(&lock);
+}
+
+void*
+malloc(uint nbytes)
+{
+  Header *h;
+  uint n;
+  int c;
+
+  if(nbytes > 0x7fffffff - sizeof(Header) - 7)
+    return 0;
+  n = (nbytes + sizeof(Header) + 7) & ~7;
+  if(n < sizeof(Fblock))
+    n = sizeof(Fblock);
+  lock_acquire(&lock);
+  if(n <= SMALLMAX){
+    for(c = 0; (1 << (MINSHIFT + c)) < n; c++)
+      ;
+    if(freelist[c]){
+      h = &freelist[c]->h;
+      freelist[c] = freelist[c]->next;
+    } else
+      h = slaballoc(c);
+  } else
+    h = largealloc(n);
+  lock_release(&lock);
+  return h ? (void*)(h + 1) : 0;
 }
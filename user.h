@@ -1,5 +1,17 @@
 struct stat;
 struct rtcdate;
+struct procinfo;
+struct cpuinfo;
+struct timespec;
+struct lockstat;
+struct bstat;
+struct iostat;
+struct iovec;
+struct dirent;
+struct memstat;
+struct syscount;
+struct ring;
+struct tracev;
 
 // system calls
 int fork(void);
@@ -25,11 +37,53 @@ int sleep(int);
 int uptime(void);
 int date(struct rtcdate*d);
 int dup2(int,int);
+int faultaround(int);
+int faultstat(int, uint*);
+void* mmap(void*, uint, int, int, int, int);
+int munmap(void*, uint);
+int largepages(int);
+int spawn(char*, char**, int*);
+int setpriority(int, int);
+int getpriority(int);
+int getprocinfo(int, struct procinfo*);
+int getcpuinfo(int, struct cpuinfo*);
+int clone(void(*)(void*), void*, void*);
+int join(void**);
+int futex_wait(volatile uint*, uint);
+int futex_wake(volatile uint*, int);
+int setaffinity(int, uint);
+int getaffinity(int);
+int clock_gettime(int, struct timespec*);
+int msleep(int);
+int lockstat(int, struct lockstat*);
+int bstat(struct bstat*);
+int iostat(char*, struct iostat*);
+int fsync(int);
+int pread(int, void*, int, int);
+int pwrite(int, const void*, int, int);
+int readv(int, struct iovec*, int);
+int writev(int, struct iovec*, int);
+int sendfile(int, int, int);
+int fcntl(int, int, int);
+int mount(char*, char*);
+int getdents(int, struct dirent*, int);
+int fstatat(int, char*, struct stat*);
+int sysstat(int, struct syscount*);
+int ringenter(struct ring*, int);
+int trace(int, int, struct tracev*, int);
+int memstat(struct memstat*);
+int shmget(int, int);
+void* shmat(int);
+int shmdt(void*);
+int irqstat(int, uint*);
+int irqroute(int, int);
 
 // ulib.c
 int stat(const char*, struct stat*);
 char* strcpy(char*, const char*);
 void *memmove(void*, const void*, int);
+int memcmp(const void*, const void*, uint);
+void* memchr(const void*, int, uint);
 char* strchr(const char*, char c);
 int strcmp(const char*, const char*);
 void printf(int, const char*, ...);
@@ -39,3 +93,34 @@ void* memset(void*, int, uint);
 void* malloc(uint);
 void free(void*);
 int atoi(const char*);
+int vclock_gettime(int, struct timespec*);
+int bufwrite(int, const void*, int);
+int flush(int);
+int _fork(void);
+int _exit(void) __attribute__((noreturn));
+int _exec(char*, char**);
+int _close(int);
+int _dup2(int, int);
+
+// uthread.c
+typedef struct {
+  volatile uint locked;
+} lock_t;
+int thread_create(void (*)(void*), void*);
+int thread_join(void);
+void lock_init(lock_t*);
+void lock_acquire(lock_t*);
+void lock_release(lock_t*);
+typedef struct {
+  volatile uint state;
+} mutex_t;
+typedef struct {
+  volatile uint seq;
+} cond_t;
+void mutex_init(mutex_t*);
+void mutex_lock(mutex_t*);
+void mutex_unlock(mutex_t*);
+void cond_init(cond_t*);
+void cond_wait(cond_t*, mutex_t*);
+void cond_signal(cond_t*);
+void cond_broadcast(cond_t*);
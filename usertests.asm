@@ -0,0 +1,17578 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <ringput>:
+  printf(1, "sysstat test OK\n");
+}
+
+static void
+ringput(struct ring *r, int op, int fd, void *addr, uint len, int off)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	57                   	push   %edi
+       4:	56                   	push   %esi
+       5:	53                   	push   %ebx
+       6:	83 ec 04             	sub    $0x4,%esp
+       9:	89 d6                	mov    %edx,%esi
+       b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  struct sqe *e = &r->sq[r->sqtail % NRING];
+       e:	8b 50 04             	mov    0x4(%eax),%edx
+      11:	89 d7                	mov    %edx,%edi
+      13:	83 e7 1f             	and    $0x1f,%edi
+
+  e->op = op;
+      16:	8d 1c 3f             	lea    (%edi,%edi,1),%ebx
+      19:	8d 0c 3b             	lea    (%ebx,%edi,1),%ecx
+      1c:	8d 0c c8             	lea    (%eax,%ecx,8),%ecx
+      1f:	89 71 10             	mov    %esi,0x10(%ecx)
+  e->fd = fd;
+      22:	8b 75 f0             	mov    -0x10(%ebp),%esi
+      25:	89 71 14             	mov    %esi,0x14(%ecx)
+  e->addr = (uint)addr;
+      28:	8b 75 08             	mov    0x8(%ebp),%esi
+      2b:	89 71 18             	mov    %esi,0x18(%ecx)
+  e->len = len;
+      2e:	8b 75 0c             	mov    0xc(%ebp),%esi
+      31:	89 71 1c             	mov    %esi,0x1c(%ecx)
+  e->off = off;
+      34:	8b 75 10             	mov    0x10(%ebp),%esi
+      37:	89 71 20             	mov    %esi,0x20(%ecx)
+  e->data = r->sqtail;
+      3a:	01 fb                	add    %edi,%ebx
+      3c:	89 54 d8 24          	mov    %edx,0x24(%eax,%ebx,8)
+  r->sqtail++;
+      40:	83 c2 01             	add    $0x1,%edx
+      43:	89 50 04             	mov    %edx,0x4(%eax)
+}
+      46:	83 c4 04             	add    $0x4,%esp
+      49:	5b                   	pop    %ebx
+      4a:	5e                   	pop    %esi
+      4b:	5f                   	pop    %edi
+      4c:	5d                   	pop    %ebp
+      4d:	c3                   	ret
+
+0000004e <bsstest>:
+
+// does unintialized data start out zero?
+char uninit[10000];
+void
+bsstest(void)
+{
+      4e:	55                   	push   %ebp
+      4f:	89 e5                	mov    %esp,%ebp
+      51:	83 ec 10             	sub    $0x10,%esp
+  int i;
+
+  printf(stdout, "bss test\n");
+      54:	68 30 ab 00 00       	push   $0xab30
+      59:	ff 35 a4 04 01 00    	push   0x104a4
+      5f:	e8 ad a4 00 00       	call   a511 <printf>
+  for(i = 0; i < sizeof(uninit); i++){
+      64:	83 c4 10             	add    $0x10,%esp
+      67:	b8 00 00 00 00       	mov    $0x0,%eax
+      6c:	3d 0f 27 00 00       	cmp    $0x270f,%eax
+      71:	77 26                	ja     99 <bsstest+0x4b>
+    if(uninit[i] != '\0'){
+      73:	80 b8 80 05 01 00 00 	cmpb   $0x0,0x10580(%eax)
+      7a:	75 05                	jne    81 <bsstest+0x33>
+  for(i = 0; i < sizeof(uninit); i++){
+      7c:	83 c0 01             	add    $0x1,%eax
+      7f:	eb eb                	jmp    6c <bsstest+0x1e>
+      printf(stdout, "bss test failed\n");
+      81:	83 ec 08             	sub    $0x8,%esp
+      84:	68 3a ab 00 00       	push   $0xab3a
+      89:	ff 35 a4 04 01 00    	push   0x104a4
+      8f:	e8 7d a4 00 00       	call   a511 <printf>
+      exit();
+      94:	e8 3f 9f 00 00       	call   9fd8 <exit>
+    }
+  }
+  printf(stdout, "bss test ok\n");
+      99:	83 ec 08             	sub    $0x8,%esp
+      9c:	68 4b ab 00 00       	push   $0xab4b
+      a1:	ff 35 a4 04 01 00    	push   0x104a4
+      a7:	e8 65 a4 00 00       	call   a511 <printf>
+}
+      ac:	83 c4 10             	add    $0x10,%esp
+      af:	c9                   	leave
+      b0:	c3                   	ret
+
+000000b1 <iputtest>:
+{
+      b1:	55                   	push   %ebp
+      b2:	89 e5                	mov    %esp,%ebp
+      b4:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+      b7:	68 05 ad 00 00       	push   $0xad05
+      bc:	ff 35 a4 04 01 00    	push   0x104a4
+      c2:	e8 4a a4 00 00       	call   a511 <printf>
+  if(mkdir("iputdir") < 0){
+      c7:	c7 04 24 71 ab 00 00 	movl   $0xab71,(%esp)
+      ce:	e8 a1 a0 00 00       	call   a174 <mkdir>
+      d3:	83 c4 10             	add    $0x10,%esp
+      d6:	85 c0                	test   %eax,%eax
+      d8:	78 54                	js     12e <iputtest+0x7d>
+  if(chdir("iputdir") < 0){
+      da:	83 ec 0c             	sub    $0xc,%esp
+      dd:	68 71 ab 00 00       	push   $0xab71
+      e2:	e8 9c a0 00 00       	call   a183 <chdir>
+      e7:	83 c4 10             	add    $0x10,%esp
+      ea:	85 c0                	test   %eax,%eax
+      ec:	78 58                	js     146 <iputtest+0x95>
+  if(unlink("../iputdir") < 0){
+      ee:	83 ec 0c             	sub    $0xc,%esp
+      f1:	68 6e ab 00 00       	push   $0xab6e
+      f6:	e8 4c a0 00 00       	call   a147 <unlink>
+      fb:	83 c4 10             	add    $0x10,%esp
+      fe:	85 c0                	test   %eax,%eax
+     100:	78 5c                	js     15e <iputtest+0xad>
+  if(chdir("/") < 0){
+     102:	83 ec 0c             	sub    $0xc,%esp
+     105:	68 93 ab 00 00       	push   $0xab93
+     10a:	e8 74 a0 00 00       	call   a183 <chdir>
+     10f:	83 c4 10             	add    $0x10,%esp
+     112:	85 c0                	test   %eax,%eax
+     114:	78 60                	js     176 <iputtest+0xc5>
+  printf(stdout, "iput test ok\n");
+     116:	83 ec 08             	sub    $0x8,%esp
+     119:	68 2e ad 00 00       	push   $0xad2e
+     11e:	ff 35 a4 04 01 00    	push   0x104a4
+     124:	e8 e8 a3 00 00       	call   a511 <printf>
+}
+     129:	83 c4 10             	add    $0x10,%esp
+     12c:	c9                   	leave
+     12d:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     12e:	83 ec 08             	sub    $0x8,%esp
+     131:	68 2d be 00 00       	push   $0xbe2d
+     136:	ff 35 a4 04 01 00    	push   0x104a4
+     13c:	e8 d0 a3 00 00       	call   a511 <printf>
+    exit();
+     141:	e8 92 9e 00 00       	call   9fd8 <exit>
+    printf(stdout, "chdir iputdir failed\n");
+     146:	83 ec 08             	sub    $0x8,%esp
+     149:	68 58 ab 00 00       	push   $0xab58
+     14e:	ff 35 a4 04 01 00    	push   0x104a4
+     154:	e8 b8 a3 00 00       	call   a511 <printf>
+    exit();
+     159:	e8 7a 9e 00 00       	call   9fd8 <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+     15e:	83 ec 08             	sub    $0x8,%esp
+     161:	68 79 ab 00 00       	push   $0xab79
+     166:	ff 35 a4 04 01 00    	push   0x104a4
+     16c:	e8 a0 a3 00 00       	call   a511 <printf>
+    exit();
+     171:	e8 62 9e 00 00       	call   9fd8 <exit>
+    printf(stdout, "chdir / failed\n");
+     176:	83 ec 08             	sub    $0x8,%esp
+     179:	68 95 ab 00 00       	push   $0xab95
+     17e:	ff 35 a4 04 01 00    	push   0x104a4
+     184:	e8 88 a3 00 00       	call   a511 <printf>
+    exit();
+     189:	e8 4a 9e 00 00       	call   9fd8 <exit>
+
+0000018e <rmdot>:
+{
+     18e:	55                   	push   %ebp
+     18f:	89 e5                	mov    %esp,%ebp
+     191:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+     194:	68 a5 ab 00 00       	push   $0xaba5
+     199:	6a 01                	push   $0x1
+     19b:	e8 71 a3 00 00       	call   a511 <printf>
+  if(mkdir("dots") != 0){
+     1a0:	c7 04 24 b1 ab 00 00 	movl   $0xabb1,(%esp)
+     1a7:	e8 c8 9f 00 00       	call   a174 <mkdir>
+     1ac:	83 c4 10             	add    $0x10,%esp
+     1af:	85 c0                	test   %eax,%eax
+     1b1:	0f 85 bc 00 00 00    	jne    273 <rmdot+0xe5>
+  if(chdir("dots") != 0){
+     1b7:	83 ec 0c             	sub    $0xc,%esp
+     1ba:	68 b1 ab 00 00       	push   $0xabb1
+     1bf:	e8 bf 9f 00 00       	call   a183 <chdir>
+     1c4:	83 c4 10             	add    $0x10,%esp
+     1c7:	85 c0                	test   %eax,%eax
+     1c9:	0f 85 b8 00 00 00    	jne    287 <rmdot+0xf9>
+  if(unlink(".") == 0){
+     1cf:	83 ec 0c             	sub    $0xc,%esp
+     1d2:	68 a9 c0 00 00       	push   $0xc0a9
+     1d7:	e8 6b 9f 00 00       	call   a147 <unlink>
+     1dc:	83 c4 10             	add    $0x10,%esp
+     1df:	85 c0                	test   %eax,%eax
+     1e1:	0f 84 b4 00 00 00    	je     29b <rmdot+0x10d>
+  if(unlink("..") == 0){
+     1e7:	83 ec 0c             	sub    $0xc,%esp
+     1ea:	68 a8 c0 00 00       	push   $0xc0a8
+     1ef:	e8 53 9f 00 00       	call   a147 <unlink>
+     1f4:	83 c4 10             	add    $0x10,%esp
+     1f7:	85 c0                	test   %eax,%eax
+     1f9:	0f 84 b0 00 00 00    	je     2af <rmdot+0x121>
+  if(chdir("/") != 0){
+     1ff:	83 ec 0c             	sub    $0xc,%esp
+     202:	68 93 ab 00 00       	push   $0xab93
+     207:	e8 77 9f 00 00       	call   a183 <chdir>
+     20c:	83 c4 10             	add    $0x10,%esp
+     20f:	85 c0                	test   %eax,%eax
+     211:	0f 85 ac 00 00 00    	jne    2c3 <rmdot+0x135>
+  if(unlink("dots/.") == 0){
+     217:	83 ec 0c             	sub    $0xc,%esp
+     21a:	68 f9 ab 00 00       	push   $0xabf9
+     21f:	e8 23 9f 00 00       	call   a147 <unlink>
+     224:	83 c4 10             	add    $0x10,%esp
+     227:	85 c0                	test   %eax,%eax
+     229:	0f 84 a8 00 00 00    	je     2d7 <rmdot+0x149>
+  if(unlink("dots/..") == 0){
+     22f:	83 ec 0c             	sub    $0xc,%esp
+     232:	68 17 ac 00 00       	push   $0xac17
+     237:	e8 0b 9f 00 00       	call   a147 <unlink>
+     23c:	83 c4 10             	add    $0x10,%esp
+     23f:	85 c0                	test   %eax,%eax
+     241:	0f 84 a4 00 00 00    	je     2eb <rmdot+0x15d>
+  if(unlink("dots") != 0){
+     247:	83 ec 0c             	sub    $0xc,%esp
+     24a:	68 b1 ab 00 00       	push   $0xabb1
+     24f:	e8 f3 9e 00 00       	call   a147 <unlink>
+     254:	83 c4 10             	add    $0x10,%esp
+     257:	85 c0                	test   %eax,%eax
+     259:	0f 85 a0 00 00 00    	jne    2ff <rmdot+0x171>
+  printf(1, "rmdot ok\n");
+     25f:	83 ec 08             	sub    $0x8,%esp
+     262:	68 4c ac 00 00       	push   $0xac4c
+     267:	6a 01                	push   $0x1
+     269:	e8 a3 a2 00 00       	call   a511 <printf>
+}
+     26e:	83 c4 10             	add    $0x10,%esp
+     271:	c9                   	leave
+     272:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+     273:	83 ec 08             	sub    $0x8,%esp
+     276:	68 b6 ab 00 00       	push   $0xabb6
+     27b:	6a 01                	push   $0x1
+     27d:	e8 8f a2 00 00       	call   a511 <printf>
+    exit();
+     282:	e8 51 9d 00 00       	call   9fd8 <exit>
+    printf(1, "chdir dots failed\n");
+     287:	83 ec 08             	sub    $0x8,%esp
+     28a:	68 c9 ab 00 00       	push   $0xabc9
+     28f:	6a 01                	push   $0x1
+     291:	e8 7b a2 00 00       	call   a511 <printf>
+    exit();
+     296:	e8 3d 9d 00 00       	call   9fd8 <exit>
+    printf(1, "rm . worked!\n");
+     29b:	83 ec 08             	sub    $0x8,%esp
+     29e:	68 dc ab 00 00       	push   $0xabdc
+     2a3:	6a 01                	push   $0x1
+     2a5:	e8 67 a2 00 00       	call   a511 <printf>
+    exit();
+     2aa:	e8 29 9d 00 00       	call   9fd8 <exit>
+    printf(1, "rm .. worked!\n");
+     2af:	83 ec 08             	sub    $0x8,%esp
+     2b2:	68 ea ab 00 00       	push   $0xabea
+     2b7:	6a 01                	push   $0x1
+     2b9:	e8 53 a2 00 00       	call   a511 <printf>
+    exit();
+     2be:	e8 15 9d 00 00       	call   9fd8 <exit>
+    printf(1, "chdir / failed\n");
+     2c3:	83 ec 08             	sub    $0x8,%esp
+     2c6:	68 95 ab 00 00       	push   $0xab95
+     2cb:	6a 01                	push   $0x1
+     2cd:	e8 3f a2 00 00       	call   a511 <printf>
+    exit();
+     2d2:	e8 01 9d 00 00       	call   9fd8 <exit>
+    printf(1, "unlink dots/. worked!\n");
+     2d7:	83 ec 08             	sub    $0x8,%esp
+     2da:	68 00 ac 00 00       	push   $0xac00
+     2df:	6a 01                	push   $0x1
+     2e1:	e8 2b a2 00 00       	call   a511 <printf>
+    exit();
+     2e6:	e8 ed 9c 00 00       	call   9fd8 <exit>
+    printf(1, "unlink dots/.. worked!\n");
+     2eb:	83 ec 08             	sub    $0x8,%esp
+     2ee:	68 1f ac 00 00       	push   $0xac1f
+     2f3:	6a 01                	push   $0x1
+     2f5:	e8 17 a2 00 00       	call   a511 <printf>
+    exit();
+     2fa:	e8 d9 9c 00 00       	call   9fd8 <exit>
+    printf(1, "unlink dots failed!\n");
+     2ff:	83 ec 08             	sub    $0x8,%esp
+     302:	68 37 ac 00 00       	push   $0xac37
+     307:	6a 01                	push   $0x1
+     309:	e8 03 a2 00 00       	call   a511 <printf>
+    exit();
+     30e:	e8 c5 9c 00 00       	call   9fd8 <exit>
+
+00000313 <exitiputtest>:
+{
+     313:	55                   	push   %ebp
+     314:	89 e5                	mov    %esp,%ebp
+     316:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exitiput test\n");
+     319:	68 56 ac 00 00       	push   $0xac56
+     31e:	ff 35 a4 04 01 00    	push   0x104a4
+     324:	e8 e8 a1 00 00       	call   a511 <printf>
+  pid = fork();
+     329:	e8 96 9c 00 00       	call   9fc4 <fork>
+  if(pid < 0){
+     32e:	83 c4 10             	add    $0x10,%esp
+     331:	85 c0                	test   %eax,%eax
+     333:	78 47                	js     37c <exitiputtest+0x69>
+  if(pid == 0){
+     335:	0f 85 a1 00 00 00    	jne    3dc <exitiputtest+0xc9>
+    if(mkdir("iputdir") < 0){
+     33b:	83 ec 0c             	sub    $0xc,%esp
+     33e:	68 71 ab 00 00       	push   $0xab71
+     343:	e8 2c 9e 00 00       	call   a174 <mkdir>
+     348:	83 c4 10             	add    $0x10,%esp
+     34b:	85 c0                	test   %eax,%eax
+     34d:	78 45                	js     394 <exitiputtest+0x81>
+    if(chdir("iputdir") < 0){
+     34f:	83 ec 0c             	sub    $0xc,%esp
+     352:	68 71 ab 00 00       	push   $0xab71
+     357:	e8 27 9e 00 00       	call   a183 <chdir>
+     35c:	83 c4 10             	add    $0x10,%esp
+     35f:	85 c0                	test   %eax,%eax
+     361:	78 49                	js     3ac <exitiputtest+0x99>
+    if(unlink("../iputdir") < 0){
+     363:	83 ec 0c             	sub    $0xc,%esp
+     366:	68 6e ab 00 00       	push   $0xab6e
+     36b:	e8 d7 9d 00 00       	call   a147 <unlink>
+     370:	83 c4 10             	add    $0x10,%esp
+     373:	85 c0                	test   %eax,%eax
+     375:	78 4d                	js     3c4 <exitiputtest+0xb1>
+    exit();
+     377:	e8 5c 9c 00 00       	call   9fd8 <exit>
+    printf(stdout, "fork failed\n");
+     37c:	83 ec 08             	sub    $0x8,%esp
+     37f:	68 b6 be 00 00       	push   $0xbeb6
+     384:	ff 35 a4 04 01 00    	push   0x104a4
+     38a:	e8 82 a1 00 00       	call   a511 <printf>
+    exit();
+     38f:	e8 44 9c 00 00       	call   9fd8 <exit>
+      printf(stdout, "mkdir failed\n");
+     394:	83 ec 08             	sub    $0x8,%esp
+     397:	68 2d be 00 00       	push   $0xbe2d
+     39c:	ff 35 a4 04 01 00    	push   0x104a4
+     3a2:	e8 6a a1 00 00       	call   a511 <printf>
+      exit();
+     3a7:	e8 2c 9c 00 00       	call   9fd8 <exit>
+      printf(stdout, "child chdir failed\n");
+     3ac:	83 ec 08             	sub    $0x8,%esp
+     3af:	68 65 ac 00 00       	push   $0xac65
+     3b4:	ff 35 a4 04 01 00    	push   0x104a4
+     3ba:	e8 52 a1 00 00       	call   a511 <printf>
+      exit();
+     3bf:	e8 14 9c 00 00       	call   9fd8 <exit>
+      printf(stdout, "unlink ../iputdir failed\n");
+     3c4:	83 ec 08             	sub    $0x8,%esp
+     3c7:	68 79 ab 00 00       	push   $0xab79
+     3cc:	ff 35 a4 04 01 00    	push   0x104a4
+     3d2:	e8 3a a1 00 00       	call   a511 <printf>
+      exit();
+     3d7:	e8 fc 9b 00 00       	call   9fd8 <exit>
+  wait();
+     3dc:	e8 fd 9c 00 00       	call   a0de <wait>
+  printf(stdout, "exitiput test ok\n");
+     3e1:	83 ec 08             	sub    $0x8,%esp
+     3e4:	68 79 ac 00 00       	push   $0xac79
+     3e9:	ff 35 a4 04 01 00    	push   0x104a4
+     3ef:	e8 1d a1 00 00       	call   a511 <printf>
+}
+     3f4:	83 c4 10             	add    $0x10,%esp
+     3f7:	c9                   	leave
+     3f8:	c3                   	ret
+
+000003f9 <exitwait>:
+{
+     3f9:	55                   	push   %ebp
+     3fa:	89 e5                	mov    %esp,%ebp
+     3fc:	56                   	push   %esi
+     3fd:	53                   	push   %ebx
+  for(i = 0; i < 100; i++){
+     3fe:	be 00 00 00 00       	mov    $0x0,%esi
+     403:	83 fe 63             	cmp    $0x63,%esi
+     406:	7f 4d                	jg     455 <exitwait+0x5c>
+    pid = fork();
+     408:	e8 b7 9b 00 00       	call   9fc4 <fork>
+     40d:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+     40f:	85 c0                	test   %eax,%eax
+     411:	78 10                	js     423 <exitwait+0x2a>
+    if(pid){
+     413:	74 3b                	je     450 <exitwait+0x57>
+      if(wait() != pid){
+     415:	e8 c4 9c 00 00       	call   a0de <wait>
+     41a:	39 d8                	cmp    %ebx,%eax
+     41c:	75 1e                	jne    43c <exitwait+0x43>
+  for(i = 0; i < 100; i++){
+     41e:	83 c6 01             	add    $0x1,%esi
+     421:	eb e0                	jmp    403 <exitwait+0xa>
+      printf(1, "fork failed\n");
+     423:	83 ec 08             	sub    $0x8,%esp
+     426:	68 b6 be 00 00       	push   $0xbeb6
+     42b:	6a 01                	push   $0x1
+     42d:	e8 df a0 00 00       	call   a511 <printf>
+      return;
+     432:	83 c4 10             	add    $0x10,%esp
+}
+     435:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     438:	5b                   	pop    %ebx
+     439:	5e                   	pop    %esi
+     43a:	5d                   	pop    %ebp
+     43b:	c3                   	ret
+        printf(1, "wait wrong pid\n");
+     43c:	83 ec 08             	sub    $0x8,%esp
+     43f:	68 8b ac 00 00       	push   $0xac8b
+     444:	6a 01                	push   $0x1
+     446:	e8 c6 a0 00 00       	call   a511 <printf>
+        return;
+     44b:	83 c4 10             	add    $0x10,%esp
+     44e:	eb e5                	jmp    435 <exitwait+0x3c>
+      exit();
+     450:	e8 83 9b 00 00       	call   9fd8 <exit>
+  printf(1, "exitwait ok\n");
+     455:	83 ec 08             	sub    $0x8,%esp
+     458:	68 9b ac 00 00       	push   $0xac9b
+     45d:	6a 01                	push   $0x1
+     45f:	e8 ad a0 00 00       	call   a511 <printf>
+     464:	83 c4 10             	add    $0x10,%esp
+     467:	eb cc                	jmp    435 <exitwait+0x3c>
+
+00000469 <forktest>:
+{
+     469:	55                   	push   %ebp
+     46a:	89 e5                	mov    %esp,%ebp
+     46c:	53                   	push   %ebx
+     46d:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "fork test\n");
+     470:	68 a8 ac 00 00       	push   $0xaca8
+     475:	6a 01                	push   $0x1
+     477:	e8 95 a0 00 00       	call   a511 <printf>
+  for(n=0; n<1000; n++){
+     47c:	83 c4 10             	add    $0x10,%esp
+     47f:	bb 00 00 00 00       	mov    $0x0,%ebx
+     484:	81 fb e7 03 00 00    	cmp    $0x3e7,%ebx
+     48a:	7f 15                	jg     4a1 <forktest+0x38>
+    pid = fork();
+     48c:	e8 33 9b 00 00       	call   9fc4 <fork>
+    if(pid < 0)
+     491:	85 c0                	test   %eax,%eax
+     493:	78 0c                	js     4a1 <forktest+0x38>
+    if(pid == 0)
+     495:	74 05                	je     49c <forktest+0x33>
+  for(n=0; n<1000; n++){
+     497:	83 c3 01             	add    $0x1,%ebx
+     49a:	eb e8                	jmp    484 <forktest+0x1b>
+      exit();
+     49c:	e8 37 9b 00 00       	call   9fd8 <exit>
+  if(n == 1000){
+     4a1:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+     4a7:	74 12                	je     4bb <forktest+0x52>
+  for(; n > 0; n--){
+     4a9:	85 db                	test   %ebx,%ebx
+     4ab:	7e 36                	jle    4e3 <forktest+0x7a>
+    if(wait() < 0){
+     4ad:	e8 2c 9c 00 00       	call   a0de <wait>
+     4b2:	85 c0                	test   %eax,%eax
+     4b4:	78 19                	js     4cf <forktest+0x66>
+  for(; n > 0; n--){
+     4b6:	83 eb 01             	sub    $0x1,%ebx
+     4b9:	eb ee                	jmp    4a9 <forktest+0x40>
+    printf(1, "fork claimed to work 1000 times!\n");
+     4bb:	83 ec 08             	sub    $0x8,%esp
+     4be:	68 b0 d3 00 00       	push   $0xd3b0
+     4c3:	6a 01                	push   $0x1
+     4c5:	e8 47 a0 00 00       	call   a511 <printf>
+    exit();
+     4ca:	e8 09 9b 00 00       	call   9fd8 <exit>
+      printf(1, "wait stopped early\n");
+     4cf:	83 ec 08             	sub    $0x8,%esp
+     4d2:	68 b3 ac 00 00       	push   $0xacb3
+     4d7:	6a 01                	push   $0x1
+     4d9:	e8 33 a0 00 00       	call   a511 <printf>
+      exit();
+     4de:	e8 f5 9a 00 00       	call   9fd8 <exit>
+  if(wait() != -1){
+     4e3:	e8 f6 9b 00 00       	call   a0de <wait>
+     4e8:	83 f8 ff             	cmp    $0xffffffff,%eax
+     4eb:	75 17                	jne    504 <forktest+0x9b>
+  printf(1, "fork test OK\n");
+     4ed:	83 ec 08             	sub    $0x8,%esp
+     4f0:	68 da ac 00 00       	push   $0xacda
+     4f5:	6a 01                	push   $0x1
+     4f7:	e8 15 a0 00 00       	call   a511 <printf>
+}
+     4fc:	83 c4 10             	add    $0x10,%esp
+     4ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     502:	c9                   	leave
+     503:	c3                   	ret
+    printf(1, "wait got too many\n");
+     504:	83 ec 08             	sub    $0x8,%esp
+     507:	68 c7 ac 00 00       	push   $0xacc7
+     50c:	6a 01                	push   $0x1
+     50e:	e8 fe 9f 00 00       	call   a511 <printf>
+    exit();
+     513:	e8 c0 9a 00 00       	call   9fd8 <exit>
+
+00000518 <uio>:
+  printf(1, "fsfull test finished\n");
+}
+
+void
+uio()
+{
+     518:	55                   	push   %ebp
+     519:	89 e5                	mov    %esp,%ebp
+     51b:	83 ec 10             	sub    $0x10,%esp
+
+  ushort port = 0;
+  uchar val = 0;
+  int pid;
+
+  printf(1, "uio test\n");
+     51e:	68 e8 ac 00 00       	push   $0xace8
+     523:	6a 01                	push   $0x1
+     525:	e8 e7 9f 00 00       	call   a511 <printf>
+  pid = fork();
+     52a:	e8 95 9a 00 00       	call   9fc4 <fork>
+  if(pid == 0){
+     52f:	83 c4 10             	add    $0x10,%esp
+     532:	85 c0                	test   %eax,%eax
+     534:	74 1b                	je     551 <uio+0x39>
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    port = RTC_DATA;
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    exit();
+  } else if(pid < 0){
+     536:	78 3e                	js     576 <uio+0x5e>
+    printf (1, "fork failed\n");
+    exit();
+  }
+  wait();
+     538:	e8 a1 9b 00 00       	call   a0de <wait>
+  printf(1, "uio test done\n");
+     53d:	83 ec 08             	sub    $0x8,%esp
+     540:	68 f2 ac 00 00       	push   $0xacf2
+     545:	6a 01                	push   $0x1
+     547:	e8 c5 9f 00 00       	call   a511 <printf>
+}
+     54c:	83 c4 10             	add    $0x10,%esp
+     54f:	c9                   	leave
+     550:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+     551:	b8 09 00 00 00       	mov    $0x9,%eax
+     556:	ba 70 00 00 00       	mov    $0x70,%edx
+     55b:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+     55c:	ba 71 00 00 00       	mov    $0x71,%edx
+     561:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+     562:	83 ec 08             	sub    $0x8,%esp
+     565:	68 d4 d3 00 00       	push   $0xd3d4
+     56a:	6a 01                	push   $0x1
+     56c:	e8 a0 9f 00 00       	call   a511 <printf>
+    exit();
+     571:	e8 62 9a 00 00       	call   9fd8 <exit>
+    printf (1, "fork failed\n");
+     576:	83 ec 08             	sub    $0x8,%esp
+     579:	68 b6 be 00 00       	push   $0xbeb6
+     57e:	6a 01                	push   $0x1
+     580:	e8 8c 9f 00 00       	call   a511 <printf>
+    exit();
+     585:	e8 4e 9a 00 00       	call   9fd8 <exit>
+
+0000058a <openiputtest>:
+{
+     58a:	55                   	push   %ebp
+     58b:	89 e5                	mov    %esp,%ebp
+     58d:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "openiput test\n");
+     590:	68 01 ad 00 00       	push   $0xad01
+     595:	ff 35 a4 04 01 00    	push   0x104a4
+     59b:	e8 71 9f 00 00       	call   a511 <printf>
+  if(mkdir("oidir") < 0){
+     5a0:	c7 04 24 10 ad 00 00 	movl   $0xad10,(%esp)
+     5a7:	e8 c8 9b 00 00       	call   a174 <mkdir>
+     5ac:	83 c4 10             	add    $0x10,%esp
+     5af:	85 c0                	test   %eax,%eax
+     5b1:	78 39                	js     5ec <openiputtest+0x62>
+  pid = fork();
+     5b3:	e8 0c 9a 00 00       	call   9fc4 <fork>
+  if(pid < 0){
+     5b8:	85 c0                	test   %eax,%eax
+     5ba:	78 48                	js     604 <openiputtest+0x7a>
+  if(pid == 0){
+     5bc:	75 63                	jne    621 <openiputtest+0x97>
+    int fd = open("oidir", O_RDWR);
+     5be:	83 ec 08             	sub    $0x8,%esp
+     5c1:	6a 02                	push   $0x2
+     5c3:	68 10 ad 00 00       	push   $0xad10
+     5c8:	e8 5c 9b 00 00       	call   a129 <open>
+    if(fd >= 0){
+     5cd:	83 c4 10             	add    $0x10,%esp
+     5d0:	85 c0                	test   %eax,%eax
+     5d2:	78 48                	js     61c <openiputtest+0x92>
+      printf(stdout, "open directory for write succeeded\n");
+     5d4:	83 ec 08             	sub    $0x8,%esp
+     5d7:	68 f8 d3 00 00       	push   $0xd3f8
+     5dc:	ff 35 a4 04 01 00    	push   0x104a4
+     5e2:	e8 2a 9f 00 00       	call   a511 <printf>
+      exit();
+     5e7:	e8 ec 99 00 00       	call   9fd8 <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     5ec:	83 ec 08             	sub    $0x8,%esp
+     5ef:	68 16 ad 00 00       	push   $0xad16
+     5f4:	ff 35 a4 04 01 00    	push   0x104a4
+     5fa:	e8 12 9f 00 00       	call   a511 <printf>
+    exit();
+     5ff:	e8 d4 99 00 00       	call   9fd8 <exit>
+    printf(stdout, "fork failed\n");
+     604:	83 ec 08             	sub    $0x8,%esp
+     607:	68 b6 be 00 00       	push   $0xbeb6
+     60c:	ff 35 a4 04 01 00    	push   0x104a4
+     612:	e8 fa 9e 00 00       	call   a511 <printf>
+    exit();
+     617:	e8 bc 99 00 00       	call   9fd8 <exit>
+    exit();
+     61c:	e8 b7 99 00 00       	call   9fd8 <exit>
+  sleep(1);
+     621:	83 ec 0c             	sub    $0xc,%esp
+     624:	6a 01                	push   $0x1
+     626:	e8 94 9b 00 00       	call   a1bf <sleep>
+  if(unlink("oidir") != 0){
+     62b:	c7 04 24 10 ad 00 00 	movl   $0xad10,(%esp)
+     632:	e8 10 9b 00 00       	call   a147 <unlink>
+     637:	83 c4 10             	add    $0x10,%esp
+     63a:	85 c0                	test   %eax,%eax
+     63c:	75 1d                	jne    65b <openiputtest+0xd1>
+  wait();
+     63e:	e8 9b 9a 00 00       	call   a0de <wait>
+  printf(stdout, "openiput test ok\n");
+     643:	83 ec 08             	sub    $0x8,%esp
+     646:	68 2a ad 00 00       	push   $0xad2a
+     64b:	ff 35 a4 04 01 00    	push   0x104a4
+     651:	e8 bb 9e 00 00       	call   a511 <printf>
+}
+     656:	83 c4 10             	add    $0x10,%esp
+     659:	c9                   	leave
+     65a:	c3                   	ret
+    printf(stdout, "unlink failed\n");
+     65b:	83 ec 08             	sub    $0x8,%esp
+     65e:	68 79 be 00 00       	push   $0xbe79
+     663:	ff 35 a4 04 01 00    	push   0x104a4
+     669:	e8 a3 9e 00 00       	call   a511 <printf>
+    exit();
+     66e:	e8 65 99 00 00       	call   9fd8 <exit>
+
+00000673 <opentest>:
+{
+     673:	55                   	push   %ebp
+     674:	89 e5                	mov    %esp,%ebp
+     676:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "open test\n");
+     679:	68 3c ad 00 00       	push   $0xad3c
+     67e:	ff 35 a4 04 01 00    	push   0x104a4
+     684:	e8 88 9e 00 00       	call   a511 <printf>
+  fd = open("echo", 0);
+     689:	83 c4 08             	add    $0x8,%esp
+     68c:	6a 00                	push   $0x0
+     68e:	68 47 ad 00 00       	push   $0xad47
+     693:	e8 91 9a 00 00       	call   a129 <open>
+  if(fd < 0){
+     698:	83 c4 10             	add    $0x10,%esp
+     69b:	85 c0                	test   %eax,%eax
+     69d:	78 37                	js     6d6 <opentest+0x63>
+  close(fd);
+     69f:	83 ec 0c             	sub    $0xc,%esp
+     6a2:	50                   	push   %eax
+     6a3:	e8 5f 99 00 00       	call   a007 <close>
+  fd = open("doesnotexist", 0);
+     6a8:	83 c4 08             	add    $0x8,%esp
+     6ab:	6a 00                	push   $0x0
+     6ad:	68 5f ad 00 00       	push   $0xad5f
+     6b2:	e8 72 9a 00 00       	call   a129 <open>
+  if(fd >= 0){
+     6b7:	83 c4 10             	add    $0x10,%esp
+     6ba:	85 c0                	test   %eax,%eax
+     6bc:	79 30                	jns    6ee <opentest+0x7b>
+  printf(stdout, "open test ok\n");
+     6be:	83 ec 08             	sub    $0x8,%esp
+     6c1:	68 8a ad 00 00       	push   $0xad8a
+     6c6:	ff 35 a4 04 01 00    	push   0x104a4
+     6cc:	e8 40 9e 00 00       	call   a511 <printf>
+}
+     6d1:	83 c4 10             	add    $0x10,%esp
+     6d4:	c9                   	leave
+     6d5:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     6d6:	83 ec 08             	sub    $0x8,%esp
+     6d9:	68 4c ad 00 00       	push   $0xad4c
+     6de:	ff 35 a4 04 01 00    	push   0x104a4
+     6e4:	e8 28 9e 00 00       	call   a511 <printf>
+    exit();
+     6e9:	e8 ea 98 00 00       	call   9fd8 <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     6ee:	83 ec 08             	sub    $0x8,%esp
+     6f1:	68 6c ad 00 00       	push   $0xad6c
+     6f6:	ff 35 a4 04 01 00    	push   0x104a4
+     6fc:	e8 10 9e 00 00       	call   a511 <printf>
+    exit();
+     701:	e8 d2 98 00 00       	call   9fd8 <exit>
+
+00000706 <createtest>:
+{
+     706:	55                   	push   %ebp
+     707:	89 e5                	mov    %esp,%ebp
+     709:	53                   	push   %ebx
+     70a:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "many creates, followed by unlink test\n");
+     70d:	68 1c d4 00 00       	push   $0xd41c
+     712:	ff 35 a4 04 01 00    	push   0x104a4
+     718:	e8 f4 9d 00 00       	call   a511 <printf>
+  name[0] = 'a';
+     71d:	c6 05 90 2c 01 00 61 	movb   $0x61,0x12c90
+  name[2] = '\0';
+     724:	c6 05 92 2c 01 00 00 	movb   $0x0,0x12c92
+  for(i = 0; i < 52; i++){
+     72b:	83 c4 10             	add    $0x10,%esp
+     72e:	bb 00 00 00 00       	mov    $0x0,%ebx
+     733:	eb 28                	jmp    75d <createtest+0x57>
+    name[1] = '0' + i;
+     735:	8d 43 30             	lea    0x30(%ebx),%eax
+     738:	a2 91 2c 01 00       	mov    %al,0x12c91
+    fd = open(name, O_CREATE|O_RDWR);
+     73d:	83 ec 08             	sub    $0x8,%esp
+     740:	68 02 02 00 00       	push   $0x202
+     745:	68 90 2c 01 00       	push   $0x12c90
+     74a:	e8 da 99 00 00       	call   a129 <open>
+    close(fd);
+     74f:	89 04 24             	mov    %eax,(%esp)
+     752:	e8 b0 98 00 00       	call   a007 <close>
+  for(i = 0; i < 52; i++){
+     757:	83 c3 01             	add    $0x1,%ebx
+     75a:	83 c4 10             	add    $0x10,%esp
+     75d:	83 fb 33             	cmp    $0x33,%ebx
+     760:	7e d3                	jle    735 <createtest+0x2f>
+  name[0] = 'a';
+     762:	c6 05 90 2c 01 00 61 	movb   $0x61,0x12c90
+  name[2] = '\0';
+     769:	c6 05 92 2c 01 00 00 	movb   $0x0,0x12c92
+  for(i = 0; i < 52; i++){
+     770:	bb 00 00 00 00       	mov    $0x0,%ebx
+     775:	eb 1b                	jmp    792 <createtest+0x8c>
+    name[1] = '0' + i;
+     777:	8d 43 30             	lea    0x30(%ebx),%eax
+     77a:	a2 91 2c 01 00       	mov    %al,0x12c91
+    unlink(name);
+     77f:	83 ec 0c             	sub    $0xc,%esp
+     782:	68 90 2c 01 00       	push   $0x12c90
+     787:	e8 bb 99 00 00       	call   a147 <unlink>
+  for(i = 0; i < 52; i++){
+     78c:	83 c3 01             	add    $0x1,%ebx
+     78f:	83 c4 10             	add    $0x10,%esp
+     792:	83 fb 33             	cmp    $0x33,%ebx
+     795:	7e e0                	jle    777 <createtest+0x71>
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     797:	83 ec 08             	sub    $0x8,%esp
+     79a:	68 44 d4 00 00       	push   $0xd444
+     79f:	ff 35 a4 04 01 00    	push   0x104a4
+     7a5:	e8 67 9d 00 00       	call   a511 <printf>
+}
+     7aa:	83 c4 10             	add    $0x10,%esp
+     7ad:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7b0:	c9                   	leave
+     7b1:	c3                   	ret
+
+000007b2 <createdelete>:
+{
+     7b2:	55                   	push   %ebp
+     7b3:	89 e5                	mov    %esp,%ebp
+     7b5:	56                   	push   %esi
+     7b6:	53                   	push   %ebx
+     7b7:	83 ec 28             	sub    $0x28,%esp
+  printf(1, "createdelete test\n");
+     7ba:	68 98 ad 00 00       	push   $0xad98
+     7bf:	6a 01                	push   $0x1
+     7c1:	e8 4b 9d 00 00       	call   a511 <printf>
+  for(pi = 0; pi < 4; pi++){
+     7c6:	83 c4 10             	add    $0x10,%esp
+     7c9:	be 00 00 00 00       	mov    $0x0,%esi
+     7ce:	83 fe 03             	cmp    $0x3,%esi
+     7d1:	0f 8f bc 00 00 00    	jg     893 <createdelete+0xe1>
+    pid = fork();
+     7d7:	e8 e8 97 00 00       	call   9fc4 <fork>
+     7dc:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+     7de:	85 c0                	test   %eax,%eax
+     7e0:	78 07                	js     7e9 <createdelete+0x37>
+    if(pid == 0){
+     7e2:	74 19                	je     7fd <createdelete+0x4b>
+  for(pi = 0; pi < 4; pi++){
+     7e4:	83 c6 01             	add    $0x1,%esi
+     7e7:	eb e5                	jmp    7ce <createdelete+0x1c>
+      printf(1, "fork failed\n");
+     7e9:	83 ec 08             	sub    $0x8,%esp
+     7ec:	68 b6 be 00 00       	push   $0xbeb6
+     7f1:	6a 01                	push   $0x1
+     7f3:	e8 19 9d 00 00       	call   a511 <printf>
+      exit();
+     7f8:	e8 db 97 00 00       	call   9fd8 <exit>
+      name[0] = 'p' + pi;
+     7fd:	8d 46 70             	lea    0x70(%esi),%eax
+     800:	88 45 d8             	mov    %al,-0x28(%ebp)
+      name[2] = '\0';
+     803:	c6 45 da 00          	movb   $0x0,-0x26(%ebp)
+      for(i = 0; i < N; i++){
+     807:	eb 17                	jmp    820 <createdelete+0x6e>
+          printf(1, "create failed\n");
+     809:	83 ec 08             	sub    $0x8,%esp
+     80c:	68 30 c8 00 00       	push   $0xc830
+     811:	6a 01                	push   $0x1
+     813:	e8 f9 9c 00 00       	call   a511 <printf>
+          exit();
+     818:	e8 bb 97 00 00       	call   9fd8 <exit>
+      for(i = 0; i < N; i++){
+     81d:	83 c3 01             	add    $0x1,%ebx
+     820:	83 fb 13             	cmp    $0x13,%ebx
+     823:	7f 69                	jg     88e <createdelete+0xdc>
+        name[1] = '0' + i;
+     825:	8d 43 30             	lea    0x30(%ebx),%eax
+     828:	88 45 d9             	mov    %al,-0x27(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+     82b:	83 ec 08             	sub    $0x8,%esp
+     82e:	68 02 02 00 00       	push   $0x202
+     833:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     836:	50                   	push   %eax
+     837:	e8 ed 98 00 00       	call   a129 <open>
+        if(fd < 0){
+     83c:	83 c4 10             	add    $0x10,%esp
+     83f:	85 c0                	test   %eax,%eax
+     841:	78 c6                	js     809 <createdelete+0x57>
+        close(fd);
+     843:	83 ec 0c             	sub    $0xc,%esp
+     846:	50                   	push   %eax
+     847:	e8 bb 97 00 00       	call   a007 <close>
+        if(i > 0 && (i % 2 ) == 0){
+     84c:	83 c4 10             	add    $0x10,%esp
+     84f:	85 db                	test   %ebx,%ebx
+     851:	7e ca                	jle    81d <createdelete+0x6b>
+     853:	f6 c3 01             	test   $0x1,%bl
+     856:	75 c5                	jne    81d <createdelete+0x6b>
+          name[1] = '0' + (i / 2);
+     858:	89 d8                	mov    %ebx,%eax
+     85a:	c1 e8 1f             	shr    $0x1f,%eax
+     85d:	01 d8                	add    %ebx,%eax
+     85f:	d1 f8                	sar    %eax
+     861:	83 c0 30             	add    $0x30,%eax
+     864:	88 45 d9             	mov    %al,-0x27(%ebp)
+          if(unlink(name) < 0){
+     867:	83 ec 0c             	sub    $0xc,%esp
+     86a:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     86d:	50                   	push   %eax
+     86e:	e8 d4 98 00 00       	call   a147 <unlink>
+     873:	83 c4 10             	add    $0x10,%esp
+     876:	85 c0                	test   %eax,%eax
+     878:	79 a3                	jns    81d <createdelete+0x6b>
+            printf(1, "unlink failed\n");
+     87a:	83 ec 08             	sub    $0x8,%esp
+     87d:	68 79 be 00 00       	push   $0xbe79
+     882:	6a 01                	push   $0x1
+     884:	e8 88 9c 00 00       	call   a511 <printf>
+            exit();
+     889:	e8 4a 97 00 00       	call   9fd8 <exit>
+      exit();
+     88e:	e8 45 97 00 00       	call   9fd8 <exit>
+  for(pi = 0; pi < 4; pi++){
+     893:	bb 00 00 00 00       	mov    $0x0,%ebx
+     898:	eb 08                	jmp    8a2 <createdelete+0xf0>
+    wait();
+     89a:	e8 3f 98 00 00       	call   a0de <wait>
+  for(pi = 0; pi < 4; pi++){
+     89f:	83 c3 01             	add    $0x1,%ebx
+     8a2:	83 fb 03             	cmp    $0x3,%ebx
+     8a5:	7e f3                	jle    89a <createdelete+0xe8>
+  name[0] = name[1] = name[2] = 0;
+     8a7:	c6 45 da 00          	movb   $0x0,-0x26(%ebp)
+     8ab:	c6 45 d9 00          	movb   $0x0,-0x27(%ebp)
+     8af:	c6 45 d8 00          	movb   $0x0,-0x28(%ebp)
+  for(i = 0; i < N; i++){
+     8b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+     8b8:	e9 89 00 00 00       	jmp    946 <createdelete+0x194>
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+     8bd:	8d 53 ff             	lea    -0x1(%ebx),%edx
+     8c0:	83 fa 08             	cmp    $0x8,%edx
+     8c3:	76 54                	jbe    919 <createdelete+0x167>
+      if(fd >= 0)
+     8c5:	85 c0                	test   %eax,%eax
+     8c7:	79 6c                	jns    935 <createdelete+0x183>
+    for(pi = 0; pi < 4; pi++){
+     8c9:	83 c6 01             	add    $0x1,%esi
+     8cc:	83 fe 03             	cmp    $0x3,%esi
+     8cf:	7f 72                	jg     943 <createdelete+0x191>
+      name[0] = 'p' + pi;
+     8d1:	8d 46 70             	lea    0x70(%esi),%eax
+     8d4:	88 45 d8             	mov    %al,-0x28(%ebp)
+      name[1] = '0' + i;
+     8d7:	8d 43 30             	lea    0x30(%ebx),%eax
+     8da:	88 45 d9             	mov    %al,-0x27(%ebp)
+      fd = open(name, 0);
+     8dd:	83 ec 08             	sub    $0x8,%esp
+     8e0:	6a 00                	push   $0x0
+     8e2:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     8e5:	50                   	push   %eax
+     8e6:	e8 3e 98 00 00       	call   a129 <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+     8eb:	83 c4 10             	add    $0x10,%esp
+     8ee:	85 db                	test   %ebx,%ebx
+     8f0:	0f 94 c2             	sete   %dl
+     8f3:	83 fb 09             	cmp    $0x9,%ebx
+     8f6:	0f 9f c1             	setg   %cl
+     8f9:	08 ca                	or     %cl,%dl
+     8fb:	74 c0                	je     8bd <createdelete+0x10b>
+     8fd:	85 c0                	test   %eax,%eax
+     8ff:	79 bc                	jns    8bd <createdelete+0x10b>
+        printf(1, "oops createdelete %s didn't exist\n", name);
+     901:	83 ec 04             	sub    $0x4,%esp
+     904:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     907:	50                   	push   %eax
+     908:	68 6c d4 00 00       	push   $0xd46c
+     90d:	6a 01                	push   $0x1
+     90f:	e8 fd 9b 00 00       	call   a511 <printf>
+        exit();
+     914:	e8 bf 96 00 00       	call   9fd8 <exit>
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+     919:	85 c0                	test   %eax,%eax
+     91b:	78 ac                	js     8c9 <createdelete+0x117>
+        printf(1, "oops createdelete %s did exist\n", name);
+     91d:	83 ec 04             	sub    $0x4,%esp
+     920:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     923:	50                   	push   %eax
+     924:	68 90 d4 00 00       	push   $0xd490
+     929:	6a 01                	push   $0x1
+     92b:	e8 e1 9b 00 00       	call   a511 <printf>
+        exit();
+     930:	e8 a3 96 00 00       	call   9fd8 <exit>
+        close(fd);
+     935:	83 ec 0c             	sub    $0xc,%esp
+     938:	50                   	push   %eax
+     939:	e8 c9 96 00 00       	call   a007 <close>
+     93e:	83 c4 10             	add    $0x10,%esp
+     941:	eb 86                	jmp    8c9 <createdelete+0x117>
+  for(i = 0; i < N; i++){
+     943:	83 c3 01             	add    $0x1,%ebx
+     946:	83 fb 13             	cmp    $0x13,%ebx
+     949:	7f 0a                	jg     955 <createdelete+0x1a3>
+    for(pi = 0; pi < 4; pi++){
+     94b:	be 00 00 00 00       	mov    $0x0,%esi
+     950:	e9 77 ff ff ff       	jmp    8cc <createdelete+0x11a>
+  for(i = 0; i < N; i++){
+     955:	be 00 00 00 00       	mov    $0x0,%esi
+     95a:	eb 26                	jmp    982 <createdelete+0x1d0>
+      name[0] = 'p' + i;
+     95c:	8d 46 70             	lea    0x70(%esi),%eax
+     95f:	88 45 d8             	mov    %al,-0x28(%ebp)
+      name[1] = '0' + i;
+     962:	8d 46 30             	lea    0x30(%esi),%eax
+     965:	88 45 d9             	mov    %al,-0x27(%ebp)
+      unlink(name);
+     968:	83 ec 0c             	sub    $0xc,%esp
+     96b:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     96e:	50                   	push   %eax
+     96f:	e8 d3 97 00 00       	call   a147 <unlink>
+    for(pi = 0; pi < 4; pi++){
+     974:	83 c3 01             	add    $0x1,%ebx
+     977:	83 c4 10             	add    $0x10,%esp
+     97a:	83 fb 03             	cmp    $0x3,%ebx
+     97d:	7e dd                	jle    95c <createdelete+0x1aa>
+  for(i = 0; i < N; i++){
+     97f:	83 c6 01             	add    $0x1,%esi
+     982:	83 fe 13             	cmp    $0x13,%esi
+     985:	7f 07                	jg     98e <createdelete+0x1dc>
+    for(pi = 0; pi < 4; pi++){
+     987:	bb 00 00 00 00       	mov    $0x0,%ebx
+     98c:	eb ec                	jmp    97a <createdelete+0x1c8>
+  printf(1, "createdelete ok\n");
+     98e:	83 ec 08             	sub    $0x8,%esp
+     991:	68 ab ad 00 00       	push   $0xadab
+     996:	6a 01                	push   $0x1
+     998:	e8 74 9b 00 00       	call   a511 <printf>
+}
+     99d:	83 c4 10             	add    $0x10,%esp
+     9a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     9a3:	5b                   	pop    %ebx
+     9a4:	5e                   	pop    %esi
+     9a5:	5d                   	pop    %ebp
+     9a6:	c3                   	ret
+
+000009a7 <fourteen>:
+{
+     9a7:	55                   	push   %ebp
+     9a8:	89 e5                	mov    %esp,%ebp
+     9aa:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "fourteen test\n");
+     9ad:	68 bc ad 00 00       	push   $0xadbc
+     9b2:	6a 01                	push   $0x1
+     9b4:	e8 58 9b 00 00       	call   a511 <printf>
+  if(mkdir("12345678901234") != 0){
+     9b9:	c7 04 24 f7 ad 00 00 	movl   $0xadf7,(%esp)
+     9c0:	e8 af 97 00 00       	call   a174 <mkdir>
+     9c5:	83 c4 10             	add    $0x10,%esp
+     9c8:	85 c0                	test   %eax,%eax
+     9ca:	0f 85 9c 00 00 00    	jne    a6c <fourteen+0xc5>
+  if(mkdir("12345678901234/123456789012345") != 0){
+     9d0:	83 ec 0c             	sub    $0xc,%esp
+     9d3:	68 b0 d4 00 00       	push   $0xd4b0
+     9d8:	e8 97 97 00 00       	call   a174 <mkdir>
+     9dd:	83 c4 10             	add    $0x10,%esp
+     9e0:	85 c0                	test   %eax,%eax
+     9e2:	0f 85 98 00 00 00    	jne    a80 <fourteen+0xd9>
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+     9e8:	83 ec 08             	sub    $0x8,%esp
+     9eb:	68 00 02 00 00       	push   $0x200
+     9f0:	68 00 d5 00 00       	push   $0xd500
+     9f5:	e8 2f 97 00 00       	call   a129 <open>
+  if(fd < 0){
+     9fa:	83 c4 10             	add    $0x10,%esp
+     9fd:	85 c0                	test   %eax,%eax
+     9ff:	0f 88 8f 00 00 00    	js     a94 <fourteen+0xed>
+  close(fd);
+     a05:	83 ec 0c             	sub    $0xc,%esp
+     a08:	50                   	push   %eax
+     a09:	e8 f9 95 00 00       	call   a007 <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+     a0e:	83 c4 08             	add    $0x8,%esp
+     a11:	6a 00                	push   $0x0
+     a13:	68 70 d5 00 00       	push   $0xd570
+     a18:	e8 0c 97 00 00       	call   a129 <open>
+  if(fd < 0){
+     a1d:	83 c4 10             	add    $0x10,%esp
+     a20:	85 c0                	test   %eax,%eax
+     a22:	0f 88 80 00 00 00    	js     aa8 <fourteen+0x101>
+  close(fd);
+     a28:	83 ec 0c             	sub    $0xc,%esp
+     a2b:	50                   	push   %eax
+     a2c:	e8 d6 95 00 00       	call   a007 <close>
+  if(mkdir("12345678901234/12345678901234") == 0){
+     a31:	c7 04 24 e8 ad 00 00 	movl   $0xade8,(%esp)
+     a38:	e8 37 97 00 00       	call   a174 <mkdir>
+     a3d:	83 c4 10             	add    $0x10,%esp
+     a40:	85 c0                	test   %eax,%eax
+     a42:	74 78                	je     abc <fourteen+0x115>
+  if(mkdir("123456789012345/12345678901234") == 0){
+     a44:	83 ec 0c             	sub    $0xc,%esp
+     a47:	68 0c d6 00 00       	push   $0xd60c
+     a4c:	e8 23 97 00 00       	call   a174 <mkdir>
+     a51:	83 c4 10             	add    $0x10,%esp
+     a54:	85 c0                	test   %eax,%eax
+     a56:	74 78                	je     ad0 <fourteen+0x129>
+  printf(1, "fourteen ok\n");
+     a58:	83 ec 08             	sub    $0x8,%esp
+     a5b:	68 06 ae 00 00       	push   $0xae06
+     a60:	6a 01                	push   $0x1
+     a62:	e8 aa 9a 00 00       	call   a511 <printf>
+}
+     a67:	83 c4 10             	add    $0x10,%esp
+     a6a:	c9                   	leave
+     a6b:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+     a6c:	83 ec 08             	sub    $0x8,%esp
+     a6f:	68 cb ad 00 00       	push   $0xadcb
+     a74:	6a 01                	push   $0x1
+     a76:	e8 96 9a 00 00       	call   a511 <printf>
+    exit();
+     a7b:	e8 58 95 00 00       	call   9fd8 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+     a80:	83 ec 08             	sub    $0x8,%esp
+     a83:	68 d0 d4 00 00       	push   $0xd4d0
+     a88:	6a 01                	push   $0x1
+     a8a:	e8 82 9a 00 00       	call   a511 <printf>
+    exit();
+     a8f:	e8 44 95 00 00       	call   9fd8 <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+     a94:	83 ec 08             	sub    $0x8,%esp
+     a97:	68 30 d5 00 00       	push   $0xd530
+     a9c:	6a 01                	push   $0x1
+     a9e:	e8 6e 9a 00 00       	call   a511 <printf>
+    exit();
+     aa3:	e8 30 95 00 00       	call   9fd8 <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+     aa8:	83 ec 08             	sub    $0x8,%esp
+     aab:	68 a0 d5 00 00       	push   $0xd5a0
+     ab0:	6a 01                	push   $0x1
+     ab2:	e8 5a 9a 00 00       	call   a511 <printf>
+    exit();
+     ab7:	e8 1c 95 00 00       	call   9fd8 <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+     abc:	83 ec 08             	sub    $0x8,%esp
+     abf:	68 dc d5 00 00       	push   $0xd5dc
+     ac4:	6a 01                	push   $0x1
+     ac6:	e8 46 9a 00 00       	call   a511 <printf>
+    exit();
+     acb:	e8 08 95 00 00       	call   9fd8 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+     ad0:	83 ec 08             	sub    $0x8,%esp
+     ad3:	68 2c d6 00 00       	push   $0xd62c
+     ad8:	6a 01                	push   $0x1
+     ada:	e8 32 9a 00 00       	call   a511 <printf>
+    exit();
+     adf:	e8 f4 94 00 00       	call   9fd8 <exit>
+
+00000ae4 <bigwrite>:
+{
+     ae4:	55                   	push   %ebp
+     ae5:	89 e5                	mov    %esp,%ebp
+     ae7:	57                   	push   %edi
+     ae8:	56                   	push   %esi
+     ae9:	53                   	push   %ebx
+     aea:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "bigwrite test\n");
+     aed:	68 13 ae 00 00       	push   $0xae13
+     af2:	6a 01                	push   $0x1
+     af4:	e8 18 9a 00 00       	call   a511 <printf>
+  unlink("bigwrite");
+     af9:	c7 04 24 22 ae 00 00 	movl   $0xae22,(%esp)
+     b00:	e8 42 96 00 00       	call   a147 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+     b05:	83 c4 10             	add    $0x10,%esp
+     b08:	be f3 01 00 00       	mov    $0x1f3,%esi
+     b0d:	eb 45                	jmp    b54 <bigwrite+0x70>
+      printf(1, "cannot create bigwrite\n");
+     b0f:	83 ec 08             	sub    $0x8,%esp
+     b12:	68 2b ae 00 00       	push   $0xae2b
+     b17:	6a 01                	push   $0x1
+     b19:	e8 f3 99 00 00       	call   a511 <printf>
+      exit();
+     b1e:	e8 b5 94 00 00       	call   9fd8 <exit>
+        printf(1, "write(%d) ret %d\n", sz, cc);
+     b23:	50                   	push   %eax
+     b24:	56                   	push   %esi
+     b25:	68 43 ae 00 00       	push   $0xae43
+     b2a:	6a 01                	push   $0x1
+     b2c:	e8 e0 99 00 00       	call   a511 <printf>
+        exit();
+     b31:	e8 a2 94 00 00       	call   9fd8 <exit>
+    close(fd);
+     b36:	83 ec 0c             	sub    $0xc,%esp
+     b39:	57                   	push   %edi
+     b3a:	e8 c8 94 00 00       	call   a007 <close>
+    unlink("bigwrite");
+     b3f:	c7 04 24 22 ae 00 00 	movl   $0xae22,(%esp)
+     b46:	e8 fc 95 00 00       	call   a147 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+     b4b:	81 c6 d7 01 00 00    	add    $0x1d7,%esi
+     b51:	83 c4 10             	add    $0x10,%esp
+     b54:	81 fe ff 17 00 00    	cmp    $0x17ff,%esi
+     b5a:	7f 40                	jg     b9c <bigwrite+0xb8>
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+     b5c:	83 ec 08             	sub    $0x8,%esp
+     b5f:	68 02 02 00 00       	push   $0x202
+     b64:	68 22 ae 00 00       	push   $0xae22
+     b69:	e8 bb 95 00 00       	call   a129 <open>
+     b6e:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+     b70:	83 c4 10             	add    $0x10,%esp
+     b73:	85 c0                	test   %eax,%eax
+     b75:	78 98                	js     b0f <bigwrite+0x2b>
+    for(i = 0; i < 2; i++){
+     b77:	bb 00 00 00 00       	mov    $0x0,%ebx
+     b7c:	83 fb 01             	cmp    $0x1,%ebx
+     b7f:	7f b5                	jg     b36 <bigwrite+0x52>
+      int cc = write(fd, buf, sz);
+     b81:	83 ec 04             	sub    $0x4,%esp
+     b84:	56                   	push   %esi
+     b85:	68 a0 2c 01 00       	push   $0x12ca0
+     b8a:	57                   	push   %edi
+     b8b:	e8 7b 95 00 00       	call   a10b <write>
+      if(cc != sz){
+     b90:	83 c4 10             	add    $0x10,%esp
+     b93:	39 c6                	cmp    %eax,%esi
+     b95:	75 8c                	jne    b23 <bigwrite+0x3f>
+    for(i = 0; i < 2; i++){
+     b97:	83 c3 01             	add    $0x1,%ebx
+     b9a:	eb e0                	jmp    b7c <bigwrite+0x98>
+  printf(1, "bigwrite ok\n");
+     b9c:	83 ec 08             	sub    $0x8,%esp
+     b9f:	68 55 ae 00 00       	push   $0xae55
+     ba4:	6a 01                	push   $0x1
+     ba6:	e8 66 99 00 00       	call   a511 <printf>
+}
+     bab:	83 c4 10             	add    $0x10,%esp
+     bae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     bb1:	5b                   	pop    %ebx
+     bb2:	5e                   	pop    %esi
+     bb3:	5f                   	pop    %edi
+     bb4:	5d                   	pop    %ebp
+     bb5:	c3                   	ret
+
+00000bb6 <writetest>:
+{
+     bb6:	55                   	push   %ebp
+     bb7:	89 e5                	mov    %esp,%ebp
+     bb9:	56                   	push   %esi
+     bba:	53                   	push   %ebx
+  printf(stdout, "small file test\n");
+     bbb:	83 ec 08             	sub    $0x8,%esp
+     bbe:	68 62 ae 00 00       	push   $0xae62
+     bc3:	ff 35 a4 04 01 00    	push   0x104a4
+     bc9:	e8 43 99 00 00       	call   a511 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     bce:	83 c4 08             	add    $0x8,%esp
+     bd1:	68 02 02 00 00       	push   $0x202
+     bd6:	68 73 ae 00 00       	push   $0xae73
+     bdb:	e8 49 95 00 00       	call   a129 <open>
+  if(fd >= 0){
+     be0:	83 c4 10             	add    $0x10,%esp
+     be3:	85 c0                	test   %eax,%eax
+     be5:	78 57                	js     c3e <writetest+0x88>
+     be7:	89 c6                	mov    %eax,%esi
+    printf(stdout, "creat small succeeded; ok\n");
+     be9:	83 ec 08             	sub    $0x8,%esp
+     bec:	68 79 ae 00 00       	push   $0xae79
+     bf1:	ff 35 a4 04 01 00    	push   0x104a4
+     bf7:	e8 15 99 00 00       	call   a511 <printf>
+  for(i = 0; i < 100; i++){
+     bfc:	83 c4 10             	add    $0x10,%esp
+     bff:	bb 00 00 00 00       	mov    $0x0,%ebx
+     c04:	83 fb 63             	cmp    $0x63,%ebx
+     c07:	7f 7f                	jg     c88 <writetest+0xd2>
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     c09:	83 ec 04             	sub    $0x4,%esp
+     c0c:	6a 0a                	push   $0xa
+     c0e:	68 b0 ae 00 00       	push   $0xaeb0
+     c13:	56                   	push   %esi
+     c14:	e8 f2 94 00 00       	call   a10b <write>
+     c19:	83 c4 10             	add    $0x10,%esp
+     c1c:	83 f8 0a             	cmp    $0xa,%eax
+     c1f:	75 35                	jne    c56 <writetest+0xa0>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     c21:	83 ec 04             	sub    $0x4,%esp
+     c24:	6a 0a                	push   $0xa
+     c26:	68 bb ae 00 00       	push   $0xaebb
+     c2b:	56                   	push   %esi
+     c2c:	e8 da 94 00 00       	call   a10b <write>
+     c31:	83 c4 10             	add    $0x10,%esp
+     c34:	83 f8 0a             	cmp    $0xa,%eax
+     c37:	75 36                	jne    c6f <writetest+0xb9>
+  for(i = 0; i < 100; i++){
+     c39:	83 c3 01             	add    $0x1,%ebx
+     c3c:	eb c6                	jmp    c04 <writetest+0x4e>
+    printf(stdout, "error: creat small failed!\n");
+     c3e:	83 ec 08             	sub    $0x8,%esp
+     c41:	68 94 ae 00 00       	push   $0xae94
+     c46:	ff 35 a4 04 01 00    	push   0x104a4
+     c4c:	e8 c0 98 00 00       	call   a511 <printf>
+    exit();
+     c51:	e8 82 93 00 00       	call   9fd8 <exit>
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     c56:	83 ec 04             	sub    $0x4,%esp
+     c59:	53                   	push   %ebx
+     c5a:	68 60 d6 00 00       	push   $0xd660
+     c5f:	ff 35 a4 04 01 00    	push   0x104a4
+     c65:	e8 a7 98 00 00       	call   a511 <printf>
+      exit();
+     c6a:	e8 69 93 00 00       	call   9fd8 <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     c6f:	83 ec 04             	sub    $0x4,%esp
+     c72:	53                   	push   %ebx
+     c73:	68 84 d6 00 00       	push   $0xd684
+     c78:	ff 35 a4 04 01 00    	push   0x104a4
+     c7e:	e8 8e 98 00 00       	call   a511 <printf>
+      exit();
+     c83:	e8 50 93 00 00       	call   9fd8 <exit>
+  printf(stdout, "writes ok\n");
+     c88:	83 ec 08             	sub    $0x8,%esp
+     c8b:	68 c6 ae 00 00       	push   $0xaec6
+     c90:	ff 35 a4 04 01 00    	push   0x104a4
+     c96:	e8 76 98 00 00       	call   a511 <printf>
+  close(fd);
+     c9b:	89 34 24             	mov    %esi,(%esp)
+     c9e:	e8 64 93 00 00       	call   a007 <close>
+  fd = open("small", O_RDONLY);
+     ca3:	83 c4 08             	add    $0x8,%esp
+     ca6:	6a 00                	push   $0x0
+     ca8:	68 73 ae 00 00       	push   $0xae73
+     cad:	e8 77 94 00 00       	call   a129 <open>
+     cb2:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     cb4:	83 c4 10             	add    $0x10,%esp
+     cb7:	85 c0                	test   %eax,%eax
+     cb9:	78 7b                	js     d36 <writetest+0x180>
+    printf(stdout, "open small succeeded ok\n");
+     cbb:	83 ec 08             	sub    $0x8,%esp
+     cbe:	68 d1 ae 00 00       	push   $0xaed1
+     cc3:	ff 35 a4 04 01 00    	push   0x104a4
+     cc9:	e8 43 98 00 00       	call   a511 <printf>
+  i = read(fd, buf, 2000);
+     cce:	83 c4 0c             	add    $0xc,%esp
+     cd1:	68 d0 07 00 00       	push   $0x7d0
+     cd6:	68 a0 2c 01 00       	push   $0x12ca0
+     cdb:	53                   	push   %ebx
+     cdc:	e8 1b 94 00 00       	call   a0fc <read>
+  if(i == 2000){
+     ce1:	83 c4 10             	add    $0x10,%esp
+     ce4:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     ce9:	75 63                	jne    d4e <writetest+0x198>
+    printf(stdout, "read succeeded ok\n");
+     ceb:	83 ec 08             	sub    $0x8,%esp
+     cee:	68 05 af 00 00       	push   $0xaf05
+     cf3:	ff 35 a4 04 01 00    	push   0x104a4
+     cf9:	e8 13 98 00 00       	call   a511 <printf>
+  close(fd);
+     cfe:	89 1c 24             	mov    %ebx,(%esp)
+     d01:	e8 01 93 00 00       	call   a007 <close>
+  if(unlink("small") < 0){
+     d06:	c7 04 24 73 ae 00 00 	movl   $0xae73,(%esp)
+     d0d:	e8 35 94 00 00       	call   a147 <unlink>
+     d12:	83 c4 10             	add    $0x10,%esp
+     d15:	85 c0                	test   %eax,%eax
+     d17:	78 4d                	js     d66 <writetest+0x1b0>
+  printf(stdout, "small file test ok\n");
+     d19:	83 ec 08             	sub    $0x8,%esp
+     d1c:	68 2d af 00 00       	push   $0xaf2d
+     d21:	ff 35 a4 04 01 00    	push   0x104a4
+     d27:	e8 e5 97 00 00       	call   a511 <printf>
+}
+     d2c:	83 c4 10             	add    $0x10,%esp
+     d2f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     d32:	5b                   	pop    %ebx
+     d33:	5e                   	pop    %esi
+     d34:	5d                   	pop    %ebp
+     d35:	c3                   	ret
+    printf(stdout, "error: open small failed!\n");
+     d36:	83 ec 08             	sub    $0x8,%esp
+     d39:	68 ea ae 00 00       	push   $0xaeea
+     d3e:	ff 35 a4 04 01 00    	push   0x104a4
+     d44:	e8 c8 97 00 00       	call   a511 <printf>
+    exit();
+     d49:	e8 8a 92 00 00       	call   9fd8 <exit>
+    printf(stdout, "read failed\n");
+     d4e:	83 ec 08             	sub    $0x8,%esp
+     d51:	68 ba b2 00 00       	push   $0xb2ba
+     d56:	ff 35 a4 04 01 00    	push   0x104a4
+     d5c:	e8 b0 97 00 00       	call   a511 <printf>
+    exit();
+     d61:	e8 72 92 00 00       	call   9fd8 <exit>
+    printf(stdout, "unlink small failed\n");
+     d66:	83 ec 08             	sub    $0x8,%esp
+     d69:	68 18 af 00 00       	push   $0xaf18
+     d6e:	ff 35 a4 04 01 00    	push   0x104a4
+     d74:	e8 98 97 00 00       	call   a511 <printf>
+    exit();
+     d79:	e8 5a 92 00 00       	call   9fd8 <exit>
+
+00000d7e <writetest1>:
+{
+     d7e:	55                   	push   %ebp
+     d7f:	89 e5                	mov    %esp,%ebp
+     d81:	56                   	push   %esi
+     d82:	53                   	push   %ebx
+  printf(stdout, "big files test\n");
+     d83:	83 ec 08             	sub    $0x8,%esp
+     d86:	68 41 af 00 00       	push   $0xaf41
+     d8b:	ff 35 a4 04 01 00    	push   0x104a4
+     d91:	e8 7b 97 00 00       	call   a511 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+     d96:	83 c4 08             	add    $0x8,%esp
+     d99:	68 02 02 00 00       	push   $0x202
+     d9e:	68 bb af 00 00       	push   $0xafbb
+     da3:	e8 81 93 00 00       	call   a129 <open>
+  if(fd < 0){
+     da8:	83 c4 10             	add    $0x10,%esp
+     dab:	85 c0                	test   %eax,%eax
+     dad:	78 37                	js     de6 <writetest1+0x68>
+     daf:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < MAXFILE; i++){
+     db1:	bb 00 00 00 00       	mov    $0x0,%ebx
+     db6:	81 fb 8a 40 00 00    	cmp    $0x408a,%ebx
+     dbc:	77 59                	ja     e17 <writetest1+0x99>
+    ((int*)buf)[0] = i;
+     dbe:	89 1d a0 2c 01 00    	mov    %ebx,0x12ca0
+    if(write(fd, buf, 512) != 512){
+     dc4:	83 ec 04             	sub    $0x4,%esp
+     dc7:	68 00 02 00 00       	push   $0x200
+     dcc:	68 a0 2c 01 00       	push   $0x12ca0
+     dd1:	56                   	push   %esi
+     dd2:	e8 34 93 00 00       	call   a10b <write>
+     dd7:	83 c4 10             	add    $0x10,%esp
+     dda:	3d 00 02 00 00       	cmp    $0x200,%eax
+     ddf:	75 1d                	jne    dfe <writetest1+0x80>
+  for(i = 0; i < MAXFILE; i++){
+     de1:	83 c3 01             	add    $0x1,%ebx
+     de4:	eb d0                	jmp    db6 <writetest1+0x38>
+    printf(stdout, "error: creat big failed!\n");
+     de6:	83 ec 08             	sub    $0x8,%esp
+     de9:	68 51 af 00 00       	push   $0xaf51
+     dee:	ff 35 a4 04 01 00    	push   0x104a4
+     df4:	e8 18 97 00 00       	call   a511 <printf>
+    exit();
+     df9:	e8 da 91 00 00       	call   9fd8 <exit>
+      printf(stdout, "error: write big file failed\n", i);
+     dfe:	83 ec 04             	sub    $0x4,%esp
+     e01:	53                   	push   %ebx
+     e02:	68 6b af 00 00       	push   $0xaf6b
+     e07:	ff 35 a4 04 01 00    	push   0x104a4
+     e0d:	e8 ff 96 00 00       	call   a511 <printf>
+      exit();
+     e12:	e8 c1 91 00 00       	call   9fd8 <exit>
+  close(fd);
+     e17:	83 ec 0c             	sub    $0xc,%esp
+     e1a:	56                   	push   %esi
+     e1b:	e8 e7 91 00 00       	call   a007 <close>
+  fd = open("big", O_RDONLY);
+     e20:	83 c4 08             	add    $0x8,%esp
+     e23:	6a 00                	push   $0x0
+     e25:	68 bb af 00 00       	push   $0xafbb
+     e2a:	e8 fa 92 00 00       	call   a129 <open>
+     e2f:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+     e31:	83 c4 10             	add    $0x10,%esp
+     e34:	85 c0                	test   %eax,%eax
+     e36:	78 3c                	js     e74 <writetest1+0xf6>
+  n = 0;
+     e38:	bb 00 00 00 00       	mov    $0x0,%ebx
+    i = read(fd, buf, 512);
+     e3d:	83 ec 04             	sub    $0x4,%esp
+     e40:	68 00 02 00 00       	push   $0x200
+     e45:	68 a0 2c 01 00       	push   $0x12ca0
+     e4a:	56                   	push   %esi
+     e4b:	e8 ac 92 00 00       	call   a0fc <read>
+    if(i == 0){
+     e50:	83 c4 10             	add    $0x10,%esp
+     e53:	85 c0                	test   %eax,%eax
+     e55:	74 35                	je     e8c <writetest1+0x10e>
+    } else if(i != 512){
+     e57:	3d 00 02 00 00       	cmp    $0x200,%eax
+     e5c:	0f 85 84 00 00 00    	jne    ee6 <writetest1+0x168>
+    if(((int*)buf)[0] != n){
+     e62:	a1 a0 2c 01 00       	mov    0x12ca0,%eax
+     e67:	39 d8                	cmp    %ebx,%eax
+     e69:	0f 85 90 00 00 00    	jne    eff <writetest1+0x181>
+    n++;
+     e6f:	83 c3 01             	add    $0x1,%ebx
+    i = read(fd, buf, 512);
+     e72:	eb c9                	jmp    e3d <writetest1+0xbf>
+    printf(stdout, "error: open big failed!\n");
+     e74:	83 ec 08             	sub    $0x8,%esp
+     e77:	68 89 af 00 00       	push   $0xaf89
+     e7c:	ff 35 a4 04 01 00    	push   0x104a4
+     e82:	e8 8a 96 00 00       	call   a511 <printf>
+    exit();
+     e87:	e8 4c 91 00 00       	call   9fd8 <exit>
+      if(n == MAXFILE - 1){
+     e8c:	81 fb 8a 40 00 00    	cmp    $0x408a,%ebx
+     e92:	74 39                	je     ecd <writetest1+0x14f>
+  close(fd);
+     e94:	83 ec 0c             	sub    $0xc,%esp
+     e97:	56                   	push   %esi
+     e98:	e8 6a 91 00 00       	call   a007 <close>
+  if(unlink("big") < 0){
+     e9d:	c7 04 24 bb af 00 00 	movl   $0xafbb,(%esp)
+     ea4:	e8 9e 92 00 00       	call   a147 <unlink>
+     ea9:	83 c4 10             	add    $0x10,%esp
+     eac:	85 c0                	test   %eax,%eax
+     eae:	78 66                	js     f16 <writetest1+0x198>
+  printf(stdout, "big files ok\n");
+     eb0:	83 ec 08             	sub    $0x8,%esp
+     eb3:	68 e2 af 00 00       	push   $0xafe2
+     eb8:	ff 35 a4 04 01 00    	push   0x104a4
+     ebe:	e8 4e 96 00 00       	call   a511 <printf>
+}
+     ec3:	83 c4 10             	add    $0x10,%esp
+     ec6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     ec9:	5b                   	pop    %ebx
+     eca:	5e                   	pop    %esi
+     ecb:	5d                   	pop    %ebp
+     ecc:	c3                   	ret
+        printf(stdout, "read only %d blocks from big", n);
+     ecd:	83 ec 04             	sub    $0x4,%esp
+     ed0:	53                   	push   %ebx
+     ed1:	68 a2 af 00 00       	push   $0xafa2
+     ed6:	ff 35 a4 04 01 00    	push   0x104a4
+     edc:	e8 30 96 00 00       	call   a511 <printf>
+        exit();
+     ee1:	e8 f2 90 00 00       	call   9fd8 <exit>
+      printf(stdout, "read failed %d\n", i);
+     ee6:	83 ec 04             	sub    $0x4,%esp
+     ee9:	50                   	push   %eax
+     eea:	68 bf af 00 00       	push   $0xafbf
+     eef:	ff 35 a4 04 01 00    	push   0x104a4
+     ef5:	e8 17 96 00 00       	call   a511 <printf>
+      exit();
+     efa:	e8 d9 90 00 00       	call   9fd8 <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     eff:	50                   	push   %eax
+     f00:	53                   	push   %ebx
+     f01:	68 a8 d6 00 00       	push   $0xd6a8
+     f06:	ff 35 a4 04 01 00    	push   0x104a4
+     f0c:	e8 00 96 00 00       	call   a511 <printf>
+      exit();
+     f11:	e8 c2 90 00 00       	call   9fd8 <exit>
+    printf(stdout, "unlink big failed\n");
+     f16:	83 ec 08             	sub    $0x8,%esp
+     f19:	68 cf af 00 00       	push   $0xafcf
+     f1e:	ff 35 a4 04 01 00    	push   0x104a4
+     f24:	e8 e8 95 00 00       	call   a511 <printf>
+    exit();
+     f29:	e8 aa 90 00 00       	call   9fd8 <exit>
+
+00000f2e <unlinkread>:
+{
+     f2e:	55                   	push   %ebp
+     f2f:	89 e5                	mov    %esp,%ebp
+     f31:	56                   	push   %esi
+     f32:	53                   	push   %ebx
+  printf(1, "unlinkread test\n");
+     f33:	83 ec 08             	sub    $0x8,%esp
+     f36:	68 f0 af 00 00       	push   $0xaff0
+     f3b:	6a 01                	push   $0x1
+     f3d:	e8 cf 95 00 00       	call   a511 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+     f42:	83 c4 08             	add    $0x8,%esp
+     f45:	68 02 02 00 00       	push   $0x202
+     f4a:	68 01 b0 00 00       	push   $0xb001
+     f4f:	e8 d5 91 00 00       	call   a129 <open>
+  if(fd < 0){
+     f54:	83 c4 10             	add    $0x10,%esp
+     f57:	85 c0                	test   %eax,%eax
+     f59:	0f 88 f0 00 00 00    	js     104f <unlinkread+0x121>
+     f5f:	89 c3                	mov    %eax,%ebx
+  write(fd, "hello", 5);
+     f61:	83 ec 04             	sub    $0x4,%esp
+     f64:	6a 05                	push   $0x5
+     f66:	68 26 b0 00 00       	push   $0xb026
+     f6b:	50                   	push   %eax
+     f6c:	e8 9a 91 00 00       	call   a10b <write>
+  close(fd);
+     f71:	89 1c 24             	mov    %ebx,(%esp)
+     f74:	e8 8e 90 00 00       	call   a007 <close>
+  fd = open("unlinkread", O_RDWR);
+     f79:	83 c4 08             	add    $0x8,%esp
+     f7c:	6a 02                	push   $0x2
+     f7e:	68 01 b0 00 00       	push   $0xb001
+     f83:	e8 a1 91 00 00       	call   a129 <open>
+     f88:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     f8a:	83 c4 10             	add    $0x10,%esp
+     f8d:	85 c0                	test   %eax,%eax
+     f8f:	0f 88 ce 00 00 00    	js     1063 <unlinkread+0x135>
+  if(unlink("unlinkread") != 0){
+     f95:	83 ec 0c             	sub    $0xc,%esp
+     f98:	68 01 b0 00 00       	push   $0xb001
+     f9d:	e8 a5 91 00 00       	call   a147 <unlink>
+     fa2:	83 c4 10             	add    $0x10,%esp
+     fa5:	85 c0                	test   %eax,%eax
+     fa7:	0f 85 ca 00 00 00    	jne    1077 <unlinkread+0x149>
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+     fad:	83 ec 08             	sub    $0x8,%esp
+     fb0:	68 02 02 00 00       	push   $0x202
+     fb5:	68 01 b0 00 00       	push   $0xb001
+     fba:	e8 6a 91 00 00       	call   a129 <open>
+     fbf:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+     fc1:	83 c4 0c             	add    $0xc,%esp
+     fc4:	6a 03                	push   $0x3
+     fc6:	68 5e b0 00 00       	push   $0xb05e
+     fcb:	50                   	push   %eax
+     fcc:	e8 3a 91 00 00       	call   a10b <write>
+  close(fd1);
+     fd1:	89 34 24             	mov    %esi,(%esp)
+     fd4:	e8 2e 90 00 00       	call   a007 <close>
+  if(read(fd, buf, sizeof(buf)) != 5){
+     fd9:	83 c4 0c             	add    $0xc,%esp
+     fdc:	68 00 20 00 00       	push   $0x2000
+     fe1:	68 a0 2c 01 00       	push   $0x12ca0
+     fe6:	53                   	push   %ebx
+     fe7:	e8 10 91 00 00       	call   a0fc <read>
+     fec:	83 c4 10             	add    $0x10,%esp
+     fef:	83 f8 05             	cmp    $0x5,%eax
+     ff2:	0f 85 93 00 00 00    	jne    108b <unlinkread+0x15d>
+  if(buf[0] != 'h'){
+     ff8:	80 3d a0 2c 01 00 68 	cmpb   $0x68,0x12ca0
+     fff:	0f 85 9a 00 00 00    	jne    109f <unlinkread+0x171>
+  if(write(fd, buf, 10) != 10){
+    1005:	83 ec 04             	sub    $0x4,%esp
+    1008:	6a 0a                	push   $0xa
+    100a:	68 a0 2c 01 00       	push   $0x12ca0
+    100f:	53                   	push   %ebx
+    1010:	e8 f6 90 00 00       	call   a10b <write>
+    1015:	83 c4 10             	add    $0x10,%esp
+    1018:	83 f8 0a             	cmp    $0xa,%eax
+    101b:	0f 85 92 00 00 00    	jne    10b3 <unlinkread+0x185>
+  close(fd);
+    1021:	83 ec 0c             	sub    $0xc,%esp
+    1024:	53                   	push   %ebx
+    1025:	e8 dd 8f 00 00       	call   a007 <close>
+  unlink("unlinkread");
+    102a:	c7 04 24 01 b0 00 00 	movl   $0xb001,(%esp)
+    1031:	e8 11 91 00 00       	call   a147 <unlink>
+  printf(1, "unlinkread ok\n");
+    1036:	83 c4 08             	add    $0x8,%esp
+    1039:	68 a9 b0 00 00       	push   $0xb0a9
+    103e:	6a 01                	push   $0x1
+    1040:	e8 cc 94 00 00       	call   a511 <printf>
+}
+    1045:	83 c4 10             	add    $0x10,%esp
+    1048:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    104b:	5b                   	pop    %ebx
+    104c:	5e                   	pop    %esi
+    104d:	5d                   	pop    %ebp
+    104e:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    104f:	83 ec 08             	sub    $0x8,%esp
+    1052:	68 0c b0 00 00       	push   $0xb00c
+    1057:	6a 01                	push   $0x1
+    1059:	e8 b3 94 00 00       	call   a511 <printf>
+    exit();
+    105e:	e8 75 8f 00 00       	call   9fd8 <exit>
+    printf(1, "open unlinkread failed\n");
+    1063:	83 ec 08             	sub    $0x8,%esp
+    1066:	68 2c b0 00 00       	push   $0xb02c
+    106b:	6a 01                	push   $0x1
+    106d:	e8 9f 94 00 00       	call   a511 <printf>
+    exit();
+    1072:	e8 61 8f 00 00       	call   9fd8 <exit>
+    printf(1, "unlink unlinkread failed\n");
+    1077:	83 ec 08             	sub    $0x8,%esp
+    107a:	68 44 b0 00 00       	push   $0xb044
+    107f:	6a 01                	push   $0x1
+    1081:	e8 8b 94 00 00       	call   a511 <printf>
+    exit();
+    1086:	e8 4d 8f 00 00       	call   9fd8 <exit>
+    printf(1, "unlinkread read failed");
+    108b:	83 ec 08             	sub    $0x8,%esp
+    108e:	68 62 b0 00 00       	push   $0xb062
+    1093:	6a 01                	push   $0x1
+    1095:	e8 77 94 00 00       	call   a511 <printf>
+    exit();
+    109a:	e8 39 8f 00 00       	call   9fd8 <exit>
+    printf(1, "unlinkread wrong data\n");
+    109f:	83 ec 08             	sub    $0x8,%esp
+    10a2:	68 79 b0 00 00       	push   $0xb079
+    10a7:	6a 01                	push   $0x1
+    10a9:	e8 63 94 00 00       	call   a511 <printf>
+    exit();
+    10ae:	e8 25 8f 00 00       	call   9fd8 <exit>
+    printf(1, "unlinkread write failed\n");
+    10b3:	83 ec 08             	sub    $0x8,%esp
+    10b6:	68 90 b0 00 00       	push   $0xb090
+    10bb:	6a 01                	push   $0x1
+    10bd:	e8 4f 94 00 00       	call   a511 <printf>
+    exit();
+    10c2:	e8 11 8f 00 00       	call   9fd8 <exit>
+
+000010c7 <reclaimtest>:
+{
+    10c7:	55                   	push   %ebp
+    10c8:	89 e5                	mov    %esp,%ebp
+    10ca:	57                   	push   %edi
+    10cb:	56                   	push   %esi
+    10cc:	53                   	push   %ebx
+    10cd:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "reclaim test\n");
+    10d0:	68 b8 b0 00 00       	push   $0xb0b8
+    10d5:	6a 01                	push   $0x1
+    10d7:	e8 35 94 00 00       	call   a511 <printf>
+  for(k = 0; k < 8; k++){
+    10dc:	83 c4 10             	add    $0x10,%esp
+    10df:	be 00 00 00 00       	mov    $0x0,%esi
+    10e4:	e9 b7 00 00 00       	jmp    11a0 <reclaimtest+0xd9>
+      printf(1, "reclaim: create failed\n");
+    10e9:	83 ec 08             	sub    $0x8,%esp
+    10ec:	68 ce b0 00 00       	push   $0xb0ce
+    10f1:	6a 01                	push   $0x1
+    10f3:	e8 19 94 00 00       	call   a511 <printf>
+      exit();
+    10f8:	e8 db 8e 00 00       	call   9fd8 <exit>
+        printf(1, "reclaim: write failed, round %d\n", k);
+    10fd:	83 ec 04             	sub    $0x4,%esp
+    1100:	56                   	push   %esi
+    1101:	68 c8 d6 00 00       	push   $0xd6c8
+    1106:	6a 01                	push   $0x1
+    1108:	e8 04 94 00 00       	call   a511 <printf>
+        exit();
+    110d:	e8 c6 8e 00 00       	call   9fd8 <exit>
+    close(fd);
+    1112:	83 ec 0c             	sub    $0xc,%esp
+    1115:	57                   	push   %edi
+    1116:	e8 ec 8e 00 00       	call   a007 <close>
+    fd = open("reclaim", 0);
+    111b:	83 c4 08             	add    $0x8,%esp
+    111e:	6a 00                	push   $0x0
+    1120:	68 c6 b0 00 00       	push   $0xb0c6
+    1125:	e8 ff 8f 00 00       	call   a129 <open>
+    112a:	89 c7                	mov    %eax,%edi
+    for(i = 0; i < 600; i++){
+    112c:	83 c4 10             	add    $0x10,%esp
+    112f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1134:	81 fb 57 02 00 00    	cmp    $0x257,%ebx
+    113a:	7f 45                	jg     1181 <reclaimtest+0xba>
+      if(read(fd, buf, 512) != 512 || ((int*)buf)[0] != k*1000 + i){
+    113c:	83 ec 04             	sub    $0x4,%esp
+    113f:	68 00 02 00 00       	push   $0x200
+    1144:	68 a0 2c 01 00       	push   $0x12ca0
+    1149:	57                   	push   %edi
+    114a:	e8 ad 8f 00 00       	call   a0fc <read>
+    114f:	83 c4 10             	add    $0x10,%esp
+    1152:	3d 00 02 00 00       	cmp    $0x200,%eax
+    1157:	75 15                	jne    116e <reclaimtest+0xa7>
+    1159:	69 c6 e8 03 00 00    	imul   $0x3e8,%esi,%eax
+    115f:	01 d8                	add    %ebx,%eax
+    1161:	39 05 a0 2c 01 00    	cmp    %eax,0x12ca0
+    1167:	75 05                	jne    116e <reclaimtest+0xa7>
+    for(i = 0; i < 600; i++){
+    1169:	83 c3 01             	add    $0x1,%ebx
+    116c:	eb c6                	jmp    1134 <reclaimtest+0x6d>
+        printf(1, "reclaim: bad block %d, round %d\n", i, k);
+    116e:	56                   	push   %esi
+    116f:	53                   	push   %ebx
+    1170:	68 ec d6 00 00       	push   $0xd6ec
+    1175:	6a 01                	push   $0x1
+    1177:	e8 95 93 00 00       	call   a511 <printf>
+        exit();
+    117c:	e8 57 8e 00 00       	call   9fd8 <exit>
+    close(fd);
+    1181:	83 ec 0c             	sub    $0xc,%esp
+    1184:	57                   	push   %edi
+    1185:	e8 7d 8e 00 00       	call   a007 <close>
+    if(unlink("reclaim") < 0){
+    118a:	c7 04 24 c6 b0 00 00 	movl   $0xb0c6,(%esp)
+    1191:	e8 b1 8f 00 00       	call   a147 <unlink>
+    1196:	83 c4 10             	add    $0x10,%esp
+    1199:	85 c0                	test   %eax,%eax
+    119b:	78 6b                	js     1208 <reclaimtest+0x141>
+  for(k = 0; k < 8; k++){
+    119d:	83 c6 01             	add    $0x1,%esi
+    11a0:	83 fe 07             	cmp    $0x7,%esi
+    11a3:	7f 77                	jg     121c <reclaimtest+0x155>
+    if((fd = open("reclaim", O_CREATE|O_RDWR)) < 0){
+    11a5:	83 ec 08             	sub    $0x8,%esp
+    11a8:	68 02 02 00 00       	push   $0x202
+    11ad:	68 c6 b0 00 00       	push   $0xb0c6
+    11b2:	e8 72 8f 00 00       	call   a129 <open>
+    11b7:	89 c7                	mov    %eax,%edi
+    11b9:	83 c4 10             	add    $0x10,%esp
+    11bc:	85 c0                	test   %eax,%eax
+    11be:	0f 88 25 ff ff ff    	js     10e9 <reclaimtest+0x22>
+    for(i = 0; i < 600; i++){
+    11c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    11c9:	81 fb 57 02 00 00    	cmp    $0x257,%ebx
+    11cf:	0f 8f 3d ff ff ff    	jg     1112 <reclaimtest+0x4b>
+      ((int*)buf)[0] = k*1000 + i;
+    11d5:	69 c6 e8 03 00 00    	imul   $0x3e8,%esi,%eax
+    11db:	01 d8                	add    %ebx,%eax
+    11dd:	a3 a0 2c 01 00       	mov    %eax,0x12ca0
+      if(write(fd, buf, 512) != 512){
+    11e2:	83 ec 04             	sub    $0x4,%esp
+    11e5:	68 00 02 00 00       	push   $0x200
+    11ea:	68 a0 2c 01 00       	push   $0x12ca0
+    11ef:	57                   	push   %edi
+    11f0:	e8 16 8f 00 00       	call   a10b <write>
+    11f5:	83 c4 10             	add    $0x10,%esp
+    11f8:	3d 00 02 00 00       	cmp    $0x200,%eax
+    11fd:	0f 85 fa fe ff ff    	jne    10fd <reclaimtest+0x36>
+    for(i = 0; i < 600; i++){
+    1203:	83 c3 01             	add    $0x1,%ebx
+    1206:	eb c1                	jmp    11c9 <reclaimtest+0x102>
+      printf(1, "reclaim: unlink failed\n");
+    1208:	83 ec 08             	sub    $0x8,%esp
+    120b:	68 e6 b0 00 00       	push   $0xb0e6
+    1210:	6a 01                	push   $0x1
+    1212:	e8 fa 92 00 00       	call   a511 <printf>
+      exit();
+    1217:	e8 bc 8d 00 00       	call   9fd8 <exit>
+  printf(1, "reclaim test OK\n");
+    121c:	83 ec 08             	sub    $0x8,%esp
+    121f:	68 fe b0 00 00       	push   $0xb0fe
+    1224:	6a 01                	push   $0x1
+    1226:	e8 e6 92 00 00       	call   a511 <printf>
+}
+    122b:	83 c4 10             	add    $0x10,%esp
+    122e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1231:	5b                   	pop    %ebx
+    1232:	5e                   	pop    %esi
+    1233:	5f                   	pop    %edi
+    1234:	5d                   	pop    %ebp
+    1235:	c3                   	ret
+
+00001236 <hashdirtest>:
+{
+    1236:	55                   	push   %ebp
+    1237:	89 e5                	mov    %esp,%ebp
+    1239:	57                   	push   %edi
+    123a:	56                   	push   %esi
+    123b:	53                   	push   %ebx
+    123c:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "hashdir test\n");
+    123f:	68 0f b1 00 00       	push   $0xb10f
+    1244:	6a 01                	push   $0x1
+    1246:	e8 c6 92 00 00       	call   a511 <printf>
+  if(mkdir("hd") < 0){
+    124b:	c7 04 24 1d b1 00 00 	movl   $0xb11d,(%esp)
+    1252:	e8 1d 8f 00 00       	call   a174 <mkdir>
+    1257:	83 c4 10             	add    $0x10,%esp
+    125a:	85 c0                	test   %eax,%eax
+    125c:	0f 88 a2 00 00 00    	js     1304 <hashdirtest+0xce>
+  name[0] = 'h';
+    1262:	c6 45 d0 68          	movb   $0x68,-0x30(%ebp)
+  name[1] = 'd';
+    1266:	c6 45 d1 64          	movb   $0x64,-0x2f(%ebp)
+  name[2] = '/';
+    126a:	c6 45 d2 2f          	movb   $0x2f,-0x2e(%ebp)
+  name[6] = '\0';
+    126e:	c6 45 d6 00          	movb   $0x0,-0x2a(%ebp)
+  for(i = 0; i < 300; i++){
+    1272:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1277:	81 fb 2b 01 00 00    	cmp    $0x12b,%ebx
+    127d:	0f 8f ad 00 00 00    	jg     1330 <hashdirtest+0xfa>
+    name[3] = 'a' + i/100;
+    1283:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    1288:	89 d8                	mov    %ebx,%eax
+    128a:	f7 ea                	imul   %edx
+    128c:	c1 fa 05             	sar    $0x5,%edx
+    128f:	89 df                	mov    %ebx,%edi
+    1291:	c1 ff 1f             	sar    $0x1f,%edi
+    1294:	29 fa                	sub    %edi,%edx
+    1296:	83 c2 61             	add    $0x61,%edx
+    1299:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+    name[4] = '0' + (i/10)%10;
+    129c:	b9 67 66 66 66       	mov    $0x66666667,%ecx
+    12a1:	89 d8                	mov    %ebx,%eax
+    12a3:	f7 e9                	imul   %ecx
+    12a5:	c1 fa 02             	sar    $0x2,%edx
+    12a8:	89 d6                	mov    %edx,%esi
+    12aa:	29 fe                	sub    %edi,%esi
+    12ac:	89 f0                	mov    %esi,%eax
+    12ae:	f7 e9                	imul   %ecx
+    12b0:	c1 fa 02             	sar    $0x2,%edx
+    12b3:	89 f0                	mov    %esi,%eax
+    12b5:	c1 f8 1f             	sar    $0x1f,%eax
+    12b8:	29 c2                	sub    %eax,%edx
+    12ba:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    12bd:	01 c0                	add    %eax,%eax
+    12bf:	89 f2                	mov    %esi,%edx
+    12c1:	29 c2                	sub    %eax,%edx
+    12c3:	83 c2 30             	add    $0x30,%edx
+    12c6:	88 55 d4             	mov    %dl,-0x2c(%ebp)
+    name[5] = '0' + i%10;
+    12c9:	8d 14 b6             	lea    (%esi,%esi,4),%edx
+    12cc:	01 d2                	add    %edx,%edx
+    12ce:	89 d8                	mov    %ebx,%eax
+    12d0:	29 d0                	sub    %edx,%eax
+    12d2:	83 c0 30             	add    $0x30,%eax
+    12d5:	88 45 d5             	mov    %al,-0x2b(%ebp)
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0){
+    12d8:	83 ec 08             	sub    $0x8,%esp
+    12db:	68 02 02 00 00       	push   $0x202
+    12e0:	8d 45 d0             	lea    -0x30(%ebp),%eax
+    12e3:	50                   	push   %eax
+    12e4:	e8 40 8e 00 00       	call   a129 <open>
+    12e9:	83 c4 10             	add    $0x10,%esp
+    12ec:	85 c0                	test   %eax,%eax
+    12ee:	78 28                	js     1318 <hashdirtest+0xe2>
+    close(fd);
+    12f0:	83 ec 0c             	sub    $0xc,%esp
+    12f3:	50                   	push   %eax
+    12f4:	e8 0e 8d 00 00       	call   a007 <close>
+  for(i = 0; i < 300; i++){
+    12f9:	83 c3 01             	add    $0x1,%ebx
+    12fc:	83 c4 10             	add    $0x10,%esp
+    12ff:	e9 73 ff ff ff       	jmp    1277 <hashdirtest+0x41>
+    printf(1, "hashdir: mkdir failed\n");
+    1304:	83 ec 08             	sub    $0x8,%esp
+    1307:	68 20 b1 00 00       	push   $0xb120
+    130c:	6a 01                	push   $0x1
+    130e:	e8 fe 91 00 00       	call   a511 <printf>
+    exit();
+    1313:	e8 c0 8c 00 00       	call   9fd8 <exit>
+      printf(1, "hashdir: create %s failed\n", name);
+    1318:	83 ec 04             	sub    $0x4,%esp
+    131b:	8d 45 d0             	lea    -0x30(%ebp),%eax
+    131e:	50                   	push   %eax
+    131f:	68 37 b1 00 00       	push   $0xb137
+    1324:	6a 01                	push   $0x1
+    1326:	e8 e6 91 00 00       	call   a511 <printf>
+      exit();
+    132b:	e8 a8 8c 00 00       	call   9fd8 <exit>
+  for(i = 0; i < 300; i++){
+    1330:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1335:	eb 1b                	jmp    1352 <hashdirtest+0x11c>
+      printf(1, "hashdir: %s not found\n", name);
+    1337:	83 ec 04             	sub    $0x4,%esp
+    133a:	8d 45 d0             	lea    -0x30(%ebp),%eax
+    133d:	50                   	push   %eax
+    133e:	68 52 b1 00 00       	push   $0xb152
+    1343:	6a 01                	push   $0x1
+    1345:	e8 c7 91 00 00       	call   a511 <printf>
+      exit();
+    134a:	e8 89 8c 00 00       	call   9fd8 <exit>
+  for(i = 0; i < 300; i++){
+    134f:	83 c3 01             	add    $0x1,%ebx
+    1352:	81 fb 2b 01 00 00    	cmp    $0x12b,%ebx
+    1358:	0f 8f b2 00 00 00    	jg     1410 <hashdirtest+0x1da>
+    name[3] = 'a' + i/100;
+    135e:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    1363:	89 d8                	mov    %ebx,%eax
+    1365:	f7 ea                	imul   %edx
+    1367:	c1 fa 05             	sar    $0x5,%edx
+    136a:	89 df                	mov    %ebx,%edi
+    136c:	c1 ff 1f             	sar    $0x1f,%edi
+    136f:	29 fa                	sub    %edi,%edx
+    1371:	83 c2 61             	add    $0x61,%edx
+    1374:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+    name[4] = '0' + (i/10)%10;
+    1377:	b9 67 66 66 66       	mov    $0x66666667,%ecx
+    137c:	89 d8                	mov    %ebx,%eax
+    137e:	f7 e9                	imul   %ecx
+    1380:	c1 fa 02             	sar    $0x2,%edx
+    1383:	89 d6                	mov    %edx,%esi
+    1385:	29 fe                	sub    %edi,%esi
+    1387:	89 f0                	mov    %esi,%eax
+    1389:	f7 e9                	imul   %ecx
+    138b:	c1 fa 02             	sar    $0x2,%edx
+    138e:	89 f0                	mov    %esi,%eax
+    1390:	c1 f8 1f             	sar    $0x1f,%eax
+    1393:	29 c2                	sub    %eax,%edx
+    1395:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    1398:	01 c0                	add    %eax,%eax
+    139a:	89 f2                	mov    %esi,%edx
+    139c:	29 c2                	sub    %eax,%edx
+    139e:	83 c2 30             	add    $0x30,%edx
+    13a1:	88 55 d4             	mov    %dl,-0x2c(%ebp)
+    name[5] = '0' + i%10;
+    13a4:	8d 14 b6             	lea    (%esi,%esi,4),%edx
+    13a7:	01 d2                	add    %edx,%edx
+    13a9:	89 d8                	mov    %ebx,%eax
+    13ab:	29 d0                	sub    %edx,%eax
+    13ad:	83 c0 30             	add    $0x30,%eax
+    13b0:	88 45 d5             	mov    %al,-0x2b(%ebp)
+    if((fd = open(name, 0)) < 0){
+    13b3:	83 ec 08             	sub    $0x8,%esp
+    13b6:	6a 00                	push   $0x0
+    13b8:	8d 45 d0             	lea    -0x30(%ebp),%eax
+    13bb:	50                   	push   %eax
+    13bc:	e8 68 8d 00 00       	call   a129 <open>
+    13c1:	83 c4 10             	add    $0x10,%esp
+    13c4:	85 c0                	test   %eax,%eax
+    13c6:	0f 88 6b ff ff ff    	js     1337 <hashdirtest+0x101>
+    close(fd);
+    13cc:	83 ec 0c             	sub    $0xc,%esp
+    13cf:	50                   	push   %eax
+    13d0:	e8 32 8c 00 00       	call   a007 <close>
+    if(i%2 == 0 && unlink(name) < 0){
+    13d5:	83 c4 10             	add    $0x10,%esp
+    13d8:	f6 c3 01             	test   $0x1,%bl
+    13db:	0f 85 6e ff ff ff    	jne    134f <hashdirtest+0x119>
+    13e1:	83 ec 0c             	sub    $0xc,%esp
+    13e4:	8d 45 d0             	lea    -0x30(%ebp),%eax
+    13e7:	50                   	push   %eax
+    13e8:	e8 5a 8d 00 00       	call   a147 <unlink>
+    13ed:	83 c4 10             	add    $0x10,%esp
+    13f0:	85 c0                	test   %eax,%eax
+    13f2:	0f 89 57 ff ff ff    	jns    134f <hashdirtest+0x119>
+      printf(1, "hashdir: unlink %s failed\n", name);
+    13f8:	83 ec 04             	sub    $0x4,%esp
+    13fb:	8d 45 d0             	lea    -0x30(%ebp),%eax
+    13fe:	50                   	push   %eax
+    13ff:	68 69 b1 00 00       	push   $0xb169
+    1404:	6a 01                	push   $0x1
+    1406:	e8 06 91 00 00       	call   a511 <printf>
+      exit();
+    140b:	e8 c8 8b 00 00       	call   9fd8 <exit>
+  fd = open("hd", 0);
+    1410:	83 ec 08             	sub    $0x8,%esp
+    1413:	6a 00                	push   $0x0
+    1415:	68 1d b1 00 00       	push   $0xb11d
+    141a:	e8 0a 8d 00 00       	call   a129 <open>
+    141f:	89 c3                	mov    %eax,%ebx
+  while(read(fd, &de, sizeof(de)) == sizeof(de))
+    1421:	83 c4 10             	add    $0x10,%esp
+  n = 0;
+    1424:	be 00 00 00 00       	mov    $0x0,%esi
+  while(read(fd, &de, sizeof(de)) == sizeof(de))
+    1429:	83 ec 04             	sub    $0x4,%esp
+    142c:	6a 10                	push   $0x10
+    142e:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    1431:	50                   	push   %eax
+    1432:	53                   	push   %ebx
+    1433:	e8 c4 8c 00 00       	call   a0fc <read>
+    1438:	83 c4 10             	add    $0x10,%esp
+    143b:	83 f8 10             	cmp    $0x10,%eax
+    143e:	75 0c                	jne    144c <hashdirtest+0x216>
+    if(de.inum != 0)
+    1440:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+    1445:	74 e2                	je     1429 <hashdirtest+0x1f3>
+      n++;
+    1447:	83 c6 01             	add    $0x1,%esi
+    144a:	eb dd                	jmp    1429 <hashdirtest+0x1f3>
+  close(fd);
+    144c:	83 ec 0c             	sub    $0xc,%esp
+    144f:	53                   	push   %ebx
+    1450:	e8 b2 8b 00 00       	call   a007 <close>
+  if(n != 150 + 2){
+    1455:	83 c4 10             	add    $0x10,%esp
+    1458:	81 fe 98 00 00 00    	cmp    $0x98,%esi
+    145e:	0f 85 ae 00 00 00    	jne    1512 <hashdirtest+0x2dc>
+  if(unlink("hd") == 0){
+    1464:	83 ec 0c             	sub    $0xc,%esp
+    1467:	68 1d b1 00 00       	push   $0xb11d
+    146c:	e8 d6 8c 00 00       	call   a147 <unlink>
+    1471:	83 c4 10             	add    $0x10,%esp
+    1474:	85 c0                	test   %eax,%eax
+    1476:	0f 84 ab 00 00 00    	je     1527 <hashdirtest+0x2f1>
+  for(i = 1; i < 300; i += 2){
+    147c:	bb 01 00 00 00       	mov    $0x1,%ebx
+    1481:	81 fb 2b 01 00 00    	cmp    $0x12b,%ebx
+    1487:	0f 8f c6 00 00 00    	jg     1553 <hashdirtest+0x31d>
+    name[3] = 'a' + i/100;
+    148d:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    1492:	89 d8                	mov    %ebx,%eax
+    1494:	f7 ea                	imul   %edx
+    1496:	c1 fa 05             	sar    $0x5,%edx
+    1499:	89 df                	mov    %ebx,%edi
+    149b:	c1 ff 1f             	sar    $0x1f,%edi
+    149e:	29 fa                	sub    %edi,%edx
+    14a0:	83 c2 61             	add    $0x61,%edx
+    14a3:	88 55 d3             	mov    %dl,-0x2d(%ebp)
+    name[4] = '0' + (i/10)%10;
+    14a6:	b9 67 66 66 66       	mov    $0x66666667,%ecx
+    14ab:	89 d8                	mov    %ebx,%eax
+    14ad:	f7 e9                	imul   %ecx
+    14af:	c1 fa 02             	sar    $0x2,%edx
+    14b2:	89 d6                	mov    %edx,%esi
+    14b4:	29 fe                	sub    %edi,%esi
+    14b6:	89 f0                	mov    %esi,%eax
+    14b8:	f7 e9                	imul   %ecx
+    14ba:	c1 fa 02             	sar    $0x2,%edx
+    14bd:	89 f0                	mov    %esi,%eax
+    14bf:	c1 f8 1f             	sar    $0x1f,%eax
+    14c2:	29 c2                	sub    %eax,%edx
+    14c4:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    14c7:	01 c0                	add    %eax,%eax
+    14c9:	89 f2                	mov    %esi,%edx
+    14cb:	29 c2                	sub    %eax,%edx
+    14cd:	83 c2 30             	add    $0x30,%edx
+    14d0:	88 55 d4             	mov    %dl,-0x2c(%ebp)
+    name[5] = '0' + i%10;
+    14d3:	8d 14 b6             	lea    (%esi,%esi,4),%edx
+    14d6:	01 d2                	add    %edx,%edx
+    14d8:	89 d8                	mov    %ebx,%eax
+    14da:	29 d0                	sub    %edx,%eax
+    14dc:	83 c0 30             	add    $0x30,%eax
+    14df:	88 45 d5             	mov    %al,-0x2b(%ebp)
+    if(unlink(name) < 0 || open(name, 0) >= 0){
+    14e2:	83 ec 0c             	sub    $0xc,%esp
+    14e5:	8d 45 d0             	lea    -0x30(%ebp),%eax
+    14e8:	50                   	push   %eax
+    14e9:	e8 59 8c 00 00       	call   a147 <unlink>
+    14ee:	83 c4 10             	add    $0x10,%esp
+    14f1:	85 c0                	test   %eax,%eax
+    14f3:	78 46                	js     153b <hashdirtest+0x305>
+    14f5:	83 ec 08             	sub    $0x8,%esp
+    14f8:	6a 00                	push   $0x0
+    14fa:	8d 45 d0             	lea    -0x30(%ebp),%eax
+    14fd:	50                   	push   %eax
+    14fe:	e8 26 8c 00 00       	call   a129 <open>
+    1503:	83 c4 10             	add    $0x10,%esp
+    1506:	85 c0                	test   %eax,%eax
+    1508:	79 31                	jns    153b <hashdirtest+0x305>
+  for(i = 1; i < 300; i += 2){
+    150a:	83 c3 02             	add    $0x2,%ebx
+    150d:	e9 6f ff ff ff       	jmp    1481 <hashdirtest+0x24b>
+    printf(1, "hashdir: %d entries listed\n", n);
+    1512:	83 ec 04             	sub    $0x4,%esp
+    1515:	56                   	push   %esi
+    1516:	68 84 b1 00 00       	push   $0xb184
+    151b:	6a 01                	push   $0x1
+    151d:	e8 ef 8f 00 00       	call   a511 <printf>
+    exit();
+    1522:	e8 b1 8a 00 00       	call   9fd8 <exit>
+    printf(1, "hashdir: unlinked a non-empty directory\n");
+    1527:	83 ec 08             	sub    $0x8,%esp
+    152a:	68 10 d7 00 00       	push   $0xd710
+    152f:	6a 01                	push   $0x1
+    1531:	e8 db 8f 00 00       	call   a511 <printf>
+    exit();
+    1536:	e8 9d 8a 00 00       	call   9fd8 <exit>
+      printf(1, "hashdir: unlink %s failed\n", name);
+    153b:	83 ec 04             	sub    $0x4,%esp
+    153e:	8d 45 d0             	lea    -0x30(%ebp),%eax
+    1541:	50                   	push   %eax
+    1542:	68 69 b1 00 00       	push   $0xb169
+    1547:	6a 01                	push   $0x1
+    1549:	e8 c3 8f 00 00       	call   a511 <printf>
+      exit();
+    154e:	e8 85 8a 00 00       	call   9fd8 <exit>
+  if(unlink("hd") < 0){
+    1553:	83 ec 0c             	sub    $0xc,%esp
+    1556:	68 1d b1 00 00       	push   $0xb11d
+    155b:	e8 e7 8b 00 00       	call   a147 <unlink>
+    1560:	83 c4 10             	add    $0x10,%esp
+    1563:	85 c0                	test   %eax,%eax
+    1565:	78 1a                	js     1581 <hashdirtest+0x34b>
+  printf(1, "hashdir test OK\n");
+    1567:	83 ec 08             	sub    $0x8,%esp
+    156a:	68 bb b1 00 00       	push   $0xb1bb
+    156f:	6a 01                	push   $0x1
+    1571:	e8 9b 8f 00 00       	call   a511 <printf>
+}
+    1576:	83 c4 10             	add    $0x10,%esp
+    1579:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    157c:	5b                   	pop    %ebx
+    157d:	5e                   	pop    %esi
+    157e:	5f                   	pop    %edi
+    157f:	5d                   	pop    %ebp
+    1580:	c3                   	ret
+    printf(1, "hashdir: unlink hd failed\n");
+    1581:	83 ec 08             	sub    $0x8,%esp
+    1584:	68 a0 b1 00 00       	push   $0xb1a0
+    1589:	6a 01                	push   $0x1
+    158b:	e8 81 8f 00 00       	call   a511 <printf>
+    exit();
+    1590:	e8 43 8a 00 00       	call   9fd8 <exit>
+
+00001595 <extenttest>:
+{
+    1595:	55                   	push   %ebp
+    1596:	89 e5                	mov    %esp,%ebp
+    1598:	57                   	push   %edi
+    1599:	56                   	push   %esi
+    159a:	53                   	push   %ebx
+    159b:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "extent test\n");
+    159e:	68 cc b1 00 00       	push   $0xb1cc
+    15a3:	6a 01                	push   $0x1
+    15a5:	e8 67 8f 00 00       	call   a511 <printf>
+  unlink("extent");
+    15aa:	c7 04 24 d9 b1 00 00 	movl   $0xb1d9,(%esp)
+    15b1:	e8 91 8b 00 00       	call   a147 <unlink>
+  for(pass = 0; pass < 3; pass++){
+    15b6:	83 c4 10             	add    $0x10,%esp
+    15b9:	be 00 00 00 00       	mov    $0x0,%esi
+    15be:	e9 e6 00 00 00       	jmp    16a9 <extenttest+0x114>
+      printf(1, "extent: open failed\n");
+    15c3:	83 ec 08             	sub    $0x8,%esp
+    15c6:	68 e0 b1 00 00       	push   $0xb1e0
+    15cb:	6a 01                	push   $0x1
+    15cd:	e8 3f 8f 00 00       	call   a511 <printf>
+      exit();
+    15d2:	e8 01 8a 00 00       	call   9fd8 <exit>
+    for(n = 0; (i = read(fd, buf, 1000)) > 0; n += i)
+    15d7:	01 c3                	add    %eax,%ebx
+    15d9:	83 ec 04             	sub    $0x4,%esp
+    15dc:	68 e8 03 00 00       	push   $0x3e8
+    15e1:	68 a0 2c 01 00       	push   $0x12ca0
+    15e6:	57                   	push   %edi
+    15e7:	e8 10 8b 00 00       	call   a0fc <read>
+    15ec:	83 c4 10             	add    $0x10,%esp
+    15ef:	85 c0                	test   %eax,%eax
+    15f1:	7f e4                	jg     15d7 <extenttest+0x42>
+    if(n != pass*100*1000){
+    15f3:	69 c6 a0 86 01 00    	imul   $0x186a0,%esi,%eax
+    15f9:	39 d8                	cmp    %ebx,%eax
+    15fb:	75 0c                	jne    1609 <extenttest+0x74>
+    for(i = 0; i < 100; i++){
+    15fd:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    1604:	89 75 e0             	mov    %esi,-0x20(%ebp)
+    1607:	eb 6d                	jmp    1676 <extenttest+0xe1>
+      printf(1, "extent: file is %d bytes after pass %d\n", n, pass);
+    1609:	56                   	push   %esi
+    160a:	53                   	push   %ebx
+    160b:	68 3c d7 00 00       	push   $0xd73c
+    1610:	6a 01                	push   $0x1
+    1612:	e8 fa 8e 00 00       	call   a511 <printf>
+      exit();
+    1617:	e8 bc 89 00 00       	call   9fd8 <exit>
+        buf[j] = (n + j) % 253;
+    161c:	8d 34 19             	lea    (%ecx,%ebx,1),%esi
+    161f:	ba a9 8d 84 81       	mov    $0x81848da9,%edx
+    1624:	89 f0                	mov    %esi,%eax
+    1626:	f7 ea                	imul   %edx
+    1628:	01 f2                	add    %esi,%edx
+    162a:	c1 fa 07             	sar    $0x7,%edx
+    162d:	89 f0                	mov    %esi,%eax
+    162f:	c1 f8 1f             	sar    $0x1f,%eax
+    1632:	29 c2                	sub    %eax,%edx
+    1634:	69 c2 fd 00 00 00    	imul   $0xfd,%edx,%eax
+    163a:	29 c6                	sub    %eax,%esi
+    163c:	89 f2                	mov    %esi,%edx
+    163e:	88 91 a0 2c 01 00    	mov    %dl,0x12ca0(%ecx)
+      for(j = 0; j < 1000; j++)
+    1644:	83 c1 01             	add    $0x1,%ecx
+    1647:	81 f9 e7 03 00 00    	cmp    $0x3e7,%ecx
+    164d:	7e cd                	jle    161c <extenttest+0x87>
+      if(write(fd, buf, 1000) != 1000){
+    164f:	83 ec 04             	sub    $0x4,%esp
+    1652:	68 e8 03 00 00       	push   $0x3e8
+    1657:	68 a0 2c 01 00       	push   $0x12ca0
+    165c:	57                   	push   %edi
+    165d:	e8 a9 8a 00 00       	call   a10b <write>
+    1662:	83 c4 10             	add    $0x10,%esp
+    1665:	3d e8 03 00 00       	cmp    $0x3e8,%eax
+    166a:	75 17                	jne    1683 <extenttest+0xee>
+      n += 1000;
+    166c:	81 c3 e8 03 00 00    	add    $0x3e8,%ebx
+    for(i = 0; i < 100; i++){
+    1672:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+    1676:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+    167a:	7f 1b                	jg     1697 <extenttest+0x102>
+      for(j = 0; j < 1000; j++)
+    167c:	b9 00 00 00 00       	mov    $0x0,%ecx
+    1681:	eb c4                	jmp    1647 <extenttest+0xb2>
+        printf(1, "extent: write failed\n");
+    1683:	83 ec 08             	sub    $0x8,%esp
+    1686:	68 f5 b1 00 00       	push   $0xb1f5
+    168b:	6a 01                	push   $0x1
+    168d:	e8 7f 8e 00 00       	call   a511 <printf>
+        exit();
+    1692:	e8 41 89 00 00       	call   9fd8 <exit>
+    close(fd);
+    1697:	8b 75 e0             	mov    -0x20(%ebp),%esi
+    169a:	83 ec 0c             	sub    $0xc,%esp
+    169d:	57                   	push   %edi
+    169e:	e8 64 89 00 00       	call   a007 <close>
+  for(pass = 0; pass < 3; pass++){
+    16a3:	83 c6 01             	add    $0x1,%esi
+    16a6:	83 c4 10             	add    $0x10,%esp
+    16a9:	83 fe 02             	cmp    $0x2,%esi
+    16ac:	7f 29                	jg     16d7 <extenttest+0x142>
+    if((fd = open("extent", O_CREATE|O_RDWR)) < 0){
+    16ae:	83 ec 08             	sub    $0x8,%esp
+    16b1:	68 02 02 00 00       	push   $0x202
+    16b6:	68 d9 b1 00 00       	push   $0xb1d9
+    16bb:	e8 69 8a 00 00       	call   a129 <open>
+    16c0:	89 c7                	mov    %eax,%edi
+    16c2:	83 c4 10             	add    $0x10,%esp
+    16c5:	85 c0                	test   %eax,%eax
+    16c7:	0f 88 f6 fe ff ff    	js     15c3 <extenttest+0x2e>
+    for(n = 0; (i = read(fd, buf, 1000)) > 0; n += i)
+    16cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+    16d2:	e9 02 ff ff ff       	jmp    15d9 <extenttest+0x44>
+  if((fd = open("extent", 0)) < 0){
+    16d7:	83 ec 08             	sub    $0x8,%esp
+    16da:	6a 00                	push   $0x0
+    16dc:	68 d9 b1 00 00       	push   $0xb1d9
+    16e1:	e8 43 8a 00 00       	call   a129 <open>
+    16e6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    16e9:	83 c4 10             	add    $0x10,%esp
+    16ec:	85 c0                	test   %eax,%eax
+    16ee:	78 07                	js     16f7 <extenttest+0x162>
+  for(n = 0; (i = read(fd, buf, 777)) > 0; n += i)
+    16f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    16f5:	eb 5d                	jmp    1754 <extenttest+0x1bf>
+    printf(1, "extent: open failed\n");
+    16f7:	83 ec 08             	sub    $0x8,%esp
+    16fa:	68 e0 b1 00 00       	push   $0xb1e0
+    16ff:	6a 01                	push   $0x1
+    1701:	e8 0b 8e 00 00       	call   a511 <printf>
+    exit();
+    1706:	e8 cd 88 00 00       	call   9fd8 <exit>
+    for(j = 0; j < i; j++)
+    170b:	83 c6 01             	add    $0x1,%esi
+    170e:	39 fe                	cmp    %edi,%esi
+    1710:	7d 40                	jge    1752 <extenttest+0x1bd>
+      if(buf[j] != (char)((n + j) % 253)){
+    1712:	8d 0c 1e             	lea    (%esi,%ebx,1),%ecx
+    1715:	ba a9 8d 84 81       	mov    $0x81848da9,%edx
+    171a:	89 c8                	mov    %ecx,%eax
+    171c:	f7 ea                	imul   %edx
+    171e:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+    1721:	c1 f8 07             	sar    $0x7,%eax
+    1724:	89 ca                	mov    %ecx,%edx
+    1726:	c1 fa 1f             	sar    $0x1f,%edx
+    1729:	29 d0                	sub    %edx,%eax
+    172b:	69 d0 fd 00 00 00    	imul   $0xfd,%eax,%edx
+    1731:	89 c8                	mov    %ecx,%eax
+    1733:	29 d0                	sub    %edx,%eax
+    1735:	38 86 a0 2c 01 00    	cmp    %al,0x12ca0(%esi)
+    173b:	74 ce                	je     170b <extenttest+0x176>
+        printf(1, "extent: bad data at %d\n", n + j);
+    173d:	83 ec 04             	sub    $0x4,%esp
+    1740:	51                   	push   %ecx
+    1741:	68 0b b2 00 00       	push   $0xb20b
+    1746:	6a 01                	push   $0x1
+    1748:	e8 c4 8d 00 00       	call   a511 <printf>
+        exit();
+    174d:	e8 86 88 00 00       	call   9fd8 <exit>
+  for(n = 0; (i = read(fd, buf, 777)) > 0; n += i)
+    1752:	01 fb                	add    %edi,%ebx
+    1754:	83 ec 04             	sub    $0x4,%esp
+    1757:	68 09 03 00 00       	push   $0x309
+    175c:	68 a0 2c 01 00       	push   $0x12ca0
+    1761:	ff 75 e4             	push   -0x1c(%ebp)
+    1764:	e8 93 89 00 00       	call   a0fc <read>
+    1769:	89 c7                	mov    %eax,%edi
+    176b:	83 c4 10             	add    $0x10,%esp
+    176e:	85 c0                	test   %eax,%eax
+    1770:	7e 07                	jle    1779 <extenttest+0x1e4>
+    for(j = 0; j < i; j++)
+    1772:	be 00 00 00 00       	mov    $0x0,%esi
+    1777:	eb 95                	jmp    170e <extenttest+0x179>
+  close(fd);
+    1779:	83 ec 0c             	sub    $0xc,%esp
+    177c:	ff 75 e4             	push   -0x1c(%ebp)
+    177f:	e8 83 88 00 00       	call   a007 <close>
+  if(n != 300*1000){
+    1784:	83 c4 10             	add    $0x10,%esp
+    1787:	81 fb e0 93 04 00    	cmp    $0x493e0,%ebx
+    178d:	75 27                	jne    17b6 <extenttest+0x221>
+  unlink("extent");
+    178f:	83 ec 0c             	sub    $0xc,%esp
+    1792:	68 d9 b1 00 00       	push   $0xb1d9
+    1797:	e8 ab 89 00 00       	call   a147 <unlink>
+  printf(1, "extent test OK\n");
+    179c:	83 c4 08             	add    $0x8,%esp
+    179f:	68 3a b2 00 00       	push   $0xb23a
+    17a4:	6a 01                	push   $0x1
+    17a6:	e8 66 8d 00 00       	call   a511 <printf>
+}
+    17ab:	83 c4 10             	add    $0x10,%esp
+    17ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    17b1:	5b                   	pop    %ebx
+    17b2:	5e                   	pop    %esi
+    17b3:	5f                   	pop    %edi
+    17b4:	5d                   	pop    %ebp
+    17b5:	c3                   	ret
+    printf(1, "extent: read %d bytes\n", n);
+    17b6:	83 ec 04             	sub    $0x4,%esp
+    17b9:	53                   	push   %ebx
+    17ba:	68 23 b2 00 00       	push   $0xb223
+    17bf:	6a 01                	push   $0x1
+    17c1:	e8 4b 8d 00 00       	call   a511 <printf>
+    exit();
+    17c6:	e8 0d 88 00 00       	call   9fd8 <exit>
+
+000017cb <readaheadtest>:
+{
+    17cb:	55                   	push   %ebp
+    17cc:	89 e5                	mov    %esp,%ebp
+    17ce:	57                   	push   %edi
+    17cf:	56                   	push   %esi
+    17d0:	53                   	push   %ebx
+    17d1:	81 ec 44 01 00 00    	sub    $0x144,%esp
+  printf(1, "readahead test\n");
+    17d7:	68 4a b2 00 00       	push   $0xb24a
+    17dc:	6a 01                	push   $0x1
+    17de:	e8 2e 8d 00 00       	call   a511 <printf>
+  if((fd = open("readahead", O_CREATE|O_RDWR)) < 0){
+    17e3:	83 c4 08             	add    $0x8,%esp
+    17e6:	68 02 02 00 00       	push   $0x202
+    17eb:	68 5a b2 00 00       	push   $0xb25a
+    17f0:	e8 34 89 00 00       	call   a129 <open>
+    17f5:	83 c4 10             	add    $0x10,%esp
+    17f8:	85 c0                	test   %eax,%eax
+    17fa:	78 09                	js     1805 <readaheadtest+0x3a>
+    17fc:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+    17fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1803:	eb 4a                	jmp    184f <readaheadtest+0x84>
+    printf(1, "readahead: create failed\n");
+    1805:	83 ec 08             	sub    $0x8,%esp
+    1808:	68 64 b2 00 00       	push   $0xb264
+    180d:	6a 01                	push   $0x1
+    180f:	e8 fd 8c 00 00       	call   a511 <printf>
+    exit();
+    1814:	e8 bf 87 00 00       	call   9fd8 <exit>
+      buf[j] = i + j;
+    1819:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+    181c:	88 94 05 bc fe ff ff 	mov    %dl,-0x144(%ebp,%eax,1)
+    for(j = 0; j < sizeof(buf); j++)
+    1823:	83 c0 01             	add    $0x1,%eax
+    1826:	3d 2b 01 00 00       	cmp    $0x12b,%eax
+    182b:	76 ec                	jbe    1819 <readaheadtest+0x4e>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    182d:	83 ec 04             	sub    $0x4,%esp
+    1830:	68 2c 01 00 00       	push   $0x12c
+    1835:	8d 85 bc fe ff ff    	lea    -0x144(%ebp),%eax
+    183b:	50                   	push   %eax
+    183c:	56                   	push   %esi
+    183d:	e8 c9 88 00 00       	call   a10b <write>
+    1842:	83 c4 10             	add    $0x10,%esp
+    1845:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    184a:	75 0f                	jne    185b <readaheadtest+0x90>
+  for(i = 0; i < 100; i++){
+    184c:	83 c3 01             	add    $0x1,%ebx
+    184f:	83 fb 63             	cmp    $0x63,%ebx
+    1852:	7f 1b                	jg     186f <readaheadtest+0xa4>
+    for(j = 0; j < sizeof(buf); j++)
+    1854:	b8 00 00 00 00       	mov    $0x0,%eax
+    1859:	eb cb                	jmp    1826 <readaheadtest+0x5b>
+      printf(1, "readahead: write failed\n");
+    185b:	83 ec 08             	sub    $0x8,%esp
+    185e:	68 7e b2 00 00       	push   $0xb27e
+    1863:	6a 01                	push   $0x1
+    1865:	e8 a7 8c 00 00       	call   a511 <printf>
+      exit();
+    186a:	e8 69 87 00 00       	call   9fd8 <exit>
+  close(fd);
+    186f:	83 ec 0c             	sub    $0xc,%esp
+    1872:	56                   	push   %esi
+    1873:	e8 8f 87 00 00       	call   a007 <close>
+  for(off = 0; off < 2; off++){
+    1878:	83 c4 10             	add    $0x10,%esp
+    187b:	bf 00 00 00 00       	mov    $0x0,%edi
+    1880:	83 ff 01             	cmp    $0x1,%edi
+    1883:	0f 8f 06 01 00 00    	jg     198f <readaheadtest+0x1c4>
+    if((fd = open("readahead", 0)) < 0){
+    1889:	83 ec 08             	sub    $0x8,%esp
+    188c:	6a 00                	push   $0x0
+    188e:	68 5a b2 00 00       	push   $0xb25a
+    1893:	e8 91 88 00 00       	call   a129 <open>
+    1898:	89 c6                	mov    %eax,%esi
+    189a:	83 c4 10             	add    $0x10,%esp
+    189d:	85 c0                	test   %eax,%eax
+    189f:	78 07                	js     18a8 <readaheadtest+0xdd>
+    for(i = 0; i < 100; i++){
+    18a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+    18a6:	eb 7b                	jmp    1923 <readaheadtest+0x158>
+      printf(1, "readahead: open failed\n");
+    18a8:	83 ec 08             	sub    $0x8,%esp
+    18ab:	68 97 b2 00 00       	push   $0xb297
+    18b0:	6a 01                	push   $0x1
+    18b2:	e8 5a 8c 00 00       	call   a511 <printf>
+      exit();
+    18b7:	e8 1c 87 00 00       	call   9fd8 <exit>
+      if((n = read(fd, buf, sizeof(buf))) != sizeof(buf)){
+    18bc:	83 ec 04             	sub    $0x4,%esp
+    18bf:	68 2c 01 00 00       	push   $0x12c
+    18c4:	8d 85 bc fe ff ff    	lea    -0x144(%ebp),%eax
+    18ca:	50                   	push   %eax
+    18cb:	56                   	push   %esi
+    18cc:	e8 2b 88 00 00       	call   a0fc <read>
+    18d1:	83 c4 10             	add    $0x10,%esp
+    18d4:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    18d9:	75 1d                	jne    18f8 <readaheadtest+0x12d>
+      for(j = 0; j < sizeof(buf); j++)
+    18db:	b8 00 00 00 00       	mov    $0x0,%eax
+    18e0:	3d 2b 01 00 00       	cmp    $0x12b,%eax
+    18e5:	77 39                	ja     1920 <readaheadtest+0x155>
+        if(buf[j] != (char)(i + j)){
+    18e7:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+    18ea:	38 94 05 bc fe ff ff 	cmp    %dl,-0x144(%ebp,%eax,1)
+    18f1:	75 18                	jne    190b <readaheadtest+0x140>
+      for(j = 0; j < sizeof(buf); j++)
+    18f3:	83 c0 01             	add    $0x1,%eax
+    18f6:	eb e8                	jmp    18e0 <readaheadtest+0x115>
+        printf(1, "readahead: read %d at record %d\n", n, i);
+    18f8:	53                   	push   %ebx
+    18f9:	50                   	push   %eax
+    18fa:	68 64 d7 00 00       	push   $0xd764
+    18ff:	6a 01                	push   $0x1
+    1901:	e8 0b 8c 00 00       	call   a511 <printf>
+        exit();
+    1906:	e8 cd 86 00 00       	call   9fd8 <exit>
+          printf(1, "readahead: bad data in record %d\n", i);
+    190b:	83 ec 04             	sub    $0x4,%esp
+    190e:	53                   	push   %ebx
+    190f:	68 88 d7 00 00       	push   $0xd788
+    1914:	6a 01                	push   $0x1
+    1916:	e8 f6 8b 00 00       	call   a511 <printf>
+          exit();
+    191b:	e8 b8 86 00 00       	call   9fd8 <exit>
+    for(i = 0; i < 100; i++){
+    1920:	83 c3 01             	add    $0x1,%ebx
+    1923:	83 fb 63             	cmp    $0x63,%ebx
+    1926:	7f 53                	jg     197b <readaheadtest+0x1b0>
+      if(off && (i & 1)){
+    1928:	85 ff                	test   %edi,%edi
+    192a:	74 90                	je     18bc <readaheadtest+0xf1>
+    192c:	f6 c3 01             	test   $0x1,%bl
+    192f:	74 8b                	je     18bc <readaheadtest+0xf1>
+        if(read(fd, buf, 17) != 17 || read(fd, buf, sizeof(buf) - 17) < 0){
+    1931:	83 ec 04             	sub    $0x4,%esp
+    1934:	6a 11                	push   $0x11
+    1936:	8d 85 bc fe ff ff    	lea    -0x144(%ebp),%eax
+    193c:	50                   	push   %eax
+    193d:	56                   	push   %esi
+    193e:	e8 b9 87 00 00       	call   a0fc <read>
+    1943:	83 c4 10             	add    $0x10,%esp
+    1946:	83 f8 11             	cmp    $0x11,%eax
+    1949:	75 1c                	jne    1967 <readaheadtest+0x19c>
+    194b:	83 ec 04             	sub    $0x4,%esp
+    194e:	68 1b 01 00 00       	push   $0x11b
+    1953:	8d 85 bc fe ff ff    	lea    -0x144(%ebp),%eax
+    1959:	50                   	push   %eax
+    195a:	56                   	push   %esi
+    195b:	e8 9c 87 00 00       	call   a0fc <read>
+    1960:	83 c4 10             	add    $0x10,%esp
+    1963:	85 c0                	test   %eax,%eax
+    1965:	79 b9                	jns    1920 <readaheadtest+0x155>
+          printf(1, "readahead: read failed\n");
+    1967:	83 ec 08             	sub    $0x8,%esp
+    196a:	68 af b2 00 00       	push   $0xb2af
+    196f:	6a 01                	push   $0x1
+    1971:	e8 9b 8b 00 00       	call   a511 <printf>
+          exit();
+    1976:	e8 5d 86 00 00       	call   9fd8 <exit>
+    close(fd);
+    197b:	83 ec 0c             	sub    $0xc,%esp
+    197e:	56                   	push   %esi
+    197f:	e8 83 86 00 00       	call   a007 <close>
+  for(off = 0; off < 2; off++){
+    1984:	83 c7 01             	add    $0x1,%edi
+    1987:	83 c4 10             	add    $0x10,%esp
+    198a:	e9 f1 fe ff ff       	jmp    1880 <readaheadtest+0xb5>
+  unlink("readahead");
+    198f:	83 ec 0c             	sub    $0xc,%esp
+    1992:	68 5a b2 00 00       	push   $0xb25a
+    1997:	e8 ab 87 00 00       	call   a147 <unlink>
+  printf(1, "readahead test OK\n");
+    199c:	83 c4 08             	add    $0x8,%esp
+    199f:	68 c7 b2 00 00       	push   $0xb2c7
+    19a4:	6a 01                	push   $0x1
+    19a6:	e8 66 8b 00 00       	call   a511 <printf>
+}
+    19ab:	83 c4 10             	add    $0x10,%esp
+    19ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    19b1:	5b                   	pop    %ebx
+    19b2:	5e                   	pop    %esi
+    19b3:	5f                   	pop    %edi
+    19b4:	5d                   	pop    %ebp
+    19b5:	c3                   	ret
+
+000019b6 <bigargtest>:
+{
+    19b6:	55                   	push   %ebp
+    19b7:	89 e5                	mov    %esp,%ebp
+    19b9:	83 ec 14             	sub    $0x14,%esp
+  unlink("bigarg-ok");
+    19bc:	68 da b2 00 00       	push   $0xb2da
+    19c1:	e8 81 87 00 00       	call   a147 <unlink>
+  pid = fork();
+    19c6:	e8 f9 85 00 00       	call   9fc4 <fork>
+  if(pid == 0){
+    19cb:	83 c4 10             	add    $0x10,%esp
+    19ce:	85 c0                	test   %eax,%eax
+    19d0:	74 4d                	je     1a1f <bigargtest+0x69>
+  } else if(pid < 0){
+    19d2:	0f 88 ad 00 00 00    	js     1a85 <bigargtest+0xcf>
+  wait();
+    19d8:	e8 01 87 00 00       	call   a0de <wait>
+  fd = open("bigarg-ok", 0);
+    19dd:	83 ec 08             	sub    $0x8,%esp
+    19e0:	6a 00                	push   $0x0
+    19e2:	68 da b2 00 00       	push   $0xb2da
+    19e7:	e8 3d 87 00 00       	call   a129 <open>
+  if(fd < 0){
+    19ec:	83 c4 10             	add    $0x10,%esp
+    19ef:	85 c0                	test   %eax,%eax
+    19f1:	0f 88 a6 00 00 00    	js     1a9d <bigargtest+0xe7>
+  close(fd);
+    19f7:	83 ec 0c             	sub    $0xc,%esp
+    19fa:	50                   	push   %eax
+    19fb:	e8 07 86 00 00       	call   a007 <close>
+  unlink("bigarg-ok");
+    1a00:	c7 04 24 da b2 00 00 	movl   $0xb2da,(%esp)
+    1a07:	e8 3b 87 00 00       	call   a147 <unlink>
+}
+    1a0c:	83 c4 10             	add    $0x10,%esp
+    1a0f:	c9                   	leave
+    1a10:	c3                   	ret
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    1a11:	c7 04 85 a0 4c 01 00 	movl   $0xd7ac,0x14ca0(,%eax,4)
+    1a18:	ac d7 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    1a1c:	83 c0 01             	add    $0x1,%eax
+    1a1f:	83 f8 1e             	cmp    $0x1e,%eax
+    1a22:	7e ed                	jle    1a11 <bigargtest+0x5b>
+    args[MAXARG-1] = 0;
+    1a24:	c7 05 1c 4d 01 00 00 	movl   $0x0,0x14d1c
+    1a2b:	00 00 00 
+    printf(stdout, "bigarg test\n");
+    1a2e:	83 ec 08             	sub    $0x8,%esp
+    1a31:	68 e4 b2 00 00       	push   $0xb2e4
+    1a36:	ff 35 a4 04 01 00    	push   0x104a4
+    1a3c:	e8 d0 8a 00 00       	call   a511 <printf>
+    exec("echo", args);
+    1a41:	83 c4 08             	add    $0x8,%esp
+    1a44:	68 a0 4c 01 00       	push   $0x14ca0
+    1a49:	68 47 ad 00 00       	push   $0xad47
+    1a4e:	e8 97 85 00 00       	call   9fea <exec>
+    printf(stdout, "bigarg test ok\n");
+    1a53:	83 c4 08             	add    $0x8,%esp
+    1a56:	68 f1 b2 00 00       	push   $0xb2f1
+    1a5b:	ff 35 a4 04 01 00    	push   0x104a4
+    1a61:	e8 ab 8a 00 00       	call   a511 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    1a66:	83 c4 08             	add    $0x8,%esp
+    1a69:	68 00 02 00 00       	push   $0x200
+    1a6e:	68 da b2 00 00       	push   $0xb2da
+    1a73:	e8 b1 86 00 00       	call   a129 <open>
+    close(fd);
+    1a78:	89 04 24             	mov    %eax,(%esp)
+    1a7b:	e8 87 85 00 00       	call   a007 <close>
+    exit();
+    1a80:	e8 53 85 00 00       	call   9fd8 <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    1a85:	83 ec 08             	sub    $0x8,%esp
+    1a88:	68 01 b3 00 00       	push   $0xb301
+    1a8d:	ff 35 a4 04 01 00    	push   0x104a4
+    1a93:	e8 79 8a 00 00       	call   a511 <printf>
+    exit();
+    1a98:	e8 3b 85 00 00       	call   9fd8 <exit>
+    printf(stdout, "bigarg test failed!\n");
+    1a9d:	83 ec 08             	sub    $0x8,%esp
+    1aa0:	68 1a b3 00 00       	push   $0xb31a
+    1aa5:	ff 35 a4 04 01 00    	push   0x104a4
+    1aab:	e8 61 8a 00 00       	call   a511 <printf>
+    exit();
+    1ab0:	e8 23 85 00 00       	call   9fd8 <exit>
+
+00001ab5 <pipe1>:
+{
+    1ab5:	55                   	push   %ebp
+    1ab6:	89 e5                	mov    %esp,%ebp
+    1ab8:	57                   	push   %edi
+    1ab9:	56                   	push   %esi
+    1aba:	53                   	push   %ebx
+    1abb:	83 ec 38             	sub    $0x38,%esp
+  if(pipe(fds) != 0){
+    1abe:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    1ac1:	50                   	push   %eax
+    1ac2:	e8 26 86 00 00       	call   a0ed <pipe>
+    1ac7:	83 c4 10             	add    $0x10,%esp
+    1aca:	85 c0                	test   %eax,%eax
+    1acc:	75 74                	jne    1b42 <pipe1+0x8d>
+    1ace:	89 c6                	mov    %eax,%esi
+  pid = fork();
+    1ad0:	e8 ef 84 00 00       	call   9fc4 <fork>
+    1ad5:	89 c7                	mov    %eax,%edi
+  if(pid == 0){
+    1ad7:	85 c0                	test   %eax,%eax
+    1ad9:	74 7b                	je     1b56 <pipe1+0xa1>
+  } else if(pid > 0){
+    1adb:	0f 8e 60 01 00 00    	jle    1c41 <pipe1+0x18c>
+    close(fds[1]);
+    1ae1:	83 ec 0c             	sub    $0xc,%esp
+    1ae4:	ff 75 e4             	push   -0x1c(%ebp)
+    1ae7:	e8 1b 85 00 00       	call   a007 <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+    1aec:	83 c4 10             	add    $0x10,%esp
+    total = 0;
+    1aef:	89 75 d0             	mov    %esi,-0x30(%ebp)
+  seq = 0;
+    1af2:	89 f3                	mov    %esi,%ebx
+    cc = 1;
+    1af4:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+    while((n = read(fds[0], buf, cc)) > 0){
+    1afb:	83 ec 04             	sub    $0x4,%esp
+    1afe:	ff 75 d4             	push   -0x2c(%ebp)
+    1b01:	68 a0 2c 01 00       	push   $0x12ca0
+    1b06:	ff 75 e0             	push   -0x20(%ebp)
+    1b09:	e8 ee 85 00 00       	call   a0fc <read>
+    1b0e:	89 c7                	mov    %eax,%edi
+    1b10:	83 c4 10             	add    $0x10,%esp
+    1b13:	85 c0                	test   %eax,%eax
+    1b15:	0f 8e e2 00 00 00    	jle    1bfd <pipe1+0x148>
+      for(i = 0; i < n; i++){
+    1b1b:	89 f0                	mov    %esi,%eax
+    1b1d:	89 d9                	mov    %ebx,%ecx
+    1b1f:	39 f8                	cmp    %edi,%eax
+    1b21:	0f 8d b4 00 00 00    	jge    1bdb <pipe1+0x126>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+    1b27:	0f be 98 a0 2c 01 00 	movsbl 0x12ca0(%eax),%ebx
+    1b2e:	8d 51 01             	lea    0x1(%ecx),%edx
+    1b31:	31 cb                	xor    %ecx,%ebx
+    1b33:	84 db                	test   %bl,%bl
+    1b35:	0f 85 86 00 00 00    	jne    1bc1 <pipe1+0x10c>
+      for(i = 0; i < n; i++){
+    1b3b:	83 c0 01             	add    $0x1,%eax
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+    1b3e:	89 d1                	mov    %edx,%ecx
+    1b40:	eb dd                	jmp    1b1f <pipe1+0x6a>
+    printf(1, "pipe() failed\n");
+    1b42:	83 ec 08             	sub    $0x8,%esp
+    1b45:	68 2f b3 00 00       	push   $0xb32f
+    1b4a:	6a 01                	push   $0x1
+    1b4c:	e8 c0 89 00 00       	call   a511 <printf>
+    exit();
+    1b51:	e8 82 84 00 00       	call   9fd8 <exit>
+    close(fds[0]);
+    1b56:	83 ec 0c             	sub    $0xc,%esp
+    1b59:	ff 75 e0             	push   -0x20(%ebp)
+    1b5c:	e8 a6 84 00 00       	call   a007 <close>
+    for(n = 0; n < 5; n++){
+    1b61:	83 c4 10             	add    $0x10,%esp
+    1b64:	89 fe                	mov    %edi,%esi
+  seq = 0;
+    1b66:	89 fb                	mov    %edi,%ebx
+    for(n = 0; n < 5; n++){
+    1b68:	eb 35                	jmp    1b9f <pipe1+0xea>
+        buf[i] = seq++;
+    1b6a:	88 98 a0 2c 01 00    	mov    %bl,0x12ca0(%eax)
+      for(i = 0; i < 1033; i++)
+    1b70:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+    1b73:	8d 5b 01             	lea    0x1(%ebx),%ebx
+      for(i = 0; i < 1033; i++)
+    1b76:	3d 08 04 00 00       	cmp    $0x408,%eax
+    1b7b:	7e ed                	jle    1b6a <pipe1+0xb5>
+      if(write(fds[1], buf, 1033) != 1033){
+    1b7d:	83 ec 04             	sub    $0x4,%esp
+    1b80:	68 09 04 00 00       	push   $0x409
+    1b85:	68 a0 2c 01 00       	push   $0x12ca0
+    1b8a:	ff 75 e4             	push   -0x1c(%ebp)
+    1b8d:	e8 79 85 00 00       	call   a10b <write>
+    1b92:	83 c4 10             	add    $0x10,%esp
+    1b95:	3d 09 04 00 00       	cmp    $0x409,%eax
+    1b9a:	75 0c                	jne    1ba8 <pipe1+0xf3>
+    for(n = 0; n < 5; n++){
+    1b9c:	83 c6 01             	add    $0x1,%esi
+    1b9f:	83 fe 04             	cmp    $0x4,%esi
+    1ba2:	7f 18                	jg     1bbc <pipe1+0x107>
+      for(i = 0; i < 1033; i++)
+    1ba4:	89 f8                	mov    %edi,%eax
+    1ba6:	eb ce                	jmp    1b76 <pipe1+0xc1>
+        printf(1, "pipe1 oops 1\n");
+    1ba8:	83 ec 08             	sub    $0x8,%esp
+    1bab:	68 3e b3 00 00       	push   $0xb33e
+    1bb0:	6a 01                	push   $0x1
+    1bb2:	e8 5a 89 00 00       	call   a511 <printf>
+        exit();
+    1bb7:	e8 1c 84 00 00       	call   9fd8 <exit>
+    exit();
+    1bbc:	e8 17 84 00 00       	call   9fd8 <exit>
+          printf(1, "pipe1 oops 2\n");
+    1bc1:	83 ec 08             	sub    $0x8,%esp
+    1bc4:	68 4c b3 00 00       	push   $0xb34c
+    1bc9:	6a 01                	push   $0x1
+    1bcb:	e8 41 89 00 00       	call   a511 <printf>
+          return;
+    1bd0:	83 c4 10             	add    $0x10,%esp
+}
+    1bd3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1bd6:	5b                   	pop    %ebx
+    1bd7:	5e                   	pop    %esi
+    1bd8:	5f                   	pop    %edi
+    1bd9:	5d                   	pop    %ebp
+    1bda:	c3                   	ret
+      total += n;
+    1bdb:	89 cb                	mov    %ecx,%ebx
+    1bdd:	01 7d d0             	add    %edi,-0x30(%ebp)
+      cc = cc * 2;
+    1be0:	d1 65 d4             	shll   -0x2c(%ebp)
+    1be3:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+      if(cc > sizeof(buf))
+    1be6:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    1beb:	0f 86 0a ff ff ff    	jbe    1afb <pipe1+0x46>
+        cc = sizeof(buf);
+    1bf1:	c7 45 d4 00 20 00 00 	movl   $0x2000,-0x2c(%ebp)
+    1bf8:	e9 fe fe ff ff       	jmp    1afb <pipe1+0x46>
+    if(total != 5 * 1033){
+    1bfd:	81 7d d0 2d 14 00 00 	cmpl   $0x142d,-0x30(%ebp)
+    1c04:	75 24                	jne    1c2a <pipe1+0x175>
+    close(fds[0]);
+    1c06:	83 ec 0c             	sub    $0xc,%esp
+    1c09:	ff 75 e0             	push   -0x20(%ebp)
+    1c0c:	e8 f6 83 00 00       	call   a007 <close>
+    wait();
+    1c11:	e8 c8 84 00 00       	call   a0de <wait>
+  printf(1, "pipe1 ok\n");
+    1c16:	83 c4 08             	add    $0x8,%esp
+    1c19:	68 71 b3 00 00       	push   $0xb371
+    1c1e:	6a 01                	push   $0x1
+    1c20:	e8 ec 88 00 00       	call   a511 <printf>
+    1c25:	83 c4 10             	add    $0x10,%esp
+    1c28:	eb a9                	jmp    1bd3 <pipe1+0x11e>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+    1c2a:	83 ec 04             	sub    $0x4,%esp
+    1c2d:	ff 75 d0             	push   -0x30(%ebp)
+    1c30:	68 5a b3 00 00       	push   $0xb35a
+    1c35:	6a 01                	push   $0x1
+    1c37:	e8 d5 88 00 00       	call   a511 <printf>
+      exit();
+    1c3c:	e8 97 83 00 00       	call   9fd8 <exit>
+    printf(1, "fork() failed\n");
+    1c41:	83 ec 08             	sub    $0x8,%esp
+    1c44:	68 7b b3 00 00       	push   $0xb37b
+    1c49:	6a 01                	push   $0x1
+    1c4b:	e8 c1 88 00 00       	call   a511 <printf>
+    exit();
+    1c50:	e8 83 83 00 00       	call   9fd8 <exit>
+
+00001c55 <icachetest>:
+{
+    1c55:	55                   	push   %ebp
+    1c56:	89 e5                	mov    %esp,%ebp
+    1c58:	56                   	push   %esi
+    1c59:	53                   	push   %ebx
+    1c5a:	83 ec 28             	sub    $0x28,%esp
+  printf(1, "icache test\n");
+    1c5d:	68 8a b3 00 00       	push   $0xb38a
+    1c62:	6a 01                	push   $0x1
+    1c64:	e8 a8 88 00 00       	call   a511 <printf>
+  name[0] = 'i';
+    1c69:	c6 45 e3 69          	movb   $0x69,-0x1d(%ebp)
+  name[1] = 'c';
+    1c6d:	c6 45 e4 63          	movb   $0x63,-0x1c(%ebp)
+  name[4] = '\0';
+    1c71:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+  for(i = 0; i < 60; i++){
+    1c75:	83 c4 10             	add    $0x10,%esp
+    1c78:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1c7d:	83 fb 3b             	cmp    $0x3b,%ebx
+    1c80:	7f 65                	jg     1ce7 <icachetest+0x92>
+    name[2] = '0' + i/10;
+    1c82:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    1c87:	89 d8                	mov    %ebx,%eax
+    1c89:	f7 ea                	imul   %edx
+    1c8b:	c1 fa 02             	sar    $0x2,%edx
+    1c8e:	89 d8                	mov    %ebx,%eax
+    1c90:	c1 f8 1f             	sar    $0x1f,%eax
+    1c93:	29 c2                	sub    %eax,%edx
+    1c95:	8d 42 30             	lea    0x30(%edx),%eax
+    1c98:	88 45 e5             	mov    %al,-0x1b(%ebp)
+    name[3] = '0' + i%10;
+    1c9b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    1c9e:	01 d2                	add    %edx,%edx
+    1ca0:	89 d8                	mov    %ebx,%eax
+    1ca2:	29 d0                	sub    %edx,%eax
+    1ca4:	83 c0 30             	add    $0x30,%eax
+    1ca7:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0){
+    1caa:	83 ec 08             	sub    $0x8,%esp
+    1cad:	68 02 02 00 00       	push   $0x202
+    1cb2:	8d 45 e3             	lea    -0x1d(%ebp),%eax
+    1cb5:	50                   	push   %eax
+    1cb6:	e8 6e 84 00 00       	call   a129 <open>
+    1cbb:	83 c4 10             	add    $0x10,%esp
+    1cbe:	85 c0                	test   %eax,%eax
+    1cc0:	78 11                	js     1cd3 <icachetest+0x7e>
+    close(fd);
+    1cc2:	83 ec 0c             	sub    $0xc,%esp
+    1cc5:	50                   	push   %eax
+    1cc6:	e8 3c 83 00 00       	call   a007 <close>
+  for(i = 0; i < 60; i++){
+    1ccb:	83 c3 01             	add    $0x1,%ebx
+    1cce:	83 c4 10             	add    $0x10,%esp
+    1cd1:	eb aa                	jmp    1c7d <icachetest+0x28>
+      printf(1, "icache: create failed\n");
+    1cd3:	83 ec 08             	sub    $0x8,%esp
+    1cd6:	68 97 b3 00 00       	push   $0xb397
+    1cdb:	6a 01                	push   $0x1
+    1cdd:	e8 2f 88 00 00       	call   a511 <printf>
+      exit();
+    1ce2:	e8 f1 82 00 00       	call   9fd8 <exit>
+  if(pipe(up) < 0 || pipe(down) < 0){
+    1ce7:	83 ec 0c             	sub    $0xc,%esp
+    1cea:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    1ced:	50                   	push   %eax
+    1cee:	e8 fa 83 00 00       	call   a0ed <pipe>
+    1cf3:	83 c4 10             	add    $0x10,%esp
+    1cf6:	85 c0                	test   %eax,%eax
+    1cf8:	78 1a                	js     1d14 <icachetest+0xbf>
+    1cfa:	83 ec 0c             	sub    $0xc,%esp
+    1cfd:	8d 45 e8             	lea    -0x18(%ebp),%eax
+    1d00:	50                   	push   %eax
+    1d01:	e8 e7 83 00 00       	call   a0ed <pipe>
+    1d06:	83 c4 10             	add    $0x10,%esp
+    1d09:	85 c0                	test   %eax,%eax
+    1d0b:	78 07                	js     1d14 <icachetest+0xbf>
+  for(i = 0; i < 6; i++){
+    1d0d:	be 00 00 00 00       	mov    $0x0,%esi
+    1d12:	eb 6b                	jmp    1d7f <icachetest+0x12a>
+    printf(1, "icache: pipe failed\n");
+    1d14:	83 ec 08             	sub    $0x8,%esp
+    1d17:	68 ae b3 00 00       	push   $0xb3ae
+    1d1c:	6a 01                	push   $0x1
+    1d1e:	e8 ee 87 00 00       	call   a511 <printf>
+    exit();
+    1d23:	e8 b0 82 00 00       	call   9fd8 <exit>
+      printf(1, "icache: fork failed\n");
+    1d28:	83 ec 08             	sub    $0x8,%esp
+    1d2b:	68 c3 b3 00 00       	push   $0xb3c3
+    1d30:	6a 01                	push   $0x1
+    1d32:	e8 da 87 00 00       	call   a511 <printf>
+      exit();
+    1d37:	e8 9c 82 00 00       	call   9fd8 <exit>
+          printf(1, "icache: open %s failed\n", name);
+    1d3c:	83 ec 04             	sub    $0x4,%esp
+    1d3f:	8d 45 e3             	lea    -0x1d(%ebp),%eax
+    1d42:	50                   	push   %eax
+    1d43:	68 d8 b3 00 00       	push   $0xb3d8
+    1d48:	6a 01                	push   $0x1
+    1d4a:	e8 c2 87 00 00       	call   a511 <printf>
+          exit();
+    1d4f:	e8 84 82 00 00       	call   9fd8 <exit>
+      write(up[1], "x", 1);
+    1d54:	83 ec 04             	sub    $0x4,%esp
+    1d57:	6a 01                	push   $0x1
+    1d59:	68 72 bb 00 00       	push   $0xbb72
+    1d5e:	ff 75 f4             	push   -0xc(%ebp)
+    1d61:	e8 a5 83 00 00       	call   a10b <write>
+      read(down[0], &c, 1);
+    1d66:	83 c4 0c             	add    $0xc,%esp
+    1d69:	6a 01                	push   $0x1
+    1d6b:	8d 45 e2             	lea    -0x1e(%ebp),%eax
+    1d6e:	50                   	push   %eax
+    1d6f:	ff 75 e8             	push   -0x18(%ebp)
+    1d72:	e8 85 83 00 00       	call   a0fc <read>
+      exit();
+    1d77:	e8 5c 82 00 00       	call   9fd8 <exit>
+  for(i = 0; i < 6; i++){
+    1d7c:	83 c6 01             	add    $0x1,%esi
+    1d7f:	83 fe 05             	cmp    $0x5,%esi
+    1d82:	7f 75                	jg     1df9 <icachetest+0x1a4>
+    if((pid = fork()) < 0){
+    1d84:	e8 3b 82 00 00       	call   9fc4 <fork>
+    1d89:	89 c3                	mov    %eax,%ebx
+    1d8b:	85 c0                	test   %eax,%eax
+    1d8d:	78 99                	js     1d28 <icachetest+0xd3>
+    if(pid == 0){
+    1d8f:	75 eb                	jne    1d7c <icachetest+0x127>
+      close(up[0]);
+    1d91:	83 ec 0c             	sub    $0xc,%esp
+    1d94:	ff 75 f0             	push   -0x10(%ebp)
+    1d97:	e8 6b 82 00 00       	call   a007 <close>
+      close(down[1]);
+    1d9c:	83 c4 04             	add    $0x4,%esp
+    1d9f:	ff 75 ec             	push   -0x14(%ebp)
+    1da2:	e8 60 82 00 00       	call   a007 <close>
+      for(j = 0; j < 10; j++){
+    1da7:	83 c4 10             	add    $0x10,%esp
+    1daa:	83 fb 09             	cmp    $0x9,%ebx
+    1dad:	7f a5                	jg     1d54 <icachetest+0xff>
+        name[2] = '0' + (i*10 + j)/10;
+    1daf:	8d 04 b6             	lea    (%esi,%esi,4),%eax
+    1db2:	8d 0c 43             	lea    (%ebx,%eax,2),%ecx
+    1db5:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    1dba:	89 c8                	mov    %ecx,%eax
+    1dbc:	f7 ea                	imul   %edx
+    1dbe:	c1 fa 02             	sar    $0x2,%edx
+    1dc1:	89 c8                	mov    %ecx,%eax
+    1dc3:	c1 f8 1f             	sar    $0x1f,%eax
+    1dc6:	29 c2                	sub    %eax,%edx
+    1dc8:	8d 42 30             	lea    0x30(%edx),%eax
+    1dcb:	88 45 e5             	mov    %al,-0x1b(%ebp)
+        name[3] = '0' + (i*10 + j)%10;
+    1dce:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    1dd1:	01 c0                	add    %eax,%eax
+    1dd3:	29 c1                	sub    %eax,%ecx
+    1dd5:	83 c1 30             	add    $0x30,%ecx
+    1dd8:	88 4d e6             	mov    %cl,-0x1a(%ebp)
+        if(open(name, O_RDWR) < 0){
+    1ddb:	83 ec 08             	sub    $0x8,%esp
+    1dde:	6a 02                	push   $0x2
+    1de0:	8d 45 e3             	lea    -0x1d(%ebp),%eax
+    1de3:	50                   	push   %eax
+    1de4:	e8 40 83 00 00       	call   a129 <open>
+    1de9:	83 c4 10             	add    $0x10,%esp
+    1dec:	85 c0                	test   %eax,%eax
+    1dee:	0f 88 48 ff ff ff    	js     1d3c <icachetest+0xe7>
+      for(j = 0; j < 10; j++){
+    1df4:	83 c3 01             	add    $0x1,%ebx
+    1df7:	eb b1                	jmp    1daa <icachetest+0x155>
+  close(up[1]);
+    1df9:	83 ec 0c             	sub    $0xc,%esp
+    1dfc:	ff 75 f4             	push   -0xc(%ebp)
+    1dff:	e8 03 82 00 00       	call   a007 <close>
+  close(down[0]);
+    1e04:	83 c4 04             	add    $0x4,%esp
+    1e07:	ff 75 e8             	push   -0x18(%ebp)
+    1e0a:	e8 f8 81 00 00       	call   a007 <close>
+  for(i = 0; i < 6; i++)
+    1e0f:	83 c4 10             	add    $0x10,%esp
+    1e12:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1e17:	83 fb 05             	cmp    $0x5,%ebx
+    1e1a:	7f 32                	jg     1e4e <icachetest+0x1f9>
+    if(read(up[0], &c, 1) != 1){
+    1e1c:	83 ec 04             	sub    $0x4,%esp
+    1e1f:	6a 01                	push   $0x1
+    1e21:	8d 45 e2             	lea    -0x1e(%ebp),%eax
+    1e24:	50                   	push   %eax
+    1e25:	ff 75 f0             	push   -0x10(%ebp)
+    1e28:	e8 cf 82 00 00       	call   a0fc <read>
+    1e2d:	83 c4 10             	add    $0x10,%esp
+    1e30:	83 f8 01             	cmp    $0x1,%eax
+    1e33:	75 05                	jne    1e3a <icachetest+0x1e5>
+  for(i = 0; i < 6; i++)
+    1e35:	83 c3 01             	add    $0x1,%ebx
+    1e38:	eb dd                	jmp    1e17 <icachetest+0x1c2>
+      printf(1, "icache: child failed\n");
+    1e3a:	83 ec 08             	sub    $0x8,%esp
+    1e3d:	68 f0 b3 00 00       	push   $0xb3f0
+    1e42:	6a 01                	push   $0x1
+    1e44:	e8 c8 86 00 00       	call   a511 <printf>
+      exit();
+    1e49:	e8 8a 81 00 00       	call   9fd8 <exit>
+  close(down[1]);
+    1e4e:	83 ec 0c             	sub    $0xc,%esp
+    1e51:	ff 75 ec             	push   -0x14(%ebp)
+    1e54:	e8 ae 81 00 00       	call   a007 <close>
+  close(up[0]);
+    1e59:	83 c4 04             	add    $0x4,%esp
+    1e5c:	ff 75 f0             	push   -0x10(%ebp)
+    1e5f:	e8 a3 81 00 00       	call   a007 <close>
+  for(i = 0; i < 6; i++)
+    1e64:	83 c4 10             	add    $0x10,%esp
+    1e67:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1e6c:	eb 08                	jmp    1e76 <icachetest+0x221>
+    wait();
+    1e6e:	e8 6b 82 00 00       	call   a0de <wait>
+  for(i = 0; i < 6; i++)
+    1e73:	83 c3 01             	add    $0x1,%ebx
+    1e76:	83 fb 05             	cmp    $0x5,%ebx
+    1e79:	7e f3                	jle    1e6e <icachetest+0x219>
+  for(i = 0; i < 60; i++){
+    1e7b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1e80:	eb 3a                	jmp    1ebc <icachetest+0x267>
+    name[2] = '0' + i/10;
+    1e82:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    1e87:	89 d8                	mov    %ebx,%eax
+    1e89:	f7 ea                	imul   %edx
+    1e8b:	c1 fa 02             	sar    $0x2,%edx
+    1e8e:	89 d8                	mov    %ebx,%eax
+    1e90:	c1 f8 1f             	sar    $0x1f,%eax
+    1e93:	29 c2                	sub    %eax,%edx
+    1e95:	8d 42 30             	lea    0x30(%edx),%eax
+    1e98:	88 45 e5             	mov    %al,-0x1b(%ebp)
+    name[3] = '0' + i%10;
+    1e9b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    1e9e:	01 d2                	add    %edx,%edx
+    1ea0:	89 d8                	mov    %ebx,%eax
+    1ea2:	29 d0                	sub    %edx,%eax
+    1ea4:	83 c0 30             	add    $0x30,%eax
+    1ea7:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    unlink(name);
+    1eaa:	83 ec 0c             	sub    $0xc,%esp
+    1ead:	8d 45 e3             	lea    -0x1d(%ebp),%eax
+    1eb0:	50                   	push   %eax
+    1eb1:	e8 91 82 00 00       	call   a147 <unlink>
+  for(i = 0; i < 60; i++){
+    1eb6:	83 c3 01             	add    $0x1,%ebx
+    1eb9:	83 c4 10             	add    $0x10,%esp
+    1ebc:	83 fb 3b             	cmp    $0x3b,%ebx
+    1ebf:	7e c1                	jle    1e82 <icachetest+0x22d>
+  printf(1, "icache test OK\n");
+    1ec1:	83 ec 08             	sub    $0x8,%esp
+    1ec4:	68 06 b4 00 00       	push   $0xb406
+    1ec9:	6a 01                	push   $0x1
+    1ecb:	e8 41 86 00 00       	call   a511 <printf>
+}
+    1ed0:	83 c4 10             	add    $0x10,%esp
+    1ed3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1ed6:	5b                   	pop    %ebx
+    1ed7:	5e                   	pop    %esi
+    1ed8:	5d                   	pop    %ebp
+    1ed9:	c3                   	ret
+
+00001eda <cowtest>:
+{
+    1eda:	55                   	push   %ebp
+    1edb:	89 e5                	mov    %esp,%ebp
+    1edd:	83 ec 20             	sub    $0x20,%esp
+  printf(1, "cow test\n");
+    1ee0:	68 16 b4 00 00       	push   $0xb416
+    1ee5:	6a 01                	push   $0x1
+    1ee7:	e8 25 86 00 00       	call   a511 <printf>
+  for(i = 0; i < sizeof(buf); i++)
+    1eec:	83 c4 10             	add    $0x10,%esp
+    1eef:	b8 00 00 00 00       	mov    $0x0,%eax
+    1ef4:	eb 0a                	jmp    1f00 <cowtest+0x26>
+    buf[i] = 'a';
+    1ef6:	c6 80 20 4d 01 00 61 	movb   $0x61,0x14d20(%eax)
+  for(i = 0; i < sizeof(buf); i++)
+    1efd:	83 c0 01             	add    $0x1,%eax
+    1f00:	3d ff 2f 00 00       	cmp    $0x2fff,%eax
+    1f05:	76 ef                	jbe    1ef6 <cowtest+0x1c>
+  if(pipe(fds) != 0){
+    1f07:	83 ec 0c             	sub    $0xc,%esp
+    1f0a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    1f0d:	50                   	push   %eax
+    1f0e:	e8 da 81 00 00       	call   a0ed <pipe>
+    1f13:	83 c4 10             	add    $0x10,%esp
+    1f16:	85 c0                	test   %eax,%eax
+    1f18:	75 42                	jne    1f5c <cowtest+0x82>
+  pid = fork();
+    1f1a:	e8 a5 80 00 00       	call   9fc4 <fork>
+  if(pid < 0){
+    1f1f:	85 c0                	test   %eax,%eax
+    1f21:	78 4d                	js     1f70 <cowtest+0x96>
+  if(pid == 0){
+    1f23:	75 72                	jne    1f97 <cowtest+0xbd>
+    if(read(fds[0], buf+4096, 1) != 1 || buf[4096] != 'x'){
+    1f25:	83 ec 04             	sub    $0x4,%esp
+    1f28:	6a 01                	push   $0x1
+    1f2a:	68 20 5d 01 00       	push   $0x15d20
+    1f2f:	ff 75 f0             	push   -0x10(%ebp)
+    1f32:	e8 c5 81 00 00       	call   a0fc <read>
+    1f37:	83 c4 10             	add    $0x10,%esp
+    1f3a:	83 f8 01             	cmp    $0x1,%eax
+    1f3d:	75 09                	jne    1f48 <cowtest+0x6e>
+    1f3f:	80 3d 20 5d 01 00 78 	cmpb   $0x78,0x15d20
+    1f46:	74 3c                	je     1f84 <cowtest+0xaa>
+      printf(1, "cow: child read failed\n");
+    1f48:	83 ec 08             	sub    $0x8,%esp
+    1f4b:	68 20 b4 00 00       	push   $0xb420
+    1f50:	6a 01                	push   $0x1
+    1f52:	e8 ba 85 00 00       	call   a511 <printf>
+      exit();
+    1f57:	e8 7c 80 00 00       	call   9fd8 <exit>
+    printf(1, "pipe() failed\n");
+    1f5c:	83 ec 08             	sub    $0x8,%esp
+    1f5f:	68 2f b3 00 00       	push   $0xb32f
+    1f64:	6a 01                	push   $0x1
+    1f66:	e8 a6 85 00 00       	call   a511 <printf>
+    exit();
+    1f6b:	e8 68 80 00 00       	call   9fd8 <exit>
+    printf(1, "fork failed\n");
+    1f70:	83 ec 08             	sub    $0x8,%esp
+    1f73:	68 b6 be 00 00       	push   $0xbeb6
+    1f78:	6a 01                	push   $0x1
+    1f7a:	e8 92 85 00 00       	call   a511 <printf>
+    exit();
+    1f7f:	e8 54 80 00 00       	call   9fd8 <exit>
+    buf[0] = 'c';
+    1f84:	c6 05 20 4d 01 00 63 	movb   $0x63,0x14d20
+    buf[2*4096] = 'c';
+    1f8b:	c6 05 20 6d 01 00 63 	movb   $0x63,0x16d20
+    exit();
+    1f92:	e8 41 80 00 00       	call   9fd8 <exit>
+  buf[0] = 'p';
+    1f97:	c6 05 20 4d 01 00 70 	movb   $0x70,0x14d20
+  if(write(fds[1], "x", 1) != 1){
+    1f9e:	83 ec 04             	sub    $0x4,%esp
+    1fa1:	6a 01                	push   $0x1
+    1fa3:	68 72 bb 00 00       	push   $0xbb72
+    1fa8:	ff 75 f4             	push   -0xc(%ebp)
+    1fab:	e8 5b 81 00 00       	call   a10b <write>
+    1fb0:	83 c4 10             	add    $0x10,%esp
+    1fb3:	83 f8 01             	cmp    $0x1,%eax
+    1fb6:	75 4d                	jne    2005 <cowtest+0x12b>
+  wait();
+    1fb8:	e8 21 81 00 00       	call   a0de <wait>
+  close(fds[0]);
+    1fbd:	83 ec 0c             	sub    $0xc,%esp
+    1fc0:	ff 75 f0             	push   -0x10(%ebp)
+    1fc3:	e8 3f 80 00 00       	call   a007 <close>
+  close(fds[1]);
+    1fc8:	83 c4 04             	add    $0x4,%esp
+    1fcb:	ff 75 f4             	push   -0xc(%ebp)
+    1fce:	e8 34 80 00 00       	call   a007 <close>
+  if(buf[0] != 'p' || buf[4096] != 'a' || buf[2*4096] != 'a'){
+    1fd3:	83 c4 10             	add    $0x10,%esp
+    1fd6:	80 3d 20 4d 01 00 70 	cmpb   $0x70,0x14d20
+    1fdd:	75 3a                	jne    2019 <cowtest+0x13f>
+    1fdf:	80 3d 20 5d 01 00 61 	cmpb   $0x61,0x15d20
+    1fe6:	75 31                	jne    2019 <cowtest+0x13f>
+    1fe8:	80 3d 20 6d 01 00 61 	cmpb   $0x61,0x16d20
+    1fef:	75 28                	jne    2019 <cowtest+0x13f>
+  printf(1, "cow test OK\n");
+    1ff1:	83 ec 08             	sub    $0x8,%esp
+    1ff4:	68 4b b4 00 00       	push   $0xb44b
+    1ff9:	6a 01                	push   $0x1
+    1ffb:	e8 11 85 00 00       	call   a511 <printf>
+}
+    2000:	83 c4 10             	add    $0x10,%esp
+    2003:	c9                   	leave
+    2004:	c3                   	ret
+    printf(1, "cow: write failed\n");
+    2005:	83 ec 08             	sub    $0x8,%esp
+    2008:	68 38 b4 00 00       	push   $0xb438
+    200d:	6a 01                	push   $0x1
+    200f:	e8 fd 84 00 00       	call   a511 <printf>
+    exit();
+    2014:	e8 bf 7f 00 00       	call   9fd8 <exit>
+    printf(1, "cow: child write visible in parent\n");
+    2019:	83 ec 08             	sub    $0x8,%esp
+    201c:	68 8c d8 00 00       	push   $0xd88c
+    2021:	6a 01                	push   $0x1
+    2023:	e8 e9 84 00 00       	call   a511 <printf>
+    exit();
+    2028:	e8 ab 7f 00 00       	call   9fd8 <exit>
+
+0000202d <preempt>:
+{
+    202d:	55                   	push   %ebp
+    202e:	89 e5                	mov    %esp,%ebp
+    2030:	57                   	push   %edi
+    2031:	56                   	push   %esi
+    2032:	53                   	push   %ebx
+    2033:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "preempt: ");
+    2036:	68 58 b4 00 00       	push   $0xb458
+    203b:	6a 01                	push   $0x1
+    203d:	e8 cf 84 00 00       	call   a511 <printf>
+  pid1 = fork();
+    2042:	e8 7d 7f 00 00       	call   9fc4 <fork>
+  if(pid1 == 0)
+    2047:	83 c4 10             	add    $0x10,%esp
+    204a:	85 c0                	test   %eax,%eax
+    204c:	75 02                	jne    2050 <preempt+0x23>
+    for(;;)
+    204e:	eb fe                	jmp    204e <preempt+0x21>
+    2050:	89 c3                	mov    %eax,%ebx
+  pid2 = fork();
+    2052:	e8 6d 7f 00 00       	call   9fc4 <fork>
+    2057:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+    2059:	85 c0                	test   %eax,%eax
+    205b:	75 02                	jne    205f <preempt+0x32>
+    for(;;)
+    205d:	eb fe                	jmp    205d <preempt+0x30>
+  pipe(pfds);
+    205f:	83 ec 0c             	sub    $0xc,%esp
+    2062:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    2065:	50                   	push   %eax
+    2066:	e8 82 80 00 00       	call   a0ed <pipe>
+  pid3 = fork();
+    206b:	e8 54 7f 00 00       	call   9fc4 <fork>
+    2070:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+    2072:	83 c4 10             	add    $0x10,%esp
+    2075:	85 c0                	test   %eax,%eax
+    2077:	75 49                	jne    20c2 <preempt+0x95>
+    close(pfds[0]);
+    2079:	83 ec 0c             	sub    $0xc,%esp
+    207c:	ff 75 e0             	push   -0x20(%ebp)
+    207f:	e8 83 7f 00 00       	call   a007 <close>
+    if(write(pfds[1], "x", 1) != 1)
+    2084:	83 c4 0c             	add    $0xc,%esp
+    2087:	6a 01                	push   $0x1
+    2089:	68 72 bb 00 00       	push   $0xbb72
+    208e:	ff 75 e4             	push   -0x1c(%ebp)
+    2091:	e8 75 80 00 00       	call   a10b <write>
+    2096:	83 c4 10             	add    $0x10,%esp
+    2099:	83 f8 01             	cmp    $0x1,%eax
+    209c:	75 10                	jne    20ae <preempt+0x81>
+    close(pfds[1]);
+    209e:	83 ec 0c             	sub    $0xc,%esp
+    20a1:	ff 75 e4             	push   -0x1c(%ebp)
+    20a4:	e8 5e 7f 00 00       	call   a007 <close>
+    20a9:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+    20ac:	eb fe                	jmp    20ac <preempt+0x7f>
+      printf(1, "preempt write error");
+    20ae:	83 ec 08             	sub    $0x8,%esp
+    20b1:	68 62 b4 00 00       	push   $0xb462
+    20b6:	6a 01                	push   $0x1
+    20b8:	e8 54 84 00 00       	call   a511 <printf>
+    20bd:	83 c4 10             	add    $0x10,%esp
+    20c0:	eb dc                	jmp    209e <preempt+0x71>
+  close(pfds[1]);
+    20c2:	83 ec 0c             	sub    $0xc,%esp
+    20c5:	ff 75 e4             	push   -0x1c(%ebp)
+    20c8:	e8 3a 7f 00 00       	call   a007 <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+    20cd:	83 c4 0c             	add    $0xc,%esp
+    20d0:	68 00 20 00 00       	push   $0x2000
+    20d5:	68 a0 2c 01 00       	push   $0x12ca0
+    20da:	ff 75 e0             	push   -0x20(%ebp)
+    20dd:	e8 1a 80 00 00       	call   a0fc <read>
+    20e2:	83 c4 10             	add    $0x10,%esp
+    20e5:	83 f8 01             	cmp    $0x1,%eax
+    20e8:	74 1a                	je     2104 <preempt+0xd7>
+    printf(1, "preempt read error");
+    20ea:	83 ec 08             	sub    $0x8,%esp
+    20ed:	68 76 b4 00 00       	push   $0xb476
+    20f2:	6a 01                	push   $0x1
+    20f4:	e8 18 84 00 00       	call   a511 <printf>
+    return;
+    20f9:	83 c4 10             	add    $0x10,%esp
+}
+    20fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    20ff:	5b                   	pop    %ebx
+    2100:	5e                   	pop    %esi
+    2101:	5f                   	pop    %edi
+    2102:	5d                   	pop    %ebp
+    2103:	c3                   	ret
+  close(pfds[0]);
+    2104:	83 ec 0c             	sub    $0xc,%esp
+    2107:	ff 75 e0             	push   -0x20(%ebp)
+    210a:	e8 f8 7e 00 00       	call   a007 <close>
+  printf(1, "kill... ");
+    210f:	83 c4 08             	add    $0x8,%esp
+    2112:	68 89 b4 00 00       	push   $0xb489
+    2117:	6a 01                	push   $0x1
+    2119:	e8 f3 83 00 00       	call   a511 <printf>
+  kill(pid1);
+    211e:	89 1c 24             	mov    %ebx,(%esp)
+    2121:	e8 f4 7f 00 00       	call   a11a <kill>
+  kill(pid2);
+    2126:	89 34 24             	mov    %esi,(%esp)
+    2129:	e8 ec 7f 00 00       	call   a11a <kill>
+  kill(pid3);
+    212e:	89 3c 24             	mov    %edi,(%esp)
+    2131:	e8 e4 7f 00 00       	call   a11a <kill>
+  printf(1, "wait... ");
+    2136:	83 c4 08             	add    $0x8,%esp
+    2139:	68 92 b4 00 00       	push   $0xb492
+    213e:	6a 01                	push   $0x1
+    2140:	e8 cc 83 00 00       	call   a511 <printf>
+  wait();
+    2145:	e8 94 7f 00 00       	call   a0de <wait>
+  wait();
+    214a:	e8 8f 7f 00 00       	call   a0de <wait>
+  wait();
+    214f:	e8 8a 7f 00 00       	call   a0de <wait>
+  printf(1, "preempt ok\n");
+    2154:	83 c4 08             	add    $0x8,%esp
+    2157:	68 9b b4 00 00       	push   $0xb49b
+    215c:	6a 01                	push   $0x1
+    215e:	e8 ae 83 00 00       	call   a511 <printf>
+    2163:	83 c4 10             	add    $0x10,%esp
+    2166:	eb 94                	jmp    20fc <preempt+0xcf>
+
+00002168 <proclocktest>:
+{
+    2168:	55                   	push   %ebp
+    2169:	89 e5                	mov    %esp,%ebp
+    216b:	56                   	push   %esi
+    216c:	53                   	push   %ebx
+    216d:	83 ec 28             	sub    $0x28,%esp
+  printf(1, "proclock test\n");
+    2170:	68 a7 b4 00 00       	push   $0xb4a7
+    2175:	6a 01                	push   $0x1
+    2177:	e8 95 83 00 00       	call   a511 <printf>
+  if(pipe(ok) < 0){
+    217c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    217f:	89 04 24             	mov    %eax,(%esp)
+    2182:	e8 66 7f 00 00       	call   a0ed <pipe>
+    2187:	83 c4 10             	add    $0x10,%esp
+    218a:	85 c0                	test   %eax,%eax
+    218c:	78 20                	js     21ae <proclocktest+0x46>
+  for(w = 0; w < 3; w++){
+    218e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    2193:	83 fb 02             	cmp    $0x2,%ebx
+    2196:	0f 8f 05 01 00 00    	jg     22a1 <proclocktest+0x139>
+    if((pid = fork()) < 0){
+    219c:	e8 23 7e 00 00       	call   9fc4 <fork>
+    21a1:	89 c6                	mov    %eax,%esi
+    21a3:	85 c0                	test   %eax,%eax
+    21a5:	78 1b                	js     21c2 <proclocktest+0x5a>
+    if(pid)
+    21a7:	74 2d                	je     21d6 <proclocktest+0x6e>
+  for(w = 0; w < 3; w++){
+    21a9:	83 c3 01             	add    $0x1,%ebx
+    21ac:	eb e5                	jmp    2193 <proclocktest+0x2b>
+    printf(1, "proclock: pipe failed\n");
+    21ae:	83 ec 08             	sub    $0x8,%esp
+    21b1:	68 b6 b4 00 00       	push   $0xb4b6
+    21b6:	6a 01                	push   $0x1
+    21b8:	e8 54 83 00 00       	call   a511 <printf>
+    exit();
+    21bd:	e8 16 7e 00 00       	call   9fd8 <exit>
+      printf(1, "proclock: fork failed\n");
+    21c2:	83 ec 08             	sub    $0x8,%esp
+    21c5:	68 cd b4 00 00       	push   $0xb4cd
+    21ca:	6a 01                	push   $0x1
+    21cc:	e8 40 83 00 00       	call   a511 <printf>
+      exit();
+    21d1:	e8 02 7e 00 00       	call   9fd8 <exit>
+    close(ok[0]);
+    21d6:	83 ec 0c             	sub    $0xc,%esp
+    21d9:	ff 75 f0             	push   -0x10(%ebp)
+    21dc:	e8 26 7e 00 00       	call   a007 <close>
+    for(i = 0; i < 50; i++){
+    21e1:	83 c4 10             	add    $0x10,%esp
+    21e4:	eb 55                	jmp    223b <proclocktest+0xd3>
+        exit();
+    21e6:	e8 ed 7d 00 00       	call   9fd8 <exit>
+        exit();
+    21eb:	e8 e8 7d 00 00       	call   9fd8 <exit>
+        close(p[1]);
+    21f0:	83 ec 0c             	sub    $0xc,%esp
+    21f3:	ff 75 ec             	push   -0x14(%ebp)
+    21f6:	e8 0c 7e 00 00       	call   a007 <close>
+        read(p[0], &c, 1);         // Sleeps until killed
+    21fb:	83 c4 0c             	add    $0xc,%esp
+    21fe:	6a 01                	push   $0x1
+    2200:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    2203:	50                   	push   %eax
+    2204:	ff 75 e8             	push   -0x18(%ebp)
+    2207:	e8 f0 7e 00 00       	call   a0fc <read>
+        exit();
+    220c:	e8 c7 7d 00 00       	call   9fd8 <exit>
+      if(kill(pid) < 0 || wait() != pid)
+    2211:	83 ec 0c             	sub    $0xc,%esp
+    2214:	53                   	push   %ebx
+    2215:	e8 00 7f 00 00       	call   a11a <kill>
+    221a:	83 c4 10             	add    $0x10,%esp
+    221d:	85 c0                	test   %eax,%eax
+    221f:	78 64                	js     2285 <proclocktest+0x11d>
+    2221:	e8 b8 7e 00 00       	call   a0de <wait>
+    2226:	39 d8                	cmp    %ebx,%eax
+    2228:	75 5b                	jne    2285 <proclocktest+0x11d>
+      close(p[1]);
+    222a:	83 ec 0c             	sub    $0xc,%esp
+    222d:	ff 75 ec             	push   -0x14(%ebp)
+    2230:	e8 d2 7d 00 00       	call   a007 <close>
+    for(i = 0; i < 50; i++){
+    2235:	83 c6 01             	add    $0x1,%esi
+    2238:	83 c4 10             	add    $0x10,%esp
+    223b:	83 fe 31             	cmp    $0x31,%esi
+    223e:	7f 4a                	jg     228a <proclocktest+0x122>
+      if(pipe(p) < 0)
+    2240:	83 ec 0c             	sub    $0xc,%esp
+    2243:	8d 45 e8             	lea    -0x18(%ebp),%eax
+    2246:	50                   	push   %eax
+    2247:	e8 a1 7e 00 00       	call   a0ed <pipe>
+    224c:	83 c4 10             	add    $0x10,%esp
+    224f:	85 c0                	test   %eax,%eax
+    2251:	78 93                	js     21e6 <proclocktest+0x7e>
+      if((pid = fork()) < 0)
+    2253:	e8 6c 7d 00 00       	call   9fc4 <fork>
+    2258:	89 c3                	mov    %eax,%ebx
+    225a:	85 c0                	test   %eax,%eax
+    225c:	78 8d                	js     21eb <proclocktest+0x83>
+      if(pid == 0){
+    225e:	74 90                	je     21f0 <proclocktest+0x88>
+      close(p[0]);
+    2260:	83 ec 0c             	sub    $0xc,%esp
+    2263:	ff 75 e8             	push   -0x18(%ebp)
+    2266:	e8 9c 7d 00 00       	call   a007 <close>
+      if(i & 1)
+    226b:	83 c4 10             	add    $0x10,%esp
+    226e:	f7 c6 01 00 00 00    	test   $0x1,%esi
+    2274:	74 9b                	je     2211 <proclocktest+0xa9>
+        sleep(1);
+    2276:	83 ec 0c             	sub    $0xc,%esp
+    2279:	6a 01                	push   $0x1
+    227b:	e8 3f 7f 00 00       	call   a1bf <sleep>
+    2280:	83 c4 10             	add    $0x10,%esp
+    2283:	eb 8c                	jmp    2211 <proclocktest+0xa9>
+        exit();
+    2285:	e8 4e 7d 00 00       	call   9fd8 <exit>
+    write(ok[1], "x", 1);
+    228a:	83 ec 04             	sub    $0x4,%esp
+    228d:	6a 01                	push   $0x1
+    228f:	68 72 bb 00 00       	push   $0xbb72
+    2294:	ff 75 f4             	push   -0xc(%ebp)
+    2297:	e8 6f 7e 00 00       	call   a10b <write>
+    exit();
+    229c:	e8 37 7d 00 00       	call   9fd8 <exit>
+  close(ok[1]);
+    22a1:	83 ec 0c             	sub    $0xc,%esp
+    22a4:	ff 75 f4             	push   -0xc(%ebp)
+    22a7:	e8 5b 7d 00 00       	call   a007 <close>
+  for(n = 0; read(ok[0], &c, 1) == 1; n++)
+    22ac:	83 c4 10             	add    $0x10,%esp
+    22af:	bb 00 00 00 00       	mov    $0x0,%ebx
+    22b4:	eb 03                	jmp    22b9 <proclocktest+0x151>
+    22b6:	83 c3 01             	add    $0x1,%ebx
+    22b9:	83 ec 04             	sub    $0x4,%esp
+    22bc:	6a 01                	push   $0x1
+    22be:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    22c1:	50                   	push   %eax
+    22c2:	ff 75 f0             	push   -0x10(%ebp)
+    22c5:	e8 32 7e 00 00       	call   a0fc <read>
+    22ca:	83 c4 10             	add    $0x10,%esp
+    22cd:	83 f8 01             	cmp    $0x1,%eax
+    22d0:	74 e4                	je     22b6 <proclocktest+0x14e>
+  close(ok[0]);
+    22d2:	83 ec 0c             	sub    $0xc,%esp
+    22d5:	ff 75 f0             	push   -0x10(%ebp)
+    22d8:	e8 2a 7d 00 00       	call   a007 <close>
+  for(w = 0; w < 3; w++)
+    22dd:	83 c4 10             	add    $0x10,%esp
+    22e0:	be 00 00 00 00       	mov    $0x0,%esi
+    22e5:	eb 08                	jmp    22ef <proclocktest+0x187>
+    wait();
+    22e7:	e8 f2 7d 00 00       	call   a0de <wait>
+  for(w = 0; w < 3; w++)
+    22ec:	83 c6 01             	add    $0x1,%esi
+    22ef:	83 fe 02             	cmp    $0x2,%esi
+    22f2:	7e f3                	jle    22e7 <proclocktest+0x17f>
+  if(n != 3){
+    22f4:	83 fb 03             	cmp    $0x3,%ebx
+    22f7:	75 19                	jne    2312 <proclocktest+0x1aa>
+  printf(1, "proclock test OK\n");
+    22f9:	83 ec 08             	sub    $0x8,%esp
+    22fc:	68 e4 b4 00 00       	push   $0xb4e4
+    2301:	6a 01                	push   $0x1
+    2303:	e8 09 82 00 00       	call   a511 <printf>
+}
+    2308:	83 c4 10             	add    $0x10,%esp
+    230b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    230e:	5b                   	pop    %ebx
+    230f:	5e                   	pop    %esi
+    2310:	5d                   	pop    %ebp
+    2311:	c3                   	ret
+    printf(1, "proclock: %d of 3 workers failed\n", 3 - n);
+    2312:	83 ec 04             	sub    $0x4,%esp
+    2315:	b8 03 00 00 00       	mov    $0x3,%eax
+    231a:	29 d8                	sub    %ebx,%eax
+    231c:	50                   	push   %eax
+    231d:	68 b0 d8 00 00       	push   $0xd8b0
+    2322:	6a 01                	push   $0x1
+    2324:	e8 e8 81 00 00       	call   a511 <printf>
+    exit();
+    2329:	e8 aa 7c 00 00       	call   9fd8 <exit>
+
+0000232e <sysentertest>:
+{
+    232e:	55                   	push   %ebp
+    232f:	89 e5                	mov    %esp,%ebp
+    2331:	57                   	push   %edi
+    2332:	56                   	push   %esi
+    2333:	53                   	push   %ebx
+    2334:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "sysenter test\n");
+    2337:	68 f6 b4 00 00       	push   $0xb4f6
+    233c:	6a 01                	push   $0x1
+    233e:	e8 ce 81 00 00       	call   a511 <printf>
+  asm volatile("int %2" : "=a" (a) : "a" (SYS_getpid), "i" (T_SYSCALL));
+    2343:	b8 0b 00 00 00       	mov    $0xb,%eax
+    2348:	cd 40                	int    $0x40
+    234a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(a != getpid()){
+    234d:	e8 4f 7e 00 00       	call   a1a1 <getpid>
+    2352:	83 c4 10             	add    $0x10,%esp
+    2355:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    2358:	39 c8                	cmp    %ecx,%eax
+    235a:	75 7a                	jne    23d6 <sysentertest+0xa8>
+  asm volatile("movl $1f, %%edx; movl %%esp, %%ecx; sysenter; 1:"
+    235c:	b8 0b 00 00 00       	mov    $0xb,%eax
+    2361:	be 11 11 11 11       	mov    $0x11111111,%esi
+    2366:	bf 22 22 22 22       	mov    $0x22222222,%edi
+    236b:	bb 33 33 33 33       	mov    $0x33333333,%ebx
+    2370:	ba 79 23 00 00       	mov    $0x2379,%edx
+    2375:	89 e1                	mov    %esp,%ecx
+    2377:	0f 34                	sysenter
+  if(b != a || esi != 0x11111111 || edi != 0x22222222 || ebx != 0x33333333){
+    2379:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    237c:	0f 95 c0             	setne  %al
+    237f:	81 fe 11 11 11 11    	cmp    $0x11111111,%esi
+    2385:	0f 95 c2             	setne  %dl
+    2388:	08 d0                	or     %dl,%al
+    238a:	75 64                	jne    23f0 <sysentertest+0xc2>
+    238c:	81 ff 22 22 22 22    	cmp    $0x22222222,%edi
+    2392:	0f 95 c2             	setne  %dl
+    2395:	81 fb 33 33 33 33    	cmp    $0x33333333,%ebx
+    239b:	0f 95 c0             	setne  %al
+    239e:	84 d2                	test   %dl,%dl
+    23a0:	75 4e                	jne    23f0 <sysentertest+0xc2>
+    23a2:	84 c0                	test   %al,%al
+    23a4:	75 4a                	jne    23f0 <sysentertest+0xc2>
+  pid = fork();
+    23a6:	e8 19 7c 00 00       	call   9fc4 <fork>
+    23ab:	89 c3                	mov    %eax,%ebx
+  if(pid == 0){
+    23ad:	85 c0                	test   %eax,%eax
+    23af:	74 53                	je     2404 <sysentertest+0xd6>
+  if(pid < 0 || wait() != pid){
+    23b1:	78 76                	js     2429 <sysentertest+0xfb>
+    23b3:	e8 26 7d 00 00       	call   a0de <wait>
+    23b8:	39 d8                	cmp    %ebx,%eax
+    23ba:	75 6d                	jne    2429 <sysentertest+0xfb>
+  printf(1, "sysenter test OK\n");
+    23bc:	83 ec 08             	sub    $0x8,%esp
+    23bf:	68 36 b5 00 00       	push   $0xb536
+    23c4:	6a 01                	push   $0x1
+    23c6:	e8 46 81 00 00       	call   a511 <printf>
+}
+    23cb:	83 c4 10             	add    $0x10,%esp
+    23ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    23d1:	5b                   	pop    %ebx
+    23d2:	5e                   	pop    %esi
+    23d3:	5f                   	pop    %edi
+    23d4:	5d                   	pop    %ebp
+    23d5:	c3                   	ret
+    printf(1, "sysenter: getpid %d by int, %d by sysenter\n", a, getpid());
+    23d6:	e8 c6 7d 00 00       	call   a1a1 <getpid>
+    23db:	50                   	push   %eax
+    23dc:	ff 75 e4             	push   -0x1c(%ebp)
+    23df:	68 d4 d8 00 00       	push   $0xd8d4
+    23e4:	6a 01                	push   $0x1
+    23e6:	e8 26 81 00 00       	call   a511 <printf>
+    exit();
+    23eb:	e8 e8 7b 00 00       	call   9fd8 <exit>
+    printf(1, "sysenter: registers lost\n");
+    23f0:	83 ec 08             	sub    $0x8,%esp
+    23f3:	68 05 b5 00 00       	push   $0xb505
+    23f8:	6a 01                	push   $0x1
+    23fa:	e8 12 81 00 00       	call   a511 <printf>
+    exit();
+    23ff:	e8 d4 7b 00 00       	call   9fd8 <exit>
+    if(getpid() == a)
+    2404:	e8 98 7d 00 00       	call   a1a1 <getpid>
+    2409:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    240c:	39 d0                	cmp    %edx,%eax
+    240e:	74 05                	je     2415 <sysentertest+0xe7>
+    exit();
+    2410:	e8 c3 7b 00 00       	call   9fd8 <exit>
+      printf(1, "sysenter: child is its parent\n");
+    2415:	83 ec 08             	sub    $0x8,%esp
+    2418:	68 00 d9 00 00       	push   $0xd900
+    241d:	6a 01                	push   $0x1
+    241f:	e8 ed 80 00 00       	call   a511 <printf>
+    2424:	83 c4 10             	add    $0x10,%esp
+    2427:	eb e7                	jmp    2410 <sysentertest+0xe2>
+    printf(1, "sysenter: fork failed\n");
+    2429:	83 ec 08             	sub    $0x8,%esp
+    242c:	68 1f b5 00 00       	push   $0xb51f
+    2431:	6a 01                	push   $0x1
+    2433:	e8 d9 80 00 00       	call   a511 <printf>
+    exit();
+    2438:	e8 9b 7b 00 00       	call   9fd8 <exit>
+
+0000243d <mem>:
+{
+    243d:	55                   	push   %ebp
+    243e:	89 e5                	mov    %esp,%ebp
+    2440:	57                   	push   %edi
+    2441:	56                   	push   %esi
+    2442:	53                   	push   %ebx
+    2443:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "mem test\n");
+    2446:	68 48 b5 00 00       	push   $0xb548
+    244b:	6a 01                	push   $0x1
+    244d:	e8 bf 80 00 00       	call   a511 <printf>
+  ppid = getpid();
+    2452:	e8 4a 7d 00 00       	call   a1a1 <getpid>
+    2457:	89 c6                	mov    %eax,%esi
+  if((pid = fork()) == 0){
+    2459:	e8 66 7b 00 00       	call   9fc4 <fork>
+    245e:	83 c4 10             	add    $0x10,%esp
+    2461:	85 c0                	test   %eax,%eax
+    2463:	0f 85 82 00 00 00    	jne    24eb <mem+0xae>
+    m1 = 0;
+    2469:	bb 00 00 00 00       	mov    $0x0,%ebx
+    246e:	eb 04                	jmp    2474 <mem+0x37>
+      *(char**)m2 = m1;
+    2470:	89 18                	mov    %ebx,(%eax)
+      m1 = m2;
+    2472:	89 c3                	mov    %eax,%ebx
+    while((m2 = malloc(10001)) != 0){
+    2474:	83 ec 0c             	sub    $0xc,%esp
+    2477:	68 11 27 00 00       	push   $0x2711
+    247c:	e8 16 84 00 00       	call   a897 <malloc>
+    2481:	83 c4 10             	add    $0x10,%esp
+    2484:	85 c0                	test   %eax,%eax
+    2486:	75 e8                	jne    2470 <mem+0x33>
+    2488:	eb 10                	jmp    249a <mem+0x5d>
+      m2 = *(char**)m1;
+    248a:	8b 3b                	mov    (%ebx),%edi
+      free(m1);
+    248c:	83 ec 0c             	sub    $0xc,%esp
+    248f:	53                   	push   %ebx
+    2490:	e8 ab 83 00 00       	call   a840 <free>
+    2495:	83 c4 10             	add    $0x10,%esp
+      m1 = m2;
+    2498:	89 fb                	mov    %edi,%ebx
+    while(m1){
+    249a:	85 db                	test   %ebx,%ebx
+    249c:	75 ec                	jne    248a <mem+0x4d>
+    m1 = malloc(1024*20);
+    249e:	83 ec 0c             	sub    $0xc,%esp
+    24a1:	68 00 50 00 00       	push   $0x5000
+    24a6:	e8 ec 83 00 00       	call   a897 <malloc>
+    if(m1 == 0){
+    24ab:	83 c4 10             	add    $0x10,%esp
+    24ae:	85 c0                	test   %eax,%eax
+    24b0:	74 1d                	je     24cf <mem+0x92>
+    free(m1);
+    24b2:	83 ec 0c             	sub    $0xc,%esp
+    24b5:	50                   	push   %eax
+    24b6:	e8 85 83 00 00       	call   a840 <free>
+    printf(1, "mem ok\n");
+    24bb:	83 c4 08             	add    $0x8,%esp
+    24be:	68 6c b5 00 00       	push   $0xb56c
+    24c3:	6a 01                	push   $0x1
+    24c5:	e8 47 80 00 00       	call   a511 <printf>
+    exit();
+    24ca:	e8 09 7b 00 00       	call   9fd8 <exit>
+      printf(1, "couldn't allocate mem?!!\n");
+    24cf:	83 ec 08             	sub    $0x8,%esp
+    24d2:	68 52 b5 00 00       	push   $0xb552
+    24d7:	6a 01                	push   $0x1
+    24d9:	e8 33 80 00 00       	call   a511 <printf>
+      kill(ppid);
+    24de:	89 34 24             	mov    %esi,(%esp)
+    24e1:	e8 34 7c 00 00       	call   a11a <kill>
+      exit();
+    24e6:	e8 ed 7a 00 00       	call   9fd8 <exit>
+    wait();
+    24eb:	e8 ee 7b 00 00       	call   a0de <wait>
+}
+    24f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    24f3:	5b                   	pop    %ebx
+    24f4:	5e                   	pop    %esi
+    24f5:	5f                   	pop    %edi
+    24f6:	5d                   	pop    %ebp
+    24f7:	c3                   	ret
+
+000024f8 <sharedfd>:
+{
+    24f8:	55                   	push   %ebp
+    24f9:	89 e5                	mov    %esp,%ebp
+    24fb:	57                   	push   %edi
+    24fc:	56                   	push   %esi
+    24fd:	53                   	push   %ebx
+    24fe:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "sharedfd test\n");
+    2501:	68 74 b5 00 00       	push   $0xb574
+    2506:	6a 01                	push   $0x1
+    2508:	e8 04 80 00 00       	call   a511 <printf>
+  unlink("sharedfd");
+    250d:	c7 04 24 83 b5 00 00 	movl   $0xb583,(%esp)
+    2514:	e8 2e 7c 00 00       	call   a147 <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+    2519:	83 c4 08             	add    $0x8,%esp
+    251c:	68 02 02 00 00       	push   $0x202
+    2521:	68 83 b5 00 00       	push   $0xb583
+    2526:	e8 fe 7b 00 00       	call   a129 <open>
+  if(fd < 0){
+    252b:	83 c4 10             	add    $0x10,%esp
+    252e:	85 c0                	test   %eax,%eax
+    2530:	78 4d                	js     257f <sharedfd+0x87>
+    2532:	89 c6                	mov    %eax,%esi
+  pid = fork();
+    2534:	e8 8b 7a 00 00       	call   9fc4 <fork>
+    2539:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    253b:	85 c0                	test   %eax,%eax
+    253d:	75 57                	jne    2596 <sharedfd+0x9e>
+    253f:	b8 63 00 00 00       	mov    $0x63,%eax
+    2544:	83 ec 04             	sub    $0x4,%esp
+    2547:	6a 0a                	push   $0xa
+    2549:	50                   	push   %eax
+    254a:	8d 45 de             	lea    -0x22(%ebp),%eax
+    254d:	50                   	push   %eax
+    254e:	e8 de 74 00 00       	call   9a31 <memset>
+  for(i = 0; i < 1000; i++){
+    2553:	83 c4 10             	add    $0x10,%esp
+    2556:	bb 00 00 00 00       	mov    $0x0,%ebx
+    255b:	81 fb e7 03 00 00    	cmp    $0x3e7,%ebx
+    2561:	7f 4c                	jg     25af <sharedfd+0xb7>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    2563:	83 ec 04             	sub    $0x4,%esp
+    2566:	6a 0a                	push   $0xa
+    2568:	8d 45 de             	lea    -0x22(%ebp),%eax
+    256b:	50                   	push   %eax
+    256c:	56                   	push   %esi
+    256d:	e8 99 7b 00 00       	call   a10b <write>
+    2572:	83 c4 10             	add    $0x10,%esp
+    2575:	83 f8 0a             	cmp    $0xa,%eax
+    2578:	75 23                	jne    259d <sharedfd+0xa5>
+  for(i = 0; i < 1000; i++){
+    257a:	83 c3 01             	add    $0x1,%ebx
+    257d:	eb dc                	jmp    255b <sharedfd+0x63>
+    printf(1, "fstests: cannot open sharedfd for writing");
+    257f:	83 ec 08             	sub    $0x8,%esp
+    2582:	68 20 d9 00 00       	push   $0xd920
+    2587:	6a 01                	push   $0x1
+    2589:	e8 83 7f 00 00       	call   a511 <printf>
+    return;
+    258e:	83 c4 10             	add    $0x10,%esp
+    2591:	e9 e4 00 00 00       	jmp    267a <sharedfd+0x182>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    2596:	b8 70 00 00 00       	mov    $0x70,%eax
+    259b:	eb a7                	jmp    2544 <sharedfd+0x4c>
+      printf(1, "fstests: write sharedfd failed\n");
+    259d:	83 ec 08             	sub    $0x8,%esp
+    25a0:	68 4c d9 00 00       	push   $0xd94c
+    25a5:	6a 01                	push   $0x1
+    25a7:	e8 65 7f 00 00       	call   a511 <printf>
+      break;
+    25ac:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0)
+    25af:	85 ff                	test   %edi,%edi
+    25b1:	74 4d                	je     2600 <sharedfd+0x108>
+    wait();
+    25b3:	e8 26 7b 00 00       	call   a0de <wait>
+  close(fd);
+    25b8:	83 ec 0c             	sub    $0xc,%esp
+    25bb:	56                   	push   %esi
+    25bc:	e8 46 7a 00 00       	call   a007 <close>
+  fd = open("sharedfd", 0);
+    25c1:	83 c4 08             	add    $0x8,%esp
+    25c4:	6a 00                	push   $0x0
+    25c6:	68 83 b5 00 00       	push   $0xb583
+    25cb:	e8 59 7b 00 00       	call   a129 <open>
+    25d0:	89 c7                	mov    %eax,%edi
+  if(fd < 0){
+    25d2:	83 c4 10             	add    $0x10,%esp
+    25d5:	85 c0                	test   %eax,%eax
+    25d7:	78 2c                	js     2605 <sharedfd+0x10d>
+  nc = np = 0;
+    25d9:	be 00 00 00 00       	mov    $0x0,%esi
+    25de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    25e3:	83 ec 04             	sub    $0x4,%esp
+    25e6:	6a 0a                	push   $0xa
+    25e8:	8d 45 de             	lea    -0x22(%ebp),%eax
+    25eb:	50                   	push   %eax
+    25ec:	57                   	push   %edi
+    25ed:	e8 0a 7b 00 00       	call   a0fc <read>
+    25f2:	83 c4 10             	add    $0x10,%esp
+    25f5:	85 c0                	test   %eax,%eax
+    25f7:	7e 41                	jle    263a <sharedfd+0x142>
+    for(i = 0; i < sizeof(buf); i++){
+    25f9:	b8 00 00 00 00       	mov    $0x0,%eax
+    25fe:	eb 21                	jmp    2621 <sharedfd+0x129>
+    exit();
+    2600:	e8 d3 79 00 00       	call   9fd8 <exit>
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    2605:	83 ec 08             	sub    $0x8,%esp
+    2608:	68 6c d9 00 00       	push   $0xd96c
+    260d:	6a 01                	push   $0x1
+    260f:	e8 fd 7e 00 00       	call   a511 <printf>
+    return;
+    2614:	83 c4 10             	add    $0x10,%esp
+    2617:	eb 61                	jmp    267a <sharedfd+0x182>
+      if(buf[i] == 'p')
+    2619:	80 fa 70             	cmp    $0x70,%dl
+    261c:	74 17                	je     2635 <sharedfd+0x13d>
+    for(i = 0; i < sizeof(buf); i++){
+    261e:	83 c0 01             	add    $0x1,%eax
+    2621:	83 f8 09             	cmp    $0x9,%eax
+    2624:	77 bd                	ja     25e3 <sharedfd+0xeb>
+      if(buf[i] == 'c')
+    2626:	0f b6 54 05 de       	movzbl -0x22(%ebp,%eax,1),%edx
+    262b:	80 fa 63             	cmp    $0x63,%dl
+    262e:	75 e9                	jne    2619 <sharedfd+0x121>
+        nc++;
+    2630:	83 c3 01             	add    $0x1,%ebx
+    2633:	eb e4                	jmp    2619 <sharedfd+0x121>
+        np++;
+    2635:	83 c6 01             	add    $0x1,%esi
+    2638:	eb e4                	jmp    261e <sharedfd+0x126>
+  close(fd);
+    263a:	83 ec 0c             	sub    $0xc,%esp
+    263d:	57                   	push   %edi
+    263e:	e8 c4 79 00 00       	call   a007 <close>
+  unlink("sharedfd");
+    2643:	c7 04 24 83 b5 00 00 	movl   $0xb583,(%esp)
+    264a:	e8 f8 7a 00 00       	call   a147 <unlink>
+  if(nc == 10000 && np == 10000){
+    264f:	83 c4 10             	add    $0x10,%esp
+    2652:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+    2658:	0f 94 c2             	sete   %dl
+    265b:	81 fe 10 27 00 00    	cmp    $0x2710,%esi
+    2661:	0f 94 c0             	sete   %al
+    2664:	84 c2                	test   %al,%dl
+    2666:	74 1a                	je     2682 <sharedfd+0x18a>
+    printf(1, "sharedfd ok\n");
+    2668:	83 ec 08             	sub    $0x8,%esp
+    266b:	68 8c b5 00 00       	push   $0xb58c
+    2670:	6a 01                	push   $0x1
+    2672:	e8 9a 7e 00 00       	call   a511 <printf>
+    2677:	83 c4 10             	add    $0x10,%esp
+}
+    267a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    267d:	5b                   	pop    %ebx
+    267e:	5e                   	pop    %esi
+    267f:	5f                   	pop    %edi
+    2680:	5d                   	pop    %ebp
+    2681:	c3                   	ret
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    2682:	56                   	push   %esi
+    2683:	53                   	push   %ebx
+    2684:	68 99 b5 00 00       	push   $0xb599
+    2689:	6a 01                	push   $0x1
+    268b:	e8 81 7e 00 00       	call   a511 <printf>
+    exit();
+    2690:	e8 43 79 00 00       	call   9fd8 <exit>
+
+00002695 <fourfiles>:
+{
+    2695:	55                   	push   %ebp
+    2696:	89 e5                	mov    %esp,%ebp
+    2698:	57                   	push   %edi
+    2699:	56                   	push   %esi
+    269a:	53                   	push   %ebx
+    269b:	83 ec 34             	sub    $0x34,%esp
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    269e:	c7 45 d8 12 bf 00 00 	movl   $0xbf12,-0x28(%ebp)
+    26a5:	c7 45 dc cd b7 00 00 	movl   $0xb7cd,-0x24(%ebp)
+    26ac:	c7 45 e0 d1 b7 00 00 	movl   $0xb7d1,-0x20(%ebp)
+    26b3:	c7 45 e4 ae b5 00 00 	movl   $0xb5ae,-0x1c(%ebp)
+  printf(1, "fourfiles test\n");
+    26ba:	68 b1 b5 00 00       	push   $0xb5b1
+    26bf:	6a 01                	push   $0x1
+    26c1:	e8 4b 7e 00 00       	call   a511 <printf>
+  for(pi = 0; pi < 4; pi++){
+    26c6:	83 c4 10             	add    $0x10,%esp
+    26c9:	be 00 00 00 00       	mov    $0x0,%esi
+    26ce:	eb 45                	jmp    2715 <fourfiles+0x80>
+      printf(1, "fork failed\n");
+    26d0:	83 ec 08             	sub    $0x8,%esp
+    26d3:	68 b6 be 00 00       	push   $0xbeb6
+    26d8:	6a 01                	push   $0x1
+    26da:	e8 32 7e 00 00       	call   a511 <printf>
+      exit();
+    26df:	e8 f4 78 00 00       	call   9fd8 <exit>
+        printf(1, "create failed\n");
+    26e4:	83 ec 08             	sub    $0x8,%esp
+    26e7:	68 30 c8 00 00       	push   $0xc830
+    26ec:	6a 01                	push   $0x1
+    26ee:	e8 1e 7e 00 00       	call   a511 <printf>
+        exit();
+    26f3:	e8 e0 78 00 00       	call   9fd8 <exit>
+          printf(1, "write failed %d\n", n);
+    26f8:	83 ec 04             	sub    $0x4,%esp
+    26fb:	50                   	push   %eax
+    26fc:	68 c1 b5 00 00       	push   $0xb5c1
+    2701:	6a 01                	push   $0x1
+    2703:	e8 09 7e 00 00       	call   a511 <printf>
+          exit();
+    2708:	e8 cb 78 00 00       	call   9fd8 <exit>
+      exit();
+    270d:	e8 c6 78 00 00       	call   9fd8 <exit>
+  for(pi = 0; pi < 4; pi++){
+    2712:	83 c6 01             	add    $0x1,%esi
+    2715:	83 fe 03             	cmp    $0x3,%esi
+    2718:	7f 78                	jg     2792 <fourfiles+0xfd>
+    fname = names[pi];
+    271a:	8b 7c b5 d8          	mov    -0x28(%ebp,%esi,4),%edi
+    unlink(fname);
+    271e:	83 ec 0c             	sub    $0xc,%esp
+    2721:	57                   	push   %edi
+    2722:	e8 20 7a 00 00       	call   a147 <unlink>
+    pid = fork();
+    2727:	e8 98 78 00 00       	call   9fc4 <fork>
+    if(pid < 0){
+    272c:	83 c4 10             	add    $0x10,%esp
+    272f:	85 c0                	test   %eax,%eax
+    2731:	78 9d                	js     26d0 <fourfiles+0x3b>
+    if(pid == 0){
+    2733:	75 dd                	jne    2712 <fourfiles+0x7d>
+      fd = open(fname, O_CREATE | O_RDWR);
+    2735:	89 c3                	mov    %eax,%ebx
+    2737:	83 ec 08             	sub    $0x8,%esp
+    273a:	68 02 02 00 00       	push   $0x202
+    273f:	57                   	push   %edi
+    2740:	e8 e4 79 00 00       	call   a129 <open>
+    2745:	89 c7                	mov    %eax,%edi
+      if(fd < 0){
+    2747:	83 c4 10             	add    $0x10,%esp
+    274a:	85 c0                	test   %eax,%eax
+    274c:	78 96                	js     26e4 <fourfiles+0x4f>
+      memset(buf, '0'+pi, 512);
+    274e:	83 ec 04             	sub    $0x4,%esp
+    2751:	68 00 02 00 00       	push   $0x200
+    2756:	83 c6 30             	add    $0x30,%esi
+    2759:	56                   	push   %esi
+    275a:	68 a0 2c 01 00       	push   $0x12ca0
+    275f:	e8 cd 72 00 00       	call   9a31 <memset>
+      for(i = 0; i < 12; i++){
+    2764:	83 c4 10             	add    $0x10,%esp
+    2767:	83 fb 0b             	cmp    $0xb,%ebx
+    276a:	7f a1                	jg     270d <fourfiles+0x78>
+        if((n = write(fd, buf, 500)) != 500){
+    276c:	83 ec 04             	sub    $0x4,%esp
+    276f:	68 f4 01 00 00       	push   $0x1f4
+    2774:	68 a0 2c 01 00       	push   $0x12ca0
+    2779:	57                   	push   %edi
+    277a:	e8 8c 79 00 00       	call   a10b <write>
+    277f:	83 c4 10             	add    $0x10,%esp
+    2782:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    2787:	0f 85 6b ff ff ff    	jne    26f8 <fourfiles+0x63>
+      for(i = 0; i < 12; i++){
+    278d:	83 c3 01             	add    $0x1,%ebx
+    2790:	eb d5                	jmp    2767 <fourfiles+0xd2>
+  for(pi = 0; pi < 4; pi++){
+    2792:	bb 00 00 00 00       	mov    $0x0,%ebx
+    2797:	eb 08                	jmp    27a1 <fourfiles+0x10c>
+    wait();
+    2799:	e8 40 79 00 00       	call   a0de <wait>
+  for(pi = 0; pi < 4; pi++){
+    279e:	83 c3 01             	add    $0x1,%ebx
+    27a1:	83 fb 03             	cmp    $0x3,%ebx
+    27a4:	7e f3                	jle    2799 <fourfiles+0x104>
+  for(i = 0; i < 2; i++){
+    27a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+    27ab:	eb 78                	jmp    2825 <fourfiles+0x190>
+          printf(1, "wrong char\n");
+    27ad:	83 ec 08             	sub    $0x8,%esp
+    27b0:	68 d2 b5 00 00       	push   $0xb5d2
+    27b5:	6a 01                	push   $0x1
+    27b7:	e8 55 7d 00 00       	call   a511 <printf>
+          exit();
+    27bc:	e8 17 78 00 00       	call   9fd8 <exit>
+      total += n;
+    27c1:	01 fe                	add    %edi,%esi
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    27c3:	83 ec 04             	sub    $0x4,%esp
+    27c6:	68 00 20 00 00       	push   $0x2000
+    27cb:	68 a0 2c 01 00       	push   $0x12ca0
+    27d0:	ff 75 d4             	push   -0x2c(%ebp)
+    27d3:	e8 24 79 00 00       	call   a0fc <read>
+    27d8:	89 c7                	mov    %eax,%edi
+    27da:	83 c4 10             	add    $0x10,%esp
+    27dd:	85 c0                	test   %eax,%eax
+    27df:	7e 1c                	jle    27fd <fourfiles+0x168>
+      for(j = 0; j < n; j++){
+    27e1:	b8 00 00 00 00       	mov    $0x0,%eax
+    27e6:	39 f8                	cmp    %edi,%eax
+    27e8:	7d d7                	jge    27c1 <fourfiles+0x12c>
+        if(buf[j] != '0'+i){
+    27ea:	0f be 88 a0 2c 01 00 	movsbl 0x12ca0(%eax),%ecx
+    27f1:	8d 53 30             	lea    0x30(%ebx),%edx
+    27f4:	39 d1                	cmp    %edx,%ecx
+    27f6:	75 b5                	jne    27ad <fourfiles+0x118>
+      for(j = 0; j < n; j++){
+    27f8:	83 c0 01             	add    $0x1,%eax
+    27fb:	eb e9                	jmp    27e6 <fourfiles+0x151>
+    close(fd);
+    27fd:	8b 7d d0             	mov    -0x30(%ebp),%edi
+    2800:	83 ec 0c             	sub    $0xc,%esp
+    2803:	ff 75 d4             	push   -0x2c(%ebp)
+    2806:	e8 fc 77 00 00       	call   a007 <close>
+    if(total != 12*500){
+    280b:	83 c4 10             	add    $0x10,%esp
+    280e:	81 fe 70 17 00 00    	cmp    $0x1770,%esi
+    2814:	75 36                	jne    284c <fourfiles+0x1b7>
+    unlink(fname);
+    2816:	83 ec 0c             	sub    $0xc,%esp
+    2819:	57                   	push   %edi
+    281a:	e8 28 79 00 00       	call   a147 <unlink>
+  for(i = 0; i < 2; i++){
+    281f:	83 c3 01             	add    $0x1,%ebx
+    2822:	83 c4 10             	add    $0x10,%esp
+    2825:	83 fb 01             	cmp    $0x1,%ebx
+    2828:	7f 37                	jg     2861 <fourfiles+0x1cc>
+    fname = names[i];
+    282a:	8b 7c 9d d8          	mov    -0x28(%ebp,%ebx,4),%edi
+    fd = open(fname, 0);
+    282e:	83 ec 08             	sub    $0x8,%esp
+    2831:	6a 00                	push   $0x0
+    2833:	57                   	push   %edi
+    2834:	e8 f0 78 00 00       	call   a129 <open>
+    2839:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    283c:	83 c4 10             	add    $0x10,%esp
+    total = 0;
+    283f:	be 00 00 00 00       	mov    $0x0,%esi
+    2844:	89 7d d0             	mov    %edi,-0x30(%ebp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    2847:	e9 77 ff ff ff       	jmp    27c3 <fourfiles+0x12e>
+      printf(1, "wrong length %d\n", total);
+    284c:	83 ec 04             	sub    $0x4,%esp
+    284f:	56                   	push   %esi
+    2850:	68 de b5 00 00       	push   $0xb5de
+    2855:	6a 01                	push   $0x1
+    2857:	e8 b5 7c 00 00       	call   a511 <printf>
+      exit();
+    285c:	e8 77 77 00 00       	call   9fd8 <exit>
+  printf(1, "fourfiles ok\n");
+    2861:	83 ec 08             	sub    $0x8,%esp
+    2864:	68 ef b5 00 00       	push   $0xb5ef
+    2869:	6a 01                	push   $0x1
+    286b:	e8 a1 7c 00 00       	call   a511 <printf>
+}
+    2870:	83 c4 10             	add    $0x10,%esp
+    2873:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2876:	5b                   	pop    %ebx
+    2877:	5e                   	pop    %esi
+    2878:	5f                   	pop    %edi
+    2879:	5d                   	pop    %ebp
+    287a:	c3                   	ret
+
+0000287b <bigtranstest>:
+{
+    287b:	55                   	push   %ebp
+    287c:	89 e5                	mov    %esp,%ebp
+    287e:	56                   	push   %esi
+    287f:	53                   	push   %ebx
+  printf(1, "bigtrans test\n");
+    2880:	83 ec 08             	sub    $0x8,%esp
+    2883:	68 fd b5 00 00       	push   $0xb5fd
+    2888:	6a 01                	push   $0x1
+    288a:	e8 82 7c 00 00       	call   a511 <printf>
+  if((p = malloc(N)) == 0){
+    288f:	c7 04 24 00 80 02 00 	movl   $0x28000,(%esp)
+    2896:	e8 fc 7f 00 00       	call   a897 <malloc>
+    289b:	83 c4 10             	add    $0x10,%esp
+    289e:	85 c0                	test   %eax,%eax
+    28a0:	74 09                	je     28ab <bigtranstest+0x30>
+    28a2:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < N; i++)
+    28a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+    28a9:	eb 39                	jmp    28e4 <bigtranstest+0x69>
+    printf(1, "bigtrans: malloc failed\n");
+    28ab:	83 ec 08             	sub    $0x8,%esp
+    28ae:	68 0c b6 00 00       	push   $0xb60c
+    28b3:	6a 01                	push   $0x1
+    28b5:	e8 57 7c 00 00       	call   a511 <printf>
+    exit();
+    28ba:	e8 19 77 00 00       	call   9fd8 <exit>
+    p[i] = i % 251;
+    28bf:	ba bf bf 8c 82       	mov    $0x828cbfbf,%edx
+    28c4:	89 c8                	mov    %ecx,%eax
+    28c6:	f7 ea                	imul   %edx
+    28c8:	01 ca                	add    %ecx,%edx
+    28ca:	c1 fa 07             	sar    $0x7,%edx
+    28cd:	89 c8                	mov    %ecx,%eax
+    28cf:	c1 f8 1f             	sar    $0x1f,%eax
+    28d2:	29 c2                	sub    %eax,%edx
+    28d4:	69 c2 fb 00 00 00    	imul   $0xfb,%edx,%eax
+    28da:	89 ca                	mov    %ecx,%edx
+    28dc:	29 c2                	sub    %eax,%edx
+    28de:	88 14 0b             	mov    %dl,(%ebx,%ecx,1)
+  for(i = 0; i < N; i++)
+    28e1:	83 c1 01             	add    $0x1,%ecx
+    28e4:	81 f9 ff 7f 02 00    	cmp    $0x27fff,%ecx
+    28ea:	7e d3                	jle    28bf <bigtranstest+0x44>
+  if((fd = open("bigtrans", O_CREATE|O_RDWR)) < 0){
+    28ec:	83 ec 08             	sub    $0x8,%esp
+    28ef:	68 02 02 00 00       	push   $0x202
+    28f4:	68 25 b6 00 00       	push   $0xb625
+    28f9:	e8 2b 78 00 00       	call   a129 <open>
+    28fe:	89 c6                	mov    %eax,%esi
+    2900:	83 c4 10             	add    $0x10,%esp
+    2903:	85 c0                	test   %eax,%eax
+    2905:	0f 88 aa 00 00 00    	js     29b5 <bigtranstest+0x13a>
+  if(write(fd, "x", 1) != 1 || write(fd, p, N) != N){
+    290b:	83 ec 04             	sub    $0x4,%esp
+    290e:	6a 01                	push   $0x1
+    2910:	68 72 bb 00 00       	push   $0xbb72
+    2915:	50                   	push   %eax
+    2916:	e8 f0 77 00 00       	call   a10b <write>
+    291b:	83 c4 10             	add    $0x10,%esp
+    291e:	83 f8 01             	cmp    $0x1,%eax
+    2921:	0f 85 a2 00 00 00    	jne    29c9 <bigtranstest+0x14e>
+    2927:	83 ec 04             	sub    $0x4,%esp
+    292a:	68 00 80 02 00       	push   $0x28000
+    292f:	53                   	push   %ebx
+    2930:	56                   	push   %esi
+    2931:	e8 d5 77 00 00       	call   a10b <write>
+    2936:	83 c4 10             	add    $0x10,%esp
+    2939:	3d 00 80 02 00       	cmp    $0x28000,%eax
+    293e:	0f 85 85 00 00 00    	jne    29c9 <bigtranstest+0x14e>
+  close(fd);
+    2944:	83 ec 0c             	sub    $0xc,%esp
+    2947:	56                   	push   %esi
+    2948:	e8 ba 76 00 00       	call   a007 <close>
+  memset(p, 0, N);
+    294d:	83 c4 0c             	add    $0xc,%esp
+    2950:	68 00 80 02 00       	push   $0x28000
+    2955:	6a 00                	push   $0x0
+    2957:	53                   	push   %ebx
+    2958:	e8 d4 70 00 00       	call   9a31 <memset>
+  if((fd = open("bigtrans", 0)) < 0 || read(fd, p, 1) != 1 || read(fd, p, N) != N){
+    295d:	83 c4 08             	add    $0x8,%esp
+    2960:	6a 00                	push   $0x0
+    2962:	68 25 b6 00 00       	push   $0xb625
+    2967:	e8 bd 77 00 00       	call   a129 <open>
+    296c:	89 c6                	mov    %eax,%esi
+    296e:	83 c4 10             	add    $0x10,%esp
+    2971:	85 c0                	test   %eax,%eax
+    2973:	78 68                	js     29dd <bigtranstest+0x162>
+    2975:	83 ec 04             	sub    $0x4,%esp
+    2978:	6a 01                	push   $0x1
+    297a:	53                   	push   %ebx
+    297b:	50                   	push   %eax
+    297c:	e8 7b 77 00 00       	call   a0fc <read>
+    2981:	83 c4 10             	add    $0x10,%esp
+    2984:	83 f8 01             	cmp    $0x1,%eax
+    2987:	75 54                	jne    29dd <bigtranstest+0x162>
+    2989:	83 ec 04             	sub    $0x4,%esp
+    298c:	68 00 80 02 00       	push   $0x28000
+    2991:	53                   	push   %ebx
+    2992:	56                   	push   %esi
+    2993:	e8 64 77 00 00       	call   a0fc <read>
+    2998:	83 c4 10             	add    $0x10,%esp
+    299b:	3d 00 80 02 00       	cmp    $0x28000,%eax
+    29a0:	75 3b                	jne    29dd <bigtranstest+0x162>
+  close(fd);
+    29a2:	83 ec 0c             	sub    $0xc,%esp
+    29a5:	56                   	push   %esi
+    29a6:	e8 5c 76 00 00       	call   a007 <close>
+  for(i = 0; i < N; i++)
+    29ab:	83 c4 10             	add    $0x10,%esp
+    29ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+    29b3:	eb 3f                	jmp    29f4 <bigtranstest+0x179>
+    printf(1, "bigtrans: create failed\n");
+    29b5:	83 ec 08             	sub    $0x8,%esp
+    29b8:	68 2e b6 00 00       	push   $0xb62e
+    29bd:	6a 01                	push   $0x1
+    29bf:	e8 4d 7b 00 00       	call   a511 <printf>
+    exit();
+    29c4:	e8 0f 76 00 00       	call   9fd8 <exit>
+    printf(1, "bigtrans: write failed\n");
+    29c9:	83 ec 08             	sub    $0x8,%esp
+    29cc:	68 47 b6 00 00       	push   $0xb647
+    29d1:	6a 01                	push   $0x1
+    29d3:	e8 39 7b 00 00       	call   a511 <printf>
+    exit();
+    29d8:	e8 fb 75 00 00       	call   9fd8 <exit>
+    printf(1, "bigtrans: read failed\n");
+    29dd:	83 ec 08             	sub    $0x8,%esp
+    29e0:	68 5f b6 00 00       	push   $0xb65f
+    29e5:	6a 01                	push   $0x1
+    29e7:	e8 25 7b 00 00       	call   a511 <printf>
+    exit();
+    29ec:	e8 e7 75 00 00       	call   9fd8 <exit>
+  for(i = 0; i < N; i++)
+    29f1:	83 c1 01             	add    $0x1,%ecx
+    29f4:	81 f9 ff 7f 02 00    	cmp    $0x27fff,%ecx
+    29fa:	7f 39                	jg     2a35 <bigtranstest+0x1ba>
+    if(p[i] != (char)(i % 251)){
+    29fc:	ba bf bf 8c 82       	mov    $0x828cbfbf,%edx
+    2a01:	89 c8                	mov    %ecx,%eax
+    2a03:	f7 ea                	imul   %edx
+    2a05:	01 ca                	add    %ecx,%edx
+    2a07:	c1 fa 07             	sar    $0x7,%edx
+    2a0a:	89 c8                	mov    %ecx,%eax
+    2a0c:	c1 f8 1f             	sar    $0x1f,%eax
+    2a0f:	29 c2                	sub    %eax,%edx
+    2a11:	69 c2 fb 00 00 00    	imul   $0xfb,%edx,%eax
+    2a17:	89 ca                	mov    %ecx,%edx
+    2a19:	29 c2                	sub    %eax,%edx
+    2a1b:	38 14 0b             	cmp    %dl,(%ebx,%ecx,1)
+    2a1e:	74 d1                	je     29f1 <bigtranstest+0x176>
+      printf(1, "bigtrans: bad data at %d\n", i);
+    2a20:	83 ec 04             	sub    $0x4,%esp
+    2a23:	51                   	push   %ecx
+    2a24:	68 76 b6 00 00       	push   $0xb676
+    2a29:	6a 01                	push   $0x1
+    2a2b:	e8 e1 7a 00 00       	call   a511 <printf>
+      exit();
+    2a30:	e8 a3 75 00 00       	call   9fd8 <exit>
+  free(p);
+    2a35:	83 ec 0c             	sub    $0xc,%esp
+    2a38:	53                   	push   %ebx
+    2a39:	e8 02 7e 00 00       	call   a840 <free>
+  unlink("bigtrans");
+    2a3e:	c7 04 24 25 b6 00 00 	movl   $0xb625,(%esp)
+    2a45:	e8 fd 76 00 00       	call   a147 <unlink>
+  printf(1, "bigtrans test OK\n");
+    2a4a:	83 c4 08             	add    $0x8,%esp
+    2a4d:	68 90 b6 00 00       	push   $0xb690
+    2a52:	6a 01                	push   $0x1
+    2a54:	e8 b8 7a 00 00       	call   a511 <printf>
+}
+    2a59:	83 c4 10             	add    $0x10,%esp
+    2a5c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2a5f:	5b                   	pop    %ebx
+    2a60:	5e                   	pop    %esi
+    2a61:	5d                   	pop    %ebp
+    2a62:	c3                   	ret
+
+00002a63 <bmapcachetest>:
+{
+    2a63:	55                   	push   %ebp
+    2a64:	89 e5                	mov    %esp,%ebp
+    2a66:	57                   	push   %edi
+    2a67:	56                   	push   %esi
+    2a68:	53                   	push   %ebx
+    2a69:	83 ec 34             	sub    $0x34,%esp
+  char *names[] = { "bmc0", "bmc1" };
+    2a6c:	c7 45 e0 a2 b6 00 00 	movl   $0xb6a2,-0x20(%ebp)
+    2a73:	c7 45 e4 a7 b6 00 00 	movl   $0xb6a7,-0x1c(%ebp)
+  printf(1, "bmap cache test\n");
+    2a7a:	68 ac b6 00 00       	push   $0xb6ac
+    2a7f:	6a 01                	push   $0x1
+    2a81:	e8 8b 7a 00 00       	call   a511 <printf>
+  for(k = 0; k < 3; k++){
+    2a86:	83 c4 10             	add    $0x10,%esp
+    2a89:	be 00 00 00 00       	mov    $0x0,%esi
+    2a8e:	e9 46 01 00 00       	jmp    2bd9 <bmapcachetest+0x176>
+        printf(1, "bmap cache: create failed\n");
+    2a93:	83 ec 08             	sub    $0x8,%esp
+    2a96:	68 bd b6 00 00       	push   $0xb6bd
+    2a9b:	6a 01                	push   $0x1
+    2a9d:	e8 6f 7a 00 00       	call   a511 <printf>
+        exit();
+    2aa2:	e8 31 75 00 00       	call   9fd8 <exit>
+    for(i = 0; i < 200; i++){
+    2aa7:	bf 00 00 00 00       	mov    $0x0,%edi
+    2aac:	eb 17                	jmp    2ac5 <bmapcachetest+0x62>
+          printf(1, "bmap cache: write failed\n");
+    2aae:	83 ec 08             	sub    $0x8,%esp
+    2ab1:	68 d8 b6 00 00       	push   $0xb6d8
+    2ab6:	6a 01                	push   $0x1
+    2ab8:	e8 54 7a 00 00       	call   a511 <printf>
+          exit();
+    2abd:	e8 16 75 00 00       	call   9fd8 <exit>
+    for(i = 0; i < 200; i++){
+    2ac2:	83 c7 01             	add    $0x1,%edi
+    2ac5:	81 ff c7 00 00 00    	cmp    $0xc7,%edi
+    2acb:	7f 4c                	jg     2b19 <bmapcachetest+0xb6>
+      for(j = 0; j < 2; j++){
+    2acd:	bb 00 00 00 00       	mov    $0x0,%ebx
+    2ad2:	83 fb 01             	cmp    $0x1,%ebx
+    2ad5:	7f eb                	jg     2ac2 <bmapcachetest+0x5f>
+        memset(buf, 'a' + 2*k + j, 512);
+    2ad7:	83 ec 04             	sub    $0x4,%esp
+    2ada:	68 00 02 00 00       	push   $0x200
+    2adf:	8d 44 73 61          	lea    0x61(%ebx,%esi,2),%eax
+    2ae3:	50                   	push   %eax
+    2ae4:	68 a0 2c 01 00       	push   $0x12ca0
+    2ae9:	e8 43 6f 00 00       	call   9a31 <memset>
+        ((int*)buf)[0] = i;
+    2aee:	89 3d a0 2c 01 00    	mov    %edi,0x12ca0
+        if(write(fd[j], buf, 512) != 512){
+    2af4:	83 c4 0c             	add    $0xc,%esp
+    2af7:	68 00 02 00 00       	push   $0x200
+    2afc:	68 a0 2c 01 00       	push   $0x12ca0
+    2b01:	ff 74 9d d8          	push   -0x28(%ebp,%ebx,4)
+    2b05:	e8 01 76 00 00       	call   a10b <write>
+    2b0a:	83 c4 10             	add    $0x10,%esp
+    2b0d:	3d 00 02 00 00       	cmp    $0x200,%eax
+    2b12:	75 9a                	jne    2aae <bmapcachetest+0x4b>
+      for(j = 0; j < 2; j++){
+    2b14:	83 c3 01             	add    $0x1,%ebx
+    2b17:	eb b9                	jmp    2ad2 <bmapcachetest+0x6f>
+    for(j = 0; j < 2; j++){
+    2b19:	bf 00 00 00 00       	mov    $0x0,%edi
+    2b1e:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    2b21:	eb 2f                	jmp    2b52 <bmapcachetest+0xef>
+          printf(1, "bmap cache: %s block %d wrong\n", names[j], i);
+    2b23:	53                   	push   %ebx
+    2b24:	ff 75 d0             	push   -0x30(%ebp)
+    2b27:	68 98 d9 00 00       	push   $0xd998
+    2b2c:	6a 01                	push   $0x1
+    2b2e:	e8 de 79 00 00       	call   a511 <printf>
+          exit();
+    2b33:	e8 a0 74 00 00       	call   9fd8 <exit>
+      close(fd[j]);
+    2b38:	83 ec 0c             	sub    $0xc,%esp
+    2b3b:	56                   	push   %esi
+    2b3c:	e8 c6 74 00 00       	call   a007 <close>
+      unlink(names[j]);
+    2b41:	83 c4 04             	add    $0x4,%esp
+    2b44:	ff 75 d0             	push   -0x30(%ebp)
+    2b47:	e8 fb 75 00 00       	call   a147 <unlink>
+    for(j = 0; j < 2; j++){
+    2b4c:	83 c7 01             	add    $0x1,%edi
+    2b4f:	83 c4 10             	add    $0x10,%esp
+    2b52:	83 ff 01             	cmp    $0x1,%edi
+    2b55:	7f 7c                	jg     2bd3 <bmapcachetest+0x170>
+      close(fd[j]);
+    2b57:	83 ec 0c             	sub    $0xc,%esp
+    2b5a:	ff 74 bd d8          	push   -0x28(%ebp,%edi,4)
+    2b5e:	e8 a4 74 00 00       	call   a007 <close>
+      fd[j] = open(names[j], 0);
+    2b63:	8b 44 bd e0          	mov    -0x20(%ebp,%edi,4),%eax
+    2b67:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    2b6a:	83 c4 08             	add    $0x8,%esp
+    2b6d:	6a 00                	push   $0x0
+    2b6f:	50                   	push   %eax
+    2b70:	e8 b4 75 00 00       	call   a129 <open>
+    2b75:	89 c6                	mov    %eax,%esi
+    2b77:	89 44 bd d8          	mov    %eax,-0x28(%ebp,%edi,4)
+      for(i = 0; i < 200; i++){
+    2b7b:	83 c4 10             	add    $0x10,%esp
+    2b7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    2b83:	81 fb c7 00 00 00    	cmp    $0xc7,%ebx
+    2b89:	7f ad                	jg     2b38 <bmapcachetest+0xd5>
+        if(read(fd[j], buf, 512) != 512 || ((int*)buf)[0] != i ||
+    2b8b:	83 ec 04             	sub    $0x4,%esp
+    2b8e:	68 00 02 00 00       	push   $0x200
+    2b93:	68 a0 2c 01 00       	push   $0x12ca0
+    2b98:	56                   	push   %esi
+    2b99:	e8 5e 75 00 00       	call   a0fc <read>
+    2b9e:	83 c4 10             	add    $0x10,%esp
+    2ba1:	3d 00 02 00 00       	cmp    $0x200,%eax
+    2ba6:	0f 85 77 ff ff ff    	jne    2b23 <bmapcachetest+0xc0>
+    2bac:	39 1d a0 2c 01 00    	cmp    %ebx,0x12ca0
+    2bb2:	0f 85 6b ff ff ff    	jne    2b23 <bmapcachetest+0xc0>
+           buf[511] != 'a' + 2*k + j){
+    2bb8:	0f be 15 9f 2e 01 00 	movsbl 0x12e9f,%edx
+    2bbf:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    2bc2:	8d 44 47 61          	lea    0x61(%edi,%eax,2),%eax
+        if(read(fd[j], buf, 512) != 512 || ((int*)buf)[0] != i ||
+    2bc6:	39 c2                	cmp    %eax,%edx
+    2bc8:	0f 85 55 ff ff ff    	jne    2b23 <bmapcachetest+0xc0>
+      for(i = 0; i < 200; i++){
+    2bce:	83 c3 01             	add    $0x1,%ebx
+    2bd1:	eb b0                	jmp    2b83 <bmapcachetest+0x120>
+  for(k = 0; k < 3; k++){
+    2bd3:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    2bd6:	83 c6 01             	add    $0x1,%esi
+    2bd9:	83 fe 02             	cmp    $0x2,%esi
+    2bdc:	7f 33                	jg     2c11 <bmapcachetest+0x1ae>
+    for(j = 0; j < 2; j++)
+    2bde:	bb 00 00 00 00       	mov    $0x0,%ebx
+    2be3:	83 fb 01             	cmp    $0x1,%ebx
+    2be6:	0f 8f bb fe ff ff    	jg     2aa7 <bmapcachetest+0x44>
+      if((fd[j] = open(names[j], O_CREATE|O_RDWR)) < 0){
+    2bec:	83 ec 08             	sub    $0x8,%esp
+    2bef:	68 02 02 00 00       	push   $0x202
+    2bf4:	ff 74 9d e0          	push   -0x20(%ebp,%ebx,4)
+    2bf8:	e8 2c 75 00 00       	call   a129 <open>
+    2bfd:	89 44 9d d8          	mov    %eax,-0x28(%ebp,%ebx,4)
+    2c01:	83 c4 10             	add    $0x10,%esp
+    2c04:	85 c0                	test   %eax,%eax
+    2c06:	0f 88 87 fe ff ff    	js     2a93 <bmapcachetest+0x30>
+    for(j = 0; j < 2; j++)
+    2c0c:	83 c3 01             	add    $0x1,%ebx
+    2c0f:	eb d2                	jmp    2be3 <bmapcachetest+0x180>
+  printf(1, "bmap cache test OK\n");
+    2c11:	83 ec 08             	sub    $0x8,%esp
+    2c14:	68 f2 b6 00 00       	push   $0xb6f2
+    2c19:	6a 01                	push   $0x1
+    2c1b:	e8 f1 78 00 00       	call   a511 <printf>
+}
+    2c20:	83 c4 10             	add    $0x10,%esp
+    2c23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2c26:	5b                   	pop    %ebx
+    2c27:	5e                   	pop    %esi
+    2c28:	5f                   	pop    %edi
+    2c29:	5d                   	pop    %ebp
+    2c2a:	c3                   	ret
+
+00002c2b <bigfile>:
+{
+    2c2b:	55                   	push   %ebp
+    2c2c:	89 e5                	mov    %esp,%ebp
+    2c2e:	57                   	push   %edi
+    2c2f:	56                   	push   %esi
+    2c30:	53                   	push   %ebx
+    2c31:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "bigfile test\n");
+    2c34:	68 06 b7 00 00       	push   $0xb706
+    2c39:	6a 01                	push   $0x1
+    2c3b:	e8 d1 78 00 00       	call   a511 <printf>
+  unlink("bigfile");
+    2c40:	c7 04 24 22 b7 00 00 	movl   $0xb722,(%esp)
+    2c47:	e8 fb 74 00 00       	call   a147 <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    2c4c:	83 c4 08             	add    $0x8,%esp
+    2c4f:	68 02 02 00 00       	push   $0x202
+    2c54:	68 22 b7 00 00       	push   $0xb722
+    2c59:	e8 cb 74 00 00       	call   a129 <open>
+  if(fd < 0){
+    2c5e:	83 c4 10             	add    $0x10,%esp
+    2c61:	85 c0                	test   %eax,%eax
+    2c63:	78 41                	js     2ca6 <bigfile+0x7b>
+    2c65:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+    2c67:	bb 00 00 00 00       	mov    $0x0,%ebx
+    2c6c:	83 fb 13             	cmp    $0x13,%ebx
+    2c6f:	7f 5d                	jg     2cce <bigfile+0xa3>
+    memset(buf, i, 600);
+    2c71:	83 ec 04             	sub    $0x4,%esp
+    2c74:	68 58 02 00 00       	push   $0x258
+    2c79:	53                   	push   %ebx
+    2c7a:	68 a0 2c 01 00       	push   $0x12ca0
+    2c7f:	e8 ad 6d 00 00       	call   9a31 <memset>
+    if(write(fd, buf, 600) != 600){
+    2c84:	83 c4 0c             	add    $0xc,%esp
+    2c87:	68 58 02 00 00       	push   $0x258
+    2c8c:	68 a0 2c 01 00       	push   $0x12ca0
+    2c91:	56                   	push   %esi
+    2c92:	e8 74 74 00 00       	call   a10b <write>
+    2c97:	83 c4 10             	add    $0x10,%esp
+    2c9a:	3d 58 02 00 00       	cmp    $0x258,%eax
+    2c9f:	75 19                	jne    2cba <bigfile+0x8f>
+  for(i = 0; i < 20; i++){
+    2ca1:	83 c3 01             	add    $0x1,%ebx
+    2ca4:	eb c6                	jmp    2c6c <bigfile+0x41>
+    printf(1, "cannot create bigfile");
+    2ca6:	83 ec 08             	sub    $0x8,%esp
+    2ca9:	68 14 b7 00 00       	push   $0xb714
+    2cae:	6a 01                	push   $0x1
+    2cb0:	e8 5c 78 00 00       	call   a511 <printf>
+    exit();
+    2cb5:	e8 1e 73 00 00       	call   9fd8 <exit>
+      printf(1, "write bigfile failed\n");
+    2cba:	83 ec 08             	sub    $0x8,%esp
+    2cbd:	68 2a b7 00 00       	push   $0xb72a
+    2cc2:	6a 01                	push   $0x1
+    2cc4:	e8 48 78 00 00       	call   a511 <printf>
+      exit();
+    2cc9:	e8 0a 73 00 00       	call   9fd8 <exit>
+  close(fd);
+    2cce:	83 ec 0c             	sub    $0xc,%esp
+    2cd1:	56                   	push   %esi
+    2cd2:	e8 30 73 00 00       	call   a007 <close>
+  fd = open("bigfile", 0);
+    2cd7:	83 c4 08             	add    $0x8,%esp
+    2cda:	6a 00                	push   $0x0
+    2cdc:	68 22 b7 00 00       	push   $0xb722
+    2ce1:	e8 43 74 00 00       	call   a129 <open>
+    2ce6:	89 c7                	mov    %eax,%edi
+  if(fd < 0){
+    2ce8:	83 c4 10             	add    $0x10,%esp
+    2ceb:	85 c0                	test   %eax,%eax
+    2ced:	78 53                	js     2d42 <bigfile+0x117>
+  total = 0;
+    2cef:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; ; i++){
+    2cf4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    cc = read(fd, buf, 300);
+    2cf9:	83 ec 04             	sub    $0x4,%esp
+    2cfc:	68 2c 01 00 00       	push   $0x12c
+    2d01:	68 a0 2c 01 00       	push   $0x12ca0
+    2d06:	57                   	push   %edi
+    2d07:	e8 f0 73 00 00       	call   a0fc <read>
+    if(cc < 0){
+    2d0c:	83 c4 10             	add    $0x10,%esp
+    2d0f:	85 c0                	test   %eax,%eax
+    2d11:	78 43                	js     2d56 <bigfile+0x12b>
+    if(cc == 0)
+    2d13:	74 7d                	je     2d92 <bigfile+0x167>
+    if(cc != 300){
+    2d15:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    2d1a:	75 4e                	jne    2d6a <bigfile+0x13f>
+    if(buf[0] != i/2 || buf[299] != i/2){
+    2d1c:	0f be 0d a0 2c 01 00 	movsbl 0x12ca0,%ecx
+    2d23:	89 da                	mov    %ebx,%edx
+    2d25:	c1 ea 1f             	shr    $0x1f,%edx
+    2d28:	01 da                	add    %ebx,%edx
+    2d2a:	d1 fa                	sar    %edx
+    2d2c:	39 d1                	cmp    %edx,%ecx
+    2d2e:	75 4e                	jne    2d7e <bigfile+0x153>
+    2d30:	0f be 0d cb 2d 01 00 	movsbl 0x12dcb,%ecx
+    2d37:	39 ca                	cmp    %ecx,%edx
+    2d39:	75 43                	jne    2d7e <bigfile+0x153>
+    total += cc;
+    2d3b:	01 c6                	add    %eax,%esi
+  for(i = 0; ; i++){
+    2d3d:	83 c3 01             	add    $0x1,%ebx
+    cc = read(fd, buf, 300);
+    2d40:	eb b7                	jmp    2cf9 <bigfile+0xce>
+    printf(1, "cannot open bigfile\n");
+    2d42:	83 ec 08             	sub    $0x8,%esp
+    2d45:	68 40 b7 00 00       	push   $0xb740
+    2d4a:	6a 01                	push   $0x1
+    2d4c:	e8 c0 77 00 00       	call   a511 <printf>
+    exit();
+    2d51:	e8 82 72 00 00       	call   9fd8 <exit>
+      printf(1, "read bigfile failed\n");
+    2d56:	83 ec 08             	sub    $0x8,%esp
+    2d59:	68 55 b7 00 00       	push   $0xb755
+    2d5e:	6a 01                	push   $0x1
+    2d60:	e8 ac 77 00 00       	call   a511 <printf>
+      exit();
+    2d65:	e8 6e 72 00 00       	call   9fd8 <exit>
+      printf(1, "short read bigfile\n");
+    2d6a:	83 ec 08             	sub    $0x8,%esp
+    2d6d:	68 6a b7 00 00       	push   $0xb76a
+    2d72:	6a 01                	push   $0x1
+    2d74:	e8 98 77 00 00       	call   a511 <printf>
+      exit();
+    2d79:	e8 5a 72 00 00       	call   9fd8 <exit>
+      printf(1, "read bigfile wrong data\n");
+    2d7e:	83 ec 08             	sub    $0x8,%esp
+    2d81:	68 7e b7 00 00       	push   $0xb77e
+    2d86:	6a 01                	push   $0x1
+    2d88:	e8 84 77 00 00       	call   a511 <printf>
+      exit();
+    2d8d:	e8 46 72 00 00       	call   9fd8 <exit>
+  close(fd);
+    2d92:	83 ec 0c             	sub    $0xc,%esp
+    2d95:	57                   	push   %edi
+    2d96:	e8 6c 72 00 00       	call   a007 <close>
+  if(total != 20*600){
+    2d9b:	83 c4 10             	add    $0x10,%esp
+    2d9e:	81 fe e0 2e 00 00    	cmp    $0x2ee0,%esi
+    2da4:	75 27                	jne    2dcd <bigfile+0x1a2>
+  unlink("bigfile");
+    2da6:	83 ec 0c             	sub    $0xc,%esp
+    2da9:	68 22 b7 00 00       	push   $0xb722
+    2dae:	e8 94 73 00 00       	call   a147 <unlink>
+  printf(1, "bigfile test ok\n");
+    2db3:	83 c4 08             	add    $0x8,%esp
+    2db6:	68 b1 b7 00 00       	push   $0xb7b1
+    2dbb:	6a 01                	push   $0x1
+    2dbd:	e8 4f 77 00 00       	call   a511 <printf>
+}
+    2dc2:	83 c4 10             	add    $0x10,%esp
+    2dc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2dc8:	5b                   	pop    %ebx
+    2dc9:	5e                   	pop    %esi
+    2dca:	5f                   	pop    %edi
+    2dcb:	5d                   	pop    %ebp
+    2dcc:	c3                   	ret
+    printf(1, "read bigfile wrong total\n");
+    2dcd:	83 ec 08             	sub    $0x8,%esp
+    2dd0:	68 97 b7 00 00       	push   $0xb797
+    2dd5:	6a 01                	push   $0x1
+    2dd7:	e8 35 77 00 00       	call   a511 <printf>
+    exit();
+    2ddc:	e8 f7 71 00 00       	call   9fd8 <exit>
+
+00002de1 <linktest>:
+{
+    2de1:	55                   	push   %ebp
+    2de2:	89 e5                	mov    %esp,%ebp
+    2de4:	53                   	push   %ebx
+    2de5:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "linktest\n");
+    2de8:	68 c2 b7 00 00       	push   $0xb7c2
+    2ded:	6a 01                	push   $0x1
+    2def:	e8 1d 77 00 00       	call   a511 <printf>
+  unlink("lf1");
+    2df4:	c7 04 24 cc b7 00 00 	movl   $0xb7cc,(%esp)
+    2dfb:	e8 47 73 00 00       	call   a147 <unlink>
+  unlink("lf2");
+    2e00:	c7 04 24 d0 b7 00 00 	movl   $0xb7d0,(%esp)
+    2e07:	e8 3b 73 00 00       	call   a147 <unlink>
+  fd = open("lf1", O_CREATE|O_RDWR);
+    2e0c:	83 c4 08             	add    $0x8,%esp
+    2e0f:	68 02 02 00 00       	push   $0x202
+    2e14:	68 cc b7 00 00       	push   $0xb7cc
+    2e19:	e8 0b 73 00 00       	call   a129 <open>
+  if(fd < 0){
+    2e1e:	83 c4 10             	add    $0x10,%esp
+    2e21:	85 c0                	test   %eax,%eax
+    2e23:	0f 88 2a 01 00 00    	js     2f53 <linktest+0x172>
+    2e29:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "hello", 5) != 5){
+    2e2b:	83 ec 04             	sub    $0x4,%esp
+    2e2e:	6a 05                	push   $0x5
+    2e30:	68 26 b0 00 00       	push   $0xb026
+    2e35:	50                   	push   %eax
+    2e36:	e8 d0 72 00 00       	call   a10b <write>
+    2e3b:	83 c4 10             	add    $0x10,%esp
+    2e3e:	83 f8 05             	cmp    $0x5,%eax
+    2e41:	0f 85 20 01 00 00    	jne    2f67 <linktest+0x186>
+  close(fd);
+    2e47:	83 ec 0c             	sub    $0xc,%esp
+    2e4a:	53                   	push   %ebx
+    2e4b:	e8 b7 71 00 00       	call   a007 <close>
+  if(link("lf1", "lf2") < 0){
+    2e50:	83 c4 08             	add    $0x8,%esp
+    2e53:	68 d0 b7 00 00       	push   $0xb7d0
+    2e58:	68 cc b7 00 00       	push   $0xb7cc
+    2e5d:	e8 03 73 00 00       	call   a165 <link>
+    2e62:	83 c4 10             	add    $0x10,%esp
+    2e65:	85 c0                	test   %eax,%eax
+    2e67:	0f 88 0e 01 00 00    	js     2f7b <linktest+0x19a>
+  unlink("lf1");
+    2e6d:	83 ec 0c             	sub    $0xc,%esp
+    2e70:	68 cc b7 00 00       	push   $0xb7cc
+    2e75:	e8 cd 72 00 00       	call   a147 <unlink>
+  if(open("lf1", 0) >= 0){
+    2e7a:	83 c4 08             	add    $0x8,%esp
+    2e7d:	6a 00                	push   $0x0
+    2e7f:	68 cc b7 00 00       	push   $0xb7cc
+    2e84:	e8 a0 72 00 00       	call   a129 <open>
+    2e89:	83 c4 10             	add    $0x10,%esp
+    2e8c:	85 c0                	test   %eax,%eax
+    2e8e:	0f 89 fb 00 00 00    	jns    2f8f <linktest+0x1ae>
+  fd = open("lf2", 0);
+    2e94:	83 ec 08             	sub    $0x8,%esp
+    2e97:	6a 00                	push   $0x0
+    2e99:	68 d0 b7 00 00       	push   $0xb7d0
+    2e9e:	e8 86 72 00 00       	call   a129 <open>
+    2ea3:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2ea5:	83 c4 10             	add    $0x10,%esp
+    2ea8:	85 c0                	test   %eax,%eax
+    2eaa:	0f 88 f3 00 00 00    	js     2fa3 <linktest+0x1c2>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    2eb0:	83 ec 04             	sub    $0x4,%esp
+    2eb3:	68 00 20 00 00       	push   $0x2000
+    2eb8:	68 a0 2c 01 00       	push   $0x12ca0
+    2ebd:	50                   	push   %eax
+    2ebe:	e8 39 72 00 00       	call   a0fc <read>
+    2ec3:	83 c4 10             	add    $0x10,%esp
+    2ec6:	83 f8 05             	cmp    $0x5,%eax
+    2ec9:	0f 85 e8 00 00 00    	jne    2fb7 <linktest+0x1d6>
+  close(fd);
+    2ecf:	83 ec 0c             	sub    $0xc,%esp
+    2ed2:	53                   	push   %ebx
+    2ed3:	e8 2f 71 00 00       	call   a007 <close>
+  if(link("lf2", "lf2") >= 0){
+    2ed8:	83 c4 08             	add    $0x8,%esp
+    2edb:	68 d0 b7 00 00       	push   $0xb7d0
+    2ee0:	68 d0 b7 00 00       	push   $0xb7d0
+    2ee5:	e8 7b 72 00 00       	call   a165 <link>
+    2eea:	83 c4 10             	add    $0x10,%esp
+    2eed:	85 c0                	test   %eax,%eax
+    2eef:	0f 89 d6 00 00 00    	jns    2fcb <linktest+0x1ea>
+  unlink("lf2");
+    2ef5:	83 ec 0c             	sub    $0xc,%esp
+    2ef8:	68 d0 b7 00 00       	push   $0xb7d0
+    2efd:	e8 45 72 00 00       	call   a147 <unlink>
+  if(link("lf2", "lf1") >= 0){
+    2f02:	83 c4 08             	add    $0x8,%esp
+    2f05:	68 cc b7 00 00       	push   $0xb7cc
+    2f0a:	68 d0 b7 00 00       	push   $0xb7d0
+    2f0f:	e8 51 72 00 00       	call   a165 <link>
+    2f14:	83 c4 10             	add    $0x10,%esp
+    2f17:	85 c0                	test   %eax,%eax
+    2f19:	0f 89 c0 00 00 00    	jns    2fdf <linktest+0x1fe>
+  if(link(".", "lf1") >= 0){
+    2f1f:	83 ec 08             	sub    $0x8,%esp
+    2f22:	68 cc b7 00 00       	push   $0xb7cc
+    2f27:	68 a9 c0 00 00       	push   $0xc0a9
+    2f2c:	e8 34 72 00 00       	call   a165 <link>
+    2f31:	83 c4 10             	add    $0x10,%esp
+    2f34:	85 c0                	test   %eax,%eax
+    2f36:	0f 89 b7 00 00 00    	jns    2ff3 <linktest+0x212>
+  printf(1, "linktest ok\n");
+    2f3c:	83 ec 08             	sub    $0x8,%esp
+    2f3f:	68 6a b8 00 00       	push   $0xb86a
+    2f44:	6a 01                	push   $0x1
+    2f46:	e8 c6 75 00 00       	call   a511 <printf>
+}
+    2f4b:	83 c4 10             	add    $0x10,%esp
+    2f4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2f51:	c9                   	leave
+    2f52:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    2f53:	83 ec 08             	sub    $0x8,%esp
+    2f56:	68 d4 b7 00 00       	push   $0xb7d4
+    2f5b:	6a 01                	push   $0x1
+    2f5d:	e8 af 75 00 00       	call   a511 <printf>
+    exit();
+    2f62:	e8 71 70 00 00       	call   9fd8 <exit>
+    printf(1, "write lf1 failed\n");
+    2f67:	83 ec 08             	sub    $0x8,%esp
+    2f6a:	68 e7 b7 00 00       	push   $0xb7e7
+    2f6f:	6a 01                	push   $0x1
+    2f71:	e8 9b 75 00 00       	call   a511 <printf>
+    exit();
+    2f76:	e8 5d 70 00 00       	call   9fd8 <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    2f7b:	83 ec 08             	sub    $0x8,%esp
+    2f7e:	68 f9 b7 00 00       	push   $0xb7f9
+    2f83:	6a 01                	push   $0x1
+    2f85:	e8 87 75 00 00       	call   a511 <printf>
+    exit();
+    2f8a:	e8 49 70 00 00       	call   9fd8 <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    2f8f:	83 ec 08             	sub    $0x8,%esp
+    2f92:	68 b8 d9 00 00       	push   $0xd9b8
+    2f97:	6a 01                	push   $0x1
+    2f99:	e8 73 75 00 00       	call   a511 <printf>
+    exit();
+    2f9e:	e8 35 70 00 00       	call   9fd8 <exit>
+    printf(1, "open lf2 failed\n");
+    2fa3:	83 ec 08             	sub    $0x8,%esp
+    2fa6:	68 0e b8 00 00       	push   $0xb80e
+    2fab:	6a 01                	push   $0x1
+    2fad:	e8 5f 75 00 00       	call   a511 <printf>
+    exit();
+    2fb2:	e8 21 70 00 00       	call   9fd8 <exit>
+    printf(1, "read lf2 failed\n");
+    2fb7:	83 ec 08             	sub    $0x8,%esp
+    2fba:	68 1f b8 00 00       	push   $0xb81f
+    2fbf:	6a 01                	push   $0x1
+    2fc1:	e8 4b 75 00 00       	call   a511 <printf>
+    exit();
+    2fc6:	e8 0d 70 00 00       	call   9fd8 <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    2fcb:	83 ec 08             	sub    $0x8,%esp
+    2fce:	68 30 b8 00 00       	push   $0xb830
+    2fd3:	6a 01                	push   $0x1
+    2fd5:	e8 37 75 00 00       	call   a511 <printf>
+    exit();
+    2fda:	e8 f9 6f 00 00       	call   9fd8 <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    2fdf:	83 ec 08             	sub    $0x8,%esp
+    2fe2:	68 e0 d9 00 00       	push   $0xd9e0
+    2fe7:	6a 01                	push   $0x1
+    2fe9:	e8 23 75 00 00       	call   a511 <printf>
+    exit();
+    2fee:	e8 e5 6f 00 00       	call   9fd8 <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    2ff3:	83 ec 08             	sub    $0x8,%esp
+    2ff6:	68 4e b8 00 00       	push   $0xb84e
+    2ffb:	6a 01                	push   $0x1
+    2ffd:	e8 0f 75 00 00       	call   a511 <printf>
+    exit();
+    3002:	e8 d1 6f 00 00       	call   9fd8 <exit>
+
+00003007 <concreate>:
+{
+    3007:	55                   	push   %ebp
+    3008:	89 e5                	mov    %esp,%ebp
+    300a:	57                   	push   %edi
+    300b:	56                   	push   %esi
+    300c:	53                   	push   %ebx
+    300d:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "concreate test\n");
+    3010:	68 77 b8 00 00       	push   $0xb877
+    3015:	6a 01                	push   $0x1
+    3017:	e8 f5 74 00 00       	call   a511 <printf>
+  file[0] = 'C';
+    301c:	c6 45 e5 43          	movb   $0x43,-0x1b(%ebp)
+  file[2] = '\0';
+    3020:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+  for(i = 0; i < 40; i++){
+    3024:	83 c4 10             	add    $0x10,%esp
+    3027:	bb 00 00 00 00       	mov    $0x0,%ebx
+    302c:	eb 5a                	jmp    3088 <concreate+0x81>
+    } else if(pid == 0 && (i % 5) == 1){
+    302e:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    3033:	89 d8                	mov    %ebx,%eax
+    3035:	f7 ea                	imul   %edx
+    3037:	d1 fa                	sar    %edx
+    3039:	89 d8                	mov    %ebx,%eax
+    303b:	c1 f8 1f             	sar    $0x1f,%eax
+    303e:	29 c2                	sub    %eax,%edx
+    3040:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    3043:	89 da                	mov    %ebx,%edx
+    3045:	29 c2                	sub    %eax,%edx
+    3047:	83 fa 01             	cmp    $0x1,%edx
+    304a:	0f 84 9b 00 00 00    	je     30eb <concreate+0xe4>
+      fd = open(file, O_CREATE | O_RDWR);
+    3050:	83 ec 08             	sub    $0x8,%esp
+    3053:	68 02 02 00 00       	push   $0x202
+    3058:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    305b:	50                   	push   %eax
+    305c:	e8 c8 70 00 00       	call   a129 <open>
+      if(fd < 0){
+    3061:	83 c4 10             	add    $0x10,%esp
+    3064:	85 c0                	test   %eax,%eax
+    3066:	0f 88 98 00 00 00    	js     3104 <concreate+0xfd>
+      close(fd);
+    306c:	83 ec 0c             	sub    $0xc,%esp
+    306f:	50                   	push   %eax
+    3070:	e8 92 6f 00 00       	call   a007 <close>
+    3075:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+    3078:	85 f6                	test   %esi,%esi
+    307a:	0f 84 9c 00 00 00    	je     311c <concreate+0x115>
+      wait();
+    3080:	e8 59 70 00 00       	call   a0de <wait>
+  for(i = 0; i < 40; i++){
+    3085:	83 c3 01             	add    $0x1,%ebx
+    3088:	83 fb 27             	cmp    $0x27,%ebx
+    308b:	0f 8f 90 00 00 00    	jg     3121 <concreate+0x11a>
+    file[1] = '0' + i;
+    3091:	8d 43 30             	lea    0x30(%ebx),%eax
+    3094:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    unlink(file);
+    3097:	83 ec 0c             	sub    $0xc,%esp
+    309a:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    309d:	50                   	push   %eax
+    309e:	e8 a4 70 00 00       	call   a147 <unlink>
+    pid = fork();
+    30a3:	e8 1c 6f 00 00       	call   9fc4 <fork>
+    30a8:	89 c6                	mov    %eax,%esi
+    if(pid && (i % 3) == 1){
+    30aa:	83 c4 10             	add    $0x10,%esp
+    30ad:	85 c0                	test   %eax,%eax
+    30af:	0f 84 79 ff ff ff    	je     302e <concreate+0x27>
+    30b5:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    30ba:	89 d8                	mov    %ebx,%eax
+    30bc:	f7 ea                	imul   %edx
+    30be:	89 d8                	mov    %ebx,%eax
+    30c0:	c1 f8 1f             	sar    $0x1f,%eax
+    30c3:	29 c2                	sub    %eax,%edx
+    30c5:	8d 04 52             	lea    (%edx,%edx,2),%eax
+    30c8:	89 da                	mov    %ebx,%edx
+    30ca:	29 c2                	sub    %eax,%edx
+    30cc:	83 fa 01             	cmp    $0x1,%edx
+    30cf:	0f 85 7b ff ff ff    	jne    3050 <concreate+0x49>
+      link("C0", file);
+    30d5:	83 ec 08             	sub    $0x8,%esp
+    30d8:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    30db:	50                   	push   %eax
+    30dc:	68 87 b8 00 00       	push   $0xb887
+    30e1:	e8 7f 70 00 00       	call   a165 <link>
+    30e6:	83 c4 10             	add    $0x10,%esp
+    30e9:	eb 8d                	jmp    3078 <concreate+0x71>
+      link("C0", file);
+    30eb:	83 ec 08             	sub    $0x8,%esp
+    30ee:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    30f1:	50                   	push   %eax
+    30f2:	68 87 b8 00 00       	push   $0xb887
+    30f7:	e8 69 70 00 00       	call   a165 <link>
+    30fc:	83 c4 10             	add    $0x10,%esp
+    30ff:	e9 74 ff ff ff       	jmp    3078 <concreate+0x71>
+        printf(1, "concreate create %s failed\n", file);
+    3104:	83 ec 04             	sub    $0x4,%esp
+    3107:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    310a:	50                   	push   %eax
+    310b:	68 8a b8 00 00       	push   $0xb88a
+    3110:	6a 01                	push   $0x1
+    3112:	e8 fa 73 00 00       	call   a511 <printf>
+        exit();
+    3117:	e8 bc 6e 00 00       	call   9fd8 <exit>
+      exit();
+    311c:	e8 b7 6e 00 00       	call   9fd8 <exit>
+  memset(fa, 0, sizeof(fa));
+    3121:	83 ec 04             	sub    $0x4,%esp
+    3124:	6a 28                	push   $0x28
+    3126:	6a 00                	push   $0x0
+    3128:	8d 45 bd             	lea    -0x43(%ebp),%eax
+    312b:	50                   	push   %eax
+    312c:	e8 00 69 00 00       	call   9a31 <memset>
+  fd = open(".", 0);
+    3131:	83 c4 08             	add    $0x8,%esp
+    3134:	6a 00                	push   $0x0
+    3136:	68 a9 c0 00 00       	push   $0xc0a9
+    313b:	e8 e9 6f 00 00       	call   a129 <open>
+    3140:	89 c3                	mov    %eax,%ebx
+  while(read(fd, &de, sizeof(de)) > 0){
+    3142:	83 c4 10             	add    $0x10,%esp
+  n = 0;
+    3145:	be 00 00 00 00       	mov    $0x0,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    314a:	83 ec 04             	sub    $0x4,%esp
+    314d:	6a 10                	push   $0x10
+    314f:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    3152:	50                   	push   %eax
+    3153:	53                   	push   %ebx
+    3154:	e8 a3 6f 00 00       	call   a0fc <read>
+    3159:	83 c4 10             	add    $0x10,%esp
+    315c:	85 c0                	test   %eax,%eax
+    315e:	7e 60                	jle    31c0 <concreate+0x1b9>
+    if(de.inum == 0)
+    3160:	66 83 7d ac 00       	cmpw   $0x0,-0x54(%ebp)
+    3165:	74 e3                	je     314a <concreate+0x143>
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    3167:	80 7d ae 43          	cmpb   $0x43,-0x52(%ebp)
+    316b:	75 dd                	jne    314a <concreate+0x143>
+    316d:	80 7d b0 00          	cmpb   $0x0,-0x50(%ebp)
+    3171:	75 d7                	jne    314a <concreate+0x143>
+      i = de.name[1] - '0';
+    3173:	0f be 45 af          	movsbl -0x51(%ebp),%eax
+    3177:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    317a:	83 f8 27             	cmp    $0x27,%eax
+    317d:	77 11                	ja     3190 <concreate+0x189>
+      if(fa[i]){
+    317f:	80 7c 05 bd 00       	cmpb   $0x0,-0x43(%ebp,%eax,1)
+    3184:	75 22                	jne    31a8 <concreate+0x1a1>
+      fa[i] = 1;
+    3186:	c6 44 05 bd 01       	movb   $0x1,-0x43(%ebp,%eax,1)
+      n++;
+    318b:	83 c6 01             	add    $0x1,%esi
+    318e:	eb ba                	jmp    314a <concreate+0x143>
+        printf(1, "concreate weird file %s\n", de.name);
+    3190:	83 ec 04             	sub    $0x4,%esp
+    3193:	8d 45 ae             	lea    -0x52(%ebp),%eax
+    3196:	50                   	push   %eax
+    3197:	68 a6 b8 00 00       	push   $0xb8a6
+    319c:	6a 01                	push   $0x1
+    319e:	e8 6e 73 00 00       	call   a511 <printf>
+        exit();
+    31a3:	e8 30 6e 00 00       	call   9fd8 <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    31a8:	83 ec 04             	sub    $0x4,%esp
+    31ab:	8d 45 ae             	lea    -0x52(%ebp),%eax
+    31ae:	50                   	push   %eax
+    31af:	68 bf b8 00 00       	push   $0xb8bf
+    31b4:	6a 01                	push   $0x1
+    31b6:	e8 56 73 00 00       	call   a511 <printf>
+        exit();
+    31bb:	e8 18 6e 00 00       	call   9fd8 <exit>
+  close(fd);
+    31c0:	83 ec 0c             	sub    $0xc,%esp
+    31c3:	53                   	push   %ebx
+    31c4:	e8 3e 6e 00 00       	call   a007 <close>
+  if(n != 40){
+    31c9:	83 c4 10             	add    $0x10,%esp
+    31cc:	83 fe 28             	cmp    $0x28,%esi
+    31cf:	75 0a                	jne    31db <concreate+0x1d4>
+  for(i = 0; i < 40; i++){
+    31d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+    31d6:	e9 86 00 00 00       	jmp    3261 <concreate+0x25a>
+    printf(1, "concreate not enough files in directory listing\n");
+    31db:	83 ec 08             	sub    $0x8,%esp
+    31de:	68 04 da 00 00       	push   $0xda04
+    31e3:	6a 01                	push   $0x1
+    31e5:	e8 27 73 00 00       	call   a511 <printf>
+    exit();
+    31ea:	e8 e9 6d 00 00       	call   9fd8 <exit>
+      printf(1, "fork failed\n");
+    31ef:	83 ec 08             	sub    $0x8,%esp
+    31f2:	68 b6 be 00 00       	push   $0xbeb6
+    31f7:	6a 01                	push   $0x1
+    31f9:	e8 13 73 00 00       	call   a511 <printf>
+      exit();
+    31fe:	e8 d5 6d 00 00       	call   9fd8 <exit>
+      close(open(file, 0));
+    3203:	83 ec 08             	sub    $0x8,%esp
+    3206:	6a 00                	push   $0x0
+    3208:	8d 7d e5             	lea    -0x1b(%ebp),%edi
+    320b:	57                   	push   %edi
+    320c:	e8 18 6f 00 00       	call   a129 <open>
+    3211:	89 04 24             	mov    %eax,(%esp)
+    3214:	e8 ee 6d 00 00       	call   a007 <close>
+      close(open(file, 0));
+    3219:	83 c4 08             	add    $0x8,%esp
+    321c:	6a 00                	push   $0x0
+    321e:	57                   	push   %edi
+    321f:	e8 05 6f 00 00       	call   a129 <open>
+    3224:	89 04 24             	mov    %eax,(%esp)
+    3227:	e8 db 6d 00 00       	call   a007 <close>
+      close(open(file, 0));
+    322c:	83 c4 08             	add    $0x8,%esp
+    322f:	6a 00                	push   $0x0
+    3231:	57                   	push   %edi
+    3232:	e8 f2 6e 00 00       	call   a129 <open>
+    3237:	89 04 24             	mov    %eax,(%esp)
+    323a:	e8 c8 6d 00 00       	call   a007 <close>
+      close(open(file, 0));
+    323f:	83 c4 08             	add    $0x8,%esp
+    3242:	6a 00                	push   $0x0
+    3244:	57                   	push   %edi
+    3245:	e8 df 6e 00 00       	call   a129 <open>
+    324a:	89 04 24             	mov    %eax,(%esp)
+    324d:	e8 b5 6d 00 00       	call   a007 <close>
+    3252:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+    3255:	85 f6                	test   %esi,%esi
+    3257:	74 79                	je     32d2 <concreate+0x2cb>
+      wait();
+    3259:	e8 80 6e 00 00       	call   a0de <wait>
+  for(i = 0; i < 40; i++){
+    325e:	83 c3 01             	add    $0x1,%ebx
+    3261:	83 fb 27             	cmp    $0x27,%ebx
+    3264:	7f 71                	jg     32d7 <concreate+0x2d0>
+    file[1] = '0' + i;
+    3266:	8d 43 30             	lea    0x30(%ebx),%eax
+    3269:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    pid = fork();
+    326c:	e8 53 6d 00 00       	call   9fc4 <fork>
+    3271:	89 c6                	mov    %eax,%esi
+    if(pid < 0){
+    3273:	85 c0                	test   %eax,%eax
+    3275:	0f 88 74 ff ff ff    	js     31ef <concreate+0x1e8>
+    if(((i % 3) == 0 && pid == 0) ||
+    327b:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    3280:	89 d8                	mov    %ebx,%eax
+    3282:	f7 ea                	imul   %edx
+    3284:	89 d8                	mov    %ebx,%eax
+    3286:	c1 f8 1f             	sar    $0x1f,%eax
+    3289:	29 c2                	sub    %eax,%edx
+    328b:	8d 04 52             	lea    (%edx,%edx,2),%eax
+    328e:	89 da                	mov    %ebx,%edx
+    3290:	29 c2                	sub    %eax,%edx
+    3292:	89 d0                	mov    %edx,%eax
+    3294:	09 f0                	or     %esi,%eax
+    3296:	0f 84 67 ff ff ff    	je     3203 <concreate+0x1fc>
+    329c:	83 fa 01             	cmp    $0x1,%edx
+    329f:	75 08                	jne    32a9 <concreate+0x2a2>
+       ((i % 3) == 1 && pid != 0)){
+    32a1:	85 f6                	test   %esi,%esi
+    32a3:	0f 85 5a ff ff ff    	jne    3203 <concreate+0x1fc>
+      unlink(file);
+    32a9:	83 ec 0c             	sub    $0xc,%esp
+    32ac:	8d 7d e5             	lea    -0x1b(%ebp),%edi
+    32af:	57                   	push   %edi
+    32b0:	e8 92 6e 00 00       	call   a147 <unlink>
+      unlink(file);
+    32b5:	89 3c 24             	mov    %edi,(%esp)
+    32b8:	e8 8a 6e 00 00       	call   a147 <unlink>
+      unlink(file);
+    32bd:	89 3c 24             	mov    %edi,(%esp)
+    32c0:	e8 82 6e 00 00       	call   a147 <unlink>
+      unlink(file);
+    32c5:	89 3c 24             	mov    %edi,(%esp)
+    32c8:	e8 7a 6e 00 00       	call   a147 <unlink>
+    32cd:	83 c4 10             	add    $0x10,%esp
+    32d0:	eb 83                	jmp    3255 <concreate+0x24e>
+      exit();
+    32d2:	e8 01 6d 00 00       	call   9fd8 <exit>
+  printf(1, "concreate ok\n");
+    32d7:	83 ec 08             	sub    $0x8,%esp
+    32da:	68 dc b8 00 00       	push   $0xb8dc
+    32df:	6a 01                	push   $0x1
+    32e1:	e8 2b 72 00 00       	call   a511 <printf>
+}
+    32e6:	83 c4 10             	add    $0x10,%esp
+    32e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    32ec:	5b                   	pop    %ebx
+    32ed:	5e                   	pop    %esi
+    32ee:	5f                   	pop    %edi
+    32ef:	5d                   	pop    %ebp
+    32f0:	c3                   	ret
+
+000032f1 <linkunlink>:
+{
+    32f1:	55                   	push   %ebp
+    32f2:	89 e5                	mov    %esp,%ebp
+    32f4:	57                   	push   %edi
+    32f5:	56                   	push   %esi
+    32f6:	53                   	push   %ebx
+    32f7:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "linkunlink test\n");
+    32fa:	68 ea b8 00 00       	push   $0xb8ea
+    32ff:	6a 01                	push   $0x1
+    3301:	e8 0b 72 00 00       	call   a511 <printf>
+  unlink("x");
+    3306:	c7 04 24 72 bb 00 00 	movl   $0xbb72,(%esp)
+    330d:	e8 35 6e 00 00       	call   a147 <unlink>
+  pid = fork();
+    3312:	e8 ad 6c 00 00       	call   9fc4 <fork>
+  if(pid < 0){
+    3317:	83 c4 10             	add    $0x10,%esp
+    331a:	85 c0                	test   %eax,%eax
+    331c:	78 10                	js     332e <linkunlink+0x3d>
+    331e:	89 c7                	mov    %eax,%edi
+  unsigned int x = (pid ? 1 : 97);
+    3320:	74 20                	je     3342 <linkunlink+0x51>
+    3322:	bb 01 00 00 00       	mov    $0x1,%ebx
+    3327:	be 00 00 00 00       	mov    $0x0,%esi
+    332c:	eb 3b                	jmp    3369 <linkunlink+0x78>
+    printf(1, "fork failed\n");
+    332e:	83 ec 08             	sub    $0x8,%esp
+    3331:	68 b6 be 00 00       	push   $0xbeb6
+    3336:	6a 01                	push   $0x1
+    3338:	e8 d4 71 00 00       	call   a511 <printf>
+    exit();
+    333d:	e8 96 6c 00 00       	call   9fd8 <exit>
+  unsigned int x = (pid ? 1 : 97);
+    3342:	bb 61 00 00 00       	mov    $0x61,%ebx
+    3347:	eb de                	jmp    3327 <linkunlink+0x36>
+      close(open("x", O_RDWR | O_CREATE));
+    3349:	83 ec 08             	sub    $0x8,%esp
+    334c:	68 02 02 00 00       	push   $0x202
+    3351:	68 72 bb 00 00       	push   $0xbb72
+    3356:	e8 ce 6d 00 00       	call   a129 <open>
+    335b:	89 04 24             	mov    %eax,(%esp)
+    335e:	e8 a4 6c 00 00       	call   a007 <close>
+    3363:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    3366:	83 c6 01             	add    $0x1,%esi
+    3369:	83 fe 63             	cmp    $0x63,%esi
+    336c:	7f 52                	jg     33c0 <linkunlink+0xcf>
+    x = x * 1103515245 + 12345;
+    336e:	69 db 6d 4e c6 41    	imul   $0x41c64e6d,%ebx,%ebx
+    3374:	81 c3 39 30 00 00    	add    $0x3039,%ebx
+    if((x % 3) == 0){
+    337a:	ba ab aa aa aa       	mov    $0xaaaaaaab,%edx
+    337f:	89 d8                	mov    %ebx,%eax
+    3381:	f7 e2                	mul    %edx
+    3383:	89 d0                	mov    %edx,%eax
+    3385:	d1 e8                	shr    %eax
+    3387:	83 e2 fe             	and    $0xfffffffe,%edx
+    338a:	01 c2                	add    %eax,%edx
+    338c:	89 d8                	mov    %ebx,%eax
+    338e:	29 d0                	sub    %edx,%eax
+    3390:	74 b7                	je     3349 <linkunlink+0x58>
+    } else if((x % 3) == 1){
+    3392:	83 f8 01             	cmp    $0x1,%eax
+    3395:	74 12                	je     33a9 <linkunlink+0xb8>
+      unlink("x");
+    3397:	83 ec 0c             	sub    $0xc,%esp
+    339a:	68 72 bb 00 00       	push   $0xbb72
+    339f:	e8 a3 6d 00 00       	call   a147 <unlink>
+    33a4:	83 c4 10             	add    $0x10,%esp
+    33a7:	eb bd                	jmp    3366 <linkunlink+0x75>
+      link("cat", "x");
+    33a9:	83 ec 08             	sub    $0x8,%esp
+    33ac:	68 72 bb 00 00       	push   $0xbb72
+    33b1:	68 fb b8 00 00       	push   $0xb8fb
+    33b6:	e8 aa 6d 00 00       	call   a165 <link>
+    33bb:	83 c4 10             	add    $0x10,%esp
+    33be:	eb a6                	jmp    3366 <linkunlink+0x75>
+  if(pid)
+    33c0:	85 ff                	test   %edi,%edi
+    33c2:	74 1c                	je     33e0 <linkunlink+0xef>
+    wait();
+    33c4:	e8 15 6d 00 00       	call   a0de <wait>
+  printf(1, "linkunlink ok\n");
+    33c9:	83 ec 08             	sub    $0x8,%esp
+    33cc:	68 ff b8 00 00       	push   $0xb8ff
+    33d1:	6a 01                	push   $0x1
+    33d3:	e8 39 71 00 00       	call   a511 <printf>
+}
+    33d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    33db:	5b                   	pop    %ebx
+    33dc:	5e                   	pop    %esi
+    33dd:	5f                   	pop    %edi
+    33de:	5d                   	pop    %ebp
+    33df:	c3                   	ret
+    exit();
+    33e0:	e8 f3 6b 00 00       	call   9fd8 <exit>
+
+000033e5 <bigdir>:
+{
+    33e5:	55                   	push   %ebp
+    33e6:	89 e5                	mov    %esp,%ebp
+    33e8:	53                   	push   %ebx
+    33e9:	83 ec 1c             	sub    $0x1c,%esp
+  printf(1, "bigdir test\n");
+    33ec:	68 0e b9 00 00       	push   $0xb90e
+    33f1:	6a 01                	push   $0x1
+    33f3:	e8 19 71 00 00       	call   a511 <printf>
+  unlink("bd");
+    33f8:	c7 04 24 1b b9 00 00 	movl   $0xb91b,(%esp)
+    33ff:	e8 43 6d 00 00       	call   a147 <unlink>
+  fd = open("bd", O_CREATE);
+    3404:	83 c4 08             	add    $0x8,%esp
+    3407:	68 00 02 00 00       	push   $0x200
+    340c:	68 1b b9 00 00       	push   $0xb91b
+    3411:	e8 13 6d 00 00       	call   a129 <open>
+  if(fd < 0){
+    3416:	83 c4 10             	add    $0x10,%esp
+    3419:	85 c0                	test   %eax,%eax
+    341b:	78 65                	js     3482 <bigdir+0x9d>
+  close(fd);
+    341d:	83 ec 0c             	sub    $0xc,%esp
+    3420:	50                   	push   %eax
+    3421:	e8 e1 6b 00 00       	call   a007 <close>
+  for(i = 0; i < 500; i++){
+    3426:	83 c4 10             	add    $0x10,%esp
+    3429:	bb 00 00 00 00       	mov    $0x0,%ebx
+    342e:	81 fb f3 01 00 00    	cmp    $0x1f3,%ebx
+    3434:	7f 74                	jg     34aa <bigdir+0xc5>
+    name[0] = 'x';
+    3436:	c6 45 ee 78          	movb   $0x78,-0x12(%ebp)
+    name[1] = '0' + (i / 64);
+    343a:	8d 43 3f             	lea    0x3f(%ebx),%eax
+    343d:	85 db                	test   %ebx,%ebx
+    343f:	0f 49 c3             	cmovns %ebx,%eax
+    3442:	c1 f8 06             	sar    $0x6,%eax
+    3445:	83 c0 30             	add    $0x30,%eax
+    3448:	88 45 ef             	mov    %al,-0x11(%ebp)
+    name[2] = '0' + (i % 64);
+    344b:	89 da                	mov    %ebx,%edx
+    344d:	c1 fa 1f             	sar    $0x1f,%edx
+    3450:	c1 ea 1a             	shr    $0x1a,%edx
+    3453:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+    3456:	83 e0 3f             	and    $0x3f,%eax
+    3459:	29 d0                	sub    %edx,%eax
+    345b:	83 c0 30             	add    $0x30,%eax
+    345e:	88 45 f0             	mov    %al,-0x10(%ebp)
+    name[3] = '\0';
+    3461:	c6 45 f1 00          	movb   $0x0,-0xf(%ebp)
+    if(link("bd", name) != 0){
+    3465:	83 ec 08             	sub    $0x8,%esp
+    3468:	8d 45 ee             	lea    -0x12(%ebp),%eax
+    346b:	50                   	push   %eax
+    346c:	68 1b b9 00 00       	push   $0xb91b
+    3471:	e8 ef 6c 00 00       	call   a165 <link>
+    3476:	83 c4 10             	add    $0x10,%esp
+    3479:	85 c0                	test   %eax,%eax
+    347b:	75 19                	jne    3496 <bigdir+0xb1>
+  for(i = 0; i < 500; i++){
+    347d:	83 c3 01             	add    $0x1,%ebx
+    3480:	eb ac                	jmp    342e <bigdir+0x49>
+    printf(1, "bigdir create failed\n");
+    3482:	83 ec 08             	sub    $0x8,%esp
+    3485:	68 1e b9 00 00       	push   $0xb91e
+    348a:	6a 01                	push   $0x1
+    348c:	e8 80 70 00 00       	call   a511 <printf>
+    exit();
+    3491:	e8 42 6b 00 00       	call   9fd8 <exit>
+      printf(1, "bigdir link failed\n");
+    3496:	83 ec 08             	sub    $0x8,%esp
+    3499:	68 34 b9 00 00       	push   $0xb934
+    349e:	6a 01                	push   $0x1
+    34a0:	e8 6c 70 00 00       	call   a511 <printf>
+      exit();
+    34a5:	e8 2e 6b 00 00       	call   9fd8 <exit>
+  unlink("bd");
+    34aa:	83 ec 0c             	sub    $0xc,%esp
+    34ad:	68 1b b9 00 00       	push   $0xb91b
+    34b2:	e8 90 6c 00 00       	call   a147 <unlink>
+  for(i = 0; i < 500; i++){
+    34b7:	83 c4 10             	add    $0x10,%esp
+    34ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+    34bf:	eb 03                	jmp    34c4 <bigdir+0xdf>
+    34c1:	83 c3 01             	add    $0x1,%ebx
+    34c4:	81 fb f3 01 00 00    	cmp    $0x1f3,%ebx
+    34ca:	7f 56                	jg     3522 <bigdir+0x13d>
+    name[0] = 'x';
+    34cc:	c6 45 ee 78          	movb   $0x78,-0x12(%ebp)
+    name[1] = '0' + (i / 64);
+    34d0:	8d 43 3f             	lea    0x3f(%ebx),%eax
+    34d3:	85 db                	test   %ebx,%ebx
+    34d5:	0f 49 c3             	cmovns %ebx,%eax
+    34d8:	c1 f8 06             	sar    $0x6,%eax
+    34db:	83 c0 30             	add    $0x30,%eax
+    34de:	88 45 ef             	mov    %al,-0x11(%ebp)
+    name[2] = '0' + (i % 64);
+    34e1:	89 da                	mov    %ebx,%edx
+    34e3:	c1 fa 1f             	sar    $0x1f,%edx
+    34e6:	c1 ea 1a             	shr    $0x1a,%edx
+    34e9:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+    34ec:	83 e0 3f             	and    $0x3f,%eax
+    34ef:	29 d0                	sub    %edx,%eax
+    34f1:	83 c0 30             	add    $0x30,%eax
+    34f4:	88 45 f0             	mov    %al,-0x10(%ebp)
+    name[3] = '\0';
+    34f7:	c6 45 f1 00          	movb   $0x0,-0xf(%ebp)
+    if(unlink(name) != 0){
+    34fb:	83 ec 0c             	sub    $0xc,%esp
+    34fe:	8d 45 ee             	lea    -0x12(%ebp),%eax
+    3501:	50                   	push   %eax
+    3502:	e8 40 6c 00 00       	call   a147 <unlink>
+    3507:	83 c4 10             	add    $0x10,%esp
+    350a:	85 c0                	test   %eax,%eax
+    350c:	74 b3                	je     34c1 <bigdir+0xdc>
+      printf(1, "bigdir unlink failed");
+    350e:	83 ec 08             	sub    $0x8,%esp
+    3511:	68 48 b9 00 00       	push   $0xb948
+    3516:	6a 01                	push   $0x1
+    3518:	e8 f4 6f 00 00       	call   a511 <printf>
+      exit();
+    351d:	e8 b6 6a 00 00       	call   9fd8 <exit>
+  printf(1, "bigdir ok\n");
+    3522:	83 ec 08             	sub    $0x8,%esp
+    3525:	68 5d b9 00 00       	push   $0xb95d
+    352a:	6a 01                	push   $0x1
+    352c:	e8 e0 6f 00 00       	call   a511 <printf>
+}
+    3531:	83 c4 10             	add    $0x10,%esp
+    3534:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3537:	c9                   	leave
+    3538:	c3                   	ret
+
+00003539 <subdir>:
+{
+    3539:	55                   	push   %ebp
+    353a:	89 e5                	mov    %esp,%ebp
+    353c:	53                   	push   %ebx
+    353d:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "subdir test\n");
+    3540:	68 68 b9 00 00       	push   $0xb968
+    3545:	6a 01                	push   $0x1
+    3547:	e8 c5 6f 00 00       	call   a511 <printf>
+  unlink("ff");
+    354c:	c7 04 24 f1 b9 00 00 	movl   $0xb9f1,(%esp)
+    3553:	e8 ef 6b 00 00       	call   a147 <unlink>
+  if(mkdir("dd") != 0){
+    3558:	c7 04 24 8e ba 00 00 	movl   $0xba8e,(%esp)
+    355f:	e8 10 6c 00 00       	call   a174 <mkdir>
+    3564:	83 c4 10             	add    $0x10,%esp
+    3567:	85 c0                	test   %eax,%eax
+    3569:	0f 85 14 04 00 00    	jne    3983 <subdir+0x44a>
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    356f:	83 ec 08             	sub    $0x8,%esp
+    3572:	68 02 02 00 00       	push   $0x202
+    3577:	68 c7 b9 00 00       	push   $0xb9c7
+    357c:	e8 a8 6b 00 00       	call   a129 <open>
+    3581:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    3583:	83 c4 10             	add    $0x10,%esp
+    3586:	85 c0                	test   %eax,%eax
+    3588:	0f 88 09 04 00 00    	js     3997 <subdir+0x45e>
+  write(fd, "ff", 2);
+    358e:	83 ec 04             	sub    $0x4,%esp
+    3591:	6a 02                	push   $0x2
+    3593:	68 f1 b9 00 00       	push   $0xb9f1
+    3598:	50                   	push   %eax
+    3599:	e8 6d 6b 00 00       	call   a10b <write>
+  close(fd);
+    359e:	89 1c 24             	mov    %ebx,(%esp)
+    35a1:	e8 61 6a 00 00       	call   a007 <close>
+  if(unlink("dd") >= 0){
+    35a6:	c7 04 24 8e ba 00 00 	movl   $0xba8e,(%esp)
+    35ad:	e8 95 6b 00 00       	call   a147 <unlink>
+    35b2:	83 c4 10             	add    $0x10,%esp
+    35b5:	85 c0                	test   %eax,%eax
+    35b7:	0f 89 ee 03 00 00    	jns    39ab <subdir+0x472>
+  if(mkdir("/dd/dd") != 0){
+    35bd:	83 ec 0c             	sub    $0xc,%esp
+    35c0:	68 a2 b9 00 00       	push   $0xb9a2
+    35c5:	e8 aa 6b 00 00       	call   a174 <mkdir>
+    35ca:	83 c4 10             	add    $0x10,%esp
+    35cd:	85 c0                	test   %eax,%eax
+    35cf:	0f 85 ea 03 00 00    	jne    39bf <subdir+0x486>
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    35d5:	83 ec 08             	sub    $0x8,%esp
+    35d8:	68 02 02 00 00       	push   $0x202
+    35dd:	68 c4 b9 00 00       	push   $0xb9c4
+    35e2:	e8 42 6b 00 00       	call   a129 <open>
+    35e7:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    35e9:	83 c4 10             	add    $0x10,%esp
+    35ec:	85 c0                	test   %eax,%eax
+    35ee:	0f 88 df 03 00 00    	js     39d3 <subdir+0x49a>
+  write(fd, "FF", 2);
+    35f4:	83 ec 04             	sub    $0x4,%esp
+    35f7:	6a 02                	push   $0x2
+    35f9:	68 e5 b9 00 00       	push   $0xb9e5
+    35fe:	50                   	push   %eax
+    35ff:	e8 07 6b 00 00       	call   a10b <write>
+  close(fd);
+    3604:	89 1c 24             	mov    %ebx,(%esp)
+    3607:	e8 fb 69 00 00       	call   a007 <close>
+  fd = open("dd/dd/../ff", 0);
+    360c:	83 c4 08             	add    $0x8,%esp
+    360f:	6a 00                	push   $0x0
+    3611:	68 e8 b9 00 00       	push   $0xb9e8
+    3616:	e8 0e 6b 00 00       	call   a129 <open>
+    361b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    361d:	83 c4 10             	add    $0x10,%esp
+    3620:	85 c0                	test   %eax,%eax
+    3622:	0f 88 bf 03 00 00    	js     39e7 <subdir+0x4ae>
+  cc = read(fd, buf, sizeof(buf));
+    3628:	83 ec 04             	sub    $0x4,%esp
+    362b:	68 00 20 00 00       	push   $0x2000
+    3630:	68 a0 2c 01 00       	push   $0x12ca0
+    3635:	50                   	push   %eax
+    3636:	e8 c1 6a 00 00       	call   a0fc <read>
+  if(cc != 2 || buf[0] != 'f'){
+    363b:	83 c4 10             	add    $0x10,%esp
+    363e:	83 f8 02             	cmp    $0x2,%eax
+    3641:	0f 85 b4 03 00 00    	jne    39fb <subdir+0x4c2>
+    3647:	80 3d a0 2c 01 00 66 	cmpb   $0x66,0x12ca0
+    364e:	0f 85 a7 03 00 00    	jne    39fb <subdir+0x4c2>
+  close(fd);
+    3654:	83 ec 0c             	sub    $0xc,%esp
+    3657:	53                   	push   %ebx
+    3658:	e8 aa 69 00 00       	call   a007 <close>
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    365d:	83 c4 08             	add    $0x8,%esp
+    3660:	68 28 ba 00 00       	push   $0xba28
+    3665:	68 c4 b9 00 00       	push   $0xb9c4
+    366a:	e8 f6 6a 00 00       	call   a165 <link>
+    366f:	83 c4 10             	add    $0x10,%esp
+    3672:	85 c0                	test   %eax,%eax
+    3674:	0f 85 95 03 00 00    	jne    3a0f <subdir+0x4d6>
+  if(unlink("dd/dd/ff") != 0){
+    367a:	83 ec 0c             	sub    $0xc,%esp
+    367d:	68 c4 b9 00 00       	push   $0xb9c4
+    3682:	e8 c0 6a 00 00       	call   a147 <unlink>
+    3687:	83 c4 10             	add    $0x10,%esp
+    368a:	85 c0                	test   %eax,%eax
+    368c:	0f 85 91 03 00 00    	jne    3a23 <subdir+0x4ea>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    3692:	83 ec 08             	sub    $0x8,%esp
+    3695:	6a 00                	push   $0x0
+    3697:	68 c4 b9 00 00       	push   $0xb9c4
+    369c:	e8 88 6a 00 00       	call   a129 <open>
+    36a1:	83 c4 10             	add    $0x10,%esp
+    36a4:	85 c0                	test   %eax,%eax
+    36a6:	0f 89 8b 03 00 00    	jns    3a37 <subdir+0x4fe>
+  if(chdir("dd") != 0){
+    36ac:	83 ec 0c             	sub    $0xc,%esp
+    36af:	68 8e ba 00 00       	push   $0xba8e
+    36b4:	e8 ca 6a 00 00       	call   a183 <chdir>
+    36b9:	83 c4 10             	add    $0x10,%esp
+    36bc:	85 c0                	test   %eax,%eax
+    36be:	0f 85 87 03 00 00    	jne    3a4b <subdir+0x512>
+  if(chdir("dd/../../dd") != 0){
+    36c4:	83 ec 0c             	sub    $0xc,%esp
+    36c7:	68 5c ba 00 00       	push   $0xba5c
+    36cc:	e8 b2 6a 00 00       	call   a183 <chdir>
+    36d1:	83 c4 10             	add    $0x10,%esp
+    36d4:	85 c0                	test   %eax,%eax
+    36d6:	0f 85 83 03 00 00    	jne    3a5f <subdir+0x526>
+  if(chdir("dd/../../../dd") != 0){
+    36dc:	83 ec 0c             	sub    $0xc,%esp
+    36df:	68 82 ba 00 00       	push   $0xba82
+    36e4:	e8 9a 6a 00 00       	call   a183 <chdir>
+    36e9:	83 c4 10             	add    $0x10,%esp
+    36ec:	85 c0                	test   %eax,%eax
+    36ee:	0f 85 7f 03 00 00    	jne    3a73 <subdir+0x53a>
+  if(chdir("./..") != 0){
+    36f4:	83 ec 0c             	sub    $0xc,%esp
+    36f7:	68 a6 c0 00 00       	push   $0xc0a6
+    36fc:	e8 82 6a 00 00       	call   a183 <chdir>
+    3701:	83 c4 10             	add    $0x10,%esp
+    3704:	85 c0                	test   %eax,%eax
+    3706:	0f 85 7b 03 00 00    	jne    3a87 <subdir+0x54e>
+  fd = open("dd/dd/ffff", 0);
+    370c:	83 ec 08             	sub    $0x8,%esp
+    370f:	6a 00                	push   $0x0
+    3711:	68 28 ba 00 00       	push   $0xba28
+    3716:	e8 0e 6a 00 00       	call   a129 <open>
+    371b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    371d:	83 c4 10             	add    $0x10,%esp
+    3720:	85 c0                	test   %eax,%eax
+    3722:	0f 88 73 03 00 00    	js     3a9b <subdir+0x562>
+  if(read(fd, buf, sizeof(buf)) != 2){
+    3728:	83 ec 04             	sub    $0x4,%esp
+    372b:	68 00 20 00 00       	push   $0x2000
+    3730:	68 a0 2c 01 00       	push   $0x12ca0
+    3735:	50                   	push   %eax
+    3736:	e8 c1 69 00 00       	call   a0fc <read>
+    373b:	83 c4 10             	add    $0x10,%esp
+    373e:	83 f8 02             	cmp    $0x2,%eax
+    3741:	0f 85 68 03 00 00    	jne    3aaf <subdir+0x576>
+  close(fd);
+    3747:	83 ec 0c             	sub    $0xc,%esp
+    374a:	53                   	push   %ebx
+    374b:	e8 b7 68 00 00       	call   a007 <close>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    3750:	83 c4 08             	add    $0x8,%esp
+    3753:	6a 00                	push   $0x0
+    3755:	68 c4 b9 00 00       	push   $0xb9c4
+    375a:	e8 ca 69 00 00       	call   a129 <open>
+    375f:	83 c4 10             	add    $0x10,%esp
+    3762:	85 c0                	test   %eax,%eax
+    3764:	0f 89 59 03 00 00    	jns    3ac3 <subdir+0x58a>
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    376a:	83 ec 08             	sub    $0x8,%esp
+    376d:	68 02 02 00 00       	push   $0x202
+    3772:	68 d7 ba 00 00       	push   $0xbad7
+    3777:	e8 ad 69 00 00       	call   a129 <open>
+    377c:	83 c4 10             	add    $0x10,%esp
+    377f:	85 c0                	test   %eax,%eax
+    3781:	0f 89 50 03 00 00    	jns    3ad7 <subdir+0x59e>
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    3787:	83 ec 08             	sub    $0x8,%esp
+    378a:	68 02 02 00 00       	push   $0x202
+    378f:	68 fc ba 00 00       	push   $0xbafc
+    3794:	e8 90 69 00 00       	call   a129 <open>
+    3799:	83 c4 10             	add    $0x10,%esp
+    379c:	85 c0                	test   %eax,%eax
+    379e:	0f 89 47 03 00 00    	jns    3aeb <subdir+0x5b2>
+  if(open("dd", O_CREATE) >= 0){
+    37a4:	83 ec 08             	sub    $0x8,%esp
+    37a7:	68 00 02 00 00       	push   $0x200
+    37ac:	68 8e ba 00 00       	push   $0xba8e
+    37b1:	e8 73 69 00 00       	call   a129 <open>
+    37b6:	83 c4 10             	add    $0x10,%esp
+    37b9:	85 c0                	test   %eax,%eax
+    37bb:	0f 89 3e 03 00 00    	jns    3aff <subdir+0x5c6>
+  if(open("dd", O_RDWR) >= 0){
+    37c1:	83 ec 08             	sub    $0x8,%esp
+    37c4:	6a 02                	push   $0x2
+    37c6:	68 8e ba 00 00       	push   $0xba8e
+    37cb:	e8 59 69 00 00       	call   a129 <open>
+    37d0:	83 c4 10             	add    $0x10,%esp
+    37d3:	85 c0                	test   %eax,%eax
+    37d5:	0f 89 38 03 00 00    	jns    3b13 <subdir+0x5da>
+  if(open("dd", O_WRONLY) >= 0){
+    37db:	83 ec 08             	sub    $0x8,%esp
+    37de:	6a 01                	push   $0x1
+    37e0:	68 8e ba 00 00       	push   $0xba8e
+    37e5:	e8 3f 69 00 00       	call   a129 <open>
+    37ea:	83 c4 10             	add    $0x10,%esp
+    37ed:	85 c0                	test   %eax,%eax
+    37ef:	0f 89 32 03 00 00    	jns    3b27 <subdir+0x5ee>
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    37f5:	83 ec 08             	sub    $0x8,%esp
+    37f8:	68 6b bb 00 00       	push   $0xbb6b
+    37fd:	68 d7 ba 00 00       	push   $0xbad7
+    3802:	e8 5e 69 00 00       	call   a165 <link>
+    3807:	83 c4 10             	add    $0x10,%esp
+    380a:	85 c0                	test   %eax,%eax
+    380c:	0f 84 29 03 00 00    	je     3b3b <subdir+0x602>
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    3812:	83 ec 08             	sub    $0x8,%esp
+    3815:	68 6b bb 00 00       	push   $0xbb6b
+    381a:	68 fc ba 00 00       	push   $0xbafc
+    381f:	e8 41 69 00 00       	call   a165 <link>
+    3824:	83 c4 10             	add    $0x10,%esp
+    3827:	85 c0                	test   %eax,%eax
+    3829:	0f 84 20 03 00 00    	je     3b4f <subdir+0x616>
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    382f:	83 ec 08             	sub    $0x8,%esp
+    3832:	68 28 ba 00 00       	push   $0xba28
+    3837:	68 c7 b9 00 00       	push   $0xb9c7
+    383c:	e8 24 69 00 00       	call   a165 <link>
+    3841:	83 c4 10             	add    $0x10,%esp
+    3844:	85 c0                	test   %eax,%eax
+    3846:	0f 84 17 03 00 00    	je     3b63 <subdir+0x62a>
+  if(mkdir("dd/ff/ff") == 0){
+    384c:	83 ec 0c             	sub    $0xc,%esp
+    384f:	68 d7 ba 00 00       	push   $0xbad7
+    3854:	e8 1b 69 00 00       	call   a174 <mkdir>
+    3859:	83 c4 10             	add    $0x10,%esp
+    385c:	85 c0                	test   %eax,%eax
+    385e:	0f 84 13 03 00 00    	je     3b77 <subdir+0x63e>
+  if(mkdir("dd/xx/ff") == 0){
+    3864:	83 ec 0c             	sub    $0xc,%esp
+    3867:	68 fc ba 00 00       	push   $0xbafc
+    386c:	e8 03 69 00 00       	call   a174 <mkdir>
+    3871:	83 c4 10             	add    $0x10,%esp
+    3874:	85 c0                	test   %eax,%eax
+    3876:	0f 84 0f 03 00 00    	je     3b8b <subdir+0x652>
+  if(mkdir("dd/dd/ffff") == 0){
+    387c:	83 ec 0c             	sub    $0xc,%esp
+    387f:	68 28 ba 00 00       	push   $0xba28
+    3884:	e8 eb 68 00 00       	call   a174 <mkdir>
+    3889:	83 c4 10             	add    $0x10,%esp
+    388c:	85 c0                	test   %eax,%eax
+    388e:	0f 84 0b 03 00 00    	je     3b9f <subdir+0x666>
+  if(unlink("dd/xx/ff") == 0){
+    3894:	83 ec 0c             	sub    $0xc,%esp
+    3897:	68 fc ba 00 00       	push   $0xbafc
+    389c:	e8 a6 68 00 00       	call   a147 <unlink>
+    38a1:	83 c4 10             	add    $0x10,%esp
+    38a4:	85 c0                	test   %eax,%eax
+    38a6:	0f 84 07 03 00 00    	je     3bb3 <subdir+0x67a>
+  if(unlink("dd/ff/ff") == 0){
+    38ac:	83 ec 0c             	sub    $0xc,%esp
+    38af:	68 d7 ba 00 00       	push   $0xbad7
+    38b4:	e8 8e 68 00 00       	call   a147 <unlink>
+    38b9:	83 c4 10             	add    $0x10,%esp
+    38bc:	85 c0                	test   %eax,%eax
+    38be:	0f 84 03 03 00 00    	je     3bc7 <subdir+0x68e>
+  if(chdir("dd/ff") == 0){
+    38c4:	83 ec 0c             	sub    $0xc,%esp
+    38c7:	68 c7 b9 00 00       	push   $0xb9c7
+    38cc:	e8 b2 68 00 00       	call   a183 <chdir>
+    38d1:	83 c4 10             	add    $0x10,%esp
+    38d4:	85 c0                	test   %eax,%eax
+    38d6:	0f 84 ff 02 00 00    	je     3bdb <subdir+0x6a2>
+  if(chdir("dd/xx") == 0){
+    38dc:	83 ec 0c             	sub    $0xc,%esp
+    38df:	68 6e bb 00 00       	push   $0xbb6e
+    38e4:	e8 9a 68 00 00       	call   a183 <chdir>
+    38e9:	83 c4 10             	add    $0x10,%esp
+    38ec:	85 c0                	test   %eax,%eax
+    38ee:	0f 84 fb 02 00 00    	je     3bef <subdir+0x6b6>
+  if(unlink("dd/dd/ffff") != 0){
+    38f4:	83 ec 0c             	sub    $0xc,%esp
+    38f7:	68 28 ba 00 00       	push   $0xba28
+    38fc:	e8 46 68 00 00       	call   a147 <unlink>
+    3901:	83 c4 10             	add    $0x10,%esp
+    3904:	85 c0                	test   %eax,%eax
+    3906:	0f 85 f7 02 00 00    	jne    3c03 <subdir+0x6ca>
+  if(unlink("dd/ff") != 0){
+    390c:	83 ec 0c             	sub    $0xc,%esp
+    390f:	68 c7 b9 00 00       	push   $0xb9c7
+    3914:	e8 2e 68 00 00       	call   a147 <unlink>
+    3919:	83 c4 10             	add    $0x10,%esp
+    391c:	85 c0                	test   %eax,%eax
+    391e:	0f 85 f3 02 00 00    	jne    3c17 <subdir+0x6de>
+  if(unlink("dd") == 0){
+    3924:	83 ec 0c             	sub    $0xc,%esp
+    3927:	68 8e ba 00 00       	push   $0xba8e
+    392c:	e8 16 68 00 00       	call   a147 <unlink>
+    3931:	83 c4 10             	add    $0x10,%esp
+    3934:	85 c0                	test   %eax,%eax
+    3936:	0f 84 ef 02 00 00    	je     3c2b <subdir+0x6f2>
+  if(unlink("dd/dd") < 0){
+    393c:	83 ec 0c             	sub    $0xc,%esp
+    393f:	68 a3 b9 00 00       	push   $0xb9a3
+    3944:	e8 fe 67 00 00       	call   a147 <unlink>
+    3949:	83 c4 10             	add    $0x10,%esp
+    394c:	85 c0                	test   %eax,%eax
+    394e:	0f 88 eb 02 00 00    	js     3c3f <subdir+0x706>
+  if(unlink("dd") < 0){
+    3954:	83 ec 0c             	sub    $0xc,%esp
+    3957:	68 8e ba 00 00       	push   $0xba8e
+    395c:	e8 e6 67 00 00       	call   a147 <unlink>
+    3961:	83 c4 10             	add    $0x10,%esp
+    3964:	85 c0                	test   %eax,%eax
+    3966:	0f 88 e7 02 00 00    	js     3c53 <subdir+0x71a>
+  printf(1, "subdir ok\n");
+    396c:	83 ec 08             	sub    $0x8,%esp
+    396f:	68 6b bc 00 00       	push   $0xbc6b
+    3974:	6a 01                	push   $0x1
+    3976:	e8 96 6b 00 00       	call   a511 <printf>
+}
+    397b:	83 c4 10             	add    $0x10,%esp
+    397e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3981:	c9                   	leave
+    3982:	c3                   	ret
+    printf(1, "subdir mkdir dd failed\n");
+    3983:	83 ec 08             	sub    $0x8,%esp
+    3986:	68 75 b9 00 00       	push   $0xb975
+    398b:	6a 01                	push   $0x1
+    398d:	e8 7f 6b 00 00       	call   a511 <printf>
+    exit();
+    3992:	e8 41 66 00 00       	call   9fd8 <exit>
+    printf(1, "create dd/ff failed\n");
+    3997:	83 ec 08             	sub    $0x8,%esp
+    399a:	68 8d b9 00 00       	push   $0xb98d
+    399f:	6a 01                	push   $0x1
+    39a1:	e8 6b 6b 00 00       	call   a511 <printf>
+    exit();
+    39a6:	e8 2d 66 00 00       	call   9fd8 <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    39ab:	83 ec 08             	sub    $0x8,%esp
+    39ae:	68 38 da 00 00       	push   $0xda38
+    39b3:	6a 01                	push   $0x1
+    39b5:	e8 57 6b 00 00       	call   a511 <printf>
+    exit();
+    39ba:	e8 19 66 00 00       	call   9fd8 <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    39bf:	83 ec 08             	sub    $0x8,%esp
+    39c2:	68 a9 b9 00 00       	push   $0xb9a9
+    39c7:	6a 01                	push   $0x1
+    39c9:	e8 43 6b 00 00       	call   a511 <printf>
+    exit();
+    39ce:	e8 05 66 00 00       	call   9fd8 <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    39d3:	83 ec 08             	sub    $0x8,%esp
+    39d6:	68 cd b9 00 00       	push   $0xb9cd
+    39db:	6a 01                	push   $0x1
+    39dd:	e8 2f 6b 00 00       	call   a511 <printf>
+    exit();
+    39e2:	e8 f1 65 00 00       	call   9fd8 <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    39e7:	83 ec 08             	sub    $0x8,%esp
+    39ea:	68 f4 b9 00 00       	push   $0xb9f4
+    39ef:	6a 01                	push   $0x1
+    39f1:	e8 1b 6b 00 00       	call   a511 <printf>
+    exit();
+    39f6:	e8 dd 65 00 00       	call   9fd8 <exit>
+    printf(1, "dd/dd/../ff wrong content\n");
+    39fb:	83 ec 08             	sub    $0x8,%esp
+    39fe:	68 0d ba 00 00       	push   $0xba0d
+    3a03:	6a 01                	push   $0x1
+    3a05:	e8 07 6b 00 00       	call   a511 <printf>
+    exit();
+    3a0a:	e8 c9 65 00 00       	call   9fd8 <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    3a0f:	83 ec 08             	sub    $0x8,%esp
+    3a12:	68 60 da 00 00       	push   $0xda60
+    3a17:	6a 01                	push   $0x1
+    3a19:	e8 f3 6a 00 00       	call   a511 <printf>
+    exit();
+    3a1e:	e8 b5 65 00 00       	call   9fd8 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    3a23:	83 ec 08             	sub    $0x8,%esp
+    3a26:	68 33 ba 00 00       	push   $0xba33
+    3a2b:	6a 01                	push   $0x1
+    3a2d:	e8 df 6a 00 00       	call   a511 <printf>
+    exit();
+    3a32:	e8 a1 65 00 00       	call   9fd8 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    3a37:	83 ec 08             	sub    $0x8,%esp
+    3a3a:	68 84 da 00 00       	push   $0xda84
+    3a3f:	6a 01                	push   $0x1
+    3a41:	e8 cb 6a 00 00       	call   a511 <printf>
+    exit();
+    3a46:	e8 8d 65 00 00       	call   9fd8 <exit>
+    printf(1, "chdir dd failed\n");
+    3a4b:	83 ec 08             	sub    $0x8,%esp
+    3a4e:	68 4b ba 00 00       	push   $0xba4b
+    3a53:	6a 01                	push   $0x1
+    3a55:	e8 b7 6a 00 00       	call   a511 <printf>
+    exit();
+    3a5a:	e8 79 65 00 00       	call   9fd8 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    3a5f:	83 ec 08             	sub    $0x8,%esp
+    3a62:	68 68 ba 00 00       	push   $0xba68
+    3a67:	6a 01                	push   $0x1
+    3a69:	e8 a3 6a 00 00       	call   a511 <printf>
+    exit();
+    3a6e:	e8 65 65 00 00       	call   9fd8 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    3a73:	83 ec 08             	sub    $0x8,%esp
+    3a76:	68 68 ba 00 00       	push   $0xba68
+    3a7b:	6a 01                	push   $0x1
+    3a7d:	e8 8f 6a 00 00       	call   a511 <printf>
+    exit();
+    3a82:	e8 51 65 00 00       	call   9fd8 <exit>
+    printf(1, "chdir ./.. failed\n");
+    3a87:	83 ec 08             	sub    $0x8,%esp
+    3a8a:	68 91 ba 00 00       	push   $0xba91
+    3a8f:	6a 01                	push   $0x1
+    3a91:	e8 7b 6a 00 00       	call   a511 <printf>
+    exit();
+    3a96:	e8 3d 65 00 00       	call   9fd8 <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    3a9b:	83 ec 08             	sub    $0x8,%esp
+    3a9e:	68 a4 ba 00 00       	push   $0xbaa4
+    3aa3:	6a 01                	push   $0x1
+    3aa5:	e8 67 6a 00 00       	call   a511 <printf>
+    exit();
+    3aaa:	e8 29 65 00 00       	call   9fd8 <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    3aaf:	83 ec 08             	sub    $0x8,%esp
+    3ab2:	68 bc ba 00 00       	push   $0xbabc
+    3ab7:	6a 01                	push   $0x1
+    3ab9:	e8 53 6a 00 00       	call   a511 <printf>
+    exit();
+    3abe:	e8 15 65 00 00       	call   9fd8 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    3ac3:	83 ec 08             	sub    $0x8,%esp
+    3ac6:	68 a8 da 00 00       	push   $0xdaa8
+    3acb:	6a 01                	push   $0x1
+    3acd:	e8 3f 6a 00 00       	call   a511 <printf>
+    exit();
+    3ad2:	e8 01 65 00 00       	call   9fd8 <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    3ad7:	83 ec 08             	sub    $0x8,%esp
+    3ada:	68 e0 ba 00 00       	push   $0xbae0
+    3adf:	6a 01                	push   $0x1
+    3ae1:	e8 2b 6a 00 00       	call   a511 <printf>
+    exit();
+    3ae6:	e8 ed 64 00 00       	call   9fd8 <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    3aeb:	83 ec 08             	sub    $0x8,%esp
+    3aee:	68 05 bb 00 00       	push   $0xbb05
+    3af3:	6a 01                	push   $0x1
+    3af5:	e8 17 6a 00 00       	call   a511 <printf>
+    exit();
+    3afa:	e8 d9 64 00 00       	call   9fd8 <exit>
+    printf(1, "create dd succeeded!\n");
+    3aff:	83 ec 08             	sub    $0x8,%esp
+    3b02:	68 21 bb 00 00       	push   $0xbb21
+    3b07:	6a 01                	push   $0x1
+    3b09:	e8 03 6a 00 00       	call   a511 <printf>
+    exit();
+    3b0e:	e8 c5 64 00 00       	call   9fd8 <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    3b13:	83 ec 08             	sub    $0x8,%esp
+    3b16:	68 37 bb 00 00       	push   $0xbb37
+    3b1b:	6a 01                	push   $0x1
+    3b1d:	e8 ef 69 00 00       	call   a511 <printf>
+    exit();
+    3b22:	e8 b1 64 00 00       	call   9fd8 <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    3b27:	83 ec 08             	sub    $0x8,%esp
+    3b2a:	68 50 bb 00 00       	push   $0xbb50
+    3b2f:	6a 01                	push   $0x1
+    3b31:	e8 db 69 00 00       	call   a511 <printf>
+    exit();
+    3b36:	e8 9d 64 00 00       	call   9fd8 <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    3b3b:	83 ec 08             	sub    $0x8,%esp
+    3b3e:	68 d0 da 00 00       	push   $0xdad0
+    3b43:	6a 01                	push   $0x1
+    3b45:	e8 c7 69 00 00       	call   a511 <printf>
+    exit();
+    3b4a:	e8 89 64 00 00       	call   9fd8 <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    3b4f:	83 ec 08             	sub    $0x8,%esp
+    3b52:	68 f4 da 00 00       	push   $0xdaf4
+    3b57:	6a 01                	push   $0x1
+    3b59:	e8 b3 69 00 00       	call   a511 <printf>
+    exit();
+    3b5e:	e8 75 64 00 00       	call   9fd8 <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    3b63:	83 ec 08             	sub    $0x8,%esp
+    3b66:	68 18 db 00 00       	push   $0xdb18
+    3b6b:	6a 01                	push   $0x1
+    3b6d:	e8 9f 69 00 00       	call   a511 <printf>
+    exit();
+    3b72:	e8 61 64 00 00       	call   9fd8 <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    3b77:	83 ec 08             	sub    $0x8,%esp
+    3b7a:	68 74 bb 00 00       	push   $0xbb74
+    3b7f:	6a 01                	push   $0x1
+    3b81:	e8 8b 69 00 00       	call   a511 <printf>
+    exit();
+    3b86:	e8 4d 64 00 00       	call   9fd8 <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    3b8b:	83 ec 08             	sub    $0x8,%esp
+    3b8e:	68 8f bb 00 00       	push   $0xbb8f
+    3b93:	6a 01                	push   $0x1
+    3b95:	e8 77 69 00 00       	call   a511 <printf>
+    exit();
+    3b9a:	e8 39 64 00 00       	call   9fd8 <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    3b9f:	83 ec 08             	sub    $0x8,%esp
+    3ba2:	68 aa bb 00 00       	push   $0xbbaa
+    3ba7:	6a 01                	push   $0x1
+    3ba9:	e8 63 69 00 00       	call   a511 <printf>
+    exit();
+    3bae:	e8 25 64 00 00       	call   9fd8 <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    3bb3:	83 ec 08             	sub    $0x8,%esp
+    3bb6:	68 c7 bb 00 00       	push   $0xbbc7
+    3bbb:	6a 01                	push   $0x1
+    3bbd:	e8 4f 69 00 00       	call   a511 <printf>
+    exit();
+    3bc2:	e8 11 64 00 00       	call   9fd8 <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    3bc7:	83 ec 08             	sub    $0x8,%esp
+    3bca:	68 e3 bb 00 00       	push   $0xbbe3
+    3bcf:	6a 01                	push   $0x1
+    3bd1:	e8 3b 69 00 00       	call   a511 <printf>
+    exit();
+    3bd6:	e8 fd 63 00 00       	call   9fd8 <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    3bdb:	83 ec 08             	sub    $0x8,%esp
+    3bde:	68 ff bb 00 00       	push   $0xbbff
+    3be3:	6a 01                	push   $0x1
+    3be5:	e8 27 69 00 00       	call   a511 <printf>
+    exit();
+    3bea:	e8 e9 63 00 00       	call   9fd8 <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    3bef:	83 ec 08             	sub    $0x8,%esp
+    3bf2:	68 17 bc 00 00       	push   $0xbc17
+    3bf7:	6a 01                	push   $0x1
+    3bf9:	e8 13 69 00 00       	call   a511 <printf>
+    exit();
+    3bfe:	e8 d5 63 00 00       	call   9fd8 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    3c03:	83 ec 08             	sub    $0x8,%esp
+    3c06:	68 33 ba 00 00       	push   $0xba33
+    3c0b:	6a 01                	push   $0x1
+    3c0d:	e8 ff 68 00 00       	call   a511 <printf>
+    exit();
+    3c12:	e8 c1 63 00 00       	call   9fd8 <exit>
+    printf(1, "unlink dd/ff failed\n");
+    3c17:	83 ec 08             	sub    $0x8,%esp
+    3c1a:	68 2f bc 00 00       	push   $0xbc2f
+    3c1f:	6a 01                	push   $0x1
+    3c21:	e8 eb 68 00 00       	call   a511 <printf>
+    exit();
+    3c26:	e8 ad 63 00 00       	call   9fd8 <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    3c2b:	83 ec 08             	sub    $0x8,%esp
+    3c2e:	68 3c db 00 00       	push   $0xdb3c
+    3c33:	6a 01                	push   $0x1
+    3c35:	e8 d7 68 00 00       	call   a511 <printf>
+    exit();
+    3c3a:	e8 99 63 00 00       	call   9fd8 <exit>
+    printf(1, "unlink dd/dd failed\n");
+    3c3f:	83 ec 08             	sub    $0x8,%esp
+    3c42:	68 44 bc 00 00       	push   $0xbc44
+    3c47:	6a 01                	push   $0x1
+    3c49:	e8 c3 68 00 00       	call   a511 <printf>
+    exit();
+    3c4e:	e8 85 63 00 00       	call   9fd8 <exit>
+    printf(1, "unlink dd failed\n");
+    3c53:	83 ec 08             	sub    $0x8,%esp
+    3c56:	68 59 bc 00 00       	push   $0xbc59
+    3c5b:	6a 01                	push   $0x1
+    3c5d:	e8 af 68 00 00       	call   a511 <printf>
+    exit();
+    3c62:	e8 71 63 00 00       	call   9fd8 <exit>
+
+00003c67 <dirfile>:
+{
+    3c67:	55                   	push   %ebp
+    3c68:	89 e5                	mov    %esp,%ebp
+    3c6a:	53                   	push   %ebx
+    3c6b:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dir vs file\n");
+    3c6e:	68 76 bc 00 00       	push   $0xbc76
+    3c73:	6a 01                	push   $0x1
+    3c75:	e8 97 68 00 00       	call   a511 <printf>
+  fd = open("dirfile", O_CREATE);
+    3c7a:	83 c4 08             	add    $0x8,%esp
+    3c7d:	68 00 02 00 00       	push   $0x200
+    3c82:	68 83 bc 00 00       	push   $0xbc83
+    3c87:	e8 9d 64 00 00       	call   a129 <open>
+  if(fd < 0){
+    3c8c:	83 c4 10             	add    $0x10,%esp
+    3c8f:	85 c0                	test   %eax,%eax
+    3c91:	0f 88 22 01 00 00    	js     3db9 <dirfile+0x152>
+  close(fd);
+    3c97:	83 ec 0c             	sub    $0xc,%esp
+    3c9a:	50                   	push   %eax
+    3c9b:	e8 67 63 00 00       	call   a007 <close>
+  if(chdir("dirfile") == 0){
+    3ca0:	c7 04 24 83 bc 00 00 	movl   $0xbc83,(%esp)
+    3ca7:	e8 d7 64 00 00       	call   a183 <chdir>
+    3cac:	83 c4 10             	add    $0x10,%esp
+    3caf:	85 c0                	test   %eax,%eax
+    3cb1:	0f 84 16 01 00 00    	je     3dcd <dirfile+0x166>
+  fd = open("dirfile/xx", 0);
+    3cb7:	83 ec 08             	sub    $0x8,%esp
+    3cba:	6a 00                	push   $0x0
+    3cbc:	68 bc bc 00 00       	push   $0xbcbc
+    3cc1:	e8 63 64 00 00       	call   a129 <open>
+  if(fd >= 0){
+    3cc6:	83 c4 10             	add    $0x10,%esp
+    3cc9:	85 c0                	test   %eax,%eax
+    3ccb:	0f 89 10 01 00 00    	jns    3de1 <dirfile+0x17a>
+  fd = open("dirfile/xx", O_CREATE);
+    3cd1:	83 ec 08             	sub    $0x8,%esp
+    3cd4:	68 00 02 00 00       	push   $0x200
+    3cd9:	68 bc bc 00 00       	push   $0xbcbc
+    3cde:	e8 46 64 00 00       	call   a129 <open>
+  if(fd >= 0){
+    3ce3:	83 c4 10             	add    $0x10,%esp
+    3ce6:	85 c0                	test   %eax,%eax
+    3ce8:	0f 89 07 01 00 00    	jns    3df5 <dirfile+0x18e>
+  if(mkdir("dirfile/xx") == 0){
+    3cee:	83 ec 0c             	sub    $0xc,%esp
+    3cf1:	68 bc bc 00 00       	push   $0xbcbc
+    3cf6:	e8 79 64 00 00       	call   a174 <mkdir>
+    3cfb:	83 c4 10             	add    $0x10,%esp
+    3cfe:	85 c0                	test   %eax,%eax
+    3d00:	0f 84 03 01 00 00    	je     3e09 <dirfile+0x1a2>
+  if(unlink("dirfile/xx") == 0){
+    3d06:	83 ec 0c             	sub    $0xc,%esp
+    3d09:	68 bc bc 00 00       	push   $0xbcbc
+    3d0e:	e8 34 64 00 00       	call   a147 <unlink>
+    3d13:	83 c4 10             	add    $0x10,%esp
+    3d16:	85 c0                	test   %eax,%eax
+    3d18:	0f 84 ff 00 00 00    	je     3e1d <dirfile+0x1b6>
+  if(link("README", "dirfile/xx") == 0){
+    3d1e:	83 ec 08             	sub    $0x8,%esp
+    3d21:	68 bc bc 00 00       	push   $0xbcbc
+    3d26:	68 e6 be 00 00       	push   $0xbee6
+    3d2b:	e8 35 64 00 00       	call   a165 <link>
+    3d30:	83 c4 10             	add    $0x10,%esp
+    3d33:	85 c0                	test   %eax,%eax
+    3d35:	0f 84 f6 00 00 00    	je     3e31 <dirfile+0x1ca>
+  if(unlink("dirfile") != 0){
+    3d3b:	83 ec 0c             	sub    $0xc,%esp
+    3d3e:	68 83 bc 00 00       	push   $0xbc83
+    3d43:	e8 ff 63 00 00       	call   a147 <unlink>
+    3d48:	83 c4 10             	add    $0x10,%esp
+    3d4b:	85 c0                	test   %eax,%eax
+    3d4d:	0f 85 f2 00 00 00    	jne    3e45 <dirfile+0x1de>
+  fd = open(".", O_RDWR);
+    3d53:	83 ec 08             	sub    $0x8,%esp
+    3d56:	6a 02                	push   $0x2
+    3d58:	68 a9 c0 00 00       	push   $0xc0a9
+    3d5d:	e8 c7 63 00 00       	call   a129 <open>
+  if(fd >= 0){
+    3d62:	83 c4 10             	add    $0x10,%esp
+    3d65:	85 c0                	test   %eax,%eax
+    3d67:	0f 89 ec 00 00 00    	jns    3e59 <dirfile+0x1f2>
+  fd = open(".", 0);
+    3d6d:	83 ec 08             	sub    $0x8,%esp
+    3d70:	6a 00                	push   $0x0
+    3d72:	68 a9 c0 00 00       	push   $0xc0a9
+    3d77:	e8 ad 63 00 00       	call   a129 <open>
+    3d7c:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    3d7e:	83 c4 0c             	add    $0xc,%esp
+    3d81:	6a 01                	push   $0x1
+    3d83:	68 72 bb 00 00       	push   $0xbb72
+    3d88:	50                   	push   %eax
+    3d89:	e8 7d 63 00 00       	call   a10b <write>
+    3d8e:	83 c4 10             	add    $0x10,%esp
+    3d91:	85 c0                	test   %eax,%eax
+    3d93:	0f 8f d4 00 00 00    	jg     3e6d <dirfile+0x206>
+  close(fd);
+    3d99:	83 ec 0c             	sub    $0xc,%esp
+    3d9c:	53                   	push   %ebx
+    3d9d:	e8 65 62 00 00       	call   a007 <close>
+  printf(1, "dir vs file OK\n");
+    3da2:	83 c4 08             	add    $0x8,%esp
+    3da5:	68 4c bd 00 00       	push   $0xbd4c
+    3daa:	6a 01                	push   $0x1
+    3dac:	e8 60 67 00 00       	call   a511 <printf>
+}
+    3db1:	83 c4 10             	add    $0x10,%esp
+    3db4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3db7:	c9                   	leave
+    3db8:	c3                   	ret
+    printf(1, "create dirfile failed\n");
+    3db9:	83 ec 08             	sub    $0x8,%esp
+    3dbc:	68 8b bc 00 00       	push   $0xbc8b
+    3dc1:	6a 01                	push   $0x1
+    3dc3:	e8 49 67 00 00       	call   a511 <printf>
+    exit();
+    3dc8:	e8 0b 62 00 00       	call   9fd8 <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    3dcd:	83 ec 08             	sub    $0x8,%esp
+    3dd0:	68 a2 bc 00 00       	push   $0xbca2
+    3dd5:	6a 01                	push   $0x1
+    3dd7:	e8 35 67 00 00       	call   a511 <printf>
+    exit();
+    3ddc:	e8 f7 61 00 00       	call   9fd8 <exit>
+    printf(1, "create dirfile/xx succeeded!\n");
+    3de1:	83 ec 08             	sub    $0x8,%esp
+    3de4:	68 c7 bc 00 00       	push   $0xbcc7
+    3de9:	6a 01                	push   $0x1
+    3deb:	e8 21 67 00 00       	call   a511 <printf>
+    exit();
+    3df0:	e8 e3 61 00 00       	call   9fd8 <exit>
+    printf(1, "create dirfile/xx succeeded!\n");
+    3df5:	83 ec 08             	sub    $0x8,%esp
+    3df8:	68 c7 bc 00 00       	push   $0xbcc7
+    3dfd:	6a 01                	push   $0x1
+    3dff:	e8 0d 67 00 00       	call   a511 <printf>
+    exit();
+    3e04:	e8 cf 61 00 00       	call   9fd8 <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    3e09:	83 ec 08             	sub    $0x8,%esp
+    3e0c:	68 e5 bc 00 00       	push   $0xbce5
+    3e11:	6a 01                	push   $0x1
+    3e13:	e8 f9 66 00 00       	call   a511 <printf>
+    exit();
+    3e18:	e8 bb 61 00 00       	call   9fd8 <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    3e1d:	83 ec 08             	sub    $0x8,%esp
+    3e20:	68 02 bd 00 00       	push   $0xbd02
+    3e25:	6a 01                	push   $0x1
+    3e27:	e8 e5 66 00 00       	call   a511 <printf>
+    exit();
+    3e2c:	e8 a7 61 00 00       	call   9fd8 <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    3e31:	83 ec 08             	sub    $0x8,%esp
+    3e34:	68 5c db 00 00       	push   $0xdb5c
+    3e39:	6a 01                	push   $0x1
+    3e3b:	e8 d1 66 00 00       	call   a511 <printf>
+    exit();
+    3e40:	e8 93 61 00 00       	call   9fd8 <exit>
+    printf(1, "unlink dirfile failed!\n");
+    3e45:	83 ec 08             	sub    $0x8,%esp
+    3e48:	68 20 bd 00 00       	push   $0xbd20
+    3e4d:	6a 01                	push   $0x1
+    3e4f:	e8 bd 66 00 00       	call   a511 <printf>
+    exit();
+    3e54:	e8 7f 61 00 00       	call   9fd8 <exit>
+    printf(1, "open . for writing succeeded!\n");
+    3e59:	83 ec 08             	sub    $0x8,%esp
+    3e5c:	68 7c db 00 00       	push   $0xdb7c
+    3e61:	6a 01                	push   $0x1
+    3e63:	e8 a9 66 00 00       	call   a511 <printf>
+    exit();
+    3e68:	e8 6b 61 00 00       	call   9fd8 <exit>
+    printf(1, "write . succeeded!\n");
+    3e6d:	83 ec 08             	sub    $0x8,%esp
+    3e70:	68 38 bd 00 00       	push   $0xbd38
+    3e75:	6a 01                	push   $0x1
+    3e77:	e8 95 66 00 00       	call   a511 <printf>
+    exit();
+    3e7c:	e8 57 61 00 00       	call   9fd8 <exit>
+
+00003e81 <iref>:
+{
+    3e81:	55                   	push   %ebp
+    3e82:	89 e5                	mov    %esp,%ebp
+    3e84:	53                   	push   %ebx
+    3e85:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "empty file name\n");
+    3e88:	68 5c bd 00 00       	push   $0xbd5c
+    3e8d:	6a 01                	push   $0x1
+    3e8f:	e8 7d 66 00 00       	call   a511 <printf>
+  for(i = 0; i < 50 + 1; i++){
+    3e94:	83 c4 10             	add    $0x10,%esp
+    3e97:	bb 00 00 00 00       	mov    $0x0,%ebx
+    3e9c:	eb 4c                	jmp    3eea <iref+0x69>
+      printf(1, "mkdir irefd failed\n");
+    3e9e:	83 ec 08             	sub    $0x8,%esp
+    3ea1:	68 73 bd 00 00       	push   $0xbd73
+    3ea6:	6a 01                	push   $0x1
+    3ea8:	e8 64 66 00 00       	call   a511 <printf>
+      exit();
+    3ead:	e8 26 61 00 00       	call   9fd8 <exit>
+      printf(1, "chdir irefd failed\n");
+    3eb2:	83 ec 08             	sub    $0x8,%esp
+    3eb5:	68 87 bd 00 00       	push   $0xbd87
+    3eba:	6a 01                	push   $0x1
+    3ebc:	e8 50 66 00 00       	call   a511 <printf>
+      exit();
+    3ec1:	e8 12 61 00 00       	call   9fd8 <exit>
+      close(fd);
+    3ec6:	83 ec 0c             	sub    $0xc,%esp
+    3ec9:	50                   	push   %eax
+    3eca:	e8 38 61 00 00       	call   a007 <close>
+    3ecf:	83 c4 10             	add    $0x10,%esp
+    3ed2:	e9 80 00 00 00       	jmp    3f57 <iref+0xd6>
+    unlink("xx");
+    3ed7:	83 ec 0c             	sub    $0xc,%esp
+    3eda:	68 71 bb 00 00       	push   $0xbb71
+    3edf:	e8 63 62 00 00       	call   a147 <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    3ee4:	83 c3 01             	add    $0x1,%ebx
+    3ee7:	83 c4 10             	add    $0x10,%esp
+    3eea:	83 fb 32             	cmp    $0x32,%ebx
+    3eed:	0f 8f 92 00 00 00    	jg     3f85 <iref+0x104>
+    if(mkdir("irefd") != 0){
+    3ef3:	83 ec 0c             	sub    $0xc,%esp
+    3ef6:	68 6d bd 00 00       	push   $0xbd6d
+    3efb:	e8 74 62 00 00       	call   a174 <mkdir>
+    3f00:	83 c4 10             	add    $0x10,%esp
+    3f03:	85 c0                	test   %eax,%eax
+    3f05:	75 97                	jne    3e9e <iref+0x1d>
+    if(chdir("irefd") != 0){
+    3f07:	83 ec 0c             	sub    $0xc,%esp
+    3f0a:	68 6d bd 00 00       	push   $0xbd6d
+    3f0f:	e8 6f 62 00 00       	call   a183 <chdir>
+    3f14:	83 c4 10             	add    $0x10,%esp
+    3f17:	85 c0                	test   %eax,%eax
+    3f19:	75 97                	jne    3eb2 <iref+0x31>
+    mkdir("");
+    3f1b:	83 ec 0c             	sub    $0xc,%esp
+    3f1e:	68 6b b5 00 00       	push   $0xb56b
+    3f23:	e8 4c 62 00 00       	call   a174 <mkdir>
+    link("README", "");
+    3f28:	83 c4 08             	add    $0x8,%esp
+    3f2b:	68 6b b5 00 00       	push   $0xb56b
+    3f30:	68 e6 be 00 00       	push   $0xbee6
+    3f35:	e8 2b 62 00 00       	call   a165 <link>
+    fd = open("", O_CREATE);
+    3f3a:	83 c4 08             	add    $0x8,%esp
+    3f3d:	68 00 02 00 00       	push   $0x200
+    3f42:	68 6b b5 00 00       	push   $0xb56b
+    3f47:	e8 dd 61 00 00       	call   a129 <open>
+    if(fd >= 0)
+    3f4c:	83 c4 10             	add    $0x10,%esp
+    3f4f:	85 c0                	test   %eax,%eax
+    3f51:	0f 89 6f ff ff ff    	jns    3ec6 <iref+0x45>
+    fd = open("xx", O_CREATE);
+    3f57:	83 ec 08             	sub    $0x8,%esp
+    3f5a:	68 00 02 00 00       	push   $0x200
+    3f5f:	68 71 bb 00 00       	push   $0xbb71
+    3f64:	e8 c0 61 00 00       	call   a129 <open>
+    if(fd >= 0)
+    3f69:	83 c4 10             	add    $0x10,%esp
+    3f6c:	85 c0                	test   %eax,%eax
+    3f6e:	0f 88 63 ff ff ff    	js     3ed7 <iref+0x56>
+      close(fd);
+    3f74:	83 ec 0c             	sub    $0xc,%esp
+    3f77:	50                   	push   %eax
+    3f78:	e8 8a 60 00 00       	call   a007 <close>
+    3f7d:	83 c4 10             	add    $0x10,%esp
+    3f80:	e9 52 ff ff ff       	jmp    3ed7 <iref+0x56>
+  chdir("/");
+    3f85:	83 ec 0c             	sub    $0xc,%esp
+    3f88:	68 93 ab 00 00       	push   $0xab93
+    3f8d:	e8 f1 61 00 00       	call   a183 <chdir>
+  printf(1, "empty file name OK\n");
+    3f92:	83 c4 08             	add    $0x8,%esp
+    3f95:	68 9b bd 00 00       	push   $0xbd9b
+    3f9a:	6a 01                	push   $0x1
+    3f9c:	e8 70 65 00 00       	call   a511 <printf>
+}
+    3fa1:	83 c4 10             	add    $0x10,%esp
+    3fa4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3fa7:	c9                   	leave
+    3fa8:	c3                   	ret
+
+00003fa9 <validatetest>:
+{
+    3fa9:	55                   	push   %ebp
+    3faa:	89 e5                	mov    %esp,%ebp
+    3fac:	56                   	push   %esi
+    3fad:	53                   	push   %ebx
+  printf(stdout, "validate test\n");
+    3fae:	83 ec 08             	sub    $0x8,%esp
+    3fb1:	68 af bd 00 00       	push   $0xbdaf
+    3fb6:	ff 35 a4 04 01 00    	push   0x104a4
+    3fbc:	e8 50 65 00 00       	call   a511 <printf>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3fc1:	83 c4 10             	add    $0x10,%esp
+    3fc4:	be 00 00 00 00       	mov    $0x0,%esi
+    3fc9:	81 fe 00 30 11 00    	cmp    $0x113000,%esi
+    3fcf:	77 69                	ja     403a <validatetest+0x91>
+    if((pid = fork()) == 0){
+    3fd1:	e8 ee 5f 00 00       	call   9fc4 <fork>
+    3fd6:	89 c3                	mov    %eax,%ebx
+    3fd8:	85 c0                	test   %eax,%eax
+    3fda:	74 41                	je     401d <validatetest+0x74>
+    sleep(0);
+    3fdc:	83 ec 0c             	sub    $0xc,%esp
+    3fdf:	6a 00                	push   $0x0
+    3fe1:	e8 d9 61 00 00       	call   a1bf <sleep>
+    sleep(0);
+    3fe6:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3fed:	e8 cd 61 00 00       	call   a1bf <sleep>
+    kill(pid);
+    3ff2:	89 1c 24             	mov    %ebx,(%esp)
+    3ff5:	e8 20 61 00 00       	call   a11a <kill>
+    wait();
+    3ffa:	e8 df 60 00 00       	call   a0de <wait>
+    if(link("nosuchfile", (char*)p) != -1){
+    3fff:	83 c4 08             	add    $0x8,%esp
+    4002:	56                   	push   %esi
+    4003:	68 be bd 00 00       	push   $0xbdbe
+    4008:	e8 58 61 00 00       	call   a165 <link>
+    400d:	83 c4 10             	add    $0x10,%esp
+    4010:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4013:	75 0d                	jne    4022 <validatetest+0x79>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    4015:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    401b:	eb ac                	jmp    3fc9 <validatetest+0x20>
+      exit();
+    401d:	e8 b6 5f 00 00       	call   9fd8 <exit>
+      printf(stdout, "link should not succeed\n");
+    4022:	83 ec 08             	sub    $0x8,%esp
+    4025:	68 c9 bd 00 00       	push   $0xbdc9
+    402a:	ff 35 a4 04 01 00    	push   0x104a4
+    4030:	e8 dc 64 00 00       	call   a511 <printf>
+      exit();
+    4035:	e8 9e 5f 00 00       	call   9fd8 <exit>
+  printf(stdout, "validate ok\n");
+    403a:	83 ec 08             	sub    $0x8,%esp
+    403d:	68 e2 bd 00 00       	push   $0xbde2
+    4042:	ff 35 a4 04 01 00    	push   0x104a4
+    4048:	e8 c4 64 00 00       	call   a511 <printf>
+}
+    404d:	83 c4 10             	add    $0x10,%esp
+    4050:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    4053:	5b                   	pop    %ebx
+    4054:	5e                   	pop    %esi
+    4055:	5d                   	pop    %ebp
+    4056:	c3                   	ret
+
+00004057 <dcachetest>:
+{
+    4057:	55                   	push   %ebp
+    4058:	89 e5                	mov    %esp,%ebp
+    405a:	57                   	push   %edi
+    405b:	56                   	push   %esi
+    405c:	53                   	push   %ebx
+    405d:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "dcache test\n");
+    4060:	68 ef bd 00 00       	push   $0xbdef
+    4065:	6a 01                	push   $0x1
+    4067:	e8 a5 64 00 00       	call   a511 <printf>
+  for(i = 0; i < 3; i++){
+    406c:	83 c4 10             	add    $0x10,%esp
+    406f:	be 00 00 00 00       	mov    $0x0,%esi
+    4074:	83 fe 02             	cmp    $0x2,%esi
+    4077:	0f 8f d5 01 00 00    	jg     4252 <dcachetest+0x1fb>
+    if(open("dcdir/f", 0) >= 0 || open("dcdir", 0) >= 0){
+    407d:	83 ec 08             	sub    $0x8,%esp
+    4080:	6a 00                	push   $0x0
+    4082:	68 fc bd 00 00       	push   $0xbdfc
+    4087:	e8 9d 60 00 00       	call   a129 <open>
+    408c:	83 c4 10             	add    $0x10,%esp
+    408f:	85 c0                	test   %eax,%eax
+    4091:	0f 89 2f 01 00 00    	jns    41c6 <dcachetest+0x16f>
+    4097:	83 ec 08             	sub    $0x8,%esp
+    409a:	6a 00                	push   $0x0
+    409c:	68 04 be 00 00       	push   $0xbe04
+    40a1:	e8 83 60 00 00       	call   a129 <open>
+    40a6:	83 c4 10             	add    $0x10,%esp
+    40a9:	85 c0                	test   %eax,%eax
+    40ab:	0f 89 15 01 00 00    	jns    41c6 <dcachetest+0x16f>
+    if(mkdir("dcdir") < 0){
+    40b1:	83 ec 0c             	sub    $0xc,%esp
+    40b4:	68 04 be 00 00       	push   $0xbe04
+    40b9:	e8 b6 60 00 00       	call   a174 <mkdir>
+    40be:	83 c4 10             	add    $0x10,%esp
+    40c1:	85 c0                	test   %eax,%eax
+    40c3:	0f 88 11 01 00 00    	js     41da <dcachetest+0x183>
+    if(open("dcdir/f", 0) >= 0){
+    40c9:	83 ec 08             	sub    $0x8,%esp
+    40cc:	6a 00                	push   $0x0
+    40ce:	68 fc bd 00 00       	push   $0xbdfc
+    40d3:	e8 51 60 00 00       	call   a129 <open>
+    40d8:	83 c4 10             	add    $0x10,%esp
+    40db:	85 c0                	test   %eax,%eax
+    40dd:	0f 89 0b 01 00 00    	jns    41ee <dcachetest+0x197>
+    if((fd = open("dcdir/f", O_CREATE|O_RDWR)) < 0){
+    40e3:	83 ec 08             	sub    $0x8,%esp
+    40e6:	68 02 02 00 00       	push   $0x202
+    40eb:	68 fc bd 00 00       	push   $0xbdfc
+    40f0:	e8 34 60 00 00       	call   a129 <open>
+    40f5:	89 c3                	mov    %eax,%ebx
+    40f7:	83 c4 10             	add    $0x10,%esp
+    40fa:	85 c0                	test   %eax,%eax
+    40fc:	0f 88 00 01 00 00    	js     4202 <dcachetest+0x1ab>
+    fstat(fd, &st);
+    4102:	83 ec 08             	sub    $0x8,%esp
+    4105:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+    4108:	50                   	push   %eax
+    4109:	53                   	push   %ebx
+    410a:	e8 47 60 00 00       	call   a156 <fstat>
+    ino = st.ino;
+    410f:	8b 7d dc             	mov    -0x24(%ebp),%edi
+    close(fd);
+    4112:	89 1c 24             	mov    %ebx,(%esp)
+    4115:	e8 ed 5e 00 00       	call   a007 <close>
+    if(link("dcdir/f", "dcdir/g") < 0 || stat("dcdir/g", &st) < 0 || st.ino != ino){
+    411a:	83 c4 08             	add    $0x8,%esp
+    411d:	68 52 be 00 00       	push   $0xbe52
+    4122:	68 fc bd 00 00       	push   $0xbdfc
+    4127:	e8 39 60 00 00       	call   a165 <link>
+    412c:	83 c4 10             	add    $0x10,%esp
+    412f:	85 c0                	test   %eax,%eax
+    4131:	0f 88 df 00 00 00    	js     4216 <dcachetest+0x1bf>
+    4137:	83 ec 08             	sub    $0x8,%esp
+    413a:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+    413d:	50                   	push   %eax
+    413e:	68 52 be 00 00       	push   $0xbe52
+    4143:	e8 de 5e 00 00       	call   a026 <stat>
+    4148:	83 c4 10             	add    $0x10,%esp
+    414b:	85 c0                	test   %eax,%eax
+    414d:	0f 88 c3 00 00 00    	js     4216 <dcachetest+0x1bf>
+    4153:	3b 7d dc             	cmp    -0x24(%ebp),%edi
+    4156:	0f 85 ba 00 00 00    	jne    4216 <dcachetest+0x1bf>
+    if(unlink("dcdir/f") < 0 || open("dcdir/f", 0) >= 0){
+    415c:	83 ec 0c             	sub    $0xc,%esp
+    415f:	68 fc bd 00 00       	push   $0xbdfc
+    4164:	e8 de 5f 00 00       	call   a147 <unlink>
+    4169:	83 c4 10             	add    $0x10,%esp
+    416c:	85 c0                	test   %eax,%eax
+    416e:	0f 88 b6 00 00 00    	js     422a <dcachetest+0x1d3>
+    4174:	83 ec 08             	sub    $0x8,%esp
+    4177:	6a 00                	push   $0x0
+    4179:	68 fc bd 00 00       	push   $0xbdfc
+    417e:	e8 a6 5f 00 00       	call   a129 <open>
+    4183:	83 c4 10             	add    $0x10,%esp
+    4186:	85 c0                	test   %eax,%eax
+    4188:	0f 89 9c 00 00 00    	jns    422a <dcachetest+0x1d3>
+    if(unlink("dcdir/g") < 0 || unlink("dcdir") < 0){
+    418e:	83 ec 0c             	sub    $0xc,%esp
+    4191:	68 52 be 00 00       	push   $0xbe52
+    4196:	e8 ac 5f 00 00       	call   a147 <unlink>
+    419b:	83 c4 10             	add    $0x10,%esp
+    419e:	85 c0                	test   %eax,%eax
+    41a0:	0f 88 98 00 00 00    	js     423e <dcachetest+0x1e7>
+    41a6:	83 ec 0c             	sub    $0xc,%esp
+    41a9:	68 04 be 00 00       	push   $0xbe04
+    41ae:	e8 94 5f 00 00       	call   a147 <unlink>
+    41b3:	83 c4 10             	add    $0x10,%esp
+    41b6:	85 c0                	test   %eax,%eax
+    41b8:	0f 88 80 00 00 00    	js     423e <dcachetest+0x1e7>
+  for(i = 0; i < 3; i++){
+    41be:	83 c6 01             	add    $0x1,%esi
+    41c1:	e9 ae fe ff ff       	jmp    4074 <dcachetest+0x1d>
+      printf(1, "dcache: dcdir still there\n");
+    41c6:	83 ec 08             	sub    $0x8,%esp
+    41c9:	68 0a be 00 00       	push   $0xbe0a
+    41ce:	6a 01                	push   $0x1
+    41d0:	e8 3c 63 00 00       	call   a511 <printf>
+      exit();
+    41d5:	e8 fe 5d 00 00       	call   9fd8 <exit>
+      printf(1, "dcache: mkdir failed\n");
+    41da:	83 ec 08             	sub    $0x8,%esp
+    41dd:	68 25 be 00 00       	push   $0xbe25
+    41e2:	6a 01                	push   $0x1
+    41e4:	e8 28 63 00 00       	call   a511 <printf>
+      exit();
+    41e9:	e8 ea 5d 00 00       	call   9fd8 <exit>
+      printf(1, "dcache: dcdir/f there in a new directory\n");
+    41ee:	83 ec 08             	sub    $0x8,%esp
+    41f1:	68 9c db 00 00       	push   $0xdb9c
+    41f6:	6a 01                	push   $0x1
+    41f8:	e8 14 63 00 00       	call   a511 <printf>
+      exit();
+    41fd:	e8 d6 5d 00 00       	call   9fd8 <exit>
+      printf(1, "dcache: create failed\n");
+    4202:	83 ec 08             	sub    $0x8,%esp
+    4205:	68 3b be 00 00       	push   $0xbe3b
+    420a:	6a 01                	push   $0x1
+    420c:	e8 00 63 00 00       	call   a511 <printf>
+      exit();
+    4211:	e8 c2 5d 00 00       	call   9fd8 <exit>
+      printf(1, "dcache: link not seen\n");
+    4216:	83 ec 08             	sub    $0x8,%esp
+    4219:	68 5a be 00 00       	push   $0xbe5a
+    421e:	6a 01                	push   $0x1
+    4220:	e8 ec 62 00 00       	call   a511 <printf>
+      exit();
+    4225:	e8 ae 5d 00 00       	call   9fd8 <exit>
+      printf(1, "dcache: unlinked file still there\n");
+    422a:	83 ec 08             	sub    $0x8,%esp
+    422d:	68 c8 db 00 00       	push   $0xdbc8
+    4232:	6a 01                	push   $0x1
+    4234:	e8 d8 62 00 00       	call   a511 <printf>
+      exit();
+    4239:	e8 9a 5d 00 00       	call   9fd8 <exit>
+      printf(1, "dcache: unlink failed\n");
+    423e:	83 ec 08             	sub    $0x8,%esp
+    4241:	68 71 be 00 00       	push   $0xbe71
+    4246:	6a 01                	push   $0x1
+    4248:	e8 c4 62 00 00       	call   a511 <printf>
+      exit();
+    424d:	e8 86 5d 00 00       	call   9fd8 <exit>
+  printf(1, "dcache test OK\n");
+    4252:	83 ec 08             	sub    $0x8,%esp
+    4255:	68 88 be 00 00       	push   $0xbe88
+    425a:	6a 01                	push   $0x1
+    425c:	e8 b0 62 00 00       	call   a511 <printf>
+}
+    4261:	83 c4 10             	add    $0x10,%esp
+    4264:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4267:	5b                   	pop    %ebx
+    4268:	5e                   	pop    %esi
+    4269:	5f                   	pop    %edi
+    426a:	5d                   	pop    %ebp
+    426b:	c3                   	ret
+
+0000426c <sharedreadtest>:
+{
+    426c:	55                   	push   %ebp
+    426d:	89 e5                	mov    %esp,%ebp
+    426f:	57                   	push   %edi
+    4270:	56                   	push   %esi
+    4271:	53                   	push   %ebx
+    4272:	81 ec 44 02 00 00    	sub    $0x244,%esp
+  printf(1, "shared read test\n");
+    4278:	68 98 be 00 00       	push   $0xbe98
+    427d:	6a 01                	push   $0x1
+    427f:	e8 8d 62 00 00       	call   a511 <printf>
+  if(stat("README", &st) < 0){
+    4284:	83 c4 08             	add    $0x8,%esp
+    4287:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+    428a:	50                   	push   %eax
+    428b:	68 e6 be 00 00       	push   $0xbee6
+    4290:	e8 91 5d 00 00       	call   a026 <stat>
+    4295:	83 c4 10             	add    $0x10,%esp
+    4298:	85 c0                	test   %eax,%eax
+    429a:	78 2c                	js     42c8 <sharedreadtest+0x5c>
+  for(i = 0; i < 5; i++){
+    429c:	c7 85 c4 fd ff ff 00 	movl   $0x0,-0x23c(%ebp)
+    42a3:	00 00 00 
+    42a6:	83 bd c4 fd ff ff 04 	cmpl   $0x4,-0x23c(%ebp)
+    42ad:	0f 8f 2f 01 00 00    	jg     43e2 <sharedreadtest+0x176>
+    if((pid = fork()) < 0){
+    42b3:	e8 0c 5d 00 00       	call   9fc4 <fork>
+    42b8:	85 c0                	test   %eax,%eax
+    42ba:	78 20                	js     42dc <sharedreadtest+0x70>
+    if(pid > 0)
+    42bc:	7f 32                	jg     42f0 <sharedreadtest+0x84>
+    for(j = 0; j < 20; j++){
+    42be:	bf 00 00 00 00       	mov    $0x0,%edi
+    42c3:	e9 ac 00 00 00       	jmp    4374 <sharedreadtest+0x108>
+    printf(1, "sharedread: stat README failed\n");
+    42c8:	83 ec 08             	sub    $0x8,%esp
+    42cb:	68 ec db 00 00       	push   $0xdbec
+    42d0:	6a 01                	push   $0x1
+    42d2:	e8 3a 62 00 00       	call   a511 <printf>
+    exit();
+    42d7:	e8 fc 5c 00 00       	call   9fd8 <exit>
+      printf(1, "sharedread: fork failed\n");
+    42dc:	83 ec 08             	sub    $0x8,%esp
+    42df:	68 aa be 00 00       	push   $0xbeaa
+    42e4:	6a 01                	push   $0x1
+    42e6:	e8 26 62 00 00       	call   a511 <printf>
+      exit();
+    42eb:	e8 e8 5c 00 00       	call   9fd8 <exit>
+  for(i = 0; i < 5; i++){
+    42f0:	83 85 c4 fd ff ff 01 	addl   $0x1,-0x23c(%ebp)
+    42f7:	eb ad                	jmp    42a6 <sharedreadtest+0x3a>
+          printf(1, "sharedread: create failed\n");
+    42f9:	83 ec 08             	sub    $0x8,%esp
+    42fc:	68 ca be 00 00       	push   $0xbeca
+    4301:	6a 01                	push   $0x1
+    4303:	e8 09 62 00 00       	call   a511 <printf>
+          exit();
+    4308:	e8 cb 5c 00 00       	call   9fd8 <exit>
+      if((fd = open("/README", 0)) < 0){
+    430d:	83 ec 08             	sub    $0x8,%esp
+    4310:	6a 00                	push   $0x0
+    4312:	68 e5 be 00 00       	push   $0xbee5
+    4317:	e8 0d 5e 00 00       	call   a129 <open>
+    431c:	89 c6                	mov    %eax,%esi
+    431e:	83 c4 10             	add    $0x10,%esp
+    4321:	85 c0                	test   %eax,%eax
+    4323:	78 07                	js     432c <sharedreadtest+0xc0>
+      for(tot = 0; (n = read(fd, buf, sizeof(buf))) > 0; tot += n)
+    4325:	bb 00 00 00 00       	mov    $0x0,%ebx
+    432a:	eb 16                	jmp    4342 <sharedreadtest+0xd6>
+        printf(1, "sharedread: open README failed\n");
+    432c:	83 ec 08             	sub    $0x8,%esp
+    432f:	68 0c dc 00 00       	push   $0xdc0c
+    4334:	6a 01                	push   $0x1
+    4336:	e8 d6 61 00 00       	call   a511 <printf>
+        exit();
+    433b:	e8 98 5c 00 00       	call   9fd8 <exit>
+      for(tot = 0; (n = read(fd, buf, sizeof(buf))) > 0; tot += n)
+    4340:	01 c3                	add    %eax,%ebx
+    4342:	83 ec 04             	sub    $0x4,%esp
+    4345:	68 00 02 00 00       	push   $0x200
+    434a:	8d 85 d4 fd ff ff    	lea    -0x22c(%ebp),%eax
+    4350:	50                   	push   %eax
+    4351:	56                   	push   %esi
+    4352:	e8 a5 5d 00 00       	call   a0fc <read>
+    4357:	83 c4 10             	add    $0x10,%esp
+    435a:	85 c0                	test   %eax,%eax
+    435c:	7f e2                	jg     4340 <sharedreadtest+0xd4>
+      close(fd);
+    435e:	83 ec 0c             	sub    $0xc,%esp
+    4361:	56                   	push   %esi
+    4362:	e8 a0 5c 00 00       	call   a007 <close>
+      if(tot != st.size){
+    4367:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    436a:	83 c4 10             	add    $0x10,%esp
+    436d:	39 d8                	cmp    %ebx,%eax
+    436f:	75 59                	jne    43ca <sharedreadtest+0x15e>
+    for(j = 0; j < 20; j++){
+    4371:	83 c7 01             	add    $0x1,%edi
+    4374:	83 ff 13             	cmp    $0x13,%edi
+    4377:	7f 64                	jg     43dd <sharedreadtest+0x171>
+      if(i == 0){
+    4379:	83 bd c4 fd ff ff 00 	cmpl   $0x0,-0x23c(%ebp)
+    4380:	75 8b                	jne    430d <sharedreadtest+0xa1>
+        if((fd = open("/srtmp", O_CREATE|O_RDWR)) < 0){
+    4382:	83 ec 08             	sub    $0x8,%esp
+    4385:	68 02 02 00 00       	push   $0x202
+    438a:	68 c3 be 00 00       	push   $0xbec3
+    438f:	e8 95 5d 00 00       	call   a129 <open>
+    4394:	89 c3                	mov    %eax,%ebx
+    4396:	83 c4 10             	add    $0x10,%esp
+    4399:	85 c0                	test   %eax,%eax
+    439b:	0f 88 58 ff ff ff    	js     42f9 <sharedreadtest+0x8d>
+        write(fd, "x", 1);
+    43a1:	83 ec 04             	sub    $0x4,%esp
+    43a4:	6a 01                	push   $0x1
+    43a6:	68 72 bb 00 00       	push   $0xbb72
+    43ab:	50                   	push   %eax
+    43ac:	e8 5a 5d 00 00       	call   a10b <write>
+        close(fd);
+    43b1:	89 1c 24             	mov    %ebx,(%esp)
+    43b4:	e8 4e 5c 00 00       	call   a007 <close>
+        unlink("/srtmp");
+    43b9:	c7 04 24 c3 be 00 00 	movl   $0xbec3,(%esp)
+    43c0:	e8 82 5d 00 00       	call   a147 <unlink>
+        continue;
+    43c5:	83 c4 10             	add    $0x10,%esp
+    43c8:	eb a7                	jmp    4371 <sharedreadtest+0x105>
+        printf(1, "sharedread: read %d of %d bytes\n", tot, st.size);
+    43ca:	50                   	push   %eax
+    43cb:	53                   	push   %ebx
+    43cc:	68 2c dc 00 00       	push   $0xdc2c
+    43d1:	6a 01                	push   $0x1
+    43d3:	e8 39 61 00 00       	call   a511 <printf>
+        exit();
+    43d8:	e8 fb 5b 00 00       	call   9fd8 <exit>
+    exit();
+    43dd:	e8 f6 5b 00 00       	call   9fd8 <exit>
+  for(i = 0; i < 5; i++)
+    43e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+    43e7:	eb 08                	jmp    43f1 <sharedreadtest+0x185>
+    wait();
+    43e9:	e8 f0 5c 00 00       	call   a0de <wait>
+  for(i = 0; i < 5; i++)
+    43ee:	83 c3 01             	add    $0x1,%ebx
+    43f1:	83 fb 04             	cmp    $0x4,%ebx
+    43f4:	7e f3                	jle    43e9 <sharedreadtest+0x17d>
+  printf(1, "shared read test OK\n");
+    43f6:	83 ec 08             	sub    $0x8,%esp
+    43f9:	68 ed be 00 00       	push   $0xbeed
+    43fe:	6a 01                	push   $0x1
+    4400:	e8 0c 61 00 00       	call   a511 <printf>
+}
+    4405:	83 c4 10             	add    $0x10,%esp
+    4408:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    440b:	5b                   	pop    %ebx
+    440c:	5e                   	pop    %esi
+    440d:	5f                   	pop    %edi
+    440e:	5d                   	pop    %ebp
+    440f:	c3                   	ret
+
+00004410 <sendfiletest>:
+{
+    4410:	55                   	push   %ebp
+    4411:	89 e5                	mov    %esp,%ebp
+    4413:	57                   	push   %edi
+    4414:	56                   	push   %esi
+    4415:	53                   	push   %ebx
+    4416:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "sendfile test\n");
+    4419:	68 02 bf 00 00       	push   $0xbf02
+    441e:	6a 01                	push   $0x1
+    4420:	e8 ec 60 00 00       	call   a511 <printf>
+  fd = open("sf0", O_CREATE|O_RDWR);
+    4425:	83 c4 08             	add    $0x8,%esp
+    4428:	68 02 02 00 00       	push   $0x202
+    442d:	68 11 bf 00 00       	push   $0xbf11
+    4432:	e8 f2 5c 00 00       	call   a129 <open>
+    4437:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+    4439:	83 c4 10             	add    $0x10,%esp
+    443c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    4441:	eb 2f                	jmp    4472 <sendfiletest+0x62>
+    memset(buf, 'a' + i, 1000);
+    4443:	83 ec 04             	sub    $0x4,%esp
+    4446:	68 e8 03 00 00       	push   $0x3e8
+    444b:	8d 43 61             	lea    0x61(%ebx),%eax
+    444e:	50                   	push   %eax
+    444f:	68 a0 2c 01 00       	push   $0x12ca0
+    4454:	e8 d8 55 00 00       	call   9a31 <memset>
+    write(fd, buf, 1000);
+    4459:	83 c4 0c             	add    $0xc,%esp
+    445c:	68 e8 03 00 00       	push   $0x3e8
+    4461:	68 a0 2c 01 00       	push   $0x12ca0
+    4466:	56                   	push   %esi
+    4467:	e8 9f 5c 00 00       	call   a10b <write>
+  for(i = 0; i < 20; i++){
+    446c:	83 c3 01             	add    $0x1,%ebx
+    446f:	83 c4 10             	add    $0x10,%esp
+    4472:	83 fb 13             	cmp    $0x13,%ebx
+    4475:	7e cc                	jle    4443 <sendfiletest+0x33>
+  close(fd);
+    4477:	83 ec 0c             	sub    $0xc,%esp
+    447a:	56                   	push   %esi
+    447b:	e8 87 5b 00 00       	call   a007 <close>
+  if(pipe(p) < 0){
+    4480:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    4483:	89 04 24             	mov    %eax,(%esp)
+    4486:	e8 62 5c 00 00       	call   a0ed <pipe>
+    448b:	83 c4 10             	add    $0x10,%esp
+    448e:	85 c0                	test   %eax,%eax
+    4490:	78 52                	js     44e4 <sendfiletest+0xd4>
+  if((pid = fork()) == 0){
+    4492:	e8 2d 5b 00 00       	call   9fc4 <fork>
+    4497:	85 c0                	test   %eax,%eax
+    4499:	75 62                	jne    44fd <sendfiletest+0xed>
+    close(p[0]);
+    449b:	83 ec 0c             	sub    $0xc,%esp
+    449e:	ff 75 e0             	push   -0x20(%ebp)
+    44a1:	e8 61 5b 00 00       	call   a007 <close>
+    fd = open("sf0", 0);
+    44a6:	83 c4 08             	add    $0x8,%esp
+    44a9:	6a 00                	push   $0x0
+    44ab:	68 11 bf 00 00       	push   $0xbf11
+    44b0:	e8 74 5c 00 00       	call   a129 <open>
+    if(sendfile(p[1], fd, 100000) != 20000){
+    44b5:	83 c4 0c             	add    $0xc,%esp
+    44b8:	68 a0 86 01 00       	push   $0x186a0
+    44bd:	50                   	push   %eax
+    44be:	ff 75 e4             	push   -0x1c(%ebp)
+    44c1:	e8 ac 5e 00 00       	call   a372 <sendfile>
+    44c6:	83 c4 10             	add    $0x10,%esp
+    44c9:	3d 20 4e 00 00       	cmp    $0x4e20,%eax
+    44ce:	74 28                	je     44f8 <sendfiletest+0xe8>
+      printf(1, "sendfile: file to pipe short\n");
+    44d0:	83 ec 08             	sub    $0x8,%esp
+    44d3:	68 2c bf 00 00       	push   $0xbf2c
+    44d8:	6a 01                	push   $0x1
+    44da:	e8 32 60 00 00       	call   a511 <printf>
+      exit();
+    44df:	e8 f4 5a 00 00       	call   9fd8 <exit>
+    printf(1, "sendfile: pipe failed\n");
+    44e4:	83 ec 08             	sub    $0x8,%esp
+    44e7:	68 15 bf 00 00       	push   $0xbf15
+    44ec:	6a 01                	push   $0x1
+    44ee:	e8 1e 60 00 00       	call   a511 <printf>
+    exit();
+    44f3:	e8 e0 5a 00 00       	call   9fd8 <exit>
+    exit();
+    44f8:	e8 db 5a 00 00       	call   9fd8 <exit>
+  close(p[1]);
+    44fd:	83 ec 0c             	sub    $0xc,%esp
+    4500:	ff 75 e4             	push   -0x1c(%ebp)
+    4503:	e8 ff 5a 00 00       	call   a007 <close>
+  out = open("sf1", O_CREATE|O_RDWR);
+    4508:	83 c4 08             	add    $0x8,%esp
+    450b:	68 02 02 00 00       	push   $0x202
+    4510:	68 4a bf 00 00       	push   $0xbf4a
+    4515:	e8 0f 5c 00 00       	call   a129 <open>
+    451a:	89 c3                	mov    %eax,%ebx
+  while((n = sendfile(out, p[0], 3000)) > 0)
+    451c:	83 c4 10             	add    $0x10,%esp
+    451f:	83 ec 04             	sub    $0x4,%esp
+    4522:	68 b8 0b 00 00       	push   $0xbb8
+    4527:	ff 75 e0             	push   -0x20(%ebp)
+    452a:	53                   	push   %ebx
+    452b:	e8 42 5e 00 00       	call   a372 <sendfile>
+    4530:	89 c6                	mov    %eax,%esi
+    4532:	83 c4 10             	add    $0x10,%esp
+    4535:	85 c0                	test   %eax,%eax
+    4537:	7f e6                	jg     451f <sendfiletest+0x10f>
+  close(p[0]);
+    4539:	83 ec 0c             	sub    $0xc,%esp
+    453c:	ff 75 e0             	push   -0x20(%ebp)
+    453f:	e8 c3 5a 00 00       	call   a007 <close>
+  wait();
+    4544:	e8 95 5b 00 00       	call   a0de <wait>
+  close(out);
+    4549:	89 1c 24             	mov    %ebx,(%esp)
+    454c:	e8 b6 5a 00 00       	call   a007 <close>
+  fd = open("sf1", 0);
+    4551:	83 c4 08             	add    $0x8,%esp
+    4554:	6a 00                	push   $0x0
+    4556:	68 4a bf 00 00       	push   $0xbf4a
+    455b:	e8 c9 5b 00 00       	call   a129 <open>
+    4560:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < 20; i++){
+    4562:	83 c4 10             	add    $0x10,%esp
+    4565:	bb 00 00 00 00       	mov    $0x0,%ebx
+    456a:	83 fb 13             	cmp    $0x13,%ebx
+    456d:	7f 50                	jg     45bf <sendfiletest+0x1af>
+    if(read(fd, buf, 1000) != 1000 || buf[0] != 'a' + i || buf[999] != 'a' + i){
+    456f:	83 ec 04             	sub    $0x4,%esp
+    4572:	68 e8 03 00 00       	push   $0x3e8
+    4577:	68 a0 2c 01 00       	push   $0x12ca0
+    457c:	57                   	push   %edi
+    457d:	e8 7a 5b 00 00       	call   a0fc <read>
+    4582:	83 c4 10             	add    $0x10,%esp
+    4585:	3d e8 03 00 00       	cmp    $0x3e8,%eax
+    458a:	75 1e                	jne    45aa <sendfiletest+0x19a>
+    458c:	0f be 15 a0 2c 01 00 	movsbl 0x12ca0,%edx
+    4593:	8d 43 61             	lea    0x61(%ebx),%eax
+    4596:	39 c2                	cmp    %eax,%edx
+    4598:	75 10                	jne    45aa <sendfiletest+0x19a>
+    459a:	0f be 15 87 30 01 00 	movsbl 0x13087,%edx
+    45a1:	39 d0                	cmp    %edx,%eax
+    45a3:	75 05                	jne    45aa <sendfiletest+0x19a>
+  for(i = 0; i < 20; i++){
+    45a5:	83 c3 01             	add    $0x1,%ebx
+    45a8:	eb c0                	jmp    456a <sendfiletest+0x15a>
+      printf(1, "sendfile: wrong data in block %d\n", i);
+    45aa:	83 ec 04             	sub    $0x4,%esp
+    45ad:	53                   	push   %ebx
+    45ae:	68 50 dc 00 00       	push   $0xdc50
+    45b3:	6a 01                	push   $0x1
+    45b5:	e8 57 5f 00 00       	call   a511 <printf>
+      exit();
+    45ba:	e8 19 5a 00 00       	call   9fd8 <exit>
+  if(read(fd, buf, 1) != 0 || n < 0){
+    45bf:	83 ec 04             	sub    $0x4,%esp
+    45c2:	6a 01                	push   $0x1
+    45c4:	68 a0 2c 01 00       	push   $0x12ca0
+    45c9:	57                   	push   %edi
+    45ca:	e8 2d 5b 00 00       	call   a0fc <read>
+    45cf:	83 c4 10             	add    $0x10,%esp
+    45d2:	85 c0                	test   %eax,%eax
+    45d4:	75 3f                	jne    4615 <sendfiletest+0x205>
+    45d6:	85 f6                	test   %esi,%esi
+    45d8:	78 3b                	js     4615 <sendfiletest+0x205>
+  close(fd);
+    45da:	83 ec 0c             	sub    $0xc,%esp
+    45dd:	57                   	push   %edi
+    45de:	e8 24 5a 00 00       	call   a007 <close>
+  unlink("sf0");
+    45e3:	c7 04 24 11 bf 00 00 	movl   $0xbf11,(%esp)
+    45ea:	e8 58 5b 00 00       	call   a147 <unlink>
+  unlink("sf1");
+    45ef:	c7 04 24 4a bf 00 00 	movl   $0xbf4a,(%esp)
+    45f6:	e8 4c 5b 00 00       	call   a147 <unlink>
+  printf(1, "sendfile test OK\n");
+    45fb:	83 c4 08             	add    $0x8,%esp
+    45fe:	68 4e bf 00 00       	push   $0xbf4e
+    4603:	6a 01                	push   $0x1
+    4605:	e8 07 5f 00 00       	call   a511 <printf>
+}
+    460a:	83 c4 10             	add    $0x10,%esp
+    460d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4610:	5b                   	pop    %ebx
+    4611:	5e                   	pop    %esi
+    4612:	5f                   	pop    %edi
+    4613:	5d                   	pop    %ebp
+    4614:	c3                   	ret
+    printf(1, "sendfile: copy too long or failed\n");
+    4615:	83 ec 08             	sub    $0x8,%esp
+    4618:	68 74 dc 00 00       	push   $0xdc74
+    461d:	6a 01                	push   $0x1
+    461f:	e8 ed 5e 00 00       	call   a511 <printf>
+    exit();
+    4624:	e8 af 59 00 00       	call   9fd8 <exit>
+
+00004629 <pipesizetest>:
+{
+    4629:	55                   	push   %ebp
+    462a:	89 e5                	mov    %esp,%ebp
+    462c:	57                   	push   %edi
+    462d:	56                   	push   %esi
+    462e:	53                   	push   %ebx
+    462f:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "pipe size test\n");
+    4632:	68 60 bf 00 00       	push   $0xbf60
+    4637:	6a 01                	push   $0x1
+    4639:	e8 d3 5e 00 00       	call   a511 <printf>
+  if(pipe(p) < 0){
+    463e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    4641:	89 04 24             	mov    %eax,(%esp)
+    4644:	e8 a4 5a 00 00       	call   a0ed <pipe>
+    4649:	83 c4 10             	add    $0x10,%esp
+    464c:	85 c0                	test   %eax,%eax
+    464e:	78 20                	js     4670 <pipesizetest+0x47>
+  if(fcntl(p[0], F_GETPIPE_SZ, 0) != 4096){
+    4650:	83 ec 04             	sub    $0x4,%esp
+    4653:	6a 00                	push   $0x0
+    4655:	6a 01                	push   $0x1
+    4657:	ff 75 e0             	push   -0x20(%ebp)
+    465a:	e8 22 5d 00 00       	call   a381 <fcntl>
+    465f:	83 c4 10             	add    $0x10,%esp
+    4662:	3d 00 10 00 00       	cmp    $0x1000,%eax
+    4667:	75 1b                	jne    4684 <pipesizetest+0x5b>
+  for(i = 0; i < 3000; i++)
+    4669:	b8 00 00 00 00       	mov    $0x0,%eax
+    466e:	eb 31                	jmp    46a1 <pipesizetest+0x78>
+    printf(1, "pipe size: pipe failed\n");
+    4670:	83 ec 08             	sub    $0x8,%esp
+    4673:	68 70 bf 00 00       	push   $0xbf70
+    4678:	6a 01                	push   $0x1
+    467a:	e8 92 5e 00 00       	call   a511 <printf>
+    exit();
+    467f:	e8 54 59 00 00       	call   9fd8 <exit>
+    printf(1, "pipe size: default is not a page\n");
+    4684:	83 ec 08             	sub    $0x8,%esp
+    4687:	68 98 dc 00 00       	push   $0xdc98
+    468c:	6a 01                	push   $0x1
+    468e:	e8 7e 5e 00 00       	call   a511 <printf>
+    exit();
+    4693:	e8 40 59 00 00       	call   9fd8 <exit>
+    buf[i] = i;
+    4698:	88 80 a0 2c 01 00    	mov    %al,0x12ca0(%eax)
+  for(i = 0; i < 3000; i++)
+    469e:	83 c0 01             	add    $0x1,%eax
+    46a1:	3d b7 0b 00 00       	cmp    $0xbb7,%eax
+    46a6:	7e f0                	jle    4698 <pipesizetest+0x6f>
+  write(p[1], buf, 3000);
+    46a8:	83 ec 04             	sub    $0x4,%esp
+    46ab:	68 b8 0b 00 00       	push   $0xbb8
+    46b0:	68 a0 2c 01 00       	push   $0x12ca0
+    46b5:	ff 75 e4             	push   -0x1c(%ebp)
+    46b8:	e8 4e 5a 00 00       	call   a10b <write>
+  if(fcntl(p[1], F_SETPIPE_SZ, 10000) != 16384 ||
+    46bd:	83 c4 0c             	add    $0xc,%esp
+    46c0:	68 10 27 00 00       	push   $0x2710
+    46c5:	6a 02                	push   $0x2
+    46c7:	ff 75 e4             	push   -0x1c(%ebp)
+    46ca:	e8 b2 5c 00 00       	call   a381 <fcntl>
+    46cf:	83 c4 10             	add    $0x10,%esp
+    46d2:	3d 00 40 00 00       	cmp    $0x4000,%eax
+    46d7:	0f 85 af 00 00 00    	jne    478c <pipesizetest+0x163>
+     fcntl(p[0], F_SETPIPE_SZ, 1000000) != -1){
+    46dd:	83 ec 04             	sub    $0x4,%esp
+    46e0:	68 40 42 0f 00       	push   $0xf4240
+    46e5:	6a 02                	push   $0x2
+    46e7:	ff 75 e0             	push   -0x20(%ebp)
+    46ea:	e8 92 5c 00 00       	call   a381 <fcntl>
+  if(fcntl(p[1], F_SETPIPE_SZ, 10000) != 16384 ||
+    46ef:	83 c4 10             	add    $0x10,%esp
+    46f2:	83 f8 ff             	cmp    $0xffffffff,%eax
+    46f5:	0f 85 91 00 00 00    	jne    478c <pipesizetest+0x163>
+  write(p[1], buf, 8000);
+    46fb:	83 ec 04             	sub    $0x4,%esp
+    46fe:	68 40 1f 00 00       	push   $0x1f40
+    4703:	68 a0 2c 01 00       	push   $0x12ca0
+    4708:	ff 75 e4             	push   -0x1c(%ebp)
+    470b:	e8 fb 59 00 00       	call   a10b <write>
+  if(fcntl(p[1], F_SETPIPE_SZ, 4096) != -1){
+    4710:	83 c4 0c             	add    $0xc,%esp
+    4713:	68 00 10 00 00       	push   $0x1000
+    4718:	6a 02                	push   $0x2
+    471a:	ff 75 e4             	push   -0x1c(%ebp)
+    471d:	e8 5f 5c 00 00       	call   a381 <fcntl>
+    4722:	83 c4 10             	add    $0x10,%esp
+    4725:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4728:	75 76                	jne    47a0 <pipesizetest+0x177>
+  if(read(p[0], buf, 8192) != 8192 || read(p[0], buf, 8192) != 2808){
+    472a:	83 ec 04             	sub    $0x4,%esp
+    472d:	68 00 20 00 00       	push   $0x2000
+    4732:	68 a0 2c 01 00       	push   $0x12ca0
+    4737:	ff 75 e0             	push   -0x20(%ebp)
+    473a:	e8 bd 59 00 00       	call   a0fc <read>
+    473f:	83 c4 10             	add    $0x10,%esp
+    4742:	3d 00 20 00 00       	cmp    $0x2000,%eax
+    4747:	75 6b                	jne    47b4 <pipesizetest+0x18b>
+    4749:	83 ec 04             	sub    $0x4,%esp
+    474c:	68 00 20 00 00       	push   $0x2000
+    4751:	68 a0 2c 01 00       	push   $0x12ca0
+    4756:	ff 75 e0             	push   -0x20(%ebp)
+    4759:	e8 9e 59 00 00       	call   a0fc <read>
+    475e:	83 c4 10             	add    $0x10,%esp
+    4761:	3d f8 0a 00 00       	cmp    $0xaf8,%eax
+    4766:	75 4c                	jne    47b4 <pipesizetest+0x18b>
+  for(i = 0; i < 2808; i++){
+    4768:	b8 00 00 00 00       	mov    $0x0,%eax
+    476d:	3d f7 0a 00 00       	cmp    $0xaf7,%eax
+    4772:	7f 69                	jg     47dd <pipesizetest+0x1b4>
+    if((buf[i] & 0xff) != ((8192 - 3000 + i) & 0xff)){
+    4774:	0f be 90 a0 2c 01 00 	movsbl 0x12ca0(%eax),%edx
+    477b:	8d 88 48 14 00 00    	lea    0x1448(%eax),%ecx
+    4781:	31 ca                	xor    %ecx,%edx
+    4783:	84 d2                	test   %dl,%dl
+    4785:	75 41                	jne    47c8 <pipesizetest+0x19f>
+  for(i = 0; i < 2808; i++){
+    4787:	83 c0 01             	add    $0x1,%eax
+    478a:	eb e1                	jmp    476d <pipesizetest+0x144>
+    printf(1, "pipe size: resize failed\n");
+    478c:	83 ec 08             	sub    $0x8,%esp
+    478f:	68 88 bf 00 00       	push   $0xbf88
+    4794:	6a 01                	push   $0x1
+    4796:	e8 76 5d 00 00       	call   a511 <printf>
+    exit();
+    479b:	e8 38 58 00 00       	call   9fd8 <exit>
+    printf(1, "pipe size: shrank below its contents\n");
+    47a0:	83 ec 08             	sub    $0x8,%esp
+    47a3:	68 bc dc 00 00       	push   $0xdcbc
+    47a8:	6a 01                	push   $0x1
+    47aa:	e8 62 5d 00 00       	call   a511 <printf>
+    exit();
+    47af:	e8 24 58 00 00       	call   9fd8 <exit>
+    printf(1, "pipe size: short read\n");
+    47b4:	83 ec 08             	sub    $0x8,%esp
+    47b7:	68 a2 bf 00 00       	push   $0xbfa2
+    47bc:	6a 01                	push   $0x1
+    47be:	e8 4e 5d 00 00       	call   a511 <printf>
+    exit();
+    47c3:	e8 10 58 00 00       	call   9fd8 <exit>
+      printf(1, "pipe size: wrong data at %d\n", i);
+    47c8:	83 ec 04             	sub    $0x4,%esp
+    47cb:	50                   	push   %eax
+    47cc:	68 b9 bf 00 00       	push   $0xbfb9
+    47d1:	6a 01                	push   $0x1
+    47d3:	e8 39 5d 00 00       	call   a511 <printf>
+      exit();
+    47d8:	e8 fb 57 00 00       	call   9fd8 <exit>
+  if((pid = fork()) == 0){
+    47dd:	e8 e2 57 00 00       	call   9fc4 <fork>
+    47e2:	89 c3                	mov    %eax,%ebx
+    47e4:	85 c0                	test   %eax,%eax
+    47e6:	74 1d                	je     4805 <pipesizetest+0x1dc>
+  close(p[1]);
+    47e8:	83 ec 0c             	sub    $0xc,%esp
+    47eb:	ff 75 e4             	push   -0x1c(%ebp)
+    47ee:	e8 14 58 00 00       	call   a007 <close>
+  while((n = read(p[0], buf, 5000)) > 0){
+    47f3:	83 c4 10             	add    $0x10,%esp
+  total = 0;
+    47f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  seq = 0;
+    47fb:	be 00 00 00 00       	mov    $0x0,%esi
+  while((n = read(p[0], buf, 5000)) > 0){
+    4800:	e9 83 00 00 00       	jmp    4888 <pipesizetest+0x25f>
+    close(p[0]);
+    4805:	83 ec 0c             	sub    $0xc,%esp
+    4808:	ff 75 e0             	push   -0x20(%ebp)
+    480b:	e8 f7 57 00 00       	call   a007 <close>
+    for(seq = 0; seq < 100000; seq += n){
+    4810:	83 c4 10             	add    $0x10,%esp
+    4813:	89 de                	mov    %ebx,%esi
+    4815:	eb 31                	jmp    4848 <pipesizetest+0x21f>
+        buf[i] = seq + i;
+    4817:	8d 14 06             	lea    (%esi,%eax,1),%edx
+    481a:	88 90 a0 2c 01 00    	mov    %dl,0x12ca0(%eax)
+      for(i = 0; i < n; i++)
+    4820:	83 c0 01             	add    $0x1,%eax
+    4823:	3d 58 1b 00 00       	cmp    $0x1b58,%eax
+    4828:	7e ed                	jle    4817 <pipesizetest+0x1ee>
+      write(p[1], buf, n);
+    482a:	83 ec 04             	sub    $0x4,%esp
+    482d:	68 59 1b 00 00       	push   $0x1b59
+    4832:	68 a0 2c 01 00       	push   $0x12ca0
+    4837:	ff 75 e4             	push   -0x1c(%ebp)
+    483a:	e8 cc 58 00 00       	call   a10b <write>
+    for(seq = 0; seq < 100000; seq += n){
+    483f:	81 c6 59 1b 00 00    	add    $0x1b59,%esi
+    4845:	83 c4 10             	add    $0x10,%esp
+    4848:	81 fe 9f 86 01 00    	cmp    $0x1869f,%esi
+    484e:	7f 04                	jg     4854 <pipesizetest+0x22b>
+      for(i = 0; i < n; i++)
+    4850:	89 d8                	mov    %ebx,%eax
+    4852:	eb cf                	jmp    4823 <pipesizetest+0x1fa>
+    exit();
+    4854:	e8 7f 57 00 00       	call   9fd8 <exit>
+    for(i = 0; i < n; i++){
+    4859:	83 c0 01             	add    $0x1,%eax
+      if((buf[i] & 0xff) != (seq++ & 0xff)){
+    485c:	89 ce                	mov    %ecx,%esi
+    for(i = 0; i < n; i++){
+    485e:	39 f8                	cmp    %edi,%eax
+    4860:	7d 24                	jge    4886 <pipesizetest+0x25d>
+      if((buf[i] & 0xff) != (seq++ & 0xff)){
+    4862:	0f be 90 a0 2c 01 00 	movsbl 0x12ca0(%eax),%edx
+    4869:	8d 4e 01             	lea    0x1(%esi),%ecx
+    486c:	31 f2                	xor    %esi,%edx
+    486e:	84 d2                	test   %dl,%dl
+    4870:	74 e7                	je     4859 <pipesizetest+0x230>
+        printf(1, "pipe size: wrong data from child\n");
+    4872:	83 ec 08             	sub    $0x8,%esp
+    4875:	68 e4 dc 00 00       	push   $0xdce4
+    487a:	6a 01                	push   $0x1
+    487c:	e8 90 5c 00 00       	call   a511 <printf>
+        exit();
+    4881:	e8 52 57 00 00       	call   9fd8 <exit>
+    total += n;
+    4886:	01 fb                	add    %edi,%ebx
+  while((n = read(p[0], buf, 5000)) > 0){
+    4888:	83 ec 04             	sub    $0x4,%esp
+    488b:	68 88 13 00 00       	push   $0x1388
+    4890:	68 a0 2c 01 00       	push   $0x12ca0
+    4895:	ff 75 e0             	push   -0x20(%ebp)
+    4898:	e8 5f 58 00 00       	call   a0fc <read>
+    489d:	89 c7                	mov    %eax,%edi
+    489f:	83 c4 10             	add    $0x10,%esp
+    48a2:	85 c0                	test   %eax,%eax
+    48a4:	7e 07                	jle    48ad <pipesizetest+0x284>
+    for(i = 0; i < n; i++){
+    48a6:	b8 00 00 00 00       	mov    $0x0,%eax
+    48ab:	eb b1                	jmp    485e <pipesizetest+0x235>
+  close(p[0]);
+    48ad:	83 ec 0c             	sub    $0xc,%esp
+    48b0:	ff 75 e0             	push   -0x20(%ebp)
+    48b3:	e8 4f 57 00 00       	call   a007 <close>
+  wait();
+    48b8:	e8 21 58 00 00       	call   a0de <wait>
+  if(total != 15*7001){
+    48bd:	83 c4 10             	add    $0x10,%esp
+    48c0:	81 fb 37 9a 01 00    	cmp    $0x19a37,%ebx
+    48c6:	75 1a                	jne    48e2 <pipesizetest+0x2b9>
+  printf(1, "pipe size test OK\n");
+    48c8:	83 ec 08             	sub    $0x8,%esp
+    48cb:	68 ef bf 00 00       	push   $0xbfef
+    48d0:	6a 01                	push   $0x1
+    48d2:	e8 3a 5c 00 00       	call   a511 <printf>
+}
+    48d7:	83 c4 10             	add    $0x10,%esp
+    48da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    48dd:	5b                   	pop    %ebx
+    48de:	5e                   	pop    %esi
+    48df:	5f                   	pop    %edi
+    48e0:	5d                   	pop    %ebp
+    48e1:	c3                   	ret
+    printf(1, "pipe size: got %d bytes\n", total);
+    48e2:	83 ec 04             	sub    $0x4,%esp
+    48e5:	53                   	push   %ebx
+    48e6:	68 d6 bf 00 00       	push   $0xbfd6
+    48eb:	6a 01                	push   $0x1
+    48ed:	e8 1f 5c 00 00       	call   a511 <printf>
+    exit();
+    48f2:	e8 e1 56 00 00       	call   9fd8 <exit>
+
+000048f7 <tmpfstest>:
+{
+    48f7:	55                   	push   %ebp
+    48f8:	89 e5                	mov    %esp,%ebp
+    48fa:	56                   	push   %esi
+    48fb:	53                   	push   %ebx
+    48fc:	83 ec 28             	sub    $0x28,%esp
+  printf(1, "tmpfs test\n");
+    48ff:	68 02 c0 00 00       	push   $0xc002
+    4904:	6a 01                	push   $0x1
+    4906:	e8 06 5c 00 00       	call   a511 <printf>
+  mkdir("/tmp");
+    490b:	c7 04 24 0e c0 00 00 	movl   $0xc00e,(%esp)
+    4912:	e8 5d 58 00 00       	call   a174 <mkdir>
+  mount("tmpfs", "/tmp");   // init has usually done this
+    4917:	83 c4 08             	add    $0x8,%esp
+    491a:	68 0e c0 00 00       	push   $0xc00e
+    491f:	68 13 c0 00 00       	push   $0xc013
+    4924:	e8 67 5a 00 00       	call   a390 <mount>
+  if(stat("/tmp", &st) < 0 || st.dev == ROOTDEV || st.ino != 1){
+    4929:	83 c4 08             	add    $0x8,%esp
+    492c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    492f:	50                   	push   %eax
+    4930:	68 0e c0 00 00       	push   $0xc00e
+    4935:	e8 ec 56 00 00       	call   a026 <stat>
+    493a:	83 c4 10             	add    $0x10,%esp
+    493d:	85 c0                	test   %eax,%eax
+    493f:	78 7d                	js     49be <tmpfstest+0xc7>
+    4941:	83 7d e8 01          	cmpl   $0x1,-0x18(%ebp)
+    4945:	74 77                	je     49be <tmpfstest+0xc7>
+    4947:	83 7d ec 01          	cmpl   $0x1,-0x14(%ebp)
+    494b:	75 71                	jne    49be <tmpfstest+0xc7>
+  if(mkdir("/tmp/td") < 0 || (fd = open("/tmp/td/f", O_CREATE|O_RDWR)) < 0){
+    494d:	83 ec 0c             	sub    $0xc,%esp
+    4950:	68 35 c0 00 00       	push   $0xc035
+    4955:	e8 1a 58 00 00       	call   a174 <mkdir>
+    495a:	83 c4 10             	add    $0x10,%esp
+    495d:	85 c0                	test   %eax,%eax
+    495f:	78 71                	js     49d2 <tmpfstest+0xdb>
+    4961:	83 ec 08             	sub    $0x8,%esp
+    4964:	68 02 02 00 00       	push   $0x202
+    4969:	68 3d c0 00 00       	push   $0xc03d
+    496e:	e8 b6 57 00 00       	call   a129 <open>
+    4973:	89 c6                	mov    %eax,%esi
+    4975:	83 c4 10             	add    $0x10,%esp
+    4978:	85 c0                	test   %eax,%eax
+    497a:	78 56                	js     49d2 <tmpfstest+0xdb>
+  for(i = 0; i < 5; i++){
+    497c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    4981:	83 fb 04             	cmp    $0x4,%ebx
+    4984:	7f 74                	jg     49fa <tmpfstest+0x103>
+    memset(buf, 'a' + i, 3000);
+    4986:	83 ec 04             	sub    $0x4,%esp
+    4989:	68 b8 0b 00 00       	push   $0xbb8
+    498e:	8d 43 61             	lea    0x61(%ebx),%eax
+    4991:	50                   	push   %eax
+    4992:	68 a0 2c 01 00       	push   $0x12ca0
+    4997:	e8 95 50 00 00       	call   9a31 <memset>
+    if(write(fd, buf, 3000) != 3000){
+    499c:	83 c4 0c             	add    $0xc,%esp
+    499f:	68 b8 0b 00 00       	push   $0xbb8
+    49a4:	68 a0 2c 01 00       	push   $0x12ca0
+    49a9:	56                   	push   %esi
+    49aa:	e8 5c 57 00 00       	call   a10b <write>
+    49af:	83 c4 10             	add    $0x10,%esp
+    49b2:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+    49b7:	75 2d                	jne    49e6 <tmpfstest+0xef>
+  for(i = 0; i < 5; i++){
+    49b9:	83 c3 01             	add    $0x1,%ebx
+    49bc:	eb c3                	jmp    4981 <tmpfstest+0x8a>
+    printf(1, "tmpfs: /tmp is not mounted\n");
+    49be:	83 ec 08             	sub    $0x8,%esp
+    49c1:	68 19 c0 00 00       	push   $0xc019
+    49c6:	6a 01                	push   $0x1
+    49c8:	e8 44 5b 00 00       	call   a511 <printf>
+    exit();
+    49cd:	e8 06 56 00 00       	call   9fd8 <exit>
+    printf(1, "tmpfs: create failed\n");
+    49d2:	83 ec 08             	sub    $0x8,%esp
+    49d5:	68 47 c0 00 00       	push   $0xc047
+    49da:	6a 01                	push   $0x1
+    49dc:	e8 30 5b 00 00       	call   a511 <printf>
+    exit();
+    49e1:	e8 f2 55 00 00       	call   9fd8 <exit>
+      printf(1, "tmpfs: write failed\n");
+    49e6:	83 ec 08             	sub    $0x8,%esp
+    49e9:	68 5d c0 00 00       	push   $0xc05d
+    49ee:	6a 01                	push   $0x1
+    49f0:	e8 1c 5b 00 00       	call   a511 <printf>
+      exit();
+    49f5:	e8 de 55 00 00       	call   9fd8 <exit>
+  close(fd);
+    49fa:	83 ec 0c             	sub    $0xc,%esp
+    49fd:	56                   	push   %esi
+    49fe:	e8 04 56 00 00       	call   a007 <close>
+  fd = open("/tmp/td/f", 0);
+    4a03:	83 c4 08             	add    $0x8,%esp
+    4a06:	6a 00                	push   $0x0
+    4a08:	68 3d c0 00 00       	push   $0xc03d
+    4a0d:	e8 17 57 00 00       	call   a129 <open>
+    4a12:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 5; i++){
+    4a14:	83 c4 10             	add    $0x10,%esp
+    4a17:	bb 00 00 00 00       	mov    $0x0,%ebx
+    4a1c:	83 fb 04             	cmp    $0x4,%ebx
+    4a1f:	7f 4f                	jg     4a70 <tmpfstest+0x179>
+    if(read(fd, buf, 3000) != 3000 || buf[0] != 'a' + i || buf[2999] != 'a' + i){
+    4a21:	83 ec 04             	sub    $0x4,%esp
+    4a24:	68 b8 0b 00 00       	push   $0xbb8
+    4a29:	68 a0 2c 01 00       	push   $0x12ca0
+    4a2e:	56                   	push   %esi
+    4a2f:	e8 c8 56 00 00       	call   a0fc <read>
+    4a34:	83 c4 10             	add    $0x10,%esp
+    4a37:	3d b8 0b 00 00       	cmp    $0xbb8,%eax
+    4a3c:	75 1e                	jne    4a5c <tmpfstest+0x165>
+    4a3e:	0f be 15 a0 2c 01 00 	movsbl 0x12ca0,%edx
+    4a45:	8d 43 61             	lea    0x61(%ebx),%eax
+    4a48:	39 c2                	cmp    %eax,%edx
+    4a4a:	75 10                	jne    4a5c <tmpfstest+0x165>
+    4a4c:	0f be 15 57 38 01 00 	movsbl 0x13857,%edx
+    4a53:	39 d0                	cmp    %edx,%eax
+    4a55:	75 05                	jne    4a5c <tmpfstest+0x165>
+  for(i = 0; i < 5; i++){
+    4a57:	83 c3 01             	add    $0x1,%ebx
+    4a5a:	eb c0                	jmp    4a1c <tmpfstest+0x125>
+      printf(1, "tmpfs: wrong data\n");
+    4a5c:	83 ec 08             	sub    $0x8,%esp
+    4a5f:	68 72 c0 00 00       	push   $0xc072
+    4a64:	6a 01                	push   $0x1
+    4a66:	e8 a6 5a 00 00       	call   a511 <printf>
+      exit();
+    4a6b:	e8 68 55 00 00       	call   9fd8 <exit>
+  if(read(fd, buf, 1) != 0){
+    4a70:	83 ec 04             	sub    $0x4,%esp
+    4a73:	6a 01                	push   $0x1
+    4a75:	68 a0 2c 01 00       	push   $0x12ca0
+    4a7a:	56                   	push   %esi
+    4a7b:	e8 7c 56 00 00       	call   a0fc <read>
+    4a80:	83 c4 10             	add    $0x10,%esp
+    4a83:	85 c0                	test   %eax,%eax
+    4a85:	0f 85 d7 00 00 00    	jne    4b62 <tmpfstest+0x26b>
+  close(fd);
+    4a8b:	83 ec 0c             	sub    $0xc,%esp
+    4a8e:	56                   	push   %esi
+    4a8f:	e8 73 55 00 00       	call   a007 <close>
+  if(link("/tmp/td/f", "tmpfslink") == 0){
+    4a94:	83 c4 08             	add    $0x8,%esp
+    4a97:	68 9b c0 00 00       	push   $0xc09b
+    4a9c:	68 3d c0 00 00       	push   $0xc03d
+    4aa1:	e8 bf 56 00 00       	call   a165 <link>
+    4aa6:	83 c4 10             	add    $0x10,%esp
+    4aa9:	85 c0                	test   %eax,%eax
+    4aab:	0f 84 c5 00 00 00    	je     4b76 <tmpfstest+0x27f>
+  if(chdir("/tmp/td") < 0 || chdir("../..") < 0 ||
+    4ab1:	83 ec 0c             	sub    $0xc,%esp
+    4ab4:	68 35 c0 00 00       	push   $0xc035
+    4ab9:	e8 c5 56 00 00       	call   a183 <chdir>
+    4abe:	83 c4 10             	add    $0x10,%esp
+    4ac1:	85 c0                	test   %eax,%eax
+    4ac3:	0f 88 c1 00 00 00    	js     4b8a <tmpfstest+0x293>
+    4ac9:	83 ec 0c             	sub    $0xc,%esp
+    4acc:	68 a5 c0 00 00       	push   $0xc0a5
+    4ad1:	e8 ad 56 00 00       	call   a183 <chdir>
+    4ad6:	83 c4 10             	add    $0x10,%esp
+    4ad9:	85 c0                	test   %eax,%eax
+    4adb:	0f 88 a9 00 00 00    	js     4b8a <tmpfstest+0x293>
+     stat(".", &st) < 0 || st.dev != ROOTDEV || st.ino != 1){
+    4ae1:	83 ec 08             	sub    $0x8,%esp
+    4ae4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    4ae7:	50                   	push   %eax
+    4ae8:	68 a9 c0 00 00       	push   $0xc0a9
+    4aed:	e8 34 55 00 00       	call   a026 <stat>
+  if(chdir("/tmp/td") < 0 || chdir("../..") < 0 ||
+    4af2:	83 c4 10             	add    $0x10,%esp
+    4af5:	85 c0                	test   %eax,%eax
+    4af7:	0f 88 8d 00 00 00    	js     4b8a <tmpfstest+0x293>
+     stat(".", &st) < 0 || st.dev != ROOTDEV || st.ino != 1){
+    4afd:	83 7d e8 01          	cmpl   $0x1,-0x18(%ebp)
+    4b01:	0f 85 83 00 00 00    	jne    4b8a <tmpfstest+0x293>
+    4b07:	83 7d ec 01          	cmpl   $0x1,-0x14(%ebp)
+    4b0b:	75 7d                	jne    4b8a <tmpfstest+0x293>
+  if(unlink("/tmp/td") == 0 || unlink("/tmp/td/f") < 0 || unlink("/tmp/td") < 0){
+    4b0d:	83 ec 0c             	sub    $0xc,%esp
+    4b10:	68 35 c0 00 00       	push   $0xc035
+    4b15:	e8 2d 56 00 00       	call   a147 <unlink>
+    4b1a:	83 c4 10             	add    $0x10,%esp
+    4b1d:	85 c0                	test   %eax,%eax
+    4b1f:	74 7d                	je     4b9e <tmpfstest+0x2a7>
+    4b21:	83 ec 0c             	sub    $0xc,%esp
+    4b24:	68 3d c0 00 00       	push   $0xc03d
+    4b29:	e8 19 56 00 00       	call   a147 <unlink>
+    4b2e:	83 c4 10             	add    $0x10,%esp
+    4b31:	85 c0                	test   %eax,%eax
+    4b33:	78 69                	js     4b9e <tmpfstest+0x2a7>
+    4b35:	83 ec 0c             	sub    $0xc,%esp
+    4b38:	68 35 c0 00 00       	push   $0xc035
+    4b3d:	e8 05 56 00 00       	call   a147 <unlink>
+    4b42:	83 c4 10             	add    $0x10,%esp
+    4b45:	85 c0                	test   %eax,%eax
+    4b47:	78 55                	js     4b9e <tmpfstest+0x2a7>
+  printf(1, "tmpfs test OK\n");
+    4b49:	83 ec 08             	sub    $0x8,%esp
+    4b4c:	68 c1 c0 00 00       	push   $0xc0c1
+    4b51:	6a 01                	push   $0x1
+    4b53:	e8 b9 59 00 00       	call   a511 <printf>
+}
+    4b58:	83 c4 10             	add    $0x10,%esp
+    4b5b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    4b5e:	5b                   	pop    %ebx
+    4b5f:	5e                   	pop    %esi
+    4b60:	5d                   	pop    %ebp
+    4b61:	c3                   	ret
+    printf(1, "tmpfs: file too long\n");
+    4b62:	83 ec 08             	sub    $0x8,%esp
+    4b65:	68 85 c0 00 00       	push   $0xc085
+    4b6a:	6a 01                	push   $0x1
+    4b6c:	e8 a0 59 00 00       	call   a511 <printf>
+    exit();
+    4b71:	e8 62 54 00 00       	call   9fd8 <exit>
+    printf(1, "tmpfs: linked across file systems\n");
+    4b76:	83 ec 08             	sub    $0x8,%esp
+    4b79:	68 08 dd 00 00       	push   $0xdd08
+    4b7e:	6a 01                	push   $0x1
+    4b80:	e8 8c 59 00 00       	call   a511 <printf>
+    exit();
+    4b85:	e8 4e 54 00 00       	call   9fd8 <exit>
+    printf(1, "tmpfs: .. does not lead back to /\n");
+    4b8a:	83 ec 08             	sub    $0x8,%esp
+    4b8d:	68 2c dd 00 00       	push   $0xdd2c
+    4b92:	6a 01                	push   $0x1
+    4b94:	e8 78 59 00 00       	call   a511 <printf>
+    exit();
+    4b99:	e8 3a 54 00 00       	call   9fd8 <exit>
+    printf(1, "tmpfs: unlink failed\n");
+    4b9e:	83 ec 08             	sub    $0x8,%esp
+    4ba1:	68 ab c0 00 00       	push   $0xc0ab
+    4ba6:	6a 01                	push   $0x1
+    4ba8:	e8 64 59 00 00       	call   a511 <printf>
+    exit();
+    4bad:	e8 26 54 00 00       	call   9fd8 <exit>
+
+00004bb2 <pcachetest>:
+{
+    4bb2:	55                   	push   %ebp
+    4bb3:	89 e5                	mov    %esp,%ebp
+    4bb5:	56                   	push   %esi
+    4bb6:	53                   	push   %ebx
+    4bb7:	83 ec 18             	sub    $0x18,%esp
+  printf(1, "page cache test\n");
+    4bba:	68 d0 c0 00 00       	push   $0xc0d0
+    4bbf:	6a 01                	push   $0x1
+    4bc1:	e8 4b 59 00 00       	call   a511 <printf>
+  fd = open("pc0", O_CREATE|O_RDWR);
+    4bc6:	83 c4 08             	add    $0x8,%esp
+    4bc9:	68 02 02 00 00       	push   $0x202
+    4bce:	68 e1 c0 00 00       	push   $0xc0e1
+    4bd3:	e8 51 55 00 00       	call   a129 <open>
+    4bd8:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 3; i++){
+    4bda:	83 c4 10             	add    $0x10,%esp
+    4bdd:	bb 00 00 00 00       	mov    $0x0,%ebx
+    4be2:	eb 2f                	jmp    4c13 <pcachetest+0x61>
+    memset(buf, 'a' + i, 4096);
+    4be4:	83 ec 04             	sub    $0x4,%esp
+    4be7:	68 00 10 00 00       	push   $0x1000
+    4bec:	8d 43 61             	lea    0x61(%ebx),%eax
+    4bef:	50                   	push   %eax
+    4bf0:	68 a0 2c 01 00       	push   $0x12ca0
+    4bf5:	e8 37 4e 00 00       	call   9a31 <memset>
+    write(fd, buf, 4096);
+    4bfa:	83 c4 0c             	add    $0xc,%esp
+    4bfd:	68 00 10 00 00       	push   $0x1000
+    4c02:	68 a0 2c 01 00       	push   $0x12ca0
+    4c07:	56                   	push   %esi
+    4c08:	e8 fe 54 00 00       	call   a10b <write>
+  for(i = 0; i < 3; i++){
+    4c0d:	83 c3 01             	add    $0x1,%ebx
+    4c10:	83 c4 10             	add    $0x10,%esp
+    4c13:	83 fb 02             	cmp    $0x2,%ebx
+    4c16:	7e cc                	jle    4be4 <pcachetest+0x32>
+  close(fd);
+    4c18:	83 ec 0c             	sub    $0xc,%esp
+    4c1b:	56                   	push   %esi
+    4c1c:	e8 e6 53 00 00       	call   a007 <close>
+  fd = open("pc0", O_RDWR);
+    4c21:	83 c4 08             	add    $0x8,%esp
+    4c24:	6a 02                	push   $0x2
+    4c26:	68 e1 c0 00 00       	push   $0xc0e1
+    4c2b:	e8 f9 54 00 00       	call   a129 <open>
+    4c30:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 3; i++){
+    4c32:	83 c4 10             	add    $0x10,%esp
+    4c35:	bb 00 00 00 00       	mov    $0x0,%ebx
+    4c3a:	83 fb 02             	cmp    $0x2,%ebx
+    4c3d:	7f 4f                	jg     4c8e <pcachetest+0xdc>
+    if(read(fd, buf, 4096) != 4096 || buf[0] != 'a' + i || buf[4095] != 'a' + i){
+    4c3f:	83 ec 04             	sub    $0x4,%esp
+    4c42:	68 00 10 00 00       	push   $0x1000
+    4c47:	68 a0 2c 01 00       	push   $0x12ca0
+    4c4c:	56                   	push   %esi
+    4c4d:	e8 aa 54 00 00       	call   a0fc <read>
+    4c52:	83 c4 10             	add    $0x10,%esp
+    4c55:	3d 00 10 00 00       	cmp    $0x1000,%eax
+    4c5a:	75 1e                	jne    4c7a <pcachetest+0xc8>
+    4c5c:	0f be 15 a0 2c 01 00 	movsbl 0x12ca0,%edx
+    4c63:	8d 43 61             	lea    0x61(%ebx),%eax
+    4c66:	39 c2                	cmp    %eax,%edx
+    4c68:	75 10                	jne    4c7a <pcachetest+0xc8>
+    4c6a:	0f be 15 9f 3c 01 00 	movsbl 0x13c9f,%edx
+    4c71:	39 d0                	cmp    %edx,%eax
+    4c73:	75 05                	jne    4c7a <pcachetest+0xc8>
+  for(i = 0; i < 3; i++){
+    4c75:	83 c3 01             	add    $0x1,%ebx
+    4c78:	eb c0                	jmp    4c3a <pcachetest+0x88>
+      printf(1, "page cache: wrong data\n");
+    4c7a:	83 ec 08             	sub    $0x8,%esp
+    4c7d:	68 e5 c0 00 00       	push   $0xc0e5
+    4c82:	6a 01                	push   $0x1
+    4c84:	e8 88 58 00 00       	call   a511 <printf>
+      exit();
+    4c89:	e8 4a 53 00 00       	call   9fd8 <exit>
+  if(pwrite(fd, "xyz", 3, 4095) != 3 || pread(fd, buf, 5, 4094) != 5 ||
+    4c8e:	68 ff 0f 00 00       	push   $0xfff
+    4c93:	6a 03                	push   $0x3
+    4c95:	68 fd c0 00 00       	push   $0xc0fd
+    4c9a:	56                   	push   %esi
+    4c9b:	e8 a5 56 00 00       	call   a345 <pwrite>
+    4ca0:	83 c4 10             	add    $0x10,%esp
+    4ca3:	83 f8 03             	cmp    $0x3,%eax
+    4ca6:	75 79                	jne    4d21 <pcachetest+0x16f>
+    4ca8:	68 fe 0f 00 00       	push   $0xffe
+    4cad:	6a 05                	push   $0x5
+    4caf:	68 a0 2c 01 00       	push   $0x12ca0
+    4cb4:	56                   	push   %esi
+    4cb5:	e8 7c 56 00 00       	call   a336 <pread>
+    4cba:	83 c4 10             	add    $0x10,%esp
+    4cbd:	83 f8 05             	cmp    $0x5,%eax
+    4cc0:	75 5f                	jne    4d21 <pcachetest+0x16f>
+    4cc2:	80 3d a0 2c 01 00 61 	cmpb   $0x61,0x12ca0
+    4cc9:	75 56                	jne    4d21 <pcachetest+0x16f>
+     buf[0] != 'a' || buf[1] != 'x' || buf[2] != 'y' || buf[3] != 'z' || buf[4] != 'b'){
+    4ccb:	80 3d a1 2c 01 00 78 	cmpb   $0x78,0x12ca1
+    4cd2:	75 4d                	jne    4d21 <pcachetest+0x16f>
+    4cd4:	80 3d a2 2c 01 00 79 	cmpb   $0x79,0x12ca2
+    4cdb:	75 44                	jne    4d21 <pcachetest+0x16f>
+    4cdd:	80 3d a3 2c 01 00 7a 	cmpb   $0x7a,0x12ca3
+    4ce4:	75 3b                	jne    4d21 <pcachetest+0x16f>
+    4ce6:	80 3d a4 2c 01 00 62 	cmpb   $0x62,0x12ca4
+    4ced:	75 32                	jne    4d21 <pcachetest+0x16f>
+  memset(buf, 'q', 100);
+    4cef:	83 ec 04             	sub    $0x4,%esp
+    4cf2:	6a 64                	push   $0x64
+    4cf4:	6a 71                	push   $0x71
+    4cf6:	68 a0 2c 01 00       	push   $0x12ca0
+    4cfb:	e8 31 4d 00 00       	call   9a31 <memset>
+  if(pwrite(fd, buf, 100, 3*4096) != 100){
+    4d00:	68 00 30 00 00       	push   $0x3000
+    4d05:	6a 64                	push   $0x64
+    4d07:	68 a0 2c 01 00       	push   $0x12ca0
+    4d0c:	56                   	push   %esi
+    4d0d:	e8 33 56 00 00       	call   a345 <pwrite>
+    4d12:	83 c4 20             	add    $0x20,%esp
+    4d15:	83 f8 64             	cmp    $0x64,%eax
+    4d18:	75 1b                	jne    4d35 <pcachetest+0x183>
+  for(k = 3*4096 - 1; k < 3*4096 + 100; k++){
+    4d1a:	bb ff 2f 00 00       	mov    $0x2fff,%ebx
+    4d1f:	eb 34                	jmp    4d55 <pcachetest+0x1a3>
+    printf(1, "page cache: write not seen\n");
+    4d21:	83 ec 08             	sub    $0x8,%esp
+    4d24:	68 01 c1 00 00       	push   $0xc101
+    4d29:	6a 01                	push   $0x1
+    4d2b:	e8 e1 57 00 00       	call   a511 <printf>
+    exit();
+    4d30:	e8 a3 52 00 00       	call   9fd8 <exit>
+    printf(1, "page cache: append failed\n");
+    4d35:	83 ec 08             	sub    $0x8,%esp
+    4d38:	68 1d c1 00 00       	push   $0xc11d
+    4d3d:	6a 01                	push   $0x1
+    4d3f:	e8 cd 57 00 00       	call   a511 <printf>
+    exit();
+    4d44:	e8 8f 52 00 00       	call   9fd8 <exit>
+    if(pread(fd, &c, 1, k) != 1 || c != (k < 3*4096 ? 'c' : 'q')){
+    4d49:	ba 63 00 00 00       	mov    $0x63,%edx
+    4d4e:	39 d0                	cmp    %edx,%eax
+    4d50:	75 33                	jne    4d85 <pcachetest+0x1d3>
+  for(k = 3*4096 - 1; k < 3*4096 + 100; k++){
+    4d52:	83 c3 01             	add    $0x1,%ebx
+    4d55:	81 fb 63 30 00 00    	cmp    $0x3063,%ebx
+    4d5b:	7f 3d                	jg     4d9a <pcachetest+0x1e8>
+    if(pread(fd, &c, 1, k) != 1 || c != (k < 3*4096 ? 'c' : 'q')){
+    4d5d:	53                   	push   %ebx
+    4d5e:	6a 01                	push   $0x1
+    4d60:	8d 45 f7             	lea    -0x9(%ebp),%eax
+    4d63:	50                   	push   %eax
+    4d64:	56                   	push   %esi
+    4d65:	e8 cc 55 00 00       	call   a336 <pread>
+    4d6a:	83 c4 10             	add    $0x10,%esp
+    4d6d:	83 f8 01             	cmp    $0x1,%eax
+    4d70:	75 13                	jne    4d85 <pcachetest+0x1d3>
+    4d72:	0f be 45 f7          	movsbl -0x9(%ebp),%eax
+    4d76:	81 fb ff 2f 00 00    	cmp    $0x2fff,%ebx
+    4d7c:	7e cb                	jle    4d49 <pcachetest+0x197>
+    4d7e:	ba 71 00 00 00       	mov    $0x71,%edx
+    4d83:	eb c9                	jmp    4d4e <pcachetest+0x19c>
+      printf(1, "page cache: wrong data at %d\n", k);
+    4d85:	83 ec 04             	sub    $0x4,%esp
+    4d88:	53                   	push   %ebx
+    4d89:	68 38 c1 00 00       	push   $0xc138
+    4d8e:	6a 01                	push   $0x1
+    4d90:	e8 7c 57 00 00       	call   a511 <printf>
+      exit();
+    4d95:	e8 3e 52 00 00       	call   9fd8 <exit>
+  close(fd);
+    4d9a:	83 ec 0c             	sub    $0xc,%esp
+    4d9d:	56                   	push   %esi
+    4d9e:	e8 64 52 00 00       	call   a007 <close>
+  unlink("pc0");
+    4da3:	c7 04 24 e1 c0 00 00 	movl   $0xc0e1,(%esp)
+    4daa:	e8 98 53 00 00       	call   a147 <unlink>
+  fd = open("pc0", O_CREATE|O_RDWR);
+    4daf:	83 c4 08             	add    $0x8,%esp
+    4db2:	68 02 02 00 00       	push   $0x202
+    4db7:	68 e1 c0 00 00       	push   $0xc0e1
+    4dbc:	e8 68 53 00 00       	call   a129 <open>
+    4dc1:	89 c3                	mov    %eax,%ebx
+  memset(buf, 'n', 4096);
+    4dc3:	83 c4 0c             	add    $0xc,%esp
+    4dc6:	68 00 10 00 00       	push   $0x1000
+    4dcb:	6a 6e                	push   $0x6e
+    4dcd:	68 a0 2c 01 00       	push   $0x12ca0
+    4dd2:	e8 5a 4c 00 00       	call   9a31 <memset>
+  write(fd, buf, 4096);
+    4dd7:	83 c4 0c             	add    $0xc,%esp
+    4dda:	68 00 10 00 00       	push   $0x1000
+    4ddf:	68 a0 2c 01 00       	push   $0x12ca0
+    4de4:	53                   	push   %ebx
+    4de5:	e8 21 53 00 00       	call   a10b <write>
+  close(fd);
+    4dea:	89 1c 24             	mov    %ebx,(%esp)
+    4ded:	e8 15 52 00 00       	call   a007 <close>
+  fd = open("pc0", 0);
+    4df2:	83 c4 08             	add    $0x8,%esp
+    4df5:	6a 00                	push   $0x0
+    4df7:	68 e1 c0 00 00       	push   $0xc0e1
+    4dfc:	e8 28 53 00 00       	call   a129 <open>
+    4e01:	89 c3                	mov    %eax,%ebx
+  if(read(fd, buf, 8192) != 4096 || buf[0] != 'n' || buf[4095] != 'n'){
+    4e03:	83 c4 0c             	add    $0xc,%esp
+    4e06:	68 00 20 00 00       	push   $0x2000
+    4e0b:	68 a0 2c 01 00       	push   $0x12ca0
+    4e10:	50                   	push   %eax
+    4e11:	e8 e6 52 00 00       	call   a0fc <read>
+    4e16:	83 c4 10             	add    $0x10,%esp
+    4e19:	3d 00 10 00 00       	cmp    $0x1000,%eax
+    4e1e:	75 40                	jne    4e60 <pcachetest+0x2ae>
+    4e20:	80 3d a0 2c 01 00 6e 	cmpb   $0x6e,0x12ca0
+    4e27:	75 37                	jne    4e60 <pcachetest+0x2ae>
+    4e29:	80 3d 9f 3c 01 00 6e 	cmpb   $0x6e,0x13c9f
+    4e30:	75 2e                	jne    4e60 <pcachetest+0x2ae>
+  close(fd);
+    4e32:	83 ec 0c             	sub    $0xc,%esp
+    4e35:	53                   	push   %ebx
+    4e36:	e8 cc 51 00 00       	call   a007 <close>
+  unlink("pc0");
+    4e3b:	c7 04 24 e1 c0 00 00 	movl   $0xc0e1,(%esp)
+    4e42:	e8 00 53 00 00       	call   a147 <unlink>
+  printf(1, "page cache test OK\n");
+    4e47:	83 c4 08             	add    $0x8,%esp
+    4e4a:	68 71 c1 00 00       	push   $0xc171
+    4e4f:	6a 01                	push   $0x1
+    4e51:	e8 bb 56 00 00       	call   a511 <printf>
+}
+    4e56:	83 c4 10             	add    $0x10,%esp
+    4e59:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    4e5c:	5b                   	pop    %ebx
+    4e5d:	5e                   	pop    %esi
+    4e5e:	5d                   	pop    %ebp
+    4e5f:	c3                   	ret
+    printf(1, "page cache: old file seen\n");
+    4e60:	83 ec 08             	sub    $0x8,%esp
+    4e63:	68 56 c1 00 00       	push   $0xc156
+    4e68:	6a 01                	push   $0x1
+    4e6a:	e8 a2 56 00 00       	call   a511 <printf>
+    exit();
+    4e6f:	e8 64 51 00 00       	call   9fd8 <exit>
+
+00004e74 <getdentstest>:
+{
+    4e74:	55                   	push   %ebp
+    4e75:	89 e5                	mov    %esp,%ebp
+    4e77:	57                   	push   %edi
+    4e78:	56                   	push   %esi
+    4e79:	53                   	push   %ebx
+    4e7a:	81 ec f4 00 00 00    	sub    $0xf4,%esp
+  printf(1, "getdents test\n");
+    4e80:	68 85 c1 00 00       	push   $0xc185
+    4e85:	6a 01                	push   $0x1
+    4e87:	e8 85 56 00 00       	call   a511 <printf>
+  mkdir("gdd");
+    4e8c:	c7 04 24 94 c1 00 00 	movl   $0xc194,(%esp)
+    4e93:	e8 dc 52 00 00       	call   a174 <mkdir>
+  strcpy(path, "gdd/f00");
+    4e98:	83 c4 08             	add    $0x8,%esp
+    4e9b:	68 98 c1 00 00       	push   $0xc198
+    4ea0:	8d 85 1d ff ff ff    	lea    -0xe3(%ebp),%eax
+    4ea6:	50                   	push   %eax
+    4ea7:	e8 f4 4a 00 00       	call   99a0 <strcpy>
+  for(i = 0; i < 60; i++){   // enough to get hashed
+    4eac:	83 c4 10             	add    $0x10,%esp
+    4eaf:	bb 00 00 00 00       	mov    $0x0,%ebx
+    4eb4:	83 fb 3b             	cmp    $0x3b,%ebx
+    4eb7:	0f 8f 80 00 00 00    	jg     4f3d <getdentstest+0xc9>
+    path[5] = '0' + i/10;
+    4ebd:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    4ec2:	89 d8                	mov    %ebx,%eax
+    4ec4:	f7 ea                	imul   %edx
+    4ec6:	c1 fa 02             	sar    $0x2,%edx
+    4ec9:	89 d8                	mov    %ebx,%eax
+    4ecb:	c1 f8 1f             	sar    $0x1f,%eax
+    4ece:	29 c2                	sub    %eax,%edx
+    4ed0:	8d 42 30             	lea    0x30(%edx),%eax
+    4ed3:	88 85 22 ff ff ff    	mov    %al,-0xde(%ebp)
+    path[6] = '0' + i%10;
+    4ed9:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    4edc:	01 d2                	add    %edx,%edx
+    4ede:	89 d8                	mov    %ebx,%eax
+    4ee0:	29 d0                	sub    %edx,%eax
+    4ee2:	83 c0 30             	add    $0x30,%eax
+    4ee5:	88 85 23 ff ff ff    	mov    %al,-0xdd(%ebp)
+    if((fd = open(path, O_CREATE|O_RDWR)) < 0){
+    4eeb:	83 ec 08             	sub    $0x8,%esp
+    4eee:	68 02 02 00 00       	push   $0x202
+    4ef3:	8d 85 1d ff ff ff    	lea    -0xe3(%ebp),%eax
+    4ef9:	50                   	push   %eax
+    4efa:	e8 2a 52 00 00       	call   a129 <open>
+    4eff:	89 c6                	mov    %eax,%esi
+    4f01:	83 c4 10             	add    $0x10,%esp
+    4f04:	85 c0                	test   %eax,%eax
+    4f06:	78 21                	js     4f29 <getdentstest+0xb5>
+    write(fd, path, i);
+    4f08:	83 ec 04             	sub    $0x4,%esp
+    4f0b:	53                   	push   %ebx
+    4f0c:	8d 85 1d ff ff ff    	lea    -0xe3(%ebp),%eax
+    4f12:	50                   	push   %eax
+    4f13:	56                   	push   %esi
+    4f14:	e8 f2 51 00 00       	call   a10b <write>
+    close(fd);
+    4f19:	89 34 24             	mov    %esi,(%esp)
+    4f1c:	e8 e6 50 00 00       	call   a007 <close>
+  for(i = 0; i < 60; i++){   // enough to get hashed
+    4f21:	83 c3 01             	add    $0x1,%ebx
+    4f24:	83 c4 10             	add    $0x10,%esp
+    4f27:	eb 8b                	jmp    4eb4 <getdentstest+0x40>
+      printf(1, "getdents: create failed\n");
+    4f29:	83 ec 08             	sub    $0x8,%esp
+    4f2c:	68 a0 c1 00 00       	push   $0xc1a0
+    4f31:	6a 01                	push   $0x1
+    4f33:	e8 d9 55 00 00       	call   a511 <printf>
+      exit();
+    4f38:	e8 9b 50 00 00       	call   9fd8 <exit>
+  fd = open("gdd", 0);
+    4f3d:	83 ec 08             	sub    $0x8,%esp
+    4f40:	6a 00                	push   $0x0
+    4f42:	68 94 c1 00 00       	push   $0xc194
+    4f47:	e8 dd 51 00 00       	call   a129 <open>
+    4f4c:	89 85 14 ff ff ff    	mov    %eax,-0xec(%ebp)
+  name[DIRSIZ] = 0;
+    4f52:	c6 85 33 ff ff ff 00 	movb   $0x0,-0xcd(%ebp)
+  while((n = getdents(fd, de, sizeof(de))) > 0){
+    4f59:	83 c4 10             	add    $0x10,%esp
+  seen = dots = 0;
+    4f5c:	c7 85 10 ff ff ff 00 	movl   $0x0,-0xf0(%ebp)
+    4f63:	00 00 00 
+    4f66:	be 00 00 00 00       	mov    $0x0,%esi
+  while((n = getdents(fd, de, sizeof(de))) > 0){
+    4f6b:	83 ec 04             	sub    $0x4,%esp
+    4f6e:	68 a0 00 00 00       	push   $0xa0
+    4f73:	8d 85 48 ff ff ff    	lea    -0xb8(%ebp),%eax
+    4f79:	50                   	push   %eax
+    4f7a:	ff b5 14 ff ff ff    	push   -0xec(%ebp)
+    4f80:	e8 1a 54 00 00       	call   a39f <getdents>
+    4f85:	89 c7                	mov    %eax,%edi
+    4f87:	83 c4 10             	add    $0x10,%esp
+    4f8a:	85 c0                	test   %eax,%eax
+    4f8c:	0f 8e b6 00 00 00    	jle    5048 <getdentstest+0x1d4>
+    for(i = 0; i < n / sizeof(de[0]); i++){
+    4f92:	bb 00 00 00 00       	mov    $0x0,%ebx
+    4f97:	eb 0f                	jmp    4fa8 <getdentstest+0x134>
+        dots++;
+    4f99:	83 85 10 ff ff ff 01 	addl   $0x1,-0xf0(%ebp)
+        continue;
+    4fa0:	eb 03                	jmp    4fa5 <getdentstest+0x131>
+      seen++;
+    4fa2:	83 c6 01             	add    $0x1,%esi
+    for(i = 0; i < n / sizeof(de[0]); i++){
+    4fa5:	83 c3 01             	add    $0x1,%ebx
+    4fa8:	89 f8                	mov    %edi,%eax
+    4faa:	c1 e8 04             	shr    $0x4,%eax
+    4fad:	39 c3                	cmp    %eax,%ebx
+    4faf:	73 ba                	jae    4f6b <getdentstest+0xf7>
+      memmove(name, de[i].name, DIRSIZ);
+    4fb1:	89 d8                	mov    %ebx,%eax
+    4fb3:	c1 e0 04             	shl    $0x4,%eax
+    4fb6:	8d 84 05 4a ff ff ff 	lea    -0xb6(%ebp,%eax,1),%eax
+    4fbd:	83 ec 04             	sub    $0x4,%esp
+    4fc0:	6a 0e                	push   $0xe
+    4fc2:	50                   	push   %eax
+    4fc3:	8d 85 25 ff ff ff    	lea    -0xdb(%ebp),%eax
+    4fc9:	50                   	push   %eax
+    4fca:	e8 38 4c 00 00       	call   9c07 <memmove>
+      if(name[0] == '.'){
+    4fcf:	83 c4 10             	add    $0x10,%esp
+    4fd2:	80 bd 25 ff ff ff 2e 	cmpb   $0x2e,-0xdb(%ebp)
+    4fd9:	74 be                	je     4f99 <getdentstest+0x125>
+      if(fstatat(fd, name, &st) < 0 || st.type != T_FILE ||
+    4fdb:	83 ec 04             	sub    $0x4,%esp
+    4fde:	8d 85 34 ff ff ff    	lea    -0xcc(%ebp),%eax
+    4fe4:	50                   	push   %eax
+    4fe5:	8d 85 25 ff ff ff    	lea    -0xdb(%ebp),%eax
+    4feb:	50                   	push   %eax
+    4fec:	ff b5 14 ff ff ff    	push   -0xec(%ebp)
+    4ff2:	e8 b7 53 00 00       	call   a3ae <fstatat>
+    4ff7:	83 c4 10             	add    $0x10,%esp
+    4ffa:	85 c0                	test   %eax,%eax
+    4ffc:	78 2f                	js     502d <getdentstest+0x1b9>
+    4ffe:	66 83 bd 34 ff ff ff 	cmpw   $0x2,-0xcc(%ebp)
+    5005:	02 
+    5006:	75 25                	jne    502d <getdentstest+0x1b9>
+         st.size != (name[1] - '0')*10 + name[2] - '0'){
+    5008:	0f be 85 26 ff ff ff 	movsbl -0xda(%ebp),%eax
+    500f:	8d 94 80 10 ff ff ff 	lea    -0xf0(%eax,%eax,4),%edx
+    5016:	0f be 85 27 ff ff ff 	movsbl -0xd9(%ebp),%eax
+    501d:	8d 44 50 d0          	lea    -0x30(%eax,%edx,2),%eax
+      if(fstatat(fd, name, &st) < 0 || st.type != T_FILE ||
+    5021:	39 85 44 ff ff ff    	cmp    %eax,-0xbc(%ebp)
+    5027:	0f 84 75 ff ff ff    	je     4fa2 <getdentstest+0x12e>
+        printf(1, "getdents: fstatat %s failed\n", name);
+    502d:	83 ec 04             	sub    $0x4,%esp
+    5030:	8d 85 25 ff ff ff    	lea    -0xdb(%ebp),%eax
+    5036:	50                   	push   %eax
+    5037:	68 b9 c1 00 00       	push   $0xc1b9
+    503c:	6a 01                	push   $0x1
+    503e:	e8 ce 54 00 00       	call   a511 <printf>
+        exit();
+    5043:	e8 90 4f 00 00       	call   9fd8 <exit>
+  close(fd);
+    5048:	83 ec 0c             	sub    $0xc,%esp
+    504b:	ff b5 14 ff ff ff    	push   -0xec(%ebp)
+    5051:	e8 b1 4f 00 00       	call   a007 <close>
+  if(n < 0 || seen != 60 || dots != 2){
+    5056:	89 f8                	mov    %edi,%eax
+    5058:	c1 e8 1f             	shr    $0x1f,%eax
+    505b:	83 c4 10             	add    $0x10,%esp
+    505e:	83 fe 3c             	cmp    $0x3c,%esi
+    5061:	0f 95 c2             	setne  %dl
+    5064:	08 c2                	or     %al,%dl
+    5066:	75 36                	jne    509e <getdentstest+0x22a>
+    5068:	83 bd 10 ff ff ff 02 	cmpl   $0x2,-0xf0(%ebp)
+    506f:	75 2d                	jne    509e <getdentstest+0x22a>
+  if(fstatat(AT_FDCWD, "gdd/f07", &st) < 0 || st.size != 7){
+    5071:	83 ec 04             	sub    $0x4,%esp
+    5074:	8d 85 34 ff ff ff    	lea    -0xcc(%ebp),%eax
+    507a:	50                   	push   %eax
+    507b:	68 d6 c1 00 00       	push   $0xc1d6
+    5080:	6a 9c                	push   $0xffffff9c
+    5082:	e8 27 53 00 00       	call   a3ae <fstatat>
+    5087:	83 c4 10             	add    $0x10,%esp
+    508a:	85 c0                	test   %eax,%eax
+    508c:	78 28                	js     50b6 <getdentstest+0x242>
+    508e:	83 bd 44 ff ff ff 07 	cmpl   $0x7,-0xbc(%ebp)
+    5095:	75 1f                	jne    50b6 <getdentstest+0x242>
+  for(i = 0; i < 60; i++){
+    5097:	bb 00 00 00 00       	mov    $0x0,%ebx
+    509c:	eb 6f                	jmp    510d <getdentstest+0x299>
+    printf(1, "getdents: saw %d names and %d dots\n", seen, dots);
+    509e:	ff b5 10 ff ff ff    	push   -0xf0(%ebp)
+    50a4:	56                   	push   %esi
+    50a5:	68 50 dd 00 00       	push   $0xdd50
+    50aa:	6a 01                	push   $0x1
+    50ac:	e8 60 54 00 00       	call   a511 <printf>
+    exit();
+    50b1:	e8 22 4f 00 00       	call   9fd8 <exit>
+    printf(1, "getdents: fstatat from cwd failed\n");
+    50b6:	83 ec 08             	sub    $0x8,%esp
+    50b9:	68 74 dd 00 00       	push   $0xdd74
+    50be:	6a 01                	push   $0x1
+    50c0:	e8 4c 54 00 00       	call   a511 <printf>
+    exit();
+    50c5:	e8 0e 4f 00 00       	call   9fd8 <exit>
+    path[5] = '0' + i/10;
+    50ca:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    50cf:	89 d8                	mov    %ebx,%eax
+    50d1:	f7 ea                	imul   %edx
+    50d3:	c1 fa 02             	sar    $0x2,%edx
+    50d6:	89 d8                	mov    %ebx,%eax
+    50d8:	c1 f8 1f             	sar    $0x1f,%eax
+    50db:	29 c2                	sub    %eax,%edx
+    50dd:	8d 42 30             	lea    0x30(%edx),%eax
+    50e0:	88 85 22 ff ff ff    	mov    %al,-0xde(%ebp)
+    path[6] = '0' + i%10;
+    50e6:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    50e9:	01 d2                	add    %edx,%edx
+    50eb:	89 d8                	mov    %ebx,%eax
+    50ed:	29 d0                	sub    %edx,%eax
+    50ef:	83 c0 30             	add    $0x30,%eax
+    50f2:	88 85 23 ff ff ff    	mov    %al,-0xdd(%ebp)
+    unlink(path);
+    50f8:	83 ec 0c             	sub    $0xc,%esp
+    50fb:	8d 85 1d ff ff ff    	lea    -0xe3(%ebp),%eax
+    5101:	50                   	push   %eax
+    5102:	e8 40 50 00 00       	call   a147 <unlink>
+  for(i = 0; i < 60; i++){
+    5107:	83 c3 01             	add    $0x1,%ebx
+    510a:	83 c4 10             	add    $0x10,%esp
+    510d:	83 fb 3b             	cmp    $0x3b,%ebx
+    5110:	7e b8                	jle    50ca <getdentstest+0x256>
+  if(unlink("gdd") < 0){
+    5112:	83 ec 0c             	sub    $0xc,%esp
+    5115:	68 94 c1 00 00       	push   $0xc194
+    511a:	e8 28 50 00 00       	call   a147 <unlink>
+    511f:	83 c4 10             	add    $0x10,%esp
+    5122:	85 c0                	test   %eax,%eax
+    5124:	78 1a                	js     5140 <getdentstest+0x2cc>
+  printf(1, "getdents test OK\n");
+    5126:	83 ec 08             	sub    $0x8,%esp
+    5129:	68 f7 c1 00 00       	push   $0xc1f7
+    512e:	6a 01                	push   $0x1
+    5130:	e8 dc 53 00 00       	call   a511 <printf>
+}
+    5135:	83 c4 10             	add    $0x10,%esp
+    5138:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    513b:	5b                   	pop    %ebx
+    513c:	5e                   	pop    %esi
+    513d:	5f                   	pop    %edi
+    513e:	5d                   	pop    %ebp
+    513f:	c3                   	ret
+    printf(1, "getdents: unlink failed\n");
+    5140:	83 ec 08             	sub    $0x8,%esp
+    5143:	68 de c1 00 00       	push   $0xc1de
+    5148:	6a 01                	push   $0x1
+    514a:	e8 c2 53 00 00       	call   a511 <printf>
+    exit();
+    514f:	e8 84 4e 00 00       	call   9fd8 <exit>
+
+00005154 <sysstattest>:
+{
+    5154:	55                   	push   %ebp
+    5155:	89 e5                	mov    %esp,%ebp
+    5157:	53                   	push   %ebx
+    5158:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "sysstat test\n");
+    515b:	68 09 c2 00 00       	push   $0xc209
+    5160:	6a 01                	push   $0x1
+    5162:	e8 aa 53 00 00       	call   a511 <printf>
+  sysstat(SS_SELF, a);
+    5167:	83 c4 08             	add    $0x8,%esp
+    516a:	68 c0 a8 01 00       	push   $0x1a8c0
+    516f:	6a 01                	push   $0x1
+    5171:	e8 47 52 00 00       	call   a3bd <sysstat>
+  for(i = 0; i < 10; i++)
+    5176:	83 c4 10             	add    $0x10,%esp
+    5179:	bb 00 00 00 00       	mov    $0x0,%ebx
+    517e:	eb 08                	jmp    5188 <sysstattest+0x34>
+    getpid();
+    5180:	e8 1c 50 00 00       	call   a1a1 <getpid>
+  for(i = 0; i < 10; i++)
+    5185:	83 c3 01             	add    $0x1,%ebx
+    5188:	83 fb 09             	cmp    $0x9,%ebx
+    518b:	7e f3                	jle    5180 <sysstattest+0x2c>
+  sysstat(SS_SELF, b);
+    518d:	83 ec 08             	sub    $0x8,%esp
+    5190:	68 c0 a3 01 00       	push   $0x1a3c0
+    5195:	6a 01                	push   $0x1
+    5197:	e8 21 52 00 00       	call   a3bd <sysstat>
+  if(b[SYS_getpid].n != a[SYS_getpid].n + 10 ||
+    519c:	a1 9c a9 01 00       	mov    0x1a99c,%eax
+    51a1:	83 c0 0a             	add    $0xa,%eax
+    51a4:	83 c4 10             	add    $0x10,%esp
+    51a7:	39 05 9c a4 01 00    	cmp    %eax,0x1a49c
+    51ad:	0f 85 9b 00 00 00    	jne    524e <sysstattest+0xfa>
+     b[SYS_sysstat].n != a[SYS_sysstat].n + 1 || b[SYS_getpid].max == 0){
+    51b3:	a1 0c ad 01 00       	mov    0x1ad0c,%eax
+    51b8:	83 c0 01             	add    $0x1,%eax
+  if(b[SYS_getpid].n != a[SYS_getpid].n + 10 ||
+    51bb:	39 05 0c a8 01 00    	cmp    %eax,0x1a80c
+    51c1:	0f 85 87 00 00 00    	jne    524e <sysstattest+0xfa>
+     b[SYS_sysstat].n != a[SYS_sysstat].n + 1 || b[SYS_getpid].max == 0){
+    51c7:	a1 ac a4 01 00       	mov    0x1a4ac,%eax
+    51cc:	0b 05 a8 a4 01 00    	or     0x1a4a8,%eax
+    51d2:	74 7a                	je     524e <sysstattest+0xfa>
+  sysstat(SS_CHILDREN, a);
+    51d4:	83 ec 08             	sub    $0x8,%esp
+    51d7:	68 c0 a8 01 00       	push   $0x1a8c0
+    51dc:	6a 02                	push   $0x2
+    51de:	e8 da 51 00 00       	call   a3bd <sysstat>
+  if(fork() == 0){
+    51e3:	e8 dc 4d 00 00       	call   9fc4 <fork>
+    51e8:	89 c3                	mov    %eax,%ebx
+    51ea:	83 c4 10             	add    $0x10,%esp
+    51ed:	85 c0                	test   %eax,%eax
+    51ef:	74 79                	je     526a <sysstattest+0x116>
+  wait();
+    51f1:	e8 e8 4e 00 00       	call   a0de <wait>
+  sysstat(SS_CHILDREN, b);
+    51f6:	83 ec 08             	sub    $0x8,%esp
+    51f9:	68 c0 a3 01 00       	push   $0x1a3c0
+    51fe:	6a 02                	push   $0x2
+    5200:	e8 b8 51 00 00       	call   a3bd <sysstat>
+  if(b[SYS_uptime].n != a[SYS_uptime].n + 5){
+    5205:	a1 d8 a9 01 00       	mov    0x1a9d8,%eax
+    520a:	83 c0 05             	add    $0x5,%eax
+    520d:	83 c4 10             	add    $0x10,%esp
+    5210:	39 05 d8 a4 01 00    	cmp    %eax,0x1a4d8
+    5216:	75 5c                	jne    5274 <sysstattest+0x120>
+  if(sysstat(SS_ALL, b) < 0 || b[SYS_getpid].n < 10){
+    5218:	83 ec 08             	sub    $0x8,%esp
+    521b:	68 c0 a3 01 00       	push   $0x1a3c0
+    5220:	6a 00                	push   $0x0
+    5222:	e8 96 51 00 00       	call   a3bd <sysstat>
+    5227:	83 c4 10             	add    $0x10,%esp
+    522a:	85 c0                	test   %eax,%eax
+    522c:	78 5a                	js     5288 <sysstattest+0x134>
+    522e:	83 3d 9c a4 01 00 09 	cmpl   $0x9,0x1a49c
+    5235:	76 51                	jbe    5288 <sysstattest+0x134>
+  printf(1, "sysstat test OK\n");
+    5237:	83 ec 08             	sub    $0x8,%esp
+    523a:	68 35 c2 00 00       	push   $0xc235
+    523f:	6a 01                	push   $0x1
+    5241:	e8 cb 52 00 00       	call   a511 <printf>
+}
+    5246:	83 c4 10             	add    $0x10,%esp
+    5249:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    524c:	c9                   	leave
+    524d:	c3                   	ret
+    printf(1, "sysstat: own calls miscounted\n");
+    524e:	83 ec 08             	sub    $0x8,%esp
+    5251:	68 98 dd 00 00       	push   $0xdd98
+    5256:	6a 01                	push   $0x1
+    5258:	e8 b4 52 00 00       	call   a511 <printf>
+    exit();
+    525d:	e8 76 4d 00 00       	call   9fd8 <exit>
+      uptime();
+    5262:	e8 67 4f 00 00       	call   a1ce <uptime>
+    for(i = 0; i < 5; i++)
+    5267:	83 c3 01             	add    $0x1,%ebx
+    526a:	83 fb 04             	cmp    $0x4,%ebx
+    526d:	7e f3                	jle    5262 <sysstattest+0x10e>
+    exit();
+    526f:	e8 64 4d 00 00       	call   9fd8 <exit>
+    printf(1, "sysstat: child's calls miscounted\n");
+    5274:	83 ec 08             	sub    $0x8,%esp
+    5277:	68 b8 dd 00 00       	push   $0xddb8
+    527c:	6a 01                	push   $0x1
+    527e:	e8 8e 52 00 00       	call   a511 <printf>
+    exit();
+    5283:	e8 50 4d 00 00       	call   9fd8 <exit>
+    printf(1, "sysstat: system counts wrong\n");
+    5288:	83 ec 08             	sub    $0x8,%esp
+    528b:	68 17 c2 00 00       	push   $0xc217
+    5290:	6a 01                	push   $0x1
+    5292:	e8 7a 52 00 00       	call   a511 <printf>
+    exit();
+    5297:	e8 3c 4d 00 00       	call   9fd8 <exit>
+
+0000529c <ringtest>:
+{
+    529c:	55                   	push   %ebp
+    529d:	89 e5                	mov    %esp,%ebp
+    529f:	57                   	push   %edi
+    52a0:	56                   	push   %esi
+    52a1:	53                   	push   %ebx
+    52a2:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "ring test\n");
+    52a5:	68 69 c5 00 00       	push   $0xc569
+    52aa:	6a 01                	push   $0x1
+    52ac:	e8 60 52 00 00       	call   a511 <printf>
+  ringput(&r, RING_OPEN, 0, "rg0", O_CREATE|O_RDWR, 0);
+    52b1:	83 c4 0c             	add    $0xc,%esp
+    52b4:	6a 00                	push   $0x0
+    52b6:	68 02 02 00 00       	push   $0x202
+    52bb:	68 46 c2 00 00       	push   $0xc246
+    52c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+    52c5:	ba 03 00 00 00       	mov    $0x3,%edx
+    52ca:	b8 a0 9f 01 00       	mov    $0x19fa0,%eax
+    52cf:	e8 2c ad ff ff       	call   0 <ringput>
+  if(ringenter(&r, NRING) != 1 || r.cqtail != 1 || (fd = r.cq[0].res) < 0){
+    52d4:	83 c4 08             	add    $0x8,%esp
+    52d7:	6a 20                	push   $0x20
+    52d9:	68 a0 9f 01 00       	push   $0x19fa0
+    52de:	e8 e9 50 00 00       	call   a3cc <ringenter>
+    52e3:	83 c4 10             	add    $0x10,%esp
+    52e6:	83 f8 01             	cmp    $0x1,%eax
+    52e9:	0f 85 fd 00 00 00    	jne    53ec <ringtest+0x150>
+    52ef:	89 c3                	mov    %eax,%ebx
+    52f1:	83 3d ac 9f 01 00 01 	cmpl   $0x1,0x19fac
+    52f8:	0f 85 ee 00 00 00    	jne    53ec <ringtest+0x150>
+    52fe:	8b 35 b4 a2 01 00    	mov    0x1a2b4,%esi
+    5304:	85 f6                	test   %esi,%esi
+    5306:	0f 88 e0 00 00 00    	js     53ec <ringtest+0x150>
+  ringput(&r, RING_WRITE, fd, "hello ", 6, -1);
+    530c:	83 ec 04             	sub    $0x4,%esp
+    530f:	6a ff                	push   $0xffffffff
+    5311:	6a 06                	push   $0x6
+    5313:	68 5d c2 00 00       	push   $0xc25d
+    5318:	89 f1                	mov    %esi,%ecx
+    531a:	ba 02 00 00 00       	mov    $0x2,%edx
+    531f:	b8 a0 9f 01 00       	mov    $0x19fa0,%eax
+    5324:	e8 d7 ac ff ff       	call   0 <ringput>
+  ringput(&r, RING_WRITE, fd, "world!", 6, -1);
+    5329:	83 c4 0c             	add    $0xc,%esp
+    532c:	6a ff                	push   $0xffffffff
+    532e:	6a 06                	push   $0x6
+    5330:	68 64 c2 00 00       	push   $0xc264
+    5335:	89 f1                	mov    %esi,%ecx
+    5337:	ba 02 00 00 00       	mov    $0x2,%edx
+    533c:	b8 a0 9f 01 00       	mov    $0x19fa0,%eax
+    5341:	e8 ba ac ff ff       	call   0 <ringput>
+  ringput(&r, RING_FSYNC, fd, 0, 0, 0);
+    5346:	83 c4 0c             	add    $0xc,%esp
+    5349:	6a 00                	push   $0x0
+    534b:	6a 00                	push   $0x0
+    534d:	6a 00                	push   $0x0
+    534f:	89 f1                	mov    %esi,%ecx
+    5351:	ba 05 00 00 00       	mov    $0x5,%edx
+    5356:	b8 a0 9f 01 00       	mov    $0x19fa0,%eax
+    535b:	e8 a0 ac ff ff       	call   0 <ringput>
+  ringput(&r, RING_READ, fd, b, 12, 0);
+    5360:	83 c4 0c             	add    $0xc,%esp
+    5363:	6a 00                	push   $0x0
+    5365:	6a 0c                	push   $0xc
+    5367:	8d 7d dc             	lea    -0x24(%ebp),%edi
+    536a:	57                   	push   %edi
+    536b:	89 f1                	mov    %esi,%ecx
+    536d:	ba 01 00 00 00       	mov    $0x1,%edx
+    5372:	b8 a0 9f 01 00       	mov    $0x19fa0,%eax
+    5377:	e8 84 ac ff ff       	call   0 <ringput>
+  ringput(&r, RING_CLOSE, fd, 0, 0, 0);
+    537c:	83 c4 0c             	add    $0xc,%esp
+    537f:	6a 00                	push   $0x0
+    5381:	6a 00                	push   $0x0
+    5383:	6a 00                	push   $0x0
+    5385:	89 f1                	mov    %esi,%ecx
+    5387:	ba 04 00 00 00       	mov    $0x4,%edx
+    538c:	b8 a0 9f 01 00       	mov    $0x19fa0,%eax
+    5391:	e8 6a ac ff ff       	call   0 <ringput>
+  ringput(&r, RING_READ, fd, b, 12, 0);   // closed by now
+    5396:	83 c4 0c             	add    $0xc,%esp
+    5399:	6a 00                	push   $0x0
+    539b:	6a 0c                	push   $0xc
+    539d:	57                   	push   %edi
+    539e:	89 f1                	mov    %esi,%ecx
+    53a0:	ba 01 00 00 00       	mov    $0x1,%edx
+    53a5:	b8 a0 9f 01 00       	mov    $0x19fa0,%eax
+    53aa:	e8 51 ac ff ff       	call   0 <ringput>
+  if(ringenter(&r, NRING) != 6 || r.sqhead != 7 || r.cqtail != 7){
+    53af:	83 c4 08             	add    $0x8,%esp
+    53b2:	6a 20                	push   $0x20
+    53b4:	68 a0 9f 01 00       	push   $0x19fa0
+    53b9:	e8 0e 50 00 00       	call   a3cc <ringenter>
+    53be:	83 c4 10             	add    $0x10,%esp
+    53c1:	83 f8 06             	cmp    $0x6,%eax
+    53c4:	75 3a                	jne    5400 <ringtest+0x164>
+    53c6:	83 3d a0 9f 01 00 07 	cmpl   $0x7,0x19fa0
+    53cd:	75 31                	jne    5400 <ringtest+0x164>
+    53cf:	a1 ac 9f 01 00       	mov    0x19fac,%eax
+    53d4:	83 f8 07             	cmp    $0x7,%eax
+    53d7:	75 27                	jne    5400 <ringtest+0x164>
+  for(i = 1; i < 7; i++){
+    53d9:	83 fb 06             	cmp    $0x6,%ebx
+    53dc:	7f 4b                	jg     5429 <ringtest+0x18d>
+    if(r.cq[i].data != i){
+    53de:	39 1c dd b0 a2 01 00 	cmp    %ebx,0x1a2b0(,%ebx,8)
+    53e5:	75 2d                	jne    5414 <ringtest+0x178>
+  for(i = 1; i < 7; i++){
+    53e7:	83 c3 01             	add    $0x1,%ebx
+    53ea:	eb ed                	jmp    53d9 <ringtest+0x13d>
+    printf(1, "ring: open failed\n");
+    53ec:	83 ec 08             	sub    $0x8,%esp
+    53ef:	68 4a c2 00 00       	push   $0xc24a
+    53f4:	6a 01                	push   $0x1
+    53f6:	e8 16 51 00 00       	call   a511 <printf>
+    exit();
+    53fb:	e8 d8 4b 00 00       	call   9fd8 <exit>
+    printf(1, "ring: not all done\n");
+    5400:	83 ec 08             	sub    $0x8,%esp
+    5403:	68 6b c2 00 00       	push   $0xc26b
+    5408:	6a 01                	push   $0x1
+    540a:	e8 02 51 00 00       	call   a511 <printf>
+    exit();
+    540f:	e8 c4 4b 00 00       	call   9fd8 <exit>
+      printf(1, "ring: completion %d out of order\n", i);
+    5414:	83 ec 04             	sub    $0x4,%esp
+    5417:	53                   	push   %ebx
+    5418:	68 dc dd 00 00       	push   $0xdddc
+    541d:	6a 01                	push   $0x1
+    541f:	e8 ed 50 00 00       	call   a511 <printf>
+      exit();
+    5424:	e8 af 4b 00 00       	call   9fd8 <exit>
+  if(r.cq[1].res != 6 || r.cq[2].res != 6 || r.cq[3].res != 0 ||
+    5429:	83 3d bc a2 01 00 06 	cmpl   $0x6,0x1a2bc
+    5430:	75 6b                	jne    549d <ringtest+0x201>
+    5432:	83 3d c4 a2 01 00 06 	cmpl   $0x6,0x1a2c4
+    5439:	75 62                	jne    549d <ringtest+0x201>
+    543b:	83 3d cc a2 01 00 00 	cmpl   $0x0,0x1a2cc
+    5442:	75 59                	jne    549d <ringtest+0x201>
+    5444:	83 3d d4 a2 01 00 0c 	cmpl   $0xc,0x1a2d4
+    544b:	75 50                	jne    549d <ringtest+0x201>
+     r.cq[4].res != 12 || r.cq[5].res != 0 || r.cq[6].res != -1 ||
+    544d:	83 3d dc a2 01 00 00 	cmpl   $0x0,0x1a2dc
+    5454:	75 47                	jne    549d <ringtest+0x201>
+    5456:	83 3d e4 a2 01 00 ff 	cmpl   $0xffffffff,0x1a2e4
+    545d:	75 3e                	jne    549d <ringtest+0x201>
+    545f:	80 7d dc 68          	cmpb   $0x68,-0x24(%ebp)
+    5463:	75 38                	jne    549d <ringtest+0x201>
+     b[0] != 'h' || b[6] != 'w' || b[11] != '!'){
+    5465:	80 7d e2 77          	cmpb   $0x77,-0x1e(%ebp)
+    5469:	75 32                	jne    549d <ringtest+0x201>
+    546b:	80 7d e7 21          	cmpb   $0x21,-0x19(%ebp)
+    546f:	75 2c                	jne    549d <ringtest+0x201>
+  r.cqhead = r.cqtail;
+    5471:	a3 a8 9f 01 00       	mov    %eax,0x19fa8
+  unlink("rg0");
+    5476:	83 ec 0c             	sub    $0xc,%esp
+    5479:	68 46 c2 00 00       	push   $0xc246
+    547e:	e8 c4 4c 00 00       	call   a147 <unlink>
+  printf(1, "ring test OK\n");
+    5483:	83 c4 08             	add    $0x8,%esp
+    5486:	68 a9 c5 00 00       	push   $0xc5a9
+    548b:	6a 01                	push   $0x1
+    548d:	e8 7f 50 00 00       	call   a511 <printf>
+}
+    5492:	83 c4 10             	add    $0x10,%esp
+    5495:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    5498:	5b                   	pop    %ebx
+    5499:	5e                   	pop    %esi
+    549a:	5f                   	pop    %edi
+    549b:	5d                   	pop    %ebp
+    549c:	c3                   	ret
+    printf(1, "ring: wrong results\n");
+    549d:	83 ec 08             	sub    $0x8,%esp
+    54a0:	68 7f c2 00 00       	push   $0xc27f
+    54a5:	6a 01                	push   $0x1
+    54a7:	e8 65 50 00 00       	call   a511 <printf>
+    exit();
+    54ac:	e8 27 4b 00 00       	call   9fd8 <exit>
+
+000054b1 <tracetest>:
+{
+    54b1:	55                   	push   %ebp
+    54b2:	89 e5                	mov    %esp,%ebp
+    54b4:	57                   	push   %edi
+    54b5:	56                   	push   %esi
+    54b6:	53                   	push   %ebx
+    54b7:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "trace test\n");
+    54ba:	68 94 c2 00 00       	push   $0xc294
+    54bf:	6a 01                	push   $0x1
+    54c1:	e8 4b 50 00 00       	call   a511 <printf>
+  pid = getpid();
+    54c6:	e8 d6 4c 00 00       	call   a1a1 <getpid>
+    54cb:	89 c6                	mov    %eax,%esi
+  for(cpu = 0; trace(TR_READ, cpu, ev, 64) >= 0; cpu++)
+    54cd:	83 c4 10             	add    $0x10,%esp
+    54d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    54d5:	eb 19                	jmp    54f0 <tracetest+0x3f>
+    while(trace(TR_READ, cpu, ev, 64) > 0)
+    54d7:	6a 40                	push   $0x40
+    54d9:	68 a0 9a 01 00       	push   $0x19aa0
+    54de:	53                   	push   %ebx
+    54df:	6a 01                	push   $0x1
+    54e1:	e8 f5 4e 00 00       	call   a3db <trace>
+    54e6:	83 c4 10             	add    $0x10,%esp
+    54e9:	85 c0                	test   %eax,%eax
+    54eb:	7f ea                	jg     54d7 <tracetest+0x26>
+  for(cpu = 0; trace(TR_READ, cpu, ev, 64) >= 0; cpu++)
+    54ed:	83 c3 01             	add    $0x1,%ebx
+    54f0:	6a 40                	push   $0x40
+    54f2:	68 a0 9a 01 00       	push   $0x19aa0
+    54f7:	53                   	push   %ebx
+    54f8:	6a 01                	push   $0x1
+    54fa:	e8 dc 4e 00 00       	call   a3db <trace>
+    54ff:	83 c4 10             	add    $0x10,%esp
+    5502:	85 c0                	test   %eax,%eax
+    5504:	79 d1                	jns    54d7 <tracetest+0x26>
+  trace(TR_ENABLE, TC_SYSCALL, 0, 0);
+    5506:	6a 00                	push   $0x0
+    5508:	6a 00                	push   $0x0
+    550a:	6a 08                	push   $0x8
+    550c:	6a 00                	push   $0x0
+    550e:	e8 c8 4e 00 00       	call   a3db <trace>
+  getpid();
+    5513:	e8 89 4c 00 00       	call   a1a1 <getpid>
+  if(trace(TR_ENABLE, 0, 0, 0) != TC_SYSCALL){
+    5518:	6a 00                	push   $0x0
+    551a:	6a 00                	push   $0x0
+    551c:	6a 00                	push   $0x0
+    551e:	6a 00                	push   $0x0
+    5520:	e8 b6 4e 00 00       	call   a3db <trace>
+    5525:	83 c4 20             	add    $0x20,%esp
+    5528:	83 f8 08             	cmp    $0x8,%eax
+    552b:	75 15                	jne    5542 <tracetest+0x91>
+  in = out = 0;
+    552d:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+    5534:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  for(cpu = 0; trace(TR_READ, cpu, ev, 0) >= 0; cpu++){
+    553b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    5540:	eb 72                	jmp    55b4 <tracetest+0x103>
+    printf(1, "trace: mask not kept\n");
+    5542:	83 ec 08             	sub    $0x8,%esp
+    5545:	68 a0 c2 00 00       	push   $0xc2a0
+    554a:	6a 01                	push   $0x1
+    554c:	e8 c0 4f 00 00       	call   a511 <printf>
+    exit();
+    5551:	e8 82 4a 00 00       	call   9fd8 <exit>
+        if(ev[i].type == TE_SYSCALL && ev[i].b == SYS_getpid)
+    5556:	8d 3c 80             	lea    (%eax,%eax,4),%edi
+    5559:	83 3c bd b0 9a 01 00 	cmpl   $0xb,0x19ab0(,%edi,4)
+    5560:	0b 
+    5561:	75 3a                	jne    559d <tracetest+0xec>
+          in++;
+    5563:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+    5567:	eb 34                	jmp    559d <tracetest+0xec>
+          out++;
+    5569:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+      for(i = 0; i < n; i++){
+    556d:	83 c0 01             	add    $0x1,%eax
+    5570:	39 d0                	cmp    %edx,%eax
+    5572:	7d 56                	jge    55ca <tracetest+0x119>
+        if(ev[i].cpu != cpu || ev[i].a != pid)
+    5574:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+    5577:	0f b7 0c 8d aa 9a 01 	movzwl 0x19aaa(,%ecx,4),%ecx
+    557e:	00 
+    557f:	39 d9                	cmp    %ebx,%ecx
+    5581:	75 ea                	jne    556d <tracetest+0xbc>
+    5583:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+    5586:	39 34 8d ac 9a 01 00 	cmp    %esi,0x19aac(,%ecx,4)
+    558d:	75 de                	jne    556d <tracetest+0xbc>
+        if(ev[i].type == TE_SYSCALL && ev[i].b == SYS_getpid)
+    558f:	0f b7 0c 8d a8 9a 01 	movzwl 0x19aa8(,%ecx,4),%ecx
+    5596:	00 
+    5597:	66 83 f9 05          	cmp    $0x5,%cx
+    559b:	74 b9                	je     5556 <tracetest+0xa5>
+        if(ev[i].type == TE_SYSRET && ev[i].b == pid)
+    559d:	66 83 f9 06          	cmp    $0x6,%cx
+    55a1:	75 ca                	jne    556d <tracetest+0xbc>
+    55a3:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+    55a6:	3b 34 8d b0 9a 01 00 	cmp    0x19ab0(,%ecx,4),%esi
+    55ad:	75 be                	jne    556d <tracetest+0xbc>
+    55af:	eb b8                	jmp    5569 <tracetest+0xb8>
+  for(cpu = 0; trace(TR_READ, cpu, ev, 0) >= 0; cpu++){
+    55b1:	83 c3 01             	add    $0x1,%ebx
+    55b4:	6a 00                	push   $0x0
+    55b6:	68 a0 9a 01 00       	push   $0x19aa0
+    55bb:	53                   	push   %ebx
+    55bc:	6a 01                	push   $0x1
+    55be:	e8 18 4e 00 00       	call   a3db <trace>
+    55c3:	83 c4 10             	add    $0x10,%esp
+    55c6:	85 c0                	test   %eax,%eax
+    55c8:	78 1f                	js     55e9 <tracetest+0x138>
+    while((n = trace(TR_READ, cpu, ev, 64)) > 0){
+    55ca:	6a 40                	push   $0x40
+    55cc:	68 a0 9a 01 00       	push   $0x19aa0
+    55d1:	53                   	push   %ebx
+    55d2:	6a 01                	push   $0x1
+    55d4:	e8 02 4e 00 00       	call   a3db <trace>
+    55d9:	89 c2                	mov    %eax,%edx
+    55db:	83 c4 10             	add    $0x10,%esp
+    55de:	85 c0                	test   %eax,%eax
+    55e0:	7e cf                	jle    55b1 <tracetest+0x100>
+      for(i = 0; i < n; i++){
+    55e2:	b8 00 00 00 00       	mov    $0x0,%eax
+    55e7:	eb 87                	jmp    5570 <tracetest+0xbf>
+  if(in != 1 || out != 1){
+    55e9:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    55ed:	0f 95 c0             	setne  %al
+    55f0:	83 7d e0 01          	cmpl   $0x1,-0x20(%ebp)
+    55f4:	0f 95 c2             	setne  %dl
+    55f7:	08 d0                	or     %dl,%al
+    55f9:	75 1a                	jne    5615 <tracetest+0x164>
+  printf(1, "trace test OK\n");
+    55fb:	83 ec 08             	sub    $0x8,%esp
+    55fe:	68 b6 c2 00 00       	push   $0xc2b6
+    5603:	6a 01                	push   $0x1
+    5605:	e8 07 4f 00 00       	call   a511 <printf>
+}
+    560a:	83 c4 10             	add    $0x10,%esp
+    560d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    5610:	5b                   	pop    %ebx
+    5611:	5e                   	pop    %esi
+    5612:	5f                   	pop    %edi
+    5613:	5d                   	pop    %ebp
+    5614:	c3                   	ret
+    printf(1, "trace: getpid traced %d in, %d out\n", in, out);
+    5615:	ff 75 e0             	push   -0x20(%ebp)
+    5618:	ff 75 e4             	push   -0x1c(%ebp)
+    561b:	68 00 de 00 00       	push   $0xde00
+    5620:	6a 01                	push   $0x1
+    5622:	e8 ea 4e 00 00       	call   a511 <printf>
+    exit();
+    5627:	e8 ac 49 00 00       	call   9fd8 <exit>
+
+0000562c <stdiotest>:
+{
+    562c:	55                   	push   %ebp
+    562d:	89 e5                	mov    %esp,%ebp
+    562f:	56                   	push   %esi
+    5630:	53                   	push   %ebx
+    5631:	83 ec 38             	sub    $0x38,%esp
+  printf(1, "stdio test\n");
+    5634:	68 c5 c2 00 00       	push   $0xc2c5
+    5639:	6a 01                	push   $0x1
+    563b:	e8 d1 4e 00 00       	call   a511 <printf>
+  fd = open("stdio0", O_CREATE|O_RDWR);
+    5640:	83 c4 08             	add    $0x8,%esp
+    5643:	68 02 02 00 00       	push   $0x202
+    5648:	68 d1 c2 00 00       	push   $0xc2d1
+    564d:	e8 d7 4a 00 00       	call   a129 <open>
+  if(fd < 0){
+    5652:	83 c4 10             	add    $0x10,%esp
+    5655:	85 c0                	test   %eax,%eax
+    5657:	0f 88 5d 01 00 00    	js     57ba <stdiotest+0x18e>
+    565d:	89 c3                	mov    %eax,%ebx
+  printf(fd, "%d %s", 42, "abc");
+    565f:	68 ee c2 00 00       	push   $0xc2ee
+    5664:	6a 2a                	push   $0x2a
+    5666:	68 f2 c2 00 00       	push   $0xc2f2
+    566b:	50                   	push   %eax
+    566c:	e8 a0 4e 00 00       	call   a511 <printf>
+  if(fstat(fd, &st) < 0 || st.size != 0){
+    5671:	83 c4 08             	add    $0x8,%esp
+    5674:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    5677:	50                   	push   %eax
+    5678:	53                   	push   %ebx
+    5679:	e8 d8 4a 00 00       	call   a156 <fstat>
+    567e:	83 c4 10             	add    $0x10,%esp
+    5681:	85 c0                	test   %eax,%eax
+    5683:	0f 88 45 01 00 00    	js     57ce <stdiotest+0x1a2>
+    5689:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    568d:	0f 85 3b 01 00 00    	jne    57ce <stdiotest+0x1a2>
+  printf(fd, "!");
+    5693:	83 ec 08             	sub    $0x8,%esp
+    5696:	68 fe c2 00 00       	push   $0xc2fe
+    569b:	53                   	push   %ebx
+    569c:	e8 70 4e 00 00       	call   a511 <printf>
+  if(fork() == 0)
+    56a1:	e8 1e 49 00 00       	call   9fc4 <fork>
+    56a6:	83 c4 10             	add    $0x10,%esp
+    56a9:	85 c0                	test   %eax,%eax
+    56ab:	0f 84 31 01 00 00    	je     57e2 <stdiotest+0x1b6>
+  wait();
+    56b1:	e8 28 4a 00 00       	call   a0de <wait>
+  close(fd);
+    56b6:	83 ec 0c             	sub    $0xc,%esp
+    56b9:	53                   	push   %ebx
+    56ba:	e8 48 49 00 00       	call   a007 <close>
+  fd = open("stdio0", O_RDONLY);
+    56bf:	83 c4 08             	add    $0x8,%esp
+    56c2:	6a 00                	push   $0x0
+    56c4:	68 d1 c2 00 00       	push   $0xc2d1
+    56c9:	e8 5b 4a 00 00       	call   a129 <open>
+    56ce:	89 c6                	mov    %eax,%esi
+  n = read(fd, b, sizeof(b) - 1);
+    56d0:	83 c4 0c             	add    $0xc,%esp
+    56d3:	6a 0f                	push   $0xf
+    56d5:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+    56d8:	50                   	push   %eax
+    56d9:	56                   	push   %esi
+    56da:	e8 1d 4a 00 00       	call   a0fc <read>
+    56df:	89 c3                	mov    %eax,%ebx
+  close(fd);
+    56e1:	89 34 24             	mov    %esi,(%esp)
+    56e4:	e8 1e 49 00 00       	call   a007 <close>
+  unlink("stdio0");
+    56e9:	c7 04 24 d1 c2 00 00 	movl   $0xc2d1,(%esp)
+    56f0:	e8 52 4a 00 00       	call   a147 <unlink>
+  if(n != 7 || (b[n] = 0, strcmp(b, "42 abc!")) != 0){
+    56f5:	83 c4 10             	add    $0x10,%esp
+    56f8:	83 fb 07             	cmp    $0x7,%ebx
+    56fb:	0f 85 e6 00 00 00    	jne    57e7 <stdiotest+0x1bb>
+    5701:	c6 44 1d d4 00       	movb   $0x0,-0x2c(%ebp,%ebx,1)
+    5706:	83 ec 08             	sub    $0x8,%esp
+    5709:	68 f8 c2 00 00       	push   $0xc2f8
+    570e:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+    5711:	50                   	push   %eax
+    5712:	e8 af 42 00 00       	call   99c6 <strcmp>
+    5717:	83 c4 10             	add    $0x10,%esp
+    571a:	85 c0                	test   %eax,%eax
+    571c:	0f 85 c5 00 00 00    	jne    57e7 <stdiotest+0x1bb>
+  if(pipe(p) < 0){
+    5722:	83 ec 0c             	sub    $0xc,%esp
+    5725:	8d 45 cc             	lea    -0x34(%ebp),%eax
+    5728:	50                   	push   %eax
+    5729:	e8 bf 49 00 00       	call   a0ed <pipe>
+    572e:	83 c4 10             	add    $0x10,%esp
+    5731:	85 c0                	test   %eax,%eax
+    5733:	0f 88 c3 00 00 00    	js     57fc <stdiotest+0x1d0>
+  if(fork() == 0){
+    5739:	e8 86 48 00 00       	call   9fc4 <fork>
+    573e:	85 c0                	test   %eax,%eax
+    5740:	0f 84 ca 00 00 00    	je     5810 <stdiotest+0x1e4>
+  close(p[1]);
+    5746:	83 ec 0c             	sub    $0xc,%esp
+    5749:	ff 75 d0             	push   -0x30(%ebp)
+    574c:	e8 b6 48 00 00       	call   a007 <close>
+  n = read(p[0], b, sizeof(b) - 1);
+    5751:	83 c4 0c             	add    $0xc,%esp
+    5754:	6a 0f                	push   $0xf
+    5756:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+    5759:	50                   	push   %eax
+    575a:	ff 75 cc             	push   -0x34(%ebp)
+    575d:	e8 9a 49 00 00       	call   a0fc <read>
+    5762:	89 c3                	mov    %eax,%ebx
+  close(p[0]);
+    5764:	83 c4 04             	add    $0x4,%esp
+    5767:	ff 75 cc             	push   -0x34(%ebp)
+    576a:	e8 98 48 00 00       	call   a007 <close>
+  wait();
+    576f:	e8 6a 49 00 00       	call   a0de <wait>
+  if(n != 10 || (b[n] = 0, strcmp(b, "from child")) != 0){
+    5774:	83 c4 10             	add    $0x10,%esp
+    5777:	83 fb 0a             	cmp    $0xa,%ebx
+    577a:	0f 85 b0 00 00 00    	jne    5830 <stdiotest+0x204>
+    5780:	c6 44 1d d4 00       	movb   $0x0,-0x2c(%ebp,%ebx,1)
+    5785:	83 ec 08             	sub    $0x8,%esp
+    5788:	68 2e c3 00 00       	push   $0xc32e
+    578d:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+    5790:	50                   	push   %eax
+    5791:	e8 30 42 00 00       	call   99c6 <strcmp>
+    5796:	83 c4 10             	add    $0x10,%esp
+    5799:	85 c0                	test   %eax,%eax
+    579b:	0f 85 8f 00 00 00    	jne    5830 <stdiotest+0x204>
+  printf(1, "stdio test OK\n");
+    57a1:	83 ec 08             	sub    $0x8,%esp
+    57a4:	68 54 c3 00 00       	push   $0xc354
+    57a9:	6a 01                	push   $0x1
+    57ab:	e8 61 4d 00 00       	call   a511 <printf>
+}
+    57b0:	83 c4 10             	add    $0x10,%esp
+    57b3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    57b6:	5b                   	pop    %ebx
+    57b7:	5e                   	pop    %esi
+    57b8:	5d                   	pop    %ebp
+    57b9:	c3                   	ret
+    printf(1, "stdio: create failed\n");
+    57ba:	83 ec 08             	sub    $0x8,%esp
+    57bd:	68 d8 c2 00 00       	push   $0xc2d8
+    57c2:	6a 01                	push   $0x1
+    57c4:	e8 48 4d 00 00       	call   a511 <printf>
+    exit();
+    57c9:	e8 0a 48 00 00       	call   9fd8 <exit>
+    printf(1, "stdio: file written unbuffered\n");
+    57ce:	83 ec 08             	sub    $0x8,%esp
+    57d1:	68 24 de 00 00       	push   $0xde24
+    57d6:	6a 01                	push   $0x1
+    57d8:	e8 34 4d 00 00       	call   a511 <printf>
+    exit();
+    57dd:	e8 f6 47 00 00       	call   9fd8 <exit>
+    exit();
+    57e2:	e8 f1 47 00 00       	call   9fd8 <exit>
+    printf(1, "stdio: file has %d bytes\n", n);
+    57e7:	83 ec 04             	sub    $0x4,%esp
+    57ea:	53                   	push   %ebx
+    57eb:	68 00 c3 00 00       	push   $0xc300
+    57f0:	6a 01                	push   $0x1
+    57f2:	e8 1a 4d 00 00       	call   a511 <printf>
+    exit();
+    57f7:	e8 dc 47 00 00       	call   9fd8 <exit>
+    printf(1, "stdio: pipe failed\n");
+    57fc:	83 ec 08             	sub    $0x8,%esp
+    57ff:	68 1a c3 00 00       	push   $0xc31a
+    5804:	6a 01                	push   $0x1
+    5806:	e8 06 4d 00 00       	call   a511 <printf>
+    exit();
+    580b:	e8 c8 47 00 00       	call   9fd8 <exit>
+    close(p[0]);
+    5810:	83 ec 0c             	sub    $0xc,%esp
+    5813:	ff 75 cc             	push   -0x34(%ebp)
+    5816:	e8 ec 47 00 00       	call   a007 <close>
+    printf(p[1], "from child");
+    581b:	83 c4 08             	add    $0x8,%esp
+    581e:	68 2e c3 00 00       	push   $0xc32e
+    5823:	ff 75 d0             	push   -0x30(%ebp)
+    5826:	e8 e6 4c 00 00       	call   a511 <printf>
+    exit();
+    582b:	e8 a8 47 00 00       	call   9fd8 <exit>
+    printf(1, "stdio: exit did not flush\n");
+    5830:	83 ec 08             	sub    $0x8,%esp
+    5833:	68 39 c3 00 00       	push   $0xc339
+    5838:	6a 01                	push   $0x1
+    583a:	e8 d2 4c 00 00       	call   a511 <printf>
+    exit();
+    583f:	e8 94 47 00 00       	call   9fd8 <exit>
+
+00005844 <inlinetest>:
+{
+    5844:	55                   	push   %ebp
+    5845:	89 e5                	mov    %esp,%ebp
+    5847:	57                   	push   %edi
+    5848:	56                   	push   %esi
+    5849:	53                   	push   %ebx
+    584a:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "inline test\n");
+    584d:	68 63 c3 00 00       	push   $0xc363
+    5852:	6a 01                	push   $0x1
+    5854:	e8 b8 4c 00 00       	call   a511 <printf>
+  if((fd = open("inl", O_CREATE|O_RDWR)) < 0){
+    5859:	83 c4 08             	add    $0x8,%esp
+    585c:	68 02 02 00 00       	push   $0x202
+    5861:	68 70 c3 00 00       	push   $0xc370
+    5866:	e8 be 48 00 00       	call   a129 <open>
+    586b:	83 c4 10             	add    $0x10,%esp
+    586e:	85 c0                	test   %eax,%eax
+    5870:	0f 88 91 00 00 00    	js     5907 <inlinetest+0xc3>
+    5876:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "hello", 5) != 5 || write(fd, " world", 6) != 6){
+    5878:	83 ec 04             	sub    $0x4,%esp
+    587b:	6a 05                	push   $0x5
+    587d:	68 26 b0 00 00       	push   $0xb026
+    5882:	50                   	push   %eax
+    5883:	e8 83 48 00 00       	call   a10b <write>
+    5888:	83 c4 10             	add    $0x10,%esp
+    588b:	83 f8 05             	cmp    $0x5,%eax
+    588e:	0f 85 87 00 00 00    	jne    591b <inlinetest+0xd7>
+    5894:	83 ec 04             	sub    $0x4,%esp
+    5897:	6a 06                	push   $0x6
+    5899:	68 a6 c3 00 00       	push   $0xc3a6
+    589e:	53                   	push   %ebx
+    589f:	e8 67 48 00 00       	call   a10b <write>
+    58a4:	83 c4 10             	add    $0x10,%esp
+    58a7:	83 f8 06             	cmp    $0x6,%eax
+    58aa:	75 6f                	jne    591b <inlinetest+0xd7>
+  close(fd);
+    58ac:	83 ec 0c             	sub    $0xc,%esp
+    58af:	53                   	push   %ebx
+    58b0:	e8 52 47 00 00       	call   a007 <close>
+  fd = open("inl", O_RDWR);
+    58b5:	83 c4 08             	add    $0x8,%esp
+    58b8:	6a 02                	push   $0x2
+    58ba:	68 70 c3 00 00       	push   $0xc370
+    58bf:	e8 65 48 00 00       	call   a129 <open>
+    58c4:	89 c7                	mov    %eax,%edi
+  buf[11] = 0;
+    58c6:	c6 05 ab 2c 01 00 00 	movb   $0x0,0x12cab
+  if(read(fd, buf, sizeof(buf)) != 11 || strcmp(buf, "hello world") != 0){
+    58cd:	83 c4 0c             	add    $0xc,%esp
+    58d0:	68 00 20 00 00       	push   $0x2000
+    58d5:	68 a0 2c 01 00       	push   $0x12ca0
+    58da:	50                   	push   %eax
+    58db:	e8 1c 48 00 00       	call   a0fc <read>
+    58e0:	89 c3                	mov    %eax,%ebx
+    58e2:	83 c4 10             	add    $0x10,%esp
+    58e5:	83 f8 0b             	cmp    $0xb,%eax
+    58e8:	75 45                	jne    592f <inlinetest+0xeb>
+    58ea:	83 ec 08             	sub    $0x8,%esp
+    58ed:	68 a1 c3 00 00       	push   $0xc3a1
+    58f2:	68 a0 2c 01 00       	push   $0x12ca0
+    58f7:	e8 ca 40 00 00       	call   99c6 <strcmp>
+    58fc:	83 c4 10             	add    $0x10,%esp
+    58ff:	85 c0                	test   %eax,%eax
+    5901:	75 2c                	jne    592f <inlinetest+0xeb>
+  for(i = 11; i < 1500; i++){
+    5903:	89 de                	mov    %ebx,%esi
+    5905:	eb 3f                	jmp    5946 <inlinetest+0x102>
+    printf(1, "inline: create failed\n");
+    5907:	83 ec 08             	sub    $0x8,%esp
+    590a:	68 74 c3 00 00       	push   $0xc374
+    590f:	6a 01                	push   $0x1
+    5911:	e8 fb 4b 00 00       	call   a511 <printf>
+    exit();
+    5916:	e8 bd 46 00 00       	call   9fd8 <exit>
+    printf(1, "inline: write failed\n");
+    591b:	83 ec 08             	sub    $0x8,%esp
+    591e:	68 8b c3 00 00       	push   $0xc38b
+    5923:	6a 01                	push   $0x1
+    5925:	e8 e7 4b 00 00       	call   a511 <printf>
+    exit();
+    592a:	e8 a9 46 00 00       	call   9fd8 <exit>
+    printf(1, "inline: read back wrong\n");
+    592f:	83 ec 08             	sub    $0x8,%esp
+    5932:	68 ad c3 00 00       	push   $0xc3ad
+    5937:	6a 01                	push   $0x1
+    5939:	e8 d3 4b 00 00       	call   a511 <printf>
+    exit();
+    593e:	e8 95 46 00 00       	call   9fd8 <exit>
+  for(i = 11; i < 1500; i++){
+    5943:	83 c6 01             	add    $0x1,%esi
+    5946:	81 fe db 05 00 00    	cmp    $0x5db,%esi
+    594c:	7f 33                	jg     5981 <inlinetest+0x13d>
+    buf[0] = i;
+    594e:	89 f0                	mov    %esi,%eax
+    5950:	a2 a0 2c 01 00       	mov    %al,0x12ca0
+    if(write(fd, buf, 1) != 1){
+    5955:	83 ec 04             	sub    $0x4,%esp
+    5958:	6a 01                	push   $0x1
+    595a:	68 a0 2c 01 00       	push   $0x12ca0
+    595f:	57                   	push   %edi
+    5960:	e8 a6 47 00 00       	call   a10b <write>
+    5965:	83 c4 10             	add    $0x10,%esp
+    5968:	83 f8 01             	cmp    $0x1,%eax
+    596b:	74 d6                	je     5943 <inlinetest+0xff>
+      printf(1, "inline: append failed\n");
+    596d:	83 ec 08             	sub    $0x8,%esp
+    5970:	68 c6 c3 00 00       	push   $0xc3c6
+    5975:	6a 01                	push   $0x1
+    5977:	e8 95 4b 00 00       	call   a511 <printf>
+      exit();
+    597c:	e8 57 46 00 00       	call   9fd8 <exit>
+  close(fd);
+    5981:	83 ec 0c             	sub    $0xc,%esp
+    5984:	57                   	push   %edi
+    5985:	e8 7d 46 00 00       	call   a007 <close>
+  fd = open("inl", 0);
+    598a:	83 c4 08             	add    $0x8,%esp
+    598d:	6a 00                	push   $0x0
+    598f:	68 70 c3 00 00       	push   $0xc370
+    5994:	e8 90 47 00 00       	call   a129 <open>
+    5999:	89 c6                	mov    %eax,%esi
+  if(fstat(fd, &st) < 0 || st.size != 1500){
+    599b:	83 c4 08             	add    $0x8,%esp
+    599e:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+    59a1:	50                   	push   %eax
+    59a2:	56                   	push   %esi
+    59a3:	e8 ae 47 00 00       	call   a156 <fstat>
+    59a8:	83 c4 10             	add    $0x10,%esp
+    59ab:	85 c0                	test   %eax,%eax
+    59ad:	78 4d                	js     59fc <inlinetest+0x1b8>
+    59af:	81 7d e4 dc 05 00 00 	cmpl   $0x5dc,-0x1c(%ebp)
+    59b6:	75 44                	jne    59fc <inlinetest+0x1b8>
+  if(read(fd, buf, 1500) != 1500 || buf[0] != 'h' || buf[10] != 'd'){
+    59b8:	83 ec 04             	sub    $0x4,%esp
+    59bb:	68 dc 05 00 00       	push   $0x5dc
+    59c0:	68 a0 2c 01 00       	push   $0x12ca0
+    59c5:	56                   	push   %esi
+    59c6:	e8 31 47 00 00       	call   a0fc <read>
+    59cb:	83 c4 10             	add    $0x10,%esp
+    59ce:	3d dc 05 00 00       	cmp    $0x5dc,%eax
+    59d3:	75 3e                	jne    5a13 <inlinetest+0x1cf>
+    59d5:	80 3d a0 2c 01 00 68 	cmpb   $0x68,0x12ca0
+    59dc:	75 35                	jne    5a13 <inlinetest+0x1cf>
+    59de:	80 3d aa 2c 01 00 64 	cmpb   $0x64,0x12caa
+    59e5:	75 2c                	jne    5a13 <inlinetest+0x1cf>
+  for(i = 11; i < 1500; i++)
+    59e7:	81 fb db 05 00 00    	cmp    $0x5db,%ebx
+    59ed:	7f 4d                	jg     5a3c <inlinetest+0x1f8>
+    if((uchar)buf[i] != (uchar)i){
+    59ef:	38 9b a0 2c 01 00    	cmp    %bl,0x12ca0(%ebx)
+    59f5:	75 30                	jne    5a27 <inlinetest+0x1e3>
+  for(i = 11; i < 1500; i++)
+    59f7:	83 c3 01             	add    $0x1,%ebx
+    59fa:	eb eb                	jmp    59e7 <inlinetest+0x1a3>
+    printf(1, "inline: size %d\n", st.size);
+    59fc:	83 ec 04             	sub    $0x4,%esp
+    59ff:	ff 75 e4             	push   -0x1c(%ebp)
+    5a02:	68 dd c3 00 00       	push   $0xc3dd
+    5a07:	6a 01                	push   $0x1
+    5a09:	e8 03 4b 00 00       	call   a511 <printf>
+    exit();
+    5a0e:	e8 c5 45 00 00       	call   9fd8 <exit>
+    printf(1, "inline: lost the inline bytes\n");
+    5a13:	83 ec 08             	sub    $0x8,%esp
+    5a16:	68 44 de 00 00       	push   $0xde44
+    5a1b:	6a 01                	push   $0x1
+    5a1d:	e8 ef 4a 00 00       	call   a511 <printf>
+    exit();
+    5a22:	e8 b1 45 00 00       	call   9fd8 <exit>
+      printf(1, "inline: byte %d wrong\n", i);
+    5a27:	83 ec 04             	sub    $0x4,%esp
+    5a2a:	53                   	push   %ebx
+    5a2b:	68 ee c3 00 00       	push   $0xc3ee
+    5a30:	6a 01                	push   $0x1
+    5a32:	e8 da 4a 00 00       	call   a511 <printf>
+      exit();
+    5a37:	e8 9c 45 00 00       	call   9fd8 <exit>
+  close(fd);
+    5a3c:	83 ec 0c             	sub    $0xc,%esp
+    5a3f:	56                   	push   %esi
+    5a40:	e8 c2 45 00 00       	call   a007 <close>
+  unlink("inl");
+    5a45:	c7 04 24 70 c3 00 00 	movl   $0xc370,(%esp)
+    5a4c:	e8 f6 46 00 00       	call   a147 <unlink>
+  printf(1, "inline test OK\n");
+    5a51:	83 c4 08             	add    $0x8,%esp
+    5a54:	68 05 c4 00 00       	push   $0xc405
+    5a59:	6a 01                	push   $0x1
+    5a5b:	e8 b1 4a 00 00       	call   a511 <printf>
+}
+    5a60:	83 c4 10             	add    $0x10,%esp
+    5a63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    5a66:	5b                   	pop    %ebx
+    5a67:	5e                   	pop    %esi
+    5a68:	5f                   	pop    %edi
+    5a69:	5d                   	pop    %ebp
+    5a6a:	c3                   	ret
+
+00005a6b <malloctest>:
+{
+    5a6b:	55                   	push   %ebp
+    5a6c:	89 e5                	mov    %esp,%ebp
+    5a6e:	56                   	push   %esi
+    5a6f:	53                   	push   %ebx
+  printf(1, "malloc test\n");
+    5a70:	83 ec 08             	sub    $0x8,%esp
+    5a73:	68 15 c4 00 00       	push   $0xc415
+    5a78:	6a 01                	push   $0x1
+    5a7a:	e8 92 4a 00 00       	call   a511 <printf>
+  a = malloc(24);
+    5a7f:	c7 04 24 18 00 00 00 	movl   $0x18,(%esp)
+    5a86:	e8 0c 4e 00 00       	call   a897 <malloc>
+    5a8b:	89 c3                	mov    %eax,%ebx
+  free(a);
+    5a8d:	89 04 24             	mov    %eax,(%esp)
+    5a90:	e8 ab 4d 00 00       	call   a840 <free>
+  if((b = malloc(20)) != a){
+    5a95:	c7 04 24 14 00 00 00 	movl   $0x14,(%esp)
+    5a9c:	e8 f6 4d 00 00       	call   a897 <malloc>
+    5aa1:	83 c4 10             	add    $0x10,%esp
+    5aa4:	39 c3                	cmp    %eax,%ebx
+    5aa6:	75 61                	jne    5b09 <malloctest+0x9e>
+  free(b);
+    5aa8:	83 ec 0c             	sub    $0xc,%esp
+    5aab:	50                   	push   %eax
+    5aac:	e8 8f 4d 00 00       	call   a840 <free>
+  for(i = 0; i < 500; i++){
+    5ab1:	83 c4 10             	add    $0x10,%esp
+    5ab4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    5ab9:	81 fb f3 01 00 00    	cmp    $0x1f3,%ebx
+    5abf:	7f 70                	jg     5b31 <malloctest+0xc6>
+    if((p[i] = malloc(100 + i%50)) == 0){
+    5ac1:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    5ac6:	89 d8                	mov    %ebx,%eax
+    5ac8:	f7 ea                	imul   %edx
+    5aca:	c1 fa 04             	sar    $0x4,%edx
+    5acd:	89 d8                	mov    %ebx,%eax
+    5acf:	c1 f8 1f             	sar    $0x1f,%eax
+    5ad2:	29 c2                	sub    %eax,%edx
+    5ad4:	6b c2 32             	imul   $0x32,%edx,%eax
+    5ad7:	89 da                	mov    %ebx,%edx
+    5ad9:	29 c2                	sub    %eax,%edx
+    5adb:	83 c2 64             	add    $0x64,%edx
+    5ade:	83 ec 0c             	sub    $0xc,%esp
+    5ae1:	52                   	push   %edx
+    5ae2:	e8 b0 4d 00 00       	call   a897 <malloc>
+    5ae7:	89 04 9d c0 92 01 00 	mov    %eax,0x192c0(,%ebx,4)
+    5aee:	83 c4 10             	add    $0x10,%esp
+    5af1:	85 c0                	test   %eax,%eax
+    5af3:	74 28                	je     5b1d <malloctest+0xb2>
+    memset(p[i], i, 100);
+    5af5:	83 ec 04             	sub    $0x4,%esp
+    5af8:	6a 64                	push   $0x64
+    5afa:	53                   	push   %ebx
+    5afb:	50                   	push   %eax
+    5afc:	e8 30 3f 00 00       	call   9a31 <memset>
+  for(i = 0; i < 500; i++){
+    5b01:	83 c3 01             	add    $0x1,%ebx
+    5b04:	83 c4 10             	add    $0x10,%esp
+    5b07:	eb b0                	jmp    5ab9 <malloctest+0x4e>
+    printf(1, "malloc: freed block not reused\n");
+    5b09:	83 ec 08             	sub    $0x8,%esp
+    5b0c:	68 64 de 00 00       	push   $0xde64
+    5b11:	6a 01                	push   $0x1
+    5b13:	e8 f9 49 00 00       	call   a511 <printf>
+    exit();
+    5b18:	e8 bb 44 00 00       	call   9fd8 <exit>
+      printf(1, "malloc: out of memory\n");
+    5b1d:	83 ec 08             	sub    $0x8,%esp
+    5b20:	68 22 c4 00 00       	push   $0xc422
+    5b25:	6a 01                	push   $0x1
+    5b27:	e8 e5 49 00 00       	call   a511 <printf>
+      exit();
+    5b2c:	e8 a7 44 00 00       	call   9fd8 <exit>
+  for(i = 0; i < 500; i++){
+    5b31:	bb 00 00 00 00       	mov    $0x0,%ebx
+    5b36:	eb 0f                	jmp    5b47 <malloctest+0xdc>
+    free(p[i]);
+    5b38:	83 ec 0c             	sub    $0xc,%esp
+    5b3b:	50                   	push   %eax
+    5b3c:	e8 ff 4c 00 00       	call   a840 <free>
+  for(i = 0; i < 500; i++){
+    5b41:	83 c3 01             	add    $0x1,%ebx
+    5b44:	83 c4 10             	add    $0x10,%esp
+    5b47:	81 fb f3 01 00 00    	cmp    $0x1f3,%ebx
+    5b4d:	7f 20                	jg     5b6f <malloctest+0x104>
+    if(p[i][99] != (char)i){
+    5b4f:	8b 04 9d c0 92 01 00 	mov    0x192c0(,%ebx,4),%eax
+    5b56:	38 58 63             	cmp    %bl,0x63(%eax)
+    5b59:	74 dd                	je     5b38 <malloctest+0xcd>
+      printf(1, "malloc: blocks overlap\n");
+    5b5b:	83 ec 08             	sub    $0x8,%esp
+    5b5e:	68 39 c4 00 00       	push   $0xc439
+    5b63:	6a 01                	push   $0x1
+    5b65:	e8 a7 49 00 00       	call   a511 <printf>
+      exit();
+    5b6a:	e8 69 44 00 00       	call   9fd8 <exit>
+  top = sbrk(0);
+    5b6f:	83 ec 0c             	sub    $0xc,%esp
+    5b72:	6a 00                	push   $0x0
+    5b74:	e8 37 46 00 00       	call   a1b0 <sbrk>
+    5b79:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 500; i++)
+    5b7b:	83 c4 10             	add    $0x10,%esp
+    5b7e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    5b83:	eb 33                	jmp    5bb8 <malloctest+0x14d>
+    p[i] = malloc(100 + i%50);
+    5b85:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    5b8a:	89 d8                	mov    %ebx,%eax
+    5b8c:	f7 ea                	imul   %edx
+    5b8e:	c1 fa 04             	sar    $0x4,%edx
+    5b91:	89 d8                	mov    %ebx,%eax
+    5b93:	c1 f8 1f             	sar    $0x1f,%eax
+    5b96:	29 c2                	sub    %eax,%edx
+    5b98:	6b c2 32             	imul   $0x32,%edx,%eax
+    5b9b:	89 da                	mov    %ebx,%edx
+    5b9d:	29 c2                	sub    %eax,%edx
+    5b9f:	83 c2 64             	add    $0x64,%edx
+    5ba2:	83 ec 0c             	sub    $0xc,%esp
+    5ba5:	52                   	push   %edx
+    5ba6:	e8 ec 4c 00 00       	call   a897 <malloc>
+    5bab:	89 04 9d c0 92 01 00 	mov    %eax,0x192c0(,%ebx,4)
+  for(i = 0; i < 500; i++)
+    5bb2:	83 c3 01             	add    $0x1,%ebx
+    5bb5:	83 c4 10             	add    $0x10,%esp
+    5bb8:	81 fb f3 01 00 00    	cmp    $0x1f3,%ebx
+    5bbe:	7e c5                	jle    5b85 <malloctest+0x11a>
+  for(i = 0; i < 500; i++)
+    5bc0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    5bc5:	eb 15                	jmp    5bdc <malloctest+0x171>
+    free(p[i]);
+    5bc7:	83 ec 0c             	sub    $0xc,%esp
+    5bca:	ff 34 9d c0 92 01 00 	push   0x192c0(,%ebx,4)
+    5bd1:	e8 6a 4c 00 00       	call   a840 <free>
+  for(i = 0; i < 500; i++)
+    5bd6:	83 c3 01             	add    $0x1,%ebx
+    5bd9:	83 c4 10             	add    $0x10,%esp
+    5bdc:	81 fb f3 01 00 00    	cmp    $0x1f3,%ebx
+    5be2:	7e e3                	jle    5bc7 <malloctest+0x15c>
+  if(sbrk(0) != top){
+    5be4:	83 ec 0c             	sub    $0xc,%esp
+    5be7:	6a 00                	push   $0x0
+    5be9:	e8 c2 45 00 00       	call   a1b0 <sbrk>
+    5bee:	83 c4 10             	add    $0x10,%esp
+    5bf1:	39 c6                	cmp    %eax,%esi
+    5bf3:	75 6c                	jne    5c61 <malloctest+0x1f6>
+  a = malloc(1024*1024);
+    5bf5:	83 ec 0c             	sub    $0xc,%esp
+    5bf8:	68 00 00 10 00       	push   $0x100000
+    5bfd:	e8 95 4c 00 00       	call   a897 <malloc>
+    5c02:	89 c3                	mov    %eax,%ebx
+  if(a == 0 || sbrk(0) < a + 1024*1024){
+    5c04:	83 c4 10             	add    $0x10,%esp
+    5c07:	85 c0                	test   %eax,%eax
+    5c09:	74 6a                	je     5c75 <malloctest+0x20a>
+    5c0b:	83 ec 0c             	sub    $0xc,%esp
+    5c0e:	6a 00                	push   $0x0
+    5c10:	e8 9b 45 00 00       	call   a1b0 <sbrk>
+    5c15:	8d 93 00 00 10 00    	lea    0x100000(%ebx),%edx
+    5c1b:	83 c4 10             	add    $0x10,%esp
+    5c1e:	39 c2                	cmp    %eax,%edx
+    5c20:	77 53                	ja     5c75 <malloctest+0x20a>
+  a[1024*1024-1] = 1;
+    5c22:	c6 83 ff ff 0f 00 01 	movb   $0x1,0xfffff(%ebx)
+  free(a);
+    5c29:	83 ec 0c             	sub    $0xc,%esp
+    5c2c:	53                   	push   %ebx
+    5c2d:	e8 0e 4c 00 00       	call   a840 <free>
+  if(sbrk(0) - top >= 8){   // less the padding to align it
+    5c32:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    5c39:	e8 72 45 00 00       	call   a1b0 <sbrk>
+    5c3e:	29 f0                	sub    %esi,%eax
+    5c40:	83 c4 10             	add    $0x10,%esp
+    5c43:	83 f8 07             	cmp    $0x7,%eax
+    5c46:	7f 41                	jg     5c89 <malloctest+0x21e>
+  printf(1, "malloc test OK\n");
+    5c48:	83 ec 08             	sub    $0x8,%esp
+    5c4b:	68 51 c4 00 00       	push   $0xc451
+    5c50:	6a 01                	push   $0x1
+    5c52:	e8 ba 48 00 00       	call   a511 <printf>
+}
+    5c57:	83 c4 10             	add    $0x10,%esp
+    5c5a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    5c5d:	5b                   	pop    %ebx
+    5c5e:	5e                   	pop    %esi
+    5c5f:	5d                   	pop    %ebp
+    5c60:	c3                   	ret
+    printf(1, "malloc: heap grew for reused blocks\n");
+    5c61:	83 ec 08             	sub    $0x8,%esp
+    5c64:	68 84 de 00 00       	push   $0xde84
+    5c69:	6a 01                	push   $0x1
+    5c6b:	e8 a1 48 00 00       	call   a511 <printf>
+    exit();
+    5c70:	e8 63 43 00 00       	call   9fd8 <exit>
+    printf(1, "malloc: large block not from sbrk\n");
+    5c75:	83 ec 08             	sub    $0x8,%esp
+    5c78:	68 ac de 00 00       	push   $0xdeac
+    5c7d:	6a 01                	push   $0x1
+    5c7f:	e8 8d 48 00 00       	call   a511 <printf>
+    exit();
+    5c84:	e8 4f 43 00 00       	call   9fd8 <exit>
+    printf(1, "malloc: large block not given back\n");
+    5c89:	83 ec 08             	sub    $0x8,%esp
+    5c8c:	68 d0 de 00 00       	push   $0xded0
+    5c91:	6a 01                	push   $0x1
+    5c93:	e8 79 48 00 00       	call   a511 <printf>
+    exit();
+    5c98:	e8 3b 43 00 00       	call   9fd8 <exit>
+
+00005c9d <lazycopytest>:
+{
+    5c9d:	55                   	push   %ebp
+    5c9e:	89 e5                	mov    %esp,%ebp
+    5ca0:	57                   	push   %edi
+    5ca1:	56                   	push   %esi
+    5ca2:	53                   	push   %ebx
+    5ca3:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "lazy copy test\n");
+    5ca6:	68 61 c4 00 00       	push   $0xc461
+    5cab:	6a 01                	push   $0x1
+    5cad:	e8 5f 48 00 00       	call   a511 <printf>
+  a = sbrk(4*4096);
+    5cb2:	c7 04 24 00 40 00 00 	movl   $0x4000,(%esp)
+    5cb9:	e8 f2 44 00 00       	call   a1b0 <sbrk>
+  if(a == (char*)-1){
+    5cbe:	83 c4 10             	add    $0x10,%esp
+    5cc1:	83 f8 ff             	cmp    $0xffffffff,%eax
+    5cc4:	0f 84 3f 01 00 00    	je     5e09 <lazycopytest+0x16c>
+    5cca:	89 c3                	mov    %eax,%ebx
+  if(pipe(p) < 0 || write(p[1], a + 4096 - 10, 20) != 20 ||
+    5ccc:	83 ec 0c             	sub    $0xc,%esp
+    5ccf:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    5cd2:	50                   	push   %eax
+    5cd3:	e8 15 44 00 00       	call   a0ed <pipe>
+    5cd8:	83 c4 10             	add    $0x10,%esp
+    5cdb:	85 c0                	test   %eax,%eax
+    5cdd:	0f 88 3a 01 00 00    	js     5e1d <lazycopytest+0x180>
+    5ce3:	8d 83 f6 0f 00 00    	lea    0xff6(%ebx),%eax
+    5ce9:	83 ec 04             	sub    $0x4,%esp
+    5cec:	6a 14                	push   $0x14
+    5cee:	50                   	push   %eax
+    5cef:	ff 75 e4             	push   -0x1c(%ebp)
+    5cf2:	e8 14 44 00 00       	call   a10b <write>
+    5cf7:	83 c4 10             	add    $0x10,%esp
+    5cfa:	83 f8 14             	cmp    $0x14,%eax
+    5cfd:	0f 85 1a 01 00 00    	jne    5e1d <lazycopytest+0x180>
+     read(p[0], a + 2*4096 - 10, 20) != 20 || a[2*4096] != 0){
+    5d03:	8d 83 f6 1f 00 00    	lea    0x1ff6(%ebx),%eax
+    5d09:	83 ec 04             	sub    $0x4,%esp
+    5d0c:	6a 14                	push   $0x14
+    5d0e:	50                   	push   %eax
+    5d0f:	ff 75 e0             	push   -0x20(%ebp)
+    5d12:	e8 e5 43 00 00       	call   a0fc <read>
+  if(pipe(p) < 0 || write(p[1], a + 4096 - 10, 20) != 20 ||
+    5d17:	83 c4 10             	add    $0x10,%esp
+    5d1a:	83 f8 14             	cmp    $0x14,%eax
+    5d1d:	0f 85 fa 00 00 00    	jne    5e1d <lazycopytest+0x180>
+     read(p[0], a + 2*4096 - 10, 20) != 20 || a[2*4096] != 0){
+    5d23:	80 bb 00 20 00 00 00 	cmpb   $0x0,0x2000(%ebx)
+    5d2a:	0f 85 ed 00 00 00    	jne    5e1d <lazycopytest+0x180>
+  st = (struct stat*)(a + 3*4096 - 4);
+    5d30:	8d bb fc 2f 00 00    	lea    0x2ffc(%ebx),%edi
+  fd = open("README", O_RDONLY);
+    5d36:	83 ec 08             	sub    $0x8,%esp
+    5d39:	6a 00                	push   $0x0
+    5d3b:	68 e6 be 00 00       	push   $0xbee6
+    5d40:	e8 e4 43 00 00       	call   a129 <open>
+    5d45:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || fstat(fd, st) < 0 || st->type != T_FILE || st->size == 0){
+    5d47:	83 c4 10             	add    $0x10,%esp
+    5d4a:	85 c0                	test   %eax,%eax
+    5d4c:	0f 88 df 00 00 00    	js     5e31 <lazycopytest+0x194>
+    5d52:	83 ec 08             	sub    $0x8,%esp
+    5d55:	57                   	push   %edi
+    5d56:	50                   	push   %eax
+    5d57:	e8 fa 43 00 00       	call   a156 <fstat>
+    5d5c:	83 c4 10             	add    $0x10,%esp
+    5d5f:	85 c0                	test   %eax,%eax
+    5d61:	0f 88 ca 00 00 00    	js     5e31 <lazycopytest+0x194>
+    5d67:	66 83 bb fc 2f 00 00 	cmpw   $0x2,0x2ffc(%ebx)
+    5d6e:	02 
+    5d6f:	0f 85 bc 00 00 00    	jne    5e31 <lazycopytest+0x194>
+    5d75:	83 bb 0c 30 00 00 00 	cmpl   $0x0,0x300c(%ebx)
+    5d7c:	0f 84 af 00 00 00    	je     5e31 <lazycopytest+0x194>
+  cow[0] = 'p';
+    5d82:	c6 05 40 80 01 00 70 	movb   $0x70,0x18040
+  if(fork() == 0){
+    5d89:	e8 36 42 00 00       	call   9fc4 <fork>
+    5d8e:	85 c0                	test   %eax,%eax
+    5d90:	0f 84 af 00 00 00    	je     5e45 <lazycopytest+0x1a8>
+  wait();
+    5d96:	e8 43 43 00 00       	call   a0de <wait>
+  if(cow[0] != 'p'){
+    5d9b:	80 3d 40 80 01 00 70 	cmpb   $0x70,0x18040
+    5da2:	0f 85 e9 00 00 00    	jne    5e91 <lazycopytest+0x1f4>
+  if(read(fd, (char*)lazycopytest, 10) != -1){
+    5da8:	83 ec 04             	sub    $0x4,%esp
+    5dab:	6a 0a                	push   $0xa
+    5dad:	68 9d 5c 00 00       	push   $0x5c9d
+    5db2:	56                   	push   %esi
+    5db3:	e8 44 43 00 00       	call   a0fc <read>
+    5db8:	83 c4 10             	add    $0x10,%esp
+    5dbb:	83 f8 ff             	cmp    $0xffffffff,%eax
+    5dbe:	0f 85 e1 00 00 00    	jne    5ea5 <lazycopytest+0x208>
+  close(fd);
+    5dc4:	83 ec 0c             	sub    $0xc,%esp
+    5dc7:	56                   	push   %esi
+    5dc8:	e8 3a 42 00 00       	call   a007 <close>
+  close(p[0]);
+    5dcd:	83 c4 04             	add    $0x4,%esp
+    5dd0:	ff 75 e0             	push   -0x20(%ebp)
+    5dd3:	e8 2f 42 00 00       	call   a007 <close>
+  close(p[1]);
+    5dd8:	83 c4 04             	add    $0x4,%esp
+    5ddb:	ff 75 e4             	push   -0x1c(%ebp)
+    5dde:	e8 24 42 00 00       	call   a007 <close>
+  sbrk(-4*4096);
+    5de3:	c7 04 24 00 c0 ff ff 	movl   $0xffffc000,(%esp)
+    5dea:	e8 c1 43 00 00       	call   a1b0 <sbrk>
+  printf(1, "lazy copy test OK\n");
+    5def:	83 c4 08             	add    $0x8,%esp
+    5df2:	68 88 c4 00 00       	push   $0xc488
+    5df7:	6a 01                	push   $0x1
+    5df9:	e8 13 47 00 00       	call   a511 <printf>
+}
+    5dfe:	83 c4 10             	add    $0x10,%esp
+    5e01:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    5e04:	5b                   	pop    %ebx
+    5e05:	5e                   	pop    %esi
+    5e06:	5f                   	pop    %edi
+    5e07:	5d                   	pop    %ebp
+    5e08:	c3                   	ret
+    printf(1, "lazycopy: sbrk failed\n");
+    5e09:	83 ec 08             	sub    $0x8,%esp
+    5e0c:	68 71 c4 00 00       	push   $0xc471
+    5e11:	6a 01                	push   $0x1
+    5e13:	e8 f9 46 00 00       	call   a511 <printf>
+    exit();
+    5e18:	e8 bb 41 00 00       	call   9fd8 <exit>
+    printf(1, "lazycopy: pipe through untouched heap failed\n");
+    5e1d:	83 ec 08             	sub    $0x8,%esp
+    5e20:	68 f4 de 00 00       	push   $0xdef4
+    5e25:	6a 01                	push   $0x1
+    5e27:	e8 e5 46 00 00       	call   a511 <printf>
+    exit();
+    5e2c:	e8 a7 41 00 00       	call   9fd8 <exit>
+    printf(1, "lazycopy: fstat into untouched heap failed\n");
+    5e31:	83 ec 08             	sub    $0x8,%esp
+    5e34:	68 24 df 00 00       	push   $0xdf24
+    5e39:	6a 01                	push   $0x1
+    5e3b:	e8 d1 46 00 00       	call   a511 <printf>
+    exit();
+    5e40:	e8 93 41 00 00       	call   9fd8 <exit>
+    write(p[1], "c", 1);
+    5e45:	83 ec 04             	sub    $0x4,%esp
+    5e48:	6a 01                	push   $0x1
+    5e4a:	68 f0 c2 00 00       	push   $0xc2f0
+    5e4f:	ff 75 e4             	push   -0x1c(%ebp)
+    5e52:	e8 b4 42 00 00       	call   a10b <write>
+    if(read(p[0], cow, 1) != 1 || cow[0] != 'c')
+    5e57:	83 c4 0c             	add    $0xc,%esp
+    5e5a:	6a 01                	push   $0x1
+    5e5c:	68 40 80 01 00       	push   $0x18040
+    5e61:	ff 75 e0             	push   -0x20(%ebp)
+    5e64:	e8 93 42 00 00       	call   a0fc <read>
+    5e69:	83 c4 10             	add    $0x10,%esp
+    5e6c:	83 f8 01             	cmp    $0x1,%eax
+    5e6f:	75 09                	jne    5e7a <lazycopytest+0x1dd>
+    5e71:	80 3d 40 80 01 00 63 	cmpb   $0x63,0x18040
+    5e78:	74 12                	je     5e8c <lazycopytest+0x1ef>
+      printf(1, "lazycopy: read into copy-on-write page failed\n");
+    5e7a:	83 ec 08             	sub    $0x8,%esp
+    5e7d:	68 50 df 00 00       	push   $0xdf50
+    5e82:	6a 01                	push   $0x1
+    5e84:	e8 88 46 00 00       	call   a511 <printf>
+    5e89:	83 c4 10             	add    $0x10,%esp
+    exit();
+    5e8c:	e8 47 41 00 00       	call   9fd8 <exit>
+    printf(1, "lazycopy: child's read reached the parent\n");
+    5e91:	83 ec 08             	sub    $0x8,%esp
+    5e94:	68 80 df 00 00       	push   $0xdf80
+    5e99:	6a 01                	push   $0x1
+    5e9b:	e8 71 46 00 00       	call   a511 <printf>
+    exit();
+    5ea0:	e8 33 41 00 00       	call   9fd8 <exit>
+    printf(1, "lazycopy: read into text succeeded\n");
+    5ea5:	83 ec 08             	sub    $0x8,%esp
+    5ea8:	68 ac df 00 00       	push   $0xdfac
+    5ead:	6a 01                	push   $0x1
+    5eaf:	e8 5d 46 00 00       	call   a511 <printf>
+    exit();
+    5eb4:	e8 1f 41 00 00       	call   9fd8 <exit>
+
+00005eb9 <sbrktest>:
+{
+    5eb9:	55                   	push   %ebp
+    5eba:	89 e5                	mov    %esp,%ebp
+    5ebc:	57                   	push   %edi
+    5ebd:	56                   	push   %esi
+    5ebe:	53                   	push   %ebx
+    5ebf:	83 ec 54             	sub    $0x54,%esp
+  printf(stdout, "sbrk test\n");
+    5ec2:	68 9b c4 00 00       	push   $0xc49b
+    5ec7:	ff 35 a4 04 01 00    	push   0x104a4
+    5ecd:	e8 3f 46 00 00       	call   a511 <printf>
+  oldbrk = sbrk(0);
+    5ed2:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    5ed9:	e8 d2 42 00 00       	call   a1b0 <sbrk>
+    5ede:	89 c7                	mov    %eax,%edi
+  a = sbrk(0);
+    5ee0:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    5ee7:	e8 c4 42 00 00       	call   a1b0 <sbrk>
+    5eec:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 5000; i++){
+    5eee:	83 c4 10             	add    $0x10,%esp
+    5ef1:	bb 00 00 00 00       	mov    $0x0,%ebx
+    5ef6:	81 fb 87 13 00 00    	cmp    $0x1387,%ebx
+    5efc:	7f 3a                	jg     5f38 <sbrktest+0x7f>
+    b = sbrk(1);
+    5efe:	83 ec 0c             	sub    $0xc,%esp
+    5f01:	6a 01                	push   $0x1
+    5f03:	e8 a8 42 00 00       	call   a1b0 <sbrk>
+    if(b != a){
+    5f08:	83 c4 10             	add    $0x10,%esp
+    5f0b:	39 c6                	cmp    %eax,%esi
+    5f0d:	75 0b                	jne    5f1a <sbrktest+0x61>
+    *b = 1;
+    5f0f:	c6 00 01             	movb   $0x1,(%eax)
+    a = b + 1;
+    5f12:	8d 70 01             	lea    0x1(%eax),%esi
+  for(i = 0; i < 5000; i++){
+    5f15:	83 c3 01             	add    $0x1,%ebx
+    5f18:	eb dc                	jmp    5ef6 <sbrktest+0x3d>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    5f1a:	83 ec 0c             	sub    $0xc,%esp
+    5f1d:	50                   	push   %eax
+    5f1e:	56                   	push   %esi
+    5f1f:	53                   	push   %ebx
+    5f20:	68 a6 c4 00 00       	push   $0xc4a6
+    5f25:	ff 35 a4 04 01 00    	push   0x104a4
+    5f2b:	e8 e1 45 00 00       	call   a511 <printf>
+      exit();
+    5f30:	83 c4 20             	add    $0x20,%esp
+    5f33:	e8 a0 40 00 00       	call   9fd8 <exit>
+  pid = fork();
+    5f38:	e8 87 40 00 00       	call   9fc4 <fork>
+    5f3d:	89 c3                	mov    %eax,%ebx
+  if(pid < 0){
+    5f3f:	85 c0                	test   %eax,%eax
+    5f41:	0f 88 53 01 00 00    	js     609a <sbrktest+0x1e1>
+  c = sbrk(1);
+    5f47:	83 ec 0c             	sub    $0xc,%esp
+    5f4a:	6a 01                	push   $0x1
+    5f4c:	e8 5f 42 00 00       	call   a1b0 <sbrk>
+  c = sbrk(1);
+    5f51:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    5f58:	e8 53 42 00 00       	call   a1b0 <sbrk>
+  if(c != a + 1){
+    5f5d:	83 c6 01             	add    $0x1,%esi
+    5f60:	83 c4 10             	add    $0x10,%esp
+    5f63:	39 c6                	cmp    %eax,%esi
+    5f65:	0f 85 47 01 00 00    	jne    60b2 <sbrktest+0x1f9>
+  if(pid == 0)
+    5f6b:	85 db                	test   %ebx,%ebx
+    5f6d:	0f 84 57 01 00 00    	je     60ca <sbrktest+0x211>
+  wait();
+    5f73:	e8 66 41 00 00       	call   a0de <wait>
+  a = sbrk(0);
+    5f78:	83 ec 0c             	sub    $0xc,%esp
+    5f7b:	6a 00                	push   $0x0
+    5f7d:	e8 2e 42 00 00       	call   a1b0 <sbrk>
+    5f82:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    5f84:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    5f89:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    5f8b:	89 04 24             	mov    %eax,(%esp)
+    5f8e:	e8 1d 42 00 00       	call   a1b0 <sbrk>
+  if (p != a) {
+    5f93:	83 c4 10             	add    $0x10,%esp
+    5f96:	39 c3                	cmp    %eax,%ebx
+    5f98:	0f 85 31 01 00 00    	jne    60cf <sbrktest+0x216>
+  *lastaddr = 99;
+    5f9e:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+  a = sbrk(0);
+    5fa5:	83 ec 0c             	sub    $0xc,%esp
+    5fa8:	6a 00                	push   $0x0
+    5faa:	e8 01 42 00 00       	call   a1b0 <sbrk>
+    5faf:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    5fb1:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+    5fb8:	e8 f3 41 00 00       	call   a1b0 <sbrk>
+  if(c == (char*)0xffffffff){
+    5fbd:	83 c4 10             	add    $0x10,%esp
+    5fc0:	83 f8 ff             	cmp    $0xffffffff,%eax
+    5fc3:	0f 84 1e 01 00 00    	je     60e7 <sbrktest+0x22e>
+  c = sbrk(0);
+    5fc9:	83 ec 0c             	sub    $0xc,%esp
+    5fcc:	6a 00                	push   $0x0
+    5fce:	e8 dd 41 00 00       	call   a1b0 <sbrk>
+  if(c != a - 4096){
+    5fd3:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    5fd9:	83 c4 10             	add    $0x10,%esp
+    5fdc:	39 c2                	cmp    %eax,%edx
+    5fde:	0f 85 1b 01 00 00    	jne    60ff <sbrktest+0x246>
+  a = sbrk(0);
+    5fe4:	83 ec 0c             	sub    $0xc,%esp
+    5fe7:	6a 00                	push   $0x0
+    5fe9:	e8 c2 41 00 00       	call   a1b0 <sbrk>
+    5fee:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    5ff0:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+    5ff7:	e8 b4 41 00 00       	call   a1b0 <sbrk>
+    5ffc:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    5ffe:	83 c4 10             	add    $0x10,%esp
+    6001:	39 c3                	cmp    %eax,%ebx
+    6003:	0f 85 0d 01 00 00    	jne    6116 <sbrktest+0x25d>
+    6009:	83 ec 0c             	sub    $0xc,%esp
+    600c:	6a 00                	push   $0x0
+    600e:	e8 9d 41 00 00       	call   a1b0 <sbrk>
+    6013:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    6019:	83 c4 10             	add    $0x10,%esp
+    601c:	39 c2                	cmp    %eax,%edx
+    601e:	0f 85 f2 00 00 00    	jne    6116 <sbrktest+0x25d>
+  if(*lastaddr == 99){
+    6024:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    602b:	0f 84 fc 00 00 00    	je     612d <sbrktest+0x274>
+  a = sbrk(0);
+    6031:	83 ec 0c             	sub    $0xc,%esp
+    6034:	6a 00                	push   $0x0
+    6036:	e8 75 41 00 00       	call   a1b0 <sbrk>
+    603b:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    603d:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    6044:	e8 67 41 00 00       	call   a1b0 <sbrk>
+    6049:	89 c2                	mov    %eax,%edx
+    604b:	89 f8                	mov    %edi,%eax
+    604d:	29 d0                	sub    %edx,%eax
+    604f:	89 04 24             	mov    %eax,(%esp)
+    6052:	e8 59 41 00 00       	call   a1b0 <sbrk>
+  if(c != a){
+    6057:	83 c4 10             	add    $0x10,%esp
+    605a:	39 c3                	cmp    %eax,%ebx
+    605c:	0f 85 e3 00 00 00    	jne    6145 <sbrktest+0x28c>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    6062:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    6067:	81 fb 7f 84 1e 80    	cmp    $0x801e847f,%ebx
+    606d:	0f 87 23 01 00 00    	ja     6196 <sbrktest+0x2dd>
+    ppid = getpid();
+    6073:	e8 29 41 00 00       	call   a1a1 <getpid>
+    6078:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    607a:	e8 45 3f 00 00       	call   9fc4 <fork>
+    if(pid < 0){
+    607f:	85 c0                	test   %eax,%eax
+    6081:	0f 88 d5 00 00 00    	js     615c <sbrktest+0x2a3>
+    if(pid == 0){
+    6087:	0f 84 e7 00 00 00    	je     6174 <sbrktest+0x2bb>
+    wait();
+    608d:	e8 4c 40 00 00       	call   a0de <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    6092:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    6098:	eb cd                	jmp    6067 <sbrktest+0x1ae>
+    printf(stdout, "sbrk test fork failed\n");
+    609a:	83 ec 08             	sub    $0x8,%esp
+    609d:	68 c1 c4 00 00       	push   $0xc4c1
+    60a2:	ff 35 a4 04 01 00    	push   0x104a4
+    60a8:	e8 64 44 00 00       	call   a511 <printf>
+    exit();
+    60ad:	e8 26 3f 00 00       	call   9fd8 <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    60b2:	83 ec 08             	sub    $0x8,%esp
+    60b5:	68 d8 c4 00 00       	push   $0xc4d8
+    60ba:	ff 35 a4 04 01 00    	push   0x104a4
+    60c0:	e8 4c 44 00 00       	call   a511 <printf>
+    exit();
+    60c5:	e8 0e 3f 00 00       	call   9fd8 <exit>
+    exit();
+    60ca:	e8 09 3f 00 00       	call   9fd8 <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    60cf:	83 ec 08             	sub    $0x8,%esp
+    60d2:	68 d0 df 00 00       	push   $0xdfd0
+    60d7:	ff 35 a4 04 01 00    	push   0x104a4
+    60dd:	e8 2f 44 00 00       	call   a511 <printf>
+    exit();
+    60e2:	e8 f1 3e 00 00       	call   9fd8 <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    60e7:	83 ec 08             	sub    $0x8,%esp
+    60ea:	68 f4 c4 00 00       	push   $0xc4f4
+    60ef:	ff 35 a4 04 01 00    	push   0x104a4
+    60f5:	e8 17 44 00 00       	call   a511 <printf>
+    exit();
+    60fa:	e8 d9 3e 00 00       	call   9fd8 <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    60ff:	50                   	push   %eax
+    6100:	53                   	push   %ebx
+    6101:	68 10 e0 00 00       	push   $0xe010
+    6106:	ff 35 a4 04 01 00    	push   0x104a4
+    610c:	e8 00 44 00 00       	call   a511 <printf>
+    exit();
+    6111:	e8 c2 3e 00 00       	call   9fd8 <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    6116:	56                   	push   %esi
+    6117:	53                   	push   %ebx
+    6118:	68 48 e0 00 00       	push   $0xe048
+    611d:	ff 35 a4 04 01 00    	push   0x104a4
+    6123:	e8 e9 43 00 00       	call   a511 <printf>
+    exit();
+    6128:	e8 ab 3e 00 00       	call   9fd8 <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    612d:	83 ec 08             	sub    $0x8,%esp
+    6130:	68 70 e0 00 00       	push   $0xe070
+    6135:	ff 35 a4 04 01 00    	push   0x104a4
+    613b:	e8 d1 43 00 00       	call   a511 <printf>
+    exit();
+    6140:	e8 93 3e 00 00       	call   9fd8 <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    6145:	50                   	push   %eax
+    6146:	53                   	push   %ebx
+    6147:	68 a0 e0 00 00       	push   $0xe0a0
+    614c:	ff 35 a4 04 01 00    	push   0x104a4
+    6152:	e8 ba 43 00 00       	call   a511 <printf>
+    exit();
+    6157:	e8 7c 3e 00 00       	call   9fd8 <exit>
+      printf(stdout, "fork failed\n");
+    615c:	83 ec 08             	sub    $0x8,%esp
+    615f:	68 b6 be 00 00       	push   $0xbeb6
+    6164:	ff 35 a4 04 01 00    	push   0x104a4
+    616a:	e8 a2 43 00 00       	call   a511 <printf>
+      exit();
+    616f:	e8 64 3e 00 00       	call   9fd8 <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    6174:	0f be 03             	movsbl (%ebx),%eax
+    6177:	50                   	push   %eax
+    6178:	53                   	push   %ebx
+    6179:	68 0f c5 00 00       	push   $0xc50f
+    617e:	ff 35 a4 04 01 00    	push   0x104a4
+    6184:	e8 88 43 00 00       	call   a511 <printf>
+      kill(ppid);
+    6189:	89 34 24             	mov    %esi,(%esp)
+    618c:	e8 89 3f 00 00       	call   a11a <kill>
+      exit();
+    6191:	e8 42 3e 00 00       	call   9fd8 <exit>
+  if(pipe(fds) != 0){
+    6196:	83 ec 0c             	sub    $0xc,%esp
+    6199:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    619c:	50                   	push   %eax
+    619d:	e8 4b 3f 00 00       	call   a0ed <pipe>
+    61a2:	89 c3                	mov    %eax,%ebx
+    61a4:	83 c4 10             	add    $0x10,%esp
+    61a7:	85 c0                	test   %eax,%eax
+    61a9:	75 04                	jne    61af <sbrktest+0x2f6>
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    61ab:	89 c6                	mov    %eax,%esi
+    61ad:	eb 59                	jmp    6208 <sbrktest+0x34f>
+    printf(1, "pipe() failed\n");
+    61af:	83 ec 08             	sub    $0x8,%esp
+    61b2:	68 2f b3 00 00       	push   $0xb32f
+    61b7:	6a 01                	push   $0x1
+    61b9:	e8 53 43 00 00       	call   a511 <printf>
+    exit();
+    61be:	e8 15 3e 00 00       	call   9fd8 <exit>
+      sbrk(BIG - (uint)sbrk(0));
+    61c3:	83 ec 0c             	sub    $0xc,%esp
+    61c6:	6a 00                	push   $0x0
+    61c8:	e8 e3 3f 00 00       	call   a1b0 <sbrk>
+    61cd:	89 c2                	mov    %eax,%edx
+    61cf:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    61d4:	29 d0                	sub    %edx,%eax
+    61d6:	89 04 24             	mov    %eax,(%esp)
+    61d9:	e8 d2 3f 00 00       	call   a1b0 <sbrk>
+      write(fds[1], "x", 1);
+    61de:	83 c4 0c             	add    $0xc,%esp
+    61e1:	6a 01                	push   $0x1
+    61e3:	68 72 bb 00 00       	push   $0xbb72
+    61e8:	ff 75 e4             	push   -0x1c(%ebp)
+    61eb:	e8 1b 3f 00 00       	call   a10b <write>
+    61f0:	83 c4 10             	add    $0x10,%esp
+      for(;;) sleep(1000);
+    61f3:	83 ec 0c             	sub    $0xc,%esp
+    61f6:	68 e8 03 00 00       	push   $0x3e8
+    61fb:	e8 bf 3f 00 00       	call   a1bf <sleep>
+    6200:	83 c4 10             	add    $0x10,%esp
+    6203:	eb ee                	jmp    61f3 <sbrktest+0x33a>
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    6205:	83 c6 01             	add    $0x1,%esi
+    6208:	83 fe 09             	cmp    $0x9,%esi
+    620b:	77 28                	ja     6235 <sbrktest+0x37c>
+    if((pids[i] = fork()) == 0){
+    620d:	e8 b2 3d 00 00       	call   9fc4 <fork>
+    6212:	89 44 b5 b8          	mov    %eax,-0x48(%ebp,%esi,4)
+    6216:	85 c0                	test   %eax,%eax
+    6218:	74 a9                	je     61c3 <sbrktest+0x30a>
+    if(pids[i] != -1)
+    621a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    621d:	74 e6                	je     6205 <sbrktest+0x34c>
+      read(fds[0], &scratch, 1);
+    621f:	83 ec 04             	sub    $0x4,%esp
+    6222:	6a 01                	push   $0x1
+    6224:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    6227:	50                   	push   %eax
+    6228:	ff 75 e0             	push   -0x20(%ebp)
+    622b:	e8 cc 3e 00 00       	call   a0fc <read>
+    6230:	83 c4 10             	add    $0x10,%esp
+    6233:	eb d0                	jmp    6205 <sbrktest+0x34c>
+  c = sbrk(4096);
+    6235:	83 ec 0c             	sub    $0xc,%esp
+    6238:	68 00 10 00 00       	push   $0x1000
+    623d:	e8 6e 3f 00 00       	call   a1b0 <sbrk>
+    6242:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    6244:	83 c4 10             	add    $0x10,%esp
+    6247:	eb 03                	jmp    624c <sbrktest+0x393>
+    6249:	83 c3 01             	add    $0x1,%ebx
+    624c:	83 fb 09             	cmp    $0x9,%ebx
+    624f:	77 1c                	ja     626d <sbrktest+0x3b4>
+    if(pids[i] == -1)
+    6251:	8b 44 9d b8          	mov    -0x48(%ebp,%ebx,4),%eax
+    6255:	83 f8 ff             	cmp    $0xffffffff,%eax
+    6258:	74 ef                	je     6249 <sbrktest+0x390>
+    kill(pids[i]);
+    625a:	83 ec 0c             	sub    $0xc,%esp
+    625d:	50                   	push   %eax
+    625e:	e8 b7 3e 00 00       	call   a11a <kill>
+    wait();
+    6263:	e8 76 3e 00 00       	call   a0de <wait>
+    6268:	83 c4 10             	add    $0x10,%esp
+    626b:	eb dc                	jmp    6249 <sbrktest+0x390>
+  if(c == (char*)0xffffffff){
+    626d:	83 fe ff             	cmp    $0xffffffff,%esi
+    6270:	74 2f                	je     62a1 <sbrktest+0x3e8>
+  if(sbrk(0) > oldbrk)
+    6272:	83 ec 0c             	sub    $0xc,%esp
+    6275:	6a 00                	push   $0x0
+    6277:	e8 34 3f 00 00       	call   a1b0 <sbrk>
+    627c:	83 c4 10             	add    $0x10,%esp
+    627f:	39 c7                	cmp    %eax,%edi
+    6281:	72 36                	jb     62b9 <sbrktest+0x400>
+  printf(stdout, "sbrk test OK\n");
+    6283:	83 ec 08             	sub    $0x8,%esp
+    6286:	68 43 c5 00 00       	push   $0xc543
+    628b:	ff 35 a4 04 01 00    	push   0x104a4
+    6291:	e8 7b 42 00 00       	call   a511 <printf>
+}
+    6296:	83 c4 10             	add    $0x10,%esp
+    6299:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    629c:	5b                   	pop    %ebx
+    629d:	5e                   	pop    %esi
+    629e:	5f                   	pop    %edi
+    629f:	5d                   	pop    %ebp
+    62a0:	c3                   	ret
+    printf(stdout, "failed sbrk leaked memory\n");
+    62a1:	83 ec 08             	sub    $0x8,%esp
+    62a4:	68 28 c5 00 00       	push   $0xc528
+    62a9:	ff 35 a4 04 01 00    	push   0x104a4
+    62af:	e8 5d 42 00 00       	call   a511 <printf>
+    exit();
+    62b4:	e8 1f 3d 00 00       	call   9fd8 <exit>
+    sbrk(-(sbrk(0) - oldbrk));
+    62b9:	83 ec 0c             	sub    $0xc,%esp
+    62bc:	6a 00                	push   $0x0
+    62be:	e8 ed 3e 00 00       	call   a1b0 <sbrk>
+    62c3:	29 c7                	sub    %eax,%edi
+    62c5:	89 3c 24             	mov    %edi,(%esp)
+    62c8:	e8 e3 3e 00 00       	call   a1b0 <sbrk>
+    62cd:	83 c4 10             	add    $0x10,%esp
+    62d0:	eb b1                	jmp    6283 <sbrktest+0x3ca>
+
+000062d2 <argptest>:
+
+void argptest()
+{
+    62d2:	55                   	push   %ebp
+    62d3:	89 e5                	mov    %esp,%ebp
+    62d5:	53                   	push   %ebx
+    62d6:	83 ec 0c             	sub    $0xc,%esp
+  int fd;
+  fd = open("init", O_RDONLY);
+    62d9:	6a 00                	push   $0x0
+    62db:	68 51 c5 00 00       	push   $0xc551
+    62e0:	e8 44 3e 00 00       	call   a129 <open>
+  if (fd < 0) {
+    62e5:	83 c4 10             	add    $0x10,%esp
+    62e8:	85 c0                	test   %eax,%eax
+    62ea:	78 3a                	js     6326 <argptest+0x54>
+    62ec:	89 c3                	mov    %eax,%ebx
+    printf(2, "open failed\n");
+    exit();
+  }
+  read(fd, sbrk(0) - 1, -1);
+    62ee:	83 ec 0c             	sub    $0xc,%esp
+    62f1:	6a 00                	push   $0x0
+    62f3:	e8 b8 3e 00 00       	call   a1b0 <sbrk>
+    62f8:	83 e8 01             	sub    $0x1,%eax
+    62fb:	83 c4 0c             	add    $0xc,%esp
+    62fe:	6a ff                	push   $0xffffffff
+    6300:	50                   	push   %eax
+    6301:	53                   	push   %ebx
+    6302:	e8 f5 3d 00 00       	call   a0fc <read>
+  close(fd);
+    6307:	89 1c 24             	mov    %ebx,(%esp)
+    630a:	e8 f8 3c 00 00       	call   a007 <close>
+  printf(1, "arg test passed\n");
+    630f:	83 c4 08             	add    $0x8,%esp
+    6312:	68 56 c5 00 00       	push   $0xc556
+    6317:	6a 01                	push   $0x1
+    6319:	e8 f3 41 00 00       	call   a511 <printf>
+}
+    631e:	83 c4 10             	add    $0x10,%esp
+    6321:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    6324:	c9                   	leave
+    6325:	c3                   	ret
+    printf(2, "open failed\n");
+    6326:	83 ec 08             	sub    $0x8,%esp
+    6329:	68 a2 b2 00 00       	push   $0xb2a2
+    632e:	6a 02                	push   $0x2
+    6330:	e8 dc 41 00 00       	call   a511 <printf>
+    exit();
+    6335:	e8 9e 3c 00 00       	call   9fd8 <exit>
+
+0000633a <stringtest>:
+{
+    633a:	55                   	push   %ebp
+    633b:	89 e5                	mov    %esp,%ebp
+    633d:	57                   	push   %edi
+    633e:	56                   	push   %esi
+    633f:	53                   	push   %ebx
+    6340:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "string test\n");
+    6343:	68 67 c5 00 00       	push   $0xc567
+    6348:	6a 01                	push   $0x1
+    634a:	e8 c2 41 00 00       	call   a511 <printf>
+  for(off = 0; off < 8; off++){
+    634f:	83 c4 10             	add    $0x10,%esp
+    6352:	be 00 00 00 00       	mov    $0x0,%esi
+    6357:	e9 fa 00 00 00       	jmp    6456 <stringtest+0x11c>
+        a[i] = i;
+    635c:	88 80 80 91 01 00    	mov    %al,0x19180(%eax)
+      for(i = 0; i < sizeof(a); i++)
+    6362:	83 c0 01             	add    $0x1,%eax
+    6365:	3d 2b 01 00 00       	cmp    $0x12b,%eax
+    636a:	76 f0                	jbe    635c <stringtest+0x22>
+      memmove(a + 100 + off, a + 100, n);     // overlapping, up
+    636c:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+    636f:	8d be e4 91 01 00    	lea    0x191e4(%esi),%edi
+    6375:	83 ec 04             	sub    $0x4,%esp
+    6378:	53                   	push   %ebx
+    6379:	68 e4 91 01 00       	push   $0x191e4
+    637e:	57                   	push   %edi
+    637f:	e8 83 38 00 00       	call   9c07 <memmove>
+      for(i = 0; i < n; i++)
+    6384:	83 c4 10             	add    $0x10,%esp
+    6387:	b8 00 00 00 00       	mov    $0x0,%eax
+    638c:	39 d8                	cmp    %ebx,%eax
+    638e:	7d 15                	jge    63a5 <stringtest+0x6b>
+        if(a[100 + off + i] != (char)(100 + i))
+    6390:	8d 50 64             	lea    0x64(%eax),%edx
+    6393:	38 94 30 e4 91 01 00 	cmp    %dl,0x191e4(%eax,%esi,1)
+    639a:	0f 85 cb 01 00 00    	jne    656b <stringtest+0x231>
+      for(i = 0; i < n; i++)
+    63a0:	83 c0 01             	add    $0x1,%eax
+    63a3:	eb e7                	jmp    638c <stringtest+0x52>
+      for(i = 0; i < sizeof(a); i++)
+    63a5:	b8 00 00 00 00       	mov    $0x0,%eax
+    63aa:	3d 2b 01 00 00       	cmp    $0x12b,%eax
+    63af:	77 0b                	ja     63bc <stringtest+0x82>
+        a[i] = i;
+    63b1:	88 80 80 91 01 00    	mov    %al,0x19180(%eax)
+      for(i = 0; i < sizeof(a); i++)
+    63b7:	83 c0 01             	add    $0x1,%eax
+    63ba:	eb ee                	jmp    63aa <stringtest+0x70>
+      memmove(a + 100, a + 100 + off, n);     // overlapping, down
+    63bc:	83 ec 04             	sub    $0x4,%esp
+    63bf:	53                   	push   %ebx
+    63c0:	57                   	push   %edi
+    63c1:	68 e4 91 01 00       	push   $0x191e4
+    63c6:	e8 3c 38 00 00       	call   9c07 <memmove>
+      for(i = 0; i < n; i++)
+    63cb:	83 c4 10             	add    $0x10,%esp
+    63ce:	b8 00 00 00 00       	mov    $0x0,%eax
+    63d3:	39 d8                	cmp    %ebx,%eax
+    63d5:	7d 15                	jge    63ec <stringtest+0xb2>
+        if(a[100 + i] != (char)(100 + off + i))
+    63d7:	8d 54 06 64          	lea    0x64(%esi,%eax,1),%edx
+    63db:	38 90 e4 91 01 00    	cmp    %dl,0x191e4(%eax)
+    63e1:	0f 85 84 01 00 00    	jne    656b <stringtest+0x231>
+      for(i = 0; i < n; i++)
+    63e7:	83 c0 01             	add    $0x1,%eax
+    63ea:	eb e7                	jmp    63d3 <stringtest+0x99>
+      memset(b, 0, sizeof(b));
+    63ec:	83 ec 04             	sub    $0x4,%esp
+    63ef:	68 2c 01 00 00       	push   $0x12c
+    63f4:	6a 00                	push   $0x0
+    63f6:	68 40 90 01 00       	push   $0x19040
+    63fb:	e8 31 36 00 00       	call   9a31 <memset>
+      memset(b + off, 'x', n);
+    6400:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    6403:	81 c7 40 90 01 00    	add    $0x19040,%edi
+    6409:	83 c4 0c             	add    $0xc,%esp
+    640c:	53                   	push   %ebx
+    640d:	6a 78                	push   $0x78
+    640f:	57                   	push   %edi
+    6410:	e8 1c 36 00 00       	call   9a31 <memset>
+      b[off + n] = 0;
+    6415:	c6 84 1e 40 90 01 00 	movb   $0x0,0x19040(%esi,%ebx,1)
+    641c:	00 
+      if(strlen(b + off) != n || (off > 0 && b[off-1] != 0))
+    641d:	89 3c 24             	mov    %edi,(%esp)
+    6420:	e8 c7 35 00 00       	call   99ec <strlen>
+    6425:	83 c4 10             	add    $0x10,%esp
+    6428:	39 c3                	cmp    %eax,%ebx
+    642a:	0f 85 3b 01 00 00    	jne    656b <stringtest+0x231>
+    6430:	85 f6                	test   %esi,%esi
+    6432:	7e 0d                	jle    6441 <stringtest+0x107>
+    6434:	80 be 3f 90 01 00 00 	cmpb   $0x0,0x1903f(%esi)
+    643b:	0f 85 2a 01 00 00    	jne    656b <stringtest+0x231>
+    for(n = 0; n < 70; n += 7){
+    6441:	83 c3 07             	add    $0x7,%ebx
+    6444:	83 fb 45             	cmp    $0x45,%ebx
+    6447:	7f 0a                	jg     6453 <stringtest+0x119>
+      for(i = 0; i < sizeof(a); i++)
+    6449:	b8 00 00 00 00       	mov    $0x0,%eax
+    644e:	e9 12 ff ff ff       	jmp    6365 <stringtest+0x2b>
+  for(off = 0; off < 8; off++){
+    6453:	83 c6 01             	add    $0x1,%esi
+    6456:	83 fe 07             	cmp    $0x7,%esi
+    6459:	7f 07                	jg     6462 <stringtest+0x128>
+    for(n = 0; n < 70; n += 7){
+    645b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    6460:	eb e2                	jmp    6444 <stringtest+0x10a>
+  for(i = 0; i < sizeof(a); i++)
+    6462:	b8 00 00 00 00       	mov    $0x0,%eax
+    6467:	eb 12                	jmp    647b <stringtest+0x141>
+    a[i] = i * 7;
+    6469:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    6470:	29 c2                	sub    %eax,%edx
+    6472:	88 90 80 91 01 00    	mov    %dl,0x19180(%eax)
+  for(i = 0; i < sizeof(a); i++)
+    6478:	83 c0 01             	add    $0x1,%eax
+    647b:	3d 2b 01 00 00       	cmp    $0x12b,%eax
+    6480:	76 e7                	jbe    6469 <stringtest+0x12f>
+  fd = open("string0", O_CREATE|O_RDWR);
+    6482:	83 ec 08             	sub    $0x8,%esp
+    6485:	68 02 02 00 00       	push   $0x202
+    648a:	68 74 c5 00 00       	push   $0xc574
+    648f:	e8 95 3c 00 00       	call   a129 <open>
+    6494:	89 c7                	mov    %eax,%edi
+  if(fd < 0 || write(fd, a + 3, 257) != 257){
+    6496:	83 c4 10             	add    $0x10,%esp
+    6499:	85 c0                	test   %eax,%eax
+    649b:	0f 88 a2 00 00 00    	js     6543 <stringtest+0x209>
+    64a1:	83 ec 04             	sub    $0x4,%esp
+    64a4:	68 01 01 00 00       	push   $0x101
+    64a9:	68 83 91 01 00       	push   $0x19183
+    64ae:	50                   	push   %eax
+    64af:	e8 57 3c 00 00       	call   a10b <write>
+    64b4:	83 c4 10             	add    $0x10,%esp
+    64b7:	3d 01 01 00 00       	cmp    $0x101,%eax
+    64bc:	0f 85 81 00 00 00    	jne    6543 <stringtest+0x209>
+  close(fd);
+    64c2:	83 ec 0c             	sub    $0xc,%esp
+    64c5:	57                   	push   %edi
+    64c6:	e8 3c 3b 00 00       	call   a007 <close>
+  fd = open("string0", O_RDONLY);
+    64cb:	83 c4 08             	add    $0x8,%esp
+    64ce:	6a 00                	push   $0x0
+    64d0:	68 74 c5 00 00       	push   $0xc574
+    64d5:	e8 4f 3c 00 00       	call   a129 <open>
+    64da:	89 c7                	mov    %eax,%edi
+  if(read(fd, b + 1, 257) != 257){
+    64dc:	83 c4 0c             	add    $0xc,%esp
+    64df:	68 01 01 00 00       	push   $0x101
+    64e4:	68 41 90 01 00       	push   $0x19041
+    64e9:	50                   	push   %eax
+    64ea:	e8 0d 3c 00 00       	call   a0fc <read>
+    64ef:	83 c4 10             	add    $0x10,%esp
+    64f2:	3d 01 01 00 00       	cmp    $0x101,%eax
+    64f7:	75 5e                	jne    6557 <stringtest+0x21d>
+  close(fd);
+    64f9:	83 ec 0c             	sub    $0xc,%esp
+    64fc:	57                   	push   %edi
+    64fd:	e8 05 3b 00 00       	call   a007 <close>
+  unlink("string0");
+    6502:	c7 04 24 74 c5 00 00 	movl   $0xc574,(%esp)
+    6509:	e8 39 3c 00 00       	call   a147 <unlink>
+  if(memcmp(a + 3, b + 1, 257) != 0)
+    650e:	83 c4 0c             	add    $0xc,%esp
+    6511:	68 01 01 00 00       	push   $0x101
+    6516:	68 41 90 01 00       	push   $0x19041
+    651b:	68 83 91 01 00       	push   $0x19183
+    6520:	e8 98 35 00 00       	call   9abd <memcmp>
+    6525:	83 c4 10             	add    $0x10,%esp
+    6528:	85 c0                	test   %eax,%eax
+    652a:	75 3f                	jne    656b <stringtest+0x231>
+  printf(1, "string test OK\n");
+    652c:	83 ec 08             	sub    $0x8,%esp
+    652f:	68 a7 c5 00 00       	push   $0xc5a7
+    6534:	6a 01                	push   $0x1
+    6536:	e8 d6 3f 00 00       	call   a511 <printf>
+}
+    653b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    653e:	5b                   	pop    %ebx
+    653f:	5e                   	pop    %esi
+    6540:	5f                   	pop    %edi
+    6541:	5d                   	pop    %ebp
+    6542:	c3                   	ret
+    printf(1, "string: write failed\n");
+    6543:	83 ec 08             	sub    $0x8,%esp
+    6546:	68 7c c5 00 00       	push   $0xc57c
+    654b:	6a 01                	push   $0x1
+    654d:	e8 bf 3f 00 00       	call   a511 <printf>
+    exit();
+    6552:	e8 81 3a 00 00       	call   9fd8 <exit>
+    printf(1, "string: read failed\n");
+    6557:	83 ec 08             	sub    $0x8,%esp
+    655a:	68 92 c5 00 00       	push   $0xc592
+    655f:	6a 01                	push   $0x1
+    6561:	e8 ab 3f 00 00       	call   a511 <printf>
+    exit();
+    6566:	e8 6d 3a 00 00       	call   9fd8 <exit>
+  printf(1, "string: copy wrong at offset %d, %d bytes\n", off, n);
+    656b:	53                   	push   %ebx
+    656c:	56                   	push   %esi
+    656d:	68 c4 e0 00 00       	push   $0xe0c4
+    6572:	6a 01                	push   $0x1
+    6574:	e8 98 3f 00 00       	call   a511 <printf>
+  exit();
+    6579:	e8 5a 3a 00 00       	call   9fd8 <exit>
+
+0000657e <greptest>:
+{
+    657e:	55                   	push   %ebp
+    657f:	89 e5                	mov    %esp,%ebp
+    6581:	56                   	push   %esi
+    6582:	53                   	push   %ebx
+  printf(1, "grep test\n");
+    6583:	83 ec 08             	sub    $0x8,%esp
+    6586:	68 b7 c5 00 00       	push   $0xc5b7
+    658b:	6a 01                	push   $0x1
+    658d:	e8 7f 3f 00 00       	call   a511 <printf>
+  if((fd = open("grepf", O_CREATE|O_RDWR)) < 0){
+    6592:	83 c4 08             	add    $0x8,%esp
+    6595:	68 02 02 00 00       	push   $0x202
+    659a:	68 c2 c5 00 00       	push   $0xc5c2
+    659f:	e8 85 3b 00 00       	call   a129 <open>
+    65a4:	83 c4 10             	add    $0x10,%esp
+    65a7:	85 c0                	test   %eax,%eax
+    65a9:	78 09                	js     65b4 <greptest+0x36>
+    65ab:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 40; i++)
+    65ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+    65b2:	eb 2a                	jmp    65de <greptest+0x60>
+    printf(1, "grep: create failed\n");
+    65b4:	83 ec 08             	sub    $0x8,%esp
+    65b7:	68 c8 c5 00 00       	push   $0xc5c8
+    65bc:	6a 01                	push   $0x1
+    65be:	e8 4e 3f 00 00       	call   a511 <printf>
+    exit();
+    65c3:	e8 10 3a 00 00       	call   9fd8 <exit>
+    write(fd, "a", 1);
+    65c8:	83 ec 04             	sub    $0x4,%esp
+    65cb:	6a 01                	push   $0x1
+    65cd:	68 b9 ae 00 00       	push   $0xaeb9
+    65d2:	56                   	push   %esi
+    65d3:	e8 33 3b 00 00       	call   a10b <write>
+  for(i = 0; i < 40; i++)
+    65d8:	83 c3 01             	add    $0x1,%ebx
+    65db:	83 c4 10             	add    $0x10,%esp
+    65de:	83 fb 27             	cmp    $0x27,%ebx
+    65e1:	7e e5                	jle    65c8 <greptest+0x4a>
+  printf(fd, "c\nxaab\nb\nccc\nab");
+    65e3:	83 ec 08             	sub    $0x8,%esp
+    65e6:	68 dd c5 00 00       	push   $0xc5dd
+    65eb:	56                   	push   %esi
+    65ec:	e8 20 3f 00 00       	call   a511 <printf>
+  close(fd);
+    65f1:	89 34 24             	mov    %esi,(%esp)
+    65f4:	e8 0e 3a 00 00       	call   a007 <close>
+  if(fork() == 0){
+    65f9:	e8 c6 39 00 00       	call   9fc4 <fork>
+    65fe:	83 c4 10             	add    $0x10,%esp
+    6601:	85 c0                	test   %eax,%eax
+    6603:	75 40                	jne    6645 <greptest+0xc7>
+    close(1);
+    6605:	83 ec 0c             	sub    $0xc,%esp
+    6608:	6a 01                	push   $0x1
+    660a:	e8 f8 39 00 00       	call   a007 <close>
+    if(open("grepout", O_CREATE|O_RDWR) != 1)
+    660f:	83 c4 08             	add    $0x8,%esp
+    6612:	68 02 02 00 00       	push   $0x202
+    6617:	68 ed c5 00 00       	push   $0xc5ed
+    661c:	e8 08 3b 00 00       	call   a129 <open>
+    6621:	83 c4 10             	add    $0x10,%esp
+    6624:	83 f8 01             	cmp    $0x1,%eax
+    6627:	74 05                	je     662e <greptest+0xb0>
+      exit();
+    6629:	e8 aa 39 00 00       	call   9fd8 <exit>
+    exec("grep", args);
+    662e:	83 ec 08             	sub    $0x8,%esp
+    6631:	68 c0 00 01 00       	push   $0x100c0
+    6636:	68 f5 c5 00 00       	push   $0xc5f5
+    663b:	e8 aa 39 00 00       	call   9fea <exec>
+    exit();
+    6640:	e8 93 39 00 00       	call   9fd8 <exit>
+  wait();
+    6645:	e8 94 3a 00 00       	call   a0de <wait>
+  fd = open("grepout", 0);
+    664a:	83 ec 08             	sub    $0x8,%esp
+    664d:	6a 00                	push   $0x0
+    664f:	68 ed c5 00 00       	push   $0xc5ed
+    6654:	e8 d0 3a 00 00       	call   a129 <open>
+    6659:	89 c6                	mov    %eax,%esi
+  n = read(fd, buf, sizeof(buf));
+    665b:	83 c4 0c             	add    $0xc,%esp
+    665e:	68 00 20 00 00       	push   $0x2000
+    6663:	68 a0 2c 01 00       	push   $0x12ca0
+    6668:	50                   	push   %eax
+    6669:	e8 8e 3a 00 00       	call   a0fc <read>
+    666e:	89 c3                	mov    %eax,%ebx
+  close(fd);
+    6670:	89 34 24             	mov    %esi,(%esp)
+    6673:	e8 8f 39 00 00       	call   a007 <close>
+  unlink("grepf");
+    6678:	c7 04 24 c2 c5 00 00 	movl   $0xc5c2,(%esp)
+    667f:	e8 c3 3a 00 00       	call   a147 <unlink>
+  unlink("grepout");
+    6684:	c7 04 24 ed c5 00 00 	movl   $0xc5ed,(%esp)
+    668b:	e8 b7 3a 00 00       	call   a147 <unlink>
+  if(n != strlen(want) || memcmp(buf, want, n) != 0){
+    6690:	c7 04 24 fa c5 00 00 	movl   $0xc5fa,(%esp)
+    6697:	e8 50 33 00 00       	call   99ec <strlen>
+    669c:	83 c4 10             	add    $0x10,%esp
+    669f:	39 d8                	cmp    %ebx,%eax
+    66a1:	75 33                	jne    66d6 <greptest+0x158>
+    66a3:	83 ec 04             	sub    $0x4,%esp
+    66a6:	53                   	push   %ebx
+    66a7:	68 fa c5 00 00       	push   $0xc5fa
+    66ac:	68 a0 2c 01 00       	push   $0x12ca0
+    66b1:	e8 07 34 00 00       	call   9abd <memcmp>
+    66b6:	83 c4 10             	add    $0x10,%esp
+    66b9:	85 c0                	test   %eax,%eax
+    66bb:	75 19                	jne    66d6 <greptest+0x158>
+  printf(1, "grep test OK\n");
+    66bd:	83 ec 08             	sub    $0x8,%esp
+    66c0:	68 05 c6 00 00       	push   $0xc605
+    66c5:	6a 01                	push   $0x1
+    66c7:	e8 45 3e 00 00       	call   a511 <printf>
+}
+    66cc:	83 c4 10             	add    $0x10,%esp
+    66cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    66d2:	5b                   	pop    %ebx
+    66d3:	5e                   	pop    %esi
+    66d4:	5d                   	pop    %ebp
+    66d5:	c3                   	ret
+    printf(1, "grep: printed %d bytes, not the %d wanted\n", n, strlen(want));
+    66d6:	83 ec 0c             	sub    $0xc,%esp
+    66d9:	68 fa c5 00 00       	push   $0xc5fa
+    66de:	e8 09 33 00 00       	call   99ec <strlen>
+    66e3:	50                   	push   %eax
+    66e4:	53                   	push   %ebx
+    66e5:	68 f0 e0 00 00       	push   $0xe0f0
+    66ea:	6a 01                	push   $0x1
+    66ec:	e8 20 3e 00 00       	call   a511 <printf>
+    exit();
+    66f1:	83 c4 20             	add    $0x20,%esp
+    66f4:	e8 df 38 00 00       	call   9fd8 <exit>
+
+000066f9 <myrss>:
+{
+    66f9:	55                   	push   %ebp
+    66fa:	89 e5                	mov    %esp,%ebp
+    66fc:	56                   	push   %esi
+    66fd:	53                   	push   %ebx
+    66fe:	83 ec 70             	sub    $0x70,%esp
+  for(i = 0; getprocinfo(i, &pi) == 0; i++)
+    6701:	bb 00 00 00 00       	mov    $0x0,%ebx
+    6706:	eb 03                	jmp    670b <myrss+0x12>
+    6708:	83 c3 01             	add    $0x1,%ebx
+    670b:	83 ec 08             	sub    $0x8,%esp
+    670e:	8d 45 90             	lea    -0x70(%ebp),%eax
+    6711:	50                   	push   %eax
+    6712:	53                   	push   %ebx
+    6713:	e8 4c 3b 00 00       	call   a264 <getprocinfo>
+    6718:	83 c4 10             	add    $0x10,%esp
+    671b:	85 c0                	test   %eax,%eax
+    671d:	75 11                	jne    6730 <myrss+0x37>
+    if(pi.pid == getpid())
+    671f:	8b 75 90             	mov    -0x70(%ebp),%esi
+    6722:	e8 7a 3a 00 00       	call   a1a1 <getpid>
+    6727:	39 c6                	cmp    %eax,%esi
+    6729:	75 dd                	jne    6708 <myrss+0xf>
+      return pi.rss;
+    672b:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    672e:	eb 05                	jmp    6735 <myrss+0x3c>
+  return -1;
+    6730:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    6735:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    6738:	5b                   	pop    %ebx
+    6739:	5e                   	pop    %esi
+    673a:	5d                   	pop    %ebp
+    673b:	c3                   	ret
+
+0000673c <rsstest>:
+{
+    673c:	55                   	push   %ebp
+    673d:	89 e5                	mov    %esp,%ebp
+    673f:	56                   	push   %esi
+    6740:	53                   	push   %ebx
+    6741:	83 ec 28             	sub    $0x28,%esp
+  printf(1, "rss test\n");
+    6744:	68 13 c6 00 00       	push   $0xc613
+    6749:	6a 01                	push   $0x1
+    674b:	e8 c1 3d 00 00       	call   a511 <printf>
+  if(memstat(&m) < 0 || m.total == 0 || m.used + m.free != m.total ||
+    6750:	8d 45 e8             	lea    -0x18(%ebp),%eax
+    6753:	89 04 24             	mov    %eax,(%esp)
+    6756:	e8 8f 3c 00 00       	call   a3ea <memstat>
+    675b:	83 c4 10             	add    $0x10,%esp
+    675e:	85 c0                	test   %eax,%eax
+    6760:	78 48                	js     67aa <rsstest+0x6e>
+    6762:	8b 55 e8             	mov    -0x18(%ebp),%edx
+    6765:	85 d2                	test   %edx,%edx
+    6767:	74 41                	je     67aa <rsstest+0x6e>
+    6769:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    676c:	89 c1                	mov    %eax,%ecx
+    676e:	03 4d f0             	add    -0x10(%ebp),%ecx
+    6771:	39 ca                	cmp    %ecx,%edx
+    6773:	75 35                	jne    67aa <rsstest+0x6e>
+    6775:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    6778:	72 30                	jb     67aa <rsstest+0x6e>
+  before = myrss();
+    677a:	e8 7a ff ff ff       	call   66f9 <myrss>
+    677f:	89 c6                	mov    %eax,%esi
+  a = sbrk(8*4096);
+    6781:	83 ec 0c             	sub    $0xc,%esp
+    6784:	68 00 80 00 00       	push   $0x8000
+    6789:	e8 22 3a 00 00       	call   a1b0 <sbrk>
+    678e:	89 c3                	mov    %eax,%ebx
+  if(a == (char*)-1){
+    6790:	83 c4 10             	add    $0x10,%esp
+    6793:	83 f8 ff             	cmp    $0xffffffff,%eax
+    6796:	74 26                	je     67be <rsstest+0x82>
+  if(myrss() != before){
+    6798:	e8 5c ff ff ff       	call   66f9 <myrss>
+    679d:	39 f0                	cmp    %esi,%eax
+    679f:	75 31                	jne    67d2 <rsstest+0x96>
+  for(i = 0; i < 8; i++)
+    67a1:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    67a8:	eb 48                	jmp    67f2 <rsstest+0xb6>
+    printf(1, "rss: memstat counters wrong\n");
+    67aa:	83 ec 08             	sub    $0x8,%esp
+    67ad:	68 1d c6 00 00       	push   $0xc61d
+    67b2:	6a 01                	push   $0x1
+    67b4:	e8 58 3d 00 00       	call   a511 <printf>
+    exit();
+    67b9:	e8 1a 38 00 00       	call   9fd8 <exit>
+    printf(1, "rss: sbrk failed\n");
+    67be:	83 ec 08             	sub    $0x8,%esp
+    67c1:	68 3a c6 00 00       	push   $0xc63a
+    67c6:	6a 01                	push   $0x1
+    67c8:	e8 44 3d 00 00       	call   a511 <printf>
+    exit();
+    67cd:	e8 06 38 00 00       	call   9fd8 <exit>
+    printf(1, "rss: sbrk alone made pages resident\n");
+    67d2:	83 ec 08             	sub    $0x8,%esp
+    67d5:	68 1c e1 00 00       	push   $0xe11c
+    67da:	6a 01                	push   $0x1
+    67dc:	e8 30 3d 00 00       	call   a511 <printf>
+    exit();
+    67e1:	e8 f2 37 00 00       	call   9fd8 <exit>
+    a[i*4096] = i;
+    67e6:	89 c2                	mov    %eax,%edx
+    67e8:	c1 e2 0c             	shl    $0xc,%edx
+    67eb:	88 04 13             	mov    %al,(%ebx,%edx,1)
+  for(i = 0; i < 8; i++)
+    67ee:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+    67f2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    67f5:	83 f8 07             	cmp    $0x7,%eax
+    67f8:	7e ec                	jle    67e6 <rsstest+0xaa>
+  after = myrss();
+    67fa:	e8 fa fe ff ff       	call   66f9 <myrss>
+  if(after < before + 8){
+    67ff:	8d 56 07             	lea    0x7(%esi),%edx
+    6802:	39 c2                	cmp    %eax,%edx
+    6804:	0f 8d 9d 00 00 00    	jge    68a7 <rsstest+0x16b>
+  if(pipe(fds) < 0){
+    680a:	83 ec 0c             	sub    $0xc,%esp
+    680d:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    6810:	50                   	push   %eax
+    6811:	e8 d7 38 00 00       	call   a0ed <pipe>
+    6816:	83 c4 10             	add    $0x10,%esp
+    6819:	85 c0                	test   %eax,%eax
+    681b:	0f 88 99 00 00 00    	js     68ba <rsstest+0x17e>
+  after = myrss();
+    6821:	e8 d3 fe ff ff       	call   66f9 <myrss>
+    6826:	89 c3                	mov    %eax,%ebx
+  if(fork() == 0){
+    6828:	e8 97 37 00 00       	call   9fc4 <fork>
+    682d:	85 c0                	test   %eax,%eax
+    682f:	0f 84 99 00 00 00    	je     68ce <rsstest+0x192>
+  wait();
+    6835:	e8 a4 38 00 00       	call   a0de <wait>
+  if(read(fds[0], &i, sizeof(i)) != sizeof(i) || i != after){
+    683a:	83 ec 04             	sub    $0x4,%esp
+    683d:	6a 04                	push   $0x4
+    683f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    6842:	50                   	push   %eax
+    6843:	ff 75 dc             	push   -0x24(%ebp)
+    6846:	e8 b1 38 00 00       	call   a0fc <read>
+    684b:	83 c4 10             	add    $0x10,%esp
+    684e:	83 f8 04             	cmp    $0x4,%eax
+    6851:	0f 85 95 00 00 00    	jne    68ec <rsstest+0x1b0>
+    6857:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+    685a:	0f 85 8c 00 00 00    	jne    68ec <rsstest+0x1b0>
+  close(fds[0]);
+    6860:	83 ec 0c             	sub    $0xc,%esp
+    6863:	ff 75 dc             	push   -0x24(%ebp)
+    6866:	e8 9c 37 00 00       	call   a007 <close>
+  close(fds[1]);
+    686b:	83 c4 04             	add    $0x4,%esp
+    686e:	ff 75 e0             	push   -0x20(%ebp)
+    6871:	e8 91 37 00 00       	call   a007 <close>
+  sbrk(-8*4096);
+    6876:	c7 04 24 00 80 ff ff 	movl   $0xffff8000,(%esp)
+    687d:	e8 2e 39 00 00       	call   a1b0 <sbrk>
+  if(myrss() > before){
+    6882:	e8 72 fe ff ff       	call   66f9 <myrss>
+    6887:	83 c4 10             	add    $0x10,%esp
+    688a:	39 f0                	cmp    %esi,%eax
+    688c:	7f 73                	jg     6901 <rsstest+0x1c5>
+  printf(1, "rss test OK\n");
+    688e:	83 ec 08             	sub    $0x8,%esp
+    6891:	68 5e c6 00 00       	push   $0xc65e
+    6896:	6a 01                	push   $0x1
+    6898:	e8 74 3c 00 00       	call   a511 <printf>
+}
+    689d:	83 c4 10             	add    $0x10,%esp
+    68a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    68a3:	5b                   	pop    %ebx
+    68a4:	5e                   	pop    %esi
+    68a5:	5d                   	pop    %ebp
+    68a6:	c3                   	ret
+    printf(1, "rss: %d pages resident after touching 8, %d before\n",
+    68a7:	56                   	push   %esi
+    68a8:	50                   	push   %eax
+    68a9:	68 44 e1 00 00       	push   $0xe144
+    68ae:	6a 01                	push   $0x1
+    68b0:	e8 5c 3c 00 00       	call   a511 <printf>
+    exit();
+    68b5:	e8 1e 37 00 00       	call   9fd8 <exit>
+    printf(1, "rss: pipe failed\n");
+    68ba:	83 ec 08             	sub    $0x8,%esp
+    68bd:	68 4c c6 00 00       	push   $0xc64c
+    68c2:	6a 01                	push   $0x1
+    68c4:	e8 48 3c 00 00       	call   a511 <printf>
+    exit();
+    68c9:	e8 0a 37 00 00       	call   9fd8 <exit>
+    i = myrss();
+    68ce:	e8 26 fe ff ff       	call   66f9 <myrss>
+    68d3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    write(fds[1], &i, sizeof(i));
+    68d6:	83 ec 04             	sub    $0x4,%esp
+    68d9:	6a 04                	push   $0x4
+    68db:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    68de:	50                   	push   %eax
+    68df:	ff 75 e0             	push   -0x20(%ebp)
+    68e2:	e8 24 38 00 00       	call   a10b <write>
+    exit();
+    68e7:	e8 ec 36 00 00       	call   9fd8 <exit>
+    printf(1, "rss: child started with %d pages, parent has %d\n", i, after);
+    68ec:	53                   	push   %ebx
+    68ed:	ff 75 e4             	push   -0x1c(%ebp)
+    68f0:	68 78 e1 00 00       	push   $0xe178
+    68f5:	6a 01                	push   $0x1
+    68f7:	e8 15 3c 00 00       	call   a511 <printf>
+    exit();
+    68fc:	e8 d7 36 00 00       	call   9fd8 <exit>
+    printf(1, "rss: pages still counted after sbrk(-)\n");
+    6901:	83 ec 08             	sub    $0x8,%esp
+    6904:	68 ac e1 00 00       	push   $0xe1ac
+    6909:	6a 01                	push   $0x1
+    690b:	e8 01 3c 00 00       	call   a511 <printf>
+    exit();
+    6910:	e8 c3 36 00 00       	call   9fd8 <exit>
+
+00006915 <groupcommittest>:
+{
+    6915:	55                   	push   %ebp
+    6916:	89 e5                	mov    %esp,%ebp
+    6918:	57                   	push   %edi
+    6919:	56                   	push   %esi
+    691a:	53                   	push   %ebx
+    691b:	81 ec 84 00 00 00    	sub    $0x84,%esp
+  printf(1, "group commit test\n");
+    6921:	68 6b c6 00 00       	push   $0xc66b
+    6926:	6a 01                	push   $0x1
+    6928:	e8 e4 3b 00 00       	call   a511 <printf>
+  for(i = 0; getprocinfo(i, &pi) == 0; i++)
+    692d:	83 c4 10             	add    $0x10,%esp
+  flusher = -1;
+    6930:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  for(i = 0; getprocinfo(i, &pi) == 0; i++)
+    6935:	bb 00 00 00 00       	mov    $0x0,%ebx
+    693a:	eb 03                	jmp    693f <groupcommittest+0x2a>
+    693c:	83 c3 01             	add    $0x1,%ebx
+    693f:	83 ec 08             	sub    $0x8,%esp
+    6942:	8d 45 80             	lea    -0x80(%ebp),%eax
+    6945:	50                   	push   %eax
+    6946:	53                   	push   %ebx
+    6947:	e8 18 39 00 00       	call   a264 <getprocinfo>
+    694c:	83 c4 10             	add    $0x10,%esp
+    694f:	85 c0                	test   %eax,%eax
+    6951:	75 1d                	jne    6970 <groupcommittest+0x5b>
+    if(strcmp(pi.name, "logflush") == 0)
+    6953:	83 ec 08             	sub    $0x8,%esp
+    6956:	68 7e c6 00 00       	push   $0xc67e
+    695b:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    695e:	50                   	push   %eax
+    695f:	e8 62 30 00 00       	call   99c6 <strcmp>
+    6964:	83 c4 10             	add    $0x10,%esp
+    6967:	85 c0                	test   %eax,%eax
+    6969:	75 d1                	jne    693c <groupcommittest+0x27>
+      flusher = pi.pid;
+    696b:	8b 75 80             	mov    -0x80(%ebp),%esi
+    696e:	eb cc                	jmp    693c <groupcommittest+0x27>
+  if(flusher < 0 || kill(flusher) != -1){
+    6970:	85 f6                	test   %esi,%esi
+    6972:	0f 88 ab 00 00 00    	js     6a23 <groupcommittest+0x10e>
+    6978:	83 ec 0c             	sub    $0xc,%esp
+    697b:	56                   	push   %esi
+    697c:	e8 99 37 00 00       	call   a11a <kill>
+    6981:	83 c4 10             	add    $0x10,%esp
+    6984:	83 f8 ff             	cmp    $0xffffffff,%eax
+    6987:	0f 85 96 00 00 00    	jne    6a23 <groupcommittest+0x10e>
+  for(i = 0; i < 4; i++){
+    698d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    6992:	83 fb 03             	cmp    $0x3,%ebx
+    6995:	0f 8f 9b 01 00 00    	jg     6b36 <groupcommittest+0x221>
+    if((pid = fork()) < 0){
+    699b:	e8 24 36 00 00       	call   9fc4 <fork>
+    69a0:	89 c6                	mov    %eax,%esi
+    69a2:	85 c0                	test   %eax,%eax
+    69a4:	0f 88 8d 00 00 00    	js     6a37 <groupcommittest+0x122>
+    if(pid)
+    69aa:	0f 85 9b 00 00 00    	jne    6a4b <groupcommittest+0x136>
+    file[0] = 'g';
+    69b0:	c6 85 7c ff ff ff 67 	movb   $0x67,-0x84(%ebp)
+    file[1] = '0' + i;
+    69b7:	83 c3 30             	add    $0x30,%ebx
+    69ba:	88 9d 7d ff ff ff    	mov    %bl,-0x83(%ebp)
+    file[3] = 0;
+    69c0:	c6 85 7f ff ff ff 00 	movb   $0x0,-0x81(%ebp)
+    for(j = 0; j < 20; j++){
+    69c7:	89 c7                	mov    %eax,%edi
+    69c9:	83 ff 13             	cmp    $0x13,%edi
+    69cc:	0f 8f d2 00 00 00    	jg     6aa4 <groupcommittest+0x18f>
+      file[2] = 'a' + j;
+    69d2:	8d 47 61             	lea    0x61(%edi),%eax
+    69d5:	88 85 7e ff ff ff    	mov    %al,-0x82(%ebp)
+      if((fd = open(file, O_CREATE|O_RDWR)) < 0 || write(fd, file, 4) != 4){
+    69db:	83 ec 08             	sub    $0x8,%esp
+    69de:	68 02 02 00 00       	push   $0x202
+    69e3:	8d 85 7c ff ff ff    	lea    -0x84(%ebp),%eax
+    69e9:	50                   	push   %eax
+    69ea:	e8 3a 37 00 00       	call   a129 <open>
+    69ef:	89 c3                	mov    %eax,%ebx
+    69f1:	83 c4 10             	add    $0x10,%esp
+    69f4:	85 c0                	test   %eax,%eax
+    69f6:	78 5b                	js     6a53 <groupcommittest+0x13e>
+    69f8:	83 ec 04             	sub    $0x4,%esp
+    69fb:	6a 04                	push   $0x4
+    69fd:	8d 85 7c ff ff ff    	lea    -0x84(%ebp),%eax
+    6a03:	50                   	push   %eax
+    6a04:	53                   	push   %ebx
+    6a05:	e8 01 37 00 00       	call   a10b <write>
+    6a0a:	83 c4 10             	add    $0x10,%esp
+    6a0d:	83 f8 04             	cmp    $0x4,%eax
+    6a10:	75 41                	jne    6a53 <groupcommittest+0x13e>
+      close(fd);
+    6a12:	83 ec 0c             	sub    $0xc,%esp
+    6a15:	53                   	push   %ebx
+    6a16:	e8 ec 35 00 00       	call   a007 <close>
+    for(j = 0; j < 20; j++){
+    6a1b:	83 c7 01             	add    $0x1,%edi
+    6a1e:	83 c4 10             	add    $0x10,%esp
+    6a21:	eb a6                	jmp    69c9 <groupcommittest+0xb4>
+    printf(1, "groupcommit: no log flusher, or it can be killed\n");
+    6a23:	83 ec 08             	sub    $0x8,%esp
+    6a26:	68 d4 e1 00 00       	push   $0xe1d4
+    6a2b:	6a 01                	push   $0x1
+    6a2d:	e8 df 3a 00 00       	call   a511 <printf>
+    exit();
+    6a32:	e8 a1 35 00 00       	call   9fd8 <exit>
+      printf(1, "groupcommit: fork failed\n");
+    6a37:	83 ec 08             	sub    $0x8,%esp
+    6a3a:	68 87 c6 00 00       	push   $0xc687
+    6a3f:	6a 01                	push   $0x1
+    6a41:	e8 cb 3a 00 00       	call   a511 <printf>
+      exit();
+    6a46:	e8 8d 35 00 00       	call   9fd8 <exit>
+  for(i = 0; i < 4; i++){
+    6a4b:	83 c3 01             	add    $0x1,%ebx
+    6a4e:	e9 3f ff ff ff       	jmp    6992 <groupcommittest+0x7d>
+        printf(1, "groupcommit: create %s failed\n", file);
+    6a53:	83 ec 04             	sub    $0x4,%esp
+    6a56:	8d 85 7c ff ff ff    	lea    -0x84(%ebp),%eax
+    6a5c:	50                   	push   %eax
+    6a5d:	68 08 e2 00 00       	push   $0xe208
+    6a62:	6a 01                	push   $0x1
+    6a64:	e8 a8 3a 00 00       	call   a511 <printf>
+        exit();
+    6a69:	e8 6a 35 00 00       	call   9fd8 <exit>
+        printf(1, "groupcommit: %s lost its data\n", file);
+    6a6e:	83 ec 04             	sub    $0x4,%esp
+    6a71:	8d 85 7c ff ff ff    	lea    -0x84(%ebp),%eax
+    6a77:	50                   	push   %eax
+    6a78:	68 28 e2 00 00       	push   $0xe228
+    6a7d:	6a 01                	push   $0x1
+    6a7f:	e8 8d 3a 00 00       	call   a511 <printf>
+        exit();
+    6a84:	e8 4f 35 00 00       	call   9fd8 <exit>
+        printf(1, "groupcommit: unlink %s failed\n", file);
+    6a89:	83 ec 04             	sub    $0x4,%esp
+    6a8c:	8d 85 7c ff ff ff    	lea    -0x84(%ebp),%eax
+    6a92:	50                   	push   %eax
+    6a93:	68 48 e2 00 00       	push   $0xe248
+    6a98:	6a 01                	push   $0x1
+    6a9a:	e8 72 3a 00 00       	call   a511 <printf>
+        exit();
+    6a9f:	e8 34 35 00 00       	call   9fd8 <exit>
+    for(j = 0; j < 20; j++){
+    6aa4:	83 fe 13             	cmp    $0x13,%esi
+    6aa7:	0f 8f 84 00 00 00    	jg     6b31 <groupcommittest+0x21c>
+      file[2] = 'a' + j;
+    6aad:	8d 46 61             	lea    0x61(%esi),%eax
+    6ab0:	88 85 7e ff ff ff    	mov    %al,-0x82(%ebp)
+      if((fd = open(file, 0)) < 0 || read(fd, buf, 4) != 4 ||
+    6ab6:	83 ec 08             	sub    $0x8,%esp
+    6ab9:	6a 00                	push   $0x0
+    6abb:	8d 85 7c ff ff ff    	lea    -0x84(%ebp),%eax
+    6ac1:	50                   	push   %eax
+    6ac2:	e8 62 36 00 00       	call   a129 <open>
+    6ac7:	89 c3                	mov    %eax,%ebx
+    6ac9:	83 c4 10             	add    $0x10,%esp
+    6acc:	85 c0                	test   %eax,%eax
+    6ace:	78 9e                	js     6a6e <groupcommittest+0x159>
+    6ad0:	83 ec 04             	sub    $0x4,%esp
+    6ad3:	6a 04                	push   $0x4
+    6ad5:	68 a0 2c 01 00       	push   $0x12ca0
+    6ada:	50                   	push   %eax
+    6adb:	e8 1c 36 00 00       	call   a0fc <read>
+    6ae0:	83 c4 10             	add    $0x10,%esp
+    6ae3:	83 f8 04             	cmp    $0x4,%eax
+    6ae6:	75 86                	jne    6a6e <groupcommittest+0x159>
+         strcmp(buf, file) != 0){
+    6ae8:	83 ec 08             	sub    $0x8,%esp
+    6aeb:	8d 85 7c ff ff ff    	lea    -0x84(%ebp),%eax
+    6af1:	50                   	push   %eax
+    6af2:	68 a0 2c 01 00       	push   $0x12ca0
+    6af7:	e8 ca 2e 00 00       	call   99c6 <strcmp>
+      if((fd = open(file, 0)) < 0 || read(fd, buf, 4) != 4 ||
+    6afc:	83 c4 10             	add    $0x10,%esp
+    6aff:	85 c0                	test   %eax,%eax
+    6b01:	0f 85 67 ff ff ff    	jne    6a6e <groupcommittest+0x159>
+      close(fd);
+    6b07:	83 ec 0c             	sub    $0xc,%esp
+    6b0a:	53                   	push   %ebx
+    6b0b:	e8 f7 34 00 00       	call   a007 <close>
+      if(unlink(file) < 0){
+    6b10:	8d 85 7c ff ff ff    	lea    -0x84(%ebp),%eax
+    6b16:	89 04 24             	mov    %eax,(%esp)
+    6b19:	e8 29 36 00 00       	call   a147 <unlink>
+    6b1e:	83 c4 10             	add    $0x10,%esp
+    6b21:	85 c0                	test   %eax,%eax
+    6b23:	0f 88 60 ff ff ff    	js     6a89 <groupcommittest+0x174>
+    for(j = 0; j < 20; j++){
+    6b29:	83 c6 01             	add    $0x1,%esi
+    6b2c:	e9 73 ff ff ff       	jmp    6aa4 <groupcommittest+0x18f>
+    exit();
+    6b31:	e8 a2 34 00 00       	call   9fd8 <exit>
+  for(i = 0; i < 4; i++)
+    6b36:	bb 00 00 00 00       	mov    $0x0,%ebx
+    6b3b:	eb 08                	jmp    6b45 <groupcommittest+0x230>
+    wait();
+    6b3d:	e8 9c 35 00 00       	call   a0de <wait>
+  for(i = 0; i < 4; i++)
+    6b42:	83 c3 01             	add    $0x1,%ebx
+    6b45:	83 fb 03             	cmp    $0x3,%ebx
+    6b48:	7e f3                	jle    6b3d <groupcommittest+0x228>
+  printf(1, "group commit test OK\n");
+    6b4a:	83 ec 08             	sub    $0x8,%esp
+    6b4d:	68 a1 c6 00 00       	push   $0xc6a1
+    6b52:	6a 01                	push   $0x1
+    6b54:	e8 b8 39 00 00       	call   a511 <printf>
+}
+    6b59:	83 c4 10             	add    $0x10,%esp
+    6b5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    6b5f:	5b                   	pop    %ebx
+    6b60:	5e                   	pop    %esi
+    6b61:	5f                   	pop    %edi
+    6b62:	5d                   	pop    %ebp
+    6b63:	c3                   	ret
+
+00006b64 <procinfotest>:
+{
+    6b64:	55                   	push   %ebp
+    6b65:	89 e5                	mov    %esp,%ebp
+    6b67:	56                   	push   %esi
+    6b68:	53                   	push   %ebx
+    6b69:	81 ec 88 00 00 00    	sub    $0x88,%esp
+  printf(1, "procinfo test\n");
+    6b6f:	68 b7 c6 00 00       	push   $0xc6b7
+    6b74:	6a 01                	push   $0x1
+    6b76:	e8 96 39 00 00       	call   a511 <printf>
+  if(pipe(fds) != 0){
+    6b7b:	8d 45 88             	lea    -0x78(%ebp),%eax
+    6b7e:	89 04 24             	mov    %eax,(%esp)
+    6b81:	e8 67 35 00 00       	call   a0ed <pipe>
+    6b86:	83 c4 10             	add    $0x10,%esp
+    6b89:	85 c0                	test   %eax,%eax
+    6b8b:	75 38                	jne    6bc5 <procinfotest+0x61>
+    6b8d:	89 c3                	mov    %eax,%ebx
+  pid = fork();
+    6b8f:	e8 30 34 00 00       	call   9fc4 <fork>
+    6b94:	89 c6                	mov    %eax,%esi
+  if(pid == 0){
+    6b96:	85 c0                	test   %eax,%eax
+    6b98:	74 3f                	je     6bd9 <procinfotest+0x75>
+  sleep(2);
+    6b9a:	83 ec 0c             	sub    $0xc,%esp
+    6b9d:	6a 02                	push   $0x2
+    6b9f:	e8 1b 36 00 00       	call   a1bf <sleep>
+  for(i = 0; getprocinfo(i, &pi) == 0; i++)
+    6ba4:	83 c4 10             	add    $0x10,%esp
+    6ba7:	83 ec 08             	sub    $0x8,%esp
+    6baa:	8d 45 90             	lea    -0x70(%ebp),%eax
+    6bad:	50                   	push   %eax
+    6bae:	53                   	push   %ebx
+    6baf:	e8 b0 36 00 00       	call   a264 <getprocinfo>
+    6bb4:	83 c4 10             	add    $0x10,%esp
+    6bb7:	85 c0                	test   %eax,%eax
+    6bb9:	75 34                	jne    6bef <procinfotest+0x8b>
+    if(pi.pid == pid)
+    6bbb:	39 75 90             	cmp    %esi,-0x70(%ebp)
+    6bbe:	74 2f                	je     6bef <procinfotest+0x8b>
+  for(i = 0; getprocinfo(i, &pi) == 0; i++)
+    6bc0:	83 c3 01             	add    $0x1,%ebx
+    6bc3:	eb e2                	jmp    6ba7 <procinfotest+0x43>
+    printf(1, "procinfo: pipe failed\n");
+    6bc5:	83 ec 08             	sub    $0x8,%esp
+    6bc8:	68 c6 c6 00 00       	push   $0xc6c6
+    6bcd:	6a 01                	push   $0x1
+    6bcf:	e8 3d 39 00 00       	call   a511 <printf>
+    exit();
+    6bd4:	e8 ff 33 00 00       	call   9fd8 <exit>
+    read(fds[0], &c, 1);
+    6bd9:	83 ec 04             	sub    $0x4,%esp
+    6bdc:	6a 01                	push   $0x1
+    6bde:	8d 45 87             	lea    -0x79(%ebp),%eax
+    6be1:	50                   	push   %eax
+    6be2:	ff 75 88             	push   -0x78(%ebp)
+    6be5:	e8 12 35 00 00       	call   a0fc <read>
+    exit();
+    6bea:	e8 e9 33 00 00       	call   9fd8 <exit>
+  write(fds[1], "x", 1);
+    6bef:	83 ec 04             	sub    $0x4,%esp
+    6bf2:	6a 01                	push   $0x1
+    6bf4:	68 72 bb 00 00       	push   $0xbb72
+    6bf9:	ff 75 8c             	push   -0x74(%ebp)
+    6bfc:	e8 0a 35 00 00       	call   a10b <write>
+  wait();
+    6c01:	e8 d8 34 00 00       	call   a0de <wait>
+  close(fds[0]);
+    6c06:	83 c4 04             	add    $0x4,%esp
+    6c09:	ff 75 88             	push   -0x78(%ebp)
+    6c0c:	e8 f6 33 00 00       	call   a007 <close>
+  close(fds[1]);
+    6c11:	83 c4 04             	add    $0x4,%esp
+    6c14:	ff 75 8c             	push   -0x74(%ebp)
+    6c17:	e8 eb 33 00 00       	call   a007 <close>
+  if(pi.pid != pid || pi.ppid != getpid() || pi.nvcsw == 0){
+    6c1c:	83 c4 10             	add    $0x10,%esp
+    6c1f:	39 75 90             	cmp    %esi,-0x70(%ebp)
+    6c22:	75 41                	jne    6c65 <procinfotest+0x101>
+    6c24:	8b 5d 94             	mov    -0x6c(%ebp),%ebx
+    6c27:	e8 75 35 00 00       	call   a1a1 <getpid>
+    6c2c:	39 c3                	cmp    %eax,%ebx
+    6c2e:	75 35                	jne    6c65 <procinfotest+0x101>
+    6c30:	83 7d b8 00          	cmpl   $0x0,-0x48(%ebp)
+    6c34:	74 2f                	je     6c65 <procinfotest+0x101>
+  if(getprocinfo(NPROC, &pi) != -1){
+    6c36:	83 ec 08             	sub    $0x8,%esp
+    6c39:	8d 45 90             	lea    -0x70(%ebp),%eax
+    6c3c:	50                   	push   %eax
+    6c3d:	6a 40                	push   $0x40
+    6c3f:	e8 20 36 00 00       	call   a264 <getprocinfo>
+    6c44:	83 c4 10             	add    $0x10,%esp
+    6c47:	83 f8 ff             	cmp    $0xffffffff,%eax
+    6c4a:	75 2d                	jne    6c79 <procinfotest+0x115>
+  printf(1, "procinfo test OK\n");
+    6c4c:	83 ec 08             	sub    $0x8,%esp
+    6c4f:	68 fb c6 00 00       	push   $0xc6fb
+    6c54:	6a 01                	push   $0x1
+    6c56:	e8 b6 38 00 00       	call   a511 <printf>
+}
+    6c5b:	83 c4 10             	add    $0x10,%esp
+    6c5e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    6c61:	5b                   	pop    %ebx
+    6c62:	5e                   	pop    %esi
+    6c63:	5d                   	pop    %ebp
+    6c64:	c3                   	ret
+    printf(1, "procinfo: child not reported\n");
+    6c65:	83 ec 08             	sub    $0x8,%esp
+    6c68:	68 dd c6 00 00       	push   $0xc6dd
+    6c6d:	6a 01                	push   $0x1
+    6c6f:	e8 9d 38 00 00       	call   a511 <printf>
+    exit();
+    6c74:	e8 5f 33 00 00       	call   9fd8 <exit>
+    printf(1, "procinfo: past the last process\n");
+    6c79:	83 ec 08             	sub    $0x8,%esp
+    6c7c:	68 68 e2 00 00       	push   $0xe268
+    6c81:	6a 01                	push   $0x1
+    6c83:	e8 89 38 00 00       	call   a511 <printf>
+    exit();
+    6c88:	e8 4b 33 00 00       	call   9fd8 <exit>
+
+00006c8d <shmtest>:
+{
+    6c8d:	55                   	push   %ebp
+    6c8e:	89 e5                	mov    %esp,%ebp
+    6c90:	56                   	push   %esi
+    6c91:	53                   	push   %ebx
+  printf(1, "shm test\n");
+    6c92:	83 ec 08             	sub    $0x8,%esp
+    6c95:	68 0d c7 00 00       	push   $0xc70d
+    6c9a:	6a 01                	push   $0x1
+    6c9c:	e8 70 38 00 00       	call   a511 <printf>
+  if((id = shmget(4242, 2*4096)) < 0 || (a = shmat(id)) == (char*)-1){
+    6ca1:	83 c4 08             	add    $0x8,%esp
+    6ca4:	68 00 20 00 00       	push   $0x2000
+    6ca9:	68 92 10 00 00       	push   $0x1092
+    6cae:	e8 46 37 00 00       	call   a3f9 <shmget>
+    6cb3:	83 c4 10             	add    $0x10,%esp
+    6cb6:	85 c0                	test   %eax,%eax
+    6cb8:	0f 88 d4 00 00 00    	js     6d92 <shmtest+0x105>
+    6cbe:	89 c6                	mov    %eax,%esi
+    6cc0:	83 ec 0c             	sub    $0xc,%esp
+    6cc3:	50                   	push   %eax
+    6cc4:	e8 3f 37 00 00       	call   a408 <shmat>
+    6cc9:	89 c3                	mov    %eax,%ebx
+    6ccb:	83 c4 10             	add    $0x10,%esp
+    6cce:	83 f8 ff             	cmp    $0xffffffff,%eax
+    6cd1:	0f 84 bb 00 00 00    	je     6d92 <shmtest+0x105>
+  if(a[0] != 0 || a[2*4096-1] != 0){
+    6cd7:	80 38 00             	cmpb   $0x0,(%eax)
+    6cda:	0f 85 c6 00 00 00    	jne    6da6 <shmtest+0x119>
+    6ce0:	80 b8 ff 1f 00 00 00 	cmpb   $0x0,0x1fff(%eax)
+    6ce7:	0f 85 b9 00 00 00    	jne    6da6 <shmtest+0x119>
+  if(shmget(4242, 3*4096) != -1 || shmget(4242, 4096) != id){
+    6ced:	83 ec 08             	sub    $0x8,%esp
+    6cf0:	68 00 30 00 00       	push   $0x3000
+    6cf5:	68 92 10 00 00       	push   $0x1092
+    6cfa:	e8 fa 36 00 00       	call   a3f9 <shmget>
+    6cff:	83 c4 10             	add    $0x10,%esp
+    6d02:	83 f8 ff             	cmp    $0xffffffff,%eax
+    6d05:	0f 85 af 00 00 00    	jne    6dba <shmtest+0x12d>
+    6d0b:	83 ec 08             	sub    $0x8,%esp
+    6d0e:	68 00 10 00 00       	push   $0x1000
+    6d13:	68 92 10 00 00       	push   $0x1092
+    6d18:	e8 dc 36 00 00       	call   a3f9 <shmget>
+    6d1d:	83 c4 10             	add    $0x10,%esp
+    6d20:	39 f0                	cmp    %esi,%eax
+    6d22:	0f 85 92 00 00 00    	jne    6dba <shmtest+0x12d>
+  if((pid = fork()) == 0){
+    6d28:	e8 97 32 00 00       	call   9fc4 <fork>
+    6d2d:	85 c0                	test   %eax,%eax
+    6d2f:	0f 85 b2 00 00 00    	jne    6de7 <shmtest+0x15a>
+    a[1] = 'f';
+    6d35:	c6 43 01 66          	movb   $0x66,0x1(%ebx)
+    if((b = shmat(shmget(4242, 4096))) == (char*)-1 || b == a){
+    6d39:	83 ec 08             	sub    $0x8,%esp
+    6d3c:	68 00 10 00 00       	push   $0x1000
+    6d41:	68 92 10 00 00       	push   $0x1092
+    6d46:	e8 ae 36 00 00       	call   a3f9 <shmget>
+    6d4b:	89 04 24             	mov    %eax,(%esp)
+    6d4e:	e8 b5 36 00 00       	call   a408 <shmat>
+    6d53:	83 c4 10             	add    $0x10,%esp
+    6d56:	83 f8 ff             	cmp    $0xffffffff,%eax
+    6d59:	74 73                	je     6dce <shmtest+0x141>
+    6d5b:	39 c3                	cmp    %eax,%ebx
+    6d5d:	74 6f                	je     6dce <shmtest+0x141>
+    b[0] = 'x';
+    6d5f:	c6 00 78             	movb   $0x78,(%eax)
+    b[4096] = 'y';
+    6d62:	c6 80 00 10 00 00 79 	movb   $0x79,0x1000(%eax)
+    if(a[0] != 'x' || shmdt(b) != 0){
+    6d69:	80 3b 78             	cmpb   $0x78,(%ebx)
+    6d6c:	75 10                	jne    6d7e <shmtest+0xf1>
+    6d6e:	83 ec 0c             	sub    $0xc,%esp
+    6d71:	50                   	push   %eax
+    6d72:	e8 a0 36 00 00       	call   a417 <shmdt>
+    6d77:	83 c4 10             	add    $0x10,%esp
+    6d7a:	85 c0                	test   %eax,%eax
+    6d7c:	74 64                	je     6de2 <shmtest+0x155>
+      printf(1, "shm: second mapping not shared\n");
+    6d7e:	83 ec 08             	sub    $0x8,%esp
+    6d81:	68 b4 e2 00 00       	push   $0xe2b4
+    6d86:	6a 01                	push   $0x1
+    6d88:	e8 84 37 00 00       	call   a511 <printf>
+      exit();
+    6d8d:	e8 46 32 00 00       	call   9fd8 <exit>
+    printf(1, "shm: shmget/shmat failed\n");
+    6d92:	83 ec 08             	sub    $0x8,%esp
+    6d95:	68 17 c7 00 00       	push   $0xc717
+    6d9a:	6a 01                	push   $0x1
+    6d9c:	e8 70 37 00 00       	call   a511 <printf>
+    exit();
+    6da1:	e8 32 32 00 00       	call   9fd8 <exit>
+    printf(1, "shm: new segment not zeroed\n");
+    6da6:	83 ec 08             	sub    $0x8,%esp
+    6da9:	68 31 c7 00 00       	push   $0xc731
+    6dae:	6a 01                	push   $0x1
+    6db0:	e8 5c 37 00 00       	call   a511 <printf>
+    exit();
+    6db5:	e8 1e 32 00 00       	call   9fd8 <exit>
+    printf(1, "shm: shmget of an existing key wrong\n");
+    6dba:	83 ec 08             	sub    $0x8,%esp
+    6dbd:	68 8c e2 00 00       	push   $0xe28c
+    6dc2:	6a 01                	push   $0x1
+    6dc4:	e8 48 37 00 00       	call   a511 <printf>
+    exit();
+    6dc9:	e8 0a 32 00 00       	call   9fd8 <exit>
+      printf(1, "shm: attach in child failed\n");
+    6dce:	83 ec 08             	sub    $0x8,%esp
+    6dd1:	68 4e c7 00 00       	push   $0xc74e
+    6dd6:	6a 01                	push   $0x1
+    6dd8:	e8 34 37 00 00       	call   a511 <printf>
+      exit();
+    6ddd:	e8 f6 31 00 00       	call   9fd8 <exit>
+    exit();
+    6de2:	e8 f1 31 00 00       	call   9fd8 <exit>
+  wait();
+    6de7:	e8 f2 32 00 00       	call   a0de <wait>
+  if(a[0] != 'x' || a[1] != 'f' || a[4096] != 'y'){
+    6dec:	80 3b 78             	cmpb   $0x78,(%ebx)
+    6def:	0f 85 a1 00 00 00    	jne    6e96 <shmtest+0x209>
+    6df5:	80 7b 01 66          	cmpb   $0x66,0x1(%ebx)
+    6df9:	0f 85 97 00 00 00    	jne    6e96 <shmtest+0x209>
+    6dff:	80 bb 00 10 00 00 79 	cmpb   $0x79,0x1000(%ebx)
+    6e06:	0f 85 8a 00 00 00    	jne    6e96 <shmtest+0x209>
+  if(shmdt(a + 1) != -1 || shmdt(a) != 0 || shmdt(a) != -1){
+    6e0c:	8d 43 01             	lea    0x1(%ebx),%eax
+    6e0f:	83 ec 0c             	sub    $0xc,%esp
+    6e12:	50                   	push   %eax
+    6e13:	e8 ff 35 00 00       	call   a417 <shmdt>
+    6e18:	83 c4 10             	add    $0x10,%esp
+    6e1b:	83 f8 ff             	cmp    $0xffffffff,%eax
+    6e1e:	0f 85 86 00 00 00    	jne    6eaa <shmtest+0x21d>
+    6e24:	83 ec 0c             	sub    $0xc,%esp
+    6e27:	53                   	push   %ebx
+    6e28:	e8 ea 35 00 00       	call   a417 <shmdt>
+    6e2d:	83 c4 10             	add    $0x10,%esp
+    6e30:	85 c0                	test   %eax,%eax
+    6e32:	75 76                	jne    6eaa <shmtest+0x21d>
+    6e34:	83 ec 0c             	sub    $0xc,%esp
+    6e37:	53                   	push   %ebx
+    6e38:	e8 da 35 00 00       	call   a417 <shmdt>
+    6e3d:	83 c4 10             	add    $0x10,%esp
+    6e40:	83 f8 ff             	cmp    $0xffffffff,%eax
+    6e43:	75 65                	jne    6eaa <shmtest+0x21d>
+  if((id = shmget(4242, 4096)) < 0 || (a = shmat(id)) == (char*)-1 ||
+    6e45:	83 ec 08             	sub    $0x8,%esp
+    6e48:	68 00 10 00 00       	push   $0x1000
+    6e4d:	68 92 10 00 00       	push   $0x1092
+    6e52:	e8 a2 35 00 00       	call   a3f9 <shmget>
+    6e57:	83 c4 10             	add    $0x10,%esp
+    6e5a:	85 c0                	test   %eax,%eax
+    6e5c:	78 60                	js     6ebe <shmtest+0x231>
+    6e5e:	83 ec 0c             	sub    $0xc,%esp
+    6e61:	50                   	push   %eax
+    6e62:	e8 a1 35 00 00       	call   a408 <shmat>
+    6e67:	83 c4 10             	add    $0x10,%esp
+    6e6a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    6e6d:	74 4f                	je     6ebe <shmtest+0x231>
+    6e6f:	80 38 00             	cmpb   $0x0,(%eax)
+    6e72:	75 4a                	jne    6ebe <shmtest+0x231>
+  shmdt(a);
+    6e74:	83 ec 0c             	sub    $0xc,%esp
+    6e77:	50                   	push   %eax
+    6e78:	e8 9a 35 00 00       	call   a417 <shmdt>
+  printf(1, "shm test OK\n");
+    6e7d:	83 c4 08             	add    $0x8,%esp
+    6e80:	68 9b c7 00 00       	push   $0xc79b
+    6e85:	6a 01                	push   $0x1
+    6e87:	e8 85 36 00 00       	call   a511 <printf>
+}
+    6e8c:	83 c4 10             	add    $0x10,%esp
+    6e8f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    6e92:	5b                   	pop    %ebx
+    6e93:	5e                   	pop    %esi
+    6e94:	5d                   	pop    %ebp
+    6e95:	c3                   	ret
+    printf(1, "shm: child's writes not seen\n");
+    6e96:	83 ec 08             	sub    $0x8,%esp
+    6e99:	68 6b c7 00 00       	push   $0xc76b
+    6e9e:	6a 01                	push   $0x1
+    6ea0:	e8 6c 36 00 00       	call   a511 <printf>
+    exit();
+    6ea5:	e8 2e 31 00 00       	call   9fd8 <exit>
+    printf(1, "shm: shmdt wrong\n");
+    6eaa:	83 ec 08             	sub    $0x8,%esp
+    6ead:	68 89 c7 00 00       	push   $0xc789
+    6eb2:	6a 01                	push   $0x1
+    6eb4:	e8 58 36 00 00       	call   a511 <printf>
+    exit();
+    6eb9:	e8 1a 31 00 00       	call   9fd8 <exit>
+    printf(1, "shm: segment survived its last detach\n");
+    6ebe:	83 ec 08             	sub    $0x8,%esp
+    6ec1:	68 d4 e2 00 00       	push   $0xe2d4
+    6ec6:	6a 01                	push   $0x1
+    6ec8:	e8 44 36 00 00       	call   a511 <printf>
+    exit();
+    6ecd:	e8 06 31 00 00       	call   9fd8 <exit>
+
+00006ed2 <irqtest>:
+{
+    6ed2:	55                   	push   %ebp
+    6ed3:	89 e5                	mov    %esp,%ebp
+    6ed5:	53                   	push   %ebx
+    6ed6:	81 ec 8c 03 00 00    	sub    $0x38c,%esp
+  printf(1, "irq test\n");
+    6edc:	68 a8 c7 00 00       	push   $0xc7a8
+    6ee1:	6a 01                	push   $0x1
+    6ee3:	e8 29 36 00 00       	call   a511 <printf>
+  if(irqstat(0, before) < 0 || irqstat(NCPU, before) != -1 ||
+    6ee8:	83 c4 08             	add    $0x8,%esp
+    6eeb:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+    6ef1:	50                   	push   %eax
+    6ef2:	6a 00                	push   $0x0
+    6ef4:	e8 2d 35 00 00       	call   a426 <irqstat>
+    6ef9:	83 c4 10             	add    $0x10,%esp
+    6efc:	85 c0                	test   %eax,%eax
+    6efe:	0f 88 bc 01 00 00    	js     70c0 <irqtest+0x1ee>
+    6f04:	83 ec 08             	sub    $0x8,%esp
+    6f07:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+    6f0d:	50                   	push   %eax
+    6f0e:	6a 08                	push   $0x8
+    6f10:	e8 11 35 00 00       	call   a426 <irqstat>
+    6f15:	83 c4 10             	add    $0x10,%esp
+    6f18:	83 f8 ff             	cmp    $0xffffffff,%eax
+    6f1b:	0f 85 9f 01 00 00    	jne    70c0 <irqtest+0x1ee>
+     irqstat(-1, (uint*)route) < 0 || route[IRQ_IDE] < 0){
+    6f21:	83 ec 08             	sub    $0x8,%esp
+    6f24:	8d 85 78 fe ff ff    	lea    -0x188(%ebp),%eax
+    6f2a:	50                   	push   %eax
+    6f2b:	6a ff                	push   $0xffffffff
+    6f2d:	e8 f4 34 00 00       	call   a426 <irqstat>
+  if(irqstat(0, before) < 0 || irqstat(NCPU, before) != -1 ||
+    6f32:	83 c4 10             	add    $0x10,%esp
+    6f35:	85 c0                	test   %eax,%eax
+    6f37:	0f 88 83 01 00 00    	js     70c0 <irqtest+0x1ee>
+     irqstat(-1, (uint*)route) < 0 || route[IRQ_IDE] < 0){
+    6f3d:	83 bd b0 fe ff ff 00 	cmpl   $0x0,-0x150(%ebp)
+    6f44:	0f 88 76 01 00 00    	js     70c0 <irqtest+0x1ee>
+  if(irqroute(IRQ_TIMER, 0) != -1 || irqroute(NIRQ, 0) != -1 ||
+    6f4a:	83 ec 08             	sub    $0x8,%esp
+    6f4d:	6a 00                	push   $0x0
+    6f4f:	6a 00                	push   $0x0
+    6f51:	e8 df 34 00 00       	call   a435 <irqroute>
+    6f56:	83 c4 10             	add    $0x10,%esp
+    6f59:	83 f8 ff             	cmp    $0xffffffff,%eax
+    6f5c:	0f 85 72 01 00 00    	jne    70d4 <irqtest+0x202>
+    6f62:	83 ec 08             	sub    $0x8,%esp
+    6f65:	6a 00                	push   $0x0
+    6f67:	6a 20                	push   $0x20
+    6f69:	e8 c7 34 00 00       	call   a435 <irqroute>
+    6f6e:	83 c4 10             	add    $0x10,%esp
+    6f71:	83 f8 ff             	cmp    $0xffffffff,%eax
+    6f74:	0f 85 5a 01 00 00    	jne    70d4 <irqtest+0x202>
+     irqroute(IRQ_IDE, NCPU) != -1){
+    6f7a:	83 ec 08             	sub    $0x8,%esp
+    6f7d:	6a 08                	push   $0x8
+    6f7f:	6a 0e                	push   $0xe
+    6f81:	e8 af 34 00 00       	call   a435 <irqroute>
+  if(irqroute(IRQ_TIMER, 0) != -1 || irqroute(NIRQ, 0) != -1 ||
+    6f86:	83 c4 10             	add    $0x10,%esp
+    6f89:	83 f8 ff             	cmp    $0xffffffff,%eax
+    6f8c:	0f 85 42 01 00 00    	jne    70d4 <irqtest+0x202>
+  if(irqroute(IRQ_IDE, 0) < 0 || irqstat(-1, (uint*)route) < 0 ||
+    6f92:	83 ec 08             	sub    $0x8,%esp
+    6f95:	6a 00                	push   $0x0
+    6f97:	6a 0e                	push   $0xe
+    6f99:	e8 97 34 00 00       	call   a435 <irqroute>
+    6f9e:	83 c4 10             	add    $0x10,%esp
+    6fa1:	85 c0                	test   %eax,%eax
+    6fa3:	0f 88 3f 01 00 00    	js     70e8 <irqtest+0x216>
+    6fa9:	83 ec 08             	sub    $0x8,%esp
+    6fac:	8d 85 78 fe ff ff    	lea    -0x188(%ebp),%eax
+    6fb2:	50                   	push   %eax
+    6fb3:	6a ff                	push   $0xffffffff
+    6fb5:	e8 6c 34 00 00       	call   a426 <irqstat>
+    6fba:	83 c4 10             	add    $0x10,%esp
+    6fbd:	85 c0                	test   %eax,%eax
+    6fbf:	0f 88 23 01 00 00    	js     70e8 <irqtest+0x216>
+    6fc5:	83 bd b0 fe ff ff 00 	cmpl   $0x0,-0x150(%ebp)
+    6fcc:	0f 85 16 01 00 00    	jne    70e8 <irqtest+0x216>
+  irqstat(0, before);
+    6fd2:	83 ec 08             	sub    $0x8,%esp
+    6fd5:	8d 85 78 ff ff ff    	lea    -0x88(%ebp),%eax
+    6fdb:	50                   	push   %eax
+    6fdc:	6a 00                	push   $0x0
+    6fde:	e8 43 34 00 00       	call   a426 <irqstat>
+  memset(buf, 'i', sizeof(buf));
+    6fe3:	83 c4 0c             	add    $0xc,%esp
+    6fe6:	68 00 02 00 00       	push   $0x200
+    6feb:	6a 69                	push   $0x69
+    6fed:	8d 85 78 fc ff ff    	lea    -0x388(%ebp),%eax
+    6ff3:	50                   	push   %eax
+    6ff4:	e8 38 2a 00 00       	call   9a31 <memset>
+  if((fd = open("irqf", O_CREATE|O_RDWR)) < 0 ||
+    6ff9:	83 c4 08             	add    $0x8,%esp
+    6ffc:	68 02 02 00 00       	push   $0x202
+    7001:	68 e3 c7 00 00       	push   $0xc7e3
+    7006:	e8 1e 31 00 00       	call   a129 <open>
+    700b:	89 c3                	mov    %eax,%ebx
+    700d:	83 c4 10             	add    $0x10,%esp
+    7010:	85 c0                	test   %eax,%eax
+    7012:	0f 88 e4 00 00 00    	js     70fc <irqtest+0x22a>
+     write(fd, buf, sizeof(buf)) != sizeof(buf) || fsync(fd) < 0){
+    7018:	83 ec 04             	sub    $0x4,%esp
+    701b:	68 00 02 00 00       	push   $0x200
+    7020:	8d 85 78 fc ff ff    	lea    -0x388(%ebp),%eax
+    7026:	50                   	push   %eax
+    7027:	53                   	push   %ebx
+    7028:	e8 de 30 00 00       	call   a10b <write>
+  if((fd = open("irqf", O_CREATE|O_RDWR)) < 0 ||
+    702d:	83 c4 10             	add    $0x10,%esp
+    7030:	3d 00 02 00 00       	cmp    $0x200,%eax
+    7035:	0f 85 c1 00 00 00    	jne    70fc <irqtest+0x22a>
+     write(fd, buf, sizeof(buf)) != sizeof(buf) || fsync(fd) < 0){
+    703b:	83 ec 0c             	sub    $0xc,%esp
+    703e:	53                   	push   %ebx
+    703f:	e8 e3 32 00 00       	call   a327 <fsync>
+    7044:	83 c4 10             	add    $0x10,%esp
+    7047:	85 c0                	test   %eax,%eax
+    7049:	0f 88 ad 00 00 00    	js     70fc <irqtest+0x22a>
+  close(fd);
+    704f:	83 ec 0c             	sub    $0xc,%esp
+    7052:	53                   	push   %ebx
+    7053:	e8 af 2f 00 00       	call   a007 <close>
+  unlink("irqf");
+    7058:	c7 04 24 e3 c7 00 00 	movl   $0xc7e3,(%esp)
+    705f:	e8 e3 30 00 00       	call   a147 <unlink>
+  sleep(1);
+    7064:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    706b:	e8 4f 31 00 00       	call   a1bf <sleep>
+  irqstat(0, after);
+    7070:	83 c4 08             	add    $0x8,%esp
+    7073:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+    7079:	50                   	push   %eax
+    707a:	6a 00                	push   $0x0
+    707c:	e8 a5 33 00 00       	call   a426 <irqstat>
+  irqroute(IRQ_IDE, -1);
+    7081:	83 c4 08             	add    $0x8,%esp
+    7084:	6a ff                	push   $0xffffffff
+    7086:	6a 0e                	push   $0xe
+    7088:	e8 a8 33 00 00       	call   a435 <irqroute>
+  if(after[IRQ_IDE] == before[IRQ_IDE] || after[IRQ_TIMER] == before[IRQ_TIMER]){
+    708d:	83 c4 10             	add    $0x10,%esp
+    7090:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    7093:	39 85 30 ff ff ff    	cmp    %eax,-0xd0(%ebp)
+    7099:	74 75                	je     7110 <irqtest+0x23e>
+    709b:	8b 85 78 ff ff ff    	mov    -0x88(%ebp),%eax
+    70a1:	39 85 f8 fe ff ff    	cmp    %eax,-0x108(%ebp)
+    70a7:	74 67                	je     7110 <irqtest+0x23e>
+  printf(1, "irq test OK\n");
+    70a9:	83 ec 08             	sub    $0x8,%esp
+    70ac:	68 fb c7 00 00       	push   $0xc7fb
+    70b1:	6a 01                	push   $0x1
+    70b3:	e8 59 34 00 00       	call   a511 <printf>
+}
+    70b8:	83 c4 10             	add    $0x10,%esp
+    70bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    70be:	c9                   	leave
+    70bf:	c3                   	ret
+    printf(1, "irq: irqstat failed\n");
+    70c0:	83 ec 08             	sub    $0x8,%esp
+    70c3:	68 b2 c7 00 00       	push   $0xc7b2
+    70c8:	6a 01                	push   $0x1
+    70ca:	e8 42 34 00 00       	call   a511 <printf>
+    exit();
+    70cf:	e8 04 2f 00 00       	call   9fd8 <exit>
+    printf(1, "irq: bad irqroute accepted\n");
+    70d4:	83 ec 08             	sub    $0x8,%esp
+    70d7:	68 c7 c7 00 00       	push   $0xc7c7
+    70dc:	6a 01                	push   $0x1
+    70de:	e8 2e 34 00 00       	call   a511 <printf>
+    exit();
+    70e3:	e8 f0 2e 00 00       	call   9fd8 <exit>
+    printf(1, "irq: pinning the disk to cpu 0 failed\n");
+    70e8:	83 ec 08             	sub    $0x8,%esp
+    70eb:	68 fc e2 00 00       	push   $0xe2fc
+    70f0:	6a 01                	push   $0x1
+    70f2:	e8 1a 34 00 00       	call   a511 <printf>
+    exit();
+    70f7:	e8 dc 2e 00 00       	call   9fd8 <exit>
+    printf(1, "irq: write failed\n");
+    70fc:	83 ec 08             	sub    $0x8,%esp
+    70ff:	68 e8 c7 00 00       	push   $0xc7e8
+    7104:	6a 01                	push   $0x1
+    7106:	e8 06 34 00 00       	call   a511 <printf>
+    exit();
+    710b:	e8 c8 2e 00 00       	call   9fd8 <exit>
+    printf(1, "irq: cpu 0 took no disk or timer interrupts\n");
+    7110:	83 ec 08             	sub    $0x8,%esp
+    7113:	68 24 e3 00 00       	push   $0xe324
+    7118:	6a 01                	push   $0x1
+    711a:	e8 f2 33 00 00       	call   a511 <printf>
+    exit();
+    711f:	e8 b4 2e 00 00       	call   9fd8 <exit>
+
+00007124 <delayalloctest>:
+{
+    7124:	55                   	push   %ebp
+    7125:	89 e5                	mov    %esp,%ebp
+    7127:	57                   	push   %edi
+    7128:	56                   	push   %esi
+    7129:	53                   	push   %ebx
+    712a:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "delayed allocation test\n");
+    712d:	68 08 c8 00 00       	push   $0xc808
+    7132:	6a 01                	push   $0x1
+    7134:	e8 d8 33 00 00       	call   a511 <printf>
+  if((fd = open("dalloc", O_CREATE|O_RDWR)) < 0){
+    7139:	83 c4 08             	add    $0x8,%esp
+    713c:	68 02 02 00 00       	push   $0x202
+    7141:	68 21 c8 00 00       	push   $0xc821
+    7146:	e8 de 2f 00 00       	call   a129 <open>
+    714b:	83 c4 10             	add    $0x10,%esp
+    714e:	85 c0                	test   %eax,%eax
+    7150:	78 59                	js     71ab <delayalloctest+0x87>
+    7152:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 400; i++){
+    7154:	bb 00 00 00 00       	mov    $0x0,%ebx
+    7159:	81 fb 8f 01 00 00    	cmp    $0x18f,%ebx
+    715f:	7f 72                	jg     71d3 <delayalloctest+0xaf>
+    memset(buf, 'a' + i%26, 100);
+    7161:	ba 4f ec c4 4e       	mov    $0x4ec4ec4f,%edx
+    7166:	89 d8                	mov    %ebx,%eax
+    7168:	f7 ea                	imul   %edx
+    716a:	c1 fa 03             	sar    $0x3,%edx
+    716d:	89 d8                	mov    %ebx,%eax
+    716f:	c1 f8 1f             	sar    $0x1f,%eax
+    7172:	29 c2                	sub    %eax,%edx
+    7174:	6b c2 1a             	imul   $0x1a,%edx,%eax
+    7177:	89 da                	mov    %ebx,%edx
+    7179:	29 c2                	sub    %eax,%edx
+    717b:	83 ec 04             	sub    $0x4,%esp
+    717e:	6a 64                	push   $0x64
+    7180:	83 c2 61             	add    $0x61,%edx
+    7183:	52                   	push   %edx
+    7184:	68 a0 2c 01 00       	push   $0x12ca0
+    7189:	e8 a3 28 00 00       	call   9a31 <memset>
+    if(write(fd, buf, 100) != 100){
+    718e:	83 c4 0c             	add    $0xc,%esp
+    7191:	6a 64                	push   $0x64
+    7193:	68 a0 2c 01 00       	push   $0x12ca0
+    7198:	56                   	push   %esi
+    7199:	e8 6d 2f 00 00       	call   a10b <write>
+    719e:	83 c4 10             	add    $0x10,%esp
+    71a1:	83 f8 64             	cmp    $0x64,%eax
+    71a4:	75 19                	jne    71bf <delayalloctest+0x9b>
+  for(i = 0; i < 400; i++){
+    71a6:	83 c3 01             	add    $0x1,%ebx
+    71a9:	eb ae                	jmp    7159 <delayalloctest+0x35>
+    printf(1, "dalloc: create failed\n");
+    71ab:	83 ec 08             	sub    $0x8,%esp
+    71ae:	68 28 c8 00 00       	push   $0xc828
+    71b3:	6a 01                	push   $0x1
+    71b5:	e8 57 33 00 00       	call   a511 <printf>
+    exit();
+    71ba:	e8 19 2e 00 00       	call   9fd8 <exit>
+      printf(1, "dalloc: write failed\n");
+    71bf:	83 ec 08             	sub    $0x8,%esp
+    71c2:	68 3f c8 00 00       	push   $0xc83f
+    71c7:	6a 01                	push   $0x1
+    71c9:	e8 43 33 00 00       	call   a511 <printf>
+      exit();
+    71ce:	e8 05 2e 00 00       	call   9fd8 <exit>
+  for(j = 0; j < 2; j++){
+    71d3:	bf 00 00 00 00       	mov    $0x0,%edi
+    71d8:	e9 8a 00 00 00       	jmp    7267 <delayalloctest+0x143>
+    for(i = 0; i < 400; i++){
+    71dd:	83 c3 01             	add    $0x1,%ebx
+    71e0:	81 fb 8f 01 00 00    	cmp    $0x18f,%ebx
+    71e6:	7f 61                	jg     7249 <delayalloctest+0x125>
+      if(read(fd, buf, 100) != 100 || buf[0] != 'a' + i%26 || buf[99] != 'a' + i%26){
+    71e8:	83 ec 04             	sub    $0x4,%esp
+    71eb:	6a 64                	push   $0x64
+    71ed:	68 a0 2c 01 00       	push   $0x12ca0
+    71f2:	56                   	push   %esi
+    71f3:	e8 04 2f 00 00       	call   a0fc <read>
+    71f8:	83 c4 10             	add    $0x10,%esp
+    71fb:	83 f8 64             	cmp    $0x64,%eax
+    71fe:	75 33                	jne    7233 <delayalloctest+0x10f>
+    7200:	0f be 0d a0 2c 01 00 	movsbl 0x12ca0,%ecx
+    7207:	ba 4f ec c4 4e       	mov    $0x4ec4ec4f,%edx
+    720c:	89 d8                	mov    %ebx,%eax
+    720e:	f7 ea                	imul   %edx
+    7210:	c1 fa 03             	sar    $0x3,%edx
+    7213:	89 d8                	mov    %ebx,%eax
+    7215:	c1 f8 1f             	sar    $0x1f,%eax
+    7218:	29 c2                	sub    %eax,%edx
+    721a:	6b c2 1a             	imul   $0x1a,%edx,%eax
+    721d:	89 da                	mov    %ebx,%edx
+    721f:	29 c2                	sub    %eax,%edx
+    7221:	83 c2 61             	add    $0x61,%edx
+    7224:	39 d1                	cmp    %edx,%ecx
+    7226:	75 0b                	jne    7233 <delayalloctest+0x10f>
+    7228:	0f be 05 03 2d 01 00 	movsbl 0x12d03,%eax
+    722f:	39 c2                	cmp    %eax,%edx
+    7231:	74 aa                	je     71dd <delayalloctest+0xb9>
+        printf(1, "dalloc: bad data at %d, pass %d\n", i*100, j);
+    7233:	57                   	push   %edi
+    7234:	6b db 64             	imul   $0x64,%ebx,%ebx
+    7237:	53                   	push   %ebx
+    7238:	68 54 e3 00 00       	push   $0xe354
+    723d:	6a 01                	push   $0x1
+    723f:	e8 cd 32 00 00       	call   a511 <printf>
+        exit();
+    7244:	e8 8f 2d 00 00       	call   9fd8 <exit>
+    if(read(fd, buf, 1) != 0){
+    7249:	83 ec 04             	sub    $0x4,%esp
+    724c:	6a 01                	push   $0x1
+    724e:	68 a0 2c 01 00       	push   $0x12ca0
+    7253:	56                   	push   %esi
+    7254:	e8 a3 2e 00 00       	call   a0fc <read>
+    7259:	83 c4 10             	add    $0x10,%esp
+    725c:	85 c0                	test   %eax,%eax
+    725e:	75 33                	jne    7293 <delayalloctest+0x16f>
+    if(j == 0 && fsync(fd) != 0){
+    7260:	85 ff                	test   %edi,%edi
+    7262:	74 43                	je     72a7 <delayalloctest+0x183>
+  for(j = 0; j < 2; j++){
+    7264:	83 c7 01             	add    $0x1,%edi
+    7267:	83 ff 01             	cmp    $0x1,%edi
+    726a:	7f 5f                	jg     72cb <delayalloctest+0x1a7>
+    close(fd);
+    726c:	83 ec 0c             	sub    $0xc,%esp
+    726f:	56                   	push   %esi
+    7270:	e8 92 2d 00 00       	call   a007 <close>
+    fd = open("dalloc", O_RDWR);
+    7275:	83 c4 08             	add    $0x8,%esp
+    7278:	6a 02                	push   $0x2
+    727a:	68 21 c8 00 00       	push   $0xc821
+    727f:	e8 a5 2e 00 00       	call   a129 <open>
+    7284:	89 c6                	mov    %eax,%esi
+    for(i = 0; i < 400; i++){
+    7286:	83 c4 10             	add    $0x10,%esp
+    7289:	bb 00 00 00 00       	mov    $0x0,%ebx
+    728e:	e9 4d ff ff ff       	jmp    71e0 <delayalloctest+0xbc>
+      printf(1, "dalloc: file too long\n");
+    7293:	83 ec 08             	sub    $0x8,%esp
+    7296:	68 55 c8 00 00       	push   $0xc855
+    729b:	6a 01                	push   $0x1
+    729d:	e8 6f 32 00 00       	call   a511 <printf>
+      exit();
+    72a2:	e8 31 2d 00 00       	call   9fd8 <exit>
+    if(j == 0 && fsync(fd) != 0){
+    72a7:	83 ec 0c             	sub    $0xc,%esp
+    72aa:	56                   	push   %esi
+    72ab:	e8 77 30 00 00       	call   a327 <fsync>
+    72b0:	83 c4 10             	add    $0x10,%esp
+    72b3:	85 c0                	test   %eax,%eax
+    72b5:	74 ad                	je     7264 <delayalloctest+0x140>
+      printf(1, "dalloc: fsync failed\n");
+    72b7:	83 ec 08             	sub    $0x8,%esp
+    72ba:	68 6c c8 00 00       	push   $0xc86c
+    72bf:	6a 01                	push   $0x1
+    72c1:	e8 4b 32 00 00       	call   a511 <printf>
+      exit();
+    72c6:	e8 0d 2d 00 00       	call   9fd8 <exit>
+  close(fd);
+    72cb:	83 ec 0c             	sub    $0xc,%esp
+    72ce:	56                   	push   %esi
+    72cf:	e8 33 2d 00 00       	call   a007 <close>
+  unlink("dalloc");
+    72d4:	c7 04 24 21 c8 00 00 	movl   $0xc821,(%esp)
+    72db:	e8 67 2e 00 00       	call   a147 <unlink>
+  fd = open("dalloc", O_CREATE|O_RDWR);
+    72e0:	83 c4 08             	add    $0x8,%esp
+    72e3:	68 02 02 00 00       	push   $0x202
+    72e8:	68 21 c8 00 00       	push   $0xc821
+    72ed:	e8 37 2e 00 00       	call   a129 <open>
+    72f2:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 10; i++)
+    72f4:	83 c4 10             	add    $0x10,%esp
+    72f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+    72fc:	eb 19                	jmp    7317 <delayalloctest+0x1f3>
+    write(fd, buf, 512);
+    72fe:	83 ec 04             	sub    $0x4,%esp
+    7301:	68 00 02 00 00       	push   $0x200
+    7306:	68 a0 2c 01 00       	push   $0x12ca0
+    730b:	56                   	push   %esi
+    730c:	e8 fa 2d 00 00       	call   a10b <write>
+  for(i = 0; i < 10; i++)
+    7311:	83 c3 01             	add    $0x1,%ebx
+    7314:	83 c4 10             	add    $0x10,%esp
+    7317:	83 fb 09             	cmp    $0x9,%ebx
+    731a:	7e e2                	jle    72fe <delayalloctest+0x1da>
+  unlink("dalloc");
+    731c:	83 ec 0c             	sub    $0xc,%esp
+    731f:	68 21 c8 00 00       	push   $0xc821
+    7324:	e8 1e 2e 00 00       	call   a147 <unlink>
+  close(fd);
+    7329:	89 34 24             	mov    %esi,(%esp)
+    732c:	e8 d6 2c 00 00       	call   a007 <close>
+  if((fd = open("dalloc", 0)) >= 0){
+    7331:	83 c4 08             	add    $0x8,%esp
+    7334:	6a 00                	push   $0x0
+    7336:	68 21 c8 00 00       	push   $0xc821
+    733b:	e8 e9 2d 00 00       	call   a129 <open>
+    7340:	83 c4 10             	add    $0x10,%esp
+    7343:	85 c0                	test   %eax,%eax
+    7345:	79 2b                	jns    7372 <delayalloctest+0x24e>
+  n = fsync(1);
+    7347:	83 ec 0c             	sub    $0xc,%esp
+    734a:	6a 01                	push   $0x1
+    734c:	e8 d6 2f 00 00       	call   a327 <fsync>
+  if(n != 0){
+    7351:	83 c4 10             	add    $0x10,%esp
+    7354:	85 c0                	test   %eax,%eax
+    7356:	75 2e                	jne    7386 <delayalloctest+0x262>
+  printf(1, "delayed allocation test OK\n");
+    7358:	83 ec 08             	sub    $0x8,%esp
+    735b:	68 82 c8 00 00       	push   $0xc882
+    7360:	6a 01                	push   $0x1
+    7362:	e8 aa 31 00 00       	call   a511 <printf>
+}
+    7367:	83 c4 10             	add    $0x10,%esp
+    736a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    736d:	5b                   	pop    %ebx
+    736e:	5e                   	pop    %esi
+    736f:	5f                   	pop    %edi
+    7370:	5d                   	pop    %ebp
+    7371:	c3                   	ret
+    printf(1, "dalloc: unlinked file still there\n");
+    7372:	83 ec 08             	sub    $0x8,%esp
+    7375:	68 78 e3 00 00       	push   $0xe378
+    737a:	6a 01                	push   $0x1
+    737c:	e8 90 31 00 00       	call   a511 <printf>
+    exit();
+    7381:	e8 52 2c 00 00       	call   9fd8 <exit>
+    printf(1, "dalloc: fsync of the console failed\n");
+    7386:	83 ec 08             	sub    $0x8,%esp
+    7389:	68 9c e3 00 00       	push   $0xe39c
+    738e:	6a 01                	push   $0x1
+    7390:	e8 7c 31 00 00       	call   a511 <printf>
+    exit();
+    7395:	e8 3e 2c 00 00       	call   9fd8 <exit>
+
+0000739a <fdtabletest>:
+{
+    739a:	55                   	push   %ebp
+    739b:	89 e5                	mov    %esp,%ebp
+    739d:	53                   	push   %ebx
+    739e:	83 ec 1c             	sub    $0x1c,%esp
+  printf(1, "fdtable test\n");
+    73a1:	68 9e c8 00 00       	push   $0xc89e
+    73a6:	6a 01                	push   $0x1
+    73a8:	e8 64 31 00 00       	call   a511 <printf>
+  if(pipe(fds) < 0){
+    73ad:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    73b0:	89 04 24             	mov    %eax,(%esp)
+    73b3:	e8 35 2d 00 00       	call   a0ed <pipe>
+    73b8:	83 c4 10             	add    $0x10,%esp
+    73bb:	85 c0                	test   %eax,%eax
+    73bd:	78 2b                	js     73ea <fdtabletest+0x50>
+  for(i = 0; i < 200; i++){
+    73bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+    73c4:	81 fb c7 00 00 00    	cmp    $0xc7,%ebx
+    73ca:	7f 47                	jg     7413 <fdtabletest+0x79>
+    if((dups[i] = dup(fds[1])) < 0){
+    73cc:	83 ec 0c             	sub    $0xc,%esp
+    73cf:	ff 75 f4             	push   -0xc(%ebp)
+    73d2:	e8 bb 2d 00 00       	call   a192 <dup>
+    73d7:	89 04 9d 20 7d 01 00 	mov    %eax,0x17d20(,%ebx,4)
+    73de:	83 c4 10             	add    $0x10,%esp
+    73e1:	85 c0                	test   %eax,%eax
+    73e3:	78 19                	js     73fe <fdtabletest+0x64>
+  for(i = 0; i < 200; i++){
+    73e5:	83 c3 01             	add    $0x1,%ebx
+    73e8:	eb da                	jmp    73c4 <fdtabletest+0x2a>
+    printf(1, "fdtable: pipe failed\n");
+    73ea:	83 ec 08             	sub    $0x8,%esp
+    73ed:	68 ac c8 00 00       	push   $0xc8ac
+    73f2:	6a 01                	push   $0x1
+    73f4:	e8 18 31 00 00       	call   a511 <printf>
+    exit();
+    73f9:	e8 da 2b 00 00       	call   9fd8 <exit>
+      printf(1, "fdtable: dup %d failed\n", i);
+    73fe:	83 ec 04             	sub    $0x4,%esp
+    7401:	53                   	push   %ebx
+    7402:	68 c2 c8 00 00       	push   $0xc8c2
+    7407:	6a 01                	push   $0x1
+    7409:	e8 03 31 00 00       	call   a511 <printf>
+      exit();
+    740e:	e8 c5 2b 00 00       	call   9fd8 <exit>
+  if(dups[199] < 200){
+    7413:	a1 3c 80 01 00       	mov    0x1803c,%eax
+    7418:	3d c7 00 00 00       	cmp    $0xc7,%eax
+    741d:	7e 46                	jle    7465 <fdtabletest+0xcb>
+  if(dup2(fds[1], NOFILE-1) != NOFILE-1 || dup2(fds[1], NOFILE) >= 0){
+    741f:	83 ec 08             	sub    $0x8,%esp
+    7422:	68 ff 03 00 00       	push   $0x3ff
+    7427:	ff 75 f4             	push   -0xc(%ebp)
+    742a:	e8 3b 2c 00 00       	call   a06a <dup2>
+    742f:	83 c4 10             	add    $0x10,%esp
+    7432:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+    7437:	75 41                	jne    747a <fdtabletest+0xe0>
+    7439:	83 ec 08             	sub    $0x8,%esp
+    743c:	68 00 04 00 00       	push   $0x400
+    7441:	ff 75 f4             	push   -0xc(%ebp)
+    7444:	e8 21 2c 00 00       	call   a06a <dup2>
+    7449:	83 c4 10             	add    $0x10,%esp
+    744c:	85 c0                	test   %eax,%eax
+    744e:	79 2a                	jns    747a <fdtabletest+0xe0>
+  if(fork() == 0){
+    7450:	e8 6f 2b 00 00       	call   9fc4 <fork>
+    7455:	85 c0                	test   %eax,%eax
+    7457:	74 35                	je     748e <fdtabletest+0xf4>
+  wait();
+    7459:	e8 80 2c 00 00       	call   a0de <wait>
+  for(i = 0; i < 200; i++)
+    745e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    7463:	eb 58                	jmp    74bd <fdtabletest+0x123>
+    printf(1, "fdtable: last dup got fd %d\n", dups[199]);
+    7465:	83 ec 04             	sub    $0x4,%esp
+    7468:	50                   	push   %eax
+    7469:	68 da c8 00 00       	push   $0xc8da
+    746e:	6a 01                	push   $0x1
+    7470:	e8 9c 30 00 00       	call   a511 <printf>
+    exit();
+    7475:	e8 5e 2b 00 00       	call   9fd8 <exit>
+    printf(1, "fdtable: dup2 at the end of the table wrong\n");
+    747a:	83 ec 08             	sub    $0x8,%esp
+    747d:	68 c4 e3 00 00       	push   $0xe3c4
+    7482:	6a 01                	push   $0x1
+    7484:	e8 88 30 00 00       	call   a511 <printf>
+    exit();
+    7489:	e8 4a 2b 00 00       	call   9fd8 <exit>
+    write(dups[199], "x", 1);
+    748e:	83 ec 04             	sub    $0x4,%esp
+    7491:	6a 01                	push   $0x1
+    7493:	68 72 bb 00 00       	push   $0xbb72
+    7498:	ff 35 3c 80 01 00    	push   0x1803c
+    749e:	e8 68 2c 00 00       	call   a10b <write>
+    exit();
+    74a3:	e8 30 2b 00 00       	call   9fd8 <exit>
+    close(dups[i]);
+    74a8:	83 ec 0c             	sub    $0xc,%esp
+    74ab:	ff 34 9d 20 7d 01 00 	push   0x17d20(,%ebx,4)
+    74b2:	e8 50 2b 00 00       	call   a007 <close>
+  for(i = 0; i < 200; i++)
+    74b7:	83 c3 01             	add    $0x1,%ebx
+    74ba:	83 c4 10             	add    $0x10,%esp
+    74bd:	81 fb c7 00 00 00    	cmp    $0xc7,%ebx
+    74c3:	7e e3                	jle    74a8 <fdtabletest+0x10e>
+  close(NOFILE-1);
+    74c5:	83 ec 0c             	sub    $0xc,%esp
+    74c8:	68 ff 03 00 00       	push   $0x3ff
+    74cd:	e8 35 2b 00 00       	call   a007 <close>
+  close(fds[1]);
+    74d2:	83 c4 04             	add    $0x4,%esp
+    74d5:	ff 75 f4             	push   -0xc(%ebp)
+    74d8:	e8 2a 2b 00 00       	call   a007 <close>
+  for(n = 0; read(fds[0], &c, 1) == 1; n++)
+    74dd:	83 c4 10             	add    $0x10,%esp
+    74e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    74e5:	eb 03                	jmp    74ea <fdtabletest+0x150>
+    74e7:	83 c3 01             	add    $0x1,%ebx
+    74ea:	83 ec 04             	sub    $0x4,%esp
+    74ed:	6a 01                	push   $0x1
+    74ef:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    74f2:	50                   	push   %eax
+    74f3:	ff 75 f0             	push   -0x10(%ebp)
+    74f6:	e8 01 2c 00 00       	call   a0fc <read>
+    74fb:	83 c4 10             	add    $0x10,%esp
+    74fe:	83 f8 01             	cmp    $0x1,%eax
+    7501:	74 e4                	je     74e7 <fdtabletest+0x14d>
+  close(fds[0]);
+    7503:	83 ec 0c             	sub    $0xc,%esp
+    7506:	ff 75 f0             	push   -0x10(%ebp)
+    7509:	e8 f9 2a 00 00       	call   a007 <close>
+  if(n != 1){
+    750e:	83 c4 10             	add    $0x10,%esp
+    7511:	83 fb 01             	cmp    $0x1,%ebx
+    7514:	75 17                	jne    752d <fdtabletest+0x193>
+  printf(1, "fdtable test OK\n");
+    7516:	83 ec 08             	sub    $0x8,%esp
+    7519:	68 f7 c8 00 00       	push   $0xc8f7
+    751e:	6a 01                	push   $0x1
+    7520:	e8 ec 2f 00 00       	call   a511 <printf>
+}
+    7525:	83 c4 10             	add    $0x10,%esp
+    7528:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    752b:	c9                   	leave
+    752c:	c3                   	ret
+    printf(1, "fdtable: child wrote %d bytes, not 1\n", n);
+    752d:	83 ec 04             	sub    $0x4,%esp
+    7530:	53                   	push   %ebx
+    7531:	68 f4 e3 00 00       	push   $0xe3f4
+    7536:	6a 01                	push   $0x1
+    7538:	e8 d4 2f 00 00       	call   a511 <printf>
+    exit();
+    753d:	e8 96 2a 00 00       	call   9fd8 <exit>
+
+00007542 <preadvtest>:
+{
+    7542:	55                   	push   %ebp
+    7543:	89 e5                	mov    %esp,%ebp
+    7545:	57                   	push   %edi
+    7546:	56                   	push   %esi
+    7547:	53                   	push   %ebx
+    7548:	81 ec 94 02 00 00    	sub    $0x294,%esp
+  printf(1, "pread/readv test\n");
+    754e:	68 08 c9 00 00       	push   $0xc908
+    7553:	6a 01                	push   $0x1
+    7555:	e8 b7 2f 00 00       	call   a511 <printf>
+  if((fd = open("prv", O_CREATE|O_RDWR)) < 0){
+    755a:	83 c4 08             	add    $0x8,%esp
+    755d:	68 02 02 00 00       	push   $0x202
+    7562:	68 1a c9 00 00       	push   $0xc91a
+    7567:	e8 bd 2b 00 00       	call   a129 <open>
+    756c:	83 c4 10             	add    $0x10,%esp
+    756f:	85 c0                	test   %eax,%eax
+    7571:	0f 88 f5 01 00 00    	js     776c <preadvtest+0x22a>
+    7577:	89 c6                	mov    %eax,%esi
+  memset(a, 'a', sizeof(a));
+    7579:	83 ec 04             	sub    $0x4,%esp
+    757c:	6a 0a                	push   $0xa
+    757e:	6a 61                	push   $0x61
+    7580:	8d 7d c6             	lea    -0x3a(%ebp),%edi
+    7583:	57                   	push   %edi
+    7584:	e8 a8 24 00 00       	call   9a31 <memset>
+  memset(b, 'b', sizeof(b));
+    7589:	83 c4 0c             	add    $0xc,%esp
+    758c:	68 58 02 00 00       	push   $0x258
+    7591:	6a 62                	push   $0x62
+    7593:	8d 85 6e fd ff ff    	lea    -0x292(%ebp),%eax
+    7599:	50                   	push   %eax
+    759a:	e8 92 24 00 00       	call   9a31 <memset>
+  memset(c, 'c', sizeof(c));
+    759f:	83 c4 0c             	add    $0xc,%esp
+    75a2:	6a 05                	push   $0x5
+    75a4:	6a 63                	push   $0x63
+    75a6:	8d 9d 69 fd ff ff    	lea    -0x297(%ebp),%ebx
+    75ac:	53                   	push   %ebx
+    75ad:	e8 7f 24 00 00       	call   9a31 <memset>
+  iov[0].base = a;
+    75b2:	89 7d d0             	mov    %edi,-0x30(%ebp)
+  iov[0].len = sizeof(a);
+    75b5:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%ebp)
+  iov[1].base = b;
+    75bc:	8d 85 6e fd ff ff    	lea    -0x292(%ebp),%eax
+    75c2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  iov[1].len = sizeof(b);
+    75c5:	c7 45 dc 58 02 00 00 	movl   $0x258,-0x24(%ebp)
+  iov[2].base = c;
+    75cc:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+  iov[2].len = sizeof(c);
+    75cf:	c7 45 e4 05 00 00 00 	movl   $0x5,-0x1c(%ebp)
+  if(writev(fd, iov, 3) != 615){
+    75d6:	83 c4 0c             	add    $0xc,%esp
+    75d9:	6a 03                	push   $0x3
+    75db:	8d 45 d0             	lea    -0x30(%ebp),%eax
+    75de:	50                   	push   %eax
+    75df:	56                   	push   %esi
+    75e0:	e8 7e 2d 00 00       	call   a363 <writev>
+    75e5:	83 c4 10             	add    $0x10,%esp
+    75e8:	3d 67 02 00 00       	cmp    $0x267,%eax
+    75ed:	0f 85 8d 01 00 00    	jne    7780 <preadvtest+0x23e>
+  if(pwrite(fd, "XY", 2, 9) != 2 || pread(fd, buf, 3, 8) != 3 ||
+    75f3:	6a 09                	push   $0x9
+    75f5:	6a 02                	push   $0x2
+    75f7:	68 46 c9 00 00       	push   $0xc946
+    75fc:	56                   	push   %esi
+    75fd:	e8 43 2d 00 00       	call   a345 <pwrite>
+    7602:	83 c4 10             	add    $0x10,%esp
+    7605:	83 f8 02             	cmp    $0x2,%eax
+    7608:	0f 85 86 01 00 00    	jne    7794 <preadvtest+0x252>
+    760e:	6a 08                	push   $0x8
+    7610:	6a 03                	push   $0x3
+    7612:	68 a0 2c 01 00       	push   $0x12ca0
+    7617:	56                   	push   %esi
+    7618:	e8 19 2d 00 00       	call   a336 <pread>
+    761d:	83 c4 10             	add    $0x10,%esp
+    7620:	83 f8 03             	cmp    $0x3,%eax
+    7623:	0f 85 6b 01 00 00    	jne    7794 <preadvtest+0x252>
+    7629:	80 3d a0 2c 01 00 61 	cmpb   $0x61,0x12ca0
+    7630:	0f 85 5e 01 00 00    	jne    7794 <preadvtest+0x252>
+     buf[0] != 'a' || buf[1] != 'X' || buf[2] != 'Y'){
+    7636:	80 3d a1 2c 01 00 58 	cmpb   $0x58,0x12ca1
+    763d:	0f 85 51 01 00 00    	jne    7794 <preadvtest+0x252>
+    7643:	80 3d a2 2c 01 00 59 	cmpb   $0x59,0x12ca2
+    764a:	0f 85 44 01 00 00    	jne    7794 <preadvtest+0x252>
+  if(write(fd, "d", 1) != 1 || pread(fd, buf, 10, 612) != 4 || buf[2] != 'c' || buf[3] != 'd'){
+    7650:	83 ec 04             	sub    $0x4,%esp
+    7653:	6a 01                	push   $0x1
+    7655:	68 62 b2 00 00       	push   $0xb262
+    765a:	56                   	push   %esi
+    765b:	e8 ab 2a 00 00       	call   a10b <write>
+    7660:	89 c3                	mov    %eax,%ebx
+    7662:	83 c4 10             	add    $0x10,%esp
+    7665:	83 f8 01             	cmp    $0x1,%eax
+    7668:	0f 85 3a 01 00 00    	jne    77a8 <preadvtest+0x266>
+    766e:	68 64 02 00 00       	push   $0x264
+    7673:	6a 0a                	push   $0xa
+    7675:	68 a0 2c 01 00       	push   $0x12ca0
+    767a:	56                   	push   %esi
+    767b:	e8 b6 2c 00 00       	call   a336 <pread>
+    7680:	83 c4 10             	add    $0x10,%esp
+    7683:	83 f8 04             	cmp    $0x4,%eax
+    7686:	0f 85 1c 01 00 00    	jne    77a8 <preadvtest+0x266>
+    768c:	80 3d a2 2c 01 00 63 	cmpb   $0x63,0x12ca2
+    7693:	0f 85 0f 01 00 00    	jne    77a8 <preadvtest+0x266>
+    7699:	80 3d a3 2c 01 00 64 	cmpb   $0x64,0x12ca3
+    76a0:	0f 85 02 01 00 00    	jne    77a8 <preadvtest+0x266>
+  close(fd);
+    76a6:	83 ec 0c             	sub    $0xc,%esp
+    76a9:	56                   	push   %esi
+    76aa:	e8 58 29 00 00       	call   a007 <close>
+  fd = open("prv", 0);
+    76af:	83 c4 08             	add    $0x8,%esp
+    76b2:	6a 00                	push   $0x0
+    76b4:	68 1a c9 00 00       	push   $0xc91a
+    76b9:	e8 6b 2a 00 00       	call   a129 <open>
+    76be:	89 c6                	mov    %eax,%esi
+  memset(a, 0, sizeof(a));
+    76c0:	83 c4 0c             	add    $0xc,%esp
+    76c3:	6a 0a                	push   $0xa
+    76c5:	6a 00                	push   $0x0
+    76c7:	8d 45 c6             	lea    -0x3a(%ebp),%eax
+    76ca:	50                   	push   %eax
+    76cb:	e8 61 23 00 00       	call   9a31 <memset>
+  memset(b, 0, sizeof(b));
+    76d0:	83 c4 0c             	add    $0xc,%esp
+    76d3:	68 58 02 00 00       	push   $0x258
+    76d8:	6a 00                	push   $0x0
+    76da:	8d 85 6e fd ff ff    	lea    -0x292(%ebp),%eax
+    76e0:	50                   	push   %eax
+    76e1:	e8 4b 23 00 00       	call   9a31 <memset>
+  memset(c, 0, sizeof(c));
+    76e6:	83 c4 0c             	add    $0xc,%esp
+    76e9:	6a 05                	push   $0x5
+    76eb:	6a 00                	push   $0x0
+    76ed:	8d 85 69 fd ff ff    	lea    -0x297(%ebp),%eax
+    76f3:	50                   	push   %eax
+    76f4:	e8 38 23 00 00       	call   9a31 <memset>
+  if(readv(fd, iov, 3) != 615){
+    76f9:	83 c4 0c             	add    $0xc,%esp
+    76fc:	6a 03                	push   $0x3
+    76fe:	8d 45 d0             	lea    -0x30(%ebp),%eax
+    7701:	50                   	push   %eax
+    7702:	56                   	push   %esi
+    7703:	e8 4c 2c 00 00       	call   a354 <readv>
+    7708:	83 c4 10             	add    $0x10,%esp
+    770b:	3d 67 02 00 00       	cmp    $0x267,%eax
+    7710:	0f 85 a6 00 00 00    	jne    77bc <preadvtest+0x27a>
+  if(a[8] != 'a' || a[9] != 'X' || b[0] != 'Y' || c[0] != 'c' || c[4] != 'c')
+    7716:	80 7d ce 61          	cmpb   $0x61,-0x32(%ebp)
+    771a:	0f 85 27 01 00 00    	jne    7847 <preadvtest+0x305>
+    7720:	80 7d cf 58          	cmpb   $0x58,-0x31(%ebp)
+    7724:	0f 85 1d 01 00 00    	jne    7847 <preadvtest+0x305>
+    772a:	80 bd 6e fd ff ff 59 	cmpb   $0x59,-0x292(%ebp)
+    7731:	0f 85 10 01 00 00    	jne    7847 <preadvtest+0x305>
+    7737:	80 bd 69 fd ff ff 63 	cmpb   $0x63,-0x297(%ebp)
+    773e:	0f 85 03 01 00 00    	jne    7847 <preadvtest+0x305>
+    7744:	80 bd 6d fd ff ff 63 	cmpb   $0x63,-0x293(%ebp)
+    774b:	0f 85 f6 00 00 00    	jne    7847 <preadvtest+0x305>
+  for(i = 1; i < sizeof(b); i++)
+    7751:	81 fb 57 02 00 00    	cmp    $0x257,%ebx
+    7757:	77 77                	ja     77d0 <preadvtest+0x28e>
+    if(b[i] != 'b')
+    7759:	80 bc 1d 6e fd ff ff 	cmpb   $0x62,-0x292(%ebp,%ebx,1)
+    7760:	62 
+    7761:	0f 85 e0 00 00 00    	jne    7847 <preadvtest+0x305>
+  for(i = 1; i < sizeof(b); i++)
+    7767:	83 c3 01             	add    $0x1,%ebx
+    776a:	eb e5                	jmp    7751 <preadvtest+0x20f>
+    printf(1, "prv: create failed\n");
+    776c:	83 ec 08             	sub    $0x8,%esp
+    776f:	68 1e c9 00 00       	push   $0xc91e
+    7774:	6a 01                	push   $0x1
+    7776:	e8 96 2d 00 00       	call   a511 <printf>
+    exit();
+    777b:	e8 58 28 00 00       	call   9fd8 <exit>
+    printf(1, "prv: writev failed\n");
+    7780:	83 ec 08             	sub    $0x8,%esp
+    7783:	68 32 c9 00 00       	push   $0xc932
+    7788:	6a 01                	push   $0x1
+    778a:	e8 82 2d 00 00       	call   a511 <printf>
+    exit();
+    778f:	e8 44 28 00 00       	call   9fd8 <exit>
+    printf(1, "prv: pwrite/pread wrong\n");
+    7794:	83 ec 08             	sub    $0x8,%esp
+    7797:	68 49 c9 00 00       	push   $0xc949
+    779c:	6a 01                	push   $0x1
+    779e:	e8 6e 2d 00 00       	call   a511 <printf>
+    exit();
+    77a3:	e8 30 28 00 00       	call   9fd8 <exit>
+    printf(1, "prv: offset moved\n");
+    77a8:	83 ec 08             	sub    $0x8,%esp
+    77ab:	68 62 c9 00 00       	push   $0xc962
+    77b0:	6a 01                	push   $0x1
+    77b2:	e8 5a 2d 00 00       	call   a511 <printf>
+    exit();
+    77b7:	e8 1c 28 00 00       	call   9fd8 <exit>
+    printf(1, "prv: readv failed\n");
+    77bc:	83 ec 08             	sub    $0x8,%esp
+    77bf:	68 75 c9 00 00       	push   $0xc975
+    77c4:	6a 01                	push   $0x1
+    77c6:	e8 46 2d 00 00       	call   a511 <printf>
+    exit();
+    77cb:	e8 08 28 00 00       	call   9fd8 <exit>
+  if(read(fd, buf, 10) != 1 || buf[0] != 'd')
+    77d0:	83 ec 04             	sub    $0x4,%esp
+    77d3:	6a 0a                	push   $0xa
+    77d5:	68 a0 2c 01 00       	push   $0x12ca0
+    77da:	56                   	push   %esi
+    77db:	e8 1c 29 00 00       	call   a0fc <read>
+    77e0:	83 c4 10             	add    $0x10,%esp
+    77e3:	83 f8 01             	cmp    $0x1,%eax
+    77e6:	75 5f                	jne    7847 <preadvtest+0x305>
+    77e8:	80 3d a0 2c 01 00 64 	cmpb   $0x64,0x12ca0
+    77ef:	75 56                	jne    7847 <preadvtest+0x305>
+  if(pread(fd, buf, 1, -1) >= 0){
+    77f1:	6a ff                	push   $0xffffffff
+    77f3:	6a 01                	push   $0x1
+    77f5:	68 a0 2c 01 00       	push   $0x12ca0
+    77fa:	56                   	push   %esi
+    77fb:	e8 36 2b 00 00       	call   a336 <pread>
+    7800:	83 c4 10             	add    $0x10,%esp
+    7803:	85 c0                	test   %eax,%eax
+    7805:	79 2c                	jns    7833 <preadvtest+0x2f1>
+  close(fd);
+    7807:	83 ec 0c             	sub    $0xc,%esp
+    780a:	56                   	push   %esi
+    780b:	e8 f7 27 00 00       	call   a007 <close>
+  unlink("prv");
+    7810:	c7 04 24 1a c9 00 00 	movl   $0xc91a,(%esp)
+    7817:	e8 2b 29 00 00       	call   a147 <unlink>
+  printf(1, "pread/readv test OK\n");
+    781c:	83 c4 08             	add    $0x8,%esp
+    781f:	68 a1 c9 00 00       	push   $0xc9a1
+    7824:	6a 01                	push   $0x1
+    7826:	e8 e6 2c 00 00       	call   a511 <printf>
+}
+    782b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    782e:	5b                   	pop    %ebx
+    782f:	5e                   	pop    %esi
+    7830:	5f                   	pop    %edi
+    7831:	5d                   	pop    %ebp
+    7832:	c3                   	ret
+    printf(1, "prv: pread at -1 worked\n");
+    7833:	83 ec 08             	sub    $0x8,%esp
+    7836:	68 88 c9 00 00       	push   $0xc988
+    783b:	6a 01                	push   $0x1
+    783d:	e8 cf 2c 00 00       	call   a511 <printf>
+    exit();
+    7842:	e8 91 27 00 00       	call   9fd8 <exit>
+  printf(1, "prv: readv data wrong\n");
+    7847:	83 ec 08             	sub    $0x8,%esp
+    784a:	68 b6 c9 00 00       	push   $0xc9b6
+    784f:	6a 01                	push   $0x1
+    7851:	e8 bb 2c 00 00       	call   a511 <printf>
+  exit();
+    7856:	e8 7d 27 00 00       	call   9fd8 <exit>
+
+0000785b <faultaroundtest>:
+{
+    785b:	55                   	push   %ebp
+    785c:	89 e5                	mov    %esp,%ebp
+    785e:	56                   	push   %esi
+    785f:	53                   	push   %ebx
+    7860:	83 ec 48             	sub    $0x48,%esp
+  printf(1, "faultaround test\n");
+    7863:	68 cd c9 00 00       	push   $0xc9cd
+    7868:	6a 01                	push   $0x1
+    786a:	e8 a2 2c 00 00       	call   a511 <printf>
+  old = faultaround(16);
+    786f:	c7 04 24 10 00 00 00 	movl   $0x10,(%esp)
+    7876:	e8 71 29 00 00       	call   a1ec <faultaround>
+    787b:	89 c3                	mov    %eax,%ebx
+  if(faultaround(0) != 16 || faultaround(10000) != 16 || faultaround(0) > 64){
+    787d:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    7884:	e8 63 29 00 00       	call   a1ec <faultaround>
+    7889:	83 c4 10             	add    $0x10,%esp
+    788c:	83 f8 10             	cmp    $0x10,%eax
+    788f:	0f 85 9a 00 00 00    	jne    792f <faultaroundtest+0xd4>
+    7895:	83 ec 0c             	sub    $0xc,%esp
+    7898:	68 10 27 00 00       	push   $0x2710
+    789d:	e8 4a 29 00 00       	call   a1ec <faultaround>
+    78a2:	83 c4 10             	add    $0x10,%esp
+    78a5:	83 f8 10             	cmp    $0x10,%eax
+    78a8:	0f 85 81 00 00 00    	jne    792f <faultaroundtest+0xd4>
+    78ae:	83 ec 0c             	sub    $0xc,%esp
+    78b1:	6a 00                	push   $0x0
+    78b3:	e8 34 29 00 00       	call   a1ec <faultaround>
+    78b8:	83 c4 10             	add    $0x10,%esp
+    78bb:	83 f8 40             	cmp    $0x40,%eax
+    78be:	7f 6f                	jg     792f <faultaroundtest+0xd4>
+  faultaround(16);
+    78c0:	83 ec 0c             	sub    $0xc,%esp
+    78c3:	6a 10                	push   $0x10
+    78c5:	e8 22 29 00 00       	call   a1ec <faultaround>
+  if(faultstat(-1, f0) < 0){
+    78ca:	83 c4 08             	add    $0x8,%esp
+    78cd:	8d 45 dc             	lea    -0x24(%ebp),%eax
+    78d0:	50                   	push   %eax
+    78d1:	6a ff                	push   $0xffffffff
+    78d3:	e8 23 29 00 00       	call   a1fb <faultstat>
+    78d8:	83 c4 10             	add    $0x10,%esp
+    78db:	85 c0                	test   %eax,%eax
+    78dd:	78 64                	js     7943 <faultaroundtest+0xe8>
+  a = sbrk(1024*1024);
+    78df:	83 ec 0c             	sub    $0xc,%esp
+    78e2:	68 00 00 10 00       	push   $0x100000
+    78e7:	e8 c4 28 00 00       	call   a1b0 <sbrk>
+    78ec:	89 c1                	mov    %eax,%ecx
+  if(a == (char*)-1){
+    78ee:	83 c4 10             	add    $0x10,%esp
+    78f1:	83 f8 ff             	cmp    $0xffffffff,%eax
+    78f4:	74 61                	je     7957 <faultaroundtest+0xfc>
+  for(i = 0; i < 1024*1024; i += 4096){
+    78f6:	b8 00 00 00 00       	mov    $0x0,%eax
+    78fb:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+    7900:	0f 8f 88 00 00 00    	jg     798e <faultaroundtest+0x133>
+    if(a[i] != 0 || a[i+4095] != 0){
+    7906:	8d 34 01             	lea    (%ecx,%eax,1),%esi
+    7909:	80 3e 00             	cmpb   $0x0,(%esi)
+    790c:	75 5d                	jne    796b <faultaroundtest+0x110>
+    790e:	80 bc 01 ff 0f 00 00 	cmpb   $0x0,0xfff(%ecx,%eax,1)
+    7915:	00 
+    7916:	75 53                	jne    796b <faultaroundtest+0x110>
+    a[i] = i/4096;
+    7918:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+    791e:	85 c0                	test   %eax,%eax
+    7920:	0f 49 d0             	cmovns %eax,%edx
+    7923:	c1 fa 0c             	sar    $0xc,%edx
+    7926:	88 16                	mov    %dl,(%esi)
+  for(i = 0; i < 1024*1024; i += 4096){
+    7928:	05 00 10 00 00       	add    $0x1000,%eax
+    792d:	eb cc                	jmp    78fb <faultaroundtest+0xa0>
+    printf(1, "faultaround setting wrong\n");
+    792f:	83 ec 08             	sub    $0x8,%esp
+    7932:	68 df c9 00 00       	push   $0xc9df
+    7937:	6a 01                	push   $0x1
+    7939:	e8 d3 2b 00 00       	call   a511 <printf>
+    exit();
+    793e:	e8 95 26 00 00       	call   9fd8 <exit>
+    printf(1, "faultstat failed\n");
+    7943:	83 ec 08             	sub    $0x8,%esp
+    7946:	68 fa c9 00 00       	push   $0xc9fa
+    794b:	6a 01                	push   $0x1
+    794d:	e8 bf 2b 00 00       	call   a511 <printf>
+    exit();
+    7952:	e8 81 26 00 00       	call   9fd8 <exit>
+    printf(1, "sbrk failed\n");
+    7957:	83 ec 08             	sub    $0x8,%esp
+    795a:	68 3f c6 00 00       	push   $0xc63f
+    795f:	6a 01                	push   $0x1
+    7961:	e8 ab 2b 00 00       	call   a511 <printf>
+    exit();
+    7966:	e8 6d 26 00 00       	call   9fd8 <exit>
+      printf(1, "faultaround: page %d not zero\n", i/4096);
+    796b:	83 ec 04             	sub    $0x4,%esp
+    796e:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+    7974:	85 c0                	test   %eax,%eax
+    7976:	0f 48 c2             	cmovs  %edx,%eax
+    7979:	c1 f8 0c             	sar    $0xc,%eax
+    797c:	50                   	push   %eax
+    797d:	68 1c e4 00 00       	push   $0xe41c
+    7982:	6a 01                	push   $0x1
+    7984:	e8 88 2b 00 00       	call   a511 <printf>
+      exit();
+    7989:	e8 4a 26 00 00       	call   9fd8 <exit>
+  for(i = 0; i < 1024*1024; i += 4096){
+    798e:	b8 00 00 00 00       	mov    $0x0,%eax
+    7993:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+    7998:	7f 2f                	jg     79c9 <faultaroundtest+0x16e>
+    if(a[i] != (char)(i/4096)){
+    799a:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+    79a0:	85 c0                	test   %eax,%eax
+    79a2:	0f 49 d0             	cmovns %eax,%edx
+    79a5:	c1 fa 0c             	sar    $0xc,%edx
+    79a8:	38 14 01             	cmp    %dl,(%ecx,%eax,1)
+    79ab:	75 07                	jne    79b4 <faultaroundtest+0x159>
+  for(i = 0; i < 1024*1024; i += 4096){
+    79ad:	05 00 10 00 00       	add    $0x1000,%eax
+    79b2:	eb df                	jmp    7993 <faultaroundtest+0x138>
+      printf(1, "faultaround: page %d lost its data\n", i/4096);
+    79b4:	83 ec 04             	sub    $0x4,%esp
+    79b7:	52                   	push   %edx
+    79b8:	68 3c e4 00 00       	push   $0xe43c
+    79bd:	6a 01                	push   $0x1
+    79bf:	e8 4d 2b 00 00       	call   a511 <printf>
+      exit();
+    79c4:	e8 0f 26 00 00       	call   9fd8 <exit>
+  faultstat(-1, f1);
+    79c9:	83 ec 08             	sub    $0x8,%esp
+    79cc:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    79cf:	50                   	push   %eax
+    79d0:	6a ff                	push   $0xffffffff
+    79d2:	e8 24 28 00 00       	call   a1fb <faultstat>
+  if(f1[FAULT_ZERO] - f0[FAULT_ZERO] >= 256 || f1[FAULT_COW] - f0[FAULT_COW] < 256){
+    79d7:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    79da:	2b 45 e0             	sub    -0x20(%ebp),%eax
+    79dd:	83 c4 10             	add    $0x10,%esp
+    79e0:	3d ff 00 00 00       	cmp    $0xff,%eax
+    79e5:	77 3c                	ja     7a23 <faultaroundtest+0x1c8>
+    79e7:	8b 55 c8             	mov    -0x38(%ebp),%edx
+    79ea:	2b 55 e4             	sub    -0x1c(%ebp),%edx
+    79ed:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+    79f3:	76 2e                	jbe    7a23 <faultaroundtest+0x1c8>
+  sbrk(-1024*1024);
+    79f5:	83 ec 0c             	sub    $0xc,%esp
+    79f8:	68 00 00 f0 ff       	push   $0xfff00000
+    79fd:	e8 ae 27 00 00       	call   a1b0 <sbrk>
+  faultaround(old);
+    7a02:	89 1c 24             	mov    %ebx,(%esp)
+    7a05:	e8 e2 27 00 00       	call   a1ec <faultaround>
+  printf(1, "faultaround test OK\n");
+    7a0a:	83 c4 08             	add    $0x8,%esp
+    7a0d:	68 0c ca 00 00       	push   $0xca0c
+    7a12:	6a 01                	push   $0x1
+    7a14:	e8 f8 2a 00 00       	call   a511 <printf>
+}
+    7a19:	83 c4 10             	add    $0x10,%esp
+    7a1c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    7a1f:	5b                   	pop    %ebx
+    7a20:	5e                   	pop    %esi
+    7a21:	5d                   	pop    %ebp
+    7a22:	c3                   	ret
+    printf(1, "faultaround: unexpected fault counts zero %d cow %d\n",
+    7a23:	8b 55 c8             	mov    -0x38(%ebp),%edx
+    7a26:	2b 55 e4             	sub    -0x1c(%ebp),%edx
+    7a29:	52                   	push   %edx
+    7a2a:	50                   	push   %eax
+    7a2b:	68 60 e4 00 00       	push   $0xe460
+    7a30:	6a 01                	push   $0x1
+    7a32:	e8 da 2a 00 00       	call   a511 <printf>
+    exit();
+    7a37:	e8 9c 25 00 00       	call   9fd8 <exit>
+
+00007a3c <prioritytest>:
+{
+    7a3c:	55                   	push   %ebp
+    7a3d:	89 e5                	mov    %esp,%ebp
+    7a3f:	53                   	push   %ebx
+    7a40:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "priority test\n");
+    7a43:	68 21 ca 00 00       	push   $0xca21
+    7a48:	6a 01                	push   $0x1
+    7a4a:	e8 c2 2a 00 00       	call   a511 <printf>
+  pid = getpid();
+    7a4f:	e8 4d 27 00 00       	call   a1a1 <getpid>
+    7a54:	89 c3                	mov    %eax,%ebx
+  if(setpriority(pid, -1) != -1 || setpriority(pid, NPRIO) != -1 ||
+    7a56:	83 c4 08             	add    $0x8,%esp
+    7a59:	6a ff                	push   $0xffffffff
+    7a5b:	50                   	push   %eax
+    7a5c:	e8 e5 27 00 00       	call   a246 <setpriority>
+    7a61:	83 c4 10             	add    $0x10,%esp
+    7a64:	83 f8 ff             	cmp    $0xffffffff,%eax
+    7a67:	0f 85 af 00 00 00    	jne    7b1c <prioritytest+0xe0>
+    7a6d:	83 ec 08             	sub    $0x8,%esp
+    7a70:	6a 03                	push   $0x3
+    7a72:	53                   	push   %ebx
+    7a73:	e8 ce 27 00 00       	call   a246 <setpriority>
+    7a78:	83 c4 10             	add    $0x10,%esp
+    7a7b:	83 f8 ff             	cmp    $0xffffffff,%eax
+    7a7e:	0f 85 98 00 00 00    	jne    7b1c <prioritytest+0xe0>
+     setpriority(-1, 0) != -1 || getpriority(-1) != -1){
+    7a84:	83 ec 08             	sub    $0x8,%esp
+    7a87:	6a 00                	push   $0x0
+    7a89:	6a ff                	push   $0xffffffff
+    7a8b:	e8 b6 27 00 00       	call   a246 <setpriority>
+  if(setpriority(pid, -1) != -1 || setpriority(pid, NPRIO) != -1 ||
+    7a90:	83 c4 10             	add    $0x10,%esp
+    7a93:	83 f8 ff             	cmp    $0xffffffff,%eax
+    7a96:	0f 85 80 00 00 00    	jne    7b1c <prioritytest+0xe0>
+     setpriority(-1, 0) != -1 || getpriority(-1) != -1){
+    7a9c:	83 ec 0c             	sub    $0xc,%esp
+    7a9f:	6a ff                	push   $0xffffffff
+    7aa1:	e8 af 27 00 00       	call   a255 <getpriority>
+    7aa6:	83 c4 10             	add    $0x10,%esp
+    7aa9:	83 f8 ff             	cmp    $0xffffffff,%eax
+    7aac:	75 6e                	jne    7b1c <prioritytest+0xe0>
+  if(setpriority(pid, 1) != 0 || getpriority(pid) < 1){
+    7aae:	83 ec 08             	sub    $0x8,%esp
+    7ab1:	6a 01                	push   $0x1
+    7ab3:	53                   	push   %ebx
+    7ab4:	e8 8d 27 00 00       	call   a246 <setpriority>
+    7ab9:	83 c4 10             	add    $0x10,%esp
+    7abc:	85 c0                	test   %eax,%eax
+    7abe:	75 70                	jne    7b30 <prioritytest+0xf4>
+    7ac0:	83 ec 0c             	sub    $0xc,%esp
+    7ac3:	53                   	push   %ebx
+    7ac4:	e8 8c 27 00 00       	call   a255 <getpriority>
+    7ac9:	83 c4 10             	add    $0x10,%esp
+    7acc:	85 c0                	test   %eax,%eax
+    7ace:	7e 60                	jle    7b30 <prioritytest+0xf4>
+  pid = fork();
+    7ad0:	e8 ef 24 00 00       	call   9fc4 <fork>
+    7ad5:	89 c3                	mov    %eax,%ebx
+  if(pid < 0){
+    7ad7:	85 c0                	test   %eax,%eax
+    7ad9:	78 69                	js     7b44 <prioritytest+0x108>
+  if(pid == 0){
+    7adb:	0f 85 ad 00 00 00    	jne    7b8e <prioritytest+0x152>
+    prio = getpriority(getpid());
+    7ae1:	e8 bb 26 00 00       	call   a1a1 <getpid>
+    7ae6:	83 ec 0c             	sub    $0xc,%esp
+    7ae9:	50                   	push   %eax
+    7aea:	e8 66 27 00 00       	call   a255 <getpriority>
+    if(prio < 1 || prio >= NPRIO){
+    7aef:	8d 50 ff             	lea    -0x1(%eax),%edx
+    7af2:	83 c4 10             	add    $0x10,%esp
+    7af5:	83 fa 01             	cmp    $0x1,%edx
+    7af8:	77 5e                	ja     7b58 <prioritytest+0x11c>
+    for(i = 0; i < 100000; i++)
+    7afa:	81 fb 9f 86 01 00    	cmp    $0x1869f,%ebx
+    7b00:	7f 6b                	jg     7b6d <prioritytest+0x131>
+      if(getpriority(getpid()) < 1)
+    7b02:	e8 9a 26 00 00       	call   a1a1 <getpid>
+    7b07:	83 ec 0c             	sub    $0xc,%esp
+    7b0a:	50                   	push   %eax
+    7b0b:	e8 45 27 00 00       	call   a255 <getpriority>
+    7b10:	83 c4 10             	add    $0x10,%esp
+    7b13:	85 c0                	test   %eax,%eax
+    7b15:	7e 56                	jle    7b6d <prioritytest+0x131>
+    for(i = 0; i < 100000; i++)
+    7b17:	83 c3 01             	add    $0x1,%ebx
+    7b1a:	eb de                	jmp    7afa <prioritytest+0xbe>
+    printf(1, "priority: bad arguments accepted\n");
+    7b1c:	83 ec 08             	sub    $0x8,%esp
+    7b1f:	68 98 e4 00 00       	push   $0xe498
+    7b24:	6a 01                	push   $0x1
+    7b26:	e8 e6 29 00 00       	call   a511 <printf>
+    exit();
+    7b2b:	e8 a8 24 00 00       	call   9fd8 <exit>
+    printf(1, "priority: setpriority failed\n");
+    7b30:	83 ec 08             	sub    $0x8,%esp
+    7b33:	68 30 ca 00 00       	push   $0xca30
+    7b38:	6a 01                	push   $0x1
+    7b3a:	e8 d2 29 00 00       	call   a511 <printf>
+    exit();
+    7b3f:	e8 94 24 00 00       	call   9fd8 <exit>
+    printf(1, "fork failed\n");
+    7b44:	83 ec 08             	sub    $0x8,%esp
+    7b47:	68 b6 be 00 00       	push   $0xbeb6
+    7b4c:	6a 01                	push   $0x1
+    7b4e:	e8 be 29 00 00       	call   a511 <printf>
+    exit();
+    7b53:	e8 80 24 00 00       	call   9fd8 <exit>
+      printf(1, "priority: child has level %d\n", prio);
+    7b58:	83 ec 04             	sub    $0x4,%esp
+    7b5b:	50                   	push   %eax
+    7b5c:	68 4e ca 00 00       	push   $0xca4e
+    7b61:	6a 01                	push   $0x1
+    7b63:	e8 a9 29 00 00       	call   a511 <printf>
+      exit();
+    7b68:	e8 6b 24 00 00       	call   9fd8 <exit>
+    if(i < 100000)
+    7b6d:	81 fb 9f 86 01 00    	cmp    $0x1869f,%ebx
+    7b73:	7e 05                	jle    7b7a <prioritytest+0x13e>
+    exit();
+    7b75:	e8 5e 24 00 00       	call   9fd8 <exit>
+      printf(1, "priority: child rose above its base level\n");
+    7b7a:	83 ec 08             	sub    $0x8,%esp
+    7b7d:	68 bc e4 00 00       	push   $0xe4bc
+    7b82:	6a 01                	push   $0x1
+    7b84:	e8 88 29 00 00       	call   a511 <printf>
+    7b89:	83 c4 10             	add    $0x10,%esp
+    7b8c:	eb e7                	jmp    7b75 <prioritytest+0x139>
+  wait();
+    7b8e:	e8 4b 25 00 00       	call   a0de <wait>
+  setpriority(getpid(), 0);
+    7b93:	e8 09 26 00 00       	call   a1a1 <getpid>
+    7b98:	83 ec 08             	sub    $0x8,%esp
+    7b9b:	6a 00                	push   $0x0
+    7b9d:	50                   	push   %eax
+    7b9e:	e8 a3 26 00 00       	call   a246 <setpriority>
+  if(getpriority(getpid()) != 0){
+    7ba3:	e8 f9 25 00 00       	call   a1a1 <getpid>
+    7ba8:	89 04 24             	mov    %eax,(%esp)
+    7bab:	e8 a5 26 00 00       	call   a255 <getpriority>
+    7bb0:	83 c4 10             	add    $0x10,%esp
+    7bb3:	85 c0                	test   %eax,%eax
+    7bb5:	75 17                	jne    7bce <prioritytest+0x192>
+  printf(1, "priority test OK\n");
+    7bb7:	83 ec 08             	sub    $0x8,%esp
+    7bba:	68 84 ca 00 00       	push   $0xca84
+    7bbf:	6a 01                	push   $0x1
+    7bc1:	e8 4b 29 00 00       	call   a511 <printf>
+}
+    7bc6:	83 c4 10             	add    $0x10,%esp
+    7bc9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    7bcc:	c9                   	leave
+    7bcd:	c3                   	ret
+    printf(1, "priority: reset failed\n");
+    7bce:	83 ec 08             	sub    $0x8,%esp
+    7bd1:	68 6c ca 00 00       	push   $0xca6c
+    7bd6:	6a 01                	push   $0x1
+    7bd8:	e8 34 29 00 00       	call   a511 <printf>
+    exit();
+    7bdd:	e8 f6 23 00 00       	call   9fd8 <exit>
+
+00007be2 <affinitytest>:
+{
+    7be2:	55                   	push   %ebp
+    7be3:	89 e5                	mov    %esp,%ebp
+    7be5:	53                   	push   %ebx
+    7be6:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "affinity test\n");
+    7be9:	68 96 ca 00 00       	push   $0xca96
+    7bee:	6a 01                	push   $0x1
+    7bf0:	e8 1c 29 00 00       	call   a511 <printf>
+  all = getaffinity(getpid());
+    7bf5:	e8 a7 25 00 00       	call   a1a1 <getpid>
+    7bfa:	89 04 24             	mov    %eax,(%esp)
+    7bfd:	e8 cb 26 00 00       	call   a2cd <getaffinity>
+  if(all <= 0 || setaffinity(getpid(), 0) != -1){
+    7c02:	83 c4 10             	add    $0x10,%esp
+    7c05:	85 c0                	test   %eax,%eax
+    7c07:	0f 8e a0 00 00 00    	jle    7cad <affinitytest+0xcb>
+    7c0d:	89 c3                	mov    %eax,%ebx
+    7c0f:	e8 8d 25 00 00       	call   a1a1 <getpid>
+    7c14:	83 ec 08             	sub    $0x8,%esp
+    7c17:	6a 00                	push   $0x0
+    7c19:	50                   	push   %eax
+    7c1a:	e8 9f 26 00 00       	call   a2be <setaffinity>
+    7c1f:	83 c4 10             	add    $0x10,%esp
+    7c22:	83 f8 ff             	cmp    $0xffffffff,%eax
+    7c25:	0f 85 82 00 00 00    	jne    7cad <affinitytest+0xcb>
+  if(setaffinity(getpid(), 1) != 0 || getaffinity(getpid()) != 1){
+    7c2b:	e8 71 25 00 00       	call   a1a1 <getpid>
+    7c30:	83 ec 08             	sub    $0x8,%esp
+    7c33:	6a 01                	push   $0x1
+    7c35:	50                   	push   %eax
+    7c36:	e8 83 26 00 00       	call   a2be <setaffinity>
+    7c3b:	83 c4 10             	add    $0x10,%esp
+    7c3e:	85 c0                	test   %eax,%eax
+    7c40:	75 7f                	jne    7cc1 <affinitytest+0xdf>
+    7c42:	e8 5a 25 00 00       	call   a1a1 <getpid>
+    7c47:	83 ec 0c             	sub    $0xc,%esp
+    7c4a:	50                   	push   %eax
+    7c4b:	e8 7d 26 00 00       	call   a2cd <getaffinity>
+    7c50:	83 c4 10             	add    $0x10,%esp
+    7c53:	83 f8 01             	cmp    $0x1,%eax
+    7c56:	75 69                	jne    7cc1 <affinitytest+0xdf>
+  pid = fork();
+    7c58:	e8 67 23 00 00       	call   9fc4 <fork>
+  if(pid == 0){
+    7c5d:	85 c0                	test   %eax,%eax
+    7c5f:	74 74                	je     7cd5 <affinitytest+0xf3>
+  wait();
+    7c61:	e8 78 24 00 00       	call   a0de <wait>
+  if(setaffinity(getpid(), ~0) != 0 || getaffinity(getpid()) != all){
+    7c66:	e8 36 25 00 00       	call   a1a1 <getpid>
+    7c6b:	83 ec 08             	sub    $0x8,%esp
+    7c6e:	6a ff                	push   $0xffffffff
+    7c70:	50                   	push   %eax
+    7c71:	e8 48 26 00 00       	call   a2be <setaffinity>
+    7c76:	83 c4 10             	add    $0x10,%esp
+    7c79:	85 c0                	test   %eax,%eax
+    7c7b:	0f 85 83 00 00 00    	jne    7d04 <affinitytest+0x122>
+    7c81:	e8 1b 25 00 00       	call   a1a1 <getpid>
+    7c86:	83 ec 0c             	sub    $0xc,%esp
+    7c89:	50                   	push   %eax
+    7c8a:	e8 3e 26 00 00       	call   a2cd <getaffinity>
+    7c8f:	83 c4 10             	add    $0x10,%esp
+    7c92:	39 d8                	cmp    %ebx,%eax
+    7c94:	75 6e                	jne    7d04 <affinitytest+0x122>
+  printf(1, "affinity test OK\n");
+    7c96:	83 ec 08             	sub    $0x8,%esp
+    7c99:	68 bd ca 00 00       	push   $0xcabd
+    7c9e:	6a 01                	push   $0x1
+    7ca0:	e8 6c 28 00 00       	call   a511 <printf>
+}
+    7ca5:	83 c4 10             	add    $0x10,%esp
+    7ca8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    7cab:	c9                   	leave
+    7cac:	c3                   	ret
+    printf(1, "affinity: bad default or empty mask accepted\n");
+    7cad:	83 ec 08             	sub    $0x8,%esp
+    7cb0:	68 e8 e4 00 00       	push   $0xe4e8
+    7cb5:	6a 01                	push   $0x1
+    7cb7:	e8 55 28 00 00       	call   a511 <printf>
+    exit();
+    7cbc:	e8 17 23 00 00       	call   9fd8 <exit>
+    printf(1, "affinity: pin to cpu 0 failed\n");
+    7cc1:	83 ec 08             	sub    $0x8,%esp
+    7cc4:	68 18 e5 00 00       	push   $0xe518
+    7cc9:	6a 01                	push   $0x1
+    7ccb:	e8 41 28 00 00       	call   a511 <printf>
+    exit();
+    7cd0:	e8 03 23 00 00       	call   9fd8 <exit>
+    if(getaffinity(getpid()) != 1)
+    7cd5:	e8 c7 24 00 00       	call   a1a1 <getpid>
+    7cda:	83 ec 0c             	sub    $0xc,%esp
+    7cdd:	50                   	push   %eax
+    7cde:	e8 ea 25 00 00       	call   a2cd <getaffinity>
+    7ce3:	83 c4 10             	add    $0x10,%esp
+    7ce6:	83 f8 01             	cmp    $0x1,%eax
+    7ce9:	75 05                	jne    7cf0 <affinitytest+0x10e>
+    exit();
+    7ceb:	e8 e8 22 00 00       	call   9fd8 <exit>
+      printf(1, "affinity: child did not inherit the mask\n");
+    7cf0:	83 ec 08             	sub    $0x8,%esp
+    7cf3:	68 38 e5 00 00       	push   $0xe538
+    7cf8:	6a 01                	push   $0x1
+    7cfa:	e8 12 28 00 00       	call   a511 <printf>
+    7cff:	83 c4 10             	add    $0x10,%esp
+    7d02:	eb e7                	jmp    7ceb <affinitytest+0x109>
+    printf(1, "affinity: unpin failed\n");
+    7d04:	83 ec 08             	sub    $0x8,%esp
+    7d07:	68 a5 ca 00 00       	push   $0xcaa5
+    7d0c:	6a 01                	push   $0x1
+    7d0e:	e8 fe 27 00 00       	call   a511 <printf>
+    exit();
+    7d13:	e8 c0 22 00 00       	call   9fd8 <exit>
+
+00007d18 <clocktest>:
+{
+    7d18:	55                   	push   %ebp
+    7d19:	89 e5                	mov    %esp,%ebp
+    7d1b:	56                   	push   %esi
+    7d1c:	53                   	push   %ebx
+    7d1d:	83 ec 28             	sub    $0x28,%esp
+  printf(1, "clock test\n");
+    7d20:	68 aa b4 00 00       	push   $0xb4aa
+    7d25:	6a 01                	push   $0x1
+    7d27:	e8 e5 27 00 00       	call   a511 <printf>
+  if(clock_gettime(CLOCK_MONOTONIC, &a) < 0 || clock_gettime(7, &a) != -1){
+    7d2c:	83 c4 08             	add    $0x8,%esp
+    7d2f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    7d32:	50                   	push   %eax
+    7d33:	6a 01                	push   $0x1
+    7d35:	e8 a2 25 00 00       	call   a2dc <clock_gettime>
+    7d3a:	83 c4 10             	add    $0x10,%esp
+    7d3d:	85 c0                	test   %eax,%eax
+    7d3f:	0f 88 d3 00 00 00    	js     7e18 <clocktest+0x100>
+    7d45:	83 ec 08             	sub    $0x8,%esp
+    7d48:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    7d4b:	50                   	push   %eax
+    7d4c:	6a 07                	push   $0x7
+    7d4e:	e8 89 25 00 00       	call   a2dc <clock_gettime>
+    7d53:	83 c4 10             	add    $0x10,%esp
+    7d56:	83 f8 ff             	cmp    $0xffffffff,%eax
+    7d59:	0f 85 b9 00 00 00    	jne    7e18 <clocktest+0x100>
+  clock_gettime(CLOCK_MONOTONIC, &a);
+    7d5f:	83 ec 08             	sub    $0x8,%esp
+    7d62:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    7d65:	50                   	push   %eax
+    7d66:	6a 01                	push   $0x1
+    7d68:	e8 6f 25 00 00       	call   a2dc <clock_gettime>
+  vclock_gettime(CLOCK_MONOTONIC, &b);
+    7d6d:	83 c4 08             	add    $0x8,%esp
+    7d70:	8d 45 e8             	lea    -0x18(%ebp),%eax
+    7d73:	50                   	push   %eax
+    7d74:	6a 01                	push   $0x1
+    7d76:	e8 36 1f 00 00       	call   9cb1 <vclock_gettime>
+  sleep(2);
+    7d7b:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+    7d82:	e8 38 24 00 00       	call   a1bf <sleep>
+  clock_gettime(CLOCK_MONOTONIC, &c);
+    7d87:	83 c4 08             	add    $0x8,%esp
+    7d8a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    7d8d:	50                   	push   %eax
+    7d8e:	6a 01                	push   $0x1
+    7d90:	e8 47 25 00 00       	call   a2dc <clock_gettime>
+  if(b.tv_sec < a.tv_sec || (b.tv_sec == a.tv_sec && b.tv_nsec < a.tv_nsec)){
+    7d95:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    7d98:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    7d9b:	83 c4 10             	add    $0x10,%esp
+    7d9e:	39 d0                	cmp    %edx,%eax
+    7da0:	0f 82 92 00 00 00    	jb     7e38 <clocktest+0x120>
+    7da6:	0f 84 80 00 00 00    	je     7e2c <clocktest+0x114>
+  ms = (c.tv_sec - b.tv_sec)*1000 + c.tv_nsec/1000000 - b.tv_nsec/1000000;
+    7dac:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    7daf:	29 c1                	sub    %eax,%ecx
+    7db1:	69 c9 e8 03 00 00    	imul   $0x3e8,%ecx,%ecx
+    7db7:	bb 83 de 1b 43       	mov    $0x431bde83,%ebx
+    7dbc:	89 d8                	mov    %ebx,%eax
+    7dbe:	f7 65 e4             	mull   -0x1c(%ebp)
+    7dc1:	c1 ea 12             	shr    $0x12,%edx
+    7dc4:	01 d1                	add    %edx,%ecx
+    7dc6:	8b 75 ec             	mov    -0x14(%ebp),%esi
+    7dc9:	89 f0                	mov    %esi,%eax
+    7dcb:	f7 e3                	mul    %ebx
+    7dcd:	c1 ea 12             	shr    $0x12,%edx
+    7dd0:	29 d1                	sub    %edx,%ecx
+  if(ms < 10 || ms > 5000 || b.tv_nsec >= 1000000000){
+    7dd2:	8d 41 f6             	lea    -0xa(%ecx),%eax
+    7dd5:	3d 7e 13 00 00       	cmp    $0x137e,%eax
+    7dda:	77 70                	ja     7e4c <clocktest+0x134>
+    7ddc:	81 fe ff c9 9a 3b    	cmp    $0x3b9ac9ff,%esi
+    7de2:	77 68                	ja     7e4c <clocktest+0x134>
+  vclock_gettime(CLOCK_REALTIME, &a);
+    7de4:	83 ec 08             	sub    $0x8,%esp
+    7de7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    7dea:	50                   	push   %eax
+    7deb:	6a 00                	push   $0x0
+    7ded:	e8 bf 1e 00 00       	call   9cb1 <vclock_gettime>
+  if(a.tv_sec < 1500000000){
+    7df2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    7df5:	83 c4 10             	add    $0x10,%esp
+    7df8:	3d ff 2e 68 59       	cmp    $0x59682eff,%eax
+    7dfd:	76 62                	jbe    7e61 <clocktest+0x149>
+  printf(1, "clock test OK\n");
+    7dff:	83 ec 08             	sub    $0x8,%esp
+    7e02:	68 e7 b4 00 00       	push   $0xb4e7
+    7e07:	6a 01                	push   $0x1
+    7e09:	e8 03 27 00 00       	call   a511 <printf>
+}
+    7e0e:	83 c4 10             	add    $0x10,%esp
+    7e11:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    7e14:	5b                   	pop    %ebx
+    7e15:	5e                   	pop    %esi
+    7e16:	5d                   	pop    %ebp
+    7e17:	c3                   	ret
+    printf(1, "clock: clock_gettime failed\n");
+    7e18:	83 ec 08             	sub    $0x8,%esp
+    7e1b:	68 cf ca 00 00       	push   $0xcacf
+    7e20:	6a 01                	push   $0x1
+    7e22:	e8 ea 26 00 00       	call   a511 <printf>
+    exit();
+    7e27:	e8 ac 21 00 00       	call   9fd8 <exit>
+  if(b.tv_sec < a.tv_sec || (b.tv_sec == a.tv_sec && b.tv_nsec < a.tv_nsec)){
+    7e2c:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    7e2f:	39 5d ec             	cmp    %ebx,-0x14(%ebp)
+    7e32:	0f 83 74 ff ff ff    	jae    7dac <clocktest+0x94>
+    printf(1, "clock: clock page behind the system call\n");
+    7e38:	83 ec 08             	sub    $0x8,%esp
+    7e3b:	68 64 e5 00 00       	push   $0xe564
+    7e40:	6a 01                	push   $0x1
+    7e42:	e8 ca 26 00 00       	call   a511 <printf>
+    exit();
+    7e47:	e8 8c 21 00 00       	call   9fd8 <exit>
+    printf(1, "clock: sleep(2) took %d ms\n", ms);
+    7e4c:	83 ec 04             	sub    $0x4,%esp
+    7e4f:	51                   	push   %ecx
+    7e50:	68 ec ca 00 00       	push   $0xcaec
+    7e55:	6a 01                	push   $0x1
+    7e57:	e8 b5 26 00 00       	call   a511 <printf>
+    exit();
+    7e5c:	e8 77 21 00 00       	call   9fd8 <exit>
+    printf(1, "clock: realtime %d is before 2017\n", a.tv_sec);
+    7e61:	83 ec 04             	sub    $0x4,%esp
+    7e64:	50                   	push   %eax
+    7e65:	68 90 e5 00 00       	push   $0xe590
+    7e6a:	6a 01                	push   $0x1
+    7e6c:	e8 a0 26 00 00       	call   a511 <printf>
+    exit();
+    7e71:	e8 62 21 00 00       	call   9fd8 <exit>
+
+00007e76 <msince>:
+{
+    7e76:	55                   	push   %ebp
+    7e77:	89 e5                	mov    %esp,%ebp
+    7e79:	56                   	push   %esi
+    7e7a:	53                   	push   %ebx
+    7e7b:	83 ec 18             	sub    $0x18,%esp
+    7e7e:	89 c3                	mov    %eax,%ebx
+  vclock_gettime(CLOCK_MONOTONIC, &b);
+    7e80:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    7e83:	50                   	push   %eax
+    7e84:	6a 01                	push   $0x1
+    7e86:	e8 26 1e 00 00       	call   9cb1 <vclock_gettime>
+  return (b.tv_sec - a->tv_sec)*1000 + b.tv_nsec/1000000 - a->tv_nsec/1000000;
+    7e8b:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+    7e8e:	2b 0b                	sub    (%ebx),%ecx
+    7e90:	69 c9 e8 03 00 00    	imul   $0x3e8,%ecx,%ecx
+    7e96:	be 83 de 1b 43       	mov    $0x431bde83,%esi
+    7e9b:	89 f0                	mov    %esi,%eax
+    7e9d:	f7 65 f4             	mull   -0xc(%ebp)
+    7ea0:	c1 ea 12             	shr    $0x12,%edx
+    7ea3:	01 d1                	add    %edx,%ecx
+    7ea5:	8b 53 04             	mov    0x4(%ebx),%edx
+    7ea8:	89 d0                	mov    %edx,%eax
+    7eaa:	f7 e6                	mul    %esi
+    7eac:	c1 ea 12             	shr    $0x12,%edx
+    7eaf:	89 c8                	mov    %ecx,%eax
+    7eb1:	29 d0                	sub    %edx,%eax
+}
+    7eb3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    7eb6:	5b                   	pop    %ebx
+    7eb7:	5e                   	pop    %esi
+    7eb8:	5d                   	pop    %ebp
+    7eb9:	c3                   	ret
+
+00007eba <msleeptest>:
+{
+    7eba:	55                   	push   %ebp
+    7ebb:	89 e5                	mov    %esp,%ebp
+    7ebd:	56                   	push   %esi
+    7ebe:	53                   	push   %ebx
+    7ebf:	83 ec 18             	sub    $0x18,%esp
+  printf(1, "msleep test\n");
+    7ec2:	68 08 cb 00 00       	push   $0xcb08
+    7ec7:	6a 01                	push   $0x1
+    7ec9:	e8 43 26 00 00       	call   a511 <printf>
+  if(msleep(-1) != -1){
+    7ece:	c7 04 24 ff ff ff ff 	movl   $0xffffffff,(%esp)
+    7ed5:	e8 11 24 00 00       	call   a2eb <msleep>
+    7eda:	83 c4 10             	add    $0x10,%esp
+    7edd:	83 f8 ff             	cmp    $0xffffffff,%eax
+    7ee0:	75 41                	jne    7f23 <msleeptest+0x69>
+  vclock_gettime(CLOCK_MONOTONIC, &a);
+    7ee2:	83 ec 08             	sub    $0x8,%esp
+    7ee5:	8d 5d f0             	lea    -0x10(%ebp),%ebx
+    7ee8:	53                   	push   %ebx
+    7ee9:	6a 01                	push   $0x1
+    7eeb:	e8 c1 1d 00 00       	call   9cb1 <vclock_gettime>
+  msleep(3);
+    7ef0:	c7 04 24 03 00 00 00 	movl   $0x3,(%esp)
+    7ef7:	e8 ef 23 00 00       	call   a2eb <msleep>
+  if((ms = msince(&a)) < 3){
+    7efc:	89 d8                	mov    %ebx,%eax
+    7efe:	e8 73 ff ff ff       	call   7e76 <msince>
+    7f03:	83 c4 10             	add    $0x10,%esp
+    7f06:	83 f8 02             	cmp    $0x2,%eax
+    7f09:	76 2c                	jbe    7f37 <msleeptest+0x7d>
+  vclock_gettime(CLOCK_MONOTONIC, &a);
+    7f0b:	83 ec 08             	sub    $0x8,%esp
+    7f0e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    7f11:	50                   	push   %eax
+    7f12:	6a 01                	push   $0x1
+    7f14:	e8 98 1d 00 00       	call   9cb1 <vclock_gettime>
+  for(i = 0; i < 20; i++)
+    7f19:	83 c4 10             	add    $0x10,%esp
+    7f1c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    7f21:	eb 39                	jmp    7f5c <msleeptest+0xa2>
+    printf(1, "msleep: negative sleep accepted\n");
+    7f23:	83 ec 08             	sub    $0x8,%esp
+    7f26:	68 b4 e5 00 00       	push   $0xe5b4
+    7f2b:	6a 01                	push   $0x1
+    7f2d:	e8 df 25 00 00       	call   a511 <printf>
+    exit();
+    7f32:	e8 a1 20 00 00       	call   9fd8 <exit>
+    printf(1, "msleep: msleep(3) took %d ms\n", ms);
+    7f37:	83 ec 04             	sub    $0x4,%esp
+    7f3a:	50                   	push   %eax
+    7f3b:	68 15 cb 00 00       	push   $0xcb15
+    7f40:	6a 01                	push   $0x1
+    7f42:	e8 ca 25 00 00       	call   a511 <printf>
+    exit();
+    7f47:	e8 8c 20 00 00       	call   9fd8 <exit>
+    msleep(1);
+    7f4c:	83 ec 0c             	sub    $0xc,%esp
+    7f4f:	6a 01                	push   $0x1
+    7f51:	e8 95 23 00 00       	call   a2eb <msleep>
+  for(i = 0; i < 20; i++)
+    7f56:	83 c3 01             	add    $0x1,%ebx
+    7f59:	83 c4 10             	add    $0x10,%esp
+    7f5c:	83 fb 13             	cmp    $0x13,%ebx
+    7f5f:	7e eb                	jle    7f4c <msleeptest+0x92>
+  if((ms = msince(&a)) < 20 || ms >= 150){
+    7f61:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    7f64:	e8 0d ff ff ff       	call   7e76 <msince>
+    7f69:	83 f8 13             	cmp    $0x13,%eax
+    7f6c:	76 32                	jbe    7fa0 <msleeptest+0xe6>
+    7f6e:	3d 95 00 00 00       	cmp    $0x95,%eax
+    7f73:	77 2b                	ja     7fa0 <msleeptest+0xe6>
+  vclock_gettime(CLOCK_MONOTONIC, &a);
+    7f75:	83 ec 08             	sub    $0x8,%esp
+    7f78:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    7f7b:	50                   	push   %eax
+    7f7c:	6a 01                	push   $0x1
+    7f7e:	e8 2e 1d 00 00       	call   9cb1 <vclock_gettime>
+  for(i = 0; i < 8; i++){
+    7f83:	83 c4 10             	add    $0x10,%esp
+    7f86:	bb 00 00 00 00       	mov    $0x0,%ebx
+    7f8b:	83 fb 07             	cmp    $0x7,%ebx
+    7f8e:	7f 75                	jg     8005 <msleeptest+0x14b>
+    if((pid = fork()) < 0){
+    7f90:	e8 2f 20 00 00       	call   9fc4 <fork>
+    7f95:	85 c0                	test   %eax,%eax
+    7f97:	78 1c                	js     7fb5 <msleeptest+0xfb>
+    if(pid == 0){
+    7f99:	74 2e                	je     7fc9 <msleeptest+0x10f>
+  for(i = 0; i < 8; i++){
+    7f9b:	83 c3 01             	add    $0x1,%ebx
+    7f9e:	eb eb                	jmp    7f8b <msleeptest+0xd1>
+    printf(1, "msleep: 20 msleep(1) took %d ms\n", ms);
+    7fa0:	83 ec 04             	sub    $0x4,%esp
+    7fa3:	50                   	push   %eax
+    7fa4:	68 d8 e5 00 00       	push   $0xe5d8
+    7fa9:	6a 01                	push   $0x1
+    7fab:	e8 61 25 00 00       	call   a511 <printf>
+    exit();
+    7fb0:	e8 23 20 00 00       	call   9fd8 <exit>
+      printf(1, "msleep: fork failed\n");
+    7fb5:	83 ec 08             	sub    $0x8,%esp
+    7fb8:	68 33 cb 00 00       	push   $0xcb33
+    7fbd:	6a 01                	push   $0x1
+    7fbf:	e8 4d 25 00 00       	call   a511 <printf>
+      exit();
+    7fc4:	e8 0f 20 00 00       	call   9fd8 <exit>
+      msleep(5 + 7*i);
+    7fc9:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    7fd0:	29 de                	sub    %ebx,%esi
+    7fd2:	83 c6 05             	add    $0x5,%esi
+    7fd5:	83 ec 0c             	sub    $0xc,%esp
+    7fd8:	56                   	push   %esi
+    7fd9:	e8 0d 23 00 00       	call   a2eb <msleep>
+      if((ms = msince(&a)) < 5 + 7*i){
+    7fde:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    7fe1:	e8 90 fe ff ff       	call   7e76 <msince>
+    7fe6:	83 c4 10             	add    $0x10,%esp
+    7fe9:	39 f0                	cmp    %esi,%eax
+    7feb:	73 13                	jae    8000 <msleeptest+0x146>
+        printf(1, "msleep: sleeper %d woke after %d ms\n", i, ms);
+    7fed:	50                   	push   %eax
+    7fee:	53                   	push   %ebx
+    7fef:	68 fc e5 00 00       	push   $0xe5fc
+    7ff4:	6a 01                	push   $0x1
+    7ff6:	e8 16 25 00 00       	call   a511 <printf>
+        exit();
+    7ffb:	e8 d8 1f 00 00       	call   9fd8 <exit>
+      exit();
+    8000:	e8 d3 1f 00 00       	call   9fd8 <exit>
+  for(i = 0; i < 8; i++)
+    8005:	bb 00 00 00 00       	mov    $0x0,%ebx
+    800a:	eb 08                	jmp    8014 <msleeptest+0x15a>
+    wait();
+    800c:	e8 cd 20 00 00       	call   a0de <wait>
+  for(i = 0; i < 8; i++)
+    8011:	83 c3 01             	add    $0x1,%ebx
+    8014:	83 fb 07             	cmp    $0x7,%ebx
+    8017:	7e f3                	jle    800c <msleeptest+0x152>
+  printf(1, "msleep test OK\n");
+    8019:	83 ec 08             	sub    $0x8,%esp
+    801c:	68 48 cb 00 00       	push   $0xcb48
+    8021:	6a 01                	push   $0x1
+    8023:	e8 e9 24 00 00       	call   a511 <printf>
+}
+    8028:	83 c4 10             	add    $0x10,%esp
+    802b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    802e:	5b                   	pop    %ebx
+    802f:	5e                   	pop    %esi
+    8030:	5d                   	pop    %ebp
+    8031:	c3                   	ret
+
+00008032 <ioschedtest>:
+{
+    8032:	55                   	push   %ebp
+    8033:	89 e5                	mov    %esp,%ebp
+    8035:	57                   	push   %edi
+    8036:	56                   	push   %esi
+    8037:	53                   	push   %ebx
+    8038:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "iosched test\n");
+    803b:	68 58 cb 00 00       	push   $0xcb58
+    8040:	6a 01                	push   $0x1
+    8042:	e8 ca 24 00 00       	call   a511 <printf>
+  if(iostat("nosuch", &st) >= 0){
+    8047:	83 c4 08             	add    $0x8,%esp
+    804a:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    804d:	50                   	push   %eax
+    804e:	68 66 cb 00 00       	push   $0xcb66
+    8053:	e8 c0 22 00 00       	call   a318 <iostat>
+    8058:	83 c4 10             	add    $0x10,%esp
+    805b:	85 c0                	test   %eax,%eax
+    805d:	79 64                	jns    80c3 <ioschedtest+0x91>
+  for(k = 0; k < 2; k++){
+    805f:	bf 00 00 00 00       	mov    $0x0,%edi
+    8064:	83 ff 01             	cmp    $0x1,%edi
+    8067:	0f 8f 26 02 00 00    	jg     8293 <ioschedtest+0x261>
+    if(iostat(scheds[k], &st) < 0 || strcmp(st.sched, scheds[k]) != 0){
+    806d:	83 ec 08             	sub    $0x8,%esp
+    8070:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    8073:	50                   	push   %eax
+    8074:	ff 34 bd 74 e9 00 00 	push   0xe974(,%edi,4)
+    807b:	e8 98 22 00 00       	call   a318 <iostat>
+    8080:	83 c4 10             	add    $0x10,%esp
+    8083:	85 c0                	test   %eax,%eax
+    8085:	78 50                	js     80d7 <ioschedtest+0xa5>
+    8087:	83 ec 08             	sub    $0x8,%esp
+    808a:	ff 34 bd 74 e9 00 00 	push   0xe974(,%edi,4)
+    8091:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    8094:	50                   	push   %eax
+    8095:	e8 2c 19 00 00       	call   99c6 <strcmp>
+    809a:	89 c6                	mov    %eax,%esi
+    809c:	83 c4 10             	add    $0x10,%esp
+    809f:	85 c0                	test   %eax,%eax
+    80a1:	75 34                	jne    80d7 <ioschedtest+0xa5>
+    for(i = 0; i < 4; i++){
+    80a3:	89 45 b0             	mov    %eax,-0x50(%ebp)
+    80a6:	83 7d b0 03          	cmpl   $0x3,-0x50(%ebp)
+    80aa:	0f 8f 9a 01 00 00    	jg     824a <ioschedtest+0x218>
+      if((pid = fork()) < 0){
+    80b0:	e8 0f 1f 00 00       	call   9fc4 <fork>
+    80b5:	89 c3                	mov    %eax,%ebx
+    80b7:	85 c0                	test   %eax,%eax
+    80b9:	78 37                	js     80f2 <ioschedtest+0xc0>
+      if(pid)
+    80bb:	74 49                	je     8106 <ioschedtest+0xd4>
+    for(i = 0; i < 4; i++){
+    80bd:	83 45 b0 01          	addl   $0x1,-0x50(%ebp)
+    80c1:	eb e3                	jmp    80a6 <ioschedtest+0x74>
+    printf(1, "iosched: unknown scheduler accepted\n");
+    80c3:	83 ec 08             	sub    $0x8,%esp
+    80c6:	68 24 e6 00 00       	push   $0xe624
+    80cb:	6a 01                	push   $0x1
+    80cd:	e8 3f 24 00 00       	call   a511 <printf>
+    exit();
+    80d2:	e8 01 1f 00 00       	call   9fd8 <exit>
+      printf(1, "iosched: cannot switch to %s\n", scheds[k]);
+    80d7:	83 ec 04             	sub    $0x4,%esp
+    80da:	ff 34 bd 74 e9 00 00 	push   0xe974(,%edi,4)
+    80e1:	68 6d cb 00 00       	push   $0xcb6d
+    80e6:	6a 01                	push   $0x1
+    80e8:	e8 24 24 00 00       	call   a511 <printf>
+      exit();
+    80ed:	e8 e6 1e 00 00       	call   9fd8 <exit>
+        printf(1, "iosched: fork failed\n");
+    80f2:	83 ec 08             	sub    $0x8,%esp
+    80f5:	68 8b cb 00 00       	push   $0xcb8b
+    80fa:	6a 01                	push   $0x1
+    80fc:	e8 10 24 00 00       	call   a511 <printf>
+        exit();
+    8101:	e8 d2 1e 00 00       	call   9fd8 <exit>
+      file[0] = 'q';
+    8106:	c6 45 bd 71          	movb   $0x71,-0x43(%ebp)
+      file[1] = '0' + i;
+    810a:	0f b6 45 b0          	movzbl -0x50(%ebp),%eax
+    810e:	83 c0 30             	add    $0x30,%eax
+    8111:	88 45 be             	mov    %al,-0x42(%ebp)
+      file[2] = 0;
+    8114:	c6 45 bf 00          	movb   $0x0,-0x41(%ebp)
+      if((fd = open(file, O_CREATE|O_RDWR)) < 0){
+    8118:	83 ec 08             	sub    $0x8,%esp
+    811b:	68 02 02 00 00       	push   $0x202
+    8120:	8d 45 bd             	lea    -0x43(%ebp),%eax
+    8123:	50                   	push   %eax
+    8124:	e8 00 20 00 00       	call   a129 <open>
+    8129:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+    812c:	83 c4 10             	add    $0x10,%esp
+    812f:	85 c0                	test   %eax,%eax
+    8131:	78 47                	js     817a <ioschedtest+0x148>
+      memset(buf, 'a' + i, 512);
+    8133:	8b 7d b0             	mov    -0x50(%ebp),%edi
+    8136:	83 c7 61             	add    $0x61,%edi
+    8139:	83 ec 04             	sub    $0x4,%esp
+    813c:	68 00 02 00 00       	push   $0x200
+    8141:	57                   	push   %edi
+    8142:	68 a0 2c 01 00       	push   $0x12ca0
+    8147:	e8 e5 18 00 00       	call   9a31 <memset>
+      for(j = 0; j < 20; j++)
+    814c:	83 c4 10             	add    $0x10,%esp
+    814f:	89 de                	mov    %ebx,%esi
+    8151:	83 fe 13             	cmp    $0x13,%esi
+    8154:	7f 4c                	jg     81a2 <ioschedtest+0x170>
+        if(write(fd, buf, 512) != 512){
+    8156:	83 ec 04             	sub    $0x4,%esp
+    8159:	68 00 02 00 00       	push   $0x200
+    815e:	68 a0 2c 01 00       	push   $0x12ca0
+    8163:	ff 75 b4             	push   -0x4c(%ebp)
+    8166:	e8 a0 1f 00 00       	call   a10b <write>
+    816b:	83 c4 10             	add    $0x10,%esp
+    816e:	3d 00 02 00 00       	cmp    $0x200,%eax
+    8173:	75 19                	jne    818e <ioschedtest+0x15c>
+      for(j = 0; j < 20; j++)
+    8175:	83 c6 01             	add    $0x1,%esi
+    8178:	eb d7                	jmp    8151 <ioschedtest+0x11f>
+        printf(1, "iosched: create failed\n");
+    817a:	83 ec 08             	sub    $0x8,%esp
+    817d:	68 a1 cb 00 00       	push   $0xcba1
+    8182:	6a 01                	push   $0x1
+    8184:	e8 88 23 00 00       	call   a511 <printf>
+        exit();
+    8189:	e8 4a 1e 00 00       	call   9fd8 <exit>
+          printf(1, "iosched: write failed\n");
+    818e:	83 ec 08             	sub    $0x8,%esp
+    8191:	68 b9 cb 00 00       	push   $0xcbb9
+    8196:	6a 01                	push   $0x1
+    8198:	e8 74 23 00 00       	call   a511 <printf>
+          exit();
+    819d:	e8 36 1e 00 00       	call   9fd8 <exit>
+      close(fd);
+    81a2:	83 ec 0c             	sub    $0xc,%esp
+    81a5:	ff 75 b4             	push   -0x4c(%ebp)
+    81a8:	e8 5a 1e 00 00       	call   a007 <close>
+      if((fd = open(file, 0)) < 0){
+    81ad:	83 c4 08             	add    $0x8,%esp
+    81b0:	6a 00                	push   $0x0
+    81b2:	8d 45 bd             	lea    -0x43(%ebp),%eax
+    81b5:	50                   	push   %eax
+    81b6:	e8 6e 1f 00 00       	call   a129 <open>
+    81bb:	89 c6                	mov    %eax,%esi
+    81bd:	83 c4 10             	add    $0x10,%esp
+    81c0:	85 c0                	test   %eax,%eax
+    81c2:	78 3d                	js     8201 <ioschedtest+0x1cf>
+      for(j = 0; j < 20; j++)
+    81c4:	83 fb 13             	cmp    $0x13,%ebx
+    81c7:	7f 60                	jg     8229 <ioschedtest+0x1f7>
+        if(read(fd, buf, 512) != 512 || buf[0] != 'a' + i || buf[511] != 'a' + i){
+    81c9:	83 ec 04             	sub    $0x4,%esp
+    81cc:	68 00 02 00 00       	push   $0x200
+    81d1:	68 a0 2c 01 00       	push   $0x12ca0
+    81d6:	56                   	push   %esi
+    81d7:	e8 20 1f 00 00       	call   a0fc <read>
+    81dc:	83 c4 10             	add    $0x10,%esp
+    81df:	3d 00 02 00 00       	cmp    $0x200,%eax
+    81e4:	75 2f                	jne    8215 <ioschedtest+0x1e3>
+    81e6:	0f be 05 a0 2c 01 00 	movsbl 0x12ca0,%eax
+    81ed:	39 c7                	cmp    %eax,%edi
+    81ef:	75 24                	jne    8215 <ioschedtest+0x1e3>
+    81f1:	0f be 05 9f 2e 01 00 	movsbl 0x12e9f,%eax
+    81f8:	39 c7                	cmp    %eax,%edi
+    81fa:	75 19                	jne    8215 <ioschedtest+0x1e3>
+      for(j = 0; j < 20; j++)
+    81fc:	83 c3 01             	add    $0x1,%ebx
+    81ff:	eb c3                	jmp    81c4 <ioschedtest+0x192>
+        printf(1, "iosched: open failed\n");
+    8201:	83 ec 08             	sub    $0x8,%esp
+    8204:	68 d0 cb 00 00       	push   $0xcbd0
+    8209:	6a 01                	push   $0x1
+    820b:	e8 01 23 00 00       	call   a511 <printf>
+        exit();
+    8210:	e8 c3 1d 00 00       	call   9fd8 <exit>
+          printf(1, "iosched: bad data\n");
+    8215:	83 ec 08             	sub    $0x8,%esp
+    8218:	68 e6 cb 00 00       	push   $0xcbe6
+    821d:	6a 01                	push   $0x1
+    821f:	e8 ed 22 00 00       	call   a511 <printf>
+          exit();
+    8224:	e8 af 1d 00 00       	call   9fd8 <exit>
+      close(fd);
+    8229:	83 ec 0c             	sub    $0xc,%esp
+    822c:	56                   	push   %esi
+    822d:	e8 d5 1d 00 00       	call   a007 <close>
+      unlink(file);
+    8232:	8d 45 bd             	lea    -0x43(%ebp),%eax
+    8235:	89 04 24             	mov    %eax,(%esp)
+    8238:	e8 0a 1f 00 00       	call   a147 <unlink>
+      exit();
+    823d:	e8 96 1d 00 00       	call   9fd8 <exit>
+      wait();
+    8242:	e8 97 1e 00 00       	call   a0de <wait>
+    for(i = 0; i < 4; i++)
+    8247:	83 c6 01             	add    $0x1,%esi
+    824a:	83 fe 03             	cmp    $0x3,%esi
+    824d:	7e f3                	jle    8242 <ioschedtest+0x210>
+    iostat(0, &st);
+    824f:	83 ec 08             	sub    $0x8,%esp
+    8252:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    8255:	50                   	push   %eax
+    8256:	6a 00                	push   $0x0
+    8258:	e8 bb 20 00 00       	call   a318 <iostat>
+    if(st.nreq == 0 || st.nblk < st.nreq){
+    825d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+    8260:	83 c4 10             	add    $0x10,%esp
+    8263:	85 c0                	test   %eax,%eax
+    8265:	74 0d                	je     8274 <ioschedtest+0x242>
+    8267:	39 45 d0             	cmp    %eax,-0x30(%ebp)
+    826a:	72 08                	jb     8274 <ioschedtest+0x242>
+  for(k = 0; k < 2; k++){
+    826c:	83 c7 01             	add    $0x1,%edi
+    826f:	e9 f0 fd ff ff       	jmp    8064 <ioschedtest+0x32>
+      printf(1, "iosched: %s sent %d requests for %d blocks\n",
+    8274:	83 ec 0c             	sub    $0xc,%esp
+    8277:	ff 75 d0             	push   -0x30(%ebp)
+    827a:	50                   	push   %eax
+    827b:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    827e:	50                   	push   %eax
+    827f:	68 4c e6 00 00       	push   $0xe64c
+    8284:	6a 01                	push   $0x1
+    8286:	e8 86 22 00 00       	call   a511 <printf>
+      exit();
+    828b:	83 c4 20             	add    $0x20,%esp
+    828e:	e8 45 1d 00 00       	call   9fd8 <exit>
+  printf(1, "iosched test OK\n");
+    8293:	83 ec 08             	sub    $0x8,%esp
+    8296:	68 f9 cb 00 00       	push   $0xcbf9
+    829b:	6a 01                	push   $0x1
+    829d:	e8 6f 22 00 00       	call   a511 <printf>
+}
+    82a2:	83 c4 10             	add    $0x10,%esp
+    82a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    82a8:	5b                   	pop    %ebx
+    82a9:	5e                   	pop    %esi
+    82aa:	5f                   	pop    %edi
+    82ab:	5d                   	pop    %ebp
+    82ac:	c3                   	ret
+
+000082ad <bcachetest>:
+{
+    82ad:	55                   	push   %ebp
+    82ae:	89 e5                	mov    %esp,%ebp
+    82b0:	56                   	push   %esi
+    82b1:	53                   	push   %ebx
+    82b2:	81 ec 58 02 00 00    	sub    $0x258,%esp
+  printf(1, "bcache test\n");
+    82b8:	68 0a cc 00 00       	push   $0xcc0a
+    82bd:	6a 01                	push   $0x1
+    82bf:	e8 4d 22 00 00       	call   a511 <printf>
+  if((fd = open("bcache", O_CREATE|O_RDWR)) < 0){
+    82c4:	83 c4 08             	add    $0x8,%esp
+    82c7:	68 02 02 00 00       	push   $0x202
+    82cc:	68 17 cc 00 00       	push   $0xcc17
+    82d1:	e8 53 1e 00 00       	call   a129 <open>
+    82d6:	83 c4 10             	add    $0x10,%esp
+    82d9:	85 c0                	test   %eax,%eax
+    82db:	78 4c                	js     8329 <bcachetest+0x7c>
+    82dd:	89 c6                	mov    %eax,%esi
+  memset(buf, 'b', sizeof(buf));
+    82df:	83 ec 04             	sub    $0x4,%esp
+    82e2:	68 00 02 00 00       	push   $0x200
+    82e7:	6a 62                	push   $0x62
+    82e9:	8d 85 b0 fd ff ff    	lea    -0x250(%ebp),%eax
+    82ef:	50                   	push   %eax
+    82f0:	e8 3c 17 00 00       	call   9a31 <memset>
+  for(i = 0; i < 4*MAXOPBLOCKS*3; i++)
+    82f5:	83 c4 10             	add    $0x10,%esp
+    82f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    82fd:	81 fb 8f 00 00 00    	cmp    $0x8f,%ebx
+    8303:	7f 4c                	jg     8351 <bcachetest+0xa4>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    8305:	83 ec 04             	sub    $0x4,%esp
+    8308:	68 00 02 00 00       	push   $0x200
+    830d:	8d 85 b0 fd ff ff    	lea    -0x250(%ebp),%eax
+    8313:	50                   	push   %eax
+    8314:	56                   	push   %esi
+    8315:	e8 f1 1d 00 00       	call   a10b <write>
+    831a:	83 c4 10             	add    $0x10,%esp
+    831d:	3d 00 02 00 00       	cmp    $0x200,%eax
+    8322:	75 19                	jne    833d <bcachetest+0x90>
+  for(i = 0; i < 4*MAXOPBLOCKS*3; i++)
+    8324:	83 c3 01             	add    $0x1,%ebx
+    8327:	eb d4                	jmp    82fd <bcachetest+0x50>
+    printf(1, "bcache: create failed\n");
+    8329:	83 ec 08             	sub    $0x8,%esp
+    832c:	68 1e cc 00 00       	push   $0xcc1e
+    8331:	6a 01                	push   $0x1
+    8333:	e8 d9 21 00 00       	call   a511 <printf>
+    exit();
+    8338:	e8 9b 1c 00 00       	call   9fd8 <exit>
+      printf(1, "bcache: write failed\n");
+    833d:	83 ec 08             	sub    $0x8,%esp
+    8340:	68 35 cc 00 00       	push   $0xcc35
+    8345:	6a 01                	push   $0x1
+    8347:	e8 c5 21 00 00       	call   a511 <printf>
+      exit();
+    834c:	e8 87 1c 00 00       	call   9fd8 <exit>
+  close(fd);
+    8351:	83 ec 0c             	sub    $0xc,%esp
+    8354:	56                   	push   %esi
+    8355:	e8 ad 1c 00 00       	call   a007 <close>
+  bstat(&st0);
+    835a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    835d:	89 04 24             	mov    %eax,(%esp)
+    8360:	e8 a4 1f 00 00       	call   a309 <bstat>
+  for(i = 0; i < 2; i++){
+    8365:	83 c4 10             	add    $0x10,%esp
+    8368:	be 00 00 00 00       	mov    $0x0,%esi
+    836d:	eb 26                	jmp    8395 <bcachetest+0xe8>
+      printf(1, "bcache: open failed\n");
+    836f:	83 ec 08             	sub    $0x8,%esp
+    8372:	68 4b cc 00 00       	push   $0xcc4b
+    8377:	6a 01                	push   $0x1
+    8379:	e8 93 21 00 00       	call   a511 <printf>
+      exit();
+    837e:	e8 55 1c 00 00       	call   9fd8 <exit>
+    bstat(i == 0 ? &st1 : &st2);
+    8383:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    8386:	83 ec 0c             	sub    $0xc,%esp
+    8389:	50                   	push   %eax
+    838a:	e8 7a 1f 00 00       	call   a309 <bstat>
+  for(i = 0; i < 2; i++){
+    838f:	83 c6 01             	add    $0x1,%esi
+    8392:	83 c4 10             	add    $0x10,%esp
+    8395:	83 fe 01             	cmp    $0x1,%esi
+    8398:	7f 49                	jg     83e3 <bcachetest+0x136>
+    if((fd = open("bcache", 0)) < 0){
+    839a:	83 ec 08             	sub    $0x8,%esp
+    839d:	6a 00                	push   $0x0
+    839f:	68 17 cc 00 00       	push   $0xcc17
+    83a4:	e8 80 1d 00 00       	call   a129 <open>
+    83a9:	89 c3                	mov    %eax,%ebx
+    83ab:	83 c4 10             	add    $0x10,%esp
+    83ae:	85 c0                	test   %eax,%eax
+    83b0:	78 bd                	js     836f <bcachetest+0xc2>
+    while(read(fd, buf, sizeof(buf)) > 0)
+    83b2:	83 ec 04             	sub    $0x4,%esp
+    83b5:	68 00 02 00 00       	push   $0x200
+    83ba:	8d 85 b0 fd ff ff    	lea    -0x250(%ebp),%eax
+    83c0:	50                   	push   %eax
+    83c1:	53                   	push   %ebx
+    83c2:	e8 35 1d 00 00       	call   a0fc <read>
+    83c7:	83 c4 10             	add    $0x10,%esp
+    83ca:	85 c0                	test   %eax,%eax
+    83cc:	7f e4                	jg     83b2 <bcachetest+0x105>
+    close(fd);
+    83ce:	83 ec 0c             	sub    $0xc,%esp
+    83d1:	53                   	push   %ebx
+    83d2:	e8 30 1c 00 00       	call   a007 <close>
+    bstat(i == 0 ? &st1 : &st2);
+    83d7:	83 c4 10             	add    $0x10,%esp
+    83da:	85 f6                	test   %esi,%esi
+    83dc:	74 a5                	je     8383 <bcachetest+0xd6>
+    83de:	8d 45 b0             	lea    -0x50(%ebp),%eax
+    83e1:	eb a3                	jmp    8386 <bcachetest+0xd9>
+  unlink("bcache");
+    83e3:	83 ec 0c             	sub    $0xc,%esp
+    83e6:	68 17 cc 00 00       	push   $0xcc17
+    83eb:	e8 57 1d 00 00       	call   a147 <unlink>
+  if(st2.nbuf <= MAXOPBLOCKS*3 || st2.nfree > st2.nbuf || st1.hits < st0.hits){
+    83f0:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    83f3:	83 c4 10             	add    $0x10,%esp
+    83f6:	83 f8 24             	cmp    $0x24,%eax
+    83f9:	76 3a                	jbe    8435 <bcachetest+0x188>
+    83fb:	3b 45 b4             	cmp    -0x4c(%ebp),%eax
+    83fe:	72 35                	jb     8435 <bcachetest+0x188>
+    8400:	8b 4d e8             	mov    -0x18(%ebp),%ecx
+    8403:	39 4d d0             	cmp    %ecx,-0x30(%ebp)
+    8406:	72 2d                	jb     8435 <bcachetest+0x188>
+  if(st2.misses - st1.misses > (st1.misses - st0.misses) / 2 + 2){
+    8408:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    840b:	8b 55 bc             	mov    -0x44(%ebp),%edx
+    840e:	29 c2                	sub    %eax,%edx
+    8410:	2b 45 ec             	sub    -0x14(%ebp),%eax
+    8413:	d1 e8                	shr    %eax
+    8415:	83 c0 02             	add    $0x2,%eax
+    8418:	39 d0                	cmp    %edx,%eax
+    841a:	72 2e                	jb     844a <bcachetest+0x19d>
+  printf(1, "bcache test OK\n");
+    841c:	83 ec 08             	sub    $0x8,%esp
+    841f:	68 7d cc 00 00       	push   $0xcc7d
+    8424:	6a 01                	push   $0x1
+    8426:	e8 e6 20 00 00       	call   a511 <printf>
+}
+    842b:	83 c4 10             	add    $0x10,%esp
+    842e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    8431:	5b                   	pop    %ebx
+    8432:	5e                   	pop    %esi
+    8433:	5d                   	pop    %ebp
+    8434:	c3                   	ret
+    printf(1, "bcache: %d buffers, %d free\n", st2.nbuf, st2.nfree);
+    8435:	ff 75 b4             	push   -0x4c(%ebp)
+    8438:	50                   	push   %eax
+    8439:	68 60 cc 00 00       	push   $0xcc60
+    843e:	6a 01                	push   $0x1
+    8440:	e8 cc 20 00 00       	call   a511 <printf>
+    exit();
+    8445:	e8 8e 1b 00 00       	call   9fd8 <exit>
+    printf(1, "bcache: second pass missed %d times\n", st2.misses - st1.misses);
+    844a:	83 ec 04             	sub    $0x4,%esp
+    844d:	52                   	push   %edx
+    844e:	68 78 e6 00 00       	push   $0xe678
+    8453:	6a 01                	push   $0x1
+    8455:	e8 b7 20 00 00       	call   a511 <printf>
+    exit();
+    845a:	e8 79 1b 00 00       	call   9fd8 <exit>
+
+0000845f <lockcounts>:
+{
+    845f:	55                   	push   %ebp
+    8460:	89 e5                	mov    %esp,%ebp
+    8462:	57                   	push   %edi
+    8463:	56                   	push   %esi
+    8464:	53                   	push   %ebx
+    8465:	83 ec 40             	sub    $0x40,%esp
+    8468:	89 c7                	mov    %eax,%edi
+    846a:	89 d6                	mov    %edx,%esi
+  memset(sum, 0, sizeof(*sum));
+    846c:	6a 2c                	push   $0x2c
+    846e:	6a 00                	push   $0x0
+    8470:	52                   	push   %edx
+    8471:	e8 bb 15 00 00       	call   9a31 <memset>
+  for(i = 0; lockstat(i, &ls) == 0; i++)
+    8476:	83 c4 10             	add    $0x10,%esp
+    8479:	bb 00 00 00 00       	mov    $0x0,%ebx
+    847e:	eb 03                	jmp    8483 <lockcounts+0x24>
+    8480:	83 c3 01             	add    $0x1,%ebx
+    8483:	83 ec 08             	sub    $0x8,%esp
+    8486:	8d 45 bc             	lea    -0x44(%ebp),%eax
+    8489:	50                   	push   %eax
+    848a:	53                   	push   %ebx
+    848b:	e8 6a 1e 00 00       	call   a2fa <lockstat>
+    8490:	83 c4 10             	add    $0x10,%esp
+    8493:	85 c0                	test   %eax,%eax
+    8495:	75 22                	jne    84b9 <lockcounts+0x5a>
+    if(strcmp(ls.name, name) == 0){
+    8497:	83 ec 08             	sub    $0x8,%esp
+    849a:	57                   	push   %edi
+    849b:	8d 45 bc             	lea    -0x44(%ebp),%eax
+    849e:	50                   	push   %eax
+    849f:	e8 22 15 00 00       	call   99c6 <strcmp>
+    84a4:	83 c4 10             	add    $0x10,%esp
+    84a7:	85 c0                	test   %eax,%eax
+    84a9:	75 d5                	jne    8480 <lockcounts+0x21>
+      sum->nacq += ls.nacq;
+    84ab:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    84ae:	01 46 14             	add    %eax,0x14(%esi)
+      sum->ncontend += ls.ncontend;
+    84b1:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    84b4:	01 46 18             	add    %eax,0x18(%esi)
+    84b7:	eb c7                	jmp    8480 <lockcounts+0x21>
+}
+    84b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    84bc:	5b                   	pop    %ebx
+    84bd:	5e                   	pop    %esi
+    84be:	5f                   	pop    %edi
+    84bf:	5d                   	pop    %ebp
+    84c0:	c3                   	ret
+
+000084c1 <lockstattest>:
+{
+    84c1:	55                   	push   %ebp
+    84c2:	89 e5                	mov    %esp,%ebp
+    84c4:	53                   	push   %ebx
+    84c5:	83 ec 3c             	sub    $0x3c,%esp
+  printf(1, "lockstat test\n");
+    84c8:	68 8d cc 00 00       	push   $0xcc8d
+    84cd:	6a 01                	push   $0x1
+    84cf:	e8 3d 20 00 00       	call   a511 <printf>
+  if(lockstat(-1, 0) != 0){
+    84d4:	83 c4 08             	add    $0x8,%esp
+    84d7:	6a 00                	push   $0x0
+    84d9:	6a ff                	push   $0xffffffff
+    84db:	e8 1a 1e 00 00       	call   a2fa <lockstat>
+    84e0:	83 c4 10             	add    $0x10,%esp
+    84e3:	85 c0                	test   %eax,%eax
+    84e5:	75 43                	jne    852a <lockstattest+0x69>
+    84e7:	89 c3                	mov    %eax,%ebx
+  lockcounts("icache", &ls);
+    84e9:	8d 55 cc             	lea    -0x34(%ebp),%edx
+    84ec:	b8 b4 cc 00 00       	mov    $0xccb4,%eax
+    84f1:	e8 69 ff ff ff       	call   845f <lockcounts>
+  if(ls.nacq > 10){
+    84f6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    84f9:	83 f8 0a             	cmp    $0xa,%eax
+    84fc:	77 40                	ja     853e <lockstattest+0x7d>
+  for(i = 0; i < 100; i++){
+    84fe:	83 fb 63             	cmp    $0x63,%ebx
+    8501:	7f 64                	jg     8567 <lockstattest+0xa6>
+    if((fd = open("README", 0)) < 0){
+    8503:	83 ec 08             	sub    $0x8,%esp
+    8506:	6a 00                	push   $0x0
+    8508:	68 e6 be 00 00       	push   $0xbee6
+    850d:	e8 17 1c 00 00       	call   a129 <open>
+    8512:	83 c4 10             	add    $0x10,%esp
+    8515:	85 c0                	test   %eax,%eax
+    8517:	78 3a                	js     8553 <lockstattest+0x92>
+    close(fd);
+    8519:	83 ec 0c             	sub    $0xc,%esp
+    851c:	50                   	push   %eax
+    851d:	e8 e5 1a 00 00       	call   a007 <close>
+  for(i = 0; i < 100; i++){
+    8522:	83 c3 01             	add    $0x1,%ebx
+    8525:	83 c4 10             	add    $0x10,%esp
+    8528:	eb d4                	jmp    84fe <lockstattest+0x3d>
+    printf(1, "lockstat: reset failed\n");
+    852a:	83 ec 08             	sub    $0x8,%esp
+    852d:	68 9c cc 00 00       	push   $0xcc9c
+    8532:	6a 01                	push   $0x1
+    8534:	e8 d8 1f 00 00       	call   a511 <printf>
+    exit();
+    8539:	e8 9a 1a 00 00       	call   9fd8 <exit>
+    printf(1, "lockstat: %d icache acquisitions after a reset\n", ls.nacq);
+    853e:	83 ec 04             	sub    $0x4,%esp
+    8541:	50                   	push   %eax
+    8542:	68 a0 e6 00 00       	push   $0xe6a0
+    8547:	6a 01                	push   $0x1
+    8549:	e8 c3 1f 00 00       	call   a511 <printf>
+    exit();
+    854e:	e8 85 1a 00 00       	call   9fd8 <exit>
+      printf(1, "lockstat: open README failed\n");
+    8553:	83 ec 08             	sub    $0x8,%esp
+    8556:	68 bb cc 00 00       	push   $0xccbb
+    855b:	6a 01                	push   $0x1
+    855d:	e8 af 1f 00 00       	call   a511 <printf>
+      exit();
+    8562:	e8 71 1a 00 00       	call   9fd8 <exit>
+  lockcounts("icache", &ls);
+    8567:	8d 55 cc             	lea    -0x34(%ebp),%edx
+    856a:	b8 b4 cc 00 00       	mov    $0xccb4,%eax
+    856f:	e8 eb fe ff ff       	call   845f <lockcounts>
+  if(ls.nacq < 200 || ls.ncontend > ls.nacq){
+    8574:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    8577:	3d c7 00 00 00       	cmp    $0xc7,%eax
+    857c:	76 35                	jbe    85b3 <lockstattest+0xf2>
+    857e:	3b 45 e4             	cmp    -0x1c(%ebp),%eax
+    8581:	72 30                	jb     85b3 <lockstattest+0xf2>
+  if(lockstat(100000, &ls) != -1){
+    8583:	83 ec 08             	sub    $0x8,%esp
+    8586:	8d 45 cc             	lea    -0x34(%ebp),%eax
+    8589:	50                   	push   %eax
+    858a:	68 a0 86 01 00       	push   $0x186a0
+    858f:	e8 66 1d 00 00       	call   a2fa <lockstat>
+    8594:	83 c4 10             	add    $0x10,%esp
+    8597:	83 f8 ff             	cmp    $0xffffffff,%eax
+    859a:	75 2c                	jne    85c8 <lockstattest+0x107>
+  printf(1, "lockstat test OK\n");
+    859c:	83 ec 08             	sub    $0x8,%esp
+    859f:	68 f7 cc 00 00       	push   $0xccf7
+    85a4:	6a 01                	push   $0x1
+    85a6:	e8 66 1f 00 00       	call   a511 <printf>
+}
+    85ab:	83 c4 10             	add    $0x10,%esp
+    85ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    85b1:	c9                   	leave
+    85b2:	c3                   	ret
+    printf(1, "lockstat: icache acquired %d times, %d contended\n",
+    85b3:	ff 75 e4             	push   -0x1c(%ebp)
+    85b6:	50                   	push   %eax
+    85b7:	68 d0 e6 00 00       	push   $0xe6d0
+    85bc:	6a 01                	push   $0x1
+    85be:	e8 4e 1f 00 00       	call   a511 <printf>
+    exit();
+    85c3:	e8 10 1a 00 00       	call   9fd8 <exit>
+    printf(1, "lockstat: lock 100000 exists\n");
+    85c8:	83 ec 08             	sub    $0x8,%esp
+    85cb:	68 d9 cc 00 00       	push   $0xccd9
+    85d0:	6a 01                	push   $0x1
+    85d2:	e8 3a 1f 00 00       	call   a511 <printf>
+    exit();
+    85d7:	e8 fc 19 00 00       	call   9fd8 <exit>
+
+000085dc <threadtest>:
+{
+    85dc:	55                   	push   %ebp
+    85dd:	89 e5                	mov    %esp,%ebp
+    85df:	56                   	push   %esi
+    85e0:	53                   	push   %ebx
+  printf(1, "thread test\n");
+    85e1:	83 ec 08             	sub    $0x8,%esp
+    85e4:	68 09 cd 00 00       	push   $0xcd09
+    85e9:	6a 01                	push   $0x1
+    85eb:	e8 21 1f 00 00       	call   a511 <printf>
+  lock_init(&tlock);
+    85f0:	c7 04 24 e0 ad 01 00 	movl   $0x1ade0,(%esp)
+    85f7:	e8 ee 23 00 00       	call   a9ea <lock_init>
+  tcount = tgo = 0;
+    85fc:	c7 05 d8 ad 01 00 00 	movl   $0x0,0x1add8
+    8603:	00 00 00 
+    8606:	c7 05 dc ad 01 00 00 	movl   $0x0,0x1addc
+    860d:	00 00 00 
+  tpage = sbrk(4096);
+    8610:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+    8617:	e8 94 1b 00 00       	call   a1b0 <sbrk>
+    861c:	a3 d4 ad 01 00       	mov    %eax,0x1add4
+  c = tpage[0];
+    8621:	0f b6 30             	movzbl (%eax),%esi
+  for(i = 0; i < 4; i++){
+    8624:	83 c4 10             	add    $0x10,%esp
+    8627:	bb 00 00 00 00       	mov    $0x0,%ebx
+    862c:	83 fb 03             	cmp    $0x3,%ebx
+    862f:	7f 2e                	jg     865f <threadtest+0x83>
+    if(thread_create(threadwork, (void*)i) < 0){
+    8631:	83 ec 08             	sub    $0x8,%esp
+    8634:	53                   	push   %ebx
+    8635:	68 02 87 00 00       	push   $0x8702
+    863a:	e8 13 23 00 00       	call   a952 <thread_create>
+    863f:	83 c4 10             	add    $0x10,%esp
+    8642:	85 c0                	test   %eax,%eax
+    8644:	78 05                	js     864b <threadtest+0x6f>
+  for(i = 0; i < 4; i++){
+    8646:	83 c3 01             	add    $0x1,%ebx
+    8649:	eb e1                	jmp    862c <threadtest+0x50>
+      printf(1, "thread: thread_create failed\n");
+    864b:	83 ec 08             	sub    $0x8,%esp
+    864e:	68 16 cd 00 00       	push   $0xcd16
+    8653:	6a 01                	push   $0x1
+    8655:	e8 b7 1e 00 00       	call   a511 <printf>
+      exit();
+    865a:	e8 79 19 00 00       	call   9fd8 <exit>
+  if(wait() != -1){
+    865f:	e8 7a 1a 00 00       	call   a0de <wait>
+    8664:	83 f8 ff             	cmp    $0xffffffff,%eax
+    8667:	75 11                	jne    867a <threadtest+0x9e>
+  tgo = 1;
+    8669:	c7 05 d8 ad 01 00 01 	movl   $0x1,0x1add8
+    8670:	00 00 00 
+  for(n = 0; thread_join() > 0; n++)
+    8673:	bb 00 00 00 00       	mov    $0x0,%ebx
+    8678:	eb 17                	jmp    8691 <threadtest+0xb5>
+    printf(1, "thread: wait() reaped a thread\n");
+    867a:	83 ec 08             	sub    $0x8,%esp
+    867d:	68 04 e7 00 00       	push   $0xe704
+    8682:	6a 01                	push   $0x1
+    8684:	e8 88 1e 00 00       	call   a511 <printf>
+    exit();
+    8689:	e8 4a 19 00 00       	call   9fd8 <exit>
+  for(n = 0; thread_join() > 0; n++)
+    868e:	83 c3 01             	add    $0x1,%ebx
+    8691:	e8 1e 23 00 00       	call   a9b4 <thread_join>
+    8696:	85 c0                	test   %eax,%eax
+    8698:	7f f4                	jg     868e <threadtest+0xb2>
+  if(n != 4 || tcount != 4000){
+    869a:	83 fb 04             	cmp    $0x4,%ebx
+    869d:	75 37                	jne    86d6 <threadtest+0xfa>
+    869f:	a1 dc ad 01 00       	mov    0x1addc,%eax
+    86a4:	3d a0 0f 00 00       	cmp    $0xfa0,%eax
+    86a9:	75 2b                	jne    86d6 <threadtest+0xfa>
+  if(c != 0 || tpage[0] != 'x'){
+    86ab:	89 f0                	mov    %esi,%eax
+    86ad:	84 c0                	test   %al,%al
+    86af:	75 3d                	jne    86ee <threadtest+0x112>
+    86b1:	a1 d4 ad 01 00       	mov    0x1add4,%eax
+    86b6:	0f b6 00             	movzbl (%eax),%eax
+    86b9:	3c 78                	cmp    $0x78,%al
+    86bb:	75 31                	jne    86ee <threadtest+0x112>
+  printf(1, "thread test OK\n");
+    86bd:	83 ec 08             	sub    $0x8,%esp
+    86c0:	68 51 cd 00 00       	push   $0xcd51
+    86c5:	6a 01                	push   $0x1
+    86c7:	e8 45 1e 00 00       	call   a511 <printf>
+}
+    86cc:	83 c4 10             	add    $0x10,%esp
+    86cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    86d2:	5b                   	pop    %ebx
+    86d3:	5e                   	pop    %esi
+    86d4:	5d                   	pop    %ebp
+    86d5:	c3                   	ret
+    printf(1, "thread: joined %d, count %d\n", n, tcount);
+    86d6:	a1 dc ad 01 00       	mov    0x1addc,%eax
+    86db:	50                   	push   %eax
+    86dc:	53                   	push   %ebx
+    86dd:	68 34 cd 00 00       	push   $0xcd34
+    86e2:	6a 01                	push   $0x1
+    86e4:	e8 28 1e 00 00       	call   a511 <printf>
+    exit();
+    86e9:	e8 ea 18 00 00       	call   9fd8 <exit>
+    printf(1, "thread: write to shared page lost\n");
+    86ee:	83 ec 08             	sub    $0x8,%esp
+    86f1:	68 24 e7 00 00       	push   $0xe724
+    86f6:	6a 01                	push   $0x1
+    86f8:	e8 14 1e 00 00       	call   a511 <printf>
+    exit();
+    86fd:	e8 d6 18 00 00       	call   9fd8 <exit>
+
+00008702 <threadwork>:
+{
+    8702:	55                   	push   %ebp
+    8703:	89 e5                	mov    %esp,%ebp
+    8705:	53                   	push   %ebx
+    8706:	83 ec 04             	sub    $0x4,%esp
+  while(!tgo)
+    8709:	a1 d8 ad 01 00       	mov    0x1add8,%eax
+    870e:	85 c0                	test   %eax,%eax
+    8710:	74 f7                	je     8709 <threadwork+0x7>
+  for(i = 0; i < 1000; i++){
+    8712:	bb 00 00 00 00       	mov    $0x0,%ebx
+    8717:	eb 2c                	jmp    8745 <threadwork+0x43>
+    lock_acquire(&tlock);
+    8719:	83 ec 0c             	sub    $0xc,%esp
+    871c:	68 e0 ad 01 00       	push   $0x1ade0
+    8721:	e8 d2 22 00 00       	call   a9f8 <lock_acquire>
+    tcount++;
+    8726:	a1 dc ad 01 00       	mov    0x1addc,%eax
+    872b:	83 c0 01             	add    $0x1,%eax
+    872e:	a3 dc ad 01 00       	mov    %eax,0x1addc
+    lock_release(&tlock);
+    8733:	c7 04 24 e0 ad 01 00 	movl   $0x1ade0,(%esp)
+    873a:	e8 cd 22 00 00       	call   aa0c <lock_release>
+  for(i = 0; i < 1000; i++){
+    873f:	83 c3 01             	add    $0x1,%ebx
+    8742:	83 c4 10             	add    $0x10,%esp
+    8745:	81 fb e7 03 00 00    	cmp    $0x3e7,%ebx
+    874b:	7e cc                	jle    8719 <threadwork+0x17>
+  p = sbrk(4096);
+    874d:	83 ec 0c             	sub    $0xc,%esp
+    8750:	68 00 10 00 00       	push   $0x1000
+    8755:	e8 56 1a 00 00       	call   a1b0 <sbrk>
+  if(p != (char*)-1)
+    875a:	83 c4 10             	add    $0x10,%esp
+    875d:	83 f8 ff             	cmp    $0xffffffff,%eax
+    8760:	74 03                	je     8765 <threadwork+0x63>
+    p[0] = 1;
+    8762:	c6 00 01             	movb   $0x1,(%eax)
+  if((int)arg == 0)
+    8765:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    8769:	74 05                	je     8770 <threadwork+0x6e>
+  exit();
+    876b:	e8 68 18 00 00       	call   9fd8 <exit>
+    tpage[0] = 'x';
+    8770:	a1 d4 ad 01 00       	mov    0x1add4,%eax
+    8775:	c6 00 78             	movb   $0x78,(%eax)
+    8778:	eb f1                	jmp    876b <threadwork+0x69>
+
+0000877a <futextest>:
+{
+    877a:	55                   	push   %ebp
+    877b:	89 e5                	mov    %esp,%ebp
+    877d:	53                   	push   %ebx
+    877e:	83 ec 1c             	sub    $0x1c,%esp
+  printf(1, "futex test\n");
+    8781:	68 61 cd 00 00       	push   $0xcd61
+    8786:	6a 01                	push   $0x1
+    8788:	e8 84 1d 00 00       	call   a511 <printf>
+  word = 1;
+    878d:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  if(futex_wait(&word, 0) != -1){
+    8794:	83 c4 08             	add    $0x8,%esp
+    8797:	6a 00                	push   $0x0
+    8799:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    879c:	50                   	push   %eax
+    879d:	e8 fe 1a 00 00       	call   a2a0 <futex_wait>
+    87a2:	83 c4 10             	add    $0x10,%esp
+    87a5:	83 f8 ff             	cmp    $0xffffffff,%eax
+    87a8:	75 6b                	jne    8815 <futextest+0x9b>
+  if(futex_wake(&word, 1) != 0){
+    87aa:	83 ec 08             	sub    $0x8,%esp
+    87ad:	6a 01                	push   $0x1
+    87af:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    87b2:	50                   	push   %eax
+    87b3:	e8 f7 1a 00 00       	call   a2af <futex_wake>
+    87b8:	83 c4 10             	add    $0x10,%esp
+    87bb:	85 c0                	test   %eax,%eax
+    87bd:	75 6a                	jne    8829 <futextest+0xaf>
+  mutex_init(&fmutex);
+    87bf:	83 ec 0c             	sub    $0xc,%esp
+    87c2:	68 d0 ad 01 00       	push   $0x1add0
+    87c7:	e8 50 22 00 00       	call   aa1c <mutex_init>
+  cond_init(&fnotempty);
+    87cc:	c7 04 24 cc ad 01 00 	movl   $0x1adcc,(%esp)
+    87d3:	e8 cb 22 00 00       	call   aaa3 <cond_init>
+  cond_init(&fnotfull);
+    87d8:	c7 04 24 c8 ad 01 00 	movl   $0x1adc8,(%esp)
+    87df:	e8 bf 22 00 00       	call   aaa3 <cond_init>
+  fslot = fsum = 0;
+    87e4:	c7 05 c0 ad 01 00 00 	movl   $0x0,0x1adc0
+    87eb:	00 00 00 
+    87ee:	c7 05 c4 ad 01 00 00 	movl   $0x0,0x1adc4
+    87f5:	00 00 00 
+  if(thread_create(fconsumer, 0) < 0){
+    87f8:	83 c4 08             	add    $0x8,%esp
+    87fb:	6a 00                	push   $0x0
+    87fd:	68 f0 88 00 00       	push   $0x88f0
+    8802:	e8 4b 21 00 00       	call   a952 <thread_create>
+    8807:	83 c4 10             	add    $0x10,%esp
+    880a:	85 c0                	test   %eax,%eax
+    880c:	78 2f                	js     883d <futextest+0xc3>
+  for(i = 1; i <= 200; i++){
+    880e:	bb 01 00 00 00       	mov    $0x1,%ebx
+    8813:	eb 7f                	jmp    8894 <futextest+0x11a>
+    printf(1, "futex: wait on a changed word slept\n");
+    8815:	83 ec 08             	sub    $0x8,%esp
+    8818:	68 48 e7 00 00       	push   $0xe748
+    881d:	6a 01                	push   $0x1
+    881f:	e8 ed 1c 00 00       	call   a511 <printf>
+    exit();
+    8824:	e8 af 17 00 00       	call   9fd8 <exit>
+    printf(1, "futex: woke a waiter that was not there\n");
+    8829:	83 ec 08             	sub    $0x8,%esp
+    882c:	68 70 e7 00 00       	push   $0xe770
+    8831:	6a 01                	push   $0x1
+    8833:	e8 d9 1c 00 00       	call   a511 <printf>
+    exit();
+    8838:	e8 9b 17 00 00       	call   9fd8 <exit>
+    printf(1, "futex: thread_create failed\n");
+    883d:	83 ec 08             	sub    $0x8,%esp
+    8840:	68 6d cd 00 00       	push   $0xcd6d
+    8845:	6a 01                	push   $0x1
+    8847:	e8 c5 1c 00 00       	call   a511 <printf>
+    exit();
+    884c:	e8 87 17 00 00       	call   9fd8 <exit>
+      cond_wait(&fnotfull, &fmutex);
+    8851:	83 ec 08             	sub    $0x8,%esp
+    8854:	68 d0 ad 01 00       	push   $0x1add0
+    8859:	68 c8 ad 01 00       	push   $0x1adc8
+    885e:	e8 4e 22 00 00       	call   aab1 <cond_wait>
+    8863:	83 c4 10             	add    $0x10,%esp
+    while(fslot != 0)
+    8866:	a1 c4 ad 01 00       	mov    0x1adc4,%eax
+    886b:	85 c0                	test   %eax,%eax
+    886d:	75 e2                	jne    8851 <futextest+0xd7>
+    fslot = i;
+    886f:	89 1d c4 ad 01 00    	mov    %ebx,0x1adc4
+    cond_signal(&fnotempty);
+    8875:	83 ec 0c             	sub    $0xc,%esp
+    8878:	68 cc ad 01 00       	push   $0x1adcc
+    887d:	e8 77 22 00 00       	call   aaf9 <cond_signal>
+    mutex_unlock(&fmutex);
+    8882:	c7 04 24 d0 ad 01 00 	movl   $0x1add0,(%esp)
+    8889:	e8 e6 21 00 00       	call   aa74 <mutex_unlock>
+  for(i = 1; i <= 200; i++){
+    888e:	83 c3 01             	add    $0x1,%ebx
+    8891:	83 c4 10             	add    $0x10,%esp
+    8894:	81 fb c8 00 00 00    	cmp    $0xc8,%ebx
+    889a:	7f 12                	jg     88ae <futextest+0x134>
+    mutex_lock(&fmutex);
+    889c:	83 ec 0c             	sub    $0xc,%esp
+    889f:	68 d0 ad 01 00       	push   $0x1add0
+    88a4:	e8 81 21 00 00       	call   aa2a <mutex_lock>
+    while(fslot != 0)
+    88a9:	83 c4 10             	add    $0x10,%esp
+    88ac:	eb b8                	jmp    8866 <futextest+0xec>
+  thread_join();
+    88ae:	e8 01 21 00 00       	call   a9b4 <thread_join>
+  if(fsum != 200*201/2){
+    88b3:	a1 c0 ad 01 00       	mov    0x1adc0,%eax
+    88b8:	3d 84 4e 00 00       	cmp    $0x4e84,%eax
+    88bd:	75 17                	jne    88d6 <futextest+0x15c>
+  printf(1, "futex test OK\n");
+    88bf:	83 ec 08             	sub    $0x8,%esp
+    88c2:	68 99 cd 00 00       	push   $0xcd99
+    88c7:	6a 01                	push   $0x1
+    88c9:	e8 43 1c 00 00       	call   a511 <printf>
+}
+    88ce:	83 c4 10             	add    $0x10,%esp
+    88d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    88d4:	c9                   	leave
+    88d5:	c3                   	ret
+    printf(1, "futex: sum %d\n", fsum);
+    88d6:	a1 c0 ad 01 00       	mov    0x1adc0,%eax
+    88db:	83 ec 04             	sub    $0x4,%esp
+    88de:	50                   	push   %eax
+    88df:	68 8a cd 00 00       	push   $0xcd8a
+    88e4:	6a 01                	push   $0x1
+    88e6:	e8 26 1c 00 00       	call   a511 <printf>
+    exit();
+    88eb:	e8 e8 16 00 00       	call   9fd8 <exit>
+
+000088f0 <fconsumer>:
+{
+    88f0:	55                   	push   %ebp
+    88f1:	89 e5                	mov    %esp,%ebp
+    88f3:	53                   	push   %ebx
+    88f4:	83 ec 04             	sub    $0x4,%esp
+  for(i = 0; i < 200; i++){
+    88f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+    88fc:	eb 59                	jmp    8957 <fconsumer+0x67>
+      cond_wait(&fnotempty, &fmutex);
+    88fe:	83 ec 08             	sub    $0x8,%esp
+    8901:	68 d0 ad 01 00       	push   $0x1add0
+    8906:	68 cc ad 01 00       	push   $0x1adcc
+    890b:	e8 a1 21 00 00       	call   aab1 <cond_wait>
+    8910:	83 c4 10             	add    $0x10,%esp
+    while(fslot == 0)
+    8913:	a1 c4 ad 01 00       	mov    0x1adc4,%eax
+    8918:	85 c0                	test   %eax,%eax
+    891a:	74 e2                	je     88fe <fconsumer+0xe>
+    fsum += fslot;
+    891c:	8b 15 c4 ad 01 00    	mov    0x1adc4,%edx
+    8922:	a1 c0 ad 01 00       	mov    0x1adc0,%eax
+    8927:	01 d0                	add    %edx,%eax
+    8929:	a3 c0 ad 01 00       	mov    %eax,0x1adc0
+    fslot = 0;
+    892e:	c7 05 c4 ad 01 00 00 	movl   $0x0,0x1adc4
+    8935:	00 00 00 
+    cond_signal(&fnotfull);
+    8938:	83 ec 0c             	sub    $0xc,%esp
+    893b:	68 c8 ad 01 00       	push   $0x1adc8
+    8940:	e8 b4 21 00 00       	call   aaf9 <cond_signal>
+    mutex_unlock(&fmutex);
+    8945:	c7 04 24 d0 ad 01 00 	movl   $0x1add0,(%esp)
+    894c:	e8 23 21 00 00       	call   aa74 <mutex_unlock>
+  for(i = 0; i < 200; i++){
+    8951:	83 c3 01             	add    $0x1,%ebx
+    8954:	83 c4 10             	add    $0x10,%esp
+    8957:	81 fb c7 00 00 00    	cmp    $0xc7,%ebx
+    895d:	7f 12                	jg     8971 <fconsumer+0x81>
+    mutex_lock(&fmutex);
+    895f:	83 ec 0c             	sub    $0xc,%esp
+    8962:	68 d0 ad 01 00       	push   $0x1add0
+    8967:	e8 be 20 00 00       	call   aa2a <mutex_lock>
+    while(fslot == 0)
+    896c:	83 c4 10             	add    $0x10,%esp
+    896f:	eb a2                	jmp    8913 <fconsumer+0x23>
+  exit();
+    8971:	e8 62 16 00 00       	call   9fd8 <exit>
+
+00008976 <largepagetest>:
+{
+    8976:	55                   	push   %ebp
+    8977:	89 e5                	mov    %esp,%ebp
+    8979:	57                   	push   %edi
+    897a:	56                   	push   %esi
+    897b:	53                   	push   %ebx
+    897c:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "largepage test\n");
+    897f:	68 a8 cd 00 00       	push   $0xcda8
+    8984:	6a 01                	push   $0x1
+    8986:	e8 86 1b 00 00       	call   a511 <printf>
+  old = largepages(1);
+    898b:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    8992:	e8 91 18 00 00       	call   a228 <largepages>
+    8997:	89 c7                	mov    %eax,%edi
+  if(largepages(-1) != 1){
+    8999:	c7 04 24 ff ff ff ff 	movl   $0xffffffff,(%esp)
+    89a0:	e8 83 18 00 00       	call   a228 <largepages>
+    89a5:	83 c4 10             	add    $0x10,%esp
+    89a8:	83 f8 01             	cmp    $0x1,%eax
+    89ab:	75 46                	jne    89f3 <largepagetest+0x7d>
+  a = sbrk(0);
+    89ad:	83 ec 0c             	sub    $0xc,%esp
+    89b0:	6a 00                	push   $0x0
+    89b2:	e8 f9 17 00 00       	call   a1b0 <sbrk>
+    89b7:	89 c3                	mov    %eax,%ebx
+  pad = (4*1024*1024 - (uint)a % (4*1024*1024)) % (4*1024*1024);
+    89b9:	89 c6                	mov    %eax,%esi
+    89bb:	f7 de                	neg    %esi
+    89bd:	81 e6 ff ff 3f 00    	and    $0x3fffff,%esi
+  if(sbrk(pad + 8*1024*1024) == (char*)-1){
+    89c3:	8d 86 00 00 80 00    	lea    0x800000(%esi),%eax
+    89c9:	89 04 24             	mov    %eax,(%esp)
+    89cc:	e8 df 17 00 00       	call   a1b0 <sbrk>
+    89d1:	83 c4 10             	add    $0x10,%esp
+    89d4:	83 f8 ff             	cmp    $0xffffffff,%eax
+    89d7:	74 2e                	je     8a07 <largepagetest+0x91>
+  base = a + pad;
+    89d9:	01 f3                	add    %esi,%ebx
+  faultstat(-1, f0);
+    89db:	83 ec 08             	sub    $0x8,%esp
+    89de:	8d 45 cc             	lea    -0x34(%ebp),%eax
+    89e1:	50                   	push   %eax
+    89e2:	6a ff                	push   $0xffffffff
+    89e4:	e8 12 18 00 00       	call   a1fb <faultstat>
+  for(i = 0; i < 8*1024*1024; i += 4096)
+    89e9:	83 c4 10             	add    $0x10,%esp
+    89ec:	b8 00 00 00 00       	mov    $0x0,%eax
+    89f1:	eb 3e                	jmp    8a31 <largepagetest+0xbb>
+    printf(1, "largepages setting wrong\n");
+    89f3:	83 ec 08             	sub    $0x8,%esp
+    89f6:	68 b8 cd 00 00       	push   $0xcdb8
+    89fb:	6a 01                	push   $0x1
+    89fd:	e8 0f 1b 00 00       	call   a511 <printf>
+    exit();
+    8a02:	e8 d1 15 00 00       	call   9fd8 <exit>
+    printf(1, "sbrk failed\n");
+    8a07:	83 ec 08             	sub    $0x8,%esp
+    8a0a:	68 3f c6 00 00       	push   $0xc63f
+    8a0f:	6a 01                	push   $0x1
+    8a11:	e8 fb 1a 00 00       	call   a511 <printf>
+    exit();
+    8a16:	e8 bd 15 00 00       	call   9fd8 <exit>
+    base[i] = i/4096;
+    8a1b:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+    8a21:	85 c0                	test   %eax,%eax
+    8a23:	0f 49 d0             	cmovns %eax,%edx
+    8a26:	c1 fa 0c             	sar    $0xc,%edx
+    8a29:	88 14 03             	mov    %dl,(%ebx,%eax,1)
+  for(i = 0; i < 8*1024*1024; i += 4096)
+    8a2c:	05 00 10 00 00       	add    $0x1000,%eax
+    8a31:	3d ff ff 7f 00       	cmp    $0x7fffff,%eax
+    8a36:	7e e3                	jle    8a1b <largepagetest+0xa5>
+  faultstat(-1, f1);
+    8a38:	83 ec 08             	sub    $0x8,%esp
+    8a3b:	8d 45 b0             	lea    -0x50(%ebp),%eax
+    8a3e:	50                   	push   %eax
+    8a3f:	6a ff                	push   $0xffffffff
+    8a41:	e8 b5 17 00 00       	call   a1fb <faultstat>
+  if(f1[FAULT_HEAP] - f0[FAULT_HEAP] > 2){
+    8a46:	8b 45 b0             	mov    -0x50(%ebp),%eax
+    8a49:	2b 45 cc             	sub    -0x34(%ebp),%eax
+    8a4c:	83 c4 10             	add    $0x10,%esp
+    8a4f:	83 f8 02             	cmp    $0x2,%eax
+    8a52:	77 26                	ja     8a7a <largepagetest+0x104>
+  for(i = 0; i < 8*1024*1024; i += 4096){
+    8a54:	b8 00 00 00 00       	mov    $0x0,%eax
+    8a59:	3d ff ff 7f 00       	cmp    $0x7fffff,%eax
+    8a5e:	7f 44                	jg     8aa4 <largepagetest+0x12e>
+    if(base[i] != (char)(i/4096)){
+    8a60:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+    8a66:	85 c0                	test   %eax,%eax
+    8a68:	0f 49 d0             	cmovns %eax,%edx
+    8a6b:	c1 fa 0c             	sar    $0xc,%edx
+    8a6e:	38 14 03             	cmp    %dl,(%ebx,%eax,1)
+    8a71:	75 1c                	jne    8a8f <largepagetest+0x119>
+  for(i = 0; i < 8*1024*1024; i += 4096){
+    8a73:	05 00 10 00 00       	add    $0x1000,%eax
+    8a78:	eb df                	jmp    8a59 <largepagetest+0xe3>
+    printf(1, "largepage: %d heap faults for 8MB\n",
+    8a7a:	83 ec 04             	sub    $0x4,%esp
+    8a7d:	50                   	push   %eax
+    8a7e:	68 9c e7 00 00       	push   $0xe79c
+    8a83:	6a 01                	push   $0x1
+    8a85:	e8 87 1a 00 00       	call   a511 <printf>
+    exit();
+    8a8a:	e8 49 15 00 00       	call   9fd8 <exit>
+      printf(1, "largepage: page %d lost its data\n", i/4096);
+    8a8f:	83 ec 04             	sub    $0x4,%esp
+    8a92:	52                   	push   %edx
+    8a93:	68 c0 e7 00 00       	push   $0xe7c0
+    8a98:	6a 01                	push   $0x1
+    8a9a:	e8 72 1a 00 00       	call   a511 <printf>
+      exit();
+    8a9f:	e8 34 15 00 00       	call   9fd8 <exit>
+  pid = fork();
+    8aa4:	e8 1b 15 00 00       	call   9fc4 <fork>
+  if(pid < 0){
+    8aa9:	85 c0                	test   %eax,%eax
+    8aab:	78 27                	js     8ad4 <largepagetest+0x15e>
+  if(pid == 0){
+    8aad:	74 39                	je     8ae8 <largepagetest+0x172>
+  wait();
+    8aaf:	e8 2a 16 00 00       	call   a0de <wait>
+  if(base[4096] != 1){
+    8ab4:	80 bb 00 10 00 00 01 	cmpb   $0x1,0x1000(%ebx)
+    8abb:	75 50                	jne    8b0d <largepagetest+0x197>
+  sbrk(-6*1024*1024);
+    8abd:	83 ec 0c             	sub    $0xc,%esp
+    8ac0:	68 00 00 a0 ff       	push   $0xffa00000
+    8ac5:	e8 e6 16 00 00       	call   a1b0 <sbrk>
+  for(i = 0; i < 2*1024*1024; i += 4096){
+    8aca:	83 c4 10             	add    $0x10,%esp
+    8acd:	b8 00 00 00 00       	mov    $0x0,%eax
+    8ad2:	eb 52                	jmp    8b26 <largepagetest+0x1b0>
+    printf(1, "fork failed\n");
+    8ad4:	83 ec 08             	sub    $0x8,%esp
+    8ad7:	68 b6 be 00 00       	push   $0xbeb6
+    8adc:	6a 01                	push   $0x1
+    8ade:	e8 2e 1a 00 00       	call   a511 <printf>
+    exit();
+    8ae3:	e8 f0 14 00 00       	call   9fd8 <exit>
+    base[4096] = 'c';
+    8ae8:	c6 83 00 10 00 00 63 	movb   $0x63,0x1000(%ebx)
+    if(base[4096] != 'c' || base[0] != 0){
+    8aef:	80 3b 00             	cmpb   $0x0,(%ebx)
+    8af2:	75 05                	jne    8af9 <largepagetest+0x183>
+    exit();
+    8af4:	e8 df 14 00 00       	call   9fd8 <exit>
+      printf(1, "largepage: child sees wrong data\n");
+    8af9:	83 ec 08             	sub    $0x8,%esp
+    8afc:	68 e4 e7 00 00       	push   $0xe7e4
+    8b01:	6a 01                	push   $0x1
+    8b03:	e8 09 1a 00 00       	call   a511 <printf>
+    8b08:	83 c4 10             	add    $0x10,%esp
+    8b0b:	eb e7                	jmp    8af4 <largepagetest+0x17e>
+    printf(1, "largepage: child's write reached the parent\n");
+    8b0d:	83 ec 08             	sub    $0x8,%esp
+    8b10:	68 08 e8 00 00       	push   $0xe808
+    8b15:	6a 01                	push   $0x1
+    8b17:	e8 f5 19 00 00       	call   a511 <printf>
+    exit();
+    8b1c:	e8 b7 14 00 00       	call   9fd8 <exit>
+  for(i = 0; i < 2*1024*1024; i += 4096){
+    8b21:	05 00 10 00 00       	add    $0x1000,%eax
+    8b26:	3d ff ff 1f 00       	cmp    $0x1fffff,%eax
+    8b2b:	7f 28                	jg     8b55 <largepagetest+0x1df>
+    if(base[i] != (char)(i/4096)){
+    8b2d:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+    8b33:	85 c0                	test   %eax,%eax
+    8b35:	0f 49 d0             	cmovns %eax,%edx
+    8b38:	c1 fa 0c             	sar    $0xc,%edx
+    8b3b:	38 14 03             	cmp    %dl,(%ebx,%eax,1)
+    8b3e:	74 e1                	je     8b21 <largepagetest+0x1ab>
+      printf(1, "largepage: page %d lost after shrink\n", i/4096);
+    8b40:	83 ec 04             	sub    $0x4,%esp
+    8b43:	52                   	push   %edx
+    8b44:	68 38 e8 00 00       	push   $0xe838
+    8b49:	6a 01                	push   $0x1
+    8b4b:	e8 c1 19 00 00       	call   a511 <printf>
+      exit();
+    8b50:	e8 83 14 00 00       	call   9fd8 <exit>
+  sbrk(-(pad + 2*1024*1024));
+    8b55:	b8 00 00 e0 ff       	mov    $0xffe00000,%eax
+    8b5a:	29 f0                	sub    %esi,%eax
+    8b5c:	83 ec 0c             	sub    $0xc,%esp
+    8b5f:	50                   	push   %eax
+    8b60:	e8 4b 16 00 00       	call   a1b0 <sbrk>
+  largepages(old);
+    8b65:	89 3c 24             	mov    %edi,(%esp)
+    8b68:	e8 bb 16 00 00       	call   a228 <largepages>
+  printf(1, "largepage test OK\n");
+    8b6d:	83 c4 08             	add    $0x8,%esp
+    8b70:	68 d2 cd 00 00       	push   $0xcdd2
+    8b75:	6a 01                	push   $0x1
+    8b77:	e8 95 19 00 00       	call   a511 <printf>
+}
+    8b7c:	83 c4 10             	add    $0x10,%esp
+    8b7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    8b82:	5b                   	pop    %ebx
+    8b83:	5e                   	pop    %esi
+    8b84:	5f                   	pop    %edi
+    8b85:	5d                   	pop    %ebp
+    8b86:	c3                   	ret
+
+00008b87 <mmaptest>:
+{
+    8b87:	55                   	push   %ebp
+    8b88:	89 e5                	mov    %esp,%ebp
+    8b8a:	56                   	push   %esi
+    8b8b:	53                   	push   %ebx
+    8b8c:	83 ec 48             	sub    $0x48,%esp
+  printf(1, "mmap test\n");
+    8b8f:	68 e5 cd 00 00       	push   $0xcde5
+    8b94:	6a 01                	push   $0x1
+    8b96:	e8 76 19 00 00       	call   a511 <printf>
+  fd = open("mmapfile", O_CREATE|O_RDWR);
+    8b9b:	83 c4 08             	add    $0x8,%esp
+    8b9e:	68 02 02 00 00       	push   $0x202
+    8ba3:	68 f0 cd 00 00       	push   $0xcdf0
+    8ba8:	e8 7c 15 00 00       	call   a129 <open>
+  if(fd < 0){
+    8bad:	83 c4 10             	add    $0x10,%esp
+    8bb0:	85 c0                	test   %eax,%eax
+    8bb2:	78 09                	js     8bbd <mmaptest+0x36>
+    8bb4:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < sizeof(buf); i++)
+    8bb6:	b9 00 00 00 00       	mov    $0x0,%ecx
+    8bbb:	eb 38                	jmp    8bf5 <mmaptest+0x6e>
+    printf(1, "mmap: create failed\n");
+    8bbd:	83 ec 08             	sub    $0x8,%esp
+    8bc0:	68 f9 cd 00 00       	push   $0xcdf9
+    8bc5:	6a 01                	push   $0x1
+    8bc7:	e8 45 19 00 00       	call   a511 <printf>
+    exit();
+    8bcc:	e8 07 14 00 00       	call   9fd8 <exit>
+    buf[i] = 'a' + i%26;
+    8bd1:	ba 4f ec c4 4e       	mov    $0x4ec4ec4f,%edx
+    8bd6:	89 c8                	mov    %ecx,%eax
+    8bd8:	f7 ea                	imul   %edx
+    8bda:	c1 fa 03             	sar    $0x3,%edx
+    8bdd:	89 c8                	mov    %ecx,%eax
+    8bdf:	c1 f8 1f             	sar    $0x1f,%eax
+    8be2:	29 c2                	sub    %eax,%edx
+    8be4:	6b c2 1a             	imul   $0x1a,%edx,%eax
+    8be7:	89 ca                	mov    %ecx,%edx
+    8be9:	29 c2                	sub    %eax,%edx
+    8beb:	83 c2 61             	add    $0x61,%edx
+    8bee:	88 54 0d b8          	mov    %dl,-0x48(%ebp,%ecx,1)
+  for(i = 0; i < sizeof(buf); i++)
+    8bf2:	83 c1 01             	add    $0x1,%ecx
+    8bf5:	83 f9 3f             	cmp    $0x3f,%ecx
+    8bf8:	76 d7                	jbe    8bd1 <mmaptest+0x4a>
+  for(i = 0; i < 2*4096/sizeof(buf); i++)
+    8bfa:	be 00 00 00 00       	mov    $0x0,%esi
+    8bff:	eb 15                	jmp    8c16 <mmaptest+0x8f>
+    write(fd, buf, sizeof(buf));
+    8c01:	83 ec 04             	sub    $0x4,%esp
+    8c04:	6a 40                	push   $0x40
+    8c06:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    8c09:	50                   	push   %eax
+    8c0a:	53                   	push   %ebx
+    8c0b:	e8 fb 14 00 00       	call   a10b <write>
+  for(i = 0; i < 2*4096/sizeof(buf); i++)
+    8c10:	83 c6 01             	add    $0x1,%esi
+    8c13:	83 c4 10             	add    $0x10,%esp
+    8c16:	83 fe 7f             	cmp    $0x7f,%esi
+    8c19:	76 e6                	jbe    8c01 <mmaptest+0x7a>
+  p = mmap(0, 2*4096, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+    8c1b:	83 ec 08             	sub    $0x8,%esp
+    8c1e:	6a 00                	push   $0x0
+    8c20:	53                   	push   %ebx
+    8c21:	6a 02                	push   $0x2
+    8c23:	6a 03                	push   $0x3
+    8c25:	68 00 20 00 00       	push   $0x2000
+    8c2a:	6a 00                	push   $0x0
+    8c2c:	e8 d9 15 00 00       	call   a20a <mmap>
+  if(p == (char*)-1 || p[0] != 'a' || p[4096+1] != 'a' + (4096+1)%sizeof(buf)%26){
+    8c31:	83 c4 20             	add    $0x20,%esp
+    8c34:	83 f8 ff             	cmp    $0xffffffff,%eax
+    8c37:	0f 84 d0 00 00 00    	je     8d0d <mmaptest+0x186>
+    8c3d:	80 38 61             	cmpb   $0x61,(%eax)
+    8c40:	0f 85 c7 00 00 00    	jne    8d0d <mmaptest+0x186>
+    8c46:	80 b8 01 10 00 00 62 	cmpb   $0x62,0x1001(%eax)
+    8c4d:	0f 85 ba 00 00 00    	jne    8d0d <mmaptest+0x186>
+  p[0] = 'X';
+    8c53:	c6 00 58             	movb   $0x58,(%eax)
+  if(munmap(p, 2*4096) < 0){
+    8c56:	83 ec 08             	sub    $0x8,%esp
+    8c59:	68 00 20 00 00       	push   $0x2000
+    8c5e:	50                   	push   %eax
+    8c5f:	e8 b5 15 00 00       	call   a219 <munmap>
+    8c64:	83 c4 10             	add    $0x10,%esp
+    8c67:	85 c0                	test   %eax,%eax
+    8c69:	0f 88 b2 00 00 00    	js     8d21 <mmaptest+0x19a>
+  p = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 4096);
+    8c6f:	83 ec 08             	sub    $0x8,%esp
+    8c72:	68 00 10 00 00       	push   $0x1000
+    8c77:	53                   	push   %ebx
+    8c78:	6a 01                	push   $0x1
+    8c7a:	6a 03                	push   $0x3
+    8c7c:	68 00 10 00 00       	push   $0x1000
+    8c81:	6a 00                	push   $0x0
+    8c83:	e8 82 15 00 00       	call   a20a <mmap>
+    8c88:	89 c6                	mov    %eax,%esi
+  if(p == (char*)-1 || p[0] != 'a' + 4096%sizeof(buf)%26){
+    8c8a:	83 c4 20             	add    $0x20,%esp
+    8c8d:	83 f8 ff             	cmp    $0xffffffff,%eax
+    8c90:	0f 84 9f 00 00 00    	je     8d35 <mmaptest+0x1ae>
+    8c96:	80 38 61             	cmpb   $0x61,(%eax)
+    8c99:	0f 85 96 00 00 00    	jne    8d35 <mmaptest+0x1ae>
+  pid = fork();
+    8c9f:	e8 20 13 00 00       	call   9fc4 <fork>
+  if(pid < 0){
+    8ca4:	85 c0                	test   %eax,%eax
+    8ca6:	0f 88 9d 00 00 00    	js     8d49 <mmaptest+0x1c2>
+  if(pid == 0){
+    8cac:	0f 84 ab 00 00 00    	je     8d5d <mmaptest+0x1d6>
+  wait();
+    8cb2:	e8 27 14 00 00       	call   a0de <wait>
+  p[0] = 'Z';
+    8cb7:	c6 06 5a             	movb   $0x5a,(%esi)
+  if(p[1] != 'Y'){
+    8cba:	80 7e 01 59          	cmpb   $0x59,0x1(%esi)
+    8cbe:	0f 85 a2 00 00 00    	jne    8d66 <mmaptest+0x1df>
+  munmap(p, 4096);
+    8cc4:	83 ec 08             	sub    $0x8,%esp
+    8cc7:	68 00 10 00 00       	push   $0x1000
+    8ccc:	56                   	push   %esi
+    8ccd:	e8 47 15 00 00       	call   a219 <munmap>
+  close(fd);
+    8cd2:	89 1c 24             	mov    %ebx,(%esp)
+    8cd5:	e8 2d 13 00 00       	call   a007 <close>
+  fd = open("mmapfile", O_RDONLY);
+    8cda:	83 c4 08             	add    $0x8,%esp
+    8cdd:	6a 00                	push   $0x0
+    8cdf:	68 f0 cd 00 00       	push   $0xcdf0
+    8ce4:	e8 40 14 00 00       	call   a129 <open>
+    8ce9:	89 c6                	mov    %eax,%esi
+  read(fd, buf, 1);
+    8ceb:	83 c4 0c             	add    $0xc,%esp
+    8cee:	6a 01                	push   $0x1
+    8cf0:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    8cf3:	50                   	push   %eax
+    8cf4:	56                   	push   %esi
+    8cf5:	e8 02 14 00 00       	call   a0fc <read>
+  if(buf[0] != 'a'){
+    8cfa:	83 c4 10             	add    $0x10,%esp
+    8cfd:	80 7d b8 61          	cmpb   $0x61,-0x48(%ebp)
+    8d01:	75 77                	jne    8d7a <mmaptest+0x1f3>
+  for(i = 1; i < 4096/sizeof(buf); i++)
+    8d03:	bb 01 00 00 00       	mov    $0x1,%ebx
+    8d08:	e9 96 00 00 00       	jmp    8da3 <mmaptest+0x21c>
+    printf(1, "mmap: private mapping wrong\n");
+    8d0d:	83 ec 08             	sub    $0x8,%esp
+    8d10:	68 0e ce 00 00       	push   $0xce0e
+    8d15:	6a 01                	push   $0x1
+    8d17:	e8 f5 17 00 00       	call   a511 <printf>
+    exit();
+    8d1c:	e8 b7 12 00 00       	call   9fd8 <exit>
+    printf(1, "mmap: munmap failed\n");
+    8d21:	83 ec 08             	sub    $0x8,%esp
+    8d24:	68 2b ce 00 00       	push   $0xce2b
+    8d29:	6a 01                	push   $0x1
+    8d2b:	e8 e1 17 00 00       	call   a511 <printf>
+    exit();
+    8d30:	e8 a3 12 00 00       	call   9fd8 <exit>
+    printf(1, "mmap: shared mapping wrong\n");
+    8d35:	83 ec 08             	sub    $0x8,%esp
+    8d38:	68 40 ce 00 00       	push   $0xce40
+    8d3d:	6a 01                	push   $0x1
+    8d3f:	e8 cd 17 00 00       	call   a511 <printf>
+    exit();
+    8d44:	e8 8f 12 00 00       	call   9fd8 <exit>
+    printf(1, "mmap: fork failed\n");
+    8d49:	83 ec 08             	sub    $0x8,%esp
+    8d4c:	68 5c ce 00 00       	push   $0xce5c
+    8d51:	6a 01                	push   $0x1
+    8d53:	e8 b9 17 00 00       	call   a511 <printf>
+    exit();
+    8d58:	e8 7b 12 00 00       	call   9fd8 <exit>
+    p[1] = 'Y';
+    8d5d:	c6 46 01 59          	movb   $0x59,0x1(%esi)
+    exit();
+    8d61:	e8 72 12 00 00       	call   9fd8 <exit>
+    printf(1, "mmap: child store not shared\n");
+    8d66:	83 ec 08             	sub    $0x8,%esp
+    8d69:	68 6f ce 00 00       	push   $0xce6f
+    8d6e:	6a 01                	push   $0x1
+    8d70:	e8 9c 17 00 00       	call   a511 <printf>
+    exit();
+    8d75:	e8 5e 12 00 00       	call   9fd8 <exit>
+    printf(1, "mmap: private store reached the file\n");
+    8d7a:	83 ec 08             	sub    $0x8,%esp
+    8d7d:	68 60 e8 00 00       	push   $0xe860
+    8d82:	6a 01                	push   $0x1
+    8d84:	e8 88 17 00 00       	call   a511 <printf>
+    exit();
+    8d89:	e8 4a 12 00 00       	call   9fd8 <exit>
+    read(fd, buf, sizeof(buf));
+    8d8e:	83 ec 04             	sub    $0x4,%esp
+    8d91:	6a 40                	push   $0x40
+    8d93:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    8d96:	50                   	push   %eax
+    8d97:	56                   	push   %esi
+    8d98:	e8 5f 13 00 00       	call   a0fc <read>
+  for(i = 1; i < 4096/sizeof(buf); i++)
+    8d9d:	83 c3 01             	add    $0x1,%ebx
+    8da0:	83 c4 10             	add    $0x10,%esp
+    8da3:	83 fb 3f             	cmp    $0x3f,%ebx
+    8da6:	76 e6                	jbe    8d8e <mmaptest+0x207>
+  read(fd, buf, sizeof(buf) - 1);
+    8da8:	83 ec 04             	sub    $0x4,%esp
+    8dab:	6a 3f                	push   $0x3f
+    8dad:	8d 5d b8             	lea    -0x48(%ebp),%ebx
+    8db0:	53                   	push   %ebx
+    8db1:	56                   	push   %esi
+    8db2:	e8 45 13 00 00       	call   a0fc <read>
+  read(fd, buf, 2);
+    8db7:	83 c4 0c             	add    $0xc,%esp
+    8dba:	6a 02                	push   $0x2
+    8dbc:	53                   	push   %ebx
+    8dbd:	56                   	push   %esi
+    8dbe:	e8 39 13 00 00       	call   a0fc <read>
+  if(buf[0] != 'Z' || buf[1] != 'Y'){
+    8dc3:	83 c4 10             	add    $0x10,%esp
+    8dc6:	80 7d b8 5a          	cmpb   $0x5a,-0x48(%ebp)
+    8dca:	75 34                	jne    8e00 <mmaptest+0x279>
+    8dcc:	80 7d b9 59          	cmpb   $0x59,-0x47(%ebp)
+    8dd0:	75 2e                	jne    8e00 <mmaptest+0x279>
+  close(fd);
+    8dd2:	83 ec 0c             	sub    $0xc,%esp
+    8dd5:	56                   	push   %esi
+    8dd6:	e8 2c 12 00 00       	call   a007 <close>
+  unlink("mmapfile");
+    8ddb:	c7 04 24 f0 cd 00 00 	movl   $0xcdf0,(%esp)
+    8de2:	e8 60 13 00 00       	call   a147 <unlink>
+  printf(1, "mmap test OK\n");
+    8de7:	83 c4 08             	add    $0x8,%esp
+    8dea:	68 a6 ce 00 00       	push   $0xcea6
+    8def:	6a 01                	push   $0x1
+    8df1:	e8 1b 17 00 00       	call   a511 <printf>
+}
+    8df6:	83 c4 10             	add    $0x10,%esp
+    8df9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    8dfc:	5b                   	pop    %ebx
+    8dfd:	5e                   	pop    %esi
+    8dfe:	5d                   	pop    %ebp
+    8dff:	c3                   	ret
+    printf(1, "mmap: shared store lost\n");
+    8e00:	83 ec 08             	sub    $0x8,%esp
+    8e03:	68 8d ce 00 00       	push   $0xce8d
+    8e08:	6a 01                	push   $0x1
+    8e0a:	e8 02 17 00 00       	call   a511 <printf>
+    exit();
+    8e0f:	e8 c4 11 00 00       	call   9fd8 <exit>
+
+00008e14 <mmapreusetest>:
+{
+    8e14:	55                   	push   %ebp
+    8e15:	89 e5                	mov    %esp,%ebp
+    8e17:	57                   	push   %edi
+    8e18:	56                   	push   %esi
+    8e19:	53                   	push   %ebx
+    8e1a:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "mmap reuse test\n");
+    8e1d:	68 b4 ce 00 00       	push   $0xceb4
+    8e22:	6a 01                	push   $0x1
+    8e24:	e8 e8 16 00 00       	call   a511 <printf>
+  if((fd = open("mmapreuse", O_CREATE|O_RDWR)) < 0 || write(fd, "r", 1) != 1){
+    8e29:	83 c4 08             	add    $0x8,%esp
+    8e2c:	68 02 02 00 00       	push   $0x202
+    8e31:	68 c5 ce 00 00       	push   $0xcec5
+    8e36:	e8 ee 12 00 00       	call   a129 <open>
+    8e3b:	83 c4 10             	add    $0x10,%esp
+    8e3e:	85 c0                	test   %eax,%eax
+    8e40:	78 26                	js     8e68 <mmapreusetest+0x54>
+    8e42:	89 c7                	mov    %eax,%edi
+    8e44:	83 ec 04             	sub    $0x4,%esp
+    8e47:	6a 01                	push   $0x1
+    8e49:	68 37 d3 00 00       	push   $0xd337
+    8e4e:	50                   	push   %eax
+    8e4f:	e8 b7 12 00 00       	call   a10b <write>
+    8e54:	83 c4 10             	add    $0x10,%esp
+    8e57:	83 f8 01             	cmp    $0x1,%eax
+    8e5a:	75 0c                	jne    8e68 <mmapreusetest+0x54>
+  for(i = 0; i < 100; i++){
+    8e5c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  first = 0;
+    8e61:	be 00 00 00 00       	mov    $0x0,%esi
+    8e66:	eb 45                	jmp    8ead <mmapreusetest+0x99>
+    printf(1, "mmap reuse: create failed\n");
+    8e68:	83 ec 08             	sub    $0x8,%esp
+    8e6b:	68 cf ce 00 00       	push   $0xcecf
+    8e70:	6a 01                	push   $0x1
+    8e72:	e8 9a 16 00 00       	call   a511 <printf>
+    exit();
+    8e77:	e8 5c 11 00 00       	call   9fd8 <exit>
+      printf(1, "mmap reuse: mmap %d failed\n", i);
+    8e7c:	83 ec 04             	sub    $0x4,%esp
+    8e7f:	53                   	push   %ebx
+    8e80:	68 ea ce 00 00       	push   $0xceea
+    8e85:	6a 01                	push   $0x1
+    8e87:	e8 85 16 00 00       	call   a511 <printf>
+      exit();
+    8e8c:	e8 47 11 00 00       	call   9fd8 <exit>
+    if(p != first){
+    8e91:	39 c6                	cmp    %eax,%esi
+    8e93:	75 48                	jne    8edd <mmapreusetest+0xc9>
+    if(munmap(p, 64*1024*1024) < 0){
+    8e95:	83 ec 08             	sub    $0x8,%esp
+    8e98:	68 00 00 00 04       	push   $0x4000000
+    8e9d:	50                   	push   %eax
+    8e9e:	e8 76 13 00 00       	call   a219 <munmap>
+    8ea3:	83 c4 10             	add    $0x10,%esp
+    8ea6:	85 c0                	test   %eax,%eax
+    8ea8:	78 4d                	js     8ef7 <mmapreusetest+0xe3>
+  for(i = 0; i < 100; i++){
+    8eaa:	83 c3 01             	add    $0x1,%ebx
+    8ead:	83 fb 63             	cmp    $0x63,%ebx
+    8eb0:	7f 59                	jg     8f0b <mmapreusetest+0xf7>
+    p = mmap(0, 64*1024*1024, PROT_READ, MAP_PRIVATE, fd, 0);
+    8eb2:	83 ec 08             	sub    $0x8,%esp
+    8eb5:	6a 00                	push   $0x0
+    8eb7:	57                   	push   %edi
+    8eb8:	6a 02                	push   $0x2
+    8eba:	6a 01                	push   $0x1
+    8ebc:	68 00 00 00 04       	push   $0x4000000
+    8ec1:	6a 00                	push   $0x0
+    8ec3:	e8 42 13 00 00       	call   a20a <mmap>
+    if(p == (char*)-1 || p[0] != 'r'){
+    8ec8:	83 c4 20             	add    $0x20,%esp
+    8ecb:	83 f8 ff             	cmp    $0xffffffff,%eax
+    8ece:	74 ac                	je     8e7c <mmapreusetest+0x68>
+    8ed0:	80 38 72             	cmpb   $0x72,(%eax)
+    8ed3:	75 a7                	jne    8e7c <mmapreusetest+0x68>
+    if(first == 0)
+    8ed5:	85 f6                	test   %esi,%esi
+    8ed7:	75 b8                	jne    8e91 <mmapreusetest+0x7d>
+      first = p;
+    8ed9:	89 c6                	mov    %eax,%esi
+    8edb:	eb b4                	jmp    8e91 <mmapreusetest+0x7d>
+      printf(1, "mmap reuse: mmap %d at %p, not %p\n", i, p, first);
+    8edd:	83 ec 0c             	sub    $0xc,%esp
+    8ee0:	56                   	push   %esi
+    8ee1:	50                   	push   %eax
+    8ee2:	53                   	push   %ebx
+    8ee3:	68 88 e8 00 00       	push   $0xe888
+    8ee8:	6a 01                	push   $0x1
+    8eea:	e8 22 16 00 00       	call   a511 <printf>
+      exit();
+    8eef:	83 c4 20             	add    $0x20,%esp
+    8ef2:	e8 e1 10 00 00       	call   9fd8 <exit>
+      printf(1, "mmap reuse: munmap failed\n");
+    8ef7:	83 ec 08             	sub    $0x8,%esp
+    8efa:	68 06 cf 00 00       	push   $0xcf06
+    8eff:	6a 01                	push   $0x1
+    8f01:	e8 0b 16 00 00       	call   a511 <printf>
+      exit();
+    8f06:	e8 cd 10 00 00       	call   9fd8 <exit>
+  p = mmap(0, 4096, PROT_READ, MAP_PRIVATE, fd, 0);
+    8f0b:	83 ec 08             	sub    $0x8,%esp
+    8f0e:	6a 00                	push   $0x0
+    8f10:	57                   	push   %edi
+    8f11:	6a 02                	push   $0x2
+    8f13:	6a 01                	push   $0x1
+    8f15:	68 00 10 00 00       	push   $0x1000
+    8f1a:	6a 00                	push   $0x0
+    8f1c:	e8 e9 12 00 00       	call   a20a <mmap>
+    8f21:	89 c3                	mov    %eax,%ebx
+  q = mmap(0, 4096, PROT_READ, MAP_PRIVATE, fd, 0);
+    8f23:	83 c4 18             	add    $0x18,%esp
+    8f26:	6a 00                	push   $0x0
+    8f28:	57                   	push   %edi
+    8f29:	6a 02                	push   $0x2
+    8f2b:	6a 01                	push   $0x1
+    8f2d:	68 00 10 00 00       	push   $0x1000
+    8f32:	6a 00                	push   $0x0
+    8f34:	e8 d1 12 00 00       	call   a20a <mmap>
+    8f39:	89 c6                	mov    %eax,%esi
+  if(p == (char*)-1 || q == (char*)-1 || munmap(p, 4096) < 0 ||
+    8f3b:	83 c4 20             	add    $0x20,%esp
+    8f3e:	83 fb ff             	cmp    $0xffffffff,%ebx
+    8f41:	0f 94 c0             	sete   %al
+    8f44:	83 fe ff             	cmp    $0xffffffff,%esi
+    8f47:	0f 94 c2             	sete   %dl
+    8f4a:	08 d0                	or     %dl,%al
+    8f4c:	0f 85 83 00 00 00    	jne    8fd5 <mmapreusetest+0x1c1>
+    8f52:	83 ec 08             	sub    $0x8,%esp
+    8f55:	68 00 10 00 00       	push   $0x1000
+    8f5a:	53                   	push   %ebx
+    8f5b:	e8 b9 12 00 00       	call   a219 <munmap>
+    8f60:	83 c4 10             	add    $0x10,%esp
+    8f63:	85 c0                	test   %eax,%eax
+    8f65:	78 6e                	js     8fd5 <mmapreusetest+0x1c1>
+     munmap(q, 4096) < 0 ||
+    8f67:	83 ec 08             	sub    $0x8,%esp
+    8f6a:	68 00 10 00 00       	push   $0x1000
+    8f6f:	56                   	push   %esi
+    8f70:	e8 a4 12 00 00       	call   a219 <munmap>
+  if(p == (char*)-1 || q == (char*)-1 || munmap(p, 4096) < 0 ||
+    8f75:	83 c4 10             	add    $0x10,%esp
+    8f78:	85 c0                	test   %eax,%eax
+    8f7a:	78 59                	js     8fd5 <mmapreusetest+0x1c1>
+     mmap(0, 4096, PROT_READ, MAP_PRIVATE, fd, 0) != p){
+    8f7c:	83 ec 08             	sub    $0x8,%esp
+    8f7f:	6a 00                	push   $0x0
+    8f81:	57                   	push   %edi
+    8f82:	6a 02                	push   $0x2
+    8f84:	6a 01                	push   $0x1
+    8f86:	68 00 10 00 00       	push   $0x1000
+    8f8b:	6a 00                	push   $0x0
+    8f8d:	e8 78 12 00 00       	call   a20a <mmap>
+     munmap(q, 4096) < 0 ||
+    8f92:	83 c4 20             	add    $0x20,%esp
+    8f95:	39 c3                	cmp    %eax,%ebx
+    8f97:	75 3c                	jne    8fd5 <mmapreusetest+0x1c1>
+  munmap(p, 4096);
+    8f99:	83 ec 08             	sub    $0x8,%esp
+    8f9c:	68 00 10 00 00       	push   $0x1000
+    8fa1:	53                   	push   %ebx
+    8fa2:	e8 72 12 00 00       	call   a219 <munmap>
+  close(fd);
+    8fa7:	89 3c 24             	mov    %edi,(%esp)
+    8faa:	e8 58 10 00 00       	call   a007 <close>
+  unlink("mmapreuse");
+    8faf:	c7 04 24 c5 ce 00 00 	movl   $0xcec5,(%esp)
+    8fb6:	e8 8c 11 00 00       	call   a147 <unlink>
+  printf(1, "mmap reuse test OK\n");
+    8fbb:	83 c4 08             	add    $0x8,%esp
+    8fbe:	68 21 cf 00 00       	push   $0xcf21
+    8fc3:	6a 01                	push   $0x1
+    8fc5:	e8 47 15 00 00       	call   a511 <printf>
+}
+    8fca:	83 c4 10             	add    $0x10,%esp
+    8fcd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    8fd0:	5b                   	pop    %ebx
+    8fd1:	5e                   	pop    %esi
+    8fd2:	5f                   	pop    %edi
+    8fd3:	5d                   	pop    %ebp
+    8fd4:	c3                   	ret
+    printf(1, "mmap reuse: hole not given back\n");
+    8fd5:	83 ec 08             	sub    $0x8,%esp
+    8fd8:	68 ac e8 00 00       	push   $0xe8ac
+    8fdd:	6a 01                	push   $0x1
+    8fdf:	e8 2d 15 00 00       	call   a511 <printf>
+    exit();
+    8fe4:	e8 ef 0f 00 00       	call   9fd8 <exit>
+
+00008fe9 <dirtest>:
+{
+    8fe9:	55                   	push   %ebp
+    8fea:	89 e5                	mov    %esp,%ebp
+    8fec:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+    8fef:	68 35 cf 00 00       	push   $0xcf35
+    8ff4:	ff 35 a4 04 01 00    	push   0x104a4
+    8ffa:	e8 12 15 00 00       	call   a511 <printf>
+  if(mkdir("dir0") < 0){
+    8fff:	c7 04 24 41 cf 00 00 	movl   $0xcf41,(%esp)
+    9006:	e8 69 11 00 00       	call   a174 <mkdir>
+    900b:	83 c4 10             	add    $0x10,%esp
+    900e:	85 c0                	test   %eax,%eax
+    9010:	78 54                	js     9066 <dirtest+0x7d>
+  if(chdir("dir0") < 0){
+    9012:	83 ec 0c             	sub    $0xc,%esp
+    9015:	68 41 cf 00 00       	push   $0xcf41
+    901a:	e8 64 11 00 00       	call   a183 <chdir>
+    901f:	83 c4 10             	add    $0x10,%esp
+    9022:	85 c0                	test   %eax,%eax
+    9024:	78 58                	js     907e <dirtest+0x95>
+  if(chdir("..") < 0){
+    9026:	83 ec 0c             	sub    $0xc,%esp
+    9029:	68 a8 c0 00 00       	push   $0xc0a8
+    902e:	e8 50 11 00 00       	call   a183 <chdir>
+    9033:	83 c4 10             	add    $0x10,%esp
+    9036:	85 c0                	test   %eax,%eax
+    9038:	78 5c                	js     9096 <dirtest+0xad>
+  if(unlink("dir0") < 0){
+    903a:	83 ec 0c             	sub    $0xc,%esp
+    903d:	68 41 cf 00 00       	push   $0xcf41
+    9042:	e8 00 11 00 00       	call   a147 <unlink>
+    9047:	83 c4 10             	add    $0x10,%esp
+    904a:	85 c0                	test   %eax,%eax
+    904c:	78 60                	js     90ae <dirtest+0xc5>
+  printf(stdout, "mkdir test ok\n");
+    904e:	83 ec 08             	sub    $0x8,%esp
+    9051:	68 7e cf 00 00       	push   $0xcf7e
+    9056:	ff 35 a4 04 01 00    	push   0x104a4
+    905c:	e8 b0 14 00 00       	call   a511 <printf>
+}
+    9061:	83 c4 10             	add    $0x10,%esp
+    9064:	c9                   	leave
+    9065:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+    9066:	83 ec 08             	sub    $0x8,%esp
+    9069:	68 2d be 00 00       	push   $0xbe2d
+    906e:	ff 35 a4 04 01 00    	push   0x104a4
+    9074:	e8 98 14 00 00       	call   a511 <printf>
+    exit();
+    9079:	e8 5a 0f 00 00       	call   9fd8 <exit>
+    printf(stdout, "chdir dir0 failed\n");
+    907e:	83 ec 08             	sub    $0x8,%esp
+    9081:	68 46 cf 00 00       	push   $0xcf46
+    9086:	ff 35 a4 04 01 00    	push   0x104a4
+    908c:	e8 80 14 00 00       	call   a511 <printf>
+    exit();
+    9091:	e8 42 0f 00 00       	call   9fd8 <exit>
+    printf(stdout, "chdir .. failed\n");
+    9096:	83 ec 08             	sub    $0x8,%esp
+    9099:	68 59 cf 00 00       	push   $0xcf59
+    909e:	ff 35 a4 04 01 00    	push   0x104a4
+    90a4:	e8 68 14 00 00       	call   a511 <printf>
+    exit();
+    90a9:	e8 2a 0f 00 00       	call   9fd8 <exit>
+    printf(stdout, "unlink dir0 failed\n");
+    90ae:	83 ec 08             	sub    $0x8,%esp
+    90b1:	68 6a cf 00 00       	push   $0xcf6a
+    90b6:	ff 35 a4 04 01 00    	push   0x104a4
+    90bc:	e8 50 14 00 00       	call   a511 <printf>
+    exit();
+    90c1:	e8 12 0f 00 00       	call   9fd8 <exit>
+
+000090c6 <exectest>:
+{
+    90c6:	55                   	push   %ebp
+    90c7:	89 e5                	mov    %esp,%ebp
+    90c9:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+    90cc:	68 8d cf 00 00       	push   $0xcf8d
+    90d1:	ff 35 a4 04 01 00    	push   0x104a4
+    90d7:	e8 35 14 00 00       	call   a511 <printf>
+  if(exec("echo", echoargv) < 0){
+    90dc:	83 c4 08             	add    $0x8,%esp
+    90df:	68 a8 04 01 00       	push   $0x104a8
+    90e4:	68 47 ad 00 00       	push   $0xad47
+    90e9:	e8 fc 0e 00 00       	call   9fea <exec>
+    90ee:	83 c4 10             	add    $0x10,%esp
+    90f1:	85 c0                	test   %eax,%eax
+    90f3:	78 02                	js     90f7 <exectest+0x31>
+}
+    90f5:	c9                   	leave
+    90f6:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+    90f7:	83 ec 08             	sub    $0x8,%esp
+    90fa:	68 98 cf 00 00       	push   $0xcf98
+    90ff:	ff 35 a4 04 01 00    	push   0x104a4
+    9105:	e8 07 14 00 00       	call   a511 <printf>
+    exit();
+    910a:	e8 c9 0e 00 00       	call   9fd8 <exit>
+
+0000910f <validateint>:
+}
+    910f:	c3                   	ret
+
+00009110 <fsfull>:
+{
+    9110:	55                   	push   %ebp
+    9111:	89 e5                	mov    %esp,%ebp
+    9113:	57                   	push   %edi
+    9114:	56                   	push   %esi
+    9115:	53                   	push   %ebx
+    9116:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "fsfull test\n");
+    9119:	68 aa cf 00 00       	push   $0xcfaa
+    911e:	6a 01                	push   $0x1
+    9120:	e8 ec 13 00 00       	call   a511 <printf>
+    9125:	83 c4 10             	add    $0x10,%esp
+  for(nfiles = 0; ; nfiles++){
+    9128:	bb 00 00 00 00       	mov    $0x0,%ebx
+    name[0] = 'f';
+    912d:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    9131:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    9136:	89 d8                	mov    %ebx,%eax
+    9138:	f7 ea                	imul   %edx
+    913a:	c1 fa 06             	sar    $0x6,%edx
+    913d:	89 de                	mov    %ebx,%esi
+    913f:	c1 fe 1f             	sar    $0x1f,%esi
+    9142:	29 f2                	sub    %esi,%edx
+    9144:	8d 42 30             	lea    0x30(%edx),%eax
+    9147:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    914a:	69 d2 e8 03 00 00    	imul   $0x3e8,%edx,%edx
+    9150:	89 d9                	mov    %ebx,%ecx
+    9152:	29 d1                	sub    %edx,%ecx
+    9154:	bf 1f 85 eb 51       	mov    $0x51eb851f,%edi
+    9159:	89 c8                	mov    %ecx,%eax
+    915b:	f7 ef                	imul   %edi
+    915d:	c1 fa 05             	sar    $0x5,%edx
+    9160:	c1 f9 1f             	sar    $0x1f,%ecx
+    9163:	29 ca                	sub    %ecx,%edx
+    9165:	83 c2 30             	add    $0x30,%edx
+    9168:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    916b:	89 d8                	mov    %ebx,%eax
+    916d:	f7 ef                	imul   %edi
+    916f:	89 d7                	mov    %edx,%edi
+    9171:	c1 ff 05             	sar    $0x5,%edi
+    9174:	29 f7                	sub    %esi,%edi
+    9176:	6b c7 64             	imul   $0x64,%edi,%eax
+    9179:	89 df                	mov    %ebx,%edi
+    917b:	29 c7                	sub    %eax,%edi
+    917d:	b9 67 66 66 66       	mov    $0x66666667,%ecx
+    9182:	89 f8                	mov    %edi,%eax
+    9184:	f7 e9                	imul   %ecx
+    9186:	c1 fa 02             	sar    $0x2,%edx
+    9189:	c1 ff 1f             	sar    $0x1f,%edi
+    918c:	29 fa                	sub    %edi,%edx
+    918e:	83 c2 30             	add    $0x30,%edx
+    9191:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    9194:	89 d8                	mov    %ebx,%eax
+    9196:	f7 e9                	imul   %ecx
+    9198:	c1 fa 02             	sar    $0x2,%edx
+    919b:	29 f2                	sub    %esi,%edx
+    919d:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    91a0:	01 c0                	add    %eax,%eax
+    91a2:	89 da                	mov    %ebx,%edx
+    91a4:	29 c2                	sub    %eax,%edx
+    91a6:	83 c2 30             	add    $0x30,%edx
+    91a9:	88 55 ac             	mov    %dl,-0x54(%ebp)
+    name[5] = '\0';
+    91ac:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    printf(1, "writing %s\n", name);
+    91b0:	83 ec 04             	sub    $0x4,%esp
+    91b3:	8d 75 a8             	lea    -0x58(%ebp),%esi
+    91b6:	56                   	push   %esi
+    91b7:	68 b7 cf 00 00       	push   $0xcfb7
+    91bc:	6a 01                	push   $0x1
+    91be:	e8 4e 13 00 00       	call   a511 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    91c3:	83 c4 08             	add    $0x8,%esp
+    91c6:	68 02 02 00 00       	push   $0x202
+    91cb:	56                   	push   %esi
+    91cc:	e8 58 0f 00 00       	call   a129 <open>
+    91d1:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    91d3:	83 c4 10             	add    $0x10,%esp
+    91d6:	85 c0                	test   %eax,%eax
+    91d8:	79 1b                	jns    91f5 <fsfull+0xe5>
+      printf(1, "open %s failed\n", name);
+    91da:	83 ec 04             	sub    $0x4,%esp
+    91dd:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    91e0:	50                   	push   %eax
+    91e1:	68 e0 b3 00 00       	push   $0xb3e0
+    91e6:	6a 01                	push   $0x1
+    91e8:	e8 24 13 00 00       	call   a511 <printf>
+      break;
+    91ed:	83 c4 10             	add    $0x10,%esp
+    91f0:	e9 e6 00 00 00       	jmp    92db <fsfull+0x1cb>
+    int total = 0;
+    91f5:	bf 00 00 00 00       	mov    $0x0,%edi
+      int cc = write(fd, buf, 512);
+    91fa:	83 ec 04             	sub    $0x4,%esp
+    91fd:	68 00 02 00 00       	push   $0x200
+    9202:	68 a0 2c 01 00       	push   $0x12ca0
+    9207:	56                   	push   %esi
+    9208:	e8 fe 0e 00 00       	call   a10b <write>
+      if(cc < 512)
+    920d:	83 c4 10             	add    $0x10,%esp
+    9210:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    9215:	7e 04                	jle    921b <fsfull+0x10b>
+      total += cc;
+    9217:	01 c7                	add    %eax,%edi
+    while(1){
+    9219:	eb df                	jmp    91fa <fsfull+0xea>
+    printf(1, "wrote %d bytes\n", total);
+    921b:	83 ec 04             	sub    $0x4,%esp
+    921e:	57                   	push   %edi
+    921f:	68 c3 cf 00 00       	push   $0xcfc3
+    9224:	6a 01                	push   $0x1
+    9226:	e8 e6 12 00 00       	call   a511 <printf>
+    close(fd);
+    922b:	89 34 24             	mov    %esi,(%esp)
+    922e:	e8 d4 0d 00 00       	call   a007 <close>
+    if(total == 0)
+    9233:	83 c4 10             	add    $0x10,%esp
+    9236:	85 ff                	test   %edi,%edi
+    9238:	0f 84 9d 00 00 00    	je     92db <fsfull+0x1cb>
+  for(nfiles = 0; ; nfiles++){
+    923e:	83 c3 01             	add    $0x1,%ebx
+    9241:	e9 e7 fe ff ff       	jmp    912d <fsfull+0x1d>
+    name[0] = 'f';
+    9246:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    924a:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    924f:	89 d8                	mov    %ebx,%eax
+    9251:	f7 ea                	imul   %edx
+    9253:	c1 fa 06             	sar    $0x6,%edx
+    9256:	89 de                	mov    %ebx,%esi
+    9258:	c1 fe 1f             	sar    $0x1f,%esi
+    925b:	29 f2                	sub    %esi,%edx
+    925d:	8d 42 30             	lea    0x30(%edx),%eax
+    9260:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    9263:	69 d2 e8 03 00 00    	imul   $0x3e8,%edx,%edx
+    9269:	89 d9                	mov    %ebx,%ecx
+    926b:	29 d1                	sub    %edx,%ecx
+    926d:	bf 1f 85 eb 51       	mov    $0x51eb851f,%edi
+    9272:	89 c8                	mov    %ecx,%eax
+    9274:	f7 ef                	imul   %edi
+    9276:	c1 fa 05             	sar    $0x5,%edx
+    9279:	c1 f9 1f             	sar    $0x1f,%ecx
+    927c:	29 ca                	sub    %ecx,%edx
+    927e:	83 c2 30             	add    $0x30,%edx
+    9281:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    9284:	89 d8                	mov    %ebx,%eax
+    9286:	f7 ef                	imul   %edi
+    9288:	89 d7                	mov    %edx,%edi
+    928a:	c1 ff 05             	sar    $0x5,%edi
+    928d:	29 f7                	sub    %esi,%edi
+    928f:	6b c7 64             	imul   $0x64,%edi,%eax
+    9292:	89 df                	mov    %ebx,%edi
+    9294:	29 c7                	sub    %eax,%edi
+    9296:	b9 67 66 66 66       	mov    $0x66666667,%ecx
+    929b:	89 f8                	mov    %edi,%eax
+    929d:	f7 e9                	imul   %ecx
+    929f:	c1 fa 02             	sar    $0x2,%edx
+    92a2:	c1 ff 1f             	sar    $0x1f,%edi
+    92a5:	29 fa                	sub    %edi,%edx
+    92a7:	83 c2 30             	add    $0x30,%edx
+    92aa:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    92ad:	89 d8                	mov    %ebx,%eax
+    92af:	f7 e9                	imul   %ecx
+    92b1:	c1 fa 02             	sar    $0x2,%edx
+    92b4:	29 f2                	sub    %esi,%edx
+    92b6:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    92b9:	01 c0                	add    %eax,%eax
+    92bb:	89 da                	mov    %ebx,%edx
+    92bd:	29 c2                	sub    %eax,%edx
+    92bf:	83 c2 30             	add    $0x30,%edx
+    92c2:	88 55 ac             	mov    %dl,-0x54(%ebp)
+    name[5] = '\0';
+    92c5:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    unlink(name);
+    92c9:	83 ec 0c             	sub    $0xc,%esp
+    92cc:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    92cf:	50                   	push   %eax
+    92d0:	e8 72 0e 00 00       	call   a147 <unlink>
+    nfiles--;
+    92d5:	83 eb 01             	sub    $0x1,%ebx
+    92d8:	83 c4 10             	add    $0x10,%esp
+  while(nfiles >= 0){
+    92db:	85 db                	test   %ebx,%ebx
+    92dd:	0f 89 63 ff ff ff    	jns    9246 <fsfull+0x136>
+  printf(1, "fsfull test finished\n");
+    92e3:	83 ec 08             	sub    $0x8,%esp
+    92e6:	68 d3 cf 00 00       	push   $0xcfd3
+    92eb:	6a 01                	push   $0x1
+    92ed:	e8 1f 12 00 00       	call   a511 <printf>
+}
+    92f2:	83 c4 10             	add    $0x10,%esp
+    92f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    92f8:	5b                   	pop    %ebx
+    92f9:	5e                   	pop    %esi
+    92fa:	5f                   	pop    %edi
+    92fb:	5d                   	pop    %ebp
+    92fc:	c3                   	ret
+
+000092fd <rand>:
+
+unsigned long randstate = 1;
+unsigned int
+rand()
+{
+  randstate = randstate * 1664525 + 1013904223;
+    92fd:	69 05 a0 04 01 00 0d 	imul   $0x19660d,0x104a0,%eax
+    9304:	66 19 00 
+    9307:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    930c:	a3 a0 04 01 00       	mov    %eax,0x104a0
+  return randstate;
+}
+    9311:	c3                   	ret
+
+00009312 <msec>:
+
+int npass, nfail;
+
+uint
+msec(void)
+{
+    9312:	55                   	push   %ebp
+    9313:	89 e5                	mov    %esp,%ebp
+    9315:	83 ec 20             	sub    $0x20,%esp
+  struct timespec ts;
+
+  vclock_gettime(CLOCK_MONOTONIC, &ts);
+    9318:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    931b:	50                   	push   %eax
+    931c:	6a 01                	push   $0x1
+    931e:	e8 8e 09 00 00       	call   9cb1 <vclock_gettime>
+  return ts.tv_sec*1000 + ts.tv_nsec/1000000;
+    9323:	69 4d f0 e8 03 00 00 	imul   $0x3e8,-0x10(%ebp),%ecx
+    932a:	ba 83 de 1b 43       	mov    $0x431bde83,%edx
+    932f:	89 d0                	mov    %edx,%eax
+    9331:	f7 65 f4             	mull   -0xc(%ebp)
+    9334:	c1 ea 12             	shr    $0x12,%edx
+    9337:	8d 04 11             	lea    (%ecx,%edx,1),%eax
+}
+    933a:	c9                   	leave
+    933b:	c3                   	ret
+
+0000933c <jobname>:
+
+// name is utNN followed by suffix, for test t.
+void
+jobname(char *name, int t, char *suffix)
+{
+    933c:	55                   	push   %ebp
+    933d:	89 e5                	mov    %esp,%ebp
+    933f:	53                   	push   %ebx
+    9340:	83 ec 0c             	sub    $0xc,%esp
+    9343:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    9346:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  name[0] = 'u';
+    9349:	c6 01 75             	movb   $0x75,(%ecx)
+  name[1] = 't';
+    934c:	c6 41 01 74          	movb   $0x74,0x1(%ecx)
+  name[2] = '0' + t/10;
+    9350:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    9355:	89 d8                	mov    %ebx,%eax
+    9357:	f7 ea                	imul   %edx
+    9359:	c1 fa 02             	sar    $0x2,%edx
+    935c:	89 d8                	mov    %ebx,%eax
+    935e:	c1 f8 1f             	sar    $0x1f,%eax
+    9361:	29 c2                	sub    %eax,%edx
+    9363:	8d 42 30             	lea    0x30(%edx),%eax
+    9366:	88 41 02             	mov    %al,0x2(%ecx)
+  name[3] = '0' + t%10;
+    9369:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    936c:	8d 14 00             	lea    (%eax,%eax,1),%edx
+    936f:	89 d8                	mov    %ebx,%eax
+    9371:	29 d0                	sub    %edx,%eax
+    9373:	83 c0 30             	add    $0x30,%eax
+    9376:	88 41 03             	mov    %al,0x3(%ecx)
+  strcpy(name + 4, suffix);
+    9379:	ff 75 10             	push   0x10(%ebp)
+    937c:	83 c1 04             	add    $0x4,%ecx
+    937f:	51                   	push   %ecx
+    9380:	e8 1b 06 00 00       	call   99a0 <strcpy>
+}
+    9385:	83 c4 10             	add    $0x10,%esp
+    9388:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    938b:	c9                   	leave
+    938c:	c3                   	ret
+
+0000938d <jobstart>:
+
+void
+jobstart(struct job *jb, int t, int own)
+{
+    938d:	55                   	push   %ebp
+    938e:	89 e5                	mov    %esp,%ebp
+    9390:	57                   	push   %edi
+    9391:	56                   	push   %esi
+    9392:	53                   	push   %ebx
+    9393:	83 ec 38             	sub    $0x38,%esp
+    9396:	8b 75 08             	mov    0x8(%ebp),%esi
+    9399:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  char name[16];
+  int p[2], i;
+
+  if(pipe(p) < 0){
+    939c:	8d 45 d0             	lea    -0x30(%ebp),%eax
+    939f:	50                   	push   %eax
+    93a0:	e8 48 0d 00 00       	call   a0ed <pipe>
+    93a5:	83 c4 10             	add    $0x10,%esp
+    93a8:	85 c0                	test   %eax,%eax
+    93aa:	78 3c                	js     93e8 <jobstart+0x5b>
+    printf(1, "usertests: pipe failed\n");
+    exit();
+  }
+  jb->t = t;
+    93ac:	89 3e                	mov    %edi,(%esi)
+  jb->fd = p[0];
+    93ae:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    93b1:	89 46 08             	mov    %eax,0x8(%esi)
+  jb->own = own;
+    93b4:	8b 45 10             	mov    0x10(%ebp),%eax
+    93b7:	89 46 0c             	mov    %eax,0xc(%esi)
+  jb->start = msec();
+    93ba:	e8 53 ff ff ff       	call   9312 <msec>
+    93bf:	89 46 10             	mov    %eax,0x10(%esi)
+  if((jb->pid = fork()) < 0){
+    93c2:	e8 fd 0b 00 00       	call   9fc4 <fork>
+    93c7:	89 c3                	mov    %eax,%ebx
+    93c9:	89 46 04             	mov    %eax,0x4(%esi)
+    93cc:	85 c0                	test   %eax,%eax
+    93ce:	78 2c                	js     93fc <jobstart+0x6f>
+    printf(1, "usertests: fork failed\n");
+    exit();
+  }
+  if(jb->pid == 0){
+    93d0:	74 41                	je     9413 <jobstart+0x86>
+    }
+    tests[t].fn();
+    write(p[1], "p", 1);
+    exit();
+  }
+  close(p[1]);
+    93d2:	83 ec 0c             	sub    $0xc,%esp
+    93d5:	ff 75 d4             	push   -0x2c(%ebp)
+    93d8:	e8 2a 0c 00 00       	call   a007 <close>
+}
+    93dd:	83 c4 10             	add    $0x10,%esp
+    93e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    93e3:	5b                   	pop    %ebx
+    93e4:	5e                   	pop    %esi
+    93e5:	5f                   	pop    %edi
+    93e6:	5d                   	pop    %ebp
+    93e7:	c3                   	ret
+    printf(1, "usertests: pipe failed\n");
+    93e8:	83 ec 08             	sub    $0x8,%esp
+    93eb:	68 e9 cf 00 00       	push   $0xcfe9
+    93f0:	6a 01                	push   $0x1
+    93f2:	e8 1a 11 00 00       	call   a511 <printf>
+    exit();
+    93f7:	e8 dc 0b 00 00       	call   9fd8 <exit>
+    printf(1, "usertests: fork failed\n");
+    93fc:	83 ec 08             	sub    $0x8,%esp
+    93ff:	68 01 d0 00 00       	push   $0xd001
+    9404:	6a 01                	push   $0x1
+    9406:	e8 06 11 00 00       	call   a511 <printf>
+    exit();
+    940b:	e8 c8 0b 00 00       	call   9fd8 <exit>
+    for(i = 0; i < njob; i++)
+    9410:	83 c3 01             	add    $0x1,%ebx
+    9413:	39 1d c8 04 01 00    	cmp    %ebx,0x104c8
+    9419:	7e 21                	jle    943c <jobstart+0xaf>
+      if(jobs[i].t >= 0)
+    941b:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+    941e:	83 3c 85 e0 04 01 00 	cmpl   $0x0,0x104e0(,%eax,4)
+    9425:	00 
+    9426:	78 e8                	js     9410 <jobstart+0x83>
+        close(jobs[i].fd);
+    9428:	83 ec 0c             	sub    $0xc,%esp
+    942b:	ff 34 85 e8 04 01 00 	push   0x104e8(,%eax,4)
+    9432:	e8 d0 0b 00 00       	call   a007 <close>
+    9437:	83 c4 10             	add    $0x10,%esp
+    943a:	eb d4                	jmp    9410 <jobstart+0x83>
+    if(own){
+    943c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+    9440:	74 7e                	je     94c0 <jobstart+0x133>
+      jobname(name, t, ".log");
+    9442:	83 ec 04             	sub    $0x4,%esp
+    9445:	68 19 d0 00 00       	push   $0xd019
+    944a:	57                   	push   %edi
+    944b:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    944e:	53                   	push   %ebx
+    944f:	e8 e8 fe ff ff       	call   933c <jobname>
+      close(1);
+    9454:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    945b:	e8 a7 0b 00 00       	call   a007 <close>
+      if(open(name, O_CREATE|O_RDWR) != 1)
+    9460:	83 c4 08             	add    $0x8,%esp
+    9463:	68 02 02 00 00       	push   $0x202
+    9468:	53                   	push   %ebx
+    9469:	e8 bb 0c 00 00       	call   a129 <open>
+    946e:	83 c4 10             	add    $0x10,%esp
+    9471:	83 f8 01             	cmp    $0x1,%eax
+    9474:	75 6b                	jne    94e1 <jobstart+0x154>
+      jobname(name, t, "");
+    9476:	83 ec 04             	sub    $0x4,%esp
+    9479:	68 6b b5 00 00       	push   $0xb56b
+    947e:	57                   	push   %edi
+    947f:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    9482:	53                   	push   %ebx
+    9483:	e8 b4 fe ff ff       	call   933c <jobname>
+      if(mkdir(name) < 0 || chdir(name) < 0 || link("/README", "README") < 0){
+    9488:	89 1c 24             	mov    %ebx,(%esp)
+    948b:	e8 e4 0c 00 00       	call   a174 <mkdir>
+    9490:	83 c4 10             	add    $0x10,%esp
+    9493:	85 c0                	test   %eax,%eax
+    9495:	78 4f                	js     94e6 <jobstart+0x159>
+    9497:	83 ec 0c             	sub    $0xc,%esp
+    949a:	53                   	push   %ebx
+    949b:	e8 e3 0c 00 00       	call   a183 <chdir>
+    94a0:	83 c4 10             	add    $0x10,%esp
+    94a3:	85 c0                	test   %eax,%eax
+    94a5:	78 3f                	js     94e6 <jobstart+0x159>
+    94a7:	83 ec 08             	sub    $0x8,%esp
+    94aa:	68 e6 be 00 00       	push   $0xbee6
+    94af:	68 e5 be 00 00       	push   $0xbee5
+    94b4:	e8 ac 0c 00 00       	call   a165 <link>
+    94b9:	83 c4 10             	add    $0x10,%esp
+    94bc:	85 c0                	test   %eax,%eax
+    94be:	78 26                	js     94e6 <jobstart+0x159>
+    tests[t].fn();
+    94c0:	8d 04 7f             	lea    (%edi,%edi,2),%eax
+    94c3:	ff 14 85 e4 00 01 00 	call   *0x100e4(,%eax,4)
+    write(p[1], "p", 1);
+    94ca:	83 ec 04             	sub    $0x4,%esp
+    94cd:	6a 01                	push   $0x1
+    94cf:	68 f8 c5 00 00       	push   $0xc5f8
+    94d4:	ff 75 d4             	push   -0x2c(%ebp)
+    94d7:	e8 2f 0c 00 00       	call   a10b <write>
+    exit();
+    94dc:	e8 f7 0a 00 00       	call   9fd8 <exit>
+        exit();
+    94e1:	e8 f2 0a 00 00       	call   9fd8 <exit>
+        printf(2, "usertests: cannot set up %s\n", name);
+    94e6:	83 ec 04             	sub    $0x4,%esp
+    94e9:	8d 45 d8             	lea    -0x28(%ebp),%eax
+    94ec:	50                   	push   %eax
+    94ed:	68 1e d0 00 00       	push   $0xd01e
+    94f2:	6a 02                	push   $0x2
+    94f4:	e8 18 10 00 00       	call   a511 <printf>
+        exit();
+    94f9:	e8 da 0a 00 00       	call   9fd8 <exit>
+
+000094fe <jobwait>:
+
+// Wait for a test to finish and report it.
+void
+jobwait(void)
+{
+    94fe:	55                   	push   %ebp
+    94ff:	89 e5                	mov    %esp,%ebp
+    9501:	56                   	push   %esi
+    9502:	53                   	push   %ebx
+    9503:	83 ec 20             	sub    $0x20,%esp
+  struct job *jb;
+  char name[16], c;
+  int pid, ok, fd, n;
+
+  if((pid = wait()) < 0){
+    9506:	e8 d3 0b 00 00       	call   a0de <wait>
+    950b:	85 c0                	test   %eax,%eax
+    950d:	78 07                	js     9516 <jobwait+0x18>
+    printf(1, "usertests: wait failed\n");
+    exit();
+  }
+  for(jb = jobs; jb < &jobs[njob] && jb->pid != pid; jb++)
+    950f:	bb e0 04 01 00       	mov    $0x104e0,%ebx
+    9514:	eb 17                	jmp    952d <jobwait+0x2f>
+    printf(1, "usertests: wait failed\n");
+    9516:	83 ec 08             	sub    $0x8,%esp
+    9519:	68 42 d0 00 00       	push   $0xd042
+    951e:	6a 01                	push   $0x1
+    9520:	e8 ec 0f 00 00       	call   a511 <printf>
+    exit();
+    9525:	e8 ae 0a 00 00       	call   9fd8 <exit>
+  for(jb = jobs; jb < &jobs[njob] && jb->pid != pid; jb++)
+    952a:	83 c3 14             	add    $0x14,%ebx
+    952d:	8b 15 c8 04 01 00    	mov    0x104c8,%edx
+    9533:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    9536:	8d 14 95 e0 04 01 00 	lea    0x104e0(,%edx,4),%edx
+    953d:	39 d3                	cmp    %edx,%ebx
+    953f:	73 05                	jae    9546 <jobwait+0x48>
+    9541:	39 43 04             	cmp    %eax,0x4(%ebx)
+    9544:	75 e4                	jne    952a <jobwait+0x2c>
+    ;
+  if(jb == &jobs[njob])
+    9546:	39 da                	cmp    %ebx,%edx
+    9548:	74 72                	je     95bc <jobwait+0xbe>
+    return;
+  ok = read(jb->fd, &c, 1) == 1;
+    954a:	83 ec 04             	sub    $0x4,%esp
+    954d:	6a 01                	push   $0x1
+    954f:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    9552:	50                   	push   %eax
+    9553:	ff 73 08             	push   0x8(%ebx)
+    9556:	e8 a1 0b 00 00       	call   a0fc <read>
+    955b:	89 c6                	mov    %eax,%esi
+  close(jb->fd);
+    955d:	83 c4 04             	add    $0x4,%esp
+    9560:	ff 73 08             	push   0x8(%ebx)
+    9563:	e8 9f 0a 00 00       	call   a007 <close>
+  if(ok)
+    9568:	83 c4 10             	add    $0x10,%esp
+    956b:	83 fe 01             	cmp    $0x1,%esi
+    956e:	74 53                	je     95c3 <jobwait+0xc5>
+    npass++;
+  else
+    nfail++;
+    9570:	83 05 c0 04 01 00 01 	addl   $0x1,0x104c0
+  printf(1, "%s: %s (%d ms)\n", tests[jb->t].name, ok ? "ok" : "FAILED",
+         msec() - jb->start);
+    9577:	e8 96 fd ff ff       	call   9312 <msec>
+  printf(1, "%s: %s (%d ms)\n", tests[jb->t].name, ok ? "ok" : "FAILED",
+    957c:	2b 43 10             	sub    0x10(%ebx),%eax
+    957f:	83 fe 01             	cmp    $0x1,%esi
+    9582:	74 48                	je     95cc <jobwait+0xce>
+    9584:	b9 3b d0 00 00       	mov    $0xd03b,%ecx
+    9589:	8b 13                	mov    (%ebx),%edx
+    958b:	83 ec 0c             	sub    $0xc,%esp
+    958e:	50                   	push   %eax
+    958f:	51                   	push   %ecx
+    9590:	8d 04 52             	lea    (%edx,%edx,2),%eax
+    9593:	ff 34 85 e0 00 01 00 	push   0x100e0(,%eax,4)
+    959a:	68 5a d0 00 00       	push   $0xd05a
+    959f:	6a 01                	push   $0x1
+    95a1:	e8 6b 0f 00 00       	call   a511 <printf>
+  if(jb->own){
+    95a6:	83 c4 20             	add    $0x20,%esp
+    95a9:	83 7b 0c 00          	cmpl   $0x0,0xc(%ebx)
+    95ad:	75 24                	jne    95d3 <jobwait+0xd5>
+    jobname(name, jb->t, "/README");
+    unlink(name);
+    name[4] = 0;
+    unlink(name);
+  }
+  jb->t = -1;
+    95af:	c7 03 ff ff ff ff    	movl   $0xffffffff,(%ebx)
+  jb->pid = 0;
+    95b5:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+    95bc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    95bf:	5b                   	pop    %ebx
+    95c0:	5e                   	pop    %esi
+    95c1:	5d                   	pop    %ebp
+    95c2:	c3                   	ret
+    npass++;
+    95c3:	83 05 c4 04 01 00 01 	addl   $0x1,0x104c4
+    95ca:	eb ab                	jmp    9577 <jobwait+0x79>
+  printf(1, "%s: %s (%d ms)\n", tests[jb->t].name, ok ? "ok" : "FAILED",
+    95cc:	b9 e1 b2 00 00       	mov    $0xb2e1,%ecx
+    95d1:	eb b6                	jmp    9589 <jobwait+0x8b>
+    jobname(name, jb->t, ".log");
+    95d3:	83 ec 04             	sub    $0x4,%esp
+    95d6:	68 19 d0 00 00       	push   $0xd019
+    95db:	ff 33                	push   (%ebx)
+    95dd:	8d 45 e8             	lea    -0x18(%ebp),%eax
+    95e0:	50                   	push   %eax
+    95e1:	e8 56 fd ff ff       	call   933c <jobname>
+    if(!ok && (fd = open(name, 0)) >= 0){
+    95e6:	83 c4 10             	add    $0x10,%esp
+    95e9:	83 fe 01             	cmp    $0x1,%esi
+    95ec:	75 35                	jne    9623 <jobwait+0x125>
+    unlink(name);
+    95ee:	83 ec 0c             	sub    $0xc,%esp
+    95f1:	8d 75 e8             	lea    -0x18(%ebp),%esi
+    95f4:	56                   	push   %esi
+    95f5:	e8 4d 0b 00 00       	call   a147 <unlink>
+    jobname(name, jb->t, "/README");
+    95fa:	83 c4 0c             	add    $0xc,%esp
+    95fd:	68 e5 be 00 00       	push   $0xbee5
+    9602:	ff 33                	push   (%ebx)
+    9604:	56                   	push   %esi
+    9605:	e8 32 fd ff ff       	call   933c <jobname>
+    unlink(name);
+    960a:	89 34 24             	mov    %esi,(%esp)
+    960d:	e8 35 0b 00 00       	call   a147 <unlink>
+    name[4] = 0;
+    9612:	c6 45 ec 00          	movb   $0x0,-0x14(%ebp)
+    unlink(name);
+    9616:	89 34 24             	mov    %esi,(%esp)
+    9619:	e8 29 0b 00 00       	call   a147 <unlink>
+    961e:	83 c4 10             	add    $0x10,%esp
+    9621:	eb 8c                	jmp    95af <jobwait+0xb1>
+    if(!ok && (fd = open(name, 0)) >= 0){
+    9623:	83 ec 08             	sub    $0x8,%esp
+    9626:	6a 00                	push   $0x0
+    9628:	8d 45 e8             	lea    -0x18(%ebp),%eax
+    962b:	50                   	push   %eax
+    962c:	e8 f8 0a 00 00       	call   a129 <open>
+    9631:	89 c6                	mov    %eax,%esi
+    9633:	83 c4 10             	add    $0x10,%esp
+    9636:	85 c0                	test   %eax,%eax
+    9638:	79 15                	jns    964f <jobwait+0x151>
+    963a:	eb b2                	jmp    95ee <jobwait+0xf0>
+        write(1, buf, n);
+    963c:	83 ec 04             	sub    $0x4,%esp
+    963f:	50                   	push   %eax
+    9640:	68 a0 2c 01 00       	push   $0x12ca0
+    9645:	6a 01                	push   $0x1
+    9647:	e8 bf 0a 00 00       	call   a10b <write>
+    964c:	83 c4 10             	add    $0x10,%esp
+      while((n = read(fd, buf, sizeof(buf))) > 0)
+    964f:	83 ec 04             	sub    $0x4,%esp
+    9652:	68 00 20 00 00       	push   $0x2000
+    9657:	68 a0 2c 01 00       	push   $0x12ca0
+    965c:	56                   	push   %esi
+    965d:	e8 9a 0a 00 00       	call   a0fc <read>
+    9662:	83 c4 10             	add    $0x10,%esp
+    9665:	85 c0                	test   %eax,%eax
+    9667:	7f d3                	jg     963c <jobwait+0x13e>
+      close(fd);
+    9669:	83 ec 0c             	sub    $0xc,%esp
+    966c:	56                   	push   %esi
+    966d:	e8 95 09 00 00       	call   a007 <close>
+    9672:	83 c4 10             	add    $0x10,%esp
+    9675:	e9 74 ff ff ff       	jmp    95ee <jobwait+0xf0>
+
+0000967a <jobfree>:
+
+// A free job, once one of the running tests has finished.
+struct job*
+jobfree(void)
+{
+    967a:	55                   	push   %ebp
+    967b:	89 e5                	mov    %esp,%ebp
+    967d:	83 ec 08             	sub    $0x8,%esp
+    9680:	eb 05                	jmp    9687 <jobfree+0xd>
+
+  for(;;){
+    for(jb = jobs; jb < &jobs[njob]; jb++)
+      if(jb->t < 0)
+        return jb;
+    jobwait();
+    9682:	e8 77 fe ff ff       	call   94fe <jobwait>
+    for(jb = jobs; jb < &jobs[njob]; jb++)
+    9687:	ba e0 04 01 00       	mov    $0x104e0,%edx
+    968c:	a1 c8 04 01 00       	mov    0x104c8,%eax
+    9691:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+    9694:	8d 04 8d 00 00 00 00 	lea    0x0(,%ecx,4),%eax
+    969b:	05 e0 04 01 00       	add    $0x104e0,%eax
+    96a0:	39 c2                	cmp    %eax,%edx
+    96a2:	73 de                	jae    9682 <jobfree+0x8>
+      if(jb->t < 0)
+    96a4:	83 3a 00             	cmpl   $0x0,(%edx)
+    96a7:	78 05                	js     96ae <jobfree+0x34>
+    for(jb = jobs; jb < &jobs[njob]; jb++)
+    96a9:	83 c2 14             	add    $0x14,%edx
+    96ac:	eb de                	jmp    968c <jobfree+0x12>
+  }
+}
+    96ae:	89 d0                	mov    %edx,%eax
+    96b0:	c9                   	leave
+    96b1:	c3                   	ret
+
+000096b2 <jobsrunning>:
+int
+jobsrunning(void)
+{
+  struct job *jb;
+
+  for(jb = jobs; jb < &jobs[njob]; jb++)
+    96b2:	ba e0 04 01 00       	mov    $0x104e0,%edx
+    96b7:	eb 03                	jmp    96bc <jobsrunning+0xa>
+    96b9:	83 c2 14             	add    $0x14,%edx
+    96bc:	a1 c8 04 01 00       	mov    0x104c8,%eax
+    96c1:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+    96c4:	8d 04 8d 00 00 00 00 	lea    0x0(,%ecx,4),%eax
+    96cb:	05 e0 04 01 00       	add    $0x104e0,%eax
+    96d0:	39 c2                	cmp    %eax,%edx
+    96d2:	73 0b                	jae    96df <jobsrunning+0x2d>
+    if(jb->t >= 0)
+    96d4:	83 3a 00             	cmpl   $0x0,(%edx)
+    96d7:	78 e0                	js     96b9 <jobsrunning+0x7>
+      return 1;
+    96d9:	b8 01 00 00 00       	mov    $0x1,%eax
+  return 0;
+}
+    96de:	c3                   	ret
+  return 0;
+    96df:	b8 00 00 00 00       	mov    $0x0,%eax
+    96e4:	c3                   	ret
+
+000096e5 <wanted>:
+
+// Is test t one of the n named in names, or are none named?
+int
+wanted(int t, char **names, int n)
+{
+    96e5:	55                   	push   %ebp
+    96e6:	89 e5                	mov    %esp,%ebp
+    96e8:	57                   	push   %edi
+    96e9:	56                   	push   %esi
+    96ea:	53                   	push   %ebx
+    96eb:	83 ec 0c             	sub    $0xc,%esp
+    96ee:	8b 75 08             	mov    0x8(%ebp),%esi
+    96f1:	8b 7d 10             	mov    0x10(%ebp),%edi
+  int i;
+
+  for(i = 0; i < n; i++)
+    96f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    96f9:	eb 03                	jmp    96fe <wanted+0x19>
+    96fb:	83 c3 01             	add    $0x1,%ebx
+    96fe:	39 fb                	cmp    %edi,%ebx
+    9700:	7d 26                	jge    9728 <wanted+0x43>
+    if(strcmp(names[i], tests[t].name) == 0)
+    9702:	8d 04 76             	lea    (%esi,%esi,2),%eax
+    9705:	83 ec 08             	sub    $0x8,%esp
+    9708:	ff 34 85 e0 00 01 00 	push   0x100e0(,%eax,4)
+    970f:	8b 45 0c             	mov    0xc(%ebp),%eax
+    9712:	ff 34 98             	push   (%eax,%ebx,4)
+    9715:	e8 ac 02 00 00       	call   99c6 <strcmp>
+    971a:	83 c4 10             	add    $0x10,%esp
+    971d:	85 c0                	test   %eax,%eax
+    971f:	75 da                	jne    96fb <wanted+0x16>
+      return 1;
+    9721:	b8 01 00 00 00       	mov    $0x1,%eax
+    9726:	eb 08                	jmp    9730 <wanted+0x4b>
+  return n == 0;
+    9728:	85 ff                	test   %edi,%edi
+    972a:	0f 94 c0             	sete   %al
+    972d:	0f b6 c0             	movzbl %al,%eax
+}
+    9730:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    9733:	5b                   	pop    %ebx
+    9734:	5e                   	pop    %esi
+    9735:	5f                   	pop    %edi
+    9736:	5d                   	pop    %ebp
+    9737:	c3                   	ret
+
+00009738 <main>:
+
+int
+main(int argc, char *argv[])
+{
+    9738:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    973c:	83 e4 f0             	and    $0xfffffff0,%esp
+    973f:	ff 71 fc             	push   -0x4(%ecx)
+    9742:	55                   	push   %ebp
+    9743:	89 e5                	mov    %esp,%ebp
+    9745:	57                   	push   %edi
+    9746:	56                   	push   %esi
+    9747:	53                   	push   %ebx
+    9748:	51                   	push   %ecx
+    9749:	83 ec 58             	sub    $0x58,%esp
+    974c:	8b 31                	mov    (%ecx),%esi
+    974e:	8b 41 04             	mov    0x4(%ecx),%eax
+    9751:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  struct cpuinfo ci;
+  int i, t, nname;
+  char **names;
+  uint start;
+
+  for(njob = 0; getcpuinfo(njob, &ci) == 0; njob++)
+    9754:	c7 05 c8 04 01 00 00 	movl   $0x0,0x104c8
+    975b:	00 00 00 
+    975e:	eb 07                	jmp    9767 <main+0x2f>
+    9760:	83 05 c8 04 01 00 01 	addl   $0x1,0x104c8
+    9767:	83 ec 08             	sub    $0x8,%esp
+    976a:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    976d:	50                   	push   %eax
+    976e:	ff 35 c8 04 01 00    	push   0x104c8
+    9774:	e8 fa 0a 00 00       	call   a273 <getcpuinfo>
+    9779:	83 c4 10             	add    $0x10,%esp
+    977c:	85 c0                	test   %eax,%eax
+    977e:	74 e0                	je     9760 <main+0x28>
+    ;
+  for(i = 1; i < argc && argv[i][0] == '-'; i++){
+    9780:	bb 01 00 00 00       	mov    $0x1,%ebx
+    9785:	eb 36                	jmp    97bd <main+0x85>
+    if(strcmp(argv[i], "-s") == 0)
+      njob = 1;
+    else if(strcmp(argv[i], "-j") == 0 && i+1 < argc)
+    9787:	83 ec 08             	sub    $0x8,%esp
+    978a:	68 6d d0 00 00       	push   $0xd06d
+    978f:	ff 37                	push   (%edi)
+    9791:	e8 30 02 00 00       	call   99c6 <strcmp>
+    9796:	83 c4 10             	add    $0x10,%esp
+    9799:	85 c0                	test   %eax,%eax
+    979b:	75 52                	jne    97ef <main+0xb7>
+    979d:	83 c3 01             	add    $0x1,%ebx
+    97a0:	39 f3                	cmp    %esi,%ebx
+    97a2:	7d 4b                	jge    97ef <main+0xb7>
+      njob = atoi(argv[++i]);
+    97a4:	83 ec 0c             	sub    $0xc,%esp
+    97a7:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    97aa:	ff 34 98             	push   (%eax,%ebx,4)
+    97ad:	e8 25 04 00 00       	call   9bd7 <atoi>
+    97b2:	a3 c8 04 01 00       	mov    %eax,0x104c8
+    97b7:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc && argv[i][0] == '-'; i++){
+    97ba:	83 c3 01             	add    $0x1,%ebx
+    97bd:	39 f3                	cmp    %esi,%ebx
+    97bf:	7d 42                	jge    9803 <main+0xcb>
+    97c1:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    97c4:	8d 3c 98             	lea    (%eax,%ebx,4),%edi
+    97c7:	8b 07                	mov    (%edi),%eax
+    97c9:	80 38 2d             	cmpb   $0x2d,(%eax)
+    97cc:	75 35                	jne    9803 <main+0xcb>
+    if(strcmp(argv[i], "-s") == 0)
+    97ce:	83 ec 08             	sub    $0x8,%esp
+    97d1:	68 6a d0 00 00       	push   $0xd06a
+    97d6:	50                   	push   %eax
+    97d7:	e8 ea 01 00 00       	call   99c6 <strcmp>
+    97dc:	83 c4 10             	add    $0x10,%esp
+    97df:	85 c0                	test   %eax,%eax
+    97e1:	75 a4                	jne    9787 <main+0x4f>
+      njob = 1;
+    97e3:	c7 05 c8 04 01 00 01 	movl   $0x1,0x104c8
+    97ea:	00 00 00 
+    97ed:	eb cb                	jmp    97ba <main+0x82>
+    else {
+      printf(2, "usage: usertests [-s] [-j n] [test...]\n");
+    97ef:	83 ec 08             	sub    $0x8,%esp
+    97f2:	68 d0 e8 00 00       	push   $0xe8d0
+    97f7:	6a 02                	push   $0x2
+    97f9:	e8 13 0d 00 00       	call   a511 <printf>
+      exit();
+    97fe:	e8 d5 07 00 00       	call   9fd8 <exit>
+    }
+  }
+  if(njob < 1)
+    9803:	83 3d c8 04 01 00 00 	cmpl   $0x0,0x104c8
+    980a:	7e 5a                	jle    9866 <main+0x12e>
+    njob = 1;
+  if(njob > MAXJOB)
+    980c:	83 3d c8 04 01 00 08 	cmpl   $0x8,0x104c8
+    9813:	7e 0a                	jle    981f <main+0xe7>
+    njob = MAXJOB;
+    9815:	c7 05 c8 04 01 00 08 	movl   $0x8,0x104c8
+    981c:	00 00 00 
+  names = argv + i;
+    981f:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    9822:	8d 3c 98             	lea    (%eax,%ebx,4),%edi
+  nname = argc - i;
+    9825:	29 de                	sub    %ebx,%esi
+
+  printf(1, "usertests starting, %d at a time\n", njob);
+    9827:	83 ec 04             	sub    $0x4,%esp
+    982a:	ff 35 c8 04 01 00    	push   0x104c8
+    9830:	68 f8 e8 00 00       	push   $0xe8f8
+    9835:	6a 01                	push   $0x1
+    9837:	e8 d5 0c 00 00       	call   a511 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+    983c:	83 c4 08             	add    $0x8,%esp
+    983f:	6a 00                	push   $0x0
+    9841:	68 70 d0 00 00       	push   $0xd070
+    9846:	e8 de 08 00 00       	call   a129 <open>
+    984b:	83 c4 10             	add    $0x10,%esp
+    984e:	85 c0                	test   %eax,%eax
+    9850:	78 20                	js     9872 <main+0x13a>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+    9852:	83 ec 08             	sub    $0x8,%esp
+    9855:	68 1c e9 00 00       	push   $0xe91c
+    985a:	6a 01                	push   $0x1
+    985c:	e8 b0 0c 00 00       	call   a511 <printf>
+    exit();
+    9861:	e8 72 07 00 00       	call   9fd8 <exit>
+    njob = 1;
+    9866:	c7 05 c8 04 01 00 01 	movl   $0x1,0x104c8
+    986d:	00 00 00 
+    9870:	eb 9a                	jmp    980c <main+0xd4>
+  }
+  close(open("usertests.ran", O_CREATE));
+    9872:	83 ec 08             	sub    $0x8,%esp
+    9875:	68 00 02 00 00       	push   $0x200
+    987a:	68 70 d0 00 00       	push   $0xd070
+    987f:	e8 a5 08 00 00       	call   a129 <open>
+    9884:	89 04 24             	mov    %eax,(%esp)
+    9887:	e8 7b 07 00 00       	call   a007 <close>
+
+  for(i = 0; i < njob; i++)
+    988c:	83 c4 10             	add    $0x10,%esp
+    988f:	b8 00 00 00 00       	mov    $0x0,%eax
+    9894:	eb 11                	jmp    98a7 <main+0x16f>
+    jobs[i].t = -1;
+    9896:	8d 14 80             	lea    (%eax,%eax,4),%edx
+    9899:	c7 04 95 e0 04 01 00 	movl   $0xffffffff,0x104e0(,%edx,4)
+    98a0:	ff ff ff ff 
+  for(i = 0; i < njob; i++)
+    98a4:	83 c0 01             	add    $0x1,%eax
+    98a7:	39 05 c8 04 01 00    	cmp    %eax,0x104c8
+    98ad:	7f e7                	jg     9896 <main+0x15e>
+  start = msec();
+    98af:	e8 5e fa ff ff       	call   9312 <msec>
+    98b4:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  if(njob > 1){
+    98b7:	83 3d c8 04 01 00 01 	cmpl   $0x1,0x104c8
+    98be:	7e 52                	jle    9912 <main+0x1da>
+    for(t = 0; t < NTEST; t++)
+    98c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    98c5:	eb 03                	jmp    98ca <main+0x192>
+    98c7:	83 c3 01             	add    $0x1,%ebx
+    98ca:	83 fb 4f             	cmp    $0x4f,%ebx
+    98cd:	77 3a                	ja     9909 <main+0x1d1>
+      if(wanted(t, names, nname) && !(tests[t].flags & ALONE))
+    98cf:	83 ec 04             	sub    $0x4,%esp
+    98d2:	56                   	push   %esi
+    98d3:	57                   	push   %edi
+    98d4:	53                   	push   %ebx
+    98d5:	e8 0b fe ff ff       	call   96e5 <wanted>
+    98da:	83 c4 10             	add    $0x10,%esp
+    98dd:	85 c0                	test   %eax,%eax
+    98df:	74 e6                	je     98c7 <main+0x18f>
+    98e1:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+    98e4:	f6 04 85 e8 00 01 00 	testb  $0x1,0x100e8(,%eax,4)
+    98eb:	01 
+    98ec:	75 d9                	jne    98c7 <main+0x18f>
+        jobstart(jobfree(), t, 1);
+    98ee:	e8 87 fd ff ff       	call   967a <jobfree>
+    98f3:	83 ec 04             	sub    $0x4,%esp
+    98f6:	6a 01                	push   $0x1
+    98f8:	53                   	push   %ebx
+    98f9:	50                   	push   %eax
+    98fa:	e8 8e fa ff ff       	call   938d <jobstart>
+    98ff:	83 c4 10             	add    $0x10,%esp
+    9902:	eb c3                	jmp    98c7 <main+0x18f>
+    while(jobsrunning())
+      jobwait();
+    9904:	e8 f5 fb ff ff       	call   94fe <jobwait>
+    while(jobsrunning())
+    9909:	e8 a4 fd ff ff       	call   96b2 <jobsrunning>
+    990e:	85 c0                	test   %eax,%eax
+    9910:	75 f2                	jne    9904 <main+0x1cc>
+    for(t = 0; t < NTEST; t++)
+    9912:	bb 00 00 00 00       	mov    $0x0,%ebx
+    9917:	eb 1b                	jmp    9934 <main+0x1fc>
+  }
+  for(t = 0; t < NTEST; t++){
+    if(wanted(t, names, nname) && (njob == 1 || (tests[t].flags & ALONE))){
+      jobstart(&jobs[0], t, 0);
+    9919:	83 ec 04             	sub    $0x4,%esp
+    991c:	6a 00                	push   $0x0
+    991e:	53                   	push   %ebx
+    991f:	68 e0 04 01 00       	push   $0x104e0
+    9924:	e8 64 fa ff ff       	call   938d <jobstart>
+      jobwait();
+    9929:	e8 d0 fb ff ff       	call   94fe <jobwait>
+    992e:	83 c4 10             	add    $0x10,%esp
+  for(t = 0; t < NTEST; t++){
+    9931:	83 c3 01             	add    $0x1,%ebx
+    9934:	83 fb 4f             	cmp    $0x4f,%ebx
+    9937:	77 2a                	ja     9963 <main+0x22b>
+    if(wanted(t, names, nname) && (njob == 1 || (tests[t].flags & ALONE))){
+    9939:	83 ec 04             	sub    $0x4,%esp
+    993c:	56                   	push   %esi
+    993d:	57                   	push   %edi
+    993e:	53                   	push   %ebx
+    993f:	e8 a1 fd ff ff       	call   96e5 <wanted>
+    9944:	83 c4 10             	add    $0x10,%esp
+    9947:	85 c0                	test   %eax,%eax
+    9949:	74 e6                	je     9931 <main+0x1f9>
+    994b:	83 3d c8 04 01 00 01 	cmpl   $0x1,0x104c8
+    9952:	74 c5                	je     9919 <main+0x1e1>
+    9954:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+    9957:	f6 04 85 e8 00 01 00 	testb  $0x1,0x100e8(,%eax,4)
+    995e:	01 
+    995f:	74 d0                	je     9931 <main+0x1f9>
+    9961:	eb b6                	jmp    9919 <main+0x1e1>
+    }
+  }
+  printf(1, "usertests: %d passed, %d failed in %d ms\n", npass, nfail,
+         msec() - start);
+    9963:	e8 aa f9 ff ff       	call   9312 <msec>
+  printf(1, "usertests: %d passed, %d failed in %d ms\n", npass, nfail,
+    9968:	83 ec 0c             	sub    $0xc,%esp
+    996b:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+    996e:	29 d0                	sub    %edx,%eax
+    9970:	50                   	push   %eax
+    9971:	ff 35 c0 04 01 00    	push   0x104c0
+    9977:	ff 35 c4 04 01 00    	push   0x104c4
+    997d:	68 48 e9 00 00       	push   $0xe948
+    9982:	6a 01                	push   $0x1
+    9984:	e8 88 0b 00 00       	call   a511 <printf>
+
+  if(nfail == 0 && nname == 0)
+    9989:	83 c4 20             	add    $0x20,%esp
+    998c:	0b 35 c0 04 01 00    	or     0x104c0,%esi
+    9992:	74 05                	je     9999 <main+0x261>
+    exectest();
+  exit();
+    9994:	e8 3f 06 00 00       	call   9fd8 <exit>
+    exectest();
+    9999:	e8 28 f7 ff ff       	call   90c6 <exectest>
+    999e:	eb f4                	jmp    9994 <main+0x25c>
+
+000099a0 <strcpy>:
+#include "memlayout.h"
+#include "clock.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    99a0:	55                   	push   %ebp
+    99a1:	89 e5                	mov    %esp,%ebp
+    99a3:	56                   	push   %esi
+    99a4:	53                   	push   %ebx
+    99a5:	8b 75 08             	mov    0x8(%ebp),%esi
+    99a8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    99ab:	89 f0                	mov    %esi,%eax
+    99ad:	89 d1                	mov    %edx,%ecx
+    99af:	83 c2 01             	add    $0x1,%edx
+    99b2:	89 c3                	mov    %eax,%ebx
+    99b4:	83 c0 01             	add    $0x1,%eax
+    99b7:	0f b6 09             	movzbl (%ecx),%ecx
+    99ba:	88 0b                	mov    %cl,(%ebx)
+    99bc:	84 c9                	test   %cl,%cl
+    99be:	75 ed                	jne    99ad <strcpy+0xd>
+    ;
+  return os;
+}
+    99c0:	89 f0                	mov    %esi,%eax
+    99c2:	5b                   	pop    %ebx
+    99c3:	5e                   	pop    %esi
+    99c4:	5d                   	pop    %ebp
+    99c5:	c3                   	ret
+
+000099c6 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    99c6:	55                   	push   %ebp
+    99c7:	89 e5                	mov    %esp,%ebp
+    99c9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    99cc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+    99cf:	eb 06                	jmp    99d7 <strcmp+0x11>
+    p++, q++;
+    99d1:	83 c1 01             	add    $0x1,%ecx
+    99d4:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+    99d7:	0f b6 01             	movzbl (%ecx),%eax
+    99da:	84 c0                	test   %al,%al
+    99dc:	74 04                	je     99e2 <strcmp+0x1c>
+    99de:	3a 02                	cmp    (%edx),%al
+    99e0:	74 ef                	je     99d1 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+    99e2:	0f b6 c0             	movzbl %al,%eax
+    99e5:	0f b6 12             	movzbl (%edx),%edx
+    99e8:	29 d0                	sub    %edx,%eax
+}
+    99ea:	5d                   	pop    %ebp
+    99eb:	c3                   	ret
+
+000099ec <strlen>:
+
+uint
+strlen(const char *s)
+{
+    99ec:	55                   	push   %ebp
+    99ed:	89 e5                	mov    %esp,%ebp
+    99ef:	53                   	push   %ebx
+    99f0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  const char *p;
+  uint w;
+
+  for(p = s; (uint)p & 3; p++)
+    99f3:	89 c8                	mov    %ecx,%eax
+    99f5:	eb 03                	jmp    99fa <strlen+0xe>
+    99f7:	83 c0 01             	add    $0x1,%eax
+    99fa:	a8 03                	test   $0x3,%al
+    99fc:	74 09                	je     9a07 <strlen+0x1b>
+    if(*p == 0)
+    99fe:	80 38 00             	cmpb   $0x0,(%eax)
+    9a01:	75 f4                	jne    99f7 <strlen+0xb>
+      return p - s;
+    9a03:	29 c8                	sub    %ecx,%eax
+    9a05:	eb 25                	jmp    9a2c <strlen+0x40>
+  // Then a word at a time, which never crosses into the next page:
+  // a word with a zero byte in it has one of these bits set.
+  for(;; p += 4){
+    w = *(uint*)p;
+    9a07:	8b 10                	mov    (%eax),%edx
+    if((w - 0x01010101) & ~w & 0x80808080)
+    9a09:	8d 9a ff fe fe fe    	lea    -0x1010101(%edx),%ebx
+    9a0f:	f7 d2                	not    %edx
+    9a11:	21 da                	and    %ebx,%edx
+    9a13:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+    9a19:	75 05                	jne    9a20 <strlen+0x34>
+  for(;; p += 4){
+    9a1b:	83 c0 04             	add    $0x4,%eax
+    w = *(uint*)p;
+    9a1e:	eb e7                	jmp    9a07 <strlen+0x1b>
+      break;
+  }
+  while(*p)
+    9a20:	80 38 00             	cmpb   $0x0,(%eax)
+    9a23:	74 05                	je     9a2a <strlen+0x3e>
+    p++;
+    9a25:	83 c0 01             	add    $0x1,%eax
+    9a28:	eb f6                	jmp    9a20 <strlen+0x34>
+  return p - s;
+    9a2a:	29 c8                	sub    %ecx,%eax
+}
+    9a2c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    9a2f:	c9                   	leave
+    9a30:	c3                   	ret
+
+00009a31 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    9a31:	55                   	push   %ebp
+    9a32:	89 e5                	mov    %esp,%ebp
+    9a34:	57                   	push   %edi
+    9a35:	56                   	push   %esi
+    9a36:	53                   	push   %ebx
+    9a37:	8b 55 10             	mov    0x10(%ebp),%edx
+  uint h;
+  char *d;
+
+  d = dst;
+  c &= 0xFF;
+    9a3a:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  if(n >= 16){
+    9a3e:	83 fa 0f             	cmp    $0xf,%edx
+    9a41:	76 52                	jbe    9a95 <memset+0x64>
+    h = -(uint)d & 3;
+    9a43:	8b 45 08             	mov    0x8(%ebp),%eax
+    9a46:	f7 d8                	neg    %eax
+    9a48:	83 e0 03             	and    $0x3,%eax
+    9a4b:	89 c6                	mov    %eax,%esi
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    9a4d:	8b 7d 08             	mov    0x8(%ebp),%edi
+    9a50:	89 c1                	mov    %eax,%ecx
+    9a52:	89 d8                	mov    %ebx,%eax
+    9a54:	fc                   	cld
+    9a55:	f3 aa                	rep stos %al,%es:(%edi)
+    stosb(d, c, h);
+    stosl(d + h, (c<<24)|(c<<16)|(c<<8)|c, (n - h)/4);
+    9a57:	29 f2                	sub    %esi,%edx
+    9a59:	89 d1                	mov    %edx,%ecx
+    9a5b:	c1 e9 02             	shr    $0x2,%ecx
+    9a5e:	c1 e0 18             	shl    $0x18,%eax
+    9a61:	89 df                	mov    %ebx,%edi
+    9a63:	c1 e7 10             	shl    $0x10,%edi
+    9a66:	09 f8                	or     %edi,%eax
+    9a68:	89 df                	mov    %ebx,%edi
+    9a6a:	c1 e7 08             	shl    $0x8,%edi
+    9a6d:	09 f8                	or     %edi,%eax
+    9a6f:	09 d8                	or     %ebx,%eax
+    9a71:	89 f7                	mov    %esi,%edi
+    9a73:	03 7d 08             	add    0x8(%ebp),%edi
+}
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosl" :
+    9a76:	fc                   	cld
+    9a77:	f3 ab                	rep stos %eax,%es:(%edi)
+    d += h + (n - h)/4*4;
+    9a79:	89 d7                	mov    %edx,%edi
+    9a7b:	83 e7 fc             	and    $0xfffffffc,%edi
+    9a7e:	09 f7                	or     %esi,%edi
+    9a80:	03 7d 08             	add    0x8(%ebp),%edi
+    n = (n - h)%4;
+    9a83:	83 e2 03             	and    $0x3,%edx
+  asm volatile("cld; rep stosb" :
+    9a86:	89 d1                	mov    %edx,%ecx
+    9a88:	89 d8                	mov    %ebx,%eax
+    9a8a:	fc                   	cld
+    9a8b:	f3 aa                	rep stos %al,%es:(%edi)
+  }
+  stosb(d, c, n);
+  return dst;
+}
+    9a8d:	8b 45 08             	mov    0x8(%ebp),%eax
+    9a90:	5b                   	pop    %ebx
+    9a91:	5e                   	pop    %esi
+    9a92:	5f                   	pop    %edi
+    9a93:	5d                   	pop    %ebp
+    9a94:	c3                   	ret
+  d = dst;
+    9a95:	8b 7d 08             	mov    0x8(%ebp),%edi
+    9a98:	eb ec                	jmp    9a86 <memset+0x55>
+
+00009a9a <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    9a9a:	55                   	push   %ebp
+    9a9b:	89 e5                	mov    %esp,%ebp
+    9a9d:	8b 45 08             	mov    0x8(%ebp),%eax
+    9aa0:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    9aa4:	eb 03                	jmp    9aa9 <strchr+0xf>
+    9aa6:	83 c0 01             	add    $0x1,%eax
+    9aa9:	0f b6 10             	movzbl (%eax),%edx
+    9aac:	84 d2                	test   %dl,%dl
+    9aae:	74 06                	je     9ab6 <strchr+0x1c>
+    if(*s == c)
+    9ab0:	38 ca                	cmp    %cl,%dl
+    9ab2:	75 f2                	jne    9aa6 <strchr+0xc>
+    9ab4:	eb 05                	jmp    9abb <strchr+0x21>
+      return (char*)s;
+  return 0;
+    9ab6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    9abb:	5d                   	pop    %ebp
+    9abc:	c3                   	ret
+
+00009abd <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+    9abd:	55                   	push   %ebp
+    9abe:	89 e5                	mov    %esp,%ebp
+    9ac0:	56                   	push   %esi
+    9ac1:	53                   	push   %ebx
+    9ac2:	8b 55 08             	mov    0x8(%ebp),%edx
+    9ac5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    9ac8:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  // A word at a time while they agree.
+  if((((uint)s1 | (uint)s2) & 3) == 0)
+    9acb:	89 d3                	mov    %edx,%ebx
+    9acd:	09 cb                	or     %ecx,%ebx
+    9acf:	f6 c3 03             	test   $0x3,%bl
+    9ad2:	74 24                	je     9af8 <memcmp+0x3b>
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+      s1 += 4, s2 += 4;
+  while(n-- > 0){
+    9ad4:	8d 70 ff             	lea    -0x1(%eax),%esi
+    9ad7:	85 c0                	test   %eax,%eax
+    9ad9:	74 32                	je     9b0d <memcmp+0x50>
+    if(*s1 != *s2)
+    9adb:	0f b6 02             	movzbl (%edx),%eax
+    9ade:	0f b6 19             	movzbl (%ecx),%ebx
+    9ae1:	38 d8                	cmp    %bl,%al
+    9ae3:	75 20                	jne    9b05 <memcmp+0x48>
+      return *s1 - *s2;
+    s1++, s2++;
+    9ae5:	83 c2 01             	add    $0x1,%edx
+    9ae8:	83 c1 01             	add    $0x1,%ecx
+  while(n-- > 0){
+    9aeb:	89 f0                	mov    %esi,%eax
+    9aed:	eb e5                	jmp    9ad4 <memcmp+0x17>
+      s1 += 4, s2 += 4;
+    9aef:	83 c2 04             	add    $0x4,%edx
+    9af2:	83 c1 04             	add    $0x4,%ecx
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+    9af5:	83 e8 04             	sub    $0x4,%eax
+    9af8:	83 f8 03             	cmp    $0x3,%eax
+    9afb:	76 d7                	jbe    9ad4 <memcmp+0x17>
+    9afd:	8b 31                	mov    (%ecx),%esi
+    9aff:	39 32                	cmp    %esi,(%edx)
+    9b01:	74 ec                	je     9aef <memcmp+0x32>
+    9b03:	eb cf                	jmp    9ad4 <memcmp+0x17>
+      return *s1 - *s2;
+    9b05:	0f b6 c0             	movzbl %al,%eax
+    9b08:	0f b6 db             	movzbl %bl,%ebx
+    9b0b:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+    9b0d:	5b                   	pop    %ebx
+    9b0e:	5e                   	pop    %esi
+    9b0f:	5d                   	pop    %ebp
+    9b10:	c3                   	ret
+
+00009b11 <memchr>:
+// The first c in the n bytes at v, or 0.  Once aligned, a word at
+// a time, with the word's bytes that equal c turned into zeroes
+// and those looked for.
+void*
+memchr(const void *v, int c, uint n)
+{
+    9b11:	55                   	push   %ebp
+    9b12:	89 e5                	mov    %esp,%ebp
+    9b14:	57                   	push   %edi
+    9b15:	56                   	push   %esi
+    9b16:	53                   	push   %ebx
+    9b17:	8b 45 08             	mov    0x8(%ebp),%eax
+    9b1a:	8b 55 10             	mov    0x10(%ebp),%edx
+  const uchar *s;
+  uint w, rep;
+
+  s = v;
+  c = (uchar)c;
+    9b1d:	0f b6 75 0c          	movzbl 0xc(%ebp),%esi
+  for(; n > 0 && ((uint)s & 3); n--, s++)
+    9b21:	eb 06                	jmp    9b29 <memchr+0x18>
+    9b23:	83 ea 01             	sub    $0x1,%edx
+    9b26:	83 c0 01             	add    $0x1,%eax
+    9b29:	85 d2                	test   %edx,%edx
+    9b2b:	74 0d                	je     9b3a <memchr+0x29>
+    9b2d:	a8 03                	test   $0x3,%al
+    9b2f:	74 09                	je     9b3a <memchr+0x29>
+    if(*s == c)
+    9b31:	0f b6 08             	movzbl (%eax),%ecx
+    9b34:	39 f1                	cmp    %esi,%ecx
+    9b36:	75 eb                	jne    9b23 <memchr+0x12>
+    9b38:	eb 41                	jmp    9b7b <memchr+0x6a>
+      return (void*)s;
+  rep = c * 0x01010101;
+    9b3a:	69 fe 01 01 01 01    	imul   $0x1010101,%esi,%edi
+  for(; n >= 4; n -= 4, s += 4){
+    9b40:	eb 06                	jmp    9b48 <memchr+0x37>
+    9b42:	83 ea 04             	sub    $0x4,%edx
+    9b45:	83 c0 04             	add    $0x4,%eax
+    9b48:	83 fa 03             	cmp    $0x3,%edx
+    9b4b:	76 16                	jbe    9b63 <memchr+0x52>
+    w = *(uint*)s ^ rep;
+    9b4d:	89 f9                	mov    %edi,%ecx
+    9b4f:	33 08                	xor    (%eax),%ecx
+    if((w - 0x01010101) & ~w & 0x80808080)
+    9b51:	8d 99 ff fe fe fe    	lea    -0x1010101(%ecx),%ebx
+    9b57:	f7 d1                	not    %ecx
+    9b59:	21 cb                	and    %ecx,%ebx
+    9b5b:	f7 c3 80 80 80 80    	test   $0x80808080,%ebx
+    9b61:	74 df                	je     9b42 <memchr+0x31>
+      break;
+  }
+  for(; n > 0; n--, s++)
+    9b63:	85 d2                	test   %edx,%edx
+    9b65:	74 0f                	je     9b76 <memchr+0x65>
+    if(*s == c)
+    9b67:	0f b6 08             	movzbl (%eax),%ecx
+    9b6a:	39 f1                	cmp    %esi,%ecx
+    9b6c:	74 0d                	je     9b7b <memchr+0x6a>
+  for(; n > 0; n--, s++)
+    9b6e:	83 ea 01             	sub    $0x1,%edx
+    9b71:	83 c0 01             	add    $0x1,%eax
+    9b74:	eb ed                	jmp    9b63 <memchr+0x52>
+      return (void*)s;
+  return 0;
+    9b76:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    9b7b:	5b                   	pop    %ebx
+    9b7c:	5e                   	pop    %esi
+    9b7d:	5f                   	pop    %edi
+    9b7e:	5d                   	pop    %ebp
+    9b7f:	c3                   	ret
+
+00009b80 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    9b80:	55                   	push   %ebp
+    9b81:	89 e5                	mov    %esp,%ebp
+    9b83:	57                   	push   %edi
+    9b84:	56                   	push   %esi
+    9b85:	53                   	push   %ebx
+    9b86:	83 ec 1c             	sub    $0x1c,%esp
+    9b89:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    9b8c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    9b91:	89 de                	mov    %ebx,%esi
+    9b93:	83 c3 01             	add    $0x1,%ebx
+    9b96:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    9b99:	7d 2e                	jge    9bc9 <gets+0x49>
+    cc = read(0, &c, 1);
+    9b9b:	83 ec 04             	sub    $0x4,%esp
+    9b9e:	6a 01                	push   $0x1
+    9ba0:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    9ba3:	50                   	push   %eax
+    9ba4:	6a 00                	push   $0x0
+    9ba6:	e8 51 05 00 00       	call   a0fc <read>
+    if(cc < 1)
+    9bab:	83 c4 10             	add    $0x10,%esp
+    9bae:	85 c0                	test   %eax,%eax
+    9bb0:	7e 17                	jle    9bc9 <gets+0x49>
+      break;
+    buf[i++] = c;
+    9bb2:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    9bb6:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+    9bb9:	3c 0a                	cmp    $0xa,%al
+    9bbb:	0f 94 c2             	sete   %dl
+    9bbe:	3c 0d                	cmp    $0xd,%al
+    9bc0:	0f 94 c0             	sete   %al
+    9bc3:	08 c2                	or     %al,%dl
+    9bc5:	74 ca                	je     9b91 <gets+0x11>
+    buf[i++] = c;
+    9bc7:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+    9bc9:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+    9bcd:	89 f8                	mov    %edi,%eax
+    9bcf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    9bd2:	5b                   	pop    %ebx
+    9bd3:	5e                   	pop    %esi
+    9bd4:	5f                   	pop    %edi
+    9bd5:	5d                   	pop    %ebp
+    9bd6:	c3                   	ret
+
+00009bd7 <atoi>:
+  return r;
+}
+
+int
+atoi(const char *s)
+{
+    9bd7:	55                   	push   %ebp
+    9bd8:	89 e5                	mov    %esp,%ebp
+    9bda:	53                   	push   %ebx
+    9bdb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+    9bde:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+    9be3:	eb 10                	jmp    9bf5 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+    9be5:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+    9be8:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+    9beb:	83 c1 01             	add    $0x1,%ecx
+    9bee:	0f be c0             	movsbl %al,%eax
+    9bf1:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+    9bf5:	0f b6 01             	movzbl (%ecx),%eax
+    9bf8:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    9bfb:	80 fb 09             	cmp    $0x9,%bl
+    9bfe:	76 e5                	jbe    9be5 <atoi+0xe>
+  return n;
+}
+    9c00:	89 d0                	mov    %edx,%eax
+    9c02:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    9c05:	c9                   	leave
+    9c06:	c3                   	ret
+
+00009c07 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    9c07:	55                   	push   %ebp
+    9c08:	89 e5                	mov    %esp,%ebp
+    9c0a:	57                   	push   %edi
+    9c0b:	56                   	push   %esi
+    9c0c:	53                   	push   %ebx
+    9c0d:	83 ec 08             	sub    $0x8,%esp
+    9c10:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    9c13:	8b 55 0c             	mov    0xc(%ebp),%edx
+    9c16:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *src;
+  int h;
+
+  dst = vdst;
+  src = vsrc;
+  if(n <= 0)
+    9c19:	85 c0                	test   %eax,%eax
+    9c1b:	0f 8e 82 00 00 00    	jle    9ca3 <memmove+0x9c>
+    return vdst;
+  if(src < dst && src + n > dst){
+    9c21:	39 da                	cmp    %ebx,%edx
+    9c23:	73 07                	jae    9c2c <memmove+0x25>
+    9c25:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+    9c28:	39 cb                	cmp    %ecx,%ebx
+    9c2a:	72 5e                	jb     9c8a <memmove+0x83>
+    movsbback(dst + n - 1, src + n - 1, n);
+    return vdst;
+  }
+  if(n >= 16 && (((uint)dst ^ (uint)src) & 3) == 0){
+    9c2c:	83 f8 0f             	cmp    $0xf,%eax
+    9c2f:	7e 69                	jle    9c9a <memmove+0x93>
+    9c31:	89 d9                	mov    %ebx,%ecx
+    9c33:	31 d1                	xor    %edx,%ecx
+    9c35:	f6 c1 03             	test   $0x3,%cl
+    9c38:	75 73                	jne    9cad <memmove+0xa6>
+    h = -(uint)dst & 3;
+    9c3a:	89 d9                	mov    %ebx,%ecx
+    9c3c:	f7 d9                	neg    %ecx
+    9c3e:	83 e1 03             	and    $0x3,%ecx
+}
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsb" :
+    9c41:	89 df                	mov    %ebx,%edi
+    9c43:	89 d6                	mov    %edx,%esi
+    9c45:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+    9c48:	fc                   	cld
+    9c49:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    movsb(dst, src, h);
+    dst += h, src += h, n -= h;
+    9c4b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+    9c4e:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+    9c51:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+    9c54:	29 f0                	sub    %esi,%eax
+    movsl(dst, src, n/4);
+    9c56:	8d 50 03             	lea    0x3(%eax),%edx
+    9c59:	0f 49 d0             	cmovns %eax,%edx
+    9c5c:	c1 fa 02             	sar    $0x2,%edx
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+    9c5f:	89 7d f0             	mov    %edi,-0x10(%ebp)
+    9c62:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+    9c65:	89 ce                	mov    %ecx,%esi
+    9c67:	89 d1                	mov    %edx,%ecx
+    9c69:	fc                   	cld
+    9c6a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    dst += n/4*4, src += n/4*4, n %= 4;
+    9c6c:	c1 e2 02             	shl    $0x2,%edx
+    9c6f:	8b 7d f0             	mov    -0x10(%ebp),%edi
+    9c72:	01 d7                	add    %edx,%edi
+    9c74:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+    9c77:	01 ca                	add    %ecx,%edx
+    9c79:	89 c6                	mov    %eax,%esi
+    9c7b:	c1 fe 1f             	sar    $0x1f,%esi
+    9c7e:	c1 ee 1e             	shr    $0x1e,%esi
+    9c81:	01 f0                	add    %esi,%eax
+    9c83:	83 e0 03             	and    $0x3,%eax
+    9c86:	29 f0                	sub    %esi,%eax
+    9c88:	eb 12                	jmp    9c9c <memmove+0x95>
+    movsbback(dst + n - 1, src + n - 1, n);
+    9c8a:	8d 78 ff             	lea    -0x1(%eax),%edi
+    9c8d:	8d 34 3a             	lea    (%edx,%edi,1),%esi
+    9c90:	01 df                	add    %ebx,%edi
+// Copy cnt bytes down from the last ones, at dst and src, to the
+// first: for overlapping moves up.
+static inline void
+movsbback(void *dst, const void *src, int cnt)
+{
+  asm volatile("std; rep movsb; cld" :
+    9c92:	89 c1                	mov    %eax,%ecx
+    9c94:	fd                   	std
+    9c95:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    9c97:	fc                   	cld
+    return vdst;
+    9c98:	eb 09                	jmp    9ca3 <memmove+0x9c>
+  dst = vdst;
+    9c9a:	89 df                	mov    %ebx,%edi
+  asm volatile("cld; rep movsb" :
+    9c9c:	89 d6                	mov    %edx,%esi
+    9c9e:	89 c1                	mov    %eax,%ecx
+    9ca0:	fc                   	cld
+    9ca1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  }
+  movsb(dst, src, n);
+  return vdst;
+}
+    9ca3:	89 d8                	mov    %ebx,%eax
+    9ca5:	83 c4 08             	add    $0x8,%esp
+    9ca8:	5b                   	pop    %ebx
+    9ca9:	5e                   	pop    %esi
+    9caa:	5f                   	pop    %edi
+    9cab:	5d                   	pop    %ebp
+    9cac:	c3                   	ret
+  dst = vdst;
+    9cad:	89 df                	mov    %ebx,%edi
+    9caf:	eb eb                	jmp    9c9c <memmove+0x95>
+
+00009cb1 <vclock_gettime>:
+
+// clock_gettime() without a system call: read the clock page
+// that the kernel maps at CLOCKPAGE (see clock.h).
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+    9cb1:	55                   	push   %ebp
+    9cb2:	89 e5                	mov    %esp,%ebp
+    9cb4:	57                   	push   %edi
+    9cb5:	56                   	push   %esi
+    9cb6:	53                   	push   %ebx
+    9cb7:	83 ec 14             	sub    $0x14,%esp
+  struct clockpage *cp = (struct clockpage*)CLOCKPAGE;
+  uint seq, rem, d;
+  uint64 tsc, ns, now;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+    9cba:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+    9cbe:	0f 87 a3 00 00 00    	ja     9d67 <vclock_gettime+0xb6>
+    return -1;
+  do {
+    seq = cp->seq;
+    9cc4:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+    __sync_synchronize();
+    9cc9:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    tsc = cp->tsc;
+    9cce:	8b 15 10 f0 ff 7f    	mov    0x7ffff010,%edx
+    9cd4:	8b 1d 14 f0 ff 7f    	mov    0x7ffff014,%ebx
+    ns = cp->ns;
+    9cda:	8b 35 18 f0 ff 7f    	mov    0x7ffff018,%esi
+    9ce0:	8b 3d 1c f0 ff 7f    	mov    0x7ffff01c,%edi
+    __sync_synchronize();
+    9ce6:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != cp->seq);
+    9ceb:	89 c1                	mov    %eax,%ecx
+    9ced:	83 e1 01             	and    $0x1,%ecx
+    9cf0:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+    9cf3:	75 cf                	jne    9cc4 <vclock_gettime+0x13>
+    9cf5:	8b 0d 00 f0 ff 7f    	mov    0x7ffff000,%ecx
+    9cfb:	39 c1                	cmp    %eax,%ecx
+    9cfd:	75 c5                	jne    9cc4 <vclock_gettime+0x13>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+    9cff:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+    9d02:	89 55 ec             	mov    %edx,-0x14(%ebp)
+    9d05:	0f 31                	rdtsc
+    9d07:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    9d0a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+    9d0d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  now = rdtsc();
+  // Less than a tick has passed since the update, so the delta
+  // fits in 32 bits.
+  d = now > tsc ? now - tsc : 0;
+    9d10:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    9d13:	19 d3                	sbb    %edx,%ebx
+    9d15:	73 07                	jae    9d1e <vclock_gettime+0x6d>
+    9d17:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+    9d1a:	29 d8                	sub    %ebx,%eax
+    9d1c:	89 c1                	mov    %eax,%ecx
+  ns += ((uint64)d * cp->mult) >> cp->shift;
+    9d1e:	89 c8                	mov    %ecx,%eax
+    9d20:	f7 25 04 f0 ff 7f    	mull   0x7ffff004
+    9d26:	0f b6 0d 08 f0 ff 7f 	movzbl 0x7ffff008,%ecx
+    9d2d:	0f ad d0             	shrd   %cl,%edx,%eax
+    9d30:	d3 ea                	shr    %cl,%edx
+    9d32:	f6 c1 20             	test   $0x20,%cl
+    9d35:	74 04                	je     9d3b <vclock_gettime+0x8a>
+    9d37:	89 d0                	mov    %edx,%eax
+    9d39:	31 d2                	xor    %edx,%edx
+    9d3b:	01 f0                	add    %esi,%eax
+    9d3d:	11 fa                	adc    %edi,%edx
+static inline uint
+divl(uint64 n, uint d, uint *r)
+{
+  uint q;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (*r) :
+    9d3f:	bb 00 ca 9a 3b       	mov    $0x3b9aca00,%ebx
+    9d44:	f7 f3                	div    %ebx
+  ts->tv_sec = divl(ns, 1000000000, &rem);
+    9d46:	8b 7d 0c             	mov    0xc(%ebp),%edi
+    9d49:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = rem;
+    9d4b:	89 57 04             	mov    %edx,0x4(%edi)
+  if(clk == CLOCK_REALTIME)
+    9d4e:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    9d52:	75 1a                	jne    9d6e <vclock_gettime+0xbd>
+    ts->tv_sec += cp->boottime;
+    9d54:	03 05 0c f0 ff 7f    	add    0x7ffff00c,%eax
+    9d5a:	89 07                	mov    %eax,(%edi)
+  return 0;
+    9d5c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    9d5f:	83 c4 14             	add    $0x14,%esp
+    9d62:	5b                   	pop    %ebx
+    9d63:	5e                   	pop    %esi
+    9d64:	5f                   	pop    %edi
+    9d65:	5d                   	pop    %ebp
+    9d66:	c3                   	ret
+    return -1;
+    9d67:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    9d6c:	eb f1                	jmp    9d5f <vclock_gettime+0xae>
+  return 0;
+    9d6e:	b8 00 00 00 00       	mov    $0x0,%eax
+    9d73:	eb ea                	jmp    9d5f <vclock_gettime+0xae>
+
+00009d75 <flush>:
+
+// Write out fd's buffer, or with fd < 0 every buffer.
+// Returns -1 if a write fails.
+int
+flush(int fd)
+{
+    9d75:	55                   	push   %ebp
+    9d76:	89 e5                	mov    %esp,%ebp
+    9d78:	56                   	push   %esi
+    9d79:	53                   	push   %ebx
+    9d7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  int r, n;
+
+  if(fd < 0){
+    9d7d:	85 c0                	test   %eax,%eax
+    9d7f:	78 5d                	js     9dde <flush+0x69>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+      if(flush(fd) < 0)
+        r = -1;
+    return r;
+  }
+  if(fd >= NOBUF || (n = obuf[fd].n) == 0)
+    9d81:	83 f8 0f             	cmp    $0xf,%eax
+    9d84:	7f 64                	jg     9dea <flush+0x75>
+    9d86:	69 d0 08 02 00 00    	imul   $0x208,%eax,%edx
+    9d8c:	8b b2 04 ae 01 00    	mov    0x1ae04(%edx),%esi
+    9d92:	85 f6                	test   %esi,%esi
+    9d94:	74 59                	je     9def <flush+0x7a>
+    return 0;
+  obuf[fd].n = 0;
+    9d96:	c7 82 04 ae 01 00 00 	movl   $0x0,0x1ae04(%edx)
+    9d9d:	00 00 00 
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+    9da0:	81 c2 08 ae 01 00    	add    $0x1ae08,%edx
+    9da6:	83 ec 04             	sub    $0x4,%esp
+    9da9:	56                   	push   %esi
+    9daa:	52                   	push   %edx
+    9dab:	50                   	push   %eax
+    9dac:	e8 5a 03 00 00       	call   a10b <write>
+    9db1:	83 c4 10             	add    $0x10,%esp
+    9db4:	39 f0                	cmp    %esi,%eax
+    9db6:	75 40                	jne    9df8 <flush+0x83>
+    9db8:	be 00 00 00 00       	mov    $0x0,%esi
+    9dbd:	eb 30                	jmp    9def <flush+0x7a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+    9dbf:	83 c3 01             	add    $0x1,%ebx
+    9dc2:	83 fb 0f             	cmp    $0xf,%ebx
+    9dc5:	7f 28                	jg     9def <flush+0x7a>
+      if(flush(fd) < 0)
+    9dc7:	83 ec 0c             	sub    $0xc,%esp
+    9dca:	53                   	push   %ebx
+    9dcb:	e8 a5 ff ff ff       	call   9d75 <flush>
+    9dd0:	83 c4 10             	add    $0x10,%esp
+    9dd3:	85 c0                	test   %eax,%eax
+    9dd5:	79 e8                	jns    9dbf <flush+0x4a>
+        r = -1;
+    9dd7:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    9ddc:	eb e1                	jmp    9dbf <flush+0x4a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+    9dde:	be 00 00 00 00       	mov    $0x0,%esi
+    9de3:	bb 00 00 00 00       	mov    $0x0,%ebx
+    9de8:	eb d8                	jmp    9dc2 <flush+0x4d>
+    return 0;
+    9dea:	be 00 00 00 00       	mov    $0x0,%esi
+}
+    9def:	89 f0                	mov    %esi,%eax
+    9df1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    9df4:	5b                   	pop    %ebx
+    9df5:	5e                   	pop    %esi
+    9df6:	5d                   	pop    %ebp
+    9df7:	c3                   	ret
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+    9df8:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    9dfd:	eb f0                	jmp    9def <flush+0x7a>
+
+00009dff <bufreset>:
+
+static void
+bufreset(int fd)
+{
+  if(fd >= 0 && fd < NOBUF){
+    9dff:	83 f8 0f             	cmp    $0xf,%eax
+    9e02:	76 01                	jbe    9e05 <bufreset+0x6>
+    9e04:	c3                   	ret
+{
+    9e05:	55                   	push   %ebp
+    9e06:	89 e5                	mov    %esp,%ebp
+    9e08:	53                   	push   %ebx
+    9e09:	83 ec 10             	sub    $0x10,%esp
+    9e0c:	89 c3                	mov    %eax,%ebx
+    flush(fd);
+    9e0e:	50                   	push   %eax
+    9e0f:	e8 61 ff ff ff       	call   9d75 <flush>
+    obuf[fd].mode = BUNKNOWN;
+    9e14:	69 db 08 02 00 00    	imul   $0x208,%ebx,%ebx
+    9e1a:	c7 83 00 ae 01 00 00 	movl   $0x0,0x1ae00(%ebx)
+    9e21:	00 00 00 
+    9e24:	83 c4 10             	add    $0x10,%esp
+  }
+}
+    9e27:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    9e2a:	c9                   	leave
+    9e2b:	c3                   	ret
+
+00009e2c <bufwrite>:
+
+// Write n bytes from p to fd, through its buffer.
+// Returns n, or -1 if a write fails.
+int
+bufwrite(int fd, const void *p, int n)
+{
+    9e2c:	55                   	push   %ebp
+    9e2d:	89 e5                	mov    %esp,%ebp
+    9e2f:	57                   	push   %edi
+    9e30:	56                   	push   %esi
+    9e31:	53                   	push   %ebx
+    9e32:	83 ec 3c             	sub    $0x3c,%esp
+    9e35:	8b 75 08             	mov    0x8(%ebp),%esi
+    9e38:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct stat st;
+  const char *s;
+  int i;
+
+  if(fd < 0 || fd >= NOBUF)
+    9e3b:	83 fe 0f             	cmp    $0xf,%esi
+    9e3e:	0f 87 a2 00 00 00    	ja     9ee6 <bufwrite+0xba>
+    return write(fd, p, n);
+  if(obuf[fd].mode == BUNKNOWN){
+    9e44:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+    9e4a:	83 b8 00 ae 01 00 00 	cmpl   $0x0,0x1ae00(%eax)
+    9e51:	75 19                	jne    9e6c <bufwrite+0x40>
+    if(fd == 2 || fstat(fd, &st) < 0)
+    9e53:	83 fe 02             	cmp    $0x2,%esi
+    9e56:	0f 85 9c 00 00 00    	jne    9ef8 <bufwrite+0xcc>
+      obuf[fd].mode = BNONE;
+    9e5c:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+    9e62:	c7 80 00 ae 01 00 01 	movl   $0x1,0x1ae00(%eax)
+    9e69:	00 00 00 
+    else
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+  }
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+    9e6c:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+    9e72:	89 da                	mov    %ebx,%edx
+    9e74:	03 90 04 ae 01 00    	add    0x1ae04(%eax),%edx
+    9e7a:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+    9e80:	0f 8f ae 00 00 00    	jg     9f34 <bufwrite+0x108>
+    return -1;
+  if(n >= OBUFSZ)
+    9e86:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+    9e8c:	0f 8f bd 00 00 00    	jg     9f4f <bufwrite+0x123>
+    return write(fd, p, n);
+  memmove(obuf[fd].buf + obuf[fd].n, p, n);
+    9e92:	69 d6 08 02 00 00    	imul   $0x208,%esi,%edx
+    9e98:	8d ba 00 ae 01 00    	lea    0x1ae00(%edx),%edi
+    9e9e:	8b 82 04 ae 01 00    	mov    0x1ae04(%edx),%eax
+    9ea4:	83 ec 04             	sub    $0x4,%esp
+    9ea7:	53                   	push   %ebx
+    9ea8:	ff 75 0c             	push   0xc(%ebp)
+    9eab:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+    9eae:	8d 84 10 08 ae 01 00 	lea    0x1ae08(%eax,%edx,1),%eax
+    9eb5:	50                   	push   %eax
+    9eb6:	e8 4c fd ff ff       	call   9c07 <memmove>
+  obuf[fd].n += n;
+    9ebb:	01 5f 04             	add    %ebx,0x4(%edi)
+  if(obuf[fd].mode == BNONE)
+    9ebe:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+    9ec1:	8b 82 00 ae 01 00    	mov    0x1ae00(%edx),%eax
+    9ec7:	83 c4 10             	add    $0x10,%esp
+    9eca:	83 f8 01             	cmp    $0x1,%eax
+    9ecd:	0f 84 91 00 00 00    	je     9f64 <bufwrite+0x138>
+    return flush(fd) < 0 ? -1 : n;
+  if(obuf[fd].mode == BLINE)
+    9ed3:	83 f8 02             	cmp    $0x2,%eax
+    9ed6:	0f 84 ca 00 00 00    	je     9fa6 <bufwrite+0x17a>
+    for(s = p, i = 0; i < n; i++)
+      if(s[i] == '\n')
+        return flush(fd) < 0 ? -1 : n;
+  return n;
+    9edc:	89 d8                	mov    %ebx,%eax
+}
+    9ede:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    9ee1:	5b                   	pop    %ebx
+    9ee2:	5e                   	pop    %esi
+    9ee3:	5f                   	pop    %edi
+    9ee4:	5d                   	pop    %ebp
+    9ee5:	c3                   	ret
+    return write(fd, p, n);
+    9ee6:	83 ec 04             	sub    $0x4,%esp
+    9ee9:	53                   	push   %ebx
+    9eea:	ff 75 0c             	push   0xc(%ebp)
+    9eed:	56                   	push   %esi
+    9eee:	e8 18 02 00 00       	call   a10b <write>
+    9ef3:	83 c4 10             	add    $0x10,%esp
+    9ef6:	eb e6                	jmp    9ede <bufwrite+0xb2>
+    if(fd == 2 || fstat(fd, &st) < 0)
+    9ef8:	83 ec 08             	sub    $0x8,%esp
+    9efb:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+    9efe:	50                   	push   %eax
+    9eff:	56                   	push   %esi
+    9f00:	e8 51 02 00 00       	call   a156 <fstat>
+    9f05:	83 c4 10             	add    $0x10,%esp
+    9f08:	85 c0                	test   %eax,%eax
+    9f0a:	0f 88 4c ff ff ff    	js     9e5c <bufwrite+0x30>
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+    9f10:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+    9f15:	74 16                	je     9f2d <bufwrite+0x101>
+    9f17:	ba 03 00 00 00       	mov    $0x3,%edx
+    9f1c:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+    9f22:	89 90 00 ae 01 00    	mov    %edx,0x1ae00(%eax)
+    9f28:	e9 3f ff ff ff       	jmp    9e6c <bufwrite+0x40>
+    9f2d:	ba 02 00 00 00       	mov    $0x2,%edx
+    9f32:	eb e8                	jmp    9f1c <bufwrite+0xf0>
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+    9f34:	83 ec 0c             	sub    $0xc,%esp
+    9f37:	56                   	push   %esi
+    9f38:	e8 38 fe ff ff       	call   9d75 <flush>
+    9f3d:	83 c4 10             	add    $0x10,%esp
+    9f40:	85 c0                	test   %eax,%eax
+    9f42:	0f 89 3e ff ff ff    	jns    9e86 <bufwrite+0x5a>
+    return -1;
+    9f48:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    9f4d:	eb 8f                	jmp    9ede <bufwrite+0xb2>
+    return write(fd, p, n);
+    9f4f:	83 ec 04             	sub    $0x4,%esp
+    9f52:	53                   	push   %ebx
+    9f53:	ff 75 0c             	push   0xc(%ebp)
+    9f56:	56                   	push   %esi
+    9f57:	e8 af 01 00 00       	call   a10b <write>
+    9f5c:	83 c4 10             	add    $0x10,%esp
+    9f5f:	e9 7a ff ff ff       	jmp    9ede <bufwrite+0xb2>
+    return flush(fd) < 0 ? -1 : n;
+    9f64:	83 ec 0c             	sub    $0xc,%esp
+    9f67:	56                   	push   %esi
+    9f68:	e8 08 fe ff ff       	call   9d75 <flush>
+    9f6d:	83 c4 10             	add    $0x10,%esp
+    9f70:	85 c0                	test   %eax,%eax
+    9f72:	78 07                	js     9f7b <bufwrite+0x14f>
+    9f74:	89 d8                	mov    %ebx,%eax
+    9f76:	e9 63 ff ff ff       	jmp    9ede <bufwrite+0xb2>
+    9f7b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    9f80:	e9 59 ff ff ff       	jmp    9ede <bufwrite+0xb2>
+        return flush(fd) < 0 ? -1 : n;
+    9f85:	83 ec 0c             	sub    $0xc,%esp
+    9f88:	56                   	push   %esi
+    9f89:	e8 e7 fd ff ff       	call   9d75 <flush>
+    9f8e:	83 c4 10             	add    $0x10,%esp
+    9f91:	85 c0                	test   %eax,%eax
+    9f93:	78 07                	js     9f9c <bufwrite+0x170>
+    9f95:	89 d8                	mov    %ebx,%eax
+    9f97:	e9 42 ff ff ff       	jmp    9ede <bufwrite+0xb2>
+    9f9c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    9fa1:	e9 38 ff ff ff       	jmp    9ede <bufwrite+0xb2>
+    for(s = p, i = 0; i < n; i++)
+    9fa6:	b8 00 00 00 00       	mov    $0x0,%eax
+    9fab:	39 d8                	cmp    %ebx,%eax
+    9fad:	7d 0e                	jge    9fbd <bufwrite+0x191>
+      if(s[i] == '\n')
+    9faf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    9fb2:	80 3c 01 0a          	cmpb   $0xa,(%ecx,%eax,1)
+    9fb6:	74 cd                	je     9f85 <bufwrite+0x159>
+    for(s = p, i = 0; i < n; i++)
+    9fb8:	83 c0 01             	add    $0x1,%eax
+    9fbb:	eb ee                	jmp    9fab <bufwrite+0x17f>
+  return n;
+    9fbd:	89 d8                	mov    %ebx,%eax
+    9fbf:	e9 1a ff ff ff       	jmp    9ede <bufwrite+0xb2>
+
+00009fc4 <fork>:
+
+int
+fork(void)
+{
+    9fc4:	55                   	push   %ebp
+    9fc5:	89 e5                	mov    %esp,%ebp
+    9fc7:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+    9fca:	6a ff                	push   $0xffffffff
+    9fcc:	e8 a4 fd ff ff       	call   9d75 <flush>
+  return _fork();
+    9fd1:	e8 bd 00 00 00       	call   a093 <_fork>
+}
+    9fd6:	c9                   	leave
+    9fd7:	c3                   	ret
+
+00009fd8 <exit>:
+
+int
+exit(void)
+{
+    9fd8:	55                   	push   %ebp
+    9fd9:	89 e5                	mov    %esp,%ebp
+    9fdb:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+    9fde:	6a ff                	push   $0xffffffff
+    9fe0:	e8 90 fd ff ff       	call   9d75 <flush>
+  _exit();
+    9fe5:	e8 b8 00 00 00       	call   a0a2 <_exit>
+
+00009fea <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+    9fea:	55                   	push   %ebp
+    9feb:	89 e5                	mov    %esp,%ebp
+    9fed:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+    9ff0:	6a ff                	push   $0xffffffff
+    9ff2:	e8 7e fd ff ff       	call   9d75 <flush>
+  return _exec(path, argv);
+    9ff7:	83 c4 08             	add    $0x8,%esp
+    9ffa:	ff 75 0c             	push   0xc(%ebp)
+    9ffd:	ff 75 08             	push   0x8(%ebp)
+    a000:	e8 bb 00 00 00       	call   a0c0 <_exec>
+}
+    a005:	c9                   	leave
+    a006:	c3                   	ret
+
+0000a007 <close>:
+
+int
+close(int fd)
+{
+    a007:	55                   	push   %ebp
+    a008:	89 e5                	mov    %esp,%ebp
+    a00a:	53                   	push   %ebx
+    a00b:	83 ec 04             	sub    $0x4,%esp
+    a00e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bufreset(fd);
+    a011:	89 d8                	mov    %ebx,%eax
+    a013:	e8 e7 fd ff ff       	call   9dff <bufreset>
+  return _close(fd);
+    a018:	83 ec 0c             	sub    $0xc,%esp
+    a01b:	53                   	push   %ebx
+    a01c:	e8 90 00 00 00       	call   a0b1 <_close>
+}
+    a021:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    a024:	c9                   	leave
+    a025:	c3                   	ret
+
+0000a026 <stat>:
+{
+    a026:	55                   	push   %ebp
+    a027:	89 e5                	mov    %esp,%ebp
+    a029:	56                   	push   %esi
+    a02a:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+    a02b:	83 ec 08             	sub    $0x8,%esp
+    a02e:	6a 00                	push   $0x0
+    a030:	ff 75 08             	push   0x8(%ebp)
+    a033:	e8 f1 00 00 00       	call   a129 <open>
+  if(fd < 0)
+    a038:	83 c4 10             	add    $0x10,%esp
+    a03b:	85 c0                	test   %eax,%eax
+    a03d:	78 24                	js     a063 <stat+0x3d>
+    a03f:	89 c3                	mov    %eax,%ebx
+  r = fstat(fd, st);
+    a041:	83 ec 08             	sub    $0x8,%esp
+    a044:	ff 75 0c             	push   0xc(%ebp)
+    a047:	50                   	push   %eax
+    a048:	e8 09 01 00 00       	call   a156 <fstat>
+    a04d:	89 c6                	mov    %eax,%esi
+  close(fd);
+    a04f:	89 1c 24             	mov    %ebx,(%esp)
+    a052:	e8 b0 ff ff ff       	call   a007 <close>
+  return r;
+    a057:	83 c4 10             	add    $0x10,%esp
+}
+    a05a:	89 f0                	mov    %esi,%eax
+    a05c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    a05f:	5b                   	pop    %ebx
+    a060:	5e                   	pop    %esi
+    a061:	5d                   	pop    %ebp
+    a062:	c3                   	ret
+    return -1;
+    a063:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    a068:	eb f0                	jmp    a05a <stat+0x34>
+
+0000a06a <dup2>:
+
+int
+dup2(int oldfd, int newfd)
+{
+    a06a:	55                   	push   %ebp
+    a06b:	89 e5                	mov    %esp,%ebp
+    a06d:	56                   	push   %esi
+    a06e:	53                   	push   %ebx
+    a06f:	8b 75 08             	mov    0x8(%ebp),%esi
+    a072:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(oldfd != newfd)
+    a075:	39 de                	cmp    %ebx,%esi
+    a077:	75 11                	jne    a08a <dup2+0x20>
+    bufreset(newfd);
+  return _dup2(oldfd, newfd);
+    a079:	83 ec 08             	sub    $0x8,%esp
+    a07c:	53                   	push   %ebx
+    a07d:	56                   	push   %esi
+    a07e:	e8 4c 00 00 00       	call   a0cf <_dup2>
+}
+    a083:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    a086:	5b                   	pop    %ebx
+    a087:	5e                   	pop    %esi
+    a088:	5d                   	pop    %ebp
+    a089:	c3                   	ret
+    bufreset(newfd);
+    a08a:	89 d8                	mov    %ebx,%eax
+    a08c:	e8 6e fd ff ff       	call   9dff <bufreset>
+    a091:	eb e6                	jmp    a079 <dup2+0xf>
+
+0000a093 <_fork>:
+  1: ret
+
+#define SYSCALL(name) STUB(name, SYS_ ## name)
+
+# ulib.c wraps these, to flush printf()'s buffers first.
+STUB(_fork, SYS_fork)
+    a093:	b8 01 00 00 00       	mov    $0x1,%eax
+    a098:	89 e1                	mov    %esp,%ecx
+    a09a:	ba a1 a0 00 00       	mov    $0xa0a1,%edx
+    a09f:	0f 34                	sysenter
+    a0a1:	c3                   	ret
+
+0000a0a2 <_exit>:
+STUB(_exit, SYS_exit)
+    a0a2:	b8 02 00 00 00       	mov    $0x2,%eax
+    a0a7:	89 e1                	mov    %esp,%ecx
+    a0a9:	ba b0 a0 00 00       	mov    $0xa0b0,%edx
+    a0ae:	0f 34                	sysenter
+    a0b0:	c3                   	ret
+
+0000a0b1 <_close>:
+STUB(_close, SYS_close)
+    a0b1:	b8 15 00 00 00       	mov    $0x15,%eax
+    a0b6:	89 e1                	mov    %esp,%ecx
+    a0b8:	ba bf a0 00 00       	mov    $0xa0bf,%edx
+    a0bd:	0f 34                	sysenter
+    a0bf:	c3                   	ret
+
+0000a0c0 <_exec>:
+STUB(_exec, SYS_exec)
+    a0c0:	b8 07 00 00 00       	mov    $0x7,%eax
+    a0c5:	89 e1                	mov    %esp,%ecx
+    a0c7:	ba ce a0 00 00       	mov    $0xa0ce,%edx
+    a0cc:	0f 34                	sysenter
+    a0ce:	c3                   	ret
+
+0000a0cf <_dup2>:
+STUB(_dup2, SYS_dup2)
+    a0cf:	b8 17 00 00 00       	mov    $0x17,%eax
+    a0d4:	89 e1                	mov    %esp,%ecx
+    a0d6:	ba dd a0 00 00       	mov    $0xa0dd,%edx
+    a0db:	0f 34                	sysenter
+    a0dd:	c3                   	ret
+
+0000a0de <wait>:
+
+SYSCALL(wait)
+    a0de:	b8 03 00 00 00       	mov    $0x3,%eax
+    a0e3:	89 e1                	mov    %esp,%ecx
+    a0e5:	ba ec a0 00 00       	mov    $0xa0ec,%edx
+    a0ea:	0f 34                	sysenter
+    a0ec:	c3                   	ret
+
+0000a0ed <pipe>:
+SYSCALL(pipe)
+    a0ed:	b8 04 00 00 00       	mov    $0x4,%eax
+    a0f2:	89 e1                	mov    %esp,%ecx
+    a0f4:	ba fb a0 00 00       	mov    $0xa0fb,%edx
+    a0f9:	0f 34                	sysenter
+    a0fb:	c3                   	ret
+
+0000a0fc <read>:
+SYSCALL(read)
+    a0fc:	b8 05 00 00 00       	mov    $0x5,%eax
+    a101:	89 e1                	mov    %esp,%ecx
+    a103:	ba 0a a1 00 00       	mov    $0xa10a,%edx
+    a108:	0f 34                	sysenter
+    a10a:	c3                   	ret
+
+0000a10b <write>:
+SYSCALL(write)
+    a10b:	b8 10 00 00 00       	mov    $0x10,%eax
+    a110:	89 e1                	mov    %esp,%ecx
+    a112:	ba 19 a1 00 00       	mov    $0xa119,%edx
+    a117:	0f 34                	sysenter
+    a119:	c3                   	ret
+
+0000a11a <kill>:
+SYSCALL(kill)
+    a11a:	b8 06 00 00 00       	mov    $0x6,%eax
+    a11f:	89 e1                	mov    %esp,%ecx
+    a121:	ba 28 a1 00 00       	mov    $0xa128,%edx
+    a126:	0f 34                	sysenter
+    a128:	c3                   	ret
+
+0000a129 <open>:
+SYSCALL(open)
+    a129:	b8 0f 00 00 00       	mov    $0xf,%eax
+    a12e:	89 e1                	mov    %esp,%ecx
+    a130:	ba 37 a1 00 00       	mov    $0xa137,%edx
+    a135:	0f 34                	sysenter
+    a137:	c3                   	ret
+
+0000a138 <mknod>:
+SYSCALL(mknod)
+    a138:	b8 11 00 00 00       	mov    $0x11,%eax
+    a13d:	89 e1                	mov    %esp,%ecx
+    a13f:	ba 46 a1 00 00       	mov    $0xa146,%edx
+    a144:	0f 34                	sysenter
+    a146:	c3                   	ret
+
+0000a147 <unlink>:
+SYSCALL(unlink)
+    a147:	b8 12 00 00 00       	mov    $0x12,%eax
+    a14c:	89 e1                	mov    %esp,%ecx
+    a14e:	ba 55 a1 00 00       	mov    $0xa155,%edx
+    a153:	0f 34                	sysenter
+    a155:	c3                   	ret
+
+0000a156 <fstat>:
+SYSCALL(fstat)
+    a156:	b8 08 00 00 00       	mov    $0x8,%eax
+    a15b:	89 e1                	mov    %esp,%ecx
+    a15d:	ba 64 a1 00 00       	mov    $0xa164,%edx
+    a162:	0f 34                	sysenter
+    a164:	c3                   	ret
+
+0000a165 <link>:
+SYSCALL(link)
+    a165:	b8 13 00 00 00       	mov    $0x13,%eax
+    a16a:	89 e1                	mov    %esp,%ecx
+    a16c:	ba 73 a1 00 00       	mov    $0xa173,%edx
+    a171:	0f 34                	sysenter
+    a173:	c3                   	ret
+
+0000a174 <mkdir>:
+SYSCALL(mkdir)
+    a174:	b8 14 00 00 00       	mov    $0x14,%eax
+    a179:	89 e1                	mov    %esp,%ecx
+    a17b:	ba 82 a1 00 00       	mov    $0xa182,%edx
+    a180:	0f 34                	sysenter
+    a182:	c3                   	ret
+
+0000a183 <chdir>:
+SYSCALL(chdir)
+    a183:	b8 09 00 00 00       	mov    $0x9,%eax
+    a188:	89 e1                	mov    %esp,%ecx
+    a18a:	ba 91 a1 00 00       	mov    $0xa191,%edx
+    a18f:	0f 34                	sysenter
+    a191:	c3                   	ret
+
+0000a192 <dup>:
+SYSCALL(dup)
+    a192:	b8 0a 00 00 00       	mov    $0xa,%eax
+    a197:	89 e1                	mov    %esp,%ecx
+    a199:	ba a0 a1 00 00       	mov    $0xa1a0,%edx
+    a19e:	0f 34                	sysenter
+    a1a0:	c3                   	ret
+
+0000a1a1 <getpid>:
+SYSCALL(getpid)
+    a1a1:	b8 0b 00 00 00       	mov    $0xb,%eax
+    a1a6:	89 e1                	mov    %esp,%ecx
+    a1a8:	ba af a1 00 00       	mov    $0xa1af,%edx
+    a1ad:	0f 34                	sysenter
+    a1af:	c3                   	ret
+
+0000a1b0 <sbrk>:
+SYSCALL(sbrk)
+    a1b0:	b8 0c 00 00 00       	mov    $0xc,%eax
+    a1b5:	89 e1                	mov    %esp,%ecx
+    a1b7:	ba be a1 00 00       	mov    $0xa1be,%edx
+    a1bc:	0f 34                	sysenter
+    a1be:	c3                   	ret
+
+0000a1bf <sleep>:
+SYSCALL(sleep)
+    a1bf:	b8 0d 00 00 00       	mov    $0xd,%eax
+    a1c4:	89 e1                	mov    %esp,%ecx
+    a1c6:	ba cd a1 00 00       	mov    $0xa1cd,%edx
+    a1cb:	0f 34                	sysenter
+    a1cd:	c3                   	ret
+
+0000a1ce <uptime>:
+SYSCALL(uptime)
+    a1ce:	b8 0e 00 00 00       	mov    $0xe,%eax
+    a1d3:	89 e1                	mov    %esp,%ecx
+    a1d5:	ba dc a1 00 00       	mov    $0xa1dc,%edx
+    a1da:	0f 34                	sysenter
+    a1dc:	c3                   	ret
+
+0000a1dd <date>:
+SYSCALL(date)
+    a1dd:	b8 16 00 00 00       	mov    $0x16,%eax
+    a1e2:	89 e1                	mov    %esp,%ecx
+    a1e4:	ba eb a1 00 00       	mov    $0xa1eb,%edx
+    a1e9:	0f 34                	sysenter
+    a1eb:	c3                   	ret
+
+0000a1ec <faultaround>:
+SYSCALL(faultaround)
+    a1ec:	b8 18 00 00 00       	mov    $0x18,%eax
+    a1f1:	89 e1                	mov    %esp,%ecx
+    a1f3:	ba fa a1 00 00       	mov    $0xa1fa,%edx
+    a1f8:	0f 34                	sysenter
+    a1fa:	c3                   	ret
+
+0000a1fb <faultstat>:
+SYSCALL(faultstat)
+    a1fb:	b8 19 00 00 00       	mov    $0x19,%eax
+    a200:	89 e1                	mov    %esp,%ecx
+    a202:	ba 09 a2 00 00       	mov    $0xa209,%edx
+    a207:	0f 34                	sysenter
+    a209:	c3                   	ret
+
+0000a20a <mmap>:
+SYSCALL(mmap)
+    a20a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    a20f:	89 e1                	mov    %esp,%ecx
+    a211:	ba 18 a2 00 00       	mov    $0xa218,%edx
+    a216:	0f 34                	sysenter
+    a218:	c3                   	ret
+
+0000a219 <munmap>:
+SYSCALL(munmap)
+    a219:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    a21e:	89 e1                	mov    %esp,%ecx
+    a220:	ba 27 a2 00 00       	mov    $0xa227,%edx
+    a225:	0f 34                	sysenter
+    a227:	c3                   	ret
+
+0000a228 <largepages>:
+SYSCALL(largepages)
+    a228:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    a22d:	89 e1                	mov    %esp,%ecx
+    a22f:	ba 36 a2 00 00       	mov    $0xa236,%edx
+    a234:	0f 34                	sysenter
+    a236:	c3                   	ret
+
+0000a237 <spawn>:
+SYSCALL(spawn)
+    a237:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    a23c:	89 e1                	mov    %esp,%ecx
+    a23e:	ba 45 a2 00 00       	mov    $0xa245,%edx
+    a243:	0f 34                	sysenter
+    a245:	c3                   	ret
+
+0000a246 <setpriority>:
+SYSCALL(setpriority)
+    a246:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    a24b:	89 e1                	mov    %esp,%ecx
+    a24d:	ba 54 a2 00 00       	mov    $0xa254,%edx
+    a252:	0f 34                	sysenter
+    a254:	c3                   	ret
+
+0000a255 <getpriority>:
+SYSCALL(getpriority)
+    a255:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    a25a:	89 e1                	mov    %esp,%ecx
+    a25c:	ba 63 a2 00 00       	mov    $0xa263,%edx
+    a261:	0f 34                	sysenter
+    a263:	c3                   	ret
+
+0000a264 <getprocinfo>:
+SYSCALL(getprocinfo)
+    a264:	b8 20 00 00 00       	mov    $0x20,%eax
+    a269:	89 e1                	mov    %esp,%ecx
+    a26b:	ba 72 a2 00 00       	mov    $0xa272,%edx
+    a270:	0f 34                	sysenter
+    a272:	c3                   	ret
+
+0000a273 <getcpuinfo>:
+SYSCALL(getcpuinfo)
+    a273:	b8 21 00 00 00       	mov    $0x21,%eax
+    a278:	89 e1                	mov    %esp,%ecx
+    a27a:	ba 81 a2 00 00       	mov    $0xa281,%edx
+    a27f:	0f 34                	sysenter
+    a281:	c3                   	ret
+
+0000a282 <clone>:
+SYSCALL(clone)
+    a282:	b8 22 00 00 00       	mov    $0x22,%eax
+    a287:	89 e1                	mov    %esp,%ecx
+    a289:	ba 90 a2 00 00       	mov    $0xa290,%edx
+    a28e:	0f 34                	sysenter
+    a290:	c3                   	ret
+
+0000a291 <join>:
+SYSCALL(join)
+    a291:	b8 23 00 00 00       	mov    $0x23,%eax
+    a296:	89 e1                	mov    %esp,%ecx
+    a298:	ba 9f a2 00 00       	mov    $0xa29f,%edx
+    a29d:	0f 34                	sysenter
+    a29f:	c3                   	ret
+
+0000a2a0 <futex_wait>:
+SYSCALL(futex_wait)
+    a2a0:	b8 24 00 00 00       	mov    $0x24,%eax
+    a2a5:	89 e1                	mov    %esp,%ecx
+    a2a7:	ba ae a2 00 00       	mov    $0xa2ae,%edx
+    a2ac:	0f 34                	sysenter
+    a2ae:	c3                   	ret
+
+0000a2af <futex_wake>:
+SYSCALL(futex_wake)
+    a2af:	b8 25 00 00 00       	mov    $0x25,%eax
+    a2b4:	89 e1                	mov    %esp,%ecx
+    a2b6:	ba bd a2 00 00       	mov    $0xa2bd,%edx
+    a2bb:	0f 34                	sysenter
+    a2bd:	c3                   	ret
+
+0000a2be <setaffinity>:
+SYSCALL(setaffinity)
+    a2be:	b8 26 00 00 00       	mov    $0x26,%eax
+    a2c3:	89 e1                	mov    %esp,%ecx
+    a2c5:	ba cc a2 00 00       	mov    $0xa2cc,%edx
+    a2ca:	0f 34                	sysenter
+    a2cc:	c3                   	ret
+
+0000a2cd <getaffinity>:
+SYSCALL(getaffinity)
+    a2cd:	b8 27 00 00 00       	mov    $0x27,%eax
+    a2d2:	89 e1                	mov    %esp,%ecx
+    a2d4:	ba db a2 00 00       	mov    $0xa2db,%edx
+    a2d9:	0f 34                	sysenter
+    a2db:	c3                   	ret
+
+0000a2dc <clock_gettime>:
+SYSCALL(clock_gettime)
+    a2dc:	b8 28 00 00 00       	mov    $0x28,%eax
+    a2e1:	89 e1                	mov    %esp,%ecx
+    a2e3:	ba ea a2 00 00       	mov    $0xa2ea,%edx
+    a2e8:	0f 34                	sysenter
+    a2ea:	c3                   	ret
+
+0000a2eb <msleep>:
+SYSCALL(msleep)
+    a2eb:	b8 29 00 00 00       	mov    $0x29,%eax
+    a2f0:	89 e1                	mov    %esp,%ecx
+    a2f2:	ba f9 a2 00 00       	mov    $0xa2f9,%edx
+    a2f7:	0f 34                	sysenter
+    a2f9:	c3                   	ret
+
+0000a2fa <lockstat>:
+SYSCALL(lockstat)
+    a2fa:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    a2ff:	89 e1                	mov    %esp,%ecx
+    a301:	ba 08 a3 00 00       	mov    $0xa308,%edx
+    a306:	0f 34                	sysenter
+    a308:	c3                   	ret
+
+0000a309 <bstat>:
+SYSCALL(bstat)
+    a309:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    a30e:	89 e1                	mov    %esp,%ecx
+    a310:	ba 17 a3 00 00       	mov    $0xa317,%edx
+    a315:	0f 34                	sysenter
+    a317:	c3                   	ret
+
+0000a318 <iostat>:
+SYSCALL(iostat)
+    a318:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    a31d:	89 e1                	mov    %esp,%ecx
+    a31f:	ba 26 a3 00 00       	mov    $0xa326,%edx
+    a324:	0f 34                	sysenter
+    a326:	c3                   	ret
+
+0000a327 <fsync>:
+SYSCALL(fsync)
+    a327:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    a32c:	89 e1                	mov    %esp,%ecx
+    a32e:	ba 35 a3 00 00       	mov    $0xa335,%edx
+    a333:	0f 34                	sysenter
+    a335:	c3                   	ret
+
+0000a336 <pread>:
+SYSCALL(pread)
+    a336:	b8 2e 00 00 00       	mov    $0x2e,%eax
+    a33b:	89 e1                	mov    %esp,%ecx
+    a33d:	ba 44 a3 00 00       	mov    $0xa344,%edx
+    a342:	0f 34                	sysenter
+    a344:	c3                   	ret
+
+0000a345 <pwrite>:
+SYSCALL(pwrite)
+    a345:	b8 2f 00 00 00       	mov    $0x2f,%eax
+    a34a:	89 e1                	mov    %esp,%ecx
+    a34c:	ba 53 a3 00 00       	mov    $0xa353,%edx
+    a351:	0f 34                	sysenter
+    a353:	c3                   	ret
+
+0000a354 <readv>:
+SYSCALL(readv)
+    a354:	b8 30 00 00 00       	mov    $0x30,%eax
+    a359:	89 e1                	mov    %esp,%ecx
+    a35b:	ba 62 a3 00 00       	mov    $0xa362,%edx
+    a360:	0f 34                	sysenter
+    a362:	c3                   	ret
+
+0000a363 <writev>:
+SYSCALL(writev)
+    a363:	b8 31 00 00 00       	mov    $0x31,%eax
+    a368:	89 e1                	mov    %esp,%ecx
+    a36a:	ba 71 a3 00 00       	mov    $0xa371,%edx
+    a36f:	0f 34                	sysenter
+    a371:	c3                   	ret
+
+0000a372 <sendfile>:
+SYSCALL(sendfile)
+    a372:	b8 32 00 00 00       	mov    $0x32,%eax
+    a377:	89 e1                	mov    %esp,%ecx
+    a379:	ba 80 a3 00 00       	mov    $0xa380,%edx
+    a37e:	0f 34                	sysenter
+    a380:	c3                   	ret
+
+0000a381 <fcntl>:
+SYSCALL(fcntl)
+    a381:	b8 33 00 00 00       	mov    $0x33,%eax
+    a386:	89 e1                	mov    %esp,%ecx
+    a388:	ba 8f a3 00 00       	mov    $0xa38f,%edx
+    a38d:	0f 34                	sysenter
+    a38f:	c3                   	ret
+
+0000a390 <mount>:
+SYSCALL(mount)
+    a390:	b8 34 00 00 00       	mov    $0x34,%eax
+    a395:	89 e1                	mov    %esp,%ecx
+    a397:	ba 9e a3 00 00       	mov    $0xa39e,%edx
+    a39c:	0f 34                	sysenter
+    a39e:	c3                   	ret
+
+0000a39f <getdents>:
+SYSCALL(getdents)
+    a39f:	b8 35 00 00 00       	mov    $0x35,%eax
+    a3a4:	89 e1                	mov    %esp,%ecx
+    a3a6:	ba ad a3 00 00       	mov    $0xa3ad,%edx
+    a3ab:	0f 34                	sysenter
+    a3ad:	c3                   	ret
+
+0000a3ae <fstatat>:
+SYSCALL(fstatat)
+    a3ae:	b8 36 00 00 00       	mov    $0x36,%eax
+    a3b3:	89 e1                	mov    %esp,%ecx
+    a3b5:	ba bc a3 00 00       	mov    $0xa3bc,%edx
+    a3ba:	0f 34                	sysenter
+    a3bc:	c3                   	ret
+
+0000a3bd <sysstat>:
+SYSCALL(sysstat)
+    a3bd:	b8 37 00 00 00       	mov    $0x37,%eax
+    a3c2:	89 e1                	mov    %esp,%ecx
+    a3c4:	ba cb a3 00 00       	mov    $0xa3cb,%edx
+    a3c9:	0f 34                	sysenter
+    a3cb:	c3                   	ret
+
+0000a3cc <ringenter>:
+SYSCALL(ringenter)
+    a3cc:	b8 38 00 00 00       	mov    $0x38,%eax
+    a3d1:	89 e1                	mov    %esp,%ecx
+    a3d3:	ba da a3 00 00       	mov    $0xa3da,%edx
+    a3d8:	0f 34                	sysenter
+    a3da:	c3                   	ret
+
+0000a3db <trace>:
+SYSCALL(trace)
+    a3db:	b8 39 00 00 00       	mov    $0x39,%eax
+    a3e0:	89 e1                	mov    %esp,%ecx
+    a3e2:	ba e9 a3 00 00       	mov    $0xa3e9,%edx
+    a3e7:	0f 34                	sysenter
+    a3e9:	c3                   	ret
+
+0000a3ea <memstat>:
+SYSCALL(memstat)
+    a3ea:	b8 3a 00 00 00       	mov    $0x3a,%eax
+    a3ef:	89 e1                	mov    %esp,%ecx
+    a3f1:	ba f8 a3 00 00       	mov    $0xa3f8,%edx
+    a3f6:	0f 34                	sysenter
+    a3f8:	c3                   	ret
+
+0000a3f9 <shmget>:
+SYSCALL(shmget)
+    a3f9:	b8 3b 00 00 00       	mov    $0x3b,%eax
+    a3fe:	89 e1                	mov    %esp,%ecx
+    a400:	ba 07 a4 00 00       	mov    $0xa407,%edx
+    a405:	0f 34                	sysenter
+    a407:	c3                   	ret
+
+0000a408 <shmat>:
+SYSCALL(shmat)
+    a408:	b8 3c 00 00 00       	mov    $0x3c,%eax
+    a40d:	89 e1                	mov    %esp,%ecx
+    a40f:	ba 16 a4 00 00       	mov    $0xa416,%edx
+    a414:	0f 34                	sysenter
+    a416:	c3                   	ret
+
+0000a417 <shmdt>:
+SYSCALL(shmdt)
+    a417:	b8 3d 00 00 00       	mov    $0x3d,%eax
+    a41c:	89 e1                	mov    %esp,%ecx
+    a41e:	ba 25 a4 00 00       	mov    $0xa425,%edx
+    a423:	0f 34                	sysenter
+    a425:	c3                   	ret
+
+0000a426 <irqstat>:
+SYSCALL(irqstat)
+    a426:	b8 3e 00 00 00       	mov    $0x3e,%eax
+    a42b:	89 e1                	mov    %esp,%ecx
+    a42d:	ba 34 a4 00 00       	mov    $0xa434,%edx
+    a432:	0f 34                	sysenter
+    a434:	c3                   	ret
+
+0000a435 <irqroute>:
+SYSCALL(irqroute)
+    a435:	b8 3f 00 00 00       	mov    $0x3f,%eax
+    a43a:	89 e1                	mov    %esp,%ecx
+    a43c:	ba 43 a4 00 00       	mov    $0xa443,%edx
+    a441:	0f 34                	sysenter
+    a443:	c3                   	ret
+
+0000a444 <putc>:
+  char buf[64];
+};
+
+static void
+putc(struct out *o, char c)
+{
+    a444:	55                   	push   %ebp
+    a445:	89 e5                	mov    %esp,%ebp
+    a447:	56                   	push   %esi
+    a448:	53                   	push   %ebx
+    a449:	89 c3                	mov    %eax,%ebx
+    a44b:	89 d6                	mov    %edx,%esi
+  if(o->n == sizeof(o->buf)){
+    a44d:	8b 40 04             	mov    0x4(%eax),%eax
+    a450:	83 f8 40             	cmp    $0x40,%eax
+    a453:	74 16                	je     a46b <putc+0x27>
+    bufwrite(o->fd, o->buf, o->n);
+    o->n = 0;
+  }
+  o->buf[o->n++] = c;
+    a455:	8b 43 04             	mov    0x4(%ebx),%eax
+    a458:	8d 50 01             	lea    0x1(%eax),%edx
+    a45b:	89 53 04             	mov    %edx,0x4(%ebx)
+    a45e:	89 f1                	mov    %esi,%ecx
+    a460:	88 4c 03 08          	mov    %cl,0x8(%ebx,%eax,1)
+}
+    a464:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    a467:	5b                   	pop    %ebx
+    a468:	5e                   	pop    %esi
+    a469:	5d                   	pop    %ebp
+    a46a:	c3                   	ret
+    bufwrite(o->fd, o->buf, o->n);
+    a46b:	8d 53 08             	lea    0x8(%ebx),%edx
+    a46e:	83 ec 04             	sub    $0x4,%esp
+    a471:	50                   	push   %eax
+    a472:	52                   	push   %edx
+    a473:	ff 33                	push   (%ebx)
+    a475:	e8 b2 f9 ff ff       	call   9e2c <bufwrite>
+    o->n = 0;
+    a47a:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+    a481:	83 c4 10             	add    $0x10,%esp
+    a484:	eb cf                	jmp    a455 <putc+0x11>
+
+0000a486 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+    a486:	55                   	push   %ebp
+    a487:	89 e5                	mov    %esp,%ebp
+    a489:	57                   	push   %edi
+    a48a:	56                   	push   %esi
+    a48b:	53                   	push   %ebx
+    a48c:	83 ec 2c             	sub    $0x2c,%esp
+    a48f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    a492:	89 d0                	mov    %edx,%eax
+    a494:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    a496:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+    a49a:	0f 95 c1             	setne  %cl
+    a49d:	c1 ea 1f             	shr    $0x1f,%edx
+    a4a0:	84 d1                	test   %dl,%cl
+    a4a2:	74 44                	je     a4e8 <printint+0x62>
+    neg = 1;
+    x = -xx;
+    a4a4:	f7 d8                	neg    %eax
+    a4a6:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+    a4a8:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    a4af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+    a4b4:	89 c8                	mov    %ecx,%eax
+    a4b6:	ba 00 00 00 00       	mov    $0x0,%edx
+    a4bb:	f7 f6                	div    %esi
+    a4bd:	89 df                	mov    %ebx,%edi
+    a4bf:	83 c3 01             	add    $0x1,%ebx
+    a4c2:	0f b6 92 dc e9 00 00 	movzbl 0xe9dc(%edx),%edx
+    a4c9:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+    a4cd:	89 ca                	mov    %ecx,%edx
+    a4cf:	89 c1                	mov    %eax,%ecx
+    a4d1:	39 f2                	cmp    %esi,%edx
+    a4d3:	73 df                	jae    a4b4 <printint+0x2e>
+  if(neg)
+    a4d5:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+    a4d9:	74 31                	je     a50c <printint+0x86>
+    buf[i++] = '-';
+    a4db:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+    a4e0:	8d 5f 02             	lea    0x2(%edi),%ebx
+    a4e3:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    a4e6:	eb 17                	jmp    a4ff <printint+0x79>
+    x = xx;
+    a4e8:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+    a4ea:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+    a4f1:	eb bc                	jmp    a4af <printint+0x29>
+
+  while(--i >= 0)
+    putc(o, buf[i]);
+    a4f3:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+    a4f8:	89 f0                	mov    %esi,%eax
+    a4fa:	e8 45 ff ff ff       	call   a444 <putc>
+  while(--i >= 0)
+    a4ff:	83 eb 01             	sub    $0x1,%ebx
+    a502:	79 ef                	jns    a4f3 <printint+0x6d>
+}
+    a504:	83 c4 2c             	add    $0x2c,%esp
+    a507:	5b                   	pop    %ebx
+    a508:	5e                   	pop    %esi
+    a509:	5f                   	pop    %edi
+    a50a:	5d                   	pop    %ebp
+    a50b:	c3                   	ret
+    a50c:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    a50f:	eb ee                	jmp    a4ff <printint+0x79>
+
+0000a511 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    a511:	55                   	push   %ebp
+    a512:	89 e5                	mov    %esp,%ebp
+    a514:	57                   	push   %edi
+    a515:	56                   	push   %esi
+    a516:	53                   	push   %ebx
+    a517:	83 ec 6c             	sub    $0x6c,%esp
+  int c, i, state;
+  uint *ap;
+  struct out out, *o;
+
+  o = &out;
+  o->fd = fd;
+    a51a:	8b 45 08             	mov    0x8(%ebp),%eax
+    a51d:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  o->n = 0;
+    a520:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+    a527:	8d 45 10             	lea    0x10(%ebp),%eax
+    a52a:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  state = 0;
+    a52d:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+    a532:	bb 00 00 00 00       	mov    $0x0,%ebx
+    a537:	eb 14                	jmp    a54d <printf+0x3c>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(o, c);
+    a539:	89 fa                	mov    %edi,%edx
+    a53b:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    a53e:	e8 01 ff ff ff       	call   a444 <putc>
+    a543:	eb 05                	jmp    a54a <printf+0x39>
+      }
+    } else if(state == '%'){
+    a545:	83 fe 25             	cmp    $0x25,%esi
+    a548:	74 25                	je     a56f <printf+0x5e>
+  for(i = 0; fmt[i]; i++){
+    a54a:	83 c3 01             	add    $0x1,%ebx
+    a54d:	8b 45 0c             	mov    0xc(%ebp),%eax
+    a550:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+    a554:	84 c0                	test   %al,%al
+    a556:	0f 84 20 01 00 00    	je     a67c <printf+0x16b>
+    c = fmt[i] & 0xff;
+    a55c:	0f be f8             	movsbl %al,%edi
+    a55f:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+    a562:	85 f6                	test   %esi,%esi
+    a564:	75 df                	jne    a545 <printf+0x34>
+      if(c == '%'){
+    a566:	83 f8 25             	cmp    $0x25,%eax
+    a569:	75 ce                	jne    a539 <printf+0x28>
+        state = '%';
+    a56b:	89 c6                	mov    %eax,%esi
+    a56d:	eb db                	jmp    a54a <printf+0x39>
+      if(c == 'd'){
+    a56f:	83 f8 25             	cmp    $0x25,%eax
+    a572:	0f 84 cf 00 00 00    	je     a647 <printf+0x136>
+    a578:	0f 8c dd 00 00 00    	jl     a65b <printf+0x14a>
+    a57e:	83 f8 78             	cmp    $0x78,%eax
+    a581:	0f 8f d4 00 00 00    	jg     a65b <printf+0x14a>
+    a587:	83 f8 63             	cmp    $0x63,%eax
+    a58a:	0f 8c cb 00 00 00    	jl     a65b <printf+0x14a>
+    a590:	83 e8 63             	sub    $0x63,%eax
+    a593:	83 f8 15             	cmp    $0x15,%eax
+    a596:	0f 87 bf 00 00 00    	ja     a65b <printf+0x14a>
+    a59c:	ff 24 85 84 e9 00 00 	jmp    *0xe984(,%eax,4)
+        printint(o, *ap, 10, 1);
+    a5a3:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+    a5a6:	8b 17                	mov    (%edi),%edx
+    a5a8:	83 ec 0c             	sub    $0xc,%esp
+    a5ab:	6a 01                	push   $0x1
+    a5ad:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    a5b2:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    a5b5:	e8 cc fe ff ff       	call   a486 <printint>
+        ap++;
+    a5ba:	83 c7 04             	add    $0x4,%edi
+    a5bd:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+    a5c0:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(o, '%');
+        putc(o, c);
+      }
+      state = 0;
+    a5c3:	be 00 00 00 00       	mov    $0x0,%esi
+    a5c8:	eb 80                	jmp    a54a <printf+0x39>
+        printint(o, *ap, 16, 0);
+    a5ca:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+    a5cd:	8b 17                	mov    (%edi),%edx
+    a5cf:	83 ec 0c             	sub    $0xc,%esp
+    a5d2:	6a 00                	push   $0x0
+    a5d4:	b9 10 00 00 00       	mov    $0x10,%ecx
+    a5d9:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    a5dc:	e8 a5 fe ff ff       	call   a486 <printint>
+        ap++;
+    a5e1:	83 c7 04             	add    $0x4,%edi
+    a5e4:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+    a5e7:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    a5ea:	be 00 00 00 00       	mov    $0x0,%esi
+    a5ef:	e9 56 ff ff ff       	jmp    a54a <printf+0x39>
+        s = (char*)*ap;
+    a5f4:	8b 45 94             	mov    -0x6c(%ebp),%eax
+    a5f7:	8b 30                	mov    (%eax),%esi
+        ap++;
+    a5f9:	83 c0 04             	add    $0x4,%eax
+    a5fc:	89 45 94             	mov    %eax,-0x6c(%ebp)
+        if(s == 0)
+    a5ff:	85 f6                	test   %esi,%esi
+    a601:	75 15                	jne    a618 <printf+0x107>
+          s = "(null)";
+    a603:	be 7c e9 00 00       	mov    $0xe97c,%esi
+    a608:	eb 0e                	jmp    a618 <printf+0x107>
+          putc(o, *s);
+    a60a:	0f be d2             	movsbl %dl,%edx
+    a60d:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    a610:	e8 2f fe ff ff       	call   a444 <putc>
+          s++;
+    a615:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+    a618:	0f b6 16             	movzbl (%esi),%edx
+    a61b:	84 d2                	test   %dl,%dl
+    a61d:	75 eb                	jne    a60a <printf+0xf9>
+      state = 0;
+    a61f:	be 00 00 00 00       	mov    $0x0,%esi
+    a624:	e9 21 ff ff ff       	jmp    a54a <printf+0x39>
+        putc(o, *ap);
+    a629:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+    a62c:	0f be 17             	movsbl (%edi),%edx
+    a62f:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    a632:	e8 0d fe ff ff       	call   a444 <putc>
+        ap++;
+    a637:	83 c7 04             	add    $0x4,%edi
+    a63a:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+      state = 0;
+    a63d:	be 00 00 00 00       	mov    $0x0,%esi
+    a642:	e9 03 ff ff ff       	jmp    a54a <printf+0x39>
+        putc(o, c);
+    a647:	89 fa                	mov    %edi,%edx
+    a649:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    a64c:	e8 f3 fd ff ff       	call   a444 <putc>
+      state = 0;
+    a651:	be 00 00 00 00       	mov    $0x0,%esi
+    a656:	e9 ef fe ff ff       	jmp    a54a <printf+0x39>
+        putc(o, '%');
+    a65b:	ba 25 00 00 00       	mov    $0x25,%edx
+    a660:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    a663:	e8 dc fd ff ff       	call   a444 <putc>
+        putc(o, c);
+    a668:	89 fa                	mov    %edi,%edx
+    a66a:	8d 45 a0             	lea    -0x60(%ebp),%eax
+    a66d:	e8 d2 fd ff ff       	call   a444 <putc>
+      state = 0;
+    a672:	be 00 00 00 00       	mov    $0x0,%esi
+    a677:	e9 ce fe ff ff       	jmp    a54a <printf+0x39>
+    }
+  }
+  if(o->n > 0)
+    a67c:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    a67f:	85 c0                	test   %eax,%eax
+    a681:	7f 08                	jg     a68b <printf+0x17a>
+    bufwrite(fd, o->buf, o->n);
+}
+    a683:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    a686:	5b                   	pop    %ebx
+    a687:	5e                   	pop    %esi
+    a688:	5f                   	pop    %edi
+    a689:	5d                   	pop    %ebp
+    a68a:	c3                   	ret
+    bufwrite(fd, o->buf, o->n);
+    a68b:	83 ec 04             	sub    $0x4,%esp
+    a68e:	50                   	push   %eax
+    a68f:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    a692:	50                   	push   %eax
+    a693:	ff 75 08             	push   0x8(%ebp)
+    a696:	e8 91 f7 ff ff       	call   9e2c <bufwrite>
+    a69b:	83 c4 10             	add    $0x10,%esp
+}
+    a69e:	eb e3                	jmp    a683 <printf+0x172>
+
+0000a6a0 <largefree>:
+  return &b->h;
+}
+
+static void
+largefree(Fblock *b)
+{
+    a6a0:	55                   	push   %ebp
+    a6a1:	89 e5                	mov    %esp,%ebp
+    a6a3:	57                   	push   %edi
+    a6a4:	56                   	push   %esi
+    a6a5:	53                   	push   %ebx
+    a6a6:	83 ec 0c             	sub    $0xc,%esp
+    a6a9:	89 c1                	mov    %eax,%ecx
+  Fblock **pp, *p, *prev;
+
+  prev = 0;
+    a6ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+    a6b0:	ba 8c ce 01 00       	mov    $0x1ce8c,%edx
+    a6b5:	eb 05                	jmp    a6bc <largefree+0x1c>
+    a6b7:	8d 50 08             	lea    0x8(%eax),%edx
+    prev = p;
+    a6ba:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+    a6bc:	8b 02                	mov    (%edx),%eax
+    a6be:	85 c0                	test   %eax,%eax
+    a6c0:	74 04                	je     a6c6 <largefree+0x26>
+    a6c2:	39 c8                	cmp    %ecx,%eax
+    a6c4:	72 f1                	jb     a6b7 <largefree+0x17>
+  b->next = p;
+    a6c6:	89 41 08             	mov    %eax,0x8(%ecx)
+  if(p && (char*)b + b->h.size == (char*)p){
+    a6c9:	85 c0                	test   %eax,%eax
+    a6cb:	74 09                	je     a6d6 <largefree+0x36>
+    a6cd:	8b 31                	mov    (%ecx),%esi
+    a6cf:	8d 3c 31             	lea    (%ecx,%esi,1),%edi
+    a6d2:	39 c7                	cmp    %eax,%edi
+    a6d4:	74 21                	je     a6f7 <largefree+0x57>
+    b->h.size += p->h.size;
+    b->next = p->next;
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+    a6d6:	85 db                	test   %ebx,%ebx
+    a6d8:	74 09                	je     a6e3 <largefree+0x43>
+    a6da:	8b 03                	mov    (%ebx),%eax
+    a6dc:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+    a6df:	39 ce                	cmp    %ecx,%esi
+    a6e1:	74 20                	je     a703 <largefree+0x63>
+    prev->h.size += b->h.size;
+    prev->next = b->next;
+  } else
+    *pp = b;
+    a6e3:	89 0a                	mov    %ecx,(%edx)
+
+  // Give the top of the heap back.  With threads sharing the
+  // address space sbrk() cannot shrink it; keep the block then.
+  for(pp = &large; (*pp)->next; pp = &(*pp)->next)
+    a6e5:	be 8c ce 01 00       	mov    $0x1ce8c,%esi
+    a6ea:	8b 1e                	mov    (%esi),%ebx
+    a6ec:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+    a6f0:	74 1d                	je     a70f <largefree+0x6f>
+    a6f2:	8d 73 08             	lea    0x8(%ebx),%esi
+    a6f5:	eb f3                	jmp    a6ea <largefree+0x4a>
+    b->h.size += p->h.size;
+    a6f7:	03 30                	add    (%eax),%esi
+    a6f9:	89 31                	mov    %esi,(%ecx)
+    b->next = p->next;
+    a6fb:	8b 40 08             	mov    0x8(%eax),%eax
+    a6fe:	89 41 08             	mov    %eax,0x8(%ecx)
+    a701:	eb d3                	jmp    a6d6 <largefree+0x36>
+    prev->h.size += b->h.size;
+    a703:	03 01                	add    (%ecx),%eax
+    a705:	89 03                	mov    %eax,(%ebx)
+    prev->next = b->next;
+    a707:	8b 41 08             	mov    0x8(%ecx),%eax
+    a70a:	89 43 08             	mov    %eax,0x8(%ebx)
+    a70d:	eb d6                	jmp    a6e5 <largefree+0x45>
+    ;
+  b = *pp;
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+    a70f:	89 df                	mov    %ebx,%edi
+    a711:	03 3b                	add    (%ebx),%edi
+    a713:	83 ec 0c             	sub    $0xc,%esp
+    a716:	6a 00                	push   $0x0
+    a718:	e8 93 fa ff ff       	call   a1b0 <sbrk>
+    a71d:	83 c4 10             	add    $0x10,%esp
+    a720:	39 c7                	cmp    %eax,%edi
+    a722:	74 08                	je     a72c <largefree+0x8c>
+    *pp = 0;
+}
+    a724:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    a727:	5b                   	pop    %ebx
+    a728:	5e                   	pop    %esi
+    a729:	5f                   	pop    %edi
+    a72a:	5d                   	pop    %ebp
+    a72b:	c3                   	ret
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+    a72c:	8b 03                	mov    (%ebx),%eax
+    a72e:	f7 d8                	neg    %eax
+    a730:	83 ec 0c             	sub    $0xc,%esp
+    a733:	50                   	push   %eax
+    a734:	e8 77 fa ff ff       	call   a1b0 <sbrk>
+    a739:	83 c4 10             	add    $0x10,%esp
+    a73c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    a73f:	74 e3                	je     a724 <largefree+0x84>
+    *pp = 0;
+    a741:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+    a747:	eb db                	jmp    a724 <largefree+0x84>
+
+0000a749 <more>:
+{
+    a749:	55                   	push   %ebp
+    a74a:	89 e5                	mov    %esp,%ebp
+    a74c:	56                   	push   %esi
+    a74d:	53                   	push   %ebx
+    a74e:	89 c6                	mov    %eax,%esi
+  pad = -(uint)sbrk(0) & 7;
+    a750:	83 ec 0c             	sub    $0xc,%esp
+    a753:	6a 00                	push   $0x0
+    a755:	e8 56 fa ff ff       	call   a1b0 <sbrk>
+    a75a:	f7 d8                	neg    %eax
+    a75c:	89 c3                	mov    %eax,%ebx
+    a75e:	83 e3 07             	and    $0x7,%ebx
+  if((p = sbrk(n + pad)) == (char*)-1)
+    a761:	01 de                	add    %ebx,%esi
+    a763:	89 34 24             	mov    %esi,(%esp)
+    a766:	e8 45 fa ff ff       	call   a1b0 <sbrk>
+    a76b:	83 c4 10             	add    $0x10,%esp
+    a76e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    a771:	74 09                	je     a77c <more+0x33>
+  return p + pad;
+    a773:	01 d8                	add    %ebx,%eax
+}
+    a775:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    a778:	5b                   	pop    %ebx
+    a779:	5e                   	pop    %esi
+    a77a:	5d                   	pop    %ebp
+    a77b:	c3                   	ret
+    return 0;
+    a77c:	b8 00 00 00 00       	mov    $0x0,%eax
+    a781:	eb f2                	jmp    a775 <more+0x2c>
+
+0000a783 <slaballoc>:
+{
+    a783:	55                   	push   %ebp
+    a784:	89 e5                	mov    %esp,%ebp
+    a786:	56                   	push   %esi
+    a787:	53                   	push   %ebx
+    a788:	89 c6                	mov    %eax,%esi
+  n = 1 << (MINSHIFT + c);
+    a78a:	8d 48 04             	lea    0x4(%eax),%ecx
+    a78d:	bb 01 00 00 00       	mov    $0x1,%ebx
+    a792:	d3 e3                	shl    %cl,%ebx
+  if(slab + n > slabend){
+    a794:	89 d8                	mov    %ebx,%eax
+    a796:	03 05 88 ce 01 00    	add    0x1ce88,%eax
+    a79c:	39 05 84 ce 01 00    	cmp    %eax,0x1ce84
+    a7a2:	72 17                	jb     a7bb <slaballoc+0x38>
+  h = (Header*)slab;
+    a7a4:	a1 88 ce 01 00       	mov    0x1ce88,%eax
+  slab += n;
+    a7a9:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+    a7ac:	89 15 88 ce 01 00    	mov    %edx,0x1ce88
+  h->size = n;
+    a7b2:	89 18                	mov    %ebx,(%eax)
+  h->class = c;
+    a7b4:	89 70 04             	mov    %esi,0x4(%eax)
+}
+    a7b7:	5b                   	pop    %ebx
+    a7b8:	5e                   	pop    %esi
+    a7b9:	5d                   	pop    %ebp
+    a7ba:	c3                   	ret
+    if((p = more(SLABSZ)) == 0)
+    a7bb:	b8 00 40 00 00       	mov    $0x4000,%eax
+    a7c0:	e8 84 ff ff ff       	call   a749 <more>
+    a7c5:	85 c0                	test   %eax,%eax
+    a7c7:	74 ee                	je     a7b7 <slaballoc+0x34>
+    if(p != slabend)
+    a7c9:	39 05 84 ce 01 00    	cmp    %eax,0x1ce84
+    a7cf:	74 05                	je     a7d6 <slaballoc+0x53>
+      slab = p;
+    a7d1:	a3 88 ce 01 00       	mov    %eax,0x1ce88
+    slabend = p + SLABSZ;
+    a7d6:	05 00 40 00 00       	add    $0x4000,%eax
+    a7db:	a3 84 ce 01 00       	mov    %eax,0x1ce84
+    a7e0:	eb c2                	jmp    a7a4 <slaballoc+0x21>
+
+0000a7e2 <largealloc>:
+{
+    a7e2:	55                   	push   %ebp
+    a7e3:	89 e5                	mov    %esp,%ebp
+    a7e5:	56                   	push   %esi
+    a7e6:	53                   	push   %ebx
+    a7e7:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+    a7e9:	b9 8c ce 01 00       	mov    $0x1ce8c,%ecx
+    a7ee:	8b 01                	mov    (%ecx),%eax
+    a7f0:	85 c0                	test   %eax,%eax
+    a7f2:	74 36                	je     a82a <largealloc+0x48>
+    if(b->h.size < n)
+    a7f4:	8b 10                	mov    (%eax),%edx
+    a7f6:	39 da                	cmp    %ebx,%edx
+    a7f8:	72 24                	jb     a81e <largealloc+0x3c>
+    if(b->h.size - n > SMALLMAX){
+    a7fa:	29 da                	sub    %ebx,%edx
+    a7fc:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+    a802:	76 1f                	jbe    a823 <largealloc+0x41>
+      rest = (Fblock*)((char*)b + n);
+    a804:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+      rest->h.size = b->h.size - n;
+    a807:	89 16                	mov    %edx,(%esi)
+      rest->h.class = LARGE;
+    a809:	c7 46 04 09 00 00 00 	movl   $0x9,0x4(%esi)
+      rest->next = b->next;
+    a810:	8b 50 08             	mov    0x8(%eax),%edx
+    a813:	89 56 08             	mov    %edx,0x8(%esi)
+      *pp = rest;
+    a816:	89 31                	mov    %esi,(%ecx)
+      b->h.size = n;
+    a818:	89 18                	mov    %ebx,(%eax)
+}
+    a81a:	5b                   	pop    %ebx
+    a81b:	5e                   	pop    %esi
+    a81c:	5d                   	pop    %ebp
+    a81d:	c3                   	ret
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+    a81e:	8d 48 08             	lea    0x8(%eax),%ecx
+    a821:	eb cb                	jmp    a7ee <largealloc+0xc>
+      *pp = b->next;
+    a823:	8b 50 08             	mov    0x8(%eax),%edx
+    a826:	89 11                	mov    %edx,(%ecx)
+    return &b->h;
+    a828:	eb f0                	jmp    a81a <largealloc+0x38>
+  if((b = more(n)) == 0)
+    a82a:	89 d8                	mov    %ebx,%eax
+    a82c:	e8 18 ff ff ff       	call   a749 <more>
+    a831:	85 c0                	test   %eax,%eax
+    a833:	74 e5                	je     a81a <largealloc+0x38>
+  b->h.size = n;
+    a835:	89 18                	mov    %ebx,(%eax)
+  b->h.class = LARGE;
+    a837:	c7 40 04 09 00 00 00 	movl   $0x9,0x4(%eax)
+  return &b->h;
+    a83e:	eb da                	jmp    a81a <largealloc+0x38>
+
+0000a840 <free>:
+
+void
+free(void *ap)
+{
+    a840:	55                   	push   %ebp
+    a841:	89 e5                	mov    %esp,%ebp
+    a843:	56                   	push   %esi
+    a844:	53                   	push   %ebx
+    a845:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+
+  if(ap == 0)
+    a848:	85 db                	test   %ebx,%ebx
+    a84a:	74 3b                	je     a887 <free+0x47>
+    return;
+  h = (Header*)ap - 1;
+    a84c:	8d 73 f8             	lea    -0x8(%ebx),%esi
+  lock_acquire(&lock);
+    a84f:	83 ec 0c             	sub    $0xc,%esp
+    a852:	68 80 ce 01 00       	push   $0x1ce80
+    a857:	e8 9c 01 00 00       	call   a9f8 <lock_acquire>
+  if(h->class == LARGE)
+    a85c:	8b 43 fc             	mov    -0x4(%ebx),%eax
+    a85f:	83 c4 10             	add    $0x10,%esp
+    a862:	83 f8 09             	cmp    $0x9,%eax
+    a865:	74 27                	je     a88e <free+0x4e>
+    largefree((Fblock*)h);
+  else {
+    ((Fblock*)h)->next = freelist[h->class];
+    a867:	8b 14 85 a0 ce 01 00 	mov    0x1cea0(,%eax,4),%edx
+    a86e:	89 13                	mov    %edx,(%ebx)
+    freelist[h->class] = (Fblock*)h;
+    a870:	89 34 85 a0 ce 01 00 	mov    %esi,0x1cea0(,%eax,4)
+  }
+  lock_release(&lock);
+    a877:	83 ec 0c             	sub    $0xc,%esp
+    a87a:	68 80 ce 01 00       	push   $0x1ce80
+    a87f:	e8 88 01 00 00       	call   aa0c <lock_release>
+    a884:	83 c4 10             	add    $0x10,%esp
+}
+    a887:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    a88a:	5b                   	pop    %ebx
+    a88b:	5e                   	pop    %esi
+    a88c:	5d                   	pop    %ebp
+    a88d:	c3                   	ret
+    largefree((Fblock*)h);
+    a88e:	89 f0                	mov    %esi,%eax
+    a890:	e8 0b fe ff ff       	call   a6a0 <largefree>
+    a895:	eb e0                	jmp    a877 <free+0x37>
+
+0000a897 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    a897:	55                   	push   %ebp
+    a898:	89 e5                	mov    %esp,%ebp
+    a89a:	53                   	push   %ebx
+    a89b:	83 ec 04             	sub    $0x4,%esp
+    a89e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+  uint n;
+  int c;
+
+  if(nbytes > 0x7fffffff - sizeof(Header) - 7)
+    a8a1:	81 fb f0 ff ff 7f    	cmp    $0x7ffffff0,%ebx
+    a8a7:	0f 87 8b 00 00 00    	ja     a938 <malloc+0xa1>
+    return 0;
+  n = (nbytes + sizeof(Header) + 7) & ~7;
+    a8ad:	83 c3 0f             	add    $0xf,%ebx
+    a8b0:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(n < sizeof(Fblock))
+    a8b3:	83 fb 0b             	cmp    $0xb,%ebx
+    a8b6:	77 05                	ja     a8bd <malloc+0x26>
+    n = sizeof(Fblock);
+    a8b8:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  lock_acquire(&lock);
+    a8bd:	83 ec 0c             	sub    $0xc,%esp
+    a8c0:	68 80 ce 01 00       	push   $0x1ce80
+    a8c5:	e8 2e 01 00 00       	call   a9f8 <lock_acquire>
+  if(n <= SMALLMAX){
+    a8ca:	83 c4 10             	add    $0x10,%esp
+    a8cd:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+    a8d3:	77 58                	ja     a92d <malloc+0x96>
+    for(c = 0; (1 << (MINSHIFT + c)) < n; c++)
+    a8d5:	ba 00 00 00 00       	mov    $0x0,%edx
+    a8da:	eb 03                	jmp    a8df <malloc+0x48>
+    a8dc:	83 c2 01             	add    $0x1,%edx
+    a8df:	8d 4a 04             	lea    0x4(%edx),%ecx
+    a8e2:	b8 01 00 00 00       	mov    $0x1,%eax
+    a8e7:	d3 e0                	shl    %cl,%eax
+    a8e9:	39 d8                	cmp    %ebx,%eax
+    a8eb:	72 ef                	jb     a8dc <malloc+0x45>
+      ;
+    if(freelist[c]){
+    a8ed:	8b 04 95 a0 ce 01 00 	mov    0x1cea0(,%edx,4),%eax
+    a8f4:	85 c0                	test   %eax,%eax
+    a8f6:	74 2a                	je     a922 <malloc+0x8b>
+      h = &freelist[c]->h;
+    a8f8:	89 c3                	mov    %eax,%ebx
+      freelist[c] = freelist[c]->next;
+    a8fa:	8b 40 08             	mov    0x8(%eax),%eax
+    a8fd:	89 04 95 a0 ce 01 00 	mov    %eax,0x1cea0(,%edx,4)
+    } else
+      h = slaballoc(c);
+  } else
+    h = largealloc(n);
+  lock_release(&lock);
+    a904:	83 ec 0c             	sub    $0xc,%esp
+    a907:	68 80 ce 01 00       	push   $0x1ce80
+    a90c:	e8 fb 00 00 00       	call   aa0c <lock_release>
+  return h ? (void*)(h + 1) : 0;
+    a911:	83 c4 10             	add    $0x10,%esp
+    a914:	85 db                	test   %ebx,%ebx
+    a916:	74 03                	je     a91b <malloc+0x84>
+    a918:	83 c3 08             	add    $0x8,%ebx
+}
+    a91b:	89 d8                	mov    %ebx,%eax
+    a91d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    a920:	c9                   	leave
+    a921:	c3                   	ret
+      h = slaballoc(c);
+    a922:	89 d0                	mov    %edx,%eax
+    a924:	e8 5a fe ff ff       	call   a783 <slaballoc>
+    a929:	89 c3                	mov    %eax,%ebx
+    a92b:	eb d7                	jmp    a904 <malloc+0x6d>
+    h = largealloc(n);
+    a92d:	89 d8                	mov    %ebx,%eax
+    a92f:	e8 ae fe ff ff       	call   a7e2 <largealloc>
+    a934:	89 c3                	mov    %eax,%ebx
+    a936:	eb cc                	jmp    a904 <malloc+0x6d>
+    return 0;
+    a938:	bb 00 00 00 00       	mov    $0x0,%ebx
+    a93d:	eb dc                	jmp    a91b <malloc+0x84>
+
+0000a93f <tstart>:
+  void *arg;
+};
+
+static void
+tstart(void *a)
+{
+    a93f:	55                   	push   %ebp
+    a940:	89 e5                	mov    %esp,%ebp
+    a942:	83 ec 14             	sub    $0x14,%esp
+    a945:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+    a948:	ff 70 04             	push   0x4(%eax)
+    a94b:	ff 10                	call   *(%eax)
+  exit();
+    a94d:	e8 86 f6 ff ff       	call   9fd8 <exit>
+
+0000a952 <thread_create>:
+}
+
+// Run fn(arg) in a new thread.  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    a952:	55                   	push   %ebp
+    a953:	89 e5                	mov    %esp,%ebp
+    a955:	56                   	push   %esi
+    a956:	53                   	push   %ebx
+  struct tstart *t;
+  char *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    a957:	83 ec 0c             	sub    $0xc,%esp
+    a95a:	68 00 10 00 00       	push   $0x1000
+    a95f:	e8 33 ff ff ff       	call   a897 <malloc>
+    a964:	83 c4 10             	add    $0x10,%esp
+    a967:	85 c0                	test   %eax,%eax
+    a969:	74 42                	je     a9ad <thread_create+0x5b>
+    a96b:	89 c3                	mov    %eax,%ebx
+    return -1;
+  t = (struct tstart*)stack;
+  t->fn = fn;
+    a96d:	8b 45 08             	mov    0x8(%ebp),%eax
+    a970:	89 03                	mov    %eax,(%ebx)
+  t->arg = arg;
+    a972:	8b 45 0c             	mov    0xc(%ebp),%eax
+    a975:	89 43 04             	mov    %eax,0x4(%ebx)
+  if((pid = clone(tstart, stack + TSTACK, t)) < 0)
+    a978:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    a97e:	83 ec 04             	sub    $0x4,%esp
+    a981:	53                   	push   %ebx
+    a982:	50                   	push   %eax
+    a983:	68 3f a9 00 00       	push   $0xa93f
+    a988:	e8 f5 f8 ff ff       	call   a282 <clone>
+    a98d:	89 c6                	mov    %eax,%esi
+    a98f:	83 c4 10             	add    $0x10,%esp
+    a992:	85 c0                	test   %eax,%eax
+    a994:	78 09                	js     a99f <thread_create+0x4d>
+    free(stack);
+  return pid;
+}
+    a996:	89 f0                	mov    %esi,%eax
+    a998:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    a99b:	5b                   	pop    %ebx
+    a99c:	5e                   	pop    %esi
+    a99d:	5d                   	pop    %ebp
+    a99e:	c3                   	ret
+    free(stack);
+    a99f:	83 ec 0c             	sub    $0xc,%esp
+    a9a2:	53                   	push   %ebx
+    a9a3:	e8 98 fe ff ff       	call   a840 <free>
+    a9a8:	83 c4 10             	add    $0x10,%esp
+    a9ab:	eb e9                	jmp    a996 <thread_create+0x44>
+    return -1;
+    a9ad:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    a9b2:	eb e2                	jmp    a996 <thread_create+0x44>
+
+0000a9b4 <thread_join>:
+
+// Wait for one of this process's threads to exit and free its
+// stack.  Returns its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+    a9b4:	55                   	push   %ebp
+    a9b5:	89 e5                	mov    %esp,%ebp
+    a9b7:	53                   	push   %ebx
+    a9b8:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    a9bb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    a9be:	50                   	push   %eax
+    a9bf:	e8 cd f8 ff ff       	call   a291 <join>
+    a9c4:	89 c3                	mov    %eax,%ebx
+    a9c6:	83 c4 10             	add    $0x10,%esp
+    a9c9:	85 c0                	test   %eax,%eax
+    a9cb:	79 07                	jns    a9d4 <thread_join+0x20>
+    free((char*)stack - TSTACK);
+  return pid;
+}
+    a9cd:	89 d8                	mov    %ebx,%eax
+    a9cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    a9d2:	c9                   	leave
+    a9d3:	c3                   	ret
+    free((char*)stack - TSTACK);
+    a9d4:	83 ec 0c             	sub    $0xc,%esp
+    a9d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    a9da:	2d 00 10 00 00       	sub    $0x1000,%eax
+    a9df:	50                   	push   %eax
+    a9e0:	e8 5b fe ff ff       	call   a840 <free>
+    a9e5:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    a9e8:	eb e3                	jmp    a9cd <thread_join+0x19>
+
+0000a9ea <lock_init>:
+
+void
+lock_init(lock_t *lk)
+{
+    a9ea:	55                   	push   %ebp
+    a9eb:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    a9ed:	8b 45 08             	mov    0x8(%ebp),%eax
+    a9f0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    a9f6:	5d                   	pop    %ebp
+    a9f7:	c3                   	ret
+
+0000a9f8 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+    a9f8:	55                   	push   %ebp
+    a9f9:	89 e5                	mov    %esp,%ebp
+    a9fb:	8b 55 08             	mov    0x8(%ebp),%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    a9fe:	b8 01 00 00 00       	mov    $0x1,%eax
+    aa03:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    aa06:	85 c0                	test   %eax,%eax
+    aa08:	75 f4                	jne    a9fe <lock_acquire+0x6>
+    ;
+}
+    aa0a:	5d                   	pop    %ebp
+    aa0b:	c3                   	ret
+
+0000aa0c <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+    aa0c:	55                   	push   %ebp
+    aa0d:	89 e5                	mov    %esp,%ebp
+    aa0f:	8b 55 08             	mov    0x8(%ebp),%edx
+    aa12:	b8 00 00 00 00       	mov    $0x0,%eax
+    aa17:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    aa1a:	5d                   	pop    %ebp
+    aa1b:	c3                   	ret
+
+0000aa1c <mutex_init>:
+// Are Tricky": state is 0 when free, 1 when held, 2 when held and
+// others may be waiting.  Unlocking an uncontended mutex costs no
+// system call.
+void
+mutex_init(mutex_t *m)
+{
+    aa1c:	55                   	push   %ebp
+    aa1d:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    aa1f:	8b 45 08             	mov    0x8(%ebp),%eax
+    aa22:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    aa28:	5d                   	pop    %ebp
+    aa29:	c3                   	ret
+
+0000aa2a <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+    aa2a:	55                   	push   %ebp
+    aa2b:	89 e5                	mov    %esp,%ebp
+    aa2d:	53                   	push   %ebx
+    aa2e:	83 ec 04             	sub    $0x4,%esp
+    aa31:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    aa34:	b8 00 00 00 00       	mov    $0x0,%eax
+    aa39:	b9 01 00 00 00       	mov    $0x1,%ecx
+    aa3e:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    aa42:	85 c0                	test   %eax,%eax
+    aa44:	74 29                	je     aa6f <mutex_lock+0x45>
+    return;
+  if(c != 2)
+    aa46:	83 f8 02             	cmp    $0x2,%eax
+    aa49:	74 20                	je     aa6b <mutex_lock+0x41>
+    aa4b:	b8 02 00 00 00       	mov    $0x2,%eax
+    aa50:	f0 87 03             	lock xchg %eax,(%ebx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    aa53:	eb 16                	jmp    aa6b <mutex_lock+0x41>
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    aa55:	83 ec 08             	sub    $0x8,%esp
+    aa58:	6a 02                	push   $0x2
+    aa5a:	53                   	push   %ebx
+    aa5b:	e8 40 f8 ff ff       	call   a2a0 <futex_wait>
+  asm volatile("lock; xchgl %0, %1" :
+    aa60:	b8 02 00 00 00       	mov    $0x2,%eax
+    aa65:	f0 87 03             	lock xchg %eax,(%ebx)
+    aa68:	83 c4 10             	add    $0x10,%esp
+  while(c != 0){
+    aa6b:	85 c0                	test   %eax,%eax
+    aa6d:	75 e6                	jne    aa55 <mutex_lock+0x2b>
+    c = xchg(&m->state, 2);
+  }
+}
+    aa6f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    aa72:	c9                   	leave
+    aa73:	c3                   	ret
+
+0000aa74 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+    aa74:	55                   	push   %ebp
+    aa75:	89 e5                	mov    %esp,%ebp
+    aa77:	83 ec 08             	sub    $0x8,%esp
+    aa7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    aa7d:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    aa82:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    aa86:	83 fa 01             	cmp    $0x1,%edx
+    aa89:	75 02                	jne    aa8d <mutex_unlock+0x19>
+    m->state = 0;
+    futex_wake(&m->state, 1);
+  }
+}
+    aa8b:	c9                   	leave
+    aa8c:	c3                   	ret
+    m->state = 0;
+    aa8d:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+    aa93:	83 ec 08             	sub    $0x8,%esp
+    aa96:	6a 01                	push   $0x1
+    aa98:	50                   	push   %eax
+    aa99:	e8 11 f8 ff ff       	call   a2af <futex_wake>
+    aa9e:	83 c4 10             	add    $0x10,%esp
+}
+    aaa1:	eb e8                	jmp    aa8b <mutex_unlock+0x17>
+
+0000aaa3 <cond_init>:
+// Condition variable: waiters sleep on a sequence number that
+// every signal bumps, so a signal between the unlock and the
+// futex_wait() in cond_wait() is not lost.
+void
+cond_init(cond_t *c)
+{
+    aaa3:	55                   	push   %ebp
+    aaa4:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    aaa6:	8b 45 08             	mov    0x8(%ebp),%eax
+    aaa9:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    aaaf:	5d                   	pop    %ebp
+    aab0:	c3                   	ret
+
+0000aab1 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+    aab1:	55                   	push   %ebp
+    aab2:	89 e5                	mov    %esp,%ebp
+    aab4:	57                   	push   %edi
+    aab5:	56                   	push   %esi
+    aab6:	53                   	push   %ebx
+    aab7:	83 ec 18             	sub    $0x18,%esp
+    aaba:	8b 75 08             	mov    0x8(%ebp),%esi
+    aabd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    aac0:	8b 3e                	mov    (%esi),%edi
+  mutex_unlock(m);
+    aac2:	53                   	push   %ebx
+    aac3:	e8 ac ff ff ff       	call   aa74 <mutex_unlock>
+  futex_wait(&c->seq, seq);
+    aac8:	83 c4 08             	add    $0x8,%esp
+    aacb:	57                   	push   %edi
+    aacc:	56                   	push   %esi
+    aacd:	e8 ce f7 ff ff       	call   a2a0 <futex_wait>
+  // Others may be waiting for m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+    aad2:	83 c4 10             	add    $0x10,%esp
+    aad5:	eb 0e                	jmp    aae5 <cond_wait+0x34>
+    futex_wait(&m->state, 2);
+    aad7:	83 ec 08             	sub    $0x8,%esp
+    aada:	6a 02                	push   $0x2
+    aadc:	53                   	push   %ebx
+    aadd:	e8 be f7 ff ff       	call   a2a0 <futex_wait>
+    aae2:	83 c4 10             	add    $0x10,%esp
+    aae5:	b8 02 00 00 00       	mov    $0x2,%eax
+    aaea:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    aaed:	85 c0                	test   %eax,%eax
+    aaef:	75 e6                	jne    aad7 <cond_wait+0x26>
+}
+    aaf1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    aaf4:	5b                   	pop    %ebx
+    aaf5:	5e                   	pop    %esi
+    aaf6:	5f                   	pop    %edi
+    aaf7:	5d                   	pop    %ebp
+    aaf8:	c3                   	ret
+
+0000aaf9 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+    aaf9:	55                   	push   %ebp
+    aafa:	89 e5                	mov    %esp,%ebp
+    aafc:	83 ec 10             	sub    $0x10,%esp
+    aaff:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    ab02:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+    ab06:	6a 01                	push   $0x1
+    ab08:	50                   	push   %eax
+    ab09:	e8 a1 f7 ff ff       	call   a2af <futex_wake>
+}
+    ab0e:	83 c4 10             	add    $0x10,%esp
+    ab11:	c9                   	leave
+    ab12:	c3                   	ret
+
+0000ab13 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+    ab13:	55                   	push   %ebp
+    ab14:	89 e5                	mov    %esp,%ebp
+    ab16:	83 ec 10             	sub    $0x10,%esp
+    ab19:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    ab1c:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, NPROC);
+    ab20:	6a 40                	push   $0x40
+    ab22:	50                   	push   %eax
+    ab23:	e8 87 f7 ff ff       	call   a2af <futex_wake>
+}
+    ab28:	83 c4 10             	add    $0x10,%esp
+    ab2b:	c9                   	leave
+    ab2c:	c3                   	ret
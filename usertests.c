@@ -4,9 +4,20 @@
 #include "user.h"
 #include "fs.h"
 #include "fcntl.h"
+#include "uio.h"
 #include "syscall.h"
 #include "traps.h"
 #include "memlayout.h"
+#include "fault.h"
+#include "procinfo.h"
+#include "clock.h"
+#include "lockstat.h"
+#include "bstat.h"
+#include "iostat.h"
+#include "sysstat.h"
+#include "ring.h"
+#include "trace.h"
+#include "memstat.h"
 
 char buf[8192];
 char name[3];
@@ -1144,271 +1155,2758 @@ bigwrite(void)
   printf(1, "bigwrite ok\n");
 }
 
+// One unaligned write bigger than a transaction, crossing into the
+// double-indirect blocks, must come back intact.
 void
-bigfile(void)
+bigtranstest(void)
 {
-  int fd, i, total, cc;
+  enum { N = 160*1024 };
+  char *p;
+  int fd, i;
 
-  printf(1, "bigfile test\n");
+  printf(1, "bigtrans test\n");
+  if((p = malloc(N)) == 0){
+    printf(1, "bigtrans: malloc failed\n");
+    exit();
+  }
+  for(i = 0; i < N; i++)
+    p[i] = i % 251;
+  if((fd = open("bigtrans", O_CREATE|O_RDWR)) < 0){
+    printf(1, "bigtrans: create failed\n");
+    exit();
+  }
+  if(write(fd, "x", 1) != 1 || write(fd, p, N) != N){
+    printf(1, "bigtrans: write failed\n");
+    exit();
+  }
+  close(fd);
+  memset(p, 0, N);
+  if((fd = open("bigtrans", 0)) < 0 || read(fd, p, 1) != 1 || read(fd, p, N) != N){
+    printf(1, "bigtrans: read failed\n");
+    exit();
+  }
+  close(fd);
+  for(i = 0; i < N; i++)
+    if(p[i] != (char)(i % 251)){
+      printf(1, "bigtrans: bad data at %d\n", i);
+      exit();
+    }
+  free(p);
+  unlink("bigtrans");
+  printf(1, "bigtrans test OK\n");
+}
 
-  unlink("bigfile");
-  fd = open("bigfile", O_CREATE | O_RDWR);
-  if(fd < 0){
-    printf(1, "cannot create bigfile");
+// Names that were looked up and missing, then created, unlinked
+// or replaced (also by a new directory of the same name), must be
+// seen as they are now, not as the directory entry cache last saw
+// them.
+void
+dcachetest(void)
+{
+  struct stat st;
+  int fd, i, ino;
+
+  printf(1, "dcache test\n");
+  for(i = 0; i < 3; i++){
+    if(open("dcdir/f", 0) >= 0 || open("dcdir", 0) >= 0){
+      printf(1, "dcache: dcdir still there\n");
+      exit();
+    }
+    if(mkdir("dcdir") < 0){
+      printf(1, "dcache: mkdir failed\n");
+      exit();
+    }
+    if(open("dcdir/f", 0) >= 0){
+      printf(1, "dcache: dcdir/f there in a new directory\n");
+      exit();
+    }
+    if((fd = open("dcdir/f", O_CREATE|O_RDWR)) < 0){
+      printf(1, "dcache: create failed\n");
+      exit();
+    }
+    fstat(fd, &st);
+    ino = st.ino;
+    close(fd);
+    if(link("dcdir/f", "dcdir/g") < 0 || stat("dcdir/g", &st) < 0 || st.ino != ino){
+      printf(1, "dcache: link not seen\n");
+      exit();
+    }
+    if(unlink("dcdir/f") < 0 || open("dcdir/f", 0) >= 0){
+      printf(1, "dcache: unlinked file still there\n");
+      exit();
+    }
+    if(unlink("dcdir/g") < 0 || unlink("dcdir") < 0){
+      printf(1, "dcache: unlink failed\n");
+      exit();
+    }
+  }
+  printf(1, "dcache test OK\n");
+}
+
+// sendfile() from a file into a pipe, and from the pipe into
+// another file, must move every byte, in order.
+void
+sendfiletest(void)
+{
+  int fd, out, p[2], i, n, pid;
+
+  printf(1, "sendfile test\n");
+  fd = open("sf0", O_CREATE|O_RDWR);
+  for(i = 0; i < 20; i++){
+    memset(buf, 'a' + i, 1000);
+    write(fd, buf, 1000);
+  }
+  close(fd);
+  if(pipe(p) < 0){
+    printf(1, "sendfile: pipe failed\n");
+    exit();
+  }
+  if((pid = fork()) == 0){
+    close(p[0]);
+    fd = open("sf0", 0);
+    if(sendfile(p[1], fd, 100000) != 20000){
+      printf(1, "sendfile: file to pipe short\n");
+      exit();
+    }
     exit();
   }
+  close(p[1]);
+  out = open("sf1", O_CREATE|O_RDWR);
+  while((n = sendfile(out, p[0], 3000)) > 0)
+    ;
+  close(p[0]);
+  wait();
+  close(out);
+  fd = open("sf1", 0);
   for(i = 0; i < 20; i++){
-    memset(buf, i, 600);
-    if(write(fd, buf, 600) != 600){
-      printf(1, "write bigfile failed\n");
+    if(read(fd, buf, 1000) != 1000 || buf[0] != 'a' + i || buf[999] != 'a' + i){
+      printf(1, "sendfile: wrong data in block %d\n", i);
       exit();
     }
   }
+  if(read(fd, buf, 1) != 0 || n < 0){
+    printf(1, "sendfile: copy too long or failed\n");
+    exit();
+  }
   close(fd);
+  unlink("sf0");
+  unlink("sf1");
+  printf(1, "sendfile test OK\n");
+}
 
-  fd = open("bigfile", 0);
-  if(fd < 0){
-    printf(1, "cannot open bigfile\n");
+// A pipe's buffer can grow with fcntl(), keeping what is in it,
+// but cannot shrink below what it holds; data must still come out
+// in order across its pages.
+void
+pipesizetest(void)
+{
+  int p[2], i, n, pid, seq, total;
+
+  printf(1, "pipe size test\n");
+  if(pipe(p) < 0){
+    printf(1, "pipe size: pipe failed\n");
+    exit();
+  }
+  if(fcntl(p[0], F_GETPIPE_SZ, 0) != 4096){
+    printf(1, "pipe size: default is not a page\n");
+    exit();
+  }
+  for(i = 0; i < 3000; i++)
+    buf[i] = i;
+  write(p[1], buf, 3000);
+  if(fcntl(p[1], F_SETPIPE_SZ, 10000) != 16384 ||
+     fcntl(p[0], F_SETPIPE_SZ, 1000000) != -1){
+    printf(1, "pipe size: resize failed\n");
+    exit();
+  }
+  write(p[1], buf, 8000);
+  if(fcntl(p[1], F_SETPIPE_SZ, 4096) != -1){
+    printf(1, "pipe size: shrank below its contents\n");
+    exit();
+  }
+  if(read(p[0], buf, 8192) != 8192 || read(p[0], buf, 8192) != 2808){
+    printf(1, "pipe size: short read\n");
+    exit();
+  }
+  for(i = 0; i < 2808; i++){
+    if((buf[i] & 0xff) != ((8192 - 3000 + i) & 0xff)){
+      printf(1, "pipe size: wrong data at %d\n", i);
+      exit();
+    }
+  }
+
+  if((pid = fork()) == 0){
+    close(p[0]);
+    for(seq = 0; seq < 100000; seq += n){
+      n = 7001;
+      for(i = 0; i < n; i++)
+        buf[i] = seq + i;
+      write(p[1], buf, n);
+    }
     exit();
   }
+  close(p[1]);
+  seq = 0;
   total = 0;
-  for(i = 0; ; i++){
-    cc = read(fd, buf, 300);
-    if(cc < 0){
-      printf(1, "read bigfile failed\n");
+  while((n = read(p[0], buf, 5000)) > 0){
+    for(i = 0; i < n; i++){
+      if((buf[i] & 0xff) != (seq++ & 0xff)){
+        printf(1, "pipe size: wrong data from child\n");
+        exit();
+      }
+    }
+    total += n;
+  }
+  close(p[0]);
+  wait();
+  if(total != 15*7001){
+    printf(1, "pipe size: got %d bytes\n", total);
+    exit();
+  }
+  printf(1, "pipe size test OK\n");
+}
+
+// Files under /tmp are on the in-memory tmpfs; ".." out of its root
+// must lead back to /, links across it must fail, and data must
+// read back across its pages.
+void
+tmpfstest(void)
+{
+  struct stat st;
+  int fd, i;
+
+  printf(1, "tmpfs test\n");
+  mkdir("/tmp");
+  mount("tmpfs", "/tmp");   // init has usually done this
+  if(stat("/tmp", &st) < 0 || st.dev == ROOTDEV || st.ino != 1){
+    printf(1, "tmpfs: /tmp is not mounted\n");
+    exit();
+  }
+  if(mkdir("/tmp/td") < 0 || (fd = open("/tmp/td/f", O_CREATE|O_RDWR)) < 0){
+    printf(1, "tmpfs: create failed\n");
+    exit();
+  }
+  for(i = 0; i < 5; i++){
+    memset(buf, 'a' + i, 3000);
+    if(write(fd, buf, 3000) != 3000){
+      printf(1, "tmpfs: write failed\n");
       exit();
     }
-    if(cc == 0)
-      break;
-    if(cc != 300){
-      printf(1, "short read bigfile\n");
+  }
+  close(fd);
+  fd = open("/tmp/td/f", 0);
+  for(i = 0; i < 5; i++){
+    if(read(fd, buf, 3000) != 3000 || buf[0] != 'a' + i || buf[2999] != 'a' + i){
+      printf(1, "tmpfs: wrong data\n");
       exit();
     }
-    if(buf[0] != i/2 || buf[299] != i/2){
-      printf(1, "read bigfile wrong data\n");
+  }
+  if(read(fd, buf, 1) != 0){
+    printf(1, "tmpfs: file too long\n");
+    exit();
+  }
+  close(fd);
+  if(link("/tmp/td/f", "tmpfslink") == 0){
+    printf(1, "tmpfs: linked across file systems\n");
+    exit();
+  }
+  if(chdir("/tmp/td") < 0 || chdir("../..") < 0 ||
+     stat(".", &st) < 0 || st.dev != ROOTDEV || st.ino != 1){
+    printf(1, "tmpfs: .. does not lead back to /\n");
+    exit();
+  }
+  if(unlink("/tmp/td") == 0 || unlink("/tmp/td/f") < 0 || unlink("/tmp/td") < 0){
+    printf(1, "tmpfs: unlink failed\n");
+    exit();
+  }
+  printf(1, "tmpfs test OK\n");
+}
+
+// Reads through the page cache must see every later write, at any
+// offset, and a file made again under the same name must not show
+// the old one's pages.
+void
+pcachetest(void)
+{
+  int fd, i, k;
+  char c;
+
+  printf(1, "page cache test\n");
+  fd = open("pc0", O_CREATE|O_RDWR);
+  for(i = 0; i < 3; i++){
+    memset(buf, 'a' + i, 4096);
+    write(fd, buf, 4096);
+  }
+  close(fd);
+  fd = open("pc0", O_RDWR);
+  for(i = 0; i < 3; i++){
+    if(read(fd, buf, 4096) != 4096 || buf[0] != 'a' + i || buf[4095] != 'a' + i){
+      printf(1, "page cache: wrong data\n");
+      exit();
+    }
+  }
+  // Over the boundary between the first two pages, read in above.
+  if(pwrite(fd, "xyz", 3, 4095) != 3 || pread(fd, buf, 5, 4094) != 5 ||
+     buf[0] != 'a' || buf[1] != 'x' || buf[2] != 'y' || buf[3] != 'z' || buf[4] != 'b'){
+    printf(1, "page cache: write not seen\n");
+    exit();
+  }
+  // Appending past the cached end of the file.
+  memset(buf, 'q', 100);
+  if(pwrite(fd, buf, 100, 3*4096) != 100){
+    printf(1, "page cache: append failed\n");
+    exit();
+  }
+  for(k = 3*4096 - 1; k < 3*4096 + 100; k++){
+    if(pread(fd, &c, 1, k) != 1 || c != (k < 3*4096 ? 'c' : 'q')){
+      printf(1, "page cache: wrong data at %d\n", k);
       exit();
     }
-    total += cc;
   }
   close(fd);
-  if(total != 20*600){
-    printf(1, "read bigfile wrong total\n");
+  unlink("pc0");
+  fd = open("pc0", O_CREATE|O_RDWR);
+  memset(buf, 'n', 4096);
+  write(fd, buf, 4096);
+  close(fd);
+  fd = open("pc0", 0);
+  if(read(fd, buf, 8192) != 4096 || buf[0] != 'n' || buf[4095] != 'n'){
+    printf(1, "page cache: old file seen\n");
+    exit();
+  }
+  close(fd);
+  unlink("pc0");
+  printf(1, "page cache test OK\n");
+}
+
+// getdents() must return every name in a directory once, hashed
+// or not, and fstatat() must find them from the directory's fd.
+void
+getdentstest(void)
+{
+  struct dirent de[10];
+  struct stat st;
+  char name[DIRSIZ+1], path[8];
+  int fd, i, n, seen, dots;
+
+  printf(1, "getdents test\n");
+  mkdir("gdd");
+  strcpy(path, "gdd/f00");
+  for(i = 0; i < 60; i++){   // enough to get hashed
+    path[5] = '0' + i/10;
+    path[6] = '0' + i%10;
+    if((fd = open(path, O_CREATE|O_RDWR)) < 0){
+      printf(1, "getdents: create failed\n");
+      exit();
+    }
+    write(fd, path, i);
+    close(fd);
+  }
+  fd = open("gdd", 0);
+  seen = dots = 0;
+  name[DIRSIZ] = 0;
+  while((n = getdents(fd, de, sizeof(de))) > 0){
+    for(i = 0; i < n / sizeof(de[0]); i++){
+      memmove(name, de[i].name, DIRSIZ);
+      if(name[0] == '.'){
+        dots++;
+        continue;
+      }
+      if(fstatat(fd, name, &st) < 0 || st.type != T_FILE ||
+         st.size != (name[1] - '0')*10 + name[2] - '0'){
+        printf(1, "getdents: fstatat %s failed\n", name);
+        exit();
+      }
+      seen++;
+    }
+  }
+  close(fd);
+  if(n < 0 || seen != 60 || dots != 2){
+    printf(1, "getdents: saw %d names and %d dots\n", seen, dots);
+    exit();
+  }
+  if(fstatat(AT_FDCWD, "gdd/f07", &st) < 0 || st.size != 7){
+    printf(1, "getdents: fstatat from cwd failed\n");
+    exit();
+  }
+  for(i = 0; i < 60; i++){
+    path[5] = '0' + i/10;
+    path[6] = '0' + i%10;
+    unlink(path);
+  }
+  if(unlink("gdd") < 0){
+    printf(1, "getdents: unlink failed\n");
+    exit();
+  }
+  printf(1, "getdents test OK\n");
+}
+
+// sysstat() must count each system call the caller makes, and
+// those of children it has waited for.
+void
+sysstattest(void)
+{
+  static struct syscount a[NSYSCALL], b[NSYSCALL];
+  int i;
+
+  printf(1, "sysstat test\n");
+  sysstat(SS_SELF, a);
+  for(i = 0; i < 10; i++)
+    getpid();
+  sysstat(SS_SELF, b);
+  if(b[SYS_getpid].n != a[SYS_getpid].n + 10 ||
+     b[SYS_sysstat].n != a[SYS_sysstat].n + 1 || b[SYS_getpid].max == 0){
+    printf(1, "sysstat: own calls miscounted\n");
+    exit();
+  }
+  sysstat(SS_CHILDREN, a);
+  if(fork() == 0){
+    for(i = 0; i < 5; i++)
+      uptime();
+    exit();
+  }
+  wait();
+  sysstat(SS_CHILDREN, b);
+  if(b[SYS_uptime].n != a[SYS_uptime].n + 5){
+    printf(1, "sysstat: child's calls miscounted\n");
+    exit();
+  }
+  if(sysstat(SS_ALL, b) < 0 || b[SYS_getpid].n < 10){
+    printf(1, "sysstat: system counts wrong\n");
+    exit();
+  }
+  printf(1, "sysstat test OK\n");
+}
+
+static void
+ringput(struct ring *r, int op, int fd, void *addr, uint len, int off)
+{
+  struct sqe *e = &r->sq[r->sqtail % NRING];
+
+  e->op = op;
+  e->fd = fd;
+  e->addr = (uint)addr;
+  e->len = len;
+  e->off = off;
+  e->data = r->sqtail;
+  r->sqtail++;
+}
+
+// Requests queued in a ring must all be done by one ringenter(),
+// in order, each completion carrying its request's data.
+void
+ringtest(void)
+{
+  static struct ring r;
+  char b[12];
+  int fd, i;
+
+  printf(1, "ring test\n");
+  ringput(&r, RING_OPEN, 0, "rg0", O_CREATE|O_RDWR, 0);
+  if(ringenter(&r, NRING) != 1 || r.cqtail != 1 || (fd = r.cq[0].res) < 0){
+    printf(1, "ring: open failed\n");
+    exit();
+  }
+  ringput(&r, RING_WRITE, fd, "hello ", 6, -1);
+  ringput(&r, RING_WRITE, fd, "world!", 6, -1);
+  ringput(&r, RING_FSYNC, fd, 0, 0, 0);
+  ringput(&r, RING_READ, fd, b, 12, 0);
+  ringput(&r, RING_CLOSE, fd, 0, 0, 0);
+  ringput(&r, RING_READ, fd, b, 12, 0);   // closed by now
+  if(ringenter(&r, NRING) != 6 || r.sqhead != 7 || r.cqtail != 7){
+    printf(1, "ring: not all done\n");
+    exit();
+  }
+  for(i = 1; i < 7; i++){
+    if(r.cq[i].data != i){
+      printf(1, "ring: completion %d out of order\n", i);
+      exit();
+    }
+  }
+  if(r.cq[1].res != 6 || r.cq[2].res != 6 || r.cq[3].res != 0 ||
+     r.cq[4].res != 12 || r.cq[5].res != 0 || r.cq[6].res != -1 ||
+     b[0] != 'h' || b[6] != 'w' || b[11] != '!'){
+    printf(1, "ring: wrong results\n");
+    exit();
+  }
+  r.cqhead = r.cqtail;
+  unlink("rg0");
+  printf(1, "ring test OK\n");
+}
+
+// System calls by sysenter (usys.S) and by int $T_SYSCALL must
+// agree, and the registers a caller keeps must survive either.
+void
+sysentertest(void)
+{
+  int a, b, pid;
+  uint esi, edi, ebx;
+
+  printf(1, "sysenter test\n");
+  asm volatile("int %2" : "=a" (a) : "a" (SYS_getpid), "i" (T_SYSCALL));
+  if(a != getpid()){
+    printf(1, "sysenter: getpid %d by int, %d by sysenter\n", a, getpid());
+    exit();
+  }
+  asm volatile("movl $1f, %%edx; movl %%esp, %%ecx; sysenter; 1:"
+               : "=a" (b), "=S" (esi), "=D" (edi), "=b" (ebx)
+               : "a" (SYS_getpid), "S" (0x11111111), "D" (0x22222222),
+                 "b" (0x33333333)
+               : "ecx", "edx", "memory", "cc");
+  if(b != a || esi != 0x11111111 || edi != 0x22222222 || ebx != 0x33333333){
+    printf(1, "sysenter: registers lost\n");
+    exit();
+  }
+  pid = fork();
+  if(pid == 0){
+    if(getpid() == a)
+      printf(1, "sysenter: child is its parent\n");
+    exit();
+  }
+  if(pid < 0 || wait() != pid){
+    printf(1, "sysenter: fork failed\n");
+    exit();
+  }
+  printf(1, "sysenter test OK\n");
+}
+
+// With system calls traced, a getpid() must show up in the rings,
+// its entry and its return.
+void
+tracetest(void)
+{
+  static struct tracev ev[64];
+  int cpu, i, n, pid, in, out;
+
+  printf(1, "trace test\n");
+  pid = getpid();
+  for(cpu = 0; trace(TR_READ, cpu, ev, 64) >= 0; cpu++)
+    while(trace(TR_READ, cpu, ev, 64) > 0)
+      ;
+  trace(TR_ENABLE, TC_SYSCALL, 0, 0);
+  getpid();
+  if(trace(TR_ENABLE, 0, 0, 0) != TC_SYSCALL){
+    printf(1, "trace: mask not kept\n");
+    exit();
+  }
+  in = out = 0;
+  for(cpu = 0; trace(TR_READ, cpu, ev, 0) >= 0; cpu++){
+    while((n = trace(TR_READ, cpu, ev, 64)) > 0){
+      for(i = 0; i < n; i++){
+        if(ev[i].cpu != cpu || ev[i].a != pid)
+          continue;
+        if(ev[i].type == TE_SYSCALL && ev[i].b == SYS_getpid)
+          in++;
+        if(ev[i].type == TE_SYSRET && ev[i].b == pid)
+          out++;
+      }
+    }
+  }
+  if(in != 1 || out != 1){
+    printf(1, "trace: getpid traced %d in, %d out\n", in, out);
+    exit();
+  }
+  printf(1, "trace test OK\n");
+}
+
+// printf() to a file must stay in its buffer until close(), and
+// fork() and exit() must flush it: once, not once per process.
+void
+stdiotest(void)
+{
+  struct stat st;
+  char b[16];
+  int fd, p[2], n;
+
+  printf(1, "stdio test\n");
+  fd = open("stdio0", O_CREATE|O_RDWR);
+  if(fd < 0){
+    printf(1, "stdio: create failed\n");
+    exit();
+  }
+  printf(fd, "%d %s", 42, "abc");
+  if(fstat(fd, &st) < 0 || st.size != 0){
+    printf(1, "stdio: file written unbuffered\n");
+    exit();
+  }
+  printf(fd, "!");
+  if(fork() == 0)
+    exit();
+  wait();
+  close(fd);
+  fd = open("stdio0", O_RDONLY);
+  n = read(fd, b, sizeof(b) - 1);
+  close(fd);
+  unlink("stdio0");
+  if(n != 7 || (b[n] = 0, strcmp(b, "42 abc!")) != 0){
+    printf(1, "stdio: file has %d bytes\n", n);
+    exit();
+  }
+  if(pipe(p) < 0){
+    printf(1, "stdio: pipe failed\n");
+    exit();
+  }
+  if(fork() == 0){
+    close(p[0]);
+    printf(p[1], "from child");
+    exit();
+  }
+  close(p[1]);
+  n = read(p[0], b, sizeof(b) - 1);
+  close(p[0]);
+  wait();
+  if(n != 10 || (b[n] = 0, strcmp(b, "from child")) != 0){
+    printf(1, "stdio: exit did not flush\n");
+    exit();
+  }
+  printf(1, "stdio test OK\n");
+}
+
+// malloc() must hand a freed small block to the next request of its
+// size class, reuse freed blocks without growing the heap, and give
+// a freed large block at the top of the heap back to the kernel.
+void
+malloctest(void)
+{
+  static char *p[500];
+  char *a, *b, *top;
+  int i;
+
+  printf(1, "malloc test\n");
+  a = malloc(24);
+  free(a);
+  if((b = malloc(20)) != a){
+    printf(1, "malloc: freed block not reused\n");
+    exit();
+  }
+  free(b);
+  for(i = 0; i < 500; i++){
+    if((p[i] = malloc(100 + i%50)) == 0){
+      printf(1, "malloc: out of memory\n");
+      exit();
+    }
+    memset(p[i], i, 100);
+  }
+  for(i = 0; i < 500; i++){
+    if(p[i][99] != (char)i){
+      printf(1, "malloc: blocks overlap\n");
+      exit();
+    }
+    free(p[i]);
+  }
+  top = sbrk(0);
+  for(i = 0; i < 500; i++)
+    p[i] = malloc(100 + i%50);
+  for(i = 0; i < 500; i++)
+    free(p[i]);
+  if(sbrk(0) != top){
+    printf(1, "malloc: heap grew for reused blocks\n");
+    exit();
+  }
+  a = malloc(1024*1024);
+  if(a == 0 || sbrk(0) < a + 1024*1024){
+    printf(1, "malloc: large block not from sbrk\n");
+    exit();
+  }
+  a[1024*1024-1] = 1;
+  free(a);
+  if(sbrk(0) - top >= 8){   // less the padding to align it
+    printf(1, "malloc: large block not given back\n");
+    exit();
+  }
+  printf(1, "malloc test OK\n");
+}
+
+// memmove() must copy right across alignments and overlaps, both
+// ways, as must memset() and strlen(); and so must the kernel's
+// copies, of a file read back at odd offsets.
+void
+stringtest(void)
+{
+  static char a[300], b[300];
+  int i, off, n, fd;
+
+  printf(1, "string test\n");
+  for(off = 0; off < 8; off++){
+    for(n = 0; n < 70; n += 7){
+      for(i = 0; i < sizeof(a); i++)
+        a[i] = i;
+      memmove(a + 100 + off, a + 100, n);     // overlapping, up
+      for(i = 0; i < n; i++)
+        if(a[100 + off + i] != (char)(100 + i))
+          goto bad;
+      for(i = 0; i < sizeof(a); i++)
+        a[i] = i;
+      memmove(a + 100, a + 100 + off, n);     // overlapping, down
+      for(i = 0; i < n; i++)
+        if(a[100 + i] != (char)(100 + off + i))
+          goto bad;
+      memset(b, 0, sizeof(b));
+      memset(b + off, 'x', n);
+      b[off + n] = 0;
+      if(strlen(b + off) != n || (off > 0 && b[off-1] != 0))
+        goto bad;
+    }
+  }
+  for(i = 0; i < sizeof(a); i++)
+    a[i] = i * 7;
+  fd = open("string0", O_CREATE|O_RDWR);
+  if(fd < 0 || write(fd, a + 3, 257) != 257){
+    printf(1, "string: write failed\n");
+    exit();
+  }
+  close(fd);
+  fd = open("string0", O_RDONLY);
+  if(read(fd, b + 1, 257) != 257){
+    printf(1, "string: read failed\n");
+    exit();
+  }
+  close(fd);
+  unlink("string0");
+  if(memcmp(a + 3, b + 1, 257) != 0)
+    goto bad;
+  printf(1, "string test OK\n");
+  return;
+bad:
+  printf(1, "string: copy wrong at offset %d, %d bytes\n", off, n);
+  exit();
+}
+
+// System calls must work on heap the process has never touched,
+// on copy-on-write pages after fork(), and refuse to read into
+// memory that is not writable, with no kernel fault in any case.
+void
+lazycopytest(void)
+{
+  static char cow[4096];
+  struct stat *st;
+  char *a;
+  int fd, p[2];
+
+  printf(1, "lazy copy test\n");
+  a = sbrk(4*4096);
+  if(a == (char*)-1){
+    printf(1, "lazycopy: sbrk failed\n");
+    exit();
+  }
+  if(pipe(p) < 0 || write(p[1], a + 4096 - 10, 20) != 20 ||
+     read(p[0], a + 2*4096 - 10, 20) != 20 || a[2*4096] != 0){
+    printf(1, "lazycopy: pipe through untouched heap failed\n");
+    exit();
+  }
+  st = (struct stat*)(a + 3*4096 - 4);
+  fd = open("README", O_RDONLY);
+  if(fd < 0 || fstat(fd, st) < 0 || st->type != T_FILE || st->size == 0){
+    printf(1, "lazycopy: fstat into untouched heap failed\n");
+    exit();
+  }
+  cow[0] = 'p';
+  if(fork() == 0){
+    write(p[1], "c", 1);
+    if(read(p[0], cow, 1) != 1 || cow[0] != 'c')
+      printf(1, "lazycopy: read into copy-on-write page failed\n");
+    exit();
+  }
+  wait();
+  if(cow[0] != 'p'){
+    printf(1, "lazycopy: child's read reached the parent\n");
+    exit();
+  }
+  if(read(fd, (char*)lazycopytest, 10) != -1){
+    printf(1, "lazycopy: read into text succeeded\n");
+    exit();
+  }
+  close(fd);
+  close(p[0]);
+  close(p[1]);
+  sbrk(-4*4096);
+  printf(1, "lazy copy test OK\n");
+}
+
+// This process's resident page count, from getprocinfo().
+static int
+myrss(void)
+{
+  struct procinfo pi;
+  int i;
+
+  for(i = 0; getprocinfo(i, &pi) == 0; i++)
+    if(pi.pid == getpid())
+      return pi.rss;
+  return -1;
+}
+
+// The resident page count must follow the heap pages that are
+// touched and given back, a forked child must start with its
+// parent's, and memstat()'s counters must add up.
+void
+rsstest(void)
+{
+  struct memstat m;
+  int i, before, after, fds[2];
+  char *a;
+
+  printf(1, "rss test\n");
+  if(memstat(&m) < 0 || m.total == 0 || m.used + m.free != m.total ||
+     m.zero > m.free){
+    printf(1, "rss: memstat counters wrong\n");
+    exit();
+  }
+  before = myrss();
+  a = sbrk(8*4096);
+  if(a == (char*)-1){
+    printf(1, "rss: sbrk failed\n");
+    exit();
+  }
+  if(myrss() != before){
+    printf(1, "rss: sbrk alone made pages resident\n");
+    exit();
+  }
+  for(i = 0; i < 8; i++)
+    a[i*4096] = i;
+  after = myrss();
+  if(after < before + 8){
+    printf(1, "rss: %d pages resident after touching 8, %d before\n",
+           after, before);
+    exit();
+  }
+  if(pipe(fds) < 0){
+    printf(1, "rss: pipe failed\n");
+    exit();
+  }
+  after = myrss();
+  if(fork() == 0){
+    i = myrss();
+    write(fds[1], &i, sizeof(i));
+    exit();
+  }
+  wait();
+  if(read(fds[0], &i, sizeof(i)) != sizeof(i) || i != after){
+    printf(1, "rss: child started with %d pages, parent has %d\n", i, after);
+    exit();
+  }
+  close(fds[0]);
+  close(fds[1]);
+  sbrk(-8*4096);
+  if(myrss() > before){
+    printf(1, "rss: pages still counted after sbrk(-)\n");
+    exit();
+  }
+  printf(1, "rss test OK\n");
+}
+
+// A shared memory segment must be the same memory in every
+// process that attaches it, and in a forked child, and must be
+// gone, with its pages, once the last of them lets go.
+void
+shmtest(void)
+{
+  char *a, *b;
+  int id, pid;
+
+  printf(1, "shm test\n");
+  if((id = shmget(4242, 2*4096)) < 0 || (a = shmat(id)) == (char*)-1){
+    printf(1, "shm: shmget/shmat failed\n");
+    exit();
+  }
+  if(a[0] != 0 || a[2*4096-1] != 0){
+    printf(1, "shm: new segment not zeroed\n");
+    exit();
+  }
+  if(shmget(4242, 3*4096) != -1 || shmget(4242, 4096) != id){
+    printf(1, "shm: shmget of an existing key wrong\n");
+    exit();
+  }
+  if((pid = fork()) == 0){
+    a[1] = 'f';
+    if((b = shmat(shmget(4242, 4096))) == (char*)-1 || b == a){
+      printf(1, "shm: attach in child failed\n");
+      exit();
+    }
+    b[0] = 'x';
+    b[4096] = 'y';
+    if(a[0] != 'x' || shmdt(b) != 0){
+      printf(1, "shm: second mapping not shared\n");
+      exit();
+    }
+    exit();
+  }
+  wait();
+  if(a[0] != 'x' || a[1] != 'f' || a[4096] != 'y'){
+    printf(1, "shm: child's writes not seen\n");
+    exit();
+  }
+  if(shmdt(a + 1) != -1 || shmdt(a) != 0 || shmdt(a) != -1){
+    printf(1, "shm: shmdt wrong\n");
+    exit();
+  }
+  if((id = shmget(4242, 4096)) < 0 || (a = shmat(id)) == (char*)-1 ||
+     a[0] != 0){
+    printf(1, "shm: segment survived its last detach\n");
+    exit();
+  }
+  shmdt(a);
+  printf(1, "shm test OK\n");
+}
+
+// Interrupts must be counted per CPU, and an IRQ pinned with
+// irqroute() must be taken by that CPU.
+void
+irqtest(void)
+{
+  uint before[NIRQ], after[NIRQ];
+  int route[NIRQ];
+  char buf[512];
+  int fd;
+
+  printf(1, "irq test\n");
+  if(irqstat(0, before) < 0 || irqstat(NCPU, before) != -1 ||
+     irqstat(-1, (uint*)route) < 0 || route[IRQ_IDE] < 0){
+    printf(1, "irq: irqstat failed\n");
+    exit();
+  }
+  if(irqroute(IRQ_TIMER, 0) != -1 || irqroute(NIRQ, 0) != -1 ||
+     irqroute(IRQ_IDE, NCPU) != -1){
+    printf(1, "irq: bad irqroute accepted\n");
+    exit();
+  }
+  if(irqroute(IRQ_IDE, 0) < 0 || irqstat(-1, (uint*)route) < 0 ||
+     route[IRQ_IDE] != 0){
+    printf(1, "irq: pinning the disk to cpu 0 failed\n");
+    exit();
+  }
+  irqstat(0, before);
+  memset(buf, 'i', sizeof(buf));
+  if((fd = open("irqf", O_CREATE|O_RDWR)) < 0 ||
+     write(fd, buf, sizeof(buf)) != sizeof(buf) || fsync(fd) < 0){
+    printf(1, "irq: write failed\n");
+    exit();
+  }
+  close(fd);
+  unlink("irqf");
+  sleep(1);
+  irqstat(0, after);
+  irqroute(IRQ_IDE, -1);
+  if(after[IRQ_IDE] == before[IRQ_IDE] || after[IRQ_TIMER] == before[IRQ_TIMER]){
+    printf(1, "irq: cpu 0 took no disk or timer interrupts\n");
+    exit();
+  }
+  printf(1, "irq test OK\n");
+}
+
+// grep must print just the matching lines, the last one too when
+// it has no newline, and in no time on a pattern that a
+// backtracking matcher takes exponential time over.
+void
+greptest(void)
+{
+  static char *args[] = { "grep", "a*a*a*a*a*a*a*a*a*a*b", "grepf", 0 };
+  static char *want = "xaab\nb\nab\n";
+  int fd, n, i;
+
+  printf(1, "grep test\n");
+  if((fd = open("grepf", O_CREATE|O_RDWR)) < 0){
+    printf(1, "grep: create failed\n");
+    exit();
+  }
+  for(i = 0; i < 40; i++)
+    write(fd, "a", 1);
+  printf(fd, "c\nxaab\nb\nccc\nab");
+  close(fd);
+  if(fork() == 0){
+    close(1);
+    if(open("grepout", O_CREATE|O_RDWR) != 1)
+      exit();
+    exec("grep", args);
+    exit();
+  }
+  wait();
+  fd = open("grepout", 0);
+  n = read(fd, buf, sizeof(buf));
+  close(fd);
+  unlink("grepf");
+  unlink("grepout");
+  if(n != strlen(want) || memcmp(buf, want, n) != 0){
+    printf(1, "grep: printed %d bytes, not the %d wanted\n", n, strlen(want));
+    exit();
+  }
+  printf(1, "grep test OK\n");
+}
+
+// Several processes at once forking children that sleep, killing
+// them and waiting for them, which leans on the process locks:
+// kill() has to find each child asleep or about to be, and wait()
+// has to get every one back with the right pid.
+void
+proclocktest(void)
+{
+  int ok[2], p[2], i, w, pid, n;
+  char c;
+
+  printf(1, "proclock test\n");
+  if(pipe(ok) < 0){
+    printf(1, "proclock: pipe failed\n");
+    exit();
+  }
+  for(w = 0; w < 3; w++){
+    if((pid = fork()) < 0){
+      printf(1, "proclock: fork failed\n");
+      exit();
+    }
+    if(pid)
+      continue;
+    close(ok[0]);
+    for(i = 0; i < 50; i++){
+      if(pipe(p) < 0)
+        exit();
+      if((pid = fork()) < 0)
+        exit();
+      if(pid == 0){
+        close(p[1]);
+        read(p[0], &c, 1);         // Sleeps until killed
+        exit();
+      }
+      close(p[0]);
+      if(i & 1)
+        sleep(1);
+      if(kill(pid) < 0 || wait() != pid)
+        exit();
+      close(p[1]);
+    }
+    write(ok[1], "x", 1);
+    exit();
+  }
+  close(ok[1]);
+  for(n = 0; read(ok[0], &c, 1) == 1; n++)
+    ;
+  close(ok[0]);
+  for(w = 0; w < 3; w++)
+    wait();
+  if(n != 3){
+    printf(1, "proclock: %d of 3 workers failed\n", 3 - n);
+    exit();
+  }
+  printf(1, "proclock test OK\n");
+}
+
+// A process may have far more than NOFILE0 descriptors open: its
+// table must grow, fork() must give the child all of them, and
+// dup2() must reach the last slot of the table but no further.
+void
+fdtabletest(void)
+{
+  static int dups[200];
+  int fds[2], i, n;
+  char c;
+
+  printf(1, "fdtable test\n");
+  if(pipe(fds) < 0){
+    printf(1, "fdtable: pipe failed\n");
+    exit();
+  }
+  for(i = 0; i < 200; i++){
+    if((dups[i] = dup(fds[1])) < 0){
+      printf(1, "fdtable: dup %d failed\n", i);
+      exit();
+    }
+  }
+  if(dups[199] < 200){
+    printf(1, "fdtable: last dup got fd %d\n", dups[199]);
+    exit();
+  }
+  if(dup2(fds[1], NOFILE-1) != NOFILE-1 || dup2(fds[1], NOFILE) >= 0){
+    printf(1, "fdtable: dup2 at the end of the table wrong\n");
+    exit();
+  }
+  if(fork() == 0){
+    write(dups[199], "x", 1);
+    exit();
+  }
+  wait();
+  for(i = 0; i < 200; i++)
+    close(dups[i]);
+  close(NOFILE-1);
+  close(fds[1]);
+  // The child wrote once; every write end is now closed.
+  for(n = 0; read(fds[0], &c, 1) == 1; n++)
+    ;
+  close(fds[0]);
+  if(n != 1){
+    printf(1, "fdtable: child wrote %d bytes, not 1\n", n);
+    exit();
+  }
+  printf(1, "fdtable test OK\n");
+}
+
+// writev() must gather its buffers in order and readv() scatter
+// them back; pread() and pwrite() must work at their offset and
+// leave the file offset where it was.
+void
+preadvtest(void)
+{
+  struct iovec iov[3];
+  char a[10], b[600], c[5];
+  int fd, i;
+
+  printf(1, "pread/readv test\n");
+  if((fd = open("prv", O_CREATE|O_RDWR)) < 0){
+    printf(1, "prv: create failed\n");
+    exit();
+  }
+  memset(a, 'a', sizeof(a));
+  memset(b, 'b', sizeof(b));
+  memset(c, 'c', sizeof(c));
+  iov[0].base = a;
+  iov[0].len = sizeof(a);
+  iov[1].base = b;
+  iov[1].len = sizeof(b);
+  iov[2].base = c;
+  iov[2].len = sizeof(c);
+  if(writev(fd, iov, 3) != 615){
+    printf(1, "prv: writev failed\n");
+    exit();
+  }
+  if(pwrite(fd, "XY", 2, 9) != 2 || pread(fd, buf, 3, 8) != 3 ||
+     buf[0] != 'a' || buf[1] != 'X' || buf[2] != 'Y'){
+    printf(1, "prv: pwrite/pread wrong\n");
+    exit();
+  }
+  // The offset is still at the end.
+  if(write(fd, "d", 1) != 1 || pread(fd, buf, 10, 612) != 4 || buf[2] != 'c' || buf[3] != 'd'){
+    printf(1, "prv: offset moved\n");
+    exit();
+  }
+  close(fd);
+
+  fd = open("prv", 0);
+  memset(a, 0, sizeof(a));
+  memset(b, 0, sizeof(b));
+  memset(c, 0, sizeof(c));
+  if(readv(fd, iov, 3) != 615){
+    printf(1, "prv: readv failed\n");
+    exit();
+  }
+  if(a[8] != 'a' || a[9] != 'X' || b[0] != 'Y' || c[0] != 'c' || c[4] != 'c')
+    goto bad;
+  for(i = 1; i < sizeof(b); i++)
+    if(b[i] != 'b')
+      goto bad;
+  if(read(fd, buf, 10) != 1 || buf[0] != 'd')
+    goto bad;
+  if(pread(fd, buf, 1, -1) >= 0){
+    printf(1, "prv: pread at -1 worked\n");
+    exit();
+  }
+  close(fd);
+  unlink("prv");
+  printf(1, "pread/readv test OK\n");
+  return;
+bad:
+  printf(1, "prv: readv data wrong\n");
+  exit();
+}
+
+// Unlinking big files hands their blocks to the reclaimer; doing
+// it over and over must neither lose the space nor disturb a file
+// written meanwhile.
+void
+reclaimtest(void)
+{
+  int fd, i, k;
+
+  printf(1, "reclaim test\n");
+  for(k = 0; k < 8; k++){
+    if((fd = open("reclaim", O_CREATE|O_RDWR)) < 0){
+      printf(1, "reclaim: create failed\n");
+      exit();
+    }
+    for(i = 0; i < 600; i++){
+      ((int*)buf)[0] = k*1000 + i;
+      if(write(fd, buf, 512) != 512){
+        printf(1, "reclaim: write failed, round %d\n", k);
+        exit();
+      }
+    }
+    close(fd);
+    fd = open("reclaim", 0);
+    for(i = 0; i < 600; i++){
+      if(read(fd, buf, 512) != 512 || ((int*)buf)[0] != k*1000 + i){
+        printf(1, "reclaim: bad block %d, round %d\n", i, k);
+        exit();
+      }
+    }
+    close(fd);
+    if(unlink("reclaim") < 0){
+      printf(1, "reclaim: unlink failed\n");
+      exit();
+    }
+  }
+  printf(1, "reclaim test OK\n");
+}
+
+// A file small enough to live in its inode must read back, grow
+// within the inode, and keep its bytes when it outgrows it.
+void
+inlinetest(void)
+{
+  struct stat st;
+  int fd, i;
+
+  printf(1, "inline test\n");
+  if((fd = open("inl", O_CREATE|O_RDWR)) < 0){
+    printf(1, "inline: create failed\n");
+    exit();
+  }
+  if(write(fd, "hello", 5) != 5 || write(fd, " world", 6) != 6){
+    printf(1, "inline: write failed\n");
+    exit();
+  }
+  close(fd);
+  fd = open("inl", O_RDWR);
+  buf[11] = 0;
+  if(read(fd, buf, sizeof(buf)) != 11 || strcmp(buf, "hello world") != 0){
+    printf(1, "inline: read back wrong\n");
+    exit();
+  }
+  // Grow it past the inode, a few bytes at a time.
+  for(i = 11; i < 1500; i++){
+    buf[0] = i;
+    if(write(fd, buf, 1) != 1){
+      printf(1, "inline: append failed\n");
+      exit();
+    }
+  }
+  close(fd);
+  fd = open("inl", 0);
+  if(fstat(fd, &st) < 0 || st.size != 1500){
+    printf(1, "inline: size %d\n", st.size);
+    exit();
+  }
+  if(read(fd, buf, 1500) != 1500 || buf[0] != 'h' || buf[10] != 'd'){
+    printf(1, "inline: lost the inline bytes\n");
+    exit();
+  }
+  for(i = 11; i < 1500; i++)
+    if((uchar)buf[i] != (uchar)i){
+      printf(1, "inline: byte %d wrong\n", i);
+      exit();
+    }
+  close(fd);
+  unlink("inl");
+  printf(1, "inline test OK\n");
+}
+
+// Small appends land in delayed blocks, so they must read back
+// before the flusher or fsync() has given them disk blocks, after
+// fsync() has, and past NDELAY of them, when a write must flush.
+// A file unlinked with delayed blocks must go away cleanly.
+void
+delayalloctest(void)
+{
+  int fd, i, j, n;
+
+  printf(1, "delayed allocation test\n");
+  if((fd = open("dalloc", O_CREATE|O_RDWR)) < 0){
+    printf(1, "dalloc: create failed\n");
+    exit();
+  }
+  for(i = 0; i < 400; i++){
+    memset(buf, 'a' + i%26, 100);
+    if(write(fd, buf, 100) != 100){
+      printf(1, "dalloc: write failed\n");
+      exit();
+    }
+  }
+  for(j = 0; j < 2; j++){
+    close(fd);
+    fd = open("dalloc", O_RDWR);
+    for(i = 0; i < 400; i++){
+      if(read(fd, buf, 100) != 100 || buf[0] != 'a' + i%26 || buf[99] != 'a' + i%26){
+        printf(1, "dalloc: bad data at %d, pass %d\n", i*100, j);
+        exit();
+      }
+    }
+    if(read(fd, buf, 1) != 0){
+      printf(1, "dalloc: file too long\n");
+      exit();
+    }
+    if(j == 0 && fsync(fd) != 0){
+      printf(1, "dalloc: fsync failed\n");
+      exit();
+    }
+  }
+  close(fd);
+  unlink("dalloc");
+
+  fd = open("dalloc", O_CREATE|O_RDWR);
+  for(i = 0; i < 10; i++)
+    write(fd, buf, 512);
+  unlink("dalloc");
+  close(fd);
+  if((fd = open("dalloc", 0)) >= 0){
+    printf(1, "dalloc: unlinked file still there\n");
+    exit();
+  }
+  n = fsync(1);
+  if(n != 0){
+    printf(1, "dalloc: fsync of the console failed\n");
+    exit();
+  }
+  printf(1, "delayed allocation test OK\n");
+}
+
+// Two files written a block at a time in turn, so that neither is
+// one contiguous run, then both removed and written again in the
+// blocks they freed: every block must read back as last written,
+// through bmap()'s cached runs.
+void
+bmapcachetest(void)
+{
+  char *names[] = { "bmc0", "bmc1" };
+  int fd[2], i, j, k;
+
+  printf(1, "bmap cache test\n");
+  for(k = 0; k < 3; k++){
+    for(j = 0; j < 2; j++)
+      if((fd[j] = open(names[j], O_CREATE|O_RDWR)) < 0){
+        printf(1, "bmap cache: create failed\n");
+        exit();
+      }
+    for(i = 0; i < 200; i++){
+      for(j = 0; j < 2; j++){
+        memset(buf, 'a' + 2*k + j, 512);
+        ((int*)buf)[0] = i;
+        if(write(fd[j], buf, 512) != 512){
+          printf(1, "bmap cache: write failed\n");
+          exit();
+        }
+      }
+    }
+    for(j = 0; j < 2; j++){
+      close(fd[j]);
+      fd[j] = open(names[j], 0);
+      for(i = 0; i < 200; i++){
+        if(read(fd[j], buf, 512) != 512 || ((int*)buf)[0] != i ||
+           buf[511] != 'a' + 2*k + j){
+          printf(1, "bmap cache: %s block %d wrong\n", names[j], i);
+          exit();
+        }
+      }
+      close(fd[j]);
+      unlink(names[j]);
+    }
+  }
+  printf(1, "bmap cache test OK\n");
+}
+
+// More inodes than NINODE in use at once, from several processes
+// holding files open, must not run the inode cache out.
+void
+icachetest(void)
+{
+  int i, j, fd, pid, up[2], down[2];
+  char name[5], c;
+
+  printf(1, "icache test\n");
+  name[0] = 'i';
+  name[1] = 'c';
+  name[4] = '\0';
+  for(i = 0; i < 60; i++){
+    name[2] = '0' + i/10;
+    name[3] = '0' + i%10;
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0){
+      printf(1, "icache: create failed\n");
+      exit();
+    }
+    close(fd);
+  }
+  if(pipe(up) < 0 || pipe(down) < 0){
+    printf(1, "icache: pipe failed\n");
+    exit();
+  }
+  for(i = 0; i < 6; i++){
+    if((pid = fork()) < 0){
+      printf(1, "icache: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      close(up[0]);
+      close(down[1]);
+      for(j = 0; j < 10; j++){
+        name[2] = '0' + (i*10 + j)/10;
+        name[3] = '0' + (i*10 + j)%10;
+        if(open(name, O_RDWR) < 0){
+          printf(1, "icache: open %s failed\n", name);
+          exit();
+        }
+      }
+      write(up[1], "x", 1);
+      read(down[0], &c, 1);
+      exit();
+    }
+  }
+  close(up[1]);
+  close(down[0]);
+  for(i = 0; i < 6; i++)
+    if(read(up[0], &c, 1) != 1){
+      printf(1, "icache: child failed\n");
+      exit();
+    }
+  close(down[1]);
+  close(up[0]);
+  for(i = 0; i < 6; i++)
+    wait();
+  for(i = 0; i < 60; i++){
+    name[2] = '0' + i/10;
+    name[3] = '0' + i%10;
+    unlink(name);
+  }
+  printf(1, "icache test OK\n");
+}
+
+// A directory grown well past one block is hashed into buckets;
+// every name must still be found, listed once by a plain read of
+// the directory, and removable, and the emptied directory too.
+void
+hashdirtest(void)
+{
+  struct dirent de;
+  char name[8];
+  int fd, i, n;
+
+  printf(1, "hashdir test\n");
+  if(mkdir("hd") < 0){
+    printf(1, "hashdir: mkdir failed\n");
+    exit();
+  }
+  name[0] = 'h';
+  name[1] = 'd';
+  name[2] = '/';
+  name[6] = '\0';
+  for(i = 0; i < 300; i++){
+    name[3] = 'a' + i/100;
+    name[4] = '0' + (i/10)%10;
+    name[5] = '0' + i%10;
+    if((fd = open(name, O_CREATE|O_RDWR)) < 0){
+      printf(1, "hashdir: create %s failed\n", name);
+      exit();
+    }
+    close(fd);
+  }
+  for(i = 0; i < 300; i++){
+    name[3] = 'a' + i/100;
+    name[4] = '0' + (i/10)%10;
+    name[5] = '0' + i%10;
+    if((fd = open(name, 0)) < 0){
+      printf(1, "hashdir: %s not found\n", name);
+      exit();
+    }
+    close(fd);
+    if(i%2 == 0 && unlink(name) < 0){
+      printf(1, "hashdir: unlink %s failed\n", name);
+      exit();
+    }
+  }
+  fd = open("hd", 0);
+  n = 0;
+  while(read(fd, &de, sizeof(de)) == sizeof(de))
+    if(de.inum != 0)
+      n++;
+  close(fd);
+  if(n != 150 + 2){
+    printf(1, "hashdir: %d entries listed\n", n);
+    exit();
+  }
+  if(unlink("hd") == 0){
+    printf(1, "hashdir: unlinked a non-empty directory\n");
+    exit();
+  }
+  for(i = 1; i < 300; i += 2){
+    name[3] = 'a' + i/100;
+    name[4] = '0' + (i/10)%10;
+    name[5] = '0' + i%10;
+    if(unlink(name) < 0 || open(name, 0) >= 0){
+      printf(1, "hashdir: unlink %s failed\n", name);
+      exit();
+    }
+  }
+  if(unlink("hd") < 0){
+    printf(1, "hashdir: unlink hd failed\n");
+    exit();
+  }
+  printf(1, "hashdir test OK\n");
+}
+
+// An extent-mapped file grown in runs, closed (which gives back
+// the blocks allocated ahead) and grown again after reopening must
+// read back intact, through all of its extents.
+void
+extenttest(void)
+{
+  int fd, i, j, n, pass;
+
+  printf(1, "extent test\n");
+  unlink("extent");
+  for(pass = 0; pass < 3; pass++){
+    if((fd = open("extent", O_CREATE|O_RDWR)) < 0){
+      printf(1, "extent: open failed\n");
+      exit();
+    }
+    // Skip to the end.
+    for(n = 0; (i = read(fd, buf, 1000)) > 0; n += i)
+      ;
+    if(n != pass*100*1000){
+      printf(1, "extent: file is %d bytes after pass %d\n", n, pass);
+      exit();
+    }
+    for(i = 0; i < 100; i++){
+      for(j = 0; j < 1000; j++)
+        buf[j] = (n + j) % 253;
+      if(write(fd, buf, 1000) != 1000){
+        printf(1, "extent: write failed\n");
+        exit();
+      }
+      n += 1000;
+    }
+    close(fd);
+  }
+  if((fd = open("extent", 0)) < 0){
+    printf(1, "extent: open failed\n");
+    exit();
+  }
+  for(n = 0; (i = read(fd, buf, 777)) > 0; n += i)
+    for(j = 0; j < i; j++)
+      if(buf[j] != (char)((n + j) % 253)){
+        printf(1, "extent: bad data at %d\n", n + j);
+        exit();
+      }
+  close(fd);
+  if(n != 300*1000){
+    printf(1, "extent: read %d bytes\n", n);
+    exit();
+  }
+  unlink("extent");
+  printf(1, "extent test OK\n");
+}
+
+void
+bigfile(void)
+{
+  int fd, i, total, cc;
+
+  printf(1, "bigfile test\n");
+
+  unlink("bigfile");
+  fd = open("bigfile", O_CREATE | O_RDWR);
+  if(fd < 0){
+    printf(1, "cannot create bigfile");
+    exit();
+  }
+  for(i = 0; i < 20; i++){
+    memset(buf, i, 600);
+    if(write(fd, buf, 600) != 600){
+      printf(1, "write bigfile failed\n");
+      exit();
+    }
+  }
+  close(fd);
+
+  fd = open("bigfile", 0);
+  if(fd < 0){
+    printf(1, "cannot open bigfile\n");
+    exit();
+  }
+  total = 0;
+  for(i = 0; ; i++){
+    cc = read(fd, buf, 300);
+    if(cc < 0){
+      printf(1, "read bigfile failed\n");
+      exit();
+    }
+    if(cc == 0)
+      break;
+    if(cc != 300){
+      printf(1, "short read bigfile\n");
+      exit();
+    }
+    if(buf[0] != i/2 || buf[299] != i/2){
+      printf(1, "read bigfile wrong data\n");
+      exit();
+    }
+    total += cc;
+  }
+  close(fd);
+  if(total != 20*600){
+    printf(1, "read bigfile wrong total\n");
+    exit();
+  }
+  unlink("bigfile");
+
+  printf(1, "bigfile test ok\n");
+}
+
+void
+fourteen(void)
+{
+  int fd;
+
+  // DIRSIZ is 14.
+  printf(1, "fourteen test\n");
+
+  if(mkdir("12345678901234") != 0){
+    printf(1, "mkdir 12345678901234 failed\n");
+    exit();
+  }
+  if(mkdir("12345678901234/123456789012345") != 0){
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    exit();
+  }
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+  if(fd < 0){
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    exit();
+  }
+  close(fd);
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+  if(fd < 0){
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    exit();
+  }
+  close(fd);
+
+  if(mkdir("12345678901234/12345678901234") == 0){
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    exit();
+  }
+  if(mkdir("123456789012345/12345678901234") == 0){
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    exit();
+  }
+
+  printf(1, "fourteen ok\n");
+}
+
+void
+rmdot(void)
+{
+  printf(1, "rmdot test\n");
+  if(mkdir("dots") != 0){
+    printf(1, "mkdir dots failed\n");
+    exit();
+  }
+  if(chdir("dots") != 0){
+    printf(1, "chdir dots failed\n");
+    exit();
+  }
+  if(unlink(".") == 0){
+    printf(1, "rm . worked!\n");
+    exit();
+  }
+  if(unlink("..") == 0){
+    printf(1, "rm .. worked!\n");
+    exit();
+  }
+  if(chdir("/") != 0){
+    printf(1, "chdir / failed\n");
+    exit();
+  }
+  if(unlink("dots/.") == 0){
+    printf(1, "unlink dots/. worked!\n");
+    exit();
+  }
+  if(unlink("dots/..") == 0){
+    printf(1, "unlink dots/.. worked!\n");
+    exit();
+  }
+  if(unlink("dots") != 0){
+    printf(1, "unlink dots failed!\n");
+    exit();
+  }
+  printf(1, "rmdot ok\n");
+}
+
+void
+dirfile(void)
+{
+  int fd;
+
+  printf(1, "dir vs file\n");
+
+  fd = open("dirfile", O_CREATE);
+  if(fd < 0){
+    printf(1, "create dirfile failed\n");
+    exit();
+  }
+  close(fd);
+  if(chdir("dirfile") == 0){
+    printf(1, "chdir dirfile succeeded!\n");
+    exit();
+  }
+  fd = open("dirfile/xx", 0);
+  if(fd >= 0){
+    printf(1, "create dirfile/xx succeeded!\n");
+    exit();
+  }
+  fd = open("dirfile/xx", O_CREATE);
+  if(fd >= 0){
+    printf(1, "create dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(mkdir("dirfile/xx") == 0){
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(unlink("dirfile/xx") == 0){
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(link("README", "dirfile/xx") == 0){
+    printf(1, "link to dirfile/xx succeeded!\n");
+    exit();
+  }
+  if(unlink("dirfile") != 0){
+    printf(1, "unlink dirfile failed!\n");
+    exit();
+  }
+
+  fd = open(".", O_RDWR);
+  if(fd >= 0){
+    printf(1, "open . for writing succeeded!\n");
+    exit();
+  }
+  fd = open(".", 0);
+  if(write(fd, "x", 1) > 0){
+    printf(1, "write . succeeded!\n");
+    exit();
+  }
+  close(fd);
+
+  printf(1, "dir vs file OK\n");
+}
+
+// test that iput() is called at the end of _namei()
+void
+iref(void)
+{
+  int i, fd;
+
+  printf(1, "empty file name\n");
+
+  // the 50 is NINODE
+  for(i = 0; i < 50 + 1; i++){
+    if(mkdir("irefd") != 0){
+      printf(1, "mkdir irefd failed\n");
+      exit();
+    }
+    if(chdir("irefd") != 0){
+      printf(1, "chdir irefd failed\n");
+      exit();
+    }
+
+    mkdir("");
+    link("README", "");
+    fd = open("", O_CREATE);
+    if(fd >= 0)
+      close(fd);
+    fd = open("xx", O_CREATE);
+    if(fd >= 0)
+      close(fd);
+    unlink("xx");
+  }
+
+  chdir("/");
+  printf(1, "empty file name OK\n");
+}
+
+// test that fork fails gracefully
+// the forktest binary also does this, but it runs out of proc entries first.
+// inside the bigger usertests binary, we run out of memory first.
+void
+forktest(void)
+{
+  int n, pid;
+
+  printf(1, "fork test\n");
+
+  for(n=0; n<1000; n++){
+    pid = fork();
+    if(pid < 0)
+      break;
+    if(pid == 0)
+      exit();
+  }
+
+  if(n == 1000){
+    printf(1, "fork claimed to work 1000 times!\n");
+    exit();
+  }
+
+  for(; n > 0; n--){
+    if(wait() < 0){
+      printf(1, "wait stopped early\n");
+      exit();
+    }
+  }
+
+  if(wait() != -1){
+    printf(1, "wait got too many\n");
+    exit();
+  }
+
+  printf(1, "fork test OK\n");
+}
+
+// parent and child share pages copy-on-write after fork;
+// each side must see only its own writes, including writes
+// the kernel makes on its behalf (read() into a shared page).
+void
+cowtest(void)
+{
+  static char buf[3*4096];
+  int fds[2], pid, i;
+
+  printf(1, "cow test\n");
+
+  for(i = 0; i < sizeof(buf); i++)
+    buf[i] = 'a';
+  if(pipe(fds) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    if(read(fds[0], buf+4096, 1) != 1 || buf[4096] != 'x'){
+      printf(1, "cow: child read failed\n");
+      exit();
+    }
+    buf[0] = 'c';
+    buf[2*4096] = 'c';
+    exit();
+  }
+  buf[0] = 'p';
+  if(write(fds[1], "x", 1) != 1){
+    printf(1, "cow: write failed\n");
+    exit();
+  }
+  wait();
+  close(fds[0]);
+  close(fds[1]);
+  if(buf[0] != 'p' || buf[4096] != 'a' || buf[2*4096] != 'a'){
+    printf(1, "cow: child write visible in parent\n");
+    exit();
+  }
+  printf(1, "cow test OK\n");
+}
+
+// touch a big lazily allocated heap in order with fault-around
+// on; every page must read back as zero and keep what we write.
+void
+faultaroundtest(void)
+{
+  char *a;
+  int i, old;
+  uint f0[NFAULT], f1[NFAULT];
+
+  printf(1, "faultaround test\n");
+
+  old = faultaround(16);
+  if(faultaround(0) != 16 || faultaround(10000) != 16 || faultaround(0) > 64){
+    printf(1, "faultaround setting wrong\n");
+    exit();
+  }
+  faultaround(16);
+  if(faultstat(-1, f0) < 0){
+    printf(1, "faultstat failed\n");
+    exit();
+  }
+  a = sbrk(1024*1024);
+  if(a == (char*)-1){
+    printf(1, "sbrk failed\n");
+    exit();
+  }
+  for(i = 0; i < 1024*1024; i += 4096){
+    if(a[i] != 0 || a[i+4095] != 0){
+      printf(1, "faultaround: page %d not zero\n", i/4096);
+      exit();
+    }
+    a[i] = i/4096;
+  }
+  for(i = 0; i < 1024*1024; i += 4096){
+    if(a[i] != (char)(i/4096)){
+      printf(1, "faultaround: page %d lost its data\n", i/4096);
+      exit();
+    }
+  }
+  faultstat(-1, f1);
+  // reads map the zero page 16 pages at a time; each write then
+  // takes its own copy-on-write fault.
+  if(f1[FAULT_ZERO] - f0[FAULT_ZERO] >= 256 || f1[FAULT_COW] - f0[FAULT_COW] < 256){
+    printf(1, "faultaround: unexpected fault counts zero %d cow %d\n",
+           f1[FAULT_ZERO] - f0[FAULT_ZERO], f1[FAULT_COW] - f0[FAULT_COW]);
+    exit();
+  }
+  sbrk(-1024*1024);
+  faultaround(old);
+  printf(1, "faultaround test OK\n");
+}
+
+// setpriority()/getpriority() levels, inherited by fork(); a
+// CPU-bound child must not drop above the lowest level.
+void
+prioritytest(void)
+{
+  int pid, i, prio;
+
+  printf(1, "priority test\n");
+
+  pid = getpid();
+  if(setpriority(pid, -1) != -1 || setpriority(pid, NPRIO) != -1 ||
+     setpriority(-1, 0) != -1 || getpriority(-1) != -1){
+    printf(1, "priority: bad arguments accepted\n");
+    exit();
+  }
+  if(setpriority(pid, 1) != 0 || getpriority(pid) < 1){
+    printf(1, "priority: setpriority failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    prio = getpriority(getpid());
+    if(prio < 1 || prio >= NPRIO){
+      printf(1, "priority: child has level %d\n", prio);
+      exit();
+    }
+    for(i = 0; i < 100000; i++)
+      if(getpriority(getpid()) < 1)
+        break;
+    if(i < 100000)
+      printf(1, "priority: child rose above its base level\n");
+    exit();
+  }
+  wait();
+  setpriority(getpid(), 0);
+  if(getpriority(getpid()) != 0){
+    printf(1, "priority: reset failed\n");
+    exit();
+  }
+  printf(1, "priority test OK\n");
+}
+
+// setaffinity() must keep a mask, refuse an empty one, and be
+// inherited across fork().
+void
+affinitytest(void)
+{
+  int all, pid;
+
+  printf(1, "affinity test\n");
+  all = getaffinity(getpid());
+  if(all <= 0 || setaffinity(getpid(), 0) != -1){
+    printf(1, "affinity: bad default or empty mask accepted\n");
+    exit();
+  }
+  if(setaffinity(getpid(), 1) != 0 || getaffinity(getpid()) != 1){
+    printf(1, "affinity: pin to cpu 0 failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid == 0){
+    if(getaffinity(getpid()) != 1)
+      printf(1, "affinity: child did not inherit the mask\n");
+    exit();
+  }
+  wait();
+  if(setaffinity(getpid(), ~0) != 0 || getaffinity(getpid()) != all){
+    printf(1, "affinity: unpin failed\n");
+    exit();
+  }
+  printf(1, "affinity test OK\n");
+}
+
+// clock_gettime() and the clock page must agree, move forward,
+// and see a sleep of two ticks.
+void
+clocktest(void)
+{
+  struct timespec a, b, c;
+  uint ms;
+
+  printf(1, "clock test\n");
+  if(clock_gettime(CLOCK_MONOTONIC, &a) < 0 || clock_gettime(7, &a) != -1){
+    printf(1, "clock: clock_gettime failed\n");
+    exit();
+  }
+  clock_gettime(CLOCK_MONOTONIC, &a);
+  vclock_gettime(CLOCK_MONOTONIC, &b);
+  sleep(2);
+  clock_gettime(CLOCK_MONOTONIC, &c);
+  if(b.tv_sec < a.tv_sec || (b.tv_sec == a.tv_sec && b.tv_nsec < a.tv_nsec)){
+    printf(1, "clock: clock page behind the system call\n");
+    exit();
+  }
+  ms = (c.tv_sec - b.tv_sec)*1000 + c.tv_nsec/1000000 - b.tv_nsec/1000000;
+  if(ms < 10 || ms > 5000 || b.tv_nsec >= 1000000000){
+    printf(1, "clock: sleep(2) took %d ms\n", ms);
+    exit();
+  }
+  vclock_gettime(CLOCK_REALTIME, &a);
+  if(a.tv_sec < 1500000000){
+    printf(1, "clock: realtime %d is before 2017\n", a.tv_sec);
+    exit();
+  }
+  printf(1, "clock test OK\n");
+}
+
+static uint
+msince(struct timespec *a)
+{
+  struct timespec b;
+
+  vclock_gettime(CLOCK_MONOTONIC, &b);
+  return (b.tv_sec - a->tv_sec)*1000 + b.tv_nsec/1000000 - a->tv_nsec/1000000;
+}
+
+// msleep() must sleep at least as long as asked, and to better
+// than a tick; sleepers with different deadlines must each wake
+// after their own.
+void
+msleeptest(void)
+{
+  struct timespec a;
+  int i, pid;
+  uint ms;
+
+  printf(1, "msleep test\n");
+  if(msleep(-1) != -1){
+    printf(1, "msleep: negative sleep accepted\n");
+    exit();
+  }
+  vclock_gettime(CLOCK_MONOTONIC, &a);
+  msleep(3);
+  if((ms = msince(&a)) < 3){
+    printf(1, "msleep: msleep(3) took %d ms\n", ms);
+    exit();
+  }
+  vclock_gettime(CLOCK_MONOTONIC, &a);
+  for(i = 0; i < 20; i++)
+    msleep(1);
+  // At a tick's resolution this takes 200ms.
+  if((ms = msince(&a)) < 20 || ms >= 150){
+    printf(1, "msleep: 20 msleep(1) took %d ms\n", ms);
+    exit();
+  }
+
+  vclock_gettime(CLOCK_MONOTONIC, &a);
+  for(i = 0; i < 8; i++){
+    if((pid = fork()) < 0){
+      printf(1, "msleep: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      msleep(5 + 7*i);
+      if((ms = msince(&a)) < 5 + 7*i){
+        printf(1, "msleep: sleeper %d woke after %d ms\n", i, ms);
+        exit();
+      }
+      exit();
+    }
+  }
+  for(i = 0; i < 8; i++)
+    wait();
+  printf(1, "msleep test OK\n");
+}
+
+// Readers of the same file and directory share the inode lock;
+// they must all see the whole file while another process keeps
+// creating and removing entries in the directory.
+void
+sharedreadtest(void)
+{
+  struct stat st;
+  char buf[512];
+  int i, j, n, fd, tot, pid;
+
+  printf(1, "shared read test\n");
+  if(stat("README", &st) < 0){
+    printf(1, "sharedread: stat README failed\n");
+    exit();
+  }
+  for(i = 0; i < 5; i++){
+    if((pid = fork()) < 0){
+      printf(1, "sharedread: fork failed\n");
+      exit();
+    }
+    if(pid > 0)
+      continue;
+    for(j = 0; j < 20; j++){
+      if(i == 0){
+        // The writer.
+        if((fd = open("/srtmp", O_CREATE|O_RDWR)) < 0){
+          printf(1, "sharedread: create failed\n");
+          exit();
+        }
+        write(fd, "x", 1);
+        close(fd);
+        unlink("/srtmp");
+        continue;
+      }
+      if((fd = open("/README", 0)) < 0){
+        printf(1, "sharedread: open README failed\n");
+        exit();
+      }
+      for(tot = 0; (n = read(fd, buf, sizeof(buf))) > 0; tot += n)
+        ;
+      close(fd);
+      if(tot != st.size){
+        printf(1, "sharedread: read %d of %d bytes\n", tot, st.size);
+        exit();
+      }
+    }
+    exit();
+  }
+  for(i = 0; i < 5; i++)
+    wait();
+  printf(1, "shared read test OK\n");
+}
+
+// Sequential reads, which trigger read-ahead, and reads that
+// jump around must both return what was written.
+void
+readaheadtest(void)
+{
+  char buf[300];
+  int fd, i, j, n, off;
+
+  printf(1, "readahead test\n");
+  if((fd = open("readahead", O_CREATE|O_RDWR)) < 0){
+    printf(1, "readahead: create failed\n");
+    exit();
+  }
+  for(i = 0; i < 100; i++){
+    for(j = 0; j < sizeof(buf); j++)
+      buf[j] = i + j;
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+      printf(1, "readahead: write failed\n");
+      exit();
+    }
+  }
+  close(fd);
+  for(off = 0; off < 2; off++){
+    if((fd = open("readahead", 0)) < 0){
+      printf(1, "readahead: open failed\n");
+      exit();
+    }
+    for(i = 0; i < 100; i++){
+      // The second time round, skip every other record.
+      if(off && (i & 1)){
+        if(read(fd, buf, 17) != 17 || read(fd, buf, sizeof(buf) - 17) < 0){
+          printf(1, "readahead: read failed\n");
+          exit();
+        }
+        continue;
+      }
+      if((n = read(fd, buf, sizeof(buf))) != sizeof(buf)){
+        printf(1, "readahead: read %d at record %d\n", n, i);
+        exit();
+      }
+      for(j = 0; j < sizeof(buf); j++)
+        if(buf[j] != (char)(i + j)){
+          printf(1, "readahead: bad data in record %d\n", i);
+          exit();
+        }
+    }
+    close(fd);
+  }
+  unlink("readahead");
+  printf(1, "readahead test OK\n");
+}
+
+// Small file operations from several processes at once, which the
+// log flusher commits in groups; the flusher itself is a process
+// that cannot be killed.
+void
+groupcommittest(void)
+{
+  struct procinfo pi;
+  char file[4];
+  int fd, i, j, pid, flusher;
+
+  printf(1, "group commit test\n");
+  flusher = -1;
+  for(i = 0; getprocinfo(i, &pi) == 0; i++)
+    if(strcmp(pi.name, "logflush") == 0)
+      flusher = pi.pid;
+  if(flusher < 0 || kill(flusher) != -1){
+    printf(1, "groupcommit: no log flusher, or it can be killed\n");
+    exit();
+  }
+  for(i = 0; i < 4; i++){
+    if((pid = fork()) < 0){
+      printf(1, "groupcommit: fork failed\n");
+      exit();
+    }
+    if(pid)
+      continue;
+    file[0] = 'g';
+    file[1] = '0' + i;
+    file[3] = 0;
+    for(j = 0; j < 20; j++){
+      file[2] = 'a' + j;
+      if((fd = open(file, O_CREATE|O_RDWR)) < 0 || write(fd, file, 4) != 4){
+        printf(1, "groupcommit: create %s failed\n", file);
+        exit();
+      }
+      close(fd);
+    }
+    for(j = 0; j < 20; j++){
+      file[2] = 'a' + j;
+      if((fd = open(file, 0)) < 0 || read(fd, buf, 4) != 4 ||
+         strcmp(buf, file) != 0){
+        printf(1, "groupcommit: %s lost its data\n", file);
+        exit();
+      }
+      close(fd);
+      if(unlink(file) < 0){
+        printf(1, "groupcommit: unlink %s failed\n", file);
+        exit();
+      }
+    }
+    exit();
+  }
+  for(i = 0; i < 4; i++)
+    wait();
+  printf(1, "group commit test OK\n");
+}
+
+// Several processes writing and reading back their own files at
+// once, under each I/O scheduler, must see their own data, and
+// the disk must have been sent at least one request.
+void
+ioschedtest(void)
+{
+  static char *scheds[] = { "fifo", "clook" };
+  struct iostat st;
+  char file[3];
+  int fd, i, j, k, pid;
+
+  printf(1, "iosched test\n");
+  if(iostat("nosuch", &st) >= 0){
+    printf(1, "iosched: unknown scheduler accepted\n");
+    exit();
+  }
+  for(k = 0; k < 2; k++){
+    if(iostat(scheds[k], &st) < 0 || strcmp(st.sched, scheds[k]) != 0){
+      printf(1, "iosched: cannot switch to %s\n", scheds[k]);
+      exit();
+    }
+    for(i = 0; i < 4; i++){
+      if((pid = fork()) < 0){
+        printf(1, "iosched: fork failed\n");
+        exit();
+      }
+      if(pid)
+        continue;
+      file[0] = 'q';
+      file[1] = '0' + i;
+      file[2] = 0;
+      if((fd = open(file, O_CREATE|O_RDWR)) < 0){
+        printf(1, "iosched: create failed\n");
+        exit();
+      }
+      memset(buf, 'a' + i, 512);
+      for(j = 0; j < 20; j++)
+        if(write(fd, buf, 512) != 512){
+          printf(1, "iosched: write failed\n");
+          exit();
+        }
+      close(fd);
+      if((fd = open(file, 0)) < 0){
+        printf(1, "iosched: open failed\n");
+        exit();
+      }
+      for(j = 0; j < 20; j++)
+        if(read(fd, buf, 512) != 512 || buf[0] != 'a' + i || buf[511] != 'a' + i){
+          printf(1, "iosched: bad data\n");
+          exit();
+        }
+      close(fd);
+      unlink(file);
+      exit();
+    }
+    for(i = 0; i < 4; i++)
+      wait();
+    iostat(0, &st);
+    if(st.nreq == 0 || st.nblk < st.nreq){
+      printf(1, "iosched: %s sent %d requests for %d blocks\n",
+             st.sched, st.nreq, st.nblk);
+      exit();
+    }
+  }
+  printf(1, "iosched test OK\n");
+}
+
+// Reading more distinct blocks than the boot-time buffers hold
+// must grow the buffer cache (memory is plentiful here), and a
+// second pass over them must then mostly hit.
+void
+bcachetest(void)
+{
+  struct bstat st0, st1, st2;
+  char buf[512];
+  int fd, i;
+
+  printf(1, "bcache test\n");
+  if((fd = open("bcache", O_CREATE|O_RDWR)) < 0){
+    printf(1, "bcache: create failed\n");
+    exit();
+  }
+  memset(buf, 'b', sizeof(buf));
+  for(i = 0; i < 4*MAXOPBLOCKS*3; i++)
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+      printf(1, "bcache: write failed\n");
+      exit();
+    }
+  close(fd);
+  bstat(&st0);
+  for(i = 0; i < 2; i++){
+    if((fd = open("bcache", 0)) < 0){
+      printf(1, "bcache: open failed\n");
+      exit();
+    }
+    while(read(fd, buf, sizeof(buf)) > 0)
+      ;
+    close(fd);
+    bstat(i == 0 ? &st1 : &st2);
+  }
+  unlink("bcache");
+  if(st2.nbuf <= MAXOPBLOCKS*3 || st2.nfree > st2.nbuf || st1.hits < st0.hits){
+    printf(1, "bcache: %d buffers, %d free\n", st2.nbuf, st2.nfree);
+    exit();
+  }
+  if(st2.misses - st1.misses > (st1.misses - st0.misses) / 2 + 2){
+    printf(1, "bcache: second pass missed %d times\n", st2.misses - st1.misses);
+    exit();
+  }
+  printf(1, "bcache test OK\n");
+}
+
+// Counters of the lock named name, summed over all locks of
+// that name.
+static void
+lockcounts(char *name, struct lockstat *sum)
+{
+  struct lockstat ls;
+  int i;
+
+  memset(sum, 0, sizeof(*sum));
+  for(i = 0; lockstat(i, &ls) == 0; i++)
+    if(strcmp(ls.name, name) == 0){
+      sum->nacq += ls.nacq;
+      sum->ncontend += ls.ncontend;
+    }
+}
+
+// lockstat must count acquisitions of the inode cache lock, and a
+// reset must zero them.
+void
+lockstattest(void)
+{
+  struct lockstat ls;
+  int i, fd;
+
+  printf(1, "lockstat test\n");
+  if(lockstat(-1, 0) != 0){
+    printf(1, "lockstat: reset failed\n");
+    exit();
+  }
+  lockcounts("icache", &ls);
+  if(ls.nacq > 10){
+    printf(1, "lockstat: %d icache acquisitions after a reset\n", ls.nacq);
+    exit();
+  }
+  for(i = 0; i < 100; i++){
+    if((fd = open("README", 0)) < 0){
+      printf(1, "lockstat: open README failed\n");
+      exit();
+    }
+    close(fd);
+  }
+  lockcounts("icache", &ls);
+  if(ls.nacq < 200 || ls.ncontend > ls.nacq){
+    printf(1, "lockstat: icache acquired %d times, %d contended\n",
+           ls.nacq, ls.ncontend);
+    exit();
+  }
+  if(lockstat(100000, &ls) != -1){
+    printf(1, "lockstat: lock 100000 exists\n");
+    exit();
+  }
+  printf(1, "lockstat test OK\n");
+}
+
+// getprocinfo must report this process and count the sleeps of
+// a child that waits on a pipe.
+void
+procinfotest(void)
+{
+  struct procinfo pi;
+  int i, pid, fds[2];
+  char c;
+
+  printf(1, "procinfo test\n");
+  if(pipe(fds) != 0){
+    printf(1, "procinfo: pipe failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid == 0){
+    read(fds[0], &c, 1);
+    exit();
+  }
+  sleep(2);
+  for(i = 0; getprocinfo(i, &pi) == 0; i++)
+    if(pi.pid == pid)
+      break;
+  write(fds[1], "x", 1);
+  wait();
+  close(fds[0]);
+  close(fds[1]);
+  if(pi.pid != pid || pi.ppid != getpid() || pi.nvcsw == 0){
+    printf(1, "procinfo: child not reported\n");
+    exit();
+  }
+  if(getprocinfo(NPROC, &pi) != -1){
+    printf(1, "procinfo: past the last process\n");
     exit();
   }
-  unlink("bigfile");
-
-  printf(1, "bigfile test ok\n");
+  printf(1, "procinfo test OK\n");
 }
 
-void
-fourteen(void)
+// Threads made with thread_create() share memory: they add to a
+// counter under a lock, grow the heap with sbrk() and write to a
+// page the creator has mapped read-only (the zero page), and the
+// creator must see all of it.  wait() must not reap them.
+static lock_t tlock;
+static volatile int tcount, tgo;
+static volatile char *tpage;
+
+static void
+threadwork(void *arg)
 {
-  int fd;
+  int i;
+  char *p;
 
-  // DIRSIZ is 14.
-  printf(1, "fourteen test\n");
+  while(!tgo)
+    ;
+  for(i = 0; i < 1000; i++){
+    lock_acquire(&tlock);
+    tcount++;
+    lock_release(&tlock);
+  }
+  p = sbrk(4096);
+  if(p != (char*)-1)
+    p[0] = 1;
+  if((int)arg == 0)
+    tpage[0] = 'x';
+  exit();
+}
 
-  if(mkdir("12345678901234") != 0){
-    printf(1, "mkdir 12345678901234 failed\n");
-    exit();
+void
+threadtest(void)
+{
+  int i, n;
+  char c;
+
+  printf(1, "thread test\n");
+  lock_init(&tlock);
+  tcount = tgo = 0;
+  tpage = sbrk(4096);
+  c = tpage[0];
+  for(i = 0; i < 4; i++){
+    if(thread_create(threadwork, (void*)i) < 0){
+      printf(1, "thread: thread_create failed\n");
+      exit();
+    }
   }
-  if(mkdir("12345678901234/123456789012345") != 0){
-    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+  if(wait() != -1){
+    printf(1, "thread: wait() reaped a thread\n");
     exit();
   }
-  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
-  if(fd < 0){
-    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+  tgo = 1;
+  for(n = 0; thread_join() > 0; n++)
+    ;
+  if(n != 4 || tcount != 4000){
+    printf(1, "thread: joined %d, count %d\n", n, tcount);
     exit();
   }
-  close(fd);
-  fd = open("12345678901234/12345678901234/12345678901234", 0);
-  if(fd < 0){
-    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+  if(c != 0 || tpage[0] != 'x'){
+    printf(1, "thread: write to shared page lost\n");
     exit();
   }
-  close(fd);
+  printf(1, "thread test OK\n");
+}
 
-  if(mkdir("12345678901234/12345678901234") == 0){
-    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+// A producer and a consumer thread hand items over through a
+// one-slot buffer under a mutex and two condition variables.
+static mutex_t fmutex;
+static cond_t fnotempty, fnotfull;
+static volatile int fslot, fsum;
+
+static void
+fconsumer(void *arg)
+{
+  int i;
+
+  for(i = 0; i < 200; i++){
+    mutex_lock(&fmutex);
+    while(fslot == 0)
+      cond_wait(&fnotempty, &fmutex);
+    fsum += fslot;
+    fslot = 0;
+    cond_signal(&fnotfull);
+    mutex_unlock(&fmutex);
+  }
+  exit();
+}
+
+void
+futextest(void)
+{
+  volatile uint word;
+  int i;
+
+  printf(1, "futex test\n");
+  word = 1;
+  if(futex_wait(&word, 0) != -1){
+    printf(1, "futex: wait on a changed word slept\n");
     exit();
   }
-  if(mkdir("123456789012345/12345678901234") == 0){
-    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+  if(futex_wake(&word, 1) != 0){
+    printf(1, "futex: woke a waiter that was not there\n");
     exit();
   }
 
-  printf(1, "fourteen ok\n");
+  mutex_init(&fmutex);
+  cond_init(&fnotempty);
+  cond_init(&fnotfull);
+  fslot = fsum = 0;
+  if(thread_create(fconsumer, 0) < 0){
+    printf(1, "futex: thread_create failed\n");
+    exit();
+  }
+  for(i = 1; i <= 200; i++){
+    mutex_lock(&fmutex);
+    while(fslot != 0)
+      cond_wait(&fnotfull, &fmutex);
+    fslot = i;
+    cond_signal(&fnotempty);
+    mutex_unlock(&fmutex);
+  }
+  thread_join();
+  if(fsum != 200*201/2){
+    printf(1, "futex: sum %d\n", fsum);
+    exit();
+  }
+  printf(1, "futex test OK\n");
 }
 
+// back an 8MB heap range with 4MB pages: it must fault only once
+// per large page, be copied on write after fork(), and survive
+// being shrunk to the middle of a large page.
 void
-rmdot(void)
+largepagetest(void)
 {
-  printf(1, "rmdot test\n");
-  if(mkdir("dots") != 0){
-    printf(1, "mkdir dots failed\n");
+  char *a, *base;
+  int i, old, pid;
+  uint pad, f0[NFAULT], f1[NFAULT];
+
+  printf(1, "largepage test\n");
+
+  old = largepages(1);
+  if(largepages(-1) != 1){
+    printf(1, "largepages setting wrong\n");
     exit();
   }
-  if(chdir("dots") != 0){
-    printf(1, "chdir dots failed\n");
+  a = sbrk(0);
+  pad = (4*1024*1024 - (uint)a % (4*1024*1024)) % (4*1024*1024);
+  if(sbrk(pad + 8*1024*1024) == (char*)-1){
+    printf(1, "sbrk failed\n");
     exit();
   }
-  if(unlink(".") == 0){
-    printf(1, "rm . worked!\n");
+  base = a + pad;
+  faultstat(-1, f0);
+  for(i = 0; i < 8*1024*1024; i += 4096)
+    base[i] = i/4096;
+  faultstat(-1, f1);
+  if(f1[FAULT_HEAP] - f0[FAULT_HEAP] > 2){
+    printf(1, "largepage: %d heap faults for 8MB\n",
+           f1[FAULT_HEAP] - f0[FAULT_HEAP]);
     exit();
   }
-  if(unlink("..") == 0){
-    printf(1, "rm .. worked!\n");
-    exit();
+  for(i = 0; i < 8*1024*1024; i += 4096){
+    if(base[i] != (char)(i/4096)){
+      printf(1, "largepage: page %d lost its data\n", i/4096);
+      exit();
+    }
   }
-  if(chdir("/") != 0){
-    printf(1, "chdir / failed\n");
+
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork failed\n");
     exit();
   }
-  if(unlink("dots/.") == 0){
-    printf(1, "unlink dots/. worked!\n");
+  if(pid == 0){
+    base[4096] = 'c';
+    if(base[4096] != 'c' || base[0] != 0){
+      printf(1, "largepage: child sees wrong data\n");
+    }
     exit();
   }
-  if(unlink("dots/..") == 0){
-    printf(1, "unlink dots/.. worked!\n");
+  wait();
+  if(base[4096] != 1){
+    printf(1, "largepage: child's write reached the parent\n");
     exit();
   }
-  if(unlink("dots") != 0){
-    printf(1, "unlink dots failed!\n");
-    exit();
+
+  sbrk(-6*1024*1024);
+  for(i = 0; i < 2*1024*1024; i += 4096){
+    if(base[i] != (char)(i/4096)){
+      printf(1, "largepage: page %d lost after shrink\n", i/4096);
+      exit();
+    }
   }
-  printf(1, "rmdot ok\n");
+  sbrk(-(pad + 2*1024*1024));
+  largepages(old);
+  printf(1, "largepage test OK\n");
 }
 
+// map a file private and shared; shared stores must reach the
+// file at munmap(), private ones must not, and a child must see
+// the parent's mapping.
 void
-dirfile(void)
+mmaptest(void)
 {
-  int fd;
+  char buf[64], *p;
+  int fd, i, pid;
 
-  printf(1, "dir vs file\n");
+  printf(1, "mmap test\n");
 
-  fd = open("dirfile", O_CREATE);
+  fd = open("mmapfile", O_CREATE|O_RDWR);
   if(fd < 0){
-    printf(1, "create dirfile failed\n");
+    printf(1, "mmap: create failed\n");
     exit();
   }
-  close(fd);
-  if(chdir("dirfile") == 0){
-    printf(1, "chdir dirfile succeeded!\n");
-    exit();
-  }
-  fd = open("dirfile/xx", 0);
-  if(fd >= 0){
-    printf(1, "create dirfile/xx succeeded!\n");
+  for(i = 0; i < sizeof(buf); i++)
+    buf[i] = 'a' + i%26;
+  for(i = 0; i < 2*4096/sizeof(buf); i++)
+    write(fd, buf, sizeof(buf));
+
+  p = mmap(0, 2*4096, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, 0);
+  if(p == (char*)-1 || p[0] != 'a' || p[4096+1] != 'a' + (4096+1)%sizeof(buf)%26){
+    printf(1, "mmap: private mapping wrong\n");
     exit();
   }
-  fd = open("dirfile/xx", O_CREATE);
-  if(fd >= 0){
-    printf(1, "create dirfile/xx succeeded!\n");
+  p[0] = 'X';
+  if(munmap(p, 2*4096) < 0){
+    printf(1, "mmap: munmap failed\n");
     exit();
   }
-  if(mkdir("dirfile/xx") == 0){
-    printf(1, "mkdir dirfile/xx succeeded!\n");
+
+  p = mmap(0, 4096, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 4096);
+  if(p == (char*)-1 || p[0] != 'a' + 4096%sizeof(buf)%26){
+    printf(1, "mmap: shared mapping wrong\n");
     exit();
   }
-  if(unlink("dirfile/xx") == 0){
-    printf(1, "unlink dirfile/xx succeeded!\n");
+  pid = fork();
+  if(pid < 0){
+    printf(1, "mmap: fork failed\n");
     exit();
   }
-  if(link("README", "dirfile/xx") == 0){
-    printf(1, "link to dirfile/xx succeeded!\n");
+  if(pid == 0){
+    p[1] = 'Y';
     exit();
   }
-  if(unlink("dirfile") != 0){
-    printf(1, "unlink dirfile failed!\n");
+  wait();
+  p[0] = 'Z';
+  if(p[1] != 'Y'){
+    printf(1, "mmap: child store not shared\n");
     exit();
   }
+  munmap(p, 4096);
+  close(fd);
 
-  fd = open(".", O_RDWR);
-  if(fd >= 0){
-    printf(1, "open . for writing succeeded!\n");
+  fd = open("mmapfile", O_RDONLY);
+  read(fd, buf, 1);
+  if(buf[0] != 'a'){
+    printf(1, "mmap: private store reached the file\n");
     exit();
   }
-  fd = open(".", 0);
-  if(write(fd, "x", 1) > 0){
-    printf(1, "write . succeeded!\n");
+  for(i = 1; i < 4096/sizeof(buf); i++)
+    read(fd, buf, sizeof(buf));
+  read(fd, buf, sizeof(buf) - 1);
+  read(fd, buf, 2);
+  if(buf[0] != 'Z' || buf[1] != 'Y'){
+    printf(1, "mmap: shared store lost\n");
     exit();
   }
   close(fd);
-
-  printf(1, "dir vs file OK\n");
+  unlink("mmapfile");
+  printf(1, "mmap test OK\n");
 }
 
-// test that iput() is called at the end of _namei()
+// munmap() must give the mmap() area back: a loop mapping and
+// unmapping 64MB, 100 times, covers far more than the area holds,
+// so each mapping must land where the one before it was.
 void
-iref(void)
+mmapreusetest(void)
 {
-  int i, fd;
-
-  printf(1, "empty file name\n");
+  char *p, *q, *first;
+  int fd, i;
 
-  // the 50 is NINODE
-  for(i = 0; i < 50 + 1; i++){
-    if(mkdir("irefd") != 0){
-      printf(1, "mkdir irefd failed\n");
+  printf(1, "mmap reuse test\n");
+  if((fd = open("mmapreuse", O_CREATE|O_RDWR)) < 0 || write(fd, "r", 1) != 1){
+    printf(1, "mmap reuse: create failed\n");
+    exit();
+  }
+  first = 0;
+  for(i = 0; i < 100; i++){
+    p = mmap(0, 64*1024*1024, PROT_READ, MAP_PRIVATE, fd, 0);
+    if(p == (char*)-1 || p[0] != 'r'){
+      printf(1, "mmap reuse: mmap %d failed\n", i);
       exit();
     }
-    if(chdir("irefd") != 0){
-      printf(1, "chdir irefd failed\n");
+    if(first == 0)
+      first = p;
+    if(p != first){
+      printf(1, "mmap reuse: mmap %d at %p, not %p\n", i, p, first);
       exit();
     }
-
-    mkdir("");
-    link("README", "");
-    fd = open("", O_CREATE);
-    if(fd >= 0)
-      close(fd);
-    fd = open("xx", O_CREATE);
-    if(fd >= 0)
-      close(fd);
-    unlink("xx");
-  }
-
-  chdir("/");
-  printf(1, "empty file name OK\n");
-}
-
-// test that fork fails gracefully
-// the forktest binary also does this, but it runs out of proc entries first.
-// inside the bigger usertests binary, we run out of memory first.
-void
-forktest(void)
-{
-  int n, pid;
-
-  printf(1, "fork test\n");
-
-  for(n=0; n<1000; n++){
-    pid = fork();
-    if(pid < 0)
-      break;
-    if(pid == 0)
-      exit();
-  }
-
-  if(n == 1000){
-    printf(1, "fork claimed to work 1000 times!\n");
-    exit();
-  }
-
-  for(; n > 0; n--){
-    if(wait() < 0){
-      printf(1, "wait stopped early\n");
+    if(munmap(p, 64*1024*1024) < 0){
+      printf(1, "mmap reuse: munmap failed\n");
       exit();
     }
   }
-
-  if(wait() != -1){
-    printf(1, "wait got too many\n");
+  // Two mappings, the lower one unmapped last: both come back.
+  p = mmap(0, 4096, PROT_READ, MAP_PRIVATE, fd, 0);
+  q = mmap(0, 4096, PROT_READ, MAP_PRIVATE, fd, 0);
+  if(p == (char*)-1 || q == (char*)-1 || munmap(p, 4096) < 0 ||
+     munmap(q, 4096) < 0 ||
+     mmap(0, 4096, PROT_READ, MAP_PRIVATE, fd, 0) != p){
+    printf(1, "mmap reuse: hole not given back\n");
     exit();
   }
-
-  printf(1, "fork test OK\n");
+  munmap(p, 4096);
+  close(fd);
+  unlink("mmapreuse");
+  printf(1, "mmap reuse test OK\n");
 }
 
 void
@@ -1745,10 +4243,284 @@ rand()
   return randstate;
 }
 
+// The test runner.  Each test runs in a child process of its own,
+// which writes a byte to a pipe if the test returns; a test that
+// fails exit()s before it can.  With -j n (by default, one job per
+// CPU) up to n tests run at once, each in a directory of its own,
+// utNN, with a link to README, and with its output going to
+// utNN.log, which is shown only if it fails.  The ALONE tests,
+// which watch system-wide counters, use up memory or processes, or
+// need the root directory, then run one at a time.  -s runs every
+// test that way, in order, as the tests used to run.
+#define ALONE   1
+#define MAXJOB  8
+
+struct test {
+  char *name;
+  void (*fn)(void);
+  int flags;
+} tests[] = {
+  { "argptest",        argptest,        ALONE },
+  { "createdelete",    createdelete,    0 },
+  { "linkunlink",      linkunlink,      0 },
+  { "concreate",       concreate,       0 },
+  { "fourfiles",       fourfiles,       0 },
+  { "sharedfd",        sharedfd,        0 },
+  { "bigargtest",      bigargtest,      ALONE },
+  { "bigwrite",        bigwrite,        0 },
+  { "bsstest",         bsstest,         0 },
+  { "sbrktest",        sbrktest,        ALONE },
+  { "faultaroundtest", faultaroundtest, ALONE },
+  { "largepagetest",   largepagetest,   ALONE },
+  { "prioritytest",    prioritytest,    0 },
+  { "procinfotest",    procinfotest,    0 },
+  { "affinitytest",    affinitytest,    0 },
+  { "clocktest",       clocktest,       0 },
+  { "msleeptest",      msleeptest,      ALONE },
+  { "lockstattest",    lockstattest,    ALONE },
+  { "sharedreadtest",  sharedreadtest,  0 },
+  { "bcachetest",      bcachetest,      ALONE },
+  { "readaheadtest",   readaheadtest,   0 },
+  { "ioschedtest",     ioschedtest,     0 },
+  { "groupcommittest", groupcommittest, 0 },
+  { "bigtranstest",    bigtranstest,    0 },
+  { "extenttest",      extenttest,      0 },
+  { "dcachetest",      dcachetest,      0 },
+  { "hashdirtest",     hashdirtest,     0 },
+  { "icachetest",      icachetest,      ALONE },
+  { "bmapcachetest",   bmapcachetest,   0 },
+  { "delayalloctest",  delayalloctest,  0 },
+  { "inlinetest",      inlinetest,      0 },
+  { "reclaimtest",     reclaimtest,     0 },
+  { "preadvtest",      preadvtest,      0 },
+  { "sendfiletest",    sendfiletest,    0 },
+  { "pipesizetest",    pipesizetest,    0 },
+  { "tmpfstest",       tmpfstest,       ALONE },
+  { "pcachetest",      pcachetest,      0 },
+  { "getdentstest",    getdentstest,    0 },
+  { "sysstattest",     sysstattest,     0 },
+  { "ringtest",        ringtest,        0 },
+  { "sysentertest",    sysentertest,    0 },
+  { "tracetest",       tracetest,       ALONE },
+  { "stdiotest",       stdiotest,       0 },
+  { "malloctest",      malloctest,      0 },
+  { "stringtest",      stringtest,      0 },
+  { "lazycopytest",    lazycopytest,    0 },
+  { "rsstest",         rsstest,         0 },
+  { "shmtest",         shmtest,         0 },
+  { "irqtest",         irqtest,         ALONE },
+  { "threadtest",      threadtest,      0 },
+  { "futextest",       futextest,       0 },
+  { "validatetest",    validatetest,    0 },
+  { "opentest",        opentest,        ALONE },
+  { "writetest",       writetest,       0 },
+  { "writetest1",      writetest1,      0 },
+  { "createtest",      createtest,      0 },
+  { "openiputtest",    openiputtest,    0 },
+  { "exitiputtest",    exitiputtest,    0 },
+  { "iputtest",        iputtest,        0 },
+  { "mem",             mem,             ALONE },
+  { "pipe1",           pipe1,           0 },
+  { "preempt",         preempt,         0 },
+  { "exitwait",        exitwait,        0 },
+  { "rmdot",           rmdot,           ALONE },
+  { "fourteen",        fourteen,        0 },
+  { "bigfile",         bigfile,         0 },
+  { "subdir",          subdir,          ALONE },
+  { "linktest",        linktest,        0 },
+  { "unlinkread",      unlinkread,      0 },
+  { "dirfile",         dirfile,         0 },
+  { "iref",            iref,            ALONE },
+  { "forktest",        forktest,        ALONE },
+  { "cowtest",         cowtest,         0 },
+  { "mmaptest",        mmaptest,        0 },
+  { "mmapreusetest",   mmapreusetest,   0 },
+  { "bigdir",          bigdir,          0 },
+  { "uio",             uio,             0 },
+  { "greptest",        greptest,        ALONE },
+  { "proclocktest",    proclocktest,    0 },
+  { "fdtabletest",     fdtabletest,     0 },
+};
+
+#define NTEST (sizeof(tests)/sizeof(tests[0]))
+
+struct job {
+  int t;                       // Index in tests[], or -1 if free
+  int pid;
+  int fd;                      // Read end of the test's pipe
+  int own;                     // In a directory of its own
+  uint start;
+} jobs[MAXJOB];
+int njob;                      // Jobs in use: jobs[0..njob)
+
+int npass, nfail;
+
+uint
+msec(void)
+{
+  struct timespec ts;
+
+  vclock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec*1000 + ts.tv_nsec/1000000;
+}
+
+// name is utNN followed by suffix, for test t.
+void
+jobname(char *name, int t, char *suffix)
+{
+  name[0] = 'u';
+  name[1] = 't';
+  name[2] = '0' + t/10;
+  name[3] = '0' + t%10;
+  strcpy(name + 4, suffix);
+}
+
+void
+jobstart(struct job *jb, int t, int own)
+{
+  char name[16];
+  int p[2], i;
+
+  if(pipe(p) < 0){
+    printf(1, "usertests: pipe failed\n");
+    exit();
+  }
+  jb->t = t;
+  jb->fd = p[0];
+  jb->own = own;
+  jb->start = msec();
+  if((jb->pid = fork()) < 0){
+    printf(1, "usertests: fork failed\n");
+    exit();
+  }
+  if(jb->pid == 0){
+    for(i = 0; i < njob; i++)
+      if(jobs[i].t >= 0)
+        close(jobs[i].fd);
+    if(own){
+      jobname(name, t, ".log");
+      close(1);
+      if(open(name, O_CREATE|O_RDWR) != 1)
+        exit();
+      jobname(name, t, "");
+      if(mkdir(name) < 0 || chdir(name) < 0 || link("/README", "README") < 0){
+        printf(2, "usertests: cannot set up %s\n", name);
+        exit();
+      }
+    }
+    tests[t].fn();
+    write(p[1], "p", 1);
+    exit();
+  }
+  close(p[1]);
+}
+
+// Wait for a test to finish and report it.
+void
+jobwait(void)
+{
+  struct job *jb;
+  char name[16], c;
+  int pid, ok, fd, n;
+
+  if((pid = wait()) < 0){
+    printf(1, "usertests: wait failed\n");
+    exit();
+  }
+  for(jb = jobs; jb < &jobs[njob] && jb->pid != pid; jb++)
+    ;
+  if(jb == &jobs[njob])
+    return;
+  ok = read(jb->fd, &c, 1) == 1;
+  close(jb->fd);
+  if(ok)
+    npass++;
+  else
+    nfail++;
+  printf(1, "%s: %s (%d ms)\n", tests[jb->t].name, ok ? "ok" : "FAILED",
+         msec() - jb->start);
+  if(jb->own){
+    jobname(name, jb->t, ".log");
+    if(!ok && (fd = open(name, 0)) >= 0){
+      while((n = read(fd, buf, sizeof(buf))) > 0)
+        write(1, buf, n);
+      close(fd);
+    }
+    unlink(name);
+    jobname(name, jb->t, "/README");
+    unlink(name);
+    name[4] = 0;
+    unlink(name);
+  }
+  jb->t = -1;
+  jb->pid = 0;
+}
+
+// A free job, once one of the running tests has finished.
+struct job*
+jobfree(void)
+{
+  struct job *jb;
+
+  for(;;){
+    for(jb = jobs; jb < &jobs[njob]; jb++)
+      if(jb->t < 0)
+        return jb;
+    jobwait();
+  }
+}
+
+int
+jobsrunning(void)
+{
+  struct job *jb;
+
+  for(jb = jobs; jb < &jobs[njob]; jb++)
+    if(jb->t >= 0)
+      return 1;
+  return 0;
+}
+
+// Is test t one of the n named in names, or are none named?
+int
+wanted(int t, char **names, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++)
+    if(strcmp(names[i], tests[t].name) == 0)
+      return 1;
+  return n == 0;
+}
+
 int
 main(int argc, char *argv[])
 {
-  printf(1, "usertests starting\n");
+  struct cpuinfo ci;
+  int i, t, nname;
+  char **names;
+  uint start;
+
+  for(njob = 0; getcpuinfo(njob, &ci) == 0; njob++)
+    ;
+  for(i = 1; i < argc && argv[i][0] == '-'; i++){
+    if(strcmp(argv[i], "-s") == 0)
+      njob = 1;
+    else if(strcmp(argv[i], "-j") == 0 && i+1 < argc)
+      njob = atoi(argv[++i]);
+    else {
+      printf(2, "usage: usertests [-s] [-j n] [test...]\n");
+      exit();
+    }
+  }
+  if(njob < 1)
+    njob = 1;
+  if(njob > MAXJOB)
+    njob = MAXJOB;
+  names = argv + i;
+  nname = argc - i;
+
+  printf(1, "usertests starting, %d at a time\n", njob);
 
   if(open("usertests.ran", 0) >= 0){
     printf(1, "already ran user tests -- rebuild fs.img\n");
@@ -1756,48 +4528,26 @@ main(int argc, char *argv[])
   }
   close(open("usertests.ran", O_CREATE));
 
-  argptest();
-  createdelete();
-  linkunlink();
-  concreate();
-  fourfiles();
-  sharedfd();
-
-  bigargtest();
-  bigwrite();
-  bigargtest();
-  bsstest();
-  sbrktest();
-  validatetest();
-
-  opentest();
-  writetest();
-  writetest1();
-  createtest();
-
-  openiputtest();
-  exitiputtest();
-  iputtest();
-
-  mem();
-  pipe1();
-  preempt();
-  exitwait();
-
-  rmdot();
-  fourteen();
-  bigfile();
-  subdir();
-  linktest();
-  unlinkread();
-  dirfile();
-  iref();
-  forktest();
-  bigdir(); // slow
-
-  uio();
-
-  exectest();
+  for(i = 0; i < njob; i++)
+    jobs[i].t = -1;
+  start = msec();
+  if(njob > 1){
+    for(t = 0; t < NTEST; t++)
+      if(wanted(t, names, nname) && !(tests[t].flags & ALONE))
+        jobstart(jobfree(), t, 1);
+    while(jobsrunning())
+      jobwait();
+  }
+  for(t = 0; t < NTEST; t++){
+    if(wanted(t, names, nname) && (njob == 1 || (tests[t].flags & ALONE))){
+      jobstart(&jobs[0], t, 0);
+      jobwait();
+    }
+  }
+  printf(1, "usertests: %d passed, %d failed in %d ms\n", npass, nfail,
+         msec() - start);
 
+  if(nfail == 0 && nname == 0)
+    exectest();
   exit();
 }
@@ -4,12 +4,25 @@
 #include "x86.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "elf.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
+#include "fault.h"
+#include "fcntl.h"
+#include "traps.h"
 
 extern char data[];  // defined by kernel.ld
 pde_t *kpgdir;  // for use in scheduler()
 
+// Shared by every heap page that has been read but never written.
+// It is mapped read-only and copy-on-write, and is never freed.
+char zeropage[PGSIZE] __attribute__((aligned(PGSIZE)));
+
+#define LPGORDER 10  // A 4MB page is a kallocn() run of 2^10 pages
+
 // Set up CPU's kernel segment descriptors.
 // Run once on entry on each CPU.
 void
@@ -27,12 +40,28 @@ seginit(void)
   c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
   c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
   lgdt(c->gdt, sizeof(c->gdt));
+
+  // System calls by sysenter (usys.S) come in at sysentry, on the
+  // stack switchuvm() sets for each process.  sysexit takes the user
+  // segments from the ones after SEG_KCODE, as laid out above.
+  if(cpufeatures() & CPUID_SEP){
+    wrmsr(MSR_SYSENTER_CS, SEG_KCODE<<3);
+    wrmsr(MSR_SYSENTER_EIP, (uint)sysentry);
+    c->sysenter = 1;
+  }
+
+  // memmove() may use the SSE registers (see string.c).
+  if(SSEMOVE && (cpufeatures() & (CPUID_FXSR|CPUID_SSE)) == (CPUID_FXSR|CPUID_SSE)){
+    lcr4(rcr4() | CR4_OSFXSR);
+    ssemove = 1;
+  }
 }
 
 
 // Return the address of the PTE in page table pgdir
 // that corresponds to virtual address va.  If alloc!=0,
-// create any required page table pages.
+// create any required page table pages.  If va is in a 4MB
+// page (PTE_PS) the PDE itself is returned.
 static pte_t *
 walkpgdir(pde_t *pgdir, const void *va, int alloc)
 {
@@ -40,13 +69,14 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
   pte_t *pgtab;
 
   pde = &pgdir[PDX(va)];
+  if(*pde & PTE_PS)
+    return pde;
   if(*pde & PTE_P){
     pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
   } else {
-    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
-      return 0;
     // Make sure all those PTE_P bits are zero.
-    memset(pgtab, 0, PGSIZE);
+    if(!alloc || (pgtab = (pte_t*)kzalloc()) == 0)
+      return 0;
     // The permissions here are overly generous, but they can
     // be further restricted by the permissions in the page table
     // entries, if necessary.
@@ -105,7 +135,9 @@ mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
 // (directly addressable from end..P2V(PHYSTOP)).
 
 // This table defines the kernel's mappings, which are present in
-// every process's page table.
+// every process's page table.  They are the same everywhere, so
+// setupkvm() marks them global (PTE_G): switching page tables
+// does not flush them from the TLB.
 static struct kmap {
   void *virt;
   uint phys_start;
@@ -125,17 +157,23 @@ setupkvm(void)
   pde_t *pgdir;
   struct kmap *k;
 
-  if((pgdir = (pde_t*)kalloc()) == 0)
+  if((pgdir = (pde_t*)kzalloc()) == 0)
     return 0;
-  memset(pgdir, 0, PGSIZE);
   if (P2V(PHYSTOP) > (void*)DEVSPACE)
     panic("PHYSTOP too high");
   for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
     if(mappages(pgdir, k->virt, k->phys_end - k->phys_start,
-                (uint)k->phys_start, k->perm) < 0) {
+                (uint)k->phys_start, k->perm | PTE_G) < 0) {
       freevm(pgdir);
       return 0;
     }
+  // The clock page (clock.c), read-only to user code.  It is the
+  // same in every page table, so it can be global too.
+  if(clockpg && mappages(pgdir, (void*)CLOCKPAGE, PGSIZE, V2P(clockpg),
+                         PTE_U | PTE_G) < 0){
+    freevm(pgdir);
+    return 0;
+  }
   return pgdir;
 }
 
@@ -173,14 +211,63 @@ switchuvm(struct proc *p)
   mycpu()->gdt[SEG_TSS].s = 0;
   mycpu()->ts.ss0 = SEG_KDATA << 3;
   mycpu()->ts.esp0 = (uint)p->kstack + KSTACKSIZE;
+  if(mycpu()->sysenter)
+    wrmsr(MSR_SYSENTER_ESP, (uint)p->kstack + KSTACKSIZE);
   // setting IOPL=0 in eflags *and* iomb beyond the tss segment limit
   // forbids I/O instructions (e.g., inb and outb) from user space
   mycpu()->ts.iomb = (ushort) 0xFFFF;
   ltr(SEG_TSS << 3);
-  lcr3(V2P(p->pgdir));  // switch to process's address space
+  // switch to process's address space, unless it is still loaded
+  // (see scheduler())
+  if(rcr3() != V2P(p->pgdir))
+    lcr3(V2P(p->pgdir));
+  popcli();
+}
+
+// Make the other CPUs flush the user part of their TLBs, and wait
+// until they have: a thread changed a mapping of an address space
+// that other threads may be using there.  The CPUs are asked with
+// an IRQ_TLB interrupt (see tlback()); while waiting this CPU does
+// the same for the others, so two CPUs can shoot at each other.
+// Caller must not hold a spinlock.
+void
+tlbshootdown(void)
+{
+  struct cpu *c, *me;
+  uint req[NCPU];
+
+  pushcli();
+  me = mycpu();
+  for(c = cpus; c < &cpus[ncpu]; c++){
+    if(c == me || !c->started)
+      continue;
+    req[c-cpus] = __sync_add_and_fetch(&c->tlbreq, 1);
+    lapicipi(c->apicid, T_IRQ0 + IRQ_TLB);
+  }
+  for(c = cpus; c < &cpus[ncpu]; c++){
+    if(c == me || !c->started)
+      continue;
+    while((int)(c->tlbdone - req[c-cpus]) < 0){
+      if(me->tlbdone != me->tlbreq)
+        tlback();
+    }
+  }
   popcli();
 }
 
+// Do the TLB flushes other CPUs asked of this one.
+void
+tlback(void)
+{
+  struct cpu *c;
+  uint req;
+
+  c = mycpu();
+  req = c->tlbreq;
+  lcr3(rcr3());
+  c->tlbdone = req;
+}
+
 // Load the initcode into address 0 of pgdir.
 // sz must be less than a page.
 void
@@ -190,8 +277,7 @@ inituvm(pde_t *pgdir, char *init, uint sz)
 
   if(sz >= PGSIZE)
     panic("inituvm: more than a page");
-  mem = kalloc();
-  memset(mem, 0, PGSIZE);
+  mem = kzalloc();
   mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
   memmove(mem, init, sz);
 }
@@ -235,13 +321,12 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 
   a = PGROUNDUP(oldsz);
   for(; a < newsz; a += PGSIZE){
-    mem = kalloc();
+    mem = kzalloc();
     if(mem == 0){
       cprintf("allocuvm out of memory\n");
       deallocuvm(pgdir, newsz, oldsz);
       return 0;
     }
-    memset(mem, 0, PGSIZE);
     if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
       cprintf("allocuvm out of memory (2)\n");
       deallocuvm(pgdir, newsz, oldsz);
@@ -255,31 +340,57 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 // Deallocate user pages to bring the process size from oldsz to
 // newsz.  oldsz and newsz need not be page-aligned, nor does newsz
 // need to be less than oldsz.  oldsz can be larger than the actual
-// process size.  Returns the new process size.
+// process size.  Returns the number of resident pages unmapped,
+// for the caller's p->rss.
 int
 deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 {
-  pte_t *pte;
-  uint a, pa;
+  pde_t *pde;
+  pte_t *pgtab, *pte;
+  uint a, pa, end;
+  int n;
 
+  n = 0;
   if(newsz >= oldsz)
-    return oldsz;
+    return 0;
 
-  a = PGROUNDUP(newsz);
-  for(; a  < oldsz; a += PGSIZE){
-    pte = walkpgdir(pgdir, (char*)a, 0);
-    if(!pte)
-      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
-    else if((*pte & PTE_P) != 0){
+  // Walk one page directory entry (4 MB) at a time, skipping
+  // entries with no page table, so the cost follows the number
+  // of mapped pages rather than the size of the range.
+  for(a = PGROUNDUP(newsz); a < oldsz; a = end){
+    end = PGADDR(PDX(a) + 1, 0, 0);
+    if(end == 0 || end > oldsz)
+      end = oldsz;
+    pde = &pgdir[PDX(a)];
+    if(!(*pde & PTE_P))
+      continue;
+    if(*pde & PTE_PS){
+      if(end - a != LPGSIZE)
+        panic("deallocuvm: part of a 4MB page");
+      kfreen(P2V(PTE_ADDR(*pde)), LPGORDER);
+      *pde = 0;
+      n += NPTENTRIES;
+      continue;
+    }
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+    for(; a < end; a += PGSIZE){
+      pte = &pgtab[PTX(a)];
+      if(*pte & PTE_SWAP){
+        swapfree(PTE_ADDR(*pte) >> PTXSHIFT);
+        *pte = 0;
+        continue;
+      }
+      if(!(*pte & PTE_P))
+        continue;
       pa = PTE_ADDR(*pte);
       if(pa == 0)
         panic("kfree");
-      char *v = P2V(pa);
-      kfree(v);
+      kfree(P2V(pa));
       *pte = 0;
+      n++;
     }
   }
-  return newsz;
+  return n;
 }
 
 // Free a page table and all the physical memory pages
@@ -291,7 +402,8 @@ freevm(pde_t *pgdir)
 
   if(pgdir == 0)
     panic("freevm: no pgdir");
-  deallocuvm(pgdir, KERNBASE, 0);
+  deallocuvm(pgdir, CLOCKPAGE, 0);
+  shmreclaim();
   for(i = 0; i < NPDENTRIES; i++){
     if(pgdir[i] & PTE_P){
       char * v = P2V(PTE_ADDR(pgdir[i]));
@@ -314,42 +426,894 @@ clearpteu(pde_t *pgdir, char *uva)
   *pte &= ~PTE_U;
 }
 
+// Share the mapped pages of [start, end) of pgdir with d.
+// Returns the number of resident pages shared, or -1 if d runs
+// out of page-table pages.
+static int
+copyrange(pde_t *pgdir, pde_t *d, uint start, uint end)
+{
+  pde_t *pde;
+  pte_t *pgtab, *pte, *dpte;
+  uint pa, i, flags, next;
+  int n;
+
+  n = 0;
+  // Like deallocuvm(), skip whole unmapped 4 MB ranges; pages that
+  // were never touched (lazy heap) simply stay unmapped in the child.
+  for(i = start; i < end; i = next){
+    next = PGADDR(PDX(i) + 1, 0, 0);
+    if(next == 0 || next > end)
+      next = end;
+    pde = &pgdir[PDX(i)];
+    if(!(*pde & PTE_P))
+      continue;
+    if(*pde & PTE_PS){
+      // A 4MB page is shared copy-on-write as a whole.
+      if(*pde & PTE_W)
+        *pde = (*pde & ~PTE_W) | PTE_COW;
+      d[PDX(i)] = *pde;
+      kincref(P2V(PTE_ADDR(*pde)));
+      n += NPTENTRIES;
+      continue;
+    }
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+    for(; i < next; i += PGSIZE){
+      pte = &pgtab[PTX(i)];
+      if(*pte & PTE_SWAP){
+        // Share the swap slot; whoever faults first reads it back.
+        if((dpte = walkpgdir(d, (void*)i, 1)) == 0)
+          return -1;
+        *dpte = *pte;
+        swapdup(PTE_ADDR(*pte) >> PTXSHIFT);
+        continue;
+      }
+      if(!(*pte & PTE_P))
+        continue;
+      if((*pte & PTE_W) && !(*pte & PTE_SHARED))
+        *pte = (*pte & ~PTE_W) | PTE_COW;
+      pa = PTE_ADDR(*pte);
+      flags = PTE_FLAGS(*pte);
+      if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0)
+        return -1;
+      kincref(P2V(pa));
+      n++;
+    }
+  }
+  return n;
+}
+
 // Given a parent process's page table, create a copy
-// of it for a child.
+// of it for a child: the memory below sz and the mmap()
+// area from mmapbot up.  Pages are not copied: parent and child
+// share them read-only and marked PTE_COW, and cowfault()
+// gives each side its own copy on the first write.
+// MAP_SHARED pages (PTE_SHARED) stay writable in both.
+// *rss is set to the number of resident pages the child starts
+// with.
 pde_t*
-copyuvm(pde_t *pgdir, uint sz)
+copyuvm(pde_t *pgdir, uint sz, uint mmapbot, int *rss)
 {
   pde_t *d;
-  pte_t *pte;
-  uint pa, i, flags;
-  char *mem;
+  int n, m;
 
   if((d = setupkvm()) == 0)
     return 0;
-  for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
-      //panic("copyuvm: pte should exist");
-	continue;
-    if(!(*pte & PTE_P))
-      //panic("copyuvm: page not present");
-	continue;
-    pa = PTE_ADDR(*pte);
-    flags = PTE_FLAGS(*pte);
-    if((mem = kalloc()) == 0)
-      goto bad;
+  if((n = copyrange(pgdir, d, 0, sz)) < 0 ||
+     (m = copyrange(pgdir, d, mmapbot, CLOCKPAGE)) < 0){
+    freevm(d);
+    return 0;
+  }
+  *rss = n + m;
+  // The parent may still hold writable TLB entries.
+  if(rcr3() == V2P(pgdir))
+    lcr3(V2P(pgdir));
+  return d;
+}
+
+// p mapped n more pages, or unmapped -n.  Atomic, since swapout()
+// takes pages from processes running on other CPUs.
+static void
+rssadd(struct proc *p, int n)
+{
+  __sync_fetch_and_add(&p->rss, n);
+}
+
+// Allocate a page for the fault path, zero-filled if zero is set.
+// When memory runs out even after kalloc() has emptied the caches,
+// swap a cold page out and try again, unless the caller holds a
+// spinlock and so must not sleep.
+static char*
+allocpage(int zero)
+{
+  char *mem;
+  int locked;
+
+  for(;;){
+    if((mem = zero ? kzalloc() : kalloc()) != 0)
+      return mem;
+    pushcli();
+    locked = mycpu()->ncli > 1;
+    popcli();
+    if(locked || swapout() < 0)
+      return 0;
+  }
+}
+
+// Resolve a write fault at user address va on a copy-on-write
+// page of pgdir.  The last sharer takes the page over in place;
+// anyone else gets a private copy (of all of it, for a 4MB page).
+// Returns 0 on success, -1 if va is not a copy-on-write page or
+// there is no memory left.
+int
+cowfault(pde_t *pgdir, uint va)
+{
+  pte_t *pte;
+  uint pa, flags;
+  char *mem;
+  int large;
+
+  if(va >= KERNBASE)
+    return -1;
+  if((pte = walkpgdir(pgdir, (void*)va, 0)) == 0)
+    return -1;
+  if((*pte & (PTE_P|PTE_U|PTE_COW)) != (PTE_P|PTE_U|PTE_COW))
+    return -1;
+  pa = PTE_ADDR(*pte);
+  flags = (PTE_FLAGS(*pte) | PTE_W) & ~PTE_COW;
+  large = *pte & PTE_PS;
+  if(pa != V2P(zeropage) && krefcnt(P2V(pa)) == 1){
+    *pte = pa | flags;
+  } else if(large){
+    if((mem = kallocn(LPGORDER)) == 0)
+      return -1;
+    memmove(mem, (char*)P2V(pa), LPGSIZE);
+    *pte = V2P(mem) | flags;
+    kfreen(P2V(pa), LPGORDER);
+  } else {
+    if((mem = allocpage(0)) == 0)
+      return -1;
     memmove(mem, (char*)P2V(pa), PGSIZE);
-    if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0) {
+    *pte = V2P(mem) | flags;
+    kfree(P2V(pa));
+  }
+  invlpg((void*)PGROUNDDOWN(va));
+  return 0;
+}
+
+// With largepages() on, back the 4MB-aligned heap range around va
+// with a single zeroed 4MB page, if all of it is below sz and
+// nothing in it is mapped or file-backed yet.  Returns -1 if the
+// range doesn't qualify or there is no free 4MB run, and the
+// caller falls back to 4KB pages.
+static int
+largefault(struct proc *p, uint va)
+{
+  struct vma *v;
+  uint a;
+  char *mem;
+
+  a = va & ~(LPGSIZE-1);
+  if(a + LPGSIZE > p->sz || a + LPGSIZE < a || p->pgdir[PDX(a)] != 0)
+    return -1;
+  if(p->paginaInvalida >= a && p->paginaInvalida < a + LPGSIZE)
+    return -1;
+  for(v = p->vma; v < &p->vma[NVMA]; v++)
+    if(v->ip && v->start < a + LPGSIZE && v->end > a)
+      return -1;
+  if((mem = kallocn(LPGORDER)) == 0)
+    return -1;
+  memset(mem, 0, LPGSIZE);
+  p->pgdir[PDX(a)] = V2P(mem) | PTE_P | PTE_W | PTE_U | PTE_PS;
+  rssadd(p, NPTENTRIES);
+  return 0;
+}
+
+// Split a 4MB page back into 4KB ones, so that part of it can be
+// unmapped.  If it is still shared copy-on-write, this side takes
+// a private copy first.  Returns -1 if there is no memory.
+static int
+splitlarge(pde_t *pde)
+{
+  pte_t *pgtab;
+  char *mem, *old;
+  uint i, flags;
+
+  old = P2V(PTE_ADDR(*pde));
+  flags = PTE_FLAGS(*pde) & ~PTE_PS;
+  if((pgtab = (pte_t*)kzalloc()) == 0)
+    return -1;
+  if(krefcnt(old) > 1){
+    if((mem = kallocn(LPGORDER)) == 0){
+      kfree((char*)pgtab);
+      return -1;
+    }
+    memmove(mem, old, LPGSIZE);
+    kfreen(old, LPGORDER);
+    old = mem;
+    flags = (flags | PTE_W) & ~PTE_COW;
+  }
+  ksplit(old, LPGORDER);
+  for(i = 0; i < NPTENTRIES; i++)
+    pgtab[i] = (V2P(old) + i*PGSIZE) | flags;
+  *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+  return 0;
+}
+
+// The process is about to shrink to sz: split the 4MB page that
+// sz falls inside, if any, so deallocuvm() can free the part of
+// it above sz.  The caller reloads CR3.  Returns -1 if there is
+// no memory for that.
+int
+uvmsplit(pde_t *pgdir, uint sz)
+{
+  pde_t *pde;
+
+  sz = PGROUNDUP(sz);
+  pde = &pgdir[PDX(sz)];
+  if(sz % LPGSIZE == 0 || !(*pde & PTE_PS))
+    return 0;
+  return splitlarge(pde);
+}
+
+// Lazily allocated heap: map a zeroed page at the unmapped user
+// address va, which the caller has checked is below p->sz.  A read
+// fault (write == 0) maps the shared zeropage read-only; the first
+// write to it then goes through cowfault() like any other
+// copy-on-write page.  A write fault allocates private pages.
+// Faults that walk the heap in order ("va" is the page right after
+// the previous window) also map the pages that follow, doubling
+// the window each time up to p->faultaround pages; any other fault
+// starts over with a single page.  The window stops early at sz,
+// at a page that is already mapped, and at the guard page.
+// Returns 0 on success, -1 if not even the page at va could be
+// mapped.
+int
+heapfault(struct proc *p, uint va, int write)
+{
+  uint a, end;
+  pte_t *pte;
+  char *mem;
+
+  if(p->largepages && largefault(p, va) == 0)
+    return 0;
+  va = PGROUNDDOWN(va);
+  if(va == p->faultnext && p->faultwin > 0)
+    p->faultwin *= 2;
+  else
+    p->faultwin = 1;
+  if(p->faultwin > p->faultaround)
+    p->faultwin = p->faultaround;
+  if(p->faultwin < 1)
+    p->faultwin = 1;
+
+  end = va + p->faultwin*PGSIZE;
+  if(end > PGROUNDUP(p->sz) || end < va)
+    end = PGROUNDUP(p->sz);
+  for(a = va; a < end; a += PGSIZE){
+    if(a != va && a == p->paginaInvalida)
+      break;
+    pte = walkpgdir(p->pgdir, (char*)a, 0);
+    if(a != va && pte && *pte)
+      break;
+    if(!write){
+      if(mappages(p->pgdir, (char*)a, PGSIZE, V2P(zeropage), PTE_U|PTE_COW) < 0)
+        break;
+      continue;
+    }
+    if((mem = allocpage(1)) == 0)
+      break;
+    if(mappages(p->pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
       kfree(mem);
-      goto bad;
+      break;
     }
   }
-  return d;
+  rssadd(p, (a - va) / PGSIZE);
+  p->faultnext = a;
+  return a == va ? -1 : 0;
+}
+
+// Return p's file-backed range containing va, or 0.
+static struct vma*
+vmalookup(struct proc *p, uint va)
+{
+  struct vma *v;
+
+  for(v = p->vma; v < &p->vma[NVMA]; v++)
+    if(v->ip && va >= v->start && va < v->end)
+      return v;
+  return 0;
+}
+
+// Fill the page at va from v: read the file part, zero the rest
+// and map it as v->prot allows (exec segments are writable, since
+// xv6 binaries have a single RWX segment).  Pages with file data
+// come from the shared page cache (textcache.c).  A MAP_SHARED
+// mapping writes to the cached page itself; a private one maps it
+// copy-on-write.  Reading may sleep, so the caller must not hold
+// a spinlock; pages past filesz (bss) are zero-filled without
+// reading.
+static int
+filefault(struct proc *p, struct vma *v, uint va)
+{
+  char *mem;
+  uint off, n;
+  int perm;
+
+  va = PGROUNDDOWN(va);
+  off = va - v->start;
+  n = 0;
+  if(off < v->filesz)
+    n = v->filesz - off < PGSIZE ? v->filesz - off : PGSIZE;
+  perm = PTE_U;
+  if(v->prot & PROT_WRITE)
+    perm |= PTE_W;
+  if(v->flags & MAP_SHARED)
+    perm |= PTE_SHARED;
+  if(n > 0 && (mem = textget(v->ip, v->off + off, n)) != 0){
+    if((perm & PTE_W) && !(perm & PTE_SHARED))
+      perm = (perm & ~PTE_W) | PTE_COW;
+    if(mappages(p->pgdir, (char*)va, PGSIZE, V2P(mem), perm) < 0){
+      kfree(mem);
+      return -1;
+    }
+    rssadd(p, 1);
+    return 0;
+  }
+  if(n > 0 && (v->flags & MAP_SHARED))
+    return -1;
+  if(n == 0){
+    if((mem = allocpage(1)) == 0)
+      return -1;
+  } else {
+    if((mem = allocpage(0)) == 0)
+      return -1;
+    ilockshared(v->ip);
+    if(readi(v->ip, mem, v->off + off, n) != n){
+      iunlock(v->ip);
+      kfree(mem);
+      return -1;
+    }
+    iunlock(v->ip);
+    memset(mem + n, 0, PGSIZE - n);
+  }
+  if(mappages(p->pgdir, (char*)va, PGSIZE, V2P(mem), perm) < 0){
+    kfree(mem);
+    return -1;
+  }
+  rssadd(p, 1);
+  return 0;
+}
+
+// Walk p's pages in [va, va+n) once each, faulting in the ones
+// that are not mapped yet (lazy heap, file-backed or swapped out)
+// and, with write, making them writable (copy-on-write); copy
+// each page's part to the user from k, with write, or from the
+// user to k, unless k is 0.  p's page table need not be the one
+// loaded.  Returns -1 if the range is not all p's or a page can't
+// be brought in.
+static int
+uvmrw(struct proc *p, uint va, char *k, uint n, int write)
+{
+  struct vma *v;
+  pte_t *pte;
+  uint a, m;
+  char *ka;
+  int err;
+
+  if(uvmcheck(p, va, n) < 0)
+    return -1;
+  for(; n > 0; va += m, n -= m){
+    a = PGROUNDDOWN(va);
+    m = PGSIZE - (va - a);
+    if(m > n)
+      m = n;
+    pte = walkpgdir(p->pgdir, (char*)a, 0);
+    if(pte && (*pte & PTE_P)){
+      if(write && !(*pte & PTE_W) && vmfault(p, a, FEC_PR|FEC_WR) < 0)
+        return -1;
+    } else {
+      // Map a page that is to be written writable at once, rather
+      // than the zero page that a write would then copy.
+      v = vmalookup(p, a);
+      err = write || (k == 0 && (v == 0 || (v->prot & PROT_WRITE))) ? FEC_WR : 0;
+      if(vmfault(p, a, err) < 0)
+        return -1;
+    }
+    if(k == 0)
+      continue;
+    if((ka = uva2ka(p->pgdir, (char*)a)) == 0)
+      return -1;
+    if(write)
+      memmove(ka + (va - a), k, m);
+    else
+      memmove(k, ka + (va - a), m);
+    k += m;
+  }
+  return 0;
+}
+
+// Pin [va, va+n) so that swapout() leaves it alone until the
+// system call returns.  Returns -1 if the call has all NPIN.
+static int
+uvmpin(struct proc *p, uint va, uint n)
+{
+  if(p->npin == NPIN)
+    return -1;
+  p->pinva[p->npin] = va;
+  p->pinend[p->npin] = va + n;
+  p->npin++;
+  return 0;
+}
+
+// Is va in one of p's pinned buffers?  The kernel may take a page
+// fault there: a write to a copy-on-write page of one.  Anywhere
+// else in user memory, a kernel fault is a bug: the copies below
+// fault pages in before they touch them.
+int
+uvmpinned(struct proc *p, uint va)
+{
+  int i;
+
+  for(i = 0; i < p->npin; i++)
+    if(va >= p->pinva[i] && va < p->pinend[i])
+      return 1;
+  return 0;
+}
+
+// Fault in every page of [va, va+n) and pin the range.  argptr()
+// calls this so that system calls can then touch the buffer while
+// holding a spinlock (piperead(), consolewrite(), ...), where a
+// fault could not sleep; with write, a buffer the kernel is to
+// write is made writable first, so even that does not fault.
+// Returns -1 if a page can't be brought in.
+int
+uvmtouch(struct proc *p, uint va, uint n, int write)
+{
+  if(n == 0)
+    return 0;
+  if(uvmpin(p, va, n) < 0)
+    return -1;
+  return uvmrw(p, va, 0, n, write);
+}
+
+// Copy n bytes from p's user address va to dst, or from src to
+// va, faulting pages in as needed, a page at a time.
+int
+uvmcopyin(struct proc *p, void *dst, uint va, uint n)
+{
+  int r, npin;
+
+  npin = p->npin;
+  r = uvmpin(p, va, n) < 0 ? -1 : uvmrw(p, va, dst, n, 0);
+  p->npin = npin;
+  return r;
+}
+
+int
+uvmcopyout(struct proc *p, uint va, void *src, uint n)
+{
+  int r, npin;
+
+  npin = p->npin;
+  r = uvmpin(p, va, n) < 0 ? -1 : uvmrw(p, va, src, n, 1);
+  p->npin = npin;
+  return r;
+}
+
+// Copy the string at p's user address va, which must end within
+// max bytes, to dst, or only find its length if dst is 0.
+// Returns the length, or -1.
+int
+copyinstr(struct proc *p, char *dst, uint va, uint max)
+{
+  uint a, m, i, n;
+  char *ka;
+
+  for(n = 0; n < max; va += m){
+    a = PGROUNDDOWN(va);
+    m = PGSIZE - (va - a);
+    if(m > max - n)
+      m = max - n;
+    if(uvmrw(p, va, 0, 1, 0) < 0 || (ka = uva2ka(p->pgdir, (char*)a)) == 0)
+      return -1;
+    ka += va - a;
+    for(i = 0; i < m; i++, n++){
+      if(dst)
+        dst[n] = ka[i];
+      if(ka[i] == 0)
+        return n;
+    }
+  }
+  return -1;
+}
+
+// Choose a page of p to swap out for swapvictim(), continuing
+// the clock scan at *hand.  Candidates are private writable user
+// pages outside the pinned buffers that no other page table
+// shares; a page whose accessed bit is set gets it cleared and a
+// second chance.  The chosen PTE is pointed at slot.  Returns the
+// page's kernel address, or 0 once the scan reaches sz.
+// Called with p->lock held.
+char*
+uvmevict(struct proc *p, uint *hand, uint slot)
+{
+  pde_t *pde;
+  pte_t *pte;
+  uint a, pa;
+  int i;
+
+  for(a = PGROUNDDOWN(*hand); a < p->sz; a += PGSIZE){
+    pde = &p->pgdir[PDX(a)];
+    if(!(*pde & PTE_P) || (*pde & PTE_PS)){
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+      continue;
+    }
+    pte = &((pte_t*)P2V(PTE_ADDR(*pde)))[PTX(a)];
+    if((*pte & (PTE_P|PTE_U|PTE_W|PTE_SHARED)) != (PTE_P|PTE_U|PTE_W))
+      continue;
+    for(i = 0; i < p->npin; i++)
+      if(a + PGSIZE > p->pinva[i] && a < p->pinend[i])
+        break;
+    if(i < p->npin)
+      continue;
+    if(*pte & PTE_A){
+      *pte &= ~PTE_A;
+      continue;
+    }
+    pa = PTE_ADDR(*pte);
+    if(krefcnt(P2V(pa)) != 1)
+      continue;
+    *pte = (slot << PTXSHIFT) | PTE_SWAP;
+    rssadd(p, -1);
+    if(p == myproc())
+      invlpg((void*)a);
+    *hand = a + PGSIZE;
+    return P2V(pa);
+  }
+  *hand = a;
+  return 0;
+}
+
+// Read the swapped-out page at va back in.
+static int
+swapfault(struct proc *p, pte_t *pte, uint va)
+{
+  char *mem;
+  uint slot;
+
+  slot = PTE_ADDR(*pte) >> PTXSHIFT;
+  if((mem = allocpage(0)) == 0)
+    return -1;
+  swapin(mem, slot);
+  *pte = V2P(mem) | PTE_P | PTE_W | PTE_U;
+  rssadd(p, 1);
+  return 0;
+}
+
+// Is [va, va+n) user memory of p: below sz, or inside one
+// file-backed range?  Returns 0 if so, -1 if not.
+int
+uvmcheck(struct proc *p, uint va, uint n)
+{
+  struct vma *v;
+
+  if(va < p->sz && va + n <= p->sz && va + n >= va)
+    return 0;
+  if((v = vmalookup(p, va)) != 0 && va + n <= v->end && va + n >= va)
+    return 0;
+  return -1;
+}
+
+// Write the page src of a MAP_SHARED mapping back to ip at off,
+// a few blocks per log transaction like filewrite().  Only the
+// part inside the file is written; mmap() never grows a file.
+static void
+writeback(struct inode *ip, char *src, uint off)
+{
+  int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
+  uint i, n;
+
+  for(i = 0; i < PGSIZE; i += n){
+    begin_op();
+    ilock(ip);
+    n = 0;
+    if(off + i < ip->size){
+      n = ip->size - (off + i);
+      if(n > PGSIZE - i)
+        n = PGSIZE - i;
+      if(n > max)
+        n = max;
+      if(writei(ip, src + i, off + i, n) != n)
+        n = 0;
+    }
+    iunlock(ip);
+    end_op();
+    if(n == 0)
+      break;
+  }
+}
+
+// Unmap and free the pages of v in [start, end), first writing
+// the modified ones back if v is MAP_SHARED.  Returns the number
+// of pages unmapped.
+static int
+vmaunmap(pde_t *pgdir, struct vma *v, uint start, uint end)
+{
+  pte_t *pte;
+  uint a, pa;
+  int n;
+
+  n = 0;
+  for(a = start; a < end; a += PGSIZE){
+    if((pte = walkpgdir(pgdir, (char*)a, 0)) == 0 || !(*pte & PTE_P))
+      continue;
+    pa = PTE_ADDR(*pte);
+    if((v->flags & MAP_SHARED) && (*pte & PTE_D))
+      writeback(v->ip, P2V(pa), v->off + (a - v->start));
+    *pte = 0;
+    kfree(P2V(pa));
+    n++;
+  }
+  if(rcr3() == V2P(pgdir))
+    lcr3(V2P(pgdir));
+  return n;
+}
+
+// Release all the file-backed ranges in vma[], which belonged to
+// the address space pgdir: write back shared mappings, then drop
+// the inodes.  Used by exit() and exec().  pgdir is 0 if other
+// threads still use the address space: only the inodes go.
+void
+vmaput(pde_t *pgdir, struct vma *vma)
+{
+  struct vma *v;
+
+  for(v = vma; v < &vma[NVMA]; v++)
+    if(pgdir && v->ip && (v->flags & MAP_SHARED))
+      vmaunmap(pgdir, v, v->start, v->end);
+  begin_op();
+  for(v = vma; v < &vma[NVMA]; v++){
+    if(v->ip){
+      iput(v->ip);
+      v->ip = 0;
+    }
+  }
+  end_op();
+}
+
+// Remove [va, va+len) from p's mmap() area.  The range must lie
+// within one mapping; unmapping its middle splits it in two.
+// Returns 0, or -1 on a bad range.
+int
+munmap(struct proc *p, uint va, uint len)
+{
+  struct vma *v, *w;
+  uint end, d;
+
+  if(va % PGSIZE || len == 0)
+    return -1;
+  end = va + PGROUNDUP(len);
+  if(end < va || va < p->sz)
+    return -1;
+  if((v = vmalookup(p, va)) == 0 || end > v->end)
+    return -1;
+
+  if(va > v->start && end < v->end){
+    for(w = p->vma; w < &p->vma[NVMA] && w->ip; w++)
+      ;
+    if(w == &p->vma[NVMA])
+      return -1;
+    *w = *v;
+    idup(w->ip);
+    d = end - v->start;
+    w->start = end;
+    w->off += d;
+    w->filesz = w->filesz > d ? w->filesz - d : 0;
+    rssadd(p, -vmaunmap(p->pgdir, v, va, end));
+    v->end = va;
+    return 0;
+  }
 
-bad:
-  freevm(d);
+  rssadd(p, -vmaunmap(p->pgdir, v, va, end));
+  if(va == v->start && end == v->end){
+    begin_op();
+    iput(v->ip);
+    end_op();
+    v->ip = 0;
+  } else if(va == v->start){
+    d = end - v->start;
+    v->start = end;
+    v->off += d;
+    v->filesz = v->filesz > d ? v->filesz - d : 0;
+  } else {
+    v->end = va;
+  }
+  mmaprise(p);
   return 0;
 }
 
+// Something at the bottom of p's mmap() area may have gone: raise
+// mmapbot past the pages that no mapping or shared memory segment
+// uses any more, so that mmap() and sbrk() can have them again.
+void
+mmaprise(struct proc *p)
+{
+  pte_t *pte;
+
+  while(p->mmapbot < CLOCKPAGE && vmalookup(p, p->mmapbot) == 0 &&
+        ((pte = walkpgdir(p->pgdir, (char*)p->mmapbot, 0)) == 0 || *pte == 0))
+    p->mmapbot += PGSIZE;
+}
+
+// The process shrank to sz: pages above it must not come back
+// from the file if it grows again.  mmap() ranges are not affected.
+void
+vmatrim(struct proc *p, uint sz)
+{
+  struct vma *v;
+
+  sz = PGROUNDUP(sz);
+  for(v = p->vma; v < &p->vma[NVMA]; v++){
+    if(v->ip && v->start < p->mmapbot && v->end > sz)
+      v->end = v->start > sz ? v->start : sz;
+  }
+}
+
+// Handle a page fault at va in process p; err is the error code
+// the processor pushed (FEC_*).  Classifies the fault, counts it
+// for p and for this CPU, and resolves it if it can.  Returns 0 if
+// the faulting instruction can be restarted, -1 if not.
+static int
+vmfault1(struct proc *p, uint va, uint err)
+{
+  struct vma *v;
+  pte_t *pte;
+  int class, r;
+
+  r = -1;
+  if(va >= KERNBASE){
+    class = FAULT_BAD;
+  } else if(PGROUNDDOWN(va) == p->paginaInvalida){
+    class = FAULT_GUARD;
+  } else if(!(err & FEC_PR) && (pte = walkpgdir(p->pgdir, (char*)va, 0)) &&
+            (*pte & PTE_SWAP)){
+    class = FAULT_SWAP;
+    if((r = swapfault(p, pte, PGROUNDDOWN(va))) < 0){
+      cprintf("Out of memory\n");
+      class = FAULT_BAD;
+    }
+  } else if(err & FEC_PR){
+    class = FAULT_BAD;
+    if((err & FEC_WR) && cowfault(p->pgdir, va) == 0){
+      class = FAULT_COW;
+      r = 0;
+    }
+  } else if((v = vmalookup(p, va)) != 0){
+    class = FAULT_FILE;
+    if((err & FEC_WR) && !(v->prot & PROT_WRITE)){
+      class = FAULT_BAD;
+    } else if((r = filefault(p, v, va)) < 0){
+      cprintf("pid %d %s: cannot page in 0x%x\n", p->pid, p->name, va);
+      class = FAULT_BAD;
+    }
+  } else if(va >= p->sz){
+    class = FAULT_BAD;
+  } else {
+    class = (err & FEC_WR) ? FAULT_HEAP : FAULT_ZERO;
+    if((r = heapfault(p, va, err & FEC_WR)) < 0){
+      cprintf("Out of memory\n");
+      class = FAULT_BAD;
+    }
+  }
+
+  p->faults[class]++;
+  pushcli();
+  mycpu()->faults[class]++;
+  popcli();
+  return r;
+}
+
+// vmfault1(), serialized against the other threads of a shared
+// address space, any of which may have faulted on the same page
+// first: if the page is there now, the fault is already resolved.
+// A copy-on-write fault may replace a page that threads on other
+// CPUs still have in their TLBs.
+int
+vmfault(struct proc *p, uint va, uint err)
+{
+  pte_t *pte;
+  int r;
+
+  if(p->as == 0)
+    return vmfault1(p, va, err);
+  vmlock(p);
+  if(va < KERNBASE && (pte = walkpgdir(p->pgdir, (char*)va, 0)) != 0 &&
+     (*pte & (PTE_P|PTE_U)) == (PTE_P|PTE_U) &&
+     (!(err & FEC_WR) || (*pte & PTE_W))){
+    vmunlock(p);
+    return 0;
+  }
+  r = vmfault1(p, va, err);
+  if(r == 0 && (err & FEC_PR))
+    tlbshootdown();
+  vmunlock(p);
+  return r;
+}
+
+// Map the n pages page[] at va of p, writable and kept shared
+// across fork() (PTE_SHARED), each with a reference of its own.
+// Returns -1 if va is taken or there is no memory for page tables.
+int
+uvmshare(struct proc *p, uint va, char **page, int n)
+{
+  pte_t *pte;
+  int i;
+
+  for(i = 0; i < n; i++){
+    pte = walkpgdir(p->pgdir, (char*)va + i*PGSIZE, 0);
+    if(pte && *pte)
+      return -1;
+  }
+  for(i = 0; i < n; i++){
+    if(mappages(p->pgdir, (char*)va + i*PGSIZE, PGSIZE, V2P(page[i]),
+                PTE_W|PTE_U|PTE_SHARED) < 0){
+      uvmunshare(p, va, page, i);
+      return -1;
+    }
+    kincref(page[i]);
+    rssadd(p, 1);
+  }
+  return 0;
+}
+
+// Undo uvmshare(): unmap the n pages page[] from va and drop
+// their references.  Returns -1, leaving all of them mapped, if
+// they are not all there.
+int
+uvmunshare(struct proc *p, uint va, char **page, int n)
+{
+  pte_t *pte;
+  int i;
+
+  for(i = 0; i < n; i++){
+    pte = walkpgdir(p->pgdir, (char*)va + i*PGSIZE, 0);
+    if(pte == 0 || !(*pte & PTE_P) || PTE_ADDR(*pte) != V2P(page[i]))
+      return -1;
+  }
+  for(i = 0; i < n; i++){
+    pte = walkpgdir(p->pgdir, (char*)va + i*PGSIZE, 0);
+    *pte = 0;
+    kfree(page[i]);
+  }
+  rssadd(p, -n);
+  if(rcr3() == V2P(p->pgdir))
+    lcr3(V2P(p->pgdir));
+  return 0;
+}
+
+// Kernel address of the user word at va of p, which names the
+// word for futexes: threads, and processes sharing the page
+// (MAP_SHARED), all get the same address.  A copy-on-write page
+// is made private first, so that waiters do not share a page with
+// the zero page or with a forked process.  The caller must have
+// faulted the page in (argptr()).  Returns 0 if va is not usable.
+uint*
+futexaddr(struct proc *p, uint va)
+{
+  pte_t *pte;
+  char *k;
+
+  if(va % sizeof(uint))
+    return 0;
+  if((pte = walkpgdir(p->pgdir, (char*)va, 0)) == 0 || !(*pte & PTE_P))
+    return 0;
+  if((*pte & PTE_COW) && vmfault(p, va, FEC_PR|FEC_WR|FEC_U) < 0)
+    return 0;
+  if((k = uva2ka(p->pgdir, (char*)PGROUNDDOWN(va))) == 0)
+    return 0;
+  return (uint*)(k + va % PGSIZE);
+}
+
 //PAGEBREAK!
 // Map user virtual address to kernel address.
 char*
@@ -358,10 +1322,12 @@ uva2ka(pde_t *pgdir, char *uva)
   pte_t *pte;
 
   pte = walkpgdir(pgdir, uva, 0);
-  if((*pte & PTE_P) == 0)
+  if(pte == 0 || (*pte & PTE_P) == 0)
     return 0;
   if((*pte & PTE_U) == 0)
     return 0;
+  if(*pte & PTE_PS)
+    return (char*)P2V(PTE_ADDR(*pte) + ((uint)uva & (LPGSIZE-1)));
   return (char*)P2V(PTE_ADDR(*pte));
 }
 
@@ -0,0 +1,2879 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <wc>:
+
+char buf[512];
+
+void
+wc(int fd, char *name)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	57                   	push   %edi
+       4:	56                   	push   %esi
+       5:	53                   	push   %ebx
+       6:	83 ec 1c             	sub    $0x1c,%esp
+  int i, n;
+  int l, w, c, inword;
+
+  l = w = c = 0;
+  inword = 0;
+       9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  l = w = c = 0;
+      10:	be 00 00 00 00       	mov    $0x0,%esi
+      15:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+      1c:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+      23:	83 ec 04             	sub    $0x4,%esp
+      26:	68 00 02 00 00       	push   $0x200
+      2b:	68 a0 1a 00 00       	push   $0x1aa0
+      30:	ff 75 08             	push   0x8(%ebp)
+      33:	e8 88 08 00 00       	call   8c0 <read>
+      38:	89 c7                	mov    %eax,%edi
+      3a:	83 c4 10             	add    $0x10,%esp
+      3d:	85 c0                	test   %eax,%eax
+      3f:	7e 54                	jle    95 <wc+0x95>
+    for(i=0; i<n; i++){
+      41:	bb 00 00 00 00       	mov    $0x0,%ebx
+      46:	eb 22                	jmp    6a <wc+0x6a>
+      c++;
+      if(buf[i] == '\n')
+        l++;
+      if(strchr(" \r\t\n\v", buf[i]))
+      48:	83 ec 08             	sub    $0x8,%esp
+      4b:	0f be c0             	movsbl %al,%eax
+      4e:	50                   	push   %eax
+      4f:	68 f4 12 00 00       	push   $0x12f4
+      54:	e8 05 02 00 00       	call   25e <strchr>
+      59:	83 c4 10             	add    $0x10,%esp
+      5c:	85 c0                	test   %eax,%eax
+      5e:	74 22                	je     82 <wc+0x82>
+        inword = 0;
+      60:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    for(i=0; i<n; i++){
+      67:	83 c3 01             	add    $0x1,%ebx
+      6a:	39 fb                	cmp    %edi,%ebx
+      6c:	7d b5                	jge    23 <wc+0x23>
+      c++;
+      6e:	83 c6 01             	add    $0x1,%esi
+      if(buf[i] == '\n')
+      71:	0f b6 83 a0 1a 00 00 	movzbl 0x1aa0(%ebx),%eax
+      78:	3c 0a                	cmp    $0xa,%al
+      7a:	75 cc                	jne    48 <wc+0x48>
+        l++;
+      7c:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+      80:	eb c6                	jmp    48 <wc+0x48>
+      else if(!inword){
+      82:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+      86:	75 df                	jne    67 <wc+0x67>
+        w++;
+      88:	83 45 dc 01          	addl   $0x1,-0x24(%ebp)
+        inword = 1;
+      8c:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+      93:	eb d2                	jmp    67 <wc+0x67>
+      }
+    }
+  }
+  if(n < 0){
+      95:	78 24                	js     bb <wc+0xbb>
+    printf(1, "wc: read error\n");
+    exit();
+  }
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+      97:	83 ec 08             	sub    $0x8,%esp
+      9a:	ff 75 0c             	push   0xc(%ebp)
+      9d:	56                   	push   %esi
+      9e:	ff 75 dc             	push   -0x24(%ebp)
+      a1:	ff 75 e0             	push   -0x20(%ebp)
+      a4:	68 0a 13 00 00       	push   $0x130a
+      a9:	6a 01                	push   $0x1
+      ab:	e8 25 0c 00 00       	call   cd5 <printf>
+}
+      b0:	83 c4 20             	add    $0x20,%esp
+      b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      b6:	5b                   	pop    %ebx
+      b7:	5e                   	pop    %esi
+      b8:	5f                   	pop    %edi
+      b9:	5d                   	pop    %ebp
+      ba:	c3                   	ret
+    printf(1, "wc: read error\n");
+      bb:	83 ec 08             	sub    $0x8,%esp
+      be:	68 fa 12 00 00       	push   $0x12fa
+      c3:	6a 01                	push   $0x1
+      c5:	e8 0b 0c 00 00       	call   cd5 <printf>
+    exit();
+      ca:	e8 cd 06 00 00       	call   79c <exit>
+
+000000cf <main>:
+
+int
+main(int argc, char *argv[])
+{
+      cf:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+      d3:	83 e4 f0             	and    $0xfffffff0,%esp
+      d6:	ff 71 fc             	push   -0x4(%ecx)
+      d9:	55                   	push   %ebp
+      da:	89 e5                	mov    %esp,%ebp
+      dc:	57                   	push   %edi
+      dd:	56                   	push   %esi
+      de:	53                   	push   %ebx
+      df:	51                   	push   %ecx
+      e0:	83 ec 18             	sub    $0x18,%esp
+      e3:	8b 01                	mov    (%ecx),%eax
+      e5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      e8:	8b 51 04             	mov    0x4(%ecx),%edx
+      eb:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  int fd, i;
+
+  if(argc <= 1){
+      ee:	83 f8 01             	cmp    $0x1,%eax
+      f1:	7e 07                	jle    fa <main+0x2b>
+    wc(0, "");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+      f3:	be 01 00 00 00       	mov    $0x1,%esi
+      f8:	eb 2d                	jmp    127 <main+0x58>
+    wc(0, "");
+      fa:	83 ec 08             	sub    $0x8,%esp
+      fd:	68 09 13 00 00       	push   $0x1309
+     102:	6a 00                	push   $0x0
+     104:	e8 f7 fe ff ff       	call   0 <wc>
+    exit();
+     109:	e8 8e 06 00 00       	call   79c <exit>
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "wc: cannot open %s\n", argv[i]);
+      exit();
+    }
+    wc(fd, argv[i]);
+     10e:	83 ec 08             	sub    $0x8,%esp
+     111:	ff 37                	push   (%edi)
+     113:	50                   	push   %eax
+     114:	e8 e7 fe ff ff       	call   0 <wc>
+    close(fd);
+     119:	89 1c 24             	mov    %ebx,(%esp)
+     11c:	e8 aa 06 00 00       	call   7cb <close>
+  for(i = 1; i < argc; i++){
+     121:	83 c6 01             	add    $0x1,%esi
+     124:	83 c4 10             	add    $0x10,%esp
+     127:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     12a:	39 c6                	cmp    %eax,%esi
+     12c:	7d 31                	jge    15f <main+0x90>
+    if((fd = open(argv[i], 0)) < 0){
+     12e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     131:	8d 3c b0             	lea    (%eax,%esi,4),%edi
+     134:	83 ec 08             	sub    $0x8,%esp
+     137:	6a 00                	push   $0x0
+     139:	ff 37                	push   (%edi)
+     13b:	e8 ad 07 00 00       	call   8ed <open>
+     140:	89 c3                	mov    %eax,%ebx
+     142:	83 c4 10             	add    $0x10,%esp
+     145:	85 c0                	test   %eax,%eax
+     147:	79 c5                	jns    10e <main+0x3f>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+     149:	83 ec 04             	sub    $0x4,%esp
+     14c:	ff 37                	push   (%edi)
+     14e:	68 17 13 00 00       	push   $0x1317
+     153:	6a 01                	push   $0x1
+     155:	e8 7b 0b 00 00       	call   cd5 <printf>
+      exit();
+     15a:	e8 3d 06 00 00       	call   79c <exit>
+  }
+  exit();
+     15f:	e8 38 06 00 00       	call   79c <exit>
+
+00000164 <strcpy>:
+#include "memlayout.h"
+#include "clock.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     164:	55                   	push   %ebp
+     165:	89 e5                	mov    %esp,%ebp
+     167:	56                   	push   %esi
+     168:	53                   	push   %ebx
+     169:	8b 75 08             	mov    0x8(%ebp),%esi
+     16c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     16f:	89 f0                	mov    %esi,%eax
+     171:	89 d1                	mov    %edx,%ecx
+     173:	83 c2 01             	add    $0x1,%edx
+     176:	89 c3                	mov    %eax,%ebx
+     178:	83 c0 01             	add    $0x1,%eax
+     17b:	0f b6 09             	movzbl (%ecx),%ecx
+     17e:	88 0b                	mov    %cl,(%ebx)
+     180:	84 c9                	test   %cl,%cl
+     182:	75 ed                	jne    171 <strcpy+0xd>
+    ;
+  return os;
+}
+     184:	89 f0                	mov    %esi,%eax
+     186:	5b                   	pop    %ebx
+     187:	5e                   	pop    %esi
+     188:	5d                   	pop    %ebp
+     189:	c3                   	ret
+
+0000018a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     18a:	55                   	push   %ebp
+     18b:	89 e5                	mov    %esp,%ebp
+     18d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     190:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+     193:	eb 06                	jmp    19b <strcmp+0x11>
+    p++, q++;
+     195:	83 c1 01             	add    $0x1,%ecx
+     198:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+     19b:	0f b6 01             	movzbl (%ecx),%eax
+     19e:	84 c0                	test   %al,%al
+     1a0:	74 04                	je     1a6 <strcmp+0x1c>
+     1a2:	3a 02                	cmp    (%edx),%al
+     1a4:	74 ef                	je     195 <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+     1a6:	0f b6 c0             	movzbl %al,%eax
+     1a9:	0f b6 12             	movzbl (%edx),%edx
+     1ac:	29 d0                	sub    %edx,%eax
+}
+     1ae:	5d                   	pop    %ebp
+     1af:	c3                   	ret
+
+000001b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     1b0:	55                   	push   %ebp
+     1b1:	89 e5                	mov    %esp,%ebp
+     1b3:	53                   	push   %ebx
+     1b4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  const char *p;
+  uint w;
+
+  for(p = s; (uint)p & 3; p++)
+     1b7:	89 c8                	mov    %ecx,%eax
+     1b9:	eb 03                	jmp    1be <strlen+0xe>
+     1bb:	83 c0 01             	add    $0x1,%eax
+     1be:	a8 03                	test   $0x3,%al
+     1c0:	74 09                	je     1cb <strlen+0x1b>
+    if(*p == 0)
+     1c2:	80 38 00             	cmpb   $0x0,(%eax)
+     1c5:	75 f4                	jne    1bb <strlen+0xb>
+      return p - s;
+     1c7:	29 c8                	sub    %ecx,%eax
+     1c9:	eb 25                	jmp    1f0 <strlen+0x40>
+  // Then a word at a time, which never crosses into the next page:
+  // a word with a zero byte in it has one of these bits set.
+  for(;; p += 4){
+    w = *(uint*)p;
+     1cb:	8b 10                	mov    (%eax),%edx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     1cd:	8d 9a ff fe fe fe    	lea    -0x1010101(%edx),%ebx
+     1d3:	f7 d2                	not    %edx
+     1d5:	21 da                	and    %ebx,%edx
+     1d7:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+     1dd:	75 05                	jne    1e4 <strlen+0x34>
+  for(;; p += 4){
+     1df:	83 c0 04             	add    $0x4,%eax
+    w = *(uint*)p;
+     1e2:	eb e7                	jmp    1cb <strlen+0x1b>
+      break;
+  }
+  while(*p)
+     1e4:	80 38 00             	cmpb   $0x0,(%eax)
+     1e7:	74 05                	je     1ee <strlen+0x3e>
+    p++;
+     1e9:	83 c0 01             	add    $0x1,%eax
+     1ec:	eb f6                	jmp    1e4 <strlen+0x34>
+  return p - s;
+     1ee:	29 c8                	sub    %ecx,%eax
+}
+     1f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     1f3:	c9                   	leave
+     1f4:	c3                   	ret
+
+000001f5 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     1f5:	55                   	push   %ebp
+     1f6:	89 e5                	mov    %esp,%ebp
+     1f8:	57                   	push   %edi
+     1f9:	56                   	push   %esi
+     1fa:	53                   	push   %ebx
+     1fb:	8b 55 10             	mov    0x10(%ebp),%edx
+  uint h;
+  char *d;
+
+  d = dst;
+  c &= 0xFF;
+     1fe:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  if(n >= 16){
+     202:	83 fa 0f             	cmp    $0xf,%edx
+     205:	76 52                	jbe    259 <memset+0x64>
+    h = -(uint)d & 3;
+     207:	8b 45 08             	mov    0x8(%ebp),%eax
+     20a:	f7 d8                	neg    %eax
+     20c:	83 e0 03             	and    $0x3,%eax
+     20f:	89 c6                	mov    %eax,%esi
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     211:	8b 7d 08             	mov    0x8(%ebp),%edi
+     214:	89 c1                	mov    %eax,%ecx
+     216:	89 d8                	mov    %ebx,%eax
+     218:	fc                   	cld
+     219:	f3 aa                	rep stos %al,%es:(%edi)
+    stosb(d, c, h);
+    stosl(d + h, (c<<24)|(c<<16)|(c<<8)|c, (n - h)/4);
+     21b:	29 f2                	sub    %esi,%edx
+     21d:	89 d1                	mov    %edx,%ecx
+     21f:	c1 e9 02             	shr    $0x2,%ecx
+     222:	c1 e0 18             	shl    $0x18,%eax
+     225:	89 df                	mov    %ebx,%edi
+     227:	c1 e7 10             	shl    $0x10,%edi
+     22a:	09 f8                	or     %edi,%eax
+     22c:	89 df                	mov    %ebx,%edi
+     22e:	c1 e7 08             	shl    $0x8,%edi
+     231:	09 f8                	or     %edi,%eax
+     233:	09 d8                	or     %ebx,%eax
+     235:	89 f7                	mov    %esi,%edi
+     237:	03 7d 08             	add    0x8(%ebp),%edi
+}
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosl" :
+     23a:	fc                   	cld
+     23b:	f3 ab                	rep stos %eax,%es:(%edi)
+    d += h + (n - h)/4*4;
+     23d:	89 d7                	mov    %edx,%edi
+     23f:	83 e7 fc             	and    $0xfffffffc,%edi
+     242:	09 f7                	or     %esi,%edi
+     244:	03 7d 08             	add    0x8(%ebp),%edi
+    n = (n - h)%4;
+     247:	83 e2 03             	and    $0x3,%edx
+  asm volatile("cld; rep stosb" :
+     24a:	89 d1                	mov    %edx,%ecx
+     24c:	89 d8                	mov    %ebx,%eax
+     24e:	fc                   	cld
+     24f:	f3 aa                	rep stos %al,%es:(%edi)
+  }
+  stosb(d, c, n);
+  return dst;
+}
+     251:	8b 45 08             	mov    0x8(%ebp),%eax
+     254:	5b                   	pop    %ebx
+     255:	5e                   	pop    %esi
+     256:	5f                   	pop    %edi
+     257:	5d                   	pop    %ebp
+     258:	c3                   	ret
+  d = dst;
+     259:	8b 7d 08             	mov    0x8(%ebp),%edi
+     25c:	eb ec                	jmp    24a <memset+0x55>
+
+0000025e <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     25e:	55                   	push   %ebp
+     25f:	89 e5                	mov    %esp,%ebp
+     261:	8b 45 08             	mov    0x8(%ebp),%eax
+     264:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     268:	eb 03                	jmp    26d <strchr+0xf>
+     26a:	83 c0 01             	add    $0x1,%eax
+     26d:	0f b6 10             	movzbl (%eax),%edx
+     270:	84 d2                	test   %dl,%dl
+     272:	74 06                	je     27a <strchr+0x1c>
+    if(*s == c)
+     274:	38 ca                	cmp    %cl,%dl
+     276:	75 f2                	jne    26a <strchr+0xc>
+     278:	eb 05                	jmp    27f <strchr+0x21>
+      return (char*)s;
+  return 0;
+     27a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     27f:	5d                   	pop    %ebp
+     280:	c3                   	ret
+
+00000281 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     281:	55                   	push   %ebp
+     282:	89 e5                	mov    %esp,%ebp
+     284:	56                   	push   %esi
+     285:	53                   	push   %ebx
+     286:	8b 55 08             	mov    0x8(%ebp),%edx
+     289:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     28c:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  // A word at a time while they agree.
+  if((((uint)s1 | (uint)s2) & 3) == 0)
+     28f:	89 d3                	mov    %edx,%ebx
+     291:	09 cb                	or     %ecx,%ebx
+     293:	f6 c3 03             	test   $0x3,%bl
+     296:	74 24                	je     2bc <memcmp+0x3b>
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+      s1 += 4, s2 += 4;
+  while(n-- > 0){
+     298:	8d 70 ff             	lea    -0x1(%eax),%esi
+     29b:	85 c0                	test   %eax,%eax
+     29d:	74 32                	je     2d1 <memcmp+0x50>
+    if(*s1 != *s2)
+     29f:	0f b6 02             	movzbl (%edx),%eax
+     2a2:	0f b6 19             	movzbl (%ecx),%ebx
+     2a5:	38 d8                	cmp    %bl,%al
+     2a7:	75 20                	jne    2c9 <memcmp+0x48>
+      return *s1 - *s2;
+    s1++, s2++;
+     2a9:	83 c2 01             	add    $0x1,%edx
+     2ac:	83 c1 01             	add    $0x1,%ecx
+  while(n-- > 0){
+     2af:	89 f0                	mov    %esi,%eax
+     2b1:	eb e5                	jmp    298 <memcmp+0x17>
+      s1 += 4, s2 += 4;
+     2b3:	83 c2 04             	add    $0x4,%edx
+     2b6:	83 c1 04             	add    $0x4,%ecx
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+     2b9:	83 e8 04             	sub    $0x4,%eax
+     2bc:	83 f8 03             	cmp    $0x3,%eax
+     2bf:	76 d7                	jbe    298 <memcmp+0x17>
+     2c1:	8b 31                	mov    (%ecx),%esi
+     2c3:	39 32                	cmp    %esi,(%edx)
+     2c5:	74 ec                	je     2b3 <memcmp+0x32>
+     2c7:	eb cf                	jmp    298 <memcmp+0x17>
+      return *s1 - *s2;
+     2c9:	0f b6 c0             	movzbl %al,%eax
+     2cc:	0f b6 db             	movzbl %bl,%ebx
+     2cf:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     2d1:	5b                   	pop    %ebx
+     2d2:	5e                   	pop    %esi
+     2d3:	5d                   	pop    %ebp
+     2d4:	c3                   	ret
+
+000002d5 <memchr>:
+// The first c in the n bytes at v, or 0.  Once aligned, a word at
+// a time, with the word's bytes that equal c turned into zeroes
+// and those looked for.
+void*
+memchr(const void *v, int c, uint n)
+{
+     2d5:	55                   	push   %ebp
+     2d6:	89 e5                	mov    %esp,%ebp
+     2d8:	57                   	push   %edi
+     2d9:	56                   	push   %esi
+     2da:	53                   	push   %ebx
+     2db:	8b 45 08             	mov    0x8(%ebp),%eax
+     2de:	8b 55 10             	mov    0x10(%ebp),%edx
+  const uchar *s;
+  uint w, rep;
+
+  s = v;
+  c = (uchar)c;
+     2e1:	0f b6 75 0c          	movzbl 0xc(%ebp),%esi
+  for(; n > 0 && ((uint)s & 3); n--, s++)
+     2e5:	eb 06                	jmp    2ed <memchr+0x18>
+     2e7:	83 ea 01             	sub    $0x1,%edx
+     2ea:	83 c0 01             	add    $0x1,%eax
+     2ed:	85 d2                	test   %edx,%edx
+     2ef:	74 0d                	je     2fe <memchr+0x29>
+     2f1:	a8 03                	test   $0x3,%al
+     2f3:	74 09                	je     2fe <memchr+0x29>
+    if(*s == c)
+     2f5:	0f b6 08             	movzbl (%eax),%ecx
+     2f8:	39 f1                	cmp    %esi,%ecx
+     2fa:	75 eb                	jne    2e7 <memchr+0x12>
+     2fc:	eb 41                	jmp    33f <memchr+0x6a>
+      return (void*)s;
+  rep = c * 0x01010101;
+     2fe:	69 fe 01 01 01 01    	imul   $0x1010101,%esi,%edi
+  for(; n >= 4; n -= 4, s += 4){
+     304:	eb 06                	jmp    30c <memchr+0x37>
+     306:	83 ea 04             	sub    $0x4,%edx
+     309:	83 c0 04             	add    $0x4,%eax
+     30c:	83 fa 03             	cmp    $0x3,%edx
+     30f:	76 16                	jbe    327 <memchr+0x52>
+    w = *(uint*)s ^ rep;
+     311:	89 f9                	mov    %edi,%ecx
+     313:	33 08                	xor    (%eax),%ecx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     315:	8d 99 ff fe fe fe    	lea    -0x1010101(%ecx),%ebx
+     31b:	f7 d1                	not    %ecx
+     31d:	21 cb                	and    %ecx,%ebx
+     31f:	f7 c3 80 80 80 80    	test   $0x80808080,%ebx
+     325:	74 df                	je     306 <memchr+0x31>
+      break;
+  }
+  for(; n > 0; n--, s++)
+     327:	85 d2                	test   %edx,%edx
+     329:	74 0f                	je     33a <memchr+0x65>
+    if(*s == c)
+     32b:	0f b6 08             	movzbl (%eax),%ecx
+     32e:	39 f1                	cmp    %esi,%ecx
+     330:	74 0d                	je     33f <memchr+0x6a>
+  for(; n > 0; n--, s++)
+     332:	83 ea 01             	sub    $0x1,%edx
+     335:	83 c0 01             	add    $0x1,%eax
+     338:	eb ed                	jmp    327 <memchr+0x52>
+      return (void*)s;
+  return 0;
+     33a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     33f:	5b                   	pop    %ebx
+     340:	5e                   	pop    %esi
+     341:	5f                   	pop    %edi
+     342:	5d                   	pop    %ebp
+     343:	c3                   	ret
+
+00000344 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     344:	55                   	push   %ebp
+     345:	89 e5                	mov    %esp,%ebp
+     347:	57                   	push   %edi
+     348:	56                   	push   %esi
+     349:	53                   	push   %ebx
+     34a:	83 ec 1c             	sub    $0x1c,%esp
+     34d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     350:	bb 00 00 00 00       	mov    $0x0,%ebx
+     355:	89 de                	mov    %ebx,%esi
+     357:	83 c3 01             	add    $0x1,%ebx
+     35a:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     35d:	7d 2e                	jge    38d <gets+0x49>
+    cc = read(0, &c, 1);
+     35f:	83 ec 04             	sub    $0x4,%esp
+     362:	6a 01                	push   $0x1
+     364:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     367:	50                   	push   %eax
+     368:	6a 00                	push   $0x0
+     36a:	e8 51 05 00 00       	call   8c0 <read>
+    if(cc < 1)
+     36f:	83 c4 10             	add    $0x10,%esp
+     372:	85 c0                	test   %eax,%eax
+     374:	7e 17                	jle    38d <gets+0x49>
+      break;
+    buf[i++] = c;
+     376:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     37a:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+     37d:	3c 0a                	cmp    $0xa,%al
+     37f:	0f 94 c2             	sete   %dl
+     382:	3c 0d                	cmp    $0xd,%al
+     384:	0f 94 c0             	sete   %al
+     387:	08 c2                	or     %al,%dl
+     389:	74 ca                	je     355 <gets+0x11>
+    buf[i++] = c;
+     38b:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+     38d:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+     391:	89 f8                	mov    %edi,%eax
+     393:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     396:	5b                   	pop    %ebx
+     397:	5e                   	pop    %esi
+     398:	5f                   	pop    %edi
+     399:	5d                   	pop    %ebp
+     39a:	c3                   	ret
+
+0000039b <atoi>:
+  return r;
+}
+
+int
+atoi(const char *s)
+{
+     39b:	55                   	push   %ebp
+     39c:	89 e5                	mov    %esp,%ebp
+     39e:	53                   	push   %ebx
+     39f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+     3a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+     3a7:	eb 10                	jmp    3b9 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+     3a9:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+     3ac:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+     3af:	83 c1 01             	add    $0x1,%ecx
+     3b2:	0f be c0             	movsbl %al,%eax
+     3b5:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+     3b9:	0f b6 01             	movzbl (%ecx),%eax
+     3bc:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     3bf:	80 fb 09             	cmp    $0x9,%bl
+     3c2:	76 e5                	jbe    3a9 <atoi+0xe>
+  return n;
+}
+     3c4:	89 d0                	mov    %edx,%eax
+     3c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3c9:	c9                   	leave
+     3ca:	c3                   	ret
+
+000003cb <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     3cb:	55                   	push   %ebp
+     3cc:	89 e5                	mov    %esp,%ebp
+     3ce:	57                   	push   %edi
+     3cf:	56                   	push   %esi
+     3d0:	53                   	push   %ebx
+     3d1:	83 ec 08             	sub    $0x8,%esp
+     3d4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     3d7:	8b 55 0c             	mov    0xc(%ebp),%edx
+     3da:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *src;
+  int h;
+
+  dst = vdst;
+  src = vsrc;
+  if(n <= 0)
+     3dd:	85 c0                	test   %eax,%eax
+     3df:	0f 8e 82 00 00 00    	jle    467 <memmove+0x9c>
+    return vdst;
+  if(src < dst && src + n > dst){
+     3e5:	39 da                	cmp    %ebx,%edx
+     3e7:	73 07                	jae    3f0 <memmove+0x25>
+     3e9:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+     3ec:	39 cb                	cmp    %ecx,%ebx
+     3ee:	72 5e                	jb     44e <memmove+0x83>
+    movsbback(dst + n - 1, src + n - 1, n);
+    return vdst;
+  }
+  if(n >= 16 && (((uint)dst ^ (uint)src) & 3) == 0){
+     3f0:	83 f8 0f             	cmp    $0xf,%eax
+     3f3:	7e 69                	jle    45e <memmove+0x93>
+     3f5:	89 d9                	mov    %ebx,%ecx
+     3f7:	31 d1                	xor    %edx,%ecx
+     3f9:	f6 c1 03             	test   $0x3,%cl
+     3fc:	75 73                	jne    471 <memmove+0xa6>
+    h = -(uint)dst & 3;
+     3fe:	89 d9                	mov    %ebx,%ecx
+     400:	f7 d9                	neg    %ecx
+     402:	83 e1 03             	and    $0x3,%ecx
+}
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsb" :
+     405:	89 df                	mov    %ebx,%edi
+     407:	89 d6                	mov    %edx,%esi
+     409:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+     40c:	fc                   	cld
+     40d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    movsb(dst, src, h);
+    dst += h, src += h, n -= h;
+     40f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+     412:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+     415:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+     418:	29 f0                	sub    %esi,%eax
+    movsl(dst, src, n/4);
+     41a:	8d 50 03             	lea    0x3(%eax),%edx
+     41d:	0f 49 d0             	cmovns %eax,%edx
+     420:	c1 fa 02             	sar    $0x2,%edx
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+     423:	89 7d f0             	mov    %edi,-0x10(%ebp)
+     426:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     429:	89 ce                	mov    %ecx,%esi
+     42b:	89 d1                	mov    %edx,%ecx
+     42d:	fc                   	cld
+     42e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    dst += n/4*4, src += n/4*4, n %= 4;
+     430:	c1 e2 02             	shl    $0x2,%edx
+     433:	8b 7d f0             	mov    -0x10(%ebp),%edi
+     436:	01 d7                	add    %edx,%edi
+     438:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     43b:	01 ca                	add    %ecx,%edx
+     43d:	89 c6                	mov    %eax,%esi
+     43f:	c1 fe 1f             	sar    $0x1f,%esi
+     442:	c1 ee 1e             	shr    $0x1e,%esi
+     445:	01 f0                	add    %esi,%eax
+     447:	83 e0 03             	and    $0x3,%eax
+     44a:	29 f0                	sub    %esi,%eax
+     44c:	eb 12                	jmp    460 <memmove+0x95>
+    movsbback(dst + n - 1, src + n - 1, n);
+     44e:	8d 78 ff             	lea    -0x1(%eax),%edi
+     451:	8d 34 3a             	lea    (%edx,%edi,1),%esi
+     454:	01 df                	add    %ebx,%edi
+// Copy cnt bytes down from the last ones, at dst and src, to the
+// first: for overlapping moves up.
+static inline void
+movsbback(void *dst, const void *src, int cnt)
+{
+  asm volatile("std; rep movsb; cld" :
+     456:	89 c1                	mov    %eax,%ecx
+     458:	fd                   	std
+     459:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     45b:	fc                   	cld
+    return vdst;
+     45c:	eb 09                	jmp    467 <memmove+0x9c>
+  dst = vdst;
+     45e:	89 df                	mov    %ebx,%edi
+  asm volatile("cld; rep movsb" :
+     460:	89 d6                	mov    %edx,%esi
+     462:	89 c1                	mov    %eax,%ecx
+     464:	fc                   	cld
+     465:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  }
+  movsb(dst, src, n);
+  return vdst;
+}
+     467:	89 d8                	mov    %ebx,%eax
+     469:	83 c4 08             	add    $0x8,%esp
+     46c:	5b                   	pop    %ebx
+     46d:	5e                   	pop    %esi
+     46e:	5f                   	pop    %edi
+     46f:	5d                   	pop    %ebp
+     470:	c3                   	ret
+  dst = vdst;
+     471:	89 df                	mov    %ebx,%edi
+     473:	eb eb                	jmp    460 <memmove+0x95>
+
+00000475 <vclock_gettime>:
+
+// clock_gettime() without a system call: read the clock page
+// that the kernel maps at CLOCKPAGE (see clock.h).
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+     475:	55                   	push   %ebp
+     476:	89 e5                	mov    %esp,%ebp
+     478:	57                   	push   %edi
+     479:	56                   	push   %esi
+     47a:	53                   	push   %ebx
+     47b:	83 ec 14             	sub    $0x14,%esp
+  struct clockpage *cp = (struct clockpage*)CLOCKPAGE;
+  uint seq, rem, d;
+  uint64 tsc, ns, now;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+     47e:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     482:	0f 87 a3 00 00 00    	ja     52b <vclock_gettime+0xb6>
+    return -1;
+  do {
+    seq = cp->seq;
+     488:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+    __sync_synchronize();
+     48d:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    tsc = cp->tsc;
+     492:	8b 15 10 f0 ff 7f    	mov    0x7ffff010,%edx
+     498:	8b 1d 14 f0 ff 7f    	mov    0x7ffff014,%ebx
+    ns = cp->ns;
+     49e:	8b 35 18 f0 ff 7f    	mov    0x7ffff018,%esi
+     4a4:	8b 3d 1c f0 ff 7f    	mov    0x7ffff01c,%edi
+    __sync_synchronize();
+     4aa:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != cp->seq);
+     4af:	89 c1                	mov    %eax,%ecx
+     4b1:	83 e1 01             	and    $0x1,%ecx
+     4b4:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     4b7:	75 cf                	jne    488 <vclock_gettime+0x13>
+     4b9:	8b 0d 00 f0 ff 7f    	mov    0x7ffff000,%ecx
+     4bf:	39 c1                	cmp    %eax,%ecx
+     4c1:	75 c5                	jne    488 <vclock_gettime+0x13>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+     4c3:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     4c6:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     4c9:	0f 31                	rdtsc
+     4cb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     4ce:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     4d1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  now = rdtsc();
+  // Less than a tick has passed since the update, so the delta
+  // fits in 32 bits.
+  d = now > tsc ? now - tsc : 0;
+     4d4:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     4d7:	19 d3                	sbb    %edx,%ebx
+     4d9:	73 07                	jae    4e2 <vclock_gettime+0x6d>
+     4db:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+     4de:	29 d8                	sub    %ebx,%eax
+     4e0:	89 c1                	mov    %eax,%ecx
+  ns += ((uint64)d * cp->mult) >> cp->shift;
+     4e2:	89 c8                	mov    %ecx,%eax
+     4e4:	f7 25 04 f0 ff 7f    	mull   0x7ffff004
+     4ea:	0f b6 0d 08 f0 ff 7f 	movzbl 0x7ffff008,%ecx
+     4f1:	0f ad d0             	shrd   %cl,%edx,%eax
+     4f4:	d3 ea                	shr    %cl,%edx
+     4f6:	f6 c1 20             	test   $0x20,%cl
+     4f9:	74 04                	je     4ff <vclock_gettime+0x8a>
+     4fb:	89 d0                	mov    %edx,%eax
+     4fd:	31 d2                	xor    %edx,%edx
+     4ff:	01 f0                	add    %esi,%eax
+     501:	11 fa                	adc    %edi,%edx
+static inline uint
+divl(uint64 n, uint d, uint *r)
+{
+  uint q;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (*r) :
+     503:	bb 00 ca 9a 3b       	mov    $0x3b9aca00,%ebx
+     508:	f7 f3                	div    %ebx
+  ts->tv_sec = divl(ns, 1000000000, &rem);
+     50a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     50d:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = rem;
+     50f:	89 57 04             	mov    %edx,0x4(%edi)
+  if(clk == CLOCK_REALTIME)
+     512:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     516:	75 1a                	jne    532 <vclock_gettime+0xbd>
+    ts->tv_sec += cp->boottime;
+     518:	03 05 0c f0 ff 7f    	add    0x7ffff00c,%eax
+     51e:	89 07                	mov    %eax,(%edi)
+  return 0;
+     520:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     523:	83 c4 14             	add    $0x14,%esp
+     526:	5b                   	pop    %ebx
+     527:	5e                   	pop    %esi
+     528:	5f                   	pop    %edi
+     529:	5d                   	pop    %ebp
+     52a:	c3                   	ret
+    return -1;
+     52b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     530:	eb f1                	jmp    523 <vclock_gettime+0xae>
+  return 0;
+     532:	b8 00 00 00 00       	mov    $0x0,%eax
+     537:	eb ea                	jmp    523 <vclock_gettime+0xae>
+
+00000539 <flush>:
+
+// Write out fd's buffer, or with fd < 0 every buffer.
+// Returns -1 if a write fails.
+int
+flush(int fd)
+{
+     539:	55                   	push   %ebp
+     53a:	89 e5                	mov    %esp,%ebp
+     53c:	56                   	push   %esi
+     53d:	53                   	push   %ebx
+     53e:	8b 45 08             	mov    0x8(%ebp),%eax
+  int r, n;
+
+  if(fd < 0){
+     541:	85 c0                	test   %eax,%eax
+     543:	78 5d                	js     5a2 <flush+0x69>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+      if(flush(fd) < 0)
+        r = -1;
+    return r;
+  }
+  if(fd >= NOBUF || (n = obuf[fd].n) == 0)
+     545:	83 f8 0f             	cmp    $0xf,%eax
+     548:	7f 64                	jg     5ae <flush+0x75>
+     54a:	69 d0 08 02 00 00    	imul   $0x208,%eax,%edx
+     550:	8b b2 a4 1c 00 00    	mov    0x1ca4(%edx),%esi
+     556:	85 f6                	test   %esi,%esi
+     558:	74 59                	je     5b3 <flush+0x7a>
+    return 0;
+  obuf[fd].n = 0;
+     55a:	c7 82 a4 1c 00 00 00 	movl   $0x0,0x1ca4(%edx)
+     561:	00 00 00 
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     564:	81 c2 a8 1c 00 00    	add    $0x1ca8,%edx
+     56a:	83 ec 04             	sub    $0x4,%esp
+     56d:	56                   	push   %esi
+     56e:	52                   	push   %edx
+     56f:	50                   	push   %eax
+     570:	e8 5a 03 00 00       	call   8cf <write>
+     575:	83 c4 10             	add    $0x10,%esp
+     578:	39 f0                	cmp    %esi,%eax
+     57a:	75 40                	jne    5bc <flush+0x83>
+     57c:	be 00 00 00 00       	mov    $0x0,%esi
+     581:	eb 30                	jmp    5b3 <flush+0x7a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     583:	83 c3 01             	add    $0x1,%ebx
+     586:	83 fb 0f             	cmp    $0xf,%ebx
+     589:	7f 28                	jg     5b3 <flush+0x7a>
+      if(flush(fd) < 0)
+     58b:	83 ec 0c             	sub    $0xc,%esp
+     58e:	53                   	push   %ebx
+     58f:	e8 a5 ff ff ff       	call   539 <flush>
+     594:	83 c4 10             	add    $0x10,%esp
+     597:	85 c0                	test   %eax,%eax
+     599:	79 e8                	jns    583 <flush+0x4a>
+        r = -1;
+     59b:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     5a0:	eb e1                	jmp    583 <flush+0x4a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     5a2:	be 00 00 00 00       	mov    $0x0,%esi
+     5a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+     5ac:	eb d8                	jmp    586 <flush+0x4d>
+    return 0;
+     5ae:	be 00 00 00 00       	mov    $0x0,%esi
+}
+     5b3:	89 f0                	mov    %esi,%eax
+     5b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     5b8:	5b                   	pop    %ebx
+     5b9:	5e                   	pop    %esi
+     5ba:	5d                   	pop    %ebp
+     5bb:	c3                   	ret
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     5bc:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     5c1:	eb f0                	jmp    5b3 <flush+0x7a>
+
+000005c3 <bufreset>:
+
+static void
+bufreset(int fd)
+{
+  if(fd >= 0 && fd < NOBUF){
+     5c3:	83 f8 0f             	cmp    $0xf,%eax
+     5c6:	76 01                	jbe    5c9 <bufreset+0x6>
+     5c8:	c3                   	ret
+{
+     5c9:	55                   	push   %ebp
+     5ca:	89 e5                	mov    %esp,%ebp
+     5cc:	53                   	push   %ebx
+     5cd:	83 ec 10             	sub    $0x10,%esp
+     5d0:	89 c3                	mov    %eax,%ebx
+    flush(fd);
+     5d2:	50                   	push   %eax
+     5d3:	e8 61 ff ff ff       	call   539 <flush>
+    obuf[fd].mode = BUNKNOWN;
+     5d8:	69 db 08 02 00 00    	imul   $0x208,%ebx,%ebx
+     5de:	c7 83 a0 1c 00 00 00 	movl   $0x0,0x1ca0(%ebx)
+     5e5:	00 00 00 
+     5e8:	83 c4 10             	add    $0x10,%esp
+  }
+}
+     5eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     5ee:	c9                   	leave
+     5ef:	c3                   	ret
+
+000005f0 <bufwrite>:
+
+// Write n bytes from p to fd, through its buffer.
+// Returns n, or -1 if a write fails.
+int
+bufwrite(int fd, const void *p, int n)
+{
+     5f0:	55                   	push   %ebp
+     5f1:	89 e5                	mov    %esp,%ebp
+     5f3:	57                   	push   %edi
+     5f4:	56                   	push   %esi
+     5f5:	53                   	push   %ebx
+     5f6:	83 ec 3c             	sub    $0x3c,%esp
+     5f9:	8b 75 08             	mov    0x8(%ebp),%esi
+     5fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct stat st;
+  const char *s;
+  int i;
+
+  if(fd < 0 || fd >= NOBUF)
+     5ff:	83 fe 0f             	cmp    $0xf,%esi
+     602:	0f 87 a2 00 00 00    	ja     6aa <bufwrite+0xba>
+    return write(fd, p, n);
+  if(obuf[fd].mode == BUNKNOWN){
+     608:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     60e:	83 b8 a0 1c 00 00 00 	cmpl   $0x0,0x1ca0(%eax)
+     615:	75 19                	jne    630 <bufwrite+0x40>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     617:	83 fe 02             	cmp    $0x2,%esi
+     61a:	0f 85 9c 00 00 00    	jne    6bc <bufwrite+0xcc>
+      obuf[fd].mode = BNONE;
+     620:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     626:	c7 80 a0 1c 00 00 01 	movl   $0x1,0x1ca0(%eax)
+     62d:	00 00 00 
+    else
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+  }
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     630:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     636:	89 da                	mov    %ebx,%edx
+     638:	03 90 a4 1c 00 00    	add    0x1ca4(%eax),%edx
+     63e:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+     644:	0f 8f ae 00 00 00    	jg     6f8 <bufwrite+0x108>
+    return -1;
+  if(n >= OBUFSZ)
+     64a:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+     650:	0f 8f bd 00 00 00    	jg     713 <bufwrite+0x123>
+    return write(fd, p, n);
+  memmove(obuf[fd].buf + obuf[fd].n, p, n);
+     656:	69 d6 08 02 00 00    	imul   $0x208,%esi,%edx
+     65c:	8d ba a0 1c 00 00    	lea    0x1ca0(%edx),%edi
+     662:	8b 82 a4 1c 00 00    	mov    0x1ca4(%edx),%eax
+     668:	83 ec 04             	sub    $0x4,%esp
+     66b:	53                   	push   %ebx
+     66c:	ff 75 0c             	push   0xc(%ebp)
+     66f:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     672:	8d 84 10 a8 1c 00 00 	lea    0x1ca8(%eax,%edx,1),%eax
+     679:	50                   	push   %eax
+     67a:	e8 4c fd ff ff       	call   3cb <memmove>
+  obuf[fd].n += n;
+     67f:	01 5f 04             	add    %ebx,0x4(%edi)
+  if(obuf[fd].mode == BNONE)
+     682:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     685:	8b 82 a0 1c 00 00    	mov    0x1ca0(%edx),%eax
+     68b:	83 c4 10             	add    $0x10,%esp
+     68e:	83 f8 01             	cmp    $0x1,%eax
+     691:	0f 84 91 00 00 00    	je     728 <bufwrite+0x138>
+    return flush(fd) < 0 ? -1 : n;
+  if(obuf[fd].mode == BLINE)
+     697:	83 f8 02             	cmp    $0x2,%eax
+     69a:	0f 84 ca 00 00 00    	je     76a <bufwrite+0x17a>
+    for(s = p, i = 0; i < n; i++)
+      if(s[i] == '\n')
+        return flush(fd) < 0 ? -1 : n;
+  return n;
+     6a0:	89 d8                	mov    %ebx,%eax
+}
+     6a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     6a5:	5b                   	pop    %ebx
+     6a6:	5e                   	pop    %esi
+     6a7:	5f                   	pop    %edi
+     6a8:	5d                   	pop    %ebp
+     6a9:	c3                   	ret
+    return write(fd, p, n);
+     6aa:	83 ec 04             	sub    $0x4,%esp
+     6ad:	53                   	push   %ebx
+     6ae:	ff 75 0c             	push   0xc(%ebp)
+     6b1:	56                   	push   %esi
+     6b2:	e8 18 02 00 00       	call   8cf <write>
+     6b7:	83 c4 10             	add    $0x10,%esp
+     6ba:	eb e6                	jmp    6a2 <bufwrite+0xb2>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     6bc:	83 ec 08             	sub    $0x8,%esp
+     6bf:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     6c2:	50                   	push   %eax
+     6c3:	56                   	push   %esi
+     6c4:	e8 51 02 00 00       	call   91a <fstat>
+     6c9:	83 c4 10             	add    $0x10,%esp
+     6cc:	85 c0                	test   %eax,%eax
+     6ce:	0f 88 4c ff ff ff    	js     620 <bufwrite+0x30>
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+     6d4:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     6d9:	74 16                	je     6f1 <bufwrite+0x101>
+     6db:	ba 03 00 00 00       	mov    $0x3,%edx
+     6e0:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     6e6:	89 90 a0 1c 00 00    	mov    %edx,0x1ca0(%eax)
+     6ec:	e9 3f ff ff ff       	jmp    630 <bufwrite+0x40>
+     6f1:	ba 02 00 00 00       	mov    $0x2,%edx
+     6f6:	eb e8                	jmp    6e0 <bufwrite+0xf0>
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     6f8:	83 ec 0c             	sub    $0xc,%esp
+     6fb:	56                   	push   %esi
+     6fc:	e8 38 fe ff ff       	call   539 <flush>
+     701:	83 c4 10             	add    $0x10,%esp
+     704:	85 c0                	test   %eax,%eax
+     706:	0f 89 3e ff ff ff    	jns    64a <bufwrite+0x5a>
+    return -1;
+     70c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     711:	eb 8f                	jmp    6a2 <bufwrite+0xb2>
+    return write(fd, p, n);
+     713:	83 ec 04             	sub    $0x4,%esp
+     716:	53                   	push   %ebx
+     717:	ff 75 0c             	push   0xc(%ebp)
+     71a:	56                   	push   %esi
+     71b:	e8 af 01 00 00       	call   8cf <write>
+     720:	83 c4 10             	add    $0x10,%esp
+     723:	e9 7a ff ff ff       	jmp    6a2 <bufwrite+0xb2>
+    return flush(fd) < 0 ? -1 : n;
+     728:	83 ec 0c             	sub    $0xc,%esp
+     72b:	56                   	push   %esi
+     72c:	e8 08 fe ff ff       	call   539 <flush>
+     731:	83 c4 10             	add    $0x10,%esp
+     734:	85 c0                	test   %eax,%eax
+     736:	78 07                	js     73f <bufwrite+0x14f>
+     738:	89 d8                	mov    %ebx,%eax
+     73a:	e9 63 ff ff ff       	jmp    6a2 <bufwrite+0xb2>
+     73f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     744:	e9 59 ff ff ff       	jmp    6a2 <bufwrite+0xb2>
+        return flush(fd) < 0 ? -1 : n;
+     749:	83 ec 0c             	sub    $0xc,%esp
+     74c:	56                   	push   %esi
+     74d:	e8 e7 fd ff ff       	call   539 <flush>
+     752:	83 c4 10             	add    $0x10,%esp
+     755:	85 c0                	test   %eax,%eax
+     757:	78 07                	js     760 <bufwrite+0x170>
+     759:	89 d8                	mov    %ebx,%eax
+     75b:	e9 42 ff ff ff       	jmp    6a2 <bufwrite+0xb2>
+     760:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     765:	e9 38 ff ff ff       	jmp    6a2 <bufwrite+0xb2>
+    for(s = p, i = 0; i < n; i++)
+     76a:	b8 00 00 00 00       	mov    $0x0,%eax
+     76f:	39 d8                	cmp    %ebx,%eax
+     771:	7d 0e                	jge    781 <bufwrite+0x191>
+      if(s[i] == '\n')
+     773:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     776:	80 3c 01 0a          	cmpb   $0xa,(%ecx,%eax,1)
+     77a:	74 cd                	je     749 <bufwrite+0x159>
+    for(s = p, i = 0; i < n; i++)
+     77c:	83 c0 01             	add    $0x1,%eax
+     77f:	eb ee                	jmp    76f <bufwrite+0x17f>
+  return n;
+     781:	89 d8                	mov    %ebx,%eax
+     783:	e9 1a ff ff ff       	jmp    6a2 <bufwrite+0xb2>
+
+00000788 <fork>:
+
+int
+fork(void)
+{
+     788:	55                   	push   %ebp
+     789:	89 e5                	mov    %esp,%ebp
+     78b:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     78e:	6a ff                	push   $0xffffffff
+     790:	e8 a4 fd ff ff       	call   539 <flush>
+  return _fork();
+     795:	e8 bd 00 00 00       	call   857 <_fork>
+}
+     79a:	c9                   	leave
+     79b:	c3                   	ret
+
+0000079c <exit>:
+
+int
+exit(void)
+{
+     79c:	55                   	push   %ebp
+     79d:	89 e5                	mov    %esp,%ebp
+     79f:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     7a2:	6a ff                	push   $0xffffffff
+     7a4:	e8 90 fd ff ff       	call   539 <flush>
+  _exit();
+     7a9:	e8 b8 00 00 00       	call   866 <_exit>
+
+000007ae <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     7ae:	55                   	push   %ebp
+     7af:	89 e5                	mov    %esp,%ebp
+     7b1:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     7b4:	6a ff                	push   $0xffffffff
+     7b6:	e8 7e fd ff ff       	call   539 <flush>
+  return _exec(path, argv);
+     7bb:	83 c4 08             	add    $0x8,%esp
+     7be:	ff 75 0c             	push   0xc(%ebp)
+     7c1:	ff 75 08             	push   0x8(%ebp)
+     7c4:	e8 bb 00 00 00       	call   884 <_exec>
+}
+     7c9:	c9                   	leave
+     7ca:	c3                   	ret
+
+000007cb <close>:
+
+int
+close(int fd)
+{
+     7cb:	55                   	push   %ebp
+     7cc:	89 e5                	mov    %esp,%ebp
+     7ce:	53                   	push   %ebx
+     7cf:	83 ec 04             	sub    $0x4,%esp
+     7d2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bufreset(fd);
+     7d5:	89 d8                	mov    %ebx,%eax
+     7d7:	e8 e7 fd ff ff       	call   5c3 <bufreset>
+  return _close(fd);
+     7dc:	83 ec 0c             	sub    $0xc,%esp
+     7df:	53                   	push   %ebx
+     7e0:	e8 90 00 00 00       	call   875 <_close>
+}
+     7e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     7e8:	c9                   	leave
+     7e9:	c3                   	ret
+
+000007ea <stat>:
+{
+     7ea:	55                   	push   %ebp
+     7eb:	89 e5                	mov    %esp,%ebp
+     7ed:	56                   	push   %esi
+     7ee:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     7ef:	83 ec 08             	sub    $0x8,%esp
+     7f2:	6a 00                	push   $0x0
+     7f4:	ff 75 08             	push   0x8(%ebp)
+     7f7:	e8 f1 00 00 00       	call   8ed <open>
+  if(fd < 0)
+     7fc:	83 c4 10             	add    $0x10,%esp
+     7ff:	85 c0                	test   %eax,%eax
+     801:	78 24                	js     827 <stat+0x3d>
+     803:	89 c3                	mov    %eax,%ebx
+  r = fstat(fd, st);
+     805:	83 ec 08             	sub    $0x8,%esp
+     808:	ff 75 0c             	push   0xc(%ebp)
+     80b:	50                   	push   %eax
+     80c:	e8 09 01 00 00       	call   91a <fstat>
+     811:	89 c6                	mov    %eax,%esi
+  close(fd);
+     813:	89 1c 24             	mov    %ebx,(%esp)
+     816:	e8 b0 ff ff ff       	call   7cb <close>
+  return r;
+     81b:	83 c4 10             	add    $0x10,%esp
+}
+     81e:	89 f0                	mov    %esi,%eax
+     820:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     823:	5b                   	pop    %ebx
+     824:	5e                   	pop    %esi
+     825:	5d                   	pop    %ebp
+     826:	c3                   	ret
+    return -1;
+     827:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     82c:	eb f0                	jmp    81e <stat+0x34>
+
+0000082e <dup2>:
+
+int
+dup2(int oldfd, int newfd)
+{
+     82e:	55                   	push   %ebp
+     82f:	89 e5                	mov    %esp,%ebp
+     831:	56                   	push   %esi
+     832:	53                   	push   %ebx
+     833:	8b 75 08             	mov    0x8(%ebp),%esi
+     836:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(oldfd != newfd)
+     839:	39 de                	cmp    %ebx,%esi
+     83b:	75 11                	jne    84e <dup2+0x20>
+    bufreset(newfd);
+  return _dup2(oldfd, newfd);
+     83d:	83 ec 08             	sub    $0x8,%esp
+     840:	53                   	push   %ebx
+     841:	56                   	push   %esi
+     842:	e8 4c 00 00 00       	call   893 <_dup2>
+}
+     847:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     84a:	5b                   	pop    %ebx
+     84b:	5e                   	pop    %esi
+     84c:	5d                   	pop    %ebp
+     84d:	c3                   	ret
+    bufreset(newfd);
+     84e:	89 d8                	mov    %ebx,%eax
+     850:	e8 6e fd ff ff       	call   5c3 <bufreset>
+     855:	eb e6                	jmp    83d <dup2+0xf>
+
+00000857 <_fork>:
+  1: ret
+
+#define SYSCALL(name) STUB(name, SYS_ ## name)
+
+# ulib.c wraps these, to flush printf()'s buffers first.
+STUB(_fork, SYS_fork)
+     857:	b8 01 00 00 00       	mov    $0x1,%eax
+     85c:	89 e1                	mov    %esp,%ecx
+     85e:	ba 65 08 00 00       	mov    $0x865,%edx
+     863:	0f 34                	sysenter
+     865:	c3                   	ret
+
+00000866 <_exit>:
+STUB(_exit, SYS_exit)
+     866:	b8 02 00 00 00       	mov    $0x2,%eax
+     86b:	89 e1                	mov    %esp,%ecx
+     86d:	ba 74 08 00 00       	mov    $0x874,%edx
+     872:	0f 34                	sysenter
+     874:	c3                   	ret
+
+00000875 <_close>:
+STUB(_close, SYS_close)
+     875:	b8 15 00 00 00       	mov    $0x15,%eax
+     87a:	89 e1                	mov    %esp,%ecx
+     87c:	ba 83 08 00 00       	mov    $0x883,%edx
+     881:	0f 34                	sysenter
+     883:	c3                   	ret
+
+00000884 <_exec>:
+STUB(_exec, SYS_exec)
+     884:	b8 07 00 00 00       	mov    $0x7,%eax
+     889:	89 e1                	mov    %esp,%ecx
+     88b:	ba 92 08 00 00       	mov    $0x892,%edx
+     890:	0f 34                	sysenter
+     892:	c3                   	ret
+
+00000893 <_dup2>:
+STUB(_dup2, SYS_dup2)
+     893:	b8 17 00 00 00       	mov    $0x17,%eax
+     898:	89 e1                	mov    %esp,%ecx
+     89a:	ba a1 08 00 00       	mov    $0x8a1,%edx
+     89f:	0f 34                	sysenter
+     8a1:	c3                   	ret
+
+000008a2 <wait>:
+
+SYSCALL(wait)
+     8a2:	b8 03 00 00 00       	mov    $0x3,%eax
+     8a7:	89 e1                	mov    %esp,%ecx
+     8a9:	ba b0 08 00 00       	mov    $0x8b0,%edx
+     8ae:	0f 34                	sysenter
+     8b0:	c3                   	ret
+
+000008b1 <pipe>:
+SYSCALL(pipe)
+     8b1:	b8 04 00 00 00       	mov    $0x4,%eax
+     8b6:	89 e1                	mov    %esp,%ecx
+     8b8:	ba bf 08 00 00       	mov    $0x8bf,%edx
+     8bd:	0f 34                	sysenter
+     8bf:	c3                   	ret
+
+000008c0 <read>:
+SYSCALL(read)
+     8c0:	b8 05 00 00 00       	mov    $0x5,%eax
+     8c5:	89 e1                	mov    %esp,%ecx
+     8c7:	ba ce 08 00 00       	mov    $0x8ce,%edx
+     8cc:	0f 34                	sysenter
+     8ce:	c3                   	ret
+
+000008cf <write>:
+SYSCALL(write)
+     8cf:	b8 10 00 00 00       	mov    $0x10,%eax
+     8d4:	89 e1                	mov    %esp,%ecx
+     8d6:	ba dd 08 00 00       	mov    $0x8dd,%edx
+     8db:	0f 34                	sysenter
+     8dd:	c3                   	ret
+
+000008de <kill>:
+SYSCALL(kill)
+     8de:	b8 06 00 00 00       	mov    $0x6,%eax
+     8e3:	89 e1                	mov    %esp,%ecx
+     8e5:	ba ec 08 00 00       	mov    $0x8ec,%edx
+     8ea:	0f 34                	sysenter
+     8ec:	c3                   	ret
+
+000008ed <open>:
+SYSCALL(open)
+     8ed:	b8 0f 00 00 00       	mov    $0xf,%eax
+     8f2:	89 e1                	mov    %esp,%ecx
+     8f4:	ba fb 08 00 00       	mov    $0x8fb,%edx
+     8f9:	0f 34                	sysenter
+     8fb:	c3                   	ret
+
+000008fc <mknod>:
+SYSCALL(mknod)
+     8fc:	b8 11 00 00 00       	mov    $0x11,%eax
+     901:	89 e1                	mov    %esp,%ecx
+     903:	ba 0a 09 00 00       	mov    $0x90a,%edx
+     908:	0f 34                	sysenter
+     90a:	c3                   	ret
+
+0000090b <unlink>:
+SYSCALL(unlink)
+     90b:	b8 12 00 00 00       	mov    $0x12,%eax
+     910:	89 e1                	mov    %esp,%ecx
+     912:	ba 19 09 00 00       	mov    $0x919,%edx
+     917:	0f 34                	sysenter
+     919:	c3                   	ret
+
+0000091a <fstat>:
+SYSCALL(fstat)
+     91a:	b8 08 00 00 00       	mov    $0x8,%eax
+     91f:	89 e1                	mov    %esp,%ecx
+     921:	ba 28 09 00 00       	mov    $0x928,%edx
+     926:	0f 34                	sysenter
+     928:	c3                   	ret
+
+00000929 <link>:
+SYSCALL(link)
+     929:	b8 13 00 00 00       	mov    $0x13,%eax
+     92e:	89 e1                	mov    %esp,%ecx
+     930:	ba 37 09 00 00       	mov    $0x937,%edx
+     935:	0f 34                	sysenter
+     937:	c3                   	ret
+
+00000938 <mkdir>:
+SYSCALL(mkdir)
+     938:	b8 14 00 00 00       	mov    $0x14,%eax
+     93d:	89 e1                	mov    %esp,%ecx
+     93f:	ba 46 09 00 00       	mov    $0x946,%edx
+     944:	0f 34                	sysenter
+     946:	c3                   	ret
+
+00000947 <chdir>:
+SYSCALL(chdir)
+     947:	b8 09 00 00 00       	mov    $0x9,%eax
+     94c:	89 e1                	mov    %esp,%ecx
+     94e:	ba 55 09 00 00       	mov    $0x955,%edx
+     953:	0f 34                	sysenter
+     955:	c3                   	ret
+
+00000956 <dup>:
+SYSCALL(dup)
+     956:	b8 0a 00 00 00       	mov    $0xa,%eax
+     95b:	89 e1                	mov    %esp,%ecx
+     95d:	ba 64 09 00 00       	mov    $0x964,%edx
+     962:	0f 34                	sysenter
+     964:	c3                   	ret
+
+00000965 <getpid>:
+SYSCALL(getpid)
+     965:	b8 0b 00 00 00       	mov    $0xb,%eax
+     96a:	89 e1                	mov    %esp,%ecx
+     96c:	ba 73 09 00 00       	mov    $0x973,%edx
+     971:	0f 34                	sysenter
+     973:	c3                   	ret
+
+00000974 <sbrk>:
+SYSCALL(sbrk)
+     974:	b8 0c 00 00 00       	mov    $0xc,%eax
+     979:	89 e1                	mov    %esp,%ecx
+     97b:	ba 82 09 00 00       	mov    $0x982,%edx
+     980:	0f 34                	sysenter
+     982:	c3                   	ret
+
+00000983 <sleep>:
+SYSCALL(sleep)
+     983:	b8 0d 00 00 00       	mov    $0xd,%eax
+     988:	89 e1                	mov    %esp,%ecx
+     98a:	ba 91 09 00 00       	mov    $0x991,%edx
+     98f:	0f 34                	sysenter
+     991:	c3                   	ret
+
+00000992 <uptime>:
+SYSCALL(uptime)
+     992:	b8 0e 00 00 00       	mov    $0xe,%eax
+     997:	89 e1                	mov    %esp,%ecx
+     999:	ba a0 09 00 00       	mov    $0x9a0,%edx
+     99e:	0f 34                	sysenter
+     9a0:	c3                   	ret
+
+000009a1 <date>:
+SYSCALL(date)
+     9a1:	b8 16 00 00 00       	mov    $0x16,%eax
+     9a6:	89 e1                	mov    %esp,%ecx
+     9a8:	ba af 09 00 00       	mov    $0x9af,%edx
+     9ad:	0f 34                	sysenter
+     9af:	c3                   	ret
+
+000009b0 <faultaround>:
+SYSCALL(faultaround)
+     9b0:	b8 18 00 00 00       	mov    $0x18,%eax
+     9b5:	89 e1                	mov    %esp,%ecx
+     9b7:	ba be 09 00 00       	mov    $0x9be,%edx
+     9bc:	0f 34                	sysenter
+     9be:	c3                   	ret
+
+000009bf <faultstat>:
+SYSCALL(faultstat)
+     9bf:	b8 19 00 00 00       	mov    $0x19,%eax
+     9c4:	89 e1                	mov    %esp,%ecx
+     9c6:	ba cd 09 00 00       	mov    $0x9cd,%edx
+     9cb:	0f 34                	sysenter
+     9cd:	c3                   	ret
+
+000009ce <mmap>:
+SYSCALL(mmap)
+     9ce:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     9d3:	89 e1                	mov    %esp,%ecx
+     9d5:	ba dc 09 00 00       	mov    $0x9dc,%edx
+     9da:	0f 34                	sysenter
+     9dc:	c3                   	ret
+
+000009dd <munmap>:
+SYSCALL(munmap)
+     9dd:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     9e2:	89 e1                	mov    %esp,%ecx
+     9e4:	ba eb 09 00 00       	mov    $0x9eb,%edx
+     9e9:	0f 34                	sysenter
+     9eb:	c3                   	ret
+
+000009ec <largepages>:
+SYSCALL(largepages)
+     9ec:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     9f1:	89 e1                	mov    %esp,%ecx
+     9f3:	ba fa 09 00 00       	mov    $0x9fa,%edx
+     9f8:	0f 34                	sysenter
+     9fa:	c3                   	ret
+
+000009fb <spawn>:
+SYSCALL(spawn)
+     9fb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     a00:	89 e1                	mov    %esp,%ecx
+     a02:	ba 09 0a 00 00       	mov    $0xa09,%edx
+     a07:	0f 34                	sysenter
+     a09:	c3                   	ret
+
+00000a0a <setpriority>:
+SYSCALL(setpriority)
+     a0a:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     a0f:	89 e1                	mov    %esp,%ecx
+     a11:	ba 18 0a 00 00       	mov    $0xa18,%edx
+     a16:	0f 34                	sysenter
+     a18:	c3                   	ret
+
+00000a19 <getpriority>:
+SYSCALL(getpriority)
+     a19:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     a1e:	89 e1                	mov    %esp,%ecx
+     a20:	ba 27 0a 00 00       	mov    $0xa27,%edx
+     a25:	0f 34                	sysenter
+     a27:	c3                   	ret
+
+00000a28 <getprocinfo>:
+SYSCALL(getprocinfo)
+     a28:	b8 20 00 00 00       	mov    $0x20,%eax
+     a2d:	89 e1                	mov    %esp,%ecx
+     a2f:	ba 36 0a 00 00       	mov    $0xa36,%edx
+     a34:	0f 34                	sysenter
+     a36:	c3                   	ret
+
+00000a37 <getcpuinfo>:
+SYSCALL(getcpuinfo)
+     a37:	b8 21 00 00 00       	mov    $0x21,%eax
+     a3c:	89 e1                	mov    %esp,%ecx
+     a3e:	ba 45 0a 00 00       	mov    $0xa45,%edx
+     a43:	0f 34                	sysenter
+     a45:	c3                   	ret
+
+00000a46 <clone>:
+SYSCALL(clone)
+     a46:	b8 22 00 00 00       	mov    $0x22,%eax
+     a4b:	89 e1                	mov    %esp,%ecx
+     a4d:	ba 54 0a 00 00       	mov    $0xa54,%edx
+     a52:	0f 34                	sysenter
+     a54:	c3                   	ret
+
+00000a55 <join>:
+SYSCALL(join)
+     a55:	b8 23 00 00 00       	mov    $0x23,%eax
+     a5a:	89 e1                	mov    %esp,%ecx
+     a5c:	ba 63 0a 00 00       	mov    $0xa63,%edx
+     a61:	0f 34                	sysenter
+     a63:	c3                   	ret
+
+00000a64 <futex_wait>:
+SYSCALL(futex_wait)
+     a64:	b8 24 00 00 00       	mov    $0x24,%eax
+     a69:	89 e1                	mov    %esp,%ecx
+     a6b:	ba 72 0a 00 00       	mov    $0xa72,%edx
+     a70:	0f 34                	sysenter
+     a72:	c3                   	ret
+
+00000a73 <futex_wake>:
+SYSCALL(futex_wake)
+     a73:	b8 25 00 00 00       	mov    $0x25,%eax
+     a78:	89 e1                	mov    %esp,%ecx
+     a7a:	ba 81 0a 00 00       	mov    $0xa81,%edx
+     a7f:	0f 34                	sysenter
+     a81:	c3                   	ret
+
+00000a82 <setaffinity>:
+SYSCALL(setaffinity)
+     a82:	b8 26 00 00 00       	mov    $0x26,%eax
+     a87:	89 e1                	mov    %esp,%ecx
+     a89:	ba 90 0a 00 00       	mov    $0xa90,%edx
+     a8e:	0f 34                	sysenter
+     a90:	c3                   	ret
+
+00000a91 <getaffinity>:
+SYSCALL(getaffinity)
+     a91:	b8 27 00 00 00       	mov    $0x27,%eax
+     a96:	89 e1                	mov    %esp,%ecx
+     a98:	ba 9f 0a 00 00       	mov    $0xa9f,%edx
+     a9d:	0f 34                	sysenter
+     a9f:	c3                   	ret
+
+00000aa0 <clock_gettime>:
+SYSCALL(clock_gettime)
+     aa0:	b8 28 00 00 00       	mov    $0x28,%eax
+     aa5:	89 e1                	mov    %esp,%ecx
+     aa7:	ba ae 0a 00 00       	mov    $0xaae,%edx
+     aac:	0f 34                	sysenter
+     aae:	c3                   	ret
+
+00000aaf <msleep>:
+SYSCALL(msleep)
+     aaf:	b8 29 00 00 00       	mov    $0x29,%eax
+     ab4:	89 e1                	mov    %esp,%ecx
+     ab6:	ba bd 0a 00 00       	mov    $0xabd,%edx
+     abb:	0f 34                	sysenter
+     abd:	c3                   	ret
+
+00000abe <lockstat>:
+SYSCALL(lockstat)
+     abe:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     ac3:	89 e1                	mov    %esp,%ecx
+     ac5:	ba cc 0a 00 00       	mov    $0xacc,%edx
+     aca:	0f 34                	sysenter
+     acc:	c3                   	ret
+
+00000acd <bstat>:
+SYSCALL(bstat)
+     acd:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     ad2:	89 e1                	mov    %esp,%ecx
+     ad4:	ba db 0a 00 00       	mov    $0xadb,%edx
+     ad9:	0f 34                	sysenter
+     adb:	c3                   	ret
+
+00000adc <iostat>:
+SYSCALL(iostat)
+     adc:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     ae1:	89 e1                	mov    %esp,%ecx
+     ae3:	ba ea 0a 00 00       	mov    $0xaea,%edx
+     ae8:	0f 34                	sysenter
+     aea:	c3                   	ret
+
+00000aeb <fsync>:
+SYSCALL(fsync)
+     aeb:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     af0:	89 e1                	mov    %esp,%ecx
+     af2:	ba f9 0a 00 00       	mov    $0xaf9,%edx
+     af7:	0f 34                	sysenter
+     af9:	c3                   	ret
+
+00000afa <pread>:
+SYSCALL(pread)
+     afa:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     aff:	89 e1                	mov    %esp,%ecx
+     b01:	ba 08 0b 00 00       	mov    $0xb08,%edx
+     b06:	0f 34                	sysenter
+     b08:	c3                   	ret
+
+00000b09 <pwrite>:
+SYSCALL(pwrite)
+     b09:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     b0e:	89 e1                	mov    %esp,%ecx
+     b10:	ba 17 0b 00 00       	mov    $0xb17,%edx
+     b15:	0f 34                	sysenter
+     b17:	c3                   	ret
+
+00000b18 <readv>:
+SYSCALL(readv)
+     b18:	b8 30 00 00 00       	mov    $0x30,%eax
+     b1d:	89 e1                	mov    %esp,%ecx
+     b1f:	ba 26 0b 00 00       	mov    $0xb26,%edx
+     b24:	0f 34                	sysenter
+     b26:	c3                   	ret
+
+00000b27 <writev>:
+SYSCALL(writev)
+     b27:	b8 31 00 00 00       	mov    $0x31,%eax
+     b2c:	89 e1                	mov    %esp,%ecx
+     b2e:	ba 35 0b 00 00       	mov    $0xb35,%edx
+     b33:	0f 34                	sysenter
+     b35:	c3                   	ret
+
+00000b36 <sendfile>:
+SYSCALL(sendfile)
+     b36:	b8 32 00 00 00       	mov    $0x32,%eax
+     b3b:	89 e1                	mov    %esp,%ecx
+     b3d:	ba 44 0b 00 00       	mov    $0xb44,%edx
+     b42:	0f 34                	sysenter
+     b44:	c3                   	ret
+
+00000b45 <fcntl>:
+SYSCALL(fcntl)
+     b45:	b8 33 00 00 00       	mov    $0x33,%eax
+     b4a:	89 e1                	mov    %esp,%ecx
+     b4c:	ba 53 0b 00 00       	mov    $0xb53,%edx
+     b51:	0f 34                	sysenter
+     b53:	c3                   	ret
+
+00000b54 <mount>:
+SYSCALL(mount)
+     b54:	b8 34 00 00 00       	mov    $0x34,%eax
+     b59:	89 e1                	mov    %esp,%ecx
+     b5b:	ba 62 0b 00 00       	mov    $0xb62,%edx
+     b60:	0f 34                	sysenter
+     b62:	c3                   	ret
+
+00000b63 <getdents>:
+SYSCALL(getdents)
+     b63:	b8 35 00 00 00       	mov    $0x35,%eax
+     b68:	89 e1                	mov    %esp,%ecx
+     b6a:	ba 71 0b 00 00       	mov    $0xb71,%edx
+     b6f:	0f 34                	sysenter
+     b71:	c3                   	ret
+
+00000b72 <fstatat>:
+SYSCALL(fstatat)
+     b72:	b8 36 00 00 00       	mov    $0x36,%eax
+     b77:	89 e1                	mov    %esp,%ecx
+     b79:	ba 80 0b 00 00       	mov    $0xb80,%edx
+     b7e:	0f 34                	sysenter
+     b80:	c3                   	ret
+
+00000b81 <sysstat>:
+SYSCALL(sysstat)
+     b81:	b8 37 00 00 00       	mov    $0x37,%eax
+     b86:	89 e1                	mov    %esp,%ecx
+     b88:	ba 8f 0b 00 00       	mov    $0xb8f,%edx
+     b8d:	0f 34                	sysenter
+     b8f:	c3                   	ret
+
+00000b90 <ringenter>:
+SYSCALL(ringenter)
+     b90:	b8 38 00 00 00       	mov    $0x38,%eax
+     b95:	89 e1                	mov    %esp,%ecx
+     b97:	ba 9e 0b 00 00       	mov    $0xb9e,%edx
+     b9c:	0f 34                	sysenter
+     b9e:	c3                   	ret
+
+00000b9f <trace>:
+SYSCALL(trace)
+     b9f:	b8 39 00 00 00       	mov    $0x39,%eax
+     ba4:	89 e1                	mov    %esp,%ecx
+     ba6:	ba ad 0b 00 00       	mov    $0xbad,%edx
+     bab:	0f 34                	sysenter
+     bad:	c3                   	ret
+
+00000bae <memstat>:
+SYSCALL(memstat)
+     bae:	b8 3a 00 00 00       	mov    $0x3a,%eax
+     bb3:	89 e1                	mov    %esp,%ecx
+     bb5:	ba bc 0b 00 00       	mov    $0xbbc,%edx
+     bba:	0f 34                	sysenter
+     bbc:	c3                   	ret
+
+00000bbd <shmget>:
+SYSCALL(shmget)
+     bbd:	b8 3b 00 00 00       	mov    $0x3b,%eax
+     bc2:	89 e1                	mov    %esp,%ecx
+     bc4:	ba cb 0b 00 00       	mov    $0xbcb,%edx
+     bc9:	0f 34                	sysenter
+     bcb:	c3                   	ret
+
+00000bcc <shmat>:
+SYSCALL(shmat)
+     bcc:	b8 3c 00 00 00       	mov    $0x3c,%eax
+     bd1:	89 e1                	mov    %esp,%ecx
+     bd3:	ba da 0b 00 00       	mov    $0xbda,%edx
+     bd8:	0f 34                	sysenter
+     bda:	c3                   	ret
+
+00000bdb <shmdt>:
+SYSCALL(shmdt)
+     bdb:	b8 3d 00 00 00       	mov    $0x3d,%eax
+     be0:	89 e1                	mov    %esp,%ecx
+     be2:	ba e9 0b 00 00       	mov    $0xbe9,%edx
+     be7:	0f 34                	sysenter
+     be9:	c3                   	ret
+
+00000bea <irqstat>:
+SYSCALL(irqstat)
+     bea:	b8 3e 00 00 00       	mov    $0x3e,%eax
+     bef:	89 e1                	mov    %esp,%ecx
+     bf1:	ba f8 0b 00 00       	mov    $0xbf8,%edx
+     bf6:	0f 34                	sysenter
+     bf8:	c3                   	ret
+
+00000bf9 <irqroute>:
+SYSCALL(irqroute)
+     bf9:	b8 3f 00 00 00       	mov    $0x3f,%eax
+     bfe:	89 e1                	mov    %esp,%ecx
+     c00:	ba 07 0c 00 00       	mov    $0xc07,%edx
+     c05:	0f 34                	sysenter
+     c07:	c3                   	ret
+
+00000c08 <putc>:
+  char buf[64];
+};
+
+static void
+putc(struct out *o, char c)
+{
+     c08:	55                   	push   %ebp
+     c09:	89 e5                	mov    %esp,%ebp
+     c0b:	56                   	push   %esi
+     c0c:	53                   	push   %ebx
+     c0d:	89 c3                	mov    %eax,%ebx
+     c0f:	89 d6                	mov    %edx,%esi
+  if(o->n == sizeof(o->buf)){
+     c11:	8b 40 04             	mov    0x4(%eax),%eax
+     c14:	83 f8 40             	cmp    $0x40,%eax
+     c17:	74 16                	je     c2f <putc+0x27>
+    bufwrite(o->fd, o->buf, o->n);
+    o->n = 0;
+  }
+  o->buf[o->n++] = c;
+     c19:	8b 43 04             	mov    0x4(%ebx),%eax
+     c1c:	8d 50 01             	lea    0x1(%eax),%edx
+     c1f:	89 53 04             	mov    %edx,0x4(%ebx)
+     c22:	89 f1                	mov    %esi,%ecx
+     c24:	88 4c 03 08          	mov    %cl,0x8(%ebx,%eax,1)
+}
+     c28:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     c2b:	5b                   	pop    %ebx
+     c2c:	5e                   	pop    %esi
+     c2d:	5d                   	pop    %ebp
+     c2e:	c3                   	ret
+    bufwrite(o->fd, o->buf, o->n);
+     c2f:	8d 53 08             	lea    0x8(%ebx),%edx
+     c32:	83 ec 04             	sub    $0x4,%esp
+     c35:	50                   	push   %eax
+     c36:	52                   	push   %edx
+     c37:	ff 33                	push   (%ebx)
+     c39:	e8 b2 f9 ff ff       	call   5f0 <bufwrite>
+    o->n = 0;
+     c3e:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     c45:	83 c4 10             	add    $0x10,%esp
+     c48:	eb cf                	jmp    c19 <putc+0x11>
+
+00000c4a <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     c4a:	55                   	push   %ebp
+     c4b:	89 e5                	mov    %esp,%ebp
+     c4d:	57                   	push   %edi
+     c4e:	56                   	push   %esi
+     c4f:	53                   	push   %ebx
+     c50:	83 ec 2c             	sub    $0x2c,%esp
+     c53:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     c56:	89 d0                	mov    %edx,%eax
+     c58:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+     c5a:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     c5e:	0f 95 c1             	setne  %cl
+     c61:	c1 ea 1f             	shr    $0x1f,%edx
+     c64:	84 d1                	test   %dl,%cl
+     c66:	74 44                	je     cac <printint+0x62>
+    neg = 1;
+    x = -xx;
+     c68:	f7 d8                	neg    %eax
+     c6a:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+     c6c:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     c73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+     c78:	89 c8                	mov    %ecx,%eax
+     c7a:	ba 00 00 00 00       	mov    $0x0,%edx
+     c7f:	f7 f6                	div    %esi
+     c81:	89 df                	mov    %ebx,%edi
+     c83:	83 c3 01             	add    $0x1,%ebx
+     c86:	0f b6 92 8c 13 00 00 	movzbl 0x138c(%edx),%edx
+     c8d:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+     c91:	89 ca                	mov    %ecx,%edx
+     c93:	89 c1                	mov    %eax,%ecx
+     c95:	39 f2                	cmp    %esi,%edx
+     c97:	73 df                	jae    c78 <printint+0x2e>
+  if(neg)
+     c99:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     c9d:	74 31                	je     cd0 <printint+0x86>
+    buf[i++] = '-';
+     c9f:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+     ca4:	8d 5f 02             	lea    0x2(%edi),%ebx
+     ca7:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     caa:	eb 17                	jmp    cc3 <printint+0x79>
+    x = xx;
+     cac:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+     cae:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     cb5:	eb bc                	jmp    c73 <printint+0x29>
+
+  while(--i >= 0)
+    putc(o, buf[i]);
+     cb7:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+     cbc:	89 f0                	mov    %esi,%eax
+     cbe:	e8 45 ff ff ff       	call   c08 <putc>
+  while(--i >= 0)
+     cc3:	83 eb 01             	sub    $0x1,%ebx
+     cc6:	79 ef                	jns    cb7 <printint+0x6d>
+}
+     cc8:	83 c4 2c             	add    $0x2c,%esp
+     ccb:	5b                   	pop    %ebx
+     ccc:	5e                   	pop    %esi
+     ccd:	5f                   	pop    %edi
+     cce:	5d                   	pop    %ebp
+     ccf:	c3                   	ret
+     cd0:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     cd3:	eb ee                	jmp    cc3 <printint+0x79>
+
+00000cd5 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     cd5:	55                   	push   %ebp
+     cd6:	89 e5                	mov    %esp,%ebp
+     cd8:	57                   	push   %edi
+     cd9:	56                   	push   %esi
+     cda:	53                   	push   %ebx
+     cdb:	83 ec 6c             	sub    $0x6c,%esp
+  int c, i, state;
+  uint *ap;
+  struct out out, *o;
+
+  o = &out;
+  o->fd = fd;
+     cde:	8b 45 08             	mov    0x8(%ebp),%eax
+     ce1:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  o->n = 0;
+     ce4:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+     ceb:	8d 45 10             	lea    0x10(%ebp),%eax
+     cee:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  state = 0;
+     cf1:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+     cf6:	bb 00 00 00 00       	mov    $0x0,%ebx
+     cfb:	eb 14                	jmp    d11 <printf+0x3c>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(o, c);
+     cfd:	89 fa                	mov    %edi,%edx
+     cff:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d02:	e8 01 ff ff ff       	call   c08 <putc>
+     d07:	eb 05                	jmp    d0e <printf+0x39>
+      }
+    } else if(state == '%'){
+     d09:	83 fe 25             	cmp    $0x25,%esi
+     d0c:	74 25                	je     d33 <printf+0x5e>
+  for(i = 0; fmt[i]; i++){
+     d0e:	83 c3 01             	add    $0x1,%ebx
+     d11:	8b 45 0c             	mov    0xc(%ebp),%eax
+     d14:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+     d18:	84 c0                	test   %al,%al
+     d1a:	0f 84 20 01 00 00    	je     e40 <printf+0x16b>
+    c = fmt[i] & 0xff;
+     d20:	0f be f8             	movsbl %al,%edi
+     d23:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     d26:	85 f6                	test   %esi,%esi
+     d28:	75 df                	jne    d09 <printf+0x34>
+      if(c == '%'){
+     d2a:	83 f8 25             	cmp    $0x25,%eax
+     d2d:	75 ce                	jne    cfd <printf+0x28>
+        state = '%';
+     d2f:	89 c6                	mov    %eax,%esi
+     d31:	eb db                	jmp    d0e <printf+0x39>
+      if(c == 'd'){
+     d33:	83 f8 25             	cmp    $0x25,%eax
+     d36:	0f 84 cf 00 00 00    	je     e0b <printf+0x136>
+     d3c:	0f 8c dd 00 00 00    	jl     e1f <printf+0x14a>
+     d42:	83 f8 78             	cmp    $0x78,%eax
+     d45:	0f 8f d4 00 00 00    	jg     e1f <printf+0x14a>
+     d4b:	83 f8 63             	cmp    $0x63,%eax
+     d4e:	0f 8c cb 00 00 00    	jl     e1f <printf+0x14a>
+     d54:	83 e8 63             	sub    $0x63,%eax
+     d57:	83 f8 15             	cmp    $0x15,%eax
+     d5a:	0f 87 bf 00 00 00    	ja     e1f <printf+0x14a>
+     d60:	ff 24 85 34 13 00 00 	jmp    *0x1334(,%eax,4)
+        printint(o, *ap, 10, 1);
+     d67:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     d6a:	8b 17                	mov    (%edi),%edx
+     d6c:	83 ec 0c             	sub    $0xc,%esp
+     d6f:	6a 01                	push   $0x1
+     d71:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     d76:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     d79:	e8 cc fe ff ff       	call   c4a <printint>
+        ap++;
+     d7e:	83 c7 04             	add    $0x4,%edi
+     d81:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     d84:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(o, '%');
+        putc(o, c);
+      }
+      state = 0;
+     d87:	be 00 00 00 00       	mov    $0x0,%esi
+     d8c:	eb 80                	jmp    d0e <printf+0x39>
+        printint(o, *ap, 16, 0);
+     d8e:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     d91:	8b 17                	mov    (%edi),%edx
+     d93:	83 ec 0c             	sub    $0xc,%esp
+     d96:	6a 00                	push   $0x0
+     d98:	b9 10 00 00 00       	mov    $0x10,%ecx
+     d9d:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     da0:	e8 a5 fe ff ff       	call   c4a <printint>
+        ap++;
+     da5:	83 c7 04             	add    $0x4,%edi
+     da8:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     dab:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     dae:	be 00 00 00 00       	mov    $0x0,%esi
+     db3:	e9 56 ff ff ff       	jmp    d0e <printf+0x39>
+        s = (char*)*ap;
+     db8:	8b 45 94             	mov    -0x6c(%ebp),%eax
+     dbb:	8b 30                	mov    (%eax),%esi
+        ap++;
+     dbd:	83 c0 04             	add    $0x4,%eax
+     dc0:	89 45 94             	mov    %eax,-0x6c(%ebp)
+        if(s == 0)
+     dc3:	85 f6                	test   %esi,%esi
+     dc5:	75 15                	jne    ddc <printf+0x107>
+          s = "(null)";
+     dc7:	be 2b 13 00 00       	mov    $0x132b,%esi
+     dcc:	eb 0e                	jmp    ddc <printf+0x107>
+          putc(o, *s);
+     dce:	0f be d2             	movsbl %dl,%edx
+     dd1:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     dd4:	e8 2f fe ff ff       	call   c08 <putc>
+          s++;
+     dd9:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+     ddc:	0f b6 16             	movzbl (%esi),%edx
+     ddf:	84 d2                	test   %dl,%dl
+     de1:	75 eb                	jne    dce <printf+0xf9>
+      state = 0;
+     de3:	be 00 00 00 00       	mov    $0x0,%esi
+     de8:	e9 21 ff ff ff       	jmp    d0e <printf+0x39>
+        putc(o, *ap);
+     ded:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     df0:	0f be 17             	movsbl (%edi),%edx
+     df3:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     df6:	e8 0d fe ff ff       	call   c08 <putc>
+        ap++;
+     dfb:	83 c7 04             	add    $0x4,%edi
+     dfe:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+      state = 0;
+     e01:	be 00 00 00 00       	mov    $0x0,%esi
+     e06:	e9 03 ff ff ff       	jmp    d0e <printf+0x39>
+        putc(o, c);
+     e0b:	89 fa                	mov    %edi,%edx
+     e0d:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     e10:	e8 f3 fd ff ff       	call   c08 <putc>
+      state = 0;
+     e15:	be 00 00 00 00       	mov    $0x0,%esi
+     e1a:	e9 ef fe ff ff       	jmp    d0e <printf+0x39>
+        putc(o, '%');
+     e1f:	ba 25 00 00 00       	mov    $0x25,%edx
+     e24:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     e27:	e8 dc fd ff ff       	call   c08 <putc>
+        putc(o, c);
+     e2c:	89 fa                	mov    %edi,%edx
+     e2e:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     e31:	e8 d2 fd ff ff       	call   c08 <putc>
+      state = 0;
+     e36:	be 00 00 00 00       	mov    $0x0,%esi
+     e3b:	e9 ce fe ff ff       	jmp    d0e <printf+0x39>
+    }
+  }
+  if(o->n > 0)
+     e40:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     e43:	85 c0                	test   %eax,%eax
+     e45:	7f 08                	jg     e4f <printf+0x17a>
+    bufwrite(fd, o->buf, o->n);
+}
+     e47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     e4a:	5b                   	pop    %ebx
+     e4b:	5e                   	pop    %esi
+     e4c:	5f                   	pop    %edi
+     e4d:	5d                   	pop    %ebp
+     e4e:	c3                   	ret
+    bufwrite(fd, o->buf, o->n);
+     e4f:	83 ec 04             	sub    $0x4,%esp
+     e52:	50                   	push   %eax
+     e53:	8d 45 a8             	lea    -0x58(%ebp),%eax
+     e56:	50                   	push   %eax
+     e57:	ff 75 08             	push   0x8(%ebp)
+     e5a:	e8 91 f7 ff ff       	call   5f0 <bufwrite>
+     e5f:	83 c4 10             	add    $0x10,%esp
+}
+     e62:	eb e3                	jmp    e47 <printf+0x172>
+
+00000e64 <largefree>:
+  return &b->h;
+}
+
+static void
+largefree(Fblock *b)
+{
+     e64:	55                   	push   %ebp
+     e65:	89 e5                	mov    %esp,%ebp
+     e67:	57                   	push   %edi
+     e68:	56                   	push   %esi
+     e69:	53                   	push   %ebx
+     e6a:	83 ec 0c             	sub    $0xc,%esp
+     e6d:	89 c1                	mov    %eax,%ecx
+  Fblock **pp, *p, *prev;
+
+  prev = 0;
+     e6f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     e74:	ba 2c 3d 00 00       	mov    $0x3d2c,%edx
+     e79:	eb 05                	jmp    e80 <largefree+0x1c>
+     e7b:	8d 50 08             	lea    0x8(%eax),%edx
+    prev = p;
+     e7e:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     e80:	8b 02                	mov    (%edx),%eax
+     e82:	85 c0                	test   %eax,%eax
+     e84:	74 04                	je     e8a <largefree+0x26>
+     e86:	39 c8                	cmp    %ecx,%eax
+     e88:	72 f1                	jb     e7b <largefree+0x17>
+  b->next = p;
+     e8a:	89 41 08             	mov    %eax,0x8(%ecx)
+  if(p && (char*)b + b->h.size == (char*)p){
+     e8d:	85 c0                	test   %eax,%eax
+     e8f:	74 09                	je     e9a <largefree+0x36>
+     e91:	8b 31                	mov    (%ecx),%esi
+     e93:	8d 3c 31             	lea    (%ecx,%esi,1),%edi
+     e96:	39 c7                	cmp    %eax,%edi
+     e98:	74 21                	je     ebb <largefree+0x57>
+    b->h.size += p->h.size;
+    b->next = p->next;
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+     e9a:	85 db                	test   %ebx,%ebx
+     e9c:	74 09                	je     ea7 <largefree+0x43>
+     e9e:	8b 03                	mov    (%ebx),%eax
+     ea0:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+     ea3:	39 ce                	cmp    %ecx,%esi
+     ea5:	74 20                	je     ec7 <largefree+0x63>
+    prev->h.size += b->h.size;
+    prev->next = b->next;
+  } else
+    *pp = b;
+     ea7:	89 0a                	mov    %ecx,(%edx)
+
+  // Give the top of the heap back.  With threads sharing the
+  // address space sbrk() cannot shrink it; keep the block then.
+  for(pp = &large; (*pp)->next; pp = &(*pp)->next)
+     ea9:	be 2c 3d 00 00       	mov    $0x3d2c,%esi
+     eae:	8b 1e                	mov    (%esi),%ebx
+     eb0:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+     eb4:	74 1d                	je     ed3 <largefree+0x6f>
+     eb6:	8d 73 08             	lea    0x8(%ebx),%esi
+     eb9:	eb f3                	jmp    eae <largefree+0x4a>
+    b->h.size += p->h.size;
+     ebb:	03 30                	add    (%eax),%esi
+     ebd:	89 31                	mov    %esi,(%ecx)
+    b->next = p->next;
+     ebf:	8b 40 08             	mov    0x8(%eax),%eax
+     ec2:	89 41 08             	mov    %eax,0x8(%ecx)
+     ec5:	eb d3                	jmp    e9a <largefree+0x36>
+    prev->h.size += b->h.size;
+     ec7:	03 01                	add    (%ecx),%eax
+     ec9:	89 03                	mov    %eax,(%ebx)
+    prev->next = b->next;
+     ecb:	8b 41 08             	mov    0x8(%ecx),%eax
+     ece:	89 43 08             	mov    %eax,0x8(%ebx)
+     ed1:	eb d6                	jmp    ea9 <largefree+0x45>
+    ;
+  b = *pp;
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     ed3:	89 df                	mov    %ebx,%edi
+     ed5:	03 3b                	add    (%ebx),%edi
+     ed7:	83 ec 0c             	sub    $0xc,%esp
+     eda:	6a 00                	push   $0x0
+     edc:	e8 93 fa ff ff       	call   974 <sbrk>
+     ee1:	83 c4 10             	add    $0x10,%esp
+     ee4:	39 c7                	cmp    %eax,%edi
+     ee6:	74 08                	je     ef0 <largefree+0x8c>
+    *pp = 0;
+}
+     ee8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     eeb:	5b                   	pop    %ebx
+     eec:	5e                   	pop    %esi
+     eed:	5f                   	pop    %edi
+     eee:	5d                   	pop    %ebp
+     eef:	c3                   	ret
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     ef0:	8b 03                	mov    (%ebx),%eax
+     ef2:	f7 d8                	neg    %eax
+     ef4:	83 ec 0c             	sub    $0xc,%esp
+     ef7:	50                   	push   %eax
+     ef8:	e8 77 fa ff ff       	call   974 <sbrk>
+     efd:	83 c4 10             	add    $0x10,%esp
+     f00:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f03:	74 e3                	je     ee8 <largefree+0x84>
+    *pp = 0;
+     f05:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+     f0b:	eb db                	jmp    ee8 <largefree+0x84>
+
+00000f0d <more>:
+{
+     f0d:	55                   	push   %ebp
+     f0e:	89 e5                	mov    %esp,%ebp
+     f10:	56                   	push   %esi
+     f11:	53                   	push   %ebx
+     f12:	89 c6                	mov    %eax,%esi
+  pad = -(uint)sbrk(0) & 7;
+     f14:	83 ec 0c             	sub    $0xc,%esp
+     f17:	6a 00                	push   $0x0
+     f19:	e8 56 fa ff ff       	call   974 <sbrk>
+     f1e:	f7 d8                	neg    %eax
+     f20:	89 c3                	mov    %eax,%ebx
+     f22:	83 e3 07             	and    $0x7,%ebx
+  if((p = sbrk(n + pad)) == (char*)-1)
+     f25:	01 de                	add    %ebx,%esi
+     f27:	89 34 24             	mov    %esi,(%esp)
+     f2a:	e8 45 fa ff ff       	call   974 <sbrk>
+     f2f:	83 c4 10             	add    $0x10,%esp
+     f32:	83 f8 ff             	cmp    $0xffffffff,%eax
+     f35:	74 09                	je     f40 <more+0x33>
+  return p + pad;
+     f37:	01 d8                	add    %ebx,%eax
+}
+     f39:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f3c:	5b                   	pop    %ebx
+     f3d:	5e                   	pop    %esi
+     f3e:	5d                   	pop    %ebp
+     f3f:	c3                   	ret
+    return 0;
+     f40:	b8 00 00 00 00       	mov    $0x0,%eax
+     f45:	eb f2                	jmp    f39 <more+0x2c>
+
+00000f47 <slaballoc>:
+{
+     f47:	55                   	push   %ebp
+     f48:	89 e5                	mov    %esp,%ebp
+     f4a:	56                   	push   %esi
+     f4b:	53                   	push   %ebx
+     f4c:	89 c6                	mov    %eax,%esi
+  n = 1 << (MINSHIFT + c);
+     f4e:	8d 48 04             	lea    0x4(%eax),%ecx
+     f51:	bb 01 00 00 00       	mov    $0x1,%ebx
+     f56:	d3 e3                	shl    %cl,%ebx
+  if(slab + n > slabend){
+     f58:	89 d8                	mov    %ebx,%eax
+     f5a:	03 05 28 3d 00 00    	add    0x3d28,%eax
+     f60:	39 05 24 3d 00 00    	cmp    %eax,0x3d24
+     f66:	72 17                	jb     f7f <slaballoc+0x38>
+  h = (Header*)slab;
+     f68:	a1 28 3d 00 00       	mov    0x3d28,%eax
+  slab += n;
+     f6d:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+     f70:	89 15 28 3d 00 00    	mov    %edx,0x3d28
+  h->size = n;
+     f76:	89 18                	mov    %ebx,(%eax)
+  h->class = c;
+     f78:	89 70 04             	mov    %esi,0x4(%eax)
+}
+     f7b:	5b                   	pop    %ebx
+     f7c:	5e                   	pop    %esi
+     f7d:	5d                   	pop    %ebp
+     f7e:	c3                   	ret
+    if((p = more(SLABSZ)) == 0)
+     f7f:	b8 00 40 00 00       	mov    $0x4000,%eax
+     f84:	e8 84 ff ff ff       	call   f0d <more>
+     f89:	85 c0                	test   %eax,%eax
+     f8b:	74 ee                	je     f7b <slaballoc+0x34>
+    if(p != slabend)
+     f8d:	39 05 24 3d 00 00    	cmp    %eax,0x3d24
+     f93:	74 05                	je     f9a <slaballoc+0x53>
+      slab = p;
+     f95:	a3 28 3d 00 00       	mov    %eax,0x3d28
+    slabend = p + SLABSZ;
+     f9a:	05 00 40 00 00       	add    $0x4000,%eax
+     f9f:	a3 24 3d 00 00       	mov    %eax,0x3d24
+     fa4:	eb c2                	jmp    f68 <slaballoc+0x21>
+
+00000fa6 <largealloc>:
+{
+     fa6:	55                   	push   %ebp
+     fa7:	89 e5                	mov    %esp,%ebp
+     fa9:	56                   	push   %esi
+     faa:	53                   	push   %ebx
+     fab:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     fad:	b9 2c 3d 00 00       	mov    $0x3d2c,%ecx
+     fb2:	8b 01                	mov    (%ecx),%eax
+     fb4:	85 c0                	test   %eax,%eax
+     fb6:	74 36                	je     fee <largealloc+0x48>
+    if(b->h.size < n)
+     fb8:	8b 10                	mov    (%eax),%edx
+     fba:	39 da                	cmp    %ebx,%edx
+     fbc:	72 24                	jb     fe2 <largealloc+0x3c>
+    if(b->h.size - n > SMALLMAX){
+     fbe:	29 da                	sub    %ebx,%edx
+     fc0:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+     fc6:	76 1f                	jbe    fe7 <largealloc+0x41>
+      rest = (Fblock*)((char*)b + n);
+     fc8:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+      rest->h.size = b->h.size - n;
+     fcb:	89 16                	mov    %edx,(%esi)
+      rest->h.class = LARGE;
+     fcd:	c7 46 04 09 00 00 00 	movl   $0x9,0x4(%esi)
+      rest->next = b->next;
+     fd4:	8b 50 08             	mov    0x8(%eax),%edx
+     fd7:	89 56 08             	mov    %edx,0x8(%esi)
+      *pp = rest;
+     fda:	89 31                	mov    %esi,(%ecx)
+      b->h.size = n;
+     fdc:	89 18                	mov    %ebx,(%eax)
+}
+     fde:	5b                   	pop    %ebx
+     fdf:	5e                   	pop    %esi
+     fe0:	5d                   	pop    %ebp
+     fe1:	c3                   	ret
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     fe2:	8d 48 08             	lea    0x8(%eax),%ecx
+     fe5:	eb cb                	jmp    fb2 <largealloc+0xc>
+      *pp = b->next;
+     fe7:	8b 50 08             	mov    0x8(%eax),%edx
+     fea:	89 11                	mov    %edx,(%ecx)
+    return &b->h;
+     fec:	eb f0                	jmp    fde <largealloc+0x38>
+  if((b = more(n)) == 0)
+     fee:	89 d8                	mov    %ebx,%eax
+     ff0:	e8 18 ff ff ff       	call   f0d <more>
+     ff5:	85 c0                	test   %eax,%eax
+     ff7:	74 e5                	je     fde <largealloc+0x38>
+  b->h.size = n;
+     ff9:	89 18                	mov    %ebx,(%eax)
+  b->h.class = LARGE;
+     ffb:	c7 40 04 09 00 00 00 	movl   $0x9,0x4(%eax)
+  return &b->h;
+    1002:	eb da                	jmp    fde <largealloc+0x38>
+
+00001004 <free>:
+
+void
+free(void *ap)
+{
+    1004:	55                   	push   %ebp
+    1005:	89 e5                	mov    %esp,%ebp
+    1007:	56                   	push   %esi
+    1008:	53                   	push   %ebx
+    1009:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+
+  if(ap == 0)
+    100c:	85 db                	test   %ebx,%ebx
+    100e:	74 3b                	je     104b <free+0x47>
+    return;
+  h = (Header*)ap - 1;
+    1010:	8d 73 f8             	lea    -0x8(%ebx),%esi
+  lock_acquire(&lock);
+    1013:	83 ec 0c             	sub    $0xc,%esp
+    1016:	68 20 3d 00 00       	push   $0x3d20
+    101b:	e8 9c 01 00 00       	call   11bc <lock_acquire>
+  if(h->class == LARGE)
+    1020:	8b 43 fc             	mov    -0x4(%ebx),%eax
+    1023:	83 c4 10             	add    $0x10,%esp
+    1026:	83 f8 09             	cmp    $0x9,%eax
+    1029:	74 27                	je     1052 <free+0x4e>
+    largefree((Fblock*)h);
+  else {
+    ((Fblock*)h)->next = freelist[h->class];
+    102b:	8b 14 85 40 3d 00 00 	mov    0x3d40(,%eax,4),%edx
+    1032:	89 13                	mov    %edx,(%ebx)
+    freelist[h->class] = (Fblock*)h;
+    1034:	89 34 85 40 3d 00 00 	mov    %esi,0x3d40(,%eax,4)
+  }
+  lock_release(&lock);
+    103b:	83 ec 0c             	sub    $0xc,%esp
+    103e:	68 20 3d 00 00       	push   $0x3d20
+    1043:	e8 88 01 00 00       	call   11d0 <lock_release>
+    1048:	83 c4 10             	add    $0x10,%esp
+}
+    104b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    104e:	5b                   	pop    %ebx
+    104f:	5e                   	pop    %esi
+    1050:	5d                   	pop    %ebp
+    1051:	c3                   	ret
+    largefree((Fblock*)h);
+    1052:	89 f0                	mov    %esi,%eax
+    1054:	e8 0b fe ff ff       	call   e64 <largefree>
+    1059:	eb e0                	jmp    103b <free+0x37>
+
+0000105b <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    105b:	55                   	push   %ebp
+    105c:	89 e5                	mov    %esp,%ebp
+    105e:	53                   	push   %ebx
+    105f:	83 ec 04             	sub    $0x4,%esp
+    1062:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+  uint n;
+  int c;
+
+  if(nbytes > 0x7fffffff - sizeof(Header) - 7)
+    1065:	81 fb f0 ff ff 7f    	cmp    $0x7ffffff0,%ebx
+    106b:	0f 87 8b 00 00 00    	ja     10fc <malloc+0xa1>
+    return 0;
+  n = (nbytes + sizeof(Header) + 7) & ~7;
+    1071:	83 c3 0f             	add    $0xf,%ebx
+    1074:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(n < sizeof(Fblock))
+    1077:	83 fb 0b             	cmp    $0xb,%ebx
+    107a:	77 05                	ja     1081 <malloc+0x26>
+    n = sizeof(Fblock);
+    107c:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  lock_acquire(&lock);
+    1081:	83 ec 0c             	sub    $0xc,%esp
+    1084:	68 20 3d 00 00       	push   $0x3d20
+    1089:	e8 2e 01 00 00       	call   11bc <lock_acquire>
+  if(n <= SMALLMAX){
+    108e:	83 c4 10             	add    $0x10,%esp
+    1091:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+    1097:	77 58                	ja     10f1 <malloc+0x96>
+    for(c = 0; (1 << (MINSHIFT + c)) < n; c++)
+    1099:	ba 00 00 00 00       	mov    $0x0,%edx
+    109e:	eb 03                	jmp    10a3 <malloc+0x48>
+    10a0:	83 c2 01             	add    $0x1,%edx
+    10a3:	8d 4a 04             	lea    0x4(%edx),%ecx
+    10a6:	b8 01 00 00 00       	mov    $0x1,%eax
+    10ab:	d3 e0                	shl    %cl,%eax
+    10ad:	39 d8                	cmp    %ebx,%eax
+    10af:	72 ef                	jb     10a0 <malloc+0x45>
+      ;
+    if(freelist[c]){
+    10b1:	8b 04 95 40 3d 00 00 	mov    0x3d40(,%edx,4),%eax
+    10b8:	85 c0                	test   %eax,%eax
+    10ba:	74 2a                	je     10e6 <malloc+0x8b>
+      h = &freelist[c]->h;
+    10bc:	89 c3                	mov    %eax,%ebx
+      freelist[c] = freelist[c]->next;
+    10be:	8b 40 08             	mov    0x8(%eax),%eax
+    10c1:	89 04 95 40 3d 00 00 	mov    %eax,0x3d40(,%edx,4)
+    } else
+      h = slaballoc(c);
+  } else
+    h = largealloc(n);
+  lock_release(&lock);
+    10c8:	83 ec 0c             	sub    $0xc,%esp
+    10cb:	68 20 3d 00 00       	push   $0x3d20
+    10d0:	e8 fb 00 00 00       	call   11d0 <lock_release>
+  return h ? (void*)(h + 1) : 0;
+    10d5:	83 c4 10             	add    $0x10,%esp
+    10d8:	85 db                	test   %ebx,%ebx
+    10da:	74 03                	je     10df <malloc+0x84>
+    10dc:	83 c3 08             	add    $0x8,%ebx
+}
+    10df:	89 d8                	mov    %ebx,%eax
+    10e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    10e4:	c9                   	leave
+    10e5:	c3                   	ret
+      h = slaballoc(c);
+    10e6:	89 d0                	mov    %edx,%eax
+    10e8:	e8 5a fe ff ff       	call   f47 <slaballoc>
+    10ed:	89 c3                	mov    %eax,%ebx
+    10ef:	eb d7                	jmp    10c8 <malloc+0x6d>
+    h = largealloc(n);
+    10f1:	89 d8                	mov    %ebx,%eax
+    10f3:	e8 ae fe ff ff       	call   fa6 <largealloc>
+    10f8:	89 c3                	mov    %eax,%ebx
+    10fa:	eb cc                	jmp    10c8 <malloc+0x6d>
+    return 0;
+    10fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+    1101:	eb dc                	jmp    10df <malloc+0x84>
+
+00001103 <tstart>:
+  void *arg;
+};
+
+static void
+tstart(void *a)
+{
+    1103:	55                   	push   %ebp
+    1104:	89 e5                	mov    %esp,%ebp
+    1106:	83 ec 14             	sub    $0x14,%esp
+    1109:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+    110c:	ff 70 04             	push   0x4(%eax)
+    110f:	ff 10                	call   *(%eax)
+  exit();
+    1111:	e8 86 f6 ff ff       	call   79c <exit>
+
+00001116 <thread_create>:
+}
+
+// Run fn(arg) in a new thread.  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1116:	55                   	push   %ebp
+    1117:	89 e5                	mov    %esp,%ebp
+    1119:	56                   	push   %esi
+    111a:	53                   	push   %ebx
+  struct tstart *t;
+  char *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    111b:	83 ec 0c             	sub    $0xc,%esp
+    111e:	68 00 10 00 00       	push   $0x1000
+    1123:	e8 33 ff ff ff       	call   105b <malloc>
+    1128:	83 c4 10             	add    $0x10,%esp
+    112b:	85 c0                	test   %eax,%eax
+    112d:	74 42                	je     1171 <thread_create+0x5b>
+    112f:	89 c3                	mov    %eax,%ebx
+    return -1;
+  t = (struct tstart*)stack;
+  t->fn = fn;
+    1131:	8b 45 08             	mov    0x8(%ebp),%eax
+    1134:	89 03                	mov    %eax,(%ebx)
+  t->arg = arg;
+    1136:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1139:	89 43 04             	mov    %eax,0x4(%ebx)
+  if((pid = clone(tstart, stack + TSTACK, t)) < 0)
+    113c:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    1142:	83 ec 04             	sub    $0x4,%esp
+    1145:	53                   	push   %ebx
+    1146:	50                   	push   %eax
+    1147:	68 03 11 00 00       	push   $0x1103
+    114c:	e8 f5 f8 ff ff       	call   a46 <clone>
+    1151:	89 c6                	mov    %eax,%esi
+    1153:	83 c4 10             	add    $0x10,%esp
+    1156:	85 c0                	test   %eax,%eax
+    1158:	78 09                	js     1163 <thread_create+0x4d>
+    free(stack);
+  return pid;
+}
+    115a:	89 f0                	mov    %esi,%eax
+    115c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    115f:	5b                   	pop    %ebx
+    1160:	5e                   	pop    %esi
+    1161:	5d                   	pop    %ebp
+    1162:	c3                   	ret
+    free(stack);
+    1163:	83 ec 0c             	sub    $0xc,%esp
+    1166:	53                   	push   %ebx
+    1167:	e8 98 fe ff ff       	call   1004 <free>
+    116c:	83 c4 10             	add    $0x10,%esp
+    116f:	eb e9                	jmp    115a <thread_create+0x44>
+    return -1;
+    1171:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1176:	eb e2                	jmp    115a <thread_create+0x44>
+
+00001178 <thread_join>:
+
+// Wait for one of this process's threads to exit and free its
+// stack.  Returns its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+    1178:	55                   	push   %ebp
+    1179:	89 e5                	mov    %esp,%ebp
+    117b:	53                   	push   %ebx
+    117c:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    117f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    1182:	50                   	push   %eax
+    1183:	e8 cd f8 ff ff       	call   a55 <join>
+    1188:	89 c3                	mov    %eax,%ebx
+    118a:	83 c4 10             	add    $0x10,%esp
+    118d:	85 c0                	test   %eax,%eax
+    118f:	79 07                	jns    1198 <thread_join+0x20>
+    free((char*)stack - TSTACK);
+  return pid;
+}
+    1191:	89 d8                	mov    %ebx,%eax
+    1193:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1196:	c9                   	leave
+    1197:	c3                   	ret
+    free((char*)stack - TSTACK);
+    1198:	83 ec 0c             	sub    $0xc,%esp
+    119b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    119e:	2d 00 10 00 00       	sub    $0x1000,%eax
+    11a3:	50                   	push   %eax
+    11a4:	e8 5b fe ff ff       	call   1004 <free>
+    11a9:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    11ac:	eb e3                	jmp    1191 <thread_join+0x19>
+
+000011ae <lock_init>:
+
+void
+lock_init(lock_t *lk)
+{
+    11ae:	55                   	push   %ebp
+    11af:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    11b1:	8b 45 08             	mov    0x8(%ebp),%eax
+    11b4:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    11ba:	5d                   	pop    %ebp
+    11bb:	c3                   	ret
+
+000011bc <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+    11bc:	55                   	push   %ebp
+    11bd:	89 e5                	mov    %esp,%ebp
+    11bf:	8b 55 08             	mov    0x8(%ebp),%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    11c2:	b8 01 00 00 00       	mov    $0x1,%eax
+    11c7:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    11ca:	85 c0                	test   %eax,%eax
+    11cc:	75 f4                	jne    11c2 <lock_acquire+0x6>
+    ;
+}
+    11ce:	5d                   	pop    %ebp
+    11cf:	c3                   	ret
+
+000011d0 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+    11d0:	55                   	push   %ebp
+    11d1:	89 e5                	mov    %esp,%ebp
+    11d3:	8b 55 08             	mov    0x8(%ebp),%edx
+    11d6:	b8 00 00 00 00       	mov    $0x0,%eax
+    11db:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    11de:	5d                   	pop    %ebp
+    11df:	c3                   	ret
+
+000011e0 <mutex_init>:
+// Are Tricky": state is 0 when free, 1 when held, 2 when held and
+// others may be waiting.  Unlocking an uncontended mutex costs no
+// system call.
+void
+mutex_init(mutex_t *m)
+{
+    11e0:	55                   	push   %ebp
+    11e1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    11e3:	8b 45 08             	mov    0x8(%ebp),%eax
+    11e6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    11ec:	5d                   	pop    %ebp
+    11ed:	c3                   	ret
+
+000011ee <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+    11ee:	55                   	push   %ebp
+    11ef:	89 e5                	mov    %esp,%ebp
+    11f1:	53                   	push   %ebx
+    11f2:	83 ec 04             	sub    $0x4,%esp
+    11f5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    11f8:	b8 00 00 00 00       	mov    $0x0,%eax
+    11fd:	b9 01 00 00 00       	mov    $0x1,%ecx
+    1202:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    1206:	85 c0                	test   %eax,%eax
+    1208:	74 29                	je     1233 <mutex_lock+0x45>
+    return;
+  if(c != 2)
+    120a:	83 f8 02             	cmp    $0x2,%eax
+    120d:	74 20                	je     122f <mutex_lock+0x41>
+    120f:	b8 02 00 00 00       	mov    $0x2,%eax
+    1214:	f0 87 03             	lock xchg %eax,(%ebx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    1217:	eb 16                	jmp    122f <mutex_lock+0x41>
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    1219:	83 ec 08             	sub    $0x8,%esp
+    121c:	6a 02                	push   $0x2
+    121e:	53                   	push   %ebx
+    121f:	e8 40 f8 ff ff       	call   a64 <futex_wait>
+  asm volatile("lock; xchgl %0, %1" :
+    1224:	b8 02 00 00 00       	mov    $0x2,%eax
+    1229:	f0 87 03             	lock xchg %eax,(%ebx)
+    122c:	83 c4 10             	add    $0x10,%esp
+  while(c != 0){
+    122f:	85 c0                	test   %eax,%eax
+    1231:	75 e6                	jne    1219 <mutex_lock+0x2b>
+    c = xchg(&m->state, 2);
+  }
+}
+    1233:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1236:	c9                   	leave
+    1237:	c3                   	ret
+
+00001238 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+    1238:	55                   	push   %ebp
+    1239:	89 e5                	mov    %esp,%ebp
+    123b:	83 ec 08             	sub    $0x8,%esp
+    123e:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    1241:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    1246:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    124a:	83 fa 01             	cmp    $0x1,%edx
+    124d:	75 02                	jne    1251 <mutex_unlock+0x19>
+    m->state = 0;
+    futex_wake(&m->state, 1);
+  }
+}
+    124f:	c9                   	leave
+    1250:	c3                   	ret
+    m->state = 0;
+    1251:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+    1257:	83 ec 08             	sub    $0x8,%esp
+    125a:	6a 01                	push   $0x1
+    125c:	50                   	push   %eax
+    125d:	e8 11 f8 ff ff       	call   a73 <futex_wake>
+    1262:	83 c4 10             	add    $0x10,%esp
+}
+    1265:	eb e8                	jmp    124f <mutex_unlock+0x17>
+
+00001267 <cond_init>:
+// Condition variable: waiters sleep on a sequence number that
+// every signal bumps, so a signal between the unlock and the
+// futex_wait() in cond_wait() is not lost.
+void
+cond_init(cond_t *c)
+{
+    1267:	55                   	push   %ebp
+    1268:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    126a:	8b 45 08             	mov    0x8(%ebp),%eax
+    126d:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1273:	5d                   	pop    %ebp
+    1274:	c3                   	ret
+
+00001275 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+    1275:	55                   	push   %ebp
+    1276:	89 e5                	mov    %esp,%ebp
+    1278:	57                   	push   %edi
+    1279:	56                   	push   %esi
+    127a:	53                   	push   %ebx
+    127b:	83 ec 18             	sub    $0x18,%esp
+    127e:	8b 75 08             	mov    0x8(%ebp),%esi
+    1281:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    1284:	8b 3e                	mov    (%esi),%edi
+  mutex_unlock(m);
+    1286:	53                   	push   %ebx
+    1287:	e8 ac ff ff ff       	call   1238 <mutex_unlock>
+  futex_wait(&c->seq, seq);
+    128c:	83 c4 08             	add    $0x8,%esp
+    128f:	57                   	push   %edi
+    1290:	56                   	push   %esi
+    1291:	e8 ce f7 ff ff       	call   a64 <futex_wait>
+  // Others may be waiting for m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+    1296:	83 c4 10             	add    $0x10,%esp
+    1299:	eb 0e                	jmp    12a9 <cond_wait+0x34>
+    futex_wait(&m->state, 2);
+    129b:	83 ec 08             	sub    $0x8,%esp
+    129e:	6a 02                	push   $0x2
+    12a0:	53                   	push   %ebx
+    12a1:	e8 be f7 ff ff       	call   a64 <futex_wait>
+    12a6:	83 c4 10             	add    $0x10,%esp
+    12a9:	b8 02 00 00 00       	mov    $0x2,%eax
+    12ae:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    12b1:	85 c0                	test   %eax,%eax
+    12b3:	75 e6                	jne    129b <cond_wait+0x26>
+}
+    12b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    12b8:	5b                   	pop    %ebx
+    12b9:	5e                   	pop    %esi
+    12ba:	5f                   	pop    %edi
+    12bb:	5d                   	pop    %ebp
+    12bc:	c3                   	ret
+
+000012bd <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+    12bd:	55                   	push   %ebp
+    12be:	89 e5                	mov    %esp,%ebp
+    12c0:	83 ec 10             	sub    $0x10,%esp
+    12c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    12c6:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+    12ca:	6a 01                	push   $0x1
+    12cc:	50                   	push   %eax
+    12cd:	e8 a1 f7 ff ff       	call   a73 <futex_wake>
+}
+    12d2:	83 c4 10             	add    $0x10,%esp
+    12d5:	c9                   	leave
+    12d6:	c3                   	ret
+
+000012d7 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+    12d7:	55                   	push   %ebp
+    12d8:	89 e5                	mov    %esp,%ebp
+    12da:	83 ec 10             	sub    $0x10,%esp
+    12dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    12e0:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, NPROC);
+    12e4:	6a 40                	push   $0x40
+    12e6:	50                   	push   %eax
+    12e7:	e8 87 f7 ff ff       	call   a73 <futex_wake>
+}
+    12ec:	83 c4 10             	add    $0x10,%esp
+    12ef:	c9                   	leave
+    12f0:	c3                   	ret
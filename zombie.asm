@@ -0,0 +1,2724 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+      11:	e8 3c 06 00 00       	call   652 <fork>
+      16:	85 c0                	test   %eax,%eax
+      18:	7f 05                	jg     1f <main+0x1f>
+    sleep(5);  // Let child exit before parent.
+  exit();
+      1a:	e8 47 06 00 00       	call   666 <exit>
+    sleep(5);  // Let child exit before parent.
+      1f:	83 ec 0c             	sub    $0xc,%esp
+      22:	6a 05                	push   $0x5
+      24:	e8 24 08 00 00       	call   84d <sleep>
+      29:	83 c4 10             	add    $0x10,%esp
+      2c:	eb ec                	jmp    1a <main+0x1a>
+
+0000002e <strcpy>:
+#include "memlayout.h"
+#include "clock.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+      2e:	55                   	push   %ebp
+      2f:	89 e5                	mov    %esp,%ebp
+      31:	56                   	push   %esi
+      32:	53                   	push   %ebx
+      33:	8b 75 08             	mov    0x8(%ebp),%esi
+      36:	8b 55 0c             	mov    0xc(%ebp),%edx
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+      39:	89 f0                	mov    %esi,%eax
+      3b:	89 d1                	mov    %edx,%ecx
+      3d:	83 c2 01             	add    $0x1,%edx
+      40:	89 c3                	mov    %eax,%ebx
+      42:	83 c0 01             	add    $0x1,%eax
+      45:	0f b6 09             	movzbl (%ecx),%ecx
+      48:	88 0b                	mov    %cl,(%ebx)
+      4a:	84 c9                	test   %cl,%cl
+      4c:	75 ed                	jne    3b <strcpy+0xd>
+    ;
+  return os;
+}
+      4e:	89 f0                	mov    %esi,%eax
+      50:	5b                   	pop    %ebx
+      51:	5e                   	pop    %esi
+      52:	5d                   	pop    %ebp
+      53:	c3                   	ret
+
+00000054 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+      54:	55                   	push   %ebp
+      55:	89 e5                	mov    %esp,%ebp
+      57:	8b 4d 08             	mov    0x8(%ebp),%ecx
+      5a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while(*p && *p == *q)
+      5d:	eb 06                	jmp    65 <strcmp+0x11>
+    p++, q++;
+      5f:	83 c1 01             	add    $0x1,%ecx
+      62:	83 c2 01             	add    $0x1,%edx
+  while(*p && *p == *q)
+      65:	0f b6 01             	movzbl (%ecx),%eax
+      68:	84 c0                	test   %al,%al
+      6a:	74 04                	je     70 <strcmp+0x1c>
+      6c:	3a 02                	cmp    (%edx),%al
+      6e:	74 ef                	je     5f <strcmp+0xb>
+  return (uchar)*p - (uchar)*q;
+      70:	0f b6 c0             	movzbl %al,%eax
+      73:	0f b6 12             	movzbl (%edx),%edx
+      76:	29 d0                	sub    %edx,%eax
+}
+      78:	5d                   	pop    %ebp
+      79:	c3                   	ret
+
+0000007a <strlen>:
+
+uint
+strlen(const char *s)
+{
+      7a:	55                   	push   %ebp
+      7b:	89 e5                	mov    %esp,%ebp
+      7d:	53                   	push   %ebx
+      7e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  const char *p;
+  uint w;
+
+  for(p = s; (uint)p & 3; p++)
+      81:	89 c8                	mov    %ecx,%eax
+      83:	eb 03                	jmp    88 <strlen+0xe>
+      85:	83 c0 01             	add    $0x1,%eax
+      88:	a8 03                	test   $0x3,%al
+      8a:	74 09                	je     95 <strlen+0x1b>
+    if(*p == 0)
+      8c:	80 38 00             	cmpb   $0x0,(%eax)
+      8f:	75 f4                	jne    85 <strlen+0xb>
+      return p - s;
+      91:	29 c8                	sub    %ecx,%eax
+      93:	eb 25                	jmp    ba <strlen+0x40>
+  // Then a word at a time, which never crosses into the next page:
+  // a word with a zero byte in it has one of these bits set.
+  for(;; p += 4){
+    w = *(uint*)p;
+      95:	8b 10                	mov    (%eax),%edx
+    if((w - 0x01010101) & ~w & 0x80808080)
+      97:	8d 9a ff fe fe fe    	lea    -0x1010101(%edx),%ebx
+      9d:	f7 d2                	not    %edx
+      9f:	21 da                	and    %ebx,%edx
+      a1:	f7 c2 80 80 80 80    	test   $0x80808080,%edx
+      a7:	75 05                	jne    ae <strlen+0x34>
+  for(;; p += 4){
+      a9:	83 c0 04             	add    $0x4,%eax
+    w = *(uint*)p;
+      ac:	eb e7                	jmp    95 <strlen+0x1b>
+      break;
+  }
+  while(*p)
+      ae:	80 38 00             	cmpb   $0x0,(%eax)
+      b1:	74 05                	je     b8 <strlen+0x3e>
+    p++;
+      b3:	83 c0 01             	add    $0x1,%eax
+      b6:	eb f6                	jmp    ae <strlen+0x34>
+  return p - s;
+      b8:	29 c8                	sub    %ecx,%eax
+}
+      ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      bd:	c9                   	leave
+      be:	c3                   	ret
+
+000000bf <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+      bf:	55                   	push   %ebp
+      c0:	89 e5                	mov    %esp,%ebp
+      c2:	57                   	push   %edi
+      c3:	56                   	push   %esi
+      c4:	53                   	push   %ebx
+      c5:	8b 55 10             	mov    0x10(%ebp),%edx
+  uint h;
+  char *d;
+
+  d = dst;
+  c &= 0xFF;
+      c8:	0f b6 5d 0c          	movzbl 0xc(%ebp),%ebx
+  if(n >= 16){
+      cc:	83 fa 0f             	cmp    $0xf,%edx
+      cf:	76 52                	jbe    123 <memset+0x64>
+    h = -(uint)d & 3;
+      d1:	8b 45 08             	mov    0x8(%ebp),%eax
+      d4:	f7 d8                	neg    %eax
+      d6:	83 e0 03             	and    $0x3,%eax
+      d9:	89 c6                	mov    %eax,%esi
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+      db:	8b 7d 08             	mov    0x8(%ebp),%edi
+      de:	89 c1                	mov    %eax,%ecx
+      e0:	89 d8                	mov    %ebx,%eax
+      e2:	fc                   	cld
+      e3:	f3 aa                	rep stos %al,%es:(%edi)
+    stosb(d, c, h);
+    stosl(d + h, (c<<24)|(c<<16)|(c<<8)|c, (n - h)/4);
+      e5:	29 f2                	sub    %esi,%edx
+      e7:	89 d1                	mov    %edx,%ecx
+      e9:	c1 e9 02             	shr    $0x2,%ecx
+      ec:	c1 e0 18             	shl    $0x18,%eax
+      ef:	89 df                	mov    %ebx,%edi
+      f1:	c1 e7 10             	shl    $0x10,%edi
+      f4:	09 f8                	or     %edi,%eax
+      f6:	89 df                	mov    %ebx,%edi
+      f8:	c1 e7 08             	shl    $0x8,%edi
+      fb:	09 f8                	or     %edi,%eax
+      fd:	09 d8                	or     %ebx,%eax
+      ff:	89 f7                	mov    %esi,%edi
+     101:	03 7d 08             	add    0x8(%ebp),%edi
+}
+
+static inline void
+stosl(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosl" :
+     104:	fc                   	cld
+     105:	f3 ab                	rep stos %eax,%es:(%edi)
+    d += h + (n - h)/4*4;
+     107:	89 d7                	mov    %edx,%edi
+     109:	83 e7 fc             	and    $0xfffffffc,%edi
+     10c:	09 f7                	or     %esi,%edi
+     10e:	03 7d 08             	add    0x8(%ebp),%edi
+    n = (n - h)%4;
+     111:	83 e2 03             	and    $0x3,%edx
+  asm volatile("cld; rep stosb" :
+     114:	89 d1                	mov    %edx,%ecx
+     116:	89 d8                	mov    %ebx,%eax
+     118:	fc                   	cld
+     119:	f3 aa                	rep stos %al,%es:(%edi)
+  }
+  stosb(d, c, n);
+  return dst;
+}
+     11b:	8b 45 08             	mov    0x8(%ebp),%eax
+     11e:	5b                   	pop    %ebx
+     11f:	5e                   	pop    %esi
+     120:	5f                   	pop    %edi
+     121:	5d                   	pop    %ebp
+     122:	c3                   	ret
+  d = dst;
+     123:	8b 7d 08             	mov    0x8(%ebp),%edi
+     126:	eb ec                	jmp    114 <memset+0x55>
+
+00000128 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     128:	55                   	push   %ebp
+     129:	89 e5                	mov    %esp,%ebp
+     12b:	8b 45 08             	mov    0x8(%ebp),%eax
+     12e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     132:	eb 03                	jmp    137 <strchr+0xf>
+     134:	83 c0 01             	add    $0x1,%eax
+     137:	0f b6 10             	movzbl (%eax),%edx
+     13a:	84 d2                	test   %dl,%dl
+     13c:	74 06                	je     144 <strchr+0x1c>
+    if(*s == c)
+     13e:	38 ca                	cmp    %cl,%dl
+     140:	75 f2                	jne    134 <strchr+0xc>
+     142:	eb 05                	jmp    149 <strchr+0x21>
+      return (char*)s;
+  return 0;
+     144:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     149:	5d                   	pop    %ebp
+     14a:	c3                   	ret
+
+0000014b <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+     14b:	55                   	push   %ebp
+     14c:	89 e5                	mov    %esp,%ebp
+     14e:	56                   	push   %esi
+     14f:	53                   	push   %ebx
+     150:	8b 55 08             	mov    0x8(%ebp),%edx
+     153:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     156:	8b 45 10             	mov    0x10(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  // A word at a time while they agree.
+  if((((uint)s1 | (uint)s2) & 3) == 0)
+     159:	89 d3                	mov    %edx,%ebx
+     15b:	09 cb                	or     %ecx,%ebx
+     15d:	f6 c3 03             	test   $0x3,%bl
+     160:	74 24                	je     186 <memcmp+0x3b>
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+      s1 += 4, s2 += 4;
+  while(n-- > 0){
+     162:	8d 70 ff             	lea    -0x1(%eax),%esi
+     165:	85 c0                	test   %eax,%eax
+     167:	74 32                	je     19b <memcmp+0x50>
+    if(*s1 != *s2)
+     169:	0f b6 02             	movzbl (%edx),%eax
+     16c:	0f b6 19             	movzbl (%ecx),%ebx
+     16f:	38 d8                	cmp    %bl,%al
+     171:	75 20                	jne    193 <memcmp+0x48>
+      return *s1 - *s2;
+    s1++, s2++;
+     173:	83 c2 01             	add    $0x1,%edx
+     176:	83 c1 01             	add    $0x1,%ecx
+  while(n-- > 0){
+     179:	89 f0                	mov    %esi,%eax
+     17b:	eb e5                	jmp    162 <memcmp+0x17>
+      s1 += 4, s2 += 4;
+     17d:	83 c2 04             	add    $0x4,%edx
+     180:	83 c1 04             	add    $0x4,%ecx
+    for(; n >= 4 && *(uint*)s1 == *(uint*)s2; n -= 4)
+     183:	83 e8 04             	sub    $0x4,%eax
+     186:	83 f8 03             	cmp    $0x3,%eax
+     189:	76 d7                	jbe    162 <memcmp+0x17>
+     18b:	8b 31                	mov    (%ecx),%esi
+     18d:	39 32                	cmp    %esi,(%edx)
+     18f:	74 ec                	je     17d <memcmp+0x32>
+     191:	eb cf                	jmp    162 <memcmp+0x17>
+      return *s1 - *s2;
+     193:	0f b6 c0             	movzbl %al,%eax
+     196:	0f b6 db             	movzbl %bl,%ebx
+     199:	29 d8                	sub    %ebx,%eax
+  }
+  return 0;
+}
+     19b:	5b                   	pop    %ebx
+     19c:	5e                   	pop    %esi
+     19d:	5d                   	pop    %ebp
+     19e:	c3                   	ret
+
+0000019f <memchr>:
+// The first c in the n bytes at v, or 0.  Once aligned, a word at
+// a time, with the word's bytes that equal c turned into zeroes
+// and those looked for.
+void*
+memchr(const void *v, int c, uint n)
+{
+     19f:	55                   	push   %ebp
+     1a0:	89 e5                	mov    %esp,%ebp
+     1a2:	57                   	push   %edi
+     1a3:	56                   	push   %esi
+     1a4:	53                   	push   %ebx
+     1a5:	8b 45 08             	mov    0x8(%ebp),%eax
+     1a8:	8b 55 10             	mov    0x10(%ebp),%edx
+  const uchar *s;
+  uint w, rep;
+
+  s = v;
+  c = (uchar)c;
+     1ab:	0f b6 75 0c          	movzbl 0xc(%ebp),%esi
+  for(; n > 0 && ((uint)s & 3); n--, s++)
+     1af:	eb 06                	jmp    1b7 <memchr+0x18>
+     1b1:	83 ea 01             	sub    $0x1,%edx
+     1b4:	83 c0 01             	add    $0x1,%eax
+     1b7:	85 d2                	test   %edx,%edx
+     1b9:	74 0d                	je     1c8 <memchr+0x29>
+     1bb:	a8 03                	test   $0x3,%al
+     1bd:	74 09                	je     1c8 <memchr+0x29>
+    if(*s == c)
+     1bf:	0f b6 08             	movzbl (%eax),%ecx
+     1c2:	39 f1                	cmp    %esi,%ecx
+     1c4:	75 eb                	jne    1b1 <memchr+0x12>
+     1c6:	eb 41                	jmp    209 <memchr+0x6a>
+      return (void*)s;
+  rep = c * 0x01010101;
+     1c8:	69 fe 01 01 01 01    	imul   $0x1010101,%esi,%edi
+  for(; n >= 4; n -= 4, s += 4){
+     1ce:	eb 06                	jmp    1d6 <memchr+0x37>
+     1d0:	83 ea 04             	sub    $0x4,%edx
+     1d3:	83 c0 04             	add    $0x4,%eax
+     1d6:	83 fa 03             	cmp    $0x3,%edx
+     1d9:	76 16                	jbe    1f1 <memchr+0x52>
+    w = *(uint*)s ^ rep;
+     1db:	89 f9                	mov    %edi,%ecx
+     1dd:	33 08                	xor    (%eax),%ecx
+    if((w - 0x01010101) & ~w & 0x80808080)
+     1df:	8d 99 ff fe fe fe    	lea    -0x1010101(%ecx),%ebx
+     1e5:	f7 d1                	not    %ecx
+     1e7:	21 cb                	and    %ecx,%ebx
+     1e9:	f7 c3 80 80 80 80    	test   $0x80808080,%ebx
+     1ef:	74 df                	je     1d0 <memchr+0x31>
+      break;
+  }
+  for(; n > 0; n--, s++)
+     1f1:	85 d2                	test   %edx,%edx
+     1f3:	74 0f                	je     204 <memchr+0x65>
+    if(*s == c)
+     1f5:	0f b6 08             	movzbl (%eax),%ecx
+     1f8:	39 f1                	cmp    %esi,%ecx
+     1fa:	74 0d                	je     209 <memchr+0x6a>
+  for(; n > 0; n--, s++)
+     1fc:	83 ea 01             	sub    $0x1,%edx
+     1ff:	83 c0 01             	add    $0x1,%eax
+     202:	eb ed                	jmp    1f1 <memchr+0x52>
+      return (void*)s;
+  return 0;
+     204:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     209:	5b                   	pop    %ebx
+     20a:	5e                   	pop    %esi
+     20b:	5f                   	pop    %edi
+     20c:	5d                   	pop    %ebp
+     20d:	c3                   	ret
+
+0000020e <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     20e:	55                   	push   %ebp
+     20f:	89 e5                	mov    %esp,%ebp
+     211:	57                   	push   %edi
+     212:	56                   	push   %esi
+     213:	53                   	push   %ebx
+     214:	83 ec 1c             	sub    $0x1c,%esp
+     217:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+     21a:	bb 00 00 00 00       	mov    $0x0,%ebx
+     21f:	89 de                	mov    %ebx,%esi
+     221:	83 c3 01             	add    $0x1,%ebx
+     224:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     227:	7d 2e                	jge    257 <gets+0x49>
+    cc = read(0, &c, 1);
+     229:	83 ec 04             	sub    $0x4,%esp
+     22c:	6a 01                	push   $0x1
+     22e:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     231:	50                   	push   %eax
+     232:	6a 00                	push   $0x0
+     234:	e8 51 05 00 00       	call   78a <read>
+    if(cc < 1)
+     239:	83 c4 10             	add    $0x10,%esp
+     23c:	85 c0                	test   %eax,%eax
+     23e:	7e 17                	jle    257 <gets+0x49>
+      break;
+    buf[i++] = c;
+     240:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     244:	88 04 37             	mov    %al,(%edi,%esi,1)
+    if(c == '\n' || c == '\r')
+     247:	3c 0a                	cmp    $0xa,%al
+     249:	0f 94 c2             	sete   %dl
+     24c:	3c 0d                	cmp    $0xd,%al
+     24e:	0f 94 c0             	sete   %al
+     251:	08 c2                	or     %al,%dl
+     253:	74 ca                	je     21f <gets+0x11>
+    buf[i++] = c;
+     255:	89 de                	mov    %ebx,%esi
+      break;
+  }
+  buf[i] = '\0';
+     257:	c6 04 37 00          	movb   $0x0,(%edi,%esi,1)
+  return buf;
+}
+     25b:	89 f8                	mov    %edi,%eax
+     25d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     260:	5b                   	pop    %ebx
+     261:	5e                   	pop    %esi
+     262:	5f                   	pop    %edi
+     263:	5d                   	pop    %ebp
+     264:	c3                   	ret
+
+00000265 <atoi>:
+  return r;
+}
+
+int
+atoi(const char *s)
+{
+     265:	55                   	push   %ebp
+     266:	89 e5                	mov    %esp,%ebp
+     268:	53                   	push   %ebx
+     269:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  n = 0;
+     26c:	ba 00 00 00 00       	mov    $0x0,%edx
+  while('0' <= *s && *s <= '9')
+     271:	eb 10                	jmp    283 <atoi+0x1e>
+    n = n*10 + *s++ - '0';
+     273:	8d 1c 92             	lea    (%edx,%edx,4),%ebx
+     276:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+     279:	83 c1 01             	add    $0x1,%ecx
+     27c:	0f be c0             	movsbl %al,%eax
+     27f:	8d 54 10 d0          	lea    -0x30(%eax,%edx,1),%edx
+  while('0' <= *s && *s <= '9')
+     283:	0f b6 01             	movzbl (%ecx),%eax
+     286:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     289:	80 fb 09             	cmp    $0x9,%bl
+     28c:	76 e5                	jbe    273 <atoi+0xe>
+  return n;
+}
+     28e:	89 d0                	mov    %edx,%eax
+     290:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     293:	c9                   	leave
+     294:	c3                   	ret
+
+00000295 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     295:	55                   	push   %ebp
+     296:	89 e5                	mov    %esp,%ebp
+     298:	57                   	push   %edi
+     299:	56                   	push   %esi
+     29a:	53                   	push   %ebx
+     29b:	83 ec 08             	sub    $0x8,%esp
+     29e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     2a1:	8b 55 0c             	mov    0xc(%ebp),%edx
+     2a4:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *src;
+  int h;
+
+  dst = vdst;
+  src = vsrc;
+  if(n <= 0)
+     2a7:	85 c0                	test   %eax,%eax
+     2a9:	0f 8e 82 00 00 00    	jle    331 <memmove+0x9c>
+    return vdst;
+  if(src < dst && src + n > dst){
+     2af:	39 da                	cmp    %ebx,%edx
+     2b1:	73 07                	jae    2ba <memmove+0x25>
+     2b3:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+     2b6:	39 cb                	cmp    %ecx,%ebx
+     2b8:	72 5e                	jb     318 <memmove+0x83>
+    movsbback(dst + n - 1, src + n - 1, n);
+    return vdst;
+  }
+  if(n >= 16 && (((uint)dst ^ (uint)src) & 3) == 0){
+     2ba:	83 f8 0f             	cmp    $0xf,%eax
+     2bd:	7e 69                	jle    328 <memmove+0x93>
+     2bf:	89 d9                	mov    %ebx,%ecx
+     2c1:	31 d1                	xor    %edx,%ecx
+     2c3:	f6 c1 03             	test   $0x3,%cl
+     2c6:	75 73                	jne    33b <memmove+0xa6>
+    h = -(uint)dst & 3;
+     2c8:	89 d9                	mov    %ebx,%ecx
+     2ca:	f7 d9                	neg    %ecx
+     2cc:	83 e1 03             	and    $0x3,%ecx
+}
+
+static inline void
+movsb(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsb" :
+     2cf:	89 df                	mov    %ebx,%edi
+     2d1:	89 d6                	mov    %edx,%esi
+     2d3:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+     2d6:	fc                   	cld
+     2d7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    movsb(dst, src, h);
+    dst += h, src += h, n -= h;
+     2d9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+     2dc:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+     2df:	8d 0c 32             	lea    (%edx,%esi,1),%ecx
+     2e2:	29 f0                	sub    %esi,%eax
+    movsl(dst, src, n/4);
+     2e4:	8d 50 03             	lea    0x3(%eax),%edx
+     2e7:	0f 49 d0             	cmovns %eax,%edx
+     2ea:	c1 fa 02             	sar    $0x2,%edx
+}
+
+static inline void
+movsl(void *dst, const void *src, int cnt)
+{
+  asm volatile("cld; rep movsl" :
+     2ed:	89 7d f0             	mov    %edi,-0x10(%ebp)
+     2f0:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     2f3:	89 ce                	mov    %ecx,%esi
+     2f5:	89 d1                	mov    %edx,%ecx
+     2f7:	fc                   	cld
+     2f8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    dst += n/4*4, src += n/4*4, n %= 4;
+     2fa:	c1 e2 02             	shl    $0x2,%edx
+     2fd:	8b 7d f0             	mov    -0x10(%ebp),%edi
+     300:	01 d7                	add    %edx,%edi
+     302:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     305:	01 ca                	add    %ecx,%edx
+     307:	89 c6                	mov    %eax,%esi
+     309:	c1 fe 1f             	sar    $0x1f,%esi
+     30c:	c1 ee 1e             	shr    $0x1e,%esi
+     30f:	01 f0                	add    %esi,%eax
+     311:	83 e0 03             	and    $0x3,%eax
+     314:	29 f0                	sub    %esi,%eax
+     316:	eb 12                	jmp    32a <memmove+0x95>
+    movsbback(dst + n - 1, src + n - 1, n);
+     318:	8d 78 ff             	lea    -0x1(%eax),%edi
+     31b:	8d 34 3a             	lea    (%edx,%edi,1),%esi
+     31e:	01 df                	add    %ebx,%edi
+// Copy cnt bytes down from the last ones, at dst and src, to the
+// first: for overlapping moves up.
+static inline void
+movsbback(void *dst, const void *src, int cnt)
+{
+  asm volatile("std; rep movsb; cld" :
+     320:	89 c1                	mov    %eax,%ecx
+     322:	fd                   	std
+     323:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+     325:	fc                   	cld
+    return vdst;
+     326:	eb 09                	jmp    331 <memmove+0x9c>
+  dst = vdst;
+     328:	89 df                	mov    %ebx,%edi
+  asm volatile("cld; rep movsb" :
+     32a:	89 d6                	mov    %edx,%esi
+     32c:	89 c1                	mov    %eax,%ecx
+     32e:	fc                   	cld
+     32f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+  }
+  movsb(dst, src, n);
+  return vdst;
+}
+     331:	89 d8                	mov    %ebx,%eax
+     333:	83 c4 08             	add    $0x8,%esp
+     336:	5b                   	pop    %ebx
+     337:	5e                   	pop    %esi
+     338:	5f                   	pop    %edi
+     339:	5d                   	pop    %ebp
+     33a:	c3                   	ret
+  dst = vdst;
+     33b:	89 df                	mov    %ebx,%edi
+     33d:	eb eb                	jmp    32a <memmove+0x95>
+
+0000033f <vclock_gettime>:
+
+// clock_gettime() without a system call: read the clock page
+// that the kernel maps at CLOCKPAGE (see clock.h).
+int
+vclock_gettime(int clk, struct timespec *ts)
+{
+     33f:	55                   	push   %ebp
+     340:	89 e5                	mov    %esp,%ebp
+     342:	57                   	push   %edi
+     343:	56                   	push   %esi
+     344:	53                   	push   %ebx
+     345:	83 ec 14             	sub    $0x14,%esp
+  struct clockpage *cp = (struct clockpage*)CLOCKPAGE;
+  uint seq, rem, d;
+  uint64 tsc, ns, now;
+
+  if(clk != CLOCK_REALTIME && clk != CLOCK_MONOTONIC)
+     348:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+     34c:	0f 87 a3 00 00 00    	ja     3f5 <vclock_gettime+0xb6>
+    return -1;
+  do {
+    seq = cp->seq;
+     352:	a1 00 f0 ff 7f       	mov    0x7ffff000,%eax
+    __sync_synchronize();
+     357:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    tsc = cp->tsc;
+     35c:	8b 15 10 f0 ff 7f    	mov    0x7ffff010,%edx
+     362:	8b 1d 14 f0 ff 7f    	mov    0x7ffff014,%ebx
+    ns = cp->ns;
+     368:	8b 35 18 f0 ff 7f    	mov    0x7ffff018,%esi
+     36e:	8b 3d 1c f0 ff 7f    	mov    0x7ffff01c,%edi
+    __sync_synchronize();
+     374:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  } while((seq & 1) || seq != cp->seq);
+     379:	89 c1                	mov    %eax,%ecx
+     37b:	83 e1 01             	and    $0x1,%ecx
+     37e:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+     381:	75 cf                	jne    352 <vclock_gettime+0x13>
+     383:	8b 0d 00 f0 ff 7f    	mov    0x7ffff000,%ecx
+     389:	39 c1                	cmp    %eax,%ecx
+     38b:	75 c5                	jne    352 <vclock_gettime+0x13>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+     38d:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     390:	89 55 ec             	mov    %edx,-0x14(%ebp)
+     393:	0f 31                	rdtsc
+     395:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     398:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+     39b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  now = rdtsc();
+  // Less than a tick has passed since the update, so the delta
+  // fits in 32 bits.
+  d = now > tsc ? now - tsc : 0;
+     39e:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     3a1:	19 d3                	sbb    %edx,%ebx
+     3a3:	73 07                	jae    3ac <vclock_gettime+0x6d>
+     3a5:	8b 5d ec             	mov    -0x14(%ebp),%ebx
+     3a8:	29 d8                	sub    %ebx,%eax
+     3aa:	89 c1                	mov    %eax,%ecx
+  ns += ((uint64)d * cp->mult) >> cp->shift;
+     3ac:	89 c8                	mov    %ecx,%eax
+     3ae:	f7 25 04 f0 ff 7f    	mull   0x7ffff004
+     3b4:	0f b6 0d 08 f0 ff 7f 	movzbl 0x7ffff008,%ecx
+     3bb:	0f ad d0             	shrd   %cl,%edx,%eax
+     3be:	d3 ea                	shr    %cl,%edx
+     3c0:	f6 c1 20             	test   $0x20,%cl
+     3c3:	74 04                	je     3c9 <vclock_gettime+0x8a>
+     3c5:	89 d0                	mov    %edx,%eax
+     3c7:	31 d2                	xor    %edx,%edx
+     3c9:	01 f0                	add    %esi,%eax
+     3cb:	11 fa                	adc    %edi,%edx
+static inline uint
+divl(uint64 n, uint d, uint *r)
+{
+  uint q;
+
+  asm volatile("divl %4" : "=a" (q), "=d" (*r) :
+     3cd:	bb 00 ca 9a 3b       	mov    $0x3b9aca00,%ebx
+     3d2:	f7 f3                	div    %ebx
+  ts->tv_sec = divl(ns, 1000000000, &rem);
+     3d4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+     3d7:	89 07                	mov    %eax,(%edi)
+  ts->tv_nsec = rem;
+     3d9:	89 57 04             	mov    %edx,0x4(%edi)
+  if(clk == CLOCK_REALTIME)
+     3dc:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     3e0:	75 1a                	jne    3fc <vclock_gettime+0xbd>
+    ts->tv_sec += cp->boottime;
+     3e2:	03 05 0c f0 ff 7f    	add    0x7ffff00c,%eax
+     3e8:	89 07                	mov    %eax,(%edi)
+  return 0;
+     3ea:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     3ed:	83 c4 14             	add    $0x14,%esp
+     3f0:	5b                   	pop    %ebx
+     3f1:	5e                   	pop    %esi
+     3f2:	5f                   	pop    %edi
+     3f3:	5d                   	pop    %ebp
+     3f4:	c3                   	ret
+    return -1;
+     3f5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     3fa:	eb f1                	jmp    3ed <vclock_gettime+0xae>
+  return 0;
+     3fc:	b8 00 00 00 00       	mov    $0x0,%eax
+     401:	eb ea                	jmp    3ed <vclock_gettime+0xae>
+
+00000403 <flush>:
+
+// Write out fd's buffer, or with fd < 0 every buffer.
+// Returns -1 if a write fails.
+int
+flush(int fd)
+{
+     403:	55                   	push   %ebp
+     404:	89 e5                	mov    %esp,%ebp
+     406:	56                   	push   %esi
+     407:	53                   	push   %ebx
+     408:	8b 45 08             	mov    0x8(%ebp),%eax
+  int r, n;
+
+  if(fd < 0){
+     40b:	85 c0                	test   %eax,%eax
+     40d:	78 5d                	js     46c <flush+0x69>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+      if(flush(fd) < 0)
+        r = -1;
+    return r;
+  }
+  if(fd >= NOBUF || (n = obuf[fd].n) == 0)
+     40f:	83 f8 0f             	cmp    $0xf,%eax
+     412:	7f 64                	jg     478 <flush+0x75>
+     414:	69 d0 08 02 00 00    	imul   $0x208,%eax,%edx
+     41a:	8b b2 e4 18 00 00    	mov    0x18e4(%edx),%esi
+     420:	85 f6                	test   %esi,%esi
+     422:	74 59                	je     47d <flush+0x7a>
+    return 0;
+  obuf[fd].n = 0;
+     424:	c7 82 e4 18 00 00 00 	movl   $0x0,0x18e4(%edx)
+     42b:	00 00 00 
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     42e:	81 c2 e8 18 00 00    	add    $0x18e8,%edx
+     434:	83 ec 04             	sub    $0x4,%esp
+     437:	56                   	push   %esi
+     438:	52                   	push   %edx
+     439:	50                   	push   %eax
+     43a:	e8 5a 03 00 00       	call   799 <write>
+     43f:	83 c4 10             	add    $0x10,%esp
+     442:	39 f0                	cmp    %esi,%eax
+     444:	75 40                	jne    486 <flush+0x83>
+     446:	be 00 00 00 00       	mov    $0x0,%esi
+     44b:	eb 30                	jmp    47d <flush+0x7a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     44d:	83 c3 01             	add    $0x1,%ebx
+     450:	83 fb 0f             	cmp    $0xf,%ebx
+     453:	7f 28                	jg     47d <flush+0x7a>
+      if(flush(fd) < 0)
+     455:	83 ec 0c             	sub    $0xc,%esp
+     458:	53                   	push   %ebx
+     459:	e8 a5 ff ff ff       	call   403 <flush>
+     45e:	83 c4 10             	add    $0x10,%esp
+     461:	85 c0                	test   %eax,%eax
+     463:	79 e8                	jns    44d <flush+0x4a>
+        r = -1;
+     465:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     46a:	eb e1                	jmp    44d <flush+0x4a>
+    for(r = 0, fd = 0; fd < NOBUF; fd++)
+     46c:	be 00 00 00 00       	mov    $0x0,%esi
+     471:	bb 00 00 00 00       	mov    $0x0,%ebx
+     476:	eb d8                	jmp    450 <flush+0x4d>
+    return 0;
+     478:	be 00 00 00 00       	mov    $0x0,%esi
+}
+     47d:	89 f0                	mov    %esi,%eax
+     47f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     482:	5b                   	pop    %ebx
+     483:	5e                   	pop    %esi
+     484:	5d                   	pop    %ebp
+     485:	c3                   	ret
+  return write(fd, obuf[fd].buf, n) == n ? 0 : -1;
+     486:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     48b:	eb f0                	jmp    47d <flush+0x7a>
+
+0000048d <bufreset>:
+
+static void
+bufreset(int fd)
+{
+  if(fd >= 0 && fd < NOBUF){
+     48d:	83 f8 0f             	cmp    $0xf,%eax
+     490:	76 01                	jbe    493 <bufreset+0x6>
+     492:	c3                   	ret
+{
+     493:	55                   	push   %ebp
+     494:	89 e5                	mov    %esp,%ebp
+     496:	53                   	push   %ebx
+     497:	83 ec 10             	sub    $0x10,%esp
+     49a:	89 c3                	mov    %eax,%ebx
+    flush(fd);
+     49c:	50                   	push   %eax
+     49d:	e8 61 ff ff ff       	call   403 <flush>
+    obuf[fd].mode = BUNKNOWN;
+     4a2:	69 db 08 02 00 00    	imul   $0x208,%ebx,%ebx
+     4a8:	c7 83 e0 18 00 00 00 	movl   $0x0,0x18e0(%ebx)
+     4af:	00 00 00 
+     4b2:	83 c4 10             	add    $0x10,%esp
+  }
+}
+     4b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     4b8:	c9                   	leave
+     4b9:	c3                   	ret
+
+000004ba <bufwrite>:
+
+// Write n bytes from p to fd, through its buffer.
+// Returns n, or -1 if a write fails.
+int
+bufwrite(int fd, const void *p, int n)
+{
+     4ba:	55                   	push   %ebp
+     4bb:	89 e5                	mov    %esp,%ebp
+     4bd:	57                   	push   %edi
+     4be:	56                   	push   %esi
+     4bf:	53                   	push   %ebx
+     4c0:	83 ec 3c             	sub    $0x3c,%esp
+     4c3:	8b 75 08             	mov    0x8(%ebp),%esi
+     4c6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct stat st;
+  const char *s;
+  int i;
+
+  if(fd < 0 || fd >= NOBUF)
+     4c9:	83 fe 0f             	cmp    $0xf,%esi
+     4cc:	0f 87 a2 00 00 00    	ja     574 <bufwrite+0xba>
+    return write(fd, p, n);
+  if(obuf[fd].mode == BUNKNOWN){
+     4d2:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     4d8:	83 b8 e0 18 00 00 00 	cmpl   $0x0,0x18e0(%eax)
+     4df:	75 19                	jne    4fa <bufwrite+0x40>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     4e1:	83 fe 02             	cmp    $0x2,%esi
+     4e4:	0f 85 9c 00 00 00    	jne    586 <bufwrite+0xcc>
+      obuf[fd].mode = BNONE;
+     4ea:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     4f0:	c7 80 e0 18 00 00 01 	movl   $0x1,0x18e0(%eax)
+     4f7:	00 00 00 
+    else
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+  }
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     4fa:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     500:	89 da                	mov    %ebx,%edx
+     502:	03 90 e4 18 00 00    	add    0x18e4(%eax),%edx
+     508:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+     50e:	0f 8f ae 00 00 00    	jg     5c2 <bufwrite+0x108>
+    return -1;
+  if(n >= OBUFSZ)
+     514:	81 fb ff 01 00 00    	cmp    $0x1ff,%ebx
+     51a:	0f 8f bd 00 00 00    	jg     5dd <bufwrite+0x123>
+    return write(fd, p, n);
+  memmove(obuf[fd].buf + obuf[fd].n, p, n);
+     520:	69 d6 08 02 00 00    	imul   $0x208,%esi,%edx
+     526:	8d ba e0 18 00 00    	lea    0x18e0(%edx),%edi
+     52c:	8b 82 e4 18 00 00    	mov    0x18e4(%edx),%eax
+     532:	83 ec 04             	sub    $0x4,%esp
+     535:	53                   	push   %ebx
+     536:	ff 75 0c             	push   0xc(%ebp)
+     539:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+     53c:	8d 84 10 e8 18 00 00 	lea    0x18e8(%eax,%edx,1),%eax
+     543:	50                   	push   %eax
+     544:	e8 4c fd ff ff       	call   295 <memmove>
+  obuf[fd].n += n;
+     549:	01 5f 04             	add    %ebx,0x4(%edi)
+  if(obuf[fd].mode == BNONE)
+     54c:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     54f:	8b 82 e0 18 00 00    	mov    0x18e0(%edx),%eax
+     555:	83 c4 10             	add    $0x10,%esp
+     558:	83 f8 01             	cmp    $0x1,%eax
+     55b:	0f 84 91 00 00 00    	je     5f2 <bufwrite+0x138>
+    return flush(fd) < 0 ? -1 : n;
+  if(obuf[fd].mode == BLINE)
+     561:	83 f8 02             	cmp    $0x2,%eax
+     564:	0f 84 ca 00 00 00    	je     634 <bufwrite+0x17a>
+    for(s = p, i = 0; i < n; i++)
+      if(s[i] == '\n')
+        return flush(fd) < 0 ? -1 : n;
+  return n;
+     56a:	89 d8                	mov    %ebx,%eax
+}
+     56c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     56f:	5b                   	pop    %ebx
+     570:	5e                   	pop    %esi
+     571:	5f                   	pop    %edi
+     572:	5d                   	pop    %ebp
+     573:	c3                   	ret
+    return write(fd, p, n);
+     574:	83 ec 04             	sub    $0x4,%esp
+     577:	53                   	push   %ebx
+     578:	ff 75 0c             	push   0xc(%ebp)
+     57b:	56                   	push   %esi
+     57c:	e8 18 02 00 00       	call   799 <write>
+     581:	83 c4 10             	add    $0x10,%esp
+     584:	eb e6                	jmp    56c <bufwrite+0xb2>
+    if(fd == 2 || fstat(fd, &st) < 0)
+     586:	83 ec 08             	sub    $0x8,%esp
+     589:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+     58c:	50                   	push   %eax
+     58d:	56                   	push   %esi
+     58e:	e8 51 02 00 00       	call   7e4 <fstat>
+     593:	83 c4 10             	add    $0x10,%esp
+     596:	85 c0                	test   %eax,%eax
+     598:	0f 88 4c ff ff ff    	js     4ea <bufwrite+0x30>
+      obuf[fd].mode = st.type == T_DEV ? BLINE : BFULL;
+     59e:	66 83 7d d4 03       	cmpw   $0x3,-0x2c(%ebp)
+     5a3:	74 16                	je     5bb <bufwrite+0x101>
+     5a5:	ba 03 00 00 00       	mov    $0x3,%edx
+     5aa:	69 c6 08 02 00 00    	imul   $0x208,%esi,%eax
+     5b0:	89 90 e0 18 00 00    	mov    %edx,0x18e0(%eax)
+     5b6:	e9 3f ff ff ff       	jmp    4fa <bufwrite+0x40>
+     5bb:	ba 02 00 00 00       	mov    $0x2,%edx
+     5c0:	eb e8                	jmp    5aa <bufwrite+0xf0>
+  if(obuf[fd].n + n > OBUFSZ && flush(fd) < 0)
+     5c2:	83 ec 0c             	sub    $0xc,%esp
+     5c5:	56                   	push   %esi
+     5c6:	e8 38 fe ff ff       	call   403 <flush>
+     5cb:	83 c4 10             	add    $0x10,%esp
+     5ce:	85 c0                	test   %eax,%eax
+     5d0:	0f 89 3e ff ff ff    	jns    514 <bufwrite+0x5a>
+    return -1;
+     5d6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     5db:	eb 8f                	jmp    56c <bufwrite+0xb2>
+    return write(fd, p, n);
+     5dd:	83 ec 04             	sub    $0x4,%esp
+     5e0:	53                   	push   %ebx
+     5e1:	ff 75 0c             	push   0xc(%ebp)
+     5e4:	56                   	push   %esi
+     5e5:	e8 af 01 00 00       	call   799 <write>
+     5ea:	83 c4 10             	add    $0x10,%esp
+     5ed:	e9 7a ff ff ff       	jmp    56c <bufwrite+0xb2>
+    return flush(fd) < 0 ? -1 : n;
+     5f2:	83 ec 0c             	sub    $0xc,%esp
+     5f5:	56                   	push   %esi
+     5f6:	e8 08 fe ff ff       	call   403 <flush>
+     5fb:	83 c4 10             	add    $0x10,%esp
+     5fe:	85 c0                	test   %eax,%eax
+     600:	78 07                	js     609 <bufwrite+0x14f>
+     602:	89 d8                	mov    %ebx,%eax
+     604:	e9 63 ff ff ff       	jmp    56c <bufwrite+0xb2>
+     609:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     60e:	e9 59 ff ff ff       	jmp    56c <bufwrite+0xb2>
+        return flush(fd) < 0 ? -1 : n;
+     613:	83 ec 0c             	sub    $0xc,%esp
+     616:	56                   	push   %esi
+     617:	e8 e7 fd ff ff       	call   403 <flush>
+     61c:	83 c4 10             	add    $0x10,%esp
+     61f:	85 c0                	test   %eax,%eax
+     621:	78 07                	js     62a <bufwrite+0x170>
+     623:	89 d8                	mov    %ebx,%eax
+     625:	e9 42 ff ff ff       	jmp    56c <bufwrite+0xb2>
+     62a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     62f:	e9 38 ff ff ff       	jmp    56c <bufwrite+0xb2>
+    for(s = p, i = 0; i < n; i++)
+     634:	b8 00 00 00 00       	mov    $0x0,%eax
+     639:	39 d8                	cmp    %ebx,%eax
+     63b:	7d 0e                	jge    64b <bufwrite+0x191>
+      if(s[i] == '\n')
+     63d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     640:	80 3c 01 0a          	cmpb   $0xa,(%ecx,%eax,1)
+     644:	74 cd                	je     613 <bufwrite+0x159>
+    for(s = p, i = 0; i < n; i++)
+     646:	83 c0 01             	add    $0x1,%eax
+     649:	eb ee                	jmp    639 <bufwrite+0x17f>
+  return n;
+     64b:	89 d8                	mov    %ebx,%eax
+     64d:	e9 1a ff ff ff       	jmp    56c <bufwrite+0xb2>
+
+00000652 <fork>:
+
+int
+fork(void)
+{
+     652:	55                   	push   %ebp
+     653:	89 e5                	mov    %esp,%ebp
+     655:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     658:	6a ff                	push   $0xffffffff
+     65a:	e8 a4 fd ff ff       	call   403 <flush>
+  return _fork();
+     65f:	e8 bd 00 00 00       	call   721 <_fork>
+}
+     664:	c9                   	leave
+     665:	c3                   	ret
+
+00000666 <exit>:
+
+int
+exit(void)
+{
+     666:	55                   	push   %ebp
+     667:	89 e5                	mov    %esp,%ebp
+     669:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     66c:	6a ff                	push   $0xffffffff
+     66e:	e8 90 fd ff ff       	call   403 <flush>
+  _exit();
+     673:	e8 b8 00 00 00       	call   730 <_exit>
+
+00000678 <exec>:
+}
+
+int
+exec(char *path, char **argv)
+{
+     678:	55                   	push   %ebp
+     679:	89 e5                	mov    %esp,%ebp
+     67b:	83 ec 14             	sub    $0x14,%esp
+  flush(-1);
+     67e:	6a ff                	push   $0xffffffff
+     680:	e8 7e fd ff ff       	call   403 <flush>
+  return _exec(path, argv);
+     685:	83 c4 08             	add    $0x8,%esp
+     688:	ff 75 0c             	push   0xc(%ebp)
+     68b:	ff 75 08             	push   0x8(%ebp)
+     68e:	e8 bb 00 00 00       	call   74e <_exec>
+}
+     693:	c9                   	leave
+     694:	c3                   	ret
+
+00000695 <close>:
+
+int
+close(int fd)
+{
+     695:	55                   	push   %ebp
+     696:	89 e5                	mov    %esp,%ebp
+     698:	53                   	push   %ebx
+     699:	83 ec 04             	sub    $0x4,%esp
+     69c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bufreset(fd);
+     69f:	89 d8                	mov    %ebx,%eax
+     6a1:	e8 e7 fd ff ff       	call   48d <bufreset>
+  return _close(fd);
+     6a6:	83 ec 0c             	sub    $0xc,%esp
+     6a9:	53                   	push   %ebx
+     6aa:	e8 90 00 00 00       	call   73f <_close>
+}
+     6af:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6b2:	c9                   	leave
+     6b3:	c3                   	ret
+
+000006b4 <stat>:
+{
+     6b4:	55                   	push   %ebp
+     6b5:	89 e5                	mov    %esp,%ebp
+     6b7:	56                   	push   %esi
+     6b8:	53                   	push   %ebx
+  fd = open(n, O_RDONLY);
+     6b9:	83 ec 08             	sub    $0x8,%esp
+     6bc:	6a 00                	push   $0x0
+     6be:	ff 75 08             	push   0x8(%ebp)
+     6c1:	e8 f1 00 00 00       	call   7b7 <open>
+  if(fd < 0)
+     6c6:	83 c4 10             	add    $0x10,%esp
+     6c9:	85 c0                	test   %eax,%eax
+     6cb:	78 24                	js     6f1 <stat+0x3d>
+     6cd:	89 c3                	mov    %eax,%ebx
+  r = fstat(fd, st);
+     6cf:	83 ec 08             	sub    $0x8,%esp
+     6d2:	ff 75 0c             	push   0xc(%ebp)
+     6d5:	50                   	push   %eax
+     6d6:	e8 09 01 00 00       	call   7e4 <fstat>
+     6db:	89 c6                	mov    %eax,%esi
+  close(fd);
+     6dd:	89 1c 24             	mov    %ebx,(%esp)
+     6e0:	e8 b0 ff ff ff       	call   695 <close>
+  return r;
+     6e5:	83 c4 10             	add    $0x10,%esp
+}
+     6e8:	89 f0                	mov    %esi,%eax
+     6ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     6ed:	5b                   	pop    %ebx
+     6ee:	5e                   	pop    %esi
+     6ef:	5d                   	pop    %ebp
+     6f0:	c3                   	ret
+    return -1;
+     6f1:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     6f6:	eb f0                	jmp    6e8 <stat+0x34>
+
+000006f8 <dup2>:
+
+int
+dup2(int oldfd, int newfd)
+{
+     6f8:	55                   	push   %ebp
+     6f9:	89 e5                	mov    %esp,%ebp
+     6fb:	56                   	push   %esi
+     6fc:	53                   	push   %ebx
+     6fd:	8b 75 08             	mov    0x8(%ebp),%esi
+     700:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(oldfd != newfd)
+     703:	39 de                	cmp    %ebx,%esi
+     705:	75 11                	jne    718 <dup2+0x20>
+    bufreset(newfd);
+  return _dup2(oldfd, newfd);
+     707:	83 ec 08             	sub    $0x8,%esp
+     70a:	53                   	push   %ebx
+     70b:	56                   	push   %esi
+     70c:	e8 4c 00 00 00       	call   75d <_dup2>
+}
+     711:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     714:	5b                   	pop    %ebx
+     715:	5e                   	pop    %esi
+     716:	5d                   	pop    %ebp
+     717:	c3                   	ret
+    bufreset(newfd);
+     718:	89 d8                	mov    %ebx,%eax
+     71a:	e8 6e fd ff ff       	call   48d <bufreset>
+     71f:	eb e6                	jmp    707 <dup2+0xf>
+
+00000721 <_fork>:
+  1: ret
+
+#define SYSCALL(name) STUB(name, SYS_ ## name)
+
+# ulib.c wraps these, to flush printf()'s buffers first.
+STUB(_fork, SYS_fork)
+     721:	b8 01 00 00 00       	mov    $0x1,%eax
+     726:	89 e1                	mov    %esp,%ecx
+     728:	ba 2f 07 00 00       	mov    $0x72f,%edx
+     72d:	0f 34                	sysenter
+     72f:	c3                   	ret
+
+00000730 <_exit>:
+STUB(_exit, SYS_exit)
+     730:	b8 02 00 00 00       	mov    $0x2,%eax
+     735:	89 e1                	mov    %esp,%ecx
+     737:	ba 3e 07 00 00       	mov    $0x73e,%edx
+     73c:	0f 34                	sysenter
+     73e:	c3                   	ret
+
+0000073f <_close>:
+STUB(_close, SYS_close)
+     73f:	b8 15 00 00 00       	mov    $0x15,%eax
+     744:	89 e1                	mov    %esp,%ecx
+     746:	ba 4d 07 00 00       	mov    $0x74d,%edx
+     74b:	0f 34                	sysenter
+     74d:	c3                   	ret
+
+0000074e <_exec>:
+STUB(_exec, SYS_exec)
+     74e:	b8 07 00 00 00       	mov    $0x7,%eax
+     753:	89 e1                	mov    %esp,%ecx
+     755:	ba 5c 07 00 00       	mov    $0x75c,%edx
+     75a:	0f 34                	sysenter
+     75c:	c3                   	ret
+
+0000075d <_dup2>:
+STUB(_dup2, SYS_dup2)
+     75d:	b8 17 00 00 00       	mov    $0x17,%eax
+     762:	89 e1                	mov    %esp,%ecx
+     764:	ba 6b 07 00 00       	mov    $0x76b,%edx
+     769:	0f 34                	sysenter
+     76b:	c3                   	ret
+
+0000076c <wait>:
+
+SYSCALL(wait)
+     76c:	b8 03 00 00 00       	mov    $0x3,%eax
+     771:	89 e1                	mov    %esp,%ecx
+     773:	ba 7a 07 00 00       	mov    $0x77a,%edx
+     778:	0f 34                	sysenter
+     77a:	c3                   	ret
+
+0000077b <pipe>:
+SYSCALL(pipe)
+     77b:	b8 04 00 00 00       	mov    $0x4,%eax
+     780:	89 e1                	mov    %esp,%ecx
+     782:	ba 89 07 00 00       	mov    $0x789,%edx
+     787:	0f 34                	sysenter
+     789:	c3                   	ret
+
+0000078a <read>:
+SYSCALL(read)
+     78a:	b8 05 00 00 00       	mov    $0x5,%eax
+     78f:	89 e1                	mov    %esp,%ecx
+     791:	ba 98 07 00 00       	mov    $0x798,%edx
+     796:	0f 34                	sysenter
+     798:	c3                   	ret
+
+00000799 <write>:
+SYSCALL(write)
+     799:	b8 10 00 00 00       	mov    $0x10,%eax
+     79e:	89 e1                	mov    %esp,%ecx
+     7a0:	ba a7 07 00 00       	mov    $0x7a7,%edx
+     7a5:	0f 34                	sysenter
+     7a7:	c3                   	ret
+
+000007a8 <kill>:
+SYSCALL(kill)
+     7a8:	b8 06 00 00 00       	mov    $0x6,%eax
+     7ad:	89 e1                	mov    %esp,%ecx
+     7af:	ba b6 07 00 00       	mov    $0x7b6,%edx
+     7b4:	0f 34                	sysenter
+     7b6:	c3                   	ret
+
+000007b7 <open>:
+SYSCALL(open)
+     7b7:	b8 0f 00 00 00       	mov    $0xf,%eax
+     7bc:	89 e1                	mov    %esp,%ecx
+     7be:	ba c5 07 00 00       	mov    $0x7c5,%edx
+     7c3:	0f 34                	sysenter
+     7c5:	c3                   	ret
+
+000007c6 <mknod>:
+SYSCALL(mknod)
+     7c6:	b8 11 00 00 00       	mov    $0x11,%eax
+     7cb:	89 e1                	mov    %esp,%ecx
+     7cd:	ba d4 07 00 00       	mov    $0x7d4,%edx
+     7d2:	0f 34                	sysenter
+     7d4:	c3                   	ret
+
+000007d5 <unlink>:
+SYSCALL(unlink)
+     7d5:	b8 12 00 00 00       	mov    $0x12,%eax
+     7da:	89 e1                	mov    %esp,%ecx
+     7dc:	ba e3 07 00 00       	mov    $0x7e3,%edx
+     7e1:	0f 34                	sysenter
+     7e3:	c3                   	ret
+
+000007e4 <fstat>:
+SYSCALL(fstat)
+     7e4:	b8 08 00 00 00       	mov    $0x8,%eax
+     7e9:	89 e1                	mov    %esp,%ecx
+     7eb:	ba f2 07 00 00       	mov    $0x7f2,%edx
+     7f0:	0f 34                	sysenter
+     7f2:	c3                   	ret
+
+000007f3 <link>:
+SYSCALL(link)
+     7f3:	b8 13 00 00 00       	mov    $0x13,%eax
+     7f8:	89 e1                	mov    %esp,%ecx
+     7fa:	ba 01 08 00 00       	mov    $0x801,%edx
+     7ff:	0f 34                	sysenter
+     801:	c3                   	ret
+
+00000802 <mkdir>:
+SYSCALL(mkdir)
+     802:	b8 14 00 00 00       	mov    $0x14,%eax
+     807:	89 e1                	mov    %esp,%ecx
+     809:	ba 10 08 00 00       	mov    $0x810,%edx
+     80e:	0f 34                	sysenter
+     810:	c3                   	ret
+
+00000811 <chdir>:
+SYSCALL(chdir)
+     811:	b8 09 00 00 00       	mov    $0x9,%eax
+     816:	89 e1                	mov    %esp,%ecx
+     818:	ba 1f 08 00 00       	mov    $0x81f,%edx
+     81d:	0f 34                	sysenter
+     81f:	c3                   	ret
+
+00000820 <dup>:
+SYSCALL(dup)
+     820:	b8 0a 00 00 00       	mov    $0xa,%eax
+     825:	89 e1                	mov    %esp,%ecx
+     827:	ba 2e 08 00 00       	mov    $0x82e,%edx
+     82c:	0f 34                	sysenter
+     82e:	c3                   	ret
+
+0000082f <getpid>:
+SYSCALL(getpid)
+     82f:	b8 0b 00 00 00       	mov    $0xb,%eax
+     834:	89 e1                	mov    %esp,%ecx
+     836:	ba 3d 08 00 00       	mov    $0x83d,%edx
+     83b:	0f 34                	sysenter
+     83d:	c3                   	ret
+
+0000083e <sbrk>:
+SYSCALL(sbrk)
+     83e:	b8 0c 00 00 00       	mov    $0xc,%eax
+     843:	89 e1                	mov    %esp,%ecx
+     845:	ba 4c 08 00 00       	mov    $0x84c,%edx
+     84a:	0f 34                	sysenter
+     84c:	c3                   	ret
+
+0000084d <sleep>:
+SYSCALL(sleep)
+     84d:	b8 0d 00 00 00       	mov    $0xd,%eax
+     852:	89 e1                	mov    %esp,%ecx
+     854:	ba 5b 08 00 00       	mov    $0x85b,%edx
+     859:	0f 34                	sysenter
+     85b:	c3                   	ret
+
+0000085c <uptime>:
+SYSCALL(uptime)
+     85c:	b8 0e 00 00 00       	mov    $0xe,%eax
+     861:	89 e1                	mov    %esp,%ecx
+     863:	ba 6a 08 00 00       	mov    $0x86a,%edx
+     868:	0f 34                	sysenter
+     86a:	c3                   	ret
+
+0000086b <date>:
+SYSCALL(date)
+     86b:	b8 16 00 00 00       	mov    $0x16,%eax
+     870:	89 e1                	mov    %esp,%ecx
+     872:	ba 79 08 00 00       	mov    $0x879,%edx
+     877:	0f 34                	sysenter
+     879:	c3                   	ret
+
+0000087a <faultaround>:
+SYSCALL(faultaround)
+     87a:	b8 18 00 00 00       	mov    $0x18,%eax
+     87f:	89 e1                	mov    %esp,%ecx
+     881:	ba 88 08 00 00       	mov    $0x888,%edx
+     886:	0f 34                	sysenter
+     888:	c3                   	ret
+
+00000889 <faultstat>:
+SYSCALL(faultstat)
+     889:	b8 19 00 00 00       	mov    $0x19,%eax
+     88e:	89 e1                	mov    %esp,%ecx
+     890:	ba 97 08 00 00       	mov    $0x897,%edx
+     895:	0f 34                	sysenter
+     897:	c3                   	ret
+
+00000898 <mmap>:
+SYSCALL(mmap)
+     898:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     89d:	89 e1                	mov    %esp,%ecx
+     89f:	ba a6 08 00 00       	mov    $0x8a6,%edx
+     8a4:	0f 34                	sysenter
+     8a6:	c3                   	ret
+
+000008a7 <munmap>:
+SYSCALL(munmap)
+     8a7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     8ac:	89 e1                	mov    %esp,%ecx
+     8ae:	ba b5 08 00 00       	mov    $0x8b5,%edx
+     8b3:	0f 34                	sysenter
+     8b5:	c3                   	ret
+
+000008b6 <largepages>:
+SYSCALL(largepages)
+     8b6:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     8bb:	89 e1                	mov    %esp,%ecx
+     8bd:	ba c4 08 00 00       	mov    $0x8c4,%edx
+     8c2:	0f 34                	sysenter
+     8c4:	c3                   	ret
+
+000008c5 <spawn>:
+SYSCALL(spawn)
+     8c5:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     8ca:	89 e1                	mov    %esp,%ecx
+     8cc:	ba d3 08 00 00       	mov    $0x8d3,%edx
+     8d1:	0f 34                	sysenter
+     8d3:	c3                   	ret
+
+000008d4 <setpriority>:
+SYSCALL(setpriority)
+     8d4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     8d9:	89 e1                	mov    %esp,%ecx
+     8db:	ba e2 08 00 00       	mov    $0x8e2,%edx
+     8e0:	0f 34                	sysenter
+     8e2:	c3                   	ret
+
+000008e3 <getpriority>:
+SYSCALL(getpriority)
+     8e3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     8e8:	89 e1                	mov    %esp,%ecx
+     8ea:	ba f1 08 00 00       	mov    $0x8f1,%edx
+     8ef:	0f 34                	sysenter
+     8f1:	c3                   	ret
+
+000008f2 <getprocinfo>:
+SYSCALL(getprocinfo)
+     8f2:	b8 20 00 00 00       	mov    $0x20,%eax
+     8f7:	89 e1                	mov    %esp,%ecx
+     8f9:	ba 00 09 00 00       	mov    $0x900,%edx
+     8fe:	0f 34                	sysenter
+     900:	c3                   	ret
+
+00000901 <getcpuinfo>:
+SYSCALL(getcpuinfo)
+     901:	b8 21 00 00 00       	mov    $0x21,%eax
+     906:	89 e1                	mov    %esp,%ecx
+     908:	ba 0f 09 00 00       	mov    $0x90f,%edx
+     90d:	0f 34                	sysenter
+     90f:	c3                   	ret
+
+00000910 <clone>:
+SYSCALL(clone)
+     910:	b8 22 00 00 00       	mov    $0x22,%eax
+     915:	89 e1                	mov    %esp,%ecx
+     917:	ba 1e 09 00 00       	mov    $0x91e,%edx
+     91c:	0f 34                	sysenter
+     91e:	c3                   	ret
+
+0000091f <join>:
+SYSCALL(join)
+     91f:	b8 23 00 00 00       	mov    $0x23,%eax
+     924:	89 e1                	mov    %esp,%ecx
+     926:	ba 2d 09 00 00       	mov    $0x92d,%edx
+     92b:	0f 34                	sysenter
+     92d:	c3                   	ret
+
+0000092e <futex_wait>:
+SYSCALL(futex_wait)
+     92e:	b8 24 00 00 00       	mov    $0x24,%eax
+     933:	89 e1                	mov    %esp,%ecx
+     935:	ba 3c 09 00 00       	mov    $0x93c,%edx
+     93a:	0f 34                	sysenter
+     93c:	c3                   	ret
+
+0000093d <futex_wake>:
+SYSCALL(futex_wake)
+     93d:	b8 25 00 00 00       	mov    $0x25,%eax
+     942:	89 e1                	mov    %esp,%ecx
+     944:	ba 4b 09 00 00       	mov    $0x94b,%edx
+     949:	0f 34                	sysenter
+     94b:	c3                   	ret
+
+0000094c <setaffinity>:
+SYSCALL(setaffinity)
+     94c:	b8 26 00 00 00       	mov    $0x26,%eax
+     951:	89 e1                	mov    %esp,%ecx
+     953:	ba 5a 09 00 00       	mov    $0x95a,%edx
+     958:	0f 34                	sysenter
+     95a:	c3                   	ret
+
+0000095b <getaffinity>:
+SYSCALL(getaffinity)
+     95b:	b8 27 00 00 00       	mov    $0x27,%eax
+     960:	89 e1                	mov    %esp,%ecx
+     962:	ba 69 09 00 00       	mov    $0x969,%edx
+     967:	0f 34                	sysenter
+     969:	c3                   	ret
+
+0000096a <clock_gettime>:
+SYSCALL(clock_gettime)
+     96a:	b8 28 00 00 00       	mov    $0x28,%eax
+     96f:	89 e1                	mov    %esp,%ecx
+     971:	ba 78 09 00 00       	mov    $0x978,%edx
+     976:	0f 34                	sysenter
+     978:	c3                   	ret
+
+00000979 <msleep>:
+SYSCALL(msleep)
+     979:	b8 29 00 00 00       	mov    $0x29,%eax
+     97e:	89 e1                	mov    %esp,%ecx
+     980:	ba 87 09 00 00       	mov    $0x987,%edx
+     985:	0f 34                	sysenter
+     987:	c3                   	ret
+
+00000988 <lockstat>:
+SYSCALL(lockstat)
+     988:	b8 2a 00 00 00       	mov    $0x2a,%eax
+     98d:	89 e1                	mov    %esp,%ecx
+     98f:	ba 96 09 00 00       	mov    $0x996,%edx
+     994:	0f 34                	sysenter
+     996:	c3                   	ret
+
+00000997 <bstat>:
+SYSCALL(bstat)
+     997:	b8 2b 00 00 00       	mov    $0x2b,%eax
+     99c:	89 e1                	mov    %esp,%ecx
+     99e:	ba a5 09 00 00       	mov    $0x9a5,%edx
+     9a3:	0f 34                	sysenter
+     9a5:	c3                   	ret
+
+000009a6 <iostat>:
+SYSCALL(iostat)
+     9a6:	b8 2c 00 00 00       	mov    $0x2c,%eax
+     9ab:	89 e1                	mov    %esp,%ecx
+     9ad:	ba b4 09 00 00       	mov    $0x9b4,%edx
+     9b2:	0f 34                	sysenter
+     9b4:	c3                   	ret
+
+000009b5 <fsync>:
+SYSCALL(fsync)
+     9b5:	b8 2d 00 00 00       	mov    $0x2d,%eax
+     9ba:	89 e1                	mov    %esp,%ecx
+     9bc:	ba c3 09 00 00       	mov    $0x9c3,%edx
+     9c1:	0f 34                	sysenter
+     9c3:	c3                   	ret
+
+000009c4 <pread>:
+SYSCALL(pread)
+     9c4:	b8 2e 00 00 00       	mov    $0x2e,%eax
+     9c9:	89 e1                	mov    %esp,%ecx
+     9cb:	ba d2 09 00 00       	mov    $0x9d2,%edx
+     9d0:	0f 34                	sysenter
+     9d2:	c3                   	ret
+
+000009d3 <pwrite>:
+SYSCALL(pwrite)
+     9d3:	b8 2f 00 00 00       	mov    $0x2f,%eax
+     9d8:	89 e1                	mov    %esp,%ecx
+     9da:	ba e1 09 00 00       	mov    $0x9e1,%edx
+     9df:	0f 34                	sysenter
+     9e1:	c3                   	ret
+
+000009e2 <readv>:
+SYSCALL(readv)
+     9e2:	b8 30 00 00 00       	mov    $0x30,%eax
+     9e7:	89 e1                	mov    %esp,%ecx
+     9e9:	ba f0 09 00 00       	mov    $0x9f0,%edx
+     9ee:	0f 34                	sysenter
+     9f0:	c3                   	ret
+
+000009f1 <writev>:
+SYSCALL(writev)
+     9f1:	b8 31 00 00 00       	mov    $0x31,%eax
+     9f6:	89 e1                	mov    %esp,%ecx
+     9f8:	ba ff 09 00 00       	mov    $0x9ff,%edx
+     9fd:	0f 34                	sysenter
+     9ff:	c3                   	ret
+
+00000a00 <sendfile>:
+SYSCALL(sendfile)
+     a00:	b8 32 00 00 00       	mov    $0x32,%eax
+     a05:	89 e1                	mov    %esp,%ecx
+     a07:	ba 0e 0a 00 00       	mov    $0xa0e,%edx
+     a0c:	0f 34                	sysenter
+     a0e:	c3                   	ret
+
+00000a0f <fcntl>:
+SYSCALL(fcntl)
+     a0f:	b8 33 00 00 00       	mov    $0x33,%eax
+     a14:	89 e1                	mov    %esp,%ecx
+     a16:	ba 1d 0a 00 00       	mov    $0xa1d,%edx
+     a1b:	0f 34                	sysenter
+     a1d:	c3                   	ret
+
+00000a1e <mount>:
+SYSCALL(mount)
+     a1e:	b8 34 00 00 00       	mov    $0x34,%eax
+     a23:	89 e1                	mov    %esp,%ecx
+     a25:	ba 2c 0a 00 00       	mov    $0xa2c,%edx
+     a2a:	0f 34                	sysenter
+     a2c:	c3                   	ret
+
+00000a2d <getdents>:
+SYSCALL(getdents)
+     a2d:	b8 35 00 00 00       	mov    $0x35,%eax
+     a32:	89 e1                	mov    %esp,%ecx
+     a34:	ba 3b 0a 00 00       	mov    $0xa3b,%edx
+     a39:	0f 34                	sysenter
+     a3b:	c3                   	ret
+
+00000a3c <fstatat>:
+SYSCALL(fstatat)
+     a3c:	b8 36 00 00 00       	mov    $0x36,%eax
+     a41:	89 e1                	mov    %esp,%ecx
+     a43:	ba 4a 0a 00 00       	mov    $0xa4a,%edx
+     a48:	0f 34                	sysenter
+     a4a:	c3                   	ret
+
+00000a4b <sysstat>:
+SYSCALL(sysstat)
+     a4b:	b8 37 00 00 00       	mov    $0x37,%eax
+     a50:	89 e1                	mov    %esp,%ecx
+     a52:	ba 59 0a 00 00       	mov    $0xa59,%edx
+     a57:	0f 34                	sysenter
+     a59:	c3                   	ret
+
+00000a5a <ringenter>:
+SYSCALL(ringenter)
+     a5a:	b8 38 00 00 00       	mov    $0x38,%eax
+     a5f:	89 e1                	mov    %esp,%ecx
+     a61:	ba 68 0a 00 00       	mov    $0xa68,%edx
+     a66:	0f 34                	sysenter
+     a68:	c3                   	ret
+
+00000a69 <trace>:
+SYSCALL(trace)
+     a69:	b8 39 00 00 00       	mov    $0x39,%eax
+     a6e:	89 e1                	mov    %esp,%ecx
+     a70:	ba 77 0a 00 00       	mov    $0xa77,%edx
+     a75:	0f 34                	sysenter
+     a77:	c3                   	ret
+
+00000a78 <memstat>:
+SYSCALL(memstat)
+     a78:	b8 3a 00 00 00       	mov    $0x3a,%eax
+     a7d:	89 e1                	mov    %esp,%ecx
+     a7f:	ba 86 0a 00 00       	mov    $0xa86,%edx
+     a84:	0f 34                	sysenter
+     a86:	c3                   	ret
+
+00000a87 <shmget>:
+SYSCALL(shmget)
+     a87:	b8 3b 00 00 00       	mov    $0x3b,%eax
+     a8c:	89 e1                	mov    %esp,%ecx
+     a8e:	ba 95 0a 00 00       	mov    $0xa95,%edx
+     a93:	0f 34                	sysenter
+     a95:	c3                   	ret
+
+00000a96 <shmat>:
+SYSCALL(shmat)
+     a96:	b8 3c 00 00 00       	mov    $0x3c,%eax
+     a9b:	89 e1                	mov    %esp,%ecx
+     a9d:	ba a4 0a 00 00       	mov    $0xaa4,%edx
+     aa2:	0f 34                	sysenter
+     aa4:	c3                   	ret
+
+00000aa5 <shmdt>:
+SYSCALL(shmdt)
+     aa5:	b8 3d 00 00 00       	mov    $0x3d,%eax
+     aaa:	89 e1                	mov    %esp,%ecx
+     aac:	ba b3 0a 00 00       	mov    $0xab3,%edx
+     ab1:	0f 34                	sysenter
+     ab3:	c3                   	ret
+
+00000ab4 <irqstat>:
+SYSCALL(irqstat)
+     ab4:	b8 3e 00 00 00       	mov    $0x3e,%eax
+     ab9:	89 e1                	mov    %esp,%ecx
+     abb:	ba c2 0a 00 00       	mov    $0xac2,%edx
+     ac0:	0f 34                	sysenter
+     ac2:	c3                   	ret
+
+00000ac3 <irqroute>:
+SYSCALL(irqroute)
+     ac3:	b8 3f 00 00 00       	mov    $0x3f,%eax
+     ac8:	89 e1                	mov    %esp,%ecx
+     aca:	ba d1 0a 00 00       	mov    $0xad1,%edx
+     acf:	0f 34                	sysenter
+     ad1:	c3                   	ret
+
+00000ad2 <putc>:
+  char buf[64];
+};
+
+static void
+putc(struct out *o, char c)
+{
+     ad2:	55                   	push   %ebp
+     ad3:	89 e5                	mov    %esp,%ebp
+     ad5:	56                   	push   %esi
+     ad6:	53                   	push   %ebx
+     ad7:	89 c3                	mov    %eax,%ebx
+     ad9:	89 d6                	mov    %edx,%esi
+  if(o->n == sizeof(o->buf)){
+     adb:	8b 40 04             	mov    0x4(%eax),%eax
+     ade:	83 f8 40             	cmp    $0x40,%eax
+     ae1:	74 16                	je     af9 <putc+0x27>
+    bufwrite(o->fd, o->buf, o->n);
+    o->n = 0;
+  }
+  o->buf[o->n++] = c;
+     ae3:	8b 43 04             	mov    0x4(%ebx),%eax
+     ae6:	8d 50 01             	lea    0x1(%eax),%edx
+     ae9:	89 53 04             	mov    %edx,0x4(%ebx)
+     aec:	89 f1                	mov    %esi,%ecx
+     aee:	88 4c 03 08          	mov    %cl,0x8(%ebx,%eax,1)
+}
+     af2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     af5:	5b                   	pop    %ebx
+     af6:	5e                   	pop    %esi
+     af7:	5d                   	pop    %ebp
+     af8:	c3                   	ret
+    bufwrite(o->fd, o->buf, o->n);
+     af9:	8d 53 08             	lea    0x8(%ebx),%edx
+     afc:	83 ec 04             	sub    $0x4,%esp
+     aff:	50                   	push   %eax
+     b00:	52                   	push   %edx
+     b01:	ff 33                	push   (%ebx)
+     b03:	e8 b2 f9 ff ff       	call   4ba <bufwrite>
+    o->n = 0;
+     b08:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+     b0f:	83 c4 10             	add    $0x10,%esp
+     b12:	eb cf                	jmp    ae3 <putc+0x11>
+
+00000b14 <printint>:
+
+static void
+printint(struct out *o, int xx, int base, int sgn)
+{
+     b14:	55                   	push   %ebp
+     b15:	89 e5                	mov    %esp,%ebp
+     b17:	57                   	push   %edi
+     b18:	56                   	push   %esi
+     b19:	53                   	push   %ebx
+     b1a:	83 ec 2c             	sub    $0x2c,%esp
+     b1d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     b20:	89 d0                	mov    %edx,%eax
+     b22:	89 ce                	mov    %ecx,%esi
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+     b24:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+     b28:	0f 95 c1             	setne  %cl
+     b2b:	c1 ea 1f             	shr    $0x1f,%edx
+     b2e:	84 d1                	test   %dl,%cl
+     b30:	74 44                	je     b76 <printint+0x62>
+    neg = 1;
+    x = -xx;
+     b32:	f7 d8                	neg    %eax
+     b34:	89 c1                	mov    %eax,%ecx
+    neg = 1;
+     b36:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%ebp)
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     b3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  do{
+    buf[i++] = digits[x % base];
+     b42:	89 c8                	mov    %ecx,%eax
+     b44:	ba 00 00 00 00       	mov    $0x0,%edx
+     b49:	f7 f6                	div    %esi
+     b4b:	89 df                	mov    %ebx,%edi
+     b4d:	83 c3 01             	add    $0x1,%ebx
+     b50:	0f b6 92 1c 12 00 00 	movzbl 0x121c(%edx),%edx
+     b57:	88 54 3d d8          	mov    %dl,-0x28(%ebp,%edi,1)
+  }while((x /= base) != 0);
+     b5b:	89 ca                	mov    %ecx,%edx
+     b5d:	89 c1                	mov    %eax,%ecx
+     b5f:	39 f2                	cmp    %esi,%edx
+     b61:	73 df                	jae    b42 <printint+0x2e>
+  if(neg)
+     b63:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     b67:	74 31                	je     b9a <printint+0x86>
+    buf[i++] = '-';
+     b69:	c6 44 1d d8 2d       	movb   $0x2d,-0x28(%ebp,%ebx,1)
+     b6e:	8d 5f 02             	lea    0x2(%edi),%ebx
+     b71:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     b74:	eb 17                	jmp    b8d <printint+0x79>
+    x = xx;
+     b76:	89 c1                	mov    %eax,%ecx
+  neg = 0;
+     b78:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     b7f:	eb bc                	jmp    b3d <printint+0x29>
+
+  while(--i >= 0)
+    putc(o, buf[i]);
+     b81:	0f be 54 1d d8       	movsbl -0x28(%ebp,%ebx,1),%edx
+     b86:	89 f0                	mov    %esi,%eax
+     b88:	e8 45 ff ff ff       	call   ad2 <putc>
+  while(--i >= 0)
+     b8d:	83 eb 01             	sub    $0x1,%ebx
+     b90:	79 ef                	jns    b81 <printint+0x6d>
+}
+     b92:	83 c4 2c             	add    $0x2c,%esp
+     b95:	5b                   	pop    %ebx
+     b96:	5e                   	pop    %esi
+     b97:	5f                   	pop    %edi
+     b98:	5d                   	pop    %ebp
+     b99:	c3                   	ret
+     b9a:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     b9d:	eb ee                	jmp    b8d <printint+0x79>
+
+00000b9f <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     b9f:	55                   	push   %ebp
+     ba0:	89 e5                	mov    %esp,%ebp
+     ba2:	57                   	push   %edi
+     ba3:	56                   	push   %esi
+     ba4:	53                   	push   %ebx
+     ba5:	83 ec 6c             	sub    $0x6c,%esp
+  int c, i, state;
+  uint *ap;
+  struct out out, *o;
+
+  o = &out;
+  o->fd = fd;
+     ba8:	8b 45 08             	mov    0x8(%ebp),%eax
+     bab:	89 45 a0             	mov    %eax,-0x60(%ebp)
+  o->n = 0;
+     bae:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+     bb5:	8d 45 10             	lea    0x10(%ebp),%eax
+     bb8:	89 45 94             	mov    %eax,-0x6c(%ebp)
+  state = 0;
+     bbb:	be 00 00 00 00       	mov    $0x0,%esi
+  for(i = 0; fmt[i]; i++){
+     bc0:	bb 00 00 00 00       	mov    $0x0,%ebx
+     bc5:	eb 14                	jmp    bdb <printf+0x3c>
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+      } else {
+        putc(o, c);
+     bc7:	89 fa                	mov    %edi,%edx
+     bc9:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     bcc:	e8 01 ff ff ff       	call   ad2 <putc>
+     bd1:	eb 05                	jmp    bd8 <printf+0x39>
+      }
+    } else if(state == '%'){
+     bd3:	83 fe 25             	cmp    $0x25,%esi
+     bd6:	74 25                	je     bfd <printf+0x5e>
+  for(i = 0; fmt[i]; i++){
+     bd8:	83 c3 01             	add    $0x1,%ebx
+     bdb:	8b 45 0c             	mov    0xc(%ebp),%eax
+     bde:	0f b6 04 18          	movzbl (%eax,%ebx,1),%eax
+     be2:	84 c0                	test   %al,%al
+     be4:	0f 84 20 01 00 00    	je     d0a <printf+0x16b>
+    c = fmt[i] & 0xff;
+     bea:	0f be f8             	movsbl %al,%edi
+     bed:	0f b6 c0             	movzbl %al,%eax
+    if(state == 0){
+     bf0:	85 f6                	test   %esi,%esi
+     bf2:	75 df                	jne    bd3 <printf+0x34>
+      if(c == '%'){
+     bf4:	83 f8 25             	cmp    $0x25,%eax
+     bf7:	75 ce                	jne    bc7 <printf+0x28>
+        state = '%';
+     bf9:	89 c6                	mov    %eax,%esi
+     bfb:	eb db                	jmp    bd8 <printf+0x39>
+      if(c == 'd'){
+     bfd:	83 f8 25             	cmp    $0x25,%eax
+     c00:	0f 84 cf 00 00 00    	je     cd5 <printf+0x136>
+     c06:	0f 8c dd 00 00 00    	jl     ce9 <printf+0x14a>
+     c0c:	83 f8 78             	cmp    $0x78,%eax
+     c0f:	0f 8f d4 00 00 00    	jg     ce9 <printf+0x14a>
+     c15:	83 f8 63             	cmp    $0x63,%eax
+     c18:	0f 8c cb 00 00 00    	jl     ce9 <printf+0x14a>
+     c1e:	83 e8 63             	sub    $0x63,%eax
+     c21:	83 f8 15             	cmp    $0x15,%eax
+     c24:	0f 87 bf 00 00 00    	ja     ce9 <printf+0x14a>
+     c2a:	ff 24 85 c4 11 00 00 	jmp    *0x11c4(,%eax,4)
+        printint(o, *ap, 10, 1);
+     c31:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     c34:	8b 17                	mov    (%edi),%edx
+     c36:	83 ec 0c             	sub    $0xc,%esp
+     c39:	6a 01                	push   $0x1
+     c3b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     c40:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     c43:	e8 cc fe ff ff       	call   b14 <printint>
+        ap++;
+     c48:	83 c7 04             	add    $0x4,%edi
+     c4b:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     c4e:	83 c4 10             	add    $0x10,%esp
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(o, '%');
+        putc(o, c);
+      }
+      state = 0;
+     c51:	be 00 00 00 00       	mov    $0x0,%esi
+     c56:	eb 80                	jmp    bd8 <printf+0x39>
+        printint(o, *ap, 16, 0);
+     c58:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     c5b:	8b 17                	mov    (%edi),%edx
+     c5d:	83 ec 0c             	sub    $0xc,%esp
+     c60:	6a 00                	push   $0x0
+     c62:	b9 10 00 00 00       	mov    $0x10,%ecx
+     c67:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     c6a:	e8 a5 fe ff ff       	call   b14 <printint>
+        ap++;
+     c6f:	83 c7 04             	add    $0x4,%edi
+     c72:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+     c75:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     c78:	be 00 00 00 00       	mov    $0x0,%esi
+     c7d:	e9 56 ff ff ff       	jmp    bd8 <printf+0x39>
+        s = (char*)*ap;
+     c82:	8b 45 94             	mov    -0x6c(%ebp),%eax
+     c85:	8b 30                	mov    (%eax),%esi
+        ap++;
+     c87:	83 c0 04             	add    $0x4,%eax
+     c8a:	89 45 94             	mov    %eax,-0x6c(%ebp)
+        if(s == 0)
+     c8d:	85 f6                	test   %esi,%esi
+     c8f:	75 15                	jne    ca6 <printf+0x107>
+          s = "(null)";
+     c91:	be bc 11 00 00       	mov    $0x11bc,%esi
+     c96:	eb 0e                	jmp    ca6 <printf+0x107>
+          putc(o, *s);
+     c98:	0f be d2             	movsbl %dl,%edx
+     c9b:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     c9e:	e8 2f fe ff ff       	call   ad2 <putc>
+          s++;
+     ca3:	83 c6 01             	add    $0x1,%esi
+        while(*s != 0){
+     ca6:	0f b6 16             	movzbl (%esi),%edx
+     ca9:	84 d2                	test   %dl,%dl
+     cab:	75 eb                	jne    c98 <printf+0xf9>
+      state = 0;
+     cad:	be 00 00 00 00       	mov    $0x0,%esi
+     cb2:	e9 21 ff ff ff       	jmp    bd8 <printf+0x39>
+        putc(o, *ap);
+     cb7:	8b 7d 94             	mov    -0x6c(%ebp),%edi
+     cba:	0f be 17             	movsbl (%edi),%edx
+     cbd:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     cc0:	e8 0d fe ff ff       	call   ad2 <putc>
+        ap++;
+     cc5:	83 c7 04             	add    $0x4,%edi
+     cc8:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+      state = 0;
+     ccb:	be 00 00 00 00       	mov    $0x0,%esi
+     cd0:	e9 03 ff ff ff       	jmp    bd8 <printf+0x39>
+        putc(o, c);
+     cd5:	89 fa                	mov    %edi,%edx
+     cd7:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     cda:	e8 f3 fd ff ff       	call   ad2 <putc>
+      state = 0;
+     cdf:	be 00 00 00 00       	mov    $0x0,%esi
+     ce4:	e9 ef fe ff ff       	jmp    bd8 <printf+0x39>
+        putc(o, '%');
+     ce9:	ba 25 00 00 00       	mov    $0x25,%edx
+     cee:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     cf1:	e8 dc fd ff ff       	call   ad2 <putc>
+        putc(o, c);
+     cf6:	89 fa                	mov    %edi,%edx
+     cf8:	8d 45 a0             	lea    -0x60(%ebp),%eax
+     cfb:	e8 d2 fd ff ff       	call   ad2 <putc>
+      state = 0;
+     d00:	be 00 00 00 00       	mov    $0x0,%esi
+     d05:	e9 ce fe ff ff       	jmp    bd8 <printf+0x39>
+    }
+  }
+  if(o->n > 0)
+     d0a:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+     d0d:	85 c0                	test   %eax,%eax
+     d0f:	7f 08                	jg     d19 <printf+0x17a>
+    bufwrite(fd, o->buf, o->n);
+}
+     d11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d14:	5b                   	pop    %ebx
+     d15:	5e                   	pop    %esi
+     d16:	5f                   	pop    %edi
+     d17:	5d                   	pop    %ebp
+     d18:	c3                   	ret
+    bufwrite(fd, o->buf, o->n);
+     d19:	83 ec 04             	sub    $0x4,%esp
+     d1c:	50                   	push   %eax
+     d1d:	8d 45 a8             	lea    -0x58(%ebp),%eax
+     d20:	50                   	push   %eax
+     d21:	ff 75 08             	push   0x8(%ebp)
+     d24:	e8 91 f7 ff ff       	call   4ba <bufwrite>
+     d29:	83 c4 10             	add    $0x10,%esp
+}
+     d2c:	eb e3                	jmp    d11 <printf+0x172>
+
+00000d2e <largefree>:
+  return &b->h;
+}
+
+static void
+largefree(Fblock *b)
+{
+     d2e:	55                   	push   %ebp
+     d2f:	89 e5                	mov    %esp,%ebp
+     d31:	57                   	push   %edi
+     d32:	56                   	push   %esi
+     d33:	53                   	push   %ebx
+     d34:	83 ec 0c             	sub    $0xc,%esp
+     d37:	89 c1                	mov    %eax,%ecx
+  Fblock **pp, *p, *prev;
+
+  prev = 0;
+     d39:	bb 00 00 00 00       	mov    $0x0,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     d3e:	ba 6c 39 00 00       	mov    $0x396c,%edx
+     d43:	eb 05                	jmp    d4a <largefree+0x1c>
+     d45:	8d 50 08             	lea    0x8(%eax),%edx
+    prev = p;
+     d48:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (p = *pp) != 0 && p < b; pp = &p->next)
+     d4a:	8b 02                	mov    (%edx),%eax
+     d4c:	85 c0                	test   %eax,%eax
+     d4e:	74 04                	je     d54 <largefree+0x26>
+     d50:	39 c8                	cmp    %ecx,%eax
+     d52:	72 f1                	jb     d45 <largefree+0x17>
+  b->next = p;
+     d54:	89 41 08             	mov    %eax,0x8(%ecx)
+  if(p && (char*)b + b->h.size == (char*)p){
+     d57:	85 c0                	test   %eax,%eax
+     d59:	74 09                	je     d64 <largefree+0x36>
+     d5b:	8b 31                	mov    (%ecx),%esi
+     d5d:	8d 3c 31             	lea    (%ecx,%esi,1),%edi
+     d60:	39 c7                	cmp    %eax,%edi
+     d62:	74 21                	je     d85 <largefree+0x57>
+    b->h.size += p->h.size;
+    b->next = p->next;
+  }
+  if(prev && (char*)prev + prev->h.size == (char*)b){
+     d64:	85 db                	test   %ebx,%ebx
+     d66:	74 09                	je     d71 <largefree+0x43>
+     d68:	8b 03                	mov    (%ebx),%eax
+     d6a:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+     d6d:	39 ce                	cmp    %ecx,%esi
+     d6f:	74 20                	je     d91 <largefree+0x63>
+    prev->h.size += b->h.size;
+    prev->next = b->next;
+  } else
+    *pp = b;
+     d71:	89 0a                	mov    %ecx,(%edx)
+
+  // Give the top of the heap back.  With threads sharing the
+  // address space sbrk() cannot shrink it; keep the block then.
+  for(pp = &large; (*pp)->next; pp = &(*pp)->next)
+     d73:	be 6c 39 00 00       	mov    $0x396c,%esi
+     d78:	8b 1e                	mov    (%esi),%ebx
+     d7a:	83 7b 08 00          	cmpl   $0x0,0x8(%ebx)
+     d7e:	74 1d                	je     d9d <largefree+0x6f>
+     d80:	8d 73 08             	lea    0x8(%ebx),%esi
+     d83:	eb f3                	jmp    d78 <largefree+0x4a>
+    b->h.size += p->h.size;
+     d85:	03 30                	add    (%eax),%esi
+     d87:	89 31                	mov    %esi,(%ecx)
+    b->next = p->next;
+     d89:	8b 40 08             	mov    0x8(%eax),%eax
+     d8c:	89 41 08             	mov    %eax,0x8(%ecx)
+     d8f:	eb d3                	jmp    d64 <largefree+0x36>
+    prev->h.size += b->h.size;
+     d91:	03 01                	add    (%ecx),%eax
+     d93:	89 03                	mov    %eax,(%ebx)
+    prev->next = b->next;
+     d95:	8b 41 08             	mov    0x8(%ecx),%eax
+     d98:	89 43 08             	mov    %eax,0x8(%ebx)
+     d9b:	eb d6                	jmp    d73 <largefree+0x45>
+    ;
+  b = *pp;
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     d9d:	89 df                	mov    %ebx,%edi
+     d9f:	03 3b                	add    (%ebx),%edi
+     da1:	83 ec 0c             	sub    $0xc,%esp
+     da4:	6a 00                	push   $0x0
+     da6:	e8 93 fa ff ff       	call   83e <sbrk>
+     dab:	83 c4 10             	add    $0x10,%esp
+     dae:	39 c7                	cmp    %eax,%edi
+     db0:	74 08                	je     dba <largefree+0x8c>
+    *pp = 0;
+}
+     db2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     db5:	5b                   	pop    %ebx
+     db6:	5e                   	pop    %esi
+     db7:	5f                   	pop    %edi
+     db8:	5d                   	pop    %ebp
+     db9:	c3                   	ret
+  if((char*)b + b->h.size == sbrk(0) && sbrk(-b->h.size) != (char*)-1)
+     dba:	8b 03                	mov    (%ebx),%eax
+     dbc:	f7 d8                	neg    %eax
+     dbe:	83 ec 0c             	sub    $0xc,%esp
+     dc1:	50                   	push   %eax
+     dc2:	e8 77 fa ff ff       	call   83e <sbrk>
+     dc7:	83 c4 10             	add    $0x10,%esp
+     dca:	83 f8 ff             	cmp    $0xffffffff,%eax
+     dcd:	74 e3                	je     db2 <largefree+0x84>
+    *pp = 0;
+     dcf:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+}
+     dd5:	eb db                	jmp    db2 <largefree+0x84>
+
+00000dd7 <more>:
+{
+     dd7:	55                   	push   %ebp
+     dd8:	89 e5                	mov    %esp,%ebp
+     dda:	56                   	push   %esi
+     ddb:	53                   	push   %ebx
+     ddc:	89 c6                	mov    %eax,%esi
+  pad = -(uint)sbrk(0) & 7;
+     dde:	83 ec 0c             	sub    $0xc,%esp
+     de1:	6a 00                	push   $0x0
+     de3:	e8 56 fa ff ff       	call   83e <sbrk>
+     de8:	f7 d8                	neg    %eax
+     dea:	89 c3                	mov    %eax,%ebx
+     dec:	83 e3 07             	and    $0x7,%ebx
+  if((p = sbrk(n + pad)) == (char*)-1)
+     def:	01 de                	add    %ebx,%esi
+     df1:	89 34 24             	mov    %esi,(%esp)
+     df4:	e8 45 fa ff ff       	call   83e <sbrk>
+     df9:	83 c4 10             	add    $0x10,%esp
+     dfc:	83 f8 ff             	cmp    $0xffffffff,%eax
+     dff:	74 09                	je     e0a <more+0x33>
+  return p + pad;
+     e01:	01 d8                	add    %ebx,%eax
+}
+     e03:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     e06:	5b                   	pop    %ebx
+     e07:	5e                   	pop    %esi
+     e08:	5d                   	pop    %ebp
+     e09:	c3                   	ret
+    return 0;
+     e0a:	b8 00 00 00 00       	mov    $0x0,%eax
+     e0f:	eb f2                	jmp    e03 <more+0x2c>
+
+00000e11 <slaballoc>:
+{
+     e11:	55                   	push   %ebp
+     e12:	89 e5                	mov    %esp,%ebp
+     e14:	56                   	push   %esi
+     e15:	53                   	push   %ebx
+     e16:	89 c6                	mov    %eax,%esi
+  n = 1 << (MINSHIFT + c);
+     e18:	8d 48 04             	lea    0x4(%eax),%ecx
+     e1b:	bb 01 00 00 00       	mov    $0x1,%ebx
+     e20:	d3 e3                	shl    %cl,%ebx
+  if(slab + n > slabend){
+     e22:	89 d8                	mov    %ebx,%eax
+     e24:	03 05 68 39 00 00    	add    0x3968,%eax
+     e2a:	39 05 64 39 00 00    	cmp    %eax,0x3964
+     e30:	72 17                	jb     e49 <slaballoc+0x38>
+  h = (Header*)slab;
+     e32:	a1 68 39 00 00       	mov    0x3968,%eax
+  slab += n;
+     e37:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+     e3a:	89 15 68 39 00 00    	mov    %edx,0x3968
+  h->size = n;
+     e40:	89 18                	mov    %ebx,(%eax)
+  h->class = c;
+     e42:	89 70 04             	mov    %esi,0x4(%eax)
+}
+     e45:	5b                   	pop    %ebx
+     e46:	5e                   	pop    %esi
+     e47:	5d                   	pop    %ebp
+     e48:	c3                   	ret
+    if((p = more(SLABSZ)) == 0)
+     e49:	b8 00 40 00 00       	mov    $0x4000,%eax
+     e4e:	e8 84 ff ff ff       	call   dd7 <more>
+     e53:	85 c0                	test   %eax,%eax
+     e55:	74 ee                	je     e45 <slaballoc+0x34>
+    if(p != slabend)
+     e57:	39 05 64 39 00 00    	cmp    %eax,0x3964
+     e5d:	74 05                	je     e64 <slaballoc+0x53>
+      slab = p;
+     e5f:	a3 68 39 00 00       	mov    %eax,0x3968
+    slabend = p + SLABSZ;
+     e64:	05 00 40 00 00       	add    $0x4000,%eax
+     e69:	a3 64 39 00 00       	mov    %eax,0x3964
+     e6e:	eb c2                	jmp    e32 <slaballoc+0x21>
+
+00000e70 <largealloc>:
+{
+     e70:	55                   	push   %ebp
+     e71:	89 e5                	mov    %esp,%ebp
+     e73:	56                   	push   %esi
+     e74:	53                   	push   %ebx
+     e75:	89 c3                	mov    %eax,%ebx
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     e77:	b9 6c 39 00 00       	mov    $0x396c,%ecx
+     e7c:	8b 01                	mov    (%ecx),%eax
+     e7e:	85 c0                	test   %eax,%eax
+     e80:	74 36                	je     eb8 <largealloc+0x48>
+    if(b->h.size < n)
+     e82:	8b 10                	mov    (%eax),%edx
+     e84:	39 da                	cmp    %ebx,%edx
+     e86:	72 24                	jb     eac <largealloc+0x3c>
+    if(b->h.size - n > SMALLMAX){
+     e88:	29 da                	sub    %ebx,%edx
+     e8a:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+     e90:	76 1f                	jbe    eb1 <largealloc+0x41>
+      rest = (Fblock*)((char*)b + n);
+     e92:	8d 34 18             	lea    (%eax,%ebx,1),%esi
+      rest->h.size = b->h.size - n;
+     e95:	89 16                	mov    %edx,(%esi)
+      rest->h.class = LARGE;
+     e97:	c7 46 04 09 00 00 00 	movl   $0x9,0x4(%esi)
+      rest->next = b->next;
+     e9e:	8b 50 08             	mov    0x8(%eax),%edx
+     ea1:	89 56 08             	mov    %edx,0x8(%esi)
+      *pp = rest;
+     ea4:	89 31                	mov    %esi,(%ecx)
+      b->h.size = n;
+     ea6:	89 18                	mov    %ebx,(%eax)
+}
+     ea8:	5b                   	pop    %ebx
+     ea9:	5e                   	pop    %esi
+     eaa:	5d                   	pop    %ebp
+     eab:	c3                   	ret
+  for(pp = &large; (b = *pp) != 0; pp = &b->next){
+     eac:	8d 48 08             	lea    0x8(%eax),%ecx
+     eaf:	eb cb                	jmp    e7c <largealloc+0xc>
+      *pp = b->next;
+     eb1:	8b 50 08             	mov    0x8(%eax),%edx
+     eb4:	89 11                	mov    %edx,(%ecx)
+    return &b->h;
+     eb6:	eb f0                	jmp    ea8 <largealloc+0x38>
+  if((b = more(n)) == 0)
+     eb8:	89 d8                	mov    %ebx,%eax
+     eba:	e8 18 ff ff ff       	call   dd7 <more>
+     ebf:	85 c0                	test   %eax,%eax
+     ec1:	74 e5                	je     ea8 <largealloc+0x38>
+  b->h.size = n;
+     ec3:	89 18                	mov    %ebx,(%eax)
+  b->h.class = LARGE;
+     ec5:	c7 40 04 09 00 00 00 	movl   $0x9,0x4(%eax)
+  return &b->h;
+     ecc:	eb da                	jmp    ea8 <largealloc+0x38>
+
+00000ece <free>:
+
+void
+free(void *ap)
+{
+     ece:	55                   	push   %ebp
+     ecf:	89 e5                	mov    %esp,%ebp
+     ed1:	56                   	push   %esi
+     ed2:	53                   	push   %ebx
+     ed3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+
+  if(ap == 0)
+     ed6:	85 db                	test   %ebx,%ebx
+     ed8:	74 3b                	je     f15 <free+0x47>
+    return;
+  h = (Header*)ap - 1;
+     eda:	8d 73 f8             	lea    -0x8(%ebx),%esi
+  lock_acquire(&lock);
+     edd:	83 ec 0c             	sub    $0xc,%esp
+     ee0:	68 60 39 00 00       	push   $0x3960
+     ee5:	e8 9c 01 00 00       	call   1086 <lock_acquire>
+  if(h->class == LARGE)
+     eea:	8b 43 fc             	mov    -0x4(%ebx),%eax
+     eed:	83 c4 10             	add    $0x10,%esp
+     ef0:	83 f8 09             	cmp    $0x9,%eax
+     ef3:	74 27                	je     f1c <free+0x4e>
+    largefree((Fblock*)h);
+  else {
+    ((Fblock*)h)->next = freelist[h->class];
+     ef5:	8b 14 85 80 39 00 00 	mov    0x3980(,%eax,4),%edx
+     efc:	89 13                	mov    %edx,(%ebx)
+    freelist[h->class] = (Fblock*)h;
+     efe:	89 34 85 80 39 00 00 	mov    %esi,0x3980(,%eax,4)
+  }
+  lock_release(&lock);
+     f05:	83 ec 0c             	sub    $0xc,%esp
+     f08:	68 60 39 00 00       	push   $0x3960
+     f0d:	e8 88 01 00 00       	call   109a <lock_release>
+     f12:	83 c4 10             	add    $0x10,%esp
+}
+     f15:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f18:	5b                   	pop    %ebx
+     f19:	5e                   	pop    %esi
+     f1a:	5d                   	pop    %ebp
+     f1b:	c3                   	ret
+    largefree((Fblock*)h);
+     f1c:	89 f0                	mov    %esi,%eax
+     f1e:	e8 0b fe ff ff       	call   d2e <largefree>
+     f23:	eb e0                	jmp    f05 <free+0x37>
+
+00000f25 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     f25:	55                   	push   %ebp
+     f26:	89 e5                	mov    %esp,%ebp
+     f28:	53                   	push   %ebx
+     f29:	83 ec 04             	sub    $0x4,%esp
+     f2c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  Header *h;
+  uint n;
+  int c;
+
+  if(nbytes > 0x7fffffff - sizeof(Header) - 7)
+     f2f:	81 fb f0 ff ff 7f    	cmp    $0x7ffffff0,%ebx
+     f35:	0f 87 8b 00 00 00    	ja     fc6 <malloc+0xa1>
+    return 0;
+  n = (nbytes + sizeof(Header) + 7) & ~7;
+     f3b:	83 c3 0f             	add    $0xf,%ebx
+     f3e:	83 e3 f8             	and    $0xfffffff8,%ebx
+  if(n < sizeof(Fblock))
+     f41:	83 fb 0b             	cmp    $0xb,%ebx
+     f44:	77 05                	ja     f4b <malloc+0x26>
+    n = sizeof(Fblock);
+     f46:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  lock_acquire(&lock);
+     f4b:	83 ec 0c             	sub    $0xc,%esp
+     f4e:	68 60 39 00 00       	push   $0x3960
+     f53:	e8 2e 01 00 00       	call   1086 <lock_acquire>
+  if(n <= SMALLMAX){
+     f58:	83 c4 10             	add    $0x10,%esp
+     f5b:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+     f61:	77 58                	ja     fbb <malloc+0x96>
+    for(c = 0; (1 << (MINSHIFT + c)) < n; c++)
+     f63:	ba 00 00 00 00       	mov    $0x0,%edx
+     f68:	eb 03                	jmp    f6d <malloc+0x48>
+     f6a:	83 c2 01             	add    $0x1,%edx
+     f6d:	8d 4a 04             	lea    0x4(%edx),%ecx
+     f70:	b8 01 00 00 00       	mov    $0x1,%eax
+     f75:	d3 e0                	shl    %cl,%eax
+     f77:	39 d8                	cmp    %ebx,%eax
+     f79:	72 ef                	jb     f6a <malloc+0x45>
+      ;
+    if(freelist[c]){
+     f7b:	8b 04 95 80 39 00 00 	mov    0x3980(,%edx,4),%eax
+     f82:	85 c0                	test   %eax,%eax
+     f84:	74 2a                	je     fb0 <malloc+0x8b>
+      h = &freelist[c]->h;
+     f86:	89 c3                	mov    %eax,%ebx
+      freelist[c] = freelist[c]->next;
+     f88:	8b 40 08             	mov    0x8(%eax),%eax
+     f8b:	89 04 95 80 39 00 00 	mov    %eax,0x3980(,%edx,4)
+    } else
+      h = slaballoc(c);
+  } else
+    h = largealloc(n);
+  lock_release(&lock);
+     f92:	83 ec 0c             	sub    $0xc,%esp
+     f95:	68 60 39 00 00       	push   $0x3960
+     f9a:	e8 fb 00 00 00       	call   109a <lock_release>
+  return h ? (void*)(h + 1) : 0;
+     f9f:	83 c4 10             	add    $0x10,%esp
+     fa2:	85 db                	test   %ebx,%ebx
+     fa4:	74 03                	je     fa9 <malloc+0x84>
+     fa6:	83 c3 08             	add    $0x8,%ebx
+}
+     fa9:	89 d8                	mov    %ebx,%eax
+     fab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     fae:	c9                   	leave
+     faf:	c3                   	ret
+      h = slaballoc(c);
+     fb0:	89 d0                	mov    %edx,%eax
+     fb2:	e8 5a fe ff ff       	call   e11 <slaballoc>
+     fb7:	89 c3                	mov    %eax,%ebx
+     fb9:	eb d7                	jmp    f92 <malloc+0x6d>
+    h = largealloc(n);
+     fbb:	89 d8                	mov    %ebx,%eax
+     fbd:	e8 ae fe ff ff       	call   e70 <largealloc>
+     fc2:	89 c3                	mov    %eax,%ebx
+     fc4:	eb cc                	jmp    f92 <malloc+0x6d>
+    return 0;
+     fc6:	bb 00 00 00 00       	mov    $0x0,%ebx
+     fcb:	eb dc                	jmp    fa9 <malloc+0x84>
+
+00000fcd <tstart>:
+  void *arg;
+};
+
+static void
+tstart(void *a)
+{
+     fcd:	55                   	push   %ebp
+     fce:	89 e5                	mov    %esp,%ebp
+     fd0:	83 ec 14             	sub    $0x14,%esp
+     fd3:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct tstart *t = a;
+
+  t->fn(t->arg);
+     fd6:	ff 70 04             	push   0x4(%eax)
+     fd9:	ff 10                	call   *(%eax)
+  exit();
+     fdb:	e8 86 f6 ff ff       	call   666 <exit>
+
+00000fe0 <thread_create>:
+}
+
+// Run fn(arg) in a new thread.  Returns its pid, or -1.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+     fe0:	55                   	push   %ebp
+     fe1:	89 e5                	mov    %esp,%ebp
+     fe3:	56                   	push   %esi
+     fe4:	53                   	push   %ebx
+  struct tstart *t;
+  char *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+     fe5:	83 ec 0c             	sub    $0xc,%esp
+     fe8:	68 00 10 00 00       	push   $0x1000
+     fed:	e8 33 ff ff ff       	call   f25 <malloc>
+     ff2:	83 c4 10             	add    $0x10,%esp
+     ff5:	85 c0                	test   %eax,%eax
+     ff7:	74 42                	je     103b <thread_create+0x5b>
+     ff9:	89 c3                	mov    %eax,%ebx
+    return -1;
+  t = (struct tstart*)stack;
+  t->fn = fn;
+     ffb:	8b 45 08             	mov    0x8(%ebp),%eax
+     ffe:	89 03                	mov    %eax,(%ebx)
+  t->arg = arg;
+    1000:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1003:	89 43 04             	mov    %eax,0x4(%ebx)
+  if((pid = clone(tstart, stack + TSTACK, t)) < 0)
+    1006:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+    100c:	83 ec 04             	sub    $0x4,%esp
+    100f:	53                   	push   %ebx
+    1010:	50                   	push   %eax
+    1011:	68 cd 0f 00 00       	push   $0xfcd
+    1016:	e8 f5 f8 ff ff       	call   910 <clone>
+    101b:	89 c6                	mov    %eax,%esi
+    101d:	83 c4 10             	add    $0x10,%esp
+    1020:	85 c0                	test   %eax,%eax
+    1022:	78 09                	js     102d <thread_create+0x4d>
+    free(stack);
+  return pid;
+}
+    1024:	89 f0                	mov    %esi,%eax
+    1026:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1029:	5b                   	pop    %ebx
+    102a:	5e                   	pop    %esi
+    102b:	5d                   	pop    %ebp
+    102c:	c3                   	ret
+    free(stack);
+    102d:	83 ec 0c             	sub    $0xc,%esp
+    1030:	53                   	push   %ebx
+    1031:	e8 98 fe ff ff       	call   ece <free>
+    1036:	83 c4 10             	add    $0x10,%esp
+    1039:	eb e9                	jmp    1024 <thread_create+0x44>
+    return -1;
+    103b:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1040:	eb e2                	jmp    1024 <thread_create+0x44>
+
+00001042 <thread_join>:
+
+// Wait for one of this process's threads to exit and free its
+// stack.  Returns its pid, or -1 if there are no threads.
+int
+thread_join(void)
+{
+    1042:	55                   	push   %ebp
+    1043:	89 e5                	mov    %esp,%ebp
+    1045:	53                   	push   %ebx
+    1046:	83 ec 20             	sub    $0x20,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    1049:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    104c:	50                   	push   %eax
+    104d:	e8 cd f8 ff ff       	call   91f <join>
+    1052:	89 c3                	mov    %eax,%ebx
+    1054:	83 c4 10             	add    $0x10,%esp
+    1057:	85 c0                	test   %eax,%eax
+    1059:	79 07                	jns    1062 <thread_join+0x20>
+    free((char*)stack - TSTACK);
+  return pid;
+}
+    105b:	89 d8                	mov    %ebx,%eax
+    105d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1060:	c9                   	leave
+    1061:	c3                   	ret
+    free((char*)stack - TSTACK);
+    1062:	83 ec 0c             	sub    $0xc,%esp
+    1065:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1068:	2d 00 10 00 00       	sub    $0x1000,%eax
+    106d:	50                   	push   %eax
+    106e:	e8 5b fe ff ff       	call   ece <free>
+    1073:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    1076:	eb e3                	jmp    105b <thread_join+0x19>
+
+00001078 <lock_init>:
+
+void
+lock_init(lock_t *lk)
+{
+    1078:	55                   	push   %ebp
+    1079:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    107b:	8b 45 08             	mov    0x8(%ebp),%eax
+    107e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    1084:	5d                   	pop    %ebp
+    1085:	c3                   	ret
+
+00001086 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+    1086:	55                   	push   %ebp
+    1087:	89 e5                	mov    %esp,%ebp
+    1089:	8b 55 08             	mov    0x8(%ebp),%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    108c:	b8 01 00 00 00       	mov    $0x1,%eax
+    1091:	f0 87 02             	lock xchg %eax,(%edx)
+  while(xchg(&lk->locked, 1) != 0)
+    1094:	85 c0                	test   %eax,%eax
+    1096:	75 f4                	jne    108c <lock_acquire+0x6>
+    ;
+}
+    1098:	5d                   	pop    %ebp
+    1099:	c3                   	ret
+
+0000109a <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+    109a:	55                   	push   %ebp
+    109b:	89 e5                	mov    %esp,%ebp
+    109d:	8b 55 08             	mov    0x8(%ebp),%edx
+    10a0:	b8 00 00 00 00       	mov    $0x0,%eax
+    10a5:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    10a8:	5d                   	pop    %ebp
+    10a9:	c3                   	ret
+
+000010aa <mutex_init>:
+// Are Tricky": state is 0 when free, 1 when held, 2 when held and
+// others may be waiting.  Unlocking an uncontended mutex costs no
+// system call.
+void
+mutex_init(mutex_t *m)
+{
+    10aa:	55                   	push   %ebp
+    10ab:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    10ad:	8b 45 08             	mov    0x8(%ebp),%eax
+    10b0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    10b6:	5d                   	pop    %ebp
+    10b7:	c3                   	ret
+
+000010b8 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+    10b8:	55                   	push   %ebp
+    10b9:	89 e5                	mov    %esp,%ebp
+    10bb:	53                   	push   %ebx
+    10bc:	83 ec 04             	sub    $0x4,%esp
+    10bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uint c;
+
+  if((c = __sync_val_compare_and_swap(&m->state, 0, 1)) == 0)
+    10c2:	b8 00 00 00 00       	mov    $0x0,%eax
+    10c7:	b9 01 00 00 00       	mov    $0x1,%ecx
+    10cc:	f0 0f b1 0b          	lock cmpxchg %ecx,(%ebx)
+    10d0:	85 c0                	test   %eax,%eax
+    10d2:	74 29                	je     10fd <mutex_lock+0x45>
+    return;
+  if(c != 2)
+    10d4:	83 f8 02             	cmp    $0x2,%eax
+    10d7:	74 20                	je     10f9 <mutex_lock+0x41>
+    10d9:	b8 02 00 00 00       	mov    $0x2,%eax
+    10de:	f0 87 03             	lock xchg %eax,(%ebx)
+               "+m" (*addr), "=a" (result) :
+               "1" (newval) :
+               "cc");
+  return result;
+    10e1:	eb 16                	jmp    10f9 <mutex_lock+0x41>
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait(&m->state, 2);
+    10e3:	83 ec 08             	sub    $0x8,%esp
+    10e6:	6a 02                	push   $0x2
+    10e8:	53                   	push   %ebx
+    10e9:	e8 40 f8 ff ff       	call   92e <futex_wait>
+  asm volatile("lock; xchgl %0, %1" :
+    10ee:	b8 02 00 00 00       	mov    $0x2,%eax
+    10f3:	f0 87 03             	lock xchg %eax,(%ebx)
+    10f6:	83 c4 10             	add    $0x10,%esp
+  while(c != 0){
+    10f9:	85 c0                	test   %eax,%eax
+    10fb:	75 e6                	jne    10e3 <mutex_lock+0x2b>
+    c = xchg(&m->state, 2);
+  }
+}
+    10fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1100:	c9                   	leave
+    1101:	c3                   	ret
+
+00001102 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+    1102:	55                   	push   %ebp
+    1103:	89 e5                	mov    %esp,%ebp
+    1105:	83 ec 08             	sub    $0x8,%esp
+    1108:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(__sync_fetch_and_sub(&m->state, 1) != 1){
+    110b:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    1110:	f0 0f c1 10          	lock xadd %edx,(%eax)
+    1114:	83 fa 01             	cmp    $0x1,%edx
+    1117:	75 02                	jne    111b <mutex_unlock+0x19>
+    m->state = 0;
+    futex_wake(&m->state, 1);
+  }
+}
+    1119:	c9                   	leave
+    111a:	c3                   	ret
+    m->state = 0;
+    111b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    futex_wake(&m->state, 1);
+    1121:	83 ec 08             	sub    $0x8,%esp
+    1124:	6a 01                	push   $0x1
+    1126:	50                   	push   %eax
+    1127:	e8 11 f8 ff ff       	call   93d <futex_wake>
+    112c:	83 c4 10             	add    $0x10,%esp
+}
+    112f:	eb e8                	jmp    1119 <mutex_unlock+0x17>
+
+00001131 <cond_init>:
+// Condition variable: waiters sleep on a sequence number that
+// every signal bumps, so a signal between the unlock and the
+// futex_wait() in cond_wait() is not lost.
+void
+cond_init(cond_t *c)
+{
+    1131:	55                   	push   %ebp
+    1132:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    1134:	8b 45 08             	mov    0x8(%ebp),%eax
+    1137:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    113d:	5d                   	pop    %ebp
+    113e:	c3                   	ret
+
+0000113f <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+    113f:	55                   	push   %ebp
+    1140:	89 e5                	mov    %esp,%ebp
+    1142:	57                   	push   %edi
+    1143:	56                   	push   %esi
+    1144:	53                   	push   %ebx
+    1145:	83 ec 18             	sub    $0x18,%esp
+    1148:	8b 75 08             	mov    0x8(%ebp),%esi
+    114b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    114e:	8b 3e                	mov    (%esi),%edi
+  mutex_unlock(m);
+    1150:	53                   	push   %ebx
+    1151:	e8 ac ff ff ff       	call   1102 <mutex_unlock>
+  futex_wait(&c->seq, seq);
+    1156:	83 c4 08             	add    $0x8,%esp
+    1159:	57                   	push   %edi
+    115a:	56                   	push   %esi
+    115b:	e8 ce f7 ff ff       	call   92e <futex_wait>
+  // Others may be waiting for m too: take it as contended.
+  while(xchg(&m->state, 2) != 0)
+    1160:	83 c4 10             	add    $0x10,%esp
+    1163:	eb 0e                	jmp    1173 <cond_wait+0x34>
+    futex_wait(&m->state, 2);
+    1165:	83 ec 08             	sub    $0x8,%esp
+    1168:	6a 02                	push   $0x2
+    116a:	53                   	push   %ebx
+    116b:	e8 be f7 ff ff       	call   92e <futex_wait>
+    1170:	83 c4 10             	add    $0x10,%esp
+    1173:	b8 02 00 00 00       	mov    $0x2,%eax
+    1178:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    117b:	85 c0                	test   %eax,%eax
+    117d:	75 e6                	jne    1165 <cond_wait+0x26>
+}
+    117f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1182:	5b                   	pop    %ebx
+    1183:	5e                   	pop    %esi
+    1184:	5f                   	pop    %edi
+    1185:	5d                   	pop    %ebp
+    1186:	c3                   	ret
+
+00001187 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+    1187:	55                   	push   %ebp
+    1188:	89 e5                	mov    %esp,%ebp
+    118a:	83 ec 10             	sub    $0x10,%esp
+    118d:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    1190:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, 1);
+    1194:	6a 01                	push   $0x1
+    1196:	50                   	push   %eax
+    1197:	e8 a1 f7 ff ff       	call   93d <futex_wake>
+}
+    119c:	83 c4 10             	add    $0x10,%esp
+    119f:	c9                   	leave
+    11a0:	c3                   	ret
+
+000011a1 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+    11a1:	55                   	push   %ebp
+    11a2:	89 e5                	mov    %esp,%ebp
+    11a4:	83 ec 10             	sub    $0x10,%esp
+    11a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    11aa:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex_wake(&c->seq, NPROC);
+    11ae:	6a 40                	push   $0x40
+    11b0:	50                   	push   %eax
+    11b1:	e8 87 f7 ff ff       	call   93d <futex_wake>
+}
+    11b6:	83 c4 10             	add    $0x10,%esp
+    11b9:	c9                   	leave
+    11ba:	c3                   	ret